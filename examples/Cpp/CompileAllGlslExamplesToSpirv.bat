@@ -18,6 +18,14 @@ call :CompileGlslToSpirv Fonts/Example.450core.vert
 call :CompileGlslToSpirv Fonts/Example.450core.frag
 echo DONE
 
+echo ####### GPUCulling #######
+call :CompileGlslToSpirv GPUCulling/Example.CSCull.comp
+call :CompileGlslToSpirv GPUCulling/Example.CSReduceHiZ.comp
+call :CompileGlslToSpirv GPUCulling/Example.VS.vert
+call :CompileGlslToSpirv GPUCulling/Example.PS.frag
+call :CompileGlslToSpirv GPUCulling/Example.PSDepth.frag
+echo DONE
+
 echo ####### HelloGame #######
 call :CompileGlslToSpirv HelloGame/HelloGame.VSInstance.450core.vert
 call :CompileGlslToSpirv HelloGame/HelloGame.PSInstance.450core.frag
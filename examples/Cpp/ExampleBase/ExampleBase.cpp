@@ -8,6 +8,7 @@
 #include <ExampleBase.h>
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/ChromeTrace.h>
 #include "ImageReader.h"
 #include "FileUtils.h"
 #include <stdio.h>
@@ -354,6 +355,7 @@ struct ExampleConfig
     bool            debugger        = false;
     long            flags           = 0;
     bool            immediateSubmit = false;
+    bool            benchmark       = false;
 };
 
 static ExampleConfig g_Config;
@@ -373,6 +375,8 @@ void ExampleBase::ParseProgramArgs(int argc, char* argv[])
         g_Config.debugger = true;
     if (HasArgument("-i", argc, argv) || HasArgument("--icontext", argc, argv))
         g_Config.immediateSubmit = true;
+    if (HasArgument("--benchmark", argc, argv))
+        g_Config.benchmark = true;
     if (HasArgument("--nvidia", argc, argv))
         g_Config.flags |= LLGL::RenderSystemFlags::PreferNVIDIA;
     if (HasArgument("--amd", argc, argv))
@@ -654,16 +658,18 @@ void ExampleBase::MainLoop()
                 LLGL::Log::Printf("%s: GPU time: %" PRIu64 " ns\n", rec.annotation.c_str(), rec.elapsedTime);
 
             debuggerObj_->SetTimeRecording(false);
+            debuggerObj_->SetEventRecording(false);
             showTimeRecords_ = false;
 
-            // Write frame profile to JSON file to be viewed in Google Chrome's Trace Viewer
+            // Write frame profile to JSON file to be viewed in Google Chrome's Trace Viewer or the Perfetto UI
             const char* frameProfileFilename = "LLGL.trace.json";
-            WriteFrameProfileToJsonFile(frameProfile, frameProfileFilename);
+            LLGL::SaveChromeTrace(frameProfile, frameProfileFilename);
             LLGL::Log::Printf("Saved frame profile to file: %s\n", frameProfileFilename);
         }
         else if (input.KeyDown(LLGL::Key::F1))
         {
             debuggerObj_->SetTimeRecording(true);
+            debuggerObj_->SetEventRecording(true);
             showTimeRecords_ = true;
         }
     }
@@ -1072,3 +1078,8 @@ const std::string& ExampleBase::GetModuleName()
     return g_Config.rendererModule;
 }
 
+bool ExampleBase::IsBenchmarkMode()
+{
+    return g_Config.benchmark;
+}
+
@@ -325,6 +325,9 @@ protected:
     // Returns the name of the renderer module (e.g. "OpenGL" or "Direct3D11").
     static const std::string& GetModuleName();
 
+    // Returns true if the example was started with the '--benchmark' argument.
+    static bool IsBenchmarkMode();
+
 protected:
 
     template <typename Container>
@@ -0,0 +1,29 @@
+// GLSL fragment shader
+
+#version 450 core
+
+layout(std140, binding = 2) uniform Settings
+{
+    mat4    vpMatrix;
+    uint    numInstances;
+    uint    hiZEnabled;
+    uint    hiZNumLevels;
+    uint    depthRangeUnitCube;
+    vec2    hiZSize;
+    uint    originLowerLeft;
+    uint    _pad0;
+    vec4    lightDir;
+};
+
+layout(location = 0) in vec3 vNormal;
+layout(location = 1) in vec3 vColor;
+
+layout(location = 0) out vec4 fragColor;
+
+// Fragment shader main function
+void main()
+{
+    float NdotL = clamp(dot(normalize(vNormal), -lightDir.xyz), 0.0, 1.0);
+    fragColor = vec4(vColor * mix(0.3, 1.0, NdotL), 1.0);
+}
+
@@ -0,0 +1,15 @@
+// GLSL fragment shader for the depth pre-pass
+
+#version 450 core
+
+layout(location = 0) in vec3 vNormal;
+layout(location = 1) in vec3 vColor;
+
+layout(location = 0) out float fragDepth;
+
+// Fragment shader main function
+void main()
+{
+    fragDepth = gl_FragCoord.z;
+}
+
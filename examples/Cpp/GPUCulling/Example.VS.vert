@@ -0,0 +1,42 @@
+// GLSL vertex shader
+
+#version 450 core
+
+layout(std140, binding = 2) uniform Settings
+{
+    mat4    vpMatrix;
+    uint    numInstances;
+    uint    hiZEnabled;
+    uint    hiZNumLevels;
+    uint    depthRangeUnitCube;
+    vec2    hiZSize;
+    uint    originLowerLeft;
+    uint    _pad0;
+    vec4    lightDir;
+};
+
+layout(location = 0) in vec3 position;
+layout(location = 1) in vec3 normal;
+layout(location = 2) in vec2 texCoord;
+layout(location = 3) in vec4 instance;
+
+layout(location = 0) out vec3 vNormal;
+layout(location = 1) out vec3 vColor;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+// Vertex shader main function
+void main()
+{
+    vec3 worldPos   = instance.xyz + position * instance.w;
+    gl_Position     = vpMatrix * vec4(worldPos, 1.0);
+    vNormal         = normal;
+
+    // Generate color from instance position
+    float hue = fract(sin(dot(instance.xz, vec2(12.9898, 78.233))) * 43758.5453);
+    vColor = cos((hue + vec3(0.0, 0.33, 0.67)) * 6.283185) * 0.4 + 0.6;
+}
+
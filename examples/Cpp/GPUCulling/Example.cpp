@@ -0,0 +1,610 @@
+/*
+ * Example.cpp (Example_GPUCulling)
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <ExampleBase.h>
+#include <LLGL/Utils/ForRange.h>
+#include <cstddef>
+#include <cstdlib>
+#include <thread>
+
+
+/*
+Renders a large field of cubes whose visibility is determined entirely on the GPU:
+1. Depth pre-pass: The visible instances of the previous frame are rendered into a low resolution depth target.
+2. Hierarchical-Z (HiZ): A compute shader reduces this depth target into a MIP-chain where each texel stores the farthest depth value.
+3. Culling: A compute shader tests each instance against the view frustum and the HiZ buffer and appends the visible ones
+   together with their indirect draw arguments. The number of visible instances is written into a separate count buffer.
+4. Drawing: All visible instances are drawn with a single DrawIndexedIndirectCount command,
+   or with a single instanced DrawIndexedIndirect command if the renderer does not support count-based indirect draws.
+Run with '--benchmark' to render one million instances and print the GPU timings periodically.
+*/
+class Example_GPUCulling : public ExampleBase
+{
+
+    static constexpr std::uint32_t  numInstancesDefault     = 256 * 256;
+    static constexpr std::uint32_t  numInstancesBenchmark   = 1024 * 1024;
+    static constexpr std::uint32_t  cullGroupSize           = 64;
+    static constexpr std::uint32_t  reduceGroupSize         = 8;
+    static constexpr std::uint32_t  hiZWidth                = 512;
+    static constexpr std::uint32_t  hiZHeight               = 256;
+    static constexpr float          instanceSpacing         = 3.0f;
+
+    const std::uint32_t         numInstances;
+
+    LLGL::VertexFormat          vertexFormat[2];
+    std::uint32_t               numIndices              = 0;
+
+    LLGL::Buffer*               vertexBuffer            = nullptr;
+    LLGL::Buffer*               indexBuffer             = nullptr;
+    LLGL::Buffer*               settingsBuffer          = nullptr;
+    LLGL::Buffer*               instanceBuffer          = nullptr;
+    LLGL::Buffer*               visibleInstanceBuffer   = nullptr;
+    LLGL::Buffer*               drawArgBuffer           = nullptr;
+    LLGL::Buffer*               drawCountBuffer         = nullptr;
+    LLGL::BufferArray*          vertexBufferArray       = nullptr;
+
+    LLGL::Texture*              hiZTexture              = nullptr;
+    LLGL::RenderTarget*         hiZRenderTarget         = nullptr;
+    std::uint32_t               hiZNumLevels            = 1;
+
+    LLGL::Shader*               csCull                  = nullptr;
+    LLGL::Shader*               csReduceHiZ             = nullptr;
+    LLGL::Shader*               vsScene                 = nullptr;
+    LLGL::Shader*               psScene                 = nullptr;
+    LLGL::Shader*               psDepth                 = nullptr;
+
+    LLGL::PipelineLayout*       cullLayout              = nullptr;
+    LLGL::PipelineLayout*       reduceLayout            = nullptr;
+    LLGL::PipelineLayout*       sceneLayout             = nullptr;
+    LLGL::ResourceHeap*         reduceResourceHeap      = nullptr;
+
+    LLGL::PipelineState*        cullPipeline            = nullptr;
+    LLGL::PipelineState*        reducePipeline          = nullptr;
+    LLGL::PipelineState*        scenePipeline           = nullptr;
+    LLGL::PipelineState*        depthPipeline           = nullptr;
+
+    LLGL::QueryHeap*            timerQueryHeap          = nullptr;
+
+    bool                        hasIndirectCountDrawing = false;
+    bool                        useIndirectCount        = false;
+    bool                        hiZEnabled              = true;
+    bool                        hasPrevFrame            = false;
+
+    float                       viewRotation            = 0.0f;
+    double                      printElapsedTime        = 0.0;
+    std::uint32_t               printNumFrames          = 0;
+
+    struct Settings
+    {
+        Gs::Matrix4f    vpMatrix;
+        std::uint32_t   numInstances        = 0;
+        std::uint32_t   hiZEnabled          = 0;
+        std::uint32_t   hiZNumLevels        = 1;
+        std::uint32_t   depthRangeUnitCube  = 0;    // Non-zero if the NDC depth range is [-1, +1] instead of [0, 1]
+        float           hiZSize[2]          = { 1.0f, 1.0f };
+        std::uint32_t   originLowerLeft     = 0;    // Non-zero if row 0 of the HiZ texture is at the bottom of the screen
+        std::uint32_t   _pad0               = 0;
+        Gs::Vector4f    lightDir            = { -0.4f, -0.8f, -0.45f, 0.0f };
+    }
+    settings;
+
+    // Same layout as LLGL::DrawIndexedIndirectArguments; The culling shader uses 'numInstances' as counter
+    struct DrawCount
+    {
+        std::uint32_t   numIndices      = 0;
+        std::uint32_t   numInstances    = 0;
+        std::uint32_t   firstIndex      = 0;
+        std::int32_t    vertexOffset    = 0;
+        std::uint32_t   firstInstance   = 0;
+    };
+
+    static_assert(sizeof(DrawCount) == sizeof(LLGL::DrawIndexedIndirectArguments), "DrawCount must have the same size as LLGL::DrawIndexedIndirectArguments");
+
+public:
+
+    Example_GPUCulling() :
+        ExampleBase  { "LLGL Example: GPU Culling"                                   },
+        numInstances { IsBenchmarkMode() ? numInstancesBenchmark : numInstancesDefault }
+    {
+        const LLGL::RenderingCapabilities& renderCaps = renderer->GetRenderingCaps();
+
+        if (!renderCaps.features.hasComputeShaders)
+            throw std::runtime_error("compute shaders are not supported by this renderer");
+        if (!renderCaps.features.hasStorageBuffers)
+            throw std::runtime_error("storage buffers are not supported by this renderer");
+
+        hasIndirectCountDrawing = renderCaps.features.hasIndirectCountDrawing;
+        useIndirectCount        = hasIndirectCountDrawing;
+
+        // Create all graphics objects
+        CreateBuffers();
+        CreateHiZ();
+        LoadShaders();
+        CreateComputePipelines();
+        CreateGraphicsPipelines();
+        CreateQueries();
+
+        // Initialize constant settings
+        settings.numInstances       = numInstances;
+        settings.hiZNumLevels       = hiZNumLevels;
+        settings.depthRangeUnitCube = (renderCaps.clippingRange == LLGL::ClippingRange::MinusOneToOne ? 1 : 0);
+        settings.hiZSize[0]         = static_cast<float>(hiZWidth);
+        settings.hiZSize[1]         = static_cast<float>(hiZHeight);
+        settings.originLowerLeft    = (IsScreenOriginLowerLeft() ? 1 : 0);
+        settings.lightDir.Normalize();
+
+        // Print some information on the standard output
+        LLGL::Log::Printf(
+            "number of instances: %u\n"
+            "press H to enable/disable HiZ occlusion culling\n",
+            numInstances
+        );
+        if (hasIndirectCountDrawing)
+            LLGL::Log::Printf("press C to switch between DrawIndexedIndirectCount and instanced DrawIndexedIndirect\n");
+        else
+            LLGL::Log::Printf("DrawIndexedIndirectCount not supported: falling back to instanced DrawIndexedIndirect\n");
+    }
+
+private:
+
+    float Random(float a, float b) const
+    {
+        auto rnd = static_cast<float>(rand()) / static_cast<float>(RAND_MAX);
+        return a + (b - a) * rnd;
+    }
+
+    void CreateBuffers()
+    {
+        // Specify vertex formats
+        vertexFormat[0].AppendAttribute({ "position", LLGL::Format::RGB32Float, /*location:*/ 0, /*offset:*/  0, /*stride:*/ sizeof(TexturedVertex), /*slot:*/ 0 });
+        vertexFormat[0].AppendAttribute({ "normal",   LLGL::Format::RGB32Float, /*location:*/ 1, /*offset:*/ 12, /*stride:*/ sizeof(TexturedVertex), /*slot:*/ 0 });
+        vertexFormat[0].AppendAttribute({ "texCoord", LLGL::Format::RG32Float,  /*location:*/ 2, /*offset:*/ 24, /*stride:*/ sizeof(TexturedVertex), /*slot:*/ 0 });
+
+        vertexFormat[1].attributes =
+        {
+            LLGL::VertexAttribute{ "instance", LLGL::Format::RGBA32Float, /*location:*/ 3, /*offset:*/ 0, /*stride:*/ sizeof(Gs::Vector4f), /*slot:*/ 1, /*instanceDivisor:*/ 1 },
+        };
+
+        // Create cube mesh with one vertex and index buffer
+        const std::vector<TexturedVertex> vertices = GenerateTexturedCubeVertices();
+        const std::vector<std::uint32_t> indices = GenerateTexturedCubeTriangleIndices();
+        numIndices = static_cast<std::uint32_t>(indices.size());
+
+        vertexBuffer    = CreateVertexBuffer(vertices, vertexFormat[0]);
+        indexBuffer     = CreateIndexBuffer(indices, LLGL::Format::R32UInt);
+        settingsBuffer  = CreateConstantBuffer(settings);
+
+        // Generate instances on a grid with random sizes; Every couple of instances is a large occluder
+        std::vector<Gs::Vector4f> instances(numInstances);
+
+        const std::uint32_t gridSize    = static_cast<std::uint32_t>(std::sqrt(static_cast<float>(numInstances)));
+        const float         gridOrigin  = -0.5f * instanceSpacing * static_cast<float>(gridSize);
+
+        for_range(i, numInstances)
+        {
+            const float scale = (i % 41 == 0 ? Random(2.0f, 4.0f) : Random(0.3f, 1.2f));
+            instances[i] = Gs::Vector4f
+            {
+                gridOrigin + instanceSpacing * static_cast<float>(i % gridSize) + Random(-0.5f, 0.5f),
+                scale,
+                gridOrigin + instanceSpacing * static_cast<float>(i / gridSize) + Random(-0.5f, 0.5f),
+                scale
+            };
+        }
+
+        LLGL::BufferDescriptor instanceBufferDesc;
+        {
+            instanceBufferDesc.debugName    = "Instances";
+            instanceBufferDesc.size         = sizeof(Gs::Vector4f) * numInstances;
+            instanceBufferDesc.bindFlags    = LLGL::BindFlags::Sampled;
+            instanceBufferDesc.format       = LLGL::Format::RGBA32Float;
+        }
+        instanceBuffer = renderer->CreateBuffer(instanceBufferDesc, instances.data());
+
+        // Create output buffer for the visible instances, which is read as per-instance vertex buffer
+        LLGL::BufferDescriptor visibleInstanceBufferDesc;
+        {
+            visibleInstanceBufferDesc.debugName     = "VisibleInstances";
+            visibleInstanceBufferDesc.size          = sizeof(Gs::Vector4f) * numInstances;
+            visibleInstanceBufferDesc.bindFlags     = LLGL::BindFlags::VertexBuffer | LLGL::BindFlags::Storage;
+            visibleInstanceBufferDesc.vertexAttribs = vertexFormat[1].attributes;
+            visibleInstanceBufferDesc.format        = LLGL::Format::RGBA32Float;
+        }
+        visibleInstanceBuffer = renderer->CreateBuffer(visibleInstanceBufferDesc);
+
+        LLGL::Buffer* buffers[2] = { vertexBuffer, visibleInstanceBuffer };
+        vertexBufferArray = renderer->CreateBufferArray(2, buffers);
+
+        // Create indirect argument buffer with one draw command per visible instance
+        LLGL::BufferDescriptor drawArgBufferDesc;
+        {
+            drawArgBufferDesc.debugName = "DrawArguments";
+            drawArgBufferDesc.size      = sizeof(LLGL::DrawIndexedIndirectArguments) * numInstances;
+            drawArgBufferDesc.bindFlags = LLGL::BindFlags::IndirectBuffer | LLGL::BindFlags::Storage;
+            drawArgBufferDesc.format    = LLGL::Format::R32UInt;
+        }
+        drawArgBuffer = renderer->CreateBuffer(drawArgBufferDesc);
+
+        // Create draw count buffer; It doubles as argument buffer for a single instanced draw command if count-based indirect draws are not supported
+        DrawCount initialDrawCount;
+        initialDrawCount.numIndices = numIndices;
+
+        LLGL::BufferDescriptor drawCountBufferDesc;
+        {
+            drawCountBufferDesc.debugName   = "DrawCount";
+            drawCountBufferDesc.size        = sizeof(DrawCount);
+            drawCountBufferDesc.bindFlags   = LLGL::BindFlags::IndirectBuffer | LLGL::BindFlags::Storage | LLGL::BindFlags::CopySrc | LLGL::BindFlags::CopyDst;
+            drawCountBufferDesc.format      = LLGL::Format::R32UInt;
+        }
+        drawCountBuffer = renderer->CreateBuffer(drawCountBufferDesc, &initialDrawCount);
+    }
+
+    void CreateHiZ()
+    {
+        // Create HiZ texture with a full MIP-chain; MIP level 0 is written by the depth pre-pass
+        LLGL::TextureDescriptor texDesc;
+        {
+            texDesc.debugName   = "HiZ";
+            texDesc.type        = LLGL::TextureType::Texture2D;
+            texDesc.bindFlags   = LLGL::BindFlags::ColorAttachment | LLGL::BindFlags::Sampled | LLGL::BindFlags::Storage;
+            texDesc.format      = LLGL::Format::R32Float;
+            texDesc.extent      = { hiZWidth, hiZHeight, 1 };
+            texDesc.mipLevels   = LLGL::NumMipLevels(hiZWidth, hiZHeight);
+        }
+        hiZTexture = renderer->CreateTexture(texDesc);
+        hiZNumLevels = texDesc.mipLevels;
+
+        LLGL::RenderTargetDescriptor renderTargetDesc;
+        {
+            renderTargetDesc.debugName              = "HiZ.RenderTarget";
+            renderTargetDesc.resolution             = { hiZWidth, hiZHeight };
+            renderTargetDesc.colorAttachments[0]    = LLGL::AttachmentDescriptor{ hiZTexture, /*mipLevel:*/ 0 };
+            renderTargetDesc.depthStencilAttachment = LLGL::Format::D32Float;
+        }
+        hiZRenderTarget = renderer->CreateRenderTarget(renderTargetDesc);
+    }
+
+    void LoadShaders()
+    {
+        const std::vector<LLGL::VertexFormat> vertexFormats = { vertexFormat[0], vertexFormat[1] };
+
+        if (Supported(LLGL::ShadingLanguage::GLSL))
+        {
+            csCull      = LoadShader({ LLGL::ShaderType::Compute,  "Example.CSCull.comp"      });
+            csReduceHiZ = LoadShader({ LLGL::ShaderType::Compute,  "Example.CSReduceHiZ.comp" });
+            vsScene     = LoadShader({ LLGL::ShaderType::Vertex,   "Example.VS.vert"          }, vertexFormats);
+            psScene     = LoadShader({ LLGL::ShaderType::Fragment, "Example.PS.frag"          });
+            psDepth     = LoadShader({ LLGL::ShaderType::Fragment, "Example.PSDepth.frag"     });
+        }
+        else if (Supported(LLGL::ShadingLanguage::SPIRV))
+        {
+            csCull      = LoadShader({ LLGL::ShaderType::Compute,  "Example.CSCull.comp.spv"      });
+            csReduceHiZ = LoadShader({ LLGL::ShaderType::Compute,  "Example.CSReduceHiZ.comp.spv" });
+            vsScene     = LoadShader({ LLGL::ShaderType::Vertex,   "Example.VS.vert.spv"          }, vertexFormats);
+            psScene     = LoadShader({ LLGL::ShaderType::Fragment, "Example.PS.frag.spv"          });
+            psDepth     = LoadShader({ LLGL::ShaderType::Fragment, "Example.PSDepth.frag.spv"     });
+        }
+        else if (Supported(LLGL::ShadingLanguage::HLSL))
+        {
+            csCull      = LoadShader({ LLGL::ShaderType::Compute,  "Example.hlsl", "CSCull",      "cs_5_0" });
+            csReduceHiZ = LoadShader({ LLGL::ShaderType::Compute,  "Example.hlsl", "CSReduceHiZ", "cs_5_0" });
+            vsScene     = LoadShader({ LLGL::ShaderType::Vertex,   "Example.hlsl", "VS",          "vs_5_0" }, vertexFormats);
+            psScene     = LoadShader({ LLGL::ShaderType::Fragment, "Example.hlsl", "PS",          "ps_5_0" });
+            psDepth     = LoadShader({ LLGL::ShaderType::Fragment, "Example.hlsl", "PSDepth",     "ps_5_0" });
+        }
+        else if (Supported(LLGL::ShadingLanguage::Metal))
+        {
+            csCull      = LoadShader({ LLGL::ShaderType::Compute,  "Example.metal", "CSCull",      "2.0" });
+            csReduceHiZ = LoadShader({ LLGL::ShaderType::Compute,  "Example.metal", "CSReduceHiZ", "2.0" });
+            vsScene     = LoadShader({ LLGL::ShaderType::Vertex,   "Example.metal", "VS",          "2.0" }, vertexFormats);
+            psScene     = LoadShader({ LLGL::ShaderType::Fragment, "Example.metal", "PS",          "2.0" });
+            psDepth     = LoadShader({ LLGL::ShaderType::Fragment, "Example.metal", "PSDepth",     "2.0" });
+        }
+        else
+            throw std::runtime_error("shaders not available for selected renderer in this example");
+    }
+
+    void CreateComputePipelines()
+    {
+        // Create culling pipeline
+        cullLayout = renderer->CreatePipelineLayout(
+            LLGL::Parse(
+                "cbuffer(Settings@2):comp,"
+                "buffer(instances@3):comp,"
+                "rwbuffer(visibleInstances@4):comp,"
+                "rwbuffer(drawArgs@5):comp,"
+                "rwbuffer(drawCount@6):comp,"
+                "texture(hiZ@7):comp,"
+                "barriers{rwbuffer},"
+            )
+        );
+
+        LLGL::ComputePipelineDescriptor cullPipelineDesc;
+        {
+            cullPipelineDesc.debugName      = "CullPSO";
+            cullPipelineDesc.pipelineLayout = cullLayout;
+            cullPipelineDesc.computeShader  = csCull;
+        }
+        cullPipeline = renderer->CreatePipelineState(cullPipelineDesc);
+        ReportPSOErrors(cullPipeline);
+
+        // Create HiZ reduction pipeline; Each descriptor set reads one MIP level and writes the next one
+        reduceLayout = renderer->CreatePipelineLayout(
+            LLGL::Parse(
+                "heap{"
+                "  texture(inputDepth@0):comp,"
+                "  rwtexture(outputDepth@1):comp,"
+                "},"
+                "barriers{rwtexture},"
+            )
+        );
+
+        std::vector<LLGL::ResourceViewDescriptor> reduceResourceViews;
+        reduceResourceViews.reserve((hiZNumLevels - 1) * 2);
+
+        for_subrange(level, 1, hiZNumLevels)
+        {
+            LLGL::TextureViewDescriptor inputViewDesc;
+            {
+                inputViewDesc.type                      = LLGL::TextureType::Texture2D;
+                inputViewDesc.format                    = LLGL::Format::R32Float;
+                inputViewDesc.subresource.baseMipLevel  = level - 1;
+                inputViewDesc.subresource.numMipLevels  = 1;
+            }
+            LLGL::TextureViewDescriptor outputViewDesc = inputViewDesc;
+            outputViewDesc.subresource.baseMipLevel = level;
+
+            reduceResourceViews.push_back(LLGL::ResourceViewDescriptor{ hiZTexture, inputViewDesc });
+            reduceResourceViews.push_back(LLGL::ResourceViewDescriptor{ hiZTexture, outputViewDesc });
+        }
+
+        LLGL::ResourceHeapDescriptor reduceResourceHeapDesc;
+        {
+            reduceResourceHeapDesc.pipelineLayout   = reduceLayout;
+            reduceResourceHeapDesc.numResourceViews = static_cast<std::uint32_t>(reduceResourceViews.size());
+        }
+        reduceResourceHeap = renderer->CreateResourceHeap(reduceResourceHeapDesc, reduceResourceViews);
+
+        LLGL::ComputePipelineDescriptor reducePipelineDesc;
+        {
+            reducePipelineDesc.debugName        = "ReduceHiZPSO";
+            reducePipelineDesc.pipelineLayout   = reduceLayout;
+            reducePipelineDesc.computeShader    = csReduceHiZ;
+        }
+        reducePipeline = renderer->CreatePipelineState(reducePipelineDesc);
+        ReportPSOErrors(reducePipeline);
+    }
+
+    void CreateGraphicsPipelines()
+    {
+        sceneLayout = renderer->CreatePipelineLayout(LLGL::Parse("cbuffer(Settings@2):vert:frag"));
+
+        // Create graphics pipeline for the scene
+        LLGL::GraphicsPipelineDescriptor pipelineDesc;
+        {
+            pipelineDesc.debugName                      = "ScenePSO";
+            pipelineDesc.pipelineLayout                 = sceneLayout;
+            pipelineDesc.vertexShader                   = vsScene;
+            pipelineDesc.fragmentShader                 = psScene;
+            pipelineDesc.primitiveTopology              = LLGL::PrimitiveTopology::TriangleList;
+            pipelineDesc.indexFormat                    = LLGL::Format::R32UInt;
+            pipelineDesc.depth.testEnabled              = true;
+            pipelineDesc.depth.writeEnabled             = true;
+            pipelineDesc.rasterizer.cullMode            = LLGL::CullMode::Back;
+            pipelineDesc.rasterizer.multiSampleEnabled  = (GetSampleCount() > 1);
+        }
+        scenePipeline = renderer->CreatePipelineState(pipelineDesc);
+        ReportPSOErrors(scenePipeline);
+
+        // Create graphics pipeline for the depth pre-pass into the HiZ texture
+        {
+            pipelineDesc.debugName                      = "DepthPSO";
+            pipelineDesc.renderPass                     = hiZRenderTarget->GetRenderPass();
+            pipelineDesc.fragmentShader                 = psDepth;
+            pipelineDesc.rasterizer.multiSampleEnabled  = false;
+        }
+        depthPipeline = renderer->CreatePipelineState(pipelineDesc);
+        ReportPSOErrors(depthPipeline);
+    }
+
+    void CreateQueries()
+    {
+        if (!IsBenchmarkMode())
+            return;
+
+        // Create one timer query for the culling passes and one for the final draw call
+        LLGL::QueryHeapDescriptor queryDesc;
+        {
+            queryDesc.type          = LLGL::QueryType::TimeElapsed;
+            queryDesc.numQueries    = 2;
+        }
+        timerQueryHeap = renderer->CreateQueryHeap(queryDesc);
+    }
+
+private:
+
+    void UpdateScene()
+    {
+        // Handle user input
+        if (input.KeyDown(LLGL::Key::H))
+            hiZEnabled = !hiZEnabled;
+        if (input.KeyDown(LLGL::Key::C) && hasIndirectCountDrawing)
+            useIndirectCount = !useIndirectCount;
+
+        // Move camera slowly across the field of instances close to the ground to produce plenty of occlusion
+        viewRotation += static_cast<float>(timer.GetDeltaTime()) * 0.05f;
+
+        const float viewDistance = 0.25f * instanceSpacing * std::sqrt(static_cast<float>(numInstances));
+
+        Gs::Matrix4f vMatrix;
+        Gs::RotateFree(vMatrix, { 0, 1, 0 }, viewRotation);
+        Gs::Translate(vMatrix, { 0, 3, -viewDistance });
+        Gs::RotateFree(vMatrix, { 1, 0, 0 }, Gs::Deg2Rad(10.0f));
+
+        const Gs::Matrix4f projMatrix = PerspectiveProjection(GetAspectRatio(), 0.1f, 500.0f, Gs::Deg2Rad(45.0f));
+        settings.vpMatrix = projMatrix * vMatrix.Inverse();
+
+        // The HiZ buffer is only valid once the visible instances of a previous frame have been rendered into it
+        settings.hiZEnabled = (hiZEnabled && hasPrevFrame ? 1 : 0);
+    }
+
+    void DrawVisibleInstances()
+    {
+        commands->SetVertexBufferArray(*vertexBufferArray);
+        commands->SetIndexBuffer(*indexBuffer);
+        commands->SetResource(0, *settingsBuffer);
+
+        if (useIndirectCount)
+        {
+            // One draw command per visible instance; The number of draw commands is taken from the counter
+            commands->DrawIndexedIndirectCount(
+                *drawArgBuffer,
+                0,
+                *drawCountBuffer,
+                offsetof(DrawCount, numInstances),
+                numInstances,
+                sizeof(LLGL::DrawIndexedIndirectArguments)
+            );
+        }
+        else
+        {
+            // Single instanced draw command with the counter as number of instances
+            commands->DrawIndexedIndirect(*drawCountBuffer, 0);
+        }
+    }
+
+    void RenderDepthPrePass()
+    {
+        // Render visible instances of the previous frame as occluders into MIP level 0 of the HiZ texture
+        commands->BeginRenderPass(*hiZRenderTarget);
+        {
+            commands->Clear(LLGL::ClearFlags::ColorDepth, LLGL::ClearValue{ 1.0f, 1.0f, 1.0f, 1.0f, 1.0f });
+            commands->SetViewport(hiZRenderTarget->GetResolution());
+            commands->SetPipelineState(*depthPipeline);
+            DrawVisibleInstances();
+        }
+        commands->EndRenderPass();
+
+        // Reduce HiZ texture into its MIP-chain
+        commands->SetPipelineState(*reducePipeline);
+        for_subrange(level, 1, hiZNumLevels)
+        {
+            const LLGL::Extent3D levelExtent = hiZTexture->GetMipExtent(level);
+            commands->SetResourceHeap(*reduceResourceHeap, level - 1);
+            commands->Dispatch(
+                (levelExtent.width  + reduceGroupSize - 1) / reduceGroupSize,
+                (levelExtent.height + reduceGroupSize - 1) / reduceGroupSize,
+                1
+            );
+        }
+    }
+
+    void CullInstances()
+    {
+        // Reset counter of visible instances
+        DrawCount initialDrawCount;
+        initialDrawCount.numIndices = numIndices;
+        commands->UpdateBuffer(*drawCountBuffer, 0, &initialDrawCount, sizeof(initialDrawCount));
+
+        // Cull all instances against the view frustum and the HiZ texture
+        commands->SetPipelineState(*cullPipeline);
+        commands->SetResource(0, *settingsBuffer);
+        commands->SetResource(1, *instanceBuffer);
+        commands->SetResource(2, *visibleInstanceBuffer);
+        commands->SetResource(3, *drawArgBuffer);
+        commands->SetResource(4, *drawCountBuffer);
+        commands->SetResource(5, *hiZTexture);
+        commands->Dispatch((numInstances + cullGroupSize - 1) / cullGroupSize, 1, 1);
+    }
+
+    void PrintBenchmarkResults()
+    {
+        // Accumulate frame times and print results about once per second
+        printElapsedTime += timer.GetDeltaTime();
+        ++printNumFrames;
+
+        if (printElapsedTime < 1.0)
+            return;
+
+        // Read query results; This waits for the GPU to finish the current frame
+        std::uint64_t elapsedTimes[2] = {};
+        while (!commandQueue->QueryResult(*timerQueryHeap, 0, 2, elapsedTimes, sizeof(elapsedTimes)))
+        {
+            // Wait and return control to other threads
+            std::this_thread::yield();
+        }
+
+        DrawCount drawCount;
+        renderer->ReadBuffer(*drawCountBuffer, 0, &drawCount, sizeof(drawCount));
+
+        LLGL::Log::Printf(
+            "culling: %.3f ms, drawing: %.3f ms, frame: %.3f ms, visible: %u/%u (%s, %s)\n",
+            static_cast<double>(elapsedTimes[0]) / 1000000.0,
+            static_cast<double>(elapsedTimes[1]) / 1000000.0,
+            printElapsedTime * 1000.0 / static_cast<double>(printNumFrames),
+            drawCount.numInstances,
+            numInstances,
+            (useIndirectCount ? "DrawIndexedIndirectCount" : "DrawIndexedIndirect"),
+            (settings.hiZEnabled != 0 ? "HiZ" : "no HiZ")
+        );
+
+        printElapsedTime    = 0.0;
+        printNumFrames      = 0;
+    }
+
+    void OnDrawFrame() override
+    {
+        timer.MeasureTime();
+
+        UpdateScene();
+
+        commands->Begin();
+        {
+            commands->UpdateBuffer(*settingsBuffer, 0, &settings, sizeof(settings));
+
+            // Determine visible instances on the GPU
+            if (timerQueryHeap != nullptr)
+                commands->BeginQuery(*timerQueryHeap, 0);
+            {
+                if (hasPrevFrame && hiZEnabled)
+                    RenderDepthPrePass();
+                CullInstances();
+            }
+            if (timerQueryHeap != nullptr)
+                commands->EndQuery(*timerQueryHeap, 0);
+
+            // Draw visible instances
+            if (timerQueryHeap != nullptr)
+                commands->BeginQuery(*timerQueryHeap, 1);
+            {
+                commands->BeginRenderPass(*swapChain);
+                {
+                    commands->Clear(LLGL::ClearFlags::ColorDepth, backgroundColor);
+                    commands->SetViewport(swapChain->GetResolution());
+                    commands->SetPipelineState(*scenePipeline);
+                    DrawVisibleInstances();
+                }
+                commands->EndRenderPass();
+            }
+            if (timerQueryHeap != nullptr)
+                commands->EndQuery(*timerQueryHeap, 1);
+        }
+        commands->End();
+        commandQueue->Submit(*commands);
+
+        hasPrevFrame = true;
+
+        if (timerQueryHeap != nullptr)
+            PrintBenchmarkResults();
+    }
+
+};
+
+LLGL_IMPLEMENT_EXAMPLE(Example_GPUCulling);
+
+
+
@@ -0,0 +1,195 @@
+// HLSL shader version 5.0 (for Direct3D 11/ 12)
+
+#define CULL_GROUP_SIZE     64
+#define REDUCE_GROUP_SIZE   8
+#define NUM_INDICES         36
+
+cbuffer Settings : register(b2)
+{
+    float4x4    vpMatrix;
+    uint        numInstances;
+    uint        hiZEnabled;
+    uint        hiZNumLevels;
+    uint        depthRangeUnitCube;
+    float2      hiZSize;
+    uint        originLowerLeft;
+    uint        _pad0;
+    float4      lightDir;
+};
+
+
+// CULLING COMPUTE SHADER
+
+Buffer<float4>      instances           : register(t3);
+RWBuffer<float4>    visibleInstances    : register(u4);
+RWBuffer<uint>      drawArgs            : register(u5); // DrawIndexedIndirectArguments[]
+RWBuffer<uint>      drawCount           : register(u6); // DrawIndexedIndirectArguments with numInstances as counter
+Texture2D<float>    hiZ                 : register(t7);
+
+// Returns true if the screen-space bounding box (in NDC) is behind the farthest depth of the HiZ texture within its area
+bool IsOccluded(float3 ndcMin, float3 ndcMax)
+{
+    // Convert NDC bounding box into HiZ texture coordinates
+    float4 rect = saturate(float4(ndcMin.xy, ndcMax.xy) * 0.5 + 0.5);
+    if (originLowerLeft == 0)
+        rect = float4(rect.x, 1.0 - rect.w, rect.z, 1.0 - rect.y);
+
+    // Select MIP level where the bounding box covers at most 2x2 texels
+    float2  size        = (rect.zw - rect.xy) * hiZSize;
+    uint    level       = min((uint)ceil(log2(max(max(size.x, size.y), 1.0))), hiZNumLevels - 1);
+    int2    levelSize   = max(int2(hiZSize) >> level, 1);
+    int2    p0          = min(int2(rect.xy * levelSize), levelSize - 1);
+    int2    p1          = min(int2(rect.zw * levelSize), levelSize - 1);
+
+    float maxDepth = max(
+        max(hiZ.Load(int3(p0.x, p0.y, level)), hiZ.Load(int3(p1.x, p0.y, level))),
+        max(hiZ.Load(int3(p0.x, p1.y, level)), hiZ.Load(int3(p1.x, p1.y, level)))
+    );
+
+    float minDepth = (depthRangeUnitCube != 0 ? ndcMin.z * 0.5 + 0.5 : ndcMin.z);
+    return (minDepth > maxDepth);
+}
+
+bool IsInstanceVisible(float4 instance)
+{
+    float3  ndcMin          = 1.0e+9;
+    float3  ndcMax          = -1.0e+9;
+    uint    outsideMask     = 0x3F;
+    bool    allInFront      = true;
+    float   nearPlane       = (depthRangeUnitCube != 0 ? -1.0 : 0.0);
+
+    // Transform all corners of the bounding box into clip space
+    for (uint i = 0; i < 8; ++i)
+    {
+        float3 corner = float3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+        float4 coord = mul(vpMatrix, float4(instance.xyz + corner * instance.w, 1.0));
+
+        // Accumulate which clipping planes all corners are outside of
+        uint outside = 0;
+        if (coord.x < -coord.w) { outside |= 0x01; }
+        if (coord.x > +coord.w) { outside |= 0x02; }
+        if (coord.y < -coord.w) { outside |= 0x04; }
+        if (coord.y > +coord.w) { outside |= 0x08; }
+        if (coord.z < nearPlane * coord.w) { outside |= 0x10; }
+        if (coord.z > +coord.w) { outside |= 0x20; }
+        outsideMask &= outside;
+
+        if (coord.w > 0.0)
+        {
+            float3 ndc = coord.xyz / coord.w;
+            ndcMin = min(ndcMin, ndc);
+            ndcMax = max(ndcMax, ndc);
+        }
+        else
+            allInFront = false;
+    }
+
+    // Frustum culling
+    if (outsideMask != 0)
+        return false;
+
+    // Occlusion culling; Bounding boxes that intersect the near plane are always visible
+    if (hiZEnabled != 0 && allInFront)
+        return !IsOccluded(ndcMin, ndcMax);
+
+    return true;
+}
+
+[numthreads(CULL_GROUP_SIZE, 1, 1)]
+void CSCull(uint3 threadID : SV_DispatchThreadID)
+{
+    uint idx = threadID.x;
+    if (idx >= numInstances)
+        return;
+
+    float4 instance = instances[idx];
+    if (!IsInstanceVisible(instance))
+        return;
+
+    // Append instance and one draw command for it
+    uint slot;
+    InterlockedAdd(drawCount[1], 1, slot);
+
+    visibleInstances[slot] = instance;
+
+    uint args = slot * 5;
+    drawArgs[args    ] = NUM_INDICES;   // numIndices
+    drawArgs[args + 1] = 1;             // numInstances
+    drawArgs[args + 2] = 0;             // firstIndex
+    drawArgs[args + 3] = 0;             // vertexOffset
+    drawArgs[args + 4] = slot;          // firstInstance
+}
+
+
+// HIZ REDUCTION COMPUTE SHADER
+
+Texture2D<float>    inputDepth  : register(t0);
+RWTexture2D<float>  outputDepth : register(u1);
+
+[numthreads(REDUCE_GROUP_SIZE, REDUCE_GROUP_SIZE, 1)]
+void CSReduceHiZ(uint3 threadID : SV_DispatchThreadID)
+{
+    uint2 outputSize, inputSize;
+    outputDepth.GetDimensions(outputSize.x, outputSize.y);
+    inputDepth.GetDimensions(inputSize.x, inputSize.y);
+
+    if (threadID.x >= outputSize.x || threadID.y >= outputSize.y)
+        return;
+
+    // Store farthest depth of 2x2 texels from the previous MIP level
+    int2 p0 = int2(threadID.xy * 2);
+    int2 p1 = min(p0 + 1, int2(inputSize) - 1);
+
+    outputDepth[threadID.xy] = max(
+        max(inputDepth.Load(int3(p0.x, p0.y, 0)), inputDepth.Load(int3(p1.x, p0.y, 0))),
+        max(inputDepth.Load(int3(p0.x, p1.y, 0)), inputDepth.Load(int3(p1.x, p1.y, 0)))
+    );
+}
+
+
+// VERTEX SHADER
+
+struct InputVS
+{
+    float3 position : POSITION;
+    float3 normal   : NORMAL;
+    float2 texCoord : TEXCOORD;
+    float4 instance : INSTANCE;
+};
+
+struct OutputVS
+{
+    float4 position : SV_Position;
+    float3 normal   : NORMAL;
+    float3 color    : COLOR;
+};
+
+OutputVS VS(InputVS inp)
+{
+    OutputVS outp;
+
+    float3 worldPos = inp.instance.xyz + inp.position * inp.instance.w;
+    outp.position   = mul(vpMatrix, float4(worldPos, 1.0));
+    outp.normal     = inp.normal;
+
+    // Generate color from instance position
+    float hue = frac(sin(dot(inp.instance.xz, float2(12.9898, 78.233))) * 43758.5453);
+    outp.color = cos((hue + float3(0.0, 0.33, 0.67)) * 6.283185) * 0.4 + 0.6;
+
+    return outp;
+}
+
+
+// PIXEL SHADERS
+
+float4 PS(OutputVS inp) : SV_Target
+{
+    float NdotL = saturate(dot(normalize(inp.normal), -lightDir.xyz));
+    return float4(inp.color * lerp(0.3, 1.0, NdotL), 1.0);
+}
+
+float PSDepth(OutputVS inp) : SV_Target
+{
+    return inp.position.z;
+}
+
@@ -0,0 +1,220 @@
+#include <metal_stdlib>
+#include <simd/simd.h>
+
+using namespace metal;
+
+// The compute kernels run with the default threadgroup size of 1, so each thread processes a group of elements
+#define CULL_GROUP_SIZE     64
+#define REDUCE_GROUP_SIZE   8
+#define NUM_INDICES         36
+
+struct Settings
+{
+    float4x4    vpMatrix;
+    uint        numInstances;
+    uint        hiZEnabled;
+    uint        hiZNumLevels;
+    uint        depthRangeUnitCube;
+    float2      hiZSize;
+    uint        originLowerLeft;
+    uint        _pad0;
+    float4      lightDir;
+};
+
+struct DrawIndexedIndirectArguments
+{
+    uint    numIndices;
+    uint    numInstances;
+    uint    firstIndex;
+    int     vertexOffset;
+    uint    firstInstance;
+};
+
+
+/*
+ * Culling compute shader
+ */
+
+// Returns true if the screen-space bounding box (in NDC) is behind the farthest depth of the HiZ texture within its area
+bool IsOccluded(float3 ndcMin, float3 ndcMax, constant Settings& settings, texture2d<float> hiZ)
+{
+    // Convert NDC bounding box into HiZ texture coordinates
+    float4 rect = saturate(float4(ndcMin.xy, ndcMax.xy) * 0.5 + 0.5);
+    if (settings.originLowerLeft == 0)
+        rect = float4(rect.x, 1.0 - rect.w, rect.z, 1.0 - rect.y);
+
+    // Select MIP level where the bounding box covers at most 2x2 texels
+    float2  size        = (rect.zw - rect.xy) * settings.hiZSize;
+    uint    level       = min((uint)ceil(log2(max(max(size.x, size.y), 1.0))), settings.hiZNumLevels - 1);
+    uint2   levelSize   = max(uint2(settings.hiZSize) >> level, uint2(1));
+    uint2   p0          = min(uint2(rect.xy * float2(levelSize)), levelSize - 1);
+    uint2   p1          = min(uint2(rect.zw * float2(levelSize)), levelSize - 1);
+
+    float maxDepth = max(
+        max(hiZ.read(uint2(p0.x, p0.y), level).r, hiZ.read(uint2(p1.x, p0.y), level).r),
+        max(hiZ.read(uint2(p0.x, p1.y), level).r, hiZ.read(uint2(p1.x, p1.y), level).r)
+    );
+
+    float minDepth = (settings.depthRangeUnitCube != 0 ? ndcMin.z * 0.5 + 0.5 : ndcMin.z);
+    return (minDepth > maxDepth);
+}
+
+bool IsInstanceVisible(float4 instance, constant Settings& settings, texture2d<float> hiZ)
+{
+    float3  ndcMin          = float3(1.0e+9);
+    float3  ndcMax          = float3(-1.0e+9);
+    uint    outsideMask     = 0x3F;
+    bool    allInFront      = true;
+    float   nearPlane       = (settings.depthRangeUnitCube != 0 ? -1.0 : 0.0);
+
+    // Transform all corners of the bounding box into clip space
+    for (uint i = 0; i < 8; ++i)
+    {
+        float3 corner = float3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);
+        float4 coord = settings.vpMatrix * float4(instance.xyz + corner * instance.w, 1.0);
+
+        // Accumulate which clipping planes all corners are outside of
+        uint outside = 0;
+        if (coord.x < -coord.w) { outside |= 0x01; }
+        if (coord.x > +coord.w) { outside |= 0x02; }
+        if (coord.y < -coord.w) { outside |= 0x04; }
+        if (coord.y > +coord.w) { outside |= 0x08; }
+        if (coord.z < nearPlane * coord.w) { outside |= 0x10; }
+        if (coord.z > +coord.w) { outside |= 0x20; }
+        outsideMask &= outside;
+
+        if (coord.w > 0.0)
+        {
+            float3 ndc = coord.xyz / coord.w;
+            ndcMin = min(ndcMin, ndc);
+            ndcMax = max(ndcMax, ndc);
+        }
+        else
+            allInFront = false;
+    }
+
+    // Frustum culling
+    if (outsideMask != 0)
+        return false;
+
+    // Occlusion culling; Bounding boxes that intersect the near plane are always visible
+    if (settings.hiZEnabled != 0 && allInFront)
+        return !IsOccluded(ndcMin, ndcMax, settings, hiZ);
+
+    return true;
+}
+
+kernel void CSCull(
+    constant Settings&                      settings            [[buffer(2)]],
+    device const float4*                    instances           [[buffer(3)]],
+    device float4*                          visibleInstances    [[buffer(4)]],
+    device DrawIndexedIndirectArguments*    drawArgs            [[buffer(5)]],
+    device atomic_uint*                     drawCount           [[buffer(6)]],
+    texture2d<float>                        hiZ                 [[texture(7)]],
+    uint                                    groupID             [[thread_position_in_grid]])
+{
+    for (uint idx = groupID * CULL_GROUP_SIZE; idx < min((groupID + 1) * CULL_GROUP_SIZE, settings.numInstances); ++idx)
+    {
+        float4 instance = instances[idx];
+        if (!IsInstanceVisible(instance, settings, hiZ))
+            continue;
+
+        // Append instance and one draw command for it; The counter is DrawIndexedIndirectArguments::numInstances
+        uint slot = atomic_fetch_add_explicit(&drawCount[1], 1, memory_order_relaxed);
+
+        visibleInstances[slot] = instance;
+
+        drawArgs[slot].numIndices       = NUM_INDICES;
+        drawArgs[slot].numInstances     = 1;
+        drawArgs[slot].firstIndex       = 0;
+        drawArgs[slot].vertexOffset     = 0;
+        drawArgs[slot].firstInstance    = slot;
+    }
+}
+
+
+/*
+ * HiZ reduction compute shader
+ */
+
+kernel void CSReduceHiZ(
+    texture2d<float>                        inputDepth          [[texture(0)]],
+    texture2d<float, access::write>         outputDepth         [[texture(1)]],
+    uint2                                   groupID             [[thread_position_in_grid]])
+{
+    uint2 outputSize    = uint2(outputDepth.get_width(), outputDepth.get_height());
+    uint2 inputSize     = uint2(inputDepth.get_width(), inputDepth.get_height());
+
+    for (uint y = groupID.y * REDUCE_GROUP_SIZE; y < min((groupID.y + 1) * REDUCE_GROUP_SIZE, outputSize.y); ++y)
+    {
+        for (uint x = groupID.x * REDUCE_GROUP_SIZE; x < min((groupID.x + 1) * REDUCE_GROUP_SIZE, outputSize.x); ++x)
+        {
+            // Store farthest depth of 2x2 texels from the previous MIP level
+            uint2 p0 = uint2(x, y) * 2;
+            uint2 p1 = min(p0 + 1, inputSize - 1);
+
+            float depth = max(
+                max(inputDepth.read(uint2(p0.x, p0.y)).r, inputDepth.read(uint2(p1.x, p0.y)).r),
+                max(inputDepth.read(uint2(p0.x, p1.y)).r, inputDepth.read(uint2(p1.x, p1.y)).r)
+            );
+
+            outputDepth.write(float4(depth), uint2(x, y));
+        }
+    }
+}
+
+
+/*
+ * Vertex shader
+ */
+
+struct VertexIn
+{
+    float3 position [[attribute(0)]];
+    float3 normal   [[attribute(1)]];
+    float2 texCoord [[attribute(2)]];
+    float4 instance [[attribute(3)]];
+};
+
+struct VertexOut
+{
+    float4 position [[position]];
+    float3 normal;
+    float3 color;
+};
+
+vertex VertexOut VS(
+    VertexIn            inp         [[stage_in]],
+    constant Settings&  settings    [[buffer(2)]])
+{
+    VertexOut outp;
+
+    float3 worldPos = inp.instance.xyz + inp.position * inp.instance.w;
+    outp.position   = settings.vpMatrix * float4(worldPos, 1.0);
+    outp.normal     = inp.normal;
+
+    // Generate color from instance position
+    float hue = fract(sin(dot(inp.instance.xz, float2(12.9898, 78.233))) * 43758.5453);
+    outp.color = cos((hue + float3(0.0, 0.33, 0.67)) * 6.283185) * 0.4 + 0.6;
+
+    return outp;
+}
+
+
+/*
+ * Fragment shaders
+ */
+
+fragment float4 PS(
+    VertexOut           inp         [[stage_in]],
+    constant Settings&  settings    [[buffer(2)]])
+{
+    float NdotL = saturate(dot(normalize(inp.normal), -settings.lightDir.xyz));
+    return float4(inp.color * mix(0.3, 1.0, NdotL), 1.0);
+}
+
+fragment float PSDepth(VertexOut inp [[stage_in]])
+{
+    return inp.position.z;
+}
+
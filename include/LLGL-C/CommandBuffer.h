@@ -19,14 +19,20 @@ LLGL_C_EXPORT void llglBegin(LLGLCommandBuffer commandBuffer);
 LLGL_C_EXPORT void llglEnd();
 LLGL_C_EXPORT void llglExecute(LLGLCommandBuffer secondaryCommandBuffer);
 LLGL_C_EXPORT void llglUpdateBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, const void* data, uint16_t dataSize);
+LLGL_C_EXPORT void llglAllocTransientBuffer(uint64_t size, long bindFlags, uint64_t alignment, LLGLTransientBufferAllocation* outAllocation);
 LLGL_C_EXPORT void llglCopyBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLBuffer srcBuffer, uint64_t srcOffset, uint64_t size);
+LLGL_C_EXPORT void llglCopyBufferRegions(LLGLBuffer dstBuffer, LLGLBuffer srcBuffer, uint32_t numRegions, const LLGLBufferCopyRegion* regions LLGL_ANNOTATE([numRegions]));
 LLGL_C_EXPORT void llglCopyBufferFromTexture(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLTexture srcTexture, const LLGLTextureRegion* srcRegion, uint32_t rowStride, uint32_t layerStride);
 LLGL_C_EXPORT void llglFillBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, uint32_t value, uint64_t fillSize);
 LLGL_C_EXPORT void llglCopyTexture(LLGLTexture dstTexture, const LLGLTextureLocation* dstLocation, LLGLTexture srcTexture, const LLGLTextureLocation* srcLocation, const LLGLExtent3D* extent);
+LLGL_C_EXPORT void llglCopyTextureRegions(LLGLTexture dstTexture, LLGLTexture srcTexture, uint32_t numRegions, const LLGLTextureCopyRegion* regions LLGL_ANNOTATE([numRegions]));
 LLGL_C_EXPORT void llglCopyTextureFromBuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, LLGLBuffer srcBuffer, uint64_t srcOffset, uint32_t rowStride, uint32_t layerStride);
 LLGL_C_EXPORT void llglCopyTextureFromFramebuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, const LLGLOffset2D* srcOffset);
 LLGL_C_EXPORT void llglGenerateMips(LLGLTexture texture);
 LLGL_C_EXPORT void llglGenerateMipsRange(LLGLTexture texture, const LLGLTextureSubresource* subresource);
+LLGL_C_EXPORT void llglGenerateMipsBatch(uint32_t numTextures, const LLGLTexture* textures LLGL_ANNOTATE([numTextures]));
+LLGL_C_EXPORT void llglResolveSamplerFeedback(LLGLTexture feedbackTexture, uint32_t mipLevel, uint32_t arrayLayer, LLGLBuffer dstBuffer, uint64_t dstOffset);
+LLGL_C_EXPORT void llglClearSamplerFeedback(LLGLTexture feedbackTexture);
 LLGL_C_EXPORT void llglSetViewport(const LLGLViewport* viewport);
 LLGL_C_EXPORT void llglSetViewports(uint32_t numViewports, const LLGLViewport* viewports LLGL_ANNOTATE([numViewports]));
 LLGL_C_EXPORT void llglSetScissor(const LLGLScissor* scissor);
@@ -37,7 +43,9 @@ LLGL_C_EXPORT void llglSetIndexBuffer(LLGLBuffer buffer);
 LLGL_C_EXPORT void llglSetIndexBufferExt(LLGLBuffer buffer, LLGLFormat format, uint64_t offset);
 LLGL_C_EXPORT void llglSetResourceHeap(LLGLResourceHeap resourceHeap, uint32_t descriptorSet);
 LLGL_C_EXPORT void llglSetResource(uint32_t descriptor, LLGLResource resource);
+LLGL_C_EXPORT void llglSetConstantBufferRange(uint32_t descriptor, LLGLBuffer buffer, uint64_t offset, uint64_t size);
 LLGL_C_EXPORT void llglResourceBarrier(uint32_t numBuffers, const LLGLBuffer* buffers, uint32_t numTextures, const LLGLTexture* textures);
+LLGL_C_EXPORT void llglAliasingBarrier(LLGLTexture textureBefore LLGL_ANNOTATE(NULL), LLGLTexture textureAfter LLGL_ANNOTATE(NULL));
 //LLGL_DEPRECATED("llglResetResourceSlots is deprecated since 0.04b; No need to reset resource slots manually anymore!")
 LLGL_C_EXPORT void llglResetResourceSlots(LLGLResourceType resourceType, uint32_t firstSlot, uint32_t numSlots, long bindFlags, long stageFlags);
 LLGL_C_EXPORT void llglBeginRenderPass(LLGLRenderTarget renderTarget);
@@ -48,9 +56,11 @@ LLGL_C_EXPORT void llglClearAttachments(uint32_t numAttachments, const LLGLAttac
 LLGL_C_EXPORT void llglSetPipelineState(LLGLPipelineState pipelineState);
 LLGL_C_EXPORT void llglSetBlendFactor(const float color[4]);
 LLGL_C_EXPORT void llglSetStencilReference(uint32_t reference, LLGLStencilFace stencilFace);
+LLGL_C_EXPORT void llglSetShadingRate(LLGLShadingRate rate);
 LLGL_C_EXPORT void llglSetUniforms(uint32_t first, const void* data, uint16_t dataSize);
 LLGL_C_EXPORT void llglBeginQuery(LLGLQueryHeap queryHeap, uint32_t query);
 LLGL_C_EXPORT void llglEndQuery(LLGLQueryHeap queryHeap, uint32_t query);
+LLGL_C_EXPORT void llglResolveQueryData(LLGLQueryHeap srcQueryHeap, uint32_t firstQuery, uint32_t numQueries, LLGLBuffer dstBuffer, uint64_t dstOffset);
 LLGL_C_EXPORT void llglBeginRenderCondition(LLGLQueryHeap queryHeap, uint32_t query, LLGLRenderConditionMode mode);
 LLGL_C_EXPORT void llglEndRenderCondition();
 LLGL_C_EXPORT void llglBeginStreamOutput(uint32_t numBuffers, LLGLBuffer const * buffers LLGL_ANNOTATE([numBuffers]));
@@ -66,9 +76,19 @@ LLGL_C_EXPORT void llglDrawIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDrawIndexedIndirect(LLGLBuffer buffer, uint64_t offset);
 LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride);
 LLGL_C_EXPORT void llglDrawStreamOutput();
+LLGL_C_EXPORT void llglDrawMeshTasks(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ);
+LLGL_C_EXPORT void llglDrawMeshTasksIndirect(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride);
+LLGL_C_EXPORT void llglDispatchTiles();
+LLGL_C_EXPORT void llglExecuteIndirect(const LLGLIndirectCommandDescriptor* commandDesc, LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands);
+LLGL_C_EXPORT void llglDrawPacked(const LLGLDrawPackedDescriptor* drawDesc);
+LLGL_C_EXPORT void llglExecuteCommandBatch(const LLGLCommandBatchDescriptor* batchDesc);
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ);
 LLGL_C_EXPORT void llglDispatchIndirect(LLGLBuffer buffer, uint64_t offset);
+LLGL_C_EXPORT void llglBuildAccelerationStructure(LLGLBuffer dstBuffer, LLGLBuffer scratchBuffer, const LLGLAccelerationStructureDescriptor* desc, LLGLBuffer srcBuffer);
+LLGL_C_EXPORT void llglDispatchRays(uint32_t width, uint32_t height, uint32_t depth);
 LLGL_C_EXPORT void llglPushDebugGroup(const char* name);
 LLGL_C_EXPORT void llglPopDebugGroup();
 LLGL_C_EXPORT void llglDoNativeCommand(const void* nativeCommand, size_t nativeCommandSize);
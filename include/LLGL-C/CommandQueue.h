@@ -10,7 +10,7 @@
 
 
 #include <LLGL-C/Export.h>
-#include <LLGL-C/Types.h>
+#include <LLGL-C/LLGLWrapper.h>
 #include <stdint.h>
 #include <stddef.h>
 #include <stdbool.h>
@@ -21,6 +21,7 @@ LLGL_C_EXPORT bool llglQueryResult(LLGLQueryHeap queryHeap, uint32_t firstQuery,
 LLGL_C_EXPORT void llglSubmitFence(LLGLFence fence);
 LLGL_C_EXPORT bool llglWaitFence(LLGLFence fence, uint64_t timeout);
 LLGL_C_EXPORT void llglWaitIdle();
+LLGL_C_EXPORT void llglUpdateTileMappings(uint32_t numMappings, const LLGLTileMappingDescriptor* mappings LLGL_ANNOTATE([numMappings]));
 
 
 #endif
@@ -30,6 +30,7 @@
 #include <LLGL-C/PipelineLayout.h>
 #include <LLGL-C/PipelineCache.h>
 #include <LLGL-C/PipelineState.h>
+#include <LLGL-C/PlacementHeap.h>
 #include <LLGL-C/RenderTarget.h>
 #include <LLGL-C/QueryHeap.h>
 #include <LLGL-C/Log.h>
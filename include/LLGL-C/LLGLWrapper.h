@@ -43,6 +43,13 @@
 
 /* ----- Enumerations ----- */
 
+typedef enum LLGLAccelerationStructureType
+{
+    LLGLAccelerationStructureTypeBottomLevel,
+    LLGLAccelerationStructureTypeTopLevel,
+}
+LLGLAccelerationStructureType;
+
 typedef enum LLGLEventAction
 {
     LLGLEventActionBegan,
@@ -72,6 +79,50 @@ typedef enum LLGLStencilFace
 }
 LLGLStencilFace;
 
+typedef enum LLGLShadingRate
+{
+    LLGLShadingRateRate1x1,
+    LLGLShadingRateRate1x2,
+    LLGLShadingRateRate2x1,
+    LLGLShadingRateRate2x2,
+    LLGLShadingRateRate2x4,
+    LLGLShadingRateRate4x2,
+    LLGLShadingRateRate4x4,
+}
+LLGLShadingRate;
+
+typedef enum LLGLCommandQueueType
+{
+    LLGLCommandQueueTypeGraphics,
+    LLGLCommandQueueTypeCompute,
+    LLGLCommandQueueTypeCopy,
+}
+LLGLCommandQueueType;
+
+typedef enum LLGLIndirectArgumentType
+{
+    LLGLIndirectArgumentTypeDraw,
+    LLGLIndirectArgumentTypeDrawIndexed,
+    LLGLIndirectArgumentTypeDrawMeshTasks,
+    LLGLIndirectArgumentTypeDispatch,
+    LLGLIndirectArgumentTypeUniforms,
+}
+LLGLIndirectArgumentType;
+
+typedef enum LLGLCommandOpcode
+{
+    LLGLCommandOpcodeSetPipelineState,
+    LLGLCommandOpcodeSetVertexBuffer,
+    LLGLCommandOpcodeSetIndexBuffer,
+    LLGLCommandOpcodeSetResourceHeap,
+    LLGLCommandOpcodeSetResource,
+    LLGLCommandOpcodeSetUniforms,
+    LLGLCommandOpcodeDraw,
+    LLGLCommandOpcodeDrawIndexed,
+    LLGLCommandOpcodeDispatch,
+}
+LLGLCommandOpcode;
+
 typedef enum LLGLFormat
 {
     LLGLFormatUndefined,
@@ -153,6 +204,10 @@ typedef enum LLGLFormat
     LLGLFormatBC4SNorm,
     LLGLFormatBC5UNorm,
     LLGLFormatBC5SNorm,
+    LLGLFormatBC6HUFloat,
+    LLGLFormatBC6HSFloat,
+    LLGLFormatBC7UNorm,
+    LLGLFormatBC7UNorm_sRGB,
     LLGLFormatASTC4x4,
     LLGLFormatASTC4x4_sRGB,
     LLGLFormatASTC5x4,
@@ -184,6 +239,28 @@ typedef enum LLGLFormat
     LLGLFormatETC1UNorm,
     LLGLFormatETC2UNorm,
     LLGLFormatETC2UNorm_sRGB,
+    LLGLFormatETC2A1UNorm,
+    LLGLFormatETC2A1UNorm_sRGB,
+    LLGLFormatETC2A8UNorm,
+    LLGLFormatETC2A8UNorm_sRGB,
+    LLGLFormatEACR11UNorm,
+    LLGLFormatEACR11SNorm,
+    LLGLFormatEACRG11UNorm,
+    LLGLFormatEACRG11SNorm,
+    LLGLFormatASTC4x4Float,
+    LLGLFormatASTC5x4Float,
+    LLGLFormatASTC5x5Float,
+    LLGLFormatASTC6x5Float,
+    LLGLFormatASTC6x6Float,
+    LLGLFormatASTC8x5Float,
+    LLGLFormatASTC8x6Float,
+    LLGLFormatASTC8x8Float,
+    LLGLFormatASTC10x5Float,
+    LLGLFormatASTC10x6Float,
+    LLGLFormatASTC10x8Float,
+    LLGLFormatASTC10x10Float,
+    LLGLFormatASTC12x10Float,
+    LLGLFormatASTC12x12Float,
 }
 LLGLFormat;
 
@@ -225,6 +302,31 @@ typedef enum LLGLDataType
 }
 LLGLDataType;
 
+typedef enum LLGLImageCompressionQuality
+{
+    LLGLImageCompressionQualityFast,
+    LLGLImageCompressionQualityDefault,
+    LLGLImageCompressionQualityHigh,
+}
+LLGLImageCompressionQuality;
+
+typedef enum LLGLImageMipMapFilter
+{
+    LLGLImageMipMapFilterBox,
+    LLGLImageMipMapFilterKaiser,
+}
+LLGLImageMipMapFilter;
+
+typedef enum LLGLImageResampleFilter
+{
+    LLGLImageResampleFilterBox,
+    LLGLImageResampleFilterBilinear,
+    LLGLImageResampleFilterMitchell,
+    LLGLImageResampleFilterLanczos3,
+    LLGLImageResampleFilterKaiser,
+}
+LLGLImageResampleFilter;
+
 typedef enum LLGLReportType
 {
     LLGLReportTypeDefault = 0,
@@ -598,6 +700,7 @@ typedef enum LLGLQueryType
     LLGLQueryTypeStreamOutPrimitivesWritten,
     LLGLQueryTypeStreamOutOverflow,
     LLGLQueryTypePipelineStatistics,
+    LLGLQueryTypeTimestamp,
 }
 LLGLQueryType;
 
@@ -619,6 +722,15 @@ typedef enum LLGLWarningType
 }
 LLGLWarningType;
 
+typedef enum LLGLProfileEventType
+{
+    LLGLProfileEventTypeEncoding,
+    LLGLProfileEventTypeSubmission,
+    LLGLProfileEventTypeWait,
+    LLGLProfileEventTypePresent,
+}
+LLGLProfileEventType;
+
 typedef enum LLGLAttachmentLoadOp
 {
     LLGLAttachmentLoadOpUndefined,
@@ -685,6 +797,7 @@ typedef enum LLGLShadingLanguage
     LLGLShadingLanguageMetal_3_0      = (0x40000|300),
     LLGLShadingLanguageSPIRV          = (0x50000),
     LLGLShadingLanguageSPIRV_100      = (0x50000|100),
+    LLGLShadingLanguageWGSL           = (0x60000),
     LLGLShadingLanguageVersionBitmask = 0x0000ffff,
 }
 LLGLShadingLanguage;
@@ -712,6 +825,13 @@ typedef enum LLGLCPUAccess
 }
 LLGLCPUAccess;
 
+typedef enum LLGLFileCompression
+{
+    LLGLFileCompressionUncompressed,
+    LLGLFileCompressionGDeflate,
+}
+LLGLFileCompression;
+
 typedef enum LLGLResourceType
 {
     LLGLResourceTypeUndefined,
@@ -721,6 +841,15 @@ typedef enum LLGLResourceType
 }
 LLGLResourceType;
 
+typedef enum LLGLSharedHandleType
+{
+    LLGLSharedHandleTypeUndefined,
+    LLGLSharedHandleTypeOpaqueFD,
+    LLGLSharedHandleTypeOpaqueWin32,
+    LLGLSharedHandleTypeIOSurface,
+}
+LLGLSharedHandleType;
+
 typedef enum LLGLSamplerAddressMode
 {
     LLGLSamplerAddressModeRepeat,
@@ -747,6 +876,13 @@ typedef enum LLGLShaderType
     LLGLShaderTypeGeometry,
     LLGLShaderTypeFragment,
     LLGLShaderTypeCompute,
+    LLGLShaderTypeTask,
+    LLGLShaderTypeMesh,
+    LLGLShaderTypeTile,
+    LLGLShaderTypeRayGeneration,
+    LLGLShaderTypeMiss,
+    LLGLShaderTypeClosestHit,
+    LLGLShaderTypeAnyHit,
 }
 LLGLShaderType;
 
@@ -773,6 +909,33 @@ typedef enum LLGLStorageBufferType
 }
 LLGLStorageBufferType;
 
+typedef enum LLGLPresentMode
+{
+    LLGLPresentModeDefault,
+    LLGLPresentModeFifo,
+    LLGLPresentModeFifoRelaxed,
+    LLGLPresentModeMailbox,
+    LLGLPresentModeImmediate,
+}
+LLGLPresentMode;
+
+typedef enum LLGLSurfaceTransform
+{
+    LLGLSurfaceTransformIdentity,
+    LLGLSurfaceTransformRotate90,
+    LLGLSurfaceTransformRotate180,
+    LLGLSurfaceTransformRotate270,
+}
+LLGLSurfaceTransform;
+
+typedef enum LLGLColorSpace
+{
+    LLGLColorSpaceSRGB,
+    LLGLColorSpaceHDR10,
+    LLGLColorSpaceScRGB,
+}
+LLGLColorSpace;
+
 typedef enum LLGLSystemValue
 {
     LLGLSystemValueUndefined,
@@ -820,9 +983,24 @@ typedef enum LLGLTextureSwizzle
 }
 LLGLTextureSwizzle;
 
+typedef enum LLGLSamplerFeedbackType
+{
+    LLGLSamplerFeedbackTypeMinMip,
+    LLGLSamplerFeedbackTypeMipRegionUsed,
+}
+LLGLSamplerFeedbackType;
+
 
 /* ----- Flags ----- */
 
+typedef enum LLGLAccelerationStructureFlags
+{
+    LLGLAccelerationStructureAllowUpdate     = (1 << 0),
+    LLGLAccelerationStructurePreferFastTrace = (1 << 1),
+    LLGLAccelerationStructurePreferFastBuild = (1 << 2),
+}
+LLGLAccelerationStructureFlags;
+
 typedef enum LLGLCanvasFlags
 {
     LLGLCanvasBorderless = (1 << 0),
@@ -831,9 +1009,10 @@ LLGLCanvasFlags;
 
 typedef enum LLGLCommandBufferFlags
 {
-    LLGLCommandBufferSecondary       = (1 << 0),
-    LLGLCommandBufferMultiSubmit     = (1 << 1),
-    LLGLCommandBufferImmediateSubmit = (1 << 2),
+    LLGLCommandBufferSecondary        = (1 << 0),
+    LLGLCommandBufferMultiSubmit      = (1 << 1),
+    LLGLCommandBufferImmediateSubmit  = (1 << 2),
+    LLGLCommandBufferBakeDrawCommands = (1 << 3),
 }
 LLGLCommandBufferFlags;
 
@@ -912,6 +1091,13 @@ typedef enum LLGLBarrierFlags
 }
 LLGLBarrierFlags;
 
+typedef enum LLGLPipelineLayoutFlags
+{
+    LLGLPipelineLayoutBindlessHeap    = (1 << 0),
+    LLGLPipelineLayoutRootDescriptors = (1 << 1),
+}
+LLGLPipelineLayoutFlags;
+
 typedef enum LLGLColorMaskFlags
 {
     LLGLColorMaskZero = 0,
@@ -923,6 +1109,22 @@ typedef enum LLGLColorMaskFlags
 }
 LLGLColorMaskFlags;
 
+typedef enum LLGLPipelineStateFlags
+{
+    LLGLPipelineStateAsyncCompilation = (1 << 0),
+}
+LLGLPipelineStateFlags;
+
+typedef enum LLGLValidationFlags
+{
+    LLGLValidationAPIUsage         = (1 << 0),
+    LLGLValidationResourceBindings = (1 << 1),
+    LLGLValidationDrawRanges       = (1 << 2),
+    LLGLValidationBarriers         = (1 << 3),
+    LLGLValidationAll              = (LLGLValidationAPIUsage | LLGLValidationResourceBindings | LLGLValidationDrawRanges | LLGLValidationBarriers),
+}
+LLGLValidationFlags;
+
 typedef enum LLGLRenderSystemFlags
 {
     LLGLRenderSystemDebugDevice       = (1 << 0),
@@ -931,9 +1133,30 @@ typedef enum LLGLRenderSystemFlags
     LLGLRenderSystemPreferIntel       = (1 << 3),
     LLGLRenderSystemSoftwareDevice    = (1 << 4),
     LLGLRenderSystemDebugBreakOnError = (1 << 5),
+    LLGLRenderSystemHeadless          = (1 << 6),
+    LLGLRenderSystemSubmissionThread  = (1 << 7),
 }
 LLGLRenderSystemFlags;
 
+typedef enum LLGLMemoryHeapFlags
+{
+    LLGLMemoryHeapDeviceLocal = (1 << 0),
+}
+LLGLMemoryHeapFlags;
+
+typedef enum LLGLSubgroupOperationFlags
+{
+    LLGLSubgroupOperationBasic           = (1 << 0),
+    LLGLSubgroupOperationVote            = (1 << 1),
+    LLGLSubgroupOperationArithmetic      = (1 << 2),
+    LLGLSubgroupOperationBallot          = (1 << 3),
+    LLGLSubgroupOperationShuffle         = (1 << 4),
+    LLGLSubgroupOperationShuffleRelative = (1 << 5),
+    LLGLSubgroupOperationClustered       = (1 << 6),
+    LLGLSubgroupOperationQuad            = (1 << 7),
+}
+LLGLSubgroupOperationFlags;
+
 typedef enum LLGLBindFlags
 {
     LLGLBindVertexBuffer           = (1 << 0),
@@ -948,6 +1171,9 @@ typedef enum LLGLBindFlags
     LLGLBindCombinedSampler        = (1 << 9),
     LLGLBindCopySrc                = (1 << 10),
     LLGLBindCopyDst                = (1 << 11),
+    LLGLBindShadingRateAttachment  = (1 << 12),
+    LLGLBindAccelerationStructure  = (1 << 13),
+    LLGLBindComputeStreamOutput    = (1 << 14),
 }
 LLGLBindFlags;
 
@@ -960,15 +1186,27 @@ LLGLCPUAccessFlags;
 
 typedef enum LLGLMiscFlags
 {
-    LLGLMiscDynamicUsage  = (1 << 0),
-    LLGLMiscFixedSamples  = (1 << 1),
-    LLGLMiscGenerateMips  = (1 << 2),
-    LLGLMiscNoInitialData = (1 << 3),
-    LLGLMiscAppend        = (1 << 4),
-    LLGLMiscCounter       = (1 << 5),
+    LLGLMiscDynamicUsage      = (1 << 0),
+    LLGLMiscFixedSamples      = (1 << 1),
+    LLGLMiscGenerateMips      = (1 << 2),
+    LLGLMiscNoInitialData     = (1 << 3),
+    LLGLMiscAppend            = (1 << 4),
+    LLGLMiscCounter           = (1 << 5),
+    LLGLMiscPersistentMapping = (1 << 6),
+    LLGLMiscSparse            = (1 << 7),
+    LLGLMiscUntracked         = (1 << 8),
+    LLGLMiscTransient         = (1 << 9),
+    LLGLMiscShared            = (1 << 10),
+    LLGLMiscGPUConversion     = (1 << 11),
 }
 LLGLMiscFlags;
 
+typedef enum LLGLResourceHeapFlags
+{
+    LLGLResourceHeapDynamic = (1 << 0),
+}
+LLGLResourceHeapFlags;
+
 typedef enum LLGLShaderCompileFlags
 {
     LLGLShaderCompileDebug               = (1 << 0),
@@ -991,7 +1229,16 @@ typedef enum LLGLStageFlags
     LLGLStageGeometryStage       = (1 << 3),
     LLGLStageFragmentStage       = (1 << 4),
     LLGLStageComputeStage        = (1 << 5),
+    LLGLStageTaskStage           = (1 << 6),
+    LLGLStageMeshStage           = (1 << 7),
+    LLGLStageTileStage           = (1 << 8),
+    LLGLStageRayGenerationStage  = (1 << 9),
+    LLGLStageMissStage           = (1 << 10),
+    LLGLStageClosestHitStage     = (1 << 11),
+    LLGLStageAnyHitStage         = (1 << 12),
     LLGLStageAllTessStages       = (LLGLStageTessControlStage | LLGLStageTessEvaluationStage),
+    LLGLStageAllMeshStages       = (LLGLStageTaskStage | LLGLStageMeshStage),
+    LLGLStageAllRayTracingStages = (LLGLStageRayGenerationStage | LLGLStageMissStage | LLGLStageClosestHitStage | LLGLStageAnyHitStage),
     LLGLStageAllGraphicsStages   = (LLGLStageVertexStage | LLGLStageAllTessStages | LLGLStageGeometryStage | LLGLStageFragmentStage),
     LLGLStageAllStages           = (LLGLStageAllGraphicsStages | LLGLStageComputeStage),
 }
@@ -1018,8 +1265,40 @@ typedef enum LLGLWindowFlags
 LLGLWindowFlags;
 
 
+/* ----- Delegates ----- */
+
+typedef void* (*LLGL_PFN_AllocateCallback)(size_t size, size_t alignment, void* userData);
+typedef void (*LLGL_PFN_FreeCallback)(void* ptr, size_t size, size_t alignment, void* userData);
+
+
 /* ----- Structures ----- */
 
+typedef struct LLGLAccelerationStructureInstance
+{
+    LLGLBuffer accelerationStructure; /* = LLGL_NULL_OBJECT */
+    float      transform[12];         /* = {1.0f,0.0f,0.0f,0.0f,0.0f,1.0f,0.0f,0.0f,0.0f,0.0f,1.0f,0.0f} */
+    uint32_t   instanceID;            /* = 0 */
+    uint32_t   mask;                  /* = 0xFF */
+    uint32_t   hitGroupOffset;        /* = 0 */
+}
+LLGLAccelerationStructureInstance;
+
+typedef struct LLGLAccelerationStructureSizes
+{
+    uint64_t accelerationStructureSize; /* = 0 */
+    uint64_t buildScratchSize;          /* = 0 */
+    uint64_t updateScratchSize;         /* = 0 */
+}
+LLGLAccelerationStructureSizes;
+
+typedef struct LLGLBufferCopyRegion
+{
+    uint64_t dstOffset; /* = 0 */
+    uint64_t srcOffset; /* = 0 */
+    uint64_t size;      /* = 0 */
+}
+LLGLBufferCopyRegion;
+
 typedef struct LLGLCanvasDescriptor
 {
     const char* title;
@@ -1035,15 +1314,29 @@ typedef struct LLGLClearValue
 }
 LLGLClearValue;
 
-typedef struct LLGLCommandBufferDescriptor
+typedef struct LLGLTransientBufferAllocation
 {
-    const char*    debugName;          /* = NULL */
-    long           flags;              /* = 0 */
-    uint32_t       numNativeBuffers;   /* = 0 */
-    uint64_t       minStagingPoolSize; /* = (0xFFFF+1) */
-    LLGLRenderPass renderPass;         /* = LLGL_NULL_OBJECT */
+    LLGLBuffer buffer; /* = LLGL_NULL_OBJECT */
+    uint64_t   offset; /* = 0 */
+    uint64_t   size;   /* = 0 */
+    void*      data;   /* = NULL */
 }
-LLGLCommandBufferDescriptor;
+LLGLTransientBufferAllocation;
+
+typedef struct LLGLDrawRecord
+{
+    uint32_t vertexBuffer;   /* = LLGL_INVALID_SLOT */
+    uint32_t indexBuffer;    /* = LLGL_INVALID_SLOT */
+    uint32_t resourceHeap;   /* = LLGL_INVALID_SLOT */
+    uint32_t descriptorSet;  /* = 0 */
+    uint32_t uniformsOffset; /* = LLGL_INVALID_SLOT */
+    uint32_t numVertices;    /* = 0 */
+    uint32_t numInstances;   /* = 1 */
+    uint32_t firstVertex;    /* = 0 */
+    int32_t  vertexOffset;   /* = 0 */
+    uint32_t firstInstance;  /* = 0 */
+}
+LLGLDrawRecord;
 
 typedef struct LLGLDrawIndirectArguments
 {
@@ -1079,6 +1372,12 @@ typedef struct LLGLDispatchIndirectArguments
 }
 LLGLDispatchIndirectArguments;
 
+typedef struct LLGLDrawMeshTasksIndirectArguments
+{
+    uint32_t numWorkGroups[3];
+}
+LLGLDrawMeshTasksIndirectArguments;
+
 typedef struct LLGLColorCodes
 {
     long textFlags;       /* = 0 */
@@ -1121,13 +1420,33 @@ typedef struct LLGLDepthBiasDescriptor
 }
 LLGLDepthBiasDescriptor;
 
-typedef struct LLGLComputePipelineDescriptor
+typedef struct LLGLSpecializationConstant
 {
-    const char*        debugName;      /* = NULL */
-    LLGLPipelineLayout pipelineLayout; /* = LLGL_NULL_OBJECT */
-    LLGLShader         computeShader;  /* = LLGL_NULL_OBJECT */
+    uint32_t id;    /* = 0 */
+    uint32_t value; /* = 0 */
 }
-LLGLComputePipelineDescriptor;
+LLGLSpecializationConstant;
+
+typedef struct LLGLRayTracingHitGroupDescriptor
+{
+    LLGLShader closestHitShader; /* = LLGL_NULL_OBJECT */
+    LLGLShader anyHitShader;     /* = LLGL_NULL_OBJECT */
+}
+LLGLRayTracingHitGroupDescriptor;
+
+typedef struct LLGLPlacementHeapDescriptor
+{
+    const char* debugName; /* = NULL */
+    uint64_t    size;      /* = 0 */
+}
+LLGLPlacementHeapDescriptor;
+
+typedef struct LLGLMemoryRequirements
+{
+    uint64_t size;      /* = 0 */
+    uint64_t alignment; /* = 0 */
+}
+LLGLMemoryRequirements;
 
 typedef struct LLGLQueryPipelineStatistics
 {
@@ -1154,6 +1473,20 @@ typedef struct LLGLProfileTimeRecord
 }
 LLGLProfileTimeRecord;
 
+typedef struct LLGLProfileScopeRecord
+{
+    const char* annotation;
+    uint32_t    parent;        /* = ~0u */
+    uint32_t    depth;         /* = 0 */
+    uint64_t    frame;         /* = 0 */
+    uint64_t    cpuTicksStart; /* = 0 */
+    uint64_t    cpuTicksEnd;   /* = 0 */
+    uint64_t    gpuTicksStart; /* = 0 */
+    uint64_t    gpuTicksEnd;   /* = 0 */
+    uint64_t    elapsedTime;   /* = 0 */
+}
+LLGLProfileScopeRecord;
+
 typedef struct LLGLProfileCommandQueueRecord
 {
     uint32_t bufferWrites;             /* = 0 */
@@ -1195,6 +1528,16 @@ typedef struct LLGLProfileCommandBufferRecord
 }
 LLGLProfileCommandBufferRecord;
 
+typedef struct LLGLProfileBackendRecord
+{
+    uint32_t redundantStateChanges;    /* = 0 */
+    uint32_t descriptorCopies;         /* = 0 */
+    uint32_t descriptorSetAllocations; /* = 0 */
+    uint32_t barriers;                 /* = 0 */
+    uint64_t stagingUploadBytes;       /* = 0 */
+}
+LLGLProfileBackendRecord;
+
 typedef struct LLGLRendererInfo
 {
     const char*        rendererName;
@@ -1208,37 +1551,64 @@ typedef struct LLGLRendererInfo
 }
 LLGLRendererInfo;
 
+typedef struct LLGLAllocatorDescriptor
+{
+    LLGL_PFN_AllocateCallback allocate; /* = NULL */
+    LLGL_PFN_FreeCallback     free;     /* = NULL */
+    void*                     userData; /* = NULL */
+}
+LLGLAllocatorDescriptor;
+
 typedef struct LLGLRenderingFeatures
 {
-    bool hasRenderTargets;             /* = false */
-    bool has3DTextures;                /* = false */
-    bool hasCubeTextures;              /* = false */
-    bool hasArrayTextures;             /* = false */
-    bool hasCubeArrayTextures;         /* = false */
-    bool hasMultiSampleTextures;       /* = false */
-    bool hasMultiSampleArrayTextures;  /* = false */
-    bool hasTextureViews;              /* = false */
-    bool hasTextureViewSwizzle;        /* = false */
-    bool hasTextureViewFormatSwizzle;  /* = false */
-    bool hasBufferViews;               /* = false */
-    bool hasSamplers;                  /* LLGLRenderingFeatures.hasSamplers is deprecated since 0.04b; All backends must support sampler states either natively or emulated. */
-    bool hasConstantBuffers;           /* = false */
-    bool hasStorageBuffers;            /* = false */
-    bool hasUniforms;                  /* LLGLRenderingFeatures.hasUniforms is deprecated since 0.04b; All backends must support uniforms either natively or emulated. */
-    bool hasGeometryShaders;           /* = false */
-    bool hasTessellationShaders;       /* = false */
-    bool hasTessellatorStage;          /* = false */
-    bool hasComputeShaders;            /* = false */
-    bool hasInstancing;                /* = false */
-    bool hasOffsetInstancing;          /* = false */
-    bool hasIndirectDrawing;           /* = false */
-    bool hasViewportArrays;            /* = false */
-    bool hasConservativeRasterization; /* = false */
-    bool hasStreamOutputs;             /* = false */
-    bool hasLogicOp;                   /* = false */
-    bool hasPipelineCaching;           /* = false */
-    bool hasPipelineStatistics;        /* = false */
-    bool hasRenderCondition;           /* = false */
+    bool hasRenderTargets;              /* = false */
+    bool has3DTextures;                 /* = false */
+    bool hasCubeTextures;               /* = false */
+    bool hasArrayTextures;              /* = false */
+    bool hasCubeArrayTextures;          /* = false */
+    bool hasMultiSampleTextures;        /* = false */
+    bool hasMultiSampleArrayTextures;   /* = false */
+    bool hasTextureViews;               /* = false */
+    bool hasTextureViewSwizzle;         /* = false */
+    bool hasTextureViewFormatSwizzle;   /* = false */
+    bool hasBufferViews;                /* = false */
+    bool hasSamplers;                   /* LLGLRenderingFeatures.hasSamplers is deprecated since 0.04b; All backends must support sampler states either natively or emulated. */
+    bool hasConstantBuffers;            /* = false */
+    bool hasStorageBuffers;             /* = false */
+    bool hasUniforms;                   /* LLGLRenderingFeatures.hasUniforms is deprecated since 0.04b; All backends must support uniforms either natively or emulated. */
+    bool hasGeometryShaders;            /* = false */
+    bool hasTessellationShaders;        /* = false */
+    bool hasTessellatorStage;           /* = false */
+    bool hasComputeShaders;             /* = false */
+    bool hasInstancing;                 /* = false */
+    bool hasOffsetInstancing;           /* = false */
+    bool hasIndirectDrawing;            /* = false */
+    bool hasViewportArrays;             /* = false */
+    bool hasConservativeRasterization;  /* = false */
+    bool hasStreamOutputs;              /* = false */
+    bool hasLogicOp;                    /* = false */
+    bool hasPipelineCaching;            /* = false */
+    bool hasPipelineStatistics;         /* = false */
+    bool hasRenderCondition;            /* = false */
+    bool hasTimestampQueries;           /* = false */
+    bool hasQueryResolve;               /* = false */
+    bool hasBindlessResourceHeaps;      /* = false */
+    bool hasIndirectCountDrawing;       /* = false */
+    bool hasMeshShaders;                /* = false */
+    bool hasTileShaders;                /* = false */
+    bool hasFramebufferFetch;           /* = false */
+    bool hasVariableRateShading;        /* = false */
+    bool hasIndirectStateChanges;       /* = false */
+    bool hasTransientBuffers;           /* = false */
+    bool hasPersistentMapping;          /* = false */
+    bool hasSparseTextures;             /* = false */
+    bool hasPlacementHeaps;             /* = false */
+    bool hasSharedResources;            /* = false */
+    bool hasConcurrentResourceCreation; /* = false */
+    bool hasRayTracing;                 /* = false */
+    bool hasRayQuery;                   /* = false */
+    bool hasMultiview;                  /* = false */
+    bool hasSamplerFeedback;            /* = false */
 }
 LLGLRenderingFeatures;
 
@@ -1255,6 +1625,7 @@ typedef struct LLGLRenderingLimits
     uint32_t maxAnisotropy;                    /* = 0 */
     uint32_t maxComputeShaderWorkGroups[3];    /* = {0,0,0} */
     uint32_t maxComputeShaderWorkGroupSize[3]; /* = {0,0,0} */
+    uint32_t maxComputeShaderSharedMemorySize; /* = 0 */
     uint32_t maxViewports;                     /* = 0 */
     uint32_t maxViewportSize[2];               /* = {0,0} */
     uint64_t maxBufferSize;                    /* = 0 */
@@ -1269,14 +1640,44 @@ typedef struct LLGLRenderingLimits
     uint32_t maxStencilBufferSamples;          /* = 0 */
     uint32_t maxNoAttachmentSamples;           /* = 0 */
     long     storageResourceStageFlags;        /* = 0 */
+    uint32_t maxBindlessResourceViews;         /* = 0 */
+    uint32_t sparseTileSize;                   /* = 0 */
+    uint32_t shadingRateImageTileSize;         /* = 0 */
+    uint32_t subgroupSizeRange[2];             /* = {0,0} */
+    long     subgroupStageFlags;               /* = 0 */
+    long     subgroupOperationFlags;           /* = 0 */
+    uint32_t maxMultiviewViewCount;            /* = 0 */
 }
 LLGLRenderingLimits;
 
+typedef struct LLGLMemoryHeapInfo
+{
+    long     flags;  /* = 0 */
+    uint64_t size;   /* = 0 */
+    uint64_t usage;  /* = 0 */
+    uint64_t budget; /* = 0 */
+}
+LLGLMemoryHeapInfo;
+
+typedef struct LLGLAdapterInfo
+{
+    const char* name;
+    uint32_t    vendorID;     /* = 0 */
+    uint32_t    deviceID;     /* = 0 */
+    uint64_t    videoMemory;  /* = 0 */
+    uint64_t    sharedMemory; /* = 0 */
+    uint64_t    luid;         /* = 0 */
+    uint8_t     uuid[16];     /* = {} */
+    bool        isActive;     /* = false */
+}
+LLGLAdapterInfo;
+
 typedef struct LLGLResourceHeapDescriptor
 {
     const char*        debugName;        /* = NULL */
     LLGLPipelineLayout pipelineLayout;   /* = LLGL_NULL_OBJECT */
     uint32_t           numResourceViews; /* = 0 */
+    long               flags;            /* = 0 */
     long               barrierFlags;     /* ResourceHeapDescriptor.barrierFlags is deprecated since 0.04b; Use PipelineLayoutDescriptor.barrierFlags instead! */
 }
 LLGLResourceHeapDescriptor;
@@ -1288,6 +1689,16 @@ typedef struct LLGLShaderMacro
 }
 LLGLShaderMacro;
 
+typedef struct LLGLFrameTimeStatistics
+{
+    float last;    /* = 0.0f */
+    float average; /* = 0.0f */
+    float p50;     /* = 0.0f */
+    float p95;     /* = 0.0f */
+    float p99;     /* = 0.0f */
+}
+LLGLFrameTimeStatistics;
+
 typedef struct LLGLTextureSubresource
 {
     uint32_t baseArrayLayer; /* = 0 */
@@ -1346,6 +1757,21 @@ typedef struct LLGLBufferViewDescriptor
 }
 LLGLBufferViewDescriptor;
 
+typedef struct LLGLAccelerationStructureGeometryDescriptor
+{
+    LLGLBuffer vertexBuffer; /* = LLGL_NULL_OBJECT */
+    uint64_t   vertexOffset; /* = 0 */
+    uint32_t   vertexStride; /* = 12 */
+    uint32_t   numVertices;  /* = 0 */
+    LLGLFormat vertexFormat; /* = LLGLFormatRGB32Float */
+    LLGLFormat indexFormat;  /* = LLGLFormatR32UInt */
+    LLGLBuffer indexBuffer;  /* = LLGL_NULL_OBJECT */
+    uint64_t   indexOffset;  /* = 0 */
+    uint32_t   numIndices;   /* = 0 */
+    bool       opaque;       /* = true */
+}
+LLGLAccelerationStructureGeometryDescriptor;
+
 typedef struct LLGLAttachmentClear
 {
     long           flags;           /* = 0 */
@@ -1354,6 +1780,56 @@ typedef struct LLGLAttachmentClear
 }
 LLGLAttachmentClear;
 
+typedef struct LLGLCommandBufferDescriptor
+{
+    const char*          debugName;          /* = NULL */
+    long                 flags;              /* = 0 */
+    uint32_t             numNativeBuffers;   /* = 0 */
+    uint64_t             minStagingPoolSize; /* = (0xFFFF+1) */
+    LLGLRenderPass       renderPass;         /* = LLGL_NULL_OBJECT */
+    LLGLCommandQueueType queueType;          /* = LLGLCommandQueueTypeGraphics */
+}
+LLGLCommandBufferDescriptor;
+
+typedef struct LLGLIndirectArgumentDescriptor
+{
+    LLGLIndirectArgumentType type;        /* = LLGLIndirectArgumentTypeDraw */
+    uint32_t                 first;       /* = 0 */
+    uint32_t                 numUniforms; /* = 0 */
+}
+LLGLIndirectArgumentDescriptor;
+
+typedef struct LLGLDrawPackedDescriptor
+{
+    size_t                  numVertexBuffers; /* = 0 */
+    LLGLBuffer const*       vertexBuffers;    /* = NULL */
+    size_t                  numIndexBuffers;  /* = 0 */
+    LLGLBuffer const*       indexBuffers;     /* = NULL */
+    LLGLFormat              indexFormat;      /* = LLGLFormatR32UInt */
+    size_t                  numResourceHeaps; /* = 0 */
+    LLGLResourceHeap const* resourceHeaps;    /* = NULL */
+    const void*             uniformData;      /* = NULL */
+    uint32_t                firstUniform;     /* = 0 */
+    uint16_t                uniformsSize;     /* = 0 */
+    bool                    indexed;          /* = false */
+    size_t                  numRecords;       /* = 0 */
+    const LLGLDrawRecord*   records;          /* = NULL */
+}
+LLGLDrawPackedDescriptor;
+
+typedef struct LLGLCommandRecord
+{
+    LLGLCommandOpcode opcode;      /* = LLGLCommandOpcodeDraw */
+    uint32_t          objectIndex; /* = LLGL_INVALID_SLOT */
+    uint32_t          arg0;        /* = 0 */
+    uint32_t          arg1;        /* = 0 */
+    uint32_t          arg2;        /* = 0 */
+    uint32_t          arg3;        /* = 0 */
+    uint32_t          arg4;        /* = 0 */
+    uint32_t          arg5;        /* = 0 */
+}
+LLGLCommandRecord;
+
 typedef struct LLGLDisplayMode
 {
     LLGLExtent2D resolution;
@@ -1487,6 +1963,33 @@ typedef struct LLGLTessellationDescriptor
 }
 LLGLTessellationDescriptor;
 
+typedef struct LLGLComputePipelineDescriptor
+{
+    const char*                       debugName;                  /* = NULL */
+    long                              flags;                      /* = 0 */
+    LLGLPipelineLayout                pipelineLayout;             /* = LLGL_NULL_OBJECT */
+    LLGLShader                        computeShader;              /* = LLGL_NULL_OBJECT */
+    size_t                            numSpecializationConstants; /* = 0 */
+    const LLGLSpecializationConstant* specializationConstants;    /* = NULL */
+}
+LLGLComputePipelineDescriptor;
+
+typedef struct LLGLRayTracingPipelineDescriptor
+{
+    const char*                             debugName;           /* = NULL */
+    long                                    flags;               /* = 0 */
+    LLGLPipelineLayout                      pipelineLayout;      /* = LLGL_NULL_OBJECT */
+    LLGLShader                              rayGenerationShader; /* = LLGL_NULL_OBJECT */
+    size_t                                  numMissShaders;      /* = 0 */
+    LLGLShader const*                       missShaders;         /* = NULL */
+    size_t                                  numHitGroups;        /* = 0 */
+    const LLGLRayTracingHitGroupDescriptor* hitGroups;           /* = NULL */
+    uint32_t                                maxRecursionDepth;   /* = 1 */
+    uint32_t                                maxPayloadSize;      /* = 16 */
+    uint32_t                                maxAttributeSize;    /* = 8 */
+}
+LLGLRayTracingPipelineDescriptor;
+
 typedef struct LLGLQueryHeapDescriptor
 {
     const char*   debugName;       /* = NULL */
@@ -1496,14 +1999,23 @@ typedef struct LLGLQueryHeapDescriptor
 }
 LLGLQueryHeapDescriptor;
 
-typedef struct LLGLFrameProfile
+typedef struct LLGLProfileStatisticsRecord
 {
-    LLGLProfileCommandQueueRecord  commandQueueRecord;
-    LLGLProfileCommandBufferRecord commandBufferRecord;
-    size_t                         numTimeRecords;      /* = 0 */
-    const LLGLProfileTimeRecord*   timeRecords;         /* = NULL */
+    const char*                 annotation;
+    uint64_t                    frame;      /* = 0 */
+    LLGLQueryPipelineStatistics statistics;
 }
-LLGLFrameProfile;
+LLGLProfileStatisticsRecord;
+
+typedef struct LLGLProfileEventRecord
+{
+    LLGLProfileEventType type;          /* = LLGLProfileEventTypeEncoding */
+    const char*          annotation;
+    uint32_t             thread;        /* = 0 */
+    uint64_t             cpuTicksStart; /* = 0 */
+    uint64_t             cpuTicksEnd;   /* = 0 */
+}
+LLGLProfileEventRecord;
 
 typedef struct LLGLAttachmentFormatDescriptor
 {
@@ -1515,16 +2027,22 @@ LLGLAttachmentFormatDescriptor;
 
 typedef struct LLGLRenderSystemDescriptor
 {
-    const char*           moduleName;
-    long                  flags;              /* = 0 */
-    void*                 profiler;           /* = NULL */
-    LLGLRenderingDebugger debugger;           /* = LLGL_NULL_OBJECT */
-    const void*           rendererConfig;     /* = NULL */
-    size_t                rendererConfigSize; /* = 0 */
-    const void*           nativeHandle;       /* = NULL */
-    size_t                nativeHandleSize;   /* = 0 */
+    const char*             moduleName;
+    long                    flags;                  /* = 0 */
+    int                     adapterIndex;           /* = -1 */
+    uint64_t                adapterLUID;            /* = 0 */
+    uint8_t                 adapterUUID[16];        /* = {} */
+    void*                   profiler;               /* = NULL */
+    LLGLRenderingDebugger   debugger;               /* = LLGL_NULL_OBJECT */
+    const void*             rendererConfig;         /* = NULL */
+    size_t                  rendererConfigSize;     /* = 0 */
+    const void*             nativeHandle;           /* = NULL */
+    size_t                  nativeHandleSize;       /* = 0 */
+    const char*             pipelineCacheDirectory; /* = NULL */
+    const char*             shaderCacheFilename;    /* = NULL */
+    LLGLAllocatorDescriptor allocator;
 #if __ANDROID__
-    struct android_app*   androidApp;         /* = NULL */
+    struct android_app*     androidApp;             /* = NULL */
 #endif /* __ANDROID__ */
 }
 LLGLRenderSystemDescriptor;
@@ -1551,6 +2069,15 @@ typedef struct LLGLAttachmentDescriptor
 }
 LLGLAttachmentDescriptor;
 
+typedef struct LLGLSharedResourceHandle
+{
+    LLGLSharedHandleType type;   /* = LLGLSharedHandleTypeUndefined */
+    void*                handle; /* = NULL */
+    int32_t              fd;     /* = -1 */
+    uint64_t             size;   /* = 0 */
+}
+LLGLSharedResourceHandle;
+
 typedef struct LLGLSamplerDescriptor
 {
     const char*            debugName;      /* = NULL */
@@ -1579,18 +2106,36 @@ LLGLComputeShaderAttributes;
 
 typedef struct LLGLSwapChainDescriptor
 {
-    const char*  debugName;   /* = NULL */
-    LLGLExtent2D resolution;
-    int          colorBits;   /* = 32 */
-    int          depthBits;   /* = 24 */
-    int          stencilBits; /* = 8 */
-    uint32_t     samples;     /* = 1 */
-    uint32_t     swapBuffers; /* = 2 */
-    bool         fullscreen;  /* = false */
-    bool         resizable;   /* = false */
+    const char*     debugName;             /* = NULL */
+    LLGLExtent2D    resolution;
+    int             colorBits;             /* = 32 */
+    int             depthBits;             /* = 24 */
+    int             stencilBits;           /* = 8 */
+    uint32_t        samples;               /* = 1 */
+    uint32_t        swapBuffers;           /* = 2 */
+    uint32_t        maxFramesInFlight;     /* = 0 */
+    uint32_t        frameStatisticsWindow; /* = 0 */
+    LLGLPresentMode presentMode;           /* = LLGLPresentModeDefault */
+    LLGLColorSpace  colorSpace;            /* = LLGLColorSpaceSRGB */
+    bool            fullscreen;            /* = false */
+    bool            resizable;             /* = false */
+    bool            lateImageAcquire;      /* = false */
+    bool            preTransform;          /* = false */
+    bool            framePacing;           /* = false */
 }
 LLGLSwapChainDescriptor;
 
+typedef struct LLGLFrameStatistics
+{
+    uint64_t                numFrames;        /* = 0 */
+    uint32_t                numSamples;       /* = 0 */
+    LLGLFrameTimeStatistics cpuFrameTime;
+    LLGLFrameTimeStatistics displayFrameTime;
+    LLGLFrameTimeStatistics presentInterval;
+    LLGLFrameTimeStatistics queueStallTime;
+}
+LLGLFrameStatistics;
+
 typedef struct LLGLTextureSwizzleRGBA
 {
     LLGLTextureSwizzle r : 8; /* = LLGLTextureSwizzleRed */
@@ -1632,6 +2177,26 @@ typedef struct LLGLTextureDescriptor
 }
 LLGLTextureDescriptor;
 
+typedef struct LLGLTileMappingDescriptor
+{
+    LLGLTexture  texture;    /* = LLGL_NULL_OBJECT */
+    uint32_t     mipLevel;   /* = 0 */
+    uint32_t     arrayLayer; /* = 0 */
+    LLGLOffset3D tileOffset;
+    LLGLExtent3D numTiles;   /* = {1,1,1} */
+    bool         resident;   /* = true */
+}
+LLGLTileMappingDescriptor;
+
+typedef struct LLGLSamplerFeedbackDescriptor
+{
+    const char*             debugName;     /* = NULL */
+    LLGLTexture             pairedTexture; /* = LLGL_NULL_OBJECT */
+    LLGLSamplerFeedbackType type;          /* = LLGLSamplerFeedbackTypeMinMip */
+    LLGLExtent3D            mipRegion;     /* = {4,4,1} */
+}
+LLGLSamplerFeedbackDescriptor;
+
 typedef struct LLGLVertexAttribute
 {
     const char*     name;
@@ -1671,6 +2236,43 @@ typedef struct LLGLBufferDescriptor
 }
 LLGLBufferDescriptor;
 
+typedef struct LLGLAccelerationStructureDescriptor
+{
+    LLGLAccelerationStructureType                      type;          /* = LLGLAccelerationStructureTypeBottomLevel */
+    long                                               flags;         /* = 0 */
+    size_t                                             numGeometries; /* = 0 */
+    const LLGLAccelerationStructureGeometryDescriptor* geometries;    /* = NULL */
+    size_t                                             numInstances;  /* = 0 */
+    const LLGLAccelerationStructureInstance*           instances;     /* = NULL */
+}
+LLGLAccelerationStructureDescriptor;
+
+typedef struct LLGLIndirectCommandDescriptor
+{
+    size_t                                numArguments; /* = 0 */
+    const LLGLIndirectArgumentDescriptor* arguments;    /* = NULL */
+    uint32_t                              stride;       /* = 0 */
+}
+LLGLIndirectCommandDescriptor;
+
+typedef struct LLGLCommandBatchDescriptor
+{
+    size_t                       numObjects;  /* = 0 */
+    LLGLRenderSystemChild const* objects;     /* = NULL */
+    const void*                  uniformData; /* = NULL */
+    size_t                       numRecords;  /* = 0 */
+    const LLGLCommandRecord*     records;     /* = NULL */
+}
+LLGLCommandBatchDescriptor;
+
+typedef struct LLGLTextureUploadDescriptor
+{
+    LLGLTexture       texture;   /* = LLGL_NULL_OBJECT */
+    LLGLTextureRegion region;
+    LLGLImageView     imageView;
+}
+LLGLTextureUploadDescriptor;
+
 typedef struct LLGLStaticSamplerDescriptor
 {
     const char*           name;
@@ -1701,6 +2303,23 @@ typedef struct LLGLBlendDescriptor
 }
 LLGLBlendDescriptor;
 
+typedef struct LLGLFrameProfile
+{
+    LLGLProfileCommandQueueRecord      commandQueueRecord;
+    LLGLProfileCommandBufferRecord     commandBufferRecord;
+    LLGLProfileBackendRecord           backendRecord;
+    size_t                             numTimeRecords;       /* = 0 */
+    const LLGLProfileTimeRecord*       timeRecords;          /* = NULL */
+    size_t                             numScopeRecords;      /* = 0 */
+    const LLGLProfileScopeRecord*      scopeRecords;         /* = NULL */
+    size_t                             numEventRecords;      /* = 0 */
+    const LLGLProfileEventRecord*      eventRecords;         /* = NULL */
+    size_t                             numStatisticsRecords; /* = 0 */
+    const LLGLProfileStatisticsRecord* statisticsRecords;    /* = NULL */
+    LLGLQueryPipelineStatistics        pipelineStatistics;
+}
+LLGLFrameProfile;
+
 typedef struct LLGLRenderPassDescriptor
 {
     const char*                    debugName;           /* = NULL */
@@ -1708,18 +2327,36 @@ typedef struct LLGLRenderPassDescriptor
     LLGLAttachmentFormatDescriptor depthAttachment;
     LLGLAttachmentFormatDescriptor stencilAttachment;
     uint32_t                       samples;             /* = 1 */
+    uint32_t                       viewMask;            /* = 0 */
 }
 LLGLRenderPassDescriptor;
 
+typedef struct LLGLFileUploadDescriptor
+{
+    const char*         filename;         /* = NULL */
+    uint64_t            fileOffset;       /* = 0 */
+    uint64_t            fileSize;         /* = 0 */
+    LLGLFileCompression compression;      /* = LLGLFileCompressionUncompressed */
+    uint64_t            uncompressedSize; /* = 0 */
+    LLGLBuffer          buffer;           /* = LLGL_NULL_OBJECT */
+    uint64_t            bufferOffset;     /* = 0 */
+    LLGLTexture         texture;          /* = LLGL_NULL_OBJECT */
+    LLGLTextureRegion   textureRegion;
+    uint32_t            rowStride;        /* = 0 */
+}
+LLGLFileUploadDescriptor;
+
 typedef struct LLGLRenderTargetDescriptor
 {
     const char*              debugName;              /* = NULL */
     LLGLRenderPass           renderPass;             /* = LLGL_NULL_OBJECT */
     LLGLExtent2D             resolution;
     uint32_t                 samples;                /* = 1 */
+    uint32_t                 viewMask;               /* = 0 */
     LLGLAttachmentDescriptor colorAttachments[8];
     LLGLAttachmentDescriptor resolveAttachments[8];
     LLGLAttachmentDescriptor depthStencilAttachment;
+    LLGLAttachmentDescriptor shadingRateAttachment;
 }
 LLGLRenderTargetDescriptor;
 
@@ -1747,6 +2384,14 @@ typedef struct LLGLShaderResourceReflection
 }
 LLGLShaderResourceReflection;
 
+typedef struct LLGLTextureCopyRegion
+{
+    LLGLTextureLocation dstLocation;
+    LLGLTextureLocation srcLocation;
+    LLGLExtent3D        extent;
+}
+LLGLTextureCopyRegion;
+
 typedef struct LLGLTextureViewDescriptor
 {
     LLGLTextureType        type;        /* = LLGLTextureTypeTexture2D */
@@ -1770,30 +2415,38 @@ typedef struct LLGLPipelineLayoutDescriptor
     size_t                                      numCombinedTextureSamplers; /* = 0 */
     const LLGLCombinedTextureSamplerDescriptor* combinedTextureSamplers;    /* = NULL */
     long                                        barrierFlags;               /* = 0 */
+    long                                        flags;                      /* = 0 */
 }
 LLGLPipelineLayoutDescriptor;
 
 typedef struct LLGLGraphicsPipelineDescriptor
 {
-    const char*                debugName;            /* = NULL */
-    LLGLPipelineLayout         pipelineLayout;       /* = LLGL_NULL_OBJECT */
-    LLGLRenderPass             renderPass;           /* = LLGL_NULL_OBJECT */
-    LLGLShader                 vertexShader;         /* = LLGL_NULL_OBJECT */
-    LLGLShader                 tessControlShader;    /* = LLGL_NULL_OBJECT */
-    LLGLShader                 tessEvaluationShader; /* = LLGL_NULL_OBJECT */
-    LLGLShader                 geometryShader;       /* = LLGL_NULL_OBJECT */
-    LLGLShader                 fragmentShader;       /* = LLGL_NULL_OBJECT */
-    LLGLFormat                 indexFormat;          /* = LLGLFormatUndefined */
-    LLGLPrimitiveTopology      primitiveTopology;    /* = LLGLPrimitiveTopologyTriangleList */
-    size_t                     numViewports;         /* = 0 */
-    const LLGLViewport*        viewports;            /* = NULL */
-    size_t                     numScissors;          /* = 0 */
-    const LLGLScissor*         scissors;             /* = NULL */
-    LLGLDepthDescriptor        depth;
-    LLGLStencilDescriptor      stencil;
-    LLGLRasterizerDescriptor   rasterizer;
-    LLGLBlendDescriptor        blend;
-    LLGLTessellationDescriptor tessellation;
+    const char*                       debugName;                  /* = NULL */
+    long                              flags;                      /* = 0 */
+    LLGLPipelineLayout                pipelineLayout;             /* = LLGL_NULL_OBJECT */
+    LLGLRenderPass                    renderPass;                 /* = LLGL_NULL_OBJECT */
+    uint32_t                          viewMask;                   /* = 0 */
+    LLGLShader                        vertexShader;               /* = LLGL_NULL_OBJECT */
+    LLGLShader                        tessControlShader;          /* = LLGL_NULL_OBJECT */
+    LLGLShader                        tessEvaluationShader;       /* = LLGL_NULL_OBJECT */
+    LLGLShader                        geometryShader;             /* = LLGL_NULL_OBJECT */
+    LLGLShader                        taskShader;                 /* = LLGL_NULL_OBJECT */
+    LLGLShader                        meshShader;                 /* = LLGL_NULL_OBJECT */
+    LLGLShader                        tileShader;                 /* = LLGL_NULL_OBJECT */
+    LLGLShader                        fragmentShader;             /* = LLGL_NULL_OBJECT */
+    LLGLFormat                        indexFormat;                /* = LLGLFormatUndefined */
+    LLGLPrimitiveTopology             primitiveTopology;          /* = LLGLPrimitiveTopologyTriangleList */
+    size_t                            numViewports;               /* = 0 */
+    const LLGLViewport*               viewports;                  /* = NULL */
+    size_t                            numScissors;                /* = 0 */
+    const LLGLScissor*                scissors;                   /* = NULL */
+    LLGLDepthDescriptor               depth;
+    LLGLStencilDescriptor             stencil;
+    LLGLRasterizerDescriptor          rasterizer;
+    LLGLBlendDescriptor               blend;
+    LLGLTessellationDescriptor        tessellation;
+    size_t                            numSpecializationConstants; /* = 0 */
+    const LLGLSpecializationConstant* specializationConstants;    /* = NULL */
 }
 LLGLGraphicsPipelineDescriptor;
 
@@ -1808,19 +2461,21 @@ LLGLResourceViewDescriptor;
 
 typedef struct LLGLShaderDescriptor
 {
-    const char*                  debugName;  /* = NULL */
-    LLGLShaderType               type;       /* = LLGLShaderTypeUndefined */
-    const char*                  source;     /* = NULL */
-    size_t                       sourceSize; /* = 0 */
-    LLGLShaderSourceType         sourceType; /* = LLGLShaderSourceTypeCodeFile */
-    const char*                  entryPoint; /* = NULL */
-    const char*                  profile;    /* = NULL */
-    const LLGLShaderMacro*       defines;    /* = NULL */
-    long                         flags;      /* = 0 */
-    const char*                  name;       /* ShaderDescriptor.name is deprecated since 0.04b; Use ShaderDescriptor.debugName instead! */
+    const char*                  debugName;          /* = NULL */
+    LLGLShaderType               type;               /* = LLGLShaderTypeUndefined */
+    const char*                  source;             /* = NULL */
+    size_t                       sourceSize;         /* = 0 */
+    LLGLShaderSourceType         sourceType;         /* = LLGLShaderSourceTypeCodeFile */
+    const char*                  entryPoint;         /* = NULL */
+    const char*                  profile;            /* = NULL */
+    const LLGLShaderMacro*       defines;            /* = NULL */
+    long                         flags;              /* = 0 */
+    const char*                  name;               /* ShaderDescriptor.name is deprecated since 0.04b; Use ShaderDescriptor.debugName instead! */
     LLGLVertexShaderAttributes   vertex;
     LLGLFragmentShaderAttributes fragment;
     LLGLComputeShaderAttributes  compute;
+    const void*                  reflectionData;     /* = NULL */
+    size_t                       reflectionDataSize; /* = 0 */
 }
 LLGLShaderDescriptor;
 
@@ -32,6 +32,10 @@ LLGL_C_EXPORT LLGLLogHandle llglRegisterLogCallbackExt(LLGL_PFN_ReportCallbackEx
 LLGL_C_EXPORT LLGLLogHandle llglRegisterLogCallbackReport(LLGLReport report);
 LLGL_C_EXPORT LLGLLogHandle llglRegisterLogCallbackStd(long stdOutFlags);
 LLGL_C_EXPORT void llglUnregisterLogCallback(LLGLLogHandle handle);
+LLGL_C_EXPORT void llglSetLogReportLevel(LLGLReportType type);
+LLGL_C_EXPORT bool llglIsLogReportEnabled(LLGLReportType type);
+LLGL_C_EXPORT void llglSetLogDeferredReports(size_t capacity);
+LLGL_C_EXPORT size_t llglFlushLogDeferredReports();
 
 
 #endif
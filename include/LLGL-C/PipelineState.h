@@ -15,6 +15,7 @@
 
 
 LLGL_C_EXPORT LLGLReport llglGetPipelineStateReport(LLGLPipelineState pipelineState);
+LLGL_C_EXPORT bool llglIsPipelineStateReady(LLGLPipelineState pipelineState);
 
 
 #endif
@@ -0,0 +1,23 @@
+/*
+ * PlacementHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_C99_PLACEMENT_HEAP_H
+#define LLGL_C99_PLACEMENT_HEAP_H
+
+
+#include <LLGL-C/Export.h>
+#include <LLGL-C/LLGLWrapper.h>
+
+
+LLGL_C_EXPORT uint64_t llglGetPlacementHeapSize(LLGLPlacementHeap placementHeap);
+
+
+#endif
+
+
+
+// ================================================================================
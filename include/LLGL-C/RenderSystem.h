@@ -23,6 +23,8 @@ LLGL_C_EXPORT const char* llglGetRendererName();
 LLGL_C_EXPORT void llglGetRendererInfo(LLGLRendererInfo* outInfo);
 LLGL_C_EXPORT void llglGetRenderingCaps(LLGLRenderingCapabilities* outCaps);
 LLGL_C_EXPORT LLGLReport llglGetRendererReport();
+LLGL_C_EXPORT uint32_t llglQueryMemoryHeaps(LLGLMemoryHeapInfo* outHeapInfos, uint32_t maxHeapInfos);
+LLGL_C_EXPORT uint32_t llglQueryAdapters(LLGLAdapterInfo* outAdapters, uint32_t maxAdapters);
 
 LLGL_C_EXPORT LLGLSwapChain llglCreateSwapChain(const LLGLSwapChainDescriptor* swapChainDesc);
 LLGL_C_EXPORT LLGLSwapChain llglCreateSwapChainExt(const LLGLSwapChainDescriptor* swapChainDesc, LLGLSurface surface);
@@ -32,20 +34,41 @@ LLGL_C_EXPORT LLGLCommandBuffer llglCreateCommandBuffer(const LLGLCommandBufferD
 LLGL_C_EXPORT void llglReleaseCommandBuffer(LLGLCommandBuffer commandBuffer);
 
 LLGL_C_EXPORT LLGLBuffer llglCreateBuffer(const LLGLBufferDescriptor* bufferDesc, const void* initialData LLGL_ANNOTATE(NULL));
+LLGL_C_EXPORT void llglCreateBuffers(uint32_t numBuffers, const LLGLBufferDescriptor* bufferDescs, const void** initialData LLGL_ANNOTATE(NULL), LLGLBuffer* outBuffers);
 LLGL_C_EXPORT void llglReleaseBuffer(LLGLBuffer buffer);
+LLGL_C_EXPORT void llglReleaseBuffers(uint32_t numBuffers, const LLGLBuffer* buffers LLGL_ANNOTATE([numBuffers]));
 LLGL_C_EXPORT void llglWriteBuffer(LLGLBuffer buffer, uint64_t offset, const void* data, uint64_t dataSize);
 LLGL_C_EXPORT void llglReadBuffer(LLGLBuffer buffer, uint64_t offset, void* data, uint64_t dataSize);
 LLGL_C_EXPORT void* llglMapBuffer(LLGLBuffer buffer, LLGLCPUAccess access);
 LLGL_C_EXPORT void* llglMapBufferRange(LLGLBuffer buffer, LLGLCPUAccess access, uint64_t offset, uint64_t length);
 LLGL_C_EXPORT void llglUnmapBuffer(LLGLBuffer buffer);
+LLGL_C_EXPORT void llglFlushMappedRange(LLGLBuffer buffer, uint64_t offset, uint64_t length);
+LLGL_C_EXPORT void llglGetAccelerationStructureSizes(const LLGLAccelerationStructureDescriptor* accelerationStructureDesc, LLGLAccelerationStructureSizes* outSizes);
 
 LLGL_C_EXPORT LLGLBufferArray llglCreateBufferArray(uint32_t numBuffers, const LLGLBuffer* buffers LLGL_ANNOTATE([numBuffers]));
 LLGL_C_EXPORT void llglReleaseBufferArray(LLGLBufferArray bufferArray);
 
 LLGL_C_EXPORT LLGLTexture llglCreateTexture(const LLGLTextureDescriptor* textureDesc, const LLGLImageView* initialImage LLGL_ANNOTATE(NULL));
+LLGL_C_EXPORT void llglCreateTextures(uint32_t numTextures, const LLGLTextureDescriptor* textureDescs, const LLGLImageView* initialImages LLGL_ANNOTATE(NULL), LLGLTexture* outTextures);
 LLGL_C_EXPORT void llglReleaseTexture(LLGLTexture texture);
+LLGL_C_EXPORT void llglReleaseTextures(uint32_t numTextures, const LLGLTexture* textures LLGL_ANNOTATE([numTextures]));
 LLGL_C_EXPORT void llglWriteTexture(LLGLTexture texture, const LLGLTextureRegion* textureRegion, const LLGLImageView* srcImageView);
+LLGL_C_EXPORT void llglWriteTextureAsync(uint32_t numUploads, const LLGLTextureUploadDescriptor* uploads LLGL_ANNOTATE([numUploads]), LLGLFence fence LLGL_ANNOTATE(NULL));
+LLGL_C_EXPORT void llglWriteFromFileAsync(uint32_t numUploads, const LLGLFileUploadDescriptor* uploads LLGL_ANNOTATE([numUploads]), LLGLFence fence LLGL_ANNOTATE(NULL));
 LLGL_C_EXPORT void llglReadTexture(LLGLTexture texture, const LLGLTextureRegion* textureRegion, const LLGLMutableImageView* dstImageView);
+LLGL_C_EXPORT void llglReadTextureAsync(LLGLTexture texture, const LLGLTextureRegion* textureRegion, const LLGLMutableImageView* dstImageView, LLGLFence fence);
+
+LLGL_C_EXPORT LLGLPlacementHeap llglCreatePlacementHeap(const LLGLPlacementHeapDescriptor* placementHeapDesc);
+LLGL_C_EXPORT void llglReleasePlacementHeap(LLGLPlacementHeap placementHeap);
+LLGL_C_EXPORT void llglGetTextureMemoryRequirements(const LLGLTextureDescriptor* textureDesc, LLGLMemoryRequirements* outRequirements);
+LLGL_C_EXPORT LLGLTexture llglCreatePlacedTexture(LLGLPlacementHeap placementHeap, uint64_t offset, const LLGLTextureDescriptor* textureDesc);
+
+LLGL_C_EXPORT LLGLTexture llglCreateSamplerFeedbackTexture(const LLGLSamplerFeedbackDescriptor* samplerFeedbackDesc);
+
+LLGL_C_EXPORT bool llglExportSharedHandle(LLGLResource resource, LLGLSharedResourceHandle* outHandle);
+LLGL_C_EXPORT LLGLTexture llglImportTexture(const LLGLTextureDescriptor* textureDesc, const LLGLSharedResourceHandle* sharedHandle);
+LLGL_C_EXPORT LLGLBuffer llglImportBuffer(const LLGLBufferDescriptor* bufferDesc, const LLGLSharedResourceHandle* sharedHandle);
+LLGL_C_EXPORT bool llglExportSharedFence(LLGLFence fence, LLGLSharedResourceHandle* outHandle);
 
 LLGL_C_EXPORT LLGLSampler llglCreateSampler(const LLGLSamplerDescriptor* samplerDesc);
 LLGL_C_EXPORT void llglReleaseSampler(LLGLSampler sampler);
@@ -62,6 +85,7 @@ LLGL_C_EXPORT LLGLRenderTarget llglCreateRenderTarget(const LLGLRenderTargetDesc
 LLGL_C_EXPORT void llglReleaseRenderTarget(LLGLRenderTarget renderTarget);
 
 LLGL_C_EXPORT LLGLShader llglCreateShader(const LLGLShaderDescriptor* shaderDesc);
+LLGL_C_EXPORT void llglCreateShaders(uint32_t numShaders, const LLGLShaderDescriptor* shaderDescs, LLGLShader* outShaders);
 LLGL_C_EXPORT void llglReleaseShader(LLGLShader shader);
 
 LLGL_C_EXPORT LLGLPipelineLayout llglCreatePipelineLayout(const LLGLPipelineLayoutDescriptor* pipelineLayoutDesc);
@@ -74,6 +98,9 @@ LLGL_C_EXPORT LLGLPipelineState llglCreateGraphicsPipelineState(const LLGLGraphi
 LLGL_C_EXPORT LLGLPipelineState llglCreateGraphicsPipelineStateExt(const LLGLGraphicsPipelineDescriptor* pipelineStateDesc, LLGLPipelineCache pipelineCache);
 LLGL_C_EXPORT LLGLPipelineState llglCreateComputePipelineState(const LLGLComputePipelineDescriptor* pipelineStateDesc);
 LLGL_C_EXPORT LLGLPipelineState llglCreateComputePipelineStateExt(const LLGLComputePipelineDescriptor* pipelineStateDesc, LLGLPipelineCache pipelineCache);
+LLGL_C_EXPORT void llglCreateGraphicsPipelineStates(uint32_t numPipelineStates, const LLGLGraphicsPipelineDescriptor* pipelineStateDescs, LLGLPipelineState* outPipelineStates, LLGLPipelineCache pipelineCache);
+LLGL_C_EXPORT void llglCreateComputePipelineStates(uint32_t numPipelineStates, const LLGLComputePipelineDescriptor* pipelineStateDescs, LLGLPipelineState* outPipelineStates, LLGLPipelineCache pipelineCache);
+LLGL_C_EXPORT LLGLPipelineState llglCreateRayTracingPipelineState(const LLGLRayTracingPipelineDescriptor* pipelineStateDesc);
 LLGL_C_EXPORT void llglReleasePipelineState(LLGLPipelineState pipelineState);
 
 LLGL_C_EXPORT LLGLQueryHeap llglCreateQueryHeap(const LLGLQueryHeapDescriptor* queryHeapDesc);
@@ -81,6 +108,8 @@ LLGL_C_EXPORT void llglReleaseQueryHeap(LLGLQueryHeap queryHeap);
 
 LLGL_C_EXPORT LLGLFence llglCreateFence();
 LLGL_C_EXPORT void llglReleaseFence(LLGLFence fence);
+LLGL_C_EXPORT bool llglGetFenceNativeHandle(LLGLFence fence, void* nativeHandle, size_t nativeHandleSize);
+LLGL_C_EXPORT bool llglIsFenceSignaled(LLGLFence fence);
 
 LLGL_C_EXPORT bool llglGetRenderSystemNativeHandle(void* nativeHandle, size_t nativeHandleSize);
 
@@ -19,6 +19,20 @@ LLGL_C_EXPORT LLGLRenderingDebugger llglAllocRenderingDebugger();
 LLGL_C_EXPORT void llglFreeRenderingDebugger(LLGLRenderingDebugger debugger);
 LLGL_C_EXPORT void llglSetDebuggerTimeRecording(LLGLRenderingDebugger debugger, bool enabled);
 LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerScopeRecording(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerScopeRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerEventRecording(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerEventRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerStatisticsRecording(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerStatisticsRecording(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerValidation(LLGLRenderingDebugger debugger, bool enabled);
+LLGL_C_EXPORT bool llglGetDebuggerValidation(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglSetDebuggerValidationFlags(LLGLRenderingDebugger debugger, long flags);
+LLGL_C_EXPORT long llglGetDebuggerValidationFlags(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT void llglBeginDebuggerCapture(LLGLRenderingDebugger debugger, const char* filename, uint32_t numFrames);
+LLGL_C_EXPORT void llglEndDebuggerCapture(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT const char* llglGetDebuggerCaptureFilename(LLGLRenderingDebugger debugger);
+LLGL_C_EXPORT uint32_t llglGetDebuggerCaptureFrames(LLGLRenderingDebugger debugger);
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile);
 
 
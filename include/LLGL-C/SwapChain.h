@@ -22,6 +22,11 @@ LLGL_C_EXPORT LLGLFormat llglGetColorFormat(LLGLSwapChain swapChain);
 LLGL_C_EXPORT LLGLFormat llglGetDepthStencilFormat(LLGLSwapChain swapChain);
 LLGL_C_EXPORT bool llglResizeBuffers(LLGLSwapChain swapChain, const LLGLExtent2D* resolution, long flags);
 LLGL_C_EXPORT bool llglSetVsyncInterval(LLGLSwapChain swapChain, uint32_t vsyncInterval);
+LLGL_C_EXPORT bool llglWaitForNextFrame(LLGLSwapChain swapChain, uint64_t timeout);
+LLGL_C_EXPORT bool llglGetFrameStatistics(LLGLSwapChain swapChain, LLGLFrameStatistics* outStatistics);
+LLGL_C_EXPORT bool llglGetCurrentBackBufferNativeHandle(LLGLSwapChain swapChain, void* nativeHandle, size_t nativeHandleSize);
+LLGL_C_EXPORT LLGLSurfaceTransform llglGetSurfaceTransform(LLGLSwapChain swapChain);
+LLGL_C_EXPORT LLGLColorSpace llglGetColorSpace(LLGLSwapChain swapChain);
 LLGL_C_EXPORT bool llglSwitchFullscreen(LLGLSwapChain swapChain, bool enable);
 LLGL_C_EXPORT LLGLSurface llglGetSurface(LLGLSwapChain swapChain);
 
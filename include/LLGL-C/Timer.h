@@ -15,6 +15,7 @@
 
 LLGL_C_EXPORT uint64_t llglTimerFrequency();
 LLGL_C_EXPORT uint64_t llglTimerTick();
+LLGL_C_EXPORT void llglTimerSleepUntil(uint64_t tick);
 
 
 #endif
@@ -33,6 +33,7 @@ LLGL_DECL_WRAPPER_TYPE( LLGLImage );
 LLGL_DECL_WRAPPER_TYPE( LLGLPipelineLayout );
 LLGL_DECL_WRAPPER_TYPE( LLGLPipelineCache );
 LLGL_DECL_WRAPPER_TYPE( LLGLPipelineState );
+LLGL_DECL_WRAPPER_TYPE( LLGLPlacementHeap );
 LLGL_DECL_WRAPPER_TYPE( LLGLQueryHeap );
 LLGL_DECL_WRAPPER_TYPE( LLGLRenderPass );
 /*LLGL_DECL_WRAPPER_TYPE( LLGLRenderSystem );*/
@@ -81,10 +81,54 @@ virtual void DrawIndexedIndirect(
     std::uint32_t   stride
 ) override final;
 
+virtual void DrawIndirectCount(
+    LLGL::Buffer&   buffer,
+    std::uint64_t   offset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
+virtual void DrawIndexedIndirectCount(
+    LLGL::Buffer&   buffer,
+    std::uint64_t   offset,
+    LLGL::Buffer&   countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride
+) override final;
+
 virtual void DrawStreamOutput(
     void
 ) override final;
 
+virtual void DrawMeshTasks(
+    std::uint32_t   numWorkGroupsX,
+    std::uint32_t   numWorkGroupsY,
+    std::uint32_t   numWorkGroupsZ
+) override final;
+
+virtual void DrawMeshTasksIndirect(
+    LLGL::Buffer&   buffer,
+    std::uint64_t   offset,
+    std::uint32_t   numCommands,
+    std::uint32_t   stride
+) override final;
+
+virtual void DispatchTiles(
+    void
+) override final;
+
+virtual void ExecuteIndirect(
+    const LLGL::IndirectCommandDescriptor&  commandDesc,
+    LLGL::Buffer&                           buffer,
+    std::uint64_t                           offset,
+    LLGL::Buffer*                           countBuffer,
+    std::uint64_t                           countOffset,
+    std::uint32_t                           maxNumCommands
+) override final;
+
 
 
 // ================================================================================
@@ -20,6 +20,10 @@ virtual void SetStencilReference(
     const LLGL::StencilFace stencilFace = LLGL::StencilFace::FrontAndBack
 ) override final;
 
+virtual void SetShadingRate(
+    const LLGL::ShadingRate rate
+) override final;
+
 virtual void SetUniforms(
     std::uint32_t           first,
     const void*             data,
@@ -17,6 +17,14 @@ virtual void EndQuery(
     std::uint32_t                   query
 ) override final;
 
+virtual void ResolveQueryData(
+    LLGL::QueryHeap&                srcQueryHeap,
+    std::uint32_t                   firstQuery,
+    std::uint32_t                   numQueries,
+    LLGL::Buffer&                   dstBuffer,
+    std::uint64_t                   dstOffset
+) override final;
+
 virtual void BeginRenderCondition(
     QueryHeap&                      queryHeap,
     std::uint32_t                   query,
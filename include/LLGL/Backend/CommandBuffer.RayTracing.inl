@@ -0,0 +1,25 @@
+/*
+ * CommandBuffer.RayTracing.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+/* ----- Ray Tracing ----- */
+
+virtual void BuildAccelerationStructure(
+    LLGL::Buffer&                                   dstBuffer,
+    LLGL::Buffer&                                   scratchBuffer,
+    const LLGL::AccelerationStructureDescriptor&    desc,
+    LLGL::Buffer*                                   srcBuffer       = nullptr
+) override final;
+
+virtual void DispatchRays(
+    std::uint32_t   width,
+    std::uint32_t   height,
+    std::uint32_t   depth
+) override final;
+
+
+
+// ================================================================================
@@ -16,6 +16,7 @@
 #include <LLGL/Backend/CommandBuffer.StreamOutput.inl>
 #include <LLGL/Backend/CommandBuffer.Drawing.inl>
 #include <LLGL/Backend/CommandBuffer.Compute.inl>
+#include <LLGL/Backend/CommandBuffer.RayTracing.inl>
 #include <LLGL/Backend/CommandBuffer.Debugging.inl>
 #include <LLGL/Backend/CommandBuffer.Extensions.inl>
 
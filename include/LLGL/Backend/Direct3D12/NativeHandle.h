@@ -133,6 +133,22 @@ struct ResourceNativeHandle
     };
 };
 
+/**
+\brief Native handle structure for a Direct3D 12 fence.
+\see Fence::GetNativeHandle
+*/
+struct FenceNativeHandle
+{
+    /**
+    \brief COM pointer to the native Direct3D 12 fence.
+    \remarks The reference counter is incremented and must be released by the client programmer after use.
+    */
+    ID3D12Fence*    fence;
+
+    //! Value the fence will have once the last submission via CommandQueue::Submit(Fence&) has been completed by the GPU.
+    UINT64          value;
+};
+
 
 } // /namespace Direct3D12
 
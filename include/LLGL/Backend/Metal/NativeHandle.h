@@ -72,6 +72,20 @@ struct CommandBufferNativeHandle
     #else
     void*                       renderPassDesc;
     #endif
+
+    /**
+    \brief Specifies the native MTLIndirectCommandBuffer the draw commands have been baked into.
+    \remarks This is only non-null for multi-submit command buffers that were created with the CommandBufferFlags::BakeDrawCommands flag
+    and is invalidated when the command buffer is encoded again. The baked draw commands are stored in the order they were encoded,
+    so GPU culling shaders can reset or rewrite individual draw commands before the command buffer is submitted.
+    All baked commands inherit the PSO and buffers from the render command encoder.
+    \see CommandBufferFlags::BakeDrawCommands
+    */
+    #ifdef __OBJC__
+    id<MTLIndirectCommandBuffer> indirectCommandBuffer;
+    #else
+    void*                       indirectCommandBuffer;
+    #endif
 };
 
 /**
@@ -12,6 +12,12 @@ virtual LLGL::Buffer* CreateBuffer(
     const void*                     initialData = nullptr
 ) override final;
 
+virtual void CreateBuffers(
+    const LLGL::ArrayView<LLGL::BufferDescriptor>&  bufferDescs,
+    const void* const*                              initialData,
+    LLGL::Buffer**                                  outBuffers
+) override final;
+
 virtual LLGL::BufferArray* CreateBufferArray(
     std::uint32_t                   numBuffers,
     LLGL::Buffer* const *           bufferArray
@@ -21,6 +27,10 @@ virtual void Release(
     LLGL::Buffer&                   buffer
 ) override final;
 
+virtual void Release(
+    const LLGL::ArrayView<LLGL::Buffer*>&           buffers
+) override final;
+
 virtual void Release(
     LLGL::BufferArray&              bufferArray
 ) override final;
@@ -12,6 +12,16 @@ virtual bool QueryRendererDetails(
     LLGL::RenderingCapabilities*    outCaps)
 override final;
 
+virtual std::uint32_t QueryMemoryHeapInfos(
+    LLGL::MemoryHeapInfo*           outHeapInfos,
+    std::uint32_t                   maxHeapInfos)
+override final;
+
+virtual std::uint32_t QueryAdapterInfos(
+    LLGL::AdapterInfo*              outAdapters,
+    std::uint32_t                   maxAdapters)
+override final;
+
 
 
 // ================================================================================
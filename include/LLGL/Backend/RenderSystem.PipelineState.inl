@@ -17,6 +17,23 @@ virtual LLGL::PipelineState* CreatePipelineState(
     LLGL::PipelineCache*                    pipelineCache       = nullptr
 ) override final;
 
+virtual LLGL::PipelineState* CreatePipelineState(
+    const LLGL::RayTracingPipelineDescriptor&   pipelineStateDesc,
+    LLGL::PipelineCache*                        pipelineCache   = nullptr
+) override final;
+
+virtual void CreatePipelineStates(
+    const LLGL::ArrayView<LLGL::GraphicsPipelineDescriptor>&    pipelineStateDescs,
+    LLGL::PipelineState**                                       outPipelineStates,
+    LLGL::PipelineCache*                                        pipelineCache       = nullptr
+) override final;
+
+virtual void CreatePipelineStates(
+    const LLGL::ArrayView<LLGL::ComputePipelineDescriptor>&     pipelineStateDescs,
+    LLGL::PipelineState**                                       outPipelineStates,
+    LLGL::PipelineCache*                                        pipelineCache       = nullptr
+) override final;
+
 virtual void Release(
     LLGL::PipelineState&                    pipelineState
 ) override final;
@@ -11,6 +11,11 @@ virtual LLGL::Shader* CreateShader(
     const LLGL::ShaderDescriptor&   shaderDesc
 ) override final;
 
+virtual void CreateShaders(
+    const LLGL::ArrayView<LLGL::ShaderDescriptor>&  shaderDescs,
+    LLGL::Shader**                                  outShaders
+) override final;
+
 virtual void Release(
     LLGL::Shader&                   shader
 ) override final;
@@ -12,10 +12,20 @@ virtual LLGL::Texture* CreateTexture(
     const LLGL::ImageView*          initialImage    = nullptr
 ) override final;
 
+virtual void CreateTextures(
+    const LLGL::ArrayView<LLGL::TextureDescriptor>& textureDescs,
+    const LLGL::ImageView*                          initialImages,
+    LLGL::Texture**                                 outTextures
+) override final;
+
 virtual void Release(
     LLGL::Texture&                  texture
 ) override final;
 
+virtual void Release(
+    const LLGL::ArrayView<LLGL::Texture*>&          textures
+) override final;
+
 virtual void WriteTexture(
     LLGL::Texture&                  texture,
     const LLGL::TextureRegion&      textureRegion,
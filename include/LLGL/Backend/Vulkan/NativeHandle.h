@@ -131,6 +131,22 @@ struct ResourceNativeHandle
     };
 };
 
+/**
+\brief Native handle structure for a Vulkan fence.
+\see Fence::GetNativeHandle
+*/
+struct FenceNativeHandle
+{
+    //! Native Vulkan VkFence object. This is VK_NULL_HANDLE if the fence is backed by a timeline semaphore.
+    VkFence         fence;
+
+    //! Native Vulkan timeline semaphore. This is VK_NULL_HANDLE if the fence is backed by a binary VkFence.
+    VkSemaphore     semaphore;
+
+    //! Value the timeline semaphore will have once the last submission via CommandQueue::Submit(Fence&) has been completed by the GPU. This is zero for binary fences.
+    std::uint64_t   value;
+};
+
 
 } // /namespace Vulkan
 
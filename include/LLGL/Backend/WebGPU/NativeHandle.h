@@ -0,0 +1,107 @@
+/*
+ * NativeHandle.h (WebGPU)
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_NATIVE_HANDLE_H
+#define LLGL_WEBGPU_NATIVE_HANDLE_H
+
+
+#include <webgpu/webgpu.h>
+
+
+namespace LLGL
+{
+
+namespace WebGPU
+{
+
+
+/**
+\brief Native handle structure for the WebGPU render system.
+\remarks If this is passed to RenderSystemDescriptor::nativeHandle, the render system will use the specified device instead of
+the device that was pre-initialized by the JavaScript host (see \c Module.preinitializedWebGPUDevice in Emscripten).
+\see RenderSystem::GetNativeHandle
+\see RenderSystemDescriptor::nativeHandle
+*/
+struct RenderSystemNativeHandle
+{
+    WGPUDevice device;
+};
+
+/**
+\brief Native handle structure for the WebGPU command buffer.
+\see CommandBuffer::GetNativeHandle
+*/
+struct CommandBufferNativeHandle
+{
+    //! Specifies the native WGPUCommandEncoder that is currently used. This is null outside of a Begin/End block.
+    WGPUCommandEncoder      commandEncoder;
+
+    //! Specifies the native WGPURenderPassEncoder that is currently bound or null if no render pass is active.
+    WGPURenderPassEncoder   renderPassEncoder;
+
+    //! Specifies the native WGPUComputePassEncoder that is currently bound or null if no compute pass is active.
+    WGPUComputePassEncoder  computePassEncoder;
+};
+
+/**
+\brief Native WebGPU resource type enumeration.
+\see ResourceNativeHandle::type
+*/
+enum class ResourceNativeType
+{
+    /**
+    \brief Native WebGPU WGPUBuffer resource.
+    \remarks ResourceNativeHandle::buffer.
+    */
+    Buffer,
+
+    /**
+    \brief Native WebGPU WGPUTexture resource.
+    \remarks ResourceNativeHandle::texture.
+    */
+    Texture,
+
+    /**
+    \brief Native WebGPU WGPUSampler resource.
+    \remarks ResourceNativeHandle::sampler.
+    */
+    Sampler,
+};
+
+/**
+\brief Native handle structure for a WebGPU resource.
+\see Resource::GetNativeHandle
+*/
+struct ResourceNativeHandle
+{
+    //! Specifies the native resource type.
+    ResourceNativeType type;
+
+    union
+    {
+        //! Specifies the native WebGPU WGPUBuffer object.
+        WGPUBuffer  buffer;
+
+        //! Specifies the native WebGPU WGPUTexture object.
+        WGPUTexture texture;
+
+        //! Specifies the native WebGPU WGPUSampler object.
+        WGPUSampler sampler;
+    };
+};
+
+
+} // /namespace WebGPU
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -108,6 +108,22 @@ class LLGL_EXPORT Blob : public NonCopyable
         */
         static Blob CreateFromFile(const std::string& filename);
 
+        /**
+        \brief Creates a new Blob instance that maps the specified file into memory instead of reading it.
+        \param[in] filename Specifies the file that is to be mapped.
+        \return New instance of Blob that refers to the read-only file mapping or null if the file could not be opened or is empty.
+        \remarks The file is mapped via the platform layer (i.e. \c mmap on POSIX and \c MapViewOfFile on Win32) and pages are only loaded when they are accessed.
+        On platforms without file mapping, the content is read into memory once just like with CreateFromFile.
+        \remarks This avoids an intermediate copy when the file content is passed on directly,
+        e.g. as ImageView::data to RenderSystem::CreateTexture or RenderSystem::WriteTexture when the file layout already matches the texture format,
+        in which case the data is copied from the mapping straight into the upload memory of the renderer.
+        \remarks The content of the blob is undefined if the file is modified while it is mapped.
+        */
+        static Blob CreateFromMappedFile(const char* filename);
+
+        //! \see CreateFromMappedFile(const char*)
+        static Blob CreateFromMappedFile(const std::string& filename);
+
     public:
 
         //! Returns a constant pointer to the internal buffer or null if this is a default initialized blob.
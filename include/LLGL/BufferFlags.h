@@ -22,6 +22,48 @@ namespace LLGL
 {
 
 
+class Buffer;
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Ray tracing acceleration structure type enumeration.
+\see AccelerationStructureDescriptor::type
+*/
+enum class AccelerationStructureType
+{
+    BottomLevel,    //!< Bottom-level acceleration structure (BLAS) that contains triangle geometry.
+    TopLevel,       //!< Top-level acceleration structure (TLAS) that contains instances of bottom-level acceleration structures.
+};
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Ray tracing acceleration structure build flags enumeration.
+\see AccelerationStructureDescriptor::flags
+*/
+struct AccelerationStructureFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the acceleration structure can be updated (also referred to as "refit") after it has been built.
+        \remarks An update only changes vertex positions or instance transformations, but not the number of geometries, primitives, or instances.
+        \see CommandBuffer::BuildAccelerationStructure
+        */
+        AllowUpdate     = (1 << 0),
+
+        //! Hint to the renderer to prefer a faster ray traversal over a faster build. This cannot be used together with PreferFastBuild.
+        PreferFastTrace = (1 << 1),
+
+        //! Hint to the renderer to prefer a faster build over a faster ray traversal. This cannot be used together with PreferFastTrace.
+        PreferFastBuild = (1 << 2),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -153,6 +195,143 @@ struct BufferViewDescriptor
     std::uint64_t   size    = LLGL_WHOLE_SIZE;
 };
 
+/**
+\brief Triangle geometry descriptor structure for bottom-level acceleration structures.
+\see AccelerationStructureDescriptor::geometries
+*/
+struct AccelerationStructureGeometryDescriptor
+{
+    /**
+    \brief Specifies the buffer with the vertex positions. This must have been created with the BindFlags::VertexBuffer flag.
+    \remarks This is ignored by RenderSystem::GetAccelerationStructureSizes.
+    */
+    Buffer*         vertexBuffer    = nullptr;
+
+    //! Specifies the offset (in bytes) of the first vertex position within the vertex buffer. By default 0.
+    std::uint64_t   vertexOffset    = 0;
+
+    //! Specifies the stride (in bytes) between two vertex positions. By default 12, i.e. three tightly packed 32-bit floats.
+    std::uint32_t   vertexStride    = 12;
+
+    //! Specifies the number of vertices. By default 0.
+    std::uint32_t   numVertices     = 0;
+
+    //! Specifies the format of the vertex positions. This must be either Format::RGB32Float, Format::RG32Float, Format::RGBA16Float, or Format::RG16Float. By default Format::RGB32Float.
+    Format          vertexFormat    = Format::RGB32Float;
+
+    //! Specifies the format of the indices. This must be either Format::R16UInt or Format::R32UInt. This is ignored if \c indexBuffer is null. By default Format::R32UInt.
+    Format          indexFormat     = Format::R32UInt;
+
+    /**
+    \brief Specifies the optional buffer with the triangle indices. This must have been created with the BindFlags::IndexBuffer flag. By default null.
+    \remarks If this is null, every three consecutive vertices form a triangle.
+    This is ignored by RenderSystem::GetAccelerationStructureSizes except for the distinction whether it is null.
+    */
+    Buffer*         indexBuffer     = nullptr;
+
+    //! Specifies the offset (in bytes) of the first index within the index buffer. By default 0.
+    std::uint64_t   indexOffset     = 0;
+
+    //! Specifies the number of indices. This must be a multiple of 3. This is ignored if \c indexBuffer is null. By default 0.
+    std::uint32_t   numIndices      = 0;
+
+    //! Specifies whether the geometry is opaque, i.e. any-hit shaders are not invoked for it. By default true.
+    bool            opaque          = true;
+};
+
+/**
+\brief Instance descriptor structure for top-level acceleration structures.
+\see AccelerationStructureDescriptor::instances
+*/
+struct AccelerationStructureInstance
+{
+    /**
+    \brief Specifies the bottom-level acceleration structure this instance refers to.
+    \remarks This must be a buffer with the BindFlags::AccelerationStructure flag that has been built as AccelerationStructureType::BottomLevel.
+    This is ignored by RenderSystem::GetAccelerationStructureSizes.
+    */
+    Buffer*         accelerationStructure   = nullptr;
+
+    //! Specifies the row-major 3x4 matrix that transforms the bottom-level acceleration structure into world space. By default the identity matrix.
+    float           transform[12]           = { 1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,  0.0f, 0.0f, 1.0f, 0.0f };
+
+    //! Specifies the user defined ID of this instance (\c InstanceID in HLSL). Only the lower 24 bits are used. By default 0.
+    std::uint32_t   instanceID              = 0;
+
+    //! Specifies the visibility mask of this instance that is compared to the \c InstanceInclusionMask argument of \c TraceRay. Only the lower 8 bits are used. By default 0xFF.
+    std::uint32_t   mask                    = 0xFF;
+
+    //! Specifies the offset into RayTracingPipelineDescriptor::hitGroups for the geometries of this instance. Only the lower 24 bits are used. By default 0.
+    std::uint32_t   hitGroupOffset          = 0;
+};
+
+/**
+\brief Ray tracing acceleration structure descriptor structure.
+\remarks This describes the content of an acceleration structure for CommandBuffer::BuildAccelerationStructure and RenderSystem::GetAccelerationStructureSizes.
+\see RenderingFeatures::hasRayTracing
+*/
+struct AccelerationStructureDescriptor
+{
+    //! Specifies the acceleration structure type. By default AccelerationStructureType::BottomLevel.
+    AccelerationStructureType                           type        = AccelerationStructureType::BottomLevel;
+
+    /**
+    \brief Specifies the build flags. This can be a bitwise OR combination of the AccelerationStructureFlags entries. By default 0.
+    \remarks These flags must be the same for the size query and every build or update of the same acceleration structure.
+    \see AccelerationStructureFlags
+    */
+    long                                                flags       = 0;
+
+    //! Specifies the triangle geometries of a bottom-level acceleration structure. This is ignored for top-level acceleration structures.
+    ArrayView<AccelerationStructureGeometryDescriptor>  geometries;
+
+    //! Specifies the instances of a top-level acceleration structure. This is ignored for bottom-level acceleration structures.
+    ArrayView<AccelerationStructureInstance>            instances;
+};
+
+/**
+\brief Buffer sizes that are required to build an acceleration structure.
+\see RenderSystem::GetAccelerationStructureSizes
+*/
+struct AccelerationStructureSizes
+{
+    //! Specifies the minimum size (in bytes) of the buffer with the BindFlags::AccelerationStructure flag.
+    std::uint64_t   accelerationStructureSize   = 0;
+
+    //! Specifies the minimum size (in bytes) of the scratch buffer to build the acceleration structure.
+    std::uint64_t   buildScratchSize            = 0;
+
+    //! Specifies the minimum size (in bytes) of the scratch buffer to update the acceleration structure. This is zero if AccelerationStructureFlags::AllowUpdate was not specified.
+    std::uint64_t   updateScratchSize           = 0;
+};
+
+/**
+\brief Buffer copy region structure: Destination offset, source offset, and size of a single region to copy between two buffers.
+\see CommandBuffer::CopyBufferRegions
+*/
+struct BufferCopyRegion
+{
+    BufferCopyRegion() = default;
+    BufferCopyRegion(const BufferCopyRegion&) = default;
+
+    //! Constructor to initialize all members.
+    inline BufferCopyRegion(std::uint64_t dstOffset, std::uint64_t srcOffset, std::uint64_t size) :
+        dstOffset { dstOffset },
+        srcOffset { srcOffset },
+        size      { size      }
+    {
+    }
+
+    //! Specifies the destination offset (in bytes) at which the destination buffer is to be updated.
+    std::uint64_t   dstOffset   = 0;
+
+    //! Specifies the source offset (in bytes) at which the source buffer is to be read from.
+    std::uint64_t   srcOffset   = 0;
+
+    //! Specifies the size (in bytes) of the buffer region to copy.
+    std::uint64_t   size        = 0;
+};
+
 
 /* ----- Functions ----- */
 
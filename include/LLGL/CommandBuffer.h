@@ -81,6 +81,9 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         \remarks This function can only be used by primary command buffers, i.e. command buffers that have \e not been created with the flag CommandBufferFlags::Secondary.
         \remarks Once this command buffer is submitted for execution to one or more primary command buffers,
         it <b>must not</b> be updated unless all of such primary command buffers are also updated before their next submission to the command queue.
+        \remarks On Metal, consecutive secondary command buffers that are executed inside the same render pass are encoded on multiple threads
+        into the sub-encoders of a single \c MTLParallelRenderCommandEncoder, as long as they only contain render commands (no compute, blit, or tessellation commands).
+        Such secondary command buffers do not inherit the render states of their primary command buffer.
         \see CommandBufferFlags
         \todo Incomplete for: D3D12, Vulkan, Metal.
         */
@@ -112,6 +115,43 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             std::uint16_t   dataSize
         ) = 0;
 
+        /**
+        \brief Allocates a range of transient buffer memory that can be written by the CPU and bound as vertex, index, or constant buffer.
+
+        \param[in] size Specifies the size (in bytes) of the allocation. This \b must not be zero.
+
+        \param[in] bindFlags Specifies how the allocation will be bound. This can be a bitwise OR combination of
+        BindFlags::VertexBuffer, BindFlags::IndexBuffer, and BindFlags::ConstantBuffer.
+        If this contains BindFlags::ConstantBuffer, the offset is a multiple of RenderingLimits::minConstantBufferAlignment.
+        Index data must be bound with the SetIndexBuffer overload that takes the index format and offset.
+
+        \param[in] alignment Specifies an optional alignment (in bytes) for the offset of the allocation. By default 0.
+        For vertex data, this \b must be the vertex stride, since the returned buffer has no vertex format and some backends derive the stride from this value.
+        This also guarantees that <code>offset / stride</code> can be used as first vertex in a draw command.
+
+        \return Allocation with a buffer object, an offset into that buffer, and a CPU pointer the application can write its data into.
+        If the backend does not support transient buffers (see RenderingFeatures::hasTransientBuffers) or the allocation failed, the returned buffer is null.
+
+        \remarks Transient memory is owned by this command buffer and it is recycled automatically once the GPU has finished the submission it was allocated for.
+        Therefore, the allocation is only valid until this command buffer is encoded again with the same native command buffer (see CommandBufferDescriptor::numNativeBuffers).
+        The data must be written before the command buffer is submitted and the buffer object must not be released by the application.
+        This is intended for dynamic geometry and constants that change every frame, such as particles, debug lines, and text,
+        which can then be written in place without creating buffer objects or copying the data with UpdateBuffer.
+        \remarks Here is a code example how to use it:
+        \code
+        LLGL::TransientBufferAllocation vertices = cmdBuffer->AllocTransientBuffer(numVertices * sizeof(Vertex), LLGL::BindFlags::VertexBuffer, sizeof(Vertex));
+        if (vertices.buffer != nullptr)
+        {
+            ::memcpy(vertices.data, myVertices, numVertices * sizeof(Vertex));
+            cmdBuffer->SetVertexBuffer(*vertices.buffer);
+            cmdBuffer->Draw(numVertices, static_cast<std::uint32_t>(vertices.offset / sizeof(Vertex)));
+        }
+        \endcode
+        \see RenderingFeatures::hasTransientBuffers
+        \see SetConstantBufferRange
+        */
+        virtual TransientBufferAllocation AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment = 0);
+
         /**
         \brief Encodes a buffer copy command for the specified buffer region.
 
@@ -138,6 +178,35 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             std::uint64_t   size
         ) = 0;
 
+        /**
+        \brief Encodes a buffer copy command for multiple regions between the same pair of buffers.
+
+        \param[in,out] dstBuffer Specifies the destination buffer whose data is to be updated.
+
+        \param[in] srcBuffer Specifies the source buffer whose data is to be read from.
+
+        \param[in] numRegions Specifies the number of regions to copy.
+
+        \param[in] regions Pointer to an array of \c numRegions buffer copy regions.
+        Each region has the same constraints as the respective parameters of CopyBuffer.
+        Destination regions <b>must not</b> overlap with each other.
+
+        \remarks This is equivalent to calling CopyBuffer for each region, but the backends record all regions as a single native command where possible:
+        - Vulkan: All regions are recorded with a single call to \c vkCmdCopyBuffer.
+        - Direct3D 12: Both buffers are transitioned only once for all regions.
+        - Metal: All regions are encoded into the same blit command encoder.
+        - All other backends encode one copy command per region.
+
+        \see CopyBuffer
+        \see BufferCopyRegion
+        */
+        virtual void CopyBufferRegions(
+            Buffer&                 dstBuffer,
+            Buffer&                 srcBuffer,
+            std::uint32_t           numRegions,
+            const BufferCopyRegion* regions
+        );
+
         /**
         \brief Encodes a buffer copy command that blits data from a source texture.
 
@@ -238,6 +307,35 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             const Extent3D&         extent
         ) = 0;
 
+        /**
+        \brief Encodes a texture copy command for multiple regions between the same pair of textures.
+
+        \param[in,out] dstTexture Specifies the destination texture whose data is to be updated.
+
+        \param[in] srcTexture Specifies the source texture whose data is to be read from.
+
+        \param[in] numRegions Specifies the number of regions to copy.
+
+        \param[in] regions Pointer to an array of \c numRegions texture copy regions.
+        Each region has the same constraints as the respective parameters of CopyTexture.
+        Destination regions <b>must not</b> overlap with each other.
+
+        \remarks This is equivalent to calling CopyTexture for each region, but the backends record all regions as a single native command where possible:
+        - Vulkan: All regions are recorded with a single call to \c vkCmdCopyImage.
+        - Direct3D 12: Both textures are transitioned only once for all regions.
+        - Metal: All regions are encoded into the same blit command encoder.
+        - All other backends encode one copy command per region.
+
+        \see CopyTexture
+        \see TextureCopyRegion
+        */
+        virtual void CopyTextureRegions(
+            Texture&                    dstTexture,
+            Texture&                    srcTexture,
+            std::uint32_t               numRegions,
+            const TextureCopyRegion*    regions
+        );
+
         /**
         \brief Encodes a texture copy command that blits data from a source buffer.
 
@@ -352,6 +450,74 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void GenerateMips(Texture& texture, const TextureSubresource& subresource) = 0;
 
+        /**
+        \brief Generates all MIP-maps for each texture in the specified array.
+
+        \param[in] numTextures Specifies the number of textures in the array \c textures.
+
+        \param[in,out] textures Pointer to an array of textures whose MIP-maps are to be generated.
+        Each of these textures must satisfy the same requirements as for GenerateMips(Texture&). Null pointers are ignored.
+
+        \remarks This is equivalent to calling GenerateMips(Texture&) for each texture in the array,
+        but backends can generate the MIP-maps more efficiently as a batch, e.g. when a large number of textures has been streamed in:
+        \code
+        myCmdBuffer->Begin();
+        myCmdBuffer->GenerateMips(static_cast<std::uint32_t>(myStreamedTextures.size()), myStreamedTextures.data());
+        myCmdBuffer->End();
+        \endcode
+        For instance, the Direct3D 12 backend generates the same MIP-map levels of all textures of the same dimension between shared resource barriers
+        and the Vulkan backend blits the same MIP-map level of all textures between shared pipeline barriers.
+
+        \see GenerateMips(Texture&)
+        */
+        virtual void GenerateMips(std::uint32_t numTextures, Texture* const * textures);
+
+        /**
+        \brief Decodes the recorded feedback of a sampler feedback texture into a buffer.
+
+        \param[in] feedbackTexture Specifies the sampler feedback texture whose content is decoded.
+        This must have been created with RenderSystem::CreateSamplerFeedbackTexture.
+
+        \param[in] mipLevel Specifies the MIP-map level of the feedback texture. This must be 0 for SamplerFeedbackType::MinMip.
+
+        \param[in] arrayLayer Specifies the array layer of the feedback texture.
+
+        \param[in] dstBuffer Specifies the destination buffer the decoded feedback is written to.
+        This buffer must have been created with the binding flag BindFlags::CopyDst.
+
+        \param[in] dstOffset Specifies the destination offset (in bytes) at which the decoded feedback is written.
+
+        \remarks The decoded feedback consists of one byte per MIP region, tightly packed in rows.
+        The number of MIP regions in each dimension is determined by GetSamplerFeedbackExtent for the paired texture's first MIP-map level
+        and halved (but at least 1) for each subsequent MIP-map level. MIP-map levels that are entirely covered by a single MIP region are not decoded.
+        The feedback texture is not cleared by this command, see ClearSamplerFeedback.
+        \remarks This command must be encoded outside of a render pass.
+        \remarks If sampler feedback is not supported, this command has no effect.
+        \see RenderSystem::CreateSamplerFeedbackTexture
+        \see RenderingFeatures::hasSamplerFeedback
+        \note Only supported with: Direct3D 12.
+        */
+        virtual void ResolveSamplerFeedback(
+            Texture&        feedbackTexture,
+            std::uint32_t   mipLevel,
+            std::uint32_t   arrayLayer,
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset
+        );
+
+        /**
+        \brief Clears the specified sampler feedback texture, i.e. all MIP regions are marked as not sampled.
+        \param[in] feedbackTexture Specifies the sampler feedback texture that is to be cleared.
+        This must have been created with RenderSystem::CreateSamplerFeedbackTexture.
+        \remarks The content of a sampler feedback texture is undefined after it has been created, so it must be cleared before it is written to for the first time.
+        A typical streaming system decodes the feedback with ResolveSamplerFeedback and then clears it to record the next frame.
+        \remarks This command must be encoded outside of a render pass.
+        \remarks If sampler feedback is not supported, this command has no effect.
+        \see ResolveSamplerFeedback
+        \note Only supported with: Direct3D 12.
+        */
+        virtual void ClearSamplerFeedback(Texture& feedbackTexture);
+
         /* ----- Viewport and Scissor ----- */
 
         /**
@@ -458,6 +624,30 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetResource(std::uint32_t descriptor, Resource& resource) = 0;
 
+        /**
+        \brief Binds a range of the specified constant buffer as root parameter to the respective pipeline.
+        \param[in] descriptor Specifies the zero-based index of the descriptor in the currently bound pipeline layout.
+        This \b must be in the half-open range <code>[0, PipelineLayout::GetNumBindings)</code> and refer to a binding of type ResourceType::Buffer with BindFlags::ConstantBuffer.
+        \param[in] buffer Specifies the constant buffer whose range is to be bound to the shader pipeline. This \b must have been created with the binding flag BindFlags::ConstantBuffer.
+        \param[in] offset Specifies the offset (in bytes) into the buffer where the range begins.
+        This \b must be a multiple of RenderingLimits::minConstantBufferAlignment.
+        \param[in] size Specifies the size (in bytes) of the buffer range. The range <code>[offset, offset + size)</code> \b must be within the buffer size.
+        \remarks This allows a single large buffer to serve the constants of many draw calls by only changing the offset between them,
+        which is cheaper than updating the buffer with UpdateBuffer or binding a separate buffer for each draw call.
+        \remarks Here is a code example how to use it:
+        \code
+        // Bind per-object constants from one large constant buffer
+        for (std::uint64_t i = 0; i < numObjects; ++i)
+        {
+            cmdBuffer->SetConstantBufferRange(0, *objectConstantsBuffer, i * objectConstantsStride, sizeof(ObjectConstants));
+            cmdBuffer->DrawIndexed(numIndices, 0);
+        }
+        \endcode
+        \see SetResource
+        \see RenderingLimits::minConstantBufferAlignment
+        */
+        virtual void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size);
+
         /**
         \brief Inserts a resource memory barrier for the specified resources.
 
@@ -491,10 +681,17 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         cmdBuffer->Dispatch(32, 1, 1);
         \endcode
 
+        \remarks On Vulkan, resource barriers are accumulated and flushed lazily right before the next draw, compute, or blit command,
+        so several consecutive barriers only result in a single pipeline barrier.
+
+        \remarks On Metal, only resources that were created with MiscFlags::Untracked are affected by this function,
+        since Metal tracks the hazards of all other resources automatically.
+
         \see PipelineLayoutDescriptor::barrierFlags
+        \see BeginResourceBarrier
+        \see MiscFlags::Untracked
 
-        \note Only supported with: Direct3D 12, Direct3D 11, OpenGL.
-        \todo Added support for Vulkan and Metal.
+        \note Only supported with: Direct3D 12, Direct3D 11, OpenGL, Vulkan, Metal.
         */
         virtual void ResourceBarrier(
             std::uint32_t       numBuffers,
@@ -503,6 +700,73 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
             Texture* const *    textures
         ) = 0;
 
+        /**
+        \brief Begins a split resource memory barrier for the specified resources.
+
+        \param[in] numBuffers Specifies the number of buffer resources. See ResourceBarrier for details.
+        \param[in] buffers Array to the buffer resources. See ResourceBarrier for details.
+        \param[in] numTextures Specifies the number of texture resources. See ResourceBarrier for details.
+        \param[in] textures Array to the texture resources. See ResourceBarrier for details.
+
+        \remarks A split barrier separates the point where all prior writes to the resources are made available (BeginResourceBarrier)
+        from the point where subsequent commands need to access them (EndResourceBarrier).
+        Commands that are recorded in between can overlap with the memory transition.
+        Each call to BeginResourceBarrier \b must be followed by a call to EndResourceBarrier with the same resources before the end of command recording;
+        The resources \b must not be accessed by any commands in between. Split barriers cannot be nested.
+
+        \remarks Here is a code example how to use them:
+        \code
+        // Write results to storageBufferA and start its memory transition right away
+        cmdBuffer->SetResource(0, *storageBufferA);
+        cmdBuffer->Dispatch(32, 1, 1);
+        cmdBuffer->BeginResourceBarrier(1, &storageBufferA, 0, nullptr);
+
+        // Dispatch independent work that does not access storageBufferA
+        cmdBuffer->SetResource(0, *storageBufferB);
+        cmdBuffer->Dispatch(32, 1, 1);
+
+        // Complete the transition before storageBufferA is read again
+        cmdBuffer->EndResourceBarrier(1, &storageBufferA, 0, nullptr);
+        \endcode
+
+        \remarks This must be called outside a render pass.
+        Backends without native split barriers ignore this call and insert a regular resource barrier with EndResourceBarrier instead.
+
+        \see EndResourceBarrier
+        \see ResourceBarrier
+        */
+        virtual void BeginResourceBarrier(
+            std::uint32_t       numBuffers,
+            Buffer* const *     buffers,
+            std::uint32_t       numTextures,
+            Texture* const *    textures
+        );
+
+        /**
+        \brief Ends a split resource memory barrier that was started with BeginResourceBarrier with the same resources.
+        \remarks This must be called outside a render pass.
+        \see BeginResourceBarrier
+        */
+        virtual void EndResourceBarrier(
+            std::uint32_t       numBuffers,
+            Buffer* const *     buffers,
+            std::uint32_t       numTextures,
+            Texture* const *    textures
+        );
+
+        /**
+        \brief Inserts an aliasing barrier that switches the shared memory of placed textures from one texture to another.
+        \param[in] textureBefore Optional pointer to the texture that was using the memory before. If this is null, any texture that overlaps with \c textureAfter may have used the memory before.
+        \param[in] textureAfter Optional pointer to the texture that is going to use the memory after this barrier. If this is null, the memory is only made available for the next placed texture.
+        \remarks Both textures, if non-null, \b must have been created with RenderSystem::CreatePlacedTexture and must share the same placement heap.
+        The content of \c textureAfter is undefined after this barrier, so it must be fully cleared or overwritten before it is read.
+        \remarks This must be called outside a render pass.
+        \see RenderSystem::CreatePlacedTexture
+        \see RenderingFeatures::hasPlacementHeaps
+        \note Only supported with: Vulkan, Direct3D 12, Metal.
+        */
+        virtual void AliasingBarrier(Texture* textureBefore, Texture* textureAfter);
+
         //! \deprecated Since 0.04b; No need to reset resource slots manually anymore!
         LLGL_DEPRECATED("CommandBuffer::ResetResourceSlots is deprecated since 0.04b; No need to reset resource slots manually anymore!")
         virtual void ResetResourceSlots(
@@ -699,6 +963,18 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void SetStencilReference(std::uint32_t reference, const StencilFace stencilFace = StencilFace::FrontAndBack) = 0;
 
+        /**
+        \brief Sets the fragment shading rate for subsequent draw commands.
+        \param[in] rate Specifies the size of the coarse fragments that are shaded with a single fragment shader invocation. The default value is ShadingRate::Rate1x1.
+        \remarks If the bound render target has a shading-rate attachment, the coarser rate of this per-draw rate and the rate from that attachment is used for each tile.
+        \remarks The shading rate is reset to ShadingRate::Rate1x1 at the beginning of each command buffer.
+        \remarks This must only be used if the rendering feature \c hasVariableRateShading is supported.
+        \note Only supported with: Direct3D 12, Vulkan.
+        \see RenderingFeatures::hasVariableRateShading
+        \see RenderTargetDescriptor::shadingRateAttachment
+        */
+        virtual void SetShadingRate(const ShadingRate rate) = 0;
+
         /**
         \brief Sets the value of a certain number of shader uniforms (aka. push constant/ shader constants) in the currently bound PSO.
 
@@ -745,6 +1021,38 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void EndQuery(QueryHeap& queryHeap, std::uint32_t query = 0) = 0;
 
+        /**
+        \brief Encodes a command to copy the results of a range of queries into a buffer on the GPU.
+
+        \param[in] srcQueryHeap Specifies the query heap whose results are to be copied.
+        Query heaps of type QueryType::TimeElapsed are not supported, use two queries of type QueryType::Timestamp instead.
+
+        \param[in] firstQuery Specifies the zero-based index of the first query within the heap.
+        This plus the number of queries (i.e. <code>firstQuery + numQueries</code>) must be less than or equal to QueryHeapDescriptor::numQueries.
+
+        \param[in] numQueries Specifies the number of queries whose results are to be copied.
+
+        \param[in,out] dstBuffer Specifies the destination buffer the results are written to.
+        This buffer must have been created with the binding flag BindFlags::CopyDst.
+
+        \param[in] dstOffset Specifies the destination offset (in bytes) at which the results are written. This must be a multiple of 8.
+
+        \remarks Each result is written as 64-bit unsigned integer, or as QueryPipelineStatistics structure for queries of type QueryType::PipelineStatistics.
+        The GPU waits until the results are available, so the queries must have been ended before in the same or a previously submitted command buffer.
+        In contrast to CommandQueue::QueryResult, timestamps are written in native GPU ticks and are not converted into nanoseconds.
+        \remarks This command must be encoded outside of a render pass.
+        This allows occlusion and timing results to be consumed on the GPU or read back asynchronously without stalling the CPU.
+        \see RenderingFeatures::hasQueryResolve
+        \see CommandQueue::QueryResult
+        */
+        virtual void ResolveQueryData(
+            QueryHeap&      srcQueryHeap,
+            std::uint32_t   firstQuery,
+            std::uint32_t   numQueries,
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset
+        ) = 0;
+
         /**
         \brief Begins conditional rendering with the specified query object.
 
@@ -951,6 +1259,60 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride) = 0;
 
+        /**
+        \brief Draws an unknown amount of instances of primitives whose draw command arguments and number of draw commands are taken from buffer objects.
+
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of draw commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands that are to be taken from the argument buffer.
+        The actual number of draw commands is the minimum of this value and the value from the count buffer.
+        \param[in] stride Specifies the stride (in bytes) between consecutive sets of arguments,
+        which is commonly greater than or equal to <code>sizeof(DrawIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \remarks This allows the GPU to determine the number of draw commands, e.g. after a compute shader has culled the draw commands,
+        without reading back the number of commands to the CPU.
+
+        \see DrawIndirectArguments
+        \see RenderingFeatures::hasIndirectCountDrawing
+        */
+        virtual void DrawIndirectCount(
+            Buffer&         buffer,
+            std::uint64_t   offset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Draws an unknown amount of instances of primitives whose indexed draw command arguments and number of draw commands are taken from buffer objects.
+
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Specifies the buffer from which the number of draw commands is taken as 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of draw commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of draw commands that are to be taken from the argument buffer.
+        The actual number of draw commands is the minimum of this value and the value from the count buffer.
+        \param[in] stride Specifies the stride (in bytes) between consecutive sets of arguments,
+        which is commonly greater than or equal to <code>sizeof(DrawIndexedIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \see DrawIndexedIndirectArguments
+        \see DrawIndirectCount
+        \see RenderingFeatures::hasIndirectCountDrawing
+        */
+        virtual void DrawIndexedIndirectCount(
+            Buffer&         buffer,
+            std::uint64_t   offset,
+            Buffer&         countBuffer,
+            std::uint64_t   countOffset,
+            std::uint32_t   maxNumCommands,
+            std::uint32_t   stride
+        ) = 0;
+
         /**
         \brief Performs an automatic draw command whose number of primitives is provided by a stream-output buffer that is bound to the input assembler stage.
 
@@ -959,10 +1321,126 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
 
         \remarks This can be used to pre-transform vertices and render the output later one or multiple times.
 
+        \remarks Alternatively, the vertex buffer can be created with BindFlags::ComputeStreamOutput instead of BindFlags::StreamOutputBuffer
+        and bound with SetVertexBuffer. In that case, this command is equivalent to DrawIndirect with the draw arguments that are stored at the end of that buffer.
+        This does not require RenderingFeatures::hasStreamOutputs.
+
         \see RenderingFeatures::hasStreamOutputs
+        \see BindFlags::ComputeStreamOutput
         */
         virtual void DrawStreamOutput() = 0;
 
+        /**
+        \brief Draws primitives that are generated by the task and mesh shaders of the current mesh pipeline.
+
+        \param[in] numWorkGroupsX Specifies the number of task work groups in the X-dimension, or mesh work groups if the pipeline has no task shader.
+        \param[in] numWorkGroupsY Specifies the number of task work groups in the Y-dimension, or mesh work groups if the pipeline has no task shader.
+        \param[in] numWorkGroupsZ Specifies the number of task work groups in the Z-dimension, or mesh work groups if the pipeline has no task shader.
+
+        \remarks The current graphics pipeline must have been created with a mesh shader (see GraphicsPipelineDescriptor::meshShader).
+        No vertex or index buffers are used by this command.
+
+        \see RenderingFeatures::hasMeshShaders
+        */
+        virtual void DrawMeshTasks(
+            std::uint32_t   numWorkGroupsX,
+            std::uint32_t   numWorkGroupsY,
+            std::uint32_t   numWorkGroupsZ
+        ) = 0;
+
+        /**
+        \brief Draws primitives that are generated by the task and mesh shaders of the current mesh pipeline with arguments taken from a buffer object.
+
+        \param[in] buffer Specifies the buffer from which the draw command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] numCommands Specifies the number of draw commands that are to be taken from the argument buffer.
+        \param[in] stride Specifies the stride (in bytes) between consecutive sets of arguments,
+        which is commonly greater than or equal to <code>sizeof(DrawMeshTasksIndirectArguments)</code>. This stride must be a multiple of 4.
+
+        \see DrawMeshTasksIndirectArguments
+        \see DrawMeshTasks
+        \see RenderingFeatures::hasMeshShaders
+        */
+        virtual void DrawMeshTasksIndirect(
+            Buffer&         buffer,
+            std::uint64_t   offset,
+            std::uint32_t   numCommands,
+            std::uint32_t   stride
+        ) = 0;
+
+        /**
+        \brief Dispatches the tile shader of the current tile pipeline for each tile of the current render pass.
+
+        \remarks The current graphics pipeline must have been created with a tile shader (see GraphicsPipelineDescriptor::tileShader).
+        The number of threads per tile is specified by ComputeShaderAttributes::workGroupSize of the tile shader and must not exceed the tile size of the render pass.
+        This command can only be used inside a render pass. All draw commands before this command have finished writing to tile memory when the tile shader is executed,
+        and all draw commands after this command see the results of the tile shader.
+
+        \see RenderingFeatures::hasTileShaders
+        \note Only supported with: Metal.
+        */
+        virtual void DispatchTiles() = 0;
+
+        /**
+        \brief Executes multiple draw or dispatch commands whose arguments and uniform changes are taken from a buffer object.
+
+        \param[in] commandDesc Specifies the layout of each command within the argument buffer.
+        \param[in] buffer Specifies the buffer from which the command arguments are taken. This buffer must have been created with the BindFlags::IndirectBuffer binding flag.
+        \param[in] offset Specifies an offset within the argument buffer from which the arguments are to be taken. This offset must be a multiple of 4.
+        \param[in] countBuffer Optional pointer to a buffer from which the number of commands is taken as 32-bit unsigned integer.
+        This buffer must have been created with the BindFlags::IndirectBuffer binding flag. If this is null, \c maxNumCommands commands are executed.
+        \param[in] countOffset Specifies an offset within the count buffer from which the number of commands is to be taken. This offset must be a multiple of 4.
+        \param[in] maxNumCommands Specifies the maximum number of commands that are to be taken from the argument buffer.
+
+        \remarks This allows the GPU to switch per-draw uniforms, e.g. material indices, between consecutive indirect draw commands without returning to the CPU.
+        The uniforms that are changed by this command have undefined values afterwards and must be set again with SetUniforms before they are used by subsequent commands.
+
+        \see IndirectCommandDescriptor
+        \see RenderingFeatures::hasIndirectStateChanges
+        */
+        virtual void ExecuteIndirect(
+            const IndirectCommandDescriptor&    commandDesc,
+            Buffer&                             buffer,
+            std::uint64_t                       offset,
+            Buffer*                             countBuffer,
+            std::uint64_t                       countOffset,
+            std::uint32_t                       maxNumCommands
+        ) = 0;
+
+        /**
+        \brief Encodes a sequence of draw commands and the state changes between them in a single call.
+        \param[in] drawDesc Specifies the draw records and the bindings they refer to.
+        For each record, the vertex buffer, index buffer, resource heap, and uniforms are set first (unless the record leaves them unchanged),
+        then the draw command is encoded with the record's draw arguments.
+        \remarks This is equivalent to calling SetVertexBuffer, SetIndexBuffer, SetResourceHeap, SetUniforms, and DrawInstanced or DrawIndexedInstanced for each record,
+        but bindings that are equal to those of the previous record are skipped and the backend encodes all records in one loop.
+        This avoids the dispatch overhead of several virtual function calls per draw command when encoding a large number of small draw commands.
+        \remarks Here is a code example how to use it:
+        \code
+        // Draw all objects with their own vertex buffer and descriptor set
+        std::vector<LLGL::DrawRecord> records(numObjects);
+        for (std::uint32_t i = 0; i < numObjects; ++i)
+        {
+            records[i].vertexBuffer     = objects[i].meshIndex;
+            records[i].indexBuffer      = objects[i].meshIndex;
+            records[i].resourceHeap     = 0;
+            records[i].descriptorSet    = i;
+            records[i].numVertices      = objects[i].numIndices;
+        }
+        LLGL::DrawPackedDescriptor drawDesc;
+        {
+            drawDesc.vertexBuffers  = meshBuffers;
+            drawDesc.indexBuffers   = meshBuffers;
+            drawDesc.resourceHeaps  = { &objectHeap, 1 };
+            drawDesc.indexed        = true;
+            drawDesc.records        = records;
+        }
+        cmdBuffer->DrawPacked(drawDesc);
+        \endcode
+        \see DrawPackedDescriptor
+        */
+        virtual void DrawPacked(const DrawPackedDescriptor& drawDesc);
+
         /* ----- Compute ----- */
 
         /**
@@ -983,6 +1461,69 @@ class LLGL_EXPORT CommandBuffer : public RenderSystemChild
         */
         virtual void DispatchIndirect(Buffer& buffer, std::uint64_t offset) = 0;
 
+        /* ----- Ray Tracing ----- */
+
+        /**
+        \brief Builds or updates a ray tracing acceleration structure.
+
+        \param[in] dstBuffer Specifies the buffer that receives the acceleration structure.
+        This buffer must have been created with the BindFlags::AccelerationStructure binding flag and it must be at least as large as AccelerationStructureSizes::accelerationStructureSize.
+        \param[in] scratchBuffer Specifies the intermediate buffer for the build.
+        This buffer must have been created with the BindFlags::Storage binding flag and it must be at least as large as AccelerationStructureSizes::buildScratchSize,
+        or AccelerationStructureSizes::updateScratchSize if \c srcBuffer is non-null. The scratch buffer must not be used by another build until this build has finished.
+        \param[in] desc Specifies the content of the acceleration structure.
+        For bottom-level acceleration structures, the vertex and index buffers are read when this command is executed.
+        For top-level acceleration structures, the instances are copied into the command buffer when this command is encoded.
+        \param[in] srcBuffer Specifies an optional acceleration structure that is updated (also referred to as "refit") into \c dstBuffer instead of building a new one.
+        This must have been built with AccelerationStructureFlags::AllowUpdate and the same number of geometries, primitives, or instances as \c desc.
+        It can be the same buffer as \c dstBuffer to update an acceleration structure in place. By default null.
+
+        \remarks All bottom-level acceleration structures that are referenced by a top-level acceleration structure must have been built before the top-level acceleration structure is built.
+        The command buffer inserts the barriers between consecutive builds as well as between builds and ray dispatches.
+        \remarks Acceleration structures can also be built with command buffers for the compute queue (see CommandBufferDescriptor::queueType),
+        so the builds can overlap with rendering on the graphics queue. Synchronize both queues with a Fence before the acceleration structures are used.
+        \remarks Here is a code example how to build a single triangle mesh:
+        \code
+        LLGL::AccelerationStructureGeometryDescriptor geometryDesc;
+        {
+            geometryDesc.vertexBuffer   = myVertexBuffer;
+            geometryDesc.vertexStride   = sizeof(MyVertex);
+            geometryDesc.numVertices    = myNumVertices;
+        }
+        LLGL::AccelerationStructureDescriptor blasDesc;
+        {
+            blasDesc.type       = LLGL::AccelerationStructureType::BottomLevel;
+            blasDesc.geometries = { &geometryDesc, 1 };
+        }
+        const LLGL::AccelerationStructureSizes blasSizes = myRenderer->GetAccelerationStructureSizes(blasDesc);
+        // Create 'myBLAS' with BindFlags::AccelerationStructure and 'myScratchBuffer' with BindFlags::Storage from 'blasSizes' ...
+        myCmdBuffer->BuildAccelerationStructure(*myBLAS, *myScratchBuffer, blasDesc);
+        \endcode
+
+        \see RenderSystem::GetAccelerationStructureSizes
+        \see RenderingFeatures::hasRayTracing
+        \note Only supported with: Direct3D 12.
+        */
+        virtual void BuildAccelerationStructure(
+            Buffer&                                 dstBuffer,
+            Buffer&                                 scratchBuffer,
+            const AccelerationStructureDescriptor&  desc,
+            Buffer*                                 srcBuffer       = nullptr
+        ) = 0;
+
+        /**
+        \brief Dispatches the ray generation shader of the current ray tracing pipeline.
+        \param[in] width Specifies the number of ray generation shader invocations in the X-dimension (\c DispatchRaysDimensions().x in HLSL).
+        \param[in] height Specifies the number of ray generation shader invocations in the Y-dimension.
+        \param[in] depth Specifies the number of ray generation shader invocations in the Z-dimension.
+        \remarks The current pipeline state must have been created with a RayTracingPipelineDescriptor.
+        This command can only be used outside a render pass. The product of \c width, \c height, and \c depth must not exceed 2^30.
+        \see RenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor&, PipelineCache*)
+        \see RenderingFeatures::hasRayTracing
+        \note Only supported with: Direct3D 12.
+        */
+        virtual void DispatchRays(std::uint32_t width, std::uint32_t height, std::uint32_t depth) = 0;
+
         /* ----- Debugging ----- */
 
         /**
@@ -9,6 +9,9 @@
 #define LLGL_COMMAND_BUFFER_FLAGS_H
 
 
+#include <LLGL/Container/ArrayView.h>
+#include <LLGL/Constants.h>
+#include <LLGL/Format.h>
 #include <cstdint>
 
 
@@ -16,7 +19,10 @@ namespace LLGL
 {
 
 
+class Buffer;
 class RenderPass;
+class RenderSystemChild;
+class ResourceHeap;
 
 /* ----- Enumerations ----- */
 
@@ -60,6 +66,91 @@ enum class StencilFace
     Back,
 };
 
+/**
+\brief Fragment shading rate enumeration.
+\remarks Each value specifies the size (in pixels) of a coarse fragment that is shaded only once, i.e. \c Rate2x2 shades a block of 2x2 pixels with a single fragment shader invocation.
+The texels of a shading-rate attachment encode these sizes as <code>(log2(width) << 2) | log2(height)</code>, e.g. 0 for 1x1, 5 for 2x2, and 10 for 4x4.
+\see CommandBuffer::SetShadingRate
+\see RenderTargetDescriptor::shadingRateAttachment
+*/
+enum class ShadingRate
+{
+    Rate1x1,    //!< Each pixel is shaded individually. This is the default shading rate.
+    Rate1x2,    //!< A coarse fragment covers 1 pixel horizontally and 2 pixels vertically.
+    Rate2x1,    //!< A coarse fragment covers 2 pixels horizontally and 1 pixel vertically.
+    Rate2x2,    //!< A coarse fragment covers 2x2 pixels.
+    Rate2x4,    //!< A coarse fragment covers 2 pixels horizontally and 4 pixels vertically.
+    Rate4x2,    //!< A coarse fragment covers 4 pixels horizontally and 2 pixels vertically.
+    Rate4x4,    //!< A coarse fragment covers 4x4 pixels.
+};
+
+/**
+\brief Command queue type enumeration.
+\remarks Dedicated compute and copy queues can execute command buffers in parallel with the graphics queue.
+Work between queues is synchronized with fences on the GPU timeline (see CommandQueue::SubmitWait).
+\see RenderSystem::GetCommandQueue(CommandQueueType)
+\see CommandBufferDescriptor::queueType
+*/
+enum class CommandQueueType
+{
+    //! Primary queue that supports graphics, compute, and copy commands. This is the queue returned by RenderSystem::GetCommandQueue().
+    Graphics,
+
+    /**
+    \brief Asynchronous queue that supports compute and copy commands.
+    \remarks Command buffers for this queue must not encode render passes, draw commands, or graphics pipeline states.
+    \note Only supported with: Vulkan, Direct3D 12.
+    */
+    Compute,
+
+    /**
+    \brief Asynchronous queue that only supports copy commands, i.e. CommandBuffer::UpdateBuffer, CommandBuffer::CopyBuffer, CommandBuffer::CopyBufferFromTexture, CommandBuffer::CopyTexture, and CommandBuffer::CopyTextureFromBuffer.
+    \note Only supported with: Vulkan, Direct3D 12.
+    */
+    Copy,
+};
+
+
+/**
+\brief Indirect argument type enumeration.
+\remarks Specifies which arguments are taken from the argument buffer for each command of CommandBuffer::ExecuteIndirect.
+\see IndirectArgumentDescriptor::type
+*/
+enum class IndirectArgumentType
+{
+    Draw,           //!< Draw command arguments of type DrawIndirectArguments.
+    DrawIndexed,    //!< Indexed draw command arguments of type DrawIndexedIndirectArguments.
+    DrawMeshTasks,  //!< Mesh tasks draw command arguments of type DrawMeshTasksIndirectArguments.
+    Dispatch,       //!< Dispatch command arguments of type DispatchIndirectArguments.
+
+    /**
+    \brief Uniform values that are updated before the draw or dispatch command. Each uniform is taken as tightly packed 32-bit values, just like with CommandBuffer::SetUniforms.
+    \see IndirectArgumentDescriptor::first
+    \see IndirectArgumentDescriptor::numUniforms
+    */
+    Uniforms,
+};
+
+
+/**
+\brief Command record opcode enumeration.
+\remarks Each opcode lists the arguments it reads from CommandRecord::arg0 to CommandRecord::arg5 in that order.
+Opcodes that operate on an object take it from CommandBatchDescriptor::objects at the index CommandRecord::objectIndex.
+\see CommandRecord::opcode
+*/
+enum class CommandOpcode
+{
+    SetPipelineState,   //!< CommandBuffer::SetPipelineState with the pipeline state object. No arguments.
+    SetVertexBuffer,    //!< CommandBuffer::SetVertexBuffer with the buffer object. No arguments.
+    SetIndexBuffer,     //!< CommandBuffer::SetIndexBuffer with the buffer object. Arguments: index format (Format), offset (in bytes).
+    SetResourceHeap,    //!< CommandBuffer::SetResourceHeap with the resource heap object. Arguments: descriptor set.
+    SetResource,        //!< CommandBuffer::SetResource with the resource object. Arguments: descriptor.
+    SetUniforms,        //!< CommandBuffer::SetUniforms with CommandBatchDescriptor::uniformData. Arguments: first uniform, offset (in bytes) into uniform data, size (in bytes).
+    Draw,               //!< CommandBuffer::DrawInstanced. Arguments: number of vertices, first vertex, number of instances, first instance.
+    DrawIndexed,        //!< CommandBuffer::DrawIndexedInstanced. Arguments: number of indices, first index, number of instances, vertex offset (signed), first instance.
+    Dispatch,           //!< CommandBuffer::Dispatch. Arguments: number of work groups in X, Y, and Z direction.
+};
+
 
 /* ----- Flags ----- */
 
@@ -106,6 +197,18 @@ struct CommandBufferFlags
         \see CommandBuffer::End
         */
         ImmediateSubmit = (1 << 2),
+
+        /**
+        \brief Hints that the draw commands of a multi-submit command buffer are static and can be baked into a native GPU command list when the command buffer is encoded.
+        \remarks This is only considered in combination with the \c MultiSubmit flag and is ignored otherwise.
+        \remarks The Metal backend encodes consecutive draw commands into an indirect command buffer (\c MTLIndirectCommandBuffer) once in CommandBuffer::End,
+        and executes each run of draw commands with a single call every time the command buffer is submitted.
+        This ICB can be retrieved via CommandBuffer::GetNativeHandle so that GPU culling shaders can modify the baked draw commands (see Metal::CommandBufferNativeHandle::indirectCommandBuffer).
+        Draw commands with a tessellation pipeline are never baked.
+        \remarks Other backends ignore this flag.
+        \see CommandBuffer::End
+        */
+        BakeDrawCommands = (1 << 3),
     };
 };
 
@@ -245,6 +348,26 @@ struct AttachmentClear
     ClearValue      clearValue;
 };
 
+/**
+\brief Transient buffer allocation structure.
+\remarks Describes a range of CPU-writable memory inside a buffer object that is owned by the command buffer.
+\see CommandBuffer::AllocTransientBuffer
+*/
+struct TransientBufferAllocation
+{
+    //! Buffer object that contains the allocated range. This is null if the allocation failed.
+    Buffer*         buffer  = nullptr;
+
+    //! Offset (in bytes) of the allocated range within \c buffer.
+    std::uint64_t   offset  = 0;
+
+    //! Size (in bytes) of the allocated range.
+    std::uint64_t   size    = 0;
+
+    //! CPU pointer to the beginning of the allocated range. The application writes its data directly into this memory.
+    void*           data    = nullptr;
+};
+
 /**
 \brief Command buffer descriptor structure.
 \see RenderSystem::CreateCommandBuffer
@@ -300,7 +423,9 @@ struct CommandBufferDescriptor
     \remarks This is only a hint to the framework, since not all rendering APIs support command buffers natively.
     For the D3D12 backend for instance, this will specify the initial buffer size for the staging pool, i.e. for buffer updates during command encoding.
     For command buffers that will make many and large buffer updates, increase this size to fine-tune performance.
+    This is also the minimum chunk size for transient buffer memory.
     \see CommandBuffer::UpdateBuffer
+    \see CommandBuffer::AllocTransientBuffer
     */
     std::uint64_t       minStagingPoolSize  = (0xFFFF + 1);
 
@@ -311,9 +436,190 @@ struct CommandBufferDescriptor
     If this is null, the secondary command buffer must start and end its own render pass section,
     unless the backend does not natively support render passes.
     This field is ignored if \c flags does not include the CommandBufferFlags::Secondary flag.
+    \remarks The secondary command buffer only depends on the attachment formats and number of samples of this render pass, not on the render pass object itself.
+    It can be executed inside any render pass with the same attachment formats and number of samples (load and store operations may differ),
+    and the render pass object can be released after the command buffer has been created.
+    This allows pre-recorded secondary command buffers to be reused across different render passes and render targets without encoding them again.
     \see CommandBufferFlags::Secondary
+    \see CommandBuffer::Execute
     */
     const RenderPass*   renderPass          = nullptr;
+
+    /**
+    \brief Specifies the type of command queue this command buffer will be submitted to. By default CommandQueueType::Graphics.
+    \remarks The command buffer must only be submitted to the command queue returned by RenderSystem::GetCommandQueue(CommandQueueType) for the same type.
+    If the backend has no dedicated queue of this type, the command buffer is created for the primary queue.
+    This field is ignored for secondary command buffers, since they are always executed by a primary command buffer.
+    \see RenderSystem::GetCommandQueue(CommandQueueType)
+    */
+    CommandQueueType    queueType           = CommandQueueType::Graphics;
+};
+
+/**
+\brief Indirect argument descriptor structure.
+\see IndirectCommandDescriptor::arguments
+*/
+struct IndirectArgumentDescriptor
+{
+    //! Specifies the type of this argument. By default IndirectArgumentType::Draw.
+    IndirectArgumentType    type        = IndirectArgumentType::Draw;
+
+    /**
+    \brief Specifies the index of the first uniform that is updated by this argument. By default 0.
+    \remarks This refers to the uniforms of the pipeline layout (see PipelineLayoutDescriptor::uniforms).
+    This is only used if \c type is IndirectArgumentType::Uniforms.
+    */
+    std::uint32_t           first       = 0;
+
+    /**
+    \brief Specifies the number of consecutive uniforms that are updated by this argument. By default 0.
+    \remarks This is only used if \c type is IndirectArgumentType::Uniforms.
+    */
+    std::uint32_t           numUniforms = 0;
+};
+
+/**
+\brief Indirect command descriptor structure.
+\remarks Describes the layout of a single command within the argument buffer of CommandBuffer::ExecuteIndirect.
+The arguments are tightly packed in the specified order and the last argument must be the draw or dispatch command, e.g. uniforms followed by DrawIndexedIndirectArguments.
+\see CommandBuffer::ExecuteIndirect
+*/
+struct IndirectCommandDescriptor
+{
+    //! Specifies the list of arguments of each command. All arguments but the last one must be of type IndirectArgumentType::Uniforms.
+    ArrayView<IndirectArgumentDescriptor>   arguments;
+
+    //! Specifies the stride (in bytes) between consecutive commands. This must be a multiple of 4 and greater than or equal to the size of all arguments.
+    std::uint32_t                           stride      = 0;
+};
+
+/**
+\brief Draw record structure for packed draw commands.
+\remarks Each record refers to its bindings by index into the arrays of DrawPackedDescriptor instead of by object, which keeps the records compact.
+A binding whose index is \c LLGL_INVALID_SLOT is left unchanged from the previous record.
+\see DrawPackedDescriptor::records
+*/
+struct DrawRecord
+{
+    //! Specifies the index into DrawPackedDescriptor::vertexBuffers of the vertex buffer to bind. By default \c LLGL_INVALID_SLOT.
+    std::uint32_t   vertexBuffer    = LLGL_INVALID_SLOT;
+
+    //! Specifies the index into DrawPackedDescriptor::indexBuffers of the index buffer to bind. By default \c LLGL_INVALID_SLOT.
+    std::uint32_t   indexBuffer     = LLGL_INVALID_SLOT;
+
+    //! Specifies the index into DrawPackedDescriptor::resourceHeaps of the resource heap to bind. By default \c LLGL_INVALID_SLOT.
+    std::uint32_t   resourceHeap    = LLGL_INVALID_SLOT;
+
+    //! Specifies the descriptor set of the resource heap to bind. This is ignored if \c resourceHeap is \c LLGL_INVALID_SLOT. By default 0.
+    std::uint32_t   descriptorSet   = 0;
+
+    /**
+    \brief Specifies the offset (in bytes) into DrawPackedDescriptor::uniformData of the uniforms to set. By default \c LLGL_INVALID_SLOT.
+    \remarks The uniforms are set with CommandBuffer::SetUniforms using DrawPackedDescriptor::firstUniform and DrawPackedDescriptor::uniformsSize.
+    */
+    std::uint32_t   uniformsOffset  = LLGL_INVALID_SLOT;
+
+    //! Specifies the number of vertices, or the number of indices if DrawPackedDescriptor::indexed is true. By default 0.
+    std::uint32_t   numVertices     = 0;
+
+    //! Specifies the number of instances. By default 1.
+    std::uint32_t   numInstances    = 1;
+
+    //! Specifies the first vertex, or the first index if DrawPackedDescriptor::indexed is true. By default 0.
+    std::uint32_t   firstVertex     = 0;
+
+    //! Specifies the base vertex offset that is added to each index. This is ignored if DrawPackedDescriptor::indexed is false. By default 0.
+    std::int32_t    vertexOffset    = 0;
+
+    //! Specifies the first instance. By default 0.
+    std::uint32_t   firstInstance   = 0;
+};
+
+/**
+\brief Packed draw command descriptor structure.
+\remarks Describes a sequence of draw commands together with the state changes between them,
+which the command buffer encodes in a single call without the per-command overhead of the individual functions.
+All draw commands use the currently bound PSO.
+\see CommandBuffer::DrawPacked
+*/
+struct DrawPackedDescriptor
+{
+    //! Specifies the vertex buffers the draw records refer to with DrawRecord::vertexBuffer.
+    ArrayView<Buffer*>          vertexBuffers;
+
+    //! Specifies the index buffers the draw records refer to with DrawRecord::indexBuffer.
+    ArrayView<Buffer*>          indexBuffers;
+
+    //! Specifies the format of all index buffers. This must be either Format::R16UInt or Format::R32UInt. By default Format::R32UInt.
+    Format                      indexFormat     = Format::R32UInt;
+
+    //! Specifies the resource heaps the draw records refer to with DrawRecord::resourceHeap.
+    ArrayView<ResourceHeap*>    resourceHeaps;
+
+    //! Specifies the uniform data the draw records refer to with DrawRecord::uniformsOffset. By default null.
+    const void*                 uniformData     = nullptr;
+
+    //! Specifies the index of the first uniform that is set by each draw record. By default 0.
+    std::uint32_t               firstUniform    = 0;
+
+    //! Specifies the size (in bytes) of the uniforms that are set by each draw record. By default 0.
+    std::uint16_t               uniformsSize    = 0;
+
+    //! Specifies whether the draw records are indexed draw commands. By default false.
+    bool                        indexed         = false;
+
+    //! Specifies the draw records in the order they are encoded.
+    ArrayView<DrawRecord>       records;
+};
+
+/**
+\brief Command record structure for batched command encoding.
+\remarks This is a fixed-size record of 32 bytes without any pointers, so arrays of records can be shared across language boundaries without conversion.
+\see CommandBatchDescriptor::records
+*/
+struct CommandRecord
+{
+    //! Specifies the command this record encodes. By default CommandOpcode::Draw.
+    CommandOpcode   opcode      = CommandOpcode::Draw;
+
+    //! Specifies the index into CommandBatchDescriptor::objects of the object the command operates on. This is ignored for opcodes without object. By default \c LLGL_INVALID_SLOT.
+    std::uint32_t   objectIndex = LLGL_INVALID_SLOT;
+
+    //! Specifies the first argument of the command; see CommandOpcode. By default 0.
+    std::uint32_t   arg0        = 0;
+
+    //! Specifies the second argument of the command; see CommandOpcode. By default 0.
+    std::uint32_t   arg1        = 0;
+
+    //! Specifies the third argument of the command; see CommandOpcode. By default 0.
+    std::uint32_t   arg2        = 0;
+
+    //! Specifies the fourth argument of the command; see CommandOpcode. By default 0.
+    std::uint32_t   arg3        = 0;
+
+    //! Specifies the fifth argument of the command; see CommandOpcode. By default 0.
+    std::uint32_t   arg4        = 0;
+
+    //! Specifies the sixth argument of the command; see CommandOpcode. By default 0.
+    std::uint32_t   arg5        = 0;
+};
+
+/**
+\brief Command batch descriptor structure.
+\remarks Describes a sequence of commands that the language bindings encode with a single call across the language boundary, e.g. \c llglExecuteCommandBatch of the C99 wrapper.
+This complements DrawPackedDescriptor by also covering pipeline and compute commands.
+\see CommandRecord
+*/
+struct CommandBatchDescriptor
+{
+    //! Specifies the objects the command records refer to with CommandRecord::objectIndex.
+    ArrayView<RenderSystemChild*>   objects;
+
+    //! Specifies the uniform data the CommandOpcode::SetUniforms records refer to. By default null.
+    const void*                     uniformData = nullptr;
+
+    //! Specifies the command records in the order they are encoded.
+    ArrayView<CommandRecord>        records;
 };
 
 
@@ -51,13 +51,40 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         */
         virtual void Submit(CommandBuffer& commandBuffer) = 0;
 
-        #if 0
         /**
         \brief Submits all command buffers in the specified array to the command queue at once.
+        \param[in] numCommandBuffers Specifies the number of command buffers in the array \c commandBuffers.
+        \param[in] commandBuffers Pointer to an array of command buffers that are to be submitted in the order they appear in the array.
+        Each of these command buffers must satisfy the same requirements as for \c Submit(CommandBuffer&). Null pointers are ignored.
+        \remarks This is equivalent to calling \c Submit(CommandBuffer&) for each command buffer in the array,
+        but backends can submit them more efficiently as a batch.
+        For instance, the OpenGL backend executes all deferred command buffers back to back with a single pass over its state cache.
+        This makes it possible to record command buffers on multiple threads and submit them together on the thread that owns the GL context.
         \see Submit(CommandBuffer&)
         */
         virtual void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers);
-        #endif
+
+        /* ----- Swap-Chains ----- */
+
+        /**
+        \brief Presents the current back buffers of all swap-chains in the specified array at once.
+        \param[in] numSwapChains Specifies the number of swap-chains in the array \c swapChains.
+        \param[in] swapChains Pointer to an array of swap-chains that are to be presented.
+        Each of these swap-chains must have been created by the same render system as this command queue. Null pointers are ignored.
+        Presentations of the same swap-chain are always executed in the order they appear in the array.
+        \remarks This is equivalent to calling SwapChain::Present for each swap-chain in the array,
+        but backends can present them more efficiently as a batch. This is useful for multi-window or multi-viewport applications:
+        \code
+        myCmdQueue->Submit(*myCmdBuffer);
+        LLGL::SwapChain* mySwapChains[] = { myMainSwapChain, myToolSwapChain };
+        myCmdQueue->Present(2, mySwapChains);
+        \endcode
+        For instance, the Vulkan backend presents all swap-chains that share the same presentation queue with a single call to \c vkQueuePresentKHR
+        and the Direct3D 12 backend presents all swap-chains with a single job on its submission thread (see RenderSystemFlags::SubmissionThread).
+        The OpenGL backend presents the swap-chain whose GL context is current first to minimize the number of context switches.
+        \see SwapChain::Present
+        */
+        virtual void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains);
 
         /* ----- Queries ----- */
 
@@ -101,13 +128,58 @@ class LLGL_EXPORT CommandQueue : public RenderSystemChild
         //! Submits the specified fence to the command queue for CPU/GPU synchronization.
         virtual void Submit(Fence& fence) = 0;
 
+        /**
+        \brief Submits a wait operation for the specified fence into this command queue.
+        \param[in] fence Specifies the fence to wait for. This must have been submitted to another command queue via Submit(Fence&) before.
+        \remarks All command buffers that are submitted to this queue afterwards will not start execution on the GPU until the fence has been signaled.
+        Unlike WaitFence, this does not block the CPU. This is used to synchronize work between the graphics, compute, and copy queues:
+        \code
+        myCopyQueue->Submit(*myUploadCmdBuffer);
+        myCopyQueue->Submit(*myUploadFence);
+        myCmdQueue->SubmitWait(*myUploadFence);
+        myCmdQueue->Submit(*myRenderCmdBuffer); // Reads textures uploaded by the copy queue
+        \endcode
+        \remarks Backends with only a single command queue ignore this, since their command buffers are executed in submission order.
+        With Vulkan, fences are backed by timeline semaphores if \c VK_KHR_timeline_semaphore is available, in which case any number of queues can wait for the same fence.
+        Otherwise, each fence submission can only be waited on by a single SubmitWait call on the GPU; further waits for the same submission block the CPU instead.
+        \see RenderSystem::GetCommandQueue(CommandQueueType)
+        \see WaitFence
+        */
+        virtual void SubmitWait(Fence& fence);
+
+        /* ----- Sparse Resources ----- */
+
+        /**
+        \brief Maps or unmaps tiles of sparse textures to device memory.
+        \param[in] numMappings Specifies the number of tile mappings.
+        \param[in] mappings Pointer to an array of tile mappings. This must not be null if \c numMappings is greater than zero.
+        \remarks The device memory for resident tiles is allocated by the backend. Tiles that are mapped for the first time have undefined content
+        until they are written, e.g. via RenderSystem::WriteTextureAsync or CommandBuffer::CopyTextureFromBuffer. Mapping a tile that is already resident has no effect.
+        \remarks The mapping operations are executed on the GPU in submission order, i.e. command buffers that are submitted to this queue afterwards observe the new mappings.
+        The client programmer is responsible for not unmapping tiles that are still in use by previously submitted command buffers.
+        \remarks This has no effect if RenderingFeatures::hasSparseTextures is false.
+        \code
+        // Make a single page of the virtual texture resident and upload its texels
+        LLGL::TileMappingDescriptor mapping;
+        mapping.texture     = myVirtualTexture;
+        mapping.mipLevel    = pageMip;
+        mapping.tileOffset  = LLGL::Offset3D{ pageX, pageY, 0 };
+        myCmdQueue->UpdateTileMappings(1, &mapping);
+        \endcode
+        \see MiscFlags::Sparse
+        \see GetSparseTileExtent
+        */
+        virtual void UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings);
+
         /**
         \brief Blocks the CPU execution until the specified fence has been signaled.
         \param[in] fence Specifies the fence for which the CPU needs to wait to be signaled.
         \param[in] timeout Specifies the waiting timeout (in nanoseconds).
         \return True on success, or false if the fence has a timeout (in nanoseconds) or the device is lost.
         \remarks To wait for the completion of the entire GPU command queue, use 'WaitIdle'.
+        To poll a fence without blocking, use Fence::IsSignaled.
         \see WaitIdle
+        \see Fence::IsSignaled
         */
         virtual bool WaitFence(Fence& fence, std::uint64_t timeout) = 0;
 
@@ -150,6 +150,17 @@ class LLGL_EXPORT Display : public Interface
         */
         virtual std::vector<DisplayMode> GetSupportedDisplayModes() const = 0;
 
+        /**
+        \brief Returns true if this display supports variable refresh rates (VRR), e.g. with Adaptive-Sync, FreeSync, or G-SYNC.
+        \remarks On such displays, the display refreshes as soon as a new frame is presented without tearing, as long as the frame rate is within the refresh rate range of the display.
+        This requires a presentation mode that doesn't wait for the vertical blank, i.e. PresentMode::Immediate or a v-sync interval of 0.
+        On Windows, this reports whether the presentation engine allows tearing, since variable refresh rates for windows are presented with tearing allowed.
+        \note Only supported on: Windows and macOS. Other platforms always return false.
+        \see PresentMode::Immediate
+        \see FramePacer
+        */
+        virtual bool SupportsVariableRefreshRate() const;
+
     protected:
 
         /**
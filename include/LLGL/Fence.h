@@ -10,6 +10,7 @@
 
 
 #include <LLGL/RenderSystemChild.h>
+#include <cstddef>
 
 
 namespace LLGL
@@ -25,6 +26,31 @@ namespace LLGL
 class LLGL_EXPORT Fence : public RenderSystemChild
 {
     LLGL_DECLARE_INTERFACE( InterfaceID::Fence );
+
+    public:
+
+        /**
+        \brief Retrieves the native fence handle, e.g. to let an external API such as a hardware video encoder wait on GPU work submitted by LLGL.
+        \param[out] nativeHandle Raw pointer to the backend specific structure to store the native handle.
+        Obtain the respective structure from <code>#include <LLGL/Backend/BACKEND/NativeHandle.h></code> where \c BACKEND must be either \c Direct3D12 or \c Vulkan.
+        \param[in] nativeHandleSize Specifies the size (in bytes) of the native handle structure for robustness. This must be \c sizeof() of the respective structure.
+        \return True if the native handle was successfully retrieved. Otherwise, the backend does not expose its fence objects.
+        \remarks The native handle includes the value the fence will reach once the last submission via CommandQueue::Submit(Fence&) has completed.
+        For Direct3D 12, the COM pointer's reference counter is incremented and must be released by the caller.
+        \see LLGL::Direct3D12::FenceNativeHandle
+        \see LLGL::Vulkan::FenceNativeHandle
+        */
+        virtual bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize);
+
+        /**
+        \brief Returns true if the GPU has completed the last submission of this fence via CommandQueue::Submit(Fence&).
+        \remarks This never blocks and is meant for polling many fences per frame, e.g. to track asynchronous uploads.
+        Unlike <code>CommandQueue::WaitFence(fence, 0)</code>, this reads the completed value of timeline fences directly
+        (\c ID3D12Fence::GetCompletedValue for Direct3D 12 and \c vkGetSemaphoreCounterValue for Vulkan) and caches it once the fence is signaled.
+        A fence that has never been submitted is considered signaled.
+        \see CommandQueue::WaitFence
+        */
+        virtual bool IsSignaled() = 0;
 };
 
 
@@ -225,6 +225,10 @@ enum class Format
     BC4SNorm,           //!< Compressed color format: S3TC BC4 compressed red channel with normalized signed integer component 64-bit per 4x4 block.
     BC5UNorm,           //!< Compressed color format: S3TC BC5 compressed red and green channels with normalized unsigned integer components in 64-bit per 4x4 block.
     BC5SNorm,           //!< Compressed color format: S3TC BC5 compressed red and green channels with normalized signed integer components in 128-bit per 4x4 block.
+    BC6HUFloat,         //!< Compressed color format: BC6H compressed RGB with unsigned half-precision floating-point components in 128-bit per 4x4 block. \note Only supported with: Direct3D 11 (feature level 11.0), Direct3D 12, OpenGL 4.2, Vulkan, Metal (macOS).
+    BC6HSFloat,         //!< Compressed color format: BC6H compressed RGB with signed half-precision floating-point components in 128-bit per 4x4 block. \note Only supported with: Direct3D 11 (feature level 11.0), Direct3D 12, OpenGL 4.2, Vulkan, Metal (macOS).
+    BC7UNorm,           //!< Compressed color format: BC7 compressed RGBA with normalized unsigned integer components in 128-bit per 4x4 block. \note Only supported with: Direct3D 11 (feature level 11.0), Direct3D 12, OpenGL 4.2, Vulkan, Metal (macOS).
+    BC7UNorm_sRGB,      //!< Compressed color format: BC7 compressed RGBA with normalized unsigned integer components in 128-bit per 4x4 block in non-linear sRGB color space. \note Only supported with: Direct3D 11 (feature level 11.0), Direct3D 12, OpenGL 4.2, Vulkan, Metal (macOS).
 
     /* --- Advanced scalable texture compression (ASTC) formats --- */
     ASTC4x4,            //!< Compressed color format: ASTC compressed RGBA format in 128-bit per 4x4 block (8.00 bit rate). \note Only supported with: OpenGL, Vulkan, Metal.
@@ -260,6 +264,30 @@ enum class Format
     ETC1UNorm,          //!< Compressed color format: ETC1 compressed RGB with normalized unsigned integer components in 64-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
     ETC2UNorm,          //!< Compressed color format: ETC2 compressed RGB with normalized unsigned integer components in 64-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
     ETC2UNorm_sRGB,     //!< Compressed color format: ETC2 compressed RGB with normalized unsigned integer components in 64-bit per 4x4 block in non-linear sRGB color space. \note Only supported with: OpenGL, Vulkan, Metal.
+    ETC2A1UNorm,        //!< Compressed color format: ETC2 compressed RGB with 1-bit punch-through alpha and normalized unsigned integer components in 64-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
+    ETC2A1UNorm_sRGB,   //!< Compressed color format: ETC2 compressed RGB with 1-bit punch-through alpha and normalized unsigned integer components in 64-bit per 4x4 block in non-linear sRGB color space. \note Only supported with: OpenGL, Vulkan, Metal.
+    ETC2A8UNorm,        //!< Compressed color format: ETC2 compressed RGBA with EAC alpha and normalized unsigned integer components in 128-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
+    ETC2A8UNorm_sRGB,   //!< Compressed color format: ETC2 compressed RGBA with EAC alpha and normalized unsigned integer components in 128-bit per 4x4 block in non-linear sRGB color space. \note Only supported with: OpenGL, Vulkan, Metal.
+    EACR11UNorm,        //!< Compressed color format: EAC compressed R with 11-bit normalized unsigned integer component in 64-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
+    EACR11SNorm,        //!< Compressed color format: EAC compressed R with 11-bit normalized signed integer component in 64-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
+    EACRG11UNorm,       //!< Compressed color format: EAC compressed RG with 11-bit normalized unsigned integer components in 128-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
+    EACRG11SNorm,       //!< Compressed color format: EAC compressed RG with 11-bit normalized signed integer components in 128-bit per 4x4 block. \note Only supported with: OpenGL, Vulkan, Metal.
+
+    /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+    ASTC4x4Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 4x4 block (8.00 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC5x4Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 5x4 block (6.40 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC5x5Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 5x5 block (5.12 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC6x5Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 6x5 block (4.27 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC6x6Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 6x6 block (3.56 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC8x5Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 8x5 block (3.20 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC8x6Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 8x6 block (2.67 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC8x8Float,       //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 8x8 block (2.00 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC10x5Float,      //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 10x5 block (2.56 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC10x6Float,      //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 10x6 block (2.13 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC10x8Float,      //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 10x8 block (1.60 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC10x10Float,     //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 10x10 block (1.28 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC12x10Float,     //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 12x10 block (1.07 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
+    ASTC12x12Float,     //!< Compressed color format: ASTC compressed RGBA HDR format with half-precision floating-point components in 128-bit per 12x12 block (0.89 bit rate). \note Only supported with: OpenGL (with \c GL_KHR_texture_compression_astc_hdr), Vulkan (with \c VK_EXT_texture_compression_astc_hdr), Metal.
 };
 
 /**
@@ -22,6 +22,7 @@ class Fence;
 class Image;
 class PipelineLayout;
 class PipelineState;
+class PlacementHeap;
 class QueryHeap;
 class RenderPass;
 class RenderSystem;
@@ -59,8 +60,10 @@ struct Extent3D;
 struct FragmentAttribute;
 struct GraphicsPipelineDescriptor;
 struct ImageView;
+struct MemoryRequirements;
 struct MutableImageView;
 struct PipelineLayoutDescriptor;
+struct PlacementHeapDescriptor;
 struct QueryHeapDescriptor;
 struct QueryPipelineStatistics;
 struct RasterizerDescriptor;
@@ -80,6 +83,7 @@ struct Scissor;
 struct ShaderDescriptor;
 struct ShaderReflection;
 struct ShaderResourceReflection;
+struct SharedResourceHandle;
 struct StaticSamplerDescriptor;
 struct StencilDescriptor;
 struct StencilFaceDescriptor;
@@ -87,6 +91,7 @@ struct SwapChainDescriptor;
 struct TextureDescriptor;
 struct TextureRegion;
 struct TextureViewDescriptor;
+struct TileMappingDescriptor;
 struct UniformDescriptor;
 struct VertexAttribute;
 struct VertexFormat;
@@ -25,6 +25,64 @@ namespace LLGL
 {
 
 
+class Texture;
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Quality levels for the CPU block compression of images.
+\see CompressImageBufferFromRGBA8UNorm
+*/
+enum class ImageCompressionQuality
+{
+    //! Fastest compression with bounding box endpoints. Intended for images that are generated every frame.
+    Fast,
+
+    //! Balanced compression with principal axis endpoints.
+    Default,
+
+    //! Slowest compression with refined endpoints and an extended search for the best encoding modes.
+    High,
+};
+
+/**
+\brief Filters to generate MIP-maps on the CPU.
+\see GenerateMipChainBuffer
+*/
+enum class ImageMipMapFilter
+{
+    //! Box filter, i.e. the average of all texels that are covered by a texel of the next MIP-map. This is the fastest filter.
+    Box,
+
+    //! Kaiser-windowed sinc filter with a width of 3 texels. This preserves more detail than the box filter, but is slower.
+    Kaiser,
+};
+
+/**
+\brief Image resampling filter enumeration.
+\remarks All filters are separable, i.e. each axis is filtered separately. When downsampling, the filter is stretched to cover all source texels of a destination texel.
+\see ResampleImageBuffer
+*/
+enum class ImageResampleFilter
+{
+    //! Box filter, i.e. the area-weighted average of all covered source texels. This is the fastest filter.
+    Box,
+
+    //! Tent filter with a radius of 1 texel, which results in bilinear filtering.
+    Bilinear,
+
+    //! Mitchell-Netravali cubic filter (B = C = 1/3) with a radius of 2 texels. This is a good trade-off between sharpness and ringing.
+    Mitchell,
+
+    //! Lanczos filter with 3 lobes. This is the sharpest filter, but may produce slight ringing artifacts at hard edges.
+    Lanczos3,
+
+    //! Kaiser-windowed sinc filter with a width of 3 texels. This is the same filter as ImageMipMapFilter::Kaiser.
+    Kaiser,
+};
+
+
 /* ----- Structures ----- */
     
 /**
@@ -122,6 +180,25 @@ struct ImageView
     std::uint32_t   layerStride = 0;
 };
 
+/**
+\brief Texture upload descriptor structure for asynchronous texture uploads.
+\see RenderSystem::WriteTextureAsync
+*/
+struct TextureUploadDescriptor
+{
+    //! Specifies the texture whose data is to be updated. This must not be null.
+    Texture*        texture     = nullptr;
+
+    /**
+    \brief Specifies the region where the texture is to be updated.
+    \remarks The field TextureSubresource::numMipLevels of this region \b must be 1.
+    */
+    TextureRegion   region;
+
+    //! Specifies the source image view. Its \c data member must not be null.
+    ImageView       imageView;
+};
+
 struct LLGL_DEPRECATED("LLGL::SrcImageDescriptor is deprecated since 0.04b; Use LLGL::ImageView instead!", "ImageView") SrcImageDescriptor
 {
     SrcImageDescriptor() = default;
@@ -320,6 +397,10 @@ If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_
 the number of threads will be determined by the workload and the available CPU cores the system supports (e.g. 4 on a quad-core processor).
 Note that this does not guarantee the maximum number of threads the system supports if the workload does not demand it. By default 0.
 \return Byte buffer with the decompressed image data or null if the compression format is not supported for decompression.
+\remarks Supported compression formats are BC1 to BC5 and BC7 (including their sRGB and SNorm variants), ETC1, ETC2 (RGB, RGB8A1, and RGBA8 including their sRGB variants), and EAC (R11 and RG11 including their SNorm variants).
+Single and dual channel formats (BC4, BC5, EAC R11, and EAC RG11) are decompressed to red and green, with blue set to 0 and alpha set to 255.
+Signed formats are remapped from the range [-1, 1] to [0, 1]. The extent does not need to be a multiple of the block size.
+BC6H is not supported since its HDR values cannot be represented in an 8-bit normalized format.
 */
 LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     Format              compressedFormat,
@@ -328,6 +409,91 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     unsigned            threadCount = 0
 );
 
+/**
+\brief Compresses the specified image buffer from RGBA format with 8-bit unsigned normalized integers into the specified block compression format.
+\param[in] compressedFormat Specifies the destination compression format. Supported formats are BC1, BC3, BC4 (UNorm), and BC5 (UNorm) including their sRGB variants,
+as well as ETC1 and ETC2 RGB. ETC2 is encoded with the ETC1 compatible modes only.
+\param[in] srcImageView Specifies the source image view. Its format must be ImageFormat::RGBA and its data type must be DataType::UInt8.
+The row stride is supported but the layer stride is ignored, i.e. only a single 2D image is compressed.
+\param[in] extent Specifies the image extent. This does not need to be a multiple of the block size; border blocks are padded by replicating the border texels.
+\param[in] quality Specifies the trade-off between compression speed and quality. By default ImageCompressionQuality::Default.
+\param[in] threadCount Specifies the number of threads to use for compression.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the number of threads will be determined by the workload and the available CPU cores the system supports (e.g. 4 on a quad-core processor).
+Note that this does not guarantee the maximum number of threads the system supports if the workload does not demand it. By default 0.
+\return Byte buffer with the compressed blocks or null if the compression format or the source image is not supported for compression.
+\remarks For BC1, texels with an alpha value less than 128 are encoded as transparent black. BC4 and BC5 encode the red and the red and green channels respectively.
+\see DecompressImageBufferToRGBA8UNorm
+*/
+LLGL_EXPORT DynamicByteArray CompressImageBufferFromRGBA8UNorm(
+    Format                  compressedFormat,
+    const ImageView&        srcImageView,
+    const Extent2D&         extent,
+    ImageCompressionQuality quality     = ImageCompressionQuality::Default,
+    unsigned                threadCount = 0
+);
+
+/**
+\brief Generates the MIP-map chain for the specified image on the CPU.
+\param[in] srcImageView Specifies the source image view of the first MIP-map, including all array layers. Its row and layer strides are supported.
+This must be an uncompressed color format.
+\param[in] extent Specifies the extent of the first MIP-map. For 3D textures this includes the depth; otherwise the depth must be 1.
+\param[in] numArrayLayers Specifies the number of array layers. Each layer is filtered separately. For cube textures this must be a multiple of 6.
+\param[in] numMipLevels Specifies the number of MIP-maps to generate, including the first one. If this is zero, the full MIP-map chain is generated.
+\param[in] filter Specifies the filter to downsample each MIP-map from its predecessor. By default ImageMipMapFilter::Box.
+\param[in] isSRGB Specifies whether the color components are in non-linear sRGB color space.
+If true, they are filtered in linear color space for gamma-correct results. The alpha component is always filtered linearly. By default false.
+\param[in] threadCount Specifies the number of threads to use for filtering.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the number of threads will be determined by the workload and the available CPU cores the system supports (e.g. 4 on a quad-core processor).
+Note that this does not guarantee the maximum number of threads the system supports if the workload does not demand it. By default 0.
+\return Byte buffer with all MIP-maps tightly packed in the format and data type of the source image, or null if the extent is empty.
+The MIP-maps are stored from the finest to the coarsest level, and each level contains all array layers.
+This matches the layout that RenderSystem::CreateTexture expects for the first MIP-map and WriteTexture expects for each subsequent MIP-map.
+Use GetMemoryFootprint with the number of texels of each MIP-map (see NumMipTexels) to determine the offsets.
+\remarks All values are filtered in floating-point precision and normalized integer values are rounded to nearest.
+This can be used for formats that do not support MiscFlags::GenerateMips, e.g. integer formats.
+\throw std::invalid_argument If the source image is a compressed or depth-stencil format (see ConvertImageBuffer).
+\see NumMipLevels
+\see GetMipExtent
+*/
+LLGL_EXPORT DynamicByteArray GenerateMipChainBuffer(
+    const ImageView&    srcImageView,
+    const Extent3D&     extent,
+    std::uint32_t       numArrayLayers  = 1,
+    std::uint32_t       numMipLevels    = 0,
+    ImageMipMapFilter   filter          = ImageMipMapFilter::Box,
+    bool                isSRGB          = false,
+    unsigned            threadCount     = 0
+);
+
+/**
+\brief Resamples the specified image to a new extent on the CPU.
+\param[in] srcImageView Specifies the source image view. Its row and layer strides are supported. This must be an uncompressed color format.
+\param[in] srcExtent Specifies the extent of the source image.
+\param[in] dstExtent Specifies the extent of the resampled image. Each axis can be downsampled or upsampled independently.
+\param[in] filter Specifies the resampling filter. By default ImageResampleFilter::Lanczos3.
+\param[in] isSRGB Specifies whether the color components are in non-linear sRGB color space.
+If true, they are filtered in linear color space for gamma-correct results. The alpha component is always filtered linearly. By default false.
+\param[in] threadCount Specifies the number of threads to use for filtering.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the number of threads will be determined by the workload and the available CPU cores the system supports (e.g. 4 on a quad-core processor).
+Note that this does not guarantee the maximum number of threads the system supports if the workload does not demand it. By default 0.
+\return Byte buffer with the resampled image tightly packed in the format and data type of the source image, or null if either extent is empty.
+\remarks All values are filtered in single-precision floating-point and normalized integer values are clamped and rounded to nearest.
+The same data types as for ConvertImageBuffer are supported.
+\throw std::invalid_argument If the source image is a compressed or depth-stencil format (see ConvertImageBuffer).
+\see Image::Resample
+*/
+LLGL_EXPORT DynamicByteArray ResampleImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent3D&     srcExtent,
+    const Extent3D&     dstExtent,
+    ImageResampleFilter filter      = ImageResampleFilter::Lanczos3,
+    bool                isSRGB      = false,
+    unsigned            threadCount = 0
+);
+
 /**
 \brief Copies an image buffer region from the source buffer to the destination buffer.
 \param[out] dstImageView Specifies the destination image view.
@@ -339,7 +505,12 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
 \param[in] srcRowStride Specifies the number of pixels for each row in the source image.
 \param[in] srcLayerStride Specifies the number of pixels for each slice in the source image.
 \param[in] extent Specifies the region extent to be copied.
+\param[in] threadCount Specifies the number of threads to use for the copy.
+If this is less than 2, no multi-threading is used. If this is equal to \c LLGL_MAX_THREAD_COUNT,
+the number of threads will be determined by the workload and the available CPU cores the system supports.
+Small regions are always copied on the calling thread. By default 0.
 \remarks Only performs a bitwise copy. No blending or other operation is performed.
+If the region is contiguous in both source and destination buffers, it is copied with a single \c memcpy.
 \throw std::invalid_argument If the destination buffer is a null pointer.
 \throw std::invalid_argument If the destination buffer size does not match the required output buffer size.
 \throw std::invalid_argument If the source buffer is a null pointer.
@@ -347,6 +518,7 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
 \throw std::invalid_argument If source and destination image descriptors do not have the same format and data type.
 \throw std::out_of_range If \c srcOffset plus \c extent is outside the boundary of the source image.
 \throw std::out_of_range If \c dstOffset plus \c extent is outside the boundary of the destination image.
+\see LLGL_MAX_THREAD_COUNT
 */
 LLGL_EXPORT void CopyImageBufferRegion(
     // Destination
@@ -362,7 +534,10 @@ LLGL_EXPORT void CopyImageBufferRegion(
     std::uint32_t           srcLayerStride,
 
     // Region
-    const Extent3D&         extent
+    const Extent3D&         extent,
+
+    // Threading
+    unsigned                threadCount = 0
 );
 
 /**
@@ -44,6 +44,7 @@ struct InterfaceID
         PipelineCache,          //!< Extends RenderSystemChild. \see PipelineCache
         PipelineLayout,         //!< Extends RenderSystemChild. \see PipelineLayout
         PipelineState,          //!< Extends RenderSystemChild. \see PipelineState
+        PlacementHeap,          //!< Extends RenderSystemChild. \see PlacementHeap
         QueryHeap,              //!< Extends RenderSystemChild. \see QueryHeap
         RenderPass,             //!< Extends RenderSystemChild. \see RenderPass
         Resource,               //!< Extends RenderSystemChild. \see Resource
@@ -14,9 +14,11 @@
 #include <LLGL/Canvas.h>
 #include <LLGL/Display.h>
 #include <LLGL/Timer.h>
+#include <LLGL/RawInput.h>
 #include <LLGL/TypeInfo.h>
 #include <LLGL/RenderSystem.h>
 #include <LLGL/Log.h>
+#include <LLGL/ThreadPool.h>
 #include <LLGL/IndirectArguments.h>
 #include <LLGL/ImageFlags.h>
 #include <LLGL/Utils/Input.h>
@@ -12,6 +12,7 @@
 #include <LLGL/Export.h>
 #include <LLGL/Report.h>
 #include <functional>
+#include <cstddef>
 
 
  //! Encodes the flags for full RGB console colors.
@@ -297,6 +298,42 @@ LLGL_EXPORT LogHandle RegisterCallbackStd(long stdOutFlags = 0);
 */
 LLGL_EXPORT void UnregisterCallback(LogHandle handle);
 
+/**
+\brief Specifies the minimum report type that is forwarded to the log callbacks. By default ReportType::Default, i.e. all reports are forwarded.
+\param[in] type Specifies the minimum report type. For example, ReportType::Error ignores all reports from Printf.
+\remarks Reports below this level are discarded before their message is formatted, so they have almost no overhead.
+\see IsReportEnabled
+*/
+LLGL_EXPORT void SetReportLevel(ReportType type);
+
+/**
+\brief Returns true if reports of the specified type are forwarded to at least one log callback.
+\remarks This can be used to skip expensive preparations of log messages, e.g. when no callback has been registered or the report level excludes this type.
+It has the same overhead as reading an atomic variable.
+\see SetReportLevel
+*/
+LLGL_EXPORT bool IsReportEnabled(ReportType type);
+
+/**
+\brief Enables or disables deferred reports.
+\param[in] capacity Specifies the maximum number of pending reports. If this is zero, deferred reports are disabled and all pending reports are flushed.
+\remarks While deferred reports are enabled, Printf and Errorf only format the message and push it into a lock-free ring buffer,
+so multiple threads can emit reports without contending for the lock of the log callbacks.
+The reports are forwarded to the log callbacks on the thread that calls FlushDeferredReports, e.g. once per frame.
+If the ring buffer is full, further reports are dropped and the number of dropped reports is printed with the next flush.
+\remarks This must not be called while other threads emit reports.
+\see FlushDeferredReports
+*/
+LLGL_EXPORT void SetDeferredReports(std::size_t capacity);
+
+/**
+\brief Forwards all pending deferred reports to the log callbacks in the order they were emitted.
+\return Number of reports that have been forwarded.
+\remarks If deferred reports are disabled, this function has no effect.
+\see SetDeferredReports
+*/
+LLGL_EXPORT std::size_t FlushDeferredReports();
+
 
 } // /namespace Log
 
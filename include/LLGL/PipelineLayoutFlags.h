@@ -60,6 +60,55 @@ struct BarrierFlags
     };
 };
 
+/**
+\brief Pipeline layout creation flags.
+\see PipelineLayoutDescriptor::flags
+*/
+struct PipelineLayoutFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the heap bindings form a bindless resource heap.
+        \remarks Heap bindings of a bindless pipeline layout are meant to be large arrays (see BindingDescriptor::arraySize) that are indexed dynamically from shaders.
+        Such arrays are \e partially \e bound, i.e. only the descriptors that are actually accessed by a shader must have been written to,
+        and their descriptors can be updated while the ResourceHeap is bound without stalling the GPU.
+        It is the responsibility of the client programmer not to overwrite descriptors that are used by command buffers which have not completed execution yet.
+        \remarks In Vulkan, this enables the \c VK_EXT_descriptor_indexing binding flags \c PARTIALLY_BOUND, \c UPDATE_UNUSED_WHILE_PENDING, and \c UPDATE_AFTER_BIND.
+        In Direct3D 12, the descriptor tables are already volatile and descriptors are copied into the shader-visible descriptor heap each time the ResourceHeap is bound,
+        i.e. updates become visible to the GPU with the next call to CommandBuffer::SetResourceHeap.
+        \remarks In OpenGL, this requires the \c GL_ARB_bindless_texture extension and only affects sampled textures:
+        all consecutive binding slots of sampled textures are passed as 64-bit texture handles in a single shader storage block that is bound to the first slot of that range,
+        e.g. <code>layout(std430, binding = 0) readonly buffer Textures { sampler2D textures[]; };</code>.
+        The handles are combined with the first static sampler of the pipeline layout, or with the sampling parameters of the texture object itself if there is no static sampler.
+        \remarks In Metal, this requires Tier 2 argument buffers: all heap bindings of a descriptor set are encoded into a single argument buffer when the ResourceHeap is written,
+        and binding the ResourceHeap only binds that argument buffer to buffer slot 29 of each shader stage that has heap bindings.
+        The binding slots specify the argument indices within the argument buffer,
+        e.g. <code>struct Resources { texture2d<float> textures [[id(0)]][256]; sampler linearSampler [[id(256)]]; };</code>
+        and <code>fragment float4 PSMain(..., constant Resources& resources [[buffer(29)]])</code>.
+        \remarks This flag is ignored if bindless resource heaps are not supported.
+        \see RenderingFeatures::hasBindlessResourceHeaps
+        \see RenderingLimits::maxBindlessResourceViews
+        \see RenderSystem::WriteResourceHeap
+        */
+        BindlessHeap = (1 << 0),
+
+        /**
+        \brief Allows individual sampled and storage buffer bindings to be passed as root descriptors.
+        \remarks Direct3D 12 can only pass raw and structured buffers as root SRVs and UAVs,
+        i.e. buffers that are bound to such bindings must have been created with Format::Undefined (see BufferDescriptor::format).
+        Individual constant buffer bindings are always passed as root descriptors, regardless of this flag.
+        \remarks Root descriptors are allocated within the 64 DWORD limit of the root signature in the order of constant buffers, sampled buffers, and storage buffers,
+        since bindings of that order are generally updated more frequently. Space for heap bindings, descriptor tables, and uniforms is reserved first.
+        All remaining bindings are passed via descriptor tables.
+        \remarks This flag is only used by the Direct3D 12 backend and ignored otherwise.
+        \see PipelineLayoutDescriptor::bindings
+        \see CommandBuffer::SetResource
+        */
+        RootDescriptors = (1 << 1),
+    };
+};
+
 
 /* ----- Enumerations ----- */
 
@@ -537,6 +586,12 @@ struct PipelineLayoutDescriptor
     \see CommandBuffer::ResourceBarier
     */
     long                                            barrierFlags            = 0;
+
+    /**
+    \brief Specifies optional pipeline layout creation flags. This can be a bitwise OR combination of the entries of PipelineLayoutFlags. By default 0.
+    \see PipelineLayoutFlags
+    */
+    long                                            flags                   = 0;
 };
 
 
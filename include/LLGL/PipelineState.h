@@ -32,10 +32,18 @@ class LLGL_EXPORT PipelineState : public RenderSystemChild
         /**
         \brief Returns a pointer to the report or null if there is none.
         \remarks If there is a report, it might contain warnings and/or errors from the PSO and shader compilation process.
+        If this PSO was created with PipelineStateFlags::AsyncCompilation, this function blocks until the compilation has finished.
         \see Report
         */
         virtual const Report* GetReport() const = 0;
 
+        /**
+        \brief Returns true if this PSO has finished compiling and can be bound without blocking. This function never blocks.
+        \remarks This only returns false for PSOs that were created with PipelineStateFlags::AsyncCompilation and are still compiling.
+        \see PipelineStateFlags::AsyncCompilation
+        */
+        virtual bool IsReady() const;
+
 };
 
 
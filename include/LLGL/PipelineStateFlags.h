@@ -289,6 +289,30 @@ struct ColorMaskFlags
 };
 
 
+/**
+\brief Pipeline state creation flags.
+\see GraphicsPipelineDescriptor::flags
+\see ComputePipelineDescriptor::flags
+*/
+struct PipelineStateFlags
+{
+    enum
+    {
+        /**
+        \brief Compiles the pipeline state asynchronously, so RenderSystem::CreatePipelineState returns without waiting for the driver.
+        \remarks Use PipelineState::IsReady to poll whether compilation has finished, e.g. to bind a fallback PSO in the meantime.
+        Binding a PSO that is not ready yet blocks until its compilation has finished.
+        All shaders, the pipeline layout, the render pass, and the pipeline cache this PSO was created with must remain valid until the PSO is ready.
+        A pipeline cache must not be shared with other PSOs that are compiled at the same time.
+        If the backend cannot compile PSOs asynchronously, this flag is ignored and PipelineState::IsReady always returns true.
+        \note Only supported with: Vulkan, Direct3D 12, Metal, OpenGL (with \c GL_KHR_parallel_shader_compile or \c GL_ARB_parallel_shader_compile).
+        \see PipelineState::IsReady
+        */
+        AsyncCompilation = (1 << 0),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -746,6 +770,26 @@ struct TessellationDescriptor
     bool                    outputWindingCCW    = false;
 };
 
+/**
+\brief Specialization constant descriptor structure for graphics and compute pipelines.
+\remarks Specialization constants are shader constants whose values are specified when a pipeline state is created,
+e.g. to tune workgroup sizes or unroll factors per device without compiling another permutation of the shader source.
+\remarks Equivalent of <code>layout(constant_id = 0) const uint N = 64;</code> in GLSL and <code>constant uint N [[function_constant(0)]];</code> in Metal.
+\see GraphicsPipelineDescriptor::specializationConstants
+\see ComputePipelineDescriptor::specializationConstants
+*/
+struct SpecializationConstant
+{
+    //! Specifies the specialization constant ID, i.e. \c constant_id in GLSL or the index of the function constant in Metal. By default 0.
+    std::uint32_t   id      = 0;
+
+    /**
+    \brief Specifies the 32-bit value of the specialization constant. By default 0.
+    \remarks This is the bit pattern of the value, i.e. floating-point values must be reinterpreted as 32-bit integers and booleans must be either 0 or 1.
+    */
+    std::uint32_t   value   = 0;
+};
+
 /**
 \brief Graphics pipeline state descriptor structure.
 \remarks This structure describes the entire graphics pipeline:
@@ -761,6 +805,12 @@ struct GraphicsPipelineDescriptor
     */
     const char*             debugName               = nullptr;
 
+    /**
+    \brief Specifies the pipeline state creation flags. This can be a bitwise OR combination of the PipelineStateFlags entries. By default 0.
+    \see PipelineStateFlags
+    */
+    long                    flags                   = 0;
+
     /**
     \brief Specifies an optional pipeline layout for the graphics pipeline. By default null.
     \remarks This layout determines at which slots buffer resources will be bound.
@@ -778,10 +828,24 @@ struct GraphicsPipelineDescriptor
     */
     const RenderPass*       renderPass              = nullptr;
 
+    /**
+    \brief Specifies the bitmask of views this graphics pipeline renders into with each draw command. By default 0.
+    \remarks This must be equal to the view mask of the render pass in which this graphics pipeline is used.
+    If this is 0, multiview rendering is disabled. Otherwise, the number of views is the number of bits that are set.
+    \remarks With Direct3D 12, at most 4 views are supported and each view is mapped to the render target array layer with the same index as its bit.
+    With Metal, each view is mapped to a render target array layer via vertex amplification.
+    \see RenderPassDescriptor::viewMask
+    \see RenderingFeatures::hasMultiview
+    */
+    std::uint32_t           viewMask                = 0;
+
     /**
     \brief Specifies the vertex shader.
-    \remarks Each graphics pipeline must have at least a vertex shader. Therefore, this must never be null when a graphics PSO is created.
+    \remarks Each graphics pipeline must have at least a vertex shader, a mesh shader, or a tile shader.
+    Therefore, this must only be null if either \c meshShader or \c tileShader is specified.
     With OpenGL, this shader may also have a stream output.
+    \see meshShader
+    \see tileShader
     */
     Shader*                 vertexShader            = nullptr;
 
@@ -805,6 +869,31 @@ struct GraphicsPipelineDescriptor
     */
     Shader*                 geometryShader          = nullptr;
 
+    /**
+    \brief Specifies an optional task shader (also referred to as "Amplification Shader" or "Object Shader").
+    \remarks If this is used, \c meshShader must also be specified.
+    \see RenderingFeatures::hasMeshShaders
+    */
+    Shader*                 taskShader              = nullptr;
+
+    /**
+    \brief Specifies an optional mesh shader.
+    \remarks If this is used, the pipeline is a mesh pipeline that can only be used with CommandBuffer::DrawMeshTasks and CommandBuffer::DrawMeshTasksIndirect.
+    Mesh pipelines must not have a vertex, tessellation, or geometry shader and the vertex format, index format, and primitive topology are ignored.
+    \see RenderingFeatures::hasMeshShaders
+    */
+    Shader*                 meshShader              = nullptr;
+
+    /**
+    \brief Specifies an optional tile shader.
+    \remarks If this is used, the pipeline is a tile pipeline that can only be used with CommandBuffer::DispatchTiles inside a render pass.
+    Tile pipelines must not have any other shader and only the pixel formats and sample count of the render pass are used.
+    Tile shaders read and write the color attachments of the current render pass in tile memory,
+    so attachments whose content is only needed within the render pass can stay in tile memory (see MiscFlags::Transient).
+    \see RenderingFeatures::hasTileShaders
+    */
+    Shader*                 tileShader              = nullptr;
+
     /**
     \brief Specifies an optional fragment shader (also referred to as "Pixel Shader").
     \remarks If no fragment shader is specified, generated fragments are discarded by the output merger
@@ -868,6 +957,16 @@ struct GraphicsPipelineDescriptor
     \note Only supported with: Metal.
     */
     TessellationDescriptor  tessellation;
+
+    /**
+    \brief Specifies an optional list of specialization constants for all shader stages. By default empty.
+    \remarks Constants whose IDs are not declared in a shader stage are ignored for that stage.
+    The Metal backend only specializes the vertex and fragment functions, i.e. tessellation, mesh, and tile pipelines ignore these constants.
+    For backends without native specialization constants, equivalent values must be specified as macros in ShaderDescriptor::defines instead.
+    \note Only supported with: Vulkan, Metal.
+    \see SpecializationConstant
+    */
+    std::vector<SpecializationConstant> specializationConstants;
 };
 
 /**
@@ -883,6 +982,12 @@ struct ComputePipelineDescriptor
     */
     const char*             debugName       = nullptr;
 
+    /**
+    \brief Specifies the pipeline state creation flags. This can be a bitwise OR combination of the PipelineStateFlags entries. By default 0.
+    \see PipelineStateFlags
+    */
+    long                    flags           = 0;
+
     /**
     \brief Pointer to an optional pipeline layout for the graphics pipeline.
     \remarks This layout determines at which slots buffer resources can be bound.
@@ -895,6 +1000,87 @@ struct ComputePipelineDescriptor
     \remarks This must never be null when a compute PSO is created.
     */
     Shader*                 computeShader   = nullptr;
+
+    /**
+    \brief Specifies an optional list of specialization constants for the compute shader. By default empty.
+    \remarks This can be used to specialize the workgroup size with <code>layout(local_size_x_id = 0) in;</code> in GLSL.
+    For backends without native specialization constants, equivalent values must be specified as macros in ShaderDescriptor::defines instead.
+    \note Only supported with: Vulkan, Metal.
+    \see SpecializationConstant
+    */
+    std::vector<SpecializationConstant> specializationConstants;
+};
+
+/**
+\brief Ray tracing hit group descriptor structure.
+\remarks A hit group combines the shaders that are invoked when a ray intersects the geometry of an acceleration structure.
+\see RayTracingPipelineDescriptor::hitGroups
+*/
+struct RayTracingHitGroupDescriptor
+{
+    //! Specifies the optional closest-hit shader. This must be a shader of type ShaderType::ClosestHit. By default null.
+    Shader* closestHitShader    = nullptr;
+
+    //! Specifies the optional any-hit shader. This must be a shader of type ShaderType::AnyHit. By default null.
+    Shader* anyHitShader        = nullptr;
+};
+
+/**
+\brief Ray tracing pipeline state descriptor structure.
+\remarks The shader binding table of a ray tracing PSO is managed by the backend: the miss shaders and hit groups are stored in the same order as they are specified in this descriptor.
+The \c MissShaderIndex argument of \c TraceRay in HLSL selects an entry of \c missShaders and
+the \c RayContributionToHitGroupIndex argument plus AccelerationStructureInstance::hitGroupOffset selects an entry of \c hitGroups.
+\remarks With Direct3D 12, ray tracing shaders must be compiled as DXIL libraries (e.g. with profile \c "lib_6_3")
+and ShaderDescriptor::entryPoint must specify the name of the shader function within the library.
+Ray tracing PSOs ignore PipelineStateFlags::AsyncCompilation and are not stored in pipeline caches.
+\see RenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor&, PipelineCache*)
+\see RenderingFeatures::hasRayTracing
+*/
+struct RayTracingPipelineDescriptor
+{
+    /**
+    \brief Optional name for debugging purposes. By default null.
+    \remarks The final name of the native hardware resource is implementation defined.
+    \see RenderSystemChild::SetName
+    */
+    const char*                                 debugName           = nullptr;
+
+    /**
+    \brief Specifies the pipeline state creation flags. This can be a bitwise OR combination of the PipelineStateFlags entries. By default 0.
+    \see PipelineStateFlags
+    */
+    long                                        flags               = 0;
+
+    /**
+    \brief Pointer to an optional pipeline layout for the ray tracing pipeline.
+    \remarks This layout determines at which slots resources can be bound. All shaders of the pipeline share this layout.
+    */
+    const PipelineLayout*                       pipelineLayout      = nullptr;
+
+    /**
+    \brief Specifies the ray generation shader.
+    \remarks This must never be null when a ray tracing PSO is created.
+    */
+    Shader*                                     rayGenerationShader = nullptr;
+
+    //! Specifies the list of miss shaders. Each entry must be a shader of type ShaderType::Miss.
+    std::vector<Shader*>                        missShaders;
+
+    //! Specifies the list of hit groups.
+    std::vector<RayTracingHitGroupDescriptor>   hitGroups;
+
+    /**
+    \brief Specifies the maximum recursion depth of \c TraceRay calls. By default 1.
+    \remarks A value of 1 only allows rays to be traced from the ray generation shader.
+    This must not be larger than 31.
+    */
+    std::uint32_t                               maxRecursionDepth   = 1;
+
+    //! Specifies the maximum size (in bytes) of the ray payload structure. By default 16.
+    std::uint32_t                               maxPayloadSize      = 16;
+
+    //! Specifies the maximum size (in bytes) of the hit attributes structure. By default 8, which is the size of the built-in triangle barycentrics.
+    std::uint32_t                               maxAttributeSize    = 8;
 };
 
 
@@ -0,0 +1,60 @@
+/*
+ * PlacementHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PLACEMENT_HEAP_H
+#define LLGL_PLACEMENT_HEAP_H
+
+
+#include <LLGL/RenderSystemChild.h>
+#include <LLGL/PlacementHeapFlags.h>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Placement heap interface that holds a single block of device memory, into which textures can be placed at arbitrary offsets.
+\remarks Textures whose lifetimes never overlap within a frame, such as intermediate render targets of a post-processing chain,
+can be placed at the same offset to share the same memory. This is called memory aliasing.
+Before an aliased texture is used, CommandBuffer::AliasingBarrier \b must be recorded to switch the memory from the previous texture to the next one.
+\see RenderSystem::CreatePlacementHeap
+\see RenderSystem::CreatePlacedTexture
+\see CommandBuffer::AliasingBarrier
+*/
+class LLGL_EXPORT PlacementHeap : public RenderSystemChild
+{
+
+        LLGL_DECLARE_INTERFACE( InterfaceID::PlacementHeap );
+
+    public:
+
+        //! Returns the size (in bytes) of the device memory of this heap.
+        inline std::uint64_t GetSize() const
+        {
+            return size_;
+        }
+
+    protected:
+
+        PlacementHeap(std::uint64_t size);
+
+    private:
+
+        std::uint64_t size_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
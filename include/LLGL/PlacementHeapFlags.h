@@ -0,0 +1,62 @@
+/*
+ * PlacementHeapFlags.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PLACEMENT_HEAP_FLAGS_H
+#define LLGL_PLACEMENT_HEAP_FLAGS_H
+
+
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Placement heap descriptor structure.
+\see RenderSystem::CreatePlacementHeap
+*/
+struct PlacementHeapDescriptor
+{
+    /**
+    \brief Optional name for debugging purposes. By default null.
+    \remarks The final name of the native hardware resource is implementation defined.
+    \see RenderSystemChild::SetName
+    */
+    const char*     debugName   = nullptr;
+
+    /**
+    \brief Specifies the size (in bytes) of the device memory that is allocated for the heap. This must be greater than zero. By default 0.
+    \remarks Use RenderSystem::GetTextureMemoryRequirements to determine how much memory is required for each texture that is placed into the heap.
+    */
+    std::uint64_t   size        = 0;
+};
+
+/**
+\brief Memory requirements structure of a resource that is placed into a heap.
+\see RenderSystem::GetTextureMemoryRequirements
+*/
+struct MemoryRequirements
+{
+    //! Size (in bytes) of the memory that is occupied by the resource.
+    std::uint64_t   size        = 0;
+
+    //! Required alignment (in bytes) of the offset where the resource is placed into a heap. This is always a power of two or zero if the resource cannot be placed.
+    std::uint64_t   alignment   = 0;
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
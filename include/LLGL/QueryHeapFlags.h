@@ -57,6 +57,14 @@ enum class QueryType
     \see RenderingFeatures::hasPipelineStatistics
     */
     PipelineStatistics,
+
+    /**
+    \brief GPU timestamp (in nanoseconds) when all previous commands have been completed.
+    \remarks Timestamps are written with CommandBuffer::EndQuery only, i.e. CommandBuffer::BeginQuery must not be called for this query type.
+    Only the difference between two timestamps of the same command queue is meaningful.
+    \see RenderingFeatures::hasTimestampQueries
+    */
+    Timestamp,
 };
 
 
@@ -0,0 +1,156 @@
+/*
+ * RawInput.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_RAW_INPUT_H
+#define LLGL_RAW_INPUT_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Key.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Raw input event type enumeration.
+\see RawInputEvent::type
+*/
+enum class RawInputEventType : std::uint8_t
+{
+    //! Relative mouse motion. RawInputEvent::x and RawInputEvent::y specify the motion vector, which is independent of the screen resolution.
+    MouseMotion,
+
+    //! Mouse wheel motion. RawInputEvent::y specifies the number of wheel notches, which is positive when the wheel is moved forward.
+    MouseWheel,
+
+    //! Mouse button has been pushed. RawInputEvent::key specifies the button, e.g. Key::LButton.
+    ButtonDown,
+
+    //! Mouse button has been released. RawInputEvent::key specifies the button, e.g. Key::LButton.
+    ButtonUp,
+
+    /**
+    \brief Pen or touch contact has moved.
+    \remarks RawInputEvent::x and RawInputEvent::y specify the position (in pixels) relative to the surface's content area and RawInputEvent::pressure the normalized pressure.
+    */
+    PenMotion,
+};
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Raw input event structure. This is a plain data structure that is copied into the raw input queue.
+\see RawInput::Drain
+*/
+struct RawInputEvent
+{
+    //! Specifies the type of this event.
+    RawInputEventType   type        = RawInputEventType::MouseMotion;
+
+    //! Specifies the button for RawInputEventType::ButtonDown and RawInputEventType::ButtonUp events. Otherwise, this is Key::Any.
+    Key                 key         = Key::Any;
+
+    //! Specifies the X coordinate of the motion vector or position. The meaning depends on the event type.
+    float               x           = 0.0f;
+
+    //! Specifies the Y coordinate of the motion vector or position. The meaning depends on the event type.
+    float               y           = 0.0f;
+
+    //! Specifies the normalized pressure in the range [0, 1] for RawInputEventType::PenMotion events. Otherwise, this is 0.
+    float               pressure    = 0.0f;
+
+    //! Specifies the time stamp of this event in ticks of the high resolution timer.
+    std::uint64_t       timestamp   = 0;
+};
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Batched access to raw mouse and pen input.
+\remarks Raw input at high polling rates can generate thousands of events per second.
+Instead of dispatching each of them to the event listeners of a Window or Canvas, the platform layer can copy them into a fixed-size ring buffer the application drains once per frame:
+\code
+LLGL::RawInput::SetQueueCapacity(4096);
+while (LLGL::Surface::ProcessEvents()) {
+    LLGL::RawInputEvent events[256];
+    while (std::size_t numEvents = LLGL::RawInput::Drain(events, 256)) {
+        for (std::size_t i = 0; i < numEvents; ++i) {
+            // Process events[i] ...
+        }
+    }
+    // Update scene, render ...
+}
+\endcode
+\remarks The queue is filled by Surface::ProcessEvents and must only be accessed on the thread that processes the events.
+Posting an event into the queue neither allocates memory nor dispatches virtual function calls.
+The existing event listeners (e.g. Window::EventListener::OnGlobalMotion) still receive their events regardless of the queue.
+\note Platform support:
+- MS/Windows: Raw mouse motion, wheel, and buttons via \c WM_INPUT.
+- Linux and macOS: Mouse motion, wheel, and buttons of the windowing system.
+- Android: Pen and touch motion, including the historical samples that were batched into a single motion event.
+\see Timer::Tick
+*/
+namespace RawInput
+{
+
+
+/**
+\brief Sets the capacity of the raw input queue (in number of events) and clears all queued events.
+\param[in] capacity Specifies the maximum number of events the queue can hold. This is rounded up to the next power of two.
+If this is 0, the raw input queue is disabled and no events are recorded. By default 0.
+\remarks This is the only function that allocates memory for the raw input queue.
+If the queue is full, consecutive mouse motion events are accumulated into the most recent one and other events are dropped.
+\see GetNumDroppedEvents
+*/
+LLGL_EXPORT void SetQueueCapacity(std::size_t capacity);
+
+//! Returns the capacity of the raw input queue or 0 if the queue is disabled.
+LLGL_EXPORT std::size_t GetQueueCapacity();
+
+/**
+\brief Copies the oldest queued raw input events into the output array and removes them from the queue.
+\param[out] outEvents Pointer to the array of events that receives the queued events. This must not be null if \c maxEvents is greater than zero.
+\param[in] maxEvents Specifies the maximum number of events to copy.
+\return Number of events that have been copied into the output array. This is 0 if the queue is empty.
+*/
+LLGL_EXPORT std::size_t Drain(RawInputEvent* outEvents, std::size_t maxEvents);
+
+//! Returns the number of events that have been dropped because the queue was full, since the queue capacity was set.
+LLGL_EXPORT std::uint64_t GetNumDroppedEvents();
+
+/**
+\brief Appends the specified event to the raw input queue. If the queue is disabled, this function has no effect.
+\remarks This is called by the platform layer, but it can also be used to feed input from custom surfaces into the same queue.
+*/
+LLGL_EXPORT void Post(const RawInputEvent& event);
+
+/**
+\brief Returns true if the raw input queue is enabled, i.e. its capacity is greater than zero.
+\remarks The platform layer uses this to skip the translation of native input events when the queue is disabled.
+*/
+LLGL_EXPORT bool IsEnabled();
+
+
+} // /namespace RawInput
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -48,6 +48,8 @@ enum class AttachmentStoreOp
     /**
     \brief We don't care about the outcome of the respective render target attachment.
     \remarks Can be used, for example, if we only need the depth buffer for the depth test, but nothing is written to it.
+    This avoids writing the attachment back to memory on tile-based GPUs. With OpenGL, such attachments are invalidated at the end of the render pass
+    via \c glInvalidateFramebuffer, if \c GL_ARB_invalidate_subdata or OpenGLES 3.0 is supported.
     */
     Undefined,
 
@@ -159,6 +161,19 @@ struct RenderPassDescriptor
     \see RenderingLimits::maxNoAttachmentSamples
     */
     std::uint32_t               samples             = 1;
+
+    /**
+    \brief Specifies the bitmask of views this render pass renders into with each draw command. By default 0.
+    \remarks If this is 0, multiview rendering is disabled. Otherwise, the bit N enables the view that renders into array layer N of each attachment,
+    relative to the base array layer of the respective render target attachment (see AttachmentDescriptor::arrayLayer).
+    For example, a mask of 0x3 is used for stereo rendering and a mask of 0x3F to render all six faces of a cube texture.
+    All attachments must therefore be array textures or cube textures with enough array layers.
+    \remarks Graphics pipelines that are used within this render pass must have the same view mask.
+    \see RenderingFeatures::hasMultiview
+    \see RenderingLimits::maxMultiviewViewCount
+    \see GraphicsPipelineDescriptor::viewMask
+    */
+    std::uint32_t               viewMask            = 0;
 };
 
 
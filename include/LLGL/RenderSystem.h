@@ -24,6 +24,8 @@
 #include <LLGL/PipelineCache.h>
 #include <LLGL/PipelineState.h>
 #include <LLGL/PipelineStateFlags.h>
+#include <LLGL/PlacementHeap.h>
+#include <LLGL/PlacementHeapFlags.h>
 #include <LLGL/QueryHeap.h>
 #include <LLGL/QueryHeapFlags.h>
 #include <LLGL/RenderPass.h>
@@ -210,6 +212,47 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         const Report* GetReport() const;
 
+        /**
+        \brief Queries the current usage and budget of all memory heaps of the render system device.
+        \param[out] outHeapInfos Optional pointer to an array of MemoryHeapInfo entries. If this is null, only the number of heaps is returned.
+        \param[in] maxHeapInfos Specifies the maximum number of entries that will be written to \c outHeapInfos.
+        \return Number of memory heaps the device provides. This can be greater than \c maxHeapInfos. A return value of 0 indicates that the backend does not support memory heap queries.
+        \remarks Unlike GetRendererInfo, this function queries the information on every call since usage and budget can change at any time.
+        This function also evaluates the callback that was set with SetMemoryBudgetCallback.
+        Here is an overview of where the information is taken from:
+        - Direct3D 12 and Direct3D 11: \c IDXGIAdapter3::QueryVideoMemoryInfo for the local and non-local memory segment groups (requires DXGI 1.4).
+        - Vulkan: \c VK_EXT_memory_budget if the extension is available. Otherwise, the budget is the heap size and the usage is tracked by LLGL's device memory manager.
+        - Metal: \c MTLDevice.currentAllocatedSize and \c MTLDevice.recommendedMaxWorkingSetSize.
+        - OpenGL: \c GL_NVX_gpu_memory_info if the extension is available.
+        \see MemoryHeapInfo
+        */
+        std::uint32_t QueryMemoryHeaps(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos);
+
+        /**
+        \brief Queries information about all video adapters the rendering API of this render system enumerates.
+        \param[out] outAdapters Optional pointer to an array of AdapterInfo entries. If this is null, only the number of adapters is returned.
+        \param[in] maxAdapters Specifies the maximum number of entries that will be written to \c outAdapters.
+        \return Number of video adapters. This can be greater than \c maxAdapters.
+        \remarks The order of entries matches the indices that can be used for RenderSystemDescriptor::adapterIndex with the same module.
+        The entry of the video adapter this render system was created with has AdapterInfo::isActive set to true.
+        The OpenGL and Null backends only report the active adapter.
+        \see AdapterInfo
+        \see RenderSystemDescriptor::adapterIndex
+        */
+        std::uint32_t QueryAdapters(AdapterInfo* outAdapters, std::uint32_t maxAdapters);
+
+        /**
+        \brief Sets the callback that is invoked when the usage of a memory heap crosses the specified fraction of its budget.
+        \param[in] callback Specifies the new callback. If this is null, the callback is disabled.
+        \param[in] threshold Specifies the fraction of the budget that triggers the callback. By default 0.9, i.e. 90% of the budget.
+        \remarks The callback is invoked once each time the usage of a heap rises above the threshold.
+        It is invoked again only after the usage of that heap has fallen below the threshold again.
+        The usage is evaluated whenever a buffer or texture is created and whenever QueryMemoryHeaps is called.
+        This can be used, for instance, to evict texture MIP-maps before the driver starts paging video memory.
+        \see MemoryBudgetCallback
+        */
+        void SetMemoryBudgetCallback(const MemoryBudgetCallback& callback, float threshold = 0.9f);
+
     public:
 
         /* ----- Swap-chain ----- */
@@ -231,11 +274,52 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void Release(SwapChain& swapChain) = 0;
 
+        /**
+        \brief Starts preparing the platform specific state for swap-chains with the specified descriptor on a worker thread.
+        \param[in] swapChainDesc Specifies the descriptor of the swap-chain that is going to be created. Only its pixel format attributes are considered, i.e. color, depth, and stencil bits and number of samples.
+        \remarks This allows slow parts of the swap-chain creation to overlap with other startup work, such as loading assets.
+        A subsequent call to CreateSwapChain with a matching descriptor waits for this preparation to finish and reuses its results instead of repeating it:
+        \code
+        myRenderSystem->PrepareSwapChainAsync(mySwapChainDesc);
+        LoadMyAssets();
+        LLGL::SwapChain* mySwapChain = myRenderSystem->CreateSwapChain(mySwapChainDesc);
+        \endcode
+        \remarks The native surface is still created by CreateSwapChain on the calling thread, since windows belong to the thread that creates them on most platforms.
+        \note Only OpenGL on MS/Windows prepares swap-chains asynchronously, where choosing a multi-sampled pixel format requires a proxy window and GL context.
+        All other backends create swap-chains quickly enough or cache their pixel formats on first use, in which case this function has no effect.
+        \see CreateSwapChain
+        */
+        virtual void PrepareSwapChainAsync(const SwapChainDescriptor& swapChainDesc);
+
         /* ----- Command queues ----- */
 
-        //! Returns the single instance of the command queue.
+        //! Returns the primary command queue. This is equivalent to <code>GetCommandQueue(CommandQueueType::Graphics)</code>.
         virtual CommandQueue* GetCommandQueue() = 0;
 
+        /**
+        \brief Returns the command queue of the specified type.
+        \param[in] type Specifies the type of command queue. The dedicated queues are created the first time they are requested.
+        \return Pointer to the command queue of the specified type.
+        If the backend has no dedicated queue of this type, the primary command queue is returned, i.e. the same as <code>GetCommandQueue()</code>.
+        This pointer remains valid for the lifetime of the render system.
+        \remarks Command buffers for a dedicated queue must be created with the respective CommandBufferDescriptor::queueType.
+        Independent work on different queues can run in parallel. Dependencies between queues must be synchronized with fences:
+        \code
+        // Simulate particles on the compute queue while the graphics queue renders the previous frame
+        LLGL::CommandQueue* myComputeQueue = myRenderer->GetCommandQueue(LLGL::CommandQueueType::Compute);
+        myComputeQueue->Submit(*myComputeCmdBuffer);
+        myComputeQueue->Submit(*myComputeFence);
+
+        // Let the graphics queue wait on the GPU timeline until the simulation is done
+        myCmdQueue->SubmitWait(*myComputeFence);
+        myCmdQueue->Submit(*myGraphicsCmdBuffer);
+        \endcode
+        \remarks To determine whether a dedicated queue is available, compare the returned pointer to the one returned by GetCommandQueue().
+        \see CommandBufferDescriptor::queueType
+        \see CommandQueue::SubmitWait
+        */
+        virtual CommandQueue* GetCommandQueue(const CommandQueueType type);
+
         /* ----- Command buffers ----- */
 
         /**
@@ -264,6 +348,20 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual Buffer* CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData = nullptr) = 0;
 
+        /**
+        \brief Creates multiple buffers at once.
+        \param[in] bufferDescs Specifies the array of buffer descriptors. Each entry is treated as if it was passed to CreateBuffer.
+        \param[in] initialData Optional pointer to an array of initial data pointers with at least <code>bufferDescs.size()</code> elements.
+        The entry at index \c i is the initial data of the buffer that is created from <code>bufferDescs[i]</code> and may also be null.
+        If this is null, none of the buffers is initialized.
+        \param[out] outBuffers Specifies the output array for the new Buffer objects. This must point to an array with at least <code>bufferDescs.size()</code> elements.
+        \remarks This is intended to load large sets of resources, e.g. when a level is loaded.
+        The initial data of all buffers is uploaded with as few submissions as possible.
+        \note Batched uploads are only supported with: Direct3D 12, Vulkan. All other backends create the buffers one after another.
+        \see CreateBuffer
+        */
+        virtual void CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers) = 0;
+
         /**
         \brief Creates a new buffer array.
 
@@ -282,9 +380,22 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual BufferArray* CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray) = 0;
 
-        //! Releases the specified buffer object. After this call, the specified object must no longer be used.
+        /**
+        \brief Releases the specified buffer object. After this call, the specified object must no longer be used.
+        \remarks This does not wait for the GPU. Command buffers that have already been submitted may still refer to this buffer,
+        so backends that manage GPU memory explicitly, i.e. Direct3D 12 and Vulkan, defer the destruction of the buffer and its memory
+        until all command queues have completed the work that was submitted before this call.
+        */
         virtual void Release(Buffer& buffer) = 0;
 
+        /**
+        \brief Releases multiple buffer objects at once. After this call, the specified objects must no longer be used.
+        \remarks This is equivalent to releasing each buffer individually, except that backends synchronize with the GPU only once for all buffers.
+        With Direct3D 12 and Vulkan, all buffers share the same deferred release. See Release(Buffer&).
+        \see CreateBuffers
+        */
+        virtual void Release(const ArrayView<Buffer*>& buffers) = 0;
+
         //! Releases the specified buffer array object. After this call, the specified object must no longer be used.
         virtual void Release(BufferArray& bufferArray) = 0;
 
@@ -356,6 +467,29 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void UnmapBuffer(Buffer& buffer) = 0;
 
+        /**
+        \brief Makes CPU writes to a mapped memory range visible to the GPU.
+        \param[in] buffer Specifies the buffer whose mapped memory is to be flushed. This buffer must currently be mapped.
+        \param[in] offset Specifies the memory offset (in bytes) from the beginning of the buffer.
+        \param[in] length Specifies the length of the memory block (in bytes) that is to be flushed.
+        \remarks This is only required for buffers that were created with MiscFlags::PersistentMapping and are not unmapped
+        before they are used by the GPU. Backends whose mapped memory is always host coherent ignore this call.
+        The range is expanded internally to satisfy the alignment requirements of non-coherent memory.
+        \see MiscFlags::PersistentMapping
+        */
+        virtual void FlushMappedRange(Buffer& buffer, std::uint64_t offset, std::uint64_t length);
+
+        /**
+        \brief Returns the buffer sizes that are required to build an acceleration structure with the specified descriptor.
+        \param[in] accelerationStructureDesc Specifies the acceleration structure descriptor.
+        Only the type, flags, and the number and layout of the geometries or instances are considered; the buffers that are referenced by the descriptor are ignored.
+        \return Minimum sizes for the acceleration structure buffer and its scratch buffers. If ray tracing is not supported by this render system, all sizes are zero.
+        \see CommandBuffer::BuildAccelerationStructure
+        \see RenderingFeatures::hasRayTracing
+        \note Only supported with: Direct3D 12.
+        */
+        virtual AccelerationStructureSizes GetAccelerationStructureSizes(const AccelerationStructureDescriptor& accelerationStructureDesc);
+
         /* ----- Textures ----- */
 
         /**
@@ -369,9 +503,36 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual Texture* CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage = nullptr) = 0;
 
-        //! Releases the specified texture object. After this call, the specified object must no longer be used.
+        /**
+        \brief Creates multiple textures at once.
+        \param[in] textureDescs Specifies the array of texture descriptors. Each entry is treated as if it was passed to CreateTexture.
+        \param[in] initialImages Optional pointer to an array of image views with at least <code>textureDescs.size()</code> elements.
+        The entry at index \c i provides the initial image of the texture that is created from <code>textureDescs[i]</code>.
+        Entries whose ImageView::data field is null are treated like a null pointer passed to CreateTexture. If this is null, no texture has an initial image.
+        \param[out] outTextures Specifies the output array for the new Texture objects. This must point to an array with at least <code>textureDescs.size()</code> elements.
+        \remarks This is intended to load large sets of resources, e.g. when a level is loaded.
+        The initial images of all textures are uploaded with as few submissions as possible.
+        \note Batched uploads are only supported with: Direct3D 12, Vulkan. All other backends create the textures one after another.
+        \see CreateTexture
+        */
+        virtual void CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures) = 0;
+
+        /**
+        \brief Releases the specified texture object. After this call, the specified object must no longer be used.
+        \remarks This does not wait for the GPU. Command buffers that have already been submitted may still refer to this texture,
+        so backends that manage GPU memory explicitly, i.e. Direct3D 12 and Vulkan, defer the destruction of the texture and its memory
+        until all command queues have completed the work that was submitted before this call.
+        */
         virtual void Release(Texture& texture) = 0;
 
+        /**
+        \brief Releases multiple texture objects at once. After this call, the specified objects must no longer be used.
+        \remarks This is equivalent to releasing each texture individually, except that backends synchronize with the GPU only once for all textures.
+        With Direct3D 12 and Vulkan, all textures share the same deferred release. See Release(Texture&).
+        \see CreateTextures
+        */
+        virtual void Release(const ArrayView<Texture*>& textures) = 0;
+
         /**
         \brief Updates the image data of the specified texture.
 
@@ -389,6 +550,50 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView) = 0;
 
+        /**
+        \brief Updates the image data of multiple texture regions without waiting for the GPU to complete the uploads.
+
+        \param[in] numUploads Specifies the number of texture uploads.
+        \param[in] uploads Pointer to an array of texture upload descriptors. This must point to at least \c numUploads elements.
+        \param[in] fence Optional pointer to a fence that is signaled once all uploads of this call have completed on the GPU.
+        Use Fence::IsSignaled to poll whether the uploads are complete.
+
+        \remarks The source image data is copied into intermediate memory before this function returns,
+        so the memory of all image views can be released immediately after this call.
+        \remarks Uploads are submitted from the coarsest to the finest MIP-map level, regardless of their order in the input array.
+        To make a texture usable before its finest MIP-maps have arrived, upload the coarse MIP-maps (i.e. the MIP-map tail) in a separate call with its own fence
+        and restrict sampling to those MIP-maps until the fence of the remaining uploads has been signaled, e.g. with SamplerDescriptor::minLOD or a texture view.
+        \remarks Just like WriteTexture, this \b cannot be used with multi-sample textures and <b>should not</b> be interleaved with command buffer recording in which these textures are used.
+
+        \note Only Vulkan and Direct3D 12 return before the uploads have completed.
+        All other backends perform the uploads synchronously, in which case the fence is signaled with the next submission to the primary command queue.
+
+        \see WriteTexture
+        \see TextureUploadDescriptor
+        */
+        virtual void WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence = nullptr);
+
+        /**
+        \brief Streams data from files directly into buffers and textures without waiting for the GPU to complete the uploads.
+
+        \param[in] numUploads Specifies the number of file uploads.
+        \param[in] uploads Pointer to an array of file upload descriptors. This must point to at least \c numUploads elements.
+        \param[in] fence Optional pointer to a fence that is signaled once all uploads of this call have completed on the GPU.
+        Use Fence::IsSignaled to poll whether the uploads are complete.
+
+        \remarks With DirectStorage, the file data is read into GPU memory and decompressed on the GPU without any intermediate CPU copies.
+        All other uploads are read into CPU memory first and then written with WriteBuffer and WriteTexture respectively.
+        \remarks Just like WriteBuffer and WriteTexture, this <b>should not</b> be interleaved with command buffer recording in which the destination resources are used.
+
+        \note Only Direct3D 12 streams the data asynchronously and only if LLGL was built with \c LLGL_D3D12_ENABLE_DIRECTSTORAGE
+        and the DirectStorage runtime is available. All other backends read the files synchronously and do not support compressed file data,
+        in which case the fence is signaled with the next submission to the primary command queue.
+
+        \see FileUploadDescriptor
+        \see WriteTextureAsync
+        */
+        virtual void WriteFromFileAsync(std::uint32_t numUploads, const FileUploadDescriptor* uploads, Fence* fence = nullptr);
+
         /**
         \brief Reads the image data from the specified texture.
         \param[in] texture Specifies the texture object to read from.
@@ -426,6 +631,194 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual void ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView) = 0;
 
+        /**
+        \brief Reads the image data from the specified texture without waiting for the GPU to complete the readback.
+        \param[in] texture Specifies the texture object to read from.
+        \param[in] textureRegion Specifies the region where the texture data is to be read.
+        \param[out] dstImageView Specifies the destination image view to write the texture data to.
+        The memory of this image view \b must remain valid until the fence has been signaled.
+        \param[in] fence Specifies the fence that is signaled once the readback has completed.
+        The image data is only written to the destination when the fence is polled or waited on, i.e. once Fence::IsSignaled or CommandQueue::WaitFence returns true.
+
+        \remarks Use this instead of ReadTexture to read back frequently, e.g. for thumbnails or GPU picking, without stalling the GPU pipeline each frame:
+        \code
+        // Frame N: Queue readback of a single pixel
+        myRenderSystem->ReadTextureAsync(*myPickingTexture, myPixelRegion, myPixelImageView, *myPickingFence);
+
+        // Frame N+k: Use the pixel once the readback has completed
+        if (myPickingFence->IsSignaled())
+            HandlePickingResult(myPixel);
+        \endcode
+        \remarks The same fence must not be submitted again until it has been signaled, otherwise the pending readback is completed synchronously at that point.
+
+        \note Only OpenGL returns before the readback has completed, by packing the image data into a pixel buffer that is mapped once the fence has been signaled.
+        All other backends read the texture synchronously, in which case the fence is signaled with the next submission to the primary command queue.
+
+        \see ReadTexture
+        \see Fence::IsSignaled
+        */
+        virtual void ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence);
+
+        /* ----- Placement Heaps ----- */
+
+        /**
+        \brief Creates a new placement heap, i.e. a single block of device memory into which textures can be placed.
+        \param[in] placementHeapDesc Specifies the placement heap descriptor. Its \c size member \b must be greater than zero.
+        \return Pointer to the new placement heap or null if placement heaps are not supported by this render system.
+        \remarks Here is a code example how to share the memory between two intermediate render targets whose lifetimes never overlap:
+        \code
+        // Allocate a single heap that is large enough for the largest texture
+        const LLGL::MemoryRequirements reqs = myRenderer->GetTextureMemoryRequirements(myTextureDesc);
+        LLGL::PlacementHeapDescriptor myHeapDesc;
+        myHeapDesc.size = reqs.size;
+        LLGL::PlacementHeap* myHeap = myRenderer->CreatePlacementHeap(myHeapDesc);
+
+        // Place both textures at the beginning of the heap
+        LLGL::Texture* myTextureA = myRenderer->CreatePlacedTexture(*myHeap, 0, myTextureDesc);
+        LLGL::Texture* myTextureB = myRenderer->CreatePlacedTexture(*myHeap, 0, myTextureDesc);
+
+        // Render into 'myTextureA' ...
+
+        // Switch the memory over to 'myTextureB' before it is used
+        myCmdBuffer->AliasingBarrier(myTextureA, myTextureB);
+
+        // Render into 'myTextureB' ...
+        \endcode
+        \see RenderingFeatures::hasPlacementHeaps
+        \see CreatePlacedTexture
+        \note Only supported with: Vulkan, Direct3D 12, Metal.
+        */
+        virtual PlacementHeap* CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc);
+
+        /**
+        \brief Releases the specified placement heap. After this call, the specified object must no longer be used.
+        \remarks All textures that have been placed into this heap \b must be released before the heap is released.
+        */
+        virtual void Release(PlacementHeap& placementHeap);
+
+        /**
+        \brief Returns the memory requirements of a texture with the specified descriptor if it was placed into a placement heap.
+        \remarks If placement heaps are not supported by this render system, the returned size and alignment are zero.
+        \see CreatePlacedTexture
+        */
+        virtual MemoryRequirements GetTextureMemoryRequirements(const TextureDescriptor& textureDesc);
+
+        /**
+        \brief Creates a new texture whose memory is placed into the specified heap instead of allocating its own memory.
+        \param[in] placementHeap Specifies the heap whose memory is used for the texture.
+        \param[in] offset Specifies the offset (in bytes) into the heap where the texture is placed.
+        This \b must be a multiple of the alignment returned by GetTextureMemoryRequirements for the same texture descriptor,
+        and the texture \b must fit into the remaining size of the heap starting at this offset.
+        \param[in] textureDesc Specifies the texture descriptor. This must not have the flag MiscFlags::Sparse.
+        \remarks Multiple textures can be placed at overlapping memory ranges. Only one of them has valid content at a time,
+        and CommandBuffer::AliasingBarrier \b must be recorded every time the memory switches to another texture.
+        The content of a texture is undefined after its memory has been switched to it, so it must be fully cleared or overwritten first.
+        \remarks Placed textures cannot have initial image data.
+        \remarks With Direct3D 12 on devices with resource heap tier 1, only textures with BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment can be placed.
+        \remarks If placement heaps are not supported by this render system, this creates a regular texture with its own memory.
+        \see CreatePlacementHeap
+        \see GetTextureMemoryRequirements
+        \see CommandBuffer::AliasingBarrier
+        */
+        virtual Texture* CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc);
+
+        /* ----- Sampler Feedback ----- */
+
+        /**
+        \brief Creates a new sampler feedback texture that records which MIP-map levels of its paired texture have been sampled.
+        \param[in] samplerFeedbackDesc Specifies the sampler feedback descriptor.
+        \return Pointer to the new feedback texture or null if sampler feedback is not supported.
+        \remarks The feedback texture is bound to shaders like a storage texture (i.e. with BindFlags::Storage) and written to with \c WriteSamplerFeedback in HLSL.
+        Its initial content is undefined, so it must be cleared with CommandBuffer::ClearSamplerFeedback before it is written to. Release it with Release(Texture&).
+        \remarks Here is a code example how to use it for texture streaming:
+        \code
+        // Create feedback texture for a streamed texture
+        LLGL::SamplerFeedbackDescriptor feedbackDesc;
+        feedbackDesc.pairedTexture  = myStreamedTexture;
+        feedbackDesc.type           = LLGL::SamplerFeedbackType::MinMip;
+        feedbackDesc.mipRegion      = { 64, 64, 1 };
+        LLGL::Texture* myFeedbackTexture = myRenderer->CreateSamplerFeedbackTexture(feedbackDesc);
+
+        // Clear feedback and render scene with 'myFeedbackTexture' bound to the shader ...
+        myCmdBuffer->ClearSamplerFeedback(*myFeedbackTexture);
+
+        // Decode feedback and read it back to determine which MIP-map levels need to be streamed in
+        myCmdBuffer->ResolveSamplerFeedback(*myFeedbackTexture, 0, 0, *myReadbackBuffer, 0);
+        \endcode
+        \see RenderingFeatures::hasSamplerFeedback
+        \see CommandBuffer::ResolveSamplerFeedback
+        \see CommandBuffer::ClearSamplerFeedback
+        \note Only supported with: Direct3D 12.
+        */
+        virtual Texture* CreateSamplerFeedbackTexture(const SamplerFeedbackDescriptor& samplerFeedbackDesc);
+
+        /* ----- Shared Resources ----- */
+
+        /**
+        \brief Exports a native handle of the device memory of the specified resource, so it can be imported by another render system or process.
+        \param[in] resource Specifies the buffer or texture whose memory is exported. This \b must have been created with MiscFlags::Shared.
+        \param[out] outHandle Specifies the output handle. On success, the client programmer takes ownership of the native handle,
+        i.e. file descriptors must be closed with \c close, Win32 handles with \c CloseHandle, and IOSurfaces with \c CFRelease once they are no longer needed.
+        \return True on success. Otherwise, the resource cannot be shared or shared resources are not supported by this render system.
+        \remarks Here is a code example how to share a rendered frame between two render systems without a round trip through CPU memory:
+        \code
+        // Create shareable render target texture on the first device
+        myTextureDesc.miscFlags |= LLGL::MiscFlags::Shared;
+        LLGL::Texture* myTextureA = myRendererA->CreateTexture(myTextureDesc);
+
+        // Export handle of the texture memory and open it on the second device
+        LLGL::SharedResourceHandle mySharedHandle;
+        if (myRendererA->ExportSharedHandle(*myTextureA, mySharedHandle))
+        {
+            LLGL::Texture* myTextureB = myRendererB->ImportTexture(myTextureDesc, mySharedHandle);
+            ...
+        }
+        \endcode
+        \see RenderingFeatures::hasSharedResources
+        \see ImportTexture
+        \see ImportBuffer
+        \note Only supported with: Vulkan, Direct3D 12, Metal (textures only).
+        */
+        virtual bool ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle);
+
+        /**
+        \brief Creates a new texture whose device memory is imported from a shared handle of another render system or process.
+        \param[in] textureDesc Specifies the texture descriptor. This \b must be the same descriptor that was used to create the exported texture, including MiscFlags::Shared.
+        \param[in] sharedHandle Specifies the handle that was retrieved by ExportSharedHandle.
+        On success, the render system takes ownership of file descriptors (SharedHandleType::OpaqueFD);
+        Win32 handles and IOSurfaces remain owned by the client programmer.
+        \return Pointer to the new texture or null if the handle cannot be imported or shared resources are not supported by this render system.
+        \remarks The imported memory is released together with the texture, i.e. with the regular Release function.
+        Imported textures cannot have initial image data and their content is whatever the exporting render system has written to them.
+        \see ExportSharedHandle
+        */
+        virtual Texture* ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle);
+
+        /**
+        \brief Creates a new buffer whose device memory is imported from a shared handle of another render system or process.
+        \param[in] bufferDesc Specifies the buffer descriptor. This \b must be the same descriptor that was used to create the exported buffer, including MiscFlags::Shared.
+        \param[in] sharedHandle Specifies the handle that was retrieved by ExportSharedHandle. Ownership is transferred the same way as for ImportTexture.
+        \return Pointer to the new buffer or null if the handle cannot be imported or shared resources are not supported by this render system.
+        \see ExportSharedHandle
+        \see ImportTexture
+        \note Only supported with: Vulkan, Direct3D 12.
+        */
+        virtual Buffer* ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle);
+
+        /**
+        \brief Exports an OS handle of the specified fence so it can be waited on by another API or process, e.g. a hardware video encoder.
+        \param[in] fence Specifies the fence whose native timeline object is to be exported.
+        \param[out] outHandle Specifies the output handle. The client programmer owns the exported handle and must close it when it's no longer needed.
+        The \c size field is always zero for fences.
+        \return True if the handle has been exported successfully. Otherwise, the backend does not support shareable fences.
+        \remarks The exported object is a timeline fence, i.e. an \c ID3D12Fence or a \c VkSemaphore of type \c VK_SEMAPHORE_TYPE_TIMELINE.
+        The value to wait for after each submission can be queried with Fence::GetNativeHandle.
+        \see Fence::GetNativeHandle
+        \see SwapChain::GetCurrentBackBufferNativeHandle
+        \note Only supported with: Vulkan (requires \c VK_KHR_timeline_semaphore and \c VK_KHR_external_semaphore_fd or \c VK_KHR_external_semaphore_win32), Direct3D 12.
+        */
+        virtual bool ExportSharedFence(Fence& fence, SharedResourceHandle& outHandle);
+
         /* ----- Samplers ---- */
 
         /**
@@ -525,6 +918,20 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual Shader* CreateShader(const ShaderDescriptor& shaderDesc) = 0;
 
+        /**
+        \brief Creates multiple Shader objects at once and compiles their sources concurrently if the backend supports it.
+        \param[in] shaderDescs Specifies the array of shader descriptors. Each entry is treated as if it was passed to CreateShader.
+        \param[out] outShaders Specifies the output array for the new Shader objects. This must point to an array with at least <code>shaderDescs.size()</code> elements.
+        The entry at index \c i receives the shader that was created from <code>shaderDescs[i]</code>.
+        \remarks This is intended to warm up large sets of independent shader permutations.
+        The compilation result of each shader must be checked individually with its \c GetReport function.
+        Shaders are compiled on the worker thread pool (see ThreadPool::Configure) and this function returns once all of them have been created.
+        \note Concurrent compilation is only supported with: Direct3D 11, Direct3D 12. All other backends create the shaders one after another.
+        \see CreateShader
+        \see Shader::GetReport
+        */
+        virtual void CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders) = 0;
+
         //! Releases the specified Shader object. After this call, the specified object must no longer be used.
         virtual void Release(Shader& shader) = 0;
 
@@ -576,8 +983,12 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         \param[out] pipelineCache Optional pointer to pipeline cache.
 
+        \remarks Each call creates a new PSO, even if the descriptor is identical to that of an existing one.
+        Use PipelineStateRegistry to share PSOs that are created with identical descriptors.
+
         \see GraphicsPipelineDescriptor
         \see CreatePipelineState(const Blob&)
+        \see PipelineStateRegistry
         */
         virtual PipelineState* CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache = nullptr) = 0;
 
@@ -594,6 +1005,47 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual PipelineState* CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache = nullptr) = 0;
 
+        /**
+        \brief Creates multiple graphics pipeline state objects (PSOs) at once.
+        \param[in] pipelineStateDescs Specifies the array of graphics PSO descriptors. Each entry is treated as if it was passed to CreatePipelineState.
+        \param[out] outPipelineStates Specifies the output array for the new PSOs. This must point to an array with at least <code>pipelineStateDescs.size()</code> elements.
+        The entry at index \c i receives the PSO that was created from <code>pipelineStateDescs[i]</code>.
+        \param[in] pipelineCache Optional pointer to a pipeline cache that is used for all PSOs.
+        \remarks This is intended to warm up large sets of PSO permutations, e.g. during a loading screen.
+        The creation result of each PSO must be checked individually with its \c GetReport function.
+        PSOs with PipelineStateFlags::AsyncCompilation are not part of a native batch and are still compiled asynchronously.
+        \note Creating all PSOs with a single native call is only supported with: Vulkan.
+        Creating the PSOs concurrently on the worker thread pool (see ThreadPool::Configure) is only supported with: Direct3D 12.
+        All other backends create the PSOs one after another.
+        \see CreatePipelineState(const GraphicsPipelineDescriptor&, PipelineCache*)
+        */
+        virtual void CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache = nullptr) = 0;
+
+        /**
+        \brief Creates multiple compute pipeline state objects (PSOs) at once.
+        \remarks This behaves the same as the overload for graphics PSOs.
+        \see CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>&, PipelineState**, PipelineCache*)
+        \see CreatePipelineState(const ComputePipelineDescriptor&, PipelineCache*)
+        */
+        virtual void CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache = nullptr) = 0;
+
+        /**
+        \brief Creates a new ray tracing pipeline state object (PSO).
+
+        \param[in] pipelineStateDesc Specifies the ray tracing PSO descriptor. This will describe the entire pipeline state including its shader binding table.
+        The \c rayGenerationShader member of the descriptor must never be null!
+
+        \param[out] pipelineCache Optional pointer to pipeline cache. This is currently ignored for ray tracing PSOs.
+
+        \return Pointer to the new PSO or null if ray tracing is not supported by this render system.
+
+        \see RayTracingPipelineDescriptor
+        \see CommandBuffer::DispatchRays
+        \see RenderingFeatures::hasRayTracing
+        \note Only supported with: Direct3D 12.
+        */
+        virtual PipelineState* CreatePipelineState(const RayTracingPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache = nullptr) = 0;
+
         //! Releases the specified PipelineState object. After this call, the specified object must no longer be used.
         virtual void Release(PipelineState& pipelineState) = 0;
 
@@ -609,8 +1061,11 @@ class LLGL_EXPORT RenderSystem : public Interface
 
         /**
         \brief Creates a new fence (used for CPU/GPU synchronization).
+        \remarks The Direct3D 12 and Vulkan backends recycle released timeline fences, so creating and releasing fences frequently avoids native allocations.
+        A released fence is only handed out again once its last submission has completed. Fences whose native handle has been retrieved or exported are never recycled.
         \see CommandBuffer::SubmitFence
         \see CommandBuffer::WaitFence
+        \see Fence::IsSignaled
         */
         virtual Fence* CreateFence() = 0;
 
@@ -679,6 +1134,12 @@ class LLGL_EXPORT RenderSystem : public Interface
         LLGL_DEPRECATED("RenderSystem::SetRendererInfo() is deprecated since 0.04b; Implement QueryRendererDetails() instead!")
         void SetRenderingCaps(const RenderingCapabilities& caps);
 
+        /**
+        \brief Evaluates the memory budget callback if one has been set with SetMemoryBudgetCallback.
+        \remarks Backends call this after a buffer or texture has been created. This does nothing if no callback is set.
+        */
+        void CheckMemoryBudget();
+
     protected:
 
         /**
@@ -690,6 +1151,24 @@ class LLGL_EXPORT RenderSystem : public Interface
         */
         virtual bool QueryRendererDetails(RendererInfo* outInfo, RenderingCapabilities* outCaps) = 0;
 
+        /**
+        \brief Queries the current usage and budget of all memory heaps.
+        \param[out] outHeapInfos Specifies the output array of heap infos. This may be null.
+        \param[in] maxHeapInfos Specifies the maximum number of entries that can be written to \c outHeapInfos.
+        \return Number of memory heaps the device provides, or 0 if this query is not supported.
+        \see QueryMemoryHeaps
+        */
+        virtual std::uint32_t QueryMemoryHeapInfos(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos) = 0;
+
+        /**
+        \brief Queries information about all video adapters the rendering API enumerates.
+        \param[out] outAdapters Specifies the output array of adapter infos. This may be null.
+        \param[in] maxAdapters Specifies the maximum number of entries that can be written to \c outAdapters.
+        \return Number of video adapters.
+        \see QueryAdapters
+        */
+        virtual std::uint32_t QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters) = 0;
+
     protected:
 
         //! Validates the specified buffer descriptor to be used for buffer creation.
@@ -713,6 +1192,10 @@ class LLGL_EXPORT RenderSystem : public Interface
             std::uint32_t           rowStride       = 0
         );
 
+    private:
+
+        void InvokeMemoryBudgetCallback(const MemoryHeapInfo* heapInfos, std::uint32_t numHeaps);
+
     private:
 
         struct Pimpl;
@@ -36,6 +36,8 @@ namespace LLGL
 
 
 class RenderingDebugger;
+class Buffer;
+class Texture;
 
 /* ----- Enumerations ----- */
 
@@ -105,6 +107,8 @@ enum class ShadingLanguage
     SPIRV           = (0x50000),        //!< SPIR-V Shading Language.
     SPIRV_100       = (0x50000 | 100),  //!< SPIR-V 1.0.
 
+    WGSL            = (0x60000),        //!< WGSL (WebGPU Shading Language).
+
     VersionBitmask  = 0x0000ffff,       //!< Bitmask for the version number of each shading language enumeration entry.
 };
 
@@ -183,6 +187,22 @@ enum class CPUAccess
     ReadWrite,
 };
 
+/**
+\brief Compression formats of file data that is streamed into GPU resources.
+\see FileUploadDescriptor::compression
+*/
+enum class FileCompression
+{
+    //! The file data is not compressed and is copied into the destination resource as is.
+    Uncompressed,
+
+    /**
+    \brief The file data is compressed with GDeflate and is decompressed on the GPU if the backend supports it.
+    \note Only supported with: Direct3D 12 (if LLGL was built with \c LLGL_D3D12_ENABLE_DIRECTSTORAGE).
+    */
+    GDeflate,
+};
+
 
 /* ----- Flags ----- */
 
@@ -240,6 +260,83 @@ struct RenderSystemFlags
         \see DebugDevice
         */
         DebugBreakOnError   = (1 << 5),
+
+        /**
+        \brief Specifies that the render system is used without any surface, e.g. for server-side rendering into offscreen render targets.
+        \remarks If this flag is specified, no window system is required and no swap-chain can be created.
+        Here is an overview of what impact this flag has to the respective renderer:
+        - OpenGL: On GNU/Linux, the GL contexts are created via EGL without any drawable, i.e. with \c EGL_KHR_surfaceless_context or a pbuffer as fallback.
+          This requires LLGL to be built with the \c LLGL_GL_ENABLE_EGL option and is not supported on any other platform.
+        - Vulkan: The instance is created without any surface extensions and \c VK_KHR_swapchain is no longer required.
+        - Direct3D 11, Direct3D 12, Metal: These backends never depend on a surface to create their device, so this flag only prevents swap-chains from being created.
+        \see RenderSystemDescriptor::adapterIndex
+        */
+        Headless            = (1 << 6),
+
+        /**
+        \brief Specifies that queue submissions and presentations are executed on a dedicated submission thread owned by the render system.
+        \remarks If this flag is specified, CommandQueue::Submit and SwapChain::Present enqueue their work and return immediately,
+        so the calling thread can continue with the next frame while the native present call blocks, e.g. for vsync.
+        All submissions are executed in the order they were enqueued. Use Fence objects to track their completion on the GPU.
+        Functions that access the native command queue directly, such as RenderSystem::WriteBuffer, RenderSystem::ReadBuffer, CommandQueue::WaitIdle,
+        or CommandQueue::QueryResult, first wait until all pending submissions have been executed.
+        Therefore, CommandBuffer::UpdateBuffer should be preferred over RenderSystem::WriteBuffer to update resources per frame.
+        Accessing the back buffers of a swap-chain, e.g. with CommandBuffer::BeginRenderPass, waits until its pending presentation has been executed.
+        Exceptions that are thrown on the submission thread are rethrown by the next function that waits for it.
+        \note Only supported with: Direct3D 12, Vulkan.
+        */
+        SubmissionThread    = (1 << 7),
+    };
+};
+
+/**
+\brief Memory heap flags enumeration.
+\see MemoryHeapInfo::flags
+*/
+struct MemoryHeapFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the memory heap is local to the GPU, i.e. it resides in dedicated video memory.
+        \remarks On devices with unified memory architecture (UMA), system memory that is shared with the GPU is also reported as device local.
+        */
+        DeviceLocal = (1 << 0),
+    };
+};
+
+/**
+\brief Subgroup operation flags enumeration.
+\remarks Subgroups are also referred to as "waves" in HLSL and "SIMD-groups" in Metal.
+\see RenderingLimits::subgroupOperationFlags
+*/
+struct SubgroupOperationFlags
+{
+    enum
+    {
+        //! Subgroup elections and barriers, e.g. \c subgroupElect in GLSL, \c WaveIsFirstLane in HLSL, and \c simd_is_first in Metal.
+        Basic           = (1 << 0),
+
+        //! Subgroup votes, e.g. \c subgroupAll in GLSL, \c WaveActiveAllTrue in HLSL, and \c simd_all in Metal.
+        Vote            = (1 << 1),
+
+        //! Subgroup reductions and prefix operations, e.g. \c subgroupAdd in GLSL, \c WaveActiveSum in HLSL, and \c simd_sum in Metal.
+        Arithmetic      = (1 << 2),
+
+        //! Subgroup ballots and broadcasts, e.g. \c subgroupBallot in GLSL, \c WaveActiveBallot in HLSL, and \c simd_ballot in Metal.
+        Ballot          = (1 << 3),
+
+        //! Subgroup shuffles with arbitrary indices, e.g. \c subgroupShuffle in GLSL, \c WaveReadLaneAt in HLSL, and \c simd_shuffle in Metal.
+        Shuffle         = (1 << 4),
+
+        //! Subgroup shuffles with relative indices, e.g. \c subgroupShuffleUp in GLSL and \c simd_shuffle_up in Metal.
+        ShuffleRelative = (1 << 5),
+
+        //! Subgroup operations on clusters of invocations, e.g. \c subgroupClusteredAdd in GLSL.
+        Clustered       = (1 << 6),
+
+        //! Subgroup operations on quads, e.g. \c subgroupQuadBroadcast in GLSL, \c QuadReadLaneAt in HLSL, and \c quad_broadcast in Metal.
+        Quad            = (1 << 7),
     };
 };
 
@@ -313,6 +410,46 @@ struct RendererInfo
     std::vector<char>       pipelineCacheID;
 };
 
+/**
+\brief Callback to allocate memory for render system child objects.
+\param[in] size Specifies the size (in bytes) of the memory block to allocate.
+\param[in] alignment Specifies the alignment (in bytes) of the memory block. This is always a power of two.
+\param[in] userData Specifies the user data pointer from AllocatorDescriptor::userData.
+\return Pointer to the new memory block or null if the allocation failed.
+\see AllocatorDescriptor::allocate
+*/
+typedef void* (*AllocateCallback)(std::size_t size, std::size_t alignment, void* userData);
+
+/**
+\brief Callback to free memory that was previously allocated with an AllocateCallback.
+\param[in] ptr Specifies the memory block to free. This is never null.
+\param[in] size Specifies the size (in bytes) that was passed to the AllocateCallback for this memory block.
+\param[in] alignment Specifies the alignment (in bytes) that was passed to the AllocateCallback for this memory block.
+\param[in] userData Specifies the user data pointer from AllocatorDescriptor::userData.
+\see AllocatorDescriptor::free
+*/
+typedef void (*FreeCallback)(void* ptr, std::size_t size, std::size_t alignment, void* userData);
+
+/**
+\brief Allocator descriptor structure for the memory of render system child objects.
+\remarks Render system child objects such as Buffer, Texture, Sampler, and ResourceHeap are allocated from slab pools,
+which are segregated by object type. Consecutive objects of the same type are packed into the same slab,
+and releasing an object returns its memory block to the pool in constant time.
+These callbacks only allocate and free the slabs themselves, i.e. they are invoked far less often than objects are created and released.
+\see RenderSystemDescriptor::allocator
+*/
+struct AllocatorDescriptor
+{
+    //! Callback to allocate the memory of a slab. If this is null, the default allocator is used.
+    AllocateCallback    allocate    = nullptr;
+
+    //! Callback to free the memory of a slab. This must be specified if \c allocate is specified.
+    FreeCallback        free        = nullptr;
+
+    //! User data pointer that is passed to both callbacks. By default null.
+    void*               userData    = nullptr;
+};
+
 /**
 \brief Render system descriptor structure.
 \remarks This can be used for some refinements of a specific renderer, e.g. to configure the Vulkan device memory manager.
@@ -354,6 +491,37 @@ struct RenderSystemDescriptor
     */
     long                flags               = 0;
 
+    /**
+    \brief Specifies the zero-based index of the video adapter the render system is created with. By default -1.
+    \remarks This can be used on multi-GPU systems to pin each process to one specific device, e.g. for server-side rendering.
+    The index refers to the order in which the rendering API enumerates its adapters, i.e. \c IDXGIFactory::EnumAdapters for Direct3D,
+    \c vkEnumeratePhysicalDevices for Vulkan, \c MTLCopyAllDevices for Metal, and \c eglQueryDevicesEXT for headless OpenGL contexts.
+    If this is negative, the adapter is selected by \c adapterLUID, \c adapterUUID, or the \c Prefer* entries of RenderSystemFlags instead.
+    If this is out of range, the render system fails to load.
+    \note Only supported with: Direct3D 11, Direct3D 12, Vulkan, Metal, and OpenGL with RenderSystemFlags::Headless on GNU/Linux.
+    \see RenderSystemFlags::PreferNVIDIA
+    \see RenderSystemFlags::Headless
+    \see RenderSystem::QueryAdapters
+    */
+    int                 adapterIndex        = -1;
+
+    /**
+    \brief Specifies the locally unique identifier (LUID) of the video adapter the render system is created with. By default 0.
+    \remarks This is only considered if \c adapterIndex is negative. If no adapter with this LUID exists, the render system fails to load.
+    Unlike the adapter index, this identifier does not change when adapters are enumerated in a different order, but only remains valid until the system reboots.
+    \note Only supported with: Direct3D 11, Direct3D 12, Vulkan (Windows only), and Metal (where this is the \c registryID of the device).
+    \see AdapterInfo::luid
+    */
+    std::uint64_t       adapterLUID         = 0;
+
+    /**
+    \brief Specifies the universally unique identifier (UUID) of the video adapter the render system is created with. By default all zeros.
+    \remarks This is only considered if \c adapterIndex is negative and \c adapterLUID is 0. If no adapter with this UUID exists, the render system fails to load.
+    \note Only supported with: Vulkan 1.1.
+    \see AdapterInfo::uuid
+    */
+    std::uint8_t        adapterUUID[16]     = {};
+
     //! \deprecated Since 0.04b; Use LLGL::RenderSystemDescriptor::debugger instead!
     void*               profiler            = nullptr;
 
@@ -385,6 +553,7 @@ struct RenderSystemDescriptor
     \see rendererConfigSize
     \see RendererConfigurationVulkan
     \see RendererConfigurationOpenGL
+    \see RendererConfigurationNull
     */
     const void*         rendererConfig      = nullptr;
 
@@ -428,6 +597,44 @@ struct RenderSystemDescriptor
     */
     std::size_t         nativeHandleSize    = 0;
 
+    /**
+    \brief Optional path to a directory where the render system persistently stores its pipeline caches across application runs. By default null.
+    \remarks If this is specified, every pipeline state that is created without an explicit PipelineCache object is automatically looked up in
+    and written to this directory, i.e. the application does not need to serialize PipelineCache::GetBlob itself.
+    Entries are stored in a sub-directory that is derived from RendererInfo::pipelineCacheID,
+    so a change of the device or driver version invalidates all previous entries automatically.
+    The directory is created if it does not exist yet.
+    For OpenGL, the programs of shaders that are compiled with ShaderCompileFlags::SeparateShader are cached as well.
+    \note Only supported with: Vulkan, Direct3D 12, OpenGL.
+    \see RendererInfo::pipelineCacheID
+    \see RenderSystem::CreatePipelineState
+    */
+    const char*         pipelineCacheDirectory = nullptr;
+
+    /**
+    \brief Optional filename of an archive where the render system persistently stores compiled shader bytecode across application runs. By default null.
+    \remarks If this is specified, every shader that is created from high-level source code is first looked up in this archive,
+    which is keyed by a hash of the source code, macro definitions, entry point, profile, compiler flags and the shader compiler.
+    The archive is memory mapped, so a cache hit neither reads nor compiles the shader source.
+    Newly compiled shaders are written back to the archive when the render system is unloaded.
+    \remarks Files included by the shader source code are not part of the key, i.e. the archive must be deleted manually when only an included file changes.
+    Likewise, a cache hit does not reproduce compiler warnings in the shader report.
+    \note Only supported with: Direct3D 11, Direct3D 12.
+    \see ShaderDescriptor
+    \see RenderSystem::CreateShader
+    */
+    const char*         shaderCacheFilename = nullptr;
+
+    /**
+    \brief Optional allocator callbacks for the slab pools of render system child objects. By default, the slabs are allocated with the global \c new operator.
+    \remarks The slab pools are shared by all render systems in the process.
+    Therefore, the callbacks are used for all slabs that are allocated after this render system has been loaded,
+    and the callbacks must remain valid until all render systems using them have been unloaded.
+    Each slab is freed with the callbacks it was allocated with.
+    \see AllocatorDescriptor
+    */
+    AllocatorDescriptor allocator;
+
     #ifdef LLGL_OS_ANDROID
 
     /**
@@ -683,6 +890,159 @@ struct RenderingFeatures
     \see CommandBuffer:BeginRenderCondition
     */
     bool hasRenderCondition             = false;
+
+    /**
+    \brief Specifies whether timestamp queries are supported.
+    \see QueryType::Timestamp
+    */
+    bool hasTimestampQueries            = false;
+
+    /**
+    \brief Specifies whether query results can be copied into buffers on the GPU.
+    \note Only supported with: Vulkan, Direct3D 12, OpenGL, Metal.
+    \see CommandBuffer::ResolveQueryData
+    */
+    bool hasQueryResolve                = false;
+
+    /**
+    \brief Specifies whether bindless resource heaps are supported, i.e. large partially bound heap binding arrays that can be updated while they are bound.
+    \see PipelineLayoutFlags::BindlessHeap
+    \see RenderingLimits::maxBindlessResourceViews
+    */
+    bool hasBindlessResourceHeaps       = false;
+
+    /**
+    \brief Specifies whether indirect draw commands with a number of draw commands taken from a buffer object are supported.
+    \see CommandBuffer::DrawIndirectCount
+    \see CommandBuffer::DrawIndexedIndirectCount
+    */
+    bool hasIndirectCountDrawing        = false;
+
+    /**
+    \brief Specifies whether mesh pipelines with task and mesh shaders are supported.
+    \see ShaderType::Task
+    \see ShaderType::Mesh
+    \see CommandBuffer::DrawMeshTasks
+    \see CommandBuffer::DrawMeshTasksIndirect
+    */
+    bool hasMeshShaders                 = false;
+
+    /**
+    \brief Specifies whether tile pipelines with tile shaders are supported.
+    \see ShaderType::Tile
+    \see GraphicsPipelineDescriptor::tileShader
+    \see CommandBuffer::DispatchTiles
+    */
+    bool hasTileShaders                 = false;
+
+    /**
+    \brief Specifies whether fragment shaders can read the current color attachment values of the fragment they are executed for (also referred to as "Programmable Blending").
+    \remarks For Metal, this allows fragment shader inputs with the \c [[color(n)]] attribute.
+    For GLES, this is determined by the \c GL_EXT_shader_framebuffer_fetch extension, which allows \c inout fragment shader outputs.
+    */
+    bool hasFramebufferFetch            = false;
+
+    /**
+    \brief Specifies whether the fragment shading rate can be set per draw command.
+    \remarks Shading-rate attachments are only supported if RenderingLimits::shadingRateImageTileSize is non-zero.
+    \see CommandBuffer::SetShadingRate
+    \see RenderingLimits::shadingRateImageTileSize
+    */
+    bool hasVariableRateShading         = false;
+
+    /**
+    \brief Specifies whether indirect command signatures can change uniforms between consecutive indirect draw or dispatch commands.
+    \see CommandBuffer::ExecuteIndirect
+    \see IndirectArgumentType::Uniforms
+    */
+    bool hasIndirectStateChanges        = false;
+
+    /**
+    \brief Specifies whether transient buffer memory can be allocated from command buffers.
+    \see CommandBuffer::AllocTransientBuffer
+    */
+    bool hasTransientBuffers            = false;
+
+    /**
+    \brief Specifies whether buffers can stay mapped into CPU memory space while they are used by the GPU.
+    \see MiscFlags::PersistentMapping
+    \see RenderSystem::FlushMappedRange
+    */
+    bool hasPersistentMapping           = false;
+
+    /**
+    \brief Specifies whether textures can be created without committed memory and mapped to device memory tile by tile.
+    \see MiscFlags::Sparse
+    \see CommandQueue::UpdateTileMappings
+    \see RenderingLimits::sparseTileSize
+    */
+    bool hasSparseTextures              = false;
+
+    /**
+    \brief Specifies whether textures can be placed into placement heaps to share (or alias) their device memory.
+    \see RenderSystem::CreatePlacementHeap
+    \see RenderSystem::CreatePlacedTexture
+    \see CommandBuffer::AliasingBarrier
+    */
+    bool hasPlacementHeaps              = false;
+
+    /**
+    \brief Specifies whether the device memory of textures and buffers can be exported to and imported from other render systems or processes.
+    \see MiscFlags::Shared
+    \see RenderSystem::ExportSharedHandle
+    \see RenderSystem::ImportTexture
+    \see RenderSystem::ImportBuffer
+    */
+    bool hasSharedResources             = false;
+
+    /**
+    \brief Specifies whether resources can be created and released on multiple threads at the same time.
+    \remarks If this is true, RenderSystem::CreateBuffer, RenderSystem::CreateTexture, RenderSystem::CreateSampler, RenderSystem::CreateShader,
+    RenderSystem::CreatePipelineLayout, RenderSystem::CreatePipelineState, and the respective RenderSystem::Release functions can be called from worker threads,
+    also while other threads encode command buffers and submit them to a command queue.
+    All other functions of the render system must still be called by one thread at a time.
+    \note Only supported with: Vulkan, Direct3D 12, Metal.
+    \see RendererConfigurationOpenGL
+    */
+    bool hasConcurrentResourceCreation  = false;
+
+    /**
+    \brief Specifies whether the device supports hardware accelerated ray tracing, i.e. acceleration structures and ray tracing pipelines.
+    \remarks If this is true, buffers can be created with BindFlags::AccelerationStructure and built with CommandBuffer::BuildAccelerationStructure,
+    ray tracing PSOs can be created with RayTracingPipelineDescriptor, and rays can be dispatched with CommandBuffer::DispatchRays.
+    \note Only supported with: Direct3D 12.
+    \see hasRayQuery
+    */
+    bool hasRayTracing                  = false;
+
+    /**
+    \brief Specifies whether shaders can trace rays inline, i.e. without a ray tracing pipeline (\c RayQuery in HLSL, \c GL_EXT_ray_query in GLSL, and \c intersector in Metal).
+    \remarks If this is true, top-level acceleration structures can be bound to any shader stage with a binding of type ResourceType::Buffer and BindFlags::AccelerationStructure.
+    Acceleration structures are created and built as described for hasRayTracing.
+    \remarks Check this flag before creating a pipeline layout with such a binding. Backends without inline ray queries cannot create these pipeline layouts.
+    \note Only supported with: Direct3D 12.
+    \see hasRayTracing
+    */
+    bool hasRayQuery                    = false;
+
+    /**
+    \brief Specifies whether render passes and graphics pipelines can render into multiple views with a single draw command (also referred to as "View Instancing").
+    \remarks The shader selects the output for each view via \c gl_ViewIndex (Vulkan GLSL), \c gl_ViewID_OVR (GLSL), \c SV_ViewID (HLSL), or \c [[amplification_id]] (Metal).
+    \note Only supported with: Vulkan, Direct3D 12, Metal, OpenGL (with \c GL_OVR_multiview2).
+    \see RenderPassDescriptor::viewMask
+    \see GraphicsPipelineDescriptor::viewMask
+    \see RenderingLimits::maxMultiviewViewCount
+    */
+    bool hasMultiview                   = false;
+
+    /**
+    \brief Specifies whether sampler feedback textures are supported to record which MIP-map levels of a texture have been sampled.
+    \remarks This is used for texture streaming, so only the MIP-map levels that are actually sampled need to be resident.
+    \note Only supported with: Direct3D 12.
+    \see RenderSystem::CreateSamplerFeedbackTexture
+    \see CommandBuffer::ResolveSamplerFeedback
+    */
+    bool hasSamplerFeedback             = false;
 };
 
 LLGL_DEPRECATED_IGNORE_POP()
@@ -761,6 +1121,12 @@ struct RenderingLimits
     //! Specifies the maximum work group size in a compute shader.
     std::uint32_t   maxComputeShaderWorkGroupSize[3]    = { 0, 0, 0 };
 
+    /**
+    \brief Specifies the maximum size (in bytes) of shared memory per work group in a compute shader.
+    \remarks Equivalent of the total size of all \c groupshared variables in HLSL, \c shared variables in GLSL, and \c threadgroup variables in Metal.
+    */
+    std::uint32_t   maxComputeShaderSharedMemorySize    = 0;
+
     /**
     \brief Specifies the maximum number of viewports and scissor rectangles the render system supports. Upper limit is specified by \c LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS.
     \see CommandBuffer::SetViewports
@@ -871,6 +1237,61 @@ struct RenderingLimits
     \see RenderingFeatures::hasStorageBuffers
     */
     long            storageResourceStageFlags           = 0;
+
+    /**
+    \brief Specifies the maximum number of resource views per shader stage in a bindless resource heap.
+    \remarks If bindless resource heaps are not supported, this is zero.
+    \see RenderingFeatures::hasBindlessResourceHeaps
+    \see PipelineLayoutFlags::BindlessHeap
+    */
+    std::uint32_t   maxBindlessResourceViews            = 0;
+
+    /**
+    \brief Specifies the size (in bytes) of a single tile of sparse textures. This is typically 64 KB.
+    \remarks If sparse textures are not supported, this is zero.
+    \see RenderingFeatures::hasSparseTextures
+    \see GetSparseTileExtent
+    */
+    std::uint32_t   sparseTileSize                      = 0;
+
+    /**
+    \brief Specifies the size (in pixels) of the screen tile that is covered by a single texel of a shading-rate attachment. This is typically 8 or 16.
+    \remarks If shading-rate attachments are not supported, this is zero.
+    A shading-rate attachment for a render target with resolution (W, H) must have a size of at least <code>(ceil(W/T), ceil(H/T))</code> where T is this tile size.
+    \see RenderTargetDescriptor::shadingRateAttachment
+    \see RenderingFeatures::hasVariableRateShading
+    */
+    std::uint32_t   shadingRateImageTileSize            = 0;
+
+    /**
+    \brief Specifies the minimum and maximum number of invocations per subgroup, aka. wave lane count in HLSL and SIMD-group width in Metal.
+    \remarks If the subgroup size is fixed, both values are equal. If subgroups are not supported, both values are zero.
+    Work group sizes should be a multiple of the maximum subgroup size to fully occupy all subgroups.
+    \remarks For Metal, this is the range of the GPU family, since the exact SIMD-group width is only known per PSO (\c threadExecutionWidth).
+    \see subgroupOperationFlags
+    */
+    std::uint32_t   subgroupSizeRange[2]                = { 0, 0 };
+
+    /**
+    \brief Specifies the shader stages in which subgroup operations can be used.
+    \remarks If subgroups are not supported, this is zero.
+    */
+    long            subgroupStageFlags                  = 0;
+
+    /**
+    \brief Specifies the supported subgroup operations. This can be a bitwise OR combination of the SubgroupOperationFlags entries.
+    \remarks If subgroups are not supported, this is zero.
+    \see SubgroupOperationFlags
+    */
+    long            subgroupOperationFlags              = 0;
+
+    /**
+    \brief Specifies the maximum number of views for multiview rendering, i.e. the highest bit of a view mask must be less than this value.
+    \remarks If multiview rendering is not supported, this is zero. This value is at most 32.
+    \see RenderingFeatures::hasMultiview
+    \see RenderPassDescriptor::viewMask
+    */
+    std::uint32_t   maxMultiviewViewCount               = 0;
 };
 
 /**
@@ -916,6 +1337,123 @@ struct RenderingCapabilities
     RenderingLimits                 limits;
 };
 
+/**
+\brief Memory heap information structure.
+\remarks This describes how much memory of a single heap is currently in use by the process and how much the operating system or driver allows it to use.
+\see RenderSystem::QueryMemoryHeaps
+*/
+struct MemoryHeapInfo
+{
+    //! Specifies the memory heap flags. This can be a bitwise OR combination of the MemoryHeapFlags entries.
+    long            flags   = 0;
+
+    //! Specifies the total size (in bytes) of this memory heap. This may be 0 if the backend cannot determine the heap size.
+    std::uint64_t   size    = 0;
+
+    /**
+    \brief Specifies the amount of memory (in bytes) that is currently allocated by this process within this memory heap.
+    \remarks Depending on the backend, this is either reported by the driver or tracked by LLGL itself.
+    */
+    std::uint64_t   usage   = 0;
+
+    /**
+    \brief Specifies the amount of memory (in bytes) this process can allocate within this memory heap before the driver is expected to start paging or allocations fail.
+    \remarks This value can change at any time, e.g. when other applications allocate or release video memory.
+    If the backend cannot query an actual budget, this is equal to \c size.
+    */
+    std::uint64_t   budget  = 0;
+};
+
+/**
+\brief Video adapter information structure.
+\remarks This describes one of the video adapters (i.e. GPUs) the rendering API of a render system enumerates.
+Use the index of an entry, its LUID, or its UUID to create another render system on that particular adapter.
+\see RenderSystem::QueryAdapters
+\see RenderSystemDescriptor::adapterIndex
+*/
+struct AdapterInfo
+{
+    //! Device name of the video adapter (e.g. "NVIDIA GeForce RTX 4090").
+    UTF8String      name;
+
+    //! PCI vendor ID of the video adapter (e.g. 0x10DE for NVIDIA). This is 0 if the backend cannot determine the vendor.
+    std::uint32_t   vendorID        = 0;
+
+    //! PCI device ID of the video adapter. This is 0 if the backend cannot determine the device.
+    std::uint32_t   deviceID        = 0;
+
+    //! Specifies the size (in bytes) of the dedicated video memory. This is 0 if the backend cannot determine the memory size.
+    std::uint64_t   videoMemory     = 0;
+
+    //! Specifies the size (in bytes) of the system memory the video adapter can share with the CPU.
+    std::uint64_t   sharedMemory    = 0;
+
+    /**
+    \brief Locally unique identifier (LUID) of the video adapter. This is 0 if the backend cannot determine such an identifier.
+    \remarks This identifier is stable until the system reboots. It is taken from \c DXGI_ADAPTER_DESC::AdapterLuid for Direct3D,
+    \c VkPhysicalDeviceIDProperties::deviceLUID for Vulkan on Windows, and \c MTLDevice.registryID for Metal.
+    \see RenderSystemDescriptor::adapterLUID
+    */
+    std::uint64_t   luid            = 0;
+
+    /**
+    \brief Universally unique identifier (UUID) of the video adapter. This is all zeros if the backend cannot determine such an identifier.
+    \remarks This is taken from \c VkPhysicalDeviceIDProperties::deviceUUID for Vulkan 1.1 and is the same across processes, APIs, and reboots.
+    \see RenderSystemDescriptor::adapterUUID
+    */
+    std::uint8_t    uuid[16]        = {};
+
+    //! Specifies whether this is the video adapter the render system was created with.
+    bool            isActive        = false;
+};
+
+/**
+\brief File upload descriptor structure to stream data from a file directly into a buffer or texture.
+\remarks Either \c buffer or \c texture must be specified, but not both.
+\see RenderSystem::WriteFromFileAsync
+*/
+struct FileUploadDescriptor
+{
+    //! Specifies the UTF-8 encoded filename to read the data from. This must not be null.
+    const char*     filename            = nullptr;
+
+    //! Specifies the offset (in bytes) into the file where the data begins.
+    std::uint64_t   fileOffset          = 0;
+
+    //! Specifies the size (in bytes) of the data in the file. For compressed data, this is the compressed size.
+    std::uint64_t   fileSize            = 0;
+
+    //! Specifies the compression format of the file data. By default FileCompression::Uncompressed.
+    FileCompression compression         = FileCompression::Uncompressed;
+
+    //! Specifies the size (in bytes) of the decompressed data. This is ignored if \c compression is FileCompression::Uncompressed.
+    std::uint64_t   uncompressedSize    = 0;
+
+    //! Specifies the destination buffer. This must be null if \c texture is specified.
+    Buffer*         buffer              = nullptr;
+
+    //! Specifies the offset (in bytes) into the destination buffer.
+    std::uint64_t   bufferOffset        = 0;
+
+    //! Specifies the destination texture. This must be null if \c buffer is specified.
+    Texture*        texture             = nullptr;
+
+    /**
+    \brief Specifies the destination region of the texture.
+    \remarks The fields TextureSubresource::numMipLevels and TextureSubresource::numArrayLayers of this region \b must be 1.
+    */
+    TextureRegion   textureRegion;
+
+    /**
+    \brief Specifies the stride (in bytes) between two rows of the uncompressed texture data.
+    \remarks The texture data must be in the native format of the destination texture, i.e. no image conversion is performed.
+    If this is zero, each row is considered tightly packed.
+    \remarks Direct3D 12 can only stream texture data directly from the file if this stride is aligned to 256 bytes,
+    i.e. the data is laid out in the same way as \c ID3D12Device::GetCopyableFootprints would describe it.
+    */
+    std::uint32_t   rowStride           = 0;
+};
+
 
 /* ----- Functions ----- */
 
@@ -929,6 +1467,15 @@ struct RenderingCapabilities
 */
 using ValidateRenderingCapsFunc = std::function<bool(const std::string& info, const std::string& attrib)>;
 
+/**
+\brief Callback interface for the RenderSystem::SetMemoryBudgetCallback function.
+\param[in] heapInfo Specifies the information of the memory heap whose usage has crossed the budget threshold.
+\param[in] heapIndex Specifies the zero-based index of the memory heap, i.e. the index into the array returned by RenderSystem::QueryMemoryHeaps.
+\see RenderSystem::SetMemoryBudgetCallback
+\ingroup group_callbacks
+*/
+using MemoryBudgetCallback = std::function<void(const MemoryHeapInfo& heapInfo, std::uint32_t heapIndex)>;
+
 /**
 \brief Validates the presence of the specified required rendering capabilities.
 \param[in] presentCaps Specifies the rendering capabilities that are present for a certain renderer.
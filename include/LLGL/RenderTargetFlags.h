@@ -140,6 +140,15 @@ struct RenderTargetDescriptor
     */
     std::uint32_t           samples     = 1;
 
+    /**
+    \brief Specifies the bitmask of views for multiview rendering. By default 0.
+    \remarks If this is non-zero, each attachment with a texture covers all array layers from AttachmentDescriptor::arrayLayer up to the highest view of this mask,
+    i.e. the number of array layers is determined by the highest bit in the view mask. Attachments without a texture are not supported for multiview rendering.
+    \remarks If \c renderPass is specified, the view mask from that RenderPass must match this view mask.
+    \see RenderPassDescriptor::viewMask
+    */
+    std::uint32_t           viewMask    = 0;
+
     /**
     \brief Specifies the list of color attachment descriptors.
     \remarks Each attachment descriptor describes into which target will be rendered.
@@ -164,6 +173,17 @@ struct RenderTargetDescriptor
     \see TextureDescriptor::samples
     */
     AttachmentDescriptor    depthStencilAttachment;
+
+    /**
+    \brief Specifies the optional shading-rate attachment descriptor.
+    \remarks If a texture is specified for this attachment, this texture must be a 2D texture with format Format::R8UInt and must have been created with the binding flag BindFlags::ShadingRateAttachment.
+    Each texel specifies the shading rate for a screen tile of RenderingLimits::shadingRateImageTileSize pixels (see ShadingRate for the encoding). The \c format field of this attachment is ignored.
+    \remarks Shading-rate attachments are only read by the rasterizer, so they are not described by render passes and have no load or store operations.
+    \note Only supported with: Direct3D 12, Vulkan (with \c VK_KHR_dynamic_rendering).
+    \see RenderingLimits::shadingRateImageTileSize
+    \see CommandBuffer::SetShadingRate
+    */
+    AttachmentDescriptor    shadingRateAttachment;
 };
 
 
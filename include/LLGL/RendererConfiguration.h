@@ -100,6 +100,7 @@ struct RendererConfigurationVulkan
     \remarks Vulkan only allows a limited set of device memory objects (e.g. 4096 on a GPU with 8 GB of VRAM).
     This member specifies the minimum size used for hardware memory allocation of such a memory chunk.
     The Vulkan render system automatically manages sub-region allocation and defragmentation.
+    Allocations of at most 64 KB are served from power-of-two buddy pools, allocations larger than half of this size get their own chunk.
     \todo Remove this as soon as Vulkan memory manage has been improved.
     */
     std::uint64_t               minDeviceMemoryAllocationSize   = 1024*1024;
@@ -117,6 +118,11 @@ struct RendererConfigurationVulkan
 /**
 \brief OpenGL/OpenGLES profile descriptor structure.
 \note On MacOS the only supported OpenGL profiles are compatibility profile (for lagecy OpenGL before 3.0), 3.2 core profile, or 4.1 core profile.
+\remarks Buffers, textures, samplers, shaders, pipeline layouts, and pipeline states can also be created and written on worker threads
+once the primary GL context has been created, i.e. after the first swap-chain or resource has been created on the main thread.
+Each worker thread then gets its own GL context that shares its objects with the primary context,
+and command buffers wait on the GPU for all resources from worker threads before they are executed.
+Resources that contain GL container objects, such as render targets, query heaps, and pipeline states with separable shaders, must still be created on the main thread.
 */
 struct RendererConfigurationOpenGL
 {
@@ -143,6 +149,30 @@ struct RendererConfigurationOpenGL
     the respective extension and procedure name is printed to standard error output.
     */
     bool                    suppressFailedExtensions    = false;
+
+    /**
+    \brief Specifies whether to resolve OpenGL procedures on their first invocation instead of loading all of them at startup. By default false.
+    \remarks If this is true, supported extensions are only determined by the extension string and all their procedures are initialized with trampolines
+    that query the actual procedure address when they are called for the first time. This reduces the time to create the first GL context,
+    but a procedure that is reported as available and cannot be loaded will only fail when it is used.
+    \remarks This is currently only supported on desktop platforms with the OpenGL core profile backend and ignored otherwise.
+    */
+    bool                    lazyProcLoading             = false;
+};
+
+/**
+\brief Structure for a Null renderer specific configuration.
+\remarks The Null renderer can be used as a CPU cost model to gate performance and memory regressions in continuous integration without a GPU.
+*/
+struct RendererConfigurationNull
+{
+    /**
+    \brief Specifies the filename of the statistics report. By default null.
+    \remarks If this is not null, the Null renderer records per-command statistics of all command buffers and the simulated memory footprint of all resources,
+    i.e. buffer and texture sizes as well as descriptor counts. These statistics are written as a JSON report to this file when the render system is unloaded.
+    The report only contains counters and sizes but no timings, so it is deterministic for the same sequence of commands and the same build configuration.
+    */
+    const char* statisticsReportFilename = nullptr;
 };
 
 //! \deprecated Since 0.04b; Use RendererConfigurationOpenGL instead!
@@ -62,6 +62,131 @@ class LLGL_EXPORT RenderingDebugger
         */
         bool GetTimeRecording() const;
 
+        /**
+        \brief Enables or disables the recording of hierarchical GPU timer scopes. By default disabled.
+        \remarks If enabled, each pair of CommandBuffer::PushDebugGroup and CommandBuffer::PopDebugGroup is measured with GPU timestamp queries.
+        In contrast to time recording, this does not measure each individual command and the results are resolved
+        asynchronously a few frames later without stalling the CPU. The results are reported in FrameProfile::scopeRecords.
+        \remarks This is only supported if the render system supports timestamp queries.
+        The GPU timestamps are calibrated once to the CPU clock when the first scope is recorded, which waits for the command queue to be idle.
+        \see RenderingFeatures::hasTimestampQueries
+        \see FrameProfile::scopeRecords
+        */
+        void SetScopeRecording(bool enabled);
+
+        /**
+        \brief Returns whether the recording of hierarchical GPU timer scopes is enabled.
+        \see SetScopeRecording
+        */
+        bool GetScopeRecording() const;
+
+        /**
+        \brief Enables or disables the recording of events on the CPU timeline. By default disabled.
+        \remarks If enabled, the encoding of each command buffer, all command queue submissions, CPU waits for the GPU, and swap-chain presentations
+        are recorded with their CPU ticks. Together with the time and scope records, these events can be exported with SaveChromeTrace.
+        \see FrameProfile::eventRecords
+        \see SaveChromeTrace
+        */
+        void SetEventRecording(bool enabled);
+
+        /**
+        \brief Returns whether the recording of events on the CPU timeline is enabled.
+        \see SetEventRecording
+        */
+        bool GetEventRecording() const;
+
+        /**
+        \brief Enables or disables the recording of pipeline statistics for each render pass and compute section. By default disabled.
+        \remarks If enabled, each render pass and each sequence of compute dispatches outside of a render pass is wrapped in a pipeline statistics query,
+        e.g. to measure the number of vertex and fragment shader invocations. The results are resolved asynchronously a few frames later
+        without stalling the CPU and reported in FrameProfile::statisticsRecords and FrameProfile::pipelineStatistics.
+        \remarks This is only supported if the render system supports pipeline statistics queries.
+        While statistics recording is enabled, the client programmer cannot begin pipeline statistics queries in primary command buffers,
+        because queries of this type cannot be nested.
+        \see RenderingFeatures::hasPipelineStatistics
+        \see FrameProfile::statisticsRecords
+        */
+        void SetStatisticsRecording(bool enabled);
+
+        /**
+        \brief Returns whether the recording of pipeline statistics is enabled.
+        \see SetStatisticsRecording
+        */
+        bool GetStatisticsRecording() const;
+
+        /**
+        \brief Enables or disables the validation of the debug layer. By default enabled.
+        \remarks If validation is disabled, the debug layer only records the counters of the frame profile
+        (i.e. FrameProfile::commandQueueRecord and FrameProfile::commandBufferRecord) and the GPU timings if time recording is enabled.
+        This reduces the overhead of the debug layer to forwarding each command to the backend,
+        which makes it suitable for profiling or to keep the profiler enabled in production builds.
+        \remarks This should only be changed between command buffer recordings, since the states that are tracked for validation are not updated while validation is disabled.
+        \remarks This is equivalent to calling SetValidationFlags with ValidationFlags::All if enabled or with zero otherwise.
+        \see SetValidationFlags
+        \see SetTimeRecording
+        \see FlushProfile
+        */
+        void SetValidation(bool enabled);
+
+        /**
+        \brief Returns whether the validation of the debug layer is enabled, i.e. whether any validation category is enabled.
+        \see SetValidation
+        \see GetValidationFlags
+        */
+        bool GetValidation() const;
+
+        /**
+        \brief Specifies the categories of validation that are performed by the debug layer. By default ValidationFlags::All.
+        \param[in] flags Specifies a bitwise OR combination of the ValidationFlags entries. If this is zero, validation is disabled entirely.
+        \remarks This can be used to keep cheap checks, such as ValidationFlags::APIUsage, enabled in playtest builds
+        without the overhead of the per-draw range validation (ValidationFlags::DrawRanges).
+        \remarks This should only be changed between command buffer recordings, for the same reason as SetValidation.
+        \see ValidationFlags
+        \see SetValidation
+        */
+        void SetValidationFlags(long flags);
+
+        /**
+        \brief Returns the categories of validation that are performed by the debug layer.
+        \see SetValidationFlags
+        */
+        long GetValidationFlags() const;
+
+        /**
+        \brief Schedules a capture of the specified number of frames into a binary file.
+        \param[in] filename Specifies the filename of the capture file. The string is copied.
+        \param[in] numFrames Specifies the number of frames to capture. If this is zero, the capture is cancelled. By default 1.
+        \remarks The capture begins with the next frame, i.e. after the next call to SwapChain::Present, and ends after the specified number of frames.
+        At the beginning, the debug layer writes the creation parameters of all objects that are alive and the current content of all buffers and color textures.
+        Afterwards, all command buffer submissions and all render system calls that modify resources are written into the capture until it ends.
+        Only command buffers that were encoded during the capture are recorded.
+        \remarks The capture can be replayed with any render system that supports the captured shaders, e.g. with the CaptureReplayer utility.
+        Captures are only compatible with the same version of LLGL.
+        \remarks The capture has finished once GetCaptureFilename returns null again.
+        \see EndCapture
+        \see CaptureReplayer
+        */
+        void BeginCapture(const char* filename, std::uint32_t numFrames = 1);
+
+        /**
+        \brief Ends the current capture early or cancels a scheduled capture.
+        \remarks If the capture has already begun, the frames that have been recorded so far are written into the capture file with the next call to SwapChain::Present.
+        \see BeginCapture
+        */
+        void EndCapture();
+
+        /**
+        \brief Returns the filename of the scheduled or current capture or null if there is no capture.
+        \see BeginCapture
+        */
+        const char* GetCaptureFilename() const;
+
+        /**
+        \brief Returns the number of frames of the scheduled or current capture.
+        \see BeginCapture
+        */
+        std::uint32_t GetCaptureFrames() const;
+
         /**
         \brief Enables or disables the flag to break the debugger when errors are reported. By default disabled.
         \remarks The render system enables this if it was created with the RenderSystemFlags::DebugBreakOnError flag.
@@ -11,6 +11,7 @@
 
 #include <LLGL/Export.h>
 #include <LLGL/Deprecated.h>
+#include <LLGL/QueryHeapFlags.h>
 #include <LLGL/Container/DynamicVector.h>
 #include <LLGL/Container/StringLiteral.h>
 #include <cstdint>
@@ -40,6 +41,59 @@ enum class WarningType
     VaryingBehavior,    //!< Warning due to a varying behavior between the native APIs (e.g. \c SV_VertexID in HLSL behaves different to \c gl_VertexID in GLSL or \c gl_VertexIndex in SPIRV).
 };
 
+/**
+\brief Profile event types enumeration for the CPU timeline.
+\see ProfileEventRecord::type
+*/
+enum class ProfileEventType
+{
+    Encoding,   //!< Command buffer encoding that is enclosed by CommandBuffer::Begin and CommandBuffer::End.
+    Submission, //!< Submission of command buffers or a fence with CommandQueue::Submit.
+    Wait,       //!< CPU wait for the GPU with CommandQueue::WaitFence, CommandQueue::WaitIdle, or SwapChain::WaitForNextFrame.
+    Present,    //!< Swap-chain presentation with SwapChain::Present.
+};
+
+
+/* ----- Flags ----- */
+
+/**
+\brief Debug layer validation categories.
+\remarks These flags select which checks the debug layer performs on each command.
+The general API usage checks (e.g. command buffer states and render pass scopes) are performed whenever any category is enabled,
+because all other categories rely on the states that are tracked by them.
+\see RenderingDebugger::SetValidationFlags
+*/
+struct ValidationFlags
+{
+    enum
+    {
+        /**
+        \brief Validates general API usage, such as command buffer states, render pass scopes, command arguments, and feature support.
+        \remarks These checks are cheap and suitable to be kept enabled in playtest builds.
+        */
+        APIUsage            = (1 << 0),
+
+        /**
+        \brief Validates resource bindings, such as bind flags, descriptors of the pipeline layout, vertex layouts, and the binding table of each draw and dispatch command.
+        */
+        ResourceBindings    = (1 << 1),
+
+        /**
+        \brief Validates the vertex, index, and instance ranges of each draw command against the bound vertex and index buffers.
+        \remarks This is the most expensive category, since it is performed for every draw command.
+        */
+        DrawRanges          = (1 << 2),
+
+        /**
+        \brief Validates resource barriers and hazards, such as nested split barriers, aliasing barriers, and resources in CommandBuffer::ResourceBarrier without storage binding.
+        */
+        Barriers            = (1 << 3),
+
+        //! Enables all validation categories. This is the default.
+        All                 = (APIUsage | ResourceBindings | DrawRanges | Barriers),
+    };
+};
+
 
 /* ----- Structures ----- */
 
@@ -71,6 +125,124 @@ struct ProfileTimeRecord
     std::uint64_t   elapsedTime     = 0;
 };
 
+/**
+\brief Structure with annotation and GPU timestamps for a hierarchical timer scope.
+\remarks A scope is recorded for each pair of CommandBuffer::PushDebugGroup and CommandBuffer::PopDebugGroup while scope recording is enabled.
+All scopes of a command buffer form a tree that is stored in depth-first order, i.e. each scope is directly followed by its nested scopes.
+\remarks All timestamps are specified in the tick domain of Timer::Tick, i.e. the GPU timestamps are calibrated to the CPU clock.
+This allows to compare the GPU execution time of each scope with the CPU time it was recorded at.
+\see FrameProfile::scopeRecords
+\see RenderingDebugger::SetScopeRecording
+*/
+struct ProfileScopeRecord
+{
+    //! Scope annotation, i.e. the name that was passed to CommandBuffer::PushDebugGroup.
+    StringLiteral   annotation;
+
+    /**
+    \brief Zero-based index of the parent scope within the same list of scope records.
+    \remarks This is \c 0xFFFFFFFF if this is a root scope.
+    */
+    std::uint32_t   parent          = ~0u;
+
+    //! Nesting depth of this scope. This is zero for root scopes.
+    std::uint32_t   depth           = 0;
+
+    /**
+    \brief Index of the frame this scope was recorded in.
+    \remarks Frames are counted by each call to SwapChain::Present.
+    Since scope records are resolved asynchronously, they are usually reported a couple of frames after they have been recorded.
+    */
+    std::uint64_t   frame           = 0;
+
+    /**
+    \brief CPU ticks when the scope was opened with CommandBuffer::PushDebugGroup.
+    \see Timer::Tick
+    */
+    std::uint64_t   cpuTicksStart   = 0;
+
+    /**
+    \brief CPU ticks when the scope was closed with CommandBuffer::PopDebugGroup.
+    \see Timer::Tick
+    */
+    std::uint64_t   cpuTicksEnd     = 0;
+
+    /**
+    \brief GPU timestamp when the scope started executing, calibrated to the CPU clock.
+    \see Timer::Tick
+    */
+    std::uint64_t   gpuTicksStart   = 0;
+
+    /**
+    \brief GPU timestamp when the scope finished executing, calibrated to the CPU clock.
+    \see Timer::Tick
+    */
+    std::uint64_t   gpuTicksEnd     = 0;
+
+    //! Elapsed time (in nanoseconds) to execute this scope, including all nested scopes, on the GPU.
+    std::uint64_t   elapsedTime     = 0;
+};
+
+/**
+\brief Structure with annotation and pipeline statistics for a section of a command buffer.
+\remarks A statistics section is recorded for each render pass, i.e. between CommandBuffer::BeginRenderPass and CommandBuffer::EndRenderPass,
+and for each sequence of compute dispatches outside of a render pass while statistics recording is enabled.
+\see FrameProfile::statisticsRecords
+\see RenderingDebugger::SetStatisticsRecording
+*/
+struct ProfileStatisticsRecord
+{
+    /**
+    \brief Section annotation, i.e. the name of the innermost debug group or the name of the render target if there is no debug group.
+    \see CommandBuffer::PushDebugGroup
+    */
+    StringLiteral           annotation;
+
+    /**
+    \brief Index of the frame this section was recorded in.
+    \remarks Frames are counted by each call to SwapChain::Present.
+    Since statistics records are resolved asynchronously, they are usually reported a couple of frames after they have been recorded.
+    */
+    std::uint64_t           frame       = 0;
+
+    //! Pipeline statistics of all commands within this section.
+    QueryPipelineStatistics statistics;
+};
+
+/**
+\brief Structure with annotation and CPU ticks for an event on the CPU timeline.
+\remarks Event records allow to correlate the CPU encoding, submission, and presentation with the GPU execution of the timer scopes.
+\see FrameProfile::eventRecords
+\see RenderingDebugger::SetEventRecording
+\see SaveChromeTrace
+*/
+struct ProfileEventRecord
+{
+    //! Specifies the type of event.
+    ProfileEventType    type            = ProfileEventType::Encoding;
+
+    //! Event annotation, e.g. the debug name of the command buffer.
+    StringLiteral       annotation;
+
+    /**
+    \brief Zero-based index of the thread this event was recorded on.
+    \remarks Threads are enumerated in the order they have recorded their first event.
+    */
+    std::uint32_t       thread          = 0;
+
+    /**
+    \brief CPU ticks at the beginning of the event.
+    \see Timer::Tick
+    */
+    std::uint64_t       cpuTicksStart   = 0;
+
+    /**
+    \brief CPU ticks at the end of the event.
+    \see Timer::Tick
+    */
+    std::uint64_t       cpuTicksEnd     = 0;
+};
+
 struct ProfileCommandQueueRecord
 {
     /**
@@ -275,6 +447,46 @@ struct ProfileCommandBufferRecord
     std::uint32_t dispatchCommands          = 0;
 };
 
+/**
+\brief Counters for the work of the backend on the CPU side that is not visible at the interface level.
+\remarks These counters are only recorded while a RenderingDebugger is attached to the render system and LLGL was built with \c LLGL_ENABLE_DEBUG_LAYER.
+Since the counters are shared between all backends, they also include the work of render systems without debugger in the same process.
+Counters that a backend does not implement remain zero.
+\see FrameProfile::backendRecord
+*/
+struct ProfileBackendRecord
+{
+    /**
+    \brief Counter for all state changes that were filtered by the backend because the state was already set.
+    \remarks This is recorded by the state managers of the OpenGL and Direct3D 11 backends.
+    */
+    std::uint32_t redundantStateChanges     = 0;
+
+    /**
+    \brief Counter for all descriptors that were copied into shader-visible descriptor heaps.
+    \remarks This is recorded by the Direct3D 12 backend.
+    */
+    std::uint32_t descriptorCopies          = 0;
+
+    /**
+    \brief Counter for all transient descriptor sets that were allocated by the backend.
+    \remarks This is recorded by the Vulkan backend.
+    */
+    std::uint32_t descriptorSetAllocations  = 0;
+
+    /**
+    \brief Counter for all memory and resource barriers that were emitted by the backend.
+    \remarks This is recorded by the OpenGL, Direct3D 12, and Vulkan backends.
+    */
+    std::uint32_t barriers                  = 0;
+
+    /**
+    \brief Number of bytes that were uploaded through staging buffer pools.
+    \remarks This is recorded by the Direct3D 11, Direct3D 12, and Vulkan backends.
+    */
+    std::uint64_t stagingUploadBytes        = 0;
+};
+
 LLGL_DEPRECATED_IGNORE_PUSH()
 
 /**
@@ -441,11 +653,47 @@ struct FrameProfile
     */
     ProfileCommandBufferRecord          commandBufferRecord;
 
+    /**
+    \brief Structure for all CPU-side backend counters of this frame profile.
+    see ProfileBackendRecord
+    */
+    ProfileBackendRecord                backendRecord;
+
     /**
     \brief List of all time records for this frame profile.
     \see RenderingDebugger::SetTimeRecording
     */
     DynamicVector<ProfileTimeRecord>    timeRecords;
+
+    /**
+    \brief List of all hierarchical GPU timer scopes that have been resolved for this frame profile.
+    \remarks Scope records are resolved asynchronously without waiting for the GPU.
+    Hence, they usually belong to previous frames. The frame each scope was recorded in is stored in ProfileScopeRecord::frame.
+    \see RenderingDebugger::SetScopeRecording
+    */
+    DynamicVector<ProfileScopeRecord>   scopeRecords;
+
+    /**
+    \brief List of all events on the CPU timeline for this frame profile.
+    \see RenderingDebugger::SetEventRecording
+    */
+    DynamicVector<ProfileEventRecord>   eventRecords;
+
+    /**
+    \brief List of all pipeline statistics sections that have been resolved for this frame profile.
+    \remarks Statistics records are resolved asynchronously without waiting for the GPU.
+    Hence, they usually belong to previous frames. The frame each section was recorded in is stored in ProfileStatisticsRecord::frame.
+    \see RenderingDebugger::SetStatisticsRecording
+    */
+    DynamicVector<ProfileStatisticsRecord>  statisticsRecords;
+
+    /**
+    \brief Accumulated pipeline statistics of all records in \c statisticsRecords.
+    \remarks Together with ProfileCommandBufferRecord::drawCommands and ProfileCommandBufferRecord::dispatchCommands,
+    this can be used to find render passes with excessive overdraw (i.e. many fragment shader invocations) or vertex bound render passes.
+    \see RenderingDebugger::SetStatisticsRecording
+    */
+    QueryPipelineStatistics             pipelineStatistics;
 };
 
 LLGL_DEPRECATED_IGNORE_POP()
@@ -9,6 +9,9 @@
 #define LLGL_RESOURCE_FLAGS_H
 
 
+#include <cstdint>
+
+
 namespace LLGL
 {
 
@@ -49,6 +52,37 @@ enum class ResourceType
     Sampler,
 };
 
+/**
+\brief Native handle type enumeration for resources whose memory is shared between devices or processes.
+\see SharedResourceHandle::type
+*/
+enum class SharedHandleType
+{
+    //! Undefined handle type.
+    Undefined,
+
+    /**
+    \brief POSIX file descriptor of opaque device memory (\c VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT).
+    \remarks This is stored in SharedResourceHandle::fd.
+    \note Only supported with: Vulkan on GNU/Linux and Android.
+    */
+    OpaqueFD,
+
+    /**
+    \brief Win32 NT handle of shared device memory (\c VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT or a D3D12 shared handle).
+    \remarks This is stored in SharedResourceHandle::handle.
+    \note Only supported with: Vulkan and Direct3D 12 on Windows.
+    */
+    OpaqueWin32,
+
+    /**
+    \brief \c IOSurfaceRef object that backs a texture.
+    \remarks This is stored in SharedResourceHandle::handle.
+    \note Only supported with: Metal (textures only).
+    */
+    IOSurface,
+};
+
 
 /* ----- Flags ----- */
 
@@ -163,6 +197,38 @@ struct BindFlags
         \see CommandBuffer::FillBuffer
         */
         CopyDst                 = (1 << 11),
+
+        /**
+        \brief Texture can be used as shading-rate attachment of a render target.
+        \remarks This can only be used for 2D textures with format Format::R8UInt.
+        \see RenderTargetDescriptor::shadingRateAttachment
+        \see RenderingLimits::shadingRateImageTileSize
+        */
+        ShadingRateAttachment   = (1 << 12),
+
+        /**
+        \brief Buffer can hold a ray tracing acceleration structure.
+        \remarks This can only be used for Buffer resources and must \e not be combined with any other bind flags except for Sampled.
+        The content of such a buffer is only written by CommandBuffer::BuildAccelerationStructure.
+        Top-level acceleration structures are bound as Buffer resources with this flag in BindingDescriptor::bindFlags,
+        either to ray tracing PSOs or, if ray queries are supported, to any other shader stage (see Parse identifier \c accelstruct).
+        \see RenderSystem::GetAccelerationStructureSizes
+        \see RenderingFeatures::hasRayTracing
+        \see RenderingFeatures::hasRayQuery
+        */
+        AccelerationStructure   = (1 << 13),
+
+        /**
+        \brief Buffer can be used as compute stream output, i.e. a vertex buffer that is written by a compute shader instead of the stream-output stage.
+        \remarks This is a replacement for StreamOutputBuffer that works on all backends with compute shader and indirect draw support, including Metal.
+        The last 16 bytes of the buffer, i.e. at offset <code>BufferDescriptor::size - sizeof(DrawIndirectArguments)</code>, are reserved for a DrawIndirectArguments record
+        that must be written by the compute shader alongside the vertex data.
+        When such a buffer is bound with CommandBuffer::SetVertexBuffer, CommandBuffer::DrawStreamOutput is translated into an indirect draw command that reads this record.
+        \remarks This can only be used for Buffer resources and must be combined with VertexBuffer, Storage, and IndirectBuffer, but \e not with StreamOutputBuffer or ConstantBuffer.
+        \see CommandBuffer::DrawStreamOutput
+        \see DrawIndirectArguments
+        */
+        ComputeStreamOutput     = (1 << 14),
     };
 };
 
@@ -212,17 +278,20 @@ struct MiscFlags
         /**
         \brief Hint to the renderer that the resource will be frequently updated from the CPU.
         \remarks This is useful for a constant buffer for instance, that is updated by the host program every frame.
+        \remarks With Direct3D 12, buffers with this flag are allocated in CPU visible video memory if the adapter supports GPU upload heaps (i.e. resizable BAR).
+        Such buffers are written by the CPU directly without an intermediate copy, so RenderSystem::MapBuffer returns a pointer into video memory
+        and the client must ensure that the GPU is no longer accessing the mapped range.
         \see RenderSystem::WriteBuffer
         \see RenderSystem::WriteTexture
         \todo Restriction required to support deferred context in D3D11. This must no longer be just a "hint", it must be a strictly defined attribute for a buffer.
         */
-        DynamicUsage    = (1 << 0),
+        DynamicUsage      = (1 << 0),
 
         /**
         \brief Multi-sampled Texture resource has fixed sample locations.
         \remarks This can only be used with multi-sampled Texture resources (i.e. TextureType::Texture2DMS, TextureType::Texture2DMSArray).
         */
-        FixedSamples    = (1 << 1),
+        FixedSamples      = (1 << 1),
 
         /**
         \brief Generates MIP-maps at texture creation time with the initial image data (if specified).
@@ -232,13 +301,13 @@ struct MiscFlags
         \see TextureDescriptor::mipLevels
         \see CommandBuffer::GenerateMips
         */
-        GenerateMips    = (1 << 2),
+        GenerateMips      = (1 << 2),
 
         /**
         \brief Specifies to ignore resource data initialization.
         \remarks If this is specified, a texture or buffer resource will stay uninitialized during creation and the content is undefined.
         */
-        NoInitialData   = (1 << 3),
+        NoInitialData     = (1 << 3),
 
         /**
         \brief Enables a storage buffer to be used for \c AppendStructuredBuffer and \c ConsumeStructuredBuffer in HLSL only.
@@ -249,7 +318,7 @@ struct MiscFlags
         \see ResourceViewDescriptor::initialCount
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
-        Append          = (1 << 4),
+        Append            = (1 << 4),
 
         /**
         \brief Enables the hidden counter in a storage buffer to be used for \c RWStructuredBuffer in HLSL only.
@@ -260,11 +329,123 @@ struct MiscFlags
         \see ResourceViewDescriptor::initialCount
         \see https://docs.microsoft.com/en-us/windows/win32/api/d3d11/ne-d3d11-d3d11_buffer_uav_flag
         */
-        Counter         = (1 << 5),
+        Counter           = (1 << 5),
+
+        /**
+        \brief Specifies that a buffer stays mapped into CPU memory space for its entire lifetime.
+        \remarks This can only be used with buffers that also have at least one CPU access flag (see BufferDescriptor::cpuAccessFlags).
+        If RenderingFeatures::hasPersistentMapping is true, the buffer is allowed to be used by the GPU while it is mapped
+        and MapBuffer and UnmapBuffer only return the persistently mapped memory without synchronization.
+        The client programmer is then responsible for not overriding memory that is still in use by the GPU,
+        and memory that is not host coherent must be made visible to the GPU with RenderSystem::FlushMappedRange.
+        If persistent mapping is not supported, this flag is ignored.
+        \note Only supported with: OpenGL (if \c GL_ARB_buffer_storage is available), Vulkan, Metal.
+        \see RenderingFeatures::hasPersistentMapping
+        \see RenderSystem::FlushMappedRange
+        */
+        PersistentMapping = (1 << 6),
+
+        /**
+        \brief Specifies that a texture is created without committed memory, i.e. it is only partially resident (aka. tiled or sparse resource).
+        \remarks The memory of a sparse texture is divided into tiles that are mapped to device memory via CommandQueue::UpdateTileMappings.
+        Sampling non-resident tiles is undefined behavior. Tiles can be mapped and unmapped at any time, so only visible pages need to stay resident.
+        MIP-map levels that are smaller than a single tile (aka. the MIP tail) are always resident.
+        \remarks Sparse textures cannot have initial image data and can only be created if RenderingFeatures::hasSparseTextures is true.
+        This can only be used with non-multi-sampled 2D and 2D-array textures.
+        \note Only supported with: Vulkan, Direct3D 12, Metal.
+        \see RenderingFeatures::hasSparseTextures
+        \see RenderingLimits::sparseTileSize
+        \see CommandQueue::UpdateTileMappings
+        */
+        Sparse            = (1 << 7),
+
+        /**
+        \brief Specifies that the driver does not track hazards for this buffer or texture automatically.
+        \remarks This removes the dependency analysis of the driver for resources that are used heavily, e.g. by compute shaders.
+        Once an untracked resource is bound or passed to CommandBuffer::ResourceBarrier, all subsequent command encoders are synchronized explicitly.
+        Within a single compute pass, CommandBuffer::ResourceBarrier \b must be recorded between a write and a subsequent access of an untracked resource.
+        Command buffers that use untracked resources are synchronized with the command buffers that are encoded after they have been submitted.
+        \remarks This flag is ignored by backends that do not track hazards of resources in the driver.
+        \note Only supported with: Metal.
+        \see CommandBuffer::ResourceBarrier
+        */
+        Untracked         = (1 << 8),
+
+        /**
+        \brief Specifies that a texture is only used as transient render-target attachment whose content never leaves the render pass.
+        \remarks This allows tile-based GPUs to keep the attachment in on-chip tile memory only, e.g. for depth-stencil or multi-sampled color attachments that are resolved.
+        The texture must be created with the binding flag BindFlags::ColorAttachment or BindFlags::DepthStencilAttachment and no other binding flags,
+        it must have a single MIP-map level, and it cannot have initial image data.
+        \remarks The content of a transient attachment is undefined at the beginning of each render pass and after each render pass,
+        i.e. it should be cleared with AttachmentLoadOp::Clear or AttachmentLoadOp::Undefined and stored with AttachmentStoreOp::Undefined.
+        On Metal, such textures are created with \c MTLStorageModeMemoryless if supported.
+        On Vulkan, such textures are created with \c VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT and allocated from
+        lazily allocated memory (\c VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) if available.
+        \remarks This flag is ignored by backends that do not support transient attachments.
+        \note Only supported with: Metal, Vulkan.
+        \see AttachmentLoadOp
+        \see AttachmentStoreOp
+        */
+        Transient         = (1 << 9),
+
+        /**
+        \brief Specifies that the memory of a buffer or texture can be exported to another device or process.
+        \remarks Shared resources are allocated with their own dedicated device memory, i.e. they are never sub-allocated, placed, or sparse.
+        Use RenderSystem::ExportSharedHandle to retrieve a native handle of this memory and RenderSystem::ImportTexture or RenderSystem::ImportBuffer to open it.
+        \remarks This can only be used if RenderingFeatures::hasSharedResources is true.
+        \note Only supported with: Vulkan, Direct3D 12, Metal (textures only).
+        \see RenderSystem::ExportSharedHandle
+        \see RenderingFeatures::hasSharedResources
+        */
+        Shared            = (1 << 10),
+
+        /**
+        \brief Specifies that image data for a texture is converted on the GPU if its format or data type differs from the texture format.
+        \remarks By default, image data passed to RenderSystem::CreateTexture and RenderSystem::WriteTexture is converted on the CPU (see ConvertImageBuffer)
+        before it is uploaded, e.g. from ImageFormat::RGB to ImageFormat::RGBA or from DataType::UInt8 to DataType::Float16.
+        With this flag, the unconverted source data is uploaded into an intermediate buffer instead and a builtin compute shader writes the converted texels directly into the texture,
+        which reduces both the CPU time and the upload size for formats with fewer components or smaller data types than the texture format.
+        \remarks This can only be used with textures that also have the binding flag BindFlags::Storage and a non-sRGB color format with normalized unsigned or floating-point components
+        that supports typed unordered access. Otherwise, or if the source image has an ImageFormat other than R, RG, RGB, BGR, RGBA, or BGRA,
+        or a DataType of 64 bits, the image data is still converted on the CPU.
+        \remarks Textures created with this flag and initial image data are initialized on the primary command queue.
+        \note Only supported with: Direct3D 12.
+        \see ConvertImageBuffer
+        \see RenderSystem::WriteTexture
+        */
+        GPUConversion     = (1 << 11),
     };
 };
 
 
+/* ----- Structures ----- */
+
+/**
+\brief Native handle of device memory that is shared between multiple render systems, possibly on different devices or in different processes.
+\remarks The memory layout of the resource is implementation defined,
+so a shared resource \b must be imported with the same descriptor, on the same physical device, and with the same backend it was exported from.
+Access between the render systems is \e not synchronized, i.e. the client programmer must ensure that all commands writing to the resource have completed,
+e.g. by waiting on a fence, before the resource is accessed by another render system.
+\see RenderSystem::ExportSharedHandle
+\see RenderSystem::ImportTexture
+\see RenderSystem::ImportBuffer
+*/
+struct SharedResourceHandle
+{
+    //! Specifies the type of the native handle. By default SharedHandleType::Undefined.
+    SharedHandleType    type    = SharedHandleType::Undefined;
+
+    //! Win32 \c HANDLE if \c type is SharedHandleType::OpaqueWin32, or \c IOSurfaceRef if \c type is SharedHandleType::IOSurface. By default null.
+    void*               handle  = nullptr;
+
+    //! POSIX file descriptor if \c type is SharedHandleType::OpaqueFD. By default -1.
+    std::int32_t        fd      = -1;
+
+    //! Size (in bytes) of the shared device memory allocation. This is filled by RenderSystem::ExportSharedHandle and must be passed back unchanged on import. By default 0.
+    std::uint64_t       size    = 0;
+};
+
+
 } // /namespace LLGL
 
 
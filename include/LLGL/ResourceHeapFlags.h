@@ -25,6 +25,31 @@ namespace LLGL
 class PipelineLayout;
 
 
+/* ----- Flags ----- */
+
+/**
+\brief Resource heap creation flags.
+\see ResourceHeapDescriptor::flags
+*/
+struct ResourceHeapFlags
+{
+    enum
+    {
+        /**
+        \brief Specifies that the descriptors of the resource heap are rewritten frequently, e.g. a few descriptors every frame.
+        \remarks Backends that store descriptors in GPU memory keep two copies of them. Each call to RenderSystem::WriteResourceHeap writes into the copy
+        that has not been bound since the previous write and then swaps both copies, so the GPU can still read the previous descriptors while the new ones are written.
+        Resources that are replaced by a write are kept alive until the next write.
+        \remarks In OpenGL, this only affects bindless resource heaps, i.e. the shader storage buffers of bindless texture handles (see PipelineLayoutFlags::BindlessHeap).
+        All other resource heaps are consumed by the CPU when they are bound, so this flag has no effect on them.
+        \note Only supported with: OpenGL. This flag is ignored by all other backends.
+        \see RenderSystem::WriteResourceHeap
+        */
+        Dynamic = (1 << 0),
+    };
+};
+
+
 /* ----- Structures ----- */
 
 /**
@@ -142,11 +167,20 @@ struct ResourceHeapDescriptor
     \remarks If the number of resource views is non-zero, it \b must a multiple of the heap-bindings in the pipeline layout.
     \remarks If the number of resource views is zero, the number will be determined by the initial resource views
     and they must \e not be empty and they \b must be a multiple of the heap-bindings in the pipeline layout.
+    \remarks If the pipeline layout was created with PipelineLayoutFlags::BindlessHeap, the resource heap does not have to be fully written before it is bound.
+    Only the descriptors that are accessed by shaders must be valid.
     \see PipelineLayoutDescriptor::heapBindings
+    \see PipelineLayoutFlags::BindlessHeap
     \see RenderSystem::CreateResourceHeap
     */
     std::uint32_t   numResourceViews    = 0;
 
+    /**
+    \brief Specifies optional resource heap creation flags. This can be a bitwise OR combination of the entries of ResourceHeapFlags. By default 0.
+    \see ResourceHeapFlags
+    */
+    long            flags               = 0;
+
     //! \deprecated Since 0.04b; Use PipelineLayoutDescriptor::barrierFlags instead!
     LLGL_DEPRECATED("ResourceHeapDescriptor::barrierFlags is deprecated since 0.04b; Use PipelineLayoutDescriptor::barrierFlags instead!")
     long            barrierFlags        = 0;
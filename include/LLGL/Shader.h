@@ -65,6 +65,8 @@ class LLGL_EXPORT Shader : public RenderSystemChild
 
     public:
 
+        ~Shader();
+
         //! Returns the type of this shader.
         inline ShaderType GetType() const
         {
@@ -75,9 +77,23 @@ class LLGL_EXPORT Shader : public RenderSystemChild
 
         Shader(const ShaderType type);
 
+        /**
+        \brief Initializes the shader type and copies the serialized reflection of the specified descriptor if there is one.
+        \see ShaderDescriptor::reflectionData
+        */
+        Shader(const ShaderDescriptor& shaderDesc);
+
+        /**
+        \brief Copies the reflection that was deserialized from ShaderDescriptor::reflectionData into the output parameter.
+        \return True if this shader was created with a valid serialized reflection. Otherwise, the output parameter is not modified.
+        \remarks Backends call this at the beginning of Reflect to skip the runtime reflection.
+        */
+        bool GetSerializedReflection(ShaderReflection& outReflection) const;
+
     private:
 
-        ShaderType type_;
+        ShaderType          type_;
+        ShaderReflection*   serializedReflection_   = nullptr;
 
 };
 
@@ -37,6 +37,13 @@ enum class ShaderType
     Geometry,       //!< Geometry shader type.
     Fragment,       //!< Fragment shader type (also "Pixel Shader").
     Compute,        //!< Compute shader type.
+    Task,           //!< Task shader type (also "Amplification Shader" or "Object Shader"). \see RenderingFeatures::hasMeshShaders
+    Mesh,           //!< Mesh shader type. \see RenderingFeatures::hasMeshShaders
+    Tile,           //!< Tile shader type (also "Tile Function" or "Imageblock Kernel"). \see RenderingFeatures::hasTileShaders
+    RayGeneration,  //!< Ray generation shader type. \see RenderingFeatures::hasRayTracing
+    Miss,           //!< Ray miss shader type. \see RenderingFeatures::hasRayTracing
+    ClosestHit,     //!< Ray closest-hit shader type. \see RenderingFeatures::hasRayTracing
+    AnyHit,         //!< Ray any-hit shader type. \see RenderingFeatures::hasRayTracing
 };
 
 /**
@@ -187,9 +194,49 @@ struct StageFlags
         //! Specifies the compute shader stage.
         ComputeStage        = (1 << 5),
 
+        //! Specifies the task shader stage (also referred to as "Amplification Shader" or "Object Shader").
+        TaskStage           = (1 << 6),
+
+        //! Specifies the mesh shader stage.
+        MeshStage           = (1 << 7),
+
+        /**
+        \brief Specifies the tile shader stage.
+        \remarks This stage is not part of AllGraphicsStages or AllStages, since it is only available if RenderingFeatures::hasTileShaders is true.
+        \note Only supported with: Metal.
+        */
+        TileStage           = (1 << 8),
+
+        //! Specifies the ray generation shader stage.
+        RayGenerationStage  = (1 << 9),
+
+        //! Specifies the ray miss shader stage.
+        MissStage           = (1 << 10),
+
+        //! Specifies the ray closest-hit shader stage.
+        ClosestHitStage     = (1 << 11),
+
+        //! Specifies the ray any-hit shader stage.
+        AnyHitStage         = (1 << 12),
+
         //! Specifies all tessellation stages, i.e. tessellation-control-, tessellation-evaluation shader stages.
         AllTessStages       = (TessControlStage | TessEvaluationStage),
 
+        /**
+        \brief Specifies all mesh pipeline stages, i.e. task- and mesh shader stages.
+        \remarks These stages are not part of AllGraphicsStages or AllStages, since they are only available if RenderingFeatures::hasMeshShaders is true.
+        Bindings that are accessed by task or mesh shaders must specify these stages explicitly.
+        */
+        AllMeshStages       = (TaskStage | MeshStage),
+
+        /**
+        \brief Specifies all ray tracing pipeline stages, i.e. ray generation-, miss-, closest-hit-, and any-hit shader stages.
+        \remarks These stages are not part of AllStages, since they are only available if RenderingFeatures::hasRayTracing is true.
+        Bindings that are accessed by a ray tracing pipeline must specify these stages explicitly.
+        \note Only supported with: Direct3D 12.
+        */
+        AllRayTracingStages = (RayGenerationStage | MissStage | ClosestHitStage | AnyHitStage),
+
         //! Specifies all graphics pipeline shader stages, i.e. vertex-, tessellation-, geometry-, and fragment shader stages.
         AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | FragmentStage),
 
@@ -279,6 +326,8 @@ struct ComputeShaderAttributes
     \brief Specifies the number of threads per threadgroup in X, Y, and Z direction. By default (1, 1, 1).
     \remarks Each component must be greater than zero.
     \remarks Only the Metal backend supports dispatch compute kernels with dynamic work group sizes.
+    For the Metal backend, this also specifies the number of threads per threadgroup for task and mesh shaders (i.e. object and mesh functions).
+    For tile shaders, this specifies the number of threads per tile that are dispatched by CommandBuffer::DispatchTiles.
     If not used for shader reflection, all other renderers need to specified the workgroup size within the shader code:
     - For GLSL: <code>layout(local_size_x = X, local_size_y = Y, local_size_z = Z)</code>
     - For HLSL: <code>[numthreads(X, Y, Z)]</code>
@@ -417,6 +466,23 @@ struct ShaderDescriptor
     \note Only supported with: Metal.
     */
     ComputeShaderAttributes     compute;
+
+    /**
+    \brief Optional pointer to a serialized shader reflection. By default null.
+    \remarks If this is specified, Shader::Reflect returns this reflection instead of reflecting the shader at runtime,
+    which avoids the cost of runtime reflection and the stall of OpenGL program introspection.
+    The data must have been created with SerializeShaderReflection and is copied when the shader is created.
+    If the data is invalid, e.g. if it was serialized with an incompatible version of LLGL, it is ignored and the shader is reflected at runtime.
+    \see SerializeShaderReflection
+    \see reflectionDataSize
+    */
+    const void*                 reflectionData      = nullptr;
+
+    /**
+    \brief Specifies the size (in bytes) of the serialized shader reflection. By default 0.
+    \see reflectionData
+    */
+    std::size_t                 reflectionDataSize  = 0;
 };
 
 LLGL_DEPRECATED_IGNORE_POP()
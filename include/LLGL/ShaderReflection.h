@@ -9,7 +9,9 @@
 #define LLGL_SHADER_REFLECTION_H
 
 
+#include <LLGL/Export.h>
 #include <LLGL/ForwardDecls.h>
+#include <LLGL/Blob.h>
 #include <LLGL/ResourceFlags.h>
 #include <LLGL/BufferFlags.h>
 #include <LLGL/PipelineLayoutFlags.h>
@@ -156,6 +158,28 @@ struct ShaderReflection
 };
 
 
+/* ----- Functions ----- */
+
+/**
+\brief Serializes the specified shader reflection into a compact binary blob.
+\remarks The blob can be shipped or cached next to the shader bytecode and passed to ShaderDescriptor::reflectionData,
+so the shader does not have to be reflected at runtime. The blob is only valid for the same version of LLGL and the same byte order.
+\see DeserializeShaderReflection
+\see ShaderDescriptor::reflectionData
+*/
+LLGL_EXPORT Blob SerializeShaderReflection(const ShaderReflection& reflection);
+
+/**
+\brief Deserializes a shader reflection from a binary blob that was created with SerializeShaderReflection.
+\param[in] data Pointer to the serialized shader reflection.
+\param[in] size Specifies the size (in bytes) of the serialized shader reflection.
+\param[out] outReflection Specifies the output shader reflection. All strings are copied, i.e. the data can be released after this call.
+\return True if the blob is valid. Otherwise, the content of \c outReflection is undefined.
+\see SerializeShaderReflection
+*/
+LLGL_EXPORT bool DeserializeShaderReflection(const void* data, std::size_t size, ShaderReflection& outReflection);
+
+
 } // /namespace LLGL
 
 
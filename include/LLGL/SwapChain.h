@@ -100,6 +100,8 @@ class LLGL_EXPORT SwapChain : public RenderTarget
 
         /**
         \brief Swaps the current back buffer with the front buffer to present it on the screen.
+        \remarks The content of the swap-chain's depth-stencil buffer is undefined after this call.
+        Backends may discard it before presenting (e.g. via \c glInvalidateFramebuffer with OpenGL) to save memory bandwidth on tile-based GPUs.
         \see GetCurrentSwapIndex
         */
         virtual void Present() = 0;
@@ -169,6 +171,57 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         */
         virtual bool SetVsyncInterval(std::uint32_t vsyncInterval) = 0;
 
+        /**
+        \brief Blocks the calling thread until the swap-chain is ready to begin a new frame.
+        \param[in] timeout Specifies the timeout in nanoseconds. By default the thread waits indefinitely.
+        \return True if the swap-chain is ready for the next frame, or false if the timeout expired.
+        \remarks Call this function before processing input and encoding the commands for the next frame to minimize input latency.
+        The number of frames that can be queued up before this function blocks is determined by SwapChainDescriptor::maxFramesInFlight.
+        On Direct3D, this waits on the frame latency waitable object of the DXGI swap-chain.
+        On Vulkan, this uses \c VK_KHR_present_wait if the extension is available.
+        Backends that don't support latency waits return true immediately, since they already throttle the CPU during presentation.
+        \see SwapChainDescriptor::maxFramesInFlight
+        */
+        virtual bool WaitForNextFrame(std::uint64_t timeout = ~0ull);
+
+        /**
+        \brief Retrieves the rolling frame pacing statistics of this swap-chain.
+        \param[out] outStatistics Specifies the output statistics. This is only modified if the function returns true.
+        \return True if frame statistics are enabled for this swap-chain. Otherwise, SwapChainDescriptor::frameStatisticsWindow was 0.
+        \remarks The statistics are updated at the end of each call to Present.
+        \see SwapChainDescriptor::frameStatisticsWindow
+        */
+        virtual bool GetFrameStatistics(FrameStatistics& outStatistics) const;
+
+        /**
+        \brief Retrieves the native handle of the current back buffer, i.e. the color buffer that will be presented with the next call to Present.
+        \param[out] nativeHandle Raw pointer to the backend specific structure to store the native handle.
+        This is the same structure as for Resource::GetNativeHandle, e.g. LLGL::Direct3D12::ResourceNativeHandle or LLGL::Vulkan::ResourceNativeHandle.
+        \param[in] nativeHandleSize Specifies the size (in bytes) of the native handle structure for robustness. This must be \c sizeof() of the respective structure.
+        \return True if the native handle was successfully retrieved. Otherwise, the backend does not expose its back buffers (OpenGL and Null) or \c nativeHandleSize does not match.
+        \remarks This allows handing frames over to a hardware video encoder without a CPU readback.
+        The handle is only valid until the next call to Present or ResizeBuffers. For Direct3D and Metal, the object's reference counter is incremented and must be released by the caller.
+        To synchronize the encoder with the frame, submit a Fence after the command buffer that rendered into the back buffer and let the encoder wait on it before Present is called.
+        \see Fence::GetNativeHandle
+        \see RenderSystem::ExportSharedFence
+        */
+        virtual bool GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize);
+
+        /**
+        \brief Returns the transformation the application must apply to its clip-space output for a pre-rotated swap-chain.
+        \remarks This is always SurfaceTransform::Identity unless the swap-chain was created with SwapChainDescriptor::preTransform enabled.
+        The transformation can change when the device is rotated, in which case the swap-chain must be resized via ResizeBuffers.
+        \see SwapChainDescriptor::preTransform
+        */
+        virtual SurfaceTransform GetSurfaceTransform() const;
+
+        /**
+        \brief Returns the color space the swap-chain presents in.
+        \remarks This is the color space that was requested by SwapChainDescriptor::colorSpace or ColorSpace::SRGB if it's not supported.
+        \see SwapChainDescriptor::colorSpace
+        */
+        virtual ColorSpace GetColorSpace() const;
+
     public:
 
         /* ----- Surface & Display ----- */
@@ -232,6 +285,31 @@ class LLGL_EXPORT SwapChain : public RenderTarget
         //! Shows the swap-chain surface if it's not the same as the input surface.
         void ShowSurface();
 
+        //! Returns true if frame statistics are enabled for this swap-chain. Backends can use this to skip querying display timings.
+        bool HasFrameStatistics() const;
+
+        /**
+        \brief Marks the beginning of a blocking call for the frame statistics.
+        \remarks Backends must call this at the beginning of Present and WaitForNextFrame.
+        \see EndFrameStatisticsStall
+        */
+        void BeginFrameStatisticsStall();
+
+        /**
+        \brief Marks the end of a blocking call for the frame statistics.
+        \param[in] presented Specifies whether this ends a call to Present. In this case, the current frame is recorded.
+        \see BeginFrameStatisticsStall
+        */
+        void EndFrameStatisticsStall(bool presented);
+
+        /**
+        \brief Records the time a frame was shown on the display as reported by the presentation engine.
+        \param[in] presentCount Specifies the monotonic presentation counter of the frame. Frames with a count that was already recorded are ignored.
+        \param[in] timeInNanosecs Specifies the display time stamp in nanoseconds.
+        \remarks If more than one presentation was skipped, the interval is distributed evenly across the skipped frames.
+        */
+        void RecordFrameDisplayTime(std::uint64_t presentCount, std::uint64_t timeInNanosecs);
+
         /**
         \brief Shares the surface and resolution with another swap-chain.
         \note This is only used by the renderer debug layer.
@@ -17,6 +17,87 @@ namespace LLGL
 {
 
 
+/* ----- Enumerations ----- */
+
+/**
+\brief Swap-chain presentation mode enumeration.
+\remarks If the selected mode is not supported by the presentation engine, the swap-chain falls back to PresentMode::Default.
+\remarks With Direct3D 11 and Direct3D 12, PresentMode::FifoRelaxed behaves like PresentMode::Fifo, since DXGI has no equivalent presentation mode.
+\note Only supported with: Vulkan, Direct3D 11, and Direct3D 12. Other backends always behave like PresentMode::Default.
+\see SwapChainDescriptor::presentMode
+*/
+enum class PresentMode
+{
+    //! Presentation mode is determined by the v-sync interval. This is the default.
+    Default,
+
+    //! Presentations are queued up and synchronized with the vertical blank. This never tears and is always supported.
+    Fifo,
+
+    //! Like Fifo, but a late presentation is shown immediately instead of waiting for the next vertical blank, which may tear.
+    FifoRelaxed,
+
+    //! Presentations replace the single pending image and are shown on the next vertical blank. This never tears and doesn't block the CPU.
+    Mailbox,
+
+    /**
+    \brief Presentations are shown immediately without waiting for the vertical blank, which may tear.
+    \remarks On displays with variable refresh rates, the display refreshes as soon as a frame is presented instead,
+    which doesn't tear as long as the frame rate is within the refresh rate range of the display. With DXGI, this presents with tearing allowed if supported.
+    \see Display::SupportsVariableRefreshRate
+    */
+    Immediate,
+};
+
+/**
+\brief Surface transformation enumeration for pre-rotated swap-chains.
+\remarks This denotes the clockwise rotation the application must apply to its clip-space output to match the orientation of the display.
+\see SwapChain::GetSurfaceTransform
+\see SwapChainDescriptor::preTransform
+*/
+enum class SurfaceTransform
+{
+    //! No transformation. The swap-chain buffers have the same orientation as the display. This is the default.
+    Identity,
+
+    //! Clip-space output must be rotated by 90 degrees clockwise. The swap-chain buffers have swapped width and height.
+    Rotate90,
+
+    //! Clip-space output must be rotated by 180 degrees.
+    Rotate180,
+
+    //! Clip-space output must be rotated by 270 degrees clockwise. The swap-chain buffers have swapped width and height.
+    Rotate270,
+};
+
+/**
+\brief Swap-chain color space enumeration for standard and high dynamic range output.
+\remarks Each color space other than ColorSpace::SRGB selects a fixed back-buffer format, which overrides SwapChainDescriptor::colorBits.
+If the selected color space is not supported by the display or presentation engine, the swap-chain falls back to ColorSpace::SRGB. With Direct3D and Metal, the back-buffer format is kept in that case.
+Use SwapChain::GetColorSpace and SwapChain::GetColorFormat to determine the actual color space and format.
+\note Only supported with: Direct3D 11, Direct3D 12, Vulkan (with \c VK_EXT_swapchain_colorspace), and Metal. Other backends always use ColorSpace::SRGB.
+\see SwapChainDescriptor::colorSpace
+\see SwapChain::GetColorSpace
+*/
+enum class ColorSpace
+{
+    //! Standard dynamic range with sRGB primaries and gamma curve. The back-buffer format is determined by SwapChainDescriptor::colorBits. This is the default.
+    SRGB,
+
+    /**
+    \brief HDR10 with BT.2020 primaries and the SMPTE ST 2084 perceptual quantizer (PQ) curve.
+    \remarks The back-buffer format is Format::RGB10A2UNorm (Format::RGBA16Float with Metal) and the application must write PQ-encoded values.
+    */
+    HDR10,
+
+    /**
+    \brief Extended linear sRGB (scRGB) with BT.709 primaries.
+    \remarks The back-buffer format is Format::RGBA16Float. A value of 1.0 maps to the SDR reference white and values outside the range [0, 1] are valid.
+    */
+    ScRGB,
+};
+
+
 /* ----- Flags ----- */
 
 /**
@@ -65,7 +146,7 @@ struct SwapChainDescriptor
     \remarks The final name of the native hardware resource is implementation defined.
     \see RenderSystemChild::SetName
     */
-    const char*     debugName       = nullptr;
+    const char*     debugName         = nullptr;
 
     /**
     \brief Screen resolution (in pixels).
@@ -80,7 +161,7 @@ struct SwapChainDescriptor
     To determine the actual color format of a swap-chain, use the SwapChain::GetColorFormat function.
     \see SwapChain::GetColorFormat
     */
-    int             colorBits       = 32;
+    int             colorBits         = 32;
 
     /**
     \brief Number of bits for each pixel in the depth buffer. Should be 24, 32, or zero to disable depth buffer. By default 24.
@@ -88,7 +169,7 @@ struct SwapChainDescriptor
     To determine the actual depth-stencil format of a swap-chain, use the SwapChain::GetDepthStencilFormat function.
     \see SwapChain::GetDepthStencilFormat
     */
-    int             depthBits       = 24;
+    int             depthBits         = 24;
 
     /**
     \brief Number of bits for each pixel in the stencil buffer. Should be 8, or zero to disable stencil buffer. By default 8.
@@ -96,7 +177,7 @@ struct SwapChainDescriptor
     To determine the actual depth-stencil format of a swap-chain, use the SwapChain::GetDepthStencilFormat function.
     \see SwapChain::GetDepthStencilFormat
     */
-    int             stencilBits     = 8;
+    int             stencilBits       = 8;
 
     /**
     \brief Number of samples for the swap-chain buffers. By default 1.
@@ -104,7 +185,7 @@ struct SwapChainDescriptor
     The actual number of samples can be queried by the \c GetSamples function of the RenderTarget interface.
     \see RenderTarget::GetSamples
     */
-    std::uint32_t   samples         = 1;
+    std::uint32_t   samples           = 1;
 
     /**
     \brief Number of swap buffers. By default 2 (for double-buffering).
@@ -113,21 +194,142 @@ struct SwapChainDescriptor
     \see SwapChain::GetCurrentSwapIndex
     \see SwapChain::GetNumSwapBuffers
     */
-    std::uint32_t   swapBuffers     = 2;
+    std::uint32_t   swapBuffers       = 2;
+
+    /**
+    \brief Specifies the maximum number of frames the CPU can queue up before it waits for the GPU. By default 0.
+    \remarks If this is 0, the backend uses its default number of frames in flight.
+    Lower values reduce input latency at the expense of throughput, e.g. 1 for latency-critical applications and 3 for maximum throughput.
+    This is only a hint to the renderer and will be clamped to the range supported by the backend.
+    \see SwapChain::WaitForNextFrame
+    */
+    std::uint32_t   maxFramesInFlight = 0;
+
+    /**
+    \brief Specifies the number of recent frames the rolling frame statistics are computed over. By default 0.
+    \remarks If this is 0, no frame statistics are recorded for this swap-chain.
+    A value of 256, for instance, provides stable 99th percentiles while still reacting to changes within a few seconds.
+    \see SwapChain::GetFrameStatistics
+    */
+    std::uint32_t   frameStatisticsWindow = 0;
+
+    /**
+    \brief Specifies the presentation mode of the swap-chain. By default PresentMode::Default.
+    \remarks If this is not PresentMode::Default, it takes precedence over the v-sync interval.
+    \see SwapChain::SetVsyncInterval
+    */
+    PresentMode     presentMode       = PresentMode::Default;
+
+    /**
+    \brief Specifies the color space of the swap-chain. By default ColorSpace::SRGB.
+    \remarks An HDR color space only produces HDR output if the display and operating system are in HDR mode. Otherwise, the presentation engine tone maps the output.
+    \see SwapChain::GetColorSpace
+    \see SwapChain::GetColorFormat
+    */
+    ColorSpace      colorSpace        = ColorSpace::SRGB;
 
     /**
     \brief Specifies whether to create the swap-chain initially in fullscreen mode or windowed mode otherwise.
     \see SwapChain::ResizeBuffers
     \see ResizeBuffersFlags::FullscreenMode
     */
-    bool            fullscreen      = false;
+    bool            fullscreen        = false;
 
     /**
     \brief Specifies whether to create the default surface for the swap-chain with the resizable attribute.
     \remarks If a custom surface is specified, this field is ignored.
     \see WindowFlags::Resizable
     */
-    bool            resizable       = false;
+    bool            resizable         = false;
+
+    /**
+    \brief Specifies whether to acquire the next swap-chain image as late as possible. By default false.
+    \remarks If this is true, the next image is not acquired at the end of SwapChain::Present but when it is needed for the first time,
+    e.g. when a render pass on the swap-chain begins or SwapChain::GetCurrentSwapIndex is called.
+    This avoids blocking the render thread on image availability while it could still encode commands for the next frame.
+    \note Only supported with: Vulkan.
+    */
+    bool            lateImageAcquire  = false;
+
+    /**
+    \brief Specifies whether the swap-chain buffers are pre-rotated to the native orientation of the display. By default false.
+    \remarks If this is true, the presentation engine no longer rotates the swap-chain buffers with an extra compositor pass when the device is rotated.
+    Instead, the application must rotate its clip-space output by the transformation returned by SwapChain::GetSurfaceTransform, e.g. in the projection matrix,
+    and swap the width and height of its viewports and scissors for 90 and 270 degree rotations. The resolution of the swap-chain remains in the orientation of the surface.
+    \note Only supported with: Vulkan and OpenGLES on Android.
+    \see SwapChain::GetSurfaceTransform
+    */
+    bool            preTransform      = false;
+
+    /**
+    \brief Specifies whether presentations are paced to the vertical blank intervals of the display. By default false.
+    \remarks If this is true, each frame is scheduled to be shown on the vertical blank that follows the previous frame by the v-sync interval.
+    This avoids uneven frame times when the application renders slower than the display refresh rate and keeps the presentation queue from filling up.
+    The vertical blank timings are provided by the \c AChoreographer of the Android app thread, so Surface::ProcessEvents must be called every frame.
+    \note Only supported with: Vulkan (with \c VK_GOOGLE_display_timing) and OpenGLES (with \c EGL_ANDROID_presentation_time) on Android.
+    \see SwapChain::SetVsyncInterval
+    */
+    bool            framePacing       = false;
+};
+
+/**
+\brief Rolling statistics of a single frame timing metric. All values are in milliseconds.
+\remarks The percentiles are computed over the most recent frames as specified by SwapChainDescriptor::frameStatisticsWindow.
+\see FrameStatistics
+*/
+struct FrameTimeStatistics
+{
+    //! Value of the most recently recorded frame.
+    float last     = 0.0f;
+
+    //! Arithmetic mean of all frames in the statistics window.
+    float average  = 0.0f;
+
+    //! Median (50th percentile) of all frames in the statistics window.
+    float p50      = 0.0f;
+
+    //! 95th percentile of all frames in the statistics window.
+    float p95      = 0.0f;
+
+    //! 99th percentile of all frames in the statistics window.
+    float p99      = 0.0f;
+};
+
+/**
+\brief Frame pacing statistics of a swap-chain.
+\see SwapChain::GetFrameStatistics
+\see SwapChainDescriptor::frameStatisticsWindow
+*/
+struct FrameStatistics
+{
+    //! Total number of frames that have been presented since the swap-chain was created.
+    std::uint64_t       numFrames           = 0;
+
+    //! Number of frames the statistics are currently computed over. This is less than or equal to SwapChainDescriptor::frameStatisticsWindow.
+    std::uint32_t       numSamples          = 0;
+
+    /**
+    \brief CPU frame time, i.e. the time between two presentations the CPU was \e not blocked in SwapChain::Present or SwapChain::WaitForNextFrame.
+    \see queueStallTime
+    */
+    FrameTimeStatistics cpuFrameTime;
+
+    /**
+    \brief Time between two frames that were shown on the display as reported by the presentation engine.
+    \remarks This is sourced from \c IDXGISwapChain::GetFrameStatistics on Direct3D, \c VK_GOOGLE_display_timing on Vulkan, and \c MTLDrawable.presentedTime on Metal.
+    The presentation engine reports these timings with a delay of a few frames.
+    If the backend or platform does not provide display timings, all values of this member remain zero.
+    */
+    FrameTimeStatistics displayFrameTime;
+
+    //! Time between the end of two consecutive calls to SwapChain::Present on the CPU.
+    FrameTimeStatistics presentInterval;
+
+    /**
+    \brief Time the CPU was blocked in SwapChain::Present and SwapChain::WaitForNextFrame per frame, e.g. because the presentation queue was full.
+    \remarks The sum of cpuFrameTime and queueStallTime equals presentInterval.
+    */
+    FrameTimeStatistics queueStallTime;
 };
 
 
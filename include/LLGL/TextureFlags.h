@@ -22,6 +22,9 @@ namespace LLGL
 {
 
 
+class Texture;
+
+
 /* ----- Enumerations ----- */
 
 //! Texture type enumeration.
@@ -95,6 +98,28 @@ enum class TextureSwizzle : std::uint8_t
     Alpha   //!< The component is replaced by alpha component.
 };
 
+/**
+\brief Sampler feedback type enumeration.
+\remarks Determines what a sampler feedback texture records for each MIP region of its paired texture.
+\see SamplerFeedbackDescriptor::type
+*/
+enum class SamplerFeedbackType
+{
+    /**
+    \brief Records the lowest MIP-map level that has been sampled within each MIP region.
+    \remarks The decoded value of a MIP region is 0xFF if it has not been sampled at all.
+    A MIN_MIP feedback texture always has a single MIP-map level.
+    */
+    MinMip,
+
+    /**
+    \brief Records for each MIP-map level whether a MIP region of that level has been sampled.
+    \remarks The decoded value of a MIP region is 1 if it has been sampled and 0 otherwise.
+    A MIP_REGION_USED feedback texture has the same number of MIP-map levels as its paired texture.
+    */
+    MipRegionUsed,
+};
+
 
 /* ----- Structures ----- */
 
@@ -259,6 +284,37 @@ struct TextureRegion
     Extent3D            extent;
 };
 
+/**
+\brief Texture copy region structure: Destination location, source location, and extent of a single region to copy between two textures.
+\see CommandBuffer::CopyTextureRegions
+\see TextureLocation
+*/
+struct TextureCopyRegion
+{
+    TextureCopyRegion() = default;
+    TextureCopyRegion(const TextureCopyRegion&) = default;
+
+    //! Constructor to initialize all members.
+    inline TextureCopyRegion(const TextureLocation& dstLocation, const TextureLocation& srcLocation, const Extent3D& extent) :
+        dstLocation { dstLocation },
+        srcLocation { srcLocation },
+        extent      { extent      }
+    {
+    }
+
+    //! Specifies the destination location, including MIP-map level and offset.
+    TextureLocation dstLocation;
+
+    //! Specifies the source location, including MIP-map level and offset.
+    TextureLocation srcLocation;
+
+    /**
+    \brief Specifies the extent of the texture region to copy.
+    \remarks This has the same semantics as the \c extent parameter of CommandBuffer::CopyTexture, i.e. it also includes the array layers.
+    */
+    Extent3D        extent;
+};
+
 /**
 \brief Texture descriptor structure.
 \remarks Contains all information about type, format, and dimension to create a texture resource.
@@ -473,6 +529,72 @@ struct SubresourceFootprint
     std::uint32_t layerStride   = 0;
 };
 
+/**
+\brief Tile mapping descriptor structure for sparse textures.
+\remarks Describes a range of tiles within a single subresource that are either mapped to or unmapped from device memory.
+\see CommandQueue::UpdateTileMappings
+\see MiscFlags::Sparse
+*/
+struct TileMappingDescriptor
+{
+    //! Specifies the sparse texture whose tiles are to be mapped. This must have been created with MiscFlags::Sparse.
+    Texture*        texture     = nullptr;
+
+    /**
+    \brief Specifies the MIP-map level of the tiles. By default 0.
+    \remarks Mappings for MIP-map levels within the MIP tail are ignored, since they are always resident.
+    */
+    std::uint32_t   mipLevel    = 0;
+
+    //! Specifies the array layer of the tiles. By default 0.
+    std::uint32_t   arrayLayer  = 0;
+
+    /**
+    \brief Specifies the offset (in tiles) of the first tile. By default (0, 0, 0).
+    \remarks The tile extent (in texels) can be determined with GetSparseTileExtent.
+    */
+    Offset3D        tileOffset;
+
+    //! Specifies the number of tiles in each dimension. By default (1, 1, 1).
+    Extent3D        numTiles    = { 1, 1, 1 };
+
+    /**
+    \brief Specifies whether the tiles are to be mapped to device memory (resident) or unmapped (non-resident). By default true.
+    \remarks Unmapped tiles release their device memory. Their previous content is lost and must be uploaded again once they are mapped again.
+    */
+    bool            resident    = true;
+};
+
+/**
+\brief Sampler feedback texture descriptor structure.
+\remarks A sampler feedback texture is paired with a regular texture and records which MIP-map levels of that texture have been sampled.
+Shaders write into the feedback texture, which is bound as a storage texture (e.g. \c FeedbackTexture2D in HLSL), with \c WriteSamplerFeedback.
+The recorded feedback can be decoded into a buffer with CommandBuffer::ResolveSamplerFeedback.
+\see RenderSystem::CreateSamplerFeedbackTexture
+\see RenderingFeatures::hasSamplerFeedback
+*/
+struct SamplerFeedbackDescriptor
+{
+    //! Optional name for debugging purposes. By default null.
+    const char*         debugName       = nullptr;
+
+    /**
+    \brief Specifies the texture whose sampling is recorded. This must not be null.
+    \remarks This must be a texture of type TextureType::Texture2D or TextureType::Texture2DArray and it must outlive the feedback texture.
+    */
+    Texture*            pairedTexture   = nullptr;
+
+    //! Specifies what the feedback texture records. By default SamplerFeedbackType::MinMip.
+    SamplerFeedbackType type            = SamplerFeedbackType::MinMip;
+
+    /**
+    \brief Specifies the size (in texels of the paired texture) of the region that is covered by each texel of the feedback texture. By default (4, 4, 1).
+    \remarks Width and height must be powers of two and at least 4. Depth must be 1.
+    \see GetSamplerFeedbackExtent
+    */
+    Extent3D            mipRegion       = { 4, 4, 1 };
+};
+
 
 /* ----- Functions ----- */
 
@@ -593,6 +715,29 @@ LLGL_EXPORT Extent3D GetMipExtent(const TextureDescriptor& textureDesc, std::uin
 */
 LLGL_EXPORT std::size_t GetMemoryFootprint(const TextureType type, const Format format, const Extent3D& extent, const TextureSubresource& subresource);
 
+/**
+\brief Returns the extent (in texels) of a single tile of a sparse texture with the specified type and hardware format.
+\param[in] type Specifies the texture type. Only TextureType::Texture2D and TextureType::Texture2DArray are supported.
+\param[in] format Specifies the hardware format. For compressed formats, the extent is a multiple of the block size.
+\param[in] tileSize Specifies the tile size (in bytes). This should be RenderingLimits::sparseTileSize. By default 64 KB.
+\return Standard tile shape for the specified format, e.g. 128x128 texels for Format::RGBA8UNorm with 64 KB tiles,
+or an empty extent if the texture type is not supported or the format size is not a power of two.
+\remarks This matches the standard tile shapes of Direct3D 12 and Vulkan (i.e. \c residencyStandard2DBlockShape).
+\see RenderingLimits::sparseTileSize
+\see TileMappingDescriptor
+*/
+LLGL_EXPORT Extent3D GetSparseTileExtent(const TextureType type, const Format format, std::uint32_t tileSize = 65536);
+
+/**
+\brief Returns the extent of the decoded feedback of a sampler feedback texture, i.e. the number of MIP regions in each dimension.
+\param[in] extent Specifies the extent of the paired texture's MIP-map level whose feedback is decoded.
+\param[in] mipRegion Specifies the size of each MIP region. This must be the same as SamplerFeedbackDescriptor::mipRegion.
+\return Extent of \c extent divided by \c mipRegion, rounded up. The number of array layers (if any) is passed through.
+\see SamplerFeedbackDescriptor::mipRegion
+\see CommandBuffer::ResolveSamplerFeedback
+*/
+LLGL_EXPORT Extent3D GetSamplerFeedbackExtent(const Extent3D& extent, const Extent3D& mipRegion);
+
 /**
 \brief Returns true if the specified texture descriptor describes a texture with MIP-mapping enabled.
 \return True if the texture type is not a multi-sampled texture and the number of MIP-map levels in the descriptor is either zero or greater than one.
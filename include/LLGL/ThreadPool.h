@@ -0,0 +1,121 @@
+/*
+ * ThreadPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_THREAD_POOL_H
+#define LLGL_THREAD_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Constants.h>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Structures ----- */
+
+/**
+\brief Descriptor structure for the process-wide worker thread pool.
+\remarks The worker thread pool is used by all multi-threaded operations of LLGL, e.g. ConvertImageBuffer and DecompressImageBufferToRGBA8UNorm.
+\see ThreadPool::Configure
+*/
+struct ThreadPoolDescriptor
+{
+    /**
+    \brief Specifies the number of persistent worker threads.
+    \remarks The thread that dispatches concurrent work always participates in processing that work,
+    i.e. a value of 0 disables all worker threads and runs every task on the calling thread.
+    If this is \c LLGL_MAX_THREAD_COUNT, the number of worker threads is determined by the number of hardware threads minus one.
+    By default \c LLGL_MAX_THREAD_COUNT.
+    \see LLGL_MAX_THREAD_COUNT
+    */
+    unsigned        numThreads      = LLGL_MAX_THREAD_COUNT;
+
+    /**
+    \brief Specifies an optional bit mask of logical processors the worker threads are allowed to run on.
+    \remarks Bit \c N enables the logical processor with index \c N. If this is 0, the worker threads have no explicit affinity.
+    This is only a hint and it is ignored on platforms that do not support thread affinity such as macOS, iOS, UWP, and WebAssembly.
+    By default 0.
+    */
+    std::uint64_t   affinityMask    = 0;
+};
+
+
+namespace ThreadPool
+{
+
+
+/* ----- Types ----- */
+
+/**
+\brief Job function signature that is passed to a DispatchCallback.
+\param[in] jobIndex Specifies the zero-based index of the job that is to be executed.
+\see DispatchCallback
+*/
+using JobFunction = std::function<void(std::size_t jobIndex)>;
+
+/**
+\brief Callback function signature to dispatch concurrent work into the job system of the host application.
+\param[in] numJobs Specifies the number of jobs. This is always greater than 1.
+\param[in] job Specifies the job function that must be called exactly once for each index in the half-open range <code>[0, numJobs)</code>.
+The job function is thread safe and can be called in any order.
+\param[in] userData Specifies the user data that was set in the call to SetDispatchCallback.
+\remarks The callback must not return before all jobs have finished.
+\see SetDispatchCallback
+*/
+using DispatchCallback = std::function<void(std::size_t numJobs, const JobFunction& job, void* userData)>;
+
+
+/* ----- Functions ----- */
+
+/**
+\brief Configures the process-wide worker thread pool.
+\remarks If the pool is currently running, it waits for all pending work to finish before the worker threads are recreated.
+Otherwise, the worker threads are created lazily the first time concurrent work is dispatched.
+If this function is never called, the pool is initialized with the default values from ThreadPoolDescriptor.
+\see ThreadPoolDescriptor
+*/
+LLGL_EXPORT void Configure(const ThreadPoolDescriptor& threadPoolDesc);
+
+/**
+\brief Sets the callback to dispatch concurrent work into the job system of the host application.
+\param[in] callback Specifies the new dispatch callback. If this is null, the built-in worker thread pool is used again.
+\param[in] userData Optional raw pointer to some user data that will be passed to the callback each time work is dispatched.
+\remarks As long as a dispatch callback is set, the built-in worker threads are not used.
+\see DispatchCallback
+*/
+LLGL_EXPORT void SetDispatchCallback(const DispatchCallback& callback, void* userData = nullptr);
+
+/**
+\brief Returns the number of worker threads of the built-in pool.
+\remarks This does not include the thread that dispatches the work, which always participates in processing it.
+\see ThreadPoolDescriptor::numThreads
+*/
+LLGL_EXPORT unsigned GetNumThreads();
+
+/**
+\brief Releases all worker threads of the built-in pool once their pending work has finished.
+\remarks The worker threads will be recreated the next time concurrent work is dispatched.
+Call this before the host application unloads the LLGL module to avoid joining threads during static deinitialization.
+*/
+LLGL_EXPORT void Shutdown();
+
+
+} // /namespace ThreadPool
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -40,6 +40,19 @@ printf("Elapsed time: %f ms\n", elapsedSeconds * 1000.0);
 */
 LLGL_EXPORT std::uint64_t Tick();
 
+/**
+\brief Blocks the calling thread until the high resolution timer has reached the specified tick.
+\param[in] tick Specifies the tick to wait for, i.e. a value returned by Tick plus the number of ticks to sleep.
+If this tick has already been reached, the function returns immediately.
+\remarks This uses the most precise sleep function of the host system instead of busy-waiting,
+e.g. high resolution waitable timers on Windows, \c clock_nanosleep on Linux and Android, and \c mach_wait_until on macOS and iOS.
+This keeps the CPU idle while waiting, but the thread might be woken up slightly after the specified tick, depending on the scheduler of the host system.
+\note On the Web platform, this function returns immediately, since the browser must not be blocked and paces the frames itself.
+\see Tick
+\see FramePacer
+*/
+LLGL_EXPORT void SleepUntil(std::uint64_t tick);
+
 
 } // /namespace Timer
 
@@ -0,0 +1,95 @@
+/*
+ * CaptureReplayer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CAPTURE_REPLAYER_H
+#define LLGL_CAPTURE_REPLAYER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class SwapChain;
+class Report;
+
+/**
+\brief Utility class to replay frame captures that have been recorded with RenderingDebugger::BeginCapture.
+
+A capture is loaded once, which creates all of its objects and uploads the resource contents from the beginning of the capture.
+Afterwards, each captured frame can be replayed any number of times, e.g. to benchmark or profile a frame in isolation:
+\code
+LLGL::CaptureReplayer myReplayer{ *myRenderer };
+if (myReplayer.Load("MyCapture.llgc"))
+{
+    for (std::uint32_t frame = 0; frame < myReplayer.GetNumFrames(); ++frame)
+        myReplayer.ReplayFrame(frame);
+}
+\endcode
+\remarks The capture can be replayed with a different renderer than it was recorded with,
+as long as this renderer accepts the captured shaders, e.g. SPIR-V shaders for both Vulkan and OpenGL.
+\remarks Each command buffer is replayed inside a debug group named <code>"Frame N"</code> where \c N is the index of the replayed frame,
+so its GPU time can be measured with RenderingDebugger::SetScopeRecording.
+\remarks Textures that are written by the GPU and depth-stencil textures are not stored in the capture.
+Their content is undefined until the captured commands write into them.
+\note This class is not required for any interaction with the render system. It is only a utility built on top of the render system interface.
+*/
+class LLGL_EXPORT CaptureReplayer : public NonCopyable
+{
+
+    public:
+
+        //! Initializes the replayer with the specified render system to create the captured objects with.
+        CaptureReplayer(RenderSystem& renderer);
+
+        //! Releases all objects that have been created for the loaded capture.
+        ~CaptureReplayer();
+
+        /**
+        \brief Loads the specified capture file, creates all of its objects, and uploads the initial resource contents.
+        \param[in] filename Specifies the capture file that has been written by RenderingDebugger::BeginCapture.
+        \param[out] report Optional pointer to a report that receives the reason why the capture could not be loaded.
+        \return True on success. Otherwise, the file could not be read or it was recorded with an incompatible version of LLGL.
+        \remarks Objects that have been created during the captured frames are created here as well. Any previously loaded capture is released first.
+        */
+        bool Load(const char* filename, Report* report = nullptr);
+
+        //! Returns the number of frames in the loaded capture.
+        std::uint32_t GetNumFrames() const;
+
+        /**
+        \brief Replays the specified frame of the loaded capture and presents all swap-chains at the end of the frame.
+        \param[in] frame Specifies the zero-based frame index. This must be less than GetNumFrames.
+        \return True on success. Otherwise, the frame index is out of bounds or its commands are corrupted.
+        \remarks Resource updates within the frame, i.e. RenderSystem::WriteBuffer and RenderSystem::WriteTexture, are replayed as well.
+        */
+        bool ReplayFrame(std::uint32_t frame);
+
+        //! Returns the first swap-chain of the loaded capture or null if the capture has no swap-chain.
+        SwapChain* GetSwapChain() const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_ = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
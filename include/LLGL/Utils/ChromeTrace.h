@@ -0,0 +1,53 @@
+/*
+ * ChromeTrace.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CHROME_TRACE_H
+#define LLGL_CHROME_TRACE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Blob.h>
+#include <LLGL/RenderingDebuggerFlags.h>
+
+
+namespace LLGL
+{
+
+
+/**
+\brief Writes the specified frame profile in the JSON trace event format of the Chrome trace viewer.
+\param[in] profile Specifies the frame profile whose records are to be written.
+To export more than a single frame, the profiles of several frames can be accumulated with RenderingDebugger::MergeProfiles.
+\return Blob with the JSON content. The content is not null-terminated.
+\remarks The trace contains a \e CPU process with one track per thread for all event records (FrameProfile::eventRecords)
+and an additional track for all time records (FrameProfile::timeRecords).
+The \e GPU process contains a single track with all timer scopes (FrameProfile::scopeRecords) at their calibrated GPU timestamps.
+All timestamps are converted from CPU ticks into microseconds relative to the earliest record in the profile.
+\remarks The output can be inspected offline with \c chrome://tracing or the Perfetto UI (see https://ui.perfetto.dev),
+which both import this format directly.
+\see RenderingDebugger::SetEventRecording
+\see RenderingDebugger::SetScopeRecording
+\see RenderingDebugger::SetTimeRecording
+*/
+LLGL_EXPORT Blob WriteChromeTrace(const FrameProfile& profile);
+
+/**
+\brief Writes the specified frame profile in the JSON trace event format to the specified file.
+\return True on success. Otherwise, the file could not be opened for writing.
+\see WriteChromeTrace
+*/
+LLGL_EXPORT bool SaveChromeTrace(const FrameProfile& profile, const char* filename);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,140 @@
+/*
+ * CommandBufferGroup.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_COMMAND_BUFFER_GROUP_H
+#define LLGL_COMMAND_BUFFER_GROUP_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class CommandQueue;
+
+/**
+\brief Descriptor structure for a command buffer group.
+\see CommandBufferGroup::CommandBufferGroup
+*/
+struct CommandBufferGroupDescriptor
+{
+    /**
+    \brief Specifies the maximum number of command buffers that can be recorded into the group before it is submitted. By default 64.
+    \remarks All command buffers are created up front and reused every time the group is submitted.
+    */
+    std::uint32_t           capacity            = 64;
+
+    /**
+    \brief Specifies the descriptor for each command buffer of the group.
+    \remarks CommandBufferFlags::ImmediateSubmit is not allowed, since the command buffers are recorded on multiple threads and submitted together.
+    */
+    CommandBufferDescriptor commandBufferDesc;
+
+    //! Specifies the command queue the group is submitted to. If this is null, the primary command queue of the render system is used. By default null.
+    CommandQueue*           commandQueue        = nullptr;
+};
+
+/**
+\brief Utility class to record a group of command buffers from many job threads and submit them in a deterministic order.
+
+Each job claims a command buffer from the group with a sort key, records it, and ends it.
+The claimed command buffers are then submitted in ascending order of their sort keys with a single call to CommandQueue::Submit:
+\code
+LLGL::CommandBufferGroup myCmdGroup{ *myRenderer, myCmdGroupDesc };
+
+MyJobSystem::ParallelFor(myNumJobs, [&](std::size_t jobIndex)
+{
+    if (LLGL::CommandBuffer* cmdBuffer = myCmdGroup.Begin(jobIndex))
+    {
+        // Record commands ...
+        cmdBuffer->End();
+    }
+});
+
+myCmdGroup.Submit();
+\endcode
+\remarks Claiming a command buffer is lock free, so jobs can claim as many as they like as long as the group's capacity is not exhausted.
+\remarks The claimed command buffers are reused for the next submission, so a frame-based job system only creates its command buffers once.
+\note Begin is the only function that is thread safe. All jobs must have finished recording before Submit or Reset is called.
+*/
+class LLGL_EXPORT CommandBufferGroup : public NonCopyable
+{
+
+    public:
+
+        //! Creates all command buffers of this group.
+        CommandBufferGroup(RenderSystem& renderer, const CommandBufferGroupDescriptor& groupDesc);
+
+        //! Releases all command buffers of this group.
+        ~CommandBufferGroup();
+
+        /**
+        \brief Claims the next available command buffer of this group and begins recording it.
+        \param[in] sortKey Specifies the key that determines the submission order of the command buffer within this group.
+        Command buffers are submitted in ascending order. Command buffers with equal keys are submitted in an unspecified order.
+        \return Pointer to the command buffer that is recording or null if the capacity of this group is exhausted.
+        The caller must end the command buffer via CommandBuffer::End before the group is submitted.
+        \remarks This function is thread safe and lock free.
+        */
+        CommandBuffer* Begin(std::uint64_t sortKey);
+
+        /**
+        \brief Submits all claimed command buffers in ascending order of their sort keys and makes them available to be claimed again.
+        \remarks All claimed command buffers are submitted with a single call to CommandQueue::Submit(std::uint32_t, CommandBuffer* const *).
+        */
+        void Submit();
+
+        //! Makes all claimed command buffers available to be claimed again without submitting them.
+        void Reset();
+
+        //! Returns the number of command buffers that have been claimed since the last call to Submit or Reset.
+        std::uint32_t GetNumClaimed() const;
+
+        //! Returns the maximum number of command buffers that can be claimed before the group is submitted.
+        inline std::uint32_t GetCapacity() const
+        {
+            return static_cast<std::uint32_t>(slots_.size());
+        }
+
+    private:
+
+        struct Slot
+        {
+            CommandBuffer*  commandBuffer   = nullptr;
+            std::uint64_t   sortKey         = 0;
+        };
+
+    private:
+
+        RenderSystem&               renderer_;
+        CommandQueue*               commandQueue_   = nullptr;
+        std::vector<Slot>           slots_;
+        std::atomic<std::uint32_t>  numClaimed_;
+
+        std::vector<Slot>           sortedSlots_;
+        std::vector<CommandBuffer*> submitList_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
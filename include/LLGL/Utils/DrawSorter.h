@@ -0,0 +1,188 @@
+/*
+ * DrawSorter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DRAW_SORTER_H
+#define LLGL_DRAW_SORTER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Format.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class CommandBuffer;
+class PipelineState;
+class ResourceHeap;
+class Buffer;
+
+/**
+\brief Single draw call that is collected by a DrawSorter.
+\see DrawSorter::Add
+*/
+struct DrawPacket
+{
+    /**
+    \brief Specifies the key this draw call is sorted by in ascending order. Draw calls with equal keys retain the order in which they have been added.
+    \remarks Draw calls with equal pipeline states, resource heaps, and vertex buffers should have adjacent keys to minimize state changes.
+    \see DrawSorter::MakeSortKey
+    */
+    std::uint64_t   sortKey         = 0;
+
+    //! Specifies the graphics pipeline state for this draw call. This must not be null.
+    PipelineState*  pipelineState   = nullptr;
+
+    //! Specifies the optional resource heap for this draw call. If this is null, the resource heap that is currently bound remains unchanged.
+    ResourceHeap*   resourceHeap    = nullptr;
+
+    //! Specifies the descriptor set of the resource heap. By default 0.
+    std::uint32_t   descriptorSet   = 0;
+
+    //! Specifies the optional vertex buffer for this draw call. If this is null, the vertex buffer that is currently bound remains unchanged.
+    Buffer*         vertexBuffer    = nullptr;
+
+    /**
+    \brief Specifies the optional index buffer for this draw call. If this is null, the draw call is not indexed.
+    \remarks The index buffer is always bound at offset 0, so the location of the indices within this buffer must be specified with \c firstVertex.
+    */
+    Buffer*         indexBuffer     = nullptr;
+
+    //! Specifies the format of the index buffer. This must be either Format::R16UInt or Format::R32UInt. By default Format::R32UInt.
+    Format          indexFormat     = Format::R32UInt;
+
+    //! Specifies the number of vertices or indices to draw. By default 0.
+    std::uint32_t   numVertices     = 0;
+
+    //! Specifies the number of instances to draw. By default 1.
+    std::uint32_t   numInstances    = 1;
+
+    //! Specifies the zero-based offset of the first vertex or index. By default 0.
+    std::uint32_t   firstVertex     = 0;
+
+    //! Specifies the base vertex offset that is added to each index. Only used for indexed draw calls. By default 0.
+    std::int32_t    vertexOffset    = 0;
+
+    //! Specifies the zero-based offset of the first instance. By default 0.
+    std::uint32_t   firstInstance   = 0;
+};
+
+/**
+\brief Utility class to sort draw calls by state before they are encoded into a command buffer.
+
+Draw calls are collected as packets with 64-bit sort keys, sorted with a radix sort on the worker thread pool (see ThreadPool::Configure),
+and encoded with CommandBuffer::DrawPacked, which skips all bindings that are equal to those of the previous draw call:
+\code
+LLGL::DrawSorter myDrawSorter;
+for (const MyObject& obj : myVisibleObjects)
+{
+    LLGL::DrawPacket packet;
+    {
+        packet.sortKey          = LLGL::DrawSorter::MakeSortKey(obj.material->psoID, obj.material->heapID, obj.mesh->bufferID);
+        packet.pipelineState    = obj.material->pso;
+        packet.resourceHeap     = obj.material->heap;
+        packet.vertexBuffer     = obj.mesh->vertexBuffer;
+        packet.indexBuffer      = obj.mesh->indexBuffer;
+        packet.numVertices      = obj.mesh->numIndices;
+        packet.firstVertex      = obj.mesh->firstIndex;
+    }
+    myDrawSorter.Add(packet);
+}
+myDrawSorter.Submit(*myCmdBuffer);
+myDrawSorter.Clear();
+\endcode
+\remarks A pipeline state is only bound when it differs from that of the previous draw call.
+All draw calls in between two pipeline state changes are encoded with a single call to CommandBuffer::DrawPacked.
+\note This class is not thread safe. Packets must be added from a single thread, but sorting itself is distributed to the worker thread pool.
+*/
+class LLGL_EXPORT DrawSorter : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Returns a sort key that groups draw calls by pipeline state first, then by resource heap, and then by vertex buffer.
+        \param[in] pipelineID Specifies an application defined identifier of the pipeline state. Only the lower 20 bits are used.
+        \param[in] resourceHeapID Specifies an application defined identifier of the resource heap. Only the lower 20 bits are used.
+        \param[in] vertexBufferID Specifies an application defined identifier of the vertex buffer. Only the lower 24 bits are used.
+        */
+        static std::uint64_t MakeSortKey(std::uint32_t pipelineID, std::uint32_t resourceHeapID, std::uint32_t vertexBufferID);
+
+    public:
+
+        DrawSorter() = default;
+
+        //! Reserves memory for the specified number of draw packets.
+        void Reserve(std::size_t numPackets);
+
+        //! Adds the specified draw packet. Its pipeline state must not be null.
+        void Add(const DrawPacket& packet);
+
+        //! Removes all draw packets but keeps the allocated memory for the next frame.
+        void Clear();
+
+        /**
+        \brief Sorts all packets by their sort keys. This is stable, i.e. packets with equal keys retain the order in which they have been added.
+        \remarks This is called implicitly by Submit if any packets have been added since the last sort.
+        */
+        void Sort();
+
+        /**
+        \brief Encodes all packets in sorted order into the specified command buffer.
+        \param[in,out] cmdBuffer Specifies the command buffer to encode the draw calls into. This must be inside a render pass.
+        \remarks The packets remain in this sorter, so they can be submitted into multiple command buffers.
+        */
+        void Submit(CommandBuffer& cmdBuffer);
+
+        //! Returns the draw packets. These are in sorted order after a call to Sort or Submit.
+        inline const std::vector<DrawPacket>& GetPackets() const
+        {
+            return packets_;
+        }
+
+    private:
+
+        struct SortEntry
+        {
+            std::uint64_t key;
+            std::uint32_t index;
+        };
+
+    private:
+
+        // Encodes the draw records that have been accumulated since the last pipeline state change.
+        void FlushRecords(CommandBuffer& cmdBuffer, bool indexed, Format indexFormat);
+
+    private:
+
+        std::vector<DrawPacket>     packets_;
+        std::vector<DrawPacket>     sortedPackets_;
+        std::vector<SortEntry>      entries_[2];
+        std::vector<std::uint32_t>  histograms_;
+        bool                        sorted_         = true;
+
+        std::vector<Buffer*>        vertexBuffers_;
+        std::vector<Buffer*>        indexBuffers_;
+        std::vector<ResourceHeap*>  resourceHeaps_;
+        std::vector<DrawRecord>     records_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,93 @@
+/*
+ * FramePacer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_PACER_H
+#define LLGL_FRAME_PACER_H
+
+
+#include <LLGL/Export.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class Display;
+
+/**
+\brief Utility class to limit the frame rate of the main loop to a target frame rate.
+
+Instead of busy-waiting, the pacer sleeps until the start of the next frame with Timer::SleepUntil, which reduces both CPU power and input latency
+compared to a render loop that is only throttled by the presentation queue:
+\code
+LLGL::FramePacer myFramePacer{ 120.0 };
+while (LLGL::Surface::ProcessEvents()) {
+    myFramePacer.WaitForNextFrame();
+    // Poll input, update scene, render ...
+    mySwapChain->Present();
+}
+\endcode
+\remarks This is most useful on displays with variable refresh rate (see Display::SupportsVariableRefreshRate) together with a presentation mode that doesn't wait for the vertical blank,
+e.g. PresentMode::Immediate, since the display then refreshes whenever a new frame is presented.
+\note This class is not required for any interaction with the render system. It is only a utility built on top of Timer::Tick and Timer::SleepUntil.
+\see Timer::SleepUntil
+*/
+class LLGL_EXPORT FramePacer
+{
+
+    public:
+
+        /**
+        \brief Initializes the frame pacer with the specified target frame rate.
+        \param[in] targetFrameRate Specifies the target frame rate (in frames per second). If this is less than or equal to zero, frames are not paced. By default 0.
+        \see SetTargetFrameRate
+        */
+        FramePacer(double targetFrameRate = 0.0);
+
+        /**
+        \brief Sets the new target frame rate (in frames per second). If this is less than or equal to zero, frames are not paced.
+        \remarks The next frame is scheduled relative to the previous one with the new frame interval.
+        */
+        void SetTargetFrameRate(double targetFrameRate);
+
+        /**
+        \brief Sets the target frame rate to the refresh rate of the specified display.
+        \remarks If the refresh rate of the display is unknown, frames are not paced.
+        \see DisplayMode::refreshRate
+        */
+        void SetTargetFrameRate(const Display& display);
+
+        //! Returns the target frame rate (in frames per second) or 0 if frames are not paced.
+        double GetTargetFrameRate() const;
+
+        /**
+        \brief Blocks the calling thread until the next frame is supposed to start.
+        \remarks This should be called once per frame, ideally right before input is polled to keep the latency between input and presentation low.
+        If a frame took longer than the frame interval, the next frame is scheduled from the current time instead of trying to catch up with multiple short frames.
+        */
+        void WaitForNextFrame();
+
+        //! Resets the schedule, so the next call to WaitForNextFrame starts a new frame immediately.
+        void Reset();
+
+    private:
+
+        std::uint64_t frameInterval_    = 0; // Frame interval in timer ticks
+        std::uint64_t nextFrameTick_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
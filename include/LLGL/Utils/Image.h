@@ -107,6 +107,21 @@ class LLGL_EXPORT Image
         */
         void Resize(const Extent3D& extent, const ColorRGBAf& fillColor, const Offset3D& offset);
 
+        /**
+        \brief Resamples the image to the specified extent with a filter, as opposed to Resize, which only crops or extends the image.
+        \param[in] extent Specifies the new image size.
+        \param[in] filter Specifies the resampling filter. By default ImageResampleFilter::Lanczos3.
+        \param[in] isSRGB Specifies whether the color components are in sRGB color space and must be filtered in linear color space. By default false.
+        \param[in] threadCount Specifies the number of threads to use for filtering (see ResampleImageBuffer for more details). By default 0.
+        \see ResampleImageBuffer
+        */
+        void Resample(
+            const Extent3D&             extent,
+            const ImageResampleFilter   filter      = ImageResampleFilter::Lanczos3,
+            bool                        isSRGB      = false,
+            unsigned                    threadCount = 0
+        );
+
         //! Swaps all attributes with the specified image.
         void Swap(Image& rhs);
 
@@ -173,6 +188,22 @@ class LLGL_EXPORT Image
         */
         void WritePixels(const Offset3D& offset, const Extent3D& extent, const ImageView& imageView, unsigned threadCount = 0);
 
+        /**
+        \brief Generates the MIP-map chain of this image and returns all MIP-maps in a tightly packed buffer, starting with a copy of this image.
+        \param[in] filter Specifies the filter to downsample each MIP-map. By default ImageMipMapFilter::Box.
+        \param[in] isSRGB Specifies whether the color components are in sRGB color space and must be filtered in linear color space. By default false.
+        \param[in] numMipLevels Specifies the number of MIP-maps, including the first one. If this is zero, the full MIP-map chain is generated. By default 0.
+        \param[in] threadCount Specifies the number of threads to use for filtering (see GenerateMipChainBuffer for more details). By default 0.
+        \remarks The depth of this image is interpreted as the depth of a 3D texture. Use GenerateMipChainBuffer directly for array textures.
+        \see GenerateMipChainBuffer
+        */
+        DynamicByteArray GenerateMipChain(
+            const ImageMipMapFilter filter          = ImageMipMapFilter::Box,
+            bool                    isSRGB          = false,
+            std::uint32_t           numMipLevels    = 0,
+            unsigned                threadCount     = 0
+        ) const;
+
         /* ----- Attributes ----- */
 
         //! Returns a source image descriptor for this image with read-only access to the image data.
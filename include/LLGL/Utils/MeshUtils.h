@@ -0,0 +1,212 @@
+/*
+ * MeshUtils.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MESH_UTILS_H
+#define LLGL_MESH_UTILS_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Constants.h>
+#include <LLGL/Format.h>
+#include <LLGL/Container/ArrayView.h>
+#include <LLGL/Utils/VertexFormat.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Enumerations ----- */
+
+/**
+\brief Vertex attribute quantization enumeration.
+\remarks Attributes with three components are padded to four components for all non-octahedral quantizations,
+because three-component 8- and 16-bit vertex formats are not supported by all backends. The padded component is zero.
+\see QuantizeVertices
+*/
+enum class VertexQuantization
+{
+    //! The attribute is copied unchanged.
+    None,
+
+    //! Floating-point components are stored as 16-bit signed normalized integers, e.g. Format::RGB32Float becomes Format::RGBA16SNorm. Values are clamped to [-1, 1].
+    SNorm16,
+
+    //! Floating-point components are stored as 8-bit signed normalized integers, e.g. Format::RGB32Float becomes Format::RGBA8SNorm. Values are clamped to [-1, 1].
+    SNorm8,
+
+    //! Floating-point components are stored as half-precision floating-point values, e.g. Format::RG32Float becomes Format::RG16Float.
+    Float16,
+
+    //! Unit vectors with at least three floating-point components are stored in octahedral mapping with two 16-bit signed normalized integers (Format::RG16SNorm).
+    OctahedralSNorm16,
+
+    //! Unit vectors with at least three floating-point components are stored in octahedral mapping with two 8-bit signed normalized integers (Format::RG8SNorm).
+    OctahedralSNorm8,
+};
+
+
+/* ----- Functions ----- */
+
+/**
+\defgroup group_mesh_util Mesh utility functions to reduce vertex processing, overdraw, and vertex bandwidth.
+\addtogroup group_mesh_util
+@{
+*/
+
+/**
+\brief Returns the average number of vertex cache misses per triangle (ACMR) for the specified triangle list.
+\param[in] indices Pointer to the triangle list indices.
+\param[in] numIndices Specifies the number of indices. This must be a multiple of 3.
+\param[in] indexFormat Specifies the index format. This must be either Format::R16UInt or Format::R32UInt.
+\param[in] cacheSize Specifies the number of entries of the simulated FIFO vertex cache. By default 16.
+\return Average number of cache misses per triangle in the range [0.5, 3], or 0 if there are no triangles.
+Values close to 0.5 are optimal for regular grids; values close to 3 mean that vertices are not reused at all.
+*/
+LLGL_EXPORT float GetVertexCacheMissRatio(
+    const void*     indices,
+    std::size_t     numIndices,
+    Format          indexFormat,
+    std::uint32_t   cacheSize   = 16
+);
+
+/**
+\brief Reorders the triangles of the specified triangle list to improve the post-transform vertex cache efficiency.
+\param[in,out] indices Pointer to the triangle list indices that are reordered in place.
+\param[in] numIndices Specifies the number of indices. This must be a multiple of 3.
+\param[in] indexFormat Specifies the index format. This must be either Format::R16UInt or Format::R32UInt.
+\param[in] threadCount Specifies the number of threads to use. Large meshes are split into batches of consecutive triangles that are optimized concurrently.
+If this is LLGL_MAX_THREAD_COUNT, the maximum number of threads the system supports will be used (e.g. 4 on a quad-core processor). By default LLGL_MAX_THREAD_COUNT.
+\remarks This uses a linear-speed greedy algorithm that scores triangles by the position of their vertices in a simulated LRU cache and by the number of remaining triangles of each vertex.
+The winding order of each triangle and the set of triangles remain unchanged.
+\throw std::runtime_error If \c numIndices is not a multiple of 3 or \c indexFormat is invalid.
+\see GetVertexCacheMissRatio
+*/
+LLGL_EXPORT void OptimizeVertexCache(
+    void*           indices,
+    std::size_t     numIndices,
+    Format          indexFormat,
+    unsigned        threadCount = LLGL_MAX_THREAD_COUNT
+);
+
+/**
+\brief Reorders clusters of triangles to reduce overdraw while preserving most of the vertex cache efficiency.
+\param[in,out] indices Pointer to the triangle list indices that are reordered in place. This should already be optimized with OptimizeVertexCache.
+\param[in] numIndices Specifies the number of indices. This must be a multiple of 3.
+\param[in] indexFormat Specifies the index format. This must be either Format::R16UInt or Format::R32UInt.
+\param[in] positions Pointer to the first vertex position. Each position must consist of three 32-bit floating-point values.
+\param[in] numVertices Specifies the number of vertices \c positions refers to. All indices must be less than this value.
+\param[in] positionStride Specifies the stride (in bytes) between two consecutive vertex positions.
+\param[in] threadCount Specifies the number of threads to compute the cluster sort keys.
+If this is LLGL_MAX_THREAD_COUNT, the maximum number of threads the system supports will be used (e.g. 4 on a quad-core processor). By default LLGL_MAX_THREAD_COUNT.
+\remarks The triangle list is split into clusters at the vertex cache boundaries, i.e. where a triangle does not share any vertex with the simulated cache.
+The clusters are then sorted so that clusters facing away from the mesh center are drawn first, since they are more likely to occlude the remaining clusters.
+\throw std::runtime_error If \c numIndices is not a multiple of 3, \c indexFormat is invalid, or \c positions is null.
+*/
+LLGL_EXPORT void OptimizeOverdraw(
+    void*           indices,
+    std::size_t     numIndices,
+    Format          indexFormat,
+    const void*     positions,
+    std::size_t     numVertices,
+    std::size_t     positionStride,
+    unsigned        threadCount     = LLGL_MAX_THREAD_COUNT
+);
+
+/**
+\brief Reorders the vertices in the order they are first referenced by the specified indices to improve the vertex fetch locality, and remaps the indices accordingly.
+\param[in,out] vertices Pointer to the interleaved vertices that are reordered in place.
+\param[in] numVertices Specifies the number of vertices.
+\param[in] vertexStride Specifies the stride (in bytes) of each vertex.
+\param[in,out] indices Pointer to the indices that are remapped in place.
+\param[in] numIndices Specifies the number of indices.
+\param[in] indexFormat Specifies the index format. This must be either Format::R16UInt or Format::R32UInt.
+\return Number of vertices that are referenced by the indices. Vertices that are not referenced are moved to the end and can be discarded.
+\remarks This should be called after OptimizeVertexCache and OptimizeOverdraw, since it depends on the final order of the indices.
+\throw std::runtime_error If \c indexFormat is invalid or an index is out of bounds.
+*/
+LLGL_EXPORT std::size_t OptimizeVertexFetch(
+    void*           vertices,
+    std::size_t     numVertices,
+    std::size_t     vertexStride,
+    void*           indices,
+    std::size_t     numIndices,
+    Format          indexFormat
+);
+
+/**
+\brief Returns the vertex format for the specified source vertex format with quantized attributes.
+\param[in] srcFormat Specifies the source vertex format. All attributes must be in the same buffer binding slot.
+\param[in] quantizations Specifies the quantization for each attribute of \c srcFormat. Attributes without an entry are not quantized.
+\return Vertex format with the same attribute names, locations, and slot, but with quantized formats, and tightly packed offsets.
+Each attribute offset and the vertex stride are aligned to 4 bytes.
+\throw std::runtime_error If a quantization is not compatible with the format of its attribute, or if the attributes use multiple buffer binding slots.
+\see QuantizeVertices
+*/
+LLGL_EXPORT VertexFormat GetQuantizedVertexFormat(
+    const VertexFormat&                     srcFormat,
+    const ArrayView<VertexQuantization>&    quantizations
+);
+
+/**
+\brief Packs the specified vertices into quantized attributes.
+\param[in] srcFormat Specifies the source vertex format. All attributes must be in the same buffer binding slot.
+\param[in] srcVertices Pointer to the interleaved source vertices.
+\param[in] numVertices Specifies the number of vertices to convert.
+\param[in] quantizations Specifies the quantization for each attribute. This must be the same as for GetQuantizedVertexFormat.
+\param[out] dstVertices Pointer to the destination buffer. This must be large enough to hold \c numVertices vertices with the stride of the quantized vertex format.
+\param[in] dstSize Specifies the size (in bytes) of the destination buffer.
+\param[in] threadCount Specifies the number of threads to use for the conversion.
+If this is LLGL_MAX_THREAD_COUNT, the maximum number of threads the system supports will be used (e.g. 4 on a quad-core processor). By default LLGL_MAX_THREAD_COUNT.
+\return Vertex format of the destination vertices as returned by GetQuantizedVertexFormat.
+\code
+const LLGL::VertexQuantization quantizations[] =
+{
+    LLGL::VertexQuantization::None,                 // Position
+    LLGL::VertexQuantization::OctahedralSNorm16,    // Normal
+    LLGL::VertexQuantization::Float16,              // Texture coordinate
+};
+const LLGL::VertexFormat packedFormat = LLGL::GetQuantizedVertexFormat(myVertexFormat, quantizations);
+std::vector<char> packedVertices(packedFormat.GetStride() * myNumVertices);
+LLGL::QuantizeVertices(myVertexFormat, myVertices, myNumVertices, quantizations, packedVertices.data(), packedVertices.size());
+\endcode
+\remarks Octahedral normals must be decoded in the vertex shader, for example:
+\code
+vec3 DecodeOctahedral(vec2 e)
+{
+    vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+        n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(n);
+}
+\endcode
+\throw std::runtime_error If \c srcVertices or \c dstVertices is null, or if \c dstSize is too small.
+\see GetQuantizedVertexFormat
+*/
+LLGL_EXPORT VertexFormat QuantizeVertices(
+    const VertexFormat&                     srcFormat,
+    const void*                             srcVertices,
+    std::size_t                             numVertices,
+    const ArrayView<VertexQuantization>&    quantizations,
+    void*                                   dstVertices,
+    std::size_t                             dstSize,
+    unsigned                                threadCount     = LLGL_MAX_THREAD_COUNT
+);
+
+/** @} */
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,209 @@
+/*
+ * OcclusionQueryBatch.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_OCCLUSION_QUERY_BATCH_H
+#define LLGL_OCCLUSION_QUERY_BATCH_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/QueryHeapFlags.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class CommandQueue;
+class QueryHeap;
+class Buffer;
+class Fence;
+
+/**
+\brief Descriptor structure for an OcclusionQueryBatch.
+\see OcclusionQueryBatch::OcclusionQueryBatch
+*/
+struct OcclusionQueryBatchDescriptor
+{
+    //! Specifies the number of occlusion queries per frame, i.e. the number of objects that can be tested. This must be greater than zero.
+    std::uint32_t   numQueries              = 0;
+
+    /**
+    \brief Specifies the number of frames in flight. This must be greater than zero. By default 3.
+    \remarks Each frame has its own query heap, so results can be read back up to this many frames after they have been issued.
+    */
+    std::uint32_t   numFrames               = 3;
+
+    /**
+    \brief Specifies the type of occlusion queries. By default QueryType::AnySamplesPassed.
+    \remarks This must be either QueryType::SamplesPassed, QueryType::AnySamplesPassed, or QueryType::AnySamplesPassedConservative.
+    */
+    QueryType       type                    = QueryType::AnySamplesPassed;
+
+    /**
+    \brief Specifies the number of frames an object is still considered visible after its most recent positive result. By default 1.
+    \remarks This hides the latency of the readback for objects that become visible again, i.e. it trades a few false positives for no popping.
+    */
+    std::uint32_t   numHysteresisFrames     = 1;
+
+    /**
+    \brief Specifies the binding flags of an additional GPU buffer that receives the query results of each frame. By default 0.
+    \remarks If this is non-zero, a buffer with BindFlags::CopyDst and these flags is created, e.g. BindFlags::Storage to generate indirect arguments in a compute shader.
+    This requires RenderingFeatures::hasQueryResolve.
+    \see OcclusionQueryBatch::GetResultBuffer
+    */
+    long            resultBufferBindFlags   = 0;
+};
+
+/**
+\brief Utility class to batch a large number of occlusion queries per frame and consume their results without stalling the CPU.
+
+Each frame has its own query heap. The results of all queries of a frame are copied at once on the GPU with CommandBuffer::ResolveQueryData
+and read back once the GPU has finished that frame. Visibility is answered conservatively from the most recent results:
+\code
+// Frame N: issue occlusion queries for bounding volumes of objects that passed frustum culling
+for (std::uint32_t i = 0; i < numObjects; ++i) {
+    myOcclusionBatch.BeginQuery(*myCmdBuffer, i);
+    RenderBoundingBox(i);
+    myOcclusionBatch.EndQuery(*myCmdBuffer, i);
+}
+myCmdBuffer->EndRenderPass();
+myOcclusionBatch.Resolve(*myCmdBuffer);
+myCmdBuffer->End();
+myCmdQueue->Submit(*myCmdBuffer);
+myOcclusionBatch.Submit();
+
+// Frame N+k: render objects depending on their last known visibility
+if (myOcclusionBatch.IsVisible(i))
+    RenderObject(i);
+\endcode
+\remarks Objects without any result yet are considered visible.
+\remarks If the renderer does not support RenderingFeatures::hasQueryResolve, the results are retrieved with CommandQueue::QueryResult
+once the GPU has finished the respective frame, which is also free of stalls.
+\note This class is not required for any interaction with the render system. It is only a utility built on top of query heaps, fences, and ResolveQueryData.
+*/
+class LLGL_EXPORT OcclusionQueryBatch : public NonCopyable
+{
+
+    public:
+
+        //! Creates the query heaps, fences, and readback buffers for all frames in flight.
+        OcclusionQueryBatch(RenderSystem& renderer, const OcclusionQueryBatchDescriptor& desc);
+
+        //! Waits for all frames in flight and releases all resources of this batch.
+        ~OcclusionQueryBatch();
+
+        /**
+        \brief Begins the occlusion query for the specified object in the current frame.
+        \param[in] query Specifies the zero-based index of the object. This must be less than OcclusionQueryBatchDescriptor::numQueries.
+        \remarks Each query can only be issued once per frame.
+        \see CommandBuffer::BeginQuery
+        */
+        void BeginQuery(CommandBuffer& cmdBuffer, std::uint32_t query);
+
+        //! Ends the occlusion query for the specified object in the current frame.
+        void EndQuery(CommandBuffer& cmdBuffer, std::uint32_t query);
+
+        /**
+        \brief Records the commands to copy the results of all queries that have been issued in the current frame.
+        \remarks This must be recorded outside of a render pass and after all queries of the current frame have been ended.
+        \see CommandBuffer::ResolveQueryData
+        */
+        void Resolve(CommandBuffer& cmdBuffer);
+
+        /**
+        \brief Submits the fence of the current frame to the primary command queue and advances to the next frame.
+        \remarks All command buffers with queries of the current frame must have been submitted before.
+        This blocks the CPU only if the GPU falls behind by more than OcclusionQueryBatchDescriptor::numFrames frames.
+        */
+        void Submit();
+
+        /**
+        \brief Reads back the results of all frames the GPU has finished and updates the visibility of their objects.
+        \remarks This is also done implicitly by Submit. It does not block the CPU.
+        */
+        void Update();
+
+        /**
+        \brief Returns true if the specified object is considered visible.
+        \remarks This is the case if the object has no result yet, if its most recent result has passed,
+        or if it has passed within OcclusionQueryBatchDescriptor::numHysteresisFrames frames before its most recent result.
+        */
+        bool IsVisible(std::uint32_t query) const;
+
+        /**
+        \brief Returns the GPU buffer that receives the results of each frame or null if OcclusionQueryBatchDescriptor::resultBufferBindFlags was zero.
+        \remarks Each result is written as 64-bit unsigned integer at the index of its query. Results of queries that have not been issued in the most recent resolve are left unchanged.
+        */
+        inline Buffer* GetResultBuffer() const
+        {
+            return resultBuffer_;
+        }
+
+        //! Returns the index of the current frame. This starts at 1 and is incremented with each call to Submit.
+        inline std::uint64_t GetCurrentFrame() const
+        {
+            return currentFrame_;
+        }
+
+    private:
+
+        struct Frame
+        {
+            QueryHeap*                  queryHeap       = nullptr;
+            Buffer*                     readbackBuffer  = nullptr;
+            Fence*                      fence           = nullptr;
+            std::uint64_t               index           = 0;
+            std::vector<std::uint32_t>  queries;
+            bool                        resolved        = false;
+            bool                        submitted       = false;
+            bool                        consumed        = false;
+        };
+
+    private:
+
+        // Returns the frame for the specified frame index.
+        Frame& GetFrame(std::uint64_t index);
+
+        // Reads back the results of the specified frame and updates the visibility of its objects.
+        void ConsumeFrameResults(Frame& frame);
+
+        // Calls the specified function for each contiguous range of queries that have been issued in the specified frame.
+        template <typename TFunc>
+        void ForEachQueryRange(Frame& frame, const TFunc& func);
+
+    private:
+
+        RenderSystem&               renderer_;
+        CommandQueue*               commandQueue_           = nullptr;
+        std::uint32_t               numQueries_             = 0;
+        std::uint32_t               numHysteresisFrames_    = 0;
+        bool                        hasQueryResolve_        = false;
+
+        std::vector<Frame>          frames_;
+        Buffer*                     resultBuffer_           = nullptr;
+        std::uint64_t               currentFrame_           = 1;
+
+        std::vector<std::uint64_t>  issuedFrames_;          // Frame index each query has been issued in most recently.
+        std::vector<std::uint64_t>  resultFrames_;          // Frame index of the most recent result of each query.
+        std::vector<std::uint64_t>  visibleFrames_;         // Frame index of the most recent positive result of each query.
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
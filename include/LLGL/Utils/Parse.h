@@ -84,6 +84,7 @@ class LLGL_EXPORT ParseContext
             - \c rwbuffer for read/write storage buffers (i.e. ResourceType::Buffer and BindFlags::Storage).
             - \c texture for textures (i.e. ResourceType::Texture and BindFlags::Sampled).
             - \c rwtexture for read/write textures (i.e. ResourceType::Texture and BindFlags::Storage).
+            - \c accelstruct for top-level ray tracing acceleration structures (i.e. ResourceType::Buffer and BindFlags::AccelerationStructure).
             - \c sampler for sampler states (i.e. ResourceType::Sampler).
         - Optionally, the resource <b>name</b> is specified as an arbitrary identifier followed by the at-sign (e.g. <code>"texture(myColorMap@1)"</code>).
         - The <b>slot</b> of each binding point (i.e. BindingDescriptor::slot) is specified as an integral number within brackets (e.g. <code>"texture(1)"</code>).
@@ -97,6 +98,13 @@ class LLGL_EXPORT ParseContext
             - \c geom for the geometry shader stage (i.e. StageFlags::GeometryStage).
             - \c frag for the fragment shader stage (i.e. StageFlags::FragmentStage).
             - \c comp for the compute shader stage (i.e. StageFlags::ComputeStage).
+            - \c task for the task shader stage (i.e. StageFlags::TaskStage).
+            - \c mesh for the mesh shader stage (i.e. StageFlags::MeshStage).
+            - \c tile for the tile shader stage (i.e. StageFlags::TileStage).
+            - \c rgen for the ray generation shader stage (i.e. StageFlags::RayGenerationStage).
+            - \c rmiss for the ray miss shader stage (i.e. StageFlags::MissStage).
+            - \c rchit for the ray closest-hit shader stage (i.e. StageFlags::ClosestHitStage).
+            - \c rahit for the ray any-hit shader stage (i.e. StageFlags::AnyHitStage).
         - If no stage flag is specified, all shader stages will be used.
         - The following syntax can be used for uniform descriptors (see LLGL::UniformType for accepted type names):
             \code
@@ -0,0 +1,136 @@
+/*
+ * PipelineStateRegistry.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PIPELINE_STATE_REGISTRY_H
+#define LLGL_PIPELINE_STATE_REGISTRY_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <cstdint>
+#include <vector>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class PipelineState;
+class PipelineCache;
+
+/**
+\brief Statistics of a PipelineStateRegistry.
+\see PipelineStateRegistry::GetStatistics
+*/
+struct PipelineStateRegistryStatistics
+{
+    //! Number of requests that returned an existing pipeline state.
+    std::uint64_t numHits           = 0;
+
+    //! Number of requests that created a new pipeline state.
+    std::uint64_t numMisses         = 0;
+
+    //! Number of distinct pipeline states that are currently registered.
+    std::uint32_t numPipelineStates = 0;
+};
+
+/**
+\brief Utility class to share pipeline states that are created with identical descriptors.
+
+Each request hashes the pipeline descriptor, i.e. its shaders, pipeline layout, render pass, all static states, and specialization constants.
+If a pipeline state with an identical descriptor has already been created, its reference counter is incremented and the existing pipeline state is returned.
+Otherwise, a new pipeline state is created with the render system:
+\code
+LLGL::PipelineStateRegistry myPSORegistry{ *myRenderer };
+LLGL::PipelineState* myMaterialPSO = myPSORegistry.CreatePipelineState(myMaterialPSODesc);
+// Render with myMaterialPSO ...
+myPSORegistry.Release(*myMaterialPSO);
+\endcode
+\remarks Pipeline states are compared by the identity of their shader, pipeline layout, and render pass objects,
+so two descriptors only match if they refer to the same objects. The debug name is not part of the comparison,
+i.e. a shared pipeline state keeps the debug name of the descriptor it has been created with.
+\remarks Pipeline states that failed to compile (see PipelineState::GetReport) are not registered, so each request for them creates a new pipeline state.
+\remarks This class is not thread-safe. All calls must be synchronized by the client.
+\note This class is not required for any interaction with the render system. It is only a utility built on top of RenderSystem::CreatePipelineState.
+*/
+class LLGL_EXPORT PipelineStateRegistry : public NonCopyable
+{
+
+    public:
+
+        //! Initializes the registry with the render system to create the pipeline states with.
+        PipelineStateRegistry(RenderSystem& renderer);
+
+        //! Releases all remaining pipeline states of this registry.
+        ~PipelineStateRegistry();
+
+        /**
+        \brief Returns a graphics pipeline state for the specified descriptor.
+        \param[in] pipelineStateDesc Specifies the descriptor of the graphics pipeline state.
+        \param[in] pipelineCache Optional pipeline cache that is only used if a new pipeline state must be created.
+        \return Pointer to the new or existing pipeline state. Each returned pipeline state must be released with Release.
+        \see RenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor&, PipelineCache*)
+        */
+        PipelineState* CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache = nullptr);
+
+        /**
+        \brief Returns a compute pipeline state for the specified descriptor.
+        \see CreatePipelineState(const GraphicsPipelineDescriptor&, PipelineCache*)
+        */
+        PipelineState* CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache = nullptr);
+
+        /**
+        \brief Decrements the reference counter of the specified pipeline state and releases it with the render system once it is no longer referenced.
+        \remarks The pipeline state must have been returned by this registry.
+        */
+        void Release(PipelineState& pipelineState);
+
+        //! Returns the statistics of this registry.
+        inline const PipelineStateRegistryStatistics& GetStatistics() const
+        {
+            return statistics_;
+        }
+
+        //! Resets the hit and miss counters of the statistics.
+        void ResetStatistics();
+
+    private:
+
+        struct Entry
+        {
+            std::vector<char>   key;
+            PipelineState*      pipelineState   = nullptr;
+            std::uint32_t       refCount        = 0;
+        };
+
+    private:
+
+        // Returns the existing pipeline state for the specified key or creates a new one with the specified callback.
+        template <typename TCreateFunc>
+        PipelineState* FindOrCreatePipelineState(std::vector<char>&& key, const TCreateFunc& createFunc);
+
+    private:
+
+        RenderSystem&                                           renderer_;
+        std::unordered_multimap<std::uint64_t, Entry>           entries_;
+        std::unordered_map<const PipelineState*, std::uint64_t> hashes_;
+        PipelineStateRegistryStatistics                         statistics_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,177 @@
+/*
+ * ReadbackRing.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_READBACK_RING_H
+#define LLGL_READBACK_RING_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/TextureFlags.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class CommandQueue;
+class Buffer;
+class Texture;
+class Fence;
+
+/**
+\brief Handle to a readback that has been recorded into a ReadbackRing.
+\see ReadbackRing::ReadBuffer
+\see ReadbackRing::ReadTexture
+*/
+struct ReadbackTicket
+{
+    //! Index of the frame this readback has been recorded in. Zero denotes an invalid ticket.
+    std::uint64_t frame     = 0;
+
+    //! Offset (in bytes) of the readback data within the buffer of its frame.
+    std::uint64_t offset    = 0;
+
+    //! Size (in bytes) of the readback data.
+    std::uint64_t size      = 0;
+};
+
+/**
+\brief Utility class to read back buffer and texture data from the GPU without stalling the CPU.
+
+Readbacks are recorded as copy commands into a command buffer that copy the data into a ring of CPU-readable buffers, one per frame in flight.
+The returned ticket can be polled in later frames and mapped directly via RenderSystem::MapBuffer, i.e. without any intermediate copy:
+\code
+// Frame N: record readback and submit the frame
+LLGL::ReadbackTicket ticket = myReadbackRing.ReadBuffer(*myCmdBuffer, *myPickingBuffer, 0, sizeof(PickingResult));
+myCmdQueue->Submit(*myCmdBuffer);
+myReadbackRing.Submit();
+
+// Frame N+k: map readback data once the GPU has finished frame N
+if (myReadbackRing.IsReady(ticket))
+{
+    const void* data = myReadbackRing.Map(ticket);
+    ...
+    myReadbackRing.Unmap(ticket);
+}
+\endcode
+\remarks The ring buffers are created with MiscFlags::PersistentMapping if the renderer supports it (see RenderingFeatures::hasPersistentMapping),
+so mapping a completed readback neither copies nor waits for the GPU. With Direct3D 12, they are allocated in a readback heap instead.
+\remarks A ticket expires after \c numFrames further calls to Submit, since its frame buffer is recycled for new readbacks.
+\note This class is not required for any interaction with the render system. It is only a utility built on top of command buffers, fences, and MapBuffer.
+*/
+class LLGL_EXPORT ReadbackRing : public NonCopyable
+{
+
+    public:
+
+        /**
+        \brief Creates the readback ring with one buffer and fence per frame in flight.
+        \param[in] renderer Specifies the render system to create the buffers and fences with.
+        \param[in] frameSize Specifies the capacity (in bytes) of the readback buffer of each frame.
+        \param[in] numFrames Specifies the number of frames in flight. Readbacks can be polled up to this many frames after they have been recorded.
+        The ring only blocks the CPU in Submit when the GPU falls behind by more than this number of frames. This must be greater than zero. By default 3.
+        */
+        ReadbackRing(RenderSystem& renderer, std::uint64_t frameSize, std::uint32_t numFrames = 3);
+
+        //! Waits for all frames in flight and releases the readback buffers and fences.
+        ~ReadbackRing();
+
+        /**
+        \brief Records a copy of the specified buffer range into the readback buffer of the current frame.
+        \param[in,out] cmdBuffer Specifies the command buffer to record the copy command into. This must be submitted before the next call to Submit.
+        \param[in] srcBuffer Specifies the source buffer. This must have been created with BindFlags::CopySrc.
+        \return Ticket to poll and map the readback data, or an invalid ticket (i.e. ReadbackTicket::frame is zero)
+        if the remaining capacity of the current frame is insufficient.
+        */
+        ReadbackTicket ReadBuffer(CommandBuffer& cmdBuffer, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size);
+
+        /**
+        \brief Records a copy of the specified texture region into the readback buffer of the current frame.
+        \remarks The texture data is tightly packed in the format of the source texture.
+        \see ReadBuffer
+        \see CommandBuffer::CopyBufferFromTexture
+        */
+        ReadbackTicket ReadTexture(CommandBuffer& cmdBuffer, Texture& srcTexture, const TextureRegion& srcRegion);
+
+        /**
+        \brief Submits the fence of the current frame to the primary command queue and advances to the next frame.
+        \remarks All command buffers with readbacks of the current frame must have been submitted before.
+        This blocks the CPU only if the next frame buffer is still in use by the GPU.
+        */
+        void Submit();
+
+        /**
+        \brief Returns true if the GPU has finished the readback of the specified ticket.
+        \remarks This does not block the CPU. Returns false if the ticket is invalid, expired, or its frame has not been submitted yet.
+        */
+        bool IsReady(const ReadbackTicket& ticket) const;
+
+        /**
+        \brief Maps the readback data of the specified ticket into CPU memory space.
+        \return Pointer to the readback data or null if the ticket is not ready. See IsReady.
+        \remarks Only one ticket of each frame can be mapped at a time. Each successful call must be followed by a call to Unmap.
+        */
+        const void* Map(const ReadbackTicket& ticket);
+
+        //! Unmaps the readback data of the specified ticket that has previously been mapped.
+        void Unmap(const ReadbackTicket& ticket);
+
+        //! Returns the capacity (in bytes) of the readback buffer of each frame.
+        inline std::uint64_t GetFrameSize() const
+        {
+            return frameSize_;
+        }
+
+        //! Returns the index of the current frame. This starts at 1 and is incremented with each call to Submit.
+        inline std::uint64_t GetCurrentFrame() const
+        {
+            return currentFrame_;
+        }
+
+    private:
+
+        struct Frame
+        {
+            Buffer*         buffer      = nullptr;
+            Fence*          fence       = nullptr;
+            std::uint64_t   index       = 0;
+            std::uint64_t   offset      = 0;
+            bool            submitted   = false;
+        };
+
+    private:
+
+        // Allocates the specified number of bytes in the current frame and returns a ticket for it.
+        ReadbackTicket Allocate(std::uint64_t size);
+
+        // Returns the frame for the specified ticket or null if the ticket is invalid or expired.
+        const Frame* FindFrame(const ReadbackTicket& ticket) const;
+
+    private:
+
+        RenderSystem&       renderer_;
+        CommandQueue*       commandQueue_   = nullptr;
+        std::uint64_t       frameSize_      = 0;
+        std::vector<Frame>  frames_;
+        std::uint64_t       currentFrame_   = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
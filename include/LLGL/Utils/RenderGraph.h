@@ -0,0 +1,201 @@
+/*
+ * RenderGraph.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_RENDER_GRAPH_H
+#define LLGL_RENDER_GRAPH_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <cstdint>
+#include <functional>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class CommandBuffer;
+class Buffer;
+class Texture;
+
+/**
+\brief Handle to a resource of a RenderGraph. This is either an imported buffer or texture, or a transient texture that is allocated by the graph.
+\see RenderGraph::ImportBuffer
+\see RenderGraph::ImportTexture
+\see RenderGraph::CreateTransientTexture
+*/
+struct RenderGraphResource
+{
+    //! Index of the resource within its graph. The maximum value denotes an invalid handle.
+    std::uint32_t index = ~0u;
+};
+
+/**
+\brief Handle to a pass of a RenderGraph.
+\see RenderGraph::AddPass
+*/
+struct RenderGraphPass
+{
+    //! Index of the pass within its graph. The maximum value denotes an invalid handle.
+    std::uint32_t index = ~0u;
+};
+
+/**
+\brief Enumeration of the ways a pass of a RenderGraph can access a resource.
+\remarks The graph only inserts explicit barriers for storage writes, i.e. CommandBuffer::ResourceBarrier after RenderGraphAccess::Storage.
+All other transitions, e.g. from a color attachment to a sampled texture, are already performed implicitly by the backends.
+*/
+enum class RenderGraphAccess
+{
+    //! Resource is read in a shader, e.g. as sampled texture or constant buffer.
+    Sampled,
+
+    //! Resource is read or written in a shader as storage resource (aka. unordered access view).
+    Storage,
+
+    //! Texture is used as color or depth-stencil attachment of a render target.
+    Attachment,
+
+    //! Resource is used as source or destination of a copy command.
+    Copy,
+};
+
+/**
+\brief Utility class to schedule render passes that declare which resources they read and write.
+
+Each frame, passes are added in their submission order together with a callback that records their commands.
+The graph then culls all passes whose results are never consumed, inserts the resource barriers between passes,
+allocates transient textures with aliased memory, and synchronizes passes on different command queues with fences:
+\code
+LLGL::RenderGraphResource sceneColor = myGraph.CreateTransientTexture(mySceneColorDesc);
+LLGL::RenderGraphResource backbuffer = myGraph.ImportTexture(*myOutputTexture);
+
+LLGL::RenderGraphPass scenePass = myGraph.AddPass("Scene", [&](LLGL::CommandBuffer& cmdBuffer) { ... });
+myGraph.Write(scenePass, sceneColor, LLGL::RenderGraphAccess::Attachment);
+
+LLGL::RenderGraphPass postPass = myGraph.AddPass("PostProcess", [&](LLGL::CommandBuffer& cmdBuffer)
+{
+    LLGL::Texture* sceneColorTex = myGraph.GetTexture(sceneColor);
+    ...
+});
+myGraph.Read(postPass, sceneColor, LLGL::RenderGraphAccess::Sampled);
+myGraph.Write(postPass, backbuffer, LLGL::RenderGraphAccess::Attachment);
+
+myGraph.Execute();
+myGraph.Reset();
+\endcode
+\remarks A pass is only executed if it has side effects (see SetSideEffects), writes to an imported resource,
+or writes to a resource that is read by another pass that is executed.
+\remarks Transient textures whose lifetimes do not overlap share the same memory in a placement heap if the renderer supports it (see RenderingFeatures::hasPlacementHeaps).
+Otherwise, textures with equal descriptors are reused. In both cases, the content of a transient texture is undefined when it is first written within a frame.
+\remarks Passes on a dedicated compute or copy queue (see RenderSystem::GetCommandQueue(CommandQueueType)) can run in parallel with the graphics queue.
+Transient textures that are accessed on such a queue are never aliased, since their lifetime cannot be determined from the submission order alone.
+\note This class is not required for any interaction with the render system. It is only a utility built on top of command buffers, fences, and placement heaps.
+*/
+class LLGL_EXPORT RenderGraph : public NonCopyable
+{
+
+    public:
+
+        //! Callback function to record the commands of a pass. The command buffer is already in recording state.
+        using ExecuteFunction = std::function<void(CommandBuffer& cmdBuffer)>;
+
+    public:
+
+        //! Creates an empty render graph for the specified render system.
+        RenderGraph(RenderSystem& renderer);
+
+        //! Waits for the command queues and releases all transient textures, command buffers, and fences.
+        ~RenderGraph();
+
+        /**
+        \brief Imports the specified buffer that is owned by the application.
+        \remarks Passes that write to imported resources are never culled.
+        */
+        RenderGraphResource ImportBuffer(Buffer& buffer);
+
+        /**
+        \brief Imports the specified texture that is owned by the application.
+        \remarks Passes that write to imported resources are never culled.
+        */
+        RenderGraphResource ImportTexture(Texture& texture);
+
+        /**
+        \brief Declares a transient texture that is only valid during the execution of the graph.
+        \param[in] textureDesc Specifies the descriptor of the texture. MiscFlags::Sparse is not allowed, and the texture never has initial data.
+        \remarks The texture is allocated when the graph is compiled and can be retrieved with GetTexture inside the execute callbacks.
+        */
+        RenderGraphResource CreateTransientTexture(const TextureDescriptor& textureDesc);
+
+        /**
+        \brief Adds a new pass to the graph.
+        \param[in] name Specifies the name of the pass. This is used as debug name for its command buffer and for debug groups.
+        \param[in] execute Specifies the callback to record the commands of the pass.
+        \param[in] queueType Specifies the type of command queue this pass is submitted to.
+        If the renderer has no dedicated queue of this type, the pass is submitted to the primary command queue.
+        \remarks Passes are executed in the order they have been added.
+        */
+        RenderGraphPass AddPass(const char* name, const ExecuteFunction& execute, const CommandQueueType queueType = CommandQueueType::Graphics);
+
+        //! Declares that the specified pass reads from the specified resource.
+        void Read(const RenderGraphPass& pass, const RenderGraphResource& resource, const RenderGraphAccess access = RenderGraphAccess::Sampled);
+
+        //! Declares that the specified pass writes to the specified resource.
+        void Write(const RenderGraphPass& pass, const RenderGraphResource& resource, const RenderGraphAccess access = RenderGraphAccess::Attachment);
+
+        //! Marks the specified pass to have side effects beyond its declared resources, so it is never culled.
+        void SetSideEffects(const RenderGraphPass& pass);
+
+        /**
+        \brief Culls unused passes, computes barriers and queue synchronization, and allocates transient textures.
+        \remarks This is called automatically by Execute if the graph has been modified since the last compilation.
+        */
+        void Compile();
+
+        /**
+        \brief Records and submits all passes that have not been culled.
+        \remarks Each dedicated command queue receives its own command buffers. Passes on the same queue share a command buffer
+        until a fence has to be signaled or waited on.
+        */
+        void Execute();
+
+        /**
+        \brief Removes all passes and resources from the graph, e.g. to declare the passes of the next frame.
+        \remarks The transient textures, placement heap, command buffers, and fences are kept to be reused by the next compilation.
+        All resource and pass handles become invalid.
+        */
+        void Reset();
+
+        //! Returns the texture of the specified resource or null if it is not a texture. Transient textures are only available after compilation.
+        Texture* GetTexture(const RenderGraphResource& resource) const;
+
+        //! Returns the buffer of the specified resource or null if it is not a buffer.
+        Buffer* GetBuffer(const RenderGraphResource& resource) const;
+
+        //! Returns true if the specified pass has been culled by the last compilation.
+        bool IsPassCulled(const RenderGraphPass& pass) const;
+
+    private:
+
+        struct Pimpl;
+        Pimpl* pimpl_ = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,166 @@
+/*
+ * TextureContainer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TEXTURE_CONTAINER_H
+#define LLGL_TEXTURE_CONTAINER_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Blob.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/ResourceFlags.h>
+#include <cstdint>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class RenderSystem;
+class Texture;
+class Fence;
+class Report;
+
+/**
+\brief Enumeration of GPU-native texture container file formats.
+\see TextureContainer::GetContainerFormat
+*/
+enum class TextureContainerFormat
+{
+    //! Undefined container format, i.e. nothing has been loaded.
+    Undefined,
+
+    //! DirectDraw Surface (DDS) including the DX10 header extension.
+    DDS,
+
+    //! Khronos Texture 2.0 (KTX2).
+    KTX2,
+};
+
+/**
+\brief Subresource of a TextureContainer, i.e. the image data of a single MIP-map level for one or more array layers.
+\see TextureContainer::GetSubresources
+*/
+struct TextureContainerSubresource
+{
+    //! Specifies the texture region this subresource is written to. Its subresource always refers to a single MIP-map level.
+    TextureRegion   region;
+
+    //! Specifies the image view that refers to the data of this subresource within the container.
+    ImageView       imageView;
+};
+
+/**
+\brief Utility class to load GPU-native texture containers (DDS and KTX2) and upload them without any conversion.
+
+The content is mapped into memory and every MIP-map level and array layer is described by an image view that points directly into the file mapping.
+This makes it possible to upload block compressed textures (e.g. Format::BC7UNorm) with a single batched call to RenderSystem::WriteTextureAsync:
+\code
+LLGL::TextureContainer myContainer;
+if (myContainer.LoadFromFile("Textures/Albedo.ktx2"))
+    myTexture = myContainer.CreateTexture(*myRenderer);
+\endcode
+\remarks Supported are all container formats that map to an LLGL::Format, including cube maps, arrays, and 3D textures.
+For DDS files, legacy FourCC codes (e.g. \c "DXT1" or \c "ATI2"), common uncompressed RGB masks, and the DX10 header extension are supported.
+\remarks KTX2 files with supercompression (i.e. BasisLZ, Zstandard, or ZLIB) or with \c VK_FORMAT_UNDEFINED (e.g. UASTC) are rejected,
+since LLGL does not include a transcoder or decompressor for these schemes. Such files must be transcoded into one of the supported formats by the content pipeline.
+\note This class is not required for any interaction with the render system. It is only a utility built on top of TextureDescriptor and ImageView.
+*/
+class LLGL_EXPORT TextureContainer
+{
+
+    public:
+
+        /**
+        \brief Loads the specified container file. The file is mapped into memory via Blob::CreateFromMappedFile.
+        \param[in] filename Specifies the filename of the DDS or KTX2 file.
+        \param[in] report Optional pointer to a report that receives the error message if the file could not be loaded.
+        \return True on success. Otherwise, the previously loaded content is cleared.
+        */
+        bool LoadFromFile(const char* filename, Report* report = nullptr);
+
+        /**
+        \brief Loads a container from the specified blob. The blob is moved into this container and must hold the entire content of a DDS or KTX2 file.
+        \param[in] blob Specifies the blob with the file content, e.g. from Blob::CreateWeakRef if the memory is owned by the caller.
+        \param[in] report Optional pointer to a report that receives the error message if the blob could not be parsed.
+        \return True on success. Otherwise, the previously loaded content is cleared.
+        */
+        bool LoadFromBlob(Blob&& blob, Report* report = nullptr);
+
+        //! Releases the container content and resets this instance to its default state.
+        void Clear();
+
+        /**
+        \brief Creates a texture with the descriptor of this container and uploads all subresources.
+        \param[in] renderer Specifies the render system to create the texture with.
+        \param[in] bindFlags Specifies the binding flags of the new texture. BindFlags::CopyDst is always added. By default BindFlags::Sampled.
+        \param[in] fence Optional pointer to a fence that is signaled once all uploads have completed. See RenderSystem::WriteTextureAsync.
+        \return Pointer to the new texture or null if nothing has been loaded or the subresources could not be uploaded (see WriteTexture).
+        \remarks If the container format is not listed in RenderingCapabilities::textureFormats of the render system
+        but can be decompressed on the CPU (see DecompressImageBufferToRGBA8UNorm), the texture is created with Format::RGBA8UNorm
+        or Format::RGBA8UNorm_sRGB instead and all subresources are transcoded by WriteTexture.
+        This allows shipping a single set of ETC2/EAC or BC compressed assets for all devices at the cost of memory on devices without native support.
+        ASTC and BC6H are not transcoded, i.e. ASTC and BC6H containers always require native support.
+        */
+        Texture* CreateTexture(RenderSystem& renderer, long bindFlags = BindFlags::Sampled, Fence* fence = nullptr) const;
+
+        /**
+        \brief Uploads all subresources of this container into the specified texture with a single call to RenderSystem::WriteTextureAsync.
+        \remarks The texture must have been created with a descriptor that is compatible to GetDesc, i.e. the same format, extent, and at least as many MIP-map levels and array layers.
+        The only exception is the uncompressed fallback format that CreateTexture selects for unsupported compressed formats, in which case the subresources are decompressed on the CPU.
+        \return True on success. False if nothing has been loaded or a subresource could not be decompressed into the fallback format; nothing is uploaded in that case.
+        */
+        bool WriteTexture(RenderSystem& renderer, Texture& texture, Fence* fence = nullptr) const;
+
+    public:
+
+        //! Returns the format of the loaded container or TextureContainerFormat::Undefined if nothing has been loaded.
+        inline TextureContainerFormat GetContainerFormat() const
+        {
+            return containerFormat_;
+        }
+
+        //! Returns the texture descriptor of the loaded container. MiscFlags::NoInitialData is set, since the data is uploaded separately.
+        inline const TextureDescriptor& GetDesc() const
+        {
+            return desc_;
+        }
+
+        //! Returns the subresources of the loaded container. Their image views remain valid for the lifetime of this container.
+        inline const std::vector<TextureContainerSubresource>& GetSubresources() const
+        {
+            return subresources_;
+        }
+
+    private:
+
+        bool ParseDDS(Report* report);
+        bool ParseKTX2(Report* report);
+
+        // Appends a subresource for the specified MIP-map level and array layers; returns false if it exceeds the container data.
+        bool AppendSubresource(std::uint64_t offset, std::uint32_t mipLevel, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers, std::uint64_t& outSize);
+
+    private:
+
+        Blob                                        blob_;
+        TextureContainerFormat                      containerFormat_    = TextureContainerFormat::Undefined;
+        TextureDescriptor                           desc_;
+        std::vector<TextureContainerSubresource>    subresources_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -21,6 +21,7 @@ set INPUT=^
     %INCLUDE%\Key.h ^
     %INCLUDE%\PipelineLayoutFlags.h ^
     %INCLUDE%\PipelineStateFlags.h ^
+    %INCLUDE%\PlacementHeapFlags.h ^
     %INCLUDE%\QueryHeapFlags.h ^
     %INCLUDE%\RenderingDebuggerFlags.h ^
     %INCLUDE%\RenderPassFlags.h ^
@@ -50,6 +51,7 @@ set INPUT_FN=^
     %CINCLUDE%\PipelineCache.h ^
     %CINCLUDE%\PipelineLayout.h ^
     %CINCLUDE%\PipelineState.h ^
+    %CINCLUDE%\PlacementHeap.h ^
     %CINCLUDE%\QueryHeap.h ^
     %CINCLUDE%\RenderingDebugger.h ^
     %CINCLUDE%\RenderSystem.h ^
@@ -100,6 +100,7 @@ class LLGLMeta:
         'PipelineCache',
         'PipelineLayout',
         'PipelineState',
+        'PlacementHeap',
         'QueryHeap',
         'RenderPass',
         'RenderTarget',
@@ -151,6 +152,15 @@ class LLGLMeta:
     funcPrefix = 'llgl'
     typePrefix = 'LLGL'
     delegatePrefix = 'LLGL_PFN_'
+    delegates = set() # Names of function pointer types that have been declared in the C++ headers
+
+    # Returns the C typename for the specified delegate, e.g. 'AllocateCallback' -> 'LLGL_PFN_AllocateCallback'
+    def toDelegateTypename(name):
+        return name if name.startswith(LLGLMeta.delegatePrefix) else LLGLMeta.delegatePrefix + name
+
+    # Returns the delegate name without prefix, e.g. 'LLGL_PFN_ReportCallback' -> 'ReportCallback'
+    def toDelegateBasename(name):
+        return name[len(LLGLMeta.delegatePrefix):] if name.startswith(LLGLMeta.delegatePrefix) else name
 
 class LLGLMacros:
     def translateArraySize(ident):
@@ -165,6 +175,7 @@ class LLGLType:
     arraySize = 0 # 0 for non-array, -1 for dynamic array, anything else for fixed size array
     isConst = False
     isPointer = False
+    isPointerToPointer = False # Only used for function parameters such as 'const void** initialData'
     externalCond = None # Conditional expression string for external typenames (see LLGLMeta.externals)
 
     DYNAMIC_ARRAY = -1
@@ -175,6 +186,7 @@ class LLGLType:
         self.arraySize = 0
         self.isConst = isConst
         self.isPointer = isPointer
+        self.isPointerToPointer = False
         self.externalCond = next((external.cond for external in LLGLMeta.externals if external.name == typename), None)
 
     def setArraySize(self, arraySize):
@@ -191,13 +203,15 @@ class LLGLType:
             s += '[]'
         if self.isPointer:
             s += '*'
+        if self.isPointerToPointer:
+            s += '*'
         if self.isConst:
             s += '+'
         return s
 
     def toBaseType(typename):
         if typename != '':
-            if typename.startswith('LLGL_PFN_'):
+            if typename.startswith(LLGLMeta.delegatePrefix) or typename in LLGLMeta.delegates:
                 return StdType.FUNC
             else:
                 builtin = LLGLMeta.builtins.get(typename)
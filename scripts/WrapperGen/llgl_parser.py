@@ -287,7 +287,10 @@ class Parser:
                 return outType
             else:
                 isPointer = self.scanner.acceptIfAny(['*', '&'])
-                return LLGLType(typename, isConst, isPointer)
+                outType = LLGLType(typename, isConst, isPointer)
+                if isPointer and self.scanner.acceptIf('*'):
+                    outType.isPointerToPointer = True
+                return outType
 
     def parseStructMembers(self, structName):
         members = []
@@ -429,6 +432,7 @@ class Parser:
         self.scanner.acceptOrFail(')')
 
         delegate = LLGLFunction(name, returnType)
+        LLGLMeta.delegates.add(name)
 
         # Parse parameter list
         delegate.params = self.parseParameterList()
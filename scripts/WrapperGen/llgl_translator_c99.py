@@ -200,6 +200,8 @@ class C99Translator(Translator):
                     typeStr += 'const char*'
                 elif fieldType.baseType == StdType.STRUCT and fieldType.typename in LLGLMeta.interfaces:
                     typeStr += 'LLGL' + fieldType.typename
+                elif fieldType.baseType == StdType.FUNC:
+                    typeStr += LLGLMeta.toDelegateTypename(fieldType.typename)
                 else:
                     if fieldType.isConst:
                         typeStr += 'const '
@@ -236,6 +238,19 @@ class C99Translator(Translator):
                         return re.sub(r'(\w+::)', r'LLGL\1', init).replace('::', '').replace('|', ' | ').replace('Flags', '')
                 return None
 
+            # Write all function pointer types before the structures that refer to them
+            if len(doc.delegates) > 0:
+                self.statement('/* ----- Delegates ----- */')
+                self.statement()
+
+                for delegate in doc.delegates:
+                    returnTypeStr = translateStructField(delegate.returnType, '')[0]
+                    paramListStr = ', '.join(' '.join(translateStructField(param.type, param.name)) for param in delegate.params)
+                    self.statement(f'typedef {returnTypeStr} (*{LLGLMeta.toDelegateTypename(delegate.name)})({paramListStr});')
+
+                self.statement()
+                self.statement()
+
             self.statement('/* ----- Structures ----- */')
             self.statement()
 
@@ -49,16 +49,20 @@ class CsharpTranslator(Translator):
         ]
         saveStructs = {
             'BindingSlot': CsharpProperties(fullCtor = True),
+            'CommandRecord': CsharpProperties(fullCtor = True),
             'DrawIndexedIndirectArguments': None,
             'DrawIndirectArguments': None,
             'DrawPatchIndirectArguments': None,
+            'DrawRecord': CsharpProperties(fullCtor = True),
             'Extent2D': CsharpProperties(fullCtor = True),
             'Extent3D': CsharpProperties(fullCtor = True),
             'FormatAttributes': None,
+            'IndirectArgumentDescriptor': CsharpProperties(fullCtor = True),
             'Offset2D': CsharpProperties(fullCtor = True),
             'Offset3D': CsharpProperties(fullCtor = True),
             'QueryPipelineStatistics': None,
             'Scissor': CsharpProperties(fullCtor = True),
+            'SpecializationConstant': CsharpProperties(fullCtor = True),
             'SubresourceFootprint': None,
             'TextureLocation': None,
             'TextureRegion': None,
@@ -87,8 +91,12 @@ class CsharpTranslator(Translator):
             'FrameProfile': CsharpProperties(setter = True),
             'GraphicsPipelineDescriptor': CsharpProperties(getter = True),
             'PipelineLayoutDescriptor': CsharpProperties(getter = True),
+            'ProfileBackendRecord': CsharpProperties(setter = True),
             'ProfileCommandBufferRecord': CsharpProperties(setter = True),
             'ProfileCommandQueueRecord': CsharpProperties(setter = True),
+            'ProfileEventRecord': CsharpProperties(getter = True, setter = True),
+            'ProfileScopeRecord': CsharpProperties(getter = True, setter = True),
+            'ProfileStatisticsRecord': CsharpProperties(getter = True, setter = True),
             'ProfileTimeRecord': CsharpProperties(getter = True, setter = True),
             'QueryHeapDescriptor': CsharpProperties(getter = True),
             'RasterizerDescriptor': CsharpProperties(getter = True),
@@ -163,6 +171,8 @@ class CsharpTranslator(Translator):
 
             if fieldType.baseType == StdType.STRUCT and fieldType.typename in LLGLMeta.interfaces:
                 decl.type = sanitizedTypename
+                if isInsideStruct and fieldType.arraySize == LLGLType.DYNAMIC_ARRAY:
+                    decl.type += '*' # Arrays of interfaces are pointers to their blittable handles
             elif fieldType.baseType == StdType.STRUCT and fieldType.typename in LLGLMeta.handles:
                 decl.type = 'IntPtr' # Translate any handle to generic pointer type
             else:
@@ -201,6 +211,8 @@ class CsharpTranslator(Translator):
                             decl.marshal = 'MarshalAs(UnmanagedType.LPWStr)'
                         else:
                             decl.type += '*'
+                        if fieldType.isPointerToPointer:
+                            decl.type += '*'
 
                 if fieldType.baseType == StdType.BOOL and not (fieldType.isPointer or fieldType.arraySize > 0):
                     decl.marshal = 'MarshalAs(UnmanagedType.I1)'
@@ -826,7 +838,7 @@ class CsharpTranslator(Translator):
                 if returnType.marshal and returnType.marshal != 'ref':
                     self.statement(f'[return: {returnType.marshal}]')
 
-                delegateName = delegate.name[len(LLGLMeta.delegatePrefix):]
+                delegateName = LLGLMeta.toDelegateBasename(delegate.name)
                 self.statement(f'public unsafe delegate {returnType.type} {delegateName}Delegate({translateParamList(delegate)});');
                 self.statement()
 
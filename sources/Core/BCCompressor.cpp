@@ -0,0 +1,557 @@
+/*
+ * BCCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "BCCompressor.h"
+#include "BlockCompressor.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal functions ----- */
+
+static void WriteUInt16LE(std::uint8_t* dst, std::uint16_t value)
+{
+    dst[0] = static_cast<std::uint8_t>(value     );
+    dst[1] = static_cast<std::uint8_t>(value >> 8);
+}
+
+static void WriteUInt32LE(std::uint8_t* dst, std::uint32_t value)
+{
+    for_range(i, 4)
+        dst[i] = static_cast<std::uint8_t>(value >> (i * 8));
+}
+
+static int Square(int x)
+{
+    return x * x;
+}
+
+/* ----- BC1 color block ----- */
+
+// Expands the 5:6:5 RGB color to 8 bits per component in the same way as the decompressor.
+static void ExpandColor565(std::uint16_t color, int (&rgb)[3])
+{
+    const int r = (color >> 11) & 0x1F;
+    const int g = (color >>  5) & 0x3F;
+    const int b = (color      ) & 0x1F;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+static int QuantizeComponent(float value, int maxValue)
+{
+    const int quantized = static_cast<int>(std::floor(value * static_cast<float>(maxValue) / 255.0f + 0.5f));
+    return std::max(0, std::min(quantized, maxValue));
+}
+
+static std::uint16_t QuantizeColor565(const float (&rgb)[3])
+{
+    return static_cast<std::uint16_t>
+    (
+        (QuantizeComponent(rgb[0], 31) << 11) |
+        (QuantizeComponent(rgb[1], 63) <<  5) |
+        (QuantizeComponent(rgb[2], 31)      )
+    );
+}
+
+/*
+Returns the 2-bit indices for the specified endpoints and stores the squared error in 'outError'.
+The palette matches the decompressor: The 3-color mode is used if 'allowThreeColorMode' is true and color0 <= color1.
+*/
+static std::uint32_t FindColorIndices(
+    const std::uint8_t* texels,
+    std::uint16_t       color0,
+    std::uint16_t       color1,
+    bool                allowThreeColorMode,
+    std::uint32_t       transparentMask,
+    int&                outError)
+{
+    int palette[4][3];
+    ExpandColor565(color0, palette[0]);
+    ExpandColor565(color1, palette[1]);
+
+    const bool isThreeColorMode = (allowThreeColorMode && color0 <= color1);
+    if (isThreeColorMode)
+    {
+        for_range(c, 3)
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+    }
+    else
+    {
+        for_range(c, 3)
+        {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+        }
+    }
+
+    const int numColors = (isThreeColorMode ? 3 : 4);
+
+    std::uint32_t indices = 0;
+    outError = 0;
+
+    for_range(i, 16u)
+    {
+        if ((transparentMask & (1u << i)) != 0)
+        {
+            /* Index 3 of the 3-color mode denotes transparent black */
+            indices |= (0x3u << (i * 2));
+            continue;
+        }
+
+        const std::uint8_t* texel = texels + i * 4;
+        int bestIndex = 0, bestError = INT32_MAX;
+
+        for_range(j, numColors)
+        {
+            const int error = Square(texel[0] - palette[j][0]) + Square(texel[1] - palette[j][1]) + Square(texel[2] - palette[j][2]);
+            if (error < bestError)
+            {
+                bestIndex = j;
+                bestError = error;
+            }
+        }
+
+        indices |= (static_cast<std::uint32_t>(bestIndex) << (i * 2));
+        outError += bestError;
+    }
+
+    return indices;
+}
+
+// Finds the endpoints along the principal axis of the specified colors, or along the diagonal of the bounding box for fast quality.
+static void FindColorEndpoints(
+    const std::uint8_t*     texels,
+    std::uint32_t           opaqueMask,
+    ImageCompressionQuality quality,
+    float                   (&outMax)[3],
+    float                   (&outMin)[3])
+{
+    float minColor[3] = { 255.0f, 255.0f, 255.0f };
+    float maxColor[3] = {   0.0f,   0.0f,   0.0f };
+    float mean[3]     = {   0.0f,   0.0f,   0.0f };
+    int   numTexels   = 0;
+
+    for_range(i, 16u)
+    {
+        if ((opaqueMask & (1u << i)) == 0)
+            continue;
+        for_range(c, 3)
+        {
+            const float value = static_cast<float>(texels[i * 4 + c]);
+            minColor[c] = std::min(minColor[c], value);
+            maxColor[c] = std::max(maxColor[c], value);
+            mean[c] += value;
+        }
+        ++numTexels;
+    }
+
+    for_range(c, 3)
+        mean[c] /= static_cast<float>(numTexels);
+
+    if (quality == ImageCompressionQuality::Fast)
+    {
+        /* Use the diagonal of the bounding box that matches the correlation of each component with the component of the largest extent */
+        int refComponent = 0;
+        for_range(c, 3)
+        {
+            if (maxColor[c] - minColor[c] > maxColor[refComponent] - minColor[refComponent])
+                refComponent = static_cast<int>(c);
+        }
+
+        float correlation[3] = {};
+        for_range(i, 16u)
+        {
+            if ((opaqueMask & (1u << i)) == 0)
+                continue;
+            const float ref = static_cast<float>(texels[i * 4 + refComponent]) - mean[refComponent];
+            for_range(c, 3)
+                correlation[c] += (static_cast<float>(texels[i * 4 + c]) - mean[c]) * ref;
+        }
+
+        /* Inset the bounding box by 1/16 of its extent to reduce the error of the interpolated colors */
+        for_range(c, 3)
+        {
+            const float inset = (maxColor[c] - minColor[c]) / 16.0f;
+            outMax[c] = maxColor[c] - inset;
+            outMin[c] = minColor[c] + inset;
+            if (correlation[c] < 0.0f)
+                std::swap(outMax[c], outMin[c]);
+        }
+        return;
+    }
+
+    /* Build covariance matrix of the colors */
+    float cov[6] = {};
+    for_range(i, 16u)
+    {
+        if ((opaqueMask & (1u << i)) == 0)
+            continue;
+        const float r = static_cast<float>(texels[i * 4 + 0]) - mean[0];
+        const float g = static_cast<float>(texels[i * 4 + 1]) - mean[1];
+        const float b = static_cast<float>(texels[i * 4 + 2]) - mean[2];
+        cov[0] += r*r;
+        cov[1] += r*g;
+        cov[2] += r*b;
+        cov[3] += g*g;
+        cov[4] += g*b;
+        cov[5] += b*b;
+    }
+
+    /* Find principal axis with power iteration, starting with the diagonal of the bounding box */
+    float axis[3] = { maxColor[0] - minColor[0], maxColor[1] - minColor[1], maxColor[2] - minColor[2] };
+    for_range(iteration, 4)
+    {
+        const float x = axis[0] * cov[0] + axis[1] * cov[1] + axis[2] * cov[2];
+        const float y = axis[0] * cov[1] + axis[1] * cov[3] + axis[2] * cov[4];
+        const float z = axis[0] * cov[2] + axis[1] * cov[4] + axis[2] * cov[5];
+        const float len = std::max(std::abs(x), std::max(std::abs(y), std::abs(z)));
+        if (len < 1.0e-6f)
+            break;
+        axis[0] = x / len;
+        axis[1] = y / len;
+        axis[2] = z / len;
+    }
+
+    const float axisLenSq = axis[0]*axis[0] + axis[1]*axis[1] + axis[2]*axis[2];
+    if (axisLenSq < 1.0e-6f)
+    {
+        /* All colors are equal */
+        for_range(c, 3)
+            outMax[c] = outMin[c] = mean[c];
+        return;
+    }
+
+    /* Project colors onto principal axis to find the endpoints */
+    float minProj = 0.0f, maxProj = 0.0f;
+    for_range(i, 16u)
+    {
+        if ((opaqueMask & (1u << i)) == 0)
+            continue;
+        float proj = 0.0f;
+        for_range(c, 3)
+            proj += (static_cast<float>(texels[i * 4 + c]) - mean[c]) * axis[c];
+        minProj = std::min(minProj, proj);
+        maxProj = std::max(maxProj, proj);
+    }
+
+    for_range(c, 3)
+    {
+        outMax[c] = mean[c] + axis[c] * maxProj / axisLenSq;
+        outMin[c] = mean[c] + axis[c] * minProj / axisLenSq;
+    }
+}
+
+/*
+Re-fits the endpoints to the specified indices with least squares, i.e. minimizes the sum of |w*A + (1-w)*B - x|^2,
+where w is the weight of endpoint A for each index. Returns false if the system of equations is singular.
+*/
+static bool RefineColorEndpoints(
+    const std::uint8_t* texels,
+    std::uint32_t       indices,
+    std::uint32_t       transparentMask,
+    bool                isThreeColorMode,
+    float               (&outA)[3],
+    float               (&outB)[3])
+{
+    static const float weights4[4] = { 1.0f, 0.0f, 2.0f/3.0f, 1.0f/3.0f };
+    static const float weights3[4] = { 1.0f, 0.0f, 0.5f, 0.0f };
+
+    const float* weights = (isThreeColorMode ? weights3 : weights4);
+
+    float alpha2 = 0.0f, beta2 = 0.0f, alphaBeta = 0.0f;
+    float alphaX[3] = {}, betaX[3] = {};
+
+    for_range(i, 16u)
+    {
+        if ((transparentMask & (1u << i)) != 0)
+            continue;
+        const float alpha   = weights[(indices >> (i * 2)) & 0x3];
+        const float beta    = 1.0f - alpha;
+        alpha2      += alpha * alpha;
+        beta2       += beta * beta;
+        alphaBeta   += alpha * beta;
+        for_range(c, 3)
+        {
+            const float value = static_cast<float>(texels[i * 4 + c]);
+            alphaX[c]   += alpha * value;
+            betaX[c]    += beta * value;
+        }
+    }
+
+    const float det = alpha2 * beta2 - alphaBeta * alphaBeta;
+    if (std::abs(det) < 1.0e-6f)
+        return false;
+
+    for_range(c, 3)
+    {
+        outA[c] = (alphaX[c] * beta2  - betaX[c]  * alphaBeta) / det;
+        outB[c] = (betaX[c]  * alpha2 - alphaX[c] * alphaBeta) / det;
+    }
+
+    return true;
+}
+
+// Orders the endpoints for the intended mode: color0 <= color1 selects the 3-color mode of BC1.
+static void OrderColorEndpoints(std::uint16_t& color0, std::uint16_t& color1, bool hasTransparency)
+{
+    if (hasTransparency ? (color0 > color1) : (color0 < color1))
+        std::swap(color0, color1);
+}
+
+static void EncodeColorBlock(const std::uint8_t* texels, std::uint8_t* block, ImageCompressionQuality quality, bool allowThreeColorMode)
+{
+    /* Determine which texels are transparent; this is only supported by BC1 */
+    std::uint32_t transparentMask = 0;
+    if (allowThreeColorMode)
+    {
+        for_range(i, 16u)
+        {
+            if (texels[i * 4 + 3] < 128)
+                transparentMask |= (1u << i);
+        }
+    }
+
+    if (transparentMask == 0xFFFF)
+    {
+        /* Encode fully transparent block with equal endpoints and only index 3 */
+        WriteUInt16LE(block,     0);
+        WriteUInt16LE(block + 2, 0);
+        WriteUInt32LE(block + 4, 0xFFFFFFFFu);
+        return;
+    }
+
+    const bool hasTransparency = (transparentMask != 0);
+
+    float maxColor[3], minColor[3];
+    FindColorEndpoints(texels, ~transparentMask & 0xFFFF, quality, maxColor, minColor);
+
+    std::uint16_t color0 = QuantizeColor565(maxColor);
+    std::uint16_t color1 = QuantizeColor565(minColor);
+    OrderColorEndpoints(color0, color1, hasTransparency);
+
+    int error = 0;
+    std::uint32_t indices = FindColorIndices(texels, color0, color1, allowThreeColorMode, transparentMask, error);
+
+    if (quality == ImageCompressionQuality::High)
+    {
+        /* Iteratively re-fit endpoints to the selected indices and keep them as long as the error decreases */
+        for_range(iteration, 2)
+        {
+            if (error == 0)
+                break;
+
+            const bool isThreeColorMode = (allowThreeColorMode && color0 <= color1);
+
+            float refinedA[3], refinedB[3];
+            if (!RefineColorEndpoints(texels, indices, transparentMask, isThreeColorMode, refinedA, refinedB))
+                break;
+
+            std::uint16_t refinedColor0 = QuantizeColor565(refinedA);
+            std::uint16_t refinedColor1 = QuantizeColor565(refinedB);
+            OrderColorEndpoints(refinedColor0, refinedColor1, hasTransparency);
+
+            int refinedError = 0;
+            const std::uint32_t refinedIndices = FindColorIndices(texels, refinedColor0, refinedColor1, allowThreeColorMode, transparentMask, refinedError);
+            if (refinedError >= error)
+                break;
+
+            color0  = refinedColor0;
+            color1  = refinedColor1;
+            indices = refinedIndices;
+            error   = refinedError;
+        }
+    }
+
+    WriteUInt16LE(block,     color0);
+    WriteUInt16LE(block + 2, color1);
+    WriteUInt32LE(block + 4, indices);
+}
+
+/* ----- BC4 single channel block ----- */
+
+// Builds the palette of a BC4 block with unsigned values in the same way as the decompressor.
+static void BuildBC4Palette(int value0, int value1, int (&palette)[8])
+{
+    palette[0] = value0;
+    palette[1] = value1;
+    if (value0 > value1)
+    {
+        for_range(i, 6)
+            palette[2 + i] = ((6 - i) * value0 + (1 + i) * value1 + 3) / 7;
+    }
+    else
+    {
+        for_range(i, 4)
+            palette[2 + i] = ((4 - i) * value0 + (1 + i) * value1 + 2) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+// Returns the 48 bits of 3-bit indices for the specified endpoints and stores the squared error in 'outError'.
+static std::uint64_t FindBC4Indices(const std::uint8_t* texels, int component, int value0, int value1, int& outError)
+{
+    int palette[8];
+    BuildBC4Palette(value0, value1, palette);
+
+    std::uint64_t indices = 0;
+    outError = 0;
+
+    for_range(i, 16u)
+    {
+        const int value = texels[i * 4 + component];
+        int bestIndex = 0, bestError = INT32_MAX;
+
+        for_range(j, 8)
+        {
+            const int error = Square(value - palette[j]);
+            if (error < bestError)
+            {
+                bestIndex = j;
+                bestError = error;
+            }
+        }
+
+        indices |= (static_cast<std::uint64_t>(bestIndex) << (i * 3));
+        outError += bestError;
+    }
+
+    return indices;
+}
+
+static void WriteBC4Block(std::uint8_t* block, int value0, int value1, std::uint64_t indices)
+{
+    block[0] = static_cast<std::uint8_t>(value0);
+    block[1] = static_cast<std::uint8_t>(value1);
+    for_range(i, 6)
+        block[2 + i] = static_cast<std::uint8_t>(indices >> (i * 8));
+}
+
+static void EncodeBC4Block(const std::uint8_t* texels, std::uint8_t* block, int component, ImageCompressionQuality quality)
+{
+    int minValue = 255, maxValue = 0;
+    int minInnerValue = 255, maxInnerValue = 0;
+
+    for_range(i, 16u)
+    {
+        const int value = texels[i * 4 + component];
+        minValue = std::min(minValue, value);
+        maxValue = std::max(maxValue, value);
+        if (value > 0 && value < 255)
+        {
+            minInnerValue = std::min(minInnerValue, value);
+            maxInnerValue = std::max(maxInnerValue, value);
+        }
+    }
+
+    /* Use 8-value mode (value0 > value1) by default; if all values are equal, the 6-value mode contains that value as well */
+    int error = 0;
+    std::uint64_t indices = FindBC4Indices(texels, component, maxValue, minValue, error);
+    int value0 = maxValue, value1 = minValue;
+
+    if (quality == ImageCompressionQuality::High && error > 0 && minInnerValue <= maxInnerValue)
+    {
+        /* Try 6-value mode (value0 <= value1), which represents 0 and 255 exactly and interpolates only the inner range */
+        int innerError = 0;
+        const std::uint64_t innerIndices = FindBC4Indices(texels, component, minInnerValue, maxInnerValue, innerError);
+        if (innerError < error)
+        {
+            value0  = minInnerValue;
+            value1  = maxInnerValue;
+            indices = innerIndices;
+        }
+    }
+
+    WriteBC4Block(block, value0, value1, indices);
+}
+
+/* ----- Block encode functions ----- */
+
+static void EncodeBC1Block(const std::uint8_t* texels, std::uint8_t* block, ImageCompressionQuality quality)
+{
+    EncodeColorBlock(texels, block, quality, true);
+}
+
+static void EncodeBC3Block(const std::uint8_t* texels, std::uint8_t* block, ImageCompressionQuality quality)
+{
+    EncodeBC4Block(texels, block, 3, quality);
+    EncodeColorBlock(texels, block + 8, quality, false);
+}
+
+static void EncodeBC4BlockRed(const std::uint8_t* texels, std::uint8_t* block, ImageCompressionQuality quality)
+{
+    EncodeBC4Block(texels, block, 0, quality);
+}
+
+static void EncodeBC5Block(const std::uint8_t* texels, std::uint8_t* block, ImageCompressionQuality quality)
+{
+    EncodeBC4Block(texels, block,     0, quality);
+    EncodeBC4Block(texels, block + 8, 1, quality);
+}
+
+
+/* ----- Functions ----- */
+
+DynamicByteArray CompressRGBA8UNormToBC1(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressBlocksFromRGBA8UNorm(extent, data, dataSize, rowStride, 8, EncodeBC1Block, quality, threadCount);
+}
+
+DynamicByteArray CompressRGBA8UNormToBC3(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressBlocksFromRGBA8UNorm(extent, data, dataSize, rowStride, 16, EncodeBC3Block, quality, threadCount);
+}
+
+DynamicByteArray CompressRGBA8UNormToBC4(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressBlocksFromRGBA8UNorm(extent, data, dataSize, rowStride, 8, EncodeBC4BlockRed, quality, threadCount);
+}
+
+DynamicByteArray CompressRGBA8UNormToBC5(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressBlocksFromRGBA8UNorm(extent, data, dataSize, rowStride, 16, EncodeBC5Block, quality, threadCount);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,76 @@
+/*
+ * BCCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BC_COMPRESSOR_H
+#define LLGL_BC_COMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Returns a buffer of BC1 encoded blocks for the specified image in the Format::RGBA8UNorm format, or null on failure.
+Texels with an alpha value less than 128 are encoded as transparent black with the 3-color mode.
+If 'rowStride' is zero, the image rows are tightly packed. Width and height do not have to be a multiple of 4.
+*/
+DynamicByteArray CompressRGBA8UNormToBC1(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+// Same as CompressRGBA8UNormToBC1 but for BC3 encoded blocks with interpolated alpha channel.
+DynamicByteArray CompressRGBA8UNormToBC3(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+// Same as CompressRGBA8UNormToBC1 but for BC4 encoded blocks of the red channel.
+DynamicByteArray CompressRGBA8UNormToBC4(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+// Same as CompressRGBA8UNormToBC1 but for BC5 encoded blocks of the red and green channels.
+DynamicByteArray CompressRGBA8UNormToBC5(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
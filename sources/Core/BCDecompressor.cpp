@@ -6,8 +6,10 @@
  */
 
 #include "BCDecompressor.h"
+#include "BlockDecompressor.h"
 #include <LLGL/Types.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <cstring>
 
 
@@ -15,108 +17,537 @@ namespace LLGL
 {
 
 
-static void DecompressRGBColor16Bit(std::uint8_t* dst, std::uint16_t src)
+/* ----- Internal functions ----- */
+
+static std::uint16_t ReadUInt16LE(const std::uint8_t* src)
+{
+    return static_cast<std::uint16_t>(src[0] | (src[1] << 8));
+}
+
+static std::uint32_t ReadUInt32LE(const std::uint8_t* src)
 {
-    dst[0] = ((src >> 12) & 0x000F) * 0xFF / 0x0F;
-    dst[1] = ((src >>  6) & 0x001F) * 0xFF / 0x1F;
-    dst[2] = ((src >>  1) & 0x000F) * 0xFF / 0x0F;
+    return
+    (
+        (static_cast<std::uint32_t>(src[0])      ) |
+        (static_cast<std::uint32_t>(src[1]) <<  8) |
+        (static_cast<std::uint32_t>(src[2]) << 16) |
+        (static_cast<std::uint32_t>(src[3]) << 24)
+    );
 }
 
-#if 0 //UNUSED
-static void DecompressRGBAColor16Bit(std::uint8_t* dst, std::uint16_t src)
+// Reads the 48-bit index table of a BC4 block, i.e. sixteen 3-bit indices.
+static std::uint64_t ReadUInt48LE(const std::uint8_t* src)
 {
-    DecompressRGBColor16Bit(dst, src);
-    dst[3] = (src & 0x0001) * 0xFF;
+    return
+    (
+        (static_cast<std::uint64_t>(ReadUInt16LE(src))) |
+        (static_cast<std::uint64_t>(ReadUInt32LE(src + 2)) << 16)
+    );
 }
 
-static std::uint8_t DecompressAlphaChannel4Bit(std::uint32_t& src)
+// Expands the 5:6:5 RGB color to 8 bits per component by replicating the most significant bits.
+static void DecompressRGBColor16Bit(std::uint8_t* dst, std::uint16_t src)
 {
-    auto alpha = static_cast<std::uint8_t >((src & 0x0000000F) * 0xFF / 0x0F);
-    src >>= 4;
-    return alpha;
+    const std::uint32_t r = (src >> 11) & 0x1F;
+    const std::uint32_t g = (src >>  5) & 0x3F;
+    const std::uint32_t b = (src      ) & 0x1F;
+    dst[0] = static_cast<std::uint8_t>((r << 3) | (r >> 2));
+    dst[1] = static_cast<std::uint8_t>((g << 2) | (g >> 4));
+    dst[2] = static_cast<std::uint8_t>((b << 3) | (b >> 2));
+    dst[3] = 0xFF;
 }
 
-static void Decompress16AlphaChannels4Bit(std::uint8_t* dst, std::uint32_t src0, std::uint32_t src1)
+// Decodes the color block that is shared between BC1, BC2, and BC3. Only BC1 supports the 3-color mode with transparent black.
+static void DecodeColorBlock(const std::uint8_t* src, std::uint8_t* dst, bool allowThreeColorMode)
 {
-    for (int i = 0; i < 8; ++i)
+    const std::uint16_t color0 = ReadUInt16LE(src);
+    const std::uint16_t color1 = ReadUInt16LE(src + 2);
+
+    std::uint8_t palette[4][4];
+    DecompressRGBColor16Bit(palette[0], color0);
+    DecompressRGBColor16Bit(palette[1], color1);
+
+    if (color0 > color1 || !allowThreeColorMode)
     {
-        dst[i    ] = DecompressAlphaChannel4Bit(src0);
-        dst[i + 8] = DecompressAlphaChannel4Bit(src1);
+        /* 4-color mode: Interpolate two more colors at 1/3 and 2/3 */
+        for_range(i, 3)
+        {
+            palette[2][i] = static_cast<std::uint8_t>((2 * palette[0][i] + palette[1][i] + 1) / 3);
+            palette[3][i] = static_cast<std::uint8_t>((palette[0][i] + 2 * palette[1][i] + 1) / 3);
+        }
+        palette[2][3] = 0xFF;
+        palette[3][3] = 0xFF;
     }
+    else
+    {
+        /* 3-color mode: Interpolate one more color at 1/2 and use transparent black for the last one */
+        for_range(i, 3)
+            palette[2][i] = static_cast<std::uint8_t>((palette[0][i] + palette[1][i]) / 2);
+        palette[2][3] = 0xFF;
+        ::memset(palette[3], 0, sizeof(palette[3]));
+    }
+
+    /* Generate 4x4 pixel block from 2-bit palette indices */
+    const std::uint32_t indices = ReadUInt32LE(src + 4);
+    for_range(i, 16u)
+        ::memcpy(dst + i * 4, palette[(indices >> (i * 2)) & 0x3], 4);
 }
-#endif
 
-static std::uint8_t InterpolateColorComponent(std::uint16_t a, std::uint16_t b)
+// Decodes a BC4 block of unsigned values into the specified component of the RGBA8 texels.
+static void DecodeBC4UNormBlock(const std::uint8_t* src, std::uint8_t* dst, int component)
 {
-    if (a > b)
-        return static_cast<std::uint8_t>((2 * a + b + 1) / 3);
+    const std::uint32_t value0 = src[0];
+    const std::uint32_t value1 = src[1];
+
+    std::uint8_t palette[8];
+    palette[0] = static_cast<std::uint8_t>(value0);
+    palette[1] = static_cast<std::uint8_t>(value1);
+
+    if (value0 > value1)
+    {
+        /* 8-value mode: Interpolate six values */
+        for_range(i, 6u)
+            palette[2 + i] = static_cast<std::uint8_t>(((6 - i) * value0 + (1 + i) * value1 + 3) / 7);
+    }
     else
-        return static_cast<std::uint8_t>((a + b) / 2);
+    {
+        /* 6-value mode: Interpolate four values and append the limits 0 and 255 */
+        for_range(i, 4u)
+            palette[2 + i] = static_cast<std::uint8_t>(((4 - i) * value0 + (1 + i) * value1 + 2) / 5);
+        palette[6] = 0x00;
+        palette[7] = 0xFF;
+    }
+
+    /* Generate 4x4 pixel block from 3-bit palette indices */
+    const std::uint64_t indices = ReadUInt48LE(src + 2);
+    for_range(i, 16u)
+        dst[i * 4 + component] = palette[(indices >> (i * 3)) & 0x7];
 }
 
-static void InterpolateColor(std::uint8_t* dst, const std::uint8_t* src0, const std::uint8_t* src1)
+// Maps a signed normalized value in the range [-127, 127] to an unsigned normalized value in the range [0, 255].
+static std::uint8_t SNormToUNorm8(int value)
 {
-    dst[0] = InterpolateColorComponent(src0[0], src1[0]);
-    dst[1] = InterpolateColorComponent(src0[1], src1[1]);
-    dst[2] = InterpolateColorComponent(src0[2], src1[2]);
+    return static_cast<std::uint8_t>(((value + 127) * 255 + 127) / 254);
 }
 
-DynamicByteArray DecompressBC1ToRGBA8UNorm(
-    const Extent2D& extent,
-    const char*     data,
-    std::size_t     dataSize,
-    unsigned        /*threadCount*/)
+// Decodes a BC4 block of signed values into the specified component of the RGBA8 texels. The range [-1, 1] is remapped to [0, 1].
+static void DecodeBC4SNormBlock(const std::uint8_t* src, std::uint8_t* dst, int component)
+{
+    /* Both -128 and -127 represent -1 */
+    const int value0 = std::max<int>(-127, static_cast<std::int8_t>(src[0]));
+    const int value1 = std::max<int>(-127, static_cast<std::int8_t>(src[1]));
+
+    std::uint8_t palette[8];
+    palette[0] = SNormToUNorm8(value0);
+    palette[1] = SNormToUNorm8(value1);
+
+    if (value0 > value1)
+    {
+        /* 8-value mode: Interpolate six values; the offset rounds to nearest for both signs */
+        for_range(i, 6)
+        {
+            const int sum = (6 - i) * value0 + (1 + i) * value1;
+            palette[2 + i] = SNormToUNorm8((sum + (sum < 0 ? -3 : 3)) / 7);
+        }
+    }
+    else
+    {
+        /* 6-value mode: Interpolate four values and append the limits -1 and 1 */
+        for_range(i, 4)
+        {
+            const int sum = (4 - i) * value0 + (1 + i) * value1;
+            palette[2 + i] = SNormToUNorm8((sum + (sum < 0 ? -2 : 2)) / 5);
+        }
+        palette[6] = 0x00;
+        palette[7] = 0xFF;
+    }
+
+    /* Generate 4x4 pixel block from 3-bit palette indices */
+    const std::uint64_t indices = ReadUInt48LE(src + 2);
+    for_range(i, 16u)
+        dst[i * 4 + component] = palette[(indices >> (i * 3)) & 0x7];
+}
+
+// Fills the green and blue components with 0 and alpha with 255 for the single- and dual-channel formats.
+static void ClearBlockComponents(std::uint8_t* dst, int firstComponent)
+{
+    for_range(i, 16u)
+    {
+        for (int c = firstComponent; c < 3; ++c)
+            dst[i * 4 + c] = 0x00;
+        dst[i * 4 + 3] = 0xFF;
+    }
+}
+
+/* ----- Block decode functions ----- */
+
+static void DecodeBC1Block(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeColorBlock(block, texels, true);
+}
+
+static void DecodeBC2Block(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeColorBlock(block + 8, texels, false);
+
+    /* Replace alpha with the explicit 4-bit values */
+    const std::uint32_t alphaBits[2] = { ReadUInt32LE(block), ReadUInt32LE(block + 4) };
+    for_range(i, 16u)
+        texels[i * 4 + 3] = static_cast<std::uint8_t>(((alphaBits[i / 8] >> ((i % 8) * 4)) & 0xF) * 0x11);
+}
+
+static void DecodeBC3Block(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeColorBlock(block + 8, texels, false);
+    DecodeBC4UNormBlock(block, texels, 3);
+}
+
+static void DecodeBC4UNormBlockRGBA(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeBC4UNormBlock(block, texels, 0);
+    ClearBlockComponents(texels, 1);
+}
+
+static void DecodeBC4SNormBlockRGBA(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeBC4SNormBlock(block, texels, 0);
+    ClearBlockComponents(texels, 1);
+}
+
+static void DecodeBC5UNormBlockRGBA(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeBC4UNormBlock(block, texels, 0);
+    DecodeBC4UNormBlock(block + 8, texels, 1);
+    ClearBlockComponents(texels, 2);
+}
+
+static void DecodeBC5SNormBlockRGBA(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeBC4SNormBlock(block, texels, 0);
+    DecodeBC4SNormBlock(block + 8, texels, 1);
+    ClearBlockComponents(texels, 2);
+}
+
+/* ----- BC7 ----- */
+
+// Decoding parameters of each of the eight BC7 modes.
+struct BC7ModeInfo
+{
+    std::uint8_t numSubsets;
+    std::uint8_t partitionBits;
+    std::uint8_t rotationBits;
+    std::uint8_t indexSelectionBits;
+    std::uint8_t colorBits;
+    std::uint8_t alphaBits;
+    std::uint8_t endpointPBits;
+    std::uint8_t sharedPBits;
+    std::uint8_t indexBits;
+    std::uint8_t index2Bits;
+};
+
+static const BC7ModeInfo g_bc7Modes[8] =
+{
+    { 3, 4, 0, 0, 4, 0, 1, 0, 3, 0 },
+    { 2, 6, 0, 0, 6, 0, 0, 1, 3, 0 },
+    { 3, 6, 0, 0, 5, 0, 0, 0, 2, 0 },
+    { 2, 6, 0, 0, 7, 0, 1, 0, 2, 0 },
+    { 1, 0, 2, 1, 5, 6, 0, 0, 2, 3 },
+    { 1, 0, 2, 0, 7, 8, 0, 0, 2, 2 },
+    { 1, 0, 0, 0, 7, 7, 1, 0, 4, 0 },
+    { 2, 6, 0, 0, 5, 5, 1, 0, 2, 0 },
+};
+
+// Partition table for two subsets; bit i specifies the subset of texel i.
+static const std::uint16_t g_bc7Partitions2[64] =
+{
+    0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+    0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+    0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+    0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+    0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+    0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+    0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+    0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22,
+};
+
+// Partition table for three subsets; bits [2*i, 2*i+1] specify the subset of texel i.
+static const std::uint32_t g_bc7Partitions3[64] =
+{
+    0xAA685050, 0x6A5A5040, 0x5A5A4200, 0x5450A0A8, 0xA5A50000, 0xA0A05050, 0x5555A0A0, 0x5A5A5050,
+    0xAA550000, 0xAA555500, 0xAAAA5500, 0x90909090, 0x94949494, 0xA4A4A4A4, 0xA9A59450, 0x2A0A4250,
+    0xA5945040, 0x0A425054, 0xA5A5A500, 0x55A0A0A0, 0xA8A85454, 0x6A6A4040, 0xA4A45000, 0x1A1A0500,
+    0x0050A4A4, 0xAAA59090, 0x14696914, 0x69691400, 0xA08585A0, 0xAA821414, 0x50A4A450, 0x6A5A0200,
+    0xA9A58000, 0x5090A0A8, 0xA8A09050, 0x24242424, 0x00AA5500, 0x24924924, 0x24499224, 0x50A50A50,
+    0x500AA550, 0xAAAA4444, 0x66660000, 0xA5A0A5A0, 0x50A050A0, 0x69286928, 0x44AAAA44, 0x66666600,
+    0xAA444444, 0x54A854A8, 0x95809580, 0x96969600, 0xA85454A8, 0x80959580, 0xAA141414, 0x96960000,
+    0xAAAA1414, 0xA05050A0, 0xA0A5A5A0, 0x96000000, 0x40804080, 0xA9A8A9A8, 0xAAAAAA44, 0x2A4A5254,
+};
+
+// Anchor texel of the second subset for partitions with two subsets.
+static const std::uint8_t g_bc7AnchorsOf2[64] =
+{
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+     6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15,
+};
+
+// Anchor texel of the second subset for partitions with three subsets.
+static const std::uint8_t g_bc7AnchorsOf3Second[64] =
+{
+     3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+     3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+     8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+     3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3,
+};
+
+// Anchor texel of the third subset for partitions with three subsets.
+static const std::uint8_t g_bc7AnchorsOf3Third[64] =
+{
+    15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+    15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+    15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+    15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8,
+};
+
+static const std::uint8_t g_bc7Weights2[4]  = { 0, 21, 43, 64 };
+static const std::uint8_t g_bc7Weights3[8]  = { 0, 9, 18, 27, 37, 46, 55, 64 };
+static const std::uint8_t g_bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// Reads bit fields of a 128-bit block in LSB-first order.
+struct BlockBitReader
+{
+    const std::uint8_t* data;
+    unsigned            pos;
+
+    std::uint32_t Read(unsigned numBits)
+    {
+        std::uint32_t value = 0;
+        for_range(i, numBits)
+        {
+            value |= static_cast<std::uint32_t>((data[pos >> 3] >> (pos & 7)) & 1) << i;
+            ++pos;
+        }
+        return value;
+    }
+};
+
+static const std::uint8_t* GetBC7Weights(unsigned numIndexBits)
+{
+    switch (numIndexBits)
+    {
+        case 2:     return g_bc7Weights2;
+        case 3:     return g_bc7Weights3;
+        default:    return g_bc7Weights4;
+    }
+}
+
+static std::uint8_t InterpolateBC7(std::uint32_t e0, std::uint32_t e1, std::uint32_t weight)
 {
-    /* Return null on invalid arguments */
-    if (extent.width % 4 != 0 || extent.height % 4 != 0 || data == nullptr || dataSize < extent.width * extent.height / 2)
-        return nullptr;
+    return static_cast<std::uint8_t>(((64 - weight) * e0 + weight * e1 + 32) >> 6);
+}
+
+static void DecodeBC7Block(const std::uint8_t* block, std::uint8_t* texels)
+{
+    /* Mode is determined by the number of leading zero bits; blocks without mode are reserved and decoded as transparent black */
+    unsigned mode = 0;
+    while (mode < 8 && (block[0] & (1u << mode)) == 0)
+        ++mode;
+
+    if (mode == 8)
+    {
+        ::memset(texels, 0, 4*4*4);
+        return;
+    }
+
+    const BC7ModeInfo& info = g_bc7Modes[mode];
+    BlockBitReader reader{ block, mode + 1 };
+
+    const std::uint32_t partition       = reader.Read(info.partitionBits);
+    const std::uint32_t rotation        = reader.Read(info.rotationBits);
+    const std::uint32_t indexSelection  = reader.Read(info.indexSelectionBits);
+
+    /* Read endpoints channel by channel, i.e. all red values first, then green, blue, and alpha */
+    const unsigned numEndpoints = info.numSubsets * 2u;
+    std::uint32_t endpoints[6][4] = {};
+
+    for_range(c, 3u)
+    {
+        for_range(e, numEndpoints)
+            endpoints[e][c] = reader.Read(info.colorBits);
+    }
+    if (info.alphaBits > 0)
+    {
+        for_range(e, numEndpoints)
+            endpoints[e][3] = reader.Read(info.alphaBits);
+    }
+
+    /* Append P-bits, either one per endpoint or one shared by both endpoints of a subset */
+    unsigned colorBits = info.colorBits;
+    unsigned alphaBits = info.alphaBits;
+    const unsigned numChannels = (info.alphaBits > 0 ? 4u : 3u);
+
+    if (info.endpointPBits > 0 || info.sharedPBits > 0)
+    {
+        std::uint32_t pBits[6];
+        if (info.endpointPBits > 0)
+        {
+            for_range(e, numEndpoints)
+                pBits[e] = reader.Read(1);
+        }
+        else
+        {
+            for_range(s, info.numSubsets)
+                pBits[s * 2] = pBits[s * 2 + 1] = reader.Read(1);
+        }
+
+        for_range(e, numEndpoints)
+        {
+            for_range(c, numChannels)
+                endpoints[e][c] = (endpoints[e][c] << 1) | pBits[e];
+        }
+
+        ++colorBits;
+        if (alphaBits > 0)
+            ++alphaBits;
+    }
+
+    /* Expand endpoints to 8 bits by replicating the most significant bits */
+    for_range(e, numEndpoints)
+    {
+        for_range(c, 3u)
+        {
+            endpoints[e][c] <<= (8 - colorBits);
+            endpoints[e][c] |= (endpoints[e][c] >> colorBits);
+        }
+        if (alphaBits > 0)
+        {
+            endpoints[e][3] <<= (8 - alphaBits);
+            endpoints[e][3] |= (endpoints[e][3] >> alphaBits);
+        }
+        else
+            endpoints[e][3] = 0xFF;
+    }
+
+    /* Read primary and secondary index tables; anchor texels have one index bit less */
+    std::uint8_t subsets[16];
+    std::uint8_t indices[16];
+    std::uint8_t indices2[16] = {};
+
+    for_range(i, 16u)
+    {
+        bool isAnchor = (i == 0);
+        if (info.numSubsets == 2)
+        {
+            subsets[i] = static_cast<std::uint8_t>((g_bc7Partitions2[partition] >> i) & 0x1);
+            isAnchor = (isAnchor || i == g_bc7AnchorsOf2[partition]);
+        }
+        else if (info.numSubsets == 3)
+        {
+            subsets[i] = static_cast<std::uint8_t>((g_bc7Partitions3[partition] >> (i * 2)) & 0x3);
+            isAnchor = (isAnchor || i == g_bc7AnchorsOf3Second[partition] || i == g_bc7AnchorsOf3Third[partition]);
+        }
+        else
+            subsets[i] = 0;
 
-    DynamicByteArray dstImage{ extent.width * extent.height * 4, UninitializeTag{} };
+        indices[i] = static_cast<std::uint8_t>(reader.Read(isAnchor ? info.indexBits - 1u : info.indexBits));
+    }
 
-    std::uint8_t* output = reinterpret_cast<std::uint8_t*>(dstImage.get());
-    std::uint16_t compressedColor[2];
-    std::uint8_t decompressedColor[4][3];
+    if (info.index2Bits > 0)
+    {
+        for_range(i, 16u)
+            indices2[i] = static_cast<std::uint8_t>(reader.Read(i == 0 ? info.index2Bits - 1u : info.index2Bits));
+    }
 
-    const std::size_t formatByteSize = 4;
+    /* Interpolate texels; modes with two index tables use the second one for alpha unless the index selection bit swaps them */
+    const unsigned          colorIndexBits  = (info.index2Bits > 0 && indexSelection != 0 ? info.index2Bits : info.indexBits);
+    const unsigned          alphaIndexBits  = (info.index2Bits > 0 && indexSelection == 0 ? info.index2Bits : info.indexBits);
+    const std::uint8_t*     colorWeights    = GetBC7Weights(colorIndexBits);
+    const std::uint8_t*     alphaWeights    = GetBC7Weights(alphaIndexBits);
 
-    for_range(y, extent.height / 4u)
+    for_range(i, 16u)
     {
-        for_range(x, extent.width / 4u)
+        const std::uint32_t*    e0          = endpoints[subsets[i] * 2];
+        const std::uint32_t*    e1          = endpoints[subsets[i] * 2 + 1];
+        std::uint8_t            colorIndex  = indices[i];
+        std::uint8_t            alphaIndex  = indices[i];
+
+        if (info.index2Bits > 0)
         {
-            /* Decompress two 16 bit colors */
-            for_range(i, 2)
-            {
-                compressedColor[i] = *reinterpret_cast<const std::uint16_t*>(data);
-                DecompressRGBColor16Bit(decompressedColor[i], compressedColor[i]);
-                data += 2;
-            }
-
-            /* Generate two more colors by interpolating the previous two */
-            InterpolateColor(decompressedColor[2], decompressedColor[0], decompressedColor[1]);
-            InterpolateColor(decompressedColor[3], decompressedColor[1], decompressedColor[0]);
-
-            /* Read palette bitfield */
-            std::uint32_t palette = *reinterpret_cast<const std::uint32_t*>(data);
-            data += 4;
-
-            /* Generate 4x4 pixel block from palette bitmask */
-            for_range(i, 16u)
-            {
-                /* Get palette index from last two bits */
-                const std::uint32_t paletteIndex = palette & 0x00000003;
-                palette >>= 2;
-
-                /* Write out image color */
-                const std::size_t outputOffset = (((y * 4 + i/4) * extent.width) + (x*4 + i%4)) * formatByteSize;
-                output[outputOffset + 0] = decompressedColor[paletteIndex][0];
-                output[outputOffset + 1] = decompressedColor[paletteIndex][1];
-                output[outputOffset + 2] = decompressedColor[paletteIndex][2];
-                output[outputOffset + 3] = 0xFF;
-            }
+            if (indexSelection != 0)
+                colorIndex = indices2[i];
+            else
+                alphaIndex = indices2[i];
         }
+
+        std::uint8_t* texel = texels + i * 4;
+        for_range(c, 3u)
+            texel[c] = InterpolateBC7(e0[c], e1[c], colorWeights[colorIndex]);
+        texel[3] = InterpolateBC7(e0[3], e1[3], alphaWeights[alphaIndex]);
+
+        /* Rotation swaps alpha with one of the color channels */
+        if (rotation > 0)
+            std::swap(texel[3], texel[rotation - 1]);
     }
+}
+
+
+/* ----- Functions ----- */
+
+DynamicByteArray DecompressBC1ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 8, DecodeBC1Block, threadCount);
+}
+
+DynamicByteArray DecompressBC2ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, DecodeBC2Block, threadCount);
+}
 
-    return dstImage;
+DynamicByteArray DecompressBC3ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, DecodeBC3Block, threadCount);
+}
+
+DynamicByteArray DecompressBC4ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 8, (isSigned ? DecodeBC4SNormBlockRGBA : DecodeBC4UNormBlockRGBA), threadCount);
+}
+
+DynamicByteArray DecompressBC5ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, (isSigned ? DecodeBC5SNormBlockRGBA : DecodeBC5UNormBlockRGBA), threadCount);
+}
+
+DynamicByteArray DecompressBC7ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, DecodeBC7Block, threadCount);
 }
 
 
@@ -23,8 +23,8 @@ struct Extent2D;
 /* ----- Functions ----- */
 
 /*
-Returns an image buffer in the Format::RGBA8UNorm format for the specified BC1 encoded data, or null on failure
-Width and height of the input image must be a multiple of 4.
+Returns an image buffer in the Format::RGBA8UNorm format for the specified BC1 encoded data, or null on failure.
+Blocks at the right and bottom border are clipped if width or height of the input image is not a multiple of 4.
 */
 DynamicByteArray DecompressBC1ToRGBA8UNorm(
     const Extent2D& extent,
@@ -33,6 +33,48 @@ DynamicByteArray DecompressBC1ToRGBA8UNorm(
     unsigned        threadCount = 0
 );
 
+// Same as DecompressBC1ToRGBA8UNorm but for BC2 encoded data with explicit 4-bit alpha channel.
+DynamicByteArray DecompressBC2ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+// Same as DecompressBC1ToRGBA8UNorm but for BC3 encoded data with interpolated alpha channel.
+DynamicByteArray DecompressBC3ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+// Same as DecompressBC1ToRGBA8UNorm but for BC4 encoded data. The single channel is written to red; green and blue are 0 and alpha is 255.
+DynamicByteArray DecompressBC4ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount = 0
+);
+
+// Same as DecompressBC1ToRGBA8UNorm but for BC5 encoded data. The two channels are written to red and green; blue is 0 and alpha is 255.
+DynamicByteArray DecompressBC5ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount = 0
+);
+
+// Same as DecompressBC1ToRGBA8UNorm but for BC7 encoded data. All eight modes are supported; reserved blocks are decoded as transparent black.
+DynamicByteArray DecompressBC7ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
 
 } // /namespace LLGL
 
@@ -8,6 +8,7 @@
 #include <LLGL/Blob.h>
 #include <fstream>
 #include "CoreUtils.h"
+#include "../Platform/MappedFile.h"
 
 
 namespace LLGL
@@ -112,6 +113,26 @@ struct InternalUnmanagedBlob final : Blob::Pimpl
     std::size_t size;
 };
 
+struct InternalMappedFileBlob final : Blob::Pimpl
+{
+    InternalMappedFileBlob(std::unique_ptr<MappedFile>&& mappedFile) :
+        mappedFile { std::forward<std::unique_ptr<MappedFile>>(mappedFile) }
+    {
+    }
+
+    const void* GetData() const override
+    {
+        return mappedFile->GetData();
+    }
+
+    std::size_t GetSize() const override
+    {
+        return mappedFile->GetSize();
+    }
+
+    std::unique_ptr<MappedFile> mappedFile;
+};
+
 static Blob::Pimpl* MakeInternalBlob(const void* data, std::size_t size, bool isWeakRef)
 {
     if (isWeakRef)
@@ -238,6 +259,26 @@ Blob Blob::CreateFromFile(const std::string& filename)
     return CreateFromFile(filename.c_str());
 }
 
+Blob Blob::CreateFromMappedFile(const char* filename)
+{
+    if (filename == nullptr || *filename == '\0')
+        return Blob{};
+
+    /* Map file into memory; this falls back to reading the file on platforms without file mapping */
+    std::unique_ptr<MappedFile> mappedFile = MappedFile::Open(filename);
+    if (!mappedFile)
+        return Blob{};
+
+    Blob blob;
+    blob.pimpl_ = new InternalMappedFileBlob{ std::move(mappedFile) };
+    return blob;
+}
+
+Blob Blob::CreateFromMappedFile(const std::string& filename)
+{
+    return CreateFromMappedFile(filename.c_str());
+}
+
 const void* Blob::GetData() const
 {
     return (pimpl_ != nullptr ? pimpl_->GetData() : nullptr);
@@ -0,0 +1,108 @@
+/*
+ * BlockCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "BlockCompressor.h"
+#include "Threading.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Minimum number of block rows each worker thread encodes; encoding is considerably more expensive than decoding.
+static constexpr unsigned g_blockRowsMinWorkSize = 1;
+
+static void CompressBlockRows(
+    std::uint8_t*           dst,
+    const std::uint8_t*     src,
+    const Extent2D&         extent,
+    std::size_t             srcRowStride,
+    std::size_t             blockSize,
+    BlockEncodeFunction     encodeFunc,
+    ImageCompressionQuality quality,
+    std::size_t             blockRowBegin,
+    std::size_t             blockRowEnd)
+{
+    constexpr std::size_t bytesPerTexel = 4;
+
+    const std::size_t numBlocksX = (extent.width + 3) / 4;
+
+    std::uint8_t texels[4*4*bytesPerTexel];
+
+    for (std::size_t blockY = blockRowBegin; blockY < blockRowEnd; ++blockY)
+    {
+        std::uint8_t* dstBlock = dst + blockY * numBlocksX * blockSize;
+
+        for_range(blockX, numBlocksX)
+        {
+            /* Gather 4x4 texels and replicate the last row and column for blocks at the right and bottom image border */
+            for_range(row, 4u)
+            {
+                const std::size_t   texelY  = std::min<std::size_t>(blockY * 4 + row, extent.height - 1);
+                const std::uint8_t* srcRow  = src + texelY * srcRowStride;
+                for_range(col, 4u)
+                {
+                    const std::size_t texelX = std::min<std::size_t>(blockX * 4 + col, extent.width - 1);
+                    ::memcpy(texels + (row * 4 + col) * bytesPerTexel, srcRow + texelX * bytesPerTexel, bytesPerTexel);
+                }
+            }
+
+            encodeFunc(texels, dstBlock, quality);
+            dstBlock += blockSize;
+        }
+    }
+}
+
+DynamicByteArray CompressBlocksFromRGBA8UNorm(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             srcRowStride,
+    std::size_t             blockSize,
+    BlockEncodeFunction     encodeFunc,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    const std::size_t numBlocksX = (extent.width  + 3) / 4;
+    const std::size_t numBlocksY = (extent.height + 3) / 4;
+
+    if (srcRowStride == 0)
+        srcRowStride = static_cast<std::size_t>(extent.width) * 4;
+
+    /* Return null on invalid arguments */
+    if (data == nullptr || encodeFunc == nullptr || numBlocksX == 0 || numBlocksY == 0 || srcRowStride < static_cast<std::size_t>(extent.width) * 4)
+        return nullptr;
+    if (dataSize < srcRowStride * (extent.height - 1) + static_cast<std::size_t>(extent.width) * 4)
+        return nullptr;
+
+    DynamicByteArray dstBlocks{ numBlocksX * numBlocksY * blockSize, UninitializeTag{} };
+
+    std::uint8_t*       dst = reinterpret_cast<std::uint8_t*>(dstBlocks.get());
+    const std::uint8_t* src = reinterpret_cast<const std::uint8_t*>(data);
+
+    DoConcurrentRange(
+        [dst, src, &extent, srcRowStride, blockSize, encodeFunc, quality](std::size_t begin, std::size_t end)
+        {
+            CompressBlockRows(dst, src, extent, srcRowStride, blockSize, encodeFunc, quality, begin, end);
+        },
+        numBlocksY,
+        threadCount,
+        g_blockRowsMinWorkSize
+    );
+
+    return dstBlocks;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,52 @@
+/*
+ * BlockCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BLOCK_COMPRESSOR_H
+#define LLGL_BLOCK_COMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Function to encode 4x4 texels in the RGBA8UNorm format, stored row by row, into a single compressed block.
+using BlockEncodeFunction = void (*)(const std::uint8_t* texels, std::uint8_t* block, ImageCompressionQuality quality);
+
+/* ----- Functions ----- */
+
+/*
+Returns a buffer of 4x4 blocks for the specified image in the Format::RGBA8UNorm format, or null on failure.
+Each block has 'blockSize' bytes and is encoded by 'encodeFunc'. Rows of blocks are distributed over 'threadCount' threads.
+If 'srcRowStride' is zero, the image rows are tightly packed. Blocks at the right and bottom border are padded by replicating the border texels.
+*/
+DynamicByteArray CompressBlocksFromRGBA8UNorm(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             srcRowStride,
+    std::size_t             blockSize,
+    BlockEncodeFunction     encodeFunc,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,105 @@
+/*
+ * BlockDecompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "BlockDecompressor.h"
+#include "Threading.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Minimum number of block rows each worker thread decodes; a single row of a 4K texture already has 1024 blocks.
+static constexpr unsigned g_blockRowsMinWorkSize = 4;
+
+static void DecompressBlockRows(
+    std::uint8_t*       dst,
+    const std::uint8_t* src,
+    const Extent2D&     extent,
+    std::size_t         blockSize,
+    BlockDecodeFunction decodeFunc,
+    std::size_t         blockRowBegin,
+    std::size_t         blockRowEnd)
+{
+    constexpr std::size_t bytesPerTexel = 4;
+
+    const std::size_t numBlocksX    = (extent.width + 3) / 4;
+    const std::size_t dstRowStride  = extent.width * bytesPerTexel;
+
+    std::uint8_t texels[4*4*bytesPerTexel];
+
+    for (std::size_t blockY = blockRowBegin; blockY < blockRowEnd; ++blockY)
+    {
+        const std::uint8_t* srcBlock = src + blockY * numBlocksX * blockSize;
+
+        const std::size_t texelY        = blockY * 4;
+        const std::size_t numTexelRows  = std::min<std::size_t>(4, extent.height - texelY);
+
+        for_range(blockX, numBlocksX)
+        {
+            decodeFunc(srcBlock, texels);
+            srcBlock += blockSize;
+
+            /* Copy decoded texels into output image and clip the block at the right and bottom image border */
+            const std::size_t texelX        = blockX * 4;
+            const std::size_t numTexelCols  = std::min<std::size_t>(4, extent.width - texelX);
+
+            for_range(row, numTexelRows)
+            {
+                ::memcpy(
+                    dst + (texelY + row) * dstRowStride + texelX * bytesPerTexel,
+                    texels + row * 4 * bytesPerTexel,
+                    numTexelCols * bytesPerTexel
+                );
+            }
+        }
+    }
+}
+
+DynamicByteArray DecompressBlocksToRGBA8UNorm(
+    const Extent2D&     extent,
+    const char*         data,
+    std::size_t         dataSize,
+    std::size_t         blockSize,
+    BlockDecodeFunction decodeFunc,
+    unsigned            threadCount)
+{
+    const std::size_t numBlocksX = (extent.width  + 3) / 4;
+    const std::size_t numBlocksY = (extent.height + 3) / 4;
+
+    /* Return null on invalid arguments */
+    if (data == nullptr || decodeFunc == nullptr || numBlocksX == 0 || numBlocksY == 0 || dataSize < numBlocksX * numBlocksY * blockSize)
+        return nullptr;
+
+    DynamicByteArray dstImage{ static_cast<std::size_t>(extent.width) * extent.height * 4, UninitializeTag{} };
+
+    std::uint8_t*       dst = reinterpret_cast<std::uint8_t*>(dstImage.get());
+    const std::uint8_t* src = reinterpret_cast<const std::uint8_t*>(data);
+
+    /* Blocks in different rows are independent of each other, so distribute block rows over worker threads */
+    DoConcurrentRange(
+        [dst, src, &extent, blockSize, decodeFunc](std::size_t begin, std::size_t end)
+        {
+            DecompressBlockRows(dst, src, extent, blockSize, decodeFunc, begin, end);
+        },
+        numBlocksY,
+        threadCount,
+        g_blockRowsMinWorkSize
+    );
+
+    return dstImage;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
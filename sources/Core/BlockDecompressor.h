@@ -0,0 +1,49 @@
+/*
+ * BlockDecompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_BLOCK_DECOMPRESSOR_H
+#define LLGL_BLOCK_DECOMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Function to decode a single compressed block into 4x4 texels in the RGBA8UNorm format, stored row by row.
+using BlockDecodeFunction = void (*)(const std::uint8_t* block, std::uint8_t* texels);
+
+/* ----- Functions ----- */
+
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified data of 4x4 blocks, or null on failure.
+Each block has 'blockSize' bytes and is decoded by 'decodeFunc'. Rows of blocks are distributed over 'threadCount' threads.
+Width and height of the input image do not have to be a multiple of 4; the texels outside of the image are discarded.
+*/
+DynamicByteArray DecompressBlocksToRGBA8UNorm(
+    const Extent2D&     extent,
+    const char*         data,
+    std::size_t         dataSize,
+    std::size_t         blockSize,
+    BlockDecodeFunction decodeFunc,
+    unsigned            threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,147 @@
+/*
+ * ConcurrentRingBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CONCURRENT_RING_BUFFER_H
+#define LLGL_CONCURRENT_RING_BUFFER_H
+
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Bounded lock-free ring buffer for multiple producers and multiple consumers.
+Each cell has a sequence number that tells producers and consumers whether the cell is free or holds a value for the current lap,
+so Push() and Pop() only need one compare-and-swap on their respective position counter.
+The capacity is rounded up to the next power of two.
+*/
+template <typename T>
+class ConcurrentRingBuffer
+{
+
+    public:
+
+        ConcurrentRingBuffer(const ConcurrentRingBuffer&) = delete;
+        ConcurrentRingBuffer& operator = (const ConcurrentRingBuffer&) = delete;
+
+        explicit ConcurrentRingBuffer(std::size_t capacity) :
+            capacity_ { RoundUpToPowerOfTwo(capacity)       },
+            cells_    { new Cell[capacity_]                 }
+        {
+            for (std::size_t i = 0; i < capacity_; ++i)
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        // Moves the specified value into the ring buffer. Returns false if the ring buffer is full.
+        bool Push(T&& value)
+        {
+            std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = cells_[pos & (capacity_ - 1)];
+                const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0)
+                {
+                    /* Cell is free for this lap; claim it by advancing the enqueue position */
+                    if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = std::move(value);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    /* Cell still holds a value from the previous lap */
+                    return false;
+                }
+                else
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Moves the oldest value out of the ring buffer. Returns false if the ring buffer is empty.
+        bool Pop(T& value)
+        {
+            std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = cells_[pos & (capacity_ - 1)];
+                const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+                if (diff == 0)
+                {
+                    /* Cell holds a value for this lap; claim it by advancing the dequeue position */
+                    if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        value = std::move(cell.value);
+                        cell.sequence.store(pos + capacity_, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    /* Cell has not been written for this lap yet */
+                    return false;
+                }
+                else
+                    pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Returns the number of values this ring buffer can hold.
+        inline std::size_t GetCapacity() const
+        {
+            return capacity_;
+        }
+
+    private:
+
+        struct Cell
+        {
+            std::atomic<std::size_t>    sequence;
+            T                           value;
+        };
+
+    private:
+
+        static std::size_t RoundUpToPowerOfTwo(std::size_t x)
+        {
+            std::size_t n = 1;
+            while (n < x)
+                n <<= 1;
+            return n;
+        }
+
+    private:
+
+        const std::size_t           capacity_;
+        std::unique_ptr<Cell[]>     cells_;
+
+        /* Keep producer and consumer positions on separate cache lines to avoid false sharing */
+        char                        padding0_[64]   = {};
+        std::atomic<std::size_t>    enqueuePos_     { 0 };
+        char                        padding1_[64]   = {};
+        std::atomic<std::size_t>    dequeuePos_     { 0 };
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
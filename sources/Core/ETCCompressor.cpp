@@ -0,0 +1,284 @@
+/*
+ * ETCCompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ETCCompressor.h"
+#include "BlockCompressor.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal constants ----- */
+
+// Intensity modifiers for the individual and differential modes, indexed by codeword and pixel index (must match the decompressor).
+static const int g_etcModifierTable[8][4] =
+{
+    {  2,   8,  -2,   -8 },
+    {  5,  17,  -5,  -17 },
+    {  9,  29,  -9,  -29 },
+    { 13,  42, -13,  -42 },
+    { 18,  60, -18,  -60 },
+    { 24,  80, -24,  -80 },
+    { 33, 106, -33, -106 },
+    { 47, 183, -47, -183 },
+};
+
+
+/* ----- Internal structures ----- */
+
+// Result of encoding one sub-block with a particular base color.
+struct ETCSubBlockResult
+{
+    int             error       = INT32_MAX;
+    int             codeword    = 0;
+    std::uint32_t   pixelBits   = 0;    // MSBs and LSBs of the pixel indices of this sub-block at their final bit positions.
+};
+
+
+/* ----- Internal functions ----- */
+
+static int Square(int x)
+{
+    return x * x;
+}
+
+static int ClampToUInt8(int value)
+{
+    return std::max(0, std::min(value, 255));
+}
+
+static int QuantizeComponent(float value, int maxValue)
+{
+    const int quantized = static_cast<int>(std::floor(value * static_cast<float>(maxValue) / 255.0f + 0.5f));
+    return std::max(0, std::min(quantized, maxValue));
+}
+
+static int Extend4To8Bits(int value)
+{
+    return (value << 4) | value;
+}
+
+static int Extend5To8Bits(int value)
+{
+    return (value << 3) | (value >> 2);
+}
+
+static bool IsInSubBlock(int x, int y, bool flip, int subBlock)
+{
+    return ((flip ? (y >= 2) : (x >= 2)) ? 1 : 0) == subBlock;
+}
+
+// Finds the codeword and pixel indices with the least squared error for one sub-block with the specified base color (8 bits per component).
+static ETCSubBlockResult EncodeSubBlock(const std::uint8_t* texels, bool flip, int subBlock, const int (&baseColor)[3])
+{
+    ETCSubBlockResult bestResult;
+
+    for_range(codeword, 8)
+    {
+        ETCSubBlockResult result;
+        result.error    = 0;
+        result.codeword = codeword;
+
+        for_range(y, 4)
+        {
+            for_range(x, 4)
+            {
+                if (!IsInSubBlock(x, y, flip, subBlock))
+                    continue;
+
+                const std::uint8_t* texel = texels + (y * 4 + x) * 4;
+                int bestIndex = 0, bestError = INT32_MAX;
+
+                for_range(index, 4)
+                {
+                    const int modifier  = g_etcModifierTable[codeword][index];
+                    const int error     =
+                    (
+                        Square(texel[0] - ClampToUInt8(baseColor[0] + modifier)) +
+                        Square(texel[1] - ClampToUInt8(baseColor[1] + modifier)) +
+                        Square(texel[2] - ClampToUInt8(baseColor[2] + modifier))
+                    );
+                    if (error < bestError)
+                    {
+                        bestIndex = index;
+                        bestError = error;
+                    }
+                }
+
+                /* Pixel indices are stored in column-major order with the MSBs in the upper 16 bits */
+                const int bit = x * 4 + y;
+                result.pixelBits |= (static_cast<std::uint32_t>(bestIndex >> 1) << (16 + bit));
+                result.pixelBits |= (static_cast<std::uint32_t>(bestIndex &  1) << bit);
+                result.error += bestError;
+            }
+        }
+
+        if (result.error < bestResult.error)
+            bestResult = result;
+    }
+
+    return bestResult;
+}
+
+static void ComputeSubBlockAverage(const std::uint8_t* texels, bool flip, int subBlock, float (&outAverage)[3])
+{
+    float sum[3] = {};
+    for_range(y, 4)
+    {
+        for_range(x, 4)
+        {
+            if (!IsInSubBlock(x, y, flip, subBlock))
+                continue;
+            for_range(c, 3)
+                sum[c] += static_cast<float>(texels[(y * 4 + x) * 4 + c]);
+        }
+    }
+    for_range(c, 3)
+        outAverage[c] = sum[c] / 8.0f;
+}
+
+static void WriteETC1Block(
+    std::uint8_t*               block,
+    const int                   (&colorBits)[3],
+    bool                        differential,
+    bool                        flip,
+    const ETCSubBlockResult     (&subBlocks)[2])
+{
+    for_range(c, 3)
+        block[c] = static_cast<std::uint8_t>(colorBits[c]);
+
+    block[3] = static_cast<std::uint8_t>
+    (
+        (subBlocks[0].codeword << 5) |
+        (subBlocks[1].codeword << 2) |
+        (differential ? 0x2 : 0x0)   |
+        (flip         ? 0x1 : 0x0)
+    );
+
+    const std::uint32_t pixelBits = (subBlocks[0].pixelBits | subBlocks[1].pixelBits);
+    block[4] = static_cast<std::uint8_t>(pixelBits >> 24);
+    block[5] = static_cast<std::uint8_t>(pixelBits >> 16);
+    block[6] = static_cast<std::uint8_t>(pixelBits >>  8);
+    block[7] = static_cast<std::uint8_t>(pixelBits      );
+}
+
+/*
+Encodes a 4x4 block with the individual and differential modes of ETC1.
+Fast quality only uses vertical sub-blocks; high quality additionally tries the neighboring quantized base colors.
+*/
+static void EncodeETC1Block(const std::uint8_t* texels, std::uint8_t* block, ImageCompressionQuality quality)
+{
+    const int numFlips      = (quality == ImageCompressionQuality::Fast ? 1 : 2);
+    const int offsetRange   = (quality == ImageCompressionQuality::High ? 1 : 0);
+
+    int bestError = INT32_MAX;
+
+    for_range(flipIndex, numFlips)
+    {
+        const bool flip = (flipIndex != 0);
+
+        float average[2][3];
+        ComputeSubBlockAverage(texels, flip, 0, average[0]);
+        ComputeSubBlockAverage(texels, flip, 1, average[1]);
+
+        for_range(modeIndex, 2)
+        {
+            /* Differential mode stores 5-bit base colors, individual mode stores 4-bit base colors */
+            const bool  differential    = (modeIndex == 0);
+            const int   maxValue        = (differential ? 31 : 15);
+
+            int quantized[2][3];
+            for_range(s, 2)
+            {
+                for_range(c, 3)
+                    quantized[s][c] = QuantizeComponent(average[s][c], maxValue);
+            }
+
+            /* Evaluate each sub-block with its base color shifted in intensity by up to 'offsetRange' quantization steps */
+            ETCSubBlockResult   results[2][3];
+            int                 shiftedColors[2][3][3];
+
+            for_range(s, 2)
+            {
+                for (int offset = -offsetRange; offset <= offsetRange; ++offset)
+                {
+                    int (&shifted)[3] = shiftedColors[s][offset + 1];
+                    int baseColor[3];
+                    for_range(c, 3)
+                    {
+                        shifted[c]      = std::max(0, std::min(quantized[s][c] + offset, maxValue));
+                        baseColor[c]    = (differential ? Extend5To8Bits(shifted[c]) : Extend4To8Bits(shifted[c]));
+                    }
+                    results[s][offset + 1] = EncodeSubBlock(texels, flip, static_cast<int>(s), baseColor);
+                }
+            }
+
+            /* Select the best combination; the differential mode is limited to deltas in the range [-4, 3] */
+            for (int offset0 = -offsetRange; offset0 <= offsetRange; ++offset0)
+            {
+                for (int offset1 = -offsetRange; offset1 <= offsetRange; ++offset1)
+                {
+                    const int (&color0)[3] = shiftedColors[0][offset0 + 1];
+                    const int (&color1)[3] = shiftedColors[1][offset1 + 1];
+
+                    int colorBits[3];
+                    bool isValid = true;
+
+                    for_range(c, 3)
+                    {
+                        if (differential)
+                        {
+                            const int delta = color1[c] - color0[c];
+                            if (delta < -4 || delta > 3)
+                                isValid = false;
+                            colorBits[c] = (color0[c] << 3) | (delta & 0x7);
+                        }
+                        else
+                            colorBits[c] = (color0[c] << 4) | color1[c];
+                    }
+
+                    if (!isValid)
+                        continue;
+
+                    const ETCSubBlockResult subBlocks[2] = { results[0][offset0 + 1], results[1][offset1 + 1] };
+                    const int error = subBlocks[0].error + subBlocks[1].error;
+                    if (error < bestError)
+                    {
+                        bestError = error;
+                        WriteETC1Block(block, colorBits, differential, flip, subBlocks);
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/* ----- Functions ----- */
+
+DynamicByteArray CompressRGBA8UNormToETC1(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    return CompressBlocksFromRGBA8UNorm(extent, data, dataSize, rowStride, 8, EncodeETC1Block, quality, threadCount);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
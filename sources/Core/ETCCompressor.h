@@ -0,0 +1,46 @@
+/*
+ * ETCCompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ETC_COMPRESSOR_H
+#define LLGL_ETC_COMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Returns a buffer of ETC1 encoded blocks for the specified image in the Format::RGBA8UNorm format, or null on failure.
+The alpha channel is ignored. Since ETC2 is backwards compatible to ETC1, the result is also valid ETC2 RGB data.
+If 'rowStride' is zero, the image rows are tightly packed. Width and height do not have to be a multiple of 4.
+*/
+DynamicByteArray CompressRGBA8UNormToETC1(
+    const Extent2D&         extent,
+    const void*             data,
+    std::size_t             dataSize,
+    std::size_t             rowStride,
+    ImageCompressionQuality quality,
+    unsigned                threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,492 @@
+/*
+ * ETCDecompressor.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ETCDecompressor.h"
+#include "BlockDecompressor.h"
+#include <LLGL/Types.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal constants ----- */
+
+// Intensity modifiers for the individual and differential modes, indexed by codeword and pixel index.
+static const int g_etcModifierTable[8][4] =
+{
+    {  2,   8,  -2,   -8 },
+    {  5,  17,  -5,  -17 },
+    {  9,  29,  -9,  -29 },
+    { 13,  42, -13,  -42 },
+    { 18,  60, -18,  -60 },
+    { 24,  80, -24,  -80 },
+    { 33, 106, -33, -106 },
+    { 47, 183, -47, -183 },
+};
+
+// Distances for the T and H modes of ETC2.
+static const int g_etcDistanceTable[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+// Modifiers for EAC blocks (alpha of ETC2 RGBA8 and the R11/RG11 formats), indexed by table index and 3-bit pixel index.
+static const int g_eacModifierTable[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 },
+};
+
+
+/* ----- Internal functions ----- */
+
+static std::uint8_t ClampToUInt8(int value)
+{
+    return static_cast<std::uint8_t>(std::max(0, std::min(value, 255)));
+}
+
+static int Extend4To8Bits(int value)
+{
+    return (value << 4) | value;
+}
+
+static int Extend5To8Bits(int value)
+{
+    return (value << 3) | (value >> 2);
+}
+
+static int Extend6To8Bits(int value)
+{
+    return (value << 2) | (value >> 4);
+}
+
+static int Extend7To8Bits(int value)
+{
+    return (value << 1) | (value >> 6);
+}
+
+// Returns the sign extended 3-bit delta of the differential mode.
+static int SignExtend3Bits(int value)
+{
+    return (value & 0x4) != 0 ? value - 8 : value;
+}
+
+// Reads the 32 bits of pixel indices in the second half of a block, which is stored in big-endian byte order.
+static std::uint32_t ReadPixelBits(const std::uint8_t* src)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(src[4]) << 24) |
+        (static_cast<std::uint32_t>(src[5]) << 16) |
+        (static_cast<std::uint32_t>(src[6]) <<  8) |
+        (static_cast<std::uint32_t>(src[7])      )
+    );
+}
+
+static void WriteTexel(std::uint8_t* dst, int r, int g, int b)
+{
+    dst[0] = ClampToUInt8(r);
+    dst[1] = ClampToUInt8(g);
+    dst[2] = ClampToUInt8(b);
+    dst[3] = 0xFF;
+}
+
+// Writes a transparent black texel for the punch-through alpha of ETC2 RGB8A1.
+static void WriteTransparentTexel(std::uint8_t* dst)
+{
+    dst[0] = 0x00;
+    dst[1] = 0x00;
+    dst[2] = 0x00;
+    dst[3] = 0x00;
+}
+
+/*
+Returns the 2-bit pixel index for the texel at (x, y). Indices are stored in column-major order,
+with the most significant bits in the upper half and the least significant bits in the lower half.
+*/
+static int GetPixelIndex(std::uint32_t pixelBits, int x, int y)
+{
+    const int bit = x * 4 + y;
+    return static_cast<int>(((pixelBits >> (15 + bit)) & 0x2) | ((pixelBits >> bit) & 0x1));
+}
+
+/*
+Decodes the individual or differential mode. For non-opaque punch-through blocks,
+pixel index 2 is transparent and the modifier of pixel index 0 is zero.
+*/
+static void DecodeIndividualOrDifferentialBlock(const std::uint8_t* src, std::uint8_t* dst, const int (&baseColors)[2][3], bool opaque)
+{
+    const std::uint32_t pixelBits       = ReadPixelBits(src);
+    const int           codewords[2]    = { (src[3] >> 5) & 0x7, (src[3] >> 2) & 0x7 };
+    const bool          flip            = ((src[3] & 0x1) != 0);
+
+    for_range(y, 4)
+    {
+        for_range(x, 4)
+        {
+            /* Sub-blocks are either 2x4 side-by-side or 4x2 on top of each other */
+            const int   subBlock    = (flip ? (y >= 2) : (x >= 2)) ? 1 : 0;
+            const int   index       = GetPixelIndex(pixelBits, x, y);
+            if (!opaque && index == 2)
+            {
+                WriteTransparentTexel(dst + (y * 4 + x) * 4);
+                continue;
+            }
+            const int   modifier    = (!opaque && index == 0 ? 0 : g_etcModifierTable[codewords[subBlock]][index]);
+            const int (&base)[3]    = baseColors[subBlock];
+            WriteTexel(dst + (y * 4 + x) * 4, base[0] + modifier, base[1] + modifier, base[2] + modifier);
+        }
+    }
+}
+
+// Decodes the T or H mode. For non-opaque punch-through blocks, paint color 2 is transparent.
+static void DecodePaintColorBlock(const std::uint8_t* src, std::uint8_t* dst, const int (&paintColors)[4][3], bool opaque)
+{
+    const std::uint32_t pixelBits = ReadPixelBits(src);
+    for_range(y, 4)
+    {
+        for_range(x, 4)
+        {
+            const int index = GetPixelIndex(pixelBits, x, y);
+            if (!opaque && index == 2)
+            {
+                WriteTransparentTexel(dst + (y * 4 + x) * 4);
+                continue;
+            }
+            const int (&color)[3] = paintColors[index];
+            WriteTexel(dst + (y * 4 + x) * 4, color[0], color[1], color[2]);
+        }
+    }
+}
+
+static void SetPaintColor(int (&dst)[3], const int (&base)[3], int distance)
+{
+    dst[0] = base[0] + distance;
+    dst[1] = base[1] + distance;
+    dst[2] = base[2] + distance;
+}
+
+static void DecodeTModeBlock(const std::uint8_t* src, std::uint8_t* dst, bool opaque)
+{
+    const int base0[3] =
+    {
+        Extend4To8Bits(((src[0] >> 1) & 0xC) | (src[0] & 0x3)),
+        Extend4To8Bits((src[1] >> 4) & 0xF),
+        Extend4To8Bits(src[1] & 0xF),
+    };
+    const int base1[3] =
+    {
+        Extend4To8Bits((src[2] >> 4) & 0xF),
+        Extend4To8Bits(src[2] & 0xF),
+        Extend4To8Bits((src[3] >> 4) & 0xF),
+    };
+    const int distance = g_etcDistanceTable[((src[3] >> 1) & 0x6) | (src[3] & 0x1)];
+
+    int paintColors[4][3];
+    SetPaintColor(paintColors[0], base0, 0);
+    SetPaintColor(paintColors[1], base1, distance);
+    SetPaintColor(paintColors[2], base1, 0);
+    SetPaintColor(paintColors[3], base1, -distance);
+
+    DecodePaintColorBlock(src, dst, paintColors, opaque);
+}
+
+static void DecodeHModeBlock(const std::uint8_t* src, std::uint8_t* dst, bool opaque)
+{
+    const int base0[3] =
+    {
+        Extend4To8Bits((src[0] >> 3) & 0xF),
+        Extend4To8Bits(((src[0] << 1) & 0xE) | ((src[1] >> 4) & 0x1)),
+        Extend4To8Bits((src[1] & 0x8) | ((src[1] << 1) & 0x6) | (src[2] >> 7)),
+    };
+    const int base1[3] =
+    {
+        Extend4To8Bits((src[2] >> 3) & 0xF),
+        Extend4To8Bits(((src[2] << 1) & 0xE) | (src[3] >> 7)),
+        Extend4To8Bits((src[3] >> 3) & 0xF),
+    };
+
+    /* The least significant bit of the distance index is given by the order of the two base colors */
+    const int value0    = (base0[0] << 16) | (base0[1] << 8) | base0[2];
+    const int value1    = (base1[0] << 16) | (base1[1] << 8) | base1[2];
+    const int distance  = g_etcDistanceTable[(src[3] & 0x4) | ((src[3] & 0x1) << 1) | (value0 >= value1 ? 1 : 0)];
+
+    int paintColors[4][3];
+    SetPaintColor(paintColors[0], base0, distance);
+    SetPaintColor(paintColors[1], base0, -distance);
+    SetPaintColor(paintColors[2], base1, distance);
+    SetPaintColor(paintColors[3], base1, -distance);
+
+    DecodePaintColorBlock(src, dst, paintColors, opaque);
+}
+
+static void DecodePlanarModeBlock(const std::uint8_t* src, std::uint8_t* dst)
+{
+    /* Colors at the origin (O), horizontal (H), and vertical (V) corners in RGB 6:7:6 */
+    const int origin[3] =
+    {
+        Extend6To8Bits((src[0] >> 1) & 0x3F),
+        Extend7To8Bits(((src[0] & 0x1) << 6) | ((src[1] >> 1) & 0x3F)),
+        Extend6To8Bits(((src[1] & 0x1) << 5) | (src[2] & 0x18) | ((src[2] << 1) & 0x6) | ((src[3] >> 7) & 0x1)),
+    };
+    const int horizontal[3] =
+    {
+        Extend6To8Bits(((src[3] >> 1) & 0x3E) | (src[3] & 0x1)),
+        Extend7To8Bits((src[4] >> 1) & 0x7F),
+        Extend6To8Bits(((src[4] & 0x1) << 5) | ((src[5] >> 3) & 0x1F)),
+    };
+    const int vertical[3] =
+    {
+        Extend6To8Bits(((src[5] & 0x7) << 3) | ((src[6] >> 5) & 0x7)),
+        Extend7To8Bits(((src[6] & 0x1F) << 2) | ((src[7] >> 6) & 0x3)),
+        Extend6To8Bits(src[7] & 0x3F),
+    };
+
+    for_range(y, 4)
+    {
+        for_range(x, 4)
+        {
+            int color[3];
+            for_range(c, 3)
+                color[c] = (x * (horizontal[c] - origin[c]) + y * (vertical[c] - origin[c]) + 4 * origin[c] + 2) >> 2;
+            WriteTexel(dst + (y * 4 + x) * 4, color[0], color[1], color[2]);
+        }
+    }
+}
+
+/*
+Decodes an ETC2 RGB block. With punch-through alpha (RGB8A1), the differential bit is the opaque bit instead
+and the individual mode is not available.
+*/
+static void DecodeETC2ColorBlock(const std::uint8_t* block, std::uint8_t* texels, bool punchThrough)
+{
+    int baseColors[2][3];
+
+    const bool opaque = (!punchThrough || (block[3] & 0x2) != 0);
+
+    if (!punchThrough && (block[3] & 0x2) == 0)
+    {
+        /* Individual mode: Two base colors in RGB 4:4:4 */
+        for_range(c, 3)
+        {
+            baseColors[0][c] = Extend4To8Bits((block[c] >> 4) & 0xF);
+            baseColors[1][c] = Extend4To8Bits(block[c] & 0xF);
+        }
+    }
+    else
+    {
+        /* Differential mode: Base color in RGB 5:5:5 and second color as 3-bit delta */
+        int base[3], second[3];
+        for_range(c, 3)
+        {
+            base[c]     = (block[c] >> 3) & 0x1F;
+            second[c]   = base[c] + SignExtend3Bits(block[c] & 0x7);
+        }
+
+        /* ETC2 encodes its additional modes with an overflow of the delta in red, green, or blue */
+        if (second[0] < 0 || second[0] > 31)
+            return DecodeTModeBlock(block, texels, opaque);
+        if (second[1] < 0 || second[1] > 31)
+            return DecodeHModeBlock(block, texels, opaque);
+        if (second[2] < 0 || second[2] > 31)
+            return DecodePlanarModeBlock(block, texels);
+
+        for_range(c, 3)
+        {
+            baseColors[0][c] = Extend5To8Bits(base[c]);
+            baseColors[1][c] = Extend5To8Bits(second[c]);
+        }
+    }
+
+    DecodeIndividualOrDifferentialBlock(block, texels, baseColors, opaque);
+}
+
+// Reads the 48 bits of 3-bit pixel indices of an EAC block, which are stored in big-endian byte order.
+static std::uint64_t ReadEACPixelBits(const std::uint8_t* src)
+{
+    std::uint64_t bits = 0;
+    for_range(i, 6)
+        bits = (bits << 8) | src[2 + i];
+    return bits;
+}
+
+// Returns the 3-bit pixel index for the texel at (x, y). Indices are stored in column-major order, starting at the most significant bits.
+static int GetEACPixelIndex(std::uint64_t pixelBits, int x, int y)
+{
+    return static_cast<int>((pixelBits >> (45 - (x * 4 + y) * 3)) & 0x7);
+}
+
+// Decodes an 8-bit EAC block, i.e. the alpha channel of ETC2 RGBA8, into the specified component of the RGBA8 texels.
+static void DecodeEAC8BitBlock(const std::uint8_t* src, std::uint8_t* dst, int component)
+{
+    const int           base        = src[0];
+    const int           multiplier  = (src[1] >> 4) & 0xF;
+    const int (&modifiers)[8]       = g_eacModifierTable[src[1] & 0xF];
+    const std::uint64_t pixelBits   = ReadEACPixelBits(src);
+
+    for_range(y, 4)
+    {
+        for_range(x, 4)
+            dst[(y * 4 + x) * 4 + component] = ClampToUInt8(base + modifiers[GetEACPixelIndex(pixelBits, x, y)] * multiplier);
+    }
+}
+
+/*
+Decodes an 11-bit EAC block (R11 or RG11) into the specified component of the RGBA8 texels.
+Signed values are remapped from the range [-1, 1] to [0, 1].
+*/
+static void DecodeEAC11BitBlock(const std::uint8_t* src, std::uint8_t* dst, int component, bool isSigned)
+{
+    /* Signed base codewords -128 and -127 both represent -1 */
+    const int           base        = (isSigned ? std::max<int>(-127, static_cast<std::int8_t>(src[0])) * 8 : src[0] * 8 + 4);
+    const int           multiplier  = (src[1] >> 4) & 0xF;
+    const int (&modifiers)[8]       = g_eacModifierTable[src[1] & 0xF];
+    const std::uint64_t pixelBits   = ReadEACPixelBits(src);
+
+    for_range(y, 4)
+    {
+        for_range(x, 4)
+        {
+            /* A multiplier of zero selects the modifier without scaling to allow for precise values */
+            const int modifier = modifiers[GetEACPixelIndex(pixelBits, x, y)];
+            const int value = base + (multiplier != 0 ? modifier * multiplier * 8 : modifier);
+
+            std::uint8_t& texel = dst[(y * 4 + x) * 4 + component];
+            if (isSigned)
+                texel = static_cast<std::uint8_t>(((std::max(-1023, std::min(value, 1023)) + 1023) * 255 + 1023) / 2046);
+            else
+                texel = static_cast<std::uint8_t>((std::max(0, std::min(value, 2047)) * 255 + 1023) / 2047);
+        }
+    }
+}
+
+// Fills the green and blue components with 0 and alpha with 255 for the single- and dual-channel formats.
+static void ClearBlockComponents(std::uint8_t* dst, int firstComponent)
+{
+    for_range(i, 16)
+    {
+        for (int c = firstComponent; c < 3; ++c)
+            dst[i * 4 + c] = 0x00;
+        dst[i * 4 + 3] = 0xFF;
+    }
+}
+
+/* ----- Block decode functions ----- */
+
+static void DecodeETC2RGBBlock(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeETC2ColorBlock(block, texels, false);
+}
+
+static void DecodeETC2RGBA1Block(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeETC2ColorBlock(block, texels, true);
+}
+
+static void DecodeETC2RGBA8Block(const std::uint8_t* block, std::uint8_t* texels)
+{
+    /* Alpha block precedes the color block */
+    DecodeETC2ColorBlock(block + 8, texels, false);
+    DecodeEAC8BitBlock(block, texels, 3);
+}
+
+static void DecodeEACR11UNormBlock(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeEAC11BitBlock(block, texels, 0, false);
+    ClearBlockComponents(texels, 1);
+}
+
+static void DecodeEACR11SNormBlock(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeEAC11BitBlock(block, texels, 0, true);
+    ClearBlockComponents(texels, 1);
+}
+
+static void DecodeEACRG11UNormBlock(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeEAC11BitBlock(block,     texels, 0, false);
+    DecodeEAC11BitBlock(block + 8, texels, 1, false);
+    ClearBlockComponents(texels, 2);
+}
+
+static void DecodeEACRG11SNormBlock(const std::uint8_t* block, std::uint8_t* texels)
+{
+    DecodeEAC11BitBlock(block,     texels, 0, true);
+    DecodeEAC11BitBlock(block + 8, texels, 1, true);
+    ClearBlockComponents(texels, 2);
+}
+
+
+/* ----- Functions ----- */
+
+DynamicByteArray DecompressETC2ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 8, DecodeETC2RGBBlock, threadCount);
+}
+
+DynamicByteArray DecompressETC2A1ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 8, DecodeETC2RGBA1Block, threadCount);
+}
+
+DynamicByteArray DecompressETC2A8ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, DecodeETC2RGBA8Block, threadCount);
+}
+
+DynamicByteArray DecompressEACR11ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 8, (isSigned ? DecodeEACR11SNormBlock : DecodeEACR11UNormBlock), threadCount);
+}
+
+DynamicByteArray DecompressEACRG11ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount)
+{
+    return DecompressBlocksToRGBA8UNorm(extent, data, dataSize, 16, (isSigned ? DecodeEACRG11SNormBlock : DecodeEACRG11UNormBlock), threadCount);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,83 @@
+/*
+ * ETCDecompressor.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ETC_DECOMPRESSOR_H
+#define LLGL_ETC_DECOMPRESSOR_H
+
+
+#include <LLGL/Types.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+struct Extent2D;
+
+/* ----- Functions ----- */
+
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified ETC2 RGB encoded data, or null on failure.
+ETC1 encoded data can be decompressed with this function as well, since ETC2 is backwards compatible to ETC1.
+Blocks at the right and bottom border are clipped if width or height of the input image is not a multiple of 4.
+*/
+DynamicByteArray DecompressETC2ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+// Returns an image buffer in the Format::RGBA8UNorm format for the specified ETC2 RGB8A1 (punch-through alpha) encoded data, or null on failure.
+DynamicByteArray DecompressETC2A1ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+// Returns an image buffer in the Format::RGBA8UNorm format for the specified ETC2 RGBA8 (EAC alpha) encoded data, or null on failure.
+DynamicByteArray DecompressETC2A8ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    unsigned        threadCount = 0
+);
+
+/*
+Returns an image buffer in the Format::RGBA8UNorm format for the specified EAC R11 encoded data, or null on failure.
+The red component is decoded into the red channel, green and blue are set to 0, and alpha is set to 255.
+Signed values are remapped from the range [-1, 1] to [0, 1].
+*/
+DynamicByteArray DecompressEACR11ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount = 0
+);
+
+// Same as DecompressEACR11ToRGBA8UNorm but for EAC RG11 encoded data, which is decoded into the red and green channels.
+DynamicByteArray DecompressEACRG11ToRGBA8UNorm(
+    const Extent2D& extent,
+    const char*     data,
+    std::size_t     dataSize,
+    bool            isSigned,
+    unsigned        threadCount = 0
+);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,13 +7,31 @@
 
 #include "Float16Compressor.h"
 
+/*
+Array conversions use the hardware conversion instructions if the compiler targets them,
+i.e. F16C on x86 (e.g. with -mf16c, -mavx2, or /arch:AVX2) and NEON on AArch64; otherwise SSE2 or scalar code is used.
+*/
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#   define LLGL_FLOAT16_F16C
+#   include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define LLGL_FLOAT16_SSE2
+#   include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   define LLGL_FLOAT16_NEON
+#   include <arm_neon.h>
+#endif
+
 
 namespace LLGL
 {
 
 
 /*
-This class has been adopted from a public-domain code sample.
+Compression rounds to nearest even like the F16C and NEON conversion instructions, so the scalar and vectorized conversions produce the same results.
+It has been adopted from the public-domain function "float_to_half_fast3_rtne" by Fabian Giesen.
+see https://gist.github.com/rygorous/2156668
+Decompression has been adopted from a public-domain code sample.
 see http://stackoverflow.com/questions/1659440/32-bit-to-16-bit-floating-point-conversion
 */
 class Float16Compressor
@@ -23,20 +41,34 @@ class Float16Compressor
 
         static std::uint16_t Compress(float value)
         {
-            Bits v, s;
+            Bits v;
             v.f = value;
-            std::uint32_t sign = v.si & signN;
-            v.si ^= sign;
-            sign >>= shiftSign; // logical shift
-            s.si = mulN;
-            s.si = static_cast<std::int32_t>(s.f * v.f); // correct subnormals
-            v.si ^= (s.si ^ v.si) & -(minN > v.si);
-            v.si ^= (infN ^ v.si) & -((infN > v.si) & (v.si > maxN));
-            v.si ^= (nanN ^ v.si) & -((nanN > v.si) & (v.si > infN));
-            v.ui >>= shift; // logical shift
-            v.si ^= ((v.si - maxD) ^ v.si) & -(v.si > maxC);
-            v.si ^= ((v.si - minD) ^ v.si) & -(v.si > subC);
-            return static_cast<std::uint16_t>(v.ui | sign);
+            const std::uint32_t sign = v.ui & signU;
+            v.ui ^= sign;
+
+            std::uint32_t result;
+            if (v.ui >= f16MaxU)
+            {
+                /* Result is Inf or NaN; all NaNs are converted to a quiet NaN */
+                result = (v.ui > f32InfU ? 0x7E00u : 0x7C00u);
+            }
+            else if (v.ui < f16MinNormU)
+            {
+                /* Result is subnormal or zero: Align the 10 mantissa bits with a magic value; float addition rounds to nearest even */
+                Bits magic;
+                magic.ui = denormMagicU;
+                v.f += magic.f;
+                result = v.ui - magic.ui;
+            }
+            else
+            {
+                /* Rebias exponent and round mantissa to nearest even */
+                const std::uint32_t mantOdd = (v.ui >> shift) & 1u;
+                v.ui += rebiasU + mantOdd;
+                result = v.ui >> shift;
+            }
+
+            return static_cast<std::uint16_t>(result | (sign >> shiftSign));
         }
 
         static float Decompress(std::uint16_t value)
@@ -75,12 +107,10 @@ class Float16Compressor
         static constexpr std::int32_t signN     = 0x80000000; // flt32 sign bit
 
         static constexpr std::int32_t infC      = (infN >> shift);
-        static constexpr std::int32_t nanN      = ((infC + 1) << shift); // minimum flt16 nan as a flt32
         static constexpr std::int32_t maxC      = (maxN >> shift);
         static constexpr std::int32_t minC      = (minN >> shift);
         static constexpr std::int32_t signC     = (signN >> shiftSign); // flt16 sign bit
 
-        static constexpr std::int32_t mulN      = 0x52000000; // (1 << 23) / minN
         static constexpr std::int32_t mulC      = 0x33800000; // minN / (1 << (23 - shift))
 
         static constexpr std::int32_t subC      = 0x003ff; // max flt32 subnormal down shifted
@@ -89,6 +119,13 @@ class Float16Compressor
         static constexpr std::int32_t maxD      = (infC - maxC - 1);
         static constexpr std::int32_t minD      = (minC - subC - 1);
 
+        static constexpr std::uint32_t signU        = 0x80000000u;          // flt32 sign bit
+        static constexpr std::uint32_t f32InfU      = 0x7f800000u;          // flt32 infinity
+        static constexpr std::uint32_t f16MaxU      = (143u << 23);         // smallest flt32 that overflows flt16, i.e. 2^16
+        static constexpr std::uint32_t f16MinNormU  = (113u << 23);         // min flt16 normal as a flt32, i.e. 2^-14
+        static constexpr std::uint32_t denormMagicU = (126u << 23);         // aligns flt16 subnormal mantissa at the lowest bits, i.e. 0.5
+        static constexpr std::uint32_t rebiasU      = 0xc8000fffu;          // exponent rebias from 127 to 15 plus rounding bias
+
 };
 
 
@@ -102,6 +139,92 @@ LLGL_EXPORT float DecompressFloat16(std::uint16_t value)
     return Float16Compressor::Decompress(value);
 }
 
+#ifdef LLGL_FLOAT16_SSE2
+
+// Same operations as Float16Compressor::Compress() for 4 values at once; branches are expressed with comparison masks.
+static __m128i CompressFloat16x4(__m128 value)
+{
+    const __m128i signMask      = _mm_set1_epi32(static_cast<std::int32_t>(0x80000000u));
+    const __m128i f32Inf        = _mm_set1_epi32(0x7f800000);
+    const __m128i f16Max        = _mm_set1_epi32(143 << 23);
+    const __m128i f16MinNorm    = _mm_set1_epi32(113 << 23);
+    const __m128i denormMagic   = _mm_set1_epi32(126 << 23);
+    const __m128i rebias        = _mm_set1_epi32(static_cast<std::int32_t>(0xc8000fffu));
+
+    __m128i v = _mm_castps_si128(value);
+    const __m128i sign = _mm_and_si128(v, signMask);
+    v = _mm_xor_si128(v, sign);
+
+    /* All values are non-negative now, so signed comparisons are sufficient */
+    const __m128i isInfOrNaN    = _mm_cmpgt_epi32(v, _mm_sub_epi32(f16Max, _mm_set1_epi32(1)));
+    const __m128i isSubnormal   = _mm_cmpgt_epi32(f16MinNorm, v);
+    const __m128i infOrNaN      = _mm_or_si128(_mm_set1_epi32(0x7c00), _mm_and_si128(_mm_cmpgt_epi32(v, f32Inf), _mm_set1_epi32(0x0200)));
+    const __m128i subnormal     = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(v), _mm_castsi128_ps(denormMagic))), denormMagic);
+    const __m128i mantOdd       = _mm_and_si128(_mm_srli_epi32(v, 13), _mm_set1_epi32(1));
+    const __m128i normal        = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(v, rebias), mantOdd), 13);
+
+    __m128i result = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+    result = _mm_or_si128(_mm_and_si128(isInfOrNaN, infOrNaN), _mm_andnot_si128(isInfOrNaN, result));
+    result = _mm_or_si128(result, _mm_srli_epi32(sign, 16));
+
+    /* Sign-extend the lower 16 bits, so the signed saturation of _mm_packs_epi32 preserves all bits */
+    return _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+}
+
+#endif // /LLGL_FLOAT16_SSE2
+
+LLGL_EXPORT void CompressFloat16Array(const float* src, std::uint16_t* dst, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #if defined(LLGL_FLOAT16_F16C)
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), v);
+    }
+
+    #elif defined(LLGL_FLOAT16_SSE2)
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i a = CompressFloat16x4(_mm_loadu_ps(src + i    ));
+        const __m128i b = CompressFloat16x4(_mm_loadu_ps(src + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(a, b));
+    }
+
+    #elif defined(LLGL_FLOAT16_NEON)
+
+    for (; i + 4 <= count; i += 4)
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+
+    #endif
+
+    for (; i < count; ++i)
+        dst[i] = Float16Compressor::Compress(src[i]);
+}
+
+LLGL_EXPORT void DecompressFloat16Array(const std::uint16_t* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #if defined(LLGL_FLOAT16_F16C)
+
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+
+    #elif defined(LLGL_FLOAT16_NEON)
+
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+
+    #endif
+
+    for (; i < count; ++i)
+        dst[i] = Float16Compressor::Decompress(src[i]);
+}
+
 
 } // /namespace LLGL
 
@@ -11,18 +11,28 @@
 
 #include <LLGL/Export.h>
 #include <cstdint>
+#include <cstddef>
 
 
 namespace LLGL
 {
 
 
-// Compresses the specified 32-bit float into a 16-bit float (represented as 16-bit unsigned integer).
+// Compresses the specified 32-bit float into a 16-bit float (represented as 16-bit unsigned integer). The value is rounded to nearest even.
 LLGL_EXPORT std::uint16_t CompressFloat16(float value);
 
 // Decompresses the specified 16-bit float (represented as 16-bit unsigned integer) into a 32-bit float.
 LLGL_EXPORT float DecompressFloat16(std::uint16_t value);
 
+/*
+Compresses the specified array of 32-bit floats into 16-bit floats. This produces the same results as CompressFloat16 for each element,
+except for the payload of NaNs, which is preserved by the hardware conversion instructions.
+*/
+LLGL_EXPORT void CompressFloat16Array(const float* src, std::uint16_t* dst, std::size_t count);
+
+// Decompresses the specified array of 16-bit floats into 32-bit floats. Signaling NaNs may be converted to quiet NaNs.
+LLGL_EXPORT void DecompressFloat16Array(const std::uint16_t* src, float* dst, std::size_t count);
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,72 @@
+/*
+ * FramePacer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/FramePacer.h>
+#include <LLGL/Display.h>
+#include <LLGL/Timer.h>
+
+
+namespace LLGL
+{
+
+
+FramePacer::FramePacer(double targetFrameRate)
+{
+    SetTargetFrameRate(targetFrameRate);
+}
+
+void FramePacer::SetTargetFrameRate(double targetFrameRate)
+{
+    if (targetFrameRate > 0.0)
+        frameInterval_ = static_cast<std::uint64_t>(static_cast<double>(Timer::Frequency()) / targetFrameRate + 0.5);
+    else
+        frameInterval_ = 0;
+}
+
+void FramePacer::SetTargetFrameRate(const Display& display)
+{
+    SetTargetFrameRate(static_cast<double>(display.GetDisplayMode().refreshRate));
+}
+
+double FramePacer::GetTargetFrameRate() const
+{
+    if (frameInterval_ > 0)
+        return static_cast<double>(Timer::Frequency()) / static_cast<double>(frameInterval_);
+    else
+        return 0.0;
+}
+
+void FramePacer::WaitForNextFrame()
+{
+    if (frameInterval_ == 0)
+        return;
+
+    const std::uint64_t currentTick = Timer::Tick();
+    if (nextFrameTick_ > currentTick)
+    {
+        /* Sleep until the scheduled start of this frame and schedule the next one by a fixed interval, so wake-up jitter doesn't accumulate */
+        Timer::SleepUntil(nextFrameTick_);
+        nextFrameTick_ += frameInterval_;
+    }
+    else
+    {
+        /* Previous frame took too long, so schedule the next frame from the current time instead of catching up */
+        nextFrameTick_ = currentTick + frameInterval_;
+    }
+}
+
+void FramePacer::Reset()
+{
+    nextFrameTick_ = 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
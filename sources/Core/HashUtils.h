@@ -0,0 +1,67 @@
+/*
+ * HashUtils.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_HASH_UTILS_H
+#define LLGL_HASH_UTILS_H
+
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+// Initial value for 64-bit FNV-1a hashes.
+static constexpr std::uint64_t g_hashSeed = 0xCBF29CE484222325ull;
+
+// Accumulates the specified bytes into a 64-bit FNV-1a hash. This hash is stable across runs and platforms.
+inline void HashBytes(std::uint64_t& seed, const void* data, std::size_t size)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        seed ^= static_cast<std::uint64_t>(bytes[i]);
+        seed *= 0x100000001B3ull;
+    }
+}
+
+// Accumulates the specified trivially copyable value into a 64-bit FNV-1a hash.
+template <typename T>
+inline void HashValue(std::uint64_t& seed, const T& value)
+{
+    HashBytes(seed, &value, sizeof(value));
+}
+
+// Accumulates the specified null-terminated string (including its terminator) into a 64-bit FNV-1a hash. Null pointers are hashed like empty strings.
+inline void HashString(std::uint64_t& seed, const char* str)
+{
+    if (str != nullptr)
+        HashBytes(seed, str, std::strlen(str) + 1);
+    else
+        HashBytes(seed, "", 1);
+}
+
+// Returns the 64-bit FNV-1a hash of the specified bytes.
+inline std::uint64_t GetHash(const void* data, std::size_t size)
+{
+    std::uint64_t seed = g_hashSeed;
+    HashBytes(seed, data, size);
+    return seed;
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
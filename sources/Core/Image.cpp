@@ -9,6 +9,7 @@
 #include "ImageUtils.h"
 #include "Exception.h"
 #include "PrintfUtils.h"
+#include "../Renderer/FormatTable.h"
 #include <algorithm>
 #include <string.h>
 
@@ -150,6 +151,20 @@ void Image::Resize(const Extent3D& extent, const ColorRGBAf& fillColor, const Of
     }
 }
 
+void Image::Resample(const Extent3D& extent, const ImageResampleFilter filter, bool isSRGB, unsigned threadCount)
+{
+    if (extent != GetExtent())
+    {
+        if (data_)
+        {
+            data_   = ResampleImageBuffer(GetView(), GetExtent(), extent, filter, isSRGB, threadCount);
+            extent_ = extent;
+        }
+        else
+            Resize(extent);
+    }
+}
+
 void Image::Swap(Image& rhs)
 {
     std::swap(extent_,   rhs.extent_  );
@@ -282,7 +297,7 @@ void Image::Blit(Offset3D dstRegionOffset, const Image& srcImage, Offset3D srcRe
 
 static std::size_t GetRequiredImageDataSize(const Extent3D& extent, const ImageFormat format, const DataType dataType)
 {
-    return GetMemoryFootprint(format, dataType, extent.width * extent.height * extent.depth);
+    return FormatTable::GetMemoryFootprint(format, dataType, extent.width * extent.height * extent.depth);
 }
 
 static void ValidateImageDataSize(const Extent3D& extent, const MutableImageView& imageView)
@@ -333,7 +348,8 @@ void Image::ReadPixels(const Offset3D& offset, const Extent3D& extent, const Mut
             BitBlit(
                 extent, bpp,
                 dst, dstRowStride, dstDepthStride,
-                src, srcRowStride, srcDepthStride
+                src, srcRowStride, srcDepthStride,
+                threadCount
             );
         }
         else
@@ -344,7 +360,8 @@ void Image::ReadPixels(const Offset3D& offset, const Extent3D& extent, const Mut
             BitBlit(
                 extent, bpp,
                 static_cast<char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride(),
-                src, srcRowStride, srcDepthStride
+                src, srcRowStride, srcDepthStride,
+                threadCount
             );
 
             /* Convert sub-image */
@@ -380,7 +397,8 @@ void Image::WritePixels(const Offset3D& offset, const Extent3D& extent, const Im
             BitBlit(
                 extent, bpp,
                 dst, dstRowStride, dstDepthStride,
-                src, srcRowStride, srcDepthStride
+                src, srcRowStride, srcDepthStride,
+                threadCount
             );
         }
         else
@@ -396,12 +414,20 @@ void Image::WritePixels(const Offset3D& offset, const Extent3D& extent, const Im
             BitBlit(
                 extent, bpp,
                 dst, dstRowStride, dstDepthStride,
-                static_cast<const char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride()
+                static_cast<const char*>(subImage.GetData()), subImage.GetRowStride(), subImage.GetDepthStride(),
+                threadCount
             );
         }
     }
 }
 
+DynamicByteArray Image::GenerateMipChain(const ImageMipMapFilter filter, bool isSRGB, std::uint32_t numMipLevels, unsigned threadCount) const
+{
+    if (!data_)
+        return nullptr;
+    return GenerateMipChainBuffer(GetView(), GetExtent(), 1, numMipLevels, filter, isSRGB, threadCount);
+}
+
 /* ----- Attributes ----- */
 
 ImageView Image::GetView() const
@@ -430,7 +456,7 @@ MutableImageView Image::GetMutableView()
 
 std::uint32_t Image::GetBytesPerPixel() const
 {
-    return static_cast<std::uint32_t>(GetMemoryFootprint(format_, dataType_, 1));
+    return static_cast<std::uint32_t>(FormatTable::GetMemoryFootprint(format_, dataType_, 1));
 }
 
 std::uint32_t Image::GetRowStride() const
@@ -0,0 +1,363 @@
+/*
+ * ImageConversionKernels.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ImageConversionKernels.h"
+#include "Float16Compressor.h"
+#include <LLGL/Format.h>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+
+/*
+The vectorized kernels are selected at compile time by the instruction sets the compiler targets.
+SSE2 is the baseline for x86-64 and NEON for AArch64; SSSE3 and AVX2 are only used if enabled with compiler flags, e.g. -mavx2 or /arch:AVX2.
+*/
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define LLGL_IMAGE_KERNELS_SSE2
+#   include <emmintrin.h>
+#   if defined(__SSSE3__) || defined(__AVX2__)
+#       define LLGL_IMAGE_KERNELS_SSSE3
+#       include <tmmintrin.h>
+#   endif
+#   if defined(__AVX2__)
+#       define LLGL_IMAGE_KERNELS_AVX2
+#       include <immintrin.h>
+#   endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   define LLGL_IMAGE_KERNELS_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/*
+All kernels must produce the exact same results as the generic conversion in ImageFlags.cpp for values within the normalized range [0, 1]:
+UNorm8 values are divided by 255 and floats are multiplied by 255 and truncated, which is equivalent to the double precision computation.
+Floats outside of that range are clamped, since the generic conversion is undefined for them.
+*/
+
+
+/* ----- Data type conversion kernels ----- */
+
+static void ConvertUNorm8ToFloat32(const void* src, void* dst, std::size_t count)
+{
+    const std::uint8_t* srcData = static_cast<const std::uint8_t*>(src);
+    float*              dstData = static_cast<float*>(dst);
+    std::size_t         i       = 0;
+
+    #if defined(LLGL_IMAGE_KERNELS_AVX2)
+
+    const __m256 scale = _mm256_set1_ps(255.0f);
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i v8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(srcData + i));
+        _mm256_storeu_ps(dstData + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(v8)), scale));
+    }
+
+    #elif defined(LLGL_IMAGE_KERNELS_SSE2)
+
+    const __m128    scale   = _mm_set1_ps(255.0f);
+    const __m128i   zero    = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i v8    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcData + i));
+        const __m128i lo16  = _mm_unpacklo_epi8(v8, zero);
+        const __m128i hi16  = _mm_unpackhi_epi8(v8, zero);
+        _mm_storeu_ps(dstData + i     , _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo16, zero)), scale));
+        _mm_storeu_ps(dstData + i +  4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo16, zero)), scale));
+        _mm_storeu_ps(dstData + i +  8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi16, zero)), scale));
+        _mm_storeu_ps(dstData + i + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi16, zero)), scale));
+    }
+
+    #elif defined(LLGL_IMAGE_KERNELS_NEON)
+
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t v8     = vld1q_u8(srcData + i);
+        const uint16x8_t lo16   = vmovl_u8(vget_low_u8(v8));
+        const uint16x8_t hi16   = vmovl_u8(vget_high_u8(v8));
+        vst1q_f32(dstData + i     , vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo16))), scale));
+        vst1q_f32(dstData + i +  4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo16))), scale));
+        vst1q_f32(dstData + i +  8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi16))), scale));
+        vst1q_f32(dstData + i + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi16))), scale));
+    }
+
+    #endif
+
+    for (; i < count; ++i)
+        dstData[i] = static_cast<float>(srcData[i]) / 255.0f;
+}
+
+static void ConvertFloat32ToUNorm8(const void* src, void* dst, std::size_t count)
+{
+    const float*    srcData = static_cast<const float*>(src);
+    std::uint8_t*   dstData = static_cast<std::uint8_t*>(dst);
+    std::size_t     i       = 0;
+
+    #if defined(LLGL_IMAGE_KERNELS_AVX2)
+
+    /* Packing instructions operate on 128-bit lanes, so the packed bytes have to be permuted back into order */
+    const __m256    zero        = _mm256_setzero_ps();
+    const __m256    one         = _mm256_set1_ps(1.0f);
+    const __m256    scale       = _mm256_set1_ps(255.0f);
+    const __m256i   permutation = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m256i a     = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(srcData + i    ), zero), one), scale));
+        const __m256i b     = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(srcData + i + 8), zero), one), scale));
+        const __m256i v16   = _mm256_packs_epi32(a, b);
+        const __m256i v8    = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(v16, v16), permutation);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dstData + i), _mm256_castsi256_si128(v8));
+    }
+
+    #elif defined(LLGL_IMAGE_KERNELS_SSE2)
+
+    /* _mm_max_ps returns the second operand for NaN, so NaN is converted to zero */
+    const __m128 zero   = _mm_setzero_ps();
+    const __m128 one    = _mm_set1_ps(1.0f);
+    const __m128 scale  = _mm_set1_ps(255.0f);
+    for (; i + 16 <= count; i += 16)
+    {
+        const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(srcData + i     ), zero), one), scale));
+        const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(srcData + i +  4), zero), one), scale));
+        const __m128i c = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(srcData + i +  8), zero), one), scale));
+        const __m128i d = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(srcData + i + 12), zero), one), scale));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dstData + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+
+    #elif defined(LLGL_IMAGE_KERNELS_NEON)
+
+    /* vmaxnmq_f32 returns the numeric operand for NaN, so NaN is converted to zero */
+    const float32x4_t zero  = vdupq_n_f32(0.0f);
+    const float32x4_t one   = vdupq_n_f32(1.0f);
+    const float32x4_t scale = vdupq_n_f32(255.0f);
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint32x4_t a = vcvtq_u32_f32(vmulq_f32(vminq_f32(vmaxnmq_f32(vld1q_f32(srcData + i     ), zero), one), scale));
+        const uint32x4_t b = vcvtq_u32_f32(vmulq_f32(vminq_f32(vmaxnmq_f32(vld1q_f32(srcData + i +  4), zero), one), scale));
+        const uint32x4_t c = vcvtq_u32_f32(vmulq_f32(vminq_f32(vmaxnmq_f32(vld1q_f32(srcData + i +  8), zero), one), scale));
+        const uint32x4_t d = vcvtq_u32_f32(vmulq_f32(vminq_f32(vmaxnmq_f32(vld1q_f32(srcData + i + 12), zero), one), scale));
+        const uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+        const uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+        vst1q_u8(dstData + i, vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+    }
+
+    #endif
+
+    for (; i < count; ++i)
+    {
+        const float value = std::max(0.0f, std::min(srcData[i], 1.0f));
+        dstData[i] = static_cast<std::uint8_t>(value * 255.0f);
+    }
+}
+
+static void ConvertFloat32ToFloat16(const void* src, void* dst, std::size_t count)
+{
+    CompressFloat16Array(static_cast<const float*>(src), static_cast<std::uint16_t*>(dst), count);
+}
+
+static void ConvertFloat16ToFloat32(const void* src, void* dst, std::size_t count)
+{
+    DecompressFloat16Array(static_cast<const std::uint16_t*>(src), static_cast<float*>(dst), count);
+}
+
+
+/* ----- Format conversion kernels ----- */
+
+// Converts between RGBA and BGRA with 8-bit components, i.e. swaps the first and third component of each pixel.
+static void ConvertUInt8SwapRB4(const void* src, void* dst, std::size_t count)
+{
+    const std::uint8_t* srcData = static_cast<const std::uint8_t*>(src);
+    std::uint8_t*       dstData = static_cast<std::uint8_t*>(dst);
+    std::size_t         i       = 0;
+
+    #if defined(LLGL_IMAGE_KERNELS_SSE2)
+
+    /* Keep green and alpha, and rotate red and blue by 16 bits within each 32-bit pixel */
+    const __m128i maskGA = _mm_set1_epi32(static_cast<std::int32_t>(0xFF00FF00u));
+    const __m128i maskRB = _mm_set1_epi32(0x00FF00FF);
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i v     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcData + i*4));
+        const __m128i rb    = _mm_and_si128(v, maskRB);
+        const __m128i br    = _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dstData + i*4), _mm_or_si128(_mm_and_si128(v, maskGA), br));
+    }
+
+    #elif defined(LLGL_IMAGE_KERNELS_NEON)
+
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t v = vld4q_u8(srcData + i*4);
+        std::swap(v.val[0], v.val[2]);
+        vst4q_u8(dstData + i*4, v);
+    }
+
+    #endif
+
+    for (; i < count; ++i)
+    {
+        dstData[i*4    ] = srcData[i*4 + 2];
+        dstData[i*4 + 1] = srcData[i*4 + 1];
+        dstData[i*4 + 2] = srcData[i*4    ];
+        dstData[i*4 + 3] = srcData[i*4 + 3];
+    }
+}
+
+// Converts RGB to RGBA or BGR to BGRA with 8-bit components. Alpha is set to its maximum like in the generic conversion.
+template <bool SwapRB>
+void ConvertUInt8Pad3To4(const void* src, void* dst, std::size_t count)
+{
+    const std::uint8_t* srcData = static_cast<const std::uint8_t*>(src);
+    std::uint8_t*       dstData = static_cast<std::uint8_t*>(dst);
+    std::size_t         i       = 0;
+
+    #if defined(LLGL_IMAGE_KERNELS_SSSE3)
+
+    /* Shuffle 4 pixels from each 16 byte load; the loop condition ensures the load does not read beyond the last pixel */
+    const __m128i shuffle = (SwapRB
+        ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8,  7, 6, -1, 11, 10,  9, -1)
+        : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6,  7, 8, -1,  9, 10, 11, -1)
+    );
+    const __m128i alpha = _mm_set1_epi32(static_cast<std::int32_t>(0xFF000000u));
+    for (; i + 6 <= count; i += 4)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcData + i*3));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dstData + i*4), _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alpha));
+    }
+
+    #elif defined(LLGL_IMAGE_KERNELS_NEON)
+
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16x3_t v = vld3q_u8(srcData + i*3);
+        uint8x16x4_t p;
+        {
+            p.val[0] = (SwapRB ? v.val[2] : v.val[0]);
+            p.val[1] = v.val[1];
+            p.val[2] = (SwapRB ? v.val[0] : v.val[2]);
+            p.val[3] = vdupq_n_u8(0xFF);
+        }
+        vst4q_u8(dstData + i*4, p);
+    }
+
+    #endif
+
+    for (; i < count; ++i)
+    {
+        dstData[i*4    ] = srcData[i*3 + (SwapRB ? 2 : 0)];
+        dstData[i*4 + 1] = srcData[i*3 + 1];
+        dstData[i*4 + 2] = srcData[i*3 + (SwapRB ? 0 : 2)];
+        dstData[i*4 + 3] = 0xFF;
+    }
+}
+
+// Converts RGB to RGBA or BGR to BGRA with 32-bit float components. Alpha is set to 1 like in the generic conversion.
+static void ConvertFloat32Pad3To4(const void* src, void* dst, std::size_t count)
+{
+    const float*    srcData = static_cast<const float*>(src);
+    float*          dstData = static_cast<float*>(dst);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        dstData[i*4    ] = srcData[i*3    ];
+        dstData[i*4 + 1] = srcData[i*3 + 1];
+        dstData[i*4 + 2] = srcData[i*3 + 2];
+        dstData[i*4 + 3] = 1.0f;
+    }
+}
+
+
+/* ----- Kernel tables ----- */
+
+static constexpr std::size_t g_numDataTypes     = static_cast<std::size_t>(DataType::Float64) + 1;
+static constexpr std::size_t g_numColorFormats  = static_cast<std::size_t>(ImageFormat::ABGR) + 1;
+
+// Data type conversion kernels indexed by [srcDataType][dstDataType]
+static const ImageConversionKernel g_dataTypeKernels[g_numDataTypes][g_numDataTypes] =
+{
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr }, // Undefined
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr }, // Int8
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 ConvertUNorm8ToFloat32,  nullptr }, // UInt8
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr }, // Int16
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr }, // UInt16
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr }, // Int32
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr }, // UInt32
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 ConvertFloat16ToFloat32, nullptr }, // Float16
+    { nullptr,                 nullptr,                 ConvertFloat32ToUNorm8,  nullptr,                 nullptr,                 nullptr,                 nullptr,                 ConvertFloat32ToFloat16, nullptr,                 nullptr }, // Float32
+    { nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr,                 nullptr }, // Float64
+};
+
+// Format conversion kernels for 8-bit components indexed by [srcFormat][dstFormat] for all color formats
+static const ImageConversionKernel g_formatKernelsUInt8[g_numColorFormats][g_numColorFormats] =
+{
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr }, // Alpha
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr }, // R
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr }, // RG
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    ConvertUInt8Pad3To4<false>, ConvertUInt8Pad3To4<true>,  nullptr,                    nullptr }, // RGB
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    ConvertUInt8Pad3To4<true>,  ConvertUInt8Pad3To4<false>, nullptr,                    nullptr }, // BGR
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    ConvertUInt8SwapRB4,        nullptr,                    nullptr }, // RGBA
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    ConvertUInt8SwapRB4,        nullptr,                    nullptr,                    nullptr }, // BGRA
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr }, // ARGB
+    { nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr,                    nullptr }, // ABGR
+};
+
+// Format conversion kernels for 32-bit float components indexed by [srcFormat][dstFormat] for all color formats
+static const ImageConversionKernel g_formatKernelsFloat32[g_numColorFormats][g_numColorFormats] =
+{
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr }, // Alpha
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr }, // R
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr }, // RG
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                ConvertFloat32Pad3To4,  nullptr,                nullptr,                nullptr }, // RGB
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                ConvertFloat32Pad3To4,  nullptr,                nullptr }, // BGR
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr }, // RGBA
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr }, // BGRA
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr }, // ARGB
+    { nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr,                nullptr }, // ABGR
+};
+
+
+/* ----- Functions ----- */
+
+ImageConversionKernel FindImageDataTypeConversionKernel(ImageFormat format, DataType srcDataType, DataType dstDataType)
+{
+    /* Data type kernels operate on individual components, so they do not depend on the color format, but depth-stencil and compressed formats are excluded */
+    if (static_cast<std::size_t>(format) >= g_numColorFormats)
+        return nullptr;
+
+    const std::size_t srcIndex = static_cast<std::size_t>(srcDataType);
+    const std::size_t dstIndex = static_cast<std::size_t>(dstDataType);
+    if (srcIndex < g_numDataTypes && dstIndex < g_numDataTypes)
+        return g_dataTypeKernels[srcIndex][dstIndex];
+
+    return nullptr;
+}
+
+ImageConversionKernel FindImageFormatConversionKernel(ImageFormat srcFormat, ImageFormat dstFormat, DataType dataType)
+{
+    const std::size_t srcIndex = static_cast<std::size_t>(srcFormat);
+    const std::size_t dstIndex = static_cast<std::size_t>(dstFormat);
+    if (srcIndex < g_numColorFormats && dstIndex < g_numColorFormats)
+    {
+        if (dataType == DataType::UInt8)
+            return g_formatKernelsUInt8[srcIndex][dstIndex];
+        if (dataType == DataType::Float32)
+            return g_formatKernelsFloat32[srcIndex][dstIndex];
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,42 @@
+/*
+ * ImageConversionKernels.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_IMAGE_CONVERSION_KERNELS_H
+#define LLGL_IMAGE_CONVERSION_KERNELS_H
+
+
+#include <LLGL/ImageFlags.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Kernel function to convert a contiguous run of image data. The meaning of 'count' depends on the kind of kernel:
+For data type conversions it is the number of components, for format conversions it is the number of pixels.
+*/
+using ImageConversionKernel = void (*)(const void* src, void* dst, std::size_t count);
+
+/* ----- Functions ----- */
+
+// Returns the kernel to convert the data type of images with the specified format, or null if there is no fast path for this combination.
+ImageConversionKernel FindImageDataTypeConversionKernel(ImageFormat format, DataType srcDataType, DataType dstDataType);
+
+// Returns the kernel to convert between the specified image formats with the same data type, or null if there is no fast path for this combination.
+ImageConversionKernel FindImageFormatConversionKernel(ImageFormat srcFormat, ImageFormat dstFormat, DataType dataType);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
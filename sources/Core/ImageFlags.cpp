@@ -18,6 +18,11 @@
 #include "../Core/Threading.h"
 #include "Float16Compressor.h"
 #include "BCDecompressor.h"
+#include "BCCompressor.h"
+#include "ETCDecompressor.h"
+#include "ETCCompressor.h"
+#include "ImageConversionKernels.h"
+#include "../Renderer/FormatTable.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -106,7 +111,7 @@ struct ImageMemoryInfo
 
 static void GetImageMemoryInfo(ImageMemoryInfo& outInfo, const ImageView& imageView, const Extent3D& extent)
 {
-    outInfo.rowSize     = static_cast<std::uint32_t>(GetMemoryFootprint(imageView.format, imageView.dataType, extent.width));
+    outInfo.rowSize     = static_cast<std::uint32_t>(FormatTable::GetMemoryFootprint(imageView.format, imageView.dataType, extent.width));
     outInfo.rowStride   = std::max<std::uint32_t>(imageView.rowStride, outInfo.rowSize);
 
     outInfo.layerSize   = (extent.height > 0 ? outInfo.rowStride * (extent.height - 1) + outInfo.rowSize : 0);
@@ -117,7 +122,7 @@ static void GetImageMemoryInfo(ImageMemoryInfo& outInfo, const ImageView& imageV
 
 static void GetImageMemoryInfo(ImageMemoryInfo& outInfo, const MutableImageView& imageView, const Extent3D& extent)
 {
-    outInfo.rowSize     = static_cast<std::uint32_t>(GetMemoryFootprint(imageView.format, imageView.dataType, extent.width));
+    outInfo.rowSize     = static_cast<std::uint32_t>(FormatTable::GetMemoryFootprint(imageView.format, imageView.dataType, extent.width));
     //outInfo.rowStride   = std::max<std::uint32_t>(imageView.rowStride, outInfo.rowSize);
     outInfo.rowStride   = outInfo.rowSize;
 
@@ -274,6 +279,64 @@ static void WriteNormalizedTypedVariant(DataType dstDataType, VariantBuffer& dst
     }
 }
 
+// Worker thread procedure to convert an image with a fast path kernel, which is invoked for each contiguous run of pixels within a row
+static void ConvertImageBufferWithKernelWorker(
+    ImageConversionKernel           kernel,
+    const ImageView&                srcImageView,
+    const MutableImageView&         dstImageView,
+    const ImageOperationMemoryInfo& memoryInfo,
+    const Extent3D&                 extent,
+    std::size_t                     kernelCountPerPixel,
+    std::size_t                     idxBegin,
+    std::size_t                     idxEnd)
+{
+    const std::size_t srcPixelSize  = FormatTable::GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1);
+    const std::size_t dstPixelSize  = FormatTable::GetMemoryFootprint(dstImageView.format, dstImageView.dataType, 1);
+    const std::uint32_t layerSize   = extent.width * extent.height;
+
+    VariantConstBuffer  srcBuffer = srcImageView.data;
+    VariantBuffer       dstBuffer = dstImageView.data;
+
+    ApplyPaddingOffset(srcBuffer, dstBuffer, idxBegin, memoryInfo, extent);
+
+    for (std::size_t i = idxBegin; i < idxEnd;)
+    {
+        /* Apply source and destination stride when passing an edge */
+        AdvancePaddingOffsetAtEdge(srcBuffer, dstBuffer, i, idxBegin, memoryInfo, extent.width, layerSize);
+
+        /* Convert remaining pixels of the current row at once */
+        const std::size_t rowEnd = std::min<std::size_t>(idxEnd, (i / extent.width + 1) * extent.width);
+        kernel(srcBuffer.int8 + i * srcPixelSize, dstBuffer.int8 + i * dstPixelSize, (rowEnd - i) * kernelCountPerPixel);
+        i = rowEnd;
+    }
+}
+
+static void ConvertImageBufferWithKernel(
+    ImageConversionKernel           kernel,
+    const ImageView&                srcImageView,
+    const MutableImageView&         dstImageView,
+    const ImageOperationMemoryInfo& memoryInfo,
+    const Extent3D&                 extent,
+    std::size_t                     kernelCountPerPixel,
+    unsigned                        threadCount)
+{
+    DoConcurrentRange(
+        std::bind(
+            ConvertImageBufferWithKernelWorker,
+            kernel,
+            std::cref(srcImageView),
+            std::cref(dstImageView),
+            std::cref(memoryInfo),
+            std::cref(extent),
+            kernelCountPerPixel,
+            std::placeholders::_1,
+            std::placeholders::_2
+        ),
+        extent.width * extent.height * extent.depth,
+        threadCount
+    );
+}
+
 // Worker thread procedure for the "ConvertImageBufferDataType" function
 static void ConvertImageBufferDataTypeWorker(
     const ImageView&                srcImageView,
@@ -283,7 +346,7 @@ static void ConvertImageBufferDataTypeWorker(
     std::size_t                     idxBegin,
     std::size_t                     idxEnd)
 {
-    const std::uint32_t numComponents           = ImageFormatSize(srcImageView.format);
+    const std::uint32_t numComponents           = FormatTable::ImageFormatSize(srcImageView.format);
     const std::uint32_t numComponentsPerRow     = extent.width * numComponents;
     const std::uint32_t numComponentsPerLayer   = extent.height * numComponentsPerRow;
 
@@ -328,6 +391,13 @@ static std::size_t ConvertImageBufferDataType(
         memoryInfo.dstImageSize, dstImageView.dataSize
     );
 
+    /* Use fast path for common data type conversions */
+    if (ImageConversionKernel kernel = FindImageDataTypeConversionKernel(srcImageView.format, srcImageView.dataType, dstImageView.dataType))
+    {
+        ConvertImageBufferWithKernel(kernel, srcImageView, dstImageView, memoryInfo, extent, FormatTable::ImageFormatSize(srcImageView.format), threadCount);
+        return memoryInfo.dstImageSize;
+    }
+
     /* Get variant buffer for source and destination images */
     DoConcurrentRange(
         std::bind(
@@ -610,7 +680,7 @@ static void ConvertImageBufferFormatWorker(
 
     const std::uint32_t layerSize = extent.width * extent.height;
 
-    if (IsDepthOrStencilFormat(srcImageView.format))
+    if (FormatTable::IsDepthOrStencilFormat(srcImageView.format))
     {
         /* Initialize default depth-stencil value (0, 0) */
         DepthStencilValue depthStencilValue{ 0.0f, 0u };
@@ -657,7 +727,7 @@ static std::size_t ConvertImageBufferFormat(
     const Extent3D&         extent,
     unsigned                threadCount)
 {
-    LLGL_ASSERT(IsDepthOrStencilFormat(srcImageView.format) || srcImageView.dataType == dstImageView.dataType);
+    LLGL_ASSERT(FormatTable::IsDepthOrStencilFormat(srcImageView.format) || srcImageView.dataType == dstImageView.dataType);
 
     /* Validate destination buffer size */
     const std::size_t numPixels = extent.width * extent.height * extent.depth;
@@ -671,6 +741,13 @@ static std::size_t ConvertImageBufferFormat(
         memoryInfo.dstImageSize, dstImageView.dataSize
     );
 
+    /* Use fast path for common format conversions */
+    if (ImageConversionKernel kernel = FindImageFormatConversionKernel(srcImageView.format, dstImageView.format, srcImageView.dataType))
+    {
+        ConvertImageBufferWithKernel(kernel, srcImageView, dstImageView, memoryInfo, extent, 1, threadCount);
+        return memoryInfo.dstImageSize;
+    }
+
     /* Get variant buffer for source and destination images */
     DoConcurrentRange(
         std::bind(
@@ -692,7 +769,7 @@ static std::size_t ConvertImageBufferFormat(
 static void ValidateSourceImageView(const ImageView& imageView)
 {
     LLGL_ASSERT_PTR(imageView.data);
-    const std::size_t dataTypeSize = GetMemoryFootprint(imageView.format, imageView.dataType, 1);
+    const std::size_t dataTypeSize = FormatTable::GetMemoryFootprint(imageView.format, imageView.dataType, 1);
     LLGL_ASSERT(dataTypeSize > 0, "source image data type size must be greater than zero");
     LLGL_ASSERT(imageView.dataSize % dataTypeSize == 0, "source image data size is not a multiple of the source data type size");
 }
@@ -700,7 +777,7 @@ static void ValidateSourceImageView(const ImageView& imageView)
 static void ValidateDestinationImageView(const MutableImageView& imageView)
 {
     LLGL_ASSERT_PTR(imageView.data);
-    const std::size_t dataTypeSize = GetMemoryFootprint(imageView.format, imageView.dataType, 1);
+    const std::size_t dataTypeSize = FormatTable::GetMemoryFootprint(imageView.format, imageView.dataType, 1);
     LLGL_ASSERT(dataTypeSize > 0, "destination image data type size must be greater than zero");
     LLGL_ASSERT(imageView.dataSize % dataTypeSize == 0, "destination image data size is not a multiple of the source data type size");
 }
@@ -712,7 +789,7 @@ static void ValidateImageConversionParams(
 {
     if (IsCompressedFormat(srcImageView.format) || IsCompressedFormat(dstFormat))
         LLGL_TRAP("cannot convert compressed image formats");
-    if (IsDepthOrStencilFormat(srcImageView.format) != IsDepthOrStencilFormat(dstFormat))
+    if (FormatTable::IsDepthOrStencilFormat(srcImageView.format) != FormatTable::IsDepthOrStencilFormat(dstFormat))
         LLGL_TRAP("cannot convert between depth-stencil and non-depth-stencil image formats");
     if (dstDataType < DataType::Int8 || dstDataType > DataType::Float64)
         LLGL_TRAP("invalid value for destination data type: 0x%08X", static_cast<unsigned>(dstDataType));
@@ -733,7 +810,7 @@ LLGL_EXPORT std::size_t ConvertImageBuffer(
     ValidateDestinationImageView(dstImageView);
     ValidateImageConversionParams(srcImageView, dstImageView.format, dstImageView.dataType);
 
-    if (IsDepthOrStencilFormat(srcImageView.format))
+    if (FormatTable::IsDepthOrStencilFormat(srcImageView.format))
     {
         /* Convert depth-stencil image format */
         return ConvertImageBufferFormat(srcImageView, dstImageView, extent, threadCount);
@@ -742,7 +819,7 @@ LLGL_EXPORT std::size_t ConvertImageBuffer(
     {
         /* Convert image data type with intermediate buffer */
         const std::size_t   numPixels               = extent.width * extent.height * extent.depth;
-        const std::size_t   intermediateBufferSize  = GetMemoryFootprint(srcImageView.format, dstImageView.dataType, numPixels);
+        const std::size_t   intermediateBufferSize  = FormatTable::GetMemoryFootprint(srcImageView.format, dstImageView.dataType, numPixels);
         DynamicByteArray    intermediateBuffer      = DynamicByteArray{ intermediateBufferSize, UninitializeTag{} };
 
         const MutableImageView intermediateDstImageView
@@ -780,7 +857,7 @@ LLGL_EXPORT std::size_t ConvertImageBuffer(
     else if (srcImageView.rowStride != 0)
     {
         /* Only blit data with different strides */
-        const std::uint32_t bpp = ImageFormatSize(srcImageView.format) * DataTypeSize(srcImageView.dataType);
+        const std::uint32_t bpp = FormatTable::ImageFormatSize(srcImageView.format) * FormatTable::DataTypeSize(srcImageView.dataType);
         if (srcImageView.rowStride > extent.width * bpp)
         {
             BitBlit(
@@ -802,7 +879,7 @@ LLGL_EXPORT std::size_t ConvertImageBuffer(
     if (copyUnchangedImage)
     {
         const std::size_t numPixels = (extent.width * extent.height * extent.depth);
-        const std::size_t requiredImageSize = GetMemoryFootprint(dstImageView.format, dstImageView.dataType, numPixels);
+        const std::size_t requiredImageSize = FormatTable::GetMemoryFootprint(dstImageView.format, dstImageView.dataType, numPixels);
         LLGL_ASSERT(
             dstImageView.dataSize >= requiredImageSize,
             "dstImageView.dataSize must be at least %zu, but %zu was specified",
@@ -831,7 +908,7 @@ LLGL_EXPORT std::size_t ConvertImageBuffer(
         "parameter 'srcImageView.rowStride' must be zero for this version of ConvertImageBuffer()"
     );
 
-    const std::size_t bpp = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1);
+    const std::size_t bpp = FormatTable::GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1);
     LLGL_ASSERT(
         bpp > 0,
         "cannot determine bytes per pixel format image format (%d) and data type (%d)",
@@ -862,7 +939,7 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
 
     /* Initialize destination image descriptor */
     const std::size_t numPixels     = extent.width * extent.height * extent.depth;
-    const std::size_t dstImageSize  = GetMemoryFootprint(dstFormat, dstDataType, numPixels);
+    const std::size_t dstImageSize  = FormatTable::GetMemoryFootprint(dstFormat, dstDataType, numPixels);
 
     DynamicByteArray dstImage{ dstImageSize, UninitializeTag{} };
     const MutableImageView dstImageView{ dstFormat, dstDataType, dstImage.get(), dstImageSize };
@@ -880,7 +957,7 @@ LLGL_EXPORT DynamicByteArray ConvertImageBuffer(
     unsigned            threadCount)
 {
     LLGL_ASSERT(srcImageView.rowStride == 0, "parameter 'srcImageView.rowStride' must be zero for this version of ConvertImageBuffer()");
-    const std::size_t bytesPerPixel = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1);
+    const std::size_t bytesPerPixel = FormatTable::GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1);
     LLGL_ASSERT(bytesPerPixel > 0, "image format and data type not suitable for byte size per pixel");
     const Extent3D extent1D{ static_cast<std::uint32_t>(srcImageView.dataSize / bytesPerPixel), 1u, 1u };
     return ConvertImageBuffer(srcImageView, dstFormat, dstDataType, extent1D, threadCount);
@@ -915,12 +992,90 @@ LLGL_EXPORT DynamicByteArray DecompressImageBufferToRGBA8UNorm(
     if (threadCount == LLGL_MAX_THREAD_COUNT)
         threadCount = std::thread::hardware_concurrency();
 
-    /* Check for BC compression */
+    const char*         data        = static_cast<const char*>(srcImageView.data);
+    const std::size_t   dataSize    = srcImageView.dataSize;
+
+    /* Check for BC and ETC compression */
+    switch (compressedFormat)
+    {
+        case Format::BC1UNorm:
+        case Format::BC1UNorm_sRGB:
+            return DecompressBC1ToRGBA8UNorm(extent, data, dataSize, threadCount);
+        case Format::BC2UNorm:
+        case Format::BC2UNorm_sRGB:
+            return DecompressBC2ToRGBA8UNorm(extent, data, dataSize, threadCount);
+        case Format::BC3UNorm:
+        case Format::BC3UNorm_sRGB:
+            return DecompressBC3ToRGBA8UNorm(extent, data, dataSize, threadCount);
+        case Format::BC4UNorm:
+            return DecompressBC4ToRGBA8UNorm(extent, data, dataSize, false, threadCount);
+        case Format::BC4SNorm:
+            return DecompressBC4ToRGBA8UNorm(extent, data, dataSize, true, threadCount);
+        case Format::BC5UNorm:
+            return DecompressBC5ToRGBA8UNorm(extent, data, dataSize, false, threadCount);
+        case Format::BC5SNorm:
+            return DecompressBC5ToRGBA8UNorm(extent, data, dataSize, true, threadCount);
+        case Format::BC7UNorm:
+        case Format::BC7UNorm_sRGB:
+            return DecompressBC7ToRGBA8UNorm(extent, data, dataSize, threadCount);
+        case Format::ETC1UNorm:
+        case Format::ETC2UNorm:
+        case Format::ETC2UNorm_sRGB:
+            return DecompressETC2ToRGBA8UNorm(extent, data, dataSize, threadCount);
+        case Format::ETC2A1UNorm:
+        case Format::ETC2A1UNorm_sRGB:
+            return DecompressETC2A1ToRGBA8UNorm(extent, data, dataSize, threadCount);
+        case Format::ETC2A8UNorm:
+        case Format::ETC2A8UNorm_sRGB:
+            return DecompressETC2A8ToRGBA8UNorm(extent, data, dataSize, threadCount);
+        case Format::EACR11UNorm:
+            return DecompressEACR11ToRGBA8UNorm(extent, data, dataSize, false, threadCount);
+        case Format::EACR11SNorm:
+            return DecompressEACR11ToRGBA8UNorm(extent, data, dataSize, true, threadCount);
+        case Format::EACRG11UNorm:
+            return DecompressEACRG11ToRGBA8UNorm(extent, data, dataSize, false, threadCount);
+        case Format::EACRG11SNorm:
+            return DecompressEACRG11ToRGBA8UNorm(extent, data, dataSize, true, threadCount);
+        default:
+            return nullptr;
+    }
+}
+
+LLGL_EXPORT DynamicByteArray CompressImageBufferFromRGBA8UNorm(
+    Format                  compressedFormat,
+    const ImageView&        srcImageView,
+    const Extent2D&         extent,
+    ImageCompressionQuality quality,
+    unsigned                threadCount)
+{
+    /* Only RGBA8UNorm is supported as source format */
+    if (srcImageView.format != ImageFormat::RGBA || srcImageView.dataType != DataType::UInt8)
+        return nullptr;
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    const void*         data        = srcImageView.data;
+    const std::size_t   dataSize    = srcImageView.dataSize;
+    const std::size_t   rowStride   = srcImageView.rowStride;
+
+    /* Check for BC and ETC compression */
     switch (compressedFormat)
     {
         case Format::BC1UNorm:
         case Format::BC1UNorm_sRGB:
-            return DecompressBC1ToRGBA8UNorm(extent, static_cast<const char*>(srcImageView.data), srcImageView.dataSize, threadCount);
+            return CompressRGBA8UNormToBC1(extent, data, dataSize, rowStride, quality, threadCount);
+        case Format::BC3UNorm:
+        case Format::BC3UNorm_sRGB:
+            return CompressRGBA8UNormToBC3(extent, data, dataSize, rowStride, quality, threadCount);
+        case Format::BC4UNorm:
+            return CompressRGBA8UNormToBC4(extent, data, dataSize, rowStride, quality, threadCount);
+        case Format::BC5UNorm:
+            return CompressRGBA8UNormToBC5(extent, data, dataSize, rowStride, quality, threadCount);
+        case Format::ETC1UNorm:
+        case Format::ETC2UNorm:
+        case Format::ETC2UNorm_sRGB:
+            return CompressRGBA8UNormToETC1(extent, data, dataSize, rowStride, quality, threadCount);
         default:
             return nullptr;
     }
@@ -965,7 +1120,8 @@ LLGL_EXPORT void CopyImageBufferRegion(
     const Offset3D&         srcOffset,
     std::uint32_t           srcRowStride,
     std::uint32_t           srcLayerStride,
-    const Extent3D&         extent)
+    const Extent3D&         extent,
+    unsigned                threadCount)
 {
     /* Validate input parameters */
     ValidateSourceImageView(srcImageView);
@@ -976,7 +1132,7 @@ LLGL_EXPORT void CopyImageBufferRegion(
         "LLGL::CopyImageBufferRegion() only supports source and destination buffers of equal format and type"
     );
 
-    const std::uint32_t bpp = static_cast<std::uint32_t>(GetMemoryFootprint(dstImageView.format, dstImageView.dataType, 1));
+    const std::uint32_t bpp = static_cast<std::uint32_t>(FormatTable::GetMemoryFootprint(dstImageView.format, dstImageView.dataType, 1));
 
     /* Validate destination image boundaries */
     const std::size_t dstPos    = GetFlattenedImageBufferPos(dstOffset.x, dstOffset.y, dstOffset.z, dstRowStride, dstLayerStride, bpp);
@@ -1005,7 +1161,8 @@ LLGL_EXPORT void CopyImageBufferRegion(
         dstLayerStride * bpp,
         (static_cast<const char*>(srcImageView.data) + srcPos),
         srcRowStride * bpp,
-        srcLayerStride * bpp
+        srcLayerStride * bpp,
+        threadCount
     );
 }
 
@@ -1035,7 +1192,7 @@ LLGL_EXPORT DynamicByteArray GenerateImageBuffer(
     WriteRGBAFormattedVariant(format, dataType, fillBuffer1, 0, fillColor1);
 
     /* Allocate image buffer */
-    const std::size_t   bytesPerPixel   = GetMemoryFootprint(format, dataType, 1);
+    const std::size_t   bytesPerPixel   = FormatTable::GetMemoryFootprint(format, dataType, 1);
     DynamicByteArray    imageBuffer     = DynamicByteArray{ bytesPerPixel * imageSize, UninitializeTag{} };
 
     /* Initialize image buffer with fill color */
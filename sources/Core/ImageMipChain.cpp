@@ -0,0 +1,588 @@
+/*
+ * ImageMipChain.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/ImageFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include "Threading.h"
+#include "../Renderer/FormatTable.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+/*
+The row accumulation is vectorized with the instruction set the compiler targets; SSE2 is the baseline for x86-64 and NEON for AArch64.
+*/
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define LLGL_MIP_CHAIN_SSE2
+#   include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#   define LLGL_MIP_CHAIN_NEON
+#   include <arm_neon.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+/* ----- Internal constants ----- */
+
+// Width (in destination texels) and shape parameter of the Kaiser-windowed sinc filter.
+static constexpr double g_kaiserFilterWidth = 3.0;
+static constexpr double g_kaiserFilterAlpha = 4.0;
+
+// Parameters B and C of the Mitchell-Netravali filter as recommended by Mitchell and Netravali.
+static constexpr double g_mitchellFilterB   = 1.0 / 3.0;
+static constexpr double g_mitchellFilterC   = 1.0 / 3.0;
+
+// Minimum number of filtered rows each worker thread processes.
+static constexpr unsigned g_mipFilterMinWorkSize = 64;
+
+
+/* ----- Internal structures ----- */
+
+// Filter taps to resample one axis of an image; each destination texel has the same number of taps.
+struct MipFilterKernel
+{
+    std::uint32_t               numTaps = 0;
+    std::vector<std::uint32_t>  indices;
+    std::vector<float>          weights;
+};
+
+
+/* ----- Internal functions ----- */
+
+// Returns the modified Bessel function of the first kind of order zero.
+static double BesselI0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 64 && term > sum * 1.0e-12; ++k)
+    {
+        const double t = x / (2.0 * k);
+        term *= t * t;
+        sum += term;
+    }
+    return sum;
+}
+
+static double Sinc(double x)
+{
+    if (std::abs(x) < 1.0e-6)
+        return 1.0;
+    const double pi = 3.14159265358979323846;
+    return std::sin(pi * x) / (pi * x);
+}
+
+// Evaluates the Kaiser-windowed sinc filter at the specified position (in destination texels).
+static double EvaluateKaiserFilter(double x)
+{
+    const double t = x / g_kaiserFilterWidth;
+    if (t <= -1.0 || t >= 1.0)
+        return 0.0;
+    return Sinc(x) * BesselI0(g_kaiserFilterAlpha * std::sqrt(1.0 - t * t)) / BesselI0(g_kaiserFilterAlpha);
+}
+
+// Evaluates the tent filter at the specified position, which results in bilinear filtering for both axes.
+static double EvaluateTentFilter(double x)
+{
+    x = std::abs(x);
+    return (x < 1.0 ? 1.0 - x : 0.0);
+}
+
+// Evaluates the Mitchell-Netravali cubic filter at the specified position.
+static double EvaluateMitchellFilter(double x)
+{
+    constexpr double b = g_mitchellFilterB;
+    constexpr double c = g_mitchellFilterC;
+
+    x = std::abs(x);
+    const double x2 = x * x;
+    const double x3 = x2 * x;
+
+    if (x < 1.0)
+        return ((12.0 - 9.0*b - 6.0*c) * x3 + (-18.0 + 12.0*b + 6.0*c) * x2 + (6.0 - 2.0*b)) / 6.0;
+    if (x < 2.0)
+        return ((-b - 6.0*c) * x3 + (6.0*b + 30.0*c) * x2 + (-12.0*b - 48.0*c) * x + (8.0*b + 24.0*c)) / 6.0;
+    return 0.0;
+}
+
+// Evaluates the Lanczos filter with 3 lobes at the specified position.
+static double EvaluateLanczos3Filter(double x)
+{
+    if (std::abs(x) >= 3.0)
+        return 0.0;
+    return Sinc(x) * Sinc(x / 3.0);
+}
+
+// Returns the radius of the specified filter in units of the filtered axis, i.e. destination texels for downsampling and source texels for upsampling.
+static double GetFilterRadius(ImageResampleFilter filter)
+{
+    switch (filter)
+    {
+        case ImageResampleFilter::Box:      return 0.5;
+        case ImageResampleFilter::Bilinear: return 1.0;
+        case ImageResampleFilter::Mitchell: return 2.0;
+        case ImageResampleFilter::Lanczos3: return 3.0;
+        case ImageResampleFilter::Kaiser:   return g_kaiserFilterWidth;
+        default:                            return 0.5;
+    }
+}
+
+static double EvaluateFilter(ImageResampleFilter filter, double x)
+{
+    switch (filter)
+    {
+        case ImageResampleFilter::Bilinear: return EvaluateTentFilter(x);
+        case ImageResampleFilter::Mitchell: return EvaluateMitchellFilter(x);
+        case ImageResampleFilter::Lanczos3: return EvaluateLanczos3Filter(x);
+        case ImageResampleFilter::Kaiser:   return EvaluateKaiserFilter(x);
+        default:                            return 0.0;
+    }
+}
+
+static ImageResampleFilter ToResampleFilter(ImageMipMapFilter filter)
+{
+    return (filter == ImageMipMapFilter::Kaiser ? ImageResampleFilter::Kaiser : ImageResampleFilter::Box);
+}
+
+static void BuildFilterKernel(MipFilterKernel& kernel, std::uint32_t srcSize, std::uint32_t dstSize, ImageResampleFilter filter)
+{
+    /* The filter is stretched over the source texels when downsampling, but keeps its size when upsampling */
+    const double scale          = static_cast<double>(srcSize) / static_cast<double>(dstSize);
+    const double filterScale    = std::max(scale, 1.0);
+    const double radius         = GetFilterRadius(filter) * filterScale;
+
+    /* Determine the maximum number of source texels within the filter support of each destination texel */
+    kernel.numTaps = 0;
+    for_range(i, dstSize)
+    {
+        const double center = (static_cast<double>(i) + 0.5) * scale;
+        const long   first  = static_cast<long>(std::floor(center - radius));
+        const long   last   = static_cast<long>(std::ceil(center + radius)) - 1;
+        kernel.numTaps = std::max(kernel.numTaps, static_cast<std::uint32_t>(last - first + 1));
+    }
+
+    kernel.indices.resize(dstSize * kernel.numTaps);
+    kernel.weights.resize(dstSize * kernel.numTaps);
+
+    std::vector<double> tapWeights(kernel.numTaps);
+
+    for_range(i, dstSize)
+    {
+        const double    center  = (static_cast<double>(i) + 0.5) * scale;
+        const long      first   = static_cast<long>(std::floor(center - radius));
+
+        std::uint32_t*  indices = &(kernel.indices[i * kernel.numTaps]);
+        float*          weights = &(kernel.weights[i * kernel.numTaps]);
+        double          sum     = 0.0;
+
+        for_range(j, kernel.numTaps)
+        {
+            const long      srcIndex    = first + static_cast<long>(j);
+            const double    texelBegin  = static_cast<double>(srcIndex);
+            double          weight      = 0.0;
+
+            if (filter == ImageResampleFilter::Box)
+                weight = std::max(0.0, std::min(texelBegin + 1.0, center + radius) - std::max(texelBegin, center - radius));
+            else
+                weight = EvaluateFilter(filter, (texelBegin + 0.5 - center) / filterScale);
+
+            /* Clamp source texels at the image border */
+            indices[j]      = static_cast<std::uint32_t>(std::max(0L, std::min(srcIndex, static_cast<long>(srcSize) - 1)));
+            tapWeights[j]   = weight;
+            sum += weight;
+        }
+
+        /* Normalize weights, so a constant image remains constant */
+        for_range(j, kernel.numTaps)
+            weights[j] = static_cast<float>(tapWeights[j] / sum);
+    }
+}
+
+// Adds the specified row of floats multiplied by 'weight' to the destination row.
+static void AccumulateRow(float* dst, const float* src, float weight, std::size_t count)
+{
+    std::size_t i = 0;
+
+    #if defined(LLGL_MIP_CHAIN_SSE2)
+
+    const __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), w)));
+
+    #elif defined(LLGL_MIP_CHAIN_NEON)
+
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), weight));
+
+    #endif
+
+    for (; i < count; ++i)
+        dst[i] += src[i] * weight;
+}
+
+/*
+Resamples the middle axis of an image that is laid out as [outer][axis][inner], where 'inner' is the number of floats
+that are contiguous for each position along the axis. This covers all three axes: For the X axis, 'inner' is the number of components.
+*/
+static void FilterAxis(
+    float*                  dst,
+    const float*            src,
+    std::size_t             outerSize,
+    std::size_t             srcAxisSize,
+    std::size_t             dstAxisSize,
+    std::size_t             innerSize,
+    const MipFilterKernel&  kernel,
+    unsigned                threadCount)
+{
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t row = begin; row < end; ++row)
+            {
+                const std::size_t   outer       = row / dstAxisSize;
+                const std::size_t   dstIndex    = row % dstAxisSize;
+                float*              dstRow      = dst + row * innerSize;
+                const float*        srcPlane    = src + outer * srcAxisSize * innerSize;
+
+                std::fill(dstRow, dstRow + innerSize, 0.0f);
+
+                for_range(tap, kernel.numTaps)
+                {
+                    const std::size_t   tapIndex    = dstIndex * kernel.numTaps + tap;
+                    const float         weight      = kernel.weights[tapIndex];
+                    if (weight != 0.0f)
+                        AccumulateRow(dstRow, srcPlane + kernel.indices[tapIndex] * innerSize, weight, innerSize);
+                }
+            }
+        },
+        outerSize * dstAxisSize,
+        threadCount,
+        g_mipFilterMinWorkSize
+    );
+}
+
+// Returns the index of the alpha component within the specified image format, or -1 if there is none.
+static int GetAlphaComponentIndex(ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::Alpha:    return 0;
+        case ImageFormat::RGBA:     return 3;
+        case ImageFormat::BGRA:     return 3;
+        case ImageFormat::ARGB:     return 0;
+        case ImageFormat::ABGR:     return 0;
+        default:                    return -1;
+    }
+}
+
+static float SRGBToLinear(float x)
+{
+    return (x <= 0.04045f ? x / 12.92f : std::pow((x + 0.055f) / 1.055f, 2.4f));
+}
+
+static float LinearToSRGB(float x)
+{
+    return (x <= 0.0031308f ? x * 12.92f : 1.055f * std::pow(x, 1.0f / 2.4f) - 0.055f);
+}
+
+// Applies the sRGB transfer function (or its inverse) to all color components, i.e. all components except alpha.
+static void TransformSRGBComponents(float* data, std::size_t numTexels, std::size_t numComponents, int alphaComponent, bool toLinear, unsigned threadCount)
+{
+    DoConcurrentRange(
+        [=](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                for_range(c, numComponents)
+                {
+                    if (static_cast<int>(c) == alphaComponent)
+                        continue;
+                    float& value = data[i * numComponents + c];
+                    value = (toLinear ? SRGBToLinear(std::max(0.0f, value)) : LinearToSRGB(std::max(0.0f, value)));
+                }
+            }
+        },
+        numTexels,
+        threadCount,
+        g_mipFilterMinWorkSize
+    );
+}
+
+// Returns the offset that rounds normalized values to the nearest integer for the specified data type, since the image conversion truncates them.
+static float GetNormalizedRoundingBias(DataType dataType)
+{
+    switch (dataType)
+    {
+        case DataType::Int8:    /*pass*/
+        case DataType::UInt8:   return 0.5f / static_cast<float>(std::numeric_limits<std::uint8_t>::max());
+        case DataType::Int16:   /*pass*/
+        case DataType::UInt16:  return 0.5f / static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+        case DataType::Int32:   /*pass*/
+        case DataType::UInt32:  return static_cast<float>(0.5 / static_cast<double>(std::numeric_limits<std::uint32_t>::max()));
+        default:                return 0.0f;
+    }
+}
+
+static bool IsNormalizedDataType(DataType dataType)
+{
+    return (dataType != DataType::Float16 && dataType != DataType::Float32 && dataType != DataType::Float64);
+}
+
+// Clamps the filtered values to the normalized range (the Kaiser filter can overshoot) and adds the rounding bias for integer data types.
+static void PrepareNormalizedOutput(float* data, std::size_t count, DataType dataType)
+{
+    if (IsNormalizedDataType(dataType))
+    {
+        const float bias = GetNormalizedRoundingBias(dataType);
+        for_range(i, count)
+            data[i] = std::max(0.0f, std::min(data[i] + bias, 1.0f));
+    }
+}
+
+/*
+Resamples the floating-point image 'level' from 'srcExtent' to 'dstExtent' by filtering each axis separately; the layout is [layer][z][y][x][component].
+Each pass resamples the current level into 'tmpLevel', which is then swapped with the current level.
+Axes that shrink the most are filtered first, so the subsequent passes process as few texels as possible.
+*/
+static void ResampleFloatLevel(
+    std::vector<float>&     level,
+    std::vector<float>&     tmpLevel,
+    const Extent3D&         srcExtent,
+    const Extent3D&         dstExtent,
+    std::size_t             numComponents,
+    std::uint32_t           numArrayLayers,
+    ImageResampleFilter     filter,
+    unsigned                threadCount)
+{
+    const std::size_t axisSizes[3][2] =
+    {
+        { srcExtent.width,  dstExtent.width  },
+        { srcExtent.height, dstExtent.height },
+        { srcExtent.depth,  dstExtent.depth  },
+    };
+
+    std::size_t axisOrder[3] = { 0, 1, 2 };
+    std::stable_sort(
+        std::begin(axisOrder),
+        std::end(axisOrder),
+        [&axisSizes](std::size_t lhs, std::size_t rhs)
+        {
+            return (axisSizes[lhs][1] * axisSizes[rhs][0] < axisSizes[rhs][1] * axisSizes[lhs][0]);
+        }
+    );
+
+    std::size_t dims[3] = { srcExtent.width, srcExtent.height, srcExtent.depth };
+    MipFilterKernel kernel;
+
+    for (std::size_t axis : axisOrder)
+    {
+        const std::size_t srcAxisSize = axisSizes[axis][0];
+        const std::size_t dstAxisSize = axisSizes[axis][1];
+        if (srcAxisSize == dstAxisSize)
+            continue;
+
+        std::size_t innerSize = numComponents;
+        for_range(i, axis)
+            innerSize *= dims[i];
+
+        std::size_t outerSize = numArrayLayers;
+        for (std::size_t i = axis + 1; i < 3; ++i)
+            outerSize *= dims[i];
+
+        BuildFilterKernel(kernel, static_cast<std::uint32_t>(srcAxisSize), static_cast<std::uint32_t>(dstAxisSize), filter);
+
+        tmpLevel.resize(outerSize * dstAxisSize * innerSize);
+        FilterAxis(tmpLevel.data(), level.data(), outerSize, srcAxisSize, dstAxisSize, innerSize, kernel, threadCount);
+        level.swap(tmpLevel);
+
+        dims[axis] = dstAxisSize;
+    }
+}
+
+// Converts the filtered floating-point values in place back from linear color space and writes them in the specified format and data type.
+static void WriteFloatLevel(
+    float*              data,
+    std::size_t         numTexels,
+    ImageFormat         format,
+    DataType            dataType,
+    bool                isSRGB,
+    char*               dst,
+    std::size_t         dstSize,
+    unsigned            threadCount)
+{
+    const std::size_t numComponents = FormatTable::ImageFormatSize(format);
+    const std::size_t numFloats     = numTexels * numComponents;
+
+    if (isSRGB)
+        TransformSRGBComponents(data, numTexels, numComponents, GetAlphaComponentIndex(format), false, threadCount);
+
+    PrepareNormalizedOutput(data, numFloats, dataType);
+
+    ConvertImageBuffer(
+        ImageView{ format, DataType::Float32, data, numFloats * sizeof(float) },
+        MutableImageView{ format, dataType, dst, dstSize },
+        Extent3D{ static_cast<std::uint32_t>(numTexels), 1, 1 },
+        threadCount,
+        true
+    );
+}
+
+
+/* ----- Functions ----- */
+
+LLGL_EXPORT DynamicByteArray GenerateMipChainBuffer(
+    const ImageView&    srcImageView,
+    const Extent3D&     extent,
+    std::uint32_t       numArrayLayers,
+    std::uint32_t       numMipLevels,
+    ImageMipMapFilter   filter,
+    bool                isSRGB,
+    unsigned            threadCount)
+{
+    if (extent.width == 0 || extent.height == 0 || extent.depth == 0 || numArrayLayers == 0)
+        return nullptr;
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    /* Clamp number of MIP-maps to the full chain */
+    const std::uint32_t maxMipLevels = NumMipLevels(extent.width, extent.height, extent.depth);
+    if (numMipLevels == 0 || numMipLevels > maxMipLevels)
+        numMipLevels = maxMipLevels;
+
+    const ImageFormat   format          = srcImageView.format;
+    const DataType      dataType        = srcImageView.dataType;
+    const std::size_t   numComponents   = FormatTable::ImageFormatSize(format);
+    const int           alphaComponent  = GetAlphaComponentIndex(format);
+
+    /* Allocate output buffer for all MIP-maps, each with all array layers */
+    std::size_t totalSize = 0;
+    for_range(mip, numMipLevels)
+    {
+        const Extent3D mipExtent = GetMipExtent(TextureType::Texture3D, extent, mip);
+        totalSize += FormatTable::GetMemoryFootprint(format, dataType, static_cast<std::size_t>(mipExtent.width) * mipExtent.height * mipExtent.depth * numArrayLayers);
+    }
+
+    DynamicByteArray dstBuffer{ totalSize, UninitializeTag{} };
+    char* dst = dstBuffer.get();
+
+    /* Array layers are treated as additional slices for the image conversion */
+    const Extent3D      srcExtent       { extent.width, extent.height, extent.depth * numArrayLayers };
+    const std::size_t   numSrcTexels    = static_cast<std::size_t>(srcExtent.width) * srcExtent.height * srcExtent.depth;
+    const std::size_t   srcLevelSize    = FormatTable::GetMemoryFootprint(format, dataType, numSrcTexels);
+
+    /* Copy first MIP-map unchanged, but tightly packed */
+    ConvertImageBuffer(srcImageView, MutableImageView{ format, dataType, dst, srcLevelSize }, srcExtent, threadCount, true);
+    dst += srcLevelSize;
+
+    if (numMipLevels == 1)
+        return dstBuffer;
+
+    /* Convert first MIP-map to linear floating-point values */
+    std::vector<float> srcLevel(numSrcTexels * numComponents), tmpLevel, outputLevel;
+    ConvertImageBuffer(
+        srcImageView,
+        MutableImageView{ format, DataType::Float32, srcLevel.data(), srcLevel.size() * sizeof(float) },
+        srcExtent,
+        threadCount,
+        true
+    );
+
+    if (isSRGB)
+        TransformSRGBComponents(srcLevel.data(), numSrcTexels, numComponents, alphaComponent, true, threadCount);
+
+    Extent3D prevExtent = extent;
+
+    for (std::uint32_t mip = 1; mip < numMipLevels; ++mip)
+    {
+        /* Downsample the previous level, which remains in linear color space for the next iteration */
+        const Extent3D mipExtent = GetMipExtent(TextureType::Texture3D, extent, mip);
+        ResampleFloatLevel(srcLevel, tmpLevel, prevExtent, mipExtent, numComponents, numArrayLayers, ToResampleFilter(filter), threadCount);
+
+        /* Convert filtered level back to the source format and data type */
+        const std::size_t numMipTexels  = static_cast<std::size_t>(mipExtent.width) * mipExtent.height * mipExtent.depth * numArrayLayers;
+        const std::size_t numMipFloats  = numMipTexels * numComponents;
+        const std::size_t mipLevelSize  = FormatTable::GetMemoryFootprint(format, dataType, numMipTexels);
+
+        outputLevel.resize(numMipFloats);
+        ::memcpy(outputLevel.data(), srcLevel.data(), numMipFloats * sizeof(float));
+
+        WriteFloatLevel(outputLevel.data(), numMipTexels, format, dataType, isSRGB, dst, mipLevelSize, threadCount);
+        dst += mipLevelSize;
+
+        prevExtent = mipExtent;
+    }
+
+    return dstBuffer;
+}
+
+LLGL_EXPORT DynamicByteArray ResampleImageBuffer(
+    const ImageView&    srcImageView,
+    const Extent3D&     srcExtent,
+    const Extent3D&     dstExtent,
+    ImageResampleFilter filter,
+    bool                isSRGB,
+    unsigned            threadCount)
+{
+    if (srcExtent.width == 0 || srcExtent.height == 0 || srcExtent.depth == 0 ||
+        dstExtent.width == 0 || dstExtent.height == 0 || dstExtent.depth == 0)
+    {
+        return nullptr;
+    }
+
+    if (threadCount == LLGL_MAX_THREAD_COUNT)
+        threadCount = std::thread::hardware_concurrency();
+
+    const ImageFormat   format          = srcImageView.format;
+    const DataType      dataType        = srcImageView.dataType;
+    const std::size_t   numComponents   = FormatTable::ImageFormatSize(format);
+    const std::size_t   numSrcTexels    = static_cast<std::size_t>(srcExtent.width) * srcExtent.height * srcExtent.depth;
+    const std::size_t   numDstTexels    = static_cast<std::size_t>(dstExtent.width) * dstExtent.height * dstExtent.depth;
+    const std::size_t   dstSize         = FormatTable::GetMemoryFootprint(format, dataType, numDstTexels);
+
+    DynamicByteArray dstBuffer{ dstSize, UninitializeTag{} };
+
+    if (srcExtent == dstExtent)
+    {
+        /* Copy image unchanged, but tightly packed */
+        ConvertImageBuffer(srcImageView, MutableImageView{ format, dataType, dstBuffer.get(), dstSize }, srcExtent, threadCount, true);
+        return dstBuffer;
+    }
+
+    /* Convert source image to linear floating-point values */
+    std::vector<float> level(numSrcTexels * numComponents), tmpLevel;
+    ConvertImageBuffer(
+        srcImageView,
+        MutableImageView{ format, DataType::Float32, level.data(), level.size() * sizeof(float) },
+        srcExtent,
+        threadCount,
+        true
+    );
+
+    if (isSRGB)
+        TransformSRGBComponents(level.data(), numSrcTexels, numComponents, GetAlphaComponentIndex(format), true, threadCount);
+
+    ResampleFloatLevel(level, tmpLevel, srcExtent, dstExtent, numComponents, 1, filter, threadCount);
+
+    /* Convert resampled image back to the source format and data type */
+    WriteFloatLevel(level.data(), numDstTexels, format, dataType, isSRGB, dstBuffer.get(), dstSize, threadCount);
+
+    return dstBuffer;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
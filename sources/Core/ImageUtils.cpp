@@ -7,6 +7,8 @@
 
 #include "ImageUtils.h"
 #include "Assertion.h"
+#include "CoreUtils.h"
+#include "Threading.h"
 #include <LLGL/Types.h>
 #include <LLGL/Utils/ForRange.h>
 #include <cstdint>
@@ -18,6 +20,44 @@ namespace LLGL
 {
 
 
+/*
+Minimum number of bytes each worker thread copies in BitBlit.
+Below this size the job dispatch costs more than the copy itself, so small regions always remain single-threaded.
+*/
+static constexpr std::size_t g_bitBlitMinWorkSize = 256 * 1024;
+
+// Copies rows of a constant length; the compiler lowers the fixed-size memcpy to plain vector moves instead of a library call per row.
+template <std::size_t RowLength>
+static void CopyImageRowsFixed(char* dst, std::size_t dstRowStride, const char* src, std::size_t srcRowStride, std::size_t numRows)
+{
+    for_range(y, numRows)
+    {
+        ::memcpy(dst, src, RowLength);
+        dst += dstRowStride;
+        src += srcRowStride;
+    }
+}
+
+static void CopyImageRows(char* dst, std::size_t dstRowStride, const char* src, std::size_t srcRowStride, std::size_t rowLength, std::size_t numRows)
+{
+    /* Narrow rows are dominated by the call overhead of memcpy, so dispatch common row lengths to fixed-size copies */
+    switch (rowLength)
+    {
+        case  4: return CopyImageRowsFixed< 4>(dst, dstRowStride, src, srcRowStride, numRows);
+        case  8: return CopyImageRowsFixed< 8>(dst, dstRowStride, src, srcRowStride, numRows);
+        case 16: return CopyImageRowsFixed<16>(dst, dstRowStride, src, srcRowStride, numRows);
+        case 32: return CopyImageRowsFixed<32>(dst, dstRowStride, src, srcRowStride, numRows);
+        case 64: return CopyImageRowsFixed<64>(dst, dstRowStride, src, srcRowStride, numRows);
+        default: break;
+    }
+    for_range(y, numRows)
+    {
+        ::memcpy(dst, src, rowLength);
+        dst += dstRowStride;
+        src += srcRowStride;
+    }
+}
+
 LLGL_EXPORT void BitBlit(
     const Extent3D& extent,
     std::uint32_t   bpp,
@@ -26,75 +66,106 @@ LLGL_EXPORT void BitBlit(
     std::uint32_t   dstLayerStride,
     const char*     src,
     std::uint32_t   srcRowStride,
-    std::uint32_t   srcLayerStride)
+    std::uint32_t   srcLayerStride,
+    unsigned        threadCount)
 {
-    const std::uint32_t rowLength   = bpp * extent.width;
-    const std::uint32_t layerLength = rowLength * extent.height;
+    /* Use std::size_t for all lengths to not overflow for very large images, e.g. 16K x 16K RGBA32F */
+    const std::size_t rowLength     = static_cast<std::size_t>(bpp) * extent.width;
+    const std::size_t layerLength   = rowLength * extent.height;
 
     /* Clamp strides to tightly packed lengths */
-    dstRowStride = std::max(dstRowStride, rowLength);
-    srcRowStride = std::max(srcRowStride, rowLength);
+    const std::size_t dstRowPitch   = std::max<std::size_t>(dstRowStride, rowLength);
+    const std::size_t srcRowPitch   = std::max<std::size_t>(srcRowStride, rowLength);
 
-    const std::uint32_t dstLayerLength = dstRowStride * extent.height;
-    const std::uint32_t srcLayerLength = srcRowStride * extent.height;
+    const std::size_t dstLayerLength = dstRowPitch * extent.height;
+    const std::size_t srcLayerLength = srcRowPitch * extent.height;
 
     LLGL_ASSERT(
         dstLayerStride == 0 || dstLayerStride >= dstLayerLength,
-        "'dstLayerStride' must be 0 or at least %u, but %u was specified", dstLayerLength, dstLayerStride
+        "'dstLayerStride' must be 0 or at least %zu, but %u was specified", dstLayerLength, dstLayerStride
     );
     LLGL_ASSERT(
         srcLayerStride == 0 || srcLayerStride >= srcLayerLength,
-        "'srcLayerStride' must be 0 or at least %u, but %u was specified", srcLayerLength, srcLayerStride
+        "'srcLayerStride' must be 0 or at least %zu, but %u was specified", srcLayerLength, srcLayerStride
     );
 
-    dstLayerStride = std::max(dstLayerLength, std::max(dstLayerStride, layerLength));
-    srcLayerStride = std::max(srcLayerLength, std::max(srcLayerStride, layerLength));
+    const std::size_t dstLayerPitch = std::max<std::size_t>(dstLayerLength, dstLayerStride);
+    const std::size_t srcLayerPitch = std::max<std::size_t>(srcLayerLength, srcLayerStride);
 
-    if (srcRowStride == dstRowStride && rowLength == dstRowStride)
+    const std::size_t numRows       = static_cast<std::size_t>(extent.height) * extent.depth;
+    const std::size_t totalLength   = layerLength * extent.depth;
+
+    if (totalLength == 0)
+        return;
+
+    /* Rows are contiguous if they are tightly packed or if there is only a single row per slice; the same applies to slices */
+    const bool isRowContiguous      = ((dstRowPitch == rowLength && srcRowPitch == rowLength) || extent.height == 1);
+    const bool isLayerContiguous    = ((dstLayerPitch == layerLength && srcLayerPitch == layerLength) || extent.depth == 1);
+
+    if (isRowContiguous && isLayerContiguous)
     {
-        if (srcLayerStride == dstLayerStride && layerLength == dstLayerStride)
+        if (threadCount > 1)
         {
-            /* Copy region directly into output data */
-            ::memcpy(dst, src, layerLength * extent.depth);
+            /* Split region into large chunks that are copied by the worker threads */
+            DoConcurrentRange(
+                [dst, src, totalLength](std::size_t begin, std::size_t end)
+                {
+                    const std::size_t offset = begin * g_bitBlitMinWorkSize;
+                    ::memcpy(dst + offset, src + offset, std::min(end * g_bitBlitMinWorkSize, totalLength) - offset);
+                },
+                DivideRoundUp(totalLength, g_bitBlitMinWorkSize),
+                threadCount,
+                1
+            );
         }
         else
         {
-            /* Copy region directly into output data */
-            for_range(z, extent.depth)
-            {
-                /* Copy current slice */
-                ::memcpy(dst, src, layerLength);
-
-                /* Move pointers to next slice */
-                dst += dstLayerStride;
-                src += srcLayerStride;
-            }
+            /* Copy entire region with a single memcpy */
+            ::memcpy(dst, src, totalLength);
         }
     }
+    else if (isRowContiguous)
+    {
+        /* Copy each slice with a single memcpy */
+        DoConcurrentRange(
+            [=](std::size_t begin, std::size_t end)
+            {
+                for_subrange(z, begin, end)
+                    ::memcpy(dst + z * dstLayerPitch, src + z * srcLayerPitch, layerLength);
+            },
+            extent.depth,
+            threadCount,
+            static_cast<unsigned>(std::max<std::size_t>(1, g_bitBlitMinWorkSize / layerLength))
+        );
+    }
     else
     {
-        /* Adjust depth strides */
-        dstLayerStride -= dstRowStride * extent.height;
-        srcLayerStride -= srcRowStride * extent.height;
-
-        /* Copy region directly into output data */
-        for_range(z, extent.depth)
-        {
-            /* Copy current slice */
-            for_range(y, extent.height)
+        /* Copy row by row; all rows of all slices are distributed evenly across the worker threads */
+        const std::uint32_t height = extent.height;
+        DoConcurrentRange(
+            [=](std::size_t begin, std::size_t end)
             {
-                /* Copy current row */
-                ::memcpy(dst, src, rowLength);
-
-                /* Move pointers to next row */
-                dst += dstRowStride;
-                src += srcRowStride;
-            }
-
-            /* Move pointers to next slice */
-            dst += dstLayerStride;
-            src += srcLayerStride;
-        }
+                for (std::size_t row = begin; row < end;)
+                {
+                    /* Copy remaining rows of the current slice at once */
+                    const std::size_t z         = row / height;
+                    const std::size_t y         = row % height;
+                    const std::size_t rowsEnd   = std::min<std::size_t>(end, (z + 1) * height);
+                    CopyImageRows(
+                        dst + z * dstLayerPitch + y * dstRowPitch,
+                        dstRowPitch,
+                        src + z * srcLayerPitch + y * srcRowPitch,
+                        srcRowPitch,
+                        rowLength,
+                        rowsEnd - row
+                    );
+                    row = rowsEnd;
+                }
+            },
+            numRows,
+            threadCount,
+            static_cast<unsigned>(std::max<std::size_t>(1, g_bitBlitMinWorkSize / rowLength))
+        );
     }
 }
 
@@ -21,7 +21,11 @@ struct Extent3D;
 
 /* ----- Functions ----- */
 
-// Copies the specified extent from the source image to the destination image buffer.
+/*
+Copies the specified extent from the source image to the destination image buffer.
+Contiguous regions are copied with a single memcpy. If 'threadCount' is greater than 1 or LLGL_MAX_THREAD_COUNT,
+large regions are distributed across the worker thread pool; small copies always remain on the calling thread.
+*/
 LLGL_EXPORT void BitBlit(
     const Extent3D& extent,
     std::uint32_t   bpp,
@@ -30,7 +34,8 @@ LLGL_EXPORT void BitBlit(
     std::uint32_t   dstLayerStride,
     const char*     src,
     std::uint32_t   srcRowStride,
-    std::uint32_t   srcLayerStride
+    std::uint32_t   srcLayerStride,
+    unsigned        threadCount     = 0
 );
 
 
@@ -49,6 +49,7 @@ LLGL_IMPLEMENT_INTERFACE( Fence,                    RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( PipelineLayout,           RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( PipelineCache,            RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( PipelineState,            RenderSystemChild )
+LLGL_IMPLEMENT_INTERFACE( PlacementHeap,            RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( QueryHeap,                RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( RenderTarget,             RenderSystemChild )
 LLGL_IMPLEMENT_INTERFACE( RenderPass,               RenderSystemChild )
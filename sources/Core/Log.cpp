@@ -10,6 +10,7 @@
 #include "../Platform/ConsoleManip.h"
 #include "CoreUtils.h"
 #include "StringUtils.h"
+#include "ConcurrentRingBuffer.h"
 #include "../Renderer/ContainerTypes.h"
 #include <mutex>
 #include <atomic>
@@ -62,11 +63,25 @@ struct LogListener
 
 using LogListenerPtr = std::unique_ptr<LogListener>;
 
+struct DeferredReport
+{
+    ReportType  type    = ReportType::Default;
+    ColorCodes  colors;
+    std::string text;
+};
+
+using DeferredReportRingBuffer = ConcurrentRingBuffer<DeferredReport>;
+
 struct LogState
 {
-    std::mutex                              lock;
-    UnorderedUniquePtrVector<LogListener>   listeners;
-    LogListenerPtr                          listenerStd;
+    std::mutex                                  lock;
+    UnorderedUniquePtrVector<LogListener>       listeners;
+    LogListenerPtr                              listenerStd;
+    std::atomic<std::size_t>                    numListeners        { 0 };  // Number of listeners including the standard output; read before formatting a report
+    std::atomic<int>                            reportLevel         { 0 };  // Minimum ReportType that is forwarded; see SetReportLevel()
+    std::unique_ptr<DeferredReportRingBuffer>   deferredReports;            // Ring buffer for deferred reports; null if disabled
+    std::atomic<DeferredReportRingBuffer*>      deferredReportsRef  { nullptr };
+    std::atomic<std::size_t>                    numDroppedReports   { 0 };
 };
 
 class TrivialLock
@@ -101,7 +116,15 @@ static thread_local TrivialLock g_logRecursionLock;
 
 /* ----- Functions ----- */
 
-static void PostReport(ReportType type, const char* text, const ColorCodes& colors = {})
+// Returns the thread local string to format reports into. Its capacity is retained, so formatting reports doesn't allocate memory after the first few reports.
+static std::string& GetReportBuffer()
+{
+    static thread_local std::string buffer;
+    buffer.clear();
+    return buffer;
+}
+
+static void PostReportImmediate(ReportType type, const char* text, const ColorCodes& colors)
 {
     std::lock_guard<std::mutex> guard{ g_logState.lock };
 
@@ -112,47 +135,65 @@ static void PostReport(ReportType type, const char* text, const ColorCodes& colo
         listener->Invoke(type, text, colors);
 }
 
+static void PostReport(ReportType type, const std::string& text, const ColorCodes& colors = {})
+{
+    if (DeferredReportRingBuffer* deferredReports = g_logState.deferredReportsRef.load(std::memory_order_acquire))
+    {
+        /* Push report into ring buffer without acquiring the lock of the listeners */
+        DeferredReport report;
+        {
+            report.type     = type;
+            report.colors   = colors;
+            report.text     = text;
+        }
+        if (!deferredReports->Push(std::move(report)))
+            g_logState.numDroppedReports.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+        PostReportImmediate(type, text.c_str(), colors);
+}
+
 LLGL_EXPORT void Printf(const char* format, ...)
 {
-    if (!g_logRecursionLock)
+    if (!g_logRecursionLock && IsReportEnabled(ReportType::Default))
     {
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
-        std::string str;
+        std::string& str = GetReportBuffer();
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Default, str.c_str());
+        PostReport(ReportType::Default, str);
     }
 }
 
 LLGL_EXPORT void Printf(const ColorCodes& colors, const char* format, ...)
 {
-    if (!g_logRecursionLock)
+    if (!g_logRecursionLock && IsReportEnabled(ReportType::Default))
     {
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
-        std::string str;
+        std::string& str = GetReportBuffer();
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Default, str.c_str(), colors);
+        PostReport(ReportType::Default, str, colors);
     }
 }
 
 LLGL_EXPORT void Errorf(const char* format, ...)
 {
-    if (!g_logRecursionLock)
+    if (!g_logRecursionLock && IsReportEnabled(ReportType::Error))
     {
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
-        std::string str;
+        std::string& str = GetReportBuffer();
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Error, str.c_str());
+        PostReport(ReportType::Error, str);
     }
 }
 
 LLGL_EXPORT void Errorf(const ColorCodes& colors, const char* format, ...)
 {
-    if (!g_logRecursionLock)
+    if (!g_logRecursionLock && IsReportEnabled(ReportType::Error))
     {
         std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
-        std::string str;
+        std::string& str = GetReportBuffer();
         LLGL_STRING_PRINTF(str, format);
-        PostReport(ReportType::Error, str.c_str(), colors);
+        PostReport(ReportType::Error, str, colors);
     }
 }
 
@@ -162,6 +203,7 @@ static LogHandle RegisterCallbackInternal(const TCallback& callback, void* userD
     if (!g_logRecursionLock)
     {
         std::lock_guard<std::mutex> guard{ g_logState.lock };
+        g_logState.numListeners.fetch_add(1, std::memory_order_relaxed);
         return reinterpret_cast<LogHandle>(g_logState.listeners.emplace<LogListener>(callback, userData));
     }
     return nullptr;
@@ -231,6 +273,7 @@ LLGL_EXPORT LogHandle RegisterCallbackStd(long stdOutFlags)
         std::lock_guard<std::mutex> guard{ g_logState.lock };
         if (g_logState.listenerStd.get() == nullptr)
         {
+            g_logState.numListeners.fetch_add(1, std::memory_order_relaxed);
             if ((stdOutFlags & StdOutFlags::Colored) != 0)
                 g_logState.listenerStd = MakeUnique<LogListener>(StandardOutputReportCallbackExt);
             else
@@ -250,7 +293,57 @@ LLGL_EXPORT void UnregisterCallback(LogHandle handle)
             g_logState.listenerStd.reset();
         else
             g_logState.listeners.erase(static_cast<LogListener*>(handle));
+        g_logState.numListeners.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+LLGL_EXPORT void SetReportLevel(ReportType type)
+{
+    g_logState.reportLevel.store(static_cast<int>(type), std::memory_order_relaxed);
+}
+
+LLGL_EXPORT bool IsReportEnabled(ReportType type)
+{
+    return
+    (
+        g_logState.numListeners.load(std::memory_order_relaxed) > 0 &&
+        static_cast<int>(type) >= g_logState.reportLevel.load(std::memory_order_relaxed)
+    );
+}
+
+LLGL_EXPORT void SetDeferredReports(std::size_t capacity)
+{
+    /* Forward pending reports before the ring buffer is replaced */
+    FlushDeferredReports();
+
+    g_logState.deferredReportsRef.store(nullptr, std::memory_order_release);
+    if (capacity > 0)
+        g_logState.deferredReports = MakeUnique<DeferredReportRingBuffer>(capacity);
+    else
+        g_logState.deferredReports.reset();
+    g_logState.deferredReportsRef.store(g_logState.deferredReports.get(), std::memory_order_release);
+}
+
+LLGL_EXPORT std::size_t FlushDeferredReports()
+{
+    DeferredReportRingBuffer* deferredReports = g_logState.deferredReportsRef.load(std::memory_order_acquire);
+    if (deferredReports == nullptr || g_logRecursionLock)
+        return 0;
+
+    /* Forward reports to listeners; reports that are emitted by the listeners themselves are ignored like in Printf() */
+    std::lock_guard<TrivialLock> guard{ g_logRecursionLock };
+
+    std::size_t numReports = 0;
+    for (DeferredReport report; deferredReports->Pop(report); ++numReports)
+        PostReportImmediate(report.type, report.text.c_str(), report.colors);
+
+    if (const std::size_t numDroppedReports = g_logState.numDroppedReports.exchange(0, std::memory_order_relaxed))
+    {
+        const std::string str = std::to_string(numDroppedReports) + " deferred log report(s) dropped because the ring buffer was full\n";
+        PostReportImmediate(ReportType::Error, str.c_str(), {});
     }
+
+    return numReports;
 }
 
 
@@ -387,12 +387,13 @@ static bool ParseLayoutSignatureResourceType(Parser& parser, ResourceType& outTy
 
     constexpr ResourceTypeIdent acceptedResources[] =
     {
-        { "cbuffer",   ResourceType::Buffer,  BindFlags::ConstantBuffer },
-        { "buffer",    ResourceType::Buffer,  BindFlags::Sampled        },
-        { "rwbuffer",  ResourceType::Buffer,  BindFlags::Storage        },
-        { "texture",   ResourceType::Texture, BindFlags::Sampled        },
-        { "rwtexture", ResourceType::Texture, BindFlags::Storage        },
-        { "sampler",   ResourceType::Sampler, 0                         },
+        { "cbuffer",     ResourceType::Buffer,  BindFlags::ConstantBuffer        },
+        { "buffer",      ResourceType::Buffer,  BindFlags::Sampled               },
+        { "rwbuffer",    ResourceType::Buffer,  BindFlags::Storage               },
+        { "texture",     ResourceType::Texture, BindFlags::Sampled               },
+        { "rwtexture",   ResourceType::Texture, BindFlags::Storage               },
+        { "accelstruct", ResourceType::Buffer,  BindFlags::AccelerationStructure },
+        { "sampler",     ResourceType::Sampler, 0                                },
     };
 
     for (const ResourceTypeIdent& resource : acceptedResources)
@@ -426,6 +427,13 @@ static long ParseLayoutSignatureStageFlag(Parser& parser, long& bitmask)
         { StageFlags::GeometryStage,        "geom" },
         { StageFlags::FragmentStage,        "frag" },
         { StageFlags::ComputeStage,         "comp" },
+        { StageFlags::TaskStage,            "task" },
+        { StageFlags::MeshStage,            "mesh" },
+        { StageFlags::TileStage,            "tile" },
+        { StageFlags::RayGenerationStage,   "rgen" },
+        { StageFlags::MissStage,            "rmiss" },
+        { StageFlags::ClosestHitStage,      "rchit" },
+        { StageFlags::AnyHitStage,          "rahit" },
     };
 
     /* Parse identifier (find end of alphabetic characters) */
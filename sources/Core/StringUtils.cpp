@@ -148,18 +148,25 @@ LLGL_EXPORT std::wstring ToWideString(const char* str)
 
 void StringPrintf(std::string& str, const char* format, va_list args1, va_list args2)
 {
-    const int len = ::vsnprintf(nullptr, 0, format, args1);
+    /*
+    Since C++11 we can override the last character with '\0' ourselves,
+    so it's safe to let ::vsnprintf override std::string from [0, size()] inclusive.
+    Format into the spare capacity first, so strings that are reused for formatting only run ::vsnprintf once.
+    */
+    const std::size_t appendOff = str.size();
+    const std::size_t spareLen  = str.capacity() - appendOff;
+    str.resize(appendOff + spareLen);
+
+    const int len = ::vsnprintf(&str[appendOff], spareLen + 1, format, args1);
     if (len > 0)
     {
-        /*
-        Since C++11 we can override the last character with '\0' ourselves,
-        so it's safe to let ::vsnprintf override std::string from [0, size()] inclusive.
-        */
         const std::size_t formatLen = static_cast<std::size_t>(len);
-        const std::size_t appendOff = str.size();
         str.resize(appendOff + formatLen);
-        ::vsnprintf(&str[appendOff], formatLen + 1, format, args2);
+        if (formatLen > spareLen)
+            ::vsnprintf(&str[appendOff], formatLen + 1, format, args2);
     }
+    else
+        str.resize(appendOff);
 }
 
 LLGL_EXPORT UTF8String WriteTableToUTF8String(const ArrayView<FormattedTableColumn>& columns, const char* delimiters)
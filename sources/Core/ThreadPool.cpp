@@ -0,0 +1,381 @@
+/*
+ * ThreadPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/ThreadPool.h>
+#include <LLGL/Platform/Platform.h>
+#include <LLGL/Utils/ForRange.h>
+#include "../Platform/ThreadAffinity.h"
+#include "Threading.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+ * WorkerThreadPool class
+ */
+
+// Persistent pool of worker threads. The dispatching thread always participates in processing its own jobs.
+class WorkerThreadPool
+{
+
+    public:
+
+        WorkerThreadPool(const WorkerThreadPool&) = delete;
+        WorkerThreadPool& operator = (const WorkerThreadPool&) = delete;
+
+        WorkerThreadPool(const ThreadPoolDescriptor& desc);
+        ~WorkerThreadPool();
+
+        // Runs all jobs on this pool and blocks until all of them have finished.
+        void Dispatch(std::size_t numJobs, const ThreadPool::JobFunction& job);
+
+        // Runs the specified job on a worker thread without waiting for it.
+        void DispatchAsync(const std::function<void()>& job);
+
+        // Returns the number of worker threads.
+        inline unsigned GetNumThreads() const
+        {
+            return static_cast<unsigned>(workers_.size());
+        }
+
+    private:
+
+        // Batch of jobs from a single call to Dispatch. All members are guarded by the pool's mutex.
+        struct JobBatch
+        {
+            const ThreadPool::JobFunction*  job             = nullptr;
+            std::size_t                     numJobs         = 0;
+            std::size_t                     nextJob         = 0;
+            std::size_t                     numJobsDone     = 0;
+            ThreadPool::JobFunction         ownedJob;                   // Only used by async batches, which delete themselves after their last job.
+            bool                            isAsync         = false;
+        };
+
+    private:
+
+        void WorkerMain(std::uint64_t affinityMask);
+
+        // Claims the next job of the specified batch and removes the batch from the queue once its last job has been claimed.
+        std::size_t ClaimNextJob(JobBatch* batch);
+
+        // Runs the specified job with unlocked mutex.
+        void RunJob(JobBatch* batch, std::size_t jobIndex, std::unique_lock<std::mutex>& lock);
+
+    private:
+
+        std::vector<std::thread>    workers_;
+        std::vector<JobBatch*>      pendingBatches_;
+        std::mutex                  mutex_;
+        std::condition_variable     workAvailable_;
+        std::condition_variable     batchFinished_;
+        bool                        shutdown_       = false;
+
+};
+
+static unsigned GetNumWorkerThreads(const ThreadPoolDescriptor& desc)
+{
+    if (desc.numThreads != LLGL_MAX_THREAD_COUNT)
+        return desc.numThreads;
+
+    #if defined LLGL_OS_WASM && !defined __EMSCRIPTEN_PTHREADS__
+    /* Threads are not available on Wasm platform without pthreads */
+    return 0;
+    #else
+    const unsigned numHardwareThreads = std::thread::hardware_concurrency();
+    return (numHardwareThreads > 1 ? numHardwareThreads - 1 : 0);
+    #endif
+}
+
+WorkerThreadPool::WorkerThreadPool(const ThreadPoolDescriptor& desc)
+{
+    const unsigned numThreads = GetNumWorkerThreads(desc);
+    workers_.reserve(numThreads);
+    for_range(i, numThreads)
+        workers_.emplace_back(&WorkerThreadPool::WorkerMain, this, desc.affinityMask);
+}
+
+WorkerThreadPool::~WorkerThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        shutdown_ = true;
+    }
+    workAvailable_.notify_all();
+    for (std::thread& worker : workers_)
+        worker.join();
+}
+
+void WorkerThreadPool::Dispatch(std::size_t numJobs, const ThreadPool::JobFunction& job)
+{
+    JobBatch batch;
+    {
+        batch.job       = &job;
+        batch.numJobs   = numJobs;
+    }
+
+    std::unique_lock<std::mutex> lock{ mutex_ };
+
+    /* Publish batch to worker threads */
+    pendingBatches_.push_back(&batch);
+    workAvailable_.notify_all();
+
+    /* Process jobs on calling thread as well, so nested dispatches always make progress */
+    while (batch.nextJob < batch.numJobs)
+        RunJob(&batch, ClaimNextJob(&batch), lock);
+
+    /* Wait for remaining jobs that worker threads are still processing */
+    batchFinished_.wait(lock, [&batch]() { return (batch.numJobsDone == batch.numJobs); });
+}
+
+void WorkerThreadPool::DispatchAsync(const std::function<void()>& job)
+{
+    JobBatch* batch = new JobBatch{};
+    {
+        batch->ownedJob = [job](std::size_t) { job(); };
+        batch->job      = &(batch->ownedJob);
+        batch->numJobs  = 1;
+        batch->isAsync  = true;
+    }
+
+    /* Publish batch to worker threads; pending batches are always drained before the worker threads shut down */
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    pendingBatches_.push_back(batch);
+    workAvailable_.notify_one();
+}
+
+void WorkerThreadPool::WorkerMain(std::uint64_t affinityMask)
+{
+    if (affinityMask != 0)
+        SetCurrentThreadAffinity(affinityMask);
+
+    std::unique_lock<std::mutex> lock{ mutex_ };
+    for (;;)
+    {
+        workAvailable_.wait(lock, [this]() { return (shutdown_ || !pendingBatches_.empty()); });
+        if (pendingBatches_.empty())
+            break;
+        JobBatch* batch = pendingBatches_.front();
+        RunJob(batch, ClaimNextJob(batch), lock);
+    }
+}
+
+std::size_t WorkerThreadPool::ClaimNextJob(JobBatch* batch)
+{
+    const std::size_t jobIndex = batch->nextJob++;
+    if (batch->nextJob == batch->numJobs)
+    {
+        auto it = std::find(pendingBatches_.begin(), pendingBatches_.end(), batch);
+        if (it != pendingBatches_.end())
+            pendingBatches_.erase(it);
+    }
+    return jobIndex;
+}
+
+void WorkerThreadPool::RunJob(JobBatch* batch, std::size_t jobIndex, std::unique_lock<std::mutex>& lock)
+{
+    lock.unlock();
+    (*batch->job)(jobIndex);
+    lock.lock();
+
+    if (++batch->numJobsDone == batch->numJobs)
+    {
+        if (batch->isAsync)
+            delete batch;
+        else
+            batchFinished_.notify_all();
+    }
+}
+
+
+/*
+ * Global thread pool state
+ */
+
+using WorkerThreadPoolPtr = std::shared_ptr<WorkerThreadPool>;
+
+struct ThreadPoolState
+{
+    std::mutex                      lock;
+    ThreadPoolDescriptor            desc;
+    WorkerThreadPoolPtr             pool;
+    ThreadPool::DispatchCallback    dispatchCallback;
+    void*                           dispatchUserData    = nullptr;
+};
+
+static ThreadPoolState g_threadPoolState;
+
+static WorkerThreadPoolPtr GetOrCreateWorkerThreadPool()
+{
+    /* Must be called with locked state */
+    if (!g_threadPoolState.pool)
+        g_threadPoolState.pool = std::make_shared<WorkerThreadPool>(g_threadPoolState.desc);
+    return g_threadPoolState.pool;
+}
+
+LLGL_EXPORT void DispatchConcurrentJobs(std::size_t numJobs, const ThreadPool::JobFunction& job)
+{
+    if (numJobs == 0)
+        return;
+
+    if (numJobs == 1)
+    {
+        job(0);
+        return;
+    }
+
+    WorkerThreadPoolPtr pool;
+    ThreadPool::DispatchCallback dispatchCallback;
+    void* dispatchUserData = nullptr;
+    {
+        std::lock_guard<std::mutex> guard{ g_threadPoolState.lock };
+        if (g_threadPoolState.dispatchCallback)
+        {
+            dispatchCallback = g_threadPoolState.dispatchCallback;
+            dispatchUserData = g_threadPoolState.dispatchUserData;
+        }
+        else
+            pool = GetOrCreateWorkerThreadPool();
+    }
+
+    if (dispatchCallback)
+        dispatchCallback(numJobs, job, dispatchUserData);
+    else if (pool->GetNumThreads() > 0)
+        pool->Dispatch(numJobs, job);
+    else
+    {
+        for_range(i, numJobs)
+            job(i);
+    }
+}
+
+LLGL_EXPORT void DispatchAsyncJob(const std::function<void()>& job)
+{
+    /* Async jobs always run on the internal worker threads, since the host's dispatch callback is blocking */
+    WorkerThreadPoolPtr pool;
+    {
+        std::lock_guard<std::mutex> guard{ g_threadPoolState.lock };
+        pool = GetOrCreateWorkerThreadPool();
+    }
+
+    if (pool->GetNumThreads() > 0)
+        pool->DispatchAsync(job);
+    else
+        job();
+}
+
+
+/*
+ * AsyncJob class
+ */
+
+struct AsyncJob::SharedState
+{
+    std::mutex              mutex;
+    std::condition_variable finished;
+    bool                    isDone  = false;
+};
+
+AsyncJob::~AsyncJob()
+{
+    Wait();
+}
+
+void AsyncJob::Start(const std::function<void()>& task)
+{
+    Wait();
+
+    /* Share state with the job, so it can signal completion independently of this handle */
+    std::shared_ptr<SharedState> state = std::make_shared<SharedState>();
+    state_ = state;
+
+    DispatchAsyncJob(
+        [state, task]()
+        {
+            task();
+            {
+                std::lock_guard<std::mutex> guard{ state->mutex };
+                state->isDone = true;
+            }
+            state->finished.notify_all();
+        }
+    );
+}
+
+bool AsyncJob::IsDone() const
+{
+    if (!state_)
+        return true;
+    std::lock_guard<std::mutex> guard{ state_->mutex };
+    return state_->isDone;
+}
+
+void AsyncJob::Wait()
+{
+    if (state_)
+    {
+        std::unique_lock<std::mutex> lock{ state_->mutex };
+        state_->finished.wait(lock, [this]() { return state_->isDone; });
+    }
+}
+
+
+namespace ThreadPool
+{
+
+
+LLGL_EXPORT void Configure(const ThreadPoolDescriptor& threadPoolDesc)
+{
+    WorkerThreadPoolPtr oldPool;
+    {
+        std::lock_guard<std::mutex> guard{ g_threadPoolState.lock };
+        g_threadPoolState.desc = threadPoolDesc;
+        oldPool = std::move(g_threadPoolState.pool);
+    }
+    /* Old pool joins its worker threads once the last pending dispatch released its reference */
+}
+
+LLGL_EXPORT void SetDispatchCallback(const DispatchCallback& callback, void* userData)
+{
+    std::lock_guard<std::mutex> guard{ g_threadPoolState.lock };
+    g_threadPoolState.dispatchCallback = callback;
+    g_threadPoolState.dispatchUserData = userData;
+}
+
+LLGL_EXPORT unsigned GetNumThreads()
+{
+    std::lock_guard<std::mutex> guard{ g_threadPoolState.lock };
+    if (g_threadPoolState.pool)
+        return g_threadPoolState.pool->GetNumThreads();
+    else
+        return GetNumWorkerThreads(g_threadPoolState.desc);
+}
+
+LLGL_EXPORT void Shutdown()
+{
+    WorkerThreadPoolPtr oldPool;
+    {
+        std::lock_guard<std::mutex> guard{ g_threadPoolState.lock };
+        oldPool = std::move(g_threadPoolState.pool);
+    }
+}
+
+
+} // /namespace ThreadPool
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -8,7 +8,6 @@
 #include "Threading.h"
 #include <LLGL/Utils/ForRange.h>
 #include <thread>
-#include <vector>
 #include <algorithm>
 
 
@@ -16,35 +15,6 @@ namespace LLGL
 {
 
 
-static constexpr unsigned g_maxThreadCountStaticArray = 64;
-
-static void DoConcurrentRangeInWorkerContainer(
-    const std::function<void(std::size_t begin, std::size_t end)>&  task,
-    std::size_t                                                     count,
-    std::size_t                                                     workerCount,
-    std::thread*                                                    workers)
-{
-    /* Distribute work to threads */
-    const std::size_t workSize          = count / workerCount;
-    const std::size_t workSizeRemain    = count % workerCount;
-
-    std::size_t offset = 0;
-
-    for_range(i, workerCount)
-    {
-        workers[i] = std::thread(task, offset, offset + workSize);
-        offset += workSize;
-    }
-
-    /* Execute task of remaining work on main thread */
-    if (workSizeRemain > 0)
-        task(offset, offset + workSizeRemain);
-
-    /* Join worker threads */
-    for_range(i, workerCount)
-        workers[i].join();
-}
-
 static unsigned Log2Uint(unsigned n)
 {
     unsigned nLog2 = 0;
@@ -90,17 +60,21 @@ LLGL_EXPORT void DoConcurrentRange(
         /* Run single-threaded */
         task(0, count);
     }
-    else if (threadCount <= g_maxThreadCountStaticArray)
-    {
-        /* Launch worker threads in static array */
-        std::thread workers[g_maxThreadCountStaticArray];
-        DoConcurrentRangeInWorkerContainer(task, count, threadCount, workers);
-    }
-    else if (threadCount > 1)
+    else
     {
-        /* Launch worker threads in dynamic array */
-        std::vector<std::thread> workers(threadCount);
-        DoConcurrentRangeInWorkerContainer(task, count, threadCount, workers.data());
+        /* Distribute work evenly to jobs; the first jobs take one additional element each for the remainder */
+        const std::size_t workSize          = count / threadCount;
+        const std::size_t workSizeRemain    = count % threadCount;
+
+        DispatchConcurrentJobs(
+            threadCount,
+            [&task, workSize, workSizeRemain](std::size_t jobIndex)
+            {
+                const std::size_t begin = jobIndex * workSize + std::min(jobIndex, workSizeRemain);
+                const std::size_t end   = begin + workSize + (jobIndex < workSizeRemain ? 1 : 0);
+                task(begin, end);
+            }
+        );
     }
 }
 
@@ -11,7 +11,9 @@
 
 #include <LLGL/Export.h>
 #include <LLGL/Constants.h>
+#include <LLGL/ThreadPool.h>
 #include <functional>
+#include <memory>
 #include <cstddef>
 
 
@@ -19,6 +21,9 @@ namespace LLGL
 {
 
 
+// Runs the specified number of jobs on the process-wide worker thread pool or the host application's job system and waits until all of them have finished.
+LLGL_EXPORT void DispatchConcurrentJobs(std::size_t numJobs, const ThreadPool::JobFunction& job);
+
 LLGL_EXPORT void DoConcurrentRange(
     const std::function<void(std::size_t begin, std::size_t end)>&  task,
     std::size_t                                                     count,
@@ -33,6 +38,39 @@ LLGL_EXPORT void DoConcurrent(
     unsigned                                        threadMinWorkSize   = 64
 );
 
+// Runs the specified job on a worker thread of the process-wide thread pool without waiting for it. Runs the job on the calling thread if the pool has no worker threads.
+LLGL_EXPORT void DispatchAsyncJob(const std::function<void()>& job);
+
+// Handle for a single job that runs asynchronously via DispatchAsyncJob. The destructor waits for the job to finish.
+class LLGL_EXPORT AsyncJob
+{
+
+    public:
+
+        AsyncJob() = default;
+
+        AsyncJob(const AsyncJob&) = delete;
+        AsyncJob& operator = (const AsyncJob&) = delete;
+
+        ~AsyncJob();
+
+        // Starts the specified task. A previously started task is waited for first.
+        void Start(const std::function<void()>& task);
+
+        // Returns true if no task has been started or the task has finished. This never blocks.
+        bool IsDone() const;
+
+        // Blocks until the task has finished.
+        void Wait();
+
+    private:
+
+        struct SharedState;
+
+        std::shared_ptr<SharedState> state_;
+
+};
+
 
 } // /namespace LLGL
 
@@ -26,6 +26,13 @@ LLGL_EXPORT const char* ToString(const ShaderType val)
         case T::Geometry:       return "geometry";
         case T::Fragment:       return "fragment";
         case T::Compute:        return "compute";
+        case T::Task:           return "task";
+        case T::Mesh:           return "mesh";
+        case T::Tile:           return "tile";
+        case T::RayGeneration:  return "ray generation";
+        case T::Miss:           return "miss";
+        case T::ClosestHit:     return "closest hit";
+        case T::AnyHit:         return "any hit";
     }
 
     return nullptr;
@@ -122,6 +129,8 @@ LLGL_EXPORT const char* ToString(const ShadingLanguage val)
         case T::SPIRV:      return "SPIR-V";
         case T::SPIRV_100:  return "SPIR-V 1.00";
 
+        case T::WGSL:       return "WGSL";
+
         default:            break;
     }
 
@@ -241,6 +250,10 @@ LLGL_EXPORT const char* ToString(const Format val)
         LLGL_CASE_TO_STR_TYPED( Format, BC4SNorm          );
         LLGL_CASE_TO_STR_TYPED( Format, BC5UNorm          );
         LLGL_CASE_TO_STR_TYPED( Format, BC5SNorm          );
+        LLGL_CASE_TO_STR_TYPED( Format, BC6HUFloat        );
+        LLGL_CASE_TO_STR_TYPED( Format, BC6HSFloat        );
+        LLGL_CASE_TO_STR_TYPED( Format, BC7UNorm          );
+        LLGL_CASE_TO_STR_TYPED( Format, BC7UNorm_sRGB     );
 
         /* --- Advanced scalable texture compression (ASTC) formats --- */
         LLGL_CASE_TO_STR_TYPED( Format, ASTC4x4           );
@@ -276,6 +289,30 @@ LLGL_EXPORT const char* ToString(const Format val)
         LLGL_CASE_TO_STR_TYPED( Format, ETC1UNorm         );
         LLGL_CASE_TO_STR_TYPED( Format, ETC2UNorm         );
         LLGL_CASE_TO_STR_TYPED( Format, ETC2UNorm_sRGB    );
+        LLGL_CASE_TO_STR_TYPED( Format, ETC2A1UNorm       );
+        LLGL_CASE_TO_STR_TYPED( Format, ETC2A1UNorm_sRGB  );
+        LLGL_CASE_TO_STR_TYPED( Format, ETC2A8UNorm       );
+        LLGL_CASE_TO_STR_TYPED( Format, ETC2A8UNorm_sRGB  );
+        LLGL_CASE_TO_STR_TYPED( Format, EACR11UNorm       );
+        LLGL_CASE_TO_STR_TYPED( Format, EACR11SNorm       );
+        LLGL_CASE_TO_STR_TYPED( Format, EACRG11UNorm      );
+        LLGL_CASE_TO_STR_TYPED( Format, EACRG11SNorm      );
+
+        /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC4x4Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC5x4Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC5x5Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC6x5Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC6x6Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC8x5Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC8x6Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC8x8Float      );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC10x5Float     );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC10x6Float     );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC10x8Float     );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC10x10Float    );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC12x10Float    );
+        LLGL_CASE_TO_STR_TYPED( Format, ASTC12x12Float    );
     }
 
     return nullptr;
@@ -407,6 +444,7 @@ LLGL_EXPORT const char* ToString(const QueryType val)
         LLGL_CASE_TO_STR_TYPED( QueryType, StreamOutPrimitivesWritten   );
         LLGL_CASE_TO_STR_TYPED( QueryType, StreamOutOverflow            );
         LLGL_CASE_TO_STR_TYPED( QueryType, PipelineStatistics           );
+        LLGL_CASE_TO_STR_TYPED( QueryType, Timestamp                    );
     }
     return nullptr;
 }
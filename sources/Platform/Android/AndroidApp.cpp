@@ -8,6 +8,7 @@
 #include "AndroidApp.h"
 #include "AndroidInputEventHandler.h"
 #include "../../Core/Assertion.h"
+#include <jni.h>
 #include <thread>
 
 
@@ -143,6 +144,78 @@ Extent2D AndroidApp::GetContentRectSize(android_app* appState)
     return Extent2D{};
 }
 
+// Calls Activity.getWindowManager().getDefaultDisplay().getRotation() and returns the Surface.ROTATION_* value or 0 on failure.
+static jint QueryDisplayRotation(JNIEnv* env, jobject activity)
+{
+    jint rotation = 0;
+
+    jclass activityClass = env->GetObjectClass(activity);
+    jmethodID getWindowManager = env->GetMethodID(activityClass, "getWindowManager", "()Landroid/view/WindowManager;");
+    jobject windowManager = env->CallObjectMethod(activity, getWindowManager);
+
+    if (windowManager != nullptr)
+    {
+        jclass windowManagerClass = env->FindClass("android/view/WindowManager");
+        jmethodID getDefaultDisplay = env->GetMethodID(windowManagerClass, "getDefaultDisplay", "()Landroid/view/Display;");
+        jobject display = env->CallObjectMethod(windowManager, getDefaultDisplay);
+
+        if (display != nullptr)
+        {
+            jclass displayClass = env->FindClass("android/view/Display");
+            jmethodID getRotation = env->GetMethodID(displayClass, "getRotation", "()I");
+            rotation = env->CallIntMethod(display, getRotation);
+            env->DeleteLocalRef(displayClass);
+            env->DeleteLocalRef(display);
+        }
+
+        env->DeleteLocalRef(windowManagerClass);
+        env->DeleteLocalRef(windowManager);
+    }
+
+    env->DeleteLocalRef(activityClass);
+
+    /* Don't leave any pending Java exception behind, e.g. if a method was not found */
+    if (env->ExceptionCheck())
+    {
+        env->ExceptionClear();
+        return 0;
+    }
+
+    return rotation;
+}
+
+SurfaceTransform AndroidApp::GetDisplayRotation(android_app* appState)
+{
+    if (appState == nullptr || appState->activity == nullptr)
+        return SurfaceTransform::Identity;
+
+    /* The app thread of native_app_glue is not attached to the Java VM by default */
+    JavaVM* vm = appState->activity->vm;
+    JNIEnv* env = nullptr;
+    bool isAttached = false;
+
+    if (vm->GetEnv(reinterpret_cast<void**>(&env), JNI_VERSION_1_6) != JNI_OK)
+    {
+        if (vm->AttachCurrentThread(&env, nullptr) != JNI_OK)
+            return SurfaceTransform::Identity;
+        isAttached = true;
+    }
+
+    const jint rotation = QueryDisplayRotation(env, appState->activity->clazz);
+
+    if (isAttached)
+        vm->DetachCurrentThread();
+
+    /* Surface.ROTATION_0 to Surface.ROTATION_270 are the values 0 to 3 */
+    switch (rotation)
+    {
+        case 1:     return SurfaceTransform::Rotate90;
+        case 2:     return SurfaceTransform::Rotate180;
+        case 3:     return SurfaceTransform::Rotate270;
+        default:    return SurfaceTransform::Identity;
+    }
+}
+
 
 } // /namespace LLGL
 
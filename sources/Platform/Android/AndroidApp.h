@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Types.h>
+#include <LLGL/SwapChainFlags.h>
 #include <android_native_app_glue.h>
 
 
@@ -31,6 +32,9 @@ class AndroidApp
         // Returns the size of the content rect of the specified Android app state.
         static Extent2D GetContentRectSize(android_app* appState);
 
+        // Returns the rotation of the default display relative to its natural orientation via android.view.Display.getRotation().
+        static SurfaceTransform GetDisplayRotation(android_app* appState);
+
         // Initializes the Android app state. This should be called once when the device is created.
         void Initialize(android_app* state);
 
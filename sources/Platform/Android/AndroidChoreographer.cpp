@@ -0,0 +1,120 @@
+/*
+ * AndroidChoreographer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "AndroidChoreographer.h"
+#include <algorithm>
+#include <time.h>
+
+
+namespace LLGL
+{
+
+
+static std::int64_t GetMonotonicTimeNanos()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000ll + static_cast<std::int64_t>(ts.tv_nsec);
+}
+
+#if __ANDROID_API__ >= 29
+
+static void AndroidChoreographerFrameCallback(std::int64_t frameTimeNanos, void* userData)
+{
+    reinterpret_cast<AndroidChoreographer*>(userData)->OnVsync(frameTimeNanos);
+}
+
+#elif __ANDROID_API__ >= 24
+
+// Legacy callback before API level 29; this truncates the time stamp on 32-bit ABIs, so only the lower 32 bits are reliable there
+static void AndroidChoreographerFrameCallback(long frameTimeNanos, void* userData)
+{
+    reinterpret_cast<AndroidChoreographer*>(userData)->OnVsync(static_cast<std::int64_t>(frameTimeNanos));
+}
+
+#endif
+
+AndroidChoreographer& AndroidChoreographer::Get()
+{
+    static AndroidChoreographer instance;
+    return instance;
+}
+
+bool AndroidChoreographer::Start()
+{
+    #if __ANDROID_API__ >= 24
+    if (choreographer_ == nullptr)
+    {
+        /* AChoreographer is only available on threads with an ALooper, which native_app_glue prepares for the app thread */
+        choreographer_ = AChoreographer_getInstance();
+        if (choreographer_ == nullptr)
+            return false;
+        PostFrameCallback();
+    }
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+std::int64_t AndroidChoreographer::ScheduleNextVsync(std::int64_t prevVsyncTime, std::uint32_t vsyncInterval) const
+{
+    const std::int64_t lastVsync = lastVsyncTime_.load();
+    if (lastVsync == 0)
+        return 0;
+
+    const std::int64_t period = refreshPeriod_.load();
+
+    /* Never schedule a vertical blank that has already passed, e.g. after the app was paused or the frame was late */
+    std::int64_t targetTime = std::max(prevVsyncTime + static_cast<std::int64_t>(vsyncInterval) * period, GetMonotonicTimeNanos());
+
+    /* Snap target onto the vertical blank grid of the display; rounding to the nearest one tolerates jitter of the previous target */
+    const std::int64_t numPeriods = std::max<std::int64_t>(1, (targetTime - lastVsync + period/2) / period);
+    targetTime = lastVsync + numPeriods * period;
+
+    return targetTime;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void AndroidChoreographer::PostFrameCallback()
+{
+    #if __ANDROID_API__ >= 29
+    AChoreographer_postFrameCallback64(choreographer_, AndroidChoreographerFrameCallback, this);
+    #elif __ANDROID_API__ >= 24
+    AChoreographer_postFrameCallback(choreographer_, AndroidChoreographerFrameCallback, this);
+    #endif
+}
+
+void AndroidChoreographer::OnVsync(std::int64_t frameTimeNanos)
+{
+    const std::int64_t prevVsync = lastVsyncTime_.load();
+    if (prevVsync > 0 && frameTimeNanos > prevVsync)
+    {
+        /* Distribute the interval across all vertical blanks that were missed while the looper was not polled */
+        const std::int64_t period       = refreshPeriod_.load();
+        const std::int64_t interval     = frameTimeNanos - prevVsync;
+        const std::int64_t numPeriods   = std::max<std::int64_t>(1, (interval + period/2) / period);
+
+        /* Smooth the estimate to filter out jitter of the time stamps */
+        refreshPeriod_.store(period + (interval / numPeriods - period) / 8);
+    }
+    lastVsyncTime_.store(frameTimeNanos);
+
+    /* Frame callbacks are one-shot, so request the next one right away */
+    PostFrameCallback();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
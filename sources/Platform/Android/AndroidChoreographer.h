@@ -0,0 +1,77 @@
+/*
+ * AndroidChoreographer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_ANDROID_CHOREOGRAPHER_H
+#define LLGL_ANDROID_CHOREOGRAPHER_H
+
+
+#include <android/choreographer.h>
+#include <atomic>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Singleton class to track the vertical blank timings of the display via AChoreographer.
+The frame callbacks are dispatched by the looper of the thread that started the choreographer,
+which is the app thread that polls its events in Surface::ProcessEvents.
+All time stamps are in nanoseconds of CLOCK_MONOTONIC, the same time base as VK_GOOGLE_display_timing and EGL_ANDROID_presentation_time.
+*/
+class AndroidChoreographer
+{
+
+    public:
+
+        AndroidChoreographer(const AndroidChoreographer&) = delete;
+        AndroidChoreographer& operator = (const AndroidChoreographer&) = delete;
+
+        static AndroidChoreographer& Get();
+
+        // Starts receiving frame callbacks on the looper of the calling thread. Returns false if AChoreographer is not available.
+        bool Start();
+
+        /*
+        Returns the time stamp of the earliest vertical blank that is at least 'vsyncInterval' refresh periods after 'prevVsyncTime' and not in the past.
+        Returns 0 if no vertical blank has been observed yet.
+        */
+        std::int64_t ScheduleNextVsync(std::int64_t prevVsyncTime, std::uint32_t vsyncInterval) const;
+
+        // Records the time stamp of a vertical blank. This is called by the frame callback of the choreographer.
+        void OnVsync(std::int64_t frameTimeNanos);
+
+        // Returns the estimated refresh period of the display.
+        inline std::int64_t GetRefreshPeriod() const
+        {
+            return refreshPeriod_.load();
+        }
+
+    private:
+
+        AndroidChoreographer() = default;
+
+        void PostFrameCallback();
+
+    private:
+
+        AChoreographer*             choreographer_  = nullptr;
+        std::atomic<std::int64_t>   lastVsyncTime_  { 0 };
+        std::atomic<std::int64_t>   refreshPeriod_  { 16666667 }; // Assume 60 Hz until the first vertical blanks have been observed
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
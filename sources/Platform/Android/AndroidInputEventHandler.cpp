@@ -10,6 +10,8 @@
 #include "AndroidCanvas.h"
 #include "AndroidKeyCodes.h"
 #include "../../Core/CoreUtils.h"
+#include <LLGL/RawInput.h>
+#include <LLGL/Utils/ForRange.h>
 #include <android/input.h>
 #include <android/native_activity.h>
 #include <mutex>
@@ -38,6 +40,40 @@ void AndroidInputEventHandler::UnregisterCanvas(AndroidCanvas* canvas)
     RemoveFromList(canvases_, canvas);
 }
 
+static void PostRawPenSample(float x, float y, float pressure, std::int64_t eventTime)
+{
+    RawInputEvent rawEvent;
+    {
+        rawEvent.type       = RawInputEventType::PenMotion;
+        rawEvent.x          = x;
+        rawEvent.y          = y;
+        rawEvent.pressure   = pressure;
+        rawEvent.timestamp  = static_cast<std::uint64_t>(eventTime); // Event times use CLOCK_MONOTONIC in nanoseconds just like Timer::Tick()
+    }
+    RawInput::Post(rawEvent);
+}
+
+// Posts all samples of the first pointer into the raw input queue, including the historical samples that Android batched into this motion event.
+static void PostRawPenMotion(AInputEvent* event)
+{
+    const std::size_t historySize = AMotionEvent_getHistorySize(event);
+    for_range(i, historySize)
+    {
+        PostRawPenSample(
+            AMotionEvent_getHistoricalX(event, 0, i),
+            AMotionEvent_getHistoricalY(event, 0, i),
+            AMotionEvent_getHistoricalPressure(event, 0, i),
+            AMotionEvent_getHistoricalEventTime(event, i)
+        );
+    }
+    PostRawPenSample(
+        AMotionEvent_getX(event, 0),
+        AMotionEvent_getY(event, 0),
+        AMotionEvent_getPressure(event, 0),
+        AMotionEvent_getEventTime(event)
+    );
+}
+
 #define FOREACH_CANVAS_CALL(FUNC) \
     do for (AndroidCanvas* canvas : canvases_) { canvas->FUNC; } while (false)
 
@@ -122,6 +158,13 @@ std::int32_t AndroidInputEventHandler::BroadcastInputEvent(android_app* app, AIn
             const LLGL::Offset2D position{ static_cast<std::int32_t>(posX), static_cast<std::int32_t>(posY) };
             const std::uint32_t numTouches = static_cast<std::uint32_t>(AMotionEvent_getPointerCount(event));
 
+            if (RawInput::IsEnabled())
+            {
+                const std::int32_t action = (AMotionEvent_getAction(event) & AMOTION_EVENT_ACTION_MASK);
+                if (action == AMOTION_EVENT_ACTION_DOWN || action == AMOTION_EVENT_ACTION_MOVE || action == AMOTION_EVENT_ACTION_UP)
+                    PostRawPenMotion(event);
+            }
+
             switch (AMotionEvent_getAction(event))
             {
                 case AMOTION_EVENT_ACTION_DOWN:
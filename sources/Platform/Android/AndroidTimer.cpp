@@ -7,6 +7,7 @@
 
 #include <LLGL/Timer.h>
 #include <time.h>
+#include <errno.h>
 
 
 namespace LLGL
@@ -35,6 +36,18 @@ LLGL_EXPORT std::uint64_t Tick()
     return MonotonicTimeToUInt64(t);
 }
 
+LLGL_EXPORT void SleepUntil(std::uint64_t tick)
+{
+    /* Sleep with an absolute deadline on the same clock as Tick(), so interruptions by signals don't accumulate any drift */
+    timespec t;
+    t.tv_sec    = static_cast<time_t>(tick / g_nsecFrequency);
+    t.tv_nsec   = static_cast<long>(tick % g_nsecFrequency);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, nullptr) == EINTR)
+    {
+        /* Continue sleeping after interruption */
+    }
+}
+
 
 } // /namespace Timer
 
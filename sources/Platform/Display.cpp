@@ -13,6 +13,12 @@ namespace LLGL
 {
 
 
+bool Display::SupportsVariableRefreshRate() const
+{
+    return false; // dummy
+}
+
+
 /*
  * ======= Protected: =======
  */
@@ -0,0 +1,36 @@
+/*
+ * LinuxThreadAffinity.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../ThreadAffinity.h"
+#include <sched.h>
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT bool SetCurrentThreadAffinity(std::uint64_t affinityMask)
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    for (int i = 0; i < 64 && i < CPU_SETSIZE; ++i)
+    {
+        if ((affinityMask & (1ull << i)) != 0)
+            CPU_SET(i, &cpuSet);
+    }
+
+    /* PID 0 refers to the calling thread */
+    return (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -7,6 +7,8 @@
 
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Display.h>
+#include <LLGL/RawInput.h>
+#include <LLGL/Timer.h>
 #include "LinuxWindow.h"
 #include "MapKey.h"
 #include "../../Core/CoreUtils.h"
@@ -367,6 +369,22 @@ void LinuxWindow::OpenX11Window()
     XSetWMProtocols(display_, wnd_, &closeWndAtom_, 1);
 }
 
+static void PostRawInputEvent(RawInputEventType type, Key key, float x, float y)
+{
+    if (!RawInput::IsEnabled())
+        return;
+
+    RawInputEvent event;
+    {
+        event.type      = type;
+        event.key       = key;
+        event.x         = x;
+        event.y         = y;
+        event.timestamp = Timer::Tick();
+    }
+    RawInput::Post(event);
+}
+
 void LinuxWindow::ProcessKeyEvent(XKeyEvent& event, bool down)
 {
     auto key = MapKey(event);
@@ -390,9 +408,13 @@ void LinuxWindow::ProcessMouseKeyEvent(XButtonEvent& event, bool down)
             PostMouseKeyEvent(Key::RButton, down);
             break;
         case Button4:
+            if (down)
+                PostRawInputEvent(RawInputEventType::MouseWheel, Key::Any, 0.0f, 1.0f);
             PostWheelMotion(1);
             break;
         case Button5:
+            if (down)
+                PostRawInputEvent(RawInputEventType::MouseWheel, Key::Any, 0.0f, -1.0f);
             PostWheelMotion(-1);
             break;
     }
@@ -422,13 +444,16 @@ void LinuxWindow::ProcessClientMessage(XClientMessageEvent& event)
 void LinuxWindow::ProcessMotionEvent(XMotionEvent& event)
 {
     const Offset2D mousePos { event.x, event.y };
+    const Offset2D motion   { mousePos.x - prevMousePos_.x, mousePos.y - prevMousePos_.y };
+    PostRawInputEvent(RawInputEventType::MouseMotion, Key::Any, static_cast<float>(motion.x), static_cast<float>(motion.y));
     PostLocalMotion(mousePos);
-    PostGlobalMotion({ mousePos.x - prevMousePos_.x, mousePos.y - prevMousePos_.y });
+    PostGlobalMotion(motion);
     prevMousePos_ = mousePos;
 }
 
 void LinuxWindow::PostMouseKeyEvent(Key key, bool down)
 {
+    PostRawInputEvent((down ? RawInputEventType::ButtonDown : RawInputEventType::ButtonUp), key, 0.0f, 0.0f);
     if (down)
         PostKeyDown(key);
     else
@@ -39,6 +39,8 @@ class MacOSDisplay final : public Display
 
         std::vector<DisplayMode> GetSupportedDisplayModes() const override;
 
+        bool SupportsVariableRefreshRate() const override;
+
     public:
 
         // Returns the native display ID.
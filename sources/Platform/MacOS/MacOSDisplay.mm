@@ -366,6 +366,23 @@ std::vector<DisplayMode> MacOSDisplay::GetSupportedDisplayModes() const
     return displayModes;
 }
 
+bool MacOSDisplay::SupportsVariableRefreshRate() const
+{
+    #if MAC_OS_X_VERSION_MAX_ALLOWED >= 120000
+    if (@available(macOS 12.0, *))
+    {
+        /* Find screen of this display; Displays with variable refresh rates have a range of refresh intervals */
+        for (NSScreen* screen in [NSScreen screens])
+        {
+            NSNumber* screenNumber = [[screen deviceDescription] objectForKey:@"NSScreenNumber"];
+            if (screenNumber != nil && [screenNumber unsignedIntValue] == displayID_)
+                return ([screen maximumRefreshInterval] > [screen minimumRefreshInterval]);
+        }
+    }
+    #endif
+    return false;
+}
+
 
 } // /namespace LLGL
 
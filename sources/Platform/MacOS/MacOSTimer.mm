@@ -33,6 +33,15 @@ LLGL_EXPORT std::uint64_t Tick()
         return 0;
 }
 
+LLGL_EXPORT void SleepUntil(std::uint64_t tick)
+{
+    /* Convert nanoseconds back into absolute Mach time units */
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+    if (timebase.numer > 0)
+        mach_wait_until((tick * timebase.denom) / timebase.numer);
+}
+
 
 } // /namespace Timer
 
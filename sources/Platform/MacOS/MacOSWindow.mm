@@ -13,6 +13,8 @@
 #include "MapKey.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
+#include <LLGL/RawInput.h>
+#include <LLGL/Timer.h>
 #include <cstdlib>
 
 #import <Cocoa/Cocoa.h>
@@ -499,8 +501,25 @@ void MacOSWindow::ProcessKeyEvent(NSEvent* event, bool down)
         PostKeyUp(key);
 }
 
+static void PostRawInputEvent(RawInputEventType type, Key key, CGFloat x, CGFloat y)
+{
+    if (!RawInput::IsEnabled())
+        return;
+
+    RawInputEvent event;
+    {
+        event.type      = type;
+        event.key       = key;
+        event.x         = static_cast<float>(x);
+        event.y         = static_cast<float>(y);
+        event.timestamp = Timer::Tick();
+    }
+    RawInput::Post(event);
+}
+
 void MacOSWindow::ProcessMouseKeyEvent(Key key, bool down)
 {
+    PostRawInputEvent((down ? RawInputEventType::ButtonDown : RawInputEventType::ButtonUp), key, 0.0, 0.0);
     if (down)
         PostKeyDown(key);
     else
@@ -509,6 +528,9 @@ void MacOSWindow::ProcessMouseKeyEvent(Key key, bool down)
 
 void MacOSWindow::ProcessMouseMoveEvent(NSEvent* event)
 {
+    /* Post raw mouse motion; The event deltas are not clamped at the screen borders unlike the cursor location */
+    PostRawInputEvent(RawInputEventType::MouseMotion, Key::Any, [event deltaX], [event deltaY]);
+
     NSPoint nativePos = [event locationInWindow];
 
     /* Post local mouse motion */
@@ -533,6 +555,7 @@ void MacOSWindow::ProcessMouseMoveEvent(NSEvent* event)
 void MacOSWindow::ProcessMouseWheelEvent(NSEvent* event)
 {
     CGFloat motion = [event deltaY];
+    PostRawInputEvent(RawInputEventType::MouseWheel, Key::Any, 0.0, motion);
     PostWheelMotion(static_cast<int>(motion * 5.0f));
 }
 
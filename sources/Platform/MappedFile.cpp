@@ -0,0 +1,154 @@
+/*
+ * MappedFile.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MappedFile.h"
+#include "../Core/StringUtils.h"
+
+#if defined LLGL_OS_WIN32
+#   include "Win32/Win32LeanAndMean.h"
+#   include <Windows.h>
+#elif defined LLGL_OS_LINUX || defined LLGL_OS_MACOS || defined LLGL_OS_IOS || defined LLGL_OS_ANDROID
+#   define LLGL_MAPPED_FILE_POSIX
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+#if defined LLGL_OS_WIN32
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename)
+{
+    HANDLE file = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
+
+    LARGE_INTEGER fileSize;
+    if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        ::CloseHandle(file);
+        return nullptr;
+    }
+
+    HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        ::CloseHandle(file);
+        return nullptr;
+    }
+
+    const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        ::CloseHandle(mapping);
+        ::CloseHandle(file);
+        return nullptr;
+    }
+
+    std::unique_ptr<MappedFile> mappedFile{ new MappedFile{} };
+    {
+        mappedFile->data_       = view;
+        mappedFile->size_       = static_cast<std::size_t>(fileSize.QuadPart);
+        mappedFile->fileHandle_ = file;
+        mappedFile->mapHandle_  = mapping;
+    }
+    return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+    if (fileHandle_ != nullptr)
+    {
+        ::UnmapViewOfFile(data_);
+        ::CloseHandle(mapHandle_);
+        ::CloseHandle(fileHandle_);
+    }
+}
+
+#elif defined LLGL_MAPPED_FILE_POSIX
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename)
+{
+    const int fd = ::open(filename, O_RDONLY);
+    if (fd == -1)
+    {
+        #ifdef LLGL_OS_ANDROID
+        /* Files that are not on the file system are read from the APK assets */
+        std::unique_ptr<MappedFile> mappedFile{ new MappedFile{} };
+        mappedFile->fallback_ = ReadFileBuffer(filename);
+        if (mappedFile->fallback_.empty())
+            return nullptr;
+
+        mappedFile->data_ = mappedFile->fallback_.data();
+        mappedFile->size_ = mappedFile->fallback_.size();
+        return mappedFile;
+        #else
+        return nullptr;
+        #endif
+    }
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        ::close(fd);
+        return nullptr;
+    }
+
+    /* The mapping remains valid after the file descriptor has been closed */
+    const std::size_t size = static_cast<std::size_t>(fileStat.st_size);
+    void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (view == MAP_FAILED)
+        return nullptr;
+
+    std::unique_ptr<MappedFile> mappedFile{ new MappedFile{} };
+    {
+        mappedFile->data_ = view;
+        mappedFile->size_ = size;
+    }
+    return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+    if (fallback_.empty() && data_ != nullptr)
+        ::munmap(const_cast<void*>(data_), size_);
+}
+
+#else
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* filename)
+{
+    /* Read entire file into memory on platforms without file mapping */
+    std::unique_ptr<MappedFile> mappedFile{ new MappedFile{} };
+    mappedFile->fallback_ = ReadFileBuffer(filename);
+    if (mappedFile->fallback_.empty())
+        return nullptr;
+
+    mappedFile->data_ = mappedFile->fallback_.data();
+    mappedFile->size_ = mappedFile->fallback_.size();
+    return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+#endif
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
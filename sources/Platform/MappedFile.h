@@ -0,0 +1,79 @@
+/*
+ * MappedFile.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MAPPED_FILE_H
+#define LLGL_MAPPED_FILE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/NonCopyable.h>
+#include <LLGL/Platform/Platform.h>
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Read-only view of an entire file.
+The file is mapped into the address space of the process where the platform supports it,
+otherwise its content is read into memory once.
+*/
+class LLGL_EXPORT MappedFile : public NonCopyable
+{
+
+    public:
+
+        // Maps the specified file for read access. Returns null if the file does not exist or is empty.
+        static std::unique_ptr<MappedFile> Open(const char* filename);
+
+    public:
+
+        ~MappedFile();
+
+        // Returns a pointer to the beginning of the file content.
+        inline const void* GetData() const
+        {
+            return data_;
+        }
+
+        // Returns the size (in bytes) of the file content.
+        inline std::size_t GetSize() const
+        {
+            return size_;
+        }
+
+    private:
+
+        MappedFile() = default;
+
+    private:
+
+        const void*         data_       = nullptr;
+        std::size_t         size_       = 0;
+
+        #if defined LLGL_OS_WIN32
+        void*               fileHandle_ = nullptr;
+        void*               mapHandle_  = nullptr;
+        #endif
+
+        std::vector<char>   fallback_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,8 +6,16 @@
  */
 
 #include "Path.h"
+#include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/Strings.h>
+#include <errno.h>
+
+#if defined LLGL_OS_WIN32 || defined LLGL_OS_UWP
+#   include <direct.h>
+#else
+#   include <sys/stat.h>
+#endif
 
 
 namespace LLGL
@@ -70,6 +78,35 @@ LLGL_EXPORT UTF8String Combine(const UTF8String& lhs, const UTF8String& rhs)
     return Sanitize(Sanitize(lhs) + UTF8String{ sep } + Sanitize(rhs));
 }
 
+// Creates a single directory and returns true if it exists after this call.
+static bool MakeSingleDirectory(const char* path)
+{
+    #if defined LLGL_OS_WIN32 || defined LLGL_OS_UWP
+    return (::_mkdir(path) == 0 || errno == EEXIST);
+    #else
+    return (::mkdir(path, 0755) == 0 || errno == EEXIST);
+    #endif
+}
+
+LLGL_EXPORT bool MakeDirectories(const UTF8String& path)
+{
+    const std::string s = Sanitize(path).c_str();
+    if (s.empty())
+        return false;
+
+    /* Create each parent directory in order; skip the leading separator of absolute paths */
+    for (std::size_t i = 1; i < s.size(); ++i)
+    {
+        if (s[i] == GetSeparator() && s[i - 1] != ':')
+        {
+            if (!MakeSingleDirectory(s.substr(0, i).c_str()))
+                return false;
+        }
+    }
+
+    return MakeSingleDirectory(s.c_str());
+}
+
 
 } // /nameapace Path
 
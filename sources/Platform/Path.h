@@ -40,6 +40,10 @@ LLGL_EXPORT UTF8String GetWorkingDir();
 // Returns the input filename as absolute path.
 LLGL_EXPORT UTF8String GetAbsolutePath(const UTF8String& filename);
 
+// Creates the specified directory including all of its parent directories that do not exist yet.
+// Returns true if the directory exists after this call.
+LLGL_EXPORT bool MakeDirectories(const UTF8String& path);
+
 
 } // /nameapace Path
 
@@ -0,0 +1,128 @@
+/*
+ * RawInput.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/RawInput.h>
+#include <vector>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+namespace RawInput
+{
+
+
+// Ring buffer of raw input events; The capacity is always a power of two, so indices can be wrapped with a bit mask.
+struct RawInputQueue
+{
+    std::vector<RawInputEvent>  events;
+    std::size_t                 mask        = 0;
+    std::size_t                 first       = 0;
+    std::size_t                 count       = 0;
+    std::uint64_t               numDropped  = 0;
+};
+
+static RawInputQueue g_rawInputQueue;
+
+static std::size_t RoundUpToPowerOfTwo(std::size_t x)
+{
+    std::size_t y = 1;
+    while (y < x)
+        y <<= 1;
+    return y;
+}
+
+LLGL_EXPORT void SetQueueCapacity(std::size_t capacity)
+{
+    RawInputQueue& queue = g_rawInputQueue;
+    if (capacity > 0)
+    {
+        const std::size_t alignedCapacity = RoundUpToPowerOfTwo(capacity);
+        queue.events.resize(alignedCapacity);
+        queue.mask = alignedCapacity - 1;
+    }
+    else
+    {
+        queue.events.clear();
+        queue.events.shrink_to_fit();
+        queue.mask = 0;
+    }
+    queue.first         = 0;
+    queue.count         = 0;
+    queue.numDropped    = 0;
+}
+
+LLGL_EXPORT std::size_t GetQueueCapacity()
+{
+    return g_rawInputQueue.events.size();
+}
+
+LLGL_EXPORT std::size_t Drain(RawInputEvent* outEvents, std::size_t maxEvents)
+{
+    RawInputQueue& queue = g_rawInputQueue;
+
+    const std::size_t numEvents = std::min(maxEvents, queue.count);
+    if (numEvents == 0)
+        return 0;
+
+    /* Copy events in at most two contiguous ranges, since the queued events might wrap around the end of the ring buffer */
+    const std::size_t numEventsToEnd    = std::min(numEvents, queue.events.size() - queue.first);
+    const RawInputEvent* events         = queue.events.data();
+    std::copy(events + queue.first, events + queue.first + numEventsToEnd, outEvents);
+    std::copy(events, events + (numEvents - numEventsToEnd), outEvents + numEventsToEnd);
+
+    queue.first = (queue.first + numEvents) & queue.mask;
+    queue.count -= numEvents;
+
+    return numEvents;
+}
+
+LLGL_EXPORT std::uint64_t GetNumDroppedEvents()
+{
+    return g_rawInputQueue.numDropped;
+}
+
+LLGL_EXPORT void Post(const RawInputEvent& event)
+{
+    RawInputQueue& queue = g_rawInputQueue;
+
+    if (queue.events.empty())
+        return;
+
+    if (queue.count < queue.events.size())
+    {
+        queue.events[(queue.first + queue.count) & queue.mask] = event;
+        ++queue.count;
+        return;
+    }
+
+    /* Queue is full: Accumulate relative mouse motion into the most recent event, so the overall motion is not lost */
+    RawInputEvent& lastEvent = queue.events[(queue.first + queue.count - 1) & queue.mask];
+    if (event.type == RawInputEventType::MouseMotion && lastEvent.type == RawInputEventType::MouseMotion)
+    {
+        lastEvent.x         += event.x;
+        lastEvent.y         += event.y;
+        lastEvent.timestamp = event.timestamp;
+    }
+    else
+        ++queue.numDropped;
+}
+
+LLGL_EXPORT bool IsEnabled()
+{
+    return !g_rawInputQueue.events.empty();
+}
+
+
+} // /namespace RawInput
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,31 @@
+/*
+ * ThreadAffinity.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_THREAD_AFFINITY_H
+#define LLGL_THREAD_AFFINITY_H
+
+
+#include <LLGL/Export.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Restricts the calling thread to the logical processors in the specified bit mask. Returns false if thread affinity is not supported by the platform.
+LLGL_EXPORT bool SetCurrentThreadAffinity(std::uint64_t affinityMask);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,25 @@
+/*
+ * UWPThreadAffinity.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../ThreadAffinity.h"
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT bool SetCurrentThreadAffinity(std::uint64_t /*affinityMask*/)
+{
+    return false; // not supported on this platform
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
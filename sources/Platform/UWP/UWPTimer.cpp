@@ -91,6 +91,54 @@ LLGL_EXPORT std::uint64_t Tick()
     return highResTick.QuadPart;
 }
 
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+// Waitable timer that is created once per thread, so concurrent sleeps don't interfere with each other.
+struct Win32WaitableTimer
+{
+    Win32WaitableTimer()
+    {
+        /* High resolution timers are only available since Windows 10 version 1803, so fall back to a default timer */
+        handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (handle == nullptr)
+            handle = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+    }
+
+    ~Win32WaitableTimer()
+    {
+        if (handle != nullptr)
+            CloseHandle(handle);
+    }
+
+    HANDLE handle = nullptr;
+};
+
+LLGL_EXPORT void SleepUntil(std::uint64_t tick)
+{
+    const std::uint64_t currentTick = Tick();
+    if (tick <= currentTick)
+        return;
+
+    /* Convert remaining ticks into 100 nanosecond intervals; Negative due times are relative to the current time */
+    static const LONGLONG frequency = GetPerformanceFrequencyQuadPart();
+    const std::uint64_t remainingTicks = tick - currentTick;
+    const LONGLONG remainingIntervals = static_cast<LONGLONG>(
+        (remainingTicks / frequency) * 10000000ull + (remainingTicks % frequency) * 10000000ull / frequency
+    );
+    if (remainingIntervals == 0)
+        return;
+
+    thread_local Win32WaitableTimer timer;
+    LARGE_INTEGER dueTime;
+    dueTime.QuadPart = -remainingIntervals;
+    if (timer.handle != nullptr && SetWaitableTimer(timer.handle, &dueTime, 0, nullptr, nullptr, FALSE))
+        WaitForSingleObject(timer.handle, INFINITE);
+    else
+        Sleep(static_cast<DWORD>(remainingIntervals / 10000));
+}
+
 
 } // /namespace Timer
 
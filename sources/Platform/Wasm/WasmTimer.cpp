@@ -35,6 +35,11 @@ LLGL_EXPORT std::uint64_t Tick()
     return MonotonicTimeToUInt64(t);
 }
 
+LLGL_EXPORT void SleepUntil(std::uint64_t /*tick*/)
+{
+    /* Blocking the browser's main thread is not allowed; Frames are paced by the browser's animation frame callbacks */
+}
+
 
 } // /namespace Timer
 
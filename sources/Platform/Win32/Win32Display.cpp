@@ -7,6 +7,7 @@
 
 #include "Win32Display.h"
 #include "../../Core/CoreUtils.h"
+#include <dxgi1_5.h>
 #include <algorithm>
 
 
@@ -59,6 +60,36 @@ static void Convert(DEVMODE& dst, const DisplayMode& src)
     dst.dmDisplayFrequency  = static_cast<DWORD>(src.refreshRate);
 }
 
+// Returns true if DXGI allows presentations with tearing, which is required for variable refresh rates in windowed mode.
+static bool IsDXGITearingSupported()
+{
+    typedef HRESULT (WINAPI *PFN_CREATEDXGIFACTORY1)(REFIID, void**);
+
+    BOOL tearingSupported = FALSE;
+
+    /* Load DXGI dynamically, so the platform layer doesn't depend on it */
+    if (HMODULE dxgiModule = LoadLibraryW(L"dxgi.dll"))
+    {
+        auto CreateDXGIFactory1Proc = reinterpret_cast<PFN_CREATEDXGIFACTORY1>(GetProcAddress(dxgiModule, "CreateDXGIFactory1"));
+        IDXGIFactory1* factory1 = nullptr;
+        if (CreateDXGIFactory1Proc != nullptr && SUCCEEDED(CreateDXGIFactory1Proc(IID_PPV_ARGS(&factory1))))
+        {
+            /* Tearing support can only be queried with DXGI 1.5 */
+            IDXGIFactory5* factory5 = nullptr;
+            if (SUCCEEDED(factory1->QueryInterface(IID_PPV_ARGS(&factory5))))
+            {
+                if (FAILED(factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING, &tearingSupported, sizeof(tearingSupported))))
+                    tearingSupported = FALSE;
+                factory5->Release();
+            }
+            factory1->Release();
+        }
+        FreeLibrary(dxgiModule);
+    }
+
+    return (tearingSupported != FALSE);
+}
+
 static BOOL CALLBACK Win32MonitorChangedEnumProc(HMONITOR monitor, HDC hDC, LPRECT rect, LPARAM data)
 {
     auto& info = *reinterpret_cast<MonitorChangedInfo*>(data);
@@ -348,6 +379,13 @@ std::vector<DisplayMode> Win32Display::GetSupportedDisplayModes() const
     return displayModes;
 }
 
+bool Win32Display::SupportsVariableRefreshRate() const
+{
+    /* Tearing support applies to all displays and can't change while the process is running */
+    static const bool tearingSupported = IsDXGITearingSupported();
+    return tearingSupported;
+}
+
 
 /*
  * ======= Private: =======
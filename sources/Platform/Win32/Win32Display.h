@@ -38,6 +38,8 @@ class Win32Display final : public Display
 
         std::vector<DisplayMode> GetSupportedDisplayModes() const override;
 
+        bool SupportsVariableRefreshRate() const override;
+
     public:
 
         // Returns the native display handle as HMONITOR.
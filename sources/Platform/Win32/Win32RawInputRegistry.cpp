@@ -8,6 +8,8 @@
 #include "Win32RawInputRegistry.h"
 #include "Win32Window.h"
 #include "../../Core/CoreUtils.h"
+#include <LLGL/RawInput.h>
+#include <LLGL/Timer.h>
 
 #include <windowsx.h>
 
@@ -25,31 +27,76 @@ namespace LLGL
 #endif
 
 
-static void PostGlobalMouseMotion(HWND wnd, LPARAM lParam)
+static void PostRawMouseButton(std::uint64_t timestamp, USHORT buttonFlags, USHORT downFlag, USHORT upFlag, Key key)
 {
-    /* Get window object from window handle */
-    if (Win32Window* window = Win32Window::GetFromUserData(wnd))
+    RawInputEvent event;
+    {
+        event.key       = key;
+        event.timestamp = timestamp;
+    }
+    if ((buttonFlags & downFlag) != 0)
     {
-        RAWINPUT raw;
-        UINT rawSize = sizeof(raw);
+        event.type = RawInputEventType::ButtonDown;
+        RawInput::Post(event);
+    }
+    if ((buttonFlags & upFlag) != 0)
+    {
+        event.type = RawInputEventType::ButtonUp;
+        RawInput::Post(event);
+    }
+}
 
-        GetRawInputData(
-            reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT,
-            &raw, &rawSize, sizeof(RAWINPUTHEADER)
-        );
+// Copies the raw mouse input into the raw input queue without dispatching it to any event listener.
+static void PostRawMouseInput(const RAWMOUSE& mouse)
+{
+    const std::uint64_t timestamp = Timer::Tick();
 
-        if (raw.header.dwType == RIM_TYPEMOUSE)
+    if (mouse.usFlags == MOUSE_MOVE_RELATIVE && (mouse.lLastX != 0 || mouse.lLastY != 0))
+    {
+        RawInputEvent event;
         {
-            const RAWMOUSE& mouse = raw.data.mouse;
+            event.type      = RawInputEventType::MouseMotion;
+            event.x         = static_cast<float>(mouse.lLastX);
+            event.y         = static_cast<float>(mouse.lLastY);
+            event.timestamp = timestamp;
+        }
+        RawInput::Post(event);
+    }
 
-            if (mouse.usFlags == MOUSE_MOVE_RELATIVE)
-            {
-                /* Post global mouse motion event */
-                int dx = mouse.lLastX;
-                int dy = mouse.lLastY;
+    const USHORT buttonFlags = mouse.usButtonFlags;
+    if (buttonFlags == 0)
+        return;
 
-                window->PostGlobalMotion({ dx, dy });
-            }
+    PostRawMouseButton(timestamp, buttonFlags, RI_MOUSE_LEFT_BUTTON_DOWN,   RI_MOUSE_LEFT_BUTTON_UP,    Key::LButton);
+    PostRawMouseButton(timestamp, buttonFlags, RI_MOUSE_RIGHT_BUTTON_DOWN,  RI_MOUSE_RIGHT_BUTTON_UP,   Key::RButton);
+    PostRawMouseButton(timestamp, buttonFlags, RI_MOUSE_MIDDLE_BUTTON_DOWN, RI_MOUSE_MIDDLE_BUTTON_UP,  Key::MButton);
+    PostRawMouseButton(timestamp, buttonFlags, RI_MOUSE_BUTTON_4_DOWN,      RI_MOUSE_BUTTON_4_UP,       Key::XButton1);
+    PostRawMouseButton(timestamp, buttonFlags, RI_MOUSE_BUTTON_5_DOWN,      RI_MOUSE_BUTTON_5_UP,       Key::XButton2);
+
+    if ((buttonFlags & RI_MOUSE_WHEEL) != 0)
+    {
+        RawInputEvent event;
+        {
+            event.type      = RawInputEventType::MouseWheel;
+            event.y         = static_cast<float>(static_cast<SHORT>(mouse.usButtonData)) / static_cast<float>(WHEEL_DELTA);
+            event.timestamp = timestamp;
+        }
+        RawInput::Post(event);
+    }
+}
+
+static void PostGlobalMouseMotion(HWND wnd, const RAWMOUSE& mouse)
+{
+    /* Get window object from window handle */
+    if (Win32Window* window = Win32Window::GetFromUserData(wnd))
+    {
+        if (mouse.usFlags == MOUSE_MOVE_RELATIVE)
+        {
+            /* Post global mouse motion event */
+            int dx = mouse.lLastX;
+            int dy = mouse.lLastY;
+
+            window->PostGlobalMotion({ dx, dy });
         }
     }
 }
@@ -81,8 +128,23 @@ void Win32RawInputRegistry::Unregister(HWND wnd)
 
 void Win32RawInputRegistry::Post(LPARAM lParam)
 {
+    /* Read raw input data only once for all windows */
+    RAWINPUT raw;
+    UINT rawSize = sizeof(raw);
+
+    const UINT result = GetRawInputData(
+        reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT,
+        &raw, &rawSize, sizeof(RAWINPUTHEADER)
+    );
+
+    if (result == static_cast<UINT>(-1) || raw.header.dwType != RIM_TYPEMOUSE)
+        return;
+
+    if (RawInput::IsEnabled())
+        PostRawMouseInput(raw.data.mouse);
+
     for (HWND wnd : wndHandles_)
-        PostGlobalMouseMotion(wnd, lParam);
+        PostGlobalMouseMotion(wnd, raw.data.mouse);
 }
 
 
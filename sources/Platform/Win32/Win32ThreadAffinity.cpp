@@ -0,0 +1,27 @@
+/*
+ * Win32ThreadAffinity.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "../ThreadAffinity.h"
+#include "Win32LeanAndMean.h"
+#include <Windows.h>
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT bool SetCurrentThreadAffinity(std::uint64_t affinityMask)
+{
+    return (::SetThreadAffinityMask(::GetCurrentThread(), static_cast<DWORD_PTR>(affinityMask)) != 0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
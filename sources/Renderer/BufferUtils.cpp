@@ -6,6 +6,7 @@
  */
 
 #include "BufferUtils.h"
+#include "FormatTable.h"
 #include <LLGL/Format.h>
 #include <LLGL/Buffer.h>
 #include <algorithm>
@@ -20,7 +21,7 @@ LLGL_EXPORT std::uint32_t GetStorageBufferStride(const BufferDescriptor& desc)
     if (desc.stride > 0)
         return desc.stride;
     else if (desc.format != Format::Undefined)
-        return std::max(1u, (GetFormatAttribs(desc.format).bitSize / 8u));
+        return std::max(1u, (FormatTable::GetAttribs(desc.format).bitSize / 8u));
     else
         return 1;
 }
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/BufferFlags.h>
+#include <LLGL/IndirectArguments.h>
 
 
 namespace LLGL
@@ -29,6 +30,12 @@ LLGL_EXPORT std::uint32_t GetStorageBufferStride(const BufferDescriptor& desc);
 // Returns the bitwise OR combined binding flags of the specified array of buffers.
 LLGL_EXPORT long GetCombinedBindFlags(std::uint32_t numBuffers, Buffer* const * bufferArray);
 
+// Returns the offset (in bytes) of the DrawIndirectArguments record within a buffer that was created with BindFlags::ComputeStreamOutput.
+inline std::uint64_t GetComputeStreamOutputArgsOffset(std::uint64_t bufferSize)
+{
+    return (bufferSize > sizeof(DrawIndirectArguments) ? bufferSize - sizeof(DrawIndirectArguments) : 0);
+}
+
 // Returns true if the buffer-view in the specified resource-view descriptor is enabled.
 inline bool IsBufferViewEnabled(const BufferViewDescriptor& bufferViewDesc)
 {
@@ -0,0 +1,304 @@
+/*
+ * CaptureFormat.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_CAPTURE_FORMAT_H
+#define LLGL_CAPTURE_FORMAT_H
+
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <type_traits>
+
+
+namespace LLGL
+{
+
+
+/*
+Binary format of frame captures that are recorded by the debug layer (see DbgCaptureRecorder) and replayed by the CaptureReplayer.
+A capture starts with a CaptureFileHeader followed by a stream of operations. Each operation begins with its CaptureOpcode.
+The operations before the first CaptureOpcode::BeginFrame create the objects and upload the resource contents at the beginning of the capture.
+All values are stored in the byte order of the recording machine and all structures without pointers are stored as they are in memory,
+so captures are only compatible with the same version of LLGL (see g_captureVersion).
+*/
+
+// Magic number "LLGC" at the beginning of each capture file.
+static constexpr std::uint32_t g_captureMagic   = 0x43474C4C;
+
+// Version of the capture format; must be incremented whenever the format or any of the stored structures changes.
+static constexpr std::uint32_t g_captureVersion = 6;
+
+// Identifier of a captured object; zero denotes a null reference or an object that is unknown to the capture, e.g. transient buffers.
+using CaptureObjectID = std::uint32_t;
+
+struct CaptureFileHeader
+{
+    std::uint32_t   magic       = g_captureMagic;
+    std::uint32_t   version     = g_captureVersion;
+    std::uint32_t   numFrames   = 0;
+    std::int32_t    rendererID  = 0;    // Renderer the capture was recorded with; only informative (see RendererID)
+};
+
+// Object types of CaptureOpcode::CreateObject.
+enum class CaptureObjectType : std::uint8_t
+{
+    SwapChain,
+    CommandBuffer,
+    Buffer,
+    BufferArray,
+    Texture,
+    Sampler,
+    RenderPass,
+    OwnedRenderPass,    // Render pass of a swap-chain or render target (see RenderTarget::GetRenderPass)
+    RenderTarget,
+    Shader,
+    PipelineLayout,
+    GraphicsPipeline,
+    ComputePipeline,
+    ResourceHeap,
+    QueryHeap,
+};
+
+// Operations of the capture stream. The comments describe the parameters that follow each opcode; IDs are of type CaptureObjectID.
+enum class CaptureOpcode : std::uint8_t
+{
+    /* ----- Capture stream ----- */
+
+    EndOfStream,                // -
+    BeginFrame,                 // -
+    CreateObject,               // CaptureObjectType type, ID object, u32 size, byte[size] parameters
+    ReleaseObject,              // ID object
+    WriteBuffer,                // ID buffer, u64 offset, u64 size, byte[size] data
+    WriteTexture,               // ID texture, TextureRegion region, ImageFormat format, DataType dataType, u32 rowStride, u32 layerStride, u64 size, byte[size] data
+    WriteResourceHeap,          // ID resourceHeap, u32 firstDescriptor, u32 numResourceViews, { ID resource, TextureViewDescriptor, BufferViewDescriptor, u32 initialCount }[numResourceViews]
+    Submit,                     // ID commandBuffer, u32 size, byte[size] commands
+
+    /* ----- Command buffer stream ----- */
+
+    Execute,                    // u32 size, byte[size] commands of the secondary command buffer
+    UpdateBuffer,               // ID dstBuffer, u64 dstOffset, u16 dataSize, byte[dataSize] data
+    CopyBuffer,                 // ID dstBuffer, u64 dstOffset, ID srcBuffer, u64 srcOffset, u64 size
+    CopyBufferFromTexture,      // ID dstBuffer, u64 dstOffset, ID srcTexture, TextureRegion srcRegion, u32 rowStride, u32 layerStride
+    FillBuffer,                 // ID dstBuffer, u64 dstOffset, u32 value, u64 fillSize
+    CopyTexture,                // ID dstTexture, TextureLocation dstLocation, ID srcTexture, TextureLocation srcLocation, Extent3D extent
+    CopyTextureFromBuffer,      // ID dstTexture, TextureRegion dstRegion, ID srcBuffer, u64 srcOffset, u32 rowStride, u32 layerStride
+    CopyTextureFromFramebuffer, // ID dstTexture, TextureRegion dstRegion, Offset2D srcOffset
+    GenerateMips,               // ID texture
+    GenerateMipsRange,          // ID texture, TextureSubresource subresource
+    SetViewports,               // u32 numViewports, Viewport[numViewports]
+    SetScissors,                // u32 numScissors, Scissor[numScissors]
+    SetVertexBuffer,            // ID buffer
+    SetVertexBufferArray,       // ID bufferArray
+    SetIndexBuffer,             // ID buffer
+    SetIndexBufferExt,          // ID buffer, Format format, u64 offset
+    SetResourceHeap,            // ID resourceHeap, u32 descriptorSet
+    SetResource,                // u32 descriptor, ID resource
+    SetConstantBufferRange,     // u32 descriptor, ID buffer, u64 offset, u64 size
+    ResourceBarrier,            // u32 numBuffers, ID[numBuffers], u32 numTextures, ID[numTextures]
+    BeginResourceBarrier,       // u32 numBuffers, ID[numBuffers], u32 numTextures, ID[numTextures]
+    EndResourceBarrier,         // u32 numBuffers, ID[numBuffers], u32 numTextures, ID[numTextures]
+    AliasingBarrier,            // ID textureBefore, ID textureAfter
+    BeginRenderPass,            // ID renderTarget, ID renderPass, u32 numClearValues, ClearValue[numClearValues], u32 swapBufferIndex
+    EndRenderPass,              // -
+    Clear,                      // u32 flags, ClearValue clearValue
+    ClearAttachments,           // u32 numAttachments, { u32 flags, u32 colorAttachment, ClearValue clearValue }[numAttachments]
+    SetPipelineState,           // ID pipelineState
+    SetBlendFactor,             // float[4] color
+    SetStencilReference,        // u32 reference, StencilFace stencilFace
+    SetShadingRate,             // ShadingRate rate
+    SetUniforms,                // u32 first, u16 dataSize, byte[dataSize] data
+    BeginQuery,                 // ID queryHeap, u32 query
+    EndQuery,                   // ID queryHeap, u32 query
+    ResolveQueryData,           // ID queryHeap, u32 firstQuery, u32 numQueries, ID dstBuffer, u64 dstOffset
+    BeginRenderCondition,       // ID queryHeap, u32 query, RenderConditionMode mode
+    EndRenderCondition,         // -
+    BeginStreamOutput,          // u32 numBuffers, ID[numBuffers]
+    EndStreamOutput,            // -
+    Draw,                       // u32 numVertices, u32 firstVertex
+    DrawIndexed,                // u32 numIndices, u32 firstIndex
+    DrawIndexedOffset,          // u32 numIndices, u32 firstIndex, i32 vertexOffset
+    DrawInstanced,              // u32 numVertices, u32 firstVertex, u32 numInstances
+    DrawInstancedOffset,        // u32 numVertices, u32 firstVertex, u32 numInstances, u32 firstInstance
+    DrawIndexedInstanced,       // u32 numIndices, u32 numInstances, u32 firstIndex
+    DrawIndexedInstancedOffset, // u32 numIndices, u32 numInstances, u32 firstIndex, i32 vertexOffset
+    DrawIndexedInstancedFirst,  // u32 numIndices, u32 numInstances, u32 firstIndex, i32 vertexOffset, u32 firstInstance
+    DrawIndirect,               // ID buffer, u64 offset
+    DrawIndirectMulti,          // ID buffer, u64 offset, u32 numCommands, u32 stride
+    DrawIndexedIndirect,        // ID buffer, u64 offset
+    DrawIndexedIndirectMulti,   // ID buffer, u64 offset, u32 numCommands, u32 stride
+    DrawIndirectCount,          // ID buffer, u64 offset, ID countBuffer, u64 countOffset, u32 maxNumCommands, u32 stride
+    DrawIndexedIndirectCount,   // ID buffer, u64 offset, ID countBuffer, u64 countOffset, u32 maxNumCommands, u32 stride
+    DrawStreamOutput,           // -
+    DrawMeshTasks,              // u32 numWorkGroupsX, u32 numWorkGroupsY, u32 numWorkGroupsZ
+    DrawMeshTasksIndirect,      // ID buffer, u64 offset, u32 numCommands, u32 stride
+    DispatchTiles,              // -
+    ExecuteIndirect,            // ID buffer, u64 offset, ID countBuffer, u64 countOffset, u32 maxNumCommands, u32 stride, u32 numArguments, IndirectArgumentDescriptor[numArguments] arguments
+    Dispatch,                   // u32 numWorkGroupsX, u32 numWorkGroupsY, u32 numWorkGroupsZ
+    DispatchIndirect,           // ID buffer, u64 offset
+    PushDebugGroup,             // string name
+    PopDebugGroup,              // -
+};
+
+// Writer for the binary capture stream. Strings are stored with their length and a null terminator, so they can be referenced in place by the reader.
+class CaptureStreamWriter
+{
+
+    public:
+
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "CaptureStreamWriter::Write<T>: T must be trivially copyable");
+            WriteBytes(&value, sizeof(T));
+        }
+
+        template <typename T>
+        void WriteArray(const T* values, std::size_t count)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "CaptureStreamWriter::WriteArray<T>: T must be trivially copyable");
+            WriteBytes(values, sizeof(T) * count);
+        }
+
+        void WriteBytes(const void* data, std::size_t size)
+        {
+            if (size > 0)
+            {
+                const std::size_t offset = data_.size();
+                data_.resize(offset + size);
+                std::memcpy(&data_[offset], data, size);
+            }
+        }
+
+        void WriteString(const char* str)
+        {
+            const std::uint32_t len = (str != nullptr ? static_cast<std::uint32_t>(std::strlen(str)) : 0u);
+            Write(len);
+            WriteBytes(str, len);
+            Write('\0');
+        }
+
+        // Writes the size and content of the specified stream.
+        void WriteStream(const CaptureStreamWriter& stream)
+        {
+            Write(static_cast<std::uint32_t>(stream.GetSize()));
+            WriteBytes(stream.GetData(), stream.GetSize());
+        }
+
+        void Clear()
+        {
+            data_.clear();
+        }
+
+        inline const char* GetData() const
+        {
+            return data_.data();
+        }
+
+        inline std::size_t GetSize() const
+        {
+            return data_.size();
+        }
+
+        inline bool IsEmpty() const
+        {
+            return data_.empty();
+        }
+
+    private:
+
+        std::vector<char> data_;
+
+};
+
+// Reader for the binary capture stream. Reading beyond the end of the stream sets the error state and returns zero-initialized values.
+class CaptureStreamReader
+{
+
+    public:
+
+        CaptureStreamReader() = default;
+
+        CaptureStreamReader(const void* data, std::size_t size) :
+            pos_ { static_cast<const char*>(data)        },
+            end_ { static_cast<const char*>(data) + size }
+        {
+        }
+
+        template <typename T>
+        T Read()
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "CaptureStreamReader::Read<T>: T must be trivially copyable");
+            T value{};
+            if (const void* data = ReadBytes(sizeof(T)))
+                std::memcpy(&value, data, sizeof(T));
+            return value;
+        }
+
+        // Returns a pointer to the next bytes in the stream without copying them, or null if the stream is too short.
+        const void* ReadBytes(std::size_t size)
+        {
+            if (static_cast<std::size_t>(end_ - pos_) < size)
+            {
+                hasError_ = true;
+                pos_ = end_;
+                return nullptr;
+            }
+            const char* data = pos_;
+            pos_ += size;
+            return data;
+        }
+
+        // Returns the null-terminated string in place, or an empty string if the stream is too short.
+        const char* ReadString()
+        {
+            const std::uint32_t len = Read<std::uint32_t>();
+            const char* str = static_cast<const char*>(ReadBytes(static_cast<std::size_t>(len) + 1));
+            return (str != nullptr && str[len] == '\0' ? str : "");
+        }
+
+        // Returns a reader for the nested stream that was written with CaptureStreamWriter::WriteStream.
+        CaptureStreamReader ReadStream()
+        {
+            const std::uint32_t size = Read<std::uint32_t>();
+            if (const void* data = ReadBytes(size))
+                return CaptureStreamReader{ data, size };
+            return CaptureStreamReader{};
+        }
+
+        inline bool HasError() const
+        {
+            return hasError_;
+        }
+
+        inline bool IsEnd() const
+        {
+            return (pos_ == end_);
+        }
+
+        inline const char* GetPosition() const
+        {
+            return pos_;
+        }
+
+    private:
+
+        const char* pos_        = nullptr;
+        const char* end_        = nullptr;
+        bool        hasError_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
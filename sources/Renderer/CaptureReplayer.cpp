@@ -0,0 +1,1528 @@
+/*
+ * CaptureReplayer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/CaptureReplayer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/SwapChain.h>
+#include <LLGL/Report.h>
+#include <LLGL/Utils/ForRange.h>
+#include "CaptureFormat.h"
+#include "../Core/StringUtils.h"
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+~~~~~~ INFO ~~~~~~
+The replayer decodes the capture stream that is written by the debug layer (see DbgCaptureRecorder).
+All objects are created when the capture is loaded, including those that have been created during the captured frames,
+and they are only released when the replayer is destroyed, so each frame can be replayed any number of times.
+Commands that refer to objects that are unknown to the capture, e.g. transient buffers, are skipped.
+*/
+
+struct CaptureReplayer::Pimpl
+{
+    struct Object
+    {
+        CaptureObjectType   type        = CaptureObjectType::SwapChain;
+        RenderSystemChild*  object      = nullptr;
+        long                flags       = 0;                            // Command buffer flags
+        CommandQueueType    queueType   = CommandQueueType::Graphics;   // Command buffer queue type
+    };
+
+    struct FrameRange
+    {
+        std::size_t begin   = 0;
+        std::size_t end     = 0;
+    };
+
+    explicit Pimpl(RenderSystem& renderer) :
+        renderer { renderer }
+    {
+    }
+
+    RenderSystem&           renderer;
+    std::vector<char>       content;
+    std::vector<Object>     objects;
+    std::vector<FrameRange> frames;
+    std::vector<SwapChain*> swapChains;
+    Report*                 report      = nullptr;
+
+    /* ----- Objects ----- */
+
+    void ReleaseObjects();
+
+    RenderSystemChild* GetObject(CaptureObjectID id, CaptureObjectType type) const;
+
+    Buffer*         GetBuffer(CaptureObjectID id) const;
+    BufferArray*    GetBufferArray(CaptureObjectID id) const;
+    Texture*        GetTexture(CaptureObjectID id) const;
+    Resource*       GetResource(CaptureObjectID id) const;
+    RenderPass*     GetRenderPass(CaptureObjectID id) const;
+    RenderTarget*   GetRenderTarget(CaptureObjectID id) const;
+    Shader*         GetShader(CaptureObjectID id) const;
+    PipelineLayout* GetPipelineLayout(CaptureObjectID id) const;
+    PipelineState*  GetPipelineState(CaptureObjectID id) const;
+    ResourceHeap*   GetResourceHeap(CaptureObjectID id) const;
+    QueryHeap*      GetQueryHeap(CaptureObjectID id) const;
+
+    bool CreateObject(CaptureObjectType type, CaptureObjectID id, CaptureStreamReader& reader);
+
+    RenderSystemChild* CreateSwapChain(CaptureStreamReader& reader);
+    RenderSystemChild* CreateCommandBuffer(CaptureStreamReader& reader, Object& entry);
+    RenderSystemChild* CreateBuffer(CaptureStreamReader& reader);
+    RenderSystemChild* CreateBufferArray(CaptureStreamReader& reader);
+    RenderSystemChild* CreateTexture(CaptureStreamReader& reader);
+    RenderSystemChild* CreateRenderPass(CaptureStreamReader& reader);
+    RenderSystemChild* CreateRenderTarget(CaptureStreamReader& reader);
+    RenderSystemChild* CreateShader(CaptureStreamReader& reader);
+    RenderSystemChild* CreatePipelineLayout(CaptureStreamReader& reader);
+    RenderSystemChild* CreateGraphicsPipeline(CaptureStreamReader& reader);
+    RenderSystemChild* CreateComputePipeline(CaptureStreamReader& reader);
+    RenderSystemChild* CreateResourceHeap(CaptureStreamReader& reader);
+    RenderSystemChild* CreateQueryHeap(CaptureStreamReader& reader);
+
+    /* ----- Operations ----- */
+
+    // Executes the operations until the next BeginFrame or EndOfStream opcode. CreateObject operations are only executed if 'createObjects' is true.
+    bool ExecuteOps(CaptureStreamReader& reader, bool createObjects, bool& outEndOfStream);
+
+    void WriteBuffer(CaptureStreamReader& reader);
+    void WriteTexture(CaptureStreamReader& reader);
+    void WriteResourceHeap(CaptureStreamReader& reader);
+    void Submit(CaptureStreamReader& reader);
+
+    // Decodes the captured commands into the specified command buffer. Returns false if the stream is corrupted.
+    bool DecodeCommands(CommandBuffer& cmdBuffer, CaptureStreamReader& reader);
+
+    void Errorf(const char* format, const char* arg);
+};
+
+
+/*
+ * Internal functions
+ */
+
+template <typename T>
+void ReadValue(CaptureStreamReader& reader, T& outValue)
+{
+    outValue = reader.Read<T>();
+}
+
+static long ReadFlags(CaptureStreamReader& reader)
+{
+    return static_cast<long>(reader.Read<std::uint32_t>());
+}
+
+// Reads an array of trivially copyable values; they are copied since they might not be aligned within the stream.
+template <typename T>
+void ReadArray(CaptureStreamReader& reader, std::vector<T>& outValues, std::size_t count)
+{
+    outValues.resize(count);
+    if (const void* data = reader.ReadBytes(sizeof(T) * count))
+        std::memcpy(outValues.data(), data, sizeof(T) * count);
+    else
+        outValues.clear();
+}
+
+static void ReadVertexAttributes(CaptureStreamReader& reader, std::vector<VertexAttribute>& outAttribs)
+{
+    const std::uint32_t numAttribs = reader.Read<std::uint32_t>();
+    outAttribs.resize(numAttribs);
+    for (VertexAttribute& attrib : outAttribs)
+    {
+        attrib.name = reader.ReadString();
+        ReadValue(reader, attrib.format);
+        ReadValue(reader, attrib.location);
+        ReadValue(reader, attrib.semanticIndex);
+        ReadValue(reader, attrib.systemValue);
+        ReadValue(reader, attrib.slot);
+        ReadValue(reader, attrib.offset);
+        ReadValue(reader, attrib.stride);
+        ReadValue(reader, attrib.instanceDivisor);
+    }
+}
+
+static void ReadSamplerDesc(CaptureStreamReader& reader, SamplerDescriptor& outDesc)
+{
+    ReadValue(reader, outDesc.addressModeU);
+    ReadValue(reader, outDesc.addressModeV);
+    ReadValue(reader, outDesc.addressModeW);
+    ReadValue(reader, outDesc.minFilter);
+    ReadValue(reader, outDesc.magFilter);
+    ReadValue(reader, outDesc.mipMapFilter);
+    ReadValue(reader, outDesc.mipMapEnabled);
+    ReadValue(reader, outDesc.mipMapLODBias);
+    ReadValue(reader, outDesc.minLOD);
+    ReadValue(reader, outDesc.maxLOD);
+    ReadValue(reader, outDesc.maxAnisotropy);
+    ReadValue(reader, outDesc.compareEnabled);
+    ReadValue(reader, outDesc.compareOp);
+    for_range(i, 4)
+        ReadValue(reader, outDesc.borderColor[i]);
+}
+
+static void ReadBindingDescs(CaptureStreamReader& reader, std::vector<BindingDescriptor>& outBindingDescs)
+{
+    const std::uint32_t numBindings = reader.Read<std::uint32_t>();
+    outBindingDescs.resize(numBindings);
+    for (BindingDescriptor& bindingDesc : outBindingDescs)
+    {
+        bindingDesc.name        = reader.ReadString();
+        ReadValue(reader, bindingDesc.type);
+        bindingDesc.bindFlags   = ReadFlags(reader);
+        bindingDesc.stageFlags  = ReadFlags(reader);
+        ReadValue(reader, bindingDesc.slot);
+        ReadValue(reader, bindingDesc.arraySize);
+    }
+}
+
+static const char* NullIfEmpty(const char* str)
+{
+    return (*str != '\0' ? str : nullptr);
+}
+
+
+/*
+ * CaptureReplayer class
+ */
+
+CaptureReplayer::CaptureReplayer(RenderSystem& renderer) :
+    pimpl_ { new Pimpl{ renderer } }
+{
+}
+
+CaptureReplayer::~CaptureReplayer()
+{
+    pimpl_->ReleaseObjects();
+    delete pimpl_;
+}
+
+bool CaptureReplayer::Load(const char* filename, Report* report)
+{
+    pimpl_->ReleaseObjects();
+    pimpl_->report = report;
+
+    /* Read entire capture file, since all strings and resource contents are referenced in place */
+    pimpl_->content = ReadFileBuffer(filename);
+    if (pimpl_->content.empty())
+    {
+        pimpl_->Errorf("failed to read capture file: %s\n", filename);
+        return false;
+    }
+
+    CaptureStreamReader reader{ pimpl_->content.data(), pimpl_->content.size() };
+
+    const CaptureFileHeader header = reader.Read<CaptureFileHeader>();
+    if (reader.HasError() || header.magic != g_captureMagic)
+    {
+        pimpl_->Errorf("invalid capture file: %s\n", filename);
+        return false;
+    }
+    if (header.version != g_captureVersion)
+    {
+        pimpl_->Errorf("capture file was recorded with an incompatible version of LLGL: %s\n", filename);
+        return false;
+    }
+
+    /* Execute all operations before the first frame */
+    bool endOfStream = false;
+    if (!pimpl_->ExecuteOps(reader, /*createObjects:*/ true, endOfStream))
+    {
+        pimpl_->Errorf("corrupted capture file: %s\n", filename);
+        return false;
+    }
+
+    /* Determine range of each frame and hoist all objects that are created within a frame to load time */
+    while (!endOfStream)
+    {
+        Pimpl::FrameRange frame;
+        frame.begin = static_cast<std::size_t>(reader.GetPosition() - pimpl_->content.data());
+
+        if (!pimpl_->ExecuteOps(reader, /*createObjects:*/ true, endOfStream))
+        {
+            pimpl_->Errorf("corrupted capture file: %s\n", filename);
+            return false;
+        }
+
+        /* Frame ends before the opcode that terminated it */
+        frame.end = static_cast<std::size_t>(reader.GetPosition() - pimpl_->content.data()) - sizeof(CaptureOpcode);
+        pimpl_->frames.push_back(frame);
+    }
+
+    pimpl_->report = nullptr;
+    return true;
+}
+
+std::uint32_t CaptureReplayer::GetNumFrames() const
+{
+    return static_cast<std::uint32_t>(pimpl_->frames.size());
+}
+
+bool CaptureReplayer::ReplayFrame(std::uint32_t frame)
+{
+    if (frame >= pimpl_->frames.size())
+        return false;
+
+    const Pimpl::FrameRange& range = pimpl_->frames[frame];
+    CaptureStreamReader reader{ pimpl_->content.data() + range.begin, range.end - range.begin };
+
+    /* Execute all operations of this frame; objects have already been created when the capture was loaded */
+    const std::string annotation = "Frame " + std::to_string(frame);
+    bool endOfStream = false;
+
+    while (!reader.IsEnd())
+    {
+        const CaptureOpcode opcode = reader.Read<CaptureOpcode>();
+        switch (opcode)
+        {
+            case CaptureOpcode::CreateObject:
+                reader.Read<CaptureObjectType>();
+                reader.Read<CaptureObjectID>();
+                reader.ReadStream();
+                break;
+            case CaptureOpcode::ReleaseObject:
+                reader.Read<CaptureObjectID>();
+                break;
+            case CaptureOpcode::WriteBuffer:
+                pimpl_->WriteBuffer(reader);
+                break;
+            case CaptureOpcode::WriteTexture:
+                pimpl_->WriteTexture(reader);
+                break;
+            case CaptureOpcode::WriteResourceHeap:
+                pimpl_->WriteResourceHeap(reader);
+                break;
+            case CaptureOpcode::Submit:
+            {
+                const CaptureObjectID id = reader.Read<CaptureObjectID>();
+                CaptureStreamReader commands = reader.ReadStream();
+                if (RenderSystemChild* object = pimpl_->GetObject(id, CaptureObjectType::CommandBuffer))
+                {
+                    const Pimpl::Object& entry = pimpl_->objects[id];
+                    auto* cmdBuffer = static_cast<CommandBuffer*>(object);
+                    cmdBuffer->Begin();
+                    {
+                        cmdBuffer->PushDebugGroup(annotation.c_str());
+                        pimpl_->DecodeCommands(*cmdBuffer, commands);
+                        cmdBuffer->PopDebugGroup();
+                    }
+                    cmdBuffer->End();
+
+                    /* Immediate command buffers are submitted implicitly by End() */
+                    if ((entry.flags & CommandBufferFlags::ImmediateSubmit) == 0)
+                    {
+                        CommandQueue* queue = pimpl_->renderer.GetCommandQueue(entry.queueType);
+                        if (queue == nullptr)
+                            queue = pimpl_->renderer.GetCommandQueue();
+                        queue->Submit(*cmdBuffer);
+                    }
+                }
+            }
+            break;
+            default:
+                endOfStream = true;
+                break;
+        }
+        if (endOfStream || reader.HasError())
+            return false;
+    }
+
+    /* Present all swap-chains at the end of the frame */
+    for (SwapChain* swapChain : pimpl_->swapChains)
+        swapChain->Present();
+
+    return true;
+}
+
+SwapChain* CaptureReplayer::GetSwapChain() const
+{
+    return (pimpl_->swapChains.empty() ? nullptr : pimpl_->swapChains.front());
+}
+
+
+/*
+ * Pimpl: Objects
+ */
+
+void CaptureReplayer::Pimpl::ReleaseObjects()
+{
+    /* Release objects in reverse order of their creation, since later objects can only refer to earlier ones */
+    for (auto it = objects.rbegin(); it != objects.rend(); ++it)
+    {
+        RenderSystemChild* object = it->object;
+        if (object == nullptr)
+            continue;
+
+        switch (it->type)
+        {
+            case CaptureObjectType::SwapChain:          renderer.Release(*static_cast<SwapChain*>(object));         break;
+            case CaptureObjectType::CommandBuffer:      renderer.Release(*static_cast<CommandBuffer*>(object));     break;
+            case CaptureObjectType::Buffer:             renderer.Release(*static_cast<Buffer*>(object));            break;
+            case CaptureObjectType::BufferArray:        renderer.Release(*static_cast<BufferArray*>(object));       break;
+            case CaptureObjectType::Texture:            renderer.Release(*static_cast<Texture*>(object));           break;
+            case CaptureObjectType::Sampler:            renderer.Release(*static_cast<Sampler*>(object));           break;
+            case CaptureObjectType::RenderPass:         renderer.Release(*static_cast<RenderPass*>(object));        break;
+            case CaptureObjectType::OwnedRenderPass:                                                                break;
+            case CaptureObjectType::RenderTarget:       renderer.Release(*static_cast<RenderTarget*>(object));      break;
+            case CaptureObjectType::Shader:             renderer.Release(*static_cast<Shader*>(object));            break;
+            case CaptureObjectType::PipelineLayout:     renderer.Release(*static_cast<PipelineLayout*>(object));    break;
+            case CaptureObjectType::GraphicsPipeline:
+            case CaptureObjectType::ComputePipeline:    renderer.Release(*static_cast<PipelineState*>(object));     break;
+            case CaptureObjectType::ResourceHeap:       renderer.Release(*static_cast<ResourceHeap*>(object));      break;
+            case CaptureObjectType::QueryHeap:          renderer.Release(*static_cast<QueryHeap*>(object));         break;
+        }
+    }
+
+    objects.clear();
+    frames.clear();
+    swapChains.clear();
+    content.clear();
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::GetObject(CaptureObjectID id, CaptureObjectType type) const
+{
+    if (id < objects.size() && objects[id].type == type)
+        return objects[id].object;
+    return nullptr;
+}
+
+Buffer* CaptureReplayer::Pimpl::GetBuffer(CaptureObjectID id) const
+{
+    return static_cast<Buffer*>(GetObject(id, CaptureObjectType::Buffer));
+}
+
+BufferArray* CaptureReplayer::Pimpl::GetBufferArray(CaptureObjectID id) const
+{
+    return static_cast<BufferArray*>(GetObject(id, CaptureObjectType::BufferArray));
+}
+
+Texture* CaptureReplayer::Pimpl::GetTexture(CaptureObjectID id) const
+{
+    return static_cast<Texture*>(GetObject(id, CaptureObjectType::Texture));
+}
+
+Resource* CaptureReplayer::Pimpl::GetResource(CaptureObjectID id) const
+{
+    if (Buffer* buffer = GetBuffer(id))
+        return buffer;
+    if (Texture* texture = GetTexture(id))
+        return texture;
+    return static_cast<Sampler*>(GetObject(id, CaptureObjectType::Sampler));
+}
+
+RenderPass* CaptureReplayer::Pimpl::GetRenderPass(CaptureObjectID id) const
+{
+    if (RenderSystemChild* renderPass = GetObject(id, CaptureObjectType::RenderPass))
+        return static_cast<RenderPass*>(renderPass);
+    return static_cast<RenderPass*>(GetObject(id, CaptureObjectType::OwnedRenderPass));
+}
+
+RenderTarget* CaptureReplayer::Pimpl::GetRenderTarget(CaptureObjectID id) const
+{
+    if (RenderSystemChild* swapChain = GetObject(id, CaptureObjectType::SwapChain))
+        return static_cast<SwapChain*>(swapChain);
+    return static_cast<RenderTarget*>(GetObject(id, CaptureObjectType::RenderTarget));
+}
+
+Shader* CaptureReplayer::Pimpl::GetShader(CaptureObjectID id) const
+{
+    return static_cast<Shader*>(GetObject(id, CaptureObjectType::Shader));
+}
+
+PipelineLayout* CaptureReplayer::Pimpl::GetPipelineLayout(CaptureObjectID id) const
+{
+    return static_cast<PipelineLayout*>(GetObject(id, CaptureObjectType::PipelineLayout));
+}
+
+PipelineState* CaptureReplayer::Pimpl::GetPipelineState(CaptureObjectID id) const
+{
+    if (RenderSystemChild* pipelineState = GetObject(id, CaptureObjectType::GraphicsPipeline))
+        return static_cast<PipelineState*>(pipelineState);
+    return static_cast<PipelineState*>(GetObject(id, CaptureObjectType::ComputePipeline));
+}
+
+ResourceHeap* CaptureReplayer::Pimpl::GetResourceHeap(CaptureObjectID id) const
+{
+    return static_cast<ResourceHeap*>(GetObject(id, CaptureObjectType::ResourceHeap));
+}
+
+QueryHeap* CaptureReplayer::Pimpl::GetQueryHeap(CaptureObjectID id) const
+{
+    return static_cast<QueryHeap*>(GetObject(id, CaptureObjectType::QueryHeap));
+}
+
+bool CaptureReplayer::Pimpl::CreateObject(CaptureObjectType type, CaptureObjectID id, CaptureStreamReader& reader)
+{
+    if (id == 0)
+        return false;
+
+    if (id >= objects.size())
+        objects.resize(id + 1);
+
+    Object& entry = objects[id];
+    entry.type = type;
+
+    switch (type)
+    {
+        case CaptureObjectType::SwapChain:          entry.object = CreateSwapChain(reader);                 break;
+        case CaptureObjectType::CommandBuffer:      entry.object = CreateCommandBuffer(reader, entry);      break;
+        case CaptureObjectType::Buffer:             entry.object = CreateBuffer(reader);                    break;
+        case CaptureObjectType::BufferArray:        entry.object = CreateBufferArray(reader);               break;
+        case CaptureObjectType::Texture:            entry.object = CreateTexture(reader);                   break;
+        case CaptureObjectType::RenderPass:         entry.object = CreateRenderPass(reader);                break;
+        case CaptureObjectType::RenderTarget:       entry.object = CreateRenderTarget(reader);              break;
+        case CaptureObjectType::Shader:             entry.object = CreateShader(reader);                    break;
+        case CaptureObjectType::PipelineLayout:     entry.object = CreatePipelineLayout(reader);            break;
+        case CaptureObjectType::GraphicsPipeline:   entry.object = CreateGraphicsPipeline(reader);          break;
+        case CaptureObjectType::ComputePipeline:    entry.object = CreateComputePipeline(reader);           break;
+        case CaptureObjectType::ResourceHeap:       entry.object = CreateResourceHeap(reader);              break;
+        case CaptureObjectType::QueryHeap:          entry.object = CreateQueryHeap(reader);                 break;
+
+        case CaptureObjectType::Sampler:
+        {
+            SamplerDescriptor samplerDesc;
+            ReadSamplerDesc(reader, samplerDesc);
+            entry.object = renderer.CreateSampler(samplerDesc);
+        }
+        break;
+
+        case CaptureObjectType::OwnedRenderPass:
+        {
+            /* Render pass is owned by a swap-chain or render target that has been created before */
+            if (RenderTarget* owner = GetRenderTarget(reader.Read<CaptureObjectID>()))
+                entry.object = const_cast<RenderPass*>(owner->GetRenderPass());
+        }
+        break;
+
+        default:
+            return false;
+    }
+
+    return !reader.HasError();
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateSwapChain(CaptureStreamReader& reader)
+{
+    SwapChainDescriptor swapChainDesc;
+    {
+        ReadValue(reader, swapChainDesc.resolution);
+        swapChainDesc.colorBits     = static_cast<int>(reader.Read<std::int32_t>());
+        swapChainDesc.depthBits     = static_cast<int>(reader.Read<std::int32_t>());
+        swapChainDesc.stencilBits   = static_cast<int>(reader.Read<std::int32_t>());
+        ReadValue(reader, swapChainDesc.samples);
+        ReadValue(reader, swapChainDesc.swapBuffers);
+        ReadValue(reader, swapChainDesc.maxFramesInFlight);
+    }
+    SwapChain* swapChain = renderer.CreateSwapChain(swapChainDesc);
+    swapChains.push_back(swapChain);
+    return swapChain;
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateCommandBuffer(CaptureStreamReader& reader, Object& entry)
+{
+    CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.flags         = ReadFlags(reader);
+        ReadValue(reader, cmdBufferDesc.numNativeBuffers);
+        ReadValue(reader, cmdBufferDesc.minStagingPoolSize);
+        cmdBufferDesc.renderPass    = GetRenderPass(reader.Read<CaptureObjectID>());
+        ReadValue(reader, cmdBufferDesc.queueType);
+    }
+    entry.flags     = cmdBufferDesc.flags;
+    entry.queueType = cmdBufferDesc.queueType;
+    return renderer.CreateCommandBuffer(cmdBufferDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateBuffer(CaptureStreamReader& reader)
+{
+    std::vector<VertexAttribute> vertexAttribs;
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName        = NullIfEmpty(reader.ReadString());
+        ReadValue(reader, bufferDesc.size);
+        ReadValue(reader, bufferDesc.stride);
+        ReadValue(reader, bufferDesc.format);
+        bufferDesc.bindFlags        = ReadFlags(reader);
+        bufferDesc.cpuAccessFlags   = ReadFlags(reader);
+        bufferDesc.miscFlags        = ReadFlags(reader);
+        ReadVertexAttributes(reader, vertexAttribs);
+        bufferDesc.vertexAttribs    = vertexAttribs;
+    }
+    return renderer.CreateBuffer(bufferDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateBufferArray(CaptureStreamReader& reader)
+{
+    const std::uint32_t numBuffers = reader.Read<std::uint32_t>();
+
+    std::vector<Buffer*> buffers;
+    buffers.reserve(numBuffers);
+    for_range(i, numBuffers)
+    {
+        if (Buffer* buffer = GetBuffer(reader.Read<CaptureObjectID>()))
+            buffers.push_back(buffer);
+    }
+
+    if (buffers.empty())
+        return nullptr;
+
+    return renderer.CreateBufferArray(static_cast<std::uint32_t>(buffers.size()), buffers.data());
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateTexture(CaptureStreamReader& reader)
+{
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.debugName       = NullIfEmpty(reader.ReadString());
+        ReadValue(reader, textureDesc.type);
+        textureDesc.bindFlags       = ReadFlags(reader);
+        textureDesc.cpuAccessFlags  = ReadFlags(reader);
+        textureDesc.miscFlags       = ReadFlags(reader);
+        ReadValue(reader, textureDesc.format);
+        ReadValue(reader, textureDesc.extent);
+        ReadValue(reader, textureDesc.arrayLayers);
+        ReadValue(reader, textureDesc.mipLevels);
+        ReadValue(reader, textureDesc.samples);
+        ReadValue(reader, textureDesc.clearValue);
+    }
+    return renderer.CreateTexture(textureDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateRenderPass(CaptureStreamReader& reader)
+{
+    RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.debugName = NullIfEmpty(reader.ReadString());
+        for (AttachmentFormatDescriptor& attachmentDesc : renderPassDesc.colorAttachments)
+            ReadValue(reader, attachmentDesc);
+        ReadValue(reader, renderPassDesc.depthAttachment);
+        ReadValue(reader, renderPassDesc.stencilAttachment);
+        ReadValue(reader, renderPassDesc.samples);
+    }
+    return renderer.CreateRenderPass(renderPassDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateRenderTarget(CaptureStreamReader& reader)
+{
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.debugName  = NullIfEmpty(reader.ReadString());
+        renderTargetDesc.renderPass = GetRenderPass(reader.Read<CaptureObjectID>());
+        ReadValue(reader, renderTargetDesc.resolution);
+        ReadValue(reader, renderTargetDesc.samples);
+
+        auto ReadAttachment = [this, &reader](AttachmentDescriptor& attachmentDesc)
+        {
+            ReadValue(reader, attachmentDesc.format);
+            attachmentDesc.texture = GetTexture(reader.Read<CaptureObjectID>());
+            ReadValue(reader, attachmentDesc.mipLevel);
+            ReadValue(reader, attachmentDesc.arrayLayer);
+        };
+
+        for (AttachmentDescriptor& attachmentDesc : renderTargetDesc.colorAttachments)
+            ReadAttachment(attachmentDesc);
+        for (AttachmentDescriptor& attachmentDesc : renderTargetDesc.resolveAttachments)
+            ReadAttachment(attachmentDesc);
+        ReadAttachment(renderTargetDesc.depthStencilAttachment);
+        ReadAttachment(renderTargetDesc.shadingRateAttachment);
+    }
+    return renderer.CreateRenderTarget(renderTargetDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateShader(CaptureStreamReader& reader)
+{
+    std::vector<ShaderMacro> defines;
+    ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.debugName    = NullIfEmpty(reader.ReadString());
+        ReadValue(reader, shaderDesc.type);
+        ReadValue(reader, shaderDesc.sourceType);
+
+        /* Source is stored with a null terminator, which is not included in its size */
+        const std::uint64_t sourceSize = reader.Read<std::uint64_t>();
+        shaderDesc.source       = static_cast<const char*>(reader.ReadBytes(static_cast<std::size_t>(sourceSize) + 1));
+        shaderDesc.sourceSize   = static_cast<std::size_t>(sourceSize);
+
+        shaderDesc.entryPoint   = NullIfEmpty(reader.ReadString());
+        shaderDesc.profile      = NullIfEmpty(reader.ReadString());
+
+        const std::uint32_t numDefines = reader.Read<std::uint32_t>();
+        if (numDefines > 0)
+        {
+            defines.resize(numDefines + 1);
+            for_range(i, numDefines)
+            {
+                defines[i].name         = reader.ReadString();
+                defines[i].definition   = reader.ReadString();
+            }
+            shaderDesc.defines = defines.data();
+        }
+
+        shaderDesc.flags = ReadFlags(reader);
+        ReadVertexAttributes(reader, shaderDesc.vertex.inputAttribs);
+        ReadVertexAttributes(reader, shaderDesc.vertex.outputAttribs);
+
+        const std::uint32_t numFragmentAttribs = reader.Read<std::uint32_t>();
+        shaderDesc.fragment.outputAttribs.resize(numFragmentAttribs);
+        for (FragmentAttribute& attrib : shaderDesc.fragment.outputAttribs)
+        {
+            attrib.name = reader.ReadString();
+            ReadValue(reader, attrib.format);
+            ReadValue(reader, attrib.location);
+            ReadValue(reader, attrib.systemValue);
+        }
+
+        ReadValue(reader, shaderDesc.compute.workGroupSize);
+    }
+
+    if (reader.HasError())
+        return nullptr;
+
+    return renderer.CreateShader(shaderDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreatePipelineLayout(CaptureStreamReader& reader)
+{
+    PipelineLayoutDescriptor layoutDesc;
+    {
+        layoutDesc.debugName = NullIfEmpty(reader.ReadString());
+        ReadBindingDescs(reader, layoutDesc.heapBindings);
+        ReadBindingDescs(reader, layoutDesc.bindings);
+
+        layoutDesc.staticSamplers.resize(reader.Read<std::uint32_t>());
+        for (StaticSamplerDescriptor& staticSamplerDesc : layoutDesc.staticSamplers)
+        {
+            staticSamplerDesc.name          = reader.ReadString();
+            staticSamplerDesc.stageFlags    = ReadFlags(reader);
+            ReadValue(reader, staticSamplerDesc.slot);
+            ReadSamplerDesc(reader, staticSamplerDesc.sampler);
+        }
+
+        layoutDesc.uniforms.resize(reader.Read<std::uint32_t>());
+        for (UniformDescriptor& uniformDesc : layoutDesc.uniforms)
+        {
+            uniformDesc.name = reader.ReadString();
+            ReadValue(reader, uniformDesc.type);
+            ReadValue(reader, uniformDesc.arraySize);
+        }
+
+        layoutDesc.combinedTextureSamplers.resize(reader.Read<std::uint32_t>());
+        for (CombinedTextureSamplerDescriptor& samplerDesc : layoutDesc.combinedTextureSamplers)
+        {
+            samplerDesc.name        = reader.ReadString();
+            samplerDesc.textureName = reader.ReadString();
+            samplerDesc.samplerName = reader.ReadString();
+            ReadValue(reader, samplerDesc.slot);
+        }
+
+        layoutDesc.barrierFlags = ReadFlags(reader);
+        layoutDesc.flags        = ReadFlags(reader);
+    }
+    return renderer.CreatePipelineLayout(layoutDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateGraphicsPipeline(CaptureStreamReader& reader)
+{
+    GraphicsPipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.debugName              = NullIfEmpty(reader.ReadString());
+        pipelineDesc.flags                  = ReadFlags(reader);
+        pipelineDesc.pipelineLayout         = GetPipelineLayout(reader.Read<CaptureObjectID>());
+        pipelineDesc.renderPass             = GetRenderPass(reader.Read<CaptureObjectID>());
+        pipelineDesc.vertexShader           = GetShader(reader.Read<CaptureObjectID>());
+        pipelineDesc.tessControlShader      = GetShader(reader.Read<CaptureObjectID>());
+        pipelineDesc.tessEvaluationShader   = GetShader(reader.Read<CaptureObjectID>());
+        pipelineDesc.geometryShader         = GetShader(reader.Read<CaptureObjectID>());
+        pipelineDesc.taskShader             = GetShader(reader.Read<CaptureObjectID>());
+        pipelineDesc.meshShader             = GetShader(reader.Read<CaptureObjectID>());
+        pipelineDesc.tileShader             = GetShader(reader.Read<CaptureObjectID>());
+        pipelineDesc.fragmentShader         = GetShader(reader.Read<CaptureObjectID>());
+        ReadValue(reader, pipelineDesc.indexFormat);
+        ReadValue(reader, pipelineDesc.primitiveTopology);
+        ReadArray(reader, pipelineDesc.viewports, reader.Read<std::uint32_t>());
+        ReadArray(reader, pipelineDesc.scissors, reader.Read<std::uint32_t>());
+        ReadValue(reader, pipelineDesc.depth);
+        ReadValue(reader, pipelineDesc.stencil);
+        ReadValue(reader, pipelineDesc.rasterizer);
+        ReadValue(reader, pipelineDesc.blend);
+        ReadValue(reader, pipelineDesc.tessellation);
+    }
+    return renderer.CreatePipelineState(pipelineDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateComputePipeline(CaptureStreamReader& reader)
+{
+    ComputePipelineDescriptor pipelineDesc;
+    {
+        pipelineDesc.debugName      = NullIfEmpty(reader.ReadString());
+        pipelineDesc.flags          = ReadFlags(reader);
+        pipelineDesc.pipelineLayout = GetPipelineLayout(reader.Read<CaptureObjectID>());
+        pipelineDesc.computeShader  = GetShader(reader.Read<CaptureObjectID>());
+    }
+    return renderer.CreatePipelineState(pipelineDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateResourceHeap(CaptureStreamReader& reader)
+{
+    ResourceHeapDescriptor heapDesc;
+    {
+        heapDesc.debugName          = NullIfEmpty(reader.ReadString());
+        heapDesc.pipelineLayout     = GetPipelineLayout(reader.Read<CaptureObjectID>());
+        ReadValue(reader, heapDesc.numResourceViews);
+    }
+
+    if (heapDesc.pipelineLayout == nullptr || heapDesc.numResourceViews == 0)
+        return nullptr;
+
+    return renderer.CreateResourceHeap(heapDesc);
+}
+
+RenderSystemChild* CaptureReplayer::Pimpl::CreateQueryHeap(CaptureStreamReader& reader)
+{
+    QueryHeapDescriptor queryHeapDesc;
+    {
+        queryHeapDesc.debugName = NullIfEmpty(reader.ReadString());
+        ReadValue(reader, queryHeapDesc.type);
+        ReadValue(reader, queryHeapDesc.numQueries);
+        ReadValue(reader, queryHeapDesc.renderCondition);
+    }
+    return renderer.CreateQueryHeap(queryHeapDesc);
+}
+
+
+/*
+ * Pimpl: Operations
+ */
+
+bool CaptureReplayer::Pimpl::ExecuteOps(CaptureStreamReader& reader, bool createObjects, bool& outEndOfStream)
+{
+    while (!reader.HasError())
+    {
+        const CaptureOpcode opcode = reader.Read<CaptureOpcode>();
+        switch (opcode)
+        {
+            case CaptureOpcode::EndOfStream:
+                outEndOfStream = true;
+                return true;
+
+            case CaptureOpcode::BeginFrame:
+                return true;
+
+            case CaptureOpcode::CreateObject:
+            {
+                const CaptureObjectType type = reader.Read<CaptureObjectType>();
+                const CaptureObjectID id = reader.Read<CaptureObjectID>();
+                CaptureStreamReader params = reader.ReadStream();
+                if (createObjects)
+                    CreateObject(type, id, params);
+            }
+            break;
+
+            case CaptureOpcode::ReleaseObject:
+                /* Objects are only released with the replayer, so frames can be replayed repeatedly */
+                reader.Read<CaptureObjectID>();
+                break;
+
+            case CaptureOpcode::WriteBuffer:
+                WriteBuffer(reader);
+                break;
+
+            case CaptureOpcode::WriteTexture:
+                WriteTexture(reader);
+                break;
+
+            case CaptureOpcode::WriteResourceHeap:
+                WriteResourceHeap(reader);
+                break;
+
+            case CaptureOpcode::Submit:
+                /* Commands are only executed when a frame is replayed */
+                reader.Read<CaptureObjectID>();
+                reader.ReadStream();
+                break;
+
+            default:
+                return false;
+        }
+    }
+    return false;
+}
+
+void CaptureReplayer::Pimpl::WriteBuffer(CaptureStreamReader& reader)
+{
+    const CaptureObjectID id = reader.Read<CaptureObjectID>();
+    const std::uint64_t offset = reader.Read<std::uint64_t>();
+    const std::uint64_t size = reader.Read<std::uint64_t>();
+    const void* data = reader.ReadBytes(static_cast<std::size_t>(size));
+    if (Buffer* buffer = GetBuffer(id))
+    {
+        if (data != nullptr)
+            renderer.WriteBuffer(*buffer, offset, data, size);
+    }
+}
+
+void CaptureReplayer::Pimpl::WriteTexture(CaptureStreamReader& reader)
+{
+    const CaptureObjectID id = reader.Read<CaptureObjectID>();
+    const TextureRegion region = reader.Read<TextureRegion>();
+    ImageView imageView;
+    {
+        ReadValue(reader, imageView.format);
+        ReadValue(reader, imageView.dataType);
+        ReadValue(reader, imageView.rowStride);
+        ReadValue(reader, imageView.layerStride);
+        imageView.dataSize  = static_cast<std::size_t>(reader.Read<std::uint64_t>());
+        imageView.data      = reader.ReadBytes(imageView.dataSize);
+    }
+    if (Texture* texture = GetTexture(id))
+    {
+        if (imageView.data != nullptr)
+            renderer.WriteTexture(*texture, region, imageView);
+    }
+}
+
+void CaptureReplayer::Pimpl::WriteResourceHeap(CaptureStreamReader& reader)
+{
+    const CaptureObjectID id = reader.Read<CaptureObjectID>();
+    const std::uint32_t firstDescriptor = reader.Read<std::uint32_t>();
+    const std::uint32_t numResourceViews = reader.Read<std::uint32_t>();
+
+    std::vector<ResourceViewDescriptor> resourceViews(numResourceViews);
+    for (ResourceViewDescriptor& resourceView : resourceViews)
+    {
+        resourceView.resource = GetResource(reader.Read<CaptureObjectID>());
+        ReadValue(reader, resourceView.textureView);
+        ReadValue(reader, resourceView.bufferView);
+        ReadValue(reader, resourceView.initialCount);
+    }
+
+    if (ResourceHeap* resourceHeap = GetResourceHeap(id))
+    {
+        if (!reader.HasError())
+            renderer.WriteResourceHeap(*resourceHeap, firstDescriptor, resourceViews);
+    }
+}
+
+bool CaptureReplayer::Pimpl::DecodeCommands(CommandBuffer& cmdBuffer, CaptureStreamReader& reader)
+{
+    std::vector<Viewport>                   viewports;
+    std::vector<Scissor>                    scissors;
+    std::vector<ClearValue>                 clearValues;
+    std::vector<Buffer*>                    buffers;
+    std::vector<Texture*>                   textures;
+    std::vector<IndirectArgumentDescriptor> indirectArguments;
+    std::vector<char>                       data;
+
+    /* Copies the specified number of bytes, since they might not be aligned within the stream */
+    auto ReadData = [&reader, &data](std::size_t size) -> const void*
+    {
+        data.resize(size);
+        if (const void* src = reader.ReadBytes(size))
+            std::memcpy(data.data(), src, size);
+        return data.data();
+    };
+
+    auto ReadBarriers = [this, &reader, &buffers, &textures]()
+    {
+        buffers.clear();
+        textures.clear();
+        const std::uint32_t numBuffers = reader.Read<std::uint32_t>();
+        for_range(i, numBuffers)
+        {
+            if (Buffer* buffer = GetBuffer(reader.Read<CaptureObjectID>()))
+                buffers.push_back(buffer);
+        }
+        const std::uint32_t numTextures = reader.Read<std::uint32_t>();
+        for_range(i, numTextures)
+        {
+            if (Texture* texture = GetTexture(reader.Read<CaptureObjectID>()))
+                textures.push_back(texture);
+        }
+    };
+
+    auto ID = [&reader]() -> CaptureObjectID
+    {
+        return reader.Read<CaptureObjectID>();
+    };
+
+    auto U32 = [&reader]() -> std::uint32_t
+    {
+        return reader.Read<std::uint32_t>();
+    };
+
+    auto U64 = [&reader]() -> std::uint64_t
+    {
+        return reader.Read<std::uint64_t>();
+    };
+
+    while (!reader.IsEnd())
+    {
+        const CaptureOpcode opcode = reader.Read<CaptureOpcode>();
+        switch (opcode)
+        {
+            case CaptureOpcode::Execute:
+            {
+                /* Secondary command buffers are inlined into the primary command buffer */
+                CaptureStreamReader secondaryReader = reader.ReadStream();
+                if (!DecodeCommands(cmdBuffer, secondaryReader))
+                    return false;
+            }
+            break;
+
+            case CaptureOpcode::UpdateBuffer:
+            {
+                Buffer* dstBuffer = GetBuffer(ID());
+                const std::uint64_t dstOffset = U64();
+                const std::uint16_t dataSize = reader.Read<std::uint16_t>();
+                const void* src = ReadData(dataSize);
+                if (dstBuffer != nullptr)
+                    cmdBuffer.UpdateBuffer(*dstBuffer, dstOffset, src, dataSize);
+            }
+            break;
+
+            case CaptureOpcode::CopyBuffer:
+            {
+                Buffer* dstBuffer = GetBuffer(ID());
+                const std::uint64_t dstOffset = U64();
+                Buffer* srcBuffer = GetBuffer(ID());
+                const std::uint64_t srcOffset = U64();
+                const std::uint64_t size = U64();
+                if (dstBuffer != nullptr && srcBuffer != nullptr)
+                    cmdBuffer.CopyBuffer(*dstBuffer, dstOffset, *srcBuffer, srcOffset, size);
+            }
+            break;
+
+            case CaptureOpcode::CopyBufferFromTexture:
+            {
+                Buffer* dstBuffer = GetBuffer(ID());
+                const std::uint64_t dstOffset = U64();
+                Texture* srcTexture = GetTexture(ID());
+                const TextureRegion srcRegion = reader.Read<TextureRegion>();
+                const std::uint32_t rowStride = U32();
+                const std::uint32_t layerStride = U32();
+                if (dstBuffer != nullptr && srcTexture != nullptr)
+                    cmdBuffer.CopyBufferFromTexture(*dstBuffer, dstOffset, *srcTexture, srcRegion, rowStride, layerStride);
+            }
+            break;
+
+            case CaptureOpcode::FillBuffer:
+            {
+                Buffer* dstBuffer = GetBuffer(ID());
+                const std::uint64_t dstOffset = U64();
+                const std::uint32_t value = U32();
+                const std::uint64_t fillSize = U64();
+                if (dstBuffer != nullptr)
+                    cmdBuffer.FillBuffer(*dstBuffer, dstOffset, value, fillSize);
+            }
+            break;
+
+            case CaptureOpcode::CopyTexture:
+            {
+                Texture* dstTexture = GetTexture(ID());
+                const TextureLocation dstLocation = reader.Read<TextureLocation>();
+                Texture* srcTexture = GetTexture(ID());
+                const TextureLocation srcLocation = reader.Read<TextureLocation>();
+                const Extent3D extent = reader.Read<Extent3D>();
+                if (dstTexture != nullptr && srcTexture != nullptr)
+                    cmdBuffer.CopyTexture(*dstTexture, dstLocation, *srcTexture, srcLocation, extent);
+            }
+            break;
+
+            case CaptureOpcode::CopyTextureFromBuffer:
+            {
+                Texture* dstTexture = GetTexture(ID());
+                const TextureRegion dstRegion = reader.Read<TextureRegion>();
+                Buffer* srcBuffer = GetBuffer(ID());
+                const std::uint64_t srcOffset = U64();
+                const std::uint32_t rowStride = U32();
+                const std::uint32_t layerStride = U32();
+                if (dstTexture != nullptr && srcBuffer != nullptr)
+                    cmdBuffer.CopyTextureFromBuffer(*dstTexture, dstRegion, *srcBuffer, srcOffset, rowStride, layerStride);
+            }
+            break;
+
+            case CaptureOpcode::CopyTextureFromFramebuffer:
+            {
+                Texture* dstTexture = GetTexture(ID());
+                const TextureRegion dstRegion = reader.Read<TextureRegion>();
+                const Offset2D srcOffset = reader.Read<Offset2D>();
+                if (dstTexture != nullptr)
+                    cmdBuffer.CopyTextureFromFramebuffer(*dstTexture, dstRegion, srcOffset);
+            }
+            break;
+
+            case CaptureOpcode::GenerateMips:
+            {
+                if (Texture* texture = GetTexture(ID()))
+                    cmdBuffer.GenerateMips(*texture);
+            }
+            break;
+
+            case CaptureOpcode::GenerateMipsRange:
+            {
+                Texture* texture = GetTexture(ID());
+                const TextureSubresource subresource = reader.Read<TextureSubresource>();
+                if (texture != nullptr)
+                    cmdBuffer.GenerateMips(*texture, subresource);
+            }
+            break;
+
+            case CaptureOpcode::SetViewports:
+            {
+                ReadArray(reader, viewports, U32());
+                cmdBuffer.SetViewports(static_cast<std::uint32_t>(viewports.size()), viewports.data());
+            }
+            break;
+
+            case CaptureOpcode::SetScissors:
+            {
+                ReadArray(reader, scissors, U32());
+                cmdBuffer.SetScissors(static_cast<std::uint32_t>(scissors.size()), scissors.data());
+            }
+            break;
+
+            case CaptureOpcode::SetVertexBuffer:
+            {
+                if (Buffer* buffer = GetBuffer(ID()))
+                    cmdBuffer.SetVertexBuffer(*buffer);
+            }
+            break;
+
+            case CaptureOpcode::SetVertexBufferArray:
+            {
+                if (BufferArray* bufferArray = GetBufferArray(ID()))
+                    cmdBuffer.SetVertexBufferArray(*bufferArray);
+            }
+            break;
+
+            case CaptureOpcode::SetIndexBuffer:
+            {
+                if (Buffer* buffer = GetBuffer(ID()))
+                    cmdBuffer.SetIndexBuffer(*buffer);
+            }
+            break;
+
+            case CaptureOpcode::SetIndexBufferExt:
+            {
+                Buffer* buffer = GetBuffer(ID());
+                const Format format = reader.Read<Format>();
+                const std::uint64_t offset = U64();
+                if (buffer != nullptr)
+                    cmdBuffer.SetIndexBuffer(*buffer, format, offset);
+            }
+            break;
+
+            case CaptureOpcode::SetResourceHeap:
+            {
+                ResourceHeap* resourceHeap = GetResourceHeap(ID());
+                const std::uint32_t descriptorSet = U32();
+                if (resourceHeap != nullptr)
+                    cmdBuffer.SetResourceHeap(*resourceHeap, descriptorSet);
+            }
+            break;
+
+            case CaptureOpcode::SetResource:
+            {
+                const std::uint32_t descriptor = U32();
+                if (Resource* resource = GetResource(ID()))
+                    cmdBuffer.SetResource(descriptor, *resource);
+            }
+            break;
+
+            case CaptureOpcode::SetConstantBufferRange:
+            {
+                const std::uint32_t descriptor = U32();
+                Buffer* buffer = GetBuffer(ID());
+                const std::uint64_t offset = U64();
+                const std::uint64_t size = U64();
+                if (buffer != nullptr)
+                    cmdBuffer.SetConstantBufferRange(descriptor, *buffer, offset, size);
+            }
+            break;
+
+            case CaptureOpcode::ResourceBarrier:
+            {
+                ReadBarriers();
+                cmdBuffer.ResourceBarrier(static_cast<std::uint32_t>(buffers.size()), buffers.data(), static_cast<std::uint32_t>(textures.size()), textures.data());
+            }
+            break;
+
+            case CaptureOpcode::BeginResourceBarrier:
+            {
+                ReadBarriers();
+                cmdBuffer.BeginResourceBarrier(static_cast<std::uint32_t>(buffers.size()), buffers.data(), static_cast<std::uint32_t>(textures.size()), textures.data());
+            }
+            break;
+
+            case CaptureOpcode::EndResourceBarrier:
+            {
+                ReadBarriers();
+                cmdBuffer.EndResourceBarrier(static_cast<std::uint32_t>(buffers.size()), buffers.data(), static_cast<std::uint32_t>(textures.size()), textures.data());
+            }
+            break;
+
+            case CaptureOpcode::AliasingBarrier:
+            {
+                Texture* textureBefore = GetTexture(ID());
+                Texture* textureAfter = GetTexture(ID());
+                cmdBuffer.AliasingBarrier(textureBefore, textureAfter);
+            }
+            break;
+
+            case CaptureOpcode::BeginRenderPass:
+            {
+                RenderTarget* renderTarget = GetRenderTarget(ID());
+                const RenderPass* renderPass = GetRenderPass(ID());
+                ReadArray(reader, clearValues, U32());
+                const std::uint32_t swapBufferIndex = U32();
+                if (renderTarget == nullptr)
+                    return false;
+                cmdBuffer.BeginRenderPass(*renderTarget, renderPass, static_cast<std::uint32_t>(clearValues.size()), clearValues.data(), swapBufferIndex);
+            }
+            break;
+
+            case CaptureOpcode::EndRenderPass:
+                cmdBuffer.EndRenderPass();
+                break;
+
+            case CaptureOpcode::Clear:
+            {
+                const long flags = ReadFlags(reader);
+                const ClearValue clearValue = reader.Read<ClearValue>();
+                cmdBuffer.Clear(flags, clearValue);
+            }
+            break;
+
+            case CaptureOpcode::ClearAttachments:
+            {
+                std::vector<AttachmentClear> attachments(U32());
+                for (AttachmentClear& attachment : attachments)
+                {
+                    attachment.flags = ReadFlags(reader);
+                    ReadValue(reader, attachment.colorAttachment);
+                    ReadValue(reader, attachment.clearValue);
+                }
+                cmdBuffer.ClearAttachments(static_cast<std::uint32_t>(attachments.size()), attachments.data());
+            }
+            break;
+
+            case CaptureOpcode::SetPipelineState:
+            {
+                if (PipelineState* pipelineState = GetPipelineState(ID()))
+                    cmdBuffer.SetPipelineState(*pipelineState);
+            }
+            break;
+
+            case CaptureOpcode::SetBlendFactor:
+            {
+                float color[4];
+                for_range(i, 4)
+                    ReadValue(reader, color[i]);
+                cmdBuffer.SetBlendFactor(color);
+            }
+            break;
+
+            case CaptureOpcode::SetStencilReference:
+            {
+                const std::uint32_t reference = U32();
+                const StencilFace stencilFace = reader.Read<StencilFace>();
+                cmdBuffer.SetStencilReference(reference, stencilFace);
+            }
+            break;
+
+            case CaptureOpcode::SetShadingRate:
+                cmdBuffer.SetShadingRate(reader.Read<ShadingRate>());
+                break;
+
+            case CaptureOpcode::SetUniforms:
+            {
+                const std::uint32_t first = U32();
+                const std::uint16_t dataSize = reader.Read<std::uint16_t>();
+                cmdBuffer.SetUniforms(first, ReadData(dataSize), dataSize);
+            }
+            break;
+
+            case CaptureOpcode::BeginQuery:
+            {
+                QueryHeap* queryHeap = GetQueryHeap(ID());
+                const std::uint32_t query = U32();
+                if (queryHeap != nullptr)
+                    cmdBuffer.BeginQuery(*queryHeap, query);
+            }
+            break;
+
+            case CaptureOpcode::EndQuery:
+            {
+                QueryHeap* queryHeap = GetQueryHeap(ID());
+                const std::uint32_t query = U32();
+                if (queryHeap != nullptr)
+                    cmdBuffer.EndQuery(*queryHeap, query);
+            }
+            break;
+
+            case CaptureOpcode::ResolveQueryData:
+            {
+                QueryHeap* queryHeap = GetQueryHeap(ID());
+                const std::uint32_t firstQuery = U32();
+                const std::uint32_t numQueries = U32();
+                Buffer* dstBuffer = GetBuffer(ID());
+                const std::uint64_t dstOffset = U64();
+                if (queryHeap != nullptr && dstBuffer != nullptr)
+                    cmdBuffer.ResolveQueryData(*queryHeap, firstQuery, numQueries, *dstBuffer, dstOffset);
+            }
+            break;
+
+            case CaptureOpcode::BeginRenderCondition:
+            {
+                QueryHeap* queryHeap = GetQueryHeap(ID());
+                const std::uint32_t query = U32();
+                const RenderConditionMode mode = reader.Read<RenderConditionMode>();
+                if (queryHeap != nullptr)
+                    cmdBuffer.BeginRenderCondition(*queryHeap, query, mode);
+            }
+            break;
+
+            case CaptureOpcode::EndRenderCondition:
+                cmdBuffer.EndRenderCondition();
+                break;
+
+            case CaptureOpcode::BeginStreamOutput:
+            {
+                buffers.clear();
+                const std::uint32_t numBuffers = U32();
+                for_range(i, numBuffers)
+                {
+                    if (Buffer* buffer = GetBuffer(ID()))
+                        buffers.push_back(buffer);
+                }
+                cmdBuffer.BeginStreamOutput(static_cast<std::uint32_t>(buffers.size()), buffers.data());
+            }
+            break;
+
+            case CaptureOpcode::EndStreamOutput:
+                cmdBuffer.EndStreamOutput();
+                break;
+
+            case CaptureOpcode::Draw:
+            {
+                const std::uint32_t numVertices = U32();
+                const std::uint32_t firstVertex = U32();
+                cmdBuffer.Draw(numVertices, firstVertex);
+            }
+            break;
+
+            case CaptureOpcode::DrawIndexed:
+            {
+                const std::uint32_t numIndices = U32();
+                const std::uint32_t firstIndex = U32();
+                cmdBuffer.DrawIndexed(numIndices, firstIndex);
+            }
+            break;
+
+            case CaptureOpcode::DrawIndexedOffset:
+            {
+                const std::uint32_t numIndices = U32();
+                const std::uint32_t firstIndex = U32();
+                const std::int32_t vertexOffset = reader.Read<std::int32_t>();
+                cmdBuffer.DrawIndexed(numIndices, firstIndex, vertexOffset);
+            }
+            break;
+
+            case CaptureOpcode::DrawInstanced:
+            {
+                const std::uint32_t numVertices = U32();
+                const std::uint32_t firstVertex = U32();
+                const std::uint32_t numInstances = U32();
+                cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances);
+            }
+            break;
+
+            case CaptureOpcode::DrawInstancedOffset:
+            {
+                const std::uint32_t numVertices = U32();
+                const std::uint32_t firstVertex = U32();
+                const std::uint32_t numInstances = U32();
+                const std::uint32_t firstInstance = U32();
+                cmdBuffer.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance);
+            }
+            break;
+
+            case CaptureOpcode::DrawIndexedInstanced:
+            {
+                const std::uint32_t numIndices = U32();
+                const std::uint32_t numInstances = U32();
+                const std::uint32_t firstIndex = U32();
+                cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex);
+            }
+            break;
+
+            case CaptureOpcode::DrawIndexedInstancedOffset:
+            {
+                const std::uint32_t numIndices = U32();
+                const std::uint32_t numInstances = U32();
+                const std::uint32_t firstIndex = U32();
+                const std::int32_t vertexOffset = reader.Read<std::int32_t>();
+                cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset);
+            }
+            break;
+
+            case CaptureOpcode::DrawIndexedInstancedFirst:
+            {
+                const std::uint32_t numIndices = U32();
+                const std::uint32_t numInstances = U32();
+                const std::uint32_t firstIndex = U32();
+                const std::int32_t vertexOffset = reader.Read<std::int32_t>();
+                const std::uint32_t firstInstance = U32();
+                cmdBuffer.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+            }
+            break;
+
+            case CaptureOpcode::DrawIndirect:
+            case CaptureOpcode::DrawIndexedIndirect:
+            case CaptureOpcode::DispatchIndirect:
+            {
+                Buffer* buffer = GetBuffer(ID());
+                const std::uint64_t offset = U64();
+                if (buffer != nullptr)
+                {
+                    if (opcode == CaptureOpcode::DrawIndirect)
+                        cmdBuffer.DrawIndirect(*buffer, offset);
+                    else if (opcode == CaptureOpcode::DrawIndexedIndirect)
+                        cmdBuffer.DrawIndexedIndirect(*buffer, offset);
+                    else
+                        cmdBuffer.DispatchIndirect(*buffer, offset);
+                }
+            }
+            break;
+
+            case CaptureOpcode::DrawIndirectMulti:
+            case CaptureOpcode::DrawIndexedIndirectMulti:
+            {
+                Buffer* buffer = GetBuffer(ID());
+                const std::uint64_t offset = U64();
+                const std::uint32_t numCommands = U32();
+                const std::uint32_t stride = U32();
+                if (buffer != nullptr)
+                {
+                    if (opcode == CaptureOpcode::DrawIndirectMulti)
+                        cmdBuffer.DrawIndirect(*buffer, offset, numCommands, stride);
+                    else
+                        cmdBuffer.DrawIndexedIndirect(*buffer, offset, numCommands, stride);
+                }
+            }
+            break;
+
+            case CaptureOpcode::DrawIndirectCount:
+            case CaptureOpcode::DrawIndexedIndirectCount:
+            {
+                Buffer* buffer = GetBuffer(ID());
+                const std::uint64_t offset = U64();
+                Buffer* countBuffer = GetBuffer(ID());
+                const std::uint64_t countOffset = U64();
+                const std::uint32_t maxNumCommands = U32();
+                const std::uint32_t stride = U32();
+                if (buffer != nullptr && countBuffer != nullptr)
+                {
+                    if (opcode == CaptureOpcode::DrawIndirectCount)
+                        cmdBuffer.DrawIndirectCount(*buffer, offset, *countBuffer, countOffset, maxNumCommands, stride);
+                    else
+                        cmdBuffer.DrawIndexedIndirectCount(*buffer, offset, *countBuffer, countOffset, maxNumCommands, stride);
+                }
+            }
+            break;
+
+            case CaptureOpcode::DrawStreamOutput:
+                cmdBuffer.DrawStreamOutput();
+                break;
+
+            case CaptureOpcode::DrawMeshTasks:
+            {
+                const std::uint32_t numWorkGroupsX = U32();
+                const std::uint32_t numWorkGroupsY = U32();
+                const std::uint32_t numWorkGroupsZ = U32();
+                cmdBuffer.DrawMeshTasks(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+            }
+            break;
+
+            case CaptureOpcode::DrawMeshTasksIndirect:
+            {
+                Buffer* buffer = GetBuffer(ID());
+                const std::uint64_t offset = U64();
+                const std::uint32_t numCommands = U32();
+                const std::uint32_t stride = U32();
+                if (buffer != nullptr)
+                    cmdBuffer.DrawMeshTasksIndirect(*buffer, offset, numCommands, stride);
+            }
+            break;
+
+            case CaptureOpcode::ExecuteIndirect:
+            {
+                Buffer* buffer = GetBuffer(ID());
+                const std::uint64_t offset = U64();
+                Buffer* countBuffer = GetBuffer(ID());
+                const std::uint64_t countOffset = U64();
+                const std::uint32_t maxNumCommands = U32();
+                IndirectCommandDescriptor commandDesc;
+                commandDesc.stride = U32();
+                ReadArray(reader, indirectArguments, U32());
+                commandDesc.arguments = indirectArguments;
+                if (buffer != nullptr)
+                    cmdBuffer.ExecuteIndirect(commandDesc, *buffer, offset, countBuffer, countOffset, maxNumCommands);
+            }
+            break;
+
+            case CaptureOpcode::DispatchTiles:
+                cmdBuffer.DispatchTiles();
+                break;
+
+            case CaptureOpcode::Dispatch:
+            {
+                const std::uint32_t numWorkGroupsX = U32();
+                const std::uint32_t numWorkGroupsY = U32();
+                const std::uint32_t numWorkGroupsZ = U32();
+                cmdBuffer.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+            }
+            break;
+
+            case CaptureOpcode::PushDebugGroup:
+                cmdBuffer.PushDebugGroup(reader.ReadString());
+                break;
+
+            case CaptureOpcode::PopDebugGroup:
+                cmdBuffer.PopDebugGroup();
+                break;
+
+            default:
+                return false;
+        }
+
+        if (reader.HasError())
+            return false;
+    }
+
+    return true;
+}
+
+void CaptureReplayer::Pimpl::Errorf(const char* format, const char* arg)
+{
+    if (report != nullptr)
+        report->Errorf(format, arg);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
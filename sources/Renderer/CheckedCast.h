@@ -89,9 +89,28 @@ inline TDst ObjectCast(TSrc&& obj)
 
 #endif // /LLGL_ENABLE_CHECKED_CAST
 
+// Unchecked cast that is used in hot paths regardless of LLGL_ENABLE_CHECKED_CAST, see LLGL_HOT_CAST.
+template <typename TDst, typename TSrc>
+inline TDst StaticObjectCast(TSrc&& obj)
+{
+    return static_cast<TDst>(obj);
+}
+
 #define LLGL_CAST(TYPE, OBJ) \
     ObjectCast<TYPE>(OBJ)
 
+/*
+Cast for the hot paths of command buffer encoding, e.g. the arguments of CommandBuffer::SetVertexBuffer() or CommandBuffer::SetPipelineState().
+This is only a checked cast if both LLGL_ENABLE_CHECKED_CAST and LLGL_ENABLE_CHECKED_CAST_HOT_PATHS are enabled, otherwise it is always a static cast.
+*/
+#if LLGL_ENABLE_CHECKED_CAST && LLGL_ENABLE_CHECKED_CAST_HOT_PATHS
+#   define LLGL_HOT_CAST(TYPE, OBJ) \
+        ObjectCast<TYPE>(OBJ)
+#else
+#   define LLGL_HOT_CAST(TYPE, OBJ) \
+        StaticObjectCast<TYPE>(OBJ)
+#endif
+
 
 } // /namespace LLGL
 
@@ -0,0 +1,261 @@
+/*
+ * ChromeTrace.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ChromeTrace.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <string>
+#include <stdio.h>
+
+
+namespace LLGL
+{
+
+
+// Process IDs for the CPU and GPU timelines
+static constexpr int g_chromeTracePidCPU        = 1;
+static constexpr int g_chromeTracePidGPU        = 2;
+
+// Thread IDs of the CPU track for time records and the GPU track for timer scopes; CPU tracks for event records start at thread ID 1
+static constexpr int g_chromeTraceTidCommands   = 0;
+static constexpr int g_chromeTraceTidScopes     = 1;
+
+static const char* ProfileEventTypeToCategory(ProfileEventType type)
+{
+    switch (type)
+    {
+        case ProfileEventType::Encoding:    return "Encoding";
+        case ProfileEventType::Submission:  return "Submission";
+        case ProfileEventType::Wait:        return "Wait";
+        case ProfileEventType::Present:     return "Present";
+    }
+    return "Event";
+}
+
+class ChromeTraceWriter
+{
+
+    public:
+
+        ChromeTraceWriter(std::uint64_t cpuTicksOrigin) :
+            cpuTicksOrigin_ { cpuTicksOrigin                                    },
+            usecPerTick_    { 1.0e6 / static_cast<double>(Timer::Frequency()) }
+        {
+            out_ += "{\n\"displayTimeUnit\": \"ns\",\n\"traceEvents\": [\n";
+        }
+
+        // Writes a complete event, i.e. an event with start time and duration.
+        void WriteCompleteEvent(
+            int                 pid,
+            int                 tid,
+            const char*         name,
+            const char*         category,
+            std::uint64_t       ticksStart,
+            std::uint64_t       ticksEnd,
+            const std::string&  args = "")
+        {
+            BeginEvent();
+            out_ += "{\"ph\": \"X\", \"pid\": ";
+            out_ += std::to_string(pid);
+            out_ += ", \"tid\": ";
+            out_ += std::to_string(tid);
+            out_ += ", \"name\": ";
+            WriteString(name);
+            out_ += ", \"cat\": ";
+            WriteString(category);
+            out_ += ", \"ts\": ";
+            WriteMicroseconds(ticksStart > cpuTicksOrigin_ ? ticksStart - cpuTicksOrigin_ : 0);
+            out_ += ", \"dur\": ";
+            WriteMicroseconds(ticksEnd > ticksStart ? ticksEnd - ticksStart : 0);
+            if (!args.empty())
+            {
+                out_ += ", \"args\": {";
+                out_ += args;
+                out_ += '}';
+            }
+            out_ += '}';
+        }
+
+        // Writes a metadata event to name the specified process or thread.
+        void WriteMetadataEvent(int pid, int tid, const char* metadata, const std::string& name)
+        {
+            BeginEvent();
+            out_ += "{\"ph\": \"M\", \"pid\": ";
+            out_ += std::to_string(pid);
+            out_ += ", \"tid\": ";
+            out_ += std::to_string(tid);
+            out_ += ", \"name\": ";
+            WriteString(metadata);
+            out_ += ", \"args\": {\"name\": ";
+            WriteString(name.c_str());
+            out_ += "}}";
+        }
+
+        // Finishes the JSON document and returns it.
+        std::string Finish()
+        {
+            out_ += "\n],\n\"otherData\": {\"producer\": \"LLGL\"}\n}\n";
+            return std::move(out_);
+        }
+
+    private:
+
+        void BeginEvent()
+        {
+            if (!isFirstEvent_)
+                out_ += ",\n";
+            isFirstEvent_ = false;
+        }
+
+        // Writes the specified string with escape sequences for all characters that are not allowed in a JSON string.
+        void WriteString(const char* s)
+        {
+            out_ += '\"';
+            for (; s != nullptr && *s != '\0'; ++s)
+            {
+                const char c = *s;
+                if (c == '\"' || c == '\\')
+                {
+                    out_ += '\\';
+                    out_ += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char escaped[8];
+                    ::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    out_ += escaped;
+                }
+                else
+                    out_ += c;
+            }
+            out_ += '\"';
+        }
+
+        // Writes the specified CPU ticks in microseconds with nanosecond precision.
+        void WriteMicroseconds(std::uint64_t ticks)
+        {
+            char value[32];
+            ::snprintf(value, sizeof(value), "%.3f", static_cast<double>(ticks) * usecPerTick_);
+            out_ += value;
+        }
+
+    private:
+
+        std::string         out_;
+        bool                isFirstEvent_   = true;
+        const std::uint64_t cpuTicksOrigin_ = 0;
+        const double        usecPerTick_    = 0.0;
+
+};
+
+// Returns the earliest CPU ticks of all exported records in the specified profile, which is used as origin of the trace.
+static std::uint64_t FindEarliestCPUTicks(const FrameProfile& profile)
+{
+    std::uint64_t ticks = ~0ull;
+
+    auto UpdateEarliestTicks = [&ticks](std::uint64_t recordTicks)
+    {
+        /* Ignore timestamps that have not been recorded */
+        if (recordTicks != 0)
+            ticks = std::min(ticks, recordTicks);
+    };
+
+    for (const ProfileEventRecord& rec : profile.eventRecords)
+        UpdateEarliestTicks(rec.cpuTicksStart);
+    for (const ProfileTimeRecord& rec : profile.timeRecords)
+        UpdateEarliestTicks(rec.cpuTicksStart);
+    for (const ProfileScopeRecord& rec : profile.scopeRecords)
+        UpdateEarliestTicks(rec.gpuTicksStart);
+
+    return (ticks != ~0ull ? ticks : 0);
+}
+
+LLGL_EXPORT Blob WriteChromeTrace(const FrameProfile& profile)
+{
+    ChromeTraceWriter writer{ FindEarliestCPUTicks(profile) };
+
+    /* Name processes and tracks */
+    writer.WriteMetadataEvent(g_chromeTracePidCPU, 0, "process_name", "CPU");
+    writer.WriteMetadataEvent(g_chromeTracePidGPU, 0, "process_name", "GPU");
+
+    if (!profile.timeRecords.empty())
+        writer.WriteMetadataEvent(g_chromeTracePidCPU, g_chromeTraceTidCommands, "thread_name", "Commands");
+
+    if (!profile.scopeRecords.empty())
+        writer.WriteMetadataEvent(g_chromeTracePidGPU, g_chromeTraceTidScopes, "thread_name", "Timer Scopes");
+
+    std::uint32_t numThreads = 0;
+    for (const ProfileEventRecord& rec : profile.eventRecords)
+        numThreads = std::max(numThreads, rec.thread + 1);
+
+    for_range(i, numThreads)
+        writer.WriteMetadataEvent(g_chromeTracePidCPU, static_cast<int>(i + 1), "thread_name", "Thread " + std::to_string(i));
+
+    /* Write CPU events per thread */
+    for (const ProfileEventRecord& rec : profile.eventRecords)
+    {
+        writer.WriteCompleteEvent(
+            g_chromeTracePidCPU,
+            static_cast<int>(rec.thread + 1),
+            rec.annotation.c_str(),
+            ProfileEventTypeToCategory(rec.type),
+            rec.cpuTicksStart,
+            rec.cpuTicksEnd
+        );
+    }
+
+    /* Write commands with their elapsed GPU time */
+    for (const ProfileTimeRecord& rec : profile.timeRecords)
+    {
+        writer.WriteCompleteEvent(
+            g_chromeTracePidCPU,
+            g_chromeTraceTidCommands,
+            rec.annotation.c_str(),
+            "Command",
+            rec.cpuTicksStart,
+            rec.cpuTicksEnd,
+            "\"gpuTimeNs\": " + std::to_string(rec.elapsedTime)
+        );
+    }
+
+    /* Write timer scopes at their calibrated GPU timestamps */
+    for (const ProfileScopeRecord& rec : profile.scopeRecords)
+    {
+        writer.WriteCompleteEvent(
+            g_chromeTracePidGPU,
+            g_chromeTraceTidScopes,
+            rec.annotation.c_str(),
+            "Scope",
+            rec.gpuTicksStart,
+            rec.gpuTicksEnd,
+            "\"frame\": " + std::to_string(rec.frame) + ", \"depth\": " + std::to_string(rec.depth) + ", \"gpuTimeNs\": " + std::to_string(rec.elapsedTime)
+        );
+    }
+
+    return Blob::CreateStrongRef(writer.Finish());
+}
+
+LLGL_EXPORT bool SaveChromeTrace(const FrameProfile& profile, const char* filename)
+{
+    FILE* file = ::fopen(filename, "wb");
+    if (file == nullptr)
+        return false;
+
+    const Blob trace = WriteChromeTrace(profile);
+    const bool result = (::fwrite(trace.GetData(), 1, trace.GetSize(), file) == trace.GetSize());
+    ::fclose(file);
+
+    return result;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,99 @@
+/*
+ * CommandBufferGroup.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/CommandBufferGroup.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include "../Core/Assertion.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+CommandBufferGroup::CommandBufferGroup(RenderSystem& renderer, const CommandBufferGroupDescriptor& groupDesc) :
+    renderer_     { renderer                                                                                },
+    commandQueue_ { groupDesc.commandQueue != nullptr ? groupDesc.commandQueue : renderer.GetCommandQueue() },
+    numClaimed_   { 0                                                                                       }
+{
+    LLGL_ASSERT(groupDesc.capacity > 0, "capacity of command buffer group must be greater than zero");
+    LLGL_ASSERT(
+        (groupDesc.commandBufferDesc.flags & CommandBufferFlags::ImmediateSubmit) == 0,
+        "command buffers of a group must not be created with CommandBufferFlags::ImmediateSubmit"
+    );
+
+    slots_.resize(groupDesc.capacity);
+    for (Slot& slot : slots_)
+        slot.commandBuffer = renderer.CreateCommandBuffer(groupDesc.commandBufferDesc);
+
+    sortedSlots_.reserve(groupDesc.capacity);
+    submitList_.reserve(groupDesc.capacity);
+}
+
+CommandBufferGroup::~CommandBufferGroup()
+{
+    for (Slot& slot : slots_)
+        renderer_.Release(*slot.commandBuffer);
+}
+
+CommandBuffer* CommandBufferGroup::Begin(std::uint64_t sortKey)
+{
+    /* Claim next slot; once the group is exhausted, the counter keeps growing, which is clamped to the capacity on the submitting thread */
+    const std::uint32_t index = numClaimed_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= slots_.size())
+        return nullptr;
+
+    Slot& slot = slots_[index];
+    slot.sortKey = sortKey;
+    slot.commandBuffer->Begin();
+    return slot.commandBuffer;
+}
+
+void CommandBufferGroup::Submit()
+{
+    const std::uint32_t numClaimed = GetNumClaimed();
+    if (numClaimed == 0)
+        return;
+
+    /* Sort claimed slots by their keys; the recording jobs must have been joined by the caller, which makes their writes visible here */
+    sortedSlots_.assign(slots_.begin(), slots_.begin() + numClaimed);
+    std::stable_sort(
+        sortedSlots_.begin(),
+        sortedSlots_.end(),
+        [](const Slot& lhs, const Slot& rhs) -> bool
+        {
+            return (lhs.sortKey < rhs.sortKey);
+        }
+    );
+
+    submitList_.clear();
+    for (const Slot& slot : sortedSlots_)
+        submitList_.push_back(slot.commandBuffer);
+
+    commandQueue_->Submit(numClaimed, submitList_.data());
+
+    Reset();
+}
+
+void CommandBufferGroup::Reset()
+{
+    numClaimed_.store(0, std::memory_order_relaxed);
+}
+
+std::uint32_t CommandBufferGroup::GetNumClaimed() const
+{
+    return std::min(numClaimed_.load(std::memory_order_relaxed), static_cast<std::uint32_t>(slots_.size()));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
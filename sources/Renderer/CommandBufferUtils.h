@@ -0,0 +1,93 @@
+/*
+ * CommandBufferUtils.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_COMMAND_BUFFER_UTILS_H
+#define LLGL_COMMAND_BUFFER_UTILS_H
+
+
+#include <LLGL/CommandBufferFlags.h>
+#include "../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+/* ----- Functions ----- */
+
+/*
+Encodes all draw records of the specified packed draw descriptor into the command buffer, see CommandBuffer::DrawPacked().
+Bindings that are equal to those of the previous record are skipped.
+Backends instantiate this with their final command buffer class, so the calls of each record are resolved statically instead of through the vtable.
+*/
+template <typename TCommandBuffer>
+void EncodePackedDraws(TCommandBuffer& cmdBuffer, const DrawPackedDescriptor& drawDesc)
+{
+    std::uint32_t   vertexBuffer    = LLGL_INVALID_SLOT;
+    std::uint32_t   indexBuffer     = LLGL_INVALID_SLOT;
+    std::uint32_t   resourceHeap    = LLGL_INVALID_SLOT;
+    std::uint32_t   descriptorSet   = 0;
+
+    const char* uniformData = static_cast<const char*>(drawDesc.uniformData);
+
+    for (const DrawRecord& record : drawDesc.records)
+    {
+        if (record.vertexBuffer != LLGL_INVALID_SLOT && record.vertexBuffer != vertexBuffer)
+        {
+            LLGL_DEBUG_ASSERT(record.vertexBuffer < drawDesc.vertexBuffers.size());
+            cmdBuffer.SetVertexBuffer(*drawDesc.vertexBuffers[record.vertexBuffer]);
+            vertexBuffer = record.vertexBuffer;
+        }
+
+        if (record.indexBuffer != LLGL_INVALID_SLOT && record.indexBuffer != indexBuffer)
+        {
+            LLGL_DEBUG_ASSERT(record.indexBuffer < drawDesc.indexBuffers.size());
+            cmdBuffer.SetIndexBuffer(*drawDesc.indexBuffers[record.indexBuffer], drawDesc.indexFormat, 0);
+            indexBuffer = record.indexBuffer;
+        }
+
+        if (record.resourceHeap != LLGL_INVALID_SLOT && (record.resourceHeap != resourceHeap || record.descriptorSet != descriptorSet))
+        {
+            LLGL_DEBUG_ASSERT(record.resourceHeap < drawDesc.resourceHeaps.size());
+            cmdBuffer.SetResourceHeap(*drawDesc.resourceHeaps[record.resourceHeap], record.descriptorSet);
+            resourceHeap    = record.resourceHeap;
+            descriptorSet   = record.descriptorSet;
+        }
+
+        if (record.uniformsOffset != LLGL_INVALID_SLOT)
+        {
+            LLGL_DEBUG_ASSERT_PTR(uniformData);
+            cmdBuffer.SetUniforms(drawDesc.firstUniform, uniformData + record.uniformsOffset, drawDesc.uniformsSize);
+        }
+
+        /* Only use the draw commands with instance offset if necessary, since they require RenderingFeatures::hasOffsetInstancing */
+        if (drawDesc.indexed)
+        {
+            if (record.firstInstance != 0)
+                cmdBuffer.DrawIndexedInstanced(record.numVertices, record.numInstances, record.firstVertex, record.vertexOffset, record.firstInstance);
+            else
+                cmdBuffer.DrawIndexedInstanced(record.numVertices, record.numInstances, record.firstVertex, record.vertexOffset);
+        }
+        else
+        {
+            if (record.firstInstance != 0)
+                cmdBuffer.DrawInstanced(record.numVertices, record.firstVertex, record.numInstances, record.firstInstance);
+            else
+                cmdBuffer.DrawInstanced(record.numVertices, record.firstVertex, record.numInstances);
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
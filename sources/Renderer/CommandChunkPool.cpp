@@ -0,0 +1,128 @@
+/*
+ * CommandChunkPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "CommandChunkPool.h"
+
+
+namespace LLGL
+{
+
+
+// Size (in bytes) of the smallest size class; each following class doubles in size.
+static constexpr std::size_t g_minChunkSize = 8192u;
+
+/*
+Pointer and tag are packed into a single 64-bit word, so the freelist head can be updated with a single compare-exchange.
+On 64-bit platforms, user space addresses are limited to 48 bits, which leaves 16 bits for the tag.
+Chunks whose addresses don't fit into the pointer bits are never stored in a freelist.
+*/
+static constexpr unsigned       g_tagShift      = (sizeof(void*) > 4 ? 48 : 32);
+static constexpr std::uint64_t  g_pointerMask   = (std::uint64_t(1) << g_tagShift) - 1;
+
+static std::uint64_t PackFreeListHead(const void* ptr, std::uint64_t tag)
+{
+    return ((static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr)) & g_pointerMask) | (tag << g_tagShift));
+}
+
+template <typename T>
+static T* UnpackFreeListPointer(std::uint64_t head)
+{
+    return reinterpret_cast<T*>(static_cast<std::uintptr_t>(head & g_pointerMask));
+}
+
+static std::uint64_t UnpackFreeListTag(std::uint64_t head)
+{
+    return (head >> g_tagShift);
+}
+
+// Returns the index of the smallest size class that fits the specified size, or numSizeClasses if the size exceeds all size classes.
+static std::size_t GetSizeClass(std::size_t size, std::size_t numSizeClasses)
+{
+    std::size_t sizeClass = 0;
+    while (sizeClass < numSizeClasses && (g_minChunkSize << sizeClass) < size)
+        ++sizeClass;
+    return sizeClass;
+}
+
+CommandChunkPool& CommandChunkPool::Get()
+{
+    /* Intentionally never destroyed, since command buffers in static containers might be released after static destruction of this pool */
+    static CommandChunkPool* instance = new CommandChunkPool{};
+    return *instance;
+}
+
+void* CommandChunkPool::Alloc(std::size_t& size)
+{
+    const std::size_t sizeClass = GetSizeClass(size, numSizeClasses);
+    if (sizeClass < numSizeClasses)
+    {
+        /* Round size up to its size class and recycle a free chunk if there is one */
+        size = (g_minChunkSize << sizeClass);
+        if (FreeChunk* chunk = Pop(freeLists_[sizeClass]))
+            return chunk;
+    }
+    return ::new char[size];
+}
+
+void CommandChunkPool::Free(void* chunk, std::size_t size)
+{
+    if (chunk == nullptr)
+        return;
+
+    const std::size_t sizeClass = GetSizeClass(size, numSizeClasses);
+    if (sizeClass < numSizeClasses && (g_minChunkSize << sizeClass) == size && (reinterpret_cast<std::uintptr_t>(chunk) & ~g_pointerMask) == 0)
+        Push(freeLists_[sizeClass], static_cast<FreeChunk*>(chunk));
+    else
+        delete [] static_cast<char*>(chunk);
+}
+
+void CommandChunkPool::Trim()
+{
+    for (FreeList& freeList : freeLists_)
+    {
+        while (FreeChunk* chunk = Pop(freeList))
+            delete [] reinterpret_cast<char*>(chunk);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+CommandChunkPool::FreeChunk* CommandChunkPool::Pop(FreeList& freeList)
+{
+    /*
+    Chunks in a freelist are only deleted by Trim(), so reading the next pointer of a chunk that has been popped by another thread in the meantime is safe.
+    The tag makes the compare-exchange fail in that case, even if the same chunk has been pushed back again.
+    */
+    std::uint64_t head = freeList.head.load(std::memory_order_acquire);
+    while (FreeChunk* chunk = UnpackFreeListPointer<FreeChunk>(head))
+    {
+        const std::uint64_t next = PackFreeListHead(chunk->next, UnpackFreeListTag(head) + 1);
+        if (freeList.head.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire))
+            return chunk;
+    }
+    return nullptr;
+}
+
+void CommandChunkPool::Push(FreeList& freeList, FreeChunk* chunk)
+{
+    std::uint64_t head = freeList.head.load(std::memory_order_relaxed);
+    do
+    {
+        chunk->next = UnpackFreeListPointer<FreeChunk>(head);
+    }
+    while (!freeList.head.compare_exchange_weak(head, PackFreeListHead(chunk, UnpackFreeListTag(head) + 1), std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
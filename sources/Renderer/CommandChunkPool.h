@@ -0,0 +1,87 @@
+/*
+ * CommandChunkPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_COMMAND_CHUNK_POOL_H
+#define LLGL_COMMAND_CHUNK_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Process-wide lock-free pool for the memory chunks of virtual command buffers (see VirtualCommandBuffer).
+Chunks are rounded up to power-of-two size classes and returned to a freelist of their class when they are freed,
+so command buffers that are re-encoded every frame recycle the chunks of previous frames instead of reallocating them.
+The pool keeps all chunks up to the high-water mark of the process, i.e. the steady state allocates nothing.
+Chunks that are too large for any size class are allocated and freed directly.
+*/
+class LLGL_EXPORT CommandChunkPool
+{
+
+    public:
+
+        CommandChunkPool(const CommandChunkPool&) = delete;
+        CommandChunkPool& operator = (const CommandChunkPool&) = delete;
+
+        // Returns the instance of the process-wide chunk pool.
+        static CommandChunkPool& Get();
+
+        // Allocates a chunk of at least the specified size (in bytes) and returns the actual size of the chunk in 'size'. This is thread safe.
+        void* Alloc(std::size_t& size);
+
+        // Returns the specified chunk to the pool. The size must be the one that was returned by Alloc(). This is thread safe.
+        void Free(void* chunk, std::size_t size);
+
+        // Frees all chunks in the pool. This must not be called while chunks are allocated or freed on other threads.
+        void Trim();
+
+    private:
+
+        // Number of size classes from 8 KiB up to 8 MiB.
+        static constexpr std::size_t numSizeClasses = 11;
+
+        // Intrusive freelist node stored at the beginning of each chunk in the pool.
+        struct FreeChunk
+        {
+            FreeChunk* next;
+        };
+
+        // Lock-free stack of free chunks. The head stores a pointer and a tag that is incremented on every change to prevent the ABA problem.
+        struct FreeList
+        {
+            std::atomic<std::uint64_t> head { 0 };
+        };
+
+    private:
+
+        CommandChunkPool() = default;
+
+        FreeChunk* Pop(FreeList& freeList);
+        void Push(FreeList& freeList, FreeChunk* chunk);
+
+    private:
+
+        FreeList freeLists_[numSizeClasses];
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,53 @@
+/*
+ * CommandQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/CommandQueue.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/SwapChain.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+void CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Submit command buffers one by one by default */
+    for_range(i, numCommandBuffers)
+    {
+        if (CommandBuffer* commandBuffer = commandBuffers[i])
+            Submit(*commandBuffer);
+    }
+}
+
+void CommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    /* Present swap-chains one by one by default */
+    for_range(i, numSwapChains)
+    {
+        if (SwapChain* swapChain = swapChains[i])
+            swapChain->Present();
+    }
+}
+
+void CommandQueue::SubmitWait(Fence& /*fence*/)
+{
+    /* Command buffers are executed in submission order if there is only a single queue, so there is nothing to wait for by default */
+}
+
+void CommandQueue::UpdateTileMappings(std::uint32_t /*numMappings*/, const TileMappingDescriptor* /*mappings*/)
+{
+    /* Sparse textures are not supported by default */
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
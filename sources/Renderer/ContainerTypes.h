@@ -12,11 +12,13 @@
 #include "../Core/CoreUtils.h"
 #include "../Core/Assertion.h"
 #include "CheckedCast.h"
+#include "ObjectPool.h"
 #include <memory>
 #include <vector>
 #include <utility>
 #include <type_traits>
 #include <unordered_set>
+#include <mutex>
 #include <cstdint>
 
 
@@ -64,7 +66,7 @@ SubType* TakeOwnership(std::vector<std::unique_ptr<BaseType>>& objectSet, std::u
  * Global container class templates
  */
 
-// Alternative for std::unique_ptr<T> with an index into its owning container for fast removal.
+// Alternative for std::unique_ptr<T> with an index into its owning container for fast removal. Memory is allocated from the ObjectPool with one slab list per type.
 template <typename T, typename Payload, std::size_t Alignment = alignof(T)>
 class PayloadUniquePtr final
 {
@@ -117,9 +119,9 @@ class PayloadUniquePtr final
             {
                 if (mem_ != nullptr)
                 {
-                    /* Call destructor and free memory including payload */
+                    /* Call destructor and return memory including payload to its slab */
                     get()->~T();
-                    ::delete [] mem_;
+                    ObjectPool::Free(mem_);
                 }
                 mem_ = mem;
             }
@@ -169,7 +171,8 @@ class PayloadUniquePtr final
         {
             /* Allocate memory for payload and object with enough padding to have pointer alignment of <T> */
             constexpr auto payloadAndPaddingSize = sizeof(Payload) + Alignment - 1;
-            char* mem = ::new char[sizeof(T) + payloadAndPaddingSize];
+            static ObjectPool::SlabList* const slabList = ObjectPool::Get().CreateSlabList(sizeof(T) + payloadAndPaddingSize);
+            char* mem = static_cast<char*>(ObjectPool::Get().Alloc(slabList));
 
             /* Construct unique pointer with payload */
             PayloadUniquePtr<T, Payload> ptr{ mem };
@@ -219,15 +222,35 @@ class UnorderedUniquePtrVector
         using iterator          = typename container_type::iterator;
         using const_iterator    = typename container_type::const_iterator;
 
+        // Owning pointer type of objects that are allocated with make() and inserted later with insert().
+        template <typename TSub>
+        using object_ptr        = IndexedUniquePtr<TSub>;
+
     public:
 
         // Allocates a new object for this container and returns a non-owning raw pointer to that object.
         template <typename TSub, typename... Args>
         TSub* emplace(Args&&... args)
         {
-            /* Allocate object and assign index from container in payload */
-            const IndexPayload payload{ container_.size() };
-            IndexedUniquePtr<TSub> object = IndexedUniquePtr<TSub>::Alloc(payload, std::forward<Args>(args)...);
+            return insert(make<TSub>(std::forward<Args>(args)...));
+        }
+
+        /*
+        Allocates a new object without inserting it into this container.
+        This does not access the container and can be used to construct objects on worker threads.
+        */
+        template <typename TSub, typename... Args>
+        static object_ptr<TSub> make(Args&&... args)
+        {
+            return IndexedUniquePtr<TSub>::Alloc(IndexPayload{ 0 }, std::forward<Args>(args)...);
+        }
+
+        // Inserts an object that was allocated with make() and returns a non-owning raw pointer to that object.
+        template <typename TSub>
+        TSub* insert(object_ptr<TSub>&& object)
+        {
+            /* Assign index from container in payload */
+            object.payload() = IndexPayload{ container_.size() };
             TSub* ref = object.get();
             container_.push_back(std::move(object));
             return ref;
@@ -258,6 +281,32 @@ class UnorderedUniquePtrVector
             }
         }
 
+        // Removes the specified object from this container without releasing its memory and returns the owning pointer to that object.
+        template <typename TBase>
+        object_ptr<T> extract(TBase* object)
+        {
+            object_ptr<T> extracted;
+            if (object != nullptr)
+            {
+                /* Locate object in container with index from payload */
+                T* subTypedObject = ObjectCast<T*>(object);
+                const IndexPayload payload = *reinterpret_cast<IndexPayload*>(reinterpret_cast<char*>(subTypedObject) - sizeof(IndexPayload));
+                LLGL_ASSERT(payload.index < container_.size());
+
+                if (payload.index + 1 < container_.size())
+                {
+                    /* Move last element to location of the input object and update payload for moved object */
+                    std::swap(container_[payload.index], container_.back());
+                    container_[payload.index].payload() = payload;
+                }
+
+                /* Take ownership of last element in container; it's the input object after the swap */
+                extracted = std::move(container_.back());
+                container_.pop_back();
+            }
+            return extracted;
+        }
+
         void clear()
         {
             container_.clear();
@@ -317,13 +366,31 @@ class UnorderedUniquePtrSet
         using iterator          = typename container_type::iterator;
         using const_iterator    = typename container_type::const_iterator;
 
+        // Owning pointer type of objects that are allocated with make() and inserted later with insert().
+        template <typename TSub>
+        using object_ptr        = std::unique_ptr<TSub>;
+
     public:
 
         // Allocates a new object for this container and returns a non-owning raw pointer to that object.
         template <typename TSub, typename... Args>
         TSub* emplace(Args&&... args)
         {
-            return TakeOwnership(container_, MakeUnique<TSub>(std::forward<Args>(args)...));
+            return insert(make<TSub>(std::forward<Args>(args)...));
+        }
+
+        // Allocates a new object without inserting it into this container. See UnorderedUniquePtrVector::make().
+        template <typename TSub, typename... Args>
+        static object_ptr<TSub> make(Args&&... args)
+        {
+            return MakeUnique<TSub>(std::forward<Args>(args)...);
+        }
+
+        // Inserts an object that was allocated with make() and returns a non-owning raw pointer to that object.
+        template <typename TSub>
+        TSub* insert(object_ptr<TSub>&& object)
+        {
+            return TakeOwnership(container_, std::move(object));
         }
 
         // Releases the memory for the specified object in that list.
@@ -333,6 +400,41 @@ class UnorderedUniquePtrSet
             RemoveFromUniqueSet(container_, object);
         }
 
+        // Removes the specified object from this container without releasing its memory. See UnorderedUniquePtrVector::extract().
+        template <typename TBase>
+        object_ptr<T> extract(TBase* object)
+        {
+            object_ptr<T> extracted;
+            if (object != nullptr)
+            {
+                #if __cplusplus >= 201703L // C++17
+                for (auto it = container_.begin(); it != container_.end(); ++it)
+                {
+                    if (it->get() == object)
+                    {
+                        extracted = std::move(container_.extract(it).value());
+                        break;
+                    }
+                }
+                #else
+                /* Elements of unordered sets are immutable before C++17, so move all elements out and re-insert all others */
+                std::vector<object_ptr<T>> elements;
+                elements.reserve(container_.size());
+                for (const auto& element : container_)
+                    elements.push_back(std::move(const_cast<object_ptr<T>&>(element)));
+                container_.clear();
+                for (auto& element : elements)
+                {
+                    if (element.get() == object)
+                        extracted = std::move(element);
+                    else
+                        container_.insert(std::move(element));
+                }
+                #endif
+            }
+            return extracted;
+        }
+
         void clear()
         {
             container_.clear();
@@ -401,6 +503,102 @@ using HWObjectContainer = UnorderedUniquePtrVector<T>;
 
 #endif
 
+/*
+Wrapper for HWObjectContainer that serializes insertions and removals with a mutex, so render system child objects can be created on multiple threads.
+Objects are constructed before the lock is acquired by emplace(), so only the container update itself is serialized.
+Iterating over this container must not overlap with insertions or removals, e.g. it is only iterated when the render system is destroyed.
+*/
+template <typename T>
+class ConcurrentHWObjectContainer
+{
+
+    public:
+
+        using container_type    = HWObjectContainer<T>;
+        using iterator          = typename container_type::iterator;
+        using const_iterator    = typename container_type::const_iterator;
+
+        template <typename TSub>
+        using object_ptr        = typename container_type::template object_ptr<TSub>;
+
+    public:
+
+        // Allocates a new object outside of the lock and inserts it into this container.
+        template <typename TSub, typename... Args>
+        TSub* emplace(Args&&... args)
+        {
+            return insert(make<TSub>(std::forward<Args>(args)...));
+        }
+
+        // Allocates a new object without inserting it into this container. See UnorderedUniquePtrVector::make().
+        template <typename TSub, typename... Args>
+        static object_ptr<TSub> make(Args&&... args)
+        {
+            return container_type::template make<TSub>(std::forward<Args>(args)...);
+        }
+
+        template <typename TSub>
+        TSub* insert(object_ptr<TSub>&& object)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return container_.insert(std::move(object));
+        }
+
+        template <typename TBase>
+        void erase(TBase* object)
+        {
+            /* Extract object under the lock but destroy it outside, since destructors might be expensive */
+            object_ptr<T> extracted = extract(object);
+        }
+
+        template <typename TBase>
+        object_ptr<T> extract(TBase* object)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return container_.extract(object);
+        }
+
+        void clear()
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            container_.clear();
+        }
+
+        bool empty() const
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            return container_.empty();
+        }
+
+    public:
+
+        const_iterator begin() const
+        {
+            return container_.begin();
+        }
+
+        iterator begin()
+        {
+            return container_.begin();
+        }
+
+        const_iterator end() const
+        {
+            return container_.end();
+        }
+
+        iterator end()
+        {
+            return container_.end();
+        }
+
+    private:
+
+        mutable std::mutex  mutex_;
+        container_type      container_;
+
+};
+
 
 } // /namespace LLGL
 
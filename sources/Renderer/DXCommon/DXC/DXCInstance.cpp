@@ -9,6 +9,7 @@
 #include <LLGL/ShaderFlags.h>
 #include "../../../Platform/Module.h"
 #include <dxcapi.h>
+#include <mutex>
 
 
 namespace LLGL
@@ -22,9 +23,13 @@ struct DXCInstance
 };
 
 static DXCInstance g_DXCInstance;
+static std::mutex  g_DXCInstanceMutex;
 
 HRESULT DXLoadDxcompilerInterface()
 {
+    /* Shaders may be compiled concurrently, see RenderSystem::CreateShaders() */
+    std::lock_guard<std::mutex> guard{ g_DXCInstanceMutex };
+
     /* Early exit if we already loaded the interface */
     if (g_DXCInstance.module)
         return S_OK;
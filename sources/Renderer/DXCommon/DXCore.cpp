@@ -18,6 +18,7 @@
 #include <stdexcept>
 #include <algorithm>
 #include <d3dcompiler.h>
+#include <dxgi1_4.h>
 
 
 #ifndef LLGL_BUILD_STATIC_LIB
@@ -326,7 +327,7 @@ UINT DXGetFxcCompilerFlags(int flags)
     return dxFlags;
 }
 
-static std::vector<VideoAdapterOutputInfo> GetDXGIAdapterOutputInfos(IDXGIAdapter* adapter)
+std::vector<VideoAdapterOutputInfo> DXGetVideoAdapterOutputInfos(IDXGIAdapter* adapter)
 {
     LLGL_ASSERT_PTR(adapter);
 
@@ -379,12 +380,48 @@ static std::vector<VideoAdapterOutputInfo> GetDXGIAdapterOutputInfos(IDXGIAdapte
     return outputInfos;
 }
 
-void DXConvertVideoAdapterInfo(IDXGIAdapter* adapter, const DXGI_ADAPTER_DESC& inDesc, VideoAdapterInfo& outInfo)
+void DXConvertVideoAdapterInfo(const DXGI_ADAPTER_DESC& inDesc, VideoAdapterInfo& outInfo)
 {
+    /* Don't enumerate adapter outputs here, since querying all display modes is expensive and not needed to create a device */
     outInfo.name        = inDesc.Description;
     outInfo.vendor      = GetVendorByID(inDesc.VendorId);
+    outInfo.vendorID    = static_cast<std::uint32_t>(inDesc.VendorId);
+    outInfo.deviceID    = static_cast<std::uint32_t>(inDesc.DeviceId);
     outInfo.videoMemory = static_cast<uint64_t>(inDesc.DedicatedVideoMemory);
-    outInfo.outputs     = GetDXGIAdapterOutputInfos(adapter);
+    outInfo.luid        = DXGetLUIDValue(inDesc.AdapterLuid);
+}
+
+std::uint64_t DXGetLUIDValue(const LUID& luid)
+{
+    return ((static_cast<std::uint64_t>(static_cast<std::uint32_t>(luid.HighPart)) << 32) | static_cast<std::uint64_t>(luid.LowPart));
+}
+
+std::vector<AdapterInfo> DXGetAdapterInfos(IDXGIFactory* factory, std::uint64_t activeLUID)
+{
+    LLGL_ASSERT_PTR(factory);
+
+    std::vector<AdapterInfo> adapters;
+
+    ComPtr<IDXGIAdapter> adapter;
+    for (UINT i = 0; factory->EnumAdapters(i, adapter.ReleaseAndGetAddressOf()) != DXGI_ERROR_NOT_FOUND; ++i)
+    {
+        DXGI_ADAPTER_DESC desc;
+        adapter->GetDesc(&desc);
+
+        AdapterInfo info;
+        {
+            info.name           = desc.Description;
+            info.vendorID       = static_cast<std::uint32_t>(desc.VendorId);
+            info.deviceID       = static_cast<std::uint32_t>(desc.DeviceId);
+            info.videoMemory    = static_cast<std::uint64_t>(desc.DedicatedVideoMemory);
+            info.sharedMemory   = static_cast<std::uint64_t>(desc.SharedSystemMemory);
+            info.luid           = DXGetLUIDValue(desc.AdapterLuid);
+            info.isActive       = (activeLUID != 0 && info.luid == activeLUID);
+        }
+        adapters.push_back(std::move(info));
+    }
+
+    return adapters;
 }
 
 static bool GetDXGIAdapterInfo(IDXGIFactory* factory, long preferredAdapterFlags, VideoAdapterInfo& outInfo, IDXGIAdapter** outPreferredAdatper)
@@ -401,7 +438,7 @@ static bool GetDXGIAdapterInfo(IDXGIFactory* factory, long preferredAdapterFlags
         const bool isPreferredAdapter = MatchPreferredVendor(vendor, preferredAdapterFlags);
         if (preferredAdapterFlags == 0 || isPreferredAdapter)
         {
-            DXConvertVideoAdapterInfo(adapter.Get(), desc, outInfo);
+            DXConvertVideoAdapterInfo(desc, outInfo);
             if (isPreferredAdapter && outPreferredAdatper != nullptr)
                 *outPreferredAdatper = adapter.Detach();
             return true;
@@ -430,6 +467,23 @@ VideoAdapterInfo DXGetVideoAdapterInfo(IDXGIFactory* factory, long preferredAdap
     return VideoAdapterInfo{};
 }
 
+bool DXGetVideoAdapterInfoByIndex(IDXGIFactory* factory, UINT adapterIndex, VideoAdapterInfo& outInfo, IDXGIAdapter** outAdapter)
+{
+    LLGL_ASSERT_PTR(factory);
+    LLGL_ASSERT_PTR(outAdapter);
+
+    ComPtr<IDXGIAdapter> adapter;
+    if (factory->EnumAdapters(adapterIndex, adapter.GetAddressOf()) == DXGI_ERROR_NOT_FOUND)
+        return false;
+
+    DXGI_ADAPTER_DESC desc;
+    adapter->GetDesc(&desc);
+    DXConvertVideoAdapterInfo(desc, outInfo);
+    *outAdapter = adapter.Detach();
+
+    return true;
+}
+
 /*
 Converts the HLSL component mask to component count.
 One and two component shader attributes can be shared with other input/ouput registers as shown in the following example:
@@ -529,6 +583,45 @@ DXGI_FORMAT DXPickDepthStencilFormat(int depthBits, int stencilBits)
     return DXGI_FORMAT_D24_UNORM_S8_UINT;
 }
 
+DXGI_FORMAT DXPickSwapChainColorFormat(ColorSpace colorSpace)
+{
+    switch (colorSpace)
+    {
+        case ColorSpace::HDR10: return DXGI_FORMAT_R10G10B10A2_UNORM;
+        case ColorSpace::ScRGB: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+        default:                return DXGI_FORMAT_R8G8B8A8_UNORM;
+    }
+}
+
+ColorSpace DXSetSwapChainColorSpace(IDXGISwapChain* swapChain, ColorSpace colorSpace)
+{
+    DXGI_COLOR_SPACE_TYPE colorSpaceType = DXGI_COLOR_SPACE_RGB_FULL_G22_NONE_P709;
+    switch (colorSpace)
+    {
+        case ColorSpace::HDR10: colorSpaceType = DXGI_COLOR_SPACE_RGB_FULL_G2084_NONE_P2020;  break;
+        case ColorSpace::ScRGB: colorSpaceType = DXGI_COLOR_SPACE_RGB_FULL_G10_NONE_P709;     break;
+        default:                return ColorSpace::SRGB;
+    }
+
+    /* Color spaces can only be selected with IDXGISwapChain3 (Windows 10) */
+    ComPtr<IDXGISwapChain3> swapChain3;
+    if (FAILED(swapChain->QueryInterface(IID_PPV_ARGS(&swapChain3))))
+        return ColorSpace::SRGB;
+
+    /* Only select the color space if the output can present it; DXGI otherwise presents the buffers in sRGB */
+    UINT colorSpaceSupport = 0;
+    if (FAILED(swapChain3->CheckColorSpaceSupport(colorSpaceType, &colorSpaceSupport)) ||
+        (colorSpaceSupport & DXGI_SWAP_CHAIN_COLOR_SPACE_SUPPORT_FLAG_PRESENT) == 0)
+    {
+        return ColorSpace::SRGB;
+    }
+
+    if (FAILED(swapChain3->SetColorSpace1(colorSpaceType)))
+        return ColorSpace::SRGB;
+
+    return colorSpace;
+}
+
 bool DXGetFullscreenState(IDXGISwapChain* swapChain)
 {
     BOOL fullscreenState = FALSE;
@@ -537,6 +630,70 @@ bool DXGetFullscreenState(IDXGISwapChain* swapChain)
     return (fullscreenState != FALSE);
 }
 
+#ifndef DXGI_PRESENT_ALLOW_TEARING
+#define DXGI_PRESENT_ALLOW_TEARING 0x00000200UL
+#endif
+
+void DXGetPresentParameters(PresentMode presentMode, UINT vsyncInterval, bool tearingAllowed, UINT& outSyncInterval, UINT& outPresentFlags)
+{
+    switch (presentMode)
+    {
+        case PresentMode::Fifo:
+        case PresentMode::FifoRelaxed:
+            /* DXGI has no relaxed v-sync, so late presentations wait for the next vertical blank as well */
+            outSyncInterval = std::max(1u, std::min(vsyncInterval, 4u));
+            outPresentFlags = 0;
+            break;
+
+        case PresentMode::Mailbox:
+            /* Flip-model swap-chains discard queued frames when presenting without v-sync, so the compositor shows the latest frame without tearing */
+            outSyncInterval = 0;
+            outPresentFlags = 0;
+            break;
+
+        case PresentMode::Immediate:
+            /* Allowing tearing also lets displays with variable refresh rates refresh as soon as a frame is presented */
+            outSyncInterval = 0;
+            outPresentFlags = (tearingAllowed ? DXGI_PRESENT_ALLOW_TEARING : 0u);
+            break;
+
+        default:
+            outSyncInterval = vsyncInterval;
+            outPresentFlags = (tearingAllowed && vsyncInterval == 0 ? DXGI_PRESENT_ALLOW_TEARING : 0u);
+            break;
+    }
+}
+
+DWORD DXNanosecsToMillisecs(UINT64 t)
+{
+    if (t == ~0ull)
+        return INFINITE;
+    else
+        return static_cast<DWORD>(std::min<UINT64>((t + 999999) / 1000000, INFINITE - 1));
+}
+
+bool DXGetFrameDisplayTime(IDXGISwapChain* swapChain, UINT64& outPresentCount, UINT64& outTimeInNanosecs)
+{
+    /* Frame statistics are unavailable in windowed mode with the legacy blit model and fail while the output is disjoint */
+    DXGI_FRAME_STATISTICS frameStats = {};
+    if (FAILED(swapChain->GetFrameStatistics(&frameStats)) || frameStats.SyncQPCTime.QuadPart == 0)
+        return false;
+
+    static const UINT64 qpcFrequency = []() -> UINT64
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        return static_cast<UINT64>(frequency.QuadPart);
+    }();
+
+    /* Convert QPC ticks to nanoseconds without overflowing 64 bits */
+    const UINT64 qpcTime = static_cast<UINT64>(frameStats.SyncQPCTime.QuadPart);
+    outPresentCount     = frameStats.PresentCount;
+    outTimeInNanosecs   = (qpcTime / qpcFrequency) * 1000000000ull + (qpcTime % qpcFrequency) * 1000000000ull / qpcFrequency;
+
+    return true;
+}
+
 
 } // /namespace LLGL
 
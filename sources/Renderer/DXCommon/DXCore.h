@@ -11,6 +11,7 @@
 
 #include <LLGL/Utils/ColorRGBA.h>
 #include <LLGL/RenderSystemFlags.h>
+#include <LLGL/SwapChainFlags.h>
 #include "../VideoAdapter.h"
 #include <LLGL/ImageFlags.h>
 #include "ComPtr.h"
@@ -69,21 +70,48 @@ void DXGetDefaultSupportedTextureFormats(Format* outFormats, std::size_t* outNum
 // Returns the compiler flags for the 'ShaderCompileFlags' enumeration values for the DirectX Effects Compiler (FXC).
 UINT DXGetFxcCompilerFlags(int flags);
 
-// Converts the adapter descriptor to video adapter information.
-void DXConvertVideoAdapterInfo(IDXGIAdapter* adapter, const DXGI_ADAPTER_DESC& inDesc, VideoAdapterInfo& outInfo);
+// Converts the adapter descriptor to video adapter information. This does not enumerate the adapter outputs; see DXGetVideoAdapterOutputInfos().
+void DXConvertVideoAdapterInfo(const DXGI_ADAPTER_DESC& inDesc, VideoAdapterInfo& outInfo);
+
+// Returns the 64-bit integer value of the specified LUID as it is reported in AdapterInfo::luid.
+std::uint64_t DXGetLUIDValue(const LUID& luid);
+
+// Returns the information of all adapters as enumerated by the DXGI factory. The adapter with 'activeLUID' is marked as the active one.
+std::vector<AdapterInfo> DXGetAdapterInfos(IDXGIFactory* factory, std::uint64_t activeLUID = 0);
+
+// Returns the outputs of the specified DXGI adapter with all their display modes. This is expensive and only meant to be called on demand.
+std::vector<VideoAdapterOutputInfo> DXGetVideoAdapterOutputInfos(IDXGIAdapter* adapter);
 
 // Returns the video adapter descriptor from the specified DXGI adapter.
 VideoAdapterInfo DXGetVideoAdapterInfo(IDXGIFactory* factory, long preferredAdapterFlags = 0, IDXGIAdapter** outPreferredAdatper = nullptr);
 
+// Returns the video adapter with the specified index as enumerated by the DXGI factory. Returns false if the index is out of range.
+bool DXGetVideoAdapterInfoByIndex(IDXGIFactory* factory, UINT adapterIndex, VideoAdapterInfo& outInfo, IDXGIAdapter** outAdapter);
+
 // Returns the format for the specified signature parameter type (by its component type and mask).
 Format DXGetSignatureParameterType(D3D_REGISTER_COMPONENT_TYPE componentType, BYTE componentMask);
 
 // Returns a suitable DXGI format for the specified depth-stencil mode.
 DXGI_FORMAT DXPickDepthStencilFormat(int depthBits, int stencilBits);
 
+// Returns the DXGI format for swap-chain buffers in the specified color space.
+DXGI_FORMAT DXPickSwapChainColorFormat(ColorSpace colorSpace);
+
+// Sets the color space of the specified flip-model DXGI swap-chain and returns the color space that is in effect, i.e. ColorSpace::SRGB if the requested one is not supported.
+ColorSpace DXSetSwapChainColorSpace(IDXGISwapChain* swapChain, ColorSpace colorSpace);
+
 // Returns true if the specified DXGI swap-chain is in fullscreen mode.
 bool DXGetFullscreenState(IDXGISwapChain* swapChain);
 
+// Returns the sync interval and flags for IDXGISwapChain::Present() for the specified presentation mode. Tearing must only be allowed for windowed flip-model swap-chains.
+void DXGetPresentParameters(PresentMode presentMode, UINT vsyncInterval, bool tearingAllowed, UINT& outSyncInterval, UINT& outPresentFlags);
+
+// Converts the specified amount of nanoseconds into milliseconds (rounded up). A value of ~0 is converted to INFINITE.
+DWORD DXNanosecsToMillisecs(UINT64 t);
+
+// Queries the presentation count and display time stamp (in nanoseconds) of the most recently shown frame. Returns false if no statistics are available.
+bool DXGetFrameDisplayTime(IDXGISwapChain* swapChain, UINT64& outPresentCount, UINT64& outTimeInNanosecs);
+
 
 } // /namespace LLGL
 
@@ -63,17 +63,18 @@ class DXManagedComPtrArray
         void Exchange(std::size_t index, const ComPtr<T>& object)
         {
             LLGL_ASSERT(index < container_.size());
+            if (object == nullptr && container_[index] != nullptr)
+                freeIndices_.push_back(index);
             container_[index] = object;
-            if (object == nullptr)
-                lowerFreeBound_ = std::min(lowerFreeBound_, index);
         }
 
         // Removes the entry at the specified location.
         void Remove(std::size_t index)
         {
             LLGL_ASSERT(index < container_.size());
+            if (container_[index] != nullptr)
+                freeIndices_.push_back(index);
             container_[index] = nullptr;
-            lowerFreeBound_ = std::min(lowerFreeBound_, index);
         }
 
     public:
@@ -117,18 +118,24 @@ class DXManagedComPtrArray
 
     private:
 
-        // Returns the lowest index with a free entry.
+        // Returns the most recently freed index or the end of the container if there is no free entry.
         std::size_t FindFreeIndex()
         {
-            while (lowerFreeBound_ < container_.size() && container_[lowerFreeBound_] != nullptr)
-                ++lowerFreeBound_;
-            return lowerFreeBound_;
+            /* Skip indices that have been refilled via Exchange() since they were freed */
+            while (!freeIndices_.empty())
+            {
+                const std::size_t index = freeIndices_.back();
+                freeIndices_.pop_back();
+                if (container_[index] == nullptr)
+                    return index;
+            }
+            return container_.size();
         }
 
     private:
 
-        std::vector<ComPtr<T>>  container_;
-        std::size_t             lowerFreeBound_ = 0;
+        std::vector<ComPtr<T>>      container_;
+        std::vector<std::size_t>    freeIndices_;
 
 };
 
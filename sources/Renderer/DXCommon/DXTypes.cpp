@@ -148,6 +148,10 @@ DXGI_FORMAT ToDXGIFormat(const Format format)
         case Format::BC4SNorm:          return DXGI_FORMAT_BC4_SNORM;
         case Format::BC5UNorm:          return DXGI_FORMAT_BC5_UNORM;
         case Format::BC5SNorm:          return DXGI_FORMAT_BC5_SNORM;
+        case Format::BC6HUFloat:        return DXGI_FORMAT_BC6H_UF16;
+        case Format::BC6HSFloat:        return DXGI_FORMAT_BC6H_SF16;
+        case Format::BC7UNorm:          return DXGI_FORMAT_BC7_UNORM;
+        case Format::BC7UNorm_sRGB:     return DXGI_FORMAT_BC7_UNORM_SRGB;
 
         /* --- Advanced scalable texture compression (ASTC) formats --- */
         case Format::ASTC4x4:           break;
@@ -183,6 +187,30 @@ DXGI_FORMAT ToDXGIFormat(const Format format)
         case Format::ETC1UNorm:         break;
         case Format::ETC2UNorm:         break;
         case Format::ETC2UNorm_sRGB:    break;
+        case Format::ETC2A1UNorm:       break;
+        case Format::ETC2A1UNorm_sRGB:  break;
+        case Format::ETC2A8UNorm:       break;
+        case Format::ETC2A8UNorm_sRGB:  break;
+        case Format::EACR11UNorm:       break;
+        case Format::EACR11SNorm:       break;
+        case Format::EACRG11UNorm:      break;
+        case Format::EACRG11SNorm:      break;
+
+        /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+        case Format::ASTC4x4Float:      break;
+        case Format::ASTC5x4Float:      break;
+        case Format::ASTC5x5Float:      break;
+        case Format::ASTC6x5Float:      break;
+        case Format::ASTC6x6Float:      break;
+        case Format::ASTC8x5Float:      break;
+        case Format::ASTC8x6Float:      break;
+        case Format::ASTC8x8Float:      break;
+        case Format::ASTC10x5Float:     break;
+        case Format::ASTC10x6Float:     break;
+        case Format::ASTC10x8Float:     break;
+        case Format::ASTC10x10Float:    break;
+        case Format::ASTC12x10Float:    break;
+        case Format::ASTC12x12Float:    break;
     }
     LLGL_TRAP_DX_MAP(Format, format, DXGI_FORMAT);
 }
@@ -327,6 +355,10 @@ Format Unmap(const DXGI_FORMAT format)
         case DXGI_FORMAT_BC4_SNORM:                 return Format::BC4SNorm;
         case DXGI_FORMAT_BC5_UNORM:                 return Format::BC5UNorm;
         case DXGI_FORMAT_BC5_SNORM:                 return Format::BC5SNorm;
+        case DXGI_FORMAT_BC6H_UF16:                 return Format::BC6HUFloat;
+        case DXGI_FORMAT_BC6H_SF16:                 return Format::BC6HSFloat;
+        case DXGI_FORMAT_BC7_UNORM:                 return Format::BC7UNorm;
+        case DXGI_FORMAT_BC7_UNORM_SRGB:            return Format::BC7UNorm_sRGB;
 
         default:                                    return Format::Undefined;
     }
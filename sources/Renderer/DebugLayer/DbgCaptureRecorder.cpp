@@ -0,0 +1,814 @@
+/*
+ * DbgCaptureRecorder.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgCaptureRecorder.h"
+#include "DbgSwapChain.h"
+#include "DbgCommandBuffer.h"
+#include "Buffer/DbgBuffer.h"
+#include "Buffer/DbgBufferArray.h"
+#include "RenderState/DbgPipelineLayout.h"
+#include "RenderState/DbgPipelineState.h"
+#include "RenderState/DbgQueryHeap.h"
+#include "RenderState/DbgResourceHeap.h"
+#include "RenderState/DbgRenderPass.h"
+#include "Shader/DbgShader.h"
+#include "Texture/DbgTexture.h"
+#include "Texture/DbgRenderTarget.h"
+#include "../../Core/StringUtils.h"
+#include <LLGL/RenderSystem.h>
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/Log.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <stdio.h>
+
+
+namespace LLGL
+{
+
+
+/*
+~~~~~~ INFO ~~~~~~
+The parameters of each CaptureOpcode::CreateObject operation are documented with the respective Record* function.
+Object references are always written as CaptureObjectID and all flags that are declared as 'long' are written as 32-bit integers,
+since their size differs between platforms.
+*/
+
+static void WriteFlags(CaptureStreamWriter& writer, long flags)
+{
+    writer.Write(static_cast<std::uint32_t>(flags));
+}
+
+DbgCaptureRecorder::DbgCaptureRecorder(RenderSystem& renderSystemInstance, RenderingDebugger* debugger) :
+    renderSystem_ { renderSystemInstance },
+    debugger_     { debugger             }
+{
+}
+
+CaptureObjectID DbgCaptureRecorder::GetObjectID(const void* object) const
+{
+    if (object != nullptr)
+    {
+        auto it = objectIDs_.find(object);
+        if (it != objectIDs_.end())
+            return it->second;
+    }
+    return 0;
+}
+
+/* ----- Objects ----- */
+
+// Parameters: Extent2D resolution, i32 colorBits, i32 depthBits, i32 stencilBits, u32 samples, u32 swapBuffers, u32 maxFramesInFlight
+void DbgCaptureRecorder::RecordSwapChain(const DbgSwapChain& swapChainDbg, const SwapChainDescriptor& swapChainDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::SwapChain, &swapChainDbg);
+    {
+        record.params.Write(swapChainDesc.resolution);
+        record.params.Write(static_cast<std::int32_t>(swapChainDesc.colorBits));
+        record.params.Write(static_cast<std::int32_t>(swapChainDesc.depthBits));
+        record.params.Write(static_cast<std::int32_t>(swapChainDesc.stencilBits));
+        record.params.Write(swapChainDesc.samples);
+        record.params.Write(swapChainDesc.swapBuffers);
+        record.params.Write(swapChainDesc.maxFramesInFlight);
+    }
+    const CaptureObjectID id = GetObjectID(&swapChainDbg);
+    FlushObject(id);
+    AllocOwnedRenderPass(objects_[id], id, swapChainDbg.GetRenderPass());
+}
+
+// Parameters: u32 flags, u32 numNativeBuffers, u64 minStagingPoolSize, ID renderPass, CommandQueueType queueType
+void DbgCaptureRecorder::RecordCommandBuffer(const DbgCommandBuffer& commandBufferDbg, const CommandBufferDescriptor& commandBufferDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::CommandBuffer, &commandBufferDbg);
+    {
+        WriteFlags(record.params, commandBufferDesc.flags);
+        record.params.Write(commandBufferDesc.numNativeBuffers);
+        record.params.Write(commandBufferDesc.minStagingPoolSize);
+        record.params.Write(GetObjectID(commandBufferDesc.renderPass));
+        record.params.Write(commandBufferDesc.queueType);
+    }
+    FlushObject(GetObjectID(&commandBufferDbg));
+}
+
+// Parameters: string debugName, u64 size, u32 stride, Format format, u32 bindFlags, u32 cpuAccessFlags, u32 miscFlags, VertexAttributes vertexAttribs
+void DbgCaptureRecorder::RecordBuffer(const DbgBuffer& bufferDbg, const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::Buffer, &bufferDbg);
+    {
+        record.params.WriteString(bufferDesc.debugName);
+        record.params.Write(bufferDesc.size);
+        record.params.Write(bufferDesc.stride);
+        record.params.Write(bufferDesc.format);
+        WriteFlags(record.params, bufferDesc.bindFlags);
+        WriteFlags(record.params, bufferDesc.cpuAccessFlags);
+        WriteFlags(record.params, bufferDesc.miscFlags);
+        WriteVertexAttributes(record.params, bufferDesc.vertexAttribs);
+    }
+    FlushObject(GetObjectID(&bufferDbg));
+
+    /* Buffers that are created during the capture are initialized with their initial data, all others are read back when the capture begins */
+    if (isCapturing_ && initialData != nullptr)
+        RecordWriteBuffer(bufferDbg, 0, initialData, bufferDesc.size);
+}
+
+// Parameters: u32 numBuffers, ID[numBuffers] buffers
+void DbgCaptureRecorder::RecordBufferArray(const DbgBufferArray& bufferArrayDbg, std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::BufferArray, &bufferArrayDbg);
+    {
+        record.params.Write(numBuffers);
+        for_range(i, numBuffers)
+            record.params.Write(GetObjectID(bufferArray[i]));
+    }
+    FlushObject(GetObjectID(&bufferArrayDbg));
+}
+
+// Parameters: string debugName, TextureType type, u32 bindFlags, u32 cpuAccessFlags, u32 miscFlags, Format format, Extent3D extent,
+//             u32 arrayLayers, u32 mipLevels, u32 samples, ClearValue clearValue
+void DbgCaptureRecorder::RecordTexture(const DbgTexture& textureDbg, const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::Texture, &textureDbg);
+    {
+        record.params.WriteString(textureDesc.debugName);
+        record.params.Write(textureDesc.type);
+        WriteFlags(record.params, textureDesc.bindFlags);
+        WriteFlags(record.params, textureDesc.cpuAccessFlags);
+        WriteFlags(record.params, textureDesc.miscFlags);
+        record.params.Write(textureDesc.format);
+        record.params.Write(textureDesc.extent);
+        record.params.Write(textureDesc.arrayLayers);
+        record.params.Write(textureDesc.mipLevels);
+        record.params.Write(textureDesc.samples);
+        record.params.Write(textureDesc.clearValue);
+    }
+    FlushObject(GetObjectID(&textureDbg));
+
+    /* Textures that are created during the capture are initialized with their initial image, all others are read back when the capture begins */
+    if (isCapturing_ && initialImage != nullptr)
+    {
+        TextureRegion region;
+        {
+            region.subresource.numArrayLayers   = textureDesc.arrayLayers;
+            region.extent                       = GetMipExtent(textureDesc.type, textureDesc.extent, 0);
+        }
+        RecordWriteTexture(textureDbg, region, *initialImage);
+    }
+}
+
+// Parameters: SamplerDescriptor samplerDesc
+void DbgCaptureRecorder::RecordSampler(const Sampler& sampler, const SamplerDescriptor& samplerDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::Sampler, &sampler);
+    WriteSamplerDesc(record.params, samplerDesc);
+    FlushObject(GetObjectID(&sampler));
+}
+
+// Parameters: string debugName, AttachmentFormatDescriptor[LLGL_MAX_NUM_COLOR_ATTACHMENTS] colorAttachments,
+//             AttachmentFormatDescriptor depthAttachment, AttachmentFormatDescriptor stencilAttachment, u32 samples
+void DbgCaptureRecorder::RecordRenderPass(const DbgRenderPass& renderPassDbg, const RenderPassDescriptor& renderPassDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::RenderPass, &renderPassDbg);
+    {
+        record.params.WriteString(renderPassDesc.debugName);
+        record.params.WriteArray(renderPassDesc.colorAttachments, LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+        record.params.Write(renderPassDesc.depthAttachment);
+        record.params.Write(renderPassDesc.stencilAttachment);
+        record.params.Write(renderPassDesc.samples);
+    }
+    FlushObject(GetObjectID(&renderPassDbg));
+}
+
+// Parameters: string debugName, ID renderPass, Extent2D resolution, u32 samples,
+//             { Format format, ID texture, u32 mipLevel, u32 arrayLayer }[LLGL_MAX_NUM_COLOR_ATTACHMENTS * 2 + 2] color, resolve, depth-stencil, and shading-rate attachments
+void DbgCaptureRecorder::RecordRenderTarget(const DbgRenderTarget& renderTargetDbg, const RenderTargetDescriptor& renderTargetDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::RenderTarget, &renderTargetDbg);
+    {
+        record.params.WriteString(renderTargetDesc.debugName);
+        record.params.Write(GetObjectID(renderTargetDesc.renderPass));
+        record.params.Write(renderTargetDesc.resolution);
+        record.params.Write(renderTargetDesc.samples);
+
+        auto WriteAttachment = [this, &record](const AttachmentDescriptor& attachmentDesc)
+        {
+            record.params.Write(attachmentDesc.format);
+            record.params.Write(GetObjectID(attachmentDesc.texture));
+            record.params.Write(attachmentDesc.mipLevel);
+            record.params.Write(attachmentDesc.arrayLayer);
+        };
+
+        for (const AttachmentDescriptor& attachmentDesc : renderTargetDesc.colorAttachments)
+            WriteAttachment(attachmentDesc);
+        for (const AttachmentDescriptor& attachmentDesc : renderTargetDesc.resolveAttachments)
+            WriteAttachment(attachmentDesc);
+        WriteAttachment(renderTargetDesc.depthStencilAttachment);
+        WriteAttachment(renderTargetDesc.shadingRateAttachment);
+    }
+    const CaptureObjectID id = GetObjectID(&renderTargetDbg);
+    FlushObject(id);
+    AllocOwnedRenderPass(objects_[id], id, renderTargetDbg.GetRenderPass());
+}
+
+// Parameters: string debugName, ShaderType type, ShaderSourceType sourceType, u64 sourceSize, byte[sourceSize + 1] source (null-terminated),
+//             string entryPoint, string profile, u32 numDefines, { string name, string definition }[numDefines], u32 flags,
+//             VertexAttributes inputAttribs, VertexAttributes outputAttribs,
+//             u32 numFragmentAttribs, { string name, Format format, u32 location, SystemValue systemValue }[numFragmentAttribs], Extent3D workGroupSize
+void DbgCaptureRecorder::RecordShader(const DbgShader& shaderDbg, const ShaderDescriptor& shaderDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::Shader, &shaderDbg);
+    {
+        record.params.WriteString(shaderDesc.debugName);
+        record.params.Write(shaderDesc.type);
+
+        /* Store content of shader files, since the files might not be available where the capture is replayed */
+        std::vector<char> fileContent;
+        const char* source = shaderDesc.source;
+        std::size_t sourceSize = shaderDesc.sourceSize;
+        ShaderSourceType sourceType = shaderDesc.sourceType;
+
+        if (sourceType == ShaderSourceType::CodeFile || sourceType == ShaderSourceType::BinaryFile)
+        {
+            fileContent = ReadFileBuffer(shaderDesc.source);
+            source      = fileContent.data();
+            sourceSize  = fileContent.size();
+            sourceType  = (sourceType == ShaderSourceType::CodeFile ? ShaderSourceType::CodeString : ShaderSourceType::BinaryBuffer);
+        }
+        else if (sourceType == ShaderSourceType::CodeString && sourceSize == 0 && source != nullptr)
+            sourceSize = std::strlen(source);
+
+        record.params.Write(sourceType);
+        record.params.Write(static_cast<std::uint64_t>(sourceSize));
+        record.params.WriteBytes(source, sourceSize);
+        record.params.Write('\0');
+
+        record.params.WriteString(shaderDesc.entryPoint);
+        record.params.WriteString(shaderDesc.profile);
+
+        std::uint32_t numDefines = 0;
+        if (shaderDesc.defines != nullptr)
+        {
+            while (shaderDesc.defines[numDefines].name != nullptr)
+                ++numDefines;
+        }
+        record.params.Write(numDefines);
+        for_range(i, numDefines)
+        {
+            record.params.WriteString(shaderDesc.defines[i].name);
+            record.params.WriteString(shaderDesc.defines[i].definition);
+        }
+
+        WriteFlags(record.params, shaderDesc.flags);
+        WriteVertexAttributes(record.params, shaderDesc.vertex.inputAttribs);
+        WriteVertexAttributes(record.params, shaderDesc.vertex.outputAttribs);
+
+        record.params.Write(static_cast<std::uint32_t>(shaderDesc.fragment.outputAttribs.size()));
+        for (const FragmentAttribute& attrib : shaderDesc.fragment.outputAttribs)
+        {
+            record.params.WriteString(attrib.name.c_str());
+            record.params.Write(attrib.format);
+            record.params.Write(attrib.location);
+            record.params.Write(attrib.systemValue);
+        }
+
+        record.params.Write(shaderDesc.compute.workGroupSize);
+    }
+    FlushObject(GetObjectID(&shaderDbg));
+}
+
+// Parameters: string debugName, BindingDescriptors heapBindings, BindingDescriptors bindings,
+//             u32 numStaticSamplers, { string name, u32 stageFlags, BindingSlot slot, SamplerDescriptor sampler }[numStaticSamplers],
+//             u32 numUniforms, { string name, UniformType type, u32 arraySize }[numUniforms],
+//             u32 numCombinedTextureSamplers, { string name, string textureName, string samplerName, BindingSlot slot }[numCombinedTextureSamplers],
+//             u32 barrierFlags, u32 flags
+void DbgCaptureRecorder::RecordPipelineLayout(const DbgPipelineLayout& pipelineLayoutDbg, const PipelineLayoutDescriptor& pipelineLayoutDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::PipelineLayout, &pipelineLayoutDbg);
+    {
+        record.params.WriteString(pipelineLayoutDesc.debugName);
+        WriteBindingDescs(record.params, pipelineLayoutDesc.heapBindings);
+        WriteBindingDescs(record.params, pipelineLayoutDesc.bindings);
+
+        record.params.Write(static_cast<std::uint32_t>(pipelineLayoutDesc.staticSamplers.size()));
+        for (const StaticSamplerDescriptor& staticSamplerDesc : pipelineLayoutDesc.staticSamplers)
+        {
+            record.params.WriteString(staticSamplerDesc.name.c_str());
+            WriteFlags(record.params, staticSamplerDesc.stageFlags);
+            record.params.Write(staticSamplerDesc.slot);
+            WriteSamplerDesc(record.params, staticSamplerDesc.sampler);
+        }
+
+        record.params.Write(static_cast<std::uint32_t>(pipelineLayoutDesc.uniforms.size()));
+        for (const UniformDescriptor& uniformDesc : pipelineLayoutDesc.uniforms)
+        {
+            record.params.WriteString(uniformDesc.name.c_str());
+            record.params.Write(uniformDesc.type);
+            record.params.Write(uniformDesc.arraySize);
+        }
+
+        record.params.Write(static_cast<std::uint32_t>(pipelineLayoutDesc.combinedTextureSamplers.size()));
+        for (const CombinedTextureSamplerDescriptor& samplerDesc : pipelineLayoutDesc.combinedTextureSamplers)
+        {
+            record.params.WriteString(samplerDesc.name.c_str());
+            record.params.WriteString(samplerDesc.textureName.c_str());
+            record.params.WriteString(samplerDesc.samplerName.c_str());
+            record.params.Write(samplerDesc.slot);
+        }
+
+        WriteFlags(record.params, pipelineLayoutDesc.barrierFlags);
+        WriteFlags(record.params, pipelineLayoutDesc.flags);
+    }
+    FlushObject(GetObjectID(&pipelineLayoutDbg));
+}
+
+// Parameters: string debugName, u32 flags, ID pipelineLayout, ID renderPass, ID[5] vertex, tess-control, tess-evaluation, geometry, and fragment shaders,
+//             Format indexFormat, PrimitiveTopology primitiveTopology, u32 numViewports, Viewport[numViewports], u32 numScissors, Scissor[numScissors],
+//             DepthDescriptor depth, StencilDescriptor stencil, RasterizerDescriptor rasterizer, BlendDescriptor blend, TessellationDescriptor tessellation
+void DbgCaptureRecorder::RecordPipelineState(const DbgPipelineState& pipelineStateDbg, const GraphicsPipelineDescriptor& pipelineStateDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::GraphicsPipeline, &pipelineStateDbg);
+    {
+        record.params.WriteString(pipelineStateDesc.debugName);
+        WriteFlags(record.params, pipelineStateDesc.flags);
+        record.params.Write(GetObjectID(pipelineStateDesc.pipelineLayout));
+        record.params.Write(GetObjectID(pipelineStateDesc.renderPass));
+        record.params.Write(GetObjectID(pipelineStateDesc.vertexShader));
+        record.params.Write(GetObjectID(pipelineStateDesc.tessControlShader));
+        record.params.Write(GetObjectID(pipelineStateDesc.tessEvaluationShader));
+        record.params.Write(GetObjectID(pipelineStateDesc.geometryShader));
+        record.params.Write(GetObjectID(pipelineStateDesc.taskShader));
+        record.params.Write(GetObjectID(pipelineStateDesc.meshShader));
+        record.params.Write(GetObjectID(pipelineStateDesc.tileShader));
+        record.params.Write(GetObjectID(pipelineStateDesc.fragmentShader));
+        record.params.Write(pipelineStateDesc.indexFormat);
+        record.params.Write(pipelineStateDesc.primitiveTopology);
+        record.params.Write(static_cast<std::uint32_t>(pipelineStateDesc.viewports.size()));
+        record.params.WriteArray(pipelineStateDesc.viewports.data(), pipelineStateDesc.viewports.size());
+        record.params.Write(static_cast<std::uint32_t>(pipelineStateDesc.scissors.size()));
+        record.params.WriteArray(pipelineStateDesc.scissors.data(), pipelineStateDesc.scissors.size());
+        record.params.Write(pipelineStateDesc.depth);
+        record.params.Write(pipelineStateDesc.stencil);
+        record.params.Write(pipelineStateDesc.rasterizer);
+        record.params.Write(pipelineStateDesc.blend);
+        record.params.Write(pipelineStateDesc.tessellation);
+    }
+    FlushObject(GetObjectID(&pipelineStateDbg));
+}
+
+// Parameters: string debugName, u32 flags, ID pipelineLayout, ID computeShader
+void DbgCaptureRecorder::RecordPipelineState(const DbgPipelineState& pipelineStateDbg, const ComputePipelineDescriptor& pipelineStateDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::ComputePipeline, &pipelineStateDbg);
+    {
+        record.params.WriteString(pipelineStateDesc.debugName);
+        WriteFlags(record.params, pipelineStateDesc.flags);
+        record.params.Write(GetObjectID(pipelineStateDesc.pipelineLayout));
+        record.params.Write(GetObjectID(pipelineStateDesc.computeShader));
+    }
+    FlushObject(GetObjectID(&pipelineStateDbg));
+}
+
+// Parameters: string debugName, ID pipelineLayout, u32 numResourceViews
+// The resource views are written with separate CaptureOpcode::WriteResourceHeap operations, since they can be updated after creation.
+void DbgCaptureRecorder::RecordResourceHeap(
+    const DbgResourceHeap&                      resourceHeapDbg,
+    const ResourceHeapDescriptor&               resourceHeapDesc,
+    const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
+{
+    const std::uint32_t numResourceViews =
+    (
+        resourceHeapDesc.numResourceViews > 0
+            ? resourceHeapDesc.numResourceViews
+            : static_cast<std::uint32_t>(initialResourceViews.size())
+    );
+
+    ObjectRecord& record = AllocObject(CaptureObjectType::ResourceHeap, &resourceHeapDbg);
+    {
+        record.params.WriteString(resourceHeapDesc.debugName);
+        record.params.Write(GetObjectID(resourceHeapDesc.pipelineLayout));
+        record.params.Write(numResourceViews);
+    }
+    const CaptureObjectID id = GetObjectID(&resourceHeapDbg);
+    FlushObject(id);
+
+    /* Keep track of the current resource views to write them when the capture begins */
+    std::vector<ResourceViewDescriptor>& views = resourceHeapViews_[id];
+    views.assign(initialResourceViews.begin(), initialResourceViews.end());
+    views.resize(numResourceViews);
+
+    if (isCapturing_ && !initialResourceViews.empty())
+        WriteResourceHeapViews(id, 0, initialResourceViews.data(), static_cast<std::uint32_t>(initialResourceViews.size()));
+}
+
+// Parameters: string debugName, QueryType type, u32 numQueries, bool renderCondition
+void DbgCaptureRecorder::RecordQueryHeap(const DbgQueryHeap& queryHeapDbg, const QueryHeapDescriptor& queryHeapDesc)
+{
+    ObjectRecord& record = AllocObject(CaptureObjectType::QueryHeap, &queryHeapDbg);
+    {
+        record.params.WriteString(queryHeapDesc.debugName);
+        record.params.Write(queryHeapDesc.type);
+        record.params.Write(queryHeapDesc.numQueries);
+        record.params.Write(queryHeapDesc.renderCondition);
+    }
+    FlushObject(GetObjectID(&queryHeapDbg));
+}
+
+void DbgCaptureRecorder::RecordRelease(const void* object)
+{
+    auto it = objectIDs_.find(object);
+    if (it == objectIDs_.end())
+        return;
+
+    const CaptureObjectID id = it->second;
+    objectIDs_.erase(it);
+    mappedBuffers_.erase(object);
+    resourceHeapViews_.erase(id);
+
+    auto itRecord = objects_.find(id);
+    if (itRecord != objects_.end())
+    {
+        /* Release render pass that is owned by this object as well */
+        if (const void* ownedRenderPass = itRecord->second.ownedRenderPass)
+            RecordRelease(ownedRenderPass);
+        objects_.erase(itRecord);
+    }
+
+    if (isCapturing_)
+    {
+        stream_.Write(CaptureOpcode::ReleaseObject);
+        stream_.Write(id);
+    }
+}
+
+/* ----- Resource updates ----- */
+
+void DbgCaptureRecorder::RecordWriteBuffer(const DbgBuffer& bufferDbg, std::uint64_t offset, const void* data, std::uint64_t dataSize)
+{
+    if (isCapturing_ && data != nullptr && dataSize > 0)
+    {
+        stream_.Write(CaptureOpcode::WriteBuffer);
+        stream_.Write(GetObjectID(&bufferDbg));
+        stream_.Write(offset);
+        stream_.Write(dataSize);
+        stream_.WriteBytes(data, static_cast<std::size_t>(dataSize));
+    }
+}
+
+void DbgCaptureRecorder::RecordMapBuffer(const DbgBuffer& bufferDbg, const CPUAccess access, std::uint64_t offset, std::uint64_t length, const void* data)
+{
+    /* Keep track of all mappings with write access, since a buffer might be unmapped after the capture has begun */
+    if (access != CPUAccess::ReadOnly && data != nullptr)
+    {
+        MappedBuffer& mapping = mappedBuffers_[&bufferDbg];
+        {
+            mapping.data    = data;
+            mapping.offset  = offset;
+            mapping.length  = length;
+        }
+    }
+}
+
+void DbgCaptureRecorder::RecordUnmapBuffer(const DbgBuffer& bufferDbg)
+{
+    auto it = mappedBuffers_.find(&bufferDbg);
+    if (it != mappedBuffers_.end())
+    {
+        const MappedBuffer& mapping = it->second;
+        RecordWriteBuffer(bufferDbg, mapping.offset, mapping.data, mapping.length);
+        mappedBuffers_.erase(it);
+    }
+}
+
+void DbgCaptureRecorder::RecordWriteTexture(const DbgTexture& textureDbg, const TextureRegion& textureRegion, const ImageView& srcImageView)
+{
+    if (isCapturing_ && srcImageView.data != nullptr && srcImageView.dataSize > 0)
+    {
+        stream_.Write(CaptureOpcode::WriteTexture);
+        stream_.Write(GetObjectID(&textureDbg));
+        stream_.Write(textureRegion);
+        stream_.Write(srcImageView.format);
+        stream_.Write(srcImageView.dataType);
+        stream_.Write(srcImageView.rowStride);
+        stream_.Write(srcImageView.layerStride);
+        stream_.Write(static_cast<std::uint64_t>(srcImageView.dataSize));
+        stream_.WriteBytes(srcImageView.data, srcImageView.dataSize);
+    }
+}
+
+void DbgCaptureRecorder::RecordWriteResourceHeap(const DbgResourceHeap& resourceHeapDbg, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    const CaptureObjectID id = GetObjectID(&resourceHeapDbg);
+
+    auto it = resourceHeapViews_.find(id);
+    if (it == resourceHeapViews_.end())
+        return;
+
+    /* Update copy of resource views; views beyond the heap size have no effect */
+    std::vector<ResourceViewDescriptor>& views = it->second;
+    const std::uint32_t numViews = static_cast<std::uint32_t>(views.size());
+    if (firstDescriptor >= numViews)
+        return;
+
+    const std::uint32_t numResourceViews = std::min(static_cast<std::uint32_t>(resourceViews.size()), numViews - firstDescriptor);
+    std::copy(resourceViews.begin(), resourceViews.begin() + numResourceViews, views.begin() + firstDescriptor);
+
+    if (isCapturing_)
+        WriteResourceHeapViews(id, firstDescriptor, resourceViews.data(), numResourceViews);
+}
+
+/* ----- Submissions ----- */
+
+void DbgCaptureRecorder::RecordSubmit(const DbgCommandBuffer& commandBufferDbg)
+{
+    if (!isCapturing_)
+        return;
+
+    if (const CaptureStreamWriter* commands = commandBufferDbg.GetCaptureStream())
+    {
+        stream_.Write(CaptureOpcode::Submit);
+        stream_.Write(GetObjectID(&commandBufferDbg));
+        stream_.WriteStream(*commands);
+    }
+    else
+        WarnOnce(warnedEncoding_, "command buffer that was encoded before the capture began is not captured");
+}
+
+void DbgCaptureRecorder::NextFrame()
+{
+    if (debugger_ == nullptr)
+        return;
+
+    if (isCapturing_)
+    {
+        /* End capture after the scheduled number of frames or if it has been ended by the client programmer */
+        ++numFramesRecorded_;
+        if (numFramesRecorded_ < numFrames_ && debugger_->GetCaptureFilename() != nullptr)
+            stream_.Write(CaptureOpcode::BeginFrame);
+        else
+            EndCapture();
+    }
+    else if (const char* filename = debugger_->GetCaptureFilename())
+        BeginCapture(filename, debugger_->GetCaptureFrames());
+}
+
+/*
+ * ======= Private: =======
+ */
+
+DbgCaptureRecorder::ObjectRecord& DbgCaptureRecorder::AllocObject(CaptureObjectType type, const void* object)
+{
+    const CaptureObjectID id = nextObjectID_++;
+    objectIDs_[object] = id;
+
+    ObjectRecord& record = objects_[id];
+    {
+        record.type     = type;
+        record.object   = object;
+    }
+    return record;
+}
+
+// Parameters: ID owner
+void DbgCaptureRecorder::AllocOwnedRenderPass(ObjectRecord& ownerRecord, CaptureObjectID ownerID, const RenderPass* renderPass)
+{
+    if (renderPass != nullptr)
+    {
+        ownerRecord.ownedRenderPass = renderPass;
+        ObjectRecord& record = AllocObject(CaptureObjectType::OwnedRenderPass, renderPass);
+        record.params.Write(ownerID);
+        FlushObject(GetObjectID(renderPass));
+    }
+}
+
+void DbgCaptureRecorder::FlushObject(CaptureObjectID id)
+{
+    if (isCapturing_)
+        WriteCreateObject(id, objects_[id]);
+}
+
+void DbgCaptureRecorder::WriteCreateObject(CaptureObjectID id, const ObjectRecord& record)
+{
+    stream_.Write(CaptureOpcode::CreateObject);
+    stream_.Write(record.type);
+    stream_.Write(id);
+    stream_.WriteStream(record.params);
+}
+
+void DbgCaptureRecorder::WriteResourceHeapViews(
+    CaptureObjectID                 id,
+    std::uint32_t                   firstDescriptor,
+    const ResourceViewDescriptor*   resourceViews,
+    std::uint32_t                   numResourceViews)
+{
+    stream_.Write(CaptureOpcode::WriteResourceHeap);
+    stream_.Write(id);
+    stream_.Write(firstDescriptor);
+    stream_.Write(numResourceViews);
+    for_range(i, numResourceViews)
+    {
+        stream_.Write(GetObjectID(resourceViews[i].resource));
+        stream_.Write(resourceViews[i].textureView);
+        stream_.Write(resourceViews[i].bufferView);
+        stream_.Write(resourceViews[i].initialCount);
+    }
+}
+
+void DbgCaptureRecorder::WriteBufferContent(CaptureObjectID id, const DbgBuffer& bufferDbg)
+{
+    const std::uint64_t size = bufferDbg.desc.size;
+    if (size == 0 || !bufferDbg.initialized)
+        return;
+
+    stream_.Write(CaptureOpcode::WriteBuffer);
+    stream_.Write(id);
+    stream_.Write(std::uint64_t(0));
+    stream_.Write(size);
+
+    std::vector<char> content(static_cast<std::size_t>(size));
+    renderSystem_.ReadBuffer(bufferDbg.instance, 0, content.data(), size);
+    stream_.WriteBytes(content.data(), content.size());
+}
+
+void DbgCaptureRecorder::WriteTextureContent(CaptureObjectID id, const DbgTexture& textureDbg)
+{
+    const TextureDescriptor& textureDesc = textureDbg.desc;
+
+    /* Only read back uncompressed color textures; all other textures are expected to be written by the GPU within the captured frames */
+    if (!IsColorFormat(textureDesc.format) || IsCompressedFormat(textureDesc.format) || IsMultiSampleTexture(textureDesc.type))
+        return;
+
+    const FormatAttributes& formatAttribs = GetFormatAttribs(textureDesc.format);
+    const std::uint32_t numMipLevels = NumMipLevels(textureDesc);
+
+    for_range(mipLevel, numMipLevels)
+    {
+        TextureRegion region;
+        {
+            region.subresource.numArrayLayers   = textureDesc.arrayLayers;
+            region.subresource.baseMipLevel     = mipLevel;
+            region.extent                       = GetMipExtent(textureDesc.type, textureDesc.extent, mipLevel);
+        }
+        const std::size_t dataSize = GetMemoryFootprint(formatAttribs.format, formatAttribs.dataType, NumMipTexels(textureDesc, mipLevel));
+        if (dataSize == 0)
+            continue;
+
+        std::vector<char> content(dataSize);
+        const MutableImageView dstImageView{ formatAttribs.format, formatAttribs.dataType, content.data(), content.size() };
+        renderSystem_.ReadTexture(textureDbg.instance, region, dstImageView);
+
+        stream_.Write(CaptureOpcode::WriteTexture);
+        stream_.Write(id);
+        stream_.Write(region);
+        stream_.Write(formatAttribs.format);
+        stream_.Write(formatAttribs.dataType);
+        stream_.Write(std::uint32_t(0));
+        stream_.Write(std::uint32_t(0));
+        stream_.Write(static_cast<std::uint64_t>(content.size()));
+        stream_.WriteBytes(content.data(), content.size());
+    }
+}
+
+// Parameters: u32 numAttribs, { string name, Format format, u32 location, u32 semanticIndex, SystemValue systemValue,
+//             u32 slot, u32 offset, u32 stride, u32 instanceDivisor }[numAttribs]
+void DbgCaptureRecorder::WriteVertexAttributes(CaptureStreamWriter& writer, const ArrayView<VertexAttribute>& attributes)
+{
+    writer.Write(static_cast<std::uint32_t>(attributes.size()));
+    for (const VertexAttribute& attrib : attributes)
+    {
+        writer.WriteString(attrib.name.c_str());
+        writer.Write(attrib.format);
+        writer.Write(attrib.location);
+        writer.Write(attrib.semanticIndex);
+        writer.Write(attrib.systemValue);
+        writer.Write(attrib.slot);
+        writer.Write(attrib.offset);
+        writer.Write(attrib.stride);
+        writer.Write(attrib.instanceDivisor);
+    }
+}
+
+// Parameters: SamplerAddressMode[3] addressModeUVW, SamplerFilter[3] min, mag, and MIP-map filters, bool mipMapEnabled,
+//             float mipMapLODBias, float minLOD, float maxLOD, u32 maxAnisotropy, bool compareEnabled, CompareOp compareOp, float[4] borderColor
+void DbgCaptureRecorder::WriteSamplerDesc(CaptureStreamWriter& writer, const SamplerDescriptor& samplerDesc)
+{
+    writer.Write(samplerDesc.addressModeU);
+    writer.Write(samplerDesc.addressModeV);
+    writer.Write(samplerDesc.addressModeW);
+    writer.Write(samplerDesc.minFilter);
+    writer.Write(samplerDesc.magFilter);
+    writer.Write(samplerDesc.mipMapFilter);
+    writer.Write(samplerDesc.mipMapEnabled);
+    writer.Write(samplerDesc.mipMapLODBias);
+    writer.Write(samplerDesc.minLOD);
+    writer.Write(samplerDesc.maxLOD);
+    writer.Write(samplerDesc.maxAnisotropy);
+    writer.Write(samplerDesc.compareEnabled);
+    writer.Write(samplerDesc.compareOp);
+    writer.WriteArray(samplerDesc.borderColor, 4);
+}
+
+// Parameters: u32 numBindings, { string name, ResourceType type, u32 bindFlags, u32 stageFlags, BindingSlot slot, u32 arraySize }[numBindings]
+void DbgCaptureRecorder::WriteBindingDescs(CaptureStreamWriter& writer, const std::vector<BindingDescriptor>& bindingDescs)
+{
+    writer.Write(static_cast<std::uint32_t>(bindingDescs.size()));
+    for (const BindingDescriptor& bindingDesc : bindingDescs)
+    {
+        writer.WriteString(bindingDesc.name.c_str());
+        writer.Write(bindingDesc.type);
+        WriteFlags(writer, bindingDesc.bindFlags);
+        WriteFlags(writer, bindingDesc.stageFlags);
+        writer.Write(bindingDesc.slot);
+        writer.Write(bindingDesc.arraySize);
+    }
+}
+
+void DbgCaptureRecorder::BeginCapture(const char* filename, std::uint32_t numFrames)
+{
+    filename_           = filename;
+    numFrames_          = numFrames;
+    numFramesRecorded_  = 0;
+    isCapturing_        = true;
+    warnedEncoding_     = false;
+    stream_.Clear();
+
+    /* Write all objects that are alive in the order of their creation, so all references can be resolved */
+    for (const auto& it : objects_)
+        WriteCreateObject(it.first, it.second);
+
+    /* Write current resource views and resource contents */
+    for (const auto& it : resourceHeapViews_)
+    {
+        /* Write contiguous ranges of resource views that are not null */
+        const std::vector<ResourceViewDescriptor>& views = it.second;
+        for (std::size_t first = 0, numViews = views.size(); first < numViews;)
+        {
+            if (views[first].resource == nullptr)
+            {
+                ++first;
+                continue;
+            }
+            std::size_t last = first;
+            while (last < numViews && views[last].resource != nullptr)
+                ++last;
+            WriteResourceHeapViews(it.first, static_cast<std::uint32_t>(first), &views[first], static_cast<std::uint32_t>(last - first));
+            first = last;
+        }
+    }
+
+    for (const auto& it : objects_)
+    {
+        const ObjectRecord& record = it.second;
+        if (record.type == CaptureObjectType::Buffer)
+            WriteBufferContent(it.first, *static_cast<const DbgBuffer*>(record.object));
+        else if (record.type == CaptureObjectType::Texture)
+            WriteTextureContent(it.first, *static_cast<const DbgTexture*>(record.object));
+    }
+
+    stream_.Write(CaptureOpcode::BeginFrame);
+}
+
+void DbgCaptureRecorder::EndCapture()
+{
+    stream_.Write(CaptureOpcode::EndOfStream);
+
+    CaptureFileHeader header;
+    {
+        header.numFrames    = numFramesRecorded_;
+        header.rendererID   = renderSystem_.GetRendererID();
+    }
+
+    if (FILE* file = ::fopen(filename_.c_str(), "wb"))
+    {
+        ::fwrite(&header, sizeof(header), 1, file);
+        ::fwrite(stream_.GetData(), 1, stream_.GetSize(), file);
+        ::fclose(file);
+    }
+    else
+        Log::Errorf("failed to write frame capture: %s\n", filename_.c_str());
+
+    isCapturing_ = false;
+    stream_.Clear();
+    filename_.clear();
+
+    /* Notify client programmer that the capture has finished */
+    debugger_->EndCapture();
+}
+
+void DbgCaptureRecorder::WarnOnce(bool& warned, const char* message)
+{
+    if (!warned && debugger_ != nullptr)
+    {
+        debugger_->Warningf(WarningType::ImproperState, "%s", message);
+        warned = true;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
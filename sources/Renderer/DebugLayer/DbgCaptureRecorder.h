@@ -0,0 +1,165 @@
+/*
+ * DbgCaptureRecorder.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_CAPTURE_RECORDER_H
+#define LLGL_DBG_CAPTURE_RECORDER_H
+
+
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include "../CaptureFormat.h"
+#include <unordered_map>
+#include <map>
+#include <vector>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+class DbgSwapChain;
+class DbgCommandBuffer;
+class DbgBuffer;
+class DbgBufferArray;
+class DbgTexture;
+class DbgRenderPass;
+class DbgRenderTarget;
+class DbgShader;
+class DbgPipelineLayout;
+class DbgPipelineState;
+class DbgResourceHeap;
+class DbgQueryHeap;
+
+// Recorder for frame captures (see RenderingDebugger::BeginCapture).
+// The creation parameters of all objects are serialized when they are created, so a capture can begin with any frame.
+class DbgCaptureRecorder
+{
+
+    public:
+
+        DbgCaptureRecorder(RenderSystem& renderSystemInstance, RenderingDebugger* debugger);
+
+        // Returns the ID of the specified debug object (or sampler) or zero if the object is unknown to the capture.
+        CaptureObjectID GetObjectID(const void* object) const;
+
+        // Returns true if a capture is currently being recorded.
+        inline bool IsCapturing() const
+        {
+            return isCapturing_;
+        }
+
+    public:
+
+        /* ----- Objects ----- */
+
+        void RecordSwapChain(const DbgSwapChain& swapChainDbg, const SwapChainDescriptor& swapChainDesc);
+        void RecordCommandBuffer(const DbgCommandBuffer& commandBufferDbg, const CommandBufferDescriptor& commandBufferDesc);
+        void RecordBuffer(const DbgBuffer& bufferDbg, const BufferDescriptor& bufferDesc, const void* initialData);
+        void RecordBufferArray(const DbgBufferArray& bufferArrayDbg, std::uint32_t numBuffers, Buffer* const * bufferArray);
+        void RecordTexture(const DbgTexture& textureDbg, const TextureDescriptor& textureDesc, const ImageView* initialImage);
+        void RecordSampler(const Sampler& sampler, const SamplerDescriptor& samplerDesc);
+        void RecordRenderPass(const DbgRenderPass& renderPassDbg, const RenderPassDescriptor& renderPassDesc);
+        void RecordRenderTarget(const DbgRenderTarget& renderTargetDbg, const RenderTargetDescriptor& renderTargetDesc);
+        void RecordShader(const DbgShader& shaderDbg, const ShaderDescriptor& shaderDesc);
+        void RecordPipelineLayout(const DbgPipelineLayout& pipelineLayoutDbg, const PipelineLayoutDescriptor& pipelineLayoutDesc);
+        void RecordPipelineState(const DbgPipelineState& pipelineStateDbg, const GraphicsPipelineDescriptor& pipelineStateDesc);
+        void RecordPipelineState(const DbgPipelineState& pipelineStateDbg, const ComputePipelineDescriptor& pipelineStateDesc);
+        void RecordResourceHeap(const DbgResourceHeap& resourceHeapDbg, const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews);
+        void RecordQueryHeap(const DbgQueryHeap& queryHeapDbg, const QueryHeapDescriptor& queryHeapDesc);
+
+        // Removes the specified object from the capture, e.g. when it is released.
+        void RecordRelease(const void* object);
+
+        /* ----- Resource updates ----- */
+
+        void RecordWriteBuffer(const DbgBuffer& bufferDbg, std::uint64_t offset, const void* data, std::uint64_t dataSize);
+        void RecordMapBuffer(const DbgBuffer& bufferDbg, const CPUAccess access, std::uint64_t offset, std::uint64_t length, const void* data);
+        void RecordUnmapBuffer(const DbgBuffer& bufferDbg);
+        void RecordWriteTexture(const DbgTexture& textureDbg, const TextureRegion& textureRegion, const ImageView& srcImageView);
+        void RecordWriteResourceHeap(const DbgResourceHeap& resourceHeapDbg, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+
+        /* ----- Submissions ----- */
+
+        // Records the commands of the last encoding of the specified command buffer if it was encoded during the capture.
+        void RecordSubmit(const DbgCommandBuffer& commandBufferDbg);
+
+        // Advances to the next frame; begins or ends the capture as scheduled by the debugger.
+        void NextFrame();
+
+    private:
+
+        struct ObjectRecord
+        {
+            CaptureObjectType   type;
+            const void*         object          = nullptr;
+            const void*         ownedRenderPass = nullptr;  // Render pass that is owned by this object (see RenderTarget::GetRenderPass)
+            CaptureStreamWriter params;
+        };
+
+        struct MappedBuffer
+        {
+            const void*     data    = nullptr;
+            std::uint64_t   offset  = 0;
+            std::uint64_t   length  = 0;
+        };
+
+        // Allocates a new ID for the specified object and returns the record to serialize its parameters into.
+        ObjectRecord& AllocObject(CaptureObjectType type, const void* object);
+
+        // Allocates a render pass that is owned by another object, e.g. the render pass of a swap-chain.
+        void AllocOwnedRenderPass(ObjectRecord& ownerRecord, CaptureObjectID ownerID, const RenderPass* renderPass);
+
+        // Writes the creation of the specified object into the capture stream if the capture is currently being recorded.
+        void FlushObject(CaptureObjectID id);
+
+        void WriteCreateObject(CaptureObjectID id, const ObjectRecord& record);
+        void WriteResourceHeapViews(CaptureObjectID id, std::uint32_t firstDescriptor, const ResourceViewDescriptor* resourceViews, std::uint32_t numResourceViews);
+        void WriteBufferContent(CaptureObjectID id, const DbgBuffer& bufferDbg);
+        void WriteTextureContent(CaptureObjectID id, const DbgTexture& textureDbg);
+        void WriteVertexAttributes(CaptureStreamWriter& writer, const ArrayView<VertexAttribute>& attributes);
+        void WriteSamplerDesc(CaptureStreamWriter& writer, const SamplerDescriptor& samplerDesc);
+        void WriteBindingDescs(CaptureStreamWriter& writer, const std::vector<BindingDescriptor>& bindingDescs);
+
+        void BeginCapture(const char* filename, std::uint32_t numFrames);
+        void EndCapture();
+
+        // Reports a warning for an operation that cannot be captured, but only once per capture.
+        void WarnOnce(bool& warned, const char* message);
+
+    private:
+
+        RenderSystem&                                               renderSystem_;
+        RenderingDebugger*                                          debugger_           = nullptr;
+
+        CaptureObjectID                                             nextObjectID_       = 1;
+        std::unordered_map<const void*, CaptureObjectID>            objectIDs_;
+        std::map<CaptureObjectID, ObjectRecord>                     objects_;
+        std::unordered_map<CaptureObjectID, std::vector<ResourceViewDescriptor>> resourceHeapViews_;
+        std::unordered_map<const void*, MappedBuffer>               mappedBuffers_;
+
+        bool                                                        isCapturing_        = false;
+        std::string                                                 filename_;
+        std::uint32_t                                               numFrames_          = 0;
+        std::uint32_t                                               numFramesRecorded_  = 0;
+        CaptureStreamWriter                                         stream_;
+
+        bool                                                        warnedEncoding_     = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
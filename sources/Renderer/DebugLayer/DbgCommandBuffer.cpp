@@ -11,6 +11,7 @@
 #include "../CheckedCast.h"
 #include "../ResourceUtils.h"
 #include "../PipelineStateUtils.h"
+#include "../RenderPassUtils.h"
 #include "../../Core/StringUtils.h"
 #include "../../Core/Assertion.h"
 
@@ -18,6 +19,7 @@
 #include "Buffer/DbgBuffer.h"
 #include "Buffer/DbgBufferArray.h"
 #include "RenderState/DbgQueryHeap.h"
+#include "RenderState/DbgRenderPass.h"
 #include "RenderState/DbgPipelineState.h"
 #include "RenderState/DbgPipelineLayout.h"
 #include "RenderState/DbgResourceHeap.h"
@@ -78,6 +80,16 @@ namespace LLGL
     if (perfProfilerEnabled_)   \
         EndTimer()
 
+#define LLGL_DBG_CAPTURE(...)   \
+    if (isCaptured_)            \
+        CaptureCommand(__VA_ARGS__)
+
+#define LLGL_DBG_CAPTURE_ID(OBJ) \
+    captureRecorder_.GetObjectID(OBJ)
+
+#define LLGL_DBG_VALIDATE(CATEGORY) \
+    DbgIsValidationEnabled(debugger_, ValidationFlags::CATEGORY)
+
 #define LLGL_DBG_ASSERT_PTR(NAME) \
     AssertNullPointer(NAME, #NAME)
 
@@ -127,24 +139,51 @@ static const char* GetResourceLabel(const Resource* resource)
     return (resource != nullptr ? GetResourceLabel(*resource) : "null");
 }
 
+template <typename... TArgs>
+void DbgCommandBuffer::CaptureCommand(CaptureOpcode opcode, const TArgs&... args)
+{
+    captureStream_.Write(opcode);
+    const int expander[] = { 0, (captureStream_.Write(args), 0)... };
+    (void)expander;
+}
+
 DbgCommandBuffer::DbgCommandBuffer(
     RenderSystem&                   renderSystemInstance,
     CommandQueue&                   commandQueueInstance,
+    DbgQueryScopePool&              queryScopePool,
     CommandBuffer&                  commandBufferInstance,
     FrameProfile&                   commonProfile,
+    DbgCaptureRecorder&             captureRecorder,
     RenderingDebugger*              debugger,
     const CommandBufferDescriptor&  desc,
     const RenderingCapabilities&    caps)
 :
-    instance        { commandBufferInstance                                             },
-    desc            { desc                                                              },
-    label           { LLGL_DBG_LABEL(desc)                                              },
-    debugger_       { debugger                                                          },
-    commonProfile_  { commonProfile                                                     },
-    features_       { caps.features                                                     },
-    limits_         { caps.limits                                                       },
-    queryTimerPool_ { renderSystemInstance, commandQueueInstance, commandBufferInstance }
+    instance                { commandBufferInstance                                             },
+    commandQueueInstance    { commandQueueInstance                                              },
+    desc                    { desc                                                              },
+    label                   { LLGL_DBG_LABEL(desc)                                              },
+    debugger_               { debugger                                                          },
+    commonProfile_          { commonProfile                                                     },
+    features_               { caps.features                                                     },
+    limits_                 { caps.limits                                                       },
+    queryTimerPool_         { renderSystemInstance, commandQueueInstance, commandBufferInstance },
+    queryScopePool_         { queryScopePool                                                    },
+    captureRecorder_        { captureRecorder                                                   }
 {
+    /* Only keep the formats of the inheritance render pass, since secondary command buffers can be executed in any compatible render pass */
+    if (IsSecondaryCmdBuffer() && desc.renderPass != nullptr)
+    {
+        auto* renderPassDbg = LLGL_CAST(const DbgRenderPass*, desc.renderPass);
+        inheritanceRenderPassDesc_              = renderPassDbg->desc;
+        inheritanceRenderPassDesc_.debugName    = nullptr;
+        hasInheritanceRenderPass_               = true;
+    }
+}
+
+DbgCommandBuffer::~DbgCommandBuffer()
+{
+    /* Return timer scopes of a recording that has never been submitted; this also releases wrappers of incomplete type DbgBuffer */
+    queryScopePool_.FreeBatch(queryScopeBatch_);
 }
 
 void DbgCommandBuffer::SetDebugName(const char* name)
@@ -165,10 +204,32 @@ void DbgCommandBuffer::Begin()
     if (perfProfilerEnabled_)
         queryTimerPool_.Reset();
 
+    /* Store CPU ticks for the encoding event if it was scheduled */
+    eventRecordingEnabled_ = DbgIsEventRecordingEnabled(debugger_);
+    if (eventRecordingEnabled_)
+        encodingTicksStart_ = Timer::Tick();
+
+    /* Capture commands if this recording is part of a frame capture */
+    isCaptured_ = captureRecorder_.IsCapturing();
+    captureStream_.Clear();
+
     /* Begin with command recording  */
     if (LLGL_DBG_SOURCE())
         ValidateBeginOfRecording();
 
+    /* Discard timer scopes of a previous recording that has not been submitted */
+    queryScopePool_.FreeBatch(queryScopeBatch_);
+    queryScopeBatch_ = nullptr;
+
+    /* Allocate batch for hierarchical timer scopes and pipeline statistics if they are scheduled */
+    if (debugger_ != nullptr && !IsSecondaryCmdBuffer())
+    {
+        const bool recordScopes     = (debugger_->GetScopeRecording() && features_.hasTimestampQueries);
+        const bool recordStatistics = (debugger_->GetStatisticsRecording() && features_.hasPipelineStatistics);
+        if (recordScopes || recordStatistics)
+            queryScopeBatch_ = queryScopePool_.AllocBatch(instance, recordScopes, recordStatistics);
+    }
+
     instance.Begin();
     LLGL_DBG_START_TIMER("CommandBuffer()");
 
@@ -182,14 +243,28 @@ void DbgCommandBuffer::End()
         ValidateEndOfRecording();
 
     LLGL_DBG_END_TIMER();
+
+    /* Close all timer scopes and statistics sections that are still open at the end of recording */
+    if (queryScopeBatch_ != nullptr)
+    {
+        queryScopePool_.EndStatistics(*queryScopeBatch_);
+        queryScopePool_.PopAllScopes(*queryScopeBatch_);
+    }
+
     instance.End();
 
     /* Resolve timer query results for performance profiler */
     if (perfProfilerEnabled_)
         queryTimerPool_.TakeRecords(profile_.timeRecords);
 
+    if (eventRecordingEnabled_)
+        DbgRecordEvent(profile_, ProfileEventType::Encoding, StringLiteral{ GetLabelOrDefault(label, "LLGL::CommandBuffer"), CopyTag{} }, encodingTicksStart_);
+
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
     {
+        SubmitQueryScopes();
+        captureRecorder_.RecordSubmit(*this);
+
         /* Merge frame profile values into rendering profiler */
         FrameProfile profile;
         FlushProfile(profile);
@@ -217,9 +292,19 @@ void DbgCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
         );
 
         ValidateCommandBufferForExecute(commandBufferDbg.states_, GetLabelOrDefault(commandBufferDbg.label, "LLGL::CommandBuffer"));
+        ValidateRenderPassForExecute(commandBufferDbg);
     }
 
     LLGL_DBG_COMMAND( instance.Execute(commandBufferDbg.instance), "Execute()" );
+    if (isCaptured_)
+    {
+        /* Inline commands of secondary command buffer, since they can be executed by multiple primary command buffers */
+        captureStream_.Write(CaptureOpcode::Execute);
+        if (const CaptureStreamWriter* secondaryStream = commandBufferDbg.GetCaptureStream())
+            captureStream_.WriteStream(*secondaryStream);
+        else
+            captureStream_.WriteStream(CaptureStreamWriter{});
+    }
 }
 
 /* ----- Blitting ----- */
@@ -244,9 +329,38 @@ void DbgCommandBuffer::UpdateBuffer(
         "UpdateBuffer(%s, %" PRIu64 ", %p, %u)", GetResourceLabel(dstBuffer), dstOffset, data, static_cast<std::uint32_t>(dataSize)
     );
 
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::UpdateBuffer, LLGL_DBG_CAPTURE_ID(&dstBufferDbg), dstOffset, dataSize);
+        captureStream_.WriteBytes(data, dataSize);
+    }
+
     profile_.commandBufferRecord.bufferUpdates++;
 }
 
+TransientBufferAllocation DbgCommandBuffer::AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertTransientBuffersSupported();
+
+        if (size == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot allocate transient buffer of size zero");
+
+        constexpr long validBindFlags = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::ConstantBuffer);
+        ValidateBindFlags(validBindFlags, bindFlags, validBindFlags, "transient buffer");
+    }
+
+    TransientBufferAllocation allocation = instance.AllocTransientBuffer(size, bindFlags, alignment);
+
+    /* Replace backend buffer with its debug wrapper, so the allocation can be passed to other commands of this command buffer */
+    if (allocation.buffer != nullptr)
+        allocation.buffer = GetOrCreateTransientBufferWrapper(*allocation.buffer);
+
+    return allocation;
+}
+
 void DbgCommandBuffer::CopyBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
@@ -271,11 +385,71 @@ void DbgCommandBuffer::CopyBuffer(
         instance.CopyBuffer(dstBufferDbg.instance, dstOffset, srcBufferDbg.instance, srcOffset, size),
         "CopyBuffer(%s, %" PRIu64 ", %s, %" PRIu64 ", %" PRIu64 ")", GetResourceLabel(dstBuffer), dstOffset, GetResourceLabel(srcBuffer), srcOffset, size
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::CopyBuffer, LLGL_DBG_CAPTURE_ID(&dstBufferDbg), dstOffset, LLGL_DBG_CAPTURE_ID(&srcBufferDbg), srcOffset, size);
 
     profile_.commandBufferRecord.bufferCopies++;
 }
 
+void DbgCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
+    auto& srcBufferDbg = LLGL_DBG_CAST(DbgBuffer&, srcBuffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+        ValidateBindBufferFlags(srcBufferDbg, BindFlags::CopySrc);
+        if (numRegions > 0)
+        {
+            LLGL_DBG_ASSERT_PTR(regions);
+            if (regions != nullptr)
+                ValidateBufferCopyRegions(dstBufferDbg, srcBufferDbg, numRegions, regions);
+        }
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.CopyBufferRegions(dstBufferDbg.instance, srcBufferDbg.instance, numRegions, regions),
+        "CopyBufferRegions(%s, %s, %u, {regions})", GetResourceLabel(dstBuffer), GetResourceLabel(srcBuffer), numRegions
+    );
+
+    /* Record multi-region copies as one copy command per region */
+    for_range(i, numRegions)
+    {
+        LLGL_DBG_CAPTURE(
+            CaptureOpcode::CopyBuffer,
+            LLGL_DBG_CAPTURE_ID(&dstBufferDbg), regions[i].dstOffset, LLGL_DBG_CAPTURE_ID(&srcBufferDbg), regions[i].srcOffset, regions[i].size
+        );
+    }
+
+    profile_.commandBufferRecord.bufferCopies += numRegions;
+}
+
 // Returns the minimum required memory footprint to copy the specified texture region into a buffer
+// Returns the ClearFlags of all attachments that load their previous content in the specified render pass.
+static long GetLoadedAttachmentFlags(const RenderPassDescriptor& desc)
+{
+    long flags = 0;
+
+    for (const AttachmentFormatDescriptor& colorAttachment : desc.colorAttachments)
+    {
+        if (colorAttachment.format != Format::Undefined && colorAttachment.loadOp == AttachmentLoadOp::Load)
+            flags |= ClearFlags::Color;
+    }
+
+    if (desc.depthAttachment.format != Format::Undefined && desc.depthAttachment.loadOp == AttachmentLoadOp::Load)
+        flags |= ClearFlags::Depth;
+    if (desc.stencilAttachment.format != Format::Undefined && desc.stencilAttachment.loadOp == AttachmentLoadOp::Load)
+        flags |= ClearFlags::Stencil;
+
+    return flags;
+}
+
 static std::size_t GetTextureRegionMinFootprint(const DbgTexture& textureDbg, const TextureRegion& region)
 {
     const std::uint32_t numTexels = NumMipTexels(textureDbg.GetType(), region.extent, region.subresource.baseMipLevel);
@@ -308,6 +482,7 @@ void DbgCommandBuffer::CopyBufferFromTexture(
         instance.CopyBufferFromTexture(dstBufferDbg.instance, dstOffset, srcTextureDbg.instance, srcRegion, rowStride, layerStride),
         "CopyBufferFromTexture(%s, %" PRIu64 ", %s, {region}, %u, %u)", GetResourceLabel(dstBuffer), dstOffset, GetResourceLabel(srcTexture), rowStride, layerStride
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::CopyBufferFromTexture, LLGL_DBG_CAPTURE_ID(&dstBufferDbg), dstOffset, LLGL_DBG_CAPTURE_ID(&srcTextureDbg), srcRegion, rowStride, layerStride);
 
     profile_.commandBufferRecord.bufferCopies++;
 }
@@ -343,6 +518,7 @@ void DbgCommandBuffer::FillBuffer(
         instance.FillBuffer(dstBufferDbg.instance, dstOffset, value, fillSize),
         "FillBuffer(%s, %" PRIu64 ", %u, %" PRIu64 ")", GetResourceLabel(dstBuffer), dstOffset, value, fillSize
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::FillBuffer, LLGL_DBG_CAPTURE_ID(&dstBufferDbg), dstOffset, value, fillSize);
 
     profile_.commandBufferRecord.bufferFills++;
 }
@@ -369,10 +545,47 @@ void DbgCommandBuffer::CopyTexture(
         instance.CopyTexture(dstTextureDbg.instance, dstLocation, srcTextureDbg.instance, srcLocation, extent),
         "CopyTexture(%s, {dstLoc}, %s, {srcLoc}, {extent})", GetResourceLabel(dstTexture), GetResourceLabel(srcTexture)
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::CopyTexture, LLGL_DBG_CAPTURE_ID(&dstTextureDbg), dstLocation, LLGL_DBG_CAPTURE_ID(&srcTextureDbg), srcLocation, extent);
 
     profile_.commandBufferRecord.textureCopies++;
 }
 
+void DbgCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    auto& dstTextureDbg = LLGL_DBG_CAST(DbgTexture&, dstTexture);
+    auto& srcTextureDbg = LLGL_DBG_CAST(DbgTexture&, srcTexture);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        ValidateBindTextureFlags(dstTextureDbg, BindFlags::CopyDst);
+        ValidateBindTextureFlags(srcTextureDbg, BindFlags::CopySrc);
+        if (numRegions > 0)
+            LLGL_DBG_ASSERT_PTR(regions);
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.CopyTextureRegions(dstTextureDbg.instance, srcTextureDbg.instance, numRegions, regions),
+        "CopyTextureRegions(%s, %s, %u, {regions})", GetResourceLabel(dstTexture), GetResourceLabel(srcTexture), numRegions
+    );
+
+    /* Record multi-region copies as one copy command per region */
+    for_range(i, numRegions)
+    {
+        LLGL_DBG_CAPTURE(
+            CaptureOpcode::CopyTexture,
+            LLGL_DBG_CAPTURE_ID(&dstTextureDbg), regions[i].dstLocation, LLGL_DBG_CAPTURE_ID(&srcTextureDbg), regions[i].srcLocation, regions[i].extent
+        );
+    }
+
+    profile_.commandBufferRecord.textureCopies += numRegions;
+}
+
 void DbgCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -399,6 +612,7 @@ void DbgCommandBuffer::CopyTextureFromBuffer(
         instance.CopyTextureFromBuffer(dstTextureDbg.instance, dstRegion, srcBufferDbg.instance, srcOffset, rowStride, layerStride),
         "CopyTextureFromBuffer(%s, {region}, %s, %" PRIu64 ", %u, %u)", GetResourceLabel(dstTexture), GetResourceLabel(srcBuffer), srcOffset, rowStride, layerStride
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::CopyTextureFromBuffer, LLGL_DBG_CAPTURE_ID(&dstTextureDbg), dstRegion, LLGL_DBG_CAPTURE_ID(&srcBufferDbg), srcOffset, rowStride, layerStride);
 
     profile_.commandBufferRecord.textureCopies++;
 }
@@ -424,6 +638,7 @@ void DbgCommandBuffer::CopyTextureFromFramebuffer(
         instance.CopyTextureFromFramebuffer(dstTextureDbg.instance, dstRegion, srcOffset),
         "CopyTextureFromFramebuffer(%s, {region}, (x=%d, y=%d)})", GetResourceLabel(dstTexture), srcOffset.x, srcOffset.y
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::CopyTextureFromFramebuffer, LLGL_DBG_CAPTURE_ID(&dstTextureDbg), dstRegion, srcOffset);
 
     profile_.commandBufferRecord.textureCopies++;
 }
@@ -443,6 +658,7 @@ void DbgCommandBuffer::GenerateMips(Texture& texture)
         instance.GenerateMips(textureDbg.instance),
         "GenerateMips(%s)", GetResourceLabel(texture)
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::GenerateMips, LLGL_DBG_CAPTURE_ID(&textureDbg));
 
     profile_.commandBufferRecord.mipMapsGenerations++;
 }
@@ -463,10 +679,131 @@ void DbgCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
         "GenerateMips(%s, (arrays=[%u:+%u], mips=[%u:+%u]))",
         GetResourceLabel(texture), subresource.baseArrayLayer, subresource.numArrayLayers, subresource.baseMipLevel, subresource.numMipLevels
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::GenerateMipsRange, LLGL_DBG_CAPTURE_ID(&textureDbg), subresource);
 
     profile_.commandBufferRecord.mipMapsGenerations++;
 }
 
+void DbgCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        if (numTextures > 0)
+            LLGL_DBG_ASSERT_PTR(textures);
+    }
+
+    if (numTextures == 0 || textures == nullptr)
+        return;
+
+    /* Validate textures and gather their instances; null pointers are ignored */
+    SmallVector<Texture*> textureInstances;
+    textureInstances.reserve(numTextures);
+
+    for_range(i, numTextures)
+    {
+        if (textures[i] == nullptr)
+            continue;
+
+        auto& textureDbg = LLGL_DBG_CAST(DbgTexture&, *textures[i]);
+        if (LLGL_DBG_SOURCE())
+            ValidateGenerateMips(textureDbg);
+
+        textureInstances.push_back(&(textureDbg.instance));
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.GenerateMips(static_cast<std::uint32_t>(textureInstances.size()), textureInstances.data()),
+        "GenerateMips(%u, {textures})", numTextures
+    );
+
+    /* Record batched MIP-map generations as one command per texture */
+    for_range(i, numTextures)
+    {
+        if (textures[i] != nullptr)
+        {
+            auto& textureDbg = LLGL_DBG_CAST(DbgTexture&, *textures[i]);
+            LLGL_DBG_CAPTURE(CaptureOpcode::GenerateMips, LLGL_DBG_CAPTURE_ID(&textureDbg));
+        }
+    }
+
+    profile_.commandBufferRecord.mipMapsGenerations += static_cast<std::uint32_t>(textureInstances.size());
+}
+
+void DbgCommandBuffer::ResolveSamplerFeedback(
+    Texture&        feedbackTexture,
+    std::uint32_t   mipLevel,
+    std::uint32_t   arrayLayer,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& textureDbg = LLGL_DBG_CAST(DbgTexture&, feedbackTexture);
+    auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        ValidateSamplerFeedbackTexture(textureDbg, "resolve");
+        ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+
+        if (textureDbg.feedbackDesc.pairedTexture != nullptr)
+        {
+            /* Validate subresource against the MinMip map (single MIP level) or the MipRegionUsed map (one level per paired MIP level) */
+            const std::uint32_t numMipLevels = (textureDbg.feedbackDesc.type == SamplerFeedbackType::MinMip ? 1u : textureDbg.mipLevels);
+            if (mipLevel >= numMipLevels)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "MIP level %u out of range for sampler feedback texture with %u MIP level(s)",
+                    mipLevel, numMipLevels
+                );
+            }
+            if (arrayLayer >= textureDbg.desc.arrayLayers)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "array layer %u out of range for sampler feedback texture with %u array layer(s)",
+                    arrayLayer, textureDbg.desc.arrayLayers
+                );
+            }
+
+            /* Each decoded region occupies one byte with tightly packed rows */
+            const Extent3D regions = GetSamplerFeedbackExtent(textureDbg.desc.extent, textureDbg.feedbackDesc.mipRegion);
+            const std::uint64_t decodedSize =
+            (
+                static_cast<std::uint64_t>(std::max(1u, regions.width  >> mipLevel)) *
+                static_cast<std::uint64_t>(std::max(1u, regions.height >> mipLevel))
+            );
+            ValidateBufferRange(dstBufferDbg, dstOffset, decodedSize);
+        }
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.ResolveSamplerFeedback(textureDbg.instance, mipLevel, arrayLayer, dstBufferDbg.instance, dstOffset),
+        "ResolveSamplerFeedback(%s, %u, %u, %s, %" PRIu64 ")",
+        GetResourceLabel(feedbackTexture), mipLevel, arrayLayer, GetResourceLabel(dstBuffer), dstOffset
+    );
+}
+
+void DbgCommandBuffer::ClearSamplerFeedback(Texture& feedbackTexture)
+{
+    auto& textureDbg = LLGL_DBG_CAST(DbgTexture&, feedbackTexture);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        ValidateSamplerFeedbackTexture(textureDbg, "clear");
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.ClearSamplerFeedback(textureDbg.instance),
+        "ClearSamplerFeedback(%s)", GetResourceLabel(feedbackTexture)
+    );
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void DbgCommandBuffer::SetViewport(const Viewport& viewport)
@@ -488,6 +825,7 @@ void DbgCommandBuffer::SetViewport(const Viewport& viewport)
         static_cast<int>(viewport.width), static_cast<int>(viewport.height),
         viewport.minDepth, viewport.maxDepth
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetViewports, std::uint32_t(1), viewport);
 }
 
 void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
@@ -525,6 +863,12 @@ void DbgCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport*
         instance.SetViewports(numViewports, viewports),
         "SetViewports(%u, %p)", numViewports, viewports
     );
+
+    if (isCaptured_ && viewports != nullptr)
+    {
+        CaptureCommand(CaptureOpcode::SetViewports, numViewports);
+        captureStream_.WriteArray(viewports, numViewports);
+    }
 }
 
 void DbgCommandBuffer::SetScissor(const Scissor& scissor)
@@ -542,6 +886,7 @@ void DbgCommandBuffer::SetScissor(const Scissor& scissor)
         instance.SetScissor(scissor),
         "SetScissor(%d, %d, %d, %d)", scissor.x, scissor.y, scissor.width, scissor.height
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetScissors, std::uint32_t(1), scissor);
 }
 
 void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
@@ -560,6 +905,12 @@ void DbgCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* sci
         instance.SetScissors(numScissors, scissors),
         "SetScissors(%u, %p)", numScissors, scissors
     );
+
+    if (isCaptured_ && scissors != nullptr)
+    {
+        CaptureCommand(CaptureOpcode::SetScissors, numScissors);
+        captureStream_.WriteArray(scissors, numScissors);
+    }
 }
 
 /* ----- Buffers ------ */
@@ -571,7 +922,8 @@ void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
     if (LLGL_DBG_SOURCE())
     {
         AssertRecording();
-        ValidateBindBufferFlags(bufferDbg, BindFlags::VertexBuffer);
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateBindBufferFlags(bufferDbg, BindFlags::VertexBuffer);
 
         bindings_.vertexBufferStore[0]  = (&bufferDbg);
         bindings_.vertexBuffers         = bindings_.vertexBufferStore;
@@ -582,6 +934,7 @@ void DbgCommandBuffer::SetVertexBuffer(Buffer& buffer)
         instance.SetVertexBuffer(bufferDbg.instance),
         "SetVertexBuffer(%s)", GetResourceLabel(buffer)
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetVertexBuffer, LLGL_DBG_CAPTURE_ID(&bufferDbg));
 
     profile_.commandBufferRecord.vertexBufferBindings++;
 }
@@ -593,13 +946,15 @@ void DbgCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     if (LLGL_DBG_SOURCE())
     {
         AssertRecording();
-        ValidateBindFlags(bufferArrayDbg.GetBindFlags(), BindFlags::VertexBuffer, BindFlags::VertexBuffer, "LLGL::BufferArray");
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateBindFlags(bufferArrayDbg.GetBindFlags(), BindFlags::VertexBuffer, BindFlags::VertexBuffer, "LLGL::BufferArray");
 
         bindings_.vertexBuffers     = bufferArrayDbg.buffers.data();
         bindings_.numVertexBuffers  = static_cast<std::uint32_t>(bufferArrayDbg.buffers.size());
     }
 
     LLGL_DBG_COMMAND( instance.SetVertexBufferArray(bufferArrayDbg.instance), "SetVertexBufferArray()" );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetVertexBufferArray, LLGL_DBG_CAPTURE_ID(&bufferArrayDbg));
 
     profile_.commandBufferRecord.vertexBufferBindings++;
 }
@@ -612,7 +967,8 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
     {
         AssertRecording();
 
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndexBuffer);
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateBindBufferFlags(bufferDbg, BindFlags::IndexBuffer);
         ValidateIndexType(bufferDbg.desc.format);
 
         bindings_.indexBuffer           = (&bufferDbg);
@@ -624,6 +980,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer)
         instance.SetIndexBuffer(bufferDbg.instance),
         "SetIndexBuffer(%s)", GetResourceLabel(buffer)
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetIndexBuffer, LLGL_DBG_CAPTURE_ID(&bufferDbg));
 
     profile_.commandBufferRecord.indexBufferBindings++;
 }
@@ -637,7 +994,8 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::
     {
         AssertRecording();
 
-        ValidateBindBufferFlags(bufferDbg, BindFlags::IndexBuffer);
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateBindBufferFlags(bufferDbg, BindFlags::IndexBuffer);
         ValidateIndexType(format);
 
         bindings_.indexBuffer           = (&bufferDbg);
@@ -658,6 +1016,7 @@ void DbgCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::
         instance.SetIndexBuffer(bufferDbg.instance, format, offset),
         "SetIndexBuffer(%s, %s, %" PRIu64 ")", GetResourceLabel(buffer), ToString(format), offset
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetIndexBufferExt, LLGL_DBG_CAPTURE_ID(&bufferDbg), format, offset);
 
     profile_.commandBufferRecord.indexBufferBindings++;
 }
@@ -672,7 +1031,8 @@ void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
     if (LLGL_DBG_SOURCE())
     {
         AssertRecording();
-        ValidateDescriptorSetIndex(descriptorSet, resourceHeapDbg.GetNumDescriptorSets(), resourceHeapDbg.label.c_str());
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateDescriptorSetIndex(descriptorSet, resourceHeapDbg.GetNumDescriptorSets(), resourceHeapDbg.label.c_str());
         bindings_.bindingTable.resourceHeap = &resourceHeap;
     }
 
@@ -680,6 +1040,7 @@ void DbgCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
         instance.SetResourceHeap(resourceHeapDbg.instance, descriptorSet),
         "SetResourceHeap(%s, %u)", GetLabelOrDefault(resourceHeapDbg.label, "LLGL::ResourceHeap"), descriptorSet
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetResourceHeap, LLGL_DBG_CAPTURE_ID(&resourceHeapDbg), descriptorSet);
 
     profile_.commandBufferRecord.resourceHeapBindings++;
 }
@@ -692,13 +1053,16 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
     {
         AssertRecording();
 
-        if (auto* pso = bindings_.pipelineState)
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
         {
-            if (auto* psoLayout = pso->pipelineLayout)
-                bindingDesc = GetAndValidateResourceDescFromPipeline(*psoLayout, descriptor, resource);
+            if (auto* pso = bindings_.pipelineState)
+            {
+                if (auto* psoLayout = pso->pipelineLayout)
+                    bindingDesc = GetAndValidateResourceDescFromPipeline(*psoLayout, descriptor, resource);
+            }
+            else
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind resource without pipeline state");
         }
-        else
-            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind resource without pipeline state");
 
         if (descriptor < bindings_.bindingTable.resources.size())
             bindings_.bindingTable.resources[descriptor] = &resource;
@@ -719,15 +1083,24 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
                 ValidateBindFlags(
                     bufferDbg.desc.bindFlags,
                     bindingDesc->bindFlags,
-                    (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage),
+                    (BindFlags::ConstantBuffer | BindFlags::Sampled | BindFlags::Storage | BindFlags::AccelerationStructure),
                     GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
                 );
+                if ((bindingDesc->bindFlags & BindFlags::AccelerationStructure) != 0 && !bufferDbg.initialized)
+                {
+                    LLGL_DBG_ERROR(
+                        ErrorType::InvalidState,
+                        "cannot bind acceleration structure '%s' before it has been built",
+                        GetLabelOrDefault(bufferDbg.label, "LLGL::Buffer")
+                    );
+                }
             }
 
             LLGL_DBG_COMMAND_EXT(
                 instance.SetResource(descriptor, bufferDbg.instance),
                 "SetResource(%u, %s)", descriptor, GetResourceLabel(resource)
             );
+            LLGL_DBG_CAPTURE(CaptureOpcode::SetResource, descriptor, LLGL_DBG_CAPTURE_ID(&bufferDbg));
 
             /* Record binding for profiling */
             if (bindingDesc != nullptr)
@@ -761,6 +1134,7 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
                 instance.SetResource(descriptor, textureDbg.instance),
                 "SetResource(%u, %s)", descriptor, GetResourceLabel(resource)
             );
+            LLGL_DBG_CAPTURE(CaptureOpcode::SetResource, descriptor, LLGL_DBG_CAPTURE_ID(&textureDbg));
 
             /* Record binding for profiling */
             if (bindingDesc != nullptr)
@@ -785,6 +1159,7 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
                 instance.SetResource(descriptor, resource),
                 "SetResource(%u, %s)", descriptor, GetResourceLabel(resource)
             );
+            LLGL_DBG_CAPTURE(CaptureOpcode::SetResource, descriptor, LLGL_DBG_CAPTURE_ID(&resource));
 
             /* Record binding for profiling */
             profile_.commandBufferRecord.samplerBindings++;
@@ -793,6 +1168,51 @@ void DbgCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
     }
 }
 
+void DbgCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+        {
+            if (auto* pso = bindings_.pipelineState)
+            {
+                if (auto* psoLayout = pso->pipelineLayout)
+                {
+                    if (const BindingDescriptor* bindingDesc = GetAndValidateResourceDescFromPipeline(*psoLayout, descriptor, buffer))
+                    {
+                        if ((bindingDesc->bindFlags & BindFlags::ConstantBuffer) == 0)
+                            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind buffer range to descriptor %u that is not a constant buffer binding", descriptor);
+                    }
+                }
+            }
+            else
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind resource without pipeline state");
+
+            ValidateBindBufferFlags(bufferDbg, BindFlags::ConstantBuffer);
+        }
+        ValidateAddressAlignment(offset, limits_.minConstantBufferAlignment, "constant buffer range offset");
+        ValidateBufferRange(bufferDbg, offset, size, "constant buffer range");
+
+        if (size == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot bind constant buffer range of size zero");
+
+        if (descriptor < bindings_.bindingTable.resources.size())
+            bindings_.bindingTable.resources[descriptor] = &buffer;
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.SetConstantBufferRange(descriptor, bufferDbg.instance, offset, size),
+        "SetConstantBufferRange(%u, %s, %" PRIu64 ", %" PRIu64 ")", descriptor, GetResourceLabel(buffer), offset, size
+    );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetConstantBufferRange, descriptor, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset, size);
+
+    profile_.commandBufferRecord.constantBufferBindings++;
+}
+
 void DbgCommandBuffer::ResourceBarrier(
     std::uint32_t       numBuffers,
     Buffer* const *     buffers,
@@ -801,59 +1221,104 @@ void DbgCommandBuffer::ResourceBarrier(
 {
     SmallVector<Buffer*> bufferInstances;
     SmallVector<Texture*> textureInstances;
+    GatherBarrierResourceInstances(numBuffers, buffers, numTextures, textures, bufferInstances, textureInstances);
 
-    bufferInstances.resize(numBuffers);
-    textureInstances.resize(numTextures);
+    LLGL_DBG_COMMAND_EXT(
+        instance.ResourceBarrier(numBuffers, bufferInstances.data(), numTextures, textureInstances.data()),
+        "ResourceBarrier(%u, %p, %u, %p)", numBuffers, buffers, numTextures, textures
+    );
+
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::ResourceBarrier);
+        CaptureBarrierResources(numBuffers, buffers, numTextures, textures);
+    }
+}
+
+void DbgCommandBuffer::BeginResourceBarrier(
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
+{
+    SmallVector<Buffer*> bufferInstances;
+    SmallVector<Texture*> textureInstances;
+    GatherBarrierResourceInstances(numBuffers, buffers, numTextures, textures, bufferInstances, textureInstances);
 
     if (LLGL_DBG_SOURCE())
     {
-        /* Gather resource instances and validate their binding flags */
-        for_range(i, numBuffers)
+        AssertRecording();
+        if (LLGL_DBG_VALIDATE(Barriers))
         {
-            if (buffers[i] != nullptr)
-            {
-                DbgBuffer* bufferDbg = LLGL_CAST(DbgBuffer*, buffers[i]);
-                ValidateMemoryBarrierResourceFlags(ResourceType::Buffer, bufferDbg->GetBindFlags(), bufferDbg->label, i);
-                bufferInstances[i] = &(bufferDbg->instance);
-            }
+            ValidateSplitResourceBarrier("BeginResourceBarrier");
+            if (states_.numSplitBarriers > 0)
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot nest split resource barriers; missing EndResourceBarrier() before BeginResourceBarrier()");
         }
+        ++states_.numSplitBarriers;
+    }
 
-        for_range(i, numTextures)
-        {
-            if (textures[i] != nullptr)
-            {
-                DbgTexture* textureDbg = LLGL_CAST(DbgTexture*, textures[i]);
-                ValidateMemoryBarrierResourceFlags(ResourceType::Texture, textureDbg->GetBindFlags(), textureDbg->label, i);
-                textureInstances[i] = &(textureDbg->instance);
-            }
-        }
+    LLGL_DBG_COMMAND_EXT(
+        instance.BeginResourceBarrier(numBuffers, bufferInstances.data(), numTextures, textureInstances.data()),
+        "BeginResourceBarrier(%u, %p, %u, %p)", numBuffers, buffers, numTextures, textures
+    );
+
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::BeginResourceBarrier);
+        CaptureBarrierResources(numBuffers, buffers, numTextures, textures);
     }
-    else
+}
+
+void DbgCommandBuffer::EndResourceBarrier(
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
+{
+    SmallVector<Buffer*> bufferInstances;
+    SmallVector<Texture*> textureInstances;
+    GatherBarrierResourceInstances(numBuffers, buffers, numTextures, textures, bufferInstances, textureInstances);
+
+    if (LLGL_DBG_SOURCE())
     {
-        /* Only gather resource instances */
-        for_range(i, numBuffers)
+        AssertRecording();
+        if (LLGL_DBG_VALIDATE(Barriers))
+            ValidateSplitResourceBarrier("EndResourceBarrier");
+        if (states_.numSplitBarriers == 0)
         {
-            if (buffers[i] != nullptr)
-            {
-                DbgBuffer* bufferDbg = LLGL_CAST(DbgBuffer*, buffers[i]);
-                bufferInstances[i] = &(bufferDbg->instance);
-            }
+            if (LLGL_DBG_VALIDATE(Barriers))
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end split resource barrier without previous call to BeginResourceBarrier()");
         }
+        else
+            --states_.numSplitBarriers;
+    }
 
-        for_range(i, numTextures)
-        {
-            if (textures[i] != nullptr)
-            {
-                DbgTexture* textureDbg = LLGL_CAST(DbgTexture*, textures[i]);
-                textureInstances[i] = &(textureDbg->instance);
-            }
-        }
+    LLGL_DBG_COMMAND_EXT(
+        instance.EndResourceBarrier(numBuffers, bufferInstances.data(), numTextures, textureInstances.data()),
+        "EndResourceBarrier(%u, %p, %u, %p)", numBuffers, buffers, numTextures, textures
+    );
+
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::EndResourceBarrier);
+        CaptureBarrierResources(numBuffers, buffers, numTextures, textures);
+    }
+}
+
+void DbgCommandBuffer::AliasingBarrier(Texture* textureBefore, Texture* textureAfter)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        if (LLGL_DBG_VALIDATE(Barriers))
+            ValidateAliasingBarrier(DbgGetWrapper<DbgTexture>(textureBefore), DbgGetWrapper<DbgTexture>(textureAfter));
     }
 
     LLGL_DBG_COMMAND_EXT(
-        instance.ResourceBarrier(numBuffers, bufferInstances.data(), numTextures, textureInstances.data()),
-        "ResourceBarrier(%u, %p, %u, %p)", numBuffers, buffers, numTextures, textures
+        instance.AliasingBarrier(DbgGetInstance<DbgTexture>(textureBefore), DbgGetInstance<DbgTexture>(textureAfter)),
+        "AliasingBarrier(%p, %p)", textureBefore, textureAfter
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::AliasingBarrier, LLGL_DBG_CAPTURE_ID(textureBefore), LLGL_DBG_CAPTURE_ID(textureAfter));
 }
 
 /* ----- Render Passes ----- */
@@ -886,17 +1351,42 @@ void DbgCommandBuffer::BeginRenderPass(
                     "cannot begin new render pass while previous render pass is still active"
                 );
             }
+            if (desc.queueType != CommandQueueType::Graphics)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidState,
+                    "cannot begin render pass with command buffer for compute or copy queue"
+                );
+            }
             states_.insideRenderPass = true;
         }
     }
 
     const RenderPass* renderPassInstance = DbgGetInstance<DbgRenderPass>(renderPass);
 
+    /* Close statistics section of previous compute dispatches */
+    if (queryScopeBatch_ != nullptr)
+        queryScopePool_.EndStatistics(*queryScopeBatch_);
+
+    /* Track render pass formats to validate compatibility of secondary command buffers */
+    bindings_.renderPass = LLGL_CAST(const DbgRenderPass*, (renderPass != nullptr ? renderPass : renderTarget.GetRenderPass()));
+
+    /* Track which attachments are loaded by an explicit render pass to detect clears that make these loads redundant */
+    if (renderPass != nullptr)
+    {
+        states_.loadedAttachments   = GetLoadedAttachmentFlags(LLGL_CAST(const DbgRenderPass*, renderPass)->desc);
+        states_.drawsAtRenderPass   = profile_.commandBufferRecord.drawCommands;
+    }
+    else
+        states_.loadedAttachments = 0;
+
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         auto& swapChainDbg = LLGL_DBG_CAST(DbgSwapChain&, renderTarget);
 
-        if (!swapChainDbg.IsPresentable())
+        const bool isValidationEnabled = DbgIsValidationEnabled(debugger_);
+
+        if (isValidationEnabled && !swapChainDbg.IsPresentable())
         {
             LLGL_DBG_ERROR(
                 ErrorType::InvalidState,
@@ -904,13 +1394,13 @@ void DbgCommandBuffer::BeginRenderPass(
             );
         }
 
-        swapChainDbg.NotifyNextRenderPass(debugger_, renderPass);
+        swapChainDbg.NotifyNextRenderPass((isValidationEnabled ? debugger_ : nullptr), renderPass);
 
         bindings_.swapChain     = &swapChainDbg;
         bindings_.renderTarget  = nullptr;
 
         /* Record swap-chain frame to validate when submitting the command buffer */
-        if (debugger_)
+        if (isValidationEnabled)
         {
             const std::uint32_t actualSwapBufferIndex = (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX ? swapChainDbg.GetCurrentSwapIndex() : swapBufferIndex);
             records_.swapChainFrames.push_back({ bindings_.swapChain, actualSwapBufferIndex });
@@ -919,6 +1409,7 @@ void DbgCommandBuffer::BeginRenderPass(
 
         LLGL_DBG_START_TIMER_EXT("BeginRenderPass(%s)", GetLabelOrDefault(swapChainDbg.label, "LLGL::SwapChain"));
         instance.BeginRenderPass(swapChainDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+        BeginStatisticsSection(GetLabelOrDefault(swapChainDbg.label, "LLGL::SwapChain"));
     }
     else
     {
@@ -929,6 +1420,16 @@ void DbgCommandBuffer::BeginRenderPass(
 
         LLGL_DBG_START_TIMER_EXT("BeginRenderPass(%s)", GetLabelOrDefault(renderTargetDbg.label, "LLGL::RenderTarget"));
         instance.BeginRenderPass(renderTargetDbg.instance, renderPassInstance, numClearValues, clearValues, swapBufferIndex);
+        BeginStatisticsSection(GetLabelOrDefault(renderTargetDbg.label, "LLGL::RenderTarget"));
+    }
+
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::BeginRenderPass, LLGL_DBG_CAPTURE_ID(&renderTarget), LLGL_DBG_CAPTURE_ID(renderPass));
+        const std::uint32_t numCapturedClearValues = (clearValues != nullptr ? numClearValues : 0u);
+        captureStream_.Write(numCapturedClearValues);
+        captureStream_.WriteArray(clearValues, numCapturedClearValues);
+        captureStream_.Write(swapBufferIndex);
     }
 
     profile_.commandBufferRecord.renderPassSections++;
@@ -945,7 +1446,11 @@ void DbgCommandBuffer::EndRenderPass()
         states_.insideRenderPass = false;
     }
 
+    if (queryScopeBatch_ != nullptr)
+        queryScopePool_.EndStatistics(*queryScopeBatch_);
+
     instance.EndRenderPass();
+    LLGL_DBG_CAPTURE(CaptureOpcode::EndRenderPass);
     LLGL_DBG_END_TIMER();
 }
 
@@ -956,9 +1461,11 @@ void DbgCommandBuffer::Clear(long flags, const ClearValue& clearValue)
         AssertRecording();
         AssertPrimaryCommandBuffer();
         AssertInsideRenderPass();
+        ValidateClearAfterLoad(flags);
     }
 
     LLGL_DBG_COMMAND( instance.Clear(flags, clearValue), "Clear()" );
+    LLGL_DBG_CAPTURE(CaptureOpcode::Clear, static_cast<std::uint32_t>(flags), clearValue);
 
     profile_.commandBufferRecord.attachmentClears++;
 }
@@ -970,8 +1477,13 @@ void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Atta
         AssertRecording();
         AssertPrimaryCommandBuffer();
         AssertInsideRenderPass();
+        long flags = 0;
         for_range(i, numAttachments)
+        {
             ValidateAttachmentClear(attachments[i]);
+            flags |= attachments[i].flags;
+        }
+        ValidateClearAfterLoad(flags);
     }
 
     LLGL_DBG_COMMAND_EXT(
@@ -979,6 +1491,17 @@ void DbgCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Atta
         "ClearAttachments(%u, %p)", numAttachments, attachments
     );
 
+    if (isCaptured_ && attachments != nullptr)
+    {
+        CaptureCommand(CaptureOpcode::ClearAttachments, numAttachments);
+        for_range(i, numAttachments)
+        {
+            captureStream_.Write(static_cast<std::uint32_t>(attachments[i].flags));
+            captureStream_.Write(attachments[i].colorAttachment);
+            captureStream_.Write(attachments[i].clearValue);
+        }
+    }
+
     profile_.commandBufferRecord.attachmentClears++;
 }
 
@@ -992,6 +1515,10 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
     {
         AssertRecording();
 
+        /* Binding a PSO whose asynchronous compilation has not finished yet blocks the calling thread */
+        if (!pipelineStateDbg.instance.IsReady())
+            LLGL_DBG_WARN(WarningType::ImproperState, "pipeline state is bound before its asynchronous compilation has finished; this will block until it is ready");
+
         /* Bind graphics pipeline and unbind compute pipeline */
         bindings_.pipelineState         = (&pipelineStateDbg);
         bindings_.anyShaderAttributes   = false;
@@ -1021,13 +1548,21 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
         }
         else
         {
-            if (auto computeShader = pipelineStateDbg.computeDesc.computeShader)
+            if (pipelineStateDbg.isRayTracingPSO)
             {
-                //TODO: store bound compute shader
+                if (states_.insideRenderPass)
+                    LLGL_DBG_ERROR(ErrorType::InvalidState, "ray tracing PSO must be bound outside a render pass");
             }
+            else
+            {
+                if (auto computeShader = pipelineStateDbg.computeDesc.computeShader)
+                {
+                    //TODO: store bound compute shader
+                }
 
-            if (states_.insideRenderPass)
-                LLGL_DBG_ERROR(ErrorType::InvalidState, "compute PSO must be bound outside a render pass");
+                if (states_.insideRenderPass)
+                    LLGL_DBG_ERROR(ErrorType::InvalidState, "compute PSO must be bound outside a render pass");
+            }
         }
 
         ResetBindingTable(bindings_.pipelineState->pipelineLayout);
@@ -1042,6 +1577,8 @@ void DbgCommandBuffer::SetPipelineState(PipelineState& pipelineState)
         instance.SetPipelineState(pipelineStateDbg.instance),
         "SetPipelineState(%s)", GetLabelOrDefault(pipelineStateDbg.label, "LLGL::PipelineState")
     );
+    if (!pipelineStateDbg.isRayTracingPSO)
+        LLGL_DBG_CAPTURE(CaptureOpcode::SetPipelineState, LLGL_DBG_CAPTURE_ID(&pipelineStateDbg));
 
     if (pipelineStateDbg.isGraphicsPSO)
         profile_.commandBufferRecord.graphicsPipelineBindings++;
@@ -1066,6 +1603,12 @@ void DbgCommandBuffer::SetBlendFactor(const float color[4])
         instance.SetBlendFactor(color),
         "SetBlendFactor(%f, %f, %f, %f)", color[0], color[1], color[2], color[3]
     );
+
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::SetBlendFactor);
+        captureStream_.WriteArray(color, 4);
+    }
 }
 
 void DbgCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
@@ -1085,6 +1628,24 @@ void DbgCommandBuffer::SetStencilReference(std::uint32_t reference, const Stenci
         instance.SetStencilReference(reference, stencilFace),
         "SetStencilReference(%u, {face})", reference
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetStencilReference, reference, stencilFace);
+}
+
+void DbgCommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertVariableRateShadingSupported();
+        if (rate > ShadingRate::Rate4x4)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid shading rate: 0x%02X", static_cast<unsigned>(rate));
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.SetShadingRate(rate),
+        "SetShadingRate(%u)", static_cast<unsigned>(rate)
+    );
+    LLGL_DBG_CAPTURE(CaptureOpcode::SetShadingRate, rate);
 }
 
 void DbgCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
@@ -1106,6 +1667,12 @@ void DbgCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::u
         instance.SetUniforms(first, data, dataSize),
         "SetUniforms(%u, %p, %u)", first, data, static_cast<std::uint32_t>(dataSize)
     );
+
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::SetUniforms, first, dataSize);
+        captureStream_.WriteBytes(data, dataSize);
+    }
 }
 
 /* ----- Queries ----- */
@@ -1119,6 +1686,10 @@ void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
         AssertRecording();
         AssertPrimaryCommandBuffer();
         ValidateQueryContext(queryHeapDbg, query);
+        if (queryHeapDbg.desc.type == QueryType::Timestamp)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot begin timestamp query [%u]; timestamps are only written with EndQuery", query);
+        if (queryHeapDbg.desc.type == QueryType::PipelineStatistics && queryScopeBatch_ != nullptr && queryScopeBatch_->recordStatistics)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot begin pipeline statistics query [%u] while statistics recording is enabled", query);
         if (DbgQueryHeap::State* state = GetAndValidateQueryState(queryHeapDbg, query))
         {
             if (*state == DbgQueryHeap::State::Busy)
@@ -1129,6 +1700,7 @@ void DbgCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 
     LLGL_DBG_START_TIMER("BeginQuery");
     instance.BeginQuery(queryHeapDbg.instance, query);
+    LLGL_DBG_CAPTURE(CaptureOpcode::BeginQuery, LLGL_DBG_CAPTURE_ID(&queryHeapDbg), query);
 
     profile_.commandBufferRecord.querySections++;
 }
@@ -1137,6 +1709,24 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto& queryHeapDbg = LLGL_DBG_CAST(DbgQueryHeap&, queryHeap);
 
+    if (queryHeapDbg.desc.type == QueryType::Timestamp)
+    {
+        /* Timestamps have no query section, so they are written without a matching BeginQuery */
+        if (LLGL_DBG_SOURCE())
+        {
+            AssertRecording();
+            AssertPrimaryCommandBuffer();
+            if (DbgQueryHeap::State* state = GetAndValidateQueryState(queryHeapDbg, query))
+                *state = DbgQueryHeap::State::Ready;
+        }
+
+        LLGL_DBG_COMMAND(instance.EndQuery(queryHeapDbg.instance, query), "EndQuery(Timestamp)");
+        LLGL_DBG_CAPTURE(CaptureOpcode::EndQuery, LLGL_DBG_CAPTURE_ID(&queryHeapDbg), query);
+
+        profile_.commandBufferRecord.querySections++;
+        return;
+    }
+
     if (LLGL_DBG_SOURCE())
     {
         AssertRecording();
@@ -1150,9 +1740,53 @@ void DbgCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     }
 
     instance.EndQuery(queryHeapDbg.instance, query);
+    LLGL_DBG_CAPTURE(CaptureOpcode::EndQuery, LLGL_DBG_CAPTURE_ID(&queryHeapDbg), query);
     LLGL_DBG_END_TIMER();
 }
 
+void DbgCommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapDbg = LLGL_DBG_CAST(DbgQueryHeap&, srcQueryHeap);
+    auto& dstBufferDbg = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertPrimaryCommandBuffer();
+        AssertQueryResolveSupported();
+
+        if (states_.insideRenderPass)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot resolve query data inside a render pass");
+        if (queryHeapDbg.desc.type == QueryType::TimeElapsed)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot resolve query data of type LLGL::QueryType::TimeElapsed; use two timestamp queries instead");
+
+        if (numQueries == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "no queries specified to resolve");
+        else if (ValidateQueryIndex(queryHeapDbg, firstQuery) && ValidateQueryIndex(queryHeapDbg, firstQuery + numQueries - 1))
+        {
+            for_subrange(query, firstQuery, firstQuery + numQueries)
+            {
+                if (queryHeapDbg.states[query] == DbgQueryHeap::State::Busy)
+                {
+                    LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot resolve query %u while it is still being recorded", query);
+                    break;
+                }
+            }
+        }
+
+        const std::uint64_t stride = (queryHeapDbg.desc.type == QueryType::PipelineStatistics ? sizeof(QueryPipelineStatistics) : sizeof(std::uint64_t));
+        ValidateBindBufferFlags(dstBufferDbg, BindFlags::CopyDst);
+        ValidateBufferRange(dstBufferDbg, dstOffset, stride * numQueries, "destination range");
+        ValidateAddressAlignment(dstOffset, 8, "<dstOffset> parameter");
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.ResolveQueryData(queryHeapDbg.instance, firstQuery, numQueries, dstBufferDbg.instance, dstOffset),
+        "ResolveQueryData(%u, %u, %s, %" PRIu64 ")", firstQuery, numQueries, GetResourceLabel(dstBuffer), dstOffset
+    );
+    LLGL_DBG_CAPTURE(CaptureOpcode::ResolveQueryData, LLGL_DBG_CAPTURE_ID(&queryHeapDbg), firstQuery, numQueries, LLGL_DBG_CAPTURE_ID(&dstBufferDbg), dstOffset);
+}
+
 void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     auto& queryHeapDbg = LLGL_DBG_CAST(DbgQueryHeap&, queryHeap);
@@ -1166,6 +1800,7 @@ void DbgCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t
 
     LLGL_DBG_START_TIMER("BeginRenderCondition");
     instance.BeginRenderCondition(queryHeapDbg.instance, query, mode);
+    LLGL_DBG_CAPTURE(CaptureOpcode::BeginRenderCondition, LLGL_DBG_CAPTURE_ID(&queryHeapDbg), query, mode);
 
     profile_.commandBufferRecord.renderConditionSections++;
 }
@@ -1178,6 +1813,7 @@ void DbgCommandBuffer::EndRenderCondition()
         AssertPrimaryCommandBuffer();
     }
     instance.EndRenderCondition();
+    LLGL_DBG_CAPTURE(CaptureOpcode::EndRenderCondition);
     LLGL_DBG_END_TIMER();
 }
 
@@ -1236,8 +1872,17 @@ void DbgCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
 
     LLGL_DBG_START_TIMER("BeginStreamOutput");
     if (!validationFailed)
+    {
         instance.BeginStreamOutput(numBuffers, bufferInstances);
 
+        if (isCaptured_)
+        {
+            CaptureCommand(CaptureOpcode::BeginStreamOutput, numBuffers);
+            for_range(i, numBuffers)
+                captureStream_.Write(LLGL_DBG_CAPTURE_ID(buffers[i]));
+        }
+    }
+
     profile_.commandBufferRecord.streamOutputSections++;
 }
 
@@ -1263,6 +1908,7 @@ void DbgCommandBuffer::EndStreamOutput()
     }
 
     instance.EndStreamOutput();
+    LLGL_DBG_CAPTURE(CaptureOpcode::EndStreamOutput);
     LLGL_DBG_END_TIMER();
 }
 
@@ -1277,6 +1923,7 @@ void DbgCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex
         instance.Draw(numVertices, firstVertex),
         "Draw(%u, %u)", numVertices, firstVertex
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::Draw, numVertices, firstVertex);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1290,6 +1937,7 @@ void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t first
         instance.DrawIndexed(numIndices, firstIndex),
         "DrawIndexed(%u, %u)", numIndices, firstIndex
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexed, numIndices, firstIndex);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1303,6 +1951,7 @@ void DbgCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t first
         instance.DrawIndexed(numIndices, firstIndex, vertexOffset),
         "DrawIndexed(%u, %u, %d)", numIndices, firstIndex, vertexOffset
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexedOffset, numIndices, firstIndex, vertexOffset);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1319,6 +1968,7 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
         instance.DrawInstanced(numVertices, firstVertex, numInstances),
         "DrawInstanced(%u, %u, %u)", numVertices, firstVertex, numInstances
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawInstanced, numVertices, firstVertex, numInstances);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1336,6 +1986,7 @@ void DbgCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t fi
         instance.DrawInstanced(numVertices, firstVertex, numInstances, firstInstance),
         "DrawInstanced(%u, %u, %u, %u)", numVertices, firstVertex, numInstances, firstInstance
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawInstancedOffset, numVertices, firstVertex, numInstances, firstInstance);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1352,6 +2003,7 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
         instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex),
         "DrawIndexedInstanced(%u, %u, %u)", numIndices, numInstances, firstIndex
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexedInstanced, numIndices, numInstances, firstIndex);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1368,6 +2020,7 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
         instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset),
         "DrawIndexedInstanced(%u, %u, %u, %d)", numIndices, numInstances, firstIndex, vertexOffset
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexedInstancedOffset, numIndices, numInstances, firstIndex, vertexOffset);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1385,6 +2038,7 @@ void DbgCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint3
         instance.DrawIndexedInstanced(numIndices, numInstances, firstIndex, vertexOffset, firstInstance),
         "DrawIndexedInstanced(%u, %u, %u, %d, %u)", numIndices, numInstances, firstIndex, vertexOffset, firstInstance
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexedInstancedFirst, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1405,6 +2059,7 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
         instance.DrawIndirect(bufferDbg.instance, offset),
         "DrawIndirect(%s, %" PRIu64 ")", GetResourceLabel(buffer), offset
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndirect, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1426,6 +2081,7 @@ void DbgCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::u
         instance.DrawIndirect(bufferDbg.instance, offset, numCommands, stride),
         "DrawIndirect(%s, %" PRIu64 ", %u, %u)", GetResourceLabel(buffer), offset, numCommands, stride
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndirectMulti, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset, numCommands, stride);
 
     profile_.commandBufferRecord.drawCommands += numCommands;
 }
@@ -1446,6 +2102,7 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
         instance.DrawIndexedIndirect(bufferDbg.instance, offset),
         "DrawIndexedIndirect(%s, %" PRIu64 ")", GetResourceLabel(buffer), offset
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexedIndirect, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset);
 
     profile_.commandBufferRecord.drawCommands++;
 }
@@ -1467,23 +2124,205 @@ void DbgCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
         instance.DrawIndexedIndirect(bufferDbg.instance, offset, numCommands, stride),
         "DrawIndexedIndirect(%s, %" PRIu64 ", %u, %u)", GetResourceLabel(buffer), offset, numCommands, stride
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexedIndirectMulti, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset, numCommands, stride);
 
     profile_.commandBufferRecord.drawCommands += numCommands;
 }
 
+void DbgCommandBuffer::DrawIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferDbg         = LLGL_DBG_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_DBG_CAST(DbgBuffer&, countBuffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertIndirectCountDrawingSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, stride*maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.DrawIndirectCount(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride),
+        "DrawIndirectCount(%s, %" PRIu64 ", %s, %" PRIu64 ", %u, %u)",
+        GetResourceLabel(buffer), offset, GetResourceLabel(countBuffer), countOffset, maxNumCommands, stride
+    );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndirectCount, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset, LLGL_DBG_CAPTURE_ID(&countBufferDbg), countOffset, maxNumCommands, stride);
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferDbg         = LLGL_DBG_CAST(DbgBuffer&, buffer);
+    auto& countBufferDbg    = LLGL_DBG_CAST(DbgBuffer&, countBuffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertIndirectCountDrawingSupported();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBindBufferFlags(countBufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, stride*maxNumCommands);
+        ValidateBufferRange(countBufferDbg, countOffset, sizeof(std::uint32_t));
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.DrawIndexedIndirectCount(bufferDbg.instance, offset, countBufferDbg.instance, countOffset, maxNumCommands, stride),
+        "DrawIndexedIndirectCount(%s, %" PRIu64 ", %s, %" PRIu64 ", %u, %u)",
+        GetResourceLabel(buffer), offset, GetResourceLabel(countBuffer), countOffset, maxNumCommands, stride
+    );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawIndexedIndirectCount, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset, LLGL_DBG_CAPTURE_ID(&countBufferDbg), countOffset, maxNumCommands, stride);
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
 void DbgCommandBuffer::DrawStreamOutput()
 {
     if (LLGL_DBG_SOURCE())
     {
-        AssertStreamOutputSupported();
+        /* Compute stream-output buffers are drawn with an indirect draw command instead of native stream-outputs */
+        if (IsComputeStreamOutputBound())
+            AssertIndirectDrawingSupported();
+        else
+            AssertStreamOutputSupported();
         ValidateDrawStreamOutputCmd();
     }
 
     LLGL_DBG_COMMAND( instance.DrawStreamOutput(), "DrawStreamOutput()" );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawStreamOutput);
+
+    profile_.commandBufferRecord.drawCommands++;
+}
+
+void DbgCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertMeshShadersSupported();
+        ValidateDrawMeshTasksCmd();
+        if (numWorkGroupsX * numWorkGroupsY * numWorkGroupsZ == 0)
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "mesh task work group size has volume of 0 units");
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.DrawMeshTasks(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ),
+        "DrawMeshTasks(%u, %u, %u)", numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ
+    );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawMeshTasks, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 
     profile_.commandBufferRecord.drawCommands++;
 }
 
+void DbgCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferDbg = LLGL_DBG_CAST(DbgBuffer&, buffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertMeshShadersSupported();
+        ValidateDrawMeshTasksCmd();
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, stride*numCommands);
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        ValidateAddressAlignment(stride, 4, "<stride> parameter");
+    }
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.DrawMeshTasksIndirect(bufferDbg.instance, offset, numCommands, stride),
+        "DrawMeshTasksIndirect(%s, %" PRIu64 ", %u, %u)", GetResourceLabel(buffer), offset, numCommands, stride
+    );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DrawMeshTasksIndirect, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset, numCommands, stride);
+
+    profile_.commandBufferRecord.drawCommands += numCommands;
+}
+
+void DbgCommandBuffer::DispatchTiles()
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertTileShadersSupported();
+        ValidateDispatchTilesCmd();
+    }
+
+    LLGL_DBG_COMMAND( instance.DispatchTiles(), "DispatchTiles()" );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DispatchTiles);
+
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+void DbgCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    commandDesc,
+    Buffer&                             buffer,
+    std::uint64_t                       offset,
+    Buffer*                             countBuffer,
+    std::uint64_t                       countOffset,
+    std::uint32_t                       maxNumCommands)
+{
+    auto& bufferDbg         = LLGL_DBG_CAST(DbgBuffer&, buffer);
+    auto* countBufferDbg    = LLGL_DBG_CAST(DbgBuffer*, countBuffer);
+
+    const IndirectArgumentType commandType = (commandDesc.arguments.empty() ? IndirectArgumentType::Draw : commandDesc.arguments.back().type);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertIndirectStateChangesSupported();
+        ValidateIndirectCommand(commandDesc);
+        ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
+        ValidateBufferRange(bufferDbg, offset, static_cast<std::uint64_t>(commandDesc.stride)*maxNumCommands);
+        ValidateAddressAlignment(offset, 4, "<offset> parameter");
+        if (countBufferDbg != nullptr)
+        {
+            ValidateBindBufferFlags(*countBufferDbg, BindFlags::IndirectBuffer);
+            ValidateBufferRange(*countBufferDbg, countOffset, sizeof(std::uint32_t));
+            ValidateAddressAlignment(countOffset, 4, "<countOffset> parameter");
+        }
+        if (commandType == IndirectArgumentType::Dispatch && LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateBindingTable();
+    }
+
+    if (commandType == IndirectArgumentType::Dispatch)
+        BeginStatisticsSection("ExecuteIndirect");
+
+    LLGL_DBG_COMMAND_EXT(
+        instance.ExecuteIndirect(commandDesc, bufferDbg.instance, offset, (countBufferDbg != nullptr ? &(countBufferDbg->instance) : nullptr), countOffset, maxNumCommands),
+        "ExecuteIndirect(%u arguments, %s, %" PRIu64 ", %s, %" PRIu64 ", %u)",
+        static_cast<std::uint32_t>(commandDesc.arguments.size()), GetResourceLabel(buffer), offset, GetResourceLabel(countBuffer), countOffset, maxNumCommands
+    );
+
+    if (isCaptured_)
+    {
+        CaptureCommand(
+            CaptureOpcode::ExecuteIndirect, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset, LLGL_DBG_CAPTURE_ID(countBufferDbg), countOffset, maxNumCommands,
+            commandDesc.stride, static_cast<std::uint32_t>(commandDesc.arguments.size())
+        );
+        captureStream_.WriteArray(commandDesc.arguments.data(), commandDesc.arguments.size());
+    }
+
+    if (commandType == IndirectArgumentType::Dispatch)
+        profile_.commandBufferRecord.dispatchCommands += maxNumCommands;
+    else
+        profile_.commandBufferRecord.drawCommands += maxNumCommands;
+}
+
 /* ----- Compute ----- */
 
 void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1493,17 +2332,24 @@ void DbgCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numW
         if (numWorkGroupsX * numWorkGroupsY * numWorkGroupsZ == 0)
             LLGL_DBG_WARN(WarningType::PointlessOperation, "thread group size has volume of 0 units");
 
+        if (desc.queueType == CommandQueueType::Copy)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot dispatch compute work with command buffer for copy queue");
+
         AssertComputePipelineBound();
         ValidateThreadGroupLimit(numWorkGroupsX, limits_.maxComputeShaderWorkGroups[0]);
         ValidateThreadGroupLimit(numWorkGroupsY, limits_.maxComputeShaderWorkGroups[1]);
         ValidateThreadGroupLimit(numWorkGroupsZ, limits_.maxComputeShaderWorkGroups[2]);
-        ValidateBindingTable();
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateBindingTable();
     }
 
+    BeginStatisticsSection("Dispatch");
+
     LLGL_DBG_COMMAND_EXT(
         instance.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ),
         "Dispatch(%u, %u, %u)", numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::Dispatch, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
 
     profile_.commandBufferRecord.dispatchCommands++;
 }
@@ -1517,13 +2363,85 @@ void DbgCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
         ValidateBindBufferFlags(bufferDbg, BindFlags::IndirectBuffer);
         ValidateBufferRange(bufferDbg, offset, sizeof(DispatchIndirectArguments));
         ValidateAddressAlignment(offset, 4, "<offset> parameter");
-        ValidateBindingTable();
+        if (LLGL_DBG_VALIDATE(ResourceBindings))
+            ValidateBindingTable();
     }
 
+    BeginStatisticsSection("DispatchIndirect");
+
     LLGL_DBG_COMMAND_EXT(
         instance.DispatchIndirect(bufferDbg.instance, offset),
         "DispatchIndirect(%s, %" PRIu64 ")", GetResourceLabel(buffer), offset
     );
+    LLGL_DBG_CAPTURE(CaptureOpcode::DispatchIndirect, LLGL_DBG_CAPTURE_ID(&bufferDbg), offset);
+
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+/* ----- Ray Tracing ----- */
+
+void DbgCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 scratchBuffer,
+    const AccelerationStructureDescriptor&  desc,
+    Buffer*                                 srcBuffer)
+{
+    auto& dstBufferDbg      = LLGL_DBG_CAST(DbgBuffer&, dstBuffer);
+    auto& scratchBufferDbg  = LLGL_DBG_CAST(DbgBuffer&, scratchBuffer);
+    auto* srcBufferDbg      = LLGL_DBG_CAST(DbgBuffer*, srcBuffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertRayTracingSupported();
+        ValidateBuildAccelerationStructureCmd(dstBufferDbg, scratchBufferDbg, desc, srcBufferDbg);
+    }
+
+    /* Replace debug wrappers of all buffers that are referenced by the descriptor */
+    std::vector<AccelerationStructureGeometryDescriptor> geometriesInstance(desc.geometries.begin(), desc.geometries.end());
+    for (AccelerationStructureGeometryDescriptor& geometry : geometriesInstance)
+    {
+        geometry.vertexBuffer   = DbgGetInstance<DbgBuffer>(geometry.vertexBuffer);
+        geometry.indexBuffer    = DbgGetInstance<DbgBuffer>(geometry.indexBuffer);
+    }
+
+    std::vector<AccelerationStructureInstance> instancesInstance(desc.instances.begin(), desc.instances.end());
+    for (AccelerationStructureInstance& instance : instancesInstance)
+        instance.accelerationStructure = DbgGetInstance<DbgBuffer>(instance.accelerationStructure);
+
+    AccelerationStructureDescriptor instanceDesc = desc;
+    {
+        instanceDesc.geometries = geometriesInstance;
+        instanceDesc.instances  = instancesInstance;
+    }
+
+    /* Ray tracing commands are not part of the capture format, so they are not recorded */
+    LLGL_DBG_COMMAND_EXT(
+        instance.BuildAccelerationStructure(dstBufferDbg.instance, scratchBufferDbg.instance, instanceDesc, (srcBufferDbg != nullptr ? &(srcBufferDbg->instance) : nullptr)),
+        "BuildAccelerationStructure(%s, %s)", GetResourceLabel(dstBuffer), GetResourceLabel(scratchBuffer)
+    );
+
+    dstBufferDbg.initialized = true;
+
+    profile_.commandBufferRecord.dispatchCommands++;
+}
+
+void DbgCommandBuffer::DispatchRays(std::uint32_t width, std::uint32_t height, std::uint32_t depth)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        AssertRecording();
+        AssertRayTracingSupported();
+        ValidateDispatchRaysCmd(width, height, depth);
+    }
+
+    BeginStatisticsSection("DispatchRays");
+
+    /* Ray tracing commands are not part of the capture format, so they are not recorded */
+    LLGL_DBG_COMMAND_EXT(
+        instance.DispatchRays(width, height, depth),
+        "DispatchRays(%u, %u, %u)", width, height, depth
+    );
 
     profile_.commandBufferRecord.dispatchCommands++;
 }
@@ -1546,11 +2464,24 @@ void DbgCommandBuffer::PushDebugGroup(const char* name)
     UTF8String annotation = UTF8String::Printf("PushDebugGroup(%s)", name);
     LLGL_DBG_START_TIMER((StringLiteral{ annotation.c_str(), CopyTag{} }));
     instance.PushDebugGroup(name);
+
+    if (isCaptured_)
+    {
+        CaptureCommand(CaptureOpcode::PushDebugGroup);
+        captureStream_.WriteString(name);
+    }
+
+    if (queryScopeBatch_ != nullptr)
+        queryScopePool_.PushScope(*queryScopeBatch_, StringLiteral{ name, CopyTag{} });
 }
 
 void DbgCommandBuffer::PopDebugGroup()
 {
+    if (queryScopeBatch_ != nullptr)
+        queryScopePool_.PopScope(*queryScopeBatch_);
+
     instance.PopDebugGroup();
+    LLGL_DBG_CAPTURE(CaptureOpcode::PopDebugGroup);
     LLGL_DBG_END_TIMER();
 
     debugGroups_.pop();
@@ -1584,6 +2515,23 @@ void DbgCommandBuffer::FlushProfile(FrameProfile& outProfile)
     profile_ = {};
 }
 
+void DbgCommandBuffer::BeginStatisticsSection(const char* defaultAnnotation)
+{
+    /* Begin new statistics section unless one is already open, e.g. for consecutive compute dispatches */
+    if (queryScopeBatch_ != nullptr && queryScopeBatch_->recordStatistics && !queryScopeBatch_->isStatisticsOpen)
+    {
+        const char* annotation = (debugGroups_.empty() ? defaultAnnotation : debugGroups_.top().c_str());
+        queryScopePool_.BeginStatistics(*queryScopeBatch_, StringLiteral{ annotation, CopyTag{} });
+    }
+}
+
+void DbgCommandBuffer::SubmitQueryScopes()
+{
+    /* Only the first submission of a recording is measured, since all further submissions write to the same queries */
+    queryScopePool_.SubmitBatch(queryScopeBatch_);
+    queryScopeBatch_ = nullptr;
+}
+
 void DbgCommandBuffer::ValidateSubmit()
 {
     for (const SwapChainFramePair& pair : records_.swapChainFrames)
@@ -1601,6 +2549,8 @@ void DbgCommandBuffer::ValidateSubmit()
 }
 
 #undef LLGL_DBG_COMMAND
+#undef LLGL_DBG_CAPTURE
+#undef LLGL_DBG_CAPTURE_ID
 
 
 /*
@@ -1623,6 +2573,14 @@ void DbgCommandBuffer::ValidateEndOfRecording()
     {
         if (!states_.recording)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot end recording of command buffer while no recording is currently active");
+        if (states_.numSplitBarriers > 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot end recording of command buffer with %u pending split resource barrier(s); missing EndResourceBarrier() invocation",
+                states_.numSplitBarriers
+            );
+        }
         states_.recording           = false;
         states_.finishedRecording   = true;
     }
@@ -1651,6 +2609,22 @@ void DbgCommandBuffer::ValidateCommandBufferForExecute(const States& cmdBufferSt
     }
 }
 
+void DbgCommandBuffer::ValidateRenderPassForExecute(const DbgCommandBuffer& secondaryCmdBuffer)
+{
+    /* Secondary command buffers don't depend on their render pass object, but their formats must be compatible with the active render pass */
+    if (secondaryCmdBuffer.hasInheritanceRenderPass_ && states_.insideRenderPass && bindings_.renderPass != nullptr)
+    {
+        if (!AreRenderPassesCompatible(secondaryCmdBuffer.inheritanceRenderPassDesc_, bindings_.renderPass->desc))
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "cannot run Execute() on %s with inheritance render pass that is incompatible with the active render pass; attachment formats and samples must match",
+                GetLabelOrDefault(secondaryCmdBuffer.label, "LLGL::CommandBuffer")
+            );
+        }
+    }
+}
+
 void DbgCommandBuffer::ValidateGenerateMips(DbgTexture& textureDbg, const TextureSubresource* subresource)
 {
     if ((textureDbg.desc.bindFlags & BindFlags::ColorAttachment) == 0)
@@ -1709,6 +2683,61 @@ void DbgCommandBuffer::ValidateGenerateMips(DbgTexture& textureDbg, const Textur
     }
 }
 
+void DbgCommandBuffer::ValidateBufferCopyRegions(
+    DbgBuffer&              dstBufferDbg,
+    DbgBuffer&              srcBufferDbg,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    for_range(i, numRegions)
+    {
+        ValidateBufferRange(dstBufferDbg, regions[i].dstOffset, regions[i].size, "destination range");
+        ValidateBufferRange(srcBufferDbg, regions[i].srcOffset, regions[i].size, "source range");
+    }
+
+    /* Sort destination ranges by offset to find overlapping regions in O(n log n) */
+    std::vector<const BufferCopyRegion*> sortedRegions(numRegions);
+    for_range(i, numRegions)
+        sortedRegions[i] = &regions[i];
+
+    std::sort(
+        sortedRegions.begin(), sortedRegions.end(),
+        [](const BufferCopyRegion* lhs, const BufferCopyRegion* rhs)
+        {
+            return (lhs->dstOffset < rhs->dstOffset);
+        }
+    );
+
+    for_subrange(i, 1, numRegions)
+    {
+        const BufferCopyRegion& prev = *sortedRegions[i - 1];
+        const BufferCopyRegion& next = *sortedRegions[i];
+        if (prev.dstOffset + prev.size > next.dstOffset)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "overlapping destination ranges in buffer copy regions: [%" PRIu64 ", %" PRIu64 ") and [%" PRIu64 ", %" PRIu64 ")",
+                prev.dstOffset, prev.dstOffset + prev.size, next.dstOffset, next.dstOffset + next.size
+            );
+            break;
+        }
+    }
+}
+
+void DbgCommandBuffer::ValidateSamplerFeedbackTexture(DbgTexture& textureDbg, const char* commandName)
+{
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot %s sampler feedback inside a render pass", commandName);
+    if (textureDbg.feedbackDesc.pairedTexture == nullptr)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot %s sampler feedback of texture '%s' that was not created with LLGL::RenderSystem::CreateSamplerFeedbackTexture",
+            commandName, GetResourceLabel(textureDbg)
+        );
+    }
+}
+
 void DbgCommandBuffer::ValidateViewport(const Viewport& viewport)
 {
     if (viewport.width < 0.0f || viewport.height < 0.0f)
@@ -1759,8 +2788,23 @@ void DbgCommandBuffer::ValidateAttachmentClear(const AttachmentClear& attachment
             }
         }
     }
-    else
-        LLGL_DBG_ERROR(ErrorType::InvalidState, "no render target is bound");
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "no render target is bound");
+}
+
+void DbgCommandBuffer::ValidateClearAfterLoad(long flags)
+{
+    /* Only report the first clear after the render pass began and before any draw command was recorded */
+    const long redundantLoads = (states_.loadedAttachments & flags);
+    if (redundantLoads != 0 && profile_.commandBufferRecord.drawCommands == states_.drawsAtRenderPass)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperState,
+            "attachments are cleared right after they have been loaded by the render pass; "
+            "use AttachmentLoadOp::Clear or AttachmentLoadOp::Undefined to avoid redundant memory loads on tile-based GPUs"
+        );
+    }
+    states_.loadedAttachments = 0;
 }
 
 void DbgCommandBuffer::ValidateVertexLayout()
@@ -1787,6 +2831,10 @@ void DbgCommandBuffer::ValidateVertexLayoutAttributes(const ArrayView<VertexAttr
 
     for (std::uint32_t bufferIndex = 0; attribIndex < shaderVertexAttribs.size() && bufferIndex < numVertexBuffers; ++bufferIndex)
     {
+        /* Transient buffers have no vertex format, so their layout is only defined by the pipeline state */
+        if (IsTransientBufferWrapper(vertexBuffers[bufferIndex]))
+            return;
+
         /* Compare remaining shader attributes with next vertex buffer attributes */
         const auto& bufferVertexAttribs = vertexBuffers[bufferIndex]->desc.vertexAttribs;
 
@@ -1914,80 +2962,150 @@ void DbgCommandBuffer::ValidateInstanceID(std::uint32_t firstInstance)
 void DbgCommandBuffer::ValidateDrawCmd(
     std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    const long validationFlags = debugger_->GetValidationFlags();
+
     AssertRecording();
     AssertInsideRenderPass();
     AssertGraphicsPipelineBound();
-    AssertVertexBufferBound();
     AssertViewportBound();
     ValidateDynamicStates();
-    ValidateVertexLayout();
-    ValidateNumVertices(numVertices);
-    ValidateNumInstances(numInstances);
-    ValidateVertexID(firstVertex);
-    ValidateInstanceID(firstInstance);
-    ValidateBindingTable();
     ValidateBlendStates();
 
-    if (bindings_.numVertexBuffers > 0 && bindings_.anyShaderAttributes)
-        ValidateVertexLimit(numVertices + firstVertex, static_cast<std::uint32_t>(bindings_.vertexBuffers[0]->elements));
+    if ((validationFlags & ValidationFlags::ResourceBindings) != 0)
+    {
+        AssertVertexBufferBound();
+        ValidateVertexLayout();
+        ValidateBindingTable();
+    }
+
+    if ((validationFlags & ValidationFlags::DrawRanges) != 0)
+    {
+        ValidateNumVertices(numVertices);
+        ValidateNumInstances(numInstances);
+        ValidateVertexID(firstVertex);
+        ValidateInstanceID(firstInstance);
+
+        if (bindings_.numVertexBuffers > 0 && bindings_.anyShaderAttributes)
+            ValidateVertexLimit(numVertices + firstVertex, static_cast<std::uint32_t>(bindings_.vertexBuffers[0]->elements));
+    }
 }
 
 void DbgCommandBuffer::ValidateDrawIndexedCmd(
     std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    const long validationFlags = debugger_->GetValidationFlags();
+
     AssertRecording();
     AssertInsideRenderPass();
     AssertGraphicsPipelineBound();
-    AssertVertexBufferBound();
-    AssertIndexBufferBound();
     AssertViewportBound();
     ValidateDynamicStates();
-    ValidateVertexLayout();
-    ValidateNumVertices(numVertices);
-    ValidateNumInstances(numInstances);
-    ValidateInstanceID(firstInstance);
-    ValidateBindingTable();
     ValidateBlendStates();
 
-    if (bindings_.indexBuffer)
+    if ((validationFlags & ValidationFlags::ResourceBindings) != 0)
     {
-        if (bindings_.indexBufferFormatSize > 0)
-        {
-            ValidateVertexLimit(
-                numVertices + firstIndex,
-                static_cast<std::uint32_t>((bindings_.indexBuffer->desc.size - bindings_.indexBufferOffset) / bindings_.indexBufferFormatSize)
-            );
-        }
-        else
+        AssertVertexBufferBound();
+        AssertIndexBufferBound();
+        ValidateVertexLayout();
+        ValidateBindingTable();
+    }
+
+    if ((validationFlags & ValidationFlags::DrawRanges) != 0)
+    {
+        ValidateNumVertices(numVertices);
+        ValidateNumInstances(numInstances);
+        ValidateInstanceID(firstInstance);
+
+        if (bindings_.indexBuffer)
         {
-            ValidateVertexLimit(
-                numVertices + firstIndex,
-                static_cast<std::uint32_t>(bindings_.indexBuffer->elements)
-            );
+            if (bindings_.indexBufferFormatSize > 0)
+            {
+                ValidateVertexLimit(
+                    numVertices + firstIndex,
+                    static_cast<std::uint32_t>((bindings_.indexBuffer->desc.size - bindings_.indexBufferOffset) / bindings_.indexBufferFormatSize)
+                );
+            }
+            else
+            {
+                ValidateVertexLimit(
+                    numVertices + firstIndex,
+                    static_cast<std::uint32_t>(bindings_.indexBuffer->elements)
+                );
+            }
         }
     }
 }
 
+void DbgCommandBuffer::ValidateDrawMeshTasksCmd()
+{
+    AssertRecording();
+    AssertInsideRenderPass();
+    AssertViewportBound();
+    ValidateDynamicStates();
+    ValidateBlendStates();
+
+    /* Mesh pipelines don't use any vertex input, so only the binding table must be validated */
+    if (DbgPipelineState* pipelineStateDbg = AssertAndGetGraphicsPSO())
+    {
+        if (pipelineStateDbg->graphicsDesc.meshShader == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot draw mesh tasks with graphics pipeline that has no mesh shader");
+    }
+
+    if (LLGL_DBG_VALIDATE(ResourceBindings))
+        ValidateBindingTable();
+}
+
+void DbgCommandBuffer::ValidateDispatchTilesCmd()
+{
+    AssertRecording();
+    AssertInsideRenderPass();
+
+    if (DbgPipelineState* pipelineStateDbg = AssertAndGetGraphicsPSO())
+    {
+        if (pipelineStateDbg->graphicsDesc.tileShader == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot dispatch tiles with graphics pipeline that has no tile shader");
+    }
+
+    if (LLGL_DBG_VALIDATE(ResourceBindings))
+        ValidateBindingTable();
+}
+
 void DbgCommandBuffer::ValidateDrawStreamOutputCmd()
 {
     AssertRecording();
     AssertInsideRenderPass();
     AssertGraphicsPipelineBound();
-    AssertVertexBufferBound();
     AssertViewportBound();
     ValidateDynamicStates();
-    ValidateVertexLayout();
-    ValidateBindingTable();
     ValidateBlendStates();
 
+    if (LLGL_DBG_VALIDATE(ResourceBindings))
+    {
+        AssertVertexBufferBound();
+        ValidateVertexLayout();
+        ValidateBindingTable();
+    }
+
     /* Don't check for empty vertex buffer arrays here, this is already done in AssertVertexBufferBound() */
     if (bindings_.numVertexBuffers == 1)
     {
-        if ((bindings_.vertexBuffers[0]->desc.bindFlags & BindFlags::StreamOutputBuffer) == 0)
+        const long bindFlags = bindings_.vertexBuffers[0]->desc.bindFlags;
+        if ((bindFlags & BindFlags::ComputeStreamOutput) != 0)
+        {
+            if (!IsComputeStreamOutputBound())
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidState,
+                    "compute stream-output buffer must be bound with SetVertexBuffer() for automatic draw commands, not with SetVertexBufferArray()"
+                );
+            }
+        }
+        else if ((bindFlags & BindFlags::StreamOutputBuffer) == 0)
         {
             LLGL_DBG_ERROR(
                 ErrorType::InvalidState,
-                "bound vertex buffer must have been created with bind flag 'LLGL::BindFlags::StreamOutputBuffer' for automatic draw commands"
+                "bound vertex buffer must have been created with bind flag 'LLGL::BindFlags::StreamOutputBuffer' or "
+                "'LLGL::BindFlags::ComputeStreamOutput' for automatic draw commands"
             );
         }
     }
@@ -2001,6 +3119,121 @@ void DbgCommandBuffer::ValidateDrawStreamOutputCmd()
     }
 }
 
+bool DbgCommandBuffer::IsComputeStreamOutputBound() const
+{
+    return
+    (
+        bindings_.numVertexBuffers == 1                         &&
+        bindings_.vertexBuffers == bindings_.vertexBufferStore  &&
+        (bindings_.vertexBufferStore[0]->desc.bindFlags & BindFlags::ComputeStreamOutput) != 0
+    );
+}
+
+void DbgCommandBuffer::ValidateBuildAccelerationStructureCmd(
+    DbgBuffer&                              dstBufferDbg,
+    DbgBuffer&                              scratchBufferDbg,
+    const AccelerationStructureDescriptor&  desc,
+    DbgBuffer*                              srcBufferDbg)
+{
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot build acceleration structure inside a render pass");
+
+    /* Validate destination and scratch buffers */
+    ValidateBindBufferFlags(dstBufferDbg, BindFlags::AccelerationStructure);
+    ValidateBindBufferFlags(scratchBufferDbg, BindFlags::Storage);
+
+    if ((desc.flags & AccelerationStructureFlags::PreferFastTrace) != 0 && (desc.flags & AccelerationStructureFlags::PreferFastBuild) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot build acceleration structure with both PreferFastTrace and PreferFastBuild flags");
+
+    if (srcBufferDbg != nullptr)
+    {
+        ValidateBindBufferFlags(*srcBufferDbg, BindFlags::AccelerationStructure);
+        if ((desc.flags & AccelerationStructureFlags::AllowUpdate) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot update acceleration structure that was not built with AccelerationStructureFlags::AllowUpdate");
+        if (!srcBufferDbg->initialized)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot update acceleration structure from source buffer that has not been built");
+    }
+
+    if (desc.type == AccelerationStructureType::BottomLevel)
+    {
+        if (desc.geometries.empty())
+            LLGL_DBG_WARN(WarningType::PointlessOperation, "bottom-level acceleration structure has no geometries");
+
+        for_range(i, desc.geometries.size())
+        {
+            const AccelerationStructureGeometryDescriptor& geometry = desc.geometries[i];
+
+            /* Validate vertex buffer */
+            if (auto* vertexBufferDbg = LLGL_DBG_CAST(DbgBuffer*, geometry.vertexBuffer))
+            {
+                ValidateBindBufferFlags(*vertexBufferDbg, BindFlags::VertexBuffer);
+                if (geometry.numVertices > 0)
+                    ValidateBufferRange(*vertexBufferDbg, geometry.vertexOffset, static_cast<std::uint64_t>(geometry.numVertices - 1) * geometry.vertexStride + GetFormatAttribs(geometry.vertexFormat).bitSize / 8, "vertex range");
+            }
+            else
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "missing vertex buffer in acceleration structure geometry [%zu]", i);
+
+            if (geometry.vertexFormat != Format::RGB32Float  &&
+                geometry.vertexFormat != Format::RG32Float   &&
+                geometry.vertexFormat != Format::RGBA16Float &&
+                geometry.vertexFormat != Format::RG16Float)
+            {
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid vertex format for acceleration structure geometry [%zu]: LLGL::Format::%s", i, ToString(geometry.vertexFormat));
+            }
+
+            /* Validate optional index buffer */
+            if (auto* indexBufferDbg = LLGL_DBG_CAST(DbgBuffer*, geometry.indexBuffer))
+            {
+                ValidateBindBufferFlags(*indexBufferDbg, BindFlags::IndexBuffer);
+                ValidateIndexType(geometry.indexFormat);
+                ValidateBufferRange(*indexBufferDbg, geometry.indexOffset, static_cast<std::uint64_t>(geometry.numIndices) * (GetFormatAttribs(geometry.indexFormat).bitSize / 8), "index range");
+                if (geometry.numIndices % 3 != 0)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "number of indices in acceleration structure geometry [%zu] is not a multiple of 3: %u", i, geometry.numIndices);
+            }
+            else if (geometry.numVertices % 3 != 0)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "number of non-indexed vertices in acceleration structure geometry [%zu] is not a multiple of 3: %u", i, geometry.numVertices);
+        }
+    }
+    else
+    {
+        for_range(i, desc.instances.size())
+        {
+            if (auto* blasDbg = LLGL_DBG_CAST(DbgBuffer*, desc.instances[i].accelerationStructure))
+            {
+                ValidateBindBufferFlags(*blasDbg, BindFlags::AccelerationStructure);
+                if (!blasDbg->initialized)
+                    LLGL_DBG_ERROR(ErrorType::InvalidState, "acceleration structure instance [%zu] refers to bottom-level acceleration structure that has not been built", i);
+                if (blasDbg == &dstBufferDbg)
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "acceleration structure instance [%zu] refers to the destination buffer", i);
+            }
+            else
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "missing bottom-level acceleration structure in instance [%zu]", i);
+        }
+    }
+}
+
+void DbgCommandBuffer::ValidateDispatchRaysCmd(std::uint32_t width, std::uint32_t height, std::uint32_t depth)
+{
+    if (static_cast<std::uint64_t>(width) * height * depth == 0)
+        LLGL_DBG_WARN(WarningType::PointlessOperation, "ray dispatch has volume of 0 units");
+    else if (static_cast<std::uint64_t>(width) * height * depth > (1u << 30))
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "ray dispatch of %ux%ux%u exceeds the limit of 2^30 rays", width, height, depth);
+
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot dispatch rays inside a render pass");
+
+    if (DbgPipelineState* pipelineStateDbg = bindings_.pipelineState)
+    {
+        if (!pipelineStateDbg->isRayTracingPSO)
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot dispatch rays without ray tracing pipeline");
+    }
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "no ray tracing pipeline is bound; missing call to <LLGL::CommandBuffer::SetPipelineState>");
+
+    if (LLGL_DBG_VALIDATE(ResourceBindings))
+        ValidateBindingTable();
+}
+
 void DbgCommandBuffer::ValidateVertexLimit(std::uint32_t vertexCount, std::uint32_t vertexLimit)
 {
     if (vertexCount > vertexLimit)
@@ -2073,6 +3306,8 @@ static const char* BindFlagToString(long bindFlag)
         case BindFlags::CombinedSampler:        return "CombinedSampler";
         case BindFlags::CopySrc:                return "CopySrc";
         case BindFlags::CopyDst:                return "CopyDst";
+        case BindFlags::AccelerationStructure:  return "AccelerationStructure";
+        case BindFlags::ComputeStreamOutput:    return "ComputeStreamOutput";
         default:                                return nullptr;
     }
 }
@@ -2346,6 +3581,30 @@ void DbgCommandBuffer::ValidateMemoryBarrierResourceFlags(ResourceType resourceT
     }
 }
 
+void DbgCommandBuffer::ValidateSplitResourceBarrier(const char* funcName)
+{
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot use split resource barrier inside a render pass: %s()", funcName);
+}
+
+void DbgCommandBuffer::ValidateAliasingBarrier(const DbgTexture* textureBeforeDbg, const DbgTexture* textureAfterDbg)
+{
+    if (states_.insideRenderPass)
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot use aliasing barrier inside a render pass");
+
+    if (textureBeforeDbg != nullptr && textureBeforeDbg->placementHeap == nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot use aliasing barrier with texture that has not been placed into a placement heap: textureBefore");
+    if (textureAfterDbg != nullptr && textureAfterDbg->placementHeap == nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot use aliasing barrier with texture that has not been placed into a placement heap: textureAfter");
+
+    if (textureBeforeDbg != nullptr && textureAfterDbg != nullptr &&
+        textureBeforeDbg->placementHeap != nullptr && textureAfterDbg->placementHeap != nullptr &&
+        textureBeforeDbg->placementHeap != textureAfterDbg->placementHeap)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot use aliasing barrier between textures of different placement heaps");
+    }
+}
+
 void DbgCommandBuffer::ValidateStageFlags(long stageFlags, long validFlags)
 {
     if ((stageFlags & validFlags) == 0)
@@ -2582,6 +3841,94 @@ void DbgCommandBuffer::ValidateUniforms(const DbgPipelineLayout& pipelineLayoutD
     }
 }
 
+void DbgCommandBuffer::ValidateIndirectCommand(const IndirectCommandDescriptor& commandDesc)
+{
+    if (commandDesc.arguments.empty())
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot execute indirect commands without arguments");
+        return;
+    }
+
+    /* Accumulate size of all arguments; only the last argument must be a draw or dispatch command */
+    std::uint32_t commandSize = 0;
+
+    for_range(i, commandDesc.arguments.size())
+    {
+        const IndirectArgumentDescriptor& argumentDesc = commandDesc.arguments[i];
+        const bool isLast = (i + 1 == commandDesc.arguments.size());
+
+        if (argumentDesc.type == IndirectArgumentType::Uniforms)
+        {
+            if (isLast)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "last indirect argument must be a draw or dispatch command, but uniforms were specified");
+
+            const DbgPipelineState* pso = bindings_.pipelineState;
+            if (pso == nullptr || pso->pipelineLayout == nullptr)
+            {
+                LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot execute indirect commands with uniforms without pipeline state");
+                continue;
+            }
+
+            const auto& uniforms = pso->pipelineLayout->desc.uniforms;
+            if (argumentDesc.numUniforms == 0 || argumentDesc.first + argumentDesc.numUniforms > uniforms.size())
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "indirect argument [%zu] specifies uniforms [%u, %u) but upper bound is %zu",
+                    i, argumentDesc.first, argumentDesc.first + argumentDesc.numUniforms, uniforms.size()
+                );
+                continue;
+            }
+
+            for_range(j, argumentDesc.numUniforms)
+            {
+                const UniformDescriptor& uniformDesc = uniforms[argumentDesc.first + j];
+                commandSize += GetUniformTypeSize(uniformDesc.type, uniformDesc.arraySize);
+            }
+        }
+        else
+        {
+            if (!isLast)
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "indirect argument [%zu] is a draw or dispatch command but only the last argument can be one", i);
+
+            switch (argumentDesc.type)
+            {
+                case IndirectArgumentType::Draw:
+                    AssertIndirectDrawingSupported();
+                    commandSize += sizeof(DrawIndirectArguments);
+                    break;
+                case IndirectArgumentType::DrawIndexed:
+                    AssertIndirectDrawingSupported();
+                    commandSize += sizeof(DrawIndexedIndirectArguments);
+                    break;
+                case IndirectArgumentType::DrawMeshTasks:
+                    AssertMeshShadersSupported();
+                    ValidateDrawMeshTasksCmd();
+                    commandSize += sizeof(DrawMeshTasksIndirectArguments);
+                    break;
+                case IndirectArgumentType::Dispatch:
+                    AssertComputePipelineBound();
+                    commandSize += sizeof(DispatchIndirectArguments);
+                    break;
+                default:
+                    LLGL_DBG_ERROR(ErrorType::InvalidArgument, "invalid type for indirect argument [%zu]", i);
+                    break;
+            }
+        }
+    }
+
+    /* Validate stride between commands */
+    ValidateAddressAlignment(commandDesc.stride, 4, "<IndirectCommandDescriptor::stride> field");
+    if (commandDesc.stride < commandSize)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "stride of indirect commands is too small: %u specified but arguments require %u %s",
+            commandDesc.stride, commandSize, ToByteLabel(commandSize)
+        );
+    }
+}
+
 void DbgCommandBuffer::ValidateDynamicStates()
 {
     if (!bindings_.blendFactorSet)
@@ -2690,6 +4037,11 @@ DbgPipelineState* DbgCommandBuffer::AssertAndGetComputePSO()
         LLGL_DBG_ERROR(ErrorType::InvalidState, "graphics pipeline is bound but compute pipeline is required");
         return nullptr;
     }
+    else if (bindings_.pipelineState->isRayTracingPSO)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidState, "ray tracing pipeline is bound but compute pipeline is required");
+        return nullptr;
+    }
     return bindings_.pipelineState;
 }
 
@@ -2725,7 +4077,7 @@ void DbgCommandBuffer::AssertVertexBufferBound()
             auto buffer = bindings_.vertexBuffers[i];
             if (buffer->elements > 0 && !buffer->initialized)
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "uninitialized vertex buffer is bound at slot %u", i);
-            if (buffer->IsMappedForCPUAccess())
+            if (IsBufferMappedExclusively(buffer))
                 LLGL_DBG_ERROR(ErrorType::InvalidState, "vertex buffer used for drawing while being mapped to CPU memory space");
         }
     }
@@ -2739,7 +4091,7 @@ void DbgCommandBuffer::AssertIndexBufferBound()
     {
         if (!buffer->initialized)
             LLGL_DBG_ERROR(ErrorType::InvalidState, "uninitialized index buffer is bound");
-        if (buffer->IsMappedForCPUAccess())
+        if (IsBufferMappedExclusively(buffer))
             LLGL_DBG_ERROR(ErrorType::InvalidState, "index buffer used for drawing while being mapped to CPU memory space");
     }
     else if (!IsSecondaryCmdBuffer())
@@ -2782,12 +4134,60 @@ void DbgCommandBuffer::AssertIndirectDrawingSupported()
         LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
 }
 
+void DbgCommandBuffer::AssertIndirectCountDrawingSupported()
+{
+    if (!features_.hasIndirectCountDrawing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect count drawing");
+}
+
+void DbgCommandBuffer::AssertMeshShadersSupported()
+{
+    if (!features_.hasMeshShaders)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("mesh shaders");
+}
+
+void DbgCommandBuffer::AssertVariableRateShadingSupported()
+{
+    if (!features_.hasVariableRateShading)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("variable rate shading");
+}
+
+void DbgCommandBuffer::AssertIndirectStateChangesSupported()
+{
+    if (!features_.hasIndirectStateChanges)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("indirect state changes");
+}
+
+void DbgCommandBuffer::AssertTileShadersSupported()
+{
+    if (!features_.hasTileShaders)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("tile shaders");
+}
+
+void DbgCommandBuffer::AssertRayTracingSupported()
+{
+    if (!features_.hasRayTracing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("ray tracing");
+}
+
+void DbgCommandBuffer::AssertQueryResolveSupported()
+{
+    if (!features_.hasQueryResolve)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("query resolve");
+}
+
 void DbgCommandBuffer::AssertStreamOutputSupported()
 {
     if (!features_.hasStreamOutputs)
         LLGL_DBG_ERROR_NOT_SUPPORTED("stream-outputs");
 }
 
+void DbgCommandBuffer::AssertTransientBuffersSupported()
+{
+    if (!features_.hasTransientBuffers)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("transient buffers");
+}
+
 void DbgCommandBuffer::AssertNullPointer(const void* ptr, const char* name)
 {
     if (ptr == nullptr)
@@ -2894,6 +4294,118 @@ void DbgCommandBuffer::SetAndValidateScissorRects(std::uint32_t numScissors, con
     bindings_.numScissorRects = numScissors;
 }
 
+void DbgCommandBuffer::CaptureBarrierResources(std::uint32_t numBuffers, Buffer* const * buffers, std::uint32_t numTextures, Texture* const * textures)
+{
+    const std::uint32_t numCapturedBuffers = (buffers != nullptr ? numBuffers : 0u);
+    captureStream_.Write(numCapturedBuffers);
+    for_range(i, numCapturedBuffers)
+        captureStream_.Write(captureRecorder_.GetObjectID(buffers[i]));
+
+    const std::uint32_t numCapturedTextures = (textures != nullptr ? numTextures : 0u);
+    captureStream_.Write(numCapturedTextures);
+    for_range(i, numCapturedTextures)
+        captureStream_.Write(captureRecorder_.GetObjectID(textures[i]));
+}
+
+DbgBuffer* DbgCommandBuffer::GetOrCreateTransientBufferWrapper(Buffer& bufferInstance)
+{
+    for (const auto& bufferDbg : transientBuffers_)
+    {
+        if (&(bufferDbg->instance) == &bufferInstance)
+            return bufferDbg.get();
+    }
+
+    /* Wrap new chunk; backends keep their chunks alive as long as the command buffer */
+    BufferDescriptor bufferDesc = bufferInstance.GetDesc();
+    bufferDesc.debugName = nullptr;
+
+    auto* bufferDbg = new DbgBuffer{ bufferInstance, bufferDesc };
+    bufferDbg->label        = "LLGL.TransientBuffer";
+    bufferDbg->initialized  = true;
+    transientBuffers_.emplace_back(bufferDbg);
+
+    return bufferDbg;
+}
+
+bool DbgCommandBuffer::IsTransientBufferWrapper(const DbgBuffer* bufferDbg) const
+{
+    for (const auto& transientBufferDbg : transientBuffers_)
+    {
+        if (transientBufferDbg.get() == bufferDbg)
+            return true;
+    }
+    return false;
+}
+
+bool DbgCommandBuffer::IsBufferMappedExclusively(const DbgBuffer* bufferDbg) const
+{
+    if (!bufferDbg->IsMappedForCPUAccess())
+        return false;
+
+    /* Persistently mapped buffers can be used by the GPU while they are mapped */
+    if (features_.hasPersistentMapping && (bufferDbg->desc.miscFlags & MiscFlags::PersistentMapping) != 0)
+        return false;
+
+    return true;
+}
+
+void DbgCommandBuffer::GatherBarrierResourceInstances(
+    std::uint32_t           numBuffers,
+    Buffer* const *         buffers,
+    std::uint32_t           numTextures,
+    Texture* const *        textures,
+    SmallVector<Buffer*>&   bufferInstances,
+    SmallVector<Texture*>&  textureInstances)
+{
+    bufferInstances.resize(numBuffers);
+    textureInstances.resize(numTextures);
+
+    if (LLGL_DBG_SOURCE() && LLGL_DBG_VALIDATE(Barriers))
+    {
+        /* Gather resource instances and validate their binding flags */
+        for_range(i, numBuffers)
+        {
+            if (buffers[i] != nullptr)
+            {
+                DbgBuffer* bufferDbg = LLGL_CAST(DbgBuffer*, buffers[i]);
+                ValidateMemoryBarrierResourceFlags(ResourceType::Buffer, bufferDbg->GetBindFlags(), bufferDbg->label, i);
+                bufferInstances[i] = &(bufferDbg->instance);
+            }
+        }
+
+        for_range(i, numTextures)
+        {
+            if (textures[i] != nullptr)
+            {
+                DbgTexture* textureDbg = LLGL_CAST(DbgTexture*, textures[i]);
+                ValidateMemoryBarrierResourceFlags(ResourceType::Texture, textureDbg->GetBindFlags(), textureDbg->label, i);
+                textureInstances[i] = &(textureDbg->instance);
+            }
+        }
+    }
+    else
+    {
+        /* Only gather resource instances */
+        for_range(i, numBuffers)
+        {
+            if (buffers[i] != nullptr)
+            {
+                DbgBuffer* bufferDbg = LLGL_CAST(DbgBuffer*, buffers[i]);
+                bufferInstances[i] = &(bufferDbg->instance);
+            }
+        }
+
+        for_range(i, numTextures)
+        {
+            if (textures[i] != nullptr)
+            {
+                DbgTexture* textureDbg = LLGL_CAST(DbgTexture*, textures[i]);
+                textureInstances[i] = &(textureDbg->instance);
+            }
+        }
+    }
+}
+
 
 } // /namespace LLGL
 
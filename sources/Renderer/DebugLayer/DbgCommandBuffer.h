@@ -10,14 +10,19 @@
 
 
 #include <LLGL/CommandBuffer.h>
+#include <LLGL/RenderPassFlags.h>
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/Constants.h>
 #include <LLGL/Container/ArrayView.h>
 #include "RenderState/DbgQueryHeap.h"
 #include "DbgQueryTimerPool.h"
+#include "DbgQueryScopePool.h"
+#include "DbgCaptureRecorder.h"
 #include <cstdint>
 #include <string>
 #include <stack>
+#include <vector>
+#include <memory>
 
 
 namespace LLGL
@@ -28,6 +33,7 @@ class DbgBuffer;
 class DbgTexture;
 class DbgSwapChain;
 class DbgRenderTarget;
+class DbgRenderPass;
 class DbgPipelineState;
 class DbgPipelineLayout;
 class DbgShader;
@@ -43,27 +49,69 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void SetDebugName(const char* name) override;
 
+        TransientBufferAllocation AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment) override;
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void BeginResourceBarrier(
+            std::uint32_t       numBuffers,
+            Buffer* const *     buffers,
+            std::uint32_t       numTextures,
+            Texture* const *    textures
+        ) override;
+
+        void EndResourceBarrier(
+            std::uint32_t       numBuffers,
+            Buffer* const *     buffers,
+            std::uint32_t       numTextures,
+            Texture* const *    textures
+        ) override;
+
+        void AliasingBarrier(Texture* textureBefore, Texture* textureAfter) override;
+
+        void CopyBufferRegions(Buffer& dstBuffer, Buffer& srcBuffer, std::uint32_t numRegions, const BufferCopyRegion* regions) override;
+        void CopyTextureRegions(Texture& dstTexture, Texture& srcTexture, std::uint32_t numRegions, const TextureCopyRegion* regions) override;
+
+        void GenerateMips(std::uint32_t numTextures, Texture* const * textures) override;
+
+        void ResolveSamplerFeedback(Texture& feedbackTexture, std::uint32_t mipLevel, std::uint32_t arrayLayer, Buffer& dstBuffer, std::uint64_t dstOffset) override;
+        void ClearSamplerFeedback(Texture& feedbackTexture) override;
+
     public:
 
         DbgCommandBuffer(
             RenderSystem&                   renderSystemInstance,
             CommandQueue&                   commandQueueInstance,
+            DbgQueryScopePool&              queryScopePool,
             CommandBuffer&                  commandBufferInstance,
             FrameProfile&                   commonProfile,
+            DbgCaptureRecorder&             captureRecorder,
             RenderingDebugger*              debugger,
             const CommandBufferDescriptor&  desc,
             const RenderingCapabilities&    caps
         );
 
+        ~DbgCommandBuffer();
+
     public:
 
         void FlushProfile(FrameProfile& outProfile);
 
+        // Schedules the timer scopes of the last recording for asynchronous resolution. Must be called after this command buffer has been submitted.
+        void SubmitQueryScopes();
+
         void ValidateSubmit();
 
+        // Returns the captured commands of the last recording or null if this command buffer was not encoded during a frame capture.
+        inline const CaptureStreamWriter* GetCaptureStream() const
+        {
+            return (isCaptured_ ? &captureStream_ : nullptr);
+        }
+
     public:
 
         CommandBuffer&                  instance;
+        CommandQueue&                   commandQueueInstance; // Command queue this command buffer was created for
         const CommandBufferDescriptor   desc;
         std::string                     label;
 
@@ -81,6 +129,7 @@ class DbgCommandBuffer final : public CommandBuffer
             // Framebuffers
             DbgSwapChain*       swapChain                                           = nullptr;
             DbgRenderTarget*    renderTarget                                        = nullptr;
+            const DbgRenderPass* renderPass                                         = nullptr;
             std::uint32_t       numViewports                                        = 0;
             bool                anyFragmentOutput                                   = false;
 
@@ -107,10 +156,13 @@ class DbgCommandBuffer final : public CommandBuffer
 
         struct States
         {
-            bool recording          = false;
-            bool finishedRecording  = false;
-            bool insideRenderPass   = false;
-            bool streamOutputBusy   = false;
+            bool            recording           = false;
+            bool            finishedRecording   = false;
+            bool            insideRenderPass    = false;
+            bool            streamOutputBusy    = false;
+            std::uint32_t   numSplitBarriers    = 0;        // Number of BeginResourceBarrier() calls without EndResourceBarrier()
+            long            loadedAttachments   = 0;        // ClearFlags of attachments that are loaded by the active render pass
+            std::uint32_t   drawsAtRenderPass   = 0;        // Number of recorded draw commands when the active render pass began
         };
 
         struct SwapChainFramePair
@@ -129,10 +181,14 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateBeginOfRecording();
         void ValidateEndOfRecording();
         void ValidateCommandBufferForExecute(const States& cmdBufferStates, const char* cmdBufferName = nullptr);
+        void ValidateRenderPassForExecute(const DbgCommandBuffer& secondaryCmdBuffer);
 
         void ValidateGenerateMips(DbgTexture& textureDbg, const TextureSubresource* subresource = nullptr);
+        void ValidateSamplerFeedbackTexture(DbgTexture& textureDbg, const char* commandName);
+        void ValidateBufferCopyRegions(DbgBuffer& dstBufferDbg, DbgBuffer& srcBufferDbg, std::uint32_t numRegions, const BufferCopyRegion* regions);
         void ValidateViewport(const Viewport& viewport);
         void ValidateAttachmentClear(const AttachmentClear& attachment);
+        void ValidateClearAfterLoad(long flags);
 
         void ValidateVertexLayout();
         void ValidateVertexLayoutAttributes(const ArrayView<VertexAttribute>& shaderVertexAttribs, DbgBuffer* const * vertexBuffers, std::uint32_t numVertexBuffers);
@@ -145,6 +201,11 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateDrawCmd(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance);
         void ValidateDrawIndexedCmd(std::uint32_t numVertices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance);
         void ValidateDrawStreamOutputCmd();
+        bool IsComputeStreamOutputBound() const;
+        void ValidateDrawMeshTasksCmd();
+        void ValidateDispatchTilesCmd();
+        void ValidateBuildAccelerationStructureCmd(DbgBuffer& dstBufferDbg, DbgBuffer& scratchBufferDbg, const AccelerationStructureDescriptor& desc, DbgBuffer* srcBufferDbg);
+        void ValidateDispatchRaysCmd(std::uint32_t width, std::uint32_t height, std::uint32_t depth);
 
         void ValidateVertexLimit(std::uint32_t vertexCount, std::uint32_t vertexLimit);
         void ValidateThreadGroupLimit(std::uint32_t size, std::uint32_t limit);
@@ -159,6 +220,8 @@ class DbgCommandBuffer final : public CommandBuffer
         void ValidateIndexType(const Format format);
         void ValidateTextureBufferCopyStrides(DbgTexture& textureDbg, std::uint32_t rowStride, std::uint32_t layerStride, const Extent3D& extent);
         void ValidateMemoryBarrierResourceFlags(ResourceType resourceType, long bindFlags, const std::string& label, std::uint32_t resourceIndex);
+        void ValidateSplitResourceBarrier(const char* funcName);
+        void ValidateAliasingBarrier(const DbgTexture* textureBeforeDbg, const DbgTexture* textureAfterDbg);
 
         void ValidateStageFlags(long stageFlags, long validFlags);
         void ValidateBufferRange(DbgBuffer& bufferDbg, std::uint64_t offset, std::uint64_t size, const char* rangeName = nullptr);
@@ -178,6 +241,7 @@ class DbgCommandBuffer final : public CommandBuffer
         const BindingDescriptor* GetAndValidateResourceDescFromPipeline(const DbgPipelineLayout& pipelineLayoutDbg, std::uint32_t descriptor, Resource& resource);
 
         void ValidateUniforms(const DbgPipelineLayout& pipelineLayoutDbg, std::uint32_t first, std::uint16_t dataSize);
+        void ValidateIndirectCommand(const IndirectCommandDescriptor& commandDesc);
 
         void ValidateDynamicStates();
         void ValidateBindingTable();
@@ -198,12 +262,23 @@ class DbgCommandBuffer final : public CommandBuffer
         void AssertInstancingSupported();
         void AssertOffsetInstancingSupported();
         void AssertIndirectDrawingSupported();
+        void AssertIndirectCountDrawingSupported();
+        void AssertMeshShadersSupported();
+        void AssertTileShadersSupported();
+        void AssertRayTracingSupported();
+        void AssertVariableRateShadingSupported();
+        void AssertIndirectStateChangesSupported();
+        void AssertQueryResolveSupported();
         void AssertStreamOutputSupported();
+        void AssertTransientBuffersSupported();
 
         void AssertNullPointer(const void* ptr, const char* name);
 
         void WarnImproperVertices(const char* topologyName, std::uint32_t unusedVertices);
 
+        // Begins a new pipeline statistics section if statistics recording is enabled and no section is open yet.
+        void BeginStatisticsSection(const char* defaultAnnotation);
+
         void ResetStates();
         void ResetRecords();
         void ResetBindingTable(const DbgPipelineLayout* pipelineLayoutDbg);
@@ -216,6 +291,32 @@ class DbgCommandBuffer final : public CommandBuffer
 
         void SetAndValidateScissorRects(std::uint32_t numScissors, const Scissor* scissors);
 
+        // Writes the specified opcode and its arguments into the capture stream of this command buffer.
+        template <typename... TArgs>
+        void CaptureCommand(CaptureOpcode opcode, const TArgs&... args);
+
+        // Writes the IDs of the specified barrier resources into the capture stream of this command buffer.
+        void CaptureBarrierResources(std::uint32_t numBuffers, Buffer* const * buffers, std::uint32_t numTextures, Texture* const * textures);
+
+        // Returns the debug wrapper for the specified transient buffer chunk of the backend and creates it on first use.
+        DbgBuffer* GetOrCreateTransientBufferWrapper(Buffer& bufferInstance);
+
+        // Returns true if the specified buffer is a wrapper for a transient buffer chunk.
+        bool IsTransientBufferWrapper(const DbgBuffer* bufferDbg) const;
+
+        // Returns true if the specified buffer is mapped into CPU memory space and must not be used by the GPU at the same time.
+        bool IsBufferMappedExclusively(const DbgBuffer* bufferDbg) const;
+
+        // Gathers the instances of all barrier resources and validates their binding flags.
+        void GatherBarrierResourceInstances(
+            std::uint32_t           numBuffers,
+            Buffer* const *         buffers,
+            std::uint32_t           numTextures,
+            Texture* const *        textures,
+            SmallVector<Buffer*>&   bufferInstances,
+            SmallVector<Texture*>&  textureInstances
+        );
+
     private:
 
         /* ----- Common objects ----- */
@@ -231,6 +332,16 @@ class DbgCommandBuffer final : public CommandBuffer
         DbgQueryTimerPool           queryTimerPool_;
         bool                        perfProfilerEnabled_    = false;
 
+        DbgQueryScopePool&          queryScopePool_;
+        DbgQueryScopeBatch*         queryScopeBatch_        = nullptr;
+
+        bool                        eventRecordingEnabled_  = false;
+        std::uint64_t               encodingTicksStart_     = 0;
+
+        DbgCaptureRecorder&         captureRecorder_;
+        CaptureStreamWriter         captureStream_;
+        bool                        isCaptured_             = false;
+
         /* ----- Render states ----- */
 
         FrameProfile                profile_;
@@ -239,6 +350,15 @@ class DbgCommandBuffer final : public CommandBuffer
         States                      states_;
         Records                     records_;
 
+        /* ----- Transient buffers ----- */
+
+        std::vector<std::unique_ptr<DbgBuffer>> transientBuffers_;                  // Wrappers for the transient buffer chunks owned by the backend command buffer.
+
+        /* ----- Secondary command buffer inheritance ----- */
+
+        RenderPassDescriptor        inheritanceRenderPassDesc_;                     // Copy of the formats of CommandBufferDescriptor::renderPass, which may be released after creation.
+        bool                        hasInheritanceRenderPass_   = false;
+
 };
 
 
@@ -7,21 +7,47 @@
 
 #include "DbgCommandQueue.h"
 #include "DbgCommandBuffer.h"
+#include "DbgSwapChain.h"
 #include "DbgCore.h"
+#include "Texture/DbgTexture.h"
 #include "../CheckedCast.h"
 #include <LLGL/RenderingDebugger.h>
+#include <LLGL/TextureFlags.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 
 
 namespace LLGL
 {
 
 
-DbgCommandQueue::DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger) :
-    instance  { instance },
-    profile_  { profile  },
-    debugger_ { debugger }
+static StringLiteral GetCommandBufferAnnotation(const DbgCommandBuffer& commandBufferDbg)
 {
+    if (commandBufferDbg.label.empty())
+        return "LLGL::CommandBuffer";
+    else
+        return StringLiteral{ commandBufferDbg.label };
+}
+
+DbgCommandQueue::DbgCommandQueue(
+    RenderSystem&           renderSystemInstance,
+    CommandQueue&           instance,
+    const CommandQueueType  queueType,
+    FrameProfile&           profile,
+    DbgCaptureRecorder&     captureRecorder,
+    RenderingDebugger*      debugger)
+:
+    instance            { instance                                        },
+    debugger_           { debugger                                        },
+    profile_            { profile                                         },
+    captureRecorder_    { captureRecorder                                 },
+    queryScopePool_     { renderSystemInstance, instance, queueType       }
+{
+}
+
+void DbgCommandQueue::ResolveQueryScopes()
+{
+    queryScopePool_.ResolveBatches(profile_);
 }
 
 /* ----- Command Buffers ----- */
@@ -31,9 +57,18 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     auto& commandBufferDbg = LLGL_CAST(DbgCommandBuffer&, commandBuffer);
 
     if (LLGL_DBG_SOURCE())
+    {
         commandBufferDbg.ValidateSubmit();
+        ValidateCommandBufferQueue(commandBufferDbg);
+    }
 
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.Submit(commandBufferDbg.instance);
+    commandBufferDbg.SubmitQueryScopes();
+    captureRecorder_.RecordSubmit(commandBufferDbg);
+
+    if (DbgIsEventRecordingEnabled(debugger_))
+        DbgRecordEvent(profile_, ProfileEventType::Submission, GetCommandBufferAnnotation(commandBufferDbg), cpuTicksStart);
 
     /* Merge frame profile values into rendering profiler */
     FrameProfile profile;
@@ -43,6 +78,96 @@ void DbgCommandQueue::Submit(CommandBuffer& commandBuffer)
     profile_.commandQueueRecord.commandBufferSubmittions++;
 }
 
+void DbgCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (numCommandBuffers > 0 && commandBuffers == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer for array of %u command buffer(s) to submit", numCommandBuffers);
+    }
+
+    if (commandBuffers == nullptr)
+        return;
+
+    /* Validate all command buffers and forward their instances as a single batch */
+    SmallVector<CommandBuffer*> commandBufferInstances;
+    commandBufferInstances.reserve(numCommandBuffers);
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+        {
+            auto* commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+            if (LLGL_DBG_SOURCE())
+            {
+                commandBufferDbg->ValidateSubmit();
+                ValidateCommandBufferQueue(*commandBufferDbg);
+            }
+            commandBufferInstances.push_back(&(commandBufferDbg->instance));
+        }
+    }
+
+    const std::uint64_t cpuTicksStart = Timer::Tick();
+    instance.Submit(static_cast<std::uint32_t>(commandBufferInstances.size()), commandBufferInstances.data());
+
+    if (DbgIsEventRecordingEnabled(debugger_))
+    {
+        const std::string annotation = std::to_string(commandBufferInstances.size()) + " command buffer(s)";
+        DbgRecordEvent(profile_, ProfileEventType::Submission, StringLiteral{ annotation }, cpuTicksStart);
+    }
+
+    /* Merge frame profile values of each command buffer into rendering profiler */
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+        {
+            auto* commandBufferDbg = LLGL_CAST(DbgCommandBuffer*, commandBuffers[i]);
+            commandBufferDbg->SubmitQueryScopes();
+            captureRecorder_.RecordSubmit(*commandBufferDbg);
+
+            FrameProfile profile;
+            commandBufferDbg->FlushProfile(profile);
+
+            RenderingDebugger::MergeProfiles(profile_, profile);
+            profile_.commandQueueRecord.commandBufferSubmittions++;
+        }
+    }
+}
+
+void DbgCommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (numSwapChains > 0 && swapChains == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer for array of %u swap-chain(s) to present", numSwapChains);
+    }
+
+    if (swapChains == nullptr)
+        return;
+
+    /* Forward swap-chain instances as a single batch */
+    SmallVector<DbgSwapChain*> swapChainsDbg;
+    SmallVector<SwapChain*> swapChainInstances;
+    swapChainsDbg.reserve(numSwapChains);
+    swapChainInstances.reserve(numSwapChains);
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+        {
+            auto* swapChainDbg = LLGL_CAST(DbgSwapChain*, swapChains[i]);
+            swapChainsDbg.push_back(swapChainDbg);
+            swapChainInstances.push_back(&(swapChainDbg->instance));
+        }
+    }
+
+    const std::uint64_t cpuTicksStart = Timer::Tick();
+    instance.Present(static_cast<std::uint32_t>(swapChainInstances.size()), swapChainInstances.data());
+
+    for (DbgSwapChain* swapChainDbg : swapChainsDbg)
+        swapChainDbg->NotifyPresented(cpuTicksStart);
+}
+
 /* ----- Queries ----- */
 
 bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, void* data, std::size_t dataSize)
@@ -59,18 +184,76 @@ bool DbgCommandQueue::QueryResult(QueryHeap& queryHeap, std::uint32_t firstQuery
 
 void DbgCommandQueue::Submit(Fence& fence)
 {
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.Submit(fence);
+
+    if (DbgIsEventRecordingEnabled(debugger_))
+        DbgRecordEvent(profile_, ProfileEventType::Submission, "Fence", cpuTicksStart);
+
     profile_.commandQueueRecord.fenceSubmissions++;
 }
 
+void DbgCommandQueue::SubmitWait(Fence& fence)
+{
+    instance.SubmitWait(fence);
+}
+
 bool DbgCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
-    return instance.WaitFence(fence, timeout);
+    const std::uint64_t cpuTicksStart = Timer::Tick();
+    const bool result = instance.WaitFence(fence, timeout);
+
+    if (DbgIsEventRecordingEnabled(debugger_))
+        DbgRecordEvent(profile_, ProfileEventType::Wait, "WaitFence", cpuTicksStart);
+
+    return result;
 }
 
 void DbgCommandQueue::WaitIdle()
 {
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.WaitIdle();
+
+    if (DbgIsEventRecordingEnabled(debugger_))
+        DbgRecordEvent(profile_, ProfileEventType::Wait, "WaitIdle", cpuTicksStart);
+}
+
+/* ----- Sparse Resources ----- */
+
+void DbgCommandQueue::UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (numMappings > 0 && mappings == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer for array of %u tile mapping(s)", numMappings);
+    }
+
+    if (mappings == nullptr)
+        return;
+
+    /* Validate all tile mappings and forward them with their texture instances */
+    SmallVector<TileMappingDescriptor> mappingInstances;
+    mappingInstances.reserve(numMappings);
+
+    for_range(i, numMappings)
+    {
+        if (mappings[i].texture == nullptr)
+        {
+            if (LLGL_DBG_SOURCE())
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "null pointer for texture in tile mapping [%u]", i);
+            continue;
+        }
+
+        auto* textureDbg = LLGL_CAST(DbgTexture*, mappings[i].texture);
+        if (LLGL_DBG_SOURCE())
+            ValidateTileMapping(*textureDbg, mappings[i], i);
+
+        TileMappingDescriptor mappingInstance = mappings[i];
+        mappingInstance.texture = &(textureDbg->instance);
+        mappingInstances.push_back(mappingInstance);
+    }
+
+    instance.UpdateTileMappings(static_cast<std::uint32_t>(mappingInstances.size()), mappingInstances.data());
 }
 
 
@@ -78,6 +261,51 @@ void DbgCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+void DbgCommandQueue::ValidateCommandBufferQueue(DbgCommandBuffer& commandBufferDbg)
+{
+    if (&(commandBufferDbg.commandQueueInstance) != &instance)
+    {
+        const std::string labelStr = (commandBufferDbg.label.empty() ? "" : " ['" + commandBufferDbg.label + "']");
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot submit command buffer%s to a command queue of a different type than CommandBufferDescriptor::queueType",
+            labelStr.c_str()
+        );
+    }
+}
+
+void DbgCommandQueue::ValidateTileMapping(DbgTexture& textureDbg, const TileMappingDescriptor& mapping, std::uint32_t index)
+{
+    if ((textureDbg.desc.miscFlags & MiscFlags::Sparse) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot update tile mapping [%u] of texture that was not created with 'LLGL::MiscFlags::Sparse'", index
+        );
+    }
+
+    if (mapping.mipLevel >= textureDbg.mipLevels)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "MIP-map level %u in tile mapping [%u] out of range; texture has %u MIP-map level(s)",
+            mapping.mipLevel, index, textureDbg.mipLevels
+        );
+    }
+
+    if (mapping.arrayLayer >= textureDbg.desc.arrayLayers)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "array layer %u in tile mapping [%u] out of range; texture has %u array layer(s)",
+            mapping.arrayLayer, index, textureDbg.desc.arrayLayers
+        );
+    }
+
+    if (mapping.tileOffset.x < 0 || mapping.tileOffset.y < 0 || mapping.tileOffset.z < 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "negative tile offset in tile mapping [%u]", index);
+}
+
 void DbgCommandQueue::ValidateQueryResult(
     DbgQueryHeap&   queryHeap,
     std::uint32_t   firstQuery,
@@ -9,6 +9,8 @@
 #define LLGL_DBG_COMMAND_QUEUE_H
 
 
+#include "DbgQueryScopePool.h"
+#include "DbgCaptureRecorder.h"
 #include <LLGL/CommandQueue.h>
 #include <LLGL/RenderingDebugger.h>
 
@@ -18,6 +20,8 @@ namespace LLGL
 
 
 class DbgQueryHeap;
+class DbgCommandBuffer;
+class DbgTexture;
 
 class DbgCommandQueue final : public CommandQueue
 {
@@ -28,7 +32,33 @@ class DbgCommandQueue final : public CommandQueue
 
     public:
 
-        DbgCommandQueue(CommandQueue& instance, FrameProfile& profile, RenderingDebugger* debugger);
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains) override;
+
+        void SubmitWait(Fence& fence) override;
+
+        void UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings) override;
+
+    public:
+
+        DbgCommandQueue(
+            RenderSystem&           renderSystemInstance,
+            CommandQueue&           instance,
+            const CommandQueueType  queueType,
+            FrameProfile&           profile,
+            DbgCaptureRecorder&     captureRecorder,
+            RenderingDebugger*      debugger
+        );
+
+        // Resolves the hierarchical timer scopes of all finished command buffers into the frame profile without waiting for the GPU.
+        void ResolveQueryScopes();
+
+        // Returns the pool for hierarchical timer scopes of command buffers that are submitted to this queue.
+        inline DbgQueryScopePool& GetQueryScopePool()
+        {
+            return queryScopePool_;
+        }
 
     public:
 
@@ -36,6 +66,10 @@ class DbgCommandQueue final : public CommandQueue
 
     private:
 
+        void ValidateCommandBufferQueue(DbgCommandBuffer& commandBufferDbg);
+
+        void ValidateTileMapping(DbgTexture& textureDbg, const TileMappingDescriptor& mapping, std::uint32_t index);
+
         void ValidateQueryResult(
             DbgQueryHeap&   queryHeap,
             std::uint32_t   firstQuery,
@@ -48,6 +82,8 @@ class DbgCommandQueue final : public CommandQueue
 
         RenderingDebugger*  debugger_ = nullptr;
         FrameProfile&       profile_;
+        DbgCaptureRecorder& captureRecorder_;
+        DbgQueryScopePool   queryScopePool_;
 
 };
 
@@ -16,7 +16,9 @@
 #include "../../Core/Assertion.h"
 #include "../../Core/MacroUtils.h"
 #include "../../Core/PrintfUtils.h"
+#include <LLGL/Timer.h>
 #include <type_traits>
+#include <atomic>
 
 
 namespace LLGL
@@ -54,10 +56,22 @@ namespace LLGL
         ObjectCast<TYPE>(OBJ)                                                                   \
     )
 
-// Sets the current source name and returns true if the debugger is set.
+// Returns true if the debugger is set and its validation is enabled, i.e. the debug layer is not only used for profiling.
+inline bool DbgIsValidationEnabled(const RenderingDebugger* debugger)
+{
+    return (debugger != nullptr && debugger->GetValidation());
+}
+
+// Returns true if the debugger is set and any of the specified validation categories is enabled. See ValidationFlags.
+inline bool DbgIsValidationEnabled(const RenderingDebugger* debugger, long validationFlags)
+{
+    return (debugger != nullptr && (debugger->GetValidationFlags() & validationFlags) != 0);
+}
+
+// Sets the current source name and returns true if the debugger is set and its validation is enabled.
 inline bool DbgSetSourceChecked(RenderingDebugger* debugger, const char* sourceName)
 {
-    if (debugger != nullptr)
+    if (DbgIsValidationEnabled(debugger))
     {
         debugger->SetSource(sourceName);
         return true;
@@ -65,6 +79,34 @@ inline bool DbgSetSourceChecked(RenderingDebugger* debugger, const char* sourceN
     return false;
 }
 
+// Returns true if the debugger is set and its event recording is enabled.
+inline bool DbgIsEventRecordingEnabled(const RenderingDebugger* debugger)
+{
+    return (debugger != nullptr && debugger->GetEventRecording());
+}
+
+// Returns the zero-based index of the calling thread. Threads are enumerated in the order they call this function for the first time.
+inline std::uint32_t DbgGetThreadIndex()
+{
+    static std::atomic<std::uint32_t> threadCounter{ 0 };
+    static thread_local const std::uint32_t threadIndex = threadCounter++;
+    return threadIndex;
+}
+
+// Appends an event to the specified frame profile that started at the specified CPU ticks and ends with the current CPU ticks.
+inline void DbgRecordEvent(FrameProfile& profile, ProfileEventType type, StringLiteral annotation, std::uint64_t cpuTicksStart)
+{
+    ProfileEventRecord record;
+    {
+        record.type             = type;
+        record.annotation       = std::move(annotation);
+        record.thread           = DbgGetThreadIndex();
+        record.cpuTicksStart    = cpuTicksStart;
+        record.cpuTicksEnd      = Timer::Tick();
+    }
+    profile.eventRecords.push_back(std::move(record));
+}
+
 // Sets the name of the specified debug layer object.
 template <typename T>
 inline void DbgSetObjectName(T& obj, const char* name)
@@ -0,0 +1,401 @@
+/*
+ * DbgQueryScopePool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgQueryScopePool.h"
+#include "DbgCore.h"
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/QueryHeap.h>
+#include <LLGL/Fence.h>
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <thread>
+
+
+namespace LLGL
+{
+
+
+// Number of timestamps per query heap, i.e. two timestamps for each scope
+static constexpr std::uint32_t g_queryScopeHeapSize      = 128;
+
+// Number of pipeline statistics queries per query heap
+static constexpr std::uint32_t g_queryStatisticsHeapSize = 16;
+
+// Number of frames after which a submitted batch is discarded if its results are still not available
+static constexpr std::uint64_t g_queryScopeMaxLatency    = 16;
+
+static constexpr std::uint32_t g_queryScopeInvalidIndex  = 0xFFFFFFFF;
+
+static void AccumulatePipelineStatistics(QueryPipelineStatistics& dst, const QueryPipelineStatistics& src)
+{
+    dst.inputAssemblyVertices           += src.inputAssemblyVertices;
+    dst.inputAssemblyPrimitives         += src.inputAssemblyPrimitives;
+    dst.vertexShaderInvocations         += src.vertexShaderInvocations;
+    dst.geometryShaderInvocations       += src.geometryShaderInvocations;
+    dst.geometryShaderPrimitives        += src.geometryShaderPrimitives;
+    dst.clippingInvocations             += src.clippingInvocations;
+    dst.clippingPrimitives              += src.clippingPrimitives;
+    dst.fragmentShaderInvocations       += src.fragmentShaderInvocations;
+    dst.tessControlShaderInvocations    += src.tessControlShaderInvocations;
+    dst.tessEvaluationShaderInvocations += src.tessEvaluationShaderInvocations;
+    dst.computeShaderInvocations        += src.computeShaderInvocations;
+}
+
+DbgQueryScopePool::DbgQueryScopePool(
+    RenderSystem&           renderSystemInstance,
+    CommandQueue&           commandQueueInstance,
+    const CommandQueueType  queueType)
+:
+    renderSystem_ { renderSystemInstance },
+    commandQueue_ { commandQueueInstance },
+    queueType_    { queueType            }
+{
+}
+
+DbgQueryScopePool::~DbgQueryScopePool()
+{
+    for (const std::unique_ptr<DbgQueryScopeBatch>& batch : batches_)
+    {
+        for (QueryHeap* queryHeap : batch->queryHeaps)
+            renderSystem_.Release(*queryHeap);
+        for (QueryHeap* queryHeap : batch->statisticsHeaps)
+            renderSystem_.Release(*queryHeap);
+        if (batch->fence != nullptr)
+            renderSystem_.Release(*batch->fence);
+    }
+}
+
+DbgQueryScopeBatch* DbgQueryScopePool::AllocBatch(CommandBuffer& commandBufferInstance, bool recordScopes, bool recordStatistics)
+{
+    /* Calibrate GPU timestamps with the first batch of timer scopes */
+    if (recordScopes && !isCalibrated_)
+        Calibrate();
+
+    /* Take batch from free list or allocate new one */
+    DbgQueryScopeBatch* batch = nullptr;
+    if (!freeBatches_.empty())
+    {
+        batch = freeBatches_.back();
+        freeBatches_.pop_back();
+    }
+    else
+    {
+        batches_.push_back(std::unique_ptr<DbgQueryScopeBatch>{ new DbgQueryScopeBatch{} });
+        batch = batches_.back().get();
+    }
+
+    batch->commandBuffer    = &commandBufferInstance;
+    batch->frame            = frame_;
+    batch->recordScopes     = recordScopes;
+    batch->recordStatistics = recordStatistics;
+    batch->isStatisticsOpen = false;
+    batch->records.clear();
+    batch->statisticsRecords.clear();
+    batch->openScopes.clear();
+
+    return batch;
+}
+
+void DbgQueryScopePool::FreeBatch(DbgQueryScopeBatch* batch)
+{
+    if (batch != nullptr)
+    {
+        batch->commandBuffer = nullptr;
+        freeBatches_.push_back(batch);
+    }
+}
+
+void DbgQueryScopePool::PushScope(DbgQueryScopeBatch& batch, StringLiteral annotation)
+{
+    if (!batch.recordScopes)
+        return;
+
+    const std::uint32_t recordIndex = static_cast<std::uint32_t>(batch.records.size());
+
+    /* Store annotation and position within the scope hierarchy */
+    ProfileScopeRecord record;
+    {
+        record.annotation       = std::move(annotation);
+        record.parent           = (batch.openScopes.empty() ? g_queryScopeInvalidIndex : batch.openScopes.back());
+        record.depth            = static_cast<std::uint32_t>(batch.openScopes.size());
+        record.frame            = batch.frame;
+        record.cpuTicksStart    = Timer::Tick();
+    }
+    batch.records.push_back(record);
+    batch.openScopes.push_back(recordIndex);
+
+    /* Write start timestamp */
+    std::uint32_t query = 0;
+    QueryHeap& queryHeap = GetTimestampQueryHeap(batch, recordIndex * 2, query);
+    batch.commandBuffer->EndQuery(queryHeap, query);
+}
+
+void DbgQueryScopePool::PopScope(DbgQueryScopeBatch& batch)
+{
+    if (batch.openScopes.empty())
+        return;
+
+    const std::uint32_t recordIndex = batch.openScopes.back();
+    batch.openScopes.pop_back();
+    batch.records[recordIndex].cpuTicksEnd = Timer::Tick();
+
+    /* Write end timestamp */
+    std::uint32_t query = 0;
+    QueryHeap& queryHeap = GetTimestampQueryHeap(batch, recordIndex * 2 + 1, query);
+    batch.commandBuffer->EndQuery(queryHeap, query);
+}
+
+void DbgQueryScopePool::PopAllScopes(DbgQueryScopeBatch& batch)
+{
+    while (!batch.openScopes.empty())
+        PopScope(batch);
+}
+
+void DbgQueryScopePool::BeginStatistics(DbgQueryScopeBatch& batch, StringLiteral annotation)
+{
+    if (!batch.recordStatistics || batch.isStatisticsOpen)
+        return;
+
+    const std::uint32_t sectionIndex = static_cast<std::uint32_t>(batch.statisticsRecords.size());
+
+    ProfileStatisticsRecord record;
+    {
+        record.annotation   = std::move(annotation);
+        record.frame        = batch.frame;
+    }
+    batch.statisticsRecords.push_back(record);
+    batch.isStatisticsOpen = true;
+
+    std::uint32_t query = 0;
+    QueryHeap& queryHeap = GetStatisticsQueryHeap(batch, sectionIndex, query);
+    batch.commandBuffer->BeginQuery(queryHeap, query);
+}
+
+void DbgQueryScopePool::EndStatistics(DbgQueryScopeBatch& batch)
+{
+    if (!batch.isStatisticsOpen)
+        return;
+
+    const std::uint32_t sectionIndex = static_cast<std::uint32_t>(batch.statisticsRecords.size()) - 1;
+    batch.isStatisticsOpen = false;
+
+    std::uint32_t query = 0;
+    QueryHeap& queryHeap = GetStatisticsQueryHeap(batch, sectionIndex, query);
+    batch.commandBuffer->EndQuery(queryHeap, query);
+}
+
+void DbgQueryScopePool::SubmitBatch(DbgQueryScopeBatch* batch)
+{
+    if (batch == nullptr)
+        return;
+
+    /* Batches without any scopes or statistics sections can be returned immediately */
+    if (batch->records.empty() && batch->statisticsRecords.empty())
+    {
+        FreeBatch(batch);
+        return;
+    }
+
+    /* Signal fence after the command buffer to determine when the results are available without blocking */
+    if (batch->fence == nullptr)
+        batch->fence = renderSystem_.CreateFence();
+
+    commandQueue_.Submit(*batch->fence);
+
+    batch->commandBuffer    = nullptr;
+    batch->submitFrame      = frame_;
+    pendingBatches_.push_back(batch);
+}
+
+void DbgQueryScopePool::ResolveBatches(FrameProfile& outProfile)
+{
+    /* Resolve batches in submission order until the first one is still in flight */
+    while (!pendingBatches_.empty())
+    {
+        DbgQueryScopeBatch* batch = pendingBatches_.front();
+
+        if (batch->fence->IsSignaled() && ReadTimestamps(*batch) && ReadStatistics(*batch))
+        {
+            /* Offset parent indices to the position in the output list and append records */
+            const std::uint32_t recordOffset = static_cast<std::uint32_t>(outProfile.scopeRecords.size());
+            for (ProfileScopeRecord& rec : batch->records)
+            {
+                if (rec.parent != g_queryScopeInvalidIndex)
+                    rec.parent += recordOffset;
+                outProfile.scopeRecords.push_back(std::move(rec));
+            }
+
+            /* Append statistics records and accumulate them for the entire profile */
+            for (ProfileStatisticsRecord& rec : batch->statisticsRecords)
+            {
+                AccumulatePipelineStatistics(outProfile.pipelineStatistics, rec.statistics);
+                outProfile.statisticsRecords.push_back(std::move(rec));
+            }
+        }
+        else if (frame_ - batch->submitFrame < g_queryScopeMaxLatency)
+            break;
+
+        /* Return batch to free list; it is discarded if its results did not become available within the maximum latency */
+        pendingBatches_.pop_front();
+        FreeBatch(batch);
+    }
+
+    ++frame_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void DbgQueryScopePool::Calibrate()
+{
+    constexpr int maxAttempts = 100;
+
+    isCalibrated_       = true;
+    cpuTicksPerNanosec_ = static_cast<double>(Timer::Frequency()) / 1.0e9;
+
+    /* Record a single timestamp in a dedicated command buffer */
+    QueryHeapDescriptor queryDesc;
+    {
+        queryDesc.debugName     = "LLGL::DbgQueryScopePool::Calibration";
+        queryDesc.type          = QueryType::Timestamp;
+        queryDesc.numQueries    = 1;
+    }
+    QueryHeap* queryHeap = renderSystem_.CreateQueryHeap(queryDesc);
+
+    CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.debugName = "LLGL::DbgQueryScopePool::Calibration";
+        cmdBufferDesc.queueType = queueType_;
+    }
+    CommandBuffer* cmdBuffer = renderSystem_.CreateCommandBuffer(cmdBufferDesc);
+
+    cmdBuffer->Begin();
+    cmdBuffer->EndQuery(*queryHeap, 0);
+    cmdBuffer->End();
+
+    /* Submit timestamp and take the CPU ticks halfway between submission and completion */
+    const std::uint64_t cpuTicksStart = Timer::Tick();
+    commandQueue_.Submit(*cmdBuffer);
+    commandQueue_.WaitIdle();
+    const std::uint64_t cpuTicksEnd = Timer::Tick();
+
+    for_range(i, maxAttempts)
+    {
+        if (commandQueue_.QueryResult(*queryHeap, 0, 1, &calibrationGPUTime_, sizeof(calibrationGPUTime_)))
+            break;
+        std::this_thread::yield();
+    }
+
+    calibrationCPUTicks_ = cpuTicksStart + (cpuTicksEnd - cpuTicksStart) / 2;
+
+    renderSystem_.Release(*cmdBuffer);
+    renderSystem_.Release(*queryHeap);
+}
+
+QueryHeap& DbgQueryScopePool::GetTimestampQueryHeap(DbgQueryScopeBatch& batch, std::uint32_t timestampIndex, std::uint32_t& outQuery)
+{
+    const std::size_t heapIndex = timestampIndex / g_queryScopeHeapSize;
+
+    /* Check if new query heap must be created */
+    while (heapIndex >= batch.queryHeaps.size())
+    {
+        QueryHeapDescriptor queryDesc;
+        {
+            queryDesc.type          = QueryType::Timestamp;
+            queryDesc.numQueries    = g_queryScopeHeapSize;
+        }
+        batch.queryHeaps.push_back(renderSystem_.CreateQueryHeap(queryDesc));
+    }
+
+    outQuery = timestampIndex % g_queryScopeHeapSize;
+    return *batch.queryHeaps[heapIndex];
+}
+
+QueryHeap& DbgQueryScopePool::GetStatisticsQueryHeap(DbgQueryScopeBatch& batch, std::uint32_t sectionIndex, std::uint32_t& outQuery)
+{
+    const std::size_t heapIndex = sectionIndex / g_queryStatisticsHeapSize;
+
+    /* Check if new query heap must be created */
+    while (heapIndex >= batch.statisticsHeaps.size())
+    {
+        QueryHeapDescriptor queryDesc;
+        {
+            queryDesc.type          = QueryType::PipelineStatistics;
+            queryDesc.numQueries    = g_queryStatisticsHeapSize;
+        }
+        batch.statisticsHeaps.push_back(renderSystem_.CreateQueryHeap(queryDesc));
+    }
+
+    outQuery = sectionIndex % g_queryStatisticsHeapSize;
+    return *batch.statisticsHeaps[heapIndex];
+}
+
+bool DbgQueryScopePool::ReadTimestamps(DbgQueryScopeBatch& batch)
+{
+    const std::uint32_t numTimestamps = static_cast<std::uint32_t>(batch.records.size()) * 2;
+    timestamps_.resize(numTimestamps);
+
+    /* Read timestamps from each query heap of this batch */
+    for (std::uint32_t firstTimestamp = 0; firstTimestamp < numTimestamps; firstTimestamp += g_queryScopeHeapSize)
+    {
+        const std::uint32_t numQueries = std::min(numTimestamps - firstTimestamp, g_queryScopeHeapSize);
+        QueryHeap& queryHeap = *batch.queryHeaps[firstTimestamp / g_queryScopeHeapSize];
+        if (!commandQueue_.QueryResult(queryHeap, 0, numQueries, &timestamps_[firstTimestamp], numQueries * sizeof(std::uint64_t)))
+            return false;
+    }
+
+    /* Convert timestamps into CPU ticks */
+    for_range(i, batch.records.size())
+    {
+        ProfileScopeRecord& rec = batch.records[i];
+        const std::uint64_t gpuTimeStart    = timestamps_[i*2    ];
+        const std::uint64_t gpuTimeEnd      = timestamps_[i*2 + 1];
+        rec.gpuTicksStart   = GPUTimeToCPUTicks(gpuTimeStart);
+        rec.gpuTicksEnd     = GPUTimeToCPUTicks(gpuTimeEnd);
+        rec.elapsedTime     = (gpuTimeEnd > gpuTimeStart ? gpuTimeEnd - gpuTimeStart : 0);
+    }
+
+    return true;
+}
+
+bool DbgQueryScopePool::ReadStatistics(DbgQueryScopeBatch& batch)
+{
+    const std::uint32_t numSections = static_cast<std::uint32_t>(batch.statisticsRecords.size());
+
+    /* Read pipeline statistics from each query heap of this batch directly into the records */
+    for (std::uint32_t firstSection = 0; firstSection < numSections; firstSection += g_queryStatisticsHeapSize)
+    {
+        const std::uint32_t numQueries = std::min(numSections - firstSection, g_queryStatisticsHeapSize);
+        QueryHeap& queryHeap = *batch.statisticsHeaps[firstSection / g_queryStatisticsHeapSize];
+        statistics_.resize(numQueries);
+        if (!commandQueue_.QueryResult(queryHeap, 0, numQueries, statistics_.data(), numQueries * sizeof(QueryPipelineStatistics)))
+            return false;
+        for_range(i, numQueries)
+            batch.statisticsRecords[firstSection + i].statistics = statistics_[i];
+    }
+
+    return true;
+}
+
+std::uint64_t DbgQueryScopePool::GPUTimeToCPUTicks(std::uint64_t gpuTime) const
+{
+    const double deltaTicks = (static_cast<double>(gpuTime) - static_cast<double>(calibrationGPUTime_)) * cpuTicksPerNanosec_;
+    const double cpuTicks   = static_cast<double>(calibrationCPUTicks_) + deltaTicks;
+    return (cpuTicks > 0.0 ? static_cast<std::uint64_t>(cpuTicks + 0.5) : 0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
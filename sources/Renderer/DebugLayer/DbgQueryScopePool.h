@@ -0,0 +1,132 @@
+/*
+ * DbgQueryScopePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_QUERY_SCOPE_POOL_H
+#define LLGL_DBG_QUERY_SCOPE_POOL_H
+
+
+#include <LLGL/ForwardDecls.h>
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/QueryHeapFlags.h>
+#include <vector>
+#include <deque>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+// Batch of hierarchical timer scopes and pipeline statistics sections recorded by a single command buffer.
+// Each scope is measured by a pair of timestamp queries and each statistics section by a single pipeline statistics query.
+struct DbgQueryScopeBatch
+{
+    CommandBuffer*                          commandBuffer       = nullptr;
+    Fence*                                  fence               = nullptr;
+    std::vector<QueryHeap*>                 queryHeaps;
+    std::vector<QueryHeap*>                 statisticsHeaps;
+    std::uint64_t                           frame               = 0;        // Frame the scopes were recorded in
+    std::uint64_t                           submitFrame         = 0;        // Frame the batch was submitted in
+    bool                                    recordScopes        = false;
+    bool                                    recordStatistics    = false;
+    bool                                    isStatisticsOpen    = false;    // Is the last statistics section still open?
+    DynamicVector<ProfileScopeRecord>       records;
+    DynamicVector<ProfileStatisticsRecord>  statisticsRecords;
+    std::vector<std::uint32_t>              openScopes;                     // Stack of indices into 'records' for the scopes that have not been closed yet
+};
+
+// Pool of timestamp queries for the hierarchical timer scopes of a single command queue. Results are resolved asynchronously.
+class DbgQueryScopePool
+{
+
+    public:
+
+        DbgQueryScopePool(
+            RenderSystem&           renderSystemInstance,
+            CommandQueue&           commandQueueInstance,
+            const CommandQueueType  queueType
+        );
+
+        ~DbgQueryScopePool();
+
+        // Allocates a batch to record scopes and/or statistics sections into with the specified command buffer. Calibrates the GPU timestamps on first use of scopes.
+        DbgQueryScopeBatch* AllocBatch(CommandBuffer& commandBufferInstance, bool recordScopes, bool recordStatistics);
+
+        // Returns the specified batch to the pool without resolving it, e.g. when its command buffer is recorded again before it was submitted.
+        void FreeBatch(DbgQueryScopeBatch* batch);
+
+        // Opens a new scope in the specified batch and writes its start timestamp.
+        void PushScope(DbgQueryScopeBatch& batch, StringLiteral annotation);
+
+        // Closes the innermost open scope of the specified batch and writes its end timestamp.
+        void PopScope(DbgQueryScopeBatch& batch);
+
+        // Closes all scopes of the specified batch that are still open, i.e. at the end of command recording.
+        void PopAllScopes(DbgQueryScopeBatch& batch);
+
+        // Opens a new pipeline statistics section in the specified batch. Statistics sections cannot be nested.
+        void BeginStatistics(DbgQueryScopeBatch& batch, StringLiteral annotation);
+
+        // Closes the current pipeline statistics section of the specified batch if there is one open.
+        void EndStatistics(DbgQueryScopeBatch& batch);
+
+        // Submits a fence to mark the end of the specified batch and schedules it for asynchronous resolution.
+        void SubmitBatch(DbgQueryScopeBatch* batch);
+
+        // Appends the records of all batches that have finished execution without waiting for the GPU to the specified profile, then advances to the next frame.
+        void ResolveBatches(FrameProfile& outProfile);
+
+    private:
+
+        // Measures the offset between the GPU and CPU clocks. This waits once for the command queue to be idle.
+        void Calibrate();
+
+        // Returns the query heap and query index for the specified timestamp of a batch and allocates a new heap if necessary.
+        QueryHeap& GetTimestampQueryHeap(DbgQueryScopeBatch& batch, std::uint32_t timestampIndex, std::uint32_t& outQuery);
+
+        // Returns the query heap and query index for the specified statistics section of a batch and allocates a new heap if necessary.
+        QueryHeap& GetStatisticsQueryHeap(DbgQueryScopeBatch& batch, std::uint32_t sectionIndex, std::uint32_t& outQuery);
+
+        // Reads all timestamps of the specified batch. Returns false if the results are not available yet.
+        bool ReadTimestamps(DbgQueryScopeBatch& batch);
+
+        // Reads all pipeline statistics of the specified batch. Returns false if the results are not available yet.
+        bool ReadStatistics(DbgQueryScopeBatch& batch);
+
+        // Converts the GPU timestamp in nanoseconds into CPU ticks.
+        std::uint64_t GPUTimeToCPUTicks(std::uint64_t gpuTime) const;
+
+    private:
+
+        RenderSystem&                                       renderSystem_;
+        CommandQueue&                                       commandQueue_;
+        const CommandQueueType                              queueType_;
+
+        std::vector<std::unique_ptr<DbgQueryScopeBatch>>    batches_;
+        std::vector<DbgQueryScopeBatch*>                    freeBatches_;
+        std::deque<DbgQueryScopeBatch*>                     pendingBatches_;
+        std::vector<std::uint64_t>                          timestamps_;
+        std::vector<QueryPipelineStatistics>                statistics_;
+
+        std::uint64_t                                       frame_                  = 0;
+        bool                                                isCalibrated_           = false;
+        std::uint64_t                                       calibrationCPUTicks_    = 0;
+        std::uint64_t                                       calibrationGPUTime_     = 0;
+        double                                              cpuTicksPerNanosec_     = 0.0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
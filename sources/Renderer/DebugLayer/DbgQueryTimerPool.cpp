@@ -53,7 +53,6 @@ void DbgQueryTimerPool::Reset()
     records_.clear();
     currentQuery_       = 0;
     currentQueryHeap_   = 0;
-    cpuTicksBase_       = Timer::Tick();
 }
 
 void DbgQueryTimerPool::Start(StringLiteral annotation)
@@ -64,7 +63,7 @@ void DbgQueryTimerPool::Start(StringLiteral annotation)
     ProfileTimeRecord record;
     {
         record.annotation       = std::move(annotation);
-        record.cpuTicksStart    = Timer::Tick() - cpuTicksBase_;
+        record.cpuTicksStart    = Timer::Tick();
     }
     records_.push_back(record);
 
@@ -99,7 +98,7 @@ void DbgQueryTimerPool::Stop()
     ProfileTimeRecord& rec = records_[recordIndex];
 
     /* Record CPU ticks at end */
-    rec.cpuTicksEnd = Timer::Tick() - cpuTicksBase_;
+    rec.cpuTicksEnd = Timer::Tick();
 
     /* Stop timer query */
     const DbgQueryTimerIndices indices = GetQueryForRecord(recordIndex);
@@ -12,6 +12,8 @@
 #include "../TextureUtils.h"
 #include "../CheckedCast.h"
 #include "../RenderTargetUtils.h"
+#include "../RenderPassUtils.h"
+#include "../ProfileCounters.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/StringUtils.h"
 #include <LLGL/ImageFlags.h>
@@ -37,15 +39,36 @@ All the actual render system objects are stored in the members named "instance",
 DbgRenderSystem::DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger) :
     instance_     { std::forward<RenderSystemPtr&&>(instance)                                         },
     debugger_     { debugger                                                                          },
-    commandQueue_ { MakeUnique<DbgCommandQueue>(*(instance_->GetCommandQueue()), profile_, debugger_) }
+    capture_      { *instance_, debugger                                                              },
+    commandQueue_ { MakeUnique<DbgCommandQueue>(*instance_, *(instance_->GetCommandQueue()), CommandQueueType::Graphics, profile_, capture_, debugger_) }
 {
+    /* Record backend counters while this debug layer is active */
+    EnableProfileCounters(true);
+}
+
+DbgRenderSystem::~DbgRenderSystem()
+{
+    EnableProfileCounters(false);
 }
 
 void DbgRenderSystem::FlushProfile()
 {
+    /* Resolve timer scopes of previous frames that have finished on the GPU */
+    commandQueue_->ResolveQueryScopes();
+    if (computeQueue_)
+        computeQueue_->ResolveQueryScopes();
+    if (copyQueue_)
+        copyQueue_->ResolveQueryScopes();
+
+    /* Move backend counters of this frame into the profile */
+    FlushProfileCounters(profile_.backendRecord);
+
     if (debugger_ != nullptr)
         debugger_->RecordProfile(profile_);
     profile_ = {};
+
+    /* Begin or end frame capture as scheduled by the debugger */
+    capture_.NextFrame();
 }
 
 bool DbgRenderSystem::IsVulkan() const
@@ -58,11 +81,15 @@ bool DbgRenderSystem::IsVulkan() const
 SwapChain* DbgRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
     /* Create swap-chain and flush frame profile on SwapChain::Present() calls  */
-    return swapChains_.emplace<DbgSwapChain>(
+    auto* swapChainDbg = swapChains_.emplace<DbgSwapChain>(
         *instance_->CreateSwapChain(swapChainDesc, surface),
         swapChainDesc,
+        profile_,
+        debugger_,
         std::bind(&DbgRenderSystem::FlushProfile, this)
     );
+    capture_.RecordSwapChain(*swapChainDbg, swapChainDesc);
+    return swapChainDbg;
 }
 
 void DbgRenderSystem::Release(SwapChain& swapChain)
@@ -70,6 +97,11 @@ void DbgRenderSystem::Release(SwapChain& swapChain)
     ReleaseDbg(swapChains_, swapChain);
 }
 
+void DbgRenderSystem::PrepareSwapChainAsync(const SwapChainDescriptor& swapChainDesc)
+{
+    instance_->PrepareSwapChainAsync(swapChainDesc);
+}
+
 /* ----- Command queues ----- */
 
 CommandQueue* DbgRenderSystem::GetCommandQueue()
@@ -77,6 +109,11 @@ CommandQueue* DbgRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* DbgRenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    return &(GetDbgCommandQueue(type));
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -90,16 +127,26 @@ CommandBuffer* DbgRenderSystem::CreateCommandBuffer(const CommandBufferDescripto
         instanceCommandBufferDesc.renderPass            = (commandBufferDesc.renderPass != nullptr
                                                         ? &(LLGL_CAST(const DbgRenderPass*, commandBufferDesc.renderPass)->instance)
                                                         : nullptr);
+        instanceCommandBufferDesc.queueType             = commandBufferDesc.queueType;
     }
-    return commandBuffers_.emplace<DbgCommandBuffer>(
+
+    /* Secondary command buffers are always executed by primary command buffers, so they belong to the primary queue */
+    const bool isSecondaryCmdBuffer = ((commandBufferDesc.flags & CommandBufferFlags::Secondary) != 0);
+    DbgCommandQueue& commandQueueDbg = GetDbgCommandQueue(isSecondaryCmdBuffer ? CommandQueueType::Graphics : commandBufferDesc.queueType);
+
+    auto* commandBufferDbg = commandBuffers_.emplace<DbgCommandBuffer>(
         *instance_,
-        commandQueue_->instance,
+        commandQueueDbg.instance,
+        commandQueueDbg.GetQueryScopePool(),
         *instance_->CreateCommandBuffer(instanceCommandBufferDesc),
         profile_,
+        capture_,
         debugger_,
         commandBufferDesc,
         GetRenderingCaps()
     );
+    capture_.RecordCommandBuffer(*commandBufferDbg, commandBufferDesc);
+    return commandBufferDbg;
 }
 
 void DbgRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -123,9 +170,41 @@ Buffer* DbgRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const
         bufferDbg->elements     = (formatSize > 0 ? bufferDesc.size / formatSize : 0);
         bufferDbg->initialized  = (initialData != nullptr);
     }
+    capture_.RecordBuffer(*bufferDbg, bufferDesc, initialData);
+    CheckMemoryBudget();
     return bufferDbg;
 }
 
+void DbgRenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    /* Validate and store format sizes (if supported) */
+    std::vector<std::uint32_t> formatSizes(bufferDescs.size(), 0u);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        for_range(i, bufferDescs.size())
+            ValidateBufferDesc(bufferDescs[i], &formatSizes[i]);
+    }
+
+    /* Create buffer objects as a batch, then wrap each instance into a debug buffer */
+    instance_->CreateBuffers(bufferDescs, initialData, outBuffers);
+
+    for_range(i, bufferDescs.size())
+    {
+        const BufferDescriptor& bufferDesc = bufferDescs[i];
+        const void* bufferInitialData = (initialData != nullptr ? initialData[i] : nullptr);
+        auto* bufferDbg = buffers_.emplace<DbgBuffer>(*outBuffers[i], bufferDesc);
+        {
+            bufferDbg->elements     = (formatSizes[i] > 0 ? bufferDesc.size / formatSizes[i] : 0);
+            bufferDbg->initialized  = (bufferInitialData != nullptr);
+        }
+        capture_.RecordBuffer(*bufferDbg, bufferDesc, bufferInitialData);
+        outBuffers[i] = bufferDbg;
+    }
+
+    CheckMemoryBudget();
+}
+
 BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     RenderSystem::AssertCreateBufferArray(numBuffers, bufferArray);
@@ -143,7 +222,9 @@ BufferArray* DbgRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer
 
     /* Create native buffer and debug buffer */
     auto* bufferArrayInstance = instance_->CreateBufferArray(numBuffers, bufferInstanceArray.data());
-    return bufferArrays_.emplace<DbgBufferArray>(*bufferArrayInstance, GetCombinedBindFlags(numBuffers, bufferArray), std::move(bufferDbgArray));
+    auto* bufferArrayDbg = bufferArrays_.emplace<DbgBufferArray>(*bufferArrayInstance, GetCombinedBindFlags(numBuffers, bufferArray), std::move(bufferDbgArray));
+    capture_.RecordBufferArray(*bufferArrayDbg, numBuffers, bufferArray);
+    return bufferArrayDbg;
 }
 
 void DbgRenderSystem::Release(Buffer& buffer)
@@ -151,6 +232,23 @@ void DbgRenderSystem::Release(Buffer& buffer)
     ReleaseDbg(buffers_, buffer);
 }
 
+void DbgRenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    /* Release buffer instances as a batch, then release the debug buffers */
+    std::vector<Buffer*> bufferInstances(buffers.size());
+    for_range(i, buffers.size())
+    {
+        auto* bufferDbg = LLGL_CAST(DbgBuffer*, buffers[i]);
+        capture_.RecordRelease(bufferDbg);
+        bufferInstances[i] = &(bufferDbg->instance);
+    }
+
+    instance_->Release(ArrayView<Buffer*>{ bufferInstances });
+
+    for (Buffer* buffer : buffers)
+        buffers_.erase(buffer);
+}
+
 void DbgRenderSystem::Release(BufferArray& bufferArray)
 {
     ReleaseDbg(bufferArrays_, bufferArray);
@@ -176,6 +274,8 @@ void DbgRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const vo
 
     instance_->WriteBuffer(bufferDbg.instance, offset, data, dataSize);
 
+    capture_.RecordWriteBuffer(bufferDbg, offset, data, dataSize);
+
     profile_.commandQueueRecord.bufferWrites++;
 }
 
@@ -211,7 +311,10 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
     auto result = instance_->MapBuffer(bufferDbg.instance, access);
 
     if (result != nullptr)
+    {
         bufferDbg.OnMap(access, 0, bufferDbg.desc.size);
+        capture_.RecordMapBuffer(bufferDbg, access, 0, bufferDbg.desc.size, result);
+    }
 
     profile_.commandQueueRecord.bufferMappings++;
 
@@ -232,7 +335,10 @@ void* DbgRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::ui
     auto result = instance_->MapBuffer(bufferDbg.instance, access, offset, length);
 
     if (result != nullptr)
+    {
         bufferDbg.OnMap(access, offset, length);
+        capture_.RecordMapBuffer(bufferDbg, access, offset, length, result);
+    }
 
     profile_.commandQueueRecord.bufferMappings++;
 
@@ -246,25 +352,101 @@ void DbgRenderSystem::UnmapBuffer(Buffer& buffer)
     if (LLGL_DBG_SOURCE())
         ValidateBufferMapping(bufferDbg, false);
 
+    /* Record mapped content before it is unmapped */
+    capture_.RecordUnmapBuffer(bufferDbg);
+
     instance_->UnmapBuffer(bufferDbg.instance);
 
     bufferDbg.OnUnmap();
 }
 
+void DbgRenderSystem::FlushMappedRange(Buffer& buffer, std::uint64_t offset, std::uint64_t length)
+{
+    auto& bufferDbg = LLGL_CAST(DbgBuffer&, buffer);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        if (!bufferDbg.IsMappedForCPUAccess())
+            LLGL_DBG_ERROR(ErrorType::InvalidState, "cannot flush mapped range of buffer that is not mapped to CPU memory space");
+        ValidateBufferBoundary(bufferDbg.desc.size, offset, length);
+    }
+
+    instance_->FlushMappedRange(bufferDbg.instance, offset, length);
+}
+
+AccelerationStructureSizes DbgRenderSystem::GetAccelerationStructureSizes(const AccelerationStructureDescriptor& accelerationStructureDesc)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (!GetRenderingCaps().features.hasRayTracing)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("ray tracing");
+    }
+
+    /* Buffers are ignored by the size query, so the descriptor can be passed on with its debug wrappers */
+    return instance_->GetAccelerationStructureSizes(accelerationStructureDesc);
+}
+
 /* ----- Textures ----- */
 
 Texture* DbgRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
     if (LLGL_DBG_SOURCE())
         ValidateTextureDesc(textureDesc, initialImage);
-    return textures_.emplace<DbgTexture>(*instance_->CreateTexture(textureDesc, initialImage), textureDesc);
+    auto* textureDbg = textures_.emplace<DbgTexture>(*instance_->CreateTexture(textureDesc, initialImage), textureDesc);
+    capture_.RecordTexture(*textureDbg, textureDesc, initialImage);
+    CheckMemoryBudget();
+    return textureDbg;
+}
+
+void DbgRenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        for_range(i, textureDescs.size())
+            ValidateTextureDesc(textureDescs[i], (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr));
+    }
+
+    /* Create texture objects as a batch, then wrap each instance into a debug texture */
+    instance_->CreateTextures(textureDescs, initialImages, outTextures);
+
+    for_range(i, textureDescs.size())
+    {
+        const ImageView* initialImage = (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr);
+        auto* textureDbg = textures_.emplace<DbgTexture>(*outTextures[i], textureDescs[i]);
+        capture_.RecordTexture(*textureDbg, textureDescs[i], initialImage);
+        outTextures[i] = textureDbg;
+    }
+
+    CheckMemoryBudget();
 }
 
 void DbgRenderSystem::Release(Texture& texture)
 {
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+    if (textureDbg.placementHeap != nullptr)
+        textureDbg.placementHeap->numPlacedTextures--;
     ReleaseDbg(textures_, texture);
 }
 
+void DbgRenderSystem::Release(const ArrayView<Texture*>& textures)
+{
+    /* Release texture instances as a batch, then release the debug textures */
+    std::vector<Texture*> textureInstances(textures.size());
+    for_range(i, textures.size())
+    {
+        auto* textureDbg = LLGL_CAST(DbgTexture*, textures[i]);
+        if (textureDbg->placementHeap != nullptr)
+            textureDbg->placementHeap->numPlacedTextures--;
+        capture_.RecordRelease(textureDbg);
+        textureInstances[i] = &(textureDbg->instance);
+    }
+
+    instance_->Release(ArrayView<Texture*>{ textureInstances });
+
+    for (Texture* texture : textures)
+        textures_.erase(texture);
+}
+
 void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -277,9 +459,94 @@ void DbgRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textur
 
     instance_->WriteTexture(textureDbg.instance, textureRegion, srcImageView);
 
+    capture_.RecordWriteTexture(textureDbg, textureRegion, srcImageView);
+
     profile_.commandQueueRecord.textureWrites++;
 }
 
+void DbgRenderSystem::WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (numUploads > 0 && uploads == nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot write textures asynchronously with null pointer for %u upload descriptor(s)", numUploads);
+            return;
+        }
+        for_range(i, numUploads)
+        {
+            if (uploads[i].texture == nullptr)
+            {
+                LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot write texture asynchronously with null pointer in upload descriptor [%u]", i);
+                return;
+            }
+        }
+    }
+
+    /* Replace debug textures by their instances before forwarding the uploads */
+    std::vector<TextureUploadDescriptor> uploadsInstance(uploads, uploads + numUploads);
+
+    for (TextureUploadDescriptor& upload : uploadsInstance)
+    {
+        auto& textureDbg = LLGL_CAST(DbgTexture&, *upload.texture);
+
+        if (LLGL_DBG_SOURCE())
+        {
+            ValidateTextureRegion(textureDbg, upload.region);
+            ValidateImageView(upload.imageView, textureDbg.desc, &upload.region);
+        }
+
+        upload.texture = &(textureDbg.instance);
+    }
+
+    instance_->WriteTextureAsync(numUploads, uploadsInstance.data(), fence);
+
+    /* Asynchronous uploads are captured as synchronous texture writes */
+    for_range(i, numUploads)
+        capture_.RecordWriteTexture(LLGL_CAST(DbgTexture&, *uploads[i].texture), uploads[i].region, uploads[i].imageView);
+
+    profile_.commandQueueRecord.textureWrites += numUploads;
+}
+
+void DbgRenderSystem::WriteFromFileAsync(std::uint32_t numUploads, const FileUploadDescriptor* uploads, Fence* fence)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (numUploads > 0 && uploads == nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot write resources from file with null pointer for %u upload descriptor(s)", numUploads);
+            return;
+        }
+        for_range(i, numUploads)
+            ValidateFileUpload(uploads[i], i);
+    }
+
+    /* Replace debug resources by their instances before forwarding the uploads */
+    std::vector<FileUploadDescriptor> uploadsInstance(uploads, uploads + numUploads);
+
+    for (FileUploadDescriptor& upload : uploadsInstance)
+    {
+        if (upload.buffer != nullptr)
+        {
+            auto& bufferDbg = LLGL_CAST(DbgBuffer&, *upload.buffer);
+            bufferDbg.initialized = true;
+            upload.buffer = &(bufferDbg.instance);
+        }
+        if (upload.texture != nullptr)
+            upload.texture = &(LLGL_CAST(DbgTexture&, *upload.texture).instance);
+    }
+
+    instance_->WriteFromFileAsync(numUploads, uploadsInstance.data(), fence);
+
+    for_range(i, numUploads)
+    {
+        if (uploads[i].buffer != nullptr)
+            profile_.commandQueueRecord.bufferWrites++;
+        else
+            profile_.commandQueueRecord.textureWrites++;
+    }
+}
+
 void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
     auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
@@ -295,16 +562,222 @@ void DbgRenderSystem::ReadTexture(Texture& texture, const TextureRegion& texture
     profile_.commandQueueRecord.textureReads++;
 }
 
+void DbgRenderSystem::ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence)
+{
+    auto& textureDbg = LLGL_CAST(DbgTexture&, texture);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        ValidateTextureRegion(textureDbg, textureRegion);
+        ValidateImageView(ImageView{ dstImageView }, textureDbg.desc, &textureRegion);
+    }
+
+    instance_->ReadTextureAsync(textureDbg.instance, textureRegion, dstImageView, fence);
+
+    profile_.commandQueueRecord.textureReads++;
+}
+
+/* ----- Placement Heaps ----- */
+
+PlacementHeap* DbgRenderSystem::CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        if (!GetRenderingCaps().features.hasPlacementHeaps)
+            LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, "placement heaps not supported");
+        if (placementHeapDesc.size == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create placement heap with size of zero");
+    }
+
+    /* Placement heaps are optional, so the instance may return null */
+    PlacementHeap* placementHeap = instance_->CreatePlacementHeap(placementHeapDesc);
+    if (placementHeap == nullptr)
+        return nullptr;
+
+    auto* placementHeapDbg = placementHeaps_.emplace<DbgPlacementHeap>(*placementHeap, placementHeapDesc);
+    CheckMemoryBudget();
+    return placementHeapDbg;
+}
+
+void DbgRenderSystem::Release(PlacementHeap& placementHeap)
+{
+    auto& placementHeapDbg = LLGL_CAST(DbgPlacementHeap&, placementHeap);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        if (placementHeapDbg.numPlacedTextures > 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "releasing placement heap while %u placed texture(s) are still alive",
+                placementHeapDbg.numPlacedTextures
+            );
+        }
+    }
+
+    ReleaseDbg(placementHeaps_, placementHeap);
+}
+
+MemoryRequirements DbgRenderSystem::GetTextureMemoryRequirements(const TextureDescriptor& textureDesc)
+{
+    return instance_->GetTextureMemoryRequirements(textureDesc);
+}
+
+Texture* DbgRenderSystem::CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    auto& placementHeapDbg = LLGL_CAST(DbgPlacementHeap&, placementHeap);
+
+    if (LLGL_DBG_SOURCE())
+    {
+        ValidateTextureDesc(textureDesc);
+        ValidatePlacedTexture(placementHeapDbg, offset, textureDesc);
+    }
+
+    auto* textureDbg = textures_.emplace<DbgTexture>(*instance_->CreatePlacedTexture(placementHeapDbg.instance, offset, textureDesc), textureDesc);
+    {
+        textureDbg->placementHeap = &placementHeapDbg;
+        placementHeapDbg.numPlacedTextures++;
+    }
+    capture_.RecordTexture(*textureDbg, textureDesc, nullptr);
+    return textureDbg;
+}
+
+/* ----- Sampler Feedback ----- */
+
+Texture* DbgRenderSystem::CreateSamplerFeedbackTexture(const SamplerFeedbackDescriptor& samplerFeedbackDesc)
+{
+    if (LLGL_DBG_SOURCE())
+        ValidateSamplerFeedbackDesc(samplerFeedbackDesc);
+
+    /* Forward paired texture instance to the actual render system */
+    SamplerFeedbackDescriptor instanceDesc = samplerFeedbackDesc;
+    if (instanceDesc.pairedTexture != nullptr)
+        instanceDesc.pairedTexture = &(LLGL_CAST(DbgTexture*, instanceDesc.pairedTexture)->instance);
+
+    /* Sampler feedback is optional, so the instance may return null */
+    Texture* instance = instance_->CreateSamplerFeedbackTexture(instanceDesc);
+    if (instance == nullptr)
+        return nullptr;
+
+    /* Sampler feedback textures are not recorded by the capture, since their content is only written by the GPU */
+    auto* textureDbg = textures_.emplace<DbgTexture>(*instance, instance->GetDesc());
+    {
+        textureDbg->feedbackDesc = samplerFeedbackDesc;
+        if (samplerFeedbackDesc.debugName != nullptr)
+            textureDbg->SetDebugName(samplerFeedbackDesc.debugName);
+    }
+    CheckMemoryBudget();
+    return textureDbg;
+}
+
+/* ----- Shared Resources ----- */
+
+bool DbgRenderSystem::ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle)
+{
+    Resource* resourceInstance = nullptr;
+    long miscFlags = 0;
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferDbg = LLGL_CAST(DbgBuffer&, resource);
+            resourceInstance    = &(bufferDbg.instance);
+            miscFlags           = bufferDbg.desc.miscFlags;
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureDbg = LLGL_CAST(DbgTexture&, resource);
+            resourceInstance    = &(textureDbg.instance);
+            miscFlags           = textureDbg.desc.miscFlags;
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    if (LLGL_DBG_SOURCE())
+    {
+        if (resourceInstance == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot export shared handle of resource that is neither a buffer nor a texture");
+        else if ((miscFlags & MiscFlags::Shared) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot export shared handle of resource that was not created with 'LLGL::MiscFlags::Shared'");
+    }
+
+    return (resourceInstance != nullptr && instance_->ExportSharedHandle(*resourceInstance, outHandle));
+}
+
+Texture* DbgRenderSystem::ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        ValidateTextureDesc(textureDesc);
+        if ((textureDesc.miscFlags & MiscFlags::Shared) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot import texture without 'LLGL::MiscFlags::Shared'");
+        if (sharedHandle.type == SharedHandleType::Undefined)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot import texture from shared handle of undefined type");
+    }
+
+    /* Shared resources are optional, so the instance may return null */
+    Texture* texture = instance_->ImportTexture(textureDesc, sharedHandle);
+    if (texture == nullptr)
+        return nullptr;
+
+    auto* textureDbg = textures_.emplace<DbgTexture>(*texture, textureDesc);
+    capture_.RecordTexture(*textureDbg, textureDesc, nullptr);
+    return textureDbg;
+}
+
+Buffer* DbgRenderSystem::ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle)
+{
+    std::uint32_t formatSize = 0;
+
+    if (LLGL_DBG_SOURCE())
+    {
+        ValidateBufferDesc(bufferDesc, &formatSize);
+        if ((bufferDesc.miscFlags & MiscFlags::Shared) == 0)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot import buffer without 'LLGL::MiscFlags::Shared'");
+        if (sharedHandle.type == SharedHandleType::Undefined)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot import buffer from shared handle of undefined type");
+    }
+
+    /* Shared resources are optional, so the instance may return null */
+    Buffer* buffer = instance_->ImportBuffer(bufferDesc, sharedHandle);
+    if (buffer == nullptr)
+        return nullptr;
+
+    /* Imported content was written by the exporting render system */
+    auto* bufferDbg = buffers_.emplace<DbgBuffer>(*buffer, bufferDesc);
+    {
+        bufferDbg->elements     = (formatSize > 0 ? bufferDesc.size / formatSize : 0);
+        bufferDbg->initialized  = true;
+    }
+    capture_.RecordBuffer(*bufferDbg, bufferDesc, nullptr);
+    return bufferDbg;
+}
+
+bool DbgRenderSystem::ExportSharedFence(Fence& fence, SharedResourceHandle& outHandle)
+{
+    /* Fences are not wrapped by the debug layer */
+    return instance_->ExportSharedFence(fence, outHandle);
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* DbgRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
-    return instance_->CreateSampler(samplerDesc);
+    Sampler* sampler = instance_->CreateSampler(samplerDesc);
+    capture_.RecordSampler(*sampler, samplerDesc);
+    return sampler;
     //return samplers_.emplace<DbgSampler>();
 }
 
 void DbgRenderSystem::Release(Sampler& sampler)
 {
+    capture_.RecordRelease(&sampler);
     instance_->Release(sampler);
     //ReleaseDbg(samplers_, sampler);
 }
@@ -377,10 +850,12 @@ ResourceHeap* DbgRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor&
         auto pipelineLayoutDbg = LLGL_CAST(DbgPipelineLayout*, resourceHeapDesc.pipelineLayout);
         instanceDesc.pipelineLayout = &(pipelineLayoutDbg->instance);
     }
-    return resourceHeaps_.emplace<DbgResourceHeap>(
+    auto* resourceHeapDbg = resourceHeaps_.emplace<DbgResourceHeap>(
         *instance_->CreateResourceHeap(instanceDesc, instanceResourceViews),
         resourceHeapDesc
     );
+    capture_.RecordResourceHeap(*resourceHeapDbg, resourceHeapDesc, initialResourceViews);
+    return resourceHeapDbg;
 }
 
 void DbgRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -396,6 +871,7 @@ std::uint32_t DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std
         ValidateResourceHeapRange(resourceHeapDbg, firstDescriptor, resourceViews);
 
     auto instanceResourceViews = GetResourceViewInstanceCopy(resourceViews);
+    capture_.RecordWriteResourceHeap(resourceHeapDbg, firstDescriptor, resourceViews);
     return instance_->WriteResourceHeap(resourceHeapDbg.instance, firstDescriptor, instanceResourceViews);
 }
 
@@ -403,7 +879,12 @@ std::uint32_t DbgRenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std
 
 RenderPass* DbgRenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
 {
-    return renderPasses_.emplace<DbgRenderPass>(*instance_->CreateRenderPass(renderPassDesc), renderPassDesc);
+    if (LLGL_DBG_SOURCE())
+        ValidateViewMask(renderPassDesc.viewMask, nullptr, "render pass");
+
+    auto* renderPassDbg = renderPasses_.emplace<DbgRenderPass>(*instance_->CreateRenderPass(renderPassDesc), renderPassDesc);
+    capture_.RecordRenderPass(*renderPassDbg, renderPassDesc);
+    return renderPassDbg;
 }
 
 void DbgRenderSystem::Release(RenderPass& renderPass)
@@ -412,6 +893,7 @@ void DbgRenderSystem::Release(RenderPass& renderPass)
     auto& renderPassDbg = LLGL_CAST(DbgRenderPass&, renderPass);
     if (RenderPass* instance = renderPassDbg.mutableInstance)
     {
+        capture_.RecordRelease(&renderPassDbg);
         instance_->Release(*instance);
         renderPasses_.erase(&renderPass);
     }
@@ -431,7 +913,7 @@ RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
         {
             if (IsAttachmentEnabled(attachmentDesc))
             {
-                if (debugger_)
+                if (DbgIsValidationEnabled(debugger_))
                     ValidateAttachmentDesc(attachmentDesc, colorTarget, isResolveAttachment, isDepthStencilAttachment);
                 attachmentDesc.texture = DbgGetInstance<DbgTexture>(attachmentDesc.texture);
             }
@@ -443,8 +925,21 @@ RenderTarget* DbgRenderSystem::CreateRenderTarget(const RenderTargetDescriptor&
             TransferDbgAttachment(instanceDesc.resolveAttachments[colorTarget], colorTarget, /*isResolveAttachment:*/ true, /*isDepthStencilAttachment:*/ false);
         }
         TransferDbgAttachment(instanceDesc.depthStencilAttachment, 0, /*isResolveAttachment:*/ false, /*isDepthStencilAttachment:*/ true);
+
+        /* Shading-rate attachments are only read by the rasterizer and always refer to a texture */
+        if (instanceDesc.shadingRateAttachment.texture != nullptr)
+        {
+            if (DbgIsValidationEnabled(debugger_))
+                ValidateShadingRateAttachmentDesc(instanceDesc.shadingRateAttachment, renderTargetDesc.resolution);
+            instanceDesc.shadingRateAttachment.texture = DbgGetInstance<DbgTexture>(instanceDesc.shadingRateAttachment.texture);
+        }
+
+        if (DbgIsValidationEnabled(debugger_))
+            ValidateRenderTargetViewMask(renderTargetDesc);
     }
-    return renderTargets_.emplace<DbgRenderTarget>(*instance_->CreateRenderTarget(instanceDesc), renderTargetDesc);
+    auto* renderTargetDbg = renderTargets_.emplace<DbgRenderTarget>(*instance_->CreateRenderTarget(instanceDesc), renderTargetDesc);
+    capture_.RecordRenderTarget(*renderTargetDbg, renderTargetDesc);
+    return renderTargetDbg;
 }
 
 void DbgRenderSystem::Release(RenderTarget& renderTarget)
@@ -458,7 +953,27 @@ Shader* DbgRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     if (LLGL_DBG_SOURCE())
         ValidateShaderDesc(shaderDesc);
-    return shaders_.emplace<DbgShader>(*instance_->CreateShader(shaderDesc), shaderDesc);
+    auto* shaderDbg = shaders_.emplace<DbgShader>(*instance_->CreateShader(shaderDesc), shaderDesc);
+    capture_.RecordShader(*shaderDbg, shaderDesc);
+    return shaderDbg;
+}
+
+void DbgRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        for (const ShaderDescriptor& shaderDesc : shaderDescs)
+            ValidateShaderDesc(shaderDesc);
+    }
+
+    instance_->CreateShaders(shaderDescs, outShaders);
+
+    for_range(i, shaderDescs.size())
+    {
+        auto* shaderDbg = shaders_.emplace<DbgShader>(*outShaders[i], shaderDescs[i]);
+        capture_.RecordShader(*shaderDbg, shaderDescs[i]);
+        outShaders[i] = shaderDbg;
+    }
 }
 
 void DbgRenderSystem::Release(Shader& shader)
@@ -472,7 +987,9 @@ PipelineLayout* DbgRenderSystem::CreatePipelineLayout(const PipelineLayoutDescri
 {
     if (LLGL_DBG_SOURCE())
         ValidatePipelineLayoutDesc(pipelineLayoutDesc);
-    return pipelineLayouts_.emplace<DbgPipelineLayout>(*instance_->CreatePipelineLayout(pipelineLayoutDesc), pipelineLayoutDesc);
+    auto* pipelineLayoutDbg = pipelineLayouts_.emplace<DbgPipelineLayout>(*instance_->CreatePipelineLayout(pipelineLayoutDesc), pipelineLayoutDesc);
+    capture_.RecordPipelineLayout(*pipelineLayoutDbg, pipelineLayoutDesc);
+    return pipelineLayoutDbg;
 }
 
 void DbgRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -494,11 +1011,9 @@ void DbgRenderSystem::Release(PipelineCache& pipelineCache)
 
 /* ----- Pipeline States ----- */
 
-PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+// Returns a copy of the specified graphics PSO descriptor with all debug layer objects replaced by their instances.
+static GraphicsPipelineDescriptor GetInstanceGraphicsPipelineDesc(const GraphicsPipelineDescriptor& pipelineStateDesc)
 {
-    if (LLGL_DBG_SOURCE())
-        ValidateGraphicsPipelineDesc(pipelineStateDesc);
-
     GraphicsPipelineDescriptor instanceDesc = pipelineStateDesc;
     {
         if (pipelineStateDesc.pipelineLayout != nullptr)
@@ -509,9 +1024,36 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescri
         instanceDesc.tessControlShader      = DbgGetInstance<DbgShader>(pipelineStateDesc.tessControlShader);
         instanceDesc.tessEvaluationShader   = DbgGetInstance<DbgShader>(pipelineStateDesc.tessEvaluationShader);
         instanceDesc.geometryShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.geometryShader);
+        instanceDesc.taskShader             = DbgGetInstance<DbgShader>(pipelineStateDesc.taskShader);
+        instanceDesc.meshShader             = DbgGetInstance<DbgShader>(pipelineStateDesc.meshShader);
+        instanceDesc.tileShader             = DbgGetInstance<DbgShader>(pipelineStateDesc.tileShader);
         instanceDesc.fragmentShader         = DbgGetInstance<DbgShader>(pipelineStateDesc.fragmentShader);
     }
-    return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+    return instanceDesc;
+}
+
+// Returns a copy of the specified compute PSO descriptor with all debug layer objects replaced by their instances.
+static ComputePipelineDescriptor GetInstanceComputePipelineDesc(const ComputePipelineDescriptor& pipelineStateDesc)
+{
+    ComputePipelineDescriptor instanceDesc = pipelineStateDesc;
+    {
+        if (pipelineStateDesc.pipelineLayout != nullptr)
+            instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, pipelineStateDesc.pipelineLayout)->instance);
+
+        instanceDesc.computeShader = DbgGetInstance<DbgShader>(pipelineStateDesc.computeShader);
+    }
+    return instanceDesc;
+}
+
+PipelineState* DbgRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    if (LLGL_DBG_SOURCE())
+        ValidateGraphicsPipelineDesc(pipelineStateDesc);
+
+    const GraphicsPipelineDescriptor instanceDesc = GetInstanceGraphicsPipelineDesc(pipelineStateDesc);
+    auto* pipelineStateDbg = pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+    capture_.RecordPipelineState(*pipelineStateDbg, pipelineStateDesc);
+    return pipelineStateDbg;
 }
 
 PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
@@ -519,14 +1061,84 @@ PipelineState* DbgRenderSystem::CreatePipelineState(const ComputePipelineDescrip
     if (LLGL_DBG_SOURCE())
         ValidateComputePipelineDesc(pipelineStateDesc);
 
-    ComputePipelineDescriptor instanceDesc = pipelineStateDesc;
+    const ComputePipelineDescriptor instanceDesc = GetInstanceComputePipelineDesc(pipelineStateDesc);
+    auto* pipelineStateDbg = pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+    capture_.RecordPipelineState(*pipelineStateDbg, pipelineStateDesc);
+    return pipelineStateDbg;
+}
+
+void DbgRenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        for (const GraphicsPipelineDescriptor& pipelineStateDesc : pipelineStateDescs)
+            ValidateGraphicsPipelineDesc(pipelineStateDesc);
+    }
+
+    std::vector<GraphicsPipelineDescriptor> instanceDescs;
+    instanceDescs.reserve(pipelineStateDescs.size());
+    for (const GraphicsPipelineDescriptor& pipelineStateDesc : pipelineStateDescs)
+        instanceDescs.push_back(GetInstanceGraphicsPipelineDesc(pipelineStateDesc));
+
+    instance_->CreatePipelineStates(instanceDescs, outPipelineStates, pipelineCache);
+
+    for_range(i, pipelineStateDescs.size())
+    {
+        auto* pipelineStateDbg = pipelineStates_.emplace<DbgPipelineState>(*outPipelineStates[i], pipelineStateDescs[i]);
+        capture_.RecordPipelineState(*pipelineStateDbg, pipelineStateDescs[i]);
+        outPipelineStates[i] = pipelineStateDbg;
+    }
+}
+
+void DbgRenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    if (LLGL_DBG_SOURCE())
+    {
+        for (const ComputePipelineDescriptor& pipelineStateDesc : pipelineStateDescs)
+            ValidateComputePipelineDesc(pipelineStateDesc);
+    }
+
+    std::vector<ComputePipelineDescriptor> instanceDescs;
+    instanceDescs.reserve(pipelineStateDescs.size());
+    for (const ComputePipelineDescriptor& pipelineStateDesc : pipelineStateDescs)
+        instanceDescs.push_back(GetInstanceComputePipelineDesc(pipelineStateDesc));
+
+    instance_->CreatePipelineStates(instanceDescs, outPipelineStates, pipelineCache);
+
+    for_range(i, pipelineStateDescs.size())
+    {
+        auto* pipelineStateDbg = pipelineStates_.emplace<DbgPipelineState>(*outPipelineStates[i], pipelineStateDescs[i]);
+        capture_.RecordPipelineState(*pipelineStateDbg, pipelineStateDescs[i]);
+        outPipelineStates[i] = pipelineStateDbg;
+    }
+}
+
+PipelineState* DbgRenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    if (LLGL_DBG_SOURCE())
+        ValidateRayTracingPipelineDesc(pipelineStateDesc);
+
+    RayTracingPipelineDescriptor instanceDesc = pipelineStateDesc;
     {
         if (pipelineStateDesc.pipelineLayout != nullptr)
             instanceDesc.pipelineLayout = &(LLGL_CAST(const DbgPipelineLayout*, pipelineStateDesc.pipelineLayout)->instance);
 
-        instanceDesc.computeShader = DbgGetInstance<DbgShader>(pipelineStateDesc.computeShader);
+        instanceDesc.rayGenerationShader = DbgGetInstance<DbgShader>(pipelineStateDesc.rayGenerationShader);
+        for (Shader*& missShader : instanceDesc.missShaders)
+            missShader = DbgGetInstance<DbgShader>(missShader);
+        for (RayTracingHitGroupDescriptor& hitGroup : instanceDesc.hitGroups)
+        {
+            hitGroup.closestHitShader   = DbgGetInstance<DbgShader>(hitGroup.closestHitShader);
+            hitGroup.anyHitShader       = DbgGetInstance<DbgShader>(hitGroup.anyHitShader);
+        }
     }
-    return pipelineStates_.emplace<DbgPipelineState>(*instance_->CreatePipelineState(instanceDesc, pipelineCache), pipelineStateDesc);
+
+    /* Ray tracing PSOs are not part of the capture format, so they are not recorded */
+    PipelineState* pipelineStateInstance = instance_->CreatePipelineState(instanceDesc, pipelineCache);
+    if (pipelineStateInstance == nullptr)
+        return nullptr;
+
+    return pipelineStates_.emplace<DbgPipelineState>(*pipelineStateInstance, pipelineStateDesc);
 }
 
 void DbgRenderSystem::Release(PipelineState& pipelineState)
@@ -538,7 +1150,12 @@ void DbgRenderSystem::Release(PipelineState& pipelineState)
 
 QueryHeap* DbgRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
 {
-    return queryHeaps_.emplace<DbgQueryHeap>(*instance_->CreateQueryHeap(queryHeapDesc), queryHeapDesc);
+    if (LLGL_DBG_SOURCE())
+        ValidateQueryHeapDesc(queryHeapDesc);
+
+    auto* queryHeapDbg = queryHeaps_.emplace<DbgQueryHeap>(*instance_->CreateQueryHeap(queryHeapDesc), queryHeapDesc);
+    capture_.RecordQueryHeap(*queryHeapDbg, queryHeapDesc);
+    return queryHeapDbg;
 }
 
 void DbgRenderSystem::Release(QueryHeap& queryHeap)
@@ -579,6 +1196,16 @@ bool DbgRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapab
     return true;
 }
 
+std::uint32_t DbgRenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos)
+{
+    return instance_->QueryMemoryHeaps(outHeapInfos, maxHeapInfos);
+}
+
+std::uint32_t DbgRenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    return instance_->QueryAdapters(outAdapters, maxAdapters);
+}
+
 void DbgRenderSystem::ValidateBindFlags(long flags, Format format, ResourceType resourceType)
 {
     constexpr long bufferOnlyFlags =
@@ -587,13 +1214,16 @@ void DbgRenderSystem::ValidateBindFlags(long flags, Format format, ResourceType
         BindFlags::IndexBuffer          |
         BindFlags::ConstantBuffer       |
         BindFlags::StreamOutputBuffer   |
-        BindFlags::IndirectBuffer
+        BindFlags::IndirectBuffer       |
+        BindFlags::AccelerationStructure|
+        BindFlags::ComputeStreamOutput
     );
 
     constexpr long textureOnlyFlags =
     (
         BindFlags::ColorAttachment          |
-        BindFlags::DepthStencilAttachment
+        BindFlags::DepthStencilAttachment   |
+        BindFlags::ShadingRateAttachment
     );
 
     constexpr long validFlags =
@@ -694,6 +1324,42 @@ void DbgRenderSystem::ValidateBindFlags(long flags, Format format, ResourceType
             "cannot combine bind flag LLGL::BindFlags::ConstantBuffer with any other bind flag except LLGL::BindFlags::CopySrc and LLGL::BindFlags::CopyDst"
         );
     }
+
+    if ((flags & BindFlags::AccelerationStructure) != 0)
+    {
+        if (!GetRenderingCaps().features.hasRayTracing)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("ray tracing acceleration structures");
+        if ((flags & ~(BindFlags::AccelerationStructure | BindFlags::Sampled)) != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot combine bind flag LLGL::BindFlags::AccelerationStructure with any other bind flag except LLGL::BindFlags::Sampled"
+            );
+        }
+    }
+
+    if ((flags & BindFlags::ComputeStreamOutput) != 0)
+    {
+        constexpr long csoRequiredFlags = (BindFlags::VertexBuffer | BindFlags::Storage | BindFlags::IndirectBuffer);
+        if (!GetRenderingCaps().features.hasComputeShaders)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("compute shaders");
+        if (!GetRenderingCaps().features.hasIndirectDrawing)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("indirect drawing");
+        if ((flags & csoRequiredFlags) != csoRequiredFlags)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "bind flag LLGL::BindFlags::ComputeStreamOutput requires LLGL::BindFlags::VertexBuffer, LLGL::BindFlags::Storage, and LLGL::BindFlags::IndirectBuffer"
+            );
+        }
+        if ((flags & (BindFlags::StreamOutputBuffer | BindFlags::ConstantBuffer)) != 0)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot combine bind flag LLGL::BindFlags::ComputeStreamOutput with LLGL::BindFlags::StreamOutputBuffer or LLGL::BindFlags::ConstantBuffer"
+            );
+        }
+    }
 }
 
 void DbgRenderSystem::ValidateCPUAccessFlags(long flags, long validFlags, const char* contextDesc)
@@ -755,12 +1421,33 @@ void DbgRenderSystem::ValidateCommandBufferDesc(const CommandBufferDescriptor& c
     }
 }
 
+DbgCommandQueue& DbgRenderSystem::GetDbgCommandQueue(const CommandQueueType type)
+{
+    /* Share the primary debug queue if the actual render system has no dedicated queue of this type */
+    CommandQueue* queueInstance = instance_->GetCommandQueue(type);
+    if (queueInstance == nullptr || queueInstance == &(commandQueue_->instance))
+        return *commandQueue_;
+
+    HWObjectInstance<DbgCommandQueue>& queueDbg = (type == CommandQueueType::Compute ? computeQueue_ : copyQueue_);
+    if (!queueDbg)
+        queueDbg = MakeUnique<DbgCommandQueue>(*instance_, *queueInstance, type, profile_, capture_, debugger_);
+
+    return *queueDbg;
+}
+
 void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& bufferDesc, std::uint32_t* formatSizeOut)
 {
     /* Validate flags */
     ValidateBindFlags(bufferDesc.bindFlags, bufferDesc.format, ResourceType::Buffer);
     ValidateCPUAccessFlags(bufferDesc.cpuAccessFlags, CPUAccessFlags::ReadWrite, "buffer");
-    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData), "buffer");
+    ValidateMiscFlags(bufferDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::NoInitialData | MiscFlags::PersistentMapping | MiscFlags::Untracked | MiscFlags::Shared), "buffer");
+
+    if ((bufferDesc.miscFlags & MiscFlags::Shared) != 0 && !GetRenderingCaps().features.hasSharedResources)
+        LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, "shared resources not supported");
+
+    /* Validate persistent mapping has CPU access */
+    if ((bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0 && bufferDesc.cpuAccessFlags == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create persistently mapped buffer without CPU access flags");
 
     /* Validate (constant-) buffer size */
     if ((bufferDesc.bindFlags & BindFlags::ConstantBuffer) != 0)
@@ -768,6 +1455,16 @@ void DbgRenderSystem::ValidateBufferDesc(const BufferDescriptor& bufferDesc, std
     else
         ValidateBufferSize(bufferDesc.size);
 
+    /* Validate compute stream-output buffer has room for vertices and the trailing draw arguments */
+    if ((bufferDesc.bindFlags & BindFlags::ComputeStreamOutput) != 0 && bufferDesc.size <= sizeof(DrawIndirectArguments))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "compute stream-output buffer size (%" PRIu64 ") must be greater than the size of LLGL::DrawIndirectArguments (%u)",
+            bufferDesc.size, static_cast<unsigned>(sizeof(DrawIndirectArguments))
+        );
+    }
+
     std::uint32_t formatSize = 0;
 
     if ((bufferDesc.bindFlags & BindFlags::VertexBuffer) != 0 && !bufferDesc.vertexAttribs.empty())
@@ -1004,34 +1701,126 @@ void DbgRenderSystem::ValidateTextureDesc(const TextureDescriptor& textureDesc,
             break;
     }
 
-    ValidateTextureFormatSupported(textureDesc.format);
-    ValidateTextureDescMipLevels(textureDesc);
-    ValidateArrayTextureLayers(textureDesc.type, textureDesc.arrayLayers);
-    ValidateBindFlags(textureDesc.bindFlags, textureDesc.format, ResourceType::Texture);
-    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData), "texture");
+    ValidateTextureFormatSupported(textureDesc.format);
+    ValidateTextureDescMipLevels(textureDesc);
+    ValidateArrayTextureLayers(textureDesc.type, textureDesc.arrayLayers);
+    ValidateBindFlags(textureDesc.bindFlags, textureDesc.format, ResourceType::Texture);
+    ValidateMiscFlags(textureDesc.miscFlags, (MiscFlags::DynamicUsage | MiscFlags::FixedSamples | MiscFlags::GenerateMips | MiscFlags::NoInitialData | MiscFlags::Sparse | MiscFlags::Untracked | MiscFlags::Transient | MiscFlags::Shared | MiscFlags::GPUConversion), "texture");
+
+    if ((textureDesc.miscFlags & MiscFlags::Sparse) != 0)
+        ValidateSparseTextureDesc(textureDesc, initialImage);
+    if ((textureDesc.miscFlags & MiscFlags::Transient) != 0)
+        ValidateTransientTextureDesc(textureDesc, initialImage);
+    if ((textureDesc.miscFlags & MiscFlags::Shared) != 0)
+        ValidateSharedTextureDesc(textureDesc);
+    if ((textureDesc.miscFlags & MiscFlags::GPUConversion) != 0 && (textureDesc.bindFlags & BindFlags::Storage) == 0)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperArgument,
+            "'LLGL::MiscFlags::GPUConversion' is ignored for texture without 'LLGL::BindFlags::Storage'; image data will be converted on the CPU"
+        );
+    }
+
+    if (initialImage != nullptr)
+        ValidateImageView(*initialImage, textureDesc);
+
+    /* Check if MIP-map generation is requested  */
+    if ((textureDesc.miscFlags & MiscFlags::GenerateMips) != 0)
+    {
+        if (initialImage == nullptr)
+        {
+            #if 0
+            LLGL_DBG_WARN(
+                WarningType::ImproperArgument,
+                "cannot generate MIP-maps without initial image data: 'LLGL::MiscFlags::GenerateMips' specified but no initial image data"
+            );
+            #endif
+        }
+        else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) != 0)
+        {
+            LLGL_DBG_WARN(
+                WarningType::ImproperArgument,
+                "cannot generate MIP-maps with initial image data discarded: 'LLGL::MiscFlags::GenerateMips' specified but also 'MiscFlags::NoInitialData'"
+            );
+        }
+    }
+}
+
+void DbgRenderSystem::ValidateSparseTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    if (!GetRenderingCaps().features.hasSparseTextures)
+        LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, "sparse textures not supported");
+
+    if (!(textureDesc.type == TextureType::Texture2D || textureDesc.type == TextureType::Texture2DArray))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create sparse texture of type %s; only 2D and 2D-array textures are supported",
+            ToString(textureDesc.type)
+        );
+    }
+
+    if (initialImage != nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create sparse texture with initial image data");
+
+    if ((textureDesc.miscFlags & MiscFlags::GenerateMips) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot generate MIP-maps for sparse texture: 'LLGL::MiscFlags::GenerateMips' specified together with 'LLGL::MiscFlags::Sparse'");
+}
+
+void DbgRenderSystem::ValidateTransientTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    constexpr long attachmentBindFlags = (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment);
+    if ((textureDesc.bindFlags & attachmentBindFlags) == 0 || (textureDesc.bindFlags & ~attachmentBindFlags) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create transient texture with binding flags 0x%08X; only 'LLGL::BindFlags::ColorAttachment' or 'LLGL::BindFlags::DepthStencilAttachment' are allowed",
+            static_cast<unsigned>(textureDesc.bindFlags)
+        );
+    }
+
+    if (NumMipLevels(textureDesc) > 1)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create transient texture with more than one MIP-map level");
 
     if (initialImage != nullptr)
-        ValidateImageView(*initialImage, textureDesc);
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create transient texture with initial image data");
 
-    /* Check if MIP-map generation is requested  */
-    if ((textureDesc.miscFlags & MiscFlags::GenerateMips) != 0)
+    if ((textureDesc.miscFlags & (MiscFlags::GenerateMips | MiscFlags::Sparse)) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create transient texture with 'LLGL::MiscFlags::GenerateMips' or 'LLGL::MiscFlags::Sparse'");
+}
+
+void DbgRenderSystem::ValidateSharedTextureDesc(const TextureDescriptor& textureDesc)
+{
+    if (!GetRenderingCaps().features.hasSharedResources)
+        LLGL_DBG_ERROR(ErrorType::UnsupportedFeature, "shared resources not supported");
+
+    if ((textureDesc.miscFlags & (MiscFlags::Sparse | MiscFlags::Transient)) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create shared texture with 'LLGL::MiscFlags::Sparse' or 'LLGL::MiscFlags::Transient'");
+}
+
+void DbgRenderSystem::ValidatePlacedTexture(const DbgPlacementHeap& placementHeapDbg, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    if ((textureDesc.miscFlags & MiscFlags::Sparse) != 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create placed texture with 'LLGL::MiscFlags::Sparse'");
+
+    const MemoryRequirements requirements = instance_->GetTextureMemoryRequirements(textureDesc);
+
+    if (requirements.alignment > 0 && offset % requirements.alignment != 0)
     {
-        if (initialImage == nullptr)
-        {
-            #if 0
-            LLGL_DBG_WARN(
-                WarningType::ImproperArgument,
-                "cannot generate MIP-maps without initial image data: 'LLGL::MiscFlags::GenerateMips' specified but no initial image data"
-            );
-            #endif
-        }
-        else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) != 0)
-        {
-            LLGL_DBG_WARN(
-                WarningType::ImproperArgument,
-                "cannot generate MIP-maps with initial image data discarded: 'LLGL::MiscFlags::GenerateMips' specified but also 'MiscFlags::NoInitialData'"
-            );
-        }
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot place texture at offset %" PRIu64 " in placement heap; offset must be a multiple of %" PRIu64,
+            offset, requirements.alignment
+        );
+    }
+
+    if (offset + requirements.size > placementHeapDbg.desc.size)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot place texture of %" PRIu64 " bytes at offset %" PRIu64 " in placement heap of %" PRIu64 " bytes",
+            requirements.size, offset, placementHeapDbg.desc.size
+        );
     }
 }
 
@@ -1067,6 +1856,50 @@ void DbgRenderSystem::ValidateTextureDescMipLevels(const TextureDescriptor& text
     }
 }
 
+static bool IsValidSamplerFeedbackMipRegionSize(std::uint32_t size)
+{
+    return (size >= 4 && (size & (size - 1)) == 0);
+}
+
+void DbgRenderSystem::ValidateSamplerFeedbackDesc(const SamplerFeedbackDescriptor& samplerFeedbackDesc)
+{
+    if (!GetRenderingCaps().features.hasSamplerFeedback)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("sampler feedback");
+
+    if (samplerFeedbackDesc.pairedTexture == nullptr)
+    {
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create sampler feedback texture without paired texture");
+        return;
+    }
+
+    auto* pairedTextureDbg = LLGL_CAST(DbgTexture*, samplerFeedbackDesc.pairedTexture);
+    if (pairedTextureDbg->feedbackDesc.pairedTexture != nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot pair sampler feedback texture with another sampler feedback texture");
+
+    const TextureType pairedType = pairedTextureDbg->GetType();
+    if (!(pairedType == TextureType::Texture2D || pairedType == TextureType::Texture2DArray))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot pair sampler feedback texture with texture of type LLGL::TextureType::%s; only Texture2D and Texture2DArray are supported",
+            ToString(pairedType)
+        );
+    }
+
+    if ((pairedTextureDbg->desc.bindFlags & BindFlags::Sampled) == 0)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot pair sampler feedback texture with texture that was not created with 'LLGL::BindFlags::Sampled'");
+
+    const Extent3D& mipRegion = samplerFeedbackDesc.mipRegion;
+    if (!IsValidSamplerFeedbackMipRegionSize(mipRegion.width) || !IsValidSamplerFeedbackMipRegionSize(mipRegion.height) || mipRegion.depth != 1)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "invalid sampler feedback MIP region (%u x %u x %u); width and height must be powers of two greater than or equal to 4 and depth must be 1",
+            mipRegion.width, mipRegion.height, mipRegion.depth
+        );
+    }
+}
+
 void DbgRenderSystem::ValidateTextureSize(std::uint32_t size, std::uint32_t limit, const char* textureTypeName)
 {
     if (size == 0)
@@ -1268,6 +2101,44 @@ void DbgRenderSystem::ValidateImageView(const ImageView& imageView, const Textur
     }
 }
 
+void DbgRenderSystem::ValidateFileUpload(const FileUploadDescriptor& upload, std::uint32_t uploadIndex)
+{
+    if (upload.filename == nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot write resource from file with null pointer for filename in upload descriptor [%u]", uploadIndex);
+
+    if ((upload.buffer != nullptr) == (upload.texture != nullptr))
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot write resource from file with %s destination in upload descriptor [%u]; exactly one buffer or texture must be specified",
+            (upload.buffer != nullptr ? "buffer and texture" : "neither buffer nor texture"), uploadIndex
+        );
+        return;
+    }
+
+    const std::uint64_t dataSize = (upload.compression != FileCompression::Uncompressed ? upload.uncompressedSize : upload.fileSize);
+
+    if (upload.buffer != nullptr)
+    {
+        auto& bufferDbg = LLGL_CAST(DbgBuffer&, *upload.buffer);
+        ValidateBufferBoundary(bufferDbg.desc.size, upload.bufferOffset, dataSize);
+    }
+    else
+    {
+        auto& textureDbg = LLGL_CAST(DbgTexture&, *upload.texture);
+        ValidateTextureRegion(textureDbg, upload.textureRegion);
+
+        if (upload.textureRegion.subresource.numMipLevels != 1 || upload.textureRegion.subresource.numArrayLayers != 1)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot write texture from file with %u MIP-map(s) and %u array layer(s) in upload descriptor [%u]; exactly one subresource must be specified",
+                upload.textureRegion.subresource.numMipLevels, upload.textureRegion.subresource.numArrayLayers, uploadIndex
+            );
+        }
+    }
+}
+
 void DbgRenderSystem::ValidateTextureArrayRange(const DbgTexture& textureDbg, std::uint32_t baseArrayLayer, std::uint32_t numArrayLayers)
 {
     if (IsArrayTexture(textureDbg.GetType()))
@@ -1526,6 +2397,128 @@ void DbgRenderSystem::ValidateAttachmentDesc(const AttachmentDescriptor& attachm
     }
 }
 
+void DbgRenderSystem::ValidateRenderTargetViewMask(const RenderTargetDescriptor& renderTargetDesc)
+{
+    ValidateViewMask(renderTargetDesc.viewMask, renderTargetDesc.renderPass, "render target");
+    if (renderTargetDesc.viewMask == 0)
+        return;
+
+    /* Multiview attachments must refer to array textures that cover all layers of the view mask */
+    const std::uint32_t numViewLayers = NumMultiviewLayers(renderTargetDesc.viewMask);
+
+    auto ValidateMultiviewAttachment = [this, numViewLayers](const AttachmentDescriptor& attachmentDesc, const char* attachmentName)
+    {
+        if (!IsAttachmentEnabled(attachmentDesc))
+            return;
+        if (auto* textureDbg = DbgGetWrapper<DbgTexture>(attachmentDesc.texture))
+        {
+            if (!IsArrayTexture(textureDbg->desc.type))
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "cannot have multiview %s attachment with non-array texture type: %s",
+                    attachmentName, ToString(textureDbg->desc.type)
+                );
+            }
+            else if (attachmentDesc.arrayLayer + numViewLayers > textureDbg->desc.arrayLayers)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "multiview %s attachment exceeded number of array layers: %u + %u specified but upper bound is %u",
+                    attachmentName, attachmentDesc.arrayLayer, numViewLayers, textureDbg->desc.arrayLayers
+                );
+            }
+        }
+        else
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidArgument,
+                "cannot have multiview %s attachment without texture",
+                attachmentName
+            );
+        }
+    };
+
+    for_range(colorTarget, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        ValidateMultiviewAttachment(renderTargetDesc.colorAttachments[colorTarget], "color");
+        ValidateMultiviewAttachment(renderTargetDesc.resolveAttachments[colorTarget], "resolve");
+    }
+    ValidateMultiviewAttachment(renderTargetDesc.depthStencilAttachment, "depth-stencil");
+}
+
+void DbgRenderSystem::ValidateViewMask(std::uint32_t viewMask, const RenderPass* renderPass, const char* contextDesc)
+{
+    /* View mask must match the render pass it was created against */
+    if (const DbgRenderPass* renderPassDbg = DbgGetWrapper<DbgRenderPass>(renderPass))
+    {
+        if (renderPassDbg->desc.viewMask != viewMask)
+        {
+            LLGL_DBG_ERROR(
+                ErrorType::InvalidState,
+                "mismatch between view mask of %s (0x%08X) and its render pass (0x%08X)",
+                contextDesc, viewMask, renderPassDbg->desc.viewMask
+            );
+        }
+    }
+
+    if (viewMask == 0)
+        return;
+
+    const RenderingCapabilities& caps = GetRenderingCaps();
+    if (!caps.features.hasMultiview)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("multiview");
+    else if (NumMultiviewLayers(viewMask) > caps.limits.maxMultiviewViewCount)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "view mask of %s (0x%08X) exceeds limit of %u multiview views",
+            contextDesc, viewMask, caps.limits.maxMultiviewViewCount
+        );
+    }
+}
+
+void DbgRenderSystem::ValidateShadingRateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, const Extent2D& resolution)
+{
+    const std::uint32_t tileSize = GetRenderingCaps().limits.shadingRateImageTileSize;
+    if (tileSize == 0)
+    {
+        LLGL_DBG_ERROR_NOT_SUPPORTED("shading-rate attachments");
+        return;
+    }
+
+    auto* textureDbg = LLGL_CAST(DbgTexture*, attachmentDesc.texture);
+
+    if ((textureDbg->desc.bindFlags & BindFlags::ShadingRateAttachment) == 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot have shading-rate attachment with texture that was not created with the 'LLGL::BindFlags::ShadingRateAttachment' flag"
+        );
+    }
+
+    if (textureDbg->desc.type != TextureType::Texture2D || textureDbg->desc.format != Format::R8UInt)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "shading-rate attachment must be a 2D texture with format LLGL::Format::R8UInt"
+        );
+    }
+
+    /* Each texel of the shading-rate attachment covers one screen tile of the render target */
+    const Extent3D      mipExtent   = GetMipExtent(textureDbg->desc, attachmentDesc.mipLevel);
+    const std::uint32_t minWidth    = DivideRoundUp(resolution.width, tileSize);
+    const std::uint32_t minHeight   = DivideRoundUp(resolution.height, tileSize);
+    if (mipExtent.width < minWidth || mipExtent.height < minHeight)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "shading-rate attachment of size %ux%u is too small for render target resolution %ux%u with tile size %u; at least %ux%u is required",
+            mipExtent.width, mipExtent.height, resolution.width, resolution.height, tileSize, minWidth, minHeight
+        );
+    }
+}
+
 static std::string GetBindingSlotLabel(const BindingSlot& slot)
 {
     std::string label = "slot ";
@@ -1697,11 +2690,35 @@ void DbgRenderSystem::ValidateShaderDesc(const ShaderDescriptor& shaderDesc)
     }
 }
 
+void DbgRenderSystem::ValidateAccelerationStructureBinding(const BindingDescriptor& binding)
+{
+    const std::string bindingLabel = GetBindingDescLabel(binding);
+
+    if (binding.type != ResourceType::Buffer || (binding.bindFlags & ~BindFlags::AccelerationStructure) != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "binding %s with LLGL::BindFlags::AccelerationStructure must be of type LLGL::ResourceType::Buffer and cannot have any other bind flags",
+            bindingLabel.c_str()
+        );
+    }
+
+    /* Ray tracing stages require ray tracing PSOs, all other stages must trace rays inline with ray queries */
+    const RenderingFeatures& features = GetRenderingCaps().features;
+    if ((binding.stageFlags & StageFlags::AllRayTracingStages) != 0 && !features.hasRayTracing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("acceleration structure bindings in ray tracing shader stages");
+    if ((binding.stageFlags & ~StageFlags::AllRayTracingStages) != 0 && !features.hasRayQuery)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("acceleration structure bindings for ray queries");
+}
+
 void DbgRenderSystem::ValidatePipelineLayoutDesc(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
     /* Validate individual binding descriptors */
     for (const BindingDescriptor& binding : pipelineLayoutDesc.bindings)
     {
+        if ((binding.bindFlags & BindFlags::AccelerationStructure) != 0)
+            ValidateAccelerationStructureBinding(binding);
+
         if (binding.arraySize > 1)
         {
             const std::string bindingLabel = GetBindingDescLabel(binding);
@@ -1712,6 +2729,35 @@ void DbgRenderSystem::ValidatePipelineLayoutDesc(const PipelineLayoutDescriptor&
             );
         }
     }
+
+    for (const BindingDescriptor& binding : pipelineLayoutDesc.heapBindings)
+    {
+        if ((binding.bindFlags & BindFlags::AccelerationStructure) != 0)
+            ValidateAccelerationStructureBinding(binding);
+    }
+
+    /* Validate bindless heap bindings */
+    if ((pipelineLayoutDesc.flags & PipelineLayoutFlags::BindlessHeap) != 0)
+    {
+        const RenderingCapabilities& caps = GetRenderingCaps();
+        if (!caps.features.hasBindlessResourceHeaps)
+            LLGL_DBG_WARN(WarningType::ImproperArgument, "bindless resource heaps not supported; PipelineLayoutFlags::BindlessHeap will be ignored");
+        else
+        {
+            std::uint64_t numHeapResourceViews = 0;
+            for (const BindingDescriptor& binding : pipelineLayoutDesc.heapBindings)
+                numHeapResourceViews += std::max(1u, binding.arraySize);
+
+            if (numHeapResourceViews > caps.limits.maxBindlessResourceViews)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "number of resource views in bindless heap bindings (%" PRIu64 ") exceeds limit (%u)",
+                    numHeapResourceViews, caps.limits.maxBindlessResourceViews
+                );
+            }
+        }
+    }
 }
 
 void DbgRenderSystem::ValidateResourceHeapDesc(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
@@ -2028,13 +3074,52 @@ void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescrip
     if (pipelineStateDesc.rasterizer.conservativeRasterization && !features.hasConservativeRasterization)
         LLGL_DBG_ERROR_NOT_SUPPORTED("conservative rasterization");
 
+    ValidateSpecializationConstants(pipelineStateDesc.specializationConstants);
+    ValidateViewMask(pipelineStateDesc.viewMask, pipelineStateDesc.renderPass, "graphics PSO");
+
     /* Validate shader pipeline stages */
     bool hasSeparableShaders = false;
-    if (DbgShader* vertexShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.vertexShader))
+    if (pipelineStateDesc.tileShader != nullptr)
+    {
+        /* Tile pipelines consist of a single tile shader */
+        if (!features.hasTileShaders)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("tile shaders");
+        if (pipelineStateDesc.vertexShader         != nullptr ||
+            pipelineStateDesc.tessControlShader    != nullptr ||
+            pipelineStateDesc.tessEvaluationShader != nullptr ||
+            pipelineStateDesc.geometryShader       != nullptr ||
+            pipelineStateDesc.taskShader           != nullptr ||
+            pipelineStateDesc.meshShader           != nullptr ||
+            pipelineStateDesc.fragmentShader       != nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with tile shader and other shader stages");
+        }
+        if (DbgShader* tileShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.tileShader))
+            hasSeparableShaders = ((tileShaderDbg->desc.flags & ShaderCompileFlags::SeparateShader) != 0);
+    }
+    else if (pipelineStateDesc.meshShader != nullptr)
+    {
+        /* Mesh pipelines replace the entire vertex processing stages */
+        if (!features.hasMeshShaders)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("mesh shaders");
+        if (pipelineStateDesc.vertexShader         != nullptr ||
+            pipelineStateDesc.tessControlShader    != nullptr ||
+            pipelineStateDesc.tessEvaluationShader != nullptr ||
+            pipelineStateDesc.geometryShader       != nullptr)
+        {
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with mesh shader and vertex processing shader stages");
+        }
+        if (DbgShader* meshShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.meshShader))
+            hasSeparableShaders = ((meshShaderDbg->desc.flags & ShaderCompileFlags::SeparateShader) != 0);
+    }
+    else if (DbgShader* vertexShaderDbg = DbgGetWrapper<DbgShader>(pipelineStateDesc.vertexShader))
         hasSeparableShaders = ((vertexShaderDbg->desc.flags & ShaderCompileFlags::SeparateShader) != 0);
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO without vertex shader");
 
+    if (pipelineStateDesc.taskShader != nullptr && pipelineStateDesc.meshShader == nullptr)
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create graphics PSO with task shader but without mesh shader");
+
     const bool hasFragmentShader = (pipelineStateDesc.fragmentShader != nullptr);
 
     if ((pipelineStateDesc.tessControlShader != nullptr) != (pipelineStateDesc.tessEvaluationShader != nullptr))
@@ -2054,6 +3139,9 @@ void DbgRenderSystem::ValidateGraphicsPipelineDesc(const GraphicsPipelineDescrip
                                  ShaderTypePair{ pipelineStateDesc.tessControlShader,    ShaderType::TessControl    },
                                  ShaderTypePair{ pipelineStateDesc.tessEvaluationShader, ShaderType::TessEvaluation },
                                  ShaderTypePair{ pipelineStateDesc.geometryShader,       ShaderType::Geometry       },
+                                 ShaderTypePair{ pipelineStateDesc.taskShader,           ShaderType::Task           },
+                                 ShaderTypePair{ pipelineStateDesc.meshShader,           ShaderType::Mesh           },
+                                 ShaderTypePair{ pipelineStateDesc.tileShader,           ShaderType::Tile           },
                                  ShaderTypePair{ pipelineStateDesc.fragmentShader,       ShaderType::Fragment       } })
     {
         if (Shader* shader = pair.shader)
@@ -2140,6 +3228,109 @@ void DbgRenderSystem::ValidateComputePipelineDesc(const ComputePipelineDescripto
     }
     else
         LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create compute PSO without compute shader");
+
+    ValidateSpecializationConstants(pipelineStateDesc.specializationConstants);
+}
+
+void DbgRenderSystem::ValidateRayTracingPipelineDesc(const RayTracingPipelineDescriptor& pipelineStateDesc)
+{
+    if (!GetRenderingCaps().features.hasRayTracing)
+        LLGL_DBG_ERROR_NOT_SUPPORTED("ray tracing");
+
+    /* Validate shader pipeline stages */
+    if (pipelineStateDesc.rayGenerationShader != nullptr)
+        ValidateRayTracingShader(pipelineStateDesc.rayGenerationShader, ShaderType::RayGeneration, "ray generation");
+    else
+        LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create ray tracing PSO without ray generation shader");
+
+    for (const Shader* missShader : pipelineStateDesc.missShaders)
+    {
+        if (missShader != nullptr)
+            ValidateRayTracingShader(missShader, ShaderType::Miss, "miss");
+        else
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create ray tracing PSO with null pointer in list of miss shaders");
+    }
+
+    for_range(i, pipelineStateDesc.hitGroups.size())
+    {
+        const RayTracingHitGroupDescriptor& hitGroup = pipelineStateDesc.hitGroups[i];
+        if (hitGroup.closestHitShader == nullptr && hitGroup.anyHitShader == nullptr)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create ray tracing PSO with empty hit group [%zu]", i);
+        if (hitGroup.closestHitShader != nullptr)
+            ValidateRayTracingShader(hitGroup.closestHitShader, ShaderType::ClosestHit, "closest-hit");
+        if (hitGroup.anyHitShader != nullptr)
+            ValidateRayTracingShader(hitGroup.anyHitShader, ShaderType::AnyHit, "any-hit");
+    }
+
+    /* Validate pipeline configuration */
+    if (pipelineStateDesc.maxRecursionDepth == 0 || pipelineStateDesc.maxRecursionDepth > 31)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "maximum ray recursion depth must be in the range [1, 31], but %u was specified",
+            pipelineStateDesc.maxRecursionDepth
+        );
+    }
+    if (pipelineStateDesc.maxPayloadSize == 0 || pipelineStateDesc.maxPayloadSize % 4 != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "maximum ray payload size must be a non-zero multiple of 4, but %u was specified",
+            pipelineStateDesc.maxPayloadSize
+        );
+    }
+    if (pipelineStateDesc.maxAttributeSize < 8 || pipelineStateDesc.maxAttributeSize > 32 || pipelineStateDesc.maxAttributeSize % 4 != 0)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "maximum hit attribute size must be a multiple of 4 in the range [8, 32], but %u was specified",
+            pipelineStateDesc.maxAttributeSize
+        );
+    }
+}
+
+void DbgRenderSystem::ValidateRayTracingShader(const Shader* shader, ShaderType shaderType, const char* shaderName)
+{
+    if (shader->GetType() != shaderType)
+    {
+        LLGL_DBG_ERROR(
+            ErrorType::InvalidArgument,
+            "cannot create ray tracing PSO with %s shader being assigned to %s stage",
+            ToString(shader->GetType()), shaderName
+        );
+    }
+}
+
+void DbgRenderSystem::ValidateSpecializationConstants(const std::vector<SpecializationConstant>& constants)
+{
+    if (constants.empty())
+        return;
+
+    if (GetRendererID() != RendererID::Vulkan && GetRendererID() != RendererID::Metal)
+    {
+        LLGL_DBG_WARN(
+            WarningType::ImproperArgument,
+            "specialization constants are ignored by %s renderer; use shader macros instead",
+            GetName()
+        );
+    }
+
+    /* Each specialization constant ID must be unique */
+    for (std::size_t i = 0; i < constants.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < constants.size(); ++j)
+        {
+            if (constants[i].id == constants[j].id)
+            {
+                LLGL_DBG_ERROR(
+                    ErrorType::InvalidArgument,
+                    "duplicate specialization constant ID %u in PSO descriptor",
+                    constants[i].id
+                );
+                return;
+            }
+        }
+    }
 }
 
 void DbgRenderSystem::ValidateFragmentShaderOutput(DbgShader& fragmentShaderDbg, const RenderPass* renderPass, bool hasDualSourceBlend)
@@ -2301,6 +3492,9 @@ static ShaderType StageFlagsToShaderType(long stageFlags)
         case StageFlags::GeometryStage:         return ShaderType::Geometry;
         case StageFlags::FragmentStage:         return ShaderType::Fragment;
         case StageFlags::ComputeStage:          return ShaderType::Compute;
+        case StageFlags::TaskStage:             return ShaderType::Task;
+        case StageFlags::MeshStage:             return ShaderType::Mesh;
+        case StageFlags::TileStage:             return ShaderType::Tile;
         default:                                return ShaderType::Undefined;
     }
 }
@@ -2415,6 +3609,17 @@ void DbgRenderSystem::ValidatePipelineStateUniforms(const DbgPipelineLayout& pip
     }
 }
 
+void DbgRenderSystem::ValidateQueryHeapDesc(const QueryHeapDescriptor& queryHeapDesc)
+{
+    if (queryHeapDesc.type == QueryType::Timestamp)
+    {
+        if (!GetRenderingCaps().features.hasTimestampQueries)
+            LLGL_DBG_ERROR_NOT_SUPPORTED("timestamp queries");
+        if (queryHeapDesc.renderCondition)
+            LLGL_DBG_ERROR(ErrorType::InvalidArgument, "cannot create timestamp query heap for conditional rendering");
+    }
+}
+
 void DbgRenderSystem::Assert3DTextures()
 {
     const RenderingFeatures& features = GetRenderingCaps().features;
@@ -2454,6 +3659,7 @@ template <typename T, typename TBase>
 void DbgRenderSystem::ReleaseDbg(HWObjectContainer<T>& cont, TBase& entry)
 {
     auto& entryDbg = LLGL_CAST(T&, entry);
+    capture_.RecordRelease(&entryDbg);
     instance_->Release(entryDbg.instance);
     cont.erase(&entry);
 }
@@ -26,6 +26,8 @@
 #include "Shader/DbgShader.h"
 #include "Texture/DbgTexture.h"
 #include "Texture/DbgRenderTarget.h"
+#include "Texture/DbgPlacementHeap.h"
+#include "DbgCaptureRecorder.h"
 
 #include "../ContainerTypes.h"
 
@@ -42,9 +44,42 @@ class DbgRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        void PrepareSwapChainAsync(const SwapChainDescriptor& swapChainDesc) override;
+
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
+
+        void FlushMappedRange(Buffer& buffer, std::uint64_t offset, std::uint64_t length) override;
+
+        AccelerationStructureSizes GetAccelerationStructureSizes(const AccelerationStructureDescriptor& accelerationStructureDesc) override;
+
+        void WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence = nullptr) override;
+        void WriteFromFileAsync(std::uint32_t numUploads, const FileUploadDescriptor* uploads, Fence* fence = nullptr) override;
+        void ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence) override;
+
+        PlacementHeap* CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc) override;
+
+        void Release(PlacementHeap& placementHeap) override;
+
+        MemoryRequirements GetTextureMemoryRequirements(const TextureDescriptor& textureDesc) override;
+
+        Texture* CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc) override;
+
+        Texture* CreateSamplerFeedbackTexture(const SamplerFeedbackDescriptor& samplerFeedbackDesc) override;
+
+        bool ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle) override;
+
+        Texture* ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle) override;
+
+        Buffer* ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle) override;
+
+        bool ExportSharedFence(Fence& fence, SharedResourceHandle& outHandle) override;
+
     public:
 
         DbgRenderSystem(RenderSystemPtr&& instance, RenderingDebugger* debugger);
+        ~DbgRenderSystem();
 
         void FlushProfile();
 
@@ -63,6 +98,9 @@ class DbgRenderSystem final : public RenderSystem
 
         void ValidateCommandBufferDesc(const CommandBufferDescriptor& commandBufferDesc);
 
+        // Returns the debug command queue for the specified type and wraps the dedicated queue of the actual render system on first use.
+        DbgCommandQueue& GetDbgCommandQueue(const CommandQueueType type);
+
         void ValidateBufferDesc(const BufferDescriptor& bufferDesc, std::uint32_t* formatSizeOut = nullptr);
         void ValidateVertexAttributesForBuffer(const VertexAttribute& lhs, const VertexAttribute& rhs);
         void ValidateBufferSize(std::uint64_t size);
@@ -74,6 +112,11 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage = nullptr);
         void ValidateTextureFormatSupported(const Format format);
         void ValidateTextureDescMipLevels(const TextureDescriptor& textureDesc);
+        void ValidateSparseTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage);
+        void ValidateTransientTextureDesc(const TextureDescriptor& textureDesc, const ImageView* initialImage);
+        void ValidateSharedTextureDesc(const TextureDescriptor& textureDesc);
+        void ValidatePlacedTexture(const DbgPlacementHeap& placementHeapDbg, std::uint64_t offset, const TextureDescriptor& textureDesc);
+        void ValidateSamplerFeedbackDesc(const SamplerFeedbackDescriptor& samplerFeedbackDesc);
         void ValidateTextureSize(std::uint32_t size, std::uint32_t limit, const char* textureTypeName);
         void ValidateTextureSizePassiveDimension(std::uint32_t size, const char* textureTypeName, const char* axisName);
         void Validate1DTextureSize(std::uint32_t size);
@@ -88,11 +131,16 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateTextureView(const DbgTexture& sharedTextureDbg, const TextureViewDescriptor& textureViewDesc);
         void ValidateTextureViewType(const TextureType sharedTextureType, const TextureType textureViewType, const std::initializer_list<TextureType>& validTypes);
         void ValidateImageView(const ImageView& imageView, const TextureDescriptor& textureDesc, const TextureRegion* textureRegion = nullptr);
+        void ValidateFileUpload(const FileUploadDescriptor& upload, std::uint32_t uploadIndex);
 
         void ValidateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget, bool isResolveAttachment, bool isDepthStencilAttachment);
+        void ValidateShadingRateAttachmentDesc(const AttachmentDescriptor& attachmentDesc, const Extent2D& resolution);
+        void ValidateRenderTargetViewMask(const RenderTargetDescriptor& renderTargetDesc);
+        void ValidateViewMask(std::uint32_t viewMask, const RenderPass* renderPass, const char* contextDesc);
 
         void ValidateShaderDesc(const ShaderDescriptor& shaderDesc);
 
+        void ValidateAccelerationStructureBinding(const BindingDescriptor& binding);
         void ValidatePipelineLayoutDesc(const PipelineLayoutDescriptor& pipelineLayoutDesc);
 
         void ValidateResourceHeapDesc(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews);
@@ -106,11 +154,16 @@ class DbgRenderSystem final : public RenderSystem
         void ValidateBlendDescriptor(const BlendDescriptor& blendDesc, bool hasFragmentShader, bool hasDualSourceBlend);
         void ValidateGraphicsPipelineDesc(const GraphicsPipelineDescriptor& pipelineStateDesc);
         void ValidateComputePipelineDesc(const ComputePipelineDescriptor& pipelineStateDesc);
+        void ValidateRayTracingPipelineDesc(const RayTracingPipelineDescriptor& pipelineStateDesc);
+        void ValidateRayTracingShader(const Shader* shader, ShaderType shaderType, const char* shaderName);
+        void ValidateSpecializationConstants(const std::vector<SpecializationConstant>& constants);
         void ValidateFragmentShaderOutput(DbgShader& fragmentShaderDbg, const RenderPass* renderPass, bool hasDualSourceBlend);
         void ValidateFragmentShaderOutputWithRenderPass(DbgShader& fragmentShaderDbg, const FragmentShaderAttributes& fragmentAttribs, const DbgRenderPass& renderPass, bool hasDualSourceBlend);
         void ValidateFragmentShaderOutputWithoutRenderPass(DbgShader& fragmentShaderDbg, const FragmentShaderAttributes& fragmentAttribs);
         void ValidatePipelineStateUniforms(const DbgPipelineLayout& pipelineLayout, const ArrayView<DbgShader*>& shaders, const char* psoDebugName);
 
+        void ValidateQueryHeapDesc(const QueryHeapDescriptor& queryHeapDesc);
+
         void Assert3DTextures();
         void AssertCubeTextures();
         void AssertArrayTextures();
@@ -130,15 +183,19 @@ class DbgRenderSystem final : public RenderSystem
 
         RenderingDebugger*                      debugger_   = nullptr;
         FrameProfile                            profile_;
+        DbgCaptureRecorder                      capture_;
 
         /* ----- Hardware object containers ----- */
 
         HWObjectContainer<DbgSwapChain>         swapChains_;
         HWObjectInstance<DbgCommandQueue>       commandQueue_;
+        HWObjectInstance<DbgCommandQueue>       computeQueue_;
+        HWObjectInstance<DbgCommandQueue>       copyQueue_;
         HWObjectContainer<DbgCommandBuffer>     commandBuffers_;
         HWObjectContainer<DbgBuffer>            buffers_;
         HWObjectContainer<DbgBufferArray>       bufferArrays_;
         HWObjectContainer<DbgTexture>           textures_;
+        HWObjectContainer<DbgPlacementHeap>     placementHeaps_;
         HWObjectContainer<DbgRenderPass>        renderPasses_;
         HWObjectContainer<DbgRenderTarget>      renderTargets_;
         HWObjectContainer<DbgShader>            shaders_;
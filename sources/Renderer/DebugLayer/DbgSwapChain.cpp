@@ -32,14 +32,24 @@ static RenderPassDescriptor MakeRenderPassDesc(const SwapChain& swapChain)
         const auto depthStencilFormat = swapChain.GetDepthStencilFormat();
         SetDefaultAttachmentDesc(renderPassDesc.depthAttachment, depthStencilFormat);
         SetDefaultAttachmentDesc(renderPassDesc.stencilAttachment, depthStencilFormat);
+
+        renderPassDesc.samples = swapChain.GetSamples();
     }
     return renderPassDesc;
 }
 
-DbgSwapChain::DbgSwapChain(SwapChain& instance, const SwapChainDescriptor& desc, const PresentCallback& presentCallback) :
+DbgSwapChain::DbgSwapChain(
+    SwapChain&                  instance,
+    const SwapChainDescriptor&  desc,
+    FrameProfile&               profile,
+    RenderingDebugger*          debugger,
+    const PresentCallback&      presentCallback)
+:
     instance         { instance             },
     desc             { desc                 },
     label            { LLGL_DBG_LABEL(desc) },
+    profile_         { profile              },
+    debugger_        { debugger             },
     presentCallback_ { presentCallback      }
 {
     ShareSurfaceAndConfig(instance);
@@ -59,10 +69,9 @@ bool DbgSwapChain::IsPresentable() const
 
 void DbgSwapChain::Present()
 {
+    const std::uint64_t cpuTicksStart = Timer::Tick();
     instance.Present();
-    if (presentCallback_)
-        presentCallback_();
-    NotifyFramebufferUsed();
+    NotifyPresented(cpuTicksStart);
 }
 
 std::uint32_t DbgSwapChain::GetCurrentSwapIndex() const
@@ -95,6 +104,37 @@ bool DbgSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return instance.SetVsyncInterval(vsyncInterval);
 }
 
+bool DbgSwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    const std::uint64_t cpuTicksStart = Timer::Tick();
+    const bool result = instance.WaitForNextFrame(timeout);
+
+    if (DbgIsEventRecordingEnabled(debugger_))
+        DbgRecordEvent(profile_, ProfileEventType::Wait, "WaitForNextFrame", cpuTicksStart);
+
+    return result;
+}
+
+bool DbgSwapChain::GetFrameStatistics(FrameStatistics& outStatistics) const
+{
+    return instance.GetFrameStatistics(outStatistics);
+}
+
+bool DbgSwapChain::GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    return instance.GetCurrentBackBufferNativeHandle(nativeHandle, nativeHandleSize);
+}
+
+SurfaceTransform DbgSwapChain::GetSurfaceTransform() const
+{
+    return instance.GetSurfaceTransform();
+}
+
+ColorSpace DbgSwapChain::GetColorSpace() const
+{
+    return instance.GetColorSpace();
+}
+
 const RenderPass* DbgSwapChain::GetRenderPass() const
 {
     return renderPass_.get();
@@ -128,6 +168,17 @@ void DbgSwapChain::NotifyFramebufferUsed()
     usedSinceRenderPass_ = true;
 }
 
+void DbgSwapChain::NotifyPresented(std::uint64_t cpuTicksStart)
+{
+    /* Record present event before the frame profile is flushed */
+    if (DbgIsEventRecordingEnabled(debugger_))
+        DbgRecordEvent(profile_, ProfileEventType::Present, (label.empty() ? StringLiteral{ "LLGL::SwapChain" } : StringLiteral{ label }), cpuTicksStart);
+
+    if (presentCallback_)
+        presentCallback_();
+    NotifyFramebufferUsed();
+}
+
 
 } // /namespace LLGL
 
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/SwapChain.h>
+#include <LLGL/RenderingDebuggerFlags.h>
 #include "RenderState/DbgRenderPass.h"
 #include <string>
 #include <memory>
@@ -38,9 +39,25 @@ class DbgSwapChain final : public SwapChain
 
         void SetDebugName(const char* name) override;
 
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
+        bool GetFrameStatistics(FrameStatistics& outStatistics) const override;
+
+        bool GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        SurfaceTransform GetSurfaceTransform() const override;
+
+        ColorSpace GetColorSpace() const override;
+
     public:
 
-        DbgSwapChain(SwapChain& instance, const SwapChainDescriptor& desc, const PresentCallback& presentCallback);
+        DbgSwapChain(
+            SwapChain&                  instance,
+            const SwapChainDescriptor&  desc,
+            FrameProfile&               profile,
+            RenderingDebugger*          debugger,
+            const PresentCallback&      presentCallback
+        );
 
         // Notifies that the framebuffer will be put into a new render pass.
         void NotifyNextRenderPass(RenderingDebugger* debugger, const RenderPass* renderPass);
@@ -48,6 +65,9 @@ class DbgSwapChain final : public SwapChain
         // Notifies that the framebuffer has been used since the last render pass section.
         void NotifyFramebufferUsed();
 
+        // Notifies that the swap-chain instance has been presented, which started at the specified CPU ticks. See CommandQueue::Present().
+        void NotifyPresented(std::uint64_t cpuTicksStart);
+
     public:
 
         SwapChain&                  instance;
@@ -61,6 +81,8 @@ class DbgSwapChain final : public SwapChain
     private:
 
         std::unique_ptr<DbgRenderPass>  renderPass_;
+        FrameProfile&                   profile_;
+        RenderingDebugger*              debugger_           = nullptr;
         PresentCallback                 presentCallback_;
         bool                            usedSinceRenderPass_ = true; // Has the framebuffer been read or presented since the last render pass section?
 
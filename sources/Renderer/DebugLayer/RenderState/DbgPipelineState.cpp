@@ -34,6 +34,16 @@ DbgPipelineState::DbgPipelineState(PipelineState& instance, const ComputePipelin
 {
 }
 
+DbgPipelineState::DbgPipelineState(PipelineState& instance, const RayTracingPipelineDescriptor& desc) :
+    instance        { instance                                                 },
+    label           { LLGL_DBG_LABEL(desc)                                     },
+    pipelineLayout  { LLGL_CAST(const DbgPipelineLayout*, desc.pipelineLayout) },
+    isGraphicsPSO   { false                                                    },
+    isRayTracingPSO { true                                                     },
+    rayTracingDesc  { desc                                                     }
+{
+}
+
 DbgPipelineState::~DbgPipelineState()
 {
     // dummy
@@ -59,6 +69,11 @@ const Report* DbgPipelineState::GetReport() const
     return instance.GetReport();
 }
 
+bool DbgPipelineState::IsReady() const
+{
+    return instance.IsReady();
+}
+
 
 } // /namespace LLGL
 
@@ -27,11 +27,13 @@ class DbgPipelineState final : public PipelineState
 
         void SetDebugName(const char* name) override;
         const Report* GetReport() const override;
+        bool IsReady() const override;
 
     public:
 
         DbgPipelineState(PipelineState& instance, const GraphicsPipelineDescriptor& desc);
         DbgPipelineState(PipelineState& instance, const ComputePipelineDescriptor& desc);
+        DbgPipelineState(PipelineState& instance, const RayTracingPipelineDescriptor& desc);
         ~DbgPipelineState();
 
         // Returns true if this PSO has a dynamic blend factor, i.e. BlendDescriptor::blendFactorDynamic is effectively enabled.
@@ -46,11 +48,13 @@ class DbgPipelineState final : public PipelineState
         std::string                     label;
         const DbgPipelineLayout* const  pipelineLayout  = nullptr;
         const bool                      isGraphicsPSO   = false;
+        const bool                      isRayTracingPSO = false;
 
         union
         {
             const GraphicsPipelineDescriptor    graphicsDesc;
             const ComputePipelineDescriptor     computeDesc;
+            const RayTracingPipelineDescriptor  rayTracingDesc;
         };
 
 };
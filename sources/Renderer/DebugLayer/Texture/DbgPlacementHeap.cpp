@@ -0,0 +1,34 @@
+/*
+ * DbgPlacementHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DbgPlacementHeap.h"
+#include "../DbgCore.h"
+
+
+namespace LLGL
+{
+
+
+DbgPlacementHeap::DbgPlacementHeap(PlacementHeap& instance, const PlacementHeapDescriptor& desc) :
+    PlacementHeap { desc.size            },
+    instance      { instance             },
+    desc          { desc                 },
+    label         { LLGL_DBG_LABEL(desc) }
+{
+}
+
+void DbgPlacementHeap::SetDebugName(const char* name)
+{
+    DbgSetObjectName(*this, name);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,48 @@
+/*
+ * DbgPlacementHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DBG_PLACEMENT_HEAP_H
+#define LLGL_DBG_PLACEMENT_HEAP_H
+
+
+#include <LLGL/PlacementHeap.h>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+class DbgPlacementHeap final : public PlacementHeap
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        DbgPlacementHeap(PlacementHeap& instance, const PlacementHeapDescriptor& desc);
+
+    public:
+
+        PlacementHeap&                  instance;
+        const PlacementHeapDescriptor   desc;
+        std::string                     label;
+        std::uint32_t                   numPlacedTextures   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -18,6 +18,8 @@ namespace LLGL
 {
 
 
+class DbgPlacementHeap;
+
 class DbgTexture final : public Texture
 {
 
@@ -43,6 +45,8 @@ class DbgTexture final : public Texture
         std::uint32_t           mipLevels           = 1;        // Actual number of MIP-map levels.
         std::string             label;
         const bool              isTextureView       = false;
+        DbgPlacementHeap*       placementHeap       = nullptr;  // Heap this texture was placed into (only for placed textures)
+        SamplerFeedbackDescriptor feedbackDesc;                 // Sampler feedback descriptor (only for sampler feedback textures, i.e. 'feedbackDesc.pairedTexture' is non-null)
 
     private:
 
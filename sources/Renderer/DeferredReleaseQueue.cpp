@@ -0,0 +1,39 @@
+/*
+ * DeferredReleaseQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "DeferredReleaseQueue.h"
+#include "../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+void DeferredReleaseQueue::Enqueue(std::uint64_t releaseSerial, std::unique_ptr<DeferredRelease>&& object)
+{
+    LLGL_ASSERT(entries_.empty() || entries_.back().releaseSerial <= releaseSerial);
+    entries_.push_back(Entry{ releaseSerial, std::move(object) });
+}
+
+void DeferredReleaseQueue::Collect(std::uint64_t completedSerial)
+{
+    /* Objects are enqueued in order of their release serials, so stop at the first one that is still pending */
+    while (!entries_.empty() && entries_.front().releaseSerial <= completedSerial)
+        entries_.pop_front();
+}
+
+void DeferredReleaseQueue::Clear()
+{
+    entries_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
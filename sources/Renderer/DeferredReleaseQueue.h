@@ -0,0 +1,111 @@
+/*
+ * DeferredReleaseQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_DEFERRED_RELEASE_QUEUE_H
+#define LLGL_DEFERRED_RELEASE_QUEUE_H
+
+
+#include <LLGL/Export.h>
+#include "../Core/CoreUtils.h"
+#include <memory>
+#include <deque>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Base class of objects whose destruction is deferred by DeferredReleaseQueue. Backends derive from this to release backend memory in the destructor.
+class LLGL_EXPORT DeferredRelease
+{
+
+    public:
+
+        virtual ~DeferredRelease() = default;
+
+};
+
+// Deferred release that only owns an object, e.g. the owning pointer that was extracted from a HWObjectContainer.
+template <typename TPtr>
+class DeferredReleaseObject final : public DeferredRelease
+{
+
+    public:
+
+        DeferredReleaseObject(TPtr&& object) :
+            object_ { std::move(object) }
+        {
+        }
+
+    private:
+
+        TPtr object_;
+
+};
+
+/*
+Queue of released render system child objects that may still be in use by the GPU.
+Each object is enqueued with a release serial that the backend associates with a fence it has submitted to all of its command queues.
+Objects are destroyed in the order they were released, once the backend reports that the fences up to their serial have been signaled.
+This replaces a full GPU synchronization in RenderSystem::Release() with a non-blocking release.
+*/
+class LLGL_EXPORT DeferredReleaseQueue
+{
+
+    public:
+
+        DeferredReleaseQueue() = default;
+
+        DeferredReleaseQueue(const DeferredReleaseQueue&) = delete;
+        DeferredReleaseQueue& operator = (const DeferredReleaseQueue&) = delete;
+
+        // Takes ownership of the specified object until all GPU work up to the specified release serial has completed. Serials must not decrease.
+        void Enqueue(std::uint64_t releaseSerial, std::unique_ptr<DeferredRelease>&& object);
+
+        // Takes ownership of the specified owning pointer until all GPU work up to the specified release serial has completed.
+        template <typename TPtr>
+        void EnqueueObject(std::uint64_t releaseSerial, TPtr&& object)
+        {
+            Enqueue(releaseSerial, MakeUnique<DeferredReleaseObject<TPtr>>(std::move(object)));
+        }
+
+        // Destroys all objects whose release serial is less than or equal to the specified completed serial.
+        void Collect(std::uint64_t completedSerial);
+
+        // Destroys all objects immediately. The GPU must be idle.
+        void Clear();
+
+        // Returns true if there are no objects pending for destruction.
+        inline bool IsEmpty() const
+        {
+            return entries_.empty();
+        }
+
+    private:
+
+        struct Entry
+        {
+            std::uint64_t                       releaseSerial;
+            std::unique_ptr<DeferredRelease>    object;
+        };
+
+    private:
+
+        std::deque<Entry> entries_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -89,11 +89,13 @@ void D3D11StagingBuffer::Write(
     if (usage_ == D3D11_USAGE_DYNAMIC)
     {
         /*
-        D3D11_USAGE_DYNAMIC only supports map-write with discard;
+        D3D11_USAGE_DYNAMIC only supports map-write with discard or no-overwrite;
+        Discard the buffer with the first write after a reset and append to it without overwriting previous data otherwise.
         Update partial subresource by mapping buffer from GPU into CPU memory space.
         */
+        const D3D11_MAP mapType = (offset_ == 0 ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE);
         D3D11_MAPPED_SUBRESOURCE subresource;
-        if (SUCCEEDED(context->Map(GetNative(), 0, D3D11_MAP_WRITE_DISCARD, 0, &subresource)))
+        if (SUCCEEDED(context->Map(GetNative(), 0, mapType, 0, &subresource)))
         {
             ::memcpy(reinterpret_cast<char*>(subresource.pData) + offset_, data, dataSize);
             context->Unmap(GetNative(), 0);
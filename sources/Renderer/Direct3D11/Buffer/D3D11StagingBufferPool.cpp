@@ -6,6 +6,7 @@
  */
 
 #include "D3D11StagingBufferPool.h"
+#include "../../ProfileCounters.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
@@ -21,7 +22,8 @@ D3D11StagingBufferPool::D3D11StagingBufferPool(
     UINT                    chunkSize,
     D3D11_USAGE             usage,
     UINT                    cpuAccessFlags,
-    UINT                    bindFlags)
+    UINT                    bindFlags,
+    bool                    noOverwrite)
 :
     device_           { device               },
     context_          { context              },
@@ -29,6 +31,7 @@ D3D11StagingBufferPool::D3D11StagingBufferPool(
     usage_            { usage                },
     cpuAccessFlags_   { cpuAccessFlags       },
     bindFlags_        { bindFlags            },
+    noOverwrite_      { noOverwrite          },
     incrementOffsets_ { !NeedsUniqueBuffer() }
 {
 }
@@ -71,6 +74,7 @@ D3D11BufferRange D3D11StagingBufferPool::Write(const void* data, UINT dataSize,
         else
             chunk.Write(context_, data, dataSize);
     }
+    LLGL_PROFILE_COUNTER_ADD(stagingUploadBytes, dataSize);
 
     /* If a unique buffer is required with ever allocation, increment chunk index for next call */
     if (NeedsUniqueBuffer())
@@ -37,7 +37,8 @@ class D3D11StagingBufferPool
             UINT                    chunkSize,
             D3D11_USAGE             usage           = D3D11_USAGE_STAGING,
             UINT                    cpuAccessFlags  = D3D11_CPU_ACCESS_WRITE | D3D11_CPU_ACCESS_READ,
-            UINT                    bindFlags       = 0
+            UINT                    bindFlags       = 0,
+            bool                    noOverwrite     = false
         );
 
         // Resets all chunks in the pool.
@@ -56,10 +57,12 @@ class D3D11StagingBufferPool
         This is the case for dynamic (D3D11_USAGE_DYNAMIC) constant buffers (D3D11_BIND_CONSTANT_BUFFER)
         as a high performance demands Map(D3D11_MAP_WRITE_DISCARD), which discards its previous content.
         Such a staging buffer pool should be reset after each draw call if it was used.
+        If 'noOverwrite' is enabled, dynamic constant buffers are sub-allocated with Map(D3D11_MAP_WRITE_NO_OVERWRITE) instead,
+        which requires D3D11_FEATURE_DATA_D3D11_OPTIONS::MapNoOverwriteOnDynamicConstantBuffer.
         */
         inline bool NeedsUniqueBuffer() const
         {
-            return (usage_ == D3D11_USAGE_DYNAMIC && (bindFlags_ & D3D11_BIND_CONSTANT_BUFFER) != 0);
+            return (usage_ == D3D11_USAGE_DYNAMIC && (bindFlags_ & D3D11_BIND_CONSTANT_BUFFER) != 0 && !noOverwrite_);
         }
 
     private:
@@ -73,6 +76,7 @@ class D3D11StagingBufferPool
         D3D11_USAGE                     usage_              = D3D11_USAGE_STAGING;
         UINT                            cpuAccessFlags_     = D3D11_CPU_ACCESS_WRITE | D3D11_CPU_ACCESS_READ;
         UINT                            bindFlags_          = 0;
+        const bool                      noOverwrite_        = false;
 
         const bool                      incrementOffsets_   = false;
 
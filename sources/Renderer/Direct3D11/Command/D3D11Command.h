@@ -10,6 +10,10 @@
 
 
 #include "../Direct3D11.h"
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Constants.h>
 #include <cstdint>
 
 
@@ -17,8 +21,14 @@ namespace LLGL
 {
 
 
+class Buffer;
+class Texture;
+class QueryHeap;
+class RenderTarget;
+class RenderPass;
 class Resource;
 class ResourceHeap;
+class CommandBuffer;
 class D3D11Buffer;
 class D3D11BufferArray;
 class D3D11ResourceHeap;
@@ -53,6 +63,14 @@ struct D3D11CmdSetResource
     Resource*       resource;
 };
 
+struct D3D11CmdSetConstantBufferRange
+{
+    std::uint32_t   descriptor;
+    Buffer*         buffer;
+    std::uint64_t   offset;
+    std::uint64_t   size;
+};
+
 struct D3D11CmdSetPipelineState
 {
     D3D11PipelineState* pipelineState;
@@ -128,6 +146,141 @@ struct D3D11CmdDispatchIndirect
     UINT            alignedByteOffsetForArgs;
 };
 
+struct D3D11CmdExecute
+{
+    CommandBuffer* commandBuffer;
+};
+
+struct D3D11CmdUpdateBuffer
+{
+    Buffer*         dstBuffer;
+    std::uint64_t   dstOffset;
+    std::uint16_t   dataSize;
+//  char            data[dataSize];
+};
+
+struct D3D11CmdCopyBuffer
+{
+    Buffer*         dstBuffer;
+    std::uint64_t   dstOffset;
+    Buffer*         srcBuffer;
+    std::uint64_t   srcOffset;
+    std::uint64_t   size;
+};
+
+struct D3D11CmdCopyBufferFromTexture
+{
+    Buffer*         dstBuffer;
+    std::uint64_t   dstOffset;
+    Texture*        srcTexture;
+    TextureRegion   srcRegion;
+    std::uint32_t   rowStride;
+    std::uint32_t   layerStride;
+};
+
+struct D3D11CmdFillBuffer
+{
+    Buffer*         dstBuffer;
+    std::uint64_t   dstOffset;
+    std::uint32_t   value;
+    std::uint64_t   fillSize;
+};
+
+struct D3D11CmdCopyTexture
+{
+    Texture*        dstTexture;
+    TextureLocation dstLocation;
+    Texture*        srcTexture;
+    TextureLocation srcLocation;
+    Extent3D        extent;
+};
+
+struct D3D11CmdCopyTextureFromBuffer
+{
+    Texture*        dstTexture;
+    TextureRegion   dstRegion;
+    Buffer*         srcBuffer;
+    std::uint64_t   srcOffset;
+    std::uint32_t   rowStride;
+    std::uint32_t   layerStride;
+};
+
+struct D3D11CmdCopyTextureFromFramebuffer
+{
+    Texture*        dstTexture;
+    TextureRegion   dstRegion;
+    Offset2D        srcOffset;
+};
+
+struct D3D11CmdGenerateMips
+{
+    Texture* texture;
+};
+
+struct D3D11CmdGenerateMipsSubresource
+{
+    Texture*            texture;
+    TextureSubresource  subresource;
+};
+
+struct D3D11CmdSetViewports
+{
+    std::uint32_t   numViewports;
+//  Viewport        viewports[numViewports];
+};
+
+struct D3D11CmdSetScissors
+{
+    std::uint32_t   numScissors;
+//  Scissor         scissors[numScissors];
+};
+
+struct D3D11CmdBeginRenderPass
+{
+    RenderTarget*       renderTarget;
+    const RenderPass*   renderPass;
+    std::uint32_t       numClearValues;
+    std::uint32_t       swapBufferIndex;
+//  ClearValue          clearValues[numClearValues];
+};
+
+struct D3D11CmdClear
+{
+    long        flags;
+    ClearValue  clearValue;
+};
+
+struct D3D11CmdClearAttachments
+{
+    std::uint32_t   numAttachments;
+//  AttachmentClear attachments[numAttachments];
+};
+
+struct D3D11CmdQuery
+{
+    QueryHeap*      queryHeap;
+    std::uint32_t   query;
+};
+
+struct D3D11CmdBeginRenderCondition
+{
+    QueryHeap*          queryHeap;
+    std::uint32_t       query;
+    RenderConditionMode mode;
+};
+
+struct D3D11CmdBeginStreamOutput
+{
+    std::uint32_t   numBuffers;
+    Buffer*         buffers[LLGL_MAX_NUM_SO_BUFFERS];
+};
+
+struct D3D11CmdPushDebugGroup
+{
+    std::size_t length;
+//  char        name[length + 1];
+};
+
 
 } // /namespace LLGL
 
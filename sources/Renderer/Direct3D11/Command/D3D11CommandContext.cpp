@@ -12,6 +12,7 @@
 #include "../../DXCommon/DXTypes.h"
 #include "../../CheckedCast.h"
 #include "../../ResourceUtils.h"
+#include "../../BufferUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/TypeInfo.h>
 #include "../../../Core/CoreUtils.h"
@@ -66,6 +67,7 @@ void D3D11CommandContext::ResetBindingStates()
     boundPipelineLayout_    = nullptr;
     boundPipelineState_     = nullptr;
     boundConstantsCache_    = nullptr;
+    computeSOBufferIASlot0_ = nullptr;
 }
 
 void D3D11CommandContext::BindSwapChainRenderTargets(D3D11SwapChain& swapChainD3D)
@@ -202,6 +204,12 @@ void D3D11CommandContext::SetVertexBuffer(D3D11Buffer& bufferD3D)
         0,
         bufferD3D.GetBindingLocator()
     );
+
+    /* Store vertex buffer for slot 0 in case it's used for compute stream-output */
+    if ((bufferD3D.GetBindFlags() & BindFlags::ComputeStreamOutput) != 0)
+        computeSOBufferIASlot0_ = &bufferD3D;
+    else
+        computeSOBufferIASlot0_ = nullptr;
 }
 
 void D3D11CommandContext::SetVertexBufferArray(D3D11BufferArray& bufferArrayD3D)
@@ -214,6 +222,7 @@ void D3D11CommandContext::SetVertexBufferArray(D3D11BufferArray& bufferArrayD3D)
         bufferArrayD3D.GetOffsets(),
         bufferArrayD3D.GetBindingLocators()
     );
+    computeSOBufferIASlot0_ = nullptr;
 }
 
 void D3D11CommandContext::SetIndexBuffer(D3D11Buffer& bufferD3D, DXGI_FORMAT format, UINT offset)
@@ -268,7 +277,7 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
     {
         case D3DResourceType_CBV:
         {
-            auto& bufferD3D = LLGL_CAST(D3D11Buffer&, resource);
+            auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, resource);
             ID3D11Buffer* cbv[] = { bufferD3D.GetNative() };
             stateMngr_->SetConstantBuffers(binding.slot, 1, cbv, binding.stageFlags);
         }
@@ -276,7 +285,7 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
 
         case D3DResourceType_BufferSRV:
         {
-            auto& bufferD3D = LLGL_CAST(D3D11BufferWithRV&, resource);
+            auto& bufferD3D = LLGL_HOT_CAST(D3D11BufferWithRV&, resource);
             ID3D11ShaderResourceView* srv[] = { bufferD3D.GetSRV() };
             D3D11BindingLocator* locator[] = { bufferD3D.GetBindingLocator() };
             bindingTable_->SetShaderResourceViews(binding.slot, 1, srv, locator, nullptr, binding.stageFlags);
@@ -285,7 +294,7 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
 
         case D3DResourceType_BufferUAV:
         {
-            auto& bufferD3D = LLGL_CAST(D3D11BufferWithRV&, resource);
+            auto& bufferD3D = LLGL_HOT_CAST(D3D11BufferWithRV&, resource);
             ID3D11UnorderedAccessView* uav[] = { bufferD3D.GetUAV() };
             const UINT initialCounts[] = { bufferD3D.GetInitialCount() };
             D3D11BindingLocator* locator[] = { bufferD3D.GetBindingLocator() };
@@ -295,7 +304,7 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
 
         case D3DResourceType_TextureSRV:
         {
-            auto& textureD3D = LLGL_CAST(D3D11Texture&, resource);
+            auto& textureD3D = LLGL_HOT_CAST(D3D11Texture&, resource);
             ID3D11ShaderResourceView* srv[] = { textureD3D.GetSRV() };
             D3D11BindingLocator* locator[] = { textureD3D.GetBindingLocator() };
             bindingTable_->SetShaderResourceViews(binding.slot, 1, srv, locator, nullptr, binding.stageFlags);
@@ -304,7 +313,7 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
 
         case D3DResourceType_TextureUAV:
         {
-            auto& textureD3D = LLGL_CAST(D3D11Texture&, resource);
+            auto& textureD3D = LLGL_HOT_CAST(D3D11Texture&, resource);
             ID3D11UnorderedAccessView* uav[] = { textureD3D.GetUAV() };
             const UINT initialCounts[] = { 0 };
             D3D11BindingLocator* locator[] = { textureD3D.GetBindingLocator() };
@@ -315,7 +324,7 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
         case D3DResourceType_Sampler:
         {
             /* Set sampler state object to all shader stages */
-            auto& samplerD3D = LLGL_CAST(D3D11Sampler&, resource);
+            auto& samplerD3D = LLGL_HOT_CAST(D3D11Sampler&, resource);
             ID3D11SamplerState* samplerStates[] = { samplerD3D.GetNative() };
             stateMngr_->SetSamplers(binding.slot, 1, samplerStates, binding.stageFlags);
         }
@@ -325,6 +334,36 @@ HRESULT D3D11CommandContext::SetResource(std::uint32_t descriptor, Resource& res
     return S_OK;
 }
 
+HRESULT D3D11CommandContext::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    if (boundPipelineLayout_ == nullptr)
+        return E_POINTER;
+
+    const auto& bindingList = boundPipelineLayout_->GetBindings();
+    if (!(descriptor < bindingList.size()))
+        return E_INVALIDARG;
+
+    const D3D11PipelineResourceBinding& binding = bindingList[descriptor];
+    if (binding.type != D3DResourceType_CBV)
+        return E_INVALIDARG;
+
+    /*
+    Bind buffer range in units of constant registers (16 bytes);
+    The number of constants must be a multiple of 16 as required by *SetConstantBuffers1(), so round the size up to 256 bytes
+    */
+    constexpr UINT cbufferVectorAlignment = 16;
+    constexpr UINT cbufferRangeAlignment  = cbufferVectorAlignment*16;
+
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
+    ID3D11Buffer* buffers[]        = { bufferD3D.GetNative() };
+    const UINT    firstConstants[] = { static_cast<UINT>(offset / cbufferVectorAlignment) };
+    const UINT    numConstants[]   = { static_cast<UINT>(GetAlignedSize<std::uint64_t>(size, cbufferRangeAlignment) / cbufferVectorAlignment) };
+
+    stateMngr_->SetConstantBuffersRange(binding.slot, 1, buffers, firstConstants, numConstants, binding.stageFlags);
+
+    return S_OK;
+}
+
 /* ----- Pipeline States ----- */
 
 void D3D11CommandContext::SetPipelineState(D3D11PipelineState* pipelineStateD3D)
@@ -408,7 +447,14 @@ void D3D11CommandContext::DrawIndexedInstancedIndirectN(ID3D11Buffer* bufferForA
 void D3D11CommandContext::DrawAuto()
 {
     FlushGraphicsResourceBindingCache();
-    context_->DrawAuto();
+    if (computeSOBufferIASlot0_ != nullptr)
+    {
+        /* Draw with the arguments that were written by a compute shader at the end of the vertex buffer */
+        const UINT argsOffset = static_cast<UINT>(GetComputeStreamOutputArgsOffset(computeSOBufferIASlot0_->GetSize()));
+        context_->DrawInstancedIndirect(computeSOBufferIASlot0_->GetNative(), argsOffset);
+    }
+    else
+        context_->DrawAuto();
 }
 
 /* ----- Compute ----- */
@@ -64,6 +64,7 @@ class D3D11CommandContext
 
         HRESULT SetResourceHeap(D3D11ResourceHeap& resourceHeapD3D, std::uint32_t descriptorSet);
         HRESULT SetResource(std::uint32_t descriptor, Resource& resource);
+        HRESULT SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size);
 
         void SetPipelineState(D3D11PipelineState* pipelineStateD3D);
 
@@ -167,6 +168,7 @@ class D3D11CommandContext
         const D3D11PipelineLayout*          boundPipelineLayout_    = nullptr;
         D3D11PipelineState*                 boundPipelineState_     = nullptr;
         D3D11ConstantsCache*                boundConstantsCache_    = nullptr;
+        D3D11Buffer*                        computeSOBufferIASlot0_ = nullptr;
 
 };
 
@@ -9,6 +9,7 @@
 #include "D3D11Command.h"
 #include "D3D11CommandOpcode.h"
 #include "D3D11CommandContext.h"
+#include "D3D11PrimaryCommandBuffer.h"
 #include "D3D11SecondaryCommandBuffer.h"
 
 #include "../../CheckedCast.h"
@@ -22,8 +23,9 @@ namespace LLGL
 {
 
 
-static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc, D3D11CommandContext& context)
+static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc, D3D11PrimaryCommandBuffer& cmdBuffer)
 {
+    D3D11CommandContext& context = cmdBuffer.GetCommandContext();
     switch (opcode)
     {
         case D3D11OpcodeSetVertexBuffer:
@@ -62,6 +64,12 @@ static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc,
             context.SetResource(cmd->descriptor, *(cmd->resource));
             return sizeof(*cmd);
         }
+        case D3D11OpcodeSetConstantBufferRange:
+        {
+            auto cmd = static_cast<const D3D11CmdSetConstantBufferRange*>(pc);
+            context.SetConstantBufferRange(cmd->descriptor, *(cmd->buffer), cmd->offset, cmd->size);
+            return sizeof(*cmd);
+        }
         case D3D11OpcodeSetBlendFactor:
         {
             auto cmd = static_cast<const D3D11CmdSetBlendFactor*>(pc);
@@ -145,30 +153,170 @@ static std::size_t ExecuteD3D11Command(const D3D11Opcode opcode, const void* pc,
             context.DispatchIndirect(cmd->bufferForArgs, cmd->alignedByteOffsetForArgs);
             return sizeof(*cmd);
         }
+        case D3D11OpcodeExecute:
+        {
+            auto cmd = static_cast<const D3D11CmdExecute*>(pc);
+            cmdBuffer.Execute(*(cmd->commandBuffer));
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeUpdateBuffer:
+        {
+            auto cmd = static_cast<const D3D11CmdUpdateBuffer*>(pc);
+            cmdBuffer.UpdateBuffer(*(cmd->dstBuffer), cmd->dstOffset, cmd + 1, cmd->dataSize);
+            return (sizeof(*cmd) + cmd->dataSize);
+        }
+        case D3D11OpcodeCopyBuffer:
+        {
+            auto cmd = static_cast<const D3D11CmdCopyBuffer*>(pc);
+            cmdBuffer.CopyBuffer(*(cmd->dstBuffer), cmd->dstOffset, *(cmd->srcBuffer), cmd->srcOffset, cmd->size);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeCopyBufferFromTexture:
+        {
+            auto cmd = static_cast<const D3D11CmdCopyBufferFromTexture*>(pc);
+            cmdBuffer.CopyBufferFromTexture(*(cmd->dstBuffer), cmd->dstOffset, *(cmd->srcTexture), cmd->srcRegion, cmd->rowStride, cmd->layerStride);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeFillBuffer:
+        {
+            auto cmd = static_cast<const D3D11CmdFillBuffer*>(pc);
+            cmdBuffer.FillBuffer(*(cmd->dstBuffer), cmd->dstOffset, cmd->value, cmd->fillSize);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeCopyTexture:
+        {
+            auto cmd = static_cast<const D3D11CmdCopyTexture*>(pc);
+            cmdBuffer.CopyTexture(*(cmd->dstTexture), cmd->dstLocation, *(cmd->srcTexture), cmd->srcLocation, cmd->extent);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeCopyTextureFromBuffer:
+        {
+            auto cmd = static_cast<const D3D11CmdCopyTextureFromBuffer*>(pc);
+            cmdBuffer.CopyTextureFromBuffer(*(cmd->dstTexture), cmd->dstRegion, *(cmd->srcBuffer), cmd->srcOffset, cmd->rowStride, cmd->layerStride);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeCopyTextureFromFramebuffer:
+        {
+            auto cmd = static_cast<const D3D11CmdCopyTextureFromFramebuffer*>(pc);
+            cmdBuffer.CopyTextureFromFramebuffer(*(cmd->dstTexture), cmd->dstRegion, cmd->srcOffset);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeGenerateMips:
+        {
+            auto cmd = static_cast<const D3D11CmdGenerateMips*>(pc);
+            cmdBuffer.GenerateMips(*(cmd->texture));
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeGenerateMipsSubresource:
+        {
+            auto cmd = static_cast<const D3D11CmdGenerateMipsSubresource*>(pc);
+            cmdBuffer.GenerateMips(*(cmd->texture), cmd->subresource);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeSetViewports:
+        {
+            auto cmd = static_cast<const D3D11CmdSetViewports*>(pc);
+            cmdBuffer.SetViewports(cmd->numViewports, reinterpret_cast<const Viewport*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(Viewport)*cmd->numViewports);
+        }
+        case D3D11OpcodeSetScissors:
+        {
+            auto cmd = static_cast<const D3D11CmdSetScissors*>(pc);
+            cmdBuffer.SetScissors(cmd->numScissors, reinterpret_cast<const Scissor*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(Scissor)*cmd->numScissors);
+        }
+        case D3D11OpcodeBeginRenderPass:
+        {
+            auto cmd = static_cast<const D3D11CmdBeginRenderPass*>(pc);
+            cmdBuffer.BeginRenderPass(*(cmd->renderTarget), cmd->renderPass, cmd->numClearValues, reinterpret_cast<const ClearValue*>(cmd + 1), cmd->swapBufferIndex);
+            return (sizeof(*cmd) + sizeof(ClearValue)*cmd->numClearValues);
+        }
+        case D3D11OpcodeEndRenderPass:
+        {
+            cmdBuffer.EndRenderPass();
+            return 0;
+        }
+        case D3D11OpcodeClear:
+        {
+            auto cmd = static_cast<const D3D11CmdClear*>(pc);
+            cmdBuffer.Clear(cmd->flags, cmd->clearValue);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeClearAttachments:
+        {
+            auto cmd = static_cast<const D3D11CmdClearAttachments*>(pc);
+            cmdBuffer.ClearAttachments(cmd->numAttachments, reinterpret_cast<const AttachmentClear*>(cmd + 1));
+            return (sizeof(*cmd) + sizeof(AttachmentClear)*cmd->numAttachments);
+        }
+        case D3D11OpcodeBeginQuery:
+        {
+            auto cmd = static_cast<const D3D11CmdQuery*>(pc);
+            cmdBuffer.BeginQuery(*(cmd->queryHeap), cmd->query);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeEndQuery:
+        {
+            auto cmd = static_cast<const D3D11CmdQuery*>(pc);
+            cmdBuffer.EndQuery(*(cmd->queryHeap), cmd->query);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeBeginRenderCondition:
+        {
+            auto cmd = static_cast<const D3D11CmdBeginRenderCondition*>(pc);
+            cmdBuffer.BeginRenderCondition(*(cmd->queryHeap), cmd->query, cmd->mode);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeEndRenderCondition:
+        {
+            cmdBuffer.EndRenderCondition();
+            return 0;
+        }
+        case D3D11OpcodeBeginStreamOutput:
+        {
+            auto cmd = static_cast<const D3D11CmdBeginStreamOutput*>(pc);
+            cmdBuffer.BeginStreamOutput(cmd->numBuffers, cmd->buffers);
+            return sizeof(*cmd);
+        }
+        case D3D11OpcodeEndStreamOutput:
+        {
+            cmdBuffer.EndStreamOutput();
+            return 0;
+        }
+        case D3D11OpcodePushDebugGroup:
+        {
+            auto cmd = static_cast<const D3D11CmdPushDebugGroup*>(pc);
+            cmdBuffer.PushDebugGroup(reinterpret_cast<const char*>(cmd + 1));
+            return (sizeof(*cmd) + cmd->length + 1);
+        }
+        case D3D11OpcodePopDebugGroup:
+        {
+            cmdBuffer.PopDebugGroup();
+            return 0;
+        }
         default:
             return 0;
     }
 }
 
-static void ExecuteD3D11CommandsEmulated(const D3D11VirtualCommandBuffer& virtualCmdBuffer, D3D11CommandContext& context)
+static void ExecuteD3D11CommandsEmulated(const D3D11VirtualCommandBuffer& virtualCmdBuffer, D3D11PrimaryCommandBuffer& primaryCmdBuffer)
 {
-    virtualCmdBuffer.Run(ExecuteD3D11Command, context);
+    virtualCmdBuffer.Run(ExecuteD3D11Command, primaryCmdBuffer);
 }
 
-void ExecuteD3D11SecondaryCommandBuffer(const D3D11SecondaryCommandBuffer& cmdBuffer, D3D11CommandContext& context)
+void ExecuteD3D11SecondaryCommandBuffer(const D3D11SecondaryCommandBuffer& cmdBuffer, D3D11PrimaryCommandBuffer& primaryCmdBuffer)
 {
-    /* Emulate execution of GL commands */
-    ExecuteD3D11CommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), context);
+    /* Emulate execution of D3D11 commands */
+    ExecuteD3D11CommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), primaryCmdBuffer);
 }
 
-void ExecuteD3D11CommandBuffer(const D3D11CommandBuffer& cmdBuffer, D3D11CommandContext& context)
+void ExecuteD3D11CommandBuffer(const D3D11CommandBuffer& cmdBuffer, D3D11PrimaryCommandBuffer& primaryCmdBuffer)
 {
     /* Is this a secondary command buffer? */
     if (cmdBuffer.IsSecondaryCmdBuffer())
     {
         /* Execute secondary command buffer */
         auto& secondaryCmdBufferD3D = LLGL_CAST(const D3D11SecondaryCommandBuffer&, cmdBuffer);
-        ExecuteD3D11SecondaryCommandBuffer(secondaryCmdBufferD3D, context);
+        ExecuteD3D11SecondaryCommandBuffer(secondaryCmdBufferD3D, primaryCmdBuffer);
     }
 }
 
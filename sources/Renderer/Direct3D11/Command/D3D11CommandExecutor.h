@@ -14,15 +14,15 @@ namespace LLGL
 
 
 class D3D11CommandBuffer;
-class D3D11CommandContext;
+class D3D11PrimaryCommandBuffer;
 class D3D11SecondaryCommandBuffer;
 
 /*
 Executes all D3D11 commands that have been recorded in the specified command buffer.
-D3D render states are tracked with the specified state manager.
+Commands are replayed on the specified primary command buffer, which can either be a deferred or an immediate command buffer.
 */
-void ExecuteD3D11SecondaryCommandBuffer(const D3D11SecondaryCommandBuffer& cmdbuffer, D3D11CommandContext& context);
-void ExecuteD3D11CommandBuffer(const D3D11CommandBuffer& cmdbuffer, D3D11CommandContext& context);
+void ExecuteD3D11SecondaryCommandBuffer(const D3D11SecondaryCommandBuffer& cmdbuffer, D3D11PrimaryCommandBuffer& primaryCmdBuffer);
+void ExecuteD3D11CommandBuffer(const D3D11CommandBuffer& cmdbuffer, D3D11PrimaryCommandBuffer& primaryCmdBuffer);
 
 
 } // /namespace LLGL
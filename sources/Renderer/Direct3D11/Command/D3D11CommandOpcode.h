@@ -24,6 +24,7 @@ enum D3D11Opcode : std::uint8_t
     D3D11OpcodeSetPipelineState,
     D3D11OpcodeSetResourceHeap,
     D3D11OpcodeSetResource,
+    D3D11OpcodeSetConstantBufferRange,
     D3D11OpcodeSetBlendFactor,
     D3D11OpcodeSetStencilRef,
     D3D11OpcodeSetUniforms,
@@ -38,6 +39,32 @@ enum D3D11Opcode : std::uint8_t
     D3D11OpcodeDrawAuto,
     D3D11OpcodeDispatch,
     D3D11OpcodeDispatchIndirect,
+
+    /* Opcodes for primary command buffers with emulated deferred contexts */
+    D3D11OpcodeExecute,
+    D3D11OpcodeUpdateBuffer,
+    D3D11OpcodeCopyBuffer,
+    D3D11OpcodeCopyBufferFromTexture,
+    D3D11OpcodeFillBuffer,
+    D3D11OpcodeCopyTexture,
+    D3D11OpcodeCopyTextureFromBuffer,
+    D3D11OpcodeCopyTextureFromFramebuffer,
+    D3D11OpcodeGenerateMips,
+    D3D11OpcodeGenerateMipsSubresource,
+    D3D11OpcodeSetViewports,
+    D3D11OpcodeSetScissors,
+    D3D11OpcodeBeginRenderPass,
+    D3D11OpcodeEndRenderPass,
+    D3D11OpcodeClear,
+    D3D11OpcodeClearAttachments,
+    D3D11OpcodeBeginQuery,
+    D3D11OpcodeEndQuery,
+    D3D11OpcodeBeginRenderCondition,
+    D3D11OpcodeEndRenderCondition,
+    D3D11OpcodeBeginStreamOutput,
+    D3D11OpcodeEndStreamOutput,
+    D3D11OpcodePushDebugGroup,
+    D3D11OpcodePopDebugGroup,
 };
 
 
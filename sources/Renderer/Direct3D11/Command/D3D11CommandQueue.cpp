@@ -7,9 +7,12 @@
 
 #include "D3D11CommandQueue.h"
 #include "D3D11PrimaryCommandBuffer.h"
+#include "D3D11SecondaryCommandBuffer.h"
+#include "D3D11CommandExecutor.h"
 #include "../RenderState/D3D11Fence.h"
 #include "../RenderState/D3D11QueryHeap.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -26,6 +29,15 @@ D3D11CommandQueue::D3D11CommandQueue(
     stateMngr_         { stateMngr },
     intermediateFence_ { device    }
 {
+    if (stateMngr->NeedsCommandListEmulation())
+    {
+        /* Primary command buffers are recorded as virtual command buffers, so create an immediate command buffer to replay them */
+        CommandBufferDescriptor immediateCmdBufferDesc;
+        {
+            immediateCmdBufferDesc.flags = CommandBufferFlags::ImmediateSubmit;
+        }
+        immediateCmdBuffer_ = MakeUnique<D3D11PrimaryCommandBuffer>(device, context, stateMngr, immediateCmdBufferDesc);
+    }
 }
 
 /* ----- Command Buffers ----- */
@@ -45,6 +57,14 @@ void D3D11CommandQueue::Submit(CommandBuffer& commandBuffer)
             stateMngr_->ClearCache();
         }
     }
+    else if (immediateCmdBuffer_)
+    {
+        /* Replay virtual command buffer on the immediate context, which is cheaper than runtime emulated command lists */
+        auto& virtualCmdBufferD3D = LLGL_CAST(D3D11SecondaryCommandBuffer&, commandBuffer);
+        immediateCmdBuffer_->Begin();
+        ExecuteD3D11SecondaryCommandBuffer(virtualCmdBufferD3D, *immediateCmdBuffer_);
+        immediateCmdBuffer_->End();
+    }
 }
 
 /* ----- Queries ----- */
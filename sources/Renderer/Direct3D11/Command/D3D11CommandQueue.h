@@ -13,6 +13,7 @@
 #include <LLGL/ForwardDecls.h>
 #include "../RenderState/D3D11Fence.h"
 #include "../RenderState/D3D11StateManager.h"
+#include "D3D11PrimaryCommandBuffer.h"
 #include "../../DXCommon/ComPtr.h"
 #include <d3d11.h>
 
@@ -69,9 +70,12 @@ class D3D11CommandQueue final : public CommandQueue
 
     private:
 
-        ComPtr<ID3D11DeviceContext>         context_;
-        std::shared_ptr<D3D11StateManager>  stateMngr_;
-        D3D11Fence                          intermediateFence_;
+        ComPtr<ID3D11DeviceContext>                 context_;
+        std::shared_ptr<D3D11StateManager>          stateMngr_;
+        D3D11Fence                                  intermediateFence_;
+
+        // Immediate command buffer to replay virtual command buffers if command lists are emulated by the D3D runtime.
+        std::unique_ptr<D3D11PrimaryCommandBuffer>  immediateCmdBuffer_;
 
 };
 
@@ -40,6 +40,7 @@
 #include "../Texture/D3D11Sampler.h"
 #include "../Texture/D3D11RenderTarget.h"
 #include "../Texture/D3D11MipGenerator.h"
+#include "../../FormatTable.h"
 
 #include <LLGL/Backend/Direct3D11/NativeHandle.h>
 
@@ -83,8 +84,8 @@ void D3D11PrimaryCommandBuffer::End()
 
 void D3D11PrimaryCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
-    auto& cmdBufferD3D = LLGL_CAST(D3D11CommandBuffer&, secondaryCommandBuffer);
-    ExecuteD3D11CommandBuffer(cmdBufferD3D, context_);
+    auto& cmdBufferD3D = LLGL_HOT_CAST(D3D11CommandBuffer&, secondaryCommandBuffer);
+    ExecuteD3D11CommandBuffer(cmdBufferD3D, *this);
 }
 
 /* ----- Blitting ----- */
@@ -95,7 +96,7 @@ void D3D11PrimaryCommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
-    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D11Buffer&, dstBuffer);
     const bool needsCommandListEmulation = context_.GetStateManager().NeedsCommandListEmulation();
     dstBufferD3D.WriteSubresource(GetNative(), data, static_cast<UINT>(dataSize), static_cast<UINT>(dstOffset), needsCommandListEmulation);
 }
@@ -107,8 +108,8 @@ void D3D11PrimaryCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
-    D3D11Buffer& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
-    D3D11Buffer& srcBufferD3D = LLGL_CAST(D3D11Buffer&, srcBuffer);
+    D3D11Buffer& dstBufferD3D = LLGL_HOT_CAST(D3D11Buffer&, dstBuffer);
+    D3D11Buffer& srcBufferD3D = LLGL_HOT_CAST(D3D11Buffer&, srcBuffer);
 
     const D3D11_BOX srcBox
     {
@@ -210,8 +211,8 @@ void D3D11PrimaryCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
-    auto& srcTextureD3D = LLGL_CAST(D3D11Texture&, srcTexture);
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D11Buffer&, dstBuffer);
+    auto& srcTextureD3D = LLGL_HOT_CAST(D3D11Texture&, srcTexture);
 
     /* Check if offsets are out of bounds or destination extent is zero */
     const auto& srcOffset = srcRegion.offset;
@@ -228,7 +229,7 @@ void D3D11PrimaryCommandBuffer::CopyBufferFromTexture(
     const UINT dstOffsetU32 = static_cast<UINT>(dstOffset);
 
     /* Get destination texture attributes */
-    const auto& formatAttribs = GetFormatAttribs(srcTextureD3D.GetFormat());
+    const auto& formatAttribs = FormatTable::GetAttribs(srcTextureD3D.GetFormat());
     if ((formatAttribs.flags & (FormatFlags::IsCompressed | FormatFlags::IsPacked)) != 0 || formatAttribs.components == 0)
         return; // E_INVALIDARG
 
@@ -403,7 +404,7 @@ void D3D11PrimaryCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-    auto& dstBufferD3D = LLGL_CAST(D3D11Buffer&, dstBuffer);
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D11Buffer&, dstBuffer);
 
     /* Copy value to 4D vector to be used with native D3D11 clear functions */
     UINT valuesVec4[4] = { value, value, value, value };
@@ -421,7 +422,7 @@ void D3D11PrimaryCommandBuffer::FillBuffer(
 
     if ((dstBufferD3D.GetBindFlags() & BindFlags::Storage) != 0)
     {
-        auto& dstBufferUAV = LLGL_CAST(D3D11BufferWithRV&, dstBufferD3D);
+        auto& dstBufferUAV = LLGL_HOT_CAST(D3D11BufferWithRV&, dstBufferD3D);
         auto uav = dstBufferUAV.GetUAV();
 
         if (uav != nullptr &&
@@ -470,8 +471,8 @@ void D3D11PrimaryCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
-    auto& srcTextureD3D = LLGL_CAST(D3D11Texture&, srcTexture);
+    auto& dstTextureD3D = LLGL_HOT_CAST(D3D11Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_HOT_CAST(D3D11Texture&, srcTexture);
 
     const Offset3D  dstOffset   = CalcTextureOffset(dstTexture.GetType(), dstLocation.offset);
     const D3D11_BOX srcBox      = srcTextureD3D.CalcRegion(srcLocation.offset, extent);
@@ -502,8 +503,8 @@ void D3D11PrimaryCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
-    auto& srcBufferD3D = LLGL_CAST(D3D11Buffer&, srcBuffer);
+    auto& dstTextureD3D = LLGL_HOT_CAST(D3D11Texture&, dstTexture);
+    auto& srcBufferD3D = LLGL_HOT_CAST(D3D11Buffer&, srcBuffer);
 
     /* Check if offsets are out of bounds or destination extent is zero */
     const auto& dstOffset = dstRegion.offset;
@@ -520,7 +521,7 @@ void D3D11PrimaryCommandBuffer::CopyTextureFromBuffer(
     const UINT srcOffsetU32 = static_cast<UINT>(srcOffset);
 
     /* Get destination texture attributes */
-    const auto& formatAttribs = GetFormatAttribs(dstTextureD3D.GetFormat());
+    const auto& formatAttribs = FormatTable::GetAttribs(dstTextureD3D.GetFormat());
     if ((formatAttribs.flags & (FormatFlags::IsCompressed | FormatFlags::IsPacked)) != 0 || formatAttribs.components == 0)
         return; // E_INVALIDARG
 
@@ -691,7 +692,7 @@ void D3D11PrimaryCommandBuffer::CopyTextureFromFramebuffer(
         return /*E_INVALIDARG*/;
     }
 
-    auto& dstTextureD3D = LLGL_CAST(D3D11Texture&, dstTexture);
+    auto& dstTextureD3D = LLGL_HOT_CAST(D3D11Texture&, dstTexture);
 
     ID3D11Resource* dstResource     = dstTextureD3D.GetNative();
     UINT            dstSubresource  = dstTextureD3D.CalcSubresource(dstRegion.subresource.baseMipLevel, dstRegion.subresource.baseArrayLayer);
@@ -719,13 +720,13 @@ void D3D11PrimaryCommandBuffer::CopyTextureFromFramebuffer(
 
 void D3D11PrimaryCommandBuffer::GenerateMips(Texture& texture)
 {
-    auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
+    auto& textureD3D = LLGL_HOT_CAST(D3D11Texture&, texture);
     D3D11MipGenerator::Get().GenerateMips(GetNative(), textureD3D);
 }
 
 void D3D11PrimaryCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
-    auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
+    auto& textureD3D = LLGL_HOT_CAST(D3D11Texture&, texture);
     D3D11MipGenerator::Get().GenerateMipsRange(
         GetNative(),
         textureD3D,
@@ -762,25 +763,25 @@ void D3D11PrimaryCommandBuffer::SetScissors(std::uint32_t numScissors, const Sci
 
 void D3D11PrimaryCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.SetVertexBuffer(bufferD3D);
 }
 
 void D3D11PrimaryCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
-    auto& bufferArrayD3D = LLGL_CAST(D3D11BufferArray&, bufferArray);
+    auto& bufferArrayD3D = LLGL_HOT_CAST(D3D11BufferArray&, bufferArray);
     context_.SetVertexBufferArray(bufferArrayD3D);
 }
 
 void D3D11PrimaryCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.SetIndexBuffer(bufferD3D, bufferD3D.GetDXFormat(), 0);
 }
 
 void D3D11PrimaryCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.SetIndexBuffer(bufferD3D, DXTypes::ToDXGIFormat(format), static_cast<UINT>(offset));
 }
 
@@ -788,7 +789,7 @@ void D3D11PrimaryCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format form
 
 void D3D11PrimaryCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
-    auto& resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap&, resourceHeap);
+    auto& resourceHeapD3D = LLGL_HOT_CAST(D3D11ResourceHeap&, resourceHeap);
     (void)context_.SetResourceHeap(resourceHeapD3D, descriptorSet);
 }
 
@@ -797,6 +798,11 @@ void D3D11PrimaryCommandBuffer::SetResource(std::uint32_t descriptor, Resource&
     (void)context_.SetResource(descriptor, resource);
 }
 
+void D3D11PrimaryCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    (void)context_.SetConstantBufferRange(descriptor, buffer, offset, size);
+}
+
 void D3D11PrimaryCommandBuffer::ResourceBarrier(
     std::uint32_t       /*numBuffers*/,
     Buffer* const *     /*buffers*/,
@@ -818,19 +824,19 @@ void D3D11PrimaryCommandBuffer::BeginRenderPass(
     /* Bind render target/context */
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
-        auto& swapChainD3D = LLGL_CAST(D3D11SwapChain&, renderTarget);
+        auto& swapChainD3D = LLGL_HOT_CAST(D3D11SwapChain&, renderTarget);
         context_.BindSwapChainRenderTargets(swapChainD3D);
     }
     else
     {
-        auto& renderTargetD3D = LLGL_CAST(D3D11RenderTarget&, renderTarget);
+        auto& renderTargetD3D = LLGL_HOT_CAST(D3D11RenderTarget&, renderTarget);
         context_.BindOffscreenRenderTargets(renderTargetD3D);
     }
 
     /* Clear attachments */
     if (renderPass != nullptr)
     {
-        auto* renderPassD3D = LLGL_CAST(const D3D11RenderPass*, renderPass);
+        auto* renderPassD3D = LLGL_HOT_CAST(const D3D11RenderPass*, renderPass);
         context_.ClearFramebufferViewsOrdered(
             numClearValues,
             clearValues,
@@ -860,7 +866,7 @@ void D3D11PrimaryCommandBuffer::ClearAttachments(std::uint32_t numAttachments, c
 
 void D3D11PrimaryCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    auto* pipelineStateD3D = LLGL_CAST(D3D11PipelineState*, &pipelineState);
+    auto* pipelineStateD3D = LLGL_HOT_CAST(D3D11PipelineState*, &pipelineState);
     context_.SetPipelineState(pipelineStateD3D);
 }
 
@@ -874,6 +880,11 @@ void D3D11PrimaryCommandBuffer::SetStencilReference(std::uint32_t reference, con
     GetStateManager().SetStencilRef(reference);
 }
 
+void D3D11PrimaryCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // dummy - not supported in D3D11
+}
+
 void D3D11PrimaryCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     context_.SetUniforms(first, data, dataSize);
@@ -883,7 +894,7 @@ void D3D11PrimaryCommandBuffer::SetUniforms(std::uint32_t first, const void* dat
 
 void D3D11PrimaryCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
+    auto& queryHeapD3D = LLGL_HOT_CAST(D3D11QueryHeap&, queryHeap);
 
     query *= queryHeapD3D.GetGroupSize();
 
@@ -902,7 +913,7 @@ void D3D11PrimaryCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t q
 
 void D3D11PrimaryCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
+    auto& queryHeapD3D = LLGL_HOT_CAST(D3D11QueryHeap&, queryHeap);
 
     query *= queryHeapD3D.GetGroupSize();
 
@@ -919,9 +930,19 @@ void D3D11PrimaryCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t que
     }
 }
 
+void D3D11PrimaryCommandBuffer::ResolveQueryData(
+    QueryHeap&      /*srcQueryHeap*/,
+    std::uint32_t   /*firstQuery*/,
+    std::uint32_t   /*numQueries*/,
+    Buffer&         /*dstBuffer*/,
+    std::uint64_t   /*dstOffset*/)
+{
+    // dummy - not supported in D3D11
+}
+
 void D3D11PrimaryCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
-    auto& queryHeapD3D = LLGL_CAST(D3D11QueryHeap&, queryHeap);
+    auto& queryHeapD3D = LLGL_HOT_CAST(D3D11QueryHeap&, queryHeap);
     GetNative()->SetPredication(
         queryHeapD3D.GetPredicate(query * queryHeapD3D.GetGroupSize()),
         (mode >= RenderConditionMode::WaitInverted)
@@ -945,7 +966,7 @@ void D3D11PrimaryCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buff
 
     for_range(i, numBuffers)
     {
-        auto* bufferD3D = LLGL_CAST(D3D11Buffer*, buffers[i]);
+        auto* bufferD3D = LLGL_HOT_CAST(D3D11Buffer*, buffers[i]);
         locators[i]     = bufferD3D->GetBindingLocator();
         soTargets[i]    = bufferD3D->GetNative();
         offsets[i]      = 0;
@@ -1003,33 +1024,88 @@ void D3D11PrimaryCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, s
 
 void D3D11PrimaryCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.DrawInstancedIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
 }
 
 void D3D11PrimaryCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.DrawInstancedIndirectN(bufferD3D.GetNative(), static_cast<UINT>(offset), numCommands, stride);
 }
 
 void D3D11PrimaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.DrawIndexedInstancedIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
 }
 
 void D3D11PrimaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.DrawIndexedInstancedIndirectN(bufferD3D.GetNative(), static_cast<UINT>(offset), numCommands, stride);
 }
 
+void D3D11PrimaryCommandBuffer::DrawIndirectCount(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11PrimaryCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in D3D11
+}
+
 void D3D11PrimaryCommandBuffer::DrawStreamOutput()
 {
     context_.DrawAuto();
 }
 
+void D3D11PrimaryCommandBuffer::DrawMeshTasks(
+    std::uint32_t   /*numWorkGroupsX*/,
+    std::uint32_t   /*numWorkGroupsY*/,
+    std::uint32_t   /*numWorkGroupsZ*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11PrimaryCommandBuffer::DrawMeshTasksIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    std::uint32_t   /*numCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11PrimaryCommandBuffer::DispatchTiles()
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11PrimaryCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
+{
+    // dummy - not supported in D3D11
+}
+
 /* ----- Compute ----- */
 
 void D3D11PrimaryCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1039,10 +1115,26 @@ void D3D11PrimaryCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint
 
 void D3D11PrimaryCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     context_.DispatchIndirect(bufferD3D.GetNative(), static_cast<UINT>(offset));
 }
 
+/* ----- Ray Tracing ----- */
+
+void D3D11PrimaryCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11PrimaryCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    // dummy - not supported in D3D11
+}
+
 /* ----- Debugging ----- */
 
 void D3D11PrimaryCommandBuffer::PushDebugGroup(const char* name)
@@ -24,6 +24,10 @@ class D3D11PrimaryCommandBuffer final : public D3D11CommandBuffer
 
         #include <LLGL/Backend/CommandBuffer.inl>
 
+    public:
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
     public:
 
         D3D11PrimaryCommandBuffer(
@@ -50,6 +54,12 @@ class D3D11PrimaryCommandBuffer final : public D3D11CommandBuffer
             return context_.GetNative();
         }
 
+        // Returns the command context this command buffer encodes its commands with.
+        inline D3D11CommandContext& GetCommandContext()
+        {
+            return context_;
+        }
+
         // Returns a pointer to the state manager for this command buffer.
         inline D3D11StateManager* GetStateManagerPtr() const
         {
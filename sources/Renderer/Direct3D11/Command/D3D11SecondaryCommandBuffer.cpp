@@ -14,6 +14,8 @@
 #include "../D3D11Types.h"
 #include "../../CheckedCast.h"
 #include <LLGL/IndirectArguments.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 #include <cstring>
 
 
@@ -42,118 +44,183 @@ void D3D11SecondaryCommandBuffer::End()
     // dummy
 }
 
-void D3D11SecondaryCommandBuffer::Execute(CommandBuffer& /*secondaryCommandBuffer*/)
+void D3D11SecondaryCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdExecute>(D3D11OpcodeExecute);
+    {
+        cmd->commandBuffer = &secondaryCommandBuffer;
+    }
 }
 
 /* ----- Blitting ----- */
 
 void D3D11SecondaryCommandBuffer::UpdateBuffer(
-    Buffer&         /*dstBuffer*/,
-    std::uint64_t   /*dstOffset*/,
-    const void*     /*data*/,
-    std::uint16_t   /*dataSize*/)
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    const void*     data,
+    std::uint16_t   dataSize)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdUpdateBuffer>(D3D11OpcodeUpdateBuffer, dataSize);
+    {
+        cmd->dstBuffer  = &dstBuffer;
+        cmd->dstOffset  = dstOffset;
+        cmd->dataSize   = dataSize;
+        std::memcpy(cmd + 1, data, dataSize);
+    }
 }
 
 void D3D11SecondaryCommandBuffer::CopyBuffer(
-    Buffer&         /*dstBuffer*/,
-    std::uint64_t   /*dstOffset*/,
-    Buffer&         /*srcBuffer*/,
-    std::uint64_t   /*srcOffset*/,
-    std::uint64_t   /*size*/)
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    Buffer&         srcBuffer,
+    std::uint64_t   srcOffset,
+    std::uint64_t   size)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdCopyBuffer>(D3D11OpcodeCopyBuffer);
+    {
+        cmd->dstBuffer  = &dstBuffer;
+        cmd->dstOffset  = dstOffset;
+        cmd->srcBuffer  = &srcBuffer;
+        cmd->srcOffset  = srcOffset;
+        cmd->size       = size;
+    }
 }
 
 void D3D11SecondaryCommandBuffer::CopyBufferFromTexture(
-    Buffer&                 /*dstBuffer*/,
-    std::uint64_t           /*dstOffset*/,
-    Texture&                /*srcTexture*/,
-    const TextureRegion&    /*srcRegion*/,
-    std::uint32_t           /*rowStride*/,
-    std::uint32_t           /*layerStride*/)
-{
-    // dummy - command not allowed in secondary command buffer
+    Buffer&                 dstBuffer,
+    std::uint64_t           dstOffset,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    auto cmd = AllocCommand<D3D11CmdCopyBufferFromTexture>(D3D11OpcodeCopyBufferFromTexture);
+    {
+        cmd->dstBuffer      = &dstBuffer;
+        cmd->dstOffset      = dstOffset;
+        cmd->srcTexture     = &srcTexture;
+        cmd->srcRegion      = srcRegion;
+        cmd->rowStride      = rowStride;
+        cmd->layerStride    = layerStride;
+    }
 }
 
 void D3D11SecondaryCommandBuffer::FillBuffer(
-    Buffer&         /*dstBuffer*/,
-    std::uint64_t   /*dstOffset*/,
-    std::uint32_t   /*value*/,
-    std::uint64_t   /*fillSize*/)
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    std::uint32_t   value,
+    std::uint64_t   fillSize)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdFillBuffer>(D3D11OpcodeFillBuffer);
+    {
+        cmd->dstBuffer  = &dstBuffer;
+        cmd->dstOffset  = dstOffset;
+        cmd->value      = value;
+        cmd->fillSize   = fillSize;
+    }
 }
 
 void D3D11SecondaryCommandBuffer::CopyTexture(
-    Texture&                /*dstTexture*/,
-    const TextureLocation&  /*dstLocation*/,
-    Texture&                /*srcTexture*/,
-    const TextureLocation&  /*srcLocation*/,
-    const Extent3D&         /*extent*/)
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdCopyTexture>(D3D11OpcodeCopyTexture);
+    {
+        cmd->dstTexture     = &dstTexture;
+        cmd->dstLocation    = dstLocation;
+        cmd->srcTexture     = &srcTexture;
+        cmd->srcLocation    = srcLocation;
+        cmd->extent         = extent;
+    }
 }
 
 void D3D11SecondaryCommandBuffer::CopyTextureFromBuffer(
-    Texture&                /*dstTexture*/,
-    const TextureRegion&    /*dstRegion*/,
-    Buffer&                 /*srcBuffer*/,
-    std::uint64_t           /*srcOffset*/,
-    std::uint32_t           /*rowStride*/,
-    std::uint32_t           /*layerStride*/)
-{
-    // dummy - command not allowed in secondary command buffer
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Buffer&                 srcBuffer,
+    std::uint64_t           srcOffset,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    auto cmd = AllocCommand<D3D11CmdCopyTextureFromBuffer>(D3D11OpcodeCopyTextureFromBuffer);
+    {
+        cmd->dstTexture     = &dstTexture;
+        cmd->dstRegion      = dstRegion;
+        cmd->srcBuffer      = &srcBuffer;
+        cmd->srcOffset      = srcOffset;
+        cmd->rowStride      = rowStride;
+        cmd->layerStride    = layerStride;
+    }
 }
 
 void D3D11SecondaryCommandBuffer::CopyTextureFromFramebuffer(
-    Texture&                /*dstTexture*/,
-    const TextureRegion&    /*dstRegion*/,
-    const Offset2D&         /*srcOffset*/)
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    const Offset2D&         srcOffset)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdCopyTextureFromFramebuffer>(D3D11OpcodeCopyTextureFromFramebuffer);
+    {
+        cmd->dstTexture = &dstTexture;
+        cmd->dstRegion  = dstRegion;
+        cmd->srcOffset  = srcOffset;
+    }
 }
 
-void D3D11SecondaryCommandBuffer::GenerateMips(Texture& /*texture*/)
+void D3D11SecondaryCommandBuffer::GenerateMips(Texture& texture)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdGenerateMips>(D3D11OpcodeGenerateMips);
+    {
+        cmd->texture = &texture;
+    }
 }
 
-void D3D11SecondaryCommandBuffer::GenerateMips(Texture& /*texture*/, const TextureSubresource& /*subresource*/)
+void D3D11SecondaryCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdGenerateMipsSubresource>(D3D11OpcodeGenerateMipsSubresource);
+    {
+        cmd->texture        = &texture;
+        cmd->subresource    = subresource;
+    }
 }
 
 /* ----- Viewport and Scissor ----- */
 
-void D3D11SecondaryCommandBuffer::SetViewport(const Viewport& /*viewport*/)
+void D3D11SecondaryCommandBuffer::SetViewport(const Viewport& viewport)
 {
-    // dummy - command not allowed in secondary command buffer
+    SetViewports(1, &viewport);
 }
 
-void D3D11SecondaryCommandBuffer::SetViewports(std::uint32_t /*numViewports*/, const Viewport* /*viewports*/)
+void D3D11SecondaryCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdSetViewports>(D3D11OpcodeSetViewports, sizeof(Viewport)*numViewports);
+    {
+        cmd->numViewports = numViewports;
+        std::memcpy(cmd + 1, viewports, sizeof(Viewport)*numViewports);
+    }
 }
 
-void D3D11SecondaryCommandBuffer::SetScissor(const Scissor& /*scissor*/)
+void D3D11SecondaryCommandBuffer::SetScissor(const Scissor& scissor)
 {
-    // dummy - command not allowed in secondary command buffer
+    SetScissors(1, &scissor);
 }
 
-void D3D11SecondaryCommandBuffer::SetScissors(std::uint32_t /*numScissors*/, const Scissor* /*scissors*/)
+void D3D11SecondaryCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdSetScissors>(D3D11OpcodeSetScissors, sizeof(Scissor)*numScissors);
+    {
+        cmd->numScissors = numScissors;
+        std::memcpy(cmd + 1, scissors, sizeof(Scissor)*numScissors);
+    }
 }
 
 /* ----- Buffers ------ */
 
 void D3D11SecondaryCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
-    auto* bufferD3D = LLGL_CAST(D3D11Buffer*, &buffer);
+    auto* bufferD3D = LLGL_HOT_CAST(D3D11Buffer*, &buffer);
     auto cmd = AllocCommand<D3D11CmdSetVertexBuffer>(D3D11OpcodeSetVertexBuffer);
     {
         cmd->buffer = bufferD3D;
@@ -162,7 +229,7 @@ void D3D11SecondaryCommandBuffer::SetVertexBuffer(Buffer& buffer)
 
 void D3D11SecondaryCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
-    auto* bufferArrayD3D = LLGL_CAST(D3D11BufferArray*, &bufferArray);
+    auto* bufferArrayD3D = LLGL_HOT_CAST(D3D11BufferArray*, &bufferArray);
     auto cmd = AllocCommand<D3D11CmdSetVertexBufferArray>(D3D11OpcodeSetVertexBufferArray);
     {
         cmd->bufferArray = bufferArrayD3D;
@@ -171,7 +238,7 @@ void D3D11SecondaryCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 
 void D3D11SecondaryCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto* bufferD3D = LLGL_CAST(D3D11Buffer*, &buffer);
+    auto* bufferD3D = LLGL_HOT_CAST(D3D11Buffer*, &buffer);
     auto cmd = AllocCommand<D3D11CmdSetIndexBuffer>(D3D11OpcodeSetIndexBuffer);
     {
         cmd->buffer = bufferD3D;
@@ -182,7 +249,7 @@ void D3D11SecondaryCommandBuffer::SetIndexBuffer(Buffer& buffer)
 
 void D3D11SecondaryCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto* bufferD3D = LLGL_CAST(D3D11Buffer*, &buffer);
+    auto* bufferD3D = LLGL_HOT_CAST(D3D11Buffer*, &buffer);
     auto cmd = AllocCommand<D3D11CmdSetIndexBuffer>(D3D11OpcodeSetIndexBuffer);
     {
         cmd->buffer = bufferD3D;
@@ -195,7 +262,7 @@ void D3D11SecondaryCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format fo
 
 void D3D11SecondaryCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
-    auto* resourceHeapD3D = LLGL_CAST(D3D11ResourceHeap*, &resourceHeap);
+    auto* resourceHeapD3D = LLGL_HOT_CAST(D3D11ResourceHeap*, &resourceHeap);
     auto cmd = AllocCommand<D3D11CmdSetResourceHeap>(D3D11OpcodeSetResourceHeap);
     {
         cmd->resourceHeap   = resourceHeapD3D;
@@ -212,6 +279,17 @@ void D3D11SecondaryCommandBuffer::SetResource(std::uint32_t descriptor, Resource
     }
 }
 
+void D3D11SecondaryCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto cmd = AllocCommand<D3D11CmdSetConstantBufferRange>(D3D11OpcodeSetConstantBufferRange);
+    {
+        cmd->descriptor = descriptor;
+        cmd->buffer     = &buffer;
+        cmd->offset     = offset;
+        cmd->size       = size;
+    }
+}
+
 void D3D11SecondaryCommandBuffer::ResourceBarrier(
     std::uint32_t       /*numBuffers*/,
     Buffer* const *     /*buffers*/,
@@ -224,35 +302,50 @@ void D3D11SecondaryCommandBuffer::ResourceBarrier(
 /* ----- Render Passes ----- */
 
 void D3D11SecondaryCommandBuffer::BeginRenderPass(
-    RenderTarget&       /*renderTarget*/,
-    const RenderPass*   /*renderPass*/,
-    std::uint32_t       /*numClearValues*/,
-    const ClearValue*   /*clearValues*/,
-    std::uint32_t       /*swapBufferIndex*/)
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       swapBufferIndex)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdBeginRenderPass>(D3D11OpcodeBeginRenderPass, sizeof(ClearValue)*numClearValues);
+    {
+        cmd->renderTarget       = &renderTarget;
+        cmd->renderPass         = renderPass;
+        cmd->numClearValues     = numClearValues;
+        cmd->swapBufferIndex    = swapBufferIndex;
+        std::memcpy(cmd + 1, clearValues, sizeof(ClearValue)*numClearValues);
+    }
 }
 
 void D3D11SecondaryCommandBuffer::EndRenderPass()
 {
-    // dummy - command not allowed in secondary command buffer
+    AllocOpcode(D3D11OpcodeEndRenderPass);
 }
 
-void D3D11SecondaryCommandBuffer::Clear(long /*flags*/, const ClearValue& /*clearValue*/)
+void D3D11SecondaryCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdClear>(D3D11OpcodeClear);
+    {
+        cmd->flags      = flags;
+        cmd->clearValue = clearValue;
+    }
 }
 
-void D3D11SecondaryCommandBuffer::ClearAttachments(std::uint32_t /*numAttachments*/, const AttachmentClear* /*attachments*/)
+void D3D11SecondaryCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdClearAttachments>(D3D11OpcodeClearAttachments, sizeof(AttachmentClear)*numAttachments);
+    {
+        cmd->numAttachments = numAttachments;
+        std::memcpy(cmd + 1, attachments, sizeof(AttachmentClear)*numAttachments);
+    }
 }
 
 /* ----- Pipeline States ----- */
 
 void D3D11SecondaryCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    auto* pipelineStateD3D = LLGL_CAST(D3D11PipelineState*, &pipelineState);
+    auto* pipelineStateD3D = LLGL_HOT_CAST(D3D11PipelineState*, &pipelineState);
     auto cmd = AllocCommand<D3D11CmdSetPipelineState>(D3D11OpcodeSetPipelineState);
     {
         cmd->pipelineState = pipelineStateD3D;
@@ -278,6 +371,11 @@ void D3D11SecondaryCommandBuffer::SetStencilReference(std::uint32_t reference, c
     }
 }
 
+void D3D11SecondaryCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // dummy - not supported in D3D11
+}
+
 void D3D11SecondaryCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     auto cmd = AllocCommand<D3D11CmdSetUniforms>(D3D11OpcodeSetUniforms, dataSize);
@@ -290,36 +388,65 @@ void D3D11SecondaryCommandBuffer::SetUniforms(std::uint32_t first, const void* d
 
 /* ----- Queries ----- */
 
-void D3D11SecondaryCommandBuffer::BeginQuery(QueryHeap& /*queryHeap*/, std::uint32_t /*query*/)
+void D3D11SecondaryCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdQuery>(D3D11OpcodeBeginQuery);
+    {
+        cmd->queryHeap  = &queryHeap;
+        cmd->query      = query;
+    }
 }
 
-void D3D11SecondaryCommandBuffer::EndQuery(QueryHeap& /*queryHeap*/, std::uint32_t /*query*/)
+void D3D11SecondaryCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    // dummy - command not allowed in secondary command buffer
+    auto cmd = AllocCommand<D3D11CmdQuery>(D3D11OpcodeEndQuery);
+    {
+        cmd->queryHeap  = &queryHeap;
+        cmd->query      = query;
+    }
 }
 
-void D3D11SecondaryCommandBuffer::BeginRenderCondition(QueryHeap& /*queryHeap*/, std::uint32_t /*query*/, const RenderConditionMode /*mode*/)
+void D3D11SecondaryCommandBuffer::ResolveQueryData(
+    QueryHeap&      /*srcQueryHeap*/,
+    std::uint32_t   /*firstQuery*/,
+    std::uint32_t   /*numQueries*/,
+    Buffer&         /*dstBuffer*/,
+    std::uint64_t   /*dstOffset*/)
 {
-    // dummy - command not allowed in secondary command buffer
+    // dummy - not supported in D3D11
+}
+
+void D3D11SecondaryCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
+{
+    auto cmd = AllocCommand<D3D11CmdBeginRenderCondition>(D3D11OpcodeBeginRenderCondition);
+    {
+        cmd->queryHeap  = &queryHeap;
+        cmd->query      = query;
+        cmd->mode       = mode;
+    }
 }
 
 void D3D11SecondaryCommandBuffer::EndRenderCondition()
 {
-    // dummy - command not allowed in secondary command buffer
+    AllocOpcode(D3D11OpcodeEndRenderCondition);
 }
 
 /* ----- Stream Output ------ */
 
-void D3D11SecondaryCommandBuffer::BeginStreamOutput(std::uint32_t /*numBuffers*/, Buffer* const * /*buffers*/)
+void D3D11SecondaryCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
 {
-    // dummy - command not allowed in secondary command buffer
+    numBuffers = std::min(numBuffers, LLGL_MAX_NUM_SO_BUFFERS);
+    auto cmd = AllocCommand<D3D11CmdBeginStreamOutput>(D3D11OpcodeBeginStreamOutput);
+    {
+        cmd->numBuffers = numBuffers;
+        for_range(i, numBuffers)
+            cmd->buffers[i] = buffers[i];
+    }
 }
 
 void D3D11SecondaryCommandBuffer::EndStreamOutput()
 {
-    // dummy - command not allowed in secondary command buffer
+    AllocOpcode(D3D11OpcodeEndStreamOutput);
 }
 
 /* ----- Drawing ----- */
@@ -413,7 +540,7 @@ void D3D11SecondaryCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices,
 
 void D3D11SecondaryCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     auto cmd = AllocCommand<D3D11CmdDrawInstancedIndirect>(D3D11OpcodeDrawInstancedIndirect);
     { 
         cmd->bufferForArgs              = bufferD3D.GetNative();
@@ -425,7 +552,7 @@ void D3D11SecondaryCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t off
 
 void D3D11SecondaryCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     auto cmd = AllocCommand<D3D11CmdDrawInstancedIndirect>(D3D11OpcodeDrawInstancedIndirectN);
     { 
         cmd->bufferForArgs              = bufferD3D.GetNative();
@@ -437,7 +564,7 @@ void D3D11SecondaryCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t off
 
 void D3D11SecondaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     auto cmd = AllocCommand<D3D11CmdDrawInstancedIndirect>(D3D11OpcodeDrawIndexedInstancedIndirect);
     { 
         cmd->bufferForArgs              = bufferD3D.GetNative();
@@ -449,7 +576,7 @@ void D3D11SecondaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint6
 
 void D3D11SecondaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     auto cmd = AllocCommand<D3D11CmdDrawInstancedIndirect>(D3D11OpcodeDrawIndexedInstancedIndirectN);
     { 
         cmd->bufferForArgs              = bufferD3D.GetNative();
@@ -459,11 +586,66 @@ void D3D11SecondaryCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint6
     }
 }
 
+void D3D11SecondaryCommandBuffer::DrawIndirectCount(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11SecondaryCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in D3D11
+}
+
 void D3D11SecondaryCommandBuffer::DrawStreamOutput()
 {
     AllocOpcode(D3D11OpcodeDrawAuto);
 }
 
+void D3D11SecondaryCommandBuffer::DrawMeshTasks(
+    std::uint32_t   /*numWorkGroupsX*/,
+    std::uint32_t   /*numWorkGroupsY*/,
+    std::uint32_t   /*numWorkGroupsZ*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11SecondaryCommandBuffer::DrawMeshTasksIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    std::uint32_t   /*numCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11SecondaryCommandBuffer::DispatchTiles()
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11SecondaryCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
+{
+    // dummy - not supported in D3D11
+}
+
 /* ----- Compute ----- */
 
 void D3D11SecondaryCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -478,7 +660,7 @@ void D3D11SecondaryCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::ui
 
 void D3D11SecondaryCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D11Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D11Buffer&, buffer);
     auto cmd = AllocCommand<D3D11CmdDispatchIndirect>(D3D11OpcodeDispatchIndirect);
     { 
         cmd->bufferForArgs              = bufferD3D.GetNative();
@@ -486,16 +668,37 @@ void D3D11SecondaryCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+/* ----- Ray Tracing ----- */
+
+void D3D11SecondaryCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    // dummy - not supported in D3D11
+}
+
+void D3D11SecondaryCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    // dummy - not supported in D3D11
+}
+
 /* ----- Debugging ----- */
 
-void D3D11SecondaryCommandBuffer::PushDebugGroup(const char* /*name*/)
+void D3D11SecondaryCommandBuffer::PushDebugGroup(const char* name)
 {
-    // dummy - command not allowed in secondary command buffer
+    const std::size_t length = std::strlen(name);
+    auto cmd = AllocCommand<D3D11CmdPushDebugGroup>(D3D11OpcodePushDebugGroup, length + 1);
+    {
+        cmd->length = length;
+        std::memcpy(cmd + 1, name, length + 1);
+    }
 }
 
 void D3D11SecondaryCommandBuffer::PopDebugGroup()
 {
-    // dummy - command not allowed in secondary command buffer
+    AllocOpcode(D3D11OpcodePopDebugGroup);
 }
 
 /* ----- Extensions ----- */
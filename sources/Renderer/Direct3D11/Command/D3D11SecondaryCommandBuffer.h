@@ -20,6 +20,10 @@ namespace LLGL
 
 using D3D11VirtualCommandBuffer = VirtualCommandBuffer<D3D11Opcode>;
 
+/*
+Virtual command buffer for secondary command buffers.
+This is also used for primary command buffers if the D3D runtime has to emulate command lists, in which case they are replayed on the immediate context.
+*/
 class D3D11SecondaryCommandBuffer final : public D3D11CommandBuffer
 {
 
@@ -27,6 +31,10 @@ class D3D11SecondaryCommandBuffer final : public D3D11CommandBuffer
 
         #include <LLGL/Backend/CommandBuffer.inl>
 
+    public:
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
     public:
 
         D3D11SecondaryCommandBuffer(const CommandBufferDescriptor& desc);
@@ -18,9 +18,11 @@
 #include "../../Core/CoreUtils.h"
 #include "../../Core/StringUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/Threading.h"
 #include "../../Platform/Module.h"
 #include "D3D11ObjectUtils.h"
 #include <limits.h>
+#include <algorithm>
 
 #include "Command/D3D11PrimaryCommandBuffer.h"
 #include "Command/D3D11SecondaryCommandBuffer.h"
@@ -62,7 +64,7 @@ D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemD
         CreateFactory();
 
         ComPtr<IDXGIAdapter> preferredAdatper;
-        QueryVideoAdapters(renderSystemDesc.flags, preferredAdatper);
+        QueryVideoAdapters(renderSystemDesc, preferredAdatper);
 
         HRESULT hr = CreateDevice(preferredAdatper.Get(), isDebugDevice, isSoftwareDevice);
         DXThrowIfFailed(hr, "failed to create D3D11 device");
@@ -85,6 +87,9 @@ D3D11RenderSystem::D3D11RenderSystem(const RenderSystemDescriptor& renderSystemD
     /* Initialize MIP-map generator singleton */
     D3D11MipGenerator::Get().InitializeDevice(device_);
     D3D11BuiltinShaderFactory::Get().CreateBuiltinShaders(device_.Get());
+
+    /* Map persistent shader cache */
+    shaderCache_.Open(renderSystemDesc.shaderCacheFilename);
 }
 
 D3D11RenderSystem::~D3D11RenderSystem()
@@ -127,6 +132,14 @@ CommandBuffer* D3D11RenderSystem::CreateCommandBuffer(const CommandBufferDescrip
         /* Create secondary command buffer with virtual buffer */
         return commandBuffers_.emplace<D3D11SecondaryCommandBuffer>(commandBufferDesc);
     }
+    else if (stateMngr_->NeedsCommandListEmulation())
+    {
+        /*
+        Create virtual command buffer that is replayed on the immediate context at submission,
+        since command lists emulated by the D3D runtime are more expensive than encoding commands directly (see D3D11_FEATURE_DATA_THREADING::DriverCommandLists)
+        */
+        return commandBuffers_.emplace<D3D11SecondaryCommandBuffer>(commandBufferDesc);
+    }
     else
     {
         /* Create deferred D3D11 device context */
@@ -171,10 +184,19 @@ void D3D11RenderSystem::Release(CommandBuffer& commandBuffer)
 Buffer* D3D11RenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, UINT_MAX);
+    Buffer* bufferD3D = nullptr;
     if (DXBindFlagsNeedBufferWithRV(bufferDesc.bindFlags))
-        return buffers_.emplace<D3D11BufferWithRV>(device_.Get(), bufferDesc, initialData);
+        bufferD3D = buffers_.emplace<D3D11BufferWithRV>(device_.Get(), bufferDesc, initialData);
     else
-        return buffers_.emplace<D3D11Buffer>(device_.Get(), bufferDesc, initialData);
+        bufferD3D = buffers_.emplace<D3D11Buffer>(device_.Get(), bufferDesc, initialData);
+    CheckMemoryBudget();
+    return bufferD3D;
+}
+
+void D3D11RenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    for_range(i, bufferDescs.size())
+        outBuffers[i] = CreateBuffer(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr));
 }
 
 BufferArray* D3D11RenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -190,6 +212,12 @@ void D3D11RenderSystem::Release(Buffer& buffer)
     buffers_.erase(&buffer);
 }
 
+void D3D11RenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    for (Buffer* buffer : buffers)
+        Release(*buffer);
+}
+
 void D3D11RenderSystem::Release(BufferArray& bufferArray)
 {
     bufferArrays_.erase(&bufferArray);
@@ -239,9 +267,17 @@ Texture* D3D11RenderSystem::CreateTexture(const TextureDescriptor& textureDesc,
     if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
         D3D11MipGenerator::Get().GenerateMips(context_.Get(), *textureD3D);
 
+    CheckMemoryBudget();
+
     return textureD3D;
 }
 
+void D3D11RenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    for_range(i, textureDescs.size())
+        outTextures[i] = CreateTexture(textureDescs[i], (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr));
+}
+
 void D3D11RenderSystem::Release(Texture& texture)
 {
     auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
@@ -249,6 +285,12 @@ void D3D11RenderSystem::Release(Texture& texture)
     textures_.erase(&texture);
 }
 
+void D3D11RenderSystem::Release(const ArrayView<Texture*>& textures)
+{
+    for (Texture* texture : textures)
+        Release(*texture);
+}
+
 void D3D11RenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
     auto& textureD3D = LLGL_CAST(D3D11Texture&, texture);
@@ -428,20 +470,49 @@ void D3D11RenderSystem::Release(RenderTarget& renderTarget)
 
 /* ----- Shader ----- */
 
-Shader* D3D11RenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
+using D3D11ShaderPtr = HWObjectContainer<D3D11Shader>::object_ptr<D3D11Shader>;
+
+// Allocates the D3D11 shader class that matches the shader type. ID3D11Device and ShaderCache are free-threaded, so this can run on worker threads.
+static D3D11ShaderPtr MakeD3D11Shader(ID3D11Device* device, ShaderCache* shaderCache, const ShaderDescriptor& shaderDesc)
 {
-    RenderSystem::AssertCreateShader(shaderDesc);
     switch (shaderDesc.type)
     {
         case ShaderType::Vertex:
-            return shaders_.emplace<D3D11VertexShader>(device_.Get(), shaderDesc);
+            return HWObjectContainer<D3D11Shader>::make<D3D11VertexShader>(device, shaderDesc, shaderCache);
         case ShaderType::TessEvaluation:
-            return shaders_.emplace<D3D11DomainShader>(device_.Get(), shaderDesc);
+            return HWObjectContainer<D3D11Shader>::make<D3D11DomainShader>(device, shaderDesc, shaderCache);
         default:
-            return shaders_.emplace<D3D11CommonShader>(device_.Get(), shaderDesc);
+            return HWObjectContainer<D3D11Shader>::make<D3D11CommonShader>(device, shaderDesc, shaderCache);
     }
 }
 
+Shader* D3D11RenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
+{
+    RenderSystem::AssertCreateShader(shaderDesc);
+    return shaders_.insert(MakeD3D11Shader(device_.Get(), GetShaderCache(), shaderDesc));
+}
+
+void D3D11RenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    for (const ShaderDescriptor& shaderDesc : shaderDescs)
+        RenderSystem::AssertCreateShader(shaderDesc);
+
+    /* Compile shaders on the worker thread pool, but insert them on the calling thread since the shader container is not thread-safe */
+    std::vector<D3D11ShaderPtr> newShaders(shaderDescs.size());
+    ID3D11Device* device = device_.Get();
+    ShaderCache* shaderCache = GetShaderCache();
+    DispatchConcurrentJobs(
+        shaderDescs.size(),
+        [device, shaderCache, &shaderDescs, &newShaders](std::size_t jobIndex)
+        {
+            newShaders[jobIndex] = MakeD3D11Shader(device, shaderCache, shaderDescs[jobIndex]);
+        }
+    );
+
+    for (std::size_t i = 0; i < newShaders.size(); ++i)
+        outShaders[i] = shaders_.insert(std::move(newShaders[i]));
+}
+
 void D3D11RenderSystem::Release(Shader& shader)
 {
     shaders_.erase(&shader);
@@ -451,7 +522,7 @@ void D3D11RenderSystem::Release(Shader& shader)
 
 PipelineLayout* D3D11RenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<D3D11PipelineLayout>(device_.Get(), pipelineLayoutDesc);
+    return pipelineLayouts_.emplace<D3D11PipelineLayout>(device_.Get(), statePool_, pipelineLayoutDesc);
 }
 
 void D3D11RenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -479,7 +550,7 @@ PipelineState* D3D11RenderSystem::CreatePipelineState(const GraphicsPipelineDesc
     if (device3_)
     {
         /* Create graphics pipeline for Direct3D 11.3 */
-        return pipelineStates_.emplace<D3D11GraphicsPSO3>(device3_.Get(), pipelineStateDesc);
+        return pipelineStates_.emplace<D3D11GraphicsPSO3>(device3_.Get(), statePool_, pipelineStateDesc);
     }
     #endif
 
@@ -487,7 +558,7 @@ PipelineState* D3D11RenderSystem::CreatePipelineState(const GraphicsPipelineDesc
     if (device2_)
     {
         /* Create graphics pipeline for Direct3D 11.1 (there is no dedicated class for 11.2) */
-        return pipelineStates_.emplace<D3D11GraphicsPSO1>(device2_.Get(), pipelineStateDesc);
+        return pipelineStates_.emplace<D3D11GraphicsPSO1>(device2_.Get(), statePool_, pipelineStateDesc);
     }
     #endif
 
@@ -495,12 +566,12 @@ PipelineState* D3D11RenderSystem::CreatePipelineState(const GraphicsPipelineDesc
     if (device1_)
     {
         /* Create graphics pipeline for Direct3D 11.1 */
-        return pipelineStates_.emplace<D3D11GraphicsPSO1>(device1_.Get(), pipelineStateDesc);
+        return pipelineStates_.emplace<D3D11GraphicsPSO1>(device1_.Get(), statePool_, pipelineStateDesc);
     }
     #endif
 
     /* Create graphics pipeline for Direct3D 11.0 */
-    return pipelineStates_.emplace<D3D11GraphicsPSO>(device_.Get(), pipelineStateDesc);
+    return pipelineStates_.emplace<D3D11GraphicsPSO>(device_.Get(), statePool_, pipelineStateDesc);
 }
 
 PipelineState* D3D11RenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
@@ -508,6 +579,25 @@ PipelineState* D3D11RenderSystem::CreatePipelineState(const ComputePipelineDescr
     return pipelineStates_.emplace<D3D11ComputePSO>(pipelineStateDesc);
 }
 
+void D3D11RenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    /* D3D11 PSOs share the state pool, which is not thread-safe, so they are created one after another */
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+void D3D11RenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+PipelineState* D3D11RenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& /*pipelineStateDesc*/, PipelineCache* /*pipelineCache*/)
+{
+    /* Direct3D 11 has no ray tracing pipelines */
+    return nullptr;
+}
+
 void D3D11RenderSystem::Release(PipelineState& pipelineState)
 {
     pipelineStates_.erase(&pipelineState);
@@ -612,6 +702,62 @@ bool D3D11RenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCap
     return true;
 }
 
+std::uint32_t D3D11RenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos)
+{
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+
+    /* Query IDXGIAdapter3 interface once; this requires DXGI 1.4 */
+    if (!adapter3_)
+    {
+        ComPtr<IDXGIDevice> dxgiDevice;
+        ComPtr<IDXGIAdapter> dxgiAdapter;
+        if (FAILED(device_.As(&dxgiDevice)) || FAILED(dxgiDevice->GetAdapter(dxgiAdapter.ReleaseAndGetAddressOf())) || FAILED(dxgiAdapter.As(&adapter3_)))
+            return 0;
+    }
+
+    /* Report local (video memory) and non-local (system memory) segment groups as separate heaps */
+    const DXGI_MEMORY_SEGMENT_GROUP segmentGroups[] = { DXGI_MEMORY_SEGMENT_GROUP_LOCAL, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL };
+    const std::uint32_t numHeaps = static_cast<std::uint32_t>(sizeof(segmentGroups) / sizeof(segmentGroups[0]));
+
+    if (outHeapInfos != nullptr && maxHeapInfos > 0)
+    {
+        DXGI_ADAPTER_DESC adapterDesc;
+        adapter3_->GetDesc(&adapterDesc);
+
+        const std::uint64_t heapSizes[] =
+        {
+            static_cast<std::uint64_t>(adapterDesc.DedicatedVideoMemory),
+            static_cast<std::uint64_t>(adapterDesc.SharedSystemMemory),
+        };
+
+        for_range(i, std::min(numHeaps, maxHeapInfos))
+        {
+            DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo = {};
+            adapter3_->QueryVideoMemoryInfo(0, segmentGroups[i], &memoryInfo);
+
+            MemoryHeapInfo& heapInfo = outHeapInfos[i];
+            heapInfo.flags  = (segmentGroups[i] == DXGI_MEMORY_SEGMENT_GROUP_LOCAL ? MemoryHeapFlags::DeviceLocal : 0);
+            heapInfo.size   = heapSizes[i];
+            heapInfo.usage  = memoryInfo.CurrentUsage;
+            heapInfo.budget = memoryInfo.Budget;
+        }
+    }
+
+    return numHeaps;
+
+    #else // LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+
+    /* IDXGIAdapter3::QueryVideoMemoryInfo is not available without DXGI 1.4 */
+    return 0;
+
+    #endif // /LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+}
+
+std::uint32_t D3D11RenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    return CopyAdapterInfos(DXGetAdapterInfos(factory_.Get(), videoAdatperInfo_.luid), outAdapters, maxAdapters);
+}
+
 void D3D11RenderSystem::CreateFactory()
 {
     /* Create DXGI factory */
@@ -646,9 +792,22 @@ void D3D11RenderSystem::CreateFactory()
     #endif
 }
 
-void D3D11RenderSystem::QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper)
+void D3D11RenderSystem::QueryVideoAdapters(const RenderSystemDescriptor& renderSystemDesc, ComPtr<IDXGIAdapter>& outPreferredAdatper)
 {
-    videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), flags, outPreferredAdatper.ReleaseAndGetAddressOf());
+    /* Only enumerate all adapters if one is selected by its LUID */
+    const int adapterIndex = SelectAdapterIndex(
+        renderSystemDesc,
+        (IsAdapterSelectedByID(renderSystemDesc) ? DXGetAdapterInfos(factory_.Get()) : std::vector<AdapterInfo>{})
+    );
+
+    if (adapterIndex >= 0)
+    {
+        /* Pick video adapter by its index and ignore preferred vendor flags */
+        if (!DXGetVideoAdapterInfoByIndex(factory_.Get(), static_cast<UINT>(adapterIndex), videoAdatperInfo_, outPreferredAdatper.ReleaseAndGetAddressOf()))
+            LLGL_TRAP("video adapter index %d out of range", adapterIndex);
+    }
+    else
+        videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), renderSystemDesc.flags, outPreferredAdatper.ReleaseAndGetAddressOf());
 }
 
 HRESULT D3D11RenderSystem::CreateDevice(IDXGIAdapter* adapter, bool isDebugDevice, bool isSoftwareDevice)
@@ -757,7 +916,7 @@ HRESULT D3D11RenderSystem::QueryDXInterfacesFromNativeHandle(const Direct3D11::R
     hr = adapter->GetDesc(&dxgiAdapterDesc);
     DXThrowIfFailed(hr, "failed to get descriptor from DXGI adapter");
 
-    DXConvertVideoAdapterInfo(adapter.Get(), dxgiAdapterDesc, videoAdatperInfo_);
+    DXConvertVideoAdapterInfo(dxgiAdapterDesc, videoAdatperInfo_);
 
     /* Get DXGI factory */
     hr = adapter->GetParent(IID_PPV_ARGS(&factory_));
@@ -874,6 +1033,14 @@ static std::vector<Format> GetDefaultSupportedDXTextureFormats(D3D_FEATURE_LEVEL
         );
     }
 
+    if (featureLevel >= D3D_FEATURE_LEVEL_11_0)
+    {
+        formats.insert(
+            formats.end(),
+            { Format::BC6HUFloat, Format::BC6HSFloat, Format::BC7UNorm, Format::BC7UNorm_sRGB }
+        );
+    }
+
     return formats;
 }
 
@@ -946,6 +1113,23 @@ void D3D11RenderSystem::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.features.hasLogicOp                        = (featureLevel >= D3D_FEATURE_LEVEL_11_1);
     caps.features.hasPipelineStatistics             = true;
     caps.features.hasRenderCondition                = true;
+    caps.features.hasTimestampQueries               = false;
+    caps.features.hasQueryResolve                   = false;
+    caps.features.hasBindlessResourceHeaps          = false;
+    caps.features.hasIndirectCountDrawing           = false;
+    caps.features.hasMeshShaders                    = false;
+    caps.features.hasTileShaders                    = false;
+    caps.features.hasFramebufferFetch               = false;
+    caps.features.hasVariableRateShading            = false;
+    caps.features.hasIndirectStateChanges           = false;
+    caps.features.hasTransientBuffers               = false;
+    caps.features.hasPersistentMapping              = false;
+    caps.features.hasSparseTextures                 = false;
+    caps.features.hasPlacementHeaps                 = false;
+    caps.features.hasSharedResources                = false;
+    caps.features.hasConcurrentResourceCreation     = false;
+    caps.features.hasRayTracing                     = false;
+    caps.features.hasRayQuery                       = false;
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = 1.0f;
@@ -964,6 +1148,7 @@ void D3D11RenderSystem::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.limits.maxComputeShaderWorkGroupSize[0]    = 1024u;
     caps.limits.maxComputeShaderWorkGroupSize[1]    = 1024u;
     caps.limits.maxComputeShaderWorkGroupSize[2]    = 1024u;
+    caps.limits.maxComputeShaderSharedMemorySize    = (featureLevel >= D3D_FEATURE_LEVEL_11_0 ? D3D11_CS_TGSM_REGISTER_COUNT : D3D11_CS_4_X_TGSM_REGISTER_COUNT) * 4u;
     caps.limits.maxViewports                        = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
     caps.limits.maxViewportSize[0]                  = D3D11_VIEWPORT_BOUNDS_MAX;
     caps.limits.maxViewportSize[1]                  = D3D11_VIEWPORT_BOUNDS_MAX;
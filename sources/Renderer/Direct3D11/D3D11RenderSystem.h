@@ -21,6 +21,7 @@
 
 #include "RenderState/D3D11PipelineState.h"
 #include "RenderState/D3D11StateManager.h"
+#include "RenderState/D3D11StatePool.h"
 #include "RenderState/D3D11QueryHeap.h"
 #include "RenderState/D3D11Fence.h"
 #include "RenderState/D3D11ResourceHeap.h"
@@ -37,6 +38,7 @@
 #include "../ContainerTypes.h"
 #include "../DXCommon/ComPtr.h"
 #include "../ProxyPipelineCache.h"
+#include "../ShaderCache.h"
 
 #include <dxgi.h>
 
@@ -107,6 +109,12 @@ class D3D11RenderSystem final : public RenderSystem
             return tearingSupported_;
         }
 
+        // Returns the persistent shader cache or null if it is disabled. See RenderSystemDescriptor::shaderCacheFilename.
+        inline ShaderCache* GetShaderCache()
+        {
+            return (shaderCache_.IsOpen() ? &shaderCache_ : nullptr);
+        }
+
     private:
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
@@ -114,7 +122,7 @@ class D3D11RenderSystem final : public RenderSystem
     private:
 
         void CreateFactory();
-        void QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper);
+        void QueryVideoAdapters(const RenderSystemDescriptor& renderSystemDesc, ComPtr<IDXGIAdapter>& outPreferredAdatper);
         HRESULT CreateDevice(IDXGIAdapter* adapter, bool isDebugDevice = false, bool isSoftwareDevice = false);
         HRESULT CreateDeviceWithFlags(IDXGIAdapter* adapter, const ArrayView<D3D_FEATURE_LEVEL>& featureLevels, bool isSoftwareDevice = false, UINT flags = 0);
         HRESULT CreateDeviceWithFlagsAndDriverType(IDXGIAdapter* adapter, D3D_DRIVER_TYPE driverType, const ArrayView<D3D_FEATURE_LEVEL>& featureLevels, UINT flags);
@@ -170,6 +178,10 @@ class D3D11RenderSystem final : public RenderSystem
         ComPtr<IDXGIFactory2>                   factory2_;
         #endif
 
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+        ComPtr<IDXGIAdapter3>                   adapter3_;
+        #endif
+
         ComPtr<ID3D11Device>                    device_;
 
         #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
@@ -188,9 +200,11 @@ class D3D11RenderSystem final : public RenderSystem
 
         D3D_FEATURE_LEVEL                       featureLevel_           = D3D_FEATURE_LEVEL_9_1;
         bool                                    tearingSupported_       = false;
+        ShaderCache                             shaderCache_;
 
         std::shared_ptr<D3D11StateManager>      stateMngr_;
         std::vector<D3D11StateManager*>         deferredStateMngrRefs_;
+        D3D11StatePool                          statePool_;
 
         /* ----- Hardware object containers ----- */
 
@@ -11,6 +11,7 @@
 #include "../DXCommon/DXTypes.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
+#include <LLGL/Backend/Direct3D11/NativeHandle.h>
 #include <LLGL/Log.h>
 
 
@@ -30,6 +31,8 @@ D3D11SwapChain::D3D11SwapChain(
     renderSystem_        { renderSystem                                               },
     depthStencilFormat_  { DXPickDepthStencilFormat(desc.depthBits, desc.stencilBits) },
     renderTargetHandles_ { 1u, (depthStencilFormat_ != DXGI_FORMAT_UNKNOWN)           },
+    presentMode_         { desc.presentMode                                           },
+    requestedColorSpace_ { desc.colorSpace                                            },
     tearingSupported_    { renderSystem.IsTearingSupported()                          },
     colorBufferLocator_  { ResourceType::Texture, BindFlags::ColorAttachment          },
     depthBufferLocator_  { ResourceType::Texture, BindFlags::DepthStencilAttachment   }
@@ -38,7 +41,9 @@ D3D11SwapChain::D3D11SwapChain(
     SetOrCreateSurface(surface, SwapChain::BuildDefaultSurfaceTitle(renderSystem.GetRendererInfo()), desc);
 
     /* Create D3D objects */
+    maxFrameLatency_ = std::min(desc.maxFramesInFlight, 16u); // DXGI supports a maximum frame latency of 16
     CreateSwapChain(factory, GetResolution(), desc.samples, desc.swapBuffers);
+    SetMaximumFrameLatency();
     CreateResolutionDependentResources();
 
     if (desc.debugName != nullptr)
@@ -49,6 +54,12 @@ D3D11SwapChain::D3D11SwapChain(
         ShowSurface();
 }
 
+D3D11SwapChain::~D3D11SwapChain()
+{
+    if (frameLatencyWaitable_ != nullptr)
+        CloseHandle(frameLatencyWaitable_);
+}
+
 void D3D11SwapChain::SetDebugName(const char* name)
 {
     if (name != nullptr)
@@ -86,8 +97,10 @@ bool D3D11SwapChain::IsPresentable() const
 
 void D3D11SwapChain::Present()
 {
-    const bool tearingEnabled   = (tearingSupported_ && windowedMode_ && swapChainInterval_ == 0);
-    const UINT presentFlags     = (tearingEnabled ? DXGI_PRESENT_ALLOW_TEARING : 0u);
+    UINT syncInterval = 0, presentFlags = 0;
+    DXGetPresentParameters(presentMode_, swapChainInterval_, (tearingSupported_ && windowedMode_), syncInterval, presentFlags);
+
+    BeginFrameStatisticsStall();
 
     HRESULT hr = S_OK;
     if (isPresentationDirty_)
@@ -97,9 +110,45 @@ void D3D11SwapChain::Present()
         hr = swapChain_->Present(0, presentFlags);
     }
     else
-        hr = swapChain_->Present(swapChainInterval_, presentFlags);
+        hr = swapChain_->Present(syncInterval, presentFlags);
 
     DXThrowIfFailed(hr, "failed to present DXGI swap chain");
+
+    EndFrameStatisticsStall(true);
+
+    /* Record display time of the most recently shown frame, which lags behind by a few presentations */
+    if (HasFrameStatistics())
+    {
+        UINT64 presentCount = 0, displayTime = 0;
+        if (DXGetFrameDisplayTime(swapChain_.Get(), presentCount, displayTime))
+            RecordFrameDisplayTime(presentCount, displayTime);
+    }
+}
+
+bool D3D11SwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    /* Wait until DXGI has less than the maximum frame latency queued up */
+    if (frameLatencyWaitable_ != nullptr)
+    {
+        BeginFrameStatisticsStall();
+        const DWORD result = WaitForSingleObjectEx(frameLatencyWaitable_, DXNanosecsToMillisecs(timeout), FALSE);
+        EndFrameStatisticsStall(false);
+        return (result == WAIT_OBJECT_0);
+    }
+    else
+        return true;
+}
+
+bool D3D11SwapChain::GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    /* Multi-sampled back buffers are resolved into the primary color buffer at the end of each render pass */
+    if (auto* nativeHandleD3D = GetTypedNativeHandle<Direct3D11::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        nativeHandleD3D->deviceChild = colorBuffer_.Get();
+        nativeHandleD3D->deviceChild->AddRef();
+        return true;
+    }
+    return false;
 }
 
 std::uint32_t D3D11SwapChain::GetCurrentSwapIndex() const
@@ -117,6 +166,11 @@ std::uint32_t D3D11SwapChain::GetSamples() const
     return swapChainSampleDesc_.Count;
 }
 
+ColorSpace D3D11SwapChain::GetColorSpace() const
+{
+    return colorSpace_;
+}
+
 Format D3D11SwapChain::GetColorFormat() const
 {
     return DXTypes::Unmap(colorFormat_);
@@ -296,6 +350,10 @@ bool D3D11SwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
     /* Update windowed mode */
     windowedMode_ = !DXGetFullscreenState(swapChain_.Get());
 
+    /* Re-apply color space, since the output might have changed its HDR support */
+    if (swapEffectFlip_)
+        colorSpace_ = DXSetSwapChainColorSpace(swapChain_.Get(), requestedColorSpace_);
+
     /* Recreate back buffer and reset default render target */
     CreateResolutionDependentResources();
 
@@ -329,8 +387,8 @@ void D3D11SwapChain::CreateSwapChain(IDXGIFactory* factory, const Extent2D& reso
 {
     HRESULT hr = S_OK;
 
-    /* Pick and store color format */
-    colorFormat_ = DXGI_FORMAT_R8G8B8A8_UNORM;//DXGI_FORMAT_B8G8R8A8_UNORM
+    /* Pick and store color format for the requested color space */
+    colorFormat_ = DXPickSwapChainColorFormat(requestedColorSpace_);
 
     /* Create swap chain for window handle */
     NativeHandle wndHandle = {};
@@ -365,6 +423,10 @@ void D3D11SwapChain::CreateSwapChain(IDXGIFactory* factory, const Extent2D& reso
 
     /* Cache windoed mode for tearing support */
     windowedMode_ = !DXGetFullscreenState(swapChain_.Get());
+
+    /* Apply color space; Only flip-model swap-chains can present in HDR color spaces */
+    if (swapEffectFlip_)
+        colorSpace_ = DXSetSwapChainColorSpace(swapChain_.Get(), requestedColorSpace_);
 }
 
 #ifdef LLGL_OS_WIN32
@@ -374,6 +436,13 @@ void D3D11SwapChain::CreateDXGISwapChain(IDXGIFactory* factory, const NativeHand
     /* Clamp buffer count between 1 and max buffers */
     swapBuffers = std::max(1u, std::min<std::uint32_t>(swapBuffers, DXGI_MAX_SWAP_CHAIN_BUFFERS));
 
+    /* Blt-model swap-chains can't present HDR color spaces, so fall back to the standard color format */
+    if (colorFormat_ != DXGI_FORMAT_R8G8B8A8_UNORM)
+    {
+        colorFormat_            = DXGI_FORMAT_R8G8B8A8_UNORM;
+        swapChainSampleDesc_    = D3D11RenderSystem::FindSuitableSampleDesc(device_.Get(), colorFormat_, samples);
+    }
+
     const DXGI_RATIONAL refreshRate{ GetPrimaryDisplayRefreshRate(), 1 };
 
     DXGI_SWAP_CHAIN_DESC swapChainDesc = {};
@@ -417,6 +486,8 @@ void D3D11SwapChain::CreateDXGISwapChain1(IDXGIFactory2* factory2, const NativeH
         swapChainDesc.Scaling               = DXGI_SCALING_NONE; // Default is DXGI_SCALING_STRETCH, but other backends don't stretch on resize either
         swapChainDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_DISCARD; // FLIP effect requires BufferCount >= 2 && SampleDesc.Count == 1
         swapChainDesc.Flags                 = (tearingSupported_ ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0u);
+        if (maxFrameLatency_ > 0)
+            swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
     }
 
     ComPtr<IDXGISwapChain1> swapChain;
@@ -433,6 +504,32 @@ void D3D11SwapChain::CreateDXGISwapChain1(IDXGIFactory2* factory2, const NativeH
 
 #endif
 
+void D3D11SwapChain::SetMaximumFrameLatency()
+{
+    if (maxFrameLatency_ == 0)
+        return;
+
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3 || defined LLGL_OS_UWP
+    if (swapEffectFlip_)
+    {
+        /* Swap-chains with a frame latency waitable object must set their latency with IDXGISwapChain2 */
+        ComPtr<IDXGISwapChain2> swapChain2;
+        if (SUCCEEDED(swapChain_.As(&swapChain2)))
+        {
+            HRESULT hr = swapChain2->SetMaximumFrameLatency(maxFrameLatency_);
+            DXThrowIfFailed(hr, "failed to set maximum frame latency of DXGI swap chain");
+            frameLatencyWaitable_ = swapChain2->GetFrameLatencyWaitableObject();
+            return;
+        }
+    }
+    #endif
+
+    /* Limit frame latency for the entire device if the swap-chain does not provide a waitable object */
+    ComPtr<IDXGIDevice1> device1;
+    if (SUCCEEDED(device_.As(&device1)))
+        device1->SetMaximumFrameLatency(maxFrameLatency_);
+}
+
 void D3D11SwapChain::CreateResolutionDependentResources()
 {
     HRESULT hr = 0;
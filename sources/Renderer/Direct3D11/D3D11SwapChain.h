@@ -16,6 +16,7 @@
 
 #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3 || defined LLGL_OS_UWP
 #   include <dxgi1_2.h>
+#   include <dxgi1_3.h>
 #endif
 
 
@@ -43,8 +44,16 @@ class D3D11SwapChain final : public SwapChain
             const std::shared_ptr<Surface>&     surface
         );
 
+        ~D3D11SwapChain();
+
         void SetDebugName(const char* name) override;
 
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
+        bool GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        ColorSpace GetColorSpace() const override;
+
     public:
 
         // Copyies a subresource region from the backbuffer (color or depth-stencil) into the destination resource.
@@ -81,6 +90,8 @@ class D3D11SwapChain final : public SwapChain
         void CreateDXGISwapChain1(IDXGIFactory2* factory2, const NativeHandle& wndHandle, const Extent2D& resolution, std::uint32_t swapBuffers);
         #endif
 
+        void SetMaximumFrameLatency();
+
         void CreateResolutionDependentResources();
 
         void StoreDebugNames(std::string (&debugNames)[5]);
@@ -93,6 +104,8 @@ class D3D11SwapChain final : public SwapChain
 
         ComPtr<IDXGISwapChain>          swapChain_;
         UINT                            swapChainInterval_      = 0;
+        UINT                            maxFrameLatency_        = 0; // 0 to keep the DXGI default
+        HANDLE                          frameLatencyWaitable_   = nullptr;
         DXGI_SAMPLE_DESC                swapChainSampleDesc_    = { 1, 0 };
         DXGI_FORMAT                     colorFormat_            = DXGI_FORMAT_UNKNOWN;
         DXGI_FORMAT                     depthStencilFormat_     = DXGI_FORMAT_UNKNOWN;
@@ -106,6 +119,9 @@ class D3D11SwapChain final : public SwapChain
 
         bool                            hasDebugName_           = false;
         bool                            swapEffectFlip_         = false; // DXGI swap effect is DXGI_SWAP_EFFECT_FLIP_*
+        PresentMode                     presentMode_            = PresentMode::Default;
+        ColorSpace                      requestedColorSpace_    = ColorSpace::SRGB;
+        ColorSpace                      colorSpace_             = ColorSpace::SRGB; // Color space that is in effect
         bool                            tearingSupported_       = false;
         bool                            windowedMode_           = false;
         bool                            isPresentationDirty_    = false; // Has the back buffer been resized before it was presented again?
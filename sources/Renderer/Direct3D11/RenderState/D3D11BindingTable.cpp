@@ -91,13 +91,13 @@ void D3D11BindingTable::SetStreamOutputBuffers(
         for_range(i, count)
             PutStreamOutputBuffer(locators[i], i);
         for_subrange(i, count, soCount_)
-            RemoveWholeResourceOutput(so_.locators, D3D11BindingLocator::D3DOutput_SO, i);
+            RemoveWholeResourceOutput(so_, D3D11BindingLocator::D3DOutput_SO, i);
         soCount_ = count;
     }
     else if (soCount_ > 0)
     {
         for_range(i, soCount_)
-            RemoveWholeResourceOutput(so_.locators, D3D11BindingLocator::D3DOutput_SO, i);
+            RemoveWholeResourceOutput(so_, D3D11BindingLocator::D3DOutput_SO, i);
         soCount_ = 0;
     }
     context_->SOSetTargets(count, buffers, offsets);
@@ -299,16 +299,84 @@ static T* const* GetNullPointerArray()
     return reinterpret_cast<T* const*>(g_nullArray);
 }
 
-void D3D11BindingTable::InsertInput(D3D11BindingLocator** container, D3D11BindingLocator::D3DInputs input, UINT slot, D3D11BindingLocator* locator)
+// Returns the index of the least significant bit that is set in the specified non-zero bitmask.
+static inline UINT FindFirstSlotBit(std::uint64_t bits)
 {
-    if (container[slot] != locator)
+    #ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward64(&index, bits);
+    return static_cast<UINT>(index);
+    #else
+    return static_cast<UINT>(__builtin_ctzll(bits));
+    #endif
+}
+
+// Calls the specified function for each occupied slot of the container within the half-open range [begin, end).
+// Only the occupancy bitmask is scanned, so empty slots are skipped 64 at a time.
+template <typename TContainer, typename TFunc>
+static void ForEachOccupiedSlot(const TContainer& container, UINT begin, UINT end, const TFunc& func)
+{
+    end = std::min<UINT>(end, container.size());
+    for (UINT wordBegin = (begin / 64u) * 64u; wordBegin < end; wordBegin += 64u)
+    {
+        std::uint64_t bits = container.occupied.words[wordBegin / 64u];
+
+        /* Mask out the slots outside of the range */
+        if (begin > wordBegin)
+            bits &= (~0ull << (begin - wordBegin));
+        if (end < wordBegin + 64u)
+            bits &= ((1ull << (end - wordBegin)) - 1ull);
+
+        while (bits != 0)
+        {
+            func(wordBegin + FindFirstSlotBit(bits));
+            bits &= (bits - 1ull);
+        }
+    }
+}
+
+// Returns true if the specified locator is bound to any slot of the container within the half-open range [begin, end).
+template <typename TContainer>
+static bool HasLocatorInRange(const TContainer& container, UINT begin, UINT end, const D3D11BindingLocator* locator)
+{
+    bool found = false;
+    ForEachOccupiedSlot(
+        container, begin, end,
+        [&container, locator, &found](UINT slot)
+        {
+            if (container.locators[slot] == locator)
+                found = true;
+        }
+    );
+    return found;
+}
+
+template <typename TContainer>
+void D3D11BindingTable::ClearBindingLocators(TContainer& container)
+{
+    ForEachOccupiedSlot(
+        container, 0, container.size(),
+        [&container](UINT slot)
+        {
+            container.locators[slot]->ClearInput();
+            container.locators[slot]->ClearOutput();
+            container.locators[slot] = nullptr;
+        }
+    );
+    container.occupied.clear();
+}
+
+template <typename TContainer>
+void D3D11BindingTable::InsertInput(TContainer& container, D3D11BindingLocator::D3DInputs input, UINT slot, D3D11BindingLocator* locator)
+{
+    if (container.locators[slot] != locator)
     {
         /* Try to unset previous locator */
-        if (container[slot] != nullptr)
-            container[slot]->TryRemoveInputAt(input, slot);
+        if (container.locators[slot] != nullptr)
+            container.locators[slot]->TryRemoveInputAt(input, slot);
 
         /* Put locator into table */
-        container[slot] = locator;
+        container.put(slot, locator);
 
         /* Set new locator */
         if (locator != nullptr)
@@ -316,40 +384,43 @@ void D3D11BindingTable::InsertInput(D3D11BindingLocator** container, D3D11Bindin
     }
 }
 
-bool D3D11BindingTable::RemoveSubresourceInput(D3D11BindingLocator** container, D3D11BindingLocator::D3DInputs input, UINT slot)
+template <typename TContainer>
+bool D3D11BindingTable::RemoveSubresourceInput(TContainer& container, D3D11BindingLocator::D3DInputs input, UINT slot)
 {
     /* Try to unset previous locator */
     bool clearedInputBitmask = false;
-    if (container[slot] != nullptr)
+    if (container.locators[slot] != nullptr)
     {
-        clearedInputBitmask = container[slot]->TryRemoveInputAt(input, slot);
-        container[slot] = nullptr;
+        clearedInputBitmask = container.locators[slot]->TryRemoveInputAt(input, slot);
+        container.reset(slot);
     }
     return clearedInputBitmask;
 }
 
-bool D3D11BindingTable::RemoveWholeResourceInput(D3D11BindingLocator** container, D3D11BindingLocator::D3DInputs input, UINT slot)
+template <typename TContainer>
+bool D3D11BindingTable::RemoveWholeResourceInput(TContainer& container, D3D11BindingLocator::D3DInputs input, UINT slot)
 {
     /* Remove input of type that can only be bound for the whole resource (such as vertex-buffer or index-buffer) */
     bool clearedInputBitmask = false;
-    if (container[slot] != nullptr)
+    if (container.locators[slot] != nullptr)
     {
-        clearedInputBitmask = container[slot]->RemoveInput(input);
-        container[slot] = nullptr;
+        clearedInputBitmask = container.locators[slot]->RemoveInput(input);
+        container.reset(slot);
     }
     return clearedInputBitmask;
 }
 
-void D3D11BindingTable::InsertOutput(D3D11BindingLocator** container, D3D11BindingLocator::D3DOutputs output, UINT slot, D3D11BindingLocator* locator)
+template <typename TContainer>
+void D3D11BindingTable::InsertOutput(TContainer& container, D3D11BindingLocator::D3DOutputs output, UINT slot, D3D11BindingLocator* locator)
 {
-    if (container[slot] != locator)
+    if (container.locators[slot] != locator)
     {
         /* Try to unset previous locator */
-        if (container[slot] != nullptr)
-            container[slot]->TryRemoveOutputAt(output, slot);
+        if (container.locators[slot] != nullptr)
+            container.locators[slot]->TryRemoveOutputAt(output, slot);
 
         /* Put locator into table */
-        container[slot] = locator;
+        container.put(slot, locator);
 
         /* Set new locator */
         if (locator != nullptr)
@@ -357,88 +428,90 @@ void D3D11BindingTable::InsertOutput(D3D11BindingLocator** container, D3D11Bindi
     }
 }
 
-bool D3D11BindingTable::RemoveSubresourceOutput(D3D11BindingLocator** container, D3D11BindingLocator::D3DOutputs output, UINT slot)
+template <typename TContainer>
+bool D3D11BindingTable::RemoveSubresourceOutput(TContainer& container, D3D11BindingLocator::D3DOutputs output, UINT slot)
 {
     /* Try to unset previous locator */
     bool clearedOutputBitmask = false;
-    if (container[slot] != nullptr)
+    if (container.locators[slot] != nullptr)
     {
-        clearedOutputBitmask = container[slot]->TryRemoveOutputAt(output, slot);
-        container[slot] = nullptr;
+        clearedOutputBitmask = container.locators[slot]->TryRemoveOutputAt(output, slot);
+        container.reset(slot);
     }
     return clearedOutputBitmask;
 }
 
-void D3D11BindingTable::RemoveWholeResourceOutput(D3D11BindingLocator** container, D3D11BindingLocator::D3DOutputs output, UINT slot)
+template <typename TContainer>
+void D3D11BindingTable::RemoveWholeResourceOutput(TContainer& container, D3D11BindingLocator::D3DOutputs output, UINT slot)
 {
     /* Remove output of type that can only be bound for the whole resource (such as stream-output) */
-    if (container[slot] != nullptr)
+    if (container.locators[slot] != nullptr)
     {
-        container[slot]->RemoveOutput(output);
-        container[slot] = nullptr;
+        container.locators[slot]->RemoveOutput(output);
+        container.reset(slot);
     }
 }
 
 void D3D11BindingTable::PutVertexBuffer(D3D11BindingLocator* locator, UINT slot)
 {
-    InsertInput(vb_.locators, D3D11BindingLocator::D3DInput_VB, slot, locator);
+    InsertInput(vb_, D3D11BindingLocator::D3DInput_VB, slot, locator);
 }
 
 void D3D11BindingTable::PutIndexBuffer(D3D11BindingLocator* locator)
 {
-    InsertInput(ib_.locators, D3D11BindingLocator::D3DInput_IB, 0, locator);
+    InsertInput(ib_, D3D11BindingLocator::D3DInput_IB, 0, locator);
 }
 
 void D3D11BindingTable::PutShaderResourceViewVS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertInput(srvVS_.locators, D3D11BindingLocator::D3DInput_SRV_VS, slot, locator);
+    InsertInput(srvVS_, D3D11BindingLocator::D3DInput_SRV_VS, slot, locator);
     srvVS_.subresourceRanges[slot] = subresourceRange;
 }
 
 void D3D11BindingTable::PutShaderResourceViewHS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertInput(srvHS_.locators, D3D11BindingLocator::D3DInput_SRV_HS, slot, locator);
+    InsertInput(srvHS_, D3D11BindingLocator::D3DInput_SRV_HS, slot, locator);
     srvHS_.subresourceRanges[slot] = subresourceRange;
 }
 
 void D3D11BindingTable::PutShaderResourceViewDS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertInput(srvDS_.locators, D3D11BindingLocator::D3DInput_SRV_DS, slot, locator);
+    InsertInput(srvDS_, D3D11BindingLocator::D3DInput_SRV_DS, slot, locator);
     srvDS_.subresourceRanges[slot] = subresourceRange;
 }
 
 void D3D11BindingTable::PutShaderResourceViewGS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertInput(srvGS_.locators, D3D11BindingLocator::D3DInput_SRV_GS, slot, locator);
+    InsertInput(srvGS_, D3D11BindingLocator::D3DInput_SRV_GS, slot, locator);
     srvGS_.subresourceRanges[slot] = subresourceRange;
 }
 
 void D3D11BindingTable::PutShaderResourceViewPS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertInput(srvPS_.locators, D3D11BindingLocator::D3DInput_SRV_PS, slot, locator);
+    InsertInput(srvPS_, D3D11BindingLocator::D3DInput_SRV_PS, slot, locator);
     srvPS_.subresourceRanges[slot] = subresourceRange;
 }
 
 void D3D11BindingTable::PutShaderResourceViewCS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertInput(srvCS_.locators, D3D11BindingLocator::D3DInput_SRV_CS, slot, locator);
+    InsertInput(srvCS_, D3D11BindingLocator::D3DInput_SRV_CS, slot, locator);
     srvCS_.subresourceRanges[slot] = subresourceRange;
 }
 
 void D3D11BindingTable::PutStreamOutputBuffer(D3D11BindingLocator* locator, UINT slot)
 {
-    InsertOutput(so_.locators, D3D11BindingLocator::D3DOutput_SO, slot, locator);
+    InsertOutput(so_, D3D11BindingLocator::D3DOutput_SO, slot, locator);
 }
 
 void D3D11BindingTable::PutUnorderedAccessViewPS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertOutput(uavPS_.locators, D3D11BindingLocator::D3DOutput_UAV_PS, slot, locator);
+    InsertOutput(uavPS_, D3D11BindingLocator::D3DOutput_UAV_PS, slot, locator);
     uavPS_.subresourceRanges[slot] = subresourceRange;
 }
 
 void D3D11BindingTable::PutUnorderedAccessViewCS(D3D11BindingLocator* locator, const D3D11SubresourceRange& subresourceRange, UINT slot)
 {
-    InsertOutput(uavCS_.locators, D3D11BindingLocator::D3DOutput_UAV_CS, slot, locator);
+    InsertOutput(uavCS_, D3D11BindingLocator::D3DOutput_UAV_CS, slot, locator);
     uavCS_.subresourceRanges[slot] = subresourceRange;
 }
 
@@ -482,13 +555,13 @@ void D3D11BindingTable::EvictSingleOutputBinding(D3D11BindingLocator* locator)
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_PS)) != 0 && HasLocatorAt(uavPS_, slot, locator))
     {
         EvictSingleUnorderedAccessViewPS(slot);
-        RemoveWholeResourceOutput(uavPS_.locators, D3D11BindingLocator::D3DOutput_UAV_PS, slot);
+        RemoveWholeResourceOutput(uavPS_, D3D11BindingLocator::D3DOutput_UAV_PS, slot);
     }
 
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_CS)) != 0 && HasLocatorAt(uavCS_, slot, locator))
     {
         EvictSingleUnorderedAccessViewCS(slot);
-        RemoveWholeResourceOutput(uavCS_.locators, D3D11BindingLocator::D3DOutput_UAV_CS, slot);
+        RemoveWholeResourceOutput(uavCS_, D3D11BindingLocator::D3DOutput_UAV_CS, slot);
     }
 }
 
@@ -506,14 +579,14 @@ void D3D11BindingTable::EvictSingleSubresourceOutputBinding(D3D11BindingLocator*
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_PS)) != 0 && HasLocatorAndRangesOverlapAt(uavPS_, slot, locator, subresourceRange))
     {
         EvictSingleUnorderedAccessViewPS(slot);
-        if (RemoveSubresourceOutput(uavPS_.locators, D3D11BindingLocator::D3DOutput_UAV_PS, slot))
+        if (RemoveSubresourceOutput(uavPS_, D3D11BindingLocator::D3DOutput_UAV_PS, slot))
             return;
     }
 
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_CS)) != 0 && HasLocatorAndRangesOverlapAt(uavCS_, slot, locator, subresourceRange))
     {
         EvictSingleUnorderedAccessViewCS(slot);
-        if (RemoveSubresourceOutput(uavCS_.locators, D3D11BindingLocator::D3DOutput_UAV_CS, slot))
+        if (RemoveSubresourceOutput(uavCS_, D3D11BindingLocator::D3DOutput_UAV_CS, slot))
             return;
     }
 }
@@ -523,41 +596,37 @@ void D3D11BindingTable::EvictMultipleOutputBindings(D3D11BindingLocator* locator
     /* Stream-output buffers cannot have subresource views, so always unbind the entire resource */
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_SO)) != 0)
     {
-        for_subrange(slot, locator->outRangeBegin, std::min<UINT>(locator->outRangeEnd, so_.size()))
+        if (HasLocatorInRange(so_, locator->outRangeBegin, locator->outRangeEnd, locator))
         {
-            if (so_.locators[slot] == locator)
-            {
-                /* SO targets must be set/unset all at once */
-                EvictAllStreamOutputTargets();
-                break;
-            }
+        /* SO targets must be set/unset all at once */
+        EvictAllStreamOutputTargets();
         }
     }
 
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_PS)) != 0)
     {
-        for_subrange(slot, locator->outRangeBegin, std::min<UINT>(locator->outRangeEnd, uavPS_.size()))
+        ForEachOccupiedSlot(uavPS_, locator->outRangeBegin, locator->outRangeEnd, [&](UINT slot)
         {
             if (uavPS_.locators[slot] == locator)
             {
                 EvictSingleUnorderedAccessViewPS(slot);
-                uavPS_.locators[slot] = nullptr;
+                uavPS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveOutput(D3D11BindingLocator::D3DOutput_UAV_PS))
             return;
     }
 
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_CS)) != 0)
     {
-        for_subrange(slot, locator->outRangeBegin, std::min<UINT>(locator->outRangeEnd, uavCS_.size()))
+        ForEachOccupiedSlot(uavCS_, locator->outRangeBegin, locator->outRangeEnd, [&](UINT slot)
         {
             if (uavCS_.locators[slot] == locator)
             {
                 EvictSingleUnorderedAccessViewCS(slot);
-                uavCS_.locators[slot] = nullptr;
+                uavCS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveOutput(D3D11BindingLocator::D3DOutput_UAV_CS))
             return;
     }
@@ -568,41 +637,37 @@ void D3D11BindingTable::EvictMultipleSubresourceOutputBindings(D3D11BindingLocat
     /* Stream-output buffers cannot have subresource views, so always unbind the entire resource */
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_SO)) != 0)
     {
-        for_subrange(slot, locator->outRangeBegin, std::min<UINT>(locator->outRangeEnd, so_.size()))
+        if (HasLocatorInRange(so_, locator->outRangeBegin, locator->outRangeEnd, locator))
         {
-            if (so_.locators[slot] == locator)
-            {
-                /* SO targets must be set/unset all at once */
-                EvictAllStreamOutputTargets();
-                break;
-            }
+        /* SO targets must be set/unset all at once */
+        EvictAllStreamOutputTargets();
         }
     }
 
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_PS)) != 0)
     {
-        for_subrange(slot, locator->outRangeBegin, std::min<UINT>(locator->outRangeEnd, uavPS_.size()))
+        ForEachOccupiedSlot(uavPS_, locator->outRangeBegin, locator->outRangeEnd, [&](UINT slot)
         {
             if (uavPS_.locators[slot] == locator && D3D11SubresourceRange::Overlap(uavPS_.subresourceRanges[slot], subresourceRange))
             {
                 EvictSingleUnorderedAccessViewPS(slot);
-                uavPS_.locators[slot] = nullptr;
+                uavPS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveOutput(D3D11BindingLocator::D3DOutput_UAV_PS))
             return;
     }
 
     if ((locator->outBitmask & (1u << D3D11BindingLocator::D3DOutput_UAV_CS)) != 0)
     {
-        for_subrange(slot, locator->outRangeBegin, std::min<UINT>(locator->outRangeEnd, uavCS_.size()))
+        ForEachOccupiedSlot(uavCS_, locator->outRangeBegin, locator->outRangeEnd, [&](UINT slot)
         {
             if (uavCS_.locators[slot] == locator && D3D11SubresourceRange::Overlap(uavCS_.subresourceRanges[slot], subresourceRange))
             {
                 EvictSingleUnorderedAccessViewCS(slot);
-                uavCS_.locators[slot] = nullptr;
+                uavCS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveOutput(D3D11BindingLocator::D3DOutput_UAV_CS))
             return;
     }
@@ -622,49 +687,49 @@ void D3D11BindingTable::EvictSingleInputBinding(D3D11BindingLocator* locator)
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_IB)) != 0 && HasLocatorAt(ib_, slot, locator))
     {
         context_->IASetIndexBuffer(nullptr, DXGI_FORMAT_R16_UINT, 0);
-        if (RemoveWholeResourceInput(ib_.locators, D3D11BindingLocator::D3DInput_IB, 0))
+        if (RemoveWholeResourceInput(ib_, D3D11BindingLocator::D3DInput_IB, 0))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_VS)) != 0 && HasLocatorAt(srvVS_, slot, locator))
     {
         context_->VSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvVS_.locators, D3D11BindingLocator::D3DInput_SRV_VS, slot))
+        if (RemoveSubresourceInput(srvVS_, D3D11BindingLocator::D3DInput_SRV_VS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_HS)) != 0 && HasLocatorAt(srvHS_, slot, locator))
     {
         context_->HSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvHS_.locators, D3D11BindingLocator::D3DInput_SRV_HS, slot))
+        if (RemoveSubresourceInput(srvHS_, D3D11BindingLocator::D3DInput_SRV_HS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_DS)) != 0 && HasLocatorAt(srvDS_, slot, locator))
     {
         context_->DSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvDS_.locators, D3D11BindingLocator::D3DInput_SRV_DS, slot))
+        if (RemoveSubresourceInput(srvDS_, D3D11BindingLocator::D3DInput_SRV_DS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_GS)) != 0 && HasLocatorAt(srvGS_, slot, locator))
     {
         context_->GSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvGS_.locators, D3D11BindingLocator::D3DInput_SRV_GS, slot))
+        if (RemoveSubresourceInput(srvGS_, D3D11BindingLocator::D3DInput_SRV_GS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_PS)) != 0 && HasLocatorAt(srvPS_, slot, locator))
     {
         context_->PSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvPS_.locators, D3D11BindingLocator::D3DInput_SRV_PS, slot))
+        if (RemoveSubresourceInput(srvPS_, D3D11BindingLocator::D3DInput_SRV_PS, slot))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_CS)) != 0 && HasLocatorAt(srvCS_, slot, locator))
     {
         context_->CSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvCS_.locators, D3D11BindingLocator::D3DInput_SRV_CS, slot))
+        if (RemoveSubresourceInput(srvCS_, D3D11BindingLocator::D3DInput_SRV_CS, slot))
             return;
     }
 }
@@ -685,14 +750,14 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_IB)) != 0 && HasLocatorAt(ib_, slot, locator))
     {
         context_->IASetIndexBuffer(nullptr, DXGI_FORMAT_R16_UINT, 0);
-        if (RemoveWholeResourceInput(ib_.locators, D3D11BindingLocator::D3DInput_IB, 0))
+        if (RemoveWholeResourceInput(ib_, D3D11BindingLocator::D3DInput_IB, 0))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_VS)) != 0 && HasLocatorAndRangesOverlapAt(srvVS_, slot, locator, subresourceRange))
     {
         context_->VSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvVS_.locators, D3D11BindingLocator::D3DInput_SRV_VS, slot))
+        if (RemoveSubresourceInput(srvVS_, D3D11BindingLocator::D3DInput_SRV_VS, slot))
             return;
     }
 
@@ -700,7 +765,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     {
         LLGL_ASSERT(slot < srvHS_.size());
         context_->HSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvHS_.locators, D3D11BindingLocator::D3DInput_SRV_HS, slot))
+        if (RemoveSubresourceInput(srvHS_, D3D11BindingLocator::D3DInput_SRV_HS, slot))
             return;
     }
 
@@ -708,7 +773,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     {
         LLGL_ASSERT(slot < srvDS_.size());
         context_->DSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvDS_.locators, D3D11BindingLocator::D3DInput_SRV_DS, slot))
+        if (RemoveSubresourceInput(srvDS_, D3D11BindingLocator::D3DInput_SRV_DS, slot))
             return;
     }
 
@@ -716,7 +781,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     {
         LLGL_ASSERT(slot < srvGS_.size());
         context_->GSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvGS_.locators, D3D11BindingLocator::D3DInput_SRV_GS, slot))
+        if (RemoveSubresourceInput(srvGS_, D3D11BindingLocator::D3DInput_SRV_GS, slot))
             return;
     }
 
@@ -724,7 +789,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     {
         LLGL_ASSERT(slot < srvPS_.size());
         context_->PSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvPS_.locators, D3D11BindingLocator::D3DInput_SRV_PS, slot))
+        if (RemoveSubresourceInput(srvPS_, D3D11BindingLocator::D3DInput_SRV_PS, slot))
             return;
     }
 
@@ -732,7 +797,7 @@ void D3D11BindingTable::EvictSingleSubresourceInputBinding(D3D11BindingLocator*
     {
         LLGL_ASSERT(slot < srvCS_.size());
         context_->CSSetShaderResources(slot, 1, nullSRVs);
-        if (RemoveSubresourceInput(srvCS_.locators, D3D11BindingLocator::D3DInput_SRV_CS, slot))
+        if (RemoveSubresourceInput(srvCS_, D3D11BindingLocator::D3DInput_SRV_CS, slot))
             return;
     }
 }
@@ -743,14 +808,10 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_VB)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, vb_.size()))
+        if (HasLocatorInRange(vb_, locator->inRangeBegin, locator->inRangeEnd, locator))
         {
-            if (vb_.locators[slot] == locator)
-            {
-                /* D3D11 allows to bind vertex buffer slots independently, but LLGL always sets/unsets vertex buffers all at once, so evict all at once */
-                EvictAllVertexBuffers();
-                break;
-            }
+        /* D3D11 allows to bind vertex buffer slots independently, but LLGL always sets/unsets vertex buffers all at once, so evict all at once */
+        EvictAllVertexBuffers();
         }
         if (locator->inBitmask == 0)
             return;
@@ -761,7 +822,7 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
         if (ib_.locators[0] == locator)
         {
             context_->IASetIndexBuffer(nullptr, DXGI_FORMAT_R16_UINT, 0);
-            ib_.locators[0] = nullptr;
+            ib_.reset(0);
         }
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_IB))
             return;
@@ -769,84 +830,84 @@ void D3D11BindingTable::EvictMultipleInputBindings(D3D11BindingLocator* locator)
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_VS)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvVS_.size()))
+        ForEachOccupiedSlot(srvVS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvVS_.locators[slot] == locator)
             {
                 context_->VSSetShaderResources(slot, 1, nullSRVs);
-                srvVS_.locators[slot] = nullptr;
+                srvVS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_VS))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_HS)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvHS_.size()))
+        ForEachOccupiedSlot(srvHS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvHS_.locators[slot] == locator)
             {
                 context_->HSSetShaderResources(slot, 1, nullSRVs);
-                srvHS_.locators[slot] = nullptr;
+                srvHS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_HS))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_DS)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvDS_.size()))
+        ForEachOccupiedSlot(srvDS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvDS_.locators[slot] == locator)
             {
                 context_->DSSetShaderResources(slot, 1, nullSRVs);
-                srvDS_.locators[slot] = nullptr;
+                srvDS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_DS))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_GS)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvGS_.size()))
+        ForEachOccupiedSlot(srvGS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvGS_.locators[slot] == locator)
             {
                 context_->GSSetShaderResources(slot, 1, nullSRVs);
-                srvGS_.locators[slot] = nullptr;
+                srvGS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_GS))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_PS)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvPS_.size()))
+        ForEachOccupiedSlot(srvPS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvPS_.locators[slot] == locator)
             {
                 context_->PSSetShaderResources(slot, 1, nullSRVs);
-                srvPS_.locators[slot] = nullptr;
+                srvPS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_PS))
             return;
     }
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_CS)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvCS_.size()))
+        ForEachOccupiedSlot(srvCS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvCS_.locators[slot] == locator)
             {
                 context_->CSSetShaderResources(slot, 1, nullSRVs);
-                srvCS_.locators[slot] = nullptr;
+                srvCS_.reset(slot);
             }
-        }
+        });
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_CS))
             return;
     }
@@ -858,14 +919,10 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
 
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_VB)) != 0)
     {
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, vb_.size()))
+        if (HasLocatorInRange(vb_, locator->inRangeBegin, locator->inRangeEnd, locator))
         {
-            if (vb_.locators[slot] == locator)
-            {
-                /* D3D11 allows to bind vertex buffer slots independently, but LLGL always sets/unsets vertex buffers all at once, so evict all at once */
-                EvictAllVertexBuffers();
-                break;
-            }
+        /* D3D11 allows to bind vertex buffer slots independently, but LLGL always sets/unsets vertex buffers all at once, so evict all at once */
+        EvictAllVertexBuffers();
         }
         if (locator->inBitmask == 0)
             return;
@@ -876,7 +933,7 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
         if (ib_.locators[0] == locator)
         {
             context_->IASetIndexBuffer(nullptr, DXGI_FORMAT_R16_UINT, 0);
-            ib_.locators[0] = nullptr;
+            ib_.reset(0);
         }
         if (locator->RemoveInput(D3D11BindingLocator::D3DInput_IB))
             return;
@@ -885,19 +942,19 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_VS)) != 0)
     {
         bool hasRemainingVSBindings = false;
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvVS_.size()))
+        ForEachOccupiedSlot(srvVS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvVS_.locators[slot] == locator)
             {
                 if (D3D11SubresourceRange::Overlap(srvVS_.subresourceRanges[slot], subresourceRange))
                 {
                     context_->VSSetShaderResources(slot, 1, nullSRVs);
-                    srvVS_.locators[slot] = nullptr;
+                    srvVS_.reset(slot);
                 }
                 else
                     hasRemainingVSBindings = true;
             }
-        }
+        });
         if (!hasRemainingVSBindings)
         {
             if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_VS))
@@ -908,19 +965,19 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_HS)) != 0)
     {
         bool hasRemainingHSBindings = false;
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvHS_.size()))
+        ForEachOccupiedSlot(srvHS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvHS_.locators[slot] == locator)
             {
                 if (D3D11SubresourceRange::Overlap(srvHS_.subresourceRanges[slot], subresourceRange))
                 {
                     context_->HSSetShaderResources(slot, 1, nullSRVs);
-                    srvHS_.locators[slot] = nullptr;
+                    srvHS_.reset(slot);
                 }
                 else
                     hasRemainingHSBindings = true;
             }
-        }
+        });
         if (!hasRemainingHSBindings)
         {
             if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_HS))
@@ -931,19 +988,19 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_DS)) != 0)
     {
         bool hasRemainingDSBindings = false;
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvDS_.size()))
+        ForEachOccupiedSlot(srvDS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvDS_.locators[slot] == locator)
             {
                 if (D3D11SubresourceRange::Overlap(srvDS_.subresourceRanges[slot], subresourceRange))
                 {
                     context_->DSSetShaderResources(slot, 1, nullSRVs);
-                    srvDS_.locators[slot] = nullptr;
+                    srvDS_.reset(slot);
                 }
                 else
                     hasRemainingDSBindings = true;
             }
-        }
+        });
         if (!hasRemainingDSBindings)
         {
             if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_DS))
@@ -954,19 +1011,19 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_GS)) != 0)
     {
         bool hasRemainingGSBindings = false;
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvGS_.size()))
+        ForEachOccupiedSlot(srvGS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvGS_.locators[slot] == locator)
             {
                 if (D3D11SubresourceRange::Overlap(srvGS_.subresourceRanges[slot], subresourceRange))
                 {
                     context_->GSSetShaderResources(slot, 1, nullSRVs);
-                    srvGS_.locators[slot] = nullptr;
+                    srvGS_.reset(slot);
                 }
                 else
                     hasRemainingGSBindings = true;
             }
-        }
+        });
         if (!hasRemainingGSBindings)
         {
             if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_GS))
@@ -977,19 +1034,19 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_PS)) != 0)
     {
         bool hasRemainingPSBindings = false;
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvPS_.size()))
+        ForEachOccupiedSlot(srvPS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvPS_.locators[slot] == locator)
             {
                 if (D3D11SubresourceRange::Overlap(srvPS_.subresourceRanges[slot], subresourceRange))
                 {
                     context_->PSSetShaderResources(slot, 1, nullSRVs);
-                    srvPS_.locators[slot] = nullptr;
+                    srvPS_.reset(slot);
                 }
                 else
                     hasRemainingPSBindings = true;
             }
-        }
+        });
         if (!hasRemainingPSBindings)
         {
             if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_PS))
@@ -1000,19 +1057,19 @@ void D3D11BindingTable::EvictMultipleSubresourceInputBindings(D3D11BindingLocato
     if ((locator->inBitmask & (1u << D3D11BindingLocator::D3DInput_SRV_CS)) != 0)
     {
         bool hasRemainingCSBindings = false;
-        for_subrange(slot, locator->inRangeBegin, std::min<UINT>(locator->inRangeEnd, srvCS_.size()))
+        ForEachOccupiedSlot(srvCS_, locator->inRangeBegin, locator->inRangeEnd, [&](UINT slot)
         {
             if (srvCS_.locators[slot] == locator)
             {
                 if (D3D11SubresourceRange::Overlap(srvCS_.subresourceRanges[slot], subresourceRange))
                 {
                     context_->CSSetShaderResources(slot, 1, nullSRVs);
-                    srvCS_.locators[slot] = nullptr;
+                    srvCS_.reset(slot);
                 }
                 else
                     hasRemainingCSBindings = true;
             }
-        }
+        });
         if (!hasRemainingCSBindings)
         {
             if (locator->RemoveInput(D3D11BindingLocator::D3DInput_SRV_CS))
@@ -1029,7 +1086,7 @@ void D3D11BindingTable::EvictAllVertexBuffers()
         if (vb_.locators[slot] != nullptr)
         {
             vb_.locators[slot]->RemoveInput(D3D11BindingLocator::D3DInput_VB);
-            vb_.locators[slot] = nullptr;
+            vb_.reset(slot);
         }
     }
     context_->IASetVertexBuffers(0, vbCount_, GetNullPointerArray<ID3D11Buffer>(), nullValues, nullValues);
@@ -1041,7 +1098,7 @@ void D3D11BindingTable::EvictAllStreamOutputTargets()
     context_->SOSetTargets(0, nullptr, nullptr);
 
     for_range(slot, soCount_)
-        RemoveWholeResourceOutput(so_.locators, D3D11BindingLocator::D3DOutput_SO, slot);
+        RemoveWholeResourceOutput(so_, D3D11BindingLocator::D3DOutput_SO, slot);
     soCount_ = 0;
 }
 
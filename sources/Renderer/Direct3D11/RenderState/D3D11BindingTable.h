@@ -11,7 +11,6 @@
 
 #include "D3D11BindingLocator.h"
 #include "../../DXCommon/ComPtr.h"
-#include "../../../Core/SparseForwardIterator.h"
 #include <LLGL/ResourceFlags.h>
 #include <d3d11.h>
 #include <cstdint>
@@ -110,7 +109,29 @@ class D3D11BindingTable
 
     private:
 
-        using D3D11BindingLocatorIterator = SparseForwardIterator<D3D11BindingLocator*>;
+        // Bitmask of occupied slots, so binding tables can be scanned and cleared without visiting every empty slot.
+        template <UINT Size>
+        struct SlotBitmask
+        {
+            static constexpr UINT numWords = (Size + 63u) / 64u;
+
+            inline void set(UINT slot)
+            {
+                words[slot / 64u] |= (1ull << (slot % 64u));
+            }
+
+            inline void reset(UINT slot)
+            {
+                words[slot / 64u] &= ~(1ull << (slot % 64u));
+            }
+
+            inline void clear()
+            {
+                std::memset(words, 0, sizeof(words));
+            }
+
+            std::uint64_t words[numWords] = {};
+        };
 
         template <UINT Size>
         struct ResourceLocatorContainer
@@ -120,22 +141,23 @@ class D3D11BindingTable
                 return Size;
             }
 
-            void clear()
+            inline void put(UINT slot, D3D11BindingLocator* locator)
             {
-                std::memset(locators, 0, sizeof(locators));
+                locators[slot] = locator;
+                if (locator != nullptr)
+                    occupied.set(slot);
+                else
+                    occupied.reset(slot);
             }
 
-            D3D11BindingLocatorIterator begin() noexcept
+            inline void reset(UINT slot)
             {
-                return D3D11BindingLocatorIterator{ locators, locators + Size };
+                locators[slot] = nullptr;
+                occupied.reset(slot);
             }
 
-            D3D11BindingLocatorIterator end() noexcept
-            {
-                return D3D11BindingLocatorIterator{ locators + Size };
-            }
-
-            D3D11BindingLocator* locators[Size] = {};
+            D3D11BindingLocator*    locators[Size]  = {};
+            SlotBitmask<Size>       occupied;
         };
 
         template <UINT Size>
@@ -146,35 +168,45 @@ class D3D11BindingTable
                 return Size;
             }
 
-            void clear()
+            inline void put(UINT slot, D3D11BindingLocator* locator)
             {
-                std::memset(locators, 0, sizeof(locators));
-                std::memset(subresourceRanges, 0, sizeof(subresourceRanges));
+                locators[slot] = locator;
+                if (locator != nullptr)
+                    occupied.set(slot);
+                else
+                    occupied.reset(slot);
             }
 
-            D3D11BindingLocatorIterator begin() noexcept
+            inline void reset(UINT slot)
             {
-                return D3D11BindingLocatorIterator{ locators, locators + Size };
-            }
-
-            D3D11BindingLocatorIterator end() noexcept
-            {
-                return D3D11BindingLocatorIterator{ locators + Size };
+                locators[slot] = nullptr;
+                occupied.reset(slot);
             }
 
             D3D11BindingLocator*    locators[Size]          = {};
-            D3D11SubresourceRange   subresourceRanges[Size] = {}; // Ranges to determine overlaps between SRV and UAV subresources of the same parent resource
+            D3D11SubresourceRange   subresourceRanges[Size] = {}; // Ranges to determine overlaps between SRV and UAV subresources of the same parent resource; only valid for occupied slots
+            SlotBitmask<Size>       occupied;
         };
 
     private:
 
-        void InsertInput(D3D11BindingLocator** container, D3D11BindingLocator::D3DInputs input, UINT slot, D3D11BindingLocator* locator);
-        bool RemoveSubresourceInput(D3D11BindingLocator** container, D3D11BindingLocator::D3DInputs input, UINT slot);
-        bool RemoveWholeResourceInput(D3D11BindingLocator** container, D3D11BindingLocator::D3DInputs input, UINT slot);
+        template <typename TContainer>
+        void InsertInput(TContainer& container, D3D11BindingLocator::D3DInputs input, UINT slot, D3D11BindingLocator* locator);
+
+        template <typename TContainer>
+        bool RemoveSubresourceInput(TContainer& container, D3D11BindingLocator::D3DInputs input, UINT slot);
+
+        template <typename TContainer>
+        bool RemoveWholeResourceInput(TContainer& container, D3D11BindingLocator::D3DInputs input, UINT slot);
+
+        template <typename TContainer>
+        void InsertOutput(TContainer& container, D3D11BindingLocator::D3DOutputs output, UINT slot, D3D11BindingLocator* locator);
+
+        template <typename TContainer>
+        bool RemoveSubresourceOutput(TContainer& container, D3D11BindingLocator::D3DOutputs output, UINT slot);
 
-        void InsertOutput(D3D11BindingLocator** container, D3D11BindingLocator::D3DOutputs output, UINT slot, D3D11BindingLocator* locator);
-        bool RemoveSubresourceOutput(D3D11BindingLocator** container, D3D11BindingLocator::D3DOutputs output, UINT slot);
-        void RemoveWholeResourceOutput(D3D11BindingLocator** container, D3D11BindingLocator::D3DOutputs output, UINT slot);
+        template <typename TContainer>
+        void RemoveWholeResourceOutput(TContainer& container, D3D11BindingLocator::D3DOutputs output, UINT slot);
 
         void PutVertexBuffer(D3D11BindingLocator* locator, UINT slot);
         void PutIndexBuffer(D3D11BindingLocator* locator);
@@ -211,16 +243,9 @@ class D3D11BindingTable
 
         void BindCachedOutputMergerUAVs();
 
+        // Clears the binding locators of all occupied slots in the specified container.
         template <typename TContainer>
-        void ClearBindingLocators(TContainer& container)
-        {
-            for (D3D11BindingLocator* locator : container)
-            {
-                locator->ClearInput();
-                locator->ClearOutput();
-            }
-            container.clear();
-        }
+        void ClearBindingLocators(TContainer& container);
 
         template <typename TContainer>
         bool HasLocatorAt(const TContainer& container, UINT slot, const D3D11BindingLocator* locator) const
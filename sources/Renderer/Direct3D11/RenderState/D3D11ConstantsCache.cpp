@@ -115,19 +115,24 @@ HRESULT D3D11ConstantsCache::SetUniforms(std::uint32_t first, const void* data,
         D3D11ConstantsCache::ConstantBuffer& cbuffer = constantBuffers_[location.index];
         const std::uint16_t chunkSize = std::min<std::uint16_t>(dataSize, static_cast<std::uint16_t>(location.size));
 
-        /* Copy input data into cbuffer data and move to next uniform */
-        ::memcpy(reinterpret_cast<char*>(cbuffer.constants.data()) + location.offset, dataByteAligned, chunkSize);
+        /* Copy input data into cbuffer data only if it has changed, so redundant uniform updates don't upload the cbuffer again */
+        char* dst = reinterpret_cast<char*>(cbuffer.constants.data()) + location.offset;
+        if (::memcmp(dst, dataByteAligned, chunkSize) != 0)
+        {
+            ::memcpy(dst, dataByteAligned, chunkSize);
+
+            /* Invalidate cache for current cbuffer */
+            if (!invalidatedBuffers_[location.index])
+            {
+                invalidatedBuffers_[location.index] = true;
+                invalidatedBuffersRange_[0] = std::min<std::uint8_t>(invalidatedBuffersRange_[0], location.index);
+                invalidatedBuffersRange_[1] = std::max<std::uint8_t>(invalidatedBuffersRange_[1], location.index + 1u);
+            }
+        }
 
+        /* Move to next uniform */
         dataByteAligned += chunkSize;
         dataSize -= chunkSize;
-
-        /* Invalidate cache for current cbuffer */
-        if (!invalidatedBuffers_[location.index])
-        {
-            invalidatedBuffers_[location.index] = true;
-            invalidatedBuffersRange_[0] = std::min<std::uint8_t>(invalidatedBuffersRange_[0], location.index);
-            invalidatedBuffersRange_[1] = std::max<std::uint8_t>(invalidatedBuffersRange_[1], location.index + 1u);
-        }
     }
     return S_OK;
 }
@@ -159,8 +164,12 @@ void D3D11ConstantsCache::Flush(D3D11StateManager& stateMngr)
             }
         }
 
-        /* Reset constant buffer pool; We only need unique staging buffers for each cbuffer in this cache before the next draw call */
-        stateMngr.ResetCbufferPool();
+        /*
+        Reset constant buffer pool; We only need unique staging buffers for each cbuffer in this cache before the next draw call.
+        A constant buffer ring must keep its previous ranges alive instead, since they are sub-allocated without discarding the buffer.
+        */
+        if (!stateMngr.HasCbufferRing())
+            stateMngr.ResetCbufferPool();
 
         /* Clear cached range */
         invalidatedBuffersRange_[0] = 0xFF;
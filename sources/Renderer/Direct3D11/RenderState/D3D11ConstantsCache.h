@@ -41,6 +41,7 @@ class D3D11ConstantsCache
             const ArrayView<UniformDescriptor>& uniforms
         );
 
+        // Copies the specified uniform data into the shadow cbuffers and only invalidates the cbuffers whose content has changed.
         HRESULT SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize);
 
         // Resets the internal cache to bind all constants again at the next call to Flush().
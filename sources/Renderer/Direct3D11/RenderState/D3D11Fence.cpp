@@ -25,9 +25,18 @@ D3D11Fence::D3D11Fence(ID3D11Device* device)
     DXThrowIfFailed(hr, "failed to create D3D11 query");
 }
 
+bool D3D11Fence::IsSignaled()
+{
+    /* Poll the event query without flushing the context */
+    if (context_ == nullptr)
+        return true;
+    return (context_->GetData(query_.Get(), nullptr, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH) != S_FALSE);
+}
+
 void D3D11Fence::Submit(ID3D11DeviceContext* context)
 {
     context->End(query_.Get());
+    context_ = context;
 }
 
 void D3D11Fence::Wait(ID3D11DeviceContext* context)
@@ -22,6 +22,10 @@ namespace LLGL
 class D3D11Fence final : public Fence
 {
 
+    public:
+
+        bool IsSignaled() override;
+
     public:
 
         D3D11Fence(ID3D11Device* device);
@@ -31,7 +35,8 @@ class D3D11Fence final : public Fence
 
     private:
 
-        ComPtr<ID3D11Query> query_;
+        ComPtr<ID3D11Query>         query_;
+        ID3D11DeviceContext*        context_    = nullptr; // Context of the last submission; null if this fence has never been submitted
 
 };
 
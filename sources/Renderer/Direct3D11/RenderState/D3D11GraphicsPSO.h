@@ -10,6 +10,7 @@
 
 
 #include "D3D11GraphicsPSOBase.h"
+#include "D3D11StatePool.h"
 
 
 namespace LLGL
@@ -22,18 +23,14 @@ class D3D11GraphicsPSO final : public D3D11GraphicsPSOBase
 
     public:
 
-        D3D11GraphicsPSO(ID3D11Device* device, const GraphicsPipelineDescriptor& desc);
+        D3D11GraphicsPSO(ID3D11Device* device, D3D11StatePool& statePool, const GraphicsPipelineDescriptor& desc);
+        ~D3D11GraphicsPSO();
 
         void Bind(D3D11StateManager& stateMngr) override;
 
     private:
 
-        void CreateDepthStencilState(ID3D11Device* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
-        void CreateRasterizerState(ID3D11Device* device, const RasterizerDescriptor& desc);
-        void CreateBlendState(ID3D11Device* device, const BlendDescriptor& desc);
-
-    private:
-
+        D3D11StatePool&                 statePool_;
         ComPtr<ID3D11DepthStencilState> depthStencilState_;
         ComPtr<ID3D11RasterizerState>   rasterizerState_;
         ComPtr<ID3D11BlendState>        blendState_;
@@ -10,8 +10,6 @@
 
 #include "D3D11GraphicsPSO1.h"
 #include "D3D11StateManager.h"
-#include "../D3D11Types.h"
-#include "../../DXCommon/DXCore.h"
 #include <LLGL/PipelineStateFlags.h>
 
 
@@ -19,13 +17,21 @@ namespace LLGL
 {
 
 
-D3D11GraphicsPSO1::D3D11GraphicsPSO1(ID3D11Device1* device, const GraphicsPipelineDescriptor& desc) :
-    D3D11GraphicsPSOBase { desc }
+D3D11GraphicsPSO1::D3D11GraphicsPSO1(ID3D11Device1* device, D3D11StatePool& statePool, const GraphicsPipelineDescriptor& desc) :
+    D3D11GraphicsPSOBase { desc      },
+    statePool_           { statePool }
 {
     /* Create render state objects for Direct3D 11.1 */
-    CreateDepthStencilState(device, desc.depth, desc.stencil);
-    CreateRasterizerState(device, desc.rasterizer);
-    CreateBlendState(device, desc.blend);
+    depthStencilState_  = statePool.CreateDepthStencilState(device, desc.depth, desc.stencil);
+    rasterizerState_    = statePool.CreateRasterizerState(device, desc.rasterizer);
+    blendState_         = statePool.CreateBlendState1(device, desc.blend);
+}
+
+D3D11GraphicsPSO1::~D3D11GraphicsPSO1()
+{
+    statePool_.ReleaseDepthStencilState(std::move(depthStencilState_));
+    statePool_.ReleaseRasterizerState(std::move(rasterizerState_));
+    statePool_.ReleaseBlendState(std::move(blendState_));
 }
 
 void D3D11GraphicsPSO1::Bind(D3D11StateManager& stateMngr)
@@ -50,35 +56,6 @@ void D3D11GraphicsPSO1::Bind(D3D11StateManager& stateMngr)
 }
 
 
-/*
- * ======= Private: =======
- */
-
-void D3D11GraphicsPSO1::CreateDepthStencilState(ID3D11Device1* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc)
-{
-    D3D11_DEPTH_STENCIL_DESC descDX;
-    D3D11Types::Convert(descDX, depthDesc, stencilDesc);
-    HRESULT hr = device->CreateDepthStencilState(&descDX, depthStencilState_.ReleaseAndGetAddressOf());
-    DXThrowIfFailed(hr, "failed to create D3D11 depth-stencil state");
-}
-
-void D3D11GraphicsPSO1::CreateRasterizerState(ID3D11Device1* device, const RasterizerDescriptor& desc)
-{
-    D3D11_RASTERIZER_DESC descDX;
-    D3D11Types::Convert(descDX, desc);
-    HRESULT hr = device->CreateRasterizerState(&descDX, rasterizerState_.ReleaseAndGetAddressOf());
-    DXThrowIfFailed(hr, "failed to create D3D11 rasterizer state");
-}
-
-void D3D11GraphicsPSO1::CreateBlendState(ID3D11Device1* device, const BlendDescriptor& desc)
-{
-    D3D11_BLEND_DESC1 descDX;
-    D3D11Types::Convert(descDX, desc);
-    HRESULT hr = device->CreateBlendState1(&descDX, blendState_.ReleaseAndGetAddressOf());
-    DXThrowIfFailed(hr, "failed to create D3D11 blend state");
-}
-
-
 } // /namespace LLGL
 
 
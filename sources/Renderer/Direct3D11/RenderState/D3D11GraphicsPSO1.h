@@ -12,6 +12,7 @@
 
 
 #include "D3D11GraphicsPSOBase.h"
+#include "D3D11StatePool.h"
 #include <d3d11_1.h>
 
 
@@ -25,18 +26,14 @@ class D3D11GraphicsPSO1 final : public D3D11GraphicsPSOBase
 
     public:
 
-        D3D11GraphicsPSO1(ID3D11Device1* device, const GraphicsPipelineDescriptor& desc);
+        D3D11GraphicsPSO1(ID3D11Device1* device, D3D11StatePool& statePool, const GraphicsPipelineDescriptor& desc);
+        ~D3D11GraphicsPSO1();
 
         void Bind(D3D11StateManager& stateMngr) override;
 
     private:
 
-        void CreateDepthStencilState(ID3D11Device1* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
-        void CreateRasterizerState(ID3D11Device1* device, const RasterizerDescriptor& desc);
-        void CreateBlendState(ID3D11Device1* device, const BlendDescriptor& desc);
-
-    private:
-
+        D3D11StatePool&                 statePool_;
         ComPtr<ID3D11DepthStencilState> depthStencilState_;
         ComPtr<ID3D11RasterizerState>   rasterizerState_;
         ComPtr<ID3D11BlendState1>       blendState_;
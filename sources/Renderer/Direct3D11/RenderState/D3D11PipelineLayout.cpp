@@ -17,7 +17,8 @@ namespace LLGL
 {
 
 
-D3D11PipelineLayout::D3D11PipelineLayout(ID3D11Device* device, const PipelineLayoutDescriptor& desc) :
+D3D11PipelineLayout::D3D11PipelineLayout(ID3D11Device* device, D3D11StatePool& statePool, const PipelineLayoutDescriptor& desc) :
+    statePool_    { statePool                                     },
     heapBindings_ { GetExpandedHeapDescriptors(desc.heapBindings) },
     uniforms_     { desc.uniforms                                 }
 {
@@ -25,6 +26,12 @@ D3D11PipelineLayout::D3D11PipelineLayout(ID3D11Device* device, const PipelineLay
     BuildStaticSamplers(device, desc.staticSamplers);
 }
 
+D3D11PipelineLayout::~D3D11PipelineLayout()
+{
+    for (D3D11StaticSampler& staticSampler : staticSamplers_)
+        statePool_.ReleaseSamplerState(std::move(staticSampler.native));
+}
+
 std::uint32_t D3D11PipelineLayout::GetNumHeapBindings() const
 {
     return static_cast<std::uint32_t>(heapBindings_.size());
@@ -100,23 +107,12 @@ void D3D11PipelineLayout::BuildDynamicResourceBindings(const std::vector<Binding
         bindings_.push_back(D3D11PipelineResourceBinding{ ToD3DResourceType(desc), desc.slot.index, desc.stageFlags });
 }
 
-static ComPtr<ID3D11SamplerState> DXCreateSamplerState(ID3D11Device* device, const D3D11_SAMPLER_DESC& desc)
-{
-    ComPtr<ID3D11SamplerState> nativeSamplerState;
-    HRESULT hr = device->CreateSamplerState(&desc, nativeSamplerState.ReleaseAndGetAddressOf());
-    DXThrowIfCreateFailed(hr, "ID3D11SamplerState");
-    return nativeSamplerState;
-}
-
 void D3D11PipelineLayout::BuildStaticSamplers(ID3D11Device* device, const std::vector<StaticSamplerDescriptor>& staticSamplerDescs)
 {
-    D3D11_SAMPLER_DESC nativeDesc;
+    /* Share identical static samplers across all pipeline layouts */
     staticSamplers_.reserve(staticSamplerDescs.size());
     for (const StaticSamplerDescriptor& desc : staticSamplerDescs)
-    {
-        D3D11Sampler::ConvertDesc(nativeDesc, desc.sampler);
-        staticSamplers_.push_back(D3D11StaticSampler{ desc.slot.index, desc.stageFlags, DXCreateSamplerState(device, nativeDesc) });
-    }
+        staticSamplers_.push_back(D3D11StaticSampler{ desc.slot.index, desc.stageFlags, statePool_.CreateSamplerState(device, desc.sampler) });
 }
 
 
@@ -12,6 +12,7 @@
 #include <LLGL/PipelineLayout.h>
 #include <LLGL/PipelineLayoutFlags.h>
 #include <LLGL/Container/DynamicVector.h>
+#include "D3D11StatePool.h"
 #include "../Texture/D3D11Sampler.h"
 #include <d3d11.h>
 #include "../../DXCommon/ComPtr.h"
@@ -42,7 +43,8 @@ class D3D11PipelineLayout final : public PipelineLayout
 
     public:
 
-        D3D11PipelineLayout(ID3D11Device* device, const PipelineLayoutDescriptor& desc);
+        D3D11PipelineLayout(ID3D11Device* device, D3D11StatePool& statePool, const PipelineLayoutDescriptor& desc);
+        ~D3D11PipelineLayout();
 
         void BindGraphicsStaticSamplers(D3D11StateManager& stateMngr) const;
         void BindComputeStaticSamplers(D3D11StateManager& stateMngr) const;
@@ -72,6 +74,7 @@ class D3D11PipelineLayout final : public PipelineLayout
 
     private:
 
+        D3D11StatePool&                             statePool_;
         DynamicVector<BindingDescriptor>            heapBindings_;
         std::vector<D3D11PipelineResourceBinding>   bindings_;
         std::vector<D3D11StaticSampler>             staticSamplers_;
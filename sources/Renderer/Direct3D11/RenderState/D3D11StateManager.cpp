@@ -9,6 +9,7 @@
 #include "../Texture/D3D11Sampler.h"
 #include "../../../Core/MacroUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../ProfileCounters.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <cstddef>
@@ -30,24 +31,45 @@ static bool D3DSupportsDriverCommandLists(ID3D11Device* device)
     return (SUCCEEDED(hr) && threadingCaps.DriverCommandLists != FALSE);
 }
 
+/*
+Returns true if intermediate constants can be sub-allocated from a ring of dynamic constant buffers.
+This requires binding constant buffer ranges with *SetConstantBuffers1() and mapping dynamic constant buffers with D3D11_MAP_WRITE_NO_OVERWRITE.
+*/
+static bool D3DSupportsConstantBufferRing(ID3D11Device* device, bool needsCommandListEmulation)
+{
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    if (!needsCommandListEmulation)
+    {
+        D3D11_FEATURE_DATA_D3D11_OPTIONS optionsCaps = {};
+        HRESULT hr = device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &optionsCaps, sizeof(optionsCaps));
+        return (SUCCEEDED(hr) && optionsCaps.ConstantBufferOffsetting != FALSE && optionsCaps.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
+    }
+    #endif
+    return false;
+}
+
 /*
 Note:
   Maximum size for D3D11 cbuffer is 'D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT * 4 * sizeof(float)'
   The chunk size doesn't have to exhaust this size limit, but 4096 happens to be the same value as D3D11_REQ_CONSTANT_BUFFER_ELEMENT_COUNT.
+  Chunks of a constant buffer ring are shared between all draw calls until the pool is reset, so they are considerably larger.
 */
-static constexpr UINT g_cbufferChunkSize = 4096u;
+static constexpr UINT g_cbufferChunkSize        = 4096u;
+static constexpr UINT g_cbufferRingChunkSize    = 256u * 1024u;
 
 D3D11StateManager::D3D11StateManager(ID3D11Device* device, const ComPtr<ID3D11DeviceContext>& context) :
-    context_                   { context                                },
-    needsCommandListEmulation_ { !D3DSupportsDriverCommandLists(device) },
+    context_                   { context                                                              },
+    needsCommandListEmulation_ { !D3DSupportsDriverCommandLists(device)                               },
+    hasCbufferRing_            { D3DSupportsConstantBufferRing(device, needsCommandListEmulation_)    },
     stagingCbufferPool_
     {
         device,
         context.Get(),
-        g_cbufferChunkSize,
+        (hasCbufferRing_ ? g_cbufferRingChunkSize : g_cbufferChunkSize),
         D3D11_USAGE_DYNAMIC,
         D3D11_CPU_ACCESS_WRITE,
-        D3D11_BIND_CONSTANT_BUFFER
+        D3D11_BIND_CONSTANT_BUFFER,
+        hasCbufferRing_
     },
     bindingTable_ { context }
 {
@@ -130,6 +152,8 @@ void D3D11StateManager::SetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY primitiveT
         inputAssemblyState_.primitiveTopology = primitiveTopology;
         context_->IASetPrimitiveTopology(primitiveTopology);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetInputLayout(ID3D11InputLayout* inputLayout)
@@ -139,6 +163,8 @@ void D3D11StateManager::SetInputLayout(ID3D11InputLayout* inputLayout)
         inputAssemblyState_.inputLayout = inputLayout;
         context_->IASetInputLayout(inputLayout);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetVertexShader(ID3D11VertexShader* shader)
@@ -148,6 +174,8 @@ void D3D11StateManager::SetVertexShader(ID3D11VertexShader* shader)
         shaderState_.vs = shader;
         context_->VSSetShader(shader, nullptr, 0);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetHullShader(ID3D11HullShader* shader)
@@ -157,6 +185,8 @@ void D3D11StateManager::SetHullShader(ID3D11HullShader* shader)
         shaderState_.hs = shader;
         context_->HSSetShader(shader, nullptr, 0);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetDomainShader(ID3D11DomainShader* shader)
@@ -166,6 +196,8 @@ void D3D11StateManager::SetDomainShader(ID3D11DomainShader* shader)
         shaderState_.ds = shader;
         context_->DSSetShader(shader, nullptr, 0);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetGeometryShader(ID3D11GeometryShader* shader)
@@ -175,6 +207,8 @@ void D3D11StateManager::SetGeometryShader(ID3D11GeometryShader* shader)
         shaderState_.gs = shader;
         context_->GSSetShader(shader, nullptr, 0);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetPixelShader(ID3D11PixelShader* shader)
@@ -184,6 +218,8 @@ void D3D11StateManager::SetPixelShader(ID3D11PixelShader* shader)
         shaderState_.ps = shader;
         context_->PSSetShader(shader, nullptr, 0);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetComputeShader(ID3D11ComputeShader* shader)
@@ -193,6 +229,8 @@ void D3D11StateManager::SetComputeShader(ID3D11ComputeShader* shader)
         shaderState_.cs = shader;
         context_->CSSetShader(shader, nullptr, 0);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetRasterizerState(ID3D11RasterizerState* rasterizerState)
@@ -202,6 +240,8 @@ void D3D11StateManager::SetRasterizerState(ID3D11RasterizerState* rasterizerStat
         renderState_.rasterizerState = rasterizerState;
         context_->RSSetState(rasterizerState);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetDepthStencilState(ID3D11DepthStencilState* depthStencilState)
@@ -211,6 +251,8 @@ void D3D11StateManager::SetDepthStencilState(ID3D11DepthStencilState* depthStenc
         renderState_.depthStencilState = depthStencilState;
         context_->OMSetDepthStencilState(depthStencilState, renderState_.stencilRef);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetDepthStencilState(ID3D11DepthStencilState* depthStencilState, UINT stencilRef)
@@ -221,6 +263,8 @@ void D3D11StateManager::SetDepthStencilState(ID3D11DepthStencilState* depthStenc
         renderState_.stencilRef         = stencilRef;
         context_->OMSetDepthStencilState(depthStencilState, stencilRef);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetStencilRef(UINT stencilRef)
@@ -230,6 +274,8 @@ void D3D11StateManager::SetStencilRef(UINT stencilRef)
         renderState_.stencilRef = stencilRef;
         context_->OMSetDepthStencilState(renderState_.depthStencilState, stencilRef);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 static bool EqualsBlendFactors(const FLOAT lhs[4], const FLOAT rhs[4])
@@ -251,6 +297,8 @@ void D3D11StateManager::SetBlendState(ID3D11BlendState* blendState, UINT sampleM
         renderState_.sampleMask     = sampleMask;
         context_->OMSetBlendState(blendState, renderState_.blendFactor, sampleMask);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetBlendState(ID3D11BlendState* blendState, const FLOAT blendFactor[4], UINT sampleMask)
@@ -265,6 +313,8 @@ void D3D11StateManager::SetBlendState(ID3D11BlendState* blendState, const FLOAT
         renderState_.sampleMask     = sampleMask;
         context_->OMSetBlendState(blendState, blendFactor, sampleMask);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetBlendFactor(const FLOAT blendFactor[4])
@@ -277,6 +327,8 @@ void D3D11StateManager::SetBlendFactor(const FLOAT blendFactor[4])
         renderState_.blendFactor[3] = blendFactor[3];
         context_->OMSetBlendState(renderState_.blendState, blendFactor, renderState_.sampleMask);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void D3D11StateManager::SetConstantBuffers(
@@ -88,7 +88,7 @@ class D3D11StateManager
         void DispatchBuiltin(const D3D11BuiltinShader builtinShader, UINT numWorkGroupsX, UINT numWorkGroupsY, UINT numWorkGroupsZ);
 
         // Resets the constant buffer pool. This should be called at the beginning of each command buffer encoding (D3D11PrimaryCommandBuffer::Begin)
-        // as well as after every constants cache has been flushed (D3D11ConstantsCache::Flush).
+        // as well as after every constants cache has been flushed (D3D11ConstantsCache::Flush) unless the pool is a constant buffer ring.
         void ResetCbufferPool();
 
         // Invokes ClearState() on the device context and invalidates all caches.
@@ -117,6 +117,13 @@ class D3D11StateManager
             return needsCommandListEmulation_;
         }
 
+        // Returns whether intermediate constants are sub-allocated from a ring of dynamic constant buffers.
+        // In this case, SetConstants() only changes the buffer offset and the pool does not have to be reset after every draw call.
+        inline bool HasCbufferRing() const
+        {
+            return hasCbufferRing_;
+        }
+
     private:
 
         struct D3DInputAssemblyState
@@ -154,6 +161,7 @@ class D3D11StateManager
         #endif
 
         const bool                      needsCommandListEmulation_  = false;
+        const bool                      hasCbufferRing_             = false;
 
         D3D11StagingBufferPool          stagingCbufferPool_;
 
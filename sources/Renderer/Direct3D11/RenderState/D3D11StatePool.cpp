@@ -0,0 +1,259 @@
+/*
+ * D3D11StatePool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D11StatePool.h"
+#include "../D3D11Types.h"
+#include "../Texture/D3D11Sampler.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/CoreUtils.h"
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal templates
+ */
+
+// Returns a native descriptor with all bytes cleared, so padding bytes don't affect the byte-wise comparison of descriptors.
+template <typename TDesc>
+TDesc MakeZeroedDesc()
+{
+    TDesc desc;
+    std::memset(&desc, 0, sizeof(desc));
+    return desc;
+}
+
+// Returns the shared state object with the specified native descriptor or creates a new one with complexity O(log n).
+template <typename TDesc, typename TState, typename TCreateFunc>
+ComPtr<TState> CreateSharedStateObject(
+    std::vector<D3D11StatePoolEntry<TDesc, TState>>&    container,
+    const TDesc&                                        desc,
+    const TCreateFunc&                                  createFunc)
+{
+    using TEntry = D3D11StatePoolEntry<TDesc, TState>;
+
+    /* Try to find state object with same native descriptor */
+    std::size_t insertionIndex = 0;
+    TEntry* entry = FindInSortedArray<TEntry>(
+        container.data(),
+        container.size(),
+        [&desc](const TEntry& entry) -> int
+        {
+            return std::memcmp(&entry.desc, &desc, sizeof(TDesc));
+        },
+        &insertionIndex
+    );
+
+    if (entry != nullptr)
+    {
+        ++entry->refCount;
+        return entry->state;
+    }
+
+    /* Create new state object and insert it with insertion sort */
+    ComPtr<TState> state = createFunc(desc);
+    container.insert(container.begin() + insertionIndex, TEntry{ desc, state, 1 });
+
+    return state;
+}
+
+template <typename TDesc, typename TState>
+void ReleaseSharedStateObject(std::vector<D3D11StatePoolEntry<TDesc, TState>>& container, ComPtr<TState>&& state)
+{
+    if (!state)
+        return;
+
+    /* Find entry by its native object, since releasing states is not a hot path */
+    for (auto it = container.begin(); it != container.end(); ++it)
+    {
+        if (it->state.Get() == state.Get())
+        {
+            if (--it->refCount == 0)
+                container.erase(it);
+            break;
+        }
+    }
+
+    state.Reset();
+}
+
+
+/*
+ * D3D11StatePool class
+ */
+
+void D3D11StatePool::Clear()
+{
+    depthStencilStates_.clear();
+    rasterizerStates_.clear();
+    blendStates_.clear();
+    samplerStates_.clear();
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+    blendStates1_.clear();
+    #endif
+    #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+    rasterizerStates2_.clear();
+    #endif
+}
+
+/* ----- Depth-stencil states ----- */
+
+ComPtr<ID3D11DepthStencilState> D3D11StatePool::CreateDepthStencilState(ID3D11Device* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc)
+{
+    auto descDX = MakeZeroedDesc<D3D11_DEPTH_STENCIL_DESC>();
+    D3D11Types::Convert(descDX, depthDesc, stencilDesc);
+    return CreateSharedStateObject(
+        depthStencilStates_,
+        descDX,
+        [device](const D3D11_DEPTH_STENCIL_DESC& desc) -> ComPtr<ID3D11DepthStencilState>
+        {
+            ComPtr<ID3D11DepthStencilState> state;
+            HRESULT hr = device->CreateDepthStencilState(&desc, state.GetAddressOf());
+            DXThrowIfFailed(hr, "failed to create D3D11 depth-stencil state");
+            return state;
+        }
+    );
+}
+
+void D3D11StatePool::ReleaseDepthStencilState(ComPtr<ID3D11DepthStencilState>&& depthStencilState)
+{
+    ReleaseSharedStateObject(depthStencilStates_, std::move(depthStencilState));
+}
+
+/* ----- Rasterizer states ----- */
+
+ComPtr<ID3D11RasterizerState> D3D11StatePool::CreateRasterizerState(ID3D11Device* device, const RasterizerDescriptor& rasterizerDesc)
+{
+    auto descDX = MakeZeroedDesc<D3D11_RASTERIZER_DESC>();
+    D3D11Types::Convert(descDX, rasterizerDesc);
+    return CreateSharedStateObject(
+        rasterizerStates_,
+        descDX,
+        [device](const D3D11_RASTERIZER_DESC& desc) -> ComPtr<ID3D11RasterizerState>
+        {
+            ComPtr<ID3D11RasterizerState> state;
+            HRESULT hr = device->CreateRasterizerState(&desc, state.GetAddressOf());
+            DXThrowIfFailed(hr, "failed to create D3D11 rasterizer state");
+            return state;
+        }
+    );
+}
+
+void D3D11StatePool::ReleaseRasterizerState(ComPtr<ID3D11RasterizerState>&& rasterizerState)
+{
+    ReleaseSharedStateObject(rasterizerStates_, std::move(rasterizerState));
+}
+
+#if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+
+ComPtr<ID3D11RasterizerState2> D3D11StatePool::CreateRasterizerState2(ID3D11Device3* device, const RasterizerDescriptor& rasterizerDesc)
+{
+    auto descDX = MakeZeroedDesc<D3D11_RASTERIZER_DESC2>();
+    D3D11Types::Convert(descDX, rasterizerDesc);
+    return CreateSharedStateObject(
+        rasterizerStates2_,
+        descDX,
+        [device](const D3D11_RASTERIZER_DESC2& desc) -> ComPtr<ID3D11RasterizerState2>
+        {
+            ComPtr<ID3D11RasterizerState2> state;
+            HRESULT hr = device->CreateRasterizerState2(&desc, state.GetAddressOf());
+            DXThrowIfFailed(hr, "failed to create D3D11 rasterizer state");
+            return state;
+        }
+    );
+}
+
+void D3D11StatePool::ReleaseRasterizerState(ComPtr<ID3D11RasterizerState2>&& rasterizerState)
+{
+    ReleaseSharedStateObject(rasterizerStates2_, std::move(rasterizerState));
+}
+
+#endif // /LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+
+/* ----- Blend states ----- */
+
+ComPtr<ID3D11BlendState> D3D11StatePool::CreateBlendState(ID3D11Device* device, const BlendDescriptor& blendDesc)
+{
+    auto descDX = MakeZeroedDesc<D3D11_BLEND_DESC>();
+    D3D11Types::Convert(descDX, blendDesc);
+    return CreateSharedStateObject(
+        blendStates_,
+        descDX,
+        [device](const D3D11_BLEND_DESC& desc) -> ComPtr<ID3D11BlendState>
+        {
+            ComPtr<ID3D11BlendState> state;
+            HRESULT hr = device->CreateBlendState(&desc, state.GetAddressOf());
+            DXThrowIfFailed(hr, "failed to create D3D11 blend state");
+            return state;
+        }
+    );
+}
+
+void D3D11StatePool::ReleaseBlendState(ComPtr<ID3D11BlendState>&& blendState)
+{
+    ReleaseSharedStateObject(blendStates_, std::move(blendState));
+}
+
+#if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+
+ComPtr<ID3D11BlendState1> D3D11StatePool::CreateBlendState1(ID3D11Device1* device, const BlendDescriptor& blendDesc)
+{
+    auto descDX = MakeZeroedDesc<D3D11_BLEND_DESC1>();
+    D3D11Types::Convert(descDX, blendDesc);
+    return CreateSharedStateObject(
+        blendStates1_,
+        descDX,
+        [device](const D3D11_BLEND_DESC1& desc) -> ComPtr<ID3D11BlendState1>
+        {
+            ComPtr<ID3D11BlendState1> state;
+            HRESULT hr = device->CreateBlendState1(&desc, state.GetAddressOf());
+            DXThrowIfFailed(hr, "failed to create D3D11 blend state");
+            return state;
+        }
+    );
+}
+
+void D3D11StatePool::ReleaseBlendState(ComPtr<ID3D11BlendState1>&& blendState)
+{
+    ReleaseSharedStateObject(blendStates1_, std::move(blendState));
+}
+
+#endif // /LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+
+/* ----- Sampler states ----- */
+
+ComPtr<ID3D11SamplerState> D3D11StatePool::CreateSamplerState(ID3D11Device* device, const SamplerDescriptor& samplerDesc)
+{
+    auto descDX = MakeZeroedDesc<D3D11_SAMPLER_DESC>();
+    D3D11Sampler::ConvertDesc(descDX, samplerDesc);
+    return CreateSharedStateObject(
+        samplerStates_,
+        descDX,
+        [device](const D3D11_SAMPLER_DESC& desc) -> ComPtr<ID3D11SamplerState>
+        {
+            ComPtr<ID3D11SamplerState> state;
+            HRESULT hr = device->CreateSamplerState(&desc, state.GetAddressOf());
+            DXThrowIfCreateFailed(hr, "ID3D11SamplerState");
+            return state;
+        }
+    );
+}
+
+void D3D11StatePool::ReleaseSamplerState(ComPtr<ID3D11SamplerState>&& samplerState)
+{
+    ReleaseSharedStateObject(samplerStates_, std::move(samplerState));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,115 @@
+/*
+ * D3D11StatePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D11_STATE_POOL_H
+#define LLGL_D3D11_STATE_POOL_H
+
+
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/SamplerFlags.h>
+#include "../../DXCommon/ComPtr.h"
+#include <d3d11.h>
+#include <vector>
+#include <cstdint>
+
+#if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+#   include <d3d11_1.h>
+#endif
+
+#if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+#   include <d3d11_3.h>
+#endif
+
+
+namespace LLGL
+{
+
+
+// Entry of a shared D3D11 state object. The native descriptor is the key to find identical state objects.
+template <typename TDesc, typename TState>
+struct D3D11StatePoolEntry
+{
+    TDesc           desc;
+    ComPtr<TState>  state;
+    std::uint32_t   refCount;
+};
+
+/*
+Pool for immutable D3D11 state objects, i.e. depth-stencil-, rasterizer-, blend-, and static sampler states.
+Identical states across all PSOs and pipeline layouts of a render system share the same native object.
+Each Create* function increments the reference counter of the shared state and each Release* function decrements it.
+*/
+class D3D11StatePool
+{
+
+    public:
+
+        D3D11StatePool() = default;
+
+        D3D11StatePool(const D3D11StatePool&) = delete;
+        D3D11StatePool& operator = (const D3D11StatePool&) = delete;
+
+        // Clear all resource containers of this pool.
+        void Clear();
+
+        /* ----- Depth-stencil states ----- */
+
+        ComPtr<ID3D11DepthStencilState> CreateDepthStencilState(ID3D11Device* device, const DepthDescriptor& depthDesc, const StencilDescriptor& stencilDesc);
+        void ReleaseDepthStencilState(ComPtr<ID3D11DepthStencilState>&& depthStencilState);
+
+        /* ----- Rasterizer states ----- */
+
+        ComPtr<ID3D11RasterizerState> CreateRasterizerState(ID3D11Device* device, const RasterizerDescriptor& rasterizerDesc);
+        void ReleaseRasterizerState(ComPtr<ID3D11RasterizerState>&& rasterizerState);
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+        ComPtr<ID3D11RasterizerState2> CreateRasterizerState2(ID3D11Device3* device, const RasterizerDescriptor& rasterizerDesc);
+        void ReleaseRasterizerState(ComPtr<ID3D11RasterizerState2>&& rasterizerState);
+        #endif
+
+        /* ----- Blend states ----- */
+
+        ComPtr<ID3D11BlendState> CreateBlendState(ID3D11Device* device, const BlendDescriptor& blendDesc);
+        void ReleaseBlendState(ComPtr<ID3D11BlendState>&& blendState);
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+        ComPtr<ID3D11BlendState1> CreateBlendState1(ID3D11Device1* device, const BlendDescriptor& blendDesc);
+        void ReleaseBlendState(ComPtr<ID3D11BlendState1>&& blendState);
+        #endif
+
+        /* ----- Sampler states ----- */
+
+        // Creates a shared sampler state. This is only used for static samplers, since sampler objects created by the client have their own debug name.
+        ComPtr<ID3D11SamplerState> CreateSamplerState(ID3D11Device* device, const SamplerDescriptor& samplerDesc);
+        void ReleaseSamplerState(ComPtr<ID3D11SamplerState>&& samplerState);
+
+    private:
+
+        std::vector<D3D11StatePoolEntry<D3D11_DEPTH_STENCIL_DESC, ID3D11DepthStencilState>> depthStencilStates_;
+        std::vector<D3D11StatePoolEntry<D3D11_RASTERIZER_DESC, ID3D11RasterizerState>>      rasterizerStates_;
+        std::vector<D3D11StatePoolEntry<D3D11_BLEND_DESC, ID3D11BlendState>>                blendStates_;
+        std::vector<D3D11StatePoolEntry<D3D11_SAMPLER_DESC, ID3D11SamplerState>>            samplerStates_;
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 1
+        std::vector<D3D11StatePoolEntry<D3D11_BLEND_DESC1, ID3D11BlendState1>>              blendStates1_;
+        #endif
+
+        #if LLGL_D3D11_ENABLE_FEATURELEVEL >= 3
+        std::vector<D3D11StatePoolEntry<D3D11_RASTERIZER_DESC2, ID3D11RasterizerState2>>    rasterizerStates2_;
+        #endif
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
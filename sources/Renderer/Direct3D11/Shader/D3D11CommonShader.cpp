@@ -12,10 +12,10 @@ namespace LLGL
 {
 
 
-D3D11CommonShader::D3D11CommonShader(ID3D11Device* device, const ShaderDescriptor& desc) :
-    D3D11Shader { desc.type }
+D3D11CommonShader::D3D11CommonShader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache) :
+    D3D11Shader { desc }
 {
-    BuildShader(device, desc);
+    BuildShader(device, desc, shaderCache);
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
 }
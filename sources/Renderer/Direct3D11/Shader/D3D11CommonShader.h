@@ -21,7 +21,7 @@ class D3D11CommonShader final : public D3D11Shader
 
     public:
 
-        D3D11CommonShader(ID3D11Device* device, const ShaderDescriptor& desc);
+        D3D11CommonShader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache = nullptr);
 
 };
 
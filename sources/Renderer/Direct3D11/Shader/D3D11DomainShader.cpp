@@ -12,10 +12,10 @@ namespace LLGL
 {
 
 
-D3D11DomainShader::D3D11DomainShader(ID3D11Device* device, const ShaderDescriptor& desc) :
-    D3D11Shader { desc.type }
+D3D11DomainShader::D3D11DomainShader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache) :
+    D3D11Shader { desc }
 {
-    if (BuildShader(device, desc))
+    if (BuildShader(device, desc, shaderCache))
     {
         /* Build optional proxy geometry shader if there are any output attributes */
         if (!desc.vertex.outputAttribs.empty())
@@ -23,7 +23,7 @@ class D3D11DomainShader final : public D3D11Shader
 
     public:
 
-        D3D11DomainShader(ID3D11Device* device, const ShaderDescriptor& desc);
+        D3D11DomainShader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache = nullptr);
 
         // Returns the proxy geometry shader for stream-output if there is one.
         inline const ComPtr<ID3D11GeometryShader>& GetProxyGeometryShader() const
@@ -9,10 +9,12 @@
 #include "../D3D11Types.h"
 #include "../D3D11ObjectUtils.h"
 #include "../../DXCommon/DXShaderReflection.h"
+#include "../../ShaderCache.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/StringUtils.h"
 #include "../../../Core/ReportUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Platform/MappedFile.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
@@ -23,8 +25,8 @@ namespace LLGL
 {
 
 
-D3D11Shader::D3D11Shader(const ShaderType type) :
-    Shader { type }
+D3D11Shader::D3D11Shader(const ShaderDescriptor& desc) :
+    Shader { desc }
 {
 }
 
@@ -41,6 +43,9 @@ const Report* D3D11Shader::GetReport() const
 
 bool D3D11Shader::Reflect(ShaderReflection& reflection) const
 {
+    if (GetSerializedReflection(reflection))
+        return true;
+
     if (byteCode_)
         return SUCCEEDED(ReflectShaderByteCode(reflection));
     else
@@ -70,10 +75,10 @@ HRESULT D3D11Shader::ReflectAndCacheConstantBuffers(const std::vector<D3D11Const
  * ======= Protected: =======
  */
 
-bool D3D11Shader::BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc)
+bool D3D11Shader::BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache)
 {
     if (IsShaderSourceCode(shaderDesc.sourceType))
-        return CompileSource(device, shaderDesc);
+        return CompileSource(device, shaderDesc, shaderCache);
     else
         return LoadBinary(device, shaderDesc);
 }
@@ -119,7 +124,7 @@ static void ConvertSODeclEntry(D3D11_SO_DECLARATION_ENTRY& dst, const VertexAttr
 }
 
 // see https://msdn.microsoft.com/en-us/library/windows/desktop/dd607324(v=vs.85).aspx
-bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc)
+bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache)
 {
     /* Get source code */
     std::string fileContent;
@@ -147,6 +152,20 @@ bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& sh
     auto*       defines = reinterpret_cast<const D3D_SHADER_MACRO*>(shaderDesc.defines);
     long        flags   = shaderDesc.flags;
 
+    /* Look up byte code in persistent shader cache before invoking the compiler */
+    std::uint64_t cacheKey = 0;
+    if (shaderCache != nullptr)
+    {
+        cacheKey = ShaderCache::GetKey("FXC", D3D_COMPILER_VERSION, shaderDesc, sourceCode, sourceLength);
+        const Blob cachedByteCode = shaderCache->Read(cacheKey);
+        if (cachedByteCode)
+        {
+            byteCode_ = DXCreateBlob(cachedByteCode.GetData(), cachedByteCode.GetSize());
+            CreateNativeShader(device, shaderDesc.vertex.outputAttribs.size(), shaderDesc.vertex.outputAttribs.data());
+            return true;
+        }
+    }
+
     /* Compile shader code */
     ComPtr<ID3DBlob> errors;
     HRESULT hr = D3DCompile(
@@ -170,6 +189,10 @@ bool D3D11Shader::CompileSource(ID3D11Device* device, const ShaderDescriptor& sh
     /* Store if compilation was successful */
     const bool hasErrors = FAILED(hr);
     ResetReportWithNewline(report_, DXGetBlobString(errors.Get()), hasErrors);
+
+    if (shaderCache != nullptr && !hasErrors && byteCode_)
+        shaderCache->Write(cacheKey, byteCode_->GetBufferPointer(), byteCode_->GetBufferSize());
+
     return !hasErrors;
 }
 
@@ -178,7 +201,8 @@ bool D3D11Shader::LoadBinary(ID3D11Device* device, const ShaderDescriptor& shade
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
         /* Load binary code from file */
-        byteCode_ = DXCreateBlob(ReadFileBuffer(shaderDesc.source));
+        if (std::unique_ptr<MappedFile> mappedFile = MappedFile::Open(shaderDesc.source))
+            byteCode_ = DXCreateBlob(mappedFile->GetData(), mappedFile->GetSize());
     }
     else
     {
@@ -24,6 +24,8 @@ namespace LLGL
 {
 
 
+class ShaderCache;
+
 struct D3D11ConstantReflection
 {
     std::string name;   // Name of the constant buffer field.
@@ -51,7 +53,7 @@ class D3D11Shader : public Shader
 
     public:
 
-        D3D11Shader(const ShaderType type);
+        D3D11Shader(const ShaderDescriptor& desc);
 
         // Returns a list of all reflected constant buffers including their fields.
         HRESULT ReflectAndCacheConstantBuffers(const std::vector<D3D11ConstantBufferReflection>** outConstantBuffers);
@@ -83,12 +85,12 @@ class D3D11Shader : public Shader
 
     protected:
 
-        bool BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
+        bool BuildShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache = nullptr);
         bool BuildProxyGeometryShader(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ComPtr<ID3D11GeometryShader>& outProxyGeomtryShader);
 
     private:
 
-        bool CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
+        bool CompileSource(ID3D11Device* device, const ShaderDescriptor& shaderDesc, ShaderCache* shaderCache);
         bool LoadBinary(ID3D11Device* device, const ShaderDescriptor& shaderDesc);
 
         void CreateNativeShader(
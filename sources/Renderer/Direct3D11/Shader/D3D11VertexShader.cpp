@@ -16,10 +16,10 @@ namespace LLGL
 {
 
 
-D3D11VertexShader::D3D11VertexShader(ID3D11Device* device, const ShaderDescriptor& desc) :
-    D3D11Shader { desc.type }
+D3D11VertexShader::D3D11VertexShader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache) :
+    D3D11Shader { desc }
 {
-    if (BuildShader(device, desc))
+    if (BuildShader(device, desc, shaderCache))
     {
         /* Build input layout object for vertex shaders */
         BuildInputLayout(device, static_cast<UINT>(desc.vertex.inputAttribs.size()), desc.vertex.inputAttribs.data());
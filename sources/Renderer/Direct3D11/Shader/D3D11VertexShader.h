@@ -23,7 +23,7 @@ class D3D11VertexShader final : public D3D11Shader
 
     public:
 
-        D3D11VertexShader(ID3D11Device* device, const ShaderDescriptor& desc);
+        D3D11VertexShader(ID3D11Device* device, const ShaderDescriptor& desc, ShaderCache* shaderCache = nullptr);
 
         // Returns the input layout for vertex shaders.
         inline const ComPtr<ID3D11InputLayout>& GetInputLayout() const
@@ -14,6 +14,7 @@
 #include "../../TextureUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../FormatTable.h"
 #include <LLGL/Format.h>
 #include <LLGL/Backend/Direct3D11/NativeHandle.h>
 #include <LLGL/Utils/ForRange.h>
@@ -269,7 +270,7 @@ HRESULT D3D11Texture::UpdateSubresource(
 {
     /* Check if source image must be converted */
     Format format = GetBaseFormat();
-    const auto& formatAttribs = GetFormatAttribs(format);
+    const auto& formatAttribs = FormatTable::GetAttribs(format);
 
     /* Get destination subresource index */
     const Extent3D extent
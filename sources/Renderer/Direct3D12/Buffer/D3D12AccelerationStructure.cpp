@@ -0,0 +1,118 @@
+/*
+ * D3D12AccelerationStructure.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12AccelerationStructure.h"
+#include "D3D12Buffer.h"
+#include "../../DXCommon/DXTypes.h"
+#include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+#include <cstring>
+
+
+#if LLGL_D3D12_ENABLE_RAYTRACING
+
+namespace LLGL
+{
+
+
+static D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS GetD3DAccelerationStructureBuildFlags(long flags)
+{
+    UINT flagsD3D = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_NONE;
+
+    if ((flags & AccelerationStructureFlags::AllowUpdate) != 0)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE;
+    if ((flags & AccelerationStructureFlags::PreferFastTrace) != 0)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE;
+    if ((flags & AccelerationStructureFlags::PreferFastBuild) != 0)
+        flagsD3D |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_BUILD;
+
+    return static_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS>(flagsD3D);
+}
+
+static D3D12_GPU_VIRTUAL_ADDRESS GetD3DBufferAddress(Buffer* buffer, std::uint64_t offset)
+{
+    if (buffer != nullptr)
+    {
+        auto* bufferD3D = LLGL_CAST(D3D12Buffer*, buffer);
+        return bufferD3D->GetNative()->GetGPUVirtualAddress() + offset;
+    }
+    return 0;
+}
+
+static void ConvertD3DGeometryDesc(D3D12_RAYTRACING_GEOMETRY_DESC& dst, const AccelerationStructureGeometryDescriptor& src, bool resolveBuffers)
+{
+    dst.Type                                    = D3D12_RAYTRACING_GEOMETRY_TYPE_TRIANGLES;
+    dst.Flags                                   = (src.opaque ? D3D12_RAYTRACING_GEOMETRY_FLAG_OPAQUE : D3D12_RAYTRACING_GEOMETRY_FLAG_NONE);
+    dst.Triangles.Transform3x4                  = 0;
+    dst.Triangles.VertexFormat                  = DXTypes::ToDXGIFormat(src.vertexFormat);
+    dst.Triangles.VertexCount                   = src.numVertices;
+    dst.Triangles.VertexBuffer.StartAddress     = (resolveBuffers ? GetD3DBufferAddress(src.vertexBuffer, src.vertexOffset) : 0);
+    dst.Triangles.VertexBuffer.StrideInBytes    = src.vertexStride;
+
+    if (src.indexBuffer != nullptr)
+    {
+        dst.Triangles.IndexFormat   = DXTypes::ToDXGIFormat(src.indexFormat);
+        dst.Triangles.IndexCount    = src.numIndices;
+        dst.Triangles.IndexBuffer   = (resolveBuffers ? GetD3DBufferAddress(src.indexBuffer, src.indexOffset) : 0);
+    }
+    else
+    {
+        dst.Triangles.IndexFormat   = DXGI_FORMAT_UNKNOWN;
+        dst.Triangles.IndexCount    = 0;
+        dst.Triangles.IndexBuffer   = 0;
+    }
+}
+
+D3D12AccelerationStructureInputs::D3D12AccelerationStructureInputs(
+    const AccelerationStructureDescriptor&  desc,
+    bool                                    resolveBuffers,
+    D3D12_GPU_VIRTUAL_ADDRESS               instanceDescs)
+{
+    inputs_.Flags       = GetD3DAccelerationStructureBuildFlags(desc.flags);
+    inputs_.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
+
+    if (desc.type == AccelerationStructureType::TopLevel)
+    {
+        inputs_.Type            = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL;
+        inputs_.NumDescs        = static_cast<UINT>(desc.instances.size());
+        inputs_.InstanceDescs   = instanceDescs;
+    }
+    else
+    {
+        /* Convert all triangle geometries */
+        geometryDescs_.resize(desc.geometries.size());
+        for_range(i, desc.geometries.size())
+            ConvertD3DGeometryDesc(geometryDescs_[i], desc.geometries[i], resolveBuffers);
+
+        inputs_.Type            = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL;
+        inputs_.NumDescs        = static_cast<UINT>(geometryDescs_.size());
+        inputs_.pGeometryDescs  = geometryDescs_.data();
+    }
+}
+
+void D3D12AccelerationStructureInputs::WriteInstanceDescs(D3D12_RAYTRACING_INSTANCE_DESC* dst, const ArrayView<AccelerationStructureInstance>& instances)
+{
+    for (const AccelerationStructureInstance& instance : instances)
+    {
+        ::memcpy(dst->Transform, instance.transform, sizeof(dst->Transform));
+        dst->InstanceID                             = (instance.instanceID & 0x00FFFFFFu);
+        dst->InstanceMask                           = (instance.mask & 0xFFu);
+        dst->InstanceContributionToHitGroupIndex    = (instance.hitGroupOffset & 0x00FFFFFFu);
+        dst->Flags                                  = D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
+        dst->AccelerationStructure                  = GetD3DBufferAddress(instance.accelerationStructure, 0);
+        ++dst;
+    }
+}
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
+
+
+// ================================================================================
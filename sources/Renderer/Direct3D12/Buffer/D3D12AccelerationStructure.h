@@ -0,0 +1,71 @@
+/*
+ * D3D12AccelerationStructure.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_ACCELERATION_STRUCTURE_H
+#define LLGL_D3D12_ACCELERATION_STRUCTURE_H
+
+
+#include <LLGL/BufferFlags.h>
+#include "../D3D12Types.h"
+#include <d3d12.h>
+#include <vector>
+
+
+#if LLGL_D3D12_ENABLE_RAYTRACING
+
+namespace LLGL
+{
+
+
+/*
+Helper class to convert an acceleration structure descriptor into the D3D12 build inputs.
+The native geometry descriptors are stored in this object, so it must outlive the inputs that are returned by GetNative().
+*/
+class D3D12AccelerationStructureInputs
+{
+
+    public:
+
+        /*
+        Converts the specified descriptor. If 'resolveBuffers' is false, the buffers of the descriptor are not accessed,
+        which is sufficient for ID3D12Device5::GetRaytracingAccelerationStructurePrebuildInfo.
+        */
+        D3D12AccelerationStructureInputs(
+            const AccelerationStructureDescriptor&  desc,
+            bool                                    resolveBuffers,
+            D3D12_GPU_VIRTUAL_ADDRESS               instanceDescs   = 0
+        );
+
+        // Returns the native build inputs.
+        inline const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& GetNative() const
+        {
+            return inputs_;
+        }
+
+    public:
+
+        // Writes the native instance descriptors of a top-level acceleration structure into 'dst', which must have room for 'instances.size()' entries.
+        static void WriteInstanceDescs(D3D12_RAYTRACING_INSTANCE_DESC* dst, const ArrayView<AccelerationStructureInstance>& instances);
+
+    private:
+
+        D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS    inputs_         = {};
+        std::vector<D3D12_RAYTRACING_GEOMETRY_DESC>             geometryDescs_;
+
+};
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
+
+#endif
+
+
+
+// ================================================================================
@@ -35,7 +35,7 @@ static DXGI_FORMAT GetDXFormatForBuffer(const BufferDescriptor& desc)
     return (IsStructuredBuffer(desc) ? DXGI_FORMAT_UNKNOWN : DXTypes::ToDXGIFormat(desc.format));
 }
 
-D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc) :
+D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc, D3D12_HEAP_TYPE heapType, HANDLE importHandle) :
     Buffer  { desc.bindFlags             },
     format_ { GetDXFormatForBuffer(desc) }
 {
@@ -44,7 +44,7 @@ D3D12Buffer::D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc) :
         alignment_ = g_cBufferAlignment;
 
     /* Create native buffer resource */
-    CreateGpuBuffer(device, desc);
+    CreateGpuBuffer(device, desc, heapType, importHandle);
 
     /* Create sub-resource views */
     if ((desc.bindFlags & BindFlags::VertexBuffer) != 0)
@@ -130,11 +130,19 @@ void D3D12Buffer::CreateConstantBufferViewPrimary(
 
 void D3D12Buffer::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
 {
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    if ((GetBindFlags() & BindFlags::AccelerationStructure) != 0)
+        return CreateAccelerationStructureView(device, cpuDescHandle);
+    #endif
     CreateShaderResourceViewPrimary(device, cpuDescHandle, 0, static_cast<UINT>(GetBufferSize() / stride_), stride_, format_);
 }
 
 void D3D12Buffer::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const BufferViewDescriptor& bufferViewDesc)
 {
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    if ((GetBindFlags() & BindFlags::AccelerationStructure) != 0)
+        return CreateAccelerationStructureView(device, cpuDescHandle);
+    #endif
     const UINT      stride          = GetStrideForView(bufferViewDesc.format);
     const UINT64    firstElement    = bufferViewDesc.offset / stride;
     const UINT      numElements     = static_cast<UINT>(std::min(bufferViewDesc.size, GetBufferSize()) / stride);
@@ -164,6 +172,24 @@ void D3D12Buffer::CreateShaderResourceViewPrimary(
     device->CreateShaderResourceView(GetNative(), &srvDesc, cpuDescHandle);
 }
 
+#if LLGL_D3D12_ENABLE_RAYTRACING
+
+//private
+void D3D12Buffer::CreateAccelerationStructureView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
+{
+    /* Acceleration structure SRVs are specified by their GPU address only, the resource must be null */
+    D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc;
+    {
+        srvDesc.Format                                      = DXGI_FORMAT_UNKNOWN;
+        srvDesc.ViewDimension                               = D3D12_SRV_DIMENSION_RAYTRACING_ACCELERATION_STRUCTURE;
+        srvDesc.Shader4ComponentMapping                     = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+        srvDesc.RaytracingAccelerationStructure.Location    = GetNative()->GetGPUVirtualAddress();
+    }
+    device->CreateShaderResourceView(nullptr, &srvDesc, cpuDescHandle);
+}
+
+#endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
 void D3D12Buffer::CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
 {
     CreateUnorderedAccessViewPrimary(device, cpuDescHandle, 0, static_cast<UINT>(GetBufferSize() / stride_), stride_, format_);
@@ -236,7 +262,7 @@ void D3D12Buffer::ClearSubresourceUInt(
     commandContext.SetStagingDescriptorHeaps(newLayout, {});
     //D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = uavIntermediateDescHeap_->GetGPUDescriptorHandleForHeapStart();
     D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = uavIntermediateDescHeap_->GetCPUDescriptorHandleForHeapStart();
-    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext.CopyDescriptorsForStaging(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, cpuDescHandle, 0, 1);
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext.CopyDescriptorsForStaging(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, cpuDescHandle, 1);
 
     if (useIntermediateBuffer)
     {
@@ -309,7 +335,19 @@ HRESULT D3D12Buffer::Map(
     mappedRange_        = range;
     mappedCPUaccess_    = access;
 
-    if (access == CPUAccess::ReadWrite)
+    if (IsReadback() || IsGPUUpload())
+    {
+        /*
+        Map readback and GPU upload heaps directly without an intermediate copy.
+        The GPU must have finished accessing the mapped range, which is synchronized by the client.
+        */
+        const D3D12_RANGE readRange = (HasReadAccess(access) ? range : D3D12_RANGE{ 0, 0 });
+        HRESULT hr = resource_.native->Map(0, &readRange, mappedData);
+        if (SUCCEEDED(hr) && *mappedData != nullptr)
+            *mappedData = static_cast<char*>(*mappedData) + range.Begin;
+        return hr;
+    }
+    else if (access == CPUAccess::ReadWrite)
     {
         /* First map write access buffer */
         SIZE_T rangeSize = range.End - range.Begin;
@@ -347,12 +385,34 @@ void D3D12Buffer::Unmap(
     D3D12CommandQueue&      commandQueue,
     D3D12StagingBufferPool& stagingBufferPool)
 {
-    if (HasWriteAccess(mappedCPUaccess_))
+    if (IsReadback() || IsGPUUpload())
+    {
+        /* Readback heaps are never written by the CPU, so only report the written range for GPU upload heaps */
+        const D3D12_RANGE writtenRange = (HasWriteAccess(mappedCPUaccess_) ? mappedRange_ : D3D12_RANGE{ 0, 0 });
+        resource_.native->Unmap(0, &writtenRange);
+    }
+    else if (HasWriteAccess(mappedCPUaccess_))
         stagingBufferPool.UnmapUploadBuffer(commandContext, commandQueue, resource_, mappedRange_, mappedBufferTicket_);
     else
         stagingBufferPool.UnmapFeedbackBuffer(mappedBufferTicket_);
 }
 
+void D3D12Buffer::WriteMappedMemory(UINT64 offset, const void* data, UINT64 dataSize)
+{
+    LLGL_ASSERT(IsGPUUpload());
+
+    /* Write the data straight into video memory; the CPU never reads from this mapping */
+    const D3D12_RANGE readRange{ 0, 0 };
+    void* mappedData = nullptr;
+    HRESULT hr = resource_.native->Map(0, &readRange, &mappedData);
+    DXThrowIfFailed(hr, "failed to map D3D12 buffer in GPU upload heap");
+
+    ::memcpy(static_cast<char*>(mappedData) + offset, data, static_cast<std::size_t>(dataSize));
+
+    const D3D12_RANGE writtenRange{ static_cast<SIZE_T>(offset), static_cast<SIZE_T>(offset + dataSize) };
+    resource_.native->Unmap(0, &writtenRange);
+}
+
 
 /*
  * ======= Protected: =======
@@ -362,7 +422,7 @@ static D3D12_RESOURCE_FLAGS GetD3DResourceFlags(const BufferDescriptor& desc)
 {
     UINT flags = 0;
 
-    if ((desc.bindFlags & BindFlags::Storage) != 0)
+    if ((desc.bindFlags & (BindFlags::Storage | BindFlags::AccelerationStructure)) != 0)
         flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
 
     return static_cast<D3D12_RESOURCE_FLAGS>(flags);
@@ -376,6 +436,8 @@ static D3D12_RESOURCE_STATES GetD3DUsageState(long bindFlags)
         flagsD3D |= D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
     if ((bindFlags & BindFlags::IndexBuffer) != 0)
         flagsD3D |= D3D12_RESOURCE_STATE_INDEX_BUFFER;
+    if ((bindFlags & BindFlags::ComputeStreamOutput) != 0)
+        flagsD3D |= D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT;
 
     if (flagsD3D == 0)
     {
@@ -393,7 +455,7 @@ static D3D12_RESOURCE_STATES GetD3DUsageState(long bindFlags)
 }
 
 // see https://docs.microsoft.com/en-us/windows/desktop/api/d3d12/nf-d3d12-id3d12device-createcommittedresource
-void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc)
+void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc, D3D12_HEAP_TYPE heapType, HANDLE importHandle)
 {
     /* Store buffer attributes */
     bufferSize_ = GetAlignedSize<UINT64>(desc.size, alignment_);
@@ -409,18 +471,68 @@ void D3D12Buffer::CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor&
         internalSize_ = bufferSize_;
 
     /* Store buffer primary usage stage */
-    resource_.usageState = GetD3DUsageState(desc.bindFlags);
+    heapType_ = heapType;
+    D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COMMON; // Buffers are effectively created in D3D12_RESOURCE_STATE_COMMON state
+    if (heapType == D3D12_HEAP_TYPE_UPLOAD)
+    {
+        /* Resources in upload heaps must be created in and remain in D3D12_RESOURCE_STATE_GENERIC_READ state */
+        initialState = D3D12_RESOURCE_STATE_GENERIC_READ;
+        resource_.SetInitialState(initialState);
+        resource_.isStateFixed = true;
+    }
+    else if (heapType == D3D12_HEAP_TYPE_READBACK)
+    {
+        /* Resources in readback heaps must be created in and remain in D3D12_RESOURCE_STATE_COPY_DEST state */
+        initialState = D3D12_RESOURCE_STATE_COPY_DEST;
+        resource_.SetInitialState(initialState);
+        resource_.isStateFixed = true;
+    }
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    else if ((desc.bindFlags & BindFlags::AccelerationStructure) != 0)
+    {
+        /* Acceleration structures must be created in and remain in D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE state */
+        initialState = D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
+        resource_.SetInitialState(initialState);
+        resource_.isStateFixed = true;
+    }
+    #endif // /LLGL_D3D12_ENABLE_RAYTRACING
+    else
+        resource_.usageState = GetD3DUsageState(desc.bindFlags);
+
+    if (importHandle != nullptr)
+    {
+        /* Open shared buffer resource of another device or process */
+        HRESULT hr = device->OpenSharedHandle(importHandle, IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf()));
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 imported shared buffer");
+        return;
+    }
 
     /* Create generic buffer resource */
-    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
     const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetInternalBufferSize(), GetD3DResourceFlags(desc));
-    HRESULT hr = device->CreateCommittedResource(
-        &heapProperties,
-        D3D12_HEAP_FLAG_NONE,
-        &bufferDesc,
-        D3D12_RESOURCE_STATE_COMMON, // Buffers are effectively created in D3D12_RESOURCE_STATE_COMMON state
+    if ((desc.miscFlags & MiscFlags::Shared) != 0 && heapType == D3D12_HEAP_TYPE_DEFAULT)
+    {
+        /* Create committed resource in its own shared heap, since the entire heap is exported */
+        const CD3DX12_HEAP_PROPERTIES heapProperties{ heapType };
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProperties,
+            D3D12_HEAP_FLAG_SHARED,
+            &bufferDesc,
+            initialState,
+            nullptr,
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 shared buffer");
+        return;
+    }
+
+    HRESULT hr = D3D12MemoryAllocator::Get().CreateResource(
+        device,
+        heapType,
+        bufferDesc,
+        initialState,
         nullptr,
-        IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        resource_.native,
+        allocation_
     );
     DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware buffer");
 }
@@ -467,15 +579,15 @@ void D3D12Buffer::CreateIntermediateUAVBuffer()
     resource_.Get()->GetDevice(IID_PPV_ARGS(&device));
 
     /* Create intermediate resource with UAV support */
-    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
     const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(GetInternalBufferSize(), D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
-    HRESULT hr = device->CreateCommittedResource(
-        &heapProperties,
-        D3D12_HEAP_FLAG_NONE,
-        &bufferDesc,
+    HRESULT hr = D3D12MemoryAllocator::Get().CreateResource(
+        device.Get(),
+        D3D12_HEAP_TYPE_DEFAULT,
+        bufferDesc,
         D3D12_RESOURCE_STATE_COMMON, // Buffers are effectively created in D3D12_RESOURCE_STATE_COMMON state
         nullptr,
-        IID_PPV_ARGS(uavIntermediateBuffer_.native.ReleaseAndGetAddressOf())
+        uavIntermediateBuffer_.native,
+        uavIntermediateAllocation_
     );
     DXThrowIfCreateFailed(hr, "ID3D12Resource", "for buffer subresource UAV");
 }
@@ -13,11 +13,21 @@
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/Container/DynamicArray.h>
 #include "../D3D12Resource.h"
+#include "../D3D12MemoryAllocator.h"
+#include "../D3D12Types.h"
 #include "D3D12StagingBufferPool.h"
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
 
 
+// GPU upload heaps (D3D12_HEAP_TYPE_GPU_UPLOAD) are only available with newer Windows SDKs.
+#if defined __ID3D12Device13_INTERFACE_DEFINED__
+#   define LLGL_D3D12_ENABLE_GPU_UPLOAD_HEAP 1
+#else
+#   define LLGL_D3D12_ENABLE_GPU_UPLOAD_HEAP 0
+#endif
+
+
 namespace LLGL
 {
 
@@ -39,7 +49,13 @@ class D3D12Buffer : public Buffer
 
     public:
 
-        D3D12Buffer(ID3D12Device* device, const BufferDescriptor& desc);
+        // Creates a buffer resource. Buffers with MiscFlags::Shared are created in their own shared heap, or opened from 'importHandle' if it is non-null.
+        D3D12Buffer(
+            ID3D12Device*           device,
+            const BufferDescriptor& desc,
+            D3D12_HEAP_TYPE         heapType        = D3D12_HEAP_TYPE_DEFAULT,
+            HANDLE                  importHandle    = nullptr
+        );
 
         // Creates a resource views within the native buffer object:
         void CreateConstantBufferView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
@@ -153,9 +169,34 @@ class D3D12Buffer : public Buffer
             return format_;
         }
 
+        // Returns the heap type this buffer was allocated in.
+        inline D3D12_HEAP_TYPE GetHeapType() const
+        {
+            return heapType_;
+        }
+
+        // Returns true if this buffer was allocated in the readback heap (D3D12_HEAP_TYPE_READBACK), i.e. it can be mapped directly for read access.
+        inline bool IsReadback() const
+        {
+            return (heapType_ == D3D12_HEAP_TYPE_READBACK);
+        }
+
+        // Returns true if this buffer was allocated in a GPU upload heap (D3D12_HEAP_TYPE_GPU_UPLOAD), i.e. it resides in video memory and can be mapped directly.
+        inline bool IsGPUUpload() const
+        {
+            #if LLGL_D3D12_ENABLE_GPU_UPLOAD_HEAP
+            return (heapType_ == D3D12_HEAP_TYPE_GPU_UPLOAD);
+            #else
+            return false;
+            #endif
+        }
+
+        // Writes the specified data directly into the mapped memory of this buffer. Only valid for buffers in a GPU upload heap.
+        void WriteMappedMemory(UINT64 offset, const void* data, UINT64 dataSize);
+
     private:
 
-        void CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc);
+        void CreateGpuBuffer(ID3D12Device* device, const BufferDescriptor& desc, D3D12_HEAP_TYPE heapType, HANDLE importHandle);
 
         void CreateIntermediateUAVDescriptorHeap(ID3D12Resource* resource, DXGI_FORMAT format, UINT formatStride);
         void CreateIntermediateUAVBuffer();
@@ -180,6 +221,10 @@ class D3D12Buffer : public Buffer
             DXGI_FORMAT                 format
         );
 
+        #if LLGL_D3D12_ENABLE_RAYTRACING
+        void CreateAccelerationStructureView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
+        #endif
+
         void CreateUnorderedAccessViewPrimary(
             ID3D12Device*               device,
             D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle,
@@ -209,9 +254,11 @@ class D3D12Buffer : public Buffer
 
     private:
 
+        D3D12MemoryAllocation                   allocation_;                // Must be declared before resource_ to outlive it
         D3D12Resource                           resource_;
 
         ComPtr<ID3D12DescriptorHeap>            uavIntermediateDescHeap_;
+        D3D12MemoryAllocation                   uavIntermediateAllocation_; // Must be declared before uavIntermediateBuffer_ to outlive it
         D3D12Resource                           uavIntermediateBuffer_;
 
         UINT64                                  bufferSize_                 = 0;
@@ -219,6 +266,7 @@ class D3D12Buffer : public Buffer
         UINT                                    alignment_                  = 1;
         UINT                                    stride_                     = 1;
         DXGI_FORMAT                             format_                     = DXGI_FORMAT_UNKNOWN;
+        D3D12_HEAP_TYPE                         heapType_                   = D3D12_HEAP_TYPE_DEFAULT;
 
         D3D12_VERTEX_BUFFER_VIEW                vertexBufferView_           = {};
         D3D12_INDEX_BUFFER_VIEW                 indexBufferView_            = {};
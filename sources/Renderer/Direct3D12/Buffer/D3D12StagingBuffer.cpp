@@ -26,9 +26,10 @@ D3D12StagingBuffer::D3D12StagingBuffer(
 }
 
 D3D12StagingBuffer::D3D12StagingBuffer(D3D12StagingBuffer&& rhs) noexcept :
-    native_ { std::move(rhs.native_) },
-    size_   { rhs.size_              },
-    offset_ { rhs.offset_            }
+    allocation_ { std::move(rhs.allocation_) },
+    native_     { std::move(rhs.native_)     },
+    size_       { rhs.size_                  },
+    offset_     { rhs.offset_                }
 {
 }
 
@@ -36,9 +37,11 @@ D3D12StagingBuffer& D3D12StagingBuffer::operator = (D3D12StagingBuffer&& rhs) no
 {
     if (this != &rhs)
     {
-        native_ = std::move(rhs.native_);
-        size_   = rhs.size_;
-        offset_ = rhs.offset_;
+        /* Release resource before its memory range */
+        native_     = std::move(rhs.native_);
+        allocation_ = std::move(rhs.allocation_);
+        size_       = rhs.size_;
+        offset_     = rhs.offset_;
     }
     return *this;
 }
@@ -52,15 +55,15 @@ void D3D12StagingBuffer::Create(
     size = GetAlignedSize<UINT64>(size, alignment);
 
     /* Create GPU upload buffer */
-    const CD3DX12_HEAP_PROPERTIES heapProperties{ heapType };
     const CD3DX12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(size);
-    HRESULT hr = device->CreateCommittedResource(
-        &heapProperties,
-        D3D12_HEAP_FLAG_NONE,
-        &bufferDesc,
+    HRESULT hr = D3D12MemoryAllocator::Get().CreateResource(
+        device,
+        heapType,
+        bufferDesc,
         (heapType == D3D12_HEAP_TYPE_READBACK ? D3D12_RESOURCE_STATE_COPY_DEST : D3D12_RESOURCE_STATE_GENERIC_READ),
         nullptr,
-        IID_PPV_ARGS(native_.ReleaseAndGetAddressOf())
+        native_,
+        allocation_
     );
     DXThrowIfCreateFailed(hr, "ID3D12Resource", "for staging buffer");
 
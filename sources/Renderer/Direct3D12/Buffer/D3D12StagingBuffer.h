@@ -9,6 +9,7 @@
 #define LLGL_D3D12_STAGING_BUFFER_H
 
 
+#include "../D3D12MemoryAllocator.h"
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
 
@@ -94,9 +95,10 @@ class D3D12StagingBuffer
 
     private:
 
+        D3D12MemoryAllocation   allocation_;    // Must be declared before native_ to outlive it
         ComPtr<ID3D12Resource>  native_;
-        UINT64                  size_   = 0;
-        UINT64                  offset_ = 0;
+        UINT64                  size_       = 0;
+        UINT64                  offset_     = 0;
 
 };
 
@@ -9,6 +9,7 @@
 #include "../Command/D3D12CommandContext.h"
 #include "../Command/D3D12CommandQueue.h"
 #include "../D3D12Resource.h"
+#include "../../ProfileCounters.h"
 #include "../../../Core/CoreUtils.h"
 #include <algorithm>
 
@@ -58,6 +59,7 @@ HRESULT D3D12StagingBufferPool::WriteStaged(
         D3D12StagingBuffer& chunk = chunks_[chunkIdx_];
         hr = chunk.WriteAndIncrementOffset(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize);
     }
+    LLGL_PROFILE_COUNTER_ADD(stagingUploadBytes, dataSize);
     commandContext.TransitionResource(dstBuffer, oldResourceState);
     return hr;
 }
@@ -78,6 +80,7 @@ HRESULT D3D12StagingBufferPool::WriteImmediate(
         D3D12StagingBuffer& uploadBuffer = GetOrCreateCPUAccessBuffer(CPUAccessFlags::Write).GetUploadBufferAndGrow(dataSize, alignment);
         hr = uploadBuffer.Write(commandContext.GetCommandList(), dstBuffer.Get(), dstOffset, data, dataSize);
     }
+    LLGL_PROFILE_COUNTER_ADD(stagingUploadBytes, dataSize);
     commandContext.TransitionResource(dstBuffer, oldResourceState);
     return hr;
 }
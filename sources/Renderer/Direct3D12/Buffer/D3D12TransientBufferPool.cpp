@@ -0,0 +1,76 @@
+/*
+ * D3D12TransientBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12TransientBufferPool.h"
+#include "D3D12Buffer.h"
+
+
+namespace LLGL
+{
+
+
+/* Constant buffer views and root CBVs must be aligned to D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT (256 bytes) */
+D3D12TransientBufferPool::D3D12TransientBufferPool() :
+    TransientBufferPool { 0, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT }
+{
+}
+
+D3D12TransientBufferPool::~D3D12TransientBufferPool()
+{
+    ReleaseChunks();
+}
+
+void D3D12TransientBufferPool::InitializeDevice(ID3D12Device* device, UINT64 chunkSize)
+{
+    device_ = device;
+    SetChunkSize(chunkSize);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool D3D12TransientBufferPool::CreateChunk(std::uint64_t size, Chunk& outChunk)
+{
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName    = "LLGL.TransientBuffer";
+        bufferDesc.size         = size;
+        bufferDesc.bindFlags    = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::ConstantBuffer);
+    }
+    auto* bufferD3D = new D3D12Buffer{ device_, bufferDesc, D3D12_HEAP_TYPE_UPLOAD };
+
+    /* Map entire buffer persistently; upload heaps can remain mapped while the GPU reads from them */
+    const D3D12_RANGE readRange{ 0, 0 };
+    void* mappedData = nullptr;
+    if (FAILED(bufferD3D->GetNative()->Map(0, &readRange, &mappedData)))
+    {
+        delete bufferD3D;
+        return false;
+    }
+
+    outChunk.buffer     = bufferD3D;
+    outChunk.mappedData = static_cast<char*>(mappedData);
+    outChunk.size       = size;
+
+    return true;
+}
+
+void D3D12TransientBufferPool::ReleaseChunk(Chunk& chunk)
+{
+    auto* bufferD3D = static_cast<D3D12Buffer*>(chunk.buffer);
+    bufferD3D->GetNative()->Unmap(0, nullptr);
+    delete bufferD3D;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
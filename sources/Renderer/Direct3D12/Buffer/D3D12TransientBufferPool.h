@@ -0,0 +1,51 @@
+/*
+ * D3D12TransientBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_TRANSIENT_BUFFER_POOL_H
+#define LLGL_D3D12_TRANSIENT_BUFFER_POOL_H
+
+
+#include "../../TransientBufferPool.h"
+#include <d3d12.h>
+
+
+namespace LLGL
+{
+
+
+// Transient buffer pool whose chunks are D3D12Buffer objects in upload heaps.
+class D3D12TransientBufferPool final : public TransientBufferPool
+{
+
+    public:
+
+        D3D12TransientBufferPool();
+        ~D3D12TransientBufferPool();
+
+        // Initializes the device object and chunk size.
+        void InitializeDevice(ID3D12Device* device, UINT64 chunkSize);
+
+    private:
+
+        bool CreateChunk(std::uint64_t size, Chunk& outChunk) override;
+        void ReleaseChunk(Chunk& chunk) override;
+
+    private:
+
+        ID3D12Device* device_ = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -14,12 +14,16 @@
 #include "../../TextureUtils.h"
 #include "../../DXCommon/DXTypes.h"
 #include "../../CheckedCast.h"
+#include "../../CommandBufferUtils.h"
+#include "../../BufferUtils.h"
+#include "../../SubmissionThread.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/CompilerExtensions.h"
 
 #include "../Buffer/D3D12Buffer.h"
 #include "../Buffer/D3D12BufferArray.h"
 #include "../Buffer/D3D12BufferConstantsPool.h"
+#include "../Buffer/D3D12AccelerationStructure.h"
 
 #include "../Texture/D3D12Texture.h"
 #include "../Texture/D3D12RenderTarget.h"
@@ -30,14 +34,17 @@
 #include "../RenderState/D3D12QueryHeap.h"
 #include "../RenderState/D3D12GraphicsPSO.h"
 #include "../RenderState/D3D12ComputePSO.h"
+#include "../RenderState/D3D12RayTracingPSO.h"
 
 #include "../Shader/D3D12BuiltinShaderFactory.h"
 
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 
 #include "../D3DX12/d3dx12.h"
+#include "../../FrameArena.h"
 
 // Only include PIX if we build with MSVC as MSYS2 does not provide this header
 #ifdef _MSC_VER
@@ -51,11 +58,20 @@ namespace LLGL
 {
 
 
+// Returns the queue type a command buffer is submitted to. Bundles are always executed by a primary command buffer of the graphics queue.
+static CommandQueueType GetCommandQueueTypeForDesc(const CommandBufferDescriptor& desc)
+{
+    if ((desc.flags & CommandBufferFlags::Secondary) != 0)
+        return CommandQueueType::Graphics;
+    else
+        return desc.queueType;
+}
+
 D3D12CommandBuffer::D3D12CommandBuffer(D3D12RenderSystem& renderSystem, const CommandBufferDescriptor& desc) :
-    cmdSignatureFactory_ { &(renderSystem.GetSignatureFactory())                         },
-    isImmediateSubmit_   { ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)     },
-    isBundle_            { ((desc.flags & CommandBufferFlags::Secondary) != 0)           },
-    commandQueue_        { LLGL_CAST(D3D12CommandQueue*, renderSystem.GetCommandQueue()) }
+    cmdSignatureFactory_ { &(renderSystem.GetSignatureFactory())                                                         },
+    isImmediateSubmit_   { ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)                                     },
+    isBundle_            { ((desc.flags & CommandBufferFlags::Secondary) != 0)                                           },
+    commandQueue_        { LLGL_HOT_CAST(D3D12CommandQueue*, renderSystem.GetCommandQueue(GetCommandQueueTypeForDesc(desc))) }
 {
     CreateCommandContext(renderSystem, desc);
     if (desc.debugName != nullptr)
@@ -72,9 +88,16 @@ void D3D12CommandBuffer::SetDebugName(const char* name)
 
 void D3D12CommandBuffer::Begin()
 {
+    /* The command list of the previous recording must have been executed before it can be reset */
+    if (SubmissionThread* submissionThread = commandQueue_->GetSubmissionThread())
+        submissionThread->Wait(submissionTicket_);
+
     /* Reset bundle resource transitions before startinga new recording */
     bundleResourceTransitions_.clear();
 
+    /* Recycle scratch memory of the previous recording on this thread */
+    FrameArena::Get().Reset();
+
     /* Reset command list using the next command allocator */
     commandContext_.Reset(*commandQueue_);
 }
@@ -89,12 +112,16 @@ void D3D12CommandBuffer::End()
 
     /* Execute command list right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
-        commandQueue_->SubmitCommandContext(commandContext_);
+        submissionTicket_ = commandQueue_->SubmitImmediateCommandContext(commandContext_);
 }
 
 void D3D12CommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
-    auto& cmdBufferD3D = LLGL_CAST(D3D12CommandBuffer&, secondaryCommandBuffer);
+    /*
+    Bundles inherit the render targets of the primary command list and don't refer to any render pass object,
+    so they can be executed inside any render pass whose formats match the PSOs that were recorded into the bundle
+    */
+    auto& cmdBufferD3D = LLGL_HOT_CAST(D3D12CommandBuffer&, secondaryCommandBuffer);
     cmdBufferD3D.ExecuteBundle(commandContext_);
 }
 
@@ -106,10 +133,21 @@ void D3D12CommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
-    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, dstBuffer);
     commandContext_.UpdateSubresource(dstBufferD3D.GetResource(), dstOffset, data, dataSize);
 }
 
+TransientBufferAllocation D3D12CommandBuffer::AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment)
+{
+    TransientBufferAllocation allocation = commandContext_.AllocTransientBuffer(size, bindFlags, alignment);
+
+    /* Transient buffers have no vertex format, so the alignment of vertex allocations determines the vertex stride (see SetVertexBuffer) */
+    if ((bindFlags & BindFlags::VertexBuffer) != 0)
+        transientVertexStride_ = static_cast<UINT>(alignment);
+
+    return allocation;
+}
+
 void D3D12CommandBuffer::CopyBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
@@ -117,20 +155,38 @@ void D3D12CommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
-    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
-    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, srcBuffer);
-
-    const D3D12_RESOURCE_STATES oldDstBufferState = dstBufferD3D.GetResource().currentState;
-    const D3D12_RESOURCE_STATES oldSrcBufferState = srcBufferD3D.GetResource().currentState;
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, dstBuffer);
+    auto& srcBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, srcBuffer);
 
+    /* Transition resources into copy states; they are not transitioned back, since their next use will transition them lazily */
     commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
     commandContext_.TransitionResource(srcBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
     {
         commandContext_.FlushResourceBarriers();
         GetNative()->CopyBufferRegion(dstBufferD3D.GetNative(), dstOffset, srcBufferD3D.GetNative(), srcOffset, size);
     }
-    commandContext_.TransitionResource(dstBufferD3D.GetResource(), oldDstBufferState);
-    commandContext_.TransitionResource(srcBufferD3D.GetResource(), oldSrcBufferState);
+}
+
+void D3D12CommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, dstBuffer);
+    auto& srcBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, srcBuffer);
+
+    /* Transition resources only once for all regions */
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    commandContext_.TransitionResource(srcBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
+    {
+        commandContext_.FlushResourceBarriers();
+        for_range(i, numRegions)
+            GetNative()->CopyBufferRegion(dstBufferD3D.GetNative(), regions[i].dstOffset, srcBufferD3D.GetNative(), regions[i].srcOffset, regions[i].size);
+    }
 }
 
 void D3D12CommandBuffer::CopyBufferFromTexture(
@@ -141,8 +197,8 @@ void D3D12CommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
-    auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, dstBuffer);
+    auto& srcTextureD3D = LLGL_HOT_CAST(D3D12Texture&, srcTexture);
 
     const TextureLocation   srcLocation { srcRegion.offset, srcRegion.subresource.baseArrayLayer, srcRegion.subresource.baseMipLevel };
     const Extent3D          srcExtent   { CalcTextureExtent(srcTexture.GetType(), srcRegion.extent, srcRegion.subresource.numArrayLayers) };
@@ -158,9 +214,7 @@ void D3D12CommandBuffer::CopyBufferFromTexture(
     const D3D12_TEXTURE_COPY_LOCATION   srcLocationD3D  = srcTextureD3D.CalcCopyLocation(srcLocation);
     const D3D12_BOX                     srcBox          = srcTextureD3D.CalcRegion(srcRegion.offset, srcExtent);
 
-    const D3D12_RESOURCE_STATES oldDstBufferState = dstBufferD3D.GetResource().currentState;
-    const D3D12_RESOURCE_STATES oldSrcTextureState = srcTextureD3D.GetResource().currentState;
-
+    /* Transition resources into copy states; they are not transitioned back, since their next use will transition them lazily */
     commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
     commandContext_.TransitionResource(srcTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
     {
@@ -216,8 +270,6 @@ void D3D12CommandBuffer::CopyBufferFromTexture(
             );
         }
     }
-    commandContext_.TransitionResource(dstBufferD3D.GetResource(), oldDstBufferState);
-    commandContext_.TransitionResource(srcTextureD3D.GetResource(), oldSrcTextureState);
 }
 
 void D3D12CommandBuffer::FillBuffer(
@@ -226,7 +278,7 @@ void D3D12CommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-    auto& dstBufferD3D = LLGL_CAST(D3D12Buffer&, dstBuffer);
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, dstBuffer);
 
     /* Copy value to 4D vector to be used with native D3D12 clear functions */
     UINT valuesVec4[4] = { value, value, value, value };
@@ -249,17 +301,15 @@ void D3D12CommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
-    auto& srcTextureD3D = LLGL_CAST(D3D12Texture&, srcTexture);
+    auto& dstTextureD3D = LLGL_HOT_CAST(D3D12Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_HOT_CAST(D3D12Texture&, srcTexture);
 
     const D3D12_TEXTURE_COPY_LOCATION dstLocationD3D = dstTextureD3D.CalcCopyLocation(dstLocation);
     const D3D12_TEXTURE_COPY_LOCATION srcLocationD3D = srcTextureD3D.CalcCopyLocation(srcLocation);
 
     const D3D12_BOX srcBox = srcTextureD3D.CalcRegion(srcLocation.offset, extent);
 
-    const D3D12_RESOURCE_STATES oldDstTextureState = dstTextureD3D.GetResource().currentState;
-    const D3D12_RESOURCE_STATES oldSrcTextureState = srcTextureD3D.GetResource().currentState;
-
+    /* Transition resources into copy states; they are not transitioned back, since their next use will transition them lazily */
     commandContext_.TransitionResource(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
     commandContext_.TransitionResource(srcTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
     {
@@ -273,8 +323,43 @@ void D3D12CommandBuffer::CopyTexture(
             &srcBox                                     // pSrcBox
         );
     }
-    commandContext_.TransitionResource(dstTextureD3D.GetResource(), oldDstTextureState);
-    commandContext_.TransitionResource(srcTextureD3D.GetResource(), oldSrcTextureState);
+}
+
+void D3D12CommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstTextureD3D = LLGL_HOT_CAST(D3D12Texture&, dstTexture);
+    auto& srcTextureD3D = LLGL_HOT_CAST(D3D12Texture&, srcTexture);
+
+    /* Transition resources only once for all regions */
+    commandContext_.TransitionResource(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    commandContext_.TransitionResource(srcTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
+    commandContext_.FlushResourceBarriers();
+
+    for_range(i, numRegions)
+    {
+        const TextureCopyRegion& region = regions[i];
+
+        const D3D12_TEXTURE_COPY_LOCATION dstLocationD3D = dstTextureD3D.CalcCopyLocation(region.dstLocation);
+        const D3D12_TEXTURE_COPY_LOCATION srcLocationD3D = srcTextureD3D.CalcCopyLocation(region.srcLocation);
+
+        const D3D12_BOX srcBox = srcTextureD3D.CalcRegion(region.srcLocation.offset, region.extent);
+
+        GetNative()->CopyTextureRegion(
+            &dstLocationD3D,                                    // pDst
+            static_cast<UINT>(region.dstLocation.offset.x),     // DstX
+            static_cast<UINT>(region.dstLocation.offset.y),     // DstY
+            static_cast<UINT>(region.dstLocation.offset.z),     // DstZ
+            &srcLocationD3D,                                    // pSrc
+            &srcBox                                             // pSrcBox
+        );
+    }
 }
 
 void D3D12CommandBuffer::CopyTextureFromBuffer(
@@ -285,8 +370,8 @@ void D3D12CommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
-    auto& srcBufferD3D = LLGL_CAST(D3D12Buffer&, srcBuffer);
+    auto& dstTextureD3D = LLGL_HOT_CAST(D3D12Texture&, dstTexture);
+    auto& srcBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, srcBuffer);
 
     const TextureLocation   dstLocation { dstRegion.offset, dstRegion.subresource.baseArrayLayer, dstRegion.subresource.baseMipLevel };
     const Extent3D          dstExtent   { CalcTextureExtent(dstTexture.GetType(), dstRegion.extent, dstRegion.subresource.numArrayLayers) };
@@ -302,9 +387,7 @@ void D3D12CommandBuffer::CopyTextureFromBuffer(
     const D3D12_TEXTURE_COPY_LOCATION   dstLocationD3D  = dstTextureD3D.CalcCopyLocation(dstLocation);
     const D3D12_BOX                     srcBox          = dstTextureD3D.CalcRegion(Offset3D{}, dstExtent);
 
-    const D3D12_RESOURCE_STATES oldDstTextureState = dstTextureD3D.GetResource().currentState;
-    const D3D12_RESOURCE_STATES oldSrcBufferState = srcBufferD3D.GetResource().currentState;
-
+    /* Transition resources into copy states; they are not transitioned back, since their next use will transition them lazily */
     commandContext_.TransitionResource(dstTextureD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
     commandContext_.TransitionResource(srcBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE);
     {
@@ -360,8 +443,6 @@ void D3D12CommandBuffer::CopyTextureFromBuffer(
             );
         }
     }
-    commandContext_.TransitionResource(dstTextureD3D.GetResource(), oldDstTextureState);
-    commandContext_.TransitionResource(srcBufferD3D.GetResource(), oldSrcBufferState);
 }
 
 void D3D12CommandBuffer::CopyTextureFromFramebuffer(
@@ -377,7 +458,7 @@ void D3D12CommandBuffer::CopyTextureFromFramebuffer(
         return /*E_INVALIDARG*/;
     }
 
-    auto& dstTextureD3D = LLGL_CAST(D3D12Texture&, dstTexture);
+    auto& dstTextureD3D = LLGL_HOT_CAST(D3D12Texture&, dstTexture);
 
     D3D12Resource&  dstResource     = dstTextureD3D.GetResource();
     UINT            dstSubresource  = dstTextureD3D.CalcSubresource(dstRegion.subresource.baseMipLevel, dstRegion.subresource.baseArrayLayer);
@@ -405,16 +486,67 @@ void D3D12CommandBuffer::CopyTextureFromFramebuffer(
 
 void D3D12CommandBuffer::GenerateMips(Texture& texture)
 {
-    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    auto& textureD3D = LLGL_HOT_CAST(D3D12Texture&, texture);
     D3D12MipGenerator::Get().GenerateMips(commandContext_, textureD3D, textureD3D.GetWholeSubresource());
 }
 
 void D3D12CommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
-    auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
+    auto& textureD3D = LLGL_HOT_CAST(D3D12Texture&, texture);
     D3D12MipGenerator::Get().GenerateMips(commandContext_, textureD3D, subresource);
 }
 
+void D3D12CommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    SmallVector<D3D12Texture*> texturesD3D;
+    texturesD3D.reserve(numTextures);
+
+    for_range(i, numTextures)
+    {
+        if (textures[i] != nullptr)
+            texturesD3D.push_back(LLGL_HOT_CAST(D3D12Texture*, textures[i]));
+    }
+
+    D3D12MipGenerator::Get().GenerateMips(commandContext_, static_cast<std::uint32_t>(texturesD3D.size()), texturesD3D.data());
+}
+
+void D3D12CommandBuffer::ResolveSamplerFeedback(
+    Texture&        feedbackTexture,
+    std::uint32_t   mipLevel,
+    std::uint32_t   arrayLayer,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+    auto& feedbackTextureD3D = LLGL_HOT_CAST(D3D12Texture&, feedbackTexture);
+    D3D12Texture* decodeTextureD3D = feedbackTextureD3D.GetFeedbackDecodeTexture();
+    if (decodeTextureD3D == nullptr || mipLevel >= decodeTextureD3D->GetNumMipLevels())
+        return;
+
+    /* Decode opaque feedback map into intermediate R8_UINT texture */
+    commandContext_.ResolveSamplerFeedback(
+        decodeTextureD3D->GetResource(),
+        decodeTextureD3D->CalcSubresource(mipLevel, arrayLayer),
+        feedbackTextureD3D.GetResource(),
+        feedbackTextureD3D.CalcSubresource(mipLevel, arrayLayer)
+    );
+
+    /* Copy decoded feedback into destination buffer with tightly packed rows */
+    const Extent3D      mipExtent       = decodeTextureD3D->GetMipExtent(mipLevel);
+    const TextureRegion decodeRegion    { TextureSubresource{ arrayLayer, mipLevel }, Offset3D{}, Extent3D{ mipExtent.width, mipExtent.height, 1 } };
+    CopyBufferFromTexture(dstBuffer, dstOffset, *decodeTextureD3D, decodeRegion, 0, 0);
+    #endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+}
+
+void D3D12CommandBuffer::ClearSamplerFeedback(Texture& feedbackTexture)
+{
+    #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+    auto& feedbackTextureD3D = LLGL_HOT_CAST(D3D12Texture&, feedbackTexture);
+    if (ID3D12DescriptorHeap* feedbackDescHeap = feedbackTextureD3D.GetFeedbackDescHeap())
+        commandContext_.ClearSamplerFeedback(feedbackTextureD3D.GetResource(), feedbackDescHeap->GetCPUDescriptorHandleForHeapStart());
+    #endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+}
+
 /* ----- Viewport and Scissor ----- */
 
 // Check if D3D12_VIEWPORT and Viewport structures can be safely reinterpret-casted
@@ -540,17 +672,25 @@ void D3D12CommandBuffer::ClearAttachments(std::uint32_t numAttachments, const At
 
 void D3D12CommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     SubmitTransitionResource(bufferD3D.GetResource(), bufferD3D.GetResource().usageState);
-    GetNative()->IASetVertexBuffers(0, 1, &(bufferD3D.GetVertexBufferView()));
 
-    if ((bufferD3D.GetBindFlags() & BindFlags::StreamOutputBuffer) != 0)
+    D3D12_VERTEX_BUFFER_VIEW vertexBufferView = bufferD3D.GetVertexBufferView();
+    if (vertexBufferView.StrideInBytes == 0)
+        vertexBufferView.StrideInBytes = transientVertexStride_;
+
+    GetNative()->IASetVertexBuffers(0, 1, &vertexBufferView);
+
+    /* Store vertex buffer for slot 0 in case it's used for stream-output or compute stream-output */
+    if ((bufferD3D.GetBindFlags() & (BindFlags::StreamOutputBuffer | BindFlags::ComputeStreamOutput)) != 0)
         soBufferIASlot0_ = &bufferD3D;
+    else
+        soBufferIASlot0_ = nullptr;
 }
 
 void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
-    auto& bufferArrayD3D = LLGL_CAST(D3D12BufferArray&, bufferArray);
+    auto& bufferArrayD3D = LLGL_HOT_CAST(D3D12BufferArray&, bufferArray);
 
     for (D3D12Resource* resource : bufferArrayD3D.GetResourceRefs())
         SubmitTransitionResource(*resource, resource->usageState);
@@ -560,18 +700,20 @@ void D3D12CommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         static_cast<UINT>(bufferArrayD3D.GetVertexBufferViews().size()),
         bufferArrayD3D.GetVertexBufferViews().data()
     );
+
+    soBufferIASlot0_ = nullptr;
 }
 
 void D3D12CommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     SubmitTransitionResource(bufferD3D.GetResource(), bufferD3D.GetResource().usageState);
     commandContext_.SetIndexBuffer(bufferD3D.GetIndexBufferView());
 }
 
 void D3D12CommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     D3D12_INDEX_BUFFER_VIEW indexBufferView = bufferD3D.GetIndexBufferView();
     if (indexBufferView.SizeInBytes > offset)
     {
@@ -592,7 +734,7 @@ void D3D12CommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32
     if (boundPipelineLayout_ == nullptr || boundPipelineState_ == nullptr)
         return /*E_POINTER*/;
 
-    auto& resourceHeapD3D = LLGL_CAST(D3D12ResourceHeap&, resourceHeap);
+    auto& resourceHeapD3D = LLGL_HOT_CAST(D3D12ResourceHeap&, resourceHeap);
 
     /* Copy descriptors for specified set into shader-visible descriptor heap */
     for_range(i, 2)
@@ -600,13 +742,8 @@ void D3D12CommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32
         const auto heapType = static_cast<D3D12_DESCRIPTOR_HEAP_TYPE>(i);
         if (resourceHeapD3D.GetDescriptorHeap(heapType) != nullptr)
         {
-            /* Copies the entire set of descriptors from the non-shader-visible heap to the global shader-visible heap */
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext_.CopyDescriptorsForStaging(
-                heapType,
-                resourceHeapD3D.GetCPUDescriptorHandleForHeapStart(heapType, descriptorSet),
-                0,
-                resourceHeapD3D.GetNumDescriptorsPerSet(heapType)
-            );
+            /* Get persistent table for the entire set of descriptors; they are only copied into the shader-visible heap when the resource heap has changed */
+            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext_.CopyPersistentDescriptorsForStaging(heapType, resourceHeapD3D, descriptorSet);
 
             /* Bind descriptor table to root parameter */
             const UINT rootParamIndex = boundPipelineLayout_->GetRootParameterIndices().rootParamDescriptorHeaps[i];
@@ -631,7 +768,7 @@ static D3D12_GPU_VIRTUAL_ADDRESS GetD3DResourceGPUAddr(Resource& resource)
     /* GetGPUVirtualAddress() is only useful for buffers */
     if (resource.GetResourceType() == ResourceType::Buffer)
     {
-        D3D12Buffer& bufferD3D = LLGL_CAST(D3D12Buffer&, resource);
+        D3D12Buffer& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, resource);
         return bufferD3D.GetNative()->GetGPUVirtualAddress();
     }
     return 0;
@@ -674,6 +811,39 @@ void D3D12CommandBuffer::SetResource(std::uint32_t descriptor, Resource& resourc
     commandContext_.SetResourceUAVBarrier(resource, descriptorLocation);
 }
 
+void D3D12CommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    if (boundPipelineLayout_ == nullptr)
+        return /*E_POINTER*/;
+
+    if (!(descriptor < boundPipelineLayout_->GetNumBindings()))
+        return /*E_INVALIDARG*/;
+
+    D3D12Buffer& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
+
+    const D3D12DescriptorLocation& rootParameterLocation = boundPipelineLayout_->GetRootParameterMap()[descriptor];
+    if (rootParameterLocation.type == D3D12_ROOT_PARAMETER_TYPE_CBV)
+    {
+        /* Set root CBV by its GPU virtual address, so changing the buffer range doesn't require a new descriptor */
+        SubmitTransitionResource(buffer, rootParameterLocation.state);
+        const D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr = bufferD3D.GetNative()->GetGPUVirtualAddress() + offset;
+        if (boundPipelineState_ != nullptr && boundPipelineState_->IsGraphicsPSO())
+            commandContext_.SetGraphicsRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
+        else
+            commandContext_.SetComputeRootParameter(rootParameterLocation.index, rootParameterLocation.type, gpuVirtualAddr);
+    }
+    else if (rootParameterLocation.type == D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
+    {
+        /* Create CBV for the buffer range in the staging descriptor heap */
+        const D3D12DescriptorHeapLocation& descriptorLocation = boundPipelineLayout_->GetDescriptorMap()[descriptor];
+        if (descriptorLocation.type == D3D12_DESCRIPTOR_RANGE_TYPE_CBV)
+        {
+            SubmitTransitionResource(buffer, descriptorLocation.state);
+            commandContext_.EmplaceConstantBufferRangeForStaging(bufferD3D, descriptorLocation, offset, size);
+        }
+    }
+}
+
 void D3D12CommandBuffer::ResourceBarrier(
     std::uint32_t       numBuffers,
     Buffer* const *     buffers,
@@ -684,7 +854,7 @@ void D3D12CommandBuffer::ResourceBarrier(
     {
         if (buffers[i] != nullptr)
         {
-            auto* bufferD3D = LLGL_CAST(D3D12Buffer*, buffers[i]);
+            auto* bufferD3D = LLGL_HOT_CAST(D3D12Buffer*, buffers[i]);
             commandContext_.UAVBarrier(bufferD3D->GetResource().Get());
         }
     }
@@ -693,12 +863,40 @@ void D3D12CommandBuffer::ResourceBarrier(
     {
         if (textures[i] != nullptr)
         {
-            auto* textureD3D = LLGL_CAST(D3D12Texture*, textures[i]);
+            auto* textureD3D = LLGL_HOT_CAST(D3D12Texture*, textures[i]);
             commandContext_.UAVBarrier(textureD3D->GetResource().Get());
         }
     }
 }
 
+void D3D12CommandBuffer::AliasingBarrier(Texture* textureBefore, Texture* textureAfter)
+{
+    auto* textureBeforeD3D  = LLGL_HOT_CAST(D3D12Texture*, textureBefore);
+    auto* textureAfterD3D   = LLGL_HOT_CAST(D3D12Texture*, textureAfter);
+
+    commandContext_.AliasingBarrier(
+        (textureBeforeD3D != nullptr ? textureBeforeD3D->GetNative() : nullptr),
+        (textureAfterD3D  != nullptr ? textureAfterD3D->GetNative()  : nullptr),
+        true
+    );
+
+    /* Render targets and depth-stencil buffers must be initialized with a discard or clear after they have been aliased */
+    if (textureAfterD3D != nullptr)
+    {
+        const long bindFlags = textureAfterD3D->GetBindFlags();
+        if ((bindFlags & BindFlags::ColorAttachment) != 0)
+        {
+            commandContext_.TransitionResource(textureAfterD3D->GetResource(), D3D12_RESOURCE_STATE_RENDER_TARGET, true);
+            GetNative()->DiscardResource(textureAfterD3D->GetNative(), nullptr);
+        }
+        else if ((bindFlags & BindFlags::DepthStencilAttachment) != 0)
+        {
+            commandContext_.TransitionResource(textureAfterD3D->GetResource(), D3D12_RESOURCE_STATE_DEPTH_WRITE, true);
+            GetNative()->DiscardResource(textureAfterD3D->GetNative(), nullptr);
+        }
+    }
+}
+
 /* ----- Render Passes ----- */
 
 void D3D12CommandBuffer::BeginRenderPass(
@@ -711,7 +909,7 @@ void D3D12CommandBuffer::BeginRenderPass(
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Bind swap chain */
-        boundSwapChain_     = LLGL_CAST(D3D12SwapChain*, &renderTarget);
+        boundSwapChain_     = LLGL_HOT_CAST(D3D12SwapChain*, &renderTarget);
         boundRenderTarget_  = nullptr;
 
         BindSwapChain(*boundSwapChain_, swapBufferIndex);
@@ -720,7 +918,7 @@ void D3D12CommandBuffer::BeginRenderPass(
     {
         /* Bind render target */
         boundSwapChain_     = nullptr;
-        boundRenderTarget_  = LLGL_CAST(D3D12RenderTarget*, &renderTarget);
+        boundRenderTarget_  = LLGL_HOT_CAST(D3D12RenderTarget*, &renderTarget);
 
         BindRenderTarget(*boundRenderTarget_);
     }
@@ -728,7 +926,7 @@ void D3D12CommandBuffer::BeginRenderPass(
     /* Clear attachments */
     if (renderPass)
     {
-        auto* renderPassD3D = LLGL_CAST(const D3D12RenderPass*, renderPass);
+        auto* renderPassD3D = LLGL_HOT_CAST(const D3D12RenderPass*, renderPass);
         ClearAttachmentsWithRenderPass(*renderPassD3D, numClearValues, clearValues);
     }
 }
@@ -747,11 +945,11 @@ void D3D12CommandBuffer::EndRenderPass()
 void D3D12CommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
     /* Bind pipeline state to command context */
-    auto& pipelineStateD3D = LLGL_CAST(D3D12PipelineState&, pipelineState);
+    auto& pipelineStateD3D = LLGL_HOT_CAST(D3D12PipelineState&, pipelineState);
     if (pipelineStateD3D.IsGraphicsPSO())
     {
         /* Bind graphics PSO */
-        auto& graphicsPSO = LLGL_CAST(D3D12GraphicsPSO&, pipelineState);
+        auto& graphicsPSO = LLGL_HOT_CAST(D3D12GraphicsPSO&, pipelineState);
         graphicsPSO.Bind(commandContext_);
         boundPipelineState_ = &graphicsPSO;
 
@@ -770,10 +968,9 @@ void D3D12CommandBuffer::SetPipelineState(PipelineState& pipelineState)
     }
     else
     {
-        /* Bind compute PSO */
-        auto& computePSO = LLGL_CAST(D3D12ComputePSO&, pipelineState);
-        computePSO.Bind(commandContext_);
-        boundPipelineState_ = &computePSO;
+        /* Bind compute or ray tracing PSO; both are bound to the compute root signature */
+        pipelineStateD3D.Bind(commandContext_);
+        boundPipelineState_ = &pipelineStateD3D;
     }
 
     /* Keep reference to pipeline layout */
@@ -806,6 +1003,32 @@ void D3D12CommandBuffer::SetStencilReference(std::uint32_t reference, const Sten
     GetNative()->OMSetStencilRef(reference);
 }
 
+#if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+static D3D12_SHADING_RATE ToD3D12ShadingRate(const ShadingRate rate)
+{
+    switch (rate)
+    {
+        case ShadingRate::Rate1x1: return D3D12_SHADING_RATE_1X1;
+        case ShadingRate::Rate1x2: return D3D12_SHADING_RATE_1X2;
+        case ShadingRate::Rate2x1: return D3D12_SHADING_RATE_2X1;
+        case ShadingRate::Rate2x2: return D3D12_SHADING_RATE_2X2;
+        case ShadingRate::Rate2x4: return D3D12_SHADING_RATE_2X4;
+        case ShadingRate::Rate4x2: return D3D12_SHADING_RATE_4X2;
+        case ShadingRate::Rate4x4: return D3D12_SHADING_RATE_4X4;
+    }
+    return D3D12_SHADING_RATE_1X1;
+}
+
+#endif // /LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+void D3D12CommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+    commandContext_.SetShadingRate(ToD3D12ShadingRate(rate));
+    #endif
+}
+
 void D3D12CommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -819,23 +1042,20 @@ void D3D12CommandBuffer::SetUniforms(std::uint32_t first, const void* data, std:
     const std::uint32_t                             dataSizeInWords = dataSize / 4;
     const std::uint32_t                             maxNumUniforms  = boundPipelineLayout_->GetNumUniforms();
     const std::vector<D3D12RootConstantLocation>&   rootConstantMap = boundPipelineState_->GetRootConstantMap();
+    const bool                                      isGraphicsPSO   = boundPipelineState_->IsGraphicsPSO();
 
-    for (auto words = reinterpret_cast<const UINT*>(data), wordsEnd = words + dataSizeInWords; words != wordsEnd; ++first)
+    /* Stage root constants of each uniform; the command context coalesces consecutive values into a single command before the next draw or dispatch */
+    for (auto words = reinterpret_cast<const UINT*>(data), wordsEnd = words + dataSizeInWords; words < wordsEnd; ++first)
     {
         if (first >= maxNumUniforms)
             return /*E_INVALIDARG*/;
 
         const D3D12RootConstantLocation& rootConstantLocation = rootConstantMap[first];
-        UINT wordOffset = rootConstantLocation.wordOffset;
-        for_range(i, rootConstantLocation.num32BitValues)
-        {
-            const D3D12Constant value{ words[i] };
-            if (boundPipelineState_->IsGraphicsPSO())
-                commandContext_.SetGraphicsConstant(rootConstantLocation.index, value, wordOffset);
-            else
-                commandContext_.SetComputeConstant(rootConstantLocation.index, value, wordOffset);
-            ++wordOffset;
-        }
+        const UINT numValues = std::min<UINT>(rootConstantLocation.num32BitValues, static_cast<UINT>(wordsEnd - words));
+        if (isGraphicsPSO)
+            commandContext_.StageGraphicsConstants(rootConstantLocation.index, words, numValues, rootConstantLocation.wordOffset);
+        else
+            commandContext_.StageComputeConstants(rootConstantLocation.index, words, numValues, rootConstantLocation.wordOffset);
         words += rootConstantLocation.num32BitValues;
     }
 }
@@ -844,16 +1064,36 @@ void D3D12CommandBuffer::SetUniforms(std::uint32_t first, const void* data, std:
 
 void D3D12CommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapD3D = LLGL_CAST(D3D12QueryHeap&, queryHeap);
+    auto& queryHeapD3D = LLGL_HOT_CAST(D3D12QueryHeap&, queryHeap);
     queryHeapD3D.Begin(GetNative(), query);
 }
 
 void D3D12CommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapD3D = LLGL_CAST(D3D12QueryHeap&, queryHeap);
+    auto& queryHeapD3D = LLGL_HOT_CAST(D3D12QueryHeap&, queryHeap);
     queryHeapD3D.End(GetNative(), query);
 }
 
+void D3D12CommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapD3D = LLGL_HOT_CAST(D3D12QueryHeap&, srcQueryHeap);
+    auto& dstBufferD3D = LLGL_HOT_CAST(D3D12Buffer&, dstBuffer);
+
+    /* Transition destination buffer into copy state; it is not transitioned back, since its next use will transition it lazily */
+    commandContext_.TransitionResource(dstBufferD3D.GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
+    commandContext_.FlushResourceBarriers();
+
+    /* Resolve query data directly into the destination buffer; layout of pipeline statistics matches QueryPipelineStatistics */
+    GetNative()->ResolveQueryData(
+        queryHeapD3D.GetNative(),
+        queryHeapD3D.GetNativeType(),
+        firstQuery,
+        numQueries,
+        dstBufferD3D.GetNative(),
+        dstOffset
+    );
+}
+
 static D3D12_PREDICATION_OP GetDXPredicateOp(const RenderConditionMode mode)
 {
     if (mode >= RenderConditionMode::WaitInverted)
@@ -864,7 +1104,7 @@ static D3D12_PREDICATION_OP GetDXPredicateOp(const RenderConditionMode mode)
 
 void D3D12CommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
-    auto& queryHeapD3D = LLGL_CAST(D3D12QueryHeap&, queryHeap);
+    auto& queryHeapD3D = LLGL_HOT_CAST(D3D12QueryHeap&, queryHeap);
 
     /* Flush query result data if it was marked as dirty */
     if (queryHeapD3D.InsideDirtyRange(query, 1))
@@ -894,10 +1134,9 @@ void D3D12CommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* con
     /* Store native buffer views and transition resources */
     for_range(i, numSOBuffers_)
     {
-        auto* bufferD3D = LLGL_CAST(D3D12Buffer*, buffers[i]);
+        auto* bufferD3D = LLGL_HOT_CAST(D3D12Buffer*, buffers[i]);
         boundSOBuffers_[i] = bufferD3D;
         soBufferViews[i] = bufferD3D->GetSOBufferView();
-        soBufferStates_[i] = bufferD3D->GetResource().currentState;
         commandContext_.TransitionResource(bufferD3D->GetResource(), D3D12_RESOURCE_STATE_COPY_DEST);
     }
     commandContext_.FlushResourceBarriers();
@@ -931,10 +1170,7 @@ void D3D12CommandBuffer::EndStreamOutput()
     const D3D12_STREAM_OUTPUT_BUFFER_VIEW soBufferViewsNull[LLGL_MAX_NUM_SO_BUFFERS] = {};
     GetNative()->SOSetTargets(0, LLGL_MAX_NUM_SO_BUFFERS, soBufferViewsNull);
 
-    /* Transition resources back to their common usage */
-    for_range(i, numSOBuffers_)
-        commandContext_.TransitionResource(boundSOBuffers_[i]->GetResource(), soBufferStates_[i]);
-    commandContext_.FlushResourceBarriers();
+    /* Stream-output buffers are not transitioned back here, since their next use will transition them lazily */
 }
 
 /* ----- Drawing ----- */
@@ -981,14 +1217,14 @@ void D3D12CommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uin
 
 void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
     commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDrawIndirect(), 1, bufferD3D.GetNative(), offset);
 }
 
 void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
     if likely(stride == sizeof(D3D12_DRAW_ARGUMENTS))
     {
@@ -1008,14 +1244,14 @@ void D3D12CommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std:
 
 void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
     commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDrawIndexedIndirect(), 1, bufferD3D.GetNative(), offset);
 }
 
 void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
     if likely(stride == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS))
     {
@@ -1033,6 +1269,54 @@ void D3D12CommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offse
     }
 }
 
+void D3D12CommandBuffer::DrawIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferD3D         = LLGL_HOT_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D    = LLGL_HOT_CAST(D3D12Buffer&, countBuffer);
+    commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+    commandContext_.TransitionResource(countBufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+
+    /* Custom strides cannot be emulated with a loop here since the number of commands is only known to the GPU */
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetSignatureDrawIndirect(stride),
+        maxNumCommands,
+        bufferD3D.GetNative(),
+        offset,
+        countBufferD3D.GetNative(),
+        countOffset
+    );
+}
+
+void D3D12CommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferD3D         = LLGL_HOT_CAST(D3D12Buffer&, buffer);
+    auto& countBufferD3D    = LLGL_HOT_CAST(D3D12Buffer&, countBuffer);
+    commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+    commandContext_.TransitionResource(countBufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+
+    /* Custom strides cannot be emulated with a loop here since the number of commands is only known to the GPU */
+    commandContext_.DrawIndirect(
+        cmdSignatureFactory_->GetSignatureDrawIndexedIndirect(stride),
+        maxNumCommands,
+        bufferD3D.GetNative(),
+        offset,
+        countBufferD3D.GetNative(),
+        countOffset
+    );
+}
+
 /*
 D3D12 stream-outputs only write out the fill buffer size. This cannot be used directly as indirect draw arguments for three reasons:
  1. It's a UINT64 instead of the required UINT (see D3D12_DRAW_ARGUMENTS::VertexCountPerInstance).
@@ -1051,6 +1335,19 @@ void D3D12CommandBuffer::DrawStreamOutput()
     if unlikely(soBufferIASlot0_ == nullptr)
         return /*E_INVALIDARG*/;
 
+    if ((soBufferIASlot0_->GetBindFlags() & BindFlags::ComputeStreamOutput) != 0)
+    {
+        /* Draw with the arguments that were written by a compute shader at the end of the vertex buffer */
+        commandContext_.TransitionResource(soBufferIASlot0_->GetResource(), soBufferIASlot0_->GetResource().usageState);
+        commandContext_.DrawIndirect(
+            cmdSignatureFactory_->GetSignatureDrawIndirect(),
+            1,
+            soBufferIASlot0_->GetNative(),
+            GetComputeStreamOutputArgsOffset(soBufferIASlot0_->GetBufferSize())
+        );
+        return;
+    }
+
     ID3D12PipelineState* soDrawArgsPSO = nullptr;
     ID3D12RootSignature* soDrawArgsRootSig = nullptr;
     D3D12BuiltinShaderFactory::Get().GetBulitinPSO(D3D12BuiltinPSO::StreamOutputDrawArgsCS, soDrawArgsPSO, soDrawArgsRootSig);
@@ -1078,6 +1375,133 @@ void D3D12CommandBuffer::DrawStreamOutput()
     commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDrawIndirect(), 1, soDrawArgBuffer_.Get(), 0);
 }
 
+void D3D12CommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    #if LLGL_D3D12_ENABLE_MESH_SHADERS
+    commandContext_.DispatchMesh(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+    #endif
+}
+
+void D3D12CommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    #if LLGL_D3D12_ENABLE_MESH_SHADERS
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
+    commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+    commandContext_.DrawIndirect(cmdSignatureFactory_->GetSignatureDispatchMeshIndirect(stride), numCommands, bufferD3D.GetNative(), offset);
+    #endif
+}
+
+void D3D12CommandBuffer::DispatchTiles()
+{
+    // dummy - not supported in D3D12
+}
+
+// Returns the native indirect argument type for the specified draw or dispatch argument and false if the type is not supported.
+static bool GetD3DIndirectArgumentType(const IndirectArgumentType type, D3D12_INDIRECT_ARGUMENT_TYPE& outType)
+{
+    switch (type)
+    {
+        case IndirectArgumentType::Draw:            outType = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW;            return true;
+        case IndirectArgumentType::DrawIndexed:     outType = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;    return true;
+        #if LLGL_D3D12_ENABLE_MESH_SHADERS
+        case IndirectArgumentType::DrawMeshTasks:   outType = D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH;   return true;
+        #endif
+        case IndirectArgumentType::Dispatch:        outType = D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH;        return true;
+        default:                                    return false;
+    }
+}
+
+void D3D12CommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    commandDesc,
+    Buffer&                             buffer,
+    std::uint64_t                       offset,
+    Buffer*                             countBuffer,
+    std::uint64_t                       countOffset,
+    std::uint32_t                       maxNumCommands)
+{
+    if (commandDesc.arguments.empty() || boundPipelineState_ == nullptr)
+        return /*E_INVALIDARG*/;
+
+    /* Convert arguments into native indirect arguments; each uniform is mapped to the 32-bit values of its root constant */
+    SmallVector<D3D12_INDIRECT_ARGUMENT_DESC, 8>    argumentDescs;
+    bool                                            hasRootArguments    = false;
+    const std::vector<D3D12RootConstantLocation>&   rootConstantMap     = boundPipelineState_->GetRootConstantMap();
+
+    for (const IndirectArgumentDescriptor& argument : commandDesc.arguments)
+    {
+        if (argument.type == IndirectArgumentType::Uniforms)
+        {
+            if (argument.first + argument.numUniforms > rootConstantMap.size())
+                return /*E_INVALIDARG*/;
+
+            for_range(i, argument.numUniforms)
+            {
+                const D3D12RootConstantLocation& rootConstantLocation = rootConstantMap[argument.first + i];
+
+                /* Merge with previous argument if the root constants are consecutive within the same root parameter */
+                if (!argumentDescs.empty())
+                {
+                    D3D12_INDIRECT_ARGUMENT_DESC& prevArgumentDesc = argumentDescs.back();
+                    if (prevArgumentDesc.Type == D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT &&
+                        prevArgumentDesc.Constant.RootParameterIndex == rootConstantLocation.index &&
+                        prevArgumentDesc.Constant.DestOffsetIn32BitValues + prevArgumentDesc.Constant.Num32BitValuesToSet == rootConstantLocation.wordOffset)
+                    {
+                        prevArgumentDesc.Constant.Num32BitValuesToSet += rootConstantLocation.num32BitValues;
+                        continue;
+                    }
+                }
+
+                D3D12_INDIRECT_ARGUMENT_DESC argumentDesc = {};
+                {
+                    argumentDesc.Type                               = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+                    argumentDesc.Constant.RootParameterIndex        = rootConstantLocation.index;
+                    argumentDesc.Constant.DestOffsetIn32BitValues   = rootConstantLocation.wordOffset;
+                    argumentDesc.Constant.Num32BitValuesToSet       = rootConstantLocation.num32BitValues;
+                }
+                argumentDescs.push_back(argumentDesc);
+            }
+
+            hasRootArguments = true;
+        }
+        else
+        {
+            D3D12_INDIRECT_ARGUMENT_DESC argumentDesc = {};
+            if (!GetD3DIndirectArgumentType(argument.type, argumentDesc.Type))
+                return /*E_INVALIDARG*/;
+            argumentDescs.push_back(argumentDesc);
+        }
+    }
+
+    ID3D12CommandSignature* signature = cmdSignatureFactory_->GetSignatureWithArguments(
+        argumentDescs.data(),
+        static_cast<UINT>(argumentDescs.size()),
+        commandDesc.stride,
+        (hasRootArguments ? boundPipelineState_->GetRootSignature() : nullptr)
+    );
+
+    /* Transition argument and count buffers */
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
+    commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+
+    ID3D12Resource* countBufferNative = nullptr;
+    if (countBuffer != nullptr)
+    {
+        auto* countBufferD3D = LLGL_HOT_CAST(D3D12Buffer*, countBuffer);
+        commandContext_.TransitionResource(countBufferD3D->GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
+        countBufferNative = countBufferD3D->GetNative();
+    }
+
+    if (argumentDescs.back().Type == D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH)
+        commandContext_.DispatchIndirect(signature, maxNumCommands, bufferD3D.GetNative(), offset, countBufferNative, countOffset);
+    else
+        commandContext_.DrawIndirect(signature, maxNumCommands, bufferD3D.GetNative(), offset, countBufferNative, countOffset);
+}
+
+void D3D12CommandBuffer::DrawPacked(const DrawPackedDescriptor& drawDesc)
+{
+    EncodePackedDraws(*this, drawDesc);
+}
+
 /* ----- Compute ----- */
 
 void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1087,11 +1511,87 @@ void D3D12CommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t nu
 
 void D3D12CommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, buffer);
     commandContext_.TransitionResource(bufferD3D.GetResource(), D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT);
     commandContext_.DispatchIndirect(cmdSignatureFactory_->GetSignatureDispatchIndirect(), 1, bufferD3D.GetNative(), offset);
 }
 
+/* ----- Ray Tracing ----- */
+
+void D3D12CommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 scratchBuffer,
+    const AccelerationStructureDescriptor&  desc,
+    Buffer*                                 srcBuffer)
+{
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    auto& dstBufferD3D      = LLGL_HOT_CAST(D3D12Buffer&, dstBuffer);
+    auto& scratchBufferD3D  = LLGL_HOT_CAST(D3D12Buffer&, scratchBuffer);
+
+    D3D12_GPU_VIRTUAL_ADDRESS instanceDescs = 0;
+
+    if (desc.type == AccelerationStructureType::TopLevel)
+    {
+        if (!desc.instances.empty())
+        {
+            /* Write native instance descriptors into transient upload memory */
+            const UINT64 instanceDescsSize = sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * desc.instances.size();
+            TransientBufferAllocation allocation = commandContext_.AllocTransientBuffer(instanceDescsSize, 0, D3D12_RAYTRACING_INSTANCE_DESCS_BYTE_ALIGNMENT);
+            if (allocation.buffer == nullptr)
+                return;
+
+            D3D12AccelerationStructureInputs::WriteInstanceDescs(static_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(allocation.data), desc.instances);
+            instanceDescs = LLGL_HOT_CAST(D3D12Buffer*, allocation.buffer)->GetNative()->GetGPUVirtualAddress() + allocation.offset;
+        }
+    }
+    else
+    {
+        /* Geometry buffers are read by the build as non-pixel shader resources; their next use will transition them back lazily */
+        for (const AccelerationStructureGeometryDescriptor& geometry : desc.geometries)
+        {
+            if (geometry.vertexBuffer != nullptr)
+                commandContext_.TransitionResource(LLGL_HOT_CAST(D3D12Buffer*, geometry.vertexBuffer)->GetResource(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+            if (geometry.indexBuffer != nullptr)
+                commandContext_.TransitionResource(LLGL_HOT_CAST(D3D12Buffer*, geometry.indexBuffer)->GetResource(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+        }
+    }
+
+    commandContext_.TransitionResource(scratchBufferD3D.GetResource(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+
+    /* Build or update acceleration structure */
+    const D3D12AccelerationStructureInputs inputs{ desc, /*resolveBuffers:*/ true, instanceDescs };
+
+    D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC buildDesc = {};
+    {
+        buildDesc.DestAccelerationStructureData     = dstBufferD3D.GetNative()->GetGPUVirtualAddress();
+        buildDesc.Inputs                            = inputs.GetNative();
+        buildDesc.ScratchAccelerationStructureData  = scratchBufferD3D.GetNative()->GetGPUVirtualAddress();
+        if (srcBuffer != nullptr)
+        {
+            auto* srcBufferD3D = LLGL_HOT_CAST(D3D12Buffer*, srcBuffer);
+            buildDesc.Inputs.Flags                      |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
+            buildDesc.SourceAccelerationStructureData   = srcBufferD3D->GetNative()->GetGPUVirtualAddress();
+        }
+    }
+    commandContext_.BuildRaytracingAccelerationStructure(buildDesc);
+
+    /* Subsequent builds and ray dispatches must wait until this build has finished, and the scratch buffer may be reused by the next build */
+    commandContext_.UAVBarrier(dstBufferD3D.GetNative());
+    commandContext_.UAVBarrier(scratchBufferD3D.GetNative());
+    #endif // /LLGL_D3D12_ENABLE_RAYTRACING
+}
+
+void D3D12CommandBuffer::DispatchRays(std::uint32_t width, std::uint32_t height, std::uint32_t depth)
+{
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    if (boundPipelineState_ != nullptr && boundPipelineState_->IsRayTracingPSO())
+    {
+        auto* rayTracingPSO = LLGL_HOT_CAST(D3D12RayTracingPSO*, boundPipelineState_);
+        commandContext_.DispatchRays(rayTracingPSO->GetDispatchRaysDesc(width, height, depth));
+    }
+    #endif // /LLGL_D3D12_ENABLE_RAYTRACING
+}
+
 /* ----- Debugging ----- */
 
 void D3D12CommandBuffer::PushDebugGroup(const char* name)
@@ -1148,8 +1648,13 @@ static D3D12_COMMAND_LIST_TYPE GetD3DCommandListType(const CommandBufferDescript
 {
     if ((desc.flags & CommandBufferFlags::Secondary) != 0)
         return D3D12_COMMAND_LIST_TYPE_BUNDLE;
-    else
-        return D3D12_COMMAND_LIST_TYPE_DIRECT;
+
+    switch (desc.queueType)
+    {
+        case CommandQueueType::Compute: return D3D12_COMMAND_LIST_TYPE_COMPUTE;
+        case CommandQueueType::Copy:    return D3D12_COMMAND_LIST_TYPE_COPY;
+        default:                        return D3D12_COMMAND_LIST_TYPE_DIRECT;
+    }
 }
 
 static UINT GetNumCommandAllocators(const CommandBufferDescriptor& desc)
@@ -1172,7 +1677,9 @@ void D3D12CommandBuffer::CreateCommandContext(D3D12RenderSystem& renderSystem, c
 
     /* Create command context and store reference to command list */
     const bool initialClose         = true;
-    const bool cacheResourceStates  = ((desc.flags & (CommandBufferFlags::ImmediateSubmit | CommandBufferFlags::Secondary)) == 0);
+    /* Always cache resource states for compute and copy command lists, since they can't transition all resource states themselves */
+    const bool isDirectQueue        = (GetCommandQueueTypeForDesc(desc) == CommandQueueType::Graphics);
+    const bool cacheResourceStates  = (!isDirectQueue || (desc.flags & (CommandBufferFlags::ImmediateSubmit | CommandBufferFlags::Secondary)) == 0);
     commandContext_.Create(device, GetD3DCommandListType(desc), GetNumCommandAllocators(desc), desc.minStagingPoolSize, initialClose, cacheResourceStates);
 
     /* Store increment size for descriptor heaps */
@@ -1279,6 +1786,10 @@ void D3D12CommandBuffer::BindRenderTarget(D3D12RenderTarget& renderTargetD3D)
         GetNative()->OMSetRenderTargets(numColorBuffers_, &rtvDescHandle_, TRUE, &dsvDescHandle_);
     else
         GetNative()->OMSetRenderTargets(numColorBuffers_, &rtvDescHandle_, TRUE, nullptr);
+
+    #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+    commandContext_.SetShadingRateImage(renderTargetD3D.GetShadingRateImage());
+    #endif
 }
 
 void D3D12CommandBuffer::BindSwapChain(D3D12SwapChain& swapChainD3D, std::uint32_t swapBufferIndex)
@@ -1303,6 +1814,10 @@ void D3D12CommandBuffer::BindSwapChain(D3D12SwapChain& swapChainD3D, std::uint32
         GetNative()->OMSetRenderTargets(1, &rtvDescHandle_, FALSE, &dsvDescHandle_);
     else
         GetNative()->OMSetRenderTargets(1, &rtvDescHandle_, FALSE, nullptr);
+
+    #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+    commandContext_.SetShadingRateImage(nullptr);
+    #endif
 }
 
 std::uint32_t D3D12CommandBuffer::ClearAttachmentsWithRenderPass(
@@ -1450,14 +1965,14 @@ void D3D12CommandBuffer::SubmitTransitionResource(Resource& resource, D3D12_RESO
     {
         case ResourceType::Buffer:
         {
-            auto& bufferD3D = LLGL_CAST(D3D12Buffer&, resource);
+            auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, resource);
             SubmitTransitionResource(bufferD3D.GetResource(), newState);
         }
         break;
 
         case ResourceType::Texture:
         {
-            auto& textureD3D = LLGL_CAST(D3D12Texture&, resource);
+            auto& textureD3D = LLGL_HOT_CAST(D3D12Texture&, resource);
             if ((newState & (D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE)) != 0 &&
                 IsDepthOrStencilFormat(textureD3D.GetBaseFormat()))
             {
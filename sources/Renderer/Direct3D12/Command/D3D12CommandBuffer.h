@@ -50,6 +50,29 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         void SetDebugName(const char* name) override;
 
+        TransientBufferAllocation AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment) override;
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void CopyBufferRegions(Buffer& dstBuffer, Buffer& srcBuffer, std::uint32_t numRegions, const BufferCopyRegion* regions) override;
+        void CopyTextureRegions(Texture& dstTexture, Texture& srcTexture, std::uint32_t numRegions, const TextureCopyRegion* regions) override;
+
+        void GenerateMips(std::uint32_t numTextures, Texture* const * textures) override;
+
+        void ResolveSamplerFeedback(
+            Texture&        feedbackTexture,
+            std::uint32_t   mipLevel,
+            std::uint32_t   arrayLayer,
+            Buffer&         dstBuffer,
+            std::uint64_t   dstOffset
+        ) override;
+
+        void ClearSamplerFeedback(Texture& feedbackTexture) override;
+
+        void AliasingBarrier(Texture* textureBefore, Texture* textureAfter) override;
+
+        void DrawPacked(const DrawPackedDescriptor& drawDesc) override;
+
     public:
 
         // Executes all pending resource transitions and then the bundle.
@@ -73,6 +96,12 @@ class D3D12CommandBuffer final : public CommandBuffer
             return (isImmediateSubmit_ != 0);
         }
 
+        // Stores the ticket of the submission thread that executes the most recent submission of this command buffer. See D3D12CommandQueue::Submit().
+        inline void SetSubmissionTicket(std::uint64_t ticket)
+        {
+            submissionTicket_ = ticket;
+        }
+
         // Returns ture if this is a bundle command buffer.
         inline bool IsBundleCmdBuffer() const
         {
@@ -143,6 +172,7 @@ class D3D12CommandBuffer final : public CommandBuffer
         UINT                                    numColorBuffers_                            = 0;
         UINT                                    currentColorBuffer_                         = 0;
         UINT                                    numSOBuffers_                               = 0;
+        UINT                                    transientVertexStride_                      = 0; // Vertex stride for transient buffers (see AllocTransientBuffer).
 
         D3D12SwapChain*                         boundSwapChain_                             = nullptr;
         D3D12RenderTarget*                      boundRenderTarget_                          = nullptr;
@@ -152,10 +182,11 @@ class D3D12CommandBuffer final : public CommandBuffer
 
         D3D12Buffer*                            soBufferIASlot0_                            = 0;
         D3D12Resource                           soDrawArgBuffer_;
-        D3D12_RESOURCE_STATES                   soBufferStates_[LLGL_MAX_NUM_SO_BUFFERS]    = {};
 
         std::vector<D3D12ResourceTransition>    bundleResourceTransitions_;
 
+        std::uint64_t                           submissionTicket_                           = 0; // Ticket of the last submission if a submission thread is used
+
 };
 
 
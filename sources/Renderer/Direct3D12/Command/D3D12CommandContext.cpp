@@ -12,13 +12,17 @@
 #include "../Buffer/D3D12Buffer.h"
 #include "../Texture/D3D12Texture.h"
 #include "../RenderState/D3D12Fence.h"
+#include "../RenderState/D3D12ResourceHeap.h"
 #include "../../CheckedCast.h"
+#include "../../ProfileCounters.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/HashUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <limits.h>
+#include <string.h>
 
 
 // Validates resource descriptors for each transition barrier. Potentially slow, use with caution!
@@ -68,23 +72,52 @@ void D3D12CommandContext::Create(
     /* Determine number of command allocators */
     numAllocators_ = Clamp<UINT>(numAllocators, 1u, D3D12CommandContext::maxNumAllocators);
 
-    /* Create command allocators and descriptor heap pools */
+    /* Create shader-visible descriptor heaps that are shared between all command allocators */
+    static_assert(
+        D3D12CommandContext::maxNumAllocators <= D3D12DescriptorHeapRing::maxNumSegments,
+        "D3D12DescriptorHeapRing must provide a segment for each command allocator"
+    );
+
+    for_range(i, D3D12CommandContext::maxNumDescriptorHeaps)
+        descriptorHeapRings_[i].InitializeDevice(device.GetNative(), g_descriptorHeapTypes[i]);
+
+    /* Create command allocators and staging pools */
     constexpr UINT64 minStagingChunkSize = 256;
     initialStagingChunkSize = std::max(minStagingChunkSize, initialStagingChunkSize);
 
     for_range(i, numAllocators_)
     {
         commandAllocators_[i] = device.CreateDXCommandAllocator(commandListType);
-        for_range(j, D3D12CommandContext::maxNumDescriptorHeaps)
-            stagingDescriptorPools_[i][j].InitializeDevice(device.GetNative(), g_descriptorHeapTypes[j]);
         descriptorCaches_[i].Create(device.GetNative());
         stagingBufferPools_[i].InitializeDevice(device.GetNative(), initialStagingChunkSize);
         intermediateBufferPools_[i].InitializeDevice(device.GetNative());
+        transientBufferPools_[i].InitializeDevice(device.GetNative(), initialStagingChunkSize);
     }
 
     /* Create graphics command list and close it (they are created in recording mode) */
     commandList_ = device.CreateDXCommandList(commandListType, GetCommandAllocator());
 
+    #if LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+    commandListType_ = commandListType;
+    QueryEnhancedBarriersInterface();
+    #endif
+
+    #if LLGL_D3D12_ENABLE_MESH_SHADERS
+    QueryMeshShaderInterface();
+    #endif
+
+    #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+    QueryVariableRateShadingInterface();
+    #endif
+
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    QueryRayTracingInterface();
+    #endif
+
+    #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+    QueryViewInstancingInterface();
+    #endif
+
     if (initialClose)
         commandList_->Close();
 
@@ -94,8 +127,9 @@ void D3D12CommandContext::Create(
 
 void D3D12CommandContext::Close()
 {
-    /* Flush pending resource barriers */
+    /* Flush pending resource barriers and root constants */
     FlushResourceBarriers();
+    FlushStagingConstants();
 
     /* Close native command list */
     HRESULT hr = commandList_->Close();
@@ -137,11 +171,14 @@ void D3D12CommandContext::ExecuteBundle(D3D12CommandContext& otherContext)
     TODO:
     D3D12 bundles can bind descriptor heaps but they must match the primary command buffer's descriptor heaps.
     As a workaround, always bind the descriptor heaps that were cached in the secondary command buffer,
-    since those that are shader visible will be the same throughout the command encoding (see D3D12StagingDescriptorHeapPool).
+    since those that are shader visible will be the same throughout the command encoding (see D3D12DescriptorHeapRing).
     Some kind of descriptor heap sharing/pooling should be implemented next.
     */
     SetDescriptorHeapsOfOtherContext(otherContext);
 
+    /* Bundles inherit the root arguments of this command list */
+    FlushStagingConstants();
+
     /* Encode command to execute command list of other context as bundle */
     commandList_->ExecuteBundle(otherContext.GetCommandList());
 }
@@ -207,6 +244,14 @@ void D3D12CommandContext::TransitionBarrier(ID3D12Resource* resource, D3D12_RESO
 
 void D3D12CommandContext::TransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState, bool flushImmediate)
 {
+    if (resource.isStateFixed)
+    {
+        /* Resources with a fixed state are never transitioned, but pending barriers of other resources must still be flushed */
+        if (flushImmediate)
+            FlushResourceBarriers();
+        return;
+    }
+
     if (doCacheResourceStates_)
     {
         /* Cache resource state at beginning and end of command list */
@@ -278,6 +323,10 @@ void D3D12CommandContext::TransitionResourceInternal(D3D12Resource& resource, D3
             barrier.Transition.StateAfter   = newState;
         }
 
+        /* A transition out of the UAV state already synchronizes all previous writes */
+        if (resource.currentState == D3D12_RESOURCE_STATE_UNORDERED_ACCESS)
+            RemoveWrittenUAV(resource.Get());
+
         /* Store new resource state */
         resource.currentState = newState;
     }
@@ -285,6 +334,12 @@ void D3D12CommandContext::TransitionResourceInternal(D3D12Resource& resource, D3
 
 void D3D12CommandContext::UAVBarrier(ID3D12Resource* resource, bool flushImmediate)
 {
+    /* Explicit UAV barrier supersedes any pending implicit barrier for this resource; a null resource synchronizes all UAVs */
+    if (resource != nullptr)
+        RemoveWrittenUAV(resource);
+    else
+        writtenUAVs_.clear();
+
     D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
 
     barrier.Type            = D3D12_RESOURCE_BARRIER_TYPE_UAV;
@@ -295,40 +350,28 @@ void D3D12CommandContext::UAVBarrier(ID3D12Resource* resource, bool flushImmedia
         FlushResourceBarriers();
 }
 
-void D3D12CommandContext::FlushResourceBarriers()
+void D3D12CommandContext::AliasingBarrier(ID3D12Resource* resourceBefore, ID3D12Resource* resourceAfter, bool flushImmediate)
 {
-    if (numResourceBarriers_ > 0)
-    {
-        if (numUAVBarriers_ > 0)
-        {
-            /*
-            Merge UAV and transition barriers if possible since ResourceBarrier() command is expensive; From the D3D12 API docu:
-            "Transitions should be batched together into a single API call when possible, as a performance optimization."
-            */
-            if (numResourceBarriers_ + numUAVBarriers_ <= maxNumResourceBarrieres)
-            {
-                ::memcpy(&(resourceBarriers_[numResourceBarriers_]), uavBarriers_.data(), numUAVBarriers_ * sizeof(D3D12_RESOURCE_BARRIER));
-                commandList_->ResourceBarrier(numResourceBarriers_ + numUAVBarriers_, resourceBarriers_);
-            }
-            else
-            {
-                uavBarriers_.resize(numResourceBarriers_ + numUAVBarriers_);
-                ::memcpy(&(uavBarriers_[numUAVBarriers_]), resourceBarriers_, numResourceBarriers_ * sizeof(D3D12_RESOURCE_BARRIER));
-                commandList_->ResourceBarrier(numResourceBarriers_ + numUAVBarriers_, uavBarriers_.data());
-            }
-        }
-        else
-            commandList_->ResourceBarrier(numResourceBarriers_, resourceBarriers_);
+    D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
 
-        /* Reset intermediate barriers */
-        numResourceBarriers_ = 0;
-    }
-    else
-    {
-        /* Submit UAV barriers */
-        if (numUAVBarriers_ > 0)
-            commandList_->ResourceBarrier(numUAVBarriers_, uavBarriers_.data());
-    }
+    barrier.Type                        = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags                       = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Aliasing.pResourceBefore    = resourceBefore;
+    barrier.Aliasing.pResourceAfter     = resourceAfter;
+
+    if (flushImmediate)
+        FlushResourceBarriers();
+}
+
+void D3D12CommandContext::FlushResourceBarriers()
+{
+    /*
+    Merge UAV and transition barriers since ResourceBarrier() command is expensive; From the D3D12 API docu:
+    "Transitions should be batched together into a single API call when possible, as a performance optimization."
+    */
+    if (!writtenUAVs_.empty())
+        AppendPendingUAVBarriers();
+    SubmitResourceBarriers();
 }
 
 void D3D12CommandContext::ResolveSubresource(
@@ -410,10 +453,18 @@ ID3D12Resource* D3D12CommandContext::AllocIntermediateBuffer(UINT64 size, UINT a
     return intermediateBufferPools_[currentAllocatorIndex_].AllocBuffer(size, alignment);
 }
 
+TransientBufferAllocation D3D12CommandContext::AllocTransientBuffer(UINT64 size, long bindFlags, UINT64 alignment)
+{
+    return transientBufferPools_[currentAllocatorIndex_].Alloc(size, bindFlags, alignment);
+}
+
 void D3D12CommandContext::SetGraphicsRootSignature(ID3D12RootSignature* rootSignature)
 {
     if (stateCache_.dirtyBits.graphicsRootSignature != 0 || stateCache_.graphicsRootSignature != rootSignature)
     {
+        /* Staged root constants belong to the previous root signature */
+        FlushStagingConstants();
+
         /* Bind graphics root signature and cache state */
         commandList_->SetGraphicsRootSignature(rootSignature);
         stateCache_.graphicsRootSignature           = rootSignature;
@@ -425,6 +476,9 @@ void D3D12CommandContext::SetComputeRootSignature(ID3D12RootSignature* rootSigna
 {
     if (stateCache_.dirtyBits.computeRootSignature != 0 || stateCache_.computeRootSignature != rootSignature)
     {
+        /* Staged root constants belong to the previous root signature */
+        FlushStagingConstants();
+
         /* Bind graphics root signature and cache state */
         commandList_->SetComputeRootSignature(rootSignature);
         stateCache_.computeRootSignature            = rootSignature;
@@ -495,12 +549,7 @@ void D3D12CommandContext::SetStagingDescriptorHeaps(const D3D12DescriptorHeapSet
         stagingDescriptorSetLayout_.numSamplers          > 0)
     {
         /* Bind shader-visible descriptor heaps */
-        ID3D12DescriptorHeap* const stagingDescriptorHeaps[2] =
-        {
-            stagingDescriptorPools_[currentAllocatorIndex_][0].GetDescriptorHeap(),
-            stagingDescriptorPools_[currentAllocatorIndex_][1].GetDescriptorHeap()
-        };
-        SetDescriptorHeaps(2, stagingDescriptorHeaps);
+        BindDescriptorHeapRings();
 
         /* Reset descriptor cache for dynamic descriptors */
         descriptorCaches_[currentAllocatorIndex_].Reset(
@@ -526,6 +575,16 @@ void D3D12CommandContext::SetComputeConstant(UINT parameterIndex, D3D12Constant
     commandList_->SetComputeRoot32BitConstant(parameterIndex, value.bits32, offset);
 }
 
+void D3D12CommandContext::StageGraphicsConstants(UINT parameterIndex, const UINT* values, UINT numValues, UINT offset)
+{
+    StageConstants(false, parameterIndex, values, numValues, offset);
+}
+
+void D3D12CommandContext::StageComputeConstants(UINT parameterIndex, const UINT* values, UINT numValues, UINT offset)
+{
+    StageConstants(true, parameterIndex, values, numValues, offset);
+}
+
 void D3D12CommandContext::SetGraphicsRootParameter(UINT parameterIndex, D3D12_ROOT_PARAMETER_TYPE parameterType, D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr)
 {
     switch (parameterType)
@@ -568,30 +627,41 @@ void D3D12CommandContext::SetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& indexBuf
     stateCache_.stateBits.is16BitIndexFormat = (indexBufferView.Format == DXGI_FORMAT_R16_UINT ? 1 : 0);
 }
 
-D3D12_CPU_DESCRIPTOR_HANDLE D3D12CommandContext::GetCPUDescriptorHandle(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptor) const
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12CommandContext::CopyDescriptorsForStaging(
+    D3D12_DESCRIPTOR_HEAP_TYPE  type,
+    D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
+    UINT                        numDescriptors)
 {
-    /* Get current descriptor heap pool via allocator- and type index */
     const UINT typeIndex = static_cast<UINT>(type);
     LLGL_ASSERT(typeIndex < D3D12CommandContext::maxNumDescriptorHeaps);
-    const D3D12StagingDescriptorHeapPool& descriptorHeapPool = stagingDescriptorPools_[currentAllocatorIndex_][typeIndex];
 
-    /* Return CPU descriptor handle for the specified descriptor in the pool */
-    return descriptorHeapPool.GetCpuHandleWithOffset(descriptor);
+    /* Copy descriptors into shader-visible descriptor heap */
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorHeapRings_[typeIndex].CopyDescriptors(srcDescHandle, numDescriptors);
+    BindDescriptorHeapRings();
+    return gpuDescHandle;
 }
 
-D3D12_GPU_DESCRIPTOR_HANDLE D3D12CommandContext::CopyDescriptorsForStaging(
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12CommandContext::CopyPersistentDescriptorsForStaging(
     D3D12_DESCRIPTOR_HEAP_TYPE  type,
-    D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
-    UINT                        firstDescriptor,
-    UINT                        numDescriptors)
+    const D3D12ResourceHeap&    resourceHeap,
+    std::uint32_t               descriptorSet)
 {
-    /* Get current descriptor heap pool via allocator- and type index */
     const UINT typeIndex = static_cast<UINT>(type);
     LLGL_ASSERT(typeIndex < D3D12CommandContext::maxNumDescriptorHeaps);
-    D3D12StagingDescriptorHeapPool& descriptorHeapPool = stagingDescriptorPools_[currentAllocatorIndex_][typeIndex];
 
-    /* Copy descriptors into shader-visible descriptor heap */
-    return descriptorHeapPool.CopyDescriptors(srcDescHandle, firstDescriptor, numDescriptors);
+    /* Identify persistent table by resource heap and descriptor set; the version changes whenever the resource heap is written */
+    UINT64 key = g_hashSeed;
+    HashValue(key, &resourceHeap);
+    HashValue(key, descriptorSet);
+
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorHeapRings_[typeIndex].CopyPersistentDescriptors(
+        key,
+        resourceHeap.GetVersion(),
+        resourceHeap.GetCPUDescriptorHandleForHeapStart(type, descriptorSet),
+        resourceHeap.GetNumDescriptorsPerSet(type)
+    );
+    BindDescriptorHeapRings();
+    return gpuDescHandle;
 }
 
 void D3D12CommandContext::EmplaceDescriptorForStaging(Resource& resource, const D3D12DescriptorHeapLocation& descriptorLocation)
@@ -599,24 +669,22 @@ void D3D12CommandContext::EmplaceDescriptorForStaging(Resource& resource, const
     descriptorCaches_[currentAllocatorIndex_].EmplaceDescriptor(resource, descriptorLocation.descriptorIndex, descriptorLocation.type);
 }
 
+void D3D12CommandContext::EmplaceConstantBufferRangeForStaging(D3D12Buffer& bufferD3D, const D3D12DescriptorHeapLocation& descriptorLocation, UINT64 offset, UINT64 size)
+{
+    descriptorCaches_[currentAllocatorIndex_].EmplaceConstantBufferRange(bufferD3D, descriptorLocation.descriptorIndex, offset, size);
+}
+
 void D3D12CommandContext::ResetUAVBarriers(UINT numUAVBarriers)
 {
-    if (uavBarriers_.size() < numUAVBarriers)
-    {
-        D3D12_RESOURCE_BARRIER initialBarrier;
-        {
-            initialBarrier.Type             = D3D12_RESOURCE_BARRIER_TYPE_UAV;
-            initialBarrier.Flags            = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-            initialBarrier.UAV.pResource    = nullptr;
-        }
-        uavBarriers_.resize(numUAVBarriers, initialBarrier);
-    }
+    /* Clear slots of previous PSO, but keep list of written UAVs since their barriers are still pending */
+    uavBarrierResources_.resize(numUAVBarriers);
+    std::fill(uavBarrierResources_.begin(), uavBarrierResources_.end(), nullptr);
     numUAVBarriers_ = numUAVBarriers;
 }
 
 void D3D12CommandContext::SetResourceUAVBarrier(ID3D12Resource* resource, UINT uavBarrierSlot)
 {
-    uavBarriers_[uavBarrierSlot].UAV.pResource = resource;
+    uavBarrierResources_[uavBarrierSlot] = resource;
 }
 
 void D3D12CommandContext::SetResourceUAVBarrier(Resource& resource, const D3D12DescriptorHeapLocation& descriptorLocation)
@@ -626,12 +694,12 @@ void D3D12CommandContext::SetResourceUAVBarrier(Resource& resource, const D3D12D
         const ResourceType resourceType = resource.GetResourceType();
         if (resourceType == ResourceType::Buffer)
         {
-            auto& bufferD3D = LLGL_CAST(D3D12Buffer&, resource);
+            auto& bufferD3D = LLGL_HOT_CAST(D3D12Buffer&, resource);
             SetResourceUAVBarrier(bufferD3D.GetNative(), descriptorLocation.uavBarrierIndex);
         }
         else if (resourceType == ResourceType::Texture)
         {
-            auto& textureD3D = LLGL_CAST(D3D12Texture&, resource);
+            auto& textureD3D = LLGL_HOT_CAST(D3D12Texture&, resource);
             SetResourceUAVBarrier(textureD3D.GetNative(), descriptorLocation.uavBarrierIndex);
         }
     }
@@ -646,7 +714,9 @@ void D3D12CommandContext::DrawInstanced(
     FlushResourceBarriers();
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
+    FlushStagingConstants();
     commandList_->DrawInstanced(vertexCountPerInstance, instanceCount, startVertexLocation, startInstanceLocation);
+    MarkBoundUAVsAsWritten();
 }
 
 void D3D12CommandContext::DrawIndexedInstanced(
@@ -659,7 +729,9 @@ void D3D12CommandContext::DrawIndexedInstanced(
     FlushResourceBarriers();
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
+    FlushStagingConstants();
     commandList_->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+    MarkBoundUAVsAsWritten();
 }
 
 void D3D12CommandContext::DrawIndirect(
@@ -673,7 +745,9 @@ void D3D12CommandContext::DrawIndirect(
     FlushResourceBarriers();
     FlushDeferredPipelineState();
     FlushGraphicsStagingDescriptorTables();
+    FlushStagingConstants();
     commandList_->ExecuteIndirect(commandSignature, maxCommandCount, argumentBuffer, argumentBufferOffset, countBuffer, countBufferOffset);
+    MarkBoundUAVsAsWritten();
 }
 
 void D3D12CommandContext::Dispatch(
@@ -683,9 +757,155 @@ void D3D12CommandContext::Dispatch(
 {
     FlushResourceBarriers();
     FlushComputeStagingDescriptorTables();
+    FlushStagingConstants();
     commandList_->Dispatch(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+    MarkBoundUAVsAsWritten();
 }
 
+#if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+void D3D12CommandContext::DispatchMesh(
+    UINT threadGroupCountX,
+    UINT threadGroupCountY,
+    UINT threadGroupCountZ)
+{
+    if (commandList6_)
+    {
+        FlushResourceBarriers();
+        FlushDeferredPipelineState();
+        FlushGraphicsStagingDescriptorTables();
+        FlushStagingConstants();
+        commandList6_->DispatchMesh(threadGroupCountX, threadGroupCountY, threadGroupCountZ);
+        MarkBoundUAVsAsWritten();
+    }
+}
+
+#endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+#if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+void D3D12CommandContext::SetShadingRate(D3D12_SHADING_RATE shadingRate)
+{
+    if (commandList5_)
+    {
+        /* Combine per-draw rate with per-primitive rate by passthrough, and with the shading-rate image by taking the coarser rate */
+        const D3D12_SHADING_RATE_COMBINER combiners[D3D12_RS_SET_SHADING_RATE_COMBINER_COUNT] =
+        {
+            D3D12_SHADING_RATE_COMBINER_PASSTHROUGH,
+            D3D12_SHADING_RATE_COMBINER_MAX,
+        };
+        commandList5_->RSSetShadingRate(shadingRate, combiners);
+    }
+}
+
+void D3D12CommandContext::SetShadingRateImage(ID3D12Resource* shadingRateImage)
+{
+    if (commandList5_ && shadingRateImage_ != shadingRateImage)
+    {
+        commandList5_->RSSetShadingRateImage(shadingRateImage);
+        shadingRateImage_ = shadingRateImage;
+    }
+}
+
+#endif // /LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+#if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+void D3D12CommandContext::SetViewInstanceMask(UINT mask)
+{
+    if (commandList1_)
+        commandList1_->SetViewInstanceMask(mask);
+}
+
+#endif // /LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+#if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+void D3D12CommandContext::ResolveSamplerFeedback(
+    D3D12Resource&  dstResource,
+    UINT            dstSubresource,
+    D3D12Resource&  srcResource,
+    UINT            srcSubresource)
+{
+    if (!commandList1_)
+        return;
+
+    TransitionResource(dstResource, D3D12_RESOURCE_STATE_RESOLVE_DEST);
+    TransitionResource(srcResource, D3D12_RESOURCE_STATE_RESOLVE_SOURCE, true);
+
+    /* Decode opaque feedback map into R8_UINT texture; the source rectangle must be null for sampler feedback */
+    commandList1_->ResolveSubresourceRegion(
+        dstResource.native.Get(),
+        dstSubresource,
+        0,
+        0,
+        srcResource.native.Get(),
+        srcSubresource,
+        nullptr,
+        DXGI_FORMAT_R8_UINT,
+        D3D12_RESOLVE_MODE_DECODE_SAMPLER_FEEDBACK
+    );
+}
+
+void D3D12CommandContext::ClearSamplerFeedback(D3D12Resource& resource, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
+{
+    /* Copy UAV into shader-visible staging heap, since ClearUnorderedAccessViewUint requires both a GPU and CPU descriptor handle */
+    D3D12DescriptorHeapSetLayout oldLayout;
+    D3D12RootParameterIndices oldRootParamIndices;
+    GetStagingDescriptorHeaps(oldLayout, oldRootParamIndices);
+
+    D3D12DescriptorHeapSetLayout newLayout;
+    newLayout.numHeapResourceViews = 1;
+    SetStagingDescriptorHeaps(newLayout, {});
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = CopyDescriptorsForStaging(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, cpuDescHandle, 1);
+
+    /* Clear values are ignored for opaque feedback maps; clearing marks all MIP regions as not sampled */
+    TransitionResource(resource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+    const UINT clearValues[4] = { 0, 0, 0, 0 };
+    commandList_->ClearUnorderedAccessViewUint(gpuDescHandle, cpuDescHandle, resource.native.Get(), clearValues, 0, nullptr);
+
+    SetStagingDescriptorHeaps(oldLayout, oldRootParamIndices);
+}
+
+#endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+#if LLGL_D3D12_ENABLE_RAYTRACING
+
+void D3D12CommandContext::SetStateObject(ID3D12StateObject* stateObject)
+{
+    if (commandList4_)
+    {
+        commandList4_->SetPipelineState1(stateObject);
+
+        /* Invalidate cached PSO, so the next call to SetPipelineState is not filtered out */
+        stateCache_.pipelineState           = nullptr;
+        stateCache_.stateBits.isDeferredPSO = 0;
+    }
+}
+
+void D3D12CommandContext::BuildRaytracingAccelerationStructure(const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC& desc)
+{
+    if (commandList4_)
+    {
+        FlushResourceBarriers();
+        commandList4_->BuildRaytracingAccelerationStructure(&desc, 0, nullptr);
+    }
+}
+
+void D3D12CommandContext::DispatchRays(const D3D12_DISPATCH_RAYS_DESC& desc)
+{
+    if (commandList4_)
+    {
+        FlushResourceBarriers();
+        FlushComputeStagingDescriptorTables();
+        FlushStagingConstants();
+        commandList4_->DispatchRays(&desc);
+        MarkBoundUAVsAsWritten();
+    }
+}
+
+#endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
 void D3D12CommandContext::DispatchIndirect(
     ID3D12CommandSignature* commandSignature,
     UINT                    maxCommandCount,
@@ -696,7 +916,9 @@ void D3D12CommandContext::DispatchIndirect(
 {
     FlushResourceBarriers();
     FlushComputeStagingDescriptorTables();
+    FlushStagingConstants();
     commandList_->ExecuteIndirect(commandSignature, maxCommandCount, argumentBuffer, argumentBufferOffset, countBuffer, countBufferOffset);
+    MarkBoundUAVsAsWritten();
 }
 
 
@@ -719,16 +941,417 @@ void D3D12CommandContext::ClearCache()
     /* Clear cached resource states */
     cachedResourceStates_.clear();
 
+    /* Drop root constants that were staged but never used by a draw or dispatch command */
+    stagingConstants_.numValues = 0;
+
+    /* Clear UAV barrier slots; writes from previous command lists are synchronized at ExecuteCommandLists boundaries */
     numUAVBarriers_ = 0;
+    writtenUAVs_.clear();
+
+    #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+    /* Shading-rate image is reset with each command list */
+    shadingRateImage_ = nullptr;
+    #endif
 }
 
 D3D12_RESOURCE_BARRIER& D3D12CommandContext::NextResourceBarrier()
 {
     if (numResourceBarriers_ == D3D12CommandContext::maxNumResourceBarrieres)
-        FlushResourceBarriers();
+        SubmitResourceBarriers();
     return resourceBarriers_[numResourceBarriers_++];
 }
 
+void D3D12CommandContext::SubmitResourceBarriers()
+{
+    if (numResourceBarriers_ > 0)
+    {
+        #if LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+        if (commandList7_ && SubmitEnhancedBarriers())
+        {
+            numResourceBarriers_ = 0;
+            return;
+        }
+        #endif // /LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+
+        commandList_->ResourceBarrier(numResourceBarriers_, resourceBarriers_);
+        LLGL_PROFILE_COUNTER_ADD(barriers, numResourceBarriers_);
+        numResourceBarriers_ = 0;
+    }
+}
+
+#if LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+
+// Synchronization scope, access, and layout of an enhanced barrier that corresponds to a legacy resource state.
+struct D3D12EnhancedBarrierScope
+{
+    D3D12_BARRIER_SYNC      sync;
+    D3D12_BARRIER_ACCESS    access;
+    D3D12_BARRIER_LAYOUT    layout;
+    bool                    isReadOnly;
+};
+
+// Maps the specified legacy resource state to an enhanced barrier scope. Returns false if the state cannot be mapped unambiguously.
+static bool GetEnhancedBarrierScope(D3D12_RESOURCE_STATES state, D3D12_COMMAND_LIST_TYPE commandListType, D3D12EnhancedBarrierScope& outScope)
+{
+    struct StateMapping
+    {
+        D3D12_RESOURCE_STATES   state;
+        D3D12_BARRIER_SYNC      sync;
+        D3D12_BARRIER_ACCESS    access;
+        D3D12_BARRIER_LAYOUT    layout;
+        bool                    isReadOnly;
+    };
+
+    static const StateMapping stateMappings[] =
+    {
+        { D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER, D3D12_BARRIER_SYNC_ALL_SHADING,       D3D12_BARRIER_ACCESS_VERTEX_BUFFER | D3D12_BARRIER_ACCESS_CONSTANT_BUFFER, D3D12_BARRIER_LAYOUT_GENERIC_READ,        true  },
+        { D3D12_RESOURCE_STATE_INDEX_BUFFER,               D3D12_BARRIER_SYNC_INDEX_INPUT,       D3D12_BARRIER_ACCESS_INDEX_BUFFER,                                         D3D12_BARRIER_LAYOUT_GENERIC_READ,        true  },
+        { D3D12_RESOURCE_STATE_RENDER_TARGET,              D3D12_BARRIER_SYNC_RENDER_TARGET,     D3D12_BARRIER_ACCESS_RENDER_TARGET,                                        D3D12_BARRIER_LAYOUT_RENDER_TARGET,       false },
+        { D3D12_RESOURCE_STATE_UNORDERED_ACCESS,           D3D12_BARRIER_SYNC_ALL_SHADING | D3D12_BARRIER_SYNC_CLEAR_UNORDERED_ACCESS_VIEW,
+                                                                                                 D3D12_BARRIER_ACCESS_UNORDERED_ACCESS,                                     D3D12_BARRIER_LAYOUT_UNORDERED_ACCESS,    false },
+        { D3D12_RESOURCE_STATE_DEPTH_WRITE,                D3D12_BARRIER_SYNC_DEPTH_STENCIL,     D3D12_BARRIER_ACCESS_DEPTH_STENCIL_WRITE,                                  D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_WRITE, false },
+        { D3D12_RESOURCE_STATE_DEPTH_READ,                 D3D12_BARRIER_SYNC_DEPTH_STENCIL,     D3D12_BARRIER_ACCESS_DEPTH_STENCIL_READ,                                   D3D12_BARRIER_LAYOUT_DEPTH_STENCIL_READ,  true  },
+        { D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,  D3D12_BARRIER_SYNC_NON_PIXEL_SHADING, D3D12_BARRIER_ACCESS_SHADER_RESOURCE,                                      D3D12_BARRIER_LAYOUT_SHADER_RESOURCE,     true  },
+        { D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,      D3D12_BARRIER_SYNC_PIXEL_SHADING,     D3D12_BARRIER_ACCESS_SHADER_RESOURCE,                                      D3D12_BARRIER_LAYOUT_SHADER_RESOURCE,     true  },
+        { D3D12_RESOURCE_STATE_STREAM_OUT,                 D3D12_BARRIER_SYNC_VERTEX_SHADING,    D3D12_BARRIER_ACCESS_STREAM_OUTPUT,                                        D3D12_BARRIER_LAYOUT_COMMON,              false },
+        { D3D12_RESOURCE_STATE_INDIRECT_ARGUMENT,          D3D12_BARRIER_SYNC_EXECUTE_INDIRECT,  D3D12_BARRIER_ACCESS_INDIRECT_ARGUMENT,                                    D3D12_BARRIER_LAYOUT_GENERIC_READ,        true  },
+        { D3D12_RESOURCE_STATE_COPY_DEST,                  D3D12_BARRIER_SYNC_COPY,              D3D12_BARRIER_ACCESS_COPY_DEST,                                            D3D12_BARRIER_LAYOUT_COPY_DEST,           false },
+        { D3D12_RESOURCE_STATE_COPY_SOURCE,                D3D12_BARRIER_SYNC_COPY,              D3D12_BARRIER_ACCESS_COPY_SOURCE,                                          D3D12_BARRIER_LAYOUT_COPY_SOURCE,         true  },
+        { D3D12_RESOURCE_STATE_RESOLVE_DEST,               D3D12_BARRIER_SYNC_RESOLVE,           D3D12_BARRIER_ACCESS_RESOLVE_DEST,                                         D3D12_BARRIER_LAYOUT_RESOLVE_DEST,        false },
+        { D3D12_RESOURCE_STATE_RESOLVE_SOURCE,             D3D12_BARRIER_SYNC_RESOLVE,           D3D12_BARRIER_ACCESS_RESOLVE_SOURCE,                                       D3D12_BARRIER_LAYOUT_RESOLVE_SOURCE,      true  },
+    };
+
+    if (state == D3D12_RESOURCE_STATE_COMMON)
+    {
+        /* Common state (aka. present state) provides no information about the previous or next access */
+        outScope = { D3D12_BARRIER_SYNC_ALL, D3D12_BARRIER_ACCESS_COMMON, D3D12_BARRIER_LAYOUT_COMMON, false };
+        return true;
+    }
+
+    outScope = { D3D12_BARRIER_SYNC_NONE, D3D12_BARRIER_ACCESS_COMMON, D3D12_BARRIER_LAYOUT_UNDEFINED, true };
+
+    UINT remainingStates = static_cast<UINT>(state);
+    UINT numLayouts = 0;
+
+    for (const StateMapping& mapping : stateMappings)
+    {
+        if ((state & mapping.state) != 0)
+        {
+            outScope.sync       |= mapping.sync;
+            outScope.access     |= mapping.access;
+            outScope.isReadOnly &= mapping.isReadOnly;
+            if (outScope.layout != mapping.layout)
+            {
+                outScope.layout = mapping.layout;
+                ++numLayouts;
+            }
+            remainingStates &= ~static_cast<UINT>(mapping.state);
+        }
+    }
+
+    /* Don't translate states we have no mapping for, e.g. raytracing acceleration structures or video states */
+    if (remainingStates != 0)
+        return false;
+
+    if (numLayouts > 1)
+    {
+        /* Combined states must be read-only and can only share the generic read layout if none of them is a depth-stencil state */
+        if (!outScope.isReadOnly || (state & D3D12_RESOURCE_STATE_DEPTH_READ) != 0)
+            return false;
+        outScope.layout = D3D12_BARRIER_LAYOUT_GENERIC_READ;
+    }
+
+    if (commandListType == D3D12_COMMAND_LIST_TYPE_COPY)
+    {
+        /* Copy queues only support the copy synchronization scope */
+        outScope.sync = D3D12_BARRIER_SYNC_COPY;
+    }
+
+    return true;
+}
+
+static bool IsD3D12BufferResource(ID3D12Resource* resource)
+{
+    return (resource->GetDesc().Dimension == D3D12_RESOURCE_DIMENSION_BUFFER);
+}
+
+static D3D12_BARRIER_SUBRESOURCE_RANGE GetD3D12BarrierSubresourceRange(UINT subresource)
+{
+    /* A subresource index with zero MIP-map levels selects a single subresource; 0xFFFFFFFF selects all subresources */
+    D3D12_BARRIER_SUBRESOURCE_RANGE range = {};
+    range.IndexOrFirstMipLevel = subresource;
+    return range;
+}
+
+void D3D12CommandContext::QueryEnhancedBarriersInterface()
+{
+    commandList7_.Reset();
+
+    D3D12_FEATURE_DATA_D3D12_OPTIONS12 options12 = {};
+    HRESULT hr = device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS12, &options12, sizeof(options12));
+    if (SUCCEEDED(hr) && options12.EnhancedBarriersSupported)
+        commandList_->QueryInterface(IID_PPV_ARGS(commandList7_.ReleaseAndGetAddressOf()));
+}
+
+bool D3D12CommandContext::SubmitEnhancedBarriers()
+{
+    D3D12_GLOBAL_BARRIER    globalBarriers[1];
+    D3D12_BUFFER_BARRIER    bufferBarriers[D3D12CommandContext::maxNumResourceBarrieres];
+    D3D12_TEXTURE_BARRIER   textureBarriers[D3D12CommandContext::maxNumResourceBarrieres];
+    UINT                    numGlobalBarriers   = 0;
+    UINT                    numBufferBarriers   = 0;
+    UINT                    numTextureBarriers  = 0;
+
+    for_range(i, numResourceBarriers_)
+    {
+        const D3D12_RESOURCE_BARRIER& barrier = resourceBarriers_[i];
+        switch (barrier.Type)
+        {
+            case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
+            {
+                D3D12EnhancedBarrierScope scopeBefore, scopeAfter;
+                if (!GetEnhancedBarrierScope(barrier.Transition.StateBefore, commandListType_, scopeBefore) ||
+                    !GetEnhancedBarrierScope(barrier.Transition.StateAfter, commandListType_, scopeAfter))
+                {
+                    return false;
+                }
+
+                if (IsD3D12BufferResource(barrier.Transition.pResource))
+                {
+                    /* Buffers have no layout, so a transition between two read-only states doesn't need any synchronization */
+                    if (scopeBefore.isReadOnly && scopeAfter.isReadOnly)
+                        break;
+
+                    D3D12_BUFFER_BARRIER& bufferBarrier = bufferBarriers[numBufferBarriers++];
+                    bufferBarrier.SyncBefore    = scopeBefore.sync;
+                    bufferBarrier.SyncAfter     = scopeAfter.sync;
+                    bufferBarrier.AccessBefore  = scopeBefore.access;
+                    bufferBarrier.AccessAfter   = scopeAfter.access;
+                    bufferBarrier.pResource     = barrier.Transition.pResource;
+                    bufferBarrier.Offset        = 0;
+                    bufferBarrier.Size          = UINT64_MAX;
+                }
+                else
+                {
+                    /* Texture states on copy queues implicitly decay to the common state, which has no equivalent layout transition */
+                    if (commandListType_ == D3D12_COMMAND_LIST_TYPE_COPY)
+                        return false;
+
+                    /* Skip transitions between two read-only states that share the same layout */
+                    if (scopeBefore.isReadOnly && scopeAfter.isReadOnly && scopeBefore.layout == scopeAfter.layout)
+                        break;
+
+                    D3D12_TEXTURE_BARRIER& textureBarrier = textureBarriers[numTextureBarriers++];
+                    textureBarrier.SyncBefore   = scopeBefore.sync;
+                    textureBarrier.SyncAfter    = scopeAfter.sync;
+                    textureBarrier.AccessBefore = scopeBefore.access;
+                    textureBarrier.AccessAfter  = scopeAfter.access;
+                    textureBarrier.LayoutBefore = scopeBefore.layout;
+                    textureBarrier.LayoutAfter  = scopeAfter.layout;
+                    textureBarrier.pResource    = barrier.Transition.pResource;
+                    textureBarrier.Subresources = GetD3D12BarrierSubresourceRange(barrier.Transition.Subresource);
+                    textureBarrier.Flags        = D3D12_TEXTURE_BARRIER_FLAG_NONE;
+                }
+            }
+            break;
+
+            case D3D12_RESOURCE_BARRIER_TYPE_UAV:
+            {
+                D3D12EnhancedBarrierScope scope;
+                GetEnhancedBarrierScope(D3D12_RESOURCE_STATE_UNORDERED_ACCESS, commandListType_, scope);
+
+                if (barrier.UAV.pResource == nullptr)
+                {
+                    /* Synchronize all unordered access writes with a single global barrier */
+                    if (numGlobalBarriers == 0)
+                    {
+                        D3D12_GLOBAL_BARRIER& globalBarrier = globalBarriers[numGlobalBarriers++];
+                        globalBarrier.SyncBefore    = scope.sync;
+                        globalBarrier.SyncAfter     = scope.sync;
+                        globalBarrier.AccessBefore  = scope.access;
+                        globalBarrier.AccessAfter   = scope.access;
+                    }
+                }
+                else if (IsD3D12BufferResource(barrier.UAV.pResource))
+                {
+                    D3D12_BUFFER_BARRIER& bufferBarrier = bufferBarriers[numBufferBarriers++];
+                    bufferBarrier.SyncBefore    = scope.sync;
+                    bufferBarrier.SyncAfter     = scope.sync;
+                    bufferBarrier.AccessBefore  = scope.access;
+                    bufferBarrier.AccessAfter   = scope.access;
+                    bufferBarrier.pResource     = barrier.UAV.pResource;
+                    bufferBarrier.Offset        = 0;
+                    bufferBarrier.Size          = UINT64_MAX;
+                }
+                else
+                {
+                    D3D12_TEXTURE_BARRIER& textureBarrier = textureBarriers[numTextureBarriers++];
+                    textureBarrier.SyncBefore   = scope.sync;
+                    textureBarrier.SyncAfter    = scope.sync;
+                    textureBarrier.AccessBefore = scope.access;
+                    textureBarrier.AccessAfter  = scope.access;
+                    textureBarrier.LayoutBefore = scope.layout;
+                    textureBarrier.LayoutAfter  = scope.layout;
+                    textureBarrier.pResource    = barrier.UAV.pResource;
+                    textureBarrier.Subresources = GetD3D12BarrierSubresourceRange(D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+                    textureBarrier.Flags        = D3D12_TEXTURE_BARRIER_FLAG_NONE;
+                }
+            }
+            break;
+
+            default:
+            {
+                /* Aliasing barriers are submitted with the legacy ResourceBarrier command */
+                return false;
+            }
+        }
+    }
+
+    /* Submit all barriers with a single command */
+    D3D12_BARRIER_GROUP barrierGroups[3];
+    UINT numBarrierGroups = 0;
+
+    if (numGlobalBarriers > 0)
+    {
+        D3D12_BARRIER_GROUP& group = barrierGroups[numBarrierGroups++];
+        group.Type              = D3D12_BARRIER_TYPE_GLOBAL;
+        group.NumBarriers       = numGlobalBarriers;
+        group.pGlobalBarriers   = globalBarriers;
+    }
+    if (numBufferBarriers > 0)
+    {
+        D3D12_BARRIER_GROUP& group = barrierGroups[numBarrierGroups++];
+        group.Type              = D3D12_BARRIER_TYPE_BUFFER;
+        group.NumBarriers       = numBufferBarriers;
+        group.pBufferBarriers   = bufferBarriers;
+    }
+    if (numTextureBarriers > 0)
+    {
+        D3D12_BARRIER_GROUP& group = barrierGroups[numBarrierGroups++];
+        group.Type              = D3D12_BARRIER_TYPE_TEXTURE;
+        group.NumBarriers       = numTextureBarriers;
+        group.pTextureBarriers  = textureBarriers;
+    }
+
+    if (numBarrierGroups > 0)
+    {
+        commandList7_->Barrier(numBarrierGroups, barrierGroups);
+        LLGL_PROFILE_COUNTER_ADD(barriers, numGlobalBarriers + numBufferBarriers + numTextureBarriers);
+    }
+
+    return true;
+}
+
+#endif // /LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+
+#if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+void D3D12CommandContext::QueryMeshShaderInterface()
+{
+    commandList6_.Reset();
+
+    D3D12_FEATURE_DATA_D3D12_OPTIONS7 options7 = {};
+    HRESULT hr = device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS7, &options7, sizeof(options7));
+    if (SUCCEEDED(hr) && options7.MeshShaderTier != D3D12_MESH_SHADER_TIER_NOT_SUPPORTED)
+        commandList_->QueryInterface(IID_PPV_ARGS(commandList6_.ReleaseAndGetAddressOf()));
+}
+
+#endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+#if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+void D3D12CommandContext::QueryVariableRateShadingInterface()
+{
+    commandList5_.Reset();
+
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    HRESULT hr = device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6));
+    if (SUCCEEDED(hr) && options6.VariableShadingRateTier != D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED)
+        commandList_->QueryInterface(IID_PPV_ARGS(commandList5_.ReleaseAndGetAddressOf()));
+}
+
+#endif // /LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+#if LLGL_D3D12_ENABLE_RAYTRACING
+
+void D3D12CommandContext::QueryRayTracingInterface()
+{
+    commandList4_.Reset();
+
+    D3D12_FEATURE_DATA_D3D12_OPTIONS5 options5 = {};
+    HRESULT hr = device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS5, &options5, sizeof(options5));
+    if (SUCCEEDED(hr) && options5.RaytracingTier != D3D12_RAYTRACING_TIER_NOT_SUPPORTED)
+        commandList_->QueryInterface(IID_PPV_ARGS(commandList4_.ReleaseAndGetAddressOf()));
+}
+
+#endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
+#if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+void D3D12CommandContext::QueryViewInstancingInterface()
+{
+    commandList1_.Reset();
+
+    D3D12_FEATURE_DATA_D3D12_OPTIONS3 options3 = {};
+    HRESULT hr = device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS3, &options3, sizeof(options3));
+    bool isSupported = (SUCCEEDED(hr) && options3.ViewInstancingTier != D3D12_VIEW_INSTANCING_TIER_NOT_SUPPORTED);
+
+    #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+    /* Sampler feedback is decoded with ID3D12GraphicsCommandList1::ResolveSubresourceRegion */
+    D3D12_FEATURE_DATA_D3D12_OPTIONS7 options7 = {};
+    hr = device_->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS7, &options7, sizeof(options7));
+    isSupported = isSupported || (SUCCEEDED(hr) && options7.SamplerFeedbackTier != D3D12_SAMPLER_FEEDBACK_TIER_NOT_SUPPORTED);
+    #endif
+
+    if (isSupported)
+        commandList_->QueryInterface(IID_PPV_ARGS(commandList1_.ReleaseAndGetAddressOf()));
+}
+
+#endif // /LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+void D3D12CommandContext::AppendPendingUAVBarriers()
+{
+    /*
+    Only insert UAV barriers for bound resources that have been written by a previous draw or dispatch command.
+    Independent dispatches that write to different UAVs don't need to wait for each other.
+    */
+    for_range(i, numUAVBarriers_)
+    {
+        ID3D12Resource* resource = uavBarrierResources_[i];
+        if (resource != nullptr && RemoveWrittenUAV(resource))
+        {
+            D3D12_RESOURCE_BARRIER& barrier = NextResourceBarrier();
+
+            barrier.Type            = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+            barrier.Flags           = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+            barrier.UAV.pResource   = resource;
+        }
+    }
+}
+
+void D3D12CommandContext::MarkBoundUAVsAsWritten()
+{
+    for_range(i, numUAVBarriers_)
+    {
+        ID3D12Resource* resource = uavBarrierResources_[i];
+        if (resource != nullptr && std::find(writtenUAVs_.begin(), writtenUAVs_.end(), resource) == writtenUAVs_.end())
+            writtenUAVs_.push_back(resource);
+    }
+}
+
+bool D3D12CommandContext::RemoveWrittenUAV(ID3D12Resource* resource)
+{
+    auto it = std::find(writtenUAVs_.begin(), writtenUAVs_.end(), resource);
+    if (it != writtenUAVs_.end())
+    {
+        /* Swap with last entry since the order of written UAVs is irrelevant */
+        *it = writtenUAVs_.back();
+        writtenUAVs_.pop_back();
+        return true;
+    }
+    return false;
+}
+
 D3D12_RESOURCE_BARRIER* D3D12CommandContext::FindSubresourceTransitionBarrier(ID3D12Resource* resource, UINT subresource)
 {
     /* Check if last barrier refers to the same subresource */
@@ -780,14 +1403,15 @@ void D3D12CommandContext::NextCommandAllocator(D3D12CommandQueue& commandQueue)
     HRESULT hr = GetCommandAllocator()->Reset();
     DXThrowIfFailed(hr, "failed to reset D3D12 command allocator");
 
-    /* Reset descriptor heap pools before they are re-used */
+    /* Reclaim ranges of descriptor heap rings that were used by this allocator */
     for_range(i, D3D12CommandContext::maxNumDescriptorHeaps)
-        stagingDescriptorPools_[currentAllocatorIndex_][i].Reset();
+        descriptorHeapRings_[i].BeginSegment(currentAllocatorIndex_);
 
     /* Clear descriptor cache and reset staging buffer pool */
     descriptorCaches_[currentAllocatorIndex_].Clear();
     stagingBufferPools_[currentAllocatorIndex_].Reset();
     intermediateBufferPools_[currentAllocatorIndex_].Reset();
+    transientBufferPools_[currentAllocatorIndex_].Reset();
 }
 
 void D3D12CommandContext::SetPipelineStateCached(ID3D12PipelineState* pipelineState)
@@ -807,23 +1431,69 @@ void D3D12CommandContext::FlushDeferredPipelineState()
         SetPipelineStateCached(stateCache_.deferredPipelineStates[stateCache_.stateBits.is16BitIndexFormat]);
 }
 
+void D3D12CommandContext::StageConstants(bool isCompute, UINT parameterIndex, const UINT* values, UINT numValues, UINT offset)
+{
+    /* Submit previously staged constants if the new values do not continue them */
+    StagingConstants& staging = stagingConstants_;
+    if (staging.numValues > 0)
+    {
+        if (staging.isCompute != isCompute ||
+            staging.parameterIndex != parameterIndex ||
+            staging.offset + staging.numValues != offset ||
+            staging.numValues + numValues > D3D12_MAX_ROOT_COST)
+        {
+            FlushStagingConstants();
+        }
+    }
+
+    if (staging.numValues == 0)
+    {
+        staging.isCompute       = isCompute;
+        staging.parameterIndex  = parameterIndex;
+        staging.offset          = offset;
+    }
+
+    /* Root signatures cannot exceed D3D12_MAX_ROOT_COST, so a single root parameter never needs more values than that */
+    numValues = std::min<UINT>(numValues, D3D12_MAX_ROOT_COST - staging.numValues);
+    ::memcpy(staging.values + staging.numValues, values, sizeof(UINT) * numValues);
+    staging.numValues += numValues;
+}
+
+void D3D12CommandContext::FlushStagingConstants()
+{
+    StagingConstants& staging = stagingConstants_;
+    if (staging.numValues > 0)
+    {
+        if (staging.isCompute)
+            commandList_->SetComputeRoot32BitConstants(staging.parameterIndex, staging.numValues, staging.values, staging.offset);
+        else
+            commandList_->SetGraphicsRoot32BitConstants(staging.parameterIndex, staging.numValues, staging.values, staging.offset);
+        staging.numValues = 0;
+    }
+}
+
 void D3D12CommandContext::FlushGraphicsStagingDescriptorTables()
 {
     D3D12DescriptorCache& descriptorCache = descriptorCaches_[currentAllocatorIndex_];
     if (descriptorCache.IsInvalidated())
     {
-        auto& currentPoolSet = stagingDescriptorPools_[currentAllocatorIndex_];
         if (stagingDescriptorSetLayout_.numResourceViews > 0)
         {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushCbvSrvUavDescriptors(currentPoolSet[0]);
+            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushCbvSrvUavDescriptors(descriptorHeapRings_[0]);
             if (gpuDescHandle.ptr != 0)
+            {
+                BindDescriptorHeapRings();
                 commandList_->SetGraphicsRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[0], gpuDescHandle);
+            }
         }
         if (stagingDescriptorSetLayout_.numSamplers > 0)
         {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushSamplerDescriptors(currentPoolSet[1]);
+            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushSamplerDescriptors(descriptorHeapRings_[1]);
             if (gpuDescHandle.ptr != 0)
+            {
+                BindDescriptorHeapRings();
                 commandList_->SetGraphicsRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[1], gpuDescHandle);
+            }
         }
     }
 }
@@ -833,22 +1503,48 @@ void D3D12CommandContext::FlushComputeStagingDescriptorTables()
     D3D12DescriptorCache& descriptorCache = descriptorCaches_[currentAllocatorIndex_];
     if (descriptorCache.IsInvalidated())
     {
-        auto& currentPoolSet = stagingDescriptorPools_[currentAllocatorIndex_];
         if (stagingDescriptorSetLayout_.numResourceViews > 0)
         {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushCbvSrvUavDescriptors(currentPoolSet[0]);
+            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushCbvSrvUavDescriptors(descriptorHeapRings_[0]);
             if (gpuDescHandle.ptr != 0)
+            {
+                BindDescriptorHeapRings();
                 commandList_->SetComputeRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[0], gpuDescHandle);
+            }
         }
         if (stagingDescriptorSetLayout_.numSamplers > 0)
         {
-            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushSamplerDescriptors(currentPoolSet[1]);
+            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descriptorCache.FlushSamplerDescriptors(descriptorHeapRings_[1]);
             if (gpuDescHandle.ptr != 0)
+            {
+                BindDescriptorHeapRings();
                 commandList_->SetComputeRootDescriptorTable(stagingDescriptorIndices_.rootParamDescriptors[1], gpuDescHandle);
+            }
         }
     }
 }
 
+void D3D12CommandContext::BindDescriptorHeapRings()
+{
+    ID3D12DescriptorHeap* const descriptorHeaps[D3D12CommandContext::maxNumDescriptorHeaps] =
+    {
+        descriptorHeapRings_[0].GetNative(),
+        descriptorHeapRings_[1].GetNative(),
+    };
+
+    if (stateCache_.dirtyBits.descriptorHeaps == 0 &&
+        CompareDescriptorHeapRefs(D3D12CommandContext::maxNumDescriptorHeaps, descriptorHeaps, stateCache_.numDescriptorHeaps, stateCache_.descriptorHeaps))
+    {
+        return;
+    }
+
+    /* Descriptor tables that were flushed into a previous heap can no longer be used */
+    const bool wasBound = (stateCache_.dirtyBits.descriptorHeaps == 0 && stateCache_.numDescriptorHeaps > 0);
+    SetDescriptorHeaps(D3D12CommandContext::maxNumDescriptorHeaps, descriptorHeaps);
+    if (wasBound)
+        descriptorCaches_[currentAllocatorIndex_].Clear();
+}
+
 
 } // /namespace LLGL
 
@@ -12,16 +12,26 @@
 #include "../../DXCommon/ComPtr.h"
 #include "../RenderState/D3D12Fence.h"
 #include "../RenderState/D3D12PipelineLayout.h"
-#include "../RenderState/D3D12StagingDescriptorHeapPool.h"
+#include "../RenderState/D3D12DescriptorHeapRing.h"
 #include "../RenderState/D3D12DescriptorCache.h"
 #include "../Buffer/D3D12StagingBufferPool.h"
 #include "../Buffer/D3D12IntermediateBufferPool.h"
+#include "../Buffer/D3D12TransientBufferPool.h"
+#include "../D3D12Types.h"
 #include "../../../Core/CompilerExtensions.h"
 #include <d3d12.h>
 #include <cstddef>
 #include <cstdint>
 
 
+// Enhanced barriers (ID3D12GraphicsCommandList7::Barrier) are only available with newer Windows SDKs.
+#if defined __ID3D12GraphicsCommandList7_INTERFACE_DEFINED__
+#   define LLGL_D3D12_ENABLE_ENHANCED_BARRIERS 1
+#else
+#   define LLGL_D3D12_ENABLE_ENHANCED_BARRIERS 0
+#endif
+
+
 namespace LLGL
 {
 
@@ -29,6 +39,7 @@ namespace LLGL
 struct D3D12Resource;
 class D3D12Device;
 class D3D12CommandQueue;
+class D3D12ResourceHeap;
 
 struct D3D12Constant
 {
@@ -96,6 +107,9 @@ class D3D12CommandContext
         // Insert a resource barrier for an unordered access view (UAV).
         void UAVBarrier(ID3D12Resource* resource, bool flushImmediate = false);
 
+        // Insert an aliasing barrier between two resources that share the same heap memory. Null resources refer to any placed resource.
+        void AliasingBarrier(ID3D12Resource* resourceBefore, ID3D12Resource* resourceAfter, bool flushImmediate = false);
+
         // Insert a transition barrier for a native D3D12 subresource.
         void TransitionBarrier(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState, D3D12_RESOURCE_STATES oldState, bool flushImmediate = false);
         void TransitionBarrier(ID3D12Resource* resource, D3D12_RESOURCE_STATES newState, D3D12_RESOURCE_STATES oldState, UINT subresource, bool flushImmediate);
@@ -103,7 +117,10 @@ class D3D12CommandContext
         // Transition and cache a resource state.
         void TransitionResource(D3D12Resource& resource, D3D12_RESOURCE_STATES newState, bool flushImmediate = false);
 
-        // Flush all accumulated resource barriers.
+        /*
+        Flush all accumulated resource barriers with a single ResourceBarrier command.
+        This also appends UAV barriers for all bound UAVs that have been written by a previous draw or dispatch command.
+        */
         void FlushResourceBarriers();
 
         void ResolveSubresource(
@@ -134,6 +151,8 @@ class D3D12CommandContext
 
         ID3D12Resource* AllocIntermediateBuffer(UINT64 size, UINT alignment = 256u);
 
+        TransientBufferAllocation AllocTransientBuffer(UINT64 size, long bindFlags, UINT64 alignment);
+
         void SetGraphicsRootSignature(ID3D12RootSignature* rootSignature);
         void SetComputeRootSignature(ID3D12RootSignature* rootSignature);
 
@@ -150,22 +169,37 @@ class D3D12CommandContext
         void SetGraphicsConstant(UINT parameterIndex, D3D12Constant value, UINT offset);
         void SetComputeConstant(UINT parameterIndex, D3D12Constant value, UINT offset);
 
+        /*
+        Stages the specified 32-bit values for the root constants of the graphics or compute root signature.
+        Values that continue the previously staged values of the same root parameter are coalesced into a single command,
+        which is submitted with the next draw or dispatch command or when the root signature changes.
+        */
+        void StageGraphicsConstants(UINT parameterIndex, const UINT* values, UINT numValues, UINT offset);
+        void StageComputeConstants(UINT parameterIndex, const UINT* values, UINT numValues, UINT offset);
+
         void SetGraphicsRootParameter(UINT parameterIndex, D3D12_ROOT_PARAMETER_TYPE parameterType, D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr);
         void SetComputeRootParameter(UINT parameterIndex, D3D12_ROOT_PARAMETER_TYPE parameterType, D3D12_GPU_VIRTUAL_ADDRESS gpuVirtualAddr);
 
         void SetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW& indexBufferView);
 
-        D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandle(D3D12_DESCRIPTOR_HEAP_TYPE type, UINT descriptor) const;
-
+        // Copies the specified descriptors into the shader-visible descriptor heap ring for the current command list.
         D3D12_GPU_DESCRIPTOR_HANDLE CopyDescriptorsForStaging(
             D3D12_DESCRIPTOR_HEAP_TYPE  type,
             D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
-            UINT                        firstDescriptor,
             UINT                        numDescriptors
         );
 
+        // Returns the persistent descriptor table for the specified set of a resource heap and only copies its descriptors if they have changed.
+        D3D12_GPU_DESCRIPTOR_HANDLE CopyPersistentDescriptorsForStaging(
+            D3D12_DESCRIPTOR_HEAP_TYPE  type,
+            const D3D12ResourceHeap&    resourceHeap,
+            std::uint32_t               descriptorSet
+        );
+
         void EmplaceDescriptorForStaging(Resource& resource, const D3D12DescriptorHeapLocation& descriptorLocation);
+        void EmplaceConstantBufferRangeForStaging(D3D12Buffer& bufferD3D, const D3D12DescriptorHeapLocation& descriptorLocation, UINT64 offset, UINT64 size);
 
+        // Resets the UAV barrier slots for the current PSO. Resources written by previous draw or dispatch commands remain tracked.
         void ResetUAVBarriers(UINT numUAVBarriers);
         void SetResourceUAVBarrier(ID3D12Resource* resource, UINT uavBarrierSlot);
         void SetResourceUAVBarrier(Resource& resource, const D3D12DescriptorHeapLocation& descriptorLocation);
@@ -200,6 +234,59 @@ class D3D12CommandContext
             UINT threadGroupCountZ
         );
 
+        #if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        void DispatchMesh(
+            UINT threadGroupCountX,
+            UINT threadGroupCountY,
+            UINT threadGroupCountZ
+        );
+
+        #endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+        // Sets the per-draw shading rate. The rate is combined with the shading-rate image by taking the coarser rate.
+        void SetShadingRate(D3D12_SHADING_RATE shadingRate);
+
+        // Sets the shading-rate image if it differs from the current one. Null resets the shading-rate image.
+        void SetShadingRateImage(ID3D12Resource* shadingRateImage);
+
+        #endif // /LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+        #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+        // Sets the mask of enabled view instances for view-instanced PSOs.
+        void SetViewInstanceMask(UINT mask);
+
+        #endif // /LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+        #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+        // Decodes the specified subresource of a sampler feedback map into an R8_UINT texture.
+        void ResolveSamplerFeedback(
+            D3D12Resource&  dstResource,
+            UINT            dstSubresource,
+            D3D12Resource&  srcResource,
+            UINT            srcSubresource
+        );
+
+        // Clears the entire sampler feedback map with the specified non-shader-visible UAV descriptor.
+        void ClearSamplerFeedback(D3D12Resource& resource, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
+
+        #endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+        #if LLGL_D3D12_ENABLE_RAYTRACING
+
+        // Binds the specified ray tracing state object and invalidates the cached PSO, since both share the same binding point.
+        void SetStateObject(ID3D12StateObject* stateObject);
+
+        void BuildRaytracingAccelerationStructure(const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC& desc);
+
+        void DispatchRays(const D3D12_DISPATCH_RAYS_DESC& desc);
+
+        #endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
         void DispatchIndirect(
             ID3D12CommandSignature* commandSignature,
             UINT                    maxCommandCount,
@@ -217,6 +304,12 @@ class D3D12CommandContext
             return device_;
         }
 
+        // Returns the type of command lists this command context records, e.g. D3D12_COMMAND_LIST_TYPE_COPY for the upload queue.
+        inline D3D12_COMMAND_LIST_TYPE GetCommandListType() const
+        {
+            return commandListType_;
+        }
+
         // Returns the currently bound PSO.
         inline ID3D12PipelineState* GetCurrentPipelineState() const
         {
@@ -269,6 +362,16 @@ class D3D12CommandContext
             ID3D12DescriptorHeap*   descriptorHeaps[maxNumDescriptorHeaps]  = {};
         };
 
+        // Consecutive 32-bit root constants that have not been submitted to the command list yet.
+        struct StagingConstants
+        {
+            bool    isCompute                   = false;
+            UINT    parameterIndex              = 0;
+            UINT    offset                      = 0;
+            UINT    numValues                   = 0;
+            UINT    values[D3D12_MAX_ROOT_COST] = {};
+        };
+
     private:
 
         // Clears the internal cached states.
@@ -280,6 +383,59 @@ class D3D12CommandContext
 
         void TransitionResourceInternal(D3D12Resource& resource, D3D12_RESOURCE_STATES newState);
 
+        // Submits all accumulated resource barriers without appending pending UAV barriers.
+        void SubmitResourceBarriers();
+
+        #if LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+
+        // Queries the ID3D12GraphicsCommandList7 interface if the device supports enhanced barriers.
+        void QueryEnhancedBarriersInterface();
+
+        /*
+        Translates all accumulated legacy resource barriers into enhanced barriers and submits them with a single Barrier command.
+        Returns false if the barriers cannot be translated, in which case they must be submitted with ResourceBarrier instead.
+        */
+        bool SubmitEnhancedBarriers();
+
+        #endif // /LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+
+        #if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        // Queries the ID3D12GraphicsCommandList6 interface if the device supports mesh shaders.
+        void QueryMeshShaderInterface();
+
+        #endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+        // Queries the ID3D12GraphicsCommandList5 interface if the device supports variable rate shading.
+        void QueryVariableRateShadingInterface();
+
+        #endif // /LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+
+        #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+        // Queries the ID3D12GraphicsCommandList1 interface if the device supports view instancing or sampler feedback.
+        void QueryViewInstancingInterface();
+
+        #endif // /LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+        #if LLGL_D3D12_ENABLE_RAYTRACING
+
+        // Queries the ID3D12GraphicsCommandList4 interface if the device supports ray tracing.
+        void QueryRayTracingInterface();
+
+        #endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
+        // Appends UAV barriers for all bound UAVs that have been written since their last barrier.
+        void AppendPendingUAVBarriers();
+
+        // Marks all bound UAVs as written after a draw or dispatch command.
+        void MarkBoundUAVsAsWritten();
+
+        // Removes the specified resource from the list of written UAVs. Returns false if the resource was not in that list.
+        bool RemoveWrittenUAV(ID3D12Resource* resource);
+
         void CacheResourceState(D3D12Resource* resource, D3D12_RESOURCE_STATES state, bool& outIsBeginState);
 
         // Switches to the next command allocator and resets it.
@@ -292,6 +448,14 @@ class D3D12CommandContext
         void FlushGraphicsStagingDescriptorTables();
         void FlushComputeStagingDescriptorTables();
 
+        void StageConstants(bool isCompute, UINT parameterIndex, const UINT* values, UINT numValues, UINT offset);
+
+        // Submits the staged root constants with a single SetGraphicsRoot32BitConstants or SetComputeRoot32BitConstants command.
+        void FlushStagingConstants();
+
+        // Binds the descriptor heap rings and invalidates the descriptor cache if a ring has replaced its native heap.
+        void BindDescriptorHeapRings();
+
         // Returns the current command allocator.
         inline ID3D12CommandAllocator* GetCommandAllocator() const
         {
@@ -311,25 +475,45 @@ class D3D12CommandContext
         D3D12NativeFence                        allocatorFence_;
 
         ComPtr<ID3D12GraphicsCommandList>       commandList_;
+        #if LLGL_D3D12_ENABLE_ENHANCED_BARRIERS
+        ComPtr<ID3D12GraphicsCommandList7>      commandList7_;                              // Only set if the device supports enhanced barriers
+        D3D12_COMMAND_LIST_TYPE                 commandListType_                            = D3D12_COMMAND_LIST_TYPE_DIRECT;
+        #endif
+        #if LLGL_D3D12_ENABLE_MESH_SHADERS
+        ComPtr<ID3D12GraphicsCommandList6>      commandList6_;                              // Only set if the device supports mesh shaders
+        #endif
+        #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+        ComPtr<ID3D12GraphicsCommandList5>      commandList5_;                              // Only set if the device supports variable rate shading
+        ID3D12Resource*                         shadingRateImage_                           = nullptr;
+        #endif
+        #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+        ComPtr<ID3D12GraphicsCommandList1>      commandList1_;                              // Only set if the device supports view instancing or sampler feedback
+        #endif
+        #if LLGL_D3D12_ENABLE_RAYTRACING
+        ComPtr<ID3D12GraphicsCommandList4>      commandList4_;                              // Only set if the device supports ray tracing
+        #endif
 
         D3D12_RESOURCE_BARRIER                  resourceBarriers_[maxNumResourceBarrieres];
         UINT                                    numResourceBarriers_                        = 0;
 
-        std::vector<D3D12_RESOURCE_BARRIER>     uavBarriers_;
+        std::vector<ID3D12Resource*>            uavBarrierResources_;                       // Resources bound to the UAV barrier slots of the current PSO
         UINT                                    numUAVBarriers_                             = 0;
+        std::vector<ID3D12Resource*>            writtenUAVs_;                               // UAVs written by draw or dispatch commands since their last barrier
 
         bool                                    doCacheResourceStates_                      = false;
         std::vector<D3D12ResourceTransitionExt> cachedResourceStates_; // Last recorded resource states for multi-submit command buffers
 
-        D3D12StagingDescriptorHeapPool          stagingDescriptorPools_[maxNumAllocators][maxNumDescriptorHeaps];
+        D3D12DescriptorHeapRing                 descriptorHeapRings_[maxNumDescriptorHeaps];
         D3D12DescriptorHeapSetLayout            stagingDescriptorSetLayout_;
         D3D12RootParameterIndices               stagingDescriptorIndices_;
         D3D12DescriptorCache                    descriptorCaches_[maxNumAllocators];
 
         D3D12StagingBufferPool                  stagingBufferPools_[maxNumAllocators];
         D3D12IntermediateBufferPool             intermediateBufferPools_[maxNumAllocators];
+        D3D12TransientBufferPool                transientBufferPools_[maxNumAllocators];
 
         StateCache                              stateCache_;
+        StagingConstants                        stagingConstants_;
 
 };
 
@@ -7,13 +7,19 @@
 
 #include "D3D12CommandQueue.h"
 #include "D3D12CommandBuffer.h"
+#include "D3D12UploadQueue.h"
 #include "../D3D12ObjectUtils.h"
 #include "../D3D12RenderSystem.h"
+#include "../D3D12SwapChain.h"
 #include "../RenderState/D3D12Fence.h"
 #include "../RenderState/D3D12QueryHeap.h"
+#include "../Texture/D3D12Texture.h"
 #include "../../CheckedCast.h"
 #include "../../DXCommon/DXCore.h"
+#include "../../FrameArena.h"
+#include "../../SubmissionThread.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 
 
 namespace LLGL
@@ -22,12 +28,14 @@ namespace LLGL
 
 D3D12CommandQueue::D3D12CommandQueue(
     D3D12Device&            device,
-    D3D12_COMMAND_LIST_TYPE type)
+    D3D12_COMMAND_LIST_TYPE type,
+    D3D12CommandQueue*      primaryQueue)
 :
-    native_     { device.CreateDXCommandQueue(type) },
-    queueFence_ { device.GetNative()                }
+    native_       { device.CreateDXCommandQueue(type) },
+    primaryQueue_ { primaryQueue                      },
+    queueFence_   { device.GetNative()                }
 {
-    commandContext_.Create(device);
+    commandContext_.Create(device, type);
     DetermineTimestampFrequency();
 }
 
@@ -40,10 +48,75 @@ void D3D12CommandQueue::SetDebugName(const char* name)
 
 void D3D12CommandQueue::Submit(CommandBuffer& commandBuffer)
 {
-    /* Execute command list */
+    /* Immediate command buffers have already been submitted by CommandBuffer::End() */
     auto& commandBufferD3D = LLGL_CAST(D3D12CommandBuffer&, commandBuffer);
-    if (!commandBufferD3D.IsImmediateCmdBuffer())
-        SubmitCommandContext(commandBufferD3D.GetCommandContext());
+    if (commandBufferD3D.IsImmediateCmdBuffer())
+        return;
+
+    D3D12CommandContext* commandContext = &(commandBufferD3D.GetCommandContext());
+    if (submissionThread_ != nullptr)
+    {
+        /* Execute command list on the submission thread; the command buffer waits for this ticket before it records again */
+        const std::uint64_t ticket = submissionThread_->Enqueue(
+            [this, commandContext]()
+            {
+                SubmitCommandContext(*commandContext);
+            }
+        );
+        commandBufferD3D.SetSubmissionTicket(ticket);
+    }
+    else
+        SubmitCommandContext(*commandContext);
+}
+
+void D3D12CommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Gather command contexts to execute their command lists in batches */
+    SmallVector<D3D12CommandContext*> commandContexts;
+    commandContexts.reserve(numCommandBuffers);
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] == nullptr)
+            continue;
+
+        auto* commandBufferD3D = LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i]);
+        if (!commandBufferD3D->IsImmediateCmdBuffer())
+            commandContexts.push_back(&(commandBufferD3D->GetCommandContext()));
+    }
+
+    if (submissionThread_ != nullptr)
+    {
+        /* Execute all command lists on the submission thread and store the ticket in each command buffer */
+        const std::uint64_t ticket = submissionThread_->Enqueue(
+            [this, commandContexts]()
+            {
+                SubmitCommandContexts(commandContexts.size(), commandContexts.data());
+            }
+        );
+        for_range(i, numCommandBuffers)
+        {
+            if (commandBuffers[i] != nullptr)
+                LLGL_CAST(D3D12CommandBuffer*, commandBuffers[i])->SetSubmissionTicket(ticket);
+        }
+    }
+    else
+        SubmitCommandContexts(commandContexts.size(), commandContexts.data());
+}
+
+void D3D12CommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    /* Gather swap-chains to present them in order with as few submission thread jobs as possible */
+    SmallVector<D3D12SwapChain*> swapChainsD3D;
+    swapChainsD3D.reserve(numSwapChains);
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr)
+            swapChainsD3D.push_back(LLGL_CAST(D3D12SwapChain*, swapChains[i]));
+    }
+
+    D3D12SwapChain::PresentBatch(static_cast<std::uint32_t>(swapChainsD3D.size()), swapChainsD3D.data());
 }
 
 /* ----- Queries ----- */
@@ -57,9 +130,13 @@ bool D3D12CommandQueue::QueryResult(
 {
     auto& queryHeapD3D = LLGL_CAST(D3D12QueryHeap&, queryHeap);
 
+    /* Queries might be resolved by command lists that are still pending on the submission thread */
+    FlushSubmissionThread();
+
     /* Ensure query results have been resolved */
     if (queryHeapD3D.InsideDirtyRange(firstQuery, numQueries))
     {
+        std::lock_guard<std::recursive_mutex> guard{ mutex_ };
         queryHeapD3D.FlushDirtyRange(commandContext_.GetCommandList());
         FinishAndSubmitCommandContext(commandContext_, true);
     }
@@ -99,9 +176,50 @@ bool D3D12CommandQueue::QueryResult(
 
 void D3D12CommandQueue::Submit(Fence& fence)
 {
+    /* Advance the fence value on the calling thread, so the fence can be waited for before its signal has been submitted */
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    ID3D12Fence* nativeFence = fenceD3D.GetNative();
+    const UINT64 value = fenceD3D.Signal();
+
     /* Schedule signal command into the queue */
+    if (submissionThread_ != nullptr)
+        submissionThread_->Enqueue([this, nativeFence, value]() { SignalFence(nativeFence, value); });
+    else
+        SignalFence(nativeFence, value);
+}
+
+void D3D12CommandQueue::SubmitWait(Fence& fence)
+{
+    /* Schedule GPU-side wait for the last signaled value of the fence */
     auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
-    SignalFence(fenceD3D.GetNative(), fenceD3D.Signal());
+    ID3D12Fence* nativeFence = fenceD3D.GetNative();
+    const UINT64 value = fenceD3D.GetSignaledValue();
+
+    auto waitForFence = [this, nativeFence, value]()
+    {
+        HRESULT hr = native_->Wait(nativeFence, value);
+        DXThrowIfFailed(hr, "failed to wait for D3D12 fence with command queue");
+    };
+
+    if (submissionThread_ != nullptr)
+        submissionThread_->Enqueue(waitForFence);
+    else
+        waitForFence();
+}
+
+void D3D12CommandQueue::UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings)
+{
+    /* Tile mappings are queue operations, so they are ordered with all command lists executed on this queue */
+    FlushSubmissionThread();
+    for_range(i, numMappings)
+    {
+        if (Texture* texture = mappings[i].texture)
+        {
+            auto& textureD3D = LLGL_CAST(D3D12Texture&, *texture);
+            if (D3D12SparseTextureMemory* sparseMemory = textureD3D.GetSparseMemory())
+                sparseMemory->UpdateTiles(native_.Get(), mappings[i]);
+        }
+    }
 }
 
 bool D3D12CommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
@@ -112,33 +230,88 @@ bool D3D12CommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 
 void D3D12CommandQueue::WaitIdle()
 {
-    /* Submit intermediate fence and wait for it to be signaled */
-    if (busy_)
-    {
-        ++queueFenceValue_;
-        SignalFence(queueFence_.Get(), queueFenceValue_);
-        queueFence_.WaitForHigherSignal(queueFenceValue_);
-        busy_ = false;
-    }
+    FlushSubmissionThread();
+    WaitForQueueFence();
 }
 
 /* ----- Internal ----- */
 
+std::unique_lock<std::recursive_mutex> D3D12CommandQueue::Lock()
+{
+    /* Wait for pending submissions first, since the worker thread needs this lock to execute them */
+    FlushSubmissionThread();
+    return std::unique_lock<std::recursive_mutex>{ mutex_ };
+}
+
 void D3D12CommandQueue::SignalFence(ID3D12Fence* fence, UINT64 value)
 {
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
     HRESULT hr = native_->Signal(fence, value);
     DXThrowIfFailed(hr, "failed to signal D3D12 fence with command queue");
     busy_ = true;
 }
 
+UINT64 D3D12CommandQueue::SignalQueueFence()
+{
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
+    ++queueFenceValue_;
+    SignalFence(queueFence_.Get(), queueFenceValue_);
+    return queueFenceValue_;
+}
+
+void D3D12CommandQueue::SetSubmissionThread(SubmissionThread* submissionThread)
+{
+    submissionThread_ = submissionThread;
+}
+
+void D3D12CommandQueue::FlushSubmissionThread()
+{
+    if (submissionThread_ != nullptr)
+        submissionThread_->Flush();
+}
+
+std::uint64_t D3D12CommandQueue::SubmitImmediateCommandContext(D3D12CommandContext& commandContext)
+{
+    if (submissionThread_ != nullptr)
+    {
+        /* Immediate command buffers must be submitted through the submission thread as well to keep all command lists in order */
+        D3D12CommandContext* commandContextRef = &commandContext;
+        return submissionThread_->Enqueue([this, commandContextRef]() { SubmitCommandContext(*commandContextRef); });
+    }
+    SubmitCommandContext(commandContext);
+    return 0;
+}
+
+void D3D12CommandQueue::SetUploadQueue(D3D12UploadQueue* uploadQueue)
+{
+    uploadQueue_        = uploadQueue;
+    uploadFenceValue_   = 0;
+}
+
 void D3D12CommandQueue::SubmitCommandContext(D3D12CommandContext& commandContext)
 {
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
     /* If resource transitions where cached, execute them now to ensure the resources are in the correct state at the beginning and end of the command list */
     if (commandContext.HasCachedResourceStates())
     {
-        D3D12CommandContext& cmdQueueContext = GetContext();
-        cmdQueueContext.ExecuteResourceTransitions(commandContext);
-        FinishAndSubmitCommandContext(cmdQueueContext);
+        if (primaryQueue_ != nullptr)
+        {
+            /* Compute and copy command lists can't transition all resource states, so execute them on the primary queue and wait for them on the GPU */
+            D3D12CommandContext& primaryQueueContext = primaryQueue_->GetContext();
+            primaryQueueContext.ExecuteResourceTransitions(commandContext);
+            primaryQueue_->FinishAndSubmitCommandContext(primaryQueueContext);
+            HRESULT hr = native_->Wait(primaryQueue_->queueFence_.Get(), primaryQueue_->SignalQueueFence());
+            DXThrowIfFailed(hr, "failed to wait for resource transitions of D3D12 primary command queue");
+        }
+        else
+        {
+            D3D12CommandContext& cmdQueueContext = GetContext();
+            cmdQueueContext.ExecuteResourceTransitions(commandContext);
+            FinishAndSubmitCommandContext(cmdQueueContext);
+        }
     }
 
     /* Execute command list on queue and signal */
@@ -146,26 +319,55 @@ void D3D12CommandQueue::SubmitCommandContext(D3D12CommandContext& commandContext
     commandContext.Signal(*this);
 }
 
+void D3D12CommandQueue::SubmitCommandContextBatch(std::size_t numCommandContexts, D3D12CommandContext* const * commandContexts)
+{
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
+    if (numCommandContexts == 0)
+        return;
+
+    /* Execute all command lists on queue at once, then signal each context */
+    FrameSmallVector<ID3D12CommandList*> commandLists;
+    commandLists.reserve(numCommandContexts);
+    for_range(i, numCommandContexts)
+        commandLists.push_back(commandContexts[i]->GetCommandList());
+
+    ExecuteCommandLists(static_cast<UINT>(commandLists.size()), commandLists.data());
+
+    for_range(i, numCommandContexts)
+        commandContexts[i]->Signal(*this);
+}
+
 void D3D12CommandQueue::FinishAndSubmitCommandContext(D3D12CommandContext& commandContext, bool syncWithGPU)
 {
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
     /* Close command list and execute, then reset command allocator for next encoding */
     commandContext.Close();
     SubmitCommandContext(commandContext);
     commandContext.Reset(*this);
 
-    /* Sync CPU/GPU */
+    /* Sync CPU/GPU; The caller holds the lock, so pending jobs of the submission thread have already been executed */
     if (syncWithGPU)
-        WaitIdle();
+        WaitForQueueFence();
 }
 
 void D3D12CommandQueue::ExecuteCommandLists(UINT numCommandsLists, ID3D12CommandList* const* commandLists)
 {
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
+    if (uploadQueue_ != nullptr)
+        WaitForPendingUploads();
     native_->ExecuteCommandLists(numCommandsLists, commandLists);
     busy_ = true;
 }
 
 void D3D12CommandQueue::ExecuteCommandList(ID3D12CommandList* commandList)
 {
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
+    if (uploadQueue_ != nullptr)
+        WaitForPendingUploads();
     native_->ExecuteCommandLists(1, &commandList);
     busy_ = true;
 }
@@ -175,6 +377,54 @@ void D3D12CommandQueue::ExecuteCommandList(ID3D12CommandList* commandList)
  * ======= Private: =======
  */
 
+void D3D12CommandQueue::SubmitCommandContexts(std::size_t numCommandContexts, D3D12CommandContext* const * commandContexts)
+{
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
+    /* Gather command contexts to execute their command lists in batches */
+    FrameSmallVector<D3D12CommandContext*> commandContextBatch;
+    commandContextBatch.reserve(numCommandContexts);
+
+    for_range(i, numCommandContexts)
+    {
+        D3D12CommandContext* commandContext = commandContexts[i];
+        if (commandContext->HasCachedResourceStates())
+        {
+            /* Resource transitions must be executed between the previous and this command list, so split the batch here */
+            SubmitCommandContextBatch(commandContextBatch.size(), commandContextBatch.data());
+            commandContextBatch.clear();
+            SubmitCommandContext(*commandContext);
+        }
+        else
+            commandContextBatch.push_back(commandContext);
+    }
+
+    SubmitCommandContextBatch(commandContextBatch.size(), commandContextBatch.data());
+}
+
+void D3D12CommandQueue::WaitForQueueFence()
+{
+    std::lock_guard<std::recursive_mutex> guard{ mutex_ };
+
+    /* Submit intermediate fence and wait for it to be signaled */
+    if (busy_)
+    {
+        queueFence_.WaitForHigherSignal(SignalQueueFence());
+        busy_ = false;
+    }
+}
+
+void D3D12CommandQueue::WaitForPendingUploads()
+{
+    const UINT64 uploadFenceValue = uploadQueue_->Flush();
+    if (uploadFenceValue_ < uploadFenceValue)
+    {
+        HRESULT hr = native_->Wait(uploadQueue_->GetFence(), uploadFenceValue);
+        DXThrowIfFailed(hr, "failed to wait for uploads of D3D12 copy queue");
+        uploadFenceValue_ = uploadFenceValue;
+    }
+}
+
 void D3D12CommandQueue::DetermineTimestampFrequency()
 {
     /* Get timestamp frequency for command queue */
@@ -217,6 +467,22 @@ void D3D12CommandQueue::QueryResultSingleUInt64(
         }
         break;
 
+        case QueryType::Timestamp:
+        {
+            /* Convert single timestamp to nanoseconds */
+            auto* mappedDataUInt64 = static_cast<const std::uint64_t*>(mappedData);
+            const auto timestamp = mappedDataUInt64[query];
+
+            if (!isTimestampNanosecs_)
+            {
+                const auto timestampNanosecs = (static_cast<double>(timestamp) * timestampScale_);
+                data = static_cast<std::uint64_t>(timestampNanosecs + 0.5);
+            }
+            else
+                data = timestamp;
+        }
+        break;
+
         case QueryType::StreamOutPrimitivesWritten:
         {
             auto* mappedDataSOStats = static_cast<const D3D12_QUERY_DATA_SO_STATISTICS*>(mappedData);
@@ -266,6 +532,7 @@ void D3D12CommandQueue::QueryResultUInt64(
     switch (queryType)
     {
         case QueryType::TimeElapsed:
+        case QueryType::Timestamp:
         case QueryType::StreamOutPrimitivesWritten:
         case QueryType::StreamOutOverflow:
         {
@@ -16,6 +16,7 @@
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <cstddef>
+#include <mutex>
 
 
 namespace LLGL
@@ -23,6 +24,8 @@ namespace LLGL
 
 
 class D3D12Device;
+class D3D12UploadQueue;
+class SubmissionThread;
 
 class D3D12CommandQueue final : public CommandQueue
 {
@@ -33,22 +36,74 @@ class D3D12CommandQueue final : public CommandQueue
 
     public:
 
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains) override;
+
+        void SubmitWait(Fence& fence) override;
+
+        void UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings) override;
+
+    public:
+
+        // Constructs the command queue. Dedicated compute and copy queues must refer to the primary queue, which executes their cached resource transitions.
         D3D12CommandQueue(
             D3D12Device&            device,
-            D3D12_COMMAND_LIST_TYPE type = D3D12_COMMAND_LIST_TYPE_DIRECT
+            D3D12_COMMAND_LIST_TYPE type            = D3D12_COMMAND_LIST_TYPE_DIRECT,
+            D3D12CommandQueue*      primaryQueue    = nullptr
         );
 
         void SetDebugName(const char* name) override;
 
     public:
 
+        /*
+        Locks this queue for the calling thread. All functions of this class lock the queue implicitly,
+        but the render system must hold this lock while it records into the context of this queue, since resources can be created on worker threads.
+        This waits for all pending jobs of the submission thread before the lock is acquired.
+        */
+        std::unique_lock<std::recursive_mutex> Lock();
+
         // Submits the specified fence with a custom value.
         void SignalFence(ID3D12Fence* fence, UINT64 value);
 
+        // Signals the internal queue fence with the next value and returns that value.
+        UINT64 SignalQueueFence();
+
+        // Returns true if the GPU has signaled the internal queue fence with the specified value or higher.
+        inline bool IsQueueFenceCompleted(UINT64 value) const
+        {
+            return (queueFence_.GetCompletedValue() >= value);
+        }
+
+        /*
+        Sets the submission thread to execute command lists, fence signals, and GPU-side waits on. If this is null, they are executed on the calling thread.
+        See RenderSystemFlags::SubmissionThread.
+        */
+        void SetSubmissionThread(SubmissionThread* submissionThread);
+
+        // Returns the submission thread of this queue or null if submissions are executed on the calling thread.
+        inline SubmissionThread* GetSubmissionThread() const
+        {
+            return submissionThread_;
+        }
+
+        // Waits until all pending jobs of the submission thread have been executed. This has no effect if there is no submission thread.
+        void FlushSubmissionThread();
+
+        // Submits the command context of an immediate command buffer on the submission thread, or on the calling thread if there is none. Returns the submission ticket.
+        std::uint64_t SubmitImmediateCommandContext(D3D12CommandContext& commandContext);
+
+        // Sets the upload queue whose pending uploads must be submitted and waited for on the GPU before any command list is executed on this queue.
+        void SetUploadQueue(D3D12UploadQueue* uploadQueue);
+
         // Executes the command context and encodes resource transitions if the context has cached barriers.
         void SubmitCommandContext(D3D12CommandContext& commandContext);
         void FinishAndSubmitCommandContext(D3D12CommandContext& commandContext, bool syncWithGPU = false);
 
+        // Executes the command lists of all specified contexts with a single call to ExecuteCommandLists. None of them must have cached resource states.
+        void SubmitCommandContextBatch(std::size_t numCommandContexts, D3D12CommandContext* const * commandContexts);
+
         // Executes the specified command lists.
         void ExecuteCommandLists(UINT numCommandsLists, ID3D12CommandList* const* commandLists);
         void ExecuteCommandList(ID3D12CommandList* commandList);
@@ -67,6 +122,15 @@ class D3D12CommandQueue final : public CommandQueue
 
     private:
 
+        // Executes the command lists of the specified contexts in batches; Batches are split at contexts with cached resource states.
+        void SubmitCommandContexts(std::size_t numCommandContexts, D3D12CommandContext* const * commandContexts);
+
+        // Submits an intermediate fence and waits until the GPU has passed it. Unlike WaitIdle(), this doesn't wait for the submission thread.
+        void WaitForQueueFence();
+
+        // Submits the pending uploads of the upload queue and schedules a GPU-side wait for them.
+        void WaitForPendingUploads();
+
         void DetermineTimestampFrequency();
 
         void QueryResultSingleUInt64(
@@ -102,7 +166,12 @@ class D3D12CommandQueue final : public CommandQueue
 
     private:
 
+        std::recursive_mutex        mutex_;
         ComPtr<ID3D12CommandQueue>  native_;
+        D3D12CommandQueue*          primaryQueue_           = nullptr;
+        D3D12UploadQueue*           uploadQueue_            = nullptr;
+        SubmissionThread*           submissionThread_       = nullptr;
+        UINT64                      uploadFenceValue_       = 0;    // Last upload fence value this queue has waited for
         D3D12CommandContext         commandContext_;
         D3D12NativeFence            queueFence_;
         UINT64                      queueFenceValue_        = 0;
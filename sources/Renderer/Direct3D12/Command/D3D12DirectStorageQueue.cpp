@@ -0,0 +1,157 @@
+/*
+ * D3D12DirectStorageQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+#include "D3D12DirectStorageQueue.h"
+#include "../../DXCommon/DXCore.h"
+#include <LLGL/Container/UTF8String.h>
+#include <limits>
+
+
+namespace LLGL
+{
+
+
+D3D12DirectStorageQueue::D3D12DirectStorageQueue(ID3D12Device* device) :
+    fence_ { device }
+{
+    /* DirectStorage is optional at runtime, so failing to load its factory leaves this queue unavailable */
+    HRESULT hr = DStorageGetFactory(IID_PPV_ARGS(factory_.ReleaseAndGetAddressOf()));
+    if (FAILED(hr))
+        return;
+
+    DSTORAGE_QUEUE_DESC queueDesc = {};
+    {
+        queueDesc.SourceType    = DSTORAGE_REQUEST_SOURCE_FILE;
+        queueDesc.Capacity      = DSTORAGE_MAX_QUEUE_CAPACITY;
+        queueDesc.Priority      = DSTORAGE_PRIORITY_NORMAL;
+        queueDesc.Name          = "LLGL.DirectStorageQueue";
+        queueDesc.Device        = device;
+    }
+    hr = factory_->CreateQueue(&queueDesc, IID_PPV_ARGS(queue_.ReleaseAndGetAddressOf()));
+    if (FAILED(hr))
+        queue_.Reset();
+}
+
+D3D12DirectStorageQueue::~D3D12DirectStorageQueue()
+{
+    /* Wait until DirectStorage has finished all requests before the queue and its files are released */
+    if (IsAvailable() && fenceValue_ > 0)
+        fence_.WaitForHigherSignal(fenceValue_);
+}
+
+void D3D12DirectStorageQueue::EnqueueBufferUpload(const FileUploadDescriptor& upload, ID3D12Resource* dstBuffer, UINT64 dstOffset)
+{
+    DSTORAGE_REQUEST request = {};
+    {
+        request.Options.DestinationType     = DSTORAGE_REQUEST_DESTINATION_BUFFER;
+        request.Destination.Buffer.Resource = dstBuffer;
+        request.Destination.Buffer.Offset   = dstOffset;
+        request.Destination.Buffer.Size     = static_cast<UINT32>(upload.compression != FileCompression::Uncompressed ? upload.uncompressedSize : upload.fileSize);
+    }
+    EnqueueRequest(request, upload);
+}
+
+void D3D12DirectStorageQueue::EnqueueTextureUpload(const FileUploadDescriptor& upload, ID3D12Resource* dstTexture, UINT dstSubresource, const D3D12_BOX& dstRegion)
+{
+    DSTORAGE_REQUEST request = {};
+    {
+        request.Options.DestinationType                 = DSTORAGE_REQUEST_DESTINATION_TEXTURE_REGION;
+        request.Destination.Texture.Resource            = dstTexture;
+        request.Destination.Texture.SubresourceIndex    = dstSubresource;
+        request.Destination.Texture.Region              = dstRegion;
+    }
+    EnqueueRequest(request, upload);
+}
+
+void D3D12DirectStorageQueue::Submit(ID3D12Fence* fence, UINT64 value)
+{
+    /* Signal internal fence to keep all files of this batch open until DirectStorage has finished reading from them */
+    PendingFiles pendingFiles;
+    pendingFiles.files.reserve(openFiles_.size());
+    for (auto& entry : openFiles_)
+        pendingFiles.files.push_back(std::move(entry.second));
+    openFiles_.clear();
+
+    pendingFiles.fenceValue = ++fenceValue_;
+    queue_->EnqueueSignal(fence_.Get(), pendingFiles.fenceValue);
+    pendingFiles_.push_back(std::move(pendingFiles));
+
+    if (fence != nullptr)
+        queue_->EnqueueSignal(fence, value);
+
+    queue_->Submit();
+
+    RecycleFiles();
+}
+
+bool D3D12DirectStorageQueue::IsUploadSizeSupported(const FileUploadDescriptor& upload)
+{
+    constexpr std::uint64_t maxRequestSize = std::numeric_limits<UINT32>::max();
+    return
+    (
+        upload.fileSize <= maxRequestSize &&
+        (upload.compression == FileCompression::Uncompressed || upload.uncompressedSize <= maxRequestSize)
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static DSTORAGE_COMPRESSION_FORMAT ToDStorageCompressionFormat(const FileCompression compression)
+{
+    switch (compression)
+    {
+        case FileCompression::Uncompressed: return DSTORAGE_COMPRESSION_FORMAT_NONE;
+        case FileCompression::GDeflate:     return DSTORAGE_COMPRESSION_FORMAT_GDEFLATE;
+    }
+    return DSTORAGE_COMPRESSION_FORMAT_NONE;
+}
+
+IDStorageFile* D3D12DirectStorageQueue::OpenFile(const char* filename)
+{
+    /* Re-use file if it has already been opened for the current batch */
+    ComPtr<IDStorageFile>& file = openFiles_[filename];
+    if (file.Get() == nullptr)
+    {
+        SmallVector<wchar_t> filenameUTF16 = UTF8String{ filename }.to_utf16();
+        HRESULT hr = factory_->OpenFile(filenameUTF16.data(), IID_PPV_ARGS(file.ReleaseAndGetAddressOf()));
+        DXThrowIfFailed(hr, "failed to open file for DirectStorage upload");
+    }
+    return file.Get();
+}
+
+void D3D12DirectStorageQueue::EnqueueRequest(DSTORAGE_REQUEST& request, const FileUploadDescriptor& upload)
+{
+    request.Options.SourceType          = DSTORAGE_REQUEST_SOURCE_FILE;
+    request.Options.CompressionFormat   = ToDStorageCompressionFormat(upload.compression);
+    request.Source.File.Source          = OpenFile(upload.filename);
+    request.Source.File.Offset          = upload.fileOffset;
+    request.Source.File.Size            = static_cast<UINT32>(upload.fileSize);
+    request.UncompressedSize            = static_cast<UINT32>(upload.compression != FileCompression::Uncompressed ? upload.uncompressedSize : upload.fileSize);
+    queue_->EnqueueRequest(&request);
+}
+
+void D3D12DirectStorageQueue::RecycleFiles()
+{
+    const UINT64 completedValue = fence_.GetCompletedValue();
+    while (!pendingFiles_.empty() && pendingFiles_.front().fenceValue <= completedValue)
+        pendingFiles_.pop_front();
+}
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+
+
+// ================================================================================
@@ -0,0 +1,108 @@
+/*
+ * D3D12DirectStorageQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_DIRECT_STORAGE_QUEUE_H
+#define LLGL_D3D12_DIRECT_STORAGE_QUEUE_H
+
+
+#ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+#include <LLGL/RenderSystemFlags.h>
+#include "../RenderState/D3D12Fence.h"
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <dstorage.h>
+#include <deque>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+/*
+DirectStorage queue to stream file data directly into D3D12 buffers and textures.
+The file data is read into GPU memory without intermediate CPU copies and GDeflate compressed data is decompressed on the GPU.
+Files are kept open until the GPU has completed all requests that read from them.
+*/
+class D3D12DirectStorageQueue
+{
+
+    public:
+
+        // Creates the DirectStorage queue for the specified device. Use IsAvailable() to determine if the DirectStorage runtime could be loaded.
+        D3D12DirectStorageQueue(ID3D12Device* device);
+        ~D3D12DirectStorageQueue();
+
+        D3D12DirectStorageQueue(const D3D12DirectStorageQueue&) = delete;
+        D3D12DirectStorageQueue& operator = (const D3D12DirectStorageQueue&) = delete;
+
+        // Enqueues a request to read the specified file range into the destination buffer range.
+        void EnqueueBufferUpload(const FileUploadDescriptor& upload, ID3D12Resource* dstBuffer, UINT64 dstOffset);
+
+        // Enqueues a request to read the specified file range into the destination texture region.
+        void EnqueueTextureUpload(const FileUploadDescriptor& upload, ID3D12Resource* dstTexture, UINT dstSubresource, const D3D12_BOX& dstRegion);
+
+        // Enqueues a signal for the specified fence after all previous requests and submits them.
+        void Submit(ID3D12Fence* fence = nullptr, UINT64 value = 0);
+
+        // Returns true if the DirectStorage runtime is available.
+        inline bool IsAvailable() const
+        {
+            return (queue_.Get() != nullptr);
+        }
+
+    public:
+
+        // Returns true if the specified file upload can be expressed as a single DirectStorage request, i.e. all sizes fit into 32-bit.
+        static bool IsUploadSizeSupported(const FileUploadDescriptor& upload);
+
+    private:
+
+        struct PendingFiles
+        {
+            std::vector<ComPtr<IDStorageFile>>  files;
+            UINT64                              fenceValue  = 0;
+        };
+
+    private:
+
+        // Returns the DirectStorage file for the specified filename and opens it for the current batch if necessary.
+        IDStorageFile* OpenFile(const char* filename);
+
+        // Enqueues the specified request with its source file and compression format.
+        void EnqueueRequest(DSTORAGE_REQUEST& request, const FileUploadDescriptor& upload);
+
+        // Closes all files whose requests have completed on the GPU.
+        void RecycleFiles();
+
+    private:
+
+        ComPtr<IDStorageFactory>                                    factory_;
+        ComPtr<IDStorageQueue>                                      queue_;
+
+        D3D12NativeFence                                            fence_;
+        UINT64                                                      fenceValue_     = 0;
+
+        std::unordered_map<std::string, ComPtr<IDStorageFile>>      openFiles_;     // Files of the requests that have not been submitted yet
+        std::deque<PendingFiles>                                    pendingFiles_;  // Files of submitted requests that might still be read by DirectStorage
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif // /LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+#endif
+
+
+
+// ================================================================================
@@ -7,37 +7,135 @@
 
 #include "D3D12SignatureFactory.h"
 #include "../../DXCommon/DXCore.h"
+#include <cstring>
 
 
 namespace LLGL
 {
 
 
-static void DXCreateCommandSignature(ID3D12Device* device, ComPtr<ID3D12CommandSignature>& signature, D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride)
+static void DXCreateCommandSignature(
+    ID3D12Device*                       device,
+    ComPtr<ID3D12CommandSignature>&     signature,
+    const D3D12_INDIRECT_ARGUMENT_DESC* argumentDescs,
+    UINT                                numArgumentDescs,
+    UINT                                stride,
+    ID3D12RootSignature*                rootSignature = nullptr)
 {
-    /* Initialize indirect argument descriptor */
-    D3D12_INDIRECT_ARGUMENT_DESC argumentDesc = {};
-    argumentDesc.Type = argumentType;
-
-    /* Create command signature for indirect argument */
+    /* Create command signature for indirect arguments */
     D3D12_COMMAND_SIGNATURE_DESC signatureDesc;
     {
         signatureDesc.ByteStride        = stride;
-        signatureDesc.NumArgumentDescs  = 1;
-        signatureDesc.pArgumentDescs    = &argumentDesc;
+        signatureDesc.NumArgumentDescs  = numArgumentDescs;
+        signatureDesc.pArgumentDescs    = argumentDescs;
         signatureDesc.NodeMask          = 0;
     }
-    HRESULT hr = device->CreateCommandSignature(&signatureDesc, nullptr, IID_PPV_ARGS(signature.ReleaseAndGetAddressOf()));
+    HRESULT hr = device->CreateCommandSignature(&signatureDesc, rootSignature, IID_PPV_ARGS(signature.ReleaseAndGetAddressOf()));
     DXThrowIfCreateFailed(hr, "ID3D12CommandSignature");
 }
 
+static void DXCreateCommandSignature(ID3D12Device* device, ComPtr<ID3D12CommandSignature>& signature, D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride)
+{
+    /* Initialize indirect argument descriptor */
+    D3D12_INDIRECT_ARGUMENT_DESC argumentDesc = {};
+    argumentDesc.Type = argumentType;
+
+    DXCreateCommandSignature(device, signature, &argumentDesc, 1, stride);
+}
+
 void D3D12SignatureFactory::CreateDefaultSignatures(ID3D12Device* device)
 {
+    device_ = device;
     DXCreateCommandSignature(device, signatureDrawIndirect_,        D3D12_INDIRECT_ARGUMENT_TYPE_DRAW,         sizeof(D3D12_DRAW_ARGUMENTS        ));
     DXCreateCommandSignature(device, signatureDrawIndexedIndirect_, D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, sizeof(D3D12_DRAW_INDEXED_ARGUMENTS));
     DXCreateCommandSignature(device, signatureDispatchIndirect_,    D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH,     sizeof(D3D12_DISPATCH_ARGUMENTS    ));
 }
 
+ID3D12CommandSignature* D3D12SignatureFactory::GetSignatureDrawIndirect(UINT stride) const
+{
+    if (stride == sizeof(D3D12_DRAW_ARGUMENTS))
+        return GetSignatureDrawIndirect();
+    else
+        return GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, stride);
+}
+
+ID3D12CommandSignature* D3D12SignatureFactory::GetSignatureDrawIndexedIndirect(UINT stride) const
+{
+    if (stride == sizeof(D3D12_DRAW_INDEXED_ARGUMENTS))
+        return GetSignatureDrawIndexedIndirect();
+    else
+        return GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, stride);
+}
+
+#if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+ID3D12CommandSignature* D3D12SignatureFactory::GetSignatureDispatchMeshIndirect(UINT stride) const
+{
+    /* Mesh dispatch signatures can only be created on devices with mesh shader support, so they are not part of the default signatures */
+    return GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_MESH, stride);
+}
+
+#endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+ID3D12CommandSignature* D3D12SignatureFactory::GetSignatureWithArguments(
+    const D3D12_INDIRECT_ARGUMENT_DESC* argumentDescs,
+    UINT                                numArgumentDescs,
+    UINT                                stride,
+    ID3D12RootSignature*                rootSignature) const
+{
+    std::lock_guard<std::mutex> guard{ argumentSignaturesMutex_ };
+
+    /* Argument descriptors are compared bitwise, so callers must zero-initialize them */
+    const std::size_t argumentDescsSize = sizeof(D3D12_INDIRECT_ARGUMENT_DESC) * numArgumentDescs;
+
+    for (const ArgumentSignature& entry : argumentSignatures_)
+    {
+        if (entry.stride == stride &&
+            entry.rootSignature.Get() == rootSignature &&
+            entry.argumentDescs.size() == numArgumentDescs &&
+            std::memcmp(entry.argumentDescs.data(), argumentDescs, argumentDescsSize) == 0)
+        {
+            return entry.signature.Get();
+        }
+    }
+
+    ArgumentSignature entry;
+    {
+        entry.argumentDescs.assign(argumentDescs, argumentDescs + numArgumentDescs);
+        entry.stride        = stride;
+        entry.rootSignature = rootSignature;
+    }
+    DXCreateCommandSignature(device_, entry.signature, argumentDescs, numArgumentDescs, stride, rootSignature);
+    argumentSignatures_.push_back(std::move(entry));
+    return argumentSignatures_.back().signature.Get();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+ID3D12CommandSignature* D3D12SignatureFactory::GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride) const
+{
+    /* Command buffers can be encoded from multiple threads, so guard the cache of custom signatures */
+    std::lock_guard<std::mutex> guard{ stridedSignaturesMutex_ };
+
+    for (const StridedSignature& entry : stridedSignatures_)
+    {
+        if (entry.argumentType == argumentType && entry.stride == stride)
+            return entry.signature.Get();
+    }
+
+    StridedSignature entry;
+    {
+        entry.argumentType  = argumentType;
+        entry.stride        = stride;
+    }
+    DXCreateCommandSignature(device_, entry.signature, argumentType, stride);
+    stridedSignatures_.push_back(std::move(entry));
+    return stridedSignatures_.back().signature.Get();
+}
+
 
 } // /namespace LLGL
 
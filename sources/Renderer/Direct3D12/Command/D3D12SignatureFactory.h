@@ -9,8 +9,11 @@
 #define LLGL_D3D12_COMMAND_SIGNATURE_POOL_H
 
 
+#include "../D3D12Types.h"
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -39,11 +42,64 @@ class D3D12SignatureFactory
             return signatureDispatchIndirect_.Get();
         }
 
+        // Returns the command signature for draw commands with the specified argument stride. Signatures with non-default stride are created on demand.
+        ID3D12CommandSignature* GetSignatureDrawIndirect(UINT stride) const;
+
+        // Returns the command signature for indexed draw commands with the specified argument stride. Signatures with non-default stride are created on demand.
+        ID3D12CommandSignature* GetSignatureDrawIndexedIndirect(UINT stride) const;
+
+        #if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        // Returns the command signature for mesh dispatch commands with the specified argument stride. These signatures are always created on demand.
+        ID3D12CommandSignature* GetSignatureDispatchMeshIndirect(UINT stride) const;
+
+        #endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        /*
+        Returns the command signature for the specified list of indirect arguments. These signatures are always created on demand.
+        The root signature must be specified if any of the arguments changes root parameters, e.g. D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT.
+        */
+        ID3D12CommandSignature* GetSignatureWithArguments(
+            const D3D12_INDIRECT_ARGUMENT_DESC* argumentDescs,
+            UINT                                numArgumentDescs,
+            UINT                                stride,
+            ID3D12RootSignature*                rootSignature
+        ) const;
+
+    private:
+
+        struct StridedSignature
+        {
+            D3D12_INDIRECT_ARGUMENT_TYPE    argumentType;
+            UINT                            stride;
+            ComPtr<ID3D12CommandSignature>  signature;
+        };
+
+        struct ArgumentSignature
+        {
+            std::vector<D3D12_INDIRECT_ARGUMENT_DESC>   argumentDescs;
+            UINT                                        stride;
+            ComPtr<ID3D12RootSignature>                 rootSignature;  // Keeps the root signature alive, so its address cannot be re-used by another one while this entry is cached
+            ComPtr<ID3D12CommandSignature>              signature;
+        };
+
     private:
 
-        ComPtr<ID3D12CommandSignature> signatureDrawIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDrawIndexedIndirect_;
-        ComPtr<ID3D12CommandSignature> signatureDispatchIndirect_;
+        ID3D12CommandSignature* GetOrCreateStridedSignature(D3D12_INDIRECT_ARGUMENT_TYPE argumentType, UINT stride) const;
+
+    private:
+
+        ID3D12Device*                           device_                         = nullptr;
+
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDrawIndexedIndirect_;
+        ComPtr<ID3D12CommandSignature>          signatureDispatchIndirect_;
+
+        mutable std::mutex                      stridedSignaturesMutex_;
+        mutable std::vector<StridedSignature>   stridedSignatures_;
+
+        mutable std::mutex                      argumentSignaturesMutex_;
+        mutable std::vector<ArgumentSignature>  argumentSignatures_;
 
 };
 
@@ -0,0 +1,99 @@
+/*
+ * D3D12UploadQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12UploadQueue.h"
+#include "../D3D12Device.h"
+#include "../D3D12Resource.h"
+#include "../D3D12SubresourceContext.h"
+
+
+namespace LLGL
+{
+
+
+// Maximum size of intermediate upload resources that are recorded before a batch is submitted to bound the memory overhead
+static constexpr UINT64 g_maxUploadBatchSize = (64ull << 20);
+
+D3D12UploadQueue::D3D12UploadQueue(D3D12Device& device, D3D12CommandQueue& primaryQueue) :
+    queue_ { device, D3D12_COMMAND_LIST_TYPE_COPY, &primaryQueue },
+    fence_ { device.GetNative()                                   }
+{
+    queue_.SetDebugName("LLGL.UploadQueue");
+}
+
+std::unique_lock<std::mutex> D3D12UploadQueue::Lock()
+{
+    return std::unique_lock<std::mutex>{ mutex_ };
+}
+
+void D3D12UploadQueue::EndUpload(D3D12SubresourceContext& subresourceContext, D3D12Resource& dstResource, UINT64 uploadSize)
+{
+    subresourceContext.TakeResources(recordedUpload_.intermediateResources);
+    hasRecordedUploads_ = true;
+    recordedUploadSize_ += uploadSize;
+
+    /*
+    Resources accessed on a copy queue decay to the common state once the command list has been executed.
+    Any command list that uses this resource waits for the upload on the GPU, so the resource can already be considered to be in that state.
+    */
+    dstResource.currentState = D3D12_RESOURCE_STATE_COMMON;
+
+    if (recordedUploadSize_ >= g_maxUploadBatchSize)
+        FlushInternal();
+}
+
+UINT64 D3D12UploadQueue::Flush()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    FlushInternal();
+    return fenceValue_;
+}
+
+void D3D12UploadQueue::WaitIdle()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    FlushInternal();
+    queue_.WaitIdle();
+    submittedUploads_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D12UploadQueue::FlushInternal()
+{
+    if (!hasRecordedUploads_)
+        return;
+
+    /* Submit all recorded uploads with a single fence signal */
+    queue_.FinishAndSubmitCommandContext(queue_.GetContext());
+    recordedUpload_.fenceValue = ++fenceValue_;
+    queue_.SignalFence(fence_.Get(), fenceValue_);
+
+    /* Keep intermediate resources alive until the GPU has passed the upload fence */
+    RecycleUploads();
+    submittedUploads_.push_back(std::move(recordedUpload_));
+    recordedUpload_     = PendingUpload{};
+    recordedUploadSize_ = 0;
+    hasRecordedUploads_ = false;
+}
+
+void D3D12UploadQueue::RecycleUploads()
+{
+    const UINT64 completedValue = fence_.GetCompletedValue();
+    while (!submittedUploads_.empty() && submittedUploads_.front().fenceValue <= completedValue)
+        submittedUploads_.pop_front();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,115 @@
+/*
+ * D3D12UploadQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_UPLOAD_QUEUE_H
+#define LLGL_D3D12_UPLOAD_QUEUE_H
+
+
+#include "D3D12CommandQueue.h"
+#include "../RenderState/D3D12Fence.h"
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <deque>
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+struct D3D12Resource;
+class D3D12Device;
+class D3D12SubresourceContext;
+
+/*
+Dedicated copy queue for uploads of initial resource data.
+Uploads are recorded into a single copy command list and submitted in batches with a single fence signal.
+Command queues that execute command lists wait for all pending uploads on the GPU, so uploads no longer serialize behind rendering work.
+*/
+class D3D12UploadQueue
+{
+
+    public:
+
+        D3D12UploadQueue(D3D12Device& device, D3D12CommandQueue& primaryQueue);
+
+        D3D12UploadQueue(const D3D12UploadQueue&) = delete;
+        D3D12UploadQueue& operator = (const D3D12UploadQueue&) = delete;
+
+        // Locks this upload queue for recording commands into its command context. The lock must be held until EndUpload() has been called.
+        std::unique_lock<std::mutex> Lock();
+
+        /*
+        Takes ownership of the intermediate resources of the specified subresource context and stores the destination resource in the state it decays to.
+        Submits all pending uploads if the accumulated upload size exceeds the batch limit. The lock must be held.
+        */
+        void EndUpload(D3D12SubresourceContext& subresourceContext, D3D12Resource& dstResource, UINT64 uploadSize);
+
+        // Submits all pending uploads with a single fence signal and returns the last signaled fence value.
+        UINT64 Flush();
+
+        // Submits all pending uploads and waits until the GPU has completed all of them.
+        void WaitIdle();
+
+        // Returns the command context to record upload commands. The lock must be held.
+        inline D3D12CommandContext& GetContext()
+        {
+            return queue_.GetContext();
+        }
+
+        // Returns the native fence that is signaled after each batch of uploads.
+        inline ID3D12Fence* GetFence() const
+        {
+            return fence_.Get();
+        }
+
+        // Returns true if the GPU has completed all uploads up to the specified fence value; See Flush().
+        inline bool IsFenceCompleted(UINT64 value) const
+        {
+            return (fence_.GetCompletedValue() >= value);
+        }
+
+    private:
+
+        struct PendingUpload
+        {
+            std::vector<ComPtr<ID3D12Resource>> intermediateResources;
+            UINT64                              fenceValue              = 0;
+        };
+
+    private:
+
+        // Submits all pending uploads. The lock must be held.
+        void FlushInternal();
+
+        // Releases all intermediate resources of uploads the GPU has already completed. The lock must be held.
+        void RecycleUploads();
+
+    private:
+
+        std::mutex                  mutex_;
+        D3D12CommandQueue           queue_;
+        D3D12NativeFence            fence_;
+        UINT64                      fenceValue_         = 0;
+
+        PendingUpload               recordedUpload_;                // Upload that is currently being recorded
+        UINT64                      recordedUploadSize_ = 0;
+        bool                        hasRecordedUploads_ = false;
+        std::deque<PendingUpload>   submittedUploads_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,413 @@
+/*
+ * D3D12MemoryAllocator.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12MemoryAllocator.h"
+#include "D3DX12/d3dx12.h"
+#include "../../Core/CoreUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Size of each heap that placed resources are sub-allocated from.
+static constexpr UINT64 g_heapChunkSize         = 64ull * 1024ull * 1024ull;
+
+// Resources larger than this are created as committed resources, since they would leave most of a heap unused.
+static constexpr UINT64 g_maxPlacedResourceSize = g_heapChunkSize / 4;
+
+
+/*
+ * D3D12MemoryHeap class
+ */
+
+// Single ID3D12Heap chunk with a sorted list of free ranges. Released ranges are merged with their neighbors immediately.
+class D3D12MemoryHeap
+{
+
+    public:
+
+        D3D12MemoryHeap(ID3D12Device* device, D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags, UINT64 size);
+
+        // Allocates a range with the specified size and alignment and returns false if there is no free range large enough.
+        bool Allocate(UINT64 size, UINT64 alignment, UINT64& outOffset);
+
+        // Releases the specified range.
+        void Release(UINT64 offset, UINT64 size);
+
+        // Returns true if the native heap was created successfully.
+        inline bool IsValid() const
+        {
+            return (native_.Get() != nullptr);
+        }
+
+        // Returns true if no range of this heap is in use.
+        inline bool IsEmpty() const
+        {
+            return (usedSize_ == 0);
+        }
+
+        // Returns true if resources of the specified type can be placed into this heap.
+        inline bool IsCompatible(ID3D12Device* device, D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags) const
+        {
+            return (device_ == device && heapType_ == heapType && heapFlags_ == heapFlags);
+        }
+
+        // Returns true if this heap belongs to the same pool as the specified heap.
+        inline bool IsCompatible(const D3D12MemoryHeap& other) const
+        {
+            return IsCompatible(other.device_, other.heapType_, other.heapFlags_);
+        }
+
+        // Returns the native ID3D12Heap object.
+        inline ID3D12Heap* GetNative() const
+        {
+            return native_.Get();
+        }
+
+    private:
+
+        struct FreeRange
+        {
+            UINT64 offset;
+            UINT64 size;
+        };
+
+    private:
+
+        ID3D12Device*           device_     = nullptr;
+        D3D12_HEAP_TYPE         heapType_   = D3D12_HEAP_TYPE_DEFAULT;
+        D3D12_HEAP_FLAGS        heapFlags_  = D3D12_HEAP_FLAG_NONE;
+        ComPtr<ID3D12Heap>      native_;
+        std::vector<FreeRange>  freeRanges_;    // Sorted by offset
+        UINT64                  usedSize_   = 0;
+
+};
+
+D3D12MemoryHeap::D3D12MemoryHeap(ID3D12Device* device, D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags, UINT64 size) :
+    device_    { device    },
+    heapType_  { heapType  },
+    heapFlags_ { heapFlags }
+{
+    D3D12_HEAP_DESC heapDesc;
+    {
+        heapDesc.SizeInBytes    = size;
+        heapDesc.Properties     = CD3DX12_HEAP_PROPERTIES{ heapType };
+        heapDesc.Alignment      = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags          = heapFlags;
+    }
+    HRESULT hr = device->CreateHeap(&heapDesc, IID_PPV_ARGS(native_.ReleaseAndGetAddressOf()));
+    if (SUCCEEDED(hr))
+        freeRanges_.push_back(FreeRange{ 0, size });
+}
+
+bool D3D12MemoryHeap::Allocate(UINT64 size, UINT64 alignment, UINT64& outOffset)
+{
+    /* Find first free range that can hold the aligned allocation */
+    for (auto it = freeRanges_.begin(); it != freeRanges_.end(); ++it)
+    {
+        const UINT64 alignedOffset = GetAlignedSize<UINT64>(it->offset, alignment);
+        const UINT64 padding = alignedOffset - it->offset;
+        if (padding + size > it->size)
+            continue;
+
+        /* Keep leading padding and trailing remainder as free ranges */
+        const FreeRange remainder{ alignedOffset + size, it->size - padding - size };
+        if (padding > 0)
+        {
+            it->size = padding;
+            if (remainder.size > 0)
+                freeRanges_.insert(it + 1, remainder);
+        }
+        else if (remainder.size > 0)
+            *it = remainder;
+        else
+            freeRanges_.erase(it);
+
+        usedSize_ += size;
+        outOffset = alignedOffset;
+        return true;
+    }
+    return false;
+}
+
+void D3D12MemoryHeap::Release(UINT64 offset, UINT64 size)
+{
+    /* Find insertion point to keep free ranges sorted */
+    auto next = std::lower_bound(
+        freeRanges_.begin(), freeRanges_.end(), offset,
+        [](const FreeRange& range, UINT64 offset) -> bool
+        {
+            return (range.offset < offset);
+        }
+    );
+
+    /* Merge with previous and next free range if they are adjacent */
+    const bool mergePrev = (next != freeRanges_.begin() && (next - 1)->offset + (next - 1)->size == offset);
+    const bool mergeNext = (next != freeRanges_.end() && offset + size == next->offset);
+
+    if (mergePrev && mergeNext)
+    {
+        (next - 1)->size += size + next->size;
+        freeRanges_.erase(next);
+    }
+    else if (mergePrev)
+        (next - 1)->size += size;
+    else if (mergeNext)
+    {
+        next->offset = offset;
+        next->size += size;
+    }
+    else
+        freeRanges_.insert(next, FreeRange{ offset, size });
+
+    usedSize_ -= size;
+}
+
+
+/*
+ * D3D12MemoryAllocation class
+ */
+
+D3D12MemoryAllocation::~D3D12MemoryAllocation()
+{
+    Release();
+}
+
+D3D12MemoryAllocation::D3D12MemoryAllocation(D3D12MemoryAllocation&& rhs) noexcept :
+    heap_   { rhs.heap_   },
+    offset_ { rhs.offset_ },
+    size_   { rhs.size_   }
+{
+    rhs.heap_ = nullptr;
+}
+
+D3D12MemoryAllocation& D3D12MemoryAllocation::operator = (D3D12MemoryAllocation&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        Release();
+        heap_       = rhs.heap_;
+        offset_     = rhs.offset_;
+        size_       = rhs.size_;
+        rhs.heap_   = nullptr;
+    }
+    return *this;
+}
+
+void D3D12MemoryAllocation::Release()
+{
+    if (heap_ != nullptr)
+    {
+        D3D12MemoryAllocator::Get().ReleaseRange(heap_, offset_, size_);
+        heap_ = nullptr;
+    }
+}
+
+
+/*
+ * D3D12MemoryAllocator class
+ */
+
+D3D12MemoryAllocator& D3D12MemoryAllocator::Get()
+{
+    static D3D12MemoryAllocator g_instance;
+    return g_instance;
+}
+
+D3D12MemoryAllocator::~D3D12MemoryAllocator()
+{
+    // dummy - required for std::unique_ptr of incomplete type D3D12MemoryHeap in header
+}
+
+void D3D12MemoryAllocator::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    heaps_.erase(
+        std::remove_if(
+            heaps_.begin(), heaps_.end(),
+            [](const std::unique_ptr<D3D12MemoryHeap>& heap) -> bool
+            {
+                return heap->IsEmpty();
+            }
+        ),
+        heaps_.end()
+    );
+    retainEmptyHeaps_ = false;
+}
+
+// Returns true if the specified resource can be placed into a shared heap.
+static bool IsPlacedResourceCandidate(D3D12_HEAP_TYPE heapType, const D3D12_RESOURCE_DESC& desc)
+{
+    if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+        return true;
+
+    /* Textures can only be placed in default heaps; render targets and depth-stencil textures stay committed (see D3D12MemoryAllocator) */
+    return
+    (
+        heapType == D3D12_HEAP_TYPE_DEFAULT             &&
+        desc.SampleDesc.Count <= 1                      &&
+        desc.Layout == D3D12_TEXTURE_LAYOUT_UNKNOWN     &&
+        (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) == 0
+    );
+}
+
+// Determines the allocation size and alignment of a placed resource and updates the alignment of its descriptor.
+static D3D12_RESOURCE_ALLOCATION_INFO GetPlacedResourceAllocationInfo(ID3D12Device* device, D3D12_RESOURCE_DESC& desc)
+{
+    if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+    {
+        /* Buffers always use the default 64 KB placement alignment */
+        desc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        return D3D12_RESOURCE_ALLOCATION_INFO{ GetAlignedSize<UINT64>(desc.Width, D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT), D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT };
+    }
+
+    /* Try small resource alignment first; the device only grants it if the most detailed MIP-map fits into 64 KB */
+    desc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+    D3D12_RESOURCE_ALLOCATION_INFO allocInfo = device->GetResourceAllocationInfo(0, 1, &desc);
+    if (allocInfo.Alignment == D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT)
+        return allocInfo;
+
+    desc.Alignment = 0;
+    return device->GetResourceAllocationInfo(0, 1, &desc);
+}
+
+HRESULT D3D12MemoryAllocator::CreateResource(
+    ID3D12Device*               device,
+    D3D12_HEAP_TYPE             heapType,
+    const D3D12_RESOURCE_DESC&  desc,
+    D3D12_RESOURCE_STATES       initialState,
+    const D3D12_CLEAR_VALUE*    optimizedClearValue,
+    ComPtr<ID3D12Resource>&     outResource,
+    D3D12MemoryAllocation&      outAllocation)
+{
+    /* Release previous resource before its memory range can be reused */
+    outResource.Reset();
+    outAllocation.Release();
+
+    if (IsPlacedResourceCandidate(heapType, desc))
+    {
+        D3D12_RESOURCE_DESC placedDesc = desc;
+        const D3D12_RESOURCE_ALLOCATION_INFO allocInfo = GetPlacedResourceAllocationInfo(device, placedDesc);
+        if (allocInfo.SizeInBytes <= g_maxPlacedResourceSize)
+        {
+            const D3D12_HEAP_FLAGS heapFlags =
+            (
+                desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER
+                    ? D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS
+                    : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES
+            );
+
+            UINT64 offset = 0;
+            if (D3D12MemoryHeap* heap = AllocateRange(device, heapType, heapFlags, allocInfo.SizeInBytes, allocInfo.Alignment, offset))
+            {
+                HRESULT hr = device->CreatePlacedResource(
+                    heap->GetNative(),
+                    offset,
+                    &placedDesc,
+                    initialState,
+                    optimizedClearValue,
+                    IID_PPV_ARGS(outResource.ReleaseAndGetAddressOf())
+                );
+                if (SUCCEEDED(hr))
+                {
+                    outAllocation.heap_     = heap;
+                    outAllocation.offset_   = offset;
+                    outAllocation.size_     = allocInfo.SizeInBytes;
+                    return hr;
+                }
+                ReleaseRange(heap, offset, allocInfo.SizeInBytes);
+            }
+        }
+    }
+
+    /* Fall back to committed resource */
+    const CD3DX12_HEAP_PROPERTIES heapProperties{ heapType };
+    return device->CreateCommittedResource(
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &desc,
+        initialState,
+        optimizedClearValue,
+        IID_PPV_ARGS(outResource.ReleaseAndGetAddressOf())
+    );
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+D3D12MemoryHeap* D3D12MemoryAllocator::AllocateRange(
+    ID3D12Device*       device,
+    D3D12_HEAP_TYPE     heapType,
+    D3D12_HEAP_FLAGS    heapFlags,
+    UINT64              size,
+    UINT64              alignment,
+    UINT64&             outOffset)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Keep one empty heap per pool alive from now on until Clear() is called */
+    retainEmptyHeaps_ = true;
+
+    /* Try to allocate range from existing heaps first */
+    for (const auto& heap : heaps_)
+    {
+        if (heap->IsCompatible(device, heapType, heapFlags) && heap->Allocate(size, alignment, outOffset))
+            return heap.get();
+    }
+
+    /* Allocate new heap; if memory is exhausted, the caller falls back to a committed resource */
+    auto newHeap = MakeUnique<D3D12MemoryHeap>(device, heapType, heapFlags, g_heapChunkSize);
+    if (!newHeap->IsValid() || !newHeap->Allocate(size, alignment, outOffset))
+        return nullptr;
+
+    heaps_.push_back(std::move(newHeap));
+    return heaps_.back().get();
+}
+
+void D3D12MemoryAllocator::ReleaseRange(D3D12MemoryHeap* heap, UINT64 offset, UINT64 size)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    heap->Release(offset, size);
+    if (!heap->IsEmpty())
+        return;
+
+    /* Release empty heap unless it is the only empty heap of its pool, to avoid re-creating heaps for short lived resources */
+    if (retainEmptyHeaps_)
+    {
+        const bool hasOtherEmptyHeap = std::any_of(
+            heaps_.begin(), heaps_.end(),
+            [heap](const std::unique_ptr<D3D12MemoryHeap>& other) -> bool
+            {
+                return (other.get() != heap && other->IsEmpty() && other->IsCompatible(*heap));
+            }
+        );
+        if (!hasOtherEmptyHeap)
+            return;
+    }
+
+    heaps_.erase(
+        std::find_if(
+            heaps_.begin(), heaps_.end(),
+            [heap](const std::unique_ptr<D3D12MemoryHeap>& entry) -> bool
+            {
+                return (entry.get() == heap);
+            }
+        )
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
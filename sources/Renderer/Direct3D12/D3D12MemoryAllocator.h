@@ -0,0 +1,135 @@
+/*
+ * D3D12MemoryAllocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_MEMORY_ALLOCATOR_H
+#define LLGL_D3D12_MEMORY_ALLOCATOR_H
+
+
+#include "../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class D3D12MemoryHeap;
+
+// Handle of a memory range within a D3D12MemoryHeap. The range is released when the handle is destroyed.
+class D3D12MemoryAllocation
+{
+
+    public:
+
+        D3D12MemoryAllocation() = default;
+        ~D3D12MemoryAllocation();
+
+        D3D12MemoryAllocation(const D3D12MemoryAllocation&) = delete;
+        D3D12MemoryAllocation& operator = (const D3D12MemoryAllocation&) = delete;
+
+        D3D12MemoryAllocation(D3D12MemoryAllocation&& rhs) noexcept;
+        D3D12MemoryAllocation& operator = (D3D12MemoryAllocation&& rhs) noexcept;
+
+        // Releases the memory range. The resource that was placed into this range must already be released.
+        void Release();
+
+        // Returns true if this handle refers to a memory range, i.e. the resource is a placed resource.
+        inline bool IsPlaced() const
+        {
+            return (heap_ != nullptr);
+        }
+
+    private:
+
+        friend class D3D12MemoryAllocator;
+
+        D3D12MemoryHeap*    heap_   = nullptr;
+        UINT64              offset_ = 0;
+        UINT64              size_   = 0;
+
+};
+
+/*
+Allocator for placed resources. Resources are sub-allocated from large ID3D12Heap objects, one pool per heap type and resource category,
+which avoids a kernel-mode allocation and the 64 KB alignment of a committed resource for each buffer and texture.
+Textures use the 4 KB small resource alignment when the device allows it.
+Resources that are too large to share a heap, multi-sampled textures, and render-target or depth-stencil textures are created as committed resources,
+since placed render-target and depth-stencil resources must be cleared or discarded before their first use.
+*/
+class D3D12MemoryAllocator
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static D3D12MemoryAllocator& Get();
+
+    public:
+
+        D3D12MemoryAllocator(const D3D12MemoryAllocator&) = delete;
+        D3D12MemoryAllocator& operator = (const D3D12MemoryAllocator&) = delete;
+
+        D3D12MemoryAllocator(D3D12MemoryAllocator&&) = delete;
+        D3D12MemoryAllocator& operator = (D3D12MemoryAllocator&&) = delete;
+
+        // Releases all heaps that are no longer in use. Heaps that are still in use are released with their last allocation.
+        void Clear();
+
+        /*
+        Creates a placed resource within a shared heap or a committed resource if the resource cannot be placed.
+        The previous resource in 'outResource' and its memory range in 'outAllocation' are released first.
+        */
+        HRESULT CreateResource(
+            ID3D12Device*               device,
+            D3D12_HEAP_TYPE             heapType,
+            const D3D12_RESOURCE_DESC&  desc,
+            D3D12_RESOURCE_STATES       initialState,
+            const D3D12_CLEAR_VALUE*    optimizedClearValue,
+            ComPtr<ID3D12Resource>&     outResource,
+            D3D12MemoryAllocation&      outAllocation
+        );
+
+    private:
+
+        friend class D3D12MemoryAllocation;
+
+        D3D12MemoryAllocator() = default;
+        ~D3D12MemoryAllocator();
+
+        // Allocates a memory range from an existing heap or a new heap. Returns null if no heap could be created.
+        D3D12MemoryHeap* AllocateRange(
+            ID3D12Device*       device,
+            D3D12_HEAP_TYPE     heapType,
+            D3D12_HEAP_FLAGS    heapFlags,
+            UINT64              size,
+            UINT64              alignment,
+            UINT64&             outOffset
+        );
+
+        // Releases the memory range of the specified allocation and releases its heap if it is no longer needed.
+        void ReleaseRange(D3D12MemoryHeap* heap, UINT64 offset, UINT64 size);
+
+    private:
+
+        std::mutex                                      mutex_;
+        std::vector<std::unique_ptr<D3D12MemoryHeap>>   heaps_;
+        bool                                            retainEmptyHeaps_   = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,19 +8,24 @@
 #include "D3D12RenderSystem.h"
 #include "D3D12Types.h"
 #include "D3D12SubresourceContext.h"
+#include "D3D12MemoryAllocator.h"
 #include "../DXCommon/DXCore.h"
 #include "../TextureUtils.h"
 #include "../CheckedCast.h"
+#include "../ProfileCounters.h"
 #include "../RenderSystemUtils.h"
 #include "../../Core/Vendor.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/Threading.h"
 #include "D3DX12/d3dx12.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 #include <LLGL/Container/DynamicArray.h>
 #include <limits.h>
+#include <algorithm>
+#include <string.h>
 
 #include "Shader/D3D12BuiltinShaderFactory.h"
 
@@ -29,9 +34,12 @@
 #include "Buffer/D3D12BufferConstantsPool.h"
 
 #include "Texture/D3D12MipGenerator.h"
+#include "Texture/D3D12ImageConverter.h"
 
 #include "RenderState/D3D12GraphicsPSO.h"
 #include "RenderState/D3D12ComputePSO.h"
+#include "RenderState/D3D12RayTracingPSO.h"
+#include "Buffer/D3D12AccelerationStructure.h"
 
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 
@@ -40,6 +48,18 @@ namespace LLGL
 {
 
 
+// Returns true if the adapter supports GPU upload heaps, i.e. its entire video memory is CPU visible with resizable BAR.
+static bool IsGPUUploadHeapSupported(ID3D12Device* device)
+{
+    #if LLGL_D3D12_ENABLE_GPU_UPLOAD_HEAP
+    D3D12_FEATURE_DATA_D3D12_OPTIONS16 options16 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS16, &options16, sizeof(options16));
+    return (SUCCEEDED(hr) && options16.GPUUploadHeapSupported != FALSE);
+    #else
+    return false;
+    #endif
+}
+
 D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemDesc)
 {
     const bool isDebugDevice = ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0);
@@ -58,7 +78,7 @@ D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemD
         CreateFactory(isDebugDevice);
 
         ComPtr<IDXGIAdapter> preferredAdatper;
-        QueryVideoAdapters(renderSystemDesc.flags, preferredAdatper);
+        QueryVideoAdapters(renderSystemDesc, preferredAdatper);
 
         HRESULT hr = CreateDevice(preferredAdatper.Get(), renderSystemDesc.flags);
         DXThrowIfFailed(hr, "failed to create D3D12 device");
@@ -67,9 +87,29 @@ D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemD
     /* Query and cache DXGI factory feature support */
     tearingSupported_ = CheckFactoryFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING);
 
+    /* Query whether the adapter exposes its entire video memory to the CPU (ReBAR), which enables GPU upload heaps */
+    gpuUploadHeapSupported_ = IsGPUUploadHeapSupported(device_.GetNative());
+
     /* Create command queue interface */
     commandQueue_   = MakeUnique<D3D12CommandQueue>(device_);
     commandContext_ = &(commandQueue_->GetContext());
+    uploadFence_.Create(device_.GetNative());
+
+    /* Create dedicated copy queue for initial resource uploads, which all other queues wait for on the GPU */
+    uploadQueue_    = MakeUnique<D3D12UploadQueue>(device_, *commandQueue_);
+    commandQueue_->SetUploadQueue(uploadQueue_.get());
+
+    /* Create dedicated thread for queue submissions and presentations if requested */
+    if ((renderSystemDesc.flags & RenderSystemFlags::SubmissionThread) != 0)
+    {
+        submissionThread_ = MakeUnique<SubmissionThread>();
+        commandQueue_->SetSubmissionThread(submissionThread_.get());
+    }
+
+    #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+    /* Create DirectStorage queue to stream file data directly into GPU resources; this is unavailable if the runtime cannot be loaded */
+    directStorageQueue_ = MakeUnique<D3D12DirectStorageQueue>(device_.GetNative());
+    #endif
 
     /* Create default pipeline layout and command signature pool */
     defaultPipelineLayout_.CreateRootSignature(device_.GetNative(), {});
@@ -77,8 +117,21 @@ D3D12RenderSystem::D3D12RenderSystem(const RenderSystemDescriptor& renderSystemD
 
     stagingBufferPool_.InitializeDevice(device_.GetNative(), 0);
     D3D12MipGenerator::Get().InitializeDevice(device_.GetNative());
+    D3D12ImageConverter::Get().InitializeDevice(device_.GetNative());
     D3D12BufferConstantsPool::Get().InitializeDevice(device_.GetNative(), *commandContext_, *commandQueue_, stagingBufferPool_);
     D3D12BuiltinShaderFactory::Get().CreateBuiltinPSOs(device_.GetNative());
+
+    /* Open persistent pipeline cache store for the active adapter and driver */
+    pipelineCacheStore_.SetDirectory(renderSystemDesc.pipelineCacheDirectory);
+    if (pipelineCacheStore_.IsEnabled())
+    {
+        std::vector<char> pipelineCacheID;
+        QueryPipelineCacheID(pipelineCacheID);
+        pipelineCacheStore_.Open(pipelineCacheID);
+    }
+
+    /* Map persistent shader cache */
+    shaderCache_.Open(renderSystemDesc.shaderCacheFilename);
 }
 
 D3D12RenderSystem::~D3D12RenderSystem()
@@ -96,8 +149,10 @@ D3D12RenderSystem::~D3D12RenderSystem()
 
     /* Clear resources of singletons */
     D3D12MipGenerator::Get().Clear();
+    D3D12ImageConverter::Get().Clear();
     D3D12BufferConstantsPool::Get().Clear();
     D3D12BuiltinShaderFactory::Get().Clear();
+    D3D12MemoryAllocator::Get().Clear();
 }
 
 /* ----- Swap-chain ----- */
@@ -119,6 +174,32 @@ CommandQueue* D3D12RenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* D3D12RenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    /* Create dedicated compute and copy queues on first use */
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (!computeQueue_)
+            {
+                computeQueue_ = MakeUnique<D3D12CommandQueue>(device_, D3D12_COMMAND_LIST_TYPE_COMPUTE, commandQueue_.get());
+                computeQueue_->SetUploadQueue(uploadQueue_.get());
+                computeQueue_->SetSubmissionThread(submissionThread_.get());
+            }
+            return computeQueue_.get();
+        case CommandQueueType::Copy:
+            if (!copyQueue_)
+            {
+                copyQueue_ = MakeUnique<D3D12CommandQueue>(device_, D3D12_COMMAND_LIST_TYPE_COPY, commandQueue_.get());
+                copyQueue_->SetUploadQueue(uploadQueue_.get());
+                copyQueue_->SetSubmissionThread(submissionThread_.get());
+            }
+            return copyQueue_.get();
+        default:
+            return commandQueue_.get();
+    }
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* D3D12RenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
@@ -134,15 +215,42 @@ void D3D12RenderSystem::Release(CommandBuffer& commandBuffer)
 
 /* ----- Buffers ------ */
 
+/*
+Buffers that are only copied into on the GPU and read on the CPU are allocated in the readback heap, so they can be mapped without an intermediate copy.
+Dynamic buffers are allocated in the GPU upload heap if supported, so the CPU writes them directly in video memory without a copy on the GPU timeline.
+*/
+static D3D12_HEAP_TYPE GetD3DBufferHeapType(const BufferDescriptor& bufferDesc, bool gpuUploadHeapSupported)
+{
+    if (bufferDesc.bindFlags == BindFlags::CopyDst && bufferDesc.cpuAccessFlags == CPUAccessFlags::Read)
+        return D3D12_HEAP_TYPE_READBACK;
+
+    #if LLGL_D3D12_ENABLE_GPU_UPLOAD_HEAP
+    if (gpuUploadHeapSupported && (bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0)
+        return D3D12_HEAP_TYPE_GPU_UPLOAD;
+    #endif
+
+    return D3D12_HEAP_TYPE_DEFAULT;
+}
+
 Buffer* D3D12RenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
-    RenderSystem::AssertCreateBuffer(bufferDesc, ULLONG_MAX);
-    D3D12Buffer* bufferD3D = buffers_.emplace<D3D12Buffer>(device_.GetNative(), bufferDesc);
-    if (initialData != nullptr)
-        UpdateBufferAndSync(*bufferD3D, 0, initialData, bufferDesc.size, bufferD3D->GetAlignment());
+    CollectDeferredReleases();
+    D3D12Buffer* bufferD3D = CreateBufferInternal(bufferDesc, initialData);
+    CheckMemoryBudget();
     return bufferD3D;
 }
 
+void D3D12RenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    CollectDeferredReleases();
+    for_range(i, bufferDescs.size())
+        outBuffers[i] = CreateBufferInternal(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr));
+
+    /* Submit the initial uploads of all buffers with a single copy submission */
+    uploadQueue_->Flush();
+    CheckMemoryBudget();
+}
+
 BufferArray* D3D12RenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     RenderSystem::AssertCreateBufferArray(numBuffers, bufferArray);
@@ -151,8 +259,22 @@ BufferArray* D3D12RenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buff
 
 void D3D12RenderSystem::Release(Buffer& buffer)
 {
-    SyncGPU();
-    buffers_.erase(&buffer);
+    {
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        deferredReleases_.EnqueueObject(SignalReleaseSerial(), buffers_.extract(&buffer));
+    }
+    CollectDeferredReleases();
+}
+
+void D3D12RenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    {
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        const std::uint64_t releaseSerial = SignalReleaseSerial();
+        for (Buffer* buffer : buffers)
+            deferredReleases_.EnqueueObject(releaseSerial, buffers_.extract(buffer));
+    }
+    CollectDeferredReleases();
 }
 
 void D3D12RenderSystem::Release(BufferArray& bufferArray)
@@ -164,12 +286,34 @@ void D3D12RenderSystem::Release(BufferArray& bufferArray)
 void D3D12RenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
-    UpdateBufferAndSync(bufferD3D, offset, data, dataSize);
+    if (bufferD3D.IsGPUUpload())
+    {
+        /* Wait for the GPU to release the buffer and write the data directly into video memory instead of recording a copy */
+        ExecuteCommandListAndSync();
+        bufferD3D.WriteMappedMemory(offset, data, dataSize);
+    }
+    else
+        UpdateBufferAndSync(bufferD3D, offset, data, dataSize);
 }
 
 void D3D12RenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data, std::uint64_t dataSize)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+
+    if (bufferD3D.IsReadback())
+    {
+        /* Readback heaps cannot be used as copy source, so wait for the GPU and read the mapped memory directly */
+        SyncGPU();
+        std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
+        if (const void* mappedData = MapBufferRange(bufferD3D, CPUAccess::ReadOnly, offset, dataSize))
+        {
+            ::memcpy(data, mappedData, static_cast<std::size_t>(dataSize));
+            bufferD3D.Unmap(*commandContext_, *commandQueue_, stagingBufferPool_);
+        }
+        return;
+    }
+
+    std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
     stagingBufferPool_.ReadSubresourceRegion(*commandContext_, *commandQueue_, bufferD3D.GetResource(), offset, data, dataSize);
     /* No ExecuteCommandListAndSync() here as it has already been flushed by the staging buffer pool */
 }
@@ -189,38 +333,75 @@ void* D3D12RenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::
 void D3D12RenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferD3D = LLGL_CAST(D3D12Buffer&, buffer);
+    std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
     bufferD3D.Unmap(*commandContext_, *commandQueue_, stagingBufferPool_);
 }
 
+AccelerationStructureSizes D3D12RenderSystem::GetAccelerationStructureSizes(const AccelerationStructureDescriptor& accelerationStructureDesc)
+{
+    AccelerationStructureSizes sizes;
+
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    ComPtr<ID3D12Device5> device5;
+    if (SUCCEEDED(device_.GetNative()->QueryInterface(IID_PPV_ARGS(device5.GetAddressOf()))))
+    {
+        /* Buffers are not resolved, since the prebuild info only depends on the number and layout of geometries and instances */
+        const D3D12AccelerationStructureInputs inputs{ accelerationStructureDesc, /*resolveBuffers:*/ false };
+
+        D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo = {};
+        device5->GetRaytracingAccelerationStructurePrebuildInfo(&inputs.GetNative(), &prebuildInfo);
+
+        sizes.accelerationStructureSize = GetAlignedSize<UINT64>(prebuildInfo.ResultDataMaxSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
+        sizes.buildScratchSize          = GetAlignedSize<UINT64>(prebuildInfo.ScratchDataSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
+        sizes.updateScratchSize         = GetAlignedSize<UINT64>(prebuildInfo.UpdateScratchDataSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
+    }
+    #endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
+    return sizes;
+}
+
 /* ----- Textures ----- */
 
 Texture* D3D12RenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    auto* textureD3D = textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc);
+    CollectDeferredReleases();
+    D3D12Texture* textureD3D = CreateTextureInternal(textureDesc, initialImage);
+    CheckMemoryBudget();
+    return textureD3D;
+}
 
-    if (initialImage != nullptr)
+void D3D12RenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    CollectDeferredReleases();
+    for_range(i, textureDescs.size())
     {
-        /* Update base MIP-map */
-        TextureRegion region;
-        {
-            region.subresource.numArrayLayers   = textureDesc.arrayLayers;
-            region.extent                       = textureDesc.extent;
-        }
-        D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_ };
-        UpdateTextureSubresourceFromImage(*textureD3D, region, *initialImage, subresourceContext);
-
-        /* Generate MIP-maps if enabled */
-        if (MustGenerateMipsOnCreate(textureDesc))
-            D3D12MipGenerator::Get().GenerateMips(*commandContext_, *textureD3D, textureD3D->GetWholeSubresource());
+        const ImageView* initialImage = (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr);
+        outTextures[i] = CreateTextureInternal(textureDescs[i], initialImage);
     }
 
-    return textureD3D;
+    /* Submit the initial uploads of all textures with a single copy submission */
+    uploadQueue_->Flush();
+    CheckMemoryBudget();
 }
 
 void D3D12RenderSystem::Release(Texture& texture)
 {
-    SyncGPU();
-    textures_.erase(&texture);
+    {
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        deferredReleases_.EnqueueObject(SignalReleaseSerial(), textures_.extract(&texture));
+    }
+    CollectDeferredReleases();
+}
+
+void D3D12RenderSystem::Release(const ArrayView<Texture*>& textures)
+{
+    {
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        const std::uint64_t releaseSerial = SignalReleaseSerial();
+        for (Texture* texture : textures)
+            deferredReleases_.EnqueueObject(releaseSerial, textures_.extract(texture));
+    }
+    CollectDeferredReleases();
 }
 
 void D3D12RenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
@@ -228,10 +409,72 @@ void D3D12RenderSystem::WriteTexture(Texture& texture, const TextureRegion& text
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
 
     /* Execute upload commands and wait for GPU to finish execution */
+    std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
     D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_ };
     UpdateTextureSubresourceFromImage(textureD3D, textureRegion, srcImageView, subresourceContext);
 }
 
+void D3D12RenderSystem::WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence)
+{
+    std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
+
+    /* Release intermediate resources of previous uploads the GPU has already finished */
+    RecycleTextureUploads();
+
+    /* Record all uploads from the coarsest to the finest MIP-map into a single command list and submit it without waiting */
+    PendingTextureUpload pendingUpload;
+    {
+        D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_, /*syncWithGPU:*/ false };
+        for (std::uint32_t uploadIndex : GetTextureUploadOrder(numUploads, uploads))
+        {
+            const TextureUploadDescriptor& upload = uploads[uploadIndex];
+            auto& textureD3D = LLGL_CAST(D3D12Texture&, *upload.texture);
+            UpdateTextureSubresourceFromImage(textureD3D, upload.region, upload.imageView, subresourceContext);
+        }
+        subresourceContext.TakeResources(pendingUpload.intermediateResources);
+    }
+
+    /* Keep upload buffers alive until the GPU has passed the upload fence */
+    pendingUpload.fenceValue = ++uploadFenceValue_;
+    commandQueue_->SignalFence(uploadFence_.Get(), pendingUpload.fenceValue);
+    pendingTextureUploads_.push_back(std::move(pendingUpload));
+
+    if (fence != nullptr)
+        commandQueue_->Submit(*fence);
+}
+
+void D3D12RenderSystem::WriteFromFileAsync(std::uint32_t numUploads, const FileUploadDescriptor* uploads, Fence* fence)
+{
+    #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+    if (directStorageQueue_->IsAvailable())
+    {
+        /* Stream all uploads DirectStorage can express directly from the file and read all others into CPU memory first */
+        std::vector<FileUploadDescriptor> cpuUploads;
+        std::vector<const FileUploadDescriptor*> directStorageUploads;
+        for_range(i, numUploads)
+        {
+            if (IsDirectStorageUpload(uploads[i]))
+                directStorageUploads.push_back(&uploads[i]);
+            else
+                cpuUploads.push_back(uploads[i]);
+        }
+
+        if (!cpuUploads.empty())
+            RenderSystem::WriteFromFileAsync(static_cast<std::uint32_t>(cpuUploads.size()), cpuUploads.data(), (directStorageUploads.empty() ? fence : nullptr));
+
+        if (!directStorageUploads.empty())
+            WriteFromFileWithDirectStorage(directStorageUploads, fence);
+        else if (cpuUploads.empty() && fence != nullptr)
+            commandQueue_->Submit(*fence);
+
+        return;
+    }
+    #endif // /LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+    /* Fall back to reading the files into CPU memory */
+    RenderSystem::WriteFromFileAsync(numUploads, uploads, fence);
+}
+
 void D3D12RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
     auto& textureD3D = LLGL_CAST(D3D12Texture&, texture);
@@ -245,6 +488,7 @@ void D3D12RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
     ComPtr<ID3D12Resource> readbackBuffer;
     UINT rowStride = 0, layerSize = 0, layerStride = 0;
     {
+        std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
         D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_ };
         textureD3D.CreateSubresourceCopyAsReadbackBuffer(subresourceContext, textureRegion, texturePlane, rowStride, layerSize, layerStride);
         readbackBuffer = subresourceContext.TakeResource();
@@ -289,6 +533,130 @@ void D3D12RenderSystem::ReadTexture(Texture& texture, const TextureRegion& textu
     readbackBuffer->Unmap(0, &writtenRange);
 }
 
+/* ----- Placement Heaps ----- */
+
+PlacementHeap* D3D12RenderSystem::CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc)
+{
+    auto* placementHeapD3D = placementHeaps_.emplace<D3D12PlacementHeap>(device_.GetNative(), placementHeapDesc);
+    CheckMemoryBudget();
+    return placementHeapD3D;
+}
+
+void D3D12RenderSystem::Release(PlacementHeap& placementHeap)
+{
+    SyncGPU();
+    placementHeaps_.erase(&placementHeap);
+}
+
+MemoryRequirements D3D12RenderSystem::GetTextureMemoryRequirements(const TextureDescriptor& textureDesc)
+{
+    const D3D12_RESOURCE_ALLOCATION_INFO allocInfo = D3D12Texture::QueryResourceAllocationInfo(device_.GetNative(), textureDesc);
+    MemoryRequirements requirements;
+    {
+        requirements.size       = allocInfo.SizeInBytes;
+        requirements.alignment  = allocInfo.Alignment;
+    }
+    return requirements;
+}
+
+Texture* D3D12RenderSystem::CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    /* Placed textures have no initial data; their content is undefined until the first aliasing barrier or write */
+    auto& placementHeapD3D = LLGL_CAST(D3D12PlacementHeap&, placementHeap);
+    return textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc, placementHeapD3D.GetNative(), offset);
+}
+
+/* ----- Sampler Feedback ----- */
+
+Texture* D3D12RenderSystem::CreateSamplerFeedbackTexture(const SamplerFeedbackDescriptor& samplerFeedbackDesc)
+{
+    #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+    if (samplerFeedbackDesc.pairedTexture != nullptr && GetRenderingCaps().features.hasSamplerFeedback)
+        return textures_.emplace<D3D12Texture>(device_.GetNative(), samplerFeedbackDesc);
+    #endif
+    return nullptr;
+}
+
+/* ----- Shared Resources ----- */
+
+// Returns the native resource of the specified buffer or texture if it was created in a shared heap, or null otherwise.
+static ID3D12Resource* GetSharedD3D12Resource(Resource& resource)
+{
+    ID3D12Resource* nativeResource = nullptr;
+    if (resource.GetResourceType() == ResourceType::Buffer)
+        nativeResource = LLGL_CAST(D3D12Buffer&, resource).GetNative();
+    else if (resource.GetResourceType() == ResourceType::Texture)
+        nativeResource = LLGL_CAST(D3D12Texture&, resource).GetNative();
+
+    if (nativeResource != nullptr)
+    {
+        D3D12_HEAP_PROPERTIES heapProperties;
+        D3D12_HEAP_FLAGS heapFlags = D3D12_HEAP_FLAG_NONE;
+        if (SUCCEEDED(nativeResource->GetHeapProperties(&heapProperties, &heapFlags)) && (heapFlags & D3D12_HEAP_FLAG_SHARED) != 0)
+            return nativeResource;
+    }
+
+    return nullptr;
+}
+
+bool D3D12RenderSystem::ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle)
+{
+    ID3D12Resource* nativeResource = GetSharedD3D12Resource(resource);
+    if (nativeResource == nullptr)
+        return false;
+
+    /* Create new NT handle for the shared heap; the caller must close it with CloseHandle() */
+    HANDLE handle = nullptr;
+    HRESULT hr = device_.GetNative()->CreateSharedHandle(nativeResource, nullptr, GENERIC_ALL, nullptr, &handle);
+    if (FAILED(hr))
+        return false;
+
+    const D3D12_RESOURCE_DESC resourceDesc = nativeResource->GetDesc();
+    const D3D12_RESOURCE_ALLOCATION_INFO allocInfo = device_.GetNative()->GetResourceAllocationInfo(0, 1, &resourceDesc);
+
+    outHandle.type      = SharedHandleType::OpaqueWin32;
+    outHandle.handle    = handle;
+    outHandle.size      = allocInfo.SizeInBytes;
+    return true;
+}
+
+Texture* D3D12RenderSystem::ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle)
+{
+    if (sharedHandle.type != SharedHandleType::OpaqueWin32 || sharedHandle.handle == nullptr)
+        return nullptr;
+
+    /* Imported textures have no initial data; their content is owned by the exporting device */
+    CollectDeferredReleases();
+    return textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc, nullptr, 0, static_cast<HANDLE>(sharedHandle.handle));
+}
+
+Buffer* D3D12RenderSystem::ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle)
+{
+    if (sharedHandle.type != SharedHandleType::OpaqueWin32 || sharedHandle.handle == nullptr)
+        return nullptr;
+
+    CollectDeferredReleases();
+    return buffers_.emplace<D3D12Buffer>(device_.GetNative(), bufferDesc, D3D12_HEAP_TYPE_DEFAULT, static_cast<HANDLE>(sharedHandle.handle));
+}
+
+bool D3D12RenderSystem::ExportSharedFence(Fence& fence, SharedResourceHandle& outHandle)
+{
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+
+    /* All D3D12Fence objects are created with D3D12_FENCE_FLAG_SHARED; the caller must close the handle with CloseHandle() */
+    HANDLE handle = nullptr;
+    HRESULT hr = device_.GetNative()->CreateSharedHandle(fenceD3D.GetNative(), nullptr, GENERIC_ALL, nullptr, &handle);
+    if (FAILED(hr))
+        return false;
+
+    fenceD3D.MarkShared();
+
+    outHandle.type      = SharedHandleType::OpaqueWin32;
+    outHandle.handle    = handle;
+    outHandle.size      = 0;
+    return true;
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* D3D12RenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
@@ -355,6 +723,25 @@ Shader* D3D12RenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     return shaders_.emplace<D3D12Shader>(*this, shaderDesc);
 }
 
+void D3D12RenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    for (const ShaderDescriptor& shaderDesc : shaderDescs)
+        RenderSystem::AssertCreateShader(shaderDesc);
+
+    /* Compile shaders on the worker thread pool, but insert them on the calling thread since the shader container is not thread-safe */
+    std::vector<HWObjectContainer<D3D12Shader>::object_ptr<D3D12Shader>> newShaders(shaderDescs.size());
+    DispatchConcurrentJobs(
+        shaderDescs.size(),
+        [this, &shaderDescs, &newShaders](std::size_t jobIndex)
+        {
+            newShaders[jobIndex] = HWObjectContainer<D3D12Shader>::make<D3D12Shader>(*this, shaderDescs[jobIndex]);
+        }
+    );
+
+    for_range(i, newShaders.size())
+        outShaders[i] = shaders_.insert(std::move(newShaders[i]));
+}
+
 void D3D12RenderSystem::Release(Shader& shader)
 {
     shaders_.erase(&shader);
@@ -377,7 +764,7 @@ void D3D12RenderSystem::Release(PipelineLayout& pipelineLayout)
 
 PipelineCache* D3D12RenderSystem::CreatePipelineCache(const Blob& initialBlob)
 {
-    return pipelineCaches_.emplace<D3D12PipelineCache>(initialBlob);
+    return pipelineCaches_.emplace<D3D12PipelineCache>(device_.GetNative(), initialBlob);
 }
 
 void D3D12RenderSystem::Release(PipelineCache& pipelineCache)
@@ -390,12 +777,73 @@ void D3D12RenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* D3D12RenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<D3D12GraphicsPSO>(device_.GetNative(), defaultPipelineLayout_, pipelineStateDesc, GetDefaultRenderPass(), pipelineCache);
+    return pipelineStates_.emplace<D3D12GraphicsPSO>(
+        device_.GetNative(),
+        defaultPipelineLayout_,
+        pipelineStateDesc,
+        GetDefaultRenderPass(),
+        pipelineCache,
+        (pipelineCacheStore_.IsOpen() ? &pipelineCacheStore_ : nullptr)
+    );
 }
 
 PipelineState* D3D12RenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<D3D12ComputePSO>(device_.GetNative(), defaultPipelineLayout_, pipelineStateDesc, pipelineCache);
+    return pipelineStates_.emplace<D3D12ComputePSO>(
+        device_.GetNative(),
+        defaultPipelineLayout_,
+        pipelineStateDesc,
+        pipelineCache,
+        (pipelineCacheStore_.IsOpen() ? &pipelineCacheStore_ : nullptr)
+    );
+}
+
+void D3D12RenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    /* Create PSOs on the worker thread pool; the PSO container and persistent cache store are thread-safe */
+    const D3D12RenderPass* defaultRenderPass = GetDefaultRenderPass();
+    DispatchConcurrentJobs(
+        pipelineStateDescs.size(),
+        [this, &pipelineStateDescs, outPipelineStates, pipelineCache, defaultRenderPass](std::size_t jobIndex)
+        {
+            outPipelineStates[jobIndex] = pipelineStates_.emplace<D3D12GraphicsPSO>(
+                device_.GetNative(),
+                defaultPipelineLayout_,
+                pipelineStateDescs[jobIndex],
+                defaultRenderPass,
+                pipelineCache,
+                (pipelineCacheStore_.IsOpen() ? &pipelineCacheStore_ : nullptr)
+            );
+        }
+    );
+}
+
+void D3D12RenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    /* Create PSOs on the worker thread pool; the PSO container and persistent cache store are thread-safe */
+    DispatchConcurrentJobs(
+        pipelineStateDescs.size(),
+        [this, &pipelineStateDescs, outPipelineStates, pipelineCache](std::size_t jobIndex)
+        {
+            outPipelineStates[jobIndex] = pipelineStates_.emplace<D3D12ComputePSO>(
+                device_.GetNative(),
+                defaultPipelineLayout_,
+                pipelineStateDescs[jobIndex],
+                pipelineCache,
+                (pipelineCacheStore_.IsOpen() ? &pipelineCacheStore_ : nullptr)
+            );
+        }
+    );
+}
+
+PipelineState* D3D12RenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+{
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    /* Ray tracing PSOs are not stored in PSO caches, since ID3D12StateObject has no cached blob */
+    if (GetRenderingCaps().features.hasRayTracing)
+        return pipelineStates_.emplace<D3D12RayTracingPSO>(device_.GetNative(), defaultPipelineLayout_, pipelineStateDesc);
+    #endif // /LLGL_D3D12_ENABLE_RAYTRACING
+    return nullptr;
 }
 
 void D3D12RenderSystem::Release(PipelineState& pipelineState)
@@ -421,13 +869,31 @@ void D3D12RenderSystem::Release(QueryHeap& queryHeap)
 
 Fence* D3D12RenderSystem::CreateFence()
 {
+    /* Recycle the oldest released fence once its last signal has completed; fence values only increase, so it can be signaled again right away */
+    if (!fencePool_.empty() && fencePool_.front()->IsSignaled())
+    {
+        HWObjectContainer<D3D12Fence>::object_ptr<D3D12Fence> fence = std::move(fencePool_.front());
+        fencePool_.pop_front();
+        fence->SetDebugName(nullptr);
+        return fences_.insert(std::move(fence));
+    }
     return fences_.emplace<D3D12Fence>(device_.GetNative(), 0);
 }
 
 void D3D12RenderSystem::Release(Fence& fence)
 {
-    SyncGPU();
-    fences_.erase(&fence);
+    /* Fences can still be signaled by the submission thread */
+    FlushSubmissionThread();
+
+    auto& fenceD3D = LLGL_CAST(D3D12Fence&, fence);
+    if (fenceD3D.IsShared())
+    {
+        /* Shared fences can still be referenced outside of LLGL, so they are destroyed instead of recycled */
+        SyncGPU();
+        fences_.erase(&fence);
+    }
+    else
+        fencePool_.push_back(fences_.extract(&fence));
 }
 
 /* ----- Extensions ----- */
@@ -475,7 +941,23 @@ ComPtr<IDXGISwapChain1> D3D12RenderSystem::CreateDXSwapChain(
 
 void D3D12RenderSystem::SyncGPU()
 {
-    commandQueue_->WaitIdle();
+    FlushSubmissionThread();
+    uploadQueue_->WaitIdle();
+    if (computeQueue_)
+        computeQueue_->WaitIdle();
+    if (copyQueue_)
+        copyQueue_->WaitIdle();
+    {
+        std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
+        commandQueue_->WaitIdle();
+        pendingTextureUploads_.clear();
+    }
+
+    /* All command queues are idle, so all released objects can be destroyed */
+    std::lock_guard<std::mutex> guard{ releaseMutex_ };
+    completedReleaseSerial_ += releaseFences_.size();
+    releaseFences_.clear();
+    deferredReleases_.Clear();
 }
 
 
@@ -483,6 +965,116 @@ void D3D12RenderSystem::SyncGPU()
  * ======= Private: =======
  */
 
+D3D12Buffer* D3D12RenderSystem::CreateBufferInternal(const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    RenderSystem::AssertCreateBuffer(bufferDesc, ULLONG_MAX);
+    D3D12Buffer* bufferD3D = buffers_.emplace<D3D12Buffer>(device_.GetNative(), bufferDesc, GetD3DBufferHeapType(bufferDesc, gpuUploadHeapSupported_));
+    if (initialData != nullptr)
+    {
+        /*
+        Only buffers in the default heap can be initialized with the upload queue, readback buffers are initialized with the primary queue,
+        and buffers in the GPU upload heap are written directly by the CPU since the GPU cannot have accessed them yet.
+        */
+        if (bufferD3D->IsGPUUpload())
+            bufferD3D->WriteMappedMemory(0, initialData, bufferDesc.size);
+        else if (bufferD3D->GetHeapType() == D3D12_HEAP_TYPE_DEFAULT)
+            UploadBufferAsync(*bufferD3D, initialData, bufferDesc.size);
+        else
+            UpdateBufferAndSync(*bufferD3D, 0, initialData, bufferDesc.size, bufferD3D->GetAlignment());
+    }
+    return bufferD3D;
+}
+
+D3D12Texture* D3D12RenderSystem::CreateTextureInternal(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    auto* textureD3D = textures_.emplace<D3D12Texture>(device_.GetNative(), textureDesc);
+
+    if (D3D12SparseTextureMemory* sparseMemory = textureD3D->GetSparseMemory())
+    {
+        /* Map packed MIP-maps of reserved textures immediately, since they are always resident; all other tiles are mapped via the command queue */
+        sparseMemory->MapPackedMips(commandQueue_->GetNative());
+    }
+    else if (initialImage != nullptr)
+    {
+        /* Update base MIP-map */
+        TextureRegion region;
+        {
+            region.subresource.numArrayLayers   = textureDesc.arrayLayers;
+            region.extent                       = textureDesc.extent;
+        }
+        if (IsDepthOrStencilFormat(textureDesc.format) || D3D12ImageConverter::Get().IsConversionSupported(*textureD3D, *initialImage))
+        {
+            /* Depth-stencil textures and textures whose image data is converted by a compute shader are initialized with the primary queue */
+            std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
+            D3D12SubresourceContext subresourceContext{ *commandContext_, *commandQueue_ };
+            UpdateTextureSubresourceFromImage(*textureD3D, region, *initialImage, subresourceContext);
+        }
+        else
+            UploadTextureAsync(*textureD3D, region, *initialImage);
+
+        /* Generate MIP-maps if enabled; the primary queue waits for the upload on the GPU before these commands are executed */
+        if (MustGenerateMipsOnCreate(textureDesc))
+        {
+            std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
+            D3D12MipGenerator::Get().GenerateMips(*commandContext_, *textureD3D, textureD3D->GetWholeSubresource());
+        }
+    }
+
+    return textureD3D;
+}
+
+void D3D12RenderSystem::RecycleTextureUploads()
+{
+    const UINT64 completedValue = uploadFence_.GetCompletedValue();
+    while (!pendingTextureUploads_.empty() && pendingTextureUploads_.front().fenceValue <= completedValue)
+        pendingTextureUploads_.pop_front();
+}
+
+/*
+Released objects might still be referenced by command lists the GPU has not finished yet, so instead of waiting for all queues to become idle,
+each release signals the fences of all queues and the objects are destroyed once all of these fences have been reached.
+*/
+std::uint64_t D3D12RenderSystem::SignalReleaseSerial()
+{
+    /* Released objects can be referenced by command lists that are still pending on the submission thread, so the fences must be signaled after them */
+    FlushSubmissionThread();
+
+    ReleaseFenceValues fenceValues;
+    {
+        fenceValues.directQueue     = commandQueue_->SignalQueueFence();
+        fenceValues.computeQueue    = (computeQueue_ ? computeQueue_->SignalQueueFence() : 0);
+        fenceValues.copyQueue       = (copyQueue_ ? copyQueue_->SignalQueueFence() : 0);
+        fenceValues.uploadQueue     = uploadQueue_->Flush();
+    }
+    releaseFences_.push_back(fenceValues);
+    return (completedReleaseSerial_ + releaseFences_.size());
+}
+
+void D3D12RenderSystem::FlushSubmissionThread()
+{
+    if (submissionThread_)
+        submissionThread_->Flush();
+}
+
+void D3D12RenderSystem::CollectDeferredReleases()
+{
+    std::lock_guard<std::mutex> guard{ releaseMutex_ };
+    while (!releaseFences_.empty())
+    {
+        const ReleaseFenceValues& fenceValues = releaseFences_.front();
+        if (!commandQueue_->IsQueueFenceCompleted(fenceValues.directQueue)                  ||
+            (computeQueue_ && !computeQueue_->IsQueueFenceCompleted(fenceValues.computeQueue)) ||
+            (copyQueue_ && !copyQueue_->IsQueueFenceCompleted(fenceValues.copyQueue))       ||
+            !uploadQueue_->IsFenceCompleted(fenceValues.uploadQueue))
+        {
+            break;
+        }
+        releaseFences_.pop_front();
+        ++completedReleaseSerial_;
+    }
+    deferredReleases_.Collect(completedReleaseSerial_);
+}
+
 bool D3D12RenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabilities* outCaps)
 {
     if (outInfo != nullptr)
@@ -492,6 +1084,48 @@ bool D3D12RenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCap
     return true;
 }
 
+std::uint32_t D3D12RenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos)
+{
+    IDXGIAdapter3* adapter = GetDXGIAdapter3();
+    if (adapter == nullptr)
+        return 0;
+
+    /* Report local (video memory) and non-local (system memory) segment groups as separate heaps */
+    const DXGI_MEMORY_SEGMENT_GROUP segmentGroups[] = { DXGI_MEMORY_SEGMENT_GROUP_LOCAL, DXGI_MEMORY_SEGMENT_GROUP_NON_LOCAL };
+    const std::uint32_t numHeaps = static_cast<std::uint32_t>(sizeof(segmentGroups) / sizeof(segmentGroups[0]));
+
+    if (outHeapInfos != nullptr && maxHeapInfos > 0)
+    {
+        DXGI_ADAPTER_DESC adapterDesc;
+        adapter->GetDesc(&adapterDesc);
+
+        const std::uint64_t heapSizes[] =
+        {
+            static_cast<std::uint64_t>(adapterDesc.DedicatedVideoMemory),
+            static_cast<std::uint64_t>(adapterDesc.SharedSystemMemory),
+        };
+
+        for_range(i, std::min(numHeaps, maxHeapInfos))
+        {
+            DXGI_QUERY_VIDEO_MEMORY_INFO memoryInfo = {};
+            adapter->QueryVideoMemoryInfo(0, segmentGroups[i], &memoryInfo);
+
+            MemoryHeapInfo& heapInfo = outHeapInfos[i];
+            heapInfo.flags  = (segmentGroups[i] == DXGI_MEMORY_SEGMENT_GROUP_LOCAL ? MemoryHeapFlags::DeviceLocal : 0);
+            heapInfo.size   = heapSizes[i];
+            heapInfo.usage  = memoryInfo.CurrentUsage;
+            heapInfo.budget = memoryInfo.Budget;
+        }
+    }
+
+    return numHeaps;
+}
+
+std::uint32_t D3D12RenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    return CopyAdapterInfos(DXGetAdapterInfos(factory_.Get(), videoAdatperInfo_.luid), outAdapters, maxAdapters);
+}
+
 void D3D12RenderSystem::EnableDebugLayer()
 {
     ComPtr<ID3D12Debug> debugController0;
@@ -516,9 +1150,22 @@ void D3D12RenderSystem::CreateFactory(bool debugDevice)
     DXThrowIfFailed(hr, "failed to create DXGI factor 1.4");
 }
 
-void D3D12RenderSystem::QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper)
+void D3D12RenderSystem::QueryVideoAdapters(const RenderSystemDescriptor& renderSystemDesc, ComPtr<IDXGIAdapter>& outPreferredAdatper)
 {
-    videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), flags, outPreferredAdatper.ReleaseAndGetAddressOf());
+    /* Only enumerate all adapters if one is selected by its LUID */
+    const int adapterIndex = SelectAdapterIndex(
+        renderSystemDesc,
+        (IsAdapterSelectedByID(renderSystemDesc) ? DXGetAdapterInfos(factory_.Get()) : std::vector<AdapterInfo>{})
+    );
+
+    if (adapterIndex >= 0)
+    {
+        /* Pick video adapter by its index and ignore preferred vendor flags */
+        if (!DXGetVideoAdapterInfoByIndex(factory_.Get(), static_cast<UINT>(adapterIndex), videoAdatperInfo_, outPreferredAdatper.ReleaseAndGetAddressOf()))
+            LLGL_TRAP("video adapter index %d out of range", adapterIndex);
+    }
+    else
+        videoAdatperInfo_ = DXGetVideoAdapterInfo(factory_.Get(), renderSystemDesc.flags, outPreferredAdatper.ReleaseAndGetAddressOf());
 }
 
 HRESULT D3D12RenderSystem::CreateDevice(IDXGIAdapter* preferredAdapter, long flags)
@@ -581,7 +1228,7 @@ HRESULT D3D12RenderSystem::QueryDXInterfacesFromNativeHandle(const Direct3D12::R
     hr = dxgiAdapter->GetDesc(&dxgiAdapterDesc);
     DXThrowIfFailed(hr, "failed to get descriptor from DXGI adapter");
 
-    DXConvertVideoAdapterInfo(dxgiAdapter.Get(), dxgiAdapterDesc, videoAdatperInfo_);
+    DXConvertVideoAdapterInfo(dxgiAdapterDesc, videoAdatperInfo_);
 
     return device_.ShareDXDevice(nativeHandle.device, flags);
 }
@@ -671,6 +1318,9 @@ void D3D12RenderSystem::QueryRendererInfo(RendererInfo& info)
     /* Get device and vendor name from adapter */
     info.deviceName = videoAdatperInfo_.name.c_str();
     info.vendorName = GetVendorName(videoAdatperInfo_.vendor);
+
+    /* Get pipeline cache ID from adapter and driver version */
+    QueryPipelineCacheID(info.pipelineCacheID);
 }
 
 // Returns the HLSL version for the specified Direct3D feature level.
@@ -704,7 +1354,10 @@ static std::vector<Format> GetDefaultSupportedDXTextureFormats()
 
     formats.insert(
         formats.end(),
-        { Format::BC4UNorm, Format::BC4SNorm, Format::BC5UNorm, Format::BC5SNorm }
+        {
+            Format::BC4UNorm,   Format::BC4SNorm,   Format::BC5UNorm,   Format::BC5SNorm,
+            Format::BC6HUFloat, Format::BC6HSFloat, Format::BC7UNorm,   Format::BC7UNorm_sRGB
+        }
     );
 
     return formats;
@@ -740,12 +1393,108 @@ static long GetStorageResourceStageFlags(D3D_FEATURE_LEVEL featureLevel)
     else                                        return 0;
 }
 
+static D3D12_RESOURCE_BINDING_TIER GetD3DResourceBindingTier(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options));
+    return (SUCCEEDED(hr) ? options.ResourceBindingTier : D3D12_RESOURCE_BINDING_TIER_1);
+}
+
+static D3D12_TILED_RESOURCES_TIER GetD3DTiledResourcesTier(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options));
+    return (SUCCEEDED(hr) ? options.TiledResourcesTier : D3D12_TILED_RESOURCES_TIER_NOT_SUPPORTED);
+}
+
+static bool IsD3DMeshShaderSupported(ID3D12Device* device)
+{
+    #if LLGL_D3D12_ENABLE_MESH_SHADERS
+    D3D12_FEATURE_DATA_D3D12_OPTIONS7 options7 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS7, &options7, sizeof(options7));
+    return (SUCCEEDED(hr) && options7.MeshShaderTier != D3D12_MESH_SHADER_TIER_NOT_SUPPORTED);
+    #else
+    return false;
+    #endif
+}
+
+// Ray tracing tiers as integers, since D3D12_RAYTRACING_TIER_1_1 is only defined in newer Windows SDKs than D3D12_RAYTRACING_TIER_1_0.
+static constexpr int g_d3dRayTracingTier1_0 = 10;
+static constexpr int g_d3dRayTracingTier1_1 = 11;
+
+static int GetD3DRayTracingTier(ID3D12Device* device)
+{
+    #if LLGL_D3D12_ENABLE_RAYTRACING
+    D3D12_FEATURE_DATA_D3D12_OPTIONS5 options5 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS5, &options5, sizeof(options5));
+    return (SUCCEEDED(hr) ? static_cast<int>(options5.RaytracingTier) : 0);
+    #else
+    return 0;
+    #endif
+}
+
+static bool IsD3DVariableRateShadingSupported(ID3D12Device* device)
+{
+    #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6));
+    return (SUCCEEDED(hr) && options6.VariableShadingRateTier != D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED);
+    #else
+    return false;
+    #endif
+}
+
+static bool IsD3DViewInstancingSupported(ID3D12Device* device)
+{
+    #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+    D3D12_FEATURE_DATA_D3D12_OPTIONS3 options3 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS3, &options3, sizeof(options3));
+    return (SUCCEEDED(hr) && options3.ViewInstancingTier != D3D12_VIEW_INSTANCING_TIER_NOT_SUPPORTED);
+    #else
+    return false;
+    #endif
+}
+
+static bool IsD3DSamplerFeedbackSupported(ID3D12Device* device)
+{
+    #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+    D3D12_FEATURE_DATA_D3D12_OPTIONS7 options7 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS7, &options7, sizeof(options7));
+    return (SUCCEEDED(hr) && options7.SamplerFeedbackTier != D3D12_SAMPLER_FEEDBACK_TIER_NOT_SUPPORTED);
+    #else
+    return false;
+    #endif
+}
+
+// Returns the tile size of shading-rate images or 0 if the device only supports per-draw shading rates (Tier 1).
+static UINT GetD3DShadingRateImageTileSize(ID3D12Device* device)
+{
+    #if LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6));
+    if (SUCCEEDED(hr) && options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2)
+        return options6.ShadingRateImageTileSize;
+    #endif
+    return 0;
+}
+
+// Returns the wave intrinsics options of the specified device. WaveOps is FALSE if wave intrinsics (Shader Model 6.0) are not supported.
+static D3D12_FEATURE_DATA_D3D12_OPTIONS1 GetD3DWaveOptions(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS1 options1 = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS1, &options1, sizeof(options1));
+    if (FAILED(hr))
+        options1.WaveOps = FALSE;
+    return options1;
+}
+
 void D3D12RenderSystem::QueryRenderingCaps(RenderingCapabilities& caps)
 {
     const D3D_FEATURE_LEVEL featureLevel = GetFeatureLevel();
     //const int minorVersion = GetMinorVersion();
 
     const std::uint32_t maxThreadGroups = 65535u;
+    const D3D12_RESOURCE_BINDING_TIER resourceBindingTier = GetD3DResourceBindingTier(device_.GetNative());
 
     /* Query common attributes */
     caps.screenOrigin                               = ScreenOrigin::UpperLeft;
@@ -779,6 +1528,25 @@ void D3D12RenderSystem::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.features.hasPipelineCaching                = true;
     caps.features.hasPipelineStatistics             = true;
     caps.features.hasRenderCondition                = true;
+    caps.features.hasTimestampQueries               = true;
+    caps.features.hasQueryResolve                   = true;
+    caps.features.hasBindlessResourceHeaps          = (resourceBindingTier >= D3D12_RESOURCE_BINDING_TIER_2);
+    caps.features.hasIndirectCountDrawing           = true;
+    caps.features.hasMeshShaders                    = IsD3DMeshShaderSupported(device_.GetNative());
+    caps.features.hasTileShaders                    = false;
+    caps.features.hasFramebufferFetch               = false;
+    caps.features.hasVariableRateShading            = IsD3DVariableRateShadingSupported(device_.GetNative());
+    caps.features.hasIndirectStateChanges           = true;
+    caps.features.hasTransientBuffers               = true;
+    caps.features.hasPersistentMapping              = false;
+    caps.features.hasSparseTextures                 = (GetD3DTiledResourcesTier(device_.GetNative()) >= D3D12_TILED_RESOURCES_TIER_1);
+    caps.features.hasPlacementHeaps                 = true;
+    caps.features.hasSharedResources                = true;
+    caps.features.hasConcurrentResourceCreation     = true;
+    caps.features.hasRayTracing                     = (GetD3DRayTracingTier(device_.GetNative()) >= g_d3dRayTracingTier1_0);
+    caps.features.hasRayQuery                       = (GetD3DRayTracingTier(device_.GetNative()) >= g_d3dRayTracingTier1_1);
+    caps.features.hasMultiview                      = IsD3DViewInstancingSupported(device_.GetNative());
+    caps.features.hasSamplerFeedback                = IsD3DSamplerFeedbackSupported(device_.GetNative());
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = 1.0f;
@@ -797,6 +1565,7 @@ void D3D12RenderSystem::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.limits.maxComputeShaderWorkGroupSize[0]    = 1024u;
     caps.limits.maxComputeShaderWorkGroupSize[1]    = 1024u;
     caps.limits.maxComputeShaderWorkGroupSize[2]    = 1024u;
+    caps.limits.maxComputeShaderSharedMemorySize    = D3D12_CS_TGSM_REGISTER_COUNT * 4u;
     caps.limits.maxViewports                        = D3D12_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
     caps.limits.maxViewportSize[0]                  = D3D12_VIEWPORT_BOUNDS_MAX;
     caps.limits.maxViewportSize[1]                  = D3D12_VIEWPORT_BOUNDS_MAX;
@@ -812,6 +1581,28 @@ void D3D12RenderSystem::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.limits.maxStencilBufferSamples             = device_.FindSuitableSampleDesc(DXGI_FORMAT_D32_FLOAT_S8X24_UINT).Count;
     caps.limits.maxNoAttachmentSamples              = D3D12_MAX_MULTISAMPLE_SAMPLE_COUNT;
     caps.limits.storageResourceStageFlags           = GetStorageResourceStageFlags(featureLevel);
+    caps.limits.maxBindlessResourceViews            = (caps.features.hasBindlessResourceHeaps ? D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_1 : 0u);
+    caps.limits.sparseTileSize                      = (caps.features.hasSparseTextures ? D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES : 0u);
+    caps.limits.shadingRateImageTileSize            = GetD3DShadingRateImageTileSize(device_.GetNative());
+    caps.limits.maxMultiviewViewCount               = (caps.features.hasMultiview ? 4u : 0u); // D3D12_MAX_VIEW_INSTANCE_COUNT
+
+    /* Query wave intrinsics; Shader Model 6.0 provides all wave operations except relative shuffles and clustered operations */
+    const D3D12_FEATURE_DATA_D3D12_OPTIONS1 waveOptions = GetD3DWaveOptions(device_.GetNative());
+    if (waveOptions.WaveOps != FALSE)
+    {
+        caps.limits.subgroupSizeRange[0]            = waveOptions.WaveLaneCountMin;
+        caps.limits.subgroupSizeRange[1]            = waveOptions.WaveLaneCountMax;
+        caps.limits.subgroupStageFlags              = StageFlags::AllStages;
+        caps.limits.subgroupOperationFlags          =
+        (
+            SubgroupOperationFlags::Basic       |
+            SubgroupOperationFlags::Vote        |
+            SubgroupOperationFlags::Arithmetic  |
+            SubgroupOperationFlags::Ballot      |
+            SubgroupOperationFlags::Shuffle     |
+            SubgroupOperationFlags::Quad
+        );
+    }
 }
 
 void D3D12RenderSystem::ExecuteCommandListAndSync()
@@ -826,15 +1617,150 @@ void D3D12RenderSystem::UpdateBufferAndSync(
     std::uint64_t   dataSize,
     std::uint64_t   alignment)
 {
+    std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
     stagingBufferPool_.WriteImmediate(*commandContext_, bufferD3D.GetResource(), offset, data, dataSize, alignment);
     ExecuteCommandListAndSync();
 }
 
+void D3D12RenderSystem::UploadBufferAsync(D3D12Buffer& bufferD3D, const void* data, std::uint64_t dataSize)
+{
+    std::unique_lock<std::mutex> lock = uploadQueue_->Lock();
+
+    D3D12CommandContext& uploadContext = uploadQueue_->GetContext();
+    D3D12SubresourceContext subresourceContext{ uploadContext };
+
+    /* Write data into intermediate upload buffer */
+    ID3D12Resource* srcBuffer = subresourceContext.CreateUploadBuffer(dataSize);
+
+    void* mappedData = nullptr;
+    const D3D12_RANGE readRange{ 0, 0 };
+    HRESULT hr = srcBuffer->Map(0, &readRange, &mappedData);
+    DXThrowIfFailed(hr, "failed to map D3D12 upload buffer for initial buffer data");
+    ::memcpy(mappedData, data, static_cast<std::size_t>(dataSize));
+    srcBuffer->Unmap(0, nullptr);
+
+    /* Copy intermediate buffer into destination buffer */
+    D3D12Resource& dstBuffer = bufferD3D.GetResource();
+    uploadContext.TransitionResource(dstBuffer, D3D12_RESOURCE_STATE_COPY_DEST, true);
+    uploadContext.GetCommandList()->CopyBufferRegion(dstBuffer.Get(), 0, srcBuffer, 0, dataSize);
+    LLGL_PROFILE_COUNTER_ADD(stagingUploadBytes, dataSize);
+
+    uploadQueue_->EndUpload(subresourceContext, dstBuffer, dataSize);
+}
+
+void D3D12RenderSystem::UploadTextureAsync(D3D12Texture& textureD3D, const TextureRegion& region, const ImageView& imageView)
+{
+    std::unique_lock<std::mutex> lock = uploadQueue_->Lock();
+
+    D3D12SubresourceContext subresourceContext{ uploadQueue_->GetContext() };
+    UpdateTextureSubresourceFromImage(textureD3D, region, imageView, subresourceContext);
+
+    uploadQueue_->EndUpload(subresourceContext, textureD3D.GetResource(), imageView.dataSize);
+}
+
+#ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+bool D3D12RenderSystem::IsDirectStorageUpload(const FileUploadDescriptor& upload) const
+{
+    if (!D3D12DirectStorageQueue::IsUploadSizeSupported(upload))
+        return false;
+
+    if (upload.buffer != nullptr)
+    {
+        /* DirectStorage can only write into buffers in GPU local memory */
+        auto& bufferD3D = LLGL_CAST(D3D12Buffer&, *upload.buffer);
+        return (bufferD3D.GetHeapType() == D3D12_HEAP_TYPE_DEFAULT);
+    }
+
+    if (upload.texture != nullptr)
+    {
+        /* DirectStorage can only write a single subresource of textures that are neither multi-sampled nor depth-stencil formats */
+        auto& textureD3D = LLGL_CAST(D3D12Texture&, *upload.texture);
+        const TextureSubresource& subresource = upload.textureRegion.subresource;
+        if (subresource.numMipLevels != 1 || subresource.numArrayLayers != 1 || IsMultiSampleTexture(textureD3D.GetType()) || IsDepthOrStencilFormat(textureD3D.GetFormat()))
+            return false;
+
+        /* File data must already be laid out like the copyable footprint of the texture region, i.e. rows are aligned to 256 bytes */
+        const Extent3D          extent          = CalcTextureExtent(textureD3D.GetType(), upload.textureRegion.extent);
+        const SubresourceLayout layout          = CalcSubresourceLayout(textureD3D.GetFormat(), extent);
+        const std::uint32_t     rowStride       = (upload.rowStride != 0 ? upload.rowStride : layout.rowStride);
+        return (rowStride == GetAlignedSize<std::uint32_t>(layout.rowStride, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT));
+    }
+
+    return false;
+}
+
+void D3D12RenderSystem::WriteFromFileWithDirectStorage(const std::vector<const FileUploadDescriptor*>& uploads, Fence* fence)
+{
+    /*
+    DirectStorage cannot wait on GPU fences, so pending initial uploads must be complete before any destination is written.
+    Destination resources must also be in the common state, which requires a transition on the primary queue for resources that are in use.
+    */
+    uploadQueue_->WaitIdle();
+
+    std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
+    bool hasTransitions = false;
+    for (const FileUploadDescriptor* upload : uploads)
+    {
+        D3D12Resource& resource = (upload->buffer != nullptr ? LLGL_CAST(D3D12Buffer&, *upload->buffer).GetResource() : LLGL_CAST(D3D12Texture&, *upload->texture).GetResource());
+        if (resource.currentState != D3D12_RESOURCE_STATE_COMMON)
+        {
+            commandContext_->TransitionResource(resource, D3D12_RESOURCE_STATE_COMMON);
+            hasTransitions = true;
+        }
+    }
+
+    if (hasTransitions)
+    {
+        commandContext_->FlushResourceBarriers();
+        ExecuteCommandListAndSync();
+    }
+
+    /* Enqueue all requests and submit them with a single signal */
+    for (const FileUploadDescriptor* upload : uploads)
+    {
+        if (upload->buffer != nullptr)
+        {
+            auto& bufferD3D = LLGL_CAST(D3D12Buffer&, *upload->buffer);
+            directStorageQueue_->EnqueueBufferUpload(*upload, bufferD3D.GetNative(), upload->bufferOffset);
+        }
+        else
+        {
+            auto& textureD3D = LLGL_CAST(D3D12Texture&, *upload->texture);
+            const TextureRegion&    region  = upload->textureRegion;
+            const Offset3D          offset  = CalcTextureOffset(textureD3D.GetType(), region.offset);
+            const Extent3D          extent  = CalcTextureExtent(textureD3D.GetType(), region.extent);
+            const D3D12_BOX         box
+            {
+                static_cast<UINT>(offset.x),
+                static_cast<UINT>(offset.y),
+                static_cast<UINT>(offset.z),
+                static_cast<UINT>(offset.x) + extent.width,
+                static_cast<UINT>(offset.y) + extent.height,
+                static_cast<UINT>(offset.z) + extent.depth,
+            };
+            const UINT subresourceIndex = textureD3D.CalcSubresource(region.subresource.baseMipLevel, region.subresource.baseArrayLayer);
+            directStorageQueue_->EnqueueTextureUpload(*upload, textureD3D.GetNative(), subresourceIndex, box);
+        }
+    }
+
+    if (fence != nullptr)
+    {
+        auto& fenceD3D = LLGL_CAST(D3D12Fence&, *fence);
+        directStorageQueue_->Submit(fenceD3D.GetNative(), fenceD3D.Signal());
+    }
+    else
+        directStorageQueue_->Submit();
+}
+
+#endif // /LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
 void* D3D12RenderSystem::MapBufferRange(D3D12Buffer& bufferD3D, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
     void* mappedData = nullptr;
     const D3D12_RANGE range{ static_cast<SIZE_T>(offset), static_cast<SIZE_T>(offset + length) };
 
+    std::unique_lock<std::recursive_mutex> lock = commandQueue_->Lock();
     if (SUCCEEDED(bufferD3D.Map(*commandContext_, *commandQueue_, stagingBufferPool_, range, &mappedData, access)))
         return mappedData;
 
@@ -882,6 +1808,13 @@ HRESULT D3D12RenderSystem::UpdateTextureSubresourceFromImage(
     if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
         (formatAttribs.format != imageView.format || formatAttribs.dataType != imageView.dataType))
     {
+        /* Convert image data with a compute shader if enabled; intermediate upload buffers only hold the unconverted data then, which is not possible with the copy queue */
+        if (subresourceContext.GetCommandContext().GetCommandListType() != D3D12_COMMAND_LIST_TYPE_COPY &&
+            D3D12ImageConverter::Get().IsConversionSupported(textureD3D, imageView))
+        {
+            return D3D12ImageConverter::Get().ConvertImage(subresourceContext, textureD3D, region, imageView);
+        }
+
         /* Convert image data (e.g. from RGB to RGBA), and redirect initial data to new buffer */
         intermediateData    = ConvertImageBuffer(imageView, formatAttribs.format, formatAttribs.dataType, region.extent, LLGL_MAX_THREAD_COUNT);
         srcData             = intermediateData.get();
@@ -933,6 +1866,57 @@ bool D3D12RenderSystem::CheckFactoryFeatureSupport(DXGI_FEATURE feature) const
     return false;
 }
 
+IDXGIAdapter3* D3D12RenderSystem::GetDXGIAdapter3()
+{
+    if (!adapter_)
+    {
+        HRESULT hr = factory_->EnumAdapterByLuid(device_.GetNative()->GetAdapterLuid(), IID_PPV_ARGS(adapter_.ReleaseAndGetAddressOf()));
+        if (FAILED(hr))
+            adapter_.Reset();
+    }
+    return adapter_.Get();
+}
+
+// Structure for the Direct3D 12 pipeline cache ID
+struct D3D12PipelineCacheID
+{
+    std::uint32_t vendorID;         // DXGI_ADAPTER_DESC::VendorId
+    std::uint32_t deviceID;         // DXGI_ADAPTER_DESC::DeviceId
+    std::uint32_t subSysID;         // DXGI_ADAPTER_DESC::SubSysId
+    std::uint32_t revision;         // DXGI_ADAPTER_DESC::Revision
+    std::uint64_t driverVersion;    // User-mode driver version from IDXGIAdapter::CheckInterfaceSupport
+    std::uint32_t featureLevel;     // D3D_FEATURE_LEVEL
+    std::uint32_t reserved;         // Always 0
+};
+
+void D3D12RenderSystem::QueryPipelineCacheID(std::vector<char>& outCacheID)
+{
+    IDXGIAdapter3* adapter = GetDXGIAdapter3();
+    if (adapter == nullptr)
+        return;
+
+    DXGI_ADAPTER_DESC adapterDesc;
+    if (FAILED(adapter->GetDesc(&adapterDesc)))
+        return;
+
+    /* Cached PSOs are only valid for the same adapter and user-mode driver version */
+    LARGE_INTEGER driverVersion = {};
+    if (FAILED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driverVersion)))
+        driverVersion.QuadPart = 0;
+
+    outCacheID.resize(sizeof(D3D12PipelineCacheID));
+    D3D12PipelineCacheID* dst = reinterpret_cast<D3D12PipelineCacheID*>(outCacheID.data());
+    {
+        dst->vendorID       = adapterDesc.VendorId;
+        dst->deviceID       = adapterDesc.DeviceId;
+        dst->subSysID       = adapterDesc.SubSysId;
+        dst->revision       = adapterDesc.Revision;
+        dst->driverVersion  = static_cast<std::uint64_t>(driverVersion.QuadPart);
+        dst->featureLevel   = static_cast<std::uint32_t>(GetFeatureLevel());
+        dst->reserved       = 0;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -17,6 +17,8 @@
 #include "Command/D3D12CommandBuffer.h"
 #include "Command/D3D12CommandContext.h"
 #include "Command/D3D12SignatureFactory.h"
+#include "Command/D3D12UploadQueue.h"
+#include "Command/D3D12DirectStorageQueue.h"
 
 #include "Buffer/D3D12Buffer.h"
 #include "Buffer/D3D12BufferArray.h"
@@ -25,6 +27,7 @@
 #include "Texture/D3D12Texture.h"
 #include "Texture/D3D12Sampler.h"
 #include "Texture/D3D12RenderTarget.h"
+#include "Texture/D3D12PlacementHeap.h"
 
 #include "RenderState/D3D12Fence.h"
 #include "RenderState/D3D12PipelineCache.h"
@@ -38,9 +41,16 @@
 
 #include "../VideoAdapter.h"
 #include "../ContainerTypes.h"
+#include "../PipelineCacheStore.h"
+#include "../DeferredReleaseQueue.h"
+#include "../ShaderCache.h"
+#include "../SubmissionThread.h"
 #include "../DXCommon/ComPtr.h"
 #include <d3d12.h>
 #include <dxgi1_5.h>
+#include <deque>
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -62,6 +72,33 @@ class D3D12RenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
+
+        void WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence = nullptr) override;
+        void WriteFromFileAsync(std::uint32_t numUploads, const FileUploadDescriptor* uploads, Fence* fence = nullptr) override;
+
+        PlacementHeap* CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc) override;
+
+        void Release(PlacementHeap& placementHeap) override;
+
+        MemoryRequirements GetTextureMemoryRequirements(const TextureDescriptor& textureDesc) override;
+
+        Texture* CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc) override;
+
+        Texture* CreateSamplerFeedbackTexture(const SamplerFeedbackDescriptor& samplerFeedbackDesc) override;
+
+        bool ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle) override;
+
+        Texture* ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle) override;
+
+        Buffer* ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle) override;
+
+        bool ExportSharedFence(Fence& fence, SharedResourceHandle& outHandle) override;
+
+        AccelerationStructureSizes GetAccelerationStructureSizes(const AccelerationStructureDescriptor& accelerationStructureDesc) override;
+
     public:
 
         D3D12RenderSystem(const RenderSystemDescriptor& renderSystemDesc);
@@ -119,6 +156,18 @@ class D3D12RenderSystem final : public RenderSystem
             return tearingSupported_;
         }
 
+        // Returns the submission thread or null if RenderSystemFlags::SubmissionThread was not specified.
+        inline SubmissionThread* GetSubmissionThread() const
+        {
+            return submissionThread_.get();
+        }
+
+        // Returns the persistent shader cache or null if it is disabled. See RenderSystemDescriptor::shaderCacheFilename.
+        inline ShaderCache* GetShaderCache()
+        {
+            return (shaderCache_.IsOpen() ? &shaderCache_ : nullptr);
+        }
+
     private:
 
         #include <LLGL/Backend/RenderSystem.Internal.inl>
@@ -128,7 +177,7 @@ class D3D12RenderSystem final : public RenderSystem
         void EnableDebugLayer();
 
         void CreateFactory(bool debugDevice = false);
-        void QueryVideoAdapters(long flags, ComPtr<IDXGIAdapter>& outPreferredAdatper);
+        void QueryVideoAdapters(const RenderSystemDescriptor& renderSystemDesc, ComPtr<IDXGIAdapter>& outPreferredAdatper);
 
         HRESULT CreateDevice(IDXGIAdapter* preferredAdapter, long flags);
         HRESULT QueryDXInterfacesFromNativeHandle(const Direct3D12::RenderSystemNativeHandle& nativeHandle, long flags);
@@ -150,6 +199,16 @@ class D3D12RenderSystem final : public RenderSystem
             std::uint64_t   alignment   = 256u
         );
 
+        // Creates a buffer or texture and records its initial upload without checking the memory budget.
+        D3D12Buffer* CreateBufferInternal(const BufferDescriptor& bufferDesc, const void* initialData);
+        D3D12Texture* CreateTextureInternal(const TextureDescriptor& textureDesc, const ImageView* initialImage);
+
+        // Uploads the initial data of the specified buffer with the upload queue without waiting for the GPU.
+        void UploadBufferAsync(D3D12Buffer& bufferD3D, const void* data, std::uint64_t dataSize);
+
+        // Uploads the initial image of the specified texture with the upload queue without waiting for the GPU.
+        void UploadTextureAsync(D3D12Texture& textureD3D, const TextureRegion& region, const ImageView& imageView);
+
         // Maps the range of the specified D3D buffer between GPU and CPU memory space.
         void* MapBufferRange(D3D12Buffer& bufferD3D, const CPUAccess access, std::uint64_t offset, std::uint64_t length);
 
@@ -165,41 +224,111 @@ class D3D12RenderSystem final : public RenderSystem
 
         bool CheckFactoryFeatureSupport(DXGI_FEATURE feature) const;
 
+        // Returns the DXGI adapter 3 interface of the active device. This is queried once on the first call.
+        IDXGIAdapter3* GetDXGIAdapter3();
+
+        // Queries the pipeline cache ID from the active adapter and its user-mode driver version.
+        void QueryPipelineCacheID(std::vector<char>& outCacheID);
+
+        // Releases the intermediate resources of all asynchronous texture uploads the GPU has already finished.
+        void RecycleTextureUploads();
+
+        // Waits until all pending jobs of the submission thread have been executed. This has no effect if there is no submission thread.
+        void FlushSubmissionThread();
+
+        // Signals the fences of all command queues and returns the release serial for objects that are released now. 'releaseMutex_' must be locked.
+        std::uint64_t SignalReleaseSerial();
+
+        // Destroys all released objects whose release serial has been reached by all command queues.
+        void CollectDeferredReleases();
+
+        #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+        // Returns true if the specified file upload can be streamed with DirectStorage directly into its destination resource.
+        bool IsDirectStorageUpload(const FileUploadDescriptor& upload) const;
+
+        // Enqueues the specified file uploads into the DirectStorage queue and signals the optional fence once they have completed.
+        void WriteFromFileWithDirectStorage(const std::vector<const FileUploadDescriptor*>& uploads, Fence* fence);
+
+        #endif // /LLGL_D3D12_ENABLE_DIRECTSTORAGE
+
+    private:
+
+        // Intermediate resources of an asynchronous texture upload that must be kept alive until the upload fence has reached 'fenceValue'.
+        struct PendingTextureUpload
+        {
+            std::vector<ComPtr<ID3D12Resource>> intermediateResources;
+            UINT64                              fenceValue              = 0;
+        };
+
+        // Fence values of all command queues that have been signaled for a release serial; See SignalReleaseSerial().
+        struct ReleaseFenceValues
+        {
+            UINT64 directQueue  = 0;
+            UINT64 computeQueue = 0;
+            UINT64 copyQueue    = 0;
+            UINT64 uploadQueue  = 0;
+        };
+
     private:
 
         /* ----- Common objects ----- */
 
         ComPtr<IDXGIFactory4>                   factory_;
+        ComPtr<IDXGIAdapter3>                   adapter_;
         D3D12Device                             device_;
         D3D12CommandContext*                    commandContext_         = nullptr;
         D3D12PipelineLayout                     defaultPipelineLayout_;
         D3D12SignatureFactory                   cmdSignatureFactory_;
         D3D12StagingBufferPool                  stagingBufferPool_;
         bool                                    tearingSupported_       = false;
+        bool                                    gpuUploadHeapSupported_ = false;
+        PipelineCacheStore                      pipelineCacheStore_;
+        ShaderCache                             shaderCache_;
+        std::unique_ptr<SubmissionThread>       submissionThread_;              // Outlives all queues and swap-chains; See RenderSystemFlags::SubmissionThread
 
         /* ----- Hardware object containers ----- */
 
-        HWObjectContainer<D3D12SwapChain>       swapChains_;
-        HWObjectInstance<D3D12CommandQueue>     commandQueue_;
-        HWObjectContainer<D3D12CommandBuffer>   commandBuffers_;
-        HWObjectContainer<D3D12Buffer>          buffers_;
-        HWObjectContainer<D3D12BufferArray>     bufferArrays_;
-        HWObjectContainer<D3D12Texture>         textures_;
-        HWObjectContainer<D3D12Sampler>         samplers_;
-        HWObjectContainer<D3D12RenderPass>      renderPasses_;
-        HWObjectContainer<D3D12RenderTarget>    renderTargets_;
-        HWObjectContainer<D3D12Shader>          shaders_;
-        HWObjectContainer<D3D12PipelineLayout>  pipelineLayouts_;
-        HWObjectContainer<D3D12PipelineCache>   pipelineCaches_;
-        HWObjectContainer<D3D12PipelineState>   pipelineStates_;
-        HWObjectContainer<D3D12ResourceHeap>    resourceHeaps_;
-        HWObjectContainer<D3D12QueryHeap>       queryHeaps_;
-        HWObjectContainer<D3D12Fence>           fences_;
+        HWObjectContainer<D3D12SwapChain>                swapChains_;
+        HWObjectInstance<D3D12CommandQueue>              commandQueue_;
+        HWObjectInstance<D3D12CommandQueue>              computeQueue_;
+        HWObjectInstance<D3D12CommandQueue>              copyQueue_;
+        HWObjectInstance<D3D12UploadQueue>               uploadQueue_;
+
+        #ifdef LLGL_D3D12_ENABLE_DIRECTSTORAGE
+        HWObjectInstance<D3D12DirectStorageQueue>        directStorageQueue_;
+        #endif
+        HWObjectContainer<D3D12CommandBuffer>            commandBuffers_;
+        ConcurrentHWObjectContainer<D3D12Buffer>         buffers_;
+        HWObjectContainer<D3D12BufferArray>              bufferArrays_;
+        ConcurrentHWObjectContainer<D3D12Texture>        textures_;
+        HWObjectContainer<D3D12PlacementHeap>            placementHeaps_;
+        ConcurrentHWObjectContainer<D3D12Sampler>        samplers_;
+        HWObjectContainer<D3D12RenderPass>               renderPasses_;
+        HWObjectContainer<D3D12RenderTarget>             renderTargets_;
+        ConcurrentHWObjectContainer<D3D12Shader>         shaders_;
+        ConcurrentHWObjectContainer<D3D12PipelineLayout> pipelineLayouts_;
+        HWObjectContainer<D3D12PipelineCache>            pipelineCaches_;
+        ConcurrentHWObjectContainer<D3D12PipelineState>  pipelineStates_;
+        HWObjectContainer<D3D12ResourceHeap>             resourceHeaps_;
+        HWObjectContainer<D3D12QueryHeap>                queryHeaps_;
+        HWObjectContainer<D3D12Fence>                    fences_;
+
+        std::deque<HWObjectContainer<D3D12Fence>::object_ptr<D3D12Fence>> fencePool_; // Released fences in release order; see CreateFence()
 
         /* ----- Other members ----- */
 
         VideoAdapterInfo                        videoAdatperInfo_;
 
+        D3D12NativeFence                        uploadFence_;
+        UINT64                                  uploadFenceValue_       = 0;
+        std::deque<PendingTextureUpload>        pendingTextureUploads_;
+
+        std::mutex                              releaseMutex_;                  // Guards the release serials and deferred releases, since resources can be released on worker threads
+        std::deque<ReleaseFenceValues>          releaseFences_;                 // Fence values of pending release serials, starting after 'completedReleaseSerial_'
+        std::uint64_t                           completedReleaseSerial_ = 0;
+        DeferredReleaseQueue                    deferredReleases_;
+
 };
 
 
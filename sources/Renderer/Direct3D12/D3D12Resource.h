@@ -56,6 +56,7 @@ struct D3D12Resource
     D3D12_RESOURCE_STATES   usageState      = D3D12_RESOURCE_STATE_COMMON;  // Resource state combinations for common use.
     D3D12_RESOURCE_STATES   currentState    = D3D12_RESOURCE_STATE_COMMON;  // Current resource state.
     UINT                    cacheIndex      = 0;                            // Multi-purpose cache index to quickly find resource in active barrier queue.
+    bool                    isStateFixed    = false;                        // Resource state must not be transitioned, e.g. for resources in upload heaps.
 };
 
 
@@ -16,15 +16,23 @@ namespace LLGL
 {
 
 
-D3D12SubresourceContext::D3D12SubresourceContext(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue) :
+D3D12SubresourceContext::D3D12SubresourceContext(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue, bool syncWithGPU) :
     commandContext_ { commandContext },
-    commandQueue_   { commandQueue   }
+    commandQueue_   { &commandQueue  },
+    syncWithGPU_    { syncWithGPU    }
+{
+}
+
+D3D12SubresourceContext::D3D12SubresourceContext(D3D12CommandContext& commandContext) :
+    commandContext_ { commandContext },
+    syncWithGPU_    { false          }
 {
 }
 
 D3D12SubresourceContext::~D3D12SubresourceContext()
 {
-    commandQueue_.FinishAndSubmitCommandContext(commandContext_, true);
+    if (commandQueue_ != nullptr)
+        commandQueue_->FinishAndSubmitCommandContext(commandContext_, syncWithGPU_);
 }
 
 ID3D12Resource* D3D12SubresourceContext::CreateUploadBuffer(UINT64 size)
@@ -87,6 +95,13 @@ ComPtr<ID3D12Resource> D3D12SubresourceContext::TakeResource()
     return resource;
 }
 
+void D3D12SubresourceContext::TakeResources(std::vector<ComPtr<ID3D12Resource>>& outResources)
+{
+    for (ComPtr<ID3D12Resource>& resource : intermediateResources_)
+        outResources.push_back(std::move(resource));
+    intermediateResources_.clear();
+}
+
 ID3D12Resource* D3D12SubresourceContext::StoreAndGetNative(ComPtr<ID3D12Resource>&& resource)
 {
     intermediateResources_.push_back(std::move(resource));
@@ -13,6 +13,7 @@
 #include "Command/D3D12CommandContext.h"
 #include <LLGL/Container/SmallVector.h>
 #include <d3d12.h>
+#include <vector>
 
 
 namespace LLGL
@@ -25,7 +26,11 @@ class D3D12SubresourceContext
 
     public:
 
-        D3D12SubresourceContext(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue);
+        // Constructs the subresource context. If 'syncWithGPU' is false, the destructor submits the command context without waiting for the GPU.
+        D3D12SubresourceContext(D3D12CommandContext& commandContext, D3D12CommandQueue& commandQueue, bool syncWithGPU = true);
+
+        // Constructs the subresource context without a command queue. The destructor does not submit the command context, e.g. to batch uploads.
+        explicit D3D12SubresourceContext(D3D12CommandContext& commandContext);
         ~D3D12SubresourceContext();
 
         // Creates a buffer resource in the upload heap (D3D12_HEAP_TYPE_UPLOAD).
@@ -40,6 +45,9 @@ class D3D12SubresourceContext
         // Returns ownership of the most recently stored resource.
         ComPtr<ID3D12Resource> TakeResource();
 
+        // Moves ownership of all stored resources into the output container, e.g. to keep them alive until the GPU has finished an asynchronous upload.
+        void TakeResources(std::vector<ComPtr<ID3D12Resource>>& outResources);
+
         inline D3D12CommandContext& GetCommandContext()
         {
             return commandContext_;
@@ -63,8 +71,9 @@ class D3D12SubresourceContext
     private:
 
         D3D12CommandContext&                    commandContext_;
-        D3D12CommandQueue&                      commandQueue_;
+        D3D12CommandQueue*                      commandQueue_           = nullptr;
         SmallVector<ComPtr<ID3D12Resource>, 2>  intermediateResources_;
+        bool                                    syncWithGPU_            = true;
 
 };
 
@@ -14,14 +14,17 @@
 #include "Buffer/D3D12Buffer.h"
 #include "RenderState/D3D12DescriptorHeap.h"
 #include "../CheckedCast.h"
+#include "../SubmissionThread.h"
 #include "../../Core/CoreUtils.h"
 #include "../DXCommon/DXTypes.h"
 
 #include <LLGL/Platform/NativeHandle.h>
+#include <LLGL/Backend/Direct3D12/NativeHandle.h>
 #include <LLGL/Log.h>
 #include <LLGL/Utils/ForRange.h>
 #include "D3DX12/d3dx12.h"
 #include <algorithm>
+#include <vector>
 
 
 namespace LLGL
@@ -36,19 +39,28 @@ D3D12SwapChain::D3D12SwapChain(
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface)
 :
-    SwapChain           { desc                                                            },
-    renderSystem_       { renderSystem                                                    },
-    depthStencilFormat_ { DXPickDepthStencilFormat(desc.depthBits, desc.stencilBits)      },
-    frameFence_         { renderSystem.GetDXDevice()                                      },
-    numColorBuffers_    { Clamp(desc.swapBuffers, 1u, D3D12SwapChain::maxNumColorBuffers) },
-    tearingSupported_   { renderSystem.IsTearingSupported()                               }
-{
-    /* Store reference to command queue */
-    commandQueue_ = LLGL_CAST(D3D12CommandQueue*, renderSystem_.GetCommandQueue());
+    SwapChain            { desc                                                            },
+    renderSystem_        { renderSystem                                                    },
+    depthStencilFormat_  { DXPickDepthStencilFormat(desc.depthBits, desc.stencilBits)      },
+    frameFence_          { renderSystem.GetDXDevice()                                      },
+    numColorBuffers_     { Clamp(desc.swapBuffers, 1u, D3D12SwapChain::maxNumColorBuffers) },
+    presentMode_         { desc.presentMode                                                },
+    requestedColorSpace_ { desc.colorSpace                                                 },
+    tearingSupported_    { renderSystem.IsTearingSupported()                               }
+{
+    /* Store reference to command queue and submission thread */
+    commandQueue_       = LLGL_CAST(D3D12CommandQueue*, renderSystem_.GetCommandQueue());
+    submissionThread_   = renderSystem_.GetSubmissionThread();
+
+    /* Frames in flight are tracked per back buffer, so there can't be more frames in flight than back buffers */
+    numFramesInFlight_ = (desc.maxFramesInFlight > 0 ? Clamp(desc.maxFramesInFlight, 1u, numColorBuffers_) : numColorBuffers_);
 
     /* Setup surface for the swap-chain */
     SetOrCreateSurface(surface, SwapChain::BuildDefaultSurfaceTitle(renderSystem.GetRendererInfo()), desc);
 
+    /* Pick color format for the requested color space; The format is kept even if the color space turns out to be unsupported */
+    colorFormat_ = DXPickSwapChainColorFormat(requestedColorSpace_);
+
     /* Create device resources and window dependent resource */
     CreateDescriptorHeaps(renderSystem.GetDevice(), desc.samples);
     CreateResolutionDependentResources(GetResolution());
@@ -67,7 +79,11 @@ D3D12SwapChain::D3D12SwapChain(
 D3D12SwapChain::~D3D12SwapChain()
 {
     /* Ensure the GPU is no longer referencing resources that are about to be released */
+    FlushSubmissionThread();
     MoveToNextFrame();
+
+    if (frameLatencyWaitableObject_ != nullptr)
+        CloseHandle(frameLatencyWaitableObject_);
 }
 
 void D3D12SwapChain::SetDebugName(const char* name)
@@ -115,28 +131,83 @@ bool D3D12SwapChain::IsPresentable() const
 
 void D3D12SwapChain::Present()
 {
-    /* Present swap-chain with vsync interval */
-    const bool tearingEnabled   = (tearingSupported_ && windowedMode_ && syncInterval_ == 0);
-    const UINT presentFlags     = (tearingEnabled ? DXGI_PRESENT_ALLOW_TEARING : 0u);
-
-    HRESULT hr = S_OK;
-    if (isPresentationDirty_)
+    if (submissionThread_ != nullptr)
     {
-        /* Don't perform vsync when the back buffer has been resized to allow a smooth window resizing */
-        isPresentationDirty_ = false;
-        hr = swapChainDXGI_->Present(0, presentFlags);
+        /* Present on the submission thread; The next access to the back buffers waits for this ticket (see WaitForPendingPresent) */
+        presentTicket_ = submissionThread_->Enqueue([this]() { PresentAndMoveToNextFrame(); });
     }
     else
-        hr = swapChainDXGI_->Present(syncInterval_, presentFlags);
+        PresentAndMoveToNextFrame();
+}
 
-    DXThrowIfFailed(hr, "failed to present DXGI swap chain");
+void D3D12SwapChain::PresentBatch(std::uint32_t numSwapChains, D3D12SwapChain* const * swapChains)
+{
+    for (std::uint32_t first = 0; first < numSwapChains;)
+    {
+        /* Gather consecutive swap-chains that share the same submission thread */
+        SubmissionThread* submissionThread = swapChains[first]->submissionThread_;
+        std::uint32_t last = first + 1;
+        while (last < numSwapChains && swapChains[last]->submissionThread_ == submissionThread)
+            ++last;
 
-    /* Advance frame counter */
-    MoveToNextFrame();
+        if (submissionThread != nullptr)
+        {
+            /* Present the entire range with a single job; each swap-chain waits for the same ticket (see WaitForPendingPresent) */
+            std::vector<D3D12SwapChain*> batch{ swapChains + first, swapChains + last };
+            const std::uint64_t ticket = submissionThread->Enqueue(
+                [batch]() -> void
+                {
+                    for (D3D12SwapChain* swapChain : batch)
+                        swapChain->PresentAndMoveToNextFrame();
+                }
+            );
+            for (D3D12SwapChain* swapChain : batch)
+                swapChain->presentTicket_ = ticket;
+        }
+        else
+        {
+            for_subrange(i, first, last)
+                swapChains[i]->PresentAndMoveToNextFrame();
+        }
+
+        first = last;
+    }
+}
+
+bool D3D12SwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    WaitForPendingPresent();
+
+    /* Wait until DXGI has less than the maximum frame latency queued up */
+    if (frameLatencyWaitableObject_ != nullptr)
+    {
+        BeginFrameStatisticsStall();
+        const DWORD result = WaitForSingleObjectEx(frameLatencyWaitableObject_, DXNanosecsToMillisecs(timeout), FALSE);
+        EndFrameStatisticsStall(false);
+        return (result == WAIT_OBJECT_0);
+    }
+    else
+        return true;
+}
+
+bool D3D12SwapChain::GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (auto* nativeHandleD3D = GetTypedNativeHandle<Direct3D12::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        WaitForPendingPresent();
+        D3D12Resource& colorBuffer = colorBuffers_[currentColorBuffer_];
+        nativeHandleD3D->type                   = Direct3D12::ResourceNativeType::Resource;
+        nativeHandleD3D->resource.resource      = colorBuffer.Get();
+        nativeHandleD3D->resource.resourceState = colorBuffer.currentState;
+        nativeHandleD3D->resource.resource->AddRef();
+        return true;
+    }
+    return false;
 }
 
 std::uint32_t D3D12SwapChain::GetCurrentSwapIndex() const
 {
+    WaitForPendingPresent();
     return currentColorBuffer_;
 }
 
@@ -150,6 +221,18 @@ std::uint32_t D3D12SwapChain::GetSamples() const
     return sampleDesc_.Count;
 }
 
+ColorSpace D3D12SwapChain::GetColorSpace() const
+{
+    return colorSpace_;
+}
+
+bool D3D12SwapChain::GetFrameStatistics(FrameStatistics& outStatistics) const
+{
+    /* Frame statistics are recorded by the presentation */
+    WaitForPendingPresent();
+    return SwapChain::GetFrameStatistics(outStatistics);
+}
+
 Format D3D12SwapChain::GetColorFormat() const
 {
     return DXTypes::Unmap(colorFormat_);
@@ -167,6 +250,7 @@ const RenderPass* D3D12SwapChain::GetRenderPass() const
 
 bool D3D12SwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 {
+    WaitForPendingPresent();
     return SetPresentSyncInterval(vsyncInterval);
 }
 
@@ -175,7 +259,10 @@ bool D3D12SwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 UINT D3D12SwapChain::TranslateSwapIndex(std::uint32_t swapBufferIndex) const
 {
     if (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX)
+    {
+        WaitForPendingPresent();
         return currentColorBuffer_;
+    }
     else
         return std::min(swapBufferIndex, numColorBuffers_ - 1);
 }
@@ -357,6 +444,8 @@ HRESULT D3D12SwapChain::CopySubresourceRegion(
 
 bool D3D12SwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
 {
+    /* Command lists that still reference the old back buffers might be pending on the submission thread */
+    FlushSubmissionThread();
     CreateResolutionDependentResources(resolution);
 
     /* Mark presentation as dirty to avoid vsync on the next presentation; This allows a smooth window resizing like in other backends */
@@ -413,8 +502,11 @@ HRESULT D3D12SwapChain::CreateResolutionDependentResources(const Extent2D& resol
 {
     ID3D12Device* device = renderSystem_.GetDXDevice();
 
-    /* Wait until all previous GPU work is complete */
-    renderSystem_.SyncGPU();
+    /*
+    Wait until the GPU no longer references the back buffers. Only the frames in flight of this swap-chain are waited on,
+    since the swap-chain buffers are only used by the direct command queue; Other queues and pending uploads are not stalled.
+    */
+    WaitForFramesInFlight();
 
     /* Store current debug names */
     std::string debugNames[D3D12SwapChain::numDebugNames];
@@ -473,16 +565,24 @@ HRESULT D3D12SwapChain::CreateResolutionDependentResources(const Extent2D& resol
             swapChainDesc.Scaling               = DXGI_SCALING_NONE;
             swapChainDesc.SwapEffect            = DXGI_SWAP_EFFECT_FLIP_DISCARD;
             swapChainDesc.AlphaMode             = DXGI_ALPHA_MODE_IGNORE;
-            swapChainDesc.Flags                 = (tearingSupported_ ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0u);
+            swapChainDesc.Flags                 = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT | (tearingSupported_ ? DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING : 0u);
         }
         auto swapChain = renderSystem_.CreateDXSwapChain(swapChainDesc, &wndHandle, sizeof(wndHandle));
 
         swapChain.As(&swapChainDXGI_);
+
+        /* Limit frame latency to the number of frames in flight; The waitable object remains valid when the buffers are resized */
+        HRESULT hr = swapChainDXGI_->SetMaximumFrameLatency(numFramesInFlight_);
+        DXThrowIfFailed(hr, "failed to set maximum frame latency of DXGI swap chain");
+        frameLatencyWaitableObject_ = swapChainDXGI_->GetFrameLatencyWaitableObject();
     }
 
     /* Store windowed mode for tearing support */
     windowedMode_ = !DXGetFullscreenState(swapChainDXGI_.Get());
 
+    /* (Re-)apply color space, since the output might have changed its HDR support */
+    colorSpace_ = DXSetSwapChainColorSpace(swapChainDXGI_.Get(), requestedColorSpace_);
+
     /* Create color buffer render target views (RTV) */
     CreateColorBufferRTVs(device, resolution);
 
@@ -585,6 +685,40 @@ void D3D12SwapChain::CreateDepthStencil(ID3D12Device* device, const Extent2D& re
     device->CreateDepthStencilView(depthStencil_.native.Get(), nullptr, dsvDescHeap_->GetCPUDescriptorHandleForHeapStart());
 }
 
+void D3D12SwapChain::PresentAndMoveToNextFrame()
+{
+    /* Present swap-chain with vsync interval */
+    UINT syncInterval = 0, presentFlags = 0;
+    DXGetPresentParameters(presentMode_, syncInterval_, (tearingSupported_ && windowedMode_), syncInterval, presentFlags);
+
+    BeginFrameStatisticsStall();
+
+    HRESULT hr = S_OK;
+    if (isPresentationDirty_)
+    {
+        /* Don't perform vsync when the back buffer has been resized to allow a smooth window resizing */
+        isPresentationDirty_ = false;
+        hr = swapChainDXGI_->Present(0, presentFlags);
+    }
+    else
+        hr = swapChainDXGI_->Present(syncInterval, presentFlags);
+
+    DXThrowIfFailed(hr, "failed to present DXGI swap chain");
+
+    /* Advance frame counter, which waits for the next frame in flight to be available */
+    MoveToNextFrame();
+
+    EndFrameStatisticsStall(true);
+
+    /* Record display time of the most recently shown frame, which lags behind by a few presentations */
+    if (HasFrameStatistics())
+    {
+        UINT64 presentCount = 0, displayTime = 0;
+        if (DXGetFrameDisplayTime(swapChainDXGI_.Get(), presentCount, displayTime))
+            RecordFrameDisplayTime(presentCount, displayTime);
+    }
+}
+
 void D3D12SwapChain::MoveToNextFrame()
 {
     /* Schedule signal command into the queue */
@@ -595,10 +729,36 @@ void D3D12SwapChain::MoveToNextFrame()
     currentColorBuffer_ = swapChainDXGI_->GetCurrentBackBufferIndex();
 
     /* Wait until the fence value of the next frame is signaled, so we know the next frame is ready to start */
-    frameFence_.WaitForHigherSignal(frameFenceValues_[currentColorBuffer_]);
+    UINT64 waitFenceValue = frameFenceValues_[currentColorBuffer_];
+
+    /* Also wait for older frames if fewer frames in flight than back buffers have been requested */
+    if (currentFenceValue + 1 > numFramesInFlight_)
+        waitFenceValue = std::max<UINT64>(waitFenceValue, currentFenceValue + 1 - numFramesInFlight_);
+
+    frameFence_.WaitForHigherSignal(waitFenceValue);
     frameFenceValues_[currentColorBuffer_] = currentFenceValue + 1;
 }
 
+void D3D12SwapChain::WaitForPendingPresent() const
+{
+    if (submissionThread_ != nullptr)
+        submissionThread_->Wait(presentTicket_);
+}
+
+void D3D12SwapChain::FlushSubmissionThread()
+{
+    if (submissionThread_ != nullptr)
+        submissionThread_->Flush();
+}
+
+void D3D12SwapChain::WaitForFramesInFlight()
+{
+    /* Signal the fence value of the current frame early, so all work submitted up to this point is covered */
+    const UINT64 currentFenceValue = frameFenceValues_[currentColorBuffer_];
+    commandQueue_->SignalFence(frameFence_.Get(), currentFenceValue);
+    frameFence_.WaitForHigherSignal(currentFenceValue);
+}
+
 void D3D12SwapChain::StoreDebugNames(std::string (&debugNames)[D3D12SwapChain::numDebugNames])
 {
     for_range(i, D3D12SwapChain::maxNumColorBuffers)
@@ -30,6 +30,7 @@ class D3D12RenderSystem;
 class D3D12CommandQueue;
 class D3D12CommandBuffer;
 class D3D12CommandContext;
+class SubmissionThread;
 
 class D3D12SwapChain final : public SwapChain
 {
@@ -42,6 +43,14 @@ class D3D12SwapChain final : public SwapChain
 
         void SetDebugName(const char* name) override;
 
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
+        bool GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        ColorSpace GetColorSpace() const override;
+
+        bool GetFrameStatistics(FrameStatistics& outStatistics) const override;
+
     public:
 
         D3D12SwapChain(
@@ -52,6 +61,12 @@ class D3D12SwapChain final : public SwapChain
 
         ~D3D12SwapChain();
 
+        /*
+        Presents all specified swap-chains in the order they appear in the array. DXGI has no batched presentation,
+        but swap-chains that share the same submission thread are presented with a single job, so they can't be interleaved with other submissions.
+        */
+        static void PresentBatch(std::uint32_t numSwapChains, D3D12SwapChain* const * swapChains);
+
         UINT TranslateSwapIndex(std::uint32_t swapBufferIndex) const;
 
         // Returns the native color buffer resource from the swap-chain that is currently being used.
@@ -93,8 +108,20 @@ class D3D12SwapChain final : public SwapChain
         void CreateColorBufferRTVs(ID3D12Device* device, const Extent2D& resolution);
         void CreateDepthStencil(ID3D12Device* device, const Extent2D& resolution);
 
+        // Presents the current back buffer and moves to the next frame. This is executed on the submission thread if there is one.
+        void PresentAndMoveToNextFrame();
+
         void MoveToNextFrame();
 
+        // Waits until the pending presentation of this swap-chain has been executed by the submission thread, so the current back buffer is valid.
+        void WaitForPendingPresent() const;
+
+        // Waits until all pending jobs of the submission thread have been executed, e.g. before the back buffers are released.
+        void FlushSubmissionThread();
+
+        // Waits until all frames in flight of this swap-chain have been completed by the GPU.
+        void WaitForFramesInFlight();
+
         void StoreDebugNames(std::string (&debugNames)[D3D12SwapChain::numDebugNames]);
         void RestoreDebugNames(const std::string (&debugNames)[D3D12SwapChain::numDebugNames]);
 
@@ -102,11 +129,14 @@ class D3D12SwapChain final : public SwapChain
 
         D3D12RenderSystem&              renderSystem_;  // reference to its render system
         D3D12CommandQueue*              commandQueue_                           = nullptr;
+        SubmissionThread*               submissionThread_                       = nullptr;
+        std::uint64_t                   presentTicket_                          = 0;    // Ticket of the most recent presentation on the submission thread
         D3D12RenderPass                 defaultRenderPass_;
 
         ComPtr<IDXGISwapChain3>         swapChainDXGI_;
         DXGI_SAMPLE_DESC                sampleDesc_                             = { 1, 0 };
         UINT                            syncInterval_                           = 0;
+        HANDLE                          frameLatencyWaitableObject_             = nullptr;
 
         ComPtr<ID3D12DescriptorHeap>    rtvDescHeap_;
         UINT                            rtvDescSize_                            = 0;
@@ -123,9 +153,13 @@ class D3D12SwapChain final : public SwapChain
         D3D12NativeFence                frameFence_;
 
         UINT                            numColorBuffers_                        = 0;
+        UINT                            numFramesInFlight_                      = 0;
         UINT                            currentColorBuffer_                     = 0;
 
         bool                            hasDebugName_                           = false;
+        PresentMode                     presentMode_                            = PresentMode::Default;
+        ColorSpace                      requestedColorSpace_                    = ColorSpace::SRGB;
+        ColorSpace                      colorSpace_                             = ColorSpace::SRGB; // Color space that is in effect
         bool                            tearingSupported_                       = false;
         bool                            windowedMode_                           = false;
         bool                            isPresentationDirty_                    = false; // Has the back buffer been resized before it was presented again?
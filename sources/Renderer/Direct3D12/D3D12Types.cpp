@@ -301,6 +301,7 @@ D3D12_QUERY_TYPE MapQueryType(const QueryType queryType)
         case QueryType::StreamOutPrimitivesWritten:     return D3D12_QUERY_TYPE_SO_STATISTICS_STREAM0;
         case QueryType::StreamOutOverflow:              return D3D12_QUERY_TYPE_SO_STATISTICS_STREAM0; // Same query type, different interpretation
         case QueryType::PipelineStatistics:             return D3D12_QUERY_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                      return D3D12_QUERY_TYPE_TIMESTAMP;
     }
     LLGL_TRAP_DX_MAP(QueryType, queryType, D3D12_QUERY_TYPE);
 }
@@ -316,6 +317,7 @@ D3D12_QUERY_HEAP_TYPE MapQueryHeapType(const QueryType queryType)
         case QueryType::StreamOutPrimitivesWritten:     /* pass */
         case QueryType::StreamOutOverflow:              return D3D12_QUERY_HEAP_TYPE_SO_STATISTICS;
         case QueryType::PipelineStatistics:             return D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                      return D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
     }
     LLGL_TRAP_DX_MAP(QueryType, queryType, D3D12_QUERY_HEAP_TYPE);
 }
@@ -19,6 +19,42 @@
 #include "../DXCommon/DXTypes.h"
 
 
+// Mesh and amplification shaders (ID3D12GraphicsCommandList6::DispatchMesh) are only available with newer Windows SDKs.
+#if defined __ID3D12GraphicsCommandList6_INTERFACE_DEFINED__
+#   define LLGL_D3D12_ENABLE_MESH_SHADERS 1
+#else
+#   define LLGL_D3D12_ENABLE_MESH_SHADERS 0
+#endif
+
+// Variable rate shading (ID3D12GraphicsCommandList5::RSSetShadingRate) is only available with newer Windows SDKs.
+#if defined __ID3D12GraphicsCommandList5_INTERFACE_DEFINED__
+#   define LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING 1
+#else
+#   define LLGL_D3D12_ENABLE_VARIABLE_RATE_SHADING 0
+#endif
+
+// Ray tracing tiers (D3D12_FEATURE_D3D12_OPTIONS5) are only available with newer Windows SDKs.
+#if defined __ID3D12GraphicsCommandList4_INTERFACE_DEFINED__
+#   define LLGL_D3D12_ENABLE_RAYTRACING 1
+#else
+#   define LLGL_D3D12_ENABLE_RAYTRACING 0
+#endif
+
+// View instancing (ID3D12GraphicsCommandList1::SetViewInstanceMask and pipeline state streams) is only available with newer Windows SDKs.
+#if defined __ID3D12Device2_INTERFACE_DEFINED__ && defined __ID3D12GraphicsCommandList1_INTERFACE_DEFINED__
+#   define LLGL_D3D12_ENABLE_VIEW_INSTANCING 1
+#else
+#   define LLGL_D3D12_ENABLE_VIEW_INSTANCING 0
+#endif
+
+// Sampler feedback (ID3D12Device8::CreateSamplerFeedbackUnorderedAccessView) is only available with newer Windows SDKs.
+#if defined __ID3D12Device8_INTERFACE_DEFINED__ && LLGL_D3D12_ENABLE_VIEW_INSTANCING
+#   define LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK 1
+#else
+#   define LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK 0
+#endif
+
+
 namespace LLGL
 {
 
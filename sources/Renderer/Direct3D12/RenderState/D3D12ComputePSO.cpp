@@ -9,11 +9,13 @@
 #include "D3D12PipelineCache.h"
 #include "D3D12PipelineLayout.h"
 #include "../D3D12Device.h"
+#include "../D3D12ObjectUtils.h"
 #include "../Shader/D3D12Shader.h"
 #include "../Command/D3D12CommandContext.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
+#include "../../PipelineCacheStore.h"
 #include <LLGL/PipelineStateFlags.h>
 
 
@@ -25,7 +27,8 @@ D3D12ComputePSO::D3D12ComputePSO(
     ID3D12Device*                       device,
     D3D12PipelineLayout&                defaultPipelineLayout,
     const ComputePipelineDescriptor&    desc,
-    PipelineCache*                      pipelineCache)
+    PipelineCache*                      pipelineCache,
+    PipelineCacheStore*                 pipelineCacheStore)
 :
     D3D12PipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout, GetShadersAsArray(desc), defaultPipelineLayout }
 {
@@ -36,21 +39,34 @@ D3D12ComputePSO::D3D12ComputePSO(
         return;
     }
 
-    /* Create native compute PSO */
-    if (pipelineCache != nullptr)
-    {
-        auto* pipelineCacheD3D = LLGL_CAST(D3D12PipelineCache*, pipelineCache);
-        CreateNativePSO(device, computeShaderD3D->GetByteCode(), desc.debugName, pipelineCacheD3D);
-    }
-    else
-        CreateNativePSO(device, computeShaderD3D->GetByteCode(), desc.debugName);
-
-    if (desc.debugName != nullptr)
-        SetDebugName(desc.debugName);
+    /* Create native compute PSO; the persistent pipeline cache store is only used if no PSO cache was specified */
+    D3D12PipelineCache*         pipelineCacheD3D    = (pipelineCache != nullptr ? LLGL_CAST(D3D12PipelineCache*, pipelineCache) : nullptr);
+    const D3D12_SHADER_BYTECODE csBytecode          = computeShaderD3D->GetByteCode();
+    const std::string           debugName           = (desc.debugName != nullptr ? desc.debugName : "");
+    const bool                  isAsync             = ((desc.flags & PipelineStateFlags::AsyncCompilation) != 0);
+
+    RunCompilation(
+        isAsync,
+        [this, device, csBytecode, debugName, pipelineCacheD3D, pipelineCacheStore]()
+        {
+            CreateNativePSO(
+                device,
+                csBytecode,
+                (debugName.empty() ? nullptr : debugName.c_str()),
+                pipelineCacheD3D,
+                (pipelineCacheD3D == nullptr ? pipelineCacheStore : nullptr)
+            );
+            if (!debugName.empty())
+                D3D12SetObjectName(GetNative(), debugName.c_str());
+        }
+    );
 }
 
 void D3D12ComputePSO::Bind(D3D12CommandContext& commandContext)
 {
+    /* Wait for asynchronous compilation to finish */
+    WaitForCompilation();
+
     /* Set root signature and pipeline state */
     commandContext.SetComputeRootSignature(GetRootSignature());
     commandContext.SetPipelineState(GetNative());
@@ -60,7 +76,8 @@ void D3D12ComputePSO::CreateNativePSO(
     ID3D12Device*                   device,
     const D3D12_SHADER_BYTECODE&    csBytecode,
     const char*                     debugName,
-    D3D12PipelineCache*             pipelineCache)
+    D3D12PipelineCache*             pipelineCache,
+    PipelineCacheStore*             pipelineCacheStore)
 {
     /* Create graphics pipeline state and graphics command list */
     D3D12_COMPUTE_PIPELINE_STATE_DESC stateDesc = {};
@@ -68,18 +85,58 @@ void D3D12ComputePSO::CreateNativePSO(
     stateDesc.pRootSignature    = GetRootSignature();
     stateDesc.CS                = csBytecode;
 
+    /* Load PSO by name from pipeline library or store newly created one if the PSO cache is backed by a library */
+    if (pipelineCache != nullptr && pipelineCache->HasPipelineLibrary())
+    {
+        const std::uint64_t key = D3D12PipelineCache::GetStoreKey(stateDesc, GetRootSignatureBlob());
+        ComPtr<ID3D12PipelineState> pipelineState = pipelineCache->LoadPipeline(key, stateDesc);
+        if (!pipelineState)
+        {
+            pipelineState = CreateNativePSOWithDesc(device, stateDesc, debugName);
+            if (pipelineState)
+                pipelineCache->StorePipeline(key, pipelineState.Get());
+        }
+        SetNativeAndUpdateCache(std::move(pipelineState), nullptr);
+        return;
+    }
+
+    /* Use entry from persistent pipeline cache store if no PSO cache was specified */
+    const bool          usePersistentCache  = (pipelineCache == nullptr && pipelineCacheStore != nullptr);
+    const std::uint64_t storeKey            = (usePersistentCache ? D3D12PipelineCache::GetStoreKey(stateDesc, GetRootSignatureBlob()) : 0);
+
+    D3D12PipelineCache persistentCache{ usePersistentCache ? pipelineCacheStore->Read(storeKey) : Blob{} };
+    if (usePersistentCache)
+        pipelineCache = &persistentCache;
+
     /* Set PSO cache if specified */
     if (pipelineCache != nullptr)
         stateDesc.CachedPSO = pipelineCache->GetCachedPSO();
 
     /* Create native PSO */
-    SetNativeAndUpdateCache(CreateNativePSOWithDesc(device, stateDesc, debugName), pipelineCache);
+    SetNativeAndUpdateCache(CreateNativePSOWithDesc(device, stateDesc, debugName, pipelineCache), pipelineCache);
+
+    /* Write back new or refreshed entry to persistent pipeline cache store */
+    if (usePersistentCache && !persistentCache.HasInitialBlob() && GetNative() != nullptr)
+        pipelineCacheStore->Write(storeKey, persistentCache.GetBlob());
 }
 
-ComPtr<ID3D12PipelineState> D3D12ComputePSO::CreateNativePSOWithDesc(ID3D12Device* device, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const char* debugName)
+ComPtr<ID3D12PipelineState> D3D12ComputePSO::CreateNativePSOWithDesc(
+    ID3D12Device*                               device,
+    const D3D12_COMPUTE_PIPELINE_STATE_DESC&    desc,
+    const char*                                 debugName,
+    D3D12PipelineCache*                         pipelineCache)
 {
     ComPtr<ID3D12PipelineState> pipelineState;
     HRESULT hr = device->CreateComputePipelineState(&desc, IID_PPV_ARGS(pipelineState.ReleaseAndGetAddressOf()));
+    if (FAILED(hr) && desc.CachedPSO.pCachedBlob != nullptr)
+    {
+        /* Cached PSO was rejected, e.g. after a driver update, so discard it and create PSO from scratch */
+        D3D12_COMPUTE_PIPELINE_STATE_DESC uncachedDesc = desc;
+        uncachedDesc.CachedPSO = {};
+        if (pipelineCache != nullptr)
+            pipelineCache->Invalidate();
+        hr = device->CreateComputePipelineState(&uncachedDesc, IID_PPV_ARGS(pipelineState.ReleaseAndGetAddressOf()));
+    }
     if (FAILED(hr))
     {
         GetMutableReport().Errorf("Failed to create D3D12 compute pipelines state [%s] (HRESULT = %s)\n", debugName, DXErrorToStrOrHex(hr));
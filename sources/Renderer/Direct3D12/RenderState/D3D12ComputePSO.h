@@ -17,6 +17,7 @@ namespace LLGL
 
 
 class PipelineCache;
+class PipelineCacheStore;
 class D3D12Device;
 class D3D12ShaderProgram;
 class D3D12PipelineLayout;
@@ -31,7 +32,8 @@ class D3D12ComputePSO final : public D3D12PipelineState
             ID3D12Device*                       device,
             D3D12PipelineLayout&                defaultPipelineLayout,
             const ComputePipelineDescriptor&    desc,
-            PipelineCache*                      pipelineCache           = nullptr
+            PipelineCache*                      pipelineCache           = nullptr,
+            PipelineCacheStore*                 pipelineCacheStore      = nullptr
         );
 
         void Bind(D3D12CommandContext& commandContext) override;
@@ -42,10 +44,16 @@ class D3D12ComputePSO final : public D3D12PipelineState
             ID3D12Device*                   device,
             const D3D12_SHADER_BYTECODE&    csBytecode,
             const char*                     debugName,
-            D3D12PipelineCache*             pipelineCache   = nullptr
+            D3D12PipelineCache*             pipelineCache       = nullptr,
+            PipelineCacheStore*             pipelineCacheStore  = nullptr
         );
 
-        ComPtr<ID3D12PipelineState> CreateNativePSOWithDesc(ID3D12Device* device, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const char* debugName);
+        ComPtr<ID3D12PipelineState> CreateNativePSOWithDesc(
+            ID3D12Device*                               device,
+            const D3D12_COMPUTE_PIPELINE_STATE_DESC&    desc,
+            const char*                                 debugName,
+            D3D12PipelineCache*                         pipelineCache   = nullptr
+        );
 
 };
 
@@ -6,15 +6,20 @@
  */
 
 #include "D3D12DescriptorCache.h"
-#include "D3D12StagingDescriptorHeapPool.h"
+#include "D3D12DescriptorHeapRing.h"
 #include "../Buffer/D3D12Buffer.h"
 #include "../Texture/D3D12Texture.h"
 #include "../Texture/D3D12Sampler.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/HashUtils.h"
+#include <LLGL/Utils/ForRange.h>
 #include <thread>
 #include <chrono>
 #include <algorithm>
+#include <cstring>
+#include <cstdint>
 
 
 namespace LLGL
@@ -47,21 +52,31 @@ void D3D12DescriptorCache::Reset(UINT numResources, UINT numSamplers)
     if (descriptorHeaps_[g_dhIndexCbvSrvUav].GetSize() < numResources)
     {
         descriptorHeaps_[g_dhIndexCbvSrvUav].Reset(numResources);
+        descriptorKeys_[g_dhIndexCbvSrvUav].clear();
         dirtyBits_.descHeapCbvSrvUav = 1;
     }
+    descriptorKeys_[g_dhIndexCbvSrvUav].resize(numResources, DescriptorKey{});
 
     currentStrides_[g_dhIndexSampler] = numSamplers;
     if (descriptorHeaps_[g_dhIndexSampler].GetSize() < numSamplers)
     {
         descriptorHeaps_[g_dhIndexSampler].Reset(numSamplers);
+        descriptorKeys_[g_dhIndexSampler].clear();
         dirtyBits_.descHeapSampler = 1;
     }
+    descriptorKeys_[g_dhIndexSampler].resize(numSamplers, DescriptorKey{});
 }
 
 void D3D12DescriptorCache::Clear()
 {
     dirtyBits_.descHeapCbvSrvUav    = 1;
     dirtyBits_.descHeapSampler      = 1;
+
+    for_range(i, 2)
+    {
+        flushedTableKeys_[i].clear();
+        flushedTables_[i].clear();
+    }
 }
 
 void D3D12DescriptorCache::EmplaceDescriptor(Resource& resource, UINT location, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType)
@@ -71,19 +86,28 @@ void D3D12DescriptorCache::EmplaceDescriptor(Resource& resource, UINT location,
         case ResourceType::Buffer:
             LLGL_ASSERT(location < currentStrides_[g_dhIndexCbvSrvUav]);
             if (EmplaceBufferDescriptor(LLGL_CAST(D3D12Buffer&, resource), descriptorHeaps_[g_dhIndexCbvSrvUav].GetCpuHandleWithOffset(location), descRangeType))
+            {
+                SetDescriptorKey(g_dhIndexCbvSrvUav, location, &resource, descRangeType);
                 dirtyBits_.descHeapCbvSrvUav = 1;
+            }
             break;
 
         case ResourceType::Texture:
             LLGL_ASSERT(location < currentStrides_[g_dhIndexCbvSrvUav]);
             if (EmplaceTextureDescriptor(LLGL_CAST(D3D12Texture&, resource), descriptorHeaps_[g_dhIndexCbvSrvUav].GetCpuHandleWithOffset(location), descRangeType))
+            {
+                SetDescriptorKey(g_dhIndexCbvSrvUav, location, &resource, descRangeType);
                 dirtyBits_.descHeapCbvSrvUav = 1;
+            }
             break;
 
         case ResourceType::Sampler:
             LLGL_ASSERT(location < currentStrides_[g_dhIndexSampler]);
             if (EmplaceSamplerDescriptor(LLGL_CAST(D3D12Sampler&, resource), descriptorHeaps_[g_dhIndexSampler].GetCpuHandleWithOffset(location), descRangeType))
+            {
+                SetDescriptorKey(g_dhIndexSampler, location, &resource, descRangeType);
                 dirtyBits_.descHeapSampler = 1;
+            }
             break;
 
         default:
@@ -91,22 +115,33 @@ void D3D12DescriptorCache::EmplaceDescriptor(Resource& resource, UINT location,
     }
 }
 
-D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushCbvSrvUavDescriptors(D3D12StagingDescriptorHeapPool& descHeapPool)
+void D3D12DescriptorCache::EmplaceConstantBufferRange(D3D12Buffer& bufferD3D, UINT location, UINT64 offset, UINT64 size)
+{
+    LLGL_ASSERT(location < currentStrides_[g_dhIndexCbvSrvUav]);
+
+    /* CBV size must be a multiple of 256 bytes (D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT) */
+    const BufferViewDescriptor bufferViewDesc{ Format::Undefined, offset, GetAlignedSize<UINT64>(size, D3D12_CONSTANT_BUFFER_DATA_PLACEMENT_ALIGNMENT) };
+    bufferD3D.CreateConstantBufferView(device_, descriptorHeaps_[g_dhIndexCbvSrvUav].GetCpuHandleWithOffset(location), bufferViewDesc);
+    SetDescriptorKey(g_dhIndexCbvSrvUav, location, &bufferD3D, D3D12_DESCRIPTOR_RANGE_TYPE_CBV, bufferViewDesc.offset, bufferViewDesc.size);
+    dirtyBits_.descHeapCbvSrvUav = 1;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushCbvSrvUavDescriptors(D3D12DescriptorHeapRing& descHeapRing)
 {
     if (dirtyBits_.descHeapCbvSrvUav)
     {
         dirtyBits_.descHeapCbvSrvUav = 0;
-        return descHeapPool.CopyDescriptors(descriptorHeaps_[g_dhIndexCbvSrvUav].GetCpuHandleStart(), 0, currentStrides_[g_dhIndexCbvSrvUav]);
+        return FlushDescriptors(g_dhIndexCbvSrvUav, descHeapRing);
     }
     return {};
 }
 
-D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushSamplerDescriptors(D3D12StagingDescriptorHeapPool& descHeapPool)
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushSamplerDescriptors(D3D12DescriptorHeapRing& descHeapRing)
 {
     if (dirtyBits_.descHeapSampler)
     {
         dirtyBits_.descHeapSampler = 0;
-        return descHeapPool.CopyDescriptors(descriptorHeaps_[g_dhIndexSampler].GetCpuHandleStart(), 0, currentStrides_[g_dhIndexSampler]);
+        return FlushDescriptors(g_dhIndexSampler, descHeapRing);
     }
     return {};
 }
@@ -116,6 +151,41 @@ D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushSamplerDescriptors(D3D12S
  * ======= Private: =======
  */
 
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorCache::FlushDescriptors(UINT heapIndex, D3D12DescriptorHeapRing& descHeapRing)
+{
+    const UINT              numDescriptors  = currentStrides_[heapIndex];
+    const DescriptorKey*    keys            = descriptorKeys_[heapIndex].data();
+    const std::size_t       keysSize        = sizeof(DescriptorKey) * numDescriptors;
+
+    /* Re-use previously flushed table if it was created from the same descriptors */
+    const UINT64 hash = GetHash(keys, keysSize);
+    auto it = flushedTables_[heapIndex].find(hash);
+    if (it != flushedTables_[heapIndex].end())
+    {
+        const FlushedTable& table = it->second;
+        if (table.numKeys == numDescriptors && ::memcmp(&flushedTableKeys_[heapIndex][table.firstKey], keys, keysSize) == 0)
+            return table.gpuDescHandle;
+    }
+
+    /* Copy descriptors into shader-visible descriptor heap and keep track of the new table */
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = descHeapRing.CopyDescriptors(descriptorHeaps_[heapIndex].GetCpuHandleStart(), numDescriptors);
+
+    const std::size_t firstKey = flushedTableKeys_[heapIndex].size();
+    flushedTableKeys_[heapIndex].insert(flushedTableKeys_[heapIndex].end(), keys, keys + numDescriptors);
+    flushedTables_[heapIndex][hash] = FlushedTable{ gpuDescHandle, firstKey, numDescriptors };
+
+    return gpuDescHandle;
+}
+
+void D3D12DescriptorCache::SetDescriptorKey(UINT heapIndex, UINT location, const void* object, UINT64 type, UINT64 offset, UINT64 size)
+{
+    DescriptorKey& key = descriptorKeys_[heapIndex][location];
+    key.object  = static_cast<UINT64>(reinterpret_cast<std::uintptr_t>(object));
+    key.type    = type;
+    key.offset  = offset;
+    key.size    = size;
+}
+
 bool D3D12DescriptorCache::EmplaceBufferDescriptor(D3D12Buffer& bufferD3D, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType)
 {
     switch (descRangeType)
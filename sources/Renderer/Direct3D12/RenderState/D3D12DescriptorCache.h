@@ -10,6 +10,8 @@
 
 
 #include "D3D12DescriptorHeap.h"
+#include <vector>
+#include <unordered_map>
 
 
 namespace LLGL
@@ -20,7 +22,7 @@ class Resource;
 class D3D12Buffer;
 class D3D12Texture;
 class D3D12Sampler;
-class D3D12StagingDescriptorHeapPool;
+class D3D12DescriptorHeapRing;
 
 // D3D12 descriptor heap wrapper to manage shader-visible descriptor heaps.
 class D3D12DescriptorCache
@@ -41,17 +43,23 @@ class D3D12DescriptorCache
         // Resets the descriptor heap if the size must be increased and invalidates the cache.
         void Reset(UINT numResources, UINT numSamplers);
 
-        // Clears the cache.
+        // Clears the cache and forgets all descriptor tables that have been flushed so far.
         void Clear();
 
         // Emplaces a descriptor into the cache for the specified resource.
         void EmplaceDescriptor(Resource& resource, UINT location, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType);
 
-        // Flushes any invalidated CBV/SRV/UAV descriptors into the specified descriptor heap pools.
-        D3D12_GPU_DESCRIPTOR_HANDLE FlushCbvSrvUavDescriptors(D3D12StagingDescriptorHeapPool& descHeapPool);
+        // Emplaces a CBV descriptor into the cache for the specified range of a constant buffer.
+        void EmplaceConstantBufferRange(D3D12Buffer& bufferD3D, UINT location, UINT64 offset, UINT64 size);
 
-        // Flushes any invalidated sampler descriptors into the specified descriptor heap pools.
-        D3D12_GPU_DESCRIPTOR_HANDLE FlushSamplerDescriptors(D3D12StagingDescriptorHeapPool& descHeapPool);
+        /*
+        Flushes any invalidated CBV/SRV/UAV descriptors into the specified descriptor heap ring.
+        Returns the previously flushed table if it contains identical descriptors.
+        */
+        D3D12_GPU_DESCRIPTOR_HANDLE FlushCbvSrvUavDescriptors(D3D12DescriptorHeapRing& descHeapRing);
+
+        // Flushes any invalidated sampler descriptors into the specified descriptor heap ring.
+        D3D12_GPU_DESCRIPTOR_HANDLE FlushSamplerDescriptors(D3D12DescriptorHeapRing& descHeapRing);
 
         // Returns true if any cache entries are invalidated and need to be flushed again.
         inline bool IsInvalidated() const
@@ -65,20 +73,47 @@ class D3D12DescriptorCache
 
     private:
 
+        // Identifies the source of a descriptor to find identical descriptor tables.
+        struct DescriptorKey
+        {
+            UINT64 object;
+            UINT64 type;
+            UINT64 offset;
+            UINT64 size;
+        };
+
+        // Descriptor table that has been flushed into the descriptor heap ring.
+        struct FlushedTable
+        {
+            D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle;
+            std::size_t                 firstKey;
+            UINT                        numKeys;
+        };
+
+    private:
+
+        D3D12_GPU_DESCRIPTOR_HANDLE FlushDescriptors(UINT heapIndex, D3D12DescriptorHeapRing& descHeapRing);
+
+        void SetDescriptorKey(UINT heapIndex, UINT location, const void* object, UINT64 type, UINT64 offset = 0, UINT64 size = 0);
+
         bool EmplaceBufferDescriptor(D3D12Buffer& bufferD3D, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType);
         bool EmplaceTextureDescriptor(D3D12Texture& textureD3D, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType);
         bool EmplaceSamplerDescriptor(D3D12Sampler& samplerD3D, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, D3D12_DESCRIPTOR_RANGE_TYPE descRangeType);
 
     private:
 
-        ID3D12Device*       device_             = nullptr;
-        D3D12DescriptorHeap descriptorHeaps_[2];
-        UINT                currentStrides_[2]  = {};
+        ID3D12Device*                               device_                 = nullptr;
+        D3D12DescriptorHeap                         descriptorHeaps_[2];
+        UINT                                        currentStrides_[2]      = {};
+
+        std::vector<DescriptorKey>                  descriptorKeys_[2];                 // Source of each descriptor in the CPU descriptor heaps
+        std::vector<DescriptorKey>                  flushedTableKeys_[2];               // Descriptor keys of all flushed tables
+        std::unordered_map<UINT64, FlushedTable>    flushedTables_[2];                  // Flushed tables by hash of their descriptor keys
 
         struct
         {
-            UINT            descHeapCbvSrvUav   : 1;
-            UINT            descHeapSampler     : 1;
+            UINT                                    descHeapCbvSrvUav       : 1;
+            UINT                                    descHeapSampler         : 1;
         }
         dirtyBits_;
 
@@ -0,0 +1,298 @@
+/*
+ * D3D12DescriptorHeapRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12DescriptorHeapRing.h"
+#include "../../ProfileCounters.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
+#include <algorithm>
+#include <iterator>
+
+
+namespace LLGL
+{
+
+
+// Number of segments a persistent table can remain unused before it is evicted
+static constexpr UINT64 g_maxPersistentTableAge = 64;
+
+constexpr UINT D3D12DescriptorHeapRing::maxNumSegments;
+
+// Returns the maximum number of descriptor for the specified type
+static UINT GetMaxDescriptorHeapSize(D3D12_DESCRIPTOR_HEAP_TYPE type)
+{
+    switch (type)
+    {
+        case D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER:    return D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE;
+        default:                                    return D3D12_MAX_SHADER_VISIBLE_DESCRIPTOR_HEAP_SIZE_TIER_1;
+    }
+}
+
+// Returns the initial descriptor heap size for the specified type
+static UINT GetInitialDescriptorHeapSize(D3D12_DESCRIPTOR_HEAP_TYPE type)
+{
+    switch (type)
+    {
+        case D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER:    return D3D12_MAX_SHADER_VISIBLE_SAMPLER_HEAP_SIZE;
+        default:                                    return 65536;
+    }
+}
+
+void D3D12DescriptorHeapRing::InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type)
+{
+    device_                 = device;
+    type_                   = type;
+    currentSegmentIndex_    = 0;
+    currentSegment_         = 1;
+    completedSegment_       = 0;
+    segmentIDs_[0]          = currentSegment_;
+    retiredHeaps_.clear();
+    CreateHeap(GetInitialDescriptorHeapSize(type));
+}
+
+void D3D12DescriptorHeapRing::BeginSegment(UINT segmentIndex)
+{
+    LLGL_ASSERT(segmentIndex < D3D12DescriptorHeapRing::maxNumSegments);
+
+    /* Close current segment at the current ring head */
+    segmentEnds_[currentSegmentIndex_] = ringHead_;
+
+    /* Previous segment of the new index has completed on the GPU, so its range can be reclaimed */
+    completedSegment_   = std::max(completedSegment_, segmentIDs_[segmentIndex]);
+    ringTail_           = std::max(ringTail_, segmentEnds_[segmentIndex]);
+
+    /* Release heaps and persistent ranges that are no longer in use */
+    RemoveAllFromListIf(
+        retiredHeaps_,
+        [this](const RetiredHeap& entry) -> bool
+        {
+            return (entry.segment <= completedSegment_);
+        }
+    );
+
+    RemoveAllFromListIf(
+        retiredRanges_,
+        [this](const RetiredRange& entry) -> bool
+        {
+            if (entry.segment <= completedSegment_)
+            {
+                FreePersistentRange(entry.range);
+                return true;
+            }
+            return false;
+        }
+    );
+
+    EvictPersistentTables(g_maxPersistentTableAge);
+
+    /* Start new segment */
+    currentSegmentIndex_        = segmentIndex;
+    segmentIDs_[segmentIndex]   = ++currentSegment_;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorHeapRing::CopyDescriptors(
+    D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
+    UINT                        numDescriptors)
+{
+    LLGL_ASSERT_PTR(device_);
+
+    /* Allocate range from ring and replace heap if ring is exhausted by the current command list */
+    UINT offset = 0;
+    if (!AllocRingRange(numDescriptors, offset))
+    {
+        GrowHeap(numDescriptors);
+        const bool succeeded = AllocRingRange(numDescriptors, offset);
+        LLGL_ASSERT(succeeded, "failed to allocate %u descriptors from D3D12 descriptor heap ring", numDescriptors);
+    }
+
+    CopyDescriptorsToOffset(srcDescHandle, offset, numDescriptors);
+
+    return heap_.GetGpuHandleWithOffset(offset);
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE D3D12DescriptorHeapRing::CopyPersistentDescriptors(
+    UINT64                      key,
+    UINT64                      version,
+    D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
+    UINT                        numDescriptors)
+{
+    LLGL_ASSERT_PTR(device_);
+
+    auto it = persistentTables_.find(key);
+    if (it != persistentTables_.end())
+    {
+        PersistentTable& table = it->second;
+        if (table.version == version && table.size == numDescriptors)
+        {
+            /* Re-use persistent table without copying descriptors */
+            table.lastUsedSegment = currentSegment_;
+            return heap_.GetGpuHandleWithOffset(table.offset);
+        }
+
+        /* Retire outdated table until its last use has completed on the GPU */
+        retiredRanges_.push_back(RetiredRange{ DescriptorRange{ table.offset, table.size }, table.lastUsedSegment });
+        persistentTables_.erase(it);
+    }
+
+    /* Allocate persistent range and evict all unused tables if the persistent region is exhausted */
+    UINT offset = 0;
+    if (!AllocPersistentRange(numDescriptors, offset))
+    {
+        EvictPersistentTables(0);
+        if (!AllocPersistentRange(numDescriptors, offset))
+            return CopyDescriptors(srcDescHandle, numDescriptors);
+    }
+
+    CopyDescriptorsToOffset(srcDescHandle, offset, numDescriptors);
+    persistentTables_[key] = PersistentTable{ version, offset, numDescriptors, currentSegment_ };
+
+    return heap_.GetGpuHandleWithOffset(offset);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D12DescriptorHeapRing::CreateHeap(UINT size)
+{
+    heap_.Create(device_, type_, size, D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE);
+
+    /* Reserve a quarter of the heap for persistent descriptor tables */
+    persistentSize_ = size / 4;
+    ringSize_       = size - persistentSize_;
+    ringHead_       = 0;
+    ringTail_       = 0;
+    std::fill(std::begin(segmentEnds_), std::end(segmentEnds_), 0);
+
+    /* All persistent tables refer to the previous heap */
+    persistentTables_.clear();
+    retiredRanges_.clear();
+    persistentFreeRanges_.clear();
+    if (persistentSize_ > 0)
+        persistentFreeRanges_.push_back(DescriptorRange{ 0, persistentSize_ });
+}
+
+void D3D12DescriptorHeapRing::GrowHeap(UINT minNumDescriptors)
+{
+    /* Determine new heap size; the ring region must fit at least the requested number of descriptors */
+    const UINT maxSize = GetMaxDescriptorHeapSize(type_);
+    UINT newSize = heap_.GetSize();
+    while (newSize < maxSize && (newSize < heap_.GetSize() * 2 || newSize - newSize / 4 < minNumDescriptors))
+        newSize = std::min(newSize * 2, maxSize);
+
+    /* Keep previous heap alive until the current command list has completed on the GPU */
+    retiredHeaps_.push_back(RetiredHeap{ std::move(heap_), currentSegment_ });
+
+    CreateHeap(newSize);
+}
+
+bool D3D12DescriptorHeapRing::AllocRingRange(UINT numDescriptors, UINT& outOffset)
+{
+    if (numDescriptors > ringSize_)
+        return false;
+
+    /* Skip remaining descriptors at the end of the ring if the range does not fit, since tables must be contiguous */
+    UINT64 start = ringHead_;
+    const UINT64 position = start % ringSize_;
+    if (position + numDescriptors > ringSize_)
+        start += (ringSize_ - position);
+
+    /* Ring is full if the new range would overlap with ranges that are still in use by the GPU */
+    const UINT64 end = start + numDescriptors;
+    if (end - ringTail_ > ringSize_)
+        return false;
+
+    ringHead_   = end;
+    outOffset   = persistentSize_ + static_cast<UINT>(start % ringSize_);
+    return true;
+}
+
+bool D3D12DescriptorHeapRing::AllocPersistentRange(UINT numDescriptors, UINT& outOffset)
+{
+    /* Find first free range that fits */
+    for (auto it = persistentFreeRanges_.begin(); it != persistentFreeRanges_.end(); ++it)
+    {
+        if (it->size >= numDescriptors)
+        {
+            outOffset = it->offset;
+            it->offset  += numDescriptors;
+            it->size    -= numDescriptors;
+            if (it->size == 0)
+                persistentFreeRanges_.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void D3D12DescriptorHeapRing::FreePersistentRange(const DescriptorRange& range)
+{
+    if (range.size == 0)
+        return;
+
+    /* Insert range sorted by offset and merge with adjacent free ranges */
+    auto it = std::lower_bound(
+        persistentFreeRanges_.begin(),
+        persistentFreeRanges_.end(),
+        range.offset,
+        [](const DescriptorRange& entry, UINT offset) -> bool
+        {
+            return (entry.offset < offset);
+        }
+    );
+
+    it = persistentFreeRanges_.insert(it, range);
+
+    auto next = std::next(it);
+    if (next != persistentFreeRanges_.end() && it->offset + it->size == next->offset)
+    {
+        it->size += next->size;
+        persistentFreeRanges_.erase(next);
+    }
+
+    if (it != persistentFreeRanges_.begin())
+    {
+        auto prev = std::prev(it);
+        if (prev->offset + prev->size == it->offset)
+        {
+            prev->size += it->size;
+            persistentFreeRanges_.erase(it);
+        }
+    }
+}
+
+void D3D12DescriptorHeapRing::EvictPersistentTables(UINT64 minAge)
+{
+    for (auto it = persistentTables_.begin(); it != persistentTables_.end();)
+    {
+        const PersistentTable& table = it->second;
+        if (table.lastUsedSegment <= completedSegment_ && table.lastUsedSegment + minAge < currentSegment_)
+        {
+            FreePersistentRange(DescriptorRange{ table.offset, table.size });
+            it = persistentTables_.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+void D3D12DescriptorHeapRing::CopyDescriptorsToOffset(D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle, UINT offset, UINT numDescriptors)
+{
+    if (numDescriptors > 0)
+    {
+        device_->CopyDescriptorsSimple(numDescriptors, heap_.GetCpuHandleWithOffset(offset), srcDescHandle, type_);
+        LLGL_PROFILE_COUNTER_ADD(descriptorCopies, numDescriptors);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,159 @@
+/*
+ * D3D12DescriptorHeapRing.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_DESCRIPTOR_HEAP_RING_H
+#define LLGL_D3D12_DESCRIPTOR_HEAP_RING_H
+
+
+#include "D3D12DescriptorHeap.h"
+#include <d3d12.h>
+#include <vector>
+#include <unordered_map>
+
+
+namespace LLGL
+{
+
+
+/*
+Shader-visible D3D12 descriptor heap that is managed as a ring buffer.
+The heap is split into a region for persistent descriptor tables (i.e. tables of resource heaps that are re-used across command lists)
+and a ring region for transient descriptor tables. Each command allocator owns a segment of the ring,
+which is reclaimed once the fence of that allocator has been signaled. This allows a single heap to be bound throughout all command lists.
+The native heap is only replaced when a single command list exceeds the capacity of the ring.
+*/
+class D3D12DescriptorHeapRing
+{
+
+    public:
+
+        static constexpr UINT maxNumSegments = 3;
+
+    public:
+
+        D3D12DescriptorHeapRing() = default;
+
+        D3D12DescriptorHeapRing(const D3D12DescriptorHeapRing&) = delete;
+        D3D12DescriptorHeapRing& operator = (const D3D12DescriptorHeapRing&) = delete;
+
+        // Initializes the device object and creates the native shader-visible descriptor heap.
+        void InitializeDevice(ID3D12Device* device, D3D12_DESCRIPTOR_HEAP_TYPE type);
+
+        /*
+        Begins a new segment of the ring for the specified command allocator.
+        The fence of that allocator must have been signaled, so the range of its previous segment can be reclaimed.
+        */
+        void BeginSegment(UINT segmentIndex);
+
+        // Copies the specified source descriptors into the ring and returns the GPU descriptor handle to the copied range.
+        D3D12_GPU_DESCRIPTOR_HANDLE CopyDescriptors(
+            D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
+            UINT                        numDescriptors
+        );
+
+        /*
+        Returns the GPU descriptor handle to a persistent descriptor table for the specified key.
+        The source descriptors are only copied if no table with the same key and version is cached.
+        Falls back to CopyDescriptors if the persistent region is exhausted.
+        */
+        D3D12_GPU_DESCRIPTOR_HANDLE CopyPersistentDescriptors(
+            UINT64                      key,
+            UINT64                      version,
+            D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle,
+            UINT                        numDescriptors
+        );
+
+        // Returns the native D3D descriptor heap. This heap changes only when the ring had to be grown.
+        inline ID3D12DescriptorHeap* GetNative() const
+        {
+            return heap_.GetNative();
+        }
+
+    private:
+
+        struct DescriptorRange
+        {
+            UINT offset;
+            UINT size;
+        };
+
+        struct PersistentTable
+        {
+            UINT64  version;
+            UINT    offset;
+            UINT    size;
+            UINT64  lastUsedSegment;
+        };
+
+        struct RetiredRange
+        {
+            DescriptorRange range;
+            UINT64          segment;
+        };
+
+        struct RetiredHeap
+        {
+            D3D12DescriptorHeap heap;
+            UINT64              segment;
+        };
+
+    private:
+
+        // Creates the native descriptor heap with the specified size and resets all ranges.
+        void CreateHeap(UINT size);
+
+        // Replaces the native descriptor heap by a larger one that can fit at least the specified number of descriptors in its ring region.
+        void GrowHeap(UINT minNumDescriptors);
+
+        // Allocates a range in the ring region. Returns false if the ring is full.
+        bool AllocRingRange(UINT numDescriptors, UINT& outOffset);
+
+        // Allocates a range in the persistent region. Returns false if there is no free range that fits.
+        bool AllocPersistentRange(UINT numDescriptors, UINT& outOffset);
+
+        // Returns the specified range to the free ranges of the persistent region.
+        void FreePersistentRange(const DescriptorRange& range);
+
+        // Releases all persistent tables whose last use has completed on the GPU and that are older than the specified age.
+        void EvictPersistentTables(UINT64 minAge);
+
+        // Copies the specified source descriptors to the destination offset within the native heap.
+        void CopyDescriptorsToOffset(D3D12_CPU_DESCRIPTOR_HANDLE srcDescHandle, UINT offset, UINT numDescriptors);
+
+    private:
+
+        ID3D12Device*                                   device_                         = nullptr;
+        D3D12_DESCRIPTOR_HEAP_TYPE                      type_                           = D3D12_DESCRIPTOR_HEAP_TYPE_NUM_TYPES;
+        D3D12DescriptorHeap                             heap_;
+
+        UINT                                            persistentSize_                 = 0;
+        UINT                                            ringSize_                       = 0;
+        UINT64                                          ringHead_                       = 0;
+        UINT64                                          ringTail_                       = 0;
+
+        UINT                                            currentSegmentIndex_            = 0;
+        UINT64                                          currentSegment_                 = 0;
+        UINT64                                          completedSegment_               = 0;
+        UINT64                                          segmentIDs_[maxNumSegments]     = {};
+        UINT64                                          segmentEnds_[maxNumSegments]    = {};
+
+        std::unordered_map<UINT64, PersistentTable>     persistentTables_;
+        std::vector<DescriptorRange>                    persistentFreeRanges_;          // Free ranges in the persistent region, sorted by offset
+        std::vector<RetiredRange>                       retiredRanges_;                 // Persistent ranges that might still be in use by the GPU
+        std::vector<RetiredHeap>                        retiredHeaps_;                  // Native heaps that have been replaced but might still be in use by the GPU
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,7 +8,9 @@
 #include "D3D12Fence.h"
 #include "../D3D12ObjectUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/CoreUtils.h"
 #include "../../DXCommon/DXCore.h"
+#include <LLGL/Backend/Direct3D12/NativeHandle.h>
 #include <algorithm>
 
 
@@ -20,9 +22,9 @@ namespace LLGL
  * D3D12NativeFence
  */
 
-D3D12NativeFence::D3D12NativeFence(ID3D12Device* device, UINT64 initialValue)
+D3D12NativeFence::D3D12NativeFence(ID3D12Device* device, UINT64 initialValue, D3D12_FENCE_FLAGS flags)
 {
-    Create(device, initialValue);
+    Create(device, initialValue, flags);
 }
 
 D3D12NativeFence::~D3D12NativeFence()
@@ -30,12 +32,12 @@ D3D12NativeFence::~D3D12NativeFence()
     CloseHandle(event_);
 }
 
-void D3D12NativeFence::Create(ID3D12Device* device, UINT64 initialValue)
+void D3D12NativeFence::Create(ID3D12Device* device, UINT64 initialValue, D3D12_FENCE_FLAGS flags)
 {
     LLGL_ASSERT(native_.Get() == nullptr);
 
     /* Create D3D12 fence */
-    HRESULT hr = device->CreateFence(initialValue, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(native_.ReleaseAndGetAddressOf()));
+    HRESULT hr = device->CreateFence(initialValue, flags, IID_PPV_ARGS(native_.ReleaseAndGetAddressOf()));
     DXThrowIfCreateFailed(hr, "ID3D12Fence");
 
     /* Create Win32 event handle */
@@ -66,23 +68,28 @@ bool D3D12NativeFence::WaitForHigherSignal(UINT64 signal, DWORD timeoutMillisecs
  */
 
 D3D12Fence::D3D12Fence(ID3D12Device* device, UINT64 initialValue) :
-    native_ { device, initialValue },
-    value_  { initialValue + 1     }
+    native_         { device, initialValue, D3D12_FENCE_FLAG_SHARED },
+    value_          { initialValue                                  },
+    completedValue_ { initialValue                                  }
 {
 }
 
-void D3D12Fence::SetDebugName(const char* name)
+bool D3D12Fence::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
-    D3D12SetObjectName(native_.Get(), name);
+    if (auto* nativeHandleD3D = GetTypedNativeHandle<Direct3D12::FenceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        nativeHandleD3D->fence = native_.Get();
+        nativeHandleD3D->value = value_;
+        nativeHandleD3D->fence->AddRef();
+        MarkShared();
+        return true;
+    }
+    return false;
 }
 
-// Converts the specified amount of nanoseconds into milliseconds (rounded up)
-static DWORD NanosecsToMillisecs(UINT64 t)
+void D3D12Fence::SetDebugName(const char* name)
 {
-    if (t == ~0ull)
-        return INFINITE;
-    else
-        return static_cast<DWORD>((t + 999999) / 1000000);
+    D3D12SetObjectName(native_.Get(), name);
 }
 
 UINT64 D3D12Fence::Signal()
@@ -90,13 +97,22 @@ UINT64 D3D12Fence::Signal()
     return ++value_;
 }
 
+bool D3D12Fence::IsSignaled()
+{
+    /* Check cached completed value first, so polling a completed fence doesn't call into the driver */
+    if (completedValue_ >= value_)
+        return true;
+    completedValue_ = native_.GetCompletedValue();
+    return (completedValue_ >= value_);
+}
+
 bool D3D12Fence::Wait(UINT64 timeout)
 {
-    if (value_ > native_.GetCompletedValue())
-    {
-        native_.WaitForSignal(value_, NanosecsToMillisecs(timeout));
-        value_ = native_.GetCompletedValue();
-    }
+    if (IsSignaled())
+        return true;
+    if (timeout == 0 || !native_.WaitForSignal(value_, DXNanosecsToMillisecs(timeout)))
+        return false;
+    completedValue_ = value_;
     return true;
 }
 
@@ -30,13 +30,13 @@ class D3D12NativeFence
         D3D12NativeFence& operator = (const D3D12NativeFence&) = delete;
 
         // Constructs the native D3D12 fence and event handle. Also initializes it with an optional value.
-        D3D12NativeFence(ID3D12Device* device, UINT64 initialValue = 0);
+        D3D12NativeFence(ID3D12Device* device, UINT64 initialValue = 0, D3D12_FENCE_FLAGS flags = D3D12_FENCE_FLAG_NONE);
 
         // Destroys the native D3D12 fence and event handle.
         ~D3D12NativeFence();
 
         // Creates the native D3D12 fence and event handle.
-        void Create(ID3D12Device* device, UINT64 initialValue = 0);
+        void Create(ID3D12Device* device, UINT64 initialValue = 0, D3D12_FENCE_FLAGS flags = D3D12_FENCE_FLAG_NONE);
 
         // Waits until this fence has been signaled with the specified value.
         bool WaitForSignal(UINT64 signal, DWORD timeoutMillisecs = INFINITE);
@@ -71,8 +71,13 @@ class D3D12Fence final : public Fence
 
         void SetDebugName(const char* name) override;
 
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        bool IsSignaled() override;
+
     public:
 
+        // Constructs the fence with the shared flag, so it can be exported via ID3D12Device::CreateSharedHandle.
         D3D12Fence(ID3D12Device* device, UINT64 initialValue = 0);
 
         // Sets the next signal value.
@@ -81,6 +86,18 @@ class D3D12Fence final : public Fence
         // Waits until the current signaled value is completed.
         bool Wait(UINT64 timeout);
 
+        // Marks this fence as shared outside of LLGL, e.g. when its native handle has been retrieved. Shared fences are not recycled.
+        inline void MarkShared()
+        {
+            isShared_ = true;
+        }
+
+        // Returns true if this fence has been shared outside of LLGL. See MarkShared().
+        inline bool IsShared() const
+        {
+            return isShared_;
+        }
+
         // Returns the native ID3D12Fence object.
         inline ID3D12Fence* GetNative() const
         {
@@ -102,7 +119,9 @@ class D3D12Fence final : public Fence
     private:
 
         D3D12NativeFence    native_;
-        UINT64              value_  = 0;
+        UINT64              value_          = 0;
+        UINT64              completedValue_ = 0;
+        bool                isShared_       = false;
 
 };
 
@@ -17,6 +17,8 @@
 #include "../../DXCommon/DXCore.h"
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
+#include "../../RenderPassUtils.h"
+#include "../../PipelineCacheStore.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/ByteBufferIterator.h"
@@ -37,17 +39,44 @@ D3D12GraphicsPSO::D3D12GraphicsPSO(
     D3D12PipelineLayout&                defaultPipelineLayout,
     const GraphicsPipelineDescriptor&   desc,
     const D3D12RenderPass*              defaultRenderPass,
-    PipelineCache*                      pipelineCache)
+    PipelineCache*                      pipelineCache,
+    PipelineCacheStore*                 pipelineCacheStore)
 :
     D3D12PipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout, GetShadersAsArray(desc), defaultPipelineLayout }
 {
     /* Validate pointers and get D3D shader program */
-    if (desc.vertexShader == nullptr)
+    if (desc.vertexShader == nullptr && desc.meshShader == nullptr)
     {
         ResetReport("cannot create D3D graphics PSO without vertex shader", true);
         return;
     }
 
+    #if !LLGL_D3D12_ENABLE_MESH_SHADERS
+    if (desc.meshShader != nullptr)
+    {
+        ResetReport("cannot create D3D graphics PSO with mesh shader; LLGL was built without mesh shader support", true);
+        return;
+    }
+    #endif
+
+    #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+    if (desc.viewMask != 0)
+    {
+        if (NumMultiviewLayers(desc.viewMask) > D3D12_MAX_VIEW_INSTANCE_COUNT)
+        {
+            ResetReport("cannot create D3D graphics PSO with view mask beyond the first 4 array layers", true);
+            return;
+        }
+        BuildViewInstanceLocations(desc.viewMask);
+    }
+    #else
+    if (desc.viewMask != 0)
+    {
+        ResetReport("cannot create D3D graphics PSO with view mask; LLGL was built without view instancing support", true);
+        return;
+    }
+    #endif
+
     /* Use either default render pass or from descriptor */
     const D3D12RenderPass* renderPassD3D = nullptr;
     if (desc.renderPass != nullptr)
@@ -86,14 +115,20 @@ D3D12GraphicsPSO::D3D12GraphicsPSO(
         CreateNativePSO(device, *pipelineLayoutD3D, renderPassD3D, desc, pipelineCacheD3D);
     }
     else
-        CreateNativePSO(device, *pipelineLayoutD3D, renderPassD3D, desc);
+        CreateNativePSO(device, *pipelineLayoutD3D, renderPassD3D, desc, nullptr, pipelineCacheStore);
+}
 
-    if (desc.debugName != nullptr)
-        SetDebugName(desc.debugName);
+D3D12GraphicsPSO::~D3D12GraphicsPSO()
+{
+    /* Wait for asynchronous compilation before secondary PSO is released */
+    WaitForCompilation();
 }
 
 void D3D12GraphicsPSO::Bind(D3D12CommandContext& commandContext)
 {
+    /* Wait for asynchronous compilation to finish */
+    WaitForCompilation();
+
     /* Set root signature and pipeline state */
     commandContext.SetGraphicsRootSignature(GetRootSignature());
     if (secondaryPSO_)
@@ -106,6 +141,11 @@ void D3D12GraphicsPSO::Bind(D3D12CommandContext& commandContext)
 
     commandList->IASetPrimitiveTopology(primitiveTopology_);
 
+    #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+    if (numViewInstances_ > 0)
+        commandContext.SetViewInstanceMask((1u << numViewInstances_) - 1u);
+    #endif
+
     if (stencilRefEnabled_)
         commandList->OMSetStencilRef(stencilRef_);
     if (blendFactorEnabled_)
@@ -357,7 +397,8 @@ static D3D12_PRIMITIVE_TOPOLOGY_TYPE GetPrimitiveToplogyType(const PrimitiveTopo
 static D3D12_INPUT_LAYOUT_DESC GetD3DInputLayoutDesc(const Shader* vs)
 {
     D3D12_INPUT_LAYOUT_DESC desc = {};
-    LLGL_CAST(const D3D12Shader*, vs)->GetInputLayoutDesc(desc);
+    if (vs != nullptr)
+        LLGL_CAST(const D3D12Shader*, vs)->GetInputLayoutDesc(desc);
     return desc;
 }
 
@@ -383,7 +424,8 @@ void D3D12GraphicsPSO::CreateNativePSO(
     const D3D12PipelineLayout&          pipelineLayout,
     const D3D12RenderPass*              renderPass,
     const GraphicsPipelineDescriptor&   desc,
-    D3D12PipelineCache*                 pipelineCache)
+    D3D12PipelineCache*                 pipelineCache,
+    PipelineCacheStore*                 pipelineCacheStore)
 {
     /* Get number of render-target attachments */
     const UINT numAttachments = (renderPass != nullptr ? renderPass->GetNumColorAttachments() : 1);
@@ -432,6 +474,97 @@ void D3D12GraphicsPSO::CreateNativePSO(
     if (desc.rasterizer.discardEnabled)
         stateDesc.StreamOutput.RasterizedStream = D3D12_SO_NO_RASTERIZED_STREAM;
 
+    /* Create native PSOs on a worker thread if async compilation was requested */
+    const bool          needsSecondaryPSO   = (isStripTopology && desc.indexFormat == Format::Undefined);
+    const std::string   debugName           = (desc.debugName != nullptr ? desc.debugName : "");
+    const bool          isAsync             = ((desc.flags & PipelineStateFlags::AsyncCompilation) != 0);
+
+    #if LLGL_D3D12_ENABLE_MESH_SHADERS
+    if (desc.meshShader != nullptr)
+    {
+        /* Mesh PSOs have no input assembler stage and are neither stored in pipeline libraries nor in the persistent cache store */
+        const D3D12_SHADER_BYTECODE amplificationShader = GetD3DShaderByteCode(desc.taskShader);
+        const D3D12_SHADER_BYTECODE meshShader          = GetD3DShaderByteCode(desc.meshShader);
+        RunCompilation(
+            isAsync,
+            [this, device, stateDesc, amplificationShader, meshShader, debugName, pipelineCache]()
+            {
+                const char* debugNameOpt = (debugName.empty() ? nullptr : debugName.c_str());
+                SetNativeAndUpdateCache(
+                    CreateNativeMeshPSOWithDesc(device, stateDesc, amplificationShader, meshShader, debugNameOpt, pipelineCache),
+                    pipelineCache
+                );
+                if (!debugName.empty())
+                    D3D12SetObjectName(GetNative(), debugName.c_str());
+            }
+        );
+        return;
+    }
+    #endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+    RunCompilation(
+        isAsync,
+        [this, device, stateDesc, needsSecondaryPSO, debugName, pipelineCache, pipelineCacheStore]()
+        {
+            CreateNativePSOAndUpdateCaches(
+                device,
+                stateDesc,
+                needsSecondaryPSO,
+                (debugName.empty() ? nullptr : debugName.c_str()),
+                pipelineCache,
+                pipelineCacheStore
+            );
+            if (!debugName.empty())
+                D3D12SetObjectName(GetNative(), debugName.c_str());
+        }
+    );
+}
+
+void D3D12GraphicsPSO::CreateNativePSOAndUpdateCaches(
+    ID3D12Device*                       device,
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC  stateDesc,
+    bool                                needsSecondaryPSO,
+    const char*                         debugName,
+    D3D12PipelineCache*                 pipelineCache,
+    PipelineCacheStore*                 pipelineCacheStore)
+{
+    #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+    if (numViewInstances_ > 0)
+    {
+        /* View-instanced PSOs are neither stored in pipeline libraries nor in the persistent cache store, since their key does not cover the view instancing state */
+        D3D12PipelineCache* streamPipelineCache = (pipelineCache != nullptr && !pipelineCache->HasPipelineLibrary() ? pipelineCache : nullptr);
+        ComPtr<ID3D12PipelineState> primaryPSO = CreateNativeViewInstancedPSOWithDesc(device, stateDesc, debugName, streamPipelineCache);
+        if (needsSecondaryPSO)
+        {
+            stateDesc.IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
+            secondaryPSO_ = CreateNativeViewInstancedPSOWithDesc(device, stateDesc, debugName);
+        }
+        SetNativeAndUpdateCache(std::move(primaryPSO), streamPipelineCache);
+        return;
+    }
+    #endif // /LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+    /* Load PSOs by name from pipeline library or store newly created ones if the PSO cache is backed by a library */
+    if (pipelineCache != nullptr && pipelineCache->HasPipelineLibrary())
+    {
+        ComPtr<ID3D12PipelineState> primaryPSO = LoadOrCreateNativePSOWithLibrary(device, stateDesc, debugName, *pipelineCache);
+        if (needsSecondaryPSO)
+        {
+            stateDesc.IBStripCutValue = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
+            secondaryPSO_ = LoadOrCreateNativePSOWithLibrary(device, stateDesc, debugName, *pipelineCache);
+        }
+        SetNativeAndUpdateCache(std::move(primaryPSO), nullptr);
+        return;
+    }
+
+    /* Use entry from persistent pipeline cache store if no PSO cache was specified */
+    const bool          usePersistentCache  = (pipelineCache == nullptr && pipelineCacheStore != nullptr);
+    const std::uint64_t storeKey            = (usePersistentCache ? D3D12PipelineCache::GetStoreKey(stateDesc, GetRootSignatureBlob()) : 0);
+
+    D3D12PipelineCache persistentCache{ usePersistentCache ? pipelineCacheStore->Read(storeKey) : Blob{} };
+    if (usePersistentCache)
+        pipelineCache = &persistentCache;
+
     /* Set PSO cache if specified */
     if (pipelineCache != nullptr)
         stateDesc.CachedPSO = pipelineCache->GetCachedPSO();
@@ -439,26 +572,43 @@ void D3D12GraphicsPSO::CreateNativePSO(
     /* Create native PSO */
     ComPtr<ID3D12PipelineState> primaryPSO;
 
-    if (isStripTopology && desc.indexFormat == Format::Undefined)
+    if (needsSecondaryPSO)
     {
         /* Create primary PSO with 32-bit index cut off value */
-        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, desc.debugName);
+        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, debugName, pipelineCache);
 
         /* Create secondary PSO with 16-bit index cut off value */
         stateDesc.IBStripCutValue   = D3D12_INDEX_BUFFER_STRIP_CUT_VALUE_0xFFFF;
         stateDesc.CachedPSO         = {};
-        secondaryPSO_ = CreateNativePSOWithDesc(device, stateDesc, desc.debugName);
+        secondaryPSO_ = CreateNativePSOWithDesc(device, stateDesc, debugName);
     }
     else
-        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, desc.debugName);
+        primaryPSO = CreateNativePSOWithDesc(device, stateDesc, debugName, pipelineCache);
 
     SetNativeAndUpdateCache(std::move(primaryPSO), pipelineCache);
+
+    /* Write back new or refreshed entry to persistent pipeline cache store */
+    if (usePersistentCache && !persistentCache.HasInitialBlob() && GetNative() != nullptr)
+        pipelineCacheStore->Write(storeKey, persistentCache.GetBlob());
 }
 
-ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativePSOWithDesc(ID3D12Device* device, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const char* debugName)
+ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativePSOWithDesc(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    const char*                                 debugName,
+    D3D12PipelineCache*                         pipelineCache)
 {
     ComPtr<ID3D12PipelineState> pipelineState;
     HRESULT hr = device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(pipelineState.ReleaseAndGetAddressOf()));
+    if (FAILED(hr) && desc.CachedPSO.pCachedBlob != nullptr)
+    {
+        /* Cached PSO was rejected, e.g. after a driver update, so discard it and create PSO from scratch */
+        D3D12_GRAPHICS_PIPELINE_STATE_DESC uncachedDesc = desc;
+        uncachedDesc.CachedPSO = {};
+        if (pipelineCache != nullptr)
+            pipelineCache->Invalidate();
+        hr = device->CreateGraphicsPipelineState(&uncachedDesc, IID_PPV_ARGS(pipelineState.ReleaseAndGetAddressOf()));
+    }
     if (FAILED(hr))
     {
         GetMutableReport().Errorf("Failed to create D3D12 graphics pipeline state [%s] (HRESULT = %s)\n", GetOptionalDebugName(debugName), DXErrorToStrOrHex(hr));
@@ -467,6 +617,230 @@ ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativePSOWithDesc(ID3D12Devi
     return pipelineState;
 }
 
+#if LLGL_D3D12_ENABLE_MESH_SHADERS || LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+// Pipeline state stream subobject; each subobject must be aligned to the size of a pointer.
+template <D3D12_PIPELINE_STATE_SUBOBJECT_TYPE TType, typename T>
+struct alignas(void*) D3D12PipelineStateSubobject
+{
+    D3D12_PIPELINE_STATE_SUBOBJECT_TYPE type    = TType;
+    T                                   value   = {};
+};
+
+// Creates a PSO from the specified pipeline state stream struct.
+template <typename TStream>
+static HRESULT DXCreatePipelineStateFromStream(ID3D12Device2* device, const TStream& stream, ComPtr<ID3D12PipelineState>& outPipelineState)
+{
+    D3D12_PIPELINE_STATE_STREAM_DESC streamDesc;
+    {
+        streamDesc.SizeInBytes                      = sizeof(stream);
+        streamDesc.pPipelineStateSubobjectStream    = const_cast<TStream*>(&stream);
+    }
+    return device->CreatePipelineState(&streamDesc, IID_PPV_ARGS(outPipelineState.ReleaseAndGetAddressOf()));
+}
+
+#endif // /LLGL_D3D12_ENABLE_MESH_SHADERS || LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+#if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+// Pipeline state stream for mesh PSOs; subobjects for the vertex processing stages are omitted.
+struct D3D12MeshPipelineStateStream
+{
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_ROOT_SIGNATURE,        ID3D12RootSignature*            > rootSignature;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_AS,                    D3D12_SHADER_BYTECODE           > AS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_MS,                    D3D12_SHADER_BYTECODE           > MS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PS,                    D3D12_SHADER_BYTECODE           > PS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_BLEND,                 D3D12_BLEND_DESC                > blendState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_MASK,           UINT                            > sampleMask;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RASTERIZER,            D3D12_RASTERIZER_DESC           > rasterizerState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL,         D3D12_DEPTH_STENCIL_DESC        > depthStencilState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PRIMITIVE_TOPOLOGY,    D3D12_PRIMITIVE_TOPOLOGY_TYPE   > primitiveTopologyType;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RENDER_TARGET_FORMATS, D3D12_RT_FORMAT_ARRAY           > rtvFormats;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL_FORMAT,  DXGI_FORMAT                     > dsvFormat;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_DESC,           DXGI_SAMPLE_DESC                > sampleDesc;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_CACHED_PSO,            D3D12_CACHED_PIPELINE_STATE     > cachedPSO;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VIEW_INSTANCING,       D3D12_VIEW_INSTANCING_DESC      > viewInstancing;
+};
+
+ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativeMeshPSOWithDesc(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    const D3D12_SHADER_BYTECODE&                amplificationShader,
+    const D3D12_SHADER_BYTECODE&                meshShader,
+    const char*                                 debugName,
+    D3D12PipelineCache*                         pipelineCache)
+{
+    /* Pipeline state streams require ID3D12Device2 */
+    ComPtr<ID3D12Device2> device2;
+    HRESULT hr = device->QueryInterface(IID_PPV_ARGS(device2.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 mesh pipeline state [%s]: ID3D12Device2 not supported\n", GetOptionalDebugName(debugName));
+        return nullptr;
+    }
+
+    /* Convert graphics pipeline state descriptor into mesh pipeline state stream */
+    D3D12MeshPipelineStateStream stream;
+    {
+        stream.rootSignature.value          = desc.pRootSignature;
+        stream.AS.value                     = amplificationShader;
+        stream.MS.value                     = meshShader;
+        stream.PS.value                     = desc.PS;
+        stream.blendState.value             = desc.BlendState;
+        stream.sampleMask.value             = desc.SampleMask;
+        stream.rasterizerState.value        = desc.RasterizerState;
+        stream.depthStencilState.value      = desc.DepthStencilState;
+        stream.primitiveTopologyType.value  = desc.PrimitiveTopologyType;
+        stream.rtvFormats.value.NumRenderTargets = desc.NumRenderTargets;
+        for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+            stream.rtvFormats.value.RTFormats[i] = desc.RTVFormats[i];
+        stream.dsvFormat.value              = desc.DSVFormat;
+        stream.sampleDesc.value             = desc.SampleDesc;
+        if (pipelineCache != nullptr)
+            stream.cachedPSO.value          = pipelineCache->GetCachedPSO();
+        stream.viewInstancing.value.ViewInstanceCount       = numViewInstances_;
+        stream.viewInstancing.value.pViewInstanceLocations  = (numViewInstances_ > 0 ? viewInstanceLocations_ : nullptr);
+    }
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    hr = DXCreatePipelineStateFromStream(device2.Get(), stream, pipelineState);
+    if (FAILED(hr) && stream.cachedPSO.value.pCachedBlob != nullptr)
+    {
+        /* Cached PSO was rejected, e.g. after a driver update, so discard it and create PSO from scratch */
+        stream.cachedPSO.value = {};
+        pipelineCache->Invalidate();
+        hr = DXCreatePipelineStateFromStream(device2.Get(), stream, pipelineState);
+    }
+    if (FAILED(hr))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 mesh pipeline state [%s] (HRESULT = %s)\n", GetOptionalDebugName(debugName), DXErrorToStrOrHex(hr));
+        return nullptr;
+    }
+    return pipelineState;
+}
+
+#endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+#if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+// Pipeline state stream for view-instanced PSOs with all subobjects of D3D12_GRAPHICS_PIPELINE_STATE_DESC.
+struct D3D12ViewInstancedPipelineStateStream
+{
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_ROOT_SIGNATURE,        ID3D12RootSignature*                > rootSignature;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VS,                    D3D12_SHADER_BYTECODE               > VS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_HS,                    D3D12_SHADER_BYTECODE               > HS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DS,                    D3D12_SHADER_BYTECODE               > DS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_GS,                    D3D12_SHADER_BYTECODE               > GS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PS,                    D3D12_SHADER_BYTECODE               > PS;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_STREAM_OUTPUT,         D3D12_STREAM_OUTPUT_DESC            > streamOutput;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_BLEND,                 D3D12_BLEND_DESC                    > blendState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_MASK,           UINT                                > sampleMask;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RASTERIZER,            D3D12_RASTERIZER_DESC               > rasterizerState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL,         D3D12_DEPTH_STENCIL_DESC            > depthStencilState;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_INPUT_LAYOUT,          D3D12_INPUT_LAYOUT_DESC             > inputLayout;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_IB_STRIP_CUT_VALUE,    D3D12_INDEX_BUFFER_STRIP_CUT_VALUE  > ibStripCutValue;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_PRIMITIVE_TOPOLOGY,    D3D12_PRIMITIVE_TOPOLOGY_TYPE       > primitiveTopologyType;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_RENDER_TARGET_FORMATS, D3D12_RT_FORMAT_ARRAY               > rtvFormats;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_DEPTH_STENCIL_FORMAT,  DXGI_FORMAT                         > dsvFormat;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_SAMPLE_DESC,           DXGI_SAMPLE_DESC                    > sampleDesc;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_CACHED_PSO,            D3D12_CACHED_PIPELINE_STATE         > cachedPSO;
+    D3D12PipelineStateSubobject< D3D12_PIPELINE_STATE_SUBOBJECT_TYPE_VIEW_INSTANCING,       D3D12_VIEW_INSTANCING_DESC          > viewInstancing;
+};
+
+ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::CreateNativeViewInstancedPSOWithDesc(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    const char*                                 debugName,
+    D3D12PipelineCache*                         pipelineCache)
+{
+    /* Pipeline state streams require ID3D12Device2 */
+    ComPtr<ID3D12Device2> device2;
+    HRESULT hr = device->QueryInterface(IID_PPV_ARGS(device2.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 view-instanced pipeline state [%s]: ID3D12Device2 not supported\n", GetOptionalDebugName(debugName));
+        return nullptr;
+    }
+
+    /* Convert graphics pipeline state descriptor into pipeline state stream */
+    D3D12ViewInstancedPipelineStateStream stream;
+    {
+        stream.rootSignature.value          = desc.pRootSignature;
+        stream.VS.value                     = desc.VS;
+        stream.HS.value                     = desc.HS;
+        stream.DS.value                     = desc.DS;
+        stream.GS.value                     = desc.GS;
+        stream.PS.value                     = desc.PS;
+        stream.streamOutput.value           = desc.StreamOutput;
+        stream.blendState.value             = desc.BlendState;
+        stream.sampleMask.value             = desc.SampleMask;
+        stream.rasterizerState.value        = desc.RasterizerState;
+        stream.depthStencilState.value      = desc.DepthStencilState;
+        stream.inputLayout.value            = desc.InputLayout;
+        stream.ibStripCutValue.value        = desc.IBStripCutValue;
+        stream.primitiveTopologyType.value  = desc.PrimitiveTopologyType;
+        stream.rtvFormats.value.NumRenderTargets = desc.NumRenderTargets;
+        for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+            stream.rtvFormats.value.RTFormats[i] = desc.RTVFormats[i];
+        stream.dsvFormat.value              = desc.DSVFormat;
+        stream.sampleDesc.value             = desc.SampleDesc;
+        if (pipelineCache != nullptr)
+            stream.cachedPSO.value          = pipelineCache->GetCachedPSO();
+        stream.viewInstancing.value.ViewInstanceCount       = numViewInstances_;
+        stream.viewInstancing.value.pViewInstanceLocations  = viewInstanceLocations_;
+    }
+
+    ComPtr<ID3D12PipelineState> pipelineState;
+    hr = DXCreatePipelineStateFromStream(device2.Get(), stream, pipelineState);
+    if (FAILED(hr) && stream.cachedPSO.value.pCachedBlob != nullptr)
+    {
+        /* Cached PSO was rejected, e.g. after a driver update, so discard it and create PSO from scratch */
+        stream.cachedPSO.value = {};
+        pipelineCache->Invalidate();
+        hr = DXCreatePipelineStateFromStream(device2.Get(), stream, pipelineState);
+    }
+    if (FAILED(hr))
+    {
+        GetMutableReport().Errorf("Failed to create D3D12 view-instanced pipeline state [%s] (HRESULT = %s)\n", GetOptionalDebugName(debugName), DXErrorToStrOrHex(hr));
+        return nullptr;
+    }
+    return pipelineState;
+}
+
+void D3D12GraphicsPSO::BuildViewInstanceLocations(std::uint32_t viewMask)
+{
+    /* SV_ViewID is the compact view instance index, which selects the array layer of the respective bit in the view mask */
+    numViewInstances_ = 0;
+    for (UINT layer = 0; layer < D3D12_MAX_VIEW_INSTANCE_COUNT; ++layer)
+    {
+        if ((viewMask & (1u << layer)) != 0)
+        {
+            D3D12_VIEW_INSTANCE_LOCATION& location = viewInstanceLocations_[numViewInstances_++];
+            location.ViewportArrayIndex     = 0;
+            location.RenderTargetArrayIndex = layer;
+        }
+    }
+}
+
+#endif // /LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+ComPtr<ID3D12PipelineState> D3D12GraphicsPSO::LoadOrCreateNativePSOWithLibrary(
+    ID3D12Device*                               device,
+    const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+    const char*                                 debugName,
+    D3D12PipelineCache&                         pipelineCache)
+{
+    const std::uint64_t key = D3D12PipelineCache::GetStoreKey(desc, GetRootSignatureBlob());
+    ComPtr<ID3D12PipelineState> pipelineState = pipelineCache.LoadPipeline(key, desc);
+    if (!pipelineState)
+    {
+        pipelineState = CreateNativePSOWithDesc(device, desc, debugName);
+        if (pipelineState)
+            pipelineCache.StorePipeline(key, pipelineState.Get());
+    }
+    return pipelineState;
+}
+
 // Returns the size (in bytes) for the static-state buffer with the specified number of viewports and scissor rectangles
 static std::size_t GetStaticStateBufferSize(std::size_t numViewports, std::size_t numScissors)
 {
@@ -10,6 +10,7 @@
 
 
 #include "D3D12PipelineState.h"
+#include "../D3D12Types.h"
 #include <LLGL/Container/DynamicArray.h>
 
 
@@ -19,6 +20,7 @@ namespace LLGL
 
 class ByteBufferIterator;
 class PipelineCache;
+class PipelineCacheStore;
 class D3D12Device;
 class D3D12RenderPass;
 class D3D12PipelineLayout;
@@ -36,8 +38,10 @@ class D3D12GraphicsPSO final : public D3D12PipelineState
             D3D12PipelineLayout&                defaultPipelineLayout,
             const GraphicsPipelineDescriptor&   desc,
             const D3D12RenderPass*              defaultRenderPass,
-            PipelineCache*                      pipelineCache           = nullptr
+            PipelineCache*                      pipelineCache           = nullptr,
+            PipelineCacheStore*                 pipelineCacheStore      = nullptr
         );
+        ~D3D12GraphicsPSO();
 
         // Binds this graphics PSO to the specified command context.
         void Bind(D3D12CommandContext& commandContext) override;
@@ -58,10 +62,63 @@ class D3D12GraphicsPSO final : public D3D12PipelineState
             const D3D12PipelineLayout&          pipelineLayout,
             const D3D12RenderPass*              renderPass,
             const GraphicsPipelineDescriptor&   desc,
-            D3D12PipelineCache*                 pipelineCache   = nullptr
+            D3D12PipelineCache*                 pipelineCache       = nullptr,
+            PipelineCacheStore*                 pipelineCacheStore  = nullptr
         );
 
-        ComPtr<ID3D12PipelineState> CreateNativePSOWithDesc(ID3D12Device* device, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const char* debugName);
+        // Creates the native PSOs from the final descriptor and updates the PSO cache. This may run on a worker thread.
+        void CreateNativePSOAndUpdateCaches(
+            ID3D12Device*                       device,
+            D3D12_GRAPHICS_PIPELINE_STATE_DESC  stateDesc,
+            bool                                needsSecondaryPSO,
+            const char*                         debugName,
+            D3D12PipelineCache*                 pipelineCache,
+            PipelineCacheStore*                 pipelineCacheStore
+        );
+
+        ComPtr<ID3D12PipelineState> CreateNativePSOWithDesc(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            const char*                                 debugName,
+            D3D12PipelineCache*                         pipelineCache   = nullptr
+        );
+
+        #if LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        // Creates a mesh PSO via a pipeline state stream, since D3D12_GRAPHICS_PIPELINE_STATE_DESC cannot hold amplification and mesh shaders.
+        ComPtr<ID3D12PipelineState> CreateNativeMeshPSOWithDesc(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            const D3D12_SHADER_BYTECODE&                amplificationShader,
+            const D3D12_SHADER_BYTECODE&                meshShader,
+            const char*                                 debugName,
+            D3D12PipelineCache*                         pipelineCache   = nullptr
+        );
+
+        #endif // /LLGL_D3D12_ENABLE_MESH_SHADERS
+
+        #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+        // Creates a view-instanced PSO via a pipeline state stream, since D3D12_GRAPHICS_PIPELINE_STATE_DESC cannot hold view instance locations.
+        ComPtr<ID3D12PipelineState> CreateNativeViewInstancedPSOWithDesc(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            const char*                                 debugName,
+            D3D12PipelineCache*                         pipelineCache   = nullptr
+        );
+
+        // Converts the specified multiview mask into view instance locations. Each view instance renders into the array layer of its bit in the mask.
+        void BuildViewInstanceLocations(std::uint32_t viewMask);
+
+        #endif // /LLGL_D3D12_ENABLE_VIEW_INSTANCING
+
+        // Loads the PSO from the pipeline library of the specified cache or creates and stores it if the library has no such entry.
+        ComPtr<ID3D12PipelineState> LoadOrCreateNativePSOWithLibrary(
+            ID3D12Device*                               device,
+            const D3D12_GRAPHICS_PIPELINE_STATE_DESC&   desc,
+            const char*                                 debugName,
+            D3D12PipelineCache&                         pipelineCache
+        );
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
         void BuildStaticViewports(std::size_t numViewports, const Viewport* viewports, ByteBufferIterator& byteBufferIter);
@@ -91,6 +148,11 @@ class D3D12GraphicsPSO final : public D3D12PipelineState
         UINT                        numStaticViewports_ = 0;
         UINT                        numStaticScissors_  = 0;
 
+        #if LLGL_D3D12_ENABLE_VIEW_INSTANCING
+        D3D12_VIEW_INSTANCE_LOCATION viewInstanceLocations_[D3D12_MAX_VIEW_INSTANCE_COUNT] = {};
+        UINT                        numViewInstances_   = 0; // Zero if view instancing is disabled
+        #endif
+
 };
 
 
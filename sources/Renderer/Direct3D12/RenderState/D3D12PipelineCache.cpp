@@ -6,6 +6,11 @@
  */
 
 #include "D3D12PipelineCache.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/HashUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <cwchar>
 
 
 namespace LLGL
@@ -17,8 +22,44 @@ D3D12PipelineCache::D3D12PipelineCache(const Blob& initialBlob) :
 {
 }
 
+D3D12PipelineCache::D3D12PipelineCache(ID3D12Device* device, const Blob& initialBlob) :
+    D3D12PipelineCache { initialBlob }
+{
+    ComPtr<ID3D12Device1> device1;
+    if (device == nullptr || FAILED(device->QueryInterface(IID_PPV_ARGS(device1.GetAddressOf()))))
+        return;
+
+    /* Create pipeline library from initial blob; the library refers to this memory, so it's owned by the cache */
+    HRESULT hr = E_FAIL;
+    if (initialBlob_)
+        hr = device1->CreatePipelineLibrary(initialBlob_.GetData(), initialBlob_.GetSize(), IID_PPV_ARGS(pipelineLibrary_.ReleaseAndGetAddressOf()));
+
+    if (FAILED(hr))
+    {
+        /* Start with an empty library if there is no initial blob or the driver rejected it, e.g. after a driver update */
+        initialBlob_ = Blob{};
+        hr = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(pipelineLibrary_.ReleaseAndGetAddressOf()));
+        if (FAILED(hr))
+            pipelineLibrary_.Reset();
+    }
+}
+
 Blob D3D12PipelineCache::GetBlob() const
 {
+    /* Serialize the entire pipeline library with all of its PSOs */
+    if (pipelineLibrary_)
+    {
+        std::lock_guard<std::mutex> guard{ pipelineLibraryMutex_ };
+        const SIZE_T dataSize = pipelineLibrary_->GetSerializedSize();
+        if (dataSize == 0)
+            return Blob{};
+
+        DynamicByteArray data{ static_cast<std::size_t>(dataSize), UninitializeTag{} };
+        HRESULT hr = pipelineLibrary_->Serialize(data.get(), dataSize);
+        DXThrowIfFailed(hr, "failed to serialize ID3D12PipelineLibrary");
+        return Blob::CreateStrongRef(std::move(data));
+    }
+
     /* Prefer native blob in case it has been updated after an initial blob was provided */
     if (nativeBlob_)
         return Blob::CreateCopy(nativeBlob_->GetBufferPointer(), nativeBlob_->GetBufferSize());
@@ -45,6 +86,154 @@ D3D12_CACHED_PIPELINE_STATE D3D12PipelineCache::GetCachedPSO() const
     return cachedState;
 }
 
+void D3D12PipelineCache::Invalidate()
+{
+    initialBlob_ = Blob{};
+    nativeBlob_.Reset();
+}
+
+// Maximum length of PSO names in the pipeline library: "LLGL.PSO." + 16 hex digits + null terminator.
+static constexpr std::size_t g_maxPipelineNameLength = 32;
+
+static void GetPipelineName(wchar_t (&outName)[g_maxPipelineNameLength], std::uint64_t key)
+{
+    std::swprintf(outName, g_maxPipelineNameLength, L"LLGL.PSO.%016llx", static_cast<unsigned long long>(key));
+}
+
+ComPtr<ID3D12PipelineState> D3D12PipelineCache::LoadPipeline(std::uint64_t key, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc)
+{
+    ComPtr<ID3D12PipelineState> pipelineState;
+    if (pipelineLibrary_)
+    {
+        wchar_t name[g_maxPipelineNameLength];
+        GetPipelineName(name, key);
+
+        /* Returns E_INVALIDARG if there is no such entry or the descriptor does not match the stored PSO */
+        std::lock_guard<std::mutex> guard{ pipelineLibraryMutex_ };
+        if (FAILED(pipelineLibrary_->LoadGraphicsPipeline(name, &desc, IID_PPV_ARGS(pipelineState.GetAddressOf()))))
+            pipelineState.Reset();
+    }
+    return pipelineState;
+}
+
+ComPtr<ID3D12PipelineState> D3D12PipelineCache::LoadPipeline(std::uint64_t key, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc)
+{
+    ComPtr<ID3D12PipelineState> pipelineState;
+    if (pipelineLibrary_)
+    {
+        wchar_t name[g_maxPipelineNameLength];
+        GetPipelineName(name, key);
+
+        std::lock_guard<std::mutex> guard{ pipelineLibraryMutex_ };
+        if (FAILED(pipelineLibrary_->LoadComputePipeline(name, &desc, IID_PPV_ARGS(pipelineState.GetAddressOf()))))
+            pipelineState.Reset();
+    }
+    return pipelineState;
+}
+
+void D3D12PipelineCache::StorePipeline(std::uint64_t key, ID3D12PipelineState* pipelineState)
+{
+    if (pipelineLibrary_ && pipelineState != nullptr)
+    {
+        wchar_t name[g_maxPipelineNameLength];
+        GetPipelineName(name, key);
+
+        /* Ignore E_INVALIDARG for names that already exist, e.g. when the same PSO is created twice */
+        std::lock_guard<std::mutex> guard{ pipelineLibraryMutex_ };
+        pipelineLibrary_->StorePipeline(name, pipelineState);
+    }
+}
+
+static void HashShaderByteCode(std::uint64_t& seed, const D3D12_SHADER_BYTECODE& byteCode)
+{
+    HashValue(seed, byteCode.BytecodeLength);
+    if (byteCode.pShaderBytecode != nullptr)
+        HashBytes(seed, byteCode.pShaderBytecode, byteCode.BytecodeLength);
+}
+
+static void HashRootSignature(std::uint64_t& seed, ID3DBlob* rootSignatureBlob)
+{
+    if (rootSignatureBlob != nullptr)
+        HashBytes(seed, rootSignatureBlob->GetBufferPointer(), rootSignatureBlob->GetBufferSize());
+}
+
+// Hashes the input layout by value, since semantic names are pointers into the shader's reflection data.
+static void HashInputLayout(std::uint64_t& seed, const D3D12_INPUT_LAYOUT_DESC& desc)
+{
+    HashValue(seed, desc.NumElements);
+    for_range(i, desc.NumElements)
+    {
+        const D3D12_INPUT_ELEMENT_DESC& element = desc.pInputElementDescs[i];
+        HashString(seed, element.SemanticName);
+        HashValue(seed, element.SemanticIndex);
+        HashValue(seed, element.Format);
+        HashValue(seed, element.InputSlot);
+        HashValue(seed, element.AlignedByteOffset);
+        HashValue(seed, element.InputSlotClass);
+        HashValue(seed, element.InstanceDataStepRate);
+    }
+}
+
+static void HashStreamOutput(std::uint64_t& seed, const D3D12_STREAM_OUTPUT_DESC& desc)
+{
+    HashValue(seed, desc.NumEntries);
+    for_range(i, desc.NumEntries)
+    {
+        const D3D12_SO_DECLARATION_ENTRY& entry = desc.pSODeclaration[i];
+        HashValue(seed, entry.Stream);
+        HashString(seed, entry.SemanticName);
+        HashValue(seed, entry.SemanticIndex);
+        HashValue(seed, entry.StartComponent);
+        HashValue(seed, entry.ComponentCount);
+        HashValue(seed, entry.OutputSlot);
+    }
+    HashValue(seed, desc.NumStrides);
+    if (desc.pBufferStrides != nullptr)
+        HashBytes(seed, desc.pBufferStrides, sizeof(UINT) * desc.NumStrides);
+    HashValue(seed, desc.RasterizedStream);
+}
+
+std::uint64_t D3D12PipelineCache::GetStoreKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, ID3DBlob* rootSignatureBlob)
+{
+    std::uint64_t seed = g_hashSeed;
+
+    /* Hash all states that are passed by value; descriptors are zero-initialized, so padding bytes are deterministic */
+    HashValue(seed, desc.BlendState);
+    HashValue(seed, desc.SampleMask);
+    HashValue(seed, desc.RasterizerState);
+    HashValue(seed, desc.DepthStencilState);
+    HashValue(seed, desc.IBStripCutValue);
+    HashValue(seed, desc.PrimitiveTopologyType);
+    HashValue(seed, desc.NumRenderTargets);
+    HashValue(seed, desc.RTVFormats);
+    HashValue(seed, desc.DSVFormat);
+    HashValue(seed, desc.SampleDesc);
+    HashValue(seed, desc.NodeMask);
+    HashValue(seed, desc.Flags);
+
+    /* Hash all states that are passed by reference */
+    HashShaderByteCode(seed, desc.VS);
+    HashShaderByteCode(seed, desc.HS);
+    HashShaderByteCode(seed, desc.DS);
+    HashShaderByteCode(seed, desc.GS);
+    HashShaderByteCode(seed, desc.PS);
+    HashInputLayout(seed, desc.InputLayout);
+    HashStreamOutput(seed, desc.StreamOutput);
+    HashRootSignature(seed, rootSignatureBlob);
+
+    return seed;
+}
+
+std::uint64_t D3D12PipelineCache::GetStoreKey(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, ID3DBlob* rootSignatureBlob)
+{
+    std::uint64_t seed = g_hashSeed;
+    HashShaderByteCode(seed, desc.CS);
+    HashValue(seed, desc.NodeMask);
+    HashValue(seed, desc.Flags);
+    HashRootSignature(seed, rootSignatureBlob);
+    return seed;
+}
+
 
 } // /namespace LLGL
 
@@ -12,6 +12,8 @@
 #include <LLGL/PipelineCache.h>
 #include <d3d12.h>
 #include "../../DXCommon/ComPtr.h"
+#include <cstdint>
+#include <mutex>
 
 
 namespace LLGL
@@ -25,9 +27,16 @@ class D3D12PipelineCache final : public PipelineCache
 
         D3D12PipelineCache() = default;
 
-        // Initializes the pipeline cache with the specified initial blob.
+        // Initializes the pipeline cache with the specified initial blob for a single PSO.
         D3D12PipelineCache(const Blob& initialBlob);
 
+        /*
+        Initializes the pipeline cache with a pipeline library (ID3D12PipelineLibrary1) that can hold any number of PSOs.
+        The initial blob must be a serialized pipeline library; it is discarded if the driver rejects it.
+        Falls back to a single PSO blob if the device does not support pipeline libraries.
+        */
+        D3D12PipelineCache(ID3D12Device* device, const Blob& initialBlob);
+
         Blob GetBlob() const override;
 
     public:
@@ -51,10 +60,37 @@ class D3D12PipelineCache final : public PipelineCache
         // Returns the cached PSO blob.
         D3D12_CACHED_PIPELINE_STATE GetCachedPSO() const;
 
+        // Discards the initial and native blob, e.g. after the driver rejected the cached PSO.
+        void Invalidate();
+
+        // Returns true if this pipeline cache is backed by a pipeline library. Otherwise, it can only hold one PSO via GetCachedPSO().
+        inline bool HasPipelineLibrary() const
+        {
+            return (pipelineLibrary_.Get() != nullptr);
+        }
+
+        // Loads the PSO that was stored with the specified key (see GetStoreKey) from the pipeline library. Returns null if there is no such entry.
+        ComPtr<ID3D12PipelineState> LoadPipeline(std::uint64_t key, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc);
+        ComPtr<ID3D12PipelineState> LoadPipeline(std::uint64_t key, const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc);
+
+        // Stores the specified PSO with the specified key (see GetStoreKey) in the pipeline library. Existing entries are not replaced.
+        void StorePipeline(std::uint64_t key, ID3D12PipelineState* pipelineState);
+
+    public:
+
+        // Returns the key for the persistent pipeline cache store (see PipelineCacheStore) of the specified graphics PSO descriptor.
+        static std::uint64_t GetStoreKey(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, ID3DBlob* rootSignatureBlob);
+
+        // Returns the key for the persistent pipeline cache store (see PipelineCacheStore) of the specified compute PSO descriptor.
+        static std::uint64_t GetStoreKey(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, ID3DBlob* rootSignatureBlob);
+
     private:
 
-        Blob                initialBlob_;
-        ComPtr<ID3DBlob>    nativeBlob_;
+        Blob                            initialBlob_;
+        ComPtr<ID3DBlob>                nativeBlob_;
+
+        ComPtr<ID3D12PipelineLibrary1>  pipelineLibrary_;   // Library of all PSOs; refers to the memory of 'initialBlob_'.
+        mutable std::mutex              pipelineLibraryMutex_;
 
 };
 
@@ -10,8 +10,10 @@
 #include "../Texture/D3D12Sampler.h"
 #include "../D3DX12/d3dx12.h"
 #include "../D3D12ObjectUtils.h"
+#include "../D3D12Types.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../ResourceUtils.h"
+#include "../../PipelineStateUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
@@ -84,6 +86,12 @@ static D3D12_ROOT_SIGNATURE_FLAGS GetD3DRootSignatureFlags(long convolutedStageF
         signatureFlags |= D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS;
     if ((convolutedStageFlags & StageFlags::FragmentStage) == 0)
         signatureFlags |= D3D12_ROOT_SIGNATURE_FLAG_DENY_PIXEL_SHADER_ROOT_ACCESS;
+    #if LLGL_D3D12_ENABLE_MESH_SHADERS
+    if ((convolutedStageFlags & StageFlags::TaskStage) == 0)
+        signatureFlags |= D3D12_ROOT_SIGNATURE_FLAG_DENY_AMPLIFICATION_SHADER_ROOT_ACCESS;
+    if ((convolutedStageFlags & StageFlags::MeshStage) == 0)
+        signatureFlags |= D3D12_ROOT_SIGNATURE_FLAG_DENY_MESH_SHADER_ROOT_ACCESS;
+    #endif
 
     return signatureFlags;
 }
@@ -245,6 +253,9 @@ D3D12DescriptorHeapSetLayout D3D12PipelineLayout::GetDescriptorHeapSetLayout() c
  * ======= Private: =======
  */
 
+// Acceleration structures are bound as SRVs just like sampled buffers
+static constexpr long g_bufferSRVBindFlags = (BindFlags::Sampled | BindFlags::AccelerationStructure);
+
 void D3D12PipelineLayout::BuildRootSignature(
     D3D12RootSignature&             rootSignature,
     const PipelineLayoutDescriptor& desc)
@@ -254,28 +265,30 @@ void D3D12PipelineLayout::BuildRootSignature(
     /* Build root parameter table for each descriptor range type */
     descriptorHeapMap_.resize(expandedHeapBindings.size());
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_CBV,     expandedHeapBindings, ResourceType::Buffer,  BindFlags::ConstantBuffer, descriptorHeapLayout_.numBufferCBV );
-    BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     expandedHeapBindings, ResourceType::Buffer,  BindFlags::Sampled,        descriptorHeapLayout_.numBufferSRV );
+    BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     expandedHeapBindings, ResourceType::Buffer,  g_bufferSRVBindFlags,       descriptorHeapLayout_.numBufferSRV );
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     expandedHeapBindings, ResourceType::Texture, BindFlags::Sampled,        descriptorHeapLayout_.numTextureSRV);
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     expandedHeapBindings, ResourceType::Buffer,  BindFlags::Storage,        descriptorHeapLayout_.numBufferUAV );
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     expandedHeapBindings, ResourceType::Texture, BindFlags::Storage,        descriptorHeapLayout_.numTextureUAV);
     BuildHeapRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, expandedHeapBindings, ResourceType::Sampler, 0,                         descriptorHeapLayout_.numSamplers  );
 
+    /* Determine which individual bindings are passed as root descriptors within the remaining space of the root signature */
+    std::vector<D3D12_ROOT_PARAMETER_TYPE> rootParamTypes;
+    SelectRootDescriptors(rootParamTypes, desc, rootSignature.GetCost());
+
     /* Build root parameter for each descriptor range type */
     descriptorMap_.resize(desc.bindings.size());
-    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_CBV,     desc.bindings, ResourceType::Buffer,  BindFlags::ConstantBuffer, descriptorLayout_.numBufferCBV);
-    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc.bindings, ResourceType::Buffer,  BindFlags::Sampled,        descriptorLayout_.numBufferSRV);
-    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc.bindings, ResourceType::Texture, BindFlags::Sampled,        descriptorLayout_.numTextureSRV);
-    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc.bindings, ResourceType::Buffer,  BindFlags::Storage,        descriptorLayout_.numBufferUAV);
-    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc.bindings, ResourceType::Texture, BindFlags::Storage,        descriptorLayout_.numTextureUAV);
-    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, desc.bindings, ResourceType::Sampler, 0,                         descriptorLayout_.numSamplers);
-
-    /* Build root parameter for each standalone descriptor */
+    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_CBV,     desc.bindings, rootParamTypes, ResourceType::Buffer,  BindFlags::ConstantBuffer, descriptorLayout_.numBufferCBV);
+    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc.bindings, rootParamTypes, ResourceType::Buffer,  g_bufferSRVBindFlags,       descriptorLayout_.numBufferSRV);
+    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SRV,     desc.bindings, rootParamTypes, ResourceType::Texture, BindFlags::Sampled,        descriptorLayout_.numTextureSRV);
+    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc.bindings, rootParamTypes, ResourceType::Buffer,  BindFlags::Storage,        descriptorLayout_.numBufferUAV);
+    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_UAV,     desc.bindings, rootParamTypes, ResourceType::Texture, BindFlags::Storage,        descriptorLayout_.numTextureUAV);
+    BuildRootParameterTables(rootSignature, D3D12_DESCRIPTOR_RANGE_TYPE_SAMPLER, desc.bindings, rootParamTypes, ResourceType::Sampler, 0,                         descriptorLayout_.numSamplers);
+
+    /* Build root parameter for each standalone descriptor in the order of their update frequency */
     rootParameterMap_.resize(desc.bindings.size());
-    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_CBV, desc.bindings, ResourceType::Buffer, BindFlags::ConstantBuffer);
-
-    //TODO: re-enable until LLGL can translate restrictions on root parameters; see CanResourceHaveRootParameter()
-    //BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_SRV, desc.bindings, ResourceType::Buffer, BindFlags::Sampled);
-    //BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_UAV, desc.bindings, ResourceType::Buffer, BindFlags::Storage);
+    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_CBV, desc.bindings, rootParamTypes);
+    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_SRV, desc.bindings, rootParamTypes);
+    BuildRootParameters(rootSignature, D3D12_ROOT_PARAMETER_TYPE_UAV, desc.bindings, rootParamTypes);
 
     /* Build static samplers */
     BuildStaticSamplers(rootSignature, desc.staticSamplers, numStaticSamplers_);
@@ -293,6 +306,10 @@ static D3D12_RESOURCE_STATES GetD3D12BindingResourceState(const BindingDescripto
 {
     if (bindingDesc.stageFlags != 0)
     {
+        #if LLGL_D3D12_ENABLE_RAYTRACING
+        if ((bindingDesc.bindFlags & BindFlags::AccelerationStructure) != 0 && bindingDesc.type == ResourceType::Buffer)
+            return D3D12_RESOURCE_STATE_RAYTRACING_ACCELERATION_STRUCTURE;
+        #endif // /LLGL_D3D12_ENABLE_RAYTRACING
         if ((bindingDesc.bindFlags & BindFlags::ConstantBuffer) != 0 && bindingDesc.type == ResourceType::Buffer)
             return D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER;
         if ((bindingDesc.bindFlags & BindFlags::Storage) != 0)
@@ -391,27 +408,115 @@ void D3D12PipelineLayout::BuildHeapRootParameterTableEntry(
         descriptorHeapLayout_.GetDescriptorLocation(descRangeType, outLocation);
 }
 
-static bool CanResourceHaveRootParameter(const ResourceType resourceType, long bindFlags)
+// Returns the type of root descriptor the specified binding can be passed as, or D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE if it must be put into a descriptor table.
+static D3D12_ROOT_PARAMETER_TYPE GetRootDescriptorType(const BindingDescriptor& bindingDesc, long pipelineLayoutFlags)
+{
+    if (bindingDesc.type == ResourceType::Buffer)
+    {
+        if ((bindingDesc.bindFlags & BindFlags::ConstantBuffer) != 0)
+            return D3D12_ROOT_PARAMETER_TYPE_CBV;
+
+        /* Only raw or structured buffers can be used as root SRV and UAV, so only allow them if the client opted in */
+        if ((pipelineLayoutFlags & PipelineLayoutFlags::RootDescriptors) != 0)
+        {
+            if ((bindingDesc.bindFlags & g_bufferSRVBindFlags) != 0)
+                return D3D12_ROOT_PARAMETER_TYPE_SRV;
+            if ((bindingDesc.bindFlags & BindFlags::Storage) != 0)
+                return D3D12_ROOT_PARAMETER_TYPE_UAV;
+        }
+    }
+    return D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+}
+
+// Returns the minimal cost (in DWORDs) of the root constants for the specified uniforms.
+static UINT GetUniformsCost(const ArrayView<UniformDescriptor>& uniforms)
+{
+    UINT cost = 0;
+    for (const UniformDescriptor& uniform : uniforms)
+        cost += std::max(1u, GetAlignedSize(GetUniformTypeSize(uniform.type, uniform.arraySize), 4u) / 4u);
+    return cost;
+}
+
+void D3D12PipelineLayout::SelectRootDescriptors(
+    std::vector<D3D12_ROOT_PARAMETER_TYPE>& outRootParamTypes,
+    const PipelineLayoutDescriptor&         desc,
+    UINT                                    heapRootParamsCost)
 {
-    /* Only raw or structured buffers can be used as SRV and UAV, so only allow CBV until LLGL can translate those restrictions */
-    return (resourceType == ResourceType::Buffer && (bindFlags & BindFlags::ConstantBuffer) != 0);
+    outRootParamTypes.resize(desc.bindings.size());
+
+    /* Find all candidate bindings and check which descriptor tables are required regardless of root descriptors */
+    bool hasTableResourceViews  = false;
+    bool hasTableSamplers       = false;
+    UINT numCandidates          = 0;
+
+    for_range(i, desc.bindings.size())
+    {
+        const BindingDescriptor& binding = desc.bindings[i];
+        outRootParamTypes[i] = GetRootDescriptorType(binding, desc.flags);
+        if (outRootParamTypes[i] != D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
+            ++numCandidates;
+        else if (binding.type == ResourceType::Sampler)
+            hasTableSamplers = true;
+        else
+            hasTableResourceViews = true;
+    }
+
+    if (numCandidates == 0)
+        return;
+
+    /* Reserve space for heap descriptor tables, dynamic descriptor tables, and root constants of uniforms */
+    UINT reservedCost = heapRootParamsCost + GetUniformsCost(desc.uniforms);
+    if (hasTableSamplers)
+        reservedCost += D3D12RootParameter::GetCost(D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE);
+
+    const UINT rootDescriptorCost = D3D12RootParameter::GetCost(D3D12_ROOT_PARAMETER_TYPE_CBV);
+    if (hasTableResourceViews || reservedCost + numCandidates * rootDescriptorCost > D3D12_MAX_ROOT_COST)
+    {
+        /* Reserve space for a descriptor table where all remaining resource views will be spilled into */
+        reservedCost += D3D12RootParameter::GetCost(D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE);
+    }
+
+    UINT remainingCost = (reservedCost < D3D12_MAX_ROOT_COST ? D3D12_MAX_ROOT_COST - reservedCost : 0);
+
+    /* Allocate root descriptors in the order of their update frequency: CBVs first, then SRVs, then UAVs */
+    const D3D12_ROOT_PARAMETER_TYPE rootParamTypeOrder[] =
+    {
+        D3D12_ROOT_PARAMETER_TYPE_CBV,
+        D3D12_ROOT_PARAMETER_TYPE_SRV,
+        D3D12_ROOT_PARAMETER_TYPE_UAV,
+    };
+
+    for (D3D12_ROOT_PARAMETER_TYPE rootParamType : rootParamTypeOrder)
+    {
+        for (D3D12_ROOT_PARAMETER_TYPE& type : outRootParamTypes)
+        {
+            if (type == rootParamType)
+            {
+                if (remainingCost >= rootDescriptorCost)
+                    remainingCost -= rootDescriptorCost;
+                else
+                    type = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+            }
+        }
+    }
 }
 
 void D3D12PipelineLayout::BuildRootParameterTables(
-    D3D12RootSignature&                 rootSignature,
-    D3D12_DESCRIPTOR_RANGE_TYPE         descRangeType,
-    const ArrayView<BindingDescriptor>& bindingDescs,
-    const ResourceType                  resourceType,
-    long                                bindFlags,
-    UINT&                               outCounter)
+    D3D12RootSignature&                             rootSignature,
+    D3D12_DESCRIPTOR_RANGE_TYPE                     descRangeType,
+    const ArrayView<BindingDescriptor>&             bindingDescs,
+    const std::vector<D3D12_ROOT_PARAMETER_TYPE>&   rootParamTypes,
+    const ResourceType                              resourceType,
+    long                                            bindFlags,
+    UINT&                                           outCounter)
 {
     for_range(i, bindingDescs.size())
     {
         const BindingDescriptor& binding = bindingDescs[i];
         if (IsFilteredBinding(binding, resourceType, bindFlags))
         {
-            /* If resource binding cannot have its own root parameter, it must be put into a descriptor table */
-            if (!CanResourceHaveRootParameter(resourceType, bindFlags))
+            /* If resource binding does not have its own root parameter, it must be put into a descriptor table */
+            if (rootParamTypes[i] == D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE)
             {
                 BuildRootParameterTableEntry(
                     /*rootSignature:*/  rootSignature,
@@ -480,27 +585,22 @@ void D3D12PipelineLayout::BuildRootParameterTableEntry(
 }
 
 void D3D12PipelineLayout::BuildRootParameters(
-    D3D12RootSignature&                 rootSignature,
-    D3D12_ROOT_PARAMETER_TYPE           rootParamType,
-    const ArrayView<BindingDescriptor>& bindingDescs,
-    const ResourceType                  resourceType,
-    long                                bindFlags)
+    D3D12RootSignature&                             rootSignature,
+    D3D12_ROOT_PARAMETER_TYPE                       rootParamType,
+    const ArrayView<BindingDescriptor>&             bindingDescs,
+    const std::vector<D3D12_ROOT_PARAMETER_TYPE>&   rootParamTypes)
 {
     for_range(i, bindingDescs.size())
     {
-        const BindingDescriptor& binding = bindingDescs[i];
-        if (IsFilteredBinding(binding, resourceType, bindFlags))
+        if (rootParamTypes[i] == rootParamType)
         {
-            /* If resource binding cannot have its own root parameter, it must be put into a descriptor table */
-            if (CanResourceHaveRootParameter(resourceType, bindFlags))
-            {
-                BuildRootParameter(
-                    /*rootSignature:*/  rootSignature,
-                    /*rootParamType:*/  rootParamType,
-                    /*bindingDesc:*/    binding,
-                    /*outLocation:*/    rootParameterMap_[i]
-                );
-            }
+            BuildRootParameter(
+                /*rootSignature:*/      rootSignature,
+                /*rootParamType:*/      rootParamType,
+                /*bindingDesc:*/        bindingDescs[i],
+                /*outLocation:*/        rootParameterMap_[i],
+                /*outHeapLocation:*/    descriptorMap_[i]
+            );
         }
     }
 }
@@ -509,7 +609,8 @@ void D3D12PipelineLayout::BuildRootParameter(
     D3D12RootSignature&             rootSignature,
     D3D12_ROOT_PARAMETER_TYPE       rootParamType,
     const BindingDescriptor&        bindingDesc,
-    D3D12DescriptorLocation&        outLocation)
+    D3D12DescriptorLocation&        outLocation,
+    D3D12DescriptorHeapLocation&    outHeapLocation)
 {
     /* Determine shader visibility for new binding */
     const D3D12_SHADER_VISIBILITY visibility = D3D12RootParameter::FindSuitableVisibility(bindingDesc.stageFlags);
@@ -523,6 +624,12 @@ void D3D12PipelineLayout::BuildRootParameter(
     outLocation.type    = rootParamType;
     outLocation.index   = rootParamIndex;
     outLocation.state   = GetD3D12BindingResourceState(bindingDesc);
+
+    /* Root UAVs still need a UAV barrier slot; all other root descriptors don't have any slot */
+    if (rootParamType == D3D12_ROOT_PARAMETER_TYPE_UAV && MatchBindingWithBarrierFlags(bindingDesc, GetBarrierFlags()))
+        outHeapLocation.uavBarrierIndex = numUAVBarriers_++;
+    else
+        outHeapLocation.uavBarrierIndex = ~0u;
 }
 
 void D3D12PipelineLayout::BuildStaticSamplers(
@@ -16,6 +16,7 @@
 #include "../Shader/D3D12RootSignature.h"
 #include "../../DXCommon/ComPtr.h"
 #include <d3d12.h>
+#include <vector>
 #include <memory>
 #include <map>
 
@@ -236,13 +237,21 @@ class D3D12PipelineLayout final : public PipelineLayout
             D3D12DescriptorHeapLocation&    outLocation
         );
 
+        // Determines the root parameter type for each individual binding, i.e. either a root descriptor or a descriptor table.
+        void SelectRootDescriptors(
+            std::vector<D3D12_ROOT_PARAMETER_TYPE>& outRootParamTypes,
+            const PipelineLayoutDescriptor&         desc,
+            UINT                                    heapRootParamsCost
+        );
+
         void BuildRootParameterTables(
-            D3D12RootSignature&                 rootSignature,
-            D3D12_DESCRIPTOR_RANGE_TYPE         descRangeType,
-            const ArrayView<BindingDescriptor>& bindingDescs,
-            const ResourceType                  resourceType,
-            long                                bindFlags,
-            UINT&                               outCounter
+            D3D12RootSignature&                             rootSignature,
+            D3D12_DESCRIPTOR_RANGE_TYPE                     descRangeType,
+            const ArrayView<BindingDescriptor>&             bindingDescs,
+            const std::vector<D3D12_ROOT_PARAMETER_TYPE>&   rootParamTypes,
+            const ResourceType                              resourceType,
+            long                                            bindFlags,
+            UINT&                                           outCounter
         );
 
         void BuildRootParameterTableEntry(
@@ -254,18 +263,18 @@ class D3D12PipelineLayout final : public PipelineLayout
         );
 
         void BuildRootParameters(
-            D3D12RootSignature&                 rootSignature,
-            D3D12_ROOT_PARAMETER_TYPE           rootParamType,
-            const ArrayView<BindingDescriptor>& bindingDescs,
-            const ResourceType                  resourceType,
-            long                                bindFlags
+            D3D12RootSignature&                             rootSignature,
+            D3D12_ROOT_PARAMETER_TYPE                       rootParamType,
+            const ArrayView<BindingDescriptor>&             bindingDescs,
+            const std::vector<D3D12_ROOT_PARAMETER_TYPE>&   rootParamTypes
         );
 
         void BuildRootParameter(
             D3D12RootSignature&             rootSignature,
             D3D12_ROOT_PARAMETER_TYPE       rootParamType,
             const BindingDescriptor&        bindingDesc,
-            D3D12DescriptorLocation&        outLocation
+            D3D12DescriptorLocation&        outLocation,
+            D3D12DescriptorHeapLocation&    outHeapLocation
         );
 
         void BuildStaticSamplers(
@@ -25,9 +25,11 @@ D3D12PipelineState::D3D12PipelineState(
     bool                        isGraphicsPSO,
     const PipelineLayout*       pipelineLayout,
     const ArrayView<Shader*>&   shaders,
-    D3D12PipelineLayout&        defaultPipelineLayout)
+    D3D12PipelineLayout&        defaultPipelineLayout,
+    bool                        isRayTracingPSO)
 :
-    isGraphicsPSO_ { isGraphicsPSO }
+    isGraphicsPSO_   { isGraphicsPSO   },
+    isRayTracingPSO_ { isRayTracingPSO }
 {
     if (pipelineLayout != nullptr)
     {
@@ -48,21 +50,28 @@ D3D12PipelineState::D3D12PipelineState(
 
 void D3D12PipelineState::SetDebugName(const char* name)
 {
+    WaitForCompilation();
     D3D12SetObjectName(native_.Get(), name);
 }
 
 const Report* D3D12PipelineState::GetReport() const
 {
+    WaitForCompilation();
     return (*report_.GetText() != '\0' || report_.HasErrors() ? &report_ : nullptr);
 }
 
+bool D3D12PipelineState::IsReady() const
+{
+    return compileJob_.IsDone();
+}
+
 void D3D12PipelineState::SetNativeAndUpdateCache(ComPtr<ID3D12PipelineState>&& native, D3D12PipelineCache* pipelineCache)
 {
     /* Store native pipeline state */
     native_ = std::move(native);
 
     /* Get cached PSO if specified but not initialized */
-    if (pipelineCache != nullptr && !pipelineCache->HasInitialBlob())
+    if (native_ && pipelineCache != nullptr && !pipelineCache->HasInitialBlob())
     {
         ComPtr<ID3DBlob> cachedBlob;
         HRESULT hr = native_->GetCachedBlob(cachedBlob.GetAddressOf());
@@ -71,6 +80,24 @@ void D3D12PipelineState::SetNativeAndUpdateCache(ComPtr<ID3D12PipelineState>&& n
     }
 }
 
+void D3D12PipelineState::RunCompilation(bool isAsync, const std::function<void()>& task)
+{
+    if (isAsync)
+        compileJob_.Start(task);
+    else
+        task();
+}
+
+void D3D12PipelineState::WaitForCompilation() const
+{
+    compileJob_.Wait();
+}
+
+ID3DBlob* D3D12PipelineState::GetRootSignatureBlob() const
+{
+    return (pipelineLayout_ != nullptr ? pipelineLayout_->GetSerializedBlob() : nullptr);
+}
+
 void D3D12PipelineState::ResetReport(std::string&& text, bool hasErrors)
 {
     ResetReportWithNewline(report_, std::forward<std::string&&>(text), hasErrors);
@@ -15,8 +15,10 @@
 #include <LLGL/Report.h>
 #include "D3D12PipelineLayout.h"
 #include "../../DXCommon/ComPtr.h"
+#include "../../../Core/Threading.h"
 #include <d3d12.h>
 #include <memory>
+#include <functional>
 
 
 namespace LLGL
@@ -31,8 +33,9 @@ class D3D12PipelineState : public PipelineState
 
     public:
 
-        void SetDebugName(const char* name) override final;
+        void SetDebugName(const char* name) override;
         const Report* GetReport() const override final;
+        bool IsReady() const override final;
 
     public:
 
@@ -45,6 +48,12 @@ class D3D12PipelineState : public PipelineState
             return isGraphicsPSO_;
         }
 
+        // Returns true if this is a ray tracing PSO. Ray tracing PSOs are bound to the compute root signature.
+        inline bool IsRayTracingPSO() const
+        {
+            return isRayTracingPSO_;
+        }
+
         // Returns the pipeline layout this PSO was created with.
         inline const D3D12PipelineLayout* GetPipelineLayout() const
         {
@@ -57,18 +66,31 @@ class D3D12PipelineState : public PipelineState
             return rootConstantMap_;
         }
 
+        // Returns the root signature this PSO was linked to.
+        inline ID3D12RootSignature* GetRootSignature() const
+        {
+            return rootSignature_.Get();
+        }
+
     protected:
 
         D3D12PipelineState(
             bool                        isGraphicsPSO,
             const PipelineLayout*       pipelineLayout,
             const ArrayView<Shader*>&   shaders,
-            D3D12PipelineLayout&        defaultPipelineLayout
+            D3D12PipelineLayout&        defaultPipelineLayout,
+            bool                        isRayTracingPSO         = false
         );
 
         // Stores the native PSO and updates an optional PSO cache.
         void SetNativeAndUpdateCache(ComPtr<ID3D12PipelineState>&& native, D3D12PipelineCache* pipelineCache);
 
+        // Runs the specified compilation task on a worker thread if 'isAsync' is true, or on the calling thread otherwise.
+        void RunCompilation(bool isAsync, const std::function<void()>& task);
+
+        // Blocks until an asynchronous compilation has finished. Must be called before the native PSO is accessed.
+        void WaitForCompilation() const;
+
         // Writes the report with the specified message and error bit.
         void ResetReport(std::string&& text, bool hasErrors = false);
 
@@ -78,11 +100,8 @@ class D3D12PipelineState : public PipelineState
             return native_.Get();
         }
 
-        // Returns the root signature this PSO was linked to.
-        inline ID3D12RootSignature* GetRootSignature() const
-        {
-            return rootSignature_.Get();
-        }
+        // Returns the serialized blob of the pipeline layout this PSO was created with or null if the default layout is used.
+        ID3DBlob* GetRootSignatureBlob() const;
 
         // Returns the mutable report object.
         inline Report& GetMutableReport()
@@ -92,12 +111,14 @@ class D3D12PipelineState : public PipelineState
 
     private:
 
-        const bool                              isGraphicsPSO_  = false;
+        const bool                              isGraphicsPSO_   = false;
+        const bool                              isRayTracingPSO_ = false;
         ComPtr<ID3D12PipelineState>             native_;
         ComPtr<ID3D12RootSignature>             rootSignature_;
         const D3D12PipelineLayout*              pipelineLayout_ = nullptr;
         std::vector<D3D12RootConstantLocation>  rootConstantMap_;
         Report                                  report_;
+        mutable AsyncJob                        compileJob_;    // Must be the last member, so it waits for the compilation before the other members are destroyed.
 
 };
 
@@ -124,7 +124,13 @@ void D3D12QueryHeap::Begin(ID3D12GraphicsCommandList* commandList, UINT query)
 void D3D12QueryHeap::End(ID3D12GraphicsCommandList* commandList, UINT query)
 {
     /* End query section or call "EndQuery" on another timestamp to get elapsed time range */
-    if (nativeType_ == D3D12_QUERY_TYPE_TIMESTAMP)
+    if (GetType() == QueryType::Timestamp)
+    {
+        /* Resolve single timestamp right away, since there is no BeginQuery that marks the dirty range and QueryResult must not stall on it */
+        commandList->EndQuery(GetNative(), GetNativeType(), query);
+        ResolveData(commandList, query, 1);
+    }
+    else if (nativeType_ == D3D12_QUERY_TYPE_TIMESTAMP)
         commandList->EndQuery(GetNative(), GetNativeType(), query * queryPerType_ + 1);
     else
         commandList->EndQuery(GetNative(), GetNativeType(), query * queryPerType_);
@@ -0,0 +1,283 @@
+/*
+ * D3D12RayTracingPSO.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12RayTracingPSO.h"
+#include "D3D12PipelineLayout.h"
+#include "../D3D12ObjectUtils.h"
+#include "../Shader/D3D12Shader.h"
+#include "../Command/D3D12CommandContext.h"
+#include "../D3DX12/d3dx12.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../CheckedCast.h"
+#include "../../PipelineStateUtils.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/StringUtils.h"
+#include "../../../Core/Assertion.h"
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <string>
+#include <string.h>
+
+
+#if LLGL_D3D12_ENABLE_RAYTRACING
+
+namespace LLGL
+{
+
+
+// Size (in bytes) of each record in the shader binding table. Records have no local root arguments, so they only contain the shader identifier.
+static constexpr UINT64 g_sbtRecordSize = GetAlignedSize<UINT64>(D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES, D3D12_RAYTRACING_SHADER_RECORD_BYTE_ALIGNMENT);
+
+static UINT64 GetAlignedSBTSize(UINT64 size)
+{
+    return GetAlignedSize<UINT64>(size, D3D12_RAYTRACING_SHADER_TABLE_BYTE_ALIGNMENT);
+}
+
+D3D12RayTracingPSO::D3D12RayTracingPSO(
+    ID3D12Device*                       device,
+    D3D12PipelineLayout&                defaultPipelineLayout,
+    const RayTracingPipelineDescriptor& desc)
+:
+    D3D12PipelineState
+    {
+        /*isGraphicsPSO:*/      false,
+        desc.pipelineLayout,
+        GetShadersAsArray(desc),
+        defaultPipelineLayout,
+        /*isRayTracingPSO:*/    true
+    }
+{
+    if (desc.rayGenerationShader == nullptr)
+    {
+        ResetReport("cannot create D3D ray tracing PSO without ray-generation shader", true);
+        return;
+    }
+
+    /* State objects can only be created with the ID3D12Device5 interface */
+    ComPtr<ID3D12Device5> device5;
+    HRESULT hr = device->QueryInterface(IID_PPV_ARGS(device5.GetAddressOf()));
+    if (FAILED(hr))
+    {
+        ResetReport("cannot create D3D ray tracing PSO without ID3D12Device5 interface", true);
+        return;
+    }
+
+    CreateNativeStateObject(device5.Get(), desc);
+
+    if (stateObject_)
+    {
+        CreateShaderBindingTable(device, desc);
+        if (desc.debugName != nullptr)
+            SetDebugName(desc.debugName);
+    }
+}
+
+void D3D12RayTracingPSO::SetDebugName(const char* name)
+{
+    D3D12SetObjectName(stateObject_.Get(), name);
+    D3D12SetObjectNameSubscript(sbtBuffer_.Get(), name, ".SBT");
+}
+
+void D3D12RayTracingPSO::Bind(D3D12CommandContext& commandContext)
+{
+    /* Ray tracing PSOs share the compute root signature */
+    commandContext.SetComputeRootSignature(GetRootSignature());
+    commandContext.SetStateObject(stateObject_.Get());
+}
+
+D3D12_DISPATCH_RAYS_DESC D3D12RayTracingPSO::GetDispatchRaysDesc(UINT width, UINT height, UINT depth) const
+{
+    const D3D12_GPU_VIRTUAL_ADDRESS sbtAddress = (sbtBuffer_ ? sbtBuffer_->GetGPUVirtualAddress() : 0);
+
+    D3D12_DISPATCH_RAYS_DESC dispatchDesc = {};
+    {
+        dispatchDesc.RayGenerationShaderRecord.StartAddress = sbtAddress;
+        dispatchDesc.RayGenerationShaderRecord.SizeInBytes  = g_sbtRecordSize;
+        dispatchDesc.MissShaderTable.StartAddress           = (sbtMissSize_ > 0 ? sbtAddress + sbtMissOffset_ : 0);
+        dispatchDesc.MissShaderTable.SizeInBytes            = sbtMissSize_;
+        dispatchDesc.MissShaderTable.StrideInBytes          = g_sbtRecordSize;
+        dispatchDesc.HitGroupTable.StartAddress             = (sbtHitGroupSize_ > 0 ? sbtAddress + sbtHitGroupOffset_ : 0);
+        dispatchDesc.HitGroupTable.SizeInBytes              = sbtHitGroupSize_;
+        dispatchDesc.HitGroupTable.StrideInBytes            = g_sbtRecordSize;
+        dispatchDesc.Width                                  = width;
+        dispatchDesc.Height                                 = height;
+        dispatchDesc.Depth                                  = depth;
+    }
+    return dispatchDesc;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void D3D12RayTracingPSO::CreateNativeStateObject(ID3D12Device5* device, const RayTracingPipelineDescriptor& desc)
+{
+    /* Assign a unique export name to each shader, since all DXIL libraries share the same namespace within the state object */
+    const SmallVector<Shader*, 8> shaders = GetShadersAsArray(desc);
+
+    shaderExports_.reserve(shaders.size());
+    for (Shader* shader : shaders)
+    {
+        auto* shaderD3D = LLGL_CAST(const D3D12Shader*, shader);
+        shaderExports_.push_back(ShaderExport{ shaderD3D, ToWideString(shaderD3D->GetEntryPoint()) + L"_" + std::to_wstring(shaderExports_.size()) });
+    }
+
+    hitGroupNames_.reserve(desc.hitGroups.size());
+    for_range(i, desc.hitGroups.size())
+        hitGroupNames_.push_back(L"HitGroup_" + std::to_wstring(i));
+
+    /* Allocate all subobjects upfront, since subobjects must not be relocated once they are referenced */
+    const std::size_t numSubobjects = shaderExports_.size() + hitGroupNames_.size() + 3;
+
+    std::vector<D3D12_STATE_SUBOBJECT>      subobjects;
+    std::vector<std::wstring>               exportEntryPoints(shaderExports_.size());
+    std::vector<D3D12_EXPORT_DESC>          exportDescs(shaderExports_.size());
+    std::vector<D3D12_DXIL_LIBRARY_DESC>    libraryDescs(shaderExports_.size());
+    std::vector<D3D12_HIT_GROUP_DESC>       hitGroupDescs(hitGroupNames_.size());
+
+    subobjects.reserve(numSubobjects);
+
+    /* Add one DXIL library per shader that only exports the shader's entry point under its unique name */
+    for_range(i, shaderExports_.size())
+    {
+        exportEntryPoints[i] = ToWideString(shaderExports_[i].shader->GetEntryPoint());
+
+        D3D12_EXPORT_DESC& exportDesc = exportDescs[i];
+        {
+            exportDesc.Name             = shaderExports_[i].name.c_str();
+            exportDesc.ExportToRename   = exportEntryPoints[i].c_str();
+            exportDesc.Flags            = D3D12_EXPORT_FLAG_NONE;
+        }
+        D3D12_DXIL_LIBRARY_DESC& libraryDesc = libraryDescs[i];
+        {
+            libraryDesc.DXILLibrary = shaderExports_[i].shader->GetByteCode();
+            libraryDesc.NumExports  = 1;
+            libraryDesc.pExports    = &exportDesc;
+        }
+        subobjects.push_back(D3D12_STATE_SUBOBJECT{ D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY, &libraryDesc });
+    }
+
+    /* Add triangle hit groups */
+    for_range(i, hitGroupNames_.size())
+    {
+        const RayTracingHitGroupDescriptor& hitGroup = desc.hitGroups[i];
+        D3D12_HIT_GROUP_DESC& hitGroupDesc = hitGroupDescs[i];
+        {
+            hitGroupDesc.HitGroupExport             = hitGroupNames_[i].c_str();
+            hitGroupDesc.Type                       = D3D12_HIT_GROUP_TYPE_TRIANGLES;
+            hitGroupDesc.AnyHitShaderImport         = (hitGroup.anyHitShader != nullptr ? GetShaderExportName(hitGroup.anyHitShader).c_str() : nullptr);
+            hitGroupDesc.ClosestHitShaderImport     = (hitGroup.closestHitShader != nullptr ? GetShaderExportName(hitGroup.closestHitShader).c_str() : nullptr);
+            hitGroupDesc.IntersectionShaderImport   = nullptr;
+        }
+        subobjects.push_back(D3D12_STATE_SUBOBJECT{ D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP, &hitGroupDesc });
+    }
+
+    /* Add shader and pipeline configurations; without explicit associations, they apply to all exports */
+    D3D12_RAYTRACING_SHADER_CONFIG shaderConfig;
+    {
+        shaderConfig.MaxPayloadSizeInBytes      = desc.maxPayloadSize;
+        shaderConfig.MaxAttributeSizeInBytes    = desc.maxAttributeSize;
+    }
+    subobjects.push_back(D3D12_STATE_SUBOBJECT{ D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_SHADER_CONFIG, &shaderConfig });
+
+    D3D12_RAYTRACING_PIPELINE_CONFIG pipelineConfig;
+    {
+        pipelineConfig.MaxTraceRecursionDepth = desc.maxRecursionDepth;
+    }
+    subobjects.push_back(D3D12_STATE_SUBOBJECT{ D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG, &pipelineConfig });
+
+    D3D12_GLOBAL_ROOT_SIGNATURE globalRootSignature;
+    {
+        globalRootSignature.pGlobalRootSignature = GetRootSignature();
+    }
+    subobjects.push_back(D3D12_STATE_SUBOBJECT{ D3D12_STATE_SUBOBJECT_TYPE_GLOBAL_ROOT_SIGNATURE, &globalRootSignature });
+
+    /* Create native state object */
+    D3D12_STATE_OBJECT_DESC stateObjectDesc;
+    {
+        stateObjectDesc.Type            = D3D12_STATE_OBJECT_TYPE_RAYTRACING_PIPELINE;
+        stateObjectDesc.NumSubobjects   = static_cast<UINT>(subobjects.size());
+        stateObjectDesc.pSubobjects     = subobjects.data();
+    }
+    HRESULT hr = device->CreateStateObject(&stateObjectDesc, IID_PPV_ARGS(stateObject_.ReleaseAndGetAddressOf()));
+    if (FAILED(hr))
+        GetMutableReport().Errorf("Failed to create D3D12 ray tracing pipeline state [%s] (HRESULT = %s)\n", (desc.debugName != nullptr ? desc.debugName : ""), DXErrorToStrOrHex(hr));
+}
+
+void D3D12RayTracingPSO::CreateShaderBindingTable(ID3D12Device* device, const RayTracingPipelineDescriptor& desc)
+{
+    ComPtr<ID3D12StateObjectProperties> stateObjectProps;
+    HRESULT hr = stateObject_->QueryInterface(IID_PPV_ARGS(stateObjectProps.GetAddressOf()));
+    DXThrowIfFailed(hr, "failed to query ID3D12StateObjectProperties interface");
+
+    /* Determine SBT layout: ray-generation record, miss table, and hit group table, each aligned to the table alignment */
+    sbtMissOffset_      = GetAlignedSBTSize(g_sbtRecordSize);
+    sbtMissSize_        = g_sbtRecordSize * desc.missShaders.size();
+    sbtHitGroupOffset_  = sbtMissOffset_ + GetAlignedSBTSize(sbtMissSize_);
+    sbtHitGroupSize_    = g_sbtRecordSize * desc.hitGroups.size();
+
+    const UINT64 sbtSize = sbtHitGroupOffset_ + GetAlignedSBTSize(sbtHitGroupSize_);
+
+    /* Create SBT in upload heap, since it is only written once */
+    hr = D3D12MemoryAllocator::Get().CreateResource(
+        device,
+        D3D12_HEAP_TYPE_UPLOAD,
+        CD3DX12_RESOURCE_DESC::Buffer(sbtSize),
+        D3D12_RESOURCE_STATE_GENERIC_READ,
+        nullptr,
+        sbtBuffer_,
+        sbtAllocation_
+    );
+    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 shader binding table");
+
+    /* Write shader identifiers into SBT */
+    char* sbtData = nullptr;
+    const D3D12_RANGE readRange{ 0, 0 };
+    hr = sbtBuffer_->Map(0, &readRange, reinterpret_cast<void**>(&sbtData));
+    DXThrowIfFailed(hr, "failed to map D3D12 shader binding table");
+
+    auto WriteShaderIdentifier = [&stateObjectProps, sbtData](UINT64 offset, const wchar_t* exportName)
+    {
+        if (const void* identifier = stateObjectProps->GetShaderIdentifier(exportName))
+            ::memcpy(sbtData + offset, identifier, D3D12_SHADER_IDENTIFIER_SIZE_IN_BYTES);
+    };
+
+    WriteShaderIdentifier(0, GetShaderExportName(desc.rayGenerationShader).c_str());
+
+    for_range(i, desc.missShaders.size())
+        WriteShaderIdentifier(sbtMissOffset_ + g_sbtRecordSize * i, GetShaderExportName(desc.missShaders[i]).c_str());
+
+    for_range(i, hitGroupNames_.size())
+        WriteShaderIdentifier(sbtHitGroupOffset_ + g_sbtRecordSize * i, hitGroupNames_[i].c_str());
+
+    sbtBuffer_->Unmap(0, nullptr);
+}
+
+const std::wstring& D3D12RayTracingPSO::GetShaderExportName(const Shader* shader) const
+{
+    auto it = std::find_if(
+        shaderExports_.begin(),
+        shaderExports_.end(),
+        [shader](const ShaderExport& entry) -> bool
+        {
+            return (entry.shader == shader);
+        }
+    );
+    LLGL_ASSERT(it != shaderExports_.end(), "shader not found in D3D12 ray tracing PSO");
+    return it->name;
+}
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
+
+
+// ================================================================================
@@ -0,0 +1,90 @@
+/*
+ * D3D12RayTracingPSO.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_RAY_TRACING_PSO_H
+#define LLGL_D3D12_RAY_TRACING_PSO_H
+
+
+#include "D3D12PipelineState.h"
+#include "../D3D12MemoryAllocator.h"
+#include "../D3D12Types.h"
+
+
+#if LLGL_D3D12_ENABLE_RAYTRACING
+
+namespace LLGL
+{
+
+
+class D3D12Shader;
+
+/*
+Ray tracing PSO with an implicit shader binding table (SBT).
+The SBT consists of one ray-generation record, followed by one record per miss shader and one record per hit group in the order of the descriptor.
+*/
+class D3D12RayTracingPSO final : public D3D12PipelineState
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        D3D12RayTracingPSO(
+            ID3D12Device*                       device,
+            D3D12PipelineLayout&                defaultPipelineLayout,
+            const RayTracingPipelineDescriptor& desc
+        );
+
+        void Bind(D3D12CommandContext& commandContext) override;
+
+        // Returns the dispatch descriptor with the shader binding table of this PSO for the specified number of rays.
+        D3D12_DISPATCH_RAYS_DESC GetDispatchRaysDesc(UINT width, UINT height, UINT depth) const;
+
+    private:
+
+        void CreateNativeStateObject(ID3D12Device5* device, const RayTracingPipelineDescriptor& desc);
+        void CreateShaderBindingTable(ID3D12Device* device, const RayTracingPipelineDescriptor& desc);
+
+        // Returns the export name of the specified shader within the state object.
+        const std::wstring& GetShaderExportName(const Shader* shader) const;
+
+    private:
+
+        struct ShaderExport
+        {
+            const D3D12Shader*  shader;
+            std::wstring        name;
+        };
+
+    private:
+
+        ComPtr<ID3D12StateObject>   stateObject_;
+        std::vector<ShaderExport>   shaderExports_;
+        std::vector<std::wstring>   hitGroupNames_;
+
+        D3D12MemoryAllocation       sbtAllocation_;     // Must be declared before sbtBuffer_ to outlive it
+        ComPtr<ID3D12Resource>      sbtBuffer_;
+        UINT64                      sbtMissOffset_      = 0;
+        UINT64                      sbtMissSize_        = 0;
+        UINT64                      sbtHitGroupOffset_  = 0;
+        UINT64                      sbtHitGroupSize_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+#endif // /LLGL_D3D12_ENABLE_RAYTRACING
+
+
+#endif
+
+
+
+// ================================================================================
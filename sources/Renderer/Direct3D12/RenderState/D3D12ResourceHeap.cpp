@@ -25,16 +25,26 @@
 #include <LLGL/Utils/ForRange.h>
 #include <functional>
 #include <algorithm>
+#include <atomic>
 
 
 namespace LLGL
 {
 
 
+// Returns a new version number that is unique across all resource heaps.
+static UINT64 NextResourceHeapVersion()
+{
+    static std::atomic<UINT64> versionCounter{ 0 };
+    return ++versionCounter;
+}
+
 D3D12ResourceHeap::D3D12ResourceHeap(
     ID3D12Device*                               device,
     const ResourceHeapDescriptor&               desc,
     const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
+:
+    version_ { NextResourceHeapVersion() }
 {
     /* Get pipeline layout object */
     auto pipelineLayoutD3D = LLGL_CAST(const D3D12PipelineLayout*, desc.pipelineLayout);
@@ -195,6 +205,10 @@ std::uint32_t D3D12ResourceHeap::CreateResourceViewHandles(
         ++firstDescriptor;
     }
 
+    /* Invalidate persistent descriptor tables of this heap in all command contexts */
+    if (numWritten > 0)
+        version_ = NextResourceHeapVersion();
+
     return numWritten;
 }
 
@@ -296,9 +310,9 @@ bool D3D12ResourceHeap::CreateShaderResourceView(ID3D12Device* device, D3D12_CPU
     if (resource.GetResourceType() == ResourceType::Buffer)
     {
         auto& bufferD3D = LLGL_CAST(D3D12Buffer&, resource);
-        if ((bufferD3D.GetBindFlags() & BindFlags::Sampled) != 0)
+        if ((bufferD3D.GetBindFlags() & (BindFlags::Sampled | BindFlags::AccelerationStructure)) != 0)
         {
-            /* Create shader resource view (SRV) for D3D buffer */
+            /* Create shader resource view (SRV) for D3D buffer or acceleration structure */
             if (IsBufferViewEnabled(desc.bufferView))
                 bufferD3D.CreateShaderResourceView(device, cpuDescHandle, desc.bufferView);
             else
@@ -66,6 +66,12 @@ class D3D12ResourceHeap final : public ResourceHeap
         // Returns the native D3D descriptor heap for the specified heap type.
         ID3D12DescriptorHeap* GetDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE heapType) const;
 
+        // Returns the version of this resource heap. This is unique across all resource heaps and changes whenever descriptors are written.
+        inline UINT64 GetVersion() const
+        {
+            return version_;
+        }
+
     private:
 
         struct BindingHandleLocation
@@ -119,6 +125,7 @@ class D3D12ResourceHeap final : public ResourceHeap
         std::vector<ID3D12Resource*>                uavResourceHeap_;                   // Heap of UAV resources that require a barrier
         UINT                                        uavResourceSetStride_       = 0;    // Number of (potential) UAV resources per descriptor set
         UINT                                        uavResourceIndexOffset_     = 0;    // Subtracted offset for 'D3D12DescriptorHeapLocation::index'
+        UINT64                                      version_                    = 0;
 
 };
 
@@ -6,6 +6,7 @@
  */
 
 #include "D3D12RootParameter.h"
+#include "../D3D12Types.h"
 #include <LLGL/ShaderFlags.h>
 #include <LLGL/PipelineLayoutFlags.h>
 #include "../../../Core/CoreUtils.h"
@@ -162,6 +163,28 @@ bool D3D12RootParameter::IsCompatible(const D3D12_ROOT_CONSTANTS& rootConstants,
     );
 }
 
+UINT D3D12RootParameter::GetCost() const
+{
+    if (managedRootParam_ == nullptr)
+        return 0;
+    if (managedRootParam_->ParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS)
+        return D3D12RootParameter::GetCost(managedRootParam_->ParameterType, managedRootParam_->Constants.Num32BitValues);
+    return D3D12RootParameter::GetCost(managedRootParam_->ParameterType);
+}
+
+UINT D3D12RootParameter::GetCost(D3D12_ROOT_PARAMETER_TYPE rootParamType, UINT num32BitValues)
+{
+    switch (rootParamType)
+    {
+        case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:    return 1;
+        case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:     return num32BitValues;
+        case D3D12_ROOT_PARAMETER_TYPE_CBV:                 return 2;
+        case D3D12_ROOT_PARAMETER_TYPE_SRV:                 return 2;
+        case D3D12_ROOT_PARAMETER_TYPE_UAV:                 return 2;
+        default:                                            return 0;
+    }
+}
+
 D3D12_SHADER_VISIBILITY D3D12RootParameter::FindSuitableVisibility(long stageFlags)
 {
     /* Return shader visibility limited to only one stage if the input flags only contains that stage */
@@ -172,6 +195,10 @@ D3D12_SHADER_VISIBILITY D3D12RootParameter::FindSuitableVisibility(long stageFla
         case StageFlags::TessEvaluationStage:   return D3D12_SHADER_VISIBILITY_DOMAIN;
         case StageFlags::GeometryStage:         return D3D12_SHADER_VISIBILITY_GEOMETRY;
         case StageFlags::FragmentStage:         return D3D12_SHADER_VISIBILITY_PIXEL;
+        #if LLGL_D3D12_ENABLE_MESH_SHADERS
+        case StageFlags::TaskStage:             return D3D12_SHADER_VISIBILITY_AMPLIFICATION;
+        case StageFlags::MeshStage:             return D3D12_SHADER_VISIBILITY_MESH;
+        #endif
         default:                                return D3D12_SHADER_VISIBILITY_ALL; // Visibility to all stages by default
     }
 }
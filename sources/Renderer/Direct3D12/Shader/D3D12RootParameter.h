@@ -55,8 +55,14 @@ class D3D12RootParameter
         // Returns true if the specified root constants are compatible with this root paramter.
         bool IsCompatible(const D3D12_ROOT_CONSTANTS& rootConstants, D3D12_SHADER_VISIBILITY visibility) const;
 
+        // Returns the cost (in DWORDs) of this root parameter within the root signature.
+        UINT GetCost() const;
+
     public:
 
+        // Returns the cost (in DWORDs) of a root parameter of the specified type: 1 for descriptor tables, 2 for root descriptors, and 1 per 32-bit root constant.
+        static UINT GetCost(D3D12_ROOT_PARAMETER_TYPE rootParamType, UINT num32BitValues = 1);
+
         // Returns the best suitable shader visibility for the specified stage flags.
         static D3D12_SHADER_VISIBILITY FindSuitableVisibility(long stageFlags);
 
@@ -111,6 +111,19 @@ D3D12_STATIC_SAMPLER_DESC* D3D12RootSignature::AppendStaticSampler()
     return &(staticSamplers_.back());
 }
 
+UINT D3D12RootSignature::GetCost() const
+{
+    UINT cost = 0;
+    for (const D3D12_ROOT_PARAMETER& nativeRootParam : nativeRootParams_)
+    {
+        if (nativeRootParam.ParameterType == D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS)
+            cost += D3D12RootParameter::GetCost(nativeRootParam.ParameterType, nativeRootParam.Constants.Num32BitValues);
+        else
+            cost += D3D12RootParameter::GetCost(nativeRootParam.ParameterType);
+    }
+    return cost;
+}
+
 static ComPtr<ID3DBlob> DXSerializeRootSignature(
     const D3D12_ROOT_SIGNATURE_DESC& signatureDesc,
     const D3D_ROOT_SIGNATURE_VERSION signatureversion)
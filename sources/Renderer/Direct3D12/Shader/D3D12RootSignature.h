@@ -50,6 +50,9 @@ class D3D12RootSignature
 
         D3D12_STATIC_SAMPLER_DESC* AppendStaticSampler();
 
+        // Returns the accumulated cost (in DWORDs) of all root parameters. This must not exceed D3D12_MAX_ROOT_COST.
+        UINT GetCost() const;
+
         // Creates the final native D3D root signature.
         ComPtr<ID3D12RootSignature> Finalize(
             ID3D12Device*               device,
@@ -12,8 +12,10 @@
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/ReportUtils.h"
 #include "../../../Core/Exception.h"
+#include "../../../Platform/MappedFile.h"
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
+#include <cstring>
 #include <d3dcompiler.h>
 #include <comdef.h>
 
@@ -27,8 +29,9 @@ namespace LLGL
 
 
 D3D12Shader::D3D12Shader(D3D12RenderSystem& renderSystem, const ShaderDescriptor& desc) :
-    Shader        { desc.type    },
-    renderSystem_ { renderSystem }
+    Shader        { desc         },
+    renderSystem_ { renderSystem },
+    entryPoint_   { desc.entryPoint != nullptr ? desc.entryPoint : "" }
 {
     if (BuildShader(desc))
     {
@@ -52,6 +55,8 @@ const Report* D3D12Shader::GetReport() const
 
 bool D3D12Shader::Reflect(ShaderReflection& reflection) const
 {
+    if (GetSerializedReflection(reflection))
+        return true;
     if (byteCode_)
         return SUCCEEDED(ReflectShaderByteCode(reflection));
     else
@@ -283,6 +288,26 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
     const D3D_SHADER_MACRO* defines = reinterpret_cast<const D3D_SHADER_MACRO*>(shaderDesc.defines);
     int                     flags   = static_cast<int>(shaderDesc.flags);
 
+    /* Look up byte code in persistent shader cache before invoking the compiler */
+    ShaderCache*    shaderCache = renderSystem_.GetShaderCache();
+    std::uint64_t   cacheKey    = 0;
+
+    if (shaderCache != nullptr)
+    {
+        #ifdef LLGL_D3D12_ENABLE_DXCOMPILER
+        const char* compilerID = (IsProfileDxcAppropriate(target) ? "DXC" : "FXC");
+        #else
+        const char* compilerID = "FXC";
+        #endif
+        cacheKey = ShaderCache::GetKey(compilerID, D3D_COMPILER_VERSION, shaderDesc, sourceCode, sourceLength);
+        const Blob cachedByteCode = shaderCache->Read(cacheKey);
+        if (cachedByteCode)
+        {
+            byteCode_ = DXCreateBlob(cachedByteCode.GetData(), cachedByteCode.GetSize());
+            return true;
+        }
+    }
+
     /* Compile shader code */
     ComPtr<ID3DBlob> errors;
     HRESULT hr = S_OK;
@@ -300,9 +325,13 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
         /* Get DXC compiler arguments */
         std::vector<LPCWSTR> compilerArgs = DXGetDxcCompilerArgs(flags);
 
-        compilerArgs.push_back(L"-E");
+        /* Library targets (e.g. "lib_6_3" for ray tracing shaders) export all their functions and have no entry point */
         const std::wstring entryWide = ToWideString(entry);
-        compilerArgs.push_back(entryWide.c_str());
+        if (std::strncmp(target, "lib_", 4) != 0)
+        {
+            compilerArgs.push_back(L"-E");
+            compilerArgs.push_back(entryWide.c_str());
+        }
 
         compilerArgs.push_back(L"-T");
         const std::wstring targetWide = ToWideString(target);
@@ -360,6 +389,10 @@ bool D3D12Shader::CompileSource(const ShaderDescriptor& shaderDesc)
     /* Return true if compilation was successful */
     const bool hasErrors = FAILED(hr);
     ResetReportWithNewline(report_, DXGetBlobString(errors.Get()), hasErrors);
+
+    if (shaderCache != nullptr && !hasErrors && byteCode_)
+        shaderCache->Write(cacheKey, byteCode_->GetBufferPointer(), byteCode_->GetBufferSize());
+
     return !hasErrors;
 }
 
@@ -368,7 +401,8 @@ bool D3D12Shader::LoadBinary(const ShaderDescriptor& shaderDesc)
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
         /* Load binary code from file */
-        byteCode_ = DXCreateBlob(ReadFileBuffer(shaderDesc.source));
+        if (std::unique_ptr<MappedFile> mappedFile = MappedFile::Open(shaderDesc.source))
+            byteCode_ = DXCreateBlob(mappedFile->GetData(), mappedFile->GetSize());
     }
     else
     {
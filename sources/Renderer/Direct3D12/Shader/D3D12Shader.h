@@ -61,6 +61,12 @@ class D3D12Shader final : public Shader
         // Returns a list of all reflected constant buffers including their fields.
         HRESULT ReflectAndCacheConstantBuffers(const std::vector<D3D12ConstantBufferReflection>** outConstantBuffers);
 
+        // Returns the entry point this shader was created with. For ray tracing shaders, this is the name of the export within the DXIL library.
+        inline const std::string& GetEntryPoint() const
+        {
+            return entryPoint_;
+        }
+
     private:
 
         bool BuildShader(const ShaderDescriptor& shaderDesc);
@@ -81,6 +87,7 @@ class D3D12Shader final : public Shader
 
         ComPtr<ID3DBlob>                            byteCode_;
         Report                                      report_;
+        std::string                                 entryPoint_;
 
         std::vector<D3D12_INPUT_ELEMENT_DESC>       inputElements_;
         std::vector<D3D12_SO_DECLARATION_ENTRY>     soDeclEntries_;
@@ -0,0 +1,397 @@
+/*
+ * D3D12ImageConverter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12ImageConverter.h"
+#include "D3D12Texture.h"
+#include "../D3D12SubresourceContext.h"
+#include "../D3D12ObjectUtils.h"
+#include "../Command/D3D12CommandContext.h"
+#include "../Shader/D3D12RootSignature.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Format.h>
+#include <LLGL/Utils/ForRange.h>
+#include <d3dcompiler.h>
+#include <string.h>
+#include <string>
+
+
+namespace LLGL
+{
+
+
+/*
+Builtin compute shader that converts unconverted image data into the destination texture.
+The source buffer contains the rows of the source image with a row stride that is a multiple of 4, so no component crosses a 4-byte boundary.
+Integer components are mapped to the range [0, 1] with the same formula as ConvertImageBuffer, i.e. (value - min) / (max - min).
+Missing color components are 0 and missing alpha components are 1. The typed UAV store converts the result into the texture format.
+*/
+static const char* g_convertImageComputeShaderSource = R"(
+ByteAddressBuffer           srcBuffer   : register(t0);
+RWTexture2DArray<float4>    dstTexture  : register(u0);
+
+cbuffer ConvertImageArgs : register(b0)
+{
+    uint2   srcExtent;      // Extent of the source image (in texels)
+    uint    srcRowStride;   // Row stride of the source image (in bytes)
+    uint    srcLayerStride; // Layer stride of the source image (in bytes)
+    uint2   dstOffset;      // Offset within the destination MIP-map level
+    uint    numComponents;  // Number of components per texel: [1, 4]
+    uint    componentSize;  // Size of each component (in bytes): 1, 2, or 4
+    uint    dataClass;      // 0 = unsigned integer, 1 = signed integer, 2 = floating-point
+    uint    swizzleBGR;     // Non-zero if the first and third components are stored in reverse order
+};
+
+uint LoadComponentBits(uint addr)
+{
+    uint bits = srcBuffer.Load(addr & ~3u);
+    if (componentSize < 4u)
+    {
+        uint shift = (addr & 3u) * 8u;
+        bits = (bits >> shift) & ((1u << (componentSize * 8u)) - 1u);
+    }
+    return bits;
+}
+
+float DecodeComponent(uint bits)
+{
+    if (dataClass == 2u)
+        return (componentSize == 2u ? f16tofloat(bits) : asfloat(bits));
+
+    float numBits   = float(componentSize * 8u);
+    float range     = exp2(numBits) - 1.0;
+
+    if (dataClass == 1u)
+    {
+        uint    signShift   = 32u - componentSize * 8u;
+        int     value       = int(bits << signShift) >> signShift;
+        return (float(value) + exp2(numBits - 1.0)) / range;
+    }
+
+    return float(bits) / range;
+}
+
+[numthreads(8, 8, 1)]
+void ConvertImageCS(uint3 threadID : SV_DispatchThreadID)
+{
+    if (any(threadID.xy >= srcExtent))
+        return;
+
+    uint addr = threadID.z * srcLayerStride + threadID.y * srcRowStride + threadID.x * numComponents * componentSize;
+
+    float4 color = float4(0.0, 0.0, 0.0, 1.0);
+
+    [unroll]
+    for (uint i = 0; i < 4u; ++i)
+    {
+        if (i < numComponents)
+            color[i] = DecodeComponent(LoadComponentBits(addr + i * componentSize));
+    }
+
+    if (swizzleBGR != 0u)
+        color.rgb = color.bgr;
+
+    dstTexture[uint3(dstOffset + threadID.xy, threadID.z)] = color;
+}
+)";
+
+// Root parameter indices of the builtin root signature
+enum D3D12ConvertImageRootParameter : UINT
+{
+    D3D12ConvertImageRootParameter_Constants = 0,
+    D3D12ConvertImageRootParameter_SrcBuffer,
+    D3D12ConvertImageRootParameter_DstTexture,
+};
+
+D3D12ImageConverter& D3D12ImageConverter::Get()
+{
+    static D3D12ImageConverter instance;
+    return instance;
+}
+
+void D3D12ImageConverter::InitializeDevice(ID3D12Device* device)
+{
+    device_ = device;
+}
+
+void D3D12ImageConverter::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    uavDescHeap_.Reset();
+    pipelineState_.Reset();
+    rootSignature_.Reset();
+    device_ = nullptr;
+}
+
+// Returns the number of components of the specified image format, or 0 if it cannot be converted on the GPU.
+static UINT GetConvertibleImageFormatComponents(const ImageFormat format)
+{
+    switch (format)
+    {
+        case ImageFormat::R:    return 1;
+        case ImageFormat::RG:   return 2;
+        case ImageFormat::RGB:  return 3;
+        case ImageFormat::BGR:  return 3;
+        case ImageFormat::RGBA: return 4;
+        case ImageFormat::BGRA: return 4;
+        default:                return 0;
+    }
+}
+
+// Returns the data class for the builtin shader: 0 for unsigned integers, 1 for signed integers, 2 for floats, or ~0u if it cannot be converted on the GPU.
+static UINT GetConvertibleDataTypeClass(const DataType dataType)
+{
+    switch (dataType)
+    {
+        case DataType::UInt8:
+        case DataType::UInt16:
+        case DataType::UInt32:
+            return 0u;
+        case DataType::Int8:
+        case DataType::Int16:
+        case DataType::Int32:
+            return 1u;
+        case DataType::Float16:
+        case DataType::Float32:
+            return 2u;
+        default:
+            return ~0u;
+    }
+}
+
+bool D3D12ImageConverter::IsConversionSupported(const D3D12Texture& texture, const ImageView& srcImageView) const
+{
+    if (device_ == nullptr || !texture.HasGPUConversion() || srcImageView.data == nullptr)
+        return false;
+
+    /* Only textures that can be bound as 2D-array UAV are supported */
+    switch (texture.GetType())
+    {
+        case TextureType::Texture2D:
+        case TextureType::Texture2DArray:
+        case TextureType::TextureCube:
+        case TextureType::TextureCubeArray:
+            break;
+        default:
+            return false;
+    }
+
+    /* Image data that matches the texture format is copied without conversion */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(texture.GetFormat());
+    if (formatAttribs.format == srcImageView.format && formatAttribs.dataType == srcImageView.dataType)
+        return false;
+
+    if (GetConvertibleImageFormatComponents(srcImageView.format) == 0 || GetConvertibleDataTypeClass(srcImageView.dataType) == ~0u)
+        return false;
+
+    return IsFormatSupported(texture);
+}
+
+HRESULT D3D12ImageConverter::ConvertImage(
+    D3D12SubresourceContext&    context,
+    D3D12Texture&               texture,
+    const TextureRegion&        region,
+    const ImageView&            srcImageView)
+{
+    if (!IsConversionSupported(texture, srcImageView))
+        return E_INVALIDARG;
+
+    const TextureSubresource&   subresource = region.subresource;
+    const UINT                  width       = region.extent.width;
+    const UINT                  height      = region.extent.height;
+    const UINT                  numLayers   = subresource.numArrayLayers;
+
+    if (width == 0 || height == 0 || numLayers == 0)
+        return S_OK;
+
+    /* Copy unconverted rows into the upload buffer; rows are aligned to 4 bytes for ByteAddressBuffer loads */
+    const UINT      dstRowSize      = static_cast<UINT>(GetMemoryFootprint(srcImageView.format, srcImageView.dataType, width));
+    const UINT      srcRowStride    = (srcImageView.rowStride > 0 ? srcImageView.rowStride : dstRowSize);
+    const UINT      srcLayerStride  = srcRowStride * height;
+    const UINT      dstRowStride    = GetAlignedSize<UINT>(dstRowSize, 4u);
+    const UINT      dstLayerStride  = dstRowStride * height;
+    const UINT64    srcBufferSize   = static_cast<UINT64>(dstLayerStride) * numLayers;
+
+    ID3D12Resource* srcBuffer = context.CreateUploadBuffer(srcBufferSize);
+
+    char* mappedData = nullptr;
+    const D3D12_RANGE readRange{ 0, 0 };
+    HRESULT hr = srcBuffer->Map(0, &readRange, reinterpret_cast<void**>(&mappedData));
+    if (FAILED(hr))
+        return hr;
+
+    const char* srcData = static_cast<const char*>(srcImageView.data);
+    for_range(arrayLayer, numLayers)
+    {
+        for_range(row, height)
+        {
+            ::memcpy(
+                mappedData + arrayLayer * dstLayerStride + row * dstRowStride,
+                srcData + arrayLayer * srcLayerStride + row * srcRowStride,
+                dstRowSize
+            );
+        }
+    }
+    srcBuffer->Unmap(0, nullptr);
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    CreatePipelineStateOnce();
+
+    /* Create UAV for the destination MIP-map level; the descriptor is copied into the staging heap immediately, so it can be overwritten by the next conversion */
+    TextureViewDescriptor uavDesc;
+    {
+        uavDesc.type        = TextureType::Texture2DArray;
+        uavDesc.format      = texture.GetFormat();
+        uavDesc.subresource = TextureSubresource{ subresource.baseArrayLayer, numLayers, subresource.baseMipLevel, 1 };
+    }
+    D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle = uavDescHeap_->GetCPUDescriptorHandleForHeapStart();
+    texture.CreateUnorderedAccessView(device_, cpuDescHandle, uavDesc);
+
+    D3D12CommandContext& commandContext = context.GetCommandContext();
+
+    D3D12DescriptorHeapSetLayout oldLayout;
+    D3D12RootParameterIndices oldRootParamIndices;
+    commandContext.GetStagingDescriptorHeaps(oldLayout, oldRootParamIndices);
+
+    D3D12DescriptorHeapSetLayout newLayout;
+    newLayout.numHeapResourceViews = 1;
+    commandContext.SetStagingDescriptorHeaps(newLayout, {});
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = commandContext.CopyDescriptorsForStaging(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, cpuDescHandle, 1);
+
+    /* Bind builtin PSO and source buffer as raw root SRV */
+    commandContext.SetComputeRootSignature(rootSignature_.Get());
+    commandContext.SetPipelineState(pipelineState_.Get());
+
+    const UINT numComponents = GetConvertibleImageFormatComponents(srcImageView.format);
+    const bool isSwizzleBGR  = (srcImageView.format == ImageFormat::BGR || srcImageView.format == ImageFormat::BGRA);
+
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, width, 0);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, height, 1);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, dstRowStride, 2);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, dstLayerStride, 3);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, static_cast<UINT>(region.offset.x), 4);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, static_cast<UINT>(region.offset.y), 5);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, numComponents, 6);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, DataTypeSize(srcImageView.dataType), 7);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, GetConvertibleDataTypeClass(srcImageView.dataType), 8);
+    commandContext.SetComputeConstant(D3D12ConvertImageRootParameter_Constants, (isSwizzleBGR ? 1u : 0u), 9);
+
+    ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
+    commandList->SetComputeRootShaderResourceView(D3D12ConvertImageRootParameter_SrcBuffer, srcBuffer->GetGPUVirtualAddress());
+    commandList->SetComputeRootDescriptorTable(D3D12ConvertImageRootParameter_DstTexture, gpuDescHandle);
+
+    /* Write converted texels into destination texture */
+    commandContext.TransitionResource(texture.GetResource(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS, true);
+
+    commandList->Dispatch(
+        DivideRoundUp(width,  8u),
+        DivideRoundUp(height, 8u),
+        numLayers
+    );
+
+    commandContext.SetStagingDescriptorHeaps(oldLayout, oldRootParamIndices);
+
+    return S_OK;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool D3D12ImageConverter::IsFormatSupported(const D3D12Texture& texture) const
+{
+    /* Typed UAVs can neither write sRGB nor depth-stencil formats; integer and signed-normalized formats are not mapped from [0, 1] by the typed store */
+    const FormatAttributes& formatAttribs = GetFormatAttribs(texture.GetFormat());
+
+    constexpr long unsupportedFlags = (FormatFlags::HasDepthStencil | FormatFlags::IsColorSpace_sRGB | FormatFlags::IsCompressed | FormatFlags::IsInteger | FormatFlags::IsPacked);
+    if ((formatAttribs.flags & unsupportedFlags) != 0)
+        return false;
+    if ((formatAttribs.flags & FormatFlags::IsNormalized) != 0 && (formatAttribs.flags & FormatFlags::IsUnsigned) == 0)
+        return false;
+
+    /* Texture must have been created with BindFlags::Storage */
+    const D3D12_RESOURCE_DESC resourceDesc = texture.GetNative()->GetDesc();
+    if ((resourceDesc.Flags & D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS) == 0)
+        return false;
+
+    /* Typed UAV stores are optional for some formats, e.g. DXGI_FORMAT_B8G8R8A8_UNORM */
+    D3D12_FEATURE_DATA_FORMAT_SUPPORT formatSupport = {};
+    formatSupport.Format = texture.GetDXFormat();
+    if (FAILED(device_->CheckFeatureSupport(D3D12_FEATURE_FORMAT_SUPPORT, &formatSupport, sizeof(formatSupport))))
+        return false;
+
+    return ((formatSupport.Support2 & D3D12_FORMAT_SUPPORT2_UAV_TYPED_STORE) != 0);
+}
+
+void D3D12ImageConverter::CreatePipelineStateOnce()
+{
+    if (pipelineState_)
+        return;
+
+    /* Initialize root signature */
+    D3D12RootSignature rootSignature;
+    {
+        rootSignature.ResetAndAlloc(3, 0);
+        rootSignature[D3D12ConvertImageRootParameter_Constants].InitAsConstants(0, 10);
+        rootSignature[D3D12ConvertImageRootParameter_SrcBuffer].InitAsDescriptor(D3D12_ROOT_PARAMETER_TYPE_SRV, 0);
+        rootSignature[D3D12ConvertImageRootParameter_DstTexture].InitAsDescriptorRange(D3D12_DESCRIPTOR_RANGE_TYPE_UAV, 0, 1);
+    }
+    rootSignature_ = rootSignature.Finalize(device_);
+
+    /* Compile builtin compute shader; this is not precompiled with the other builtin shaders since only textures with MiscFlags::GPUConversion need it */
+    ComPtr<ID3DBlob> byteCode;
+    ComPtr<ID3DBlob> errors;
+    HRESULT hr = D3DCompile(
+        g_convertImageComputeShaderSource,
+        ::strlen(g_convertImageComputeShaderSource),
+        "LLGL::D3D12ImageConverter",
+        nullptr,
+        nullptr,
+        "ConvertImageCS",
+        "cs_5_0",
+        D3DCOMPILE_OPTIMIZATION_LEVEL3,
+        0,
+        byteCode.ReleaseAndGetAddressOf(),
+        errors.ReleaseAndGetAddressOf()
+    );
+    if (FAILED(hr))
+    {
+        const std::string info = "failed to compile builtin D3D12 compute shader for image conversion: " + DXGetBlobString(errors.Get());
+        DXThrowIfFailed(hr, info.c_str());
+    }
+
+    /* Create compute PSO */
+    D3D12_COMPUTE_PIPELINE_STATE_DESC psoDesc = {};
+    {
+        psoDesc.pRootSignature      = rootSignature_.Get();
+        psoDesc.CS.pShaderBytecode  = byteCode->GetBufferPointer();
+        psoDesc.CS.BytecodeLength   = byteCode->GetBufferSize();
+    }
+    hr = device_->CreateComputePipelineState(&psoDesc, IID_PPV_ARGS(pipelineState_.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12PipelineState", "for builtin image conversion");
+
+    /* Create non-shader-visible descriptor heap for the destination UAV */
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
+    {
+        heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+        heapDesc.NumDescriptors = 1;
+        heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+        heapDesc.NodeMask       = 0;
+    }
+    hr = device_->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(uavDescHeap_.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12DescriptorHeap", "for builtin image conversion");
+    D3D12SetObjectName(uavDescHeap_.Get(), "LLGL::D3D12ImageConverter::uavDescHeap");
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
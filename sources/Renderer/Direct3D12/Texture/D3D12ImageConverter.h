@@ -0,0 +1,90 @@
+/*
+ * D3D12ImageConverter.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_IMAGE_CONVERTER_H
+#define LLGL_D3D12_IMAGE_CONVERTER_H
+
+
+#include <LLGL/Texture.h>
+#include <LLGL/ImageFlags.h>
+#include <d3d12.h>
+#include "../../DXCommon/ComPtr.h"
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+class D3D12Texture;
+class D3D12SubresourceContext;
+
+/*
+Direct3D 12 image converter singleton for textures with MiscFlags::GPUConversion.
+Instead of converting image data with ConvertImageBuffer on the CPU, the unconverted image data is uploaded into an intermediate buffer
+and a builtin compute shader writes the converted texels directly into the destination texture via a typed UAV.
+The compute shader is compiled on first use, so applications that never use this flag don't pay for it at device creation.
+*/
+class D3D12ImageConverter
+{
+
+    public:
+
+        // Returns the singleton instance.
+        static D3D12ImageConverter& Get();
+
+    public:
+
+        D3D12ImageConverter(const D3D12ImageConverter&) = delete;
+        D3D12ImageConverter& operator = (const D3D12ImageConverter&) = delete;
+
+        D3D12ImageConverter(D3D12ImageConverter&&) = delete;
+        D3D12ImageConverter& operator = (D3D12ImageConverter&&) = delete;
+
+        void InitializeDevice(ID3D12Device* device);
+        void Clear();
+
+        // Returns true if the specified source image must be converted into the format of the specified texture and this can be done on the GPU.
+        bool IsConversionSupported(const D3D12Texture& texture, const ImageView& srcImageView) const;
+
+        // Records the upload of the unconverted source image and the compute dispatch that converts it into the specified texture region.
+        HRESULT ConvertImage(
+            D3D12SubresourceContext&    context,
+            D3D12Texture&               texture,
+            const TextureRegion&        region,
+            const ImageView&            srcImageView
+        );
+
+    private:
+
+        D3D12ImageConverter() = default;
+
+        bool IsFormatSupported(const D3D12Texture& texture) const;
+
+        // Compiles the builtin compute shader and creates its PSO if it has not been created yet.
+        void CreatePipelineStateOnce();
+
+    private:
+
+        ID3D12Device*                   device_         = nullptr;
+
+        std::mutex                      mutex_;         // Guards lazy PSO creation and the intermediate UAV descriptor
+        ComPtr<ID3D12RootSignature>     rootSignature_;
+        ComPtr<ID3D12PipelineState>     pipelineState_;
+        ComPtr<ID3D12DescriptorHeap>    uavDescHeap_;   // Non-shader-visible heap for the UAV of the destination subresource
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -13,6 +13,8 @@
 #include "../../DXCommon/DXTypes.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -113,6 +115,71 @@ HRESULT D3D12MipGenerator::GenerateMips(
     return E_FAIL;
 }
 
+HRESULT D3D12MipGenerator::GenerateMips(
+    D3D12CommandContext&        commandContext,
+    std::uint32_t               numTextures,
+    D3D12Texture* const *       textures)
+{
+    HRESULT result = S_OK;
+
+    /* Gather textures by dimension to generate their MIP-maps with a shared root signature */
+    SmallVector<D3D12Texture*> texturesPerDimension[MipDimension_Count];
+
+    for_range(i, numTextures)
+    {
+        D3D12Texture* texture = textures[i];
+        if (texture == nullptr)
+            continue;
+
+        if (!texture->SupportsGenerateMips() || texture->GetMipDescHeap() == nullptr)
+        {
+            /* Texture does not support generation of MIP-maps, but continue with the remaining textures */
+            result = E_INVALIDARG;
+            continue;
+        }
+
+        if (texture->GetNumMipLevels() <= 1)
+            continue;
+
+        /* Generate MIP-maps only once per texture, since explicit state transitions must not be duplicated within the same barrier */
+        if (std::find(textures, textures + i, texture) != textures + i)
+            continue;
+
+        switch (texture->GetType())
+        {
+            case TextureType::Texture1D:
+            case TextureType::Texture1DArray:
+                texturesPerDimension[MipDimension1D].push_back(texture);
+                break;
+
+            case TextureType::Texture2D:
+            case TextureType::TextureCube:
+            case TextureType::Texture2DArray:
+            case TextureType::TextureCubeArray:
+                texturesPerDimension[MipDimension2D].push_back(texture);
+                break;
+
+            case TextureType::Texture3D:
+                texturesPerDimension[MipDimension3D].push_back(texture);
+                break;
+
+            case TextureType::Texture2DMS:
+            case TextureType::Texture2DMSArray:
+                // no MIP-maps for multi-sampled textures
+                break;
+        }
+    }
+
+    for_range(dimension, static_cast<int>(MipDimension_Count))
+    {
+        const SmallVector<D3D12Texture*>& texturesOfDimension = texturesPerDimension[dimension];
+        if (!texturesOfDimension.empty())
+            GenerateMipsBatch(commandContext, static_cast<MipDimension>(dimension), texturesOfDimension.size(), texturesOfDimension.data());
+    }
+
+    return result;
+}
+
 
 /*
  * ======= Private: =======
@@ -459,6 +526,162 @@ void D3D12MipGenerator::GenerateMips3D(
     }
 }
 
+// Returns the maximum number of MIP-maps the compute shader of the specified dimension can downsample in a single pass.
+static UINT GetMaxNumMipsPerPass(int dimension)
+{
+    constexpr UINT maxNumMipsPerPass[] = { 8, 4, 3 };
+    return maxNumMipsPerPass[dimension];
+}
+
+void D3D12MipGenerator::GenerateMipsBatch(
+    D3D12CommandContext&        commandContext,
+    MipDimension                dimension,
+    std::size_t                 numTextures,
+    D3D12Texture* const *       textures)
+{
+    /* Transition all textures to UAV state with a single barrier */
+    for_range(i, numTextures)
+        commandContext.TransitionResource(textures[i]->GetResource(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    commandContext.FlushResourceBarriers();
+
+    /* Set root signature once for all textures */
+    ID3D12RootSignature* rootSignatures[] = { rootSignature1D_.Get(), rootSignature2D_.Get(), rootSignature3D_.Get() };
+    commandContext.SetComputeRootSignature(rootSignatures[dimension]);
+
+    const UINT maxNumMipsPerPass = GetMaxNumMipsPerPass(dimension);
+
+    for (UINT mipLevel = 0;; mipLevel += maxNumMipsPerPass)
+    {
+        /* Transition the source MIP-map level of all textures that have MIP-maps left to SRV state with a single barrier */
+        bool hasMipsLeft = false;
+        for_range(i, numTextures)
+        {
+            D3D12Texture& texture = *textures[i];
+            if (mipLevel + 1 < texture.GetNumMipLevels())
+            {
+                TransitionSourceMipLevel(commandContext, texture, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, mipLevel, texture.GetWholeSubresource());
+                hasMipsLeft = true;
+            }
+        }
+
+        if (!hasMipsLeft)
+            break;
+
+        commandContext.FlushResourceBarriers();
+
+        /* Downsample the next MIP-maps of all textures within the same pass */
+        for_range(i, numTextures)
+        {
+            D3D12Texture& texture = *textures[i];
+            const UINT mipLevelEnd = texture.GetNumMipLevels() - 1;
+            if (mipLevel < mipLevelEnd)
+                DispatchMipPass(commandContext, dimension, texture, mipLevel, std::min(maxNumMipsPerPass, mipLevelEnd - mipLevel));
+        }
+
+        /* Transition SRVs back to UAVs and insert UAV barriers; these are flushed together with the transitions of the next pass */
+        for_range(i, numTextures)
+        {
+            D3D12Texture& texture = *textures[i];
+            if (mipLevel + 1 < texture.GetNumMipLevels())
+            {
+                TransitionSourceMipLevel(commandContext, texture, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, mipLevel, texture.GetWholeSubresource());
+                commandContext.UAVBarrier(texture.GetNative());
+            }
+        }
+    }
+
+    commandContext.FlushResourceBarriers();
+}
+
+void D3D12MipGenerator::DispatchMipPass(
+    D3D12CommandContext&        commandContext,
+    MipDimension                dimension,
+    D3D12Texture&               texture,
+    UINT                        mipLevel,
+    UINT                        numMips)
+{
+    ID3D12GraphicsCommandList* commandList = commandContext.GetCommandList();
+
+    /* Set descriptor heap of this texture; the root signature is shared by all textures of the same dimension */
+    ID3D12DescriptorHeap* mipDescHeap = texture.GetMipDescHeap();
+    commandContext.SetDescriptorHeaps(1, &mipDescHeap);
+
+    /* Set SRV to read from entire MIP-map chain and UAVs of the next MIP-maps; the UAV of each MIP-map level follows the SRV */
+    D3D12_GPU_DESCRIPTOR_HANDLE gpuDescHandle = mipDescHeap->GetGPUDescriptorHandleForHeapStart();
+    commandList->SetComputeRootDescriptorTable(1, gpuDescHandle);
+    gpuDescHandle.ptr += descHandleSize_ * (1 + mipLevel);
+    commandList->SetComputeRootDescriptorTable(2, gpuDescHandle);
+
+    /* Determine source and destination extents */
+    const D3D12_RESOURCE_DESC resourceDesc = texture.GetNative()->GetDesc();
+    const bool isFormatSRGB = DXTypes::IsDXGIFormatSRGB(texture.GetDXFormat());
+
+    const UINT srcWidth     = static_cast<UINT>(resourceDesc.Width) >> mipLevel;
+    const UINT dstWidth     = std::max(1u, srcWidth >> 1);
+    const UINT numLayers    = texture.GetNumArrayLayers();
+
+    switch (dimension)
+    {
+        case MipDimension1D:
+        {
+            /* Bind pipeline state depending on power-of-two class */
+            const UINT nonPowerOfTwo = (srcWidth & 1);
+            commandContext.SetPipelineState(pipelines1D_[nonPowerOfTwo + (isFormatSRGB ? 2 : 0)].Get());
+
+            commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
+            commandContext.SetComputeConstant(0, mipLevel, 1);
+            commandContext.SetComputeConstant(0, numMips, 2);
+            commandContext.SetComputeConstant(0, 0u, 3);
+
+            commandList->Dispatch(DivideRoundUp(dstWidth, 64u), numLayers, 1u);
+        }
+        break;
+
+        case MipDimension2D:
+        {
+            const UINT srcHeight = static_cast<UINT>(resourceDesc.Height) >> mipLevel;
+            const UINT dstHeight = std::max(1u, srcHeight >> 1);
+
+            /* Bind pipeline state depending on power-of-two class */
+            const UINT nonPowerOfTwo = ((srcWidth & 1) | ((srcHeight & 1) << 1));
+            commandContext.SetPipelineState(pipelines2D_[nonPowerOfTwo + (isFormatSRGB ? 4 : 0)].Get());
+
+            commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
+            commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstHeight), 1);
+            commandContext.SetComputeConstant(0, mipLevel, 2);
+            commandContext.SetComputeConstant(0, numMips, 3);
+            commandContext.SetComputeConstant(0, 0u, 4);
+
+            commandList->Dispatch(DivideRoundUp(dstWidth, 8u), DivideRoundUp(dstHeight, 8u), numLayers);
+        }
+        break;
+
+        case MipDimension3D:
+        {
+            const UINT srcHeight = static_cast<UINT>(resourceDesc.Height)           >> mipLevel;
+            const UINT srcDepth  = static_cast<UINT>(resourceDesc.DepthOrArraySize) >> mipLevel;
+            const UINT dstHeight = std::max(1u, srcHeight >> 1);
+            const UINT dstDepth  = std::max(1u, srcDepth  >> 1);
+
+            /* Bind pipeline state depending on power-of-two class */
+            const UINT nonPowerOfTwo = ((srcWidth & 1) | ((srcHeight & 1) << 1) | ((srcDepth & 1) << 2));
+            commandContext.SetPipelineState(pipelines3D_[nonPowerOfTwo + (isFormatSRGB ? 8 : 0)].Get());
+
+            commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstWidth), 0);
+            commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstHeight), 1);
+            commandContext.SetComputeConstant(0, 1.0f / static_cast<float>(dstDepth), 2);
+            commandContext.SetComputeConstant(0, mipLevel, 3);
+            commandContext.SetComputeConstant(0, numMips, 4);
+
+            commandList->Dispatch(DivideRoundUp(dstWidth, 4u), DivideRoundUp(dstHeight, 4u), DivideRoundUp(dstDepth, 4u));
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
 void D3D12MipGenerator::TransitionSourceMipLevel(
     D3D12CommandContext&        commandContext,
     D3D12Texture&               texture,
@@ -51,6 +51,28 @@ class D3D12MipGenerator
             const TextureSubresource&   subresource
         );
 
+        /*
+        Generates the entire MIP chains of all specified textures. Textures of the same dimension share their root signature
+        and are processed one pass of MIP-maps at a time, so the resource barriers of all textures are flushed together for each pass.
+        */
+        HRESULT GenerateMips(
+            D3D12CommandContext&        commandContext,
+            std::uint32_t               numTextures,
+            D3D12Texture* const *       textures
+        );
+
+    private:
+
+        // Dimension of MIP-map generation shaders; each one has its own root signature.
+        enum MipDimension
+        {
+            MipDimension1D,
+            MipDimension2D,
+            MipDimension3D,
+
+            MipDimension_Count,
+        };
+
     private:
 
         D3D12MipGenerator() = default;
@@ -87,6 +109,23 @@ class D3D12MipGenerator
             const TextureSubresource&   subresource
         );
 
+        // Generates the entire MIP chains of all specified textures, which must all have the specified dimension.
+        void GenerateMipsBatch(
+            D3D12CommandContext&        commandContext,
+            MipDimension                dimension,
+            std::size_t                 numTextures,
+            D3D12Texture* const *       textures
+        );
+
+        // Binds the MIP-map descriptor tables of the specified texture and dispatches the compute shader for the next MIP-maps after the specified level.
+        void DispatchMipPass(
+            D3D12CommandContext&        commandContext,
+            MipDimension                dimension,
+            D3D12Texture&               texture,
+            UINT                        mipLevel,
+            UINT                        numMips
+        );
+
         void TransitionSourceMipLevel(
             D3D12CommandContext&        commandContext,
             D3D12Texture&               texture,
@@ -0,0 +1,60 @@
+/*
+ * D3D12PlacementHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12PlacementHeap.h"
+#include "../D3D12ObjectUtils.h"
+#include "../../DXCommon/DXCore.h"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+static D3D12_RESOURCE_HEAP_TIER GetD3DResourceHeapTier(ID3D12Device* device)
+{
+    D3D12_FEATURE_DATA_D3D12_OPTIONS options = {};
+    HRESULT hr = device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options));
+    return (SUCCEEDED(hr) ? options.ResourceHeapTier : D3D12_RESOURCE_HEAP_TIER_1);
+}
+
+D3D12PlacementHeap::D3D12PlacementHeap(ID3D12Device* device, const PlacementHeapDescriptor& desc) :
+    PlacementHeap { desc.size }
+{
+    /* Resource heap tier 1 does not allow textures of different categories in the same heap */
+    heapFlags_ =
+    (
+        GetD3DResourceHeapTier(device) >= D3D12_RESOURCE_HEAP_TIER_2
+            ? D3D12_HEAP_FLAG_ALLOW_ALL_BUFFERS_AND_TEXTURES
+            : D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES
+    );
+
+    D3D12_HEAP_DESC heapDesc = {};
+    {
+        heapDesc.SizeInBytes        = GetAlignedSize<UINT64>(desc.size, D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT);
+        heapDesc.Properties.Type    = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Alignment          = D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags              = heapFlags_;
+    }
+    HRESULT hr = device->CreateHeap(&heapDesc, IID_PPV_ARGS(native_.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12Heap", "for placement heap");
+
+    if (desc.debugName != nullptr)
+        SetDebugName(desc.debugName);
+}
+
+void D3D12PlacementHeap::SetDebugName(const char* name)
+{
+    D3D12SetObjectName(native_.Get(), name);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,63 @@
+/*
+ * D3D12PlacementHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_PLACEMENT_HEAP_H
+#define LLGL_D3D12_PLACEMENT_HEAP_H
+
+
+#include <LLGL/PlacementHeap.h>
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+
+
+namespace LLGL
+{
+
+
+class D3D12PlacementHeap final : public PlacementHeap
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        /*
+        Creates the native heap for placed textures. With resource heap tier 1, the heap only accepts
+        render targets and depth-stencil textures, since textures of different categories cannot share a heap.
+        */
+        D3D12PlacementHeap(ID3D12Device* device, const PlacementHeapDescriptor& desc);
+
+        // Returns the native ID3D12Heap object.
+        inline ID3D12Heap* GetNative() const
+        {
+            return native_.Get();
+        }
+
+        // Returns the heap flags this heap was created with.
+        inline D3D12_HEAP_FLAGS GetHeapFlags() const
+        {
+            return heapFlags_;
+        }
+
+    private:
+
+        ComPtr<ID3D12Heap>  native_;
+        D3D12_HEAP_FLAGS    heapFlags_  = D3D12_HEAP_FLAG_NONE;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -17,10 +17,12 @@
 #include "../../DXCommon/DXCore.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/Exception.h"
 #include "../D3DX12/d3dx12.h"
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -28,7 +30,8 @@ namespace LLGL
 
 
 D3D12RenderTarget::D3D12RenderTarget(D3D12Device& device, const RenderTargetDescriptor& desc) :
-    resolution_ { desc.resolution }
+    resolution_     { desc.resolution                                   },
+    numViewLayers_  { std::max(1u, NumMultiviewLayers(desc.viewMask))  }
 {
     ColorFormatVector colorFormats;
     const UINT numColorFormats = GatherAttachmentFormats(device, desc, colorFormats);
@@ -85,6 +88,9 @@ void D3D12RenderTarget::TransitionToOutputMerger(D3D12CommandContext& commandCon
     if (depthStencil_ != nullptr)
         commandContext.TransitionResource(*depthStencil_, D3D12_RESOURCE_STATE_DEPTH_WRITE);
 
+    if (shadingRateImage_ != nullptr)
+        commandContext.TransitionResource(*shadingRateImage_, D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE);
+
     commandContext.FlushResourceBarriers();
 }
 
@@ -98,7 +104,7 @@ void D3D12RenderTarget::ResolveSubresources(D3D12CommandContext& commandContext)
                 *target.resolveDstTexture,
                 target.resolveDstSubresource,
                 *target.multiSampledSrcTexture,
-                0,
+                target.multiSampledSrcSubresource,
                 target.format
             );
         }
@@ -109,10 +115,12 @@ void D3D12RenderTarget::ResolveSubresources(D3D12CommandContext& commandContext)
             commandContext.TransitionResource(*resource, resource->usageState);
     }
 
+    /* Don't flush these transitions here; they are batched with the barriers of the next draw, dispatch, or copy command */
     if (depthStencil_ != nullptr)
         commandContext.TransitionResource(*depthStencil_, depthStencil_->usageState);
 
-    commandContext.FlushResourceBarriers();
+    if (shadingRateImage_ != nullptr)
+        commandContext.TransitionResource(*shadingRateImage_, shadingRateImage_->usageState);
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE D3D12RenderTarget::GetCPUDescriptorHandleForRTV() const
@@ -251,6 +259,12 @@ void D3D12RenderTarget::CreateAttachments(
         const D3D12_DSV_FLAGS dsvFlags = (renderPassD3D != nullptr ? renderPassD3D->GetAttachmentFlagsDSV() : D3D12_DSV_FLAG_NONE);
         CreateDepthStencilAttachment(device, desc.depthStencilAttachment, dsvDescHeap_->GetCPUDescriptorHandleForHeapStart(), dsvFlags);
     }
+    if (Texture* texture = desc.shadingRateAttachment.texture)
+    {
+        /* Shading-rate image is not bound as a view but as the entire resource */
+        auto& textureD3D = LLGL_CAST(D3D12Texture&, *texture);
+        shadingRateImage_ = &(textureD3D.GetResource());
+    }
 }
 
 void D3D12RenderTarget::CreateColorAttachment(
@@ -261,10 +275,12 @@ void D3D12RenderTarget::CreateColorAttachment(
     D3D12_CPU_DESCRIPTOR_HANDLE     cpuDescHandle)
 {
     D3D12Resource* colorBuffer = nullptr;
+    UINT colorBufferArrayLayer = 0;
 
     /* Create color attachment */
     if (Texture* texture = colorAttachment.texture)
     {
+        colorBufferArrayLayer = colorAttachment.arrayLayer;
         ValidateMipResolution(*texture, colorAttachment.mipLevel);
         auto& textureD3D = LLGL_CAST(D3D12Texture&, *texture);
         colorBuffer = &(textureD3D.GetResource());
@@ -280,6 +296,7 @@ void D3D12RenderTarget::CreateColorAttachment(
     }
     else
     {
+        LLGL_ASSERT(numViewLayers_ == 1, "multiview render targets cannot have color attachments without texture");
         colorBuffer = CreateInternalTexture(
             device,
             format,
@@ -291,7 +308,7 @@ void D3D12RenderTarget::CreateColorAttachment(
 
     /* Create resolve target entry if multi-sampling is enabled */
     if (HasMultiSampling() && resolveAttachment.texture != nullptr)
-        CreateResolveTarget(resolveAttachment, format, colorBuffer);
+        CreateResolveTarget(resolveAttachment, format, colorBuffer, colorBufferArrayLayer);
 
     LLGL_ASSERT_PTR(colorBuffer);
     LLGL_ASSERT_PTR(colorBuffer->native.Get());
@@ -322,6 +339,7 @@ void D3D12RenderTarget::CreateDepthStencilAttachment(
     }
     else
     {
+        LLGL_ASSERT(numViewLayers_ == 1, "multiview render targets cannot have depth-stencil attachments without texture");
         const CD3DX12_CLEAR_VALUE clearValue{ depthStencilFormat_, 1.0f, 0 };
         depthStencil_ = CreateInternalTexture(
             device,
@@ -411,7 +429,7 @@ void D3D12RenderTarget::CreateRenderTargetView(
             rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DARRAY;
             rtvDesc.Texture2DArray.MipSlice             = mipLevel;
             rtvDesc.Texture2DArray.FirstArraySlice      = arrayLayer;
-            rtvDesc.Texture2DArray.ArraySize            = 1;
+            rtvDesc.Texture2DArray.ArraySize            = numViewLayers_;
             rtvDesc.Texture2DArray.PlaneSlice           = 0;
             break;
 
@@ -419,7 +437,7 @@ void D3D12RenderTarget::CreateRenderTargetView(
             rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DARRAY;
             rtvDesc.Texture1DArray.MipSlice             = mipLevel;
             rtvDesc.Texture1DArray.FirstArraySlice      = arrayLayer;
-            rtvDesc.Texture1DArray.ArraySize            = 1;
+            rtvDesc.Texture1DArray.ArraySize            = numViewLayers_;
             break;
 
         case TextureType::Texture2DMS:
@@ -429,7 +447,7 @@ void D3D12RenderTarget::CreateRenderTargetView(
         case TextureType::Texture2DMSArray:
             rtvDesc.ViewDimension                       = D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY;
             rtvDesc.Texture2DMSArray.FirstArraySlice    = arrayLayer;
-            rtvDesc.Texture2DMSArray.ArraySize          = 1;
+            rtvDesc.Texture2DMSArray.ArraySize          = numViewLayers_;
             break;
 
     }
@@ -471,7 +489,7 @@ void D3D12RenderTarget::CreateDepthStencilView(
             dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2DARRAY;
             dsvDesc.Texture2DArray.MipSlice             = mipLevel;
             dsvDesc.Texture2DArray.FirstArraySlice      = arrayLayer;
-            dsvDesc.Texture2DArray.ArraySize            = 1;
+            dsvDesc.Texture2DArray.ArraySize            = numViewLayers_;
             break;
 
         case TextureType::Texture1DArray:
@@ -488,7 +506,7 @@ void D3D12RenderTarget::CreateDepthStencilView(
         case TextureType::Texture2DMSArray:
             dsvDesc.ViewDimension                       = D3D12_DSV_DIMENSION_TEXTURE2DMSARRAY;
             dsvDesc.Texture2DMSArray.FirstArraySlice    = arrayLayer;
-            dsvDesc.Texture2DMSArray.ArraySize          = 1;
+            dsvDesc.Texture2DMSArray.ArraySize          = numViewLayers_;
             break;
     }
 
@@ -499,21 +517,27 @@ void D3D12RenderTarget::CreateDepthStencilView(
 void D3D12RenderTarget::CreateResolveTarget(
     const AttachmentDescriptor& resolveAttachment,
     DXGI_FORMAT                 format,
-    D3D12Resource*              multiSampledSrcTexture)
+    D3D12Resource*              multiSampledSrcTexture,
+    UINT                        multiSampledSrcArrayLayer)
 {
     LLGL_ASSERT_PTR(resolveAttachment.texture);
 
     ValidateMipResolution(*resolveAttachment.texture, resolveAttachment.mipLevel);
     auto& textureD3D = LLGL_CAST(D3D12Texture&, *resolveAttachment.texture);
 
-    ResolveTarget resolveTarget;
+    /* Resolve each array layer separately for multiview render targets; multi-sampled textures always have a single MIP-map */
+    for_range(layer, numViewLayers_)
     {
-        resolveTarget.resolveDstTexture         = &(textureD3D.GetResource());
-        resolveTarget.resolveDstSubresource     = textureD3D.CalcSubresource(resolveAttachment.mipLevel, resolveAttachment.arrayLayer);
-        resolveTarget.multiSampledSrcTexture    = multiSampledSrcTexture;
-        resolveTarget.format                    = format;
+        ResolveTarget resolveTarget;
+        {
+            resolveTarget.resolveDstTexture             = &(textureD3D.GetResource());
+            resolveTarget.resolveDstSubresource         = textureD3D.CalcSubresource(resolveAttachment.mipLevel, resolveAttachment.arrayLayer + layer);
+            resolveTarget.multiSampledSrcTexture        = multiSampledSrcTexture;
+            resolveTarget.multiSampledSrcSubresource    = multiSampledSrcArrayLayer + layer;
+            resolveTarget.format                        = format;
+        }
+        resolveTargets_.push_back(resolveTarget);
     }
-    resolveTargets_.push_back(resolveTarget);
 }
 
 
@@ -46,6 +46,12 @@ class D3D12RenderTarget final : public RenderTarget
         D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForRTV() const;
         D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandleForDSV() const;
 
+        // Returns the native shading-rate image or null if this render-target has no shading-rate attachment.
+        inline ID3D12Resource* GetShadingRateImage() const
+        {
+            return (shadingRateImage_ != nullptr ? shadingRateImage_->Get() : nullptr);
+        }
+
         // Returns true if this render-target has multi-sampled color attachments.
         inline bool HasMultiSampling() const
         {
@@ -112,7 +118,8 @@ class D3D12RenderTarget final : public RenderTarget
         void CreateResolveTarget(
             const AttachmentDescriptor& resolveAttachment,
             DXGI_FORMAT                 format,
-            D3D12Resource*              multiSampledSrcTexture
+            D3D12Resource*              multiSampledSrcTexture,
+            UINT                        multiSampledSrcArrayLayer
         );
 
     private:
@@ -123,6 +130,7 @@ class D3D12RenderTarget final : public RenderTarget
             D3D12Resource*  resolveDstTexture;
             UINT            resolveDstSubresource;
             D3D12Resource*  multiSampledSrcTexture;
+            UINT            multiSampledSrcSubresource;
             DXGI_FORMAT     format;
         };
 
@@ -130,6 +138,7 @@ class D3D12RenderTarget final : public RenderTarget
 
         Extent2D                        resolution_;
         DXGI_SAMPLE_DESC                sampleDesc_         = { 1, 0 };
+        UINT                            numViewLayers_      = 1; // Number of array layers per attachment for multiview rendering
 
         // Objects:
         ComPtr<ID3D12DescriptorHeap>    rtvDescHeap_;
@@ -142,6 +151,7 @@ class D3D12RenderTarget final : public RenderTarget
         std::vector<D3D12Resource*>     colorBuffers_;
         std::vector<ResolveTarget>      resolveTargets_;
         D3D12Resource*                  depthStencil_       = nullptr;
+        D3D12Resource*                  shadingRateImage_   = nullptr;
 
 };
 
@@ -0,0 +1,247 @@
+/*
+ * D3D12SparseTextureMemory.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "D3D12SparseTextureMemory.h"
+#include "../D3DX12/d3dx12.h"
+#include "../../DXCommon/DXCore.h"
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+// Number of 64 KB tiles for each heap of the tile pool, i.e. 4 MB per heap.
+static constexpr UINT g_numTilesPerHeap = 64;
+
+D3D12SparseTextureMemory::D3D12SparseTextureMemory(
+    ID3D12Device*       device,
+    ID3D12Resource*     resource,
+    UINT                numMipLevels,
+    UINT                numArrayLayers,
+    D3D12_HEAP_FLAGS    heapFlags)
+:
+    device_         { device         },
+    resource_       { resource       },
+    numMipLevels_   { numMipLevels   },
+    numArrayLayers_ { numArrayLayers },
+    heapFlags_      { heapFlags      }
+{
+    /* Query number of tiles for each MIP-map of the first array layer; all array layers have the same tiling */
+    UINT                numTilesForResource     = 0;
+    D3D12_TILE_SHAPE    tileShape               = {};
+    UINT                numSubresourceTilings   = numMipLevels;
+
+    mipTilings_.resize(numMipLevels);
+    device->GetResourceTiling(resource, &numTilesForResource, &packedMipInfo_, &tileShape, &numSubresourceTilings, 0, mipTilings_.data());
+}
+
+void D3D12SparseTextureMemory::MapPackedMips(ID3D12CommandQueue* commandQueue)
+{
+    if (packedMipInfo_.NumPackedMips == 0 || packedMipInfo_.NumTilesForPackedMips == 0)
+        return;
+
+    /* Allocate a dedicated heap for the packed MIP-maps of all array layers */
+    const UINT numTilesPerLayer = packedMipInfo_.NumTilesForPackedMips;
+
+    D3D12_HEAP_DESC heapDesc = {};
+    {
+        heapDesc.SizeInBytes        = static_cast<UINT64>(numTilesPerLayer) * numArrayLayers_ * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+        heapDesc.Properties.Type    = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Alignment          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags              = heapFlags_;
+    }
+    HRESULT hr = device_->CreateHeap(&heapDesc, IID_PPV_ARGS(packedMipHeap_.ReleaseAndGetAddressOf()));
+    DXThrowIfCreateFailed(hr, "ID3D12Heap", "for packed MIP-maps of sparse texture");
+
+    /* Map packed MIP-maps of each array layer to consecutive tiles in the heap */
+    for_range(layer, numArrayLayers_)
+    {
+        D3D12_TILED_RESOURCE_COORDINATE coord = {};
+        {
+            coord.Subresource = D3D12CalcSubresource(packedMipInfo_.NumStandardMips, layer, 0, numMipLevels_, numArrayLayers_);
+        }
+        D3D12_TILE_REGION_SIZE regionSize = {};
+        {
+            regionSize.NumTiles = numTilesPerLayer;
+            regionSize.UseBox   = FALSE;
+        }
+        const D3D12_TILE_RANGE_FLAGS    rangeFlags          = D3D12_TILE_RANGE_FLAG_NONE;
+        const UINT                      heapRangeStart      = layer * numTilesPerLayer;
+
+        commandQueue->UpdateTileMappings(
+            resource_,
+            1,
+            &coord,
+            &regionSize,
+            packedMipHeap_.Get(),
+            1,
+            &rangeFlags,
+            &heapRangeStart,
+            &numTilesPerLayer,
+            D3D12_TILE_MAPPING_FLAG_NONE
+        );
+    }
+}
+
+// Returns the key to identify a single tile within a sparse texture.
+static std::uint64_t GetSparseTileKey(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+    return
+    (
+        (static_cast<std::uint64_t>(arrayLayer & 0x7FFF) << 49) |
+        (static_cast<std::uint64_t>(mipLevel   & 0x1F  ) << 44) |
+        (static_cast<std::uint64_t>(z          & 0xFFF ) << 32) |
+        (static_cast<std::uint64_t>(y          & 0xFFFF) << 16) |
+        (static_cast<std::uint64_t>(x          & 0xFFFF)      )
+    );
+}
+
+void D3D12SparseTextureMemory::UpdateTiles(ID3D12CommandQueue* commandQueue, const TileMappingDescriptor& mapping)
+{
+    /* Packed MIP-maps are always resident */
+    if (mapping.mipLevel >= packedMipInfo_.NumStandardMips || mapping.mipLevel >= mipTilings_.size() || mapping.arrayLayer >= numArrayLayers_)
+        return;
+
+    const D3D12_SUBRESOURCE_TILING& tiling = mipTilings_[mapping.mipLevel];
+    const UINT subresource = D3D12CalcSubresource(mapping.mipLevel, mapping.arrayLayer, 0, numMipLevels_, numArrayLayers_);
+
+    /* Group mapped tiles by their heap, since each call to UpdateTileMappings can only refer to a single heap */
+    std::map<UINT, TileMappingBatch>    mapBatches;
+    TileMappingBatch                    unmapBatch;
+
+    for_subrange(z, mapping.tileOffset.z, mapping.tileOffset.z + static_cast<std::int32_t>(mapping.numTiles.depth))
+    {
+        for_subrange(y, mapping.tileOffset.y, mapping.tileOffset.y + static_cast<std::int32_t>(mapping.numTiles.height))
+        {
+            for_subrange(x, mapping.tileOffset.x, mapping.tileOffset.x + static_cast<std::int32_t>(mapping.numTiles.width))
+            {
+                /* Skip tiles outside the MIP-map */
+                if (x < 0 || y < 0 || z < 0 ||
+                    static_cast<UINT>(x) >= tiling.WidthInTiles ||
+                    static_cast<UINT>(y) >= tiling.HeightInTiles ||
+                    static_cast<UINT>(z) >= tiling.DepthInTiles)
+                {
+                    continue;
+                }
+
+                D3D12_TILED_RESOURCE_COORDINATE coord;
+                {
+                    coord.X             = static_cast<UINT>(x);
+                    coord.Y             = static_cast<UINT>(y);
+                    coord.Z             = static_cast<UINT>(z);
+                    coord.Subresource   = subresource;
+                }
+
+                const std::uint64_t key = GetSparseTileKey(mapping.mipLevel, mapping.arrayLayer, coord.X, coord.Y, coord.Z);
+                auto it = residentTiles_.find(key);
+
+                if (mapping.resident)
+                {
+                    /* Allocate tiles only if they are not resident yet */
+                    if (it != residentTiles_.end())
+                        continue;
+
+                    const UINT tile = AllocateTile();
+                    residentTiles_[key] = tile;
+
+                    TileMappingBatch& batch = mapBatches[tile / g_numTilesPerHeap];
+                    batch.coords.push_back(coord);
+                    batch.heapTileOffsets.push_back(tile % g_numTilesPerHeap);
+                }
+                else
+                {
+                    /* Return tiles to the pool and map them to null */
+                    if (it == residentTiles_.end())
+                        continue;
+
+                    freeTiles_.push_back(it->second);
+                    residentTiles_.erase(it);
+
+                    unmapBatch.coords.push_back(coord);
+                }
+            }
+        }
+    }
+
+    for (const auto& batch : mapBatches)
+        SubmitTileMappings(commandQueue, tileHeaps_[batch.first].Get(), batch.second);
+
+    if (!unmapBatch.coords.empty())
+        SubmitTileMappings(commandQueue, nullptr, unmapBatch);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+UINT D3D12SparseTextureMemory::AllocateTile()
+{
+    if (freeTiles_.empty())
+    {
+        /* Create new heap for the tile pool */
+        ComPtr<ID3D12Heap> heap;
+
+        D3D12_HEAP_DESC heapDesc = {};
+        {
+            heapDesc.SizeInBytes        = static_cast<UINT64>(g_numTilesPerHeap) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+            heapDesc.Properties.Type    = D3D12_HEAP_TYPE_DEFAULT;
+            heapDesc.Alignment          = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+            heapDesc.Flags              = heapFlags_;
+        }
+        HRESULT hr = device_->CreateHeap(&heapDesc, IID_PPV_ARGS(heap.ReleaseAndGetAddressOf()));
+        DXThrowIfCreateFailed(hr, "ID3D12Heap", "for tile pool of sparse texture");
+
+        /* Add tiles of new heap to free list in reverse order, so they are allocated in ascending order */
+        const UINT firstTile = static_cast<UINT>(tileHeaps_.size()) * g_numTilesPerHeap;
+        tileHeaps_.push_back(std::move(heap));
+
+        for_range_reverse(i, g_numTilesPerHeap)
+            freeTiles_.push_back(firstTile + i);
+    }
+
+    const UINT tile = freeTiles_.back();
+    freeTiles_.pop_back();
+    return tile;
+}
+
+void D3D12SparseTextureMemory::SubmitTileMappings(ID3D12CommandQueue* commandQueue, ID3D12Heap* heap, const TileMappingBatch& batch)
+{
+    const UINT numTiles = static_cast<UINT>(batch.coords.size());
+
+    /* Each tile is mapped separately, since resident tiles are not necessarily consecutive within the heap */
+    D3D12_TILE_REGION_SIZE regionSize = {};
+    {
+        regionSize.NumTiles = 1;
+        regionSize.UseBox   = FALSE;
+    }
+    const std::vector<D3D12_TILE_REGION_SIZE>   regionSizes     (numTiles, regionSize);
+    const std::vector<D3D12_TILE_RANGE_FLAGS>   rangeFlags      (numTiles, (heap != nullptr ? D3D12_TILE_RANGE_FLAG_NONE : D3D12_TILE_RANGE_FLAG_NULL));
+    const std::vector<UINT>                     rangeTileCounts (numTiles, 1u);
+
+    commandQueue->UpdateTileMappings(
+        resource_,
+        numTiles,
+        batch.coords.data(),
+        regionSizes.data(),
+        heap,
+        numTiles,
+        rangeFlags.data(),
+        (heap != nullptr ? batch.heapTileOffsets.data() : nullptr),
+        rangeTileCounts.data(),
+        D3D12_TILE_MAPPING_FLAG_NONE
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,89 @@
+/*
+ * D3D12SparseTextureMemory.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_D3D12_SPARSE_TEXTURE_MEMORY_H
+#define LLGL_D3D12_SPARSE_TEXTURE_MEMORY_H
+
+
+#include "../../DXCommon/ComPtr.h"
+#include <d3d12.h>
+#include <cstdint>
+#include <vector>
+#include <map>
+
+
+namespace LLGL
+{
+
+
+struct TileMappingDescriptor;
+
+/*
+Manages the tile pool of a reserved resource: Resident tiles are sub-allocated from heaps with a fixed number of tiles each,
+and the packed MIP-maps (aka. MIP tail) of each array layer are mapped to a dedicated heap on creation.
+*/
+class D3D12SparseTextureMemory
+{
+
+    public:
+
+        // Queries the tiling of the specified reserved resource. Heaps are created with the specified heap flags to match the resource category.
+        D3D12SparseTextureMemory(ID3D12Device* device, ID3D12Resource* resource, UINT numMipLevels, UINT numArrayLayers, D3D12_HEAP_FLAGS heapFlags);
+
+        D3D12SparseTextureMemory(const D3D12SparseTextureMemory&) = delete;
+        D3D12SparseTextureMemory& operator = (const D3D12SparseTextureMemory&) = delete;
+
+        // Maps the packed MIP-maps of all array layers on the specified queue. They are always resident.
+        void MapPackedMips(ID3D12CommandQueue* commandQueue);
+
+        // Maps or unmaps the specified range of tiles on the specified queue. Tiles whose residency does not change are ignored.
+        void UpdateTiles(ID3D12CommandQueue* commandQueue, const TileMappingDescriptor& mapping);
+
+    private:
+
+        // Tile mapping operations that refer to the same heap (or null for unmapping) and are submitted with a single call to UpdateTileMappings.
+        struct TileMappingBatch
+        {
+            std::vector<D3D12_TILED_RESOURCE_COORDINATE>    coords;
+            std::vector<UINT>                               heapTileOffsets;
+        };
+
+    private:
+
+        // Allocates a single tile and returns its global index, i.e. heap index multiplied by number of tiles per heap plus tile offset within that heap.
+        UINT AllocateTile();
+
+        // Submits the specified batch of tile mappings for the specified heap or unmaps the tiles if the heap is null.
+        void SubmitTileMappings(ID3D12CommandQueue* commandQueue, ID3D12Heap* heap, const TileMappingBatch& batch);
+
+    private:
+
+        ID3D12Device*                           device_             = nullptr;
+        ID3D12Resource*                         resource_           = nullptr;
+        UINT                                    numMipLevels_       = 0;
+        UINT                                    numArrayLayers_     = 0;
+        D3D12_HEAP_FLAGS                        heapFlags_          = D3D12_HEAP_FLAG_NONE;
+
+        D3D12_PACKED_MIP_INFO                   packedMipInfo_      = {};
+        std::vector<D3D12_SUBRESOURCE_TILING>   mipTilings_;
+
+        std::vector<ComPtr<ID3D12Heap>>         tileHeaps_;
+        std::vector<UINT>                       freeTiles_;
+        std::map<std::uint64_t, UINT>           residentTiles_;
+        ComPtr<ID3D12Heap>                      packedMipHeap_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -14,8 +14,10 @@
 #include "../Buffer/D3D12Buffer.h"
 #include "../../DXCommon/DXCore.h"
 #include "../../TextureUtils.h"
+#include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../FormatTable.h"
 #include <LLGL/Backend/Direct3D12/NativeHandle.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
@@ -25,15 +27,22 @@ namespace LLGL
 {
 
 
-D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc) :
+D3D12Texture::D3D12Texture(
+    ID3D12Device*               device,
+    const TextureDescriptor&    desc,
+    ID3D12Heap*                 placementHeap,
+    UINT64                      placementOffset,
+    HANDLE                      importHandle)
+:
     Texture         { desc.type, desc.bindFlags          },
     baseFormat_     { desc.format                        },
     format_         { DXTypes::ToDXGIFormat(desc.format) },
     numMipLevels_   { NumMipLevels(desc)                 },
     numArrayLayers_ { std::max(1u, desc.arrayLayers)     },
-    extent_         { desc.extent                        }
+    extent_         { desc.extent                        },
+    gpuConversion_  { ((desc.miscFlags & MiscFlags::GPUConversion) != 0) }
 {
-    CreateNativeTexture(device, desc);
+    CreateNativeTexture(device, desc, placementHeap, placementOffset, importHandle);
 
     if (SupportsGenerateMips())
         CreateMipDescHeap(device);
@@ -42,6 +51,33 @@ D3D12Texture::D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc)
         SetDebugName(desc.debugName);
 }
 
+#if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+static DXGI_FORMAT ToDXGISamplerFeedbackFormat(const SamplerFeedbackType type)
+{
+    return (type == SamplerFeedbackType::MipRegionUsed ? DXGI_FORMAT_SAMPLER_FEEDBACK_MIP_REGION_USED_OPAQUE : DXGI_FORMAT_SAMPLER_FEEDBACK_MIN_MIP_OPAQUE);
+}
+
+D3D12Texture::D3D12Texture(ID3D12Device* device, const SamplerFeedbackDescriptor& desc) :
+    Texture         { desc.pairedTexture->GetType(), BindFlags::Storage },
+    baseFormat_     { Format::R8UInt                                    },
+    format_         { ToDXGISamplerFeedbackFormat(desc.type)            },
+    pairedTexture_  { LLGL_CAST(D3D12Texture*, desc.pairedTexture)      }
+{
+    /* MIN_MIP feedback maps have a single MIP-map level, MIP_REGION_USED feedback maps have one for each level of the paired texture */
+    numMipLevels_   = (desc.type == SamplerFeedbackType::MipRegionUsed ? pairedTexture_->GetNumMipLevels() : 1u);
+    numArrayLayers_ = pairedTexture_->GetNumArrayLayers();
+    extent_         = pairedTexture_->GetExtent();
+
+    CreateSamplerFeedbackMap(device, desc.mipRegion);
+    CreateSamplerFeedbackDecodeTexture(device, desc.mipRegion);
+
+    if (desc.debugName != nullptr)
+        SetDebugName(desc.debugName);
+}
+
+#endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
 bool D3D12Texture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
     if (auto* nativeHandleD3D = GetTypedNativeHandle<Direct3D12::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
@@ -117,7 +153,7 @@ TextureDescriptor D3D12Texture::GetDesc() const
 
     texDesc.type        = GetType();
     texDesc.bindFlags   = GetBindFlags();
-    texDesc.miscFlags   = 0;
+    texDesc.miscFlags   = (sparseMemory_ ? MiscFlags::Sparse : 0) | (gpuConversion_ ? MiscFlags::GPUConversion : 0);
     texDesc.format      = GetBaseFormat();
     texDesc.mipLevels   = desc.MipLevels;
 
@@ -363,7 +399,7 @@ static void GetMemoryFootprintWithAlignment(
     UINT&           layerStride,
     UINT64&         outBufferSize)
 {
-    const FormatAttributes& formatAttribs   = GetFormatAttribs(format);
+    const FormatAttributes& formatAttribs   = FormatTable::GetAttribs(format);
     const UINT              rowSize         = extent.width * formatAttribs.bitSize / (8u * formatAttribs.blockWidth);
 
     layerSize       = rowSize * (extent.height / formatAttribs.blockHeight);
@@ -545,6 +581,9 @@ void D3D12Texture::CreateShaderResourceViewPrimary(
 
 void D3D12Texture::CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
 {
+    if (pairedTexture_ != nullptr)
+        return CreateSamplerFeedbackUnorderedAccessView(device, cpuDescHandle);
+
     CreateUnorderedAccessViewPrimary(
         device,
         D3D12Types::MapUavDimension(GetType()),
@@ -556,6 +595,9 @@ void D3D12Texture::CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DES
 
 void D3D12Texture::CreateUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle, const TextureViewDescriptor& desc)
 {
+    if (pairedTexture_ != nullptr)
+        return CreateSamplerFeedbackUnorderedAccessView(device, cpuDescHandle);
+
     CreateUnorderedAccessViewPrimary(
         device,
         D3D12Types::MapUavDimension(desc.type),
@@ -763,12 +805,18 @@ static D3D12_RESOURCE_STATES GetInitialD3D12ResourceState(const TextureDescripto
     return flags;
 }
 
-void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc)
+void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc, ID3D12Heap* placementHeap, UINT64 placementOffset, HANDLE importHandle)
 {
     /* Setup resource descriptor by texture descriptor and create hardware resource */
     D3D12_RESOURCE_DESC descD3D;
     ConvertD3D12TextureDesc(descD3D, desc);
 
+    if ((desc.miscFlags & MiscFlags::Sparse) != 0)
+    {
+        CreateReservedTexture(device, descD3D, desc);
+        return;
+    }
+
     /* Get optimal clear value (if specified) */
     const bool useClearValue = ((desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0);
 
@@ -788,19 +836,89 @@ void D3D12Texture::CreateNativeTexture(ID3D12Device* device, const TextureDescri
         optClearValue.DepthStencil.Stencil  = static_cast<UINT8>(desc.clearValue.stencil);
     }
 
-    /* Create hardware resource for the texture */
-    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
-    HRESULT hr = device->CreateCommittedResource(
-        &heapProperties,
-        D3D12_HEAP_FLAG_NONE,
-        &descD3D,
+    if (importHandle != nullptr)
+    {
+        /* Open shared resource of another device or process; shared resources are in the common state when they are opened */
+        HRESULT hr = device->OpenSharedHandle(importHandle, IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf()));
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 imported shared texture");
+        resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COMMON, GetInitialD3D12ResourceState(desc));
+        return;
+    }
+
+    if ((desc.miscFlags & MiscFlags::Shared) != 0)
+    {
+        /* Create committed resource in its own shared heap, since the entire heap is exported */
+        const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
+        HRESULT hr = device->CreateCommittedResource(
+            &heapProperties,
+            D3D12_HEAP_FLAG_SHARED,
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 shared texture");
+        return;
+    }
+
+    if (placementHeap != nullptr)
+    {
+        /* Create hardware resource within the memory of the placement heap */
+        HRESULT hr = device->CreatePlacedResource(
+            placementHeap,
+            placementOffset,
+            &descD3D,
+            resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+            (useClearValue ? &optClearValue : nullptr),
+            IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        );
+        DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 placed texture");
+        return;
+    }
+
+    /* Create hardware resource for the texture; small textures are placed into a shared heap */
+    HRESULT hr = D3D12MemoryAllocator::Get().CreateResource(
+        device,
+        D3D12_HEAP_TYPE_DEFAULT,
+        descD3D,
         resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
         (useClearValue ? &optClearValue : nullptr),
-        IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+        resource_.native,
+        allocation_
     );
     DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 hardware texture");
 }
 
+void D3D12Texture::CreateReservedTexture(ID3D12Device* device, D3D12_RESOURCE_DESC& descD3D, const TextureDescriptor& desc)
+{
+    /* Reserved resources require the standard 64 KB tile layout; their memory is mapped tile by tile via the command queue */
+    descD3D.Layout = D3D12_TEXTURE_LAYOUT_64KB_UNDEFINED_SWIZZLE;
+
+    HRESULT hr = device->CreateReservedResource(
+        &descD3D,
+        resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_COPY_DEST, GetInitialD3D12ResourceState(desc)),
+        nullptr,
+        IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+    );
+    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 reserved texture");
+
+    /* Tile pool heaps must match the resource category with resource heap tier 1 */
+    const D3D12_HEAP_FLAGS heapFlags =
+    (
+        (desc.bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0
+            ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES
+            : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES
+    );
+    sparseMemory_ = MakeUnique<D3D12SparseTextureMemory>(device, resource_.Get(), numMipLevels_, numArrayLayers_, heapFlags);
+}
+
+D3D12_RESOURCE_ALLOCATION_INFO D3D12Texture::QueryResourceAllocationInfo(ID3D12Device* device, const TextureDescriptor& desc)
+{
+    D3D12_RESOURCE_DESC descD3D;
+    ConvertD3D12TextureDesc(descD3D, desc);
+    return device->GetResourceAllocationInfo(0, 1, &descD3D);
+}
+
 // Determine SRV dimension for descriptor heaps used in D3D12MipGenerator: either 1D array, 2D array, or 3D
 static D3D12_SRV_DIMENSION GetMipChainSRVDimension(const TextureType type)
 {
@@ -845,6 +963,89 @@ static D3D12_UAV_DIMENSION GetMipChainUAVDimension(const TextureType type)
     return D3D12_UAV_DIMENSION_UNKNOWN;
 }
 
+#if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+void D3D12Texture::CreateSamplerFeedbackMap(ID3D12Device* device, const Extent3D& mipRegion)
+{
+    ComPtr<ID3D12Device8> device8;
+    HRESULT hr = device->QueryInterface(IID_PPV_ARGS(device8.GetAddressOf()));
+    DXThrowIfCastFailed(hr, "ID3D12Device8", "for D3D12 sampler feedback");
+
+    /* Feedback maps have the same dimensions as their paired texture; each texel covers one MIP region */
+    D3D12_RESOURCE_DESC1 descD3D = {};
+    {
+        descD3D.Dimension                       = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+        descD3D.Alignment                       = 0;
+        descD3D.Width                           = extent_.width;
+        descD3D.Height                          = extent_.height;
+        descD3D.DepthOrArraySize                = static_cast<UINT16>(numArrayLayers_);
+        descD3D.MipLevels                       = static_cast<UINT16>(numMipLevels_);
+        descD3D.Format                          = format_;
+        descD3D.SampleDesc.Count                = 1;
+        descD3D.SampleDesc.Quality              = 0;
+        descD3D.Layout                          = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+        descD3D.Flags                           = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+        descD3D.SamplerFeedbackMipRegion.Width  = mipRegion.width;
+        descD3D.SamplerFeedbackMipRegion.Height = mipRegion.height;
+        descD3D.SamplerFeedbackMipRegion.Depth  = mipRegion.depth;
+    }
+    const CD3DX12_HEAP_PROPERTIES heapProperties{ D3D12_HEAP_TYPE_DEFAULT };
+    hr = device8->CreateCommittedResource2(
+        &heapProperties,
+        D3D12_HEAP_FLAG_NONE,
+        &descD3D,
+        resource_.SetInitialAndUsageStates(D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_UNORDERED_ACCESS),
+        nullptr,
+        nullptr,
+        IID_PPV_ARGS(resource_.native.ReleaseAndGetAddressOf())
+    );
+    DXThrowIfCreateFailed(hr, "ID3D12Resource", "for D3D12 sampler feedback map");
+
+    /* Create non-shader-visible UAV to clear the feedback map */
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc;
+    {
+        heapDesc.Type           = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
+        heapDesc.NumDescriptors = 1;
+        heapDesc.Flags          = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
+        heapDesc.NodeMask       = 0;
+    }
+    hr = device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(feedbackDescHeap_.ReleaseAndGetAddressOf()));
+    DXThrowIfFailed(hr, "failed to create D3D12 descriptor heap for sampler feedback map");
+    D3D12SetObjectName(feedbackDescHeap_.Get(), "LLGL::D3D12Texture::feedbackDescHeap");
+
+    device8->CreateSamplerFeedbackUnorderedAccessView(pairedTexture_->GetNative(), GetNative(), feedbackDescHeap_->GetCPUDescriptorHandleForHeapStart());
+}
+
+void D3D12Texture::CreateSamplerFeedbackDecodeTexture(ID3D12Device* device, const Extent3D& mipRegion)
+{
+    /* Decoded feedback has one R8_UINT texel per MIP region; MIP-map levels smaller than a single region cannot be decoded */
+    const Extent3D decodeExtent = GetSamplerFeedbackExtent(Extent3D{ extent_.width, extent_.height, 1 }, mipRegion);
+
+    TextureDescriptor decodeDesc;
+    {
+        decodeDesc.debugName    = "LLGL::D3D12Texture::feedbackDecodeTexture";
+        decodeDesc.type         = TextureType::Texture2DArray;
+        decodeDesc.bindFlags    = BindFlags::CopySrc;
+        decodeDesc.miscFlags    = 0;
+        decodeDesc.format       = Format::R8UInt;
+        decodeDesc.extent       = decodeExtent;
+        decodeDesc.arrayLayers  = numArrayLayers_;
+        decodeDesc.mipLevels    = std::min(numMipLevels_, NumMipLevels(decodeExtent.width, decodeExtent.height));
+    }
+    feedbackDecodeTexture_ = MakeUnique<D3D12Texture>(device, decodeDesc);
+}
+
+#endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+void D3D12Texture::CreateSamplerFeedbackUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle)
+{
+    #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+    ComPtr<ID3D12Device8> device8;
+    if (SUCCEEDED(device->QueryInterface(IID_PPV_ARGS(device8.GetAddressOf()))))
+        device8->CreateSamplerFeedbackUnorderedAccessView(pairedTexture_->GetNative(), GetNative(), cpuDescHandle);
+    #endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+}
+
 void D3D12Texture::CreateMipDescHeap(ID3D12Device* device)
 {
     /* Create descriptor heap for all MIP-map levels */
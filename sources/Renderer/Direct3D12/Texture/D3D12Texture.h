@@ -11,7 +11,11 @@
 
 #include <LLGL/Texture.h>
 #include "../D3D12Resource.h"
+#include "../D3D12MemoryAllocator.h"
+#include "../D3D12Types.h"
+#include "D3D12SparseTextureMemory.h"
 #include <vector>
+#include <memory>
 
 
 namespace LLGL
@@ -35,7 +39,25 @@ class D3D12Texture final : public Texture
 
     public:
 
-        D3D12Texture(ID3D12Device* device, const TextureDescriptor& desc);
+        // Creates a committed resource, or a placed resource within the specified heap at the specified offset if 'placementHeap' is non-null.
+        // Textures with MiscFlags::Shared are created in their own shared heap, or opened from 'importHandle' if it is non-null.
+        D3D12Texture(
+            ID3D12Device*               device,
+            const TextureDescriptor&    desc,
+            ID3D12Heap*                 placementHeap   = nullptr,
+            UINT64                      placementOffset = 0,
+            HANDLE                      importHandle    = nullptr
+        );
+
+        #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+        // Creates a sampler feedback map that is paired with the texture of the specified descriptor.
+        D3D12Texture(ID3D12Device* device, const SamplerFeedbackDescriptor& desc);
+
+        #endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+        // Returns the size and alignment a texture with the specified descriptor requires when it is placed into a heap.
+        static D3D12_RESOURCE_ALLOCATION_INFO QueryResourceAllocationInfo(ID3D12Device* device, const TextureDescriptor& desc);
 
         // Updates the specified subresource, i.e. a single MIP-map level but one or more array layers.
         void UpdateSubresource(
@@ -150,9 +172,40 @@ class D3D12Texture final : public Texture
             return mipDescHeap_.Get();
         }
 
+        // Returns the tile pool if this texture was created as reserved resource with MiscFlags::Sparse, or null otherwise.
+        inline D3D12SparseTextureMemory* GetSparseMemory() const
+        {
+            return sparseMemory_.get();
+        }
+
+        // Returns true if this texture was created with MiscFlags::GPUConversion.
+        inline bool HasGPUConversion() const
+        {
+            return gpuConversion_;
+        }
+
+        // Returns the paired texture if this is a sampler feedback map, or null otherwise.
+        inline D3D12Texture* GetPairedTexture() const
+        {
+            return pairedTexture_;
+        }
+
+        // Returns the R8_UINT texture that sampler feedback is decoded into, or null if this is not a sampler feedback map.
+        inline D3D12Texture* GetFeedbackDecodeTexture() const
+        {
+            return feedbackDecodeTexture_.get();
+        }
+
+        // Returns the non-shader-visible descriptor heap with the UAV to clear this sampler feedback map, or null if this is not a sampler feedback map.
+        inline ID3D12DescriptorHeap* GetFeedbackDescHeap() const
+        {
+            return feedbackDescHeap_.Get();
+        }
+
     private:
 
-        void CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc);
+        void CreateNativeTexture(ID3D12Device* device, const TextureDescriptor& desc, ID3D12Heap* placementHeap, UINT64 placementOffset, HANDLE importHandle);
+        void CreateReservedTexture(ID3D12Device* device, D3D12_RESOURCE_DESC& descD3D, const TextureDescriptor& desc);
 
         void CreateShaderResourceViewPrimary(
             ID3D12Device*               device,
@@ -173,8 +226,19 @@ class D3D12Texture final : public Texture
 
         void CreateMipDescHeap(ID3D12Device* device);
 
+        #if LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+        void CreateSamplerFeedbackMap(ID3D12Device* device, const Extent3D& mipRegion);
+        void CreateSamplerFeedbackDecodeTexture(ID3D12Device* device, const Extent3D& mipRegion);
+
+        #endif // /LLGL_D3D12_ENABLE_SAMPLER_FEEDBACK
+
+        // Creates the UAV of this sampler feedback map, which is always bound to the entire paired texture.
+        void CreateSamplerFeedbackUnorderedAccessView(ID3D12Device* device, D3D12_CPU_DESCRIPTOR_HANDLE cpuDescHandle);
+
     private:
 
+        D3D12MemoryAllocation           allocation_;    // Must be declared before resource_ to outlive it
         D3D12Resource                   resource_;
 
         Format                          baseFormat_     = Format::Undefined;
@@ -182,9 +246,16 @@ class D3D12Texture final : public Texture
         UINT                            numMipLevels_   = 0;
         UINT                            numArrayLayers_ = 0;
         Extent3D                        extent_;
+        bool                            gpuConversion_  = false;        // Image data is converted with D3D12ImageConverter
 
         ComPtr<ID3D12DescriptorHeap>    mipDescHeap_;
 
+        std::unique_ptr<D3D12SparseTextureMemory> sparseMemory_;
+
+        D3D12Texture*                   pairedTexture_  = nullptr;      // Paired texture if this is a sampler feedback map
+        std::unique_ptr<D3D12Texture>   feedbackDecodeTexture_;         // R8_UINT texture sampler feedback is decoded into
+        ComPtr<ID3D12DescriptorHeap>    feedbackDescHeap_;              // Non-shader-visible UAV to clear sampler feedback
+
 };
 
 
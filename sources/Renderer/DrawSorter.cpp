@@ -0,0 +1,244 @@
+/*
+ * DrawSorter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/DrawSorter.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/ThreadPool.h>
+#include <LLGL/Utils/ForRange.h>
+#include "../Core/Threading.h"
+#include "../Core/Assertion.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Minimum number of packets each sorting job processes, so small sets of draw calls are not distributed to the worker threads.
+static constexpr std::size_t g_minPacketsPerSortJob = 4096;
+
+// Number of bits that are sorted in each radix sort pass.
+static constexpr unsigned g_radixBits = 8;
+static constexpr unsigned g_radixSize = (1u << g_radixBits);
+
+// Returns the index of the last element with the same address within the specified array, or appends the new element.
+template <typename T>
+static std::uint32_t FindOrAppendBinding(std::vector<T*>& bindings, T* binding)
+{
+    if (binding == nullptr)
+        return LLGL_INVALID_SLOT;
+    if (bindings.empty() || bindings.back() != binding)
+        bindings.push_back(binding);
+    return static_cast<std::uint32_t>(bindings.size() - 1);
+}
+
+std::uint64_t DrawSorter::MakeSortKey(std::uint32_t pipelineID, std::uint32_t resourceHeapID, std::uint32_t vertexBufferID)
+{
+    return
+    (
+        (static_cast<std::uint64_t>(pipelineID     & 0x000FFFFFu) << 44) |
+        (static_cast<std::uint64_t>(resourceHeapID & 0x000FFFFFu) << 24) |
+        (static_cast<std::uint64_t>(vertexBufferID & 0x00FFFFFFu)      )
+    );
+}
+
+void DrawSorter::Reserve(std::size_t numPackets)
+{
+    packets_.reserve(numPackets);
+}
+
+void DrawSorter::Add(const DrawPacket& packet)
+{
+    LLGL_ASSERT_PTR(packet.pipelineState);
+    packets_.push_back(packet);
+    sorted_ = false;
+}
+
+void DrawSorter::Clear()
+{
+    packets_.clear();
+    sorted_ = true;
+}
+
+void DrawSorter::Sort()
+{
+    if (sorted_)
+        return;
+
+    sorted_ = true;
+
+    const std::size_t numPackets = packets_.size();
+    if (numPackets < 2)
+        return;
+
+    LLGL_ASSERT(numPackets <= UINT32_MAX, "too many draw packets to sort");
+
+    /* Split packets into equally sized chunks, one per job; each job keeps its chunk throughout all passes for the sort to remain stable */
+    const std::size_t numJobs = std::max<std::size_t>(1, std::min<std::size_t>(ThreadPool::GetNumThreads() + 1, numPackets / g_minPacketsPerSortJob));
+
+    auto GetChunkBegin = [numPackets, numJobs](std::size_t jobIndex) -> std::size_t
+    {
+        return (numPackets * jobIndex) / numJobs;
+    };
+
+    /* Gather sort keys and determine which bits differ across all packets, so passes over constant bytes can be skipped */
+    entries_[0].resize(numPackets);
+    entries_[1].resize(numPackets);
+
+    const std::uint64_t firstKey    = packets_[0].sortKey;
+    std::uint64_t       varyingBits = 0;
+
+    for_range(i, numPackets)
+    {
+        const std::uint64_t key = packets_[i].sortKey;
+        entries_[0][i] = SortEntry{ key, static_cast<std::uint32_t>(i) };
+        varyingBits |= (key ^ firstKey);
+    }
+
+    /* Least significant digit radix sort; each pass counts digits per chunk, then scatters each chunk into its own offsets */
+    histograms_.resize(numJobs * g_radixSize);
+
+    std::vector<SortEntry>* src = &entries_[0];
+    std::vector<SortEntry>* dst = &entries_[1];
+
+    for (unsigned shift = 0; shift < 64; shift += g_radixBits)
+    {
+        if (((varyingBits >> shift) & (g_radixSize - 1)) == 0)
+            continue;
+
+        std::fill(histograms_.begin(), histograms_.end(), 0u);
+
+        DispatchConcurrentJobs(
+            numJobs,
+            [this, src, shift, &GetChunkBegin](std::size_t jobIndex)
+            {
+                std::uint32_t* histogram = &histograms_[jobIndex * g_radixSize];
+                for_subrange(i, GetChunkBegin(jobIndex), GetChunkBegin(jobIndex + 1))
+                    ++histogram[((*src)[i].key >> shift) & (g_radixSize - 1)];
+            }
+        );
+
+        /* Convert counts into exclusive offsets in digit-major order, so lower chunks precede higher chunks within each digit */
+        std::uint32_t offset = 0;
+        for_range(digit, g_radixSize)
+        {
+            for_range(jobIndex, numJobs)
+            {
+                std::uint32_t& count = histograms_[jobIndex * g_radixSize + digit];
+                const std::uint32_t n = count;
+                count = offset;
+                offset += n;
+            }
+        }
+
+        DispatchConcurrentJobs(
+            numJobs,
+            [this, src, dst, shift, &GetChunkBegin](std::size_t jobIndex)
+            {
+                std::uint32_t* offsets = &histograms_[jobIndex * g_radixSize];
+                for_subrange(i, GetChunkBegin(jobIndex), GetChunkBegin(jobIndex + 1))
+                {
+                    const SortEntry& entry = (*src)[i];
+                    (*dst)[offsets[(entry.key >> shift) & (g_radixSize - 1)]++] = entry;
+                }
+            }
+        );
+
+        std::swap(src, dst);
+    }
+
+    /* Reorder packets by the sorted indices */
+    sortedPackets_.resize(numPackets);
+
+    DispatchConcurrentJobs(
+        numJobs,
+        [this, src, &GetChunkBegin](std::size_t jobIndex)
+        {
+            for_subrange(i, GetChunkBegin(jobIndex), GetChunkBegin(jobIndex + 1))
+                sortedPackets_[i] = packets_[(*src)[i].index];
+        }
+    );
+
+    packets_.swap(sortedPackets_);
+}
+
+void DrawSorter::Submit(CommandBuffer& cmdBuffer)
+{
+    Sort();
+
+    PipelineState*  pipelineState   = nullptr;
+    bool            indexed         = false;
+    Format          indexFormat     = Format::R32UInt;
+
+    for (const DrawPacket& packet : packets_)
+    {
+        const bool packetIndexed = (packet.indexBuffer != nullptr);
+
+        /* Flush accumulated draw records whenever the PSO or the index format changes, since those can't be expressed in a packed draw record */
+        if (packet.pipelineState != pipelineState || packetIndexed != indexed || (packetIndexed && packet.indexFormat != indexFormat))
+        {
+            FlushRecords(cmdBuffer, indexed, indexFormat);
+            if (packet.pipelineState != pipelineState)
+            {
+                cmdBuffer.SetPipelineState(*packet.pipelineState);
+                pipelineState = packet.pipelineState;
+            }
+            indexed     = packetIndexed;
+            indexFormat = packet.indexFormat;
+        }
+
+        DrawRecord record;
+        {
+            record.vertexBuffer     = FindOrAppendBinding(vertexBuffers_, packet.vertexBuffer);
+            record.indexBuffer      = FindOrAppendBinding(indexBuffers_, packet.indexBuffer);
+            record.resourceHeap     = FindOrAppendBinding(resourceHeaps_, packet.resourceHeap);
+            record.descriptorSet    = packet.descriptorSet;
+            record.numVertices      = packet.numVertices;
+            record.numInstances     = packet.numInstances;
+            record.firstVertex      = packet.firstVertex;
+            record.vertexOffset     = packet.vertexOffset;
+            record.firstInstance    = packet.firstInstance;
+        }
+        records_.push_back(record);
+    }
+
+    FlushRecords(cmdBuffer, indexed, indexFormat);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void DrawSorter::FlushRecords(CommandBuffer& cmdBuffer, bool indexed, Format indexFormat)
+{
+    if (records_.empty())
+        return;
+
+    DrawPackedDescriptor drawDesc;
+    {
+        drawDesc.vertexBuffers  = vertexBuffers_;
+        drawDesc.indexBuffers   = indexBuffers_;
+        drawDesc.indexFormat    = indexFormat;
+        drawDesc.resourceHeaps  = resourceHeaps_;
+        drawDesc.indexed        = indexed;
+        drawDesc.records        = records_;
+    }
+    cmdBuffer.DrawPacked(drawDesc);
+
+    vertexBuffers_.clear();
+    indexBuffers_.clear();
+    resourceHeaps_.clear();
+    records_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,26 @@
+/*
+ * Fence.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Fence.h>
+
+
+namespace LLGL
+{
+
+
+bool Fence::GetNativeHandle(void* /*nativeHandle*/, std::size_t /*nativeHandleSize*/)
+{
+    /* Fences are not exposed by default */
+    return false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,458 @@
+/*
+ * FormatTable.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FORMAT_TABLE_H
+#define LLGL_FORMAT_TABLE_H
+
+
+#include <LLGL/Format.h>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+/*
+Header-visible counterpart of the exported format utility functions in <LLGL/Format.h>.
+All queries are constexpr and inlined, so they fold at compile time for constant formats and avoid a cross-module call in inner loops otherwise.
+*/
+namespace FormatTable
+{
+
+
+namespace Detail
+{
+
+
+
+
+// Shortcuts for the format flags
+static constexpr long Depth         = FormatFlags::HasDepth;
+static constexpr long sRGB          = FormatFlags::IsColorSpace_sRGB;
+static constexpr long Compr         = FormatFlags::IsCompressed;
+static constexpr long Norm          = FormatFlags::IsNormalized;
+static constexpr long Integer       = FormatFlags::IsInteger;
+static constexpr long Unsigned      = FormatFlags::IsUnsigned;
+static constexpr long Packed        = FormatFlags::IsPacked;
+static constexpr long RTV           = FormatFlags::SupportsRenderTarget;
+static constexpr long Mips          = FormatFlags::SupportsMips;
+static constexpr long GenMips       = FormatFlags::SupportsGenerateMips | Mips | RTV;
+static constexpr long Dim1D         = FormatFlags::SupportsTexture1D;
+static constexpr long Dim2D         = FormatFlags::SupportsTexture2D;
+static constexpr long Dim3D         = FormatFlags::SupportsTexture3D;
+static constexpr long DimCube       = FormatFlags::SupportsTextureCube;
+static constexpr long Vertex        = FormatFlags::SupportsVertex;
+
+static constexpr long Dim1D_2D      = Dim1D | Dim2D;
+static constexpr long Dim2D_3D      = Dim2D | Dim3D;
+static constexpr long Dim1D_2D_3D   = Dim1D | Dim2D | Dim3D;
+static constexpr long SInt          = Integer;
+static constexpr long UInt          = Integer | Unsigned;
+static constexpr long SNorm         = Norm;
+static constexpr long UNorm         = Unsigned | Norm;
+static constexpr long SFloat        = 0;
+static constexpr long UFloat        = Unsigned;
+
+static constexpr long Stencil       = FormatFlags::HasStencil | UInt;
+
+// Declaration of all hardware format descriptors
+static constexpr FormatAttributes g_formatAttribs[] =
+{
+//   bits  w  h  c  format                     dataType
+    {   0, 0, 0, 0, ImageFormat::R,            DataType::Undefined, 0                                                          }, // Undefined
+
+    /* --- Alpha channel color formats --- */
+//   bits  w  h  c  format                     dataType
+    {   8, 1, 1, 1, ImageFormat::Alpha,        DataType::UInt8,     GenMips | Dim1D_2D_3D | DimCube | UNorm                    }, // A8UNorm
+
+    /* --- Red channel color formats --- */
+//   bits  w  h  c  format                     dataType
+    {   8, 1, 1, 1, ImageFormat::R,            DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // R8UNorm
+    {   8, 1, 1, 1, ImageFormat::R,            DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // R8SNorm
+    {   8, 1, 1, 1, ImageFormat::R,            DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // R8UInt
+    {   8, 1, 1, 1, ImageFormat::R,            DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // R8SInt
+
+    {  16, 1, 1, 1, ImageFormat::R,            DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // R16UNorm
+    {  16, 1, 1, 1, ImageFormat::R,            DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SNorm           }, // R16SNorm
+    {  16, 1, 1, 1, ImageFormat::R,            DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // R16UInt
+    {  16, 1, 1, 1, ImageFormat::R,            DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // R16SInt
+    {  16, 1, 1, 1, ImageFormat::R,            DataType::Float16,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // R16Float
+
+    {  32, 1, 1, 1, ImageFormat::R,            DataType::UInt32,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // R32UInt
+    {  32, 1, 1, 1, ImageFormat::R,            DataType::Int32,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // R32SInt
+    {  32, 1, 1, 1, ImageFormat::R,            DataType::Float32,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // R32Float
+
+    {  64, 1, 1, 1, ImageFormat::R,            DataType::Float64,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // R64Float
+
+    /* --- RG color formats --- */
+//   bits  w  h  c  format                     dataType
+    {  16, 1, 1, 2, ImageFormat::RG,           DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // RG8UNorm
+    {  16, 1, 1, 2, ImageFormat::RG,           DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | SNorm           }, // RG8SNorm
+    {  16, 1, 1, 2, ImageFormat::RG,           DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RG8UInt
+    {  16, 1, 1, 2, ImageFormat::RG,           DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RG8SInt
+
+    {  32, 1, 1, 2, ImageFormat::RG,           DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // RG16UNorm
+    {  32, 1, 1, 2, ImageFormat::RG,           DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SNorm           }, // RG16SNorm
+    {  32, 1, 1, 2, ImageFormat::RG,           DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RG16UInt
+    {  32, 1, 1, 2, ImageFormat::RG,           DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RG16SInt
+    {  32, 1, 1, 2, ImageFormat::RG,           DataType::Float16,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RG16Float
+
+    {  64, 1, 1, 2, ImageFormat::RG,           DataType::UInt32,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RG32UInt
+    {  64, 1, 1, 2, ImageFormat::RG,           DataType::Int32,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RG32SInt
+    {  64, 1, 1, 2, ImageFormat::RG,           DataType::Float32,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RG32Float
+
+    { 128, 1, 1, 2, ImageFormat::RG,           DataType::Float64,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RG64Float
+
+    /* --- RGB color formats --- */
+//   bits  w  h  c  format                     dataType
+    {  24, 1, 1, 3, ImageFormat::RGB,          DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // RGB8UNorm
+    {  24, 1, 1, 3, ImageFormat::RGB,          DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm | sRGB    }, // RGB8UNorm_sRGB
+    {  24, 1, 1, 3, ImageFormat::RGB,          DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | SNorm           }, // RGB8SNorm
+    {  24, 1, 1, 3, ImageFormat::RGB,          DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RGB8UInt
+    {  24, 1, 1, 3, ImageFormat::RGB,          DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RGB8SInt
+
+    {  48, 1, 1, 3, ImageFormat::RGB,          DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // RGB16UNorm
+    {  48, 1, 1, 3, ImageFormat::RGB,          DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SNorm           }, // RGB16SNorm
+    {  48, 1, 1, 3, ImageFormat::RGB,          DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RGB16UInt
+    {  48, 1, 1, 3, ImageFormat::RGB,          DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RGB16SInt
+    {  48, 1, 1, 3, ImageFormat::RGB,          DataType::Float16,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RGB16Float
+
+    {  96, 1, 1, 3, ImageFormat::RGB,          DataType::UInt32,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RGB32UInt
+    {  96, 1, 1, 3, ImageFormat::RGB,          DataType::Int32,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RGB32SInt
+    {  96, 1, 1, 3, ImageFormat::RGB,          DataType::Float32,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RGB32Float
+
+    { 192, 1, 1, 3, ImageFormat::RGB,          DataType::Float64,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RGB64Float
+
+    /* --- RGBA color formats --- */
+//   bits  w  h  c  format                     dataType
+    {  32, 1, 1, 4, ImageFormat::RGBA,         DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // RGBA8UNorm
+    {  32, 1, 1, 4, ImageFormat::RGBA,         DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm | sRGB    }, // RGBA8UNorm_sRGB
+    {  32, 1, 1, 4, ImageFormat::RGBA,         DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | SNorm           }, // RGBA8SNorm
+    {  32, 1, 1, 4, ImageFormat::RGBA,         DataType::UInt8,     Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RGBA8UInt
+    {  32, 1, 1, 4, ImageFormat::RGBA,         DataType::Int8,      Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RGBA8SInt
+
+    {  64, 1, 1, 4, ImageFormat::RGBA,         DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UNorm           }, // RGBA16UNorm
+    {  64, 1, 1, 4, ImageFormat::RGBA,         DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SNorm           }, // RGBA16SNorm
+    {  64, 1, 1, 4, ImageFormat::RGBA,         DataType::UInt16,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RGBA16UInt
+    {  64, 1, 1, 4, ImageFormat::RGBA,         DataType::Int16,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RGBA16SInt
+    {  64, 1, 1, 4, ImageFormat::RGBA,         DataType::Float16,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RGBA16Float
+
+    { 128, 1, 1, 4, ImageFormat::RGBA,         DataType::UInt32,    Vertex | GenMips | Dim1D_2D_3D | DimCube | UInt            }, // RGBA32UInt
+    { 128, 1, 1, 4, ImageFormat::RGBA,         DataType::Int32,     Vertex | GenMips | Dim1D_2D_3D | DimCube | SInt            }, // RGBA32SInt
+    { 128, 1, 1, 4, ImageFormat::RGBA,         DataType::Float32,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RGBA32Float
+
+    { 256, 1, 1, 4, ImageFormat::RGBA,         DataType::Float64,   Vertex | GenMips | Dim1D_2D_3D | DimCube | SFloat          }, // RGBA64Float
+
+    /* --- BGRA color formats --- */
+//   bits  w  h  c  format                     dataType
+    {  32, 1, 1, 4, ImageFormat::BGRA,         DataType::UInt8,     GenMips | Dim1D_2D_3D | DimCube | UNorm                    }, // BGRA8UNorm
+    {  32, 1, 1, 4, ImageFormat::BGRA,         DataType::UInt8,     GenMips | Dim1D_2D_3D | DimCube | UNorm | sRGB             }, // BGRA8UNorm_sRGB
+    {  32, 1, 1, 4, ImageFormat::BGRA,         DataType::Int8,      GenMips | Dim1D_2D_3D | DimCube | SNorm                    }, // BGRA8SNorm
+    {  32, 1, 1, 4, ImageFormat::BGRA,         DataType::UInt8,     GenMips | Dim1D_2D_3D | DimCube | UInt                     }, // BGRA8UInt
+    {  32, 1, 1, 4, ImageFormat::BGRA,         DataType::Int8,      GenMips | Dim1D_2D_3D | DimCube | SInt                     }, // BGRA8SInt
+
+    /* --- Packed formats --- */
+//   bits  w  h  c  format                     dataType
+    {  32, 1, 1, 4, ImageFormat::RGBA,         DataType::Undefined, GenMips | Dim1D_2D_3D | DimCube | UNorm  | Packed          }, // RGB10A2UNorm
+    {  32, 1, 1, 4, ImageFormat::RGBA,         DataType::Undefined, GenMips | Dim1D_2D_3D | DimCube | UInt   | Packed          }, // RGB10A2UInt
+    {  32, 1, 1, 3, ImageFormat::RGB,          DataType::Undefined, GenMips | Dim1D_2D_3D | DimCube | UFloat | Packed          }, // RG11B10Float
+    {  32, 1, 1, 3, ImageFormat::RGB,          DataType::Undefined, Mips    | Dim1D_2D_3D | DimCube | UFloat | Packed          }, // RGB9E5Float
+
+    /* --- Depth-stencil formats --- */
+//   bits  w  h  c  format                     dataType
+    {  16, 1, 1, 1, ImageFormat::Depth,        DataType::UInt16,    Mips | RTV | Dim1D_2D | DimCube | UNorm  | Depth           }, // D16UNorm
+    {  32, 1, 1, 2, ImageFormat::DepthStencil, DataType::UInt32,    Mips | RTV | Dim1D_2D | DimCube | UNorm  | Depth | Stencil }, // D24UNormS8UInt
+    {  32, 1, 1, 1, ImageFormat::Depth,        DataType::Float32,   Mips | RTV | Dim1D_2D | DimCube | SFloat | Depth           }, // D32Float
+    {  64, 1, 1, 2, ImageFormat::DepthStencil, DataType::Float32,   Mips | RTV | Dim1D_2D | DimCube | SFloat | Depth | Stencil }, // D32FloatS8X24UInt
+  //{   8, 1, 1, 1, ImageFormat::Stencil,      DataType::UInt8,     Mips | RTV | Dim1D_2D | DimCube | UInt   | Stencil         }, // S8UInt
+
+    /* --- Block compression (BC) formats --- */
+//   bits  w  h  c  format                     dataType
+    {  64, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // BC1UNorm
+    {  64, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // BC1UNorm_sRGB
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // BC2UNorm
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // BC2UNorm_sRGB
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // BC3UNorm
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // BC3UNorm_sRGB
+    {  64, 4, 4, 1, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // BC4UNorm
+    {  64, 4, 4, 1, ImageFormat::Compressed,   DataType::Int8,      Mips | Dim2D_3D | DimCube | Compr | SNorm                  }, // BC4SNorm
+    { 128, 4, 4, 2, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // BC5UNorm
+    { 128, 4, 4, 2, ImageFormat::Compressed,   DataType::Int8,      Mips | Dim2D_3D | DimCube | Compr | SNorm                  }, // BC5SNorm
+    { 128, 4, 4, 3, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | UFloat                 }, // BC6HUFloat
+    { 128, 4, 4, 3, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // BC6HSFloat
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // BC7UNorm
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // BC7UNorm_sRGB
+
+    /* --- Advanced scalable texture compression (ASTC) formats --- */
+//   bits  w  h  c  format                     dataType
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC4x4
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC4x4_sRGB
+    { 128, 5, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC5x4
+    { 128, 5, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC5x4_sRGB
+    { 128, 5, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC5x5
+    { 128, 5, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC5x5_sRGB
+    { 128, 6, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC6x5
+    { 128, 6, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC6x5_sRGB
+    { 128, 6, 6, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC6x6
+    { 128, 6, 6, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC6x6_sRGB
+    { 128, 8, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC8x5
+    { 128, 8, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC8x5_sRGB
+    { 128, 8, 6, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC8x6
+    { 128, 8, 6, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC8x6_sRGB
+    { 128, 8, 8, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC8x8
+    { 128, 8, 8, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC8x8_sRGB
+    { 128,10, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC10x5
+    { 128,10, 5, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC10x5_sRGB
+    { 128,10, 6, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC10x6
+    { 128,10, 6, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC10x6_sRGB
+    { 128,10, 8, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC10x8
+    { 128,10, 8, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC10x8_sRGB
+    { 128,10,10, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC10x10
+    { 128,10,10, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC10x10_sRGB
+    { 128,12,10, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC12x10
+    { 128,12,10, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC12x10_sRGB
+    { 128,12,12, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ASTC12x12
+    { 128,12,12, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ASTC12x12_sRGB
+
+    /* --- Ericsson texture compression (ETC) formats --- */
+//   bits  w  h  c  format                     dataType
+    {  64, 4, 4, 3, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ETC1UNorm
+    {  64, 4, 4, 3, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ETC2UNorm
+    {  64, 4, 4, 3, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ETC2UNorm_sRGB
+    {  64, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ETC2A1UNorm
+    {  64, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ETC2A1UNorm_sRGB
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // ETC2A8UNorm
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::UInt8,     Mips | Dim2D_3D | DimCube | Compr | UNorm | sRGB           }, // ETC2A8UNorm_sRGB
+    {  64, 4, 4, 1, ImageFormat::Compressed,   DataType::UInt16,    Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // EACR11UNorm
+    {  64, 4, 4, 1, ImageFormat::Compressed,   DataType::Int16,     Mips | Dim2D_3D | DimCube | Compr | SNorm                  }, // EACR11SNorm
+    { 128, 4, 4, 2, ImageFormat::Compressed,   DataType::UInt16,    Mips | Dim2D_3D | DimCube | Compr | UNorm                  }, // EACRG11UNorm
+    { 128, 4, 4, 2, ImageFormat::Compressed,   DataType::Int16,     Mips | Dim2D_3D | DimCube | Compr | SNorm                  }, // EACRG11SNorm
+
+    /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+//   bits  w  h  c  format                     dataType
+    { 128, 4, 4, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC4x4Float
+    { 128, 5, 4, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC5x4Float
+    { 128, 5, 5, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC5x5Float
+    { 128, 6, 5, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC6x5Float
+    { 128, 6, 6, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC6x6Float
+    { 128, 8, 5, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC8x5Float
+    { 128, 8, 6, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC8x6Float
+    { 128, 8, 8, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC8x8Float
+    { 128,10, 5, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC10x5Float
+    { 128,10, 6, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC10x6Float
+    { 128,10, 8, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC10x8Float
+    { 128,10,10, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC10x10Float
+    { 128,12,10, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC12x10Float
+    { 128,12,12, 4, ImageFormat::Compressed,   DataType::Float16,   Mips | Dim2D_3D | DimCube | Compr | SFloat                 }, // ASTC12x12Float
+};
+
+
+// Number of bytes per component for each DataType entry
+static constexpr std::uint8_t g_dataTypeSizes[] =
+{
+    0, // Undefined
+    1, // Int8
+    1, // UInt8
+    2, // Int16
+    2, // UInt16
+    4, // Int32
+    4, // UInt32
+    2, // Float16
+    4, // Float32
+    8, // Float64
+};
+
+// Number of components for each ImageFormat entry
+static constexpr std::uint8_t g_imageFormatSizes[] =
+{
+    1, // Alpha
+    1, // R
+    2, // RG
+    3, // RGB
+    3, // BGR
+    4, // RGBA
+    4, // BGRA
+    4, // ARGB
+    4, // ABGR
+    1, // Depth
+    2, // DepthStencil
+    1, // Stencil
+    0, // Compressed
+    0, // BC1
+    0, // BC2
+    0, // BC3
+    0, // BC4
+    0, // BC5
+};
+
+static constexpr std::size_t g_numFormatAttribs     = sizeof(g_formatAttribs) / sizeof(g_formatAttribs[0]);
+static constexpr std::size_t g_numDataTypeSizes     = sizeof(g_dataTypeSizes) / sizeof(g_dataTypeSizes[0]);
+static constexpr std::size_t g_numImageFormatSizes  = sizeof(g_imageFormatSizes) / sizeof(g_imageFormatSizes[0]);
+
+static_assert(g_numFormatAttribs    == static_cast<std::size_t>(Format::ASTC12x12Float) + 1,    "g_formatAttribs must have one entry for each LLGL::Format");
+static_assert(g_numDataTypeSizes    == static_cast<std::size_t>(DataType::Float64) + 1,         "g_dataTypeSizes must have one entry for each LLGL::DataType");
+static_assert(g_numImageFormatSizes == static_cast<std::size_t>(ImageFormat::BC5) + 1,          "g_imageFormatSizes must have one entry for each LLGL::ImageFormat");
+
+
+} // /namespace Detail
+
+
+/* ----- Functions ----- */
+
+// Returns the attributes for the specified hardware format or the attributes of Format::Undefined for an invalid argument. See LLGL::GetFormatAttribs.
+constexpr const FormatAttributes& GetAttribs(Format format)
+{
+    return
+    (
+        static_cast<std::size_t>(format) < Detail::g_numFormatAttribs
+            ? Detail::g_formatAttribs[static_cast<std::size_t>(format)]
+            : Detail::g_formatAttribs[0]
+    );
+}
+
+// Returns true if the specified hardware format has any of the specified FormatFlags.
+constexpr bool HasAnyFlags(Format format, long flags)
+{
+    return ((FormatTable::GetAttribs(format).flags & flags) != 0);
+}
+
+// Returns true if the specified hardware format has all of the specified FormatFlags.
+constexpr bool HasAllFlags(Format format, long flags)
+{
+    return ((FormatTable::GetAttribs(format).flags & flags) == flags);
+}
+
+// See LLGL::IsCompressedFormat.
+constexpr bool IsCompressedFormat(Format format)
+{
+    return FormatTable::HasAnyFlags(format, FormatFlags::IsCompressed);
+}
+
+// See LLGL::IsDepthOrStencilFormat.
+constexpr bool IsDepthOrStencilFormat(Format format)
+{
+    return FormatTable::HasAnyFlags(format, FormatFlags::HasDepth | FormatFlags::HasStencil);
+}
+
+// See LLGL::IsDepthOrStencilFormat(ImageFormat).
+constexpr bool IsDepthOrStencilFormat(ImageFormat imageFormat)
+{
+    return (imageFormat == ImageFormat::Depth || imageFormat == ImageFormat::DepthStencil || imageFormat == ImageFormat::Stencil);
+}
+
+// See LLGL::IsDepthAndStencilFormat.
+constexpr bool IsDepthAndStencilFormat(Format format)
+{
+    return FormatTable::HasAllFlags(format, FormatFlags::HasDepth | FormatFlags::HasStencil);
+}
+
+// See LLGL::IsDepthFormat.
+constexpr bool IsDepthFormat(Format format)
+{
+    return FormatTable::HasAnyFlags(format, FormatFlags::HasDepth);
+}
+
+// See LLGL::IsStencilFormat.
+constexpr bool IsStencilFormat(Format format)
+{
+    return FormatTable::HasAnyFlags(format, FormatFlags::HasStencil);
+}
+
+// See LLGL::IsColorFormat.
+constexpr bool IsColorFormat(Format format)
+{
+    return (format != Format::Undefined && !FormatTable::IsDepthOrStencilFormat(format));
+}
+
+// See LLGL::IsNormalizedFormat.
+constexpr bool IsNormalizedFormat(Format format)
+{
+    return FormatTable::HasAnyFlags(format, FormatFlags::IsNormalized);
+}
+
+// See LLGL::IsIntegerFormat.
+constexpr bool IsIntegerFormat(Format format)
+{
+    return FormatTable::HasAnyFlags(format, FormatFlags::IsInteger);
+}
+
+// See LLGL::IsFloatFormat.
+constexpr bool IsFloatFormat(Format format)
+{
+    return !FormatTable::IsIntegerFormat(format);
+}
+
+// Returns the memory footprint of the specified number of texels for a format with the specified bit size per block and number of texels per block.
+constexpr std::size_t GetBlockMemoryFootprint(std::size_t bitSize, std::size_t blockSize, std::size_t numTexels)
+{
+    return (blockSize > 0 && numTexels % blockSize == 0 ? (numTexels / blockSize * bitSize) / 8 : 0);
+}
+
+// Returns the memory footprint of the specified number of texels for the specified format attributes.
+constexpr std::size_t GetAttribsMemoryFootprint(const FormatAttributes& formatAttribs, std::size_t numTexels)
+{
+    return FormatTable::GetBlockMemoryFootprint(formatAttribs.bitSize, formatAttribs.blockWidth * formatAttribs.blockHeight, numTexels);
+}
+
+// See LLGL::GetMemoryFootprint(Format, std::size_t).
+constexpr std::size_t GetMemoryFootprint(Format format, std::size_t numTexels)
+{
+    return FormatTable::GetAttribsMemoryFootprint(FormatTable::GetAttribs(format), numTexels);
+}
+
+// See LLGL::DataTypeSize.
+constexpr std::uint32_t DataTypeSize(DataType dataType)
+{
+    return
+    (
+        static_cast<std::size_t>(dataType) < Detail::g_numDataTypeSizes
+            ? Detail::g_dataTypeSizes[static_cast<std::size_t>(dataType)]
+            : 0
+    );
+}
+
+// See LLGL::ImageFormatSize.
+constexpr std::uint32_t ImageFormatSize(ImageFormat imageFormat)
+{
+    return
+    (
+        static_cast<std::size_t>(imageFormat) < Detail::g_numImageFormatSizes
+            ? Detail::g_imageFormatSizes[static_cast<std::size_t>(imageFormat)]
+            : 0
+    );
+}
+
+// Returns the number of bytes per pixel for the specified image format and data type. Depth-stencil formats are packed for UInt32 (D24S8) and Float32 (D32 with 32-bit stencil).
+constexpr std::uint32_t GetBytesPerPixel(ImageFormat imageFormat, DataType dataType)
+{
+    return
+    (
+        imageFormat == ImageFormat::DepthStencil && dataType == DataType::UInt32
+            ? 4
+            : imageFormat == ImageFormat::DepthStencil && dataType == DataType::Float32
+                ? 8
+                : FormatTable::ImageFormatSize(imageFormat) * FormatTable::DataTypeSize(dataType)
+    );
+}
+
+// See LLGL::GetMemoryFootprint(ImageFormat, DataType, std::size_t).
+constexpr std::size_t GetMemoryFootprint(ImageFormat imageFormat, DataType dataType, std::size_t numTexels)
+{
+    return (static_cast<std::size_t>(FormatTable::GetBytesPerPixel(imageFormat, dataType)) * numTexels);
+}
+
+
+} // /namespace FormatTable
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,126 @@
+/*
+ * FrameArena.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "FrameArena.h"
+#include "../Core/CoreUtils.h"
+#include "../Core/Assertion.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+// Minimum size of each chunk (in bytes); most encoding paths never exceed the first chunk.
+static constexpr std::size_t g_minFrameArenaChunkSize = 64 * 1024;
+
+void* FrameArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    if (chunkIdx_ < chunks_.size())
+    {
+        Chunk& chunk = chunks_[chunkIdx_];
+        const std::size_t offset = GetAlignedSize(chunkOffset_, alignment);
+        if (offset + size <= chunk.size)
+        {
+            chunkOffset_ = offset + size;
+            ++numLiveAllocations_;
+            return (chunk.data.get() + offset);
+        }
+    }
+    return AllocateInNextChunk(size, alignment);
+}
+
+void FrameArena::Deallocate(void* ptr, std::size_t size)
+{
+    if (ptr == nullptr)
+        return;
+
+    LLGL_ASSERT(numLiveAllocations_ > 0, "frame arena deallocation without matching allocation");
+    if (--numLiveAllocations_ == 0)
+    {
+        /* Rewind entirely once all allocations have been released */
+        Rewind();
+    }
+    else if (chunkIdx_ < chunks_.size())
+    {
+        /* Move pointer back if this was the most recent allocation */
+        char* chunkData = chunks_[chunkIdx_].data.get();
+        char* bytes     = static_cast<char*>(ptr);
+        if (bytes >= chunkData && bytes + size == chunkData + chunkOffset_)
+            chunkOffset_ = static_cast<std::size_t>(bytes - chunkData);
+    }
+}
+
+void FrameArena::Reset()
+{
+    if (numLiveAllocations_ > 0)
+        return;
+
+    /* Merge all chunks into one so the next recording fits into a single chunk */
+    if (chunks_.size() > 1)
+    {
+        std::size_t totalSize = 0;
+        for (const Chunk& chunk : chunks_)
+            totalSize += chunk.size;
+
+        chunks_.clear();
+        chunks_.resize(1);
+        chunks_.front().data = std::unique_ptr<char[]>{ new char[totalSize] };
+        chunks_.front().size = totalSize;
+    }
+
+    Rewind();
+}
+
+FrameArena& FrameArena::Get()
+{
+    static thread_local FrameArena arena;
+    return arena;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void* FrameArena::AllocateInNextChunk(std::size_t size, std::size_t alignment)
+{
+    /* Move to the next chunk that is large enough or append a new one */
+    if (!chunks_.empty())
+        ++chunkIdx_;
+
+    while (chunkIdx_ < chunks_.size() && chunks_[chunkIdx_].size < size)
+        ++chunkIdx_;
+
+    if (chunkIdx_ == chunks_.size())
+    {
+        Chunk chunk;
+        {
+            chunk.size = std::max(g_minFrameArenaChunkSize, GetAlignedSize(size, alignment));
+            chunk.data = std::unique_ptr<char[]>{ new char[chunk.size] };
+        }
+        chunks_.push_back(std::move(chunk));
+    }
+
+    /* Chunks start at the maximum fundamental alignment, so the first allocation is always aligned */
+    chunkOffset_ = size;
+    ++numLiveAllocations_;
+    return chunks_[chunkIdx_].data.get();
+}
+
+void FrameArena::Rewind()
+{
+    chunkIdx_       = 0;
+    chunkOffset_    = 0;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
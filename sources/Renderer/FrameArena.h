@@ -0,0 +1,140 @@
+/*
+ * FrameArena.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_ARENA_H
+#define LLGL_FRAME_ARENA_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Container/SmallVector.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Per-thread linear allocator for transient scratch memory in command encoding paths.
+Allocations are pointer bumps within the current chunk; releasing the most recent allocation moves the pointer back,
+and the arena rewinds entirely whenever all allocations have been released.
+Backends call Reset() in CommandBuffer::Begin() to consolidate the chunks that were required during the previous recording into a single one.
+Only use this for temporaries that are released before the function that allocated them returns.
+*/
+class LLGL_EXPORT FrameArena
+{
+
+    public:
+
+        FrameArena() = default;
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator = (const FrameArena&) = delete;
+
+        // Allocates the specified number of bytes with the specified alignment. The alignment must not be larger than alignof(std::max_align_t).
+        void* Allocate(std::size_t size, std::size_t alignment);
+
+        // Releases an allocation from this arena. The memory is only reused immediately if this was the most recent allocation.
+        void Deallocate(void* ptr, std::size_t size);
+
+        // Rewinds this arena and merges all chunks into one. This has no effect while there are still allocations in use.
+        void Reset();
+
+        // Returns the number of allocations that have not been released yet.
+        inline std::size_t GetNumLiveAllocations() const
+        {
+            return numLiveAllocations_;
+        }
+
+    public:
+
+        // Returns the frame arena of the calling thread.
+        static FrameArena& Get();
+
+    private:
+
+        struct Chunk
+        {
+            std::unique_ptr<char[]> data;
+            std::size_t             size = 0;
+        };
+
+    private:
+
+        void* AllocateInNextChunk(std::size_t size, std::size_t alignment);
+
+        void Rewind();
+
+    private:
+
+        std::vector<Chunk>  chunks_;
+        std::size_t         chunkIdx_           = 0;
+        std::size_t         chunkOffset_        = 0;
+        std::size_t         numLiveAllocations_ = 0;
+
+};
+
+// Allocator that is compatible with std::allocator and allocates from the frame arena of the calling thread.
+template <typename T>
+class FrameArenaAllocator
+{
+
+    public:
+
+        using value_type = T;
+
+        FrameArenaAllocator() = default;
+
+        template <typename U>
+        FrameArenaAllocator(const FrameArenaAllocator<U>&)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(FrameArena::Get().Allocate(n * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* ptr, std::size_t n)
+        {
+            FrameArena::Get().Deallocate(ptr, n * sizeof(T));
+        }
+
+        template <typename U>
+        bool operator == (const FrameArenaAllocator<U>&) const
+        {
+            return true;
+        }
+
+        template <typename U>
+        bool operator != (const FrameArenaAllocator<U>&) const
+        {
+            return false;
+        }
+
+};
+
+// SmallVector that allocates from the frame arena once it exceeds its local capacity.
+template <typename T, std::size_t LocalCapacity = 16>
+using FrameSmallVector = SmallVector<T, LocalCapacity, FrameArenaAllocator<T>>;
+
+// DynamicArray that allocates from the frame arena.
+template <typename T>
+using FrameDynamicArray = DynamicArray<T, FrameArenaAllocator<T>>;
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
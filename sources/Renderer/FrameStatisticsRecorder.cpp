@@ -0,0 +1,134 @@
+/*
+ * FrameStatisticsRecorder.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "FrameStatisticsRecorder.h"
+#include <LLGL/Timer.h>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+
+namespace LLGL
+{
+
+
+FrameStatisticsRecorder::FrameStatisticsRecorder(std::uint32_t windowSize) :
+    windowSize_       { windowSize                                          },
+    ticksToMillisecs_ { 1000.0 / static_cast<double>(Timer::Frequency())   }
+{
+}
+
+void FrameStatisticsRecorder::BeginStall()
+{
+    stallStartTick_ = Timer::Tick();
+}
+
+void FrameStatisticsRecorder::EndStall(bool presented)
+{
+    const std::uint64_t currentTick = Timer::Tick();
+    frameStallTicks_ += (currentTick - stallStartTick_);
+
+    if (presented)
+    {
+        /* Record intervals only once a previous presentation is known */
+        if (numFrames_ > 0)
+        {
+            const double presentInterval    = TicksToMillisecs(currentTick - lastPresentTick_);
+            const double queueStallTime     = std::min(TicksToMillisecs(frameStallTicks_), presentInterval);
+            presentIntervals_.Push(presentInterval, windowSize_);
+            queueStallTimes_.Push(queueStallTime, windowSize_);
+            cpuFrameTimes_.Push(presentInterval - queueStallTime, windowSize_);
+        }
+
+        ++numFrames_;
+        lastPresentTick_ = currentTick;
+        frameStallTicks_ = 0;
+    }
+}
+
+void FrameStatisticsRecorder::RecordDisplayTime(std::uint64_t presentCount, std::uint64_t timeInNanosecs)
+{
+    /* Ignore presentations that have already been recorded or time stamps that are not monotonic */
+    if (presentCount <= lastPresentCount_ || timeInNanosecs <= lastDisplayTime_)
+        return;
+
+    if (lastDisplayTime_ > 0)
+    {
+        /* Distribute interval evenly across skipped presentations */
+        const std::uint64_t numPresents = presentCount - lastPresentCount_;
+        const double        interval    = static_cast<double>(timeInNanosecs - lastDisplayTime_) / 1000000.0 / static_cast<double>(numPresents);
+        for (std::uint64_t i = 0, n = std::min<std::uint64_t>(numPresents, windowSize_); i < n; ++i)
+            displayFrameTimes_.Push(interval, windowSize_);
+    }
+
+    lastPresentCount_   = presentCount;
+    lastDisplayTime_    = timeInNanosecs;
+}
+
+void FrameStatisticsRecorder::GetStatistics(FrameStatistics& outStatistics) const
+{
+    outStatistics.numFrames     = numFrames_;
+    outStatistics.numSamples    = static_cast<std::uint32_t>(presentIntervals_.Size());
+    cpuFrameTimes_.Compute(outStatistics.cpuFrameTime);
+    displayFrameTimes_.Compute(outStatistics.displayFrameTime);
+    presentIntervals_.Compute(outStatistics.presentInterval);
+    queueStallTimes_.Compute(outStatistics.queueStallTime);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+double FrameStatisticsRecorder::TicksToMillisecs(std::uint64_t ticks) const
+{
+    return static_cast<double>(ticks) * ticksToMillisecs_;
+}
+
+void FrameStatisticsRecorder::SampleRing::Push(double value, std::size_t windowSize)
+{
+    if (samples_.size() < windowSize)
+        samples_.push_back(value);
+    else
+        samples_[next_] = value;
+    next_ = (next_ + 1) % windowSize;
+    last_ = value;
+}
+
+// Returns the percentile of the sorted samples using the nearest-rank method.
+static double GetPercentile(const std::vector<double>& sortedSamples, double percentile)
+{
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(percentile * static_cast<double>(sortedSamples.size())));
+    return sortedSamples[std::max<std::size_t>(rank, 1) - 1];
+}
+
+void FrameStatisticsRecorder::SampleRing::Compute(FrameTimeStatistics& outStatistics) const
+{
+    if (samples_.empty())
+    {
+        outStatistics = FrameTimeStatistics{};
+        return;
+    }
+
+    std::vector<double> sortedSamples = samples_;
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+
+    const double average = std::accumulate(sortedSamples.begin(), sortedSamples.end(), 0.0) / static_cast<double>(sortedSamples.size());
+
+    outStatistics.last      = static_cast<float>(last_);
+    outStatistics.average   = static_cast<float>(average);
+    outStatistics.p50       = static_cast<float>(GetPercentile(sortedSamples, 0.50));
+    outStatistics.p95       = static_cast<float>(GetPercentile(sortedSamples, 0.95));
+    outStatistics.p99       = static_cast<float>(GetPercentile(sortedSamples, 0.99));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,97 @@
+/*
+ * FrameStatisticsRecorder.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_FRAME_STATISTICS_RECORDER_H
+#define LLGL_FRAME_STATISTICS_RECORDER_H
+
+
+#include <LLGL/SwapChainFlags.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Records frame timings of a swap-chain into ring buffers and computes rolling percentiles on demand.
+class FrameStatisticsRecorder
+{
+
+    public:
+
+        FrameStatisticsRecorder(std::uint32_t windowSize);
+
+        // Starts measuring a blocking call, i.e. SwapChain::Present or SwapChain::WaitForNextFrame.
+        void BeginStall();
+
+        // Ends measuring a blocking call. If 'presented' is true, the current frame is recorded.
+        void EndStall(bool presented);
+
+        // Records the display time stamp (in nanoseconds) of the specified presentation.
+        void RecordDisplayTime(std::uint64_t presentCount, std::uint64_t timeInNanosecs);
+
+        // Computes the statistics over all frames in the current window.
+        void GetStatistics(FrameStatistics& outStatistics) const;
+
+    private:
+
+        // Ring buffer of recent samples for a single metric.
+        class SampleRing
+        {
+
+            public:
+
+                void Push(double value, std::size_t windowSize);
+                void Compute(FrameTimeStatistics& outStatistics) const;
+
+                inline std::size_t Size() const
+                {
+                    return samples_.size();
+                }
+
+            private:
+
+                std::vector<double> samples_;
+                std::size_t         next_       = 0;
+                double              last_       = 0.0;
+
+        };
+
+    private:
+
+        double TicksToMillisecs(std::uint64_t ticks) const;
+
+    private:
+
+        std::size_t     windowSize_         = 0;
+        double          ticksToMillisecs_   = 0.0;
+
+        SampleRing      cpuFrameTimes_;
+        SampleRing      displayFrameTimes_;
+        SampleRing      presentIntervals_;
+        SampleRing      queueStallTimes_;
+
+        std::uint64_t   numFrames_          = 0;
+        std::uint64_t   stallStartTick_     = 0;
+        std::uint64_t   frameStallTicks_    = 0;
+        std::uint64_t   lastPresentTick_    = 0;
+
+        std::uint64_t   lastPresentCount_   = 0;
+        std::uint64_t   lastDisplayTime_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
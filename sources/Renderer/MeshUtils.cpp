@@ -0,0 +1,801 @@
+/*
+ * MeshUtils.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/MeshUtils.h>
+#include <LLGL/Container/DynamicArray.h>
+#include <LLGL/Utils/ForRange.h>
+#include "FormatTable.h"
+#include "../Core/Threading.h"
+#include "../Core/Assertion.h"
+#include "../Core/CoreUtils.h"
+#include "../Core/Float16Compressor.h"
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstring>
+
+
+namespace LLGL
+{
+
+
+/* ----- Common ----- */
+
+static constexpr std::uint32_t g_invalidIndex = ~0u;
+
+static void ValidateTriangleList(std::size_t numIndices, Format indexFormat)
+{
+    LLGL_ASSERT(numIndices % 3 == 0, "number of indices (%zu) must be a multiple of 3 for triangle lists", numIndices);
+    LLGL_ASSERT(indexFormat == Format::R16UInt || indexFormat == Format::R32UInt, "index format must be R16UInt or R32UInt");
+}
+
+// Reads all indices of the specified format into a 32-bit index array.
+static std::vector<std::uint32_t> ReadIndices(const void* indices, std::size_t numIndices, Format indexFormat)
+{
+    std::vector<std::uint32_t> output(numIndices);
+    if (indexFormat == Format::R16UInt)
+    {
+        const std::uint16_t* indices16 = static_cast<const std::uint16_t*>(indices);
+        std::copy(indices16, indices16 + numIndices, output.begin());
+    }
+    else
+        std::memcpy(output.data(), indices, numIndices * sizeof(std::uint32_t));
+    return output;
+}
+
+// Writes the specified 32-bit indices back into the index array with the specified format.
+static void WriteIndices(void* indices, const std::vector<std::uint32_t>& input, Format indexFormat)
+{
+    if (indexFormat == Format::R16UInt)
+    {
+        std::uint16_t* indices16 = static_cast<std::uint16_t*>(indices);
+        for_range(i, input.size())
+            indices16[i] = static_cast<std::uint16_t>(input[i]);
+    }
+    else
+        std::memcpy(indices, input.data(), input.size() * sizeof(std::uint32_t));
+}
+
+// FIFO cache simulation that only stores the time stamp of each vertex: a vertex is in the cache if fewer than 'cacheSize' misses occurred since it was inserted.
+class VertexCacheFIFO
+{
+
+    public:
+
+        VertexCacheFIFO(std::size_t numVertices, std::uint32_t cacheSize) :
+            timeStamps_ ( numVertices, 0u ),
+            cacheSize_  { cacheSize       },
+            time_       { cacheSize + 1u  }
+        {
+        }
+
+        // Returns true if the specified vertex was a cache miss and inserts it into the cache.
+        bool Insert(std::uint32_t vertex)
+        {
+            if (time_ - timeStamps_[vertex] > cacheSize_)
+            {
+                timeStamps_[vertex] = time_++;
+                return true;
+            }
+            return false;
+        }
+
+    private:
+
+        std::vector<std::uint32_t>  timeStamps_;
+        std::uint32_t               cacheSize_  = 0;
+        std::uint32_t               time_       = 0;
+
+};
+
+static std::size_t GetMaxIndexCount(const std::vector<std::uint32_t>& indices)
+{
+    return (indices.empty() ? 0 : static_cast<std::size_t>(*std::max_element(indices.begin(), indices.end())) + 1);
+}
+
+
+/* ----- Vertex cache optimization ----- */
+
+// Number of triangles per batch that is optimized independently. Batches are fixed in size, so the result does not depend on the number of threads.
+static constexpr std::size_t     g_vertexCacheBatchSize     = 0x10000;
+
+// Size of the simulated LRU cache and the maximum valence that has a dedicated score.
+static constexpr std::uint32_t   g_vertexCacheSizeLRU       = 32;
+static constexpr std::uint32_t   g_vertexCacheMaxValence    = 32;
+
+struct VertexCacheScoreTable
+{
+    VertexCacheScoreTable()
+    {
+        /* The three most recent vertices are scored equally, since they are used by the last triangle */
+        for_range(i, g_vertexCacheSizeLRU)
+        {
+            if (i < 3)
+                cachePosition[i] = 0.75f;
+            else
+                cachePosition[i] = std::pow(1.0f - static_cast<float>(i - 3) / static_cast<float>(g_vertexCacheSizeLRU - 3), 1.5f);
+        }
+
+        /* Boost vertices with few remaining triangles to avoid leaving isolated triangles behind */
+        valence[0] = 0.0f;
+        for_subrange(i, 1, g_vertexCacheMaxValence)
+            valence[i] = 2.0f / std::sqrt(static_cast<float>(i));
+    }
+
+    float GetScore(std::uint32_t cachePos, std::uint32_t numRemainingTriangles) const
+    {
+        if (numRemainingTriangles == 0)
+            return -1.0f;
+        const float cacheScore      = (cachePos < g_vertexCacheSizeLRU ? cachePosition[cachePos] : 0.0f);
+        const float valenceScore    = valence[std::min(numRemainingTriangles, g_vertexCacheMaxValence - 1)];
+        return (cacheScore + valenceScore);
+    }
+
+    float cachePosition[g_vertexCacheSizeLRU];
+    float valence[g_vertexCacheMaxValence];
+};
+
+static const VertexCacheScoreTable& GetVertexCacheScoreTable()
+{
+    static const VertexCacheScoreTable g_scoreTable;
+    return g_scoreTable;
+}
+
+// Optimizes a batch of triangles whose indices are in the range [0, numVertices) and writes the reordered triangles to 'outIndices'.
+static void OptimizeVertexCacheBatch(
+    const std::uint32_t*    indices,
+    std::size_t             numTriangles,
+    std::size_t             numVertices,
+    std::uint32_t*          outIndices)
+{
+    const VertexCacheScoreTable& scoreTable = GetVertexCacheScoreTable();
+
+    /* Build adjacency from vertices to triangles */
+    std::vector<std::uint32_t> numVertexTriangles(numVertices, 0u);
+    for_range(i, numTriangles * 3)
+        ++numVertexTriangles[indices[i]];
+
+    std::vector<std::uint32_t> vertexTrianglesOffsets(numVertices + 1, 0u);
+    for_range(v, numVertices)
+        vertexTrianglesOffsets[v + 1] = vertexTrianglesOffsets[v] + numVertexTriangles[v];
+
+    std::vector<std::uint32_t> vertexTriangles(numTriangles * 3);
+    {
+        std::vector<std::uint32_t> vertexTrianglesCursors(vertexTrianglesOffsets.begin(), vertexTrianglesOffsets.end() - 1);
+        for_range(t, numTriangles)
+        {
+            for_range(j, 3)
+                vertexTriangles[vertexTrianglesCursors[indices[t*3 + j]]++] = static_cast<std::uint32_t>(t);
+        }
+    }
+
+    /* Initialize scores; numVertexTriangles is reused as the number of remaining triangles per vertex */
+    std::vector<std::uint32_t>  vertexCachePos(numVertices, g_vertexCacheSizeLRU);
+    std::vector<float>          vertexScores(numVertices);
+    for_range(v, numVertices)
+        vertexScores[v] = scoreTable.GetScore(g_vertexCacheSizeLRU, numVertexTriangles[v]);
+
+    std::vector<float>  triangleScores(numTriangles);
+    std::vector<bool>   triangleEmitted(numTriangles, false);
+
+    std::uint32_t   bestTriangle        = g_invalidIndex;
+    float           bestTriangleScore   = -1.0f;
+    for_range(t, numTriangles)
+    {
+        triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+        if (triangleScores[t] > bestTriangleScore)
+        {
+            bestTriangle        = static_cast<std::uint32_t>(t);
+            bestTriangleScore   = triangleScores[t];
+        }
+    }
+
+    /* Simulated LRU cache with room for the vertices that are pushed out by the next triangle */
+    std::uint32_t   cache[g_vertexCacheSizeLRU + 3];
+    std::uint32_t   cacheSize                           = 0;
+    std::uint32_t   newCache[g_vertexCacheSizeLRU + 3];
+    std::size_t     nextTriangleCursor                  = 0;
+
+    for_range(n, numTriangles)
+    {
+        if (bestTriangle == g_invalidIndex)
+        {
+            /* No triangle is adjacent to the cache, so continue with the next triangle in the original order */
+            while (triangleEmitted[nextTriangleCursor])
+                ++nextTriangleCursor;
+            bestTriangle = static_cast<std::uint32_t>(nextTriangleCursor);
+        }
+
+        /* Emit best triangle and remove it from the adjacency of its vertices */
+        const std::uint32_t* tri = &indices[bestTriangle * 3];
+        outIndices[n*3    ] = tri[0];
+        outIndices[n*3 + 1] = tri[1];
+        outIndices[n*3 + 2] = tri[2];
+        triangleEmitted[bestTriangle] = true;
+
+        for_range(j, 3)
+        {
+            const std::uint32_t v       = tri[j];
+            std::uint32_t*      first   = &vertexTriangles[vertexTrianglesOffsets[v]];
+            std::uint32_t*      last    = first + numVertexTriangles[v];
+            std::uint32_t*      it      = std::find(first, last, bestTriangle);
+            std::swap(*it, *(last - 1));
+            --numVertexTriangles[v];
+        }
+
+        /* Move the vertices of the emitted triangle to the front of the cache */
+        std::uint32_t newCacheSize = 0;
+        for_range(j, 3)
+            newCache[newCacheSize++] = tri[j];
+
+        for_range(i, cacheSize)
+        {
+            const std::uint32_t v = cache[i];
+            if (v != tri[0] && v != tri[1] && v != tri[2])
+                newCache[newCacheSize++] = v;
+        }
+
+        /* Update scores for all vertices in the cache, including those that have just been pushed out */
+        for_range(i, newCacheSize)
+        {
+            const std::uint32_t v = newCache[i];
+            vertexCachePos[v]   = (i < g_vertexCacheSizeLRU ? static_cast<std::uint32_t>(i) : g_vertexCacheSizeLRU);
+            vertexScores[v]     = scoreTable.GetScore(vertexCachePos[v], numVertexTriangles[v]);
+        }
+
+        cacheSize = std::min(newCacheSize, g_vertexCacheSizeLRU);
+        std::copy(newCache, newCache + cacheSize, cache);
+
+        /* Find best triangle among those that are adjacent to the cache */
+        bestTriangle        = g_invalidIndex;
+        bestTriangleScore   = -1.0f;
+
+        for_range(i, cacheSize)
+        {
+            const std::uint32_t v = cache[i];
+            for_range(k, numVertexTriangles[v])
+            {
+                const std::uint32_t t = vertexTriangles[vertexTrianglesOffsets[v] + k];
+                triangleScores[t] = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+                if (triangleScores[t] > bestTriangleScore)
+                {
+                    bestTriangle        = t;
+                    bestTriangleScore   = triangleScores[t];
+                }
+            }
+        }
+    }
+}
+
+// Optimizes the batch of triangles with global vertex indices by remapping them to a compact range first.
+static void OptimizeVertexCacheGlobalBatch(std::uint32_t* indices, std::size_t numTriangles)
+{
+    const std::size_t numIndices = numTriangles * 3;
+
+    /* Remap vertex indices to local range */
+    std::vector<std::uint32_t> uniqueIndices(indices, indices + numIndices);
+    std::sort(uniqueIndices.begin(), uniqueIndices.end());
+    uniqueIndices.erase(std::unique(uniqueIndices.begin(), uniqueIndices.end()), uniqueIndices.end());
+
+    std::vector<std::uint32_t> localIndices(numIndices);
+    for_range(i, numIndices)
+        localIndices[i] = static_cast<std::uint32_t>(std::lower_bound(uniqueIndices.begin(), uniqueIndices.end(), indices[i]) - uniqueIndices.begin());
+
+    /* Optimize with local indices and map back to global indices */
+    std::vector<std::uint32_t> optimizedIndices(numIndices);
+    OptimizeVertexCacheBatch(localIndices.data(), numTriangles, uniqueIndices.size(), optimizedIndices.data());
+
+    for_range(i, numIndices)
+        indices[i] = uniqueIndices[optimizedIndices[i]];
+}
+
+LLGL_EXPORT float GetVertexCacheMissRatio(
+    const void*     indices,
+    std::size_t     numIndices,
+    Format          indexFormat,
+    std::uint32_t   cacheSize)
+{
+    ValidateTriangleList(numIndices, indexFormat);
+    LLGL_ASSERT(cacheSize > 0, "vertex cache size must be greater than zero");
+
+    if (numIndices == 0)
+        return 0.0f;
+
+    const std::vector<std::uint32_t> indices32 = ReadIndices(indices, numIndices, indexFormat);
+
+    VertexCacheFIFO cache{ GetMaxIndexCount(indices32), cacheSize };
+    std::size_t numMisses = 0;
+    for (std::uint32_t index : indices32)
+    {
+        if (cache.Insert(index))
+            ++numMisses;
+    }
+
+    return (static_cast<float>(numMisses) / static_cast<float>(numIndices / 3));
+}
+
+LLGL_EXPORT void OptimizeVertexCache(
+    void*           indices,
+    std::size_t     numIndices,
+    Format          indexFormat,
+    unsigned        threadCount)
+{
+    ValidateTriangleList(numIndices, indexFormat);
+
+    if (numIndices == 0)
+        return;
+
+    std::vector<std::uint32_t> indices32 = ReadIndices(indices, numIndices, indexFormat);
+
+    const std::size_t numTriangles  = numIndices / 3;
+    const std::size_t numBatches    = DivideRoundUp(numTriangles, g_vertexCacheBatchSize);
+
+    DoConcurrent(
+        [&indices32, numTriangles](std::size_t batchIndex)
+        {
+            const std::size_t firstTriangle = batchIndex * g_vertexCacheBatchSize;
+            const std::size_t batchSize     = std::min(g_vertexCacheBatchSize, numTriangles - firstTriangle);
+            OptimizeVertexCacheGlobalBatch(&indices32[firstTriangle * 3], batchSize);
+        },
+        numBatches,
+        threadCount,
+        1
+    );
+
+    WriteIndices(indices, indices32, indexFormat);
+}
+
+
+/* ----- Overdraw optimization ----- */
+
+// Size of the FIFO cache that is simulated to find the cluster boundaries.
+static constexpr std::uint32_t g_overdrawCacheSize = 16;
+
+struct TriangleCluster
+{
+    std::size_t firstTriangle   = 0;
+    std::size_t numTriangles    = 0;
+    float       centroid[3]     = { 0.0f, 0.0f, 0.0f }; // Area weighted sum of triangle centroids
+    float       normal[3]       = { 0.0f, 0.0f, 0.0f }; // Sum of unnormalized triangle normals
+    float       area            = 0.0f;
+    float       sortKey         = 0.0f;
+};
+
+static const float* GetVertexPosition(const void* positions, std::size_t positionStride, std::uint32_t index)
+{
+    return reinterpret_cast<const float*>(static_cast<const char*>(positions) + positionStride * index);
+}
+
+static void AccumulateClusterGeometry(
+    TriangleCluster&                    cluster,
+    const std::vector<std::uint32_t>&   indices,
+    const void*                         positions,
+    std::size_t                         positionStride)
+{
+    for_subrange(t, cluster.firstTriangle, cluster.firstTriangle + cluster.numTriangles)
+    {
+        const float* p0 = GetVertexPosition(positions, positionStride, indices[t*3    ]);
+        const float* p1 = GetVertexPosition(positions, positionStride, indices[t*3 + 1]);
+        const float* p2 = GetVertexPosition(positions, positionStride, indices[t*3 + 2]);
+
+        const float e1[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+        const float e2[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+        const float n[3]  =
+        {
+            e1[1]*e2[2] - e1[2]*e2[1],
+            e1[2]*e2[0] - e1[0]*e2[2],
+            e1[0]*e2[1] - e1[1]*e2[0],
+        };
+        const float area = std::sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]) * 0.5f;
+
+        for_range(i, 3)
+        {
+            cluster.centroid[i] += (p0[i] + p1[i] + p2[i]) * (area / 3.0f);
+            cluster.normal[i]   += n[i];
+        }
+        cluster.area += area;
+    }
+}
+
+LLGL_EXPORT void OptimizeOverdraw(
+    void*           indices,
+    std::size_t     numIndices,
+    Format          indexFormat,
+    const void*     positions,
+    std::size_t     numVertices,
+    std::size_t     positionStride,
+    unsigned        threadCount)
+{
+    ValidateTriangleList(numIndices, indexFormat);
+    LLGL_ASSERT_PTR(positions);
+
+    if (numIndices == 0)
+        return;
+
+    const std::vector<std::uint32_t> indices32 = ReadIndices(indices, numIndices, indexFormat);
+    LLGL_ASSERT(GetMaxIndexCount(indices32) <= numVertices, "vertex index out of bounds");
+
+    /* Split triangles into clusters where the vertex cache is effectively flushed */
+    const std::size_t numTriangles = numIndices / 3;
+    std::vector<TriangleCluster> clusters;
+    {
+        VertexCacheFIFO cache{ numVertices, g_overdrawCacheSize };
+        for_range(t, numTriangles)
+        {
+            const bool miss0 = cache.Insert(indices32[t*3    ]);
+            const bool miss1 = cache.Insert(indices32[t*3 + 1]);
+            const bool miss2 = cache.Insert(indices32[t*3 + 2]);
+            if (clusters.empty() || (miss0 && miss1 && miss2))
+            {
+                clusters.push_back({});
+                clusters.back().firstTriangle = t;
+            }
+            ++clusters.back().numTriangles;
+        }
+    }
+
+    if (clusters.size() < 2)
+        return;
+
+    /* Accumulate cluster geometry concurrently */
+    DoConcurrent(
+        [&clusters, &indices32, positions, positionStride](std::size_t clusterIndex)
+        {
+            AccumulateClusterGeometry(clusters[clusterIndex], indices32, positions, positionStride);
+        },
+        clusters.size(),
+        threadCount,
+        64
+    );
+
+    /* Determine mesh center as area weighted average of all clusters */
+    float meshCenter[3] = { 0.0f, 0.0f, 0.0f };
+    float meshArea      = 0.0f;
+    for (const TriangleCluster& cluster : clusters)
+    {
+        for_range(i, 3)
+            meshCenter[i] += cluster.centroid[i];
+        meshArea += cluster.area;
+    }
+    if (meshArea > 0.0f)
+    {
+        for_range(i, 3)
+            meshCenter[i] /= meshArea;
+    }
+
+    /* Sort clusters that face away from the center first, since they are more likely to occlude others */
+    for (TriangleCluster& cluster : clusters)
+    {
+        if (cluster.area > 0.0f)
+        {
+            const float normalLength = std::sqrt(cluster.normal[0]*cluster.normal[0] + cluster.normal[1]*cluster.normal[1] + cluster.normal[2]*cluster.normal[2]);
+            if (normalLength > 0.0f)
+            {
+                float key = 0.0f;
+                for_range(i, 3)
+                    key += (cluster.centroid[i] / cluster.area - meshCenter[i]) * cluster.normal[i];
+                cluster.sortKey = key / normalLength;
+            }
+        }
+    }
+
+    std::stable_sort(
+        clusters.begin(),
+        clusters.end(),
+        [](const TriangleCluster& lhs, const TriangleCluster& rhs) -> bool
+        {
+            return (lhs.sortKey > rhs.sortKey);
+        }
+    );
+
+    /* Write triangles in order of sorted clusters */
+    std::vector<std::uint32_t> sortedIndices;
+    sortedIndices.reserve(numIndices);
+    for (const TriangleCluster& cluster : clusters)
+    {
+        sortedIndices.insert(
+            sortedIndices.end(),
+            indices32.begin() + cluster.firstTriangle * 3,
+            indices32.begin() + (cluster.firstTriangle + cluster.numTriangles) * 3
+        );
+    }
+
+    WriteIndices(indices, sortedIndices, indexFormat);
+}
+
+
+/* ----- Vertex fetch optimization ----- */
+
+LLGL_EXPORT std::size_t OptimizeVertexFetch(
+    void*           vertices,
+    std::size_t     numVertices,
+    std::size_t     vertexStride,
+    void*           indices,
+    std::size_t     numIndices,
+    Format          indexFormat)
+{
+    LLGL_ASSERT_PTR(vertices);
+    LLGL_ASSERT(indexFormat == Format::R16UInt || indexFormat == Format::R32UInt, "index format must be R16UInt or R32UInt");
+
+    std::vector<std::uint32_t> indices32 = ReadIndices(indices, numIndices, indexFormat);
+
+    /* Assign new vertex indices in order of first reference */
+    std::vector<std::uint32_t> remap(numVertices, g_invalidIndex);
+    std::uint32_t numReferencedVertices = 0;
+
+    for (std::uint32_t& index : indices32)
+    {
+        LLGL_ASSERT(index < numVertices, "vertex index (%u) out of bounds (%zu)", index, numVertices);
+        if (remap[index] == g_invalidIndex)
+            remap[index] = numReferencedVertices++;
+        index = remap[index];
+    }
+
+    /* Move unreferenced vertices to the end */
+    std::uint32_t nextVertex = numReferencedVertices;
+    for (std::uint32_t& newIndex : remap)
+    {
+        if (newIndex == g_invalidIndex)
+            newIndex = nextVertex++;
+    }
+
+    /* Reorder vertices from a copy of the original vertex buffer */
+    const std::size_t   bufferSize      = numVertices * vertexStride;
+    DynamicByteArray    srcVertices     { bufferSize, UninitializeTag{} };
+    char*               dstVertices     = static_cast<char*>(vertices);
+
+    std::memcpy(srcVertices.get(), vertices, bufferSize);
+    for_range(v, numVertices)
+        std::memcpy(dstVertices + remap[v] * vertexStride, srcVertices.get() + v * vertexStride, vertexStride);
+
+    WriteIndices(indices, indices32, indexFormat);
+
+    return numReferencedVertices;
+}
+
+
+/* ----- Vertex quantization ----- */
+
+static VertexQuantization GetAttributeQuantization(const ArrayView<VertexQuantization>& quantizations, std::size_t attribIndex)
+{
+    return (attribIndex < quantizations.size() ? quantizations[attribIndex] : VertexQuantization::None);
+}
+
+// Returns the number of floating-point components of the specified format, or 0 if the format does not consist of 32-bit float components.
+static std::uint32_t GetFloat32ComponentCount(Format format)
+{
+    switch (format)
+    {
+        case Format::R32Float:      return 1;
+        case Format::RG32Float:     return 2;
+        case Format::RGB32Float:    return 3;
+        case Format::RGBA32Float:   return 4;
+        default:                    return 0;
+    }
+}
+
+static Format GetQuantizedFormat(VertexQuantization quantization, Format format)
+{
+    const std::uint32_t numComponents = GetFloat32ComponentCount(format);
+    LLGL_ASSERT(numComponents > 0, "vertex quantization requires 32-bit float attributes");
+
+    /* Three-component formats are padded to four components */
+    switch (quantization)
+    {
+        case VertexQuantization::None:
+            return format;
+
+        case VertexQuantization::SNorm16:
+            return (numComponents == 1 ? Format::R16SNorm : numComponents == 2 ? Format::RG16SNorm : Format::RGBA16SNorm);
+
+        case VertexQuantization::SNorm8:
+            return (numComponents == 1 ? Format::R8SNorm : numComponents == 2 ? Format::RG8SNorm : Format::RGBA8SNorm);
+
+        case VertexQuantization::Float16:
+            return (numComponents == 1 ? Format::R16Float : numComponents == 2 ? Format::RG16Float : Format::RGBA16Float);
+
+        case VertexQuantization::OctahedralSNorm16:
+            LLGL_ASSERT(numComponents >= 3, "octahedral vertex quantization requires at least three components");
+            return Format::RG16SNorm;
+
+        case VertexQuantization::OctahedralSNorm8:
+            LLGL_ASSERT(numComponents >= 3, "octahedral vertex quantization requires at least three components");
+            return Format::RG8SNorm;
+    }
+    return format;
+}
+
+LLGL_EXPORT VertexFormat GetQuantizedVertexFormat(
+    const VertexFormat&                     srcFormat,
+    const ArrayView<VertexQuantization>&    quantizations)
+{
+    VertexFormat dstFormat;
+    dstFormat.attributes.reserve(srcFormat.attributes.size());
+
+    std::uint32_t offset = 0;
+    for_range(i, srcFormat.attributes.size())
+    {
+        const VertexAttribute& srcAttrib = srcFormat.attributes[i];
+        LLGL_ASSERT(srcAttrib.slot == srcFormat.attributes.front().slot, "vertex quantization requires all attributes to be in the same buffer binding slot");
+
+        VertexAttribute dstAttrib = srcAttrib;
+        {
+            const VertexQuantization quantization = GetAttributeQuantization(quantizations, i);
+            if (quantization != VertexQuantization::None)
+                dstAttrib.format = GetQuantizedFormat(quantization, srcAttrib.format);
+            dstAttrib.offset = offset;
+        }
+        dstFormat.attributes.push_back(dstAttrib);
+        offset = GetAlignedSize(offset + dstAttrib.GetSize(), 4u);
+    }
+
+    dstFormat.SetStride(offset);
+
+    return dstFormat;
+}
+
+static float ClampSNorm(float value)
+{
+    return std::max(-1.0f, std::min(value, 1.0f));
+}
+
+static std::int16_t EncodeSNorm16(float value)
+{
+    return static_cast<std::int16_t>(std::lround(ClampSNorm(value) * 32767.0f));
+}
+
+static std::int8_t EncodeSNorm8(float value)
+{
+    return static_cast<std::int8_t>(std::lround(ClampSNorm(value) * 127.0f));
+}
+
+// Maps the specified unit vector onto the octahedron and unfolds the lower hemisphere into the outer triangles of the unit square.
+static void EncodeOctahedral(const float (&v)[4], float (&outCoords)[2])
+{
+    const float norm1   = std::abs(v[0]) + std::abs(v[1]) + std::abs(v[2]);
+    float       x       = (norm1 > 0.0f ? v[0] / norm1 : 0.0f);
+    float       y       = (norm1 > 0.0f ? v[1] / norm1 : 0.0f);
+    if (v[2] < 0.0f)
+    {
+        const float foldedX = (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float foldedY = (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = foldedX;
+        y = foldedY;
+    }
+    outCoords[0] = x;
+    outCoords[1] = y;
+}
+
+// Quantizes a single attribute of a single vertex.
+static void QuantizeVertexAttribute(
+    VertexQuantization  quantization,
+    std::uint32_t       numSrcComponents,
+    std::uint32_t       numDstComponents,
+    const char*         src,
+    char*               dst)
+{
+    float v[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    std::memcpy(v, src, sizeof(float) * numSrcComponents);
+
+    switch (quantization)
+    {
+        case VertexQuantization::None:
+            break;
+
+        case VertexQuantization::SNorm16:
+        {
+            std::int16_t encoded[4] = {};
+            for_range(i, numSrcComponents)
+                encoded[i] = EncodeSNorm16(v[i]);
+            std::memcpy(dst, encoded, sizeof(std::int16_t) * numDstComponents);
+        }
+        break;
+
+        case VertexQuantization::SNorm8:
+        {
+            std::int8_t encoded[4] = {};
+            for_range(i, numSrcComponents)
+                encoded[i] = EncodeSNorm8(v[i]);
+            std::memcpy(dst, encoded, sizeof(std::int8_t) * numDstComponents);
+        }
+        break;
+
+        case VertexQuantization::Float16:
+        {
+            std::uint16_t encoded[4] = {};
+            for_range(i, numSrcComponents)
+                encoded[i] = CompressFloat16(v[i]);
+            std::memcpy(dst, encoded, sizeof(std::uint16_t) * numDstComponents);
+        }
+        break;
+
+        case VertexQuantization::OctahedralSNorm16:
+        {
+            float coords[2];
+            EncodeOctahedral(v, coords);
+            const std::int16_t encoded[2] = { EncodeSNorm16(coords[0]), EncodeSNorm16(coords[1]) };
+            std::memcpy(dst, encoded, sizeof(encoded));
+        }
+        break;
+
+        case VertexQuantization::OctahedralSNorm8:
+        {
+            float coords[2];
+            EncodeOctahedral(v, coords);
+            const std::int8_t encoded[2] = { EncodeSNorm8(coords[0]), EncodeSNorm8(coords[1]) };
+            std::memcpy(dst, encoded, sizeof(encoded));
+        }
+        break;
+    }
+}
+
+LLGL_EXPORT VertexFormat QuantizeVertices(
+    const VertexFormat&                     srcFormat,
+    const void*                             srcVertices,
+    std::size_t                             numVertices,
+    const ArrayView<VertexQuantization>&    quantizations,
+    void*                                   dstVertices,
+    std::size_t                             dstSize,
+    unsigned                                threadCount)
+{
+    LLGL_ASSERT_PTR(srcVertices);
+    LLGL_ASSERT_PTR(dstVertices);
+
+    const VertexFormat  dstFormat   = GetQuantizedVertexFormat(srcFormat, quantizations);
+    const std::size_t   srcStride   = srcFormat.GetStride();
+    const std::size_t   dstStride   = dstFormat.GetStride();
+
+    LLGL_ASSERT(dstSize >= dstStride * numVertices, "destination buffer too small for quantized vertices (%zu < %zu)", dstSize, dstStride * numVertices);
+
+    DoConcurrentRange(
+        [&](std::size_t begin, std::size_t end)
+        {
+            const char* src = static_cast<const char*>(srcVertices) + begin * srcStride;
+            char*       dst = static_cast<char*>(dstVertices) + begin * dstStride;
+
+            /* Clear padding between attributes */
+            std::memset(dst, 0, (end - begin) * dstStride);
+
+            for_subrange(v, begin, end)
+            {
+                for_range(i, srcFormat.attributes.size())
+                {
+                    const VertexAttribute&      srcAttrib       = srcFormat.attributes[i];
+                    const VertexAttribute&      dstAttrib       = dstFormat.attributes[i];
+                    const VertexQuantization    quantization    = GetAttributeQuantization(quantizations, i);
+
+                    if (quantization == VertexQuantization::None)
+                        std::memcpy(dst + dstAttrib.offset, src + srcAttrib.offset, srcAttrib.GetSize());
+                    else
+                    {
+                        QuantizeVertexAttribute(
+                            quantization,
+                            GetFloat32ComponentCount(srcAttrib.format),
+                            FormatTable::GetAttribs(dstAttrib.format).components,
+                            src + srcAttrib.offset,
+                            dst + dstAttrib.offset
+                        );
+                    }
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        },
+        numVertices,
+        threadCount,
+        1024
+    );
+
+    return dstFormat;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
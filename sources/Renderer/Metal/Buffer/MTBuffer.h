@@ -19,6 +19,8 @@ namespace LLGL
 {
 
 
+class MTHeapAllocator;
+
 class MTBuffer final : public Buffer
 {
 
@@ -28,7 +30,8 @@ class MTBuffer final : public Buffer
 
     public:
 
-        MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData);
+        // Creates the native buffer and tries to sub-allocate it from the specified heap allocator first, if not null.
+        MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData, MTHeapAllocator* heapAllocator = nullptr);
         ~MTBuffer();
 
         void Write(NSUInteger offset, const void* data, NSUInteger dataSize);
@@ -50,10 +53,24 @@ class MTBuffer final : public Buffer
             return indexType16Bits_;
         }
 
+        // Returns true if this buffer was created with MiscFlags::PersistentMapping. Such buffers are always in shared storage mode.
+        inline bool IsPersistent() const
+        {
+            return isPersistent_;
+        }
+
+        // Returns true if Metal does not track hazards of this buffer, i.e. it was created with MiscFlags::Untracked.
+        inline bool IsUntracked() const
+        {
+            return isUntracked_;
+        }
+
     private:
 
         id<MTLBuffer>   native_             = nil;
         bool            indexType16Bits_    = false;
+        bool            isPersistent_       = false;
+        bool            isUntracked_        = false;
         #ifndef LLGL_OS_IOS
         bool            isManaged_          = false;
         #endif
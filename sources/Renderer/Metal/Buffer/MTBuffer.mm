@@ -6,6 +6,7 @@
  */
 
 #include "MTBuffer.h"
+#include "MTHeapAllocator.h"
 #include "../../ResourceUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Backend/Metal/NativeHandle.h>
@@ -16,34 +17,76 @@ namespace LLGL
 {
 
 
-static MTLResourceOptions GetMTLResourceOptions(const BufferDescriptor& desc)
+static MTLResourceOptions GetMTLResourceOptions(id<MTLDevice> device, const BufferDescriptor& desc)
 {
     #ifdef LLGL_OS_IOS
     return MTLResourceStorageModeShared;
     #else
-    if ((desc.miscFlags & MiscFlags::DynamicUsage) != 0)
+    if ((desc.miscFlags & (MiscFlags::DynamicUsage | MiscFlags::PersistentMapping)) != 0)
         return MTLResourceStorageModeShared;
     //else if ((desc.bindFlags & BindFlags::Storage) != 0)
     //    return MTLResourceStorageModePrivate;
-    else
-        return MTLResourceStorageModeManaged;
+    else if (@available(macOS 10.15, *))
+    {
+        /* Managed storage has no benefit on devices with unified memory, but it cannot be allocated from heaps */
+        if ([device hasUnifiedMemory])
+            return MTLResourceStorageModeShared;
+    }
+    return MTLResourceStorageModeManaged;
     #endif
 }
 
-MTBuffer::MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData) :
-    Buffer           { desc.bindFlags                   },
-    indexType16Bits_ { (desc.format == Format::R16UInt) }
+// Adds the untracked hazard tracking mode to the specified resource options and returns true on success.
+static bool DisableHazardTracking(MTLResourceOptions& opt)
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        opt |= MTLResourceHazardTrackingModeUntracked;
+        return true;
+    }
+    return false;
+}
+
+static id<MTLBuffer> NewMTLBufferFromHeap(MTHeapAllocator* heapAllocator, const BufferDescriptor& desc, const void* initialData, MTLResourceOptions opt)
+{
+    /*
+    Buffers that are written by shaders are not sub-allocated,
+    since Metal tracks hazards for the entire heap and that would serialize unrelated command encoders.
+    */
+    if (heapAllocator == nullptr || (desc.bindFlags & BindFlags::Storage) != 0)
+        return nil;
+
+    id<MTLBuffer> buffer = heapAllocator->NewBuffer(static_cast<NSUInteger>(desc.size), opt);
+    if (buffer != nil && initialData != nullptr)
+        ::memcpy([buffer contents], initialData, static_cast<std::size_t>(desc.size));
+
+    return buffer;
+}
+
+MTBuffer::MTBuffer(id<MTLDevice> device, const BufferDescriptor& desc, const void* initialData, MTHeapAllocator* heapAllocator) :
+    Buffer           { desc.bindFlags                                         },
+    indexType16Bits_ { (desc.format == Format::R16UInt)                       },
+    isPersistent_    { ((desc.miscFlags & MiscFlags::PersistentMapping) != 0) }
 {
-    auto opt = GetMTLResourceOptions(desc);
+    auto opt = GetMTLResourceOptions(device, desc);
 
     #ifndef LLGL_OS_IOS
     isManaged_ = ((opt & MTLResourceStorageModeManaged) != 0);
     #endif
 
-    if (initialData)
-        native_ = [device newBufferWithBytes:initialData length:(NSUInteger)desc.size options:opt];
+    /* Try to sub-allocate buffer from a heap first; Heaps are tracked, so untracked buffers always get their own allocation */
+    if ((desc.miscFlags & MiscFlags::Untracked) != 0)
+        isUntracked_ = DisableHazardTracking(opt);
     else
-        native_ = [device newBufferWithLength:(NSUInteger)desc.size options:opt];
+        native_ = NewMTLBufferFromHeap(heapAllocator, desc, initialData, opt);
+
+    if (native_ == nil)
+    {
+        if (initialData)
+            native_ = [device newBufferWithBytes:initialData length:(NSUInteger)desc.size options:opt];
+        else
+            native_ = [device newBufferWithLength:(NSUInteger)desc.size options:opt];
+    }
 }
 
 MTBuffer::~MTBuffer()
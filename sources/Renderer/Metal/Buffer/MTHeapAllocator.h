@@ -0,0 +1,64 @@
+/*
+ * MTHeapAllocator.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_HEAP_ALLOCATOR_H
+#define LLGL_MT_HEAP_ALLOCATOR_H
+
+
+#import <Metal/Metal.h>
+
+#include <vector>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Sub-allocates small buffers from a few large MTLHeap objects instead of allocating device memory for each buffer individually.
+The heaps are of automatic type, i.e. the memory of a buffer is returned to its heap when the buffer is released.
+NewBuffer() is thread-safe, so buffers can be created concurrently.
+*/
+class MTHeapAllocator
+{
+
+    public:
+
+        MTHeapAllocator(id<MTLDevice> device, MTLStorageMode storageMode, NSUInteger heapSize = 4u*1024u*1024u);
+        ~MTHeapAllocator();
+
+        MTHeapAllocator(const MTHeapAllocator&) = delete;
+        MTHeapAllocator& operator = (const MTHeapAllocator&) = delete;
+
+        // Returns a new buffer from one of the heaps, or nil if the buffer is too large or its options are incompatible with the heaps.
+        id<MTLBuffer> NewBuffer(NSUInteger length, MTLResourceOptions options);
+
+    private:
+
+        // Returns a heap with enough free memory for the specified size and alignment, or creates a new one.
+        id<MTLHeap> FindOrCreateHeap(const MTLSizeAndAlign& sizeAndAlign);
+
+    private:
+
+        id<MTLDevice>               device_         = nil;
+        MTLStorageMode              storageMode_    = MTLStorageModeShared;
+        NSUInteger                  heapSize_       = 0;
+        std::mutex                  heapsMutex_;
+        std::vector<id<MTLHeap>>    heaps_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
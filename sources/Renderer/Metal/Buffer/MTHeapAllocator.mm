@@ -0,0 +1,90 @@
+/*
+ * MTHeapAllocator.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTHeapAllocator.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+MTHeapAllocator::MTHeapAllocator(id<MTLDevice> device, MTLStorageMode storageMode, NSUInteger heapSize) :
+    device_      { device      },
+    storageMode_ { storageMode },
+    heapSize_    { heapSize    }
+{
+}
+
+MTHeapAllocator::~MTHeapAllocator()
+{
+    /* Buffers retain their heap, so heaps of buffers that are still alive remain valid */
+    for (id<MTLHeap> heap : heaps_)
+        [heap release];
+}
+
+id<MTLBuffer> MTHeapAllocator::NewBuffer(NSUInteger length, MTLResourceOptions options)
+{
+    /* Only sub-allocate small buffers so a single heap can hold many of them */
+    if (length == 0 || length > heapSize_ / 8)
+        return nil;
+
+    /* Heaps only support a single storage mode */
+    const MTLResourceOptions storageModeOptions = (static_cast<MTLResourceOptions>(storageMode_) << MTLResourceStorageModeShift);
+    if ((options & MTLResourceStorageModeMask) != storageModeOptions)
+        return nil;
+
+    if (@available(iOS 10.0, macOS 10.13, *))
+    {
+        const MTLSizeAndAlign sizeAndAlign = [device_ heapBufferSizeAndAlignWithLength:length options:options];
+        std::lock_guard<std::mutex> guard{ heapsMutex_ };
+        if (id<MTLHeap> heap = FindOrCreateHeap(sizeAndAlign))
+            return [heap newBufferWithLength:length options:options];
+    }
+
+    return nil;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+id<MTLHeap> MTHeapAllocator::FindOrCreateHeap(const MTLSizeAndAlign& sizeAndAlign)
+{
+    if (@available(iOS 10.0, macOS 10.13, *))
+    {
+        /* Find heap with enough free memory, starting with the most recent one */
+        for (auto it = heaps_.rbegin(); it != heaps_.rend(); ++it)
+        {
+            if ([*it maxAvailableSizeWithAlignment:sizeAndAlign.align] >= sizeAndAlign.size)
+                return *it;
+        }
+
+        /* Allocate new heap */
+        MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+        {
+            heapDesc.storageMode    = storageMode_;
+            heapDesc.size           = std::max(heapSize_, sizeAndAlign.size);
+        }
+        id<MTLHeap> heap = [device_ newHeapWithDescriptor:heapDesc];
+        [heapDesc release];
+
+        if (heap != nil)
+            heaps_.push_back(heap);
+
+        return heap;
+    }
+    return nil;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,65 @@
+/*
+ * MTIndirectCommandBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_INDIRECT_COMMAND_BUFFER_H
+#define LLGL_MT_INDIRECT_COMMAND_BUFFER_H
+
+
+#import <Metal/Metal.h>
+
+
+namespace LLGL
+{
+
+
+// Helper class to manage an internal <MTLIndirectCommandBuffer> (ICB) whose draw commands are encoded by a compute kernel or on the CPU.
+class MTIndirectCommandBuffer
+{
+
+    public:
+
+        // Initializes the ICB helper with the specified resource options. Use MTLResourceStorageModeShared for ICBs that are encoded on the CPU.
+        MTIndirectCommandBuffer(id<MTLDevice> device, MTLResourceOptions options = MTLResourceStorageModePrivate);
+        ~MTIndirectCommandBuffer();
+
+        // Allocates a new ICB if the specified number of commands is larger than the previous capacity. In this case, the new capacity is multiplied by 1.5x.
+        void Grow(NSUInteger maxCommandCount);
+
+        // Always allocates a new ICB with the specified capacity, so the previous ICB can still be used by command buffers in flight.
+        void Resize(NSUInteger maxCommandCount);
+
+        // Returns the native MTLIndirectCommandBuffer object.
+        inline id<MTLIndirectCommandBuffer> GetNative() const
+        {
+            return native_;
+        }
+
+        // Returns the argument buffer that encodes the ICB for the compute kernel.
+        inline id<MTLBuffer> GetArgumentBuffer() const
+        {
+            return argumentBuffer_;
+        }
+
+    private:
+
+        id<MTLDevice>                   device_             = nil;
+        MTLResourceOptions              options_            = MTLResourceStorageModePrivate;
+        id<MTLIndirectCommandBuffer>    native_             = nil;
+        id<MTLBuffer>                   argumentBuffer_     = nil;
+        NSUInteger                      maxCommandCount_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,86 @@
+/*
+ * MTIndirectCommandBuffer.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTIndirectCommandBuffer.h"
+
+
+namespace LLGL
+{
+
+
+MTIndirectCommandBuffer::MTIndirectCommandBuffer(id<MTLDevice> device, MTLResourceOptions options) :
+    device_  { device  },
+    options_ { options }
+{
+}
+
+MTIndirectCommandBuffer::~MTIndirectCommandBuffer()
+{
+    [native_ release];
+    [argumentBuffer_ release];
+}
+
+void MTIndirectCommandBuffer::Grow(NSUInteger maxCommandCount)
+{
+    if (maxCommandCount > maxCommandCount_)
+    {
+        if (native_ == nil)
+            Resize(maxCommandCount);
+        else
+            Resize(maxCommandCount + maxCommandCount/2);
+    }
+}
+
+void MTIndirectCommandBuffer::Resize(NSUInteger maxCommandCount)
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        /*
+        Release previous ICB and argument buffer; command buffers that are still in flight retain their own references.
+        A new argument buffer is allocated as well, since the old one might still be read by the GPU.
+        */
+        [native_ release];
+        [argumentBuffer_ release];
+
+        /* Allocate new ICB that inherits all buffers and the PSO from the parent render command encoder */
+        MTLIndirectCommandBufferDescriptor* icbDesc = [[MTLIndirectCommandBufferDescriptor alloc] init];
+        {
+            icbDesc.commandTypes                = (MTLIndirectCommandTypeDraw | MTLIndirectCommandTypeDrawIndexed);
+            icbDesc.inheritBuffers              = YES;
+            icbDesc.inheritPipelineState        = YES;
+            icbDesc.maxVertexBufferBindCount    = 0;
+            icbDesc.maxFragmentBufferBindCount  = 0;
+        }
+        native_ = [device_
+            newIndirectCommandBufferWithDescriptor: icbDesc
+            maxCommandCount:                        maxCommandCount
+            options:                                options_
+        ];
+        [icbDesc release];
+
+        /* Encode ICB into argument buffer so the compute kernel can write into it */
+        MTLArgumentDescriptor* argDesc = [MTLArgumentDescriptor argumentDescriptor];
+        {
+            argDesc.dataType    = MTLDataTypeIndirectCommandBuffer;
+            argDesc.index       = 0;
+        }
+        id<MTLArgumentEncoder> argEncoder = [device_ newArgumentEncoderWithArguments:@[argDesc]];
+        argumentBuffer_ = [device_ newBufferWithLength:argEncoder.encodedLength options:MTLResourceStorageModeShared];
+        [argEncoder setArgumentBuffer:argumentBuffer_ offset:0];
+        [argEncoder setIndirectCommandBuffer:native_ atIndex:0];
+        [argEncoder release];
+
+        maxCommandCount_ = maxCommandCount;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
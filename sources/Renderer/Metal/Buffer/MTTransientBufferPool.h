@@ -0,0 +1,49 @@
+/*
+ * MTTransientBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_TRANSIENT_BUFFER_POOL_H
+#define LLGL_MT_TRANSIENT_BUFFER_POOL_H
+
+
+#import <Metal/Metal.h>
+
+#include "../../TransientBufferPool.h"
+
+
+namespace LLGL
+{
+
+
+// Transient buffer pool whose chunks are MTBuffer objects in shared storage mode.
+class MTTransientBufferPool final : public TransientBufferPool
+{
+
+    public:
+
+        MTTransientBufferPool(id<MTLDevice> device, NSUInteger chunkSize);
+        ~MTTransientBufferPool();
+
+    private:
+
+        bool CreateChunk(std::uint64_t size, Chunk& outChunk) override;
+        void ReleaseChunk(Chunk& chunk) override;
+
+    private:
+
+        id<MTLDevice> device_ = nil;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,71 @@
+/*
+ * MTTransientBufferPool.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTTransientBufferPool.h"
+#include "MTBuffer.h"
+
+
+namespace LLGL
+{
+
+
+/* Same constant buffer offset alignment as reported by RenderingLimits::minConstantBufferAlignment */
+static constexpr std::uint64_t g_constantBufferOffsetAlignment = 256;
+
+MTTransientBufferPool::MTTransientBufferPool(id<MTLDevice> device, NSUInteger chunkSize) :
+    TransientBufferPool { chunkSize, g_constantBufferOffsetAlignment },
+    device_             { device                                     }
+{
+}
+
+MTTransientBufferPool::~MTTransientBufferPool()
+{
+    ReleaseChunks();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool MTTransientBufferPool::CreateChunk(std::uint64_t size, Chunk& outChunk)
+{
+    /* DynamicUsage selects shared storage mode, so the buffer contents remain accessible to the CPU */
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = size;
+        bufferDesc.bindFlags    = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::ConstantBuffer);
+        bufferDesc.miscFlags    = MiscFlags::DynamicUsage;
+    }
+    auto* bufferMT = new MTBuffer{ device_, bufferDesc, nullptr };
+
+    if (bufferMT->GetNative() == nil)
+    {
+        delete bufferMT;
+        return false;
+    }
+
+    [bufferMT->GetNative() setLabel:@"LLGL.TransientBuffer"];
+
+    outChunk.buffer     = bufferMT;
+    outChunk.mappedData = static_cast<char*>([bufferMT->GetNative() contents]);
+    outChunk.size       = size;
+
+    return true;
+}
+
+void MTTransientBufferPool::ReleaseChunk(Chunk& chunk)
+{
+    delete chunk.buffer;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -23,6 +23,7 @@ class MTMultiSubmitCommandBuffer;
 class MTGraphicsPSO;
 class MTComputePSO;
 class MTRenderPass;
+class MTIndirectCommandBuffer;
 class RenderTarget;
 
 struct MTCmdExecute
@@ -164,6 +165,19 @@ struct MTCmdSetResource
     Resource*       resource;
 };
 
+struct MTCmdSetConstantBufferRange
+{
+    std::uint32_t   descriptor;
+    Buffer*         buffer;
+    NSUInteger      offset;
+};
+
+struct MTCmdResourceBarrier
+{
+    NSUInteger          count;
+//  id<MTLResource>*    resources[count];
+};
+
 struct MTCmdBeginRenderPass
 {
     RenderTarget*       renderTarget;
@@ -200,6 +214,43 @@ struct MTCmdDrawIndexed
     NSUInteger baseInstance;
 };
 
+struct MTCmdDrawIndirect
+{
+    id<MTLBuffer>   indirectBuffer;
+    NSUInteger      indirectBufferOffset;
+    NSUInteger      numCommands;
+    NSUInteger      stride;
+};
+
+struct MTCmdDrawIndirectCount
+{
+    id<MTLBuffer>   indirectBuffer;
+    NSUInteger      indirectBufferOffset;
+    id<MTLBuffer>   countBuffer;
+    NSUInteger      countBufferOffset;
+    NSUInteger      maxNumCommands;
+    NSUInteger      stride;
+    bool            indexed;
+};
+
+struct MTCmdDrawMeshThreadgroups
+{
+    MTLSize threadgroups;
+};
+
+struct MTCmdExecuteIndirectCommands
+{
+    const MTIndirectCommandBuffer*  indirectCmdBuffer;
+    NSUInteger                      firstCommand;
+    NSUInteger                      numCommands;
+    bool                            hasIndexedDraws;
+};
+
+struct MTCmdDispatchTiles
+{
+    MTLSize threadsPerTile;
+};
+
 struct MTCmdDispatchThreads
 {
     MTLSize threadgroups;
@@ -15,6 +15,7 @@
 #include <LLGL/Constants.h>
 #include "MTCommandContext.h"
 #include "../Buffer/MTStagingBufferPool.h"
+#include "../Buffer/MTTransientBufferPool.h"
 
 
 namespace LLGL
@@ -58,6 +59,10 @@ class MTCommandBuffer : public CommandBuffer
             return ((GetFlags() & CommandBufferFlags::Secondary) == 0);
         }
 
+    public:
+
+        TransientBufferAllocation AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment) override;
+
     protected:
 
         static constexpr NSUInteger maxNumCommandBuffersInFlight = 3;
@@ -74,6 +79,21 @@ class MTCommandBuffer : public CommandBuffer
             NSUInteger&     outSrcOffset
         );
 
+        // Stores the vertex buffer for slot 0 if it was created with BindFlags::ComputeStreamOutput. Otherwise, resets the stored buffer.
+        void SetComputeStreamOutputBuffer(MTBuffer* bufferMT);
+
+        // Encodes an indirect draw command with the arguments at the end of the compute stream-output buffer. Returns false if no such buffer is bound.
+        bool DrawComputeStreamOutput();
+
+        // Collects the native resources that were created with MiscFlags::Untracked, since only those need explicit barriers in Metal.
+        static void GetUntrackedResources(
+            std::uint32_t                   numBuffers,
+            Buffer* const *                 buffers,
+            std::uint32_t                   numTextures,
+            Texture* const *                textures,
+            SmallVector<id<MTLResource>>&   outResources
+        );
+
     private:
 
         id<MTLDevice>                   device_                 = nil;
@@ -81,7 +101,9 @@ class MTCommandBuffer : public CommandBuffer
 
         NSUInteger                      currentStagingPool_     = 0;
         MTStagingBufferPool             stagingBufferPools_[MTCommandBuffer::maxNumCommandBuffersInFlight];
+        MTTransientBufferPool           transientBufferPools_[MTCommandBuffer::maxNumCommandBuffersInFlight];
         SmallVector<id<MTLDrawable>, 2> queuedDrawables_;
+        MTBuffer*                       computeSOBuffer_        = nullptr;
 
 };
 
@@ -13,7 +13,10 @@
 #include "../RenderState/MTConstantsCache.h"
 #include "../Buffer/MTBuffer.h"
 #include "../Shader/MTShader.h"
+#include "../Texture/MTTexture.h"
 #include "../../CheckedCast.h"
+#include "../../BufferUtils.h"
+#include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
 #include <LLGL/Backend/Metal/NativeCommand.h>
@@ -24,15 +27,23 @@ namespace LLGL
 
 
 MTCommandBuffer::MTCommandBuffer(id<MTLDevice> device, long flags) :
-    device_             { device                },
-    flags_              { flags                 },
-    stagingBufferPools_ { { device, USHRT_MAX },
-                          { device, USHRT_MAX },
-                          { device, USHRT_MAX } }
+    device_               { device                },
+    flags_                { flags                 },
+    stagingBufferPools_   { { device, USHRT_MAX },
+                            { device, USHRT_MAX },
+                            { device, USHRT_MAX } },
+    transientBufferPools_ { { device, USHRT_MAX },
+                            { device, USHRT_MAX },
+                            { device, USHRT_MAX } }
 {
     ResetRenderStates();
 }
 
+TransientBufferAllocation MTCommandBuffer::AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment)
+{
+    return transientBufferPools_[currentStagingPool_].Alloc(size, bindFlags, alignment);
+}
+
 
 /*
  * ======= Protected: =======
@@ -41,11 +52,13 @@ MTCommandBuffer::MTCommandBuffer(id<MTLDevice> device, long flags) :
 void MTCommandBuffer::ResetRenderStates()
 {
     currentStagingPool_ = (currentStagingPool_ + 1) % MTCommandBuffer::maxNumCommandBuffersInFlight;
+    computeSOBuffer_    = nullptr;
 }
 
 void MTCommandBuffer::ResetStagingPool()
 {
     stagingBufferPools_[currentStagingPool_].Reset();
+    transientBufferPools_[currentStagingPool_].Reset();
 }
 
 void MTCommandBuffer::WriteStagingBuffer(
@@ -57,6 +70,46 @@ void MTCommandBuffer::WriteStagingBuffer(
     stagingBufferPools_[currentStagingPool_].Write(data, dataSize, outSrcBuffer, outSrcOffset);
 }
 
+void MTCommandBuffer::SetComputeStreamOutputBuffer(MTBuffer* bufferMT)
+{
+    if (bufferMT != nullptr && (bufferMT->GetBindFlags() & BindFlags::ComputeStreamOutput) != 0)
+        computeSOBuffer_ = bufferMT;
+    else
+        computeSOBuffer_ = nullptr;
+}
+
+bool MTCommandBuffer::DrawComputeStreamOutput()
+{
+    if (computeSOBuffer_ == nullptr)
+        return false;
+
+    /* Draw with the arguments that were written by a compute shader at the end of the vertex buffer */
+    const std::uint64_t argsOffset = GetComputeStreamOutputArgsOffset(static_cast<std::uint64_t>([computeSOBuffer_->GetNative() length]));
+    DrawIndirect(*computeSOBuffer_, argsOffset);
+    return true;
+}
+
+void MTCommandBuffer::GetUntrackedResources(
+    std::uint32_t                   numBuffers,
+    Buffer* const *                 buffers,
+    std::uint32_t                   numTextures,
+    Texture* const *                textures,
+    SmallVector<id<MTLResource>>&   outResources)
+{
+    for_range(i, numBuffers)
+    {
+        auto* bufferMT = LLGL_HOT_CAST(MTBuffer*, buffers[i]);
+        if (bufferMT != nullptr && bufferMT->IsUntracked())
+            outResources.push_back(bufferMT->GetNative());
+    }
+    for_range(i, numTextures)
+    {
+        auto* textureMT = LLGL_HOT_CAST(MTTexture*, textures[i]);
+        if (textureMT != nullptr && textureMT->IsUntracked())
+            outResources.push_back(textureMT->GetNative());
+    }
+}
+
 
 } // /namespace LLGL
 
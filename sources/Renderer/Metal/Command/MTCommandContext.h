@@ -12,11 +12,15 @@
 #import <MetalKit/MetalKit.h>
 
 #include "../Buffer/MTIntermediateBuffer.h"
+#include "../Buffer/MTIndirectCommandBuffer.h"
 #include "../RenderState/MTDescriptorCache.h"
 #include "../RenderState/MTConstantsCache.h"
 #include <LLGL/Constants.h>
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/Container/SmallVector.h>
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
@@ -33,6 +37,7 @@ class MTComputePSO;
 class MTPipelineState;
 class MTSwapChain;
 class MTRenderPass;
+class MTMultiSubmitCommandBuffer;
 
 struct MTInternalBindingTable
 {
@@ -56,6 +61,7 @@ class MTCommandContext
 
         // Initializes internal buffers with the Metal device.
         MTCommandContext(id<MTLDevice> device);
+        ~MTCommandContext();
 
         // Resets all internal states.
         void Reset();
@@ -66,6 +72,31 @@ class MTCommandContext
         // Ends the currently bound command encoder.
         void Flush();
 
+        /*
+        Synchronizes all subsequent command encoders of the current command buffer with a fence.
+        This is required as soon as resources from placement heaps or with MiscFlags::Untracked are used, since Metal does not track their hazards.
+        */
+        void FenceUntrackedResources();
+
+        // Synchronizes subsequent command encoders and inserts a memory barrier for the specified untracked resources into the current compute encoder.
+        void ResourceBarrier(const id<MTLResource>* resources, NSUInteger resourceCount);
+
+        // Returns true if the current command buffer uses untracked resources, i.e. it must be synchronized with other command buffers via events.
+        inline bool HasUntrackedResources() const
+        {
+            return fenceEncoders_;
+        }
+
+        // Makes the allocations of the specified residency set resident for the current command buffer. Each residency set is attached only once per command buffer.
+        void UseResidencySet(id<MTLResidencySet> residencySet);
+
+        /*
+        Queues the specified secondary command buffer to be encoded into the current render pass.
+        Consecutive queued command buffers are encoded on multiple threads into the sub-encoders of a MTLParallelRenderCommandEncoder
+        as soon as the next command encoder is requested or the render pass ends.
+        */
+        void QueueParallelRenderCommands(const MTMultiSubmitCommandBuffer* cmdBuffer);
+
         void BeginRenderPass(
             RenderTarget*       renderTarget,
             const MTRenderPass* renderPassMT,
@@ -100,6 +131,17 @@ class MTCommandContext
         // Dispatches the current tessellation compute shader and returns the respective render encoder.
         id<MTLRenderCommandEncoder> DispatchTessellationAndGetRenderEncoder(NSUInteger numPatches, NSUInteger numInstances = 1);
 
+        // Encodes the indirect draw commands into the internal indirect command buffer (ICB) with a builtin compute kernel and executes them in the render encoder.
+        void ExecuteIndirectCountDraws(
+            id<MTLBuffer>   argsBuffer,
+            NSUInteger      argsOffset,
+            id<MTLBuffer>   countBuffer,
+            NSUInteger      countOffset,
+            NSUInteger      maxNumCommands,
+            NSUInteger      stride,
+            bool            indexed
+        );
+
     public:
 
         // Converts, binds, and stores the respective state in the internal render encoder state.
@@ -156,9 +198,12 @@ class MTCommandContext
         }
 
         // Sets the specified resource in the descriptor cache.
-        inline void SetResource(std::uint32_t descriptor, Resource& resource)
+        void SetResource(std::uint32_t descriptor, Resource& resource);
+
+        // Sets the specified buffer range as constant buffer in the descriptor cache.
+        inline void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, NSUInteger offset)
         {
-            descriptorCache_.SetResource(descriptor, resource);
+            descriptorCache_.SetConstantBufferRange(descriptor, buffer, offset);
         }
 
         // Sets the specified uniforms in the constants cache.
@@ -211,6 +256,21 @@ class MTCommandContext
             return contextState_.threadsPerThreadgroup;
         }
 
+        inline const MTLSize& GetThreadsPerObjectThreadgroup() const
+        {
+            return contextState_.threadsPerObjectThreadgroup;
+        }
+
+        inline const MTLSize& GetThreadsPerMeshThreadgroup() const
+        {
+            return contextState_.threadsPerMeshThreadgroup;
+        }
+
+        inline const MTLSize& GetThreadsPerTile() const
+        {
+            return contextState_.threadsPerTile;
+        }
+
         inline MTPipelineState* GetBoundPipelineState() const
         {
             return contextState_.boundPipelineState;
@@ -225,6 +285,10 @@ class MTCommandContext
 
         void BeginRenderPassWithDescriptor(MTLRenderPassDescriptor* renderPassDesc, MTSwapChain* swapChainMT);
         void BindRenderEncoderWithDescriptor(MTLRenderPassDescriptor* renderPassDesc);
+
+        // Starts the first render command encoder of the current render pass if clear load actions have been folded into its descriptor.
+        void FlushFoldedLoadActions();
+
         void PauseRenderEncoder();
         void ResumeRenderEncoder();
 
@@ -236,6 +300,10 @@ class MTCommandContext
 
         void ResetContextState();
 
+        // Updates the encoder fence at the end of the current command encoder and waits for it at the beginning of the next one.
+        void UpdateEncoderFence();
+        void WaitForEncoderFence();
+
         NSUInteger GetMaxLocalThreads(id<MTLComputePipelineState> computePSO) const;
 
     private:
@@ -308,6 +376,9 @@ class MTCommandContext
             MTPipelineState*            boundPipelineState      = nullptr;
             MTLPrimitiveType            primitiveType           = MTLPrimitiveTypeTriangle;
             MTLSize                     threadsPerThreadgroup   = MTLSizeMake(1, 1, 1);
+            MTLSize                     threadsPerObjectThreadgroup = MTLSizeMake(1, 1, 1);
+            MTLSize                     threadsPerMeshThreadgroup   = MTLSizeMake(1, 1, 1);
+            MTLSize                     threadsPerTile              = MTLSizeMake(1, 1, 1);
 
             NSUInteger                  numPatchControlPoints   = 0;
             NSUInteger                  tessFactorSize          = 0;
@@ -318,6 +389,18 @@ class MTCommandContext
 
     private:
 
+        // Encodes all queued secondary command buffers with a parallel render command encoder.
+        void FlushParallelRenderCommands();
+
+        // Prepares this context to encode commands into the specified sub-encoder of a parallel render command encoder.
+        void BeginParallelRenderEncoder(id<MTLRenderCommandEncoder> subEncoder, MTLRenderPassDescriptor* renderPassDesc);
+
+        // Ends the render pass of this context without ending the sub-encoder, since the parent context ends all sub-encoders in order.
+        void EndParallelRenderEncoder();
+
+    private:
+
+        id<MTLDevice>                   device_                 = nil;
         id<MTLCommandBuffer>            cmdBuffer_              = nil;
 
         id<MTLRenderCommandEncoder>     renderEncoder_  	    = nil;
@@ -330,9 +413,11 @@ class MTCommandContext
         MTContextState                  contextState_;
 
         bool                            isRenderEncoderPaused_  = false;
+        bool                            hasFoldedLoadActions_   = false; // Clear load actions have been folded into 'renderPassDesc_' before its first encoder
         MTDescriptorCache               descriptorCache_;
         MTConstantsCache                constantsCache_;
         MTIntermediateBuffer            tessFactorBuffer_;
+        MTIndirectCommandBuffer         indirectCmdBuffer_;
         const NSUInteger                maxThreadgroupSizeX_    = 1;
 
         std::uint32_t                   renderDirtyBits_        = 0;
@@ -340,6 +425,15 @@ class MTCommandContext
 
         MTSwapChain*                    boundSwapChain_         = nullptr;
 
+        id<MTLFence>                    encoderFences_[2]       = { nil, nil }; // Two fences, since an encoder must not wait for and update the same fence.
+        std::uint32_t                   encoderFenceIndex_      = 0;            // Index of the fence that is updated by the next command encoder.
+        bool                            fenceEncoders_          = false;        // Synchronize command encoders because of untracked resources.
+        bool                            isEncoderFencePending_  = false;        // Encoder fence has been updated by a previous command encoder.
+
+        SmallVector<id<MTLResidencySet>, 4>                 residencySets_;         // Residency sets that are attached to the current command buffer.
+        SmallVector<const MTMultiSubmitCommandBuffer*, 8>   parallelCmdBuffers_;    // Secondary command buffers that are queued for parallel encoding.
+        std::vector<std::unique_ptr<MTCommandContext>>      parallelContexts_;      // Worker contexts for the sub-encoders of a parallel render command encoder.
+
 };
 
 
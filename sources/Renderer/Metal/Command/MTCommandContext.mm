@@ -6,17 +6,23 @@
  */
 
 #include "MTCommandContext.h"
+#include "MTCommandExecutor.h"
 #include "../RenderState/MTDescriptorCache.h"
 #include "../RenderState/MTConstantsCache.h"
 #include "../RenderState/MTResourceHeap.h"
 #include "../RenderState/MTGraphicsPSO.h"
 #include "../RenderState/MTComputePSO.h"
 #include "../RenderState/MTRenderPass.h"
+#include "../RenderState/MTBuiltinPSOFactory.h"
 #include "../Shader/MTShader.h"
 #include "../MTSwapChain.h"
 #include "../Texture/MTRenderTarget.h"
+#include "../Texture/MTTexture.h"
+#include "../Buffer/MTBuffer.h"
+#include "../MTFeatureSet.h"
 #include "../../../Core/Assertion.h"
 #include "../../CheckedCast.h"
+#include "../../../Core/CoreUtils.h"
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
@@ -32,11 +38,28 @@ namespace LLGL
 static constexpr NSUInteger g_tessFactorBufferAlignment = (sizeof(MTLQuadTessellationFactorsHalf) * 256);
 
 MTCommandContext::MTCommandContext(id<MTLDevice> device) :
+    device_              { device                                },
     tessFactorBuffer_    { device,
                            MTLResourceStorageModePrivate,
                            g_tessFactorBufferAlignment           },
+    indirectCmdBuffer_   { device                                },
     maxThreadgroupSizeX_ { device.maxThreadsPerThreadgroup.width }
 {
+    /* Fence is only needed to synchronize command encoders that access untracked resources from placement heaps */
+    if (SupportsPlacementHeaps(device))
+    {
+        if (@available(iOS 10.0, macOS 10.13, *))
+        {
+            encoderFences_[0] = [device newFence];
+            encoderFences_[1] = [device newFence];
+        }
+    }
+}
+
+MTCommandContext::~MTCommandContext()
+{
+    [encoderFences_[0] release];
+    [encoderFences_[1] release];
 }
 
 void MTCommandContext::Reset()
@@ -45,7 +68,11 @@ void MTCommandContext::Reset()
     renderDirtyBits_        = ~0u;
     computeDirtyBits_       = ~0u;
     isRenderEncoderPaused_  = false;
+    hasFoldedLoadActions_   = false;
     boundSwapChain_         = nullptr;
+    fenceEncoders_          = false;
+    residencySets_.clear();
+    parallelCmdBuffers_.clear();
     ResetRenderEncoderState();
     ResetComputeEncoderState();
     ResetContextState();
@@ -59,6 +86,9 @@ void MTCommandContext::Reset(id<MTLCommandBuffer> cmdBuffer)
 
 void MTCommandContext::Flush()
 {
+    FlushParallelRenderCommands();
+    UpdateEncoderFence();
+
     if (renderEncoder_ != nil)
     {
         [renderEncoder_ endEncoding];
@@ -76,6 +106,38 @@ void MTCommandContext::Flush()
     }
 }
 
+void MTCommandContext::FenceUntrackedResources()
+{
+    fenceEncoders_ = (encoderFences_[0] != nil);
+}
+
+void MTCommandContext::UseResidencySet(id<MTLResidencySet> residencySet)
+{
+    if (std::find(residencySets_.begin(), residencySets_.end(), residencySet) != residencySets_.end())
+        return;
+
+    residencySets_.push_back(residencySet);
+
+    /* Worker contexts of parallel render encoders have no command buffer; their residency sets are attached by the primary context */
+    if (cmdBuffer_ != nil)
+    {
+        if (@available(iOS 18.0, macOS 15.0, *))
+            [cmdBuffer_ useResidencySet:residencySet];
+    }
+}
+
+void MTCommandContext::ResourceBarrier(const id<MTLResource>* resources, NSUInteger resourceCount)
+{
+    FenceUntrackedResources();
+
+    /* Fences only synchronize between command encoders, so dispatches within the same compute encoder need a memory barrier */
+    if (computeEncoder_ != nil && resourceCount > 0)
+    {
+        if (@available(iOS 12.0, macOS 10.14, *))
+            [computeEncoder_ memoryBarrierWithResources:resources count:resourceCount];
+    }
+}
+
 void MTCommandContext::BeginRenderPass(
     RenderTarget*       renderTarget,
     const MTRenderPass* renderPassMT,
@@ -86,7 +148,7 @@ void MTCommandContext::BeginRenderPass(
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Get next render pass descriptor from MetalKit view */
-        auto* swapChainMT = LLGL_CAST(MTSwapChain*, renderTarget);
+        auto* swapChainMT = LLGL_HOT_CAST(MTSwapChain*, renderTarget);
         if (renderPassMT != nullptr)
             BeginRenderPassWithDescriptor(swapChainMT->GetAndUpdateNativeRenderPass(*renderPassMT, numClearValues, clearValues), swapChainMT);
         else
@@ -95,7 +157,9 @@ void MTCommandContext::BeginRenderPass(
     else
     {
         /* Get render pass descriptor from render target */
-        auto* renderTargetMT = LLGL_CAST(MTRenderTarget*, renderTarget);
+        auto* renderTargetMT = LLGL_HOT_CAST(MTRenderTarget*, renderTarget);
+        if (renderTargetMT->HasUntrackedAttachments())
+            FenceUntrackedResources();
         if (renderPassMT != nullptr)
             BeginRenderPassWithDescriptor(renderTargetMT->GetAndUpdateNativeRenderPass(*renderPassMT, numClearValues, clearValues), nullptr);
         else
@@ -107,21 +171,41 @@ void MTCommandContext::UpdateRenderPass(MTLRenderPassDescriptor* renderPassDesc)
 {
     LLGL_ASSERT_PTR(renderPassDesc);
     if (contextState_.isInsideRenderPass)
-        BindRenderEncoderWithDescriptor(renderPassDesc);
+    {
+        if (renderEncoder_ == nil && !isRenderEncoderPaused_)
+        {
+            /*
+            No render command encoder has been created for this render pass yet,
+            so fold the new load actions into the descriptor of the first encoder instead of starting another one
+            */
+            [renderPassDesc retain];
+            [renderPassDesc_ release];
+            renderPassDesc_ = renderPassDesc;
+            hasFoldedLoadActions_ = true;
+        }
+        else
+            BindRenderEncoderWithDescriptor(renderPassDesc);
+    }
 }
 
 void MTCommandContext::EndRenderPass()
 {
     if (contextState_.isInsideRenderPass)
     {
+        /* Clears must still be encoded if nothing else has been recorded inside this render pass */
+        FlushFoldedLoadActions();
         Flush();
         contextState_.isInsideRenderPass = false;
+        isRenderEncoderPaused_ = false;
+        hasFoldedLoadActions_ = false;
         [renderPassDesc_ release];
     }
 }
 
 id<MTLRenderCommandEncoder> MTCommandContext::BindRenderEncoder()
 {
+    FlushParallelRenderCommands();
+
     /* Resume render encoder if we are inside a render pass */
     if (contextState_.isInsideRenderPass && contextState_.encoderState != MTEncoderState::Render)
         ResumeRenderEncoder();
@@ -134,6 +218,9 @@ id<MTLRenderCommandEncoder> MTCommandContext::BindRenderEncoder()
 
 id<MTLComputeCommandEncoder> MTCommandContext::BindComputeEncoder()
 {
+    FlushParallelRenderCommands();
+    FlushFoldedLoadActions();
+
     /* Pause render encoder if we are inside a render pass */
     if (contextState_.isInsideRenderPass && contextState_.encoderState == MTEncoderState::Render)
         PauseRenderEncoder();
@@ -142,6 +229,7 @@ id<MTLComputeCommandEncoder> MTCommandContext::BindComputeEncoder()
     {
         Flush();
         computeEncoder_ = [cmdBuffer_ computeCommandEncoder];
+        WaitForEncoderFence();
 
         /* A new compute command encoder forces all pipeline states to be reset */
         computeDirtyBits_ = ~0;
@@ -161,6 +249,9 @@ id<MTLComputeCommandEncoder> MTCommandContext::BindComputeEncoder()
 
 id<MTLBlitCommandEncoder> MTCommandContext::BindBlitEncoder()
 {
+    FlushParallelRenderCommands();
+    FlushFoldedLoadActions();
+
     /* Pause render encoder if we are inside a render pass */
     if (contextState_.isInsideRenderPass && contextState_.encoderState == MTEncoderState::Render)
         PauseRenderEncoder();
@@ -169,6 +260,7 @@ id<MTLBlitCommandEncoder> MTCommandContext::BindBlitEncoder()
     {
         Flush();
         blitEncoder_ = [cmdBuffer_ blitCommandEncoder];
+        WaitForEncoderFence();
 
         /* Store blit encoder mode */
         contextState_.encoderState = MTEncoderState::Blit;
@@ -334,8 +426,18 @@ void MTCommandContext::SetScissorRects(const Scissor* scissors, NSUInteger sciss
     renderDirtyBits_ |= DirtyBit_Scissors;
 }
 
+// Returns true if Metal does not track hazards of the specified resource, i.e. it was created with MiscFlags::Untracked.
+static bool IsUntrackedMTLResource(id<MTLResource> resource)
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+        return (resource != nil && [resource hazardTrackingMode] == MTLHazardTrackingModeUntracked);
+    return false;
+}
+
 void MTCommandContext::SetVertexBuffer(id<MTLBuffer> buffer, NSUInteger offset)
 {
+    if (!fenceEncoders_ && IsUntrackedMTLResource(buffer))
+        FenceUntrackedResources();
     renderEncoderState_.vertexBuffers[0]            = buffer;
     renderEncoderState_.vertexBufferOffsets[0]      = offset;
     renderEncoderState_.vertexBufferRange.location  = 0;
@@ -345,6 +447,12 @@ void MTCommandContext::SetVertexBuffer(id<MTLBuffer> buffer, NSUInteger offset)
 
 void MTCommandContext::SetVertexBuffers(const id<MTLBuffer>* buffers, const NSUInteger* offsets, NSUInteger bufferCount)
 {
+    for (NSUInteger i = 0; i < bufferCount && !fenceEncoders_; ++i)
+    {
+        if (IsUntrackedMTLResource(buffers[i]))
+            FenceUntrackedResources();
+    }
+
     ::memcpy(renderEncoderState_.vertexBuffers, buffers, sizeof(id) * bufferCount);
     ::memcpy(renderEncoderState_.vertexBufferOffsets, offsets, sizeof(NSUInteger) * bufferCount);
 
@@ -394,11 +502,18 @@ void MTCommandContext::SetGraphicsPSO(MTGraphicsPSO* pipelineState)
         contextState_.numPatchControlPoints = pipelineState->GetNumPatchControlPoints();
         contextState_.tessPipelineState     = pipelineState->GetTessPipelineState();
         contextState_.tessFactorSize        = GetTessFactorSizeForPatchType(pipelineState->GetPatchType());
+        contextState_.threadsPerObjectThreadgroup   = pipelineState->GetThreadsPerObjectThreadgroup();
+        contextState_.threadsPerMeshThreadgroup     = pipelineState->GetThreadsPerMeshThreadgroup();
+        contextState_.threadsPerTile                = pipelineState->GetThreadsPerTile();
     }
 }
 
 void MTCommandContext::SetGraphicsResourceHeap(MTResourceHeap* resourceHeap, std::uint32_t descriptorSet)
 {
+    if (resourceHeap->HasUntrackedResources())
+        FenceUntrackedResources();
+    if (id<MTLResidencySet> residencySet = resourceHeap->GetResidencySet())
+        UseResidencySet(residencySet);
     renderEncoderState_.graphicsResourceHeap    = resourceHeap;
     renderEncoderState_.graphicsResourceSet     = descriptorSet;
     renderDirtyBits_ |= DirtyBit_GraphicsResourceHeap;
@@ -481,11 +596,24 @@ void MTCommandContext::SetComputePSO(MTComputePSO* pipelineState)
 
 void MTCommandContext::SetComputeResourceHeap(MTResourceHeap* resourceHeap, std::uint32_t descriptorSet)
 {
+    if (resourceHeap->HasUntrackedResources())
+        FenceUntrackedResources();
+    if (id<MTLResidencySet> residencySet = resourceHeap->GetResidencySet())
+        UseResidencySet(residencySet);
     computeEncoderState_.computeResourceHeap    = resourceHeap;
     computeEncoderState_.computeResourceSet     = descriptorSet;
     computeDirtyBits_ |= DirtyBit_ComputeResourceHeap;
 }
 
+void MTCommandContext::SetResource(std::uint32_t descriptor, Resource& resource)
+{
+    if (resource.GetResourceType() == ResourceType::Texture && LLGL_HOT_CAST(MTTexture&, resource).IsUntracked())
+        FenceUntrackedResources();
+    else if (resource.GetResourceType() == ResourceType::Buffer && LLGL_HOT_CAST(MTBuffer&, resource).IsUntracked())
+        FenceUntrackedResources();
+    descriptorCache_.SetResource(descriptor, resource);
+}
+
 void MTCommandContext::RebindResourceHeap(id<MTLComputeCommandEncoder> computeEncoder)
 {
     if (computeEncoderState_.computeResourceHeap != nullptr)
@@ -503,6 +631,8 @@ void MTCommandContext::RebindResourceHeap(id<MTLComputeCommandEncoder> computeEn
 
 void MTCommandContext::SetIndexStream(id<MTLBuffer> indexBuffer, NSUInteger offset, bool indexType16Bits)
 {
+    if (!fenceEncoders_ && IsUntrackedMTLResource(indexBuffer))
+        FenceUntrackedResources();
     contextState_.indexBuffer       = indexBuffer;
     contextState_.indexBufferOffset = offset;
     if (indexType16Bits)
@@ -517,6 +647,73 @@ void MTCommandContext::SetIndexStream(id<MTLBuffer> indexBuffer, NSUInteger offs
     }
 }
 
+void MTCommandContext::ExecuteIndirectCountDraws(
+    id<MTLBuffer>   argsBuffer,
+    NSUInteger      argsOffset,
+    id<MTLBuffer>   countBuffer,
+    NSUInteger      countOffset,
+    NSUInteger      maxNumCommands,
+    NSUInteger      stride,
+    bool            indexed)
+{
+    if (maxNumCommands == 0)
+        return;
+
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        /* Metal has no native draw command with a GPU-side draw count, so encode the draws into an ICB first */
+        indirectCmdBuffer_.Grow(maxNumCommands);
+        id<MTLIndirectCommandBuffer> icb = indirectCmdBuffer_.GetNative();
+
+        id<MTLComputePipelineState> encodePSO = MTBuiltinPSOFactory::Get().GetComputePSO(
+            indexed ? MTBuiltinComputePSO::EncodeDrawIndexedIndirectCount : MTBuiltinComputePSO::EncodeDrawIndirectCount
+        );
+        LLGL_ASSERT_PTR(encodePSO);
+
+        struct EncodeParams
+        {
+            std::uint32_t maxNumCommands;
+            std::uint32_t stride;
+            std::uint32_t primitiveType;
+            std::uint32_t indexType16Bits;
+        }
+        params
+        {
+            static_cast<std::uint32_t>(maxNumCommands),
+            static_cast<std::uint32_t>(stride),
+            static_cast<std::uint32_t>(contextState_.primitiveType),
+            (contextState_.indexType == MTLIndexTypeUInt16 ? 1u : 0u)
+        };
+
+        /* Encode kernel dispatch to translate the indirect arguments into ICB draw commands */
+        id<MTLComputeCommandEncoder> computeEncoder = BindComputeEncoder();
+        [computeEncoder setComputePipelineState:encodePSO];
+        [computeEncoder setBuffer:argsBuffer offset:argsOffset atIndex:0];
+        [computeEncoder setBuffer:countBuffer offset:countOffset atIndex:1];
+        [computeEncoder setBuffer:indirectCmdBuffer_.GetArgumentBuffer() offset:0 atIndex:2];
+        [computeEncoder setBytes:&params length:sizeof(params) atIndex:3];
+        if (indexed)
+            [computeEncoder setBuffer:contextState_.indexBuffer offset:contextState_.indexBufferOffset atIndex:4];
+        [computeEncoder useResource:icb usage:MTLResourceUsageWrite];
+
+        DispatchThreads1D(computeEncoder, encodePSO, maxNumCommands);
+
+        /* Builtin PSO replaced the user's compute state, so it must be submitted again on the next dispatch */
+        computeDirtyBits_ = ~0u;
+
+        /* Execute ICB commands with the buffers and PSO inherited from the render encoder */
+        id<MTLRenderCommandEncoder> renderEncoder = FlushAndGetRenderEncoder();
+        if (indexed)
+            [renderEncoder useResource:contextState_.indexBuffer usage:MTLResourceUsageRead];
+        [renderEncoder executeCommandsInBuffer:icb withRange:NSMakeRange(0, maxNumCommands)];
+    }
+}
+
+void MTCommandContext::QueueParallelRenderCommands(const MTMultiSubmitCommandBuffer* cmdBuffer)
+{
+    parallelCmdBuffers_.push_back(cmdBuffer);
+}
+
 id<MTLBuffer> MTCommandContext::GetTessFactorBufferAndGrow(NSUInteger numPatchesAndInstances)
 {
     tessFactorBuffer_.Grow(contextState_.tessFactorSize * numPatchesAndInstances);
@@ -533,6 +730,150 @@ MTKView* MTCommandContext::GetCurrentDrawableView() const
  * ======= Private: =======
  */
 
+// Returns true if the specified attachment only lives in tile memory, i.e. its content can neither be loaded nor stored.
+static bool IsMemorylessAttachment(MTLRenderPassAttachmentDescriptor* attachment)
+{
+    if (@available(iOS 10.0, macOS 11.0, *))
+        return (attachment.texture != nil && attachment.texture.storageMode == MTLStorageModeMemoryless);
+    return false;
+}
+
+// Continues the specified attachment in a new render command encoder; Memoryless attachments lose their content between encoders.
+static void ContinueMTLAttachment(MTLRenderPassAttachmentDescriptor* attachment)
+{
+    if (IsMemorylessAttachment(attachment))
+        attachment.loadAction = MTLLoadActionDontCare;
+    else
+        attachment.loadAction = MTLLoadActionLoad;
+}
+
+// Replaces load and store actions that Metal does not allow for memoryless attachments.
+static void DiscardMemorylessAttachment(MTLRenderPassAttachmentDescriptor* attachment)
+{
+    if (!IsMemorylessAttachment(attachment))
+        return;
+
+    if (attachment.loadAction == MTLLoadActionLoad)
+        attachment.loadAction = MTLLoadActionDontCare;
+
+    if (attachment.storeAction == MTLStoreActionStore)
+        attachment.storeAction = MTLStoreActionDontCare;
+    else if (attachment.storeAction == MTLStoreActionStoreAndMultisampleResolve)
+        attachment.storeAction = MTLStoreActionMultisampleResolve;
+}
+
+void MTCommandContext::FlushParallelRenderCommands()
+{
+    if (parallelCmdBuffers_.empty())
+        return;
+
+    /* Take queued command buffers first, since ending the current encoder below calls this function again */
+    SmallVector<const MTMultiSubmitCommandBuffer*, 8> cmdBuffers = std::move(parallelCmdBuffers_);
+    parallelCmdBuffers_.clear();
+
+    /* A single command buffer is not worth the overhead of a parallel render command encoder */
+    if (cmdBuffers.size() == 1)
+    {
+        ExecuteMTMultiSubmitCommandBuffer(*cmdBuffers.front(), *this);
+        return;
+    }
+
+    /* End current render encoder and continue the render pass with a parallel render command encoder */
+    PauseRenderEncoder();
+    Flush();
+    ResumeRenderEncoder();
+
+    id<MTLParallelRenderCommandEncoder> parallelEncoder = [cmdBuffer_ parallelRenderCommandEncoderWithDescriptor:renderPassDesc_];
+
+    /* Sub-encoders are executed in the order they are created, so create them on this thread before encoding in parallel */
+    const std::size_t numCmdBuffers = cmdBuffers.size();
+    SmallVector<id<MTLRenderCommandEncoder>, 8> subEncoders;
+    subEncoders.reserve(numCmdBuffers);
+
+    for_range(i, numCmdBuffers)
+    {
+        id<MTLRenderCommandEncoder> subEncoder = [parallelEncoder renderCommandEncoder];
+        if (fenceEncoders_ && isEncoderFencePending_)
+        {
+            if (@available(iOS 10.0, macOS 10.13, *))
+                [subEncoder waitForFence:encoderFences_[encoderFenceIndex_ ^ 1] beforeStages:MTLRenderStageVertex];
+        }
+        subEncoders.push_back(subEncoder);
+    }
+
+    while (parallelContexts_.size() < numCmdBuffers)
+        parallelContexts_.push_back(MakeUnique<MTCommandContext>(device_));
+
+    /* Encode each secondary command buffer with its own context on a worker thread */
+    const MTMultiSubmitCommandBuffer* const*    cmdBufferList   = cmdBuffers.data();
+    id<MTLRenderCommandEncoder> const*          subEncoderList  = subEncoders.data();
+    std::unique_ptr<MTCommandContext>*          contextList     = parallelContexts_.data();
+    MTLRenderPassDescriptor*                    renderPassDesc  = renderPassDesc_;
+
+    dispatch_apply(
+        numCmdBuffers,
+        dispatch_get_global_queue(QOS_CLASS_USER_INTERACTIVE, 0),
+        ^(std::size_t i)
+        {
+            MTCommandContext& context = *contextList[i];
+            context.BeginParallelRenderEncoder(subEncoderList[i], renderPassDesc);
+            ExecuteMTMultiSubmitCommandBuffer(*cmdBufferList[i], context);
+            context.EndParallelRenderEncoder();
+        }
+    );
+
+    /* Inherit untracked resources and residency sets from worker contexts and signal encoder fence with the last sub-encoder */
+    for_range(i, numCmdBuffers)
+    {
+        if (parallelContexts_[i]->HasUntrackedResources())
+            FenceUntrackedResources();
+        for (id<MTLResidencySet> residencySet : parallelContexts_[i]->residencySets_)
+            UseResidencySet(residencySet);
+    }
+
+    if (fenceEncoders_)
+    {
+        if (@available(iOS 10.0, macOS 10.13, *))
+        {
+            [subEncoders.back() updateFence:encoderFences_[encoderFenceIndex_] afterStages:MTLRenderStageFragment];
+            encoderFenceIndex_      ^= 1;
+            isEncoderFencePending_  = true;
+        }
+    }
+
+    for (id<MTLRenderCommandEncoder> subEncoder : subEncoders)
+        [subEncoder endEncoding];
+    [parallelEncoder endEncoding];
+
+    /* Subsequent render encoders must load the attachments again to continue this render pass */
+    isRenderEncoderPaused_      = true;
+    contextState_.encoderState  = MTEncoderState::None;
+}
+
+void MTCommandContext::BeginParallelRenderEncoder(id<MTLRenderCommandEncoder> subEncoder, MTLRenderPassDescriptor* renderPassDesc)
+{
+    Reset();
+    BeginRenderPassWithDescriptor(renderPassDesc, nullptr);
+
+    renderEncoder_ = subEncoder;
+
+    /* Invalidate descriptor and constant caches */
+    if (!descriptorCache_.IsEmpty())
+        descriptorCache_.Reset();
+    if (!constantsCache_.IsEmpty())
+        constantsCache_.Reset();
+
+    /* Store render encoder mode */
+    contextState_.encoderState = MTEncoderState::Render;
+}
+
+void MTCommandContext::EndParallelRenderEncoder()
+{
+    renderEncoder_ = nil;
+    contextState_.isInsideRenderPass = false;
+    [renderPassDesc_ release];
+}
+
 void MTCommandContext::BeginRenderPassWithDescriptor(MTLRenderPassDescriptor* renderPassDesc, MTSwapChain* swapChainMT)
 {
     LLGL_ASSERT_PTR(renderPassDesc);
@@ -540,6 +881,17 @@ void MTCommandContext::BeginRenderPassWithDescriptor(MTLRenderPassDescriptor* re
     if (!contextState_.isInsideRenderPass)
     {
         renderPassDesc_ = (MTLRenderPassDescriptor*)[renderPassDesc copy];
+
+        /* Transient attachments in memoryless storage mode must neither be loaded nor stored */
+        for_range(i, 8u)
+        {
+            if (renderPassDesc_.colorAttachments[i].texture == nil)
+                break;
+            DiscardMemorylessAttachment(renderPassDesc_.colorAttachments[i]);
+        }
+        DiscardMemorylessAttachment(renderPassDesc_.depthAttachment);
+        DiscardMemorylessAttachment(renderPassDesc_.stencilAttachment);
+
         contextState_.isInsideRenderPass = true;
         boundSwapChain_ = swapChainMT;
     }
@@ -549,6 +901,8 @@ void MTCommandContext::BindRenderEncoderWithDescriptor(MTLRenderPassDescriptor*
 {
     Flush();
     renderEncoder_ = [cmdBuffer_ renderCommandEncoderWithDescriptor:renderPassDesc];
+    WaitForEncoderFence();
+    hasFoldedLoadActions_ = false;
 
     /* A new render command encoder forces all pipeline states to be reset */
     renderDirtyBits_ = ~0;
@@ -563,6 +917,12 @@ void MTCommandContext::BindRenderEncoderWithDescriptor(MTLRenderPassDescriptor*
     contextState_.encoderState = MTEncoderState::Render;
 }
 
+void MTCommandContext::FlushFoldedLoadActions()
+{
+    if (hasFoldedLoadActions_ && contextState_.isInsideRenderPass && renderEncoder_ == nil && !isRenderEncoderPaused_)
+        BindRenderEncoderWithDescriptor(renderPassDesc_);
+}
+
 void MTCommandContext::PauseRenderEncoder()
 {
     if (renderEncoder_ != nil && !isRenderEncoderPaused_)
@@ -578,16 +938,16 @@ void MTCommandContext::ResumeRenderEncoder()
         {
             if (renderPassDesc_.colorAttachments[i].texture != nil)
             {
-                renderPassDesc_.colorAttachments[i].loadAction = MTLLoadActionLoad;
+                ContinueMTLAttachment(renderPassDesc_.colorAttachments[i]);
                 //renderPassDesc_.colorAttachments[i].storeAction = MTLStoreActionStore;
             }
             else
                 break;
         }
         if (renderPassDesc_.depthAttachment.texture != nil)
-            renderPassDesc_.depthAttachment.loadAction = MTLLoadActionLoad;
+            ContinueMTLAttachment(renderPassDesc_.depthAttachment);
         if (renderPassDesc_.stencilAttachment != nil)
-            renderPassDesc_.stencilAttachment.loadAction = MTLLoadActionLoad;
+            ContinueMTLAttachment(renderPassDesc_.stencilAttachment);
         isRenderEncoderPaused_ = false;
     }
 }
@@ -730,6 +1090,46 @@ void MTCommandContext::ResetContextState()
     contextState_.visBuffer             = nil;
 }
 
+void MTCommandContext::UpdateEncoderFence()
+{
+    if (!fenceEncoders_)
+        return;
+
+    if (@available(iOS 10.0, macOS 10.13, *))
+    {
+        id<MTLFence> fence = encoderFences_[encoderFenceIndex_];
+        if (renderEncoder_ != nil)
+            [renderEncoder_ updateFence:fence afterStages:MTLRenderStageFragment];
+        else if (computeEncoder_ != nil)
+            [computeEncoder_ updateFence:fence];
+        else if (blitEncoder_ != nil)
+            [blitEncoder_ updateFence:fence];
+        else
+            return;
+
+        /* Next command encoder waits for this fence and updates the other one */
+        encoderFenceIndex_      ^= 1;
+        isEncoderFencePending_  = true;
+    }
+}
+
+void MTCommandContext::WaitForEncoderFence()
+{
+    if (!fenceEncoders_ || !isEncoderFencePending_)
+        return;
+
+    if (@available(iOS 10.0, macOS 10.13, *))
+    {
+        id<MTLFence> fence = encoderFences_[encoderFenceIndex_ ^ 1];
+        if (renderEncoder_ != nil)
+            [renderEncoder_ waitForFence:fence beforeStages:MTLRenderStageVertex];
+        else if (computeEncoder_ != nil)
+            [computeEncoder_ waitForFence:fence];
+        else if (blitEncoder_ != nil)
+            [blitEncoder_ waitForFence:fence];
+    }
+}
+
 NSUInteger MTCommandContext::GetMaxLocalThreads(id<MTLComputePipelineState> computePSO) const
 {
     return std::min<NSUInteger>(
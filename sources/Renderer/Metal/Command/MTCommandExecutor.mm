@@ -17,9 +17,11 @@
 #include "../RenderState/MTGraphicsPSO.h"
 #include "../RenderState/MTComputePSO.h"
 #include "../RenderState/MTResourceHeap.h"
+#include "../Buffer/MTIndirectCommandBuffer.h"
 #include "../MTTypes.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/Exception.h"
 
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Backend/Metal/NativeCommand.h>
@@ -30,6 +32,12 @@ namespace LLGL
 {
 
 
+[[noreturn]]
+static void TrapIndirectPatchesNotSupported()
+{
+    LLGL_TRAP("tessellation with indirect arguments not supported in Metal backend yet");
+}
+
 static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCommandContext& context)
 {
     switch (opcode)
@@ -37,7 +45,10 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
         case MTOpcodeExecute:
         {
             auto* cmd = static_cast<const MTCmdExecute*>(pc);
-            ExecuteMTMultiSubmitCommandBuffer(*(cmd->commandBuffer), context);
+            if (context.IsInsideRenderPass() && cmd->commandBuffer->IsParallelEncodable())
+                context.QueueParallelRenderCommands(cmd->commandBuffer);
+            else
+                ExecuteMTMultiSubmitCommandBuffer(*(cmd->commandBuffer), context);
             return sizeof(*cmd);
         }
         case MTOpcodeCopyBuffer:
@@ -230,6 +241,23 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             context.SetResource(cmd->descriptor, *(cmd->resource));
             return sizeof(*cmd);
         }
+        case MTOpcodeSetConstantBufferRange:
+        {
+            auto* cmd = static_cast<const MTCmdSetConstantBufferRange*>(pc);
+            context.SetConstantBufferRange(cmd->descriptor, *(cmd->buffer), cmd->offset);
+            return sizeof(*cmd);
+        }
+        case MTOpcodeResourceBarrier:
+        {
+            auto* cmd = static_cast<const MTCmdResourceBarrier*>(pc);
+            context.ResourceBarrier(reinterpret_cast<const id<MTLResource>*>(cmd + 1), cmd->count);
+            return (sizeof(*cmd) + sizeof(id)*cmd->count);
+        }
+        case MTOpcodeAliasingBarrier:
+        {
+            context.FenceUntrackedResources();
+            return 0;
+        }
         case MTOpcodeBeginRenderPass:
         {
             auto* cmd = static_cast<const MTCmdBeginRenderPass*>(pc);
@@ -402,6 +430,124 @@ static std::size_t ExecuteMTCommand(const MTOpcode opcode, const void* pc, MTCom
             }
             return sizeof(*cmd);
         }
+        case MTOpcodeDrawIndirect:
+        {
+            auto* cmd = static_cast<const MTCmdDrawIndirect*>(pc);
+            if (context.GetNumPatchControlPoints() > 0)
+                TrapIndirectPatchesNotSupported();
+
+            id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+            NSUInteger offset = cmd->indirectBufferOffset;
+            for_range(i, cmd->numCommands)
+            {
+                [renderEncoder
+                    drawPrimitives:         context.GetPrimitiveType()
+                    indirectBuffer:         cmd->indirectBuffer
+                    indirectBufferOffset:   offset
+                ];
+                offset += cmd->stride;
+            }
+            return sizeof(*cmd);
+        }
+        case MTOpcodeDrawIndexedIndirect:
+        {
+            auto* cmd = static_cast<const MTCmdDrawIndirect*>(pc);
+            if (context.GetNumPatchControlPoints() > 0)
+                TrapIndirectPatchesNotSupported();
+
+            id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+            NSUInteger offset = cmd->indirectBufferOffset;
+            for_range(i, cmd->numCommands)
+            {
+                [renderEncoder
+                    drawIndexedPrimitives:  context.GetPrimitiveType()
+                    indexType:              context.GetIndexType()
+                    indexBuffer:            context.GetIndexBuffer()
+                    indexBufferOffset:      0
+                    indirectBuffer:         cmd->indirectBuffer
+                    indirectBufferOffset:   offset
+                ];
+                offset += cmd->stride;
+            }
+            return sizeof(*cmd);
+        }
+        case MTOpcodeDrawIndirectCount:
+        {
+            auto* cmd = static_cast<const MTCmdDrawIndirectCount*>(pc);
+            if (context.GetNumPatchControlPoints() > 0)
+                TrapIndirectPatchesNotSupported();
+
+            context.ExecuteIndirectCountDraws(
+                cmd->indirectBuffer,
+                cmd->indirectBufferOffset,
+                cmd->countBuffer,
+                cmd->countBufferOffset,
+                cmd->maxNumCommands,
+                cmd->stride,
+                cmd->indexed
+            );
+            return sizeof(*cmd);
+        }
+        case MTOpcodeDrawMeshThreadgroups:
+        {
+            auto* cmd = static_cast<const MTCmdDrawMeshThreadgroups*>(pc);
+            if (@available(iOS 16.0, macOS 13.0, *))
+            {
+                id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+                [renderEncoder
+                    drawMeshThreadgroups:           cmd->threadgroups
+                    threadsPerObjectThreadgroup:    context.GetThreadsPerObjectThreadgroup()
+                    threadsPerMeshThreadgroup:      context.GetThreadsPerMeshThreadgroup()
+                ];
+            }
+            return sizeof(*cmd);
+        }
+        case MTOpcodeDrawMeshThreadgroupsIndirect:
+        {
+            auto* cmd = static_cast<const MTCmdDrawIndirect*>(pc);
+            if (@available(iOS 16.0, macOS 13.0, *))
+            {
+                id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+                NSUInteger offset = cmd->indirectBufferOffset;
+                for_range(i, cmd->numCommands)
+                {
+                    [renderEncoder
+                        drawMeshThreadgroupsWithIndirectBuffer: cmd->indirectBuffer
+                        indirectBufferOffset:                   offset
+                        threadsPerObjectThreadgroup:            context.GetThreadsPerObjectThreadgroup()
+                        threadsPerMeshThreadgroup:              context.GetThreadsPerMeshThreadgroup()
+                    ];
+                    offset += cmd->stride;
+                }
+            }
+            return sizeof(*cmd);
+        }
+        case MTOpcodeExecuteIndirectCommands:
+        {
+            auto* cmd = static_cast<const MTCmdExecuteIndirectCommands*>(pc);
+            if (@available(iOS 12.0, macOS 10.14, *))
+            {
+                /* Execute baked draw commands with the PSO and buffers inherited from the render encoder */
+                id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+                if (cmd->hasIndexedDraws)
+                    [renderEncoder useResource:context.GetIndexBuffer() usage:MTLResourceUsageRead];
+                [renderEncoder
+                    executeCommandsInBuffer:    cmd->indirectCmdBuffer->GetNative()
+                    withRange:                  NSMakeRange(cmd->firstCommand, cmd->numCommands)
+                ];
+            }
+            return sizeof(*cmd);
+        }
+        case MTOpcodeDispatchTiles:
+        {
+            auto* cmd = static_cast<const MTCmdDispatchTiles*>(pc);
+            if (@available(iOS 11.0, macOS 11.0, *))
+            {
+                id<MTLRenderCommandEncoder> renderEncoder = context.FlushAndGetRenderEncoder();
+                [renderEncoder dispatchThreadsPerTile:cmd->threadsPerTile];
+            }
+            return sizeof(*cmd);
+        }
         case MTOpcodeDispatchThreadgroups:
         {
             auto* cmd = static_cast<const MTCmdDispatchThreads*>(pc);
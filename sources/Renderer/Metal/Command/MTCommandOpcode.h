@@ -37,11 +37,21 @@ enum MTOpcode : std::uint8_t
     MTOpcodeSetIndexBuffer,
     MTOpcodeSetResourceHeap,
     MTOpcodeSetResource,
+    MTOpcodeSetConstantBufferRange,
+    MTOpcodeResourceBarrier,
+    MTOpcodeAliasingBarrier,
     MTOpcodeBeginRenderPass,
     MTOpcodeEndRenderPass,
     MTOpcodeClearRenderPass,
     MTOpcodeDraw,
     MTOpcodeDrawIndexed,
+    MTOpcodeDrawIndirect,
+    MTOpcodeDrawIndexedIndirect,
+    MTOpcodeDrawIndirectCount,
+    MTOpcodeDrawMeshThreadgroups,
+    MTOpcodeDrawMeshThreadgroupsIndirect,
+    MTOpcodeExecuteIndirectCommands,
+    MTOpcodeDispatchTiles,
     MTOpcodeDispatchThreadgroups,
     MTOpcodeDispatchThreadgroupsIndirect,
     MTOpcodePushDebugGroup,
@@ -13,12 +13,15 @@
 
 #include <LLGL/CommandQueue.h>
 #include "MTCommandContext.h"
+#include <atomic>
 
 
 namespace LLGL
 {
 
 
+class MTTexture;
+
 class MTCommandQueue final : public CommandQueue
 {
 
@@ -26,6 +29,12 @@ class MTCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings) override;
+
     public:
 
         MTCommandQueue(id<MTLDevice> device);
@@ -39,14 +48,35 @@ class MTCommandQueue final : public CommandQueue
             return native_;
         }
 
-        // Submits the specified Metal command buffer.
-        void SubmitCommandBuffer(id<MTLCommandBuffer> cmdBuffer);
+        /*
+        Submits the specified Metal command buffer.
+        If 'hasUntrackedResources' is true, the untracked event is signaled at the end of this command buffer.
+        */
+        void SubmitCommandBuffer(id<MTLCommandBuffer> cmdBuffer, bool hasUntrackedResources = false);
+
+        /*
+        Encodes a wait for the untracked event into the specified command buffer.
+        Metal does not track hazards of untracked resources across command buffers either,
+        so each new command buffer waits for all previously submitted command buffers that used them.
+        */
+        void WaitForUntrackedEvent(id<MTLCommandBuffer> cmdBuffer);
+
+        // Maps the MIP tail of all slices of the specified sparse texture. The MIP tail is always resident.
+        void MapSparseMipTail(MTTexture& textureMT);
 
     private:
 
-        id<MTLCommandQueue>     native_                 = nil;
-        id<MTLCommandBuffer>    lastSubmittedCmdBuffer_ = nil;
-        MTCommandContext        context_;
+        // Re-allocates the native command buffer of the internal context for multi-submit command buffers.
+        void ResetContext();
+
+    private:
+
+        id<MTLCommandQueue>         native_                 = nil;
+        id<MTLCommandBuffer>        lastSubmittedCmdBuffer_ = nil;
+        MTCommandContext            context_;
+
+        id<MTLEvent>                untrackedEvent_         = nil;
+        std::atomic<std::uint64_t>  untrackedEventValue_;   // Last value the untracked event was signaled with; Zero if no untracked resources were submitted yet.
 
 };
 
@@ -9,7 +9,10 @@
 #include "MTDirectCommandBuffer.h"
 #include "MTMultiSubmitCommandBuffer.h"
 #include "MTCommandExecutor.h"
+#include "../Texture/MTTexture.h"
 #include "../../CheckedCast.h"
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -17,15 +20,19 @@ namespace LLGL
 
 
 MTCommandQueue::MTCommandQueue(id<MTLDevice> device) :
-    context_ { device }
+    context_             { device },
+    untrackedEventValue_ { 0      }
 {
     native_ = [device newCommandQueue];
+    if (@available(iOS 12.0, macOS 10.14, *))
+        untrackedEvent_ = [device newEvent];
 }
 
 MTCommandQueue::~MTCommandQueue()
 {
     if (lastSubmittedCmdBuffer_ != nil)
         [lastSubmittedCmdBuffer_ release];
+    [untrackedEvent_ release];
     [native_ release];
 }
 
@@ -37,9 +44,10 @@ void MTCommandQueue::Submit(CommandBuffer& commandBuffer)
     if (commandBufferMT.IsMultiSubmitCmdBuffer())
     {
         auto& multiSubmitCommandBufferMT = LLGL_CAST(MTMultiSubmitCommandBuffer&, commandBufferMT);
-        context_.Reset([native_ commandBuffer]);
+        ResetContext();
         ExecuteMTMultiSubmitCommandBuffer(multiSubmitCommandBufferMT, context_);
-        SubmitCommandBuffer(context_.GetCommandBuffer());
+        context_.Flush();
+        SubmitCommandBuffer(context_.GetCommandBuffer(), context_.HasUntrackedResources());
     }
     else
     {
@@ -47,11 +55,65 @@ void MTCommandQueue::Submit(CommandBuffer& commandBuffer)
         if (!directCommandBufferMT.IsImmediateCmdBuffer())
         {
             directCommandBufferMT.MarkSubmitted();
-            SubmitCommandBuffer(directCommandBufferMT.GetNative());
+            SubmitCommandBuffer(directCommandBufferMT.GetNative(), directCommandBufferMT.HasUntrackedResources());
         }
     }
 }
 
+void MTCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /*
+    Metal has no batched commit, so encode consecutive multi-submit command buffers into a single MTLCommandBuffer instead.
+    Direct command buffers are committed in order once the pending native command buffer has been committed.
+    */
+    bool isContextPending   = false;
+    bool isContextUntracked = false;
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] == nullptr)
+            continue;
+
+        auto* commandBufferMT = LLGL_CAST(MTCommandBuffer*, commandBuffers[i]);
+        if (commandBufferMT->IsMultiSubmitCmdBuffer())
+        {
+            auto* multiSubmitCommandBufferMT = LLGL_CAST(MTMultiSubmitCommandBuffer*, commandBufferMT);
+            if (isContextPending)
+            {
+                /* Context state is reset for each command buffer, so keep track of untracked resources of the entire batch */
+                isContextUntracked = (isContextUntracked || context_.HasUntrackedResources());
+                context_.Reset();
+            }
+            else
+                ResetContext();
+            ExecuteMTMultiSubmitCommandBuffer(*multiSubmitCommandBufferMT, context_);
+            isContextPending = true;
+        }
+        else
+        {
+            auto* directCommandBufferMT = LLGL_CAST(MTDirectCommandBuffer*, commandBufferMT);
+            if (!directCommandBufferMT->IsImmediateCmdBuffer())
+            {
+                if (isContextPending)
+                {
+                    context_.Flush();
+                    SubmitCommandBuffer(context_.GetCommandBuffer(), isContextUntracked || context_.HasUntrackedResources());
+                    isContextPending    = false;
+                    isContextUntracked  = false;
+                }
+                directCommandBufferMT->MarkSubmitted();
+                SubmitCommandBuffer(directCommandBufferMT->GetNative(), directCommandBufferMT->HasUntrackedResources());
+            }
+        }
+    }
+
+    if (isContextPending)
+    {
+        context_.Flush();
+        SubmitCommandBuffer(context_.GetCommandBuffer(), isContextUntracked || context_.HasUntrackedResources());
+    }
+}
+
 /* ----- Queries ----- */
 
 bool MTCommandQueue::QueryResult(
@@ -86,13 +148,64 @@ void MTCommandQueue::WaitIdle()
     }
 }
 
+/* ----- Sparse Resources ----- */
+
+void MTCommandQueue::UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings)
+{
+    if (@available(iOS 13.0, macOS 11.0, *))
+    {
+        id<MTLCommandBuffer> cmdBuffer = [native_ commandBuffer];
+        id<MTLResourceStateCommandEncoder> resourceStateEncoder = [cmdBuffer resourceStateCommandEncoder];
+
+        for_range(i, numMappings)
+        {
+            const TileMappingDescriptor& mapping = mappings[i];
+            auto* textureMT = LLGL_CAST(MTTexture*, mapping.texture);
+            if (!textureMT->IsSparse())
+                continue;
+
+            /* MIP-maps within the MIP tail are always resident */
+            id<MTLTexture> texture = textureMT->GetNative();
+            if (mapping.mipLevel >= [texture firstMipmapInTail])
+                continue;
+
+            /* Region is specified in units of tiles */
+            const MTLRegion region = MTLRegionMake3D(
+                static_cast<NSUInteger>(mapping.tileOffset.x),
+                static_cast<NSUInteger>(mapping.tileOffset.y),
+                static_cast<NSUInteger>(mapping.tileOffset.z),
+                mapping.numTiles.width,
+                mapping.numTiles.height,
+                mapping.numTiles.depth
+            );
+            [resourceStateEncoder
+                updateTextureMapping:   texture
+                mode:                   (mapping.resident ? MTLSparseTextureMappingModeMap : MTLSparseTextureMappingModeUnmap)
+                region:                 region
+                mipLevel:               mapping.mipLevel
+                slice:                  mapping.arrayLayer
+            ];
+        }
+
+        [resourceStateEncoder endEncoding];
+        SubmitCommandBuffer(cmdBuffer);
+    }
+}
+
 
 /*
  * Internal
  */
 
-void MTCommandQueue::SubmitCommandBuffer(id<MTLCommandBuffer> cmdBuffer)
+void MTCommandQueue::SubmitCommandBuffer(id<MTLCommandBuffer> cmdBuffer, bool hasUntrackedResources)
 {
+    /* Signal untracked event, so subsequent command buffers wait for this one */
+    if (hasUntrackedResources && untrackedEvent_ != nil)
+    {
+        if (@available(iOS 12.0, macOS 10.14, *))
+            [cmdBuffer encodeSignalEvent:untrackedEvent_ value:++untrackedEventValue_];
+    }
+
     /* Commit command buffer into queue */
     [cmdBuffer commit];
 
@@ -105,6 +218,57 @@ void MTCommandQueue::SubmitCommandBuffer(id<MTLCommandBuffer> cmdBuffer)
     }
 }
 
+void MTCommandQueue::WaitForUntrackedEvent(id<MTLCommandBuffer> cmdBuffer)
+{
+    const std::uint64_t value = untrackedEventValue_.load();
+    if (value > 0)
+    {
+        if (@available(iOS 12.0, macOS 10.14, *))
+            [cmdBuffer encodeWaitForEvent:untrackedEvent_ value:value];
+    }
+}
+
+void MTCommandQueue::MapSparseMipTail(MTTexture& textureMT)
+{
+    if (@available(iOS 13.0, macOS 11.0, *))
+    {
+        id<MTLTexture> texture = textureMT.GetNative();
+        const NSUInteger firstMipTail = [texture firstMipmapInTail];
+        if (!textureMT.IsSparse() || firstMipTail >= [texture mipmapLevelCount])
+            return;
+
+        id<MTLCommandBuffer> cmdBuffer = [native_ commandBuffer];
+        id<MTLResourceStateCommandEncoder> resourceStateEncoder = [cmdBuffer resourceStateCommandEncoder];
+
+        /* The MIP tail of each slice is mapped with a region of a single tile at the first MIP-map of the tail */
+        for_range(slice, [texture arrayLength])
+        {
+            [resourceStateEncoder
+                updateTextureMapping:   texture
+                mode:                   MTLSparseTextureMappingModeMap
+                region:                 MTLRegionMake3D(0, 0, 0, 1, 1, 1)
+                mipLevel:               firstMipTail
+                slice:                  slice
+            ];
+        }
+
+        [resourceStateEncoder endEncoding];
+        SubmitCommandBuffer(cmdBuffer);
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void MTCommandQueue::ResetContext()
+{
+    id<MTLCommandBuffer> cmdBuffer = [native_ commandBuffer];
+    WaitForUntrackedEvent(cmdBuffer);
+    context_.Reset(cmdBuffer);
+}
+
 
 } // /namespace LLGL
 
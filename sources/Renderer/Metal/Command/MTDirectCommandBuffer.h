@@ -24,6 +24,13 @@ class MTDirectCommandBuffer final : public MTCommandBuffer
 
         #include <LLGL/Backend/CommandBuffer.inl>
 
+    public:
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+        void CopyBufferRegions(Buffer& dstBuffer, Buffer& srcBuffer, std::uint32_t numRegions, const BufferCopyRegion* regions) override;
+        void CopyTextureRegions(Texture& dstTexture, Texture& srcTexture, std::uint32_t numRegions, const TextureCopyRegion* regions) override;
+        void AliasingBarrier(Texture* textureBefore, Texture* textureAfter) override;
+
     public:
 
         MTDirectCommandBuffer(id<MTLDevice> device, MTCommandQueue& cmdQueue, const CommandBufferDescriptor& desc);
@@ -48,6 +55,12 @@ class MTDirectCommandBuffer final : public MTCommandBuffer
             return ((GetFlags() & CommandBufferFlags::ImmediateSubmit) != 0);
         }
 
+        // Returns true if this command buffer uses untracked resources, i.e. it must signal the untracked event of the command queue.
+        inline bool HasUntrackedResources() const
+        {
+            return context_.HasUntrackedResources();
+        }
+
     private:
 
         void QueueDrawable(id<MTLDrawable> drawable);
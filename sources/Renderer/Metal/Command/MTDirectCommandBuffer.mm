@@ -27,6 +27,7 @@
 #include "../../CheckedCast.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Log.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 #include <limits.h>
@@ -67,8 +68,9 @@ void MTDirectCommandBuffer::Begin()
         cmdBufferDirty_ = true;
     }
 
-    /* Allocate new command buffer from command queue */
+    /* Allocate new command buffer from command queue and wait for previously submitted work on untracked resources */
     cmdBuffer_ = [cmdQueue_.GetNative() commandBuffer];
+    cmdQueue_.WaitForUntrackedEvent(cmdBuffer_);
 
     /* Append complete handler to signal semaphore */
     __block dispatch_semaphore_t blockSemaphore = cmdBufferSemaphore_;
@@ -82,6 +84,7 @@ void MTDirectCommandBuffer::Begin()
     /* Reset schedulers and pools */
     context_.Reset(cmdBuffer_);
     ResetStagingPool();
+    SetComputeStreamOutputBuffer(nullptr);
 }
 
 void MTDirectCommandBuffer::End()
@@ -93,7 +96,7 @@ void MTDirectCommandBuffer::End()
     if (IsImmediateCmdBuffer())
     {
         MarkSubmitted();
-        cmdQueue_.SubmitCommandBuffer(GetNative());
+        cmdQueue_.SubmitCommandBuffer(GetNative(), HasUntrackedResources());
     }
 
     ResetRenderStates();
@@ -103,11 +106,14 @@ void MTDirectCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
     if (IsPrimary())
     {
-        auto& commandBufferMT = LLGL_CAST(MTCommandBuffer&, secondaryCommandBuffer);
+        auto& commandBufferMT = LLGL_HOT_CAST(MTCommandBuffer&, secondaryCommandBuffer);
         if (commandBufferMT.IsMultiSubmitCmdBuffer() && !commandBufferMT.IsPrimary())
         {
-            auto& multiSubmitCommandBufferMT = LLGL_CAST(MTMultiSubmitCommandBuffer&, commandBufferMT);
-            ExecuteMTMultiSubmitCommandBuffer(multiSubmitCommandBufferMT, context_);
+            auto& multiSubmitCommandBufferMT = LLGL_HOT_CAST(MTMultiSubmitCommandBuffer&, commandBufferMT);
+            if (context_.IsInsideRenderPass() && multiSubmitCommandBufferMT.IsParallelEncodable())
+                context_.QueueParallelRenderCommands(&multiSubmitCommandBufferMT);
+            else
+                ExecuteMTMultiSubmitCommandBuffer(multiSubmitCommandBufferMT, context_);
         }
     }
 }
@@ -120,7 +126,7 @@ void MTDirectCommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
 
     /* Copy data to staging buffer */
     id<MTLBuffer> srcBuffer = nil;
@@ -146,8 +152,8 @@ void MTDirectCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
-    auto& srcBufferMT = LLGL_CAST(MTBuffer&, srcBuffer);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
+    auto& srcBufferMT = LLGL_HOT_CAST(MTBuffer&, srcBuffer);
 
     auto blitEncoder = context_.BindBlitEncoder();
     [blitEncoder
@@ -159,6 +165,32 @@ void MTDirectCommandBuffer::CopyBuffer(
     ];
 }
 
+void MTDirectCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
+    auto& srcBufferMT = LLGL_HOT_CAST(MTBuffer&, srcBuffer);
+
+    /* Encode all regions into the same blit command encoder */
+    auto blitEncoder = context_.BindBlitEncoder();
+    for_range(i, numRegions)
+    {
+        [blitEncoder
+            copyFromBuffer:     srcBufferMT.GetNative()
+            sourceOffset:       static_cast<NSUInteger>(regions[i].srcOffset)
+            toBuffer:           dstBufferMT.GetNative()
+            destinationOffset:  static_cast<NSUInteger>(regions[i].dstOffset)
+            size:               static_cast<NSUInteger>(regions[i].size)
+        ];
+    }
+}
+
 void MTDirectCommandBuffer::CopyBufferFromTexture(
     Buffer&                 dstBuffer,
     std::uint64_t           dstOffset,
@@ -167,8 +199,8 @@ void MTDirectCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
-    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
+    auto& srcTextureMT = LLGL_HOT_CAST(MTTexture&, srcTexture);
 
     /* Determine actual row and layer strides */
     if (rowStride == 0)
@@ -211,7 +243,7 @@ void MTDirectCommandBuffer::FillBuffer(
     if (fillSize == 0)
         return;
 
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
 
     /* Check if native "fillBuffer" command can be used */
     const bool valueBytesAreEqual =
@@ -250,8 +282,8 @@ void MTDirectCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
-    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+    auto& dstTextureMT = LLGL_HOT_CAST(MTTexture&, dstTexture);
+    auto& srcTextureMT = LLGL_HOT_CAST(MTTexture&, srcTexture);
 
     MTLOrigin srcOrigin, dstOrigin;
     MTTypes::Convert(srcOrigin, srcLocation.offset);
@@ -274,6 +306,45 @@ void MTDirectCommandBuffer::CopyTexture(
     ];
 }
 
+void MTDirectCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstTextureMT = LLGL_HOT_CAST(MTTexture&, dstTexture);
+    auto& srcTextureMT = LLGL_HOT_CAST(MTTexture&, srcTexture);
+
+    /* Encode all regions into the same blit command encoder */
+    auto blitEncoder = context_.BindBlitEncoder();
+    for_range(i, numRegions)
+    {
+        const TextureCopyRegion& region = regions[i];
+
+        MTLOrigin srcOrigin, dstOrigin;
+        MTTypes::Convert(srcOrigin, region.srcLocation.offset);
+        MTTypes::Convert(dstOrigin, region.dstLocation.offset);
+
+        MTLSize srcSize;
+        MTTypes::Convert(srcSize, region.extent);
+
+        [blitEncoder
+            copyFromTexture:    srcTextureMT.GetNative()
+            sourceSlice:        region.srcLocation.arrayLayer
+            sourceLevel:        region.srcLocation.mipLevel
+            sourceOrigin:       srcOrigin
+            sourceSize:         srcSize
+            toTexture:          dstTextureMT.GetNative()
+            destinationSlice:   region.dstLocation.arrayLayer
+            destinationLevel:   region.dstLocation.mipLevel
+            destinationOrigin:  dstOrigin
+        ];
+    }
+}
+
 void MTDirectCommandBuffer::CopyTextureFromBuffer(
     Texture&                dstTexture,
     const TextureRegion&    dstRegion,
@@ -282,8 +353,8 @@ void MTDirectCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
-    auto& srcBufferMT = LLGL_CAST(MTBuffer&, srcBuffer);
+    auto& dstTextureMT = LLGL_HOT_CAST(MTTexture&, dstTexture);
+    auto& srcBufferMT = LLGL_HOT_CAST(MTBuffer&, srcBuffer);
 
     /* Determine actual row and layer strides */
     if (rowStride == 0)
@@ -334,7 +405,7 @@ void MTDirectCommandBuffer::CopyTextureFromFramebuffer(
         return /*Out of bounds*/;
     }
 
-    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
+    auto& dstTextureMT = LLGL_HOT_CAST(MTTexture&, dstTexture);
     id<MTLTexture> targetTexture = dstTextureMT.GetNative();
 
     /* Source and target texture formats must match for 'copyFromTexture', so create texture view on mismatch */
@@ -378,7 +449,7 @@ void MTDirectCommandBuffer::CopyTextureFromFramebuffer(
 
 void MTDirectCommandBuffer::GenerateMips(Texture& texture)
 {
-    auto& textureMT = LLGL_CAST(MTTexture&, texture);
+    auto& textureMT = LLGL_HOT_CAST(MTTexture&, texture);
     if ([textureMT.GetNative() mipmapLevelCount] > 1)
     {
         auto blitEncoder = context_.BindBlitEncoder();
@@ -390,7 +461,7 @@ void MTDirectCommandBuffer::GenerateMips(Texture& texture, const TextureSubresou
 {
     if (subresource.numMipLevels > 1)
     {
-        auto& textureMT = LLGL_CAST(MTTexture&, texture);
+        auto& textureMT = LLGL_HOT_CAST(MTTexture&, texture);
 
         // Create temporary subresource texture to generate MIP-maps only on that range
         id<MTLTexture> intermediateTexture = textureMT.CreateSubresourceView(subresource);
@@ -428,29 +499,31 @@ void MTDirectCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor
 
 void MTDirectCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     context_.SetVertexBuffer(bufferMT.GetNative(), 0);
+    SetComputeStreamOutputBuffer(&bufferMT);
 }
 
 void MTDirectCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
-    auto& bufferArrayMT = LLGL_CAST(MTBufferArray&, bufferArray);
+    auto& bufferArrayMT = LLGL_HOT_CAST(MTBufferArray&, bufferArray);
     context_.SetVertexBuffers(
         bufferArrayMT.GetIDArray().data(),
         bufferArrayMT.GetOffsets().data(),
         static_cast<NSUInteger>(bufferArrayMT.GetIDArray().size())
     );
+    SetComputeStreamOutputBuffer(nullptr);
 }
 
 void MTDirectCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     context_.SetIndexStream(bufferMT.GetNative(), 0, bufferMT.IsIndexType16Bits());
 }
 
 void MTDirectCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     context_.SetIndexStream(bufferMT.GetNative(), static_cast<NSUInteger>(offset), (format == Format::R16UInt));
 }
 
@@ -462,7 +535,7 @@ void MTDirectCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uin
     if (boundPipelineState == nullptr)
         return /*Invalid state*/;
 
-    auto& resourceHeapMT = LLGL_CAST(MTResourceHeap&, resourceHeap);
+    auto& resourceHeapMT = LLGL_HOT_CAST(MTResourceHeap&, resourceHeap);
     if (boundPipelineState->IsGraphicsPSO())
     {
         if (resourceHeapMT.HasGraphicsResources())
@@ -480,13 +553,28 @@ void MTDirectCommandBuffer::SetResource(std::uint32_t descriptor, Resource& reso
     context_.SetResource(descriptor, resource);
 }
 
+void MTDirectCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t /*size*/)
+{
+    context_.SetConstantBufferRange(descriptor, buffer, static_cast<NSUInteger>(offset));
+}
+
 void MTDirectCommandBuffer::ResourceBarrier(
-    std::uint32_t       /*numBuffers*/,
-    Buffer* const *     /*buffers*/,
-    std::uint32_t       /*numTextures*/,
-    Texture* const *    /*textures*/)
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
 {
-    // dummy
+    /* Metal tracks hazards of all other resources automatically */
+    SmallVector<id<MTLResource>> resources;
+    GetUntrackedResources(numBuffers, buffers, numTextures, textures, resources);
+    if (!resources.empty())
+        context_.ResourceBarrier(resources.data(), resources.size());
+}
+
+void MTDirectCommandBuffer::AliasingBarrier(Texture* /*textureBefore*/, Texture* /*textureAfter*/)
+{
+    /* Placed textures are untracked, so synchronize all following command encoders with a fence instead */
+    context_.FenceUntrackedResources();
 }
 
 /* ----- Render Passes ----- */
@@ -501,12 +589,12 @@ void MTDirectCommandBuffer::BeginRenderPass(
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Put current drawable into queue */
-        auto& swapChainMT = LLGL_CAST(MTSwapChain&, renderTarget);
+        auto& swapChainMT = LLGL_HOT_CAST(MTSwapChain&, renderTarget);
         QueueDrawable(swapChainMT.GetMTKView().currentDrawable);
     }
 
     /* Get next render pass descriptor from MetalKit view */
-    auto* renderPassMT = LLGL_CAST(const MTRenderPass*, renderPass);
+    auto* renderPassMT = LLGL_HOT_CAST(const MTRenderPass*, renderPass);
     context_.BeginRenderPass(&renderTarget, renderPassMT, numClearValues, clearValues);
 }
 
@@ -592,17 +680,17 @@ void MTDirectCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const
 
 void MTDirectCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    auto& pipelineStateMT = LLGL_CAST(MTPipelineState&, pipelineState);
+    auto& pipelineStateMT = LLGL_HOT_CAST(MTPipelineState&, pipelineState);
     if (pipelineStateMT.IsGraphicsPSO())
     {
         /* Set graphics pipeline with encoder scheduler */
-        auto& graphicsPSO = LLGL_CAST(MTGraphicsPSO&, pipelineStateMT);
+        auto& graphicsPSO = LLGL_HOT_CAST(MTGraphicsPSO&, pipelineStateMT);
         context_.SetGraphicsPSO(&graphicsPSO);
     }
     else
     {
         /* Set compute pipeline with encoder scheduler */
-        auto& computePSO = LLGL_CAST(MTComputePSO&, pipelineStateMT);
+        auto& computePSO = LLGL_HOT_CAST(MTComputePSO&, pipelineStateMT);
         context_.SetComputePSO(&computePSO);
     }
 }
@@ -617,6 +705,11 @@ void MTDirectCommandBuffer::SetStencilReference(std::uint32_t reference, const S
     context_.SetStencilRef(reference, stencilFace);
 }
 
+void MTDirectCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // dummy - rasterization rate maps are not exposed as per-draw shading rates
+}
+
 void MTDirectCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     context_.SetUniforms(first, data, dataSize);
@@ -626,7 +719,7 @@ void MTDirectCommandBuffer::SetUniforms(std::uint32_t first, const void* data, s
 
 void MTDirectCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapMT = LLGL_CAST(MTQueryHeap&, queryHeap);
+    auto& queryHeapMT = LLGL_HOT_CAST(MTQueryHeap&, queryHeap);
     const MTLVisibilityResultMode mode = queryHeapMT.GetVisibilityResultMode();
     if (mode != MTLVisibilityResultModeDisabled && query < queryHeapMT.GetNumQueries())
     {
@@ -637,12 +730,30 @@ void MTDirectCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query
 
 void MTDirectCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapMT = LLGL_CAST(MTQueryHeap&, queryHeap);
+    auto& queryHeapMT = LLGL_HOT_CAST(MTQueryHeap&, queryHeap);
     const MTLVisibilityResultMode mode = queryHeapMT.GetVisibilityResultMode();
     if (mode != MTLVisibilityResultModeDisabled && query < queryHeapMT.GetNumQueries())
         context_.SetVisibilityBuffer(nil, MTLVisibilityResultModeDisabled, 0);
 }
 
+void MTDirectCommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapMT = LLGL_HOT_CAST(MTQueryHeap&, srcQueryHeap);
+    if (queryHeapMT.GetVisibilityResultMode() != MTLVisibilityResultModeDisabled && firstQuery + numQueries <= queryHeapMT.GetNumQueries())
+    {
+        /* Visibility results are already stored as 64-bit values, so they can be copied directly */
+        auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
+        auto blitEncoder = context_.BindBlitEncoder();
+        [blitEncoder
+            copyFromBuffer:     queryHeapMT.GetNative()
+            sourceOffset:       queryHeapMT.GetStride() * firstQuery
+            toBuffer:           dstBufferMT.GetNative()
+            destinationOffset:  static_cast<NSUInteger>(dstOffset)
+            size:               queryHeapMT.GetStride() * numQueries
+        ];
+    }
+}
+
 void MTDirectCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     //todo
@@ -855,7 +966,7 @@ static void TrapIndirectPatchesNotSupported()
 //TODO: support patches with indirect arguments
 void MTDirectCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     const NSUInteger numPatchControlPoints = context_.GetNumPatchControlPoints();
     if (numPatchControlPoints > 0)
     {
@@ -885,7 +996,7 @@ void MTDirectCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 //TODO: support patches with indirect arguments
 void MTDirectCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     const NSUInteger numPatchControlPoints = context_.GetNumPatchControlPoints();
     if (numPatchControlPoints > 0)
     {
@@ -923,7 +1034,7 @@ void MTDirectCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, s
 //TODO: support patches with indirect arguments
 void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     const NSUInteger numPatchControlPoints = context_.GetNumPatchControlPoints();
     if (numPatchControlPoints > 0)
     {
@@ -958,7 +1069,7 @@ void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t of
 //TODO: support patches with indirect arguments
 void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     const NSUInteger numPatchControlPoints = context_.GetNumPatchControlPoints();
     if (numPatchControlPoints > 0)
     {
@@ -998,9 +1109,112 @@ void MTDirectCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t of
     }
 }
 
+//TODO: support patches with indirect arguments
+void MTDirectCommandBuffer::DrawIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (context_.GetNumPatchControlPoints() > 0)
+        TrapIndirectPatchesNotSupported();
+
+    auto& bufferMT      = LLGL_HOT_CAST(MTBuffer&, buffer);
+    auto& countBufferMT = LLGL_HOT_CAST(MTBuffer&, countBuffer);
+    context_.ExecuteIndirectCountDraws(
+        bufferMT.GetNative(),
+        static_cast<NSUInteger>(offset),
+        countBufferMT.GetNative(),
+        static_cast<NSUInteger>(countOffset),
+        static_cast<NSUInteger>(maxNumCommands),
+        static_cast<NSUInteger>(stride),
+        /*indexed:*/ false
+    );
+}
+
+//TODO: support patches with indirect arguments
+void MTDirectCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    if (context_.GetNumPatchControlPoints() > 0)
+        TrapIndirectPatchesNotSupported();
+
+    auto& bufferMT      = LLGL_HOT_CAST(MTBuffer&, buffer);
+    auto& countBufferMT = LLGL_HOT_CAST(MTBuffer&, countBuffer);
+    context_.ExecuteIndirectCountDraws(
+        bufferMT.GetNative(),
+        static_cast<NSUInteger>(offset),
+        countBufferMT.GetNative(),
+        static_cast<NSUInteger>(countOffset),
+        static_cast<NSUInteger>(maxNumCommands),
+        static_cast<NSUInteger>(stride),
+        /*indexed:*/ true
+    );
+}
+
 void MTDirectCommandBuffer::DrawStreamOutput()
 {
-    LLGL_TRAP("stream-outputs not supported");
+    if (!DrawComputeStreamOutput())
+        LLGL_TRAP("stream-outputs not supported");
+}
+
+void MTDirectCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    if (@available(iOS 16.0, macOS 13.0, *))
+    {
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        [renderEncoder
+            drawMeshThreadgroups:           MTLSizeMake(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ)
+            threadsPerObjectThreadgroup:    context_.GetThreadsPerObjectThreadgroup()
+            threadsPerMeshThreadgroup:      context_.GetThreadsPerMeshThreadgroup()
+        ];
+    }
+}
+
+void MTDirectCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    if (@available(iOS 16.0, macOS 13.0, *))
+    {
+        auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        for_range(i, numCommands)
+        {
+            [renderEncoder
+                drawMeshThreadgroupsWithIndirectBuffer: bufferMT.GetNative()
+                indirectBufferOffset:                   static_cast<NSUInteger>(offset)
+                threadsPerObjectThreadgroup:            context_.GetThreadsPerObjectThreadgroup()
+                threadsPerMeshThreadgroup:              context_.GetThreadsPerMeshThreadgroup()
+            ];
+            offset += stride;
+        }
+    }
+}
+
+void MTDirectCommandBuffer::DispatchTiles()
+{
+    if (@available(iOS 11.0, macOS 11.0, *))
+    {
+        auto renderEncoder = context_.FlushAndGetRenderEncoder();
+        [renderEncoder dispatchThreadsPerTile:context_.GetThreadsPerTile()];
+    }
+}
+
+void MTDirectCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
+{
+    // dummy
 }
 
 /* ----- Compute ----- */
@@ -1016,7 +1230,7 @@ void MTDirectCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t
 
 void MTDirectCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     auto computeEncoder = context_.FlushAndGetComputeEncoder();
     [computeEncoder
         dispatchThreadgroupsWithIndirectBuffer: bufferMT.GetNative()
@@ -1025,6 +1239,24 @@ void MTDirectCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offse
     ];
 }
 
+/* ----- Ray Tracing ----- */
+
+void MTDirectCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    /* Acceleration structures are not implemented for Metal yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("acceleration structures not supported by Metal backend\n");
+}
+
+void MTDirectCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    /* Ray tracing PSOs are not implemented for Metal yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("ray tracing not supported by Metal backend\n");
+}
+
 /* ----- Debugging ----- */
 
 void MTDirectCommandBuffer::PushDebugGroup(const char* name)
@@ -1079,7 +1311,8 @@ bool MTDirectCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nati
         else
             nativeHandleMT->commandEncoder = nil;
 
-        nativeHandleMT->renderPassDesc = context_.RetainRenderPassDescOrNull();
+        nativeHandleMT->renderPassDesc          = context_.RetainRenderPassDescOrNull();
+        nativeHandleMT->indirectCommandBuffer   = nil;
         return true;
     }
     return false;
@@ -11,7 +11,9 @@
 
 #include "MTCommandBuffer.h"
 #include "MTCommandOpcode.h"
+#include "../Buffer/MTIndirectCommandBuffer.h"
 #include "../../VirtualCommandBuffer.h"
+#include <vector>
 
 
 namespace LLGL
@@ -20,6 +22,8 @@ namespace LLGL
 
 using MTVirtualCommandBuffer = VirtualCommandBuffer<MTOpcode>;
 
+struct MTCmdExecuteIndirectCommands;
+
 class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
 {
 
@@ -27,6 +31,11 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
 
         #include <LLGL/Backend/CommandBuffer.inl>
 
+    public:
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+        void AliasingBarrier(Texture* textureBefore, Texture* textureAfter) override;
+
     public:
 
         MTMultiSubmitCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc);
@@ -43,6 +52,31 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
             return buffer_;
         }
 
+        /*
+        Returns true if this is a secondary command buffer that only encodes commands for a render command encoder.
+        Such command buffers can be encoded into a sub-encoder of a MTLParallelRenderCommandEncoder.
+        */
+        inline bool IsParallelEncodable() const
+        {
+            return (isSecondaryCmdBuffer_ && isParallelEncodable_);
+        }
+
+    private:
+
+        // Draw command that is baked into the ICB of this command buffer (see CommandBufferFlags::BakeDrawCommands).
+        struct BakedDrawCommand
+        {
+            MTLPrimitiveType    primitiveType;
+            id<MTLBuffer>       indexBuffer;        // Null for non-indexed draw commands.
+            NSUInteger          indexBufferOffset;
+            MTLIndexType        indexType;
+            NSUInteger          start;              // First vertex or index.
+            NSUInteger          count;              // Number of vertices or indices.
+            NSUInteger          instanceCount;
+            NSInteger           baseVertex;
+            NSUInteger          baseInstance;
+        };
+
     private:
 
         void QueueDrawable(MTKView* view);
@@ -57,6 +91,12 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
 
         void ReleaseIntermediateResources();
 
+        // Returns a new baked draw command or null if the next draw command cannot be baked into the ICB.
+        BakedDrawCommand* AllocBakedDrawCommand(bool indexed);
+
+        // Encodes all baked draw commands into a new ICB on the CPU.
+        void EncodeBakedDrawCommands();
+
         // Allocates only an opcode for empty commands.
         void AllocOpcode(const MTOpcode opcode);
 
@@ -67,13 +107,25 @@ class MTMultiSubmitCommandBuffer final : public MTCommandBuffer
     private:
 
         const bool                      isSecondaryCmdBuffer_   = false;
+        const bool                      bakeDrawCommands_       = false;
 
         MTVirtualCommandBuffer          buffer_;
         MTOpcode                        lastOpcode_             = MTOpcodeNop;
+        bool                            isParallelEncodable_    = true;     // False if any command requires a compute or blit command encoder.
 
         SmallVector<MTKView*, 2>        views_;
         SmallVector<id<MTLTexture>, 2>  intermediateTextures_;
 
+        MTIndirectCommandBuffer         bakedCmdBuffer_;
+        std::vector<BakedDrawCommand>   bakedDrawCommands_;
+        MTCmdExecuteIndirectCommands*   lastExecuteCmd_         = nullptr;
+
+        // Render states that are tracked to bake draw commands
+        const MTGraphicsPSO*            boundGraphicsPSO_       = nullptr;
+        id<MTLBuffer>                   boundIndexBuffer_       = nil;
+        NSUInteger                      boundIndexBufferOffset_ = 0;
+        bool                            boundIndexType16Bits_   = false;
+
 };
 
 
@@ -10,6 +10,7 @@
 #include "MTCommandQueue.h"
 #include "../MTSwapChain.h"
 #include "../MTTypes.h"
+#include "../MTFeatureSet.h"
 #include "../Buffer/MTBuffer.h"
 #include "../Buffer/MTBufferArray.h"
 #include "../RenderState/MTGraphicsPSO.h"
@@ -25,7 +26,9 @@
 #include "../../CheckedCast.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Log.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Backend/Metal/NativeHandle.h>
 #include <algorithm>
 #include <limits.h>
 
@@ -34,9 +37,18 @@ namespace LLGL
 {
 
 
+// Returns true if draw commands of a multi-submit command buffer with the specified flags can be baked into an ICB.
+static bool CanBakeDrawCommands(id<MTLDevice> device, long flags)
+{
+    const long requiredFlags = (CommandBufferFlags::MultiSubmit | CommandBufferFlags::BakeDrawCommands);
+    return ((flags & requiredFlags) == requiredFlags && SupportsIndirectCountDrawing(device));
+}
+
 MTMultiSubmitCommandBuffer::MTMultiSubmitCommandBuffer(id<MTLDevice> device, const CommandBufferDescriptor& desc) :
     MTCommandBuffer       { device, desc.flags                                  },
-    isSecondaryCmdBuffer_ { ((desc.flags & CommandBufferFlags::Secondary) != 0) }
+    isSecondaryCmdBuffer_ { ((desc.flags & CommandBufferFlags::Secondary) != 0) },
+    bakeDrawCommands_     { CanBakeDrawCommands(device, desc.flags)             },
+    bakedCmdBuffer_       { device, MTLResourceStorageModeShared                }
 {
 }
 
@@ -50,9 +62,18 @@ MTMultiSubmitCommandBuffer::~MTMultiSubmitCommandBuffer()
 void MTMultiSubmitCommandBuffer::Begin()
 {
     buffer_.Clear();
-    lastOpcode_ = MTOpcodeNop;
+    lastOpcode_             = MTOpcodeNop;
+    isParallelEncodable_    = true;
     ResetRenderStates();
     ReleaseIntermediateResources();
+
+    /* Reset baked draw commands and tracked render states */
+    bakedDrawCommands_.clear();
+    lastExecuteCmd_         = nullptr;
+    boundGraphicsPSO_       = nullptr;
+    boundIndexBuffer_       = nil;
+    boundIndexBufferOffset_ = 0;
+    boundIndexType16Bits_   = false;
 }
 
 void MTMultiSubmitCommandBuffer::End()
@@ -64,18 +85,23 @@ void MTMultiSubmitCommandBuffer::End()
         PresentDrawables();
     }
     buffer_.Pack();
+    lastExecuteCmd_ = nullptr;
+
+    /* Encode baked draw commands into ICB once, so they don't have to be encoded again on each submission */
+    if (!bakedDrawCommands_.empty())
+        EncodeBakedDrawCommands();
 }
 
 void MTMultiSubmitCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
     if (IsPrimary())
     {
-        auto& commandBufferMT = LLGL_CAST(MTCommandBuffer&, secondaryCommandBuffer);
+        auto& commandBufferMT = LLGL_HOT_CAST(MTCommandBuffer&, secondaryCommandBuffer);
         if (commandBufferMT.IsMultiSubmitCmdBuffer() && !commandBufferMT.IsPrimary())
         {
             auto cmd = AllocCommand<MTCmdExecute>(MTOpcodeExecute);
             {
-                cmd->commandBuffer = LLGL_CAST(MTMultiSubmitCommandBuffer*, &commandBufferMT);
+                cmd->commandBuffer = LLGL_HOT_CAST(MTMultiSubmitCommandBuffer*, &commandBufferMT);
             }
         }
     }
@@ -89,7 +115,7 @@ void MTMultiSubmitCommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
 
     /* Copy data to staging buffer */
     id<MTLBuffer> srcBuffer = nil;
@@ -115,8 +141,8 @@ void MTMultiSubmitCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
-    auto& srcBufferMT = LLGL_CAST(MTBuffer&, srcBuffer);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
+    auto& srcBufferMT = LLGL_HOT_CAST(MTBuffer&, srcBuffer);
 
     auto cmd = AllocCommand<MTCmdCopyBuffer>(MTOpcodeCopyBuffer);
     {
@@ -136,8 +162,8 @@ void MTMultiSubmitCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
-    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
+    auto& srcTextureMT = LLGL_HOT_CAST(MTTexture&, srcTexture);
 
     /* Determine actual row and layer strides */
     if (rowStride == 0)
@@ -178,7 +204,7 @@ void MTMultiSubmitCommandBuffer::FillBuffer(
     if (fillSize == 0)
         return;
 
-    auto& dstBufferMT = LLGL_CAST(MTBuffer&, dstBuffer);
+    auto& dstBufferMT = LLGL_HOT_CAST(MTBuffer&, dstBuffer);
 
     /* Check if native "fillBuffer" command can be used */
     const bool valueBytesAreEqual =
@@ -218,8 +244,8 @@ void MTMultiSubmitCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
-    auto& srcTextureMT = LLGL_CAST(MTTexture&, srcTexture);
+    auto& dstTextureMT = LLGL_HOT_CAST(MTTexture&, dstTexture);
+    auto& srcTextureMT = LLGL_HOT_CAST(MTTexture&, srcTexture);
 
     MTLOrigin srcOrigin, dstOrigin;
     MTTypes::Convert(srcOrigin, srcLocation.offset);
@@ -250,8 +276,8 @@ void MTMultiSubmitCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
-    auto& srcBufferMT = LLGL_CAST(MTBuffer&, srcBuffer);
+    auto& dstTextureMT = LLGL_HOT_CAST(MTTexture&, dstTexture);
+    auto& srcBufferMT = LLGL_HOT_CAST(MTBuffer&, srcBuffer);
 
     /* Determine actual row and layer strides */
     if (rowStride == 0)
@@ -295,7 +321,7 @@ void MTMultiSubmitCommandBuffer::CopyTextureFromFramebuffer(
         return /*Out of bounds*/;
     }
 
-    auto& dstTextureMT = LLGL_CAST(MTTexture&, dstTexture);
+    auto& dstTextureMT = LLGL_HOT_CAST(MTTexture&, dstTexture);
     id<MTLTexture> targetTexture = dstTextureMT.GetNative();
 
     /* Convert texture region and source origin */
@@ -324,13 +350,13 @@ void MTMultiSubmitCommandBuffer::CopyTextureFromFramebuffer(
 
 void MTMultiSubmitCommandBuffer::GenerateMips(Texture& texture)
 {
-    auto& textureMT = LLGL_CAST(MTTexture&, texture);
+    auto& textureMT = LLGL_HOT_CAST(MTTexture&, texture);
     GenerateMipmapsForTexture(textureMT.GetNative());
 }
 
 void MTMultiSubmitCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
-    auto& textureMT = LLGL_CAST(MTTexture&, texture);
+    auto& textureMT = LLGL_HOT_CAST(MTTexture&, texture);
     if (subresource.numMipLevels > 1)
     {
         // Create temporary subresource texture to generate MIP-maps only on that range
@@ -385,20 +411,22 @@ void MTMultiSubmitCommandBuffer::SetNativeVertexBuffers(NSUInteger count, const
 
 void MTMultiSubmitCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     id<MTLBuffer> bufferId = bufferMT.GetNative();
     const NSUInteger bufferOffset = 0;
     SetNativeVertexBuffers(1, &bufferId, &bufferOffset);
+    SetComputeStreamOutputBuffer(&bufferMT);
 }
 
 void MTMultiSubmitCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
-    auto& bufferArrayMT = LLGL_CAST(MTBufferArray&, bufferArray);
+    auto& bufferArrayMT = LLGL_HOT_CAST(MTBufferArray&, bufferArray);
     SetNativeVertexBuffers(
         static_cast<NSUInteger>(bufferArrayMT.GetIDArray().size()),
         bufferArrayMT.GetIDArray().data(),
         bufferArrayMT.GetOffsets().data()
     );
+    SetComputeStreamOutputBuffer(nullptr);
 }
 
 //private
@@ -410,17 +438,21 @@ void MTMultiSubmitCommandBuffer::SetNativeIndexBuffer(id<MTLBuffer> buffer, NSUI
         cmd->offset             = offset;
         cmd->indexType16Bits    = indexType16Bits;
     }
+
+    boundIndexBuffer_       = buffer;
+    boundIndexBufferOffset_ = offset;
+    boundIndexType16Bits_   = indexType16Bits;
 }
 
 void MTMultiSubmitCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     SetNativeIndexBuffer(bufferMT.GetNative(), 0, bufferMT.IsIndexType16Bits());
 }
 
 void MTMultiSubmitCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     SetNativeIndexBuffer(bufferMT.GetNative(), static_cast<NSUInteger>(offset), (format == Format::R16UInt));
 }
 
@@ -428,7 +460,7 @@ void MTMultiSubmitCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format for
 
 void MTMultiSubmitCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
-    auto& resourceHeapMT = LLGL_CAST(MTResourceHeap&, resourceHeap);
+    auto& resourceHeapMT = LLGL_HOT_CAST(MTResourceHeap&, resourceHeap);
     auto cmd = AllocCommand<MTCmdSetResourceHeap>(MTOpcodeSetResourceHeap);
     {
         cmd->resourceHeap   = &resourceHeapMT;
@@ -445,13 +477,39 @@ void MTMultiSubmitCommandBuffer::SetResource(std::uint32_t descriptor, Resource&
     }
 }
 
+void MTMultiSubmitCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t /*size*/)
+{
+    auto cmd = AllocCommand<MTCmdSetConstantBufferRange>(MTOpcodeSetConstantBufferRange);
+    {
+        cmd->descriptor = descriptor;
+        cmd->buffer     = &buffer;
+        cmd->offset     = static_cast<NSUInteger>(offset);
+    }
+}
+
 void MTMultiSubmitCommandBuffer::ResourceBarrier(
-    std::uint32_t       /*numBuffers*/,
-    Buffer* const *     /*buffers*/,
-    std::uint32_t       /*numTextures*/,
-    Texture* const *    /*textures*/)
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
+{
+    /* Metal tracks hazards of all other resources automatically */
+    SmallVector<id<MTLResource>> resources;
+    GetUntrackedResources(numBuffers, buffers, numTextures, textures, resources);
+    if (!resources.empty())
+    {
+        const NSUInteger count = resources.size();
+        auto cmd = AllocCommand<MTCmdResourceBarrier>(MTOpcodeResourceBarrier, sizeof(id)*count);
+        {
+            cmd->count = count;
+            ::memcpy(cmd + 1, resources.data(), sizeof(id)*count);
+        }
+    }
+}
+
+void MTMultiSubmitCommandBuffer::AliasingBarrier(Texture* /*textureBefore*/, Texture* /*textureAfter*/)
 {
-    // dummy
+    AllocOpcode(MTOpcodeAliasingBarrier);
 }
 
 /* ----- Render Passes ----- */
@@ -466,7 +524,7 @@ void MTMultiSubmitCommandBuffer::BeginRenderPass(
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Put current drawable into queue */
-        auto& swapChainMT = LLGL_CAST(MTSwapChain&, renderTarget);
+        auto& swapChainMT = LLGL_HOT_CAST(MTSwapChain&, renderTarget);
         QueueDrawable(swapChainMT.GetMTKView());
     }
 
@@ -476,7 +534,7 @@ void MTMultiSubmitCommandBuffer::BeginRenderPass(
         cmd->renderTarget = &renderTarget;
         if (renderPass != nullptr)
         {
-            cmd->renderPass     = LLGL_CAST(const MTRenderPass*, renderPass);
+            cmd->renderPass     = LLGL_HOT_CAST(const MTRenderPass*, renderPass);
             cmd->numClearValues = numClearValues;
             ::memcpy(cmd + 1, clearValues, sizeof(ClearValue)*numClearValues);
         }
@@ -556,18 +614,23 @@ void MTMultiSubmitCommandBuffer::ClearAttachments(std::uint32_t numAttachments,
 
 void MTMultiSubmitCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    auto& pipelineStateMT = LLGL_CAST(MTPipelineState&, pipelineState);
+    auto& pipelineStateMT = LLGL_HOT_CAST(MTPipelineState&, pipelineState);
     if (pipelineStateMT.IsGraphicsPSO())
     {
         /* Set graphics pipeline with encoder scheduler */
         auto cmd = AllocCommand<MTCmdSetGraphicsPSO>(MTOpcodeSetGraphicsPSO);
-        cmd->graphicsPSO = LLGL_CAST(MTGraphicsPSO*, &pipelineStateMT);
+        cmd->graphicsPSO = LLGL_HOT_CAST(MTGraphicsPSO*, &pipelineStateMT);
+        boundGraphicsPSO_ = cmd->graphicsPSO;
+
+        /* Tessellation is dispatched with a compute command encoder before each draw command */
+        if (cmd->graphicsPSO->GetNumPatchControlPoints() > 0)
+            isParallelEncodable_ = false;
     }
     else
     {
         /* Set compute pipeline with encoder scheduler */
         auto cmd = AllocCommand<MTCmdSetComputePSO>(MTOpcodeSetComputePSO);
-        cmd->computePSO = LLGL_CAST(MTComputePSO*, &pipelineStateMT);
+        cmd->computePSO = LLGL_HOT_CAST(MTComputePSO*, &pipelineStateMT);
     }
 }
 
@@ -591,6 +654,11 @@ void MTMultiSubmitCommandBuffer::SetStencilReference(std::uint32_t reference, co
     }
 }
 
+void MTMultiSubmitCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // dummy - rasterization rate maps are not exposed as per-draw shading rates
+}
+
 void MTMultiSubmitCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     auto cmd = AllocCommand<MTCmdSetUniforms>(MTOpcodeSetUniforms, dataSize);
@@ -613,6 +681,11 @@ void MTMultiSubmitCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t qu
     //todo
 }
 
+void MTMultiSubmitCommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    //todo
+}
+
 void MTMultiSubmitCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     //todo
@@ -639,25 +712,12 @@ void MTMultiSubmitCommandBuffer::EndStreamOutput()
 
 void MTMultiSubmitCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
-    auto cmd = AllocCommand<MTCmdDraw>(MTOpcodeDraw);
-    {
-        cmd->vertexStart    = static_cast<NSUInteger>(firstVertex);
-        cmd->vertexCount    = static_cast<NSUInteger>(numVertices);
-        cmd->instanceCount  = 1;
-        cmd->baseInstance   = 0;
-    }
+    MTMultiSubmitCommandBuffer::DrawInstanced(numVertices, firstVertex, /*numInstances:*/ 1, /*firstInstance:*/ 0);
 }
 
 void MTMultiSubmitCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
-    auto cmd = AllocCommand<MTCmdDrawIndexed>(MTOpcodeDrawIndexed);
-    {
-        cmd->indexCount     = static_cast<NSUInteger>(numIndices);
-        cmd->firstIndex     = static_cast<NSUInteger>(firstIndex);
-        cmd->instanceCount  = 1;
-        cmd->baseVertex     = 0;
-        cmd->baseInstance   = 0;
-    }
+    MTMultiSubmitCommandBuffer::DrawIndexedInstanced(numIndices, /*numInstances:*/ 1, firstIndex, /*vertexOffset:*/ 0, /*firstInstance:*/ 0);
 }
 
 void MTMultiSubmitCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
@@ -672,6 +732,16 @@ void MTMultiSubmitCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::u
 
 void MTMultiSubmitCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    if (BakedDrawCommand* draw = AllocBakedDrawCommand(false))
+    {
+        draw->start         = static_cast<NSUInteger>(firstVertex);
+        draw->count         = static_cast<NSUInteger>(numVertices);
+        draw->instanceCount = static_cast<NSUInteger>(numInstances);
+        draw->baseVertex    = 0;
+        draw->baseInstance  = static_cast<NSUInteger>(firstInstance);
+        return;
+    }
+
     auto cmd = AllocCommand<MTCmdDraw>(MTOpcodeDraw);
     {
         cmd->vertexStart    = static_cast<NSUInteger>(firstVertex);
@@ -693,6 +763,16 @@ void MTMultiSubmitCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices,
 
 void MTMultiSubmitCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    if (BakedDrawCommand* draw = AllocBakedDrawCommand(true))
+    {
+        draw->start         = static_cast<NSUInteger>(firstIndex);
+        draw->count         = static_cast<NSUInteger>(numIndices);
+        draw->instanceCount = static_cast<NSUInteger>(numInstances);
+        draw->baseVertex    = static_cast<NSInteger>(vertexOffset);
+        draw->baseInstance  = static_cast<NSUInteger>(firstInstance);
+        return;
+    }
+
     auto cmd = AllocCommand<MTCmdDrawIndexed>(MTOpcodeDrawIndexed);
     {
         cmd->indexCount     = static_cast<NSUInteger>(numIndices);
@@ -703,171 +783,130 @@ void MTMultiSubmitCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices,
     }
 }
 
-#if 0 //TODO
-[[noreturn]]
-static void TrapIndirectPatchesNotSupported()
+/* Tessellation with indirect arguments is not supported yet, which is only known when the commands are executed (see MTCommandExecutor) */
+
+void MTMultiSubmitCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    LLGL_TRAP("tessellation with indirect arguments not supported in Metal backend yet");
+    MTMultiSubmitCommandBuffer::DrawIndirect(buffer, offset, /*numCommands:*/ 1, /*stride:*/ 0);
 }
-#endif
 
-//TODO: support patches with indirect arguments
-void MTMultiSubmitCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+void MTMultiSubmitCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-#if 0 //TODO
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
-    const NSUInteger numPatchControlPoints = GetNumPatchControlPoints();
-    if (numPatchControlPoints > 0)
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
+    auto cmd = AllocCommand<MTCmdDrawIndirect>(MTOpcodeDrawIndirect);
     {
-        #if 0 //TODO
-        [renderEncoder
-            drawPatches:            numPatchControlPoints
-            patchIndexBuffer:       nil
-            patchIndexBufferOffset: 0
-            indirectBuffer:         bufferMT.GetNative()
-            indirectBufferOffset:   static_cast<NSUInteger>(offset)
-        ];
-        #else
-        TrapIndirectPatchesNotSupported();
-        #endif
-    }
-    else
-    {
-        auto renderEncoder = context_.FlushAndGetRenderEncoder();
-        [renderEncoder
-            drawPrimitives:         GetPrimitiveType()
-            indirectBuffer:         bufferMT.GetNative()
-            indirectBufferOffset:   static_cast<NSUInteger>(offset)
-        ];
+        cmd->indirectBuffer         = bufferMT.GetNative();
+        cmd->indirectBufferOffset   = static_cast<NSUInteger>(offset);
+        cmd->numCommands            = static_cast<NSUInteger>(numCommands);
+        cmd->stride                 = static_cast<NSUInteger>(stride);
     }
-#endif
 }
 
-//TODO: support patches with indirect arguments
-void MTMultiSubmitCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
-#if 0 //TODO
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
-    const NSUInteger numPatchControlPoints = GetNumPatchControlPoints();
-    if (numPatchControlPoints > 0)
+    MTMultiSubmitCommandBuffer::DrawIndexedIndirect(buffer, offset, /*numCommands:*/ 1, /*stride:*/ 0);
+}
+
+void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
+    auto cmd = AllocCommand<MTCmdDrawIndirect>(MTOpcodeDrawIndexedIndirect);
     {
-        #if 0 //TODO
-        while (numCommands-- > 0)
-        {
-            [renderEncoder
-                drawPatches:            numPatchControlPoints
-                patchIndexBuffer:       nil
-                patchIndexBufferOffset: 0
-                indirectBuffer:         bufferMT.GetNative()
-                indirectBufferOffset:   static_cast<NSUInteger>(offset)
-            ];
-            offset += stride;
-        }
-        #else
-        TrapIndirectPatchesNotSupported();
-        #endif
+        cmd->indirectBuffer         = bufferMT.GetNative();
+        cmd->indirectBufferOffset   = static_cast<NSUInteger>(offset);
+        cmd->numCommands            = static_cast<NSUInteger>(numCommands);
+        cmd->stride                 = static_cast<NSUInteger>(stride);
     }
-    else
+}
+
+void MTMultiSubmitCommandBuffer::DrawIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    auto& bufferMT      = LLGL_HOT_CAST(MTBuffer&, buffer);
+    auto& countBufferMT = LLGL_HOT_CAST(MTBuffer&, countBuffer);
+    auto cmd = AllocCommand<MTCmdDrawIndirectCount>(MTOpcodeDrawIndirectCount);
     {
-        auto renderEncoder = context_.FlushAndGetRenderEncoder();
-        while (numCommands-- > 0)
-        {
-            [renderEncoder
-                drawPrimitives:         GetPrimitiveType()
-                indirectBuffer:         bufferMT.GetNative()
-                indirectBufferOffset:   static_cast<NSUInteger>(offset)
-            ];
-            offset += stride;
-        }
+        cmd->indirectBuffer         = bufferMT.GetNative();
+        cmd->indirectBufferOffset   = static_cast<NSUInteger>(offset);
+        cmd->countBuffer            = countBufferMT.GetNative();
+        cmd->countBufferOffset      = static_cast<NSUInteger>(countOffset);
+        cmd->maxNumCommands         = static_cast<NSUInteger>(maxNumCommands);
+        cmd->stride                 = static_cast<NSUInteger>(stride);
+        cmd->indexed                = false;
     }
-#endif
 }
 
-//TODO: support patches with indirect arguments
-void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+void MTMultiSubmitCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
 {
-#if 0 //TODO
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
-    const NSUInteger numPatchControlPoints = GetNumPatchControlPoints();
-    if (numPatchControlPoints > 0)
+    auto& bufferMT      = LLGL_HOT_CAST(MTBuffer&, buffer);
+    auto& countBufferMT = LLGL_HOT_CAST(MTBuffer&, countBuffer);
+    auto cmd = AllocCommand<MTCmdDrawIndirectCount>(MTOpcodeDrawIndirectCount);
     {
-        #if 0 //TODO
-        [renderEncoder
-            drawIndexedPatches:             numPatchControlPoints
-            patchIndexBuffer:               nil
-            patchIndexBufferOffset:         0
-            controlPointIndexBuffer:        GetIndexBuffer()
-            controlPointIndexBufferOffset:  0
-            indirectBuffer:                 bufferMT.GetNative()
-            indirectBufferOffset:           static_cast<NSUInteger>(offset)
-        ];
-        #else
-        TrapIndirectPatchesNotSupported();
-        #endif
+        cmd->indirectBuffer         = bufferMT.GetNative();
+        cmd->indirectBufferOffset   = static_cast<NSUInteger>(offset);
+        cmd->countBuffer            = countBufferMT.GetNative();
+        cmd->countBufferOffset      = static_cast<NSUInteger>(countOffset);
+        cmd->maxNumCommands         = static_cast<NSUInteger>(maxNumCommands);
+        cmd->stride                 = static_cast<NSUInteger>(stride);
+        cmd->indexed                = true;
     }
-    else
+}
+
+void MTMultiSubmitCommandBuffer::DrawStreamOutput()
+{
+    if (!DrawComputeStreamOutput())
+        LLGL_TRAP("stream-outputs not supported");
+}
+
+void MTMultiSubmitCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    auto cmd = AllocCommand<MTCmdDrawMeshThreadgroups>(MTOpcodeDrawMeshThreadgroups);
     {
-        auto renderEncoder = context_.FlushAndGetRenderEncoder();
-        [renderEncoder
-            drawIndexedPrimitives:  GetPrimitiveType()
-            indexType:              GetIndexType()
-            indexBuffer:            GetIndexBuffer()
-            indexBufferOffset:      0
-            indirectBuffer:         bufferMT.GetNative()
-            indirectBufferOffset:   static_cast<NSUInteger>(offset)
-        ];
+        cmd->threadgroups = MTLSizeMake(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
     }
-#endif
 }
 
-//TODO: support patches with indirect arguments
-void MTMultiSubmitCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+void MTMultiSubmitCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-#if 0 //TODO
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
-    const NSUInteger numPatchControlPoints = GetNumPatchControlPoints();
-    if (numPatchControlPoints > 0)
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
+    auto cmd = AllocCommand<MTCmdDrawIndirect>(MTOpcodeDrawMeshThreadgroupsIndirect);
     {
-        #if 0 //TODO
-        while (numCommands-- > 0)
-        {
-            [renderEncoder
-                drawIndexedPatches:             numPatchControlPoints
-                patchIndexBuffer:               nil
-                patchIndexBufferOffset:         0
-                controlPointIndexBuffer:        GetIndexBuffer()
-                controlPointIndexBufferOffset:  0
-                indirectBuffer:                 bufferMT.GetNative()
-                indirectBufferOffset:           static_cast<NSUInteger>(offset)
-            ];
-            offset += stride;
-        }
-        #else
-        TrapIndirectPatchesNotSupported();
-        #endif
+        cmd->indirectBuffer         = bufferMT.GetNative();
+        cmd->indirectBufferOffset   = static_cast<NSUInteger>(offset);
+        cmd->numCommands            = static_cast<NSUInteger>(numCommands);
+        cmd->stride                 = static_cast<NSUInteger>(stride);
     }
-    else
+}
+
+void MTMultiSubmitCommandBuffer::DispatchTiles()
+{
+    /* Tile dispatches are not part of the render encoder opcodes, so they are never encoded with parallel render encoders */
+    auto cmd = AllocCommand<MTCmdDispatchTiles>(MTOpcodeDispatchTiles);
     {
-        auto renderEncoder = context_.FlushAndGetRenderEncoder();
-        while (numCommands-- > 0)
-        {
-            [renderEncoder
-                drawIndexedPrimitives:  GetPrimitiveType()
-                indexType:              GetIndexType()
-                indexBuffer:            GetIndexBuffer()
-                indexBufferOffset:      0
-                indirectBuffer:         bufferMT.GetNative()
-                indirectBufferOffset:   static_cast<NSUInteger>(offset)
-            ];
-            offset += stride;
-        }
+        cmd->threadsPerTile = (boundGraphicsPSO_ != nullptr ? boundGraphicsPSO_->GetThreadsPerTile() : MTLSizeMake(1, 1, 1));
     }
-#endif
 }
 
-void MTMultiSubmitCommandBuffer::DrawStreamOutput()
+void MTMultiSubmitCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
 {
-    LLGL_TRAP("stream-outputs not supported");
+    // dummy
 }
 
 /* ----- Compute ----- */
@@ -882,7 +921,7 @@ void MTMultiSubmitCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uin
 
 void MTMultiSubmitCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    auto& bufferMT = LLGL_HOT_CAST(MTBuffer&, buffer);
     auto cmd = AllocCommand<MTCmdDispatchThreadsIndirect>(MTOpcodeDispatchThreadgroupsIndirect);
     {
         cmd->indirectBuffer         = bufferMT.GetNative();
@@ -890,6 +929,24 @@ void MTMultiSubmitCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+/* ----- Ray Tracing ----- */
+
+void MTMultiSubmitCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    /* Acceleration structures are not implemented for Metal yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("acceleration structures not supported by Metal backend\n");
+}
+
+void MTMultiSubmitCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    /* Ray tracing PSOs are not implemented for Metal yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("ray tracing not supported by Metal backend\n");
+}
+
 /* ----- Debugging ----- */
 
 void MTMultiSubmitCommandBuffer::PushDebugGroup(const char* name)
@@ -920,7 +977,20 @@ void MTMultiSubmitCommandBuffer::DoNativeCommand(const void* nativeCommand, std:
 
 bool MTMultiSubmitCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
 {
-    return false; // dummy - command is only allowed in immediate command buffer
+    /* Only the ICB of baked draw commands can be queried from a multi-submit command buffer */
+    if (bakeDrawCommands_ && nativeHandle != nullptr && nativeHandleSize == sizeof(Metal::CommandBufferNativeHandle))
+    {
+        auto* nativeHandleMT = static_cast<Metal::CommandBufferNativeHandle*>(nativeHandle);
+
+        nativeHandleMT->commandBuffer           = nil;
+        nativeHandleMT->commandEncoder          = nil;
+        nativeHandleMT->renderPassDesc          = nil;
+        nativeHandleMT->indirectCommandBuffer   = bakedCmdBuffer_.GetNative();
+        [nativeHandleMT->indirectCommandBuffer retain];
+
+        return true;
+    }
+    return false;
 }
 
 
@@ -1037,8 +1107,130 @@ void MTMultiSubmitCommandBuffer::ReleaseIntermediateResources()
     intermediateTextures_.clear();
 }
 
+MTMultiSubmitCommandBuffer::BakedDrawCommand* MTMultiSubmitCommandBuffer::AllocBakedDrawCommand(bool indexed)
+{
+    /* Draw commands with tessellation or without a known PSO or index buffer must be encoded on each submission */
+    if (!bakeDrawCommands_ || boundGraphicsPSO_ == nullptr || boundGraphicsPSO_->GetNumPatchControlPoints() > 0)
+        return nullptr;
+    if (indexed && boundIndexBuffer_ == nil)
+        return nullptr;
+
+    /* Append to previous range of ICB commands if no other command was encoded in between */
+    if (lastOpcode_ != MTOpcodeExecuteIndirectCommands || lastExecuteCmd_ == nullptr)
+    {
+        lastExecuteCmd_ = AllocCommand<MTCmdExecuteIndirectCommands>(MTOpcodeExecuteIndirectCommands);
+        {
+            lastExecuteCmd_->indirectCmdBuffer  = &bakedCmdBuffer_;
+            lastExecuteCmd_->firstCommand       = static_cast<NSUInteger>(bakedDrawCommands_.size());
+            lastExecuteCmd_->numCommands        = 0;
+            lastExecuteCmd_->hasIndexedDraws    = false;
+        }
+    }
+
+    lastExecuteCmd_->numCommands++;
+    if (indexed)
+        lastExecuteCmd_->hasIndexedDraws = true;
+
+    /* Store draw command with the render states it depends on */
+    bakedDrawCommands_.push_back({});
+    BakedDrawCommand& draw = bakedDrawCommands_.back();
+    {
+        draw.primitiveType = boundGraphicsPSO_->GetMTLPrimitiveType();
+        if (indexed)
+        {
+            draw.indexBuffer        = boundIndexBuffer_;
+            draw.indexBufferOffset  = boundIndexBufferOffset_;
+            draw.indexType          = (boundIndexType16Bits_ ? MTLIndexTypeUInt16 : MTLIndexTypeUInt32);
+        }
+        else
+        {
+            draw.indexBuffer        = nil;
+            draw.indexBufferOffset  = 0;
+            draw.indexType          = MTLIndexTypeUInt32;
+        }
+    }
+    return &draw;
+}
+
+void MTMultiSubmitCommandBuffer::EncodeBakedDrawCommands()
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        /* Allocate new ICB, since the previous one might still be used by command buffers in flight */
+        const NSUInteger numCommands = static_cast<NSUInteger>(bakedDrawCommands_.size());
+        bakedCmdBuffer_.Resize(numCommands);
+
+        id<MTLIndirectCommandBuffer> icb = bakedCmdBuffer_.GetNative();
+        for_range(i, numCommands)
+        {
+            const BakedDrawCommand& draw = bakedDrawCommands_[i];
+            id<MTLIndirectRenderCommand> icbCmd = [icb indirectRenderCommandAtIndex:i];
+            if (draw.indexBuffer != nil)
+            {
+                const NSUInteger indexTypeSize = (draw.indexType == MTLIndexTypeUInt16 ? 2 : 4);
+                [icbCmd
+                    drawIndexedPrimitives:  draw.primitiveType
+                    indexCount:             draw.count
+                    indexType:              draw.indexType
+                    indexBuffer:            draw.indexBuffer
+                    indexBufferOffset:      draw.indexBufferOffset + draw.start * indexTypeSize
+                    instanceCount:          draw.instanceCount
+                    baseVertex:             draw.baseVertex
+                    baseInstance:           draw.baseInstance
+                ];
+            }
+            else
+            {
+                [icbCmd
+                    drawPrimitives: draw.primitiveType
+                    vertexStart:    draw.start
+                    vertexCount:    draw.count
+                    instanceCount:  draw.instanceCount
+                    baseInstance:   draw.baseInstance
+                ];
+            }
+        }
+    }
+    bakedDrawCommands_.clear();
+}
+
+// Returns true if the specified opcode is only executed with a render command encoder.
+static bool IsRenderEncoderOpcode(const MTOpcode opcode)
+{
+    switch (opcode)
+    {
+        case MTOpcodeNop:
+        case MTOpcodeSetGraphicsPSO:
+        case MTOpcodeSetViewports:
+        case MTOpcodeSetScissorRects:
+        case MTOpcodeSetBlendColor:
+        case MTOpcodeSetStencilRef:
+        case MTOpcodeSetUniforms:
+        case MTOpcodeSetVertexBuffers:
+        case MTOpcodeSetIndexBuffer:
+        case MTOpcodeSetResourceHeap:
+        case MTOpcodeSetResource:
+        case MTOpcodeSetConstantBufferRange:
+        case MTOpcodeDraw:
+        case MTOpcodeDrawIndexed:
+        case MTOpcodeDrawIndirect:
+        case MTOpcodeDrawIndexedIndirect:
+        case MTOpcodeDrawMeshThreadgroups:
+        case MTOpcodeDrawMeshThreadgroupsIndirect:
+        case MTOpcodeExecuteIndirectCommands:
+        case MTOpcodePushDebugGroup:
+        case MTOpcodePopDebugGroup:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void MTMultiSubmitCommandBuffer::AllocOpcode(const MTOpcode opcode)
 {
+    if (!IsRenderEncoderOpcode(opcode))
+        isParallelEncodable_ = false;
+
     /* Redundant single-opcode instructions can be ignored (such as MTOpcodeFlush) */
     if (lastOpcode_ != opcode)
     {
@@ -1050,6 +1242,8 @@ void MTMultiSubmitCommandBuffer::AllocOpcode(const MTOpcode opcode)
 template <typename TCommand>
 TCommand* MTMultiSubmitCommandBuffer::AllocCommand(const MTOpcode opcode, std::size_t payloadSize)
 {
+    if (!IsRenderEncoderOpcode(opcode))
+        isParallelEncodable_ = false;
     lastOpcode_ = opcode;
     return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
 }
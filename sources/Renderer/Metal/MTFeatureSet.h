@@ -20,6 +20,36 @@ namespace LLGL
 
 void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapabilities& caps);
 
+// Returns true if the specified device supports indirect command buffers (ICB) that are encoded on the GPU, which is required for indirect count draw commands.
+bool SupportsIndirectCountDrawing(id<MTLDevice> device);
+
+// Returns true if the specified device supports render pipelines with object and mesh functions.
+bool SupportsMeshShaders(id<MTLDevice> device);
+
+// Returns true if the specified device supports render pipelines with tile functions that are dispatched inside a render pass.
+bool SupportsTileShaders(id<MTLDevice> device);
+
+// Returns true if the specified device supports acceleration structures and ray intersection.
+bool SupportsRayTracing(id<MTLDevice> device);
+
+// Returns true if the specified device supports ray intersection from fragment functions in addition to compute functions.
+bool SupportsRayQuery(id<MTLDevice> device);
+
+// Returns true if the specified device supports fragment functions that read the color attachments via the [[color(n)]] attribute.
+bool SupportsFramebufferFetch(id<MTLDevice> device);
+
+// Returns true if the specified device supports Tier 2 argument buffers, which is required for bindless resource heaps.
+bool SupportsArgumentBuffersTier2(id<MTLDevice> device);
+
+// Returns true if the specified device supports placement heaps with untracked resources, which is required for placed textures.
+bool SupportsPlacementHeaps(id<MTLDevice> device);
+
+// Returns true if the specified device supports binary archives, which is required for pipeline caches.
+bool SupportsBinaryArchives(id<MTLDevice> device);
+
+// Returns true if the specified device supports textures in memoryless storage mode, which is used for transient attachments.
+bool SupportsMemorylessTextures(id<MTLDevice> device);
+
 
 } // /namespace LLGL
 
@@ -67,6 +67,8 @@ static std::vector<Format> GetDefaultSupportedMTTextureFormats()
         Format::BC3UNorm,           Format::BC3UNorm_sRGB,
         Format::BC4UNorm,           Format::BC4SNorm,
         Format::BC5UNorm,           Format::BC5SNorm,
+        Format::BC6HUFloat,         Format::BC6HSFloat,
+        Format::BC7UNorm,           Format::BC7UNorm_sRGB,
         #endif
 
         Format::ASTC4x4,            Format::ASTC4x4_sRGB,
@@ -85,9 +87,23 @@ static std::vector<Format> GetDefaultSupportedMTTextureFormats()
         Format::ASTC12x12,          Format::ASTC12x12_sRGB,
 
         Format::ETC2UNorm,          Format::ETC2UNorm_sRGB,
+        Format::ETC2A1UNorm,        Format::ETC2A1UNorm_sRGB,
+        Format::ETC2A8UNorm,        Format::ETC2A8UNorm_sRGB,
+        Format::EACR11UNorm,        Format::EACR11SNorm,
+        Format::EACRG11UNorm,       Format::EACRG11SNorm,
     };
 }
 
+// ASTC HDR blocks are only supported on Apple6 (A13) GPUs and later
+static bool SupportsASTCHDRTextures(id<MTLDevice> device)
+{
+    #ifdef LLGL_OS_IOS
+    if (@available(iOS 13.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple6];
+    #endif
+    return false;
+}
+
 static NSUInteger GetMaxMTBufferSize(id<MTLDevice> device)
 {
     /* Assume minimum of 256 MB (268,435,456 bytes) if maxBufferLength is not supported */
@@ -98,6 +114,170 @@ static NSUInteger GetMaxMTBufferSize(id<MTLDevice> device)
         return minBufferSize256MB;
 }
 
+bool SupportsIndirectCountDrawing(id<MTLDevice> device)
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        #ifdef LLGL_OS_IOS
+        return [device supportsFamily:MTLGPUFamilyApple4];
+        #else
+        return [device supportsFamily:MTLGPUFamilyMac2];
+        #endif
+    }
+    return false;
+}
+
+bool SupportsMeshShaders(id<MTLDevice> device)
+{
+    if (@available(iOS 16.0, macOS 13.0, *))
+        return [device supportsFamily:MTLGPUFamilyMetal3];
+    return false;
+}
+
+bool SupportsRayTracing(id<MTLDevice> device)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+        return [device supportsRaytracing];
+    return false;
+}
+
+bool SupportsRayQuery(id<MTLDevice> device)
+{
+    if (@available(iOS 17.0, macOS 12.0, *))
+        return ([device supportsRaytracing] && [device supportsRaytracingFromRender]);
+    return false;
+}
+
+bool SupportsTileShaders(id<MTLDevice> device)
+{
+    if (@available(iOS 13.0, macOS 11.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple4];
+    return false;
+}
+
+bool SupportsFramebufferFetch(id<MTLDevice> device)
+{
+    /* Programmable blending is available on all Apple GPUs, but not on immediate-mode GPUs of Mac family */
+    if (@available(iOS 13.0, macOS 11.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple1];
+    return false;
+}
+
+bool SupportsArgumentBuffersTier2(id<MTLDevice> device)
+{
+    if (@available(iOS 11.0, macOS 10.13, *))
+        return ([device argumentBuffersSupport] >= MTLArgumentBuffersTier2);
+    return false;
+}
+
+bool SupportsPlacementHeaps(id<MTLDevice> /*device*/)
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+        return true;
+    return false;
+}
+
+bool SupportsBinaryArchives(id<MTLDevice> /*device*/)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+        return true;
+    return false;
+}
+
+bool SupportsMemorylessTextures(id<MTLDevice> device)
+{
+    /* Memoryless storage mode is only available on Apple GPUs with tile memory */
+    if (@available(iOS 13.0, macOS 11.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple1];
+    return false;
+}
+
+// Returns the maximum vertex amplification count for multiview rendering, or 0 if vertex amplification is not supported.
+static std::uint32_t GetMaxVertexAmplificationCount(id<MTLDevice> device)
+{
+    if (@available(iOS 13.0, macOS 10.15.4, *))
+    {
+        for (NSUInteger count = 8; count >= 2; --count)
+        {
+            if ([device supportsVertexAmplificationCount:count])
+                return static_cast<std::uint32_t>(count);
+        }
+    }
+    return 0;
+}
+
+static bool SupportsSparseTextures(id<MTLDevice> device)
+{
+    if (@available(iOS 13.0, macOS 11.0, *))
+        return [device supportsFamily:MTLGPUFamilyApple6];
+    return false;
+}
+
+static std::uint32_t GetSparseTileSize(id<MTLDevice> device)
+{
+    if (@available(iOS 13.0, macOS 11.0, *))
+    {
+        if (SupportsSparseTextures(device))
+            return static_cast<std::uint32_t>([device sparseTileSizeInBytes]);
+    }
+    return 0;
+}
+
+// Returns the SIMD-group operations of the specified device; see "SIMD-scoped permute/reduction operations" in the Metal feature set tables.
+static long GetSubgroupOperationFlags(id<MTLDevice> device)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        if ([device supportsFamily:MTLGPUFamilyApple7] || [device supportsFamily:MTLGPUFamilyMac2])
+        {
+            return
+            (
+                SubgroupOperationFlags::Basic           |
+                SubgroupOperationFlags::Vote            |
+                SubgroupOperationFlags::Arithmetic      |
+                SubgroupOperationFlags::Ballot          |
+                SubgroupOperationFlags::Shuffle         |
+                SubgroupOperationFlags::ShuffleRelative |
+                SubgroupOperationFlags::Quad
+            );
+        }
+    }
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        if ([device supportsFamily:MTLGPUFamilyApple6])
+        {
+            return
+            (
+                SubgroupOperationFlags::Basic           |
+                SubgroupOperationFlags::Vote            |
+                SubgroupOperationFlags::Ballot          |
+                SubgroupOperationFlags::Shuffle         |
+                SubgroupOperationFlags::ShuffleRelative |
+                SubgroupOperationFlags::Quad
+            );
+        }
+        if ([device supportsFamily:MTLGPUFamilyApple4])
+            return SubgroupOperationFlags::Quad;
+    }
+    return 0;
+}
+
+static void GetSubgroupSizeRange(id<MTLDevice> device, std::uint32_t (&outSizeRange)[2])
+{
+    /* Apple GPUs have a fixed SIMD-group width of 32, while the width of other GPUs is only known per PSO (threadExecutionWidth) */
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        if ([device supportsFamily:MTLGPUFamilyApple1])
+        {
+            outSizeRange[0] = 32u;
+            outSizeRange[1] = 32u;
+            return;
+        }
+    }
+    outSizeRange[0] = 8u;
+    outSizeRange[1] = 64u;
+}
+
 // see https://developer.apple.com/metal/Metal-Feature-Set-Tables.pdf
 void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapabilities& caps)
 {
@@ -108,6 +288,12 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     /* Query supported hardware texture formats */
     caps.textureFormats = GetDefaultSupportedMTTextureFormats();
 
+    if (SupportsASTCHDRTextures(device))
+    {
+        for (int i = static_cast<int>(Format::ASTC4x4Float); i <= static_cast<int>(Format::ASTC12x12Float); ++i)
+            caps.textureFormats.push_back(static_cast<Format>(i));
+    }
+
     /* Specify supported shading languages */
     const int version = FeatureSetToVersion(fset);
 
@@ -150,6 +336,24 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     features.hasConservativeRasterization   = false;
     features.hasStreamOutputs               = false;
     features.hasLogicOp                     = false;
+    features.hasPipelineCaching             = SupportsBinaryArchives(device);
+    features.hasIndirectCountDrawing        = SupportsIndirectCountDrawing(device);
+    features.hasQueryResolve                = true;
+    features.hasBindlessResourceHeaps       = SupportsArgumentBuffersTier2(device);
+    features.hasTransientBuffers            = true;
+    features.hasPersistentMapping           = true;
+    features.hasSparseTextures              = SupportsSparseTextures(device);
+    features.hasPlacementHeaps              = SupportsPlacementHeaps(device);
+    features.hasSharedResources             = true;
+    features.hasConcurrentResourceCreation  = true;
+    features.hasMeshShaders                 = SupportsMeshShaders(device);
+    features.hasTileShaders                 = SupportsTileShaders(device);
+    features.hasFramebufferFetch            = SupportsFramebufferFetch(device);
+    features.hasVariableRateShading         = false;
+    features.hasIndirectStateChanges        = false;
+    features.hasRayTracing                  = false; // Acceleration structures and ray tracing PSOs are not implemented for Metal yet, see SupportsRayTracing()
+    features.hasRayQuery                    = false; // Acceleration structure bindings are not implemented for Metal yet, see SupportsRayQuery()
+    features.hasMultiview                   = (GetMaxVertexAmplificationCount(device) >= 2);
 
     /* Specify limits */
     auto& limits = caps.limits;
@@ -165,6 +369,8 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     limits.maxViewportSize[0]               = 16384u; //???
     limits.maxViewportSize[1]               = 16384u; //???
     limits.maxColorAttachments              = 8u;
+    limits.maxBindlessResourceViews         = (features.hasBindlessResourceHeaps ? 500000u : 0u);
+    limits.maxMultiviewViewCount            = GetMaxVertexAmplificationCount(device);
 
     limits.maxComputeShaderWorkGroups[0]    = 512u; //???
     limits.maxComputeShaderWorkGroups[1]    = 512u; //???
@@ -175,6 +381,11 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     limits.maxComputeShaderWorkGroupSize[1] = static_cast<std::uint32_t>(workGroupSize.height);
     limits.maxComputeShaderWorkGroupSize[2] = static_cast<std::uint32_t>(workGroupSize.depth);
 
+    if (@available(iOS 11.0, macOS 10.13, *))
+        limits.maxComputeShaderSharedMemorySize = static_cast<std::uint32_t>([device maxThreadgroupMemoryLength]);
+    else
+        limits.maxComputeShaderSharedMemorySize = 16384u;
+
     #ifdef LLGL_OS_IOS
     limits.maxTessFactor                    = 16u;
     #else
@@ -196,6 +407,15 @@ void LoadFeatureSetCaps(id<MTLDevice> device, MTLFeatureSet fset, RenderingCapab
     caps.limits.maxNoAttachmentSamples      = static_cast<std::uint32_t>(maxSamples);
 
     caps.limits.storageResourceStageFlags   = StageFlags::AllStages;
+    caps.limits.sparseTileSize              = GetSparseTileSize(device);
+
+    /* SIMD-group functions are only available in kernel and fragment functions */
+    caps.limits.subgroupOperationFlags      = GetSubgroupOperationFlags(device);
+    if (caps.limits.subgroupOperationFlags != 0)
+    {
+        caps.limits.subgroupStageFlags      = (StageFlags::ComputeStage | StageFlags::FragmentStage);
+        GetSubgroupSizeRange(device, caps.limits.subgroupSizeRange);
+    }
 }
 
 
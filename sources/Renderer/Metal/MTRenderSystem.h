@@ -22,8 +22,10 @@
 #include "Buffer/MTBuffer.h"
 #include "Buffer/MTBufferArray.h"
 #include "Buffer/MTIntermediateBuffer.h"
+#include "Buffer/MTHeapAllocator.h"
 
 #include "RenderState/MTPipelineLayout.h"
+#include "RenderState/MTPipelineCache.h"
 #include "RenderState/MTPipelineState.h"
 #include "RenderState/MTQueryHeap.h"
 #include "RenderState/MTResourceHeap.h"
@@ -31,10 +33,12 @@
 #include "RenderState/MTFence.h"
 
 #include "Shader/MTShader.h"
+#include "Shader/MTLibraryCache.h"
 
 #include "Texture/MTTexture.h"
 #include "Texture/MTSampler.h"
 #include "Texture/MTRenderTarget.h"
+#include "Texture/MTPlacementHeap.h"
 
 #include <memory>
 
@@ -50,6 +54,22 @@ class MTRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        PlacementHeap* CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc) override;
+
+        void Release(PlacementHeap& placementHeap) override;
+
+        MemoryRequirements GetTextureMemoryRequirements(const TextureDescriptor& textureDesc) override;
+
+        Texture* CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc) override;
+
+        bool ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle) override;
+
+        Texture* ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle) override;
+
+        Buffer* ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle) override;
+
     public:
 
         MTRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
@@ -61,7 +81,7 @@ class MTRenderSystem final : public RenderSystem
 
     private:
 
-        void CreateDeviceResources(id<MTLDevice> sharedDevice = nil);
+        void CreateDeviceResources(id<MTLDevice> sharedDevice = nil, int adapterIndex = -1);
         void QueryRendererInfo(RendererInfo& outInfo);
 
         const char* QueryMetalVersion() const;
@@ -70,31 +90,38 @@ class MTRenderSystem final : public RenderSystem
 
         const MTRenderPass* GetDefaultRenderPass() const;
 
+        // Returns the specified pipeline cache as Metal pipeline cache or null if pipeline caching is not supported.
+        MTPipelineCache* GetMTPipelineCache(PipelineCache* pipelineCache);
+
     private:
 
         /* ----- Common objects ----- */
 
         id<MTLDevice>                           device_             = nil;
         std::unique_ptr<MTIntermediateBuffer>   intermediateBuffer_;
+        std::unique_ptr<MTHeapAllocator>        bufferHeapAllocator_;
+        MTLibraryCache                          libraryCache_;
 
         /* ----- Hardware object containers ----- */
 
-        HWObjectContainer<MTSwapChain>          swapChains_;
-        HWObjectInstance<MTCommandQueue>        commandQueue_;
-        HWObjectContainer<MTCommandBuffer>      commandBuffers_;
-        HWObjectContainer<MTBuffer>             buffers_;
-        HWObjectContainer<MTBufferArray>        bufferArrays_;
-        HWObjectContainer<MTTexture>            textures_;
-        HWObjectContainer<MTSampler>            samplers_;
-        HWObjectContainer<MTRenderPass>         renderPasses_;
-        HWObjectContainer<MTRenderTarget>       renderTargets_;
-        HWObjectContainer<MTShader>             shaders_;
-        HWObjectContainer<MTPipelineLayout>     pipelineLayouts_;
-        HWObjectInstance<ProxyPipelineCache>    pipelineCacheProxy_;
-        HWObjectContainer<MTPipelineState>  	pipelineStates_;
-        HWObjectContainer<MTResourceHeap>       resourceHeaps_;
-        HWObjectContainer<MTQueryHeap>          queryHeaps_;
-        HWObjectContainer<MTFence>              fences_;
+        HWObjectContainer<MTSwapChain>                swapChains_;
+        HWObjectInstance<MTCommandQueue>              commandQueue_;
+        HWObjectContainer<MTCommandBuffer>            commandBuffers_;
+        ConcurrentHWObjectContainer<MTBuffer>         buffers_;
+        HWObjectContainer<MTBufferArray>              bufferArrays_;
+        ConcurrentHWObjectContainer<MTTexture>        textures_;
+        HWObjectContainer<MTPlacementHeap>            placementHeaps_;
+        ConcurrentHWObjectContainer<MTSampler>        samplers_;
+        HWObjectContainer<MTRenderPass>               renderPasses_;
+        HWObjectContainer<MTRenderTarget>             renderTargets_;
+        ConcurrentHWObjectContainer<MTShader>         shaders_;
+        ConcurrentHWObjectContainer<MTPipelineLayout> pipelineLayouts_;
+        HWObjectContainer<MTPipelineCache>            pipelineCaches_;
+        HWObjectInstance<ProxyPipelineCache>          pipelineCacheProxy_;
+        ConcurrentHWObjectContainer<MTPipelineState>  pipelineStates_;
+        HWObjectContainer<MTResourceHeap>             resourceHeaps_;
+        HWObjectContainer<MTQueryHeap>                queryHeaps_;
+        HWObjectContainer<MTFence>                    fences_;
 
 };
 
@@ -20,6 +20,7 @@
 #include "RenderState/MTComputePSO.h"
 #include "RenderState/MTBuiltinPSOFactory.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/Log.h>
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Backend/Metal/NativeHandle.h>
 #include <AvailabilityMacros.h>
@@ -31,12 +32,69 @@ namespace LLGL
 
 /* ----- Common ----- */
 
+static void ConvertMTAdapterInfo(id<MTLDevice> device, AdapterInfo& outInfo)
+{
+    outInfo.name = [[device name] UTF8String];
+
+    if (@available(macOS 10.13, iOS 11.0, *))
+        outInfo.luid = static_cast<std::uint64_t>([device registryID]);
+
+    if (@available(macOS 10.12, iOS 16.0, *))
+    {
+        /* Devices with unified memory have no dedicated video memory */
+        const std::uint64_t workingSetSize = static_cast<std::uint64_t>([device recommendedMaxWorkingSetSize]);
+        if (@available(macOS 10.15, iOS 13.0, *))
+        {
+            if ([device hasUnifiedMemory])
+                outInfo.sharedMemory = workingSetSize;
+            else
+                outInfo.videoMemory = workingSetSize;
+        }
+        else
+            outInfo.videoMemory = workingSetSize;
+    }
+}
+
+// Returns all Metal devices in the same order as they are selected by RenderSystemDescriptor::adapterIndex.
+static std::vector<AdapterInfo> GetMTAdapterInfos(id<MTLDevice> activeDevice)
+{
+    std::vector<AdapterInfo> adapters;
+
+    #ifdef LLGL_OS_MACOS
+
+    NSArray<id<MTLDevice>>* devices = MTLCopyAllDevices();
+    adapters.resize(static_cast<std::size_t>([devices count]));
+    for (NSUInteger i = 0; i < [devices count]; ++i)
+    {
+        id<MTLDevice> device = [devices objectAtIndex:i];
+        ConvertMTAdapterInfo(device, adapters[i]);
+        adapters[i].isActive = (device == activeDevice);
+    }
+    [devices release];
+
+    #else
+
+    /* Mobile platforms only provide the system default device */
+    if (activeDevice != nil)
+    {
+        adapters.resize(1);
+        ConvertMTAdapterInfo(activeDevice, adapters[0]);
+        adapters[0].isActive = true;
+    }
+
+    #endif
+
+    return adapters;
+}
+
 MTRenderSystem::MTRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
 {
     if (auto* customNativeHandle = GetRendererNativeHandle<Metal::RenderSystemNativeHandle>(renderSystemDesc))
         CreateDeviceResources(customNativeHandle->device);
+    else if (IsAdapterSelectedByID(renderSystemDesc))
+        CreateDeviceResources(nil, SelectAdapterIndex(renderSystemDesc, GetMTAdapterInfos(nil)));
     else
-        CreateDeviceResources();
+        CreateDeviceResources(nil, renderSystemDesc.adapterIndex);
 }
 
 MTRenderSystem::~MTRenderSystem()
@@ -89,7 +147,15 @@ void MTRenderSystem::Release(CommandBuffer& commandBuffer)
 Buffer* MTRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, GetRenderingCaps().limits.maxBufferSize);
-    return buffers_.emplace<MTBuffer>(device_, bufferDesc, initialData);
+    auto* bufferMT = buffers_.emplace<MTBuffer>(device_, bufferDesc, initialData, bufferHeapAllocator_.get());
+    CheckMemoryBudget();
+    return bufferMT;
+}
+
+void MTRenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    for (std::size_t i = 0; i < bufferDescs.size(); ++i)
+        outBuffers[i] = CreateBuffer(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr));
 }
 
 BufferArray* MTRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -103,6 +169,12 @@ void MTRenderSystem::Release(Buffer& buffer)
     buffers_.erase(&buffer);
 }
 
+void MTRenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    for (Buffer* buffer : buffers)
+        Release(*buffer);
+}
+
 void MTRenderSystem::Release(BufferArray& bufferArray)
 {
     bufferArrays_.erase(&bufferArray);
@@ -124,15 +196,22 @@ void MTRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 
 void* MTRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
-    commandQueue_->WaitIdle();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+
+    /* Persistently mapped buffers can be accessed while the GPU is using them; synchronization is up to the client */
+    if (!bufferMT.IsPersistent())
+        commandQueue_->WaitIdle();
+
     return bufferMT.Map(access);
 }
 
 void* MTRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
-    commandQueue_->WaitIdle();
     auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+
+    if (!bufferMT.IsPersistent())
+        commandQueue_->WaitIdle();
+
     return bufferMT.Map(access, static_cast<NSUInteger>(offset), static_cast<NSUInteger>(length));
 }
 
@@ -148,7 +227,9 @@ Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
 {
     auto* textureMT = textures_.emplace<MTTexture>(device_, textureDesc);
 
-    if (initialImage != nullptr)
+    if (textureMT->IsSparse())
+        commandQueue_->MapSparseMipTail(*textureMT);
+    else if (initialImage != nullptr)
     {
         textureMT->WriteRegion(
             //TextureRegion{ Offset3D{ 0, 0, 0 }, textureMT->GetMipExtent(0) },
@@ -174,14 +255,28 @@ Texture* MTRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
         }
     }
 
+    CheckMemoryBudget();
+
     return textureMT;
 }
 
+void MTRenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    for (std::size_t i = 0; i < textureDescs.size(); ++i)
+        outTextures[i] = CreateTexture(textureDescs[i], (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr));
+}
+
 void MTRenderSystem::Release(Texture& texture)
 {
     textures_.erase(&texture);
 }
 
+void MTRenderSystem::Release(const ArrayView<Texture*>& textures)
+{
+    for (Texture* texture : textures)
+        Release(*texture);
+}
+
 void MTRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
     commandQueue_->WaitIdle();
@@ -196,6 +291,71 @@ void MTRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     textureMT.ReadRegion(textureRegion, dstImageView, commandQueue_->GetNative(), intermediateBuffer_.get());
 }
 
+/* ----- Placement Heaps ----- */
+
+PlacementHeap* MTRenderSystem::CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc)
+{
+    if (!SupportsPlacementHeaps(device_))
+        return nullptr;
+    auto* placementHeapMT = placementHeaps_.emplace<MTPlacementHeap>(device_, placementHeapDesc);
+    CheckMemoryBudget();
+    return placementHeapMT;
+}
+
+void MTRenderSystem::Release(PlacementHeap& placementHeap)
+{
+    /* Placed textures retain their native heap, so command buffers in flight keep the memory alive */
+    placementHeaps_.erase(&placementHeap);
+}
+
+MemoryRequirements MTRenderSystem::GetTextureMemoryRequirements(const TextureDescriptor& textureDesc)
+{
+    const MTLSizeAndAlign sizeAndAlign = MTTexture::GetPlacedSizeAndAlign(device_, textureDesc);
+    MemoryRequirements requirements;
+    {
+        requirements.size       = sizeAndAlign.size;
+        requirements.alignment  = sizeAndAlign.align;
+    }
+    return requirements;
+}
+
+Texture* MTRenderSystem::CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    /* Placed textures have no initial data; their content is undefined until the first aliasing barrier or write */
+    auto& placementHeapMT = LLGL_CAST(MTPlacementHeap&, placementHeap);
+    return textures_.emplace<MTTexture>(device_, textureDesc, placementHeapMT, static_cast<NSUInteger>(offset));
+}
+
+bool MTRenderSystem::ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle)
+{
+    /* Only textures can be shared via IOSurface; the caller must release the surface with CFRelease() */
+    if (resource.GetResourceType() != ResourceType::Texture)
+        return false;
+
+    IOSurfaceRef ioSurface = LLGL_CAST(MTTexture&, resource).GetIOSurface();
+    if (ioSurface == nullptr)
+        return false;
+
+    CFRetain(ioSurface);
+    outHandle.type      = SharedHandleType::IOSurface;
+    outHandle.handle    = (void*)ioSurface;
+    outHandle.size      = static_cast<std::uint64_t>(IOSurfaceGetAllocSize(ioSurface));
+    return true;
+}
+
+Texture* MTRenderSystem::ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle)
+{
+    if (sharedHandle.type != SharedHandleType::IOSurface || sharedHandle.handle == nullptr)
+        return nullptr;
+    return textures_.emplace<MTTexture>(device_, textureDesc, (IOSurfaceRef)sharedHandle.handle);
+}
+
+Buffer* MTRenderSystem::ImportBuffer(const BufferDescriptor& /*bufferDesc*/, const SharedResourceHandle& /*sharedHandle*/)
+{
+    /* Metal buffers cannot be backed by IOSurfaces */
+    return nullptr;
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* MTRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
@@ -212,7 +372,7 @@ void MTRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* MTRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<MTResourceHeap>(resourceHeapDesc, initialResourceViews);
+    return resourceHeaps_.emplace<MTResourceHeap>(device_, resourceHeapDesc, initialResourceViews);
 }
 
 void MTRenderSystem::Release(ResourceHeap& resourceHeap)
@@ -255,7 +415,13 @@ void MTRenderSystem::Release(RenderTarget& renderTarget)
 Shader* MTRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
     RenderSystem::AssertCreateShader(shaderDesc);
-    return shaders_.emplace<MTShader>(device_, shaderDesc);
+    return shaders_.emplace<MTShader>(device_, shaderDesc, &libraryCache_);
+}
+
+void MTRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    for (std::size_t i = 0; i < shaderDescs.size(); ++i)
+        outShaders[i] = CreateShader(shaderDescs[i]);
 }
 
 void MTRenderSystem::Release(Shader& shader)
@@ -277,26 +443,51 @@ void MTRenderSystem::Release(PipelineLayout& pipelineLayout)
 
 /* ----- Pipeline Caches ----- */
 
-PipelineCache* MTRenderSystem::CreatePipelineCache(const Blob& /*initialBlob*/)
+PipelineCache* MTRenderSystem::CreatePipelineCache(const Blob& initialBlob)
 {
-    return ProxyPipelineCache::CreateInstance(pipelineCacheProxy_);
+    if (GetRenderingCaps().features.hasPipelineCaching)
+        return pipelineCaches_.emplace<MTPipelineCache>(device_, initialBlob);
+    else
+        return ProxyPipelineCache::CreateInstance(pipelineCacheProxy_);
 }
 
 void MTRenderSystem::Release(PipelineCache& pipelineCache)
 {
-    ProxyPipelineCache::ReleaseInstance(pipelineCacheProxy_, pipelineCache);
+    if (GetRenderingCaps().features.hasPipelineCaching)
+        pipelineCaches_.erase(&pipelineCache);
+    else
+        ProxyPipelineCache::ReleaseInstance(pipelineCacheProxy_, pipelineCache);
 }
 
 /* ----- Pipeline States ----- */
 
-PipelineState* MTRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+PipelineState* MTRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    return pipelineStates_.emplace<MTGraphicsPSO>(device_, pipelineStateDesc, GetDefaultRenderPass(), GetMTPipelineCache(pipelineCache));
+}
+
+PipelineState* MTRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    return pipelineStates_.emplace<MTComputePSO>(device_, pipelineStateDesc, GetMTPipelineCache(pipelineCache));
+}
+
+void MTRenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<MTGraphicsPSO>(device_, pipelineStateDesc, GetDefaultRenderPass());
+    for (std::size_t i = 0; i < pipelineStateDescs.size(); ++i)
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
 }
 
-PipelineState* MTRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+void MTRenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
 {
-    return pipelineStates_.emplace<MTComputePSO>(device_, pipelineStateDesc);
+    for (std::size_t i = 0; i < pipelineStateDescs.size(); ++i)
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+PipelineState* MTRenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& /*pipelineStateDesc*/, PipelineCache* /*pipelineCache*/)
+{
+    /* Ray tracing pipelines are not implemented for Metal yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("ray tracing pipelines not supported by Metal backend\n");
+    return nullptr;
 }
 
 void MTRenderSystem::Release(PipelineState& pipelineState)
@@ -347,13 +538,27 @@ bool MTRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
  * ======= Private: =======
  */
 
-void MTRenderSystem::CreateDeviceResources(id<MTLDevice> sharedDevice)
+void MTRenderSystem::CreateDeviceResources(id<MTLDevice> sharedDevice, int adapterIndex)
 {
     if (sharedDevice != nil)
     {
         /* Take shard Metal device and increment reference counter */
         device_ = [sharedDevice retain];
     }
+    #ifdef LLGL_OS_MACOS
+    else if (adapterIndex >= 0)
+    {
+        /* Pick Metal device by its index */
+        NSArray<id<MTLDevice>>* devices = MTLCopyAllDevices();
+        if (static_cast<NSUInteger>(adapterIndex) >= [devices count])
+        {
+            [devices release];
+            LLGL_TRAP("video adapter index %d out of range", adapterIndex);
+        }
+        device_ = [[devices objectAtIndex:static_cast<NSUInteger>(adapterIndex)] retain];
+        [devices release];
+    }
+    #endif
     else
     {
         /* Create Metal device */
@@ -371,6 +576,9 @@ void MTRenderSystem::CreateDeviceResources(id<MTLDevice> sharedDevice)
     /* Initialize intermediate buffer */
     constexpr NSUInteger intermediateBufferAlignment = 256u;
     intermediateBuffer_ = MakeUnique<MTIntermediateBuffer>(device_, MTLResourceStorageModeShared, intermediateBufferAlignment);
+
+    /* Initialize heap allocator to sub-allocate small buffers in shared storage */
+    bufferHeapAllocator_ = MakeUnique<MTHeapAllocator>(device_, MTLStorageModeShared);
 }
 
 void MTRenderSystem::QueryRendererInfo(RendererInfo& info)
@@ -379,6 +587,12 @@ void MTRenderSystem::QueryRendererInfo(RendererInfo& info)
     info.deviceName             = [[device_ name] cStringUsingEncoding:NSUTF8StringEncoding];
     info.vendorName             = "Apple";
     info.shadingLanguageName    = "Metal Shading Language";
+
+    /* Binary archives are invalidated by a different device or OS version */
+    std::string cacheID = [[device_ name] UTF8String];
+    cacheID += ';';
+    cacheID += [[[NSProcessInfo processInfo] operatingSystemVersionString] UTF8String];
+    info.pipelineCacheID.assign(cacheID.begin(), cacheID.end());
 }
 
 bool MTRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabilities* outCaps)
@@ -390,6 +604,31 @@ bool MTRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabi
     return true;
 }
 
+std::uint32_t MTRenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos)
+{
+    /* Metal only reports a single working set for the entire device */
+    if (outHeapInfos != nullptr && maxHeapInfos > 0)
+    {
+        MemoryHeapInfo& heapInfo = outHeapInfos[0];
+        heapInfo.flags = MemoryHeapFlags::DeviceLocal;
+
+        if (@available(macOS 10.13, iOS 11.0, *))
+            heapInfo.usage = static_cast<std::uint64_t>([device_ currentAllocatedSize]);
+
+        if (@available(macOS 10.12, iOS 16.0, *))
+        {
+            heapInfo.size   = static_cast<std::uint64_t>([device_ recommendedMaxWorkingSetSize]);
+            heapInfo.budget = heapInfo.size;
+        }
+    }
+    return 1;
+}
+
+std::uint32_t MTRenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    return CopyAdapterInfos(GetMTAdapterInfos(device_), outAdapters, maxAdapters);
+}
+
 const char* MTRenderSystem::QueryMetalVersion() const
 {
     const MTLFeatureSet featureSet = QueryHighestFeatureSet();
@@ -540,6 +779,14 @@ const MTRenderPass* MTRenderSystem::GetDefaultRenderPass() const
     return nullptr;
 }
 
+MTPipelineCache* MTRenderSystem::GetMTPipelineCache(PipelineCache* pipelineCache)
+{
+    /* Without binary archive support, the input can only be the proxy pipeline cache */
+    if (pipelineCache != nullptr && GetRenderingCaps().features.hasPipelineCaching)
+        return LLGL_CAST(MTPipelineCache*, pipelineCache);
+    return nullptr;
+}
+
 
 } // /namespace LLGL
 
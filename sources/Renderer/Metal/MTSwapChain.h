@@ -33,6 +33,12 @@ class MTSwapChain final : public SwapChain
 
         #include <LLGL/Backend/SwapChain.inl>
 
+    public:
+
+        bool GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        ColorSpace GetColorSpace() const override;
+
     public:
 
         MTSwapChain(
@@ -42,6 +48,8 @@ class MTSwapChain final : public SwapChain
             const RendererInfo&             rendererInfo
         );
 
+        ~MTSwapChain();
+
     public:
 
         // Updates the native render pass descriptor with the specified clear values. Returns null on failure.
@@ -70,14 +78,28 @@ class MTSwapChain final : public SwapChain
 
         bool ResizeBuffersPrimary(const Extent2D& resolution) override;
 
+        // Selects the color space of the view's CAMetalLayer and enables extended dynamic range for HDR color spaces.
+        void SetupLayerColorSpace(ColorSpace colorSpace);
+
+        // Keeps track of the current drawable and records the presentation times of previous drawables into the frame statistics.
+        void RecordDrawablePresentedTimes();
+
     private:
 
+        static constexpr std::uint32_t maxNumPendingDrawables = 4;
+
         MTKView*                    view_                       = nullptr;
         MTSwapChainViewDelegate*    viewDelegate_               = nullptr;
 
         MTLRenderPassDescriptor*    nativeMutableRenderPass_    = nullptr; // Cannot be id<>
         MTRenderPass                renderPass_;
 
+        id<MTLDrawable>             pendingDrawables_[maxNumPendingDrawables]       = {}; // Drawables whose presentation time is not yet known
+        std::uint64_t               pendingPresentCounts_[maxNumPendingDrawables]   = {};
+        std::uint64_t               presentCount_                                   = 0;
+
+        ColorSpace                  colorSpace_                                     = ColorSpace::SRGB;
+
 };
 
 
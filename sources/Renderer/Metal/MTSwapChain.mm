@@ -10,8 +10,11 @@
 #include "RenderState/MTRenderPass.h"
 #include "../TextureUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/CoreUtils.h"
 #include <LLGL/Platform/NativeHandle.h>
+#include <LLGL/Backend/Metal/NativeHandle.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 #ifdef LLGL_OS_IOS
@@ -70,11 +73,23 @@ MTSwapChain::MTSwapChain(
     view_.depthStencilPixelFormat   = renderPass_.GetDepthStencilFormat();
     view_.sampleCount               = renderPass_.GetSampleCount();
 
+    /* Enable extended dynamic range for HDR color spaces */
+    SetupLayerColorSpace(desc.colorSpace);
+
     /* Show default surface */
     if (!surface)
         ShowSurface();
 }
 
+MTSwapChain::~MTSwapChain()
+{
+    for (id<MTLDrawable>& drawable : pendingDrawables_)
+    {
+        if (drawable != nil)
+            [drawable release];
+    }
+}
+
 bool MTSwapChain::IsPresentable() const
 {
     return true; //TODO
@@ -82,9 +97,17 @@ bool MTSwapChain::IsPresentable() const
 
 void MTSwapChain::Present()
 {
+    BeginFrameStatisticsStall();
+
+    /* Keep track of the drawable before it's released by the view */
+    if (HasFrameStatistics())
+        RecordDrawablePresentedTimes();
+
     /* Present backbuffer */
     [view_ draw];
 
+    EndFrameStatisticsStall(true);
+
     /* Release mutable render pass as the view's render pass changes between backbuffers */
     if (nativeMutableRenderPass_ != nil)
     {
@@ -93,6 +116,22 @@ void MTSwapChain::Present()
     }
 }
 
+bool MTSwapChain::GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (auto* nativeHandleMT = GetTypedNativeHandle<Metal::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        /* Accessing the current drawable acquires it from the layer if it has not been acquired for this frame yet */
+        id<MTLTexture> drawableTexture = [[view_ currentDrawable] texture];
+        if (drawableTexture == nil)
+            return false;
+        nativeHandleMT->type    = Metal::ResourceNativeType::Texture;
+        nativeHandleMT->texture = drawableTexture;
+        [nativeHandleMT->texture retain];
+        return true;
+    }
+    return false;
+}
+
 std::uint32_t MTSwapChain::GetCurrentSwapIndex() const
 {
     return 0; // dummy
@@ -113,6 +152,11 @@ Format MTSwapChain::GetColorFormat() const
     return MTTypes::ToFormat(view_.colorPixelFormat);
 }
 
+ColorSpace MTSwapChain::GetColorSpace() const
+{
+    return colorSpace_;
+}
+
 Format MTSwapChain::GetDepthStencilFormat() const
 {
     return MTTypes::ToFormat(view_.depthStencilPixelFormat);
@@ -123,6 +167,36 @@ const RenderPass* MTSwapChain::GetRenderPass() const
     return (&renderPass_);
 }
 
+void MTSwapChain::RecordDrawablePresentedTimes()
+{
+    if (@available(macOS 10.15.4, iOS 10.3, *))
+    {
+        /* Record presentation times of previous drawables from oldest to newest; MTLDrawable.presentedTime is 0 until the drawable is shown on the display */
+        for_range(i, maxNumPendingDrawables)
+        {
+            const std::uint32_t slot = static_cast<std::uint32_t>((presentCount_ + 1 + i) % maxNumPendingDrawables);
+            if (pendingDrawables_[slot] != nil)
+            {
+                const CFTimeInterval presentedTime = pendingDrawables_[slot].presentedTime;
+                if (presentedTime > 0.0)
+                {
+                    RecordFrameDisplayTime(pendingPresentCounts_[slot], static_cast<std::uint64_t>(presentedTime * 1000000000.0));
+                    [pendingDrawables_[slot] release];
+                    pendingDrawables_[slot] = nil;
+                }
+            }
+        }
+
+        /* Track current drawable in the slot of the oldest presentation, which is dropped if it was never shown */
+        ++presentCount_;
+        const std::uint32_t slot = static_cast<std::uint32_t>(presentCount_ % maxNumPendingDrawables);
+        if (pendingDrawables_[slot] != nil)
+            [pendingDrawables_[slot] release];
+        pendingDrawables_[slot]     = [view_.currentDrawable retain];
+        pendingPresentCounts_[slot] = presentCount_;
+    }
+}
+
 static NSInteger GetPrimaryDisplayRefreshRate()
 {
     constexpr NSInteger defaultRefreshRate = 60;
@@ -197,6 +271,29 @@ static NSView* GetContentViewFromNativeHandle(const NativeHandle& nativeHandle)
 
 #endif
 
+void MTSwapChain::SetupLayerColorSpace(ColorSpace colorSpace)
+{
+    if (colorSpace == ColorSpace::SRGB)
+        return;
+
+    /* Color space and extended dynamic range of CAMetalLayer require iOS 16; The PQ color space requires macOS 11 or iOS 14 */
+    if (@available(macOS 11.0, iOS 16.0, *))
+    {
+        CGColorSpaceRef cgColorSpace = CGColorSpaceCreateWithName(
+            colorSpace == ColorSpace::HDR10 ? kCGColorSpaceITUR_2100_PQ : kCGColorSpaceExtendedLinearSRGB
+        );
+        if (cgColorSpace == nullptr)
+            return;
+
+        CAMetalLayer* metalLayer = (CAMetalLayer*)[view_ layer];
+        metalLayer.colorspace                   = cgColorSpace;
+        metalLayer.wantsExtendedDynamicRange    = YES;
+        CGColorSpaceRelease(cgColorSpace);
+
+        colorSpace_ = colorSpace;
+    }
+}
+
 MTKView* MTSwapChain::AllocMTKViewAndInitWithSurface(id<MTLDevice> device, Surface& surface)
 {
     MTKView* mtkView = nullptr;
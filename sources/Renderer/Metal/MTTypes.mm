@@ -168,6 +168,10 @@ MTLPixelFormat ToMTLPixelFormat(const Format format)
         case Format::BC4SNorm:          return MTLPixelFormatBC4_RSnorm;
         case Format::BC5UNorm:          return MTLPixelFormatBC5_RGUnorm;
         case Format::BC5SNorm:          return MTLPixelFormatBC5_RGSnorm;
+        case Format::BC6HUFloat:        return MTLPixelFormatBC6H_RGBUfloat;
+        case Format::BC6HSFloat:        return MTLPixelFormatBC6H_RGBFloat;
+        case Format::BC7UNorm:          return MTLPixelFormatBC7_RGBAUnorm;
+        case Format::BC7UNorm_sRGB:     return MTLPixelFormatBC7_RGBAUnorm_sRGB;
         #endif
 
         /* --- Advanced scalable texture compression (ASTC) formats --- */
@@ -205,6 +209,30 @@ MTLPixelFormat ToMTLPixelFormat(const Format format)
         case Format::ETC1UNorm:         break;
         case Format::ETC2UNorm:         return MTLPixelFormatETC2_RGB8;
         case Format::ETC2UNorm_sRGB:    return MTLPixelFormatETC2_RGB8_sRGB;
+        case Format::ETC2A1UNorm:       return MTLPixelFormatETC2_RGB8A1;
+        case Format::ETC2A1UNorm_sRGB:  return MTLPixelFormatETC2_RGB8A1_sRGB;
+        case Format::ETC2A8UNorm:       return MTLPixelFormatEAC_RGBA8;
+        case Format::ETC2A8UNorm_sRGB:  return MTLPixelFormatEAC_RGBA8_sRGB;
+        case Format::EACR11UNorm:       return MTLPixelFormatEAC_R11Unorm;
+        case Format::EACR11SNorm:       return MTLPixelFormatEAC_R11Snorm;
+        case Format::EACRG11UNorm:      return MTLPixelFormatEAC_RG11Unorm;
+        case Format::EACRG11SNorm:      return MTLPixelFormatEAC_RG11Snorm;
+
+        /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+        case Format::ASTC4x4Float:      return MTLPixelFormatASTC_4x4_HDR;
+        case Format::ASTC5x4Float:      return MTLPixelFormatASTC_5x4_HDR;
+        case Format::ASTC5x5Float:      return MTLPixelFormatASTC_5x5_HDR;
+        case Format::ASTC6x5Float:      return MTLPixelFormatASTC_6x5_HDR;
+        case Format::ASTC6x6Float:      return MTLPixelFormatASTC_6x6_HDR;
+        case Format::ASTC8x5Float:      return MTLPixelFormatASTC_8x5_HDR;
+        case Format::ASTC8x6Float:      return MTLPixelFormatASTC_8x6_HDR;
+        case Format::ASTC8x8Float:      return MTLPixelFormatASTC_8x8_HDR;
+        case Format::ASTC10x5Float:     return MTLPixelFormatASTC_10x5_HDR;
+        case Format::ASTC10x6Float:     return MTLPixelFormatASTC_10x6_HDR;
+        case Format::ASTC10x8Float:     return MTLPixelFormatASTC_10x8_HDR;
+        case Format::ASTC10x10Float:    return MTLPixelFormatASTC_10x10_HDR;
+        case Format::ASTC12x10Float:    return MTLPixelFormatASTC_12x10_HDR;
+        case Format::ASTC12x12Float:    return MTLPixelFormatASTC_12x12_HDR;
         #endif
 
         default:                        break;
@@ -631,6 +659,10 @@ Format ToFormat(const MTLPixelFormat pixelFormat)
         case MTLPixelFormatBC4_RSnorm:              return Format::BC4SNorm;
         case MTLPixelFormatBC5_RGUnorm:             return Format::BC5UNorm;
         case MTLPixelFormatBC5_RGSnorm:             return Format::BC5SNorm;
+        case MTLPixelFormatBC6H_RGBUfloat:          return Format::BC6HUFloat;
+        case MTLPixelFormatBC6H_RGBFloat:           return Format::BC6HSFloat;
+        case MTLPixelFormatBC7_RGBAUnorm:           return Format::BC7UNorm;
+        case MTLPixelFormatBC7_RGBAUnorm_sRGB:      return Format::BC7UNorm_sRGB;
         #endif // /LLGL_OS_IOS
 
         /* --- Advanced scalable texture compression (ASTC) formats --- */
@@ -667,6 +699,30 @@ Format ToFormat(const MTLPixelFormat pixelFormat)
         /* --- Ericsson texture compression (ETC) formats --- */
         case MTLPixelFormatETC2_RGB8:               return Format::ETC2UNorm;
         case MTLPixelFormatETC2_RGB8_sRGB:          return Format::ETC2UNorm_sRGB;
+        case MTLPixelFormatETC2_RGB8A1:             return Format::ETC2A1UNorm;
+        case MTLPixelFormatETC2_RGB8A1_sRGB:        return Format::ETC2A1UNorm_sRGB;
+        case MTLPixelFormatEAC_RGBA8:               return Format::ETC2A8UNorm;
+        case MTLPixelFormatEAC_RGBA8_sRGB:          return Format::ETC2A8UNorm_sRGB;
+        case MTLPixelFormatEAC_R11Unorm:            return Format::EACR11UNorm;
+        case MTLPixelFormatEAC_R11Snorm:            return Format::EACR11SNorm;
+        case MTLPixelFormatEAC_RG11Unorm:           return Format::EACRG11UNorm;
+        case MTLPixelFormatEAC_RG11Snorm:           return Format::EACRG11SNorm;
+
+        /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+        case MTLPixelFormatASTC_4x4_HDR:            return Format::ASTC4x4Float;
+        case MTLPixelFormatASTC_5x4_HDR:            return Format::ASTC5x4Float;
+        case MTLPixelFormatASTC_5x5_HDR:            return Format::ASTC5x5Float;
+        case MTLPixelFormatASTC_6x5_HDR:            return Format::ASTC6x5Float;
+        case MTLPixelFormatASTC_6x6_HDR:            return Format::ASTC6x6Float;
+        case MTLPixelFormatASTC_8x5_HDR:            return Format::ASTC8x5Float;
+        case MTLPixelFormatASTC_8x6_HDR:            return Format::ASTC8x6Float;
+        case MTLPixelFormatASTC_8x8_HDR:            return Format::ASTC8x8Float;
+        case MTLPixelFormatASTC_10x5_HDR:           return Format::ASTC10x5Float;
+        case MTLPixelFormatASTC_10x6_HDR:           return Format::ASTC10x6Float;
+        case MTLPixelFormatASTC_10x8_HDR:           return Format::ASTC10x8Float;
+        case MTLPixelFormatASTC_10x10_HDR:          return Format::ASTC10x10Float;
+        case MTLPixelFormatASTC_12x10_HDR:          return Format::ASTC12x10Float;
+        case MTLPixelFormatASTC_12x12_HDR:          return Format::ASTC12x12Float;
         #endif
 
         default:                                    break;
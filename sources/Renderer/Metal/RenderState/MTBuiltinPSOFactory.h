@@ -23,6 +23,8 @@ namespace LLGL
 enum class MTBuiltinComputePSO
 {
     FillBufferByte4 = 0,
+    EncodeDrawIndirectCount,
+    EncodeDrawIndexedIndirectCount,
     Num
 };
 
@@ -55,6 +57,20 @@ class MTBuiltinPSOFactory
             std::size_t                 kernelFuncSize
         );
 
+        void LoadBuiltinComputePSOFromSource(
+            id<MTLDevice>               device,
+            const MTBuiltinComputePSO   builtin,
+            const char*                 kernelSource,
+            const char*                 entryPoint,
+            const char*                 profile
+        );
+
+        void CreateBuiltinComputePSO(
+            id<MTLDevice>               device,
+            const MTBuiltinComputePSO   builtin,
+            const ShaderDescriptor&     shaderDesc
+        );
+
     private:
 
         static constexpr std::size_t k_numComputePSOs = static_cast<std::size_t>(MTBuiltinComputePSO::Num);
@@ -8,6 +8,7 @@
 #include "MTBuiltinPSOFactory.h"
 #include "../Shader/Builtin/MTBuiltin.h"
 #include "../MTCore.h"
+#include "../MTFeatureSet.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Report.h>
@@ -26,6 +27,12 @@ MTBuiltinPSOFactory& MTBuiltinPSOFactory::Get()
 void MTBuiltinPSOFactory::CreateBuiltinPSOs(id<MTLDevice> device)
 {
     LoadBuiltinComputePSO(device, MTBuiltinComputePSO::FillBufferByte4, g_metalLibFillBufferByte4, g_metalLibFillBufferByte4Len);
+
+    if (SupportsIndirectCountDrawing(device))
+    {
+        LoadBuiltinComputePSOFromSource(device, MTBuiltinComputePSO::EncodeDrawIndirectCount,        g_metalSrcEncodeIndirectCountDraws, "EncodeDrawIndirectCount",        "2.1");
+        LoadBuiltinComputePSOFromSource(device, MTBuiltinComputePSO::EncodeDrawIndexedIndirectCount, g_metalSrcEncodeIndirectCountDraws, "EncodeDrawIndexedIndirectCount", "2.1");
+    }
 }
 
 id<MTLComputePipelineState> MTBuiltinPSOFactory::GetComputePSO(const MTBuiltinComputePSO builtin) const
@@ -48,7 +55,7 @@ void MTBuiltinPSOFactory::LoadBuiltinComputePSO(
     const char*                 kernelFunc,
     std::size_t                 kernelFuncSize)
 {
-    /* Load compute shader function */
+    /* Load compute shader function from precompiled Metal library */
     ShaderDescriptor shaderDesc;
     {
         shaderDesc.type         = ShaderType::Compute;
@@ -58,6 +65,33 @@ void MTBuiltinPSOFactory::LoadBuiltinComputePSO(
         shaderDesc.entryPoint   = "CS";
         shaderDesc.profile      = "1.1";
     }
+    CreateBuiltinComputePSO(device, builtin, shaderDesc);
+}
+
+void MTBuiltinPSOFactory::LoadBuiltinComputePSOFromSource(
+    id<MTLDevice>               device,
+    const MTBuiltinComputePSO   builtin,
+    const char*                 kernelSource,
+    const char*                 entryPoint,
+    const char*                 profile)
+{
+    /* Compile compute shader function from source */
+    ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.type         = ShaderType::Compute;
+        shaderDesc.source       = kernelSource;
+        shaderDesc.sourceType   = ShaderSourceType::CodeString;
+        shaderDesc.entryPoint   = entryPoint;
+        shaderDesc.profile      = profile;
+    }
+    CreateBuiltinComputePSO(device, builtin, shaderDesc);
+}
+
+void MTBuiltinPSOFactory::CreateBuiltinComputePSO(
+    id<MTLDevice>               device,
+    const MTBuiltinComputePSO   builtin,
+    const ShaderDescriptor&     shaderDesc)
+{
     std::unique_ptr<MTShader> cs = MakeUnique<MTShader>(device, shaderDesc);
 
     /* We cannot recover from a faulty built-in shader */
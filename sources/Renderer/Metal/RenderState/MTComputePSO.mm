@@ -7,6 +7,7 @@
 
 #include "MTComputePSO.h"
 #include "MTPipelineLayout.h"
+#include "MTPipelineCache.h"
 #include "../MTCore.h"
 #include "../Shader/MTShader.h"
 #include "../../CheckedCast.h"
@@ -19,7 +20,7 @@ namespace LLGL
 {
 
 
-MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc) :
+MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor& desc, MTPipelineCache* pipelineCache) :
     MTPipelineState { /*isGraphicsPSO:*/ false, desc.pipelineLayout }
 {
     /* Get native shader functions */
@@ -30,22 +31,39 @@ MTComputePSO::MTComputePSO(id<MTLDevice> device, const ComputePipelineDescriptor
         return;
     }
 
-    id<MTLFunction> kernelFunc = computeShader_->GetNative();
-    if (!kernelFunc)
+    if (!computeShader_->GetNative())
     {
         GetMutableReport().Errorf("cannot create Metal compute pipeline without valid compute kernel function");
         return;
     }
 
-    /* Create native compute pipeline state */
+    /* Specialize kernel function with optional function constants */
     NSError* error = nullptr;
-    computePipelineState_ = CreateNativeComputePipelineState(device, kernelFunc, error);
-    if (!computePipelineState_)
-        MTThrowIfCreateFailed(error, "MTLComputePipelineState");
+    id<MTLFunction> kernelFunc = computeShader_->NewSpecializedFunction(desc.specializationConstants, error);
+    if (!kernelFunc)
+        MTThrowIfCreateFailed(error, "MTLFunction");
+
+    /* Create native compute pipeline state */
+    if ((desc.flags & PipelineStateFlags::AsyncCompilation) != 0)
+        CreateNativeComputePipelineStateAsync(device, kernelFunc, pipelineCache);
+    else
+    {
+        computePipelineState_ = CreateNativeComputePipelineState(device, kernelFunc, pipelineCache, error);
+        if (!computePipelineState_)
+        {
+            [kernelFunc release];
+            MTThrowIfCreateFailed(error, "MTLComputePipelineState");
+        }
+    }
+
+    [kernelFunc release];
 }
 
 void MTComputePSO::Bind(id<MTLComputeCommandEncoder> computeEncoder)
 {
+    /* Wait for asynchronous compilation to finish */
+    WaitForCompilation();
+
     [computeEncoder setComputePipelineState:computePipelineState_];
 
     if (auto* pipelineLayout = GetPipelineLayout())
@@ -58,25 +76,88 @@ void MTComputePSO::Bind(id<MTLComputeCommandEncoder> computeEncoder)
  */
 
 id<MTLComputePipelineState> MTComputePSO::CreateNativeComputePipelineState(
-    id<MTLDevice>   device,
-    id<MTLFunction> function,
-    NSError*&       error)
+    id<MTLDevice>       device,
+    id<MTLFunction>     function,
+    MTPipelineCache*    pipelineCache,
+    NSError*&           error)
 {
-    if (NeedsConstantsCache())
+    const MTLPipelineOption options = (NeedsConstantsCache() ? (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo) : MTLPipelineOptionNone);
+    MTLAutoreleasedComputePipelineReflection reflection = nil;
+    id<MTLComputePipelineState> pso = nil;
+
+    if (pipelineCache != nullptr)
+    {
+        /* Binary archives can only be attached to compute pipeline descriptors */
+        MTLComputePipelineDescriptor* psoDesc = [[MTLComputePipelineDescriptor alloc] init];
+        {
+            psoDesc.computeFunction = function;
+            pipelineCache->AttachToComputePipeline(psoDesc);
+        }
+        pso = [device
+            newComputePipelineStateWithDescriptor:  psoDesc
+            options:                                options
+            reflection:                             (NeedsConstantsCache() ? &reflection : nil)
+            error:                                  &error
+        ];
+        if (pso != nil)
+            pipelineCache->AddComputePipeline(psoDesc);
+        [psoDesc release];
+    }
+    else if (NeedsConstantsCache())
     {
         /* Create PSO with reflection to generate constants cache */
-        MTLAutoreleasedComputePipelineReflection reflection = nil;
-        id<MTLComputePipelineState> pso = [device
+        pso = [device
             newComputePipelineStateWithFunction:    function
-            options:                                (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo)
+            options:                                options
             reflection:                             &reflection
             error:                                  &error
         ];
-        CreateConstantsCacheForComputePipeline(reflection);
-        return pso;
     }
     else
-        return [device newComputePipelineStateWithFunction:function error:&error];
+        pso = [device newComputePipelineStateWithFunction:function error:&error];
+
+    if (NeedsConstantsCache())
+        CreateConstantsCacheForComputePipeline(reflection);
+
+    return pso;
+}
+
+void MTComputePSO::CreateNativeComputePipelineStateAsync(
+    id<MTLDevice>       device,
+    id<MTLFunction>     function,
+    MTPipelineCache*    pipelineCache)
+{
+    MTLComputePipelineDescriptor* psoDesc = [[MTLComputePipelineDescriptor alloc] init];
+    {
+        psoDesc.computeFunction = function;
+        if (pipelineCache != nullptr)
+            pipelineCache->AttachToComputePipeline(psoDesc);
+    }
+
+    const bool          needsConstantsCache = NeedsConstantsCache();
+    MTLPipelineOption   options             = (needsConstantsCache ? (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo) : MTLPipelineOptionNone);
+    MTComputePSO*       self                = this;
+
+    BeginAsyncCompilation();
+    [device
+        newComputePipelineStateWithDescriptor:  psoDesc
+        options:                                options
+        completionHandler:                      ^(id<MTLComputePipelineState> pso, MTLComputePipelineReflection* reflection, NSError* error)
+        {
+            if (pso != nil)
+            {
+                self->computePipelineState_ = [pso retain];
+                if (needsConstantsCache)
+                    self->CreateConstantsCacheForComputePipeline(reflection);
+                if (pipelineCache != nullptr)
+                    pipelineCache->AddComputePipeline(psoDesc);
+            }
+            else
+                self->ReportCreateFailed(error, "MTLComputePipelineState");
+            [psoDesc release];
+            self->EndAsyncCompilation();
+        }
+    ];
 }
 
 
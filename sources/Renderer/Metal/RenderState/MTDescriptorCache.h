@@ -47,6 +47,9 @@ class MTDescriptorCache
         // Sets the specified resource in this cache.
         void SetResource(std::uint32_t descriptor, Resource& resource);
 
+        // Sets the specified buffer range as constant buffer in this cache. The size is implied by the shader's parameter block.
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, NSUInteger offset);
+
         // Flushes the pending descriptors to the specified command encoder.
         void FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder);
         void FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder> renderEncoder);
@@ -69,8 +72,8 @@ class MTDescriptorCache
 
         void BuildResourceBindings(const ArrayView<MTDynamicResourceLayout>& bindings);
 
-        void BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource);
-        void BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource);
+        void BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset);
+        void BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset);
 
         // Marks the specified binding as invalidated.
         void InvalidateBinding(std::uint8_t index);
@@ -88,6 +91,7 @@ class MTDescriptorCache
 
         ArrayView<MTDynamicResourceLayout>  layouts_;
         std::vector<id>                     bindings_;
+        std::vector<NSUInteger>             offsets_;
         std::uint64_t                       dirtyBindings_[4]   = {};
         std::uint8_t                        dirtyRange_[2]      = {};
 
@@ -34,6 +34,7 @@ void MTDescriptorCache::Reset(const MTPipelineLayout* pipelineLayout)
         layouts_ = pipelineLayout->GetDynamicBindings();
         LLGL_ASSERT(layouts_.size() <= 0xFF);
         bindings_.resize(layouts_.size());
+        offsets_.resize(layouts_.size());
     }
     else
     {
@@ -86,6 +87,7 @@ void MTDescriptorCache::SetResource(std::uint32_t descriptor, Resource& resource
         {
             auto& bufferMT = LLGL_CAST(MTBuffer&, resource);
             bindings_[descriptor] = bufferMT.GetNative();
+            offsets_[descriptor]  = 0;
         }
         break;
 
@@ -107,6 +109,24 @@ void MTDescriptorCache::SetResource(std::uint32_t descriptor, Resource& resource
     InvalidateBinding(static_cast<std::uint8_t>(descriptor));
 }
 
+void MTDescriptorCache::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, NSUInteger offset)
+{
+    if (descriptor >= layouts_.size())
+        return /*Out of range*/;
+
+    const MTDynamicResourceLayout& layout = layouts_[descriptor];
+    if (layout.type != ResourceType::Buffer)
+        return /*Type mismatch*/;
+
+    LLGL_ASSERT(bindings_.size() >= layouts_.size());
+
+    auto& bufferMT = LLGL_CAST(MTBuffer&, buffer);
+    bindings_[descriptor] = bufferMT.GetNative();
+    offsets_[descriptor]  = offset;
+
+    InvalidateBinding(static_cast<std::uint8_t>(descriptor));
+}
+
 void MTDescriptorCache::FlushGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder)
 {
     if (dirtyRange_[0] < dirtyRange_[1])
@@ -116,7 +136,7 @@ void MTDescriptorCache::FlushGraphicsResources(id<MTLRenderCommandEncoder> rende
         for_subrange(i, dirtyRange_[0], dirtyRange_[1])
         {
             if (IsBindingInvalidated(i))
-                BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i]);
+                BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i], offsets_[i]);
         }
         Clear();
     }
@@ -126,7 +146,7 @@ void MTDescriptorCache::FlushGraphicsResourcesForced(id<MTLRenderCommandEncoder>
 {
     LLGL_ASSERT(bindings_.size() >= layouts_.size());
     for_range(i, layouts_.size())
-        BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i]);
+        BindGraphicsResource(renderEncoder, layouts_[i], bindings_[i], offsets_[i]);
     Clear();
 }
 
@@ -139,7 +159,7 @@ void MTDescriptorCache::FlushComputeResources(id<MTLComputeCommandEncoder> compu
         for_subrange(i, dirtyRange_[0], dirtyRange_[1])
         {
             if (IsBindingInvalidated(i))
-                BindComputeResource(computeEncoder, layouts_[i], bindings_[i]);
+                BindComputeResource(computeEncoder, layouts_[i], bindings_[i], offsets_[i]);
         }
         Clear();
     }
@@ -149,7 +169,7 @@ void MTDescriptorCache::FlushComputeResourcesForced(id<MTLComputeCommandEncoder>
 {
     LLGL_ASSERT(bindings_.size() >= layouts_.size());
     for_range(i, layouts_.size())
-        BindComputeResource(computeEncoder, layouts_[i], bindings_[i]);
+        BindComputeResource(computeEncoder, layouts_[i], bindings_[i], offsets_[i]);
     Clear();
 }
 
@@ -158,7 +178,7 @@ void MTDescriptorCache::FlushComputeResourcesForced(id<MTLComputeCommandEncoder>
  * ======= Private: =======
  */
 
-void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource)
+void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset)
 {
     switch (layout.type)
     {
@@ -171,7 +191,7 @@ void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderE
             {
                 [renderEncoder
                     setVertexBuffer:    static_cast<id<MTLBuffer>>(resource)
-                    offset:             0
+                    offset:             offset
                     atIndex:            layout.slot
                 ];
             }
@@ -179,10 +199,21 @@ void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderE
             {
                 [renderEncoder
                     setFragmentBuffer:  static_cast<id<MTLBuffer>>(resource)
-                    offset:             0
+                    offset:             offset
                     atIndex:            layout.slot
                 ];
             }
+            if ((layout.stages & StageFlags::TileStage) != 0)
+            {
+                if (@available(iOS 11.0, macOS 11.0, *))
+                {
+                    [renderEncoder
+                        setTileBuffer:  static_cast<id<MTLBuffer>>(resource)
+                        offset:         offset
+                        atIndex:        layout.slot
+                    ];
+                }
+            }
         }
         break;
 
@@ -202,6 +233,16 @@ void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderE
                     atIndex:            layout.slot
                 ];
             }
+            if ((layout.stages & StageFlags::TileStage) != 0)
+            {
+                if (@available(iOS 11.0, macOS 11.0, *))
+                {
+                    [renderEncoder
+                        setTileTexture: static_cast<id<MTLTexture>>(resource)
+                        atIndex:        layout.slot
+                    ];
+                }
+            }
         }
         break;
 
@@ -221,12 +262,22 @@ void MTDescriptorCache::BindGraphicsResource(id<MTLRenderCommandEncoder> renderE
                     atIndex:                    layout.slot
                 ];
             }
+            if ((layout.stages & StageFlags::TileStage) != 0)
+            {
+                if (@available(iOS 11.0, macOS 11.0, *))
+                {
+                    [renderEncoder
+                        setTileSamplerState:    static_cast<id<MTLSamplerState>>(resource)
+                        atIndex:                layout.slot
+                    ];
+                }
+            }
         }
         break;
     }
 }
 
-void MTDescriptorCache::BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource)
+void MTDescriptorCache::BindComputeResource(id<MTLComputeCommandEncoder> computeEncoder, const MTDynamicResourceLayout& layout, id resource, NSUInteger offset)
 {
     switch (layout.type)
     {
@@ -239,7 +290,7 @@ void MTDescriptorCache::BindComputeResource(id<MTLComputeCommandEncoder> compute
             {
                 [computeEncoder
                     setBuffer:  static_cast<id<MTLBuffer>>(resource)
-                    offset:     0
+                    offset:     offset
                     atIndex:    layout.slot
                 ];
             }
@@ -22,6 +22,10 @@ namespace LLGL
 class MTFence final : public Fence
 {
 
+    public:
+
+        bool IsSignaled() override;
+
     public:
 
         MTFence(id<MTLDevice> device);
@@ -22,6 +22,11 @@ MTFence::~MTFence()
     [native_ release];
 }
 
+bool MTFence::IsSignaled()
+{
+    return false; //todo
+}
+
 
 } // /namespace LLGL
 
@@ -19,6 +19,7 @@ namespace LLGL
 
 
 class MTRenderPass;
+class MTPipelineCache;
 class ByteBufferIterator;
 struct GraphicsPipelineDescriptor;
 
@@ -30,7 +31,8 @@ class MTGraphicsPSO final : public MTPipelineState
         MTGraphicsPSO(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc,
-            const MTRenderPass*                 defaultRenderPass
+            const MTRenderPass*                 defaultRenderPass,
+            MTPipelineCache*                    pipelineCache       = nullptr
         );
 
         // Binds the render pipeline state, depth-stencil states, and sets the remaining parameters with the specified command encoder.
@@ -71,6 +73,24 @@ class MTGraphicsPSO final : public MTPipelineState
             return tessPipelineState_;
         }
 
+        // Returns the number of threads per object threadgroup for mesh shader PSOs.
+        inline const MTLSize& GetThreadsPerObjectThreadgroup() const
+        {
+            return threadsPerObjectThreadgroup_;
+        }
+
+        // Returns the number of threads per mesh threadgroup for mesh shader PSOs.
+        inline const MTLSize& GetThreadsPerMeshThreadgroup() const
+        {
+            return threadsPerMeshThreadgroup_;
+        }
+
+        // Returns the number of threads per tile for tile shader PSOs.
+        inline const MTLSize& GetThreadsPerTile() const
+        {
+            return threadsPerTile_;
+        }
+
         // Returns true if the scissor test is enabled for this PSO.
         inline bool HasScissorTest() const
         {
@@ -94,21 +114,43 @@ class MTGraphicsPSO final : public MTPipelineState
         bool CreateRenderPipelineState(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc,
-            const MTRenderPass*                 defaultRenderPass
+            const MTRenderPass*                 defaultRenderPass,
+            MTPipelineCache*                    pipelineCache
+        );
+
+        bool CreateMeshRenderPipelineState(
+            id<MTLDevice>                       device,
+            const GraphicsPipelineDescriptor&   desc,
+            const MTRenderPass*                 renderPass
+        );
+
+        bool CreateTileRenderPipelineState(
+            id<MTLDevice>                       device,
+            const GraphicsPipelineDescriptor&   desc,
+            const MTRenderPass*                 renderPass
         );
 
         id<MTLRenderPipelineState> CreateNativeRenderPipelineState(
             id<MTLDevice>                   device,
             MTLRenderPipelineDescriptor*    desc,
+            MTPipelineCache*                pipelineCache,
             NSError*&                       error
         );
 
+        // Creates the native render pipeline state with a completion handler, so the Metal compiler service does not block the calling thread.
+        void CreateNativeRenderPipelineStateAsync(
+            id<MTLDevice>                   device,
+            MTLRenderPipelineDescriptor*    desc,
+            MTPipelineCache*                pipelineCache
+        );
+
         void CreateDepthStencilState(
             id<MTLDevice>                       device,
             const GraphicsPipelineDescriptor&   desc
         );
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
+        void SetVertexAmplification(id<MTLRenderCommandEncoder> renderEncoder);
         void BuildStaticViewports(std::size_t numViewports, const Viewport* viewports, ByteBufferIterator& byteBufferIter);
         void BuildStaticScissors(std::size_t numScissors, const Scissor* scissors, ByteBufferIterator& byteBufferIter);
 
@@ -125,12 +167,16 @@ class MTGraphicsPSO final : public MTPipelineState
         MTLDepthClipMode            clipMode_               = MTLDepthClipModeClip;
         NSUInteger                  numPatchControlPoints_  = 0;
         MTLPatchType                patchType_              = MTLPatchTypeNone;
+        MTLSize                     threadsPerObjectThreadgroup_    = MTLSizeMake(1, 1, 1);
+        MTLSize                     threadsPerMeshThreadgroup_      = MTLSizeMake(1, 1, 1);
+        MTLSize                     threadsPerTile_                 = MTLSizeMake(1, 1, 1);
 
         float                       depthBias_              = 0.0f;
         float                       depthSlope_             = 0.0f;
         float                       depthClamp_             = 0.0f;
 
         bool                        hasScissorTest_         = false;
+        std::uint32_t               viewMask_               = 0; // Multiview mask; each view is mapped to the array layer of its bit via vertex amplification
 
         bool                        blendColorDynamic_      = false;
         bool                        blendColorEnabled_      = false;
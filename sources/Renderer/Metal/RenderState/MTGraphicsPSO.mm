@@ -8,12 +8,15 @@
 #include "MTGraphicsPSO.h"
 #include "MTRenderPass.h"
 #include "MTPipelineLayout.h"
+#include "MTPipelineCache.h"
 #include "../Shader/MTShader.h"
 //#include "../Command/MTCommandContext.h"
 #include "../MTTypes.h"
 #include "../MTCore.h"
+#include "../MTFeatureSet.h"
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/ByteBufferIterator.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/PipelineStateFlags.h>
@@ -50,7 +53,8 @@ static void FillDefaultMTStencilDesc(MTLStencilDescriptor* dst)
 MTGraphicsPSO::MTGraphicsPSO(
     id<MTLDevice>                       device,
     const GraphicsPipelineDescriptor&   desc,
-    const MTRenderPass*                 defaultRenderPass)
+    const MTRenderPass*                 defaultRenderPass,
+    MTPipelineCache*                    pipelineCache)
 :
     MTPipelineState { /*isGraphicsPSO:*/ true, desc.pipelineLayout }
 {
@@ -66,6 +70,7 @@ MTGraphicsPSO::MTGraphicsPSO(
     depthClamp_         = desc.rasterizer.depthBias.clamp;
 
     hasScissorTest_     = desc.rasterizer.scissorTestEnabled;
+    viewMask_           = desc.viewMask;
 
     blendColorDynamic_  = desc.blend.blendFactorDynamic;
     blendColorEnabled_  = IsStaticBlendFactorEnabled(desc.blend);
@@ -75,7 +80,7 @@ MTGraphicsPSO::MTGraphicsPSO(
     blendColor_[3]      = desc.blend.blendFactor[3];
 
     /* Create render pipeline and depth-stencil states */
-    if (CreateRenderPipelineState(device, desc, defaultRenderPass))
+    if (CreateRenderPipelineState(device, desc, defaultRenderPass, pipelineCache))
     {
         CreateDepthStencilState(device, desc);
         BuildStaticStateBuffer(desc);
@@ -84,6 +89,9 @@ MTGraphicsPSO::MTGraphicsPSO(
 
 void MTGraphicsPSO::Bind(id<MTLRenderCommandEncoder> renderEncoder)
 {
+    /* Wait for asynchronous compilation to finish */
+    WaitForCompilation();
+
     [renderEncoder setRenderPipelineState:renderPipelineState_];
     [renderEncoder setDepthStencilState:depthStencilState_];
     [renderEncoder setCullMode:cullMode_];
@@ -107,6 +115,9 @@ void MTGraphicsPSO::Bind(id<MTLRenderCommandEncoder> renderEncoder)
     }
     #endif
 
+    if (viewMask_ != 0)
+        SetVertexAmplification(renderEncoder);
+
     if (blendColorEnabled_)
     {
         [renderEncoder
@@ -124,6 +135,26 @@ void MTGraphicsPSO::Bind(id<MTLRenderCommandEncoder> renderEncoder)
     }
 }
 
+void MTGraphicsPSO::SetVertexAmplification(id<MTLRenderCommandEncoder> renderEncoder)
+{
+    if (@available(iOS 13.0, macOS 10.15.4, *))
+    {
+        /* Map each amplified vertex to the array layer of its bit in the view mask */
+        MTLVertexAmplificationViewMapping viewMappings[32];
+        NSUInteger numViews = 0;
+        for_range(layer, 32u)
+        {
+            if ((viewMask_ & (1u << layer)) != 0)
+            {
+                viewMappings[numViews].viewportArrayIndexOffset     = 0;
+                viewMappings[numViews].renderTargetArrayIndexOffset = layer;
+                ++numViews;
+            }
+        }
+        [renderEncoder setVertexAmplificationCount:numViews viewMappings:viewMappings];
+    }
+}
+
 bool MTGraphicsPSO::GetStaticState(
     MTLViewport*    outViewports,
     NSUInteger&     outViewportCount,
@@ -208,11 +239,49 @@ static const MTShader* GetVertexOrPostTessVertexShader(const GraphicsPipelineDes
     return vertexShaderMT;
 }
 
+static const MTRenderPass* GetMTRenderPassOrDefault(const GraphicsPipelineDescriptor& desc, const MTRenderPass* defaultRenderPass)
+{
+    const MTRenderPass* renderPassMT = nullptr;
+    if (const RenderPass* renderPass = desc.renderPass)
+        renderPassMT = LLGL_CAST(const MTRenderPass*, renderPass);
+    else if (defaultRenderPass != nullptr)
+        renderPassMT = defaultRenderPass;
+    else
+        LLGL_TRAP("cannot create graphics pipeline without render pass");
+    return renderPassMT;
+}
+
+static void FillColorAttachmentDescs(
+    MTLRenderPipelineColorAttachmentDescriptorArray*    dst,
+    const MTRenderPass*                                 renderPass,
+    const BlendDescriptor&                              blendDesc)
+{
+    const MTColorAttachmentFormatVector& colorAttachments = renderPass->GetColorAttachments();
+    for_range(i, std::min(colorAttachments.size(), std::size_t(LLGL_MAX_NUM_COLOR_ATTACHMENTS)))
+    {
+        FillColorAttachmentDesc(
+            dst[i],
+            colorAttachments[i].pixelFormat,
+            blendDesc,
+            blendDesc.targets[blendDesc.independentBlendEnabled ? i : 0]
+        );
+    };
+}
+
 bool MTGraphicsPSO::CreateRenderPipelineState(
     id<MTLDevice>                       device,
     const GraphicsPipelineDescriptor&   desc,
-    const MTRenderPass*                 defaultRenderPass)
+    const MTRenderPass*                 defaultRenderPass,
+    MTPipelineCache*                    pipelineCache)
 {
+    /* Tile shader PSOs have no vertex processing or fragment stage */
+    if (desc.tileShader != nullptr)
+        return CreateTileRenderPipelineState(device, desc, GetMTRenderPassOrDefault(desc, defaultRenderPass));
+
+    /* Mesh shader PSOs replace the entire vertex processing stage */
+    if (desc.meshShader != nullptr)
+        return CreateMeshRenderPipelineState(device, desc, GetMTRenderPassOrDefault(desc, defaultRenderPass));
+
     /* Get native shader functions */
     const MTShader* vertexShaderMT = GetVertexOrPostTessVertexShader(desc);
 
@@ -231,14 +300,25 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
         return false;
     }
 
+    /* Specialize vertex and fragment functions with optional function constants */
+    NSError* error = nullptr;
+    id<MTLFunction> vertexFunc = vertexShaderMT->NewSpecializedFunction(desc.specializationConstants, error);
+    if (!vertexFunc)
+        MTThrowIfCreateFailed(error, "MTLFunction");
+
+    id<MTLFunction> fragmentFunc = nil;
+    if (desc.fragmentShader != nullptr)
+    {
+        fragmentFunc = LLGL_CAST(const MTShader*, desc.fragmentShader)->NewSpecializedFunction(desc.specializationConstants, error);
+        if (!fragmentFunc && error != nullptr)
+        {
+            [vertexFunc release];
+            MTThrowIfCreateFailed(error, "MTLFunction");
+        }
+    }
+
     /* Get render pass object */
-    const MTRenderPass* renderPassMT = nullptr;
-    if (const RenderPass* renderPass = desc.renderPass)
-        renderPassMT = LLGL_CAST(const MTRenderPass*, renderPass);
-    else if (defaultRenderPass != nullptr)
-        renderPassMT = defaultRenderPass;
-    else
-        LLGL_TRAP("cannot create graphics pipeline without render pass");
+    const MTRenderPass* renderPassMT = GetMTRenderPassOrDefault(desc, defaultRenderPass);
 
     /* Create render pipeline state */
     MTLRenderPipelineDescriptor* psoDesc = [[MTLRenderPipelineDescriptor alloc] init];
@@ -246,29 +326,34 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
         psoDesc.vertexDescriptor        = vertexShaderMT->GetMTLVertexDesc();
         psoDesc.alphaToCoverageEnabled  = MTBoolean(desc.blend.alphaToCoverageEnabled);
         psoDesc.alphaToOneEnabled       = NO;
-        psoDesc.fragmentFunction        = GetNativeMTShader(desc.fragmentShader);
-        psoDesc.vertexFunction          = vertexShaderMT->GetNative();
+        psoDesc.fragmentFunction        = fragmentFunc;
+        psoDesc.vertexFunction          = vertexFunc;
 
         if (@available(iOS 12.0, *))
             psoDesc.inputPrimitiveTopology = MTTypes::ToMTLPrimitiveTopologyClass(desc.primitiveTopology);
 
         /* Initialize pixel formats from render pass */
-        const MTColorAttachmentFormatVector& colorAttachments = renderPassMT->GetColorAttachments();
-        for_range(i, std::min(colorAttachments.size(), std::size_t(LLGL_MAX_NUM_COLOR_ATTACHMENTS)))
-        {
-            FillColorAttachmentDesc(
-                psoDesc.colorAttachments[i],
-                colorAttachments[i].pixelFormat,
-                desc.blend,
-                desc.blend.targets[desc.blend.independentBlendEnabled ? i : 0]
-            );
-        };
+        FillColorAttachmentDescs(psoDesc.colorAttachments, renderPassMT, desc.blend);
 
         psoDesc.depthAttachmentPixelFormat      = renderPassMT->GetDepthAttachment().pixelFormat;
         psoDesc.stencilAttachmentPixelFormat    = renderPassMT->GetStencilAttachment().pixelFormat;
         psoDesc.rasterizationEnabled            = (desc.rasterizer.discardEnabled ? NO : YES);
         psoDesc.rasterSampleCount               = (desc.rasterizer.multiSampleEnabled ? renderPassMT->GetSampleCount() : 1u);
 
+        /* Amplify vertices for each view of a multiview render pass */
+        if (viewMask_ != 0)
+        {
+            if (@available(iOS 13.0, macOS 10.15.4, *))
+                psoDesc.maxVertexAmplificationCount = NumMultiviewViews(viewMask_);
+        }
+
+        /* Allow PSO to be inherited by the indirect command buffers of indirect count draw commands */
+        if (@available(iOS 12.0, macOS 10.14, *))
+        {
+            if (numPatchControlPoints_ == 0 && SupportsIndirectCountDrawing(device))
+                psoDesc.supportIndirectCommandBuffers = YES;
+        }
+
         /* Specify tessellation state */
         if (numPatchControlPoints_ > 0)
         {
@@ -285,10 +370,17 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
             psoDesc.tessellationPartitionMode           = MTTypes::ToMTLPartitionMode(desc.tessellation.partition);
         }
     }
-    NSError* error = nullptr;
-    renderPipelineState_ = CreateNativeRenderPipelineState(device, psoDesc, error);
-    if (!renderPipelineState_)
-        MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
+    [vertexFunc release];
+    [fragmentFunc release];
+
+    if ((desc.flags & PipelineStateFlags::AsyncCompilation) != 0)
+        CreateNativeRenderPipelineStateAsync(device, psoDesc, pipelineCache);
+    else
+    {
+        renderPipelineState_ = CreateNativeRenderPipelineState(device, psoDesc, pipelineCache, error);
+        if (!renderPipelineState_)
+            MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
+    }
     [psoDesc release];
 
     /* Create compute PSO for tessellation stage */
@@ -307,26 +399,188 @@ bool MTGraphicsPSO::CreateRenderPipelineState(
     return true;
 }
 
+bool MTGraphicsPSO::CreateMeshRenderPipelineState(
+    id<MTLDevice>                       device,
+    const GraphicsPipelineDescriptor&   desc,
+    const MTRenderPass*                 renderPass)
+{
+    if (@available(iOS 16.0, macOS 13.0, *))
+    {
+        const MTShader* meshShaderMT = LLGL_CAST(const MTShader*, desc.meshShader);
+        const MTShader* taskShaderMT = LLGL_CAST(const MTShader*, desc.taskShader);
+        if (meshShaderMT->GetNative() == nil)
+        {
+            GetMutableReport().Errorf("cannot create Metal mesh PSO without valid mesh function");
+            return false;
+        }
+
+        /* Threadgroup sizes must be passed to every mesh draw command */
+        threadsPerMeshThreadgroup_ = meshShaderMT->GetNumThreadsPerGroup();
+        if (taskShaderMT != nullptr)
+            threadsPerObjectThreadgroup_ = taskShaderMT->GetNumThreadsPerGroup();
+
+        /* Create mesh render pipeline state */
+        MTLMeshRenderPipelineDescriptor* psoDesc = [[MTLMeshRenderPipelineDescriptor alloc] init];
+        {
+            psoDesc.objectFunction                  = GetNativeMTShader(desc.taskShader);
+            psoDesc.meshFunction                    = meshShaderMT->GetNative();
+            psoDesc.fragmentFunction                = GetNativeMTShader(desc.fragmentShader);
+            psoDesc.alphaToCoverageEnabled          = MTBoolean(desc.blend.alphaToCoverageEnabled);
+            psoDesc.alphaToOneEnabled               = NO;
+
+            FillColorAttachmentDescs(psoDesc.colorAttachments, renderPass, desc.blend);
+
+            psoDesc.depthAttachmentPixelFormat      = renderPass->GetDepthAttachment().pixelFormat;
+            psoDesc.stencilAttachmentPixelFormat    = renderPass->GetStencilAttachment().pixelFormat;
+            psoDesc.rasterizationEnabled            = (desc.rasterizer.discardEnabled ? NO : YES);
+            psoDesc.rasterSampleCount               = (desc.rasterizer.multiSampleEnabled ? renderPass->GetSampleCount() : 1u);
+            if (viewMask_ != 0)
+                psoDesc.maxVertexAmplificationCount = NumMultiviewViews(viewMask_);
+        }
+        NSError* error = nullptr;
+        if (NeedsConstantsCache())
+        {
+            /* Create PSO with reflection to generate constants cache */
+            MTLAutoreleasedRenderPipelineReflection reflection = nil;
+            renderPipelineState_ = [device
+                newRenderPipelineStateWithMeshDescriptor:   psoDesc
+                options:                                    (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo)
+                reflection:                                 &reflection
+                error:                                      &error
+            ];
+            CreateConstantsCacheForRenderPipeline(reflection);
+        }
+        else
+        {
+            renderPipelineState_ = [device
+                newRenderPipelineStateWithMeshDescriptor:   psoDesc
+                options:                                    MTLPipelineOptionNone
+                reflection:                                 nil
+                error:                                      &error
+            ];
+        }
+        if (!renderPipelineState_)
+            MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
+        [psoDesc release];
+        return true;
+    }
+    GetMutableReport().Errorf("Metal mesh PSOs require macOS 13.0 or iOS 16.0");
+    return false;
+}
+
+bool MTGraphicsPSO::CreateTileRenderPipelineState(
+    id<MTLDevice>                       device,
+    const GraphicsPipelineDescriptor&   desc,
+    const MTRenderPass*                 renderPass)
+{
+    if (@available(iOS 11.0, macOS 11.0, *))
+    {
+        const MTShader* tileShaderMT = LLGL_CAST(const MTShader*, desc.tileShader);
+        if (tileShaderMT->GetNative() == nil)
+        {
+            GetMutableReport().Errorf("cannot create Metal tile PSO without valid tile function");
+            return false;
+        }
+
+        /* Number of threads per tile must be passed to every tile dispatch command */
+        threadsPerTile_ = tileShaderMT->GetNumThreadsPerGroup();
+
+        /* Create tile render pipeline state; Only the pixel formats are needed to determine the implicit imageblock layout */
+        MTLTileRenderPipelineDescriptor* psoDesc = [[MTLTileRenderPipelineDescriptor alloc] init];
+        {
+            psoDesc.tileFunction                    = tileShaderMT->GetNative();
+            psoDesc.rasterSampleCount               = (desc.rasterizer.multiSampleEnabled ? renderPass->GetSampleCount() : 1u);
+            psoDesc.threadgroupSizeMatchesTileSize  = NO;
+
+            const MTColorAttachmentFormatVector& colorAttachments = renderPass->GetColorAttachments();
+            for_range(i, std::min(colorAttachments.size(), std::size_t(LLGL_MAX_NUM_COLOR_ATTACHMENTS)))
+                psoDesc.colorAttachments[i].pixelFormat = colorAttachments[i].pixelFormat;
+        }
+        /* Uniforms are not supported for tile functions, since the constants cache only covers vertex and fragment stages */
+        NSError* error = nullptr;
+        renderPipelineState_ = [device
+            newRenderPipelineStateWithTileDescriptor:   psoDesc
+            options:                                    MTLPipelineOptionNone
+            reflection:                                 nil
+            error:                                      &error
+        ];
+        if (!renderPipelineState_)
+            MTThrowIfCreateFailed(error, "MTLRenderPipelineState");
+        [psoDesc release];
+        return true;
+    }
+    GetMutableReport().Errorf("Metal tile PSOs require macOS 11.0 or iOS 11.0");
+    return false;
+}
+
 id<MTLRenderPipelineState> MTGraphicsPSO::CreateNativeRenderPipelineState(
     id<MTLDevice>                   device,
     MTLRenderPipelineDescriptor*    desc,
+    MTPipelineCache*                pipelineCache,
     NSError*&                       error)
 {
+    /* Look up compiled pipeline functions in binary archive first */
+    if (pipelineCache != nullptr)
+        pipelineCache->AttachToRenderPipeline(desc);
+
+    id<MTLRenderPipelineState> pso = nil;
     if (NeedsConstantsCache())
     {
         /* Create PSO with reflection to generate constants cache */
         MTLAutoreleasedRenderPipelineReflection reflection = nil;
-        id<MTLRenderPipelineState> pso = [device
+        pso = [device
             newRenderPipelineStateWithDescriptor:   desc
             options:                                (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo)
             reflection:                             &reflection
             error:                                  &error
         ];
         CreateConstantsCacheForRenderPipeline(reflection);
-        return pso;
     }
     else
-        return [device newRenderPipelineStateWithDescriptor:desc error:&error];
+        pso = [device newRenderPipelineStateWithDescriptor:desc error:&error];
+
+    /* Store compiled pipeline functions in binary archive for the next application launch */
+    if (pso != nil && pipelineCache != nullptr)
+        pipelineCache->AddRenderPipeline(desc);
+
+    return pso;
+}
+
+void MTGraphicsPSO::CreateNativeRenderPipelineStateAsync(
+    id<MTLDevice>                   device,
+    MTLRenderPipelineDescriptor*    desc,
+    MTPipelineCache*                pipelineCache)
+{
+    if (pipelineCache != nullptr)
+        pipelineCache->AttachToRenderPipeline(desc);
+
+    const bool          needsConstantsCache = NeedsConstantsCache();
+    MTLPipelineOption   options             = (needsConstantsCache ? (MTLPipelineOptionArgumentInfo | MTLPipelineOptionBufferTypeInfo) : MTLPipelineOptionNone);
+    MTGraphicsPSO*      self                = this;
+
+    /* Keep descriptor alive until the completion handler has stored the pipeline functions in the binary archive */
+    [desc retain];
+
+    BeginAsyncCompilation();
+    [device
+        newRenderPipelineStateWithDescriptor:   desc
+        options:                                options
+        completionHandler:                      ^(id<MTLRenderPipelineState> pso, MTLRenderPipelineReflection* reflection, NSError* error)
+        {
+            if (pso != nil)
+            {
+                self->renderPipelineState_ = [pso retain];
+                if (needsConstantsCache)
+                    self->CreateConstantsCacheForRenderPipeline(reflection);
+                if (pipelineCache != nullptr)
+                    pipelineCache->AddRenderPipeline(desc);
+            }
+            else
+                self->ReportCreateFailed(error, "MTLRenderPipelineState");
+            [desc release];
+            self->EndAsyncCompilation();
+        }
+    ];
 }
 
 void MTGraphicsPSO::CreateDepthStencilState(
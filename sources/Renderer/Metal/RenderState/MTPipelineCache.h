@@ -0,0 +1,69 @@
+/*
+ * MTPipelineCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_PIPELINE_CACHE_H
+#define LLGL_MT_PIPELINE_CACHE_H
+
+
+#import <Metal/Metal.h>
+
+#include <LLGL/PipelineCache.h>
+#include <mutex>
+
+
+namespace LLGL
+{
+
+
+/*
+Pipeline cache that is backed by a single MTLBinaryArchive.
+Metal can only load and serialize binary archives through file URLs,
+so the initial blob and the output of GetBlob() are passed through temporary files.
+*/
+class MTPipelineCache final : public PipelineCache
+{
+
+    public:
+
+        MTPipelineCache(id<MTLDevice> device, const Blob& initialBlob);
+        ~MTPipelineCache();
+
+        Blob GetBlob() const override;
+
+    public:
+
+        // Attaches the binary archive to the specified descriptor, so Metal can look up the compiled pipeline functions.
+        void AttachToRenderPipeline(MTLRenderPipelineDescriptor* psoDesc);
+        void AttachToComputePipeline(MTLComputePipelineDescriptor* psoDesc);
+
+        // Adds the compiled pipeline functions of the specified descriptor to the binary archive.
+        void AddRenderPipeline(MTLRenderPipelineDescriptor* psoDesc);
+        void AddComputePipeline(MTLComputePipelineDescriptor* psoDesc);
+
+        // Returns the native MTLBinaryArchive object. This is nil if binary archives are not supported.
+        inline id<MTLBinaryArchive> GetNative() const
+        {
+            return native_;
+        }
+
+    private:
+
+        id<MTLBinaryArchive>    native_         = nil;
+        NSURL*                  initialBlobURL_ = nil;  // Temporary file of the initial blob; Must remain until the archive is released.
+        mutable std::mutex      mutex_;                 // Binary archives are not thread-safe
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,143 @@
+/*
+ * MTPipelineCache.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTPipelineCache.h"
+
+
+namespace LLGL
+{
+
+
+// Returns a new URL for a unique file in the temporary directory of this process.
+static NSURL* NewTemporaryFileURL()
+{
+    NSString* filename = [NSString stringWithFormat:@"LLGL.PipelineCache.%@.metallib", [[NSUUID UUID] UUIDString]];
+    return [[NSURL alloc] initFileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:filename]];
+}
+
+static void RemoveTemporaryFile(NSURL* url)
+{
+    [[NSFileManager defaultManager] removeItemAtURL:url error:nil];
+}
+
+MTPipelineCache::MTPipelineCache(id<MTLDevice> device, const Blob& initialBlob)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        /* Write initial blob into temporary file, since binary archives can only be loaded from URLs */
+        if (initialBlob)
+        {
+            NSData* data = [NSData dataWithBytesNoCopy:const_cast<void*>(initialBlob.GetData()) length:initialBlob.GetSize() freeWhenDone:NO];
+            initialBlobURL_ = NewTemporaryFileURL();
+            if (![data writeToURL:initialBlobURL_ atomically:NO])
+            {
+                [initialBlobURL_ release];
+                initialBlobURL_ = nil;
+            }
+        }
+
+        MTLBinaryArchiveDescriptor* archiveDesc = [[MTLBinaryArchiveDescriptor alloc] init];
+        {
+            archiveDesc.url = initialBlobURL_;
+        }
+        native_ = [device newBinaryArchiveWithDescriptor:archiveDesc error:nil];
+
+        /* Archives from a different device or OS version are rejected, so start over with an empty archive */
+        if (native_ == nil && initialBlobURL_ != nil)
+        {
+            archiveDesc.url = nil;
+            native_ = [device newBinaryArchiveWithDescriptor:archiveDesc error:nil];
+        }
+
+        [archiveDesc release];
+    }
+}
+
+MTPipelineCache::~MTPipelineCache()
+{
+    [native_ release];
+    if (initialBlobURL_ != nil)
+    {
+        RemoveTemporaryFile(initialBlobURL_);
+        [initialBlobURL_ release];
+    }
+}
+
+Blob MTPipelineCache::GetBlob() const
+{
+    Blob blob;
+
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        if (native_ != nil)
+        {
+            /* Serialize binary archive into temporary file and read it back into the output blob */
+            NSURL* url = NewTemporaryFileURL();
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                if ([native_ serializeToURL:url error:nil])
+                {
+                    if (NSData* data = [NSData dataWithContentsOfURL:url])
+                        blob = Blob::CreateCopy([data bytes], static_cast<std::size_t>([data length]));
+                }
+            }
+            RemoveTemporaryFile(url);
+            [url release];
+        }
+    }
+
+    return blob;
+}
+
+void MTPipelineCache::AttachToRenderPipeline(MTLRenderPipelineDescriptor* psoDesc)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        if (native_ != nil)
+            psoDesc.binaryArchives = @[native_];
+    }
+}
+
+void MTPipelineCache::AttachToComputePipeline(MTLComputePipelineDescriptor* psoDesc)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        if (native_ != nil)
+            psoDesc.binaryArchives = @[native_];
+    }
+}
+
+void MTPipelineCache::AddRenderPipeline(MTLRenderPipelineDescriptor* psoDesc)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        if (native_ != nil)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            [native_ addRenderPipelineFunctionsWithDescriptor:psoDesc error:nil];
+        }
+    }
+}
+
+void MTPipelineCache::AddComputePipeline(MTLComputePipelineDescriptor* psoDesc)
+{
+    if (@available(iOS 14.0, macOS 11.0, *))
+    {
+        if (native_ != nil)
+        {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+            [native_ addComputePipelineFunctionsWithDescriptor:psoDesc error:nil];
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
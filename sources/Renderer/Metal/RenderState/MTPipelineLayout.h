@@ -54,6 +54,12 @@ class MTPipelineLayout final : public PipelineLayout
             return uniforms_;
         }
 
+        // Returns true if the heap bindings of this layout are encoded into argument buffers. See PipelineLayoutFlags::BindlessHeap.
+        inline bool IsBindlessHeap() const
+        {
+            return isBindlessHeap_;
+        }
+
     private:
 
         void BuildDynamicBindings(const ArrayView<BindingDescriptor>& bindings);
@@ -80,6 +86,8 @@ class MTPipelineLayout final : public PipelineLayout
         std::uint32_t                           numStaticSamplerPerStage_[MTShaderStage_Count];
         std::uint32_t                           numStaticSamplers_                              = 0;
 
+        bool                                    isBindlessHeap_                                 = false;
+
 };
 
 
@@ -7,6 +7,8 @@
 
 #include "MTPipelineLayout.h"
 #include "../Texture/MTSampler.h"
+#include "../MTFeatureSet.h"
+#include "../../ResourceUtils.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -15,9 +17,17 @@ namespace LLGL
 
 
 MTPipelineLayout::MTPipelineLayout(id<MTLDevice> device, const PipelineLayoutDescriptor& desc) :
-    heapBindings_ { desc.heapBindings },
-    uniforms_     { desc.uniforms     }
+    heapBindings_   { desc.heapBindings },
+    uniforms_       { desc.uniforms     },
+    isBindlessHeap_ { ((desc.flags & PipelineLayoutFlags::BindlessHeap) != 0 && SupportsArgumentBuffersTier2(device)) }
 {
+    /* Bindless heaps encode each array element as separate argument, i.e. array bindings occupy consecutive [[id(n)]] attributes */
+    if (isBindlessHeap_)
+    {
+        const DynamicVector<BindingDescriptor> expandedHeapBindings = GetExpandedHeapDescriptors(desc.heapBindings);
+        heapBindings_.assign(expandedHeapBindings.begin(), expandedHeapBindings.end());
+    }
+
     BuildDynamicBindings(desc.bindings);
     BuildStaticSamplers(device, desc.staticSamplers);
 }
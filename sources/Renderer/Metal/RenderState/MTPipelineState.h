@@ -33,8 +33,10 @@ class MTPipelineState : public PipelineState
     public:
 
         MTPipelineState(bool isGraphicsPSO, const PipelineLayout* pipelineLayout);
+        ~MTPipelineState();
 
         const Report* GetReport() const override final;
+        bool IsReady() const override final;
 
         // Returns true if this is a graphics PSO.
         inline bool IsGraphicsPSO() const
@@ -48,9 +50,10 @@ class MTPipelineState : public PipelineState
             return pipelineLayout_;
         }
 
-        // Returns the constants cache for this PSO or null if there is none.
+        // Returns the constants cache for this PSO or null if there is none. Blocks until an asynchronous compilation has finished.
         inline const MTConstantsCacheLayout* GetConstantsCacheLayout() const
         {
+            WaitForCompilation();
             return constantsCacheLayout_.get();
         }
 
@@ -72,12 +75,26 @@ class MTPipelineState : public PipelineState
             return report_;
         }
 
+        /*
+        Begins an asynchronous compilation. Each call must be balanced with EndAsyncCompilation(),
+        which is usually called from the completion handler of the native PSO creation.
+        */
+        void BeginAsyncCompilation();
+        void EndAsyncCompilation();
+
+        // Blocks until all asynchronous compilations have finished. Must be called before the native PSO is accessed.
+        void WaitForCompilation() const;
+
+        // Writes an error to the report for a failed asynchronous compilation, since exceptions cannot be thrown from completion handlers.
+        void ReportCreateFailed(NSError* error, const char* interfaceName);
+
     private:
 
         const bool                              isGraphicsPSO_          = false;
         const MTPipelineLayout*                 pipelineLayout_         = nullptr;
         std::unique_ptr<MTConstantsCacheLayout> constantsCacheLayout_;
         Report                                  report_;
+        dispatch_group_t                        compileGroup_           = nullptr; // Only created for asynchronous compilation
 
 };
 
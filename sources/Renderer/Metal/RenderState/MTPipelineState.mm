@@ -23,11 +23,27 @@ MTPipelineState::MTPipelineState(bool isGraphicsPSO, const PipelineLayout* pipel
         pipelineLayout_ = LLGL_CAST(const MTPipelineLayout*, pipelineLayout);
 }
 
+MTPipelineState::~MTPipelineState()
+{
+    /* Completion handlers must not outlive this PSO */
+    if (compileGroup_ != nullptr)
+    {
+        dispatch_group_wait(compileGroup_, DISPATCH_TIME_FOREVER);
+        dispatch_release(compileGroup_);
+    }
+}
+
 const Report* MTPipelineState::GetReport() const
 {
+    WaitForCompilation();
     return (report_ ? &report_ : nullptr);
 }
 
+bool MTPipelineState::IsReady() const
+{
+    return (compileGroup_ == nullptr || dispatch_group_wait(compileGroup_, DISPATCH_TIME_NOW) == 0);
+}
+
 
 /*
  * ======= Protected: =======
@@ -62,6 +78,32 @@ void MTPipelineState::CreateConstantsCacheForComputePipeline(MTLComputePipelineR
     constantsCacheLayout_ = MakeUnique<MTConstantsCacheLayout>(args, pipelineLayout_->GetUniforms());
 }
 
+void MTPipelineState::BeginAsyncCompilation()
+{
+    if (compileGroup_ == nullptr)
+        compileGroup_ = dispatch_group_create();
+    dispatch_group_enter(compileGroup_);
+}
+
+void MTPipelineState::EndAsyncCompilation()
+{
+    dispatch_group_leave(compileGroup_);
+}
+
+void MTPipelineState::WaitForCompilation() const
+{
+    if (compileGroup_ != nullptr)
+        dispatch_group_wait(compileGroup_, DISPATCH_TIME_FOREVER);
+}
+
+void MTPipelineState::ReportCreateFailed(NSError* error, const char* interfaceName)
+{
+    if (error != nil)
+        report_.Errorf("failed to create instance of <%s>: %s\n", interfaceName, [[error localizedDescription] UTF8String]);
+    else
+        report_.Errorf("failed to create instance of <%s>\n", interfaceName);
+}
+
 
 } // /namespace LLGL
 
@@ -118,8 +118,11 @@ static MTAttachmentFormat MakeDefaultMTAttachmentFormat(MTLPixelFormat format)
     return fmt;
 }
 
-static MTLPixelFormat GetColorMTLPixelFormat(int /*colorBits*/)
+static MTLPixelFormat GetColorMTLPixelFormat(int /*colorBits*/, ColorSpace colorSpace)
 {
+    /* Extended dynamic range drawables need a floating-point format, which is also valid for the PQ color space */
+    if (colorSpace != ColorSpace::SRGB)
+        return MTLPixelFormatRGBA16Float;
     return MTLPixelFormatBGRA8Unorm;
 }
 
@@ -148,7 +151,7 @@ static MTLPixelFormat GetDepthStencilMTLPixelFormat(int depthBits, int stencilBi
 MTRenderPass::MTRenderPass(id<MTLDevice> device, const SwapChainDescriptor& desc) :
     sampleCount_ { GetMTRenderPassSampleCount(device, desc.samples) }
 {
-    const MTLPixelFormat colorFormat        = GetColorMTLPixelFormat(desc.colorBits);
+    const MTLPixelFormat colorFormat        = GetColorMTLPixelFormat(desc.colorBits, desc.colorSpace);
     const MTLPixelFormat depthStencilFormat = GetDepthStencilMTLPixelFormat(desc.depthBits, desc.stencilBits, device);
 
     colorAttachments_ = { MakeDefaultMTAttachmentFormat(colorFormat) };
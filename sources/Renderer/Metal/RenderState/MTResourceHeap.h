@@ -44,9 +44,15 @@ class MTResourceHeap final : public ResourceHeap
 
         std::uint32_t GetNumDescriptorSets() const override;
 
+    public:
+
+        // Buffer slot the argument buffer of bindless resource heaps is bound to in every shader stage. Slot 30 is reserved for the tessellation factor buffer.
+        static constexpr NSUInteger argumentBufferSlot = 29;
+
     public:
 
         MTResourceHeap(
+            id<MTLDevice>                               device,
             const ResourceHeapDescriptor&               desc,
             const ArrayView<ResourceViewDescriptor>&    initialResourceViews = {}
         );
@@ -61,6 +67,18 @@ class MTResourceHeap final : public ResourceHeap
         bool HasGraphicsResources() const;
         bool HasComputeResources() const;
 
+        // Returns true if any texture from a placement heap without hazard tracking has been written to this resource heap.
+        inline bool HasUntrackedResources() const
+        {
+            return hasUntrackedResources_;
+        }
+
+        /*
+        Returns the residency set of this bindless resource heap or nil if residency sets are not supported (requires macOS 15 or iOS 18).
+        Pending changes to the residency set are committed with this call, so it must be called before the command buffer is committed.
+        */
+        id<MTLResidencySet> GetResidencySet();
+
     private:
 
         struct MTResourceBinding;
@@ -109,6 +127,23 @@ class MTResourceHeap final : public ResourceHeap
             stages[MTShaderStage_Count];
         };
 
+        // Argument buffer entry of a bindless resource heap binding.
+        struct MTArgumentBinding
+        {
+            MTResourceType      type;
+            NSUInteger          index;  // Argument index within the argument buffer, i.e. the [[id(n)]] attribute.
+            MTLResourceUsage    usage;
+        };
+
+        // Resources that must be made resident for a descriptor set of the argument buffer.
+        struct MTArgumentResidency
+        {
+            bool                            dirty           = true;
+            std::vector<id<MTLResource>>    resources[2];   // Resources with read and read-write usage that must be declared per command encoder.
+            std::vector<id<MTLHeap>>        heaps;          // Heaps of read-only resources, so each heap is declared only once instead of each of its resources.
+            std::vector<id<MTLResource>>    resident;       // Read-only resources without hazard tracking that are made resident by the residency set.
+        };
+
         // Metal resource binding slot with index to the input binding list
         struct MTResourceBinding
         {
@@ -140,6 +175,15 @@ class MTResourceHeap final : public ResourceHeap
             std::size_t                 payload1Stride
         );
 
+        void CreateArgumentBuffer(id<MTLDevice> device, const std::vector<BindingDescriptor>& bindings, std::uint32_t numSets);
+
+        std::uint32_t WriteArgumentResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+        void UpdateArgumentResidency(std::uint32_t descriptorSet);
+        void UpdateResidencySet();
+
+        void BindGraphicsArgumentBuffer(id<MTLRenderCommandEncoder> renderEncoder, std::uint32_t descriptorSet);
+        void BindComputeArgumentBuffer(id<MTLComputeCommandEncoder> computeEncoder, std::uint32_t descriptorSet);
+
         void WriteBindingMappings(MTShaderStage stage, MTResourceType type, const MTResourceBinding* first, NSUInteger count);
         void CacheResourceUsage();
 
@@ -153,13 +197,13 @@ class MTResourceHeap final : public ResourceHeap
 
         void ExchangeTextureView(
             std::uint32_t                           descriptorSet,
-            const BindingSegmentLocation::Stage&    binding,
+            std::uint32_t                           textureViewIndex,
             id<MTLTexture>                          textureView
         );
 
         id<MTLTexture> GetOrCreateTexture(
             std::uint32_t                           descriptorSet,
-            const BindingSegmentLocation::Stage&    binding,
+            std::uint32_t                           textureViewIndex,
             MTTexture&                              textureMT,
             const TextureViewDescriptor&            textureViewDesc
         );
@@ -188,6 +232,17 @@ class MTResourceHeap final : public ResourceHeap
         std::vector<id<MTLTexture>>         textureViews_;
         std::uint32_t                       numTextureViewsPerSet_  = 0;
 
+        id<MTLArgumentEncoder>              argumentEncoder_        = nil;  // Argument encoder for bindless resource heaps (see PipelineLayoutFlags::BindlessHeap).
+        id<MTLBuffer>                       argumentBuffer_         = nil;  // Argument buffer with one encoded range per descriptor set.
+        NSUInteger                          argumentBufferStride_   = 0;
+        std::vector<MTArgumentBinding>      argumentBindings_;
+        std::vector<id<MTLResource>>        argumentResources_;             // Resources encoded into the argument buffer for each descriptor.
+        std::vector<MTArgumentResidency>    argumentResidency_;
+        id<MTLResidencySet>                 residencySet_           = nil;  // Residency set for the heaps and untracked resources of all descriptor sets.
+        bool                                residencySetDirty_      = false;
+
+        bool                                hasUntrackedResources_  = false;
+
 };
 
 
@@ -18,6 +18,7 @@
 #include "../../../Core/Assertion.h"
 #include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
 
 
 namespace LLGL
@@ -79,11 +80,18 @@ struct MTResourceHeapSegment
 #define MTRESOURCEHEAP_DATA1_OFFSETS(PTR)               MTRESOURCEHEAP_DATA1(PTR, NSUInteger)
 
 
+// Shader stages that are mapped to the vertex, fragment, and kernel functions respectively.
+static constexpr long g_vertexStages    = (StageFlags::VertexStage | StageFlags::TessEvaluationStage);
+static constexpr long g_fragmentStages  = (StageFlags::FragmentStage);
+static constexpr long g_kernelStages    = (StageFlags::ComputeStage | StageFlags::TessControlStage);
+
+
 /*
  * MTResourceHeap class
  */
 
 MTResourceHeap::MTResourceHeap(
+    id<MTLDevice>                               device,
     const ResourceHeapDescriptor&               desc,
     const ArrayView<ResourceViewDescriptor>&    initialResourceViews)
 {
@@ -97,32 +105,37 @@ MTResourceHeap::MTResourceHeap(
     const auto  numBindings         = static_cast<std::uint32_t>(bindings.size());
     const auto  numResourceViews    = GetNumResourceViewsOrThrow(numBindings, desc, initialResourceViews);
 
+    /* Encode all heap bindings into an argument buffer for bindless resource heaps */
+    if (pipelineLayoutMT->IsBindlessHeap())
+    {
+        CreateArgumentBuffer(device, bindings, numResourceViews / numBindings);
+        if (!initialResourceViews.empty())
+            WriteResourceViews(0, initialResourceViews);
+        return;
+    }
+
     /* Allocate array to map binding index to descriptor index */
     bindingMap_.resize(numBindings);
 
     /* Build buffer segments */
-    constexpr long vertexStages     = (StageFlags::VertexStage | StageFlags::TessEvaluationStage);
-    constexpr long fragmentStages   = (StageFlags::FragmentStage);
-    constexpr long kernelStages     = (StageFlags::ComputeStage | StageFlags::TessControlStage);
-
     BindingDescriptorIterator bindingIter{ bindings };
 
     /* Build vertex resource segments */
-    segmentation_.numVertexBufferSegments       = AllocBufferSegments(bindingIter, vertexStages);
-    segmentation_.numVertexTextureSegments      = AllocTextureSegments(bindingIter, vertexStages);
-    segmentation_.numVertexSamplerSegments      = AllocSamplerStateSegments(bindingIter, vertexStages);
+    segmentation_.numVertexBufferSegments       = AllocBufferSegments(bindingIter, g_vertexStages);
+    segmentation_.numVertexTextureSegments      = AllocTextureSegments(bindingIter, g_vertexStages);
+    segmentation_.numVertexSamplerSegments      = AllocSamplerStateSegments(bindingIter, g_vertexStages);
 
     /* Build fragment resource segments */
-    segmentation_.numFragmentBufferSegments     = AllocBufferSegments(bindingIter, fragmentStages);
-    segmentation_.numFragmentTextureSegments    = AllocTextureSegments(bindingIter, fragmentStages);
-    segmentation_.numFragmentSamplerSegments    = AllocSamplerStateSegments(bindingIter, fragmentStages);
+    segmentation_.numFragmentBufferSegments     = AllocBufferSegments(bindingIter, g_fragmentStages);
+    segmentation_.numFragmentTextureSegments    = AllocTextureSegments(bindingIter, g_fragmentStages);
+    segmentation_.numFragmentSamplerSegments    = AllocSamplerStateSegments(bindingIter, g_fragmentStages);
 
     /* Build kernel resource segments (and store buffer offset to kernel segments) */
     heapOffsetKernel_ = static_cast<std::uint32_t>(heap_.Size());
 
-    segmentation_.numKernelBufferSegments       = AllocBufferSegments(bindingIter, kernelStages);
-    segmentation_.numKernelTextureSegments      = AllocTextureSegments(bindingIter, kernelStages);
-    segmentation_.numKernelSamplerSegments      = AllocSamplerStateSegments(bindingIter, kernelStages);
+    segmentation_.numKernelBufferSegments       = AllocBufferSegments(bindingIter, g_kernelStages);
+    segmentation_.numKernelTextureSegments      = AllocTextureSegments(bindingIter, g_kernelStages);
+    segmentation_.numKernelSamplerSegments      = AllocSamplerStateSegments(bindingIter, g_kernelStages);
 
     /* Store resource usage bits in segmentation header */
     CacheResourceUsage();
@@ -146,10 +159,15 @@ MTResourceHeap::~MTResourceHeap()
         if (tex != nil)
             [tex release];
     }
+    [argumentBuffer_ release];
+    [argumentEncoder_ release];
+    [residencySet_ release];
 }
 
 std::uint32_t MTResourceHeap::GetNumDescriptorSets() const
 {
+    if (argumentEncoder_ != nil)
+        return static_cast<std::uint32_t>(argumentResidency_.size());
     return static_cast<std::uint32_t>(heap_.NumSets());
 }
 
@@ -159,6 +177,9 @@ std::uint32_t MTResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
     if (resourceViews.empty())
         return 0;
 
+    if (argumentEncoder_ != nil)
+        return WriteArgumentResourceViews(firstDescriptor, resourceViews);
+
     const auto numSets          = GetNumDescriptorSets();
     const auto numBindings      = static_cast<std::uint32_t>(bindingMap_.size());
     const auto numDescriptors   = numSets * numBindings;
@@ -217,6 +238,9 @@ std::uint32_t MTResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
 
 void MTResourceHeap::BindGraphicsResources(id<MTLRenderCommandEncoder> renderEncoder, std::uint32_t descriptorSet)
 {
+    if (argumentEncoder_ != nil)
+        return BindGraphicsArgumentBuffer(renderEncoder, descriptorSet);
+
     if (descriptorSet >= heap_.NumSets())
         return;
 
@@ -229,6 +253,9 @@ void MTResourceHeap::BindGraphicsResources(id<MTLRenderCommandEncoder> renderEnc
 
 void MTResourceHeap::BindComputeResources(id<MTLComputeCommandEncoder> computeEncoder, std::uint32_t descriptorSet)
 {
+    if (argumentEncoder_ != nil)
+        return BindComputeArgumentBuffer(computeEncoder, descriptorSet);
+
     if (descriptorSet >= heap_.NumSets())
         return;
 
@@ -561,6 +588,8 @@ void MTResourceHeap::WriteResourceViewBuffer(const ResourceViewDescriptor& desc,
 {
     /* Get buffer resource and write MTLBuffer ID plus offset (Metal only needs offset) */
     auto bufferMT = LLGL_CAST(MTBuffer*, GetAsExpectedBuffer(desc.resource));
+    if (bufferMT->IsUntracked())
+        hasUntrackedResources_ = true;
     MTRESOURCEHEAP_DATA0_MTLBUFFER(heapPtr)[binding.descriptorIndex] = bufferMT->GetNative();
     MTRESOURCEHEAP_DATA1_OFFSETS(heapPtr)[binding.descriptorIndex] = static_cast<NSUInteger>(desc.bufferView.offset);
 }
@@ -569,7 +598,9 @@ void MTResourceHeap::WriteResourceViewTexture(const ResourceViewDescriptor& desc
 {
     /* Get texture resource and Write MTLTexture ID */
     auto textureMT = LLGL_CAST(MTTexture*, GetAsExpectedTexture(desc.resource));
-    MTRESOURCEHEAP_DATA0_MTLTEXTURE(heapPtr)[binding.descriptorIndex] = GetOrCreateTexture(descriptorSet, binding, *textureMT, desc.textureView);
+    if (textureMT->IsUntracked())
+        hasUntrackedResources_ = true;
+    MTRESOURCEHEAP_DATA0_MTLTEXTURE(heapPtr)[binding.descriptorIndex] = GetOrCreateTexture(descriptorSet, binding.textureViewIndex, *textureMT, desc.textureView);
 }
 
 void MTResourceHeap::WriteResourceViewSamplerState(const ResourceViewDescriptor& desc, char* heapPtr, const BindingSegmentLocation::Stage& binding)
@@ -579,6 +610,325 @@ void MTResourceHeap::WriteResourceViewSamplerState(const ResourceViewDescriptor&
     MTRESOURCEHEAP_DATA0_MTLSAMPLERSTATE(heapPtr)[binding.descriptorIndex] = samplerMT->GetNative();
 }
 
+static MTResourceType ToMTResourceType(const ResourceType type)
+{
+    switch (type)
+    {
+        case ResourceType::Buffer:  return MTResourceType_Buffer;
+        case ResourceType::Texture: return MTResourceType_Texture;
+        default:                    return MTResourceType_SamplerState;
+    }
+}
+
+void MTResourceHeap::CreateArgumentBuffer(id<MTLDevice> device, const std::vector<BindingDescriptor>& bindings, std::uint32_t numSets)
+{
+    if (@available(iOS 11.0, macOS 10.13, *))
+    {
+        /* Describe one argument per heap binding; the binding slot specifies the [[id(n)]] attribute of the argument in the shader */
+        NSMutableArray<MTLArgumentDescriptor*>* arguments = [[NSMutableArray alloc] initWithCapacity:bindings.size()];
+
+        argumentBindings_.reserve(bindings.size());
+
+        for (const BindingDescriptor& binding : bindings)
+        {
+            const bool isStorage = ((binding.bindFlags & BindFlags::Storage) != 0);
+
+            MTArgumentBinding argBinding;
+            {
+                argBinding.type     = ToMTResourceType(binding.type);
+                argBinding.index    = binding.slot.index;
+                argBinding.usage    = (isStorage ? (MTLResourceUsageRead | MTLResourceUsageWrite) : MTLResourceUsageRead);
+            }
+            argumentBindings_.push_back(argBinding);
+
+            MTLArgumentDescriptor* argDesc = [MTLArgumentDescriptor argumentDescriptor];
+            {
+                argDesc.index   = argBinding.index;
+                argDesc.access  = (isStorage ? MTLArgumentAccessReadWrite : MTLArgumentAccessReadOnly);
+                switch (argBinding.type)
+                {
+                    case MTResourceType_Buffer:         argDesc.dataType = MTLDataTypePointer;  break;
+                    case MTResourceType_Texture:        argDesc.dataType = MTLDataTypeTexture;  break;
+                    case MTResourceType_SamplerState:   argDesc.dataType = MTLDataTypeSampler;  break;
+                }
+            }
+            [arguments addObject:argDesc];
+
+            /* Argument buffer is bound to each shader stage that has at least one heap binding */
+            if ((binding.stageFlags & g_vertexStages) != 0)
+                segmentation_.hasVertexResources = 1;
+            if ((binding.stageFlags & g_fragmentStages) != 0)
+                segmentation_.hasFragmentResources = 1;
+            if ((binding.stageFlags & g_kernelStages) != 0)
+                segmentation_.hasKernelResources = 1;
+        }
+
+        argumentEncoder_ = [device newArgumentEncoderWithArguments:arguments];
+        [arguments release];
+
+        LLGL_ASSERT(argumentEncoder_ != nil, "failed to create Metal argument encoder for bindless resource heap");
+
+        /* Allocate argument buffer with one aligned range per descriptor set, so each set can be bound with a single buffer offset */
+        argumentBufferStride_ = GetAlignedSize<NSUInteger>([argumentEncoder_ encodedLength], std::max<NSUInteger>(1u, [argumentEncoder_ alignment]));
+        argumentBuffer_ = [device
+            newBufferWithLength:    std::max<NSUInteger>(1u, argumentBufferStride_ * numSets)
+            options:                MTLResourceStorageModeShared
+        ];
+
+        /* Allocate resource arrays; each binding has its own texture view entry, since texture bindings are not segmented */
+        argumentResources_.resize(bindings.size() * numSets, nil);
+        argumentResidency_.resize(numSets);
+
+        numTextureViewsPerSet_ = static_cast<std::uint32_t>(bindings.size());
+        textureViews_.resize(numTextureViewsPerSet_ * numSets, nil);
+
+        /* Residency set makes heaps and untracked resources resident once per command buffer instead of once per command encoder */
+        if (@available(iOS 18.0, macOS 15.0, *))
+        {
+            MTLResidencySetDescriptor* residencySetDesc = [[MTLResidencySetDescriptor alloc] init];
+            residencySet_ = [device newResidencySetWithDescriptor:residencySetDesc error:nil];
+            [residencySetDesc release];
+        }
+    }
+    else
+        LLGL_TRAP("bindless resource heaps require Metal argument buffers");
+}
+
+std::uint32_t MTResourceHeap::WriteArgumentResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    const auto numSets          = GetNumDescriptorSets();
+    const auto numBindings      = static_cast<std::uint32_t>(argumentBindings_.size());
+    const auto numDescriptors   = numSets * numBindings;
+
+    /* Silently quit on out of bounds; debug layer must report these errors */
+    if (firstDescriptor >= numDescriptors)
+        return 0;
+    if (firstDescriptor + resourceViews.size() > numDescriptors)
+        return 0;
+
+    /* Encode each resource view directly into the argument buffer range of its descriptor set */
+    std::uint32_t numWritten = 0;
+    std::uint32_t encodedSet = numSets;
+
+    for (const auto& desc : resourceViews)
+    {
+        /* Skip over empty resource descriptors */
+        if (desc.resource == nullptr)
+        {
+            ++firstDescriptor;
+            continue;
+        }
+
+        const auto  bindingIndex    = firstDescriptor % numBindings;
+        const auto  descriptorSet   = firstDescriptor / numBindings;
+        const auto& binding         = argumentBindings_[bindingIndex];
+
+        if (encodedSet != descriptorSet)
+        {
+            [argumentEncoder_ setArgumentBuffer:argumentBuffer_ offset:descriptorSet * argumentBufferStride_];
+            encodedSet = descriptorSet;
+        }
+
+        id<MTLResource>& resourceEntry = argumentResources_[firstDescriptor];
+
+        switch (binding.type)
+        {
+            case MTResourceType_Buffer:
+            {
+                auto bufferMT = LLGL_CAST(MTBuffer*, GetAsExpectedBuffer(desc.resource));
+                if (bufferMT->IsUntracked())
+                    hasUntrackedResources_ = true;
+                [argumentEncoder_
+                    setBuffer:  bufferMT->GetNative()
+                    offset:     static_cast<NSUInteger>(desc.bufferView.offset)
+                    atIndex:    binding.index
+                ];
+                resourceEntry = bufferMT->GetNative();
+            }
+            break;
+
+            case MTResourceType_Texture:
+            {
+                auto textureMT = LLGL_CAST(MTTexture*, GetAsExpectedTexture(desc.resource));
+                if (textureMT->IsUntracked())
+                    hasUntrackedResources_ = true;
+                id<MTLTexture> texture = GetOrCreateTexture(descriptorSet, bindingIndex, *textureMT, desc.textureView);
+                [argumentEncoder_ setTexture:texture atIndex:binding.index];
+                resourceEntry = texture;
+            }
+            break;
+
+            case MTResourceType_SamplerState:
+            {
+                /* Sampler states don't have to be made resident */
+                auto samplerMT = LLGL_CAST(MTSampler*, GetAsExpectedSampler(desc.resource));
+                [argumentEncoder_ setSamplerState:samplerMT->GetNative() atIndex:binding.index];
+            }
+            break;
+        }
+
+        /* Resource list of this descriptor set must be updated with the next bind call */
+        argumentResidency_[descriptorSet].dirty = true;
+
+        ++numWritten;
+        ++firstDescriptor;
+    }
+
+    return numWritten;
+}
+
+// Returns true if hazard tracking is disabled for the specified resource.
+static bool IsUntrackedResource(id<MTLResource> resource)
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+        return ([resource hazardTrackingMode] == MTLHazardTrackingModeUntracked);
+    return false;
+}
+
+void MTResourceHeap::UpdateArgumentResidency(std::uint32_t descriptorSet)
+{
+    /* Gather all encoded resources of the descriptor set by their usage, so they can be made resident with one call per usage */
+    MTArgumentResidency& residency = argumentResidency_[descriptorSet];
+
+    for (auto& resources : residency.resources)
+        resources.clear();
+    residency.heaps.clear();
+    residency.resident.clear();
+
+    const std::size_t numBindings = argumentBindings_.size();
+    const id<MTLResource>* setResources = &argumentResources_[descriptorSet * numBindings];
+
+    for_range(i, numBindings)
+    {
+        id<MTLResource> resource = setResources[i];
+        if (resource == nil)
+            continue;
+
+        if ((argumentBindings_[i].usage & MTLResourceUsageWrite) != 0)
+        {
+            /* Resources with write access must always be declared individually for Metal to track their hazards */
+            residency.resources[1].push_back(resource);
+            continue;
+        }
+
+        if (@available(iOS 11.0, macOS 10.13, *))
+        {
+            /* Declare read-only resources from the same heap with a single heap residency */
+            if (id<MTLHeap> heap = [resource heap])
+            {
+                if (std::find(residency.heaps.begin(), residency.heaps.end(), heap) == residency.heaps.end())
+                    residency.heaps.push_back(heap);
+                continue;
+            }
+        }
+
+        /* Untracked resources don't rely on per-encoder declarations for hazard tracking, so the residency set can cover them */
+        if (residencySet_ != nil && IsUntrackedResource(resource))
+            residency.resident.push_back(resource);
+        else
+            residency.resources[0].push_back(resource);
+    }
+
+    residency.dirty = false;
+
+    if (residencySet_ != nil)
+        residencySetDirty_ = true;
+}
+
+void MTResourceHeap::UpdateResidencySet()
+{
+    if (@available(iOS 18.0, macOS 15.0, *))
+    {
+        /* Rebuild residency set from the heaps and untracked resources of all descriptor sets */
+        [residencySet_ removeAllAllocations];
+
+        for (const MTArgumentResidency& residency : argumentResidency_)
+        {
+            for (id<MTLHeap> heap : residency.heaps)
+                [residencySet_ addAllocation:heap];
+            for (id<MTLResource> resource : residency.resident)
+                [residencySet_ addAllocation:resource];
+        }
+
+        [residencySet_ commit];
+    }
+    residencySetDirty_ = false;
+}
+
+id<MTLResidencySet> MTResourceHeap::GetResidencySet()
+{
+    if (residencySet_ == nil)
+        return nil;
+
+    for_range(descriptorSet, GetNumDescriptorSets())
+    {
+        if (argumentResidency_[descriptorSet].dirty)
+            UpdateArgumentResidency(descriptorSet);
+    }
+
+    if (residencySetDirty_)
+        UpdateResidencySet();
+
+    return residencySet_;
+}
+
+void MTResourceHeap::BindGraphicsArgumentBuffer(id<MTLRenderCommandEncoder> renderEncoder, std::uint32_t descriptorSet)
+{
+    if (descriptorSet >= argumentResidency_.size())
+        return;
+
+    if (argumentResidency_[descriptorSet].dirty)
+        UpdateArgumentResidency(descriptorSet);
+
+    /* Bind entire descriptor set with a single buffer binding per shader stage */
+    const NSUInteger offset = descriptorSet * argumentBufferStride_;
+
+    if (segmentation_.hasVertexResources)
+        [renderEncoder setVertexBuffer:argumentBuffer_ offset:offset atIndex:MTResourceHeap::argumentBufferSlot];
+    if (segmentation_.hasFragmentResources)
+        [renderEncoder setFragmentBuffer:argumentBuffer_ offset:offset atIndex:MTResourceHeap::argumentBufferSlot];
+
+    /* Resources that are only referenced by the argument buffer must be made resident explicitly */
+    if (@available(iOS 11.0, macOS 10.13, *))
+    {
+        const MTArgumentResidency& residency = argumentResidency_[descriptorSet];
+        if (!residency.resources[0].empty())
+            [renderEncoder useResources:residency.resources[0].data() count:residency.resources[0].size() usage:MTLResourceUsageRead];
+        if (!residency.resources[1].empty())
+            [renderEncoder useResources:residency.resources[1].data() count:residency.resources[1].size() usage:(MTLResourceUsageRead | MTLResourceUsageWrite)];
+
+        /* Heaps are already resident if they are part of the residency set */
+        if (residencySet_ == nil && !residency.heaps.empty())
+            [renderEncoder useHeaps:residency.heaps.data() count:residency.heaps.size()];
+    }
+}
+
+void MTResourceHeap::BindComputeArgumentBuffer(id<MTLComputeCommandEncoder> computeEncoder, std::uint32_t descriptorSet)
+{
+    if (descriptorSet >= argumentResidency_.size() || !segmentation_.hasKernelResources)
+        return;
+
+    if (argumentResidency_[descriptorSet].dirty)
+        UpdateArgumentResidency(descriptorSet);
+
+    /* Bind entire descriptor set with a single buffer binding */
+    [computeEncoder setBuffer:argumentBuffer_ offset:descriptorSet * argumentBufferStride_ atIndex:MTResourceHeap::argumentBufferSlot];
+
+    /* Resources that are only referenced by the argument buffer must be made resident explicitly */
+    if (@available(iOS 11.0, macOS 10.13, *))
+    {
+        const MTArgumentResidency& residency = argumentResidency_[descriptorSet];
+        if (!residency.resources[0].empty())
+            [computeEncoder useResources:residency.resources[0].data() count:residency.resources[0].size() usage:MTLResourceUsageRead];
+        if (!residency.resources[1].empty())
+            [computeEncoder useResources:residency.resources[1].data() count:residency.resources[1].size() usage:(MTLResourceUsageRead | MTLResourceUsageWrite)];
+
+        /* Heaps are already resident if they are part of the residency set */
+        if (residencySet_ == nil && !residency.heaps.empty())
+            [computeEncoder useHeaps:residency.heaps.data() count:residency.heaps.size()];
+    }
+}
+
 [[noreturn]]
 static void ErrTextureViewSwizzleNotSupported()
 {
@@ -603,12 +953,12 @@ static void ValidateTexViewNoTypeAndRange(const TextureViewDescriptor& desc, MTT
 }
 
 void MTResourceHeap::ExchangeTextureView(
-    std::uint32_t                           descriptorSet,
-    const BindingSegmentLocation::Stage&    binding,
-    id<MTLTexture>                          textureView)
+    std::uint32_t   descriptorSet,
+    std::uint32_t   textureViewIndex,
+    id<MTLTexture>  textureView)
 {
-    LLGL_ASSERT(binding.textureViewIndex < numTextureViewsPerSet_);
-    auto& texViewEntry = textureViews_[descriptorSet * numTextureViewsPerSet_ + binding.textureViewIndex];
+    LLGL_ASSERT(textureViewIndex < numTextureViewsPerSet_);
+    auto& texViewEntry = textureViews_[descriptorSet * numTextureViewsPerSet_ + textureViewIndex];
     if (texViewEntry != textureView)
     {
         if (texViewEntry != nil)
@@ -618,10 +968,10 @@ void MTResourceHeap::ExchangeTextureView(
 }
 
 id<MTLTexture> MTResourceHeap::GetOrCreateTexture(
-    std::uint32_t                           descriptorSet,
-    const BindingSegmentLocation::Stage&    binding,
-    MTTexture&                              textureMT,
-    const TextureViewDescriptor&            textureViewDesc)
+    std::uint32_t                   descriptorSet,
+    std::uint32_t                   textureViewIndex,
+    MTTexture&                      textureMT,
+    const TextureViewDescriptor&    textureViewDesc)
 {
     if (IsTextureViewEnabled(textureViewDesc))
     {
@@ -673,13 +1023,13 @@ id<MTLTexture> MTResourceHeap::GetOrCreateTexture(
 
         /* Store texture view reference */
         LLGL_ASSERT(textureView != nil, "unable to create Metal texture view");
-        ExchangeTextureView(descriptorSet, binding, textureView);
+        ExchangeTextureView(descriptorSet, textureViewIndex, textureView);
         return textureView;
     }
     else
     {
         /* Release previously stored texture view reference */
-        ExchangeTextureView(descriptorSet, binding, nil);
+        ExchangeTextureView(descriptorSet, textureViewIndex, nil);
         return textureMT.GetNative();
     }
 }
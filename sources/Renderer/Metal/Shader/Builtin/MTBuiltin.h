@@ -15,6 +15,9 @@
 extern const char*          g_metalLibFillBufferByte4;
 extern const std::size_t    g_metalLibFillBufferByte4Len;
 
+// Metal shader source to encode indirect draw commands into an ICB; compiled at runtime since it requires Metal 2.1.
+extern const char*          g_metalSrcEncodeIndirectCountDraws;
+
 
 #endif
 
@@ -31,6 +31,98 @@ const std::size_t g_metalLibFillBufferByte4Len =
     #endif
 );
 
+const char* g_metalSrcEncodeIndirectCountDraws = R"(
+#include <metal_stdlib>
+
+using namespace metal;
+
+struct ICBContainer
+{
+    command_buffer commandBuffer [[id(0)]];
+};
+
+struct EncodeParams
+{
+    uint maxNumCommands;
+    uint stride;
+    uint primitiveType;
+    uint indexType16Bits;
+};
+
+struct DrawIndirectArguments
+{
+    uint numVertices;
+    uint numInstances;
+    uint firstVertex;
+    uint firstInstance;
+};
+
+struct DrawIndexedIndirectArguments
+{
+    uint numIndices;
+    uint numInstances;
+    uint firstIndex;
+    int  vertexOffset;
+    uint firstInstance;
+};
+
+// Encodes the first <count> draw commands into the ICB and resets the remaining ones
+kernel void EncodeDrawIndirectCount(
+    device const uchar*     argsBuffer  [[buffer(0)]],
+    device const uint&      count       [[buffer(1)]],
+    device ICBContainer&    icb         [[buffer(2)]],
+    constant EncodeParams&  params      [[buffer(3)]],
+    uint                    threadID    [[thread_position_in_grid]])
+{
+    if (threadID >= params.maxNumCommands)
+        return;
+
+    render_command cmd(icb.commandBuffer, threadID);
+    if (threadID < count)
+    {
+        device const DrawIndirectArguments& args = *(device const DrawIndirectArguments*)(argsBuffer + threadID * params.stride);
+        cmd.draw_primitives(primitive_type(params.primitiveType), args.firstVertex, args.numVertices, args.numInstances, args.firstInstance);
+    }
+    else
+        cmd.reset();
+}
+
+// Encodes the first <count> indexed draw commands into the ICB and resets the remaining ones
+kernel void EncodeDrawIndexedIndirectCount(
+    device const uchar*     argsBuffer  [[buffer(0)]],
+    device const uint&      count       [[buffer(1)]],
+    device ICBContainer&    icb         [[buffer(2)]],
+    constant EncodeParams&  params      [[buffer(3)]],
+    device const uchar*     indexBuffer [[buffer(4)]],
+    uint                    threadID    [[thread_position_in_grid]])
+{
+    if (threadID >= params.maxNumCommands)
+        return;
+
+    render_command cmd(icb.commandBuffer, threadID);
+    if (threadID < count)
+    {
+        device const DrawIndexedIndirectArguments& args = *(device const DrawIndexedIndirectArguments*)(argsBuffer + threadID * params.stride);
+        if (params.indexType16Bits != 0)
+        {
+            cmd.draw_indexed_primitives(
+                primitive_type(params.primitiveType), args.numIndices, (device const ushort*)indexBuffer + args.firstIndex,
+                args.numInstances, uint(args.vertexOffset), args.firstInstance
+            );
+        }
+        else
+        {
+            cmd.draw_indexed_primitives(
+                primitive_type(params.primitiveType), args.numIndices, (device const uint*)indexBuffer + args.firstIndex,
+                args.numInstances, uint(args.vertexOffset), args.firstInstance
+            );
+        }
+    }
+    else
+        cmd.reset();
+}
+)";
+
 
 
 // ================================================================================
@@ -0,0 +1,63 @@
+/*
+ * MTLibraryCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_LIBRARY_CACHE_H
+#define LLGL_MT_LIBRARY_CACHE_H
+
+
+#import <Metal/Metal.h>
+
+#include <unordered_map>
+#include <mutex>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Cache for MTLLibrary objects that have been compiled from source. Thread-safe, since libraries are added from the completion handlers of asynchronous compilations.
+Libraries are content-addressed by the hash of their source and compile options,
+so shaders that only differ in their entry point share the same library and Metal compiles the source only once.
+*/
+class MTLibraryCache
+{
+
+    public:
+
+        MTLibraryCache() = default;
+        ~MTLibraryCache();
+
+        MTLibraryCache(const MTLibraryCache&) = delete;
+        MTLibraryCache& operator = (const MTLibraryCache&) = delete;
+
+        // Returns the library for the specified key or nil if there is no entry. The returned library is retained for the caller.
+        id<MTLLibrary> FindLibrary(std::uint64_t key);
+
+        // Stores the specified library with the specified key. Existing entries for this key are kept, since libraries can be compiled concurrently.
+        void AddLibrary(std::uint64_t key, id<MTLLibrary> library);
+
+        // Releases all cached libraries.
+        void Clear();
+
+    private:
+
+        std::unordered_map<std::uint64_t, id<MTLLibrary>>   libraries_;
+        std::mutex                                          mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
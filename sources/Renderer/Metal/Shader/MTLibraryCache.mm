@@ -0,0 +1,48 @@
+/*
+ * MTLibraryCache.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTLibraryCache.h"
+
+
+namespace LLGL
+{
+
+
+MTLibraryCache::~MTLibraryCache()
+{
+    Clear();
+}
+
+id<MTLLibrary> MTLibraryCache::FindLibrary(std::uint64_t key)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    auto it = libraries_.find(key);
+    return (it != libraries_.end() ? [it->second retain] : nil);
+}
+
+void MTLibraryCache::AddLibrary(std::uint64_t key, id<MTLLibrary> library)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    auto result = libraries_.insert({ key, library });
+    if (result.second)
+        [library retain];
+}
+
+void MTLibraryCache::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (auto& entry : libraries_)
+        [entry.second release];
+    libraries_.clear();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -13,12 +13,16 @@
 
 #include <LLGL/Shader.h>
 #include <LLGL/Report.h>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class MTLibraryCache;
+struct SpecializationConstant;
+
 class MTShader final : public Shader
 {
 
@@ -28,7 +32,7 @@ class MTShader final : public Shader
 
     public:
 
-        MTShader(id<MTLDevice> device, const ShaderDescriptor& desc);
+        MTShader(id<MTLDevice> device, const ShaderDescriptor& desc, MTLibraryCache* libraryCache = nullptr);
         ~MTShader();
 
     public:
@@ -42,15 +46,23 @@ class MTShader final : public Shader
         // Returns the number of patch control points for a post-tessellation vertex shader or 0 if this is not a vertex shader.
         NSUInteger GetNumPatchControlPoints() const;
 
-        // Returns the native MTLFunction object.
+        // Returns the native MTLFunction object. Blocks until an asynchronous compilation has finished.
         inline id<MTLFunction> GetNative() const
         {
+            WaitForCompilation();
             return native_;
         }
 
-        // Returns the MTLVertexDescriptor object for this shader program.
+        /*
+        Returns a new MTLFunction object that is specialized with the specified function constants, or null on failure.
+        If the list is empty, the native function is returned with an incremented reference counter. The caller must release the returned object.
+        */
+        id<MTLFunction> NewSpecializedFunction(const std::vector<SpecializationConstant>& constants, NSError*& error) const;
+
+        // Returns the MTLVertexDescriptor object for this shader program. Blocks until an asynchronous compilation has finished.
         inline MTLVertexDescriptor* GetMTLVertexDesc() const
         {
+            WaitForCompilation();
             return vertexDesc_;
         }
 
@@ -62,8 +74,8 @@ class MTShader final : public Shader
 
     private:
 
-        bool Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
-        bool CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
+        bool Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTLibraryCache* libraryCache);
+        bool CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTLibraryCache* libraryCache);
         bool CompileFromLibraryWithData(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
         bool CompileFromDefaultLibrary(id<MTLDevice> device, const ShaderDescriptor& shaderDesc);
 
@@ -73,6 +85,13 @@ class MTShader final : public Shader
 
         bool ReflectComputePipeline(ShaderReflection& reflection) const;
 
+        // Blocks until the library has been compiled, if it was compiled asynchronously.
+        inline void WaitForCompilation() const
+        {
+            if (compileGroup_ != nullptr)
+                dispatch_group_wait(compileGroup_, DISPATCH_TIME_FOREVER);
+        }
+
     private:
 
         id<MTLDevice>           device_             = nil;
@@ -84,6 +103,8 @@ class MTShader final : public Shader
 
         MTLVertexDescriptor*    vertexDesc_         = nullptr;
 
+        dispatch_group_t        compileGroup_       = nullptr; // Only created for libraries that are compiled asynchronously
+
 };
 
 
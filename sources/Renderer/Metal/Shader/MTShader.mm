@@ -6,29 +6,35 @@
  */
 
 #include "MTShader.h"
+#include "MTLibraryCache.h"
 #include "../MTTypes.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/HashUtils.h"
 #include <LLGL/Platform/Platform.h>
+#include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Utils/ForRange.h>
 #include <cstring>
 #include <set>
+#include <string>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
-MTShader::MTShader(id<MTLDevice> device, const ShaderDescriptor& desc) :
-    Shader  { desc.type },
+MTShader::MTShader(id<MTLDevice> device, const ShaderDescriptor& desc, MTLibraryCache* libraryCache) :
+    Shader  { desc      },
     device_ { device    }
 {
-    if (Compile(device, desc))
+    if (Compile(device, desc, libraryCache))
     {
-        /* Build vertex input layout */
-        BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
+        /* Build vertex input layout; This is deferred to the completion handler if the library is compiled asynchronously */
+        if (compileGroup_ == nullptr)
+            BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
 
-        /* Store work group size for compute shaders */
-        if (desc.type == ShaderType::Compute)
+        /* Store work group size for compute shaders, object and mesh shaders which need it per draw command, and tile shaders which need it per tile dispatch */
+        if (desc.type == ShaderType::Compute || desc.type == ShaderType::Task || desc.type == ShaderType::Mesh || desc.type == ShaderType::Tile)
         {
             const auto& workGroupSize = desc.compute.workGroupSize;
             numThreadsPerGroup_ = MTLSizeMake(workGroupSize.width, workGroupSize.height, workGroupSize.depth);
@@ -38,6 +44,12 @@ MTShader::MTShader(id<MTLDevice> device, const ShaderDescriptor& desc) :
 
 MTShader::~MTShader()
 {
+    /* Completion handler must not outlive this shader */
+    if (compileGroup_ != nullptr)
+    {
+        dispatch_group_wait(compileGroup_, DISPATCH_TIME_FOREVER);
+        dispatch_release(compileGroup_);
+    }
     if (vertexDesc_)
         [vertexDesc_ release];
     if (native_)
@@ -76,11 +88,15 @@ static MTLLanguageVersion GetMTLLanguageVersion(const ShaderDescriptor& desc)
 
 const Report* MTShader::GetReport() const
 {
+    WaitForCompilation();
     return (report_ ? &report_ : nullptr);
 }
 
 bool MTShader::Reflect(ShaderReflection& reflection) const
 {
+    if (GetSerializedReflection(reflection))
+        return true;
+
     if (GetType() == ShaderType::Compute)
         return ReflectComputePipeline(reflection);
     else
@@ -89,6 +105,7 @@ bool MTShader::Reflect(ShaderReflection& reflection) const
 
 bool MTShader::IsPostTessellationVertex() const
 {
+    WaitForCompilation();
     return (GetType() == ShaderType::Vertex && native_ != nil && [native_ patchType] != MTLPatchTypeNone);
 }
 
@@ -100,17 +117,50 @@ NSUInteger MTShader::GetNumPatchControlPoints() const
         return 0;
 }
 
+id<MTLFunction> MTShader::NewSpecializedFunction(const std::vector<SpecializationConstant>& constants, NSError*& error) const
+{
+    WaitForCompilation();
+
+    if (constants.empty() || native_ == nil || library_ == nil)
+        return [native_ retain];
+
+    if (@available(iOS 10.0, macOS 10.12, *))
+    {
+        /* Take data type of each constant from the function reflection, since specialization constants only specify their 32-bit value */
+        MTLFunctionConstantValues* constantValues = [[MTLFunctionConstantValues alloc] init];
+
+        NSDictionary<NSString*, MTLFunctionConstant*>* functionConstants = [native_ functionConstantsDictionary];
+        for (MTLFunctionConstant* functionConstant in [functionConstants objectEnumerator])
+        {
+            for (const SpecializationConstant& constant : constants)
+            {
+                if (constant.id == functionConstant.index)
+                {
+                    [constantValues setConstantValue:&(constant.value) type:functionConstant.type atIndex:functionConstant.index];
+                    break;
+                }
+            }
+        }
+
+        id<MTLFunction> function = [library_ newFunctionWithName:[native_ name] constantValues:constantValues error:&error];
+        [constantValues release];
+        return function;
+    }
+
+    return [native_ retain];
+}
+
 
 /*
  * ======= Private: =======
  */
 
-bool MTShader::Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc)
+bool MTShader::Compile(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTLibraryCache* libraryCache)
 {
     if ((shaderDesc.flags & ShaderCompileFlags::DefaultLibrary) != 0)
         return CompileFromDefaultLibrary(device, shaderDesc);
     else if (IsShaderSourceCode(shaderDesc.sourceType))
-        return CompileFromLibraryWithSource(device, shaderDesc);
+        return CompileFromLibraryWithSource(device, shaderDesc, libraryCache);
     else
         return CompileFromLibraryWithData(device, shaderDesc);
 }
@@ -154,7 +204,31 @@ bool MTShader::CompileFromDefaultLibrary(id<MTLDevice> device, const ShaderDescr
     return LoadShaderFunction(shaderDesc.entryPoint);
 }
 
-bool MTShader::CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc)
+// Returns the key for the library cache. The entry point and shader type are not part of the key, since a library can contain multiple functions.
+static std::uint64_t GetLibraryCacheKey(const ShaderDescriptor& shaderDesc, NSString* sourceString)
+{
+    std::uint64_t seed = g_hashSeed;
+
+    HashString(seed, [sourceString UTF8String]);
+    HashString(seed, shaderDesc.profile);
+
+    if (shaderDesc.defines != nullptr)
+    {
+        for (const ShaderMacro* define = shaderDesc.defines; define->name != nullptr; ++define)
+        {
+            HashString(seed, define->name);
+            HashString(seed, define->definition);
+        }
+    }
+
+    /* Terminate macro list, so macros and flags can't alias each other */
+    HashBytes(seed, "", 1);
+    HashValue(seed, shaderDesc.flags);
+
+    return seed;
+}
+
+bool MTShader::CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDescriptor& shaderDesc, MTLibraryCache* libraryCache)
 {
     /* Get source */
     NSString* sourceString = nil;
@@ -180,23 +254,47 @@ bool MTShader::CompileFromLibraryWithSource(id<MTLDevice> device, const ShaderDe
     /* Convert entry point to NSString, and initialize shader compile options */
     MTLCompileOptions* opt = ToMTLCompileOptions(shaderDesc);
 
-    /* Load shader library */
-    NSError* error = [NSError alloc];
+    /* Re-use library that has been compiled from the same source and options */
+    const std::uint64_t libraryKey = (libraryCache != nullptr ? GetLibraryCacheKey(shaderDesc, sourceString) : 0);
+    if (libraryCache != nullptr)
+        library_ = libraryCache->FindLibrary(libraryKey);
 
-    library_ = [device
+    if (library_ != nil)
+    {
+        [sourceString release];
+        [opt release];
+        return LoadShaderFunction(shaderDesc.entryPoint);
+    }
+
+    /* Compile library asynchronously, so multiple shaders can be compiled in parallel by the Metal compiler service */
+    const std::string                   entryPoint      = (shaderDesc.entryPoint != nullptr ? shaderDesc.entryPoint : "");
+    const std::vector<VertexAttribute>  vertexAttribs   = shaderDesc.vertex.inputAttribs;
+    MTShader*                           self            = this;
+
+    compileGroup_ = dispatch_group_create();
+    dispatch_group_enter(compileGroup_);
+
+    [device
         newLibraryWithSource:   sourceString
         options:                opt
-        error:                  &error
+        completionHandler:      ^(id<MTLLibrary> library, NSError* error)
+        {
+            if (library != nil)
+            {
+                self->library_ = [library retain];
+                if (libraryCache != nullptr)
+                    libraryCache->AddLibrary(libraryKey, library);
+            }
+            if (self->LoadShaderFunction(entryPoint.c_str(), error))
+                self->BuildInputLayout(vertexAttribs.size(), vertexAttribs.data());
+            dispatch_group_leave(self->compileGroup_);
+        }
     ];
 
     [sourceString release];
     [opt release];
 
-    /* Load shader function with entry point */
-    const bool success = LoadShaderFunction(shaderDesc.entryPoint, error);
-    [error release];
-
-    return success;
+    return true;
 }
 
 //TODO: this is untested!!!
@@ -0,0 +1,59 @@
+/*
+ * MTPlacementHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_MT_PLACEMENT_HEAP_H
+#define LLGL_MT_PLACEMENT_HEAP_H
+
+
+#import <Metal/Metal.h>
+
+#include <LLGL/PlacementHeap.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Holds a single MTLHeap of placement type that is shared by all textures placed into this heap.
+The heap does not track hazards of its resources, so textures can alias without false dependencies between them.
+Command encoders are synchronized with MTLFence objects instead (see MTCommandContext::FenceUntrackedResources).
+*/
+class MTPlacementHeap final : public PlacementHeap
+{
+
+    public:
+
+        MTPlacementHeap(id<MTLDevice> device, const PlacementHeapDescriptor& desc);
+        ~MTPlacementHeap();
+
+        // Returns the native MTLHeap object.
+        inline id<MTLHeap> GetNative() const
+        {
+            return native_;
+        }
+
+    public:
+
+        // Converts the specified texture descriptor for textures that are placed into a heap, i.e. private storage without hazard tracking.
+        static void ConvertPlacedTextureDesc(MTLTextureDescriptor* texDesc);
+
+    private:
+
+        id<MTLHeap> native_ = nil;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
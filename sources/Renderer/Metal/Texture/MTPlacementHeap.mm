@@ -0,0 +1,59 @@
+/*
+ * MTPlacementHeap.mm
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "MTPlacementHeap.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/PrintfUtils.h"
+
+
+namespace LLGL
+{
+
+
+MTPlacementHeap::MTPlacementHeap(id<MTLDevice> device, const PlacementHeapDescriptor& desc) :
+    PlacementHeap { desc.size }
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+        {
+            heapDesc.type               = MTLHeapTypePlacement;
+            heapDesc.storageMode        = MTLStorageModePrivate;
+            heapDesc.hazardTrackingMode = MTLHazardTrackingModeUntracked;
+            heapDesc.size               = static_cast<NSUInteger>(desc.size);
+        }
+        native_ = [device newHeapWithDescriptor:heapDesc];
+        [heapDesc release];
+    }
+
+    if (native_ == nil)
+        LLGL_TRAP("failed to create Metal placement heap with 0x%016" PRIX64 " bytes", desc.size);
+}
+
+MTPlacementHeap::~MTPlacementHeap()
+{
+    [native_ release];
+}
+
+void MTPlacementHeap::ConvertPlacedTextureDesc(MTLTextureDescriptor* texDesc)
+{
+    texDesc.storageMode = MTLStorageModePrivate;
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        texDesc.hazardTrackingMode  = MTLHazardTrackingModeUntracked;
+        texDesc.resourceOptions     = (MTLResourceStorageModePrivate | MTLResourceHazardTrackingModeUntracked);
+    }
+    else
+        texDesc.resourceOptions     = MTLResourceStorageModePrivate;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -50,6 +50,12 @@ class MTRenderTarget final : public RenderTarget
             return nativeRenderPass_;
         }
 
+        // Returns true if any attachment is a texture from a placement heap without hazard tracking.
+        inline bool HasUntrackedAttachments() const
+        {
+            return hasUntrackedAttachments_;
+        }
+
     private:
 
         void CreateAttachment(
@@ -78,6 +84,7 @@ class MTRenderTarget final : public RenderTarget
         std::uint32_t                   numColorAttachments_        = 0;
         MTRenderPass                    renderPass_;
         SmallVector<id<MTLTexture>, 2>  internalTextures_; // List of internally created MTLTexture views
+        bool                            hasUntrackedAttachments_    = false;
 
 };
 
@@ -11,6 +11,7 @@
 #include "../MTDevice.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/Exception.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
@@ -104,6 +105,13 @@ MTRenderTarget::MTRenderTarget(id<MTLDevice> device, const RenderTargetDescripto
         else
             LLGL_TRAP("invalid format for render-target depth-stencil attachment: %s", ToString(format));
     }
+
+    /* Render into consecutive array layers from the attachment slices for multiview rendering */
+    if (desc.viewMask != 0)
+    {
+        if (@available(iOS 12.0, macOS 10.11, *))
+            nativeRenderPass_.renderTargetArrayLength = NumMultiviewLayers(desc.viewMask);
+    }
 }
 
 MTRenderTarget::~MTRenderTarget()
@@ -177,6 +185,9 @@ void MTRenderTarget::CreateAttachment(
         auto& textureMT = LLGL_CAST(MTTexture&, *texture);
         id<MTLTexture> tex = textureMT.GetNative();
 
+        if (textureMT.IsUntracked())
+            hasUntrackedAttachments_ = true;
+
         if (inAttachment.format != Format::Undefined)
         {
             /* Create texture view with format */
@@ -202,6 +213,9 @@ void MTRenderTarget::CreateAttachment(
         auto& textureMT = LLGL_CAST(MTTexture&, *inResolveAttachment->texture);
         id<MTLTexture> tex = textureMT.GetNative();
 
+        if (textureMT.IsUntracked())
+            hasUntrackedAttachments_ = true;
+
         if (inResolveAttachment->format != Format::Undefined)
         {
             /* Create texture view with format */
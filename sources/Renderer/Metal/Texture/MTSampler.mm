@@ -7,6 +7,7 @@
 
 #include "MTSampler.h"
 #include "../MTTypes.h"
+#include "../MTFeatureSet.h"
 #include "../../ResourceUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include <LLGL/Backend/Metal/NativeHandle.h>
@@ -77,6 +78,14 @@ id<MTLSamplerState> MTSampler::CreateNative(id<MTLDevice> device, const SamplerD
 {
     MTLSamplerDescriptor* samplerStateDesc = [[MTLSamplerDescriptor alloc] init];
     MTSampler::ConvertDesc(samplerStateDesc, desc);
+
+    /* Sampler states must be created with argument buffer support to be encoded into bindless resource heaps */
+    if (SupportsArgumentBuffersTier2(device))
+    {
+        if (@available(macOS 10.13, iOS 11.0, *))
+            samplerStateDesc.supportArgumentBuffers = YES;
+    }
+
     id<MTLSamplerState> samplerState = [device newSamplerStateWithDescriptor:samplerStateDesc];
     [samplerStateDesc release];
     return samplerState;
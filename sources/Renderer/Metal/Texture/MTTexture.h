@@ -10,6 +10,7 @@
 
 
 #import <Metal/Metal.h>
+#import <IOSurface/IOSurface.h>
 
 #include <LLGL/Texture.h>
 
@@ -23,6 +24,7 @@ struct MutableImageView;
 struct SubresourceCPUMappingLayout;
 struct FormatAttributes;
 class MTIntermediateBuffer;
+class MTPlacementHeap;
 
 class MTTexture final : public Texture
 {
@@ -34,8 +36,24 @@ class MTTexture final : public Texture
     public:
 
         MTTexture(id<MTLDevice> device, const TextureDescriptor& desc);
+
+        // Creates the texture at the specified offset within a placement heap. Such textures are in private storage and have no hazard tracking.
+        MTTexture(id<MTLDevice> device, const TextureDescriptor& desc, MTPlacementHeap& placementHeap, NSUInteger offset);
+
+        // Creates a 2D texture that is backed by the specified IOSurface, e.g. one that is shared with another device or process. The surface is retained by this texture.
+        MTTexture(id<MTLDevice> device, const TextureDescriptor& desc, IOSurfaceRef ioSurface);
+
         ~MTTexture();
 
+        // Returns the size and alignment of the specified texture if it was placed into a placement heap.
+        static MTLSizeAndAlign GetPlacedSizeAndAlign(id<MTLDevice> device, const TextureDescriptor& desc);
+
+        // Returns the IOSurface this texture is backed by if it was created with MiscFlags::Shared, or null otherwise.
+        inline IOSurfaceRef GetIOSurface() const
+        {
+            return ioSurface_;
+        }
+
         // Returns the region for the specified subresource.
         MTLRegion GetSubresourceRegion(NSUInteger mipLevel) const;
 
@@ -62,8 +80,23 @@ class MTTexture final : public Texture
             return native_;
         }
 
+        // Returns true if this texture was created with MiscFlags::Sparse and is allocated from a sparse heap.
+        inline bool IsSparse() const
+        {
+            return (sparseHeap_ != nil);
+        }
+
+        // Returns true if Metal does not track hazards of this texture, i.e. it was created with MiscFlags::Untracked or placed into a heap. Command encoders must be synchronized with fences.
+        inline bool IsUntracked() const
+        {
+            return isUntracked_;
+        }
+
     private:
 
+        // Creates the native texture from a sparse heap, whose tiles are mapped via MTCommandQueue::UpdateTileMappings.
+        void CreateSparseTexture(id<MTLDevice> device, MTLTextureDescriptor* texDesc);
+
         void ReadRegionFromSharedMemory(
             const MTLRegion&                    region,
             const TextureSubresource&           subresource,
@@ -84,7 +117,10 @@ class MTTexture final : public Texture
 
     private:
 
-        id<MTLTexture> native_ = nil;
+        id<MTLTexture>  native_         = nil;
+        id<MTLHeap>     sparseHeap_     = nil;
+        IOSurfaceRef    ioSurface_      = nullptr;
+        bool            isUntracked_    = false;
 
 };
 
@@ -6,11 +6,15 @@
  */
 
 #include "MTTexture.h"
+#include "MTPlacementHeap.h"
 #include "../MTTypes.h"
 #include "../MTDevice.h"
+#include "../MTFeatureSet.h"
 #include "../Buffer/MTIntermediateBuffer.h"
 #include "../../TextureUtils.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include "../../FormatTable.h"
 #include <LLGL/Backend/Metal/NativeHandle.h>
 #include <LLGL/TextureFlags.h>
 #include <LLGL/ImageFlags.h>
@@ -88,6 +92,60 @@ static void ConvertTextureDesc(id<MTLDevice> device, MTLTextureDescriptor* dst,
     dst.resourceOptions     = GetResourceOptions(src);
     if (IsMultiSampleTexture(src.type) || IsDepthOrStencilFormat(src.format))
         dst.storageMode = MTLStorageModePrivate;
+
+    /* Keep transient attachments in tile memory only */
+    if ((src.miscFlags & MiscFlags::Transient) != 0 && SupportsMemorylessTextures(device))
+    {
+        if (@available(iOS 10.0, macOS 11.0, *))
+            dst.storageMode = MTLStorageModeMemoryless;
+    }
+}
+
+// Disables hazard tracking for the specified texture descriptor and returns true on success.
+static bool DisableHazardTracking(MTLTextureDescriptor* texDesc)
+{
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        texDesc.hazardTrackingMode = MTLHazardTrackingModeUntracked;
+        return true;
+    }
+    return false;
+}
+
+// Creates a new IOSurface that can back a 2D texture with the specified descriptor, or returns null if the format has no uniform pixel size.
+static IOSurfaceRef CreateIOSurfaceForTexture(const TextureDescriptor& desc)
+{
+    const FormatAttributes& formatAttribs = FormatTable::GetAttribs(desc.format);
+    if (formatAttribs.bitSize == 0 || (formatAttribs.flags & FormatFlags::IsCompressed) != 0)
+        return nullptr;
+
+    const std::size_t bytesPerElement   = formatAttribs.bitSize / 8;
+    const std::size_t bytesPerRow       = IOSurfaceAlignProperty(kIOSurfaceBytesPerRow, desc.extent.width * bytesPerElement);
+
+    NSDictionary* properties =
+    @{
+        (NSString*)kIOSurfaceWidth              : @(desc.extent.width),
+        (NSString*)kIOSurfaceHeight             : @(desc.extent.height),
+        (NSString*)kIOSurfaceBytesPerElement    : @(bytesPerElement),
+        (NSString*)kIOSurfaceBytesPerRow        : @(bytesPerRow),
+        (NSString*)kIOSurfaceAllocSize          : @(bytesPerRow * desc.extent.height),
+    };
+    return IOSurfaceCreate((CFDictionaryRef)properties);
+}
+
+// Configures the specified texture descriptor for a texture that is backed by an IOSurface.
+static void ConvertIOSurfaceTextureDesc(MTLTextureDescriptor* texDesc)
+{
+    /* IOSurface textures are single 2D images that must be visible to the CPU */
+    texDesc.textureType         = MTLTextureType2D;
+    texDesc.mipmapLevelCount    = 1;
+    texDesc.arrayLength         = 1;
+    texDesc.sampleCount         = 1;
+    #ifdef LLGL_OS_MACOS
+    texDesc.storageMode         = MTLStorageModeManaged;
+    #else
+    texDesc.storageMode         = MTLStorageModeShared;
+    #endif
 }
 
 MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc) :
@@ -95,13 +153,57 @@ MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc) :
 {
     MTLTextureDescriptor* texDesc = [[MTLTextureDescriptor alloc] init];
     ConvertTextureDesc(device, texDesc, desc);
-    native_ = [device newTextureWithDescriptor:texDesc];
+    if ((desc.miscFlags & MiscFlags::Sparse) != 0)
+        CreateSparseTexture(device, texDesc);
+    else if ((desc.miscFlags & MiscFlags::Shared) != 0)
+    {
+        /* Back shared textures with an IOSurface, which can be passed to other devices and processes */
+        ioSurface_ = CreateIOSurfaceForTexture(desc);
+        LLGL_ASSERT(ioSurface_ != nullptr, "failed to create IOSurface for shared Metal texture");
+        ConvertIOSurfaceTextureDesc(texDesc);
+        native_ = [device newTextureWithDescriptor:texDesc iosurface:ioSurface_ plane:0];
+    }
+    else
+    {
+        if ((desc.miscFlags & MiscFlags::Untracked) != 0)
+            isUntracked_ = DisableHazardTracking(texDesc);
+        native_ = [device newTextureWithDescriptor:texDesc];
+    }
+    [texDesc release];
+}
+
+MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc, MTPlacementHeap& placementHeap, NSUInteger offset) :
+    Texture      { desc.type, desc.bindFlags },
+    isUntracked_ { true                      }
+{
+    MTLTextureDescriptor* texDesc = [[MTLTextureDescriptor alloc] init];
+    ConvertTextureDesc(device, texDesc, desc);
+    MTPlacementHeap::ConvertPlacedTextureDesc(texDesc);
+    if (@available(iOS 13.0, macOS 10.15, *))
+        native_ = [placementHeap.GetNative() newTextureWithDescriptor:texDesc offset:offset];
     [texDesc release];
+    LLGL_ASSERT(native_ != nil, "failed to place Metal texture at offset %zu into heap", static_cast<std::size_t>(offset));
+}
+
+MTTexture::MTTexture(id<MTLDevice> device, const TextureDescriptor& desc, IOSurfaceRef ioSurface) :
+    Texture    { desc.type, desc.bindFlags },
+    ioSurface_ { ioSurface                 }
+{
+    CFRetain(ioSurface_);
+    MTLTextureDescriptor* texDesc = [[MTLTextureDescriptor alloc] init];
+    ConvertTextureDesc(device, texDesc, desc);
+    ConvertIOSurfaceTextureDesc(texDesc);
+    native_ = [device newTextureWithDescriptor:texDesc iosurface:ioSurface_ plane:0];
+    [texDesc release];
+    LLGL_ASSERT(native_ != nil, "failed to create Metal texture from IOSurface");
 }
 
 MTTexture::~MTTexture()
 {
     [native_ release];
+    [sparseHeap_ release];
+    if (ioSurface_ != nullptr)
+        CFRelease(ioSurface_);
 }
 
 bool MTTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -165,7 +267,7 @@ TextureDescriptor MTTexture::GetDesc() const
 
     texDesc.type            = GetType();
     texDesc.bindFlags       = GetBindFlags();
-    texDesc.miscFlags       = 0;
+    texDesc.miscFlags       = (sparseHeap_ != nil ? MiscFlags::Sparse : 0);
     texDesc.mipLevels       = static_cast<std::uint32_t>([native_ mipmapLevelCount]);
     texDesc.format          = GetFormat();
     texDesc.extent.width    = static_cast<std::uint32_t>([native_ width]);
@@ -200,7 +302,7 @@ void MTTexture::WriteRegion(const TextureRegion& textureRegion, const ImageView&
 
     /* Get dimensions */
     const Format                        format          = MTTypes::ToFormat([native_ pixelFormat]);
-    const FormatAttributes&             formatAttribs   = GetFormatAttribs(format);
+    const FormatAttributes&             formatAttribs   = FormatTable::GetAttribs(format);
     const SubresourceCPUMappingLayout   layout          = CalcSubresourceCPUMappingLayout(format, textureRegion, srcImageView.format, srcImageView.dataType);
 
     if (srcImageView.dataSize < layout.imageSize)
@@ -252,7 +354,7 @@ void MTTexture::ReadRegion(
 
     /* Get dimensions */
     const Format                        format          = MTTypes::ToFormat([native_ pixelFormat]);
-    const FormatAttributes&             formatAttribs   = GetFormatAttribs(format);
+    const FormatAttributes&             formatAttribs   = FormatTable::GetAttribs(format);
     const SubresourceCPUMappingLayout   layout          = CalcSubresourceCPUMappingLayout(format, textureRegion, dstImageView.format, dstImageView.dataType);
 
     if (dstImageView.dataSize < layout.imageSize)
@@ -307,10 +409,58 @@ NSUInteger MTTexture::GetBytesPerRow(std::uint32_t rowExtent) const
 }
 
 
+MTLSizeAndAlign MTTexture::GetPlacedSizeAndAlign(id<MTLDevice> device, const TextureDescriptor& desc)
+{
+    MTLSizeAndAlign sizeAndAlign = { 0, 0 };
+    if (@available(iOS 13.0, macOS 10.15, *))
+    {
+        MTLTextureDescriptor* texDesc = [[MTLTextureDescriptor alloc] init];
+        ConvertTextureDesc(device, texDesc, desc);
+        MTPlacementHeap::ConvertPlacedTextureDesc(texDesc);
+        sizeAndAlign = [device heapTextureSizeAndAlignWithDescriptor:texDesc];
+        [texDesc release];
+    }
+    return sizeAndAlign;
+}
+
+
 /*
  * ======= Private: =======
  */
 
+void MTTexture::CreateSparseTexture(id<MTLDevice> device, MTLTextureDescriptor* texDesc)
+{
+    if (@available(iOS 13.0, macOS 11.0, *))
+    {
+        /* Sparse textures must be allocated from a sparse heap in private storage */
+        texDesc.storageMode     = MTLStorageModePrivate;
+        texDesc.resourceOptions = MTLResourceStorageModePrivate;
+
+        /*
+        Sparse heaps cannot grow, so the heap is sized for the entire texture.
+        Residency of individual tiles is still managed via MTLResourceStateCommandEncoder.
+        */
+        const MTLSizeAndAlign   sizeAndAlign    = [device heapTextureSizeAndAlignWithDescriptor:texDesc];
+        const NSUInteger        tileSize        = [device sparseTileSizeInBytes];
+
+        MTLHeapDescriptor* heapDesc = [[MTLHeapDescriptor alloc] init];
+        {
+            heapDesc.type           = MTLHeapTypeSparse;
+            heapDesc.storageMode    = MTLStorageModePrivate;
+            heapDesc.size           = (sizeAndAlign.size + tileSize - 1) / tileSize * tileSize;
+        }
+        sparseHeap_ = [device newHeapWithDescriptor:heapDesc];
+        [heapDesc release];
+
+        native_ = [sparseHeap_ newTextureWithDescriptor:texDesc];
+    }
+    else
+    {
+        /* Fall back to regular texture if sparse heaps are not available */
+        native_ = [device newTextureWithDescriptor:texDesc];
+    }
+}
+
 void MTTexture::ReadRegionFromSharedMemory(
     const MTLRegion&                    region,
     const TextureSubresource&           subresource,
@@ -44,6 +44,12 @@ class NullBuffer final : public Buffer
         void* Map(const CPUAccess access, std::uint64_t offset, std::uint64_t length);
         void Unmap();
 
+        // Returns a pointer to the internal buffer data, which stays valid for the lifetime of this buffer.
+        inline char* GetPersistentData()
+        {
+            return GetBytes();
+        }
+
     public:
 
         // Data type for the internal buffer data.
@@ -0,0 +1,59 @@
+/*
+ * NullTransientBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "NullTransientBufferPool.h"
+#include "NullBuffer.h"
+
+
+namespace LLGL
+{
+
+
+NullTransientBufferPool::NullTransientBufferPool(std::uint64_t chunkSize) :
+    TransientBufferPool { chunkSize, 1 }
+{
+}
+
+NullTransientBufferPool::~NullTransientBufferPool()
+{
+    ReleaseChunks();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool NullTransientBufferPool::CreateChunk(std::uint64_t size, Chunk& outChunk)
+{
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName    = "LLGL.TransientBuffer";
+        bufferDesc.size         = size;
+        bufferDesc.bindFlags    = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::ConstantBuffer);
+        bufferDesc.miscFlags    = MiscFlags::DynamicUsage;
+    }
+    auto* bufferNull = new NullBuffer{ bufferDesc, nullptr };
+
+    outChunk.buffer     = bufferNull;
+    outChunk.mappedData = bufferNull->GetPersistentData();
+    outChunk.size       = size;
+
+    return true;
+}
+
+void NullTransientBufferPool::ReleaseChunk(Chunk& chunk)
+{
+    delete chunk.buffer;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
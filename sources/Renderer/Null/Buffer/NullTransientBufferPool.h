@@ -0,0 +1,43 @@
+/*
+ * NullTransientBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_NULL_TRANSIENT_BUFFER_POOL_H
+#define LLGL_NULL_TRANSIENT_BUFFER_POOL_H
+
+
+#include "../../TransientBufferPool.h"
+
+
+namespace LLGL
+{
+
+
+// Transient buffer pool whose chunks are NullBuffer objects in host memory.
+class NullTransientBufferPool final : public TransientBufferPool
+{
+
+    public:
+
+        NullTransientBufferPool(std::uint64_t chunkSize);
+        ~NullTransientBufferPool();
+
+    private:
+
+        bool CreateChunk(std::uint64_t size, Chunk& outChunk) override;
+        void ReleaseChunk(Chunk& chunk) override;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -23,14 +23,21 @@
 
 #include <LLGL/RenderingDebugger.h>
 #include <LLGL/IndirectArguments.h>
+#include <algorithm>
 
 
 namespace LLGL
 {
 
 
-NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
-    desc { desc }
+// Increments the local counter of the specified command; see NullStatistics.
+#define LLGL_NULL_COUNT_COMMAND(NAME) \
+    ++counters_.commands[NullCommandStat##NAME]
+
+NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc, NullStatistics* statistics) :
+    desc                 { desc                    },
+    statistics_          { statistics              },
+    transientBufferPool_ { desc.minStagingPoolSize }
 {
 }
 
@@ -38,18 +45,31 @@ NullCommandBuffer::NullCommandBuffer(const CommandBufferDescriptor& desc) :
 
 void NullCommandBuffer::Begin()
 {
+    counters_ = NullCommandCounters{};
+    LLGL_NULL_COUNT_COMMAND(Begin);
+
     buffer_.Clear();
+
+    /* Commands are executed on the CPU during submission, so previous transient allocations are no longer in use */
+    transientBufferPool_.Reset();
 }
 
 void NullCommandBuffer::End()
 {
+    LLGL_NULL_COUNT_COMMAND(End);
+
+    /* Merge local counters into the shared statistics once per encoding */
+    if (statistics_ != nullptr)
+        statistics_->MergeCommandCounters(counters_, buffer_.Size());
+
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
         ExecuteVirtualCommands();
 }
 
 void NullCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
-    auto& secondaryCommandBufferNull = LLGL_CAST(NullCommandBuffer&, secondaryCommandBuffer);
+    LLGL_NULL_COUNT_COMMAND(Execute);
+    auto& secondaryCommandBufferNull = LLGL_HOT_CAST(NullCommandBuffer&, secondaryCommandBuffer);
     if ((secondaryCommandBufferNull.desc.flags & CommandBufferFlags::Secondary) != 0)
         secondaryCommandBufferNull.ExecuteVirtualCommands();
 }
@@ -62,7 +82,8 @@ void NullCommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
-    auto dstBufferNull = LLGL_CAST(NullBuffer*, &dstBuffer);
+    LLGL_NULL_COUNT_COMMAND(UpdateBuffer);
+    auto dstBufferNull = LLGL_HOT_CAST(NullBuffer*, &dstBuffer);
     auto cmd = AllocCommand<NullCmdBufferWrite>(NullOpcodeBufferWrite, dataSize);
     {
         cmd->buffer = dstBufferNull;
@@ -72,6 +93,12 @@ void NullCommandBuffer::UpdateBuffer(
     }
 }
 
+TransientBufferAllocation NullCommandBuffer::AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment)
+{
+    LLGL_NULL_COUNT_COMMAND(AllocTransientBuffer);
+    return transientBufferPool_.Alloc(size, bindFlags, alignment);
+}
+
 void NullCommandBuffer::CopyBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
@@ -79,6 +106,7 @@ void NullCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
+    LLGL_NULL_COUNT_COMMAND(CopyBuffer);
     auto cmd = AllocCommand<NullCmdCopySubresource>(NullOpcodeCopySubresource);
     {
         cmd->srcResource    = &srcBuffer;
@@ -122,7 +150,8 @@ void NullCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& srcTextureNull = LLGL_CAST(NullTexture&, srcTexture);
+    LLGL_NULL_COUNT_COMMAND(CopyBufferFromTexture);
+    auto& srcTextureNull = LLGL_HOT_CAST(NullTexture&, srcTexture);
     const auto extent = GetSubresourceExtent(srcTextureNull.GetType(), srcRegion.extent, srcRegion.subresource.numArrayLayers);
     auto cmd = AllocCommand<NullCmdCopySubresource>(NullOpcodeCopySubresource);
     {
@@ -150,7 +179,8 @@ void NullCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-    //auto& dstBufferNull = LLGL_CAST(NullBuffer&, dstBuffer);
+    LLGL_NULL_COUNT_COMMAND(FillBuffer);
+    //auto& dstBufferNull = LLGL_HOT_CAST(NullBuffer&, dstBuffer);
     //todo
 }
 
@@ -161,8 +191,9 @@ void NullCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    auto& dstTextureNull = LLGL_CAST(NullTexture&, dstTexture);
-    auto& srcTextureNull = LLGL_CAST(NullTexture&, srcTexture);
+    LLGL_NULL_COUNT_COMMAND(CopyTexture);
+    auto& dstTextureNull = LLGL_HOT_CAST(NullTexture&, dstTexture);
+    auto& srcTextureNull = LLGL_HOT_CAST(NullTexture&, srcTexture);
     auto cmd = AllocCommand<NullCmdCopySubresource>(NullOpcodeCopySubresource);
     {
         cmd->srcResource    = &srcTextureNull;
@@ -191,7 +222,8 @@ void NullCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstTextureNull = LLGL_CAST(NullTexture&, dstTexture);
+    LLGL_NULL_COUNT_COMMAND(CopyTextureFromBuffer);
+    auto& dstTextureNull = LLGL_HOT_CAST(NullTexture&, dstTexture);
     const auto extent = GetSubresourceExtent(dstTextureNull.GetType(), dstRegion.extent, dstRegion.subresource.numArrayLayers);
     auto cmd = AllocCommand<NullCmdCopySubresource>(NullOpcodeCopySubresource);
     {
@@ -218,12 +250,14 @@ void NullCommandBuffer::CopyTextureFromFramebuffer(
     const TextureRegion&    dstRegion,
     const Offset2D&         srcOffset)
 {
+    LLGL_NULL_COUNT_COMMAND(CopyTextureFromFramebuffer);
     //todo
 }
 
 void NullCommandBuffer::GenerateMips(Texture& texture)
 {
-    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    LLGL_NULL_COUNT_COMMAND(GenerateMips);
+    auto& textureNull = LLGL_HOT_CAST(NullTexture&, texture);
     auto cmd = AllocCommand<NullCmdGenerateMips>(NullOpcodeGenerateMips);
     {
         cmd->texture        = &textureNull;
@@ -236,7 +270,8 @@ void NullCommandBuffer::GenerateMips(Texture& texture)
 
 void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
-    auto& textureNull = LLGL_CAST(NullTexture&, texture);
+    LLGL_NULL_COUNT_COMMAND(GenerateMips);
+    auto& textureNull = LLGL_HOT_CAST(NullTexture&, texture);
     auto cmd = AllocCommand<NullCmdGenerateMips>(NullOpcodeGenerateMips);
     {
         cmd->texture        = &textureNull;
@@ -251,21 +286,25 @@ void NullCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource&
 
 void NullCommandBuffer::SetViewport(const Viewport& viewport)
 {
+    LLGL_NULL_COUNT_COMMAND(SetViewport);
     renderState_.viewports = { viewport };
 }
 
 void NullCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
 {
+    LLGL_NULL_COUNT_COMMAND(SetViewports);
     renderState_.viewports = SmallVector<Viewport>(viewports, viewports + numViewports);
 }
 
 void NullCommandBuffer::SetScissor(const Scissor& scissor)
 {
+    LLGL_NULL_COUNT_COMMAND(SetScissor);
     renderState_.scissors = { scissor };
 }
 
 void NullCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
 {
+    LLGL_NULL_COUNT_COMMAND(SetScissors);
     renderState_.scissors = SmallVector<Scissor>(scissors, scissors + numScissors);
 }
 
@@ -273,19 +312,22 @@ void NullCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* sc
 
 void NullCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
-    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    LLGL_NULL_COUNT_COMMAND(SetVertexBuffer);
+    auto& bufferNull = LLGL_HOT_CAST(NullBuffer&, buffer);
     renderState_.vertexBuffers = { &bufferNull };
 }
 
 void NullCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
-    auto& bufferArrayNull = LLGL_CAST(NullBufferArray&, bufferArray);
+    LLGL_NULL_COUNT_COMMAND(SetVertexBufferArray);
+    auto& bufferArrayNull = LLGL_HOT_CAST(NullBufferArray&, bufferArray);
     renderState_.vertexBuffers = SmallVector<const NullBuffer*>(bufferArrayNull.buffers.begin(), bufferArrayNull.buffers.end());
 }
 
 void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    LLGL_NULL_COUNT_COMMAND(SetIndexBuffer);
+    auto& bufferNull = LLGL_HOT_CAST(NullBuffer&, buffer);
     renderState_.indexBuffer        = &bufferNull;
     renderState_.indexBufferFormat  = bufferNull.desc.format;
     renderState_.indexBufferOffset  = 0;
@@ -293,7 +335,8 @@ void NullCommandBuffer::SetIndexBuffer(Buffer& buffer)
 
 void NullCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    LLGL_NULL_COUNT_COMMAND(SetIndexBuffer);
+    auto& bufferNull = LLGL_HOT_CAST(NullBuffer&, buffer);
     renderState_.indexBuffer        = &bufferNull;
     renderState_.indexBufferFormat  = format;
     renderState_.indexBufferOffset  = offset;
@@ -303,12 +346,20 @@ void NullCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std:
 
 void NullCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
-    //auto& resourceHeapNull = LLGL_CAST(NullResourceHeap&, resourceHeap);
+    LLGL_NULL_COUNT_COMMAND(SetResourceHeap);
+    //auto& resourceHeapNull = LLGL_HOT_CAST(NullResourceHeap&, resourceHeap);
     //todo
 }
 
 void NullCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
+    LLGL_NULL_COUNT_COMMAND(SetResource);
+    //todo
+}
+
+void NullCommandBuffer::SetConstantBufferRange(std::uint32_t /*descriptor*/, Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint64_t /*size*/)
+{
+    LLGL_NULL_COUNT_COMMAND(SetConstantBufferRange);
     //todo
 }
 
@@ -318,6 +369,7 @@ void NullCommandBuffer::ResourceBarrier(
     std::uint32_t       /*numTextures*/,
     Texture* const *    /*textures*/)
 {
+    LLGL_NULL_COUNT_COMMAND(ResourceBarrier);
     // dummy
 }
 
@@ -330,30 +382,34 @@ void NullCommandBuffer::BeginRenderPass(
     const ClearValue*   clearValues,
     std::uint32_t       /*swapBufferIndex*/)
 {
+    LLGL_NULL_COUNT_COMMAND(BeginRenderPass);
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
-        //auto& swapChainNull = LLGL_CAST(NullSwapChain&, renderTarget);
+        //auto& swapChainNull = LLGL_HOT_CAST(NullSwapChain&, renderTarget);
         //todo
     }
     else
     {
-        //auto& renderTargetNull = LLGL_CAST(NullRenderTarget&, renderTarget);
+        //auto& renderTargetNull = LLGL_HOT_CAST(NullRenderTarget&, renderTarget);
         //todo
     }
 }
 
 void NullCommandBuffer::EndRenderPass()
 {
+    LLGL_NULL_COUNT_COMMAND(EndRenderPass);
     //todo
 }
 
 void NullCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
+    LLGL_NULL_COUNT_COMMAND(Clear);
     //todo
 }
 
 void NullCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
+    LLGL_NULL_COUNT_COMMAND(ClearAttachments);
     //todo
 }
 
@@ -361,22 +417,32 @@ void NullCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Att
 
 void NullCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
-    //auto& pipelineStateNull = LLGL_CAST(NullPipelineState&, pipelineState);
+    LLGL_NULL_COUNT_COMMAND(SetPipelineState);
+    //auto& pipelineStateNull = LLGL_HOT_CAST(NullPipelineState&, pipelineState);
     //todo
 }
 
 void NullCommandBuffer::SetBlendFactor(const float color[4])
 {
+    LLGL_NULL_COUNT_COMMAND(SetBlendFactor);
     //todo
 }
 
 void NullCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace stencilFace)
 {
+    LLGL_NULL_COUNT_COMMAND(SetStencilReference);
     //todo
 }
 
+void NullCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    LLGL_NULL_COUNT_COMMAND(SetShadingRate);
+    // dummy
+}
+
 void NullCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
+    LLGL_NULL_COUNT_COMMAND(SetUniforms);
     //todo
 }
 
@@ -384,24 +450,35 @@ void NullCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::
 
 void NullCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    LLGL_NULL_COUNT_COMMAND(BeginQuery);
+    //auto& queryHeapNull = LLGL_HOT_CAST(NullQueryHeap&, queryHeap);
     //todo
 }
 
 void NullCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    LLGL_NULL_COUNT_COMMAND(EndQuery);
+    //auto& queryHeapNull = LLGL_HOT_CAST(NullQueryHeap&, queryHeap);
+    //todo
+}
+
+void NullCommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    LLGL_NULL_COUNT_COMMAND(ResolveQueryData);
+    //auto& queryHeapNull = LLGL_HOT_CAST(NullQueryHeap&, srcQueryHeap);
     //todo
 }
 
 void NullCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
-    //auto& queryHeapNull = LLGL_CAST(NullQueryHeap&, queryHeap);
+    LLGL_NULL_COUNT_COMMAND(BeginRenderCondition);
+    //auto& queryHeapNull = LLGL_HOT_CAST(NullQueryHeap&, queryHeap);
     //todo
 }
 
 void NullCommandBuffer::EndRenderCondition()
 {
+    LLGL_NULL_COUNT_COMMAND(EndRenderCondition);
     //todo
 }
 
@@ -409,11 +486,13 @@ void NullCommandBuffer::EndRenderCondition()
 
 void NullCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const * buffers)
 {
+    LLGL_NULL_COUNT_COMMAND(BeginStreamOutput);
     // dummy
 }
 
 void NullCommandBuffer::EndStreamOutput()
 {
+    LLGL_NULL_COUNT_COMMAND(EndStreamOutput);
     // dummy
 }
 
@@ -421,6 +500,7 @@ void NullCommandBuffer::EndStreamOutput()
 
 void NullCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
 {
+    LLGL_NULL_COUNT_COMMAND(Draw);
     DrawIndirectArguments drawArgs;
     {
         drawArgs.numVertices    = numVertices;
@@ -433,6 +513,7 @@ void NullCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVerte
 
 void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
 {
+    LLGL_NULL_COUNT_COMMAND(DrawIndexed);
     DrawIndexedIndirectArguments drawArgs;
     {
         drawArgs.numIndices     = numIndices;
@@ -446,6 +527,7 @@ void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firs
 
 void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    LLGL_NULL_COUNT_COMMAND(DrawIndexed);
     DrawIndexedIndirectArguments drawArgs;
     {
         drawArgs.numIndices     = numIndices;
@@ -459,6 +541,7 @@ void NullCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firs
 
 void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
 {
+    LLGL_NULL_COUNT_COMMAND(DrawInstanced);
     DrawIndirectArguments drawArgs;
     {
         drawArgs.numVertices    = numVertices;
@@ -471,6 +554,7 @@ void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t f
 
 void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
 {
+    LLGL_NULL_COUNT_COMMAND(DrawInstanced);
     DrawIndirectArguments drawArgs;
     {
         drawArgs.numVertices    = numVertices;
@@ -483,6 +567,7 @@ void NullCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t f
 
 void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
 {
+    LLGL_NULL_COUNT_COMMAND(DrawIndexedInstanced);
     DrawIndexedIndirectArguments drawArgs;
     {
         drawArgs.numIndices     = numIndices;
@@ -496,6 +581,7 @@ void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint
 
 void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
 {
+    LLGL_NULL_COUNT_COMMAND(DrawIndexedInstanced);
     DrawIndexedIndirectArguments drawArgs;
     {
         drawArgs.numIndices     = numIndices;
@@ -509,6 +595,7 @@ void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint
 
 void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
 {
+    LLGL_NULL_COUNT_COMMAND(DrawIndexedInstanced);
     DrawIndexedIndirectArguments drawArgs;
     {
         drawArgs.numIndices     = numIndices;
@@ -522,7 +609,8 @@ void NullCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint
 
 void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    LLGL_NULL_COUNT_COMMAND(DrawIndirect);
+    auto& bufferNull = LLGL_HOT_CAST(NullBuffer&, buffer);
     DrawIndirectArguments drawArgs;
     bufferNull.Read(offset, &drawArgs, sizeof(drawArgs));
     AllocDrawCommand(drawArgs);
@@ -530,7 +618,8 @@ void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 
 void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    LLGL_NULL_COUNT_COMMAND(DrawIndirect);
+    auto& bufferNull = LLGL_HOT_CAST(NullBuffer&, buffer);
     DrawIndirectArguments drawArgs;
     while (numCommands-- > 0)
     {
@@ -542,7 +631,8 @@ void NullCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::
 
 void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
-    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    LLGL_NULL_COUNT_COMMAND(DrawIndexedIndirect);
+    auto& bufferNull = LLGL_HOT_CAST(NullBuffer&, buffer);
     DrawIndexedIndirectArguments drawArgs;
     bufferNull.Read(offset, &drawArgs, sizeof(drawArgs));
     AllocDrawIndexedCommand(drawArgs);
@@ -550,7 +640,8 @@ void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset
 
 void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
-    auto& bufferNull = LLGL_CAST(NullBuffer&, buffer);
+    LLGL_NULL_COUNT_COMMAND(DrawIndexedIndirect);
+    auto& bufferNull = LLGL_HOT_CAST(NullBuffer&, buffer);
     DrawIndexedIndirectArguments drawArgs;
     while (numCommands-- > 0)
     {
@@ -560,8 +651,67 @@ void NullCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset
     }
 }
 
+void NullCommandBuffer::DrawIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_NULL_COUNT_COMMAND(DrawIndirectCount);
+    std::uint32_t numCommands = 0;
+    LLGL_HOT_CAST(NullBuffer&, countBuffer).Read(countOffset, &numCommands, sizeof(numCommands));
+    DrawIndirect(buffer, offset, std::min(numCommands, maxNumCommands), stride);
+}
+
+void NullCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_NULL_COUNT_COMMAND(DrawIndexedIndirectCount);
+    std::uint32_t numCommands = 0;
+    LLGL_HOT_CAST(NullBuffer&, countBuffer).Read(countOffset, &numCommands, sizeof(numCommands));
+    DrawIndexedIndirect(buffer, offset, std::min(numCommands, maxNumCommands), stride);
+}
+
 void NullCommandBuffer::DrawStreamOutput()
 {
+    LLGL_NULL_COUNT_COMMAND(DrawStreamOutput);
+    // dummy
+}
+
+void NullCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    LLGL_NULL_COUNT_COMMAND(DrawMeshTasks);
+    // dummy
+}
+
+void NullCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    LLGL_NULL_COUNT_COMMAND(DrawMeshTasksIndirect);
+    // dummy
+}
+
+void NullCommandBuffer::DispatchTiles()
+{
+    LLGL_NULL_COUNT_COMMAND(DispatchTiles);
+    // dummy
+}
+
+void NullCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    commandDesc,
+    Buffer&                             buffer,
+    std::uint64_t                       offset,
+    Buffer*                             countBuffer,
+    std::uint64_t                       countOffset,
+    std::uint32_t                       maxNumCommands)
+{
+    LLGL_NULL_COUNT_COMMAND(ExecuteIndirect);
     // dummy
 }
 
@@ -569,11 +719,31 @@ void NullCommandBuffer::DrawStreamOutput()
 
 void NullCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
 {
+    LLGL_NULL_COUNT_COMMAND(Dispatch);
     // dummy
 }
 
 void NullCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
+    LLGL_NULL_COUNT_COMMAND(DispatchIndirect);
+    // dummy
+}
+
+/* ----- Ray Tracing ----- */
+
+void NullCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 dstBuffer,
+    Buffer&                                 scratchBuffer,
+    const AccelerationStructureDescriptor&  desc,
+    Buffer*                                 srcBuffer)
+{
+    LLGL_NULL_COUNT_COMMAND(BuildAccelerationStructure);
+    // dummy
+}
+
+void NullCommandBuffer::DispatchRays(std::uint32_t width, std::uint32_t height, std::uint32_t depth)
+{
+    LLGL_NULL_COUNT_COMMAND(DispatchRays);
     // dummy
 }
 
@@ -581,6 +751,7 @@ void NullCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 
 void NullCommandBuffer::PushDebugGroup(const char* name)
 {
+    LLGL_NULL_COUNT_COMMAND(PushDebugGroup);
     const std::size_t length = ::strlen(name);
     auto cmd = AllocCommand<NullCmdPushDebugGroup>(NullOpcodePushDebugGroup, length + 1);
     {
@@ -590,6 +761,7 @@ void NullCommandBuffer::PushDebugGroup(const char* name)
 
 void NullCommandBuffer::PopDebugGroup()
 {
+    LLGL_NULL_COUNT_COMMAND(PopDebugGroup);
     AllocOpcode(NullOpcodePopDebugGroup);
 }
 
@@ -597,6 +769,7 @@ void NullCommandBuffer::PopDebugGroup()
 
 void NullCommandBuffer::DoNativeCommand(const void* nativeCommand, std::size_t nativeCommandSize)
 {
+    LLGL_NULL_COUNT_COMMAND(DoNativeCommand);
     // dummy
 }
 
@@ -612,6 +785,9 @@ bool NullCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHa
 
 void NullCommandBuffer::ExecuteVirtualCommands()
 {
+    if (statistics_ != nullptr)
+        statistics_->RecordExecution();
+
     ExecuteNullVirtualCommandBuffer(buffer_);
     if ((desc.flags & CommandBufferFlags::MultiSubmit) == 0)
         buffer_.Clear();
@@ -635,6 +811,9 @@ TCommand* NullCommandBuffer::AllocCommand(const NullOpcode opcode, std::size_t p
 
 void NullCommandBuffer::AllocDrawCommand(const DrawIndirectArguments& args)
 {
+    counters_.drawnVertices     += static_cast<std::uint64_t>(args.numVertices) * args.numInstances;
+    counters_.drawnInstances    += args.numInstances;
+
     auto cmd = AllocCommand<NullCmdDraw>(NullOpcodeDraw, sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
     {
         cmd->args               = args;
@@ -645,6 +824,9 @@ void NullCommandBuffer::AllocDrawCommand(const DrawIndirectArguments& args)
 
 void NullCommandBuffer::AllocDrawIndexedCommand(const DrawIndexedIndirectArguments& args)
 {
+    counters_.drawnVertices     += static_cast<std::uint64_t>(args.numIndices) * args.numInstances;
+    counters_.drawnInstances    += args.numInstances;
+
     auto cmd = AllocCommand<NullCmdDrawIndexed>(NullOpcodeDrawIndexed, sizeof(const NullBuffer*) * renderState_.vertexBuffers.size());
     {
         cmd->args               = args;
@@ -657,6 +839,9 @@ void NullCommandBuffer::AllocDrawIndexedCommand(const DrawIndexedIndirectArgumen
 }
 
 
+#undef LLGL_NULL_COUNT_COMMAND
+
+
 } // /namespace LLGL
 
 
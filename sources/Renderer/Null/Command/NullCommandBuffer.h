@@ -12,6 +12,8 @@
 #include <LLGL/CommandBuffer.h>
 #include <LLGL/Container/SmallVector.h>
 #include "NullCommandOpcode.h"
+#include "../Buffer/NullTransientBufferPool.h"
+#include "../NullStatistics.h"
 #include "../../VirtualCommandBuffer.h"
 
 
@@ -32,7 +34,13 @@ class NullCommandBuffer final : public CommandBuffer
 
     public:
 
-        NullCommandBuffer(const CommandBufferDescriptor& desc);
+        TransientBufferAllocation AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment) override;
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+    public:
+
+        NullCommandBuffer(const CommandBufferDescriptor& desc, NullStatistics* statistics = nullptr);
 
     public:
 
@@ -71,6 +79,9 @@ class NullCommandBuffer final : public CommandBuffer
 
         NullVirtualCommandBuffer    buffer_;
         RenderState                 renderState_;
+        NullStatistics*             statistics_     = nullptr;
+        NullCommandCounters         counters_;
+        NullTransientBufferPool     transientBufferPool_;
 
 };
 
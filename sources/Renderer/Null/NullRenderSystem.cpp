@@ -6,6 +6,7 @@
  */
 
 #include "NullRenderSystem.h"
+#include "../RenderSystemUtils.h"
 #include "../../Core/CoreUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <limits.h>
@@ -30,7 +31,7 @@ static void InitNullRendererShadingLanguages(std::vector<ShadingLanguage>& shadi
 static void InitNullRendererTextureFormats(std::vector<Format>& textureFormats)
 {
     constexpr int firstFormatIndex  = static_cast<int>(Format::A8UNorm);
-    constexpr int lastFormatIndex   = static_cast<int>(Format::BC5SNorm);
+    constexpr int lastFormatIndex   = static_cast<int>(Format::BC7UNorm_sRGB);
     constexpr int numFormats        = lastFormatIndex - firstFormatIndex + 1;
     textureFormats.reserve(static_cast<std::size_t>(numFormats));
     for_range(i, numFormats)
@@ -64,6 +65,16 @@ static void InitNullRendererFeatures(RenderingFeatures& features)
     features.hasLogicOp                     = true;
     features.hasPipelineStatistics          = true;
     features.hasRenderCondition             = true;
+    features.hasTimestampQueries            = true;
+    features.hasQueryResolve                = true;
+    features.hasTransientBuffers            = true;
+    features.hasPersistentMapping           = true;
+    features.hasSparseTextures              = true;
+    features.hasPlacementHeaps              = false;
+    features.hasSharedResources             = false;
+    features.hasConcurrentResourceCreation  = false;
+    features.hasRayTracing                  = false;
+    features.hasRayQuery                    = false;
 }
 
 static void InitNullRendererLimits(RenderingLimits& limits)
@@ -82,6 +93,7 @@ static void InitNullRendererLimits(RenderingLimits& limits)
     limits.maxComputeShaderWorkGroupSize[0] = 0;
     limits.maxComputeShaderWorkGroupSize[1] = 0;
     limits.maxComputeShaderWorkGroupSize[2] = 0;
+    limits.maxComputeShaderSharedMemorySize = 0;
     limits.maxViewports                     = LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS;
     limits.maxViewportSize[0]               = UINT32_MAX;
     limits.maxViewportSize[1]               = UINT32_MAX;
@@ -96,6 +108,7 @@ static void InitNullRendererLimits(RenderingLimits& limits)
     limits.maxDepthBufferSamples            = 1;
     limits.maxStencilBufferSamples          = 1;
     limits.maxNoAttachmentSamples           = 1;
+    limits.sparseTileSize                   = 65536;
 }
 
 static void GetNullRenderingCaps(RenderingCapabilities& caps)
@@ -114,10 +127,28 @@ static void GetNullRendererInfo(RendererInfo& info)
     info.shadingLanguageName    = "Dummy";
 }
 
+static std::uint64_t GetNullTextureFootprint(const TextureDescriptor& textureDesc)
+{
+    const TextureSubresource subresource{ 0, textureDesc.arrayLayers, 0, NumMipLevels(textureDesc) };
+    return GetMemoryFootprint(textureDesc.type, textureDesc.format, textureDesc.extent, subresource);
+}
+
 NullRenderSystem::NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     desc_         { renderSystemDesc               },
     commandQueue_ { MakeUnique<NullCommandQueue>() }
 {
+    if (auto* rendererConfigNull = GetRendererConfiguration<RendererConfigurationNull>(renderSystemDesc))
+    {
+        if (rendererConfigNull->statisticsReportFilename != nullptr)
+            statistics_ = MakeUnique<NullStatistics>(rendererConfigNull->statisticsReportFilename);
+    }
+}
+
+NullRenderSystem::~NullRenderSystem()
+{
+    /* Resources that are still alive at this point are reported as well, which helps to identify leaks */
+    if (statistics_)
+        statistics_->SaveReport();
 }
 
 /* ----- Swap-chain ----- */
@@ -143,11 +174,15 @@ CommandQueue* NullRenderSystem::GetCommandQueue()
 
 CommandBuffer* NullRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<NullCommandBuffer>(commandBufferDesc);
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatCommandBuffers);
+    return commandBuffers_.emplace<NullCommandBuffer>(commandBufferDesc, statistics_.get());
 }
 
 void NullRenderSystem::Release(CommandBuffer& commandBuffer)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatCommandBuffers);
     commandBuffers_.erase(&commandBuffer);
 }
 
@@ -156,9 +191,17 @@ void NullRenderSystem::Release(CommandBuffer& commandBuffer)
 Buffer* NullRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
     RenderSystem::AssertCreateBuffer(bufferDesc, GetRenderingCaps().limits.maxBufferSize);
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatBuffers, bufferDesc.size);
     return buffers_.emplace<NullBuffer>(bufferDesc, initialData);
 }
 
+void NullRenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    for_range(i, bufferDescs.size())
+        outBuffers[i] = CreateBuffer(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr));
+}
+
 BufferArray* NullRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     RenderSystem::AssertCreateBufferArray(numBuffers, bufferArray);
@@ -167,9 +210,17 @@ BufferArray* NullRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffe
 
 void NullRenderSystem::Release(Buffer& buffer)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatBuffers, LLGL_CAST(NullBuffer&, buffer).desc.size);
     buffers_.erase(&buffer);
 }
 
+void NullRenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    for (Buffer* buffer : buffers)
+        Release(*buffer);
+}
+
 void NullRenderSystem::Release(BufferArray& bufferArray)
 {
     bufferArrays_.erase(&bufferArray);
@@ -209,14 +260,30 @@ void NullRenderSystem::UnmapBuffer(Buffer& buffer)
 
 Texture* NullRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatTextures, GetNullTextureFootprint(textureDesc));
     return textures_.emplace<NullTexture>(textureDesc, initialImage);
 }
 
+void NullRenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    for_range(i, textureDescs.size())
+        outTextures[i] = CreateTexture(textureDescs[i], (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr));
+}
+
 void NullRenderSystem::Release(Texture& texture)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatTextures, GetNullTextureFootprint(LLGL_CAST(NullTexture&, texture).desc));
     textures_.erase(&texture);
 }
 
+void NullRenderSystem::Release(const ArrayView<Texture*>& textures)
+{
+    for (Texture* texture : textures)
+        Release(*texture);
+}
+
 void NullRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageDesc)
 {
     auto& textureNull = LLGL_CAST(NullTexture&, texture);
@@ -233,11 +300,15 @@ void NullRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textur
 
 Sampler* NullRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatSamplers);
     return samplers_.emplace<NullSampler>(samplerDesc);
 }
 
 void NullRenderSystem::Release(Sampler& sampler)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatSamplers);
     samplers_.erase(&sampler);
 }
 
@@ -245,11 +316,16 @@ void NullRenderSystem::Release(Sampler& sampler)
 
 ResourceHeap* NullRenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
 {
-    return resourceHeaps_.emplace<NullResourceHeap>(resourceHeapDesc, initialResourceViews);
+    auto* resourceHeapNull = resourceHeaps_.emplace<NullResourceHeap>(resourceHeapDesc, initialResourceViews);
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatResourceHeaps, resourceHeapNull->GetNumDescriptors());
+    return resourceHeapNull;
 }
 
 void NullRenderSystem::Release(ResourceHeap& resourceHeap)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatResourceHeaps, LLGL_CAST(NullResourceHeap&, resourceHeap).GetNumDescriptors());
     resourceHeaps_.erase(&resourceHeap);
 }
 
@@ -275,11 +351,15 @@ void NullRenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* NullRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
 {
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatRenderTargets);
     return renderTargets_.emplace<NullRenderTarget>(renderTargetDesc);
 }
 
 void NullRenderSystem::Release(RenderTarget& renderTarget)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatRenderTargets);
     renderTargets_.erase(&renderTarget);
 }
 
@@ -287,11 +367,21 @@ void NullRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* NullRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatShaders);
     return shaders_.emplace<NullShader>(shaderDesc);
 }
 
+void NullRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    for_range(i, shaderDescs.size())
+        outShaders[i] = CreateShader(shaderDescs[i]);
+}
+
 void NullRenderSystem::Release(Shader& shader)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatShaders);
     shaders_.erase(&shader);
 }
 
@@ -323,16 +413,40 @@ void NullRenderSystem::Release(PipelineCache& pipelineCache)
 
 PipelineState* NullRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatPipelineStates);
     return pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc);
 }
 
 PipelineState* NullRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
 {
+    if (statistics_)
+        statistics_->AddResource(NullResourceStatPipelineStates);
     return pipelineStates_.emplace<NullPipelineState>(pipelineStateDesc);
 }
 
+void NullRenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+void NullRenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+PipelineState* NullRenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& /*pipelineStateDesc*/, PipelineCache* /*pipelineCache*/)
+{
+    /* The Null renderer does not report ray tracing support */
+    return nullptr;
+}
+
 void NullRenderSystem::Release(PipelineState& pipelineState)
 {
+    if (statistics_)
+        statistics_->RemoveResource(NullResourceStatPipelineStates);
     pipelineStates_.erase(&pipelineState);
 }
 
@@ -381,6 +495,23 @@ bool NullRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapa
     return true;
 }
 
+std::uint32_t NullRenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* /*outHeapInfos*/, std::uint32_t /*maxHeapInfos*/)
+{
+    return 0; // dummy
+}
+
+std::uint32_t NullRenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    /* Report a single adapter that represents the CPU */
+    if (outAdapters != nullptr && maxAdapters > 0)
+    {
+        outAdapters[0]          = AdapterInfo{};
+        outAdapters[0].name     = "CPU";
+        outAdapters[0].isActive = true;
+    }
+    return 1;
+}
+
 
 } // /namespace LLGL
 
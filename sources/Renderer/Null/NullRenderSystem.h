@@ -25,9 +25,11 @@
 #include "Texture/NullTexture.h"
 #include "Texture/NullRenderTarget.h"
 #include "Texture/NullSampler.h"
+#include "NullStatistics.h"
 #include "../ProxyPipelineCache.h"
 
 #include "../ContainerTypes.h"
+#include <memory>
 
 
 namespace LLGL
@@ -44,6 +46,7 @@ class NullRenderSystem final : public RenderSystem
     public:
 
         NullRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
+        ~NullRenderSystem();
 
     private:
 
@@ -54,6 +57,7 @@ class NullRenderSystem final : public RenderSystem
         /* ----- Common objects ----- */
 
         const RenderSystemDescriptor            desc_;
+        std::unique_ptr<NullStatistics>         statistics_;
 
         /* ----- Hardware object containers ----- */
 
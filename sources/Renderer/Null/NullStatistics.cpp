@@ -0,0 +1,249 @@
+/*
+ * NullStatistics.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "NullStatistics.h"
+#include "../../Core/Assertion.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <stdio.h>
+
+
+namespace LLGL
+{
+
+
+static const char* const g_nullCommandStatNames[] =
+{
+    "Begin",
+    "End",
+    "Execute",
+    "UpdateBuffer",
+    "AllocTransientBuffer",
+    "CopyBuffer",
+    "CopyBufferFromTexture",
+    "FillBuffer",
+    "CopyTexture",
+    "CopyTextureFromBuffer",
+    "CopyTextureFromFramebuffer",
+    "GenerateMips",
+    "SetViewport",
+    "SetViewports",
+    "SetScissor",
+    "SetScissors",
+    "SetVertexBuffer",
+    "SetVertexBufferArray",
+    "SetIndexBuffer",
+    "SetResourceHeap",
+    "SetResource",
+    "SetConstantBufferRange",
+    "ResourceBarrier",
+    "BeginRenderPass",
+    "EndRenderPass",
+    "Clear",
+    "ClearAttachments",
+    "SetPipelineState",
+    "SetBlendFactor",
+    "SetStencilReference",
+    "SetShadingRate",
+    "SetUniforms",
+    "BeginQuery",
+    "EndQuery",
+    "ResolveQueryData",
+    "BeginRenderCondition",
+    "EndRenderCondition",
+    "BeginStreamOutput",
+    "EndStreamOutput",
+    "Draw",
+    "DrawIndexed",
+    "DrawInstanced",
+    "DrawIndexedInstanced",
+    "DrawIndirect",
+    "DrawIndexedIndirect",
+    "DrawIndirectCount",
+    "DrawIndexedIndirectCount",
+    "DrawStreamOutput",
+    "DrawMeshTasks",
+    "DrawMeshTasksIndirect",
+    "DispatchTiles",
+    "ExecuteIndirect",
+    "Dispatch",
+    "DispatchIndirect",
+    "BuildAccelerationStructure",
+    "DispatchRays",
+    "PushDebugGroup",
+    "PopDebugGroup",
+    "DoNativeCommand",
+};
+
+static_assert(sizeof(g_nullCommandStatNames)/sizeof(g_nullCommandStatNames[0]) == NullCommandStatCount, "names of Null renderer command statistics out of sync");
+
+struct NullResourceStatName
+{
+    const char* name;
+    const char* sizeName; // Null if the resource type has no size
+};
+
+static const NullResourceStatName g_nullResourceStatNames[] =
+{
+    { "buffers",        "bytes"         },
+    { "textures",       "bytes"         },
+    { "resourceHeaps",  "descriptors"   },
+    { "samplers",       nullptr         },
+    { "shaders",        nullptr         },
+    { "pipelineStates", nullptr         },
+    { "renderTargets",  nullptr         },
+    { "commandBuffers", nullptr         },
+};
+
+static_assert(sizeof(g_nullResourceStatNames)/sizeof(g_nullResourceStatNames[0]) == NullResourceStatCount, "names of Null renderer resource statistics out of sync");
+
+NullStatistics::NullStatistics(const char* reportFilename) :
+    reportFilename_ { reportFilename != nullptr ? reportFilename : "" }
+{
+}
+
+void NullStatistics::MergeCommandCounters(const NullCommandCounters& counters, std::uint64_t encodedBytes)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for_range(i, NullCommandStatCount)
+        commandCounters_.commands[i] += counters.commands[i];
+    commandCounters_.drawnVertices  += counters.drawnVertices;
+    commandCounters_.drawnInstances += counters.drawnInstances;
+    encodedBytes_ += encodedBytes;
+    ++encodings_;
+}
+
+void NullStatistics::RecordExecution()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    ++executions_;
+}
+
+void NullStatistics::AddResource(NullResourceStat type, std::uint64_t size)
+{
+    LLGL_ASSERT(type < NullResourceStatCount);
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    ResourceCounters& counters = resourceCounters_[type];
+    counters.count      += 1;
+    counters.created    += 1;
+    counters.size       += size;
+    counters.peakCount  = std::max(counters.peakCount, counters.count);
+    counters.peakSize   = std::max(counters.peakSize, counters.size);
+}
+
+void NullStatistics::RemoveResource(NullResourceStat type, std::uint64_t size)
+{
+    LLGL_ASSERT(type < NullResourceStatCount);
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    ResourceCounters& counters = resourceCounters_[type];
+    LLGL_ASSERT(counters.count > 0 && counters.size >= size);
+    counters.count  -= 1;
+    counters.size   -= size;
+}
+
+// Appends a JSON key-value pair with an unsigned integer value.
+static void AppendJsonValue(std::string& s, const char* indent, const char* key, std::uint64_t value, bool last = false)
+{
+    s += indent;
+    s += '\"';
+    s += key;
+    s += "\": ";
+    s += std::to_string(value);
+    s += (last ? "\n" : ",\n");
+}
+
+std::string NullStatistics::WriteReport() const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    std::string s;
+    s += "{\n";
+
+    /* Write command buffer statistics */
+    s += "  \"commandBuffers\": {\n";
+    {
+        AppendJsonValue(s, "    ", "encodings",     encodings_);
+        AppendJsonValue(s, "    ", "executions",    executions_);
+        AppendJsonValue(s, "    ", "encodedBytes",  encodedBytes_, true);
+    }
+    s += "  },\n";
+
+    /* Write all commands that have been encoded at least once in the order of their declaration */
+    s += "  \"commands\": {\n";
+    {
+        std::size_t numCommands = 0;
+        for_range(i, NullCommandStatCount)
+        {
+            if (commandCounters_.commands[i] > 0)
+                ++numCommands;
+        }
+        for_range(i, NullCommandStatCount)
+        {
+            if (commandCounters_.commands[i] > 0)
+                AppendJsonValue(s, "    ", g_nullCommandStatNames[i], commandCounters_.commands[i], --numCommands == 0);
+        }
+    }
+    s += "  },\n";
+
+    s += "  \"draws\": {\n";
+    {
+        AppendJsonValue(s, "    ", "vertices",  commandCounters_.drawnVertices);
+        AppendJsonValue(s, "    ", "instances", commandCounters_.drawnInstances, true);
+    }
+    s += "  },\n";
+
+    /* Write simulated memory footprint */
+    s += "  \"resources\": {\n";
+    for_range(i, NullResourceStatCount)
+    {
+        const NullResourceStatName& statName = g_nullResourceStatNames[i];
+        const ResourceCounters&     counters = resourceCounters_[i];
+
+        s += "    \"";
+        s += statName.name;
+        s += "\": {\n";
+        {
+            AppendJsonValue(s, "      ", "created",     counters.created);
+            AppendJsonValue(s, "      ", "count",       counters.count);
+            AppendJsonValue(s, "      ", "peakCount",   counters.peakCount, statName.sizeName == nullptr);
+            if (statName.sizeName != nullptr)
+            {
+                const std::string peakSizeName = std::string("peak") + static_cast<char>(::toupper(statName.sizeName[0])) + (statName.sizeName + 1);
+                AppendJsonValue(s, "      ", statName.sizeName,     counters.size);
+                AppendJsonValue(s, "      ", peakSizeName.c_str(),  counters.peakSize, true);
+            }
+        }
+        s += (i + 1 < NullResourceStatCount ? "    },\n" : "    }\n");
+    }
+    s += "  }\n";
+
+    s += "}\n";
+    return s;
+}
+
+bool NullStatistics::SaveReport() const
+{
+    if (reportFilename_.empty())
+        return false;
+
+    const std::string report = WriteReport();
+
+    FILE* file = ::fopen(reportFilename_.c_str(), "wb");
+    if (file == nullptr)
+        return false;
+
+    const bool succeeded = (::fwrite(report.data(), 1, report.size(), file) == report.size());
+    ::fclose(file);
+    return succeeded;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,169 @@
+/*
+ * NullStatistics.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_NULL_STATISTICS_H
+#define LLGL_NULL_STATISTICS_H
+
+
+#include <mutex>
+#include <string>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Command buffer functions that are counted by the Null renderer. Overloads of the same function share one counter.
+enum NullCommandStat : std::uint32_t
+{
+    NullCommandStatBegin = 0,
+    NullCommandStatEnd,
+    NullCommandStatExecute,
+    NullCommandStatUpdateBuffer,
+    NullCommandStatAllocTransientBuffer,
+    NullCommandStatCopyBuffer,
+    NullCommandStatCopyBufferFromTexture,
+    NullCommandStatFillBuffer,
+    NullCommandStatCopyTexture,
+    NullCommandStatCopyTextureFromBuffer,
+    NullCommandStatCopyTextureFromFramebuffer,
+    NullCommandStatGenerateMips,
+    NullCommandStatSetViewport,
+    NullCommandStatSetViewports,
+    NullCommandStatSetScissor,
+    NullCommandStatSetScissors,
+    NullCommandStatSetVertexBuffer,
+    NullCommandStatSetVertexBufferArray,
+    NullCommandStatSetIndexBuffer,
+    NullCommandStatSetResourceHeap,
+    NullCommandStatSetResource,
+    NullCommandStatSetConstantBufferRange,
+    NullCommandStatResourceBarrier,
+    NullCommandStatBeginRenderPass,
+    NullCommandStatEndRenderPass,
+    NullCommandStatClear,
+    NullCommandStatClearAttachments,
+    NullCommandStatSetPipelineState,
+    NullCommandStatSetBlendFactor,
+    NullCommandStatSetStencilReference,
+    NullCommandStatSetShadingRate,
+    NullCommandStatSetUniforms,
+    NullCommandStatBeginQuery,
+    NullCommandStatEndQuery,
+    NullCommandStatResolveQueryData,
+    NullCommandStatBeginRenderCondition,
+    NullCommandStatEndRenderCondition,
+    NullCommandStatBeginStreamOutput,
+    NullCommandStatEndStreamOutput,
+    NullCommandStatDraw,
+    NullCommandStatDrawIndexed,
+    NullCommandStatDrawInstanced,
+    NullCommandStatDrawIndexedInstanced,
+    NullCommandStatDrawIndirect,
+    NullCommandStatDrawIndexedIndirect,
+    NullCommandStatDrawIndirectCount,
+    NullCommandStatDrawIndexedIndirectCount,
+    NullCommandStatDrawStreamOutput,
+    NullCommandStatDrawMeshTasks,
+    NullCommandStatDrawMeshTasksIndirect,
+    NullCommandStatDispatchTiles,
+    NullCommandStatExecuteIndirect,
+    NullCommandStatDispatch,
+    NullCommandStatDispatchIndirect,
+    NullCommandStatBuildAccelerationStructure,
+    NullCommandStatDispatchRays,
+    NullCommandStatPushDebugGroup,
+    NullCommandStatPopDebugGroup,
+    NullCommandStatDoNativeCommand,
+
+    NullCommandStatCount,
+};
+
+// Resource types whose simulated memory footprint is tracked by the Null renderer.
+enum NullResourceStat : std::uint32_t
+{
+    NullResourceStatBuffers = 0,    // Size in bytes
+    NullResourceStatTextures,       // Size in bytes
+    NullResourceStatResourceHeaps,  // Size in descriptors
+    NullResourceStatSamplers,
+    NullResourceStatShaders,
+    NullResourceStatPipelineStates,
+    NullResourceStatRenderTargets,
+    NullResourceStatCommandBuffers,
+
+    NullResourceStatCount,
+};
+
+// Counters each command buffer records locally while it is encoded, so encoding on multiple threads does not contend on the shared statistics.
+struct NullCommandCounters
+{
+    std::uint64_t commands[NullCommandStatCount]    = {};
+    std::uint64_t drawnVertices                     = 0;
+    std::uint64_t drawnInstances                    = 0;
+};
+
+// Accumulates the statistics of the Null renderer and writes them as a deterministic JSON report; see RendererConfigurationNull.
+class NullStatistics
+{
+
+    public:
+
+        NullStatistics(const char* reportFilename);
+
+        // Adds the counters of an encoded command buffer and the size (in bytes) of its virtual command stream.
+        void MergeCommandCounters(const NullCommandCounters& counters, std::uint64_t encodedBytes);
+
+        // Records that a command buffer has been executed, i.e. submitted to the command queue.
+        void RecordExecution();
+
+        // Records the creation of a resource with the specified size. The unit of the size depends on the resource type; see NullResourceStat.
+        void AddResource(NullResourceStat type, std::uint64_t size = 0);
+
+        // Records the release of a resource with the specified size. This must match the size that was passed to AddResource.
+        void RemoveResource(NullResourceStat type, std::uint64_t size = 0);
+
+        // Returns the report in JSON format. Only counters and sizes are reported, so the report is deterministic.
+        std::string WriteReport() const;
+
+        // Writes the report to the file that was specified when these statistics were created.
+        bool SaveReport() const;
+
+    private:
+
+        struct ResourceCounters
+        {
+            std::uint64_t count     = 0;
+            std::uint64_t peakCount = 0;
+            std::uint64_t created   = 0;
+            std::uint64_t size      = 0;
+            std::uint64_t peakSize  = 0;
+        };
+
+    private:
+
+        mutable std::mutex  mutex_;
+        std::string         reportFilename_;
+
+        NullCommandCounters commandCounters_;
+        std::uint64_t       encodings_      = 0;
+        std::uint64_t       executions_     = 0;
+        std::uint64_t       encodedBytes_   = 0;
+
+        ResourceCounters    resourceCounters_[NullResourceStatCount];
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
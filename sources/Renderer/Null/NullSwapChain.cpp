@@ -70,7 +70,8 @@ bool NullSwapChain::IsPresentable() const
 
 void NullSwapChain::Present()
 {
-    // dummy
+    BeginFrameStatisticsStall();
+    EndFrameStatisticsStall(true);
 }
 
 std::uint32_t NullSwapChain::GetCurrentSwapIndex() const
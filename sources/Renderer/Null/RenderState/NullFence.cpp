@@ -22,6 +22,12 @@ void NullFence::SetDebugName(const char* name)
         label_.clear();
 }
 
+bool NullFence::IsSignaled()
+{
+    /* Null renderer does not execute any GPU work, so fences are always signaled */
+    return true;
+}
+
 void NullFence::Signal(std::uint64_t signal)
 {
     signal_ = signal;
@@ -26,6 +26,8 @@ class NullFence final : public Fence
 
         void SetDebugName(const char* name) override;
 
+        bool IsSignaled() override;
+
     public:
 
         NullFence(std::uint64_t initialSignal = 0);
@@ -35,6 +35,12 @@ class NullResourceHeap final : public ResourceHeap
 
         std::uint32_t WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
 
+        // Returns the total number of descriptors in this heap, i.e. the number of descriptor sets times the number of bindings.
+        inline std::uint32_t GetNumDescriptors() const
+        {
+            return static_cast<std::uint32_t>(resourceViews_.size());
+        }
+
     private:
 
         std::string                         label_;
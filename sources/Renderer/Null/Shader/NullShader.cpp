@@ -13,7 +13,7 @@ namespace LLGL
 
 
 NullShader::NullShader(const ShaderDescriptor& desc) :
-    Shader { desc.type },
+    Shader { desc      },
     desc   { desc      }
 {
     if (desc.debugName != nullptr)
@@ -35,6 +35,9 @@ const Report* NullShader::GetReport() const
 
 bool NullShader::Reflect(ShaderReflection& reflection) const
 {
+    if (GetSerializedReflection(reflection))
+        return true;
+
     switch (GetType())
     {
         case ShaderType::Vertex:
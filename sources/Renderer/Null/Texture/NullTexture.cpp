@@ -7,6 +7,7 @@
 
 #include "NullTexture.h"
 #include "../../TextureUtils.h"
+#include "../../FormatTable.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
@@ -126,7 +127,7 @@ void NullTexture::UnpackSubresourceIndex(std::uint32_t subresource, std::uint32_
 
 void NullTexture::AllocImages()
 {
-    const auto& formatAttribs = GetFormatAttribs(desc.format);
+    const auto& formatAttribs = FormatTable::GetAttribs(desc.format);
     images_.reserve(desc.mipLevels);
     for_range(mipLevel, desc.mipLevels)
     {
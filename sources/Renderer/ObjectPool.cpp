@@ -0,0 +1,243 @@
+/*
+ * ObjectPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ObjectPool.h"
+#include "../Core/CoreUtils.h"
+#include "../Core/Assertion.h"
+#include "../Core/Exception.h"
+#include <algorithm>
+#include <new>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal structures
+ */
+
+// Alignment of all slabs and memory blocks. Each block is preceded by a header of this size that refers to its slab.
+static constexpr std::size_t g_blockAlignment   = alignof(std::max_align_t);
+static constexpr std::size_t g_blockHeaderSize  = g_blockAlignment;
+static constexpr std::size_t g_slabSizeHint     = 64u * 1024u;
+
+struct ObjectPool::Slab
+{
+    SlabList*           owner           = nullptr;
+    Slab*               prev            = nullptr;  // Previous slab in the list of partial slabs.
+    Slab*               next            = nullptr;  // Next slab in the list of partial slabs.
+    char*               freeBlocks      = nullptr;  // Linked list of free blocks; The header of each free block points to the next free block.
+    std::uint32_t       numFreeBlocks   = 0;
+    std::size_t         size            = 0;        // Size (in bytes) of this slab including this header.
+    AllocatorDescriptor allocator;                  // Allocator this slab was allocated with.
+};
+
+static constexpr std::size_t g_slabHeaderSize = ((sizeof(ObjectPool::Slab) + g_blockAlignment - 1) / g_blockAlignment) * g_blockAlignment;
+
+struct ObjectPool::SlabList
+{
+    std::mutex      mutex;
+    std::size_t     blockStride         = 0;
+    std::uint32_t   numBlocksPerSlab    = 0;
+    Slab*           partialSlabs        = nullptr;  // Slabs with at least one free block.
+};
+
+static char*& GetBlockHeader(char* block)
+{
+    return *reinterpret_cast<char**>(block);
+}
+
+static void LinkPartialSlab(ObjectPool::SlabList& slabList, ObjectPool::Slab* slab)
+{
+    slab->prev = nullptr;
+    slab->next = slabList.partialSlabs;
+    if (slabList.partialSlabs != nullptr)
+        slabList.partialSlabs->prev = slab;
+    slabList.partialSlabs = slab;
+}
+
+static void UnlinkPartialSlab(ObjectPool::SlabList& slabList, ObjectPool::Slab* slab)
+{
+    if (slab->prev != nullptr)
+        slab->prev->next = slab->next;
+    else
+        slabList.partialSlabs = slab->next;
+    if (slab->next != nullptr)
+        slab->next->prev = slab->prev;
+    slab->prev = nullptr;
+    slab->next = nullptr;
+}
+
+
+/*
+ * ObjectPool class
+ */
+
+ObjectPool& ObjectPool::Get()
+{
+    /* Intentionally never destroyed, since objects in static containers might be released after static destruction of this pool */
+    static ObjectPool* instance = new ObjectPool{};
+    return *instance;
+}
+
+ObjectPool::SlabList* ObjectPool::CreateSlabList(std::size_t blockSize)
+{
+    auto slabList = MakeUnique<SlabList>();
+    {
+        slabList->blockStride       = GetAlignedSize(g_blockHeaderSize + std::max<std::size_t>(blockSize, 1u), g_blockAlignment);
+        slabList->numBlocksPerSlab  = static_cast<std::uint32_t>(Clamp<std::size_t>(g_slabSizeHint / slabList->blockStride, 4u, 256u));
+    }
+    SlabList* slabListRef = slabList.get();
+
+    std::lock_guard<std::mutex> guard{ slabListsMutex_ };
+    slabLists_.push_back(std::move(slabList));
+
+    return slabListRef;
+}
+
+void* ObjectPool::Alloc(SlabList* slabList)
+{
+    LLGL_ASSERT_PTR(slabList);
+
+    std::lock_guard<std::mutex> guard{ slabList->mutex };
+
+    /* Allocate new slab if all previous slabs are full */
+    Slab* slab = slabList->partialSlabs;
+    if (slab == nullptr)
+    {
+        slab = AllocSlab(*slabList);
+        LinkPartialSlab(*slabList, slab);
+    }
+
+    /* Take first free block and remove slab from the partial list once it is full */
+    char* block = slab->freeBlocks;
+    slab->freeBlocks = GetBlockHeader(block);
+    if (--slab->numFreeBlocks == 0)
+        UnlinkPartialSlab(*slabList, slab);
+
+    GetBlockHeader(block) = reinterpret_cast<char*>(slab);
+
+    return (block + g_blockHeaderSize);
+}
+
+void ObjectPool::Free(void* block)
+{
+    if (block == nullptr)
+        return;
+
+    char* blockHeader = static_cast<char*>(block) - g_blockHeaderSize;
+    Slab* slab = reinterpret_cast<Slab*>(GetBlockHeader(blockHeader));
+    SlabList& slabList = *(slab->owner);
+
+    std::lock_guard<std::mutex> guard{ slabList.mutex };
+
+    /* Return block to the free list of its slab */
+    GetBlockHeader(blockHeader) = slab->freeBlocks;
+    slab->freeBlocks = blockHeader;
+
+    if (slab->numFreeBlocks++ == 0)
+        LinkPartialSlab(slabList, slab);
+
+    /* Free empty slab unless it's the only one left with free blocks, so alternating allocations don't reallocate slabs each time */
+    if (slab->numFreeBlocks == slabList.numBlocksPerSlab && (slab->prev != nullptr || slab->next != nullptr))
+    {
+        UnlinkPartialSlab(slabList, slab);
+        FreeSlab(slab);
+    }
+}
+
+void ObjectPool::SetAllocator(const AllocatorDescriptor& allocator)
+{
+    std::lock_guard<std::mutex> guard{ allocatorMutex_ };
+    allocator_ = allocator;
+}
+
+void ObjectPool::Trim()
+{
+    std::lock_guard<std::mutex> guard{ slabListsMutex_ };
+    for (const auto& slabList : slabLists_)
+    {
+        std::lock_guard<std::mutex> slabListGuard{ slabList->mutex };
+        for (Slab* slab = slabList->partialSlabs; slab != nullptr;)
+        {
+            Slab* nextSlab = slab->next;
+            if (slab->numFreeBlocks == slabList->numBlocksPerSlab)
+            {
+                UnlinkPartialSlab(*slabList, slab);
+                FreeSlab(slab);
+            }
+            slab = nextSlab;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+ObjectPool::Slab* ObjectPool::AllocSlab(SlabList& slabList)
+{
+    AllocatorDescriptor allocator;
+    {
+        std::lock_guard<std::mutex> guard{ allocatorMutex_ };
+        allocator = allocator_;
+    }
+
+    /* Allocate slab with its header in front of all blocks */
+    const std::size_t slabSize = g_slabHeaderSize + slabList.blockStride * slabList.numBlocksPerSlab;
+
+    char* mem = nullptr;
+    if (allocator.allocate != nullptr)
+    {
+        mem = static_cast<char*>(allocator.allocate(slabSize, g_blockAlignment, allocator.userData));
+        if (mem == nullptr)
+            LLGL_TRAP("failed to allocate %zu bytes for object pool slab", slabSize);
+    }
+    else
+        mem = static_cast<char*>(::operator new(slabSize));
+
+    Slab* slab = new (mem) Slab{};
+    {
+        slab->owner         = &slabList;
+        slab->numFreeBlocks = slabList.numBlocksPerSlab;
+        slab->size          = slabSize;
+        slab->allocator     = allocator;
+    }
+
+    /* Link all blocks into the free list in ascending order */
+    char* blocks = mem + g_slabHeaderSize;
+    for (std::uint32_t i = slabList.numBlocksPerSlab; i > 0; --i)
+    {
+        char* block = blocks + slabList.blockStride * (i - 1);
+        GetBlockHeader(block) = slab->freeBlocks;
+        slab->freeBlocks = block;
+    }
+
+    return slab;
+}
+
+void ObjectPool::FreeSlab(Slab* slab)
+{
+    const AllocatorDescriptor allocator = slab->allocator;
+    const std::size_t slabSize = slab->size;
+
+    slab->~Slab();
+
+    if (allocator.free != nullptr)
+        allocator.free(slab, slabSize, g_blockAlignment, allocator.userData);
+    else
+        ::operator delete(slab);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,91 @@
+/*
+ * ObjectPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_OBJECT_POOL_H
+#define LLGL_OBJECT_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/RenderSystemFlags.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Thread-safe slab allocator for render system child objects (see HWObjectContainer).
+Each object type allocates from its own slab list, so objects of the same type are packed into contiguous slabs.
+Memory blocks keep their address until they are freed, and freeing a block returns it to its slab in constant time.
+The pool is shared by all render systems of the process and is never destroyed, since objects in static containers may outlive it otherwise.
+*/
+class LLGL_EXPORT ObjectPool
+{
+
+    public:
+
+        // Slab list for memory blocks of the same size.
+        struct SlabList;
+
+        // Contiguous memory range of memory blocks that belongs to a slab list.
+        struct Slab;
+
+    public:
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator = (const ObjectPool&) = delete;
+
+        // Returns the instance of the process-wide object pool.
+        static ObjectPool& Get();
+
+        // Creates a new slab list for memory blocks of the specified size. The slab list remains valid for the lifetime of the pool.
+        SlabList* CreateSlabList(std::size_t blockSize);
+
+        // Allocates a memory block from the specified slab list. The block is aligned to alignof(std::max_align_t).
+        void* Alloc(SlabList* slabList);
+
+        // Returns the specified memory block to its slab. The block must have been allocated with Alloc().
+        static void Free(void* block);
+
+        // Sets the allocator callbacks for all slabs that are allocated from now on. Slabs are always freed with the callbacks they were allocated with.
+        void SetAllocator(const AllocatorDescriptor& allocator);
+
+        // Frees all slabs that have no allocated blocks. This is called whenever a render system is unloaded.
+        void Trim();
+
+    private:
+
+        ObjectPool() = default;
+
+        Slab* AllocSlab(SlabList& slabList);
+
+        static void FreeSlab(Slab* slab);
+
+    private:
+
+        std::mutex                              slabListsMutex_;
+        std::vector<std::unique_ptr<SlabList>>  slabLists_;
+
+        std::mutex                              allocatorMutex_;
+        AllocatorDescriptor                     allocator_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
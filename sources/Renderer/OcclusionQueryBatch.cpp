@@ -0,0 +1,276 @@
+/*
+ * OcclusionQueryBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/OcclusionQueryBatch.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include "../Core/Assertion.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+OcclusionQueryBatch::OcclusionQueryBatch(RenderSystem& renderer, const OcclusionQueryBatchDescriptor& desc) :
+    renderer_            { renderer                                             },
+    commandQueue_        { renderer.GetCommandQueue()                           },
+    numQueries_          { desc.numQueries                                      },
+    numHysteresisFrames_ { desc.numHysteresisFrames                             },
+    hasQueryResolve_     { renderer.GetRenderingCaps().features.hasQueryResolve }
+{
+    LLGL_ASSERT(desc.numQueries > 0, "number of queries in occlusion query batch must be greater than zero");
+    LLGL_ASSERT(desc.numFrames > 0, "number of frames in occlusion query batch must be greater than zero");
+    LLGL_ASSERT(
+        desc.type == QueryType::SamplesPassed || desc.type == QueryType::AnySamplesPassed || desc.type == QueryType::AnySamplesPassedConservative,
+        "occlusion query batch requires query type SamplesPassed, AnySamplesPassed, or AnySamplesPassedConservative"
+    );
+    LLGL_ASSERT(desc.resultBufferBindFlags == 0 || hasQueryResolve_, "occlusion query batch result buffer requires query resolve support");
+
+    const std::uint64_t resultSize = sizeof(std::uint64_t) * desc.numQueries;
+
+    /* Create query heap, fence, and readback buffer for each frame in flight */
+    QueryHeapDescriptor queryHeapDesc;
+    {
+        queryHeapDesc.debugName     = "LLGL.OcclusionQueryBatch";
+        queryHeapDesc.type          = desc.type;
+        queryHeapDesc.numQueries    = desc.numQueries;
+    }
+
+    BufferDescriptor readbackBufferDesc;
+    {
+        readbackBufferDesc.debugName        = "LLGL.OcclusionQueryBatch.Readback";
+        readbackBufferDesc.size             = resultSize;
+        readbackBufferDesc.bindFlags        = BindFlags::CopyDst;
+        readbackBufferDesc.cpuAccessFlags   = CPUAccessFlags::Read;
+    }
+
+    frames_.resize(desc.numFrames);
+    for (Frame& frame : frames_)
+    {
+        frame.queryHeap = renderer.CreateQueryHeap(queryHeapDesc);
+        frame.fence     = renderer.CreateFence();
+        if (hasQueryResolve_)
+            frame.readbackBuffer = renderer.CreateBuffer(readbackBufferDesc);
+        frame.queries.reserve(desc.numQueries);
+    }
+
+    /* Create optional GPU buffer for the results, e.g. to generate indirect arguments */
+    if (desc.resultBufferBindFlags != 0)
+    {
+        BufferDescriptor resultBufferDesc;
+        {
+            resultBufferDesc.debugName  = "LLGL.OcclusionQueryBatch.Results";
+            resultBufferDesc.size       = resultSize;
+            resultBufferDesc.stride     = sizeof(std::uint64_t);
+            resultBufferDesc.bindFlags  = (BindFlags::CopyDst | desc.resultBufferBindFlags);
+        }
+        resultBuffer_ = renderer.CreateBuffer(resultBufferDesc);
+    }
+
+    issuedFrames_.resize(desc.numQueries, 0);
+    resultFrames_.resize(desc.numQueries, 0);
+    visibleFrames_.resize(desc.numQueries, 0);
+
+    GetFrame(currentFrame_).index = currentFrame_;
+}
+
+OcclusionQueryBatch::~OcclusionQueryBatch()
+{
+    for (Frame& frame : frames_)
+    {
+        /* Wait until the GPU no longer uses the queries and readback buffer before they are released */
+        if (frame.submitted)
+            commandQueue_->WaitFence(*frame.fence, ~0ull);
+        renderer_.Release(*frame.queryHeap);
+        renderer_.Release(*frame.fence);
+        if (frame.readbackBuffer != nullptr)
+            renderer_.Release(*frame.readbackBuffer);
+    }
+    if (resultBuffer_ != nullptr)
+        renderer_.Release(*resultBuffer_);
+}
+
+void OcclusionQueryBatch::BeginQuery(CommandBuffer& cmdBuffer, std::uint32_t query)
+{
+    LLGL_ASSERT(query < numQueries_);
+    LLGL_ASSERT(issuedFrames_[query] != currentFrame_, "occlusion query %u issued more than once in the same frame", query);
+
+    Frame& frame = GetFrame(currentFrame_);
+    issuedFrames_[query] = currentFrame_;
+    frame.queries.push_back(query);
+    cmdBuffer.BeginQuery(*frame.queryHeap, query);
+}
+
+void OcclusionQueryBatch::EndQuery(CommandBuffer& cmdBuffer, std::uint32_t query)
+{
+    LLGL_ASSERT(query < numQueries_);
+    cmdBuffer.EndQuery(*GetFrame(currentFrame_).queryHeap, query);
+}
+
+void OcclusionQueryBatch::Resolve(CommandBuffer& cmdBuffer)
+{
+    Frame& frame = GetFrame(currentFrame_);
+    if (!hasQueryResolve_ || frame.resolved)
+        return;
+
+    /* Copy results of all issued queries; Queries that have not been issued must not be resolved, since their results never become available */
+    ForEachQueryRange(
+        frame,
+        [this, &cmdBuffer, &frame](std::uint32_t firstQuery, std::uint32_t numQueries)
+        {
+            const std::uint64_t dstOffset = sizeof(std::uint64_t) * firstQuery;
+            cmdBuffer.ResolveQueryData(*frame.queryHeap, firstQuery, numQueries, *frame.readbackBuffer, dstOffset);
+            if (resultBuffer_ != nullptr)
+                cmdBuffer.ResolveQueryData(*frame.queryHeap, firstQuery, numQueries, *resultBuffer_, dstOffset);
+        }
+    );
+
+    frame.resolved = true;
+}
+
+void OcclusionQueryBatch::Submit()
+{
+    /* Signal fence once the GPU has finished all queries of the current frame */
+    Frame& frame = GetFrame(currentFrame_);
+    commandQueue_->Submit(*frame.fence);
+    frame.submitted = true;
+
+    /* Advance to the next frame and recycle its query heap; this only blocks if the GPU is more than N frames behind */
+    ++currentFrame_;
+
+    Frame& nextFrame = GetFrame(currentFrame_);
+    if (nextFrame.submitted && !nextFrame.consumed)
+    {
+        commandQueue_->WaitFence(*nextFrame.fence, ~0ull);
+        ConsumeFrameResults(nextFrame);
+    }
+
+    nextFrame.index     = currentFrame_;
+    nextFrame.resolved  = false;
+    nextFrame.submitted = false;
+    nextFrame.consumed  = false;
+    nextFrame.queries.clear();
+
+    /* Consume results of all other frames the GPU has already finished */
+    Update();
+}
+
+void OcclusionQueryBatch::Update()
+{
+    /* Consume results from the oldest to the most recent frame, so newer results take precedence */
+    const std::uint64_t numFrames = frames_.size();
+    for (std::uint64_t index = (currentFrame_ > numFrames ? currentFrame_ - numFrames + 1 : 1); index < currentFrame_; ++index)
+    {
+        Frame& frame = GetFrame(index);
+        if (frame.index != index || !frame.submitted || frame.consumed)
+            continue;
+
+        /* Stop at the first frame the GPU has not finished yet, since later frames cannot have finished either */
+        if (!frame.fence->IsSignaled())
+            break;
+
+        ConsumeFrameResults(frame);
+    }
+}
+
+bool OcclusionQueryBatch::IsVisible(std::uint32_t query) const
+{
+    if (!(query < numQueries_))
+        return true;
+
+    /* Objects without any result are considered visible */
+    const std::uint64_t resultFrame = resultFrames_[query];
+    if (resultFrame == 0)
+        return true;
+
+    return (visibleFrames_[query] + numHysteresisFrames_ >= resultFrame);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+OcclusionQueryBatch::Frame& OcclusionQueryBatch::GetFrame(std::uint64_t index)
+{
+    return frames_[index % frames_.size()];
+}
+
+void OcclusionQueryBatch::ConsumeFrameResults(Frame& frame)
+{
+    frame.consumed = true;
+    if (frame.queries.empty())
+        return;
+
+    auto ApplyResult = [this, &frame](std::uint32_t query, std::uint64_t result)
+    {
+        resultFrames_[query] = frame.index;
+        if (result > 0)
+            visibleFrames_[query] = frame.index;
+    };
+
+    if (hasQueryResolve_)
+    {
+        /* Skip frames whose results have never been resolved */
+        if (!frame.resolved)
+            return;
+
+        /* Read results directly from the readback buffer */
+        const std::uint64_t resultSize = sizeof(std::uint64_t) * numQueries_;
+        if (const void* data = renderer_.MapBuffer(*frame.readbackBuffer, CPUAccess::ReadOnly, 0, resultSize))
+        {
+            const std::uint64_t* results = static_cast<const std::uint64_t*>(data);
+            for (std::uint32_t query : frame.queries)
+                ApplyResult(query, results[query]);
+            renderer_.UnmapBuffer(*frame.readbackBuffer);
+        }
+    }
+    else
+    {
+        /* Query results per contiguous range; the GPU has already finished this frame, so this does not block */
+        std::vector<std::uint64_t> results;
+        ForEachQueryRange(
+            frame,
+            [this, &frame, &results, &ApplyResult](std::uint32_t firstQuery, std::uint32_t numQueries)
+            {
+                results.resize(numQueries);
+                if (commandQueue_->QueryResult(*frame.queryHeap, firstQuery, numQueries, results.data(), sizeof(std::uint64_t) * numQueries))
+                {
+                    for (std::uint32_t i = 0; i < numQueries; ++i)
+                        ApplyResult(firstQuery + i, results[i]);
+                }
+            }
+        );
+    }
+}
+
+template <typename TFunc>
+void OcclusionQueryBatch::ForEachQueryRange(Frame& frame, const TFunc& func)
+{
+    std::vector<std::uint32_t>& queries = frame.queries;
+    std::sort(queries.begin(), queries.end());
+
+    for (std::size_t i = 0, n = queries.size(); i < n;)
+    {
+        /* Find end of contiguous range of queries */
+        std::size_t j = i + 1;
+        while (j < n && queries[j] == queries[j - 1] + 1)
+            ++j;
+
+        func(queries[i], static_cast<std::uint32_t>(j - i));
+        i = j;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -35,12 +35,17 @@ void GL3PlusSharedContextVertexArray::BuildVertexLayout(GLuint bufferID, const A
 
 void GL3PlusSharedContextVertexArray::Finalize()
 {
-    // dummy (only implemented for GL 2.x)
+    /* Build vertex buffer bindings for format-only VAOs */
+    if (HasFormatOnlyVertexArrays())
+        GLVertexArrayCache::BuildBindingSet(bindingSet_, attribs_);
 }
 
 void GL3PlusSharedContextVertexArray::Bind(GLStateManager& stateMngr)
 {
-    stateMngr.BindVertexArray(GetVAOForCurrentContext().GetID());
+    if (HasFormatOnlyVertexArrays())
+        stateMngr.GetVertexArrayCache().BindVertexArray(stateMngr, attribs_, bindingSet_);
+    else
+        stateMngr.BindVertexArray(GetVAOForCurrentContext().GetID());
 }
 
 void GL3PlusSharedContextVertexArray::SetDebugName(const char* name)
@@ -53,7 +58,7 @@ void GL3PlusSharedContextVertexArray::SetDebugName(const char* name)
         contextVAO.isObjectLabelDirty = true;
 
     /* If this vertex array already has its attributes set, get the current VAO to cause invaldiated labels to be updated */
-    if (!attribs_.empty())
+    if (!attribs_.empty() && !HasFormatOnlyVertexArrays())
         (void)GetVAOForCurrentContext();
 }
 
@@ -100,6 +105,17 @@ GLVertexArrayObject& GL3PlusSharedContextVertexArray::GetVAOForCurrentContext()
  * GLContextVAO structure
  */
 
+bool GL3PlusSharedContextVertexArray::HasFormatOnlyVertexArrays()
+{
+    #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+    return HasExtension(GLExt::ARB_direct_state_access);
+    #else
+    return false;
+    #endif
+}
+
+
+
 void GL3PlusSharedContextVertexArray::GLContextVAO::SetObjectLabel(const char* label)
 {
     /* Set label for VAO */
@@ -13,6 +13,7 @@
 #include <LLGL/Container/ArrayView.h>
 #include "GLVertexAttribute.h"
 #include "GLVertexArrayObject.h"
+#include "GLVertexArrayCache.h"
 #include <vector>
 
 
@@ -22,7 +23,10 @@ namespace LLGL
 
 class GLStateManager;
 
-// This class manages a vertex-array-object (VAO) across one or more GL contexts.
+/*
+This class manages a vertex-array-object (VAO) across one or more GL contexts.
+With GL_ARB_direct_state_access, this class does not own any VAO but binds its vertex buffers to a VAO from the GLVertexArrayCache instead.
+*/
 class GL3PlusSharedContextVertexArray
 {
 
@@ -55,9 +59,13 @@ class GL3PlusSharedContextVertexArray
         // Returns the VAO for the current GL context and creates it on demand.
         GLVertexArrayObject& GetVAOForCurrentContext();
 
+        // Returns true if vertex buffers are bound to format-only VAOs from the GLVertexArrayCache.
+        static bool HasFormatOnlyVertexArrays();
+
     private:
 
         std::vector<GLVertexAttribute>  attribs_;
+        GLVertexBindingSet              bindingSet_;
         std::vector<GLContextVAO>       contextDependentVAOs_;
         std::string                     debugName_;
 
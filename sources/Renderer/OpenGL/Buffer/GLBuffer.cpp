@@ -114,6 +114,8 @@ BufferDescriptor GLBuffer::GetDesc() const
             bufferDesc.cpuAccessFlags |= CPUAccessFlags::Read;
         if ((storageFlags & GL_MAP_WRITE_BIT) != 0)
             bufferDesc.cpuAccessFlags |= CPUAccessFlags::Write;
+        if ((storageFlags & GL_MAP_PERSISTENT_BIT) != 0)
+            bufferDesc.miscFlags |= MiscFlags::PersistentMapping;
     }
     else
     #endif // /GL_ARB_buffer_storage
@@ -128,18 +130,44 @@ BufferDescriptor GLBuffer::GetDesc() const
     return bufferDesc;
 }
 
+// Returns true if the specified storage flags require immutable buffer storage.
+static bool IsGLBufferStorageFlagsPersistent(GLbitfield flags)
+{
+    #ifdef GL_ARB_buffer_storage
+    return ((flags & GL_MAP_PERSISTENT_BIT) != 0);
+    #else
+    return false;
+    #endif
+}
+
 void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags, GLenum usage)
 {
+    /*
+    Dynamic buffers that are not persistently mapped are allocated with mutable storage,
+    so that full buffer updates can orphan the previous storage instead of synchronizing with the GPU.
+    */
+    size_       = size;
+    usage_      = usage;
+    orphanable_ = (usage == GL_DYNAMIC_DRAW && !IsGLBufferStorageFlagsPersistent(flags));
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
-        /* Allocate buffer with immutable storage (4.5+) */
-        glNamedBufferStorage(GetID(), size, data, flags);
+        if (orphanable_)
+        {
+            /* Allocate buffer with mutable storage (4.5+) */
+            glNamedBufferData(GetID(), size, data, usage);
+        }
+        else
+        {
+            /* Allocate buffer with immutable storage (4.5+) */
+            glNamedBufferStorage(GetID(), size, data, flags);
+        }
     }
     else
     #endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
     #ifdef GL_ARB_buffer_storage
-    if (HasExtension(GLExt::ARB_buffer_storage))
+    if (HasExtension(GLExt::ARB_buffer_storage) && !orphanable_)
     {
         /* Bind and allocate buffer with immutable storage (GL 4.4+) */
         GLStateManager::Get().BindGLBuffer(*this);
@@ -156,6 +184,13 @@ void GLBuffer::BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags
 
 void GLBuffer::BufferSubData(GLintptr offset, GLsizeiptr size, const void* data)
 {
+    if (orphanable_ && offset == 0 && size == size_)
+    {
+        /* Orphan previous storage that might still be in use by the GPU and upload data into new storage */
+        OrphanBufferData(data);
+        return;
+    }
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -286,6 +321,10 @@ void GLBuffer::CopyBufferSubData(const GLBuffer& readBuffer, GLintptr readOffset
 
 void* GLBuffer::MapBuffer(GLenum access)
 {
+    /* Return persistently mapped memory without re-mapping the buffer */
+    if (persistentData_ != nullptr)
+        return persistentData_;
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -301,6 +340,9 @@ void* GLBuffer::MapBuffer(GLenum access)
 
 void* GLBuffer::MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
 {
+    if (persistentData_ != nullptr)
+        return (static_cast<char*>(persistentData_) + offset);
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -324,6 +366,10 @@ void* GLBuffer::MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield ac
 
 void GLBuffer::UnmapBuffer()
 {
+    /* Persistently mapped buffers stay mapped until they are deleted */
+    if (persistentData_ != nullptr)
+        return;
+
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
     if (HasExtension(GLExt::ARB_direct_state_access))
     {
@@ -337,6 +383,13 @@ void GLBuffer::UnmapBuffer()
     }
 }
 
+void GLBuffer::MapPersistent(GLsizeiptr size, GLbitfield access)
+{
+    #ifdef GL_ARB_buffer_storage
+    persistentData_ = MapBufferRange(0, size, access | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    #endif // /GL_ARB_buffer_storage
+}
+
 void GLBuffer::GetBufferParams(GLint* size, GLint* usage, GLint* storageFlags) const
 {
     #if LLGL_GLEXT_DIRECT_STATE_ACCESS
@@ -447,6 +500,27 @@ void GLBuffer::SetIndexType(const Format format)
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void GLBuffer::OrphanBufferData(const void* data)
+{
+    /* Re-specifying the entire data store lets the driver allocate new memory while in-flight commands keep the old one */
+    #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        glNamedBufferData(GetID(), size_, data, usage_);
+    }
+    else
+    #endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+    {
+        GLStateManager::Get().BindGLBuffer(*this);
+        glBufferData(GetGLTarget(), size_, data, usage_);
+    }
+}
+
+
 } // /namespace LLGL
 
 
@@ -36,7 +36,10 @@ class GLBuffer : public Buffer
         GLBuffer(long bindFlags, const char* debugName = nullptr);
         ~GLBuffer();
 
+        // Allocates the buffer storage. Dynamic buffers (GL_DYNAMIC_DRAW) without persistent mapping use mutable storage so they can be orphaned.
         void BufferStorage(GLsizeiptr size, const void* data, GLbitfield flags, GLenum usage);
+
+        // Updates the buffer data. Full updates of dynamic buffers orphan the previous storage instead of waiting for the GPU.
         void BufferSubData(GLintptr offset, GLsizeiptr size, const void* data);
 
         void GetBufferSubData(GLintptr offset, GLsizeiptr size, void* data);
@@ -50,6 +53,10 @@ class GLBuffer : public Buffer
         void* MapBufferRange(GLintptr offset, GLsizeiptr length, GLbitfield access);
         void UnmapBuffer();
 
+        // Maps the entire buffer persistently and coherently. MapBuffer, MapBufferRange, and UnmapBuffer will then only return that memory.
+        // This requires the buffer storage to be allocated with GL_MAP_PERSISTENT_BIT and GL_MAP_COHERENT_BIT.
+        void MapPersistent(GLsizeiptr size, GLbitfield access);
+
         // Returns the specified buffer parameters; null pointers are ignored.
         void GetBufferParams(GLint* size, GLint* usage, GLint* storageFlags) const;
 
@@ -68,6 +75,18 @@ class GLBuffer : public Buffer
             return id_;
         }
 
+        // Returns the size (in bytes) of the buffer storage.
+        inline GLsizeiptr GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns true if this buffer is persistently mapped into CPU memory space.
+        inline bool IsPersistentlyMapped() const
+        {
+            return (persistentData_ != nullptr);
+        }
+
         // Returns the primary buffer target. In case the buffer was created with multiple binding flags, other targets can be used, too.
         inline GLBufferTarget GetTarget() const
         {
@@ -102,6 +121,11 @@ class GLBuffer : public Buffer
             return texInternalFormat_;
         }
 
+    private:
+
+        // Re-specifies the entire buffer storage with the specified data.
+        void OrphanBufferData(const void* data);
+
     private:
 
         GLuint          id_                 = 0;
@@ -109,6 +133,10 @@ class GLBuffer : public Buffer
         bool            indexType16Bits_    = false;
         GLuint          texID_              = 0; // Used for sampler and image buffers
         GLenum          texInternalFormat_  = 0; // Used for sampler and image buffers
+        void*           persistentData_     = nullptr;
+        GLsizeiptr      size_               = 0;
+        GLenum          usage_              = 0;
+        bool            orphanable_         = false; // Buffer uses mutable storage and can be orphaned on full updates
 
 };
 
@@ -0,0 +1,126 @@
+/*
+ * GLUniformBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLUniformBatch.h"
+#include "../RenderState/GLPipelineState.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../../Core/CoreUtils.h"
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+GLUniformBatch::~GLUniformBatch()
+{
+    if (buffer_ != 0)
+    {
+        glDeleteBuffers(1, &buffer_);
+        GLStateManager::Get().NotifyBufferRelease(buffer_, GLBufferTarget::UniformBuffer);
+    }
+}
+
+std::uint32_t GLUniformBatch::Record(const GLPipelineState* pipelineState, std::uint32_t first, const void* data, std::uint32_t dataSize)
+{
+    /* Copy uniform data; the uniform block layout is not known until the PSO has been linked */
+    Entry entry;
+    {
+        entry.pipelineState = pipelineState;
+        entry.first         = first;
+        entry.dataOffset    = static_cast<std::uint32_t>(data_.size());
+        entry.dataSize      = dataSize;
+        entry.bufferOffset  = -1;
+    }
+    const char* bytes = static_cast<const char*>(data);
+    data_.insert(data_.end(), bytes, bytes + dataSize);
+
+    entries_.push_back(entry);
+    return static_cast<std::uint32_t>(entries_.size() - 1);
+}
+
+void GLUniformBatch::Clear()
+{
+    entries_.clear();
+    data_.clear();
+}
+
+void GLUniformBatch::Flush(GLStateManager& stateMngr)
+{
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+
+    staging_.clear();
+
+    for (Entry& entry : entries_)
+    {
+        /* Uniform block layout is only available once the program has been linked */
+        const_cast<GLPipelineState*>(entry.pipelineState)->FinishPendingLink();
+        if (!entry.pipelineState->HasUniformBlock())
+        {
+            entry.bufferOffset = -1;
+            continue;
+        }
+
+        if (offsetAlignment_ == 0)
+        {
+            GLint alignment = 0;
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+            offsetAlignment_ = (alignment > 0 ? alignment : 256);
+        }
+
+        /* Update the PSO's shadow copy of the uniform block and append a snapshot of it to the staging buffer */
+        entry.pipelineState->WriteUniformBlock(entry.first, data_.data() + entry.dataOffset, entry.dataSize);
+
+        const std::vector<char>& blockData = entry.pipelineState->GetUniformBlockData();
+        entry.bufferOffset = static_cast<GLintptr>(GetAlignedSize(staging_.size(), static_cast<std::size_t>(offsetAlignment_)));
+        staging_.resize(static_cast<std::size_t>(entry.bufferOffset));
+        staging_.insert(staging_.end(), blockData.begin(), blockData.end());
+    }
+
+    if (staging_.empty())
+        return;
+
+    /* Upload all uniform blocks with a single buffer update */
+    if (buffer_ == 0)
+        glGenBuffers(1, &buffer_);
+
+    stateMngr.BindBuffer(GLBufferTarget::UniformBuffer, buffer_);
+
+    const GLsizeiptr stagingSize = static_cast<GLsizeiptr>(staging_.size());
+    if (stagingSize > bufferSize_)
+    {
+        glBufferData(GL_UNIFORM_BUFFER, stagingSize, nullptr, GL_DYNAMIC_DRAW);
+        bufferSize_ = stagingSize;
+    }
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, stagingSize, staging_.data());
+
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+}
+
+void GLUniformBatch::Apply(std::uint32_t index, GLStateManager& stateMngr) const
+{
+    const Entry& entry = entries_[index];
+
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+    if (entry.bufferOffset >= 0)
+    {
+        const GLsizeiptr blockSize = static_cast<GLsizeiptr>(entry.pipelineState->GetUniformBlockData().size());
+        stateMngr.BindBufferRange(GLBufferTarget::UniformBuffer, entry.pipelineState->GetUniformBlockBinding(), buffer_, entry.bufferOffset, blockSize);
+        return;
+    }
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+
+    entry.pipelineState->SetUniforms(entry.first, data_.data() + entry.dataOffset, entry.dataSize);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
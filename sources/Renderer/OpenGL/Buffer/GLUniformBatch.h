@@ -0,0 +1,83 @@
+/*
+ * GLUniformBatch.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_UNIFORM_BATCH_H
+#define LLGL_GL_UNIFORM_BATCH_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLPipelineState;
+class GLStateManager;
+
+/*
+Collects the uniform data of multiple SetUniforms commands. Uniforms that are declared inside a uniform block
+are coalesced into a single uniform buffer that is uploaded once per flush and bound per command via glBindBufferRange.
+All other uniforms fall back to glUniform* when the command is applied.
+*/
+class GLUniformBatch
+{
+
+    public:
+
+        GLUniformBatch() = default;
+        ~GLUniformBatch();
+
+        GLUniformBatch(const GLUniformBatch&) = delete;
+        GLUniformBatch& operator = (const GLUniformBatch&) = delete;
+
+        // Records the specified uniform data and returns the index of this entry.
+        std::uint32_t Record(const GLPipelineState* pipelineState, std::uint32_t first, const void* data, std::uint32_t dataSize);
+
+        // Clears all recorded entries but keeps the uniform buffer alive.
+        void Clear();
+
+        // Writes all recorded entries into the uniform buffer and uploads it with a single buffer update.
+        void Flush(GLStateManager& stateMngr);
+
+        // Applies the recorded entry at the specified index. This must be called after Flush().
+        void Apply(std::uint32_t index, GLStateManager& stateMngr) const;
+
+    private:
+
+        struct Entry
+        {
+            const GLPipelineState*  pipelineState;
+            std::uint32_t           first;
+            std::uint32_t           dataOffset;
+            std::uint32_t           dataSize;
+            GLintptr                bufferOffset;
+        };
+
+    private:
+
+        std::vector<Entry>  entries_;
+        std::vector<char>   data_;
+        std::vector<char>   staging_;
+
+        GLuint              buffer_             = 0;
+        GLsizeiptr          bufferSize_         = 0;
+        GLintptr            offsetAlignment_    = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
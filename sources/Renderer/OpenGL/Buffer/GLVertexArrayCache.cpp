@@ -0,0 +1,183 @@
+/*
+ * GLVertexArrayCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLVertexArrayCache.h"
+#include "../RenderState/GLStateManager.h"
+#include "../Ext/GLExtensions.h"
+#include "../../../Core/Assertion.h"
+#include "../../../Core/HashUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <atomic>
+
+
+namespace LLGL
+{
+
+
+#if LLGL_GLEXT_DIRECT_STATE_ACCESS
+
+static std::uint64_t GenerateBindingSetID()
+{
+    static std::atomic<std::uint64_t> idCounter{ 0 };
+    return ++idCounter;
+}
+
+void GLVertexArrayCache::BuildBindingSet(GLVertexBindingSet& outBindingSet, const ArrayView<GLVertexAttribute>& attributes)
+{
+    outBindingSet.id            = GenerateBindingSetID();
+    outBindingSet.formatHash    = g_hashSeed;
+
+    /* Use one binding point per attribute, so the attribute offset can be passed as buffer offset */
+    GLuint numBindings = 0;
+    for (const GLVertexAttribute& attrib : attributes)
+        numBindings = std::max(numBindings, attrib.index + 1);
+
+    outBindingSet.buffers.assign(numBindings, 0);
+    outBindingSet.offsets.assign(numBindings, 0);
+    outBindingSet.strides.assign(numBindings, 0);
+
+    for (const GLVertexAttribute& attrib : attributes)
+    {
+        HashValue(outBindingSet.formatHash, attrib.index);
+        HashValue(outBindingSet.formatHash, attrib.size);
+        HashValue(outBindingSet.formatHash, attrib.type);
+        HashValue(outBindingSet.formatHash, attrib.normalized);
+        HashValue(outBindingSet.formatHash, attrib.divisor);
+        HashValue(outBindingSet.formatHash, attrib.isInteger);
+
+        outBindingSet.buffers[attrib.index] = attrib.buffer;
+        outBindingSet.offsets[attrib.index] = static_cast<GLintptr>(attrib.offsetPtrSized);
+        outBindingSet.strides[attrib.index] = attrib.stride;
+    }
+}
+
+void GLVertexArrayCache::BindVertexArray(GLStateManager& stateMngr, const ArrayView<GLVertexAttribute>& attributes, const GLVertexBindingSet& bindingSet)
+{
+    Entry& entry = FindOrCreateEntry(stateMngr, attributes, bindingSet.formatHash);
+    entry.lastUse = ++useCounter_;
+
+    /* Only rebind vertex buffers if another binding set was used with this VAO */
+    if (entry.boundBindingSetID != bindingSet.id)
+    {
+        glVertexArrayVertexBuffers(
+            entry.vao,
+            0,
+            static_cast<GLsizei>(bindingSet.buffers.size()),
+            bindingSet.buffers.data(),
+            bindingSet.offsets.data(),
+            bindingSet.strides.data()
+        );
+        entry.boundBindingSetID = bindingSet.id;
+    }
+
+    stateMngr.BindVertexArray(entry.vao);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static GLuint CreateFormatOnlyVertexArray(const ArrayView<GLVertexAttribute>& attributes)
+{
+    GLuint vao = 0;
+    glCreateVertexArrays(1, &vao);
+
+    for (const GLVertexAttribute& attrib : attributes)
+    {
+        glEnableVertexArrayAttrib(vao, attrib.index);
+        if (attrib.isInteger)
+            glVertexArrayAttribIFormat(vao, attrib.index, attrib.size, attrib.type, 0);
+        else
+            glVertexArrayAttribFormat(vao, attrib.index, attrib.size, attrib.type, attrib.normalized, 0);
+        glVertexArrayAttribBinding(vao, attrib.index, attrib.index);
+        glVertexArrayBindingDivisor(vao, attrib.index, attrib.divisor);
+    }
+
+    return vao;
+}
+
+GLVertexArrayCache::Entry& GLVertexArrayCache::FindOrCreateEntry(GLStateManager& stateMngr, const ArrayView<GLVertexAttribute>& attributes, std::uint64_t formatHash)
+{
+    /* Find entry with linear probing */
+    std::size_t slot = static_cast<std::size_t>(formatHash) & indexMask;
+    for (; entries_[slot].vao != 0; slot = (slot + 1) & indexMask)
+    {
+        if (entries_[slot].formatHash == formatHash)
+            return entries_[slot];
+    }
+
+    if (numEntries_ == maxEntries)
+    {
+        /* Evict one entry and find a free slot again, because eviction moves entries within their probe sequence */
+        EvictLeastRecentlyUsed(stateMngr);
+        slot = static_cast<std::size_t>(formatHash) & indexMask;
+        while (entries_[slot].vao != 0)
+            slot = (slot + 1) & indexMask;
+    }
+
+    /* Create new format-only VAO in free slot */
+    Entry& entry = entries_[slot];
+    entry.formatHash        = formatHash;
+    entry.vao               = CreateFormatOnlyVertexArray(attributes);
+    entry.boundBindingSetID = 0;
+    ++numEntries_;
+
+    return entry;
+}
+
+void GLVertexArrayCache::EvictLeastRecentlyUsed(GLStateManager& stateMngr)
+{
+    /* Find least recently used entry */
+    std::size_t hole = capacity;
+    for_range(i, capacity)
+    {
+        if (entries_[i].vao != 0 && (hole == capacity || entries_[i].lastUse < entries_[hole].lastUse))
+            hole = i;
+    }
+    LLGL_ASSERT(hole < capacity);
+
+    /* Delete VAO of evicted entry */
+    glDeleteVertexArrays(1, &(entries_[hole].vao));
+    stateMngr.NotifyVertexArrayRelease(entries_[hole].vao);
+
+    /* Shift subsequent entries of the same probe sequences back into the hole */
+    for (std::size_t next = (hole + 1) & indexMask; entries_[next].vao != 0; next = (next + 1) & indexMask)
+    {
+        const std::size_t home = static_cast<std::size_t>(entries_[next].formatHash) & indexMask;
+        if (((next - home) & indexMask) >= ((next - hole) & indexMask))
+        {
+            entries_[hole] = entries_[next];
+            hole = next;
+        }
+    }
+
+    entries_[hole] = Entry{};
+    --numEntries_;
+}
+
+#else // LLGL_GLEXT_DIRECT_STATE_ACCESS
+
+void GLVertexArrayCache::BuildBindingSet(GLVertexBindingSet& /*outBindingSet*/, const ArrayView<GLVertexAttribute>& /*attributes*/)
+{
+    // dummy
+}
+
+void GLVertexArrayCache::BindVertexArray(GLStateManager& /*stateMngr*/, const ArrayView<GLVertexAttribute>& /*attributes*/, const GLVertexBindingSet& /*bindingSet*/)
+{
+    // dummy
+}
+
+#endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,95 @@
+/*
+ * GLVertexArrayCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_VERTEX_ARRAY_CACHE_H
+#define LLGL_GL_VERTEX_ARRAY_CACHE_H
+
+
+#include "../OpenGL.h"
+#include "GLVertexAttribute.h"
+#include <LLGL/Container/ArrayView.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class GLStateManager;
+
+// Vertex buffer bindings of a vertex array that are bound separately from its vertex format.
+struct GLVertexBindingSet
+{
+    std::uint64_t           id          = 0; // Unique ID of this binding set to detect redundant vertex buffer bindings.
+    std::uint64_t           formatHash  = 0; // Hash of all vertex attribute formats, excluding buffers and offsets.
+    std::vector<GLuint>     buffers;         // Buffer per binding point; The binding point equals the vertex attribute index.
+    std::vector<GLintptr>   offsets;
+    std::vector<GLsizei>    strides;
+};
+
+/*
+Per-context cache of format-only vertex-array-objects (VAOs); requires GL_ARB_direct_state_access.
+All vertex arrays with the same vertex format share the same VAO and their vertex buffers are bound with a single glVertexArrayVertexBuffers call,
+so switching between vertex buffers of the same format neither creates nor switches VAOs.
+The cache is a small open-addressing hash map and the least recently used VAO is evicted when the cache is full.
+*/
+class GLVertexArrayCache
+{
+
+    public:
+
+        GLVertexArrayCache() = default;
+
+        GLVertexArrayCache(const GLVertexArrayCache&) = delete;
+        GLVertexArrayCache& operator = (const GLVertexArrayCache&) = delete;
+
+        // Builds the binding set for the specified vertex attributes.
+        static void BuildBindingSet(GLVertexBindingSet& outBindingSet, const ArrayView<GLVertexAttribute>& attributes);
+
+        // Binds the VAO for the vertex format of the specified attributes and binds the vertex buffers of the binding set if they have changed.
+        void BindVertexArray(GLStateManager& stateMngr, const ArrayView<GLVertexAttribute>& attributes, const GLVertexBindingSet& bindingSet);
+
+    private:
+
+        static constexpr std::size_t capacity   = 64;
+        static constexpr std::size_t maxEntries = 48; // Keep probe sequences short
+        static constexpr std::size_t indexMask  = capacity - 1;
+
+        struct Entry
+        {
+            std::uint64_t   formatHash          = 0;
+            GLuint          vao                 = 0; // Zero for empty slots.
+            std::uint64_t   lastUse             = 0;
+            std::uint64_t   boundBindingSetID   = 0;
+        };
+
+    private:
+
+        // Returns the entry for the specified vertex format and creates its VAO on demand.
+        Entry& FindOrCreateEntry(GLStateManager& stateMngr, const ArrayView<GLVertexAttribute>& attributes, std::uint64_t formatHash);
+
+        // Deletes the VAO of the least recently used entry and removes it from the hash map.
+        void EvictLeastRecentlyUsed(GLStateManager& stateMngr);
+
+    private:
+
+        Entry           entries_[capacity];
+        std::size_t     numEntries_ = 0;
+        std::uint64_t   useCounter_ = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -41,17 +41,32 @@ void GLVertexArrayObject::BuildVertexLayout(const ArrayView<GLVertexAttribute>&
 
     LLGL_ASSERT_GL_EXT(ARB_vertex_array_object);
 
-    /* Generate a VAO if not already done */
-    if (id_ == 0)
-        glGenVertexArrays(1, &id_);
-
-    /* Build vertex attributes for this VAO */
-    GLStateManager::Get().BindVertexArray(id_);
+    #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+    if (HasExtension(GLExt::ARB_direct_state_access))
     {
+        /* Create a VAO if not already done */
+        if (id_ == 0)
+            glCreateVertexArrays(1, &id_);
+
+        /* Build vertex attributes for this VAO without binding it or any vertex buffer */
         for (const GLVertexAttribute& attrib : attributes)
-            BuildVertexAttribute(attrib);
+            BuildVertexAttributeDSA(attrib);
+    }
+    else
+    #endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+    {
+        /* Generate a VAO if not already done */
+        if (id_ == 0)
+            glGenVertexArrays(1, &id_);
+
+        /* Build vertex attributes for this VAO */
+        GLStateManager::Get().BindVertexArray(id_);
+        {
+            for (const GLVertexAttribute& attrib : attributes)
+                BuildVertexAttribute(attrib);
+        }
+        GLStateManager::Get().BindVertexArray(0);
     }
-    GLStateManager::Get().BindVertexArray(0);
 
     #else // LLGL_GLEXT_VERTEX_ARRAY_OBJECT
 
@@ -105,6 +120,27 @@ void GLVertexArrayObject::BuildVertexAttribute(const GLVertexAttribute& attribut
     #endif // /LLGL_GLEXT_VERTEX_ARRAY_OBJECT
 }
 
+#if LLGL_GLEXT_DIRECT_STATE_ACCESS
+
+void GLVertexArrayObject::BuildVertexAttributeDSA(const GLVertexAttribute& attribute)
+{
+    /* Use one vertex buffer binding point per attribute, so the attribute offset can be passed as buffer offset */
+    const GLuint bindingIndex = attribute.index;
+
+    glEnableVertexArrayAttrib(id_, attribute.index);
+    glVertexArrayVertexBuffer(id_, bindingIndex, attribute.buffer, static_cast<GLintptr>(attribute.offsetPtrSized), attribute.stride);
+    glVertexArrayBindingDivisor(id_, bindingIndex, attribute.divisor);
+
+    if (attribute.isInteger)
+        glVertexArrayAttribIFormat(id_, attribute.index, attribute.size, attribute.type, 0);
+    else
+        glVertexArrayAttribFormat(id_, attribute.index, attribute.size, attribute.type, attribute.normalized, 0);
+
+    glVertexArrayAttribBinding(id_, attribute.index, bindingIndex);
+}
+
+#endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+
 
 } // /namespace LLGL
 
@@ -41,6 +41,9 @@ class GLVertexArrayObject
     private:
 
         void BuildVertexAttribute(const GLVertexAttribute& attribute);
+        #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+        void BuildVertexAttributeDSA(const GLVertexAttribute& attribute);
+        #endif
 
     private:
 
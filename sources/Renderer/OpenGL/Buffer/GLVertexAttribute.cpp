@@ -28,13 +28,16 @@ void GLConvertVertexAttrib(GLVertexAttribute& dst, const VertexAttribute& src, G
             LLGL_TRAP("unknown format cannot be used for vertex attributes");
     }
 
-    /* Convert offset to pointer sized type (for 32- and 64 bit builds) */
+    /*
+    Convert offset to pointer sized type (for 32- and 64 bit builds).
+    Tightly packed vertices get an explicit stride, since glVertexArrayVertexBuffer does not interpret a zero stride as such.
+    */
     dst.buffer          = srcBuffer;
     dst.index           = static_cast<GLuint>(src.location);
     dst.size            = static_cast<GLint>(formatAttribs.components);
     dst.type            = GLTypes::Map(formatAttribs.dataType);
     dst.normalized      = GLBoolean((formatAttribs.flags & FormatFlags::IsNormalized) != 0);
-    dst.stride          = static_cast<GLsizei>(src.stride);
+    dst.stride          = static_cast<GLsizei>(src.stride > 0 ? src.stride : formatAttribs.bitSize / 8);
     dst.offsetPtrSized  = static_cast<GLsizeiptr>(src.offset);
     dst.divisor         = static_cast<GLuint>(src.instanceDivisor);
     dst.isInteger       = IsIntegerFormat(src.format);
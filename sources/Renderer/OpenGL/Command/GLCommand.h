@@ -29,6 +29,7 @@ class GLBufferWithXFB;
 class GLTexture;
 class GLResourceHeap;
 class GLPipelineState;
+class GLUniformBatch;
 class GLQueryHeap;
 class GLSwapChain;
 class GLRenderTarget;
@@ -184,6 +185,12 @@ struct GLCmdResolveRenderTarget
     GLRenderTarget* renderTarget;
 };
 
+struct GLCmdInvalidateAttachments
+{
+    const GLRenderPass* renderPass;
+    GLRenderTarget*     renderTarget; // Null for the default framebuffer
+};
+
 struct GLCmdBindVertexArray
 {
     GLSharedContextVertexArray* vertexArray;
@@ -210,6 +217,15 @@ struct GLCmdBindBuffersBase
 //  GLuint          buffer[count];
 };
 
+struct GLCmdBindBufferRange
+{
+    GLBufferTarget  target;
+    GLuint          index;
+    GLuint          id;
+    GLintptr        offset;
+    GLsizeiptr      size;
+};
+
 struct GLCmdBeginBufferXfb
 {
     GLBufferWithXFB*    bufferWithXfb;
@@ -230,6 +246,14 @@ struct GLCmdBeginTransformFeedbackNV
 
 //struct GLCmdEndTransformFeedbackNV {};
 
+struct GLCmdBindBufferDynamic
+{
+    const GLPipelineState*  pipelineState;
+    GLBuffer*               buffer;
+    std::uint32_t           descriptor;
+    GLuint                  slot;
+};
+
 struct GLCmdBindResourceHeap
 {
     GLResourceHeap*                     resourceHeap;
@@ -258,14 +282,10 @@ struct GLCmdSetStencilRef
     GLenum  face;
 };
 
-struct GLCmdSetUniform
+struct GLCmdSetUniforms
 {
-    GLuint      program;
-    UniformType type;
-    GLint       location;
-    GLsizei     count;
-    GLsizeiptr  size;
-//  GLuint      buffer[size];
+    const GLUniformBatch*   batch;
+    std::uint32_t           index;
 };
 
 struct GLCmdBeginQuery
@@ -276,7 +296,17 @@ struct GLCmdBeginQuery
 
 struct GLCmdEndQuery
 {
-    GLQueryHeap* queryHeap;
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   query;
+};
+
+struct GLCmdResolveQueryData
+{
+    GLQueryHeap*    queryHeap;
+    std::uint32_t   firstQuery;
+    std::uint32_t   numQueries;
+    GLuint          bufferID;
+    GLintptr        offset;
 };
 
 struct GLCmdBeginConditionalRender
@@ -396,6 +426,40 @@ struct GLCmdMultiDrawElementsIndirect
     GLsizei         stride;
 };
 
+struct GLCmdMultiDrawArraysIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+struct GLCmdMultiDrawElementsIndirectCount
+{
+    GLuint          id;
+    GLuint          countId;
+    GLenum          mode;
+    GLenum          type;
+    const GLvoid*   indirect;
+    GLintptr        drawcount;
+    GLsizei         maxdrawcount;
+    GLsizei         stride;
+};
+
+// Only generated by OptimizeGLVirtualCommandBuffer() for adjacent GLOpcodeDrawElements and GLOpcodeDrawElementsBaseVertex commands.
+struct GLCmdMultiDrawElementsBaseVertex
+{
+    GLenum          mode;
+    GLenum          type;
+    GLsizeiptr      drawcount;
+//  const GLvoid*   indices[drawcount];
+//  GLsizei         counts[drawcount];
+//  GLint           basevertices[drawcount];
+};
+
 struct GLCmdDrawTransformFeedback
 {
     GLenum  mode;
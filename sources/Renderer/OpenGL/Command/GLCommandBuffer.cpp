@@ -25,6 +25,7 @@ void GLCommandBuffer::ResetRenderState()
     renderState_.boundPipelineLayout    = nullptr;
     renderState_.boundPipelineState     = nullptr;
     renderState_.boundBufferWithFxb     = nullptr;
+    renderState_.boundComputeSOBuffer   = nullptr;
 }
 
 void GLCommandBuffer::SetIndexFormat(bool indexType16Bits, std::uint64_t offset)
@@ -52,7 +53,7 @@ void GLCommandBuffer::SetPipelineRenderState(const GLPipelineState& pipelineStat
     /* Store draw and primitive mode */
     if (pipelineStateGL.IsGraphicsPSO())
     {
-        auto& graphicsPSO = LLGL_CAST(const GLGraphicsPSO&, pipelineStateGL);
+        auto& graphicsPSO = LLGL_HOT_CAST(const GLGraphicsPSO&, pipelineStateGL);
         renderState_.drawMode       = graphicsPSO.GetDrawMode();
         renderState_.primitiveMode  = graphicsPSO.GetPrimitiveMode();
     }
@@ -67,6 +68,11 @@ void GLCommandBuffer::SetTransformFeedback(GLBufferWithXFB& bufferWithXfbGL)
     renderState_.boundBufferWithFxb = &bufferWithXfbGL;
 }
 
+void GLCommandBuffer::SetComputeStreamOutputBuffer(GLBuffer* bufferGL)
+{
+    renderState_.boundComputeSOBuffer = bufferGL;
+}
+
 void GLCommandBuffer::InvalidateMemoryBarriers(GLbitfield barriers)
 {
     renderState_.dirtyBarriers |= (renderState_.implicitBarriers & barriers);
@@ -90,7 +96,7 @@ void GLCommandBuffer::InvalidateMemoryBarriersForResources(
     {
         if (buffers[i] != nullptr)
         {
-            auto* bufferGL = LLGL_CAST(GLBuffer*, buffers[i]);
+            auto* bufferGL = LLGL_HOT_CAST(GLBuffer*, buffers[i]);
             if ((bufferGL->GetBindFlags() & BindFlags::Storage) != 0)
             {
                 renderState_.dirtyBarriers |= GL_SHADER_STORAGE_BARRIER_BIT;
@@ -98,6 +104,8 @@ void GLCommandBuffer::InvalidateMemoryBarriersForResources(
                     renderState_.dirtyBarriers |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
                 if ((bufferGL->GetBindFlags() & BindFlags::IndexBuffer) != 0)
                     renderState_.dirtyBarriers |= GL_ELEMENT_ARRAY_BARRIER_BIT;
+                if ((bufferGL->GetBindFlags() & BindFlags::IndirectBuffer) != 0)
+                    renderState_.dirtyBarriers |= GL_COMMAND_BARRIER_BIT;
             }
         }
     }
@@ -106,7 +114,7 @@ void GLCommandBuffer::InvalidateMemoryBarriersForResources(
     {
         if (textures[i] != nullptr)
         {
-            auto* textureGL = LLGL_CAST(GLTexture*, textures[i]);
+            auto* textureGL = LLGL_HOT_CAST(GLTexture*, textures[i]);
             if ((textureGL->GetBindFlags() & BindFlags::Storage) != 0)
             {
                 renderState_.dirtyBarriers |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
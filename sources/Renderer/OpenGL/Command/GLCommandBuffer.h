@@ -49,6 +49,9 @@ class GLCommandBuffer : public CommandBuffer
         // Sets the transform-feedback object for the next DrawStreamOutput() invocation.
         void SetTransformFeedback(GLBufferWithXFB& bufferWithXfbGL);
 
+        // Sets the vertex buffer with BindFlags::ComputeStreamOutput for the next DrawStreamOutput() invocation. Null resets it.
+        void SetComputeStreamOutputBuffer(GLBuffer* bufferGL);
+
         // Invalidates the specified memory barrier bits.
         void InvalidateMemoryBarriers(GLbitfield barriers);
         void InvalidateMemoryBarriersForStorageResource(long resourceBindFlags, GLbitfield barriers);
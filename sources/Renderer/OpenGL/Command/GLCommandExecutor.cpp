@@ -15,6 +15,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
+#include "../../ProfileCounters.h"
 #include "../../../Core/Assertion.h"
 
 #include "../Shader/GLShaderProgram.h"
@@ -40,12 +41,31 @@
 #include <string.h>
 
 #include <LLGL/Backend/OpenGL/NativeCommand.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
 {
 
 
+// Binds a buffer whose shader interface was not known while the command was recorded, i.e. SSBO, sampler buffer, or image buffer
+static void BindGLBufferDynamic(const GLCmdBindBufferDynamic& cmd, GLStateManager& stateMngr)
+{
+    const GLShaderBufferInterfaceMap* bufferInterfaceMap = cmd.pipelineState->GetBufferInterfaceMap();
+    switch (bufferInterfaceMap->GetDynamicInterfaces()[cmd.descriptor])
+    {
+        case GLBufferInterface_SSBO:
+            stateMngr.BindBufferBase(GLBufferTarget::ShaderStorageBuffer, cmd.slot, cmd.buffer->GetID());
+            break;
+        case GLBufferInterface_Sampler:
+            stateMngr.BindTexture(cmd.slot, GLTextureTarget::TextureBuffer, cmd.buffer->GetTexID());
+            break;
+        case GLBufferInterface_Image:
+            stateMngr.BindImageTexture(cmd.slot, 0, cmd.buffer->GetTexGLInternalFormat(), cmd.buffer->GetTexID());
+            break;
+    }
+}
+
 static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLStateManager*& stateMngr)
 {
     switch (opcode)
@@ -195,6 +215,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             cmd->renderTarget->ResolveMultisampled(*stateMngr);
             return sizeof(*cmd);
         }
+        case GLOpcodeInvalidateAttachments:
+        {
+            auto cmd = static_cast<const GLCmdInvalidateAttachments*>(pc);
+            stateMngr->InvalidateAttachmentsWithRenderPass(*(cmd->renderPass), cmd->renderTarget);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindVertexArray:
         {
             auto cmd = static_cast<const GLCmdBindVertexArray*>(pc);
@@ -219,6 +245,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->BindBuffersBase(cmd->target, cmd->first, cmd->count, reinterpret_cast<const GLuint*>(cmd + 1));
             return (sizeof(*cmd) + sizeof(GLuint)*cmd->count);
         }
+        case GLOpcodeBindBufferRange:
+        {
+            auto cmd = static_cast<const GLCmdBindBufferRange*>(pc);
+            stateMngr->BindBufferRange(cmd->target, cmd->index, cmd->id, cmd->offset, cmd->size);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBeginBufferXfb:
         {
             auto cmd = static_cast<const GLCmdBeginBufferXfb*>(pc);
@@ -264,6 +296,12 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return 0;
         }
+        case GLOpcodeBindBufferDynamic:
+        {
+            auto cmd = static_cast<const GLCmdBindBufferDynamic*>(pc);
+            BindGLBufferDynamic(*cmd, *stateMngr);
+            return sizeof(*cmd);
+        }
         case GLOpcodeBindResourceHeap:
         {
             auto cmd = static_cast<const GLCmdBindResourceHeap*>(pc);
@@ -296,11 +334,11 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             stateMngr->SetStencilRef(cmd->ref, cmd->face);
             return sizeof(*cmd);
         }
-        case GLOpcodeSetUniform:
+        case GLOpcodeSetUniforms:
         {
-            auto cmd = static_cast<const GLCmdSetUniform*>(pc);
-            GLSetUniform(cmd->type, cmd->location, cmd->count, (cmd + 1));
-            return (sizeof(*cmd) + cmd->size);
+            auto cmd = static_cast<const GLCmdSetUniforms*>(pc);
+            cmd->batch->Apply(cmd->index, *stateMngr);
+            return sizeof(*cmd);
         }
         case GLOpcodeBeginQuery:
         {
@@ -311,7 +349,14 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         case GLOpcodeEndQuery:
         {
             auto cmd = static_cast<const GLCmdEndQuery*>(pc);
-            cmd->queryHeap->End();
+            cmd->queryHeap->End(cmd->query);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeResolveQueryData:
+        {
+            auto cmd = static_cast<const GLCmdResolveQueryData*>(pc);
+            stateMngr->BindBuffer(GLBufferTarget::QueryBuffer, cmd->bufferID);
+            cmd->queryHeap->WriteResultsToBuffer(cmd->firstQuery, cmd->numQueries, cmd->offset);
             return sizeof(*cmd);
         }
         case GLOpcodeBeginConditionalRender:
@@ -435,6 +480,37 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
             #endif
             return sizeof(*cmd);
         }
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            #if LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawArraysIndirectCount(cmd->mode, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            #if LLGL_GLEXT_INDIRECT_PARAMETERS
+            stateMngr->BindBuffer(GLBufferTarget::DrawIndirectBuffer, cmd->id);
+            stateMngr->BindBuffer(GLBufferTarget::ParameterBuffer, cmd->countId);
+            glMultiDrawElementsIndirectCount(cmd->mode, cmd->type, cmd->indirect, cmd->drawcount, cmd->maxdrawcount, cmd->stride);
+            #endif
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc);
+            #if LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+            auto indices        = reinterpret_cast<const GLvoid* const*>(cmd + 1);
+            auto counts         = reinterpret_cast<const GLsizei*>(indices + cmd->drawcount);
+            auto basevertices   = reinterpret_cast<const GLint*>(counts + cmd->drawcount);
+            glMultiDrawElementsBaseVertex(cmd->mode, counts, cmd->type, indices, static_cast<GLsizei>(cmd->drawcount), basevertices);
+            #endif
+            return (sizeof(*cmd) + (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint)) * cmd->drawcount);
+        }
         case GLOpcodeDrawTransformFeedback:
         {
             auto cmd = static_cast<const GLCmdDrawTransformFeedback*>(pc);
@@ -501,6 +577,7 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         {
             auto cmd = static_cast<const GLCmdMemoryBarrier*>(pc);
             glMemoryBarrier(cmd->barriers);
+            LLGL_PROFILE_COUNTER_ADD(barriers, 1);
             return sizeof(*cmd);
         }
         #endif
@@ -508,7 +585,9 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
         {
             auto cmd = static_cast<const GLCmdPushDebugGroup*>(pc);
             #ifdef LLGL_GLEXT_DEBUG
-            glPushDebugGroup(cmd->source, cmd->id, cmd->length, reinterpret_cast<const GLchar*>(cmd + 1));
+            /* Crop debug group name here, since limits are not available while the command buffer is recorded */
+            const GLsizei length = std::min(cmd->length, static_cast<GLsizei>(stateMngr->GetLimits().maxDebugNameLength));
+            glPushDebugGroup(cmd->source, cmd->id, length, reinterpret_cast<const GLchar*>(cmd + 1));
             #endif
             return (sizeof(*cmd) + cmd->length + 1);
         }
@@ -524,15 +603,28 @@ static std::size_t ExecuteGLCommand(const GLOpcode opcode, const void* pc, GLSta
     }
 }
 
-static void ExecuteGLCommandsEmulated(const GLVirtualCommandBuffer& virtualCmdBuffer, GLStateManager* stateMngr)
+static void ExecuteGLCommandsEmulated(const GLVirtualCommandBuffer& virtualCmdBuffer, GLStateManager*& stateMngr)
 {
     virtualCmdBuffer.Run(ExecuteGLCommand, stateMngr);
 }
 
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
 {
-    /* Emulate execution of GL commands */
-    ExecuteGLCommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), &stateMngr);
+    /* Upload batched uniforms once before emulating execution of GL commands */
+    cmdBuffer.FlushUniformBatch(stateMngr);
+    GLStateManager* activeStateMngr = &stateMngr;
+    ExecuteGLCommandsEmulated(cmdBuffer.GetVirtualCommandBuffer(), activeStateMngr);
+}
+
+void ExecuteGLDeferredCommandBuffers(std::uint32_t numCmdBuffers, const GLDeferredCommandBuffer* const * cmdBuffers, GLStateManager& stateMngr)
+{
+    /* Emulate execution of GL commands and keep the active state manager across command buffer boundaries */
+    GLStateManager* activeStateMngr = &stateMngr;
+    for_range(i, numCmdBuffers)
+    {
+        cmdBuffers[i]->FlushUniformBatch(*activeStateMngr);
+        ExecuteGLCommandsEmulated(cmdBuffers[i]->GetVirtualCommandBuffer(), activeStateMngr);
+    }
 }
 
 void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdBuffer, GLStateManager& stateMngr)
@@ -9,6 +9,9 @@
 #define LLGL_GL_COMMAND_EXECUTOR_H
 
 
+#include <cstdint>
+
+
 namespace LLGL
 {
 
@@ -26,6 +29,12 @@ GL render states are tracked with the specified state manager.
 void ExecuteGLDeferredCommandBuffer(const GLDeferredCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
 void ExecuteGLCommandBuffer(const GLCommandBuffer& cmdbuffer, GLStateManager& stateMngr);
 
+/*
+Executes all GL commands of the specified deferred command buffers back to back.
+The state manager that is active at the end of one command buffer is carried over to the next one, i.e. all command buffers share a single pass over the state cache.
+*/
+void ExecuteGLDeferredCommandBuffers(std::uint32_t numCmdBuffers, const GLDeferredCommandBuffer* const * cmdBuffers, GLStateManager& stateMngr);
+
 // Executes the specified native GL command.
 void ExecuteNativeGLCommand(const OpenGL::NativeCommand& cmd, GLStateManager& stateMngr);
 
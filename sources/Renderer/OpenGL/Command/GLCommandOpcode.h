@@ -40,24 +40,28 @@ enum GLOpcode : std::uint8_t
     GLOpcodeClearAttachmentsWithRenderPass,
     GLOpcodeClearBuffers,
     GLOpcodeResolveRenderTarget,
+    GLOpcodeInvalidateAttachments,
     GLOpcodeBindVertexArray,
     GLOpcodeBindElementArrayBufferToVAO,
     GLOpcodeBindBufferBase,
     GLOpcodeBindBuffersBase,
+    GLOpcodeBindBufferRange,
     GLOpcodeBeginBufferXfb,
     GLOpcodeEndBufferXfb,
     GLOpcodeBeginTransformFeedback,
     GLOpcodeBeginTransformFeedbackNV,
     GLOpcodeEndTransformFeedback,
     GLOpcodeEndTransformFeedbackNV,
+    GLOpcodeBindBufferDynamic,
     GLOpcodeBindResourceHeap,
     GLOpcodeBindRenderTarget,
     GLOpcodeBindPipelineState,
     GLOpcodeSetBlendColor,
     GLOpcodeSetStencilRef,
-    GLOpcodeSetUniform,
+    GLOpcodeSetUniforms,
     GLOpcodeBeginQuery,
     GLOpcodeEndQuery,
+    GLOpcodeResolveQueryData,
     GLOpcodeBeginConditionalRender,
     GLOpcodeEndConditionalRender,
     GLOpcodeDrawArrays,
@@ -74,6 +78,9 @@ enum GLOpcode : std::uint8_t
     GLOpcodeDrawEmulatedTransformFeedback,
     GLOpcodeMultiDrawArraysIndirect,
     GLOpcodeMultiDrawElementsIndirect,
+    GLOpcodeMultiDrawArraysIndirectCount,
+    GLOpcodeMultiDrawElementsIndirectCount,
+    GLOpcodeMultiDrawElementsBaseVertex,
     GLOpcodeDispatchCompute,
     GLOpcodeDispatchComputeIndirect,
     GLOpcodeBindTexture,
@@ -0,0 +1,927 @@
+/*
+ * GLCommandOptimizer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLCommandOptimizer.h"
+#include "GLCommand.h"
+
+#include "../OpenGL.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../CheckedCast.h"
+
+#include "../Texture/GLTexture.h"
+
+#include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLGraphicsPSO.h"
+#include "../RenderState/GLPipelineLayout.h"
+
+#include <LLGL/Utils/ForRange.h>
+#include <map>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// Categories of GL states that are tracked to detect redundant commands.
+enum GLTrackedState
+{
+    GLTrackedStatePipeline = 0,
+    GLTrackedStateVertexArray,
+    GLTrackedStateElementArray,
+    GLTrackedStateBuffer,
+    GLTrackedStateResourceHeap,
+    GLTrackedStateTexture,
+    GLTrackedStateImage,
+    GLTrackedStateSampler,
+    GLTrackedStateViewport,
+    GLTrackedStateScissor,
+    GLTrackedStateRaster,
+
+    GLTrackedStateCount,
+};
+
+static constexpr std::uint32_t GetTrackedStateBit(GLTrackedState state)
+{
+    return (1u << static_cast<std::uint32_t>(state));
+}
+
+static constexpr std::uint32_t g_allTrackedStates = ((1u << GLTrackedStateCount) - 1u);
+
+// Normalized field values of a tracked command.
+// Commands are compared by these values instead of their raw memory, so padding bytes within the recorded commands don't matter.
+struct GLTrackedStateValue
+{
+    GLOpcode        opcode;
+    std::uint64_t   fields[4];
+};
+
+static bool operator == (const GLTrackedStateValue& lhs, const GLTrackedStateValue& rhs)
+{
+    return (lhs.opcode == rhs.opcode && ::memcmp(lhs.fields, rhs.fields, sizeof(lhs.fields)) == 0);
+}
+
+static GLTrackedStateValue MakeTrackedStateValue(GLOpcode opcode, std::uint64_t f0, std::uint64_t f1 = 0, std::uint64_t f2 = 0, std::uint64_t f3 = 0)
+{
+    GLTrackedStateValue value;
+    {
+        value.opcode    = opcode;
+        value.fields[0] = f0;
+        value.fields[1] = f1;
+        value.fields[2] = f2;
+        value.fields[3] = f3;
+    }
+    return value;
+}
+
+// Only for commands without padding bytes, e.g. GLCmdViewport.
+template <typename TCommand>
+GLTrackedStateValue MakeTrackedStateValueFromMemory(GLOpcode opcode, const TCommand& cmd)
+{
+    static_assert(sizeof(TCommand) <= sizeof(GLTrackedStateValue::fields), "GL command too large to be tracked by memory");
+    GLTrackedStateValue value = MakeTrackedStateValue(opcode, 0);
+    ::memcpy(value.fields, &cmd, sizeof(TCommand));
+    return value;
+}
+
+static std::uint64_t PtrToField(const void* ptr)
+{
+    return static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(ptr));
+}
+
+/*
+Single pass over a recorded GL command stream.
+Each tracked command is keyed by its state category and slot, e.g. the texture layer, and stores the sequence number of when it was written.
+A command is redundant if the same value has already been written to its slot and neither its slot nor any other state this command writes
+has been modified since. Commands that write an entire state category, such as resource heaps, invalidate all slots of that category.
+*/
+class GLCommandOptimizer
+{
+
+    public:
+
+        GLCommandOptimizer(GLVirtualCommandBuffer& dstBuffer);
+
+        // Processes the specified command and returns its size (in bytes) within the source buffer.
+        std::size_t ProcessCommand(const GLOpcode opcode, const void* pc);
+
+        // Writes the pending batch of indexed draw commands into the output buffer.
+        void FlushDrawElementsBatch();
+
+        // Returns true if any command has been removed, merged, or replaced.
+        inline bool IsModified() const
+        {
+            return modified_;
+        }
+
+    private:
+
+        struct TrackedEntry
+        {
+            GLTrackedStateValue value;
+            std::uint64_t       seq;
+        };
+
+    private:
+
+        // Copies the specified command and its payload into the output buffer.
+        template <typename TCommand>
+        void CopyCommand(const GLOpcode opcode, const TCommand& cmd, std::size_t payloadSize = 0);
+
+        // Copies the specified opcode without payload into the output buffer.
+        void CopyOpcode(const GLOpcode opcode);
+
+        // Copies the specified command into the output buffer unless it is redundant.
+        template <typename TCommand>
+        void CopyTrackedCommand(
+            const GLOpcode              opcode,
+            const TCommand&             cmd,
+            GLTrackedState              state,
+            std::uint32_t               slot,
+            const GLTrackedStateValue&  value,
+            std::uint32_t               writeMask = 0
+        );
+
+        // Copies the specified bulk-write command into the output buffer and invalidates all slots of the specified states.
+        template <typename TCommand>
+        void CopyBulkCommand(const GLOpcode opcode, const TCommand& cmd, std::size_t payloadSize, std::uint32_t writeMask);
+
+        // Adds the specified indexed draw command to the pending batch. Returns false if the command cannot be merged.
+        bool AppendDrawElements(const GLOpcode opcode, GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLint basevertex);
+
+        // Invalidates all slots of the specified states.
+        void InvalidateStates(std::uint32_t writeMask);
+
+        // Returns the specified state mask plus all states that are implicitly modified along with them.
+        std::uint32_t GetCoupledStates(std::uint32_t writeMask) const;
+
+        // Returns the mask of states that are overridden each time the specified PSO is bound.
+        std::uint32_t GetPipelineStateWriteMask(const GLPipelineState& pipelineState) const;
+
+    private:
+
+        GLVirtualCommandBuffer&                 dstBuffer_;
+        const bool                              hasNativeSamplers_      = false;
+        bool                                    canMergeDrawElements_   = false;
+        bool                                    modified_               = false;
+
+        std::map<std::uint64_t, TrackedEntry>   entries_;
+        std::uint64_t                           seq_                    = 0;
+        std::uint64_t                           anySeq_[GLTrackedStateCount];
+        std::uint64_t                           bulkSeq_[GLTrackedStateCount];
+
+        GLOpcode                                batchOpcode_            = GLOpcodeDrawElements;
+        GLenum                                  batchMode_              = 0;
+        GLenum                                  batchType_              = 0;
+        std::vector<const GLvoid*>              batchIndices_;
+        std::vector<GLsizei>                    batchCounts_;
+        std::vector<GLint>                      batchBaseVertices_;
+
+};
+
+GLCommandOptimizer::GLCommandOptimizer(GLVirtualCommandBuffer& dstBuffer) :
+    dstBuffer_          { dstBuffer           },
+    hasNativeSamplers_  { HasNativeSamplers() }
+{
+    #if LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX
+    canMergeDrawElements_ = HasExtension(GLExt::ARB_draw_elements_base_vertex);
+    #endif
+    for_range(i, GLTrackedStateCount)
+    {
+        anySeq_[i]  = 0;
+        bulkSeq_[i] = 0;
+    }
+}
+
+std::size_t GLCommandOptimizer::ProcessCommand(const GLOpcode opcode, const void* pc)
+{
+    switch (opcode)
+    {
+        case GLOpcodeBufferSubData:
+        {
+            /* Buffer commands may bind their buffer to its native target, which can modify the element array of the bound VAO */
+            auto cmd = static_cast<const GLCmdBufferSubData*>(pc);
+            CopyBulkCommand(opcode, *cmd, static_cast<std::size_t>(cmd->size), GetTrackedStateBit(GLTrackedStateVertexArray) | GetTrackedStateBit(GLTrackedStateElementArray));
+            return (sizeof(*cmd) + cmd->size);
+        }
+        case GLOpcodeCopyBufferSubData:
+        {
+            auto cmd = static_cast<const GLCmdCopyBufferSubData*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, GetTrackedStateBit(GLTrackedStateVertexArray) | GetTrackedStateBit(GLTrackedStateElementArray));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeClearBufferData:
+        {
+            auto cmd = static_cast<const GLCmdClearBufferData*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, GetTrackedStateBit(GLTrackedStateVertexArray) | GetTrackedStateBit(GLTrackedStateElementArray));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeClearBufferSubData:
+        {
+            auto cmd = static_cast<const GLCmdClearBufferSubData*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, GetTrackedStateBit(GLTrackedStateVertexArray) | GetTrackedStateBit(GLTrackedStateElementArray));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeCopyImageSubData:
+        {
+            /* Texture commands may bind intermediate textures and framebuffers, so all tracked states are invalidated */
+            auto cmd = static_cast<const GLCmdCopyImageSubData*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeCopyImageToBuffer:
+        case GLOpcodeCopyImageFromBuffer:
+        {
+            auto cmd = static_cast<const GLCmdCopyImageBuffer*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeCopyFramebufferSubData:
+        {
+            auto cmd = static_cast<const GLCmdCopyFramebufferSubData*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeGenerateMipmap:
+        {
+            auto cmd = static_cast<const GLCmdGenerateMipmap*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeGenerateMipmapSubresource:
+        {
+            auto cmd = static_cast<const GLCmdGenerateMipmapSubresource*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeExecute:
+        {
+            /* Secondary command buffers can leave any state behind */
+            auto cmd = static_cast<const GLCmdExecute*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeViewport:
+        {
+            auto cmd = static_cast<const GLCmdViewport*>(pc);
+            CopyTrackedCommand(opcode, *cmd, GLTrackedStateViewport, 0, MakeTrackedStateValueFromMemory(opcode, *cmd));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeViewportArray:
+        {
+            auto cmd = static_cast<const GLCmdViewportArray*>(pc);
+            const std::size_t payloadSize = (sizeof(GLViewport) + sizeof(GLDepthRange)) * cmd->count;
+            CopyBulkCommand(opcode, *cmd, payloadSize, GetTrackedStateBit(GLTrackedStateViewport));
+            return (sizeof(*cmd) + payloadSize);
+        }
+        case GLOpcodeScissor:
+        {
+            auto cmd = static_cast<const GLCmdScissor*>(pc);
+            CopyTrackedCommand(opcode, *cmd, GLTrackedStateScissor, 0, MakeTrackedStateValueFromMemory(opcode, *cmd));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeScissorArray:
+        {
+            auto cmd = static_cast<const GLCmdScissorArray*>(pc);
+            const std::size_t payloadSize = sizeof(GLScissor) * cmd->count;
+            CopyBulkCommand(opcode, *cmd, payloadSize, GetTrackedStateBit(GLTrackedStateScissor));
+            return (sizeof(*cmd) + payloadSize);
+        }
+        case GLOpcodeClearColor:
+        {
+            auto cmd = static_cast<const GLCmdClearColor*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeClearDepth:
+        {
+            auto cmd = static_cast<const GLCmdClearDepth*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeClearStencil:
+        {
+            auto cmd = static_cast<const GLCmdClearStencil*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeClear:
+        {
+            /* Clear commands temporarily modify write masks and scissor states */
+            auto cmd = static_cast<const GLCmdClear*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeClearAttachmentsWithRenderPass:
+        {
+            auto cmd = static_cast<const GLCmdClearAttachmentsWithRenderPass*>(pc);
+            const std::size_t payloadSize = sizeof(ClearValue) * cmd->numClearValues;
+            CopyBulkCommand(opcode, *cmd, payloadSize, g_allTrackedStates);
+            return (sizeof(*cmd) + payloadSize);
+        }
+        case GLOpcodeClearBuffers:
+        {
+            auto cmd = static_cast<const GLCmdClearBuffers*>(pc);
+            const std::size_t payloadSize = sizeof(AttachmentClear) * cmd->numAttachments;
+            CopyBulkCommand(opcode, *cmd, payloadSize, g_allTrackedStates);
+            return (sizeof(*cmd) + payloadSize);
+        }
+        case GLOpcodeResolveRenderTarget:
+        {
+            auto cmd = static_cast<const GLCmdResolveRenderTarget*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeInvalidateAttachments:
+        {
+            /* Invalidation re-binds the draw framebuffer */
+            auto cmd = static_cast<const GLCmdInvalidateAttachments*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindVertexArray:
+        {
+            /* Binding a VAO also replaces the element array buffer binding */
+            auto cmd = static_cast<const GLCmdBindVertexArray*>(pc);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStateVertexArray, 0,
+                MakeTrackedStateValue(opcode, PtrToField(cmd->vertexArray)),
+                GetTrackedStateBit(GLTrackedStateElementArray)
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindElementArrayBufferToVAO:
+        {
+            auto cmd = static_cast<const GLCmdBindElementArrayBufferToVAO*>(pc);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStateElementArray, 0,
+                MakeTrackedStateValue(opcode, cmd->id, (cmd->indexType16Bits ? 1 : 0))
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindBufferBase:
+        {
+            auto cmd = static_cast<const GLCmdBindBufferBase*>(pc);
+            const std::uint32_t target = static_cast<std::uint32_t>(cmd->target);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStateBuffer, ((target << 24) | cmd->index),
+                MakeTrackedStateValue(opcode, target, cmd->index, cmd->id)
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindBuffersBase:
+        {
+            auto cmd = static_cast<const GLCmdBindBuffersBase*>(pc);
+            const std::size_t payloadSize = sizeof(GLuint) * cmd->count;
+            CopyBulkCommand(opcode, *cmd, payloadSize, GetTrackedStateBit(GLTrackedStateBuffer));
+            return (sizeof(*cmd) + payloadSize);
+        }
+        case GLOpcodeBindBufferRange:
+        {
+            /* Buffer ranges share the tracked binding point with <BindBufferBase>, but are only redundant if the same range is bound */
+            auto cmd = static_cast<const GLCmdBindBufferRange*>(pc);
+            const std::uint32_t target = static_cast<std::uint32_t>(cmd->target);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStateBuffer, ((target << 24) | cmd->index),
+                MakeTrackedStateValue(opcode, ((target << 24) | cmd->index), cmd->id, static_cast<std::uint64_t>(cmd->offset), static_cast<std::uint64_t>(cmd->size))
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBeginBufferXfb:
+        {
+            auto cmd = static_cast<const GLCmdBeginBufferXfb*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeEndBufferXfb:
+        case GLOpcodeEndTransformFeedback:
+        case GLOpcodeEndTransformFeedbackNV:
+        {
+            CopyOpcode(opcode);
+            InvalidateStates(g_allTrackedStates);
+            return 0;
+        }
+        case GLOpcodeBeginTransformFeedback:
+        {
+            auto cmd = static_cast<const GLCmdBeginTransformFeedback*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBeginTransformFeedbackNV:
+        {
+            auto cmd = static_cast<const GLCmdBeginTransformFeedbackNV*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindBufferDynamic:
+        {
+            /* Buffer can be bound as SSBO, sampler buffer, or image buffer, which is not known before execution */
+            auto cmd = static_cast<const GLCmdBindBufferDynamic*>(pc);
+            CopyBulkCommand(
+                opcode, *cmd, 0,
+                GetTrackedStateBit(GLTrackedStateBuffer)    |
+                GetTrackedStateBit(GLTrackedStateTexture)   |
+                GetTrackedStateBit(GLTrackedStateImage)
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindResourceHeap:
+        {
+            /* Resource heaps bind an unknown set of resource slots */
+            auto cmd = static_cast<const GLCmdBindResourceHeap*>(pc);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStateResourceHeap, cmd->descriptorSet,
+                MakeTrackedStateValue(opcode, PtrToField(cmd->resourceHeap), cmd->descriptorSet, PtrToField(cmd->bufferInterfaceMap)),
+                GetTrackedStateBit(GLTrackedStateBuffer)    |
+                GetTrackedStateBit(GLTrackedStateTexture)   |
+                GetTrackedStateBit(GLTrackedStateImage)     |
+                GetTrackedStateBit(GLTrackedStateSampler)
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindRenderTarget:
+        {
+            /* Binding a render target can switch the GL context and selects a different shader permutation for PSOs */
+            auto cmd = static_cast<const GLCmdBindRenderTarget*>(pc);
+            CopyBulkCommand(opcode, *cmd, 0, g_allTrackedStates);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindPipelineState:
+        {
+            auto cmd = static_cast<const GLCmdBindPipelineState*>(pc);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStatePipeline, 0,
+                MakeTrackedStateValue(opcode, PtrToField(cmd->pipelineState)),
+                GetPipelineStateWriteMask(*(cmd->pipelineState))
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeSetBlendColor:
+        {
+            auto cmd = static_cast<const GLCmdSetBlendColor*>(pc);
+            CopyTrackedCommand(opcode, *cmd, GLTrackedStateRaster, 0, MakeTrackedStateValueFromMemory(opcode, *cmd));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeSetStencilRef:
+        {
+            auto cmd = static_cast<const GLCmdSetStencilRef*>(pc);
+            CopyTrackedCommand(opcode, *cmd, GLTrackedStateRaster, 1, MakeTrackedStateValue(opcode, static_cast<std::uint32_t>(cmd->ref), cmd->face));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeSetUniforms:
+        {
+            auto cmd = static_cast<const GLCmdSetUniforms*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBeginQuery:
+        {
+            auto cmd = static_cast<const GLCmdBeginQuery*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeEndQuery:
+        {
+            auto cmd = static_cast<const GLCmdEndQuery*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeResolveQueryData:
+        {
+            auto cmd = static_cast<const GLCmdResolveQueryData*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBeginConditionalRender:
+        {
+            auto cmd = static_cast<const GLCmdBeginConditionalRender*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeEndConditionalRender:
+        case GLOpcodePopDebugGroup:
+        {
+            CopyOpcode(opcode);
+            return 0;
+        }
+        case GLOpcodeDrawArrays:
+        {
+            auto cmd = static_cast<const GLCmdDrawArrays*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawArraysInstanced:
+        {
+            auto cmd = static_cast<const GLCmdDrawArraysInstanced*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawArraysInstancedBaseInstance:
+        {
+            auto cmd = static_cast<const GLCmdDrawArraysInstancedBaseInstance*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawArraysIndirect:
+        {
+            auto cmd = static_cast<const GLCmdDrawArraysIndirect*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawElements:
+        {
+            auto cmd = static_cast<const GLCmdDrawElements*>(pc);
+            if (!AppendDrawElements(opcode, cmd->mode, cmd->count, cmd->type, cmd->indices, 0))
+                CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawElementsBaseVertex:
+        {
+            auto cmd = static_cast<const GLCmdDrawElementsBaseVertex*>(pc);
+            if (!AppendDrawElements(opcode, cmd->mode, cmd->count, cmd->type, cmd->indices, cmd->basevertex))
+                CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawElementsInstanced:
+        {
+            auto cmd = static_cast<const GLCmdDrawElementsInstanced*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawElementsInstancedBaseVertex:
+        {
+            auto cmd = static_cast<const GLCmdDrawElementsInstancedBaseVertex*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawElementsInstancedBaseVertexBaseInstance:
+        {
+            auto cmd = static_cast<const GLCmdDrawElementsInstancedBaseVertexBaseInstance*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawElementsIndirect:
+        {
+            auto cmd = static_cast<const GLCmdDrawElementsIndirect*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawTransformFeedback:
+        {
+            auto cmd = static_cast<const GLCmdDrawTransformFeedback*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDrawEmulatedTransformFeedback:
+        {
+            auto cmd = static_cast<const GLCmdDrawEmulatedTransformFeedback*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawArraysIndirect:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawArraysIndirect*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirect:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawElementsIndirect*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawArraysIndirectCount:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawArraysIndirectCount*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsIndirectCount:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawElementsIndirectCount*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMultiDrawElementsBaseVertex:
+        {
+            auto cmd = static_cast<const GLCmdMultiDrawElementsBaseVertex*>(pc);
+            const std::size_t payloadSize = (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint)) * static_cast<std::size_t>(cmd->drawcount);
+            CopyCommand(opcode, *cmd, payloadSize);
+            return (sizeof(*cmd) + payloadSize);
+        }
+        case GLOpcodeDispatchCompute:
+        {
+            auto cmd = static_cast<const GLCmdDispatchCompute*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeDispatchComputeIndirect:
+        {
+            auto cmd = static_cast<const GLCmdDispatchComputeIndirect*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindTexture:
+        {
+            auto cmd = static_cast<const GLCmdBindTexture*>(pc);
+            if (hasNativeSamplers_)
+            {
+                /* Resolve texture name and target, since GLStateManager::BindGLTexture() only needs the GLTexture object for emulated samplers */
+                GLCmdBindTextureNative cmdNative;
+                {
+                    cmdNative.slot      = cmd->slot;
+                    cmdNative.id        = cmd->texture->GetID();
+                    cmdNative.target    = GLStateManager::GetTextureTarget(cmd->texture->GetType());
+                }
+                modified_ = true;
+                CopyTrackedCommand(
+                    GLOpcodeBindTextureNative, cmdNative, GLTrackedStateTexture, cmdNative.slot,
+                    MakeTrackedStateValue(GLOpcodeBindTextureNative, cmdNative.id, static_cast<std::uint32_t>(cmdNative.target))
+                );
+            }
+            else
+            {
+                CopyTrackedCommand(
+                    opcode, *cmd, GLTrackedStateTexture, cmd->slot,
+                    MakeTrackedStateValue(opcode, PtrToField(cmd->texture))
+                );
+            }
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindTextureNative:
+        {
+            auto cmd = static_cast<const GLCmdBindTextureNative*>(pc);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStateTexture, cmd->slot,
+                MakeTrackedStateValue(opcode, cmd->id, static_cast<std::uint32_t>(cmd->target))
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindImageTexture:
+        {
+            auto cmd = static_cast<const GLCmdBindImageTexture*>(pc);
+            CopyTrackedCommand(
+                opcode, *cmd, GLTrackedStateImage, cmd->unit,
+                MakeTrackedStateValue(opcode, static_cast<std::uint32_t>(cmd->level), cmd->format, cmd->texture)
+            );
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindSampler:
+        {
+            auto cmd = static_cast<const GLCmdBindSampler*>(pc);
+            CopyTrackedCommand(opcode, *cmd, GLTrackedStateSampler, cmd->layer, MakeTrackedStateValue(opcode, cmd->sampler));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeBindEmulatedSampler:
+        {
+            auto cmd = static_cast<const GLCmdBindEmulatedSampler*>(pc);
+            CopyTrackedCommand(opcode, *cmd, GLTrackedStateSampler, cmd->layer, MakeTrackedStateValue(opcode, PtrToField(cmd->sampler)));
+            return sizeof(*cmd);
+        }
+        case GLOpcodeMemoryBarrier:
+        {
+            auto cmd = static_cast<const GLCmdMemoryBarrier*>(pc);
+            CopyCommand(opcode, *cmd);
+            return sizeof(*cmd);
+        }
+        case GLOpcodePushDebugGroup:
+        {
+            auto cmd = static_cast<const GLCmdPushDebugGroup*>(pc);
+            const std::size_t payloadSize = static_cast<std::size_t>(cmd->length) + 1;
+            CopyCommand(opcode, *cmd, payloadSize);
+            return (sizeof(*cmd) + payloadSize);
+        }
+    }
+    return 0;
+}
+
+void GLCommandOptimizer::FlushDrawElementsBatch()
+{
+    const std::size_t numDraws = batchCounts_.size();
+    if (numDraws == 0)
+        return;
+
+    if (numDraws == 1)
+    {
+        /* Write single draw command as it was recorded */
+        if (batchOpcode_ == GLOpcodeDrawElements)
+        {
+            auto cmd = dstBuffer_.AllocCommand<GLCmdDrawElements>(GLOpcodeDrawElements);
+            {
+                cmd->mode       = batchMode_;
+                cmd->count      = batchCounts_[0];
+                cmd->type       = batchType_;
+                cmd->indices    = batchIndices_[0];
+            }
+        }
+        else
+        {
+            auto cmd = dstBuffer_.AllocCommand<GLCmdDrawElementsBaseVertex>(GLOpcodeDrawElementsBaseVertex);
+            {
+                cmd->mode       = batchMode_;
+                cmd->count      = batchCounts_[0];
+                cmd->type       = batchType_;
+                cmd->indices    = batchIndices_[0];
+                cmd->basevertex = batchBaseVertices_[0];
+            }
+        }
+    }
+    else
+    {
+        /* Merge all draw commands into a single multi-draw command */
+        auto cmd = dstBuffer_.AllocCommand<GLCmdMultiDrawElementsBaseVertex>(
+            GLOpcodeMultiDrawElementsBaseVertex,
+            (sizeof(const GLvoid*) + sizeof(GLsizei) + sizeof(GLint)) * numDraws
+        );
+        {
+            cmd->mode       = batchMode_;
+            cmd->type       = batchType_;
+            cmd->drawcount  = static_cast<GLsizeiptr>(numDraws);
+        }
+        auto indices        = reinterpret_cast<const GLvoid**>(cmd + 1);
+        auto counts         = reinterpret_cast<GLsizei*>(indices + numDraws);
+        auto basevertices   = reinterpret_cast<GLint*>(counts + numDraws);
+        ::memcpy(indices, batchIndices_.data(), sizeof(const GLvoid*) * numDraws);
+        ::memcpy(counts, batchCounts_.data(), sizeof(GLsizei) * numDraws);
+        ::memcpy(basevertices, batchBaseVertices_.data(), sizeof(GLint) * numDraws);
+        modified_ = true;
+    }
+
+    batchIndices_.clear();
+    batchCounts_.clear();
+    batchBaseVertices_.clear();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+template <typename TCommand>
+void GLCommandOptimizer::CopyCommand(const GLOpcode opcode, const TCommand& cmd, std::size_t payloadSize)
+{
+    FlushDrawElementsBatch();
+    auto dstCmd = dstBuffer_.AllocCommand<TCommand>(opcode, payloadSize);
+    ::memcpy(dstCmd, &cmd, sizeof(TCommand) + payloadSize);
+}
+
+void GLCommandOptimizer::CopyOpcode(const GLOpcode opcode)
+{
+    FlushDrawElementsBatch();
+    dstBuffer_.AllocOpcode(opcode);
+}
+
+template <typename TCommand>
+void GLCommandOptimizer::CopyTrackedCommand(
+    const GLOpcode              opcode,
+    const TCommand&             cmd,
+    GLTrackedState              state,
+    std::uint32_t               slot,
+    const GLTrackedStateValue&  value,
+    std::uint32_t               writeMask)
+{
+    const std::uint64_t key = ((static_cast<std::uint64_t>(state) << 32) | slot);
+    writeMask = (GetCoupledStates(writeMask | GetTrackedStateBit(state)) & ~GetTrackedStateBit(state));
+
+    /* Check if the same value is still in effect from a previous command */
+    auto it = entries_.find(key);
+    if (it != entries_.end())
+    {
+        const TrackedEntry& entry = it->second;
+        if (entry.value == value && bulkSeq_[state] <= entry.seq)
+        {
+            bool isRedundant = true;
+            for_range(i, GLTrackedStateCount)
+            {
+                if ((writeMask & (1u << i)) != 0 && anySeq_[i] > entry.seq)
+                {
+                    isRedundant = false;
+                    break;
+                }
+            }
+            if (isRedundant)
+            {
+                modified_ = true;
+                return;
+            }
+        }
+    }
+
+    CopyCommand(opcode, cmd);
+
+    /* Invalidate other states that are written by this command and store new entry */
+    InvalidateStates(writeMask);
+    anySeq_[state] = seq_;
+    entries_[key] = TrackedEntry{ value, seq_ };
+}
+
+template <typename TCommand>
+void GLCommandOptimizer::CopyBulkCommand(const GLOpcode opcode, const TCommand& cmd, std::size_t payloadSize, std::uint32_t writeMask)
+{
+    CopyCommand(opcode, cmd, payloadSize);
+    InvalidateStates(GetCoupledStates(writeMask));
+}
+
+bool GLCommandOptimizer::AppendDrawElements(const GLOpcode opcode, GLenum mode, GLsizei count, GLenum type, const GLvoid* indices, GLint basevertex)
+{
+    if (!canMergeDrawElements_)
+        return false;
+
+    /* Only draw commands with the same primitive and index type can be merged */
+    if (!batchCounts_.empty() && (batchMode_ != mode || batchType_ != type))
+        FlushDrawElementsBatch();
+
+    if (batchCounts_.empty())
+    {
+        batchOpcode_    = opcode;
+        batchMode_      = mode;
+        batchType_      = type;
+    }
+
+    batchIndices_.push_back(indices);
+    batchCounts_.push_back(count);
+    batchBaseVertices_.push_back(basevertex);
+
+    return true;
+}
+
+void GLCommandOptimizer::InvalidateStates(std::uint32_t writeMask)
+{
+    ++seq_;
+    for_range(i, GLTrackedStateCount)
+    {
+        if ((writeMask & (1u << i)) != 0)
+        {
+            anySeq_[i]  = seq_;
+            bulkSeq_[i] = seq_;
+        }
+    }
+}
+
+std::uint32_t GLCommandOptimizer::GetCoupledStates(std::uint32_t writeMask) const
+{
+    /* Emulated samplers are applied as texture parameters, so texture and sampler bindings depend on each other */
+    const std::uint32_t textureAndSamplerBits = (GetTrackedStateBit(GLTrackedStateTexture) | GetTrackedStateBit(GLTrackedStateSampler));
+    if (!hasNativeSamplers_ && (writeMask & textureAndSamplerBits) != 0)
+        writeMask |= textureAndSamplerBits;
+    return writeMask;
+}
+
+std::uint32_t GLCommandOptimizer::GetPipelineStateWriteMask(const GLPipelineState& pipelineState) const
+{
+    std::uint32_t writeMask = 0;
+
+    if (pipelineState.IsGraphicsPSO())
+    {
+        /* Depth-stencil and blend states can reset the stencil reference and blend color */
+        writeMask |= GetTrackedStateBit(GLTrackedStateRaster);
+
+        auto& graphicsPSO = LLGL_CAST(const GLGraphicsPSO&, pipelineState);
+        if (graphicsPSO.HasStaticViewports())
+            writeMask |= GetTrackedStateBit(GLTrackedStateViewport);
+        if (graphicsPSO.HasStaticScissors())
+            writeMask |= GetTrackedStateBit(GLTrackedStateScissor);
+    }
+
+    if (const GLPipelineLayout* pipelineLayout = pipelineState.GetPipelineLayout())
+    {
+        if (!pipelineLayout->GetStaticSamplerSlots().empty())
+            writeMask |= GetTrackedStateBit(GLTrackedStateSampler);
+    }
+
+    return writeMask;
+}
+
+
+/*
+ * ======= Global functions: =======
+ */
+
+bool OptimizeGLVirtualCommandBuffer(const GLVirtualCommandBuffer& srcBuffer, GLVirtualCommandBuffer& dstBuffer)
+{
+    if (srcBuffer.Empty())
+        return false;
+
+    GLCommandOptimizer optimizer{ dstBuffer };
+    srcBuffer.Run(
+        [&optimizer](const GLOpcode opcode, const void* pc) -> std::size_t
+        {
+            return optimizer.ProcessCommand(opcode, pc);
+        }
+    );
+    optimizer.FlushDrawElementsBatch();
+
+    return optimizer.IsModified();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
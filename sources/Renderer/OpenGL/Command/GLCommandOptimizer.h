@@ -0,0 +1,35 @@
+/*
+ * GLCommandOptimizer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_COMMAND_OPTIMIZER_H
+#define LLGL_GL_COMMAND_OPTIMIZER_H
+
+
+#include "GLDeferredCommandBuffer.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Writes an optimized copy of all GL commands from 'srcBuffer' into 'dstBuffer'.
+Redundant state changes are removed, adjacent indexed draw commands with the same primitive and index type are merged into a single multi-draw command,
+and texture bindings are resolved to native GL texture names if samplers don't need to be emulated.
+Returns false if nothing could be optimized, in which case the content of 'dstBuffer' is undefined and must be discarded.
+*/
+bool OptimizeGLVirtualCommandBuffer(const GLVirtualCommandBuffer& srcBuffer, GLVirtualCommandBuffer& dstBuffer);
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -12,11 +12,15 @@
 #include "../RenderState/GLFence.h"
 #include "../RenderState/GLQueryHeap.h"
 #include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLWorkerFenceQueue.h"
+#include "../GLSwapChain.h"
 #include "../../CheckedCast.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include "../../FrameArena.h"
 #include <algorithm>
 #include <cstring>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 
 
 namespace LLGL
@@ -34,11 +38,61 @@ void GLCommandQueue::Submit(CommandBuffer& commandBuffer)
     auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, commandBuffer);
     if (!cmdBufferGL.IsImmediateCmdBuffer())
     {
+        /* Wait for resources that have been created on worker threads */
+        GLWorkerFenceQueue::Get().WaitOnServer();
         auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
         ExecuteGLDeferredCommandBuffer(deferredCmdBufferGL, GLStateManager::Get());
     }
 }
 
+void GLCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    /* Gather all deferred command buffers to execute them back to back with the same state manager */
+    FrameSmallVector<const GLDeferredCommandBuffer*> deferredCmdBuffersGL;
+    deferredCmdBuffersGL.reserve(numCommandBuffers);
+
+    for_range(i, numCommandBuffers)
+    {
+        if (commandBuffers[i] != nullptr)
+        {
+            auto* cmdBufferGL = LLGL_CAST(const GLCommandBuffer*, commandBuffers[i]);
+            if (!cmdBufferGL->IsImmediateCmdBuffer())
+                deferredCmdBuffersGL.push_back(LLGL_CAST(const GLDeferredCommandBuffer*, cmdBufferGL));
+        }
+    }
+
+    if (!deferredCmdBuffersGL.empty())
+    {
+        /* Wait for resources that have been created on worker threads */
+        GLWorkerFenceQueue::Get().WaitOnServer();
+        ExecuteGLDeferredCommandBuffers(static_cast<std::uint32_t>(deferredCmdBuffersGL.size()), deferredCmdBuffersGL.data(), GLStateManager::Get());
+    }
+}
+
+void GLCommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    /*
+    Swapping buffers does not require the GL context to be current, so no swap-chain is made current here.
+    Present the swap-chain whose GL context is current first, since only its default framebuffer can be invalidated and swapping its buffers flushes its context.
+    */
+    std::uint32_t currentIndex = numSwapChains;
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr && LLGL_CAST(GLSwapChain*, swapChains[i])->IsCurrent())
+        {
+            currentIndex = i;
+            swapChains[i]->Present();
+            break;
+        }
+    }
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] != nullptr && i != currentIndex)
+            swapChains[i]->Present();
+    }
+}
+
 /* ----- Queries ----- */
 
 static bool AreQueryResultsAvailable(GLQueryHeap& queryHeapGL, std::uint32_t firstQuery, std::uint32_t numQueries)
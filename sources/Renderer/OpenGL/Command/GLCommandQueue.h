@@ -26,6 +26,12 @@ class GLCommandQueue final : public CommandQueue
 
         #include <LLGL/Backend/CommandQueue.inl>
 
+    public:
+
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains) override;
+
 };
 
 
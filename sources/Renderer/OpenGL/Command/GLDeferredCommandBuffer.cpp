@@ -7,6 +7,7 @@
 
 #include "GLDeferredCommandBuffer.h"
 #include "GLCommand.h"
+#include "GLCommandOptimizer.h"
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
 
@@ -17,6 +18,8 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
+#include "../../CommandBufferUtils.h"
+#include "../../BufferUtils.h"
 #include "../../../Core/Assertion.h"
 
 #include "../Shader/GLShaderPipeline.h"
@@ -35,6 +38,7 @@
 #include "../RenderState/GLResourceHeap.h"
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
+#include "../../FrameArena.h"
 
 #include <algorithm>
 #include <string.h>
@@ -57,14 +61,30 @@ void GLDeferredCommandBuffer::Begin()
 {
     /* Reset internal command buffer */
     buffer_.Clear();
+    uniformBatch_.Clear();
     ResetRenderState();
+
+    isClearPending_     = false;
+    pendingRenderPass_  = nullptr;
+    pendingClearFlags_  = 0;
+
+    /* Recycle scratch memory of the previous recording on this thread */
+    FrameArena::Get().Reset();
 }
 
 void GLDeferredCommandBuffer::End()
 {
-    /* Pack virtual command buffer if it has to be traversed multiple times */
+    if (isClearPending_)
+        FlushPendingClears();
+
+    /* Optimize and pack virtual command buffer if it has to be traversed multiple times */
     if ((GetFlags() & CommandBufferFlags::MultiSubmit) != 0)
+    {
+        optimizedBuffer_.Clear();
+        if (OptimizeGLVirtualCommandBuffer(buffer_, optimizedBuffer_))
+            buffer_.Swap(optimizedBuffer_);
         buffer_.Pack();
+    }
 }
 
 void GLDeferredCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
@@ -72,10 +92,10 @@ void GLDeferredCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
     if (IsPrimary())
     {
         /* Is this a secondary command buffer? */
-        auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, secondaryCommandBuffer);
+        auto& cmdBufferGL = LLGL_HOT_CAST(const GLCommandBuffer&, secondaryCommandBuffer);
         if (!cmdBufferGL.IsImmediateCmdBuffer())
         {
-            auto& deferredCmdBufferGL = LLGL_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
+            auto& deferredCmdBufferGL = LLGL_HOT_CAST(const GLDeferredCommandBuffer&, cmdBufferGL);
             if (!deferredCmdBufferGL.IsPrimary())
             {
                 /* Encode GL command */
@@ -96,7 +116,7 @@ void GLDeferredCommandBuffer::UpdateBuffer(
 {
     auto cmd = AllocCommand<GLCmdBufferSubData>(GLOpcodeBufferSubData, dataSize);
     {
-        cmd->buffer = LLGL_CAST(GLBuffer*, &dstBuffer);
+        cmd->buffer = LLGL_HOT_CAST(GLBuffer*, &dstBuffer);
         cmd->offset = static_cast<GLintptr>(dstOffset);
         cmd->size   = static_cast<GLsizeiptr>(dataSize);
         ::memcpy(cmd + 1, data, dataSize);
@@ -112,8 +132,8 @@ void GLDeferredCommandBuffer::CopyBuffer(
 {
     auto cmd = AllocCommand<GLCmdCopyBufferSubData>(GLOpcodeCopyBufferSubData);
     {
-        cmd->writeBuffer    = LLGL_CAST(GLBuffer*, &dstBuffer);
-        cmd->readBuffer     = LLGL_CAST(GLBuffer*, &srcBuffer);
+        cmd->writeBuffer    = LLGL_HOT_CAST(GLBuffer*, &dstBuffer);
+        cmd->readBuffer     = LLGL_HOT_CAST(GLBuffer*, &srcBuffer);
         cmd->readOffset     = static_cast<GLintptr>(srcOffset);
         cmd->writeOffset    = static_cast<GLintptr>(dstOffset);
         cmd->size           = static_cast<GLsizeiptr>(size);
@@ -131,9 +151,9 @@ void GLDeferredCommandBuffer::CopyBufferFromTexture(
     const TextureSubresource zeroBasedSubresource{ 0, srcRegion.subresource.numArrayLayers, 0, 1 };
     auto cmd = AllocCommand<GLCmdCopyImageBuffer>(GLOpcodeCopyImageToBuffer);
     {
-        cmd->texture        = LLGL_CAST(GLTexture*, &srcTexture);
+        cmd->texture        = LLGL_HOT_CAST(GLTexture*, &srcTexture);
         cmd->region         = srcRegion;
-        cmd->bufferID       = LLGL_CAST(GLBuffer&, dstBuffer).GetID();
+        cmd->bufferID       = LLGL_HOT_CAST(GLBuffer&, dstBuffer).GetID();
         cmd->offset         = static_cast<GLintptr>(dstOffset);
         cmd->size           = static_cast<GLsizei>(GetMemoryFootprint(cmd->texture->GetType(), cmd->texture->GetFormat(), srcRegion.extent, zeroBasedSubresource));
         cmd->rowLength      = static_cast<GLint>(rowStride);
@@ -151,7 +171,7 @@ void GLDeferredCommandBuffer::FillBuffer(
     {
         auto cmd = AllocCommand<GLCmdClearBufferData>(GLOpcodeClearBufferData);
         {
-            cmd->buffer = LLGL_CAST(GLBuffer*, &dstBuffer);
+            cmd->buffer = LLGL_HOT_CAST(GLBuffer*, &dstBuffer);
             cmd->data   = value;
         }
     }
@@ -159,7 +179,7 @@ void GLDeferredCommandBuffer::FillBuffer(
     {
         auto cmd = AllocCommand<GLCmdClearBufferSubData>(GLOpcodeClearBufferSubData);
         {
-            cmd->buffer = LLGL_CAST(GLBuffer*, &dstBuffer);
+            cmd->buffer = LLGL_HOT_CAST(GLBuffer*, &dstBuffer);
             cmd->offset = static_cast<GLintptr>(dstOffset);
             cmd->size   = static_cast<GLsizeiptr>(fillSize);
             cmd->data   = value;
@@ -176,10 +196,10 @@ void GLDeferredCommandBuffer::CopyTexture(
 {
     auto cmd = AllocCommand<GLCmdCopyImageSubData>(GLOpcodeCopyImageSubData);
     {
-        cmd->dstTexture = LLGL_CAST(GLTexture*, &dstTexture);
+        cmd->dstTexture = LLGL_HOT_CAST(GLTexture*, &dstTexture);
         cmd->dstLevel   = static_cast<GLint>(dstLocation.mipLevel);
         cmd->dstOffset  = CalcTextureOffset(dstTexture.GetType(), dstLocation.offset, dstLocation.arrayLayer);
-        cmd->srcTexture = LLGL_CAST(GLTexture*, &srcTexture);
+        cmd->srcTexture = LLGL_HOT_CAST(GLTexture*, &srcTexture);
         cmd->srcLevel   = static_cast<GLint>(srcLocation.mipLevel);
         cmd->srcOffset  = CalcTextureOffset(srcTexture.GetType(), srcLocation.offset, srcLocation.arrayLayer);
         cmd->extent     = extent;
@@ -197,9 +217,9 @@ void GLDeferredCommandBuffer::CopyTextureFromBuffer(
     const TextureSubresource zeroBasedSubresource{ 0, dstRegion.subresource.numArrayLayers, 0, 1 };
     auto cmd = AllocCommand<GLCmdCopyImageBuffer>(GLOpcodeCopyImageFromBuffer);
     {
-        cmd->texture        = LLGL_CAST(GLTexture*, &dstTexture);
+        cmd->texture        = LLGL_HOT_CAST(GLTexture*, &dstTexture);
         cmd->region         = dstRegion;
-        cmd->bufferID       = LLGL_CAST(GLBuffer&, srcBuffer).GetID();
+        cmd->bufferID       = LLGL_HOT_CAST(GLBuffer&, srcBuffer).GetID();
         cmd->offset         = static_cast<GLintptr>(srcOffset);
         cmd->size           = static_cast<GLsizei>(GetMemoryFootprint(cmd->texture->GetType(), cmd->texture->GetFormat(), dstRegion.extent, zeroBasedSubresource));
         cmd->rowLength      = static_cast<GLint>(rowStride);
@@ -217,7 +237,7 @@ void GLDeferredCommandBuffer::CopyTextureFromFramebuffer(
 
     auto cmd = AllocCommand<GLCmdCopyFramebufferSubData>(GLOpcodeCopyFramebufferSubData);
     {
-        cmd->dstTexture     = LLGL_CAST(GLTexture*, &dstTexture);
+        cmd->dstTexture     = LLGL_HOT_CAST(GLTexture*, &dstTexture);
         cmd->dstLevel       = static_cast<GLint>(dstRegion.subresource.baseMipLevel);
         cmd->dstOffset      = CalcTextureOffset(dstTexture.GetType(), dstRegion.offset, dstRegion.subresource.baseArrayLayer);
         cmd->srcOffset      = srcOffset;
@@ -230,7 +250,7 @@ void GLDeferredCommandBuffer::GenerateMips(Texture& texture)
 {
     auto cmd = AllocCommand<GLCmdGenerateMipmap>(GLOpcodeGenerateMipmap);
     {
-        cmd->texture = LLGL_CAST(GLTexture*, &texture);
+        cmd->texture = LLGL_HOT_CAST(GLTexture*, &texture);
     }
 }
 
@@ -238,7 +258,7 @@ void GLDeferredCommandBuffer::GenerateMips(Texture& texture, const TextureSubres
 {
     auto cmd = AllocCommand<GLCmdGenerateMipmapSubresource>(GLOpcodeGenerateMipmapSubresource);
     {
-        cmd->texture        = LLGL_CAST(GLTexture*, &texture);
+        cmd->texture        = LLGL_HOT_CAST(GLTexture*, &texture);
         cmd->baseMipLevel   = subresource.baseMipLevel;
         cmd->numMipLevels   = subresource.numMipLevels;
         cmd->baseArrayLayer = subresource.baseArrayLayer;
@@ -320,7 +340,7 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        auto& bufferWithVAO = LLGL_CAST(GLBufferWithVAO&, buffer);
+        auto& bufferWithVAO = LLGL_HOT_CAST(GLBufferWithVAO&, buffer);
         auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
         cmd->vertexArray = bufferWithVAO.GetVertexArray();
         
@@ -328,10 +348,13 @@ void GLDeferredCommandBuffer::SetVertexBuffer(Buffer& buffer)
         /* Store ID to transform feedback object */
         if ((buffer.GetBindFlags() & BindFlags::StreamOutputBuffer) != 0)
         {
-            auto& streamOutputBufferGL = LLGL_CAST(GLBufferWithXFB&, bufferWithVAO);
+            auto& streamOutputBufferGL = LLGL_HOT_CAST(GLBufferWithXFB&, bufferWithVAO);
             SetTransformFeedback(streamOutputBufferGL);
         }
         #endif // /LLGL_GLEXT_TRNASFORM_FEEDBACK2
+
+        /* Store vertex buffer in case it's used for compute stream-output */
+        SetComputeStreamOutputBuffer((buffer.GetBindFlags() & BindFlags::ComputeStreamOutput) != 0 ? &bufferWithVAO : nullptr);
     }
 }
 
@@ -339,15 +362,16 @@ void GLDeferredCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
-        auto& bufferArrayWithVAO = LLGL_CAST(GLBufferArrayWithVAO&, bufferArray);
+        auto& bufferArrayWithVAO = LLGL_HOT_CAST(GLBufferArrayWithVAO&, bufferArray);
         auto cmd = AllocCommand<GLCmdBindVertexArray>(GLOpcodeBindVertexArray);
         cmd->vertexArray = bufferArrayWithVAO.GetVertexArray();
+        SetComputeStreamOutputBuffer(nullptr);
     }
 }
 
 void GLDeferredCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     auto cmd = AllocCommand<GLCmdBindElementArrayBufferToVAO>(GLOpcodeBindElementArrayBufferToVAO);
     cmd->id = bufferGL.GetID();
     cmd->indexType16Bits = bufferGL.IsIndexType16Bits();
@@ -356,7 +380,7 @@ void GLDeferredCommandBuffer::SetIndexBuffer(Buffer& buffer)
 
 void GLDeferredCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     const bool indexType16Bits = (format == Format::R16UInt);
     auto cmd = AllocCommand<GLCmdBindElementArrayBufferToVAO>(GLOpcodeBindElementArrayBufferToVAO);
     cmd->id = bufferGL.GetID();
@@ -370,7 +394,7 @@ void GLDeferredCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::u
 {
     auto cmd = AllocCommand<GLCmdBindResourceHeap>(GLOpcodeBindResourceHeap);
     {
-        cmd->resourceHeap       = LLGL_CAST(GLResourceHeap*, &resourceHeap);
+        cmd->resourceHeap       = LLGL_HOT_CAST(GLResourceHeap*, &resourceHeap);
         cmd->descriptorSet      = descriptorSet;
         cmd->bufferInterfaceMap = GetBoundPipelineState()->GetBufferInterfaceMap();
     }
@@ -403,6 +427,32 @@ void GLDeferredCommandBuffer::SetResource(std::uint32_t descriptor, Resource& re
     }
 }
 
+void GLDeferredCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto* pipelineLayoutGL = GetBoundPipelineLayout();
+    if (pipelineLayoutGL == nullptr)
+        return /*GL_INVALID_VALUE*/;
+
+    const auto& bindingList = pipelineLayoutGL->GetBindings();
+    if (!(descriptor < bindingList.size()))
+        return /*GL_INVALID_INDEX*/;
+
+    /* Bind buffer range at explicit binding slot; Only uniform buffers can be bound as range */
+    const GLPipelineResourceBinding& binding = bindingList[descriptor];
+    if (binding.type == GLResourceType_UBO)
+    {
+        auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
+        auto cmd = AllocCommand<GLCmdBindBufferRange>(GLOpcodeBindBufferRange);
+        {
+            cmd->target = GLBufferTarget::UniformBuffer;
+            cmd->index  = binding.slot;
+            cmd->id     = bufferGL.GetID();
+            cmd->offset = static_cast<GLintptr>(offset);
+            cmd->size   = static_cast<GLsizeiptr>(size);
+        }
+    }
+}
+
 // private
 void GLDeferredCommandBuffer::BindResource(GLResourceType type, GLuint slot, std::uint32_t descriptor, Resource& resource)
 {
@@ -417,17 +467,37 @@ void GLDeferredCommandBuffer::BindResource(GLResourceType type, GLuint slot, std
 
         case GLResourceType_UBO:
         {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, resource);
             BindBufferBase(GLBufferTarget::UniformBuffer, bufferGL, slot);
         }
         break;
 
         case GLResourceType_Buffer:
         {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, resource);
+            const GLPipelineState* boundPipelineState = GetBoundPipelineState();
+
+            if (boundPipelineState->IsLinkPending())
+            {
+                /* Buffer interface map is not available until the PSO has been linked, so defer lookup until this command is executed */
+                auto cmd = AllocCommand<GLCmdBindBufferDynamic>(GLOpcodeBindBufferDynamic);
+                {
+                    cmd->pipelineState  = boundPipelineState;
+                    cmd->buffer         = &bufferGL;
+                    cmd->descriptor     = descriptor;
+                    cmd->slot           = slot;
+                }
+                #if LLGL_GLEXT_MEMORY_BARRIERS
+                InvalidateMemoryBarriersForStorageResource(
+                    bufferGL.GetBindFlags(),
+                    GL_SHADER_STORAGE_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
+                );
+                #endif
+                break;
+            }
 
             /* Lookup whether this is an SSBO, sampler buffer, or image buffer in buffer interface map */
-            const GLShaderBufferInterfaceMap* bufferInterfaceMap = GetBoundPipelineState()->GetBufferInterfaceMap();
+            const GLShaderBufferInterfaceMap* bufferInterfaceMap = boundPipelineState->GetBufferInterfaceMap();
             GLBufferInterface bufferInterface = bufferInterfaceMap->GetDynamicInterfaces()[descriptor];
             switch (bufferInterface)
             {
@@ -463,7 +533,7 @@ void GLDeferredCommandBuffer::BindResource(GLResourceType type, GLuint slot, std
 
         case GLResourceType_Texture:
         {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            auto& textureGL = LLGL_HOT_CAST(GLTexture&, resource);
             BindTexture(textureGL, slot);
             #if LLGL_GLEXT_MEMORY_BARRIERS
             InvalidateMemoryBarriersForStorageResource(textureGL.GetBindFlags(), GL_TEXTURE_FETCH_BARRIER_BIT);
@@ -473,7 +543,7 @@ void GLDeferredCommandBuffer::BindResource(GLResourceType type, GLuint slot, std
 
         case GLResourceType_Image:
         {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            auto& textureGL = LLGL_HOT_CAST(GLTexture&, resource);
             BindImageTexture(textureGL.GetID(), textureGL.GetGLInternalFormat(), slot);
             #if LLGL_GLEXT_MEMORY_BARRIERS
             InvalidateMemoryBarriersForStorageResource(textureGL.GetBindFlags(), GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
@@ -483,14 +553,14 @@ void GLDeferredCommandBuffer::BindResource(GLResourceType type, GLuint slot, std
 
         case GLResourceType_Sampler:
         {
-            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
+            auto& samplerGL = LLGL_HOT_CAST(GLSampler&, resource);
             BindSampler(samplerGL, slot);
         }
         break;
 
         case GLResourceType_EmulatedSampler:
         {
-            auto& emulatedSamplerGL = LLGL_CAST(GLEmulatedSampler&, resource);
+            auto& emulatedSamplerGL = LLGL_HOT_CAST(GLEmulatedSampler&, resource);
             BindEmulatedSampler(emulatedSamplerGL, slot);
         }
         break;
@@ -504,7 +574,7 @@ void GLDeferredCommandBuffer::BindCombinedResource(GLResourceType type, const GL
     {
         case GLResourceType_Texture:
         {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            auto& textureGL = LLGL_HOT_CAST(GLTexture&, resource);
             for_range(i, numSlots)
                 BindTexture(textureGL, slots[i]);
             #if LLGL_GLEXT_MEMORY_BARRIERS
@@ -516,7 +586,7 @@ void GLDeferredCommandBuffer::BindCombinedResource(GLResourceType type, const GL
 
         case GLResourceType_Sampler:
         {
-            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
+            auto& samplerGL = LLGL_HOT_CAST(GLSampler&, resource);
             for_range(i, numSlots)
                 BindSampler(samplerGL, slots[i]);
         }
@@ -524,7 +594,7 @@ void GLDeferredCommandBuffer::BindCombinedResource(GLResourceType type, const GL
 
         case GLResourceType_EmulatedSampler:
         {
-            auto& emulatedSamplerGL = LLGL_CAST(GLEmulatedSampler&, resource);
+            auto& emulatedSamplerGL = LLGL_HOT_CAST(GLEmulatedSampler&, resource);
             for_range(i, numSlots)
                 BindEmulatedSampler(emulatedSamplerGL, slots[i]);
         }
@@ -562,14 +632,20 @@ void GLDeferredCommandBuffer::BeginRenderPass(
     {
         cmd->renderTarget = &renderTarget;
     }
-    if (renderPass != nullptr)
+
+    /*
+    Defer the attachment clears of the render pass until the first command that is not a clear.
+    Clear() commands in between are folded into a single clear, and the render pass clear is dropped if they overwrite all of its attachments.
+    */
+    isClearPending_     = true;
+    pendingRenderPass_  = (renderPass != nullptr ? LLGL_HOT_CAST(const GLRenderPass*, renderPass) : nullptr);
+    pendingClearFlags_  = 0;
+
+    if (pendingRenderPass_ != nullptr)
     {
-        auto cmd = AllocCommand<GLCmdClearAttachmentsWithRenderPass>(GLOpcodeClearAttachmentsWithRenderPass, sizeof(ClearValue)*numClearValues);
-        {
-            cmd->renderPass     = LLGL_CAST(const GLRenderPass*, renderPass);
-            cmd->numClearValues = numClearValues;
-            ::memcpy(cmd + 1, clearValues, sizeof(ClearValue)*numClearValues);
-        }
+        numPendingClearValues_ = std::min(numClearValues, LLGL_MAX_NUM_ATTACHMENTS);
+        if (numPendingClearValues_ > 0)
+            ::memcpy(pendingClearValues_, clearValues, sizeof(ClearValue)*numPendingClearValues_);
     }
 
     /*
@@ -577,16 +653,31 @@ void GLDeferredCommandBuffer::BeginRenderPass(
     This is one of the few states the deferred GL command buffer caches
     as it must be guaranteed that this render pass is followed by a call to EndRenderPass() operating on the same render-target.
     */
+    GLRenderTarget* renderTargetGL = nullptr;
     if (!LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
-        auto& renderTargetGL = LLGL_CAST(GLRenderTarget&, renderTarget);
-        if (renderTargetGL.CanResolveMultisampledFBO())
-            renderTargetToResolve_ = &renderTargetGL;
+        renderTargetGL = LLGL_HOT_CAST(GLRenderTarget*, &renderTarget);
+        if (renderTargetGL->CanResolveMultisampledFBO())
+            renderTargetToResolve_ = renderTargetGL;
+    }
+
+    /* Cache render pass if any attachment must be invalidated at the following EndRenderPass() call */
+    if (renderPass != nullptr)
+    {
+        auto renderPassGL = LLGL_HOT_CAST(const GLRenderPass*, renderPass);
+        if (renderPassGL->GetDiscardMask() != 0)
+        {
+            renderPassToInvalidate_     = renderPassGL;
+            renderTargetToInvalidate_   = renderTargetGL;
+        }
     }
 }
 
 void GLDeferredCommandBuffer::EndRenderPass()
 {
+    if (isClearPending_)
+        FlushPendingClears();
+
     if (renderTargetToResolve_ != nullptr)
     {
         auto cmd = AllocCommand<GLCmdResolveRenderTarget>(GLOpcodeResolveRenderTarget);
@@ -595,39 +686,46 @@ void GLDeferredCommandBuffer::EndRenderPass()
         }
         renderTargetToResolve_ = nullptr;
     }
+    if (renderPassToInvalidate_ != nullptr)
+    {
+        auto cmd = AllocCommand<GLCmdInvalidateAttachments>(GLOpcodeInvalidateAttachments);
+        {
+            cmd->renderPass     = renderPassToInvalidate_;
+            cmd->renderTarget   = renderTargetToInvalidate_;
+        }
+        renderPassToInvalidate_     = nullptr;
+        renderTargetToInvalidate_   = nullptr;
+    }
 }
 
 void GLDeferredCommandBuffer::Clear(long flags, const ClearValue& clearValue)
 {
-    if (flags != 0)
+    if (flags == 0)
+        return; // nothing to do
+
+    if (isClearPending_)
     {
+        /* Fold clear into the pending clears of the render pass that has just begun; later values override earlier ones */
         if ((flags & ClearFlags::Color) != 0)
-        {
-            auto cmd = AllocCommand<GLCmdClearColor>(GLOpcodeClearColor);
-            ::memcpy(cmd->color, clearValue.color, sizeof(float[4]));
-        }
-
+            ::memcpy(pendingClearValue_.color, clearValue.color, sizeof(float[4]));
         if ((flags & ClearFlags::Depth) != 0)
-        {
-            auto cmd = AllocCommand<GLCmdClearDepth>(GLOpcodeClearDepth);
-            cmd->depth = static_cast<GLclamp_t>(clearValue.depth);
-        }
-
+            pendingClearValue_.depth = clearValue.depth;
         if ((flags & ClearFlags::Stencil) != 0)
-        {
-            auto cmd = AllocCommand<GLCmdClearStencil>(GLOpcodeClearStencil);
-            cmd->stencil = static_cast<GLint>(clearValue.stencil);
-        }
-
-        auto cmd = AllocCommand<GLCmdClear>(GLOpcodeClear);
-        cmd->flags = flags;
+            pendingClearValue_.stencil = clearValue.stencil;
+        pendingClearFlags_ |= (flags & ClearFlags::All);
     }
+    else
+        RecordClear(flags, clearValue);
 }
 
 void GLDeferredCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
 {
     if (numAttachments > 0)
     {
+        /* Attachment clears are not folded, but they can still overwrite the clears of a pending render pass */
+        if (isClearPending_)
+            FlushPendingClears(numAttachments, attachments);
+
         auto cmd = AllocCommand<GLCmdClearBuffers>(GLOpcodeClearBuffers, sizeof(AttachmentClear)*numAttachments);
         {
             cmd->numAttachments = numAttachments;
@@ -641,7 +739,9 @@ void GLDeferredCommandBuffer::ClearAttachments(std::uint32_t numAttachments, con
 void GLDeferredCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
     auto cmd = AllocCommand<GLCmdBindPipelineState>(GLOpcodeBindPipelineState);
-    cmd->pipelineState = LLGL_CAST(GLPipelineState*, &pipelineState);
+    cmd->pipelineState = LLGL_HOT_CAST(GLPipelineState*, &pipelineState);
+
+    /* Don't wait for pending PSO links here; program information that needs the linked program is resolved at execution */
     SetPipelineRenderState(*(cmd->pipelineState));
 }
 
@@ -665,6 +765,11 @@ void GLDeferredCommandBuffer::SetStencilReference(std::uint32_t reference, const
     }
 }
 
+void GLDeferredCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // dummy - not supported in OpenGL
+}
+
 void GLDeferredCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -675,31 +780,14 @@ void GLDeferredCommandBuffer::SetUniforms(std::uint32_t first, const void* data,
     if (boundPipelineState == nullptr)
         return /*GL_INVALID_VALUE*/;
 
-    auto* boundShaderPipeline = boundPipelineState->GetShaderPipeline();
-    if (boundPipelineState == nullptr)
-        return /*GL_INVALID_VALUE*/;
-
-    const std::uint32_t dataSizeInWords = dataSize / 4;
-    const auto& uniformMap = boundPipelineState->GetUniformMap();
-
-    for (auto words = reinterpret_cast<const std::uint32_t*>(data), wordsEnd = words + dataSizeInWords; words != wordsEnd; ++first)
+    /*
+    Record data into the uniform batch and resolve uniform locations at execution, since the uniform map is not available until the PSO has been linked.
+    Uniforms that are declared inside a uniform block are uploaded with a single buffer update for the entire command buffer.
+    */
+    auto cmd = AllocCommand<GLCmdSetUniforms>(GLOpcodeSetUniforms);
     {
-        if (first >= uniformMap.size())
-            return /*GL_INVALID_INDEX*/;
-
-        /* Allocate GL command and copy data buffer */
-        const auto& uniform = uniformMap[first];
-        const std::uint32_t uniformSize = uniform.wordSize * 4;
-        auto cmd = AllocCommand<GLCmdSetUniform>(GLOpcodeSetUniform, uniformSize);
-        {
-            cmd->program    = boundShaderPipeline->GetID(); //TODO: must distinguish between GLShaderProgram and GLProgramPipeline
-            cmd->type       = uniform.type;
-            cmd->location   = uniform.location;
-            cmd->count      = uniform.count;
-            cmd->size       = static_cast<GLsizeiptr>(uniformSize);
-            ::memcpy(cmd + 1, words, uniformSize);
-        }
-        words += uniform.wordSize;
+        cmd->batch  = &uniformBatch_;
+        cmd->index  = uniformBatch_.Record(boundPipelineState, first, data, dataSize);
     }
 }
 
@@ -709,16 +797,29 @@ void GLDeferredCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t que
 {
     auto cmd = AllocCommand<GLCmdBeginQuery>(GLOpcodeBeginQuery);
     {
-        cmd->queryHeap  = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->queryHeap  = LLGL_HOT_CAST(GLQueryHeap*, &queryHeap);
         cmd->query      = query;
     }
 }
 
-void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLDeferredCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     auto cmd = AllocCommand<GLCmdEndQuery>(GLOpcodeEndQuery);
     {
-        cmd->queryHeap = LLGL_CAST(GLQueryHeap*, &queryHeap);
+        cmd->queryHeap  = LLGL_HOT_CAST(GLQueryHeap*, &queryHeap);
+        cmd->query      = query;
+    }
+}
+
+void GLDeferredCommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto cmd = AllocCommand<GLCmdResolveQueryData>(GLOpcodeResolveQueryData);
+    {
+        cmd->queryHeap  = LLGL_HOT_CAST(GLQueryHeap*, &srcQueryHeap);
+        cmd->firstQuery = firstQuery;
+        cmd->numQueries = numQueries;
+        cmd->bufferID   = LLGL_HOT_CAST(GLBuffer&, dstBuffer).GetID();
+        cmd->offset     = static_cast<GLintptr>(dstOffset);
     }
 }
 
@@ -726,7 +827,7 @@ void GLDeferredCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::ui
 {
     auto cmd = AllocCommand<GLCmdBeginConditionalRender>(GLOpcodeBeginConditionalRender);
     {
-        cmd->id     = LLGL_CAST(const GLQueryHeap&, queryHeap).GetID(query);
+        cmd->id     = LLGL_HOT_CAST(const GLQueryHeap&, queryHeap).GetID(query);
         cmd->mode   = GLTypes::Map(mode);
     }
 }
@@ -752,7 +853,7 @@ void GLDeferredCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer
 
     if (numBuffers > 0)
     {
-        auto* bufferWithXfbGL = LLGL_CAST(GLBufferWithXFB*, buffers[0]);
+        auto* bufferWithXfbGL = LLGL_HOT_CAST(GLBufferWithXFB*, buffers[0]);
         auto cmd = AllocCommand<GLCmdBeginBufferXfb>(GLOpcodeBeginBufferXfb);
         cmd->bufferWithXfb = bufferWithXfbGL;
         cmd->primitiveMode = GetPrimitiveMode();
@@ -926,7 +1027,7 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
     LLGL_FLUSH_MEMORY_BARRIERS();
     auto cmd = AllocCommand<GLCmdDrawArraysIndirect>(GLOpcodeDrawArraysIndirect);
     {
-        cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+        cmd->id             = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
         cmd->numCommands    = 1;
         cmd->mode           = GetDrawMode();
         cmd->indirect       = static_cast<GLintptr>(offset);
@@ -943,7 +1044,7 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset,
         const GLintptr indirect = static_cast<GLintptr>(offset);
         auto cmd = AllocCommand<GLCmdMultiDrawArraysIndirect>(GLOpcodeMultiDrawArraysIndirect);
         {
-            cmd->id         = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->id         = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
             cmd->mode       = GetDrawMode();
             cmd->indirect   = reinterpret_cast<const GLvoid*>(indirect);
             cmd->drawcount  = static_cast<GLsizei>(numCommands);
@@ -955,7 +1056,7 @@ void GLDeferredCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset,
     {
         auto cmd = AllocCommand<GLCmdDrawArraysIndirect>(GLOpcodeDrawArraysIndirect);
         {
-            cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->id             = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
             cmd->numCommands    = numCommands;
             cmd->mode           = GetDrawMode();
             cmd->indirect       = static_cast<GLintptr>(offset);
@@ -969,7 +1070,7 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     LLGL_FLUSH_MEMORY_BARRIERS();
     auto cmd = AllocCommand<GLCmdDrawElementsIndirect>(GLOpcodeDrawElementsIndirect);
     {
-        cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+        cmd->id             = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
         cmd->numCommands    = 1;
         cmd->mode           = GetDrawMode();
         cmd->type           = GetIndexType();
@@ -987,7 +1088,7 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
         const GLintptr indirect = static_cast<GLintptr>(offset);
         auto cmd = AllocCommand<GLCmdMultiDrawElementsIndirect>(GLOpcodeMultiDrawElementsIndirect);
         {
-            cmd->id         = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->id         = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
             cmd->mode       = GetDrawMode();
             cmd->type       = GetIndexType();
             cmd->indirect   = reinterpret_cast<const GLvoid*>(indirect);
@@ -1000,7 +1101,7 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     {
         auto cmd = AllocCommand<GLCmdDrawElementsIndirect>(GLOpcodeDrawElementsIndirect);
         {
-            cmd->id             = LLGL_CAST(GLBuffer&, buffer).GetID();
+            cmd->id             = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
             cmd->numCommands    = numCommands;
             cmd->mode           = GetDrawMode();
             cmd->type           = GetIndexType();
@@ -1010,8 +1111,47 @@ void GLDeferredCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     }
 }
 
+void GLDeferredCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    LLGL_FLUSH_MEMORY_BARRIERS();
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    auto cmd = AllocCommand<GLCmdMultiDrawArraysIndirectCount>(GLOpcodeMultiDrawArraysIndirectCount);
+    {
+        cmd->id             = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
+        cmd->countId        = LLGL_HOT_CAST(GLBuffer&, countBuffer).GetID();
+        cmd->mode           = GetDrawMode();
+        cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+        cmd->drawcount      = static_cast<GLintptr>(countOffset);
+        cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+        cmd->stride         = static_cast<GLsizei>(stride);
+    }
+}
+
+void GLDeferredCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    LLGL_FLUSH_MEMORY_BARRIERS();
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    auto cmd = AllocCommand<GLCmdMultiDrawElementsIndirectCount>(GLOpcodeMultiDrawElementsIndirectCount);
+    {
+        cmd->id             = LLGL_HOT_CAST(GLBuffer&, buffer).GetID();
+        cmd->countId        = LLGL_HOT_CAST(GLBuffer&, countBuffer).GetID();
+        cmd->mode           = GetDrawMode();
+        cmd->type           = GetIndexType();
+        cmd->indirect       = reinterpret_cast<const GLvoid*>(indirect);
+        cmd->drawcount      = static_cast<GLintptr>(countOffset);
+        cmd->maxdrawcount   = static_cast<GLsizei>(maxNumCommands);
+        cmd->stride         = static_cast<GLsizei>(stride);
+    }
+}
+
 void GLDeferredCommandBuffer::DrawStreamOutput()
 {
+    if (GLBuffer* computeSOBufferGL = GetRenderState().boundComputeSOBuffer)
+    {
+        /* Draw with the arguments that were written by a compute shader at the end of the vertex buffer */
+        DrawIndirect(*computeSOBufferGL, GetComputeStreamOutputArgsOffset(static_cast<std::uint64_t>(computeSOBufferGL->GetSize())));
+        return;
+    }
     LLGL_FLUSH_MEMORY_BARRIERS();
     if (GLBufferWithXFB* bufferWithXfbGL = GetRenderState().boundBufferWithFxb)
     {
@@ -1036,6 +1176,44 @@ void GLDeferredCommandBuffer::DrawStreamOutput()
     }
 }
 
+void GLDeferredCommandBuffer::DrawMeshTasks(
+    std::uint32_t   /*numWorkGroupsX*/,
+    std::uint32_t   /*numWorkGroupsY*/,
+    std::uint32_t   /*numWorkGroupsZ*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLDeferredCommandBuffer::DrawMeshTasksIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    std::uint32_t   /*numCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLDeferredCommandBuffer::DispatchTiles()
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLDeferredCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLDeferredCommandBuffer::DrawPacked(const DrawPackedDescriptor& drawDesc)
+{
+    EncodePackedDraws(*this, drawDesc);
+}
+
 /* ----- Compute ----- */
 
 void GLDeferredCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1059,7 +1237,7 @@ void GLDeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t off
     LLGL_FLUSH_MEMORY_BARRIERS();
     auto cmd = AllocCommand<GLCmdDispatchComputeIndirect>(GLOpcodeDispatchComputeIndirect);
     {
-        cmd->id         = LLGL_CAST(const GLBuffer&, buffer).GetID();
+        cmd->id         = LLGL_HOT_CAST(const GLBuffer&, buffer).GetID();
         cmd->indirect   = static_cast<GLintptr>(offset);
     }
     #else
@@ -1067,6 +1245,22 @@ void GLDeferredCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t off
     #endif
 }
 
+/* ----- Ray Tracing ----- */
+
+void GLDeferredCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLDeferredCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    // dummy - not supported in OpenGL
+}
+
 /* ----- Debugging ----- */
 
 void GLDeferredCommandBuffer::PushDebugGroup(const char* name)
@@ -1074,18 +1268,16 @@ void GLDeferredCommandBuffer::PushDebugGroup(const char* name)
     #if LLGL_GLEXT_DEBUG
     if (HasExtension(GLExt::KHR_debug))
     {
-        /* Push debug group name into command stream with default ID no. */
-        const GLint         maxLength       = GLStateManager::Get().GetLimits().maxDebugNameLength;
-        const GLuint        id              = 0;
-        const std::size_t   actualLength    = std::strlen(name);
-        const std::size_t   croppedLength   = std::min(actualLength, static_cast<std::size_t>(maxLength));
+        /* Push debug group name into command stream with default ID no.; name is cropped to the maximum length at execution */
+        const GLuint        id      = 0;
+        const std::size_t   length  = std::strlen(name);
 
-        auto cmd = AllocCommand<GLCmdPushDebugGroup>(GLOpcodePushDebugGroup, croppedLength + 1);
+        auto cmd = AllocCommand<GLCmdPushDebugGroup>(GLOpcodePushDebugGroup, length + 1);
         {
             cmd->source = GL_DEBUG_SOURCE_APPLICATION;
             cmd->id     = id;
-            cmd->length = static_cast<GLsizei>(croppedLength);
-            ::memcpy(cmd + 1, name, croppedLength + 1);
+            cmd->length = static_cast<GLsizei>(length);
+            ::memcpy(cmd + 1, name, length + 1);
         }
     }
     #endif // /LLGL_GLEXT_DEBUG
@@ -1116,6 +1308,11 @@ bool GLDeferredCommandBuffer::IsImmediateCmdBuffer() const
     return false;
 }
 
+void GLDeferredCommandBuffer::FlushUniformBatch(GLStateManager& stateMngr) const
+{
+    uniformBatch_.Flush(stateMngr);
+}
+
 bool GLDeferredCommandBuffer::IsPrimary() const
 {
     return ((GetFlags() & CommandBufferFlags::Secondary) == 0);
@@ -1149,7 +1346,7 @@ void GLDeferredCommandBuffer::BindBuffersBase(const GLBufferTarget bufferTarget,
             auto bufferIDs = reinterpret_cast<GLuint*>(cmd + 1);
             for (std::uint32_t i = 0; i < count; ++i)
             {
-                auto bufferGL = LLGL_CAST(const GLBuffer*, buffers[i]);
+                auto bufferGL = LLGL_HOT_CAST(const GLBuffer*, buffers[i]);
                 bufferIDs[i] = bufferGL->GetID();
             }
         }
@@ -1157,7 +1354,7 @@ void GLDeferredCommandBuffer::BindBuffersBase(const GLBufferTarget bufferTarget,
     else if (count == 1)
     {
         /* Encode as single binding with <BindBufferBase> */
-        auto bufferGL = LLGL_CAST(const GLBuffer*, buffers[0]);
+        auto bufferGL = LLGL_HOT_CAST(const GLBuffer*, buffers[0]);
         BindBufferBase(bufferTarget, *bufferGL, first);
     }
 }
@@ -1221,14 +1418,125 @@ void GLDeferredCommandBuffer::FlushMemoryBarriers()
     }
 }
 
+void GLDeferredCommandBuffer::RecordClear(long flags, const ClearValue& clearValue)
+{
+    if ((flags & ClearFlags::Color) != 0)
+    {
+        auto cmd = AllocCommand<GLCmdClearColor>(GLOpcodeClearColor);
+        ::memcpy(cmd->color, clearValue.color, sizeof(float[4]));
+    }
+
+    if ((flags & ClearFlags::Depth) != 0)
+    {
+        auto cmd = AllocCommand<GLCmdClearDepth>(GLOpcodeClearDepth);
+        cmd->depth = static_cast<GLclamp_t>(clearValue.depth);
+    }
+
+    if ((flags & ClearFlags::Stencil) != 0)
+    {
+        auto cmd = AllocCommand<GLCmdClearStencil>(GLOpcodeClearStencil);
+        cmd->stencil = static_cast<GLint>(clearValue.stencil);
+    }
+
+    auto cmd = AllocCommand<GLCmdClear>(GLOpcodeClear);
+    cmd->flags = flags;
+}
+
+// Returns true if the specified clears overwrite all attachments the render pass clears on begin. Clear commands ignore scissor rectangles and write masks.
+static bool IsRenderPassClearOverwritten(
+    const GLRenderPass&     renderPass,
+    long                    clearFlags,
+    std::uint32_t           numAttachments,
+    const AttachmentClear*  attachments)
+{
+    GLbitfield      mask        = renderPass.GetClearMask();
+    std::uint32_t   colorMask   = 0;
+
+    /* Clear() overwrites all color attachments at once */
+    if ((clearFlags & ClearFlags::Color) != 0)
+        mask &= ~GL_COLOR_BUFFER_BIT;
+    if ((clearFlags & ClearFlags::Depth) != 0)
+        mask &= ~GL_DEPTH_BUFFER_BIT;
+    if ((clearFlags & ClearFlags::Stencil) != 0)
+        mask &= ~GL_STENCIL_BUFFER_BIT;
+
+    for_range(i, numAttachments)
+    {
+        const AttachmentClear& attachment = attachments[i];
+        if ((attachment.flags & ClearFlags::Color) != 0)
+        {
+            if (attachment.colorAttachment < LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+                colorMask |= (1u << attachment.colorAttachment);
+        }
+        else
+        {
+            if ((attachment.flags & ClearFlags::Depth) != 0)
+                mask &= ~GL_DEPTH_BUFFER_BIT;
+            if ((attachment.flags & ClearFlags::Stencil) != 0)
+                mask &= ~GL_STENCIL_BUFFER_BIT;
+        }
+    }
+
+    /* ClearAttachments() must overwrite each color attachment the render pass clears */
+    if ((mask & GL_COLOR_BUFFER_BIT) != 0 && colorMask != 0)
+    {
+        const std::uint8_t* clearColorAttachments = renderPass.GetClearColorAttachments();
+        bool allColorsOverwritten = true;
+
+        for (std::uint32_t i = 0; i < LLGL_MAX_NUM_COLOR_ATTACHMENTS && clearColorAttachments[i] != 0xFF; ++i)
+        {
+            if (((colorMask >> clearColorAttachments[i]) & 0x1u) == 0)
+            {
+                allColorsOverwritten = false;
+                break;
+            }
+        }
+
+        if (allColorsOverwritten)
+            mask &= ~GL_COLOR_BUFFER_BIT;
+    }
+
+    return (mask == 0);
+}
+
+void GLDeferredCommandBuffer::FlushPendingClears(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    /* Reset pending state first as the following commands are allocated with the same functions that flush pending clears */
+    isClearPending_ = false;
+
+    if (pendingRenderPass_ != nullptr)
+    {
+        if (!IsRenderPassClearOverwritten(*pendingRenderPass_, pendingClearFlags_, numAttachments, attachments))
+        {
+            auto cmd = AllocCommand<GLCmdClearAttachmentsWithRenderPass>(GLOpcodeClearAttachmentsWithRenderPass, sizeof(ClearValue)*numPendingClearValues_);
+            {
+                cmd->renderPass     = pendingRenderPass_;
+                cmd->numClearValues = numPendingClearValues_;
+                ::memcpy(cmd + 1, pendingClearValues_, sizeof(ClearValue)*numPendingClearValues_);
+            }
+        }
+        pendingRenderPass_ = nullptr;
+    }
+
+    if (pendingClearFlags_ != 0)
+    {
+        RecordClear(pendingClearFlags_, pendingClearValue_);
+        pendingClearFlags_ = 0;
+    }
+}
+
 void GLDeferredCommandBuffer::AllocOpcode(const GLOpcode opcode)
 {
+    if (isClearPending_)
+        FlushPendingClears();
     buffer_.AllocOpcode(opcode);
 }
 
 template <typename TCommand>
 TCommand* GLDeferredCommandBuffer::AllocCommand(const GLOpcode opcode, std::size_t payloadSize)
 {
+    if (isClearPending_)
+        FlushPendingClears();
     return buffer_.AllocCommand<TCommand>(opcode, payloadSize);
 }
 
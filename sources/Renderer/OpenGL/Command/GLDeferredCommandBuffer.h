@@ -12,6 +12,8 @@
 #include "GLCommandBuffer.h"
 #include "GLCommandOpcode.h"
 #include "../../VirtualCommandBuffer.h"
+#include "../Buffer/GLUniformBatch.h"
+#include <LLGL/Constants.h>
 #include <memory>
 #include <vector>
 
@@ -33,6 +35,13 @@ class GLEmulatedSampler;
 
 using GLVirtualCommandBuffer = VirtualCommandBuffer<GLOpcode>;
 
+/*
+Records GL commands into a virtual command buffer that is executed by GLCommandQueue::Submit().
+Recording never issues GL calls and never accesses a GLStateManager, so deferred command buffers can be encoded on any thread;
+only their submission must happen on the thread that owns the GL context.
+Information that is only available once a PSO has been linked (uniform locations and buffer interfaces) is resolved at execution.
+Different command buffers can be recorded concurrently, but one command buffer must not be recorded by multiple threads at the same time.
+*/
 class GLDeferredCommandBuffer final : public GLCommandBuffer
 {
 
@@ -40,6 +49,12 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
         #include "GLCommandBuffer.inl"
 
+    public:
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void DrawPacked(const DrawPackedDescriptor& drawDesc) override;
+
     public:
 
         GLDeferredCommandBuffer(long flags, std::size_t initialBufferSize = 1024);
@@ -52,6 +67,9 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
         // Returns true if this is a primary command buffer.
         bool IsPrimary() const;
 
+        // Uploads all uniform blocks that have been recorded with SetUniforms(). This must be called before the command buffer is executed.
+        void FlushUniformBatch(GLStateManager& stateMngr) const;
+
         // Returns the internal command buffer as raw byte buffer.
         inline const GLVirtualCommandBuffer& GetVirtualCommandBuffer() const
         {
@@ -79,6 +97,13 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
         void FlushMemoryBarriers();
 
+        // Records the commands to clear the framebuffer with the specified clear values.
+        void RecordClear(long flags, const ClearValue& clearValue);
+
+        // Records the render pass clear that has been deferred by BeginRenderPass() and all Clear() commands that have been folded into it.
+        // The render pass clear is dropped if the folded clears or the specified attachment clears overwrite all of its attachments.
+        void FlushPendingClears(std::uint32_t numAttachments = 0, const AttachmentClear* attachments = nullptr);
+
         // Allocates only an opcode for empty commands.
         void AllocOpcode(const GLOpcode opcode);
 
@@ -88,9 +113,19 @@ class GLDeferredCommandBuffer final : public GLCommandBuffer
 
     private:
 
-        long                    flags_                  = 0;
+        long                    flags_                      = 0;
         GLVirtualCommandBuffer  buffer_;
-        GLRenderTarget*         renderTargetToResolve_  = nullptr;
+        GLVirtualCommandBuffer  optimizedBuffer_;               // Secondary buffer for OptimizeGLVirtualCommandBuffer(); swapped with 'buffer_' to recycle its memory.
+        GLRenderTarget*         renderTargetToResolve_      = nullptr;
+        const GLRenderPass*     renderPassToInvalidate_     = nullptr;
+        GLRenderTarget*         renderTargetToInvalidate_   = nullptr;   // Null if the render pass was started on a swap-chain
+        bool                    isClearPending_             = false;     // True between BeginRenderPass() and the first command that is not a clear
+        const GLRenderPass*     pendingRenderPass_          = nullptr;   // Render pass whose attachment clears are deferred until the first command that is not a clear
+        std::uint32_t           numPendingClearValues_      = 0;
+        ClearValue              pendingClearValues_[LLGL_MAX_NUM_ATTACHMENTS];
+        long                    pendingClearFlags_          = 0;         // Union of all Clear() commands that have been folded into one
+        ClearValue              pendingClearValue_;
+        mutable GLUniformBatch  uniformBatch_;
 
 };
 
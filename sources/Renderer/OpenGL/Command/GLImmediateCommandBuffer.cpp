@@ -20,6 +20,9 @@
 #include "../GLTypes.h"
 #include "../GLCore.h"
 #include "../../CheckedCast.h"
+#include "../../CommandBufferUtils.h"
+#include "../../BufferUtils.h"
+#include "../../ProfileCounters.h"
 #include "../../../Core/Assertion.h"
 
 #include "../Shader/GLShaderProgram.h"
@@ -27,6 +30,7 @@
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLSampler.h"
 #include "../Texture/GLEmulatedSampler.h"
+#include "../RenderState/GLWorkerFenceQueue.h"
 #include "../Texture/GLRenderTarget.h"
 #include "../Texture/GLMipGenerator.h"
 #include "../Texture/GLFramebufferCapture.h"
@@ -40,6 +44,7 @@
 #include "../RenderState/GLResourceHeap.h"
 #include "../RenderState/GLRenderPass.h"
 #include "../RenderState/GLQueryHeap.h"
+#include "../../FrameArena.h"
 
 #include <cstring> // std::strlen
 
@@ -59,8 +64,13 @@ GLImmediateCommandBuffer::GLImmediateCommandBuffer() :
 
 void GLImmediateCommandBuffer::Begin()
 {
+    /* Immediate commands are executed right away, so wait for resources that have been created on worker threads first */
+    GLWorkerFenceQueue::Get().WaitOnServer();
     stateMngr_ = &(GLStateManager::Get());
     ResetRenderState();
+
+    /* Recycle scratch memory of the previous recording on this thread */
+    FrameArena::Get().Reset();
 }
 
 void GLImmediateCommandBuffer::End()
@@ -70,7 +80,7 @@ void GLImmediateCommandBuffer::End()
 
 void GLImmediateCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
-    auto& cmdBufferGL = LLGL_CAST(const GLCommandBuffer&, secondaryCommandBuffer);
+    auto& cmdBufferGL = LLGL_HOT_CAST(const GLCommandBuffer&, secondaryCommandBuffer);
     ExecuteGLCommandBuffer(cmdBufferGL, *stateMngr_);
 }
 
@@ -82,7 +92,7 @@ void GLImmediateCommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
-    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    auto& dstBufferGL = LLGL_HOT_CAST(GLBuffer&, dstBuffer);
     dstBufferGL.BufferSubData(static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(dataSize), data);
 }
 
@@ -93,8 +103,8 @@ void GLImmediateCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
-    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
-    auto& srcBufferGL = LLGL_CAST(GLBuffer&, srcBuffer);
+    auto& dstBufferGL = LLGL_HOT_CAST(GLBuffer&, dstBuffer);
+    auto& srcBufferGL = LLGL_HOT_CAST(GLBuffer&, srcBuffer);
     dstBufferGL.CopyBufferSubData(
         srcBufferGL,
         static_cast<GLintptr>(srcOffset),
@@ -111,8 +121,8 @@ void GLImmediateCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
-    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+    auto& dstBufferGL = LLGL_HOT_CAST(GLBuffer&, dstBuffer);
+    auto& srcTextureGL = LLGL_HOT_CAST(GLTexture&, srcTexture);
     const TextureSubresource zeroBasedSubresource{ 0, srcRegion.subresource.numArrayLayers, 0, 1 };
     srcTextureGL.CopyImageToBuffer(
         srcRegion,
@@ -130,7 +140,7 @@ void GLImmediateCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-    auto& dstBufferGL = LLGL_CAST(GLBuffer&, dstBuffer);
+    auto& dstBufferGL = LLGL_HOT_CAST(GLBuffer&, dstBuffer);
     if (fillSize == LLGL_WHOLE_SIZE)
         dstBufferGL.ClearBufferData(value);
     else
@@ -144,8 +154,8 @@ void GLImmediateCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
-    auto& srcTextureGL = LLGL_CAST(GLTexture&, srcTexture);
+    auto& dstTextureGL = LLGL_HOT_CAST(GLTexture&, dstTexture);
+    auto& srcTextureGL = LLGL_HOT_CAST(GLTexture&, srcTexture);
     dstTextureGL.CopyImageSubData(
         static_cast<GLint>(dstLocation.mipLevel),
         CalcTextureOffset(dstTexture.GetType(), dstLocation.offset, dstLocation.arrayLayer),
@@ -164,8 +174,8 @@ void GLImmediateCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
-    auto& srcBufferGL = LLGL_CAST(GLBuffer&, srcBuffer);
+    auto& dstTextureGL = LLGL_HOT_CAST(GLTexture&, dstTexture);
+    auto& srcBufferGL = LLGL_HOT_CAST(GLBuffer&, srcBuffer);
     const TextureSubresource zeroBasedSubresource{ 0, dstRegion.subresource.numArrayLayers, 0, 1 };
     dstTextureGL.CopyImageFromBuffer(
         dstRegion,
@@ -185,7 +195,7 @@ void GLImmediateCommandBuffer::CopyTextureFromFramebuffer(
     if (dstRegion.extent.depth != 1)
         return /*GL_INVALID_VALUE*/;
 
-    auto& dstTextureGL = LLGL_CAST(GLTexture&, dstTexture);
+    auto& dstTextureGL = LLGL_HOT_CAST(GLTexture&, dstTexture);
     GLFramebufferCapture::Get().CaptureFramebuffer(
         *stateMngr_,
         dstTextureGL,
@@ -198,13 +208,13 @@ void GLImmediateCommandBuffer::CopyTextureFromFramebuffer(
 
 void GLImmediateCommandBuffer::GenerateMips(Texture& texture)
 {
-    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    auto& textureGL = LLGL_HOT_CAST(GLTexture&, texture);
     GLMipGenerator::Get().GenerateMipsForTexture(*stateMngr_, textureGL);
 }
 
 void GLImmediateCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
-    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    auto& textureGL = LLGL_HOT_CAST(GLTexture&, texture);
     GLMipGenerator::Get().GenerateMipsRangeForTexture(
         *stateMngr_,
         textureGL,
@@ -288,17 +298,20 @@ void GLImmediateCommandBuffer::SetVertexBuffer(Buffer& buffer)
     if ((buffer.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
         /* Bind vertex buffer */
-        auto& vertexBufferGL = LLGL_CAST(GLBufferWithVAO&, buffer);
+        auto& vertexBufferGL = LLGL_HOT_CAST(GLBufferWithVAO&, buffer);
         vertexBufferGL.GetVertexArray()->Bind(*stateMngr_);
 
         #if LLGL_GLEXT_TRNASFORM_FEEDBACK2
         /* Store ID to transform feedback object */
         if ((buffer.GetBindFlags() & BindFlags::StreamOutputBuffer) != 0)
         {
-            auto& streamOutputBufferGL = LLGL_CAST(GLBufferWithXFB&, vertexBufferGL);
+            auto& streamOutputBufferGL = LLGL_HOT_CAST(GLBufferWithXFB&, vertexBufferGL);
             SetTransformFeedback(streamOutputBufferGL);
         }
         #endif // /LLGL_GLEXT_TRNASFORM_FEEDBACK2
+
+        /* Store vertex buffer in case it's used for compute stream-output */
+        SetComputeStreamOutputBuffer((buffer.GetBindFlags() & BindFlags::ComputeStreamOutput) != 0 ? &vertexBufferGL : nullptr);
     }
 }
 
@@ -307,15 +320,16 @@ void GLImmediateCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
     if ((bufferArray.GetBindFlags() & BindFlags::VertexBuffer) != 0)
     {
         /* Bind vertex buffer */
-        auto& vertexBufferArrayGL = LLGL_CAST(GLBufferArrayWithVAO&, bufferArray);
+        auto& vertexBufferArrayGL = LLGL_HOT_CAST(GLBufferArrayWithVAO&, bufferArray);
         vertexBufferArrayGL.GetVertexArray()->Bind(*stateMngr_);
+        SetComputeStreamOutputBuffer(nullptr);
     }
 }
 
 void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
     /* Bind index buffer deferred (can only be bound to the active VAO) */
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     stateMngr_->BindElementArrayBufferToVAO(bufferGL.GetID(), bufferGL.IsIndexType16Bits());
     SetIndexFormat(bufferGL.IsIndexType16Bits(), 0);
 }
@@ -323,7 +337,7 @@ void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer)
 void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
     /* Bind index buffer deferred (can only be bound to the active VAO) */
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     const bool indexType16Bits = (format == Format::R16UInt);
     stateMngr_->BindElementArrayBufferToVAO(bufferGL.GetID(), indexType16Bits);
     SetIndexFormat(indexType16Bits, offset);
@@ -333,7 +347,7 @@ void GLImmediateCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format forma
 
 void GLImmediateCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
 {
-    auto& resourceHeapGL = LLGL_CAST(GLResourceHeap&, resourceHeap);
+    auto& resourceHeapGL = LLGL_HOT_CAST(GLResourceHeap&, resourceHeap);
     resourceHeapGL.Bind(*stateMngr_, descriptorSet, GetBoundPipelineState()->GetBufferInterfaceMap());
     #if LLGL_GLEXT_MEMORY_BARRIERS
     InvalidateMemoryBarriers(GL_SHADER_STORAGE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT); //TODO: find optimal bitmask from resource heap
@@ -364,6 +378,31 @@ void GLImmediateCommandBuffer::SetResource(std::uint32_t descriptor, Resource& r
     }
 }
 
+void GLImmediateCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    auto* pipelineLayoutGL = GetBoundPipelineLayout();
+    if (pipelineLayoutGL == nullptr)
+        return /*GL_INVALID_VALUE*/;
+
+    const auto& bindingList = pipelineLayoutGL->GetBindings();
+    if (!(descriptor < bindingList.size()))
+        return /*GL_INVALID_INDEX*/;
+
+    /* Bind buffer range at explicit binding slot; Only uniform buffers can be bound as range */
+    const GLPipelineResourceBinding& binding = bindingList[descriptor];
+    if (binding.type == GLResourceType_UBO)
+    {
+        auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
+        stateMngr_->BindBufferRange(
+            GLBufferTarget::UniformBuffer,
+            binding.slot,
+            bufferGL.GetID(),
+            static_cast<GLintptr>(offset),
+            static_cast<GLsizeiptr>(size)
+        );
+    }
+}
+
 void GLImmediateCommandBuffer::ResourceBarrier(
     std::uint32_t       numBuffers,
     Buffer* const *     buffers,
@@ -389,14 +428,14 @@ void GLImmediateCommandBuffer::BindResource(GLResourceType type, GLuint slot, st
 
         case GLResourceType_UBO:
         {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, resource);
             stateMngr_->BindBufferBase(GLBufferTarget::UniformBuffer, slot, bufferGL.GetID());
         }
         break;
 
         case GLResourceType_Buffer:
         {
-            auto& bufferGL = LLGL_CAST(GLBuffer&, resource);
+            auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, resource);
 
             /* Lookup whether this is an SSBO, sampler buffer, or image buffer in buffer interface map */
             const GLShaderBufferInterfaceMap* bufferInterfaceMap = GetBoundPipelineState()->GetBufferInterfaceMap();
@@ -435,7 +474,7 @@ void GLImmediateCommandBuffer::BindResource(GLResourceType type, GLuint slot, st
 
         case GLResourceType_Texture:
         {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            auto& textureGL = LLGL_HOT_CAST(GLTexture&, resource);
             stateMngr_->BindGLTexture(slot, textureGL);
             #if LLGL_GLEXT_MEMORY_BARRIERS
             InvalidateMemoryBarriersForStorageResource(textureGL.GetBindFlags(), GL_TEXTURE_FETCH_BARRIER_BIT);
@@ -445,7 +484,7 @@ void GLImmediateCommandBuffer::BindResource(GLResourceType type, GLuint slot, st
 
         case GLResourceType_Image:
         {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            auto& textureGL = LLGL_HOT_CAST(GLTexture&, resource);
             stateMngr_->BindImageTexture(slot, 0, textureGL.GetGLInternalFormat(), textureGL.GetID());
             #if LLGL_GLEXT_MEMORY_BARRIERS
             InvalidateMemoryBarriersForStorageResource(textureGL.GetBindFlags(), GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
@@ -455,14 +494,14 @@ void GLImmediateCommandBuffer::BindResource(GLResourceType type, GLuint slot, st
 
         case GLResourceType_Sampler:
         {
-            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
+            auto& samplerGL = LLGL_HOT_CAST(GLSampler&, resource);
             stateMngr_->BindSampler(slot, samplerGL.GetID());
         }
         break;
 
         case GLResourceType_EmulatedSampler:
         {
-            auto& emulatedSamplerGL = LLGL_CAST(GLEmulatedSampler&, resource);
+            auto& emulatedSamplerGL = LLGL_HOT_CAST(GLEmulatedSampler&, resource);
             stateMngr_->BindEmulatedSampler(slot, emulatedSamplerGL);
         }
         break;
@@ -476,7 +515,7 @@ void GLImmediateCommandBuffer::BindCombinedResource(GLResourceType type, const G
     {
         case GLResourceType_Texture:
         {
-            auto& textureGL = LLGL_CAST(GLTexture&, resource);
+            auto& textureGL = LLGL_HOT_CAST(GLTexture&, resource);
             for_range(i, numSlots)
                 stateMngr_->BindGLTexture(slots[i], textureGL);
             #if LLGL_GLEXT_MEMORY_BARRIERS
@@ -488,7 +527,7 @@ void GLImmediateCommandBuffer::BindCombinedResource(GLResourceType type, const G
 
         case GLResourceType_Sampler:
         {
-            auto& samplerGL = LLGL_CAST(GLSampler&, resource);
+            auto& samplerGL = LLGL_HOT_CAST(GLSampler&, resource);
             for_range(i, numSlots)
                 stateMngr_->BindSampler(slots[i], samplerGL.GetID());
         }
@@ -496,7 +535,7 @@ void GLImmediateCommandBuffer::BindCombinedResource(GLResourceType type, const G
 
         case GLResourceType_EmulatedSampler:
         {
-            auto& emulatedSamplerGL = LLGL_CAST(GLEmulatedSampler&, resource);
+            auto& emulatedSamplerGL = LLGL_HOT_CAST(GLEmulatedSampler&, resource);
             for_range(i, numSlots)
                 stateMngr_->BindEmulatedSampler(slots[i], emulatedSamplerGL);
         }
@@ -527,16 +566,27 @@ void GLImmediateCommandBuffer::BeginRenderPass(
     /* Clear render target attachments with render pass */
     if (renderPass != nullptr)
     {
-        auto renderPassGL = LLGL_CAST(const GLRenderPass*, renderPass);
+        auto renderPassGL = LLGL_HOT_CAST(const GLRenderPass*, renderPass);
         stateMngr_->ClearAttachmentsWithRenderPass(*renderPassGL, numClearValues, clearValues);
+        renderPass_ = renderPassGL;
     }
+    else
+        renderPass_ = nullptr;
 }
 
 void GLImmediateCommandBuffer::EndRenderPass()
 {
     /* Resolve previously bound render target */
-    if (GLRenderTarget* renderTarget = stateMngr_->GetBoundRenderTarget())
+    GLRenderTarget* renderTarget = stateMngr_->GetBoundRenderTarget();
+    if (renderTarget != nullptr)
         renderTarget->ResolveMultisampled(*stateMngr_);
+
+    /* Invalidate attachments whose content is not stored by the render pass */
+    if (renderPass_ != nullptr)
+    {
+        stateMngr_->InvalidateAttachmentsWithRenderPass(*renderPass_, renderTarget);
+        renderPass_ = nullptr;
+    }
 }
 
 void GLImmediateCommandBuffer::Clear(long flags, const ClearValue& clearValue)
@@ -570,7 +620,7 @@ void GLImmediateCommandBuffer::ClearAttachments(std::uint32_t numAttachments, co
 void GLImmediateCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
     /* Bind graphics pipeline render states */
-    auto& pipelineStateGL = LLGL_CAST(GLPipelineState&, pipelineState);
+    auto& pipelineStateGL = LLGL_HOT_CAST(GLPipelineState&, pipelineState);
     pipelineStateGL.Bind(*stateMngr_);
     SetPipelineRenderState(pipelineStateGL);
 }
@@ -585,6 +635,11 @@ void GLImmediateCommandBuffer::SetStencilReference(std::uint32_t reference, cons
     stateMngr_->SetStencilRef(static_cast<GLint>(reference), GLTypes::Map(stencilFace));
 }
 
+void GLImmediateCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // dummy - not supported in OpenGL
+}
+
 void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
     /* Data size must be a multiple of 4 bytes */
@@ -595,19 +650,16 @@ void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data
     if (boundPipelineState == nullptr)
         return /*GL_INVALID_VALUE*/;
 
-    const std::uint32_t dataSizeInWords = dataSize / 4;
-    const auto& uniformMap = boundPipelineState->GetUniformMap();
-
-    for (auto words = static_cast<const std::uint32_t*>(data), wordsEnd = words + dataSizeInWords; words != wordsEnd; ++first)
+    if (boundPipelineState->HasUniformBlock())
     {
-        if (first >= uniformMap.size())
-            return /*GL_INVALID_INDEX*/;
-
-        const auto& uniform = uniformMap[first];
-        GLSetUniform(uniform.type, uniform.location, uniform.count, words);
-
-        words += uniform.wordSize;
+        /* Upload uniform block and bind it to its reserved binding point */
+        uniformBatch_.Clear();
+        const std::uint32_t index = uniformBatch_.Record(boundPipelineState, first, data, dataSize);
+        uniformBatch_.Flush(*stateMngr_);
+        uniformBatch_.Apply(index, *stateMngr_);
     }
+    else
+        boundPipelineState->SetUniforms(first, data, dataSize);
 }
 
 /* ----- Queries ----- */
@@ -615,21 +667,29 @@ void GLImmediateCommandBuffer::SetUniforms(std::uint32_t first, const void* data
 void GLImmediateCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
     /* Begin query with internal target */
-    auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
+    auto& queryHeapGL = LLGL_HOT_CAST(GLQueryHeap&, queryHeap);
     queryHeapGL.Begin(query);
 }
 
-void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t /*query*/)
+void GLImmediateCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    /* Begin query with internal target */
-    auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
-    queryHeapGL.End();
+    /* End query with internal target */
+    auto& queryHeapGL = LLGL_HOT_CAST(GLQueryHeap&, queryHeap);
+    queryHeapGL.End(query);
+}
+
+void GLImmediateCommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    /* Let the GL server write the query results into the destination buffer */
+    auto& queryHeapGL = LLGL_HOT_CAST(GLQueryHeap&, srcQueryHeap);
+    stateMngr_->BindBuffer(GLBufferTarget::QueryBuffer, LLGL_HOT_CAST(GLBuffer&, dstBuffer).GetID());
+    queryHeapGL.WriteResultsToBuffer(firstQuery, numQueries, static_cast<GLintptr>(dstOffset));
 }
 
 void GLImmediateCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     #if LLGL_GLEXT_CONDITIONAL_RENDER
-    auto& queryHeapGL = LLGL_CAST(GLQueryHeap&, queryHeap);
+    auto& queryHeapGL = LLGL_HOT_CAST(GLQueryHeap&, queryHeap);
     glBeginConditionalRender(queryHeapGL.GetID(query), GLTypes::Map(mode));
     #endif
 }
@@ -653,13 +713,13 @@ void GLImmediateCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffe
 
     if (numBuffers > 0)
     {
-        auto* bufferWithXfbGL = LLGL_CAST(GLBufferWithXFB*, buffers[0]);
+        auto* bufferWithXfbGL = LLGL_HOT_CAST(GLBufferWithXFB*, buffers[0]);
         GLBufferWithXFB::BeginTransformFeedback(*stateMngr_, *bufferWithXfbGL, GetPrimitiveMode());
     }
 
     for_range(i, numBuffers)
     {
-        auto* bufferGL = LLGL_CAST(GLBuffer*, buffers[i]);
+        auto* bufferGL = LLGL_HOT_CAST(GLBuffer*, buffers[i]);
         soTargets[i] = bufferGL->GetID();
     }
 
@@ -707,7 +767,7 @@ The indices actually store the index start offset, but must be passed to GL as a
 
 #if LLGL_GLEXT_MEMORY_BARRIERS
 #   define LLGL_FLUSH_MEMORY_BARRIERS() \
-        if (GLbitfield barriers = FlushAndGetMemoryBarriers()) { glMemoryBarrier(barriers); }
+        if (GLbitfield barriers = FlushAndGetMemoryBarriers()) { glMemoryBarrier(barriers); LLGL_PROFILE_COUNTER_ADD(barriers, 1); }
 #else
 #   define LLGL_FLUSH_MEMORY_BARRIERS()
 #endif // /LLGL_GLEXT_MEMORY_BARRIERS
@@ -824,7 +884,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
     #if LLGL_GLEXT_DRAW_INDIRECT
     LLGL_FLUSH_MEMORY_BARRIERS();
 
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
 
     const GLintptr indirect = static_cast<GLintptr>(offset);
@@ -841,7 +901,7 @@ void GLImmediateCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset
     LLGL_FLUSH_MEMORY_BARRIERS();
 
     /* Bind indirect argument buffer */
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
 
     GLintptr indirect = static_cast<GLintptr>(offset);
@@ -877,7 +937,7 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     #if LLGL_GLEXT_DRAW_INDIRECT
     LLGL_FLUSH_MEMORY_BARRIERS();
 
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
 
     const GLintptr indirect = static_cast<GLintptr>(offset);
@@ -895,7 +955,7 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     LLGL_FLUSH_MEMORY_BARRIERS();
 
     /* Bind indirect argument buffer */
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, bufferGL.GetID());
 
     GLintptr indirect = static_cast<GLintptr>(offset);
@@ -928,8 +988,55 @@ void GLImmediateCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t
     #endif // /LLGL_GLEXT_DRAW_INDIRECT
 }
 
+void GLImmediateCommandBuffer::DrawIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #if LLGL_GLEXT_INDIRECT_PARAMETERS
+    LLGL_FLUSH_MEMORY_BARRIERS();
+
+    /* Bind indirect argument buffer and parameter buffer for the draw count */
+    stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, LLGL_HOT_CAST(GLBuffer&, buffer).GetID());
+    stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, LLGL_HOT_CAST(GLBuffer&, countBuffer).GetID());
+
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    glMultiDrawArraysIndirectCount(
+        GetDrawMode(),
+        reinterpret_cast<const GLvoid*>(indirect),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #endif // /LLGL_GLEXT_INDIRECT_PARAMETERS
+}
+
+void GLImmediateCommandBuffer::DrawIndexedIndirectCount(Buffer& buffer, std::uint64_t offset, Buffer& countBuffer, std::uint64_t countOffset, std::uint32_t maxNumCommands, std::uint32_t stride)
+{
+    #if LLGL_GLEXT_INDIRECT_PARAMETERS
+    LLGL_FLUSH_MEMORY_BARRIERS();
+
+    /* Bind indirect argument buffer and parameter buffer for the draw count */
+    stateMngr_->BindBuffer(GLBufferTarget::DrawIndirectBuffer, LLGL_HOT_CAST(GLBuffer&, buffer).GetID());
+    stateMngr_->BindBuffer(GLBufferTarget::ParameterBuffer, LLGL_HOT_CAST(GLBuffer&, countBuffer).GetID());
+
+    const GLintptr indirect = static_cast<GLintptr>(offset);
+    glMultiDrawElementsIndirectCount(
+        GetDrawMode(),
+        GetIndexType(),
+        reinterpret_cast<const GLvoid*>(indirect),
+        static_cast<GLintptr>(countOffset),
+        static_cast<GLsizei>(maxNumCommands),
+        static_cast<GLsizei>(stride)
+    );
+    #endif // /LLGL_GLEXT_INDIRECT_PARAMETERS
+}
+
 void GLImmediateCommandBuffer::DrawStreamOutput()
 {
+    if (GLBuffer* computeSOBufferGL = GetRenderState().boundComputeSOBuffer)
+    {
+        /* Draw with the arguments that were written by a compute shader at the end of the vertex buffer */
+        DrawIndirect(*computeSOBufferGL, GetComputeStreamOutputArgsOffset(static_cast<std::uint64_t>(computeSOBufferGL->GetSize())));
+        return;
+    }
     if (GLBufferWithXFB* bufferWithXfbGL = GetRenderState().boundBufferWithFxb)
     {
         LLGL_FLUSH_MEMORY_BARRIERS();
@@ -948,6 +1055,44 @@ void GLImmediateCommandBuffer::DrawStreamOutput()
     }
 }
 
+void GLImmediateCommandBuffer::DrawMeshTasks(
+    std::uint32_t   /*numWorkGroupsX*/,
+    std::uint32_t   /*numWorkGroupsY*/,
+    std::uint32_t   /*numWorkGroupsZ*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLImmediateCommandBuffer::DrawMeshTasksIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    std::uint32_t   /*numCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLImmediateCommandBuffer::DispatchTiles()
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLImmediateCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLImmediateCommandBuffer::DrawPacked(const DrawPackedDescriptor& drawDesc)
+{
+    EncodePackedDraws(*this, drawDesc);
+}
+
 /* ----- Compute ----- */
 
 void GLImmediateCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -962,12 +1107,28 @@ void GLImmediateCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t of
 {
     #if LLGL_GLEXT_COMPUTE_SHADER
     LLGL_FLUSH_MEMORY_BARRIERS();
-    auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
+    auto& bufferGL = LLGL_HOT_CAST(GLBuffer&, buffer);
     stateMngr_->BindBuffer(GLBufferTarget::DispatchIndirectBuffer, bufferGL.GetID());
     glDispatchComputeIndirect(static_cast<GLintptr>(offset));
     #endif
 }
 
+/* ----- Ray Tracing ----- */
+
+void GLImmediateCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    // dummy - not supported in OpenGL
+}
+
+void GLImmediateCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    // dummy - not supported in OpenGL
+}
+
 /* ----- Debugging ----- */
 
 void GLImmediateCommandBuffer::PushDebugGroup(const char* name)
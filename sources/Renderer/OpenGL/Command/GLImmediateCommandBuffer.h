@@ -10,6 +10,7 @@
 
 
 #include "GLCommandBuffer.h"
+#include "../Buffer/GLUniformBatch.h"
 #include <memory>
 
 
@@ -29,6 +30,12 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
 
         #include "GLCommandBuffer.inl"
 
+    public:
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void DrawPacked(const DrawPackedDescriptor& drawDesc) override;
+
     public:
 
         GLImmediateCommandBuffer();
@@ -45,7 +52,9 @@ class GLImmediateCommandBuffer final : public GLCommandBuffer
 
     private:
 
-        GLStateManager* stateMngr_ = nullptr;
+        GLStateManager*     stateMngr_      = nullptr;
+        GLUniformBatch      uniformBatch_;
+        const GLRenderPass* renderPass_     = nullptr; // Render pass of the active BeginRenderPass/EndRenderPass block
 
 };
 
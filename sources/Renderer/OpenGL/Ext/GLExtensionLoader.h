@@ -19,8 +19,9 @@ namespace LLGL
 /*
 Loads all suported OpenGL extensions (suported by both the OpenGL server and LLGL) and returns true on success.
 Otherwise, at least one extension was erroneously reported as available while their respective procedures could not be loaded.
+If 'lazyLoading' is true, the procedures of supported extensions are resolved on their first invocation instead; see RendererConfigurationOpenGL::lazyProcLoading.
 */
-bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure = false);
+bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure = false, bool lazyLoading = false);
 
 // Returns true if all available extensions have been loaded.
 bool AreOpenGLExtensionsLoaded();
@@ -30,6 +30,7 @@ enum class GLExt
 {
     /* OpenGL core extensions (ARB) */
     ARB_base_instance = 0,              // GL 4.1
+    ARB_bindless_texture,
     ARB_clear_buffer_object,
     ARB_clear_texture,
     ARB_clip_control,
@@ -49,9 +50,11 @@ enum class GLExt
     ARB_get_texture_sub_image,          // GL 4.5
     ARB_geometry_shader4,               // no procedures
     ARB_gl_spirv,                       // GL 4.6
+    ARB_indirect_parameters,            // GL 4.6
     ARB_instanced_arrays,               // GL 2.1
     ARB_internalformat_query,
     ARB_internalformat_query2,
+    ARB_invalidate_subdata,             // GL 4.3
     ARB_multitexture,                   // GL 1.2
     ARB_multi_bind,                     // GL 4.3
     ARB_multi_draw_indirect,
@@ -59,6 +62,7 @@ enum class GLExt
     ARB_pipeline_statistics_query,
     ARB_polygon_offset_clamp,
     ARB_program_interface_query,        // GL 4.2
+    ARB_query_buffer_object,            // GL 4.4
     ARB_sampler_objects,                // GL 3.2
     ARB_seamless_cubemap_per_texture,   // GL 3.2
     ARB_shader_image_load_store,
@@ -94,6 +98,8 @@ enum class GLExt
 
     /* Khronos group extensions (KHR) */
     KHR_debug,
+    KHR_parallel_shader_compile,
+    KHR_texture_compression_astc_hdr,
 
     /* Multi-vendor extensions (EXT) */
     EXT_blend_color,
@@ -103,6 +109,7 @@ enum class GLExt
     EXT_copy_texture,                   // GL 1.2
     EXT_draw_buffers2,
     EXT_gpu_shader4,                    // GL 2.0
+    EXT_shader_framebuffer_fetch,       // no procedures
     EXT_stencil_two_side,               //ATI_separate_stencil,
     EXT_texture3D,                      // GL 1.2
     EXT_texture_array,                  // no procedures
@@ -115,6 +122,10 @@ enum class GLExt
     NV_conditional_render,              //TODO: part of GL 3.0 core profile
     NV_conservative_raster,             // no procedures
     NV_transform_feedback,
+    NVX_gpu_memory_info,                // no procedures
+
+    /* Oculus specific extensions (OVR) */
+    OVR_multiview2,                     // Procedures of GL_OVR_multiview
 
     /* Intel sepcific extensions (INTEL) */
     INTEL_conservative_rasterization,   // no procedures
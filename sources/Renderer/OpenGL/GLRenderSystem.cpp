@@ -9,10 +9,13 @@
 #include "Profile/GLProfile.h"
 #include "Texture/GLMipGenerator.h"
 #include "Texture/GLTextureViewPool.h"
+#include "Texture/GLBindlessTexturePool.h"
 #include "Texture/GLFramebufferCapture.h"
+#include "Texture/GLPixelUnpackRing.h"
 #include "Ext/GLExtensions.h"
 #include "Ext/GLExtensionRegistry.h"
 #include "RenderState/GLStatePool.h"
+#include "RenderState/GLWorkerFenceQueue.h"
 #include "../RenderSystemUtils.h"
 #include "GLTypes.h"
 #include "GLCore.h"
@@ -24,8 +27,10 @@
 #include "../BufferUtils.h"
 #include "../TextureUtils.h"
 #include "../RenderTargetUtils.h"
+#include "../PipelineStateUtils.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Assertion.h"
+#include "../../Core/HashUtils.h"
 #include "../../Platform/Debug.h"
 #include "GLRenderingCaps.h"
 #include "Ext/GLExtensionLoader.h"
@@ -34,6 +39,7 @@
 #include "RenderState/GLGraphicsPSO.h"
 #include "RenderState/GLComputePSO.h"
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/ThreadPool.h>
 
 #ifdef LLGL_OPENGL
 #   include "Shader/GLSeparableShader.h"
@@ -46,6 +52,33 @@ namespace LLGL
 
 /* ----- Common ----- */
 
+/*
+Scope for creating and updating resources that might be called from worker threads:
+Serializes access to the resource containers and fences the commands of a worker context when the scope ends,
+so the primary GL context waits for the resource before its first use. See GLContextManager::MakeWorkerContextCurrent().
+*/
+class GLResourceScope
+{
+
+    public:
+
+        GLResourceScope(std::mutex& mutex) :
+            guard_ { mutex }
+        {
+        }
+
+        ~GLResourceScope()
+        {
+            if (GLContextManager::IsWorkerThread())
+                GLWorkerFenceQueue::Get().Submit();
+        }
+
+    private:
+
+        std::lock_guard<std::mutex> guard_;
+
+};
+
 static RendererConfigurationOpenGL GetGLProfileFromDesc(const RenderSystemDescriptor& renderSystemDesc)
 {
     if (auto* rendererConfigGL = GetRendererConfiguration<RendererConfigurationOpenGL>(renderSystemDesc))
@@ -60,28 +93,40 @@ GLRenderSystem::GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         GetGLProfileFromDesc(renderSystemDesc),
         std::bind(&GLRenderSystem::RegisterNewGLContext, this, std::placeholders::_1, std::placeholders::_2),
         renderSystemDesc.nativeHandle,
-        renderSystemDesc.nativeHandleSize
+        renderSystemDesc.nativeHandleSize,
+        ((renderSystemDesc.flags & RenderSystemFlags::Headless) != 0),
+        renderSystemDesc.adapterIndex
     },
     debugContext_
     {
         ((renderSystemDesc.flags & RenderSystemFlags::DebugDevice) != 0)
     }
 {
+    if (IsAdapterSelectedByID(renderSystemDesc))
+        LLGL_TRAP("OpenGL cannot select video adapter by LUID or UUID; use RenderSystemDescriptor::adapterIndex with RenderSystemFlags::Headless instead");
+
+    /* GL pipeline cache ID is not available until the first GL context is created, so the store is opened lazily */
+    pipelineCacheStore_.SetDirectory(renderSystemDesc.pipelineCacheDirectory);
 }
 
 GLRenderSystem::~GLRenderSystem()
 {
     /* Clear all render state containers first, the rest will be deleted automatically */
     GLFramebufferCapture::Get().Clear();
+    GLBindlessTexturePool::Get().Clear();
     GLTextureViewPool::Get().Clear();
     GLMipGenerator::Get().Clear();
+    GLPixelUnpackRing::Get().Clear();
     GLStatePool::Get().Clear();
+    GLWorkerFenceQueue::Get().Clear();
 }
 
 /* ----- Swap-chain ----- */
 
 SwapChain* GLRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
+    if (contextMngr_.IsHeadless())
+        LLGL_TRAP("cannot create swap-chain for headless render system; see RenderSystemFlags::Headless");
     return swapChains_.emplace<GLSwapChain>(*this, swapChainDesc, surface, contextMngr_);
 }
 
@@ -90,6 +135,21 @@ void GLRenderSystem::Release(SwapChain& swapChain)
     swapChains_.erase(&swapChain);
 }
 
+void GLRenderSystem::PrepareSwapChainAsync(const SwapChainDescriptor& swapChainDesc)
+{
+    if (contextMngr_.IsHeadless())
+        return;
+
+    /* Choose the pixel format on a worker thread; GLContext::Create() waits for it if the same pixel format is requested in the meantime */
+    const GLPixelFormat pixelFormat = GLSwapChain::GetPixelFormatFromDesc(swapChainDesc);
+    prepareSwapChainJob_.Start(
+        [pixelFormat]() -> void
+        {
+            GLContext::PreparePixelFormat(pixelFormat);
+        }
+    );
+}
+
 /* ----- Command queues ----- */
 
 CommandQueue* GLRenderSystem::GetCommandQueue()
@@ -116,15 +176,27 @@ void GLRenderSystem::Release(CommandBuffer& commandBuffer)
 
 /* ----- Buffers ------ */
 
-static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags)
+// Returns true if the specified buffer can be mapped persistently, i.e. 'GL_ARB_buffer_storage' is available.
+static bool IsGLBufferPersistentlyMappable(const BufferDescriptor& bufferDesc)
+{
+    #if GL_ARB_buffer_storage
+    return
+    (
+        (bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0 &&
+        (bufferDesc.cpuAccessFlags & CPUAccessFlags::ReadWrite) != 0 &&
+        HasExtension(GLExt::ARB_buffer_storage)
+    );
+    #else
+    return false;
+    #endif // /GL_ARB_buffer_storage
+}
+
+static GLbitfield GetGLBufferMapFlags(long cpuAccessFlags)
 {
     #if GL_ARB_buffer_storage
 
     GLbitfield flagsGL = 0;
 
-    /* Allways enable dynamic storage, to enable usage of 'glBufferSubData' */
-    flagsGL |= GL_DYNAMIC_STORAGE_BIT;
-
     if ((cpuAccessFlags & CPUAccessFlags::Read) != 0)
         flagsGL |= GL_MAP_READ_BIT;
     if ((cpuAccessFlags & CPUAccessFlags::Write) != 0)
@@ -139,6 +211,29 @@ static GLbitfield GetGLBufferStorageFlags(long cpuAccessFlags)
     #endif // /GL_ARB_buffer_storage
 }
 
+static GLbitfield GetGLBufferStorageFlags(const BufferDescriptor& bufferDesc)
+{
+    #if GL_ARB_buffer_storage
+
+    GLbitfield flagsGL = 0;
+
+    /* Allways enable dynamic storage, to enable usage of 'glBufferSubData' */
+    flagsGL |= GL_DYNAMIC_STORAGE_BIT;
+    flagsGL |= GetGLBufferMapFlags(bufferDesc.cpuAccessFlags);
+
+    /* Persistent mapping is always coherent, so CPU writes become visible to the GPU without explicit flushes */
+    if (IsGLBufferPersistentlyMappable(bufferDesc))
+        flagsGL |= GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    return flagsGL;
+
+    #else
+
+    return 0;
+
+    #endif // /GL_ARB_buffer_storage
+}
+
 static GLenum GetGLBufferUsage(long miscFlags)
 {
     return ((miscFlags & MiscFlags::DynamicUsage) != 0 ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
@@ -149,13 +244,18 @@ static void GLBufferStorage(GLBuffer& bufferGL, const BufferDescriptor& bufferDe
     bufferGL.BufferStorage(
         static_cast<GLsizeiptr>(bufferDesc.size),
         initialData,
-        GetGLBufferStorageFlags(bufferDesc.cpuAccessFlags),
+        GetGLBufferStorageFlags(bufferDesc),
         GetGLBufferUsage(bufferDesc.miscFlags)
     );
+
+    /* Keep buffer mapped for its entire lifetime */
+    if (IsGLBufferPersistentlyMappable(bufferDesc))
+        bufferGL.MapPersistent(static_cast<GLsizeiptr>(bufferDesc.size), GetGLBufferMapFlags(bufferDesc.cpuAccessFlags));
 }
 
 Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
 {
+    GLResourceScope scope{ resourceMutex_ };
     CreateGLContextOnce();
     RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max()));
 
@@ -172,6 +272,8 @@ Buffer* GLRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const v
         bufferGL->CreateTexBuffer(internalFormat);
     }
 
+    CheckMemoryBudget();
+
     return bufferGL;
 }
 
@@ -223,6 +325,12 @@ static bool IsBufferArrayWithVertexBufferBinding(std::uint32_t numBuffers, Buffe
     return false;
 }
 
+void GLRenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    for_range(i, bufferDescs.size())
+        outBuffers[i] = CreateBuffer(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr));
+}
+
 BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
 {
     CreateGLContextOnce();
@@ -237,9 +345,17 @@ BufferArray* GLRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void GLRenderSystem::Release(Buffer& buffer)
 {
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
     buffers_.erase(&buffer);
 }
 
+void GLRenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
+    for (Buffer* buffer : buffers)
+        buffers_.erase(buffer);
+}
+
 void GLRenderSystem::Release(BufferArray& bufferArray)
 {
     bufferArrays_.erase(&bufferArray);
@@ -247,6 +363,7 @@ void GLRenderSystem::Release(BufferArray& bufferArray)
 
 void GLRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
 {
+    GLResourceScope scope{ resourceMutex_ };
     auto& bufferGL = LLGL_CAST(GLBuffer&, buffer);
     bufferGL.BufferSubData(static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(dataSize), data);
 }
@@ -341,6 +458,7 @@ void GLRenderSystem::ValidateGLTextureType(const TextureType type)
 
 Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
+    GLResourceScope scope{ resourceMutex_ };
     CreateGLContextOnce();
     ValidateGLTextureType(textureDesc.type);
 
@@ -350,43 +468,93 @@ Texture* GLRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, con
     /* Initialize either renderbuffer or texture image storage */
     textureGL->BindAndAllocStorage(textureDesc, initialImage);
 
+    CheckMemoryBudget();
+
     return textureGL;
 }
 
+void GLRenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    for_range(i, textureDescs.size())
+        outTextures[i] = CreateTexture(textureDescs[i], (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr));
+}
+
 void GLRenderSystem::Release(Texture& texture)
 {
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
     textures_.erase(&texture);
 }
 
-void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
+void GLRenderSystem::Release(const ArrayView<Texture*>& textures)
 {
-    /* Bind texture and write texture sub data */
-    auto& textureGL = LLGL_CAST(GLTexture&, texture);
-    textureGL.TextureSubImage(textureRegion, srcImageView, false);
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
+    for (Texture* texture : textures)
+        textures_.erase(texture);
 }
 
-void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
+void GLRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
 {
-    /* Bind texture and write texture sub data */
-    LLGL_ASSERT_PTR(dstImageView.data);
+    GLResourceScope scope{ resourceMutex_ };
     auto& textureGL = LLGL_CAST(GLTexture&, texture);
 
+    /* Stage image data in the pixel unpack ring, so the driver doesn't have to copy client memory synchronously; The ring is only used by the primary GL context */
+    GLPixelUnpackRing& unpackRing = GLPixelUnpackRing::Get();
+    GLintptr unpackOffset = 0;
+    if (!GLContextManager::IsWorkerThread() && unpackRing.Write(srcImageView.data, srcImageView.dataSize, unpackOffset))
+    {
+        ImageView unpackImageView = srcImageView;
+        unpackImageView.data = reinterpret_cast<const void*>(unpackOffset);
+
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, unpackRing.GetBufferID());
+        textureGL.TextureSubImage(textureRegion, unpackImageView, false);
+        GLStateManager::Get().BindBuffer(GLBufferTarget::PixelUnpackBuffer, 0);
+    }
+    else
+    {
+        /* Bind texture and write texture sub data */
+        textureGL.TextureSubImage(textureRegion, srcImageView, false);
+    }
+}
+
+// Ensures all shader writes to the specified texture have completed before it is read back.
+static void GLTextureReadbackBarrier(const GLTexture& textureGL)
+{
     #if LLGL_GLEXT_MEMORY_BARRIERS
     if ((textureGL.GetBindFlags() & BindFlags::Storage) != 0)
     {
-        /* Ensure all shader writes to the texture completed */
         if (HasExtension(GLExt::ARB_shader_image_load_store))
             glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT);
     }
     #endif // /LLGL_GLEXT_MEMORY_BARRIERS
+}
 
+void GLRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
+{
+    /* Bind texture and write texture sub data */
+    LLGL_ASSERT_PTR(dstImageView.data);
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    GLTextureReadbackBarrier(textureGL);
     textureGL.GetTextureSubImage(textureRegion, dstImageView, false);
 }
 
+void GLRenderSystem::ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence)
+{
+    LLGL_ASSERT_PTR(dstImageView.data);
+    auto& textureGL = LLGL_CAST(GLTexture&, texture);
+    auto& fenceGL = LLGL_CAST(GLFence&, fence);
+    GLTextureReadbackBarrier(textureGL);
+
+    /* Pack image data into a pixel buffer, fence the transfer, and only map the buffer once the fence has been signaled */
+    std::unique_ptr<GLBuffer> packBuffer = textureGL.GetTextureSubImageAsync(textureRegion, dstImageView);
+    fenceGL.Submit();
+    fenceGL.AddPendingReadback(std::move(packBuffer), dstImageView.data, dstImageView.dataSize);
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 {
+    GLResourceScope scope{ resourceMutex_ };
     CreateGLContextOnce();
     if (!HasNativeSamplers())
     {
@@ -406,6 +574,8 @@ Sampler* GLRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
 
 void GLRenderSystem::Release(Sampler& sampler)
 {
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
+
     /* If GL_ARB_sampler_objects is not supported, release emulated sampler states */
     if (!HasNativeSamplers())
         emulatedSamplers_.erase(&sampler);
@@ -462,6 +632,7 @@ void GLRenderSystem::Release(RenderTarget& renderTarget)
 
 Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
 {
+    GLResourceScope scope{ resourceMutex_ };
     CreateGLContextOnce();
     RenderSystem::AssertCreateShader(shaderDesc);
 
@@ -478,6 +649,13 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
         case ShaderType::Compute:
             LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasComputeShaders);
             break;
+        case ShaderType::Task:
+        case ShaderType::Mesh:
+            LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasMeshShaders);
+            break;
+        case ShaderType::Tile:
+            LLGL_ASSERT_RENDERING_FEATURE_SUPPORT(hasTileShaders);
+            break;
         default:
             break;
     }
@@ -486,8 +664,8 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     #ifdef LLGL_OPENGL
     if (HasExtension(GLExt::ARB_separate_shader_objects) && (shaderDesc.flags & ShaderCompileFlags::SeparateShader) != 0)
     {
-        /* Create separable shader for program pipeline */
-        return shaders_.emplace<GLSeparableShader>(shaderDesc);
+        /* Create separable shader for program pipeline and load its program binaries from the persistent cache if possible */
+        return shaders_.emplace<GLSeparableShader>(shaderDesc, (OpenPipelineCacheStoreOnce() ? &pipelineCacheStore_ : nullptr));
     }
     else
     #endif
@@ -497,8 +675,16 @@ Shader* GLRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     }
 }
 
+void GLRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    /* GL shaders must be compiled on the thread that holds the GL context */
+    for_range(i, shaderDescs.size())
+        outShaders[i] = CreateShader(shaderDescs[i]);
+}
+
 void GLRenderSystem::Release(Shader& shader)
 {
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
     shaders_.erase(&shader);
 }
 
@@ -506,11 +692,14 @@ void GLRenderSystem::Release(Shader& shader)
 
 PipelineLayout* GLRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
+    GLResourceScope scope{ resourceMutex_ };
+    CreateGLContextOnce();
     return pipelineLayouts_.emplace<GLPipelineLayout>(pipelineLayoutDesc);
 }
 
 void GLRenderSystem::Release(PipelineLayout& pipelineLayout)
 {
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
     pipelineLayouts_.erase(&pipelineLayout);
 }
 
@@ -534,8 +723,34 @@ void GLRenderSystem::Release(PipelineCache& pipelineCache)
 
 /* ----- Pipeline States ----- */
 
+// Returns the key for the persistent pipeline cache of the GL program that is linked from the specified shaders.
+static std::uint64_t GetGLProgramCacheStoreKey(const ArrayView<Shader*>& shaders)
+{
+    std::uint64_t seed = g_hashSeed;
+    for (Shader* shader : shaders)
+    {
+        if (shader != nullptr)
+            HashValue(seed, LLGL_CAST(const GLShader*, shader)->GetContentHash());
+    }
+    return seed;
+}
+
 PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    GLResourceScope scope{ resourceMutex_ };
+    CreateGLContextOnce();
+
+    /* Asynchronously linked PSOs bypass the persistent cache, because retrieving the program binary would block */
+    if (pipelineCache == nullptr && (pipelineStateDesc.flags & PipelineStateFlags::AsyncCompilation) == 0 && OpenPipelineCacheStoreOnce())
+    {
+        /* Load program binary from persistent cache and store it again if the program had to be linked */
+        const std::uint64_t key = GetGLProgramCacheStoreKey(GetShadersAsArray(pipelineStateDesc));
+        GLPipelineCache persistentCache{ pipelineCacheStore_.Read(key) };
+        PipelineState* pipelineState = pipelineStates_.emplace<GLGraphicsPSO>(pipelineStateDesc, GetRenderingCaps().limits, &persistentCache);
+        if (persistentCache.IsModified())
+            pipelineCacheStore_.Write(key, persistentCache.GetBlob());
+        return pipelineState;
+    }
     return pipelineStates_.emplace<GLGraphicsPSO>(
         pipelineStateDesc,
         GetRenderingCaps().limits,
@@ -545,14 +760,49 @@ PipelineState* GLRenderSystem::CreatePipelineState(const GraphicsPipelineDescrip
 
 PipelineState* GLRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
 {
+    GLResourceScope scope{ resourceMutex_ };
+    CreateGLContextOnce();
+
+    /* Asynchronously linked PSOs bypass the persistent cache, because retrieving the program binary would block */
+    if (pipelineCache == nullptr && (pipelineStateDesc.flags & PipelineStateFlags::AsyncCompilation) == 0 && OpenPipelineCacheStoreOnce())
+    {
+        /* Load program binary from persistent cache and store it again if the program had to be linked */
+        const std::uint64_t key = GetGLProgramCacheStoreKey(GetShadersAsArray(pipelineStateDesc));
+        GLPipelineCache persistentCache{ pipelineCacheStore_.Read(key) };
+        PipelineState* pipelineState = pipelineStates_.emplace<GLComputePSO>(pipelineStateDesc, &persistentCache);
+        if (persistentCache.IsModified())
+            pipelineCacheStore_.Write(key, persistentCache.GetBlob());
+        return pipelineState;
+    }
     return pipelineStates_.emplace<GLComputePSO>(
         pipelineStateDesc,
         (GetRenderingCaps().features.hasPipelineCaching ? pipelineCache : nullptr)
     );
 }
 
+void GLRenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    /* GL programs must be linked on the thread that holds the GL context */
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+void GLRenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    /* GL programs must be linked on the thread that holds the GL context */
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+PipelineState* GLRenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& /*pipelineStateDesc*/, PipelineCache* /*pipelineCache*/)
+{
+    /* OpenGL has no ray tracing pipelines */
+    return nullptr;
+}
+
 void GLRenderSystem::Release(PipelineState& pipelineState)
 {
+    std::lock_guard<std::mutex> guard{ resourceMutex_ };
     pipelineStates_.erase(&pipelineState);
 }
 
@@ -597,7 +847,26 @@ bool GLRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
 
 void GLRenderSystem::CreateGLContextOnce()
 {
-    (void)contextMngr_.AllocContext();
+    /* Resources that are created on worker threads use a background context that is shared with the primary context */
+    if (contextMngr_.IsPrimaryThread())
+        (void)contextMngr_.AllocContext();
+    else
+        contextMngr_.MakeWorkerContextCurrent();
+}
+
+bool GLRenderSystem::OpenPipelineCacheStoreOnce()
+{
+    if (!pipelineCacheStore_.IsEnabled() || !GetRenderingCaps().features.hasPipelineCaching)
+        return false;
+
+    if (!pipelineCacheStore_.IsOpen())
+    {
+        std::vector<char> cacheID;
+        GLQueryPipelineCacheID(cacheID);
+        pipelineCacheStore_.Open(cacheID);
+    }
+
+    return pipelineCacheStore_.IsOpen();
 }
 
 void GLRenderSystem::RegisterNewGLContext(GLContext& /*context*/, const GLPixelFormat& pixelFormat)
@@ -605,6 +874,15 @@ void GLRenderSystem::RegisterNewGLContext(GLContext& /*context*/, const GLPixelF
     /* Enable debug callback function */
     if (debugContext_)
         EnableDebugCallback();
+
+    #if LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    /*
+    Match the number of driver threads for asynchronous shader compilation to the LLGL worker thread pool.
+    The thread that dispatches work is counted as well, so a pool without worker threads still compiles in the background.
+    */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+        glMaxShaderCompilerThreadsKHR(static_cast<GLuint>(ThreadPool::GetNumThreads()) + 1u);
+    #endif
 }
 
 #if LLGL_GLEXT_DEBUG
@@ -748,6 +1026,50 @@ bool GLRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabi
     return true;
 }
 
+std::uint32_t GLRenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos)
+{
+    #ifdef GL_NVX_gpu_memory_info
+    if (HasExtension(GLExt::NVX_gpu_memory_info))
+    {
+        if (outHeapInfos != nullptr && maxHeapInfos >= 1)
+        {
+            /* GL_NVX_gpu_memory_info reports all values in KB */
+            GLint dedicatedVidMem = 0, totalAvailableMem = 0, currentAvailableVidMem = 0;
+            glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &dedicatedVidMem);
+            glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &totalAvailableMem);
+            glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &currentAvailableVidMem);
+
+            const std::uint64_t totalAvailableSize      = static_cast<std::uint64_t>(totalAvailableMem) * 1024u;
+            const std::uint64_t currentAvailableSize    = static_cast<std::uint64_t>(currentAvailableVidMem) * 1024u;
+
+            outHeapInfos[0].flags   = MemoryHeapFlags::DeviceLocal;
+            outHeapInfos[0].size    = static_cast<std::uint64_t>(dedicatedVidMem) * 1024u;
+            outHeapInfos[0].usage   = (totalAvailableSize > currentAvailableSize ? totalAvailableSize - currentAvailableSize : 0);
+            outHeapInfos[0].budget  = totalAvailableSize;
+        }
+        return 1;
+    }
+    #endif // /GL_NVX_gpu_memory_info
+    return 0;
+}
+
+std::uint32_t GLRenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    /* OpenGL provides no adapter enumeration, so only report the adapter of the current GL context */
+    if (outAdapters != nullptr && maxAdapters > 0)
+    {
+        AdapterInfo& adapter = outAdapters[0];
+        adapter             = AdapterInfo{};
+        adapter.name        = GetRendererInfo().deviceName;
+        adapter.isActive    = true;
+
+        MemoryHeapInfo heapInfo;
+        if (QueryMemoryHeapInfos(&heapInfo, 1) == 1)
+            adapter.videoMemory = heapInfo.size;
+    }
+    return 1;
+}
+
 
 } // /namespace LLGL
 
@@ -38,11 +38,14 @@
 #include "RenderState/GLResourceHeap.h"
 
 #include "../ProxyPipelineCache.h"
+#include "../PipelineCacheStore.h"
+#include "../../Core/Threading.h"
 
 #include <string>
 #include <memory>
 #include <vector>
 #include <set>
+#include <mutex>
 
 
 namespace LLGL
@@ -64,6 +67,12 @@ class GLRenderSystem final : public RenderSystem
         GLRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
         ~GLRenderSystem();
 
+    public:
+
+        void PrepareSwapChainAsync(const SwapChainDescriptor& swapChainDesc) override;
+
+        void ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence) override;
+
     public:
 
         inline bool IsBreakOnErrorEnabled() const
@@ -89,14 +98,19 @@ class GLRenderSystem final : public RenderSystem
 
         void ValidateGLTextureType(const TextureType type);
 
+        // Opens the persistent pipeline cache store on first use and returns true if it can be used. See RenderSystemDescriptor::pipelineCacheDirectory.
+        bool OpenPipelineCacheStoreOnce();
+
     private:
 
         /* ----- Hardware object containers ----- */
 
         GLContextManager                        contextMngr_;
         GLCommandQueue                          commandQueue_;
+        PipelineCacheStore                      pipelineCacheStore_;
         bool                                    debugContext_           = false;
         bool                                    isBreakOnErrorEnabled_  = false;
+        std::mutex                              resourceMutex_;         // Guards resource creation from worker threads; see GLContextManager::MakeWorkerContextCurrent()
 
         HWObjectContainer<GLSwapChain>          swapChains_;
         HWObjectContainer<GLCommandBuffer>      commandBuffers_;
@@ -116,6 +130,8 @@ class GLRenderSystem final : public RenderSystem
         HWObjectContainer<GLQueryHeap>          queryHeaps_;
         HWObjectContainer<GLFence>              fences_;
 
+        AsyncJob                                prepareSwapChainJob_;   // Must be the last member, so it waits for the preparation before the other members are destroyed.
+
 };
 
 
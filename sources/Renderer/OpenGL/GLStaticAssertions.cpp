@@ -52,19 +52,22 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindVertexArray );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindElementArrayBufferToVAO );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindBufferBase );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindBuffersBase );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindBufferRange );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginBufferXfb );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginTransformFeedback );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginTransformFeedbackNV );
 //LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdEndTransformFeedback ); // Unused
 //LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdEndTransformFeedbackNV ); // Unused
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindBufferDynamic );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindResourceHeap );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindRenderTarget );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBindPipelineState );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetBlendColor );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetStencilRef );
-LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetUniform );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdSetUniforms );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginQuery );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdEndQuery );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdResolveQueryData );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdBeginConditionalRender );
 //LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdEndConditionalRender ); // Unused
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawArrays );
@@ -79,6 +82,9 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawElementsInstancedBaseVertexBaseInstance )
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawElementsIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawArraysIndirect );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawElementsIndirect );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawArraysIndirectCount );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawElementsIndirectCount );
+LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdMultiDrawElementsBaseVertex );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawTransformFeedback );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDrawEmulatedTransformFeedback );
 LLGL_ASSERT_STDLAYOUT_STRUCT( GLCmdDispatchCompute );
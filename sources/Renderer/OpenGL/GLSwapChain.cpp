@@ -12,6 +12,7 @@
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Display.h>
+#include <algorithm>
 
 #ifdef LLGL_MOBILE_PLATFORM
 #   include <LLGL/Canvas.h>
@@ -50,11 +51,7 @@ GLSwapChain::GLSwapChain(
     SwapChain { desc }
 {
     /* Set up pixel format for GL context */
-    GLPixelFormat pixelFormat;
-    pixelFormat.colorBits   = desc.colorBits;
-    pixelFormat.depthBits   = desc.depthBits;
-    pixelFormat.stencilBits = desc.stencilBits;
-    pixelFormat.samples     = static_cast<int>(GetClampedSamples(desc.samples));
+    GLPixelFormat pixelFormat = GLSwapChain::GetPixelFormatFromDesc(desc);
 
     #ifdef LLGL_OS_LINUX
 
@@ -81,6 +78,12 @@ GLSwapChain::GLSwapChain(
     swapChainContext_ = GLSwapChainContext::Create(*context_, GetSurface());
     GLSwapChainContext::MakeCurrent(swapChainContext_.get());
 
+    /* Enable optional presentation features of mobile platforms; the default swap interval of a new context is 1 */
+    if (desc.preTransform)
+        swapChainContext_->SetPreTransform(true);
+    if (desc.framePacing)
+        framePacing_ = swapChainContext_->SetFramePacing(1);
+
     /* Get state manager and reset current framebuffer height */
     GetStateManager().ResetFramebufferHeight(framebufferHeight_);
 
@@ -93,6 +96,18 @@ GLSwapChain::GLSwapChain(
     }
 }
 
+GLPixelFormat GLSwapChain::GetPixelFormatFromDesc(const SwapChainDescriptor& desc)
+{
+    GLPixelFormat pixelFormat;
+    {
+        pixelFormat.colorBits   = desc.colorBits;
+        pixelFormat.depthBits   = desc.depthBits;
+        pixelFormat.stencilBits = desc.stencilBits;
+        pixelFormat.samples     = static_cast<int>(GetClampedSamples(desc.samples));
+    }
+    return pixelFormat;
+}
+
 bool GLSwapChain::IsPresentable() const
 {
     return swapChainContext_->HasDrawable();
@@ -100,7 +115,13 @@ bool GLSwapChain::IsPresentable() const
 
 void GLSwapChain::Present()
 {
+    /* Depth-stencil content does not persist across frames, so let tile-based GPUs skip writing it back to memory */
+    if (IsCurrent())
+        GetStateManager().InvalidateDefaultFramebuffer(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+
+    BeginFrameStatisticsStall();
     swapChainContext_->SwapBuffers();
+    EndFrameStatisticsStall(true);
 }
 
 std::uint32_t GLSwapChain::GetCurrentSwapIndex() const
@@ -138,6 +159,11 @@ bool GLSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     return SetSwapInterval(static_cast<int>(vsyncInterval));
 }
 
+SurfaceTransform GLSwapChain::GetSurfaceTransform() const
+{
+    return swapChainContext_->GetSurfaceTransform();
+}
+
 bool GLSwapChain::MakeCurrent(GLSwapChain* swapChain)
 {
     if (swapChain)
@@ -151,6 +177,11 @@ bool GLSwapChain::MakeCurrent(GLSwapChain* swapChain)
         return GLSwapChainContext::MakeCurrent(nullptr);
 }
 
+bool GLSwapChain::IsCurrent() const
+{
+    return (GLSwapChainContext::GetCurrent() == swapChainContext_.get());
+}
+
 
 /*
  * ======= Private: =======
@@ -172,6 +203,11 @@ bool GLSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
 bool GLSwapChain::SetSwapInterval(int swapInterval)
 {
     GLSwapChainContext::MakeCurrent(swapChainContext_.get());
+
+    /* With frame pacing, the presentation times hold back frames for the swap interval, so the native interval must not exceed 1 */
+    if (framePacing_ && swapChainContext_->SetFramePacing(swapInterval))
+        return GLContext::SetCurrentSwapInterval(std::min(swapInterval, 1));
+
     return GLContext::SetCurrentSwapInterval(swapInterval);
 }
 
@@ -35,6 +35,10 @@ class GLSwapChain final : public SwapChain
 
         #include <LLGL/Backend/SwapChain.inl>
 
+    public:
+
+        SurfaceTransform GetSurfaceTransform() const override;
+
     public:
 
         GLSwapChain(
@@ -47,6 +51,12 @@ class GLSwapChain final : public SwapChain
         // Makes the swap-chain's GL context current and updates the renger-target height in the linked GL state manager.
         static bool MakeCurrent(GLSwapChain* swapChain);
 
+        // Returns true if the swap-chain's GL context is current on the calling thread.
+        bool IsCurrent() const;
+
+        // Returns the GL pixel format that is requested by the specified swap-chain descriptor.
+        static GLPixelFormat GetPixelFormatFromDesc(const SwapChainDescriptor& desc);
+
         // Returns the state manager of the swap chain's GL context.
         inline GLStateManager& GetStateManager()
         {
@@ -70,6 +80,7 @@ class GLSwapChain final : public SwapChain
         std::shared_ptr<GLContext>          context_;
         std::unique_ptr<GLSwapChainContext> swapChainContext_;
         GLint                               framebufferHeight_ = 0;
+        bool                                framePacing_       = false;
 
 };
 
@@ -216,6 +216,13 @@ GLenum MapOrZero(const Format format)
         case Format::BC5SNorm:          return GL_COMPRESSED_SIGNED_RED_GREEN_RGTC2_EXT;
         #endif // /GL_EXT_texture_compression_rgtc
 
+        #if GL_ARB_texture_compression_bptc
+        case Format::BC6HUFloat:        return GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT;
+        case Format::BC6HSFloat:        return GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT;
+        case Format::BC7UNorm:          return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case Format::BC7UNorm_sRGB:     return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+        #endif // /GL_ARB_texture_compression_bptc
+
         /* --- Advanced scalable texture compression (ASTC) formats --- */
         #if GL_ES_VERSION_3_2
         case Format::ASTC4x4:           return GL_COMPRESSED_RGBA_ASTC_4x4;
@@ -285,8 +292,50 @@ GLenum MapOrZero(const Format format)
         #if GL_ES_VERSION_3_0 || GL_VERSION_4_3
         case Format::ETC2UNorm:         return GL_COMPRESSED_RGB8_ETC2;
         case Format::ETC2UNorm_sRGB:    return GL_COMPRESSED_SRGB8_ETC2;
+        case Format::ETC2A1UNorm:       return GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2;
+        case Format::ETC2A1UNorm_sRGB:  return GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2;
+        case Format::ETC2A8UNorm:       return GL_COMPRESSED_RGBA8_ETC2_EAC;
+        case Format::ETC2A8UNorm_sRGB:  return GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC;
+        case Format::EACR11UNorm:       return GL_COMPRESSED_R11_EAC;
+        case Format::EACR11SNorm:       return GL_COMPRESSED_SIGNED_R11_EAC;
+        case Format::EACRG11UNorm:      return GL_COMPRESSED_RG11_EAC;
+        case Format::EACRG11SNorm:      return GL_COMPRESSED_SIGNED_RG11_EAC;
         #endif // /GL_ES_VERSION_3_0
 
+        /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+        /* HDR blocks share the same internal formats as LDR blocks; support is determined by GL_KHR_texture_compression_astc_hdr */
+        #if GL_ES_VERSION_3_2
+        case Format::ASTC4x4Float:      return GL_COMPRESSED_RGBA_ASTC_4x4;
+        case Format::ASTC5x4Float:      return GL_COMPRESSED_RGBA_ASTC_5x4;
+        case Format::ASTC5x5Float:      return GL_COMPRESSED_RGBA_ASTC_5x5;
+        case Format::ASTC6x5Float:      return GL_COMPRESSED_RGBA_ASTC_6x5;
+        case Format::ASTC6x6Float:      return GL_COMPRESSED_RGBA_ASTC_6x6;
+        case Format::ASTC8x5Float:      return GL_COMPRESSED_RGBA_ASTC_8x5;
+        case Format::ASTC8x6Float:      return GL_COMPRESSED_RGBA_ASTC_8x6;
+        case Format::ASTC8x8Float:      return GL_COMPRESSED_RGBA_ASTC_8x8;
+        case Format::ASTC10x5Float:     return GL_COMPRESSED_RGBA_ASTC_10x5;
+        case Format::ASTC10x6Float:     return GL_COMPRESSED_RGBA_ASTC_10x6;
+        case Format::ASTC10x8Float:     return GL_COMPRESSED_RGBA_ASTC_10x8;
+        case Format::ASTC10x10Float:    return GL_COMPRESSED_RGBA_ASTC_10x10;
+        case Format::ASTC12x10Float:    return GL_COMPRESSED_RGBA_ASTC_12x10;
+        case Format::ASTC12x12Float:    return GL_COMPRESSED_RGBA_ASTC_12x12;
+        #elif GL_KHR_texture_compression_astc_hdr
+        case Format::ASTC4x4Float:      return GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+        case Format::ASTC5x4Float:      return GL_COMPRESSED_RGBA_ASTC_5x4_KHR;
+        case Format::ASTC5x5Float:      return GL_COMPRESSED_RGBA_ASTC_5x5_KHR;
+        case Format::ASTC6x5Float:      return GL_COMPRESSED_RGBA_ASTC_6x5_KHR;
+        case Format::ASTC6x6Float:      return GL_COMPRESSED_RGBA_ASTC_6x6_KHR;
+        case Format::ASTC8x5Float:      return GL_COMPRESSED_RGBA_ASTC_8x5_KHR;
+        case Format::ASTC8x6Float:      return GL_COMPRESSED_RGBA_ASTC_8x6_KHR;
+        case Format::ASTC8x8Float:      return GL_COMPRESSED_RGBA_ASTC_8x8_KHR;
+        case Format::ASTC10x5Float:     return GL_COMPRESSED_RGBA_ASTC_10x5_KHR;
+        case Format::ASTC10x6Float:     return GL_COMPRESSED_RGBA_ASTC_10x6_KHR;
+        case Format::ASTC10x8Float:     return GL_COMPRESSED_RGBA_ASTC_10x8_KHR;
+        case Format::ASTC10x10Float:    return GL_COMPRESSED_RGBA_ASTC_10x10_KHR;
+        case Format::ASTC12x10Float:    return GL_COMPRESSED_RGBA_ASTC_12x10_KHR;
+        case Format::ASTC12x12Float:    return GL_COMPRESSED_RGBA_ASTC_12x12_KHR;
+        #endif
+
         default:                        return 0;
     }
 }
@@ -1140,6 +1189,13 @@ Format UnmapFormat(const GLenum internalFormat)
         case GL_COMPRESSED_SIGNED_RED_GREEN_RGTC2_EXT:  return Format::BC5SNorm;
         #endif // /GL_EXT_texture_compression_rgtc
 
+        #if GL_ARB_texture_compression_bptc
+        case GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT:     return Format::BC6HUFloat;
+        case GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT:       return Format::BC6HSFloat;
+        case GL_COMPRESSED_RGBA_BPTC_UNORM:             return Format::BC7UNorm;
+        case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:       return Format::BC7UNorm_sRGB;
+        #endif // /GL_ARB_texture_compression_bptc
+
         /* --- Advanced scalable texture compression (ASTC) formats --- */
         #if GL_ES_VERSION_3_2
         case GL_COMPRESSED_RGBA_ASTC_4x4:               return Format::ASTC4x4;
@@ -1205,6 +1261,14 @@ Format UnmapFormat(const GLenum internalFormat)
         #if GL_ES_VERSION_3_0 || GL_VERSION_4_3
         case GL_COMPRESSED_RGB8_ETC2:                   return Format::ETC2UNorm;
         case GL_COMPRESSED_SRGB8_ETC2:                  return Format::ETC2UNorm_sRGB;
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:   return Format::ETC2A1UNorm;
+        case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:  return Format::ETC2A1UNorm_sRGB;
+        case GL_COMPRESSED_RGBA8_ETC2_EAC:              return Format::ETC2A8UNorm;
+        case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:       return Format::ETC2A8UNorm_sRGB;
+        case GL_COMPRESSED_R11_EAC:                     return Format::EACR11UNorm;
+        case GL_COMPRESSED_SIGNED_R11_EAC:              return Format::EACR11SNorm;
+        case GL_COMPRESSED_RG11_EAC:                    return Format::EACRG11UNorm;
+        case GL_COMPRESSED_SIGNED_RG11_EAC:             return Format::EACRG11SNorm;
         #endif // /GL_ES_VERSION_3_0
 
         #if GL_OES_compressed_ETC1_RGB8_texture
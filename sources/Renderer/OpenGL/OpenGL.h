@@ -29,6 +29,7 @@
 #define LLGL_GLEXT_VERTEX_ARRAY_OBJECT 1
 #define LLGL_GLEXT_FRAMEBUFFER_OBJECT 1
 #define LLGL_GLEXT_SHADER_OBJECTS_30 1
+#define LLGL_GLEXT_INVALIDATE_SUBDATA 1
 
 #else // LLGL_WEBGL
 
@@ -94,6 +95,10 @@
 #   define LLGL_GLEXT_DRAW_ELEMENTS_BASE_VERTEX 1
 #endif
 
+#if GL_ARB_draw_elements_base_vertex && LLGL_OPENGL
+#   define LLGL_GLEXT_MULTI_DRAW_ELEMENTS_BASE_VERTEX 1
+#endif
+
 #if GL_ARB_framebuffer_no_attachments || GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_FRAMEBUFFER_NO_ATTACHMENTS 1
 #endif
@@ -106,6 +111,14 @@
 #   define LLGL_GLEXT_MULTI_DRAW_INDIRECT 1
 #endif
 
+#if GL_ARB_indirect_parameters
+#   define LLGL_GLEXT_INDIRECT_PARAMETERS 1
+#endif
+
+#if GL_ARB_query_buffer_object && GL_ARB_timer_query
+#   define LLGL_GLEXT_QUERY_BUFFER_OBJECT 1
+#endif
+
 #if GL_ARB_compute_shader || GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_COMPUTE_SHADER 1
 #endif
@@ -114,6 +127,14 @@
 #   define LLGL_GLEXT_DEBUG 1
 #endif
 
+#if GL_KHR_parallel_shader_compile && LLGL_OPENGL
+#   define LLGL_GLEXT_PARALLEL_SHADER_COMPILE 1
+#endif
+
+#if GL_OVR_multiview && LLGL_OPENGL && !LLGL_GL_ENABLE_OPENGL2X
+#   define LLGL_GLEXT_MULTIVIEW 1
+#endif
+
 //TODO: which extension?
 #if defined LLGL_OPENGL && !LLGL_GL_ENABLE_OPENGL2X
 #   define LLGL_GLEXT_CONDITIONAL_RENDER 1
@@ -151,6 +172,10 @@
 #   define LLGL_GLEXT_DIRECT_STATE_ACCESS 1
 #endif
 
+#if GL_ARB_bindless_texture && !LLGL_GL_ENABLE_OPENGL2X
+#   define LLGL_GLEXT_BINDLESS_TEXTURE 1
+#endif
+
 #if GL_ARB_get_program_binary || GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_GET_PROGRAM_BINARY 1
 #endif
@@ -159,6 +184,10 @@
 #   define LLGL_GLEXT_TEXTURE_STORAGE 1
 #endif
 
+#if GL_ARB_invalidate_subdata || GL_ES_VERSION_3_0
+#   define LLGL_GLEXT_INVALIDATE_SUBDATA 1
+#endif
+
 #if GL_ARB_program_interface_query || GL_ES_VERSION_3_1
 #   define LLGL_GLEXT_PROGRAM_INTERFACE_QUERY
 #endif
@@ -8,11 +8,15 @@
 #include "AndroidGLSwapChainContext.h"
 #include "AndroidGLContext.h"
 #include "AndroidGLCore.h"
+#include "../../../../Platform/Android/AndroidApp.h"
+#include "../../../../Platform/Android/AndroidChoreographer.h"
 #include "../../../../Core/CoreUtils.h"
 #include "../../../../Core/Exception.h"
 #include <LLGL/Platform/NativeHandle.h>
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Canvas.h>
+#include <android/native_window.h>
+#include <string.h>
 
 
 namespace LLGL
@@ -63,6 +67,7 @@ void AndroidGLSwapChainContext::CanvasEventListener::OnInit(Canvas& sender)
 {
     /* Re-initialize the shared EGLSurface when the ANativeWindow is re-initialized */
     context_->InitEGLSurface(sender);
+    context_->UpdateBuffersTransform();
     GLSwapChainContext::MakeCurrent(context_);
 }
 
@@ -110,13 +115,54 @@ bool AndroidGLSwapChainContext::HasDrawable() const
 
 bool AndroidGLSwapChainContext::SwapBuffers()
 {
+    if (framePacingInterval_ > 0)
+        SchedulePresentationTime();
     eglSwapBuffers(display_, sharedSurface_->GetEGLSurface());
     return true;
 }
 
-void AndroidGLSwapChainContext::Resize(const Extent2D& resolution)
+void AndroidGLSwapChainContext::Resize(const Extent2D& /*resolution*/)
 {
-    // dummy
+    /* Display rotation changes the content rect, so the buffers transform must be updated with each resize */
+    UpdateBuffersTransform();
+}
+
+bool AndroidGLSwapChainContext::SetPreTransform(bool enable)
+{
+    #if __ANDROID_API__ >= 26
+    preTransform_ = enable;
+    UpdateBuffersTransform();
+    return true;
+    #else
+    return false; // ANativeWindow_setBuffersTransform() requires API level 26
+    #endif
+}
+
+SurfaceTransform AndroidGLSwapChainContext::GetSurfaceTransform() const
+{
+    return surfaceTransform_;
+}
+
+bool AndroidGLSwapChainContext::SetFramePacing(int swapInterval)
+{
+    #ifdef EGL_ANDROID_presentation_time
+    if (eglPresentationTimeANDROID_ == nullptr)
+    {
+        /* Presentation times require EGL_ANDROID_presentation_time and vertical blank timings from the choreographer */
+        const char* extensions = eglQueryString(display_, EGL_EXTENSIONS);
+        if (extensions == nullptr || ::strstr(extensions, "EGL_ANDROID_presentation_time") == nullptr)
+            return false;
+        if (!AndroidChoreographer::Get().Start())
+            return false;
+        eglPresentationTimeANDROID_ = reinterpret_cast<PFNEGLPRESENTATIONTIMEANDROIDPROC>(eglGetProcAddress("eglPresentationTimeANDROID"));
+        if (eglPresentationTimeANDROID_ == nullptr)
+            return false;
+    }
+    framePacingInterval_ = swapInterval;
+    return true;
+    #else
+    return false;
+    #endif
 }
 
 void AndroidGLSwapChainContext::InitEGLSurface(Surface& surface)
@@ -131,6 +177,67 @@ void AndroidGLSwapChainContext::DestroyEGLSurface()
     sharedSurface_->DestroyEGLSurface();
 }
 
+static std::int32_t ToNativeWindowTransform(SurfaceTransform transform)
+{
+    #if __ANDROID_API__ >= 26
+    /* Buffers must be transformed by the inverse of the display rotation to be shown upright without composition */
+    switch (transform)
+    {
+        case SurfaceTransform::Rotate90:    return ANATIVEWINDOW_TRANSFORM_ROTATE_270;
+        case SurfaceTransform::Rotate180:   return ANATIVEWINDOW_TRANSFORM_ROTATE_180;
+        case SurfaceTransform::Rotate270:   return ANATIVEWINDOW_TRANSFORM_ROTATE_90;
+        default:                            return ANATIVEWINDOW_TRANSFORM_IDENTITY;
+    }
+    #else
+    return 0;
+    #endif
+}
+
+static bool IsSwappedSurfaceTransform(SurfaceTransform transform)
+{
+    return (transform == SurfaceTransform::Rotate90 || transform == SurfaceTransform::Rotate270);
+}
+
+void AndroidGLSwapChainContext::UpdateBuffersTransform()
+{
+    #if __ANDROID_API__ >= 26
+
+    ANativeWindow* window = sharedSurface_->GetNativeWindow();
+    if (window == nullptr)
+        return;
+
+    /* Reset to identity transformation when pre-rotation is disabled, but only if it was enabled before */
+    const SurfaceTransform prevTransform = surfaceTransform_;
+    surfaceTransform_ = (preTransform_ ? AndroidApp::GetDisplayRotation(AndroidApp::Get().GetState()) : SurfaceTransform::Identity);
+    if (!preTransform_ && prevTransform == SurfaceTransform::Identity)
+        return;
+
+    ANativeWindow_setBuffersTransform(window, ToNativeWindowTransform(surfaceTransform_));
+
+    /* Keep the buffers in the natural orientation of the display; the content rect has the orientation of the rotated display */
+    const Extent2D contentSize = AndroidApp::GetContentRectSize(AndroidApp::Get().GetState());
+    if (IsSwappedSurfaceTransform(surfaceTransform_))
+        ANativeWindow_setBuffersGeometry(window, static_cast<std::int32_t>(contentSize.height), static_cast<std::int32_t>(contentSize.width), 0);
+    else
+        ANativeWindow_setBuffersGeometry(window, static_cast<std::int32_t>(contentSize.width), static_cast<std::int32_t>(contentSize.height), 0);
+
+    #endif // /__ANDROID_API__ >= 26
+}
+
+void AndroidGLSwapChainContext::SchedulePresentationTime()
+{
+    #ifdef EGL_ANDROID_presentation_time
+    AndroidChoreographer& choreographer = AndroidChoreographer::Get();
+    const std::int64_t targetVsync = choreographer.ScheduleNextVsync(lastPresentVsync_, static_cast<std::uint32_t>(framePacingInterval_));
+    if (targetVsync > 0)
+    {
+        /* Aim half a refresh period ahead of the target, so jitter does not postpone the frame by another vertical blank */
+        eglPresentationTimeANDROID_(display_, sharedSurface_->GetEGLSurface(), targetVsync - choreographer.GetRefreshPeriod()/2);
+        lastPresentVsync_ = targetVsync;
+    }
+    #endif
+}
+
 bool AndroidGLSwapChainContext::MakeCurrentEGLContext(AndroidGLSwapChainContext* context)
 {
     if (context)
@@ -13,6 +13,7 @@
 #include "AndroidSharedEGLSurface.h"
 #include "../../OpenGL.h"
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
 
 namespace LLGL
@@ -33,6 +34,10 @@ class AndroidGLSwapChainContext final : public GLSwapChainContext
         bool SwapBuffers() override;
         void Resize(const Extent2D& resolution) override;
 
+        bool SetPreTransform(bool enable) override;
+        SurfaceTransform GetSurfaceTransform() const override;
+        bool SetFramePacing(int swapInterval) override;
+
     public:
 
         void InitEGLSurface(Surface& surface);
@@ -40,6 +45,14 @@ class AndroidGLSwapChainContext final : public GLSwapChainContext
 
         static bool MakeCurrentEGLContext(AndroidGLSwapChainContext* context);
 
+    private:
+
+        // Applies the buffer transformation and geometry for the current display rotation to the native window.
+        void UpdateBuffersTransform();
+
+        // Sets the presentation time of the next frame to the vertical blank scheduled by the choreographer.
+        void SchedulePresentationTime();
+
     private:
 
         class CanvasEventListener;
@@ -48,6 +61,15 @@ class AndroidGLSwapChainContext final : public GLSwapChainContext
         EGLContext                  context_        = nullptr;
         AndroidSharedEGLSurfacePtr  sharedSurface_;
 
+        bool                        preTransform_           = false;
+        SurfaceTransform            surfaceTransform_       = SurfaceTransform::Identity;
+
+        #ifdef EGL_ANDROID_presentation_time
+        PFNEGLPRESENTATIONTIMEANDROIDPROC eglPresentationTimeANDROID_ = nullptr;
+        #endif
+        int                         framePacingInterval_    = 0;
+        std::int64_t                lastPresentVsync_       = 0;
+
 };
 
 
@@ -33,9 +33,34 @@ bool operator != (const GLPixelFormat& lhs, const GLPixelFormat& rhs)
  * GLContext class
  */
 
-static GLContext*   g_currentContext;
-static unsigned     g_currentGlobalIndex;
-static unsigned     g_globalIndexCounter;
+#ifndef LLGL_GL_ENABLE_EGL
+
+// Headless GL contexts are only supported via EGL; see LinuxEGLContext.
+std::unique_ptr<GLContext> GLContext::CreateHeadless(
+    const GLPixelFormat&                /*pixelFormat*/,
+    const RendererConfigurationOpenGL&  /*profile*/,
+    GLContext*                          /*sharedContext*/,
+    int                                 /*adapterIndex*/)
+{
+    return nullptr;
+}
+
+#endif // /LLGL_GL_ENABLE_EGL
+
+#ifndef LLGL_OS_WIN32
+
+// Only WGL needs a proxy window and context to choose multi-sampled pixel formats; see Win32GLContext.
+void GLContext::PreparePixelFormat(const GLPixelFormat& /*pixelFormat*/)
+{
+    // dummy
+}
+
+#endif // /LLGL_OS_WIN32
+
+// The current GL context is tracked per thread, since each worker thread can have its own shared context; see GLContextManager::MakeWorkerContextCurrent().
+static thread_local GLContext*  g_currentContext;
+static thread_local unsigned    g_currentGlobalIndex;
+static unsigned                 g_globalIndexCounter;
 
 bool GLContext::SetCurrentSwapInterval(int interval)
 {
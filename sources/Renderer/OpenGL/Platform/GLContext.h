@@ -91,6 +91,23 @@ class GLContext
             const ArrayView<char>&              customNativeHandle  = {}
         );
 
+        /*
+        Creates a platform specific GLContext instance without any surface; see RenderSystemFlags::Headless.
+        The new context is made current for the calling thread. Returns null if headless GL contexts are not supported on this platform.
+        */
+        static std::unique_ptr<GLContext> CreateHeadless(
+            const GLPixelFormat&                pixelFormat,
+            const RendererConfigurationOpenGL&  profile,
+            GLContext*                          sharedContext       = nullptr,
+            int                                 adapterIndex        = -1
+        );
+
+        /*
+        Prepares the platform specific pixel format selection for the specified pixel format, so subsequent calls to Create() can reuse it.
+        This can be called from any thread and only has an effect on platforms where the selection is expensive; see RenderSystem::PrepareSwapChainAsync().
+        */
+        static void PreparePixelFormat(const GLPixelFormat& pixelFormat);
+
         // Sets the current GL context. This only stores a reference to this context (GetCurrent) and its global index (GetGlobalIndex).
         static void SetCurrent(GLContext* context);
 
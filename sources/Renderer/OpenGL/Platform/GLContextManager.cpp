@@ -11,6 +11,7 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../Profile/GLProfile.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/Exception.h"
 #include <LLGL/Window.h>
 #include <LLGL/Canvas.h>
 #include <cstring>
@@ -20,14 +21,21 @@ namespace LLGL
 {
 
 
+// Is true for threads with a current worker context; see GLContextManager::MakeWorkerContextCurrent().
+static thread_local bool g_isWorkerThread;
+
 GLContextManager::GLContextManager(
     const RendererConfigurationOpenGL&  profile,
     const NewGLContextCallback&         newContextCallback,
     const void*                         customNativeHandle,
-    std::size_t                         customNativeHandleSize)
+    std::size_t                         customNativeHandleSize,
+    bool                                headless,
+    int                                 adapterIndex)
 :
     profile_            { profile            },
-    newContextCallback_ { newContextCallback }
+    newContextCallback_ { newContextCallback },
+    headless_           { headless           },
+    adapterIndex_       { adapterIndex       }
 {
     /* Adjust context profile if Auto-selection is specified */
     if (profile_.contextProfile == OpenGLContextProfile::Auto)
@@ -45,12 +53,65 @@ std::shared_ptr<GLContext> GLContextManager::AllocContext(
     bool                    acceptCompatibleFormat,
     Surface*                surface)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     if (pixelFormat != nullptr)
         return FindOrMakeContextWithPixelFormat(*pixelFormat, acceptCompatibleFormat, surface);
     else
         return FindOrMakeAnyContext();
 }
 
+void GLContextManager::MakeWorkerContextCurrent()
+{
+    /* Each worker thread keeps its context for the lifetime of the context manager */
+    if (g_isWorkerThread)
+        return;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (pixelFormats_.empty())
+        LLGL_TRAP("cannot create GL worker context before the primary GL context has been created");
+    if (!customNativeHandle_.empty())
+        LLGL_TRAP("cannot create GL worker context when a custom native GL context is used");
+
+    /* Create new GL context that shares its objects with the primary context and a placeholder surface to make it current */
+    const GLPixelFormatWithContext& primary = pixelFormats_.front();
+
+    GLWorkerContext workerContext;
+    if (headless_)
+    {
+        workerContext.context           = GLContext::CreateHeadless(primary.pixelFormat, profile_, primary.context.get(), adapterIndex_);
+        workerContext.swapChainContext  = GLSwapChainContext::CreateHeadless(*workerContext.context);
+    }
+    else
+    {
+        workerContext.surface           = CreatePlaceholderSurface();
+        workerContext.context           = GLContext::Create(primary.pixelFormat, profile_, *workerContext.surface, primary.context.get());
+        workerContext.swapChainContext  = GLSwapChainContext::Create(*workerContext.context, *workerContext.surface);
+    }
+
+    /* Make worker context current for this thread only and initialize its state manager; GL extensions have already been loaded with the primary context */
+    if (!GLSwapChainContext::MakeCurrent(workerContext.swapChainContext.get()))
+        LLGL_TRAP("failed to make GL worker context current");
+
+    GLStateManager& stateMngr = workerContext.context->GetStateManager();
+    stateMngr.DetermineExtensionsAndLimits();
+    InitRenderStates(stateMngr);
+
+    workerContexts_.push_back(std::move(workerContext));
+    g_isWorkerThread = true;
+}
+
+bool GLContextManager::IsPrimaryThread()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return (pixelFormats_.empty() || primaryThreadID_ == std::this_thread::get_id());
+}
+
+bool GLContextManager::IsWorkerThread()
+{
+    return g_isWorkerThread;
+}
+
 
 /*
  * ======= Private: =======
@@ -77,24 +138,31 @@ std::unique_ptr<Surface> GLContextManager::CreatePlaceholderSurface()
 
 std::shared_ptr<GLContext> GLContextManager::MakeContextWithPixelFormat(const GLPixelFormat& pixelFormat, Surface* surface)
 {
-    /* Create placeholder surface is none was specified */
+    /* Create placeholder surface is none was specified; headless contexts don't need any surface */
     std::unique_ptr<Surface> placeholderSurface;
-    if (surface == nullptr)
+    if (surface == nullptr && !headless_)
     {
         placeholderSurface = CreatePlaceholderSurface();
         surface = placeholderSurface.get();
     }
 
-    /* Use shared GL context if there already is one */
+    /* Use shared GL context if there already is one, otherwise this becomes the primary context */
     GLContext* sharedContext = (pixelFormats_.empty() ? nullptr : pixelFormats_.front().context.get());
+    if (sharedContext == nullptr)
+        primaryThreadID_ = std::this_thread::get_id();
 
     /* Create new GL context and append to pixel format list */
     GLPixelFormatWithContext formatWithContext;
     {
         formatWithContext.pixelFormat   = pixelFormat;
         formatWithContext.surface       = std::move(placeholderSurface);
-        formatWithContext.context       = GLContext::Create(pixelFormat, profile_, *surface, sharedContext, customNativeHandle_);
+        if (headless_)
+            formatWithContext.context   = GLContext::CreateHeadless(pixelFormat, profile_, sharedContext, adapterIndex_);
+        else
+            formatWithContext.context   = GLContext::Create(pixelFormat, profile_, *surface, sharedContext, customNativeHandle_);
     }
+    if (headless_ && !formatWithContext.context)
+        LLGL_TRAP("headless GL contexts are not supported on this platform; see RenderSystemFlags::Headless");
     pixelFormats_.emplace_back(std::move(formatWithContext));
 
     std::shared_ptr<GLContext> context = pixelFormats_.back().context;
@@ -102,7 +170,7 @@ std::shared_ptr<GLContext> GLContextManager::MakeContextWithPixelFormat(const GL
     /* Load GL extensions for the very first context */
     const bool hasGLCoreProfile = (profile_.contextProfile == OpenGLContextProfile::CoreProfile);
     const bool abortOnFailure   = !profile_.suppressFailedExtensions;
-    LoadSupportedOpenGLExtensions(hasGLCoreProfile, abortOnFailure);
+    LoadSupportedOpenGLExtensions(hasGLCoreProfile, abortOnFailure, profile_.lazyProcLoading);
 
     /* Disable all extensions that are unsupported due to incompatible configurations */
     DisableIncompatibleExtensions();
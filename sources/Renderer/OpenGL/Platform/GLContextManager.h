@@ -10,11 +10,14 @@
 
 
 #include "GLContext.h"
+#include "GLSwapChainContext.h"
 #include <LLGL/RendererConfiguration.h>
 #include <LLGL/Container/DynamicArray.h>
 #include <vector>
 #include <memory>
 #include <functional>
+#include <mutex>
+#include <thread>
 
 
 namespace LLGL
@@ -49,7 +52,9 @@ class GLContextManager
             const RendererConfigurationOpenGL&  profile,
             const NewGLContextCallback&         newContextCallback      = nullptr,
             const void*                         customNativeHandle      = nullptr,
-            std::size_t                         customNativeHandleSize  = 0
+            std::size_t                         customNativeHandleSize  = 0,
+            bool                                headless                = false,
+            int                                 adapterIndex            = -1
         );
 
     public:
@@ -61,6 +66,18 @@ class GLContextManager
             Surface*                surface                 = nullptr
         );
 
+        /*
+        Makes a background GL context current for the calling worker thread, which shares its objects with the primary GL context.
+        Each worker thread gets its own context that is created on first use and destroyed together with this context manager. Thread-safe.
+        */
+        void MakeWorkerContextCurrent();
+
+        // Returns true if the calling thread is the one that created the primary GL context or no context has been created yet. Thread-safe.
+        bool IsPrimaryThread();
+
+        // Returns true if a worker context is current on the calling thread. See MakeWorkerContextCurrent().
+        static bool IsWorkerThread();
+
     public:
 
         // Returns the OpenGL profile configuration.
@@ -69,6 +86,12 @@ class GLContextManager
             return profile_;
         }
 
+        // Returns true if all GL contexts are created without any surface. See RenderSystemFlags::Headless.
+        inline bool IsHeadless() const
+        {
+            return headless_;
+        }
+
     private:
 
         struct GLPixelFormatWithContext
@@ -78,6 +101,13 @@ class GLContextManager
             std::shared_ptr<GLContext>  context;
         };
 
+        struct GLWorkerContext
+        {
+            std::unique_ptr<Surface>            surface;
+            std::shared_ptr<GLContext>          context;
+            std::unique_ptr<GLSwapChainContext> swapChainContext;
+        };
+
     private:
 
         // Creates an invisible surface as placeholder for a GL context.
@@ -101,6 +131,12 @@ class GLContextManager
         std::vector<GLPixelFormatWithContext>   pixelFormats_;
         DynamicByteArray                        customNativeHandle_;
         NewGLContextCallback                    newContextCallback_;
+        bool                                    headless_           = false;
+        int                                     adapterIndex_       = -1;
+
+        std::mutex                              mutex_;             // Guards context creation from worker threads
+        std::thread::id                         primaryThreadID_;
+        std::vector<GLWorkerContext>            workerContexts_;
 
 };
 
@@ -13,13 +13,38 @@ namespace LLGL
 {
 
 
-static GLSwapChainContext* g_currentSwapChainContext;
+static thread_local GLSwapChainContext* g_currentSwapChainContext;
 
 GLSwapChainContext::GLSwapChainContext(GLContext& context) :
     context_ { context }
 {
 }
 
+bool GLSwapChainContext::SetPreTransform(bool /*enable*/)
+{
+    return false; // dummy
+}
+
+SurfaceTransform GLSwapChainContext::GetSurfaceTransform() const
+{
+    return SurfaceTransform::Identity;
+}
+
+bool GLSwapChainContext::SetFramePacing(int /*swapInterval*/)
+{
+    return false; // dummy
+}
+
+#ifndef LLGL_GL_ENABLE_EGL
+
+// Headless GL contexts are only supported via EGL; see LinuxEGLSwapChainContext.
+std::unique_ptr<GLSwapChainContext> GLSwapChainContext::CreateHeadless(GLContext& /*context*/)
+{
+    return nullptr;
+}
+
+#endif // /LLGL_GL_ENABLE_EGL
+
 bool GLSwapChainContext::MakeCurrent(GLSwapChainContext* context)
 {
     bool result = true;
@@ -32,6 +57,11 @@ bool GLSwapChainContext::MakeCurrent(GLSwapChainContext* context)
     return result;
 }
 
+GLSwapChainContext* GLSwapChainContext::GetCurrent()
+{
+    return g_currentSwapChainContext;
+}
+
 
 } // /namespace LLGL
 
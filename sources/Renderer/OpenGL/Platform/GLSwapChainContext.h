@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Surface.h>
+#include <LLGL/SwapChainFlags.h>
 #include <memory>
 
 
@@ -40,6 +41,15 @@ class GLSwapChainContext
         // Resizes the GL swap-chain context. This is called after the context surface has been resized.
         virtual void Resize(const Extent2D& resolution) = 0;
 
+        // Enables or disables pre-rotation of the drawable to the native orientation of the display. Returns false if this is not supported.
+        virtual bool SetPreTransform(bool enable);
+
+        // Returns the transformation the content must be rendered with if pre-rotation is enabled. By default SurfaceTransform::Identity.
+        virtual SurfaceTransform GetSurfaceTransform() const;
+
+        // Enables frame pacing with presentation times for the specified swap interval. Returns false if this is not supported.
+        virtual bool SetFramePacing(int swapInterval);
+
     public:
 
         inline GLContext& GetGLContext() const
@@ -52,9 +62,15 @@ class GLSwapChainContext
         // Creates a platform specific GLSwapChainContext instance.
         static std::unique_ptr<GLSwapChainContext> Create(GLContext& context, Surface& surface);
 
+        // Creates a platform specific GLSwapChainContext instance without a drawable for a context that was created via GLContext::CreateHeadless().
+        static std::unique_ptr<GLSwapChainContext> CreateHeadless(GLContext& context);
+
         // Makes the specified swap-chain context link current. If null, no context is current.
         static bool MakeCurrent(GLSwapChainContext* context);
 
+        // Returns the swap-chain context that is current on the calling thread or null if there is none.
+        static GLSwapChainContext* GetCurrent();
+
     protected:
 
         // Initializes the swap-chain context with the specified GL context.
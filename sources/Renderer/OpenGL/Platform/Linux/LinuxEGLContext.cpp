@@ -0,0 +1,317 @@
+/*
+ * LinuxEGLContext.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "LinuxEGLContext.h"
+#include "../../../CheckedCast.h"
+#include "../../../../Core/CoreUtils.h"
+#include "../../../../Core/Assertion.h"
+#include <LLGL/Log.h>
+#include <EGL/eglext.h>
+#include <mutex>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+#ifndef EGL_PLATFORM_DEVICE_EXT
+#define EGL_PLATFORM_DEVICE_EXT 0x313F
+#endif
+
+#ifndef EGL_PLATFORM_SURFACELESS_MESA
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+#endif
+
+
+/*
+ * Shared EGL display
+ */
+
+// All headless contexts share the same EGL display, which is terminated when the last context is destroyed.
+static std::mutex   g_eglDisplayMutex;
+static EGLDisplay   g_eglDisplay            = EGL_NO_DISPLAY;
+static unsigned     g_eglDisplayRefCount    = 0;
+
+// Returns true if the space separated extension string of the specified display contains the specified extension name.
+static bool HasEGLExtension(EGLDisplay display, const char* name)
+{
+    const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+    if (extensions == nullptr)
+        return false;
+
+    const std::size_t nameLen = ::strlen(name);
+    for (const char* s = extensions; (s = ::strstr(s, name)) != nullptr; s += nameLen)
+    {
+        const bool isFirst  = (s == extensions || s[-1] == ' ');
+        const bool isLast   = (s[nameLen] == ' ' || s[nameLen] == '\0');
+        if (isFirst && isLast)
+            return true;
+    }
+
+    return false;
+}
+
+static bool InitializeEGLDisplay(EGLDisplay display)
+{
+    EGLint major = 0, minor = 0;
+    return (display != EGL_NO_DISPLAY && eglInitialize(display, &major, &minor) == EGL_TRUE);
+}
+
+static EGLDisplay OpenHeadlessEGLDisplay(int adapterIndex)
+{
+    /* Enumerate EGL devices via EGL_EXT_device_enumeration and open the selected one via EGL_EXT_platform_device */
+    PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT = nullptr;
+    if (HasEGLExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_base"))
+        eglGetPlatformDisplayEXT = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+    const bool hasDeviceEnumeration =
+    (
+        eglGetPlatformDisplayEXT != nullptr &&
+        (HasEGLExtension(EGL_NO_DISPLAY, "EGL_EXT_device_enumeration") || HasEGLExtension(EGL_NO_DISPLAY, "EGL_EXT_device_base")) &&
+        HasEGLExtension(EGL_NO_DISPLAY, "EGL_EXT_platform_device")
+    );
+
+    if (hasDeviceEnumeration)
+    {
+        auto eglQueryDevicesEXT = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+
+        EGLint numDevices = 0;
+        if (eglQueryDevicesEXT != nullptr && eglQueryDevicesEXT(0, nullptr, &numDevices) == EGL_TRUE && numDevices > 0)
+        {
+            std::vector<EGLDeviceEXT> devices(static_cast<std::size_t>(numDevices));
+            eglQueryDevicesEXT(numDevices, devices.data(), &numDevices);
+
+            if (adapterIndex >= numDevices)
+                LLGL_TRAP("EGL device index %d out of range (%d device(s) available)", adapterIndex, static_cast<int>(numDevices));
+
+            const EGLint deviceIndex = (adapterIndex >= 0 ? adapterIndex : 0);
+            EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[deviceIndex], nullptr);
+            if (InitializeEGLDisplay(display))
+                return display;
+            if (adapterIndex >= 0)
+                LLGL_TRAP("failed to initialize EGL display for device index %d", adapterIndex);
+        }
+    }
+
+    if (adapterIndex > 0)
+        LLGL_TRAP("cannot select EGL device index %d without EGL_EXT_device_enumeration and EGL_EXT_platform_device", adapterIndex);
+
+    /* Fall back to Mesa's surfaceless platform and then to the default display */
+    if (eglGetPlatformDisplayEXT != nullptr && HasEGLExtension(EGL_NO_DISPLAY, "EGL_MESA_platform_surfaceless"))
+    {
+        EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (InitializeEGLDisplay(display))
+            return display;
+    }
+
+    EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (!InitializeEGLDisplay(display))
+        LLGL_TRAP("failed to initialize EGL display for headless GL context");
+
+    return display;
+}
+
+static EGLDisplay AcquireSharedEGLDisplay(int adapterIndex)
+{
+    std::lock_guard<std::mutex> guard{ g_eglDisplayMutex };
+    if (g_eglDisplayRefCount == 0)
+        g_eglDisplay = OpenHeadlessEGLDisplay(adapterIndex);
+    ++g_eglDisplayRefCount;
+    return g_eglDisplay;
+}
+
+static void ReleaseSharedEGLDisplay()
+{
+    std::lock_guard<std::mutex> guard{ g_eglDisplayMutex };
+    LLGL_ASSERT(g_eglDisplayRefCount > 0);
+    if (--g_eglDisplayRefCount == 0)
+    {
+        eglTerminate(g_eglDisplay);
+        g_eglDisplay = EGL_NO_DISPLAY;
+    }
+}
+
+
+/*
+ * GLContext class
+ */
+
+std::unique_ptr<GLContext> GLContext::CreateHeadless(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    GLContext*                          sharedContext,
+    int                                 adapterIndex)
+{
+    LinuxEGLContext* sharedContextEGL = (sharedContext != nullptr ? LLGL_CAST(LinuxEGLContext*, sharedContext) : nullptr);
+    return MakeUnique<LinuxEGLContext>(pixelFormat, profile, sharedContextEGL, adapterIndex);
+}
+
+
+/*
+ * LinuxEGLContext class
+ */
+
+LinuxEGLContext::LinuxEGLContext(
+    const GLPixelFormat&                pixelFormat,
+    const RendererConfigurationOpenGL&  profile,
+    LinuxEGLContext*                    sharedContext,
+    int                                 adapterIndex)
+:
+    display_ { AcquireSharedEGLDisplay(adapterIndex) }
+{
+    CreateEGLContext(pixelFormat, profile, sharedContext);
+}
+
+LinuxEGLContext::~LinuxEGLContext()
+{
+    DeleteEGLContext();
+    ReleaseSharedEGLDisplay();
+}
+
+int LinuxEGLContext::GetSamples() const
+{
+    /* Headless contexts have no default framebuffer that could be multi-sampled */
+    return 1;
+}
+
+bool LinuxEGLContext::GetNativeHandle(void* /*nativeHandle*/, std::size_t /*nativeHandleSize*/) const
+{
+    /* OpenGL::RenderSystemNativeHandle can only hold a GLX context */
+    return false;
+}
+
+EGLDisplay LinuxEGLContext::GetSharedEGLDisplay()
+{
+    std::lock_guard<std::mutex> guard{ g_eglDisplayMutex };
+    return g_eglDisplay;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool LinuxEGLContext::SetSwapInterval(int /*interval*/)
+{
+    /* Headless contexts never present anything */
+    return false;
+}
+
+void LinuxEGLContext::CreateEGLContext(const GLPixelFormat& pixelFormat, const RendererConfigurationOpenGL& profile, LinuxEGLContext* sharedContext)
+{
+    /* Choose EGL configuration; pbuffer support is required for the fallback when surfaceless contexts are not supported */
+    const EGLint configAttribs[] =
+    {
+        EGL_SURFACE_TYPE,       EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE,    EGL_OPENGL_BIT,
+        EGL_RED_SIZE,           8,
+        EGL_GREEN_SIZE,         8,
+        EGL_BLUE_SIZE,          8,
+        EGL_ALPHA_SIZE,         (pixelFormat.colorBits == 32 ? 8 : 0),
+        EGL_DEPTH_SIZE,         pixelFormat.depthBits,
+        EGL_STENCIL_SIZE,       pixelFormat.stencilBits,
+        EGL_NONE
+    };
+
+    EGLint numConfigs = 0;
+    if (eglChooseConfig(display_, configAttribs, &config_, 1, &numConfigs) != EGL_TRUE || numConfigs == 0)
+        LLGL_TRAP("failed to choose EGL configuration for headless GL context");
+
+    /* Create OpenGL context instead of the default OpenGLES context */
+    if (eglBindAPI(EGL_OPENGL_API) != EGL_TRUE)
+        LLGL_TRAP("failed to bind OpenGL API for EGL");
+
+    EGLContext eglShared = (sharedContext != nullptr ? sharedContext->context_ : EGL_NO_CONTEXT);
+
+    if (profile.contextProfile == OpenGLContextProfile::CoreProfile)
+        context_ = CreateEGLContextCoreProfile(eglShared, profile.majorVersion, profile.minorVersion);
+
+    if (context_ == EGL_NO_CONTEXT)
+    {
+        /* Fall back to context with default attributes */
+        context_ = eglCreateContext(display_, config_, eglShared, nullptr);
+        if (context_ == EGL_NO_CONTEXT)
+            LLGL_TRAP("failed to create headless EGL context");
+    }
+
+    /* Use placeholder pbuffer if the context cannot be made current without any surface */
+    if (!HasEGLExtension(display_, "EGL_KHR_surfaceless_context"))
+    {
+        const EGLint pbufferAttribs[] =
+        {
+            EGL_WIDTH,  1,
+            EGL_HEIGHT, 1,
+            EGL_NONE
+        };
+        surface_ = eglCreatePbufferSurface(display_, config_, pbufferAttribs);
+        if (surface_ == EGL_NO_SURFACE)
+            LLGL_TRAP("failed to create EGL pbuffer surface for headless GL context");
+    }
+
+    if (eglMakeCurrent(display_, surface_, surface_, context_) != EGL_TRUE)
+        Log::Errorf("eglMakeCurrent failed on headless GL context\n");
+
+    /* Deduce color and depth-stencil formats */
+    SetDefaultColorFormat();
+    DeduceDepthStencilFormat(pixelFormat.depthBits, pixelFormat.stencilBits);
+}
+
+void LinuxEGLContext::DeleteEGLContext()
+{
+    eglMakeCurrent(display_, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (surface_ != EGL_NO_SURFACE)
+        eglDestroySurface(display_, surface_);
+    eglDestroyContext(display_, context_);
+}
+
+EGLContext LinuxEGLContext::CreateEGLContextCoreProfile(EGLContext sharedContext, int major, int minor)
+{
+    if (!HasEGLExtension(display_, "EGL_KHR_create_context"))
+    {
+        Log::Errorf("cannot create OpenGL core profile without EGL_KHR_create_context\n");
+        return EGL_NO_CONTEXT;
+    }
+
+    auto CreateContextWithVersion = [this, sharedContext](int major, int minor) -> EGLContext
+    {
+        const EGLint contextAttribs[] =
+        {
+            EGL_CONTEXT_MAJOR_VERSION_KHR,          major,
+            EGL_CONTEXT_MINOR_VERSION_KHR,          minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR,    EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+            EGL_NONE
+        };
+        return eglCreateContext(display_, config_, sharedContext, contextAttribs);
+    };
+
+    if (major != 0 || minor != 0)
+        return CreateContextWithVersion(major, minor);
+
+    /* There is no intermediate context to query the highest GL version from, so try all core profile versions in descending order */
+    static const int coreProfileVersions[][2] =
+    {
+        { 4, 6 }, { 4, 5 }, { 4, 4 }, { 4, 3 }, { 4, 2 }, { 4, 1 }, { 4, 0 }, { 3, 3 }, { 3, 2 },
+    };
+
+    for (const auto& version : coreProfileVersions)
+    {
+        EGLContext context = CreateContextWithVersion(version[0], version[1]);
+        if (context != EGL_NO_CONTEXT)
+            return context;
+    }
+
+    return EGL_NO_CONTEXT;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,90 @@
+/*
+ * LinuxEGLContext.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_EGL_CONTEXT_H
+#define LLGL_LINUX_EGL_CONTEXT_H
+
+
+#include "../GLContext.h"
+#include <LLGL/RendererConfiguration.h>
+#include <EGL/egl.h>
+
+
+namespace LLGL
+{
+
+
+// Implementation of the <GLContext> interface for headless GL contexts on GNU/Linux via EGL, i.e. without any X11 display or window.
+class LinuxEGLContext : public GLContext
+{
+
+    public:
+
+        LinuxEGLContext(
+            const GLPixelFormat&                pixelFormat,
+            const RendererConfigurationOpenGL&  profile,
+            LinuxEGLContext*                    sharedContext,
+            int                                 adapterIndex
+        );
+        ~LinuxEGLContext();
+
+        int GetSamples() const override;
+
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const override;
+
+    public:
+
+        // Returns the native <EGLDisplay> object. All headless contexts share the same display.
+        inline ::EGLDisplay GetEGLDisplay() const
+        {
+            return display_;
+        }
+
+        // Returns the native <EGLContext> object.
+        inline ::EGLContext GetEGLContext() const
+        {
+            return context_;
+        }
+
+        // Returns the placeholder pbuffer surface or EGL_NO_SURFACE if EGL_KHR_surfaceless_context is supported.
+        inline ::EGLSurface GetEGLSurface() const
+        {
+            return surface_;
+        }
+
+        // Returns the shared EGL display if any headless context is alive. Otherwise, returns EGL_NO_DISPLAY. Thread-safe.
+        static ::EGLDisplay GetSharedEGLDisplay();
+
+    private:
+
+        bool SetSwapInterval(int interval) override;
+
+    private:
+
+        void CreateEGLContext(const GLPixelFormat& pixelFormat, const RendererConfigurationOpenGL& profile, LinuxEGLContext* sharedContext);
+        void DeleteEGLContext();
+
+        ::EGLContext CreateEGLContextCoreProfile(::EGLContext sharedContext, int major, int minor);
+
+    private:
+
+        ::EGLDisplay    display_    = EGL_NO_DISPLAY;
+        ::EGLConfig     config_     = nullptr;
+        ::EGLContext    context_    = EGL_NO_CONTEXT;
+        ::EGLSurface    surface_    = EGL_NO_SURFACE;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,71 @@
+/*
+ * LinuxEGLSwapChainContext.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "LinuxEGLSwapChainContext.h"
+#include "LinuxEGLContext.h"
+#include "../../../CheckedCast.h"
+#include "../../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+/*
+ * GLSwapChainContext class
+ */
+
+std::unique_ptr<GLSwapChainContext> GLSwapChainContext::CreateHeadless(GLContext& context)
+{
+    return MakeUnique<LinuxEGLSwapChainContext>(LLGL_CAST(LinuxEGLContext&, context));
+}
+
+
+/*
+ * LinuxEGLSwapChainContext class
+ */
+
+LinuxEGLSwapChainContext::LinuxEGLSwapChainContext(LinuxEGLContext& context) :
+    GLSwapChainContext { context                  },
+    display_           { context.GetEGLDisplay()  },
+    surface_           { context.GetEGLSurface()  },
+    context_           { context.GetEGLContext()  }
+{
+}
+
+bool LinuxEGLSwapChainContext::HasDrawable() const
+{
+    return false;
+}
+
+bool LinuxEGLSwapChainContext::SwapBuffers()
+{
+    /* Headless contexts never present anything */
+    return false;
+}
+
+void LinuxEGLSwapChainContext::Resize(const Extent2D& resolution)
+{
+    // dummy
+}
+
+bool LinuxEGLSwapChainContext::MakeCurrentEGLContext(LinuxEGLSwapChainContext* context)
+{
+    /* EGL binds the current API per thread, so it must be re-bound before making an OpenGL context current on a new thread */
+    eglBindAPI(EGL_OPENGL_API);
+    if (context)
+        return (eglMakeCurrent(context->display_, context->surface_, context->surface_, context->context_) == EGL_TRUE);
+    else
+        return (eglMakeCurrent(LinuxEGLContext::GetSharedEGLDisplay(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT) == EGL_TRUE);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,54 @@
+/*
+ * LinuxEGLSwapChainContext.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_LINUX_EGL_SWAP_CHAIN_CONTEXT_H
+#define LLGL_LINUX_EGL_SWAP_CHAIN_CONTEXT_H
+
+
+#include "../GLSwapChainContext.h"
+#include <EGL/egl.h>
+
+
+namespace LLGL
+{
+
+
+class LinuxEGLContext;
+
+// Swap-chain context for headless EGL contexts. It has no drawable and only binds the context with its placeholder surface.
+class LinuxEGLSwapChainContext final : public GLSwapChainContext
+{
+
+    public:
+
+        LinuxEGLSwapChainContext(LinuxEGLContext& context);
+
+        bool HasDrawable() const override;
+        bool SwapBuffers() override;
+        void Resize(const Extent2D& resolution) override;
+
+    public:
+
+        static bool MakeCurrentEGLContext(LinuxEGLSwapChainContext* context);
+
+    private:
+
+        ::EGLDisplay    display_    = EGL_NO_DISPLAY;
+        ::EGLSurface    surface_    = EGL_NO_SURFACE;
+        ::EGLContext    context_    = EGL_NO_CONTEXT;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
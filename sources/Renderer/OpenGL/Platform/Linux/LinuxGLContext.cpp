@@ -18,6 +18,8 @@
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
 #include <LLGL/Log.h>
 #include <algorithm>
+#include <mutex>
+#include <vector>
 
 
 namespace LLGL
@@ -106,7 +108,51 @@ bool LinuxGLContext::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
     return false;
 }
 
-::XVisualInfo* LinuxGLContext::ChooseVisual(::Display* display, int screen, const GLPixelFormat& pixelFormat, int& outSamples)
+// X11 visual that has been chosen for a requested GL pixel format on a display and screen.
+struct GLXVisualCacheEntry
+{
+    ::Display*      display;
+    int             screen;
+    GLPixelFormat   pixelFormat;
+    ::VisualID      visualID;
+    int             samples;
+};
+
+// Enumerating GLX framebuffer configurations can be slow, so the chosen visuals are reused for all subsequent swap-chains.
+static std::mutex                       g_glxVisualCacheMutex;
+static std::vector<GLXVisualCacheEntry> g_glxVisualCache;
+
+static ::XVisualInfo* FindCachedVisual(::Display* display, int screen, const GLPixelFormat& pixelFormat, int& outSamples)
+{
+    std::lock_guard<std::mutex> guard{ g_glxVisualCacheMutex };
+    for (const GLXVisualCacheEntry& entry : g_glxVisualCache)
+    {
+        if (entry.display == display && entry.screen == screen && entry.pixelFormat == pixelFormat)
+        {
+            /* Return a new copy of the visual info, since the caller owns the returned object */
+            ::XVisualInfo visualTemplate = {};
+            visualTemplate.visualid = entry.visualID;
+            visualTemplate.screen   = screen;
+
+            int numVisuals = 0;
+            if (::XVisualInfo* visual = XGetVisualInfo(display, VisualIDMask | VisualScreenMask, &visualTemplate, &numVisuals))
+            {
+                outSamples = entry.samples;
+                return visual;
+            }
+            break;
+        }
+    }
+    return nullptr;
+}
+
+static void CacheVisual(::Display* display, int screen, const GLPixelFormat& pixelFormat, const ::XVisualInfo* visual, int samples)
+{
+    std::lock_guard<std::mutex> guard{ g_glxVisualCacheMutex };
+    g_glxVisualCache.push_back(GLXVisualCacheEntry{ display, screen, pixelFormat, visual->visualid, samples });
+}
+
+static ::XVisualInfo* ChooseUncachedVisual(::Display* display, int screen, const GLPixelFormat& pixelFormat, int& outSamples)
 {
     GLXFBConfig framebufferConfig = 0;
 
@@ -138,12 +184,10 @@ bool LinuxGLContext::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
         if (fbConfigs != nullptr)
         {
             if (fbConfigsCount > 0)
-            {
                 framebufferConfig = fbConfigs[0];
-                if (framebufferConfig != 0)
-                    break;
-            }
             XFree(fbConfigs);
+            if (framebufferConfig != 0)
+                break;
         }
     }
 
@@ -172,6 +216,18 @@ bool LinuxGLContext::GetNativeHandle(void* nativeHandle, std::size_t nativeHandl
     }
 }
 
+::XVisualInfo* LinuxGLContext::ChooseVisual(::Display* display, int screen, const GLPixelFormat& pixelFormat, int& outSamples)
+{
+    if (::XVisualInfo* visual = FindCachedVisual(display, screen, pixelFormat, outSamples))
+        return visual;
+
+    ::XVisualInfo* visual = ChooseUncachedVisual(display, screen, pixelFormat, outSamples);
+    if (visual != nullptr)
+        CacheVisual(display, screen, pixelFormat, visual, outSamples);
+
+    return visual;
+}
+
 
 /*
  * ======= Private: =======
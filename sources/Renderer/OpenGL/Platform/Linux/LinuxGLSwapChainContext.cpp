@@ -11,6 +11,11 @@
 #include "../../../../Core/Exception.h"
 #include <LLGL/Platform/NativeHandle.h>
 
+#ifdef LLGL_GL_ENABLE_EGL
+#   include "LinuxEGLContext.h"
+#   include "LinuxEGLSwapChainContext.h"
+#endif
+
 
 namespace LLGL
 {
@@ -27,6 +32,11 @@ std::unique_ptr<GLSwapChainContext> GLSwapChainContext::Create(GLContext& contex
 
 bool GLSwapChainContext::MakeCurrentUnchecked(GLSwapChainContext* context)
 {
+    #ifdef LLGL_GL_ENABLE_EGL
+    /* Headless EGL contexts and GLX contexts cannot be mixed, so the shared EGL display determines which one is in use */
+    if (LinuxEGLContext::GetSharedEGLDisplay() != EGL_NO_DISPLAY)
+        return LinuxEGLSwapChainContext::MakeCurrentEGLContext(static_cast<LinuxEGLSwapChainContext*>(context));
+    #endif
     return LinuxGLSwapChainContext::MakeCurrentGLXContext(static_cast<LinuxGLSwapChainContext*>(context));
 }
 
@@ -20,6 +20,8 @@
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
 #include <LLGL/Log.h>
 #include <algorithm>
+#include <mutex>
+#include <vector>
 
 
 namespace LLGL
@@ -231,26 +233,11 @@ void Win32GLContext::CreateWGLContext(Surface& surface, Win32GLContext* sharedCo
 {
     const bool hasMultiSampling = (formatDesc_.samples > 1);
 
-    /* Is multi-sampling requested but no suitable pixel format is cached yet? */
+    /* Is multi-sampling requested but no suitable pixel format is chosen yet? */
     if (hasMultiSampling && pixelFormatsMSCount_ == 0)
     {
-        /*
-        A multi-sampling render context is created in these steps:
-        1. Create a proxy Win32 window to get a valid device context (HDC).
-        2. Create a default WGL context to get a valid OpenGL render context (HGLRC).
-        3. Load the OpenGL extension procedure to select a multi-sample pixel format (wglChoosePixelFormatARB).
-        4. Cache available multi-sample pixel formats.
-        5. Delete proxy window.
-        */
-        HWND proxyWnd = CreateProxyWindow();
-        LLGL_ASSERT(proxyWnd != nullptr);
-        HDC proxyDC = GetDC(proxyWnd);
-        SelectPixelFormat(proxyDC);
-        HGLRC proxyGLRC = CreateStandardWGLContext(proxyDC);
-        if (!SelectMultisampledPixelFormat(proxyDC))
+        if (!SelectMultisampledPixelFormat())
             ErrorMultisampleContextFailed();
-        DeleteWGLContext(proxyGLRC);
-        ::DestroyWindow(proxyWnd);
     }
 
     /* Get the surface's Win32 device context */
@@ -470,24 +457,6 @@ bool Win32GLContext::SelectPixelFormat(HDC hDC)
             }
 
             wasStandardFormatUsed = true;
-
-            /* Deduce color and depth-stencil formats by pixel format descriptor */
-            PIXELFORMATDESCRIPTOR selectedFormatDesc;
-            ::DescribePixelFormat(hDC, pixelFormat_, sizeof(selectedFormatDesc), &selectedFormatDesc);
-            DeduceColorFormat(
-                selectedFormatDesc.cRedBits,
-                selectedFormatDesc.cRedShift,
-                selectedFormatDesc.cGreenBits,
-                selectedFormatDesc.cGreenShift,
-                selectedFormatDesc.cBlueBits,
-                selectedFormatDesc.cBlueShift,
-                selectedFormatDesc.cAlphaBits,
-                selectedFormatDesc.cAlphaShift
-            );
-            DeduceDepthStencilFormat(
-                selectedFormatDesc.cDepthBits,
-                selectedFormatDesc.cStencilBits
-            );
         }
 
         /* Check for errors */
@@ -508,6 +477,24 @@ bool Win32GLContext::SelectPixelFormat(HDC hDC)
         }
         else
         {
+            /* Deduce color and depth-stencil formats by the selected pixel format, which might have been chosen from the multi-sampled pixel format cache */
+            PIXELFORMATDESCRIPTOR selectedFormatDesc;
+            ::DescribePixelFormat(hDC, pixelFormat_, sizeof(selectedFormatDesc), &selectedFormatDesc);
+            DeduceColorFormat(
+                selectedFormatDesc.cRedBits,
+                selectedFormatDesc.cRedShift,
+                selectedFormatDesc.cGreenBits,
+                selectedFormatDesc.cGreenShift,
+                selectedFormatDesc.cBlueBits,
+                selectedFormatDesc.cBlueShift,
+                selectedFormatDesc.cAlphaBits,
+                selectedFormatDesc.cAlphaShift
+            );
+            DeduceDepthStencilFormat(
+                selectedFormatDesc.cDepthBits,
+                selectedFormatDesc.cStencilBits
+            );
+
             /* Format was selected -> quit with success */
             break;
         }
@@ -516,7 +503,20 @@ bool Win32GLContext::SelectPixelFormat(HDC hDC)
     return true;
 }
 
-bool Win32GLContext::SelectMultisampledPixelFormat(HDC hDC)
+// Multi-sampled pixel formats that have been chosen for a requested GL pixel format.
+struct WGLMultisamplePixelFormats
+{
+    GLPixelFormat   requestedFormat;
+    int             samples                                     = 0;
+    UINT            count                                       = 0;
+    int             formats[Win32GLContext::maxPixelFormatsMS]  = {};
+};
+
+// Choosing multi-sampled pixel formats requires a proxy window and GL context, so the results are shared between all GL contexts.
+static std::mutex                               g_wglPixelFormatCacheMutex;
+static std::vector<WGLMultisamplePixelFormats>  g_wglPixelFormatCache;
+
+static bool ChooseWGLMultisamplePixelFormats(HDC hDC, WGLMultisamplePixelFormats& outFormats)
 {
     /*
     Load GL extension "wglChoosePixelFormatARB" to choose multi-sample pixel formats
@@ -528,10 +528,11 @@ bool Win32GLContext::SelectMultisampledPixelFormat(HDC hDC)
             return false;
     }
 
+    const GLPixelFormat& pixelFormat = outFormats.requestedFormat;
     const float attribsFlt[] = { 0.0f, 0.0f };
 
     /* Reduce sample count successively if we fail to select a pixel format with the current sample count */
-    for (; formatDesc_.samples > 0; formatDesc_.samples--)
+    for (outFormats.samples = pixelFormat.samples; outFormats.samples > 0; outFormats.samples--)
     {
         const int attribsInt[] =
         {
@@ -539,12 +540,12 @@ bool Win32GLContext::SelectMultisampledPixelFormat(HDC hDC)
             WGL_SUPPORT_OPENGL_ARB, GL_TRUE,
             WGL_ACCELERATION_ARB,   WGL_FULL_ACCELERATION_ARB,
             WGL_COLOR_BITS_ARB,     24,
-            WGL_ALPHA_BITS_ARB,     (formatDesc_.colorBits == 32 ? 8 : 0),
-            WGL_DEPTH_BITS_ARB,     formatDesc_.depthBits,
-            WGL_STENCIL_BITS_ARB,   formatDesc_.stencilBits,
+            WGL_ALPHA_BITS_ARB,     (pixelFormat.colorBits == 32 ? 8 : 0),
+            WGL_DEPTH_BITS_ARB,     pixelFormat.depthBits,
+            WGL_STENCIL_BITS_ARB,   pixelFormat.stencilBits,
             WGL_DOUBLE_BUFFER_ARB,  GL_TRUE,
-            WGL_SAMPLE_BUFFERS_ARB, (formatDesc_.samples > 1 ? GL_TRUE : GL_FALSE),
-            WGL_SAMPLES_ARB,        formatDesc_.samples,
+            WGL_SAMPLE_BUFFERS_ARB, (outFormats.samples > 1 ? GL_TRUE : GL_FALSE),
+            WGL_SAMPLES_ARB,        outFormats.samples,
             0, 0
         };
 
@@ -554,11 +555,11 @@ bool Win32GLContext::SelectMultisampledPixelFormat(HDC hDC)
             attribsInt,
             attribsFlt,
             Win32GLContext::maxPixelFormatsMS,
-            pixelFormatsMS_,
-            &pixelFormatsMSCount_
+            outFormats.formats,
+            &outFormats.count
         );
 
-        if (result && pixelFormatsMSCount_ > 0)
+        if (result && outFormats.count > 0)
         {
             /* Found suitable pixel formats */
             return true;
@@ -569,6 +570,94 @@ bool Win32GLContext::SelectMultisampledPixelFormat(HDC hDC)
     return false;
 }
 
+static bool ProbeWGLMultisamplePixelFormats(WGLMultisamplePixelFormats& outFormats)
+{
+    /*
+    Multi-sampled pixel formats are chosen in these steps:
+    1. Create a proxy Win32 window to get a valid device context (HDC).
+    2. Create a default WGL context to get a valid OpenGL render context (HGLRC).
+    3. Load the OpenGL extension procedure to select a multi-sample pixel format (wglChoosePixelFormatARB).
+    4. Choose available multi-sample pixel formats.
+    5. Delete proxy context and window.
+    This does not depend on any other GL context, so it can also run on a worker thread.
+    */
+    HWND proxyWnd = CreateProxyWindow();
+    if (proxyWnd == nullptr)
+        return false;
+
+    HDC proxyDC = ::GetDC(proxyWnd);
+
+    PIXELFORMATDESCRIPTOR formatDesc;
+    GetWGLPixelFormatDesc(outFormats.requestedFormat, formatDesc);
+
+    bool result = false;
+
+    const int proxyPixelFormat = ::ChoosePixelFormat(proxyDC, &formatDesc);
+    if (proxyPixelFormat != 0 && ::SetPixelFormat(proxyDC, proxyPixelFormat, &formatDesc) != FALSE)
+    {
+        if (HGLRC proxyGLRC = wglCreateContext(proxyDC))
+        {
+            if (MakeWGLContextCurrent(proxyDC, proxyGLRC))
+            {
+                result = ChooseWGLMultisamplePixelFormats(proxyDC, outFormats);
+                wglMakeCurrent(nullptr, nullptr);
+            }
+            DeleteWGLContext(proxyGLRC);
+        }
+    }
+
+    ::ReleaseDC(proxyWnd, proxyDC);
+    ::DestroyWindow(proxyWnd);
+
+    return result;
+}
+
+static bool FindOrProbeWGLMultisamplePixelFormats(const GLPixelFormat& pixelFormat, WGLMultisamplePixelFormats& outFormats)
+{
+    /* Hold the lock while probing, so concurrent requests for the same pixel format wait for the result instead of probing again */
+    std::lock_guard<std::mutex> guard{ g_wglPixelFormatCacheMutex };
+
+    for (const WGLMultisamplePixelFormats& entry : g_wglPixelFormatCache)
+    {
+        if (entry.requestedFormat == pixelFormat)
+        {
+            outFormats = entry;
+            return true;
+        }
+    }
+
+    /* Only cache successful results, so a failed probe is repeated for the next GL context */
+    outFormats.requestedFormat = pixelFormat;
+    if (!ProbeWGLMultisamplePixelFormats(outFormats))
+        return false;
+
+    g_wglPixelFormatCache.push_back(outFormats);
+    return true;
+}
+
+void GLContext::PreparePixelFormat(const GLPixelFormat& pixelFormat)
+{
+    /* Only multi-sampled pixel formats need a proxy context */
+    if (pixelFormat.samples > 1)
+    {
+        WGLMultisamplePixelFormats formats;
+        FindOrProbeWGLMultisamplePixelFormats(pixelFormat, formats);
+    }
+}
+
+bool Win32GLContext::SelectMultisampledPixelFormat()
+{
+    WGLMultisamplePixelFormats formats;
+    if (!FindOrProbeWGLMultisamplePixelFormats(formatDesc_, formats))
+        return false;
+
+    formatDesc_.samples     = formats.samples;
+    pixelFormatsMSCount_    = formats.count;
+    std::copy(formats.formats, formats.formats + formats.count, pixelFormatsMS_);
+
+    return true;
+}
+
 void Win32GLContext::CopyPixelFormat(Win32GLContext& sourceContext)
 {
     /* Copy pixel format and array of multi-sampled pixel formats */
@@ -39,6 +39,11 @@ class Win32GLContext final : public GLContext
 
         bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) const override;
 
+    public:
+
+        // Maximum number of multi-sampled pixel formats that are chosen per context.
+        static constexpr UINT maxPixelFormatsMS = 8;
+
     public:
 
         // Select the pixel format for the specified surface to make it compatible with this GL context.
@@ -69,15 +74,13 @@ class Win32GLContext final : public GLContext
         HGLRC CreateStandardWGLContext(HDC hDC);
         HGLRC CreateExplicitWGLContext(HDC hDC, Win32GLContext* sharedContext = nullptr);
 
-        bool SelectMultisampledPixelFormat(HDC hDC);
+        bool SelectMultisampledPixelFormat();
         void CopyPixelFormat(Win32GLContext& sourceContext);
 
         void ErrorMultisampleContextFailed();
 
     private:
 
-        static constexpr UINT       maxPixelFormatsMS                   = 8;
-
         RendererConfigurationOpenGL profile_;
         GLPixelFormat               formatDesc_;
 
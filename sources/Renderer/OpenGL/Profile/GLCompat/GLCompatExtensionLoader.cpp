@@ -14,6 +14,10 @@
 #include <string>
 #include <map>
 
+#if defined(__linux__) && defined(LLGL_GL_ENABLE_EGL)
+#   include <EGL/egl.h>
+#endif
+
 
 namespace LLGL
 {
@@ -34,6 +38,11 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #   ifdef LLGL_GL_ENABLE_EGL
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #   endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     LLGL_TRAP("platform not supported for loading OpenGL extensions");
@@ -403,6 +412,13 @@ static bool DECL_LOADGLEXT_PROC(ARB_internalformat_query2)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_invalidate_subdata)
+{
+    LOAD_GLPROC( glInvalidateFramebuffer    );
+    LOAD_GLPROC( glInvalidateSubFramebuffer );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_ES2_compatibility)
 {
     LOAD_GLPROC( glReleaseShaderCompiler    );
@@ -520,7 +536,7 @@ static GLExtensionMap           g_OpenGLExtensionsMap;
 static std::set<const char*>    g_supportedOpenGLExtensions;
 static std::set<const char*>    g_loadedOpenGLExtensions;
 
-bool LoadSupportedOpenGLExtensions(bool /*isCoreProfile*/, bool abortOnFailure)
+bool LoadSupportedOpenGLExtensions(bool /*isCoreProfile*/, bool abortOnFailure, bool /*lazyLoading*/)
 {
     /* Only load GL extensions once */
     if (g_OpenGLExtensionsLoaded)
@@ -664,6 +680,7 @@ bool LoadSupportedOpenGLExtensions(bool /*isCoreProfile*/, bool abortOnFailure)
     LOAD_GLEXT( ARB_sync                         );
     LOAD_GLEXT( ARB_internalformat_query         );
     LOAD_GLEXT( ARB_internalformat_query2        );
+    LOAD_GLEXT( ARB_invalidate_subdata           );
     LOAD_GLEXT( ARB_ES2_compatibility            );
     LOAD_GLEXT( ARB_buffer_storage               );
     LOAD_GLEXT( ARB_copy_buffer                  );
@@ -676,6 +693,8 @@ bool LoadSupportedOpenGLExtensions(bool /*isCoreProfile*/, bool abortOnFailure)
 
     /* Enable extensions without procedures */
     ENABLE_GLEXT( ARB_texture_cube_map );
+    ENABLE_GLEXT( NVX_gpu_memory_info  );
+    ENABLE_GLEXT( KHR_texture_compression_astc_hdr );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
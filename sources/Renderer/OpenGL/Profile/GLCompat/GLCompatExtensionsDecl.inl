@@ -259,6 +259,11 @@ DECL_GLPROC(PFNGLGETINTERNALFORMATIVPROC,                           glGetInterna
 
 DECL_GLPROC(PFNGLGETINTERNALFORMATI64VPROC,                         glGetInternalformati64v,                        void,           (GLenum, GLenum, GLenum, GLsizei, GLint64*));
 
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(PFNGLINVALIDATEFRAMEBUFFERPROC,                         glInvalidateFramebuffer,                        void,           (GLenum, GLsizei, const GLenum*));
+DECL_GLPROC(PFNGLINVALIDATESUBFRAMEBUFFERPROC,                      glInvalidateSubFramebuffer,                     void,           (GLenum, GLsizei, const GLenum*, GLint, GLint, GLsizei, GLsizei));
+
 /* GL_ARB_ES2_compatibility */
 
 DECL_GLPROC(PFNGLRELEASESHADERCOMPILERPROC,                         glReleaseShaderCompiler,                        void,           (void));
@@ -175,6 +175,13 @@ static void GLGetSupportedTextureFormats(std::vector<Format>& textureFormats)
     }
 
     #endif
+
+    /* ASTC HDR blocks share their internal formats with LDR blocks, so they are only reported via the HDR profile extension */
+    if (HasExtension(GLExt::KHR_texture_compression_astc_hdr))
+    {
+        for (int i = static_cast<int>(Format::ASTC4x4Float); i <= static_cast<int>(Format::ASTC12x12Float); ++i)
+            textureFormats.push_back(static_cast<Format>(i));
+    }
 }
 
 static void GLGetSupportedFeatures(RenderingFeatures& features)
@@ -206,6 +213,23 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasLogicOp                     = true;
     features.hasPipelineStatistics          = false;
     features.hasRenderCondition             = true;
+    features.hasTimestampQueries            = HasExtension(GLExt::ARB_timer_query);
+    features.hasQueryResolve                = false;
+    features.hasBindlessResourceHeaps       = false;
+    features.hasIndirectCountDrawing        = false;
+    features.hasMeshShaders                 = false;
+    features.hasTileShaders                 = false;
+    features.hasFramebufferFetch            = false;
+    features.hasVariableRateShading         = false;
+    features.hasIndirectStateChanges        = false;
+    features.hasTransientBuffers            = false;
+    features.hasPersistentMapping           = HasExtension(GLExt::ARB_buffer_storage);
+    features.hasSparseTextures              = false;
+    features.hasPlacementHeaps              = false;
+    features.hasSharedResources             = false;
+    features.hasConcurrentResourceCreation  = false;
+    features.hasRayTracing                  = false;
+    features.hasRayQuery                    = false;
 }
 
 static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimits& limits)
@@ -8,12 +8,17 @@
 #include "../../Ext/GLExtensionLoader.h"
 #include "../../Ext/GLExtensionRegistry.h"
 #include "../../../../Core/Exception.h"
+#include "../../GLCore.h"
 #include "GLCoreExtensions.h"
 #include <LLGL/Utils/ForRange.h>
 #include <functional>
 #include <string>
 #include <map>
 
+#if defined(__linux__) && defined(LLGL_GL_ENABLE_EGL)
+#   include <EGL/egl.h>
+#endif
+
 
 namespace LLGL
 {
@@ -34,6 +39,11 @@ bool LoadGLProc(T& procAddr, const char* procName)
     #if defined(_WIN32)
     procAddr = reinterpret_cast<T>(wglGetProcAddress(procName));
     #elif defined(__linux__)
+    #   ifdef LLGL_GL_ENABLE_EGL
+    if (eglGetCurrentContext() != EGL_NO_CONTEXT)
+        procAddr = reinterpret_cast<T>(eglGetProcAddress(procName));
+    else
+    #   endif
     procAddr = reinterpret_cast<T>(glXGetProcAddress(reinterpret_cast<const GLubyte*>(procName)));
     #else
     LLGL_TRAP("platform not supported for loading OpenGL extensions");
@@ -59,26 +69,65 @@ static void ExtractExtensionsFromString(GLExtensionMap& extensions, const std::s
 
 #ifndef __APPLE__
 
-using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOnFailure, bool usePlaceholder)>;
+// Modes how the procedures of an OpenGL extension are loaded.
+enum class GLProcLoadMode
+{
+    Immediate,      // Load all procedures immediately.
+    Lazy,           // Use trampolines that resolve their procedure on first invocation.
+    Placeholder,    // Use proxy procedures to detect illegal use of unsupported extensions.
+};
+
+/*
+Trampoline for lazily resolved OpenGL procedures: The first invocation replaces the procedure pointer with the actual address and forwards the call.
+After that, all calls go directly to the GL implementation. This defers the cost of hundreds of GetProcAddress calls until a procedure is actually used.
+*/
+template <typename TProc>
+struct GLLazyProc;
+
+template <typename TRet, typename... TArgs>
+struct GLLazyProc<TRet (APIENTRY*)(TArgs...)>
+{
+    using PFN = TRet (APIENTRY*)(TArgs...);
+
+    template <PFN& Proc, typename TProcName>
+    static TRet APIENTRY Resolve(TArgs... args)
+    {
+        if (!LoadGLProc(Proc, TProcName::Get()))
+            ErrUnsupportedGLProc(TProcName::Get());
+        return Proc(args...);
+    }
+};
+
+using LoadGLExtensionProc = std::function<bool(const char* extName, bool abortOnFailure, GLProcLoadMode loadMode)>;
 
 #define DECL_LOADGLEXT_PROC(EXTNAME) \
-    Load_GL_ ## EXTNAME(const char* extName, bool abortOnFailure, bool usePlaceholder)
+    Load_GL_ ## EXTNAME(const char* extName, bool abortOnFailure, GLProcLoadMode loadMode)
 
 #define LOAD_GLPROC_SIMPLE(NAME) \
     LoadGLProc(NAME, #NAME)
 
-#define LOAD_GLPROC(NAME)                                                           \
-    if (usePlaceholder)                                                             \
-    {                                                                               \
-        NAME = Proxy_##NAME;                                                        \
-    }                                                                               \
-    else if (!LoadGLProc(NAME, #NAME))                                              \
-    {                                                                               \
-        if (abortOnFailure)                                                         \
-            LLGL_TRAP("failed to load OpenGL procedure: %s [%s]", #NAME, extName);  \
-        return false;                                                               \
+#define LOAD_GLPROC_NAMED(NAME, PROCNAME)                                                   \
+    {                                                                                       \
+        struct ProcName { static const char* Get() { return PROCNAME; } };                  \
+        if (loadMode == GLProcLoadMode::Placeholder)                                        \
+        {                                                                                   \
+            NAME = Proxy_##NAME;                                                            \
+        }                                                                                   \
+        else if (loadMode == GLProcLoadMode::Lazy)                                          \
+        {                                                                                   \
+            NAME = GLLazyProc<decltype(NAME)>::Resolve<NAME, ProcName>;                     \
+        }                                                                                   \
+        else if (!LoadGLProc(NAME, PROCNAME))                                               \
+        {                                                                                   \
+            if (abortOnFailure)                                                             \
+                LLGL_TRAP("failed to load OpenGL procedure: %s [%s]", PROCNAME, extName);   \
+            return false;                                                                   \
+        }                                                                                   \
     }
 
+#define LOAD_GLPROC(NAME) \
+    LOAD_GLPROC_NAMED(NAME, #NAME)
+
 /* --- Common GL extensions --- */
 
 bool LoadSwapIntervalProcs()
@@ -208,6 +257,8 @@ static bool DECL_LOADGLEXT_PROC(ARB_framebuffer_object)
 static bool DECL_LOADGLEXT_PROC(ARB_uniform_buffer_object)
 {
     LOAD_GLPROC( glGetUniformBlockIndex      );
+    LOAD_GLPROC( glGetUniformIndices         );
+    LOAD_GLPROC( glGetActiveUniformsiv       );
     LOAD_GLPROC( glGetActiveUniformBlockiv   );
     LOAD_GLPROC( glGetActiveUniformBlockName );
     LOAD_GLPROC( glUniformBlockBinding       );
@@ -242,6 +293,7 @@ static bool DECL_LOADGLEXT_PROC(ARB_draw_elements_base_vertex)
 {
     LOAD_GLPROC( glDrawElementsBaseVertex          );
     LOAD_GLPROC( glDrawElementsInstancedBaseVertex );
+    LOAD_GLPROC( glMultiDrawElementsBaseVertex     );
     return true;
 }
 
@@ -618,6 +670,26 @@ static bool DECL_LOADGLEXT_PROC(KHR_debug)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(KHR_parallel_shader_compile)
+{
+    LOAD_GLPROC( glMaxShaderCompilerThreadsKHR );
+    return true;
+}
+
+// GL_ARB_parallel_shader_compile is identical to the KHR version, so its entry point is loaded into the same procedure
+static bool DECL_LOADGLEXT_PROC(ARB_parallel_shader_compile)
+{
+    LOAD_GLPROC_NAMED( glMaxShaderCompilerThreadsKHR, "glMaxShaderCompilerThreadsARB" );
+    return true;
+}
+
+// GL_OVR_multiview2 only extends the shader capabilities of GL_OVR_multiview, so its procedures are loaded with the former extension
+static bool DECL_LOADGLEXT_PROC(OVR_multiview2)
+{
+    LOAD_GLPROC( glFramebufferTextureMultiviewOVR );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_clip_control)
 {
     LOAD_GLPROC( glClipControl );
@@ -698,6 +770,13 @@ static bool DECL_LOADGLEXT_PROC(ARB_internalformat_query2)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_invalidate_subdata)
+{
+    LOAD_GLPROC( glInvalidateFramebuffer    );
+    LOAD_GLPROC( glInvalidateSubFramebuffer );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_ES2_compatibility)
 {
     LOAD_GLPROC( glReleaseShaderCompiler    );
@@ -747,6 +826,15 @@ static bool DECL_LOADGLEXT_PROC(ARB_copy_image)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_bindless_texture)
+{
+    LOAD_GLPROC( glGetTextureHandleARB             );
+    LOAD_GLPROC( glGetTextureSamplerHandleARB      );
+    LOAD_GLPROC( glMakeTextureHandleResidentARB    );
+    LOAD_GLPROC( glMakeTextureHandleNonResidentARB );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_polygon_offset_clamp)
 {
     LOAD_GLPROC( glPolygonOffsetClamp );
@@ -788,6 +876,13 @@ static bool DECL_LOADGLEXT_PROC(ARB_multi_draw_indirect)
     return true;
 }
 
+static bool DECL_LOADGLEXT_PROC(ARB_indirect_parameters)
+{
+    LOAD_GLPROC( glMultiDrawArraysIndirectCount   );
+    LOAD_GLPROC( glMultiDrawElementsIndirectCount );
+    return true;
+}
+
 static bool DECL_LOADGLEXT_PROC(ARB_get_texture_sub_image)
 {
     LOAD_GLPROC( glGetTextureSubImage           );
@@ -911,6 +1006,7 @@ static bool DECL_LOADGLEXT_PROC(ARB_direct_state_access)
 
 #undef DECL_LOADGLEXT_PROC
 #undef LOAD_GLPROC_SIMPLE
+#undef LOAD_GLPROC_NAMED
 #undef LOAD_GLPROC
 
 #endif // /ifndef(__APPLE__)
@@ -1013,7 +1109,7 @@ static GLExtensionMap           g_OpenGLExtensionsMap;
 static std::set<const char*>    g_supportedOpenGLExtensions;
 static std::set<const char*>    g_loadedOpenGLExtensions;
 
-bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
+bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure, bool lazyLoading)
 {
     /* Only load GL extensions once */
     if (g_OpenGLExtensionsLoaded)
@@ -1094,13 +1190,15 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
 
     #else // __APPLE__
 
-    auto LoadExtension = [abortOnFailure](const char* extName, const LoadGLExtensionProc& extLoadingProc, GLExt extensionID) -> void
+    const GLProcLoadMode loadMode = (lazyLoading ? GLProcLoadMode::Lazy : GLProcLoadMode::Immediate);
+
+    auto LoadExtension = [abortOnFailure, loadMode](const char* extName, const LoadGLExtensionProc& extLoadingProc, GLExt extensionID) -> void
     {
         /* Try to load OpenGL extension */
         auto it = g_OpenGLExtensionsMap.find(extName);
         if (it != g_OpenGLExtensionsMap.end())
         {
-            if (extLoadingProc(extName, abortOnFailure, /*usePlaceholder:*/ false))
+            if (extLoadingProc(extName, abortOnFailure, loadMode))
             {
                 /* Enable extension in registry */
                 RegisterExtension(extensionID);
@@ -1109,13 +1207,13 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
             else
             {
                 /* If failed, use dummy procedures to detect illegal use of OpenGL extension */
-                extLoadingProc(extName, abortOnFailure, /*usePlaceholder:*/ true);
+                extLoadingProc(extName, abortOnFailure, GLProcLoadMode::Placeholder);
             }
         }
         else
         {
             /* If failed, use dummy procedures to detect illegal use of OpenGL extension */
-            extLoadingProc(extName, abortOnFailure, /*usePlaceholder:*/ true);
+            extLoadingProc(extName, abortOnFailure, GLProcLoadMode::Placeholder);
         }
     };
 
@@ -1196,7 +1294,11 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_multi_bind                   );
     LOAD_GLEXT( EXT_stencil_two_side             );
     LOAD_GLEXT( KHR_debug                        );
+    LOAD_GLEXT( KHR_parallel_shader_compile      );
+    if (!HasExtension(GLExt::KHR_parallel_shader_compile))
+        LoadExtension("GL_ARB_parallel_shader_compile", Load_GL_ARB_parallel_shader_compile, GLExt::KHR_parallel_shader_compile);
     LOAD_GLEXT( ARB_clip_control                 );
+    LOAD_GLEXT( OVR_multiview2                   );
     LOAD_GLEXT( ARB_draw_buffers                 );
     LOAD_GLEXT( EXT_draw_buffers2                );
     LOAD_GLEXT( EXT_transform_feedback           );
@@ -1205,6 +1307,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_sync                         );
     LOAD_GLEXT( ARB_internalformat_query         );
     LOAD_GLEXT( ARB_internalformat_query2        );
+    LOAD_GLEXT( ARB_invalidate_subdata           );
     LOAD_GLEXT( ARB_ES2_compatibility            );
     LOAD_GLEXT( ARB_gl_spirv                     );
     LOAD_GLEXT( ARB_texture_storage              );
@@ -1218,7 +1321,9 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     LOAD_GLEXT( ARB_clear_buffer_object          );
     LOAD_GLEXT( ARB_draw_indirect                );
     LOAD_GLEXT( ARB_multi_draw_indirect          );
+    LOAD_GLEXT( ARB_indirect_parameters          );
     LOAD_GLEXT( ARB_get_texture_sub_image        );
+    LOAD_GLEXT( ARB_bindless_texture             );
     #ifdef LLGL_GL_ENABLE_DSA_EXT
     LOAD_GLEXT( ARB_direct_state_access          );
     #endif
@@ -1231,11 +1336,14 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     ENABLE_GLEXT( ARB_texture_cube_map             );
     ENABLE_GLEXT( ARB_texture_cube_map_array       );
     ENABLE_GLEXT( ARB_pipeline_statistics_query    );
+    ENABLE_GLEXT( ARB_query_buffer_object          );
     ENABLE_GLEXT( ARB_seamless_cubemap_per_texture );
     ENABLE_GLEXT( ARB_ES3_compatibility            );
     ENABLE_GLEXT( EXT_texture_array                );
     ENABLE_GLEXT( INTEL_conservative_rasterization );
     ENABLE_GLEXT( NV_conservative_raster           );
+    ENABLE_GLEXT( NVX_gpu_memory_info              );
+    ENABLE_GLEXT( KHR_texture_compression_astc_hdr );
 
     #undef LOAD_GLEXT
     #undef ENABLE_GLEXT
@@ -228,6 +228,7 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDPROC,                         glDrawElemen
 
 DECL_GLPROC(PFNGLDRAWELEMENTSBASEVERTEXPROC,                        glDrawElementsBaseVertex,                       void,           (GLenum, GLsizei, GLenum, const void*, GLint));
 DECL_GLPROC(PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC,               glDrawElementsInstancedBaseVertex,              void,           (GLenum, GLsizei, GLenum, const void*, GLsizei, GLint));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC,                   glMultiDrawElementsBaseVertex,                  void,           (GLenum, const GLsizei*, GLenum, const void* const*, GLsizei, const GLint*));
 
 /* GL_ARB_base_instance */
 
@@ -404,6 +405,8 @@ DECL_GLPROC(PFNGLGETPROGRAMPIPELINEINFOLOGPROC,                     glGetProgram
 /* GL_ARB_uniform_buffer_object */
 
 DECL_GLPROC(PFNGLGETUNIFORMBLOCKINDEXPROC,                          glGetUniformBlockIndex,                         GLuint,         (GLuint, const GLchar*));
+DECL_GLPROC(PFNGLGETUNIFORMINDICESPROC,                             glGetUniformIndices,                            void,           (GLuint, GLsizei, const GLchar* const*, GLuint*));
+DECL_GLPROC(PFNGLGETACTIVEUNIFORMSIVPROC,                           glGetActiveUniformsiv,                          void,           (GLuint, GLsizei, const GLuint*, GLenum, GLint*));
 DECL_GLPROC(PFNGLGETACTIVEUNIFORMBLOCKIVPROC,                       glGetActiveUniformBlockiv,                      void,           (GLuint, GLuint, GLenum, GLint*));
 DECL_GLPROC(PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC,                     glGetActiveUniformBlockName,                    void,           (GLuint, GLuint, GLsizei, GLsizei*, GLchar*));
 DECL_GLPROC(PFNGLUNIFORMBLOCKBINDINGPROC,                           glUniformBlockBinding,                          void,           (GLuint, GLuint, GLuint));
@@ -460,6 +463,14 @@ DECL_GLPROC(PFNGLGETOBJECTLABELPROC,                                glGetObjectL
 DECL_GLPROC(PFNGLOBJECTPTRLABELPROC,                                glObjectPtrLabel,                               void,           (const void*, GLsizei, const GLchar*));
 DECL_GLPROC(PFNGLGETOBJECTPTRLABELPROC,                             glGetObjectPtrLabel,                            void,           (const void*, GLsizei, GLsizei*, GLchar*));
 
+/* GL_KHR_parallel_shader_compile */
+
+DECL_GLPROC(PFNGLMAXSHADERCOMPILERTHREADSKHRPROC,                   glMaxShaderCompilerThreadsKHR,                  void,           (GLuint));
+
+/* GL_OVR_multiview */
+
+DECL_GLPROC(PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC,                glFramebufferTextureMultiviewOVR,               void,           (GLenum, GLenum, GLuint, GLint, GLint, GLsizei));
+
 /* GL_ARB_clip_control */
 
 DECL_GLPROC(PFNGLCLIPCONTROLPROC,                                   glClipControl,                                  void,           (GLenum, GLenum));
@@ -509,6 +520,11 @@ DECL_GLPROC(PFNGLGETINTERNALFORMATIVPROC,                           glGetInterna
 
 DECL_GLPROC(PFNGLGETINTERNALFORMATI64VPROC,                         glGetInternalformati64v,                        void,           (GLenum, GLenum, GLenum, GLsizei, GLint64*));
 
+/* GL_ARB_invalidate_subdata */
+
+DECL_GLPROC(PFNGLINVALIDATEFRAMEBUFFERPROC,                         glInvalidateFramebuffer,                        void,           (GLenum, GLsizei, const GLenum*));
+DECL_GLPROC(PFNGLINVALIDATESUBFRAMEBUFFERPROC,                      glInvalidateSubFramebuffer,                     void,           (GLenum, GLsizei, const GLenum*, GLint, GLint, GLsizei, GLsizei));
+
 /* GL_ARB_ES2_compatibility */
 
 DECL_GLPROC(PFNGLRELEASESHADERCOMPILERPROC,                         glReleaseShaderCompiler,                        void,           (void));
@@ -548,6 +564,13 @@ DECL_GLPROC(PFNGLCOPYIMAGESUBDATAPROC,                              glCopyImageS
 
 DECL_GLPROC(PFNGLPOLYGONOFFSETCLAMPPROC,                            glPolygonOffsetClamp,                           void,           (GLfloat, GLfloat, GLfloat));
 
+/* GL_ARB_bindless_texture */
+
+DECL_GLPROC(PFNGLGETTEXTUREHANDLEARBPROC,                           glGetTextureHandleARB,                          GLuint64,       (GLuint));
+DECL_GLPROC(PFNGLGETTEXTURESAMPLERHANDLEARBPROC,                    glGetTextureSamplerHandleARB,                   GLuint64,       (GLuint, GLuint));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLERESIDENTARBPROC,                  glMakeTextureHandleResidentARB,                 void,           (GLuint64));
+DECL_GLPROC(PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC,               glMakeTextureHandleNonResidentARB,              void,           (GLuint64));
+
 /* GL_ARB_shader_image_load_store */
 
 DECL_GLPROC(PFNGLBINDIMAGETEXTUREPROC,                              glBindImageTexture,                             void,           (GLuint, GLuint, GLint, GLboolean, GLint, GLenum, GLenum));
@@ -573,6 +596,11 @@ DECL_GLPROC(PFNGLDRAWELEMENTSINDIRECTPROC,                          glDrawElemen
 DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTPROC,                       glMultiDrawArraysIndirect,                      void,           (GLenum, const void*, GLsizei, GLsizei));
 DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTPROC,                     glMultiDrawElementsIndirect,                    void,           (GLenum, GLenum, const void*, GLsizei, GLsizei));
 
+/* GL_ARB_indirect_parameters */
+
+DECL_GLPROC(PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC,                  glMultiDrawArraysIndirectCount,                 void,           (GLenum, const void*, GLintptr, GLsizei, GLsizei));
+DECL_GLPROC(PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC,                glMultiDrawElementsIndirectCount,               void,           (GLenum, GLenum, const void*, GLintptr, GLsizei, GLsizei));
+
 /* GL_ARB_get_texture_sub_image */
 
 DECL_GLPROC(PFNGLGETTEXTURESUBIMAGEPROC,                            glGetTextureSubImage,                           void,           (GLuint, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, GLsizei, void*));
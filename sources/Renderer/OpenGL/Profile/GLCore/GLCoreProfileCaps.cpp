@@ -179,6 +179,13 @@ static void GLGetSupportedTextureFormats(std::vector<Format>& textureFormats)
     }
 
     #endif
+
+    /* ASTC HDR blocks share their internal formats with LDR blocks, so they are only reported via the HDR profile extension */
+    if (HasExtension(GLExt::KHR_texture_compression_astc_hdr))
+    {
+        for (int i = static_cast<int>(Format::ASTC4x4Float); i <= static_cast<int>(Format::ASTC12x12Float); ++i)
+            textureFormats.push_back(static_cast<Format>(i));
+    }
 }
 
 static void GLGetSupportedFeatures(RenderingFeatures& features)
@@ -211,6 +218,24 @@ static void GLGetSupportedFeatures(RenderingFeatures& features)
     features.hasPipelineCaching             = (HasExtension(GLExt::ARB_get_program_binary) && GLGetInt(GL_NUM_PROGRAM_BINARY_FORMATS) > 0);
     features.hasPipelineStatistics          = HasExtension(GLExt::ARB_pipeline_statistics_query);
     features.hasRenderCondition             = true;
+    features.hasTimestampQueries            = HasExtension(GLExt::ARB_timer_query);
+    features.hasQueryResolve                = HasExtension(GLExt::ARB_query_buffer_object);
+    features.hasBindlessResourceHeaps       = (HasExtension(GLExt::ARB_bindless_texture) && HasExtension(GLExt::ARB_shader_storage_buffer_object));
+    features.hasIndirectCountDrawing        = HasExtension(GLExt::ARB_indirect_parameters);
+    features.hasMeshShaders                 = false;
+    features.hasTileShaders                 = false;
+    features.hasFramebufferFetch            = false;
+    features.hasVariableRateShading         = false;
+    features.hasIndirectStateChanges        = false;
+    features.hasTransientBuffers            = false;
+    features.hasPersistentMapping           = HasExtension(GLExt::ARB_buffer_storage);
+    features.hasSparseTextures              = false;
+    features.hasPlacementHeaps              = false;
+    features.hasSharedResources             = false;
+    features.hasConcurrentResourceCreation  = false;
+    features.hasRayTracing                  = false;
+    features.hasRayQuery                    = false;
+    features.hasMultiview                   = HasExtension(GLExt::OVR_multiview2);
 }
 
 static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimits& limits)
@@ -247,6 +272,9 @@ static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimit
         limits.maxComputeShaderWorkGroupSize[0] = GLGetUIntIndexed(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 0);
         limits.maxComputeShaderWorkGroupSize[1] = GLGetUIntIndexed(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 1);
         limits.maxComputeShaderWorkGroupSize[2] = GLGetUIntIndexed(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 2);
+        #ifdef GL_MAX_COMPUTE_SHARED_MEMORY_SIZE
+        limits.maxComputeShaderSharedMemorySize = GLGetUInt(GL_MAX_COMPUTE_SHARED_MEMORY_SIZE);
+        #endif
     }
 
     #ifdef GL_ARB_uniform_buffer_object
@@ -262,6 +290,14 @@ static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimit
     }
     #endif // /GL_ARB_shader_storage_buffer_object
 
+    #if LLGL_GLEXT_BINDLESS_TEXTURE
+    if (features.hasBindlessResourceHeaps)
+    {
+        /* Bindless texture handles are 64-bit values that are stored in shader storage blocks */
+        limits.maxBindlessResourceViews     = GLGetUInt(GL_MAX_SHADER_STORAGE_BLOCK_SIZE) / sizeof(GLuint64);
+    }
+    #endif // /LLGL_GLEXT_BINDLESS_TEXTURE
+
     /* Query viewport limits */
     #ifdef GL_MAX_VIEWPORTS
     limits.maxViewports                     = GLGetUInt(GL_MAX_VIEWPORTS); // GL 4.1: value must be at least 16
@@ -274,6 +310,12 @@ static void GLGetFeatureLimits(const RenderingFeatures& features, RenderingLimit
     limits.maxViewportSize[0]               = static_cast<std::uint32_t>(maxViewportDims[0]);
     limits.maxViewportSize[1]               = static_cast<std::uint32_t>(maxViewportDims[1]);
 
+    /* Query multiview limits; GL_MAX_VIEWS_OVR must be at least 2 */
+    #if LLGL_GLEXT_MULTIVIEW
+    if (features.hasMultiview)
+        limits.maxMultiviewViewCount        = std::min(GLGetUInt(GL_MAX_VIEWS_OVR), 32u);
+    #endif // /LLGL_GLEXT_MULTIVIEW
+
     /* Determine maximum buffer size to maximum value for <GLsizei> (used in 'glBufferData') */
     limits.maxBufferSize                    = static_cast<std::uint64_t>(std::numeric_limits<GLsizeiptr>::max());
     #ifdef GL_MAX_UNIFORM_BLOCK_SIZE
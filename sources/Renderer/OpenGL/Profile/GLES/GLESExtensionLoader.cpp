@@ -227,7 +227,7 @@ static void EnableGLESExtension(GLExt ext, const char* name)
     g_loadedOpenGLESExtensions.insert(name);
 }
 
-bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
+bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure, bool /*lazyLoading*/)
 {
     /* Only load GL extensions once */
     if (g_OpenGLESExtensionsLoaded)
@@ -296,6 +296,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     {
         ENABLE_GLEXT(ARB_ES3_compatibility);
         ENABLE_GLEXT(ARB_get_program_binary);
+        ENABLE_GLEXT(ARB_invalidate_subdata);
         ENABLE_GLEXT(ARB_shader_objects_30);
     }
 
@@ -315,6 +316,10 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
         ENABLE_GLEXT(ARB_texture_buffer_range);
     }
 
+    #ifdef __APPLE__
+    ENABLE_GLEXT(EXT_shader_framebuffer_fetch); // Supported by all Apple GPUs
+    #endif
+
     #undef ENABLE_GLEXT
 
     #ifndef __APPLE__
@@ -322,6 +327,20 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     /* Query supported OpenGL extension names */
     g_OpenGLESExtensionsMap = QuerySupportedOpenGLExtensions(isCoreProfile);
 
+    auto EnableExtensionIfSupported = [](GLExt ext, const char* extName) -> void
+    {
+        /* Enable extensions without procedures only if they are reported by the driver */
+        auto it = g_OpenGLESExtensionsMap.find(extName);
+        if (it != g_OpenGLESExtensionsMap.end())
+        {
+            RegisterExtension(ext);
+            it->second = true;
+        }
+    };
+
+    EnableExtensionIfSupported(GLExt::EXT_shader_framebuffer_fetch, "GL_EXT_shader_framebuffer_fetch");
+    EnableExtensionIfSupported(GLExt::KHR_texture_compression_astc_hdr, "GL_KHR_texture_compression_astc_hdr");
+
     auto LoadExtension = [abortOnFailure](const char* extName, const LoadGLExtensionProc& extLoadingProc) -> void
     {
         /* Try to load OpenGL extension */
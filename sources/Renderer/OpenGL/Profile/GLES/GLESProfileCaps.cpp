@@ -129,6 +129,13 @@ static void GLGetSupportedTextureFormats(std::vector<Format>& textureFormats)
         if (format != Format::Undefined)
             textureFormats.push_back(format);
     }
+
+    /* ASTC HDR blocks share their internal formats with LDR blocks, so they are only reported via the HDR profile extension */
+    if (HasExtension(GLExt::KHR_texture_compression_astc_hdr))
+    {
+        for (int i = static_cast<int>(Format::ASTC4x4Float); i <= static_cast<int>(Format::ASTC12x12Float); ++i)
+            textureFormats.push_back(static_cast<Format>(i));
+    }
 }
 
 static void GLGetSupportedFeatures(RenderingFeatures& features, GLint version)
@@ -159,6 +166,23 @@ static void GLGetSupportedFeatures(RenderingFeatures& features, GLint version)
     features.hasPipelineCaching             = (version >= 300); // GLES 3.0
     features.hasPipelineStatistics          = false;
     features.hasRenderCondition             = false;
+    features.hasTimestampQueries            = false;
+    features.hasQueryResolve                = false;
+    features.hasBindlessResourceHeaps       = false;
+    features.hasIndirectCountDrawing        = false;
+    features.hasMeshShaders                 = false;
+    features.hasTileShaders                 = false;
+    features.hasFramebufferFetch            = HasExtension(GLExt::EXT_shader_framebuffer_fetch);
+    features.hasVariableRateShading         = false;
+    features.hasIndirectStateChanges        = false;
+    features.hasTransientBuffers            = false;
+    features.hasPersistentMapping           = false;
+    features.hasSparseTextures              = false;
+    features.hasPlacementHeaps              = false;
+    features.hasSharedResources             = false;
+    features.hasConcurrentResourceCreation  = false;
+    features.hasRayTracing                  = false;
+    features.hasRayQuery                    = false;
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits, GLint version)
@@ -183,6 +207,7 @@ static void GLGetFeatureLimits(RenderingLimits& limits, GLint version)
     limits.maxComputeShaderWorkGroupSize[0] = GLGetUIntIndexed(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 0);
     limits.maxComputeShaderWorkGroupSize[1] = GLGetUIntIndexed(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 1);
     limits.maxComputeShaderWorkGroupSize[2] = GLGetUIntIndexed(GL_MAX_COMPUTE_WORK_GROUP_SIZE, 2);
+    limits.maxComputeShaderSharedMemorySize = GLGetUInt(GL_MAX_COMPUTE_SHARED_MEMORY_SIZE);
     #endif
 
     limits.minConstantBufferAlignment       = GLGetUInt(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT);
@@ -31,7 +31,7 @@ static void EnableWebGLExtension(GLExt ext, const char* name)
     g_loadedWebGLExtensions.insert(name);
 }
 
-bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
+bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure, bool /*lazyLoading*/)
 {
     /* Only load GL extensions once */
     if (g_WebGLExtensionsLoaded)
@@ -99,6 +99,7 @@ bool LoadSupportedOpenGLExtensions(bool isCoreProfile, bool abortOnFailure)
     // GLES 3.0
     ENABLE_GLEXT(ARB_ES3_compatibility);
     ENABLE_GLEXT(ARB_get_program_binary);
+    ENABLE_GLEXT(ARB_invalidate_subdata);
     ENABLE_GLEXT(ARB_shader_objects_30);
 
     #undef ENABLE_GLEXT
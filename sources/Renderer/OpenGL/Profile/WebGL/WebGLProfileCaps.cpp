@@ -159,6 +159,23 @@ static void GLGetSupportedFeatures(RenderingFeatures& features, GLint version)
     features.hasPipelineCaching             = false;
     features.hasPipelineStatistics          = false;
     features.hasRenderCondition             = false;
+    features.hasTimestampQueries            = false;
+    features.hasQueryResolve                = false;
+    features.hasBindlessResourceHeaps       = false;
+    features.hasIndirectCountDrawing        = false;
+    features.hasMeshShaders                 = false;
+    features.hasTileShaders                 = false;
+    features.hasFramebufferFetch            = false;
+    features.hasVariableRateShading         = false;
+    features.hasIndirectStateChanges        = false;
+    features.hasTransientBuffers            = false;
+    features.hasPersistentMapping           = false;
+    features.hasSparseTextures              = false;
+    features.hasPlacementHeaps              = false;
+    features.hasSharedResources             = false;
+    features.hasConcurrentResourceCreation  = false;
+    features.hasRayTracing                  = false;
+    features.hasRayQuery                    = false;
 }
 
 static void GLGetFeatureLimits(RenderingLimits& limits, GLint version)
@@ -101,6 +101,8 @@ static const GLenum g_bufferTargetBindings[] =
     0,
     #endif
 
+    0, // GL_PARAMETER_BUFFER_BINDING is not queried since it is only valid with GL_ARB_indirect_parameters
+
     #ifdef GL_PIXEL_PACK_BUFFER_BINDING
     GL_PIXEL_PACK_BUFFER_BINDING,
     #else
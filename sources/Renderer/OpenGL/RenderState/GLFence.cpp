@@ -7,8 +7,10 @@
 
 #include "GLFence.h"
 #include "../GLObjectUtils.h"
+#include "../Buffer/GLBuffer.h"
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -31,8 +33,36 @@ void GLFence::SetDebugName(const char* name)
     #endif
 }
 
+bool GLFence::IsSignaled()
+{
+    #if GL_ARB_sync
+    if (HasExtension(GLExt::ARB_sync))
+    {
+        /* Poll sync object with a zero timeout; the flush bit ensures the fence is eventually signaled even if nothing else flushes the context */
+        if (sync_ != 0)
+        {
+            GLenum result = glClientWaitSync(sync_, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+            if (!(result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED))
+                return false;
+        }
+    }
+    else
+    #endif // /GL_ARB_sync
+    {
+        /* Without sync objects, fences are emulated by waiting for the entire GL pipeline, which is what Wait() does as well */
+        glFinish();
+    }
+
+    ResolvePendingReadbacks();
+    return true;
+}
+
 void GLFence::Submit()
 {
+    /* Readbacks of the previous submission must be completed before this fence is re-used */
+    if (!pendingReadbacks_.empty())
+        Wait(~0ull);
+
     #if GL_ARB_sync
     if (HasExtension(GLExt::ARB_sync))
     {
@@ -61,14 +91,58 @@ bool GLFence::Wait(std::uint64_t timeout)
     if (HasExtension(GLExt::ARB_sync))
     {
         GLenum result = glClientWaitSync(sync_, GL_SYNC_FLUSH_COMMANDS_BIT, static_cast<GLuint64>(timeout));
-        return (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED);
+        if (!(result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED))
+            return false;
     }
     else
     #endif // /GL_ARB_sync
     {
         glFinish();
-        return true;
     }
+
+    ResolvePendingReadbacks();
+    return true;
+}
+
+void GLFence::WaitOnServer()
+{
+    #if GL_ARB_sync
+    if (HasExtension(GLExt::ARB_sync) && sync_ != 0)
+        glWaitSync(sync_, 0, GL_TIMEOUT_IGNORED);
+    #endif // /GL_ARB_sync
+}
+
+void GLFence::AddPendingReadback(std::unique_ptr<GLBuffer>&& packBuffer, void* dstData, std::size_t dstSize)
+{
+    PendingReadback readback;
+    {
+        readback.packBuffer = std::move(packBuffer);
+        readback.dstData    = dstData;
+        readback.dstSize    = dstSize;
+    }
+    pendingReadbacks_.push_back(std::move(readback));
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void GLFence::ResolvePendingReadbacks()
+{
+    /* The GPU has finished writing to the pack buffers, so mapping them does not stall the pipeline anymore */
+    for (PendingReadback& readback : pendingReadbacks_)
+    {
+        const GLsizeiptr size = static_cast<GLsizeiptr>(readback.dstSize);
+        if (const void* srcData = readback.packBuffer->MapBufferRange(0, size, GL_MAP_READ_BIT))
+        {
+            ::memcpy(readback.dstData, srcData, readback.dstSize);
+            readback.packBuffer->UnmapBuffer();
+        }
+        else
+            readback.packBuffer->GetBufferSubData(0, size, readback.dstData);
+    }
+    pendingReadbacks_.clear();
 }
 
 
@@ -11,6 +11,8 @@
 
 #include <LLGL/Fence.h>
 #include "../OpenGL.h"
+#include <memory>
+#include <vector>
 #include <string>
 #include <cstdint>
 
@@ -19,6 +21,8 @@ namespace LLGL
 {
 
 
+class GLBuffer;
+
 class GLFence final : public Fence
 {
 
@@ -26,6 +30,8 @@ class GLFence final : public Fence
 
         void SetDebugName(const char* name) override;
 
+        bool IsSignaled() override;
+
     public:
 
         ~GLFence();
@@ -34,12 +40,34 @@ class GLFence final : public Fence
 
         bool Wait(std::uint64_t timeout);
 
+        // Makes the GL server of the current context wait until this fence is signaled, without blocking the client thread.
+        void WaitOnServer();
+
+        // Copies the data of the specified pixel pack buffer into client memory once this fence has been signaled. Takes ownership of the buffer.
+        void AddPendingReadback(std::unique_ptr<GLBuffer>&& packBuffer, void* dstData, std::size_t dstSize);
+
+    private:
+
+        struct PendingReadback
+        {
+            std::unique_ptr<GLBuffer>   packBuffer;
+            void*                       dstData     = nullptr;
+            std::size_t                 dstSize     = 0;
+        };
+
+    private:
+
+        // Maps the pixel pack buffers of all pending readbacks and copies their data into client memory.
+        void ResolvePendingReadbacks();
+
     private:
 
         #if GL_ARB_sync
-        GLsync      sync_ = 0;
+        GLsync                          sync_               = 0;
         #endif
 
+        std::vector<PendingReadback>    pendingReadbacks_;
+
         #ifdef LLGL_DEBUG
         // Only provide name in debug mode, to keep fence objects as lightweight as possible
         std::string name_;
@@ -49,6 +49,18 @@ class GLGraphicsPSO final : public GLPipelineState
             return primitiveMode_;
         }
 
+        // Returns true if this PSO sets static viewports each time it is bound.
+        inline bool HasStaticViewports() const
+        {
+            return (numStaticViewports_ > 0);
+        }
+
+        // Returns true if this PSO sets static scissor rectangles each time it is bound.
+        inline bool HasStaticScissors() const
+        {
+            return (numStaticScissors_ > 0);
+        }
+
     private:
 
         void BuildStaticStateBuffer(const GraphicsPipelineDescriptor& desc);
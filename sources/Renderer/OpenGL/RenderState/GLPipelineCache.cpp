@@ -149,6 +149,7 @@ bool GLPipelineCache::GetProgramBinary(GLShader::Permutation permutation, GLuint
     if (writtenLegnth != entry.length)
         return false;
 
+    isModified_ = true;
     return true;
 
     #else // LLGL_GLEXT_GET_PROGRAM_BINARY
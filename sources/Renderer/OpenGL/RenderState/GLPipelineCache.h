@@ -38,6 +38,12 @@ class GLPipelineCache final : public PipelineCache
             return !(entries_[permutation].data.empty());
         }
 
+        // Returns true if any program binary has been retrieved from a GL shader program since this cache was created.
+        inline bool IsModified() const
+        {
+            return isModified_;
+        }
+
         // Loads the pipeline cache into the specified GL shader program.
         bool ProgramBinary(GLShader::Permutation permutation, GLuint program);
 
@@ -59,7 +65,8 @@ class GLPipelineCache final : public PipelineCache
 
     private:
 
-        CacheEntry entries_[GLShader::PermutationCount];
+        CacheEntry  entries_[GLShader::PermutationCount];
+        bool        isModified_ = false;
 
 };
 
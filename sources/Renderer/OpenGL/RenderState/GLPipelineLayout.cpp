@@ -7,6 +7,7 @@
 
 #include "GLPipelineLayout.h"
 #include "../RenderState/GLStateManager.h"
+#include "../RenderState/GLStatePool.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../ResourceUtils.h"
 #include "../../../Core/CoreUtils.h"
@@ -60,10 +61,22 @@ static bool HasAnyNamedResourceBindings(const PipelineLayoutDescriptor& desc)
     );
 }
 
+// Returns true if the specified pipeline layout descriptor requests a bindless heap and bindless textures are supported.
+static bool IsBindlessHeapSupported(const PipelineLayoutDescriptor& desc)
+{
+    return
+    (
+        (desc.flags & PipelineLayoutFlags::BindlessHeap) != 0       &&
+        HasExtension(GLExt::ARB_bindless_texture)                   &&
+        HasExtension(GLExt::ARB_shader_storage_buffer_object)
+    );
+}
+
 GLPipelineLayout::GLPipelineLayout(const PipelineLayoutDescriptor& desc) :
     uniforms_         { desc.uniforms                              },
     barriers_         { ToMemoryBarrierBitfield(desc.barrierFlags) },
-    hasNamedBindings_ { HasAnyNamedResourceBindings(desc)          }
+    hasNamedBindings_ { HasAnyNamedResourceBindings(desc)          },
+    isBindlessHeap_   { IsBindlessHeapSupported(desc)              }
 {
     resourceNames_.reserve(desc.bindings.size() + desc.staticSamplers.size());
 
@@ -76,6 +89,12 @@ GLPipelineLayout::GLPipelineLayout(const PipelineLayoutDescriptor& desc) :
     BuildStaticSamplers(desc);
 }
 
+GLPipelineLayout::~GLPipelineLayout()
+{
+    for (GLSamplerSPtr& sampler : staticSamplers_)
+        GLStatePool::Get().ReleaseStaticSampler(std::move(sampler));
+}
+
 std::uint32_t GLPipelineLayout::GetNumHeapBindings() const
 {
     return static_cast<std::uint32_t>(heapBindings_.size());
@@ -113,6 +132,11 @@ void GLPipelineLayout::BindStaticSamplers(GLStateManager& stateMngr) const
     }
 }
 
+GLSamplerSPtr GLPipelineLayout::GetBindlessSampler() const
+{
+    return (!staticSamplers_.empty() ? staticSamplers_.front() : nullptr);
+}
+
 
 /*
  * ======= Private: =======
@@ -239,9 +263,8 @@ void GLPipelineLayout::BuildStaticSamplers(const PipelineLayoutDescriptor& pipel
         staticSamplers_.reserve(staticSamplerDescs.size());
         for (const StaticSamplerDescriptor& desc : staticSamplerDescs)
         {
-            /* Create native sampler (GL 3.3+) and store slot and name separately */
-            GLSamplerSPtr sampler = std::make_shared<GLSampler>();
-            sampler->SamplerParameters(desc.sampler);
+            /* Share native sampler (GL 3.3+) across all pipeline layouts and store slot and name separately */
+            GLSamplerSPtr sampler = GLStatePool::Get().CreateStaticSampler(desc.sampler);
 
             const std::uint32_t numCombinedSlots = BuildCombinedStaticSamplerSlots(pipelineLayoutDesc, desc.name);
             if (numCombinedSlots > 0)
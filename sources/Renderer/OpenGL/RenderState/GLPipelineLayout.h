@@ -78,6 +78,7 @@ class GLPipelineLayout final : public PipelineLayout
     public:
 
         GLPipelineLayout(const PipelineLayoutDescriptor& desc);
+        ~GLPipelineLayout();
 
         // Binds the static samplers of this pipeline layout.
         void BindStaticSamplers(GLStateManager& stateMngr) const;
@@ -136,6 +137,15 @@ class GLPipelineLayout final : public PipelineLayout
             return hasNamedBindings_;
         }
 
+        // Returns true if the sampled textures of the heap bindings are bound with bindless texture handles. See PipelineLayoutFlags::BindlessHeap.
+        inline bool IsBindlessHeap() const
+        {
+            return isBindlessHeap_;
+        }
+
+        // Returns the sampler that is combined with the bindless texture handles, i.e. the first static sampler or null.
+        GLSamplerSPtr GetBindlessSampler() const;
+
     private:
 
         void BuildHeapResourceBindings(const PipelineLayoutDescriptor& pipelineLayoutDesc);
@@ -166,6 +176,7 @@ class GLPipelineLayout final : public PipelineLayout
         std::vector<GLuint>                     combinedSamplerSlots_;
         const GLbitfield                        barriers_               = 0;
         const bool                              hasNamedBindings_       = false;
+        const bool                              isBindlessHeap_         = false;
 
 };
 
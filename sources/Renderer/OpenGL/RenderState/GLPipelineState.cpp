@@ -11,10 +11,14 @@
 #include "GLPipelineCache.h"
 #include "../GLTypes.h"
 #include "../Shader/GLShaderProgram.h"
+#include "../Shader/GLShaderUniform.h"
 #include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <string.h>
 
 
 namespace LLGL
@@ -25,13 +29,20 @@ GLPipelineState::GLPipelineState(
     bool                        isGraphicsPSO,
     const PipelineLayout*       pipelineLayout,
     PipelineCache*              pipelineCache,
-    const ArrayView<Shader*>&   shaders)
+    const ArrayView<Shader*>&   shaders,
+    bool                        isAsync)
 :
     isGraphicsPSO_ { isGraphicsPSO }
 {
     /* Get GL pipeline cache if specified */
     GLPipelineCache* pipelineCacheGL = (pipelineCache != nullptr ? LLGL_CAST(GLPipelineCache*, pipelineCache) : nullptr);
 
+    /*
+    Defer all program queries if the driver can link asynchronously.
+    This is not possible with a PSO cache, because retrieving the program binary blocks until linking has completed.
+    */
+    isLinkPending_ = (isAsync && pipelineCacheGL == nullptr && HasExtension(GLExt::KHR_parallel_shader_compile));
+
     for_range(permutationIndex, GLShader::PermutationCount)
     {
         const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
@@ -41,7 +52,7 @@ GLPipelineState::GLPipelineState(
             shaderPipelines_[permutation] = GLStatePool::Get().CreateShaderPipeline(shaders.size(), shaders.data(), permutation, pipelineCacheGL);
 
             /* Query information log and stop linking shader pipelines if the default permutation has errors */
-            if (permutation == GLShader::PermutationDefault)
+            if (permutation == GLShader::PermutationDefault && !isLinkPending_)
             {
                 shaderPipelines_[GLShader::PermutationDefault]->QueryInfoLogs(report_);
                 if (report_.HasErrors())
@@ -58,31 +69,19 @@ GLPipelineState::GLPipelineState(
         if (pipelineLayout_->HasNamedBindings())
         {
             shaderBindingLayout_ = GLStatePool::Get().CreateShaderBindingLayout(*pipelineLayout_);
-            if (shaderBindingLayout_->HasBindings())
-            {
-                if (shaderBindingLayout_->HasShaderStorageBindings())
-                {
-                    /* Build map to distinguish resources between SSBOs, sampler buffers, and image buffers */
-                    bufferInterfaceMap_.BuildMap(*pipelineLayout_, *GetShaderPipeline());
-                }
-            }
-            else
+            if (!shaderBindingLayout_->HasBindings())
             {
                 /* If no bindings were created after all, release the binding layout immediately */
                 GLStatePool::Get().ReleaseShaderBindingLayout(std::move(shaderBindingLayout_));
             }
         }
 
-        /* Build uniform table */
-        for_range(permutationIndex, GLShader::PermutationCount)
-        {
-            const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
-            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
-        }
-
         /* Cache barriers bitfield */
         barriers_ = pipelineLayout_->GetBarriersBitfield();
     }
+
+    if (!isLinkPending_)
+        QueryLinkedProgramInfo();
 }
 
 GLPipelineState::~GLPipelineState()
@@ -94,11 +93,28 @@ GLPipelineState::~GLPipelineState()
 
 const Report* GLPipelineState::GetReport() const
 {
+    const_cast<GLPipelineState*>(this)->FinishPendingLink();
     return (report_ ? &report_ : nullptr);
 }
 
+bool GLPipelineState::IsReady() const
+{
+    if (isLinkPending_)
+    {
+        for (const GLShaderPipelineSPtr& shaderPipeline : shaderPipelines_)
+        {
+            if (shaderPipeline && !shaderPipeline->QueryCompletionStatus())
+                return false;
+        }
+    }
+    return true;
+}
+
 void GLPipelineState::Bind(GLStateManager& stateMngr)
 {
+    /* Finish asynchronous linking before the shader program is used */
+    FinishPendingLink();
+
     /* Select shader pipeline permutation depending on what is needed for the current framebuffer */
     const GLShader::Permutation shaderPipelinePermutation =
     (
@@ -121,11 +137,91 @@ void GLPipelineState::Bind(GLStateManager& stateMngr)
         pipelineLayout_->BindStaticSamplers(stateMngr);
 }
 
+void GLPipelineState::FinishPendingLink()
+{
+    if (isLinkPending_.load(std::memory_order_acquire))
+    {
+        /* Publish program information to command buffers that are recorded on other threads */
+        QueryLinkedProgramInfo();
+        isLinkPending_.store(false, std::memory_order_release);
+    }
+}
+
+void GLPipelineState::SetUniforms(std::uint32_t first, const void* data, std::uint32_t dataSize) const
+{
+    const std::uint32_t dataSizeInWords = dataSize / 4;
+
+    for (auto words = static_cast<const std::uint32_t*>(data), wordsEnd = words + dataSizeInWords; words < wordsEnd; ++first)
+    {
+        if (first >= uniformMap_.size())
+            return /*GL_INVALID_INDEX*/;
+
+        const GLUniformLocation& uniform = uniformMap_[first];
+        GLSetUniform(uniform.type, uniform.location, uniform.count, words);
+
+        words += uniform.wordSize;
+    }
+}
+
+void GLPipelineState::WriteUniformBlock(std::uint32_t first, const void* data, std::uint32_t dataSize) const
+{
+    const std::uint32_t dataSizeInWords = dataSize / 4;
+
+    for (auto words = static_cast<const std::uint32_t*>(data), wordsEnd = words + dataSizeInWords; words < wordsEnd; ++first)
+    {
+        if (first >= uniformBlockMap_.size())
+            return /*GL_INVALID_INDEX*/;
+
+        const GLUniformLocation& uniform = uniformMap_[first];
+        const GLBlockUniform& blockUniform = uniformBlockMap_[first];
+
+        /* Input data is tightly packed, so scatter each array element and matrix column into the block layout */
+        const std::size_t columnSize = uniform.wordSize * 4 / blockUniform.columns;
+        for (GLsizei element = 0; element < uniform.count && words < wordsEnd; ++element)
+        {
+            char* dst = &uniformBlockData_[blockUniform.offset + element * blockUniform.arrayStride];
+            for_range(column, blockUniform.columns)
+            {
+                const std::size_t remainingSize = static_cast<std::size_t>(wordsEnd - words) * 4;
+                ::memcpy(dst + column * blockUniform.matrixStride, words, std::min(columnSize, remainingSize));
+                words += columnSize / 4;
+                if (words >= wordsEnd)
+                    break;
+            }
+        }
+    }
+}
+
 
 /*
  * ======= Private: =======
  */
 
+void GLPipelineState::QueryLinkedProgramInfo()
+{
+    /* Query information log of default permutation */
+    if (isLinkPending_)
+    {
+        if (GLShaderPipeline* shaderPipeline = shaderPipelines_[GLShader::PermutationDefault].get())
+            shaderPipeline->QueryInfoLogs(report_);
+    }
+
+    if (pipelineLayout_ != nullptr)
+    {
+        /* Build map to distinguish resources between SSBOs, sampler buffers, and image buffers */
+        if (shaderBindingLayout_ && shaderBindingLayout_->HasShaderStorageBindings())
+            bufferInterfaceMap_.BuildMap(*pipelineLayout_, *GetShaderPipeline());
+
+        /* Build uniform table */
+        for_range(permutationIndex, GLShader::PermutationCount)
+        {
+            const GLShader::Permutation permutation = static_cast<GLShader::Permutation>(permutationIndex);
+            BuildUniformMap(permutation, pipelineLayout_->GetUniforms());
+        }
+    }
+}
+
+
 //TODO: support separate shaders; each separable shader needs its own set of uniform locations
 void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms)
 {
@@ -141,6 +237,12 @@ void GLPipelineState::BuildUniformMap(GLShader::Permutation permutation, const s
         uniformMap_.resize(uniforms.size());
         for_range(i, uniforms.size())
             BuildUniformLocation(program, uniformMap_[i], uniforms[i], nameToUniformMap);
+
+        /* Uniforms that are declared inside a uniform block have no location and are batched into a uniform buffer instead */
+        #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+        if (HasExtension(GLExt::ARB_uniform_buffer_object))
+            BuildUniformBlockMap(program, uniforms);
+        #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
     }
 }
 
@@ -275,6 +377,131 @@ void GLPipelineState::BuildUniformLocation(
     outUniform.wordSize = GetUniformWordSize(it->second.type);
 }
 
+// Returns the number of columns for the specified GL matrix uniform type or 1 for all other types.
+static GLuint GetUniformMatrixColumns(GLenum type)
+{
+    switch (type)
+    {
+        case GL_FLOAT_MAT2:
+        case GL_FLOAT_MAT2x3:
+        case GL_FLOAT_MAT2x4:
+            return 2;
+        case GL_FLOAT_MAT3x2:
+        case GL_FLOAT_MAT3:
+        case GL_FLOAT_MAT3x4:
+            return 3;
+        case GL_FLOAT_MAT4x2:
+        case GL_FLOAT_MAT4x3:
+        case GL_FLOAT_MAT4:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+void GLPipelineState::BuildUniformBlockMap(GLuint program, const std::vector<UniformDescriptor>& uniforms)
+{
+    #if LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+
+    uniformBlockMap_.clear();
+    uniformBlockData_.clear();
+
+    /* Uniforms in the default block are set with glUniform*, so bail out if any uniform has a location */
+    for (const GLUniformLocation& uniform : uniformMap_)
+    {
+        if (uniform.location != -1)
+            return;
+    }
+
+    /* Query active uniform indices by name */
+    const GLsizei numUniforms = static_cast<GLsizei>(uniforms.size());
+
+    std::vector<const GLchar*> uniformNames;
+    uniformNames.reserve(uniforms.size());
+    for (const UniformDescriptor& uniform : uniforms)
+        uniformNames.push_back(uniform.name.c_str());
+
+    std::vector<GLuint> uniformIndices(uniforms.size(), GL_INVALID_INDEX);
+    glGetUniformIndices(program, numUniforms, uniformNames.data(), uniformIndices.data());
+
+    for (GLuint index : uniformIndices)
+    {
+        if (index == GL_INVALID_INDEX)
+            return;
+    }
+
+    /* Query block layout of all uniforms */
+    std::vector<GLint> blockIndices(uniforms.size()), offsets(uniforms.size()), arrayStrides(uniforms.size()), matrixStrides(uniforms.size());
+    std::vector<GLint> types(uniforms.size()), sizes(uniforms.size());
+    glGetActiveUniformsiv(program, numUniforms, uniformIndices.data(), GL_UNIFORM_BLOCK_INDEX,   blockIndices.data());
+    glGetActiveUniformsiv(program, numUniforms, uniformIndices.data(), GL_UNIFORM_OFFSET,        offsets.data());
+    glGetActiveUniformsiv(program, numUniforms, uniformIndices.data(), GL_UNIFORM_ARRAY_STRIDE,  arrayStrides.data());
+    glGetActiveUniformsiv(program, numUniforms, uniformIndices.data(), GL_UNIFORM_MATRIX_STRIDE, matrixStrides.data());
+    glGetActiveUniformsiv(program, numUniforms, uniformIndices.data(), GL_UNIFORM_TYPE,          types.data());
+    glGetActiveUniformsiv(program, numUniforms, uniformIndices.data(), GL_UNIFORM_SIZE,          sizes.data());
+
+    /* All uniforms must be members of the same uniform block */
+    const GLint blockIndex = blockIndices[0];
+    if (blockIndex < 0)
+        return;
+
+    for (GLint otherBlockIndex : blockIndices)
+    {
+        if (otherBlockIndex != blockIndex)
+            return;
+    }
+
+    /* Don't take over uniform blocks that are bound as regular constant buffers by the pipeline layout */
+    GLint blockNameLength = 0;
+    glGetActiveUniformBlockiv(program, static_cast<GLuint>(blockIndex), GL_UNIFORM_BLOCK_NAME_LENGTH, &blockNameLength);
+    if (pipelineLayout_ != nullptr && blockNameLength > 0)
+    {
+        std::vector<GLchar> blockName(static_cast<std::size_t>(blockNameLength), '\0');
+        glGetActiveUniformBlockName(program, static_cast<GLuint>(blockIndex), blockNameLength, nullptr, blockName.data());
+        for (const std::string& bindingName : pipelineLayout_->GetBindingNames())
+        {
+            if (bindingName == blockName.data())
+                return;
+        }
+    }
+
+    GLint blockSize = 0;
+    glGetActiveUniformBlockiv(program, static_cast<GLuint>(blockIndex), GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize);
+    if (blockSize <= 0)
+        return;
+
+    /* Write uniform types and block layout */
+    uniformBlockMap_.resize(uniforms.size());
+    for_range(i, uniforms.size())
+    {
+        const GLenum type = static_cast<GLenum>(types[i]);
+
+        GLUniformLocation& uniform = uniformMap_[i];
+        {
+            uniform.type        = GLTypes::UnmapUniformType(type);
+            uniform.count       = sizes[i];
+            uniform.wordSize    = GetUniformWordSize(type);
+        }
+        GLBlockUniform& blockUniform = uniformBlockMap_[i];
+        {
+            blockUniform.offset         = offsets[i];
+            blockUniform.arrayStride    = arrayStrides[i];
+            blockUniform.matrixStride   = matrixStrides[i];
+            blockUniform.columns        = GetUniformMatrixColumns(type);
+        }
+    }
+
+    /* Reserve the last binding point for batched uniforms, since pipeline layouts typically start at binding point zero */
+    GLint maxUniformBufferBindings = 0;
+    glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxUniformBufferBindings);
+    uniformBlockBinding_ = static_cast<GLuint>(std::max(1, maxUniformBufferBindings) - 1);
+    glUniformBlockBinding(program, static_cast<GLuint>(blockIndex), uniformBlockBinding_);
+
+    uniformBlockData_.resize(static_cast<std::size_t>(blockSize), 0);
+
+    #endif // /LLGL_GLEXT_UNIFORM_BUFFER_OBJECT
+}
+
 
 } // /namespace LLGL
 
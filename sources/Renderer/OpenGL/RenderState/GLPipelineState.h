@@ -19,6 +19,7 @@
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/Container/ArrayView.h>
 #include <memory>
+#include <atomic>
 #include <unordered_map>
 
 
@@ -40,6 +41,15 @@ struct GLUniformLocation
     GLuint      wordSize; // Size in words (32-bit values)
 };
 
+// Layout of a uniform that is a member of a uniform block instead of the default uniform block.
+struct GLBlockUniform
+{
+    GLint       offset;         // Byte offset within the uniform block.
+    GLint       arrayStride;    // Byte stride between array elements.
+    GLint       matrixStride;   // Byte stride between matrix columns, or 0 if this is not a matrix.
+    GLuint      columns;        // Number of matrix columns, or 1 if this is not a matrix.
+};
+
 // Base class for OpenGL PSOs.
 class GLPipelineState : public PipelineState
 {
@@ -50,15 +60,50 @@ class GLPipelineState : public PipelineState
             bool                        isGraphicsPSO,
             const PipelineLayout*       pipelineLayout,
             PipelineCache*              pipelineCache,
-            const ArrayView<Shader*>&   shaders
+            const ArrayView<Shader*>&   shaders,
+            bool                        isAsync         = false
         );
         ~GLPipelineState();
 
         const Report* GetReport() const override;
+        bool IsReady() const override;
 
         // Binds this pipeline state with the specified GL state manager.
         virtual void Bind(GLStateManager& stateMngr);
 
+        // Finishes the deferred program queries of an asynchronously linked PSO. Blocks until linking has completed. Does nothing if the PSO was linked synchronously.
+        void FinishPendingLink();
+
+        // Sets the specified uniforms via this PSO's uniform map in the currently bound shader program. 'dataSize' must be a multiple of 4.
+        void SetUniforms(std::uint32_t first, const void* data, std::uint32_t dataSize) const;
+
+        // Writes the specified uniforms into the CPU copy of this PSO's uniform block. Only used if HasUniformBlock() returns true. 'dataSize' must be a multiple of 4.
+        void WriteUniformBlock(std::uint32_t first, const void* data, std::uint32_t dataSize) const;
+
+        // Returns true if all uniforms of the pipeline layout are members of a single uniform block, in which case they are uploaded via GLUniformBatch.
+        inline bool HasUniformBlock() const
+        {
+            return !uniformBlockData_.empty();
+        }
+
+        // Returns the CPU copy of the uniform block with the values of the last call to WriteUniformBlock().
+        inline const std::vector<char>& GetUniformBlockData() const
+        {
+            return uniformBlockData_;
+        }
+
+        // Returns the uniform block binding point that is reserved for batched uniforms.
+        inline GLuint GetUniformBlockBinding() const
+        {
+            return uniformBlockBinding_;
+        }
+
+        // Returns true if the program queries of this PSO are still pending. Link state and program information are undefined until this returns false.
+        inline bool IsLinkPending() const
+        {
+            return isLinkPending_.load(std::memory_order_acquire);
+        }
+
         // Returns true if this is a graphics PSO.
         inline bool IsGraphicsPSO() const
         {
@@ -116,9 +161,15 @@ class GLPipelineState : public PipelineState
 
     private:
 
+        // Queries all information from the linked shader programs, i.e. info logs, buffer interface, and uniform locations. Blocks until linking has completed.
+        void QueryLinkedProgramInfo();
+
         // Builds the index-to-uniform map.
         void BuildUniformMap(GLShader::Permutation permutation, const std::vector<UniformDescriptor>& uniforms);
 
+        // Builds the uniform block layout if all uniforms are members of the same uniform block that is not bound by the pipeline layout.
+        void BuildUniformBlockMap(GLuint program, const std::vector<UniformDescriptor>& uniforms);
+
         // Builds the container that maps a name to the index of its active GL uniform.
         void BuildNameToActiveUniformMap(GLuint program, GLNameToUniformMap& outNameToUniformMap);
 
@@ -139,7 +190,11 @@ class GLPipelineState : public PipelineState
         GLShaderBindingLayoutSPtr       shaderBindingLayout_;
         GLShaderBufferInterfaceMap      bufferInterfaceMap_;
         std::vector<GLUniformLocation>  uniformMap_;
+        std::vector<GLBlockUniform>     uniformBlockMap_;
+        mutable std::vector<char>       uniformBlockData_;                              // CPU copy of the uniform block; written at command execution and uploaded via GLUniformBatch.
+        GLuint                          uniformBlockBinding_                            = 0;
         Report                          report_;
+        std::atomic<bool>               isLinkPending_                                  { false }; // Program queries are deferred until linking has completed (GL_KHR_parallel_shader_compile).
 
 };
 
@@ -117,13 +117,43 @@ void GLQueryHeap::Begin(std::uint32_t query)
         glBeginQuery(MapQueryType(GetType(), i), ids_[i + groupSize_ * query]);
 }
 
-void GLQueryHeap::End()
+void GLQueryHeap::End(std::uint32_t query)
 {
+    #if LLGL_OPENGL && GL_ARB_timer_query
+    if (GetType() == QueryType::Timestamp)
+    {
+        /* Record single timestamp once all previous commands have completed */
+        LLGL_ASSERT_GL_EXT(ARB_timer_query);
+        glQueryCounter(ids_[query], GL_TIMESTAMP);
+        return;
+    }
+    #endif
+
     /* End all queries in reverse order: (n, 0] */
     for_range_reverse(i, groupSize_)
         glEndQuery(MapQueryType(GetType(), i));
 }
 
+void GLQueryHeap::WriteResultsToBuffer(std::uint32_t firstQuery, std::uint32_t numQueries, GLintptr offset)
+{
+    #if LLGL_GLEXT_QUERY_BUFFER_OBJECT
+    LLGL_ASSERT_GL_EXT(ARB_query_buffer_object);
+
+    /*
+    With a buffer bound to GL_QUERY_BUFFER, the pointer argument is interpreted as byte offset into that buffer,
+    so the results are written by the GL server without a CPU roundtrip. Each group of queries is tightly packed,
+    i.e. pipeline statistics match the layout of QueryPipelineStatistics.
+    */
+    const std::uint32_t firstID = firstQuery * groupSize_;
+    const std::uint32_t numIDs  = numQueries * groupSize_;
+    for_range(i, numIDs)
+    {
+        const GLintptr dstOffset = offset + static_cast<GLintptr>(i * sizeof(GLuint64));
+        glGetQueryObjectui64v(ids_[firstID + i], GL_QUERY_RESULT, reinterpret_cast<GLuint64*>(dstOffset));
+    }
+    #endif // /LLGL_GLEXT_QUERY_BUFFER_OBJECT
+}
+
 
 } // /namespace LLGL
 
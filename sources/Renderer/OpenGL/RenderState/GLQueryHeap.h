@@ -31,7 +31,10 @@ class GLQueryHeap final : public QueryHeap
         ~GLQueryHeap();
 
         void Begin(std::uint32_t query);
-        void End();
+        void End(std::uint32_t query);
+
+        // Writes the 64-bit results of the specified queries into the buffer that is currently bound to GL_QUERY_BUFFER.
+        void WriteResultsToBuffer(std::uint32_t firstQuery, std::uint32_t numQueries, GLintptr offset);
 
         // Returns the the specified query ID.
         inline GLuint GetID(std::uint32_t query) const
@@ -8,6 +8,7 @@
 #include "GLRenderPass.h"
 #include "../../RenderPassUtils.h"
 #include <LLGL/CommandBufferFlags.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
@@ -28,6 +29,24 @@ GLRenderPass::GLRenderPass(const RenderPassDescriptor& desc)
     /* Check if stencil attachment must be cleared */
     if (desc.stencilAttachment.loadOp == AttachmentLoadOp::Clear)
         clearMask_ |= GL_STENCIL_BUFFER_BIT;
+
+    /* Check which color attachments can be discarded at the end of the render pass */
+    for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+    {
+        const AttachmentFormatDescriptor& colorAttachment = desc.colorAttachments[i];
+        if (colorAttachment.format == Format::Undefined)
+            break;
+        if (colorAttachment.storeOp == AttachmentStoreOp::Undefined)
+            discardColorAttachments_ |= (1u << i);
+    }
+    if (discardColorAttachments_ != 0)
+        discardMask_ |= GL_COLOR_BUFFER_BIT;
+
+    /* Check if depth and stencil attachments can be discarded at the end of the render pass */
+    if (desc.depthAttachment.format != Format::Undefined && desc.depthAttachment.storeOp == AttachmentStoreOp::Undefined)
+        discardMask_ |= GL_DEPTH_BUFFER_BIT;
+    if (desc.stencilAttachment.format != Format::Undefined && desc.stencilAttachment.storeOp == AttachmentStoreOp::Undefined)
+        discardMask_ |= GL_STENCIL_BUFFER_BIT;
 }
 
 
@@ -44,11 +44,25 @@ class GLRenderPass final : public RenderPass
             return clearColorAttachments_;
         }
 
+        // Specifies which buffer groups are meant to be discarded when a render pass ends, i.e. their store operation is AttachmentStoreOp::Undefined.
+        inline GLbitfield GetDiscardMask() const
+        {
+            return discardMask_;
+        }
+
+        // Returns the bitmask of color attachments that are meant to be discarded when a render pass ends (bit 0 for the first color attachment).
+        inline std::uint32_t GetDiscardColorAttachments() const
+        {
+            return discardColorAttachments_;
+        }
+
     private:
 
         GLbitfield      clearMask_                                              = 0;
         std::uint8_t    clearColorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
         std::uint8_t    numColorAttachments_                                    = 0;
+        GLbitfield      discardMask_                                            = 0;
+        std::uint32_t   discardColorAttachments_                                = 0;
 
 };
 
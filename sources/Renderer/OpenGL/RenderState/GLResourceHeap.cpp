@@ -15,6 +15,7 @@
 #include "../Texture/GLEmulatedSampler.h"
 #include "../Texture/GLTexture.h"
 #include "../Texture/GLTextureViewPool.h"
+#include "../Texture/GLBindlessTexturePool.h"
 #include "../Shader/GLShaderBufferInterfaceMap.h"
 #include "../../CheckedCast.h"
 #include "../GLTypes.h"
@@ -27,6 +28,8 @@
 #include <LLGL/ResourceHeapFlags.h>
 #include <LLGL/Container/ArrayView.h>
 #include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <utility>
 #include <string.h>
 #include <limits.h>
 
@@ -89,6 +92,7 @@ struct alignas(sizeof(std::uintptr_t)) GLResourceHeapSegment
     std::uint32_t   data1Offset : 16; // Byte offset after the first sub-buffer, following the second sub-buffer
     std::uint32_t   data2Offset : 16; // Byte offset after the second sub-buffer, following the third sub-buffer
     std::uint32_t   data3Offset : 16; // Byte offset after the third sub-buffer, following the forth sub-buffer
+    std::uint32_t   numTexViews : 16; // Number of texture views in this segment; Only used for texture and image segments
 };
 
 // Sub buffer entries for storage buffers.
@@ -158,7 +162,14 @@ GLResourceHeap::GLResourceHeap(
 
     AllocSegmentsUBO(bindingIter);
     AllocSegmentsBuffer(bindingIter);
-    AllocSegmentsTexture(bindingIter, pipelineLayoutGL->GetCombinedSamplerSlots());
+    if (pipelineLayoutGL->IsBindlessHeap())
+    {
+        /* Sampled textures of bindless heaps are not bound to texture units but passed as handles in shader storage blocks */
+        bindlessSampler_ = pipelineLayoutGL->GetBindlessSampler();
+        AllocBindlessTables(bindingIter, pipelineLayoutGL->GetCombinedSamplerSlots());
+    }
+    else
+        AllocSegmentsTexture(bindingIter, pipelineLayoutGL->GetCombinedSamplerSlots());
     AllocSegmentsImage(bindingIter);
     AllocSegmentsSampler(bindingIter, pipelineLayoutGL->GetCombinedSamplerSlots());
 
@@ -166,6 +177,9 @@ GLResourceHeap::GLResourceHeap(
     const std::size_t numSegmentSets = (static_cast<std::size_t>(numResourceViews) / numInputBindings_);
     heap_.FinalizeSegments(numSegmentSets);
 
+    if (!bindlessTables_.empty())
+        CreateBindlessBuffer(numSegmentSets, desc.debugName, ((desc.flags & ResourceHeapFlags::Dynamic) != 0));
+
     if (heap_.Stride() > (1u << k_heapSegmentSizeBits))
     {
         /* Error: Segment size is encoded in under 32 bits, so report if we exceeded the limit */
@@ -183,8 +197,9 @@ GLResourceHeap::GLResourceHeap(
 
 GLResourceHeap::~GLResourceHeap()
 {
-    /* Release all texture views for this resource heap */
+    /* Release all texture views and bindless handles for this resource heap */
     FreeAllSegmentsTextureViews();
+    FreeAllBindlessHandles();
 }
 
 std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
@@ -214,7 +229,12 @@ std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
         const BindingSegmentLocation& binding = bindingMap_[firstDescriptor % numInputBindings_];
         const std::uint32_t descriptorSet = firstDescriptor / numInputBindings_;
 
-        if (binding.isCombinedSampler)
+        if (binding.isBindless)
+        {
+            /* Write bindless handle into CPU copy; it is uploaded to the GPU once all views have been written */
+            WriteResourceViewBindless(desc, static_cast<std::size_t>(descriptorSet) * bindlessStride_ + binding.segmentOrBindingOffset);
+        }
+        else if (binding.isCombinedSampler)
         {
             /* Interpret 'indexOrCount' as number of combiend texture-sampler descriptors */
             for_range(i, binding.indexOrCount)
@@ -233,6 +253,9 @@ std::uint32_t GLResourceHeap::WriteResourceViews(std::uint32_t firstDescriptor,
         ++firstDescriptor;
     }
 
+    /* Upload modified range of bindless handles at once */
+    FlushBindlessHandles();
+
     return numWritten;
 }
 
@@ -278,21 +301,27 @@ static std::size_t BindStorageBuffersSegment(
 
         auto* buffers = reinterpret_cast<const GLuint*>(heapPtr + sizeof(GLResourceHeapSegment));
         const bool hasBufferRangeData = ((segment->flags & GLResourceFlags_HasBufferRange) != 0);
+        const GLuint numBuffers = static_cast<GLuint>(segment->count);
 
-        for_range(i, segment->count)
+        for (GLuint i = 0, count = 1; i < numBuffers; i += count, descriptor += count)
         {
+            count = 1;
             switch (bufferInterfaces[descriptor])
             {
                 case GLBufferInterface_SSBO:
                 {
+                    /* Bind consecutive SSBOs within this segment at once */
+                    while (i + count < numBuffers && bufferInterfaces[descriptor + count] == GLBufferInterface_SSBO)
+                        ++count;
+
                     if (hasBufferRangeData)
                     {
                         auto* offsets   = reinterpret_cast<const GLintptr*>  (heapPtr + segment->data1Offset);
                         auto* sizes     = reinterpret_cast<const GLsizeiptr*>(heapPtr + segment->data2Offset);
-                        stateMngr.BindBufferRange(GLBufferTarget::ShaderStorageBuffer, segment->first + i, buffers[i], offsets[i], sizes[i]);
+                        stateMngr.BindBuffersRange(GLBufferTarget::ShaderStorageBuffer, segment->first + i, static_cast<GLsizei>(count), buffers + i, offsets + i, sizes + i);
                     }
                     else
-                        stateMngr.BindBufferBase(GLBufferTarget::ShaderStorageBuffer, segment->first + i, buffers[i]);
+                        stateMngr.BindBuffersBase(GLBufferTarget::ShaderStorageBuffer, segment->first + i, static_cast<GLsizei>(count), buffers + i);
                 }
                 break;
 
@@ -310,7 +339,6 @@ static std::size_t BindStorageBuffersSegment(
                 }
                 break;
             }
-            ++descriptor;
         }
     }
     return segment->size;
@@ -391,7 +419,7 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet
     /* Bind all shader storage buffers */
     if (bufferInterfaceMap != nullptr && !bufferInterfaceMap->HasHeapSSBOEntriesOnly())
     {
-        /* Bind each SSBO, sampler buffer, and image buffer individually since this is depending on currently bound shader interface */
+        /* Bind SSBOs, sampler buffers, and image buffers depending on currently bound shader interface, but consecutive SSBOs at once */
         std::uint32_t descriptor = 0;
         for_range(i, segmentation_.numStorageBufferSegments)
             heapPtr += BindStorageBuffersSegment(stateMngr, heapPtr, *bufferInterfaceMap, descriptor);
@@ -423,6 +451,22 @@ void GLResourceHeap::Bind(GLStateManager& stateMngr, std::uint32_t descriptorSet
         for_range(i, segmentation_.numSamplerSegments)
             heapPtr += BindSamplersSegment(stateMngr, heapPtr);
     }
+
+    /* Bind all shader storage blocks of bindless texture handles */
+    if (!bindlessTables_.empty())
+    {
+        const GLintptr setOffset = static_cast<GLintptr>(descriptorSet) * bindlessStride_;
+        for (const GLBindlessTable& table : bindlessTables_)
+        {
+            stateMngr.BindBufferRange(
+                GLBufferTarget::ShaderStorageBuffer,
+                table.slot,
+                bindlessBuffer_->GetID(),
+                static_cast<GLintptr>(sizeof(GLuint64)) * (setOffset + table.offset),
+                static_cast<GLsizeiptr>(sizeof(GLuint64) * table.count)
+            );
+        }
+    }
 }
 
 
@@ -631,6 +675,71 @@ void GLResourceHeap::AllocSegmentsEmulatedSampler(GLHeapBindingIterator& binding
     }
 }
 
+void GLResourceHeap::AllocBindlessTables(GLHeapBindingIterator& bindingIter, const ArrayView<GLuint>& combinedSamplerSlots)
+{
+    /* Collect all textures with sampled binding */
+    auto bindingSlots = FilterAndSortGLBindingSlots(bindingIter, ResourceType::Texture, BindFlags::Sampled, combinedSamplerSlots);
+    if (bindingSlots.empty())
+        return;
+
+    /* Each table is bound with its own buffer range, so the first handle of each table must satisfy the SSBO offset alignment */
+    GLint offsetAlignment = 0;
+    #ifdef GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT
+    glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+    #endif
+    const std::uint32_t handleAlignment = std::max<std::uint32_t>(1u, static_cast<std::uint32_t>(offsetAlignment) / sizeof(GLuint64));
+
+    /* Group consecutive binding slots into tables */
+    for (const GLResourceBinding& binding : bindingSlots)
+    {
+        if (bindlessTables_.empty() || bindlessTables_.back().slot + bindlessTables_.back().count != binding.slot)
+        {
+            bindlessStride_ = GetAlignedSize(bindlessStride_, handleAlignment);
+            bindlessTables_.push_back(GLBindlessTable{ binding.slot, 0u, bindlessStride_ });
+        }
+
+        /* Map binding to handle index within a descriptor set */
+        LLGL_ASSERT(binding.mapIndex < bindingMap_.size());
+        BindingSegmentLocation& mapping = bindingMap_[binding.mapIndex];
+        {
+            mapping.isCombinedSampler       = 0;
+            mapping.isBindless              = 1;
+            mapping.segmentOrBindingOffset  = bindlessStride_;
+            mapping.indexOrCount            = 0;
+        }
+        ++bindlessTables_.back().count;
+        ++bindlessStride_;
+    }
+
+    bindlessStride_ = GetAlignedSize(bindlessStride_, handleAlignment);
+
+    if (bindlessStride_ > (1u << 22))
+        LLGL_TRAP("GLResourceHeap exceeded limit of bindless texture handles: allocated %u, but limit is %u", bindlessStride_, (1u << 22));
+}
+
+void GLResourceHeap::CreateBindlessBuffer(std::size_t numSegmentSets, const char* debugName, bool isDynamic)
+{
+    /* Allocate CPU copy of all handles and initialize GPU buffer with null handles */
+    const std::size_t numHandles = numSegmentSets * bindlessStride_;
+    bindlessHandles_.resize(numHandles, 0);
+    bindlessTexViews_.resize(numHandles, 0);
+
+    bindlessBuffer_ = MakeUnique<GLBuffer>(BindFlags::Storage, debugName);
+    #ifdef GL_DYNAMIC_STORAGE_BIT
+    constexpr GLbitfield storageFlags = GL_DYNAMIC_STORAGE_BIT;
+    #else
+    constexpr GLbitfield storageFlags = 0;
+    #endif
+    bindlessBuffer_->BufferStorage(static_cast<GLsizeiptr>(sizeof(GLuint64) * numHandles), bindlessHandles_.data(), storageFlags, GL_DYNAMIC_DRAW);
+
+    if (isDynamic)
+    {
+        /* Dynamic heaps write into a second buffer while the GPU may still read the handles of the previous write from the first one */
+        bindlessBackBuffer_ = MakeUnique<GLBuffer>(BindFlags::Storage, debugName);
+        bindlessBackBuffer_->BufferStorage(static_cast<GLsizeiptr>(sizeof(GLuint64) * numHandles), bindlessHandles_.data(), storageFlags, GL_DYNAMIC_DRAW);
+    }
+}
+
 void GLResourceHeap::Alloc1PartSegment(
     GLResourceType              type,
     const GLResourceBinding*    first,
@@ -754,6 +863,7 @@ void GLResourceHeap::WriteBindingMappings(const GLResourceBinding* bindings, Seg
         LLGL_ASSERT(bindings[i].mapIndex < bindingMap_.size());
         BindingSegmentLocation& mapping = bindingMap_[bindings[i].mapIndex];
         mapping.isCombinedSampler       = 0;
+        mapping.isBindless              = 0;
         mapping.segmentOrBindingOffset  = static_cast<std::uint32_t>(heap_.Size());
         mapping.indexOrCount            = i;
     }
@@ -895,39 +1005,28 @@ void GLResourceHeap::WriteResourceViewBuffer(const ResourceViewDescriptor& desc,
     }
 }
 
-// Returns true if the segment at the specified heap position contains any texture views.
-static bool HasTextureSegmentAnyTextureViews(const char* heapPtr)
-{
-    const GLResourceHeapSegment* segment = GLRESOURCEHEAP_CONST_SEGMENT(heapPtr);
-    for_range(i, segment->count)
-    {
-        if (GLRESOURCEHEAP_DATA2(heapPtr, const GLuint)[i] != 0)
-            return true;
-    }
-    return false;
-}
-
-// Updates the segment flags for the specified heap position if any texture views have been added or removed from the segment.
-static void UpdateTextureSegmentFlags(char* heapPtr, bool isAnyTextureViewAdded, bool isAnyTextureViewRemoved)
+// Updates the number of texture views and the segment flags for the specified heap position if a texture view has been added or removed from the segment.
+static void UpdateTextureSegmentFlags(char* heapPtr, bool hadTextureView, bool hasTextureView)
 {
     GLResourceHeapSegment* segment = GLRESOURCEHEAP_SEGMENT(heapPtr);
-    if (isAnyTextureViewAdded)
+    if (hasTextureView && !hadTextureView)
     {
         /* Mark segment to have texture views */
+        ++segment->numTexViews;
         segment->flags |= GLResourceFlags_HasTextureViews;
     }
-    else if (isAnyTextureViewRemoved)
+    else if (hadTextureView && !hasTextureView)
     {
-        /* Count texture views in segment and remove marker if there are no one left */
-        if ((segment->flags & GLResourceFlags_HasTextureViews) != 0 && !HasTextureSegmentAnyTextureViews(heapPtr))
+        /* Remove marker if there are no texture views left; This avoids re-scanning the entire segment on each write */
+        LLGL_ASSERT(segment->numTexViews > 0);
+        if (--segment->numTexViews == 0)
             segment->flags &= (~GLResourceFlags_HasTextureViews);
     }
 }
 
 void GLResourceHeap::WriteResourceViewTexture(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index)
 {
-    bool isAnyTextureViewAdded = false;
-    bool isAnyTextureViewRemoved = false;
+    const bool hadTextureView = (GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index] != 0);
 
     /* Get texture resource and its size parameter */
     auto* textureGL = LLGL_CAST(GLTexture*, GetAsExpectedTexture(desc.resource, BindFlags::Sampled));
@@ -936,7 +1035,6 @@ void GLResourceHeap::WriteResourceViewTexture(const ResourceViewDescriptor& desc
     {
         /* Allocate new texture view */
         AllocTextureView(GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index], textureGL->GetID(), desc.textureView);
-        isAnyTextureViewAdded = true;
 
         /* Write texture ID to segment (GLuint, GLTextureTarget) */
         GLRESOURCEHEAP_DATA0(heapPtr, GLuint         )[index] = GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index];
@@ -945,8 +1043,7 @@ void GLResourceHeap::WriteResourceViewTexture(const ResourceViewDescriptor& desc
     else
     {
         /* Release old texture if it was a texture view */
-        if (FreeTextureView(GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index]))
-            isAnyTextureViewRemoved = true;
+        FreeTextureView(GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index]);
 
         /* Write texture ID to segment (GLuint, GLTextureTarget) */
         GLRESOURCEHEAP_DATA0(heapPtr, GLuint         )[index] = textureGL->GetID();
@@ -954,13 +1051,12 @@ void GLResourceHeap::WriteResourceViewTexture(const ResourceViewDescriptor& desc
     }
 
     /* Update flags for segment if texture views have been added or removed */
-    UpdateTextureSegmentFlags(heapPtr, isAnyTextureViewAdded, isAnyTextureViewRemoved);
+    UpdateTextureSegmentFlags(heapPtr, hadTextureView, (GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index] != 0));
 }
 
 void GLResourceHeap::WriteResourceViewImage(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index)
 {
-    bool isAnyTextureViewAdded = false;
-    bool isAnyTextureViewRemoved = false;
+    const bool hadTextureView = (GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index] != 0);
 
     /* Get texture resource and its size parameter */
     auto* textureGL = LLGL_CAST(GLTexture*, GetAsExpectedTexture(desc.resource, (BindFlags::Sampled | BindFlags::Storage)));
@@ -969,7 +1065,6 @@ void GLResourceHeap::WriteResourceViewImage(const ResourceViewDescriptor& desc,
     {
         /* Allocate new texture view */
         AllocTextureView(GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index], textureGL->GetID(), desc.textureView);
-        isAnyTextureViewAdded = true;
 
         /* Write texture ID to segment (GLuint, GLenum) */
         GLRESOURCEHEAP_DATA0(heapPtr, GLuint)[index] = GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index];
@@ -978,8 +1073,7 @@ void GLResourceHeap::WriteResourceViewImage(const ResourceViewDescriptor& desc,
     else
     {
         /* Release old texture if it was a texture view */
-        if (FreeTextureView(GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index]))
-            isAnyTextureViewRemoved = true;
+        FreeTextureView(GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index]);
 
         /* Write texture ID to segment (GLuint, GLenum) */
         GLRESOURCEHEAP_DATA0(heapPtr, GLuint)[index] = textureGL->GetID();
@@ -987,7 +1081,7 @@ void GLResourceHeap::WriteResourceViewImage(const ResourceViewDescriptor& desc,
     }
 
     /* Update flags for segment if texture views have been added or removed */
-    UpdateTextureSegmentFlags(heapPtr, isAnyTextureViewAdded, isAnyTextureViewRemoved);
+    UpdateTextureSegmentFlags(heapPtr, hadTextureView, (GLRESOURCEHEAP_DATA2(heapPtr, GLuint)[index] != 0));
 }
 
 void GLResourceHeap::WriteResourceViewSampler(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index)
@@ -1014,6 +1108,119 @@ void GLResourceHeap::WriteResourceViewEmulatedSampler(const ResourceViewDescript
     }
 }
 
+void GLResourceHeap::WriteResourceViewBindless(const ResourceViewDescriptor& desc, std::size_t handleIndex)
+{
+    LLGL_ASSERT(handleIndex < bindlessHandles_.size());
+
+    /* Get texture resource and allocate texture view if required */
+    auto* textureGL = LLGL_CAST(GLTexture*, GetAsExpectedTexture(desc.resource, BindFlags::Sampled));
+
+    GLuint texViewID = 0;
+    if (IsTextureViewEnabled(desc.textureView))
+        texViewID = GLTextureViewPool::Get().CreateTextureView(textureGL->GetID(), desc.textureView);
+
+    /* Acquire new handle before releasing the old one in case they refer to the same texture-sampler pair */
+    const GLuint    samplerID   = (bindlessSampler_ ? bindlessSampler_->GetID() : 0);
+    const GLuint64  newHandle   = GLBindlessTexturePool::Get().AcquireHandle((texViewID != 0 ? texViewID : textureGL->GetID()), samplerID);
+    ReleaseBindlessHandle(bindlessHandles_[handleIndex], bindlessTexViews_[handleIndex]);
+
+    bindlessHandles_[handleIndex]   = newHandle;
+    bindlessTexViews_[handleIndex]  = texViewID;
+
+    /* Extend range of handles that must be uploaded */
+    if (bindlessDirtyBegin_ < bindlessDirtyEnd_)
+    {
+        bindlessDirtyBegin_ = std::min(bindlessDirtyBegin_, handleIndex);
+        bindlessDirtyEnd_   = std::max(bindlessDirtyEnd_, handleIndex + 1);
+    }
+    else
+    {
+        bindlessDirtyBegin_ = handleIndex;
+        bindlessDirtyEnd_   = handleIndex + 1;
+    }
+}
+
+void GLResourceHeap::UploadBindlessHandles(GLBuffer& buffer, std::size_t begin, std::size_t end)
+{
+    buffer.BufferSubData(
+        static_cast<GLintptr>(sizeof(GLuint64) * begin),
+        static_cast<GLsizeiptr>(sizeof(GLuint64) * (end - begin)),
+        &(bindlessHandles_[begin])
+    );
+}
+
+void GLResourceHeap::FlushBindlessHandles()
+{
+    if (bindlessDirtyBegin_ < bindlessDirtyEnd_)
+    {
+        if (bindlessBackBuffer_)
+        {
+            /* Upload modified handles into the back buffer, including those of the previous write that only went into the front buffer */
+            std::size_t begin   = bindlessDirtyBegin_;
+            std::size_t end     = bindlessDirtyEnd_;
+            if (bindlessStaleBegin_ < bindlessStaleEnd_)
+            {
+                begin   = std::min(begin, bindlessStaleBegin_);
+                end     = std::max(end, bindlessStaleEnd_);
+            }
+            UploadBindlessHandles(*bindlessBackBuffer_, begin, end);
+
+            /* Swap buffers, so the next bind call uses the new handles and the next write goes into the buffer with the previous handles */
+            std::swap(bindlessBuffer_, bindlessBackBuffer_);
+            bindlessStaleBegin_ = bindlessDirtyBegin_;
+            bindlessStaleEnd_   = bindlessDirtyEnd_;
+
+            /* Handles of the previous write are no longer referenced by either buffer */
+            ReleaseRetiredBindlessHandles();
+        }
+        else
+            UploadBindlessHandles(*bindlessBuffer_, bindlessDirtyBegin_, bindlessDirtyEnd_);
+
+        bindlessDirtyBegin_ = 0;
+        bindlessDirtyEnd_   = 0;
+    }
+}
+
+void GLResourceHeap::ReleaseBindlessHandle(GLuint64 handle, GLuint& texViewID)
+{
+    if (bindlessBackBuffer_)
+    {
+        /* Keep handle resident until the back buffer, which still refers to it, has been overwritten by the next write */
+        if (handle != 0 || texViewID != 0)
+            bindlessRetired_.push_back(GLRetiredHandle{ handle, texViewID });
+        texViewID = 0;
+    }
+    else
+    {
+        /* Release old texture view only after its handle has been released */
+        GLBindlessTexturePool::Get().ReleaseHandle(handle);
+        FreeTextureView(texViewID);
+    }
+}
+
+void GLResourceHeap::ReleaseRetiredBindlessHandles()
+{
+    for (GLRetiredHandle& retired : bindlessPendingRelease_)
+    {
+        GLBindlessTexturePool::Get().ReleaseHandle(retired.handle);
+        FreeTextureView(retired.texViewID);
+    }
+    bindlessPendingRelease_.swap(bindlessRetired_);
+    bindlessRetired_.clear();
+}
+
+void GLResourceHeap::FreeAllBindlessHandles()
+{
+    for (GLuint64 handle : bindlessHandles_)
+        GLBindlessTexturePool::Get().ReleaseHandle(handle);
+    for (GLuint& texViewID : bindlessTexViews_)
+        FreeTextureView(texViewID);
+
+    /* Release handles of dynamic heaps that are still retained for the back buffer */
+    ReleaseRetiredBindlessHandles();
+    ReleaseRetiredBindlessHandles();
+}
+
 std::vector<GLResourceHeap::GLResourceBinding> GLResourceHeap::FilterAndSortGLBindingSlots(
     GLHeapBindingIterator&      bindingIter,
     ResourceType                resourceType,
@@ -1042,6 +1249,7 @@ std::vector<GLResourceHeap::GLResourceBinding> GLResourceHeap::FilterAndSortGLBi
             BindingSegmentLocation& combinerMapping = bindingMap_[index];
             {
                 combinerMapping.isCombinedSampler       = 1;
+                combinerMapping.isBindless              = 0;
                 combinerMapping.segmentOrBindingOffset  = static_cast<std::uint32_t>(bindingMap_.size());
                 combinerMapping.indexOrCount            = bindingDesc->combiners;
             }
@@ -17,7 +17,9 @@
 #include "../../BindingIterator.h"
 #include "../../SegmentedBuffer.h"
 #include "../OpenGL.h"
+#include "../Texture/GLSampler.h"
 #include <functional>
+#include <memory>
 
 
 namespace LLGL
@@ -25,6 +27,7 @@ namespace LLGL
 
 
 enum GLResourceType : std::uint32_t;
+class GLBuffer;
 class GLStateManager;
 class GLShaderBufferInterfaceMap;
 struct ResourceHeapDescriptor;
@@ -77,10 +80,26 @@ class GLResourceHeap final : public ResourceHeap
         struct BindingSegmentLocation
         {
             std::uint32_t isCombinedSampler      :  1;
-            std::uint32_t segmentOrBindingOffset : 23; // Byte offset to the first segment within a segment set.
+            std::uint32_t isBindless             :  1; // If set, 'segmentOrBindingOffset' is the index into the bindless handles of a descriptor set.
+            std::uint32_t segmentOrBindingOffset : 22; // Byte offset to the first segment within a segment set.
             std::uint32_t indexOrCount           :  8; // Index of the descriptor the binding maps to.
         };
 
+        // Consecutive binding slots of bindless texture handles that are bound as a single shader storage block.
+        struct GLBindlessTable
+        {
+            GLuint          slot;   // GL shader storage block binding slot, i.e. the first binding slot of the table
+            std::uint32_t   count;  // Number of handles in this table
+            std::uint32_t   offset; // Index of the first handle within a descriptor set
+        };
+
+        // Bindless handle and its texture view that have been replaced in a dynamic resource heap.
+        struct GLRetiredHandle
+        {
+            GLuint64    handle;
+            GLuint      texViewID;
+        };
+
         // GL resource binding slot with index to the input binding list.
         struct GLResourceBinding
         {
@@ -102,6 +121,8 @@ class GLResourceHeap final : public ResourceHeap
         void AllocSegmentsSampler(GLHeapBindingIterator& bindingIter, const ArrayView<GLuint>& combinedSamplerSlots);
         void AllocSegmentsNativeSampler(GLHeapBindingIterator& bindingIter, const ArrayView<GLuint>& combinedSamplerSlots);
         void AllocSegmentsEmulatedSampler(GLHeapBindingIterator& bindingIter, const ArrayView<GLuint>& combinedSamplerSlots);
+        void AllocBindlessTables(GLHeapBindingIterator& bindingIter, const ArrayView<GLuint>& combinedSamplerSlots);
+        void CreateBindlessBuffer(std::size_t numSegmentSets, const char* debugName, bool isDynamic);
 
         void Alloc1PartSegment(
             GLResourceType              type,
@@ -148,6 +169,13 @@ class GLResourceHeap final : public ResourceHeap
         void WriteResourceViewImage(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index);
         void WriteResourceViewSampler(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index);
         void WriteResourceViewEmulatedSampler(const ResourceViewDescriptor& desc, char* heapPtr, std::uint32_t index);
+        void WriteResourceViewBindless(const ResourceViewDescriptor& desc, std::size_t handleIndex);
+
+        void UploadBindlessHandles(GLBuffer& buffer, std::size_t begin, std::size_t end);
+        void FlushBindlessHandles();
+        void ReleaseBindlessHandle(GLuint64 handle, GLuint& texViewID);
+        void ReleaseRetiredBindlessHandles();
+        void FreeAllBindlessHandles();
 
         std::vector<GLResourceBinding> FilterAndSortGLBindingSlots(
             GLHeapBindingIterator&      bindingIter,
@@ -170,6 +198,21 @@ class GLResourceHeap final : public ResourceHeap
         BufferSegmentation                  segmentation_;
         SegmentedBuffer                     heap_;                  // Buffer with resource binding information and stride (in bytes) per descriptor set
 
+        std::vector<GLBindlessTable>        bindlessTables_;
+        std::uint32_t                       bindlessStride_ = 0;    // Number of bindless handles per descriptor set, including padding for the SSBO offset alignment.
+        std::vector<GLuint64>               bindlessHandles_;       // CPU copy of the bindless handles for all descriptor sets.
+        std::vector<GLuint>                 bindlessTexViews_;      // Texture views the bindless handles refer to; 0 if the handle refers to the texture itself.
+        std::unique_ptr<GLBuffer>           bindlessBuffer_;        // Shader storage buffer with the bindless handles for all descriptor sets.
+        GLSamplerSPtr                       bindlessSampler_;       // Sampler combined with all bindless handles; Keeps it alive for as long as the handles are resident.
+        std::size_t                         bindlessDirtyBegin_ = 0;
+        std::size_t                         bindlessDirtyEnd_   = 0;
+
+        std::unique_ptr<GLBuffer>           bindlessBackBuffer_;    // Second buffer of handles for dynamic heaps (see ResourceHeapFlags::Dynamic); The next write goes into this buffer.
+        std::size_t                         bindlessStaleBegin_ = 0; // Range of handles the back buffer lacks from the previous write.
+        std::size_t                         bindlessStaleEnd_   = 0;
+        std::vector<GLRetiredHandle>        bindlessRetired_;       // Handles replaced by the current write of a dynamic heap; They are still referenced by the back buffer.
+        std::vector<GLRetiredHandle>        bindlessPendingRelease_; // Handles replaced by the previous write of a dynamic heap; They are released by the next write.
+
 };
 
 
@@ -19,6 +19,7 @@ namespace LLGL
 class GLPipelineLayout;
 class GLPipelineState;
 class GLBufferWithXFB;
+class GLBuffer;
 
 /* ----- Enumerations ----- */
 
@@ -81,9 +82,10 @@ enum class GLBufferTarget
     DispatchIndirectBuffer,     // GL_DISPATCH_INDIRECT_BUFFER
     DrawIndirectBuffer,         // GL_DRAW_INDIRECT_BUFFER
     ElementArrayBuffer,         // GL_ELEMENT_ARRAY_BUFFER
+    ParameterBuffer,            // GL_PARAMETER_BUFFER
     PixelPackBuffer,            // GL_PIXEL_PACK_BUFFER
     PixelUnpackBuffer,          // GL_PIXEL_UNPACK_BUFFER
-    QueryBuffer,                // GL_QUERY_BUFFER (unused)
+    QueryBuffer,                // GL_QUERY_BUFFER
     ShaderStorageBuffer,        // GL_SHADER_STORAGE_BUFFER
     TextureBuffer,              // GL_TEXTURE_BUFFER
     TransformFeedbackBuffer,    // GL_TRANSFORM_FEEDBACK_BUFFER
@@ -156,6 +158,7 @@ struct GLRenderState
     const GLPipelineLayout* boundPipelineLayout     = nullptr;
     const GLPipelineState*  boundPipelineState      = nullptr;
     GLBufferWithXFB*        boundBufferWithFxb      = nullptr;
+    GLBuffer*               boundComputeSOBuffer    = nullptr; // Vertex buffer with BindFlags::ComputeStreamOutput
     GLbitfield              implicitBarriers        = 0;
     GLbitfield              dirtyBarriers           = 0;
 };
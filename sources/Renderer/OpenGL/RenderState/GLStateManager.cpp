@@ -22,6 +22,7 @@
 #include "../GLTypes.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../ProfileCounters.h"
 #include <LLGL/TypeInfo.h>
 #include <LLGL/Utils/ForRange.h>
 #include <functional>
@@ -153,6 +154,11 @@ static const GLenum g_bufferTargetsEnum[] =
     0, // GL_DRAW_INDIRECT_BUFFER
     #endif
     GL_ELEMENT_ARRAY_BUFFER,
+    #if LLGL_GLEXT_INDIRECT_PARAMETERS
+    GL_PARAMETER_BUFFER,
+    #else
+    0, // GL_PARAMETER_BUFFER
+    #endif
     GL_PIXEL_PACK_BUFFER,
     GL_PIXEL_UNPACK_BUFFER,
     #if !LLGL_GL_ENABLE_OPENGL2X
@@ -243,8 +249,8 @@ static void InvalidateBoundGLObject(GLuint& boundId, const GLuint releasedObject
  * GLStateManager static members
  */
 
-GLStateManager*             GLStateManager::current_;
-GLStateManager::GLLimits    GLStateManager::commonLimits_;
+thread_local GLStateManager*    GLStateManager::current_;
+GLStateManager::GLLimits        GLStateManager::commonLimits_;
 
 struct GLStateManager::GLFramebufferClearState
 {
@@ -339,6 +345,8 @@ void GLStateManager::Set(GLState state, bool value)
         else
             glDisable(g_stateCapsEnum[idx]);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::Enable(GLState state)
@@ -776,6 +784,8 @@ void GLStateManager::BindDepthStencilState(GLDepthStencilState* depthStencilStat
         depthStencilState->Bind(*this);
         boundDepthStencilState_ = depthStencilState;
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::SetDepthFunc(GLenum func)
@@ -828,6 +838,8 @@ void GLStateManager::BindRasterizerState(GLRasterizerState* rasterizerState)
             rasterizerState->BindFrontFaceOnly(*this);
             frontFacingDirtyBit_ = false;
         }
+        else
+            LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
     }
 }
 
@@ -846,6 +858,8 @@ void GLStateManager::BindBlendState(GLBlendState* blendState)
         blendState->Bind(*this);
         boundBlendState_ = blendState;
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::SetBlendColor(const GLfloat color[4])
@@ -891,6 +905,8 @@ void GLStateManager::BindBuffer(GLBufferTarget target, GLuint buffer)
         glBindBuffer(g_bufferTargetsEnum[targetIdx], buffer);
         contextState_.boundBuffers[targetIdx] = buffer;
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::BindBufferBase(GLBufferTarget target, GLuint index, GLuint buffer)
@@ -1040,6 +1056,8 @@ void GLStateManager::BindVertexArray(GLuint vertexArray)
             #endif // /LLGL_PRIMITIVE_RESTART
         }
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 
     #else // LLGL_GLEXT_VERTEX_ARRAY_OBJECT
 
@@ -1146,6 +1164,7 @@ void GLStateManager::NotifyBufferRelease(const GLBuffer& buffer)
     {
         NotifyBufferRelease(id, GLBufferTarget::DrawIndirectBuffer);
         NotifyBufferRelease(id, GLBufferTarget::DispatchIndirectBuffer);
+        NotifyBufferRelease(id, GLBufferTarget::ParameterBuffer);
     }
 
     NotifyBufferRelease(id, GLBufferTarget::CopyReadBuffer);
@@ -1190,6 +1209,8 @@ void GLStateManager::BindFramebuffer(GLFramebufferTarget target, GLuint framebuf
         contextState_.boundFramebuffers[targetIdx] = framebuffer;
         glBindFramebuffer(g_framebufferTargetsEnum[targetIdx], framebuffer);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
     #endif
 }
 
@@ -1331,6 +1352,8 @@ void GLStateManager::BindTexture(GLTextureTarget target, GLuint texture)
         textureLayer->boundTextures[targetIdx] = texture;
         glBindTexture(g_textureTargetsEnum[targetIdx], texture);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::BindTexture(GLuint layer, GLTextureTarget target, GLuint texture)
@@ -1356,6 +1379,8 @@ void GLStateManager::BindTexture(GLuint layer, GLTextureTarget target, GLuint te
         /* Bind native GL texture to active layer */
         glBindTexture(g_textureTargetsEnum[targetIdx], texture);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::BindTextures(GLuint first, GLsizei count, const GLTextureTarget* targets, const GLuint* textures)
@@ -1561,6 +1586,8 @@ void GLStateManager::BindSampler(GLuint layer, GLuint sampler)
         contextState_.boundSamplers[layer] = sampler;
         glBindSampler(layer, sampler);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::BindSamplers(GLuint first, GLsizei count, const GLuint* samplers)
@@ -1653,6 +1680,8 @@ void GLStateManager::BindShaderProgram(GLuint program)
         contextState_.boundProgram = program;
         glUseProgram(program);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
 }
 
 void GLStateManager::PushBoundShaderProgram()
@@ -1693,6 +1722,8 @@ void GLStateManager::BindProgramPipeline(GLuint pipeline)
         contextState_.boundProgramPipeline = pipeline;
         glBindProgramPipeline(pipeline);
     }
+    else
+        LLGL_PROFILE_COUNTER_ADD(redundantStateChanges, 1);
     #endif
 }
 
@@ -2215,6 +2246,79 @@ std::uint32_t GLStateManager::ClearColorBuffers(
 
 #endif // /!LLGL_GL_ENABLE_OPENGL2X
 
+void GLStateManager::InvalidateAttachmentsWithRenderPass(const GLRenderPass& renderPassGL, GLRenderTarget* renderTargetGL)
+{
+    #if LLGL_GLEXT_INVALIDATE_SUBDATA
+
+    const GLbitfield mask = renderPassGL.GetDiscardMask();
+    if (mask == 0 || !HasExtension(GLExt::ARB_invalidate_subdata))
+        return;
+
+    if (renderTargetGL == nullptr)
+    {
+        InvalidateDefaultFramebuffer(mask);
+        return;
+    }
+
+    GLenum attachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS + 1];
+    GLsizei numAttachments = 0;
+
+    /* Collect color attachments; render targets always bind their color attachments in consecutive order */
+    if ((mask & GL_COLOR_BUFFER_BIT) != 0)
+    {
+        const std::uint32_t colorAttachments = renderPassGL.GetDiscardColorAttachments();
+        for_range(i, LLGL_MAX_NUM_COLOR_ATTACHMENTS)
+        {
+            if ((colorAttachments & (1u << i)) != 0)
+                attachments[numAttachments++] = GL_COLOR_ATTACHMENT0 + i;
+        }
+    }
+
+    /* Collect depth-stencil attachment */
+    switch (mask & (GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT))
+    {
+        case (GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT):
+            attachments[numAttachments++] = GL_DEPTH_STENCIL_ATTACHMENT;
+            break;
+        case GL_DEPTH_BUFFER_BIT:
+            attachments[numAttachments++] = GL_DEPTH_ATTACHMENT;
+            break;
+        case GL_STENCIL_BUFFER_BIT:
+            attachments[numAttachments++] = GL_STENCIL_ATTACHMENT;
+            break;
+    }
+
+    /* Re-bind primary FBO, since it might have been unbound by a multi-sampled resolve, and invalidate attachments */
+    BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, renderTargetGL->GetFramebuffer().GetID());
+    glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numAttachments, attachments);
+
+    #endif // /LLGL_GLEXT_INVALIDATE_SUBDATA
+}
+
+void GLStateManager::InvalidateDefaultFramebuffer(GLbitfield mask)
+{
+    #if LLGL_GLEXT_INVALIDATE_SUBDATA
+
+    if (mask == 0 || !HasExtension(GLExt::ARB_invalidate_subdata))
+        return;
+
+    /* Default framebuffer uses generic attachment names */
+    GLenum attachments[3];
+    GLsizei numAttachments = 0;
+
+    if ((mask & GL_COLOR_BUFFER_BIT) != 0)
+        attachments[numAttachments++] = GL_COLOR;
+    if ((mask & GL_DEPTH_BUFFER_BIT) != 0)
+        attachments[numAttachments++] = GL_DEPTH;
+    if ((mask & GL_STENCIL_BUFFER_BIT) != 0)
+        attachments[numAttachments++] = GL_STENCIL;
+
+    BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, 0);
+    glInvalidateFramebuffer(GL_DRAW_FRAMEBUFFER, numAttachments, attachments);
+
+    #endif // /LLGL_GLEXT_INVALIDATE_SUBDATA
+}
+
 
 } // /namespace LLGL
 
@@ -11,6 +11,7 @@
 
 #include "GLState.h"
 #include "GLContextState.h"
+#include "../Buffer/GLVertexArrayCache.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/CommandBufferFlags.h>
 #include "../OpenGL.h"
@@ -284,6 +285,12 @@ class GLStateManager
             const ClearValue*   clearValues
         );
 
+        // Invalidates all attachments of the specified render target (or the default framebuffer if null) whose store operation is undefined in the render pass.
+        void InvalidateAttachmentsWithRenderPass(const GLRenderPass& renderPassGL, GLRenderTarget* renderTargetGL);
+
+        // Invalidates the specified buffer groups of the default framebuffer, e.g. GL_DEPTH_BUFFER_BIT before a swap-chain is presented.
+        void InvalidateDefaultFramebuffer(GLbitfield mask);
+
         void Clear(long flags);
         void ClearBuffers(std::uint32_t numAttachments, const AttachmentClear* attachments);
 
@@ -307,6 +314,12 @@ class GLStateManager
             return framebufferHeight_;
         }
 
+        // Returns the cache of format-only VAOs for this GL context.
+        inline GLVertexArrayCache& GetVertexArrayCache()
+        {
+            return vertexArrayCache_;
+        }
+
     public:
 
         // Returns the common denominator of limitations for all GL contexts.
@@ -397,8 +410,8 @@ class GLStateManager
 
     private:
 
-        static GLStateManager*  current_;
-        static GLLimits         commonLimits_;          // Common denominator of limitations for all GL contexts
+        static thread_local GLStateManager* current_;               // Current state manager per thread
+        static GLLimits                     commonLimits_;          // Common denominator of limitations for all GL contexts
 
     private:
 
@@ -413,6 +426,7 @@ class GLStateManager
 
         bool                                indexType16Bits_            = false;
         GLuint                              lastVertexAttribArray_      = 0;
+        GLVertexArrayCache                  vertexArrayCache_;
 
         GLenum                              frontFaceInternal_          = GL_CCW; // actual front face input (without possible inversion)
 
@@ -10,6 +10,7 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
 #include <functional>
 
 #include "../Shader/GLLegacyShader.h"
@@ -124,6 +125,7 @@ void GLStatePool::Clear()
     blendStates_.clear();
     shaderBindingLayouts_.clear();
     shaderPipelines_.clear();
+    staticSamplers_.clear();
 }
 
 /* ----- Depth-stencil states ----- */
@@ -240,6 +242,80 @@ void GLStatePool::ReleaseShaderPipeline(GLShaderPipelineSPtr&& shaderPipeline)
     );
 }
 
+/* ----- Static samplers ----- */
+
+// Compares the sampler descriptors in a strict-weak-order (SWO). The debug name is ignored, since static samplers don't have one.
+static int CompareSamplerDescSWO(const SamplerDescriptor& lhs, const SamplerDescriptor& rhs)
+{
+    LLGL_COMPARE_MEMBER_SWO     ( addressModeU   );
+    LLGL_COMPARE_MEMBER_SWO     ( addressModeV   );
+    LLGL_COMPARE_MEMBER_SWO     ( addressModeW   );
+    LLGL_COMPARE_MEMBER_SWO     ( minFilter      );
+    LLGL_COMPARE_MEMBER_SWO     ( magFilter      );
+    LLGL_COMPARE_MEMBER_SWO     ( mipMapFilter   );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( mipMapEnabled  );
+    LLGL_COMPARE_MEMBER_SWO     ( mipMapLODBias  );
+    LLGL_COMPARE_MEMBER_SWO     ( minLOD         );
+    LLGL_COMPARE_MEMBER_SWO     ( maxLOD         );
+    LLGL_COMPARE_MEMBER_SWO     ( maxAnisotropy  );
+    LLGL_COMPARE_BOOL_MEMBER_SWO( compareEnabled );
+    LLGL_COMPARE_MEMBER_SWO     ( compareOp      );
+    LLGL_COMPARE_MEMBER_SWO     ( borderColor[0] );
+    LLGL_COMPARE_MEMBER_SWO     ( borderColor[1] );
+    LLGL_COMPARE_MEMBER_SWO     ( borderColor[2] );
+    LLGL_COMPARE_MEMBER_SWO     ( borderColor[3] );
+    return 0;
+}
+
+GLSamplerSPtr GLStatePool::CreateStaticSampler(const SamplerDescriptor& samplerDesc)
+{
+    /* Try to find static sampler with same parameters */
+    std::size_t insertionIndex = 0;
+    GLStaticSamplerEntry* entry = FindInSortedArray<GLStaticSamplerEntry>(
+        staticSamplers_.data(),
+        staticSamplers_.size(),
+        [&samplerDesc](const GLStaticSamplerEntry& entry) -> int
+        {
+            return CompareSamplerDescSWO(entry.desc, samplerDesc);
+        },
+        &insertionIndex
+    );
+
+    if (entry != nullptr)
+        return entry->sampler;
+
+    /* Allocate new sampler with insertion sort */
+    GLSamplerSPtr newSampler = std::make_shared<GLSampler>();
+    newSampler->SamplerParameters(samplerDesc);
+
+    GLStaticSamplerEntry newEntry{ samplerDesc, newSampler };
+    newEntry.desc.debugName = nullptr;
+    staticSamplers_.insert(staticSamplers_.begin() + insertionIndex, std::move(newEntry));
+
+    return newSampler;
+}
+
+void GLStatePool::ReleaseStaticSampler(GLSamplerSPtr&& sampler)
+{
+    if (!sampler)
+        return;
+
+    /* Find entry by its sampler, since releasing static samplers is not a hot path */
+    const GLSampler* samplerRef = sampler.get();
+    sampler.reset();
+
+    for (auto it = staticSamplers_.begin(); it != staticSamplers_.end(); ++it)
+    {
+        if (it->sampler.get() == samplerRef)
+        {
+            /* Only delete sampler if this pool holds the last reference */
+            if (it->sampler.use_count() == 1)
+                staticSamplers_.erase(it);
+            break;
+        }
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -17,6 +17,7 @@
 #include "../Shader/GLShaderBindingLayout.h"
 #include "../Shader/GLShaderPipeline.h"
 #include "../Shader/GLShader.h"
+#include "../Texture/GLSampler.h"
 #include <vector>
 
 
@@ -28,8 +29,15 @@ class GLLegacyShader;
 class GLSeparableShader;
 class GLPipelineCache;
 
+// Entry of a shared static sampler. The sampler descriptor is the key to find identical samplers.
+struct GLStaticSamplerEntry
+{
+    SamplerDescriptor   desc;
+    GLSamplerSPtr       sampler;
+};
+
 /*
-Singleton pool for OpenGL depth-stencil-, rasterizer-, and blend states.
+Singleton pool for OpenGL depth-stencil-, rasterizer-, blend states, and static samplers.
 These states are separated from the GLStateManager, because they don't need to exist for every GL context.
 */
 class GLStatePool
@@ -76,6 +84,12 @@ class GLStatePool
         );
         void ReleaseShaderPipeline(GLShaderPipelineSPtr&& shaderPipeline);
 
+        /* ----- Static samplers ----- */
+
+        // Returns a sampler that is shared across all pipeline layouts. Samplers created by the client are not shared, since each of them has its own debug name.
+        GLSamplerSPtr CreateStaticSampler(const SamplerDescriptor& samplerDesc);
+        void ReleaseStaticSampler(GLSamplerSPtr&& sampler);
+
     private:
 
         GLStatePool() = default;
@@ -87,6 +101,7 @@ class GLStatePool
         std::vector<GLBlendStateSPtr>           blendStates_;
         std::vector<GLShaderBindingLayoutSPtr>  shaderBindingLayouts_;
         std::vector<GLShaderPipelineSPtr>       shaderPipelines_;
+        std::vector<GLStaticSamplerEntry>       staticSamplers_;
 
 };
 
@@ -0,0 +1,71 @@
+/*
+ * GLWorkerFenceQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLWorkerFenceQueue.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+
+
+namespace LLGL
+{
+
+
+GLWorkerFenceQueue& GLWorkerFenceQueue::Get()
+{
+    static GLWorkerFenceQueue instance;
+    return instance;
+}
+
+void GLWorkerFenceQueue::Clear()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    pendingFences_.clear();
+    hasPendingFences_ = false;
+}
+
+void GLWorkerFenceQueue::Submit()
+{
+    #if GL_ARB_sync
+    if (HasExtension(GLExt::ARB_sync))
+    {
+        /* Fence all commands of the worker context and flush them, so the fence will eventually be signaled */
+        auto fence = MakeUnique<GLFence>();
+        fence->Submit();
+        glFlush();
+
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        pendingFences_.push_back(std::move(fence));
+        hasPendingFences_ = true;
+    }
+    else
+    #endif // /GL_ARB_sync
+    {
+        /* Without sync objects, the worker context must complete all commands before the resource is handed over */
+        glFinish();
+    }
+}
+
+void GLWorkerFenceQueue::WaitOnServer()
+{
+    /* Avoid locking the mutex for every command submission when there are no worker threads */
+    if (!hasPendingFences_)
+        return;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    for (const std::unique_ptr<GLFence>& fence : pendingFences_)
+        fence->WaitOnServer();
+    pendingFences_.clear();
+    hasPendingFences_ = false;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
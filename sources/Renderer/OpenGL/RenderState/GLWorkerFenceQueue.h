@@ -0,0 +1,73 @@
+/*
+ * GLWorkerFenceQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_WORKER_FENCE_QUEUE_H
+#define LLGL_GL_WORKER_FENCE_QUEUE_H
+
+
+#include "GLFence.h"
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+
+
+namespace LLGL
+{
+
+
+/*
+Queue of fences that are submitted by worker threads after they created resources with a shared background GL context.
+The primary GL context waits on these fences before it executes any commands,
+so that resources from worker threads are complete before their first use. See GLContextManager::MakeWorkerContextCurrent().
+*/
+class GLWorkerFenceQueue
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLWorkerFenceQueue& Get();
+
+    public:
+
+        GLWorkerFenceQueue(const GLWorkerFenceQueue&) = delete;
+        GLWorkerFenceQueue& operator = (const GLWorkerFenceQueue&) = delete;
+
+        GLWorkerFenceQueue(GLWorkerFenceQueue&&) = delete;
+        GLWorkerFenceQueue& operator = (GLWorkerFenceQueue&&) = delete;
+
+        // Releases all resources for this singleton class.
+        void Clear();
+
+        // Submits a new fence into the command stream of the current worker context and flushes it. Thread-safe.
+        void Submit();
+
+        // Makes the current GL context wait on the server side for all pending fences. Thread-safe.
+        void WaitOnServer();
+
+    private:
+
+        GLWorkerFenceQueue() = default;
+
+    private:
+
+        std::mutex                              mutex_;
+        std::vector<std::unique_ptr<GLFence>>   pendingFences_;
+        std::atomic<bool>                       hasPendingFences_   { false };
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
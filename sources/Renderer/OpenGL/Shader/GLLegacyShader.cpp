@@ -12,6 +12,7 @@
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../../../Core/Exception.h"
+#include "../../../Platform/MappedFile.h"
 
 
 namespace LLGL
@@ -38,12 +39,21 @@ void GLLegacyShader::SetDebugName(const char* name)
 
 bool GLLegacyShader::Reflect(ShaderReflection& reflection) const
 {
+    if (GetSerializedReflection(reflection))
+        return true;
+
     const Shader* shaders[] = { this };
     GLShaderProgram intermediateProgram{ 1, shaders };
     GLShaderProgram::QueryReflection(intermediateProgram.GetID(), GetGLType(), reflection);
     return true;
 }
 
+const Report* GLLegacyShader::GetReport() const
+{
+    const_cast<GLLegacyShader*>(this)->FinishPendingCompile();
+    return GLShader::GetReport();
+}
+
 void GLLegacyShader::CompileShaderSource(GLuint shader, const char* source)
 {
     const GLchar* strings[1] = { source };
@@ -95,12 +105,33 @@ GLuint GLLegacyShader::CreateShaderPermutation(Permutation permutation)
 
 bool GLLegacyShader::FinalizeShaderPermutation(Permutation permutation)
 {
+    /*
+    Defer compile status query if the driver can compile asynchronously.
+    Querying the status would otherwise block until the driver has finished compiling.
+    Errors will be reported once the shader or its pipeline state is queried.
+    */
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+    {
+        isCompilePending_ = true;
+        return true;
+    }
+
     /* Query compile status and log */
     const bool status = GLLegacyShader::GetCompileStatus(GetID());
     ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
     return status;
 }
 
+void GLLegacyShader::FinishPendingCompile()
+{
+    if (isCompilePending_)
+    {
+        const bool status = GLLegacyShader::GetCompileStatus(GetID());
+        ReportStatusAndLog(status, GLLegacyShader::GetGLShaderLog(GetID()));
+        isCompilePending_ = false;
+    }
+}
+
 void GLLegacyShader::BuildShader(const ShaderDescriptor& shaderDesc)
 {
     if (IsShaderSourceCode(shaderDesc.sourceType))
@@ -144,16 +175,19 @@ void GLLegacyShader::LoadBinary(const ShaderDescriptor& shaderDesc)
     if (HasExtension(GLExt::ARB_gl_spirv) && HasExtension(GLExt::ARB_ES2_compatibility))
     {
         /* Get shader binary */
-        std::vector<char>   fileContent;
-        const void*         binaryBuffer    = nullptr;
-        GLsizei             binaryLength    = 0;
+        std::unique_ptr<MappedFile> mappedFile;
+        const void*                 binaryBuffer    = nullptr;
+        GLsizei                     binaryLength    = 0;
 
         if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
         {
-            /* Load binary from file */
-            fileContent = ReadFileBuffer(shaderDesc.source);
-            binaryBuffer = fileContent.data();
-            binaryLength = static_cast<GLsizei>(fileContent.size());
+            /* Map binary file into memory and pass it directly to the driver */
+            mappedFile = MappedFile::Open(shaderDesc.source);
+            if (mappedFile)
+            {
+                binaryBuffer = mappedFile->GetData();
+                binaryLength = static_cast<GLsizei>(mappedFile->GetSize());
+            }
         }
         else
         {
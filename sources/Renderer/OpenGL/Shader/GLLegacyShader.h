@@ -24,6 +24,7 @@ class GLLegacyShader final : public GLShader
 
         void SetDebugName(const char* name) override;
         bool Reflect(ShaderReflection& reflection) const override;
+        const Report* GetReport() const override;
 
     public:
 
@@ -46,10 +47,17 @@ class GLLegacyShader final : public GLShader
         GLuint CreateShaderPermutation(Permutation permutation);
         bool FinalizeShaderPermutation(Permutation permutation);
 
+        // Queries the deferred compile status and log once the driver has finished compiling (GL_KHR_parallel_shader_compile).
+        void FinishPendingCompile();
+
         void BuildShader(const ShaderDescriptor& shaderDesc);
         void CompileSource(const ShaderDescriptor& shaderDesc);
         void LoadBinary(const ShaderDescriptor& shaderDesc);
 
+    private:
+
+        bool isCompilePending_ = false; // Compile status is deferred until the report is queried.
+
 };
 
 
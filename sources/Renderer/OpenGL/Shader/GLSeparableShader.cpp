@@ -9,10 +9,13 @@
 #include "GLLegacyShader.h"
 #include "GLShaderProgram.h"
 #include "GLShaderBindingLayout.h"
+#include "../RenderState/GLPipelineCache.h"
 #include "../Ext/GLExtensions.h"
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
+#include "../../PipelineCacheStore.h"
 #include "../../../Core/Exception.h"
+#include "../../../Core/HashUtils.h"
 #include <LLGL/Utils/ForRange.h>
 
 
@@ -22,15 +25,32 @@ namespace LLGL
 
 #if LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
 
-GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
+// Returns the key for the persistent pipeline cache of a separable shader. This must not collide with keys of linked GL programs.
+static std::uint64_t GetGLSeparableShaderCacheStoreKey(std::uint64_t contentHash)
+{
+    std::uint64_t seed = g_hashSeed;
+    HashString(seed, "GLSeparableShader");
+    HashValue(seed, contentHash);
+    return seed;
+}
+
+GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc, PipelineCacheStore* pipelineCacheStore) :
     GLShader { /*isSeparable:*/ true, desc }
 {
-    GLLegacyShader intermediateShader{ desc };
-    if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault))
+    if (pipelineCacheStore != nullptr)
     {
-        if (intermediateShader.GetID(PermutationFlippedYPosition) != 0)
-            CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition);
+        /* Load program binaries from persistent cache and only compile the shader if any of them is missing */
+        const std::uint64_t key = GetGLSeparableShaderCacheStoreKey(GetContentHash());
+        GLPipelineCache persistentCache{ pipelineCacheStore->Read(key) };
+        if (!LoadSeparableGLPrograms(persistentCache, GLShader::NeedsPermutationFlippedYPosition(desc.type, desc.flags)))
+        {
+            BuildSeparableGLPrograms(desc, &persistentCache);
+            if (persistentCache.IsModified())
+                pipelineCacheStore->Write(key, persistentCache.GetBlob());
+        }
     }
+    else
+        BuildSeparableGLPrograms(desc, nullptr);
 
     if (desc.debugName != nullptr)
         SetDebugName(desc.debugName);
@@ -38,7 +58,8 @@ GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
 
 GLSeparableShader::~GLSeparableShader()
 {
-    glDeleteProgram(GetID());
+    for_range(permutation, PermutationCount)
+        glDeleteProgram(GetID(static_cast<Permutation>(permutation)));
 }
 
 void GLSeparableShader::SetDebugName(const char* name)
@@ -48,6 +69,9 @@ void GLSeparableShader::SetDebugName(const char* name)
 
 bool GLSeparableShader::Reflect(ShaderReflection& reflection) const
 {
+    if (GetSerializedReflection(reflection))
+        return true;
+
     GLShaderProgram::QueryReflection(GetID(), GetGLType(), reflection);
     return true;
 }
@@ -128,9 +152,58 @@ bool GLSeparableShader::CreateAndLinkSeparableGLProgram(GLLegacyShader& intermed
     return status;
 }
 
+bool GLSeparableShader::LoadSeparableGLPrograms(GLPipelineCache& pipelineCache, bool hasPermutationFlippedYPosition)
+{
+    const std::size_t permutationCount = (hasPermutationFlippedYPosition ? PermutationCount : PermutationFlippedYPosition);
+
+    for_range(permutationIndex, permutationCount)
+    {
+        const Permutation permutation = static_cast<Permutation>(permutationIndex);
+        if (!pipelineCache.HasProgramBinary(permutation))
+            return false;
+    }
+
+    for_range(permutationIndex, permutationCount)
+    {
+        /* Load program binary into new separable GL program; The separable state must be set before the binary is loaded */
+        const Permutation permutation = static_cast<Permutation>(permutationIndex);
+        const GLuint program = CreateSeparableGLProgram();
+        if (!pipelineCache.ProgramBinary(permutation, program))
+        {
+            /* Discard all programs if the driver rejected any of the binaries, e.g. after a driver update */
+            glDeleteProgram(program);
+            for_range(i, permutationIndex)
+            {
+                glDeleteProgram(GetID(static_cast<Permutation>(i)));
+                SetID(0, static_cast<Permutation>(i));
+            }
+            return false;
+        }
+        SetID(program, permutation);
+    }
+
+    ReportStatusAndLog(true, GLShaderProgram::GetGLProgramLog(GetID()));
+    return true;
+}
+
+void GLSeparableShader::BuildSeparableGLPrograms(const ShaderDescriptor& desc, GLPipelineCache* pipelineCache)
+{
+    GLLegacyShader intermediateShader{ desc };
+    if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationDefault))
+    {
+        if (pipelineCache != nullptr)
+            pipelineCache->GetProgramBinary(PermutationDefault, GetID(PermutationDefault));
+        if (intermediateShader.GetID(PermutationFlippedYPosition) != 0)
+        {
+            if (CreateAndLinkSeparableGLProgram(intermediateShader, PermutationFlippedYPosition) && pipelineCache != nullptr)
+                pipelineCache->GetProgramBinary(PermutationFlippedYPosition, GetID(PermutationFlippedYPosition));
+        }
+    }
+}
+
 #else // LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
 
-GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc) :
+GLSeparableShader::GLSeparableShader(const ShaderDescriptor& desc, PipelineCacheStore* /*pipelineCacheStore*/) :
     GLShader { /*isSeparable:*/ true, desc }
 {
     LLGL_TRAP_FEATURE_NOT_SUPPORTED("GL_ARB_separate_shader_objects");
@@ -18,7 +18,9 @@ namespace LLGL
 
 
 class GLLegacyShader;
+class GLPipelineCache;
 class GLShaderBindingLayout;
+class PipelineCacheStore;
 class GLShaderBufferInterfaceMap;
 
 #if LLGL_GLEXT_SEPARATE_SHADER_OBJECTS
@@ -34,7 +36,7 @@ class GLSeparableShader final : public GLShader
 
     public:
 
-        GLSeparableShader(const ShaderDescriptor& desc);
+        GLSeparableShader(const ShaderDescriptor& desc, PipelineCacheStore* pipelineCacheStore = nullptr);
         ~GLSeparableShader();
 
         // Binds the resource names to their respective binding slots for this separable shader. Also implemented in GLShaderProgram.
@@ -47,6 +49,12 @@ class GLSeparableShader final : public GLShader
 
         bool CreateAndLinkSeparableGLProgram(GLLegacyShader& intermediateShader, Permutation permutation);
 
+        // Loads the separable GL programs of all required permutations from the pipeline cache. Returns false if any of them is missing.
+        bool LoadSeparableGLPrograms(GLPipelineCache& pipelineCache, bool hasPermutationFlippedYPosition);
+
+        // Compiles and links the separable GL programs of all required permutations and stores their binaries in the optional pipeline cache.
+        void BuildSeparableGLPrograms(const ShaderDescriptor& desc, GLPipelineCache* pipelineCache);
+
     private:
 
         const GLShaderBindingLayout* bindingLayout_ = nullptr;
@@ -65,7 +73,7 @@ class GLSeparableShader final : public GLShader
 
     public:
 
-        GLSeparableShader(const ShaderDescriptor& desc);
+        GLSeparableShader(const ShaderDescriptor& desc, PipelineCacheStore* pipelineCacheStore = nullptr);
 
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr);
         void QueryInfoLog(std::string& text, bool& hasErrors);
@@ -14,6 +14,9 @@
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/ReportUtils.h"
+#include "../../../Core/StringUtils.h"
+#include "../../../Core/HashUtils.h"
+#include "../../../Platform/MappedFile.h"
 #include <LLGL/Utils/ForRange.h>
 #include <vector>
 #include <stdexcept>
@@ -24,9 +27,85 @@ namespace LLGL
 {
 
 
+static void HashVertexAttribs(std::uint64_t& seed, const std::vector<VertexAttribute>& attribs)
+{
+    HashValue(seed, attribs.size());
+    for (const VertexAttribute& attrib : attribs)
+    {
+        HashString(seed, attrib.name.c_str());
+        HashValue(seed, attrib.format);
+        HashValue(seed, attrib.location);
+        HashValue(seed, attrib.semanticIndex);
+        HashValue(seed, attrib.systemValue);
+    }
+}
+
+// Returns a hash of all shader descriptor states that affect the linked GL program, including the contents of shader files.
+static std::uint64_t GetShaderDescriptorHash(const ShaderDescriptor& desc)
+{
+    std::uint64_t seed = g_hashSeed;
+
+    HashValue(seed, desc.type);
+    HashValue(seed, desc.sourceType);
+    HashValue(seed, desc.flags);
+    HashString(seed, desc.entryPoint);
+    HashString(seed, desc.profile);
+
+    /* Hash shader source or binary */
+    switch (desc.sourceType)
+    {
+        case ShaderSourceType::CodeString:
+            if (desc.source != nullptr)
+                HashBytes(seed, desc.source, (desc.sourceSize > 0 ? desc.sourceSize : ::strlen(desc.source)));
+            break;
+        case ShaderSourceType::CodeFile:
+        {
+            const std::string fileContent = ReadFileString(desc.source);
+            HashBytes(seed, fileContent.data(), fileContent.size());
+        }
+        break;
+        case ShaderSourceType::BinaryBuffer:
+            if (desc.source != nullptr)
+                HashBytes(seed, desc.source, desc.sourceSize);
+            break;
+        case ShaderSourceType::BinaryFile:
+        {
+            if (std::unique_ptr<MappedFile> mappedFile = MappedFile::Open(desc.source))
+                HashBytes(seed, mappedFile->GetData(), mappedFile->GetSize());
+        }
+        break;
+    }
+
+    /* Hash macro definitions */
+    if (desc.defines != nullptr)
+    {
+        for (const ShaderMacro* macro = desc.defines; macro->name != nullptr; ++macro)
+        {
+            HashString(seed, macro->name);
+            HashString(seed, macro->definition);
+        }
+    }
+
+    /* Hash attributes that are bound before the program is linked */
+    HashVertexAttribs(seed, desc.vertex.inputAttribs);
+    HashVertexAttribs(seed, desc.vertex.outputAttribs);
+
+    HashValue(seed, desc.fragment.outputAttribs.size());
+    for (const FragmentAttribute& attrib : desc.fragment.outputAttribs)
+    {
+        HashString(seed, attrib.name.c_str());
+        HashValue(seed, attrib.format);
+        HashValue(seed, attrib.location);
+        HashValue(seed, attrib.systemValue);
+    }
+
+    return seed;
+}
+
 GLShader::GLShader(const bool isSeparable, const ShaderDescriptor& desc) :
-    Shader       { desc.type   },
-    isSeparable_ { isSeparable }
+    Shader       { desc                          },
+    isSeparable_ { isSeparable                   },
+    contentHash_ { GetShaderDescriptorHash(desc) }
 {
     ReserveAttribs(desc);
     BuildVertexInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
@@ -84,6 +84,12 @@ class GLShader : public Shader
             return isSeparable_;
         }
 
+        // Returns a hash of the shader source and all descriptor states that affect the linked GL program. This is used as key for persistent pipeline caches.
+        inline std::uint64_t GetContentHash() const
+        {
+            return contentHash_;
+        }
+
     public:
 
         // Returns true if the specified shader descriptor requires the permutation with flipped Y-position; See PermutationFlippedYPosition.
@@ -133,6 +139,7 @@ class GLShader : public Shader
     private:
 
         const bool                      isSeparable_;
+        const std::uint64_t             contentHash_                = 0;
         GLuint                          id_[PermutationCount]       = {}; // ID from either glCreateShader or glCreateShaderProgramv
         LinearStringContainer           shaderAttribNames_;
         std::vector<GLShaderAttribute>  shaderAttribs_;
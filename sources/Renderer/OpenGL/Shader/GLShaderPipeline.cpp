@@ -25,6 +25,11 @@ void GLShaderPipeline::BuildSignature(std::size_t numShaders, const Shader* cons
     signature_.Build(numShaders, shaders, permutation);
 }
 
+bool GLShaderPipeline::QueryCompletionStatus() const
+{
+    return true;
+}
+
 int GLShaderPipeline::CompareSWO(const GLShaderPipeline& lhs, const GLShaderPipeline& rhs)
 {
     return GLPipelineSignature::CompareSWO(lhs.signature_, rhs.signature_);
@@ -48,6 +48,9 @@ class GLShaderPipeline
         // Returns the set of all texture buffer names (samplerBuffer/imageBuffer) in the entire shader pipeline.
         virtual void QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const = 0;
 
+        // Returns true if linking has completed without blocking, i.e. GL_COMPLETION_STATUS_KHR. By default, this returns true.
+        virtual bool QueryCompletionStatus() const;
+
         // Returns the native pipeline ID. Can be either from glCreateProgramPipelines or glCreateProgram.
         inline GLuint GetID() const
         {
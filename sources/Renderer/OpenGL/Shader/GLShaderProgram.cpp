@@ -144,6 +144,19 @@ void GLShaderProgram::QueryTexBufferNames(std::set<std::string>& outSamplerBuffe
     GLShaderProgram::QueryTexBufferNames(GetID(), outSamplerBufferNames, outImageBufferNames);
 }
 
+bool GLShaderProgram::QueryCompletionStatus() const
+{
+    #if LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    if (HasExtension(GLExt::KHR_parallel_shader_compile))
+    {
+        GLint status = GL_TRUE;
+        glGetProgramiv(GetID(), GL_COMPLETION_STATUS_KHR, &status);
+        return (status != GL_FALSE);
+    }
+    #endif // /LLGL_GLEXT_PARALLEL_SHADER_COMPILE
+    return true;
+}
+
 bool GLShaderProgram::GetLinkStatus(GLuint program)
 {
     GLint status = 0;
@@ -33,6 +33,7 @@ class GLShaderProgram final : public GLShaderPipeline
         void BindResourceSlots(const GLShaderBindingLayout& bindingLayout, const GLShaderBufferInterfaceMap* bufferInterfaceMap = nullptr) override;
         void QueryInfoLogs(Report& report) override;
         void QueryTexBufferNames(std::set<std::string>& outSamplerBufferNames, std::set<std::string>& outImageBufferNames) const override;
+        bool QueryCompletionStatus() const override;
 
     public:
 
@@ -0,0 +1,144 @@
+/*
+ * GLBindlessTexturePool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLBindlessTexturePool.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/MacroUtils.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+GLBindlessTexturePool& GLBindlessTexturePool::Get()
+{
+    static GLBindlessTexturePool instance;
+    return instance;
+}
+
+void GLBindlessTexturePool::Clear()
+{
+    #if LLGL_GLEXT_BINDLESS_TEXTURE
+
+    /* Make all handles non-resident before the GL context is destroyed */
+    for (const GLBindlessHandle& entry : handles_)
+        glMakeTextureHandleNonResidentARB(entry.handle);
+
+    #endif // /LLGL_GLEXT_BINDLESS_TEXTURE
+
+    handles_.clear();
+}
+
+GLuint64 GLBindlessTexturePool::AcquireHandle(GLuint texID, GLuint samplerID)
+{
+    #if LLGL_GLEXT_BINDLESS_TEXTURE
+
+    if (texID == 0 || !HasExtension(GLExt::ARB_bindless_texture))
+        return 0;
+
+    /* Query handle for texture-sampler pair; GL returns the same handle for the same pair */
+    const GLuint64 handle = (samplerID != 0 ? glGetTextureSamplerHandleARB(texID, samplerID) : glGetTextureHandleARB(texID));
+    if (handle == 0)
+        return 0;
+
+    /* Try to find resident handle */
+    std::size_t insertionIndex = 0;
+    GLBindlessHandle* entry = FindInSortedArray<GLBindlessHandle>(
+        handles_.data(),
+        handles_.size(),
+        [handle](const GLBindlessHandle& rhs)
+        {
+            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(handle, rhs.handle);
+            return 0;
+        },
+        &insertionIndex
+    );
+
+    if (entry != nullptr)
+    {
+        /* Share resident handle */
+        ++entry->refCount;
+    }
+    else
+    {
+        /* Make new handle resident and store it with insertion sort */
+        glMakeTextureHandleResidentARB(handle);
+
+        GLBindlessHandle newEntry;
+        {
+            newEntry.handle     = handle;
+            newEntry.texID      = texID;
+            newEntry.refCount   = 1;
+        }
+        handles_.insert(handles_.begin() + insertionIndex, newEntry);
+    }
+
+    return handle;
+
+    #else
+
+    return 0;
+
+    #endif // /LLGL_GLEXT_BINDLESS_TEXTURE
+}
+
+void GLBindlessTexturePool::ReleaseHandle(GLuint64 handle)
+{
+    #if LLGL_GLEXT_BINDLESS_TEXTURE
+
+    if (handle == 0)
+        return;
+
+    std::size_t index = 0;
+    GLBindlessHandle* entry = FindInSortedArray<GLBindlessHandle>(
+        handles_.data(),
+        handles_.size(),
+        [handle](const GLBindlessHandle& rhs)
+        {
+            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(handle, rhs.handle);
+            return 0;
+        },
+        &index
+    );
+
+    /* Make handle non-resident if the reference counter reaches 0 */
+    if (entry != nullptr && --entry->refCount == 0)
+    {
+        glMakeTextureHandleNonResidentARB(handle);
+        handles_.erase(handles_.begin() + index);
+    }
+
+    #endif // /LLGL_GLEXT_BINDLESS_TEXTURE
+}
+
+void GLBindlessTexturePool::NotifyTextureRelease(GLuint texID)
+{
+    if (handles_.empty())
+        return;
+
+    handles_.erase(
+        std::remove_if(
+            handles_.begin(),
+            handles_.end(),
+            [texID](const GLBindlessHandle& entry)
+            {
+                return (entry.texID == texID);
+            }
+        ),
+        handles_.end()
+    );
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
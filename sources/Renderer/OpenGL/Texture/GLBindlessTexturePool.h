@@ -0,0 +1,89 @@
+/*
+ * GLBindlessTexturePool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_BINDLESS_TEXTURE_POOL_H
+#define LLGL_GL_BINDLESS_TEXTURE_POOL_H
+
+
+#include "../OpenGL.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Class to manage the residency of GL bindless texture handles (GL_ARB_bindless_texture); used by <GLResourceHeap>.
+The same texture-sampler pair always yields the same handle and a handle must not be made resident twice,
+so handles are reference counted across all resource heaps.
+*/
+class GLBindlessTexturePool
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLBindlessTexturePool& Get();
+
+    public:
+
+        GLBindlessTexturePool(const GLBindlessTexturePool&) = delete;
+        GLBindlessTexturePool& operator = (const GLBindlessTexturePool&) = delete;
+
+        GLBindlessTexturePool(GLBindlessTexturePool&&) = delete;
+        GLBindlessTexturePool& operator = (GLBindlessTexturePool&&) = delete;
+
+        // Releases all resources for this singleton class.
+        void Clear();
+
+        /*
+        Returns the resident bindless handle for the specified texture and sampler.
+        If 'samplerID' is 0, the handle uses the sampling parameters of the texture object itself.
+        Returns 0 if the extension "GL_ARB_bindless_texture" is not supported.
+        */
+        GLuint64 AcquireHandle(GLuint texID, GLuint samplerID);
+
+        // Releases the handle that was returned by AcquireHandle and makes it non-resident once it is no longer referenced.
+        void ReleaseHandle(GLuint64 handle);
+
+        /*
+        Notifies the bindless texture pool that the specified texture was released.
+        GL deletes all handles of a texture together with the texture object, so their entries are only dropped from the pool.
+        */
+        void NotifyTextureRelease(GLuint texID);
+
+    private:
+
+        GLBindlessTexturePool() = default;
+
+    private:
+
+        // Resident bindless texture handle; managed by <GLBindlessTexturePool>
+        struct GLBindlessHandle
+        {
+            GLuint64    handle      = 0;
+            GLuint      texID       = 0;
+            GLuint      refCount    = 0;
+        };
+
+    private:
+
+        // Container of all resident handles, sorted by handle value.
+        std::vector<GLBindlessHandle> handles_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
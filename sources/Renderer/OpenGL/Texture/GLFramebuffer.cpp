@@ -73,7 +73,17 @@ GLFramebuffer& GLFramebuffer::operator = (GLFramebuffer&& rhs)
 void GLFramebuffer::GenFramebuffer()
 {
     DeleteFramebuffer();
-    glGenFramebuffers(1, &id_);
+    #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Create framebuffer object without binding it (GL 4.5+) */
+        glCreateFramebuffers(1, &id_);
+    }
+    else
+    #endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+    {
+        glGenFramebuffers(1, &id_);
+    }
 }
 
 void GLFramebuffer::DeleteFramebuffer()
@@ -96,12 +106,27 @@ bool GLFramebuffer::FramebufferParameters(
     #if LLGL_GLEXT_FRAMEBUFFER_NO_ATTACHMENTS
     if (HasExtension(GLExt::ARB_framebuffer_no_attachments))
     {
-        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::Framebuffer, GetID());
-        glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_WIDTH, width);
-        glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_HEIGHT, height);
-        glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_LAYERS, layers);
-        glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_SAMPLES, samples);
-        glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS, fixedSampleLocations);
+        #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+        if (HasExtension(GLExt::ARB_direct_state_access))
+        {
+            /* Set default parameters of named framebuffer directly (GL 4.5+) */
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_WIDTH, width);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_HEIGHT, height);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_LAYERS, layers);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_SAMPLES, samples);
+            glNamedFramebufferParameteri(GetID(), GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS, fixedSampleLocations);
+        }
+        else
+        #endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+        {
+            /* Bind framebuffer and set its default parameters */
+            GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::Framebuffer, GetID());
+            glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_WIDTH, width);
+            glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_HEIGHT, height);
+            glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_LAYERS, layers);
+            glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_SAMPLES, samples);
+            glFramebufferParameteri(GL_FRAMEBUFFER, GL_FRAMEBUFFER_DEFAULT_FIXED_SAMPLE_LOCATIONS, fixedSampleLocations);
+        }
         return true;
     }
     #endif // /LLGL_GLEXT_FRAMEBUFFER_NO_ATTACHMENTS
@@ -161,6 +186,25 @@ void GLFramebuffer::AttachTexture(
     }
 }
 
+void GLFramebuffer::AttachTextureMultiview(
+    const GLTexture&    texture,
+    GLenum              attachment,
+    GLint               mipLevel,
+    GLint               baseViewIndex,
+    GLsizei             numViews,
+    GLenum              target)
+{
+    #if LLGL_GLEXT_MULTIVIEW
+    if (!HasExtension(GLExt::OVR_multiview2))
+        LLGL_TRAP_FEATURE_NOT_SUPPORTED("GL_OVR_multiview2");
+    if (texture.IsRenderbuffer() || !IsArrayTexture(texture.GetType()))
+        LLGL_TRAP("multiview attachments must be array textures");
+    glFramebufferTextureMultiviewOVR(target, attachment, texture.GetID(), mipLevel, baseViewIndex, numViews);
+    #else
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("multiview");
+    #endif
+}
+
 void GLFramebuffer::AttachRenderbuffer(GLenum attachment, GLuint renderbufferID)
 {
     #if LLGL_GLEXT_FRAMEBUFFER_OBJECT
@@ -85,6 +85,16 @@ class GLFramebuffer
             GLenum              target = GL_FRAMEBUFFER
         );
 
+        // Attaches a contiguous range of array layers of the specified texture for multiview rendering (GL_OVR_multiview).
+        static void AttachTextureMultiview(
+            const GLTexture&    texture,
+            GLenum              attachment,
+            GLint               mipLevel,
+            GLint               baseViewIndex,
+            GLsizei             numViews,
+            GLenum              target = GL_FRAMEBUFFER
+        );
+
         static void AttachRenderbuffer(GLenum attachment, GLuint renderbufferID);
 
         static void Blit(GLint width, GLint height, GLenum mask);
@@ -13,6 +13,7 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
+#include "../../FormatTable.h"
 
 
 namespace LLGL
@@ -77,7 +78,7 @@ void GLFramebufferCapture::CaptureFramebuffer(
         return /*GL_INVALID_VALUE*/;
 
     const TextureType       type            = textureGL.GetType();
-    const FormatAttributes& formatAttribs   = GetFormatAttribs(textureGL.GetFormat());
+    const FormatAttributes& formatAttribs   = FormatTable::GetAttribs(textureGL.GetFormat());
     const bool              hasDepth        = ((formatAttribs.flags & FormatFlags::HasDepth) != 0);
     const bool              hasStencil      = ((formatAttribs.flags & FormatFlags::HasStencil) != 0);
     const bool              isDepthStencil  = (hasDepth || hasStencil);
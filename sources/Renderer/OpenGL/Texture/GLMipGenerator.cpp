@@ -29,6 +29,18 @@ GLMipGenerator& GLMipGenerator::Get()
 void GLMipGenerator::Clear()
 {
     mipGenerationFBOPair_.ReleaseFBOs();
+
+    #if LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+    for_range(i, 2)
+    {
+        if (computePrograms_[i] != 0)
+        {
+            glDeleteProgram(computePrograms_[i]);
+            computePrograms_[i] = 0;
+        }
+        computeProgramsFailed_[i] = false;
+    }
+    #endif // /LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
 }
 
 void GLMipGenerator::GenerateMips(const TextureType type)
@@ -38,6 +50,12 @@ void GLMipGenerator::GenerateMips(const TextureType type)
 
 void GLMipGenerator::GenerateMipsForTexture(GLStateManager& stateMngr, GLTexture& textureGL)
 {
+    #if LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+    const GLuint numArrayLayers = (textureGL.GetType() == TextureType::Texture2DArray ? textureGL.GetMipExtent(0).depth : 1u);
+    if (GenerateMipsRangeWithCompute(stateMngr, textureGL, 0, static_cast<GLuint>(textureGL.GetNumMipLevels()), 0, numArrayLayers))
+        return;
+    #endif // /LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+
     GenerateMipsPrimary(stateMngr, textureGL.GetID(), textureGL.GetType());
 }
 
@@ -52,6 +70,19 @@ void GLMipGenerator::GenerateMipsRangeForTexture(
 {
     if (numMipLevels > 0 && numArrayLayers > 0)
     {
+        #if LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+        if (GenerateMipsRangeWithCompute(
+                stateMngr,
+                textureGL,
+                static_cast<GLuint>(baseMipLevel),
+                static_cast<GLuint>(numMipLevels),
+                static_cast<GLuint>(baseArrayLayer),
+                static_cast<GLuint>(numArrayLayers)))
+        {
+            /* MIP-maps have been generated with compute shader */
+        }
+        else
+        #endif // /LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
         #if LLGL_GLEXT_TEXTURE_VIEW
         if (HasExtension(GLExt::ARB_texture_view))
         {
@@ -307,6 +338,303 @@ void GLMipGenerator::GenerateMipsRangeWithTextureView(
 
 #endif // /LLGL_GLEXT_TEXTURE_VIEW
 
+#if LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+
+/*
+GLSL port of the builtin D3D compute shader GenerateMips2D.hlsl: writes up to 4 MIP levels per dispatch with 8x8 work groups.
+The first level is an exact box filter of the source level (including the 3-tap case for odd extents),
+the following levels are reduced in shared memory and only dispatched when their extents are exact halves.
+*/
+static const char* g_generateMipsComputeShaderSource = R"(
+layout(local_size_x = 8, local_size_y = 8, local_size_z = 1) in;
+
+#ifdef LLGL_MIPGEN_ARRAY
+#   define SRC_SAMPLER      sampler2DArray
+#   define DST_IMAGE        image2DArray
+#   define FETCH(POS)       texelFetch(srcMipLevel, ivec3(POS, arrayLayer), srcLevel)
+#   define STORE(IMG, POS)  imageStore(IMG, ivec3(POS, arrayLayer), color)
+#else
+#   define SRC_SAMPLER      sampler2D
+#   define DST_IMAGE        image2D
+#   define FETCH(POS)       texelFetch(srcMipLevel, POS, srcLevel)
+#   define STORE(IMG, POS)  imageStore(IMG, POS, color)
+#endif
+
+layout(binding = 0) uniform SRC_SAMPLER srcMipLevel;
+
+layout(binding = 0) writeonly uniform DST_IMAGE dstMipLevel1;
+layout(binding = 1) writeonly uniform DST_IMAGE dstMipLevel2;
+layout(binding = 2) writeonly uniform DST_IMAGE dstMipLevel3;
+layout(binding = 3) writeonly uniform DST_IMAGE dstMipLevel4;
+
+layout(location = 0) uniform int    srcLevel;       // MIP level to read from
+layout(location = 1) uniform int    numMipLevels;   // Number of MIP levels to write: [1..4]
+layout(location = 2) uniform ivec2  srcExtent;      // Extent of the source MIP level
+layout(location = 3) uniform int    baseArrayLayer;
+
+shared vec4 tile[64];
+
+// Returns the weights of the box filter along one axis for destination coordinate 'x'
+vec3 BoxWeights(int x, int srcSize, int dstSize)
+{
+    if ((srcSize & 1) == 0 || srcSize == 1)
+        return vec3(0.5, 0.5, 0.0);
+    float n = float(srcSize);
+    return vec3(float(dstSize - x), float(dstSize), float(x + 1)) / n;
+}
+
+void main()
+{
+    ivec2   dstPos      = ivec2(gl_GlobalInvocationID.xy);
+    int     arrayLayer  = baseArrayLayer + int(gl_GlobalInvocationID.z);
+    uint    groupIndex  = gl_LocalInvocationIndex;
+    ivec2   dstExtent   = max(srcExtent / 2, ivec2(1));
+    ivec2   srcMax      = srcExtent - 1;
+
+    // Filter source MIP level with exact box filter
+    vec3 wx = BoxWeights(dstPos.x, srcExtent.x, dstExtent.x);
+    vec3 wy = BoxWeights(dstPos.y, srcExtent.y, dstExtent.y);
+
+    vec4 color = vec4(0.0);
+    for (int y = 0; y < 3; ++y)
+    {
+        if (wy[y] > 0.0)
+        {
+            for (int x = 0; x < 3; ++x)
+            {
+                if (wx[x] > 0.0)
+                {
+                    ivec2 srcPos = min(dstPos * 2 + ivec2(x, y), srcMax);
+                    color += (wx[x] * wy[y]) * FETCH(srcPos);
+                }
+            }
+        }
+    }
+
+    // Write 1st output MIP level; out-of-bounds stores are discarded
+    STORE(dstMipLevel1, dstPos);
+
+    if (numMipLevels == 1)
+        return;
+
+    // Write 2nd output MIP level
+    tile[groupIndex] = color;
+    memoryBarrierShared();
+    barrier();
+
+    if ((groupIndex & 0x09u) == 0u)
+    {
+        color = 0.25 * (color + tile[groupIndex + 0x01u] + tile[groupIndex + 0x08u] + tile[groupIndex + 0x09u]);
+        STORE(dstMipLevel2, dstPos / 2);
+        tile[groupIndex] = color;
+    }
+
+    if (numMipLevels == 2)
+        return;
+
+    // Write 3rd output MIP level
+    memoryBarrierShared();
+    barrier();
+
+    if ((groupIndex & 0x1Bu) == 0u)
+    {
+        color = 0.25 * (color + tile[groupIndex + 0x02u] + tile[groupIndex + 0x10u] + tile[groupIndex + 0x12u]);
+        STORE(dstMipLevel3, dstPos / 4);
+        tile[groupIndex] = color;
+    }
+
+    if (numMipLevels == 3)
+        return;
+
+    // Write 4th output MIP level
+    memoryBarrierShared();
+    barrier();
+
+    if (groupIndex == 0u)
+    {
+        color = 0.25 * (color + tile[0x04u] + tile[0x20u] + tile[0x24u]);
+        STORE(dstMipLevel4, dstPos / 8);
+    }
+}
+)";
+
+GLuint GLMipGenerator::GetOrCreateComputeProgram(bool isArray)
+{
+    const int idx = (isArray ? 1 : 0);
+
+    if (computePrograms_[idx] == 0 && !computeProgramsFailed_[idx])
+    {
+        /* Compile compute shader with the variant for 2D or 2D array textures */
+        const GLchar* sources[] =
+        {
+            "#version 430 core\n",
+            (isArray ? "#define LLGL_MIPGEN_ARRAY\n" : "\n"),
+            g_generateMipsComputeShaderSource,
+        };
+
+        GLuint shader = glCreateShader(GL_COMPUTE_SHADER);
+        glShaderSource(shader, 3, sources, nullptr);
+        glCompileShader(shader);
+
+        GLint status = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+
+        if (status != GL_FALSE)
+        {
+            /* Link shader into program */
+            GLuint program = glCreateProgram();
+            glAttachShader(program, shader);
+            glLinkProgram(program);
+            glDetachShader(program, shader);
+
+            glGetProgramiv(program, GL_LINK_STATUS, &status);
+
+            if (status != GL_FALSE)
+                computePrograms_[idx] = program;
+            else
+                glDeleteProgram(program);
+        }
+
+        glDeleteShader(shader);
+
+        /* Don't try again if the driver rejected the program, e.g. when GLSL 4.30 is not supported */
+        if (computePrograms_[idx] == 0)
+            computeProgramsFailed_[idx] = true;
+    }
+
+    return computePrograms_[idx];
+}
+
+// Returns true if the specified internal format can be bound to an image unit and is filterable, i.e. not an integer format.
+static bool IsComputeMipGenerationFormat(GLenum internalFormat)
+{
+    switch (internalFormat)
+    {
+        case GL_RGBA32F:
+        case GL_RGBA16F:
+        case GL_RG32F:
+        case GL_RG16F:
+        case GL_R11F_G11F_B10F:
+        case GL_R32F:
+        case GL_R16F:
+        case GL_RGBA16:
+        case GL_RGB10_A2:
+        case GL_RGBA8:
+        case GL_RG16:
+        case GL_RG8:
+        case GL_R16:
+        case GL_R8:
+        case GL_RGBA16_SNORM:
+        case GL_RGBA8_SNORM:
+        case GL_RG16_SNORM:
+        case GL_RG8_SNORM:
+        case GL_R16_SNORM:
+        case GL_R8_SNORM:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Returns the number of MIP levels that can be generated in one dispatch: all levels after the first must be exact halves.
+static GLuint NumMipLevelsPerDispatch(GLuint dstWidth, GLuint dstHeight, GLuint numRemainingMips)
+{
+    GLuint numMips = 1;
+    while (numMips < 4 && numMips < numRemainingMips && (dstWidth & 1) == 0 && (dstHeight & 1) == 0)
+    {
+        dstWidth    /= 2;
+        dstHeight   /= 2;
+        ++numMips;
+    }
+    return numMips;
+}
+
+bool GLMipGenerator::GenerateMipsRangeWithCompute(
+    GLStateManager& stateMngr,
+    GLTexture&      textureGL,
+    GLuint          baseMipLevel,
+    GLuint          numMipLevels,
+    GLuint          baseArrayLayer,
+    GLuint          numArrayLayers)
+{
+    /* Only 2D and 2D array textures with formats that can be written via image units are supported; sRGB, integer, and depth formats use the fallback */
+    const TextureType texType = textureGL.GetType();
+    if (texType != TextureType::Texture2D && texType != TextureType::Texture2DArray)
+        return false;
+
+    if (textureGL.IsRenderbuffer() || !IsComputeMipGenerationFormat(textureGL.GetGLInternalFormat()))
+        return false;
+
+    if (!HasExtension(GLExt::ARB_compute_shader) || !HasExtension(GLExt::ARB_shader_image_load_store))
+        return false;
+
+    const bool      isArray = (texType == TextureType::Texture2DArray);
+    const GLuint    program = GetOrCreateComputeProgram(isArray);
+    if (program == 0)
+        return false;
+
+    if (numMipLevels < 2)
+        return true;
+
+    const GLuint            texID           = textureGL.GetID();
+    const GLenum            internalFormat  = textureGL.GetGLInternalFormat();
+    const GLTextureTarget   texTarget       = GLStateManager::GetTextureTarget(texType);
+    const Extent3D          baseExtent      = textureGL.GetMipExtent(baseMipLevel);
+
+    stateMngr.PushBoundShaderProgram();
+    stateMngr.PushBoundTexture(0, texTarget);
+    {
+        stateMngr.BindShaderProgram(program);
+        stateMngr.BindTexture(0, texTarget, texID);
+
+        glUniform1i(3, static_cast<GLint>(baseArrayLayer));
+
+        GLuint srcWidth     = baseExtent.width;
+        GLuint srcHeight    = baseExtent.height;
+
+        const GLuint mipLevelEnd = baseMipLevel + numMipLevels - 1;
+
+        for (GLuint mipLevel = baseMipLevel; mipLevel < mipLevelEnd;)
+        {
+            /* Determine destination extent and how many MIP levels can be written at once */
+            const GLuint dstWidth   = std::max(1u, srcWidth  / 2);
+            const GLuint dstHeight  = std::max(1u, srcHeight / 2);
+            const GLuint numMips    = NumMipLevelsPerDispatch(dstWidth, dstHeight, mipLevelEnd - mipLevel);
+
+            /* Bind output MIP levels to image units */
+            for_range(i, numMips)
+                stateMngr.BindImageTexture(i, static_cast<GLint>(mipLevel + 1 + i), internalFormat, texID);
+
+            glUniform1i(0, static_cast<GLint>(mipLevel));
+            glUniform1i(1, static_cast<GLint>(numMips));
+            glUniform2i(2, static_cast<GLint>(srcWidth), static_cast<GLint>(srcHeight));
+
+            glDispatchCompute((dstWidth + 7) / 8, (dstHeight + 7) / 8, numArrayLayers);
+
+            /* Make written MIP levels visible to the next dispatch and any subsequent access */
+            glMemoryBarrier(
+                GL_TEXTURE_FETCH_BARRIER_BIT        |
+                GL_SHADER_IMAGE_ACCESS_BARRIER_BIT  |
+                GL_FRAMEBUFFER_BARRIER_BIT          |
+                GL_TEXTURE_UPDATE_BARRIER_BIT
+            );
+
+            /* Move to next set of MIP levels */
+            srcWidth    = std::max(1u, dstWidth  >> (numMips - 1));
+            srcHeight   = std::max(1u, dstHeight >> (numMips - 1));
+            mipLevel    += numMips;
+        }
+
+        stateMngr.UnbindImageTextures(0, 4);
+    }
+    stateMngr.PopBoundTexture();
+    stateMngr.PopBoundShaderProgram();
+
+    return true;
+}
+
+#endif // /LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+
 
 } // /namespace LLGL
 
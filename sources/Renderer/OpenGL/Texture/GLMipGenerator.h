@@ -84,9 +84,31 @@ class GLMipGenerator
         );
         #endif // /LLGL_GLEXT_TEXTURE_VIEW
 
+        #if LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+
+        // Returns the compute program to downsample 2D textures or 2D array textures, or 0 if it could not be compiled.
+        GLuint GetOrCreateComputeProgram(bool isArray);
+
+        // Generates the MIP-maps with a compute shader that writes up to 4 MIP levels per dispatch. Returns false if the texture is not supported.
+        bool GenerateMipsRangeWithCompute(
+            GLStateManager& stateMngr,
+            GLTexture&      textureGL,
+            GLuint          baseMipLevel,
+            GLuint          numMipLevels,
+            GLuint          baseArrayLayer,
+            GLuint          numArrayLayers
+        );
+
+        #endif // /LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+
     private:
 
-        GLFramebufferPair mipGenerationFBOPair_;
+        GLFramebufferPair   mipGenerationFBOPair_;
+
+        #if LLGL_GLEXT_COMPUTE_SHADER && LLGL_GLEXT_SHADER_IMAGE_LOAD_STORE
+        GLuint              computePrograms_[2]         = { 0, 0 };         // Programs for 2D and 2D array textures.
+        bool                computeProgramsFailed_[2]   = { false, false }; // True if the program could not be compiled, so the fallback is used.
+        #endif
 
 };
 
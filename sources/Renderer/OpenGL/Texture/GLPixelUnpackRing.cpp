@@ -0,0 +1,128 @@
+/*
+ * GLPixelUnpackRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "GLPixelUnpackRing.h"
+#include "../Buffer/GLBuffer.h"
+#include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+GLPixelUnpackRing& GLPixelUnpackRing::Get()
+{
+    static GLPixelUnpackRing instance;
+    return instance;
+}
+
+void GLPixelUnpackRing::Clear()
+{
+    /* Wait for all pending uploads before the buffer is deleted */
+    for_range(i, numSegments)
+    {
+        if (segmentPending_[i])
+        {
+            segmentFences_[i].Wait(~0ull);
+            segmentPending_[i] = false;
+        }
+    }
+
+    buffer_.reset();
+    mappedData_     = nullptr;
+    isUnsupported_  = false;
+    currentSegment_ = 0;
+    currentOffset_  = 0;
+}
+
+bool GLPixelUnpackRing::Write(const void* data, std::size_t size, GLintptr& outOffset)
+{
+    /* Large uploads would block the ring for too long, so they are passed to the driver directly */
+    if (data == nullptr || size == 0 || size > segmentSize || !CreateBufferOnce())
+        return false;
+
+    /* Move to next segment if the data doesn't fit into the remainder of the current segment */
+    currentOffset_ = GetAlignedSize(currentOffset_, dataAlignment);
+    if (currentOffset_ + size > segmentSize)
+        MoveToNextSegment();
+
+    /* Copy data into persistently mapped memory; mapping is coherent, so no explicit flush is required */
+    const std::size_t offset = currentSegment_ * segmentSize + currentOffset_;
+    ::memcpy(mappedData_ + offset, data, size);
+    currentOffset_ += size;
+
+    outOffset = static_cast<GLintptr>(offset);
+    return true;
+}
+
+GLuint GLPixelUnpackRing::GetBufferID() const
+{
+    return (buffer_ ? buffer_->GetID() : 0);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool GLPixelUnpackRing::CreateBufferOnce()
+{
+    if (mappedData_ != nullptr)
+        return true;
+    if (isUnsupported_)
+        return false;
+
+    #if GL_ARB_buffer_storage && GL_ARB_sync
+    if (HasExtension(GLExt::ARB_buffer_storage) && HasExtension(GLExt::ARB_sync))
+    {
+        /* Allocate immutable storage for all segments and keep it mapped for the lifetime of the ring */
+        constexpr GLbitfield    storageFlags    = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+        constexpr GLsizeiptr    bufferSize      = static_cast<GLsizeiptr>(numSegments * segmentSize);
+
+        buffer_ = MakeUnique<GLBuffer>(BindFlags::CopySrc, "LLGL.PixelUnpackRing");
+        buffer_->BufferStorage(bufferSize, nullptr, storageFlags, GL_STREAM_DRAW);
+        buffer_->MapPersistent(bufferSize, GL_MAP_WRITE_BIT);
+
+        mappedData_ = reinterpret_cast<char*>(buffer_->MapBufferRange(0, bufferSize, storageFlags));
+        if (mappedData_ != nullptr)
+            return true;
+
+        buffer_.reset();
+    }
+    #endif // /GL_ARB_buffer_storage && GL_ARB_sync
+
+    isUnsupported_ = true;
+    return false;
+}
+
+void GLPixelUnpackRing::MoveToNextSegment()
+{
+    /* Fence current segment, since all commands that read from it have been issued at this point */
+    segmentFences_[currentSegment_].Submit();
+    segmentPending_[currentSegment_] = true;
+
+    /* Wait until the GPU has finished reading from the next segment */
+    currentSegment_ = (currentSegment_ + 1) % numSegments;
+    currentOffset_  = 0;
+
+    if (segmentPending_[currentSegment_])
+    {
+        segmentFences_[currentSegment_].Wait(~0ull);
+        segmentPending_[currentSegment_] = false;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,94 @@
+/*
+ * GLPixelUnpackRing.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_GL_PIXEL_UNPACK_RING_H
+#define LLGL_GL_PIXEL_UNPACK_RING_H
+
+
+#include "../OpenGL.h"
+#include "../RenderState/GLFence.h"
+#include <memory>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+class GLBuffer;
+
+/*
+Ring of persistently mapped pixel unpack buffer (GL_PIXEL_UNPACK_BUFFER) segments for texture uploads.
+Image data is copied into the current segment and the texture is updated from that buffer,
+so the driver can schedule the transfer asynchronously instead of copying client memory synchronously.
+Each segment is fenced when the ring moves to the next one and is only reused once that fence has been signaled.
+*/
+class GLPixelUnpackRing
+{
+
+    public:
+
+        // Returns the instance of this singleton.
+        static GLPixelUnpackRing& Get();
+
+    public:
+
+        GLPixelUnpackRing(const GLPixelUnpackRing&) = delete;
+        GLPixelUnpackRing& operator = (const GLPixelUnpackRing&) = delete;
+
+        GLPixelUnpackRing(GLPixelUnpackRing&&) = delete;
+        GLPixelUnpackRing& operator = (GLPixelUnpackRing&&) = delete;
+
+        // Releases the resource for this singleton class.
+        void Clear();
+
+        /*
+        Copies the specified data into the ring and returns the byte offset within the unpack buffer.
+        Returns false if persistent mapping is not supported or the data is larger than a single segment;
+        the caller must fall back to uploading from client memory in that case.
+        */
+        bool Write(const void* data, std::size_t size, GLintptr& outOffset);
+
+        // Returns the ID of the unpack buffer. This is only valid after Write() returned true.
+        GLuint GetBufferID() const;
+
+    private:
+
+        GLPixelUnpackRing() = default;
+
+        // Allocates and persistently maps the unpack buffer. Returns false if this is not supported.
+        bool CreateBufferOnce();
+
+        // Fences the current segment and waits until the next segment is no longer in use by the GPU.
+        void MoveToNextSegment();
+
+    private:
+
+        static constexpr std::size_t numSegments    = 4;
+        static constexpr std::size_t segmentSize    = 4 * 1024 * 1024;
+        static constexpr std::size_t dataAlignment  = 16;
+
+        std::unique_ptr<GLBuffer>   buffer_;
+        char*                       mappedData_                 = nullptr;
+        bool                        isUnsupported_              = false;
+
+        GLFence                     segmentFences_[numSegments];
+        bool                        segmentPending_[numSegments] = {};
+        std::size_t                 currentSegment_             = 0;
+        std::size_t                 currentOffset_              = 0; // Offset within the current segment
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
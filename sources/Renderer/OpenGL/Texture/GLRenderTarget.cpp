@@ -14,6 +14,7 @@
 #include "../Ext/GLExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
@@ -30,6 +31,9 @@ GLRenderTarget::GLRenderTarget(const RenderingLimits& limits, const RenderTarget
     samples_     { static_cast<GLint>(GetLimitedRenderTargetSamples(limits, desc))                       },
     renderPass_  { desc.renderPass                                                                       }
 {
+    if (desc.viewMask != 0)
+        InitializeMultiview(desc);
+
     framebuffer_.GenFramebuffer();
 
     if (HasAnyActiveAttachments(desc))
@@ -174,6 +178,39 @@ static void GLThrowIfFramebufferStatusFailed(const char* info)
     GLThrowIfFailed(status, GL_FRAMEBUFFER_COMPLETE, info);
 }
 
+static void GLThrowIfNamedFramebufferStatusFailed(const GLFramebuffer& framebuffer, const char* info)
+{
+    #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        const GLenum status = glCheckNamedFramebufferStatus(framebuffer.GetID(), GL_FRAMEBUFFER);
+        GLThrowIfFailed(status, GL_FRAMEBUFFER_COMPLETE, info);
+    }
+    else
+    #endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+    {
+        GLStateManager::Get().BindFramebuffer(GLFramebufferTarget::DrawFramebuffer, framebuffer.GetID());
+        GLThrowIfFramebufferStatusFailed(info);
+    }
+}
+
+void GLRenderTarget::InitializeMultiview(const RenderTargetDescriptor& desc)
+{
+    /* GL_OVR_multiview can only render into a contiguous range of array layers */
+    const std::uint32_t numViews    = NumMultiviewViews(desc.viewMask);
+    const std::uint32_t baseView    = NumMultiviewLayers(desc.viewMask) - numViews;
+    const std::uint32_t viewRange   = (numViews < 32 ? (1u << numViews) - 1u : ~0u);
+    if ((desc.viewMask >> baseView) != viewRange)
+        LLGL_TRAP("view mask 0x%08X of render target must specify a contiguous range of array layers for OpenGL", desc.viewMask);
+    if (NumActiveResolveAttachments(desc) > 0)
+        LLGL_TRAP_FEATURE_NOT_SUPPORTED("multiview render targets with resolve attachments");
+    if (!HasAnyActiveAttachments(desc))
+        LLGL_TRAP_FEATURE_NOT_SUPPORTED("multiview render targets without attachments");
+
+    baseViewIndex_  = static_cast<GLint>(baseView);
+    numViews_       = static_cast<GLsizei>(numViews);
+}
+
 void GLRenderTarget::CreateFramebufferWithAttachments(const RenderTargetDescriptor& desc)
 {
     const std::uint32_t numColorAttachments = GetNumColorAttachments();
@@ -250,7 +287,7 @@ void GLRenderTarget::CreateFramebufferWithNoAttachments()
     }
 
     /* Validate framebuffer status */
-    GLThrowIfFramebufferStatusFailed("initializing default parameters for framebuffer object (FBO) failed");
+    GLThrowIfNamedFramebufferStatusFailed(framebuffer_, "initializing default parameters for framebuffer object (FBO) failed");
 }
 
 void GLRenderTarget::BuildColorAttachment(const AttachmentDescriptor& attachmentDesc, std::uint32_t colorTarget)
@@ -306,15 +343,20 @@ void GLRenderTarget::BuildAttachmentWithTexture(GLenum binding, const Attachment
         outAttachmentGL->level      = static_cast<GLint>(mipLevel);
         outAttachmentGL->layer      = static_cast<GLint>(attachmentDesc.arrayLayer);
     }
+    else if (numViews_ > 0)
+        GLFramebuffer::AttachTextureMultiview(*textureGL, binding, static_cast<GLint>(mipLevel), static_cast<GLint>(attachmentDesc.arrayLayer) + baseViewIndex_, numViews_);
     else
         GLFramebuffer::AttachTexture(*textureGL, binding, static_cast<GLint>(mipLevel), static_cast<GLint>(attachmentDesc.arrayLayer));
 }
 
 void GLRenderTarget::BuildAttachmentWithRenderbuffer(GLenum binding, Format format)
 {
+    if (numViews_ > 0)
+        LLGL_TRAP_FEATURE_NOT_SUPPORTED("multiview render targets with renderbuffer attachments");
     CreateAndAttachRenderbuffer(binding, GLTypes::Map(format));
 }
 
+
 void GLRenderTarget::CreateAndAttachRenderbuffer(GLenum binding, GLenum internalFormat)
 {
     GLRenderbuffer renderbuffer;
@@ -70,6 +70,7 @@ class GLRenderTarget final : public RenderTarget
 
     private:
 
+        void InitializeMultiview(const RenderTargetDescriptor& desc);
         void CreateFramebufferWithAttachments(const RenderTargetDescriptor& desc);
         void CreateFramebufferWithNoAttachments();
 
@@ -112,6 +113,8 @@ class GLRenderTarget final : public RenderTarget
         SmallVector<GLenum, 2>                  drawBuffersResolve_;                // Values for glDrawBuffers for the resolve FBO
 
         GLint                                   samples_                = 1;
+        GLint                                   baseViewIndex_          = 0;        // Offset of the first view into the attachment array layers (GL_OVR_multiview)
+        GLsizei                                 numViews_               = 0;        // Number of multiview views, or 0 if multiview is disabled
         GLenum                                  depthStencilBinding_    = 0;        // Equivalent of drawBuffers but for depth-stencil
 
         const RenderPass*                       renderPass_             = nullptr;
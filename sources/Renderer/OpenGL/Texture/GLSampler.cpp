@@ -9,6 +9,7 @@
 #include "../GLTypes.h"
 #include "../GLObjectUtils.h"
 #include "../Ext/GLExtensions.h"
+#include "../Ext/GLExtensionRegistry.h"
 #include "../RenderState/GLStateManager.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/CoreUtils.h"
@@ -23,7 +24,17 @@ namespace LLGL
 
 GLSampler::GLSampler(const char* debugName)
 {
-    glGenSamplers(1, &id_);
+    #if LLGL_GLEXT_DIRECT_STATE_ACCESS
+    if (HasExtension(GLExt::ARB_direct_state_access))
+    {
+        /* Create sampler object without binding it (GL 4.5+) */
+        glCreateSamplers(1, &id_);
+    }
+    else
+    #endif // /LLGL_GLEXT_DIRECT_STATE_ACCESS
+    {
+        glGenSamplers(1, &id_);
+    }
     if (debugName != nullptr)
         SetDebugName(debugName);
 }
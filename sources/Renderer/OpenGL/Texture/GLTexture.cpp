@@ -7,6 +7,7 @@
 
 #include "GLTexture.h"
 #include "GLTextureViewPool.h"
+#include "GLBindlessTexturePool.h"
 #include "GLRenderbuffer.h"
 #include "GLMipGenerator.h"
 #include "GLEmulatedSampler.h"
@@ -16,12 +17,14 @@
 #include "../Ext/GLExtensions.h"
 #include "../Ext/GLExtensionRegistry.h"
 #include "../RenderState/GLStateManager.h"
+#include "../Buffer/GLBuffer.h"
 #include "../Texture/GLTexImage.h"
 #include "../Texture/GLTexSubImage.h"
 #include "../Texture/GLTextureSubImage.h"
 #include "../../TextureUtils.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../FormatTable.h"
 #include <LLGL/Format.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Backend/OpenGL/NativeHandle.h>
@@ -68,7 +71,7 @@ static GLSwizzleFormat MapToGLSwizzleFormat(const Format format)
     #ifdef LLGL_WEBGL
     return GLSwizzleFormat::RGBA; // WebGL does not support texture swizzling
     #else
-    const auto& formatDesc = GetFormatAttribs(format);
+    const auto& formatDesc = FormatTable::GetAttribs(format);
     if (formatDesc.format == ImageFormat::Alpha)
         return GLSwizzleFormat::Alpha;
     else if (formatDesc.format == ImageFormat::BGRA)
@@ -139,6 +142,7 @@ GLTexture::~GLTexture()
         /* Delete texture and notify state manager as well as texture-view pool since this could be the source for a texture-view */
         GLStateManager::Get().DeleteTexture(id_, GLStateManager::GetTextureTarget(GetType()));
         GLTextureViewPool::Get().NotifyTextureRelease(id_);
+        GLBindlessTexturePool::Get().NotifyTextureRelease(id_);
     }
 }
 
@@ -803,7 +807,7 @@ void GLTexture::CopyImageToBuffer(
     GLint                   imageHeight)
 {
     /* Get image format and data type from internal texture format */
-    const auto& formatAttribs = GetFormatAttribs(GetFormat());
+    const auto& formatAttribs = FormatTable::GetAttribs(GetFormat());
     LLGL_ASSERT(formatAttribs.dataType != DataType::Undefined, "failed to map GL internal texture format (0x%04X)", GetGLInternalFormat());
 
     /* Read data from unpack buffer with byte offset and equal texture format */
@@ -841,7 +845,7 @@ void GLTexture::CopyImageFromBuffer(
     GLint                   imageHeight)
 {
     /* Get image format and data type from internal texture format */
-    const auto& formatAttribs = GetFormatAttribs(GetFormat());
+    const auto& formatAttribs = FormatTable::GetAttribs(GetFormat());
 
     /* Read data from unpack buffer with byte offset and equal texture format */
     const ImageView srcImageView
@@ -1195,6 +1199,46 @@ void GLTexture::GetTextureSubImage(const TextureRegion& region, const MutableIma
                 GLGetTextureImage(*this, region, dstImageView);
         }
     }
+    else if (!IsMultiSampleTexture(GetType()))
+    {
+        /*
+        Renderbuffers can only be read via glReadPixels() from an intermediate read-FBO.
+        This also works with a bound pixel pack buffer, so the readback can be queued asynchronously.
+        Multi-sampled renderbuffers must be resolved first, which is not supported here.
+        */
+        const Offset3D offset = CalcTextureOffset(GetType(), region.offset, region.subresource.baseArrayLayer);
+        const Extent3D extent = CalcTextureExtent(GetType(), region.extent, region.subresource.numArrayLayers);
+        GLStateManager::Get().PushBoundFramebuffer(GLFramebufferTarget::ReadFramebuffer);
+        {
+            GLReadPixelsFromTexture(dstImageView, *this, 0, offset, extent);
+        }
+        GLStateManager::Get().PopBoundFramebuffer();
+    }
+}
+
+std::unique_ptr<GLBuffer> GLTexture::GetTextureSubImageAsync(const TextureRegion& region, const MutableImageView& dstImageView)
+{
+    /* Allocate pixel pack buffer that is only read once by the client */
+    const GLsizeiptr packBufferSize = static_cast<GLsizeiptr>(dstImageView.dataSize);
+    auto packBuffer = MakeUnique<GLBuffer>(BindFlags::CopyDst, "LLGL.PixelPackReadback");
+    packBuffer->BufferStorage(packBufferSize, nullptr, GL_MAP_READ_BIT, GL_STREAM_READ);
+
+    /* Read image sub data into the beginning of the pack buffer; This only queues the transfer, since the client memory is not accessed */
+    const MutableImageView packImageView
+    {
+        dstImageView.format,
+        dstImageView.dataType,
+        nullptr,
+        dstImageView.dataSize
+    };
+
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, packBuffer->GetID());
+    {
+        GetTextureSubImage(region, packImageView, false);
+    }
+    GLStateManager::Get().BindBuffer(GLBufferTarget::PixelPackBuffer, 0);
+
+    return packBuffer;
 }
 
 GLenum GLTexture::GetGLTexTarget() const
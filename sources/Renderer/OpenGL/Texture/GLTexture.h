@@ -11,6 +11,7 @@
 
 #include <LLGL/Texture.h>
 #include "../OpenGL.h"
+#include <memory>
 
 
 namespace LLGL
@@ -21,6 +22,7 @@ struct ImageView;
 struct MutableImageView;
 struct TextureViewDescriptor;
 class GLEmulatedSampler;
+class GLBuffer;
 
 // Predefined texture swizzles to emulate certain texture format
 enum class GLSwizzleFormat
@@ -86,6 +88,12 @@ class GLTexture final : public Texture
         // Reads the specified image data from a subregion of this texture.
         void GetTextureSubImage(const TextureRegion& region, const MutableImageView& dstImageView, bool restoreBoundTexture = true);
 
+        /*
+        Reads the specified image data from a subregion of this texture into a new pixel pack buffer (GL_PIXEL_PACK_BUFFER) without synchronizing the GL pipeline.
+        Only the format, data type, and size of the image view are used. The returned buffer must not be mapped before a subsequently submitted fence has been signaled.
+        */
+        std::unique_ptr<GLBuffer> GetTextureSubImageAsync(const TextureRegion& region, const MutableImageView& dstImageView);
+
         // Returns the GL_TEXTURE_TARGET parameter of this texture.
         GLenum GetGLTexTarget() const;
 
@@ -7,6 +7,7 @@
 
 #include "GLTextureViewPool.h"
 #include "GLTexture.h"
+#include "GLBindlessTexturePool.h"
 #include "../RenderState/GLStateManager.h"
 #include "../Profile/GLProfile.h"
 #include "../GLTypes.h"
@@ -23,6 +24,7 @@ namespace LLGL
 
 
 static constexpr std::size_t g_maxNumReusableTextureViews = 16;
+static constexpr std::size_t g_maxNumCachedTextureViews   = 64;
 
 GLTextureViewPool::~GLTextureViewPool()
 {
@@ -45,6 +47,7 @@ void GLTextureViewPool::Clear()
     }
     textureViews_.clear();
     numReusableEntries_ = 0;
+    numCachedEntries_   = 0;
 }
 
 GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureViewDescriptor& textureViewDesc, bool restoreBoundTexture)
@@ -95,23 +98,27 @@ GLuint GLTextureViewPool::CreateTextureView(GLuint sourceTexID, const TextureVie
 
 void GLTextureViewPool::ReleaseTextureView(GLuint texID)
 {
-    /* Try to find texture by GL texture ID only */
-    std::size_t insertionIndex = 0;
-    GLTextureView* sharedTexView = FindInSortedArray<GLTextureView>(
-        textureViews_.data(),
-        textureViews_.size(),
-        [texID](const GLTextureView& rhs)
+    if (texID == 0)
+        return;
+
+    /* Find texture by GL texture ID only; The container is sorted by source texture and view, so this must be a linear search */
+    auto it = std::find_if(
+        textureViews_.begin(),
+        textureViews_.end(),
+        [texID](const GLTextureView& entry)
         {
-            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(texID, rhs.texID);
-            return 0;
-        },
-        &insertionIndex
+            return (entry.texID == texID);
+        }
     );
 
-    if (sharedTexView != nullptr)
+    if (it != textureViews_.end())
     {
-        /* Delete GL texture view if the reference counter reaches 0 */
-        ReleaseSharedGLTextureView(*sharedTexView);
+        /* Move GL texture view into cache if the reference counter reaches 0 */
+        ReleaseSharedGLTextureView(*it);
+
+        /* Delete least-recently-used texture view once the cache is full */
+        if (numCachedEntries_ > g_maxNumCachedTextureViews)
+            EvictLeastRecentlyUsedTextureView();
 
         /* Remove unused entries in the array after a given amount has been freed */
         if (numReusableEntries_ > g_maxNumReusableTextureViews)
@@ -121,22 +128,25 @@ void GLTextureViewPool::ReleaseTextureView(GLuint texID)
 
 void GLTextureViewPool::NotifyTextureRelease(GLuint sourceTexID)
 {
-    /* Move all objects that are about to be removed at the end of the list using 'std::remove' */
-    auto it = std::remove_if(
-        textureViews_.begin(),
-        textureViews_.end(),
-        [sourceTexID](const GLTextureView& entry)
+    /* Delete all texture views derived from the specified texture */
+    for (GLTextureView& texView : textureViews_)
+    {
+        if (texView.sourceTexID == sourceTexID && texView.texID != 0)
         {
-            return (entry.texID == 0 || entry.sourceTexID == sourceTexID);
+            if (texView.refCount == 0)
+                --numCachedEntries_;
+            DeleteGLTextureView(texView);
         }
-    );
-
-    /* Iterate over all elements to be deleted */
-    for (; it != textureViews_.end(); ++it)
-        DeleteGLTextureView(*it);
+    }
 
-    /* Finally remove the entries from the list */
-    textureViews_.erase(it, textureViews_.end());
+    /* Remove all deleted entries from the list; The tail after 'std::remove_if' has unspecified content, so views must be deleted beforehand */
+    RemoveAllFromListIf(
+        textureViews_,
+        [](const GLTextureView& entry)
+        {
+            return (entry.texID == 0);
+        }
+    );
 
     /* Reset reusable entries, since we just deleted all unused entries */
     numReusableEntries_ = 0;
@@ -211,7 +221,12 @@ GLuint GLTextureViewPool::CreateGLTextureView(GLTextureView& texView, const Text
 {
     if (isSharedTex)
     {
-        if (texView.texID == 0)
+        if (texView.texID != 0 && texView.refCount == 0)
+        {
+            /* Reuse cached GL texture view */
+            --numCachedEntries_;
+        }
+        else if (texView.texID == 0)
         {
             /* Create new GL texture view if ID is invalid */
             GLuint texID = GenGLTextureView(texView.sourceTexID, textureViewDesc, restoreBoundTexture);
@@ -240,6 +255,7 @@ void GLTextureViewPool::DeleteGLTextureView(GLTextureView& texView)
 {
     /* Delete GL texture and reset ID to ensure it's cleaned up in FlushReusableTextureViews() */
     GLStateManager::Get().DeleteTexture(texView.texID, UncompressGLTextureTarget(texView.view.type));
+    GLBindlessTexturePool::Get().NotifyTextureRelease(texView.texID);
     texView.texID = 0;
 }
 
@@ -261,8 +277,9 @@ void GLTextureViewPool::ReleaseSharedGLTextureView(GLTextureView& texView)
         texView.refCount--;
         if (texView.refCount == 0)
         {
-            DeleteGLTextureView(texView);
-            ++numReusableEntries_;
+            /* Keep GL texture view alive until it is evicted from the cache */
+            texView.lastUse = ++useTick_;
+            ++numCachedEntries_;
         }
     }
 }
@@ -282,6 +299,27 @@ void GLTextureViewPool::FlushReusableTextureViews()
     }
 }
 
+void GLTextureViewPool::EvictLeastRecentlyUsedTextureView()
+{
+    /* Find cached texture view with the oldest release tick */
+    GLTextureView* lruTexView = nullptr;
+    for (GLTextureView& texView : textureViews_)
+    {
+        if (texView.texID != 0 && texView.refCount == 0)
+        {
+            if (lruTexView == nullptr || texView.lastUse < lruTexView->lastUse)
+                lruTexView = &texView;
+        }
+    }
+
+    if (lruTexView != nullptr)
+    {
+        DeleteGLTextureView(*lruTexView);
+        --numCachedEntries_;
+        ++numReusableEntries_;
+    }
+}
+
 
 } // /namespace LLGL
 
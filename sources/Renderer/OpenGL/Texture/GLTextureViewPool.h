@@ -20,7 +20,11 @@ namespace LLGL
 {
 
 
-// Class to manage create/reuse/delete of GL texture views; used by <GLResourceHeap>
+/*
+Class to manage create/reuse/delete of GL texture views; used by <GLResourceHeap>.
+Texture views that are no longer referenced are kept alive in a bounded cache and evicted in least-recently-used order,
+so that descriptors which are rewritten every frame don't re-create the same GL texture views.
+*/
 class GLTextureViewPool
 {
 
@@ -69,6 +73,7 @@ class GLTextureViewPool
             GLuint              texID       = 0;
             GLuint              sourceTexID = 0;
             GLuint              refCount    = 0;
+            std::uint64_t       lastUse     = 0; // Tick of the last release; used to evict the least-recently-used cached texture view
             CompressedTexView   view        = {};
         };
 
@@ -90,6 +95,9 @@ class GLTextureViewPool
         // Removes all empty entries from the texture view list.
         void FlushReusableTextureViews();
 
+        // Deletes the least-recently-used texture view that is no longer referenced.
+        void EvictLeastRecentlyUsedTextureView();
+
     private:
 
         // Container of all managed texture views.
@@ -98,6 +106,12 @@ class GLTextureViewPool
         // Number of textures that are already freed, but not removed from the texture view array yet.
         std::size_t                 numReusableEntries_ = 0;
 
+        // Number of texture views that are no longer referenced but still alive for reuse.
+        std::size_t                 numCachedEntries_   = 0;
+
+        // Counter to determine the least-recently-used cached texture view.
+        std::uint64_t               useTick_            = 0;
+
 };
 
 
@@ -0,0 +1,171 @@
+/*
+ * PipelineCacheStore.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "PipelineCacheStore.h"
+#include "../Core/HashUtils.h"
+#include "../Platform/Path.h"
+#include <LLGL/Container/DynamicArray.h>
+#include <stdio.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+#include "../Core/PackStructPush.inl"
+
+struct PipelineCacheStoreHeader
+{
+    char            magic[4];
+    std::uint32_t   version;
+    std::uint32_t   cacheIDSize;
+    std::uint32_t   reserved;
+    std::uint64_t   key;
+    std::uint64_t   dataSize;
+    std::uint64_t   dataHash;
+}
+LLGL_PACK_STRUCT;
+
+#include "../Core/PackStructPop.inl"
+
+static const char          g_storeMagic[4] = { 'L', 'L', 'P', 'C' };
+static const std::uint32_t g_storeVersion  = 1;
+
+static std::string KeyToHexString(std::uint64_t key)
+{
+    char str[17] = {};
+    ::snprintf(str, sizeof(str), "%016llx", static_cast<unsigned long long>(key));
+    return str;
+}
+
+void PipelineCacheStore::SetDirectory(const char* directory)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    rootDir_ = (directory != nullptr ? directory : "");
+    cacheDir_.clear();
+    isOpen_ = false;
+}
+
+void PipelineCacheStore::Open(const std::vector<char>& cacheID)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (rootDir_.empty() || isOpen_)
+        return;
+
+    /* Store entries in a sub-directory per cache ID, so a driver update starts with a new set of entries */
+    cacheID_    = cacheID;
+    cacheDir_   = Path::Combine(rootDir_, KeyToHexString(GetHash(cacheID.data(), cacheID.size()))).c_str();
+    isOpen_     = Path::MakeDirectories(cacheDir_);
+}
+
+Blob PipelineCacheStore::Read(std::uint64_t key) const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (!isOpen_)
+        return Blob{};
+
+    const std::string filename = GetFilename(key);
+    FILE* file = ::fopen(filename.c_str(), "rb");
+    if (file == nullptr)
+        return Blob{};
+
+    /* Validate header and cache ID; entries from a different device or driver version are treated as cache misses */
+    Blob blob;
+    PipelineCacheStoreHeader header;
+    if (::fread(&header, sizeof(header), 1, file) == 1 &&
+        ::memcmp(header.magic, g_storeMagic, sizeof(g_storeMagic)) == 0 &&
+        header.version      == g_storeVersion &&
+        header.cacheIDSize  == cacheID_.size() &&
+        header.key          == key)
+    {
+        std::vector<char> cacheID(cacheID_.size());
+        if (cacheID.empty() || ::fread(cacheID.data(), cacheID.size(), 1, file) == 1)
+        {
+            if (cacheID == cacheID_ && header.dataSize > 0)
+            {
+                DynamicByteArray data{ static_cast<std::size_t>(header.dataSize), UninitializeTag{} };
+                if (::fread(data.get(), data.size(), 1, file) == 1 && GetHash(data.get(), data.size()) == header.dataHash)
+                    blob = Blob::CreateStrongRef(std::move(data));
+            }
+        }
+    }
+
+    ::fclose(file);
+    return blob;
+}
+
+void PipelineCacheStore::Write(std::uint64_t key, const void* data, std::size_t size)
+{
+    if (data == nullptr || size == 0)
+        return;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (!isOpen_)
+        return;
+
+    PipelineCacheStoreHeader header;
+    {
+        ::memcpy(header.magic, g_storeMagic, sizeof(g_storeMagic));
+        header.version      = g_storeVersion;
+        header.cacheIDSize  = static_cast<std::uint32_t>(cacheID_.size());
+        header.reserved     = 0;
+        header.key          = key;
+        header.dataSize     = static_cast<std::uint64_t>(size);
+        header.dataHash     = GetHash(data, size);
+    }
+
+    /* Write into temporary file first, so concurrent readers and crashed writes never observe partial entries */
+    const std::string filename      = GetFilename(key);
+    const std::string tempFilename  = filename + ".tmp";
+
+    FILE* file = ::fopen(tempFilename.c_str(), "wb");
+    if (file == nullptr)
+        return;
+
+    const bool succeeded =
+    (
+        ::fwrite(&header, sizeof(header), 1, file) == 1 &&
+        (cacheID_.empty() || ::fwrite(cacheID_.data(), cacheID_.size(), 1, file) == 1) &&
+        ::fwrite(data, size, 1, file) == 1
+    );
+
+    if (::fclose(file) == 0 && succeeded)
+    {
+        /* Replace previous entry; std::rename() does not overwrite existing files on all platforms */
+        ::remove(filename.c_str());
+        ::rename(tempFilename.c_str(), filename.c_str());
+    }
+    else
+        ::remove(tempFilename.c_str());
+}
+
+void PipelineCacheStore::Write(std::uint64_t key, const Blob& blob)
+{
+    if (blob)
+        Write(key, blob.GetData(), blob.GetSize());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+std::string PipelineCacheStore::GetFilename(std::uint64_t key) const
+{
+    return Path::Combine(cacheDir_, KeyToHexString(key) + ".bin").c_str();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,89 @@
+/*
+ * PipelineCacheStore.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PIPELINE_CACHE_STORE_H
+#define LLGL_PIPELINE_CACHE_STORE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Blob.h>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Persistent store for pipeline cache blobs, see RenderSystemDescriptor::pipelineCacheDirectory.
+Each blob is stored in its own file inside a sub-directory that is named after the hash of the renderer's pipeline cache ID (see RendererInfo::pipelineCacheID).
+Each file additionally stores the entire cache ID, so blobs from a different driver or device are never handed to the backend.
+*/
+class LLGL_EXPORT PipelineCacheStore
+{
+
+    public:
+
+        PipelineCacheStore() = default;
+
+        PipelineCacheStore(const PipelineCacheStore&) = delete;
+        PipelineCacheStore& operator = (const PipelineCacheStore&) = delete;
+
+        // Sets the root directory of this store. A null pointer or empty string disables this store.
+        void SetDirectory(const char* directory);
+
+        // Binds this store to the specified pipeline cache ID and creates its sub-directory. Does nothing if this store is disabled.
+        void Open(const std::vector<char>& cacheID);
+
+        // Returns true if a root directory was specified.
+        inline bool IsEnabled() const
+        {
+            return !rootDir_.empty();
+        }
+
+        // Returns true if this store has been opened successfully and can be read from and written to.
+        inline bool IsOpen() const
+        {
+            return isOpen_;
+        }
+
+        // Returns the blob that was stored with the specified key or an empty blob if there is no valid entry.
+        Blob Read(std::uint64_t key) const;
+
+        // Stores the specified data with the specified key. Existing entries for this key are replaced.
+        void Write(std::uint64_t key, const void* data, std::size_t size);
+
+        // Stores the specified blob with the specified key. Empty blobs are ignored.
+        void Write(std::uint64_t key, const Blob& blob);
+
+    private:
+
+        // Returns the filename for the specified key.
+        std::string GetFilename(std::uint64_t key) const;
+
+    private:
+
+        std::string         rootDir_;
+        std::string         cacheDir_;
+        std::vector<char>   cacheID_;
+        bool                isOpen_     = false;
+        mutable std::mutex  mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
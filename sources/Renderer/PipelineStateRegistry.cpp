@@ -0,0 +1,295 @@
+/*
+ * PipelineStateRegistry.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/PipelineStateRegistry.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/PipelineState.h>
+#include <LLGL/Report.h>
+#include "../Core/HashUtils.h"
+#include "../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Appends the bytes of the specified value to the descriptor key. Structures are appended field by field, so padding bytes never end up in the key.
+template <typename T>
+void AppendKey(std::vector<char>& key, const T& value)
+{
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    key.insert(key.end(), bytes, bytes + sizeof(T));
+}
+
+static void AppendKey(std::vector<char>& key, const StencilFaceDescriptor& desc)
+{
+    AppendKey(key, desc.stencilFailOp);
+    AppendKey(key, desc.depthFailOp);
+    AppendKey(key, desc.depthPassOp);
+    AppendKey(key, desc.compareOp);
+    AppendKey(key, desc.readMask);
+    AppendKey(key, desc.writeMask);
+    AppendKey(key, desc.reference);
+}
+
+static void AppendKey(std::vector<char>& key, const BlendTargetDescriptor& desc)
+{
+    AppendKey(key, desc.blendEnabled);
+    AppendKey(key, desc.srcColor);
+    AppendKey(key, desc.dstColor);
+    AppendKey(key, desc.colorArithmetic);
+    AppendKey(key, desc.srcAlpha);
+    AppendKey(key, desc.dstAlpha);
+    AppendKey(key, desc.alphaArithmetic);
+    AppendKey(key, desc.colorMask);
+}
+
+static void AppendKey(std::vector<char>& key, const Viewport& viewport)
+{
+    AppendKey(key, viewport.x);
+    AppendKey(key, viewport.y);
+    AppendKey(key, viewport.width);
+    AppendKey(key, viewport.height);
+    AppendKey(key, viewport.minDepth);
+    AppendKey(key, viewport.maxDepth);
+}
+
+static void AppendKey(std::vector<char>& key, const Scissor& scissor)
+{
+    AppendKey(key, scissor.x);
+    AppendKey(key, scissor.y);
+    AppendKey(key, scissor.width);
+    AppendKey(key, scissor.height);
+}
+
+static void AppendKey(std::vector<char>& key, const SpecializationConstant& constant)
+{
+    AppendKey(key, constant.id);
+    AppendKey(key, constant.value);
+}
+
+template <typename T>
+void AppendKeyArray(std::vector<char>& key, const std::vector<T>& values)
+{
+    AppendKey(key, values.size());
+    for (const T& value : values)
+        AppendKey(key, value);
+}
+
+static std::vector<char> GetPipelineStateKey(const GraphicsPipelineDescriptor& desc)
+{
+    std::vector<char> key;
+    key.reserve(256);
+
+    /* Append object identities; The debug name is not part of the key */
+    AppendKey(key, desc.flags);
+    AppendKey(key, desc.pipelineLayout);
+    AppendKey(key, desc.renderPass);
+    AppendKey(key, desc.vertexShader);
+    AppendKey(key, desc.tessControlShader);
+    AppendKey(key, desc.tessEvaluationShader);
+    AppendKey(key, desc.geometryShader);
+    AppendKey(key, desc.taskShader);
+    AppendKey(key, desc.meshShader);
+    AppendKey(key, desc.tileShader);
+    AppendKey(key, desc.fragmentShader);
+    AppendKey(key, desc.indexFormat);
+    AppendKey(key, desc.primitiveTopology);
+
+    /* Append static viewports and scissors */
+    AppendKeyArray(key, desc.viewports);
+    AppendKeyArray(key, desc.scissors);
+
+    /* Append depth-stencil states */
+    AppendKey(key, desc.depth.testEnabled);
+    AppendKey(key, desc.depth.writeEnabled);
+    AppendKey(key, desc.depth.compareOp);
+    AppendKey(key, desc.stencil.testEnabled);
+    AppendKey(key, desc.stencil.referenceDynamic);
+    AppendKey(key, desc.stencil.front);
+    AppendKey(key, desc.stencil.back);
+
+    /* Append rasterizer states */
+    AppendKey(key, desc.rasterizer.polygonMode);
+    AppendKey(key, desc.rasterizer.cullMode);
+    AppendKey(key, desc.rasterizer.depthBias.constantFactor);
+    AppendKey(key, desc.rasterizer.depthBias.slopeFactor);
+    AppendKey(key, desc.rasterizer.depthBias.clamp);
+    AppendKey(key, desc.rasterizer.frontCCW);
+    AppendKey(key, desc.rasterizer.discardEnabled);
+    AppendKey(key, desc.rasterizer.depthClampEnabled);
+    AppendKey(key, desc.rasterizer.scissorTestEnabled);
+    AppendKey(key, desc.rasterizer.multiSampleEnabled);
+    AppendKey(key, desc.rasterizer.antiAliasedLineEnabled);
+    AppendKey(key, desc.rasterizer.conservativeRasterization);
+    AppendKey(key, desc.rasterizer.lineWidth);
+
+    /* Append blend states; Only the first target is considered if independent blending is disabled */
+    AppendKey(key, desc.blend.alphaToCoverageEnabled);
+    AppendKey(key, desc.blend.independentBlendEnabled);
+    AppendKey(key, desc.blend.sampleMask);
+    AppendKey(key, desc.blend.logicOp);
+    AppendKey(key, desc.blend.blendFactor);
+    AppendKey(key, desc.blend.blendFactorDynamic);
+
+    const std::size_t numBlendTargets = (desc.blend.independentBlendEnabled ? LLGL_MAX_NUM_COLOR_ATTACHMENTS : 1);
+    for (std::size_t i = 0; i < numBlendTargets; ++i)
+        AppendKey(key, desc.blend.targets[i]);
+
+    /* Append tessellation states */
+    AppendKey(key, desc.tessellation.partition);
+    AppendKey(key, desc.tessellation.maxTessFactor);
+    AppendKey(key, desc.tessellation.outputWindingCCW);
+
+    /* Append specialization constants */
+    AppendKeyArray(key, desc.specializationConstants);
+
+    return key;
+}
+
+static std::vector<char> GetPipelineStateKey(const ComputePipelineDescriptor& desc)
+{
+    std::vector<char> key;
+    AppendKey(key, desc.flags);
+    AppendKey(key, desc.pipelineLayout);
+    AppendKey(key, desc.computeShader);
+    AppendKeyArray(key, desc.specializationConstants);
+    return key;
+}
+
+static bool HasPipelineStateErrors(const PipelineState& pipelineState)
+{
+    const Report* report = pipelineState.GetReport();
+    return (report != nullptr && report->HasErrors());
+}
+
+
+/*
+ * PipelineStateRegistry class
+ */
+
+PipelineStateRegistry::PipelineStateRegistry(RenderSystem& renderer) :
+    renderer_ { renderer }
+{
+}
+
+PipelineStateRegistry::~PipelineStateRegistry()
+{
+    for (auto& it : entries_)
+        renderer_.Release(*(it.second.pipelineState));
+}
+
+PipelineState* PipelineStateRegistry::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    return FindOrCreatePipelineState(
+        GetPipelineStateKey(pipelineStateDesc),
+        [this, &pipelineStateDesc, pipelineCache]() -> PipelineState*
+        {
+            return renderer_.CreatePipelineState(pipelineStateDesc, pipelineCache);
+        }
+    );
+}
+
+PipelineState* PipelineStateRegistry::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    return FindOrCreatePipelineState(
+        GetPipelineStateKey(pipelineStateDesc),
+        [this, &pipelineStateDesc, pipelineCache]() -> PipelineState*
+        {
+            return renderer_.CreatePipelineState(pipelineStateDesc, pipelineCache);
+        }
+    );
+}
+
+void PipelineStateRegistry::Release(PipelineState& pipelineState)
+{
+    auto hashIt = hashes_.find(&pipelineState);
+    if (hashIt == hashes_.end())
+    {
+        /* Release pipeline state that was not registered, e.g. because it failed to compile */
+        renderer_.Release(pipelineState);
+        return;
+    }
+
+    auto range = entries_.equal_range(hashIt->second);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        Entry& entry = it->second;
+        if (entry.pipelineState == &pipelineState)
+        {
+            LLGL_ASSERT(entry.refCount > 0);
+            if (--entry.refCount == 0)
+            {
+                renderer_.Release(pipelineState);
+                entries_.erase(it);
+                hashes_.erase(hashIt);
+                --statistics_.numPipelineStates;
+            }
+            return;
+        }
+    }
+}
+
+void PipelineStateRegistry::ResetStatistics()
+{
+    statistics_.numHits     = 0;
+    statistics_.numMisses   = 0;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+template <typename TCreateFunc>
+PipelineState* PipelineStateRegistry::FindOrCreatePipelineState(std::vector<char>&& key, const TCreateFunc& createFunc)
+{
+    const std::uint64_t hash = GetHash(key.data(), key.size());
+
+    /* Return existing pipeline state if the keys match, since hash collisions are possible */
+    auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        Entry& entry = it->second;
+        if (entry.key == key)
+        {
+            ++entry.refCount;
+            ++statistics_.numHits;
+            return entry.pipelineState;
+        }
+    }
+
+    /* Create new pipeline state and only register it if it was compiled successfully */
+    ++statistics_.numMisses;
+
+    PipelineState* pipelineState = createFunc();
+    if (pipelineState == nullptr || HasPipelineStateErrors(*pipelineState))
+        return pipelineState;
+
+    Entry newEntry;
+    {
+        newEntry.key            = std::move(key);
+        newEntry.pipelineState  = pipelineState;
+        newEntry.refCount       = 1;
+    }
+    entries_.emplace(hash, std::move(newEntry));
+    hashes_[pipelineState] = hash;
+    ++statistics_.numPipelineStates;
+
+    return pipelineState;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
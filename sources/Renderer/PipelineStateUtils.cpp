@@ -109,6 +109,9 @@ LLGL_EXPORT SmallVector<Shader*, 5> GetShadersAsArray(const GraphicsPipelineDesc
     AddShaderIfSet(shaders, desc.tessControlShader);
     AddShaderIfSet(shaders, desc.tessEvaluationShader);
     AddShaderIfSet(shaders, desc.geometryShader);
+    AddShaderIfSet(shaders, desc.taskShader);
+    AddShaderIfSet(shaders, desc.meshShader);
+    AddShaderIfSet(shaders, desc.tileShader);
     AddShaderIfSet(shaders, desc.fragmentShader);
     return shaders;
 }
@@ -120,6 +123,27 @@ LLGL_EXPORT SmallVector<Shader*, 1> GetShadersAsArray(const ComputePipelineDescr
     return shaders;
 }
 
+template <std::size_t N>
+inline void AddUniqueShaderIfSet(SmallVector<Shader*, N>& shaders, Shader* sh)
+{
+    if (sh != nullptr && std::find(shaders.begin(), shaders.end(), sh) == shaders.end())
+        shaders.push_back(sh);
+};
+
+LLGL_EXPORT SmallVector<Shader*, 8> GetShadersAsArray(const RayTracingPipelineDescriptor& desc)
+{
+    SmallVector<Shader*, 8> shaders;
+    AddUniqueShaderIfSet(shaders, desc.rayGenerationShader);
+    for (Shader* missShader : desc.missShaders)
+        AddUniqueShaderIfSet(shaders, missShader);
+    for (const RayTracingHitGroupDescriptor& hitGroup : desc.hitGroups)
+    {
+        AddUniqueShaderIfSet(shaders, hitGroup.closestHitShader);
+        AddUniqueShaderIfSet(shaders, hitGroup.anyHitShader);
+    }
+    return shaders;
+}
+
 static std::uint32_t GetUniformBaseTypeSize(UniformType type)
 {
     switch (type)
@@ -46,6 +46,9 @@ LLGL_EXPORT SmallVector<Shader*, 5> GetShadersAsArray(const GraphicsPipelineDesc
 // Returns the set of compute PSO shaders as array.
 LLGL_EXPORT SmallVector<Shader*, 1> GetShadersAsArray(const ComputePipelineDescriptor& desc);
 
+// Returns the set of ray tracing PSO shaders as array. Shaders that are referenced by multiple hit groups are only added once.
+LLGL_EXPORT SmallVector<Shader*, 8> GetShadersAsArray(const RayTracingPipelineDescriptor& desc);
+
 // Returns the size (in bytes) of the specified uniform with optional array size. This includes padding between array elements.
 LLGL_EXPORT std::uint32_t GetUniformTypeSize(UniformType type, std::uint32_t arraySize = 0);
 
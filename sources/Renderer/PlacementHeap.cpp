@@ -0,0 +1,25 @@
+/*
+ * PlacementHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/PlacementHeap.h>
+
+
+namespace LLGL
+{
+
+
+PlacementHeap::PlacementHeap(std::uint64_t size) :
+    size_ { size }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
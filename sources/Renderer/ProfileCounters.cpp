@@ -0,0 +1,45 @@
+/*
+ * ProfileCounters.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ProfileCounters.h"
+
+
+namespace LLGL
+{
+
+
+LLGL_EXPORT ProfileCounters& GetProfileCounters()
+{
+    static ProfileCounters counters;
+    return counters;
+}
+
+LLGL_EXPORT void EnableProfileCounters(bool enable)
+{
+    ProfileCounters& counters = GetProfileCounters();
+    if (enable)
+        counters.numListeners.fetch_add(1);
+    else
+        counters.numListeners.fetch_sub(1);
+}
+
+LLGL_EXPORT void FlushProfileCounters(ProfileBackendRecord& outRecord)
+{
+    ProfileCounters& counters = GetProfileCounters();
+    outRecord.redundantStateChanges     = counters.redundantStateChanges.exchange(0);
+    outRecord.descriptorCopies          = counters.descriptorCopies.exchange(0);
+    outRecord.descriptorSetAllocations  = counters.descriptorSetAllocations.exchange(0);
+    outRecord.barriers                  = counters.barriers.exchange(0);
+    outRecord.stagingUploadBytes        = counters.stagingUploadBytes.exchange(0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,71 @@
+/*
+ * ProfileCounters.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_PROFILE_COUNTERS_H
+#define LLGL_PROFILE_COUNTERS_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/RenderingDebuggerFlags.h>
+#include <atomic>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Global counters for the work the backends actually do after filtering redundant calls.
+The counters are only incremented while at least one debug layer is active, which flushes them into FrameProfile::backendRecord.
+*/
+struct ProfileCounters
+{
+    std::atomic<std::uint32_t>  numListeners                { 0 };
+    std::atomic<std::uint32_t>  redundantStateChanges       { 0 };
+    std::atomic<std::uint32_t>  descriptorCopies            { 0 };
+    std::atomic<std::uint32_t>  descriptorSetAllocations    { 0 };
+    std::atomic<std::uint32_t>  barriers                    { 0 };
+    std::atomic<std::uint64_t>  stagingUploadBytes          { 0 };
+};
+
+// Returns the global profile counters that are shared between all backends.
+LLGL_EXPORT ProfileCounters& GetProfileCounters();
+
+// Enables or disables the global profile counters for one listener. The counters are recorded while there is at least one listener.
+LLGL_EXPORT void EnableProfileCounters(bool enable);
+
+// Moves the current values of the global profile counters into the specified record and resets them to zero.
+LLGL_EXPORT void FlushProfileCounters(ProfileBackendRecord& outRecord);
+
+#ifdef LLGL_ENABLE_DEBUG_LAYER
+
+// Adds the specified value to a global profile counter if the counters are enabled; see ProfileCounters.
+#define LLGL_PROFILE_COUNTER_ADD(NAME, VALUE)                                                           \
+    do                                                                                                  \
+    {                                                                                                   \
+        static LLGL::ProfileCounters& profileCounters = LLGL::GetProfileCounters();                     \
+        if (profileCounters.numListeners.load(std::memory_order_relaxed) > 0)                           \
+            profileCounters.NAME.fetch_add((VALUE), std::memory_order_relaxed);                         \
+    }                                                                                                   \
+    while (false)
+
+#else
+
+#define LLGL_PROFILE_COUNTER_ADD(NAME, VALUE) ((void)0)
+
+#endif // /LLGL_ENABLE_DEBUG_LAYER
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
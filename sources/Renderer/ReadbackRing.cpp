@@ -0,0 +1,173 @@
+/*
+ * ReadbackRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/ReadbackRing.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/Format.h>
+#include "../Core/CoreUtils.h"
+#include "../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Alignment of readbacks within a frame buffer. Texture copies into buffers have the strictest alignment requirement
+with 512 bytes for D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, but buffer copies only need to be aligned to the largest texel size.
+*/
+static constexpr std::uint64_t g_readbackBufferAlignment    = 16;
+static constexpr std::uint64_t g_readbackTextureAlignment   = 512;
+
+ReadbackRing::ReadbackRing(RenderSystem& renderer, std::uint64_t frameSize, std::uint32_t numFrames) :
+    renderer_     { renderer                    },
+    commandQueue_ { renderer.GetCommandQueue()  },
+    frameSize_    { frameSize                   }
+{
+    LLGL_ASSERT(numFrames > 0, "number of frames in readback ring must be greater than zero");
+    frames_.resize(numFrames);
+
+    /* Create CPU-readable buffers that can be mapped without intermediate copies */
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.debugName        = "LLGL.ReadbackRing";
+        bufferDesc.size             = frameSize;
+        bufferDesc.bindFlags        = BindFlags::CopyDst;
+        bufferDesc.cpuAccessFlags   = CPUAccessFlags::Read;
+        if (renderer.GetRenderingCaps().features.hasPersistentMapping)
+            bufferDesc.miscFlags    = MiscFlags::PersistentMapping;
+    }
+
+    for (Frame& frame : frames_)
+    {
+        frame.buffer    = renderer.CreateBuffer(bufferDesc);
+        frame.fence     = renderer.CreateFence();
+    }
+
+    frames_[currentFrame_ % frames_.size()].index = currentFrame_;
+}
+
+ReadbackRing::~ReadbackRing()
+{
+    for (Frame& frame : frames_)
+    {
+        /* Wait until the GPU no longer writes into the readback buffer before it is released */
+        if (frame.submitted)
+            commandQueue_->WaitFence(*frame.fence, ~0ull);
+        renderer_.Release(*frame.buffer);
+        renderer_.Release(*frame.fence);
+    }
+}
+
+ReadbackTicket ReadbackRing::ReadBuffer(CommandBuffer& cmdBuffer, Buffer& srcBuffer, std::uint64_t srcOffset, std::uint64_t size)
+{
+    Frame& frame = frames_[currentFrame_ % frames_.size()];
+    frame.offset = GetAlignedSize(frame.offset, g_readbackBufferAlignment);
+
+    const ReadbackTicket ticket = Allocate(size);
+    if (ticket.frame != 0)
+        cmdBuffer.CopyBuffer(*frame.buffer, ticket.offset, srcBuffer, srcOffset, size);
+
+    return ticket;
+}
+
+ReadbackTicket ReadbackRing::ReadTexture(CommandBuffer& cmdBuffer, Texture& srcTexture, const TextureRegion& srcRegion)
+{
+    Frame& frame = frames_[currentFrame_ % frames_.size()];
+    frame.offset = GetAlignedSize(frame.offset, g_readbackTextureAlignment);
+
+    /* Determine size of tightly packed texture data */
+    const Extent3D&     extent      = srcRegion.extent;
+    const std::size_t   numTexels   = extent.width * extent.height * extent.depth * srcRegion.subresource.numArrayLayers;
+    const std::uint64_t size        = GetMemoryFootprint(srcTexture.GetFormat(), numTexels);
+
+    const ReadbackTicket ticket = Allocate(size);
+    if (ticket.frame != 0)
+        cmdBuffer.CopyBufferFromTexture(*frame.buffer, ticket.offset, srcTexture, srcRegion);
+
+    return ticket;
+}
+
+void ReadbackRing::Submit()
+{
+    /* Signal fence once the GPU has finished all readbacks of the current frame */
+    Frame& frame = frames_[currentFrame_ % frames_.size()];
+    commandQueue_->Submit(*frame.fence);
+    frame.submitted = true;
+
+    /* Advance to the next frame and recycle its buffer; this only blocks if the GPU is more than N frames behind */
+    ++currentFrame_;
+
+    Frame& nextFrame = frames_[currentFrame_ % frames_.size()];
+    if (nextFrame.submitted)
+        commandQueue_->WaitFence(*nextFrame.fence, ~0ull);
+
+    nextFrame.index     = currentFrame_;
+    nextFrame.offset    = 0;
+    nextFrame.submitted = false;
+}
+
+bool ReadbackRing::IsReady(const ReadbackTicket& ticket) const
+{
+    if (const Frame* frame = FindFrame(ticket))
+        return (frame->submitted && frame->fence->IsSignaled());
+    return false;
+}
+
+const void* ReadbackRing::Map(const ReadbackTicket& ticket)
+{
+    if (!IsReady(ticket))
+        return nullptr;
+    const Frame* frame = FindFrame(ticket);
+    return renderer_.MapBuffer(*frame->buffer, CPUAccess::ReadOnly, ticket.offset, ticket.size);
+}
+
+void ReadbackRing::Unmap(const ReadbackTicket& ticket)
+{
+    if (const Frame* frame = FindFrame(ticket))
+        renderer_.UnmapBuffer(*frame->buffer);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+ReadbackTicket ReadbackRing::Allocate(std::uint64_t size)
+{
+    ReadbackTicket ticket;
+
+    Frame& frame = frames_[currentFrame_ % frames_.size()];
+    if (size > 0 && frame.offset + size <= frameSize_)
+    {
+        ticket.frame    = currentFrame_;
+        ticket.offset   = frame.offset;
+        ticket.size     = size;
+        frame.offset    += size;
+    }
+
+    return ticket;
+}
+
+const ReadbackRing::Frame* ReadbackRing::FindFrame(const ReadbackTicket& ticket) const
+{
+    if (ticket.frame == 0)
+        return nullptr;
+
+    /* Frame buffer has already been recycled if its index does not match the ticket anymore */
+    const Frame& frame = frames_[ticket.frame % frames_.size()];
+    return (frame.index == ticket.frame ? &frame : nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,858 @@
+/*
+ * RenderGraph.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/RenderGraph.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/CommandQueue.h>
+#include <LLGL/PlacementHeap.h>
+#include <LLGL/Utils/ForRange.h>
+#include "../Core/CoreUtils.h"
+#include "../Core/Assertion.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+struct RenderGraph::Pimpl
+{
+    struct ResourceEntry
+    {
+        Buffer*             buffer              = nullptr;
+        Texture*            texture             = nullptr;
+        bool                isTransient         = false;
+        TextureDescriptor   textureDesc;
+        std::string         debugName;
+
+        std::uint32_t       firstPass           = ~0u;      // First pass that accesses this resource and has not been culled.
+        std::uint32_t       lastPass            = 0;        // Last pass that accesses this resource and has not been culled.
+        bool                isAsyncAccessed     = false;    // True if any pass on a dedicated compute or copy queue accesses this resource.
+        bool                isPlaced            = false;    // True if this transient texture shares the memory of the placement heap.
+        std::uint32_t       aliasPredecessor    = ~0u;      // Resource that used the same memory before this one.
+    };
+
+    struct Access
+    {
+        std::uint32_t       resource;
+        RenderGraphAccess   access;
+        bool                isWrite;
+    };
+
+    struct PassEntry
+    {
+        std::string                 name;
+        ExecuteFunction             execute;
+        CommandQueueType            queueType           = CommandQueueType::Graphics;
+        std::vector<Access>         accesses;
+        bool                        hasSideEffects      = false;
+
+        bool                        isCulled            = false;
+        bool                        signalsFence        = false;    // True if a pass on another queue waits for this pass.
+        std::vector<std::uint32_t>  waitPasses;                     // Passes on other queues this pass has to wait for.
+        std::vector<std::uint32_t>  barrierResources;               // Resources that require a barrier after a storage write.
+        std::vector<std::uint32_t>  aliasedResources;               // Transient textures that take over their memory in this pass.
+    };
+
+    struct PooledTexture
+    {
+        TextureDescriptor   desc;
+        Texture*            texture     = nullptr;
+        std::uint32_t       lastPass    = 0;
+        bool                isUsed      = false;
+    };
+
+    struct PlacedTexture
+    {
+        TextureDescriptor   desc;
+        std::uint64_t       offset      = 0;
+        Texture*            texture     = nullptr;
+    };
+
+    struct QueueState
+    {
+        CommandQueueType                type            = CommandQueueType::Graphics;
+        CommandQueue*                   queue           = nullptr;
+        std::vector<CommandBuffer*>     cmdBuffers;
+        std::size_t                     numUsedBuffers  = 0;
+        CommandBuffer*                  openCmdBuffer   = nullptr;
+    };
+
+    explicit Pimpl(RenderSystem& renderer) :
+        renderer { renderer }
+    {
+    }
+
+    RenderSystem&               renderer;
+    std::vector<ResourceEntry>  resources;
+    std::vector<PassEntry>      passes;
+    bool                        isCompiled      = false;
+
+    std::vector<PooledTexture>  pooledTextures;
+    std::vector<PlacedTexture>  placedTextures;
+    PlacementHeap*              placementHeap   = nullptr;
+
+    QueueState                  queueStates[3];
+    std::vector<Fence*>         fences;
+    std::vector<Fence*>         passFences;
+    std::size_t                 numUsedFences   = 0;
+
+    // Waits until all queues have finished and releases all transient textures, command buffers, and fences.
+    void ReleaseObjects();
+
+    void Compile();
+    void Execute();
+
+    // Returns the queue type that is used for the specified queue type, i.e. the graphics queue if there is no dedicated queue.
+    CommandQueueType ResolveQueueType(const CommandQueueType queueType) const;
+
+    void CullPasses();
+    void ComputeLifetimes();
+    void ComputeBarriers();
+    void AllocateTransientTextures();
+    void AllocatePooledTextures();
+    void AllocatePlacedTextures();
+    void ReleasePlacedTextures();
+
+    QueueState& GetQueueState(const CommandQueueType queueType);
+    CommandBuffer& BeginCommandBuffer(QueueState& queueState, const std::string& name);
+    void SubmitCommandBuffer(QueueState& queueState);
+    Fence* AcquireFence();
+};
+
+RenderGraph::RenderGraph(RenderSystem& renderer) :
+    pimpl_ { new Pimpl{ renderer } }
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+    pimpl_->ReleaseObjects();
+    delete pimpl_;
+}
+
+RenderGraphResource RenderGraph::ImportBuffer(Buffer& buffer)
+{
+    Pimpl::ResourceEntry entry;
+    entry.buffer = &buffer;
+    pimpl_->resources.push_back(entry);
+    pimpl_->isCompiled = false;
+    RenderGraphResource handle;
+    handle.index = static_cast<std::uint32_t>(pimpl_->resources.size() - 1);
+    return handle;
+}
+
+RenderGraphResource RenderGraph::ImportTexture(Texture& texture)
+{
+    Pimpl::ResourceEntry entry;
+    entry.texture = &texture;
+    pimpl_->resources.push_back(entry);
+    pimpl_->isCompiled = false;
+    RenderGraphResource handle;
+    handle.index = static_cast<std::uint32_t>(pimpl_->resources.size() - 1);
+    return handle;
+}
+
+RenderGraphResource RenderGraph::CreateTransientTexture(const TextureDescriptor& textureDesc)
+{
+    LLGL_ASSERT((textureDesc.miscFlags & MiscFlags::Sparse) == 0, "transient textures of render graph must not be sparse");
+
+    Pimpl::ResourceEntry entry;
+    {
+        entry.isTransient   = true;
+        entry.textureDesc   = textureDesc;
+        entry.debugName     = (textureDesc.debugName != nullptr ? textureDesc.debugName : "");
+    }
+    entry.textureDesc.debugName = nullptr;
+    pimpl_->resources.push_back(entry);
+    pimpl_->isCompiled = false;
+    RenderGraphResource handle;
+    handle.index = static_cast<std::uint32_t>(pimpl_->resources.size() - 1);
+    return handle;
+}
+
+RenderGraphPass RenderGraph::AddPass(const char* name, const ExecuteFunction& execute, const CommandQueueType queueType)
+{
+    Pimpl::PassEntry entry;
+    {
+        entry.name      = (name != nullptr ? name : "");
+        entry.execute   = execute;
+        entry.queueType = queueType;
+    }
+    pimpl_->passes.push_back(entry);
+    pimpl_->isCompiled = false;
+    RenderGraphPass handle;
+    handle.index = static_cast<std::uint32_t>(pimpl_->passes.size() - 1);
+    return handle;
+}
+
+void RenderGraph::Read(const RenderGraphPass& pass, const RenderGraphResource& resource, const RenderGraphAccess access)
+{
+    LLGL_ASSERT(pass.index < pimpl_->passes.size(), "invalid render graph pass");
+    LLGL_ASSERT(resource.index < pimpl_->resources.size(), "invalid render graph resource");
+    pimpl_->passes[pass.index].accesses.push_back(Pimpl::Access{ resource.index, access, false });
+    pimpl_->isCompiled = false;
+}
+
+void RenderGraph::Write(const RenderGraphPass& pass, const RenderGraphResource& resource, const RenderGraphAccess access)
+{
+    LLGL_ASSERT(pass.index < pimpl_->passes.size(), "invalid render graph pass");
+    LLGL_ASSERT(resource.index < pimpl_->resources.size(), "invalid render graph resource");
+    pimpl_->passes[pass.index].accesses.push_back(Pimpl::Access{ resource.index, access, true });
+    pimpl_->isCompiled = false;
+}
+
+void RenderGraph::SetSideEffects(const RenderGraphPass& pass)
+{
+    LLGL_ASSERT(pass.index < pimpl_->passes.size(), "invalid render graph pass");
+    pimpl_->passes[pass.index].hasSideEffects = true;
+    pimpl_->isCompiled = false;
+}
+
+void RenderGraph::Compile()
+{
+    pimpl_->Compile();
+}
+
+void RenderGraph::Execute()
+{
+    if (!pimpl_->isCompiled)
+        pimpl_->Compile();
+    pimpl_->Execute();
+}
+
+void RenderGraph::Reset()
+{
+    pimpl_->resources.clear();
+    pimpl_->passes.clear();
+    pimpl_->isCompiled = false;
+}
+
+Texture* RenderGraph::GetTexture(const RenderGraphResource& resource) const
+{
+    return (resource.index < pimpl_->resources.size() ? pimpl_->resources[resource.index].texture : nullptr);
+}
+
+Buffer* RenderGraph::GetBuffer(const RenderGraphResource& resource) const
+{
+    return (resource.index < pimpl_->resources.size() ? pimpl_->resources[resource.index].buffer : nullptr);
+}
+
+bool RenderGraph::IsPassCulled(const RenderGraphPass& pass) const
+{
+    return (pass.index < pimpl_->passes.size() ? pimpl_->passes[pass.index].isCulled : true);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void RenderGraph::Pimpl::ReleaseObjects()
+{
+    /* Wait until all queues have finished before any transient texture or command buffer is released */
+    for (QueueState& queueState : queueStates)
+    {
+        if (queueState.queue != nullptr)
+            queueState.queue->WaitIdle();
+        for (CommandBuffer* cmdBuffer : queueState.cmdBuffers)
+            renderer.Release(*cmdBuffer);
+    }
+
+    for (Fence* fence : fences)
+        renderer.Release(*fence);
+
+    for (PooledTexture& entry : pooledTextures)
+        renderer.Release(*entry.texture);
+
+    ReleasePlacedTextures();
+    if (placementHeap != nullptr)
+        renderer.Release(*placementHeap);
+}
+
+void RenderGraph::Pimpl::Compile()
+{
+    CullPasses();
+    ComputeLifetimes();
+    ComputeBarriers();
+    AllocateTransientTextures();
+    isCompiled = true;
+}
+
+void RenderGraph::Pimpl::Execute()
+{
+    for (QueueState& queueState : queueStates)
+        queueState.numUsedBuffers = 0;
+
+    numUsedFences = 0;
+    passFences.assign(passes.size(), nullptr);
+
+    std::vector<Buffer*>    barrierBuffers;
+    std::vector<Texture*>   barrierTextures;
+
+    for_range(passIndex, passes.size())
+    {
+        PassEntry& pass = passes[passIndex];
+        if (pass.isCulled)
+            continue;
+
+        QueueState& queueState = GetQueueState(ResolveQueueType(pass.queueType));
+
+        /* Submit pending commands before the queue waits for passes on other queues */
+        if (!pass.waitPasses.empty())
+        {
+            SubmitCommandBuffer(queueState);
+            for (std::uint32_t waitPass : pass.waitPasses)
+                queueState.queue->SubmitWait(*passFences[waitPass]);
+        }
+
+        CommandBuffer& cmdBuffer = (queueState.openCmdBuffer != nullptr ? *queueState.openCmdBuffer : BeginCommandBuffer(queueState, pass.name));
+        cmdBuffer.PushDebugGroup(pass.name.c_str());
+        {
+            /* Transient textures that take over memory from another texture must be initialized by an aliasing barrier */
+            for (std::uint32_t resourceIndex : pass.aliasedResources)
+            {
+                const ResourceEntry& resource = resources[resourceIndex];
+                Texture* prevTexture = (resource.aliasPredecessor != ~0u ? resources[resource.aliasPredecessor].texture : nullptr);
+                cmdBuffer.AliasingBarrier(prevTexture, resource.texture);
+            }
+
+            /* Make storage writes of previous passes visible */
+            if (!pass.barrierResources.empty())
+            {
+                barrierBuffers.clear();
+                barrierTextures.clear();
+
+                for (std::uint32_t resourceIndex : pass.barrierResources)
+                {
+                    const ResourceEntry& resource = resources[resourceIndex];
+                    if (resource.buffer != nullptr)
+                        barrierBuffers.push_back(resource.buffer);
+                    else if (resource.texture != nullptr)
+                        barrierTextures.push_back(resource.texture);
+                }
+
+                cmdBuffer.ResourceBarrier(
+                    static_cast<std::uint32_t>(barrierBuffers.size()),
+                    barrierBuffers.data(),
+                    static_cast<std::uint32_t>(barrierTextures.size()),
+                    barrierTextures.data()
+                );
+            }
+
+            if (pass.execute)
+                pass.execute(cmdBuffer);
+        }
+        cmdBuffer.PopDebugGroup();
+
+        /* Signal fence for passes on other queues that depend on this pass */
+        if (pass.signalsFence)
+        {
+            SubmitCommandBuffer(queueState);
+            Fence* fence = AcquireFence();
+            queueState.queue->Submit(*fence);
+            passFences[passIndex] = fence;
+        }
+    }
+
+    for (QueueState& queueState : queueStates)
+        SubmitCommandBuffer(queueState);
+}
+
+// Returns true if the specified texture descriptors describe the same texture, ignoring their debug names.
+static bool IsTextureDescriptorEqual(const TextureDescriptor& lhs, const TextureDescriptor& rhs)
+{
+    return
+    (
+        lhs.type            == rhs.type             &&
+        lhs.bindFlags       == rhs.bindFlags        &&
+        lhs.miscFlags       == rhs.miscFlags        &&
+        lhs.format          == rhs.format           &&
+        lhs.extent.width    == rhs.extent.width     &&
+        lhs.extent.height   == rhs.extent.height    &&
+        lhs.extent.depth    == rhs.extent.depth     &&
+        lhs.arrayLayers     == rhs.arrayLayers      &&
+        lhs.mipLevels       == rhs.mipLevels        &&
+        lhs.samples         == rhs.samples
+    );
+}
+
+CommandQueueType RenderGraph::Pimpl::ResolveQueueType(const CommandQueueType queueType) const
+{
+    if (queueType != CommandQueueType::Graphics && renderer.GetCommandQueue(queueType) == renderer.GetCommandQueue())
+        return CommandQueueType::Graphics;
+    return queueType;
+}
+
+void RenderGraph::Pimpl::CullPasses()
+{
+    /* Walk passes backwards: A pass is alive if it has side effects or writes a resource that is imported or read by an alive pass */
+    std::vector<bool> isResourceNeeded(resources.size(), false);
+
+    for_range_reverse(passIndex, passes.size())
+    {
+        PassEntry& pass = passes[passIndex];
+
+        bool isAlive = pass.hasSideEffects;
+        for (const Access& access : pass.accesses)
+        {
+            if (access.isWrite && (!resources[access.resource].isTransient || isResourceNeeded[access.resource]))
+                isAlive = true;
+        }
+
+        pass.isCulled = !isAlive;
+        if (isAlive)
+        {
+            for (const Access& access : pass.accesses)
+            {
+                if (!access.isWrite)
+                    isResourceNeeded[access.resource] = true;
+            }
+        }
+    }
+}
+
+void RenderGraph::Pimpl::ComputeLifetimes()
+{
+    for (ResourceEntry& resource : resources)
+    {
+        resource.firstPass          = ~0u;
+        resource.lastPass           = 0;
+        resource.isAsyncAccessed    = false;
+        resource.isPlaced           = false;
+        resource.aliasPredecessor   = ~0u;
+    }
+
+    for_range(passIndex, passes.size())
+    {
+        const PassEntry& pass = passes[passIndex];
+        if (pass.isCulled)
+            continue;
+
+        const bool isAsyncPass = (ResolveQueueType(pass.queueType) != CommandQueueType::Graphics);
+
+        for (const Access& access : pass.accesses)
+        {
+            ResourceEntry& resource = resources[access.resource];
+            resource.firstPass  = std::min(resource.firstPass, static_cast<std::uint32_t>(passIndex));
+            resource.lastPass   = std::max(resource.lastPass, static_cast<std::uint32_t>(passIndex));
+            if (isAsyncPass)
+                resource.isAsyncAccessed = true;
+        }
+    }
+}
+
+// Appends the specified value to the container if it is not already contained.
+static void AppendUnique(std::vector<std::uint32_t>& cont, std::uint32_t value)
+{
+    if (std::find(cont.begin(), cont.end(), value) == cont.end())
+        cont.push_back(value);
+}
+
+void RenderGraph::Pimpl::ComputeBarriers()
+{
+    struct ResourceState
+    {
+        std::uint32_t               lastWriter  = ~0u;
+        bool                        isStorage   = false;
+        std::vector<std::uint32_t>  readers;            // Passes that read the resource since its last write.
+    };
+
+    std::vector<ResourceState> states(resources.size());
+    std::vector<CommandQueueType> passQueues(passes.size());
+
+    for (PassEntry& pass : passes)
+    {
+        pass.signalsFence = false;
+        pass.waitPasses.clear();
+        pass.barrierResources.clear();
+        pass.aliasedResources.clear();
+    }
+
+    for_range(passIndex, passes.size())
+    {
+        PassEntry& pass = passes[passIndex];
+        if (pass.isCulled)
+            continue;
+
+        passQueues[passIndex] = ResolveQueueType(pass.queueType);
+
+        auto AddWaitPass = [this, &pass](std::uint32_t waitPass)
+        {
+            passes[waitPass].signalsFence = true;
+            AppendUnique(pass.waitPasses, waitPass);
+        };
+
+        /* Determine dependencies on previous passes */
+        for (const Access& access : pass.accesses)
+        {
+            const ResourceState& state = states[access.resource];
+
+            if (state.lastWriter != ~0u && state.lastWriter != passIndex)
+            {
+                /* Read-after-write or write-after-write: Fence across queues, or barrier after storage writes on the same queue */
+                if (passQueues[state.lastWriter] != passQueues[passIndex])
+                    AddWaitPass(state.lastWriter);
+                else if (state.isStorage)
+                    AppendUnique(pass.barrierResources, access.resource);
+            }
+
+            if (access.isWrite)
+            {
+                /* Write-after-read: Wait for readers on other queues before the resource is overwritten */
+                for (std::uint32_t reader : state.readers)
+                {
+                    if (reader != passIndex && passQueues[reader] != passQueues[passIndex])
+                        AddWaitPass(reader);
+                }
+            }
+        }
+
+        /* Update resource states after all accesses of this pass, so that a pass does not depend on itself */
+        for (const Access& access : pass.accesses)
+        {
+            ResourceState& state = states[access.resource];
+            if (access.isWrite)
+            {
+                state.lastWriter    = static_cast<std::uint32_t>(passIndex);
+                state.isStorage     = (access.access == RenderGraphAccess::Storage);
+                state.readers.clear();
+            }
+            else
+                AppendUnique(state.readers, static_cast<std::uint32_t>(passIndex));
+        }
+    }
+}
+
+void RenderGraph::Pimpl::AllocateTransientTextures()
+{
+    if (renderer.GetRenderingCaps().features.hasPlacementHeaps)
+        AllocatePlacedTextures();
+    AllocatePooledTextures();
+}
+
+void RenderGraph::Pimpl::AllocatePooledTextures()
+{
+    for (PooledTexture& entry : pooledTextures)
+    {
+        entry.lastPass  = 0;
+        entry.isUsed    = false;
+    }
+
+    /* Collect all transient textures that are not placed, ordered by their first pass */
+    std::vector<std::uint32_t> candidates;
+    for_range(resourceIndex, resources.size())
+    {
+        ResourceEntry& resource = resources[resourceIndex];
+        if (resource.isTransient && !resource.isPlaced)
+        {
+            resource.texture = nullptr;
+            if (resource.firstPass != ~0u)
+                candidates.push_back(static_cast<std::uint32_t>(resourceIndex));
+        }
+    }
+
+    std::stable_sort(
+        candidates.begin(), candidates.end(),
+        [this](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            return (resources[lhs].firstPass < resources[rhs].firstPass);
+        }
+    );
+
+    for (std::uint32_t resourceIndex : candidates)
+    {
+        ResourceEntry& resource = resources[resourceIndex];
+
+        /* Reuse a texture whose previous user is no longer accessed; textures on async queues are used exclusively */
+        PooledTexture* match = nullptr;
+        for (PooledTexture& entry : pooledTextures)
+        {
+            if (!IsTextureDescriptorEqual(entry.desc, resource.textureDesc))
+                continue;
+            if (!entry.isUsed || (!resource.isAsyncAccessed && entry.lastPass < resource.firstPass))
+            {
+                match = &entry;
+                break;
+            }
+        }
+
+        if (match == nullptr)
+        {
+            TextureDescriptor textureDesc = resource.textureDesc;
+            textureDesc.debugName = (resource.debugName.empty() ? "LLGL.RenderGraph" : resource.debugName.c_str());
+
+            PooledTexture entry;
+            {
+                entry.desc      = resource.textureDesc;
+                entry.texture   = renderer.CreateTexture(textureDesc);
+            }
+            pooledTextures.push_back(entry);
+            match = &pooledTextures.back();
+        }
+        else if (match->isUsed && (resource.textureDesc.bindFlags & BindFlags::Storage) != 0)
+        {
+            /* Storage writes of the previous user must be finished before the texture is written again */
+            AppendUnique(passes[resource.firstPass].barrierResources, resourceIndex);
+        }
+
+        match->isUsed   = true;
+        match->lastPass = (resource.isAsyncAccessed ? ~0u : resource.lastPass);
+        resource.texture = match->texture;
+    }
+
+    /* Release textures that are no longer used by this graph */
+    for (auto it = pooledTextures.begin(); it != pooledTextures.end();)
+    {
+        if (!it->isUsed)
+        {
+            renderer.Release(*it->texture);
+            it = pooledTextures.erase(it);
+        }
+        else
+            ++it;
+    }
+}
+
+void RenderGraph::Pimpl::AllocatePlacedTextures()
+{
+    struct Allocation
+    {
+        std::uint64_t offset;
+        std::uint64_t size;
+        std::uint32_t resource;
+    };
+
+    /* Collect transient textures that are only accessed on the graphics queue, ordered by their first pass */
+    std::vector<std::uint32_t> candidates;
+    for_range(resourceIndex, resources.size())
+    {
+        const ResourceEntry& resource = resources[resourceIndex];
+        if (resource.isTransient && resource.firstPass != ~0u && !resource.isAsyncAccessed)
+            candidates.push_back(static_cast<std::uint32_t>(resourceIndex));
+    }
+
+    std::stable_sort(
+        candidates.begin(), candidates.end(),
+        [this](std::uint32_t lhs, std::uint32_t rhs)
+        {
+            return (resources[lhs].firstPass < resources[rhs].firstPass);
+        }
+    );
+
+    /* Assign each texture the lowest offset whose memory range is not occupied by any texture that is still alive */
+    std::vector<Allocation>     allocations;
+    std::vector<std::uint64_t>  offsets;
+    std::uint64_t               heapSize    = 0;
+
+    for (std::uint32_t resourceIndex : candidates)
+    {
+        ResourceEntry& resource = resources[resourceIndex];
+
+        const MemoryRequirements reqs = renderer.GetTextureMemoryRequirements(resource.textureDesc);
+        if (reqs.size == 0)
+            continue;
+
+        const std::uint64_t alignment = std::max<std::uint64_t>(reqs.alignment, 1);
+
+        offsets.clear();
+        offsets.push_back(0);
+        for (const Allocation& alloc : allocations)
+            offsets.push_back(GetAlignedSize(alloc.offset + alloc.size, alignment));
+        std::sort(offsets.begin(), offsets.end());
+
+        auto IsOverlapping = [&reqs](const Allocation& alloc, std::uint64_t offset) -> bool
+        {
+            return (offset < alloc.offset + alloc.size && alloc.offset < offset + reqs.size);
+        };
+
+        std::uint64_t offset = 0;
+        for (std::uint64_t candidateOffset : offsets)
+        {
+            bool isConflicting = false;
+            for (const Allocation& alloc : allocations)
+            {
+                if (resources[alloc.resource].lastPass >= resource.firstPass && IsOverlapping(alloc, candidateOffset))
+                {
+                    isConflicting = true;
+                    break;
+                }
+            }
+            if (!isConflicting)
+            {
+                offset = candidateOffset;
+                break;
+            }
+        }
+
+        /* The predecessor is the most recent texture that occupied the same memory */
+        std::uint32_t predecessor = ~0u;
+        for (const Allocation& alloc : allocations)
+        {
+            if (IsOverlapping(alloc, offset) && (predecessor == ~0u || resources[alloc.resource].lastPass > resources[predecessor].lastPass))
+                predecessor = alloc.resource;
+        }
+
+        allocations.push_back(Allocation{ offset, reqs.size, resourceIndex });
+        heapSize = std::max(heapSize, offset + reqs.size);
+
+        resource.isPlaced           = true;
+        resource.aliasPredecessor   = predecessor;
+    }
+
+    /* Keep previous placed textures if the memory layout has not changed */
+    bool isLayoutEqual = (placementHeap != nullptr && placementHeap->GetSize() >= heapSize && placedTextures.size() == allocations.size());
+    for_range(i, allocations.size())
+    {
+        if (!isLayoutEqual)
+            break;
+        const PlacedTexture& placed = placedTextures[i];
+        isLayoutEqual = (placed.offset == allocations[i].offset && IsTextureDescriptorEqual(placed.desc, resources[allocations[i].resource].textureDesc));
+    }
+
+    if (!isLayoutEqual)
+    {
+        ReleasePlacedTextures();
+
+        if (placementHeap != nullptr && placementHeap->GetSize() < heapSize)
+        {
+            /* Wait until the GPU no longer accesses the previous heap before it is released */
+            for (QueueState& queueState : queueStates)
+            {
+                if (queueState.queue != nullptr)
+                    queueState.queue->WaitIdle();
+            }
+            renderer.Release(*placementHeap);
+            placementHeap = nullptr;
+        }
+
+        if (placementHeap == nullptr && heapSize > 0)
+        {
+            PlacementHeapDescriptor heapDesc;
+            {
+                heapDesc.debugName  = "LLGL.RenderGraph";
+                heapDesc.size       = heapSize;
+            }
+            placementHeap = renderer.CreatePlacementHeap(heapDesc);
+        }
+
+        if (placementHeap == nullptr)
+        {
+            /* Fall back to pooled textures if the heap could not be created */
+            for (const Allocation& alloc : allocations)
+            {
+                resources[alloc.resource].isPlaced         = false;
+                resources[alloc.resource].aliasPredecessor = ~0u;
+            }
+            return;
+        }
+
+        for (const Allocation& alloc : allocations)
+        {
+            const ResourceEntry& resource = resources[alloc.resource];
+
+            TextureDescriptor textureDesc = resource.textureDesc;
+            textureDesc.debugName = (resource.debugName.empty() ? "LLGL.RenderGraph" : resource.debugName.c_str());
+
+            PlacedTexture placed;
+            {
+                placed.desc     = resource.textureDesc;
+                placed.offset   = alloc.offset;
+                placed.texture  = renderer.CreatePlacedTexture(*placementHeap, alloc.offset, textureDesc);
+            }
+            placedTextures.push_back(placed);
+        }
+    }
+
+    for_range(i, allocations.size())
+    {
+        ResourceEntry& resource = resources[allocations[i].resource];
+        resource.texture = placedTextures[i].texture;
+        passes[resource.firstPass].aliasedResources.push_back(allocations[i].resource);
+    }
+}
+
+void RenderGraph::Pimpl::ReleasePlacedTextures()
+{
+    if (placedTextures.empty())
+        return;
+
+    /* Wait until the GPU no longer accesses the placed textures */
+    for (QueueState& queueState : queueStates)
+    {
+        if (queueState.queue != nullptr)
+            queueState.queue->WaitIdle();
+    }
+
+    for (PlacedTexture& placed : placedTextures)
+        renderer.Release(*placed.texture);
+    placedTextures.clear();
+}
+
+RenderGraph::Pimpl::QueueState& RenderGraph::Pimpl::GetQueueState(const CommandQueueType queueType)
+{
+    QueueState& queueState = queueStates[static_cast<std::size_t>(queueType)];
+    if (queueState.queue == nullptr)
+    {
+        queueState.type     = queueType;
+        queueState.queue    = renderer.GetCommandQueue(queueType);
+    }
+    return queueState;
+}
+
+CommandBuffer& RenderGraph::Pimpl::BeginCommandBuffer(QueueState& queueState, const std::string& name)
+{
+    /* Reuse command buffers of the previous execution in the same order */
+    if (queueState.numUsedBuffers == queueState.cmdBuffers.size())
+    {
+        CommandBufferDescriptor cmdBufferDesc;
+        {
+            cmdBufferDesc.debugName = name.c_str();
+            cmdBufferDesc.queueType = queueState.type;
+        }
+        queueState.cmdBuffers.push_back(renderer.CreateCommandBuffer(cmdBufferDesc));
+    }
+
+    CommandBuffer* cmdBuffer = queueState.cmdBuffers[queueState.numUsedBuffers++];
+    cmdBuffer->Begin();
+    queueState.openCmdBuffer = cmdBuffer;
+    return *cmdBuffer;
+}
+
+void RenderGraph::Pimpl::SubmitCommandBuffer(QueueState& queueState)
+{
+    if (CommandBuffer* cmdBuffer = queueState.openCmdBuffer)
+    {
+        cmdBuffer->End();
+        queueState.queue->Submit(*cmdBuffer);
+        queueState.openCmdBuffer = nullptr;
+    }
+}
+
+Fence* RenderGraph::Pimpl::AcquireFence()
+{
+    if (numUsedFences == fences.size())
+    {
+        fences.push_back(renderer.CreateFence());
+        return fences[numUsedFences++];
+    }
+
+    /* Fences of the previous execution have always been submitted, so they must be signaled before they can be reused */
+    Fence* fence = fences[numUsedFences++];
+    renderer.GetCommandQueue()->WaitFence(*fence, ~0ull);
+    return fence;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
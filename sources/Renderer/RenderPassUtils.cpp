@@ -8,6 +8,7 @@
 #include "RenderPassUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include "../Core/Assertion.h"
+#include <algorithm>
 
 
 namespace LLGL
@@ -61,6 +62,45 @@ LLGL_EXPORT std::uint32_t FillClearColorAttachmentIndices(
     return numColorAttachmentsToClear;
 }
 
+LLGL_EXPORT std::uint32_t NumMultiviewViews(std::uint32_t viewMask)
+{
+    std::uint32_t numViews = 0;
+    for (; viewMask != 0; viewMask &= (viewMask - 1))
+        ++numViews;
+    return numViews;
+}
+
+LLGL_EXPORT std::uint32_t NumMultiviewLayers(std::uint32_t viewMask)
+{
+    std::uint32_t numLayers = 0;
+    for (; viewMask != 0; viewMask >>= 1)
+        ++numLayers;
+    return numLayers;
+}
+
+LLGL_EXPORT bool AreRenderPassesCompatible(const RenderPassDescriptor& lhs, const RenderPassDescriptor& rhs)
+{
+    /* Compare color attachment formats up to the first disabled attachment */
+    const std::uint32_t numColorAttachments = NumEnabledColorAttachments(lhs);
+    if (numColorAttachments != NumEnabledColorAttachments(rhs))
+        return false;
+
+    for_range(i, numColorAttachments)
+    {
+        if (lhs.colorAttachments[i].format != rhs.colorAttachments[i].format)
+            return false;
+    }
+
+    /* Compare depth-stencil formats, number of samples, and view masks; 0 and 1 samples both disable multi-sampling */
+    return
+    (
+        lhs.depthAttachment.format      == rhs.depthAttachment.format       &&
+        lhs.stencilAttachment.format    == rhs.stencilAttachment.format     &&
+        std::max(1u, lhs.samples)       == std::max(1u, rhs.samples)        &&
+        lhs.viewMask                    == rhs.viewMask
+    );
+}
+
 
 } // /namespace LLGL
 
@@ -37,6 +37,18 @@ LLGL_EXPORT std::uint32_t FillClearColorAttachmentIndices(
     const RenderPassDescriptor& renderPassDesc
 );
 
+// Returns the number of views that are enabled in the specified multiview mask.
+LLGL_EXPORT std::uint32_t NumMultiviewViews(std::uint32_t viewMask);
+
+// Returns the number of array layers an attachment must cover for the specified multiview mask, i.e. the index of the highest bit plus one. Returns 0 if the mask is 0.
+LLGL_EXPORT std::uint32_t NumMultiviewLayers(std::uint32_t viewMask);
+
+/*
+Returns true if the two render passes are compatible, i.e. they have the same attachment formats, the same number of samples, and the same view mask.
+Load and store operations are ignored. Secondary command buffers can be executed inside any render pass that is compatible with their inheritance render pass.
+*/
+LLGL_EXPORT bool AreRenderPassesCompatible(const RenderPassDescriptor& lhs, const RenderPassDescriptor& rhs);
+
 
 } // /namespace LLGL
 
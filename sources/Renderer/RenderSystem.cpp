@@ -12,6 +12,8 @@
 #include "../Core/Exception.h"
 #include "../Core/StringUtils.h"
 #include "RenderTargetUtils.h"
+#include "TextureUtils.h"
+#include "CommandBufferUtils.h"
 #include <LLGL/Platform/Platform.h>
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Format.h>
@@ -22,8 +24,13 @@
 
 #include <LLGL/RenderSystem.h>
 #include "RenderSystemRegistry.h"
+#include "ObjectPool.h"
+#include "CommandChunkPool.h"
 #include <string>
+#include <fstream>
 #include <unordered_map>
+#include <algorithm>
+#include <mutex>
 
 #include "../Core/PrintfUtils.h"
 
@@ -54,6 +61,11 @@ struct RenderSystem::Pimpl
     bool                    hasCaps     = false;
     RenderingCapabilities   caps;
     Report                  report;
+    MemoryBudgetCallback    memoryBudgetCallback;
+    float                   memoryBudgetThreshold   = 0.9f;
+    std::vector<bool>       heapsAboveThreshold;
+    bool                    inMemoryBudgetCallback  = false;
+    std::mutex              memoryBudgetMutex;
 };
 
 
@@ -85,6 +97,14 @@ RenderSystemPtr RenderSystem::Load(const RenderSystemDescriptor& renderSystemDes
 
     #endif
 
+    /* Use custom allocator for all subsequent slabs of render system child objects */
+    if (renderSystemDesc.allocator.allocate != nullptr)
+    {
+        if (renderSystemDesc.allocator.free == nullptr)
+            return ReportException(report, "AllocatorDescriptor::free must be specified if AllocatorDescriptor::allocate is specified");
+        ObjectPool::Get().SetAllocator(renderSystemDesc.allocator);
+    }
+
     #if LLGL_BUILD_STATIC_LIB
 
     /* Allocate render system */
@@ -181,6 +201,13 @@ void RenderSystem::Unload(RenderSystemPtr&& renderSystem)
         /* Delete render system first, then release module */
         renderSystem.reset();
         RenderSystemRegistry::Get().UnregisterRenderSystem(renderSystemRef);
+
+        /* Return memory of all slabs that are no longer used by any render system child objects */
+        ObjectPool::Get().Trim();
+
+        /* Return memory of all recycled command buffer chunks once no render system can record commands anymore */
+        if (!RenderSystemRegistry::Get().HasRenderSystems())
+            CommandChunkPool::Get().Trim();
     }
 }
 
@@ -219,6 +246,173 @@ const Report* RenderSystem::GetReport() const
     return (pimpl_->report ? &(pimpl_->report) : nullptr);
 }
 
+std::uint32_t RenderSystem::QueryMemoryHeaps(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos)
+{
+    const std::uint32_t numHeaps = QueryMemoryHeapInfos(outHeapInfos, maxHeapInfos);
+    if (pimpl_->memoryBudgetCallback)
+    {
+        /* Evaluate callback with the heap infos that have just been queried if they are complete */
+        if (outHeapInfos != nullptr && numHeaps <= maxHeapInfos)
+            InvokeMemoryBudgetCallback(outHeapInfos, numHeaps);
+        else
+            CheckMemoryBudget();
+    }
+    return numHeaps;
+}
+
+std::uint32_t RenderSystem::QueryAdapters(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    return QueryAdapterInfos(outAdapters, maxAdapters);
+}
+
+void RenderSystem::SetMemoryBudgetCallback(const MemoryBudgetCallback& callback, float threshold)
+{
+    pimpl_->memoryBudgetCallback    = callback;
+    pimpl_->memoryBudgetThreshold   = threshold;
+    std::fill(pimpl_->heapsAboveThreshold.begin(), pimpl_->heapsAboveThreshold.end(), false);
+}
+
+void RenderSystem::PrepareSwapChainAsync(const SwapChainDescriptor& /*swapChainDesc*/)
+{
+    /* Swap-chains are created without any preparation by default */
+}
+
+CommandQueue* RenderSystem::GetCommandQueue(const CommandQueueType /*type*/)
+{
+    /* Backends without dedicated queues submit all command buffers to their primary queue */
+    return GetCommandQueue();
+}
+
+void RenderSystem::FlushMappedRange(Buffer& /*buffer*/, std::uint64_t /*offset*/, std::uint64_t /*length*/)
+{
+    /* Mapped memory is host coherent by default, so there is nothing to flush */
+}
+
+AccelerationStructureSizes RenderSystem::GetAccelerationStructureSizes(const AccelerationStructureDescriptor& /*accelerationStructureDesc*/)
+{
+    /* Acceleration structures are not supported by default */
+    return {};
+}
+
+void RenderSystem::WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence)
+{
+    /* Upload textures synchronously by default, but still from the coarsest to the finest MIP-map */
+    for (std::uint32_t i : GetTextureUploadOrder(numUploads, uploads))
+        WriteTexture(*uploads[i].texture, uploads[i].region, uploads[i].imageView);
+
+    /* All uploads have completed at this point, so the fence is signaled with the next submission */
+    if (fence != nullptr)
+        GetCommandQueue()->Submit(*fence);
+}
+
+void RenderSystem::ReadTextureAsync(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView, Fence& fence)
+{
+    /* Read texture synchronously by default; The readback has completed at this point, so the fence is signaled with the next submission */
+    ReadTexture(texture, textureRegion, dstImageView);
+    GetCommandQueue()->Submit(fence);
+}
+
+// Reads the file range of the specified upload into CPU memory.
+static void ReadFileUploadData(const FileUploadDescriptor& upload, std::vector<char>& outData)
+{
+    std::ifstream file{ upload.filename, std::ios::in | std::ios::binary };
+    if (!file.good())
+        LLGL_TRAP("failed to open file for upload: %s", upload.filename);
+
+    outData.resize(static_cast<std::size_t>(upload.fileSize));
+    file.seekg(static_cast<std::streamoff>(upload.fileOffset), std::ios::beg);
+    file.read(outData.data(), static_cast<std::streamsize>(outData.size()));
+
+    if (!file.good())
+    {
+        LLGL_TRAP(
+            "failed to read %llu byte(s) at offset %llu from file: %s",
+            static_cast<unsigned long long>(upload.fileSize), static_cast<unsigned long long>(upload.fileOffset), upload.filename
+        );
+    }
+}
+
+void RenderSystem::WriteFromFileAsync(std::uint32_t numUploads, const FileUploadDescriptor* uploads, Fence* fence)
+{
+    /* Read file data into CPU memory by default and write it synchronously into the destination resources */
+    std::vector<char> data;
+    for_range(i, numUploads)
+    {
+        const FileUploadDescriptor& upload = uploads[i];
+        if (upload.compression != FileCompression::Uncompressed)
+            LLGL_TRAP_FEATURE_NOT_SUPPORTED("decompression of file data");
+
+        ReadFileUploadData(upload, data);
+
+        if (upload.buffer != nullptr)
+            WriteBuffer(*upload.buffer, upload.bufferOffset, data.data(), data.size());
+        else if (upload.texture != nullptr)
+        {
+            /* File data is in the native format of the texture, so no conversion is required */
+            const FormatAttributes& formatAttribs = GetFormatAttribs(upload.texture->GetFormat());
+            const ImageView imageView{ formatAttribs.format, formatAttribs.dataType, data.data(), data.size(), upload.rowStride };
+            WriteTexture(*upload.texture, upload.textureRegion, imageView);
+        }
+    }
+
+    /* All uploads have completed at this point, so the fence is signaled with the next submission */
+    if (fence != nullptr)
+        GetCommandQueue()->Submit(*fence);
+}
+
+PlacementHeap* RenderSystem::CreatePlacementHeap(const PlacementHeapDescriptor& /*placementHeapDesc*/)
+{
+    /* Placement heaps are not supported by default */
+    return nullptr;
+}
+
+void RenderSystem::Release(PlacementHeap& /*placementHeap*/)
+{
+    /* Placement heaps are not supported by default, so there is nothing to release */
+}
+
+MemoryRequirements RenderSystem::GetTextureMemoryRequirements(const TextureDescriptor& /*textureDesc*/)
+{
+    /* Textures cannot be placed by default */
+    return {};
+}
+
+Texture* RenderSystem::CreatePlacedTexture(PlacementHeap& /*placementHeap*/, std::uint64_t /*offset*/, const TextureDescriptor& textureDesc)
+{
+    /* Create regular texture with its own memory if placement heaps are not supported */
+    return CreateTexture(textureDesc);
+}
+
+Texture* RenderSystem::CreateSamplerFeedbackTexture(const SamplerFeedbackDescriptor& /*samplerFeedbackDesc*/)
+{
+    /* Sampler feedback is not supported by default */
+    return nullptr;
+}
+
+bool RenderSystem::ExportSharedHandle(Resource& /*resource*/, SharedResourceHandle& /*outHandle*/)
+{
+    /* Shared resources are not supported by default */
+    return false;
+}
+
+Texture* RenderSystem::ImportTexture(const TextureDescriptor& /*textureDesc*/, const SharedResourceHandle& /*sharedHandle*/)
+{
+    /* Shared resources are not supported by default */
+    return nullptr;
+}
+
+Buffer* RenderSystem::ImportBuffer(const BufferDescriptor& /*bufferDesc*/, const SharedResourceHandle& /*sharedHandle*/)
+{
+    /* Shared resources are not supported by default */
+    return nullptr;
+}
+
+bool RenderSystem::ExportSharedFence(Fence& /*fence*/, SharedResourceHandle& /*outHandle*/)
+{
+    /* Shared fences are not supported by default */
+    return false;
+}
+
 
 /*
  * ======= Protected: =======
@@ -248,6 +442,30 @@ void RenderSystem::SetRenderingCaps(const RenderingCapabilities& caps)
     pimpl_->caps    = caps;
 }
 
+void RenderSystem::CheckMemoryBudget()
+{
+    if (!pimpl_->memoryBudgetCallback || pimpl_->inMemoryBudgetCallback)
+        return;
+
+    /* Resources can be created on multiple threads (see RenderingFeatures::hasConcurrentResourceCreation), so skip this check if another thread is already evaluating the budget */
+    std::unique_lock<std::mutex> lock{ pimpl_->memoryBudgetMutex, std::try_to_lock };
+    if (!lock.owns_lock())
+        return;
+
+    /* Query heap infos into a small local array to avoid heap allocations for the common case */
+    constexpr std::uint32_t maxLocalHeapInfos = 16;
+    MemoryHeapInfo heapInfos[maxLocalHeapInfos];
+    const std::uint32_t numHeaps = QueryMemoryHeapInfos(heapInfos, maxLocalHeapInfos);
+    if (numHeaps <= maxLocalHeapInfos)
+        InvokeMemoryBudgetCallback(heapInfos, numHeaps);
+    else
+    {
+        std::vector<MemoryHeapInfo> heapInfosExt;
+        heapInfosExt.resize(numHeaps);
+        InvokeMemoryBudgetCallback(heapInfosExt.data(), QueryMemoryHeapInfos(heapInfosExt.data(), numHeaps));
+    }
+}
+
 void RenderSystem::AssertCreateBuffer(const BufferDescriptor& bufferDesc, std::uint64_t maxSize)
 {
     LLGL_ASSERT(
@@ -336,6 +554,123 @@ std::size_t RenderSystem::CopyTextureImageData(
 }
 
 
+/*
+ * ======= Private: =======
+ */
+
+void RenderSystem::InvokeMemoryBudgetCallback(const MemoryHeapInfo* heapInfos, std::uint32_t numHeaps)
+{
+    if (pimpl_->inMemoryBudgetCallback)
+        return;
+
+    if (pimpl_->heapsAboveThreshold.size() < numHeaps)
+        pimpl_->heapsAboveThreshold.resize(numHeaps, false);
+
+    /* Invoke callback only for heaps whose usage has crossed the threshold since the last evaluation */
+    pimpl_->inMemoryBudgetCallback = true;
+    for_range(i, numHeaps)
+    {
+        const MemoryHeapInfo& heapInfo = heapInfos[i];
+        const bool isAboveThreshold =
+        (
+            heapInfo.budget > 0 &&
+            static_cast<double>(heapInfo.usage) >= static_cast<double>(heapInfo.budget) * static_cast<double>(pimpl_->memoryBudgetThreshold)
+        );
+        const bool wasAboveThreshold = pimpl_->heapsAboveThreshold[i];
+        pimpl_->heapsAboveThreshold[i] = isAboveThreshold;
+        if (isAboveThreshold && !wasAboveThreshold)
+            pimpl_->memoryBudgetCallback(heapInfo, i);
+    }
+    pimpl_->inMemoryBudgetCallback = false;
+}
+
+
+/* ----- Default implementation of optional functions ----- */
+
+TransientBufferAllocation CommandBuffer::AllocTransientBuffer(std::uint64_t /*size*/, long /*bindFlags*/, std::uint64_t /*alignment*/)
+{
+    /* Transient buffers are not supported by default */
+    return {};
+}
+
+void CommandBuffer::CopyBufferRegions(Buffer& dstBuffer, Buffer& srcBuffer, std::uint32_t numRegions, const BufferCopyRegion* regions)
+{
+    /* Multi-region copies are not supported natively by default; Encode one copy command per region instead */
+    for_range(i, numRegions)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
+void CommandBuffer::CopyTextureRegions(Texture& dstTexture, Texture& srcTexture, std::uint32_t numRegions, const TextureCopyRegion* regions)
+{
+    /* Multi-region copies are not supported natively by default; Encode one copy command per region instead */
+    for_range(i, numRegions)
+        CopyTexture(dstTexture, regions[i].dstLocation, srcTexture, regions[i].srcLocation, regions[i].extent);
+}
+
+void CommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    /* Batched MIP-map generation is not supported natively by default; Encode one command per texture instead */
+    for_range(i, numTextures)
+    {
+        if (Texture* texture = textures[i])
+            GenerateMips(*texture);
+    }
+}
+
+void CommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t /*size*/)
+{
+    /* Buffer ranges are not supported by default; Only a range at the beginning of the buffer can be bound as whole buffer */
+    if (offset == 0)
+        SetResource(descriptor, buffer);
+    else
+        Log::Errorf("cannot bind constant buffer range at offset %" PRIu64 ": buffer ranges are not supported by this backend\n", offset);
+}
+
+void CommandBuffer::BeginResourceBarrier(
+    std::uint32_t       /*numBuffers*/,
+    Buffer* const *     /*buffers*/,
+    std::uint32_t       /*numTextures*/,
+    Texture* const *    /*textures*/)
+{
+    /* Split barriers are not supported by default; EndResourceBarrier() inserts a regular barrier instead */
+}
+
+void CommandBuffer::EndResourceBarrier(
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
+{
+    ResourceBarrier(numBuffers, buffers, numTextures, textures);
+}
+
+void CommandBuffer::AliasingBarrier(Texture* /*textureBefore*/, Texture* /*textureAfter*/)
+{
+    /* Placed textures have their own memory by default, so they never alias */
+}
+
+void CommandBuffer::ResolveSamplerFeedback(
+    Texture&        /*feedbackTexture*/,
+    std::uint32_t   /*mipLevel*/,
+    std::uint32_t   /*arrayLayer*/,
+    Buffer&         /*dstBuffer*/,
+    std::uint64_t   /*dstOffset*/)
+{
+    /* Sampler feedback textures cannot be created by default, so there is nothing to resolve */
+}
+
+void CommandBuffer::ClearSamplerFeedback(Texture& /*feedbackTexture*/)
+{
+    /* Sampler feedback textures cannot be created by default, so there is nothing to clear */
+}
+
+void CommandBuffer::DrawPacked(const DrawPackedDescriptor& drawDesc)
+{
+    /* Packed draws are encoded with the individual commands by default */
+    EncodePackedDraws(*this, drawDesc);
+}
+
+
 /* ----- Default implementation of deprecated functions ----- */
 
 void CommandBuffer::ResetResourceSlots(
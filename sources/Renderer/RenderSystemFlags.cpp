@@ -100,6 +100,17 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_FEATURE( hasLogicOp,                   "logic fragment operations"   );
     LLGL_VALIDATE_FEATURE( hasPipelineStatistics,        "query pipeline statistics"   );
     LLGL_VALIDATE_FEATURE( hasRenderCondition,           "conditional rendering"       );
+    LLGL_VALIDATE_FEATURE( hasTimestampQueries,          "timestamp queries"           );
+    LLGL_VALIDATE_FEATURE( hasQueryResolve,              "query resolve"               );
+    LLGL_VALIDATE_FEATURE( hasBindlessResourceHeaps,     "bindless resource heaps"     );
+    LLGL_VALIDATE_FEATURE( hasIndirectCountDrawing,      "indirect count drawing"      );
+    LLGL_VALIDATE_FEATURE( hasMeshShaders,               "mesh shaders"                );
+    LLGL_VALIDATE_FEATURE( hasTileShaders,               "tile shaders"                );
+    LLGL_VALIDATE_FEATURE( hasFramebufferFetch,          "framebuffer fetch"           );
+    LLGL_VALIDATE_FEATURE( hasVariableRateShading,       "variable rate shading"       );
+    LLGL_VALIDATE_FEATURE( hasIndirectStateChanges,      "indirect state changes"      );
+    LLGL_VALIDATE_FEATURE( hasRayTracing,                "ray tracing"                 );
+    LLGL_VALIDATE_FEATURE( hasRayQuery,                  "ray query"                   );
 
     #undef LLGL_VALIDATE_FEATURE
 
@@ -159,6 +170,7 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_LIMIT( maxComputeShaderWorkGroupSize[0],  "compute shader work group size on X-axis"  );
     LLGL_VALIDATE_LIMIT( maxComputeShaderWorkGroupSize[1],  "compute shader work group size on Y-axis"  );
     LLGL_VALIDATE_LIMIT( maxComputeShaderWorkGroupSize[2],  "compute shader work group size on Z-axis"  );
+    LLGL_VALIDATE_LIMIT( maxComputeShaderSharedMemorySize,  "compute shader shared memory size"         );
     LLGL_VALIDATE_LIMIT( maxViewports,                      "viewports"                                 );
     LLGL_VALIDATE_LIMIT( maxViewportSize[0],                "viewport width"                            );
     LLGL_VALIDATE_LIMIT( maxViewportSize[1],                "viewport height"                           );
@@ -166,6 +178,7 @@ LLGL_EXPORT bool ValidateRenderingCaps(
     LLGL_VALIDATE_LIMIT( maxConstantBufferSize,             "constant buffer size"                      );
     LLGL_VALIDATE_LIMIT( maxStreamOutputs,                  "stream outputs"                            );
     LLGL_VALIDATE_LIMIT( maxTessFactor,                     "tessellation factor"                       );
+    LLGL_VALIDATE_LIMIT( maxBindlessResourceViews,          "bindless resource views"                   );
 
     #undef LLGL_VALIDATE_LIMIT
     #undef LLGL_CONTINUE_VALIDATION_IF
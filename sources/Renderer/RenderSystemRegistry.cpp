@@ -70,6 +70,11 @@ bool RenderSystemRegistry::UnregisterRenderSystem(RenderSystem* renderSystem)
     return false;
 }
 
+bool RenderSystemRegistry::HasRenderSystems() const
+{
+    return !renderSystemEntries_.empty();
+}
+
 void RenderSystemRegistry::ReleaseModule(RenderSystemModule* module)
 {
     /* Decrement module use count and delete entry if no longer used */
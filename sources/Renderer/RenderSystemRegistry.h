@@ -40,6 +40,9 @@ class RenderSystemRegistry
         bool RegisterRenderSystem(RenderSystem* renderSystem, RenderSystemModule* module);
         bool UnregisterRenderSystem(RenderSystem* renderSystem);
 
+        // Returns true if any render system is currently registered.
+        bool HasRenderSystems() const;
+
     private:
 
         struct RenderSystemEntry
@@ -0,0 +1,80 @@
+/*
+ * RenderSystemUtils.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "RenderSystemUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <inttypes.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+static bool IsAdapterUUIDSpecified(const std::uint8_t (&uuid)[16])
+{
+    return std::any_of(std::begin(uuid), std::end(uuid), [](std::uint8_t b) { return (b != 0); });
+}
+
+LLGL_EXPORT bool IsAdapterSelectedByID(const RenderSystemDescriptor& renderSystemDesc)
+{
+    return
+    (
+        renderSystemDesc.adapterIndex < 0 &&
+        (renderSystemDesc.adapterLUID != 0 || IsAdapterUUIDSpecified(renderSystemDesc.adapterUUID))
+    );
+}
+
+LLGL_EXPORT int SelectAdapterIndex(const RenderSystemDescriptor& renderSystemDesc, const std::vector<AdapterInfo>& adapters)
+{
+    /* Adapter index has the highest priority */
+    if (renderSystemDesc.adapterIndex >= 0)
+        return renderSystemDesc.adapterIndex;
+
+    if (renderSystemDesc.adapterLUID != 0)
+    {
+        /* Find adapter by its LUID */
+        for_range(i, adapters.size())
+        {
+            if (adapters[i].luid == renderSystemDesc.adapterLUID)
+                return static_cast<int>(i);
+        }
+        LLGL_TRAP("no video adapter found with LUID 0x%016" PRIX64, renderSystemDesc.adapterLUID);
+    }
+
+    if (IsAdapterUUIDSpecified(renderSystemDesc.adapterUUID))
+    {
+        /* Find adapter by its UUID */
+        for_range(i, adapters.size())
+        {
+            if (::memcmp(adapters[i].uuid, renderSystemDesc.adapterUUID, sizeof(renderSystemDesc.adapterUUID)) == 0)
+                return static_cast<int>(i);
+        }
+        LLGL_TRAP("no video adapter found with the specified UUID");
+    }
+
+    return -1;
+}
+
+LLGL_EXPORT std::uint32_t CopyAdapterInfos(const std::vector<AdapterInfo>& adapters, AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    const std::uint32_t numAdapters = static_cast<std::uint32_t>(adapters.size());
+    if (outAdapters != nullptr)
+    {
+        for_range(i, std::min(numAdapters, maxAdapters))
+            outAdapters[i] = adapters[i];
+    }
+    return numAdapters;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
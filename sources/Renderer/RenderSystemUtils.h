@@ -12,6 +12,7 @@
 #include <LLGL/RenderSystemFlags.h>
 #include <LLGL/Container/ArrayView.h>
 #include "../Core/Exception.h"
+#include <vector>
 
 
 namespace LLGL
@@ -59,6 +60,19 @@ const T* GetRendererNativeHandle(const RenderSystemDescriptor& renderSystemDesc)
     );
 }
 
+// Returns true if the render system descriptor selects a video adapter by its LUID or UUID, i.e. the backend must enumerate all adapters to find it.
+LLGL_EXPORT bool IsAdapterSelectedByID(const RenderSystemDescriptor& renderSystemDesc);
+
+/*
+Returns the index of the video adapter that is selected by the render system descriptor or -1 if the backend may choose any adapter.
+If 'adapterIndex' is non-negative, it is returned as is and must be validated by the backend.
+Otherwise, the adapter is searched by its LUID or UUID in the specified list and traps if no adapter matches.
+*/
+LLGL_EXPORT int SelectAdapterIndex(const RenderSystemDescriptor& renderSystemDesc, const std::vector<AdapterInfo>& adapters);
+
+// Copies the specified adapter infos into the output array for RenderSystem::QueryAdapterInfos() and returns the number of adapters.
+LLGL_EXPORT std::uint32_t CopyAdapterInfos(const std::vector<AdapterInfo>& adapters, AdapterInfo* outAdapters, std::uint32_t maxAdapters);
+
 
 } // /namespace LLGL
 
@@ -12,40 +12,32 @@
 #include "../Core/StringUtils.h"
 #include "../Platform/Debug.h"
 #include <map>
+#include <string>
 
 
 namespace LLGL
 {
 
 
-struct CompareStringLess
-{
-    inline bool operator () (const UTF8String& lhs, const UTF8String& rhs) const
-    {
-        return (lhs.compare(rhs) < 0);
-    }
-    inline bool operator () (const UTF8String& lhs, const StringView& rhs) const
-    {
-        return (lhs.compare(rhs) < 0);
-    }
-    inline bool operator () (const StringView& lhs, const UTF8String& rhs) const
-    {
-        return (lhs.compare(rhs) < 0);
-    }
-};
-
+// Messages are keyed by std::string, so repeated messages can be looked up with the thread local format buffer without allocating a temporary key.
 template <typename T>
-using UTF8StringMap = std::map<UTF8String, T, CompareStringLess>;
+using MessageMap = std::map<std::string, T>;
 
 struct RenderingDebugger::Pimpl
 {
-    UTF8StringMap<Message>  errors;
-    UTF8StringMap<Message>  warnings;
+    MessageMap<Message>     errors;
+    MessageMap<Message>     warnings;
     FrameProfile            frameProfile;
     const char*             source                  = "";
     const char*             groupName               = "";
     bool                    isTimeRecording         = false;
+    bool                    isScopeRecording        = false;
+    bool                    isEventRecording        = false;
+    bool                    isStatisticsRecording   = false;
     bool                    isBreakOnErrorEnabled   = false;
+    long                    validationFlags         = ValidationFlags::All;
+    std::string             captureFilename;
+    std::uint32_t           captureFrames           = 0;
 };
 
 
@@ -79,6 +71,83 @@ bool RenderingDebugger::GetTimeRecording() const
     return pimpl_->isTimeRecording;
 }
 
+void RenderingDebugger::SetScopeRecording(bool enabled)
+{
+    pimpl_->isScopeRecording = enabled;
+}
+
+bool RenderingDebugger::GetScopeRecording() const
+{
+    return pimpl_->isScopeRecording;
+}
+
+void RenderingDebugger::SetEventRecording(bool enabled)
+{
+    pimpl_->isEventRecording = enabled;
+}
+
+bool RenderingDebugger::GetEventRecording() const
+{
+    return pimpl_->isEventRecording;
+}
+
+void RenderingDebugger::SetStatisticsRecording(bool enabled)
+{
+    pimpl_->isStatisticsRecording = enabled;
+}
+
+bool RenderingDebugger::GetStatisticsRecording() const
+{
+    return pimpl_->isStatisticsRecording;
+}
+
+void RenderingDebugger::SetValidation(bool enabled)
+{
+    pimpl_->validationFlags = (enabled ? ValidationFlags::All : 0);
+}
+
+bool RenderingDebugger::GetValidation() const
+{
+    return (pimpl_->validationFlags != 0);
+}
+
+void RenderingDebugger::SetValidationFlags(long flags)
+{
+    pimpl_->validationFlags = (flags & ValidationFlags::All);
+}
+
+long RenderingDebugger::GetValidationFlags() const
+{
+    return pimpl_->validationFlags;
+}
+
+void RenderingDebugger::BeginCapture(const char* filename, std::uint32_t numFrames)
+{
+    if (filename != nullptr && *filename != '\0' && numFrames > 0)
+    {
+        pimpl_->captureFilename = filename;
+        pimpl_->captureFrames   = numFrames;
+    }
+    else
+        EndCapture();
+}
+
+void RenderingDebugger::EndCapture()
+{
+    pimpl_->captureFilename.clear();
+    pimpl_->captureFrames = 0;
+}
+
+const char* RenderingDebugger::GetCaptureFilename() const
+{
+    return (!pimpl_->captureFilename.empty() ? pimpl_->captureFilename.c_str() : nullptr);
+}
+
+std::uint32_t RenderingDebugger::GetCaptureFrames() const
+{
+    return pimpl_->captureFrames;
+}
+
 void RenderingDebugger::SetBreakOnError(bool enable)
 {
     pimpl_->isBreakOnErrorEnabled = enable;
@@ -89,10 +158,18 @@ bool RenderingDebugger::GetBreakOnError() const
     return pimpl_->isBreakOnErrorEnabled;
 }
 
+// Returns the thread local string to format debugger messages into. Its capacity is retained, so repeated messages don't allocate memory.
+static std::string& GetMessageBuffer()
+{
+    static thread_local std::string buffer;
+    buffer.clear();
+    return buffer;
+}
+
 void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
 {
     /* Print formatted string */
-    std::string message;
+    std::string& message = GetMessageBuffer();
     LLGL_STRING_PRINTF(message, format);
 
     /* Check if there is already an entry for the exact same message */
@@ -117,7 +194,7 @@ void RenderingDebugger::Errorf(const ErrorType type, const char* format, ...)
 void RenderingDebugger::Warningf(const WarningType type, const char* format, ...)
 {
     /* Print formatted string */
-    std::string message;
+    std::string& message = GetMessageBuffer();
     LLGL_STRING_PRINTF(message, format);
 
     /* Check if there is already an entry for the exact same message */
@@ -210,14 +287,58 @@ static void MergeProfileCommandBufferRecords(ProfileCommandBufferRecord& dst, co
     dst.dispatchCommands            += src.dispatchCommands         ;
 }
 
+static void MergeQueryPipelineStatistics(QueryPipelineStatistics& dst, const QueryPipelineStatistics& src)
+{
+    LLGL_ASSERT_STRUCT_FIELDS(QueryPipelineStatistics, 11);
+    dst.inputAssemblyVertices           += src.inputAssemblyVertices            ;
+    dst.inputAssemblyPrimitives         += src.inputAssemblyPrimitives          ;
+    dst.vertexShaderInvocations         += src.vertexShaderInvocations          ;
+    dst.geometryShaderInvocations       += src.geometryShaderInvocations        ;
+    dst.geometryShaderPrimitives        += src.geometryShaderPrimitives         ;
+    dst.clippingInvocations             += src.clippingInvocations              ;
+    dst.clippingPrimitives              += src.clippingPrimitives               ;
+    dst.fragmentShaderInvocations       += src.fragmentShaderInvocations        ;
+    dst.tessControlShaderInvocations    += src.tessControlShaderInvocations     ;
+    dst.tessEvaluationShaderInvocations += src.tessEvaluationShaderInvocations  ;
+    dst.computeShaderInvocations        += src.computeShaderInvocations         ;
+}
+
+static void MergeProfileBackendRecords(ProfileBackendRecord& dst, const ProfileBackendRecord& src)
+{
+    static_assert(sizeof(ProfileBackendRecord) == sizeof(std::uint32_t)*4 + sizeof(std::uint64_t), "unexpected number of fields in struct 'LLGL::ProfileBackendRecord'");
+    dst.redundantStateChanges       += src.redundantStateChanges    ;
+    dst.descriptorCopies            += src.descriptorCopies         ;
+    dst.descriptorSetAllocations    += src.descriptorSetAllocations ;
+    dst.barriers                    += src.barriers                 ;
+    dst.stagingUploadBytes          += src.stagingUploadBytes       ;
+}
+
 void RenderingDebugger::MergeProfiles(FrameProfile& dst, const FrameProfile& src)
 {
     /* Accumulate counters */
     MergeProfileCommandQueueRecords(dst.commandQueueRecord, src.commandQueueRecord);
     MergeProfileCommandBufferRecords(dst.commandBufferRecord, src.commandBufferRecord);
+    MergeProfileBackendRecords(dst.backendRecord, src.backendRecord);
 
     /* Append time records */
     dst.timeRecords.insert(dst.timeRecords.end(), src.timeRecords.begin(), src.timeRecords.end());
+
+    /* Append scope records and offset their parent indices to the new position in the destination list */
+    const std::uint32_t scopeOffset = static_cast<std::uint32_t>(dst.scopeRecords.size());
+    dst.scopeRecords.insert(dst.scopeRecords.end(), src.scopeRecords.begin(), src.scopeRecords.end());
+    for (std::size_t i = scopeOffset; i < dst.scopeRecords.size(); ++i)
+    {
+        ProfileScopeRecord& rec = dst.scopeRecords[i];
+        if (rec.parent != 0xFFFFFFFF)
+            rec.parent += scopeOffset;
+    }
+
+    /* Append event records */
+    dst.eventRecords.insert(dst.eventRecords.end(), src.eventRecords.begin(), src.eventRecords.end());
+
+    /* Append statistics records and accumulate pipeline statistics */
+    dst.statisticsRecords.insert(dst.statisticsRecords.end(), src.statisticsRecords.begin(), src.statisticsRecords.end());
+    MergeQueryPipelineStatistics(dst.pipelineStatistics, src.pipelineStatistics);
 }
 
 
@@ -93,79 +93,23 @@ static void ParseSpvExecutionMode(const SpirvInstruction& instr, SpirvReflect::S
     }
 }
 
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode)
+// Member name or offset of a structure type that is recorded until the push constant block is known.
+struct SpvMemberDecoration
 {
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
-
-    /* Parse each SPIR-V instruction in the module */
-    bool firstModeParsed = false;
-
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::Op::OpExecutionMode)
-        {
-            ParseSpvExecutionMode(instr, outExecutionMode);
-            firstModeParsed = true;
-        }
-        else if (firstModeParsed)
-        {
-            /* Stop parsing after we found all execution modes */
-            break;
-        }
-    }
-
-    return SpirvResult::NoError;
-}
-
-static spv::Id FindGlobalPushConstantVariableType(const SpirvModuleView& module)
-{
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::Op::OpVariable)
-        {
-            /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
-            auto storage = static_cast<spv::StorageClass>(instr.GetUInt32(0));
-            if (storage == spv::StorageClassPushConstant)
-            {
-                /* Return variable type; Must be OpTypePointer for push constants */
-                return instr.type;
-            }
-        }
-        else if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-    }
-    return 0;
-}
+    spv::Id         structId;
+    std::uint32_t   member;
+    const char*     name;   // Null for offset decorations.
+    std::uint32_t   offset;
+};
 
-static spv::Id FindPointerTypeSubtype(const SpirvModuleView& module, spv::Id pointerTypeId)
+static SpirvReflect::SpvBlockField& GetOrMakeBlockField(SpirvReflect::SpvBlock& block, std::uint32_t index)
 {
-    for (const SpirvInstruction& instr : module)
-    {
-        if (instr.opcode == spv::Op::OpTypePointer)
-        {
-            if (instr.result == pointerTypeId)
-            {
-                /* OpTypePointer ResultId StorageClass[0] SubTypeId[1] */
-                return instr.GetUInt32(1);
-            }
-        }
-        else if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-    }
-    return 0;
+    if (index >= block.fields.size())
+        block.fields.resize(index + 1);
+    return block.fields[index];
 }
 
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock)
+SpirvResult SpirvReflectModuleInfo(const SpirvModuleView& module, SpirvReflect::SpvModuleInfo& outModuleInfo)
 {
     /* Parse SPIR-V header */
     SpirvHeader header;
@@ -173,26 +117,26 @@ SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflec
     if (result != SpirvResult::NoError)
         return result;
 
-    /* Find global variable declaration with PushConstant storage class */
-    const spv::Id pushConstantVarId = FindGlobalPushConstantVariableType(module);
-    if (pushConstantVarId == 0)
-        return SpirvResult::NoError;
+    outModuleInfo = SpirvReflect::SpvModuleInfo{};
 
-    /* Find pointer subtype for push constant variable */
-    const spv::Id pushConstantTypeId = FindPointerTypeSubtype(module, pushConstantVarId);
-    if (pushConstantTypeId == 0)
-        return SpirvResult::IdTypeMismatch;
+    /*
+    Debug names and annotations precede the type declarations in a SPIR-V module,
+    so everything that depends on the push constant type is recorded first and resolved after the pass.
+    */
+    constexpr std::uint32_t invalidIndex = ~0u;
 
-    auto GetOrMakeBlockField = [&outBlock](std::uint32_t index) -> SpirvReflect::SpvBlockField&
-    {
-        if (index >= outBlock.fields.size())
-            outBlock.fields.resize(index + 1);
-        return outBlock.fields[index];
-    };
+    std::vector<std::uint32_t>          bindingPointIndices(header.idBound, invalidIndex);
+    std::vector<spv::Id>                pointerSubtypes(header.idBound, 0);
+    SpirvNameDecorations                names{ header.idBound };
+    std::vector<SpvMemberDecoration>    memberDecorations;
+    spv::Id                             pushConstantPointerTypeId = 0;
 
-    /* Now parse SPIR-V module for block name, its member names, and member offsets */
-    for (const SpirvInstruction& instr : module)
+    outModuleInfo.bindingPoints.reserve(header.idBound / 16u);
+
+    for (auto it = module.begin(); it != module.end(); ++it)
     {
+        SpirvInstruction instr = it.Get();
+
         if (instr.opcode == spv::Op::OpFunction)
         {
             /* No more declarations and decorations after first OpFunction instruction */
@@ -201,35 +145,97 @@ SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflec
 
         switch (instr.opcode)
         {
+            case spv::Op::OpExecutionMode:
+                /* OpExecutionMode EntryPoint[0] Mode[1] (Literals[2+]) */
+                if (instr.numOperands < 2)
+                    return SpirvResult::OperandOutOfBounds;
+                ParseSpvExecutionMode(instr, outModuleInfo.executionMode);
+                break;
+
             case spv::Op::OpName:
                 /* OpName Target[0] Name[1] */
                 if (instr.numOperands < 2)
                     return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
-                    outBlock.name = instr.GetString(1);
+                names.Set(instr.GetUInt32(0), instr.GetString(1));
                 break;
 
             case spv::Op::OpMemberName:
                 /* OpMemberName TypeId Member[0] Name[1] */
                 if (instr.numOperands < 2)
                     return SpirvResult::OperandOutOfBounds;
-                if (instr.type == pushConstantTypeId)
-                    GetOrMakeBlockField(instr.GetUInt32(0)).name = instr.GetString(1);
+                memberDecorations.push_back(SpvMemberDecoration{ instr.type, instr.GetUInt32(0), instr.GetString(1), 0 });
                 break;
 
+            case spv::Op::OpDecorate:
+            {
+                /* OpDecorate Target[0] Decoration[1] Value[2] */
+                if (instr.numOperands < 2)
+                    return SpirvResult::OperandOutOfBounds;
+
+                const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(1));
+                if (decoration == spv::DecorationDescriptorSet ||
+                    decoration == spv::DecorationBinding)
+                {
+                    if (instr.numOperands < 3)
+                        return SpirvResult::OperandOutOfBounds;
+
+                    const spv::Id varId = instr.GetUInt32(0);
+                    if (!(varId < header.idBound))
+                        return SpirvResult::IdOutOfBounds;
+
+                    /* Add entry for either binding or descriptor set */
+                    std::uint32_t& bindingPointIndex = bindingPointIndices[varId];
+                    if (bindingPointIndex == invalidIndex)
+                    {
+                        bindingPointIndex = static_cast<std::uint32_t>(outModuleInfo.bindingPoints.size());
+                        outModuleInfo.bindingPoints.push_back(SpirvReflect::SpvBindingPoint{});
+                        outModuleInfo.bindingPoints.back().id = varId;
+                    }
+
+                    SpirvReflect::SpvBindingPoint& binding = outModuleInfo.bindingPoints[bindingPointIndex];
+                    if (decoration == spv::DecorationDescriptorSet)
+                    {
+                        binding.set                 = instr.GetUInt32(2);
+                        binding.setWordOffset       = module.WordOffset(it) + 3;
+                    }
+                    else
+                    {
+                        binding.binding             = instr.GetUInt32(2);
+                        binding.bindingWordOffset   = module.WordOffset(it) + 3;
+                    }
+                }
+            }
+            break;
+
             case spv::Op::OpMemberDecorate:
                 /* OpMemberDecorate Target[0] Member[1] Decoration[2] (Values[3+]) */
                 if (instr.numOperands < 3)
                     return SpirvResult::OperandOutOfBounds;
-                if (instr.GetUInt32(0) == pushConstantTypeId)
+                if (static_cast<spv::Decoration>(instr.GetUInt32(2)) == spv::DecorationOffset)
                 {
-                    const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(2));
-                    if (decoration == spv::DecorationOffset)
-                    {
-                        if (instr.numOperands < 4)
-                            return SpirvResult::OperandOutOfBounds;
-                        GetOrMakeBlockField(instr.GetUInt32(1)).offset = instr.GetUInt32(3);
-                    }
+                    if (instr.numOperands < 4)
+                        return SpirvResult::OperandOutOfBounds;
+                    memberDecorations.push_back(SpvMemberDecoration{ instr.GetUInt32(0), instr.GetUInt32(1), nullptr, instr.GetUInt32(3) });
+                }
+                break;
+
+            case spv::Op::OpTypePointer:
+                /* OpTypePointer ResultId StorageClass[0] SubTypeId[1] */
+                if (instr.numOperands < 2)
+                    return SpirvResult::OperandOutOfBounds;
+                if (!(instr.result < header.idBound))
+                    return SpirvResult::IdOutOfBounds;
+                pointerSubtypes[instr.result] = instr.GetUInt32(1);
+                break;
+
+            case spv::Op::OpVariable:
+                /* OpVariable ResultType ResultId StorageClass[0] (Initializer[1]) */
+                if (instr.numOperands < 1)
+                    return SpirvResult::OperandOutOfBounds;
+                if (pushConstantPointerTypeId == 0 && static_cast<spv::StorageClass>(instr.GetUInt32(0)) == spv::StorageClassPushConstant)
+                {
+                    /* Store variable type; Must be OpTypePointer for push constants */
+                    pushConstantPointerTypeId = instr.type;
                 }
                 break;
 
@@ -238,81 +244,28 @@ SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflec
         }
     }
 
-    return SpirvResult::NoError;
-}
-
-static SpirvReflect::SpvBindingPoint* FindOrInsertBindingPoint(std::vector<SpirvReflect::SpvBindingPoint>& bindingPoints, spv::Id varId)
-{
-    /* Try to find binding point for specified variable ID */
-    std::size_t insertionPos = 0;
-    auto* bindingPoint = FindInSortedArray<SpirvReflect::SpvBindingPoint>(
-        bindingPoints.data(), bindingPoints.size(),
-        [varId](const SpirvReflect::SpvBindingPoint& entry) -> int
-        {
-            return (static_cast<int>(varId) - static_cast<int>(entry.id));
-        },
-        &insertionPos
-    );
-    if (bindingPoint == nullptr)
+    /* Resolve push constant block from its pointer type */
+    if (pushConstantPointerTypeId != 0)
     {
-        /* Insert new binding point */
-        bindingPoints.insert(bindingPoints.begin() + insertionPos, SpirvReflect::SpvBindingPoint{});
-        bindingPoint = &(bindingPoints[insertionPos]);
-    }
-    return bindingPoint;
-}
+        if (!(pushConstantPointerTypeId < header.idBound))
+            return SpirvResult::IdOutOfBounds;
 
-SpirvResult SpirvReflectBindingPoints(const SpirvModuleView& module, std::vector<SpirvReflect::SpvBindingPoint>& outBindingPoints)
-{
-    /* Parse SPIR-V header */
-    SpirvHeader header;
-    SpirvResult result = module.ReadHeader(header);
-    if (result != SpirvResult::NoError)
-        return result;
-
-    /* Now parse SPIR-V module for binding and descriptor set decorations */
-    const auto estimatedNumBindingPoints = header.idBound / 16u;
+        const spv::Id pushConstantTypeId = pointerSubtypes[pushConstantPointerTypeId];
+        if (pushConstantTypeId == 0)
+            return SpirvResult::IdTypeMismatch;
 
-    outBindingPoints.clear();
-    outBindingPoints.reserve(estimatedNumBindingPoints);
+        SpirvReflect::SpvBlock& block = outModuleInfo.pushConstants;
+        block.name = names.Get(pushConstantTypeId);
 
-    for (auto it = module.begin(); it != module.end(); ++it)
-    {
-        SpirvInstruction instr = it.Get();
-
-        if (instr.opcode == spv::Op::OpFunction)
-        {
-            /* No more declarations and decorations after first OpFunction instruction */
-            break;
-        }
-
-        if (instr.opcode == spv::Op::OpDecorate)
+        for (const SpvMemberDecoration& memberDecoration : memberDecorations)
         {
-            /* OpDecorate Target[0] Decoration[1] Value[2] */
-            if (instr.numOperands < 2)
-                return SpirvResult::OperandOutOfBounds;
-            const spv::Id varId = instr.GetUInt32(0);
-
-            /* Add entry for either binding or descriptor set */
-            const auto decoration = static_cast<spv::Decoration>(instr.GetUInt32(1));
-            if (decoration == spv::DecorationDescriptorSet ||
-                decoration == spv::DecorationBinding)
+            if (memberDecoration.structId == pushConstantTypeId)
             {
-                if (instr.numOperands < 3)
-                    return SpirvResult::OperandOutOfBounds;
-
-                auto* binding = FindOrInsertBindingPoint(outBindingPoints, varId);
-                binding->id = varId;
-                if (decoration == spv::DecorationDescriptorSet)
-                {
-                    binding->set                = instr.GetUInt32(2);
-                    binding->setWordOffset      = module.WordOffset(it) + 3;
-                }
+                SpirvReflect::SpvBlockField& field = GetOrMakeBlockField(block, memberDecoration.member);
+                if (memberDecoration.name != nullptr)
+                    field.name = memberDecoration.name;
                 else
-                {
-                    binding->binding            = instr.GetUInt32(2);
-                    binding->bindingWordOffset  = module.WordOffset(it) + 3;
-                }
+                    field.offset = memberDecoration.offset;
             }
         }
     }
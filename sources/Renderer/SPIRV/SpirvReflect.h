@@ -158,6 +158,17 @@ class SpirvReflect
             std::uint32_t   bindingWordOffset   = 0; // Word offset within the SPIR-V module of the binding point.
         };
 
+        /*
+        Compact reflection record of an entire SPIR-V module that is gathered in a single pass; see SpirvReflectModuleInfo().
+        All names refer to strings within the SPIR-V module, i.e. the module must outlive this record.
+        */
+        struct SpvModuleInfo
+        {
+            SpvExecutionMode                executionMode;
+            SpvBlock                        pushConstants;
+            std::vector<SpvBindingPoint>    bindingPoints;  // Binding points in the order of their first decoration.
+        };
+
     public:
 
         // Parse all instructions in the specified SPIR-V module.
@@ -252,14 +263,11 @@ class SpirvReflect
 };
 
 
-// Reflect the specified SPIR-V module only for the execution mode.
-SpirvResult SpirvReflectExecutionMode(const SpirvModuleView& module, SpirvReflect::SpvExecutionMode& outExecutionMode);
-
-// Reflect the specified SPIR-V module only for push constants.
-SpirvResult SpirvReflectPushConstants(const SpirvModuleView& module, SpirvReflect::SpvBlock& outBlock);
-
-// Reflect the specified SPIR-V module only for binding points (including their descriptor sets).
-SpirvResult SpirvReflectBindingPoints(const SpirvModuleView& module, std::vector<SpirvReflect::SpvBindingPoint>& outBindingPoints);
+/*
+Reflects the execution mode, push constants, and binding points (including their descriptor sets) of the specified SPIR-V module in a single pass.
+IDs are resolved with flat arrays indexed by the module's ID bound, so the cost is linear in the size of the module.
+*/
+SpirvResult SpirvReflectModuleInfo(const SpirvModuleView& module, SpirvReflect::SpvModuleInfo& outModuleInfo);
 
 
 } // /namespace LLGL
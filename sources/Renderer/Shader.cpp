@@ -17,6 +17,35 @@ Shader::Shader(const ShaderType type) :
 {
 }
 
+Shader::Shader(const ShaderDescriptor& shaderDesc) :
+    type_ { shaderDesc.type }
+{
+    if (shaderDesc.reflectionData != nullptr && shaderDesc.reflectionDataSize > 0)
+    {
+        /* Deserialize reflection once; invalid data is ignored, so the shader is reflected at runtime instead */
+        ShaderReflection* reflection = new ShaderReflection{};
+        if (DeserializeShaderReflection(shaderDesc.reflectionData, shaderDesc.reflectionDataSize, *reflection))
+            serializedReflection_ = reflection;
+        else
+            delete reflection;
+    }
+}
+
+Shader::~Shader()
+{
+    delete serializedReflection_;
+}
+
+bool Shader::GetSerializedReflection(ShaderReflection& outReflection) const
+{
+    if (serializedReflection_ != nullptr)
+    {
+        outReflection = *serializedReflection_;
+        return true;
+    }
+    return false;
+}
+
 
 } // /namespace LLGL
 
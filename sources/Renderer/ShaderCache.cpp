@@ -0,0 +1,301 @@
+/*
+ * ShaderCache.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "ShaderCache.h"
+#include "../Core/HashUtils.h"
+#include "../Platform/MappedFile.h"
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+#include "../Core/PackStructPush.inl"
+
+struct ShaderCacheHeader
+{
+    char            magic[4];
+    std::uint32_t   version;
+    std::uint32_t   numEntries;
+    std::uint32_t   reserved;
+}
+LLGL_PACK_STRUCT;
+
+struct ShaderCacheEntry
+{
+    std::uint64_t   key;
+    std::uint64_t   offset;     // Offset (in bytes) from the beginning of the archive.
+    std::uint64_t   size;
+    std::uint64_t   dataHash;
+}
+LLGL_PACK_STRUCT;
+
+#include "../Core/PackStructPop.inl"
+
+static const char          g_archiveMagic[4]    = { 'L', 'L', 'S', 'C' };
+static const std::uint32_t g_archiveVersion     = 1;
+static const std::uint64_t g_archiveAlignment   = 4;
+
+ShaderCache::ShaderCache()
+{
+    // dummy
+}
+
+ShaderCache::~ShaderCache()
+{
+    Flush();
+}
+
+void ShaderCache::Open(const char* filename)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    filename_ = (filename != nullptr ? filename : "");
+    newEntries_.clear();
+    MapArchive();
+}
+
+Blob ShaderCache::Read(std::uint64_t key) const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Prefer entries that have been written during this run */
+    auto it = newEntries_.find(key);
+    if (it != newEntries_.end())
+        return Blob::CreateCopy(it->second.data(), it->second.size());
+
+    if (const ShaderCacheEntry* entry = FindMappedEntry(key))
+    {
+        /* Reject corrupted entries, so invalid bytecode is never handed to the driver */
+        const char* data = static_cast<const char*>(mappedFile_->GetData()) + entry->offset;
+        const std::size_t size = static_cast<std::size_t>(entry->size);
+        if (GetHash(data, size) == entry->dataHash)
+            return Blob::CreateWeakRef(data, size);
+    }
+
+    return Blob{};
+}
+
+void ShaderCache::Write(std::uint64_t key, const void* data, std::size_t size)
+{
+    if (data == nullptr || size == 0)
+        return;
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (!IsOpen())
+        return;
+
+    const char* bytes = static_cast<const char*>(data);
+    newEntries_[key] = std::vector<char>(bytes, bytes + size);
+}
+
+void ShaderCache::Flush()
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    if (!IsOpen() || newEntries_.empty())
+        return;
+
+    /* Merge entries from mapped archive with new entries; both sequences are sorted by key */
+    struct MergedEntry
+    {
+        std::uint64_t   key;
+        const char*     data;
+        std::size_t     size;
+    };
+
+    std::vector<MergedEntry> mergedEntries;
+    mergedEntries.reserve(numMappedEntries_ + newEntries_.size());
+
+    const char* mappedData = (mappedFile_ ? static_cast<const char*>(mappedFile_->GetData()) : nullptr);
+    std::uint32_t mappedEntryIndex = 0;
+
+    for (const auto& newEntry : newEntries_)
+    {
+        for (; mappedEntryIndex < numMappedEntries_ && mappedEntries_[mappedEntryIndex].key < newEntry.first; ++mappedEntryIndex)
+        {
+            const ShaderCacheEntry& entry = mappedEntries_[mappedEntryIndex];
+            mergedEntries.push_back({ entry.key, mappedData + entry.offset, static_cast<std::size_t>(entry.size) });
+        }
+        if (mappedEntryIndex < numMappedEntries_ && mappedEntries_[mappedEntryIndex].key == newEntry.first)
+            ++mappedEntryIndex;
+        mergedEntries.push_back({ newEntry.first, newEntry.second.data(), newEntry.second.size() });
+    }
+
+    for (; mappedEntryIndex < numMappedEntries_; ++mappedEntryIndex)
+    {
+        const ShaderCacheEntry& entry = mappedEntries_[mappedEntryIndex];
+        mergedEntries.push_back({ entry.key, mappedData + entry.offset, static_cast<std::size_t>(entry.size) });
+    }
+
+    /* Build header and entry table; data of each entry is aligned to 4 bytes, e.g. for SPIR-V words */
+    ShaderCacheHeader header;
+    {
+        ::memcpy(header.magic, g_archiveMagic, sizeof(g_archiveMagic));
+        header.version      = g_archiveVersion;
+        header.numEntries   = static_cast<std::uint32_t>(mergedEntries.size());
+        header.reserved     = 0;
+    }
+
+    std::vector<ShaderCacheEntry> entryTable(mergedEntries.size());
+    std::uint64_t offset = sizeof(ShaderCacheHeader) + sizeof(ShaderCacheEntry) * entryTable.size();
+
+    for (std::size_t i = 0; i < mergedEntries.size(); ++i)
+    {
+        offset = (offset + g_archiveAlignment - 1) / g_archiveAlignment * g_archiveAlignment;
+        entryTable[i].key       = mergedEntries[i].key;
+        entryTable[i].offset    = offset;
+        entryTable[i].size      = mergedEntries[i].size;
+        entryTable[i].dataHash  = GetHash(mergedEntries[i].data, mergedEntries[i].size);
+        offset += mergedEntries[i].size;
+    }
+
+    /* Write into temporary file first, so concurrent readers and crashed writes never observe partial archives */
+    const std::string tempFilename = filename_ + ".tmp";
+
+    FILE* file = ::fopen(tempFilename.c_str(), "wb");
+    if (file == nullptr)
+        return;
+
+    bool succeeded =
+    (
+        ::fwrite(&header, sizeof(header), 1, file) == 1 &&
+        (entryTable.empty() || ::fwrite(entryTable.data(), sizeof(ShaderCacheEntry), entryTable.size(), file) == entryTable.size())
+    );
+
+    std::uint64_t filePos = sizeof(ShaderCacheHeader) + sizeof(ShaderCacheEntry) * entryTable.size();
+    for (std::size_t i = 0; succeeded && i < mergedEntries.size(); ++i)
+    {
+        static const char padding[g_archiveAlignment] = {};
+        const std::size_t paddingSize = static_cast<std::size_t>(entryTable[i].offset - filePos);
+        if (paddingSize > 0 && ::fwrite(padding, paddingSize, 1, file) != 1)
+            succeeded = false;
+        else if (::fwrite(mergedEntries[i].data, mergedEntries[i].size, 1, file) != 1)
+            succeeded = false;
+        filePos = entryTable[i].offset + entryTable[i].size;
+    }
+
+    if (::fclose(file) == 0 && succeeded)
+    {
+        /* Release previous mapping before the archive is replaced; std::rename() does not overwrite existing files on all platforms */
+        mappedEntries_      = nullptr;
+        numMappedEntries_   = 0;
+        mappedFile_.reset();
+        newEntries_.clear();
+
+        ::remove(filename_.c_str());
+        ::rename(tempFilename.c_str(), filename_.c_str());
+
+        MapArchive();
+    }
+    else
+        ::remove(tempFilename.c_str());
+}
+
+std::uint64_t ShaderCache::GetKey(
+    const char*             compilerID,
+    std::uint32_t           compilerVersion,
+    const ShaderDescriptor& shaderDesc,
+    const char*             sourceCode,
+    std::size_t             sourceSize)
+{
+    std::uint64_t seed = g_hashSeed;
+
+    HashString(seed, compilerID);
+    HashValue(seed, compilerVersion);
+    HashValue(seed, shaderDesc.type);
+    HashValue(seed, static_cast<std::uint64_t>(sourceSize));
+    HashBytes(seed, sourceCode, sourceSize);
+    HashString(seed, shaderDesc.entryPoint);
+    HashString(seed, shaderDesc.profile);
+
+    if (shaderDesc.defines != nullptr)
+    {
+        for (const ShaderMacro* define = shaderDesc.defines; define->name != nullptr; ++define)
+        {
+            HashString(seed, define->name);
+            HashString(seed, define->definition);
+        }
+    }
+
+    /* Terminate macro list, so macros and flags can't alias each other */
+    HashBytes(seed, "", 1);
+    HashValue(seed, shaderDesc.flags);
+
+    return seed;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+const ShaderCacheEntry* ShaderCache::FindMappedEntry(std::uint64_t key) const
+{
+    const ShaderCacheEntry* first   = mappedEntries_;
+    const ShaderCacheEntry* last    = mappedEntries_ + numMappedEntries_;
+    const ShaderCacheEntry* entry   = std::lower_bound(
+        first, last, key,
+        [](const ShaderCacheEntry& lhs, std::uint64_t rhs) -> bool
+        {
+            return (lhs.key < rhs);
+        }
+    );
+    return (entry != last && entry->key == key ? entry : nullptr);
+}
+
+void ShaderCache::MapArchive()
+{
+    mappedEntries_      = nullptr;
+    numMappedEntries_   = 0;
+    mappedFile_.reset();
+
+    if (filename_.empty())
+        return;
+
+    std::unique_ptr<MappedFile> mappedFile = MappedFile::Open(filename_.c_str());
+    if (!mappedFile || mappedFile->GetSize() < sizeof(ShaderCacheHeader))
+        return;
+
+    /* Validate header */
+    const char* data = static_cast<const char*>(mappedFile->GetData());
+    const std::uint64_t fileSize = mappedFile->GetSize();
+
+    ShaderCacheHeader header;
+    ::memcpy(&header, data, sizeof(header));
+
+    if (::memcmp(header.magic, g_archiveMagic, sizeof(g_archiveMagic)) != 0 ||
+        header.version != g_archiveVersion ||
+        sizeof(ShaderCacheHeader) + sizeof(ShaderCacheEntry) * static_cast<std::uint64_t>(header.numEntries) > fileSize)
+    {
+        return;
+    }
+
+    /* Validate entry table: keys must be sorted for the binary search and all entries must be inside the file */
+    const ShaderCacheEntry* entries = reinterpret_cast<const ShaderCacheEntry*>(data + sizeof(ShaderCacheHeader));
+    for (std::uint32_t i = 0; i < header.numEntries; ++i)
+    {
+        if (entries[i].offset > fileSize || entries[i].size > fileSize - entries[i].offset)
+            return;
+        if (i > 0 && entries[i - 1].key >= entries[i].key)
+            return;
+    }
+
+    mappedFile_         = std::move(mappedFile);
+    mappedEntries_      = entries;
+    numMappedEntries_   = header.numEntries;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,108 @@
+/*
+ * ShaderCache.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SHADER_CACHE_H
+#define LLGL_SHADER_CACHE_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/Blob.h>
+#include <LLGL/ShaderFlags.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class MappedFile;
+struct ShaderCacheEntry;
+
+/*
+Persistent cache for compiled shader bytecode, see RenderSystemDescriptor::shaderCacheFilename.
+All entries are stored in a single archive file with a table of entries sorted by key, followed by the bytecode of all entries.
+The archive is memory mapped when it is opened, so a cache hit is a binary search in the mapped table that returns a weak reference into the mapping.
+New entries are kept in memory and the archive is rewritten when the cache is destroyed.
+*/
+class LLGL_EXPORT ShaderCache
+{
+
+    public:
+
+        ShaderCache();
+        ~ShaderCache();
+
+        ShaderCache(const ShaderCache&) = delete;
+        ShaderCache& operator = (const ShaderCache&) = delete;
+
+        // Maps the archive with the specified filename. A null pointer or empty string disables this cache.
+        // A missing or invalid archive results in an empty cache that is still written back on destruction.
+        void Open(const char* filename);
+
+        // Returns true if this cache has been opened, i.e. a filename has been specified.
+        inline bool IsOpen() const
+        {
+            return !filename_.empty();
+        }
+
+        // Returns the entry with the specified key or an empty blob if there is no valid entry.
+        // Blobs for entries from the archive are weak references into the mapped file and remain valid for the lifetime of this cache.
+        Blob Read(std::uint64_t key) const;
+
+        // Stores a copy of the specified bytecode with the specified key. Existing entries for this key are replaced.
+        void Write(std::uint64_t key, const void* data, std::size_t size);
+
+        // Writes all entries back to the archive file if any new entries have been stored.
+        void Flush();
+
+    public:
+
+        // Returns the key for the specified shader descriptor and source code.
+        // The compiler ID and version must identify the shader compiler, so bytecode from a different compiler is never handed to the backend.
+        // The descriptor's source is ignored in favor of the specified source code, which is the file content for ShaderSourceType::CodeFile.
+        // Files that are included by the source code are not part of the key.
+        static std::uint64_t GetKey(
+            const char*             compilerID,
+            std::uint32_t           compilerVersion,
+            const ShaderDescriptor& shaderDesc,
+            const char*             sourceCode,
+            std::size_t             sourceSize
+        );
+
+    private:
+
+        // Returns the entry with the specified key from the mapped archive or null if there is no such entry.
+        const ShaderCacheEntry* FindMappedEntry(std::uint64_t key) const;
+
+        // Maps the archive and validates its entry table. The mapping is released if the archive is invalid.
+        void MapArchive();
+
+    private:
+
+        std::string                                 filename_;
+        std::unique_ptr<MappedFile>                 mappedFile_;
+        const ShaderCacheEntry*                     mappedEntries_      = nullptr;
+        std::uint32_t                               numMappedEntries_   = 0;
+        std::map<std::uint64_t, std::vector<char>>  newEntries_;
+        mutable std::mutex                          mutex_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -33,6 +33,13 @@ LLGL_EXPORT long GetStageFlags(const ShaderType type)
         case ShaderType::Geometry:          return StageFlags::GeometryStage;
         case ShaderType::Fragment:          return StageFlags::FragmentStage;
         case ShaderType::Compute:           return StageFlags::ComputeStage;
+        case ShaderType::Task:              return StageFlags::TaskStage;
+        case ShaderType::Mesh:              return StageFlags::MeshStage;
+        case ShaderType::Tile:              return StageFlags::TileStage;
+        case ShaderType::RayGeneration:     return StageFlags::RayGenerationStage;
+        case ShaderType::Miss:              return StageFlags::MissStage;
+        case ShaderType::ClosestHit:        return StageFlags::ClosestHitStage;
+        case ShaderType::AnyHit:            return StageFlags::AnyHitStage;
     }
     return 0;
 }
@@ -0,0 +1,320 @@
+/*
+ * ShaderReflection.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/ShaderReflection.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/VertexAttribute.h>
+#include <LLGL/FragmentAttribute.h>
+#include <LLGL/Container/StringView.h>
+#include <vector>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+Layout of a serialized shader reflection; all values are 32-bit words in native byte order:
+  Header            magic, version, number of resources, uniforms, vertex inputs, vertex outputs, and fragment outputs
+  Compute           work group size (width, height, depth)
+  Resources[]       name, type, bindFlags, stageFlags, slot.index, slot.set, arraySize, constantBufferSize, storageBufferType
+  Uniforms[]        name, type, arraySize
+  VertexInputs[]    name, format, location, semanticIndex, systemValue, slot, offset, stride, instanceDivisor
+  VertexOutputs[]   (same as VertexInputs)
+  FragmentOutputs[] name, format, location, systemValue
+Strings are stored as their length followed by their characters padded to the next word boundary.
+*/
+static constexpr std::uint32_t g_shaderReflectionMagic      = 0x52534C4C; // 'LLSR'
+static constexpr std::uint32_t g_shaderReflectionVersion    = 1;
+
+// Helper class to write a serialized shader reflection into a byte buffer.
+class ShaderReflectionWriter
+{
+
+    public:
+
+        void WriteUInt32(std::uint32_t value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            data_.insert(data_.end(), bytes, bytes + sizeof(value));
+        }
+
+        template <typename T>
+        void WriteEnum(T value)
+        {
+            WriteUInt32(static_cast<std::uint32_t>(value));
+        }
+
+        void WriteString(const StringLiteral& str)
+        {
+            const std::size_t len = str.size();
+            WriteUInt32(static_cast<std::uint32_t>(len));
+            data_.insert(data_.end(), str.c_str(), str.c_str() + len);
+            data_.resize((data_.size() + 3u) & ~std::size_t(3u), '\0');
+        }
+
+        inline std::vector<char>& GetData()
+        {
+            return data_;
+        }
+
+    private:
+
+        std::vector<char> data_;
+
+};
+
+// Helper class to read a serialized shader reflection from a byte buffer with bounds checking.
+class ShaderReflectionReader
+{
+
+    public:
+
+        ShaderReflectionReader(const void* data, std::size_t size) :
+            data_ { static_cast<const char*>(data) },
+            size_ { size                           }
+        {
+        }
+
+        bool ReadUInt32(std::uint32_t& outValue)
+        {
+            if (GetRemainingSize() < sizeof(std::uint32_t))
+                return false;
+            ::memcpy(&outValue, data_ + pos_, sizeof(std::uint32_t));
+            pos_ += sizeof(std::uint32_t);
+            return true;
+        }
+
+        template <typename T>
+        bool ReadEnum(T& outValue)
+        {
+            std::uint32_t value = 0;
+            if (!ReadUInt32(value))
+                return false;
+            outValue = static_cast<T>(value);
+            return true;
+        }
+
+        bool ReadString(StringLiteral& outStr)
+        {
+            std::uint32_t len = 0;
+            if (!ReadUInt32(len))
+                return false;
+            const std::size_t paddedLen = (static_cast<std::size_t>(len) + 3u) & ~std::size_t(3u);
+            if (GetRemainingSize() < paddedLen)
+                return false;
+            outStr = StringView{ data_ + pos_, len };
+            pos_ += paddedLen;
+            return true;
+        }
+
+        // Reads the number of elements of an array and rejects counts that cannot fit into the remaining data.
+        bool ReadCount(std::uint32_t& outCount, std::size_t minElementSize)
+        {
+            if (!ReadUInt32(outCount))
+                return false;
+            return (outCount <= GetRemainingSize() / minElementSize);
+        }
+
+        inline std::size_t GetRemainingSize() const
+        {
+            return (size_ - pos_);
+        }
+
+    private:
+
+        const char*     data_   = nullptr;
+        std::size_t     size_   = 0;
+        std::size_t     pos_    = 0;
+
+};
+
+// Minimum serialized sizes of each array element, i.e. with empty names, to validate array sizes before any allocation.
+static constexpr std::size_t g_minResourceSize          = sizeof(std::uint32_t) * 9;
+static constexpr std::size_t g_minUniformSize           = sizeof(std::uint32_t) * 3;
+static constexpr std::size_t g_minVertexAttribSize      = sizeof(std::uint32_t) * 9;
+static constexpr std::size_t g_minFragmentAttribSize    = sizeof(std::uint32_t) * 4;
+
+static void WriteVertexAttribute(ShaderReflectionWriter& writer, const VertexAttribute& attrib)
+{
+    writer.WriteString(attrib.name);
+    writer.WriteEnum(attrib.format);
+    writer.WriteUInt32(attrib.location);
+    writer.WriteUInt32(attrib.semanticIndex);
+    writer.WriteEnum(attrib.systemValue);
+    writer.WriteUInt32(attrib.slot);
+    writer.WriteUInt32(attrib.offset);
+    writer.WriteUInt32(attrib.stride);
+    writer.WriteUInt32(attrib.instanceDivisor);
+}
+
+static bool ReadVertexAttribute(ShaderReflectionReader& reader, VertexAttribute& attrib)
+{
+    return
+    (
+        reader.ReadString(attrib.name)              &&
+        reader.ReadEnum(attrib.format)              &&
+        reader.ReadUInt32(attrib.location)          &&
+        reader.ReadUInt32(attrib.semanticIndex)     &&
+        reader.ReadEnum(attrib.systemValue)         &&
+        reader.ReadUInt32(attrib.slot)              &&
+        reader.ReadUInt32(attrib.offset)            &&
+        reader.ReadUInt32(attrib.stride)            &&
+        reader.ReadUInt32(attrib.instanceDivisor)
+    );
+}
+
+LLGL_EXPORT Blob SerializeShaderReflection(const ShaderReflection& reflection)
+{
+    ShaderReflectionWriter writer;
+
+    /* Write header */
+    writer.WriteUInt32(g_shaderReflectionMagic);
+    writer.WriteUInt32(g_shaderReflectionVersion);
+    writer.WriteUInt32(static_cast<std::uint32_t>(reflection.resources.size()));
+    writer.WriteUInt32(static_cast<std::uint32_t>(reflection.uniforms.size()));
+    writer.WriteUInt32(static_cast<std::uint32_t>(reflection.vertex.inputAttribs.size()));
+    writer.WriteUInt32(static_cast<std::uint32_t>(reflection.vertex.outputAttribs.size()));
+    writer.WriteUInt32(static_cast<std::uint32_t>(reflection.fragment.outputAttribs.size()));
+
+    /* Write compute shader attributes */
+    writer.WriteUInt32(reflection.compute.workGroupSize.width);
+    writer.WriteUInt32(reflection.compute.workGroupSize.height);
+    writer.WriteUInt32(reflection.compute.workGroupSize.depth);
+
+    /* Write resources */
+    for (const ShaderResourceReflection& resource : reflection.resources)
+    {
+        writer.WriteString(resource.binding.name);
+        writer.WriteEnum(resource.binding.type);
+        writer.WriteEnum(resource.binding.bindFlags);
+        writer.WriteEnum(resource.binding.stageFlags);
+        writer.WriteUInt32(resource.binding.slot.index);
+        writer.WriteUInt32(resource.binding.slot.set);
+        writer.WriteUInt32(resource.binding.arraySize);
+        writer.WriteUInt32(resource.constantBufferSize);
+        writer.WriteEnum(resource.storageBufferType);
+    }
+
+    /* Write uniforms */
+    for (const UniformDescriptor& uniform : reflection.uniforms)
+    {
+        writer.WriteString(uniform.name);
+        writer.WriteEnum(uniform.type);
+        writer.WriteUInt32(uniform.arraySize);
+    }
+
+    /* Write vertex and fragment attributes */
+    for (const VertexAttribute& attrib : reflection.vertex.inputAttribs)
+        WriteVertexAttribute(writer, attrib);
+    for (const VertexAttribute& attrib : reflection.vertex.outputAttribs)
+        WriteVertexAttribute(writer, attrib);
+
+    for (const FragmentAttribute& attrib : reflection.fragment.outputAttribs)
+    {
+        writer.WriteString(attrib.name);
+        writer.WriteEnum(attrib.format);
+        writer.WriteUInt32(attrib.location);
+        writer.WriteEnum(attrib.systemValue);
+    }
+
+    return Blob::CreateStrongRef(std::move(writer.GetData()));
+}
+
+LLGL_EXPORT bool DeserializeShaderReflection(const void* data, std::size_t size, ShaderReflection& outReflection)
+{
+    if (data == nullptr)
+        return false;
+
+    ShaderReflectionReader reader{ data, size };
+
+    /* Read and validate header */
+    std::uint32_t magic = 0, version = 0;
+    if (!reader.ReadUInt32(magic) || magic != g_shaderReflectionMagic)
+        return false;
+    if (!reader.ReadUInt32(version) || version != g_shaderReflectionVersion)
+        return false;
+
+    std::uint32_t numResources = 0, numUniforms = 0, numVertexInputs = 0, numVertexOutputs = 0, numFragmentOutputs = 0;
+    if (!reader.ReadCount(numResources,       g_minResourceSize       ) ||
+        !reader.ReadCount(numUniforms,        g_minUniformSize        ) ||
+        !reader.ReadCount(numVertexInputs,    g_minVertexAttribSize   ) ||
+        !reader.ReadCount(numVertexOutputs,   g_minVertexAttribSize   ) ||
+        !reader.ReadCount(numFragmentOutputs, g_minFragmentAttribSize ))
+    {
+        return false;
+    }
+
+    /* Read compute shader attributes */
+    Extent3D& workGroupSize = outReflection.compute.workGroupSize;
+    if (!reader.ReadUInt32(workGroupSize.width) || !reader.ReadUInt32(workGroupSize.height) || !reader.ReadUInt32(workGroupSize.depth))
+        return false;
+
+    /* Read resources */
+    outReflection.resources.resize(numResources);
+    for (ShaderResourceReflection& resource : outReflection.resources)
+    {
+        if (!(reader.ReadString(resource.binding.name)          &&
+              reader.ReadEnum(resource.binding.type)            &&
+              reader.ReadEnum(resource.binding.bindFlags)       &&
+              reader.ReadEnum(resource.binding.stageFlags)      &&
+              reader.ReadUInt32(resource.binding.slot.index)    &&
+              reader.ReadUInt32(resource.binding.slot.set)      &&
+              reader.ReadUInt32(resource.binding.arraySize)     &&
+              reader.ReadUInt32(resource.constantBufferSize)    &&
+              reader.ReadEnum(resource.storageBufferType)))
+        {
+            return false;
+        }
+    }
+
+    /* Read uniforms */
+    outReflection.uniforms.resize(numUniforms);
+    for (UniformDescriptor& uniform : outReflection.uniforms)
+    {
+        if (!(reader.ReadString(uniform.name) && reader.ReadEnum(uniform.type) && reader.ReadUInt32(uniform.arraySize)))
+            return false;
+    }
+
+    /* Read vertex and fragment attributes */
+    outReflection.vertex.inputAttribs.resize(numVertexInputs);
+    for (VertexAttribute& attrib : outReflection.vertex.inputAttribs)
+    {
+        if (!ReadVertexAttribute(reader, attrib))
+            return false;
+    }
+
+    outReflection.vertex.outputAttribs.resize(numVertexOutputs);
+    for (VertexAttribute& attrib : outReflection.vertex.outputAttribs)
+    {
+        if (!ReadVertexAttribute(reader, attrib))
+            return false;
+    }
+
+    outReflection.fragment.outputAttribs.resize(numFragmentOutputs);
+    for (FragmentAttribute& attrib : outReflection.fragment.outputAttribs)
+    {
+        if (!(reader.ReadString(attrib.name)        &&
+              reader.ReadEnum(attrib.format)        &&
+              reader.ReadUInt32(attrib.location)    &&
+              reader.ReadEnum(attrib.systemValue)))
+        {
+            return false;
+        }
+    }
+
+    /* Reject trailing data, since it indicates a mismatch between writer and reader */
+    return (reader.GetRemainingSize() == 0);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
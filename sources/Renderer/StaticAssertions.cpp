@@ -6,6 +6,7 @@
  */
 
 #include "StaticAssertions.h"
+#include "FormatTable.h"
 #include <LLGL/Format.h>
 #include <LLGL/IndirectArguments.h>
 #include <LLGL/QueryHeapFlags.h>
@@ -22,6 +23,13 @@ LLGL_ASSERT_STDLAYOUT_STRUCT( DrawPatchIndirectArguments );
 LLGL_ASSERT_STDLAYOUT_STRUCT( DispatchIndirectArguments );
 LLGL_ASSERT_STDLAYOUT_STRUCT( QueryPipelineStatistics );
 
+// Format queries must fold at compile time
+static_assert(FormatTable::GetAttribs(Format::RGBA8UNorm).bitSize == 32, "FormatTable::GetAttribs() must be a constant expression");
+static_assert(FormatTable::IsDepthAndStencilFormat(Format::D24UNormS8UInt), "FormatTable::IsDepthAndStencilFormat() must be a constant expression");
+static_assert(FormatTable::IsCompressedFormat(Format::BC1UNorm), "FormatTable::IsCompressedFormat() must be a constant expression");
+static_assert(FormatTable::GetMemoryFootprint(Format::BC1UNorm, 16) == 8, "FormatTable::GetMemoryFootprint() must be a constant expression");
+static_assert(FormatTable::GetMemoryFootprint(ImageFormat::RGBA, DataType::Float32, 2) == 32, "FormatTable::GetMemoryFootprint() must be a constant expression");
+
 
 } // /namespace LLGL
 
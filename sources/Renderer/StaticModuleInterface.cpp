@@ -44,6 +44,10 @@ LLGL_DECLARE_STATIC_MODULE_INTERFACE(OpenGLES3);
 LLGL_DECLARE_STATIC_MODULE_INTERFACE(WebGL);
 #endif
 
+#if LLGL_BUILD_RENDERER_WEBGPU
+LLGL_DECLARE_STATIC_MODULE_INTERFACE(WebGPU);
+#endif
+
 #if LLGL_BUILD_RENDERER_VULKAN
 LLGL_DECLARE_STATIC_MODULE_INTERFACE(Vulkan);
 #endif
@@ -87,6 +91,9 @@ std::vector<std::string> GetStaticModules()
         #if LLGL_BUILD_RENDERER_OPENGLES3
         ModuleOpenGLES3::GetModuleName(),
         #endif
+        #if LLGL_BUILD_RENDERER_WEBGPU
+        ModuleWebGPU::GetModuleName(),
+        #endif
         #if LLGL_BUILD_RENDERER_WEBGL
         ModuleWebGL::GetModuleName(),
         #endif
@@ -118,6 +125,10 @@ const char* GetRendererName(const StringLiteral& moduleName)
     LLGL_GET_RENDERER_NAME(ModuleWebGL);
     #endif
 
+    #if LLGL_BUILD_RENDERER_WEBGPU
+    LLGL_GET_RENDERER_NAME(ModuleWebGPU);
+    #endif
+
     #if LLGL_BUILD_RENDERER_VULKAN
     LLGL_GET_RENDERER_NAME(ModuleVulkan);
     #endif
@@ -161,6 +172,10 @@ int GetRendererID(const StringLiteral& moduleName)
     LLGL_GET_RENDERER_ID(ModuleWebGL);
     #endif
 
+    #if LLGL_BUILD_RENDERER_WEBGPU
+    LLGL_GET_RENDERER_ID(ModuleWebGPU);
+    #endif
+
     #if LLGL_BUILD_RENDERER_VULKAN
     LLGL_GET_RENDERER_ID(ModuleVulkan);
     #endif
@@ -204,6 +219,10 @@ RenderSystem* AllocRenderSystem(const RenderSystemDescriptor& renderSystemDesc)
     LLGL_ALLOC_RENDER_SYSTEM(ModuleWebGL);
     #endif
 
+    #if LLGL_BUILD_RENDERER_WEBGPU
+    LLGL_ALLOC_RENDER_SYSTEM(ModuleWebGPU);
+    #endif
+
     #if LLGL_BUILD_RENDERER_VULKAN
     LLGL_ALLOC_RENDER_SYSTEM(ModuleVulkan);
     #endif
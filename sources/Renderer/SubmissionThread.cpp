@@ -0,0 +1,167 @@
+/*
+ * SubmissionThread.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "SubmissionThread.h"
+
+
+namespace LLGL
+{
+
+
+SubmissionThread::SubmissionThread(std::size_t capacity) :
+    jobs_   { capacity                     },
+    thread_ { &SubmissionThread::Run, this }
+{
+}
+
+SubmissionThread::~SubmissionThread()
+{
+    /* Wait for all pending jobs without rethrowing their exceptions from the destructor */
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        jobCompleted_.wait(
+            lock,
+            [this]()
+            {
+                return (numCompleted_.load(std::memory_order_acquire) >= numEnqueued_.load(std::memory_order_acquire));
+            }
+        );
+        quit_ = true;
+    }
+    jobEnqueued_.notify_one();
+    thread_.join();
+}
+
+std::uint64_t SubmissionThread::Enqueue(Job&& job)
+{
+    /* Jobs that enqueue other jobs must not wait for themselves, so execute them immediately */
+    if (IsWorkerThread())
+    {
+        job();
+        return 0;
+    }
+
+    std::uint64_t ticket = 0;
+    {
+        std::lock_guard<std::mutex> guard{ enqueueMutex_ };
+        while (!jobs_.Push(std::move(job)))
+            std::this_thread::yield();
+        ticket = numEnqueued_.load(std::memory_order_relaxed) + 1;
+        numEnqueued_.store(ticket, std::memory_order_release);
+    }
+
+    /* Acquire the lock before waking up the worker thread, so it can't miss the new ticket between checking for work and going to sleep */
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+    }
+    jobEnqueued_.notify_one();
+
+    return ticket;
+}
+
+void SubmissionThread::Wait(std::uint64_t ticket)
+{
+    /* The worker thread executes all jobs in order, so it never has to wait for any of them */
+    if (IsWorkerThread())
+        return;
+
+    if (!IsCompleted(ticket))
+    {
+        std::unique_lock<std::mutex> lock{ mutex_ };
+        jobCompleted_.wait(lock, [this, ticket]() { return IsCompleted(ticket); });
+    }
+
+    if (hasPendingException_.load(std::memory_order_acquire))
+        RethrowPendingException();
+}
+
+void SubmissionThread::Flush()
+{
+    Wait(numEnqueued_.load(std::memory_order_acquire));
+}
+
+bool SubmissionThread::IsCompleted(std::uint64_t ticket) const
+{
+    return (numCompleted_.load(std::memory_order_acquire) >= ticket);
+}
+
+bool SubmissionThread::IsWorkerThread() const
+{
+    return (std::this_thread::get_id() == thread_.get_id());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void SubmissionThread::Run()
+{
+    for (;;)
+    {
+        Job job;
+        if (jobs_.Pop(job))
+        {
+            /* Keep the first exception until the next wait, so it's thrown on the thread that enqueued the job */
+            try
+            {
+                job();
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                if (!pendingException_)
+                {
+                    pendingException_ = std::current_exception();
+                    hasPendingException_.store(true, std::memory_order_release);
+                }
+            }
+
+            /* Release all captured objects before the ticket is reported as completed */
+            job = nullptr;
+            {
+                std::lock_guard<std::mutex> guard{ mutex_ };
+                numCompleted_.fetch_add(1, std::memory_order_release);
+            }
+            jobCompleted_.notify_all();
+        }
+        else
+        {
+            /* Sleep until a new job has been enqueued; Jobs that were pushed but not counted yet are popped once the producer has woken up this thread */
+            std::unique_lock<std::mutex> lock{ mutex_ };
+            if (quit_)
+                break;
+            jobEnqueued_.wait(
+                lock,
+                [this]()
+                {
+                    return (quit_ || numCompleted_.load(std::memory_order_relaxed) < numEnqueued_.load(std::memory_order_acquire));
+                }
+            );
+        }
+    }
+}
+
+void SubmissionThread::RethrowPendingException()
+{
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> guard{ mutex_ };
+        exception = std::move(pendingException_);
+        pendingException_ = nullptr;
+        hasPendingException_.store(false, std::memory_order_release);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
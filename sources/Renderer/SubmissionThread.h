@@ -0,0 +1,100 @@
+/*
+ * SubmissionThread.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_SUBMISSION_THREAD_H
+#define LLGL_SUBMISSION_THREAD_H
+
+
+#include <LLGL/Export.h>
+#include "../Core/ConcurrentRingBuffer.h"
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <cstdint>
+#include <cstddef>
+
+
+namespace LLGL
+{
+
+
+/*
+Dedicated worker thread that executes queue submissions and presentations in the order they were enqueued.
+Backends create this for RenderSystemFlags::SubmissionThread, so CommandQueue::Submit() and SwapChain::Present() return
+before the native submit or present call has returned, e.g. while vkQueuePresentKHR or IDXGISwapChain::Present blocks for vsync.
+Each job is identified by a ticket that increases monotonically; functions that access the native queue directly must wait for the pending tickets first.
+Producers are serialized with a lock, so tickets have the same order as the jobs, but the worker thread never acquires this lock, i.e. a blocking job never stalls Enqueue().
+*/
+class LLGL_EXPORT SubmissionThread
+{
+
+    public:
+
+        using Job = std::function<void()>;
+
+    public:
+
+        SubmissionThread(const SubmissionThread&) = delete;
+        SubmissionThread& operator = (const SubmissionThread&) = delete;
+
+        explicit SubmissionThread(std::size_t capacity = 64);
+
+        // Waits for all pending jobs and joins the worker thread.
+        ~SubmissionThread();
+
+        /*
+        Enqueues the specified job and returns its ticket. If the ring buffer is full, this yields until the worker thread has made room.
+        If this is called on the worker thread itself, the job is executed immediately and the return value is 0.
+        */
+        std::uint64_t Enqueue(Job&& job);
+
+        // Blocks until the job with the specified ticket has completed and rethrows the first exception that any job has thrown since the last wait.
+        void Wait(std::uint64_t ticket);
+
+        // Blocks until all jobs that have been enqueued so far have completed. See Wait().
+        void Flush();
+
+        // Returns true if the job with the specified ticket has completed. This never blocks.
+        bool IsCompleted(std::uint64_t ticket) const;
+
+        // Returns true if the calling thread is the worker thread of this object.
+        bool IsWorkerThread() const;
+
+    private:
+
+        void Run();
+
+        void RethrowPendingException();
+
+    private:
+
+        ConcurrentRingBuffer<Job>   jobs_;
+        std::mutex                  enqueueMutex_;                  // Serializes producers to keep tickets in the same order as the jobs
+        std::mutex                  mutex_;                         // Guards the condition variables and the pending exception
+        std::condition_variable     jobEnqueued_;
+        std::condition_variable     jobCompleted_;
+        std::atomic<std::uint64_t>  numEnqueued_            { 0 };
+        std::atomic<std::uint64_t>  numCompleted_           { 0 };
+        std::atomic<bool>           hasPendingException_    { false };
+        bool                        quit_                   = false;
+        std::exception_ptr          pendingException_;
+        std::thread                 thread_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
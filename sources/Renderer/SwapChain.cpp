@@ -10,6 +10,7 @@
 #include <LLGL/Canvas.h>
 #include <LLGL/Display.h>
 #include "CheckedCast.h"
+#include "FrameStatisticsRecorder.h"
 #include "../Core/CoreUtils.h"
 
 
@@ -23,6 +24,8 @@ struct SwapChain::Pimpl
     Extent2D                    resolution;
     Offset2D                    normalModeSurfacePos;
     bool                        normalModeSurfacePosStored = false;
+    std::unique_ptr<FrameStatisticsRecorder>
+                                frameStatistics;
 };
 
 SwapChain::SwapChain() :
@@ -34,6 +37,8 @@ SwapChain::SwapChain(const SwapChainDescriptor& desc) :
     SwapChain {}
 {
     pimpl_->resolution = desc.resolution;
+    if (desc.frameStatisticsWindow > 0)
+        pimpl_->frameStatistics = MakeUnique<FrameStatisticsRecorder>(desc.frameStatisticsWindow);
 }
 
 SwapChain::~SwapChain()
@@ -114,6 +119,40 @@ bool SwapChain::ResizeBuffers(const Extent2D& resolution, long flags)
     return false;
 }
 
+bool SwapChain::WaitForNextFrame(std::uint64_t /*timeout*/)
+{
+    /* Presentation already throttles the CPU by default, so there is nothing to wait for */
+    return true;
+}
+
+bool SwapChain::GetFrameStatistics(FrameStatistics& outStatistics) const
+{
+    if (pimpl_->frameStatistics)
+    {
+        pimpl_->frameStatistics->GetStatistics(outStatistics);
+        return true;
+    }
+    return false;
+}
+
+bool SwapChain::GetCurrentBackBufferNativeHandle(void* /*nativeHandle*/, std::size_t /*nativeHandleSize*/)
+{
+    /* Back buffers are not exposed by default */
+    return false;
+}
+
+SurfaceTransform SwapChain::GetSurfaceTransform() const
+{
+    /* Swap-chains are not pre-rotated by default */
+    return SurfaceTransform::Identity;
+}
+
+ColorSpace SwapChain::GetColorSpace() const
+{
+    /* Swap-chains present in standard dynamic range by default */
+    return ColorSpace::SRGB;
+}
+
 /* ----- Configuration ----- */
 
 bool SwapChain::SwitchFullscreen(bool enable)
@@ -225,6 +264,29 @@ void SwapChain::ShowSurface()
     #endif
 }
 
+bool SwapChain::HasFrameStatistics() const
+{
+    return (pimpl_->frameStatistics != nullptr);
+}
+
+void SwapChain::BeginFrameStatisticsStall()
+{
+    if (pimpl_->frameStatistics)
+        pimpl_->frameStatistics->BeginStall();
+}
+
+void SwapChain::EndFrameStatisticsStall(bool presented)
+{
+    if (pimpl_->frameStatistics)
+        pimpl_->frameStatistics->EndStall(presented);
+}
+
+void SwapChain::RecordFrameDisplayTime(std::uint64_t presentCount, std::uint64_t timeInNanosecs)
+{
+    if (pimpl_->frameStatistics)
+        pimpl_->frameStatistics->RecordDisplayTime(presentCount, timeInNanosecs);
+}
+
 void SwapChain::ShareSurfaceAndConfig(SwapChain& other)
 {
     pimpl_->surface     = other.pimpl_->surface;
@@ -0,0 +1,826 @@
+/*
+ * TextureContainer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/Utils/TextureContainer.h>
+#include <LLGL/RenderSystem.h>
+#include <LLGL/Texture.h>
+#include <LLGL/Format.h>
+#include <LLGL/Report.h>
+#include <LLGL/Utils/ForRange.h>
+#include "../Core/CoreUtils.h"
+#include "FormatTable.h"
+#include <algorithm>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+/*
+ * Internal functions
+ */
+
+template <typename T>
+static bool ReadContainerValue(const Blob& blob, std::uint64_t offset, T& outValue)
+{
+    if (offset > blob.GetSize() || sizeof(T) > blob.GetSize() - offset)
+        return false;
+    ::memcpy(&outValue, static_cast<const char*>(blob.GetData()) + offset, sizeof(T));
+    return true;
+}
+
+static constexpr std::uint32_t MakeFourCC(char c0, char c1, char c2, char c3)
+{
+    return
+    (
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c0))      ) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c1)) <<  8) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c2)) << 16) |
+        (static_cast<std::uint32_t>(static_cast<std::uint8_t>(c3)) << 24)
+    );
+}
+
+static std::uint32_t GetMipExtent(std::uint32_t extent, std::uint32_t mipLevel)
+{
+    return std::max(1u, extent >> mipLevel);
+}
+
+// Multiplies the two values and returns false if the result does not fit into 64 bits.
+static bool MultiplyChecked(std::uint64_t& inOutValue, std::uint64_t factor)
+{
+    if (factor != 0 && inOutValue > UINT64_MAX / factor)
+        return false;
+    inOutValue *= factor;
+    return true;
+}
+
+// Returns the size (in bytes) of a single array layer of the specified MIP-map level. Block compressed formats are rounded up to entire blocks.
+// Returns zero if the size does not fit into 64 bits, which can only happen with corrupted container headers.
+static std::uint64_t GetMipLevelSize(const FormatAttributes& formatAttribs, const Extent3D& extent, std::uint32_t mipLevel)
+{
+    std::uint64_t numBits = DivideRoundUp(GetMipExtent(extent.width, mipLevel), static_cast<std::uint32_t>(formatAttribs.blockWidth));
+    if (!MultiplyChecked(numBits, DivideRoundUp(GetMipExtent(extent.height, mipLevel), static_cast<std::uint32_t>(formatAttribs.blockHeight))) ||
+        !MultiplyChecked(numBits, GetMipExtent(extent.depth, mipLevel)) ||
+        !MultiplyChecked(numBits, formatAttribs.bitSize))
+    {
+        return 0;
+    }
+    return numBits / 8;
+}
+
+// Returns the uncompressed format that the specified block compressed format is transcoded to on the CPU, or Format::Undefined if there is no CPU decoder for it.
+static Format GetTranscodedFormat(Format format)
+{
+    switch (format)
+    {
+        case Format::BC1UNorm:
+        case Format::BC2UNorm:
+        case Format::BC3UNorm:
+        case Format::BC4UNorm:
+        case Format::BC4SNorm:
+        case Format::BC5UNorm:
+        case Format::BC5SNorm:
+        case Format::BC7UNorm:
+        case Format::ETC1UNorm:
+        case Format::ETC2UNorm:
+        case Format::ETC2A1UNorm:
+        case Format::ETC2A8UNorm:
+        case Format::EACR11UNorm:
+        case Format::EACR11SNorm:
+        case Format::EACRG11UNorm:
+        case Format::EACRG11SNorm:
+            return Format::RGBA8UNorm;
+
+        case Format::BC1UNorm_sRGB:
+        case Format::BC2UNorm_sRGB:
+        case Format::BC3UNorm_sRGB:
+        case Format::BC7UNorm_sRGB:
+        case Format::ETC2UNorm_sRGB:
+        case Format::ETC2A1UNorm_sRGB:
+        case Format::ETC2A8UNorm_sRGB:
+            return Format::RGBA8UNorm_sRGB;
+
+        default:
+            return Format::Undefined;
+    }
+}
+
+static bool IsTextureFormatSupported(RenderSystem& renderer, Format format)
+{
+    const std::vector<Format>& textureFormats = renderer.GetRenderingCaps().textureFormats;
+    return (std::find(textureFormats.begin(), textureFormats.end(), format) != textureFormats.end());
+}
+
+// Decompresses all array layers and depth slices of the specified subresource into a single RGBA8 image buffer. Returns null on failure.
+static DynamicByteArray TranscodeSubresource(Format format, const TextureContainerSubresource& subresource)
+{
+    const Extent3D&         extent          = subresource.region.extent;
+    const Extent2D          sliceExtent     = { extent.width, extent.height };
+    const std::uint64_t     srcSliceSize    = GetMipLevelSize(FormatTable::GetAttribs(format), Extent3D{ extent.width, extent.height, 1 }, 0);
+    const std::size_t       dstSliceSize    = static_cast<std::size_t>(extent.width) * extent.height * 4;
+    const std::uint32_t     numSlices       = extent.depth * subresource.region.subresource.numArrayLayers;
+
+    if (srcSliceSize == 0 || numSlices > subresource.imageView.dataSize / srcSliceSize)
+        return nullptr;
+
+    DynamicByteArray dstImage{ dstSliceSize * numSlices, UninitializeTag{} };
+
+    for_range(slice, numSlices)
+    {
+        ImageView srcSliceView = subresource.imageView;
+        {
+            srcSliceView.data       = static_cast<const char*>(subresource.imageView.data) + srcSliceSize * slice;
+            srcSliceView.dataSize   = static_cast<std::size_t>(srcSliceSize);
+        }
+        DynamicByteArray dstSlice = DecompressImageBufferToRGBA8UNorm(format, srcSliceView, sliceExtent, LLGL_MAX_THREAD_COUNT);
+        if (!dstSlice)
+            return nullptr;
+        ::memcpy(dstImage.get() + dstSliceSize * slice, dstSlice.get(), dstSliceSize);
+    }
+
+    return dstImage;
+}
+
+/* ----- DDS ----- */
+
+static constexpr std::uint32_t g_ddsMagic               = MakeFourCC('D', 'D', 'S', ' ');
+static constexpr std::uint32_t g_ddsHeaderSize          = 124;
+static constexpr std::uint32_t g_ddsHeaderDX10Size      = 20;
+
+static constexpr std::uint32_t g_ddsPixelFormatFourCC   = 0x00000004; // DDPF_FOURCC
+static constexpr std::uint32_t g_ddsPixelFormatRGB      = 0x00000040; // DDPF_RGB
+static constexpr std::uint32_t g_ddsPixelFormatAlpha    = 0x00000002; // DDPF_ALPHA
+static constexpr std::uint32_t g_ddsPixelFormatLum      = 0x00020000; // DDPF_LUMINANCE
+
+static constexpr std::uint32_t g_ddsCaps2Cubemap        = 0x00000200; // DDSCAPS2_CUBEMAP
+static constexpr std::uint32_t g_ddsCaps2Volume         = 0x00200000; // DDSCAPS2_VOLUME
+
+static constexpr std::uint32_t g_ddsDimensionTexture1D  = 2; // D3D10_RESOURCE_DIMENSION_TEXTURE1D
+static constexpr std::uint32_t g_ddsDimensionTexture3D  = 4; // D3D10_RESOURCE_DIMENSION_TEXTURE3D
+static constexpr std::uint32_t g_ddsMiscTextureCube     = 0x00000004; // D3D10_RESOURCE_MISC_TEXTURECUBE
+
+struct DDSPixelFormat
+{
+    std::uint32_t size;
+    std::uint32_t flags;
+    std::uint32_t fourCC;
+    std::uint32_t rgbBitCount;
+    std::uint32_t rBitMask;
+    std::uint32_t gBitMask;
+    std::uint32_t bBitMask;
+    std::uint32_t aBitMask;
+};
+
+struct DDSHeader
+{
+    std::uint32_t   size;
+    std::uint32_t   flags;
+    std::uint32_t   height;
+    std::uint32_t   width;
+    std::uint32_t   pitchOrLinearSize;
+    std::uint32_t   depth;
+    std::uint32_t   mipMapCount;
+    std::uint32_t   reserved1[11];
+    DDSPixelFormat  pixelFormat;
+    std::uint32_t   caps;
+    std::uint32_t   caps2;
+    std::uint32_t   caps3;
+    std::uint32_t   caps4;
+    std::uint32_t   reserved2;
+};
+
+struct DDSHeaderDX10
+{
+    std::uint32_t dxgiFormat;
+    std::uint32_t resourceDimension;
+    std::uint32_t miscFlag;
+    std::uint32_t arraySize;
+    std::uint32_t miscFlags2;
+};
+
+static_assert(sizeof(DDSHeader) == g_ddsHeaderSize, "DDSHeader must be 124 bytes");
+static_assert(sizeof(DDSHeaderDX10) == g_ddsHeaderDX10Size, "DDSHeaderDX10 must be 20 bytes");
+
+// Maps the numeric value of a DXGI_FORMAT enumeration entry to an LLGL format.
+static Format DDSMapDXGIFormat(std::uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+        case  2: return Format::RGBA32Float;
+        case  3: return Format::RGBA32UInt;
+        case  4: return Format::RGBA32SInt;
+        case  6: return Format::RGB32Float;
+        case  7: return Format::RGB32UInt;
+        case  8: return Format::RGB32SInt;
+        case 10: return Format::RGBA16Float;
+        case 11: return Format::RGBA16UNorm;
+        case 12: return Format::RGBA16UInt;
+        case 13: return Format::RGBA16SNorm;
+        case 14: return Format::RGBA16SInt;
+        case 16: return Format::RG32Float;
+        case 17: return Format::RG32UInt;
+        case 18: return Format::RG32SInt;
+        case 20: return Format::D32FloatS8X24UInt;
+        case 28: return Format::RGBA8UNorm;
+        case 29: return Format::RGBA8UNorm_sRGB;
+        case 30: return Format::RGBA8UInt;
+        case 31: return Format::RGBA8SNorm;
+        case 32: return Format::RGBA8SInt;
+        case 34: return Format::RG16Float;
+        case 35: return Format::RG16UNorm;
+        case 36: return Format::RG16UInt;
+        case 37: return Format::RG16SNorm;
+        case 38: return Format::RG16SInt;
+        case 40: return Format::D32Float;
+        case 41: return Format::R32Float;
+        case 42: return Format::R32UInt;
+        case 43: return Format::R32SInt;
+        case 45: return Format::D24UNormS8UInt;
+        case 49: return Format::RG8UNorm;
+        case 50: return Format::RG8UInt;
+        case 51: return Format::RG8SNorm;
+        case 52: return Format::RG8SInt;
+        case 54: return Format::R16Float;
+        case 55: return Format::D16UNorm;
+        case 56: return Format::R16UNorm;
+        case 57: return Format::R16UInt;
+        case 58: return Format::R16SNorm;
+        case 59: return Format::R16SInt;
+        case 61: return Format::R8UNorm;
+        case 62: return Format::R8UInt;
+        case 63: return Format::R8SNorm;
+        case 64: return Format::R8SInt;
+        case 65: return Format::A8UNorm;
+        case 71: return Format::BC1UNorm;
+        case 72: return Format::BC1UNorm_sRGB;
+        case 74: return Format::BC2UNorm;
+        case 75: return Format::BC2UNorm_sRGB;
+        case 77: return Format::BC3UNorm;
+        case 78: return Format::BC3UNorm_sRGB;
+        case 80: return Format::BC4UNorm;
+        case 81: return Format::BC4SNorm;
+        case 83: return Format::BC5UNorm;
+        case 84: return Format::BC5SNorm;
+        case 87: return Format::BGRA8UNorm;
+        case 91: return Format::BGRA8UNorm_sRGB;
+        case 95: return Format::BC6HUFloat;
+        case 96: return Format::BC6HSFloat;
+        case 98: return Format::BC7UNorm;
+        case 99: return Format::BC7UNorm_sRGB;
+        default: return Format::Undefined;
+    }
+}
+
+// Maps the legacy pixel format of a DDS header without DX10 extension to an LLGL format.
+static Format DDSMapLegacyPixelFormat(const DDSPixelFormat& pf)
+{
+    if ((pf.flags & g_ddsPixelFormatFourCC) != 0)
+    {
+        switch (pf.fourCC)
+        {
+            case MakeFourCC('D', 'X', 'T', '1'): return Format::BC1UNorm;
+            case MakeFourCC('D', 'X', 'T', '2'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '3'): return Format::BC2UNorm;
+            case MakeFourCC('D', 'X', 'T', '4'): return Format::BC3UNorm;
+            case MakeFourCC('D', 'X', 'T', '5'): return Format::BC3UNorm;
+            case MakeFourCC('A', 'T', 'I', '1'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'U'): return Format::BC4UNorm;
+            case MakeFourCC('B', 'C', '4', 'S'): return Format::BC4SNorm;
+            case MakeFourCC('A', 'T', 'I', '2'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'U'): return Format::BC5UNorm;
+            case MakeFourCC('B', 'C', '5', 'S'): return Format::BC5SNorm;
+
+            /* Numeric values of D3DFORMAT stored as FourCC */
+            case  36: return Format::RGBA16UNorm;
+            case 111: return Format::R16Float;
+            case 112: return Format::RG16Float;
+            case 113: return Format::RGBA16Float;
+            case 114: return Format::R32Float;
+            case 115: return Format::RG32Float;
+            case 116: return Format::RGBA32Float;
+            default:  return Format::Undefined;
+        }
+    }
+
+    if ((pf.flags & g_ddsPixelFormatRGB) != 0)
+    {
+        if (pf.rgbBitCount == 32)
+        {
+            if (pf.rBitMask == 0x000000FF && pf.gBitMask == 0x0000FF00 && pf.bBitMask == 0x00FF0000)
+                return Format::RGBA8UNorm;
+            if (pf.rBitMask == 0x00FF0000 && pf.gBitMask == 0x0000FF00 && pf.bBitMask == 0x000000FF)
+                return Format::BGRA8UNorm;
+            if (pf.rBitMask == 0x0000FFFF && pf.gBitMask == 0xFFFF0000)
+                return Format::RG16UNorm;
+        }
+        else if (pf.rgbBitCount == 16 && pf.rBitMask == 0x00FF && pf.gBitMask == 0xFF00)
+            return Format::RG8UNorm;
+        return Format::Undefined;
+    }
+
+    if ((pf.flags & g_ddsPixelFormatLum) != 0)
+    {
+        if (pf.rgbBitCount == 8)
+            return Format::R8UNorm;
+        if (pf.rgbBitCount == 16 && pf.rBitMask == 0xFFFF)
+            return Format::R16UNorm;
+        if (pf.rgbBitCount == 16 && pf.rBitMask == 0x00FF && pf.aBitMask == 0xFF00)
+            return Format::RG8UNorm;
+        return Format::Undefined;
+    }
+
+    if ((pf.flags & g_ddsPixelFormatAlpha) != 0 && pf.rgbBitCount == 8)
+        return Format::A8UNorm;
+
+    return Format::Undefined;
+}
+
+/* ----- KTX2 ----- */
+
+static constexpr std::uint8_t   g_ktx2Identifier[12]    = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+static constexpr std::uint32_t  g_ktx2LevelIndexOffset  = 80;
+
+struct KTX2Header
+{
+    std::uint8_t    identifier[12];
+    std::uint32_t   vkFormat;
+    std::uint32_t   typeSize;
+    std::uint32_t   pixelWidth;
+    std::uint32_t   pixelHeight;
+    std::uint32_t   pixelDepth;
+    std::uint32_t   layerCount;
+    std::uint32_t   faceCount;
+    std::uint32_t   levelCount;
+    std::uint32_t   supercompressionScheme;
+    std::uint32_t   dfdByteOffset;
+    std::uint32_t   dfdByteLength;
+    std::uint32_t   kvdByteOffset;
+    std::uint32_t   kvdByteLength;
+    std::uint64_t   sgdByteOffset;
+    std::uint64_t   sgdByteLength;
+};
+
+struct KTX2LevelIndex
+{
+    std::uint64_t byteOffset;
+    std::uint64_t byteLength;
+    std::uint64_t uncompressedByteLength;
+};
+
+static_assert(sizeof(KTX2Header) == g_ktx2LevelIndexOffset, "KTX2Header must be 80 bytes");
+
+static const char* KTX2SupercompressionToString(std::uint32_t scheme)
+{
+    switch (scheme)
+    {
+        case 1:  return "BasisLZ";
+        case 2:  return "Zstandard";
+        case 3:  return "ZLIB";
+        default: return "unknown";
+    }
+}
+
+// Maps the numeric value of a VkFormat enumeration entry to an LLGL format.
+static Format KTX2MapVkFormat(std::uint32_t vkFormat)
+{
+    /* VK_FORMAT_ASTC_4x4_UNORM_BLOCK (157) to VK_FORMAT_ASTC_12x12_SRGB_BLOCK (184) alternate between UNORM and SRGB in the same order as LLGL */
+    if (vkFormat >= 157 && vkFormat <= 184)
+        return static_cast<Format>(static_cast<std::uint32_t>(Format::ASTC4x4) + (vkFormat - 157));
+
+    /* VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK (1000066000) to VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK (1000066013) are in the same order as LLGL */
+    if (vkFormat >= 1000066000u && vkFormat <= 1000066013u)
+        return static_cast<Format>(static_cast<std::uint32_t>(Format::ASTC4x4Float) + (vkFormat - 1000066000u));
+
+    switch (vkFormat)
+    {
+        case   9: return Format::R8UNorm;
+        case  10: return Format::R8SNorm;
+        case  13: return Format::R8UInt;
+        case  14: return Format::R8SInt;
+        case  16: return Format::RG8UNorm;
+        case  17: return Format::RG8SNorm;
+        case  20: return Format::RG8UInt;
+        case  21: return Format::RG8SInt;
+        case  37: return Format::RGBA8UNorm;
+        case  38: return Format::RGBA8SNorm;
+        case  41: return Format::RGBA8UInt;
+        case  42: return Format::RGBA8SInt;
+        case  43: return Format::RGBA8UNorm_sRGB;
+        case  44: return Format::BGRA8UNorm;
+        case  50: return Format::BGRA8UNorm_sRGB;
+        case  70: return Format::R16UNorm;
+        case  71: return Format::R16SNorm;
+        case  74: return Format::R16UInt;
+        case  75: return Format::R16SInt;
+        case  76: return Format::R16Float;
+        case  77: return Format::RG16UNorm;
+        case  78: return Format::RG16SNorm;
+        case  81: return Format::RG16UInt;
+        case  82: return Format::RG16SInt;
+        case  83: return Format::RG16Float;
+        case  91: return Format::RGBA16UNorm;
+        case  92: return Format::RGBA16SNorm;
+        case  95: return Format::RGBA16UInt;
+        case  96: return Format::RGBA16SInt;
+        case  97: return Format::RGBA16Float;
+        case  98: return Format::R32UInt;
+        case  99: return Format::R32SInt;
+        case 100: return Format::R32Float;
+        case 101: return Format::RG32UInt;
+        case 102: return Format::RG32SInt;
+        case 103: return Format::RG32Float;
+        case 104: return Format::RGB32UInt;
+        case 105: return Format::RGB32SInt;
+        case 106: return Format::RGB32Float;
+        case 107: return Format::RGBA32UInt;
+        case 108: return Format::RGBA32SInt;
+        case 109: return Format::RGBA32Float;
+        case 124: return Format::D16UNorm;
+        case 126: return Format::D32Float;
+        case 129: return Format::D24UNormS8UInt;
+        case 130: return Format::D32FloatS8X24UInt;
+        case 131: return Format::BC1UNorm;
+        case 132: return Format::BC1UNorm_sRGB;
+        case 133: return Format::BC1UNorm;
+        case 134: return Format::BC1UNorm_sRGB;
+        case 135: return Format::BC2UNorm;
+        case 136: return Format::BC2UNorm_sRGB;
+        case 137: return Format::BC3UNorm;
+        case 138: return Format::BC3UNorm_sRGB;
+        case 139: return Format::BC4UNorm;
+        case 140: return Format::BC4SNorm;
+        case 141: return Format::BC5UNorm;
+        case 142: return Format::BC5SNorm;
+        case 143: return Format::BC6HUFloat;
+        case 144: return Format::BC6HSFloat;
+        case 145: return Format::BC7UNorm;
+        case 146: return Format::BC7UNorm_sRGB;
+        case 147: return Format::ETC2UNorm;
+        case 148: return Format::ETC2UNorm_sRGB;
+        case 149: return Format::ETC2A1UNorm;
+        case 150: return Format::ETC2A1UNorm_sRGB;
+        case 151: return Format::ETC2A8UNorm;
+        case 152: return Format::ETC2A8UNorm_sRGB;
+        case 153: return Format::EACR11UNorm;
+        case 154: return Format::EACR11SNorm;
+        case 155: return Format::EACRG11UNorm;
+        case 156: return Format::EACRG11SNorm;
+        default:  return Format::Undefined;
+    }
+}
+
+
+/*
+ * TextureContainer class
+ */
+
+bool TextureContainer::LoadFromFile(const char* filename, Report* report)
+{
+    Blob blob = Blob::CreateFromMappedFile(filename);
+    if (!blob)
+    {
+        Clear();
+        if (report != nullptr)
+            report->Errorf("failed to open texture container: %s\n", filename);
+        return false;
+    }
+    return LoadFromBlob(std::move(blob), report);
+}
+
+bool TextureContainer::LoadFromBlob(Blob&& blob, Report* report)
+{
+    Clear();
+
+    blob_ = std::move(blob);
+
+    std::uint32_t magic = 0;
+    bool success = false;
+
+    if (ReadContainerValue(blob_, 0, magic) && magic == g_ddsMagic)
+        success = ParseDDS(report);
+    else if (blob_.GetSize() >= sizeof(g_ktx2Identifier) && ::memcmp(blob_.GetData(), g_ktx2Identifier, sizeof(g_ktx2Identifier)) == 0)
+        success = ParseKTX2(report);
+    else if (report != nullptr)
+        report->Errorf("unknown texture container format; expected DDS or KTX2\n");
+
+    if (!success)
+        Clear();
+
+    return success;
+}
+
+void TextureContainer::Clear()
+{
+    blob_               = Blob{};
+    containerFormat_    = TextureContainerFormat::Undefined;
+    desc_               = TextureDescriptor{};
+    subresources_.clear();
+}
+
+Texture* TextureContainer::CreateTexture(RenderSystem& renderer, long bindFlags, Fence* fence) const
+{
+    if (subresources_.empty())
+        return nullptr;
+
+    TextureDescriptor texDesc = desc_;
+    texDesc.bindFlags = (bindFlags | BindFlags::CopyDst);
+
+    /* Fall back to an uncompressed format if the device does not support the compressed format natively; WriteTexture() then transcodes on the CPU */
+    if (!IsTextureFormatSupported(renderer, texDesc.format))
+    {
+        const Format transcodedFormat = GetTranscodedFormat(texDesc.format);
+        if (transcodedFormat != Format::Undefined)
+            texDesc.format = transcodedFormat;
+    }
+
+    Texture* texture = renderer.CreateTexture(texDesc);
+    if (texture != nullptr && !WriteTexture(renderer, *texture, fence))
+    {
+        renderer.Release(*texture);
+        return nullptr;
+    }
+
+    return texture;
+}
+
+bool TextureContainer::WriteTexture(RenderSystem& renderer, Texture& texture, Fence* fence) const
+{
+    if (subresources_.empty())
+        return false;
+
+    /* Transcode subresources if the texture was created with the fallback format (see CreateTexture) */
+    const Format textureFormat = texture.GetFormat();
+    const bool isTranscoded = (textureFormat != desc_.format && textureFormat == GetTranscodedFormat(desc_.format));
+
+    std::vector<DynamicByteArray> transcodedImages;
+    if (isTranscoded)
+        transcodedImages.reserve(subresources_.size());
+
+    std::vector<TextureUploadDescriptor> uploads(subresources_.size());
+    for_range(i, subresources_.size())
+    {
+        uploads[i].texture      = &texture;
+        uploads[i].region       = subresources_[i].region;
+        uploads[i].imageView    = subresources_[i].imageView;
+
+        if (isTranscoded)
+        {
+            transcodedImages.push_back(TranscodeSubresource(desc_.format, subresources_[i]));
+            const DynamicByteArray& image = transcodedImages.back();
+            if (!image)
+                return false;
+            uploads[i].imageView = ImageView{ ImageFormat::RGBA, DataType::UInt8, image.get(), image.size() };
+        }
+    }
+
+    /* Image data is copied before WriteTextureAsync() returns, so the transcoded images only need to live until then */
+    renderer.WriteTextureAsync(static_cast<std::uint32_t>(uploads.size()), uploads.data(), fence);
+    return true;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool TextureContainer::ParseDDS(Report* report)
+{
+    DDSHeader header;
+    if (!ReadContainerValue(blob_, 4, header) || header.size != g_ddsHeaderSize)
+    {
+        if (report != nullptr)
+            report->Errorf("invalid DDS header\n");
+        return false;
+    }
+
+    std::uint64_t   offset          = 4 + g_ddsHeaderSize;
+    std::uint32_t   numLayers       = 1;
+    bool            isCube          = ((header.caps2 & g_ddsCaps2Cubemap) != 0);
+    bool            isVolume        = ((header.caps2 & g_ddsCaps2Volume) != 0);
+    bool            is1D            = false;
+    bool            isArray         = false;
+
+    if ((header.pixelFormat.flags & g_ddsPixelFormatFourCC) != 0 && header.pixelFormat.fourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        DDSHeaderDX10 headerDX10;
+        if (!ReadContainerValue(blob_, offset, headerDX10))
+        {
+            if (report != nullptr)
+                report->Errorf("invalid DDS DX10 header extension\n");
+            return false;
+        }
+        offset += g_ddsHeaderDX10Size;
+
+        desc_.format = DDSMapDXGIFormat(headerDX10.dxgiFormat);
+        if (desc_.format == Format::Undefined)
+        {
+            if (report != nullptr)
+                report->Errorf("unsupported DXGI format in DDS file: %u\n", headerDX10.dxgiFormat);
+            return false;
+        }
+
+        numLayers   = std::max(1u, headerDX10.arraySize);
+        isArray     = (headerDX10.arraySize > 1);
+        isCube      = ((headerDX10.miscFlag & g_ddsMiscTextureCube) != 0);
+        isVolume    = (headerDX10.resourceDimension == g_ddsDimensionTexture3D);
+        is1D        = (headerDX10.resourceDimension == g_ddsDimensionTexture1D);
+    }
+    else
+    {
+        desc_.format = DDSMapLegacyPixelFormat(header.pixelFormat);
+        if (desc_.format == Format::Undefined)
+        {
+            if (report != nullptr)
+                report->Errorf("unsupported pixel format in DDS file\n");
+            return false;
+        }
+    }
+
+    /* Derive texture type; legacy cube maps are assumed to contain all six faces */
+    if (isVolume)
+        desc_.type = TextureType::Texture3D;
+    else if (isCube)
+        desc_.type = (isArray ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (is1D)
+        desc_.type = (isArray ? TextureType::Texture1DArray : TextureType::Texture1D);
+    else
+        desc_.type = (isArray ? TextureType::Texture2DArray : TextureType::Texture2D);
+
+    desc_.bindFlags     = (BindFlags::Sampled | BindFlags::CopyDst);
+    desc_.miscFlags     = MiscFlags::NoInitialData;
+    desc_.extent.width  = std::max(1u, header.width);
+    desc_.extent.height = (is1D ? 1u : std::max(1u, header.height));
+    desc_.extent.depth  = (isVolume ? std::max(1u, header.depth) : 1u);
+    desc_.arrayLayers   = (isCube ? numLayers * 6 : numLayers);
+    desc_.mipLevels     = std::max(1u, header.mipMapCount);
+
+    if (isCube && numLayers > UINT32_MAX / 6)
+    {
+        if (report != nullptr)
+            report->Errorf("too many array layers in DDS file: %u\n", numLayers);
+        return false;
+    }
+
+    if (desc_.mipLevels > NumMipLevels(desc_.type, desc_.extent))
+    {
+        if (report != nullptr)
+            report->Errorf("too many MIP-maps in DDS file: %u\n", desc_.mipLevels);
+        return false;
+    }
+
+    /* DDS stores all MIP-map levels of each array layer consecutively */
+    for_range(layer, desc_.arrayLayers)
+    {
+        for_range(mip, desc_.mipLevels)
+        {
+            std::uint64_t size = 0;
+            if (!AppendSubresource(offset, mip, layer, 1, size))
+            {
+                if (report != nullptr)
+                    report->Errorf("DDS file is too small for MIP-map %u of layer %u\n", mip, layer);
+                return false;
+            }
+            offset += size;
+        }
+    }
+
+    containerFormat_ = TextureContainerFormat::DDS;
+    return true;
+}
+
+bool TextureContainer::ParseKTX2(Report* report)
+{
+    KTX2Header header;
+    if (!ReadContainerValue(blob_, 0, header))
+    {
+        if (report != nullptr)
+            report->Errorf("invalid KTX2 header\n");
+        return false;
+    }
+
+    if (header.supercompressionScheme != 0)
+    {
+        if (report != nullptr)
+        {
+            report->Errorf(
+                "KTX2 supercompression scheme '%s' is not supported; content must be transcoded to a GPU format before loading\n",
+                KTX2SupercompressionToString(header.supercompressionScheme)
+            );
+        }
+        return false;
+    }
+
+    desc_.format = KTX2MapVkFormat(header.vkFormat);
+    if (desc_.format == Format::Undefined)
+    {
+        if (report != nullptr)
+            report->Errorf("unsupported VkFormat in KTX2 file: %u\n", header.vkFormat);
+        return false;
+    }
+
+    const bool isArray  = (header.layerCount > 0);
+    const bool isCube   = (header.faceCount == 6);
+
+    if (header.pixelDepth > 0)
+        desc_.type = TextureType::Texture3D;
+    else if (isCube)
+        desc_.type = (isArray ? TextureType::TextureCubeArray : TextureType::TextureCube);
+    else if (header.pixelHeight == 0)
+        desc_.type = (isArray ? TextureType::Texture1DArray : TextureType::Texture1D);
+    else
+        desc_.type = (isArray ? TextureType::Texture2DArray : TextureType::Texture2D);
+
+    desc_.bindFlags     = (BindFlags::Sampled | BindFlags::CopyDst);
+    desc_.miscFlags     = MiscFlags::NoInitialData;
+    desc_.extent.width  = std::max(1u, header.pixelWidth);
+    desc_.extent.height = std::max(1u, header.pixelHeight);
+    desc_.extent.depth  = std::max(1u, header.pixelDepth);
+    desc_.arrayLayers   = std::max(1u, header.layerCount) * std::max(1u, header.faceCount);
+    desc_.mipLevels     = std::max(1u, header.levelCount);
+
+    if (header.faceCount > 6 || std::max(1u, header.layerCount) > UINT32_MAX / 6)
+    {
+        if (report != nullptr)
+            report->Errorf("too many array layers or faces in KTX2 file: %u x %u\n", header.layerCount, header.faceCount);
+        return false;
+    }
+
+    if (desc_.mipLevels > NumMipLevels(desc_.type, desc_.extent))
+    {
+        if (report != nullptr)
+            report->Errorf("too many MIP-maps in KTX2 file: %u\n", desc_.mipLevels);
+        return false;
+    }
+
+    /* KTX2 stores all array layers and faces of each MIP-map level consecutively, so each level is a single upload */
+    for_range(mip, desc_.mipLevels)
+    {
+        KTX2LevelIndex level;
+        if (!ReadContainerValue(blob_, g_ktx2LevelIndexOffset + sizeof(KTX2LevelIndex) * mip, level))
+        {
+            if (report != nullptr)
+                report->Errorf("KTX2 file is too small for level index %u\n", mip);
+            return false;
+        }
+
+        std::uint64_t size = 0;
+        if (!AppendSubresource(level.byteOffset, mip, 0, desc_.arrayLayers, size) || size > level.byteLength)
+        {
+            if (report != nullptr)
+                report->Errorf("KTX2 level %u exceeds file size or level length\n", mip);
+            return false;
+        }
+    }
+
+    containerFormat_ = TextureContainerFormat::KTX2;
+    return true;
+}
+
+bool TextureContainer::AppendSubresource(
+    std::uint64_t   offset,
+    std::uint32_t   mipLevel,
+    std::uint32_t   baseArrayLayer,
+    std::uint32_t   numArrayLayers,
+    std::uint64_t&  outSize)
+{
+    const FormatAttributes& formatAttribs = FormatTable::GetAttribs(desc_.format);
+
+    outSize = GetMipLevelSize(formatAttribs, desc_.extent, mipLevel);
+    if (!MultiplyChecked(outSize, numArrayLayers) || outSize == 0)
+        return false;
+
+    /* Offset is read from the container and must not be trusted, so avoid wrapping around */
+    if (offset > blob_.GetSize() || outSize > blob_.GetSize() - offset)
+        return false;
+
+    TextureContainerSubresource subresource;
+    {
+        subresource.region.subresource  = TextureSubresource{ baseArrayLayer, numArrayLayers, mipLevel, 1 };
+        subresource.region.offset       = Offset3D{};
+        subresource.region.extent       = Extent3D
+        {
+            GetMipExtent(desc_.extent.width,  mipLevel),
+            GetMipExtent(desc_.extent.height, mipLevel),
+            GetMipExtent(desc_.extent.depth,  mipLevel),
+        };
+        subresource.imageView.format    = formatAttribs.format;
+        subresource.imageView.dataType  = formatAttribs.dataType;
+        subresource.imageView.data      = static_cast<const char*>(blob_.GetData()) + offset;
+        subresource.imageView.dataSize  = static_cast<std::size_t>(outSize);
+    }
+    subresources_.push_back(subresource);
+
+    return true;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -9,6 +9,7 @@
 #include <LLGL/Utils/ForRange.h>
 #include "TextureUtils.h"
 #include "../Core/CoreUtils.h"
+#include "FormatTable.h"
 #include <algorithm>
 #include <cmath>
 
@@ -168,7 +169,52 @@ LLGL_EXPORT Extent3D GetMipExtent(const TextureDescriptor& textureDesc, std::uin
 LLGL_EXPORT std::size_t GetMemoryFootprint(const TextureType type, const Format format, const Extent3D& extent, const TextureSubresource& subresource)
 {
     const std::uint32_t numTexels = NumMipTexels(type, extent, subresource);
-    return GetMemoryFootprint(format, numTexels);
+    return FormatTable::GetMemoryFootprint(format, numTexels);
+}
+
+// Returns the base-2 logarithm of the specified value, or -1 if it is not a power of two
+static int Log2OfPowerOfTwo(std::uint32_t value)
+{
+    if (value == 0 || (value & (value - 1)) != 0)
+        return -1;
+    int log2Value = 0;
+    while (value > 1)
+    {
+        value >>= 1;
+        ++log2Value;
+    }
+    return log2Value;
+}
+
+LLGL_EXPORT Extent3D GetSparseTileExtent(const TextureType type, const Format format, std::uint32_t tileSize)
+{
+    if (type != TextureType::Texture2D && type != TextureType::Texture2DArray)
+        return {};
+
+    /* Standard tile shapes distribute the number of blocks per tile evenly, starting with the width */
+    const FormatAttributes& formatAttribs = FormatTable::GetAttribs(format);
+    const int log2TileSize  = Log2OfPowerOfTwo(tileSize);
+    const int log2BlockSize = Log2OfPowerOfTwo(formatAttribs.bitSize / 8);
+    if (log2TileSize < 0 || log2BlockSize < 0 || log2BlockSize > log2TileSize)
+        return {};
+
+    const int log2NumBlocks = log2TileSize - log2BlockSize;
+    return Extent3D
+    {
+        (1u << ((log2NumBlocks + 1) / 2)) * formatAttribs.blockWidth,
+        (1u << (log2NumBlocks / 2)) * formatAttribs.blockHeight,
+        1u
+    };
+}
+
+LLGL_EXPORT Extent3D GetSamplerFeedbackExtent(const Extent3D& extent, const Extent3D& mipRegion)
+{
+    return Extent3D
+    {
+        DivideRoundUp(extent.width,  std::max(1u, mipRegion.width )),
+        DivideRoundUp(extent.height, std::max(1u, mipRegion.height)),
+        extent.depth
+    };
 }
 
 LLGL_EXPORT bool IsMipMappedTexture(const TextureDescriptor& textureDesc)
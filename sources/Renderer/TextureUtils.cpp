@@ -7,8 +7,10 @@
 
 #include "TextureUtils.h"
 #include <LLGL/Constants.h>
+#include <LLGL/ImageFlags.h>
 #include "../Core/CoreUtils.h"
 #include "../Core/MacroUtils.h"
+#include "FormatTable.h"
 #include <cstring>
 
 
@@ -74,7 +76,7 @@ static void CalcSubresourceLayoutPrimary(
     const Extent3D&     extent,
     std::uint32_t       numArrayLayers)
 {
-    const FormatAttributes& formatAttribs = GetFormatAttribs(format);
+    const FormatAttributes& formatAttribs = FormatTable::GetAttribs(format);
     if (formatAttribs.blockWidth > 0 && formatAttribs.blockHeight > 0)
     {
         outLayout.rowStride         = (extent.width * formatAttribs.bitSize) / formatAttribs.blockWidth / 8;
@@ -102,7 +104,7 @@ LLGL_EXPORT SubresourceCPUMappingLayout CalcSubresourceCPUMappingLayout(
         CalcSubresourceLayoutPrimary(layout, format, extent, numArrayLayers);
         layout.numTexelsPerLayer    = extent.width * extent.height * extent.depth;
         layout.numTexelsTotal       = layout.numTexelsPerLayer * numArrayLayers;
-        layout.imageSize            = GetMemoryFootprint(imageFormat, imageDataType, layout.numTexelsTotal);
+        layout.imageSize            = FormatTable::GetMemoryFootprint(imageFormat, imageDataType, layout.numTexelsTotal);
     }
     return layout;
 }
@@ -120,7 +122,7 @@ LLGL_EXPORT SubresourceFootprint CalcPackedSubresourceFootprint(
         const Extent3D      mipExtent = GetMipExtent(type, extent, mipLevel);
         const std::uint32_t numLayers = mipExtent.depth * numArrayLayers;
         footprint.rowAlignment  = alignment;
-        footprint.rowSize       = static_cast<std::uint32_t>(GetMemoryFootprint(format, mipExtent.width));
+        footprint.rowSize       = static_cast<std::uint32_t>(FormatTable::GetMemoryFootprint(format, mipExtent.width));
         footprint.rowStride     = GetAlignedSize(footprint.rowSize, alignment);
         footprint.layerSize     = (mipExtent.height > 1 ? footprint.rowStride * (mipExtent.height - 1) + footprint.rowSize : footprint.rowSize * mipExtent.height);
         footprint.layerStride   = footprint.rowStride * mipExtent.height;
@@ -177,6 +179,25 @@ LLGL_EXPORT int CompareCompressedTexViewSWO(const CompressedTexView& lhs, const
     return std::memcmp(&lhs, &rhs, sizeof(CompressedTexView));
 }
 
+LLGL_EXPORT std::vector<std::uint32_t> GetTextureUploadOrder(std::uint32_t numUploads, const TextureUploadDescriptor* uploads)
+{
+    std::vector<std::uint32_t> order(numUploads);
+    for (std::uint32_t i = 0; i < numUploads; ++i)
+        order[i] = i;
+
+    /* Sort by descending MIP-map level, so the smallest MIP-maps are uploaded first */
+    std::stable_sort(
+        order.begin(),
+        order.end(),
+        [uploads](std::uint32_t lhs, std::uint32_t rhs) -> bool
+        {
+            return (uploads[lhs].region.subresource.baseMipLevel > uploads[rhs].region.subresource.baseMipLevel);
+        }
+    );
+
+    return order;
+}
+
 
 } // /namespace LLGL
 
@@ -10,12 +10,15 @@
 
 
 #include <LLGL/TextureFlags.h>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+struct TextureUploadDescriptor;
+
 /* ----- Structures ----- */
 
 // Subresource layout structure with stride per row, stride per array layer, and whole data size.
@@ -99,6 +102,9 @@ LLGL_EXPORT void CompressTextureViewDesc(CompressedTexView& dst, const TextureVi
 // Compares the two texture views in a strict-weak-order (SWO).
 LLGL_EXPORT int CompareCompressedTexViewSWO(const CompressedTexView& lhs, const CompressedTexView& rhs);
 
+// Returns the indices of the specified texture uploads sorted from the coarsest to the finest MIP-map level. Uploads of the same MIP-map level keep their order.
+LLGL_EXPORT std::vector<std::uint32_t> GetTextureUploadOrder(std::uint32_t numUploads, const TextureUploadDescriptor* uploads);
+
 // Returns true if the texture-view in the specified resource-view descriptor is enabled.
 inline bool IsTextureViewEnabled(const TextureViewDescriptor& textureViewDesc)
 {
@@ -0,0 +1,112 @@
+/*
+ * TransientBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "TransientBufferPool.h"
+#include "../Core/CoreUtils.h"
+#include <LLGL/BufferFlags.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+TransientBufferPool::TransientBufferPool(std::uint64_t chunkSize, std::uint64_t constantBufferAlignment) :
+    chunkSize_               { chunkSize                                           },
+    constantBufferAlignment_ { std::max<std::uint64_t>(1, constantBufferAlignment) }
+{
+}
+
+static std::uint64_t GreatestCommonDivisor(std::uint64_t a, std::uint64_t b)
+{
+    while (b != 0)
+    {
+        const std::uint64_t t = b;
+        b = a % b;
+        a = t;
+    }
+    return a;
+}
+
+// Returns the least common multiple of the two alignments, so an offset satisfies both of them.
+static std::uint64_t CombineAlignments(std::uint64_t a, std::uint64_t b)
+{
+    return (a / GreatestCommonDivisor(a, b)) * b;
+}
+
+static TransientBufferAllocation MakeTransientBufferAllocation(Buffer* buffer, std::uint64_t offset, std::uint64_t size, char* data)
+{
+    TransientBufferAllocation allocation;
+    {
+        allocation.buffer   = buffer;
+        allocation.offset   = offset;
+        allocation.size     = size;
+        allocation.data     = data;
+    }
+    return allocation;
+}
+
+TransientBufferAllocation TransientBufferPool::Alloc(std::uint64_t size, long bindFlags, std::uint64_t alignment)
+{
+    if (size == 0)
+        return {};
+
+    /* Determine alignment for the allocation offset */
+    alignment = std::max<std::uint64_t>(1, alignment);
+    if ((bindFlags & BindFlags::ConstantBuffer) != 0)
+        alignment = CombineAlignments(alignment, constantBufferAlignment_);
+
+    /* Find first chunk with enough remaining space, starting with the current one */
+    for (; chunkIdx_ < chunks_.size(); ++chunkIdx_)
+    {
+        const Chunk& chunk = chunks_[chunkIdx_];
+        const std::uint64_t offset = GetAlignedSize(chunkOffset_, alignment);
+        if (offset + size <= chunk.size)
+        {
+            chunkOffset_ = offset + size;
+            return MakeTransientBufferAllocation(chunk.buffer, offset, size, chunk.mappedData + offset);
+        }
+        chunkOffset_ = 0;
+    }
+
+    /* Create new chunk that is large enough for this allocation */
+    Chunk chunk;
+    if (!CreateChunk(std::max(chunkSize_, size), chunk))
+        return {};
+
+    chunks_.push_back(chunk);
+    chunkIdx_       = chunks_.size() - 1;
+    chunkOffset_    = size;
+
+    return MakeTransientBufferAllocation(chunk.buffer, 0, size, chunk.mappedData);
+}
+
+void TransientBufferPool::Reset()
+{
+    chunkIdx_       = 0;
+    chunkOffset_    = 0;
+}
+
+
+/*
+ * ======= Protected: =======
+ */
+
+void TransientBufferPool::ReleaseChunks()
+{
+    for (Chunk& chunk : chunks_)
+        ReleaseChunk(chunk);
+    chunks_.clear();
+    Reset();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,90 @@
+/*
+ * TransientBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_TRANSIENT_BUFFER_POOL_H
+#define LLGL_TRANSIENT_BUFFER_POOL_H
+
+
+#include <LLGL/Export.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <vector>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+/*
+Linear allocator for transient buffer memory (see CommandBuffer::AllocTransientBuffer).
+The chunks are persistently mapped buffer objects that are provided by the backend.
+Backends keep one pool per native command buffer and reset it once the GPU has finished the respective submission.
+*/
+class LLGL_EXPORT TransientBufferPool
+{
+
+    public:
+
+        TransientBufferPool(const TransientBufferPool&) = delete;
+        TransientBufferPool& operator = (const TransientBufferPool&) = delete;
+
+        virtual ~TransientBufferPool() = default;
+
+        // Allocates a range of the specified size. Returns an empty allocation if the size is zero or a new chunk could not be created.
+        TransientBufferAllocation Alloc(std::uint64_t size, long bindFlags, std::uint64_t alignment);
+
+        // Resets all chunks for reuse. This must only be called once the GPU no longer reads from any previous allocation.
+        void Reset();
+
+    protected:
+
+        struct Chunk
+        {
+            Buffer*         buffer      = nullptr;
+            char*           mappedData  = nullptr;
+            std::uint64_t   size        = 0;
+        };
+
+    protected:
+
+        // Initializes the pool with the minimum chunk size and the alignment for constant buffer offsets.
+        TransientBufferPool(std::uint64_t chunkSize, std::uint64_t constantBufferAlignment);
+
+        // Creates a new buffer that is persistently mapped for CPU write access. Returns false on failure.
+        virtual bool CreateChunk(std::uint64_t size, Chunk& outChunk) = 0;
+
+        // Releases the specified chunk.
+        virtual void ReleaseChunk(Chunk& chunk) = 0;
+
+        // Releases all chunks. This must be called in the destructor of the derived class.
+        void ReleaseChunks();
+
+        // Sets the minimum size for new chunks. This is used by backends that initialize their pools after construction.
+        inline void SetChunkSize(std::uint64_t chunkSize)
+        {
+            chunkSize_ = chunkSize;
+        }
+
+    private:
+
+        std::vector<Chunk>  chunks_;
+        std::size_t         chunkIdx_                   = 0;
+        std::uint64_t       chunkOffset_                = 0;
+        std::uint64_t       chunkSize_                  = 0;
+        std::uint64_t       constantBufferAlignment_    = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include <utility>
 #include <LLGL/VertexAttribute.h>
 #include "../Core/MacroUtils.h"
+#include "FormatTable.h"
 
 
 namespace LLGL
@@ -80,7 +81,7 @@ VertexAttribute::VertexAttribute(
 
 std::uint32_t VertexAttribute::GetSize() const
 {
-    const auto& formatAttribs = GetFormatAttribs(format);
+    const auto& formatAttribs = FormatTable::GetAttribs(format);
     if ((formatAttribs.flags & FormatFlags::SupportsVertex) != 0)
         return (formatAttribs.bitSize / 8);
     else
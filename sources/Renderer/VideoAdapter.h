@@ -33,8 +33,11 @@ struct VideoAdapterInfo
 {
     UTF8String                          name;
     DeviceVendor                        vendor      = DeviceVendor::Undefined;
+    std::uint32_t                       vendorID    = 0;
+    std::uint32_t                       deviceID    = 0;
     std::uint64_t                       videoMemory = 0;
-    std::vector<VideoAdapterOutputInfo> outputs;
+    std::uint64_t                       luid        = 0;    // Locally unique identifier to find this adapter again; see AdapterInfo::luid.
+    std::vector<VideoAdapterOutputInfo> outputs;            // Only filled on demand, since enumerating all display modes is expensive.
 };
 
 
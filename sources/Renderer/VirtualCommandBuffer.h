@@ -9,6 +9,7 @@
 #define LLGL_VIRTUAL_COMMAND_BUFFER_H
 
 
+#include "CommandChunkPool.h"
 #include "../Core/Assertion.h"
 #include "../Core/CoreUtils.h"
 #include <cstddef>
@@ -137,17 +138,13 @@ class VirtualCommandBuffer
         // Takes the ownership of the specified virtual command buffer memory.
         VirtualCommandBuffer(VirtualCommandBuffer&& rhs)
         {
-            std::swap(first_, rhs.first_);
-            std::swap(current_, rhs.current_);
-            std::swap(size_, rhs.size_);
+            Swap(rhs);
         }
 
         // Takes the ownership of the specified virtual command buffer memory.
         VirtualCommandBuffer& operator = (VirtualCommandBuffer&& rhs)
         {
-            std::swap(first_, rhs.first_);
-            std::swap(current_, rhs.current_);
-            std::swap(size_, rhs.size_);
+            Swap(rhs);
             return *this;
         }
 
@@ -208,6 +205,17 @@ class VirtualCommandBuffer
             size_       = 0;
         }
 
+        // Swaps the memory chunks and capacity of this virtual command buffer with the specified one.
+        void Swap(VirtualCommandBuffer& rhs)
+        {
+            std::swap(first_, rhs.first_);
+            std::swap(current_, rhs.current_);
+            std::swap(biggest_, rhs.biggest_);
+            std::swap(capacity_, rhs.capacity_);
+            std::swap(size_, rhs.size_);
+            std::swap(initialCapacity_, rhs.initialCapacity_);
+        }
+
         // Packs the entire buffer to one consecutive memory block.
         void Pack()
         {
@@ -266,26 +274,24 @@ class VirtualCommandBuffer
 
     private:
 
-        // Allocates a new memory chunk of the specified capacity plus sizeof(Chunk).
+        // Allocates a new memory chunk of at least the specified capacity plus sizeof(Chunk) from the process-wide chunk pool.
         static Chunk* AllocChunk(std::size_t capacity, Chunk* next = nullptr)
         {
-            Chunk* chunk = reinterpret_cast<Chunk*>(::new char[sizeof(Chunk) + capacity]);
+            std::size_t chunkSize = sizeof(Chunk) + capacity;
+            Chunk* chunk = static_cast<Chunk*>(CommandChunkPool::Get().Alloc(chunkSize));
             {
-                chunk->capacity = capacity;
+                chunk->capacity = chunkSize - sizeof(Chunk);
                 chunk->size     = 0;
                 chunk->next     = next;
             }
             return chunk;
         }
 
-        // Deletes the specified memory chunk.
+        // Returns the specified memory chunk to the process-wide chunk pool.
         static void FreeChunk(Chunk* chunk)
         {
             if (chunk != nullptr)
-            {
-                char* buf = reinterpret_cast<char*>(chunk);
-                delete [] buf;
-            }
+                CommandChunkPool::Get().Free(chunk, sizeof(Chunk) + chunk->capacity);
         }
 
         // Returns a raw pointer to the beginning of the chunk data.
@@ -339,8 +345,8 @@ class VirtualCommandBuffer
         {
             current_->next = VirtualCommandBuffer::AllocChunk(capacity, next);
             current_ = current_->next;
-            capacity_ += capacity;
-            if (biggest_ == nullptr || capacity > biggest_->capacity)
+            capacity_ += current_->capacity;
+            if (biggest_ == nullptr || current_->capacity > biggest_->capacity)
                 biggest_ = current_;
         }
 
@@ -364,6 +370,7 @@ class VirtualCommandBuffer
                         Chunk* secondNext = current_->next->next;
                         if (biggest_ == current_->next)
                             biggest_ = secondNext;
+                        capacity_ -= current_->next->capacity;
                         VirtualCommandBuffer::FreeChunk(current_->next);
                         AllocNextChunkAndMakeCurrent(capacity, secondNext);
                     }
@@ -380,7 +387,7 @@ class VirtualCommandBuffer
                 first_      = VirtualCommandBuffer::AllocChunk(capacity);
                 current_    = first_;
                 biggest_    = first_;
-                capacity_   = capacity;
+                capacity_   = first_->capacity;
             }
         }
 
@@ -9,6 +9,7 @@
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include "../VKDevice.h"
+#include "../Memory/VKDeviceMemoryManager.h"
 #include "../Ext/VKExtensions.h"
 #include "../Ext/VKExtensionRegistry.h"
 #include "../../ResourceUtils.h"
@@ -54,7 +55,8 @@ static VkBufferUsageFlags GetVkBufferUsageFlags(const BufferDescriptor& desc)
         }
     }
 
-    if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0 || (desc.bindFlags & BindFlags::CopySrc) != 0)
+    /* Persistently mapped and dynamic buffers may have no staging buffer, so they must be a copy source for ReadBuffer */
+    if ((desc.cpuAccessFlags & CPUAccessFlags::Read) != 0 || (desc.bindFlags & BindFlags::CopySrc) != 0 || (desc.miscFlags & (MiscFlags::PersistentMapping | MiscFlags::DynamicUsage)) != 0)
         flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 
     return flags;
@@ -88,7 +90,7 @@ static std::uint32_t GetVKBufferStride(const BufferDescriptor& desc)
     return (desc.vertexAttribs.empty() ? 1 : std::max<std::uint32_t>(1u, desc.vertexAttribs[0].stride));
 }
 
-VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
+VKBuffer::VKBuffer(const VKDevice& device, const BufferDescriptor& desc) :
     Buffer            { desc.bindFlags                         },
     bufferObj_        { device                                 },
     bufferObjStaging_ { device                                 },
@@ -99,16 +101,28 @@ VKBuffer::VKBuffer(VkDevice device, const BufferDescriptor& desc) :
     if ((desc.bindFlags & BindFlags::IndexBuffer) != 0)
         indexType_ = VKTypes::ToVkIndexType(desc.format);
 
+    /* Buffers must be shared concurrently if they can be accessed by dedicated compute or transfer queues */
+    const bool isConcurrent = (device.GetNumSharedQueueFamilies() > 1);
+
+    /* Buffers whose memory is exported or imported must declare their external handle type */
+    VkExternalMemoryBufferCreateInfo externalInfo;
+    {
+        externalInfo.sType          = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+        externalInfo.pNext          = nullptr;
+        externalInfo.handleTypes    = VKExternalMemory::GetVkHandleType();
+    }
+    const bool isExternal = ((desc.miscFlags & MiscFlags::Shared) != 0);
+
     VkBufferCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        createInfo.pNext                    = nullptr;
+        createInfo.pNext                    = (isExternal ? &externalInfo : nullptr);
         createInfo.flags                    = 0;
         createInfo.size                     = GetInternalSize();
         createInfo.usage                    = GetVkBufferUsageFlags(desc);
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE;
-        createInfo.queueFamilyIndexCount    = 0;
-        createInfo.pQueueFamilyIndices      = nullptr;
+        createInfo.sharingMode              = (isConcurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE);
+        createInfo.queueFamilyIndexCount    = (isConcurrent ? device.GetNumSharedQueueFamilies() : 0);
+        createInfo.pQueueFamilyIndices      = (isConcurrent ? device.GetSharedQueueFamilies() : nullptr);
     }
     bufferObj_.CreateVkBuffer(device, createInfo);
 }
@@ -143,6 +157,25 @@ void VKBuffer::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryReg
     bufferObj_.BindMemoryRegion(device, memoryRegion);
 }
 
+void VKBuffer::AllocateExternalMemory(VKDeviceMemoryManager& deviceMemoryMngr, const SharedResourceHandle* importHandle)
+{
+    const VkMemoryRequirements& requirements = bufferObj_.GetRequirements();
+
+    /* Allocate or import dedicated device memory; shared memory is never sub-allocated since the whole allocation is exported */
+    externalMemory_ = MakeUnique<VKExternalMemory>(
+        deviceMemoryMngr.GetVkDevice(),
+        requirements.size,
+        deviceMemoryMngr.FindMemoryType(requirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+        VK_NULL_HANDLE,
+        GetVkBuffer(),
+        importHandle
+    );
+
+    /* Bind buffer to the beginning of the dedicated device memory */
+    VkResult result = vkBindBufferMemory(deviceMemoryMngr.GetVkDevice(), GetVkBuffer(), externalMemory_->GetVkDeviceMemory(), 0);
+    VKThrowIfFailed(result, "failed to bind Vulkan buffer to shared device memory");
+}
+
 void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
 {
     bufferObjStaging_ = std::move(deviceBuffer);
@@ -150,6 +183,21 @@ void VKBuffer::TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer)
 
 void* VKBuffer::Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length)
 {
+    if (persistentData_ != nullptr)
+    {
+        /* Make device writes visible to the host for read access */
+        if (HasReadAccess(access))
+            InvalidateMappedRange(device, offset, length);
+
+        if (HasWriteAccess(access))
+        {
+            mappedWriteRange_[0] = offset;
+            mappedWriteRange_[1] = offset + length;
+        }
+
+        /* Return persistently mapped memory without re-mapping the buffer */
+        return (persistentData_ + offset);
+    }
     if (VkBuffer stagingBuffer = GetStagingVkBuffer())
     {
         /* Copy GPU local buffer into staging buffer for read accces */
@@ -170,7 +218,17 @@ void* VKBuffer::Map(VKDevice& device, const CPUAccess access, VkDeviceSize offse
 
 void VKBuffer::Unmap(VKDevice& device)
 {
-    if (VkBuffer stagingBuffer = GetStagingVkBuffer())
+    if (persistentData_ != nullptr)
+    {
+        /* Flush written range but keep buffer mapped */
+        if (mappedWriteRange_[0] < mappedWriteRange_[1])
+        {
+            FlushMappedRange(device, mappedWriteRange_[0], mappedWriteRange_[1] - mappedWriteRange_[0]);
+            mappedWriteRange_[0] = 0;
+            mappedWriteRange_[1] = 0;
+        }
+    }
+    else if (VkBuffer stagingBuffer = GetStagingVkBuffer())
     {
         /* Unmap staging buffer */
         bufferObjStaging_.Unmap(device);
@@ -187,6 +245,74 @@ void VKBuffer::Unmap(VKDevice& device)
     }
 }
 
+void VKBuffer::MapPersistent(VkDevice device, VkDeviceSize nonCoherentAtomSize)
+{
+    if (persistentData_ == nullptr)
+    {
+        persistentData_         = static_cast<char*>(bufferObj_.Map(device));
+        nonCoherentAtomSize_    = nonCoherentAtomSize;
+    }
+}
+
+void VKBuffer::UnmapPersistent(VkDevice device)
+{
+    if (persistentData_ != nullptr)
+    {
+        bufferObj_.Unmap(device);
+        persistentData_ = nullptr;
+    }
+}
+
+// Returns the mapped memory range of the specified buffer range aligned to the non-coherent atom size.
+static VkMappedMemoryRange GetAlignedVkMappedMemoryRange(
+    const VKDeviceMemoryRegion& region,
+    VkDeviceSize                offset,
+    VkDeviceSize                length,
+    VkDeviceSize                nonCoherentAtomSize)
+{
+    const VKDeviceMemory*   deviceMemory    = region.GetParentChunk();
+    const VkDeviceSize      begin           = region.GetOffset() + offset;
+    const VkDeviceSize      end             = std::min(begin + length, deviceMemory->GetSize());
+    const VkDeviceSize      alignedBegin    = begin - (begin % nonCoherentAtomSize);
+    const VkDeviceSize      alignedEnd      = std::min(GetAlignedSize(end, nonCoherentAtomSize), deviceMemory->GetSize());
+
+    VkMappedMemoryRange memoryRange;
+    {
+        memoryRange.sType   = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        memoryRange.pNext   = nullptr;
+        memoryRange.memory  = deviceMemory->GetVkDeviceMemory();
+        memoryRange.offset  = alignedBegin;
+        memoryRange.size    = (alignedEnd == deviceMemory->GetSize() ? VK_WHOLE_SIZE : alignedEnd - alignedBegin);
+    }
+    return memoryRange;
+}
+
+void VKBuffer::FlushMappedRange(VkDevice device, VkDeviceSize offset, VkDeviceSize length)
+{
+    if (persistentData_ != nullptr && nonCoherentAtomSize_ > 0 && length > 0)
+    {
+        if (VKDeviceMemoryRegion* region = bufferObj_.GetMemoryRegion())
+        {
+            const VkMappedMemoryRange memoryRange = GetAlignedVkMappedMemoryRange(*region, offset, length, nonCoherentAtomSize_);
+            VkResult result = vkFlushMappedMemoryRanges(device, 1, &memoryRange);
+            VKThrowIfFailed(result, "failed to flush mapped memory range");
+        }
+    }
+}
+
+void VKBuffer::InvalidateMappedRange(VkDevice device, VkDeviceSize offset, VkDeviceSize length)
+{
+    if (persistentData_ != nullptr && nonCoherentAtomSize_ > 0 && length > 0)
+    {
+        if (VKDeviceMemoryRegion* region = bufferObj_.GetMemoryRegion())
+        {
+            const VkMappedMemoryRange memoryRange = GetAlignedVkMappedMemoryRange(*region, offset, length, nonCoherentAtomSize_);
+            VkResult result = vkInvalidateMappedMemoryRanges(device, 1, &memoryRange);
+            VKThrowIfFailed(result, "failed to invalidate mapped memory range");
+        }
+    }
+}
+
 VkDeviceSize VKBuffer::GetInternalSize() const
 {
     return ((GetBindFlags() & BindFlags::StreamOutputBuffer) != 0 ? GetSize() + k_xfbCounterSize : GetSize());
@@ -12,6 +12,8 @@
 #include <LLGL/Buffer.h>
 #include "VKDeviceBuffer.h"
 #include "../Memory/VKDeviceMemory.h"
+#include "../Memory/VKExternalMemory.h"
+#include <memory>
 
 
 namespace LLGL
@@ -29,14 +31,28 @@ class VKBuffer : public Buffer
 
     public:
 
-        VKBuffer(VkDevice device, const BufferDescriptor& desc);
+        VKBuffer(const VKDevice& device, const BufferDescriptor& desc);
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
+
+        // Allocates dedicated exportable device memory for this buffer, or imports it from 'importHandle' if it is non-null. Only for buffers with MiscFlags::Shared.
+        void AllocateExternalMemory(VKDeviceMemoryManager& deviceMemoryMngr, const SharedResourceHandle* importHandle = nullptr);
         void TakeStagingBuffer(VKDeviceBuffer&& deviceBuffer);
 
         void* Map(VKDevice& device, const CPUAccess access, VkDeviceSize offset, VkDeviceSize length);
         void Unmap(VKDevice& device);
 
+        // Maps the primary buffer memory for the lifetime of this buffer. Map and Unmap will then only return this memory.
+        // If 'nonCoherentAtomSize' is non-zero, the memory is not host coherent and mapped ranges are flushed and invalidated explicitly.
+        void MapPersistent(VkDevice device, VkDeviceSize nonCoherentAtomSize);
+        void UnmapPersistent(VkDevice device);
+
+        // Flushes the specified range of persistently mapped memory if it is not host coherent.
+        void FlushMappedRange(VkDevice device, VkDeviceSize offset, VkDeviceSize length);
+
+        // Invalidates the specified range of persistently mapped memory if it is not host coherent.
+        void InvalidateMappedRange(VkDevice device, VkDeviceSize offset, VkDeviceSize length);
+
         // Returns the actual size of this buffer.
         // This might be larger than GetSize() if the buffer has additional payload such as the transform-feedback counter.
         VkDeviceSize GetInternalSize() const;
@@ -86,6 +102,30 @@ class VKBuffer : public Buffer
             return size_;
         }
 
+        // Returns true if this buffer is persistently mapped into CPU memory space.
+        inline bool IsPersistentlyMapped() const
+        {
+            return (persistentData_ != nullptr);
+        }
+
+        // Marks this buffer to be written directly into its persistently mapped device-local memory instead of through a staging buffer.
+        inline void MarkDirectWrite()
+        {
+            isDirectWrite_ = true;
+        }
+
+        // Returns true if this buffer is written directly into its device-local memory. See MarkDirectWrite().
+        inline bool IsDirectWrite() const
+        {
+            return isDirectWrite_;
+        }
+
+        // Returns the dedicated device memory if this buffer was created with MiscFlags::Shared, or null otherwise.
+        inline VKExternalMemory* GetExternalMemory() const
+        {
+            return externalMemory_.get();
+        }
+
         // Returns the VkIndexType specified at creation time.
         inline VkIndexType GetIndexType() const
         {
@@ -106,6 +146,9 @@ class VKBuffer : public Buffer
 
     private:
 
+        // Dedicated memory of shared buffers; declared before the buffer, so it outlives the buffer it is bound to
+        std::unique_ptr<VKExternalMemory> externalMemory_;
+
         VKDeviceBuffer  bufferObj_;
         VKDeviceBuffer  bufferObjStaging_;
 
@@ -117,6 +160,10 @@ class VKBuffer : public Buffer
         VkAccessFlags   accessFlags_            = 0;
         std::uint32_t   stride_                 = 0;
 
+        char*           persistentData_         = nullptr;
+        VkDeviceSize    nonCoherentAtomSize_    = 0; // Non-zero if persistently mapped memory is not host coherent
+        bool            isDirectWrite_          = false;
+
 };
 
 
@@ -0,0 +1,417 @@
+/*
+ * VKStagingBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKStagingBufferPool.h"
+#include "../VKDevice.h"
+#include "../VKCore.h"
+#include "../VKInitializers.h"
+#include "../Command/VKCommandQueue.h"
+#include "../Command/VKCommandContext.h"
+#include "../Texture/VKTexture.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../../ProfileCounters.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/ImageUtils.h"
+#include <LLGL/ImageFlags.h>
+#include <algorithm>
+#include <limits.h>
+
+
+namespace LLGL
+{
+
+
+// Alignment of sub-allocations within a chunk; vkCmdCopyBuffer has no alignment requirements, but this keeps copies on cache-line boundaries.
+static constexpr VkDeviceSize g_stagingAlignment = 64;
+
+VKStagingBufferPool::Chunk::Chunk(VKDeviceBuffer&& buffer, VkDeviceSize size) :
+    buffer { std::move(buffer) },
+    size   { size              }
+{
+}
+
+VKStagingBufferPool::VKStagingBufferPool(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize chunkSize) :
+    device_           { device                     },
+    deviceMemoryMngr_ { deviceMemoryMngr           },
+    chunkSize_        { chunkSize                  },
+    waitSemaphore_    { device, vkDestroySemaphore }
+{
+}
+
+VKStagingBufferPool::~VKStagingBufferPool()
+{
+    /* Wait for all in-flight transfers before their command buffers and memory regions are released */
+    FlushAndWait();
+
+    if (!freeCommandBuffers_.empty())
+    {
+        vkFreeCommandBuffers(
+            device_,
+            device_.GetVkCommandPool(),
+            static_cast<std::uint32_t>(freeCommandBuffers_.size()),
+            freeCommandBuffers_.data()
+        );
+    }
+
+    for (Chunk& chunk : chunks_)
+        chunk.buffer.ReleaseMemoryRegion(deviceMemoryMngr_);
+}
+
+void VKStagingBufferPool::WriteStaged(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize dataSize)
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+
+    /* Reclaim memory of all batches the GPU has already finished */
+    RecycleCompletedBatches();
+
+    /* Copy input data into the next free range of the upload ring */
+    Chunk& chunk = FindOrAllocChunk(dataSize);
+
+    const VkDeviceSize srcOffset = chunk.offset;
+    device_.WriteBuffer(chunk.buffer, data, dataSize, srcOffset);
+
+    chunk.offset        = GetAlignedSize(srcOffset + dataSize, g_stagingAlignment);
+    chunk.lastBatchId   = nextBatchId_;
+    LLGL_PROFILE_COUNTER_ADD(stagingUploadBytes, dataSize);
+
+    /* Record copy command into pending transfer command buffer */
+    VkBufferCopy region;
+    {
+        region.srcOffset    = srcOffset;
+        region.dstOffset    = dstOffset;
+        region.size         = dataSize;
+    }
+    vkCmdCopyBuffer(GetOrBeginPendingCommandBuffer(), chunk.buffer.GetVkBuffer(), dstBuffer, 1, &region);
+}
+
+void VKStagingBufferPool::WriteStagedImage(
+    VKTexture&              dstTexture,
+    const TextureRegion&    region,
+    const Extent3D&         extent,
+    const void*             data,
+    VkDeviceSize            dataSize,
+    std::uint32_t           srcRowStride,
+    std::uint32_t           bpp)
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+
+    /* Reclaim memory of all batches the GPU has already finished */
+    RecycleCompletedBatches();
+
+    /* Buffer offsets for image copies must also be a multiple of the texel size, which is not a power of two for formats like RGB8 */
+    const VkDeviceSize alignment = (bpp > 0 && g_stagingAlignment % bpp != 0 ? g_stagingAlignment * bpp : g_stagingAlignment);
+
+    /* Copy input data into the next free range of the upload ring and repack rows if necessary */
+    Chunk& chunk = FindOrAllocChunk(dataSize + alignment);
+
+    const VkDeviceSize srcOffset = GetAlignedSize(chunk.offset, alignment);
+
+    if (bpp > 0)
+    {
+        if (void* memory = chunk.buffer.Map(device_, srcOffset, dataSize))
+        {
+            const std::uint32_t dstRowStride    = extent.width * bpp;
+            const std::uint32_t dstLayerStride  = extent.height * dstRowStride;
+            const std::uint32_t srcLayerStride  = extent.height * srcRowStride;
+
+            BitBlit(
+                extent, bpp,
+                static_cast<char*>(memory), dstRowStride, dstLayerStride,
+                static_cast<const char*>(data), srcRowStride, srcLayerStride
+            );
+
+            chunk.buffer.Unmap(device_);
+        }
+    }
+    else
+        device_.WriteBuffer(chunk.buffer, data, dataSize, srcOffset);
+
+    chunk.offset        = GetAlignedSize(srcOffset + dataSize, g_stagingAlignment);
+    chunk.lastBatchId   = nextBatchId_;
+    LLGL_PROFILE_COUNTER_ADD(stagingUploadBytes, dataSize);
+
+    /* Record copy command into pending transfer command buffer and restore the previous image layout afterwards */
+    VKCommandContext context{ GetOrBeginPendingCommandBuffer() };
+
+    const TextureSubresource& subresource = region.subresource;
+    VkImageLayout oldLayout = dstTexture.TransitionImageLayout(context, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
+
+    /* Use input offset and extent (instead of transient dimensions) because copy operation takes subresource parameters into account */
+    context.CopyBufferToImage(
+        chunk.buffer.GetVkBuffer(),
+        dstTexture.GetVkImage(),
+        dstTexture.GetVkFormat(),
+        VkOffset3D{ region.offset.x, region.offset.y, region.offset.z },
+        VkExtent3D{ region.extent.width, region.extent.height, region.extent.depth },
+        subresource,
+        0,
+        0,
+        srcOffset
+    );
+
+    dstTexture.TransitionImageLayout(context, oldLayout, subresource, true);
+}
+
+void VKStagingBufferPool::Flush()
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+    if (pendingCommandBuffer_ == VK_NULL_HANDLE)
+        return;
+
+    /* Make transfer writes visible to all subsequent commands in submission order */
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = (VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT);
+    }
+    vkCmdPipelineBarrier(
+        pendingCommandBuffer_,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        0,
+        1, &memoryBarrier,
+        0, nullptr,
+        0, nullptr
+    );
+    LLGL_PROFILE_COUNTER_ADD(barriers, 1);
+
+    VkResult result = vkEndCommandBuffer(pendingCommandBuffer_);
+    VKThrowIfFailed(result, "failed to end recording Vulkan staging command buffer");
+
+    /* Submit transfer batch with a recycled fence */
+    Batch batch;
+    {
+        batch.commandBuffer = pendingCommandBuffer_;
+        batch.fence         = GetOrCreateFence();
+        batch.id            = nextBatchId_++;
+    }
+    if (VkSemaphore waitSemaphore = ConsumeWaitSemaphore())
+    {
+        /* Wait for previous queue operations that signaled the semaphore, e.g. sparse bindings of the destination textures */
+        const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        VkSubmitInfo submitInfo;
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = 1;
+            submitInfo.pWaitSemaphores      = &waitSemaphore;
+            submitInfo.pWaitDstStageMask    = &waitDstStageMask;
+            submitInfo.commandBufferCount   = 1;
+            submitInfo.pCommandBuffers      = &(batch.commandBuffer);
+            submitInfo.signalSemaphoreCount = 0;
+            submitInfo.pSignalSemaphores    = nullptr;
+        }
+        result = vkQueueSubmit(device_.GetVkQueue(), 1, &submitInfo, batch.fence);
+    }
+    else
+        result = VKSubmitCommandBuffer(device_.GetVkQueue(), batch.commandBuffer, batch.fence);
+    VKThrowIfFailed(result, "failed to submit Vulkan staging command buffer");
+
+    inFlightBatches_.push_back(std::move(batch));
+    pendingCommandBuffer_ = VK_NULL_HANDLE;
+}
+
+void VKStagingBufferPool::FlushAndWait()
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+    Flush();
+    while (!inFlightBatches_.empty())
+    {
+        Batch& batch = inFlightBatches_.front();
+        vkWaitForFences(device_, 1, batch.fence.GetAddressOf(), VK_TRUE, ULLONG_MAX);
+        RecycleBatch(batch);
+        inFlightBatches_.pop_front();
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKStagingBufferPool::Chunk& VKStagingBufferPool::FindOrAllocChunk(VkDeviceSize size)
+{
+    /* Continue with current chunk if it still has enough capacity */
+    if (chunkIdx_ < chunks_.size())
+    {
+        Chunk& chunk = chunks_[chunkIdx_];
+        if (chunk.offset + size <= chunk.size)
+            return chunk;
+    }
+
+    /* Advance through the ring and reuse the next chunk that is no longer referenced by the GPU */
+    for (std::size_t i = 1; i <= chunks_.size(); ++i)
+    {
+        const std::size_t idx = (chunkIdx_ + i) % chunks_.size();
+        Chunk& chunk = chunks_[idx];
+        if (chunk.lastBatchId <= completedBatchId_)
+        {
+            chunk.offset = 0;
+            if (size <= chunk.size)
+            {
+                chunkIdx_ = idx;
+                return chunk;
+            }
+        }
+    }
+
+    /* Allocate new chunk with at least the default chunk size */
+    const VkDeviceSize chunkSize = std::max(chunkSize_, GetAlignedSize(size, g_stagingAlignment));
+
+    VkBufferCreateInfo createInfo;
+    BuildVkBufferCreateInfo(createInfo, chunkSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+
+    VKDeviceBuffer buffer
+    {
+        device_,
+        createInfo,
+        deviceMemoryMngr_,
+        (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    };
+
+    chunkIdx_ = chunks_.size();
+    chunks_.emplace_back(std::move(buffer), chunkSize);
+    return chunks_.back();
+}
+
+VkCommandBuffer VKStagingBufferPool::GetOrBeginPendingCommandBuffer()
+{
+    if (pendingCommandBuffer_ != VK_NULL_HANDLE)
+        return pendingCommandBuffer_;
+
+    /* Reuse command buffer of a completed batch or allocate a new one */
+    if (!freeCommandBuffers_.empty())
+    {
+        pendingCommandBuffer_ = freeCommandBuffers_.back();
+        freeCommandBuffers_.pop_back();
+    }
+    else
+        pendingCommandBuffer_ = device_.AllocCommandBuffer(false);
+
+    VkCommandBufferBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.flags             = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        beginInfo.pInheritanceInfo  = nullptr;
+    }
+    VkResult result = vkBeginCommandBuffer(pendingCommandBuffer_, &beginInfo);
+    VKThrowIfFailed(result, "failed to begin recording Vulkan staging command buffer");
+
+    /* Don't overwrite destination buffers before previously submitted commands have finished accessing them */
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        memoryBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    }
+    vkCmdPipelineBarrier(
+        pendingCommandBuffer_,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        VK_PIPELINE_STAGE_TRANSFER_BIT,
+        0,
+        1, &memoryBarrier,
+        0, nullptr,
+        0, nullptr
+    );
+    LLGL_PROFILE_COUNTER_ADD(barriers, 1);
+
+    return pendingCommandBuffer_;
+}
+
+std::uint64_t VKStagingBufferPool::GetSubmitCount() const
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+    return (nextBatchId_ - 1);
+}
+
+bool VKStagingBufferPool::SignalWaitSemaphore()
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+    const bool wasPending = isWaitSemaphorePending_;
+    isWaitSemaphorePending_ = true;
+    return wasPending;
+}
+
+VkSemaphore VKStagingBufferPool::GetOrCreateWaitSemaphore()
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+    if (waitSemaphore_.Get() == VK_NULL_HANDLE)
+    {
+        VkSemaphoreCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateSemaphore(device_, &createInfo, nullptr, waitSemaphore_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan semaphore for staging buffer pool");
+    }
+    return waitSemaphore_;
+}
+
+VkSemaphore VKStagingBufferPool::ConsumeWaitSemaphore()
+{
+    std::unique_lock<std::recursive_mutex> lock = device_.LockQueue();
+    if (!isWaitSemaphorePending_)
+        return VK_NULL_HANDLE;
+    isWaitSemaphorePending_ = false;
+    return waitSemaphore_;
+}
+
+VKPtr<VkFence> VKStagingBufferPool::GetOrCreateFence()
+{
+    if (!freeFences_.empty())
+    {
+        VKPtr<VkFence> fence = std::move(freeFences_.back());
+        freeFences_.pop_back();
+        return fence;
+    }
+
+    VKPtr<VkFence> fence{ device_, vkDestroyFence };
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    VkResult result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for staging buffer pool");
+    return fence;
+}
+
+void VKStagingBufferPool::RecycleCompletedBatches()
+{
+    while (!inFlightBatches_.empty())
+    {
+        Batch& batch = inFlightBatches_.front();
+        if (vkGetFenceStatus(device_, batch.fence) != VK_SUCCESS)
+            break;
+        RecycleBatch(batch);
+        inFlightBatches_.pop_front();
+    }
+}
+
+void VKStagingBufferPool::RecycleBatch(Batch& batch)
+{
+    vkResetFences(device_, 1, batch.fence.GetAddressOf());
+    vkResetCommandBuffer(batch.commandBuffer, 0);
+
+    completedBatchId_ = batch.id;
+    freeCommandBuffers_.push_back(batch.commandBuffer);
+    freeFences_.push_back(std::move(batch.fence));
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
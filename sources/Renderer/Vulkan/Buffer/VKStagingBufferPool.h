@@ -0,0 +1,152 @@
+/*
+ * VKStagingBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_STAGING_BUFFER_POOL_H
+#define LLGL_VK_STAGING_BUFFER_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "VKDeviceBuffer.h"
+#include <vector>
+#include <deque>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKDeviceMemoryManager;
+class VKTexture;
+struct TextureRegion;
+struct Extent3D;
+
+/*
+Upload ring for buffer and texture updates: Host-visible chunks are sub-allocated linearly and the copy commands
+are batched into a single transfer command buffer, which is submitted before the next command buffer submission.
+Chunks, command buffers, and fences are recycled once the GPU has finished the batch that referenced them.
+All public functions lock the graphics queue of the device (see VKDevice::LockQueue()), since resources can be created on multiple threads.
+*/
+class VKStagingBufferPool
+{
+
+    public:
+
+        VKStagingBufferPool(VKDevice& device, VKDeviceMemoryManager& deviceMemoryMngr, VkDeviceSize chunkSize);
+        ~VKStagingBufferPool();
+
+        VKStagingBufferPool(const VKStagingBufferPool&) = delete;
+        VKStagingBufferPool& operator = (const VKStagingBufferPool&) = delete;
+
+        // Writes the specified data into the upload ring and records a copy command into the pending transfer command buffer.
+        void WriteStaged(VkBuffer dstBuffer, VkDeviceSize dstOffset, const void* data, VkDeviceSize dataSize);
+
+        /*
+        Writes the specified image data into the upload ring and records a buffer-to-image copy into the pending transfer command buffer.
+        The source rows are repacked from 'srcRowStride' into a tightly packed layout, unless 'bpp' is zero (i.e. compressed formats).
+        The image subresource is transitioned into transfer layout and back into its previous layout within the same command buffer.
+        */
+        void WriteStagedImage(
+            VKTexture&              dstTexture,
+            const TextureRegion&    region,
+            const Extent3D&         extent,
+            const void*             data,
+            VkDeviceSize            dataSize,
+            std::uint32_t           srcRowStride,
+            std::uint32_t           bpp
+        );
+
+        // Submits the pending transfer command buffer without waiting for it to complete. Does nothing if there are no pending copies.
+        void Flush();
+
+        // Submits the pending transfer command buffer and blocks until all submitted transfers have completed.
+        void FlushAndWait();
+
+        // Returns the number of transfer batches that have been submitted so far. Transfers are always submitted to the primary queue.
+        std::uint64_t GetSubmitCount() const;
+
+        /*
+        Marks the wait semaphore as signaled by another queue operation, e.g. sparse binding, so the next transfer submission waits on it.
+        Returns true if the previous signal has not been waited on yet, in which case the caller must wait on it before signaling it again.
+        */
+        bool SignalWaitSemaphore();
+
+        // Returns the binary semaphore the next transfer submission waits on if it has been signaled. Creates the semaphore on first use.
+        VkSemaphore GetOrCreateWaitSemaphore();
+
+        // Returns the signaled wait semaphore and resets its pending state for a submission outside of this pool, or null if it has not been signaled.
+        VkSemaphore ConsumeWaitSemaphore();
+
+    private:
+
+        struct Chunk
+        {
+            Chunk(VKDeviceBuffer&& buffer, VkDeviceSize size);
+
+            VKDeviceBuffer  buffer;
+            VkDeviceSize    size        = 0;
+            VkDeviceSize    offset      = 0;
+            std::uint64_t   lastBatchId = 0;
+        };
+
+        struct Batch
+        {
+            VkCommandBuffer commandBuffer   = VK_NULL_HANDLE;
+            VKPtr<VkFence>  fence;
+            std::uint64_t   id              = 0;
+        };
+
+    private:
+
+        // Returns a chunk with enough capacity that is not referenced by any in-flight batch, or allocates a new one.
+        Chunk& FindOrAllocChunk(VkDeviceSize size);
+
+        // Returns the pending transfer command buffer and begins recording a new one if necessary.
+        VkCommandBuffer GetOrBeginPendingCommandBuffer();
+
+        // Returns a recycled fence or creates a new one.
+        VKPtr<VkFence> GetOrCreateFence();
+
+        // Recycles all in-flight batches whose fences have already been signaled.
+        void RecycleCompletedBatches();
+
+        // Recycles the specified batch. Batches must be recycled in submission order.
+        void RecycleBatch(Batch& batch);
+
+    private:
+
+        VKDevice&                       device_;
+        VKDeviceMemoryManager&          deviceMemoryMngr_;
+        VkDeviceSize                    chunkSize_              = 0;
+
+        std::vector<Chunk>              chunks_;
+        std::size_t                     chunkIdx_               = 0;
+
+        VkCommandBuffer                 pendingCommandBuffer_   = VK_NULL_HANDLE;
+        std::deque<Batch>               inFlightBatches_;
+        std::vector<VkCommandBuffer>    freeCommandBuffers_;
+        std::vector<VKPtr<VkFence>>     freeFences_;
+
+        std::uint64_t                   nextBatchId_            = 1;
+        std::uint64_t                   completedBatchId_       = 0;
+
+        VKPtr<VkSemaphore>              waitSemaphore_;
+        bool                            isWaitSemaphorePending_ = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
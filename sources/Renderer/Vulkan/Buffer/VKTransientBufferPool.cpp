@@ -0,0 +1,111 @@
+/*
+ * VKTransientBufferPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKTransientBufferPool.h"
+#include "VKBuffer.h"
+#include "../VKDevice.h"
+#include "../VKPhysicalDevice.h"
+#include "../VKCore.h"
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKTransientBufferPool::VKTransientBufferPool(const VKDevice& device, const VKPhysicalDevice& physicalDevice, VkDeviceSize chunkSize) :
+    TransientBufferPool { chunkSize, physicalDevice.GetProperties().limits.minUniformBufferOffsetAlignment },
+    device_             { device                                                                          },
+    physicalDevice_     { physicalDevice                                                                  }
+{
+}
+
+VKTransientBufferPool::~VKTransientBufferPool()
+{
+    ReleaseChunks();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKTransientBufferPool::CreateChunk(std::uint64_t size, Chunk& outChunk)
+{
+    /* Create buffer object without device memory */
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = size;
+        bufferDesc.bindFlags    = (BindFlags::VertexBuffer | BindFlags::IndexBuffer | BindFlags::ConstantBuffer);
+        bufferDesc.miscFlags    = MiscFlags::DynamicUsage;
+    }
+    auto* bufferVK = new VKBuffer{ device_, bufferDesc };
+
+    /* Allocate dedicated host-visible memory and bind it to the buffer */
+    const VkMemoryRequirements& requirements = bufferVK->GetDeviceBuffer().GetRequirements();
+
+    VkMemoryAllocateInfo allocInfo;
+    {
+        allocInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext             = nullptr;
+        allocInfo.allocationSize    = requirements.size;
+        allocInfo.memoryTypeIndex   = physicalDevice_.FindMemoryType(
+            requirements.memoryTypeBits,
+            (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+        );
+    }
+    VKPtr<VkDeviceMemory> deviceMemory{ device_, vkFreeMemory };
+    VkResult result = vkAllocateMemory(device_, &allocInfo, nullptr, deviceMemory.ReleaseAndGetAddressOf());
+    if (result != VK_SUCCESS)
+    {
+        delete bufferVK;
+        return false;
+    }
+
+    result = vkBindBufferMemory(device_, bufferVK->GetVkBuffer(), deviceMemory, 0);
+    VKThrowIfFailed(result, "failed to bind Vulkan device memory to transient buffer");
+
+    /* Keep memory mapped until the chunk is released */
+    void* mappedData = nullptr;
+    result = vkMapMemory(device_, deviceMemory, 0, VK_WHOLE_SIZE, 0, &mappedData);
+    VKThrowIfFailed(result, "failed to map Vulkan transient buffer into CPU memory space");
+
+    outChunk.buffer     = bufferVK;
+    outChunk.mappedData = static_cast<char*>(mappedData);
+    outChunk.size       = size;
+
+    ChunkMemory chunkMemory{ bufferVK, std::move(deviceMemory) };
+    chunkMemories_.push_back(std::move(chunkMemory));
+
+    return true;
+}
+
+void VKTransientBufferPool::ReleaseChunk(Chunk& chunk)
+{
+    auto it = std::find_if(
+        chunkMemories_.begin(),
+        chunkMemories_.end(),
+        [&chunk](const ChunkMemory& entry) -> bool
+        {
+            return (entry.buffer == chunk.buffer);
+        }
+    );
+    if (it != chunkMemories_.end())
+    {
+        /* Release buffer object before its device memory */
+        vkUnmapMemory(device_, it->deviceMemory);
+        delete it->buffer;
+        chunkMemories_.erase(it);
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
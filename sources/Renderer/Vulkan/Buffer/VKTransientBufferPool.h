@@ -0,0 +1,68 @@
+/*
+ * VKTransientBufferPool.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_TRANSIENT_BUFFER_POOL_H
+#define LLGL_VK_TRANSIENT_BUFFER_POOL_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include "../../TransientBufferPool.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class VKDevice;
+class VKPhysicalDevice;
+class VKBuffer;
+
+/*
+Transient buffer pool whose chunks are VKBuffer objects in host-visible and host-coherent memory.
+Each chunk has its own VkDeviceMemory allocation, because it stays mapped for the lifetime of the chunk
+and memory of the device memory manager can be mapped by other buffers that share the same allocation.
+*/
+class VKTransientBufferPool final : public TransientBufferPool
+{
+
+    public:
+
+        VKTransientBufferPool(const VKDevice& device, const VKPhysicalDevice& physicalDevice, VkDeviceSize chunkSize);
+        ~VKTransientBufferPool();
+
+    private:
+
+        bool CreateChunk(std::uint64_t size, Chunk& outChunk) override;
+        void ReleaseChunk(Chunk& chunk) override;
+
+    private:
+
+        struct ChunkMemory
+        {
+            VKBuffer*               buffer;
+            VKPtr<VkDeviceMemory>   deviceMemory;
+        };
+
+    private:
+
+        const VKDevice&             device_;
+        const VKPhysicalDevice&     physicalDevice_;
+        std::vector<ChunkMemory>    chunkMemories_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "VKCommandBuffer.h"
 #include "VKCommandQueue.h"
+#include "../VKDevice.h"
 #include "../VKPhysicalDevice.h"
 #include "../VKSwapChain.h"
 #include "../VKTypes.h"
@@ -24,11 +25,16 @@
 #include "../Buffer/VKBuffer.h"
 #include "../Buffer/VKBufferArray.h"
 #include "../../CheckedCast.h"
+#include "../../CommandBufferUtils.h"
+#include "../../BufferUtils.h"
 #include "../../../Core/Assertion.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../FrameArena.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Constants.h>
 #include <LLGL/TypeInfo.h>
+#include <LLGL/Log.h>
+#include <algorithm>
 #include <cstddef>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
@@ -51,14 +57,17 @@ static std::uint32_t GetMaxDrawIndirectCount(const VKPhysicalDevice& physicalDev
 
 VKCommandBuffer::VKCommandBuffer(
     const VKPhysicalDevice&         physicalDevice,
-    VkDevice                        device,
-    VkQueue                         commandQueue,
+    const VKDevice&                 device,
+    VKCommandQueue&                 commandQueue,
     const VKQueueFamilyIndices&     queueFamilyIndices,
+    std::uint32_t                   queueFamilyIndex,
     const CommandBufferDescriptor&  desc)
 :
     device_                 { device                                        },
     commandQueue_           { commandQueue                                  },
-    commandPool_            { device, vkDestroyCommandPool                  },
+    commandPoolArray_       { VKPtr<VkCommandPool>{ device, vkDestroyCommandPool },
+                              VKPtr<VkCommandPool>{ device, vkDestroyCommandPool },
+                              VKPtr<VkCommandPool>{ device, vkDestroyCommandPool } },
     numCommandBuffers_      { VKCommandBuffer::GetNumVkCommandBuffers(desc) },
     queuePresentFamily_     { queueFamilyIndices.presentFamily              },
     maxDrawIndirectCount_   { GetMaxDrawIndirectCount(physicalDevice)       },
@@ -67,7 +76,13 @@ VKCommandBuffer::VKCommandBuffer(
                               VKPtr<VkFence>{ device, vkDestroyFence }      },
     descriptorSetPoolArray_ { device,
                               device,
-                              device                                        }
+                              device                                        },
+    transientBufferPoolArray_
+    {
+        { device, physicalDevice, desc.minStagingPoolSize },
+        { device, physicalDevice, desc.minStagingPoolSize },
+        { device, physicalDevice, desc.minStagingPoolSize },
+    }
 {
     /* Translate creation flags */
     if ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0)
@@ -82,8 +97,14 @@ VKCommandBuffer::VKCommandBuffer(
             bufferLevel_ = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
             if (desc.renderPass != nullptr)
             {
-                auto* renderPassVK = LLGL_CAST(const VKRenderPass*, desc.renderPass);
-                renderPass_ = renderPassVK->GetVkRenderPass();
+                /*
+                Create own render pass that only shares the attachment formats and sample count with the specified one,
+                so this command buffer can be executed inside any compatible render pass, even after the original render pass object has been released
+                */
+                auto* renderPassVK = LLGL_HOT_CAST(const VKRenderPass*, desc.renderPass);
+                inheritanceRenderPass_ = MakeUnique<VKRenderPass>(device);
+                inheritanceRenderPass_->CreateCompatibleVkRenderPass(device, *renderPassVK);
+                renderPass_ = inheritanceRenderPass_->GetVkRenderPass();
                 usageFlags_ |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
             }
         }
@@ -92,14 +113,15 @@ VKCommandBuffer::VKCommandBuffer(
     }
 
     /* Create native command buffer objects */
-    CreateVkCommandPool(queueFamilyIndices.graphicsFamily);
+    CreateVkCommandPools(queueFamilyIndex);
     CreateVkCommandBuffers();
     CreateVkRecordingFences();
 }
 
 VKCommandBuffer::~VKCommandBuffer()
 {
-    vkFreeCommandBuffers(device_, commandPool_, numCommandBuffers_, commandBufferArray_);
+    for_range(i, numCommandBuffers_)
+        vkFreeCommandBuffers(device_, commandPoolArray_[i], 1, &commandBufferArray_[i]);
 }
 
 VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
@@ -114,6 +136,21 @@ VkFence VKCommandBuffer::GetQueueSubmitFenceAndFlush()
     return fence;
 }
 
+void VKCommandBuffer::FlushQueueSubmitFenceForBatch(std::uint64_t batchID)
+{
+    recordingFence_ = VK_NULL_HANDLE;
+    recordingFenceDirty_[commandBufferIndex_] = false;
+    submitBatchIDs_[commandBufferIndex_] = batchID;
+}
+
+void VKCommandBuffer::NotifySubmitted(VKCommandQueue& commandQueue, std::uint64_t submitID, bool signalsRecordingFence)
+{
+    for (VKResourceHeap* resourceHeapVK : boundResourceHeaps_)
+        resourceHeapVK->MarkSubmitted(commandQueue, submitID);
+    if (signalsRecordingFence)
+        submitIDs_[commandBufferIndex_] = submitID;
+}
+
 /* ----- Encoding ----- */
 
 void VKCommandBuffer::Begin()
@@ -121,6 +158,12 @@ void VKCommandBuffer::Begin()
     /* Use next internal VkCommandBuffer object to reduce latency */
     AcquireNextBuffer();
 
+    /* Recycle scratch memory of the previous recording on this thread */
+    FrameArena::Get().Reset();
+
+    /* Resource heaps of the previous recording are marked with the submissions they were part of already */
+    boundResourceHeaps_.clear();
+
     /* Initialize inheritance if this is a secondary command buffer */
     VkCommandBufferInheritanceInfo inheritanceInfo;
     if (IsSecondaryCmdBuffer())
@@ -135,6 +178,34 @@ void VKCommandBuffer::Begin()
         inheritanceInfo.pipelineStatistics      = 0;
     }
 
+    #if VK_KHR_dynamic_rendering
+
+    /* Inherit attachment formats instead of a render pass object with dynamic rendering */
+    VkFormat colorFormatsVK[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VkCommandBufferInheritanceRenderingInfoKHR inheritanceRenderingInfo;
+    if (IsSecondaryCmdBuffer() && inheritanceRenderPass_ && HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        const VKRenderPass& renderPass          = *inheritanceRenderPass_;
+        const VkFormat      depthStencilFormat  = renderPass.GetDepthStencilFormat();
+        for_range(i, renderPass.GetNumColorAttachments())
+            colorFormatsVK[i] = renderPass.GetColorFormat(i);
+
+        inheritanceRenderingInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO_KHR;
+        inheritanceRenderingInfo.pNext                      = nullptr;
+        inheritanceRenderingInfo.flags                      = 0;
+        inheritanceRenderingInfo.viewMask                   = renderPass.GetViewMask();
+        inheritanceRenderingInfo.colorAttachmentCount       = renderPass.GetNumColorAttachments();
+        inheritanceRenderingInfo.pColorAttachmentFormats    = colorFormatsVK;
+        inheritanceRenderingInfo.depthAttachmentFormat      = (depthStencilFormat != VK_FORMAT_S8_UINT ? depthStencilFormat : VK_FORMAT_UNDEFINED);
+        inheritanceRenderingInfo.stencilAttachmentFormat    = (VKTypes::IsVkFormatStencil(depthStencilFormat) ? depthStencilFormat : VK_FORMAT_UNDEFINED);
+        inheritanceRenderingInfo.rasterizationSamples       = renderPass.GetSampleCountBits();
+
+        inheritanceInfo.pNext       = &inheritanceRenderingInfo;
+        inheritanceInfo.renderPass  = VK_NULL_HANDLE;
+    }
+
+    #endif // /VK_KHR_dynamic_rendering
+
     /* Begin recording of current command buffer */
     VkCommandBufferBeginInfo beginInfo;
     {
@@ -158,10 +229,18 @@ void VKCommandBuffer::Begin()
     framebufferRenderArea_.extent.width     = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     framebufferRenderArea_.extent.height    = static_cast<std::uint32_t>(INT32_MAX); // Must avoid int32 overflow
     hasDynamicScissorRect_                  = false;
+    shadingRateExtent_.width                = 1;
+    shadingRateExtent_.height               = 1;
+    pendingRenderPass_.active               = false;
+    isRenderConditionActive_                = false;
 }
 
 void VKCommandBuffer::End()
 {
+    /* Submit all remaining barriers and reset events of split barriers that have not been ended */
+    context_.FlushBarriers();
+    ResetPendingSplitBarriers();
+
     /* End encoding of current command buffer */
     VkResult result = vkEndCommandBuffer(commandBuffer_);
     VKThrowIfFailed(result, "failed to end Vulkan command buffer");
@@ -171,19 +250,21 @@ void VKCommandBuffer::End()
 
     /* Execute command buffer right after encoding for immediate command buffers */
     if (IsImmediateCmdBuffer())
-    {
-        VkResult result = VKSubmitCommandBuffer(commandQueue_, commandBuffer_, GetQueueSubmitFenceAndFlush());
-        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
-    }
+        commandQueue_.SubmitCommandBuffer(*this);
 
     ResetBindingStates();
 }
 
 void VKCommandBuffer::Execute(CommandBuffer& secondaryCommandBuffer)
 {
-    auto& cmdBufferVK = LLGL_CAST(VKCommandBuffer&, secondaryCommandBuffer);
+    auto& cmdBufferVK = LLGL_HOT_CAST(VKCommandBuffer&, secondaryCommandBuffer);
     VkCommandBuffer cmdBuffers[] = { cmdBufferVK.GetVkCommandBuffer() };
+    BeginPendingRenderPass();
+    context_.FlushBarriers();
     vkCmdExecuteCommands(commandBuffer_, 1, cmdBuffers);
+
+    /* Resource heaps bound by the secondary command buffer are in use by this submission too */
+    boundResourceHeaps_.insert(boundResourceHeaps_.end(), cmdBufferVK.boundResourceHeaps_.begin(), cmdBufferVK.boundResourceHeaps_.end());
 }
 
 /* ----- Blitting ----- */
@@ -194,7 +275,7 @@ void VKCommandBuffer::UpdateBuffer(
     const void*     data,
     std::uint16_t   dataSize)
 {
-    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+    auto& dstBufferVK = LLGL_HOT_CAST(VKBuffer&, dstBuffer);
 
     const VkDeviceSize size     = static_cast<VkDeviceSize>(dataSize);
     const VkDeviceSize offset   = static_cast<VkDeviceSize>(dstOffset);
@@ -208,11 +289,20 @@ void VKCommandBuffer::UpdateBuffer(
     }
     else
     {
+        context_.FlushBarriers();
         vkCmdUpdateBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, data);
         BufferPipelineBarrier(dstBufferVK.GetVkBuffer(), offset, size, VK_ACCESS_TRANSFER_WRITE_BIT, dstBufferVK.GetAccessFlags());
     }
 }
 
+TransientBufferAllocation VKCommandBuffer::AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment)
+{
+    /* Host-coherent writes are made visible to the device when the command buffer is submitted, so no barrier is required */
+    if (transientBufferPool_ == nullptr)
+        return {};
+    return transientBufferPool_->Alloc(size, bindFlags, alignment);
+}
+
 void VKCommandBuffer::CopyBuffer(
     Buffer&         dstBuffer,
     std::uint64_t   dstOffset,
@@ -220,24 +310,43 @@ void VKCommandBuffer::CopyBuffer(
     std::uint64_t   srcOffset,
     std::uint64_t   size)
 {
-    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
-    auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+    const BufferCopyRegion region{ dstOffset, srcOffset, size };
+    CopyBufferRegions(dstBuffer, srcBuffer, 1, &region);
+}
+
+void VKCommandBuffer::CopyBufferRegions(
+    Buffer&                 dstBuffer,
+    Buffer&                 srcBuffer,
+    std::uint32_t           numRegions,
+    const BufferCopyRegion* regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstBufferVK = LLGL_HOT_CAST(VKBuffer&, dstBuffer);
+    auto& srcBufferVK = LLGL_HOT_CAST(VKBuffer&, srcBuffer);
 
-    VkBufferCopy region;
+    /* Convert all regions to let Vulkan copy them with a single command */
+    FrameSmallVector<VkBufferCopy, 4> regionsVK;
+    regionsVK.resize(numRegions);
+    for_range(i, numRegions)
     {
-        region.srcOffset    = static_cast<VkDeviceSize>(srcOffset);
-        region.dstOffset    = static_cast<VkDeviceSize>(dstOffset);
-        region.size         = static_cast<VkDeviceSize>(size);
+        regionsVK[i].srcOffset  = static_cast<VkDeviceSize>(regions[i].srcOffset);
+        regionsVK[i].dstOffset  = static_cast<VkDeviceSize>(regions[i].dstOffset);
+        regionsVK[i].size       = static_cast<VkDeviceSize>(regions[i].size);
     }
 
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
-        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
+        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), numRegions, regionsVK.data());
         ResumeRenderPass();
     }
     else
-        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), 1, &region);
+    {
+        context_.FlushBarriers();
+        vkCmdCopyBuffer(commandBuffer_, srcBufferVK.GetVkBuffer(), dstBufferVK.GetVkBuffer(), numRegions, regionsVK.data());
+    }
 }
 
 void VKCommandBuffer::CopyBufferFromTexture(
@@ -248,8 +357,8 @@ void VKCommandBuffer::CopyBufferFromTexture(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
-    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+    auto& dstBufferVK = LLGL_HOT_CAST(VKBuffer&, dstBuffer);
+    auto& srcTextureVK = LLGL_HOT_CAST(VKTexture&, srcTexture);
 
     VkBufferImageCopy region;
     {
@@ -286,7 +395,7 @@ void VKCommandBuffer::FillBuffer(
     std::uint32_t   value,
     std::uint64_t   fillSize)
 {
-    auto& dstBufferVK = LLGL_CAST(VKBuffer&, dstBuffer);
+    auto& dstBufferVK = LLGL_HOT_CAST(VKBuffer&, dstBuffer);
 
     /* Determine destination buffer range and ignore <dstOffset> if the whole buffer is meant to be filled */
     VkDeviceSize offset, size;
@@ -309,7 +418,10 @@ void VKCommandBuffer::FillBuffer(
         ResumeRenderPass();
     }
     else
+    {
+        context_.FlushBarriers();
         vkCmdFillBuffer(commandBuffer_, dstBufferVK.GetVkBuffer(), offset, size, value);
+    }
 }
 
 void VKCommandBuffer::CopyTexture(
@@ -319,32 +431,52 @@ void VKCommandBuffer::CopyTexture(
     const TextureLocation&  srcLocation,
     const Extent3D&         extent)
 {
-    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
-    auto& srcTextureVK = LLGL_CAST(VKTexture&, srcTexture);
+    const TextureCopyRegion region{ dstLocation, srcLocation, extent };
+    CopyTextureRegions(dstTexture, srcTexture, 1, &region);
+}
 
-    VkImageCopy region;
+void VKCommandBuffer::CopyTextureRegions(
+    Texture&                    dstTexture,
+    Texture&                    srcTexture,
+    std::uint32_t               numRegions,
+    const TextureCopyRegion*    regions)
+{
+    if (numRegions == 0)
+        return;
+
+    auto& dstTextureVK = LLGL_HOT_CAST(VKTexture&, dstTexture);
+    auto& srcTextureVK = LLGL_HOT_CAST(VKTexture&, srcTexture);
+
+    const VkImageAspectFlags srcAspectMask = VKImageUtils::GetInclusiveVkImageAspect(srcTextureVK.GetVkFormat());
+    const VkImageAspectFlags dstAspectMask = VKImageUtils::GetInclusiveVkImageAspect(dstTextureVK.GetVkFormat());
+
+    /* Convert all regions to let Vulkan copy them with a single command */
+    FrameSmallVector<VkImageCopy, 4> regionsVK;
+    regionsVK.resize(numRegions);
+    for_range(i, numRegions)
     {
-        region.srcSubresource.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(srcTextureVK.GetVkFormat());
-        region.srcSubresource.mipLevel          = srcLocation.mipLevel;
-        region.srcSubresource.baseArrayLayer    = srcLocation.arrayLayer;
-        region.srcSubresource.layerCount        = 1;
-        region.srcOffset                        = VKTypes::ToVkOffset(srcLocation.offset);
-        region.dstSubresource.aspectMask        = VKImageUtils::GetInclusiveVkImageAspect(dstTextureVK.GetVkFormat());
-        region.dstSubresource.mipLevel          = dstLocation.mipLevel;
-        region.dstSubresource.baseArrayLayer    = dstLocation.arrayLayer;
-        region.dstSubresource.layerCount        = 1;
-        region.dstOffset                        = VKTypes::ToVkOffset(dstLocation.offset);
-        region.extent                           = VKTypes::ToVkExtent(extent);
+        VkImageCopy& regionVK = regionsVK[i];
+        regionVK.srcSubresource.aspectMask      = srcAspectMask;
+        regionVK.srcSubresource.mipLevel        = regions[i].srcLocation.mipLevel;
+        regionVK.srcSubresource.baseArrayLayer  = regions[i].srcLocation.arrayLayer;
+        regionVK.srcSubresource.layerCount      = 1;
+        regionVK.srcOffset                      = VKTypes::ToVkOffset(regions[i].srcLocation.offset);
+        regionVK.dstSubresource.aspectMask      = dstAspectMask;
+        regionVK.dstSubresource.mipLevel        = regions[i].dstLocation.mipLevel;
+        regionVK.dstSubresource.baseArrayLayer  = regions[i].dstLocation.arrayLayer;
+        regionVK.dstSubresource.layerCount      = 1;
+        regionVK.dstOffset                      = VKTypes::ToVkOffset(regions[i].dstLocation.offset);
+        regionVK.extent                         = VKTypes::ToVkExtent(regions[i].extent);
     }
 
     if (IsInsideRenderPass())
     {
         PauseRenderPass();
-        context_.CopyTexture(srcTextureVK, dstTextureVK, region);
+        context_.CopyTexture(srcTextureVK, dstTextureVK, numRegions, regionsVK.data());
         ResumeRenderPass();
     }
     else
-        context_.CopyTexture(srcTextureVK, dstTextureVK, region);
+        context_.CopyTexture(srcTextureVK, dstTextureVK, numRegions, regionsVK.data());
 }
 
 void VKCommandBuffer::CopyTextureFromBuffer(
@@ -355,8 +487,8 @@ void VKCommandBuffer::CopyTextureFromBuffer(
     std::uint32_t           rowStride,
     std::uint32_t           layerStride)
 {
-    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
-    auto& srcBufferVK = LLGL_CAST(VKBuffer&, srcBuffer);
+    auto& dstTextureVK = LLGL_HOT_CAST(VKTexture&, dstTexture);
+    auto& srcBufferVK = LLGL_HOT_CAST(VKBuffer&, srcBuffer);
 
     VkBufferImageCopy region;
     {
@@ -403,7 +535,7 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
         return /*Out of bounds*/;
     }
 
-    auto& dstTextureVK = LLGL_CAST(VKTexture&, dstTexture);
+    auto& dstTextureVK = LLGL_HOT_CAST(VKTexture&, dstTexture);
 
     if (IsInsideRenderPass())
     {
@@ -435,7 +567,7 @@ void VKCommandBuffer::CopyTextureFromFramebuffer(
 
 void VKCommandBuffer::GenerateMips(Texture& texture)
 {
-    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    auto& textureVK = LLGL_HOT_CAST(VKTexture&, texture);
     context_.GenerateMips(
         textureVK.GetVkImage(),
         textureVK.GetVkFormat(),
@@ -446,7 +578,7 @@ void VKCommandBuffer::GenerateMips(Texture& texture)
 
 void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& subresource)
 {
-    auto& textureVK = LLGL_CAST(VKTexture&, texture);
+    auto& textureVK = LLGL_HOT_CAST(VKTexture&, texture);
 
     const std::uint32_t maxNumMipLevels     = textureVK.GetNumMipLevels();
     const std::uint32_t maxNumArrayLayers   = textureVK.GetNumArrayLayers();
@@ -463,6 +595,43 @@ void VKCommandBuffer::GenerateMips(Texture& texture, const TextureSubresource& s
     }
 }
 
+void VKCommandBuffer::GenerateMips(std::uint32_t numTextures, Texture* const * textures)
+{
+    /* Gather MIP chains of all textures to blit the same MIP-map level of all textures between shared barriers */
+    FrameSmallVector<VKMipChainImage> images;
+    images.reserve(numTextures);
+
+    for_range(i, numTextures)
+    {
+        if (textures[i] == nullptr)
+            continue;
+
+        auto* textureVK = LLGL_HOT_CAST(VKTexture*, textures[i]);
+        if (textureVK->GetNumMipLevels() < 2)
+            continue;
+
+        /* Generate MIP-maps only once per texture, since its layout transitions must not be duplicated within the same barrier */
+        VkImage image = textureVK->GetVkImage();
+        auto IsSameImage = [image](const VKMipChainImage& entry) -> bool { return (entry.image == image); };
+        if (std::find_if(images.begin(), images.end(), IsSameImage) != images.end())
+            continue;
+
+        images.push_back(
+            VKMipChainImage
+            {
+                image,
+                textureVK->GetVkFormat(),
+                textureVK->GetVkExtent(),
+                textureVK->GetNumMipLevels(),
+                textureVK->GetNumArrayLayers()
+            }
+        );
+    }
+
+    if (!images.empty())
+        context_.GenerateMips(static_cast<std::uint32_t>(images.size()), images.data());
+}
+
 /* ----- Viewport and Scissor ----- */
 
 void VKCommandBuffer::SetViewport(const Viewport& viewport)
@@ -515,7 +684,7 @@ void VKCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scis
 
 void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
 {
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
 
     VkBuffer buffers[] = { bufferVK.GetVkBuffer() };
     VkDeviceSize offsets[] = { 0 };
@@ -529,11 +698,20 @@ void VKCommandBuffer::SetVertexBuffer(Buffer& buffer)
         iaState_.ia0XfbCounterBuffer        = bufferVK.GetVkBuffer();
         iaState_.ia0XfbCounterBufferOffset  = bufferVK.GetXfbCounterOffset();
     }
+
+    /* Store draw arguments for slot 0 in case it's used for compute stream-output */
+    if ((bufferVK.GetBindFlags() & BindFlags::ComputeStreamOutput) != 0)
+    {
+        iaState_.ia0ComputeSOBuffer     = bufferVK.GetVkBuffer();
+        iaState_.ia0ComputeSOArgsOffset = GetComputeStreamOutputArgsOffset(bufferVK.GetSize());
+    }
+    else
+        iaState_.ia0ComputeSOBuffer     = VK_NULL_HANDLE;
 }
 
 void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
 {
-    auto& bufferArrayVK = LLGL_CAST(VKBufferArray&, bufferArray);
+    auto& bufferArrayVK = LLGL_HOT_CAST(VKBufferArray&, bufferArray);
     vkCmdBindVertexBuffers(
         commandBuffer_,
         0,
@@ -541,17 +719,18 @@ void VKCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
         bufferArrayVK.GetBuffers().data(),
         bufferArrayVK.GetOffsets().data()
     );
+    iaState_.ia0ComputeSOBuffer = VK_NULL_HANDLE;
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer)
 {
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), 0, bufferVK.GetIndexType());
 }
 
 void VKCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
 {
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
     vkCmdBindIndexBuffer(commandBuffer_, bufferVK.GetVkBuffer(), offset, VKTypes::ToVkIndexType(format));
 }
 
@@ -563,34 +742,299 @@ void VKCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t
         return /*No PSO bound*/;
 
     /* Bind resource heap to pipeline bind point and insert resource barrier into command buffer */
-    auto& resourceHeapVK = LLGL_CAST(VKResourceHeap&, resourceHeap);
+    auto& resourceHeapVK = LLGL_HOT_CAST(VKResourceHeap&, resourceHeap);
     if (!(descriptorSet < resourceHeapVK.GetVkDescriptorSets().size()))
         return /*Descriptor set out of bounds*/;
 
     boundPipelineState_->BindHeapDescriptorSet(commandBuffer_, resourceHeapVK.GetVkDescriptorSets()[descriptorSet]);
-    resourceHeapVK.SubmitPipelineBarrier(commandBuffer_, descriptorSet);
+    resourceHeapVK.SubmitPipelineBarrier(context_, descriptorSet);
+
+    /* Track heaps that must not be updated while this command buffer is pending; consecutive bindings of the same heap are tracked once */
+    if (!resourceHeapVK.CanUpdateWhilePending() && (boundResourceHeaps_.empty() || boundResourceHeaps_.back() != &resourceHeapVK))
+        boundResourceHeaps_.push_back(&resourceHeapVK);
 }
 
 void VKCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
 {
     if (boundPipelineLayout_ != nullptr && descriptor < boundPipelineLayout_->GetLayoutDynamicBindings().size())
     {
-        const VKLayoutBinding& binding = boundPipelineLayout_->GetLayoutDynamicBindings()[descriptor];
-        descriptorCache_->EmplaceDescriptor(resource, binding, descriptorSetWriter_);
+        if (descriptorCache_ != nullptr)
+        {
+            const VKLayoutBinding& binding = boundPipelineLayout_->GetLayoutDynamicBindings()[descriptor];
+            descriptorCache_->EmplaceDescriptor(resource, binding, descriptorSetWriter_);
+        }
+        else if (boundPipelineLayout_->HasPushDescriptorSet())
+            pushDescriptorCache_.EmplaceDescriptor(resource, descriptor);
     }
 }
 
+void VKCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    if (boundPipelineLayout_ != nullptr && descriptor < boundPipelineLayout_->GetLayoutDynamicBindings().size())
+    {
+        auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
+        if (descriptorCache_ != nullptr)
+        {
+            const VKLayoutBinding& binding = boundPipelineLayout_->GetLayoutDynamicBindings()[descriptor];
+            descriptorCache_->EmplaceBufferRange(bufferVK, binding, offset, size, descriptorSetWriter_);
+        }
+        else if (boundPipelineLayout_->HasPushDescriptorSet())
+            pushDescriptorCache_.EmplaceBufferRange(bufferVK, descriptor, offset, size);
+    }
+}
+
+// Pipeline stages that can write to storage resources (geometry and tessellation stages are omitted since they depend on optional device features)
+static constexpr VkPipelineStageFlags g_storageWriteStageMask =
+(
+    VK_PIPELINE_STAGE_VERTEX_SHADER_BIT     |
+    VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT   |
+    VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+);
+
+// Pipeline stages that can access storage resources after a resource barrier
+static constexpr VkPipelineStageFlags g_storageAccessStageMask =
+(
+    VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT     |
+    VK_PIPELINE_STAGE_VERTEX_INPUT_BIT      |
+    g_storageWriteStageMask                 |
+    VK_PIPELINE_STAGE_TRANSFER_BIT
+);
+
+static constexpr VkAccessFlags g_storageAccessMask =
+(
+    VK_ACCESS_INDIRECT_COMMAND_READ_BIT     |
+    VK_ACCESS_INDEX_READ_BIT                |
+    VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT     |
+    VK_ACCESS_SHADER_READ_BIT               |
+    VK_ACCESS_SHADER_WRITE_BIT              |
+    VK_ACCESS_TRANSFER_READ_BIT             |
+    VK_ACCESS_TRANSFER_WRITE_BIT
+);
+
+static bool HasAnyTextures(std::uint32_t numTextures, Texture* const * textures)
+{
+    for_range(i, numTextures)
+    {
+        if (textures[i] != nullptr)
+            return true;
+    }
+    return false;
+}
+
 void VKCommandBuffer::ResourceBarrier(
     std::uint32_t       numBuffers,
     Buffer* const *     buffers,
     std::uint32_t       numTextures,
     Texture* const *    textures)
 {
-    //TODO
+    /* Defer barriers until the next draw, compute, or blit command, so consecutive barriers are batched into a single pipeline barrier */
+    for_range(i, numBuffers)
+    {
+        if (Buffer* buffer = buffers[i])
+        {
+            auto* bufferVK = LLGL_HOT_CAST(VKBuffer*, buffer);
+            context_.BufferMemoryBarrier(
+                bufferVK->GetVkBuffer(),
+                0,
+                VK_WHOLE_SIZE,
+                g_storageWriteStageMask,
+                VK_ACCESS_SHADER_WRITE_BIT,
+                g_storageAccessStageMask,
+                g_storageAccessMask
+            );
+        }
+    }
+
+    /* Storage textures remain in their current image layout, so a global memory barrier is sufficient */
+    if (HasAnyTextures(numTextures, textures))
+    {
+        context_.GlobalMemoryBarrier(
+            g_storageWriteStageMask,
+            VK_ACCESS_SHADER_WRITE_BIT,
+            g_storageAccessStageMask,
+            g_storageAccessMask
+        );
+    }
+}
+
+template <typename TResourceContainer>
+static void InitSplitBarrierResources(
+    TResourceContainer& resources,
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
+{
+    resources.clear();
+    resources.reserve(numBuffers + numTextures);
+    for_range(i, numBuffers)
+        resources.push_back(buffers[i]);
+    for_range(i, numTextures)
+        resources.push_back(textures[i]);
+}
+
+void VKCommandBuffer::BeginResourceBarrier(
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
+{
+    /* Events cannot be signaled inside a render pass; EndResourceBarrier() falls back to a regular barrier in that case */
+    if (IsInsideRenderPass())
+        return;
+
+    /* Signal event once all previous storage writes have completed */
+    SplitBarrier splitBarrier;
+    {
+        splitBarrier.event      = AllocSplitBarrierEvent();
+        splitBarrier.numBuffers = numBuffers;
+        InitSplitBarrierResources(splitBarrier.resources, numBuffers, buffers, numTextures, textures);
+    }
+    vkCmdSetEvent(commandBuffer_, splitBarrier.event, g_storageWriteStageMask);
+    pendingSplitBarriers_.push_back(std::move(splitBarrier));
+}
+
+void VKCommandBuffer::EndResourceBarrier(
+    std::uint32_t       numBuffers,
+    Buffer* const *     buffers,
+    std::uint32_t       numTextures,
+    Texture* const *    textures)
+{
+    /* Find split barrier that was started with the same resources */
+    FrameSmallVector<Resource*, 4> resources;
+    InitSplitBarrierResources(resources, numBuffers, buffers, numTextures, textures);
+
+    auto it = std::find_if(
+        pendingSplitBarriers_.begin(),
+        pendingSplitBarriers_.end(),
+        [numBuffers, &resources](const SplitBarrier& splitBarrier) -> bool
+        {
+            return
+            (
+                splitBarrier.numBuffers == numBuffers                   &&
+                splitBarrier.resources.size() == resources.size()       &&
+                std::equal(resources.begin(), resources.end(), splitBarrier.resources.begin())
+            );
+        }
+    );
+
+    if (it == pendingSplitBarriers_.end() || IsInsideRenderPass())
+    {
+        /* Fall back to regular resource barrier if there is no matching split barrier or we can't wait for events here */
+        ResourceBarrier(numBuffers, buffers, numTextures, textures);
+        return;
+    }
+
+    /* Build memory barriers for all resources */
+    FrameSmallVector<VkBufferMemoryBarrier, 4> bufferBarriers;
+    for_range(i, numBuffers)
+    {
+        if (Buffer* buffer = buffers[i])
+        {
+            auto* bufferVK = LLGL_HOT_CAST(VKBuffer*, buffer);
+            VkBufferMemoryBarrier barrier;
+            {
+                barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+                barrier.pNext               = nullptr;
+                barrier.srcAccessMask       = VK_ACCESS_SHADER_WRITE_BIT;
+                barrier.dstAccessMask       = g_storageAccessMask;
+                barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+                barrier.buffer              = bufferVK->GetVkBuffer();
+                barrier.offset              = 0;
+                barrier.size                = VK_WHOLE_SIZE;
+            }
+            bufferBarriers.push_back(barrier);
+        }
+    }
+
+    const bool hasTextures = HasAnyTextures(numTextures, textures);
+
+    VkMemoryBarrier memoryBarrier;
+    {
+        memoryBarrier.sType         = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+        memoryBarrier.pNext         = nullptr;
+        memoryBarrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+        memoryBarrier.dstAccessMask = g_storageAccessMask;
+    }
+
+    /* Keep order with other deferred barriers, then wait for the event and reset it for the next submission */
+    VkEvent event = it->event;
+    pendingSplitBarriers_.erase(it);
+
+    context_.FlushBarriers();
+    vkCmdWaitEvents(
+        commandBuffer_,
+        1,
+        &event,
+        g_storageWriteStageMask,
+        g_storageAccessStageMask,
+        (hasTextures ? 1u : 0u),
+        (hasTextures ? &memoryBarrier : nullptr),
+        static_cast<std::uint32_t>(bufferBarriers.size()),
+        bufferBarriers.data(),
+        0,
+        nullptr
+    );
+    vkCmdResetEvent(commandBuffer_, event, g_storageAccessStageMask);
+}
+
+// Access flags of all writes a texture may have received before its memory is aliased by another texture
+static constexpr VkAccessFlags g_aliasingSrcAccessMask =
+(
+    VK_ACCESS_SHADER_WRITE_BIT                      |
+    VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT            |
+    VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT    |
+    VK_ACCESS_TRANSFER_WRITE_BIT
+);
+
+// Access flags of all reads and writes a texture may receive after its memory has been aliased
+static constexpr VkAccessFlags g_aliasingDstAccessMask =
+(
+    g_aliasingSrcAccessMask                         |
+    VK_ACCESS_SHADER_READ_BIT                       |
+    VK_ACCESS_COLOR_ATTACHMENT_READ_BIT             |
+    VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT     |
+    VK_ACCESS_TRANSFER_READ_BIT
+);
+
+void VKCommandBuffer::AliasingBarrier(Texture* /*textureBefore*/, Texture* textureAfter)
+{
+    /*
+    Vulkan has no dedicated aliasing barrier: A global memory barrier waits for all writes to the previous texture,
+    so the previous texture is not needed here. The next texture is then transitioned from undefined into its current layout,
+    which discards its content and makes it safe to be used in the aliased memory.
+    */
+    context_.GlobalMemoryBarrier(
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        g_aliasingSrcAccessMask,
+        VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+        g_aliasingDstAccessMask
+    );
+
+    if (textureAfter != nullptr)
+    {
+        auto* textureVK = LLGL_HOT_CAST(VKTexture*, textureAfter);
+        textureVK->DiscardImageContent(context_);
+    }
+
+    context_.FlushBarriers();
 }
 
 /* ----- Render Passes ----- */
 
+static VkImageAspectFlags GetDepthStencilAspectMask(bool hasDepth, bool hasStencil)
+{
+    VkImageAspectFlags aspectMask = 0;
+
+    if (hasDepth)
+        aspectMask |= VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (hasStencil)
+        aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+
+    return aspectMask;
+}
+
 void VKCommandBuffer::BeginRenderPass(
     RenderTarget&       renderTarget,
     const RenderPass*   renderPass,
@@ -603,7 +1047,7 @@ void VKCommandBuffer::BeginRenderPass(
     if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
     {
         /* Get Vulkan swap-chain object */
-        auto& swapChainVK = LLGL_CAST(VKSwapChain&, renderTarget);
+        auto& swapChainVK = LLGL_HOT_CAST(VKSwapChain&, renderTarget);
 
         /* Store information about framebuffer attachments */
         boundSwapChain_                 = &swapChainVK;
@@ -614,11 +1058,18 @@ void VKCommandBuffer::BeginRenderPass(
         framebufferRenderArea_.extent   = swapChainVK.GetVkExtent();
         numColorAttachments_            = swapChainVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (swapChainVK.HasDepthAttachment() || swapChainVK.HasStencilAttachment());
+        depthStencilAspects_            = GetDepthStencilAspectMask(swapChainVK.HasDepthAttachment(), swapChainVK.HasStencilAttachment());
+        pendingRenderPass_.clearRenderPass = swapChainVK.GetClearVkRenderPass();
+
+        #if VK_KHR_dynamic_rendering
+        if (HasExtension(VKExt::KHR_dynamic_rendering))
+            renderingAttachments_ = swapChainVK.GetRenderingAttachments(currentColorBuffer_);
+        #endif
     }
     else
     {
         /* Get Vulkan render target object and store its extent for subsequent commands */
-        auto& renderTargetVK = LLGL_CAST(VKRenderTarget&, renderTarget);
+        auto& renderTargetVK = LLGL_HOT_CAST(VKRenderTarget&, renderTarget);
 
         /* Store information about framebuffer attachments */
         renderPass_                     = renderTargetVK.GetVkRenderPass();
@@ -627,21 +1078,28 @@ void VKCommandBuffer::BeginRenderPass(
         framebufferRenderArea_.extent   = renderTargetVK.GetVkExtent();
         numColorAttachments_            = renderTargetVK.GetNumColorAttachments();
         hasDepthStencilAttachment_      = (renderTargetVK.HasDepthAttachment() || renderTargetVK.HasStencilAttachment());
+        depthStencilAspects_            = GetDepthStencilAspectMask(renderTargetVK.HasDepthAttachment(), renderTargetVK.HasStencilAttachment());
+        pendingRenderPass_.clearRenderPass = renderTargetVK.GetClearVkRenderPass();
+
+        #if VK_KHR_dynamic_rendering
+        if (HasExtension(VKExt::KHR_dynamic_rendering))
+            renderingAttachments_ = renderTargetVK.GetRenderingAttachments();
+        #endif
     }
 
     hasDynamicScissorRect_ = false;
 
-    /* Uninitialized stack memory for clear values */
-    VkClearValue clearValuesVK[LLGL_MAX_NUM_COLOR_ATTACHMENTS * 2 + 1];
-    std::uint32_t numClearValuesVK = 0;
-
     /* Get native render pass object either from RenderTarget or RenderPass interface */
+    pendingRenderPass_.renderPass       = nullptr;
+    pendingRenderPass_.numClearValues   = 0;
+
     if (renderPass != nullptr)
     {
         /* Get native VkRenderPass object */
-        auto* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
+        const VKRenderPass* renderPassVK = LLGL_HOT_CAST(const VKRenderPass*, renderPass);
         renderPass_ = renderPassVK->GetVkRenderPass();
-        ConvertRenderPassClearValues(*renderPassVK, numClearValuesVK, clearValuesVK, numClearValues, clearValues);
+        pendingRenderPass_.renderPass = renderPassVK;
+        ConvertRenderPassClearValues(*renderPassVK, pendingRenderPass_.numClearValues, pendingRenderPass_.clearValues, numClearValues, clearValues);
     }
 
     /* Determine subpass contents */
@@ -656,18 +1114,14 @@ void VKCommandBuffer::BeginRenderPass(
         #endif
     );
 
-    /* Record begin of render pass */
-    VkRenderPassBeginInfo beginInfo;
-    {
-        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-        beginInfo.pNext             = nullptr;
-        beginInfo.renderPass        = renderPass_;
-        beginInfo.framebuffer       = framebuffer_;
-        beginInfo.renderArea        = framebufferRenderArea_;
-        beginInfo.clearValueCount   = numClearValuesVK;
-        beginInfo.pClearValues      = clearValuesVK;
-    }
-    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
+    /*
+    Defer the begin of the render pass until the first command that must be recorded inside of it,
+    so that Clear() and ClearAttachments() commands in between are folded into the attachment load operations
+    instead of being recorded as vkCmdClearAttachments after the attachments have been loaded.
+    */
+    pendingRenderPass_.active                    = true;
+    pendingRenderPass_.foldedColorMask           = 0;
+    pendingRenderPass_.foldedDepthStencilAspects = 0;
 
     /* Store new record state */
     recordState_ = RecordState::InsideRenderPass;
@@ -677,7 +1131,15 @@ void VKCommandBuffer::EndRenderPass()
 {
     LLGL_ASSERT(renderPass_ != VK_NULL_HANDLE);
 
+    /* Record begin of render pass if nothing but clear commands have been recorded inside of it */
+    BeginPendingRenderPass();
+
     /* Record and of render pass */
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        EndRendering();
+    else
+    #endif // /VK_KHR_dynamic_rendering
     vkCmdEndRenderPass(commandBuffer_);
 
     /* Reset render pass and framebuffer attributes */
@@ -698,14 +1160,7 @@ static void ToVkClearColor(VkClearColorValue& dst, const float (&src)[4])
 
 static VkImageAspectFlags GetDepthStencilAspectMask(long flags)
 {
-    VkImageAspectFlags aspectMask = 0;
-
-    if ((flags & ClearFlags::Depth) != 0)
-        aspectMask |= VK_IMAGE_ASPECT_DEPTH_BIT;
-    if ((flags & ClearFlags::Stencil) != 0)
-        aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
-
-    return aspectMask;
+    return GetDepthStencilAspectMask(((flags & ClearFlags::Depth) != 0), ((flags & ClearFlags::Stencil) != 0));
 }
 
 void VKCommandBuffer::Clear(long flags, const ClearValue& clearValue)
@@ -745,7 +1200,8 @@ void VKCommandBuffer::Clear(long flags, const ClearValue& clearValue)
     }
 
     /* Clear all framebuffer attachments */
-    ClearFramebufferAttachments(numAttachments, attachments);
+    if (!FoldClearsIntoPendingRenderPass(numAttachments, attachments))
+        ClearFramebufferAttachments(numAttachments, attachments);
 }
 
 void VKCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
@@ -789,22 +1245,31 @@ void VKCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const Attac
         }
     }
 
-    ClearFramebufferAttachments(numAttachmentsVK, attachmentsVK);
+    if (!FoldClearsIntoPendingRenderPass(numAttachmentsVK, attachmentsVK))
+        ClearFramebufferAttachments(numAttachmentsVK, attachmentsVK);
 }
 
 /* ----- Pipeline States ----- */
 
 void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
 {
+    /* Push pending uniforms with the layout of the previous PSO */
+    FlushPushConstants();
+
     /* Bind native PSO */
-    auto& pipelineStateVK = LLGL_CAST(VKPipelineState&, pipelineState);
+    auto& pipelineStateVK = LLGL_HOT_CAST(VKPipelineState&, pipelineState);
     pipelineStateVK.BindPipelineAndStaticDescriptorSet(commandBuffer_);
 
     /* Handle special case for graphics PSOs */
     pipelineBindPoint_ = pipelineStateVK.GetBindPoint();
     if (pipelineBindPoint_ == VK_PIPELINE_BIND_POINT_GRAPHICS)
     {
-        auto& graphicsPSO = LLGL_CAST(VKGraphicsPSO&, pipelineStateVK);
+        auto& graphicsPSO = LLGL_HOT_CAST(VKGraphicsPSO&, pipelineStateVK);
+
+        /* Set pipeline states that are not baked into the native PSO */
+        graphicsPSO.SetFoldedStates(commandBuffer_);
+        if (graphicsPSO.HasDynamicShadingRate())
+            FlushShadingRate();
 
         /* Scissor rectangle must be updated (if scissor test is disabled) */
         scissorEnabled_ = graphicsPSO.IsScissorEnabled();
@@ -819,9 +1284,14 @@ void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
     }
 
     /* Keep reference to bound piepline layout (can be null) */
+    const VKPipelineLayout* prevPipelineLayout = boundPipelineLayout_;
     boundPipelineState_     = &pipelineStateVK;
     boundPipelineLayout_    = pipelineStateVK.GetPipelineLayout();
 
+    /* Grow shadow data for push constants if necessary */
+    if (pushConstantsData_.size() < pipelineStateVK.GetPushConstantsSize())
+        pushConstantsData_.resize(pipelineStateVK.GetPushConstantsSize());
+
     /* Reset descriptor cache for dynamic resources */
     if (boundPipelineLayout_ != nullptr)
     {
@@ -831,6 +1301,13 @@ void VKCommandBuffer::SetPipelineState(PipelineState& pipelineState)
             descriptorCache_->Reset();
             descriptorSetWriter_.Reset(descriptorCache_->GetNumDescriptors());
         }
+        else if (boundPipelineLayout_->HasPushDescriptorSet())
+        {
+            /* Keep pushed descriptors for the same pipeline layout, but push them again since the PSO may use a different permutation of the layout */
+            if (boundPipelineLayout_ != prevPipelineLayout)
+                pushDescriptorCache_.Reset(boundPipelineLayout_->GetLayoutDynamicBindings());
+            pushDescriptorCache_.Invalidate();
+        }
     }
     else
         descriptorCache_ = nullptr;
@@ -846,20 +1323,70 @@ void VKCommandBuffer::SetStencilReference(std::uint32_t reference, const Stencil
     vkCmdSetStencilReference(commandBuffer_, VKTypes::Map(stencilFace), reference);
 }
 
+static VkExtent2D GetShadingRateFragmentSize(const ShadingRate rate)
+{
+    switch (rate)
+    {
+        case ShadingRate::Rate1x1: return VkExtent2D{ 1, 1 };
+        case ShadingRate::Rate1x2: return VkExtent2D{ 1, 2 };
+        case ShadingRate::Rate2x1: return VkExtent2D{ 2, 1 };
+        case ShadingRate::Rate2x2: return VkExtent2D{ 2, 2 };
+        case ShadingRate::Rate2x4: return VkExtent2D{ 2, 4 };
+        case ShadingRate::Rate4x2: return VkExtent2D{ 4, 2 };
+        case ShadingRate::Rate4x4: return VkExtent2D{ 4, 4 };
+    }
+    return VkExtent2D{ 1, 1 };
+}
+
+void VKCommandBuffer::SetShadingRate(const ShadingRate rate)
+{
+    shadingRateExtent_ = GetShadingRateFragmentSize(rate);
+
+    /* Record shading rate right away if the bound PSO has it as dynamic state; otherwise it's recorded when the next PSO is bound */
+    if (pipelineBindPoint_ == VK_PIPELINE_BIND_POINT_GRAPHICS && boundPipelineState_ != nullptr)
+    {
+        auto* graphicsPSO = LLGL_HOT_CAST(VKGraphicsPSO*, boundPipelineState_);
+        if (graphicsPSO->HasDynamicShadingRate())
+            FlushShadingRate();
+    }
+}
+
 void VKCommandBuffer::SetUniforms(std::uint32_t first, const void* data, std::uint16_t dataSize)
 {
-    if (boundPipelineState_ != nullptr)
-        boundPipelineState_->PushConstants(commandBuffer_, first, static_cast<const char*>(data), dataSize);
+    if (boundPipelineState_ == nullptr)
+        return;
+
+    /* Copy uniforms into shadow data and defer vkCmdPushConstants until the next draw or dispatch command */
+    const std::uint32_t count = boundPipelineState_->StagePushConstants(first, static_cast<const char*>(data), dataSize, pushConstantsData_.data());
+    if (count == 0)
+        return;
+
+    /* Merge with pending uniforms if adjacent or overlapping; otherwise push the pending ones first, since only a single range is tracked */
+    if (numPendingUniforms_ > 0 && first <= firstPendingUniform_ + numPendingUniforms_ && first + count >= firstPendingUniform_)
+    {
+        const std::uint32_t pendingEnd = std::max(firstPendingUniform_ + numPendingUniforms_, first + count);
+        firstPendingUniform_    = std::min(firstPendingUniform_, first);
+        numPendingUniforms_     = pendingEnd - firstPendingUniform_;
+    }
+    else
+    {
+        FlushPushConstants();
+        firstPendingUniform_    = first;
+        numPendingUniforms_     = count;
+    }
 }
 
 /* ----- Queries ----- */
 
 void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+    auto& queryHeapVK = LLGL_HOT_CAST(VKQueryHeap&, queryHeap);
 
     query *= queryHeapVK.GetGroupSize();
 
+    /* Queries must begin and end in the same render pass instance */
+    BeginPendingRenderPass();
+
     if (queryHeapVK.GetType() == QueryType::TimeElapsed)
     {
         /* Record first timestamp */
@@ -874,22 +1401,30 @@ void VKCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
     if (queryHeapVK.HasPredicates())
     {
         /* Mark dirty range for predicates */
-        auto& predicateQueryHeapVK = LLGL_CAST(VKPredicateQueryHeap&, queryHeapVK);
+        auto& predicateQueryHeapVK = LLGL_HOT_CAST(VKPredicateQueryHeap&, queryHeapVK);
         predicateQueryHeapVK.MarkDirtyRange(query, 1);
     }
 }
 
 void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
 {
-    auto& queryHeapVK = LLGL_CAST(VKQueryHeap&, queryHeap);
+    auto& queryHeapVK = LLGL_HOT_CAST(VKQueryHeap&, queryHeap);
 
     query *= queryHeapVK.GetGroupSize();
 
+    /* Queries must begin and end in the same render pass instance */
+    BeginPendingRenderPass();
+
     if (queryHeapVK.GetType() == QueryType::TimeElapsed)
     {
         /* Record second timestamp */
         vkCmdWriteTimestamp(commandBuffer_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryHeapVK.GetVkQueryPool(), query + 1);
     }
+    else if (queryHeapVK.GetType() == QueryType::Timestamp)
+    {
+        /* Record single timestamp once all previous commands have completed */
+        vkCmdWriteTimestamp(commandBuffer_, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryHeapVK.GetVkQueryPool(), query);
+    }
     else
     {
         /* End query section */
@@ -901,11 +1436,55 @@ void VKCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
     #endif
 }
 
+void VKCommandBuffer::ResolveQueryData(QueryHeap& srcQueryHeap, std::uint32_t firstQuery, std::uint32_t numQueries, Buffer& dstBuffer, std::uint64_t dstOffset)
+{
+    auto& queryHeapVK = LLGL_HOT_CAST(VKQueryHeap&, srcQueryHeap);
+    auto& dstBufferVK = LLGL_HOT_CAST(VKBuffer&, dstBuffer);
+
+    /* Pipeline statistics write all counters of a query back to back, every other query type writes a single 64-bit value */
+    const VkDeviceSize stride =
+    (
+        queryHeapVK.GetType() == QueryType::PipelineStatistics
+            ? sizeof(QueryPipelineStatistics)
+            : sizeof(std::uint64_t)
+    );
+
+    auto CopyQueryPoolResults = [&]()
+    {
+        vkCmdCopyQueryPoolResults(
+            commandBuffer_,
+            queryHeapVK.GetVkQueryPool(),
+            firstQuery * queryHeapVK.GetGroupSize(),
+            numQueries,
+            dstBufferVK.GetVkBuffer(),
+            static_cast<VkDeviceSize>(dstOffset),
+            stride,
+            (VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WAIT_BIT)
+        );
+    };
+
+    /* Query pool results cannot be copied inside a render pass */
+    if (IsInsideRenderPass())
+    {
+        PauseRenderPass();
+        CopyQueryPoolResults();
+        ResumeRenderPass();
+    }
+    else
+    {
+        context_.FlushBarriers();
+        CopyQueryPoolResults();
+    }
+}
+
 void VKCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t query, const RenderConditionMode mode)
 {
     LLGL_ASSERT_VK_EXT(EXT_conditional_rendering);
 
-    auto& queryHeapVK = LLGL_CAST(VKPredicateQueryHeap&, queryHeap);
+    auto& queryHeapVK = LLGL_HOT_CAST(VKPredicateQueryHeap&, queryHeap);
+
+    /* Conditional rendering that is made active inside a render pass must end inside the same render pass instance */
+    BeginPendingRenderPass();
 
     /* Flush dirty range before using predicate result buffer */
     if (queryHeapVK.InsideDirtyRange(query, 1))
@@ -930,6 +1509,7 @@ void VKCommandBuffer::BeginRenderCondition(QueryHeap& queryHeap, std::uint32_t q
         beginInfo.flags     = (mode >= RenderConditionMode::WaitInverted ? VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT : 0);
     }
     vkCmdBeginConditionalRenderingEXT(commandBuffer_, &beginInfo);
+    isRenderConditionActive_ = true;
 }
 
 void VKCommandBuffer::EndRenderCondition()
@@ -938,7 +1518,9 @@ void VKCommandBuffer::EndRenderCondition()
     LLGL_ASSERT_VK_EXT(EXT_conditional_rendering);
 
     /* End conditional rendering block */
+    BeginPendingRenderPass();
     vkCmdEndConditionalRenderingEXT(commandBuffer_);
+    isRenderConditionActive_ = false;
 }
 
 /* ----- Stream Output ------ */
@@ -947,6 +1529,9 @@ void VKCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
 {
     LLGL_ASSERT_VK_EXT(EXT_transform_feedback);
 
+    /* Transform feedback can only be recorded inside a render pass */
+    BeginPendingRenderPass();
+
     /* Get native Vulkan transform-feedback buffers */
     VkDeviceSize xfbOffsets[LLGL_MAX_NUM_SO_BUFFERS];
     VkDeviceSize xfbSizes[LLGL_MAX_NUM_SO_BUFFERS];
@@ -955,7 +1540,7 @@ void VKCommandBuffer::BeginStreamOutput(std::uint32_t numBuffers, Buffer* const
 
     for_range(i, xfbState_.numXfbBuffers)
     {
-        VKBuffer* bufferVK = LLGL_CAST(VKBuffer*, buffers[i]);
+        VKBuffer* bufferVK = LLGL_HOT_CAST(VKBuffer*, buffers[i]);
         xfbState_.xfbBuffers[i] = bufferVK->GetVkBuffer();
         xfbState_.xfbCounterOffsets[i] = bufferVK->GetXfbCounterOffset();
         xfbOffsets[i] = 0;
@@ -1042,14 +1627,14 @@ void VKCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
     vkCmdDrawIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
 
 void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     FlushDescriptorCache();
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
     if (maxDrawIndirectCount_ < numCommands)
     {
         /* Encode multiple indirect draw commands if limit is exceeded */
@@ -1068,14 +1653,14 @@ void VKCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::ui
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
     vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, 1, 0);
 }
 
 void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
 {
     FlushDescriptorCache();
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
     if (maxDrawIndirectCount_ < numCommands)
     {
         /* Encode multiple indirect draw commands if limit is exceeded */
@@ -1091,13 +1676,106 @@ void VKCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset,
         vkCmdDrawIndexedIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
 }
 
+void VKCommandBuffer::DrawIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_ASSERT_VK_EXT(KHR_draw_indirect_count);
+    FlushDescriptorCache();
+    auto& bufferVK      = LLGL_HOT_CAST(VKBuffer&, buffer);
+    auto& countBufferVK = LLGL_HOT_CAST(VKBuffer&, countBuffer);
+    vkCmdDrawIndirectCountKHR(
+        commandBuffer_,
+        bufferVK.GetVkBuffer(),
+        offset,
+        countBufferVK.GetVkBuffer(),
+        countOffset,
+        maxNumCommands,
+        stride
+    );
+}
+
+void VKCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         buffer,
+    std::uint64_t   offset,
+    Buffer&         countBuffer,
+    std::uint64_t   countOffset,
+    std::uint32_t   maxNumCommands,
+    std::uint32_t   stride)
+{
+    LLGL_ASSERT_VK_EXT(KHR_draw_indirect_count);
+    FlushDescriptorCache();
+    auto& bufferVK      = LLGL_HOT_CAST(VKBuffer&, buffer);
+    auto& countBufferVK = LLGL_HOT_CAST(VKBuffer&, countBuffer);
+    vkCmdDrawIndexedIndirectCountKHR(
+        commandBuffer_,
+        bufferVK.GetVkBuffer(),
+        offset,
+        countBufferVK.GetVkBuffer(),
+        countOffset,
+        maxNumCommands,
+        stride
+    );
+}
+
 void VKCommandBuffer::DrawStreamOutput()
 {
+    if (iaState_.ia0ComputeSOBuffer != VK_NULL_HANDLE)
+    {
+        /* Draw with the arguments that were written by a compute shader at the end of the vertex buffer */
+        FlushDescriptorCache();
+        vkCmdDrawIndirect(commandBuffer_, iaState_.ia0ComputeSOBuffer, iaState_.ia0ComputeSOArgsOffset, 1, 0);
+        return;
+    }
     LLGL_ASSERT_VK_EXT(EXT_transform_feedback);
     FlushDescriptorCache();
     vkCmdDrawIndirectByteCountEXT(commandBuffer_, 1, 0, iaState_.ia0XfbCounterBuffer, iaState_.ia0XfbCounterBufferOffset, 0, iaState_.ia0VertexStride);
 }
 
+void VKCommandBuffer::DrawMeshTasks(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    #if VK_EXT_mesh_shader
+    LLGL_ASSERT_VK_EXT(EXT_mesh_shader);
+    FlushDescriptorCache();
+    vkCmdDrawMeshTasksEXT(commandBuffer_, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+    #endif // /VK_EXT_mesh_shader
+}
+
+void VKCommandBuffer::DrawMeshTasksIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    #if VK_EXT_mesh_shader
+    LLGL_ASSERT_VK_EXT(EXT_mesh_shader);
+    FlushDescriptorCache();
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
+    vkCmdDrawMeshTasksIndirectEXT(commandBuffer_, bufferVK.GetVkBuffer(), offset, numCommands, stride);
+    #endif // /VK_EXT_mesh_shader
+}
+
+void VKCommandBuffer::DispatchTiles()
+{
+    // dummy - not supported in Vulkan
+}
+
+void VKCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
+{
+    // dummy - not supported in Vulkan
+}
+
+void VKCommandBuffer::DrawPacked(const DrawPackedDescriptor& drawDesc)
+{
+    EncodePackedDraws(*this, drawDesc);
+}
+
 /* ----- Compute ----- */
 
 void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
@@ -1109,16 +1787,36 @@ void VKCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWo
 void VKCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
 {
     FlushDescriptorCache();
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    auto& bufferVK = LLGL_HOT_CAST(VKBuffer&, buffer);
     vkCmdDispatchIndirect(commandBuffer_, bufferVK.GetVkBuffer(), offset);
 }
 
+/* ----- Ray Tracing ----- */
+
+void VKCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    /* Acceleration structures are not implemented for Vulkan yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("acceleration structures not supported by Vulkan backend\n");
+}
+
+void VKCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    /* Ray tracing PSOs are not implemented for Vulkan yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("ray tracing not supported by Vulkan backend\n");
+}
+
 /* ----- Debugging ----- */
 
 void VKCommandBuffer::PushDebugGroup(const char* name)
 {
     if (HasExtension(VKExt::EXT_debug_marker))
     {
+        BeginPendingRenderPass();
+
         VkDebugMarkerMarkerInfoEXT markerInfo;
         {
             markerInfo.sType        = VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT;
@@ -1136,7 +1834,10 @@ void VKCommandBuffer::PushDebugGroup(const char* name)
 void VKCommandBuffer::PopDebugGroup()
 {
     if (HasExtension(VKExt::EXT_debug_marker))
+    {
+        BeginPendingRenderPass();
         vkCmdDebugMarkerEndEXT(commandBuffer_);
+    }
 }
 
 /* ----- Extensions ----- */
@@ -1150,6 +1851,8 @@ bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
 {
     if (nativeHandle != nullptr && nativeHandleSize == sizeof(Vulkan::CommandBufferNativeHandle))
     {
+        /* Native commands recorded by the client inside a render pass must not precede its begin */
+        BeginPendingRenderPass();
         auto* nativeHandleVK = static_cast<Vulkan::CommandBufferNativeHandle*>(nativeHandle);
         nativeHandleVK->commandBuffer = commandBuffer_;
         return true;
@@ -1162,33 +1865,42 @@ bool VKCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHand
  * ======= Private: =======
  */
 
-void VKCommandBuffer::CreateVkCommandPool(std::uint32_t queueFamilyIndex)
+void VKCommandBuffer::CreateVkCommandPools(std::uint32_t queueFamilyIndex)
 {
-    /* Create command pool */
+    /*
+    Create one command pool per native command buffer without VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+    so each pool can be reset wholesale (see AcquireNextBuffer) and drivers don't have to track individual command buffer resets
+    */
     VkCommandPoolCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         createInfo.pNext            = nullptr;
-        createInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+        createInfo.flags            = 0;
         createInfo.queueFamilyIndex = queueFamilyIndex;
     }
-    VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool_.ReleaseAndGetAddressOf());
-    VKThrowIfFailed(result, "failed to create Vulkan command pool");
+    for_range(i, numCommandBuffers_)
+    {
+        VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPoolArray_[i].ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan command pool");
+    }
 }
 
 void VKCommandBuffer::CreateVkCommandBuffers()
 {
-    /* Allocate command buffers */
-    VkCommandBufferAllocateInfo allocInfo;
+    /* Allocate one command buffer from each command pool */
+    for_range(i, numCommandBuffers_)
     {
-        allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.pNext                 = nullptr;
-        allocInfo.commandPool           = commandPool_;
-        allocInfo.level                 = bufferLevel_;
-        allocInfo.commandBufferCount    = numCommandBuffers_;
+        VkCommandBufferAllocateInfo allocInfo;
+        {
+            allocInfo.sType                 = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.pNext                 = nullptr;
+            allocInfo.commandPool           = commandPoolArray_[i];
+            allocInfo.level                 = bufferLevel_;
+            allocInfo.commandBufferCount    = 1;
+        }
+        VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, &commandBufferArray_[i]);
+        VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
     }
-    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, commandBufferArray_);
-    VKThrowIfFailed(result, "failed to allocate Vulkan command buffers");
 }
 
 void VKCommandBuffer::CreateVkRecordingFences()
@@ -1281,13 +1993,152 @@ void VKCommandBuffer::ConvertRenderPassClearValues(
         dstClearValuesCount += renderPass.GetNumColorAttachments();
 }
 
+bool VKCommandBuffer::FoldClearsIntoPendingRenderPass(std::uint32_t numAttachments, const VkClearAttachment* attachments)
+{
+    /* Load operations are not affected by conditional rendering, so conditional clears must be recorded as commands */
+    if (!pendingRenderPass_.active || isRenderConditionActive_)
+        return false;
+
+    /* Later clears of the same attachment overwrite earlier ones just like consecutive clear commands would */
+    for_range(i, numAttachments)
+    {
+        const VkClearAttachment& attachment = attachments[i];
+        if (attachment.aspectMask == VK_IMAGE_ASPECT_COLOR_BIT)
+        {
+            if (attachment.colorAttachment < numColorAttachments_)
+            {
+                pendingRenderPass_.foldedColorMask |= (1u << attachment.colorAttachment);
+                pendingRenderPass_.foldedColors[attachment.colorAttachment] = attachment.clearValue.color;
+            }
+        }
+        else
+        {
+            const VkImageAspectFlags aspectMask = (attachment.aspectMask & depthStencilAspects_);
+            if ((aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT) != 0)
+                pendingRenderPass_.foldedDepthStencil.depth = attachment.clearValue.depthStencil.depth;
+            if ((aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT) != 0)
+                pendingRenderPass_.foldedDepthStencil.stencil = attachment.clearValue.depthStencil.stencil;
+            pendingRenderPass_.foldedDepthStencilAspects |= aspectMask;
+        }
+    }
+
+    return true;
+}
+
+void VKCommandBuffer::BeginPendingRenderPass()
+{
+    if (!pendingRenderPass_.active)
+        return;
+
+    pendingRenderPass_.active = false;
+
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        /* Record begin of dynamic rendering; the render pass object only provides the load/store operations and folded clears override them */
+        BeginRendering(pendingRenderPass_.renderPass, pendingRenderPass_.clearValues, false, &pendingRenderPass_);
+        return;
+    }
+    #endif // /VK_KHR_dynamic_rendering
+
+    VkRenderPass        renderPass      = renderPass_;
+    std::uint32_t       numClearValues  = pendingRenderPass_.numClearValues;
+    const VkClearValue* clearValues     = pendingRenderPass_.clearValues;
+
+    /* Switch to the compatible render pass that clears all attachments if every attachment has been cleared */
+    VkClearValue foldedClearValues[LLGL_MAX_NUM_COLOR_ATTACHMENTS + 1];
+
+    const std::uint32_t allColorsMask = ((1u << numColorAttachments_) - 1u);
+
+    if (pendingRenderPass_.clearRenderPass != VK_NULL_HANDLE &&
+        pendingRenderPass_.foldedColorMask == allColorsMask &&
+        pendingRenderPass_.foldedDepthStencilAspects == depthStencilAspects_)
+    {
+        for_range(i, numColorAttachments_)
+            foldedClearValues[i].color = pendingRenderPass_.foldedColors[i];
+        if (depthStencilAspects_ != 0)
+            foldedClearValues[numColorAttachments_].depthStencil = pendingRenderPass_.foldedDepthStencil;
+
+        renderPass      = pendingRenderPass_.clearRenderPass;
+        numClearValues  = (depthStencilAspects_ != 0 ? numColorAttachments_ + 1 : numColorAttachments_);
+        clearValues     = foldedClearValues;
+
+        pendingRenderPass_.foldedColorMask              = 0;
+        pendingRenderPass_.foldedDepthStencilAspects    = 0;
+    }
+
+    /* Record begin of render pass */
+    VkRenderPassBeginInfo beginInfo;
+    {
+        beginInfo.sType             = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        beginInfo.pNext             = nullptr;
+        beginInfo.renderPass        = renderPass;
+        beginInfo.framebuffer       = framebuffer_;
+        beginInfo.renderArea        = framebufferRenderArea_;
+        beginInfo.clearValueCount   = numClearValues;
+        beginInfo.pClearValues      = clearValues;
+    }
+    context_.FlushBarriers();
+    vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
+
+    /* Record the remaining clears that only cover a subset of attachments */
+    VkClearAttachment attachments[LLGL_MAX_NUM_ATTACHMENTS];
+
+    std::uint32_t numAttachments = 0;
+
+    for_range(i, numColorAttachments_)
+    {
+        if (((pendingRenderPass_.foldedColorMask >> i) & 0x1u) != 0)
+        {
+            VkClearAttachment& attachment = attachments[numAttachments++];
+            {
+                attachment.aspectMask       = VK_IMAGE_ASPECT_COLOR_BIT;
+                attachment.colorAttachment  = i;
+                attachment.clearValue.color = pendingRenderPass_.foldedColors[i];
+            }
+        }
+    }
+
+    if (pendingRenderPass_.foldedDepthStencilAspects != 0)
+    {
+        VkClearAttachment& attachment = attachments[numAttachments++];
+        {
+            attachment.aspectMask               = pendingRenderPass_.foldedDepthStencilAspects;
+            attachment.colorAttachment          = 0; // ignored
+            attachment.clearValue.depthStencil  = pendingRenderPass_.foldedDepthStencil;
+        }
+    }
+
+    ClearFramebufferAttachments(numAttachments, attachments);
+}
+
 void VKCommandBuffer::PauseRenderPass()
 {
+    /* Clears that have been folded into the pending render pass must precede the blit command */
+    BeginPendingRenderPass();
+
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        EndRendering();
+    else
+    #endif // /VK_KHR_dynamic_rendering
     vkCmdEndRenderPass(commandBuffer_);
+
+    /* Submit barriers that were deferred inside the render pass before the blit command is recorded */
+    context_.FlushBarriers();
 }
 
 void VKCommandBuffer::ResumeRenderPass()
 {
+    #if VK_KHR_dynamic_rendering
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        /* Record begin of dynamic rendering that loads and stores all attachment contents */
+        BeginRendering(nullptr, nullptr, true);
+        return;
+    }
+    #endif // /VK_KHR_dynamic_rendering
+
     /* Record begin of render pass */
     VkRenderPassBeginInfo beginInfo;
     {
@@ -1299,9 +2150,282 @@ void VKCommandBuffer::ResumeRenderPass()
         beginInfo.clearValueCount   = 0;
         beginInfo.pClearValues      = nullptr;
     }
+    context_.FlushBarriers();
     vkCmdBeginRenderPass(commandBuffer_, &beginInfo, subpassContents_);
 }
 
+#if VK_KHR_dynamic_rendering
+
+static VkImageLayout GetRenderingAttachmentLayout(const VKRenderingAttachment& attachment)
+{
+    return (VKTypes::IsVkFormatDepthStencil(attachment.format) ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+}
+
+static VkPipelineStageFlags GetRenderingAttachmentStages(const VKRenderingAttachment& attachment)
+{
+    if (VKTypes::IsVkFormatDepthStencil(attachment.format))
+        return (VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT);
+    else
+        return VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+}
+
+static VkAccessFlags GetRenderingAttachmentAccess(const VKRenderingAttachment& attachment)
+{
+    if (VKTypes::IsVkFormatDepthStencil(attachment.format))
+        return (VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT);
+    else
+        return (VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+}
+
+// Transitions the specified attachment between its resting layout and its attachment layout at the begin or end of dynamic rendering.
+static void RenderingAttachmentBarrier(VKCommandContext& context, const VKRenderingAttachment& attachment, bool beginRendering, bool loadContent)
+{
+    if (attachment.imageView == VK_NULL_HANDLE)
+        return;
+
+    const VkImageLayout         attachmentLayout    = GetRenderingAttachmentLayout(attachment);
+    const VkPipelineStageFlags  attachmentStages    = GetRenderingAttachmentStages(attachment);
+    const VkAccessFlags         attachmentAccess    = GetRenderingAttachmentAccess(attachment);
+    const TextureSubresource    subresource         { attachment.arrayLayer, attachment.numArrayLayers, attachment.mipLevel, 1u };
+
+    /* Select pipeline stages of the resting layout, i.e. where the image is used outside of rendering */
+    VkPipelineStageFlags    restingStages = attachmentStages;
+    VkAccessFlags           restingAccess = 0;
+
+    if (attachment.restingLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    {
+        restingStages = (VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
+        restingAccess = VK_ACCESS_SHADER_READ_BIT;
+    }
+    else if (attachment.restingLayout == VK_IMAGE_LAYOUT_PRESENT_SRC_KHR)
+        restingStages = (beginRendering ? VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+
+    if (beginRendering)
+    {
+        /* Discard previous content unless it is loaded, but always wait for previous attachment writes */
+        context.ImageMemoryBarrier(
+            attachment.image,
+            attachment.format,
+            (loadContent ? attachment.restingLayout : VK_IMAGE_LAYOUT_UNDEFINED),
+            attachmentLayout,
+            subresource,
+            (restingStages | attachmentStages),
+            (attachmentAccess & (VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT)),
+            attachmentStages,
+            attachmentAccess
+        );
+    }
+    else if (attachment.restingLayout != attachmentLayout)
+    {
+        /* Make attachment writes available in the resting layout */
+        context.ImageMemoryBarrier(
+            attachment.image,
+            attachment.format,
+            attachmentLayout,
+            attachment.restingLayout,
+            subresource,
+            attachmentStages,
+            (attachmentAccess & (VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT)),
+            restingStages,
+            restingAccess
+        );
+    }
+}
+
+static void FillVkRenderingAttachmentInfo(
+    VkRenderingAttachmentInfoKHR&   dst,
+    const VKRenderingAttachment&    attachment,
+    const VKRenderingAttachment*    resolveAttachment,
+    VkAttachmentLoadOp              loadOp,
+    VkAttachmentStoreOp             storeOp,
+    const VkClearValue*             clearValue)
+{
+    dst.sType               = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    dst.pNext               = nullptr;
+    dst.imageView           = attachment.imageView;
+    dst.imageLayout         = GetRenderingAttachmentLayout(attachment);
+    if (resolveAttachment != nullptr && resolveAttachment->imageView != VK_NULL_HANDLE)
+    {
+        dst.resolveMode         = VK_RESOLVE_MODE_AVERAGE_BIT_KHR;
+        dst.resolveImageView    = resolveAttachment->imageView;
+        dst.resolveImageLayout  = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    }
+    else
+    {
+        dst.resolveMode         = VK_RESOLVE_MODE_NONE_KHR;
+        dst.resolveImageView    = VK_NULL_HANDLE;
+        dst.resolveImageLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+    }
+    dst.loadOp              = loadOp;
+    dst.storeOp             = storeOp;
+    if (loadOp == VK_ATTACHMENT_LOAD_OP_CLEAR && clearValue != nullptr)
+        dst.clearValue      = *clearValue;
+    else
+        dst.clearValue      = VkClearValue{};
+}
+
+void VKCommandBuffer::BeginRendering(
+    const VKRenderPass*         renderPass,
+    const VkClearValue*         clearValues,
+    bool                        resumeContent,
+    const PendingRenderPass*    pendingRenderPass)
+{
+    const VKRenderingAttachmentSet& attachments = renderingAttachments_;
+
+    /* Select load/store operations: resumed rendering preserves all contents, otherwise they're taken from the render pass or discarded */
+    const bool          hasRenderPassOps    = (!resumeContent && renderPass != nullptr);
+    const std::uint32_t numColorOps         = (hasRenderPassOps ? renderPass->GetNumColorAttachments() : 0);
+    const std::uint32_t depthStencilIndex   = (hasRenderPassOps ? renderPass->GetDepthStencilIndex() : 0xFFu);
+    const bool          hasDepthStencilOps  = (depthStencilIndex != 0xFFu);
+    const VkAttachmentLoadOp defaultLoadOp  = (resumeContent ? VK_ATTACHMENT_LOAD_OP_LOAD : VK_ATTACHMENT_LOAD_OP_DONT_CARE);
+
+    /* Initialize color attachments and transition them into attachment layout */
+    VkRenderingAttachmentInfoKHR colorAttachmentsVK[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
+    for_range(i, attachments.numColorAttachments)
+    {
+        VkAttachmentLoadOp  loadOp      = (i < numColorOps ? renderPass->GetLoadOp(i) : defaultLoadOp);
+        const VkClearValue* clearValue  = (clearValues != nullptr ? &clearValues[i] : nullptr);
+
+        /* Override load operation with a folded clear */
+        VkClearValue foldedClearValue;
+        if (pendingRenderPass != nullptr && ((pendingRenderPass->foldedColorMask >> i) & 0x1u) != 0)
+        {
+            foldedClearValue.color  = pendingRenderPass->foldedColors[i];
+            loadOp                  = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            clearValue              = &foldedClearValue;
+        }
+
+        FillVkRenderingAttachmentInfo(
+            colorAttachmentsVK[i],
+            attachments.colorAttachments[i],
+            &(attachments.resolveAttachments[i]),
+            loadOp,
+            (i < numColorOps ? renderPass->GetStoreOp(i) : VK_ATTACHMENT_STORE_OP_STORE),
+            clearValue
+        );
+        RenderingAttachmentBarrier(context_, attachments.colorAttachments[i], true, (loadOp == VK_ATTACHMENT_LOAD_OP_LOAD));
+        RenderingAttachmentBarrier(context_, attachments.resolveAttachments[i], true, false);
+    }
+
+    /* Initialize depth and stencil attachments, which refer to the same image view */
+    const VKRenderingAttachment&    depthStencil        = attachments.depthStencilAttachment;
+    const bool                      hasDepthStencil     = (depthStencil.imageView != VK_NULL_HANDLE);
+    const bool                      hasDepth            = (hasDepthStencil && depthStencil.format != VK_FORMAT_S8_UINT);
+    const bool                      hasStencil          = (hasDepthStencil && VKTypes::IsVkFormatStencil(depthStencil.format));
+
+    VkRenderingAttachmentInfoKHR depthAttachmentVK;
+    VkRenderingAttachmentInfoKHR stencilAttachmentVK;
+
+    if (hasDepthStencil)
+    {
+        const VkClearValue*         clearValue      = (clearValues != nullptr && hasDepthStencilOps ? &clearValues[depthStencilIndex] : nullptr);
+        VkAttachmentLoadOp          depthLoadOp     = (!hasDepth ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : hasDepthStencilOps ? renderPass->GetLoadOp(depthStencilIndex) : defaultLoadOp);
+        VkAttachmentLoadOp          stencilLoadOp   = (!hasStencil ? VK_ATTACHMENT_LOAD_OP_DONT_CARE : hasDepthStencilOps ? renderPass->GetStencilLoadOp() : defaultLoadOp);
+
+        /* Override load operations with folded clears; depth and stencil share one clear value, so merge it with the one from the render pass */
+        VkClearValue foldedClearValue;
+        if (pendingRenderPass != nullptr && pendingRenderPass->foldedDepthStencilAspects != 0)
+        {
+            if (clearValue != nullptr && (depthLoadOp == VK_ATTACHMENT_LOAD_OP_CLEAR || stencilLoadOp == VK_ATTACHMENT_LOAD_OP_CLEAR))
+                foldedClearValue.depthStencil = clearValue->depthStencil;
+            else
+                foldedClearValue.depthStencil = pendingRenderPass->foldedDepthStencil;
+
+            if (hasDepth && (pendingRenderPass->foldedDepthStencilAspects & VK_IMAGE_ASPECT_DEPTH_BIT) != 0)
+            {
+                foldedClearValue.depthStencil.depth = pendingRenderPass->foldedDepthStencil.depth;
+                depthLoadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            }
+            if (hasStencil && (pendingRenderPass->foldedDepthStencilAspects & VK_IMAGE_ASPECT_STENCIL_BIT) != 0)
+            {
+                foldedClearValue.depthStencil.stencil = pendingRenderPass->foldedDepthStencil.stencil;
+                stencilLoadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+            }
+
+            clearValue = &foldedClearValue;
+        }
+
+        if (hasDepth)
+        {
+            const VkAttachmentStoreOp storeOp = (hasDepthStencilOps ? renderPass->GetStoreOp(depthStencilIndex) : VK_ATTACHMENT_STORE_OP_STORE);
+            FillVkRenderingAttachmentInfo(depthAttachmentVK, depthStencil, nullptr, depthLoadOp, storeOp, clearValue);
+        }
+        if (hasStencil)
+        {
+            const VkAttachmentStoreOp storeOp = (hasDepthStencilOps ? renderPass->GetStencilStoreOp() : VK_ATTACHMENT_STORE_OP_STORE);
+            FillVkRenderingAttachmentInfo(stencilAttachmentVK, depthStencil, nullptr, stencilLoadOp, storeOp, clearValue);
+        }
+
+        const bool loadContent = (depthLoadOp == VK_ATTACHMENT_LOAD_OP_LOAD || stencilLoadOp == VK_ATTACHMENT_LOAD_OP_LOAD);
+        RenderingAttachmentBarrier(context_, depthStencil, true, loadContent);
+    }
+
+    /* Secondary command buffers can only be executed if the rendering contents allow it */
+    VkRenderingFlagsKHR renderingFlags = 0;
+    #ifdef VK_EXT_nested_command_buffer
+    if (subpassContents_ == VK_SUBPASS_CONTENTS_INLINE_AND_SECONDARY_COMMAND_BUFFERS_EXT)
+        renderingFlags |= VK_RENDERING_CONTENTS_INLINE_BIT_EXT;
+    #endif
+
+    /* Record begin of dynamic rendering */
+    VkRenderingInfoKHR renderingInfo;
+    {
+        renderingInfo.sType                 = VK_STRUCTURE_TYPE_RENDERING_INFO_KHR;
+        renderingInfo.pNext                 = nullptr;
+        renderingInfo.flags                 = renderingFlags;
+        renderingInfo.renderArea            = framebufferRenderArea_;
+        renderingInfo.layerCount            = 1;
+        renderingInfo.viewMask              = attachments.viewMask;
+        renderingInfo.colorAttachmentCount  = attachments.numColorAttachments;
+        renderingInfo.pColorAttachments     = colorAttachmentsVK;
+        renderingInfo.pDepthAttachment      = (hasDepth ? &depthAttachmentVK : nullptr);
+        renderingInfo.pStencilAttachment    = (hasStencil ? &stencilAttachmentVK : nullptr);
+    }
+
+    #if VK_KHR_fragment_shading_rate
+
+    /* Chain shading-rate attachment into rendering info and transition it into shading-rate attachment layout */
+    VkRenderingFragmentShadingRateAttachmentInfoKHR shadingRateAttachmentVK;
+    if (attachments.shadingRateTexture != nullptr)
+    {
+        shadingRateAttachmentVK.sType                           = VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR;
+        shadingRateAttachmentVK.pNext                           = nullptr;
+        shadingRateAttachmentVK.imageView                       = attachments.shadingRateImageView;
+        shadingRateAttachmentVK.imageLayout                     = VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR;
+        shadingRateAttachmentVK.shadingRateAttachmentTexelSize  = attachments.shadingRateTexelSize;
+        renderingInfo.pNext = &shadingRateAttachmentVK;
+        shadingRateRestingLayout_ = attachments.shadingRateTexture->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR);
+    }
+
+    #endif // /VK_KHR_fragment_shading_rate
+
+    context_.FlushBarriers();
+    vkCmdBeginRenderingKHR(commandBuffer_, &renderingInfo);
+}
+
+void VKCommandBuffer::EndRendering()
+{
+    vkCmdEndRenderingKHR(commandBuffer_);
+
+    /* Transition all attachments back into their resting layouts */
+    const VKRenderingAttachmentSet& attachments = renderingAttachments_;
+
+    for_range(i, attachments.numColorAttachments)
+    {
+        RenderingAttachmentBarrier(context_, attachments.colorAttachments[i], false, false);
+        RenderingAttachmentBarrier(context_, attachments.resolveAttachments[i], false, false);
+    }
+    RenderingAttachmentBarrier(context_, attachments.depthStencilAttachment, false, false);
+
+    if (attachments.shadingRateTexture != nullptr)
+        attachments.shadingRateTexture->TransitionImageLayout(context_, shadingRateRestingLayout_);
+
+    context_.FlushBarriers();
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
 bool VKCommandBuffer::IsInsideRenderPass() const
 {
     return (recordState_ == RecordState::InsideRenderPass);
@@ -1316,30 +2440,97 @@ void VKCommandBuffer::BufferPipelineBarrier(
     VkPipelineStageFlags    srcStageMask,
     VkPipelineStageFlags    dstStageMask)
 {
-    VkBufferMemoryBarrier barrier;
+    /* Defer barrier until the next draw, compute, or blit command */
+    context_.BufferMemoryBarrier(buffer, offset, size, srcStageMask, srcAccessMask, dstStageMask, dstAccessMask);
+}
+
+void VKCommandBuffer::FlushShadingRate()
+{
+    #if VK_KHR_fragment_shading_rate
+    LLGL_ASSERT_VK_EXT(KHR_fragment_shading_rate);
+
+    /* Keep the per-draw rate over the per-primitive rate and take the coarser rate of the per-draw rate and the shading-rate attachment */
+    const VkFragmentShadingRateCombinerOpKHR combinerOps[2] =
     {
-        barrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
-        barrier.pNext               = nullptr;
-        barrier.srcAccessMask       = srcAccessMask;
-        barrier.dstAccessMask       = dstAccessMask;
-        barrier.srcQueueFamilyIndex = 0;
-        barrier.dstQueueFamilyIndex = 0;
-        barrier.buffer              = buffer;
-        barrier.offset              = offset;
-        barrier.size                = size;
-    }
-    vkCmdPipelineBarrier(commandBuffer_, srcStageMask, dstStageMask, 0, 0, nullptr, 1, &barrier, 0, nullptr);
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_MAX_KHR,
+    };
+    vkCmdSetFragmentShadingRateKHR(commandBuffer_, &shadingRateExtent_, combinerOps);
+    #endif // /VK_KHR_fragment_shading_rate
 }
 
 void VKCommandBuffer::FlushDescriptorCache()
 {
-    if (descriptorCache_ != nullptr && descriptorCache_->IsInvalidated())
+    /* Draw commands must be recorded inside the native render pass */
+    BeginPendingRenderPass();
+
+    /* Submit all deferred barriers with a single pipeline barrier command */
+    context_.FlushBarriers();
+
+    if (descriptorCache_ != nullptr)
+    {
+        if (descriptorCache_->IsInvalidated())
+        {
+            dynamicDescriptorSet_ = descriptorCache_->FlushDescriptorSet(*descriptorSetPool_, descriptorSetWriter_);
+            boundPipelineState_->BindDynamicDescriptorSet(commandBuffer_, dynamicDescriptorSet_, descriptorCache_->FlushDynamicOffsets());
+        }
+        else if (descriptorCache_->HasDynamicOffsetsChanged())
+        {
+            /* Bind previous descriptor set again with new dynamic offsets; no descriptors have to be written to change the constant buffer ranges */
+            boundPipelineState_->BindDynamicDescriptorSet(commandBuffer_, dynamicDescriptorSet_, descriptorCache_->FlushDynamicOffsets());
+        }
+    }
+    #if VK_KHR_push_descriptor
+    else if (pushDescriptorCache_.IsInvalidated() && boundPipelineLayout_ != nullptr && boundPipelineLayout_->HasPushDescriptorSet())
+    {
+        /* Push all dynamic descriptors directly into the command buffer; this requires no descriptor set allocation */
+        boundPipelineState_->PushDynamicDescriptorSet(commandBuffer_, pushDescriptorCache_.FlushDescriptorWrites());
+    }
+    #endif // /VK_KHR_push_descriptor
+
+    FlushPushConstants();
+}
+
+void VKCommandBuffer::FlushPushConstants()
+{
+    if (numPendingUniforms_ > 0)
     {
-        VkDescriptorSet descriptorSet = descriptorCache_->FlushDescriptorSet(*descriptorSetPool_, descriptorSetWriter_);
-        boundPipelineState_->BindDynamicDescriptorSet(commandBuffer_, descriptorSet);
+        if (boundPipelineState_ != nullptr)
+            boundPipelineState_->FlushPushConstants(commandBuffer_, firstPendingUniform_, numPendingUniforms_, pushConstantsData_.data());
+        numPendingUniforms_ = 0;
     }
 }
 
+VkEvent VKCommandBuffer::AllocSplitBarrierEvent()
+{
+    std::vector<VKPtr<VkEvent>>& eventPool = splitBarrierEventPoolArray_[commandBufferIndex_];
+
+    /* Create new event if the pool of the current native command buffer is exhausted */
+    if (numSplitBarrierEvents_ == eventPool.size())
+    {
+        VkEventCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_EVENT_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VKPtr<VkEvent> event{ device_, vkDestroyEvent };
+        VkResult result = vkCreateEvent(device_, &createInfo, nullptr, event.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan event for split barrier");
+        eventPool.push_back(std::move(event));
+    }
+
+    return eventPool[numSplitBarrierEvents_++].Get();
+}
+
+void VKCommandBuffer::ResetPendingSplitBarriers()
+{
+    /* Reset events that have been signaled but never waited on, so they can be reused with the next submission */
+    for (const SplitBarrier& splitBarrier : pendingSplitBarriers_)
+        vkCmdResetEvent(commandBuffer_, splitBarrier.event, g_storageWriteStageMask);
+    pendingSplitBarriers_.clear();
+}
+
 void VKCommandBuffer::AcquireNextBuffer()
 {
     /* Move to next command buffer index */
@@ -1349,16 +2540,30 @@ void VKCommandBuffer::AcquireNextBuffer()
     recordingFence_ = recordingFenceArray_[commandBufferIndex_].Get();
     if (recordingFenceDirty_[commandBufferIndex_])
         vkWaitForFences(device_, 1, &recordingFence_, VK_TRUE, UINT64_MAX);
+    else if (submitBatchIDs_[commandBufferIndex_] != 0)
+        commandQueue_.WaitForSubmitBatch(submitBatchIDs_[commandBufferIndex_]);
+    submitBatchIDs_[commandBufferIndex_] = 0;
+
+    /* Let the queue know the last submission of this command buffer has completed, so resource heaps can be updated without waiting for it */
+    if (submitIDs_[commandBufferIndex_] != 0)
+        commandQueue_.NotifySubmitCompleted(submitIDs_[commandBufferIndex_]);
+    submitIDs_[commandBufferIndex_] = 0;
 
     /* Reset fence state after it has been signaled by the command queue */
     vkResetFences(device_, 1, &recordingFence_);
     recordingFenceDirty_[commandBufferIndex_] = false;
 
+    /* Recycle all memory of the next command buffer at once; its pool is not used by any other command buffer */
+    vkResetCommandPool(device_, commandPoolArray_[commandBufferIndex_], 0);
+
     /* Make next command buffer current and reset pools and context */
     commandBuffer_      = commandBufferArray_[commandBufferIndex_];
     descriptorSetPool_  = &(descriptorSetPoolArray_[commandBufferIndex_]);
     descriptorSetPool_->Reset();
+    transientBufferPool_ = &(transientBufferPoolArray_[commandBufferIndex_]);
+    transientBufferPool_->Reset();
     context_.Reset(commandBuffer_);
+    numSplitBarrierEvents_ = 0;
 }
 
 void VKCommandBuffer::ResetBindingStates()
@@ -1367,6 +2572,9 @@ void VKCommandBuffer::ResetBindingStates()
     boundPipelineLayout_    = nullptr;
     boundPipelineState_     = nullptr;
     descriptorCache_        = nullptr;
+    dynamicDescriptorSet_   = VK_NULL_HANDLE;
+    numPendingUniforms_     = 0;
+    iaState_                = InputAssemblyState{};
 }
 
 #if 0
@@ -16,19 +16,24 @@
 #include "VKCommandContext.h"
 #include "../RenderState/VKStagingDescriptorSetPool.h"
 #include "../RenderState/VKDescriptorCache.h"
+#include "../RenderState/VKRenderPass.h"
+#include "../Buffer/VKTransientBufferPool.h"
+#include <LLGL/Container/SmallVector.h>
 #include <vector>
+#include <memory>
 
 
 namespace LLGL
 {
 
 
+class VKDevice;
 class VKPhysicalDevice;
 class VKResourceHeap;
-class VKRenderPass;
 class VKQueryHeap;
 class VKSwapChain;
 class VKPipelineState;
+class VKCommandQueue;
 
 class VKCommandBuffer final : public CommandBuffer
 {
@@ -37,13 +42,43 @@ class VKCommandBuffer final : public CommandBuffer
 
         #include <LLGL/Backend/CommandBuffer.inl>
 
+    public:
+
+        TransientBufferAllocation AllocTransientBuffer(std::uint64_t size, long bindFlags, std::uint64_t alignment) override;
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+        void CopyBufferRegions(Buffer& dstBuffer, Buffer& srcBuffer, std::uint32_t numRegions, const BufferCopyRegion* regions) override;
+        void CopyTextureRegions(Texture& dstTexture, Texture& srcTexture, std::uint32_t numRegions, const TextureCopyRegion* regions) override;
+
+        void GenerateMips(std::uint32_t numTextures, Texture* const * textures) override;
+
+        void BeginResourceBarrier(
+            std::uint32_t       numBuffers,
+            Buffer* const *     buffers,
+            std::uint32_t       numTextures,
+            Texture* const *    textures
+        ) override;
+
+        void EndResourceBarrier(
+            std::uint32_t       numBuffers,
+            Buffer* const *     buffers,
+            std::uint32_t       numTextures,
+            Texture* const *    textures
+        ) override;
+
+        void AliasingBarrier(Texture* textureBefore, Texture* textureAfter) override;
+
+        void DrawPacked(const DrawPackedDescriptor& drawDesc) override;
+
     public:
 
         VKCommandBuffer(
             const VKPhysicalDevice&         physicalDevice,
-            VkDevice                        device,
-            VkQueue                         commandQueue,
+            const VKDevice&                 device,
+            VKCommandQueue&                 commandQueue,
             const VKQueueFamilyIndices&     queueFamilyIndices,
+            std::uint32_t                   queueFamilyIndex,
             const CommandBufferDescriptor&  desc
         );
 
@@ -55,6 +90,19 @@ class VKCommandBuffer final : public CommandBuffer
         // i.e. it won't need another signal for the next submission.
         VkFence GetQueueSubmitFenceAndFlush();
 
+        /*
+        Flushes the recording fence like GetQueueSubmitFenceAndFlush(), but the command buffer has been submitted as part of a batch,
+        which signals a fence of the command queue instead. The next recording into the same native command buffer waits for that batch.
+        */
+        void FlushQueueSubmitFenceForBatch(std::uint64_t batchID);
+
+        /*
+        Records that this command buffer has been submitted to the specified queue with the specified submission ID (see VKCommandQueue::GetSubmitCount()).
+        All resource heaps bound during recording are marked with this submission. If the submission signals the fence (or batch) this command buffer waits on
+        before it is recorded again, the queue is notified about the completion of this submission once that wait has finished.
+        */
+        void NotifySubmitted(VKCommandQueue& commandQueue, std::uint64_t submitID, bool signalsRecordingFence);
+
         // Returns the native VkCommandBuffer object.
         inline VkCommandBuffer GetVkCommandBuffer() const
         {
@@ -85,7 +133,7 @@ class VKCommandBuffer final : public CommandBuffer
 
     private:
 
-        void CreateVkCommandPool(std::uint32_t queueFamilyIndex);
+        void CreateVkCommandPools(std::uint32_t queueFamilyIndex);
         void CreateVkCommandBuffers();
         void CreateVkRecordingFences();
 
@@ -99,9 +147,33 @@ class VKCommandBuffer final : public CommandBuffer
             const ClearValue*   srcClearValues
         );
 
+        // Folds the specified clear commands into the load operations of the pending render pass. Returns false if the clears must be recorded immediately.
+        bool FoldClearsIntoPendingRenderPass(std::uint32_t numAttachments, const VkClearAttachment* attachments);
+
+        // Records the begin of the render pass that has been deferred by BeginRenderPass(), if there is one.
+        void BeginPendingRenderPass();
+
         void PauseRenderPass();
         void ResumeRenderPass();
 
+        #if VK_KHR_dynamic_rendering
+
+        struct PendingRenderPass;
+
+        // Begins dynamic rendering with the current rendering attachments. If 'renderPass' is null, all attachment contents are discarded on begin.
+        // Clears folded into 'pendingRenderPass' override the load operations of their attachments.
+        void BeginRendering(
+            const VKRenderPass*         renderPass,
+            const VkClearValue*         clearValues,
+            bool                        resumeContent,
+            const PendingRenderPass*    pendingRenderPass = nullptr
+        );
+
+        // Ends dynamic rendering and transitions all rendering attachments back into their resting layouts.
+        void EndRendering();
+
+        #endif // /VK_KHR_dynamic_rendering
+
         bool IsInsideRenderPass() const;
 
         void BufferPipelineBarrier(
@@ -116,6 +188,18 @@ class VKCommandBuffer final : public CommandBuffer
 
         void FlushDescriptorCache();
 
+        // Pushes the uniforms of all pending SetUniforms() calls with the bound PSO. Must be called before each draw and dispatch command and before a PSO is bound.
+        void FlushPushConstants();
+
+        // Records the current fragment shading rate. Must be called after a graphics PSO with dynamic shading rate has been bound.
+        void FlushShadingRate();
+
+        // Returns a VkEvent for a split resource barrier from the pool of the current native command buffer.
+        VkEvent AllocSplitBarrierEvent();
+
+        // Resets the events of all split resource barriers that have not been ended and clears the list of pending split barriers.
+        void ResetPendingSplitBarriers();
+
         // Acquires the next native VkCommandBuffer object.
         void AcquireNextBuffer();
 
@@ -139,6 +223,8 @@ class VKCommandBuffer final : public CommandBuffer
             VkBuffer        ia0XfbCounterBuffer         = VK_NULL_HANDLE;
             VkDeviceSize    ia0XfbCounterBufferOffset   = 0;
             std::uint32_t   ia0VertexStride             = 0;
+            VkBuffer        ia0ComputeSOBuffer          = VK_NULL_HANDLE; // Vertex buffer with BindFlags::ComputeStreamOutput
+            VkDeviceSize    ia0ComputeSOArgsOffset      = 0;
         };
 
         struct TransformFeedbackState
@@ -148,19 +234,44 @@ class VKCommandBuffer final : public CommandBuffer
             std::uint32_t   numXfbBuffers                               = 0;
         };
 
+        // Split resource barrier between BeginResourceBarrier() and EndResourceBarrier().
+        struct SplitBarrier
+        {
+            VkEvent                     event       = VK_NULL_HANDLE;
+            std::uint32_t               numBuffers  = 0;
+            SmallVector<Resource*, 4>   resources;                      // Buffers followed by textures
+        };
+
+        // Render pass whose begin is deferred until the first command that must be recorded inside of it,
+        // so that clear commands in between can be folded into the attachment load operations.
+        struct PendingRenderPass
+        {
+            bool                        active                                          = false;
+            const VKRenderPass*         renderPass                                      = nullptr;          // Render pass passed to BeginRenderPass(); null for the framebuffer's own render pass
+            VkRenderPass                clearRenderPass                                 = VK_NULL_HANDLE;   // Framebuffer render pass that clears all attachments, only used without VK_KHR_dynamic_rendering
+            std::uint32_t               numClearValues                                  = 0;
+            VkClearValue                clearValues[LLGL_MAX_NUM_COLOR_ATTACHMENTS * 2 + 1];
+            std::uint32_t               foldedColorMask                                 = 0;                // Bitmask of color attachments with a folded clear
+            VkClearColorValue           foldedColors[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+            VkImageAspectFlags          foldedDepthStencilAspects                       = 0;
+            VkClearDepthStencilValue    foldedDepthStencil                              = { 1.0f, 0 };
+        };
+
     private:
 
         static constexpr std::uint32_t maxNumCommandBuffers = 3;
 
         VkDevice                        device_                                         = VK_NULL_HANDLE;
 
-        VkQueue                         commandQueue_                                   = VK_NULL_HANDLE;
+        VKCommandQueue&                 commandQueue_;
 
-        VKPtr<VkCommandPool>            commandPool_;
+        VKPtr<VkCommandPool>            commandPoolArray_[maxNumCommandBuffers];        // One pool per native command buffer, reset wholesale once its recording fence is signaled.
 
         VKPtr<VkFence>                  recordingFenceArray_[maxNumCommandBuffers];
         VkFence                         recordingFence_                                 = VK_NULL_HANDLE;
         bool                            recordingFenceDirty_[maxNumCommandBuffers]      = {};
+        std::uint64_t                   submitBatchIDs_[maxNumCommandBuffers]           = {};
+        std::uint64_t                   submitIDs_[maxNumCommandBuffers]                = {};               // Submission that signals the recording fence or batch of each native command buffer
         VkCommandBuffer                 commandBufferArray_[maxNumCommandBuffers];
         VkCommandBuffer                 commandBuffer_                                  = VK_NULL_HANDLE;
         std::uint32_t                   commandBufferIndex_                             = 0;
@@ -179,16 +290,23 @@ class VKCommandBuffer final : public CommandBuffer
 
         VkRenderPass                    renderPass_                                     = VK_NULL_HANDLE; // primary render pass
         VkRenderPass                    secondaryRenderPass_                            = VK_NULL_HANDLE; // to pause/resume render pass (load and store content)
+        std::unique_ptr<VKRenderPass>   inheritanceRenderPass_;                                           // compatible render pass owned by secondary command buffers
         VkFramebuffer                   framebuffer_                                    = VK_NULL_HANDLE; // active framebuffer handle
         VkRect2D                        framebufferRenderArea_                          = { { 0, 0 }, { 0, 0 } };
         std::uint32_t                   numColorAttachments_                            = 0;
         bool                            hasDepthStencilAttachment_                      = false;
+        VkImageAspectFlags              depthStencilAspects_                            = 0;              // aspects of the active depth-stencil attachment
+        PendingRenderPass               pendingRenderPass_;
+        bool                            isRenderConditionActive_                        = false;          // clears inside a conditional rendering block must not be folded
         VkSubpassContents               subpassContents_                                = VK_SUBPASS_CONTENTS_INLINE;
+        VKRenderingAttachmentSet        renderingAttachments_;                                            // attachments of the active render pass, only used with VK_KHR_dynamic_rendering
+        VkImageLayout                   shadingRateRestingLayout_                       = VK_IMAGE_LAYOUT_UNDEFINED; // layout of the shading-rate attachment outside of rendering
 
         std::uint32_t                   queuePresentFamily_                             = 0;
 
         bool                            scissorEnabled_                                 = false;
         bool                            hasDynamicScissorRect_                          = false;
+        VkExtent2D                      shadingRateExtent_                              = { 1, 1 };
         VkPipelineBindPoint             pipelineBindPoint_                              = VK_PIPELINE_BIND_POINT_MAX_ENUM;
         const VKPipelineLayout*         boundPipelineLayout_                            = nullptr;
         VKPipelineState*                boundPipelineState_                             = nullptr;
@@ -199,10 +317,24 @@ class VKCommandBuffer final : public CommandBuffer
         VKStagingDescriptorSetPool*     descriptorSetPool_                              = nullptr;
         VKDescriptorCache*              descriptorCache_                                = nullptr;
         VKDescriptorSetWriter           descriptorSetWriter_;
+        VkDescriptorSet                 dynamicDescriptorSet_                           = VK_NULL_HANDLE; // Last flushed descriptor set of 'descriptorCache_'.
+        VKPushDescriptorCache           pushDescriptorCache_;                                             // Dynamic descriptors for pipeline layouts with push descriptor sets.
+        std::vector<VKResourceHeap*>    boundResourceHeaps_;                                              // Resource heaps bound since Begin() that cannot be updated while in use.
+
+        std::vector<char>               pushConstantsData_;                                               // Shadow data of push constants, indexed by push-constant offsets.
+        std::uint32_t                   firstPendingUniform_                            = 0;              // First uniform that has been set since the last push.
+        std::uint32_t                   numPendingUniforms_                             = 0;              // Number of consecutive uniforms that have been set since the last push.
 
         InputAssemblyState              iaState_;
         TransformFeedbackState          xfbState_;
 
+        VKTransientBufferPool           transientBufferPoolArray_[maxNumCommandBuffers];
+        VKTransientBufferPool*          transientBufferPool_                            = nullptr;
+
+        std::vector<VKPtr<VkEvent>>     splitBarrierEventPoolArray_[maxNumCommandBuffers];
+        std::uint32_t                   numSplitBarrierEvents_                          = 0;
+        std::vector<SplitBarrier>       pendingSplitBarriers_;
+
         #if 0//TODO: optimize usage of query pools
         std::vector<VKQueryHeap*>       queryHeapsInFlight_;
         std::size_t                     numQueryHeapsInFlight_                          = 0;
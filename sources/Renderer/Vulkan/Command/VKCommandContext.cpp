@@ -10,9 +10,13 @@
 #include "../Buffer/VKBuffer.h"
 #include "../Texture/VKTexture.h"
 #include "../Texture/VKImageUtils.h"
+#include "../Ext/VKExtensionRegistry.h"
+#include "../Ext/VKExtensions.h"
+#include "../../ProfileCounters.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/TextureFlags.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 
 
 namespace LLGL
@@ -60,19 +64,55 @@ void VKCommandContext::Reset(VkCommandBuffer commandBuffer)
     commandBuffer_ = commandBuffer;
 }
 
+void VKCommandContext::GlobalMemoryBarrier(
+    VkPipelineStageFlags    srcStageMask,
+    VkAccessFlags           srcAccessMask,
+    VkPipelineStageFlags    dstStageMask,
+    VkAccessFlags           dstAccessMask)
+{
+    /* Merge access masks into pending memory barrier with the same pipeline stages */
+    for_range(i, numMemoryBarriers_)
+    {
+        if (memoryBarrierStages_[i].src == srcStageMask && memoryBarrierStages_[i].dst == dstStageMask)
+        {
+            memoryBarriers_[i].srcAccessMask |= srcAccessMask;
+            memoryBarriers_[i].dstAccessMask |= dstAccessMask;
+            return;
+        }
+    }
+
+    if (numMemoryBarriers_ == maxNumBarriers)
+        FlushBarriers();
+
+    /* Initialize memory barrier descriptor */
+    const std::uint32_t index = numMemoryBarriers_++;
+    VkMemoryBarrier& barrier = memoryBarriers_[index];
+    {
+        barrier.srcAccessMask   = srcAccessMask;
+        barrier.dstAccessMask   = dstAccessMask;
+    }
+    memoryBarrierStages_[index] = { srcStageMask, dstStageMask };
+
+    /* Accumulate pipeline state flags */
+    srcStageMask_ |= srcStageMask;
+    dstStageMask_ |= dstStageMask;
+}
+
 void VKCommandContext::BufferMemoryBarrier(
-    VkBuffer        buffer,
-    VkDeviceSize    offset,
-    VkDeviceSize    size,
-    VkAccessFlags   srcAccessMask,
-    VkAccessFlags   dstAccessMask,
-    bool            flushImmediately)
+    VkBuffer                buffer,
+    VkDeviceSize            offset,
+    VkDeviceSize            size,
+    VkPipelineStageFlags    srcStageMask,
+    VkAccessFlags           srcAccessMask,
+    VkPipelineStageFlags    dstStageMask,
+    VkAccessFlags           dstAccessMask)
 {
     if (numBufferBarriers_ == maxNumBarriers)
         FlushBarriers();
 
     /* Initialize buffer memory barrier descriptor */
-    VkBufferMemoryBarrier& barrier = bufferBarriers_[numBufferBarriers_++];
+    const std::uint32_t index = numBufferBarriers_++;
+    VkBufferMemoryBarrier& barrier = bufferBarriers_[index];
     {
         barrier.srcAccessMask   = srcAccessMask;
         barrier.dstAccessMask   = dstAccessMask;
@@ -80,15 +120,71 @@ void VKCommandContext::BufferMemoryBarrier(
         barrier.offset          = offset;
         barrier.size            = size;
     }
+    bufferBarrierStages_[index] = { srcStageMask, dstStageMask };
 
-    /* Initialize pipeline state flags */
-    srcStageMask_ |= VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-    dstStageMask_ |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+    /* Accumulate pipeline state flags */
+    srcStageMask_ |= srcStageMask;
+    dstStageMask_ |= dstStageMask;
+}
+
+void VKCommandContext::BufferMemoryBarrier(
+    VkBuffer        buffer,
+    VkDeviceSize    offset,
+    VkDeviceSize    size,
+    VkAccessFlags   srcAccessMask,
+    VkAccessFlags   dstAccessMask,
+    bool            flushImmediately)
+{
+    BufferMemoryBarrier(
+        buffer,
+        offset,
+        size,
+        VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+        srcAccessMask,
+        VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+        dstAccessMask
+    );
 
     if (flushImmediately)
         FlushBarriers();
 }
 
+void VKCommandContext::ImageMemoryBarrier(
+    VkImage                     image,
+    VkFormat                    format,
+    VkImageLayout               oldLayout,
+    VkImageLayout               newLayout,
+    const TextureSubresource&   subresource,
+    VkPipelineStageFlags        srcStageMask,
+    VkAccessFlags               srcAccessMask,
+    VkPipelineStageFlags        dstStageMask,
+    VkAccessFlags               dstAccessMask)
+{
+    if (numImageBarriers_ == maxNumBarriers)
+        FlushBarriers();
+
+    /* Initialize image memory barrier descriptor */
+    const std::uint32_t index = numImageBarriers_++;
+    VkImageMemoryBarrier& barrier = imageBarriers_[index];
+    {
+        barrier.srcAccessMask                   = srcAccessMask;
+        barrier.dstAccessMask                   = dstAccessMask;
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = newLayout;
+        barrier.image                           = image;
+        barrier.subresourceRange.aspectMask     = VKImageUtils::GetInclusiveVkImageAspect(format);
+        barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
+        barrier.subresourceRange.levelCount     = subresource.numMipLevels;
+        barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
+        barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
+    }
+    imageBarrierStages_[index] = { srcStageMask, dstStageMask };
+
+    /* Accumulate pipeline state flags */
+    srcStageMask_ |= srcStageMask;
+    dstStageMask_ |= dstStageMask;
+}
+
 void VKCommandContext::ImageMemoryBarrier(
     VkImage                     image,
     VkFormat                    format,
@@ -101,7 +197,8 @@ void VKCommandContext::ImageMemoryBarrier(
         FlushBarriers();
 
     /* Initialize image memory barrier descriptor */
-    VkImageMemoryBarrier& barrier = imageBarriers_[numImageBarriers_++];
+    const std::uint32_t index = numImageBarriers_++;
+    VkImageMemoryBarrier& barrier = imageBarriers_[index];
     {
         barrier.oldLayout                       = oldLayout;
         barrier.newLayout                       = newLayout;
@@ -131,12 +228,32 @@ void VKCommandContext::ImageMemoryBarrier(
         srcStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
         dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     }
+    #if VK_KHR_fragment_shading_rate
+    else if (newLayout == VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR)
+    {
+        /* Wait for any previous writes to the shading-rate image, e.g. by a compute shader or copy command */
+        barrier.srcAccessMask = VK_ACCESS_MEMORY_WRITE_BIT;
+        barrier.dstAccessMask = VK_ACCESS_FRAGMENT_SHADING_RATE_ATTACHMENT_READ_BIT_KHR;
+        srcStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+        dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
+    }
+    else if (oldLayout == VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR)
+    {
+        /* Shading-rate image is only read during rendering, so subsequent commands only have to wait for those reads */
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = 0;
+        srcStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
+        dstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    }
+    #endif // /VK_KHR_fragment_shading_rate
     else
     {
         barrier.srcAccessMask = 0;
         barrier.dstAccessMask = 0;
     }
 
+    imageBarrierStages_[index] = { srcStageMask, dstStageMask };
+
     srcStageMask_ |= srcStageMask;
     dstStageMask_ |= dstStageMask;
 
@@ -146,20 +263,32 @@ void VKCommandContext::ImageMemoryBarrier(
 
 void VKCommandContext::FlushBarriers()
 {
-    if (numMemoryBarriers_ > 0 || numBufferBarriers_ > 0 || numImageBarriers_ > 0)
+    if (HasPendingBarriers())
     {
-        vkCmdPipelineBarrier(
-            commandBuffer_,
-            srcStageMask_,
-            dstStageMask_,
-            0, // VkDependencyFlags
-            numMemoryBarriers_,
-            memoryBarriers_,
-            numBufferBarriers_,
-            bufferBarriers_,
-            numImageBarriers_,
-            imageBarriers_
-        );
+        #if VK_KHR_synchronization2
+        if (HasExtension(VKExt::KHR_synchronization2))
+        {
+            /* Submit barriers with per-barrier pipeline stages */
+            FlushBarriers2();
+        }
+        else
+        #endif // /VK_KHR_synchronization2
+        {
+            /* Submit barriers with accumulated pipeline stages */
+            vkCmdPipelineBarrier(
+                commandBuffer_,
+                srcStageMask_,
+                dstStageMask_,
+                0, // VkDependencyFlags
+                numMemoryBarriers_,
+                memoryBarriers_,
+                numBufferBarriers_,
+                bufferBarriers_,
+                numImageBarriers_,
+                imageBarriers_
+            );
+        }
+        LLGL_PROFILE_COUNTER_ADD(barriers, numMemoryBarriers_ + numBufferBarriers_ + numImageBarriers_);
         numMemoryBarriers_  = 0;
         numBufferBarriers_  = 0;
         numImageBarriers_   = 0;
@@ -168,6 +297,11 @@ void VKCommandContext::FlushBarriers()
     }
 }
 
+bool VKCommandContext::HasPendingBarriers() const
+{
+    return (numMemoryBarriers_ > 0 || numBufferBarriers_ > 0 || numImageBarriers_ > 0);
+}
+
 void VKCommandContext::CopyBuffer(
     VkBuffer        srcBuffer,
     VkBuffer        dstBuffer,
@@ -188,6 +322,15 @@ void VKCommandContext::CopyTexture(
     VKTexture&          srcTexture,
     VKTexture&          dstTexture,
     const VkImageCopy&  region)
+{
+    CopyTexture(srcTexture, dstTexture, 1, &region);
+}
+
+void VKCommandContext::CopyTexture(
+    VKTexture&          srcTexture,
+    VKTexture&          dstTexture,
+    std::uint32_t       numRegions,
+    const VkImageCopy*  regions)
 {
     vkCmdCopyImage(
         commandBuffer_,
@@ -195,8 +338,8 @@ void VKCommandContext::CopyTexture(
         VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
         dstTexture.GetVkImage(),
         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-        1,
-        &region
+        numRegions,
+        regions
     );
 }
 
@@ -248,11 +391,12 @@ void VKCommandContext::CopyBufferToImage(
     const VkExtent3D&           extent,
     const TextureSubresource&   subresource,
     std::uint32_t               rowLength,
-    std::uint32_t               imageHeight)
+    std::uint32_t               imageHeight,
+    VkDeviceSize                bufferOffset)
 {
     VkBufferImageCopy region;
     {
-        region.bufferOffset                     = 0;
+        region.bufferOffset                     = bufferOffset;
         region.bufferRowLength                  = rowLength;
         region.bufferImageHeight                = imageHeight;
         region.imageSubresource.aspectMask      = VKImageUtils::GetInclusiveVkImageAspect(format);
@@ -324,6 +468,9 @@ void VKCommandContext::GenerateMips(
     const VkExtent3D&           extent,
     const TextureSubresource&   subresource)
 {
+    if (subresource.numMipLevels < 2)
+        return;
+
     ImageMemoryBarrier(
         image,
         VK_FORMAT_UNDEFINED,
@@ -333,17 +480,19 @@ void VKCommandContext::GenerateMips(
         true
     );
 
-    /* Initialize image memory barrier */
-    VkImageMemoryBarrier barrier;
+    /* Initialize image memory barrier; all array layers are transitioned at once */
+    VkImageMemoryBarrier barriers[2];
 
     const VkImageAspectFlags aspectMask = VKImageUtils::GetInclusiveVkImageAspect(format);
 
+    VkImageMemoryBarrier& barrier = barriers[0];
+
     barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
     barrier.pNext                           = nullptr;
-    barrier.srcAccessMask                   = 0;
-    barrier.dstAccessMask                   = 0;
-    barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
-    barrier.newLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+    barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+    barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
     barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
     barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
     barrier.image                           = image;
@@ -351,101 +500,371 @@ void VKCommandContext::GenerateMips(
     barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel;
     barrier.subresourceRange.levelCount     = 1;
     barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer;
-    barrier.subresourceRange.layerCount     = 1;
+    barrier.subresourceRange.layerCount     = subresource.numArrayLayers;
+
+    /* Determine extent of base MIP level */
+    VkExtent3D currExtent;
+    {
+        currExtent.width    = std::max(1u, extent.width  >> subresource.baseMipLevel);
+        currExtent.height   = std::max(1u, extent.height >> subresource.baseMipLevel);
+        currExtent.depth    = std::max(1u, extent.depth  >> subresource.baseMipLevel);
+    }
 
-    /* Blit each MIP-map from previous (lower) MIP level */
-    for_range(arrayLayer, subresource.numArrayLayers)
+    /* Blit each MIP-map from previous (lower) MIP level for all array layers at once */
+    for_subrange(mipLevel, 1, subresource.numMipLevels)
     {
-        VkExtent3D currExtent = extent;
+        /* Determine extent of next MIP level */
+        VkExtent3D nextExtent = currExtent;
+
+        nextExtent.width    = std::max(1u, currExtent.width  / 2);
+        nextExtent.height   = std::max(1u, currExtent.height / 2);
+        nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
+
+        /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
+        barrier.subresourceRange.baseMipLevel = subresource.baseMipLevel + mipLevel - 1;
+
+        vkCmdPipelineBarrier(
+            commandBuffer_,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+            0, nullptr,
+            0, nullptr,
+            1, &barrier
+        );
+        LLGL_PROFILE_COUNTER_ADD(barriers, 1);
+
+        /* Blit previous MIP level into next higher MIP level (with smaller extent) */
+        VkImageBlit blit;
+
+        blit.srcSubresource.aspectMask      = aspectMask;
+        blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
+        blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.srcSubresource.layerCount      = subresource.numArrayLayers;
+        blit.srcOffsets[0]                  = { 0, 0, 0 };
+        blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
+        blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
+        blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
+        blit.dstSubresource.aspectMask      = aspectMask;
+        blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
+        blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer;
+        blit.dstSubresource.layerCount      = subresource.numArrayLayers;
+        blit.dstOffsets[0]                  = { 0, 0, 0 };
+        blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
+        blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
+        blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
+
+        vkCmdBlitImage(
+            commandBuffer_,
+            image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            1, &blit,
+            VK_FILTER_LINEAR
+        );
+
+        /* Reduce image extent to next MIP level */
+        currExtent = nextExtent;
+    }
 
-        for_subrange(mipLevel, 1, subresource.numMipLevels)
+    /*
+    Transition all source MIP levels and the last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL with a single command.
+    The source levels are all in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL while the last one is still in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL.
+    */
+    barriers[1] = barrier;
+
+    barriers[0].srcAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+    barriers[0].dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+    barriers[0].oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[0].subresourceRange.baseMipLevel   = subresource.baseMipLevel;
+    barriers[0].subresourceRange.levelCount     = subresource.numMipLevels - 1;
+
+    barriers[1].srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barriers[1].dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
+    barriers[1].oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[1].newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    barriers[1].subresourceRange.baseMipLevel   = subresource.baseMipLevel + subresource.numMipLevels - 1;
+    barriers[1].subresourceRange.levelCount     = 1;
+
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        2, barriers
+    );
+    LLGL_PROFILE_COUNTER_ADD(barriers, 2);
+}
+
+// Returns the extent of the specified MIP-map level.
+static VkExtent3D GetMipVkExtent(const VkExtent3D& extent, std::uint32_t mipLevel)
+{
+    return VkExtent3D
+    {
+        std::max(1u, extent.width  >> mipLevel),
+        std::max(1u, extent.height >> mipLevel),
+        std::max(1u, extent.depth  >> mipLevel),
+    };
+}
+
+static VkImageMemoryBarrier GetMipLevelVkImageBarrier(
+    const VKMipChainImage&  image,
+    VkAccessFlags           srcAccessMask,
+    VkAccessFlags           dstAccessMask,
+    VkImageLayout           oldLayout,
+    VkImageLayout           newLayout,
+    std::uint32_t           baseMipLevel,
+    std::uint32_t           numMipLevels)
+{
+    VkImageMemoryBarrier barrier;
+    {
+        barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        barrier.pNext                           = nullptr;
+        barrier.srcAccessMask                   = srcAccessMask;
+        barrier.dstAccessMask                   = dstAccessMask;
+        barrier.oldLayout                       = oldLayout;
+        barrier.newLayout                       = newLayout;
+        barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image                           = image.image;
+        barrier.subresourceRange.aspectMask     = VKImageUtils::GetInclusiveVkImageAspect(image.format);
+        barrier.subresourceRange.baseMipLevel   = baseMipLevel;
+        barrier.subresourceRange.levelCount     = numMipLevels;
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount     = image.numArrayLayers;
+    }
+    return barrier;
+}
+
+void VKCommandContext::GenerateMips(std::uint32_t numImages, const VKMipChainImage* images)
+{
+    /* Transition the MIP chains of all images to VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL; these barriers are accumulated and flushed together */
+    std::uint32_t maxNumMipLevels = 0;
+
+    for_range(i, numImages)
+    {
+        const VKMipChainImage& image = images[i];
+        if (image.numMipLevels < 2)
+            continue;
+
+        ImageMemoryBarrier(
+            image.image,
+            image.format,
+            VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+            TextureSubresource{ 0, image.numArrayLayers, 0, image.numMipLevels }
+        );
+        maxNumMipLevels = std::max(maxNumMipLevels, image.numMipLevels);
+    }
+
+    if (maxNumMipLevels < 2)
+        return;
+
+    FlushBarriers();
+
+    SmallVector<VkImageMemoryBarrier> mipBarriers;
+    mipBarriers.reserve(numImages * 2);
+
+    /* Blit each MIP-map level of all images from their previous (lower) MIP level */
+    for_subrange(mipLevel, 1u, maxNumMipLevels)
+    {
+        /* Transition previous MIP level of all images that have this level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL with a single barrier command */
+        mipBarriers.clear();
+        for_range(i, numImages)
         {
-            /* Determine extent of next MIP level */
-            VkExtent3D nextExtent = currExtent;
+            const VKMipChainImage& image = images[i];
+            if (mipLevel < image.numMipLevels)
+            {
+                mipBarriers.push_back(
+                    GetMipLevelVkImageBarrier(
+                        image,
+                        VK_ACCESS_TRANSFER_WRITE_BIT,
+                        VK_ACCESS_TRANSFER_READ_BIT,
+                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                        mipLevel - 1,
+                        1
+                    )
+                );
+            }
+        }
 
-            nextExtent.width    = std::max(1u, currExtent.width  / 2);
-            nextExtent.height   = std::max(1u, currExtent.height / 2);
-            nextExtent.depth    = std::max(1u, currExtent.depth  / 2);
+        vkCmdPipelineBarrier(
+            commandBuffer_,
+            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+            0, nullptr,
+            0, nullptr,
+            static_cast<std::uint32_t>(mipBarriers.size()), mipBarriers.data()
+        );
+        LLGL_PROFILE_COUNTER_ADD(barriers, mipBarriers.size());
 
-            /* Transition previous MIP level to VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL */
-            barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-            barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-            barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.subresourceRange.baseMipLevel   = subresource.baseMipLevel + mipLevel - 1;
-            barrier.subresourceRange.baseArrayLayer = subresource.baseArrayLayer + arrayLayer;
+        /* Blit previous MIP level into next higher MIP level (with smaller extent) for all array layers at once */
+        for_range(i, numImages)
+        {
+            const VKMipChainImage& image = images[i];
+            if (mipLevel >= image.numMipLevels)
+                continue;
 
-            vkCmdPipelineBarrier(
-                commandBuffer_,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
+            const VkImageAspectFlags    aspectMask  = VKImageUtils::GetInclusiveVkImageAspect(image.format);
+            const VkExtent3D            srcExtent   = GetMipVkExtent(image.extent, mipLevel - 1);
+            const VkExtent3D            dstExtent   = GetMipVkExtent(image.extent, mipLevel);
 
-            /* Blit previous MIP level into next higher MIP level (with smaller extent) */
             VkImageBlit blit;
 
             blit.srcSubresource.aspectMask      = aspectMask;
-            blit.srcSubresource.mipLevel        = subresource.baseMipLevel + mipLevel - 1;
-            blit.srcSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.srcSubresource.layerCount      = 1;
+            blit.srcSubresource.mipLevel        = mipLevel - 1;
+            blit.srcSubresource.baseArrayLayer  = 0;
+            blit.srcSubresource.layerCount      = image.numArrayLayers;
             blit.srcOffsets[0]                  = { 0, 0, 0 };
-            blit.srcOffsets[1].x                = static_cast<std::int32_t>(currExtent.width);
-            blit.srcOffsets[1].y                = static_cast<std::int32_t>(currExtent.height);
-            blit.srcOffsets[1].z                = static_cast<std::int32_t>(currExtent.depth);
+            blit.srcOffsets[1].x                = static_cast<std::int32_t>(srcExtent.width);
+            blit.srcOffsets[1].y                = static_cast<std::int32_t>(srcExtent.height);
+            blit.srcOffsets[1].z                = static_cast<std::int32_t>(srcExtent.depth);
             blit.dstSubresource.aspectMask      = aspectMask;
-            blit.dstSubresource.mipLevel        = subresource.baseMipLevel + mipLevel;
-            blit.dstSubresource.baseArrayLayer  = subresource.baseArrayLayer + arrayLayer;
-            blit.dstSubresource.layerCount      = 1;
+            blit.dstSubresource.mipLevel        = mipLevel;
+            blit.dstSubresource.baseArrayLayer  = 0;
+            blit.dstSubresource.layerCount      = image.numArrayLayers;
             blit.dstOffsets[0]                  = { 0, 0, 0 };
-            blit.dstOffsets[1].x                = static_cast<std::int32_t>(nextExtent.width);
-            blit.dstOffsets[1].y                = static_cast<std::int32_t>(nextExtent.height);
-            blit.dstOffsets[1].z                = static_cast<std::int32_t>(nextExtent.depth);
+            blit.dstOffsets[1].x                = static_cast<std::int32_t>(dstExtent.width);
+            blit.dstOffsets[1].y                = static_cast<std::int32_t>(dstExtent.height);
+            blit.dstOffsets[1].z                = static_cast<std::int32_t>(dstExtent.depth);
 
             vkCmdBlitImage(
                 commandBuffer_,
-                image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-                image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                image.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                image.image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
                 1, &blit,
                 VK_FILTER_LINEAR
             );
+        }
+    }
 
-            /* Transition previous MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-            barrier.srcAccessMask   = VK_ACCESS_TRANSFER_READ_BIT;
-            barrier.dstAccessMask   = VK_ACCESS_SHADER_READ_BIT;
-            barrier.oldLayout       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
-            barrier.newLayout       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    /*
+    Transition all source MIP levels and the last MIP level of all images back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL with a single command.
+    The source levels are all in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL while the last one is still in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL.
+    */
+    mipBarriers.clear();
+    for_range(i, numImages)
+    {
+        const VKMipChainImage& image = images[i];
+        if (image.numMipLevels < 2)
+            continue;
+
+        mipBarriers.push_back(
+            GetMipLevelVkImageBarrier(
+                image,
+                VK_ACCESS_TRANSFER_READ_BIT,
+                VK_ACCESS_SHADER_READ_BIT,
+                VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                0,
+                image.numMipLevels - 1
+            )
+        );
+        mipBarriers.push_back(
+            GetMipLevelVkImageBarrier(
+                image,
+                VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_ACCESS_SHADER_READ_BIT,
+                VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                image.numMipLevels - 1,
+                1
+            )
+        );
+    }
 
-            vkCmdPipelineBarrier(
-                commandBuffer_,
-                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-                0, nullptr,
-                0, nullptr,
-                1, &barrier
-            );
+    vkCmdPipelineBarrier(
+        commandBuffer_,
+        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0,
+        0, nullptr,
+        0, nullptr,
+        static_cast<std::uint32_t>(mipBarriers.size()), mipBarriers.data()
+    );
+    LLGL_PROFILE_COUNTER_ADD(barriers, mipBarriers.size());
+}
+
+
+
+/*
+ * ======= Private: =======
+ */
+
+#if VK_KHR_synchronization2
+
+void VKCommandContext::FlushBarriers2()
+{
+    /* Convert barriers into synchronization2 structures with per-barrier pipeline stages */
+    VkMemoryBarrier2KHR         memoryBarriers2[maxNumBarriers];
+    VkBufferMemoryBarrier2KHR   bufferBarriers2[maxNumBarriers];
+    VkImageMemoryBarrier2KHR    imageBarriers2[maxNumBarriers];
 
-            /* Reduce image extent to next MIP level */
-            currExtent = nextExtent;
+    for_range(i, numMemoryBarriers_)
+    {
+        const VkMemoryBarrier& src = memoryBarriers_[i];
+        VkMemoryBarrier2KHR& dst = memoryBarriers2[i];
+        {
+            dst.sType                   = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2_KHR;
+            dst.pNext                   = nullptr;
+            dst.srcStageMask            = memoryBarrierStages_[i].src;
+            dst.srcAccessMask           = src.srcAccessMask;
+            dst.dstStageMask            = memoryBarrierStages_[i].dst;
+            dst.dstAccessMask           = src.dstAccessMask;
         }
+    }
 
-        /* Transition last MIP level back to VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL */
-        barrier.srcAccessMask                   = VK_ACCESS_TRANSFER_WRITE_BIT;
-        barrier.dstAccessMask                   = VK_ACCESS_SHADER_READ_BIT;
-        barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-        barrier.newLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-        barrier.subresourceRange.baseMipLevel   = subresource.numMipLevels - 1;
+    for_range(i, numBufferBarriers_)
+    {
+        const VkBufferMemoryBarrier& src = bufferBarriers_[i];
+        VkBufferMemoryBarrier2KHR& dst = bufferBarriers2[i];
+        {
+            dst.sType                   = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2_KHR;
+            dst.pNext                   = nullptr;
+            dst.srcStageMask            = bufferBarrierStages_[i].src;
+            dst.srcAccessMask           = src.srcAccessMask;
+            dst.dstStageMask            = bufferBarrierStages_[i].dst;
+            dst.dstAccessMask           = src.dstAccessMask;
+            dst.srcQueueFamilyIndex     = src.srcQueueFamilyIndex;
+            dst.dstQueueFamilyIndex     = src.dstQueueFamilyIndex;
+            dst.buffer                  = src.buffer;
+            dst.offset                  = src.offset;
+            dst.size                    = src.size;
+        }
+    }
 
-        vkCmdPipelineBarrier(
-            commandBuffer_,
-            VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0,
-            0, nullptr,
-            0, nullptr,
-            1, &barrier
-        );
+    for_range(i, numImageBarriers_)
+    {
+        const VkImageMemoryBarrier& src = imageBarriers_[i];
+        VkImageMemoryBarrier2KHR& dst = imageBarriers2[i];
+        {
+            dst.sType                   = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2_KHR;
+            dst.pNext                   = nullptr;
+            dst.srcStageMask            = imageBarrierStages_[i].src;
+            dst.srcAccessMask           = src.srcAccessMask;
+            dst.dstStageMask            = imageBarrierStages_[i].dst;
+            dst.dstAccessMask           = src.dstAccessMask;
+            dst.oldLayout               = src.oldLayout;
+            dst.newLayout               = src.newLayout;
+            dst.srcQueueFamilyIndex     = src.srcQueueFamilyIndex;
+            dst.dstQueueFamilyIndex     = src.dstQueueFamilyIndex;
+            dst.image                   = src.image;
+            dst.subresourceRange        = src.subresourceRange;
+        }
+    }
+
+    VkDependencyInfoKHR dependencyInfo;
+    {
+        dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO_KHR;
+        dependencyInfo.pNext                    = nullptr;
+        dependencyInfo.dependencyFlags          = 0;
+        dependencyInfo.memoryBarrierCount       = numMemoryBarriers_;
+        dependencyInfo.pMemoryBarriers          = memoryBarriers2;
+        dependencyInfo.bufferMemoryBarrierCount = numBufferBarriers_;
+        dependencyInfo.pBufferMemoryBarriers    = bufferBarriers2;
+        dependencyInfo.imageMemoryBarrierCount  = numImageBarriers_;
+        dependencyInfo.pImageMemoryBarriers     = imageBarriers2;
     }
+    vkCmdPipelineBarrier2KHR(commandBuffer_, &dependencyInfo);
 }
 
+#endif // /VK_KHR_synchronization2
 
 } // /namespace LLGL
 
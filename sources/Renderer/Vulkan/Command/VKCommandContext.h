@@ -23,6 +23,16 @@ struct TextureSubresource;
 class VKBuffer;
 class VKTexture;
 
+// Image whose entire MIP chain is generated with a batch of other images. See VKCommandContext::GenerateMips(std::uint32_t, const VKMipChainImage*).
+struct VKMipChainImage
+{
+    VkImage         image;
+    VkFormat        format;
+    VkExtent3D      extent;
+    std::uint32_t   numMipLevels;
+    std::uint32_t   numArrayLayers;
+};
+
 class VKCommandContext
 {
 
@@ -36,6 +46,25 @@ class VKCommandContext
 
         /* --- Memory barriers --- */
 
+        // Appends a global memory barrier. Access masks are merged into a pending global memory barrier with the same pipeline stages.
+        void GlobalMemoryBarrier(
+            VkPipelineStageFlags        srcStageMask,
+            VkAccessFlags               srcAccessMask,
+            VkPipelineStageFlags        dstStageMask,
+            VkAccessFlags               dstAccessMask
+        );
+
+        // Appends a buffer memory barrier with explicit pipeline stages. The barrier is deferred until FlushBarriers() is called.
+        void BufferMemoryBarrier(
+            VkBuffer                    buffer,
+            VkDeviceSize                offset,
+            VkDeviceSize                size,
+            VkPipelineStageFlags        srcStageMask,
+            VkAccessFlags               srcAccessMask,
+            VkPipelineStageFlags        dstStageMask,
+            VkAccessFlags               dstAccessMask
+        );
+
         void BufferMemoryBarrier(
             VkBuffer                    buffer,
             VkDeviceSize                offset,
@@ -45,6 +74,19 @@ class VKCommandContext
             bool                        flushImmediately    = false
         );
 
+        // Appends an image memory barrier with explicit pipeline stages. The barrier is deferred until FlushBarriers() is called.
+        void ImageMemoryBarrier(
+            VkImage                     image,
+            VkFormat                    format,
+            VkImageLayout               oldLayout,
+            VkImageLayout               newLayout,
+            const TextureSubresource&   subresource,
+            VkPipelineStageFlags        srcStageMask,
+            VkAccessFlags               srcAccessMask,
+            VkPipelineStageFlags        dstStageMask,
+            VkAccessFlags               dstAccessMask
+        );
+
         void ImageMemoryBarrier(
             VkImage                     image,
             VkFormat                    format,
@@ -54,9 +96,12 @@ class VKCommandContext
             bool                        flushImmediately    = false
         );
 
-        // Submits this pipeline barrier into the current command buffer.
+        // Submits all pending barriers into the current command buffer with a single pipeline barrier command.
         void FlushBarriers();
 
+        // Returns true if there are any barriers that have not been flushed yet.
+        bool HasPendingBarriers() const;
+
         /* --- Resource operations --- */
 
         void CopyBuffer(
@@ -73,6 +118,13 @@ class VKCommandContext
             const VkImageCopy&  region
         );
 
+        void CopyTexture(
+            VKTexture&          srcTexture,
+            VKTexture&          dstTexture,
+            std::uint32_t       numRegions,
+            const VkImageCopy*  regions
+        );
+
         void CopyImage(
             VkImage             srcImage,
             VkImageLayout       srcImageLayout,
@@ -100,7 +152,8 @@ class VKCommandContext
             const VkExtent3D&           extent,
             const TextureSubresource&   subresource,
             std::uint32_t               rowLength       = 0,
-            std::uint32_t               imageHeight     = 0
+            std::uint32_t               imageHeight     = 0,
+            VkDeviceSize                bufferOffset    = 0
         );
 
         void CopyBufferToImage(
@@ -132,9 +185,28 @@ class VKCommandContext
             const TextureSubresource&   subresource
         );
 
+        /*
+        Generates the entire MIP chains of all specified images, which must be in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL layout.
+        The same MIP-map level of all images is blitted between a single pipeline barrier, so the number of barriers does not grow with the number of images.
+        */
+        void GenerateMips(std::uint32_t numImages, const VKMipChainImage* images);
+
     private:
 
-        static constexpr std::uint32_t maxNumBarriers = 4;
+        static constexpr std::uint32_t maxNumBarriers = 8;
+
+        struct BarrierStageMasks
+        {
+            VkPipelineStageFlags src;
+            VkPipelineStageFlags dst;
+        };
+
+    private:
+
+        #if VK_KHR_synchronization2
+        // Submits all pending barriers with vkCmdPipelineBarrier2KHR and per-barrier pipeline stages.
+        void FlushBarriers2();
+        #endif
 
     private:
 
@@ -151,6 +223,10 @@ class VKCommandContext
         VkBufferMemoryBarrier   bufferBarriers_[maxNumBarriers];
         VkImageMemoryBarrier    imageBarriers_[maxNumBarriers];
 
+        BarrierStageMasks       memoryBarrierStages_[maxNumBarriers];
+        BarrierStageMasks       bufferBarrierStages_[maxNumBarriers];
+        BarrierStageMasks       imageBarrierStages_[maxNumBarriers];
+
 };
 
 
@@ -9,8 +9,19 @@
 #include "VKCommandBuffer.h"
 #include "../RenderState/VKFence.h"
 #include "../RenderState/VKQueryHeap.h"
+#include "../Texture/VKTexture.h"
+#include "../Buffer/VKStagingBufferPool.h"
 #include "../VKCore.h"
+#include "../VKDevice.h"
+#include "../VKSwapChain.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../CheckedCast.h"
+#include "../../FrameArena.h"
+#include "../../SubmissionThread.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
+#include <algorithm>
+#include <limits.h>
 
 
 namespace LLGL
@@ -34,28 +45,271 @@ VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuff
     return vkQueueSubmit(commandQueue, 1, &submitInfo, fence);
 }
 
-VKCommandQueue::VKCommandQueue(VkDevice device, VkQueue queue) :
-    device_ { device },
-    native_ { queue  }
+VKCommandQueue::VKCommandQueue(VKDevice& device, VkQueue queue, VKStagingBufferPool& stagingBufferPool, float timestampPeriod, bool isPrimaryQueue) :
+    device_            { device                        },
+    native_            { queue                         },
+    queueMutex_        { device.GetQueueMutex(queue)   },
+    stagingBufferPool_ { stagingBufferPool             },
+    timestampPeriod_   { timestampPeriod               },
+    isPrimaryQueue_    { isPrimaryQueue                },
+    sparseSemaphore_   { device, vkDestroySemaphore    },
+    submitWaitFence_   { device, vkDestroyFence        }
 {
 }
 
+void VKCommandQueue::SubmitCommandBuffer(VKCommandBuffer& commandBufferVK)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    /* Submit batched buffer uploads first, so the command buffer observes all previous calls to RenderSystem::WriteBuffer */
+    FlushStagingBuffers();
+
+    VkCommandBuffer commandBuffer = commandBufferVK.GetVkCommandBuffer();
+    VkFence fence = commandBufferVK.GetQueueSubmitFenceAndFlush();
+    VkResult result = SubmitBatches(1, &commandBuffer, fence);
+    VKThrowIfFailed(result, "failed to submit command buffer to Vulkan queue");
+
+    /* Multi-submit command buffers only signal their recording fence with the first submission */
+    commandBufferVK.NotifySubmitted(*this, submitCount_, /*signalsRecordingFence:*/ (fence != VK_NULL_HANDLE));
+}
+
+// Creates the specified binary semaphore if it has not been created yet.
+static void GetOrCreateBinarySemaphore(VkDevice device, VKPtr<VkSemaphore>& semaphore)
+{
+    if (semaphore.Get() == VK_NULL_HANDLE)
+    {
+        VkSemaphoreCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateSemaphore(device, &createInfo, nullptr, semaphore.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan semaphore for sparse binding");
+    }
+}
+
+void VKCommandQueue::BindSparseMemory(
+    std::uint32_t                               numOpaqueBinds,
+    const VkSparseImageOpaqueMemoryBindInfo*    opaqueBinds,
+    std::uint32_t                               numImageBinds,
+    const VkSparseImageMemoryBindInfo*          imageBinds)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    /* Submit pending staging transfers first, so they are not affected by tiles that are unbound here */
+    FlushStagingBuffers();
+
+    /*
+    Signal one semaphore for the next command buffer submission on this queue and one for the next staging submission.
+    Binary semaphores must be unsignaled before they can be signaled again, so consume previous signals that have not been waited on yet.
+    */
+    GetOrCreateBinarySemaphore(device_, sparseSemaphore_);
+
+    VkSemaphore signalSemaphores[2] = { sparseSemaphore_.Get(), stagingBufferPool_.GetOrCreateWaitSemaphore() };
+    VkSemaphore waitSemaphores[2];
+    std::uint32_t numWaitSemaphores = 0;
+
+    if (isSparseSignalPending_)
+        waitSemaphores[numWaitSemaphores++] = signalSemaphores[0];
+    if (stagingBufferPool_.SignalWaitSemaphore())
+        waitSemaphores[numWaitSemaphores++] = signalSemaphores[1];
+
+    VkBindSparseInfo bindInfo;
+    {
+        bindInfo.sType                  = VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+        bindInfo.pNext                  = nullptr;
+        bindInfo.waitSemaphoreCount     = numWaitSemaphores;
+        bindInfo.pWaitSemaphores        = waitSemaphores;
+        bindInfo.bufferBindCount        = 0;
+        bindInfo.pBufferBinds           = nullptr;
+        bindInfo.imageOpaqueBindCount   = numOpaqueBinds;
+        bindInfo.pImageOpaqueBinds      = opaqueBinds;
+        bindInfo.imageBindCount         = numImageBinds;
+        bindInfo.pImageBinds            = imageBinds;
+        bindInfo.signalSemaphoreCount   = 2;
+        bindInfo.pSignalSemaphores      = signalSemaphores;
+    }
+    VkResult result = vkQueueBindSparse(native_, 1, &bindInfo, VK_NULL_HANDLE);
+    VKThrowIfFailed(result, "failed to bind sparse memory on Vulkan queue");
+    ++submitCount_;
+
+    /* Let the next command buffer submission wait for the sparse binding; a pending signal is already in the list of wait semaphores */
+    if (!isSparseSignalPending_)
+    {
+        EnqueueWaitSemaphore(sparseSemaphore_);
+        isSparseSignalPending_ = true;
+    }
+}
+
+void VKCommandQueue::FlushDeferredSignals()
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    if (!signalSemaphores_.empty())
+    {
+        VkResult result = SubmitBatches(0, nullptr, VK_NULL_HANDLE);
+        VKThrowIfFailed(result, "failed to submit deferred fence signals to Vulkan queue");
+    }
+}
+
+void VKCommandQueue::SetSubmissionThread(SubmissionThread* submissionThread)
+{
+    submissionThread_ = submissionThread;
+}
+
+std::uint64_t VKCommandQueue::GetSubmitCount() const
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    return submitCount_;
+}
+
+void VKCommandQueue::WaitForSubmit(std::uint64_t submitID)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    if (submitID <= completedSubmitCount_)
+        return;
+
+    if (submitWaitFence_.Get() == VK_NULL_HANDLE)
+    {
+        VkFenceCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateFence(device_, &createInfo, nullptr, submitWaitFence_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence to wait for queue submission");
+    }
+
+    /* Submit a fence without command buffers, which is signaled once all previous submissions on this queue have completed */
+    VkResult result = SubmitBatches(0, nullptr, submitWaitFence_.Get());
+    VKThrowIfFailed(result, "failed to submit wait fence to Vulkan queue");
+
+    const std::uint64_t fenceSubmitID = submitCount_;
+    vkWaitForFences(device_, 1, submitWaitFence_.GetAddressOf(), VK_TRUE, UINT64_MAX);
+    vkResetFences(device_, 1, submitWaitFence_.GetAddressOf());
+
+    NotifySubmitCompleted(fenceSubmitID);
+}
+
+void VKCommandQueue::NotifySubmitCompleted(std::uint64_t submitID)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    completedSubmitCount_ = std::max(completedSubmitCount_, submitID);
+}
+
+void VKCommandQueue::SubmitReleaseFence(VkFence fence)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    VkResult result = SubmitBatches(0, nullptr, fence);
+    VKThrowIfFailed(result, "failed to submit release fence to Vulkan queue");
+}
+
 /* ----- Command Buffers ----- */
 
 void VKCommandQueue::Submit(CommandBuffer& commandBuffer)
 {
     auto& commandBufferVK = LLGL_CAST(VKCommandBuffer&, commandBuffer);
     if (!commandBufferVK.IsImmediateCmdBuffer())
+        SubmitCommandBuffer(commandBufferVK);
+}
+
+void VKCommandQueue::Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    /* Gather all deferred command buffers to submit them with a single call to vkQueueSubmit */
+    FrameSmallVector<VKCommandBuffer*> cmdBuffersVK;
+    cmdBuffersVK.reserve(numCommandBuffers);
+
+    for_range(i, numCommandBuffers)
     {
-        VkResult result = VKSubmitCommandBuffer(
-            native_,
-            commandBufferVK.GetVkCommandBuffer(),
-            commandBufferVK.GetQueueSubmitFenceAndFlush()
-        );
-        VKThrowIfFailed(result, "failed to submit command buffer to Vulkan graphics queue");
+        if (commandBuffers[i] != nullptr)
+        {
+            auto* cmdBufferVK = LLGL_CAST(VKCommandBuffer*, commandBuffers[i]);
+            if (!cmdBufferVK->IsImmediateCmdBuffer())
+                cmdBuffersVK.push_back(cmdBufferVK);
+        }
+    }
+
+    if (cmdBuffersVK.empty())
+        return;
+
+    if (cmdBuffersVK.size() == 1)
+    {
+        /* Signal the command buffer's own fence if there is nothing to batch */
+        SubmitCommandBuffer(*cmdBuffersVK.front());
+        return;
+    }
+
+    /* Submit batched buffer uploads first, so the command buffers observe all previous calls to RenderSystem::WriteBuffer */
+    FlushStagingBuffers();
+
+    submitBatchCmdBuffers_.clear();
+    for (VKCommandBuffer* cmdBufferVK : cmdBuffersVK)
+        submitBatchCmdBuffers_.push_back(cmdBufferVK->GetVkCommandBuffer());
+
+    /*
+    A submission can only signal a single fence, so all command buffers of this batch share a fence of this queue.
+    Their own recording fences are not signaled and they wait for this batch before they are recorded again.
+    */
+    std::uint64_t batchID = 0;
+    VkFence batchFence = AcquireSubmitBatchFence(batchID);
+
+    VkResult result = SubmitBatches(static_cast<std::uint32_t>(submitBatchCmdBuffers_.size()), submitBatchCmdBuffers_.data(), batchFence);
+    VKThrowIfFailed(result, "failed to submit command buffers to Vulkan queue");
+
+    for (VKCommandBuffer* cmdBufferVK : cmdBuffersVK)
+    {
+        cmdBufferVK->FlushQueueSubmitFenceForBatch(batchID);
+        cmdBufferVK->NotifySubmitted(*this, submitCount_, /*signalsRecordingFence:*/ true);
     }
 }
 
+void VKCommandQueue::Present(std::uint32_t numSwapChains, SwapChain* const * swapChains)
+{
+    /*
+    Gather consecutive swap-chains that share the same present queue to present them with a single call to vkQueuePresentKHR.
+    A swap-chain can only be presented once per batch, so its next occurrence in the array starts a new batch to preserve the order.
+    */
+    FrameSmallVector<VKSwapChain*> batch;
+    batch.reserve(numSwapChains);
+
+    for_range(i, numSwapChains)
+    {
+        if (swapChains[i] == nullptr)
+            continue;
+
+        auto* swapChainVK = LLGL_CAST(VKSwapChain*, swapChains[i]);
+        if (!batch.empty())
+        {
+            const bool isDuplicate = (std::find(batch.begin(), batch.end(), swapChainVK) != batch.end());
+            if (isDuplicate || !swapChainVK->IsPresentBatchCompatible(*batch.front()))
+            {
+                VKSwapChain::PresentBatch(static_cast<std::uint32_t>(batch.size()), batch.data());
+                batch.clear();
+            }
+        }
+        batch.push_back(swapChainVK);
+    }
+
+    if (!batch.empty())
+        VKSwapChain::PresentBatch(static_cast<std::uint32_t>(batch.size()), batch.data());
+}
+
+void VKCommandQueue::WaitForSubmitBatch(std::uint64_t batchID)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    /* If the fence has already been acquired by a newer batch, this batch has been waited on before */
+    SubmitBatchFence& batchFence = submitBatchFences_[batchID % numSubmitBatchFences];
+    if (batchFence.batchID == batchID)
+        vkWaitForFences(device_, 1, batchFence.fence.GetAddressOf(), VK_TRUE, UINT64_MAX);
+}
+
 /* ----- Queries ----- */
 
 bool VKCommandQueue::QueryResult(
@@ -74,6 +328,17 @@ bool VKCommandQueue::QueryResult(
 
     VKThrowIfFailed(stateResult, "failed to retrieve results from Vulkan query pool");
 
+    /* Convert timestamp ticks to nanoseconds */
+    if (queryHeapVK.GetType() == QueryType::Timestamp && timestampPeriod_ != 1.0f)
+    {
+        if (dataSize == numQueries * sizeof(std::uint64_t))
+        {
+            auto* timestamps = static_cast<std::uint64_t*>(data);
+            for_range(i, numQueries)
+                timestamps[i] = static_cast<std::uint64_t>(static_cast<double>(timestamps[i]) * timestampPeriod_ + 0.5);
+        }
+    }
+
     return true;
 }
 
@@ -102,20 +367,116 @@ bool VKCommandBuffer::QueryPipelineStatisticsResult(QueryHeap& queryHeap, QueryP
 
 void VKCommandQueue::Submit(Fence& fence)
 {
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
-    fenceVK.Reset(device_);
-    vkQueueSubmit(native_, 0, nullptr, fenceVK.GetVkFence());
+    FlushStagingBuffers();
+    if (fenceVK.IsTimeline())
+        DeferTimelineSignal(fenceVK);
+    else
+        SubmitBinaryFence(fenceVK);
+}
+
+void VKCommandQueue::SubmitWait(Fence& fence)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (fenceVK.IsTimeline())
+    {
+        if (!fenceVK.HasBeenSubmitted())
+            return;
+
+        /* Submit the signal operation on the other queue first, so the wait operation can't be submitted before its signal */
+        VKCommandQueue* deferredSignalQueue = fenceVK.GetDeferredSignalQueue();
+        if (deferredSignalQueue != nullptr && deferredSignalQueue != this)
+            deferredSignalQueue->FlushDeferredSignals();
+
+        /* Timeline semaphores can be waited on by any number of queues */
+        EnqueueWaitSemaphore(fenceVK.GetVkSemaphore(), fenceVK.GetTimelineValue());
+    }
+    else if (fenceVK.ConsumeSemaphore())
+    {
+        /* Let the next submission on this queue wait for the fence on the GPU */
+        EnqueueWaitSemaphore(fenceVK.GetOrCreateVkSemaphore(device_));
+    }
+    else if (fenceVK.HasBeenSubmitted())
+    {
+        /* Semaphore signal has already been consumed by another queue, so fall back to waiting on the CPU */
+        fenceVK.Wait(device_, ULLONG_MAX);
+    }
+}
+
+void VKCommandQueue::UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings)
+{
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    struct ImageBindRange
+    {
+        VkImage         image;
+        std::size_t     first;
+        std::uint32_t   count;
+    };
+
+    std::vector<VkSparseImageMemoryBind>    binds;
+    std::vector<ImageBindRange>             bindRanges;
+
+    /* Gather binds of all tiles whose residency changes; each mapping refers to a single subresource */
+    for_range(i, numMappings)
+    {
+        const TileMappingDescriptor& mapping = mappings[i];
+        if (mapping.texture == nullptr)
+            continue;
+
+        auto& textureVK = LLGL_CAST(VKTexture&, *mapping.texture);
+        VKSparseImageMemory* sparseMemory = textureVK.GetSparseMemory();
+        if (sparseMemory == nullptr)
+            continue;
+
+        const Extent3D      mipExtent   = textureVK.GetMipExtent(mapping.mipLevel);
+        const std::size_t   first       = binds.size();
+
+        sparseMemory->BindTiles(mapping, VkExtent3D{ mipExtent.width, mipExtent.height, 1u }, binds);
+
+        if (binds.size() > first)
+            bindRanges.push_back(ImageBindRange{ sparseMemory->GetVkImage(), first, static_cast<std::uint32_t>(binds.size() - first) });
+    }
+
+    if (bindRanges.empty())
+        return;
+
+    /* Convert bind ranges into bind infos once the container of binds is no longer resized */
+    std::vector<VkSparseImageMemoryBindInfo> bindInfos(bindRanges.size());
+    for_range(i, bindRanges.size())
+    {
+        bindInfos[i].image      = bindRanges[i].image;
+        bindInfos[i].bindCount  = bindRanges[i].count;
+        bindInfos[i].pBinds     = &(binds[bindRanges[i].first]);
+    }
+
+    BindSparseMemory(0, nullptr, static_cast<std::uint32_t>(bindInfos.size()), bindInfos.data());
 }
 
 bool VKCommandQueue::WaitFence(Fence& fence, std::uint64_t timeout)
 {
     auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (VKCommandQueue* deferredSignalQueue = fenceVK.GetDeferredSignalQueue())
+        deferredSignalQueue->FlushDeferredSignals();
     return fenceVK.Wait(device_, timeout);
 }
 
 void VKCommandQueue::WaitIdle()
 {
+    /* Presentations that are still pending on the submission thread must be submitted first */
+    if (submissionThread_ != nullptr)
+        submissionThread_->Flush();
+
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+
+    FlushDeferredSignals();
+    stagingBufferPool_.FlushAndWait();
     vkQueueWaitIdle(native_);
+    completedSubmitCount_ = submitCount_;
 }
 
 
@@ -123,6 +484,207 @@ void VKCommandQueue::WaitIdle()
  * ======= Private: =======
  */
 
+VkFence VKCommandQueue::AcquireSubmitBatchFence(std::uint64_t& outBatchID)
+{
+    /* Batch IDs start at 1, since 0 denotes a command buffer that was not submitted in a batch */
+    outBatchID = ++nextSubmitBatchID_;
+
+    if (submitBatchFences_.empty())
+        submitBatchFences_.resize(numSubmitBatchFences);
+
+    SubmitBatchFence& batchFence = submitBatchFences_[outBatchID % numSubmitBatchFences];
+    if (batchFence.fence.Get() == VK_NULL_HANDLE)
+    {
+        VkFenceCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        batchFence.fence = VKPtr<VkFence>{ device_, vkDestroyFence };
+        VkResult result = vkCreateFence(device_, &createInfo, nullptr, batchFence.fence.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan fence for command buffer batch");
+    }
+    else
+    {
+        /* Wait for the previous batch that used this fence before it can be signaled again */
+        vkWaitForFences(device_, 1, batchFence.fence.GetAddressOf(), VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, batchFence.fence.GetAddressOf());
+    }
+    batchFence.batchID = outBatchID;
+
+    return batchFence.fence.Get();
+}
+
+void VKCommandQueue::FlushStagingBuffers()
+{
+    if (isPrimaryQueue_)
+        stagingBufferPool_.Flush();
+    else
+        stagingBufferPool_.FlushAndWait();
+}
+
+void VKCommandQueue::EnqueueWaitSemaphore(VkSemaphore semaphore, std::uint64_t value)
+{
+    waitSemaphores_.push_back(semaphore);
+    waitValues_.push_back(value);
+    waitDstStageMasks_.push_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+}
+
+void VKCommandQueue::DeferTimelineSignal(VKFence& fenceVK)
+{
+    /* Timeline values must be signaled in increasing order, so submit the previous signal if another queue still holds it back */
+    VKCommandQueue* deferredSignalQueue = fenceVK.GetDeferredSignalQueue();
+    if (deferredSignalQueue != nullptr && deferredSignalQueue != this)
+        deferredSignalQueue->FlushDeferredSignals();
+
+    const std::uint64_t value = fenceVK.NextTimelineValue();
+
+    if (deferredSignalQueue == this)
+    {
+        /* Replace the value of the deferred signal, since the higher value also satisfies all waits for the previous one */
+        for_range(i, deferredSignalFences_.size())
+        {
+            if (deferredSignalFences_[i] == &fenceVK)
+            {
+                signalValues_[i] = value;
+                return;
+            }
+        }
+    }
+
+    /* Defer signal until the next submission, so it doesn't need an empty vkQueueSubmit of its own */
+    signalSemaphores_.push_back(fenceVK.GetVkSemaphore());
+    signalValues_.push_back(value);
+    deferredSignalFences_.push_back(&fenceVK);
+    fenceVK.SetDeferredSignalQueue(this);
+}
+
+void VKCommandQueue::SubmitBinaryFence(VKFence& fenceVK)
+{
+    fenceVK.Reset(device_);
+
+    /* Signal the fence's semaphore as well, so other queues can wait for this submission on the GPU */
+    VkSemaphore semaphore = fenceVK.GetOrCreateVkSemaphore(device_);
+    const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+
+    /* Binary semaphores must be unsignaled before they can be signaled again, so consume the previous signal in the same batch */
+    const bool isPreviousSignalPending = fenceVK.SignalSemaphore();
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = (isPreviousSignalPending ? 1u : 0u);
+        submitInfo.pWaitSemaphores      = &semaphore;
+        submitInfo.pWaitDstStageMask    = &waitDstStageMask;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = &semaphore;
+    }
+    VkResult result = vkQueueSubmit(native_, 1, &submitInfo, fenceVK.GetVkFence());
+    VKThrowIfFailed(result, "failed to submit fence to Vulkan queue");
+    ++submitCount_;
+}
+
+VkResult VKCommandQueue::SubmitBatches(std::uint32_t numCommandBuffers, const VkCommandBuffer* commandBuffers, VkFence fence)
+{
+    VkSubmitInfo submitInfos[2];
+    std::uint32_t numSubmitInfos = 0;
+
+    #if VK_KHR_timeline_semaphore
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfos[2];
+    #endif
+
+    /* Signal deferred timeline fences in a batch without wait operations, so they only depend on previously submitted work */
+    if (!signalSemaphores_.empty())
+    {
+        VkSubmitInfo& submitInfo = submitInfos[numSubmitInfos];
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = 0;
+            submitInfo.pWaitSemaphores      = nullptr;
+            submitInfo.pWaitDstStageMask    = nullptr;
+            submitInfo.commandBufferCount   = 0;
+            submitInfo.pCommandBuffers      = nullptr;
+            submitInfo.signalSemaphoreCount = static_cast<std::uint32_t>(signalSemaphores_.size());
+            submitInfo.pSignalSemaphores    = signalSemaphores_.data();
+        }
+        #if VK_KHR_timeline_semaphore
+        VkTimelineSemaphoreSubmitInfoKHR& timelineInfo = timelineInfos[numSubmitInfos];
+        {
+            timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+            timelineInfo.pNext                      = nullptr;
+            timelineInfo.waitSemaphoreValueCount    = 0;
+            timelineInfo.pWaitSemaphoreValues       = nullptr;
+            timelineInfo.signalSemaphoreValueCount  = static_cast<std::uint32_t>(signalValues_.size());
+            timelineInfo.pSignalSemaphoreValues     = signalValues_.data();
+        }
+        submitInfo.pNext = &timelineInfo;
+        #endif
+        ++numSubmitInfos;
+    }
+
+    /* Submit command buffers together with all pending wait operations */
+    if (numCommandBuffers > 0)
+    {
+        VkSubmitInfo& submitInfo = submitInfos[numSubmitInfos];
+        {
+            submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                = nullptr;
+            submitInfo.waitSemaphoreCount   = static_cast<std::uint32_t>(waitSemaphores_.size());
+            submitInfo.pWaitSemaphores      = waitSemaphores_.data();
+            submitInfo.pWaitDstStageMask    = waitDstStageMasks_.data();
+            submitInfo.commandBufferCount   = numCommandBuffers;
+            submitInfo.pCommandBuffers      = commandBuffers;
+            submitInfo.signalSemaphoreCount = 0;
+            submitInfo.pSignalSemaphores    = nullptr;
+        }
+        #if VK_KHR_timeline_semaphore
+        if (!waitSemaphores_.empty() && HasExtension(VKExt::KHR_timeline_semaphore))
+        {
+            VkTimelineSemaphoreSubmitInfoKHR& timelineInfo = timelineInfos[numSubmitInfos];
+            {
+                timelineInfo.sType                      = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+                timelineInfo.pNext                      = nullptr;
+                timelineInfo.waitSemaphoreValueCount    = static_cast<std::uint32_t>(waitValues_.size());
+                timelineInfo.pWaitSemaphoreValues       = waitValues_.data();
+                timelineInfo.signalSemaphoreValueCount  = 0;
+                timelineInfo.pSignalSemaphoreValues     = nullptr;
+            }
+            submitInfo.pNext = &timelineInfo;
+        }
+        #endif
+        ++numSubmitInfos;
+    }
+
+    if (numSubmitInfos == 0 && fence == VK_NULL_HANDLE)
+        return VK_SUCCESS;
+
+    VkResult result = vkQueueSubmit(native_, numSubmitInfos, submitInfos, fence);
+    ++submitCount_;
+
+    /* Reset deferred signals and wait operations that have been consumed by this submission */
+    for (VKFence* fenceVK : deferredSignalFences_)
+        fenceVK->SetDeferredSignalQueue(nullptr);
+
+    signalSemaphores_.clear();
+    signalValues_.clear();
+    deferredSignalFences_.clear();
+
+    if (numCommandBuffers > 0)
+    {
+        waitSemaphores_.clear();
+        waitValues_.clear();
+        waitDstStageMasks_.clear();
+        isSparseSignalPending_ = false;
+    }
+
+    return result;
+}
+
 VkResult VKCommandQueue::GetQueryResults(
     VKQueryHeap&    queryHeapVK,
     std::uint32_t   firstQuery,
@@ -14,13 +14,19 @@
 #include "../VKPtr.h"
 #include "../VKCore.h"
 #include "../RenderState/VKFence.h"
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
+class VKDevice;
 class VKQueryHeap;
+class VKCommandBuffer;
+class VKStagingBufferPool;
+class SubmissionThread;
 
 // Helper function to submit the specified Vulkan command buffer to a command queue.
 VkResult VKSubmitCommandBuffer(VkQueue commandQueue, VkCommandBuffer commandBuffer, VkFence fence);
@@ -34,10 +40,84 @@ class VKCommandQueue final : public CommandQueue
 
     public:
 
-        VKCommandQueue(VkDevice device, VkQueue queue);
+        void Submit(std::uint32_t numCommandBuffers, CommandBuffer* const * commandBuffers) override;
+
+        void Present(std::uint32_t numSwapChains, SwapChain* const * swapChains) override;
+
+        void SubmitWait(Fence& fence) override;
+
+        void UpdateTileMappings(std::uint32_t numMappings, const TileMappingDescriptor* mappings) override;
+
+    public:
+
+        /*
+        Constructs the command queue. Staging transfers are always submitted to the primary queue, so other queues must wait for them on the CPU.
+        The timestamp period specifies the number of nanoseconds per timestamp tick (see VkPhysicalDeviceLimits::timestampPeriod).
+        All submissions lock the mutex the device associates with the native queue (see VKDevice::GetQueueMutex()).
+        */
+        VKCommandQueue(VKDevice& device, VkQueue queue, VKStagingBufferPool& stagingBufferPool, float timestampPeriod, bool isPrimaryQueue = true);
+
+        // Submits the pending staging transfers and then the specified command buffer to the native queue.
+        void SubmitCommandBuffer(VKCommandBuffer& commandBufferVK);
+
+        // Waits until the batch of command buffers with the specified ID has completed. See Submit(std::uint32_t, CommandBuffer* const*).
+        void WaitForSubmitBatch(std::uint64_t batchID);
+
+        // Submits all timeline fence signals that have been deferred until the next submission on this queue.
+        void FlushDeferredSignals();
+
+        // Submits the specified fence without command buffers. It is signaled once all previous submissions on this queue have completed.
+        void SubmitReleaseFence(VkFence fence);
+
+        // Sets the submission thread that presentations are executed on, so WaitIdle() can wait for them. See RenderSystemFlags::SubmissionThread.
+        void SetSubmissionThread(SubmissionThread* submissionThread);
+
+        // Returns the number of submissions to the native queue so far, including sparse bindings.
+        std::uint64_t GetSubmitCount() const;
+
+        /*
+        Waits until the submission with the specified ID has completed, where the ID is the value of GetSubmitCount() right after that submission.
+        Returns immediately if that submission is already known to have completed, otherwise all submissions on this queue so far are waited on.
+        */
+        void WaitForSubmit(std::uint64_t submitID);
+
+        // Notifies this queue that all submissions up to the specified ID have completed, e.g. after a command buffer waited for its recording fence.
+        void NotifySubmitCompleted(std::uint64_t submitID);
+
+        /*
+        Submits the specified sparse memory binds to the native queue. Sparse binding operations are not ordered with other queue submissions,
+        so the next command buffer and staging submissions wait for them on the GPU via binary semaphores.
+        */
+        void BindSparseMemory(
+            std::uint32_t                               numOpaqueBinds,
+            const VkSparseImageOpaqueMemoryBindInfo*    opaqueBinds,
+            std::uint32_t                               numImageBinds,
+            const VkSparseImageMemoryBindInfo*          imageBinds
+        );
 
     private:
 
+        // Returns the next fence to signal a batch of command buffers and waits for it, if it is still in use by a previous batch.
+        VkFence AcquireSubmitBatchFence(std::uint64_t& outBatchID);
+
+        // Submits the pending staging transfers and waits for them if this is not the primary queue.
+        void FlushStagingBuffers();
+
+        // Adds the specified semaphore to the list of semaphores the next command buffer submission has to wait on. The value is ignored for binary semaphores.
+        void EnqueueWaitSemaphore(VkSemaphore semaphore, std::uint64_t value = 0);
+
+        // Defers the signal operation for the specified timeline fence until the next submission on this queue.
+        void DeferTimelineSignal(VKFence& fenceVK);
+
+        // Submits the signal and wait operations for the specified binary fence.
+        void SubmitBinaryFence(VKFence& fenceVK);
+
+        /*
+        Submits all deferred timeline signals in a batch of their own, followed by a batch with the specified command buffers and all pending waits.
+        Both batches are submitted with a single call to vkQueueSubmit.
+        */
+        VkResult SubmitBatches(std::uint32_t numCommandBuffers, const VkCommandBuffer* commandBuffers, VkFence fence);
+
         VkResult GetQueryResults(
             VKQueryHeap&    queryHeapVK,
             std::uint32_t   firstQuery,
@@ -66,8 +146,42 @@ class VKCommandQueue final : public CommandQueue
 
     private:
 
-        VkDevice    device_ = VK_NULL_HANDLE;
-        VkQueue     native_ = VK_NULL_HANDLE;
+        struct SubmitBatchFence
+        {
+            VKPtr<VkFence>  fence;
+            std::uint64_t   batchID = 0;
+        };
+
+    private:
+
+        static constexpr std::size_t        numSubmitBatchFences    = 8;
+
+        VkDevice                            device_                 = VK_NULL_HANDLE;
+        VkQueue                             native_                 = VK_NULL_HANDLE;
+        std::recursive_mutex&               queueMutex_;
+        VKStagingBufferPool&                stagingBufferPool_;
+        SubmissionThread*                   submissionThread_       = nullptr;
+        float                               timestampPeriod_        = 1.0f;
+        bool                                isPrimaryQueue_         = true;
+
+        std::vector<VkSemaphore>            waitSemaphores_;
+        std::vector<std::uint64_t>          waitValues_;
+        std::vector<VkPipelineStageFlags>   waitDstStageMasks_;
+
+        std::vector<VkSemaphore>            signalSemaphores_;
+        std::vector<std::uint64_t>          signalValues_;
+        std::vector<VKFence*>               deferredSignalFences_;
+
+        VKPtr<VkSemaphore>                  sparseSemaphore_;
+        bool                                isSparseSignalPending_  = false;
+
+        std::vector<SubmitBatchFence>       submitBatchFences_;
+        std::uint64_t                       nextSubmitBatchID_      = 0;
+        std::vector<VkCommandBuffer>        submitBatchCmdBuffers_;
+
+        std::uint64_t                       submitCount_            = 0;
+        std::uint64_t                       completedSubmitCount_   = 0;
+        VKPtr<VkFence>                      submitWaitFence_;
 
 };
 
@@ -83,6 +83,176 @@ static bool DECL_LOADVKEXT_PROC_INSTANCE(KHR_android_surface)
 
 #endif // /LLGL_OS_WIN32
 
+static bool DECL_LOADVKEXT_PROC(KHR_draw_indirect_count)
+{
+    LOAD_VKPROC( vkCmdDrawIndirectCountKHR        );
+    LOAD_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+    return true;
+}
+
+#if VK_EXT_extended_dynamic_state
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state)
+{
+    LOAD_VKPROC( vkCmdSetCullModeEXT          );
+    LOAD_VKPROC( vkCmdSetFrontFaceEXT         );
+    LOAD_VKPROC( vkCmdSetPrimitiveTopologyEXT );
+    LOAD_VKPROC( vkCmdSetDepthTestEnableEXT   );
+    LOAD_VKPROC( vkCmdSetDepthWriteEnableEXT  );
+    LOAD_VKPROC( vkCmdSetDepthCompareOpEXT    );
+    LOAD_VKPROC( vkCmdSetStencilTestEnableEXT );
+    LOAD_VKPROC( vkCmdSetStencilOpEXT         );
+    return true;
+}
+
+#endif // /VK_EXT_extended_dynamic_state
+
+#if VK_EXT_extended_dynamic_state2
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state2)
+{
+    LOAD_VKPROC( vkCmdSetRasterizerDiscardEnableEXT );
+    LOAD_VKPROC( vkCmdSetDepthBiasEnableEXT         );
+    LOAD_VKPROC( vkCmdSetPrimitiveRestartEnableEXT  );
+    return true;
+}
+
+#endif // /VK_EXT_extended_dynamic_state2
+
+#if VK_EXT_extended_dynamic_state3
+
+static bool DECL_LOADVKEXT_PROC(EXT_extended_dynamic_state3)
+{
+    LOAD_VKPROC( vkCmdSetPolygonModeEXT );
+    return true;
+}
+
+#endif // /VK_EXT_extended_dynamic_state3
+
+#if VK_KHR_synchronization2
+
+static bool DECL_LOADVKEXT_PROC(KHR_synchronization2)
+{
+    LOAD_VKPROC( vkCmdPipelineBarrier2KHR );
+    return true;
+}
+
+#endif // /VK_KHR_synchronization2
+
+#if VK_KHR_dynamic_rendering
+
+static bool DECL_LOADVKEXT_PROC(KHR_dynamic_rendering)
+{
+    LOAD_VKPROC( vkCmdBeginRenderingKHR );
+    LOAD_VKPROC( vkCmdEndRenderingKHR   );
+    return true;
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
+#if VK_KHR_push_descriptor
+
+static bool DECL_LOADVKEXT_PROC(KHR_push_descriptor)
+{
+    LOAD_VKPROC( vkCmdPushDescriptorSetKHR );
+    return true;
+}
+
+#endif // /VK_KHR_push_descriptor
+
+#if VK_KHR_timeline_semaphore
+
+static bool DECL_LOADVKEXT_PROC(KHR_timeline_semaphore)
+{
+    LOAD_VKPROC( vkGetSemaphoreCounterValueKHR );
+    LOAD_VKPROC( vkWaitSemaphoresKHR           );
+    return true;
+}
+
+#endif // /VK_KHR_timeline_semaphore
+
+#if VK_KHR_present_wait
+
+static bool DECL_LOADVKEXT_PROC(KHR_present_wait)
+{
+    LOAD_VKPROC( vkWaitForPresentKHR );
+    return true;
+}
+
+#endif // /VK_KHR_present_wait
+
+#if VK_EXT_mesh_shader
+
+static bool DECL_LOADVKEXT_PROC(EXT_mesh_shader)
+{
+    LOAD_VKPROC( vkCmdDrawMeshTasksEXT              );
+    LOAD_VKPROC( vkCmdDrawMeshTasksIndirectEXT      );
+    LOAD_VKPROC( vkCmdDrawMeshTasksIndirectCountEXT );
+    return true;
+}
+
+#endif // /VK_EXT_mesh_shader
+
+#if VK_KHR_fragment_shading_rate
+
+static bool DECL_LOADVKEXT_PROC(KHR_fragment_shading_rate)
+{
+    LOAD_VKPROC( vkCmdSetFragmentShadingRateKHR );
+    return true;
+}
+
+#endif // /VK_KHR_fragment_shading_rate
+
+#if VK_KHR_external_memory_fd
+
+static bool DECL_LOADVKEXT_PROC(KHR_external_memory_fd)
+{
+    LOAD_VKPROC( vkGetMemoryFdKHR );
+    return true;
+}
+
+#endif // /VK_KHR_external_memory_fd
+
+#if VK_KHR_external_memory_win32
+
+static bool DECL_LOADVKEXT_PROC(KHR_external_memory_win32)
+{
+    LOAD_VKPROC( vkGetMemoryWin32HandleKHR );
+    return true;
+}
+
+#endif // /VK_KHR_external_memory_win32
+
+#if VK_KHR_external_semaphore_fd
+
+static bool DECL_LOADVKEXT_PROC(KHR_external_semaphore_fd)
+{
+    LOAD_VKPROC( vkGetSemaphoreFdKHR );
+    return true;
+}
+
+#endif // /VK_KHR_external_semaphore_fd
+
+#if VK_KHR_external_semaphore_win32
+
+static bool DECL_LOADVKEXT_PROC(KHR_external_semaphore_win32)
+{
+    LOAD_VKPROC( vkGetSemaphoreWin32HandleKHR );
+    return true;
+}
+
+#endif // /VK_KHR_external_semaphore_win32
+
+#if VK_GOOGLE_display_timing
+
+static bool DECL_LOADVKEXT_PROC(GOOGLE_display_timing)
+{
+    LOAD_VKPROC( vkGetPastPresentationTimingGOOGLE );
+    return true;
+}
+
+#endif // /VK_GOOGLE_display_timing
+
 static bool DECL_LOADVKEXT_PROC(EXT_debug_marker)
 {
     LOAD_VKPROC( vkDebugMarkerSetObjectTagEXT  );
@@ -200,9 +370,71 @@ bool VKLoadDeviceExtensions(VkDevice device, const std::vector<const char*>& sup
     LOAD_VKEXT( EXT_debug_marker                    );
     LOAD_VKEXT( EXT_conditional_rendering           );
     LOAD_VKEXT( EXT_transform_feedback              );
+    LOAD_VKEXT( KHR_draw_indirect_count             );
+    #if VK_KHR_synchronization2
+    LOAD_VKEXT( KHR_synchronization2                );
+    #endif
+    #if VK_EXT_extended_dynamic_state
+    LOAD_VKEXT( EXT_extended_dynamic_state          );
+    #endif
+    #if VK_EXT_extended_dynamic_state2
+    LOAD_VKEXT( EXT_extended_dynamic_state2         );
+    #endif
+    #if VK_EXT_extended_dynamic_state3
+    LOAD_VKEXT( EXT_extended_dynamic_state3         );
+    #endif
+    #if VK_KHR_timeline_semaphore
+    LOAD_VKEXT( KHR_timeline_semaphore              );
+    #endif
+    #if VK_KHR_present_wait
+    LOAD_VKEXT( KHR_present_wait                    );
+    #endif
+    #if VK_KHR_dynamic_rendering
+    LOAD_VKEXT( KHR_dynamic_rendering               );
+    #endif
+    #if VK_KHR_push_descriptor
+    LOAD_VKEXT( KHR_push_descriptor                 );
+    #endif
+    #if VK_EXT_mesh_shader
+    LOAD_VKEXT( EXT_mesh_shader                     );
+    #endif
+    #if VK_KHR_fragment_shading_rate
+    LOAD_VKEXT( KHR_fragment_shading_rate           );
+    #endif
+    #if VK_KHR_external_memory_fd
+    LOAD_VKEXT( KHR_external_memory_fd              );
+    #endif
+    #if VK_KHR_external_memory_win32
+    LOAD_VKEXT( KHR_external_memory_win32           );
+    #endif
+    #if VK_KHR_external_semaphore_fd
+    LOAD_VKEXT( KHR_external_semaphore_fd           );
+    #endif
+    #if VK_KHR_external_semaphore_win32
+    LOAD_VKEXT( KHR_external_semaphore_win32        );
+    #endif
+    #if VK_GOOGLE_display_timing
+    LOAD_VKEXT( GOOGLE_display_timing               );
+    #endif
 
     ENABLE_VKEXT( EXT_conservative_rasterization );
     ENABLE_VKEXT( EXT_nested_command_buffer      );
+    ENABLE_VKEXT( EXT_memory_budget              );
+    ENABLE_VKEXT( KHR_maintenance3               );
+    ENABLE_VKEXT( EXT_descriptor_indexing        );
+    ENABLE_VKEXT( KHR_dedicated_allocation       );
+    #if VK_KHR_present_id
+    ENABLE_VKEXT( KHR_present_id                 );
+    #endif
+    #if VK_EXT_swapchain_maintenance1
+    ENABLE_VKEXT( EXT_swapchain_maintenance1     );
+    #endif
+    #if VK_EXT_texture_compression_astc_hdr
+    ENABLE_VKEXT( EXT_texture_compression_astc_hdr );
+    #endif
+    #if VK_KHR_multiview
+    ENABLE_VKEXT( KHR_multiview                  );
+    #endif
 
     #undef LOAD_VKEXT
 
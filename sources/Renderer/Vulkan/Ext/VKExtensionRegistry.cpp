@@ -40,6 +40,93 @@ static const char* g_VKOptionalExtensions[] =
     #ifdef VK_EXT_nested_command_buffer
     VK_EXT_NESTED_COMMAND_BUFFER_EXTENSION_NAME,
     #endif
+    #ifdef VK_EXT_memory_budget
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_maintenance3
+    VK_KHR_MAINTENANCE3_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_descriptor_indexing
+    VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_extended_dynamic_state
+    VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_extended_dynamic_state2
+    VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_extended_dynamic_state3
+    VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_draw_indirect_count
+    VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_synchronization2
+    VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_timeline_semaphore
+    VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_present_id
+    VK_KHR_PRESENT_ID_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_present_wait
+    VK_KHR_PRESENT_WAIT_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_create_renderpass2
+    VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_depth_stencil_resolve
+    VK_KHR_DEPTH_STENCIL_RESOLVE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_dynamic_rendering
+    VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_push_descriptor
+    VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_swapchain_maintenance1
+    VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_mesh_shader
+    VK_EXT_MESH_SHADER_EXTENSION_NAME,
+    #endif
+    #ifdef VK_EXT_texture_compression_astc_hdr
+    VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_fragment_shading_rate
+    VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_multiview
+    VK_KHR_MULTIVIEW_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_get_memory_requirements2
+    VK_KHR_GET_MEMORY_REQUIREMENTS_2_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_dedicated_allocation
+    VK_KHR_DEDICATED_ALLOCATION_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_external_memory
+    VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_external_memory_fd
+    VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_external_memory_win32
+    VK_KHR_EXTERNAL_MEMORY_WIN32_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_external_semaphore
+    VK_KHR_EXTERNAL_SEMAPHORE_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_external_semaphore_fd
+    VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME,
+    #endif
+    #ifdef VK_KHR_external_semaphore_win32
+    VK_KHR_EXTERNAL_SEMAPHORE_WIN32_EXTENSION_NAME,
+    #endif
+    #ifdef VK_GOOGLE_display_timing
+    VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME,
+    #endif
     nullptr,
 };
 
@@ -80,6 +167,13 @@ static bool IsVulkanInstanceExtOptional(const StringView& name)
     return
     (
         name == VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME
+        #if VK_KHR_get_surface_capabilities2 && VK_EXT_surface_maintenance1
+        || name == VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME
+        || name == VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME
+        #endif
+        #if VK_EXT_swapchain_colorspace
+        || name == VK_EXT_SWAPCHAIN_COLOR_SPACE_EXTENSION_NAME
+        #endif
     );
 }
 
@@ -23,6 +23,21 @@ enum class VKExt
     /* Khronos extensions */
     KHR_maintenance1,
     KHR_get_physical_device_properties2,
+    KHR_maintenance3,
+    KHR_draw_indirect_count,
+    KHR_synchronization2,
+    KHR_timeline_semaphore,
+    KHR_present_id,
+    KHR_present_wait,
+    KHR_dynamic_rendering,
+    KHR_push_descriptor,
+    KHR_fragment_shading_rate,
+    KHR_multiview,
+    KHR_dedicated_allocation,
+    KHR_external_memory_fd,
+    KHR_external_memory_win32,
+    KHR_external_semaphore_fd,
+    KHR_external_semaphore_win32,
 
     /* Multivendor extensions */
     EXT_debug_marker,
@@ -30,6 +45,17 @@ enum class VKExt
     EXT_transform_feedback,
     EXT_conservative_rasterization,
     EXT_nested_command_buffer,
+    EXT_memory_budget,
+    EXT_descriptor_indexing,
+    EXT_extended_dynamic_state,
+    EXT_extended_dynamic_state2,
+    EXT_extended_dynamic_state3,
+    EXT_swapchain_maintenance1,
+    EXT_mesh_shader,
+    EXT_texture_compression_astc_hdr,
+
+    /* Vendor specific extensions */
+    GOOGLE_display_timing,
 
     /* Enumeration entry counter */
     Count,
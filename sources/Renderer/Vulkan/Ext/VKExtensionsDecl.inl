@@ -51,6 +51,114 @@ DECL_VKPROC( vkCmdBeginQueryIndexedEXT            );
 DECL_VKPROC( vkCmdEndQueryIndexedEXT              );
 DECL_VKPROC( vkCmdDrawIndirectByteCountEXT        );
 
+/* VK_EXT_extended_dynamic_state */
+
+#if VK_EXT_extended_dynamic_state
+DECL_VKPROC( vkCmdSetCullModeEXT          );
+DECL_VKPROC( vkCmdSetFrontFaceEXT         );
+DECL_VKPROC( vkCmdSetPrimitiveTopologyEXT );
+DECL_VKPROC( vkCmdSetDepthTestEnableEXT   );
+DECL_VKPROC( vkCmdSetDepthWriteEnableEXT  );
+DECL_VKPROC( vkCmdSetDepthCompareOpEXT    );
+DECL_VKPROC( vkCmdSetStencilTestEnableEXT );
+DECL_VKPROC( vkCmdSetStencilOpEXT         );
+#endif
+
+/* VK_EXT_extended_dynamic_state2 */
+
+#if VK_EXT_extended_dynamic_state2
+DECL_VKPROC( vkCmdSetRasterizerDiscardEnableEXT );
+DECL_VKPROC( vkCmdSetDepthBiasEnableEXT         );
+DECL_VKPROC( vkCmdSetPrimitiveRestartEnableEXT  );
+#endif
+
+/* VK_EXT_extended_dynamic_state3 */
+
+#if VK_EXT_extended_dynamic_state3
+DECL_VKPROC( vkCmdSetPolygonModeEXT );
+#endif
+
+/* VK_KHR_draw_indirect_count */
+
+DECL_VKPROC( vkCmdDrawIndirectCountKHR        );
+DECL_VKPROC( vkCmdDrawIndexedIndirectCountKHR );
+
+/* VK_KHR_synchronization2 */
+
+#if VK_KHR_synchronization2
+DECL_VKPROC( vkCmdPipelineBarrier2KHR );
+#endif
+
+/* VK_KHR_timeline_semaphore */
+
+#if VK_KHR_timeline_semaphore
+DECL_VKPROC( vkGetSemaphoreCounterValueKHR );
+DECL_VKPROC( vkWaitSemaphoresKHR           );
+#endif
+
+/* VK_KHR_dynamic_rendering */
+
+#if VK_KHR_dynamic_rendering
+DECL_VKPROC( vkCmdBeginRenderingKHR );
+DECL_VKPROC( vkCmdEndRenderingKHR   );
+#endif
+
+/* VK_KHR_push_descriptor */
+
+#if VK_KHR_push_descriptor
+DECL_VKPROC( vkCmdPushDescriptorSetKHR );
+#endif
+
+/* VK_KHR_present_wait */
+
+#if VK_KHR_present_wait
+DECL_VKPROC( vkWaitForPresentKHR );
+#endif
+
+/* VK_EXT_mesh_shader */
+
+#if VK_EXT_mesh_shader
+DECL_VKPROC( vkCmdDrawMeshTasksEXT              );
+DECL_VKPROC( vkCmdDrawMeshTasksIndirectEXT      );
+DECL_VKPROC( vkCmdDrawMeshTasksIndirectCountEXT );
+#endif
+
+/* VK_KHR_fragment_shading_rate */
+
+#if VK_KHR_fragment_shading_rate
+DECL_VKPROC( vkCmdSetFragmentShadingRateKHR );
+#endif
+
+/* VK_KHR_external_memory_fd */
+
+#if VK_KHR_external_memory_fd
+DECL_VKPROC( vkGetMemoryFdKHR );
+#endif
+
+/* VK_KHR_external_memory_win32 */
+
+#if VK_KHR_external_memory_win32
+DECL_VKPROC( vkGetMemoryWin32HandleKHR );
+#endif
+
+/* VK_KHR_external_semaphore_fd */
+
+#if VK_KHR_external_semaphore_fd
+DECL_VKPROC( vkGetSemaphoreFdKHR );
+#endif
+
+/* VK_KHR_external_semaphore_win32 */
+
+#if VK_KHR_external_semaphore_win32
+DECL_VKPROC( vkGetSemaphoreWin32HandleKHR );
+#endif
+
+/* VK_GOOGLE_display_timing */
+
+#if VK_GOOGLE_display_timing
+DECL_VKPROC( vkGetPastPresentationTimingGOOGLE );
+#endif
+
 /* VK_KHR_get_physical_device_properties2 */
 
 DECL_VKPROC( vkGetPhysicalDeviceFeatures2KHR                    );
@@ -16,12 +16,29 @@ namespace LLGL
 {
 
 
-VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex) :
-    deviceMemory_    { device, vkFreeMemory },
-    size_            { size                 },
-    memoryTypeIndex_ { memoryTypeIndex      },
-    maxNewBlockSize_ { size                 }
+VKDeviceMemory::VKDeviceMemory(
+    VkDevice                device,
+    VkDeviceSize            size,
+    std::uint32_t           memoryTypeIndex,
+    VKDeviceMemoryStrategy  strategy,
+    VkDeviceSize            minBuddyBlockSize)
+:
+    deviceMemory_      { device, vkFreeMemory },
+    size_              { size                 },
+    memoryTypeIndex_   { memoryTypeIndex      },
+    maxNewBlockSize_   { size                 },
+    strategy_          { strategy             },
+    minBuddyBlockSize_ { minBuddyBlockSize    }
 {
+    /* Initialize buddy free lists with a single block of the entire chunk */
+    if (strategy_ == VKDeviceMemoryStrategy::Buddy)
+    {
+        LLGL_ASSERT(minBuddyBlockSize_ > 0 && size_ % minBuddyBlockSize_ == 0, "invalid chunk size for buddy allocation");
+        buddyFreeLists_.resize(GetBuddyOrder(size_) + 1);
+        buddyFreeLists_.back().push_back(0);
+        maxNewBlockSize_ = 0;
+    }
+
     /* Allocate device memory */
     VkMemoryAllocateInfo allocInfo;
     {
@@ -39,49 +56,74 @@ VKDeviceMemory::VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t
     }
 }
 
-void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size)
+void* VKDeviceMemory::Map(VkDevice device, VkDeviceSize offset, VkDeviceSize /*size*/)
 {
-    void* data = nullptr;
+    /* Map entire chunk only once, since regions of the same chunk can be mapped simultaneously, e.g. by persistently mapped buffers */
+    std::lock_guard<std::mutex> guard{ mapMutex_ };
+    if (mapRefCount_ == 0)
+    {
+        void* data = nullptr;
 
-    VkResult result = vkMapMemory(device, deviceMemory_, offset, size, 0, &data);
-    VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
+        VkResult result = vkMapMemory(device, deviceMemory_, 0, VK_WHOLE_SIZE, 0, &data);
+        VKThrowIfFailed(result, "failed to map Vulkan buffer into CPU memory space");
 
-    return data;
+        mappedData_ = static_cast<char*>(data);
+    }
+    ++mapRefCount_;
+    return (mappedData_ + offset);
 }
 
 void VKDeviceMemory::Unmap(VkDevice device)
 {
-    vkUnmapMemory(device, deviceMemory_);
+    std::lock_guard<std::mutex> guard{ mapMutex_ };
+    if (mapRefCount_ > 0)
+    {
+        if (--mapRefCount_ == 0)
+        {
+            vkUnmapMemory(device, deviceMemory_);
+            mappedData_ = nullptr;
+        }
+    }
 }
 
 VKDeviceMemoryRegion* VKDeviceMemory::Allocate(VkDeviceSize size, VkDeviceSize alignment, bool reduceFragmentation)
 {
     if (size > 0 && alignment > 0)
     {
+        if (strategy_ == VKDeviceMemoryStrategy::Buddy)
+            return AllocateBuddy(size, alignment);
+
         /* Adjust size and offset by alignment */
         VkDeviceSize alignedSize    = GetAlignedSize(size, alignment);
         VkDeviceSize alignedOffset  = GetAlignedSize(GetNextOffset(), alignment);
 
+        VKDeviceMemoryRegion* region = nullptr;
+
         if (reduceFragmentation)
         {
             /* Reuse fragmented block */
             if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
+                region = FindReusableBlock(alignedSize, alignment);
 
             /* Allocate block with aligned size and offset */
-            if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
+            if (region == nullptr && alignedSize + alignedOffset <= GetSize())
+                region = AllocAndAppendBlock(alignedSize, alignedOffset);
         }
         else
         {
             /* Allocate block with aligned size and offset */
             if (alignedSize + alignedOffset <= GetSize())
-                return AllocAndAppendBlock(alignedSize, alignedOffset);
+                region = AllocAndAppendBlock(alignedSize, alignedOffset);
 
             /* Reuse fragmented block */
-            if (alignedSize <= maxFragmentedBlockSize_)
-                return FindReusableBlock(alignedSize, alignment);
+            else if (alignedSize <= maxFragmentedBlockSize_)
+                region = FindReusableBlock(alignedSize, alignment);
         }
+
+        if (region != nullptr)
+            usedSize_ += region->GetSize();
+
+        return region;
     }
     return nullptr;
 }
@@ -90,21 +132,20 @@ void VKDeviceMemory::Release(VKDeviceMemoryRegion* region)
 {
     if (region)
     {
-        /* Increase maximal size of fragmented blocks */
-        IncMaxFragmentedBlockSize(region->GetSize());
-
-        auto it = std::find_if(
-            blocks_.begin(), blocks_.end(),
-            [region](const std::unique_ptr<VKDeviceMemoryRegion>& entry)
-            {
-                return (entry.get() == region);
-            }
-        );
+        if (strategy_ == VKDeviceMemoryStrategy::Buddy)
+        {
+            ReleaseBuddy(region);
+            return;
+        }
 
-        if (it != blocks_.end())
+        if (std::unique_ptr<VKDeviceMemoryRegion> block = TakeBlock(region))
         {
-            InsertBlockToFragmentsSorted(std::move(*it));
-            blocks_.erase(it);
+            /* Increase maximal size of fragmented blocks */
+            IncMaxFragmentedBlockSize(block->GetSize());
+            InsertBlockToFragmentsSorted(std::move(block));
+
+            /* Give free space behind the last block back to new allocations */
+            TrimTrailingFragments();
         }
     }
 }
@@ -116,6 +157,16 @@ bool VKDeviceMemory::IsEmpty() const
 
 VkDeviceSize VKDeviceMemory::GetMaxAllocationSize() const
 {
+    if (strategy_ == VKDeviceMemoryStrategy::Buddy)
+    {
+        /* Return size of largest free buddy block */
+        for (std::size_t order = buddyFreeLists_.size(); order-- > 0;)
+        {
+            if (!buddyFreeLists_[order].empty())
+                return (minBuddyBlockSize_ << order);
+        }
+        return 0;
+    }
     return std::max(maxNewBlockSize_, maxFragmentedBlockSize_);
 }
 
@@ -123,9 +174,21 @@ void VKDeviceMemory::AccumDetails(VKDeviceMemoryDetails& details) const
 {
     details.numChunks               += 1;
     details.numBlocks               += blocks_.size();
-    details.numFragments            += fragmentedBlocks_.size();
-    details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
-    details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    details.allocatedSize           += size_;
+    details.usedSize                += usedSize_;
+
+    if (strategy_ == VKDeviceMemoryStrategy::Buddy)
+    {
+        for (const auto& freeList : buddyFreeLists_)
+            details.numFragments += freeList.size();
+        details.maxFragmentedBlockSize = std::max(details.maxFragmentedBlockSize, GetMaxAllocationSize());
+    }
+    else
+    {
+        details.numFragments            += fragmentedBlocks_.size();
+        details.maxNewBlockSize         = std::max(details.maxNewBlockSize, maxNewBlockSize_);
+        details.maxFragmentedBlockSize  = std::max(details.maxFragmentedBlockSize, maxFragmentedBlockSize_);
+    }
 }
 
 #ifdef LLGL_DEBUG
@@ -272,19 +335,10 @@ VKDeviceMemoryRegion* VKDeviceMemory::InsertBlock(std::unique_ptr<VKDeviceMemory
     VKDeviceMemoryRegion* regionRef = region.get();
 
     /* Add block by insertion sort */
-    if (!blocks_.empty())
-    {
-        for (auto it = blocks_.rbegin(); it != blocks_.rend(); ++it)
-        {
-            if ((*it)->GetOffset() < region->GetOffset())
-            {
-                blocks_.insert(it.base(), std::move(region));
-                break;
-            }
-        }
-    }
-    else
-        blocks_.emplace_back(std::move(region));
+    auto it = blocks_.rbegin();
+    while (it != blocks_.rend() && (*it)->GetOffset() > region->GetOffset())
+        ++it;
+    blocks_.insert(it.base(), std::move(region));
 
     return regionRef;
 }
@@ -460,6 +514,108 @@ void VKDeviceMemory::DecMaxFragmentedBlockSize(VkDeviceSize size)
         UpdateMaxFragmentedBlockSize();
 }
 
+void VKDeviceMemory::TrimTrailingFragments()
+{
+    const VkDeviceSize nextOffset = GetNextOffset();
+    if (!fragmentedBlocks_.empty() && fragmentedBlocks_.back()->GetOffsetWithSize() > nextOffset)
+    {
+        /* Fragments are sorted and merged, so at most the last one can reach beyond the last block */
+        std::unique_ptr<VKDeviceMemoryRegion> block = PopBackFragmentedBlock();
+        if (block->GetOffset() < nextOffset)
+        {
+            block->MoveAt(nextOffset - block->GetOffset(), block->GetOffset());
+            IncMaxFragmentedBlockSize(block->GetSize());
+            fragmentedBlocks_.push_back(std::move(block));
+        }
+    }
+    maxNewBlockSize_ = GetSize() - nextOffset;
+}
+
+std::unique_ptr<VKDeviceMemoryRegion> VKDeviceMemory::TakeBlock(VKDeviceMemoryRegion* region)
+{
+    auto it = std::find_if(
+        blocks_.begin(), blocks_.end(),
+        [region](const std::unique_ptr<VKDeviceMemoryRegion>& entry)
+        {
+            return (entry.get() == region);
+        }
+    );
+
+    if (it == blocks_.end())
+        return nullptr;
+
+    std::unique_ptr<VKDeviceMemoryRegion> block = std::move(*it);
+    blocks_.erase(it);
+    usedSize_ -= block->GetSize();
+    return block;
+}
+
+VKDeviceMemoryRegion* VKDeviceMemory::AllocateBuddy(VkDeviceSize size, VkDeviceSize alignment)
+{
+    /* Buddy blocks are naturally aligned to their size, so the alignment only increases the block size */
+    VkDeviceSize blockSize = minBuddyBlockSize_;
+    while (blockSize < size || blockSize < alignment)
+        blockSize <<= 1;
+
+    const std::size_t order = GetBuddyOrder(blockSize);
+    if (order >= buddyFreeLists_.size())
+        return nullptr;
+
+    /* Find smallest free block that fits */
+    std::size_t freeOrder = order;
+    while (freeOrder < buddyFreeLists_.size() && buddyFreeLists_[freeOrder].empty())
+        ++freeOrder;
+
+    if (freeOrder == buddyFreeLists_.size())
+        return nullptr;
+
+    const VkDeviceSize offset = buddyFreeLists_[freeOrder].back();
+    buddyFreeLists_[freeOrder].pop_back();
+
+    /* Split block until it has the requested order; the upper halves become free buddies */
+    while (freeOrder > order)
+    {
+        --freeOrder;
+        buddyFreeLists_[freeOrder].push_back(offset + (minBuddyBlockSize_ << freeOrder));
+    }
+
+    usedSize_ += blockSize;
+    return InsertBlock(MakeUniqueBlock(blockSize, offset));
+}
+
+void VKDeviceMemory::ReleaseBuddy(VKDeviceMemoryRegion* region)
+{
+    std::unique_ptr<VKDeviceMemoryRegion> block = TakeBlock(region);
+    if (!block)
+        return;
+
+    VkDeviceSize offset = block->GetOffset();
+    std::size_t order = GetBuddyOrder(block->GetSize());
+
+    /* Merge with free buddies as long as possible */
+    while (order + 1 < buddyFreeLists_.size())
+    {
+        const VkDeviceSize buddyOffset = (offset ^ (minBuddyBlockSize_ << order));
+        std::vector<VkDeviceSize>& freeList = buddyFreeLists_[order];
+        auto it = std::find(freeList.begin(), freeList.end(), buddyOffset);
+        if (it == freeList.end())
+            break;
+        freeList.erase(it);
+        offset = std::min(offset, buddyOffset);
+        ++order;
+    }
+
+    buddyFreeLists_[order].push_back(offset);
+}
+
+std::size_t VKDeviceMemory::GetBuddyOrder(VkDeviceSize size) const
+{
+    std::size_t order = 0;
+    while ((minBuddyBlockSize_ << order) < size)
+        ++order;
+    return order;
+}
+
 
 } // /namespace LLGL
 
@@ -15,6 +15,7 @@
 #include <cstdint>
 #include <vector>
 #include <memory>
+#include <mutex>
 
 #ifdef LLGL_DEBUG
 #   include <ostream>
@@ -25,6 +26,14 @@ namespace LLGL
 {
 
 
+// Sub-allocation strategy of a device memory chunk.
+enum class VKDeviceMemoryStrategy
+{
+    Linear,     // Blocks are appended linearly and released blocks are kept in a sorted list of fragments for reuse.
+    Buddy,      // Blocks are power-of-two sized and split from or merged with their buddies. Chunk size must be a power-of-two multiple of the minimum block size.
+    Dedicated,  // Chunk holds a single block.
+};
+
 // Details structure of VKDeviceMemory for debugging.
 struct VKDeviceMemoryDetails
 {
@@ -33,6 +42,8 @@ struct VKDeviceMemoryDetails
     std::size_t     numFragments            = 0;
     VkDeviceSize    maxNewBlockSize         = 0;
     VkDeviceSize    maxFragmentedBlockSize  = 0;
+    VkDeviceSize    allocatedSize           = 0;
+    VkDeviceSize    usedSize                = 0;
 };
 
 // An instance of this class holds a single VkDeviceMemory allocation chunk.
@@ -41,14 +52,18 @@ class VKDeviceMemory
 
     public:
 
-        VKDeviceMemory(VkDevice device, VkDeviceSize size, std::uint32_t memoryTypeIndex);
+        VKDeviceMemory(
+            VkDevice                device,
+            VkDeviceSize            size,
+            std::uint32_t           memoryTypeIndex,
+            VKDeviceMemoryStrategy  strategy            = VKDeviceMemoryStrategy::Linear,
+            VkDeviceSize            minBuddyBlockSize   = 0
+        );
 
         VKDeviceMemory(const VKDeviceMemory&) = delete;
         VKDeviceMemory& operator = (const VKDeviceMemory&) = delete;
 
-        VKDeviceMemory(VKDeviceMemory&&) = default;
-        VKDeviceMemory& operator = (VKDeviceMemory&&) = default;
-
+        // Maps the specified range of this device memory chunk. Mappings are reference counted and thread-safe, so each Map must be followed by an Unmap.
         void* Map(VkDevice device, VkDeviceSize offset, VkDeviceSize size);
         void Unmap(VkDevice device);
 
@@ -67,6 +82,12 @@ class VKDeviceMemory
         // Accumulates the memory details of this device memory into the output structure.
         void AccumDetails(VKDeviceMemoryDetails& details) const;
 
+        // Returns the number of bytes that are not occupied by any block.
+        inline VkDeviceSize GetFreeSize() const
+        {
+            return size_ - usedSize_;
+        }
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s) const;
@@ -92,6 +113,12 @@ class VKDeviceMemory
             return memoryTypeIndex_;
         }
 
+        // Returns the sub-allocation strategy of this device memory chunk.
+        inline VKDeviceMemoryStrategy GetStrategy() const
+        {
+            return strategy_;
+        }
+
     private:
 
         // Returns the next offset after the last block.
@@ -133,6 +160,21 @@ class VKDeviceMemory
         // Updates the maximal fragmented block size if the input size equals the current maximum size.
         void DecMaxFragmentedBlockSize(VkDeviceSize size);
 
+        // Moves fragments behind the last block back into the range for new blocks.
+        void TrimTrailingFragments();
+
+        // Removes the specified region from the main block list and returns its ownership.
+        std::unique_ptr<VKDeviceMemoryRegion> TakeBlock(VKDeviceMemoryRegion* region);
+
+        // Allocates a power-of-two block with the buddy strategy.
+        VKDeviceMemoryRegion* AllocateBuddy(VkDeviceSize size, VkDeviceSize alignment);
+
+        // Releases a block that was allocated with the buddy strategy and merges it with its free buddies.
+        void ReleaseBuddy(VKDeviceMemoryRegion* region);
+
+        // Returns the order of the specified buddy block size, i.e. log2(size / minBuddyBlockSize).
+        std::size_t GetBuddyOrder(VkDeviceSize size) const;
+
     private:
 
         VKPtr<VkDeviceMemory>                               deviceMemory_;
@@ -144,6 +186,15 @@ class VKDeviceMemory
 
         VkDeviceSize                                        maxFragmentedBlockSize_ = 0;
         std::vector<std::unique_ptr<VKDeviceMemoryRegion>>  fragmentedBlocks_;
+        VkDeviceSize                                        usedSize_               = 0;
+
+        VKDeviceMemoryStrategy                              strategy_               = VKDeviceMemoryStrategy::Linear;
+        VkDeviceSize                                        minBuddyBlockSize_      = 0;
+        std::vector<std::vector<VkDeviceSize>>              buddyFreeLists_;        // Free block offsets per buddy order
+
+        std::mutex                                          mapMutex_;
+        char*                                               mappedData_             = nullptr;
+        std::uint32_t                                       mapRefCount_            = 0;
 
 };
 
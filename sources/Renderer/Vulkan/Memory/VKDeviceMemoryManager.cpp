@@ -8,22 +8,42 @@
 #include "VKDeviceMemoryManager.h"
 #include "../VKCore.h"
 #include "../../ContainerTypes.h"
+#include <LLGL/RenderingDebugger.h>
+#include <LLGL/Utils/ForRange.h>
 
 
 namespace LLGL
 {
 
 
+// Allocations up to this size are sub-allocated with the buddy strategy.
+static constexpr VkDeviceSize g_maxBuddyAllocationSize  = 64*1024;
+
+// Minimum block size of the buddy strategy. Smaller allocations waste the remainder of this block.
+static constexpr VkDeviceSize g_minBuddyBlockSize       = 256;
+
+// Returns the smallest power of two that is greater than or equal to the specified size.
+static VkDeviceSize NextPowerOfTwo(VkDeviceSize size)
+{
+    VkDeviceSize result = 1;
+    while (result < size)
+        result <<= 1;
+    return result;
+}
+
+
 VKDeviceMemoryManager::VKDeviceMemoryManager(
     VkDevice                                device,
     const VkPhysicalDeviceMemoryProperties& memoryProperties,
     VkDeviceSize                            minAllocationSize,
-    bool                                    reduceFragmentation)
+    bool                                    reduceFragmentation,
+    RenderingDebugger*                      debugger)
 :
     device_              { device              },
     memoryProperties_    { memoryProperties    },
     minAllocationSize_   { minAllocationSize   },
-    reduceFragmentation_ { reduceFragmentation }
+    reduceFragmentation_ { reduceFragmentation },
+    debugger_            { debugger            }
 {
 }
 
@@ -33,14 +53,41 @@ VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
     std::uint32_t           memoryTypeBits,
     VkMemoryPropertyFlags   properties)
 {
-    const VkDeviceSize  alignedSize     = GetAlignedSize(size, alignment);
-    const VkDeviceSize  allocationSize  = std::max(minAllocationSize_, alignedSize);
-    const std::uint32_t memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
+    const VkDeviceSize              alignedSize     = GetAlignedSize(size, alignment);
+    const std::uint32_t             memoryTypeIndex = FindMemoryType(memoryTypeBits, properties);
+    const VKDeviceMemoryStrategy    strategy        = SelectStrategy(alignedSize);
+
+    /* Determine size for a new chunk of the respective size class */
+    VkDeviceSize allocationSize = alignedSize;
+    if (strategy == VKDeviceMemoryStrategy::Buddy)
+        allocationSize = NextPowerOfTwo(std::max(minAllocationSize_, g_maxBuddyAllocationSize));
+    else if (strategy == VKDeviceMemoryStrategy::Linear)
+        allocationSize = std::max(minAllocationSize_, alignedSize);
+
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
+    /* Try to sub-allocate from an existing chunk of the same size class; dedicated chunks are never shared */
+    if (strategy != VKDeviceMemoryStrategy::Dedicated)
+    {
+        for (const auto& chunk : chunks_)
+        {
+            if (chunk->GetStrategy() == strategy &&
+                chunk->GetMemoryTypeIndex() == memoryTypeIndex &&
+                chunk->GetMaxAllocationSize() >= alignedSize)
+            {
+                /* Allocation can still fail if the alignment doesn't fit into any free block */
+                if (VKDeviceMemoryRegion* region = chunk->Allocate(size, alignment, reduceFragmentation_))
+                    return region;
+            }
+        }
 
-    if (VKDeviceMemory* chunk = FindOrAllocChunk(allocationSize, memoryTypeIndex, alignedSize))
-        return chunk->Allocate(size, alignment);
-    else
-        return nullptr;
+        if (debugger_ != nullptr)
+            ReportFragmentation(memoryTypeIndex, strategy, alignedSize);
+    }
+
+    /* Allocate new chunk */
+    VKDeviceMemory* chunk = AllocChunk(allocationSize, memoryTypeIndex, strategy);
+    return chunk->Allocate(size, alignment, reduceFragmentation_);
 }
 
 VKDeviceMemoryRegion* VKDeviceMemoryManager::Allocate(
@@ -61,6 +108,8 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
     {
         if (VKDeviceMemory* chunk = region->GetParentChunk())
         {
+            std::lock_guard<std::mutex> guard{ mutex_ };
+
             /* Release block in chunk */
             chunk->Release(region);
 
@@ -73,6 +122,7 @@ void VKDeviceMemoryManager::Release(VKDeviceMemoryRegion* region)
 
 VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     VKDeviceMemoryDetails details;
     {
         for (const auto& chunk : chunks_)
@@ -81,10 +131,39 @@ VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails() const
     return details;
 }
 
+VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetails(std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy) const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    return QueryDetailsInternal(memoryTypeIndex, strategy);
+}
+
+VkDeviceSize VKDeviceMemoryManager::GetHeapAllocatedSize(std::uint32_t heapIndex) const
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    VkDeviceSize size = 0;
+    for (const auto& chunk : chunks_)
+    {
+        if (memoryProperties_.memoryTypes[chunk->GetMemoryTypeIndex()].heapIndex == heapIndex)
+            size += chunk->GetSize();
+    }
+    return size;
+}
+
+bool VKDeviceMemoryManager::HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
+{
+    for_range(i, memoryProperties_.memoryTypeCount)
+    {
+        if ((memoryTypeBits & (1u << i)) != 0 && (memoryProperties_.memoryTypes[i].propertyFlags & properties) == properties)
+            return true;
+    }
+    return false;
+}
+
 #ifdef LLGL_DEBUG
 
 void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& title) const
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     std::size_t i = 0;
     for (const auto& chunk : chunks_)
     {
@@ -114,27 +193,69 @@ void VKDeviceMemoryManager::PrintBlocks(std::ostream& s, const std::string& titl
  * ======= Private: =======
  */
 
+VKDeviceMemoryDetails VKDeviceMemoryManager::QueryDetailsInternal(std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy) const
+{
+    VKDeviceMemoryDetails details;
+    {
+        for (const auto& chunk : chunks_)
+        {
+            if (chunk->GetMemoryTypeIndex() == memoryTypeIndex && chunk->GetStrategy() == strategy)
+                chunk->AccumDetails(details);
+        }
+    }
+    return details;
+}
+
 std::uint32_t VKDeviceMemoryManager::FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
 {
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex)
+VKDeviceMemoryStrategy VKDeviceMemoryManager::SelectStrategy(VkDeviceSize alignedSize) const
 {
-    return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex);
+    if (alignedSize <= g_maxBuddyAllocationSize)
+        return VKDeviceMemoryStrategy::Buddy;
+    if (alignedSize * 2 > minAllocationSize_)
+        return VKDeviceMemoryStrategy::Dedicated;
+    return VKDeviceMemoryStrategy::Linear;
 }
 
-VKDeviceMemory* VKDeviceMemoryManager::FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize)
+VKDeviceMemory* VKDeviceMemoryManager::AllocChunk(VkDeviceSize size, std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy)
 {
-    /* Search for a suitable chunk */
-    for (const auto& chunk : chunks_)
+    return chunks_.emplace<VKDeviceMemory>(device_, size, memoryTypeIndex, strategy, g_minBuddyBlockSize);
+}
+
+static const char* ToString(VKDeviceMemoryStrategy strategy)
+{
+    switch (strategy)
     {
-        if (chunk->GetMaxAllocationSize() >= minFreeBlockSize && chunk->GetMemoryTypeIndex() == memoryTypeIndex)
-            return chunk.get();
+        case VKDeviceMemoryStrategy::Linear:    return "linear";
+        case VKDeviceMemoryStrategy::Buddy:     return "buddy";
+        case VKDeviceMemoryStrategy::Dedicated: return "dedicated";
     }
+    return "";
+}
 
-    /* Allocate new chunk */
-    return AllocChunk(allocationSize, memoryTypeIndex);
+void VKDeviceMemoryManager::ReportFragmentation(std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy, VkDeviceSize requestedSize)
+{
+    const VKDeviceMemoryDetails details = QueryDetailsInternal(memoryTypeIndex, strategy);
+    const VkDeviceSize freeSize = details.allocatedSize - details.usedSize;
+    if (freeSize >= requestedSize)
+    {
+        debugger_->Warningf(
+            WarningType::ImproperState,
+            "fragmented Vulkan device memory (%s pool, memory type %u): allocating new chunk for %llu bytes "
+            "although %llu of %llu bytes are free in %zu chunks (%zu fragments, largest %llu bytes)",
+            ToString(strategy),
+            memoryTypeIndex,
+            static_cast<unsigned long long>(requestedSize),
+            static_cast<unsigned long long>(freeSize),
+            static_cast<unsigned long long>(details.allocatedSize),
+            details.numChunks,
+            details.numFragments,
+            static_cast<unsigned long long>(std::max(details.maxNewBlockSize, details.maxFragmentedBlockSize))
+        );
+    }
 }
 
 
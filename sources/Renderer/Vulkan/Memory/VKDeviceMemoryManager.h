@@ -17,17 +17,25 @@
 #include "VKDeviceMemoryRegion.h"
 #include <vector>
 #include <memory>
+#include <mutex>
 
 
 namespace LLGL
 {
 
 
+class RenderingDebugger;
+
 /*
 Vulkan device memory manager. Memory allocations are stored in a small hierarchy:
  - Chunk: denotes a single Vulkan memory allocation of type VkDeviceMemory
  - Block: denotes one of multiple regions inside a chunk of type VkBuffer
  - Region: denotes a sub-range inside a block and holds a reference to the VkBuffer and its offset and size (both of type VkDeviceSize).
+Allocations are separated into size classes, each with its own pool of chunks:
+ - Small: sub-allocated with the buddy strategy, which merges released blocks immediately and doesn't fragment over time.
+ - Medium: sub-allocated with the linear strategy.
+ - Large: each allocation gets a dedicated chunk, which is released together with its only block.
+All functions are thread-safe, since resources can be created and released on multiple threads.
 */
 class VKDeviceMemoryManager
 {
@@ -38,7 +46,8 @@ class VKDeviceMemoryManager
             VkDevice                                device,
             const VkPhysicalDeviceMemoryProperties& memoryProperties,
             VkDeviceSize                            minAllocationSize,
-            bool                                    reduceFragmentation
+            bool                                    reduceFragmentation,
+            RenderingDebugger*                      debugger            = nullptr
         );
 
         VKDeviceMemoryManager(const VKDeviceMemoryManager&) = delete;
@@ -64,6 +73,18 @@ class VKDeviceMemoryManager
         // Queries the memory details of all chunks.
         VKDeviceMemoryDetails QueryDetails() const;
 
+        // Queries the memory details of all chunks with the specified memory type and strategy.
+        VKDeviceMemoryDetails QueryDetails(std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy) const;
+
+        // Returns the total size of all chunks that have been allocated from the specified memory heap.
+        VkDeviceSize GetHeapAllocatedSize(std::uint32_t heapIndex) const;
+
+        // Returns true if any of the specified memory types has all of the specified properties.
+        bool HasMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+
+        // Finds a memory type index for the specified attributes.
+        std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+
         #ifdef LLGL_DEBUG
 
         void PrintBlocks(std::ostream& s, const std::string& title = "") const;
@@ -78,14 +99,17 @@ class VKDeviceMemoryManager
 
     private:
 
-        // Finds a memory type index for the specified attributes.
-        std::uint32_t FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const;
+        // Queries the memory details of all chunks with the specified memory type and strategy. The mutex must be locked.
+        VKDeviceMemoryDetails QueryDetailsInternal(std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy) const;
+
+        // Returns the sub-allocation strategy for the specified aligned allocation size.
+        VKDeviceMemoryStrategy SelectStrategy(VkDeviceSize alignedSize) const;
 
         // Allocates a new VkDeviceMemory chunk of the specified size and memory type.
-        VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex);
+        VKDeviceMemory* AllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy);
 
-        // Finds a suitable device memory chunk or allocates a new one.
-        VKDeviceMemory* FindOrAllocChunk(VkDeviceSize allocationSize, std::uint32_t memoryTypeIndex, VkDeviceSize minFreeBlockSize);
+        // Reports fragmentation statistics to the debugger when a new chunk is allocated although the pool has enough free memory.
+        void ReportFragmentation(std::uint32_t memoryTypeIndex, VKDeviceMemoryStrategy strategy, VkDeviceSize requestedSize);
 
     private:
 
@@ -94,7 +118,9 @@ class VKDeviceMemoryManager
 
         VkDeviceSize                                minAllocationSize_      = 1024*1024;
         bool                                        reduceFragmentation_    = false;
+        RenderingDebugger*                          debugger_               = nullptr;
 
+        mutable std::mutex                          mutex_;
         UnorderedUniquePtrVector<VKDeviceMemory>    chunks_;
 
 };
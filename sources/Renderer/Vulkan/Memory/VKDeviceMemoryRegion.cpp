@@ -27,9 +27,9 @@ void VKDeviceMemoryRegion::BindBuffer(VkDevice device, VkBuffer buffer)
     vkBindBufferMemory(device, buffer, deviceMemory_->GetVkDeviceMemory(), GetOffset());
 }
 
-void VKDeviceMemoryRegion::BindImage(VkDevice device, VkImage image)
+void VKDeviceMemoryRegion::BindImage(VkDevice device, VkImage image, VkDeviceSize relativeOffset)
 {
-    vkBindImageMemory(device, image, deviceMemory_->GetVkDeviceMemory(), GetOffset());
+    vkBindImageMemory(device, image, deviceMemory_->GetVkDeviceMemory(), GetOffset() + relativeOffset);
 }
 
 
@@ -30,8 +30,8 @@ class VKDeviceMemoryRegion
         // Binds the specified buffer to this memory region.
         void BindBuffer(VkDevice device, VkBuffer buffer);
 
-        // Binds the specified image to this memory region.
-        void BindImage(VkDevice device, VkImage image);
+        // Binds the specified image to this memory region. The relative offset is added to the offset of this region, e.g. for images that are placed into a larger region.
+        void BindImage(VkDevice device, VkImage image, VkDeviceSize relativeOffset = 0);
 
         // Returns the parent device memory chunk.
         inline VKDeviceMemory* GetParentChunk() const
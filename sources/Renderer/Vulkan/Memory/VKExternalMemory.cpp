@@ -0,0 +1,185 @@
+/*
+ * VKExternalMemory.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKExternalMemory.h"
+#include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/PrintfUtils.h"
+#include <string>
+
+
+namespace LLGL
+{
+
+
+VKExternalMemory::VKExternalMemory(
+    VkDevice                    device,
+    VkDeviceSize                size,
+    std::uint32_t               memoryTypeIndex,
+    VkImage                     image,
+    VkBuffer                    buffer,
+    const SharedResourceHandle* importHandle)
+:
+    deviceMemory_ { device, vkFreeMemory },
+    size_         { size                 }
+{
+    const void* allocInfoNext = nullptr;
+
+    /* Opaque handles must be imported with the same dedicated allocation they were exported with, so always use it if available */
+    VkMemoryDedicatedAllocateInfo dedicatedInfo;
+    if (HasExtension(VKExt::KHR_dedicated_allocation))
+    {
+        dedicatedInfo.sType     = VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO;
+        dedicatedInfo.pNext     = allocInfoNext;
+        dedicatedInfo.image     = image;
+        dedicatedInfo.buffer    = buffer;
+        allocInfoNext = &dedicatedInfo;
+    }
+
+    #if defined LLGL_OS_WIN32 && VK_KHR_external_memory_win32
+    VkImportMemoryWin32HandleInfoKHR importInfo;
+    #elif VK_KHR_external_memory_fd
+    VkImportMemoryFdInfoKHR importInfo;
+    #endif
+    VkExportMemoryAllocateInfo exportInfo;
+
+    if (importHandle != nullptr)
+    {
+        /* Imported allocation must have the exact size of the exported allocation */
+        if (importHandle->size < size)
+        {
+            LLGL_TRAP(
+                "cannot import shared Vulkan device memory of %" PRIu64 " byte(s) for resource that requires %" PRIu64 " byte(s)",
+                importHandle->size, static_cast<std::uint64_t>(size)
+            );
+        }
+        size_ = static_cast<VkDeviceSize>(importHandle->size);
+
+        #if defined LLGL_OS_WIN32 && VK_KHR_external_memory_win32
+        importInfo.sType        = VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR;
+        importInfo.pNext        = allocInfoNext;
+        importInfo.handleType   = GetVkHandleType();
+        importInfo.handle       = static_cast<HANDLE>(importHandle->handle);
+        importInfo.name         = nullptr;
+        allocInfoNext = &importInfo;
+        #elif VK_KHR_external_memory_fd
+        importInfo.sType        = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+        importInfo.pNext        = allocInfoNext;
+        importInfo.handleType   = GetVkHandleType();
+        importInfo.fd           = static_cast<int>(importHandle->fd);
+        allocInfoNext = &importInfo;
+        #endif
+    }
+    else
+    {
+        exportInfo.sType        = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+        exportInfo.pNext        = allocInfoNext;
+        exportInfo.handleTypes  = GetVkHandleType();
+        allocInfoNext = &exportInfo;
+    }
+
+    /* Allocate or import device memory */
+    VkMemoryAllocateInfo allocInfo;
+    {
+        allocInfo.sType             = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.pNext             = allocInfoNext;
+        allocInfo.allocationSize    = size_;
+        allocInfo.memoryTypeIndex   = memoryTypeIndex;
+    }
+    VkResult result = vkAllocateMemory(device, &allocInfo, nullptr, deviceMemory_.ReleaseAndGetAddressOf());
+
+    if (result != VK_SUCCESS)
+    {
+        std::string info = (importHandle != nullptr ? "failed to import shared Vulkan device memory of " : "failed to allocate shared Vulkan device memory of ");
+        info += std::to_string(size_);
+        info += " bytes";
+        VKThrowIfFailed(result, info.c_str());
+    }
+}
+
+bool VKExternalMemory::Export(VkDevice device, SharedResourceHandle& outHandle) const
+{
+    #if defined LLGL_OS_WIN32 && VK_KHR_external_memory_win32
+
+    VkMemoryGetWin32HandleInfoKHR getInfo;
+    {
+        getInfo.sType       = VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR;
+        getInfo.pNext       = nullptr;
+        getInfo.memory      = GetVkDeviceMemory();
+        getInfo.handleType  = GetVkHandleType();
+    }
+    HANDLE handle = nullptr;
+    if (vkGetMemoryWin32HandleKHR(device, &getInfo, &handle) != VK_SUCCESS)
+        return false;
+
+    outHandle.type      = SharedHandleType::OpaqueWin32;
+    outHandle.handle    = handle;
+    outHandle.size      = size_;
+    return true;
+
+    #elif VK_KHR_external_memory_fd
+
+    VkMemoryGetFdInfoKHR getInfo;
+    {
+        getInfo.sType       = VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR;
+        getInfo.pNext       = nullptr;
+        getInfo.memory      = GetVkDeviceMemory();
+        getInfo.handleType  = GetVkHandleType();
+    }
+    int fd = -1;
+    if (vkGetMemoryFdKHR(device, &getInfo, &fd) != VK_SUCCESS)
+        return false;
+
+    outHandle.type      = SharedHandleType::OpaqueFD;
+    outHandle.fd        = static_cast<std::int32_t>(fd);
+    outHandle.size      = size_;
+    return true;
+
+    #else
+
+    return false;
+
+    #endif
+}
+
+bool VKExternalMemory::IsSupported()
+{
+    #if defined LLGL_OS_WIN32 && VK_KHR_external_memory_win32
+    return HasExtension(VKExt::KHR_external_memory_win32);
+    #elif VK_KHR_external_memory_fd
+    return HasExtension(VKExt::KHR_external_memory_fd);
+    #else
+    return false;
+    #endif
+}
+
+SharedHandleType VKExternalMemory::GetSharedHandleType()
+{
+    #if defined LLGL_OS_WIN32
+    return SharedHandleType::OpaqueWin32;
+    #else
+    return SharedHandleType::OpaqueFD;
+    #endif
+}
+
+VkExternalMemoryHandleTypeFlagBits VKExternalMemory::GetVkHandleType()
+{
+    #if defined LLGL_OS_WIN32
+    return VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT;
+    #else
+    return VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+    #endif
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
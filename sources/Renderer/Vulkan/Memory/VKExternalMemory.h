@@ -0,0 +1,80 @@
+/*
+ * VKExternalMemory.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_EXTERNAL_MEMORY_H
+#define LLGL_VK_EXTERNAL_MEMORY_H
+
+
+#include "../Vulkan.h"
+#include "../VKPtr.h"
+#include <LLGL/ResourceFlags.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+// Dedicated device memory allocation of a single image or buffer that is exported to or imported from another Vulkan device or process.
+class VKExternalMemory
+{
+
+    public:
+
+        // Allocates exportable device memory for either the specified image or buffer, or imports it from 'importHandle' if it is non-null.
+        VKExternalMemory(
+            VkDevice                    device,
+            VkDeviceSize                size,
+            std::uint32_t               memoryTypeIndex,
+            VkImage                     image,
+            VkBuffer                    buffer,
+            const SharedResourceHandle* importHandle    = nullptr
+        );
+
+        VKExternalMemory(const VKExternalMemory&) = delete;
+        VKExternalMemory& operator = (const VKExternalMemory&) = delete;
+
+        // Exports a new native handle of this device memory. The caller takes ownership of the handle.
+        bool Export(VkDevice device, SharedResourceHandle& outHandle) const;
+
+        // Returns true if external memory is supported by the loaded device extensions.
+        static bool IsSupported();
+
+        // Returns the shared handle type that is used on this platform.
+        static SharedHandleType GetSharedHandleType();
+
+        // Returns the Vulkan external memory handle type that is used on this platform.
+        static VkExternalMemoryHandleTypeFlagBits GetVkHandleType();
+
+        // Returns the native device memory object.
+        inline VkDeviceMemory GetVkDeviceMemory() const
+        {
+            return deviceMemory_.Get();
+        }
+
+        // Returns the size of the entire allocation. This is passed on to the importer.
+        inline VkDeviceSize GetSize() const
+        {
+            return size_;
+        }
+
+    private:
+
+        VKPtr<VkDeviceMemory>   deviceMemory_;
+        VkDeviceSize            size_           = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
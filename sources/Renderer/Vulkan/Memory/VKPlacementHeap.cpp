@@ -0,0 +1,47 @@
+/*
+ * VKPlacementHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKPlacementHeap.h"
+#include "VKDeviceMemoryManager.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/PrintfUtils.h"
+
+
+namespace LLGL
+{
+
+
+// Alignment of the memory region of a placement heap; this is large enough for the placement of any image, including MSAA images.
+static constexpr VkDeviceSize g_placementHeapAlignment = 0x10000;
+
+VKPlacementHeap::VKPlacementHeap(VKDeviceMemoryManager& deviceMemoryMngr, const PlacementHeapDescriptor& desc, std::uint32_t memoryTypeBits) :
+    PlacementHeap     { desc.size        },
+    deviceMemoryMngr_ { deviceMemoryMngr }
+{
+    memoryRegion_ = deviceMemoryMngr.Allocate(
+        GetAlignedSize(static_cast<VkDeviceSize>(desc.size), g_placementHeapAlignment),
+        g_placementHeapAlignment,
+        memoryTypeBits,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+    );
+
+    if (memoryRegion_ == nullptr)
+        LLGL_TRAP("failed to allocate 0x%016" PRIX64 " bytes of device memory for Vulkan placement heap", desc.size);
+}
+
+VKPlacementHeap::~VKPlacementHeap()
+{
+    deviceMemoryMngr_.Release(memoryRegion_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
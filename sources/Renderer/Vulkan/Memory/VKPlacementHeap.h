@@ -0,0 +1,60 @@
+/*
+ * VKPlacementHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_PLACEMENT_HEAP_H
+#define LLGL_VK_PLACEMENT_HEAP_H
+
+
+#include <LLGL/PlacementHeap.h>
+#include <vulkan/vulkan.h>
+#include <cstdint>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryRegion;
+class VKDeviceMemoryManager;
+
+// Holds a single device local memory region that is shared by all textures placed into this heap.
+class VKPlacementHeap final : public PlacementHeap
+{
+
+    public:
+
+        // Allocates the memory region for the specified heap descriptor with a memory type that is compatible with the specified memory type bits.
+        VKPlacementHeap(VKDeviceMemoryManager& deviceMemoryMngr, const PlacementHeapDescriptor& desc, std::uint32_t memoryTypeBits);
+
+        // Releases the memory region; all textures placed into this heap must have been released before.
+        ~VKPlacementHeap();
+
+        VKPlacementHeap(const VKPlacementHeap&) = delete;
+        VKPlacementHeap& operator = (const VKPlacementHeap&) = delete;
+
+        // Returns the memory region of this heap.
+        inline VKDeviceMemoryRegion* GetMemoryRegion() const
+        {
+            return memoryRegion_;
+        }
+
+    private:
+
+        VKDeviceMemoryManager&  deviceMemoryMngr_;
+        VKDeviceMemoryRegion*   memoryRegion_       = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
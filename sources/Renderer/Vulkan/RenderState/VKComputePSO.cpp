@@ -14,6 +14,9 @@
 #include "../../PipelineStateUtils.h"
 #include "../../../Core/StringUtils.h"
 #include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string>
+#include <vector>
 #include <cstddef>
 
 
@@ -24,15 +27,76 @@ namespace LLGL
 VKComputePSO::VKComputePSO(
     VkDevice                            device,
     const ComputePipelineDescriptor&    desc,
-    PipelineCache*                      pipelineCache)
+    PipelineCache*                      pipelineCache,
+    VKComputePipelineCreateInfo*        deferredCreateInfo)
 :
     VKPipelineState { device, VK_PIPELINE_BIND_POINT_COMPUTE, GetShadersAsArray(desc), desc.pipelineLayout }
 {
-    /* Create Vulkan compute pipeline object */
-    if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, desc, pipelineCacheVK->GetNative());
-    else
-        CreateVkPipeline(device, desc);
+    /* Only fill the create-info if the native PSO is created in a batch with other PSOs, see CreateVkPipelines() */
+    if (deferredCreateInfo != nullptr)
+    {
+        deferredCreateInfo->isValid = FillVkPipelineCreateInfo(desc, *deferredCreateInfo);
+        return;
+    }
+
+    /* Create Vulkan compute pipeline object; the descriptor is copied, since it might be compiled on a worker thread */
+    const VkPipelineCache   pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache)->GetNative() : VK_NULL_HANDLE);
+    const std::string       debugName       = (desc.debugName != nullptr ? desc.debugName : "");
+    const bool              isAsync         = ((desc.flags & PipelineStateFlags::AsyncCompilation) != 0);
+    ComputePipelineDescriptor descCopy = desc;
+
+    RunCompilation(
+        isAsync,
+        [this, device, descCopy, debugName, pipelineCacheVK]() mutable
+        {
+            descCopy.debugName = (debugName.empty() ? nullptr : debugName.c_str());
+            CreateVkPipeline(device, descCopy, pipelineCacheVK);
+        }
+    );
+}
+
+void VKComputePSO::CreateVkPipelines(
+    VkDevice                            device,
+    std::size_t                         numPipelineStates,
+    VKComputePSO* const *               pipelineStates,
+    const VKComputePipelineCreateInfo*  createInfos,
+    PipelineCache*                      pipelineCache)
+{
+    /* Gather all valid create-infos into a contiguous array for a single native call */
+    std::vector<VkComputePipelineCreateInfo> createInfosVK;
+    std::vector<VKComputePSO*> batchedPipelineStates;
+    createInfosVK.reserve(numPipelineStates);
+    batchedPipelineStates.reserve(numPipelineStates);
+
+    for_range(i, numPipelineStates)
+    {
+        if (createInfos[i].isValid)
+        {
+            createInfosVK.push_back(createInfos[i].createInfo);
+            batchedPipelineStates.push_back(pipelineStates[i]);
+        }
+    }
+
+    if (createInfosVK.empty())
+        return;
+
+    /* Create all native PSOs at once; the driver may compile them in parallel */
+    const VkPipelineCache pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache)->GetNative() : VK_NULL_HANDLE);
+    std::vector<VkPipeline> pipelinesVK(createInfosVK.size(), VK_NULL_HANDLE);
+    VkResult result = vkCreateComputePipelines(
+        device,
+        pipelineCacheVK,
+        static_cast<std::uint32_t>(createInfosVK.size()),
+        createInfosVK.data(),
+        nullptr,
+        pipelinesVK.data()
+    );
+
+    /* Hand over all native PSOs before checking the result, since some of them might have been created even if the call failed */
+    for_range(i, pipelinesVK.size())
+        *(batchedPipelineStates[i]->ReleaseAndGetAddressOfVkPipeline()) = pipelinesVK[i];
+
+    VKThrowIfFailed(result, "failed to create Vulkan compute pipelines");
 }
 
 
@@ -44,6 +108,21 @@ bool VKComputePSO::CreateVkPipeline(
     VkDevice                            device,
     const ComputePipelineDescriptor&    desc,
     VkPipelineCache                     pipelineCache)
+{
+    VKComputePipelineCreateInfo createInfo;
+    if (!FillVkPipelineCreateInfo(desc, createInfo))
+        return false;
+
+    /* Create compute pipeline state object */
+    VkResult result = vkCreateComputePipelines(device, pipelineCache, 1, &(createInfo.createInfo), nullptr, ReleaseAndGetAddressOfVkPipeline());
+    VKThrowIfFailed(result, "failed to create Vulkan compute pipeline");
+
+    return true;
+}
+
+bool VKComputePSO::FillVkPipelineCreateInfo(
+    const ComputePipelineDescriptor&    desc,
+    VKComputePipelineCreateInfo&        outCreateInfo)
 {
     /* Get compute shader */
     VKShader* computeShaderVK = LLGL_CAST(VKShader*, desc.computeShader);
@@ -60,12 +139,14 @@ bool VKComputePSO::CreateVkPipeline(
         return false;
     }
 
-    /* Get shader stages */
+    /* Get shader stages with optional specialization constants */
+    const VkSpecializationInfo* specializationInfoPtr = FillSpecializationInfo(desc.specializationConstants, outCreateInfo.specializationInfo, outCreateInfo.specializationMapEntries);
+
     VkPipelineShaderStageCreateInfo shaderStageCreateInfo;
-    GetShaderCreateInfoAndOptionalPermutation(*computeShaderVK, shaderStageCreateInfo);
+    GetShaderCreateInfoAndOptionalPermutation(*computeShaderVK, shaderStageCreateInfo, specializationInfoPtr);
 
-    /* Create graphics pipeline state object */
-    VkComputePipelineCreateInfo createInfo;
+    /* Initialize compute pipeline create-info */
+    VkComputePipelineCreateInfo& createInfo = outCreateInfo.createInfo;
     {
         createInfo.sType                = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
         createInfo.pNext                = nullptr;
@@ -75,8 +156,6 @@ bool VKComputePSO::CreateVkPipeline(
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
-    VkResult result = vkCreateComputePipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
-    VKThrowIfFailed(result, "failed to create Vulkan compute pipeline");
 
     return true;
 }
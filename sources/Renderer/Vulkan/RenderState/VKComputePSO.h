@@ -10,12 +10,27 @@
 
 
 #include "VKPipelineState.h"
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+// Storage for a native compute pipeline create-info and the specialization info it refers to. See VKGraphicsPipelineCreateInfo.
+struct VKComputePipelineCreateInfo
+{
+    VKComputePipelineCreateInfo() = default;
+    VKComputePipelineCreateInfo(const VKComputePipelineCreateInfo&) = delete;
+    VKComputePipelineCreateInfo& operator = (const VKComputePipelineCreateInfo&) = delete;
+
+    VkComputePipelineCreateInfo             createInfo;
+    bool                                    isValid                 = false; // False if the create-info could not be filled, e.g. due to a shader error.
+
+    VkSpecializationInfo                    specializationInfo;
+    std::vector<VkSpecializationMapEntry>   specializationMapEntries;
+};
+
 struct ComputePipelineDescriptor;
 class PipelineCache;
 
@@ -27,7 +42,20 @@ class VKComputePSO final : public VKPipelineState
         VKComputePSO(
             VkDevice                            device,
             const ComputePipelineDescriptor&    desc,
-            PipelineCache*                      pipelineCache = nullptr
+            PipelineCache*                      pipelineCache       = nullptr,
+            VKComputePipelineCreateInfo*        deferredCreateInfo  = nullptr
+        );
+
+        /*
+        Creates the native PSOs of all specified compute PSOs with a single call to 'vkCreateComputePipelines'.
+        Each PSO must have been constructed with the deferred create-info at the same index. Entries that could not be filled are skipped.
+        */
+        static void CreateVkPipelines(
+            VkDevice                            device,
+            std::size_t                         numPipelineStates,
+            VKComputePSO* const *               pipelineStates,
+            const VKComputePipelineCreateInfo*  createInfos,
+            PipelineCache*                      pipelineCache       = nullptr
         );
 
     private:
@@ -38,6 +66,12 @@ class VKComputePSO final : public VKPipelineState
             VkPipelineCache                     pipelineCache = VK_NULL_HANDLE
         );
 
+        // Fills the native create-info for this PSO without creating the native PSO. Returns false if the descriptor is invalid.
+        bool FillVkPipelineCreateInfo(
+            const ComputePipelineDescriptor&    desc,
+            VKComputePipelineCreateInfo&        outCreateInfo
+        );
+
 };
 
 
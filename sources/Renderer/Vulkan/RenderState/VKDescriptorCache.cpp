@@ -56,6 +56,7 @@ VKDescriptorCache::VKDescriptorCache(
 
     /* Pre-allocate VkCopyDescriptorSet array */
     BuildCopyDescriptors(bindings);
+    BuildDynamicOffsets(bindings);
 }
 
 void VKDescriptorCache::Reset()
@@ -68,7 +69,7 @@ void VKDescriptorCache::EmplaceDescriptor(Resource& resource, const VKLayoutBind
     switch (resource.GetResourceType())
     {
         case ResourceType::Buffer:
-            EmplaceBufferDescriptor(LLGL_CAST(VKBuffer&, resource), binding, setWriter);
+            EmplaceBufferDescriptor(LLGL_CAST(VKBuffer&, resource), binding, 0, VK_WHOLE_SIZE, setWriter);
             dirty_ = true;
             break;
 
@@ -87,6 +88,28 @@ void VKDescriptorCache::EmplaceDescriptor(Resource& resource, const VKLayoutBind
     }
 }
 
+void VKDescriptorCache::EmplaceBufferRange(VKBuffer& bufferVK, const VKLayoutBinding& binding, VkDeviceSize offset, VkDeviceSize size, VKDescriptorSetWriter& setWriter)
+{
+    if (binding.dynamicOffsetIndex < dynamicOffsets_.size())
+    {
+        /* Only write new descriptor if the buffer or range size has changed, otherwise the new range only needs a different dynamic offset */
+        const VkDescriptorBufferInfo& bufferInfo = dynamicBufferInfos_[binding.dynamicOffsetIndex];
+        if (bufferInfo.buffer != bufferVK.GetVkBuffer() || bufferInfo.offset != 0 || bufferInfo.range != size)
+        {
+            EmplaceBufferDescriptor(bufferVK, binding, 0, size, setWriter);
+            dirty_ = true;
+        }
+        dynamicOffsets_[binding.dynamicOffsetIndex] = static_cast<std::uint32_t>(offset);
+        dynamicOffsetsDirty_ = true;
+    }
+    else
+    {
+        /* Write buffer range into descriptor */
+        EmplaceBufferDescriptor(bufferVK, binding, offset, size, setWriter);
+        dirty_ = true;
+    }
+}
+
 VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter)
 {
     if (!dirty_ || setLayout_ == VK_NULL_HANDLE)
@@ -114,11 +137,19 @@ VkDescriptorSet VKDescriptorCache::FlushDescriptorSet(VKStagingDescriptorSetPool
 
     /* Clear cache after updated  */
     dirty_ = false;
+    dynamicOffsetsDirty_ = false;
 
     return descriptorSetCopy;
 }
 
 
+ArrayView<std::uint32_t> VKDescriptorCache::FlushDynamicOffsets()
+{
+    dynamicOffsetsDirty_ = false;
+    return ArrayView<std::uint32_t>{ dynamicOffsets_.data(), dynamicOffsets_.size() };
+}
+
+
 /*
  * ======= Private: =======
  */
@@ -149,14 +180,22 @@ VkDescriptorImageInfo* VKDescriptorCache::NextImageInfoOrUpdateCache(VKDescripto
     return info;
 }
 
-void VKDescriptorCache::EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter)
+void VKDescriptorCache::EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VkDeviceSize offset, VkDeviceSize size, VKDescriptorSetWriter& setWriter)
 {
     auto bufferInfo = NextBufferInfoOrUpdateCache(setWriter);
     {
         bufferInfo->buffer  = bufferVK.GetVkBuffer();
-        bufferInfo->offset  = 0;
-        bufferInfo->range   = VK_WHOLE_SIZE;
+        bufferInfo->offset  = offset;
+        bufferInfo->range   = size;
     }
+
+    /* Keep track of buffer ranges and reset dynamic offset for dynamic uniform buffers */
+    if (binding.dynamicOffsetIndex < dynamicOffsets_.size())
+    {
+        dynamicBufferInfos_[binding.dynamicOffsetIndex] = *bufferInfo;
+        dynamicOffsets_[binding.dynamicOffsetIndex] = 0;
+    }
+
     auto writeDesc = setWriter.NextWriteDescriptor();
     {
         writeDesc->dstSet           = descriptorSet_;
@@ -315,6 +354,19 @@ void VKDescriptorCache::BuildCopyDescriptors(ArrayView<VKLayoutBinding> bindings
     FlushBindingsToCopyDesc();
 }
 
+void VKDescriptorCache::BuildDynamicOffsets(const ArrayView<VKLayoutBinding>& bindings)
+{
+    /* Allocate dynamic offsets for all dynamic uniform buffers; These must always be specified when the descriptor set is bound */
+    std::size_t numDynamicOffsets = 0;
+    for (const VKLayoutBinding& binding : bindings)
+    {
+        if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+            ++numDynamicOffsets;
+    }
+    dynamicOffsets_.resize(numDynamicOffsets, 0);
+    dynamicBufferInfos_.resize(numDynamicOffsets, VkDescriptorBufferInfo{ VK_NULL_HANDLE, 0, 0 });
+}
+
 void VKDescriptorCache::UpdateCopyDescriptorSet(VkDescriptorSet dstSet)
 {
     for (VkCopyDescriptorSet& copyDesc : copyDescs_)
@@ -322,6 +374,119 @@ void VKDescriptorCache::UpdateCopyDescriptorSet(VkDescriptorSet dstSet)
 }
 
 
+/*
+ * VKPushDescriptorCache class
+ */
+
+void VKPushDescriptorCache::Reset(const ArrayView<VKLayoutBinding>& bindings)
+{
+    writes_.resize(bindings.size());
+    infos_.resize(bindings.size());
+
+    for_range(i, bindings.size())
+    {
+        VkWriteDescriptorSet& writeDesc = writes_[i];
+        {
+            writeDesc.sType             = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            writeDesc.pNext             = nullptr;
+            writeDesc.dstSet            = VK_NULL_HANDLE; // Ignored by vkCmdPushDescriptorSetKHR
+            writeDesc.dstBinding        = bindings[i].dstBinding;
+            writeDesc.dstArrayElement   = bindings[i].dstArrayElement;
+            writeDesc.descriptorCount   = 0;
+            writeDesc.descriptorType    = bindings[i].descriptorType;
+            writeDesc.pImageInfo        = nullptr;
+            writeDesc.pBufferInfo       = nullptr;
+            writeDesc.pTexelBufferView  = nullptr;
+        }
+    }
+
+    flushedWrites_.clear();
+    flushedWrites_.reserve(bindings.size());
+    dirty_ = false;
+}
+
+void VKPushDescriptorCache::Invalidate()
+{
+    dirty_ = true;
+}
+
+void VKPushDescriptorCache::EmplaceDescriptor(Resource& resource, std::uint32_t descriptor)
+{
+    if (!(descriptor < writes_.size()))
+        return /*Out of bounds*/;
+
+    VkWriteDescriptorSet& writeDesc = writes_[descriptor];
+    DescriptorInfo& info = infos_[descriptor];
+
+    switch (resource.GetResourceType())
+    {
+        case ResourceType::Buffer:
+            EmplaceBufferRange(LLGL_CAST(VKBuffer&, resource), descriptor, 0, VK_WHOLE_SIZE);
+            break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureVK = LLGL_CAST(VKTexture&, resource);
+            info.image.sampler          = VK_NULL_HANDLE;
+            info.image.imageView        = textureVK.GetVkImageView();
+            info.image.imageLayout      = GetShaderReadOptimalImageLayout(writeDesc.descriptorType, textureVK.GetFormat());
+            writeDesc.descriptorCount   = 1;
+            writeDesc.pImageInfo        = &(info.image);
+            writeDesc.pBufferInfo       = nullptr;
+            dirty_ = true;
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            auto& samplerVK = LLGL_CAST(VKSampler&, resource);
+            info.image.sampler          = samplerVK.GetVkSampler();
+            info.image.imageView        = VK_NULL_HANDLE;
+            info.image.imageLayout      = VK_IMAGE_LAYOUT_UNDEFINED;
+            writeDesc.descriptorCount   = 1;
+            writeDesc.pImageInfo        = &(info.image);
+            writeDesc.pBufferInfo       = nullptr;
+            dirty_ = true;
+        }
+        break;
+
+        default:
+            break;
+    }
+}
+
+void VKPushDescriptorCache::EmplaceBufferRange(VKBuffer& bufferVK, std::uint32_t descriptor, VkDeviceSize offset, VkDeviceSize size)
+{
+    if (!(descriptor < writes_.size()))
+        return /*Out of bounds*/;
+
+    VkWriteDescriptorSet& writeDesc = writes_[descriptor];
+    DescriptorInfo& info = infos_[descriptor];
+    {
+        info.buffer.buffer          = bufferVK.GetVkBuffer();
+        info.buffer.offset          = offset;
+        info.buffer.range           = size;
+        writeDesc.descriptorCount   = 1;
+        writeDesc.pImageInfo        = nullptr;
+        writeDesc.pBufferInfo       = &(info.buffer);
+    }
+    dirty_ = true;
+}
+
+ArrayView<VkWriteDescriptorSet> VKPushDescriptorCache::FlushDescriptorWrites()
+{
+    /* Push all written descriptors, since unwritten descriptors of a push descriptor set are undefined */
+    flushedWrites_.clear();
+    for (const VkWriteDescriptorSet& writeDesc : writes_)
+    {
+        if (writeDesc.descriptorCount > 0)
+            flushedWrites_.push_back(writeDesc);
+    }
+    dirty_ = false;
+    return ArrayView<VkWriteDescriptorSet>{ flushedWrites_.data(), flushedWrites_.size() };
+}
+
+
 } // /namespace LLGL
 
 
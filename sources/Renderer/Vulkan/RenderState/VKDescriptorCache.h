@@ -14,6 +14,7 @@
 #include "VKDescriptorSetWriter.h"
 #include <LLGL/Container/SmallVector.h>
 #include <LLGL/Container/ArrayView.h>
+#include <vector>
 #include <mutex>
 
 
@@ -48,18 +49,33 @@ class VKDescriptorCache
         // Emplaces a descriptor into the cache for the specified resource.
         void EmplaceDescriptor(Resource& resource, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
 
+        /*
+        Emplaces a descriptor into the cache for the specified buffer range.
+        For dynamic uniform buffers, only the dynamic offset is changed if the same buffer with the same range size is already cached.
+        */
+        void EmplaceBufferRange(VKBuffer& bufferVK, const VKLayoutBinding& binding, VkDeviceSize offset, VkDeviceSize size, VKDescriptorSetWriter& setWriter);
+
         /*
         Flushes all changed descriptor by allocating a new descriptor set.
         Otherwise, no changes took place (i.e. IsInvalidated() is false) and VK_NULL_HANDLE is returned.
         */
         VkDescriptorSet FlushDescriptorSet(VKStagingDescriptorSetPool& pool, VKDescriptorSetWriter& setWriter);
 
+        // Returns the dynamic offsets for all dynamic uniform buffers and clears the invalidation state of the dynamic offsets.
+        ArrayView<std::uint32_t> FlushDynamicOffsets();
+
         // Returns true if any cache entries are invalidated and need to be flushed again.
         inline bool IsInvalidated() const
         {
             return dirty_;
         }
 
+        // Returns true if only the dynamic offsets have changed, in which case the previous descriptor set can be bound again with the new offsets.
+        inline bool HasDynamicOffsetsChanged() const
+        {
+            return dynamicOffsetsDirty_;
+        }
+
         // Returns the total number of descriptors handled by this cache. The VKDescriptorSetWriter must hold at least this many descriptors.
         inline std::uint32_t GetNumDescriptors() const
         {
@@ -71,11 +87,12 @@ class VKDescriptorCache
         VkDescriptorBufferInfo* NextBufferInfoOrUpdateCache(VKDescriptorSetWriter& setWriter);
         VkDescriptorImageInfo* NextImageInfoOrUpdateCache(VKDescriptorSetWriter& setWriter);
 
-        void EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
+        void EmplaceBufferDescriptor(VKBuffer& bufferVK, const VKLayoutBinding& binding, VkDeviceSize offset, VkDeviceSize size, VKDescriptorSetWriter& setWriter);
         void EmplaceTextureDescriptor(VKTexture& textureVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
         void EmplaceSamplerDescriptor(VKSampler& samplerVK, const VKLayoutBinding& binding, VKDescriptorSetWriter& setWriter);
 
         void BuildCopyDescriptors(ArrayView<VKLayoutBinding> bindings);
+        void BuildDynamicOffsets(const ArrayView<VKLayoutBinding>& bindings);
         void UpdateCopyDescriptorSet(VkDescriptorSet dstSet);
 
     private:
@@ -89,7 +106,58 @@ class VKDescriptorCache
         SmallVector<VkCopyDescriptorSet, 4>     copyDescs_;
         std::mutex                              copyDescMutex_;
 
-        bool                                    dirty_          = false;
+        SmallVector<std::uint32_t, 4>           dynamicOffsets_;                    // Dynamic offsets for VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC.
+        SmallVector<VkDescriptorBufferInfo, 4>  dynamicBufferInfos_;                // Buffer descriptors currently written for dynamic uniform buffers.
+
+        bool                                    dirty_                  = false;
+        bool                                    dynamicOffsetsDirty_    = false;
+
+};
+
+/*
+Per command buffer cache of dynamic descriptors that are pushed with VK_KHR_push_descriptor instead of allocating descriptor sets.
+Only used for pipeline layouts with push descriptor sets, see VKPipelineLayout::HasPushDescriptorSet().
+*/
+class VKPushDescriptorCache
+{
+
+    public:
+
+        // Resets all descriptors for the specified layout bindings. Must be called whenever a different pipeline layout is bound.
+        void Reset(const ArrayView<VKLayoutBinding>& bindings);
+
+        // Invalidates the cache, so all written descriptors are pushed again with the next flush.
+        void Invalidate();
+
+        // Emplaces a descriptor into the cache for the specified resource at the specified layout binding index.
+        void EmplaceDescriptor(Resource& resource, std::uint32_t descriptor);
+
+        // Emplaces a descriptor into the cache for the specified buffer range at the specified layout binding index.
+        void EmplaceBufferRange(VKBuffer& bufferVK, std::uint32_t descriptor, VkDeviceSize offset, VkDeviceSize size);
+
+        // Returns all written descriptors for 'vkCmdPushDescriptorSetKHR' and clears the invalidation state.
+        ArrayView<VkWriteDescriptorSet> FlushDescriptorWrites();
+
+        // Returns true if any descriptors have changed and need to be pushed again.
+        inline bool IsInvalidated() const
+        {
+            return dirty_;
+        }
+
+    private:
+
+        union DescriptorInfo
+        {
+            VkDescriptorBufferInfo  buffer;
+            VkDescriptorImageInfo   image;
+        };
+
+    private:
+
+        std::vector<VkWriteDescriptorSet>   writes_;        // One write per layout binding; 'descriptorCount' is 0 for unwritten bindings.
+        std::vector<DescriptorInfo>         infos_;
+        std::vector<VkWriteDescriptorSet>   flushedWrites_; // Compacted list of written descriptors.
+        bool                                dirty_  = false;
 
 };
 
@@ -6,16 +6,69 @@
  */
 
 #include "VKFence.h"
+#include "../Command/VKCommandQueue.h"
 #include "../VKCore.h"
+#include "../Ext/VKExtensions.h"
+#include "../Ext/VKExtensionRegistry.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Backend/Vulkan/NativeHandle.h>
 
 
 namespace LLGL
 {
 
 
-VKFence::VKFence(VkDevice device) :
-    fence_ { device, vkDestroyFence }
+static VkExternalSemaphoreHandleTypeFlagBits GetVkSemaphoreHandleType()
 {
+    #if defined LLGL_OS_WIN32
+    return VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_BIT;
+    #else
+    return VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT;
+    #endif
+}
+
+VKFence::VKFence(VkDevice device, bool useTimelineSemaphore, bool exportable) :
+    device_         { device                                },
+    fence_          { device, vkDestroyFence                },
+    semaphore_      { device, vkDestroySemaphore            },
+    isTimeline_     { useTimelineSemaphore                  },
+    isExportable_   { useTimelineSemaphore && exportable    }
+{
+    #if VK_KHR_timeline_semaphore
+    if (isTimeline_)
+    {
+        /* Allow exporting the timeline semaphore to external APIs such as hardware video encoders */
+        VkExportSemaphoreCreateInfo exportCreateInfo;
+        if (isExportable_)
+        {
+            exportCreateInfo.sType          = VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO;
+            exportCreateInfo.pNext          = nullptr;
+            exportCreateInfo.handleTypes    = GetVkSemaphoreHandleType();
+        }
+
+        /* Create timeline semaphore with initial value of zero */
+        VkSemaphoreTypeCreateInfoKHR typeCreateInfo;
+        {
+            typeCreateInfo.sType            = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+            typeCreateInfo.pNext            = (isExportable_ ? &exportCreateInfo : nullptr);
+            typeCreateInfo.semaphoreType    = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+            typeCreateInfo.initialValue     = 0;
+        }
+        VkSemaphoreCreateInfo createInfo;
+        {
+            createInfo.sType                = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            createInfo.pNext                = &typeCreateInfo;
+            createInfo.flags                = 0;
+        }
+        VkResult result = vkCreateSemaphore(device, &createInfo, nullptr, semaphore_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan timeline semaphore");
+        return;
+    }
+    #else
+    isTimeline_     = false;
+    isExportable_   = false;
+    #endif // /VK_KHR_timeline_semaphore
+
     VkFenceCreateInfo createInfo;
     {
         createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -26,16 +79,198 @@ VKFence::VKFence(VkDevice device) :
     VKThrowIfFailed(result, "failed to create Vulkan fence");
 }
 
+bool VKFence::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (auto* nativeHandleVK = GetTypedNativeHandle<Vulkan::FenceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        nativeHandleVK->fence       = fence_.Get();
+        nativeHandleVK->semaphore   = (isTimeline_ ? semaphore_.Get() : VK_NULL_HANDLE);
+        nativeHandleVK->value       = timelineValue_;
+        isShared_ = true;
+        return true;
+    }
+    return false;
+}
+
+bool VKFence::IsSignaled()
+{
+    if (isTimeline_)
+    {
+        /* Submit the signal operation first if a queue still defers it; this only happens once per deferred signal */
+        if (deferredSignalQueue_ != nullptr)
+            deferredSignalQueue_->FlushDeferredSignals();
+        return WaitTimeline(device_, 0);
+    }
+
+    /* Binary fences are unsignaled until they are submitted for the first time */
+    if (semaphoreState_ == SemaphoreState::Unused)
+        return true;
+    return (vkGetFenceStatus(device_, fence_.Get()) == VK_SUCCESS);
+}
+
 void VKFence::Reset(VkDevice device)
 {
-    vkResetFences(device, 1, fence_.GetAddressOf());
+    /* Timeline semaphores are never reset, their value only increases */
+    if (!isTimeline_)
+        vkResetFences(device, 1, fence_.GetAddressOf());
 }
 
 bool VKFence::Wait(VkDevice device, std::uint64_t timeout)
 {
+    if (isTimeline_)
+        return WaitTimeline(device, timeout);
     return (vkWaitForFences(device, 1, fence_.GetAddressOf(), VK_TRUE, timeout) == VK_SUCCESS);
 }
 
+VkSemaphore VKFence::GetOrCreateVkSemaphore(VkDevice device)
+{
+    if (semaphore_.Get() == VK_NULL_HANDLE)
+    {
+        VkSemaphoreCreateInfo createInfo;
+        {
+            createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            createInfo.pNext = nullptr;
+            createInfo.flags = 0;
+        }
+        VkResult result = vkCreateSemaphore(device, &createInfo, nullptr, semaphore_.ReleaseAndGetAddressOf());
+        VKThrowIfFailed(result, "failed to create Vulkan semaphore for fence");
+    }
+    return semaphore_;
+}
+
+bool VKFence::SignalSemaphore()
+{
+    const bool wasPending = (semaphoreState_ == SemaphoreState::Pending);
+    semaphoreState_ = SemaphoreState::Pending;
+    return wasPending;
+}
+
+bool VKFence::ConsumeSemaphore()
+{
+    if (semaphoreState_ != SemaphoreState::Pending)
+        return false;
+    semaphoreState_ = SemaphoreState::Consumed;
+    return true;
+}
+
+std::uint64_t VKFence::NextTimelineValue()
+{
+    return ++timelineValue_;
+}
+
+void VKFence::SetDeferredSignalQueue(VKCommandQueue* commandQueue)
+{
+    deferredSignalQueue_ = commandQueue;
+}
+
+bool VKFence::Export(VkDevice device, SharedResourceHandle& outHandle) const
+{
+    if (!isExportable_)
+        return false;
+
+    isShared_ = true;
+
+    #if defined LLGL_OS_WIN32 && VK_KHR_external_semaphore_win32
+
+    VkSemaphoreGetWin32HandleInfoKHR getInfo;
+    {
+        getInfo.sType       = VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR;
+        getInfo.pNext       = nullptr;
+        getInfo.semaphore   = semaphore_.Get();
+        getInfo.handleType  = GetVkSemaphoreHandleType();
+    }
+    HANDLE handle = nullptr;
+    if (vkGetSemaphoreWin32HandleKHR(device, &getInfo, &handle) != VK_SUCCESS)
+        return false;
+
+    outHandle.type      = SharedHandleType::OpaqueWin32;
+    outHandle.handle    = handle;
+    outHandle.size      = 0;
+    return true;
+
+    #elif VK_KHR_external_semaphore_fd
+
+    VkSemaphoreGetFdInfoKHR getInfo;
+    {
+        getInfo.sType       = VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR;
+        getInfo.pNext       = nullptr;
+        getInfo.semaphore   = semaphore_.Get();
+        getInfo.handleType  = GetVkSemaphoreHandleType();
+    }
+    int fd = -1;
+    if (vkGetSemaphoreFdKHR(device, &getInfo, &fd) != VK_SUCCESS)
+        return false;
+
+    outHandle.type      = SharedHandleType::OpaqueFD;
+    outHandle.fd        = static_cast<std::int32_t>(fd);
+    outHandle.size      = 0;
+    return true;
+
+    #else
+
+    return false;
+
+    #endif
+}
+
+bool VKFence::IsExportSupported()
+{
+    #if defined LLGL_OS_WIN32 && VK_KHR_external_semaphore_win32
+    return HasExtension(VKExt::KHR_external_semaphore_win32);
+    #elif VK_KHR_external_semaphore_fd
+    return HasExtension(VKExt::KHR_external_semaphore_fd);
+    #else
+    return false;
+    #endif
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool VKFence::WaitTimeline(VkDevice device, std::uint64_t timeout)
+{
+    /* Check cached counter value first, so polling a completed fence doesn't call into the driver */
+    if (completedValue_ >= timelineValue_)
+        return true;
+
+    #if VK_KHR_timeline_semaphore
+
+    /* Read current counter value; this is a plain memory read with most drivers */
+    std::uint64_t counterValue = 0;
+    if (vkGetSemaphoreCounterValueKHR(device, semaphore_, &counterValue) == VK_SUCCESS)
+        completedValue_ = counterValue;
+
+    if (completedValue_ >= timelineValue_)
+        return true;
+
+    if (timeout == 0)
+        return false;
+
+    /* Block until the semaphore has reached the last signaled value */
+    VkSemaphoreWaitInfoKHR waitInfo;
+    {
+        waitInfo.sType          = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+        waitInfo.pNext          = nullptr;
+        waitInfo.flags          = 0;
+        waitInfo.semaphoreCount = 1;
+        waitInfo.pSemaphores    = semaphore_.GetAddressOf();
+        waitInfo.pValues        = &timelineValue_;
+    }
+    if (vkWaitSemaphoresKHR(device, &waitInfo, timeout) != VK_SUCCESS)
+        return false;
+
+    completedValue_ = timelineValue_;
+    return true;
+
+    #else
+
+    return false;
+
+    #endif // /VK_KHR_timeline_semaphore
+}
+
 
 } // /namespace LLGL
 
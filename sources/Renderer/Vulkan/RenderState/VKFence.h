@@ -10,6 +10,7 @@
 
 
 #include <LLGL/Fence.h>
+#include <LLGL/ResourceFlags.h>
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <cstdint>
@@ -19,25 +20,115 @@ namespace LLGL
 {
 
 
+class VKCommandQueue;
+
 class VKFence final : public Fence
 {
 
     public:
 
-        VKFence(VkDevice device);
+        bool GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        bool IsSignaled() override;
+
+    public:
+
+        // Constructs the fence either with a timeline semaphore (requires VK_KHR_timeline_semaphore) or with a binary VkFence.
+        // If 'exportable' is true, the timeline semaphore can be exported to an OS handle with Export().
+        VKFence(VkDevice device, bool useTimelineSemaphore = false, bool exportable = false);
 
         void Reset(VkDevice device);
         bool Wait(VkDevice device, std::uint64_t timeout);
 
-        // Returns the native VkFence handle.
+        // Returns the binary semaphore that is signaled together with this fence and creates it on first use.
+        VkSemaphore GetOrCreateVkSemaphore(VkDevice device);
+
+        // Marks the semaphore as signaled by a queue submission. Returns true if the previous signal was never waited on.
+        bool SignalSemaphore();
+
+        // Marks the semaphore as consumed by a GPU-side wait. Returns false if there is no pending signal to wait on.
+        bool ConsumeSemaphore();
+
+        // Increments the value this timeline fence will be signaled with and returns the new value.
+        std::uint64_t NextTimelineValue();
+
+        // Stores the command queue that has deferred the signal operation for this timeline fence until its next submission.
+        void SetDeferredSignalQueue(VKCommandQueue* commandQueue);
+
+        // Exports the timeline semaphore to an OS handle. Returns false if this fence has not been created as exportable timeline fence.
+        bool Export(VkDevice device, SharedResourceHandle& outHandle) const;
+
+        // Returns true if timeline semaphores can be exported as OS handle on this platform, i.e. VK_KHR_external_semaphore_fd or VK_KHR_external_semaphore_win32 is enabled.
+        static bool IsExportSupported();
+
+        // Returns the native VkFence handle. This is VK_NULL_HANDLE for timeline fences.
         inline VkFence GetVkFence() const
         {
             return fence_;
         }
 
+        // Returns the native timeline VkSemaphore handle or the binary semaphore if it has been created.
+        inline VkSemaphore GetVkSemaphore() const
+        {
+            return semaphore_;
+        }
+
+        // Returns the last value this timeline fence has been signaled with.
+        inline std::uint64_t GetTimelineValue() const
+        {
+            return timelineValue_;
+        }
+
+        // Returns true if this fence is backed by a timeline semaphore.
+        inline bool IsTimeline() const
+        {
+            return isTimeline_;
+        }
+
+        // Returns the command queue that still has to submit the signal operation for this timeline fence, or null if there is none.
+        inline VKCommandQueue* GetDeferredSignalQueue() const
+        {
+            return deferredSignalQueue_;
+        }
+
+        // Returns true if the native handle of this fence has been retrieved or exported. Shared fences are not recycled.
+        inline bool IsShared() const
+        {
+            return isShared_;
+        }
+
+        // Returns true if this fence has been submitted to a queue at least once.
+        inline bool HasBeenSubmitted() const
+        {
+            return (isTimeline_ ? timelineValue_ > 0 : semaphoreState_ != SemaphoreState::Unused);
+        }
+
+    private:
+
+        enum class SemaphoreState
+        {
+            Unused,     // Fence has never been submitted.
+            Pending,    // Semaphore has been signaled but nobody waits on it yet.
+            Consumed,   // Semaphore signal has been consumed by a GPU-side wait.
+        };
+
+    private:
+
+        bool WaitTimeline(VkDevice device, std::uint64_t timeout);
+
     private:
 
-        VKPtr<VkFence> fence_;
+        VkDevice            device_                 = VK_NULL_HANDLE;
+        VKPtr<VkFence>      fence_;
+        VKPtr<VkSemaphore>  semaphore_;
+        SemaphoreState      semaphoreState_         = SemaphoreState::Unused;
+
+        bool                isTimeline_             = false;
+        bool                isExportable_           = false;
+        mutable bool        isShared_               = false;
+        std::uint64_t       timelineValue_          = 0;
+        std::uint64_t       completedValue_         = 0;
+        VKCommandQueue*     deferredSignalQueue_    = nullptr;
 
 };
 
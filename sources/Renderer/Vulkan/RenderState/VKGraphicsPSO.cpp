@@ -10,11 +10,14 @@
 #include "VKRenderPass.h"
 #include "VKPipelineCache.h"
 #include "../Ext/VKExtensionRegistry.h"
+#include "../Ext/VKExtensions.h"
 #include "../Shader/VKShader.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../../CheckedCast.h"
 #include "../../PipelineStateUtils.h"
+#include <string>
+#include <vector>
 #include <cstddef>
 #include <LLGL/PipelineStateFlags.h>
 #include <LLGL/Utils/ForRange.h>
@@ -33,7 +36,8 @@ VKGraphicsPSO::VKGraphicsPSO(
     const RenderPass*                   defaultRenderPass,
     const GraphicsPipelineDescriptor&   desc,
     const VKGraphicsPipelineLimits&     limits,
-    PipelineCache*                      pipelineCache)
+    PipelineCache*                      pipelineCache,
+    VKGraphicsPipelineCreateInfo*       deferredCreateInfo)
 :
     VKPipelineState    { device, VK_PIPELINE_BIND_POINT_GRAPHICS, GetShadersAsArray(desc), desc.pipelineLayout },
     scissorEnabled_    { desc.rasterizer.scissorTestEnabled                                                    },
@@ -43,12 +47,109 @@ VKGraphicsPSO::VKGraphicsPSO(
     const RenderPass* renderPass = (desc.renderPass != nullptr ? desc.renderPass : defaultRenderPass);
     LLGL_ASSERT_PTR(renderPass);
 
-    /* Create Vulkan graphics pipeline object */
+    /* Only fill the create-info if the native PSO is created in a batch with other PSOs, see CreateVkPipelines() */
     const VKRenderPass* renderPassVK = LLGL_CAST(const VKRenderPass*, renderPass);
-    if (VKPipelineCache* pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache) : nullptr))
-        CreateVkPipeline(device, *renderPassVK, limits, desc, pipelineCacheVK->GetNative());
-    else
-        CreateVkPipeline(device, *renderPassVK, limits, desc);
+    if (deferredCreateInfo != nullptr)
+    {
+        deferredCreateInfo->isValid = FillVkPipelineCreateInfo(*renderPassVK, limits, desc, *deferredCreateInfo);
+        return;
+    }
+
+    /* Create Vulkan graphics pipeline object; the descriptor is copied, since it might be compiled on a worker thread */
+    const VkPipelineCache   pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache)->GetNative() : VK_NULL_HANDLE);
+    const std::string       debugName       = (desc.debugName != nullptr ? desc.debugName : "");
+    const bool              isAsync         = ((desc.flags & PipelineStateFlags::AsyncCompilation) != 0);
+    GraphicsPipelineDescriptor descCopy = desc;
+
+    RunCompilation(
+        isAsync,
+        [this, device, renderPassVK, limits, descCopy, debugName, pipelineCacheVK]() mutable
+        {
+            descCopy.debugName = (debugName.empty() ? nullptr : debugName.c_str());
+            CreateVkPipeline(device, *renderPassVK, limits, descCopy, pipelineCacheVK);
+        }
+    );
+}
+
+void VKGraphicsPSO::CreateVkPipelines(
+    VkDevice                            device,
+    std::size_t                         numPipelineStates,
+    VKGraphicsPSO* const *              pipelineStates,
+    const VKGraphicsPipelineCreateInfo* createInfos,
+    PipelineCache*                      pipelineCache)
+{
+    /* Gather all valid create-infos into a contiguous array for a single native call */
+    std::vector<VkGraphicsPipelineCreateInfo> createInfosVK;
+    std::vector<VKGraphicsPSO*> batchedPipelineStates;
+    createInfosVK.reserve(numPipelineStates);
+    batchedPipelineStates.reserve(numPipelineStates);
+
+    for_range(i, numPipelineStates)
+    {
+        if (createInfos[i].isValid)
+        {
+            createInfosVK.push_back(createInfos[i].createInfo);
+            batchedPipelineStates.push_back(pipelineStates[i]);
+        }
+    }
+
+    if (createInfosVK.empty())
+        return;
+
+    /* Create all native PSOs at once; the driver may compile them in parallel */
+    const VkPipelineCache pipelineCacheVK = (pipelineCache != nullptr ? LLGL_CAST(VKPipelineCache*, pipelineCache)->GetNative() : VK_NULL_HANDLE);
+    std::vector<VkPipeline> pipelinesVK(createInfosVK.size(), VK_NULL_HANDLE);
+    VkResult result = vkCreateGraphicsPipelines(
+        device,
+        pipelineCacheVK,
+        static_cast<std::uint32_t>(createInfosVK.size()),
+        createInfosVK.data(),
+        nullptr,
+        pipelinesVK.data()
+    );
+
+    /* Hand over all native PSOs before checking the result, since some of them might have been created even if the call failed */
+    for_range(i, pipelinesVK.size())
+        *(batchedPipelineStates[i]->ReleaseAndGetAddressOfVkPipeline()) = pipelinesVK[i];
+
+    VKThrowIfFailed(result, "failed to create Vulkan graphics pipelines");
+}
+
+void VKGraphicsPSO::SetFoldedStates(VkCommandBuffer commandBuffer) const
+{
+    #if VK_EXT_extended_dynamic_state
+    if (foldedStates_.coreStates)
+    {
+        vkCmdSetCullModeEXT(commandBuffer, foldedStates_.cullModeVK);
+        vkCmdSetFrontFaceEXT(commandBuffer, foldedStates_.frontFaceVK);
+        if (foldedStates_.inputAssembly)
+            vkCmdSetPrimitiveTopologyEXT(commandBuffer, foldedStates_.topologyVK);
+        vkCmdSetDepthTestEnableEXT(commandBuffer, foldedStates_.depthTestEnable);
+        vkCmdSetDepthWriteEnableEXT(commandBuffer, foldedStates_.depthWriteEnable);
+        vkCmdSetDepthCompareOpEXT(commandBuffer, foldedStates_.depthCompareOpVK);
+        vkCmdSetStencilTestEnableEXT(commandBuffer, foldedStates_.stencilTestEnable);
+
+        const VkStencilOpState& front = foldedStates_.stencilFrontVK;
+        const VkStencilOpState& back = foldedStates_.stencilBackVK;
+        vkCmdSetStencilOpEXT(commandBuffer, VK_STENCIL_FACE_FRONT_BIT, front.failOp, front.passOp, front.depthFailOp, front.compareOp);
+        vkCmdSetStencilOpEXT(commandBuffer, VK_STENCIL_FACE_BACK_BIT, back.failOp, back.passOp, back.depthFailOp, back.compareOp);
+    }
+    #endif // /VK_EXT_extended_dynamic_state
+
+    #if VK_EXT_extended_dynamic_state2
+    if (foldedStates_.enableStates)
+    {
+        vkCmdSetRasterizerDiscardEnableEXT(commandBuffer, foldedStates_.rasterizerDiscardEnable);
+        vkCmdSetDepthBiasEnableEXT(commandBuffer, foldedStates_.depthBiasEnable);
+        if (foldedStates_.inputAssembly)
+            vkCmdSetPrimitiveRestartEnableEXT(commandBuffer, foldedStates_.primitiveRestartEnable);
+    }
+    #endif // /VK_EXT_extended_dynamic_state2
+
+    #if VK_EXT_extended_dynamic_state3
+    if (foldedStates_.polygonMode)
+        vkCmdSetPolygonModeEXT(commandBuffer, foldedStates_.polygonModeVK);
+    #endif // /VK_EXT_extended_dynamic_state3
 }
 
 
@@ -272,8 +373,92 @@ static void CreateColorBlendState(
     createInfo.blendConstants[3]    = desc.blendFactor[3];
 }
 
+static VkPrimitiveTopology GetVkPrimitiveTopologyClass(VkPrimitiveTopology topology)
+{
+    switch (topology)
+    {
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST_WITH_ADJACENCY:
+        case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP_WITH_ADJACENCY:
+            return VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        default:
+            return topology;
+    }
+}
+
+static void NormalizeVkStencilOpState(VkStencilOpState& state)
+{
+    state.failOp        = VK_STENCIL_OP_KEEP;
+    state.passOp        = VK_STENCIL_OP_KEEP;
+    state.depthFailOp   = VK_STENCIL_OP_KEEP;
+    state.compareOp     = VK_COMPARE_OP_ALWAYS;
+}
+
+// Moves the states that can be set dynamically from the create-infos into the output states and normalizes their static values.
+static void FoldPipelineStates(
+    const VKGraphicsPipelineLimits&         limits,
+    VkPipelineInputAssemblyStateCreateInfo& inputAssembly,
+    VkPipelineRasterizationStateCreateInfo& rasterizerState,
+    VkPipelineDepthStencilStateCreateInfo&  depthStencilState,
+    VKFoldedPipelineStates&                 outStates)
+{
+    outStates.coreStates    = limits.dynamicCoreStates;
+    outStates.enableStates  = limits.dynamicEnableStates;
+    outStates.polygonMode   = limits.dynamicPolygonMode;
+    outStates.shadingRate   = limits.dynamicShadingRate;
+
+    if (outStates.coreStates)
+    {
+        outStates.cullModeVK                = rasterizerState.cullMode;
+        outStates.frontFaceVK               = rasterizerState.frontFace;
+        outStates.topologyVK                = inputAssembly.topology;
+        outStates.depthTestEnable           = depthStencilState.depthTestEnable;
+        outStates.depthWriteEnable          = depthStencilState.depthWriteEnable;
+        outStates.depthCompareOpVK          = depthStencilState.depthCompareOp;
+        outStates.stencilTestEnable         = depthStencilState.stencilTestEnable;
+        outStates.stencilFrontVK            = depthStencilState.front;
+        outStates.stencilBackVK             = depthStencilState.back;
+
+        /* Only the topology class must match the dynamic primitive topology */
+        rasterizerState.cullMode            = VK_CULL_MODE_NONE;
+        rasterizerState.frontFace           = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+        inputAssembly.topology              = GetVkPrimitiveTopologyClass(inputAssembly.topology);
+        depthStencilState.depthTestEnable   = VK_FALSE;
+        depthStencilState.depthWriteEnable  = VK_FALSE;
+        depthStencilState.depthCompareOp    = VK_COMPARE_OP_LESS;
+        depthStencilState.stencilTestEnable = VK_FALSE;
+        NormalizeVkStencilOpState(depthStencilState.front);
+        NormalizeVkStencilOpState(depthStencilState.back);
+    }
+
+    if (outStates.enableStates)
+    {
+        outStates.rasterizerDiscardEnable       = rasterizerState.rasterizerDiscardEnable;
+        outStates.depthBiasEnable               = rasterizerState.depthBiasEnable;
+        outStates.primitiveRestartEnable        = inputAssembly.primitiveRestartEnable;
+
+        rasterizerState.rasterizerDiscardEnable = VK_FALSE;
+        rasterizerState.depthBiasEnable         = VK_FALSE;
+        inputAssembly.primitiveRestartEnable    = VK_FALSE;
+    }
+
+    if (outStates.polygonMode)
+    {
+        outStates.polygonModeVK     = rasterizerState.polygonMode;
+        rasterizerState.polygonMode = VK_POLYGON_MODE_FILL;
+    }
+}
+
 static void CreateDynamicState(
     const GraphicsPipelineDescriptor&   desc,
+    const VKFoldedPipelineStates&       foldedStates,
     VkPipelineDynamicStateCreateInfo&   createInfo,
     std::vector<VkDynamicState>&        dynamicStatesVK)
 {
@@ -286,6 +471,41 @@ static void CreateDynamicState(
     if (desc.stencil.referenceDynamic)
         dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_REFERENCE);
 
+    #if VK_EXT_extended_dynamic_state
+    if (foldedStates.coreStates)
+    {
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
+        if (foldedStates.inputAssembly)
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);
+    }
+    #endif // /VK_EXT_extended_dynamic_state
+
+    #if VK_EXT_extended_dynamic_state2
+    if (foldedStates.enableStates)
+    {
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE_EXT);
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE_EXT);
+        if (foldedStates.inputAssembly)
+            dynamicStatesVK.push_back(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE_EXT);
+    }
+    #endif // /VK_EXT_extended_dynamic_state2
+
+    #if VK_EXT_extended_dynamic_state3
+    if (foldedStates.polygonMode)
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_POLYGON_MODE_EXT);
+    #endif // /VK_EXT_extended_dynamic_state3
+
+    #if VK_KHR_fragment_shading_rate
+    if (foldedStates.shadingRate)
+        dynamicStatesVK.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
+    #endif // /VK_KHR_fragment_shading_rate
+
     createInfo.sType                = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
     createInfo.pNext                = nullptr;
     createInfo.flags                = 0;
@@ -293,6 +513,31 @@ static void CreateDynamicState(
     createInfo.pDynamicStates       = (dynamicStatesVK.empty() ? nullptr : dynamicStatesVK.data());
 }
 
+#if VK_KHR_dynamic_rendering
+
+static void FillPipelineRenderingCreateInfo(
+    const VKRenderPass&                 renderPass,
+    std::uint32_t                       viewMask,
+    VkPipelineRenderingCreateInfoKHR&   createInfo,
+    VkFormat                            (&colorFormats)[LLGL_MAX_NUM_COLOR_ATTACHMENTS])
+{
+    const std::uint32_t numColorAttachments = renderPass.GetNumColorAttachments();
+    for_range(i, numColorAttachments)
+        colorFormats[i] = renderPass.GetColorFormat(i);
+
+    const VkFormat depthStencilFormat = renderPass.GetDepthStencilFormat();
+
+    createInfo.sType                    = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO_KHR;
+    createInfo.pNext                    = nullptr;
+    createInfo.viewMask                 = viewMask;
+    createInfo.colorAttachmentCount     = numColorAttachments;
+    createInfo.pColorAttachmentFormats  = colorFormats;
+    createInfo.depthAttachmentFormat    = (depthStencilFormat != VK_FORMAT_S8_UINT ? depthStencilFormat : VK_FORMAT_UNDEFINED);
+    createInfo.stencilAttachmentFormat  = (VKTypes::IsVkFormatStencil(depthStencilFormat) ? depthStencilFormat : VK_FORMAT_UNDEFINED);
+}
+
+#endif // /VK_KHR_dynamic_rendering
+
 bool VKGraphicsPSO::CreateVkPipeline(
     VkDevice                            device,
     const VKRenderPass&                 renderPass,
@@ -300,15 +545,36 @@ bool VKGraphicsPSO::CreateVkPipeline(
     const GraphicsPipelineDescriptor&   desc,
     VkPipelineCache                     pipelineCache)
 {
-    /* Get shader program object */
+    VKGraphicsPipelineCreateInfo createInfo;
+    if (!FillVkPipelineCreateInfo(renderPass, limits, desc, createInfo))
+        return false;
+
+    /* Create graphics pipeline state object */
+    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &(createInfo.createInfo), nullptr, ReleaseAndGetAddressOfVkPipeline());
+    VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+
+    return true;
+}
+
+bool VKGraphicsPSO::FillVkPipelineCreateInfo(
+    const VKRenderPass&                 renderPass,
+    const VKGraphicsPipelineLimits&     limits,
+    const GraphicsPipelineDescriptor&   desc,
+    VKGraphicsPipelineCreateInfo&       outCreateInfo)
+{
+    /* Get shader program object; mesh shader pipelines have no vertex shader */
     const VKShader* vertexShaderVK = LLGL_CAST(const VKShader*, desc.vertexShader);
-    if (vertexShaderVK == nullptr)
+    const bool isMeshPipeline = (desc.meshShader != nullptr);
+    if (vertexShaderVK == nullptr && !isMeshPipeline)
     {
         GetMutableReport().Errorf("cannot create Vulkan graphics pipeline without vertex shader\n");
         return false;
     }
 
-    auto FillAndAppendShaderStageCreateInfo = [this, &desc](
+    /* Get optional specialization constants for all shader stages */
+    const VkSpecializationInfo* specializationInfoPtr = FillSpecializationInfo(desc.specializationConstants, outCreateInfo.specializationInfo, outCreateInfo.specializationMapEntries);
+
+    auto FillAndAppendShaderStageCreateInfo = [this, &desc, specializationInfoPtr](
         Shader*                                             shader,
         SmallVector<VkPipelineShaderStageCreateInfo, 5>&    createInfos,
         bool&                                               outShaderCreationFailed)
@@ -326,89 +592,110 @@ bool VKGraphicsPSO::CreateVkPipeline(
             {
                 const std::size_t shaderIndex = createInfos.size();
                 createInfos.resize(shaderIndex + 1);
-                this->GetShaderCreateInfoAndOptionalPermutation(shaderVK, createInfos.back());
+                this->GetShaderCreateInfoAndOptionalPermutation(shaderVK, createInfos.back(), specializationInfoPtr);
             }
         }
     };
 
     /* Get shader stages */
-    SmallVector<VkPipelineShaderStageCreateInfo, 5> shaderStageCreateInfos;
+    SmallVector<VkPipelineShaderStageCreateInfo, 5>& shaderStageCreateInfos = outCreateInfo.shaderStages;
     bool shaderCreationFailed = false;
     FillAndAppendShaderStageCreateInfo(desc.vertexShader,           shaderStageCreateInfos, shaderCreationFailed);
     FillAndAppendShaderStageCreateInfo(desc.tessControlShader,      shaderStageCreateInfos, shaderCreationFailed);
     FillAndAppendShaderStageCreateInfo(desc.tessEvaluationShader,   shaderStageCreateInfos, shaderCreationFailed);
     FillAndAppendShaderStageCreateInfo(desc.geometryShader,         shaderStageCreateInfos, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.taskShader,             shaderStageCreateInfos, shaderCreationFailed);
+    FillAndAppendShaderStageCreateInfo(desc.meshShader,             shaderStageCreateInfos, shaderCreationFailed);
     FillAndAppendShaderStageCreateInfo(desc.fragmentShader,         shaderStageCreateInfos, shaderCreationFailed);
     if (shaderCreationFailed)
         return false;
 
     /* Initialize vertex input descriptor */
-    VkPipelineVertexInputStateCreateInfo vertexInputCreateInfo;
-    vertexShaderVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
+    VkPipelineVertexInputStateCreateInfo& vertexInputCreateInfo = outCreateInfo.vertexInputState;
+    if (vertexShaderVK != nullptr)
+        vertexShaderVK->FillVertexInputStateCreateInfo(vertexInputCreateInfo);
 
     /* Initialize input assembly state */
-    VkPipelineInputAssemblyStateCreateInfo inputAssembly;
+    VkPipelineInputAssemblyStateCreateInfo& inputAssembly = outCreateInfo.inputAssemblyState;
     CreateInputAssemblyState(desc, inputAssembly);
 
     /* Initialize tessellation state */
-    VkPipelineTessellationStateCreateInfo tessellationState;
+    VkPipelineTessellationStateCreateInfo& tessellationState = outCreateInfo.tessellationState;
     CreateTessellationState(desc, tessellationState);
 
     /* Initialize viewport state */
-    std::vector<VkViewport> viewportsVK;
-    std::vector<VkRect2D> scissorsVK;
-    VkPipelineViewportStateCreateInfo viewportState;
-    CreateViewportState(desc, viewportState, viewportsVK, scissorsVK);
+    VkPipelineViewportStateCreateInfo& viewportState = outCreateInfo.viewportState;
+    CreateViewportState(desc, viewportState, outCreateInfo.viewports, outCreateInfo.scissors);
 
     /* Initialize rasterizer state */
-    VkPipelineRasterizationStateCreateInfo rasterizerState;
-    VkPipelineRasterizationConservativeStateCreateInfoEXT createInfoConservativeRasterExt;
-    CreateRasterizerState(desc.rasterizer, limits, rasterizerState, createInfoConservativeRasterExt);
+    VkPipelineRasterizationStateCreateInfo& rasterizerState = outCreateInfo.rasterizerState;
+    CreateRasterizerState(desc.rasterizer, limits, rasterizerState, outCreateInfo.conservativeRasterState);
 
     /* Initialize multi-sample state */
-    VkPipelineMultisampleStateCreateInfo multisampleState;
+    VkPipelineMultisampleStateCreateInfo& multisampleState = outCreateInfo.multisampleState;
     const VkSampleCountFlagBits sampleCountBits = (desc.rasterizer.multiSampleEnabled ? renderPass.GetSampleCountBits() : VK_SAMPLE_COUNT_1_BIT);
     CreateMultisampleState(sampleCountBits, desc.blend, multisampleState);
 
     /* Initialize depth-stencil state */
-    VkPipelineDepthStencilStateCreateInfo depthStencilState;
+    VkPipelineDepthStencilStateCreateInfo& depthStencilState = outCreateInfo.depthStencilState;
     CreateDepthStencilState(desc, depthStencilState);
 
     /* Initialize color-blend state */
-    std::vector<VkPipelineColorBlendAttachmentState> attachmentStatesVK;
-    VkPipelineColorBlendStateCreateInfo colorBlendState;
-    CreateColorBlendState(desc.blend, colorBlendState, attachmentStatesVK, renderPass.GetNumColorAttachments());
+    VkPipelineColorBlendStateCreateInfo& colorBlendState = outCreateInfo.colorBlendState;
+    CreateColorBlendState(desc.blend, colorBlendState, outCreateInfo.colorBlendAttachments, renderPass.GetNumColorAttachments());
+
+    /* Fold states into dynamic states if supported, so the native PSO only depends on the remaining static states */
+    FoldPipelineStates(limits, inputAssembly, rasterizerState, depthStencilState, foldedStates_);
+    foldedStates_.inputAssembly = !isMeshPipeline;
 
     /* Initialize dynamic state */
-    std::vector<VkDynamicState> dynamicStatesVK;
-    VkPipelineDynamicStateCreateInfo dynamicState;
-    CreateDynamicState(desc, dynamicState, dynamicStatesVK);
+    VkPipelineDynamicStateCreateInfo& dynamicState = outCreateInfo.dynamicState;
+    CreateDynamicState(desc, foldedStates_, dynamicState, outCreateInfo.dynamicStates);
 
-    /* Create graphics pipeline state object */
-    VkGraphicsPipelineCreateInfo createInfo;
+    #if VK_KHR_dynamic_rendering
+
+    /* Initialize attachment formats for dynamic rendering */
+    const bool isDynamicRendering = HasExtension(VKExt::KHR_dynamic_rendering);
+    if (isDynamicRendering)
+        FillPipelineRenderingCreateInfo(renderPass, desc.viewMask, outCreateInfo.renderingCreateInfo, outCreateInfo.colorFormats);
+
+    #endif // /VK_KHR_dynamic_rendering
+
+    /* Initialize graphics pipeline create-info */
+    VkGraphicsPipelineCreateInfo& createInfo = outCreateInfo.createInfo;
     {
         createInfo.sType                = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
         createInfo.pNext                = nullptr;
         createInfo.flags                = 0;
         createInfo.stageCount           = static_cast<std::uint32_t>(shaderStageCreateInfos.size());
         createInfo.pStages              = shaderStageCreateInfos.data();
-        createInfo.pVertexInputState    = (&vertexInputCreateInfo);
-        createInfo.pInputAssemblyState  = (&inputAssembly);
-        createInfo.pTessellationState   = (inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
+        createInfo.pVertexInputState    = (isMeshPipeline ? nullptr : &vertexInputCreateInfo);
+        createInfo.pInputAssemblyState  = (isMeshPipeline ? nullptr : &inputAssembly);
+        createInfo.pTessellationState   = (!isMeshPipeline && inputAssembly.topology == VK_PRIMITIVE_TOPOLOGY_PATCH_LIST ? &tessellationState : nullptr);
         createInfo.pViewportState       = (&viewportState);
         createInfo.pRasterizationState  = (&rasterizerState);
         createInfo.pMultisampleState    = (&multisampleState);
         createInfo.pDepthStencilState   = (&depthStencilState);
         createInfo.pColorBlendState     = (&colorBlendState);
-        createInfo.pDynamicState        = (!dynamicStatesVK.empty() ? &dynamicState : nullptr);
+        createInfo.pDynamicState        = (!outCreateInfo.dynamicStates.empty() ? &dynamicState : nullptr);
         createInfo.layout               = GetVkPipelineLayout();
         createInfo.renderPass           = renderPass.GetVkRenderPass();
         createInfo.subpass              = 0;
         createInfo.basePipelineHandle   = VK_NULL_HANDLE;
         createInfo.basePipelineIndex    = 0;
     }
-    VkResult result = vkCreateGraphicsPipelines(device, pipelineCache, 1, &createInfo, nullptr, ReleaseAndGetAddressOfVkPipeline());
-    VKThrowIfFailed(result, "failed to create Vulkan graphics pipeline");
+    #if VK_KHR_dynamic_rendering
+    if (isDynamicRendering)
+    {
+        /* Pipelines for dynamic rendering are only bound to attachment formats, not to a render pass object */
+        createInfo.pNext                = &(outCreateInfo.renderingCreateInfo);
+        createInfo.renderPass           = VK_NULL_HANDLE;
+        #if VK_KHR_fragment_shading_rate
+        if (limits.shadingRateAttachment)
+            createInfo.flags            |= VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
+        #endif
+    }
+    #endif
 
     return true;
 }
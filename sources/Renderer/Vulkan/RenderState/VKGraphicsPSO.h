@@ -10,6 +10,9 @@
 
 
 #include "VKPipelineState.h"
+#include <LLGL/Constants.h>
+#include <LLGL/Container/SmallVector.h>
+#include <vector>
 
 
 namespace LLGL
@@ -21,6 +24,75 @@ struct VKGraphicsPipelineLimits
 {
     float lineWidthRange[2];
     float lineWidthGranularity;
+    bool  dynamicCoreStates     = false; // Cull mode, front face, topology, depth and stencil states via VK_EXT_extended_dynamic_state.
+    bool  dynamicEnableStates   = false; // Rasterizer discard, depth bias and primitive restart enable via VK_EXT_extended_dynamic_state2.
+    bool  dynamicPolygonMode    = false; // Polygon mode via VK_EXT_extended_dynamic_state3.
+    bool  dynamicShadingRate    = false; // Per-draw fragment shading rate via VK_KHR_fragment_shading_rate.
+    bool  shadingRateAttachment = false; // Fragment shading-rate attachments with VK_KHR_dynamic_rendering.
+};
+
+/*
+Pipeline states that are folded out of the native PSO with VK_EXT_extended_dynamic_state/2/3 and set with the command buffer whenever the PSO is bound.
+Their static values in the native PSO are normalized, so PSOs that only differ in these states have identical create-infos and share pipeline cache entries.
+*/
+struct VKFoldedPipelineStates
+{
+    bool                coreStates              = false;
+    bool                enableStates            = false;
+    bool                polygonMode             = false;
+    bool                inputAssembly           = true;     // False for mesh shader pipelines, which have no input assembly state
+    bool                shadingRate             = false;    // Fragment shading rate is set by the command buffer, see VKCommandBuffer::SetShadingRate
+
+    VkCullModeFlags     cullModeVK              = VK_CULL_MODE_NONE;
+    VkFrontFace         frontFaceVK             = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    VkPrimitiveTopology topologyVK              = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkBool32            depthTestEnable         = VK_FALSE;
+    VkBool32            depthWriteEnable        = VK_FALSE;
+    VkCompareOp         depthCompareOpVK        = VK_COMPARE_OP_LESS;
+    VkBool32            stencilTestEnable       = VK_FALSE;
+    VkStencilOpState    stencilFrontVK          = {};
+    VkStencilOpState    stencilBackVK           = {};
+    VkBool32            rasterizerDiscardEnable = VK_FALSE;
+    VkBool32            depthBiasEnable         = VK_FALSE;
+    VkBool32            primitiveRestartEnable  = VK_FALSE;
+    VkPolygonMode       polygonModeVK           = VK_POLYGON_MODE_FILL;
+};
+
+/*
+Storage for a native graphics pipeline create-info and all the state structures it refers to.
+The create-info refers to its own members, so this storage must not be copied or moved once it has been filled.
+*/
+struct VKGraphicsPipelineCreateInfo
+{
+    VKGraphicsPipelineCreateInfo() = default;
+    VKGraphicsPipelineCreateInfo(const VKGraphicsPipelineCreateInfo&) = delete;
+    VKGraphicsPipelineCreateInfo& operator = (const VKGraphicsPipelineCreateInfo&) = delete;
+
+    VkGraphicsPipelineCreateInfo                            createInfo;
+    bool                                                    isValid                 = false; // False if the create-info could not be filled, e.g. due to a shader error.
+
+    VkSpecializationInfo                                    specializationInfo;
+    std::vector<VkSpecializationMapEntry>                   specializationMapEntries;
+    SmallVector<VkPipelineShaderStageCreateInfo, 5>         shaderStages;
+    VkPipelineVertexInputStateCreateInfo                    vertexInputState;
+    VkPipelineInputAssemblyStateCreateInfo                  inputAssemblyState;
+    VkPipelineTessellationStateCreateInfo                   tessellationState;
+    std::vector<VkViewport>                                 viewports;
+    std::vector<VkRect2D>                                   scissors;
+    VkPipelineViewportStateCreateInfo                       viewportState;
+    VkPipelineRasterizationStateCreateInfo                  rasterizerState;
+    VkPipelineRasterizationConservativeStateCreateInfoEXT   conservativeRasterState;
+    VkPipelineMultisampleStateCreateInfo                    multisampleState;
+    VkPipelineDepthStencilStateCreateInfo                   depthStencilState;
+    std::vector<VkPipelineColorBlendAttachmentState>        colorBlendAttachments;
+    VkPipelineColorBlendStateCreateInfo                     colorBlendState;
+    std::vector<VkDynamicState>                             dynamicStates;
+    VkPipelineDynamicStateCreateInfo                        dynamicState;
+
+    #if VK_KHR_dynamic_rendering
+    VkFormat                                                colorFormats[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VkPipelineRenderingCreateInfoKHR                        renderingCreateInfo;
+    #endif
 };
 
 struct GraphicsPipelineDescriptor;
@@ -38,6 +110,19 @@ class VKGraphicsPSO final : public VKPipelineState
             const RenderPass*                   defaultRenderPass,
             const GraphicsPipelineDescriptor&   desc,
             const VKGraphicsPipelineLimits&     limits,
+            PipelineCache*                      pipelineCache       = nullptr,
+            VKGraphicsPipelineCreateInfo*       deferredCreateInfo  = nullptr
+        );
+
+        /*
+        Creates the native PSOs of all specified graphics PSOs with a single call to 'vkCreateGraphicsPipelines'.
+        Each PSO must have been constructed with the deferred create-info at the same index. Entries that could not be filled are skipped.
+        */
+        static void CreateVkPipelines(
+            VkDevice                            device,
+            std::size_t                         numPipelineStates,
+            VKGraphicsPSO* const *              pipelineStates,
+            const VKGraphicsPipelineCreateInfo* createInfos,
             PipelineCache*                      pipelineCache       = nullptr
         );
 
@@ -53,6 +138,15 @@ class VKGraphicsPSO final : public VKPipelineState
             return hasDynamicScissor_;
         }
 
+        // Returns true if this graphics pipeline has dynamic fragment shading rate enabled (allows 'vkCmdSetFragmentShadingRateKHR' commands).
+        inline bool HasDynamicShadingRate() const
+        {
+            return foldedStates_.shadingRate;
+        }
+
+        // Records the pipeline states that were folded into dynamic states. Must be called after this PSO has been bound.
+        void SetFoldedStates(VkCommandBuffer commandBuffer) const;
+
     private:
 
         bool CreateVkPipeline(
@@ -63,10 +157,19 @@ class VKGraphicsPSO final : public VKPipelineState
             VkPipelineCache                     pipelineCache   = VK_NULL_HANDLE
         );
 
+        // Fills the native create-info for this PSO without creating the native PSO. Returns false if the descriptor is invalid.
+        bool FillVkPipelineCreateInfo(
+            const VKRenderPass&                 renderPass,
+            const VKGraphicsPipelineLimits&     limits,
+            const GraphicsPipelineDescriptor&   desc,
+            VKGraphicsPipelineCreateInfo&       outCreateInfo
+        );
+
     private:
 
-        bool scissorEnabled_    = false;
-        bool hasDynamicScissor_ = false;
+        bool                    scissorEnabled_     = false;
+        bool                    hasDynamicScissor_  = false;
+        VKFoldedPipelineStates  foldedStates_;
 
 };
 
@@ -7,6 +7,7 @@
 
 #include "VKPipelineBarrier.h"
 #include "../Buffer/VKBuffer.h"
+#include "../Command/VKCommandContext.h"
 //#include "../Texture/VKTexture.h"
 #include "../../CheckedCast.h"
 #include "../../../Core/CoreUtils.h"
@@ -22,20 +23,24 @@ bool VKPipelineBarrier::IsActive() const
     return (srcStageMask_ != 0 && dstStageMask_ != 0);
 }
 
-void VKPipelineBarrier::Submit(VkCommandBuffer commandBuffer)
+void VKPipelineBarrier::Submit(VKCommandContext& context)
 {
-    vkCmdPipelineBarrier(
-        commandBuffer,
-        srcStageMask_,
-        dstStageMask_,
-        0, // VkDependencyFlags
-        static_cast<std::uint32_t>(memoryBarriers_.size()),
-        memoryBarriers_.data(),
-        static_cast<std::uint32_t>(bufferBarriers_.size()),
-        bufferBarriers_.data(),
-        static_cast<std::uint32_t>(imageBarriers_.size()),
-        imageBarriers_.data()
-    );
+    /* Defer barriers to the command context, so multiple barriers are batched into a single pipeline barrier command */
+    for (const VkMemoryBarrier& barrier : memoryBarriers_)
+        context.GlobalMemoryBarrier(srcStageMask_, barrier.srcAccessMask, dstStageMask_, barrier.dstAccessMask);
+
+    for (const VkBufferMemoryBarrier& barrier : bufferBarriers_)
+    {
+        context.BufferMemoryBarrier(
+            barrier.buffer,
+            barrier.offset,
+            barrier.size,
+            srcStageMask_,
+            barrier.srcAccessMask,
+            dstStageMask_,
+            barrier.dstAccessMask
+        );
+    }
 }
 
 bool VKPipelineBarrier::Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags)
@@ -101,6 +106,7 @@ bool VKPipelineBarrier::Update()
     srcStageMask_ = 0;
     dstStageMask_ = 0;
     memoryBarriers_.clear();
+    bufferBarriers_.clear();
 
     /* Iterate over all bindings and re-generate all barriers */
     for (const ResourceBinding& binding : bindings_)
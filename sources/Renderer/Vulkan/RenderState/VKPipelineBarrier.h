@@ -21,6 +21,7 @@ namespace LLGL
 
 
 class Resource;
+class VKCommandContext;
 
 // Helper class to manage information for a Vulkan pipeline barrier command.
 class VKPipelineBarrier
@@ -31,8 +32,8 @@ class VKPipelineBarrier
         // Returns true if this barrier is active in any stage.
         bool IsActive() const;
 
-        // Submits this pipeline barrier into the specified command buffer.
-        void Submit(VkCommandBuffer commandBuffer);
+        // Appends the barriers of this pipeline barrier to the specified command context. They are submitted with the next flush of the context.
+        void Submit(VKCommandContext& context);
 
         // Emplaces the specified resource into the pipeline barrier.
         bool Emplace(std::uint32_t slot, Resource* resource, VkPipelineStageFlags stageFlags);
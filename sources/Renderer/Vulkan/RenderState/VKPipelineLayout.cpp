@@ -10,12 +10,15 @@
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../VKStaticLimits.h"
+#include "../VKPhysicalDevice.h"
 #include "../Texture/VKSampler.h"
 #include "../Shader/VKShader.h"
 #include "../Shader/VKShaderModulePool.h"
 #include "../../ResourceUtils.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/HashUtils.h"
 #include <LLGL/Utils/ForRange.h>
 #include <LLGL/Container/SmallVector.h>
 #include <algorithm>
@@ -27,7 +30,17 @@ namespace LLGL
 
 VKPtr<VkPipelineLayout> VKPipelineLayout::defaultPipelineLayout_;
 
-VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc) :
+// Returns true if the specified dynamic bindings can be updated with push descriptors (VK_KHR_push_descriptor) instead of descriptor set allocations.
+static bool CanUsePushDescriptorSet(const VKPhysicalDevice& physicalDevice, const std::vector<BindingDescriptor>& bindings)
+{
+    const std::uint32_t maxPushDescriptors = physicalDevice.GetMaxPushDescriptors();
+    std::uint32_t numDescriptors = 0;
+    for (const BindingDescriptor& binding : bindings)
+        numDescriptors += std::max(1u, binding.arraySize);
+    return (numDescriptors > 0 && numDescriptors <= maxPushDescriptors);
+}
+
+VKPipelineLayout::VKPipelineLayout(const VKPhysicalDevice& physicalDevice, VkDevice device, const PipelineLayoutDescriptor& desc) :
     pipelineLayout_ { device, vkDestroyPipelineLayout          },
     setLayouts_     { { device, vkDestroyDescriptorSetLayout },
                       { device, vkDestroyDescriptorSetLayout },
@@ -37,17 +50,22 @@ VKPipelineLayout::VKPipelineLayout(VkDevice device, const PipelineLayoutDescript
     barrierFlags_   { desc.barrierFlags                        }
 {
     /* Create Vulkan descriptor set layouts */
+    const bool isBindlessHeap = ((desc.flags & PipelineLayoutFlags::BindlessHeap) != 0);
     if (!desc.heapBindings.empty())
-        CreateBindingSetLayout(device, desc.heapBindings, heapBindings_, SetLayoutType_HeapBindings);
+        CreateBindingSetLayout(device, desc.heapBindings, heapBindings_, SetLayoutType_HeapBindings, (isBindlessHeap ? &physicalDevice : nullptr));
     if (!desc.bindings.empty())
+    {
+        hasPushDescriptorSet_ = CanUsePushDescriptorSet(physicalDevice, desc.bindings);
         CreateBindingSetLayout(device, desc.bindings, bindings_, SetLayoutType_DynamicBindings);
+    }
     if (!desc.staticSamplers.empty())
         CreateImmutableSamplers(device, desc.staticSamplers);
 
-    /* Create descriptor pool for dynamic descriptors and immutable samplers */
-    if (!desc.bindings.empty() || !desc.staticSamplers.empty())
+    /* Create descriptor pool for dynamic descriptors and immutable samplers; push descriptors are not allocated from any pool */
+    const bool hasDynamicDescriptorSet = (!desc.bindings.empty() && !hasPushDescriptorSet_);
+    if (hasDynamicDescriptorSet || !desc.staticSamplers.empty())
         CreateDescriptorPool(device);
-    if (!desc.bindings.empty())
+    if (hasDynamicDescriptorSet)
         CreateDescriptorCache(device, setLayouts_[SetLayoutType_DynamicBindings].Get());
     if (!desc.staticSamplers.empty())
         CreateStaticDescriptorSet(device, setLayouts_[SetLayoutType_ImmutableSamplers].Get());
@@ -207,10 +225,11 @@ bool VKPipelineLayout::NeedsShaderModulePermutation(const VKShader& shaderVK) co
     );
 }
 
-VKPtr<VkShaderModule> VKPipelineLayout::CreateVkShaderModulePermutation(VKShader& shaderVK) const
+bool VKPipelineLayout::CreateShaderCodePermutation(const VKShader& shaderVK, VKShaderCode& outShaderCode) const
 {
-    return shaderVK.CreateVkShaderModulePermutation(
-        std::bind(&VKPipelineLayout::GetBindingSlotsAssignment, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)
+    return shaderVK.CreateShaderCodePermutation(
+        std::bind(&VKPipelineLayout::GetBindingSlotsAssignment, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3),
+        outShaderCode
     );
 }
 
@@ -251,6 +270,10 @@ static VkShaderStageFlags GetVkShaderStageFlags(long flags)
     if ((flags & StageFlags::GeometryStage      ) != 0) { bitmask |= VK_SHADER_STAGE_GEOMETRY_BIT;                }
     if ((flags & StageFlags::FragmentStage      ) != 0) { bitmask |= VK_SHADER_STAGE_FRAGMENT_BIT;                }
     if ((flags & StageFlags::ComputeStage       ) != 0) { bitmask |= VK_SHADER_STAGE_COMPUTE_BIT;                 }
+    #if VK_EXT_mesh_shader
+    if ((flags & StageFlags::TaskStage          ) != 0) { bitmask |= VK_SHADER_STAGE_TASK_BIT_EXT;                }
+    if ((flags & StageFlags::MeshStage          ) != 0) { bitmask |= VK_SHADER_STAGE_MESH_BIT_EXT;                }
+    #endif
 
     return bitmask;
 }
@@ -271,6 +294,8 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
             break;
 
         case ResourceType::Buffer:
+            if ((desc.bindFlags & BindFlags::AccelerationStructure) != 0)
+                LLGL_TRAP_FEATURE_NOT_SUPPORTED("acceleration structure bindings (VK_KHR_ray_query)");
             if ((desc.bindFlags & BindFlags::ConstantBuffer) != 0)
                 return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
             if ((desc.bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0)
@@ -286,16 +311,33 @@ static VkDescriptorType GetVkDescriptorType(const BindingDescriptor& desc)
 void VKPipelineLayout::CreateVkDescriptorSetLayout(
     VkDevice                                        device,
     SetLayoutType                                   setLayoutType,
-    const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings)
+    const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings,
+    const ArrayView<VkFlags>&                       setLayoutBindingFlags,
+    VkDescriptorSetLayoutCreateFlags                setLayoutFlags)
 {
     VkDescriptorSetLayoutCreateInfo createInfo;
     {
         createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
         createInfo.pNext        = nullptr;
-        createInfo.flags        = 0;
+        createInfo.flags        = setLayoutFlags;
         createInfo.bindingCount = static_cast<std::uint32_t>(setLayoutBindings.size());
         createInfo.pBindings    = setLayoutBindings.data();
     }
+
+    #if VK_EXT_descriptor_indexing
+    /* Chain binding flags for bindless descriptor sets */
+    VkDescriptorSetLayoutBindingFlagsCreateInfoEXT bindingFlagsInfo;
+    if (!setLayoutBindingFlags.empty())
+    {
+        LLGL_ASSERT(setLayoutBindingFlags.size() == setLayoutBindings.size(), "mismatch between number of Vulkan descriptor set layout bindings and binding flags");
+        bindingFlagsInfo.sType          = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+        bindingFlagsInfo.pNext          = nullptr;
+        bindingFlagsInfo.bindingCount   = static_cast<std::uint32_t>(setLayoutBindingFlags.size());
+        bindingFlagsInfo.pBindingFlags  = setLayoutBindingFlags.data();
+        createInfo.pNext                = &bindingFlagsInfo;
+    }
+    #endif // /VK_EXT_descriptor_indexing
+
     VkResult result = vkCreateDescriptorSetLayout(device, &createInfo, nullptr, setLayouts_[setLayoutType].ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan descriptor set layout");
 }
@@ -309,11 +351,59 @@ static void ConvertBindingDesc(VkDescriptorSetLayoutBinding& dst, const BindingD
     dst.pImmutableSamplers  = nullptr;
 }
 
+/*
+Converts all uniform buffers into dynamic uniform buffers, so their ranges can be changed with dynamic offsets instead of descriptor updates.
+Only convert them if they don't exceed the minimum guaranteed limit of 'VkPhysicalDeviceLimits::maxDescriptorSetUniformBuffersDynamic'.
+*/
+static void ConvertToDynamicUniformBuffers(std::vector<VkDescriptorSetLayoutBinding>& setLayoutBindings)
+{
+    std::uint32_t numUniformBuffers = 0;
+    for (const VkDescriptorSetLayoutBinding& binding : setLayoutBindings)
+    {
+        if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+            numUniformBuffers += binding.descriptorCount;
+    }
+
+    if (numUniformBuffers > 0 && numUniformBuffers <= LLGL_VK_MAX_NUM_DYNAMIC_UNIFORM_BUFFERS)
+    {
+        for (VkDescriptorSetLayoutBinding& binding : setLayoutBindings)
+        {
+            if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+                binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+        }
+    }
+}
+
+// Assigns the indices into the dynamic offsets, which are ordered by binding number and array element (see vkCmdBindDescriptorSets).
+static void AssignDynamicOffsetIndices(std::vector<VKLayoutBinding>& bindings)
+{
+    std::vector<VKLayoutBinding*> dynamicBindings;
+    for (VKLayoutBinding& binding : bindings)
+    {
+        if (binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+            dynamicBindings.push_back(&binding);
+    }
+
+    std::sort(
+        dynamicBindings.begin(), dynamicBindings.end(),
+        [](const VKLayoutBinding* lhs, const VKLayoutBinding* rhs) -> bool
+        {
+            if (lhs->dstBinding != rhs->dstBinding)
+                return (lhs->dstBinding < rhs->dstBinding);
+            return (lhs->dstArrayElement < rhs->dstArrayElement);
+        }
+    );
+
+    for_range(i, dynamicBindings.size())
+        dynamicBindings[i]->dynamicOffsetIndex = static_cast<std::uint32_t>(i);
+}
+
 void VKPipelineLayout::CreateBindingSetLayout(
     VkDevice                                device,
     const std::vector<BindingDescriptor>&   inBindings,
     std::vector<VKLayoutBinding>&           outBindings,
-    SetLayoutType                           setLayoutType)
+    SetLayoutType                           setLayoutType,
+    const VKPhysicalDevice*                 bindlessPhysicalDevice)
 {
     /* Convert heap bindings to native descriptor set layout bindings and create Vulkan descriptor set layout */
     const std::size_t numBindings = inBindings.size();
@@ -322,7 +412,51 @@ void VKPipelineLayout::CreateBindingSetLayout(
     for_range(i, numBindings)
         ConvertBindingDesc(setLayoutBindings[i], inBindings[i]);
 
-    CreateVkDescriptorSetLayout(device, setLayoutType, setLayoutBindings);
+    VkDescriptorSetLayoutCreateFlags setLayoutFlags = 0;
+
+    if (setLayoutType == SetLayoutType_DynamicBindings)
+    {
+        #if VK_KHR_push_descriptor
+        /* Push descriptor sets must not contain dynamic uniform buffers, but their buffer ranges can be pushed just as cheaply */
+        if (hasPushDescriptorSet_)
+            setLayoutFlags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+        else
+        #endif
+            ConvertToDynamicUniformBuffers(setLayoutBindings);
+    }
+
+    /* Make all bindings partially bound and updatable after bind for bindless resource heaps; partially bound descriptors are supported for all types or none */
+    std::vector<VkFlags> setLayoutBindingFlags;
+
+    #if VK_EXT_descriptor_indexing
+    if (bindlessPhysicalDevice != nullptr && bindlessPhysicalDevice->GetBindlessDescriptorBindingFlags(VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE) != 0)
+    {
+        constexpr VkFlags updateWhilePendingFlags = (VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT);
+
+        bool canUpdateWhilePending = true;
+        setLayoutBindingFlags.resize(numBindings);
+
+        for_range(i, numBindings)
+        {
+            const VkFlags flags = bindlessPhysicalDevice->GetBindlessDescriptorBindingFlags(setLayoutBindings[i].descriptorType);
+            setLayoutBindingFlags[i] = flags;
+
+            /* Set layouts with update-after-bind descriptors must only be allocated from update-after-bind pools */
+            if ((flags & VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT) != 0)
+                setLayoutFlags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT;
+            if ((flags & updateWhilePendingFlags) != updateWhilePendingFlags)
+                canUpdateWhilePending = false;
+        }
+
+        if (setLayoutType == SetLayoutType_HeapBindings)
+        {
+            hasUpdateAfterBindHeap_     = (setLayoutFlags != 0);
+            canUpdateHeapWhilePending_  = canUpdateWhilePending;
+        }
+    }
+    #endif // /VK_EXT_descriptor_indexing
+
+    CreateVkDescriptorSetLayout(device, setLayoutType, setLayoutBindings, setLayoutBindingFlags, setLayoutFlags);
 
     /* Create list of binding points (for later pass to 'VkWriteDescriptorSet::dstBinding') */
     outBindings.reserve(numBindings);
@@ -336,11 +470,15 @@ void VKPipelineLayout::CreateBindingSetLayout(
                     /*dstBinding:*/         inBindings[i].slot.index,
                     /*dstArrayElement:*/    arrayElement,
                     /*stageFlags:*/         inBindings[i].stageFlags,
-                    /*descriptorType:*/     setLayoutBindings[i].descriptorType
+                    /*descriptorType:*/     setLayoutBindings[i].descriptorType,
+                    /*dynamicOffsetIndex:*/ ~0u
                 }
             );
         }
     }
+
+    if (setLayoutType == SetLayoutType_DynamicBindings)
+        AssignDynamicOffsetIndices(outBindings);
 }
 
 static void ConvertImmutableSamplerDesc(VkDescriptorSetLayoutBinding& dst, const StaticSamplerDescriptor& src, const VkSampler* immutableSamplerVK)
@@ -409,8 +547,11 @@ void VKPipelineLayout::CreateDescriptorPool(VkDevice device)
     /* Accumulate descriptor pool sizes for all dynamic resources and immutable samplers */
     VKPoolSizeAccumulator poolSizeAccum;
 
-    for (const VKLayoutBinding& binding : bindings_)
-        poolSizeAccum.Accumulate(binding.descriptorType);
+    if (!hasPushDescriptorSet_)
+    {
+        for (const VKLayoutBinding& binding : bindings_)
+            poolSizeAccum.Accumulate(binding.descriptorType);
+    }
 
     if (!immutableSamplers_.empty())
         poolSizeAccum.Accumulate(VK_DESCRIPTOR_TYPE_SAMPLER, static_cast<std::uint32_t>(immutableSamplers_.size()));
@@ -477,6 +618,20 @@ void VKPipelineLayout::BuildDescriptorSetBindingTables(const PipelineLayoutDescr
     BuildDescriptorSetBindingSlots(setBindingTables_[SetLayoutType_HeapBindings], desc.heapBindings);
     BuildDescriptorSetBindingSlots(setBindingTables_[SetLayoutType_DynamicBindings], desc.bindings);
     BuildDescriptorSetBindingSlots(setBindingTables_[SetLayoutType_ImmutableSamplers], desc.staticSamplers);
+
+    /* Hash binding slot assignments in the same order they are applied to shader module permutations */
+    permutationSignature_ = g_hashSeed;
+    for_range(i, layoutTypeOrder_.Count())
+    {
+        const DescriptorSetBindingTable& bindingTable = setBindingTables_[layoutTypeOrder_[i]];
+        HashValue(permutationSignature_, bindingTable.dstSet);
+        HashValue(permutationSignature_, static_cast<std::uint32_t>(bindingTable.srcSlots.size()));
+        for (const BindingSlot& slot : bindingTable.srcSlots)
+        {
+            HashValue(permutationSignature_, slot.index);
+            HashValue(permutationSignature_, slot.set);
+        }
+    }
 }
 
 template <typename TContainer>
@@ -25,6 +25,7 @@ namespace LLGL
 
 class VKDescriptorCache;
 class VKPoolSizeAccumulator;
+class VKPhysicalDevice;
 
 struct VKLayoutBinding
 {
@@ -32,6 +33,7 @@ struct VKLayoutBinding
     std::uint32_t       dstArrayElement;
     long                stageFlags;
     VkDescriptorType    descriptorType;
+    std::uint32_t       dynamicOffsetIndex; // Index into the dynamic offsets for VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC; ~0u otherwise.
 };
 
 class VKPipelineLayout final : public PipelineLayout
@@ -43,7 +45,7 @@ class VKPipelineLayout final : public PipelineLayout
 
     public:
 
-        VKPipelineLayout(VkDevice device, const PipelineLayoutDescriptor& desc);
+        VKPipelineLayout(const VKPhysicalDevice& physicalDevice, VkDevice device, const PipelineLayoutDescriptor& desc);
         ~VKPipelineLayout();
 
         /*
@@ -59,8 +61,17 @@ class VKPipelineLayout final : public PipelineLayout
         // Returns true if a permutation is required for the specified shader.
         bool NeedsShaderModulePermutation(const VKShader& shaderVK) const;
 
-        // Creates a permutation of the specified shader. Should only be used by VKShaderModulePool.
-        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(VKShader& shaderVK) const;
+        // Creates the SPIR-V code of a permutation of the specified shader. Returns false if no permutation is needed. Should only be used by VKShaderModulePool.
+        bool CreateShaderCodePermutation(const VKShader& shaderVK, VKShaderCode& outShaderCode) const;
+
+        /*
+        Returns the hash of the binding slot assignments this layout applies to shader module permutations.
+        Two pipeline layouts with equal signatures produce the same permutation of a shader. This hash is stable across runs.
+        */
+        inline std::uint64_t GetPermutationSignature() const
+        {
+            return permutationSignature_;
+        }
 
         // Returns the native VkPipelineLayout object.
         inline VkPipelineLayout GetVkPipelineLayout() const
@@ -116,6 +127,15 @@ class VKPipelineLayout final : public PipelineLayout
             return bindings_;
         }
 
+        /*
+        Returns true if the dynamic bindings are updated with push descriptors (VK_KHR_push_descriptor).
+        In that case, there is no descriptor cache and the dynamic bindings never use dynamic uniform buffers.
+        */
+        inline bool HasPushDescriptorSet() const
+        {
+            return hasPushDescriptorSet_;
+        }
+
         // Returns the descriptor cache for dynamic resources or null if there is none.
         inline VKDescriptorCache* GetDescriptorCache() const
         {
@@ -134,6 +154,18 @@ class VKPipelineLayout final : public PipelineLayout
             return barrierFlags_;
         }
 
+        // Returns true if the heap bindings must be allocated from a descriptor pool with VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT.
+        inline bool HasUpdateAfterBindHeapBindings() const
+        {
+            return hasUpdateAfterBindHeap_;
+        }
+
+        // Returns true if all heap bindings are bindless and can be updated while they are bound in pending command buffers.
+        inline bool CanUpdateHeapBindingsWhilePending() const
+        {
+            return canUpdateHeapWhilePending_;
+        }
+
     public:
 
         // Creates the default VkPipelineLayout object.
@@ -169,14 +201,17 @@ class VKPipelineLayout final : public PipelineLayout
         void CreateVkDescriptorSetLayout(
             VkDevice                                        device,
             SetLayoutType                                   setLayoutType,
-            const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings
+            const ArrayView<VkDescriptorSetLayoutBinding>&  setLayoutBindings,
+            const ArrayView<VkFlags>&                       setLayoutBindingFlags   = {},
+            VkDescriptorSetLayoutCreateFlags                setLayoutFlags          = 0
         );
 
         void CreateBindingSetLayout(
             VkDevice                                device,
             const std::vector<BindingDescriptor>&   inBindings,
             std::vector<VKLayoutBinding>&           outBindings,
-            SetLayoutType                           setLayoutType
+            SetLayoutType                           setLayoutType,
+            const VKPhysicalDevice*                 bindlessPhysicalDevice  = nullptr
         );
 
         void CreateImmutableSamplers(
@@ -214,6 +249,7 @@ class VKPipelineLayout final : public PipelineLayout
         VKPtr<VkDescriptorSetLayout>        setLayouts_[SetLayoutType_Num];
         DescriptorSetBindingTable           setBindingTables_[SetLayoutType_Num];
         PackedPermutation3                  layoutTypeOrder_;
+        std::uint64_t                       permutationSignature_       = 0;
 
         VKPtr<VkDescriptorPool>             descriptorPool_;
         std::unique_ptr<VKDescriptorCache>  descriptorCache_;
@@ -225,6 +261,9 @@ class VKPipelineLayout final : public PipelineLayout
         std::vector<UniformDescriptor>      uniformDescs_;
 
         long                                barrierFlags_                           = 0;
+        bool                                hasUpdateAfterBindHeap_                 = false;
+        bool                                canUpdateHeapWhilePending_              = false;
+        bool                                hasPushDescriptorSet_                   = false;
 
 };
 
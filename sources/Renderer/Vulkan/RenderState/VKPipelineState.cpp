@@ -10,6 +10,10 @@
 #include "../Shader/VKShader.h"
 #include "../Shader/VKShaderModulePool.h"
 #include "../../CheckedCast.h"
+#include <LLGL/PipelineStateFlags.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 
 
 namespace LLGL
@@ -29,17 +33,30 @@ VKPipelineState::VKPipelineState(
     {
         pipelineLayout_ = LLGL_CAST(const VKPipelineLayout*, pipelineLayout);
         if (pipelineLayout_->GetNumUniforms() > 0)
+        {
             pipelineLayoutPerm_ = pipelineLayout_->CreateVkPipelineLayoutPermutation(device, shaders, uniformRanges_);
+            for (const VkPushConstantRange& range : uniformRanges_)
+                pushConstantsSize_ = std::max(pushConstantsSize_, range.offset + range.size);
+        }
     }
 }
 
 const Report* VKPipelineState::GetReport() const
 {
+    WaitForCompilation();
     return (*report_.GetText() != '\0' || report_.HasErrors() ? &report_ : nullptr);
 }
 
+bool VKPipelineState::IsReady() const
+{
+    return compileJob_.IsDone();
+}
+
 void VKPipelineState::BindPipelineAndStaticDescriptorSet(VkCommandBuffer commandBuffer)
 {
+    /* Wait for asynchronous compilation to finish */
+    WaitForCompilation();
+
     vkCmdBindPipeline(commandBuffer, GetBindPoint(), GetVkPipeline());
 
     if (pipelineLayout_ != nullptr)
@@ -66,7 +83,9 @@ void VKPipelineState::BindDescriptorSets(
     VkCommandBuffer         commandBuffer,
     std::uint32_t           firstSet,
     std::uint32_t           descriptorSetCount,
-    const VkDescriptorSet*  descriptorSets)
+    const VkDescriptorSet*  descriptorSets,
+    std::uint32_t           dynamicOffsetCount,
+    const std::uint32_t*    dynamicOffsets)
 {
     vkCmdBindDescriptorSets(
         /*commandBuffer:*/      commandBuffer,
@@ -75,34 +94,80 @@ void VKPipelineState::BindDescriptorSets(
         /*firstSet:*/           firstSet,
         /*descriptorSetCount:*/ descriptorSetCount,
         /*pDescriptorSets:*/    descriptorSets,
-        /*dynamicOffsetCount:*/ 0,
-        /*pDynamicOffsets*/     nullptr
+        /*dynamicOffsetCount:*/ dynamicOffsetCount,
+        /*pDynamicOffsets*/     dynamicOffsets
     );
 }
 
-void VKPipelineState::BindDynamicDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet)
+void VKPipelineState::BindDynamicDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, const ArrayView<std::uint32_t>& dynamicOffsets)
 {
     if (pipelineLayout_ != nullptr && descriptorSet != VK_NULL_HANDLE)
-        BindDescriptorSets(commandBuffer, pipelineLayout_->GetBindPointForDynamicBindings(), 1, &descriptorSet);
+    {
+        BindDescriptorSets(
+            commandBuffer,
+            pipelineLayout_->GetBindPointForDynamicBindings(),
+            1,
+            &descriptorSet,
+            static_cast<std::uint32_t>(dynamicOffsets.size()),
+            dynamicOffsets.data()
+        );
+    }
 }
 
+#if VK_KHR_push_descriptor
+
+void VKPipelineState::PushDynamicDescriptorSet(VkCommandBuffer commandBuffer, const ArrayView<VkWriteDescriptorSet>& descriptorWrites)
+{
+    if (pipelineLayout_ != nullptr && !descriptorWrites.empty())
+    {
+        vkCmdPushDescriptorSetKHR(
+            /*commandBuffer:*/          commandBuffer,
+            /*pipelineBindPoint:*/      GetBindPoint(),
+            /*layout:*/                 GetVkPipelineLayout(),
+            /*set:*/                    pipelineLayout_->GetBindPointForDynamicBindings(),
+            /*descriptorWriteCount:*/   static_cast<std::uint32_t>(descriptorWrites.size()),
+            /*pDescriptorWrites:*/      descriptorWrites.data()
+        );
+    }
+}
+
+#endif // /VK_KHR_push_descriptor
+
 void VKPipelineState::BindHeapDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet)
 {
     if (pipelineLayout_ != nullptr && descriptorSet != VK_NULL_HANDLE)
         BindDescriptorSets(commandBuffer, pipelineLayout_->GetBindPointForHeapBindings(), 1, &descriptorSet);
 }
 
-void VKPipelineState::PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size)
+std::uint32_t VKPipelineState::StagePushConstants(std::uint32_t first, const char* data, std::uint32_t size, char* dstData) const
+{
+    std::uint32_t count = 0;
+
+    for (const std::uint32_t end = static_cast<std::uint32_t>(uniformRanges_.size()); first + count < end; ++count)
+    {
+        /* Stop once we reached end of input data */
+        const VkPushConstantRange& currentRange = uniformRanges_[first + count];
+        if (size < currentRange.size)
+            break;
+
+        ::memcpy(dstData + currentRange.offset, data, currentRange.size);
+        data += currentRange.size;
+        size -= currentRange.size;
+    }
+
+    return count;
+}
+
+void VKPipelineState::FlushPushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, std::uint32_t count, const char* srcData) const
 {
     if (first >= uniformRanges_.size())
         return /*OutOfBounds*/;
 
     VkPipelineLayout layout = GetVkPipelineLayout();
 
-    const char* pendingData = data;
     VkPushConstantRange pendingRange = {};
 
-    auto FlushPushConstants = [&pendingRange, &pendingData, layout, commandBuffer]()
+    auto FlushPendingRange = [&pendingRange, srcData, layout, commandBuffer]()
     {
         if (pendingRange.size > 0)
         {
@@ -112,32 +177,33 @@ void VKPipelineState::PushConstants(VkCommandBuffer commandBuffer, std::uint32_t
                 pendingRange.stageFlags,
                 pendingRange.offset,
                 pendingRange.size,
-                pendingData
+                srcData + pendingRange.offset
             );
-            pendingData += pendingRange.size;
             pendingRange.size = 0;
         }
     };
 
-    for (const std::uint32_t end = static_cast<std::uint32_t>(uniformRanges_.size()); first < end; ++first)
+    /* Merge adjacent and overlapping ranges with the same stage flags; the shadow data is indexed by push-constant offsets */
+    for (const std::uint32_t end = std::min(first + count, static_cast<std::uint32_t>(uniformRanges_.size())); first < end; ++first)
     {
-        /* Stop once we reached end of input data */
         const VkPushConstantRange& currentRange = uniformRanges_[first];
-        if (size < currentRange.size)
-            break;
+        if (currentRange.size == 0)
+            continue;
 
-        if (currentRange.offset > pendingRange.offset + pendingRange.size || currentRange.stageFlags != pendingRange.stageFlags)
+        const std::uint32_t pendingEnd = pendingRange.offset + pendingRange.size;
+        if (pendingRange.size == 0 ||
+            currentRange.stageFlags != pendingRange.stageFlags ||
+            currentRange.offset < pendingRange.offset ||
+            currentRange.offset > pendingEnd)
         {
-            FlushPushConstants();
-            pendingRange.stageFlags = currentRange.stageFlags;
-            pendingRange.offset     = currentRange.offset;
+            FlushPendingRange();
+            pendingRange = currentRange;
         }
-
-        pendingRange.size   += currentRange.size;
-        size                -= currentRange.size;
+        else
+            pendingRange.size = std::max(pendingEnd, currentRange.offset + currentRange.size) - pendingRange.offset;
     }
 
-    FlushPushConstants();
+    FlushPendingRange();
 }
 
 
@@ -150,6 +216,19 @@ VkPipeline* VKPipelineState::ReleaseAndGetAddressOfVkPipeline()
     return pipeline_.ReleaseAndGetAddressOf();
 }
 
+void VKPipelineState::RunCompilation(bool isAsync, const std::function<void()>& task)
+{
+    if (isAsync)
+        compileJob_.Start(task);
+    else
+        task();
+}
+
+void VKPipelineState::WaitForCompilation() const
+{
+    compileJob_.Wait();
+}
+
 VkPipelineLayout VKPipelineState::GetVkPipelineLayout() const
 {
     if (pipelineLayoutPerm_.Get() != VK_NULL_HANDLE)
@@ -159,13 +238,45 @@ VkPipelineLayout VKPipelineState::GetVkPipelineLayout() const
     return VKPipelineLayout::GetDefault();
 }
 
-void VKPipelineState::GetShaderCreateInfoAndOptionalPermutation(VKShader& shaderVK, VkPipelineShaderStageCreateInfo& outCreateInfo)
+void VKPipelineState::GetShaderCreateInfoAndOptionalPermutation(
+    VKShader&                           shaderVK,
+    VkPipelineShaderStageCreateInfo&    outCreateInfo,
+    const VkSpecializationInfo*         specializationInfo)
 {
     shaderVK.FillShaderStageCreateInfo(outCreateInfo);
+    outCreateInfo.pSpecializationInfo = specializationInfo;
     if (pipelineLayout_ != nullptr && pipelineLayout_->NeedsShaderModulePermutation(shaderVK))
         outCreateInfo.module = VKShaderModulePool::Get().GetOrCreateVkShaderModulePermutation(shaderVK, *pipelineLayout_);
 }
 
+const VkSpecializationInfo* VKPipelineState::FillSpecializationInfo(
+    const std::vector<SpecializationConstant>&  constants,
+    VkSpecializationInfo&                       outSpecializationInfo,
+    std::vector<VkSpecializationMapEntry>&      outMapEntries)
+{
+    if (constants.empty())
+        return nullptr;
+
+    /* Map each constant ID to the value field of its entry, so the input container can be passed as specialization data without a copy */
+    outMapEntries.resize(constants.size());
+    for (std::size_t i = 0; i < constants.size(); ++i)
+    {
+        VkSpecializationMapEntry& mapEntry = outMapEntries[i];
+        {
+            mapEntry.constantID = constants[i].id;
+            mapEntry.offset     = static_cast<std::uint32_t>(sizeof(SpecializationConstant) * i + offsetof(SpecializationConstant, value));
+            mapEntry.size       = sizeof(std::uint32_t);
+        }
+    }
+
+    outSpecializationInfo.mapEntryCount = static_cast<std::uint32_t>(outMapEntries.size());
+    outSpecializationInfo.pMapEntries   = outMapEntries.data();
+    outSpecializationInfo.dataSize      = sizeof(SpecializationConstant) * constants.size();
+    outSpecializationInfo.pData         = constants.data();
+
+    return &outSpecializationInfo;
+}
+
 
 } // /namespace LLGL
 
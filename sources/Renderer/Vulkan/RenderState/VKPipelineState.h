@@ -13,7 +13,9 @@
 #include <LLGL/Container/ArrayView.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "../../../Core/Threading.h"
 #include <vector>
+#include <functional>
 #include <cstdint>
 
 
@@ -24,6 +26,7 @@ namespace LLGL
 class Shader;
 class PipelineLayout;
 class VKShader;
+struct SpecializationConstant;
 class VKPipelineLayout;
 
 class VKPipelineState : public PipelineState
@@ -39,20 +42,33 @@ class VKPipelineState : public PipelineState
         );
 
         const Report* GetReport() const override;
+        bool IsReady() const override;
 
     public:
 
         // Binds this pipeline state and optional static descriptor sets (for immutable samplers) to the specified Vulkan command buffer.
         void BindPipelineAndStaticDescriptorSet(VkCommandBuffer commandBuffer);
 
-        // Binds the specified descriptor set to the dynamic descriptor set binding point.
-        void BindDynamicDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet);
+        // Binds the specified descriptor set to the dynamic descriptor set binding point with the dynamic offsets for its dynamic uniform buffers.
+        void BindDynamicDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, const ArrayView<std::uint32_t>& dynamicOffsets = {});
+
+        #if VK_KHR_push_descriptor
+        // Pushes the specified descriptors to the dynamic descriptor set binding point. Only valid if the pipeline layout has a push descriptor set.
+        void PushDynamicDescriptorSet(VkCommandBuffer commandBuffer, const ArrayView<VkWriteDescriptorSet>& descriptorWrites);
+        #endif
 
         // Binds the specified descriptor set to teh heap descriptor set binding point.
         void BindHeapDescriptorSet(VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet);
 
-        // Pushes the specified values to the command buffer as push-constants.
-        void PushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, const char* data, std::uint32_t size);
+        /*
+        Copies the specified uniform values into the push-constant shadow data 'dstData' at their push-constant offsets.
+        Returns the number of uniforms that were written, starting with the uniform at index 'first'.
+        The shadow data must be at least as large as GetPushConstantsSize().
+        */
+        std::uint32_t StagePushConstants(std::uint32_t first, const char* data, std::uint32_t size, char* dstData) const;
+
+        // Pushes the staged values of the uniforms in the range [first, first + count) from the shadow data to the command buffer with as few commands as possible.
+        void FlushPushConstants(VkCommandBuffer commandBuffer, std::uint32_t first, std::uint32_t count, const char* srcData) const;
 
         // Returns the native PSO.
         inline VkPipeline GetVkPipeline() const
@@ -72,6 +88,12 @@ class VKPipelineState : public PipelineState
             return pipelineLayout_;
         }
 
+        // Returns the size (in bytes) of the push-constant block of all uniforms, i.e. the end of the last push-constant range.
+        inline std::uint32_t GetPushConstantsSize() const
+        {
+            return pushConstantsSize_;
+        }
+
     protected:
 
         // Releases the native PSO and returns its address.
@@ -86,7 +108,27 @@ class VKPipelineState : public PipelineState
         - If the shader module has a binding set mismatch with the pipeline layout,
           a permutation of the shader module will be created to match the internal binding set layout of the Vulkan backend.
         */
-        void GetShaderCreateInfoAndOptionalPermutation(VKShader& shaderVK, VkPipelineShaderStageCreateInfo& outCreateInfo);
+        void GetShaderCreateInfoAndOptionalPermutation(
+            VKShader&                           shaderVK,
+            VkPipelineShaderStageCreateInfo&    outCreateInfo,
+            const VkSpecializationInfo*         specializationInfo  = nullptr
+        );
+
+        /*
+        Fills the native specialization info for the specified constants and returns its address, or null if the list is empty.
+        The specialization data refers directly to the input container, so it must outlive the output specialization info.
+        */
+        static const VkSpecializationInfo* FillSpecializationInfo(
+            const std::vector<SpecializationConstant>&  constants,
+            VkSpecializationInfo&                       outSpecializationInfo,
+            std::vector<VkSpecializationMapEntry>&      outMapEntries
+        );
+
+        // Runs the specified compilation task on a worker thread if 'isAsync' is true, or on the calling thread otherwise.
+        void RunCompilation(bool isAsync, const std::function<void()>& task);
+
+        // Blocks until an asynchronous compilation has finished. Must be called before the native PSO is accessed.
+        void WaitForCompilation() const;
 
         // Returns the mutable report object.
         inline Report& GetMutableReport()
@@ -100,7 +142,9 @@ class VKPipelineState : public PipelineState
             VkCommandBuffer         commandBuffer,
             std::uint32_t           firstSet,
             std::uint32_t           descriptorSetCount,
-            const VkDescriptorSet*  descriptorSets
+            const VkDescriptorSet*  descriptorSets,
+            std::uint32_t           dynamicOffsetCount  = 0,
+            const std::uint32_t*    dynamicOffsets      = nullptr
         );
 
     private:
@@ -110,7 +154,9 @@ class VKPipelineState : public PipelineState
         const VKPipelineLayout*             pipelineLayout_     = nullptr;
         VkPipelineBindPoint                 bindPoint_          = VK_PIPELINE_BIND_POINT_MAX_ENUM;
         std::vector<VkPushConstantRange>    uniformRanges_;     // Push constant ranges; One range for each uniform descriptor. See UniformDescriptor.
+        std::uint32_t                       pushConstantsSize_  = 0;
         Report                              report_;
+        mutable AsyncJob                    compileJob_;        // Must be the last member, so it waits for the compilation before the other members are destroyed.
 
 };
 
@@ -164,7 +164,7 @@ void VKRenderPass::CreateVkRenderPass(VkDevice device, const RenderPassDescripto
     }
 
     /* Create render pass with native attachment descriptors */
-    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs, sampleCountBits);
+    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs, sampleCountBits, desc.viewMask);
 }
 
 void VKRenderPass::CreateVkRenderPassWithDescriptors(
@@ -172,7 +172,8 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
     std::uint32_t                   numAttachments,
     std::uint32_t                   numColorAttachments,
     const VkAttachmentDescription*  attachmentDescs,
-    VkSampleCountFlagBits           sampleCountBits)
+    VkSampleCountFlagBits           sampleCountBits,
+    std::uint32_t                   viewMask)
 {
     LLGL_ASSERT(numAttachments <= LLGL_MAX_NUM_ATTACHMENTS);
     LLGL_ASSERT(numColorAttachments <= LLGL_MAX_NUM_COLOR_ATTACHMENTS);
@@ -184,7 +185,21 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
 
     /* Store sample count bits and number of color attachments (required for default blend states in VKGraphicsPipeline) */
     sampleCountBits_        = sampleCountBits;
+    viewMask_               = viewMask;
     numColorAttachments_    = static_cast<std::uint8_t>(numColorAttachments);
+    numAttachments_         = static_cast<std::uint8_t>(numAttachments);
+
+    /* Store attachment formats to create compatible render passes */
+    const std::uint32_t numAttachmentDescs = (sampleCountBits > VK_SAMPLE_COUNT_1_BIT ? numAttachments + numColorAttachments : numAttachments);
+    for_range(i, numAttachmentDescs)
+        attachmentFormats_[i] = attachmentDescs[i].format;
+
+    /* Store load/store operations to begin dynamic rendering with the same semantics as this render pass */
+    for_range(i, numAttachments)
+    {
+        attachmentLoadOps_[i]   = attachmentDescs[i].loadOp;
+        attachmentStoreOps_[i]  = attachmentDescs[i].storeOp;
+    }
 
     /* Build bitmask for clear values: least significant bit (LSB) is used for the first attachment */
     clearValuesMask_ = 0;
@@ -211,7 +226,11 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         depthStencilIndex_ = static_cast<std::uint8_t>(numColorAttachments);
         depthStencilAttachmentRef.attachment    = depthStencilIndex_;
         depthStencilAttachmentRef.layout        = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        stencilLoadOp_                          = attachmentDescs[depthStencilIndex_].stencilLoadOp;
+        stencilStoreOp_                         = attachmentDescs[depthStencilIndex_].stencilStoreOp;
     }
+    else
+        depthStencilIndex_ = 0xFFu;
 
     const bool hasMultiSampling = (sampleCountBits > VK_SAMPLE_COUNT_1_BIT);
     if (hasMultiSampling)
@@ -259,11 +278,33 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
         subpassDep.dependencyFlags  = 0;
     }
 
+    /* Initialize multiview info for the only sub-pass; views can be rendered concurrently as they don't depend on each other */
+    #if VK_KHR_multiview
+    VkRenderPassMultiviewCreateInfoKHR multiviewInfo;
+    if (viewMask != 0)
+    {
+        multiviewInfo.sType                 = VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO_KHR;
+        multiviewInfo.pNext                 = nullptr;
+        multiviewInfo.subpassCount          = 1;
+        multiviewInfo.pViewMasks            = &viewMask;
+        multiviewInfo.dependencyCount       = 0;
+        multiviewInfo.pViewOffsets          = nullptr;
+        multiviewInfo.correlationMaskCount  = 1;
+        multiviewInfo.pCorrelationMasks     = &viewMask;
+    }
+    #else
+    LLGL_ASSERT(viewMask == 0, "multiview rendering requires VK_KHR_multiview");
+    #endif
+
     /* Create swap-chain render pass */
     VkRenderPassCreateInfo createInfo;
     {
         createInfo.sType            = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        #if VK_KHR_multiview
+        createInfo.pNext            = (viewMask != 0 ? &multiviewInfo : nullptr);
+        #else
         createInfo.pNext            = nullptr;
+        #endif
         createInfo.flags            = 0;
         createInfo.attachmentCount  = (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments);
         createInfo.pAttachments     = attachmentDescs;
@@ -276,6 +317,37 @@ void VKRenderPass::CreateVkRenderPassWithDescriptors(
     VKThrowIfFailed(result, "failed to create Vulkan render pass");
 }
 
+void VKRenderPass::CreateCompatibleVkRenderPass(VkDevice device, const VKRenderPass& other)
+{
+    const std::uint32_t numAttachments      = other.numAttachments_;
+    const std::uint32_t numColorAttachments = other.numColorAttachments_;
+    const bool          hasMultiSampling    = (other.sampleCountBits_ > VK_SAMPLE_COUNT_1_BIT);
+    const std::uint32_t numAttachmentDescs  = (hasMultiSampling ? numAttachments + numColorAttachments : numAttachments);
+
+    /* Only copy formats and sample counts; load/store operations and layouts are irrelevant for render pass compatibility */
+    VkAttachmentDescription attachmentDescs[LLGL_MAX_NUM_ATTACHMENTS + LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+
+    for_range(i, numAttachmentDescs)
+    {
+        const bool isDepthStencil = (i == numColorAttachments && numColorAttachments < numAttachments);
+
+        VkAttachmentDescription& dst = attachmentDescs[i];
+        {
+            dst.flags           = 0;
+            dst.format          = other.attachmentFormats_[i];
+            dst.samples         = (i < numAttachments ? other.sampleCountBits_ : VK_SAMPLE_COUNT_1_BIT);
+            dst.loadOp          = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+            dst.storeOp         = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+            dst.stencilLoadOp   = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+            dst.stencilStoreOp  = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+            dst.initialLayout   = VK_IMAGE_LAYOUT_UNDEFINED;
+            dst.finalLayout     = (isDepthStencil ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+        }
+    }
+
+    CreateVkRenderPassWithDescriptors(device, numAttachments, numColorAttachments, attachmentDescs, other.sampleCountBits_, other.viewMask_);
+}
+
 
 } // /namespace LLGL
 
@@ -10,6 +10,7 @@
 
 
 #include <LLGL/RenderPass.h>
+#include <LLGL/Constants.h>
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
@@ -20,6 +21,32 @@ namespace LLGL
 
 
 struct RenderPassDescriptor;
+class VKTexture;
+
+// Image of a single attachment that is rendered into with dynamic rendering (VK_KHR_dynamic_rendering).
+struct VKRenderingAttachment
+{
+    VkImage         image           = VK_NULL_HANDLE;
+    VkImageView     imageView       = VK_NULL_HANDLE;
+    VkFormat        format          = VK_FORMAT_UNDEFINED;
+    VkImageLayout   restingLayout   = VK_IMAGE_LAYOUT_UNDEFINED; // Layout of the image outside of rendering, i.e. the final layout of an equivalent VkRenderPass.
+    std::uint32_t   mipLevel        = 0;
+    std::uint32_t   arrayLayer      = 0;
+    std::uint32_t   numArrayLayers  = 1;                         // Number of array layers that are covered by multiview rendering.
+};
+
+// Set of attachments that is rendered into with dynamic rendering (VK_KHR_dynamic_rendering). Unused attachments have a null image view.
+struct VKRenderingAttachmentSet
+{
+    std::uint32_t           numColorAttachments = 0;
+    VKRenderingAttachment   colorAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKRenderingAttachment   resolveAttachments[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    VKRenderingAttachment   depthStencilAttachment;
+    VKTexture*              shadingRateTexture      = nullptr;          // Only used with VK_KHR_fragment_shading_rate
+    VkImageView             shadingRateImageView    = VK_NULL_HANDLE;
+    VkExtent2D              shadingRateTexelSize    = { 0, 0 };
+    std::uint32_t           viewMask                = 0;                // Only used with VK_KHR_multiview
+};
 
 class VKRenderPass final : public RenderPass
 {
@@ -40,9 +67,17 @@ class VKRenderPass final : public RenderPass
             std::uint32_t                   numAttachments,
             std::uint32_t                   numColorAttachments,
             const VkAttachmentDescription*  attachmentDescs,
-            VkSampleCountFlagBits           sampleCountBits
+            VkSampleCountFlagBits           sampleCountBits,
+            std::uint32_t                   viewMask        = 0
         );
 
+        /*
+        (Re-)creates the render pass object with the same attachment formats, sample count, and view mask as the specified render pass.
+        Vulkan considers such render passes as compatible regardless of their load/store operations and image layouts,
+        so the new render pass can be used for inheritance independently of the lifetime of the other render pass.
+        */
+        void CreateCompatibleVkRenderPass(VkDevice device, const VKRenderPass& other);
+
         // Returns the Vulkan render pass object.
         inline VkRenderPass GetVkRenderPass() const
         {
@@ -82,6 +117,48 @@ class VKRenderPass final : public RenderPass
             return sampleCountBits_;
         }
 
+        // Returns the multiview mask of this render pass, or 0 if multiview rendering is disabled.
+        inline std::uint32_t GetViewMask() const
+        {
+            return viewMask_;
+        }
+
+        // Returns the format of the specified color attachment.
+        inline VkFormat GetColorFormat(std::uint32_t index) const
+        {
+            return attachmentFormats_[index];
+        }
+
+        // Returns the format of the depth-stencil attachment or VK_FORMAT_UNDEFINED if there is no depth-stencil attachment.
+        inline VkFormat GetDepthStencilFormat() const
+        {
+            return (depthStencilIndex_ != 0xFFu ? attachmentFormats_[depthStencilIndex_] : VK_FORMAT_UNDEFINED);
+        }
+
+        // Returns the load operation of the specified attachment. The depth-stencil attachment is at index GetDepthStencilIndex().
+        inline VkAttachmentLoadOp GetLoadOp(std::uint32_t index) const
+        {
+            return attachmentLoadOps_[index];
+        }
+
+        // Returns the store operation of the specified attachment. The depth-stencil attachment is at index GetDepthStencilIndex().
+        inline VkAttachmentStoreOp GetStoreOp(std::uint32_t index) const
+        {
+            return attachmentStoreOps_[index];
+        }
+
+        // Returns the stencil load operation of the depth-stencil attachment.
+        inline VkAttachmentLoadOp GetStencilLoadOp() const
+        {
+            return stencilLoadOp_;
+        }
+
+        // Returns the stencil store operation of the depth-stencil attachment.
+        inline VkAttachmentStoreOp GetStencilStoreOp() const
+        {
+            return stencilStoreOp_;
+        }
+
     private:
 
         VKPtr<VkRenderPass>     renderPass_;
@@ -90,7 +167,14 @@ class VKRenderPass final : public RenderPass
         std::uint8_t            depthStencilIndex_      = 0xFFu;
         std::uint8_t            numClearValues_         = 0;
         std::uint8_t            numColorAttachments_    = 0;
+        std::uint8_t            numAttachments_         = 0;
         VkSampleCountFlagBits   sampleCountBits_        = VK_SAMPLE_COUNT_1_BIT;
+        std::uint32_t           viewMask_               = 0;
+        VkFormat                attachmentFormats_[LLGL_MAX_NUM_ATTACHMENTS + LLGL_MAX_NUM_COLOR_ATTACHMENTS]; // Formats of all attachments including resolve attachments.
+        VkAttachmentLoadOp      attachmentLoadOps_[LLGL_MAX_NUM_ATTACHMENTS];                                   // Load operations for dynamic rendering.
+        VkAttachmentStoreOp     attachmentStoreOps_[LLGL_MAX_NUM_ATTACHMENTS];                                  // Store operations for dynamic rendering.
+        VkAttachmentLoadOp      stencilLoadOp_          = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        VkAttachmentStoreOp     stencilStoreOp_         = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 
 };
 
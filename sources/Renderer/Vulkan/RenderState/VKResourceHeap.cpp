@@ -12,6 +12,7 @@
 #include "../Buffer/VKBuffer.h"
 #include "../Texture/VKSampler.h"
 #include "../Texture/VKTexture.h"
+#include "../Command/VKCommandQueue.h"
 #include "../VKTypes.h"
 #include "../VKCore.h"
 #include "../../ResourceUtils.h"
@@ -44,13 +45,14 @@ VKResourceHeap::VKResourceHeap(
 
     /* Get and validate number of bindings and resource views */
     ConvertLayoutBindings(pipelineLayoutVK->GetLayoutHeapBindings());
+    canUpdateWhilePending_ = pipelineLayoutVK->CanUpdateHeapBindingsWhilePending();
 
     const std::uint32_t numBindings         = static_cast<std::uint32_t>(bindings_.size());
     const std::uint32_t numResourceViews    = GetNumResourceViewsOrThrow(numBindings, desc, initialResourceViews);
 
     /* Create descriptor pool and array of descriptor sets */
     const std::uint32_t numDescriptorSets = (numResourceViews / numBindings);
-    CreateDescriptorPool(device, numDescriptorSets);
+    CreateDescriptorPool(device, numDescriptorSets, pipelineLayoutVK->HasUpdateAfterBindHeapBindings());
     CreateDescriptorSets(device, numDescriptorSets, pipelineLayoutVK->GetSetLayoutForHeapBindings());
 
     /* Allocate array for descriptor set barriers */
@@ -133,8 +135,12 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
 
     if (setWriter.GetNumWrites() > 0)
     {
-        /* All command buffers must have finished execution before any affected descriptor set can be updated */
-        vkDeviceWaitIdle(device);
+        /*
+        All command buffers must have finished execution before any affected descriptor set can be updated.
+        Only bindless heaps can update descriptors in place that are not used by pending command buffers.
+        */
+        if (!canUpdateWhilePending_)
+            WaitForPendingSubmits();
         setWriter.UpdateDescriptorSets(device);
     }
 
@@ -151,14 +157,27 @@ std::uint32_t VKResourceHeap::WriteResourceViews(
     return setWriter.GetNumWrites();
 }
 
-void VKResourceHeap::SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::uint32_t descriptorSet)
+void VKResourceHeap::SubmitPipelineBarrier(VKCommandContext& context, std::uint32_t descriptorSet)
 {
     if (descriptorSet < barriers_.size())
     {
         if (VKPipelineBarrier* barrier = barriers_[descriptorSet].get())
         {
             if (barrier->IsActive())
-                barrier->Submit(commandBuffer);
+                barrier->Submit(context);
+        }
+    }
+}
+
+void VKResourceHeap::MarkSubmitted(VKCommandQueue& commandQueue, std::uint64_t submitID)
+{
+    for (PendingSubmit& pending : pendingSubmits_)
+    {
+        if (pending.commandQueue == nullptr || pending.commandQueue == &commandQueue)
+        {
+            pending.commandQueue    = &commandQueue;
+            pending.submitID        = submitID;
+            return;
         }
     }
 }
@@ -184,6 +203,12 @@ static VkPipelineStageFlags ToVkStageFlags(long stageFlags)
         bitmask |= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     if ((stageFlags & StageFlags::ComputeStage) != 0)
         bitmask |= VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    #if VK_EXT_mesh_shader
+    if ((stageFlags & StageFlags::TaskStage) != 0)
+        bitmask |= VK_PIPELINE_STAGE_TASK_SHADER_BIT_EXT;
+    if ((stageFlags & StageFlags::MeshStage) != 0)
+        bitmask |= VK_PIPELINE_STAGE_MESH_SHADER_BIT_EXT;
+    #endif
 
     return bitmask;
 }
@@ -227,7 +252,7 @@ void VKResourceHeap::ConvertLayoutBinding(VKDescriptorBinding& dst, const VKLayo
     dst.bufferViewIndex = (IsDescriptorTypeBufferView(src.descriptorType) ? numBufferViewsPerSet_++ : VKResourceHeap::invalidViewIndex);
 }
 
-void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets)
+void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets, bool updateAfterBind)
 {
     /* Accumulate descriptor pool sizes */
     VKPoolSizeAccumulator poolSizeAccum;
@@ -240,7 +265,11 @@ void VKResourceHeap::CreateDescriptorPool(VkDevice device, std::uint32_t numDesc
     {
         poolCreateInfo.sType            = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
         poolCreateInfo.pNext            = nullptr;
+        #if VK_EXT_descriptor_indexing
+        poolCreateInfo.flags            = (updateAfterBind ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT : 0);
+        #else
         poolCreateInfo.flags            = 0;
+        #endif
         poolCreateInfo.maxSets          = numDescriptorSets;
         poolCreateInfo.poolSizeCount    = poolSizeAccum.Size();
         poolCreateInfo.pPoolSizes       = poolSizeAccum.Data();
@@ -426,35 +455,38 @@ VkImageView VKResourceHeap::GetOrCreateImageView(
     const ResourceViewDescriptor&   desc,
     std::size_t                     imageViewIndex)
 {
+    /* Increase image view container for new entry */
+    if (imageViewIndex >= imageViews_.size())
+        imageViews_.resize(imageViewIndex + 1);
+
     if (IsTextureViewEnabled(desc.textureView))
     {
-        /* Creates a new image view for the specified subresource descriptor */
-        VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
-        textureVK.CreateImageView(device, desc.textureView, imageView);
-
-        /* Remove previous image view entry */
-        if (imageViewIndex < imageViews_.size() && imageViews_[imageViewIndex])
-            imageViews_[imageViewIndex].Release();
-
-        /* Increase image view container for new entry */
-        if (imageViewIndex >= imageViews_.size())
-            imageViews_.resize(imageViewIndex + 1);
-
-        /* Emplace new image view entry */
-        imageViews_[imageViewIndex] = std::move(imageView);
-        return imageViews_[imageViewIndex].Get();
+        /* Get shared image view from the texture's view cache; this replaces the previous image view entry */
+        imageViews_[imageViewIndex] = textureVK.GetOrCreateSharedImageView(device, desc.textureView);
+        return imageViews_[imageViewIndex]->Get();
     }
     else
     {
         /* Remove previous image view entry */
-        if (imageViewIndex < imageViews_.size() && imageViews_[imageViewIndex])
-            imageViews_[imageViewIndex].Release();
+        imageViews_[imageViewIndex].reset();
 
         /* Returns the standard image view */
         return textureVK.GetVkImageView();
     }
 }
 
+void VKResourceHeap::WaitForPendingSubmits()
+{
+    for (PendingSubmit& pending : pendingSubmits_)
+    {
+        if (pending.commandQueue != nullptr)
+        {
+            pending.commandQueue->WaitForSubmit(pending.submitID);
+            pending = PendingSubmit{};
+        }
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -17,6 +17,8 @@
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <vector>
+#include <memory>
+#include <atomic>
 
 
 namespace LLGL
@@ -27,6 +29,8 @@ class Buffer;
 class VKBuffer;
 class VKTexture;
 class VKDescriptorSetWriter;
+class VKCommandContext;
+class VKCommandQueue;
 struct ResourceHeapDescriptor;
 struct ResourceViewDescriptor;
 struct TextureViewDescriptor;
@@ -52,8 +56,20 @@ class VKResourceHeap final : public ResourceHeap
             const ArrayView<ResourceViewDescriptor>&    resourceViews
         );
 
-        // Inserts a pipeline barrier command into the command buffer if this resource heap requires it.
-        void SubmitPipelineBarrier(VkCommandBuffer commandBuffer, std::uint32_t descriptorSet);
+        // Appends the pipeline barrier of the specified descriptor set to the command context if this resource heap requires it.
+        void SubmitPipelineBarrier(VKCommandContext& context, std::uint32_t descriptorSet);
+
+        /*
+        Records that a command buffer which has bound this resource heap has been submitted to the specified queue (see VKCommandQueue::GetSubmitCount()).
+        WriteResourceViews() only waits for these submissions and only if they have not completed yet.
+        */
+        void MarkSubmitted(VKCommandQueue& commandQueue, std::uint64_t submitID);
+
+        // Returns true if the descriptor sets of this heap can be updated while they are in use by pending command buffers.
+        inline bool CanUpdateWhilePending() const
+        {
+            return canUpdateWhilePending_;
+        }
 
         // Returns the native Vulkan descritpor pool.
         inline VkDescriptorPool GetVkDescriptorPool() const
@@ -69,7 +85,7 @@ class VKResourceHeap final : public ResourceHeap
 
     private:
 
-        static constexpr std::uint32_t invalidViewIndex = 0xFFFF;
+        static constexpr std::uint32_t invalidViewIndex = 0xFFFFFFFF;
 
         //TODO: merge with or inherit from VKLayoutBinding
         struct VKDescriptorBinding
@@ -78,8 +94,8 @@ class VKResourceHeap final : public ResourceHeap
             std::uint32_t           dstArrayElement;
             VkDescriptorType        descriptorType;
             VkPipelineStageFlags    stageFlags;
-            std::uint32_t           imageViewIndex  : 16; // Index (per descriptor set) to the intermediate VkImageView or 0xFFFF if unused.
-            std::uint32_t           bufferViewIndex : 16; // Index (per descriptor set) to the intermediate VkBufferView or 0xFFFF if unused.
+            std::uint32_t           imageViewIndex;     // Index (per descriptor set) to the intermediate VkImageView or 0xFFFFFFFF if unused.
+            std::uint32_t           bufferViewIndex;    // Index (per descriptor set) to the intermediate VkBufferView or 0xFFFFFFFF if unused.
         };
 
         struct VKDescriptorBarrierWriter
@@ -92,7 +108,7 @@ class VKResourceHeap final : public ResourceHeap
         void ConvertLayoutBindings(const ArrayView<VKLayoutBinding>& layoutBindings);
         void ConvertLayoutBinding(VKDescriptorBinding& dst, const VKLayoutBinding& src);
 
-        void CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets);
+        void CreateDescriptorPool(VkDevice device, std::uint32_t numDescriptorSets, bool updateAfterBind);
 
         void CreateDescriptorSets(
             VkDevice                device,
@@ -136,19 +152,37 @@ class VKResourceHeap final : public ResourceHeap
             std::size_t                     imageViewIndex
         );
 
+        // Waits for all pending submissions that use this resource heap.
+        void WaitForPendingSubmits();
+
+    private:
+
+        // Last submission of this resource heap on a single command queue.
+        struct PendingSubmit
+        {
+            VKCommandQueue* commandQueue    = nullptr;
+            std::uint64_t   submitID        = 0;
+        };
+
+        // Maximum number of command queues: graphics, compute, and copy queue.
+        static constexpr std::size_t        maxNumPendingSubmits    = 3;
+
     private:
 
         VKPtr<VkDescriptorPool>             descriptorPool_;
         std::vector<VkDescriptorSet>        descriptorSets_;
         SmallVector<VKDescriptorBinding>    bindings_;
 
-        std::vector<VKPtr<VkImageView>>     imageViews_;
+        std::vector<std::shared_ptr<VKPtr<VkImageView>>> imageViews_;
       //std::vector<VKPtr<VkBufferView>>    bufferViews_;
         std::uint32_t                       numImageViewsPerSet_    = 0;
         std::uint32_t                       numBufferViewsPerSet_   = 0;
 
         std::vector<VKPipelineBarrierPtr>   barriers_;
 
+        bool                                canUpdateWhilePending_  = false;
+        PendingSubmit                       pendingSubmits_[maxNumPendingSubmits];
+
 };
 
 
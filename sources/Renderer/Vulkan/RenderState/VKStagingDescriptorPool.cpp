@@ -7,6 +7,7 @@
 
 #include "VKStagingDescriptorPool.h"
 #include "../VKCore.h"
+#include "../../ProfileCounters.h"
 #include "../../../Core/Assertion.h"
 #include <LLGL/Utils/ForRange.h>
 #include <string.h>
@@ -122,6 +123,7 @@ VkDescriptorSet VKStagingDescriptorPool::AllocateDescriptorSet(
     VkDescriptorSet descriptorSet;
     VkResult result = vkAllocateDescriptorSets(device_, &allocInfo, &descriptorSet);
     VKThrowIfFailed(result, "failed to allocate Vulkan descriptor sets");
+    LLGL_PROFILE_COUNTER_ADD(descriptorSetAllocations, 1);
     return descriptorSet;
 }
 
@@ -14,6 +14,8 @@
 #include "../../../Core/StringUtils.h"
 #include "../../../Core/ReportUtils.h"
 #include "../../../Core/Assertion.h"
+#include "../../../Core/HashUtils.h"
+#include "../../../Platform/MappedFile.h"
 #include "../../PipelineStateUtils.h"
 #include <LLGL/Utils/TypeNames.h>
 #include <LLGL/Utils/ForRange.h>
@@ -47,12 +49,12 @@ static VKPtr<VkShaderModule> CreateVkShaderModule(VkDevice device, const std::ve
 }
 
 VKShader::VKShader(VkDevice device, const ShaderDescriptor& desc) :
-    Shader  { desc.type },
+    Shader  { desc      },
     device_ { device    }
 {
     BuildShader(desc);
     BuildInputLayout(desc.vertex.inputAttribs.size(), desc.vertex.inputAttribs.data());
-    BuildBindingLayout();
+    BuildModuleInfo();
     BuildReport();
 }
 
@@ -124,10 +126,10 @@ bool VKShader::NeedsShaderModulePermutation(const PermutationBindingFunc& permut
     return false;
 }
 
-VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc)
+bool VKShader::CreateShaderCodePermutation(const PermutationBindingFunc& permutationBindingFunc, VKShaderCode& outShaderCode) const
 {
     if (!permutationBindingFunc)
-        return VK_NULL_HANDLE;
+        return false;
 
     /* Re-assign binding slots with a permutation of the binding layout */
     VKShaderBindingLayout bindingLayoutPerm = bindingLayout_;
@@ -142,15 +144,20 @@ VKPtr<VkShaderModule> VKShader::CreateVkShaderModulePermutation(const Permutatio
             modified = true;
     }
 
-    /* Create shader module permuation if there is at least one modified binding slot */
+    /* Patch SPIR-V code of permuation if there is at least one modified binding slot */
     if (modified)
     {
-        VKShaderCode shaderCodePerm = shaderCode_;
-        bindingLayoutPerm.UpdateSpirvModule(shaderCodePerm.data(), shaderCodePerm.size() * sizeof(std::uint32_t));
-        return CreateVkShaderModule(device_, shaderCodePerm);
+        outShaderCode = shaderCode_;
+        bindingLayoutPerm.UpdateSpirvModule(outShaderCode.data(), outShaderCode.size() * sizeof(std::uint32_t));
+        return true;
     }
 
-    return VK_NULL_HANDLE;
+    return false;
+}
+
+VKPtr<VkShaderModule> VKShader::CreateVkShaderModuleFromCode(const VKShaderCode& shaderCode) const
+{
+    return CreateVkShaderModule(device_, shaderCode);
 }
 
 static const char* GetOptString(const char* s)
@@ -168,6 +175,8 @@ static long ShaderTypeToStageFlags(const ShaderType type)
         case ShaderType::Geometry:          return StageFlags::GeometryStage;
         case ShaderType::Fragment:          return StageFlags::FragmentStage;
         case ShaderType::Compute:           return StageFlags::ComputeStage;
+        case ShaderType::Task:              return StageFlags::TaskStage;
+        case ShaderType::Mesh:              return StageFlags::MeshStage;
         default:                            return 0;
     }
 }
@@ -415,6 +424,9 @@ static UniformType ReflectUniformType(const SpirvReflect::SpvType* type)
 
 bool VKShader::Reflect(ShaderReflection& reflection) const
 {
+    if (GetSerializedReflection(reflection))
+        return true;
+
     /* Parse shader module */
     SpirvReflect spvReflect;
     if (spvReflect.Reflect(SpirvModuleView{ shaderCode_ }) != SpirvResult::NoError)
@@ -496,14 +508,11 @@ bool VKShader::Reflect(ShaderReflection& reflection) const
 
 bool VKShader::ReflectLocalSize(Extent3D& outLocalSize) const
 {
-    if (GetType() != ShaderType::Compute)
+    if (GetType() != ShaderType::Compute || !hasModuleInfo_)
         return false;
 
-    /* Parse shader module for execution mode */
-    SpirvReflect::SpvExecutionMode executionMode;
-    SpirvReflectExecutionMode(SpirvModuleView{ shaderCode_ }, executionMode);
-
-    /* Return local work group size */
+    /* Return local work group size from cached execution mode */
+    const SpirvReflect::SpvExecutionMode& executionMode = moduleInfo_.executionMode;
     outLocalSize.width  = executionMode.localSizeX;
     outLocalSize.height = executionMode.localSizeY;
     outLocalSize.depth  = executionMode.localSizeZ;
@@ -518,13 +527,11 @@ bool VKShader::ReflectPushConstants(
     /* Initialize output container with zero-ranges */
     outUniformRanges.resize(inUniformDescs.size());
 
-    /* Parse shader module for push-constants */
-    SpirvReflect::SpvBlock block;
-    SpirvResult result = SpirvReflectPushConstants(SpirvModuleView{ shaderCode_ }, block);
-    if (result != SpirvResult::NoError)
+    if (!hasModuleInfo_)
         return false;
 
-    /* Build push constant ranges */
+    /* Build push constant ranges from cached push-constant block */
+    const SpirvReflect::SpvBlock& block = moduleInfo_.pushConstants;
     for_range(i, inUniformDescs.size())
     {
         /* Find name of uniform descriptor in push-constant block fields */
@@ -548,9 +555,9 @@ bool VKShader::ReflectPushConstants(
 
 #else // LLGL_VK_ENABLE_SPIRV_REFLECT
 
-bool VKShader::Reflect(ShaderReflection& /*reflection*/) const
+bool VKShader::Reflect(ShaderReflection& reflection) const
 {
-    return false; // dummy
+    return GetSerializedReflection(reflection);
 }
 
 bool VKShader::ReflectLocalSize(Extent3D& /*outLocalSize*/) const
@@ -632,9 +639,16 @@ void VKShader::BuildInputLayout(std::size_t numVertexAttribs, const VertexAttrib
     inputLayout_.bindingDescs.insert(inputLayout_.bindingDescs.end(), bindingDescSet.begin(), bindingDescSet.end());
 }
 
-void VKShader::BuildBindingLayout()
+void VKShader::BuildModuleInfo()
 {
-    bindingLayout_.BuildFromSpirvModule(shaderCode_.data(), shaderCode_.size() * sizeof(std::uint32_t));
+    #if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+    /* Reflect SPIR-V module once, so pipeline layouts and PSOs only query the cached record */
+    hasModuleInfo_ = (SpirvReflectModuleInfo(SpirvModuleView{ shaderCode_ }, moduleInfo_) == SpirvResult::NoError);
+    if (hasModuleInfo_)
+        bindingLayout_.BuildFromModuleInfo(moduleInfo_);
+
+    #endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
 }
 
 void VKShader::BuildReport()
@@ -663,16 +677,19 @@ bool VKShader::CompileSource(const ShaderDescriptor& shaderDesc)
 bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
 {
     /* Get shader binary */
-    std::vector<char>   fileContent;
-    const char*         binaryBuffer = nullptr;
-    std::size_t         binaryLength = 0;
+    std::unique_ptr<MappedFile> mappedFile;
+    const char*                 binaryBuffer = nullptr;
+    std::size_t                 binaryLength = 0;
 
     if (shaderDesc.sourceType == ShaderSourceType::BinaryFile)
     {
-        /* Load binary from file */
-        fileContent = ReadFileBuffer(shaderDesc.source);
-        binaryBuffer = fileContent.data();
-        binaryLength = fileContent.size();
+        /* Map binary file into memory; it is copied into the shader code container below */
+        mappedFile = MappedFile::Open(shaderDesc.source);
+        if (mappedFile)
+        {
+            binaryBuffer = static_cast<const char*>(mappedFile->GetData());
+            binaryLength = mappedFile->GetSize();
+        }
     }
     else
     {
@@ -702,6 +719,7 @@ bool VKShader::LoadBinary(const ShaderDescriptor& shaderDesc)
 
     /* Create shader module */
     shaderModule_ = CreateVkShaderModule(device_, shaderCode_);
+    contentHash_ = GetHash(shaderCode_.data(), shaderCode_.size() * sizeof(std::uint32_t));
 
     loadBinaryResult_ = LoadBinaryResult::Successful;
 
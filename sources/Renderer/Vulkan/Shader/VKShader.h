@@ -67,16 +67,19 @@ class VKShader final : public Shader
 
         /*
         Returns true if a shader permutation is needed for the specified binding functor.
-        Call this before 'CreateVkShaderModulePermutation' to determine whether a permutation is necessary.
+        Call this before 'CreateShaderCodePermutation' to determine whether a permutation is necessary.
         */
         bool NeedsShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc) const;
 
         /*
-        Creates a shader module permutation with re-assigned binding slots using the specified function callback.
+        Creates the SPIR-V code of a shader module permutation with re-assigned binding slots using the specified function callback.
         Re-assigned descriptor sets for [0, N) invocations of the callback until 'permutationBindingFunc' returns false.
-        Returns VK_NULL_HANDLE if no permutation was created. Should only be used by VKPipelineLayout.
+        Returns false if no binding slot was modified and no permutation is needed. Should only be used by VKPipelineLayout.
         */
-        VKPtr<VkShaderModule> CreateVkShaderModulePermutation(const PermutationBindingFunc& permutationBindingFunc);
+        bool CreateShaderCodePermutation(const PermutationBindingFunc& permutationBindingFunc, VKShaderCode& outShaderCode) const;
+
+        // Creates a new shader module for the specified SPIR-V code, e.g. a permutation of this shader's code.
+        VKPtr<VkShaderModule> CreateVkShaderModuleFromCode(const VKShaderCode& shaderCode) const;
 
         // Returns the Vulkan shader module.
         inline const VKPtr<VkShaderModule>& GetShaderModule() const
@@ -84,6 +87,12 @@ class VKShader final : public Shader
             return shaderModule_;
         }
 
+        // Returns the hash of this shader's SPIR-V code. This hash is stable across runs and used to address shader module permutations.
+        inline std::uint64_t GetContentHash() const
+        {
+            return contentHash_;
+        }
+
     private:
 
         // Note: "Success" is a reserved macro by X11 lib.
@@ -99,7 +108,7 @@ class VKShader final : public Shader
 
         bool BuildShader(const ShaderDescriptor& shaderDesc);
         void BuildInputLayout(std::size_t numVertexAttribs, const VertexAttribute* vertexAttribs);
-        void BuildBindingLayout();
+        void BuildModuleInfo();
         void BuildReport();
 
         bool CompileSource(const ShaderDescriptor& shaderDesc);
@@ -119,8 +128,14 @@ class VKShader final : public Shader
 
         VKPtr<VkShaderModule>   shaderModule_;
         VKShaderCode            shaderCode_;
+        std::uint64_t           contentHash_        = 0;
         VKShaderBindingLayout   bindingLayout_;
 
+        #if LLGL_VK_ENABLE_SPIRV_REFLECT
+        SpirvReflect::SpvModuleInfo moduleInfo_;                // Reflection record of the SPIR-V module; names refer to 'shaderCode_'.
+        bool                        hasModuleInfo_  = false;
+        #endif
+
         LoadBinaryResult        loadBinaryResult_   = LoadBinaryResult::Undefined;
         VertexInputLayout       inputLayout_;
 
@@ -12,28 +12,17 @@
 #include <LLGL/Utils/ForRange.h>
 #include <algorithm>
 
-#if LLGL_VK_ENABLE_SPIRV_REFLECT
-#   include "../../SPIRV/SpirvReflect.h"
-#   include "../../SPIRV/SpirvModule.h"
-#endif
-
 
 namespace LLGL
 {
 
 
-bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t size)
-{
-    #if LLGL_VK_ENABLE_SPIRV_REFLECT
-
-    /* Reflect all SPIR-V binding points */
-    std::vector<SpirvReflect::SpvBindingPoint> bindingPoints;
-    SpirvResult result = SpirvReflectBindingPoints(SpirvModuleView{ data, size }, bindingPoints);
-    if (result != SpirvResult::NoError)
-        return false;
+#if LLGL_VK_ENABLE_SPIRV_REFLECT
 
+void VKShaderBindingLayout::BuildFromModuleInfo(const SpirvReflect::SpvModuleInfo& moduleInfo)
+{
     /* Convert binding points into to module bindings */
-    bindings_.resize(bindingPoints.size());
+    bindings_.resize(moduleInfo.bindingPoints.size());
 
     auto ConvertBindingPoint = [](ModuleBinding& dst, const SpirvReflect::SpvBindingPoint& src)
     {
@@ -45,8 +34,8 @@ bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t s
         dst.spirvBinding        = src.bindingWordOffset;
     };
 
-    for_range(i, bindingPoints.size())
-        ConvertBindingPoint(bindings_[i], bindingPoints[i]);
+    for_range(i, moduleInfo.bindingPoints.size())
+        ConvertBindingPoint(bindings_[i], moduleInfo.bindingPoints[i]);
 
     /* Sort module bindings by descriptor set and binding points */
     std::sort(
@@ -58,17 +47,10 @@ bool VKShaderBindingLayout::BuildFromSpirvModule(const void* data, std::size_t s
             return lhs.dstBinding < rhs.dstBinding;
         }
     );
-
-    return true;
-
-    #else
-
-    /* Cannot build binding layout from SPIR-V module without capability of SPIR-V reflection */
-    return false;
-
-    #endif
 }
 
+#endif // /LLGL_VK_ENABLE_SPIRV_REFLECT
+
 //private
 bool VKShaderBindingLayout::MatchesBindingSlot(
     const ModuleBinding&    binding,
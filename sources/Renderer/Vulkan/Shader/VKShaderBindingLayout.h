@@ -14,6 +14,10 @@
 #include <vector>
 #include <cstdint>
 
+#if LLGL_VK_ENABLE_SPIRV_REFLECT
+#   include "../../SPIRV/SpirvReflect.h"
+#endif
+
 
 namespace LLGL
 {
@@ -24,8 +28,12 @@ class VKShaderBindingLayout
 
     public:
 
-        // Builds the internal binding table from the specified SPIR-V module.
-        bool BuildFromSpirvModule(const void* data, std::size_t size);
+        #if LLGL_VK_ENABLE_SPIRV_REFLECT
+
+        // Builds the internal binding table from the binding points of the specified SPIR-V module reflection.
+        void BuildFromModuleInfo(const SpirvReflect::SpvModuleInfo& moduleInfo);
+
+        #endif
 
         // Returns true if the binding layout already matches the layout as is assigned by 'AssignBindingSlots'.
         bool MatchesBindingSlots(
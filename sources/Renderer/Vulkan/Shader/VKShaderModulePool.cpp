@@ -7,8 +7,11 @@
 
 #include "VKShaderModulePool.h"
 #include "../RenderState/VKPipelineLayout.h"
+#include "../../PipelineCacheStore.h"
 #include "../../../Core/CoreUtils.h"
 #include "../../../Core/MacroUtils.h"
+#include "../../../Core/HashUtils.h"
+#include <string.h>
 
 
 namespace LLGL
@@ -23,11 +26,22 @@ VKShaderModulePool& VKShaderModulePool::Get()
 
 void VKShaderModulePool::Clear()
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
     permutations_.clear();
+    contents_.clear();
+    pipelineCacheStore_ = nullptr;
+}
+
+void VKShaderModulePool::SetPipelineCacheStore(PipelineCacheStore* pipelineCacheStore)
+{
+    std::lock_guard<std::mutex> guard{ mutex_ };
+    pipelineCacheStore_ = pipelineCacheStore;
 }
 
 VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Try to find existing pair of shader/pipeline-layout */
     const auto* shaderPtr = &shader;
     const auto* pipelineLayoutPtr = &pipelineLayout;
@@ -47,28 +61,31 @@ VkShaderModule VKShaderModulePool::GetOrCreateVkShaderModulePermutation(VKShader
 
     if (permutation == nullptr)
     {
-        /* Create new shader module permutation */
-        VKPtr<VkShaderModule> shaderModule = pipelineLayout.CreateVkShaderModulePermutation(shader);
-        VkShaderModule nativeHandle = shaderModule.Get();
+        /* Share shader module with other objects of equal content or create a new one */
+        SharedShaderModule shaderModule = GetOrCreateSharedShaderModule(shader, pipelineLayout);
+        if (!shaderModule)
+            return VK_NULL_HANDLE;
 
-        if (nativeHandle != VK_NULL_HANDLE)
+        VkShaderModule nativeHandle = shaderModule->Get();
+
+        ShaderModulePermutation newPermutation;
         {
-            ShaderModulePermutation newPermutation;
-            {
-                newPermutation.pipelineLayout   = pipelineLayoutPtr;
-                newPermutation.shader           = shaderPtr;
-                newPermutation.shaderModule     = std::move(shaderModule);
-            }
-            permutations_.insert(permutations_.begin() + insertionPos, std::move(newPermutation));
+            newPermutation.pipelineLayout   = pipelineLayoutPtr;
+            newPermutation.shader           = shaderPtr;
+            newPermutation.shaderModule     = std::move(shaderModule);
         }
+        permutations_.insert(permutations_.begin() + insertionPos, std::move(newPermutation));
+
         return nativeHandle;
     }
 
-    return permutation->shaderModule.Get();
+    return permutation->shaderModule->Get();
 }
 
 void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Since shader is the second key, we have to iterate over the entire list */
     RemoveAllFromListIf(
         permutations_,
@@ -77,10 +94,14 @@ void VKShaderModulePool::NotifyReleaseShader(VKShader* shader)
             return (entry.shader == shader);
         }
     );
+
+    PurgeExpiredContents();
 }
 
 void VKShaderModulePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineLayout)
 {
+    std::lock_guard<std::mutex> guard{ mutex_ };
+
     /* Since pipeline layout is the first key, we can search for the first occurance and then delete all consecutive entries that match the key */
     RemoveAllConsecutiveFromListIf(
         permutations_,
@@ -89,6 +110,110 @@ void VKShaderModulePool::NotifyReleasePipelineLayout(VKPipelineLayout* pipelineL
             return (entry.pipelineLayout == pipelineLayout);
         }
     );
+
+    PurgeExpiredContents();
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+// Returns the key for the persistent pipeline cache store of a shader module permutation. This must not collide with keys of VkPipelineCache blobs.
+static std::uint64_t GetShaderModulePermutationCacheStoreKey(std::uint64_t shaderHash, std::uint64_t layoutSignature)
+{
+    std::uint64_t seed = g_hashSeed;
+    HashString(seed, "VKShaderModulePermutation");
+    HashValue(seed, shaderHash);
+    HashValue(seed, layoutSignature);
+    return seed;
+}
+
+// Returns true if the specified blob can be used as SPIR-V code, i.e. it is word aligned and starts with the SPIR-V magic number.
+static bool IsSpirvBlob(const Blob& blob)
+{
+    static constexpr std::uint32_t spirvMagicNumber = 0x07230203u;
+    if (blob.GetSize() < sizeof(std::uint32_t) || blob.GetSize() % sizeof(std::uint32_t) != 0)
+        return false;
+    std::uint32_t magic = 0;
+    ::memcpy(&magic, blob.GetData(), sizeof(magic));
+    return (magic == spirvMagicNumber);
+}
+
+VKShaderModulePool::SharedShaderModule VKShaderModulePool::GetOrCreateSharedShaderModule(VKShader& shader, const VKPipelineLayout& pipelineLayout)
+{
+    const std::uint64_t layoutSignature = pipelineLayout.GetPermutationSignature();
+    const std::uint64_t shaderHash      = shader.GetContentHash();
+
+    /* Try to find shader module with equal content */
+    std::size_t insertionPos = 0;
+    auto* content = FindInSortedArray<ShaderModuleContent>(
+        contents_.data(),
+        contents_.size(),
+        [layoutSignature, shaderHash](const ShaderModuleContent& entry) -> int
+        {
+            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(layoutSignature, entry.layoutSignature);
+            LLGL_COMPARE_SEPARATE_MEMBERS_SWO(shaderHash, entry.shaderHash);
+            return 0;
+        },
+        &insertionPos
+    );
+
+    if (content != nullptr)
+    {
+        if (SharedShaderModule shaderModule = content->shaderModule.lock())
+            return shaderModule;
+    }
+
+    /* Load patched SPIR-V code from persistent store or patch it now */
+    VKShaderCode shaderCodePerm;
+    const std::uint64_t key = GetShaderModulePermutationCacheStoreKey(shaderHash, layoutSignature);
+
+    Blob cachedCode;
+    if (pipelineCacheStore_ != nullptr)
+        cachedCode = pipelineCacheStore_->Read(key);
+
+    if (IsSpirvBlob(cachedCode))
+    {
+        const std::uint32_t* words = reinterpret_cast<const std::uint32_t*>(cachedCode.GetData());
+        shaderCodePerm.assign(words, words + cachedCode.GetSize() / sizeof(std::uint32_t));
+    }
+    else
+    {
+        if (!pipelineLayout.CreateShaderCodePermutation(shader, shaderCodePerm))
+            return nullptr;
+        if (pipelineCacheStore_ != nullptr)
+            pipelineCacheStore_->Write(key, shaderCodePerm.data(), shaderCodePerm.size() * sizeof(std::uint32_t));
+    }
+
+    /* Create new shader module permutation and register it with its content */
+    SharedShaderModule shaderModule = std::make_shared<VKPtr<VkShaderModule>>(shader.CreateVkShaderModuleFromCode(shaderCodePerm));
+
+    if (content != nullptr)
+        content->shaderModule = shaderModule;
+    else
+    {
+        ShaderModuleContent newContent;
+        {
+            newContent.layoutSignature  = layoutSignature;
+            newContent.shaderHash       = shaderHash;
+            newContent.shaderModule     = shaderModule;
+        }
+        contents_.insert(contents_.begin() + insertionPos, std::move(newContent));
+    }
+
+    return shaderModule;
+}
+
+void VKShaderModulePool::PurgeExpiredContents()
+{
+    RemoveAllFromListIf(
+        contents_,
+        [](const ShaderModuleContent& entry) -> bool
+        {
+            return entry.shaderModule.expired();
+        }
+    );
 }
 
 
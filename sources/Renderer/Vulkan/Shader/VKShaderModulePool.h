@@ -12,6 +12,9 @@
 #include "../Vulkan.h"
 #include "../VKPtr.h"
 #include <vector>
+#include <memory>
+#include <mutex>
+#include <cstdint>
 
 
 namespace LLGL
@@ -20,8 +23,13 @@ namespace LLGL
 
 class VKShader;
 class VKPipelineLayout;
+class PipelineCacheStore;
 
-// Singleton pool for Vulkan shader/pipeline-layout permutations.
+/*
+Singleton pool for Vulkan shader/pipeline-layout permutations. Thread-safe, since PSOs can be compiled asynchronously.
+Permutations are content-addressed by the shader's SPIR-V hash and the pipeline layout's permutation signature,
+so equal shaders and layouts share their shader modules. If a pipeline cache store is bound, the patched SPIR-V code is persisted across runs.
+*/
 class VKShaderModulePool
 {
 
@@ -36,7 +44,10 @@ class VKShaderModulePool
         // Clear all resource containers of this pool (used by VKRenderSystem).
         void Clear();
 
-        /* ----- Depth-stencil states ----- */
+        // Binds the persistent store for patched SPIR-V code. Null disables persistence (used by VKRenderSystem).
+        void SetPipelineCacheStore(PipelineCacheStore* pipelineCacheStore);
+
+        /* ----- Shader module permutations ----- */
 
         VkShaderModule GetOrCreateVkShaderModulePermutation(VKShader& shader, const VKPipelineLayout& pipelineLayout);
 
@@ -45,20 +56,39 @@ class VKShaderModulePool
 
     private:
 
+        using SharedShaderModule = std::shared_ptr<VKPtr<VkShaderModule>>;
+
+        // Lookup entry for a pair of shader/pipeline-layout objects.
         struct ShaderModulePermutation
         {
             const VKPipelineLayout* pipelineLayout  = nullptr;
             const VKShader*         shader          = nullptr;
-            VKPtr<VkShaderModule>   shaderModule;
+            SharedShaderModule      shaderModule;
+        };
+
+        // Content-addressed entry that is shared between all objects with equal content.
+        struct ShaderModuleContent
+        {
+            std::uint64_t                           layoutSignature = 0;
+            std::uint64_t                           shaderHash      = 0;
+            std::weak_ptr<VKPtr<VkShaderModule>>    shaderModule;
         };
 
     private:
 
         VKShaderModulePool() = default;
 
+        SharedShaderModule GetOrCreateSharedShaderModule(VKShader& shader, const VKPipelineLayout& pipelineLayout);
+
+        // Removes all content-addressed entries whose shader modules have been released.
+        void PurgeExpiredContents();
+
     private:
 
-        std::vector<ShaderModulePermutation> permutations_;
+        std::vector<ShaderModulePermutation>    permutations_;
+        std::vector<ShaderModuleContent>        contents_;
+        PipelineCacheStore*                     pipelineCacheStore_ = nullptr;
+        std::mutex                              mutex_;
 
 };
 
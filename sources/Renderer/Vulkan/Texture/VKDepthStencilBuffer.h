@@ -23,6 +23,10 @@ class VKDepthStencilBuffer final : private VKRenderBuffer
 
         VKDepthStencilBuffer(VkDevice device);
 
+        // Explicit default move constructors required for GCC (to be used in VKSwapChain::RetiredSwapChain)
+        VKDepthStencilBuffer(VKDepthStencilBuffer&&) = default;
+        VKDepthStencilBuffer& operator = (VKDepthStencilBuffer&&) = default;
+
         void Create(
             VKDeviceMemoryManager&  deviceMemoryMngr,
             const Extent2D&         extent,
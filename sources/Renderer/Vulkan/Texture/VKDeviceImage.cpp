@@ -8,8 +8,10 @@
 #include "VKDeviceImage.h"
 #include "../Memory/VKDeviceMemory.h"
 #include "../Memory/VKDeviceMemoryManager.h"
+#include "../Memory/VKExternalMemory.h"
 #include "../Command/VKCommandContext.h"
 #include "../VKCore.h"
+#include "../../../Core/CoreUtils.h"
 #include "../../../Core/Exception.h"
 #include "../../../Core/PrintfUtils.h"
 
@@ -40,19 +42,28 @@ VKDeviceImage& VKDeviceImage::operator = (VKDeviceImage&& rhs)
     return *this;
 }
 
-void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr)
+void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool isTransient)
 {
     VkDevice device = deviceMemoryMngr.GetVkDevice();
 
     /* Get memory requirements for the image */
     vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
 
+    /* Tile-based GPUs can keep transient attachments in tile memory without committing device memory */
+    VkMemoryPropertyFlags memoryProperties = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    if (isTransient)
+    {
+        constexpr VkMemoryPropertyFlags lazyMemoryProperties = (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT);
+        if (deviceMemoryMngr.HasMemoryType(memoryRequirements_.memoryTypeBits, lazyMemoryProperties))
+            memoryProperties = lazyMemoryProperties;
+    }
+
     /* Allocate device memory */
     memoryRegion_ = deviceMemoryMngr.Allocate(
         memoryRequirements_.size,
         memoryRequirements_.alignment,
         memoryRequirements_.memoryTypeBits,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        memoryProperties
     );
 
     /* Bind image to device memory region */
@@ -67,6 +78,30 @@ void VKDeviceImage::AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr
     memoryRegion_->BindImage(device, image_);
 }
 
+std::unique_ptr<VKExternalMemory> VKDeviceImage::AllocateExternalMemory(VKDeviceMemoryManager& deviceMemoryMngr, const SharedResourceHandle* importHandle)
+{
+    VkDevice device = deviceMemoryMngr.GetVkDevice();
+
+    /* Get memory requirements for the image */
+    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
+
+    /* Allocate or import dedicated device memory; shared memory is never sub-allocated since the whole allocation is exported */
+    auto externalMemory = MakeUnique<VKExternalMemory>(
+        device,
+        memoryRequirements_.size,
+        deviceMemoryMngr.FindMemoryType(memoryRequirements_.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT),
+        image_.Get(),
+        VK_NULL_HANDLE,
+        importHandle
+    );
+
+    /* Bind image to the beginning of the dedicated device memory */
+    VkResult result = vkBindImageMemory(device, image_, externalMemory->GetVkDeviceMemory(), 0);
+    VKThrowIfFailed(result, "failed to bind Vulkan image to shared device memory");
+
+    return externalMemory;
+}
+
 void VKDeviceImage::ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr)
 {
     deviceMemoryMngr.Release(memoryRegion_);
@@ -82,6 +117,34 @@ void VKDeviceImage::BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memo
     }
 }
 
+void VKDeviceImage::BindSharedMemoryRegion(VkDevice device, VKDeviceMemoryRegion* sharedMemoryRegion, VkDeviceSize offset)
+{
+    /* Get memory requirements for the image */
+    vkGetImageMemoryRequirements(device, image_, &memoryRequirements_);
+
+    /* Validate image fits into the shared region at the specified offset */
+    const VkDeviceSize absoluteOffset = sharedMemoryRegion->GetOffset() + offset;
+    if (memoryRequirements_.alignment > 0 && absoluteOffset % memoryRequirements_.alignment != 0)
+    {
+        LLGL_TRAP(
+            "cannot bind Vulkan image to shared device memory at offset 0x%016" PRIX64 " with required alignment 0x%016" PRIX64,
+            absoluteOffset, memoryRequirements_.alignment
+        );
+    }
+    if (offset + memoryRequirements_.size > sharedMemoryRegion->GetSize())
+    {
+        LLGL_TRAP(
+            "cannot bind Vulkan image of 0x%016" PRIX64 " bytes to shared device memory at offset 0x%016" PRIX64 " exceeding region size of 0x%016" PRIX64 " bytes",
+            memoryRequirements_.size, offset, sharedMemoryRegion->GetSize()
+        );
+    }
+    if ((memoryRequirements_.memoryTypeBits & (1u << sharedMemoryRegion->GetMemoryTypeIndex())) == 0)
+        LLGL_TRAP("cannot bind Vulkan image to shared device memory of incompatible memory type %u", sharedMemoryRegion->GetMemoryTypeIndex());
+
+    /* Bind image without taking ownership of the shared region */
+    sharedMemoryRegion->BindImage(device, GetVkImage(), offset);
+}
+
 void VKDeviceImage::CreateVkImage(
     VkDevice                device,
     VkImageType             imageType,
@@ -91,13 +154,27 @@ void VKDeviceImage::CreateVkImage(
     std::uint32_t           numArrayLayers,
     VkImageCreateFlags      createFlags,
     VkSampleCountFlagBits   sampleCountBits,
-    VkImageUsageFlags       usageFlags)
+    VkImageUsageFlags       usageFlags,
+    std::uint32_t           numSharedQueueFamilies,
+    const std::uint32_t*    sharedQueueFamilies,
+    bool                    isExternal)
 {
+    /* Images must be shared concurrently if they can be accessed by dedicated compute or transfer queues */
+    const bool isConcurrent = (numSharedQueueFamilies > 1);
+
+    /* Images whose memory is exported or imported must declare their external handle type */
+    VkExternalMemoryImageCreateInfo externalInfo;
+    {
+        externalInfo.sType          = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO;
+        externalInfo.pNext          = nullptr;
+        externalInfo.handleTypes    = VKExternalMemory::GetVkHandleType();
+    }
+
     /* Create image object */
     VkImageCreateInfo createInfo;
     {
         createInfo.sType                    = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
-        createInfo.pNext                    = nullptr;
+        createInfo.pNext                    = (isExternal ? &externalInfo : nullptr);
         createInfo.flags                    = createFlags;
         createInfo.imageType                = imageType;
         createInfo.format                   = format;
@@ -107,9 +184,9 @@ void VKDeviceImage::CreateVkImage(
         createInfo.samples                  = sampleCountBits;
         createInfo.tiling                   = VK_IMAGE_TILING_OPTIMAL;
         createInfo.usage                    = usageFlags;
-        createInfo.sharingMode              = VK_SHARING_MODE_EXCLUSIVE; // only used by graphics queue
-        createInfo.queueFamilyIndexCount    = 0;
-        createInfo.pQueueFamilyIndices      = nullptr;
+        createInfo.sharingMode              = (isConcurrent ? VK_SHARING_MODE_CONCURRENT : VK_SHARING_MODE_EXCLUSIVE);
+        createInfo.queueFamilyIndexCount    = (isConcurrent ? numSharedQueueFamilies : 0);
+        createInfo.pQueueFamilyIndices      = (isConcurrent ? sharedQueueFamilies : nullptr);
         createInfo.initialLayout            = VK_IMAGE_LAYOUT_UNDEFINED; // must be UNDEFINED or PREINITIALIZED
     }
     VkResult result = vkCreateImage(device, &createInfo, nullptr, image_.ReleaseAndGetAddressOf());
@@ -169,6 +246,15 @@ VkImageLayout VKDeviceImage::TransitionImageLayout(
     return (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED ? layout_ : oldLayout);
 }
 
+void VKDeviceImage::DiscardContent(
+    VKCommandContext&           context,
+    VkFormat                    format,
+    const TextureSubresource&   subresource)
+{
+    if (layout_ != VK_IMAGE_LAYOUT_UNDEFINED)
+        context.ImageMemoryBarrier(image_, format, VK_IMAGE_LAYOUT_UNDEFINED, layout_, subresource);
+}
+
 
 } // /namespace LLGL
 
@@ -13,6 +13,7 @@
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
 #include <cstdint>
+#include <memory>
 
 
 namespace LLGL
@@ -20,6 +21,8 @@ namespace LLGL
 
 
 class VKDeviceMemoryRegion;
+class VKExternalMemory;
+struct SharedResourceHandle;
 class VKDeviceMemoryManager;
 class VKCommandContext;
 struct TextureSubresource;
@@ -41,11 +44,18 @@ class VKDeviceImage
         VKDeviceImage(const VKDeviceImage&) = delete;
         VKDeviceImage& operator = (const VKDeviceImage&) = delete;
 
-        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
+        // Allocates and binds a device memory region for this image. Transient images prefer lazily allocated memory if available.
+        void AllocateMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr, bool isTransient = false);
         void ReleaseMemoryRegion(VKDeviceMemoryManager& deviceMemoryMngr);
 
         void BindMemoryRegion(VkDevice device, VKDeviceMemoryRegion* memoryRegion);
 
+        // Binds this image to the specified offset within a memory region that is shared with other images. The shared region is not owned by this image.
+        void BindSharedMemoryRegion(VkDevice device, VKDeviceMemoryRegion* sharedMemoryRegion, VkDeviceSize offset);
+
+        // Allocates dedicated exportable device memory for this image, or imports it from 'importHandle' if it is non-null, and binds it to this image.
+        std::unique_ptr<VKExternalMemory> AllocateExternalMemory(VKDeviceMemoryManager& deviceMemoryMngr, const SharedResourceHandle* importHandle = nullptr);
+
         void CreateVkImage(
             VkDevice                device,
             VkImageType             imageType,
@@ -55,7 +65,10 @@ class VKDeviceImage
             std::uint32_t           numArrayLayers,
             VkImageCreateFlags      createFlags,
             VkSampleCountFlagBits   sampleCountBits,
-            VkImageUsageFlags       usageFlags
+            VkImageUsageFlags       usageFlags,
+            std::uint32_t           numSharedQueueFamilies  = 0,
+            const std::uint32_t*    sharedQueueFamilies     = nullptr,
+            bool                    isExternal              = false
         );
 
         void ReleaseVkImage();
@@ -76,6 +89,13 @@ class VKDeviceImage
             const TextureSubresource&   subresource
         );
 
+        // Discards the content of this image by transitioning it from VK_IMAGE_LAYOUT_UNDEFINED back into its current layout, e.g. after its memory has been aliased.
+        void DiscardContent(
+            VKCommandContext&           context,
+            VkFormat                    format,
+            const TextureSubresource&   subresource
+        );
+
         // Returns the native VkImage handle.
         inline VkImage GetVkImage() const
         {
@@ -8,9 +8,12 @@
 #include "VKRenderTarget.h"
 #include "VKTexture.h"
 #include "../Memory/VKDeviceMemoryManager.h"
+#include "../Ext/VKExtensionRegistry.h"
 #include "../../CheckedCast.h"
 #include "../../RenderTargetUtils.h"
+#include "../../RenderPassUtils.h"
 #include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
 #include "../VKCore.h"
 #include "../VKTypes.h"
 #include <vector>
@@ -25,16 +28,20 @@ namespace LLGL
 VKRenderTarget::VKRenderTarget(
     VkDevice                        device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
-    const RenderTargetDescriptor&   desc)
+    const RenderTargetDescriptor&   desc,
+    std::uint32_t                   shadingRateTexelSize)
 :
     resolution_          { desc.resolution                            },
     framebuffer_         { device, vkDestroyFramebuffer               },
     defaultRenderPass_   { device                                     },
     secondaryRenderPass_ { device                                     },
+    clearRenderPass_     { device                                     },
     depthStencilBuffer_  { device                                     },
     numColorAttachments_ { NumActiveColorAttachments(desc)            },
     sampleCountBits_     { VKTypes::ToVkSampleCountBits(desc.samples) }
 {
+    renderingAttachments_.viewMask = desc.viewMask;
+
     if (desc.renderPass)
     {
         /* Get render pass from descriptor */
@@ -46,8 +53,19 @@ VKRenderTarget::VKRenderTarget(
         CreateDefaultRenderPass(device, desc);
         renderPass_ = (&defaultRenderPass_);
     }
-    CreateSecondaryRenderPass(device, desc);
+
+    /* Secondary and clear render passes are only required to resume a render pass or fold clears into it, dynamic rendering only needs the attachments */
+    if (!HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        CreateSecondaryRenderPass(device, desc);
+        CreateClearRenderPass(device, desc);
+    }
+
     CreateFramebuffer(device, deviceMemoryMngr, desc);
+
+    /* Shading-rate attachments are only supported with dynamic rendering */
+    if (desc.shadingRateAttachment.texture != nullptr && HasExtension(VKExt::KHR_dynamic_rendering))
+        CreateShadingRateAttachment(device, desc.shadingRateAttachment, shadingRateTexelSize);
 }
 
 Extent2D VKRenderTarget::GetResolution() const
@@ -124,6 +142,25 @@ static void InitVkAttachmentDesc(
     outDesc.finalLayout         = GetFinalLayoutForAttachment(format, bindFlags);
 }
 
+static void InitRenderingAttachment(
+    VKRenderingAttachment&  outAttachment,
+    VkImage                 image,
+    VkImageView             imageView,
+    VkFormat                format,
+    long                    bindFlags,
+    std::uint32_t           mipLevel        = 0,
+    std::uint32_t           arrayLayer      = 0,
+    std::uint32_t           numArrayLayers  = 1)
+{
+    outAttachment.image             = image;
+    outAttachment.imageView         = imageView;
+    outAttachment.format            = format;
+    outAttachment.restingLayout     = GetFinalLayoutForAttachment(format, bindFlags);
+    outAttachment.mipLevel          = mipLevel;
+    outAttachment.arrayLayer        = arrayLayer;
+    outAttachment.numArrayLayers    = numArrayLayers;
+}
+
 static VkFormat GetDepthStencilVkFormat(const Format format)
 {
     if (IsDepthOrStencilFormat(format))
@@ -187,7 +224,7 @@ void VKRenderTarget::CreateRenderPass(
     }
 
     /* Create native Vulkan render pass with attachment descriptors */
-    renderPass.CreateVkRenderPassWithDescriptors(device, numTargetAttachments, numColorAttachments_, attachmentDescs, sampleCountBits_);
+    renderPass.CreateVkRenderPassWithDescriptors(device, numTargetAttachments, numColorAttachments_, attachmentDescs, sampleCountBits_, desc.viewMask);
 }
 
 void VKRenderTarget::CreateDefaultRenderPass(VkDevice device, const RenderTargetDescriptor& desc)
@@ -200,20 +237,36 @@ void VKRenderTarget::CreateSecondaryRenderPass(VkDevice device, const RenderTarg
     CreateRenderPass(device, desc, secondaryRenderPass_, VK_ATTACHMENT_LOAD_OP_LOAD);
 }
 
+void VKRenderTarget::CreateClearRenderPass(VkDevice device, const RenderTargetDescriptor& desc)
+{
+    CreateRenderPass(device, desc, clearRenderPass_, VK_ATTACHMENT_LOAD_OP_CLEAR);
+}
+
 VkImageView VKRenderTarget::CreateAttachmentImageView(
     VkDevice                    device,
     VKTexture&                  textureVK,
     Format                      format,
-    const AttachmentDescriptor& attachmentDesc)
+    const AttachmentDescriptor& attachmentDesc,
+    std::uint32_t               numArrayLayers)
 {
     /* Validate texture resolution to render target (to validate correlation between attachments) */
     ValidateMipResolution(textureVK, attachmentDesc.mipLevel);
 
     /* Create new image view for MIP-level and array layer specified in attachment descriptor */
     VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
+    if (numArrayLayers > 1)
     {
-        textureVK.CreateImageView(device, TextureSubresource{ attachmentDesc.arrayLayer, attachmentDesc.mipLevel }, format, imageView);
+        /* Multiview attachments require a 2D array view over all layers that are rendered into, also for cube textures */
+        TextureViewDescriptor viewDesc;
+        {
+            viewDesc.type           = (IsMultiSampleTexture(textureVK.GetType()) ? TextureType::Texture2DMSArray : TextureType::Texture2DArray);
+            viewDesc.format         = format;
+            viewDesc.subresource    = TextureSubresource{ attachmentDesc.arrayLayer, numArrayLayers, attachmentDesc.mipLevel, 1u };
+        }
+        textureVK.CreateImageView(device, viewDesc, imageView);
     }
+    else
+        textureVK.CreateImageView(device, TextureSubresource{ attachmentDesc.arrayLayer, attachmentDesc.mipLevel }, format, imageView);
     imageViews_.emplace_back(std::move(imageView));
 
     return imageViews_.back().Get();
@@ -249,6 +302,7 @@ void VKRenderTarget::CreateFramebuffer(
     const bool          hasDepthStencil         = IsAttachmentEnabled(desc.depthStencilAttachment);
     const std::uint32_t numTargetAttachments    = (hasDepthStencil ? numColorAttachments_ + 1 : numColorAttachments_);
     const std::uint32_t numResolveAttachments   = NumActiveResolveAttachments(desc);
+    const std::uint32_t numViewLayers           = std::max(1u, NumMultiviewLayers(desc.viewMask));
 
     imageViews_.reserve(numTargetAttachments + numResolveAttachments);
 
@@ -262,14 +316,23 @@ void VKRenderTarget::CreateFramebuffer(
             /* Use attachment texture for color buffer view */
             auto& textureVK = LLGL_CAST(VKTexture&, *texture);
             const Format colorFormat = GetAttachmentFormat(colorAttachment);
-            attachmentImageViews[i] = CreateAttachmentImageView(device, textureVK, colorFormat, colorAttachment);
+            attachmentImageViews[i] = CreateAttachmentImageView(device, textureVK, colorFormat, colorAttachment, numViewLayers);
+            InitRenderingAttachment(
+                renderingAttachments_.colorAttachments[i], textureVK.GetVkImage(), attachmentImageViews[i], VKTypes::Map(colorFormat),
+                texture->GetBindFlags(), colorAttachment.mipLevel, colorAttachment.arrayLayer, numViewLayers
+            );
         }
         else
         {
             /* Create internal color buffer */
+            LLGL_ASSERT(desc.viewMask == 0, "multiview render targets require a texture for each color attachment");
             attachmentImageViews[i] = CreateColorBuffer(deviceMemoryMngr, colorAttachment.format);
+            InitRenderingAttachment(
+                renderingAttachments_.colorAttachments[i], colorBuffers_.back()->GetVkImage(), attachmentImageViews[i], VKTypes::Map(colorAttachment.format), 0
+            );
         }
     }
+    renderingAttachments_.numColorAttachments = numColorAttachments_;
 
     /* Create depth-stencil attachment */
     if (hasDepthStencil)
@@ -280,12 +343,21 @@ void VKRenderTarget::CreateFramebuffer(
         {
             /* Use attachment texture for depth-stencil view */
             auto& textureVK = LLGL_CAST(VKTexture&, *texture);
-            attachmentImageViews[numColorAttachments_] = CreateAttachmentImageView(device, textureVK, depthStencilFormat_, depthStencilAttachment);
+            attachmentImageViews[numColorAttachments_] = CreateAttachmentImageView(device, textureVK, depthStencilFormat_, depthStencilAttachment, numViewLayers);
+            InitRenderingAttachment(
+                renderingAttachments_.depthStencilAttachment, textureVK.GetVkImage(), attachmentImageViews[numColorAttachments_],
+                GetDepthStencilVkFormat(depthStencilFormat_), texture->GetBindFlags(), depthStencilAttachment.mipLevel, depthStencilAttachment.arrayLayer, numViewLayers
+            );
         }
         else
         {
             /* Create internal depth-stencil buffer */
+            LLGL_ASSERT(desc.viewMask == 0, "multiview render targets require a texture for the depth-stencil attachment");
             attachmentImageViews[numColorAttachments_] = CreateDepthStencilBuffer(deviceMemoryMngr, depthStencilFormat_);
+            InitRenderingAttachment(
+                renderingAttachments_.depthStencilAttachment, depthStencilBuffer_.GetVkImage(), attachmentImageViews[numColorAttachments_],
+                depthStencilBuffer_.GetVkFormat(), 0
+            );
         }
     }
 
@@ -302,11 +374,20 @@ void VKRenderTarget::CreateFramebuffer(
                 /* Use attachment texture for color buffer view */
                 auto& textureVK = LLGL_CAST(VKTexture&, *texture);
                 const Format colorFormat = GetAttachmentFormat(resolveAttachment);
-                attachmentImageViews[attachmentCount++] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment);
+                attachmentImageViews[attachmentCount] = CreateAttachmentImageView(device, textureVK, colorFormat, resolveAttachment, numViewLayers);
+                InitRenderingAttachment(
+                    renderingAttachments_.resolveAttachments[i], textureVK.GetVkImage(), attachmentImageViews[attachmentCount], VKTypes::Map(colorFormat),
+                    0, resolveAttachment.mipLevel, resolveAttachment.arrayLayer, numViewLayers
+                );
+                ++attachmentCount;
             }
         }
     }
 
+    /* Dynamic rendering binds the attachments directly, so no framebuffer object is required */
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        return;
+
     /* Create framebuffer object */
     const Extent2D resolution = GetResolution();
     VkFramebufferCreateInfo createInfo;
@@ -325,6 +406,25 @@ void VKRenderTarget::CreateFramebuffer(
     VKThrowIfFailed(result, "failed to create Vulkan framebuffer");
 }
 
+void VKRenderTarget::CreateShadingRateAttachment(
+    VkDevice                        device,
+    const AttachmentDescriptor&     shadingRateAttachment,
+    std::uint32_t                   shadingRateTexelSize)
+{
+    /* Create image view without validating its resolution, since each texel covers a tile of the render target */
+    auto& textureVK = LLGL_CAST(VKTexture&, *shadingRateAttachment.texture);
+    VKPtr<VkImageView> imageView{ device, vkDestroyImageView };
+    {
+        textureVK.CreateImageView(device, TextureSubresource{ shadingRateAttachment.arrayLayer, shadingRateAttachment.mipLevel }, Format::R8UInt, imageView);
+    }
+    imageViews_.emplace_back(std::move(imageView));
+
+    renderingAttachments_.shadingRateTexture            = &textureVK;
+    renderingAttachments_.shadingRateImageView          = imageViews_.back().Get();
+    renderingAttachments_.shadingRateTexelSize.width    = shadingRateTexelSize;
+    renderingAttachments_.shadingRateTexelSize.height   = shadingRateTexelSize;
+}
+
 
 } // /namespace LLGL
 
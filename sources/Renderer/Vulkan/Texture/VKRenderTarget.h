@@ -36,7 +36,8 @@ class VKRenderTarget final : public RenderTarget
         VKRenderTarget(
             VkDevice                        device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
-            const RenderTargetDescriptor&   desc
+            const RenderTargetDescriptor&   desc,
+            std::uint32_t                   shadingRateTexelSize    = 0
         );
 
     public:
@@ -62,6 +63,18 @@ class VKRenderTarget final : public RenderTarget
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
+        // Returns the Vulkan render pass object that clears all attachments. Only used without VK_KHR_dynamic_rendering.
+        inline VkRenderPass GetClearVkRenderPass() const
+        {
+            return clearRenderPass_.GetVkRenderPass();
+        }
+
+        // Returns the attachments for dynamic rendering. Only used with VK_KHR_dynamic_rendering.
+        inline const VKRenderingAttachmentSet& GetRenderingAttachments() const
+        {
+            return renderingAttachments_;
+        }
+
         // Returns the render target resolution as VkExtent2D.
         inline VkExtent2D GetVkExtent() const
         {
@@ -79,12 +92,14 @@ class VKRenderTarget final : public RenderTarget
 
         void CreateDefaultRenderPass(VkDevice device, const RenderTargetDescriptor& desc);
         void CreateSecondaryRenderPass(VkDevice device, const RenderTargetDescriptor& desc);
+        void CreateClearRenderPass(VkDevice device, const RenderTargetDescriptor& desc);
 
         VkImageView CreateAttachmentImageView(
             VkDevice                    device,
             VKTexture&                  textureVK,
             Format                      format,
-            const AttachmentDescriptor& attachmentDesc
+            const AttachmentDescriptor& attachmentDesc,
+            std::uint32_t               numArrayLayers
         );
 
         VkImageView CreateColorBuffer(VKDeviceMemoryManager& deviceMemoryMngr, Format format);
@@ -96,6 +111,12 @@ class VKRenderTarget final : public RenderTarget
             const RenderTargetDescriptor&   desc
         );
 
+        void CreateShadingRateAttachment(
+            VkDevice                        device,
+            const AttachmentDescriptor&     shadingRateAttachment,
+            std::uint32_t                   shadingRateTexelSize
+        );
+
     private:
 
         using VKColorBufferPtr = std::unique_ptr<VKColorBuffer>;
@@ -106,8 +127,10 @@ class VKRenderTarget final : public RenderTarget
         const VKRenderPass*             renderPass_             = nullptr;
         VKRenderPass                    defaultRenderPass_;
         VKRenderPass                    secondaryRenderPass_;
+        VKRenderPass                    clearRenderPass_;       // Compatible render pass to fold clear commands into the load operations
 
         std::vector<VKPtr<VkImageView>> imageViews_;
+        VKRenderingAttachmentSet        renderingAttachments_;
 
         VKDepthStencilBuffer            depthStencilBuffer_;
         Format                          depthStencilFormat_     = Format::Undefined;    // Format either from internal depth-stencil buffer or attachmed texture.
@@ -0,0 +1,196 @@
+/*
+ * VKSparseImageMemory.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "VKSparseImageMemory.h"
+#include "../Memory/VKDeviceMemory.h"
+#include "../Memory/VKDeviceMemoryManager.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Exception.h"
+#include "../../../Core/PrintfUtils.h"
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+VKSparseImageMemory::VKSparseImageMemory(VKDeviceMemoryManager& deviceMemoryMngr, VkImage image) :
+    deviceMemoryMngr_ { deviceMemoryMngr },
+    image_            { image            }
+{
+    VkDevice device = deviceMemoryMngr.GetVkDevice();
+
+    /* Sparse images report the tile size as alignment of their memory requirements */
+    vkGetImageMemoryRequirements(device, image, &memoryRequirements_);
+
+    /* Query sparse memory requirements of the color aspect; depth-stencil images are not supported as sparse textures */
+    std::uint32_t numRequirements = 0;
+    vkGetImageSparseMemoryRequirements(device, image, &numRequirements, nullptr);
+
+    std::vector<VkSparseImageMemoryRequirements> requirements(numRequirements);
+    vkGetImageSparseMemoryRequirements(device, image, &numRequirements, requirements.data());
+
+    for (const VkSparseImageMemoryRequirements& entry : requirements)
+    {
+        if ((entry.formatProperties.aspectMask & VK_IMAGE_ASPECT_COLOR_BIT) != 0)
+        {
+            sparseRequirements_ = entry;
+            break;
+        }
+    }
+}
+
+VKSparseImageMemory::~VKSparseImageMemory()
+{
+    for (const auto& tile : tiles_)
+        deviceMemoryMngr_.Release(tile.second);
+    for (VKDeviceMemoryRegion* region : mipTailRegions_)
+        deviceMemoryMngr_.Release(region);
+}
+
+void VKSparseImageMemory::BindMipTail(std::uint32_t numMipLevels, std::uint32_t numArrayLayers, std::vector<VkSparseMemoryBind>& outBinds)
+{
+    /* Images whose MIP-maps are all larger than a single tile have no MIP tail */
+    if (sparseRequirements_.imageMipTailFirstLod >= numMipLevels || sparseRequirements_.imageMipTailSize == 0)
+        return;
+
+    /* The MIP tail is either shared by all array layers or stored once per layer */
+    const bool          isSingleMipTail = ((sparseRequirements_.formatProperties.flags & VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT) != 0);
+    const std::uint32_t numMipTails     = (isSingleMipTail ? 1u : numArrayLayers);
+
+    for_range(layer, numMipTails)
+    {
+        VKDeviceMemoryRegion* region = AllocateRegion(sparseRequirements_.imageMipTailSize);
+        mipTailRegions_.push_back(region);
+
+        VkSparseMemoryBind bind;
+        {
+            bind.resourceOffset = sparseRequirements_.imageMipTailOffset + sparseRequirements_.imageMipTailStride * layer;
+            bind.size           = sparseRequirements_.imageMipTailSize;
+            bind.memory         = region->GetParentChunk()->GetVkDeviceMemory();
+            bind.memoryOffset   = region->GetOffset();
+            bind.flags          = 0;
+        }
+        outBinds.push_back(bind);
+    }
+}
+
+// Returns the key to identify a single tile within a sparse image.
+static std::uint64_t GetSparseTileKey(std::uint32_t mipLevel, std::uint32_t arrayLayer, std::uint32_t x, std::uint32_t y, std::uint32_t z)
+{
+    return
+    (
+        (static_cast<std::uint64_t>(arrayLayer & 0x7FFF) << 49) |
+        (static_cast<std::uint64_t>(mipLevel   & 0x1F  ) << 44) |
+        (static_cast<std::uint64_t>(z          & 0xFFF ) << 32) |
+        (static_cast<std::uint64_t>(y          & 0xFFFF) << 16) |
+        (static_cast<std::uint64_t>(x          & 0xFFFF)      )
+    );
+}
+
+void VKSparseImageMemory::BindTiles(const TileMappingDescriptor& mapping, const VkExtent3D& mipExtent, std::vector<VkSparseImageMemoryBind>& outBinds)
+{
+    /* MIP-maps within the MIP tail are always resident */
+    if (mapping.mipLevel >= GetFirstMipTailLevel())
+        return;
+
+    const VkExtent3D& tileExtent = GetTileExtent();
+
+    for_subrange(z, mapping.tileOffset.z, mapping.tileOffset.z + static_cast<std::int32_t>(mapping.numTiles.depth))
+    {
+        for_subrange(y, mapping.tileOffset.y, mapping.tileOffset.y + static_cast<std::int32_t>(mapping.numTiles.height))
+        {
+            for_subrange(x, mapping.tileOffset.x, mapping.tileOffset.x + static_cast<std::int32_t>(mapping.numTiles.width))
+            {
+                /* Skip tiles outside the MIP-map; tiles at the border are clamped to the MIP-map extent */
+                const VkOffset3D offset{ static_cast<std::int32_t>(x * tileExtent.width), static_cast<std::int32_t>(y * tileExtent.height), static_cast<std::int32_t>(z * tileExtent.depth) };
+                if (x < 0 || y < 0 || z < 0 ||
+                    static_cast<std::uint32_t>(offset.x) >= mipExtent.width  ||
+                    static_cast<std::uint32_t>(offset.y) >= mipExtent.height ||
+                    static_cast<std::uint32_t>(offset.z) >= mipExtent.depth)
+                {
+                    continue;
+                }
+
+                VkSparseImageMemoryBind bind;
+                {
+                    bind.subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+                    bind.subresource.mipLevel   = mapping.mipLevel;
+                    bind.subresource.arrayLayer = mapping.arrayLayer;
+                    bind.offset                 = offset;
+                    bind.extent.width           = std::min(tileExtent.width,  mipExtent.width  - static_cast<std::uint32_t>(offset.x));
+                    bind.extent.height          = std::min(tileExtent.height, mipExtent.height - static_cast<std::uint32_t>(offset.y));
+                    bind.extent.depth           = std::min(tileExtent.depth,  mipExtent.depth  - static_cast<std::uint32_t>(offset.z));
+                    bind.memory                 = VK_NULL_HANDLE;
+                    bind.memoryOffset           = 0;
+                    bind.flags                  = 0;
+                }
+
+                const std::uint64_t key = GetSparseTileKey(mapping.mipLevel, mapping.arrayLayer, x, y, z);
+                auto it = tiles_.find(key);
+
+                if (mapping.resident)
+                {
+                    /* Allocate memory only for tiles that are not resident yet */
+                    if (it != tiles_.end())
+                        continue;
+
+                    VKDeviceMemoryRegion* region = AllocateRegion(memoryRequirements_.alignment);
+                    tiles_[key] = region;
+
+                    bind.memory         = region->GetParentChunk()->GetVkDeviceMemory();
+                    bind.memoryOffset   = region->GetOffset();
+                }
+                else
+                {
+                    /* Release memory of resident tiles and unbind them with a null memory handle */
+                    if (it == tiles_.end())
+                        continue;
+
+                    deviceMemoryMngr_.Release(it->second);
+                    tiles_.erase(it);
+                }
+
+                outBinds.push_back(bind);
+            }
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKDeviceMemoryRegion* VKSparseImageMemory::AllocateRegion(VkDeviceSize size)
+{
+    VKDeviceMemoryRegion* region = deviceMemoryMngr_.Allocate(
+        GetAlignedSize(size, memoryRequirements_.alignment),
+        memoryRequirements_.alignment,
+        memoryRequirements_.memoryTypeBits,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+    );
+
+    if (region == nullptr)
+    {
+        LLGL_TRAP(
+            "failed to allocate 0x%016" PRIX64 " bytes of device memory with alignment 0x%016" PRIX64 " for sparse Vulkan image",
+            size, memoryRequirements_.alignment
+        );
+    }
+
+    return region;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,89 @@
+/*
+ * VKSparseImageMemory.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_VK_SPARSE_IMAGE_MEMORY_H
+#define LLGL_VK_SPARSE_IMAGE_MEMORY_H
+
+
+#include <vulkan/vulkan.h>
+#include <cstdint>
+#include <vector>
+#include <map>
+
+
+namespace LLGL
+{
+
+
+class VKDeviceMemoryRegion;
+class VKDeviceMemoryManager;
+struct TileMappingDescriptor;
+
+// Manages the device memory of a sparse image, i.e. one memory region per resident tile and for the MIP tail of each array layer.
+class VKSparseImageMemory
+{
+
+    public:
+
+        // Queries the sparse memory requirements of the specified image, which must have been created with VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT.
+        VKSparseImageMemory(VKDeviceMemoryManager& deviceMemoryMngr, VkImage image);
+
+        // Releases the memory regions of all resident tiles and the MIP tail.
+        ~VKSparseImageMemory();
+
+        VKSparseImageMemory(const VKSparseImageMemory&) = delete;
+        VKSparseImageMemory& operator = (const VKSparseImageMemory&) = delete;
+
+        // Allocates the memory for the MIP tail and appends the opaque binds for it. The MIP tail is always resident.
+        void BindMipTail(std::uint32_t numMipLevels, std::uint32_t numArrayLayers, std::vector<VkSparseMemoryBind>& outBinds);
+
+        // Allocates or releases the memory for the specified range of tiles and appends the image binds for all tiles whose residency has changed.
+        void BindTiles(const TileMappingDescriptor& mapping, const VkExtent3D& mipExtent, std::vector<VkSparseImageMemoryBind>& outBinds);
+
+        // Returns the native VkImage handle this memory is bound to.
+        inline VkImage GetVkImage() const
+        {
+            return image_;
+        }
+
+        // Returns the first MIP-map level of the MIP tail.
+        inline std::uint32_t GetFirstMipTailLevel() const
+        {
+            return sparseRequirements_.imageMipTailFirstLod;
+        }
+
+        // Returns the extent (in texels) of a single tile.
+        inline const VkExtent3D& GetTileExtent() const
+        {
+            return sparseRequirements_.formatProperties.imageGranularity;
+        }
+
+    private:
+
+        // Allocates a device local memory region of the specified size with the tile alignment.
+        VKDeviceMemoryRegion* AllocateRegion(VkDeviceSize size);
+
+    private:
+
+        VKDeviceMemoryManager&                          deviceMemoryMngr_;
+        VkImage                                         image_                  = VK_NULL_HANDLE;
+        VkMemoryRequirements                            memoryRequirements_     = {};
+        VkSparseImageMemoryRequirements                 sparseRequirements_     = {};
+        std::map<std::uint64_t, VKDeviceMemoryRegion*>  tiles_;
+        std::vector<VKDeviceMemoryRegion*>              mipTailRegions_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -7,6 +7,7 @@
 
 #include "VKTexture.h"
 #include "VKImageUtils.h"
+#include "../VKDevice.h"
 #include "../Memory/VKDeviceMemory.h"
 #include "../Command/VKCommandContext.h"
 #include "../../TextureUtils.h"
@@ -31,9 +32,12 @@ static VKSwizzleFormat MapToVKSwizzleFormat(const Format format)
 }
 
 VKTexture::VKTexture(
-    VkDevice                    device,
+    const VKDevice&             device,
     VKDeviceMemoryManager&      deviceMemoryMngr,
-    const TextureDescriptor&    desc)
+    const TextureDescriptor&    desc,
+    VKDeviceMemoryRegion*       sharedMemoryRegion,
+    VkDeviceSize                sharedMemoryOffset,
+    const SharedResourceHandle* importHandle)
 :
     Texture        { desc.type, desc.bindFlags         },
     image_         { device                            },
@@ -41,9 +45,19 @@ VKTexture::VKTexture(
     format_        { VKTypes::Map(desc.format)         },
     swizzleFormat_ { MapToVKSwizzleFormat(desc.format) }
 {
-    /* Create Vulkan image and allocate memory region */
+    /*
+    Create Vulkan image and allocate memory region; sparse images are bound tile by tile via the command queue instead,
+    placed images are bound to a memory region they share with other images, and shared images get their own exportable memory.
+    */
     CreateImage(device, desc);
-    image_.AllocateMemoryRegion(deviceMemoryMngr);
+    if ((desc.miscFlags & MiscFlags::Sparse) != 0)
+        sparseMemory_ = MakeUnique<VKSparseImageMemory>(deviceMemoryMngr, GetVkImage());
+    else if ((desc.miscFlags & MiscFlags::Shared) != 0)
+        externalMemory_ = image_.AllocateExternalMemory(deviceMemoryMngr, importHandle);
+    else if (sharedMemoryRegion != nullptr)
+        image_.BindSharedMemoryRegion(device, sharedMemoryRegion, sharedMemoryOffset);
+    else
+        image_.AllocateMemoryRegion(deviceMemoryMngr, ((desc.miscFlags & MiscFlags::Transient) != 0));
 }
 
 bool VKTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
@@ -105,7 +119,7 @@ TextureDescriptor VKTexture::GetDesc() const
 
     texDesc.type        = GetType();
     texDesc.bindFlags   = GetBindFlags();
-    texDesc.miscFlags   = 0;
+    texDesc.miscFlags   = (sparseMemory_ ? MiscFlags::Sparse : 0) | (externalMemory_ ? MiscFlags::Shared : 0);
     texDesc.format      = GetFormat();
     texDesc.arrayLayers = GetNumArrayLayers();
     texDesc.mipLevels   = GetNumMipLevels();
@@ -254,6 +268,45 @@ void VKTexture::CreateImageView(
     );
 }
 
+static constexpr std::size_t g_maxNumCachedImageViews = 16;
+
+VKImageViewSPtr VKTexture::GetOrCreateSharedImageView(
+    VkDevice                        device,
+    const TextureViewDescriptor&    textureViewDesc)
+{
+    CompressedTexView view;
+    CompressTextureViewDesc(view, textureViewDesc);
+
+    auto CompareView = [&view](const VKCachedImageView& rhs) -> int
+    {
+        return CompareCompressedTexViewSWO(view, rhs.view);
+    };
+
+    /* Try to find image view with same view descriptor */
+    std::size_t insertionIndex = 0;
+    VKCachedImageView* cachedImageView = FindInSortedArray<VKCachedImageView>(imageViewCache_.data(), imageViewCache_.size(), CompareView, &insertionIndex);
+
+    if (cachedImageView != nullptr)
+    {
+        cachedImageView->lastUse = ++imageViewCacheTick_;
+        return cachedImageView->imageView;
+    }
+
+    /* Create new image view */
+    VKImageViewSPtr imageView = std::make_shared<VKPtr<VkImageView>>(device, vkDestroyImageView);
+    CreateImageView(device, textureViewDesc, *imageView);
+
+    /* Make room for the new entry and insert it with insertion sort */
+    if (imageViewCache_.size() >= g_maxNumCachedImageViews)
+    {
+        EvictLeastRecentlyUsedImageView();
+        FindInSortedArray<VKCachedImageView>(imageViewCache_.data(), imageViewCache_.size(), CompareView, &insertionIndex);
+    }
+    imageViewCache_.insert(imageViewCache_.begin() + insertionIndex, VKCachedImageView{ view, ++imageViewCacheTick_, imageView });
+
+    return imageView;
+}
+
 static bool UsageFlagsAllowImageViews(VkImageUsageFlags flags)
 {
     /* Vulkan only alows image views on images that were created with these usage flags */
@@ -320,6 +373,12 @@ VkImageLayout VKTexture::TransitionImageLayout(
     return oldLayout;
 }
 
+void VKTexture::DiscardImageContent(VKCommandContext& context)
+{
+    const TextureSubresource fullSubresource{ 0, GetNumArrayLayers(), 0, GetNumMipLevels() };
+    image_.DiscardContent(context, GetVkFormat(), fullSubresource);
+}
+
 
 /*
  * ======= Private: =======
@@ -348,6 +407,10 @@ static VkImageCreateFlags GetVkImageCreateFlags(const TextureDescriptor& desc)
             break;
     }
 
+    /* Sparse textures are created without memory and bound tile by tile */
+    if ((desc.miscFlags & MiscFlags::Sparse) != 0)
+        createFlags |= (VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT);
+
     return createFlags;
 }
 
@@ -429,6 +492,15 @@ static VkSampleCountFlagBits GetVkImageSampleCountFlags(const TextureDescriptor&
 
 static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
 {
+    /* Transient attachments must not have any other usage than color, depth-stencil, or input attachment */
+    if ((desc.miscFlags & MiscFlags::Transient) != 0)
+    {
+        if ((desc.bindFlags & BindFlags::ColorAttachment) != 0)
+            return (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+        if ((desc.bindFlags & BindFlags::DepthStencilAttachment) != 0)
+            return (VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT);
+    }
+
     VkImageUsageFlags usageFlags = VK_IMAGE_USAGE_TRANSFER_DST_BIT;
 
     /* Enable TRANSFER_SRC_BIT image usage when MIP-maps are enabled, CPU read access or copy source binding is requested */
@@ -449,6 +521,12 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     if ((desc.bindFlags & BindFlags::Storage) != 0)
         usageFlags |= VK_IMAGE_USAGE_STORAGE_BIT;
 
+    #if VK_KHR_fragment_shading_rate
+    /* Enable reading the image as shading-rate attachment */
+    if ((desc.bindFlags & BindFlags::ShadingRateAttachment) != 0)
+        usageFlags |= VK_IMAGE_USAGE_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
+    #endif
+
     #if 0//???
     /* Enable input attachment bit when used for reading AND as attachment */
     if ( (desc.bindFlags & (BindFlags::Sampled         | BindFlags::Storage               )) != 0 &&
@@ -461,7 +539,20 @@ static VkImageUsageFlags GetVkImageUsageFlags(const TextureDescriptor& desc)
     return usageFlags;
 }
 
-void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
+void VKTexture::EvictLeastRecentlyUsedImageView()
+{
+    /* Only image views that are not referenced by any resource heap can be evicted */
+    auto lruIt = imageViewCache_.end();
+    for (auto it = imageViewCache_.begin(); it != imageViewCache_.end(); ++it)
+    {
+        if (it->imageView.use_count() == 1 && (lruIt == imageViewCache_.end() || it->lastUse < lruIt->lastUse))
+            lruIt = it;
+    }
+    if (lruIt != imageViewCache_.end())
+        imageViewCache_.erase(lruIt);
+}
+
+void VKTexture::CreateImage(const VKDevice& device, const TextureDescriptor& desc)
 {
     /* Setup texture parameters */
     VkImageType imageType = GetVkImageType(desc.type);
@@ -482,8 +573,36 @@ void VKTexture::CreateImage(VkDevice device, const TextureDescriptor& desc)
         numArrayLayers_,
         GetVkImageCreateFlags(desc),
         sampleCountBits_,
-        usageFlags_
+        usageFlags_,
+        device.GetNumSharedQueueFamilies(),
+        device.GetSharedQueueFamilies(),
+        ((desc.miscFlags & MiscFlags::Shared) != 0)
+    );
+}
+
+VkMemoryRequirements VKTexture::QueryMemoryRequirements(const VKDevice& device, const TextureDescriptor& desc)
+{
+    /* Create temporary image object without memory to query its requirements */
+    const VkImageType imageType = GetVkImageType(desc.type);
+
+    VKDeviceImage image{ device };
+    image.CreateVkImage(
+        device,
+        imageType,
+        VKTypes::Map(desc.format),
+        GetVkImageExtent3D(desc, imageType),
+        NumMipLevels(desc),
+        GetVkImageArrayLayers(desc, imageType),
+        GetVkImageCreateFlags(desc),
+        GetVkImageSampleCountFlags(desc),
+        GetVkImageUsageFlags(desc),
+        device.GetNumSharedQueueFamilies(),
+        device.GetSharedQueueFamilies()
     );
+
+    VkMemoryRequirements requirements = {};
+    vkGetImageMemoryRequirements(device, image.GetVkImage(), &requirements);
+    return requirements;
 }
 
 
@@ -11,19 +11,28 @@
 
 #include <LLGL/Texture.h>
 #include "VKDeviceImage.h"
+#include "VKSparseImageMemory.h"
+#include "../Memory/VKExternalMemory.h"
 #include <vulkan/vulkan.h>
 #include "../VKPtr.h"
+#include "../../TextureUtils.h"
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 
 namespace LLGL
 {
 
 
+class VKDevice;
 class VKDeviceMemoryRegion;
 class VKDeviceMemoryManager;
 class VKCommandContext;
 
+// Shared image view; the texture's view cache and all resource heaps that refer to it keep a reference.
+using VKImageViewSPtr = std::shared_ptr<VKPtr<VkImageView>>;
+
 // Predefined texture swizzles to emulate certain texture format
 enum class VKSwizzleFormat
 {
@@ -40,10 +49,15 @@ class VKTexture final : public Texture
 
     public:
 
+        // Creates a texture with its own memory region, or places it into the shared memory region at the specified offset if 'sharedMemoryRegion' is non-null.
+        // Textures with MiscFlags::Shared get their own dedicated device memory instead, which is imported from 'importHandle' if it is non-null.
         VKTexture(
-            VkDevice                    device,
+            const VKDevice&             device,
             VKDeviceMemoryManager&      deviceMemoryMngr,
-            const TextureDescriptor&    desc
+            const TextureDescriptor&    desc,
+            VKDeviceMemoryRegion*       sharedMemoryRegion  = nullptr,
+            VkDeviceSize                sharedMemoryOffset  = 0,
+            const SharedResourceHandle* importHandle        = nullptr
         );
 
     public:
@@ -63,6 +77,15 @@ class VKTexture final : public Texture
             VKPtr<VkImageView>&             outImageView
         );
 
+        /*
+        Returns a shared image view with the specififed view descriptor from the view cache of this texture,
+        or creates a new one if no such image view has been created yet or it was evicted from the cache.
+        */
+        VKImageViewSPtr GetOrCreateSharedImageView(
+            VkDevice                        device,
+            const TextureViewDescriptor&    textureViewDesc
+        );
+
         // Creates the primary image view that is stored within this texture object.
         // If this texture was not created with a valid image view usage flag,
         // this function call has no effect and GetVkImageView() returns a null handle.
@@ -83,6 +106,12 @@ class VKTexture final : public Texture
             bool                        flushBarrier = false
         );
 
+        // Discards the content of this image after its memory has been aliased by another image, i.e. transitions it from undefined into its current layout.
+        void DiscardImageContent(VKCommandContext& context);
+
+        // Returns the memory requirements of a texture with the specified descriptor without allocating any memory for it.
+        static VkMemoryRequirements QueryMemoryRequirements(const VKDevice& device, const TextureDescriptor& desc);
+
         // Returns the Vulkan image object.
         inline VkImage GetVkImage() const
         {
@@ -137,18 +166,46 @@ class VKTexture final : public Texture
             return usageFlags_;
         }
 
-        // Returns the region of the hardware device memory.
+        // Returns the region of the hardware device memory. This is null for sparse textures and textures placed into a shared memory region.
         inline VKDeviceMemoryRegion* GetMemoryRegion() const
         {
             return image_.GetMemoryRegion();
         }
 
+        // Returns the dedicated device memory if this texture was created with MiscFlags::Shared, or null otherwise.
+        inline VKExternalMemory* GetExternalMemory() const
+        {
+            return externalMemory_.get();
+        }
+
+        // Returns the device memory of the resident tiles if this texture was created with MiscFlags::Sparse, or null otherwise.
+        inline VKSparseImageMemory* GetSparseMemory() const
+        {
+            return sparseMemory_.get();
+        }
+
+    private:
+
+        void CreateImage(const VKDevice& device, const TextureDescriptor& desc);
+
+        // Removes the least-recently-used image view from the view cache that is no longer referenced outside this texture.
+        void EvictLeastRecentlyUsedImageView();
+
     private:
 
-        void CreateImage(VkDevice device, const TextureDescriptor& desc);
+        // Cached image view entry; sorted by the compressed view descriptor.
+        struct VKCachedImageView
+        {
+            CompressedTexView   view;
+            std::uint64_t       lastUse;
+            VKImageViewSPtr     imageView;
+        };
 
     private:
 
+        // Dedicated memory of shared textures; declared before the image, so it outlives the image it is bound to
+        std::unique_ptr<VKExternalMemory> externalMemory_;
+
         VKDeviceImage           image_;
         VKPtr<VkImageView>      imageView_;
 
@@ -160,6 +217,11 @@ class VKTexture final : public Texture
         VkImageUsageFlags       usageFlags_         = 0;
         const VKSwizzleFormat   swizzleFormat_      = VKSwizzleFormat::RGBA;
 
+        std::unique_ptr<VKSparseImageMemory> sparseMemory_;
+
+        std::vector<VKCachedImageView> imageViewCache_;
+        std::uint64_t           imageViewCacheTick_ = 0;
+
 };
 
 
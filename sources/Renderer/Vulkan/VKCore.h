@@ -92,6 +92,9 @@ std::vector<VkQueueFamilyProperties> VKQueryQueueFamilyProperties(VkPhysicalDevi
 
 VKSurfaceSupportDetails VKQuerySurfaceSupport(VkPhysicalDevice device, VkSurfaceKHR surface);
 VKQueueFamilyIndices VKFindQueueFamilies(VkPhysicalDevice device, const VkQueueFlags flags, VkSurfaceKHR* surface = nullptr);
+
+// Returns the index of the first queue family that supports all 'requiredFlags' but none of the 'excludedFlags', or VKQueueFamilyIndices::invalidIndex if there is no such family.
+std::uint32_t VKFindDedicatedQueueFamily(VkPhysicalDevice device, const VkQueueFlags requiredFlags, const VkQueueFlags excludedFlags);
 VkFormat VKFindSupportedImageFormat(VkPhysicalDevice device, const VkFormat* candidates, std::size_t numCandidates, VkImageTiling tiling, VkFormatFeatureFlags features);
 
 // Returns the memory type index that supports the specified type bits and properties, or traps program execution on failure.
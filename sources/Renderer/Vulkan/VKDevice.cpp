@@ -31,19 +31,35 @@ VKDevice::VKDevice() :
 }
 
 VKDevice::VKDevice(VKDevice&& device) :
-    device_             { std::move(device.device_)      },
-    queueFamilyIndices_ { device.queueFamilyIndices_     },
-    graphicsQueue_      { device.graphicsQueue_          },
-    commandPool_        { std::move(device.commandPool_) }
+    device_                 { std::move(device.device_)       },
+    queueFamilyIndices_     { device.queueFamilyIndices_      },
+    graphicsQueue_          { device.graphicsQueue_           },
+    computeFamily_          { device.computeFamily_           },
+    computeQueue_           { device.computeQueue_            },
+    transferFamily_         { device.transferFamily_          },
+    transferQueue_          { device.transferQueue_           },
+    numSharedQueueFamilies_ { device.numSharedQueueFamilies_  },
+    commandPool_            { std::move(device.commandPool_)  },
+    recycledCommandBuffers_ { std::move(device.recycledCommandBuffers_) }
 {
+    for_range(i, maxNumSharedQueueFamilies)
+        sharedQueueFamilies_[i] = device.sharedQueueFamilies_[i];
 }
 
 VKDevice& VKDevice::operator = (VKDevice&& device)
 {
-    device_             = std::move(device.device_);
-    queueFamilyIndices_ = device.queueFamilyIndices_;
-    graphicsQueue_      = device.graphicsQueue_;
-    commandPool_        = std::move(device.commandPool_);
+    device_                 = std::move(device.device_);
+    queueFamilyIndices_     = device.queueFamilyIndices_;
+    graphicsQueue_          = device.graphicsQueue_;
+    computeFamily_          = device.computeFamily_;
+    computeQueue_           = device.computeQueue_;
+    transferFamily_         = device.transferFamily_;
+    transferQueue_          = device.transferQueue_;
+    numSharedQueueFamilies_ = device.numSharedQueueFamilies_;
+    commandPool_            = std::move(device.commandPool_);
+    recycledCommandBuffers_ = std::move(device.recycledCommandBuffers_);
+    for_range(i, maxNumSharedQueueFamilies)
+        sharedQueueFamilies_[i] = device.sharedQueueFamilies_[i];
     return *this;
 }
 
@@ -62,10 +78,11 @@ void VKDevice::CreateLogicalDevice(
 {
     /* Initialize queue create description */
     queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+    FindDedicatedQueueFamilies(physicalDevice);
 
-    SmallVector<VkDeviceQueueCreateInfo, 2> queueCreateInfos;
+    SmallVector<VkDeviceQueueCreateInfo, 4> queueCreateInfos;
 
-    auto AddQueueFamily = [&queueCreateInfos](std::uint32_t family, float queuePriority)
+    auto AddQueueFamily = [&queueCreateInfos](std::uint32_t family, const float& queuePriority)
     {
         VkDeviceQueueCreateInfo info;
         {
@@ -86,6 +103,13 @@ void VKDevice::CreateLogicalDevice(
     if (queueFamilyIndices_.graphicsFamily != queueFamilyIndices_.presentFamily)
         AddQueueFamily(queueFamilyIndices_.presentFamily, queuePriority);
 
+    /* Add dedicated compute and transfer queues, so work can overlap with the graphics queue */
+    if (computeFamily_ != VKQueueFamilyIndices::invalidIndex && computeFamily_ != queueFamilyIndices_.presentFamily)
+        AddQueueFamily(computeFamily_, queuePriority);
+
+    if (transferFamily_ != VKQueueFamilyIndices::invalidIndex && transferFamily_ != queueFamilyIndices_.presentFamily)
+        AddQueueFamily(transferFamily_, queuePriority);
+
     /* Create logical device */
     VkDeviceCreateInfo createInfo;
     {
@@ -113,8 +137,8 @@ void VKDevice::CreateLogicalDevice(
     VkResult result = vkCreateDevice(physicalDevice, &createInfo, nullptr, device_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan logical device");
 
-    /* Query device graphics queue */
-    vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
+    /* Query device queues */
+    QueryDeviceQueues();
 
     /* Create default command pool */
     commandPool_ = CreateCommandPool();
@@ -122,8 +146,10 @@ void VKDevice::CreateLogicalDevice(
 
 void VKDevice::LoadLogicalDeviceWeakRef(VkPhysicalDevice physicalDevice, VkDevice device)
 {
-    /* Initialize queue create description */
+    /* Initialize queue create description; dedicated queues are not available since the device was created externally */
     queueFamilyIndices_ = VKFindQueueFamilies(physicalDevice, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+    sharedQueueFamilies_[0] = queueFamilyIndices_.graphicsFamily;
+    numSharedQueueFamilies_ = 1;
 
     /* Store weak reference to logical Vulkan device */
     device_ = VKPtr<VkDevice>{ device };
@@ -136,6 +162,11 @@ void VKDevice::LoadLogicalDeviceWeakRef(VkPhysicalDevice physicalDevice, VkDevic
 }
 
 VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
+{
+    return CreateCommandPool(queueFamilyIndices_.graphicsFamily);
+}
+
+VKPtr<VkCommandPool> VKDevice::CreateCommandPool(std::uint32_t queueFamilyIndex)
 {
     VKPtr<VkCommandPool> commandPool{ device_, vkDestroyCommandPool };
 
@@ -145,7 +176,7 @@ VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
         createInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
         createInfo.pNext            = nullptr;
         createInfo.flags            = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-        createInfo.queueFamilyIndex = queueFamilyIndices_.graphicsFamily;
+        createInfo.queueFamilyIndex = queueFamilyIndex;
     }
     VkResult result = vkCreateCommandPool(device_, &createInfo, nullptr, commandPool.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan command pool");
@@ -153,21 +184,50 @@ VKPtr<VkCommandPool> VKDevice::CreateCommandPool()
     return commandPool;
 }
 
+std::recursive_mutex& VKDevice::GetQueueMutex(VkQueue queue)
+{
+    if (queue != VK_NULL_HANDLE)
+    {
+        if (queue == computeQueue_)
+            return computeQueueMutex_;
+        if (queue == transferQueue_)
+            return transferQueueMutex_;
+    }
+    return graphicsQueueMutex_;
+}
+
+std::unique_lock<std::recursive_mutex> VKDevice::LockQueue()
+{
+    return std::unique_lock<std::recursive_mutex>{ graphicsQueueMutex_ };
+}
+
 VkCommandBuffer VKDevice::AllocCommandBuffer(bool begin)
 {
+    std::lock_guard<std::recursive_mutex> guard{ graphicsQueueMutex_ };
+
     VkCommandBuffer cmdBuffer = VK_NULL_HANDLE;
+    VkResult result = VK_SUCCESS;
 
-    /* Allocate new primary level command buffer via staging command pool */
-    VkCommandBufferAllocateInfo allocInfo;
+    if (!recycledCommandBuffers_.empty())
     {
-        allocInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-        allocInfo.pNext                = nullptr;
-        allocInfo.commandPool          = commandPool_;
-        allocInfo.level                = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-        allocInfo.commandBufferCount   = 1;
+        /* Reuse command buffer of a previous one-shot submission; it is reset implicitly by vkBeginCommandBuffer */
+        cmdBuffer = recycledCommandBuffers_.back();
+        recycledCommandBuffers_.pop_back();
+    }
+    else
+    {
+        /* Allocate new primary level command buffer via staging command pool */
+        VkCommandBufferAllocateInfo allocInfo;
+        {
+            allocInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.pNext                = nullptr;
+            allocInfo.commandPool          = commandPool_;
+            allocInfo.level                = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount   = 1;
+        }
+        result = vkAllocateCommandBuffers(device_, &allocInfo, &cmdBuffer);
+        VKThrowIfFailed(result, "failed to allocate Vulkan command buffer");
     }
-    VkResult result = vkAllocateCommandBuffers(device_, &allocInfo, &cmdBuffer);
-    VKThrowIfFailed(result, "failed to allocate Vulkan command buffer");
 
     /* Begin command buffer recording (if enabled) */
     if (begin)
@@ -186,8 +246,10 @@ VkCommandBuffer VKDevice::AllocCommandBuffer(bool begin)
     return cmdBuffer;
 }
 
-void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
+void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release, VkSemaphore waitSemaphore)
 {
+    std::lock_guard<std::recursive_mutex> guard{ graphicsQueueMutex_ };
+
     /* End command buffer record */
     VkResult result = vkEndCommandBuffer(cmdBuffer);
     VKThrowIfFailed(result, "failed to end recording Vulkan command buffer");
@@ -197,9 +259,13 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
         VKFence fence{ device_ };
 
         /* Submit command buffer to queue */
+        const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
         VkSubmitInfo submitInfo = {};
         {
             submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.waitSemaphoreCount   = (waitSemaphore != VK_NULL_HANDLE ? 1u : 0u);
+            submitInfo.pWaitSemaphores      = &waitSemaphore;
+            submitInfo.pWaitDstStageMask    = &waitDstStageMask;
             submitInfo.commandBufferCount   = 1;
             submitInfo.pCommandBuffers      = (&cmdBuffer);
         }
@@ -209,9 +275,9 @@ void VKDevice::FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release)
         fence.Wait(device_, ULLONG_MAX);
     }
 
-    /* Release command buffer (if enabled) */
+    /* Recycle command buffer for the next one-shot submission (if enabled); it has already finished execution */
     if (release)
-        vkFreeCommandBuffers(device_, commandPool_, 1, &cmdBuffer);
+        recycledCommandBuffers_.push_back(cmdBuffer);
 }
 
 void VKDevice::CopyBuffer(
@@ -221,6 +287,7 @@ void VKDevice::CopyBuffer(
     VkDeviceSize    srcOffset,
     VkDeviceSize    dstOffset)
 {
+    std::lock_guard<std::recursive_mutex> guard{ graphicsQueueMutex_ };
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
         VkBufferCopy region;
@@ -283,6 +350,40 @@ void VKDevice::FlushMappedBuffer(VKDeviceBuffer& buffer, VkDeviceSize size, VkDe
 }
 
 
+
+/*
+ * ======= Private: =======
+ */
+
+void VKDevice::FindDedicatedQueueFamilies(VkPhysicalDevice physicalDevice)
+{
+    /* Find compute family without graphics and transfer family without graphics and compute capabilities */
+    computeFamily_  = VKFindDedicatedQueueFamily(physicalDevice, VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+    transferFamily_ = VKFindDedicatedQueueFamily(physicalDevice, VK_QUEUE_TRANSFER_BIT, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT));
+
+    /* Store distinct list of queue families for resources with concurrent sharing mode */
+    numSharedQueueFamilies_ = 0;
+    sharedQueueFamilies_[numSharedQueueFamilies_++] = queueFamilyIndices_.graphicsFamily;
+
+    if (computeFamily_ != VKQueueFamilyIndices::invalidIndex)
+        sharedQueueFamilies_[numSharedQueueFamilies_++] = computeFamily_;
+
+    if (transferFamily_ != VKQueueFamilyIndices::invalidIndex && transferFamily_ != computeFamily_)
+        sharedQueueFamilies_[numSharedQueueFamilies_++] = transferFamily_;
+}
+
+void VKDevice::QueryDeviceQueues()
+{
+    vkGetDeviceQueue(device_, queueFamilyIndices_.graphicsFamily, 0, &graphicsQueue_);
+
+    if (computeFamily_ != VKQueueFamilyIndices::invalidIndex)
+        vkGetDeviceQueue(device_, computeFamily_, 0, &computeQueue_);
+
+    if (transferFamily_ != VKQueueFamilyIndices::invalidIndex)
+        vkGetDeviceQueue(device_, transferFamily_, 0, &transferQueue_);
+}
+
+
 } // /namespace LLGL
 
 
@@ -14,6 +14,8 @@
 #include "VKPtr.h"
 #include "VKCore.h"
 #include "Buffer/VKDeviceBuffer.h"
+#include <vector>
+#include <mutex>
 
 
 namespace LLGL
@@ -50,11 +52,26 @@ class VKDevice
         /* ----- Allocation ----- */
 
         VKPtr<VkCommandPool> CreateCommandPool();
+        VKPtr<VkCommandPool> CreateCommandPool(std::uint32_t queueFamilyIndex);
 
         /* ----- Queue ----- */
 
+        /*
+        Returns the mutex that synchronizes host access to the specified queue, which is required by Vulkan for all queue operations.
+        The mutex of the graphics queue also synchronizes the default command pool. Queues that are not dedicated compute or transfer queues share this mutex.
+        */
+        std::recursive_mutex& GetQueueMutex(VkQueue queue);
+
+        // Locks the graphics queue and the default command pool for the calling thread. See GetQueueMutex().
+        std::unique_lock<std::recursive_mutex> LockQueue();
+
+        // Allocates a primary command buffer from the default command pool or reuses one that was released by FlushCommandBuffer(). The queue must be locked until the command buffer is flushed.
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
-        void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true);
+        /*
+        Submits the specified command buffer and waits for its completion. If 'waitSemaphore' is not null, the submission waits for it on the GPU first.
+        If 'release' is true, the command buffer is recycled for the next call to AllocCommandBuffer() instead of being freed.
+        */
+        void FlushCommandBuffer(VkCommandBuffer cmdBuffer, bool release = true, VkSemaphore waitSemaphore = VK_NULL_HANDLE);
 
         /* ----- Buffer/Image operatons ----- */
 
@@ -102,18 +119,77 @@ class VKDevice
             return graphicsQueue_;
         }
 
+        // Returns the queue family index of the dedicated compute queue or VKQueueFamilyIndices::invalidIndex if there is none.
+        inline std::uint32_t GetComputeQueueFamily() const
+        {
+            return computeFamily_;
+        }
+
+        // Returns the native VkQueue handle of the dedicated compute queue or VK_NULL_HANDLE if there is none.
+        inline VkQueue GetVkComputeQueue() const
+        {
+            return computeQueue_;
+        }
+
+        // Returns the queue family index of the dedicated transfer queue or VKQueueFamilyIndices::invalidIndex if there is none.
+        inline std::uint32_t GetTransferQueueFamily() const
+        {
+            return transferFamily_;
+        }
+
+        // Returns the native VkQueue handle of the dedicated transfer queue or VK_NULL_HANDLE if there is none.
+        inline VkQueue GetVkTransferQueue() const
+        {
+            return transferQueue_;
+        }
+
+        // Returns the list of distinct queue families resources must be shared with. Resources need VK_SHARING_MODE_CONCURRENT if there is more than one.
+        inline const std::uint32_t* GetSharedQueueFamilies() const
+        {
+            return sharedQueueFamilies_;
+        }
+
+        // Returns the number of entries in the list returned by GetSharedQueueFamilies().
+        inline std::uint32_t GetNumSharedQueueFamilies() const
+        {
+            return numSharedQueueFamilies_;
+        }
+
         // Returns the native VkCommandPool handle.
         inline const VKPtr<VkCommandPool>& GetVkCommandPool() const
         {
             return commandPool_;
         }
 
+    private:
+
+        // Finds the dedicated compute and transfer queue families and stores the distinct list of queue families.
+        void FindDedicatedQueueFamilies(VkPhysicalDevice physicalDevice);
+
+        // Queries the native queue handles from the logical device.
+        void QueryDeviceQueues();
+
+    private:
+
+        static constexpr std::uint32_t maxNumSharedQueueFamilies = 3;
+
     private:
 
         VKPtr<VkDevice>         device_;
         VKQueueFamilyIndices    queueFamilyIndices_;
-        VkQueue                 graphicsQueue_      = VK_NULL_HANDLE;
+        VkQueue                 graphicsQueue_                                      = VK_NULL_HANDLE;
+        std::uint32_t           computeFamily_                                      = VKQueueFamilyIndices::invalidIndex;
+        VkQueue                 computeQueue_                                       = VK_NULL_HANDLE;
+        std::uint32_t           transferFamily_                                     = VKQueueFamilyIndices::invalidIndex;
+        VkQueue                 transferQueue_                                      = VK_NULL_HANDLE;
+        std::uint32_t           sharedQueueFamilies_[maxNumSharedQueueFamilies]     = {};
+        std::uint32_t           numSharedQueueFamilies_                             = 0;
         VKPtr<VkCommandPool>    commandPool_;
+        std::recursive_mutex    graphicsQueueMutex_;
+        std::recursive_mutex    computeQueueMutex_;
+        std::recursive_mutex    transferQueueMutex_;
+        std::vector<VkCommandBuffer>
+                                recycledCommandBuffers_;                            // Command buffers of completed one-shot submissions, see FlushCommandBuffer().
 
 };
 
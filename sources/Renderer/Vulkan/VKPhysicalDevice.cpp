@@ -10,14 +10,17 @@
 #include "VKCore.h"
 #include "VKTypes.h"
 #include "RenderState/VKGraphicsPSO.h"
+#include "Memory/VKExternalMemory.h"
 #include "../../Core/Vendor.h"
 #include "../../Core/Assertion.h"
 #include <LLGL/Constants.h>
+#include <LLGL/Utils/ForRange.h>
 #include <string>
 #include <cstring>
 #include <set>
 #include <limits>
 #include <algorithm>
+#include <mutex>
 
 
 namespace LLGL
@@ -26,11 +29,17 @@ namespace LLGL
 
 static const char* g_requiredVulkanExtensions[] =
 {
-    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
     VK_KHR_MAINTENANCE1_EXTENSION_NAME,
     nullptr,
 };
 
+// Device extensions that are only required to present swap-chains, i.e. unless the render system is headless.
+static const char* g_requiredVulkanPresentExtensions[] =
+{
+    VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+    nullptr,
+};
+
 static bool CheckDeviceExtensionSupport(
     VkPhysicalDevice                    physicalDevice,
     const char* const*                  requiredExtensions,
@@ -55,7 +64,8 @@ static bool CheckDeviceExtensionSupport(
 
 static bool IsPhysicalDeviceSuitable(
     VkPhysicalDevice                    physicalDevice,
-    std::vector<VkExtensionProperties>& supportedExtensions)
+    std::vector<VkExtensionProperties>& supportedExtensions,
+    bool                                headless)
 {
     /* Check if physical devices supports at least these extensions */
     std::vector<VkExtensionProperties> extensions;
@@ -66,6 +76,16 @@ static bool IsPhysicalDeviceSuitable(
         extensions
     );
 
+    if (suitable && !headless)
+    {
+        suitable = CheckDeviceExtensionSupport(
+            physicalDevice,
+            g_requiredVulkanPresentExtensions,
+            (sizeof(g_requiredVulkanPresentExtensions) / sizeof(g_requiredVulkanPresentExtensions[0]) - 1),
+            extensions
+        );
+    }
+
     if (suitable)
     {
         /* Store all supported extensions */
@@ -87,14 +107,47 @@ static bool IsPreferredDeviceVendor(DeviceVendor vendor, long preferredDeviceFla
     }
 }
 
-bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags)
+/*
+Process-wide record of the last physical device that was picked for a set of preference flags.
+When the render system is loaded again, this device is tried first, which avoids probing the extensions of all other devices.
+*/
+struct VKPhysicalDeviceSelection
+{
+    bool            valid                   = false;
+    long            preferredDeviceFlags    = 0;
+    std::uint32_t   vendorID                = 0;
+    std::uint32_t   deviceID                = 0;
+};
+
+static std::mutex                   g_physicalDeviceSelectionMutex;
+static VKPhysicalDeviceSelection    g_physicalDeviceSelection;
+
+static VKPhysicalDeviceSelection GetCachedPhysicalDeviceSelection()
+{
+    std::lock_guard<std::mutex> guard{ g_physicalDeviceSelectionMutex };
+    return g_physicalDeviceSelection;
+}
+
+static void CachePhysicalDeviceSelection(VkPhysicalDevice device, long preferredDeviceFlags)
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(device, &properties);
+
+    std::lock_guard<std::mutex> guard{ g_physicalDeviceSelectionMutex };
+    g_physicalDeviceSelection.valid                 = true;
+    g_physicalDeviceSelection.preferredDeviceFlags  = preferredDeviceFlags;
+    g_physicalDeviceSelection.vendorID              = properties.vendorID;
+    g_physicalDeviceSelection.deviceID              = properties.deviceID;
+}
+
+bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags, int adapterIndex, bool headless)
 {
     /* Query all physical devices and pick suitable */
     std::vector<VkPhysicalDevice> physicalDevices = VKQueryPhysicalDevices(instance);
 
-    auto TryPickPhysicalDevice = [this](VkPhysicalDevice device) -> bool
+    auto TryPickPhysicalDevice = [this, preferredDeviceFlags, headless](VkPhysicalDevice device) -> bool
     {
-        if (!IsPhysicalDeviceSuitable(device, supportedExtensions_))
+        if (!IsPhysicalDeviceSuitable(device, supportedExtensions_, headless))
         {
             /* Device doesn't support required extensions */
             return false;
@@ -104,7 +157,8 @@ bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDev
         for (const VkExtensionProperties& extension : supportedExtensions_)
             supportedExtensionNames_.insert(extension.extensionName);
 
-        if (!EnableExtensions(g_requiredVulkanExtensions, true))
+        if (!EnableExtensions(g_requiredVulkanExtensions, true) ||
+            (!headless && !EnableExtensions(g_requiredVulkanPresentExtensions, true)))
         {
             /* Stop considering this physical device, because some required extensions are not supported */
             supportedExtensionNames_.clear();
@@ -116,9 +170,37 @@ bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDev
         EnableExtensions(GetOptionalExtensions());
         QueryDeviceInfo();
 
+        /* Remember this selection for the next time the render system is loaded */
+        CachePhysicalDeviceSelection(device, preferredDeviceFlags);
+
         return true;
     };
 
+    if (adapterIndex >= 0)
+    {
+        /* Only consider the device with the specified index */
+        if (static_cast<std::size_t>(adapterIndex) >= physicalDevices.size())
+            return false;
+        return TryPickPhysicalDevice(physicalDevices[adapterIndex]);
+    }
+
+    /* Try the device that was picked last time with the same preferences first */
+    const VKPhysicalDeviceSelection cachedSelection = GetCachedPhysicalDeviceSelection();
+    if (cachedSelection.valid && cachedSelection.preferredDeviceFlags == preferredDeviceFlags)
+    {
+        for (VkPhysicalDevice device : physicalDevices)
+        {
+            VkPhysicalDeviceProperties properties;
+            vkGetPhysicalDeviceProperties(device, &properties);
+            if (properties.vendorID == cachedSelection.vendorID && properties.deviceID == cachedSelection.deviceID)
+            {
+                if (TryPickPhysicalDevice(device))
+                    return true;
+                break;
+            }
+        }
+    }
+
     if (preferredDeviceFlags != 0)
     {
         /* Try to find preferred device */
@@ -145,6 +227,53 @@ bool VKPhysicalDevice::PickPhysicalDevice(VkInstance instance, long preferredDev
     return false;
 }
 
+void VKPhysicalDevice::QueryAdapterInfo(VkPhysicalDevice physicalDevice, AdapterInfo& outInfo)
+{
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+    outInfo.name        = properties.deviceName;
+    outInfo.vendorID    = properties.vendorID;
+    outInfo.deviceID    = properties.deviceID;
+
+    #if VK_KHR_get_physical_device_properties2 && defined VK_VERSION_1_1
+    if (properties.apiVersion >= VK_API_VERSION_1_1)
+    {
+        VkPhysicalDeviceIDProperties idProps = {};
+        idProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES;
+
+        VkPhysicalDeviceProperties2 propertiesExt = {};
+        propertiesExt.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        propertiesExt.pNext = &idProps;
+
+        vkGetPhysicalDeviceProperties2(physicalDevice, &propertiesExt);
+
+        static_assert(sizeof(outInfo.uuid) == VK_UUID_SIZE, "AdapterInfo::uuid size mismatch with VK_UUID_SIZE");
+        ::memcpy(outInfo.uuid, idProps.deviceUUID, VK_UUID_SIZE);
+
+        /* LUID is only valid on Windows */
+        if (idProps.deviceLUIDValid)
+        {
+            static_assert(sizeof(outInfo.luid) == VK_LUID_SIZE, "AdapterInfo::luid size mismatch with VK_LUID_SIZE");
+            ::memcpy(&(outInfo.luid), idProps.deviceLUID, VK_LUID_SIZE);
+        }
+    }
+    #endif // /VK_KHR_get_physical_device_properties2
+
+    /* Accumulate sizes of device-local heaps as video memory and all other heaps as shared memory */
+    VkPhysicalDeviceMemoryProperties memoryProperties;
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+    for_range(i, memoryProperties.memoryHeapCount)
+    {
+        const VkMemoryHeap& heap = memoryProperties.memoryHeaps[i];
+        if ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0)
+            outInfo.videoMemory += heap.size;
+        else
+            outInfo.sharedMemory += heap.size;
+    }
+}
+
 void VKPhysicalDevice::LoadPhysicalDeviceWeakRef(VkPhysicalDevice physicalDevice)
 {
     LLGL_ASSERT(physicalDevice != VK_NULL_HANDLE);
@@ -189,6 +318,8 @@ static std::vector<Format> GetCompressedVKTextureFormatsS3TC()
         Format::BC3UNorm,   Format::BC3UNorm_sRGB,
         Format::BC4UNorm,   Format::BC4SNorm,
         Format::BC5UNorm,   Format::BC5SNorm,
+        Format::BC6HUFloat, Format::BC6HSFloat,
+        Format::BC7UNorm,   Format::BC7UNorm_sRGB,
     };
 }
 
@@ -217,7 +348,22 @@ static std::vector<Format> GetCompressedVKTextureFormatsETC2()
 {
     return
     {
-        Format::ETC2UNorm, Format::ETC2UNorm_sRGB,
+        Format::ETC2UNorm,      Format::ETC2UNorm_sRGB,
+        Format::ETC2A1UNorm,    Format::ETC2A1UNorm_sRGB,
+        Format::ETC2A8UNorm,    Format::ETC2A8UNorm_sRGB,
+        Format::EACR11UNorm,    Format::EACR11SNorm,
+        Format::EACRG11UNorm,   Format::EACRG11SNorm,
+    };
+}
+
+static std::vector<Format> GetCompressedVKTextureFormatsASTCHDR()
+{
+    return
+    {
+        Format::ASTC4x4Float,   Format::ASTC5x4Float,   Format::ASTC5x5Float,   Format::ASTC6x5Float,
+        Format::ASTC6x6Float,   Format::ASTC8x5Float,   Format::ASTC8x6Float,   Format::ASTC8x8Float,
+        Format::ASTC10x5Float,  Format::ASTC10x6Float,  Format::ASTC10x8Float,  Format::ASTC10x10Float,
+        Format::ASTC12x10Float, Format::ASTC12x12Float,
     };
 }
 
@@ -252,6 +398,56 @@ void VKPhysicalDevice::QueryRendererInfo(RendererInfo& info)
     GetVKPipelineCacheID(properties_, info.pipelineCacheID);
 }
 
+#ifdef VK_VERSION_1_1
+
+static long GetStageFlagsFromVkShaderStages(VkShaderStageFlags stages)
+{
+    long flags = 0;
+    if ((stages & VK_SHADER_STAGE_VERTEX_BIT) != 0)
+        flags |= StageFlags::VertexStage;
+    if ((stages & VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT) != 0)
+        flags |= StageFlags::TessControlStage;
+    if ((stages & VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT) != 0)
+        flags |= StageFlags::TessEvaluationStage;
+    if ((stages & VK_SHADER_STAGE_GEOMETRY_BIT) != 0)
+        flags |= StageFlags::GeometryStage;
+    if ((stages & VK_SHADER_STAGE_FRAGMENT_BIT) != 0)
+        flags |= StageFlags::FragmentStage;
+    if ((stages & VK_SHADER_STAGE_COMPUTE_BIT) != 0)
+        flags |= StageFlags::ComputeStage;
+    #if VK_EXT_mesh_shader
+    if ((stages & VK_SHADER_STAGE_TASK_BIT_EXT) != 0)
+        flags |= StageFlags::TaskStage;
+    if ((stages & VK_SHADER_STAGE_MESH_BIT_EXT) != 0)
+        flags |= StageFlags::MeshStage;
+    #endif
+    return flags;
+}
+
+static long GetSubgroupOperationFlagsFromVkSubgroupFeatures(VkSubgroupFeatureFlags features)
+{
+    long flags = 0;
+    if ((features & VK_SUBGROUP_FEATURE_BASIC_BIT) != 0)
+        flags |= SubgroupOperationFlags::Basic;
+    if ((features & VK_SUBGROUP_FEATURE_VOTE_BIT) != 0)
+        flags |= SubgroupOperationFlags::Vote;
+    if ((features & VK_SUBGROUP_FEATURE_ARITHMETIC_BIT) != 0)
+        flags |= SubgroupOperationFlags::Arithmetic;
+    if ((features & VK_SUBGROUP_FEATURE_BALLOT_BIT) != 0)
+        flags |= SubgroupOperationFlags::Ballot;
+    if ((features & VK_SUBGROUP_FEATURE_SHUFFLE_BIT) != 0)
+        flags |= SubgroupOperationFlags::Shuffle;
+    if ((features & VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT) != 0)
+        flags |= SubgroupOperationFlags::ShuffleRelative;
+    if ((features & VK_SUBGROUP_FEATURE_CLUSTERED_BIT) != 0)
+        flags |= SubgroupOperationFlags::Clustered;
+    if ((features & VK_SUBGROUP_FEATURE_QUAD_BIT) != 0)
+        flags |= SubgroupOperationFlags::Quad;
+    return flags;
+}
+
+#endif // /VK_VERSION_1_1
+
 void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
 {
     /* Map limits to output rendering capabilites */
@@ -282,6 +478,14 @@ void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
         caps.textureFormats.insert(caps.textureFormats.end(), compressedFormatsETC2.begin(), compressedFormatsETC2.end());
     }
 
+    #if VK_EXT_texture_compression_astc_hdr
+    if (astcHDRFeatures_.textureCompressionASTC_HDR != VK_FALSE)
+    {
+        const std::vector<Format> compressedFormatsASTCHDR = GetCompressedVKTextureFormatsASTCHDR();
+        caps.textureFormats.insert(caps.textureFormats.end(), compressedFormatsASTCHDR.begin(), compressedFormatsASTCHDR.end());
+    }
+    #endif
+
     /* Query features */
     caps.features.hasRenderTargets                  = true;
     caps.features.has3DTextures                     = true;
@@ -309,7 +513,33 @@ void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.features.hasLogicOp                        = (features.logicOp != VK_FALSE);
     caps.features.hasPipelineStatistics             = (features.pipelineStatisticsQuery != VK_FALSE);
     caps.features.hasRenderCondition                = SupportsExtension(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+    caps.features.hasTimestampQueries               = (limits.timestampComputeAndGraphics != VK_FALSE);
+    caps.features.hasQueryResolve                   = true;
     caps.features.hasPipelineCaching                = true;
+    caps.features.hasIndirectCountDrawing           = SupportsExtension(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    #if VK_EXT_mesh_shader
+    caps.features.hasMeshShaders                    = (meshShaderFeatures_.meshShader != VK_FALSE && meshShaderFeatures_.taskShader != VK_FALSE);
+    caps.features.hasTileShaders                    = false;
+    caps.features.hasFramebufferFetch               = false;
+    #endif
+    #if VK_KHR_fragment_shading_rate
+    caps.features.hasVariableRateShading            = (shadingRateFeatures_.pipelineFragmentShadingRate != VK_FALSE);
+    caps.features.hasIndirectStateChanges           = false;
+    #endif
+    caps.features.hasTransientBuffers               = true;
+    caps.features.hasPersistentMapping              = true;
+    caps.features.hasSparseTextures                 = SupportsSparseTextures();
+    caps.features.hasPlacementHeaps                 = true;
+    caps.features.hasSharedResources                = VKExternalMemory::IsSupported();
+    caps.features.hasConcurrentResourceCreation     = true;
+    caps.features.hasRayTracing                     = false; // VK_KHR_acceleration_structure and VK_KHR_ray_tracing_pipeline are not implemented yet
+    caps.features.hasRayQuery                       = false; // VK_KHR_ray_query requires acceleration structures, see hasRayTracing
+    #if VK_KHR_multiview
+    caps.features.hasMultiview                      = (multiviewFeatures_.multiview != VK_FALSE);
+    #endif
+    #if VK_EXT_descriptor_indexing
+    caps.features.hasBindlessResourceHeaps          = (descriptorIndexingFeatures_.descriptorBindingPartiallyBound != VK_FALSE && descriptorIndexingFeatures_.runtimeDescriptorArray != VK_FALSE);
+    #endif
 
     /* Query limits */
     caps.limits.lineWidthRange[0]                   = limits.lineWidthRange[0];
@@ -328,6 +558,7 @@ void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.limits.maxComputeShaderWorkGroupSize[0]    = limits.maxComputeWorkGroupSize[0];
     caps.limits.maxComputeShaderWorkGroupSize[1]    = limits.maxComputeWorkGroupSize[1];
     caps.limits.maxComputeShaderWorkGroupSize[2]    = limits.maxComputeWorkGroupSize[2];
+    caps.limits.maxComputeShaderSharedMemorySize    = limits.maxComputeSharedMemorySize;
     caps.limits.maxViewports                        = std::min(limits.maxViewports, LLGL_MAX_NUM_VIEWPORTS_AND_SCISSORS);
     caps.limits.maxViewportSize[0]                  = limits.maxViewportDimensions[0];
     caps.limits.maxViewportSize[1]                  = limits.maxViewportDimensions[1];
@@ -343,6 +574,35 @@ void VKPhysicalDevice::QueryRenderingCaps(RenderingCapabilities& caps)
     caps.limits.maxStencilBufferSamples             = VKTypes::GetMaxVkSampleCounts(limits.framebufferStencilSampleCounts);
     caps.limits.maxNoAttachmentSamples              = VKTypes::GetMaxVkSampleCounts(limits.framebufferNoAttachmentsSampleCounts);
     caps.limits.storageResourceStageFlags           = StageFlags::AllStages;
+    #if VK_EXT_descriptor_indexing
+    caps.limits.maxBindlessResourceViews            = (caps.features.hasBindlessResourceHeaps ? descriptorIndexingProps_.maxPerStageUpdateAfterBindResources : 0);
+    #endif
+    caps.limits.sparseTileSize                      = (caps.features.hasSparseTextures ? 65536u : 0u);
+    #if VK_KHR_fragment_shading_rate && VK_KHR_dynamic_rendering
+    /* Shading-rate attachments are only supported with dynamic rendering; use the finest supported texel size as tile size */
+    if (shadingRateFeatures_.attachmentFragmentShadingRate != VK_FALSE && dynamicRenderingFeatures_.dynamicRendering != VK_FALSE)
+        caps.limits.shadingRateImageTileSize        = shadingRateProps_.minFragmentShadingRateAttachmentTexelSize.width;
+    #endif
+    #if VK_KHR_multiview
+    caps.limits.maxMultiviewViewCount               = (caps.features.hasMultiview ? std::min(multiviewProps_.maxMultiviewViewCount, 32u) : 0u);
+    #endif
+    #ifdef VK_VERSION_1_1
+    if (subgroupProps_.subgroupSize > 0)
+    {
+        caps.limits.subgroupSizeRange[0]            = subgroupProps_.subgroupSize;
+        caps.limits.subgroupSizeRange[1]            = subgroupProps_.subgroupSize;
+        #if VK_EXT_subgroup_size_control
+        /* Subgroup size is variable between the min/max range if VK_EXT_subgroup_size_control is supported */
+        if (subgroupSizeControlProps_.minSubgroupSize > 0)
+        {
+            caps.limits.subgroupSizeRange[0]        = subgroupSizeControlProps_.minSubgroupSize;
+            caps.limits.subgroupSizeRange[1]        = subgroupSizeControlProps_.maxSubgroupSize;
+        }
+        #endif
+        caps.limits.subgroupStageFlags              = GetStageFlagsFromVkShaderStages(subgroupProps_.supportedStages);
+        caps.limits.subgroupOperationFlags          = GetSubgroupOperationFlagsFromVkSubgroupFeatures(subgroupProps_.supportedOperations);
+    }
+    #endif
 }
 
 void VKPhysicalDevice::QueryPipelineLimits(VKGraphicsPipelineLimits& pipelineLimits)
@@ -355,6 +615,27 @@ void VKPhysicalDevice::QueryPipelineLimits(VKGraphicsPipelineLimits& pipelineLim
     pipelineLimits.lineWidthRange[1]    = limits.lineWidthRange[1];
     pipelineLimits.lineWidthGranularity = limits.lineWidthGranularity;
 
+    /* Store which pipeline states can be folded into dynamic states */
+    #if VK_EXT_extended_dynamic_state
+    pipelineLimits.dynamicCoreStates    = (HasExtension(VKExt::EXT_extended_dynamic_state) && extDynamicStateFeatures_.extendedDynamicState != VK_FALSE);
+    #endif
+    #if VK_EXT_extended_dynamic_state2
+    pipelineLimits.dynamicEnableStates  = (HasExtension(VKExt::EXT_extended_dynamic_state2) && extDynamicState2Features_.extendedDynamicState2 != VK_FALSE);
+    #endif
+    #if VK_EXT_extended_dynamic_state3
+    pipelineLimits.dynamicPolygonMode   = (HasExtension(VKExt::EXT_extended_dynamic_state3) && extDynamicState3Features_.extendedDynamicState3PolygonMode != VK_FALSE);
+    #endif
+    #if VK_KHR_fragment_shading_rate
+    pipelineLimits.dynamicShadingRate   = (HasExtension(VKExt::KHR_fragment_shading_rate) && shadingRateFeatures_.pipelineFragmentShadingRate != VK_FALSE);
+    #if VK_KHR_dynamic_rendering
+    pipelineLimits.shadingRateAttachment =
+    (
+        HasExtension(VKExt::KHR_fragment_shading_rate) && HasExtension(VKExt::KHR_dynamic_rendering) &&
+        shadingRateFeatures_.attachmentFragmentShadingRate != VK_FALSE
+    );
+    #endif
+    #endif
+
     /*
     TODO: extension limits
     - VkPhysicalDeviceTransformFeedbackFeaturesEXT
@@ -384,11 +665,86 @@ VKDevice VKPhysicalDevice::CreateLogicalDevice(VkDevice customLogicalDevice)
     return device;
 }
 
+#if VK_EXT_descriptor_indexing
+
+static bool IsUpdateAfterBindSupported(const VkPhysicalDeviceDescriptorIndexingFeaturesEXT& features, VkDescriptorType descriptorType)
+{
+    switch (descriptorType)
+    {
+        case VK_DESCRIPTOR_TYPE_SAMPLER:
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            return (features.descriptorBindingSampledImageUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            return (features.descriptorBindingStorageImageUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            return (features.descriptorBindingUniformBufferUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            return (features.descriptorBindingStorageBufferUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            return (features.descriptorBindingUniformTexelBufferUpdateAfterBind != VK_FALSE);
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            return (features.descriptorBindingStorageTexelBufferUpdateAfterBind != VK_FALSE);
+        default:
+            return false;
+    }
+}
+
+#endif // /VK_EXT_descriptor_indexing
+
+VkFlags VKPhysicalDevice::GetBindlessDescriptorBindingFlags(VkDescriptorType descriptorType) const
+{
+    #if VK_EXT_descriptor_indexing
+    if (descriptorIndexingFeatures_.descriptorBindingPartiallyBound == VK_FALSE)
+        return 0;
+
+    /* Unwritten descriptors are allowed as long as they are not dynamically accessed by shaders */
+    VkFlags flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+
+    /* Descriptors that are not used by pending command buffers can be rewritten without waiting for the device */
+    if (descriptorIndexingFeatures_.descriptorBindingUpdateUnusedWhilePending != VK_FALSE)
+        flags |= VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT;
+    if (IsUpdateAfterBindSupported(descriptorIndexingFeatures_, descriptorType))
+        flags |= VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT;
+
+    return flags;
+    #else
+    return 0;
+    #endif
+}
+
+std::uint32_t VKPhysicalDevice::GetMaxPushDescriptors() const
+{
+    #if VK_KHR_push_descriptor
+    if (HasExtension(VKExt::KHR_push_descriptor))
+        return pushDescriptorProps_.maxPushDescriptors;
+    #endif
+    return 0;
+}
+
 std::uint32_t VKPhysicalDevice::FindMemoryType(std::uint32_t memoryTypeBits, VkMemoryPropertyFlags properties) const
 {
     return VKFindMemoryType(memoryProperties_, memoryTypeBits, properties);
 }
 
+bool VKPhysicalDevice::SupportsSparseTextures() const
+{
+    const VkPhysicalDeviceFeatures& features = features_.features;
+    if (features.sparseBinding == VK_FALSE || features.sparseResidencyImage2D == VK_FALSE)
+        return false;
+
+    /* Tile extents are reported with the standard shapes only, so non-standard block shapes are not supported */
+    if (properties_.sparseProperties.residencyStandard2DBlockShape == VK_FALSE)
+        return false;
+
+    /* Tile mappings are bound on the primary queue, so its family must support sparse binding operations */
+    const VKQueueFamilyIndices queueFamilyIndices = VKFindQueueFamilies(physicalDevice_, (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT));
+    const std::vector<VkQueueFamilyProperties> queueFamilies = VKQueryQueueFamilyProperties(physicalDevice_);
+    if (queueFamilyIndices.graphicsFamily >= queueFamilies.size())
+        return false;
+
+    return ((queueFamilies[queueFamilyIndices.graphicsFamily].queueFlags & VK_QUEUE_SPARSE_BINDING_BIT) != 0);
+}
+
 bool VKPhysicalDevice::SupportsExtension(const char* extension) const
 {
     auto it = std::find_if(
@@ -427,6 +783,31 @@ bool VKPhysicalDevice::EnableExtensions(const char** extensions, bool required)
     return true;
 }
 
+bool VKPhysicalDevice::QueryMemoryBudget(VkDeviceSize* outHeapUsage, VkDeviceSize* outHeapBudget) const
+{
+    #if VK_EXT_memory_budget
+    if (HasExtension(VKExt::EXT_memory_budget))
+    {
+        VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProps = {};
+        budgetProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+        VkPhysicalDeviceMemoryProperties2 memoryProps = {};
+        memoryProps.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+        memoryProps.pNext = &budgetProps;
+
+        vkGetPhysicalDeviceMemoryProperties2(physicalDevice_, &memoryProps);
+
+        for_range(i, memoryProps.memoryProperties.memoryHeapCount)
+        {
+            outHeapUsage[i]     = budgetProps.heapUsage[i];
+            outHeapBudget[i]    = budgetProps.heapBudget[i];
+        }
+        return true;
+    }
+    #endif // /VK_EXT_memory_budget
+    return false;
+}
+
 void VKPhysicalDevice::QueryDeviceInfo()
 {
     /* Query physical device features and properties with extensions */
@@ -472,8 +853,94 @@ void VKPhysicalDevice::QueryDeviceFeatures()
         ChainDescriptor(&transformFeedbackFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT);
     #endif
 
+    #if VK_EXT_descriptor_indexing
+    if (SupportsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+        ChainDescriptor(&descriptorIndexingFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT);
+    #endif
+
+    #if VK_KHR_synchronization2
+    if (SupportsExtension(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME))
+        ChainDescriptor(&synchronization2Features_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES_KHR);
+    #endif
+
+    #if VK_KHR_timeline_semaphore
+    if (SupportsExtension(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+        ChainDescriptor(&timelineSemaphoreFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR);
+    #endif
+
+    #if VK_KHR_present_id
+    if (SupportsExtension(VK_KHR_PRESENT_ID_EXTENSION_NAME))
+        ChainDescriptor(&presentIdFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR);
+    #endif
+
+    #if VK_KHR_present_wait
+    if (SupportsExtension(VK_KHR_PRESENT_WAIT_EXTENSION_NAME))
+        ChainDescriptor(&presentWaitFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR);
+    #endif
+
+    #if VK_EXT_swapchain_maintenance1
+    if (SupportsExtension(VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME))
+        ChainDescriptor(&swapchainMaintenance1Features_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT);
+    #endif
+
+    #if VK_KHR_dynamic_rendering
+    if (SupportsExtension(VK_KHR_DYNAMIC_RENDERING_EXTENSION_NAME))
+        ChainDescriptor(&dynamicRenderingFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES_KHR);
+    #endif
+
+    #if VK_EXT_extended_dynamic_state
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+        ChainDescriptor(&extDynamicStateFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT);
+    #endif
+
+    #if VK_EXT_extended_dynamic_state2
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME))
+        ChainDescriptor(&extDynamicState2Features_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT);
+    #endif
+
+    #if VK_EXT_extended_dynamic_state3
+    if (SupportsExtension(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME))
+        ChainDescriptor(&extDynamicState3Features_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT);
+    #endif
+
+    #if VK_EXT_mesh_shader
+    if (SupportsExtension(VK_EXT_MESH_SHADER_EXTENSION_NAME))
+        ChainDescriptor(&meshShaderFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT);
+    #endif
+
+    #if VK_EXT_texture_compression_astc_hdr
+    if (SupportsExtension(VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME))
+        ChainDescriptor(&astcHDRFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES_EXT);
+    #endif
+
+    #if VK_KHR_fragment_shading_rate
+    if (SupportsExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME))
+        ChainDescriptor(&shadingRateFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR);
+    #endif
+
+    #if VK_KHR_multiview
+    if (SupportsExtension(VK_KHR_MULTIVIEW_EXTENSION_NAME))
+        ChainDescriptor(&multiviewFeatures_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES_KHR);
+    #endif
+
     vkGetPhysicalDeviceFeatures2(physicalDevice_, &features_);
 
+    #if VK_EXT_mesh_shader
+    /* Don't enable mesh shader features that depend on fragment shading rate, since per-primitive shading rates are not enabled either */
+    meshShaderFeatures_.primitiveFragmentShadingRateMeshShader  = VK_FALSE;
+    #if VK_KHR_multiview
+    if (multiviewFeatures_.multiview == VK_FALSE)
+        meshShaderFeatures_.multiviewMeshShader                 = VK_FALSE;
+    #else
+    meshShaderFeatures_.multiviewMeshShader                     = VK_FALSE;
+    #endif
+    #endif
+
+    #if VK_KHR_fragment_shading_rate
+    /* Per-primitive shading rates are not exposed */
+    shadingRateFeatures_.primitiveFragmentShadingRate           = VK_FALSE;
+    #endif
+
     #else // VK_KHR_get_physical_device_properties2
 
     vkGetPhysicalDeviceFeatures(physicalDevice_, &(features_.features));
@@ -514,6 +981,38 @@ void VKPhysicalDevice::QueryDeviceProperties()
         ChainDescriptor(&transformFeedbackProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT);
     #endif
 
+    #if VK_EXT_descriptor_indexing
+    if (SupportsExtension(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+        ChainDescriptor(&descriptorIndexingProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT);
+    #endif
+
+    #if VK_KHR_push_descriptor
+    if (SupportsExtension(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME))
+        ChainDescriptor(&pushDescriptorProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR);
+    #endif
+
+    #if VK_KHR_fragment_shading_rate
+    if (SupportsExtension(VK_KHR_FRAGMENT_SHADING_RATE_EXTENSION_NAME))
+        ChainDescriptor(&shadingRateProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR);
+    #endif
+
+    #if VK_KHR_multiview
+    if (SupportsExtension(VK_KHR_MULTIVIEW_EXTENSION_NAME))
+        ChainDescriptor(&multiviewProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES_KHR);
+    #endif
+
+    #ifdef VK_VERSION_1_1
+    /* Subgroup properties are core since Vulkan 1.1 and must not be chained for devices with a lower API version */
+    vkGetPhysicalDeviceProperties(physicalDevice_, &properties_);
+    if (properties_.apiVersion >= VK_API_VERSION_1_1)
+        ChainDescriptor(&subgroupProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES);
+    #endif
+
+    #if VK_EXT_subgroup_size_control
+    if (SupportsExtension(VK_EXT_SUBGROUP_SIZE_CONTROL_EXTENSION_NAME))
+        ChainDescriptor(&subgroupSizeControlProps_, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT);
+    #endif
+
     /* Query device properties with extension "VK_KHR_get_physical_device_properties2" */
     vkGetPhysicalDeviceProperties2(physicalDevice_, &propertiesExt);
 
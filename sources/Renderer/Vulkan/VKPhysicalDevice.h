@@ -30,8 +30,14 @@ class VKPhysicalDevice
 
         /* ----- Common ----- */
 
-        // Picks the physical Vulkan device by enumerating the available devices from the specified Vulkan instance.
-        bool PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags = 0);
+        /*
+        Picks the physical Vulkan device by enumerating the available devices from the specified Vulkan instance.
+        If 'adapterIndex' is non-negative, only the device with that index is considered. Headless devices don't need to support VK_KHR_swapchain.
+        */
+        bool PickPhysicalDevice(VkInstance instance, long preferredDeviceFlags = 0, int adapterIndex = -1, bool headless = false);
+
+        // Queries the adapter information of the specified physical device. IDs are only available with Vulkan 1.1.
+        static void QueryAdapterInfo(VkPhysicalDevice physicalDevice, AdapterInfo& outInfo);
 
         // Loads the physical Vulkan device from a custom native handle.
         void LoadPhysicalDeviceWeakRef(VkPhysicalDevice physicalDevice);
@@ -79,6 +85,21 @@ class VKPhysicalDevice
             return memoryProperties_;
         }
 
+        /*
+        Queries the current usage and budget of all memory heaps via VK_EXT_memory_budget.
+        Both output arrays must have at least VK_MAX_MEMORY_HEAPS entries. Returns false if that extension is not available.
+        */
+        bool QueryMemoryBudget(VkDeviceSize* outHeapUsage, VkDeviceSize* outHeapBudget) const;
+
+        /*
+        Returns the descriptor binding flags (VkDescriptorBindingFlagsEXT) for a bindless heap binding of the specified descriptor type.
+        Returns 0 if VK_EXT_descriptor_indexing is not supported.
+        */
+        VkFlags GetBindlessDescriptorBindingFlags(VkDescriptorType descriptorType) const;
+
+        // Returns the maximum number of descriptors in a push descriptor set or 0 if VK_KHR_push_descriptor is not supported.
+        std::uint32_t GetMaxPushDescriptors() const;
+
         // Returns the list of names of all supported and enabled extensions.
         inline const std::vector<const char*>& GetExtensionNames() const
         {
@@ -105,6 +126,9 @@ class VKPhysicalDevice
         void QueryDeviceProperties();
         void QueryDeviceMemoryProperties();
 
+        // Returns true if 2D images with standard tile shapes can be bound sparsely on the primary queue.
+        bool SupportsSparseTextures() const;
+
     private:
 
         // Main device objects
@@ -127,6 +151,60 @@ class VKPhysicalDevice
         VkPhysicalDeviceTransformFeedbackPropertiesEXT          transformFeedbackProps_     = {};
         VkPhysicalDeviceTransformFeedbackFeaturesEXT            transformFeedbackFeatures_  = {};
         #endif
+        #if VK_EXT_descriptor_indexing
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT        descriptorIndexingProps_    = {};
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT          descriptorIndexingFeatures_ = {};
+        #endif
+        #if VK_KHR_synchronization2
+        VkPhysicalDeviceSynchronization2FeaturesKHR             synchronization2Features_   = {};
+        #endif
+        #if VK_KHR_timeline_semaphore
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR            timelineSemaphoreFeatures_  = {};
+        #endif
+        #if VK_KHR_present_id
+        VkPhysicalDevicePresentIdFeaturesKHR                    presentIdFeatures_          = {};
+        #endif
+        #if VK_KHR_present_wait
+        VkPhysicalDevicePresentWaitFeaturesKHR                  presentWaitFeatures_        = {};
+        #endif
+        #if VK_EXT_swapchain_maintenance1
+        VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT        swapchainMaintenance1Features_ = {};
+        #endif
+        #if VK_KHR_dynamic_rendering
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR             dynamicRenderingFeatures_   = {};
+        #endif
+        #if VK_KHR_push_descriptor
+        VkPhysicalDevicePushDescriptorPropertiesKHR             pushDescriptorProps_        = {};
+        #endif
+        #if VK_EXT_extended_dynamic_state
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT         extDynamicStateFeatures_    = {};
+        #endif
+        #if VK_EXT_extended_dynamic_state2
+        VkPhysicalDeviceExtendedDynamicState2FeaturesEXT        extDynamicState2Features_   = {};
+        #endif
+        #if VK_EXT_extended_dynamic_state3
+        VkPhysicalDeviceExtendedDynamicState3FeaturesEXT        extDynamicState3Features_   = {};
+        #endif
+        #if VK_EXT_mesh_shader
+        VkPhysicalDeviceMeshShaderFeaturesEXT                   meshShaderFeatures_         = {};
+        #endif
+        #if VK_EXT_texture_compression_astc_hdr
+        VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT    astcHDRFeatures_            = {};
+        #endif
+        #if VK_KHR_fragment_shading_rate
+        VkPhysicalDeviceFragmentShadingRateFeaturesKHR          shadingRateFeatures_        = {};
+        VkPhysicalDeviceFragmentShadingRatePropertiesKHR        shadingRateProps_           = {};
+        #endif
+        #if VK_KHR_multiview
+        VkPhysicalDeviceMultiviewFeaturesKHR                    multiviewFeatures_          = {};
+        VkPhysicalDeviceMultiviewPropertiesKHR                  multiviewProps_             = {};
+        #endif
+        #ifdef VK_VERSION_1_1
+        VkPhysicalDeviceSubgroupProperties                      subgroupProps_              = {};
+        #endif
+        #if VK_EXT_subgroup_size_control
+        VkPhysicalDeviceSubgroupSizeControlPropertiesEXT        subgroupSizeControlProps_   = {};
+        #endif
 
 };
 
@@ -25,8 +25,14 @@
 #include "RenderState/VKComputePSO.h"
 #include "Shader/VKShaderModulePool.h"
 #include "../../Platform/Debug.h"
+#include "../FormatTable.h"
 #include <LLGL/ImageFlags.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Log.h>
+#include <LLGL/Utils/ForRange.h>
 #include <limits>
+#include <algorithm>
+#include <string.h>
 
 #include <LLGL/Backend/Vulkan/NativeHandle.h>
 
@@ -35,6 +41,15 @@ namespace LLGL
 {
 
 
+// Default size of each chunk in the upload ring for buffer updates.
+static constexpr VkDeviceSize g_stagingChunkSize = 256*1024;
+
+// Number of pipelines that are added to the persistent pipeline cache before it is written to disk again.
+static constexpr std::uint32_t g_pipelineCacheFlushInterval = 64;
+
+// Key of the persistent pipeline cache entry. Vulkan uses a single device-wide pipeline cache for all pipelines.
+static constexpr std::uint64_t g_pipelineCacheStoreKey = 0;
+
 static bool IsDebugLayerEnabled(long flags)
 {
     return ((flags & RenderSystemFlags::DebugDevice) != 0);
@@ -46,10 +61,33 @@ static bool IsDebugBreakOnErrorEnabled(long flags)
     return ((flags & requiredFlags) == requiredFlags);
 }
 
+// Returns the adapter infos of all physical devices in the same order as they are selected by RenderSystemDescriptor::adapterIndex.
+static std::vector<AdapterInfo> GetVKAdapterInfos(VkInstance instance, VkPhysicalDevice activeDevice = VK_NULL_HANDLE)
+{
+    const std::vector<VkPhysicalDevice> physicalDevices = VKQueryPhysicalDevices(instance);
+    std::vector<AdapterInfo> adapters(physicalDevices.size());
+    for_range(i, physicalDevices.size())
+    {
+        VKPhysicalDevice::QueryAdapterInfo(physicalDevices[i], adapters[i]);
+        adapters[i].isActive = (physicalDevices[i] == activeDevice);
+    }
+    return adapters;
+}
+
+// Returns the index of the physical device that is selected by the render system descriptor; see SelectAdapterIndex().
+static int SelectPhysicalDeviceIndex(VkInstance instance, const RenderSystemDescriptor& renderSystemDesc)
+{
+    if (IsAdapterSelectedByID(renderSystemDesc))
+        return SelectAdapterIndex(renderSystemDesc, GetVKAdapterInfos(instance));
+    else
+        return renderSystemDesc.adapterIndex;
+}
+
 VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
     instance_              { vkDestroyInstance                                        },
     isDebugLayerEnabled_   { LLGL::IsDebugLayerEnabled(renderSystemDesc.flags)        },
-    isBreakOnErrorEnabled_ { LLGL::IsDebugBreakOnErrorEnabled(renderSystemDesc.flags) }
+    isBreakOnErrorEnabled_ { LLGL::IsDebugBreakOnErrorEnabled(renderSystemDesc.flags) },
+    isHeadless_            { ((renderSystemDesc.flags & RenderSystemFlags::Headless) != 0) }
 {
     /* Extract optional renderer configuartion */
     auto* rendererConfigVK = GetRendererConfiguration<RendererConfigurationVulkan>(renderSystemDesc);
@@ -64,7 +102,7 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         if (isDebugLayerEnabled_)
             CreateDebugReportCallback();
         VKLoadInstanceExtensions(instance_);
-        if (!PickPhysicalDevice(preferredDeviceFlags, customNativeHandle->physicalDevice))
+        if (!PickPhysicalDevice(preferredDeviceFlags, SelectPhysicalDeviceIndex(instance_, renderSystemDesc), customNativeHandle->physicalDevice))
             return;
         CreateLogicalDevice(customNativeHandle->device);
     }
@@ -75,7 +113,7 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         if (isDebugLayerEnabled_)
             CreateDebugReportCallback();
         VKLoadInstanceExtensions(instance_);
-        if (!PickPhysicalDevice(preferredDeviceFlags))
+        if (!PickPhysicalDevice(preferredDeviceFlags, SelectPhysicalDeviceIndex(instance_, renderSystemDesc)))
             return;
         CreateLogicalDevice();
     }
@@ -88,13 +126,49 @@ VKRenderSystem::VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc) :
         device_,
         physicalDevice_.GetMemoryProperties(),
         (rendererConfigVK != nullptr ? rendererConfigVK->minDeviceMemoryAllocationSize : 1024*1024),
-        (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false)
+        (rendererConfigVK != nullptr ? rendererConfigVK->reduceDeviceMemoryFragmentation : false),
+        renderSystemDesc.debugger
     );
+
+    /* Create upload ring for buffer updates and command queue interface that submits them */
+    stagingBufferPool_ = MakeUnique<VKStagingBufferPool>(device_, *deviceMemoryMngr_, g_stagingChunkSize);
+    const float timestampPeriod = physicalDevice_.GetProperties().limits.timestampPeriod;
+    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue(), *stagingBufferPool_, timestampPeriod);
+
+    /* Create command queues for dedicated compute and transfer queue families if available */
+    if (VkQueue computeQueue = device_.GetVkComputeQueue())
+        computeQueue_ = MakeUnique<VKCommandQueue>(device_, computeQueue, *stagingBufferPool_, timestampPeriod, /*isPrimaryQueue:*/ false);
+    if (VkQueue transferQueue = device_.GetVkTransferQueue())
+        copyQueue_ = MakeUnique<VKCommandQueue>(device_, transferQueue, *stagingBufferPool_, timestampPeriod, /*isPrimaryQueue:*/ false);
+
+    /* Create dedicated thread for presentations if requested; Command buffers are still submitted on the calling thread */
+    if ((renderSystemDesc.flags & RenderSystemFlags::SubmissionThread) != 0)
+    {
+        submissionThread_ = MakeUnique<SubmissionThread>();
+        commandQueue_->SetSubmissionThread(submissionThread_.get());
+    }
+
+    /* Bind persistent pipeline cache store to the selected device; the cache itself is loaded with the first pipeline */
+    pipelineCacheStore_.SetDirectory(renderSystemDesc.pipelineCacheDirectory);
+    if (pipelineCacheStore_.IsEnabled())
+    {
+        RendererInfo info;
+        physicalDevice_.QueryRendererInfo(info);
+        pipelineCacheStore_.Open(info.pipelineCacheID);
+        if (pipelineCacheStore_.IsOpen())
+            VKShaderModulePool::Get().SetPipelineCacheStore(&pipelineCacheStore_);
+    }
 }
 
 VKRenderSystem::~VKRenderSystem()
 {
+    if (submissionThread_)
+        submissionThread_->Flush();
+    FlushPersistentPipelineCache(true);
+    if (stagingBufferPool_)
+        stagingBufferPool_->FlushAndWait();
     device_.WaitIdle();
+    deferredReleases_.Clear();
     VKShaderModulePool::Get().Clear();
     VKPipelineLayout::ReleaseDefault();
 }
@@ -103,7 +177,9 @@ VKRenderSystem::~VKRenderSystem()
 
 SwapChain* VKRenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
 {
-    return swapChains_.emplace<VKSwapChain>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface, GetRendererInfo());
+    if (isHeadless_)
+        LLGL_TRAP("cannot create swap-chain for headless render system; see RenderSystemFlags::Headless");
+    return swapChains_.emplace<VKSwapChain>(instance_, physicalDevice_, device_, *deviceMemoryMngr_, swapChainDesc, surface, GetRendererInfo(), submissionThread_.get());
 }
 
 void VKRenderSystem::Release(SwapChain& swapChain)
@@ -118,11 +194,48 @@ CommandQueue* VKRenderSystem::GetCommandQueue()
     return commandQueue_.get();
 }
 
+CommandQueue* VKRenderSystem::GetCommandQueue(const CommandQueueType type)
+{
+    /* Fall back to the graphics queue if there is no dedicated queue family for the requested type */
+    switch (type)
+    {
+        case CommandQueueType::Compute:
+            if (computeQueue_)
+                return computeQueue_.get();
+            break;
+        case CommandQueueType::Copy:
+            if (copyQueue_)
+                return copyQueue_.get();
+            break;
+        default:
+            break;
+    }
+    return commandQueue_.get();
+}
+
 /* ----- Command buffers ----- */
 
 CommandBuffer* VKRenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
 {
-    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, device_.GetVkQueue(), device_.GetQueueFamilyIndices(), commandBufferDesc);
+    /* Select queue and queue family for this command buffer; secondary command buffers are always executed by the graphics queue */
+    VKCommandQueue* commandQueue        = commandQueue_.get();
+    std::uint32_t   queueFamilyIndex    = device_.GetQueueFamilyIndices().graphicsFamily;
+
+    if ((commandBufferDesc.flags & CommandBufferFlags::Secondary) == 0)
+    {
+        if (commandBufferDesc.queueType == CommandQueueType::Compute && computeQueue_)
+        {
+            commandQueue        = computeQueue_.get();
+            queueFamilyIndex    = device_.GetComputeQueueFamily();
+        }
+        else if (commandBufferDesc.queueType == CommandQueueType::Copy && copyQueue_)
+        {
+            commandQueue        = copyQueue_.get();
+            queueFamilyIndex    = device_.GetTransferQueueFamily();
+        }
+    }
+
+    return commandBuffers_.emplace<VKCommandBuffer>(physicalDevice_, device_, *commandQueue, device_.GetQueueFamilyIndices(), queueFamilyIndex, commandBufferDesc);
 }
 
 void VKRenderSystem::Release(CommandBuffer& commandBuffer)
@@ -140,45 +253,32 @@ static VkBufferUsageFlags GetStagingVkBufferUsageFlags(long cpuAccessFlags)
         return VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
 }
 
-Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
+// Returns true if the specified buffer is frequently written by the CPU and never read back, so it can live in device-local host-visible memory.
+static bool IsDirectWriteBufferCandidate(const BufferDescriptor& bufferDesc)
 {
-    RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
-
-    /* Create staging buffer */
-    VkBufferCreateInfo stagingCreateInfo;
-    BuildVkBufferCreateInfo(
-        stagingCreateInfo,
-        static_cast<VkDeviceSize>(bufferDesc.size),
-        GetStagingVkBufferUsageFlags(bufferDesc.cpuAccessFlags)
-    );
-
-    VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, bufferDesc.size);
-
-    /* Create primary buffer object */
-    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
+    return ((bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0 && (bufferDesc.cpuAccessFlags & CPUAccessFlags::Read) == 0);
+}
 
-    /* Allocate device memory */
-    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
-        bufferVK->GetDeviceBuffer().GetRequirements(),
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
-    );
-    bufferVK->BindMemoryRegion(device_, memoryRegion);
+Buffer* VKRenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    CollectDeferredReleases();
+    VKBuffer* bufferVK = CreateBufferInternal(bufferDesc, initialData, nullptr);
+    CheckMemoryBudget();
+    return bufferVK;
+}
 
-    /* Copy staging buffer into hardware buffer */
-    device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK->GetVkBuffer(), static_cast<VkDeviceSize>(bufferDesc.size));
+void VKRenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    CollectDeferredReleases();
+    /* Record the staging copies of all buffers into a single command buffer and submit them at once */
+    UploadBatch batch;
+    BeginUploadBatch(batch);
 
-    if (bufferDesc.cpuAccessFlags != 0 || (bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0)
-    {
-        /* Store ownership of staging buffer */
-        bufferVK->TakeStagingBuffer(std::move(stagingBuffer));
-    }
-    else
-    {
-        /* Release staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
-    }
+    for_range(i, bufferDescs.size())
+        outBuffers[i] = CreateBufferInternal(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr), &batch);
 
-    return bufferVK;
+    SubmitUploadBatch(batch);
+    CheckMemoryBudget();
 }
 
 BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
@@ -189,11 +289,23 @@ BufferArray* VKRenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer*
 
 void VKRenderSystem::Release(Buffer& buffer)
 {
-    /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
-    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
-    bufferVK.GetDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
-    bufferVK.GetStagingDeviceBuffer().ReleaseMemoryRegion(*deviceMemoryMngr_);
-    buffers_.erase(&buffer);
+    {
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        DeferReleaseBuffer(SignalReleaseSerial(), LLGL_CAST(VKBuffer&, buffer));
+    }
+    CollectDeferredReleases();
+}
+
+void VKRenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    /* Submit release fences only once for all buffers */
+    {
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        const std::uint64_t releaseSerial = SignalReleaseSerial();
+        for (Buffer* buffer : buffers)
+            DeferReleaseBuffer(releaseSerial, LLGL_CAST(VKBuffer&, *buffer));
+    }
+    CollectDeferredReleases();
 }
 
 void VKRenderSystem::Release(BufferArray& bufferArray)
@@ -205,31 +317,28 @@ void VKRenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const voi
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
-    if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
+    if (bufferVK.IsDirectWrite())
+    {
+        /* Write input data directly into device-local host-visible memory */
+        if (void* dst = bufferVK.Map(device_, CPUAccess::WriteOnly, offset, dataSize))
+        {
+            ::memcpy(dst, data, static_cast<std::size_t>(dataSize));
+            bufferVK.Unmap(device_);
+        }
+    }
+    else if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy input data to staging buffer memory */
         device_.WriteBuffer(bufferVK.GetStagingDeviceBuffer(), data, dataSize, offset);
 
-        /* Copy staging buffer into hardware buffer */
+        /* Copy staging buffer into hardware buffer after all batched uploads */
+        stagingBufferPool_->Flush();
         device_.CopyBuffer(bufferVK.GetStagingVkBuffer(), bufferVK.GetVkBuffer(), dataSize, offset, offset);
     }
     else
     {
-        /* Create staging buffer */
-        VkBufferCreateInfo stagingCreateInfo;
-        BuildVkBufferCreateInfo(
-            stagingCreateInfo,
-            dataSize,
-            (VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT)
-        );
-
-        VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, data, dataSize);
-
-        /* Copy staging buffer into hardware buffer */
-        device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK.GetVkBuffer(), dataSize, 0, offset);
-
-        /* Release device memory region of staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        /* Write data into upload ring; the copy is submitted with the next command buffer */
+        stagingBufferPool_->WriteStaged(bufferVK.GetVkBuffer(), offset, data, dataSize);
     }
 }
 
@@ -237,6 +346,9 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
 
+    /* Submit batched uploads first, so the read observes all previous buffer writes */
+    stagingBufferPool_->Flush();
+
     if (bufferVK.GetStagingVkBuffer() != VK_NULL_HANDLE)
     {
         /* Copy hardware buffer into staging buffer */
@@ -271,21 +383,30 @@ void VKRenderSystem::ReadBuffer(Buffer& buffer, std::uint64_t offset, void* data
 void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    stagingBufferPool_->Flush();
     return bufferVK.Map(device_, access, 0, bufferVK.GetSize());
 }
 
 void* VKRenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    stagingBufferPool_->Flush();
     return bufferVK.Map(device_, access, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(length));
 }
 
 void VKRenderSystem::UnmapBuffer(Buffer& buffer)
 {
     auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    stagingBufferPool_->Flush();
     bufferVK.Unmap(device_);
 }
 
+void VKRenderSystem::FlushMappedRange(Buffer& buffer, std::uint64_t offset, std::uint64_t length)
+{
+    auto& bufferVK = LLGL_CAST(VKBuffer&, buffer);
+    bufferVK.FlushMappedRange(device_, static_cast<VkDeviceSize>(offset), static_cast<VkDeviceSize>(length));
+}
+
 /* ----- Textures ----- */
 
 // Tries to find an optimal initial VkImageLayout for the specified texture format and binding flags
@@ -311,164 +432,85 @@ static VkImageLayout FindOptimalInitialVkImageLayout(Format format, long bindFla
 
 Texture* VKRenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
 {
-    /* Determine size of image for staging buffer */
-    const std::uint32_t imageSize       = NumMipTexels(textureDesc, 0);
-    const std::size_t   initialDataSize = GetMemoryFootprint(textureDesc.format, imageSize);
-    const std::uint32_t bytesPerPixel   = static_cast<std::uint32_t>(GetMemoryFootprint(textureDesc.format, 1));
-    const auto&         formatAttribs   = GetFormatAttribs(textureDesc.format);
-    const Extent3D      extent          = CalcTextureExtent(textureDesc.type, textureDesc.extent, textureDesc.arrayLayers);
-
-    const bool isCompressed = ((formatAttribs.flags & FormatFlags::IsCompressed) != 0);
-
-    /* Set up initial image data */
-    const void* initialData = nullptr;
-    DynamicByteArray intermediateData;
+    CollectDeferredReleases();
+    VKTexture* textureVK = CreateTextureInternal(textureDesc, initialImage, nullptr);
+    CheckMemoryBudget();
+    return textureVK;
+}
 
-    std::uint32_t srcRowStride = extent.width * bytesPerPixel;
+void VKRenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    CollectDeferredReleases();
+    /* Record the initial uploads and layout transitions of all textures into a single command buffer and submit them at once */
+    UploadBatch batch;
+    BeginUploadBatch(batch);
 
-    if (initialImage != nullptr)
+    for_range(i, textureDescs.size())
     {
-        const ImageView& srcImageView = *initialImage;
-
-        /* Check if image data must be converted */
-        if (!isCompressed)
-        {
-            const std::uint32_t srcBytesPerPixel = static_cast<std::uint32_t>(GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1));
-            srcRowStride = (srcImageView.rowStride > 0 ? srcImageView.rowStride : extent.width * srcBytesPerPixel);
-
-            /* Check if amount of padding memory is small enough to justify a larger GPU buffer upload */
-            bool rowStrideNeedsConversion = (srcImageView.rowStride != 0 && srcImageView.rowStride != extent.width * srcBytesPerPixel);
-            if (rowStrideNeedsConversion)
-            {
-                const std::size_t dataSizeWithPadding = srcImageView.dataSize / srcBytesPerPixel * bytesPerPixel;
-
-                const bool isPaddingLessThan50Percent   = (dataSizeWithPadding < initialDataSize + initialDataSize/2);
-                const bool isRowStridePixelSizeAligned  = (srcImageView.rowStride % bytesPerPixel == 0);
-
-                if (isRowStridePixelSizeAligned && isPaddingLessThan50Percent)
-                    rowStrideNeedsConversion = false;
-            }
+        const ImageView* initialImage = (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr);
+        outTextures[i] = CreateTextureInternal(textureDescs[i], initialImage, &batch);
+    }
 
-            if (srcImageView.format != formatAttribs.format ||
-                srcImageView.dataType != formatAttribs.dataType ||
-                rowStrideNeedsConversion)
-            {
-                /* Convert image format (will be null if no conversion is necessary) */
-                intermediateData = ConvertImageBuffer(srcImageView, formatAttribs.format, formatAttribs.dataType, extent, LLGL_MAX_THREAD_COUNT);
-                srcRowStride = extent.width * bytesPerPixel;
-            }
-        }
+    SubmitUploadBatch(batch);
+    CheckMemoryBudget();
+}
 
-        if (intermediateData)
-        {
-            /* Validate that source image data was large enough so conversion is valid, then use temporary image as source for initial data */
-            const std::size_t srcImageDataSize = GetMemoryFootprint(initialImage->format, initialImage->dataType, imageSize);
-            LLGL_ASSERT(initialImage->dataSize >= srcImageDataSize);
-            initialData = intermediateData.get();
-        }
-        else
-        {
-            /* Validate that image data is large enough, then use input data as source for initial data */
-            LLGL_ASSERT(initialImage->dataSize >= initialDataSize);
-            initialData = initialImage->data;
-        }
-    }
-    else if ((textureDesc.miscFlags & MiscFlags::NoInitialData) == 0)
+void VKRenderSystem::Release(Texture& texture)
+{
     {
-        /* Allocate default image data */
-        const auto& formatAttribs = GetFormatAttribs(textureDesc.format);
-        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
-            intermediateData = GenerateImageBuffer(formatAttribs.format, formatAttribs.dataType, imageSize, textureDesc.clearValue.color);
-        else
-            intermediateData = DynamicByteArray{ initialDataSize, UninitializeTag{} };
-
-        initialData = intermediateData.get();
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        DeferReleaseTexture(SignalReleaseSerial(), LLGL_CAST(VKTexture&, texture));
     }
+    CollectDeferredReleases();
+}
 
-    /* Create device texture */
-    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
-
-    if (initialData != nullptr)
+void VKRenderSystem::Release(const ArrayView<Texture*>& textures)
+{
+    /* Submit release fences only once for all textures */
     {
-        /* Create staging buffer */
-        VkBufferCreateInfo stagingCreateInfo;
-        BuildVkBufferCreateInfo(
-            stagingCreateInfo,
-            initialDataSize,
-            VK_BUFFER_USAGE_TRANSFER_SRC_BIT
-        );
-
-        VKDeviceBuffer stagingBuffer =
-        (
-            isCompressed
-                ? CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, initialDataSize)
-                : CreateTextureStagingBufferAndInitialize(stagingCreateInfo, initialData, initialDataSize, extent, srcRowStride, bytesPerPixel)
-        );
-
-        /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
-        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
-        {
-            const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
-
-            textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
-
-            /* Determine row length (in pixels) for image upload with padding */
-            const std::uint32_t rowLength = (bytesPerPixel > 0 ? srcRowStride / bytesPerPixel : 0);
-
-            context_.CopyBufferToImage(
-                stagingBuffer.GetVkBuffer(),
-                textureVK->GetVkImage(),
-                textureVK->GetVkFormat(),
-                VkOffset3D{ 0, 0, 0 },
-                textureVK->GetVkExtent(),
-                subresource,
-                rowLength
-            );
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        const std::uint64_t releaseSerial = SignalReleaseSerial();
+        for (Texture* texture : textures)
+            DeferReleaseTexture(releaseSerial, LLGL_CAST(VKTexture&, *texture));
+    }
+    CollectDeferredReleases();
+}
 
-            textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true);
+// Returns the image data to upload for the specified texture region and converts it into the texture format if necessary.
+static const void* GetVkTextureUploadData(
+    const ImageView&    srcImageView,
+    Format              format,
+    const Extent3D&     extent,
+    DynamicByteArray&   intermediateData,
+    std::uint32_t&      outSrcRowStride)
+{
+    const std::uint32_t imageSize       = extent.width * extent.height * extent.depth;
+    const std::size_t   imageDataSize   = GetMemoryFootprint(format, imageSize);
+    const std::uint32_t bytesPerPixel   = static_cast<std::uint32_t>(GetMemoryFootprint(format, 1));
 
-            /* Generate MIP-maps if enabled */
-            if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
-            {
-                context_.GenerateMips(
-                    textureVK->GetVkImage(),
-                    textureVK->GetVkFormat(),
-                    textureVK->GetVkExtent(),
-                    subresource
-                );
-            }
-        }
-        FlushCommandBuffer(cmdBuffer);
+    /* Check if image data must be converted */
+    outSrcRowStride = srcImageView.rowStride > 0 ? srcImageView.rowStride : extent.width * bytesPerPixel;
 
-        /* Release staging buffer */
-        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
-    }
-    else
+    const auto& formatAttribs = FormatTable::GetAttribs(format);
+    if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
+        (formatAttribs.format != srcImageView.format || formatAttribs.dataType != srcImageView.dataType))
     {
-        /* Initialize image layout */
-        const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
-        if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
-        {
-            VkCommandBuffer cmdBuffer = AllocCommandBuffer();
-            {
-                textureVK->TransitionImageLayout(context_, initialLayout, true);
-            }
-            FlushCommandBuffer(cmdBuffer);
-        }
+        /* Convert image format (will be null if no conversion is necessary) */
+        intermediateData = ConvertImageBuffer(srcImageView, formatAttribs.format, formatAttribs.dataType, extent, LLGL_MAX_THREAD_COUNT);
+        outSrcRowStride = extent.width * bytesPerPixel;
     }
 
-    /* Create primary image view for texture */
-    textureVK->CreateInternalImageView(device_);
-
-    return textureVK;
-}
+    if (intermediateData)
+    {
+        /* Validate that source image data was large enough so conversion is valid, then use temporary buffer as source for initial data */
+        const std::size_t srcImageDataSize = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, imageSize);
+        LLGL_ASSERT(srcImageView.dataSize >= srcImageDataSize);
+        return intermediateData.get();
+    }
 
-void VKRenderSystem::Release(Texture& texture)
-{
-    /* Release device memory region, then release texture object */
-    auto& textureVK = LLGL_CAST(VKTexture&, texture);
-    deviceMemoryMngr_->Release(textureVK.GetMemoryRegion());
-    textures_.erase(&texture);
+    /* Validate that image data is large enough, then use input data as source for initial data */
+    LLGL_ASSERT(srcImageView.dataSize >= imageDataSize);
+    return srcImageView.data;
 }
 
 void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
@@ -477,43 +519,18 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
 
     /* Determine size of image for staging buffer */
     const TextureSubresource&   subresource     = textureRegion.subresource;
-    const Offset3D              offset          = CalcTextureOffset(textureVK.GetType(), textureRegion.offset, subresource.baseArrayLayer);
     const Extent3D              extent          = CalcTextureExtent(textureVK.GetType(), textureRegion.extent, subresource.numArrayLayers);
     const Format                format          = VKTypes::Unmap(textureVK.GetVkFormat());
 
     VkImage                     image           = textureVK.GetVkImage();
     const std::uint32_t         imageSize       = extent.width * extent.height * extent.depth;
-    const void*                 imageData       = nullptr;
     const VkDeviceSize          imageDataSize   = static_cast<VkDeviceSize>(GetMemoryFootprint(format, imageSize));
     const std::uint32_t         bytesPerPixel   = static_cast<std::uint32_t>(GetMemoryFootprint(format, 1));
 
     /* Check if image data must be converted */
     DynamicByteArray intermediateData;
-
-    std::uint32_t srcRowStride = srcImageView.rowStride > 0 ? srcImageView.rowStride : extent.width * bytesPerPixel;
-
-    const auto& formatAttribs = GetFormatAttribs(format);
-    if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
-        (formatAttribs.format != srcImageView.format || formatAttribs.dataType != srcImageView.dataType))
-    {
-        /* Convert image format (will be null if no conversion is necessary) */
-        intermediateData = ConvertImageBuffer(srcImageView, formatAttribs.format, formatAttribs.dataType, extent, LLGL_MAX_THREAD_COUNT);
-        srcRowStride = extent.width * bytesPerPixel;
-    }
-
-    if (intermediateData)
-    {
-        /* Validate that source image data was large enough so conversion is valid, then use temporary buffer as source for initial data */
-        const std::size_t srcImageDataSize = GetMemoryFootprint(srcImageView.format, srcImageView.dataType, imageSize);
-        LLGL_ASSERT(srcImageView.dataSize >= srcImageDataSize);
-        imageData = intermediateData.get();
-    }
-    else
-    {
-        /* Validate that image data is large enough, then use input data as source for initial data */
-        LLGL_ASSERT(srcImageView.dataSize >= static_cast<std::size_t>(imageDataSize));
-        imageData = srcImageView.data;
-    }
+    std::uint32_t srcRowStride = 0;
+    const void* imageData = GetVkTextureUploadData(srcImageView, format, extent, intermediateData, srcRowStride);
 
     /* Create staging buffer */
     VkBufferCreateInfo stagingCreateInfo;
@@ -531,6 +548,7 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     );
 
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
+    std::unique_lock<std::recursive_mutex> queueLock = device_.LockQueue();
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
         VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, subresource, true);
@@ -553,6 +571,42 @@ void VKRenderSystem::WriteTexture(Texture& texture, const TextureRegion& texture
     stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
 }
 
+void VKRenderSystem::WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence)
+{
+    /* Stage all uploads from the coarsest to the finest MIP-map into the upload ring, so they are batched into a single transfer */
+    for (std::uint32_t uploadIndex : GetTextureUploadOrder(numUploads, uploads))
+    {
+        const TextureUploadDescriptor& upload = uploads[uploadIndex];
+        auto& textureVK = LLGL_CAST(VKTexture&, *upload.texture);
+
+        const TextureSubresource&   subresource     = upload.region.subresource;
+        const Extent3D              extent          = CalcTextureExtent(textureVK.GetType(), upload.region.extent, subresource.numArrayLayers);
+        const Format                format          = VKTypes::Unmap(textureVK.GetVkFormat());
+        const std::uint32_t         imageSize       = extent.width * extent.height * extent.depth;
+        const VkDeviceSize          imageDataSize   = static_cast<VkDeviceSize>(GetMemoryFootprint(format, imageSize));
+        const std::uint32_t         bytesPerPixel   = static_cast<std::uint32_t>(GetMemoryFootprint(format, 1));
+
+        DynamicByteArray intermediateData;
+        std::uint32_t srcRowStride = 0;
+        const void* imageData = GetVkTextureUploadData(upload.imageView, format, extent, intermediateData, srcRowStride);
+
+        stagingBufferPool_->WriteStagedImage(
+            textureVK,
+            upload.region,
+            extent,
+            imageData,
+            imageDataSize,
+            srcRowStride,
+            (IsCompressedFormat(format) ? 0 : bytesPerPixel)
+        );
+    }
+
+    /* Submit transfer batch without waiting and signal the fence once the primary queue has passed it */
+    stagingBufferPool_->Flush();
+    if (fence != nullptr)
+        commandQueue_->Submit(*fence);
+}
+
 void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureRegion, const MutableImageView& dstImageView)
 {
     auto& textureVK = LLGL_CAST(VKTexture&, texture);
@@ -562,7 +616,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     const Offset3D              offset          = CalcTextureOffset(textureVK.GetType(), textureRegion.offset, subresource.baseArrayLayer);
     const Extent3D              extent          = CalcTextureExtent(textureVK.GetType(), textureRegion.extent, subresource.numArrayLayers);
     const Format                format          = VKTypes::Unmap(textureVK.GetVkFormat());
-    const FormatAttributes&     formatAttribs   = GetFormatAttribs(format);
+    const FormatAttributes&     formatAttribs   = FormatTable::GetAttribs(format);
 
     VkImage                     image           = textureVK.GetVkImage();
     const std::size_t           imageNumTexels  = extent.width * extent.height * extent.depth;
@@ -574,6 +628,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     VKDeviceBuffer stagingBuffer = CreateStagingBuffer(stagingCreateInfo);
 
     /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state */
+    std::unique_lock<std::recursive_mutex> queueLock = device_.LockQueue();
     VkCommandBuffer cmdBuffer = AllocCommandBuffer();
     {
         VkImageLayout oldLayout = textureVK.TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, subresource, true);
@@ -591,6 +646,7 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
         textureVK.TransitionImageLayout(context_, oldLayout, subresource, true);
     }
     FlushCommandBuffer(cmdBuffer);
+    queueLock.unlock();
 
     /* Map staging buffer to CPU memory space */
     if (VKDeviceMemoryRegion* region = stagingBuffer.GetMemoryRegion())
@@ -610,6 +666,149 @@ void VKRenderSystem::ReadTexture(Texture& texture, const TextureRegion& textureR
     stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
 }
 
+/* ----- Placement Heaps ----- */
+
+PlacementHeap* VKRenderSystem::CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc)
+{
+    /* Select memory type that is compatible with both color and depth-stencil attachments */
+    TextureDescriptor colorTexDesc;
+    {
+        colorTexDesc.format     = Format::RGBA8UNorm;
+        colorTexDesc.bindFlags  = BindFlags::Sampled | BindFlags::ColorAttachment;
+        colorTexDesc.mipLevels  = 1;
+    }
+    TextureDescriptor depthTexDesc;
+    {
+        depthTexDesc.format     = Format::D32Float;
+        depthTexDesc.bindFlags  = BindFlags::DepthStencilAttachment;
+        depthTexDesc.mipLevels  = 1;
+    }
+    const std::uint32_t memoryTypeBits =
+    (
+        VKTexture::QueryMemoryRequirements(device_, colorTexDesc).memoryTypeBits &
+        VKTexture::QueryMemoryRequirements(device_, depthTexDesc).memoryTypeBits
+    );
+    return placementHeaps_.emplace<VKPlacementHeap>(*deviceMemoryMngr_, placementHeapDesc, memoryTypeBits);
+}
+
+void VKRenderSystem::Release(PlacementHeap& placementHeap)
+{
+    /* Release serials are collected in order, so the heap memory outlives all placed textures that have been released before */
+    {
+        std::lock_guard<std::mutex> guard{ releaseMutex_ };
+        deferredReleases_.EnqueueObject(SignalReleaseSerial(), placementHeaps_.extract(&placementHeap));
+    }
+    CollectDeferredReleases();
+}
+
+MemoryRequirements VKRenderSystem::GetTextureMemoryRequirements(const TextureDescriptor& textureDesc)
+{
+    const VkMemoryRequirements requirementsVK = VKTexture::QueryMemoryRequirements(device_, textureDesc);
+    MemoryRequirements requirements;
+    {
+        requirements.size       = requirementsVK.size;
+        requirements.alignment  = requirementsVK.alignment;
+    }
+    return requirements;
+}
+
+Texture* VKRenderSystem::CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc)
+{
+    auto& placementHeapVK = LLGL_CAST(VKPlacementHeap&, placementHeap);
+    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc, placementHeapVK.GetMemoryRegion(), offset);
+
+    /* Initialize image layout; placed textures have no initial data */
+    const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
+    if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        std::unique_lock<std::recursive_mutex> queueLock = device_.LockQueue();
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            textureVK->TransitionImageLayout(context_, initialLayout, true);
+        }
+        FlushCommandBuffer(cmdBuffer);
+    }
+
+    /* Create primary image view for texture */
+    textureVK->CreateInternalImageView(device_);
+
+    return textureVK;
+}
+
+bool VKRenderSystem::ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle)
+{
+    VKExternalMemory* externalMemory = nullptr;
+    if (resource.GetResourceType() == ResourceType::Buffer)
+        externalMemory = LLGL_CAST(VKBuffer&, resource).GetExternalMemory();
+    else if (resource.GetResourceType() == ResourceType::Texture)
+        externalMemory = LLGL_CAST(VKTexture&, resource).GetExternalMemory();
+    return (externalMemory != nullptr && externalMemory->Export(device_, outHandle));
+}
+
+Texture* VKRenderSystem::ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle)
+{
+    if (!VKExternalMemory::IsSupported() || sharedHandle.type != VKExternalMemory::GetSharedHandleType())
+        return nullptr;
+
+    CollectDeferredReleases();
+
+    /* Imported images must be created with the same external handle type as the exported image */
+    TextureDescriptor sharedTextureDesc = textureDesc;
+    sharedTextureDesc.miscFlags |= MiscFlags::Shared;
+    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, sharedTextureDesc, nullptr, 0, &sharedHandle);
+
+    /* Initialize image layout; the content is owned by the exporting device */
+    const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
+    if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        std::unique_lock<std::recursive_mutex> queueLock = device_.LockQueue();
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            textureVK->TransitionImageLayout(context_, initialLayout, true);
+        }
+        FlushCommandBuffer(cmdBuffer);
+    }
+
+    /* Create primary image view for texture */
+    textureVK->CreateInternalImageView(device_);
+
+    return textureVK;
+}
+
+Buffer* VKRenderSystem::ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle)
+{
+    if (!VKExternalMemory::IsSupported() || sharedHandle.type != VKExternalMemory::GetSharedHandleType())
+        return nullptr;
+
+    CollectDeferredReleases();
+
+    /* Imported buffers must be created with the same external handle type as the exported buffer */
+    BufferDescriptor sharedBufferDesc = bufferDesc;
+    sharedBufferDesc.miscFlags |= MiscFlags::Shared;
+    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, sharedBufferDesc);
+    bufferVK->AllocateExternalMemory(*deviceMemoryMngr_, &sharedHandle);
+
+    /* Mapping imported buffers goes through a staging buffer just like regular device-local buffers */
+    if (bufferDesc.cpuAccessFlags != 0)
+    {
+        VkBufferCreateInfo stagingCreateInfo;
+        BuildVkBufferCreateInfo(
+            stagingCreateInfo,
+            static_cast<VkDeviceSize>(bufferDesc.size),
+            GetStagingVkBufferUsageFlags(bufferDesc.cpuAccessFlags)
+        );
+        bufferVK->TakeStagingBuffer(CreateStagingBuffer(stagingCreateInfo));
+    }
+
+    return bufferVK;
+}
+
+bool VKRenderSystem::ExportSharedFence(Fence& fence, SharedResourceHandle& outHandle)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    return fenceVK.Export(device_, outHandle);
+}
+
 /* ----- Sampler States ---- */
 
 Sampler* VKRenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
@@ -656,7 +855,7 @@ void VKRenderSystem::Release(RenderPass& renderPass)
 
 RenderTarget* VKRenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
 {
-    return renderTargets_.emplace<VKRenderTarget>(device_, *deviceMemoryMngr_, renderTargetDesc);
+    return renderTargets_.emplace<VKRenderTarget>(device_, *deviceMemoryMngr_, renderTargetDesc, GetRenderingCaps().limits.shadingRateImageTileSize);
 }
 
 void VKRenderSystem::Release(RenderTarget& renderTarget)
@@ -672,6 +871,12 @@ Shader* VKRenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
     return shaders_.emplace<VKShader>(device_, shaderDesc);
 }
 
+void VKRenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    for_range(i, shaderDescs.size())
+        outShaders[i] = CreateShader(shaderDescs[i]);
+}
+
 void VKRenderSystem::Release(Shader& shader)
 {
     shaders_.erase(&shader);
@@ -681,7 +886,7 @@ void VKRenderSystem::Release(Shader& shader)
 
 PipelineLayout* VKRenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
 {
-    return pipelineLayouts_.emplace<VKPipelineLayout>(device_, pipelineLayoutDesc);
+    return pipelineLayouts_.emplace<VKPipelineLayout>(physicalDevice_, device_, pipelineLayoutDesc);
 }
 
 void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
@@ -689,89 +894,510 @@ void VKRenderSystem::Release(PipelineLayout& pipelineLayout)
     pipelineLayouts_.erase(&pipelineLayout);
 }
 
-/* ----- Pipeline Caches ----- */
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* VKRenderSystem::CreatePipelineCache(const Blob& initialBlob)
+{
+    return pipelineCaches_.emplace<VKPipelineCache>(device_, initialBlob);
+}
+
+void VKRenderSystem::Release(PipelineCache& pipelineCache)
+{
+    pipelineCaches_.erase(&pipelineCache);
+}
+
+/* ----- Pipeline States ----- */
+
+PipelineState* VKRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    PipelineState* pipelineState = pipelineStates_.emplace<VKGraphicsPSO>(
+        device_,
+        (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr),
+        pipelineStateDesc,
+        graphicsPipelineLimits_,
+        GetPipelineCacheOrPersistent(pipelineCache)
+    );
+    FlushPersistentPipelineCache();
+    return pipelineState;
+}
+
+PipelineState* VKRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
+{
+    PipelineState* pipelineState = pipelineStates_.emplace<VKComputePSO>(device_, pipelineStateDesc, GetPipelineCacheOrPersistent(pipelineCache));
+    FlushPersistentPipelineCache();
+    return pipelineState;
+}
+
+void VKRenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    /* Construct all PSOs with deferred native creation first, so they can be created with a single call to 'vkCreateGraphicsPipelines' */
+    std::vector<VKGraphicsPipelineCreateInfo> createInfos(pipelineStateDescs.size());
+    std::vector<VKGraphicsPSO*> batchedPipelineStates;
+    batchedPipelineStates.reserve(pipelineStateDescs.size());
+
+    const RenderPass* defaultRenderPass = (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr);
+    PipelineCache* pipelineCacheVK = nullptr;
+
+    for_range(i, pipelineStateDescs.size())
+    {
+        const GraphicsPipelineDescriptor& pipelineStateDesc = pipelineStateDescs[i];
+        pipelineCacheVK = GetPipelineCacheOrPersistent(pipelineCache);
+        if ((pipelineStateDesc.flags & PipelineStateFlags::AsyncCompilation) != 0)
+        {
+            /* Asynchronous PSOs are still compiled individually on a worker thread */
+            outPipelineStates[i] = pipelineStates_.emplace<VKGraphicsPSO>(device_, defaultRenderPass, pipelineStateDesc, graphicsPipelineLimits_, pipelineCacheVK);
+        }
+        else
+        {
+            VKGraphicsPSO* pipelineStateVK = pipelineStates_.emplace<VKGraphicsPSO>(
+                device_,
+                defaultRenderPass,
+                pipelineStateDesc,
+                graphicsPipelineLimits_,
+                pipelineCacheVK,
+                &(createInfos[batchedPipelineStates.size()])
+            );
+            batchedPipelineStates.push_back(pipelineStateVK);
+            outPipelineStates[i] = pipelineStateVK;
+        }
+    }
+
+    VKGraphicsPSO::CreateVkPipelines(device_, batchedPipelineStates.size(), batchedPipelineStates.data(), createInfos.data(), pipelineCacheVK);
+    FlushPersistentPipelineCache();
+}
+
+void VKRenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    /* Construct all PSOs with deferred native creation first, so they can be created with a single call to 'vkCreateComputePipelines' */
+    std::vector<VKComputePipelineCreateInfo> createInfos(pipelineStateDescs.size());
+    std::vector<VKComputePSO*> batchedPipelineStates;
+    batchedPipelineStates.reserve(pipelineStateDescs.size());
+
+    PipelineCache* pipelineCacheVK = nullptr;
+
+    for_range(i, pipelineStateDescs.size())
+    {
+        const ComputePipelineDescriptor& pipelineStateDesc = pipelineStateDescs[i];
+        pipelineCacheVK = GetPipelineCacheOrPersistent(pipelineCache);
+        if ((pipelineStateDesc.flags & PipelineStateFlags::AsyncCompilation) != 0)
+        {
+            /* Asynchronous PSOs are still compiled individually on a worker thread */
+            outPipelineStates[i] = pipelineStates_.emplace<VKComputePSO>(device_, pipelineStateDesc, pipelineCacheVK);
+        }
+        else
+        {
+            VKComputePSO* pipelineStateVK = pipelineStates_.emplace<VKComputePSO>(
+                device_,
+                pipelineStateDesc,
+                pipelineCacheVK,
+                &(createInfos[batchedPipelineStates.size()])
+            );
+            batchedPipelineStates.push_back(pipelineStateVK);
+            outPipelineStates[i] = pipelineStateVK;
+        }
+    }
+
+    VKComputePSO::CreateVkPipelines(device_, batchedPipelineStates.size(), batchedPipelineStates.data(), createInfos.data(), pipelineCacheVK);
+    FlushPersistentPipelineCache();
+}
+
+PipelineState* VKRenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& /*pipelineStateDesc*/, PipelineCache* /*pipelineCache*/)
+{
+    /* Ray tracing pipelines are not implemented for Vulkan yet, see RenderingFeatures::hasRayTracing */
+    Log::Errorf("ray tracing pipelines not supported by Vulkan backend\n");
+    return nullptr;
+}
+
+void VKRenderSystem::Release(PipelineState& pipelineState)
+{
+    pipelineStates_.erase(&pipelineState);
+}
+
+/* ----- Queries ----- */
+
+QueryHeap* VKRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
+{
+    if (queryHeapDesc.renderCondition)
+        return queryHeaps_.emplace<VKPredicateQueryHeap>(device_, *deviceMemoryMngr_, queryHeapDesc);
+    else
+        return queryHeaps_.emplace<VKQueryHeap>(device_, queryHeapDesc);
+}
+
+void VKRenderSystem::Release(QueryHeap& queryHeap)
+{
+    queryHeaps_.erase(&queryHeap);
+}
+
+/* ----- Fences ----- */
+
+Fence* VKRenderSystem::CreateFence()
+{
+    /* Recycle the oldest released timeline fence once its last signal has completed, since timeline values only increase */
+    if (!fencePool_.empty() && fencePool_.front()->IsSignaled())
+    {
+        HWObjectContainer<VKFence>::object_ptr<VKFence> fence = std::move(fencePool_.front());
+        fencePool_.pop_front();
+        return fences_.insert(std::move(fence));
+    }
+    const bool useTimelineSemaphore = HasExtension(VKExt::KHR_timeline_semaphore);
+    return fences_.emplace<VKFence>(device_, useTimelineSemaphore, useTimelineSemaphore && VKFence::IsExportSupported());
+}
+
+void VKRenderSystem::Release(Fence& fence)
+{
+    auto& fenceVK = LLGL_CAST(VKFence&, fence);
+    if (fenceVK.IsTimeline())
+    {
+        /* Timeline semaphores must not be destroyed while a queue still has to signal them */
+        if (VKCommandQueue* deferredSignalQueue = fenceVK.GetDeferredSignalQueue())
+            deferredSignalQueue->FlushDeferredSignals();
+
+        /* Move timeline fence into the pool instead of waiting for its signal; shared fences can still be referenced outside of LLGL */
+        if (!fenceVK.IsShared())
+        {
+            fencePool_.push_back(fences_.extract(&fence));
+            return;
+        }
+        fenceVK.Wait(device_, std::numeric_limits<std::uint64_t>::max());
+    }
+    fences_.erase(&fence);
+}
+
+/* ----- Extensions ----- */
+
+bool VKRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Vulkan::RenderSystemNativeHandle))
+    {
+        auto* nativeHandleVK = static_cast<Vulkan::RenderSystemNativeHandle*>(nativeHandle);
+        nativeHandleVK->instance        = instance_.Get();
+        nativeHandleVK->physicalDevice  = physicalDevice_.GetVkPhysicalDevice();
+        nativeHandleVK->device          = device_.GetVkDevice();
+        nativeHandleVK->queue           = device_.GetVkQueue();
+        nativeHandleVK->queueFamily     = device_.GetQueueFamilyIndices().graphicsFamily;
+        return true;
+    }
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VKBuffer* VKRenderSystem::CreateBufferInternal(const BufferDescriptor& bufferDesc, const void* initialData, UploadBatch* batch)
+{
+    RenderSystem::AssertCreateBuffer(bufferDesc, static_cast<uint64_t>(std::numeric_limits<VkDeviceSize>::max()));
+
+    const bool isShared = ((bufferDesc.miscFlags & MiscFlags::Shared) != 0);
+
+    if (!isShared && (bufferDesc.miscFlags & MiscFlags::PersistentMapping) != 0 && bufferDesc.cpuAccessFlags != 0)
+    {
+        VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
+        InitializePersistentBuffer(*bufferVK, initialData, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+        return bufferVK;
+    }
+
+    /* Create primary buffer object */
+    VKBuffer* bufferVK = buffers_.emplace<VKBuffer>(device_, bufferDesc);
+
+    /*
+    Place dynamic buffers into device-local host-visible memory (Resizable BAR) if available,
+    so RenderSystem::WriteBuffer writes them directly without a staging copy
+    */
+    if (!isShared && IsDirectWriteBufferCandidate(bufferDesc) && HasDirectWriteMemoryBudget(bufferVK->GetDeviceBuffer().GetRequirements()))
+    {
+        InitializePersistentBuffer(*bufferVK, initialData, (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+        bufferVK->MarkDirectWrite();
+        return bufferVK;
+    }
+
+    /* Create staging buffer */
+    VkBufferCreateInfo stagingCreateInfo;
+    BuildVkBufferCreateInfo(
+        stagingCreateInfo,
+        static_cast<VkDeviceSize>(bufferDesc.size),
+        GetStagingVkBufferUsageFlags(bufferDesc.cpuAccessFlags)
+    );
+
+    VKDeviceBuffer stagingBuffer = CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, bufferDesc.size);
+
+    /* Allocate device memory; shared buffers get their own exportable memory */
+    if (isShared)
+        bufferVK->AllocateExternalMemory(*deviceMemoryMngr_);
+    else
+    {
+        VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
+            bufferVK->GetDeviceBuffer().GetRequirements(),
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        );
+        bufferVK->BindMemoryRegion(device_, memoryRegion);
+    }
+
+    /* Copy staging buffer into hardware buffer; batched copies are submitted by SubmitUploadBatch() */
+    if (batch != nullptr)
+    {
+        VkBufferCopy region;
+        {
+            region.srcOffset    = 0;
+            region.dstOffset    = 0;
+            region.size         = static_cast<VkDeviceSize>(bufferDesc.size);
+        }
+        vkCmdCopyBuffer(batch->commandBuffer, stagingBuffer.GetVkBuffer(), bufferVK->GetVkBuffer(), 1, &region);
+    }
+    else
+        device_.CopyBuffer(stagingBuffer.GetVkBuffer(), bufferVK->GetVkBuffer(), static_cast<VkDeviceSize>(bufferDesc.size));
+
+    if (bufferDesc.cpuAccessFlags != 0 || (bufferDesc.miscFlags & MiscFlags::DynamicUsage) != 0)
+    {
+        /* Store ownership of staging buffer */
+        bufferVK->TakeStagingBuffer(std::move(stagingBuffer));
+    }
+    else if (batch != nullptr)
+    {
+        /* Release staging buffer once the batch has been submitted */
+        batch->stagingBuffers.push_back(std::move(stagingBuffer));
+    }
+    else
+    {
+        /* Release staging buffer */
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    }
+
+    return bufferVK;
+}
+
+void VKRenderSystem::BeginUploadBatch(UploadBatch& batch)
+{
+    batch.queueLock     = device_.LockQueue();
+    batch.commandBuffer = AllocCommandBuffer();
+}
+
+void VKRenderSystem::SubmitUploadBatch(UploadBatch& batch)
+{
+    FlushCommandBuffer(batch.commandBuffer);
+    batch.queueLock.unlock();
+    for (VKDeviceBuffer& stagingBuffer : batch.stagingBuffers)
+        stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+    batch.stagingBuffers.clear();
+}
+
+VKTexture* VKRenderSystem::CreateTextureInternal(const TextureDescriptor& textureDesc, const ImageView* initialImage, UploadBatch* batch)
+{
+    /* Sparse textures have no initial data, since their tiles are not resident until they are mapped via the command queue */
+    if ((textureDesc.miscFlags & MiscFlags::Sparse) != 0)
+    {
+        VKTexture* textureVK = CreateSparseTexture(textureDesc);
+        if (batch != nullptr)
+            context_.Reset(batch->commandBuffer);
+        return textureVK;
+    }
+
+    /* Determine size of image for staging buffer */
+    const std::uint32_t imageSize       = NumMipTexels(textureDesc, 0);
+    const std::size_t   initialDataSize = GetMemoryFootprint(textureDesc.format, imageSize);
+    const std::uint32_t bytesPerPixel   = static_cast<std::uint32_t>(GetMemoryFootprint(textureDesc.format, 1));
+    const auto&         formatAttribs   = FormatTable::GetAttribs(textureDesc.format);
+    const Extent3D      extent          = CalcTextureExtent(textureDesc.type, textureDesc.extent, textureDesc.arrayLayers);
+
+    const bool isCompressed = ((formatAttribs.flags & FormatFlags::IsCompressed) != 0);
+
+    /* Set up initial image data */
+    const void* initialData = nullptr;
+    DynamicByteArray intermediateData;
+
+    std::uint32_t srcRowStride = extent.width * bytesPerPixel;
+
+    if (initialImage != nullptr)
+    {
+        const ImageView& srcImageView = *initialImage;
+
+        /* Check if image data must be converted */
+        if (!isCompressed)
+        {
+            const std::uint32_t srcBytesPerPixel = static_cast<std::uint32_t>(GetMemoryFootprint(srcImageView.format, srcImageView.dataType, 1));
+            srcRowStride = (srcImageView.rowStride > 0 ? srcImageView.rowStride : extent.width * srcBytesPerPixel);
+
+            /* Check if amount of padding memory is small enough to justify a larger GPU buffer upload */
+            bool rowStrideNeedsConversion = (srcImageView.rowStride != 0 && srcImageView.rowStride != extent.width * srcBytesPerPixel);
+            if (rowStrideNeedsConversion)
+            {
+                const std::size_t dataSizeWithPadding = srcImageView.dataSize / srcBytesPerPixel * bytesPerPixel;
+
+                const bool isPaddingLessThan50Percent   = (dataSizeWithPadding < initialDataSize + initialDataSize/2);
+                const bool isRowStridePixelSizeAligned  = (srcImageView.rowStride % bytesPerPixel == 0);
+
+                if (isRowStridePixelSizeAligned && isPaddingLessThan50Percent)
+                    rowStrideNeedsConversion = false;
+            }
+
+            if (srcImageView.format != formatAttribs.format ||
+                srcImageView.dataType != formatAttribs.dataType ||
+                rowStrideNeedsConversion)
+            {
+                /* Convert image format (will be null if no conversion is necessary) */
+                intermediateData = ConvertImageBuffer(srcImageView, formatAttribs.format, formatAttribs.dataType, extent, LLGL_MAX_THREAD_COUNT);
+                srcRowStride = extent.width * bytesPerPixel;
+            }
+        }
+
+        if (intermediateData)
+        {
+            /* Validate that source image data was large enough so conversion is valid, then use temporary image as source for initial data */
+            const std::size_t srcImageDataSize = GetMemoryFootprint(initialImage->format, initialImage->dataType, imageSize);
+            LLGL_ASSERT(initialImage->dataSize >= srcImageDataSize);
+            initialData = intermediateData.get();
+        }
+        else
+        {
+            /* Validate that image data is large enough, then use input data as source for initial data */
+            LLGL_ASSERT(initialImage->dataSize >= initialDataSize);
+            initialData = initialImage->data;
+        }
+    }
+    else if ((textureDesc.miscFlags & (MiscFlags::NoInitialData | MiscFlags::Transient)) == 0)
+    {
+        /* Allocate default image data; Transient attachments cannot be transfer destinations */
+        const auto& formatAttribs = FormatTable::GetAttribs(textureDesc.format);
+        if (formatAttribs.bitSize > 0 && (formatAttribs.flags & FormatFlags::IsCompressed) == 0)
+            intermediateData = GenerateImageBuffer(formatAttribs.format, formatAttribs.dataType, imageSize, textureDesc.clearValue.color);
+        else
+            intermediateData = DynamicByteArray{ initialDataSize, UninitializeTag{} };
+
+        initialData = intermediateData.get();
+    }
+
+    /* Create device texture */
+    VKTexture* textureVK = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+
+    if (initialData != nullptr)
+    {
+        /* Create staging buffer */
+        VkBufferCreateInfo stagingCreateInfo;
+        BuildVkBufferCreateInfo(
+            stagingCreateInfo,
+            initialDataSize,
+            VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+        );
+
+        VKDeviceBuffer stagingBuffer =
+        (
+            isCompressed
+                ? CreateStagingBufferAndInitialize(stagingCreateInfo, initialData, initialDataSize)
+                : CreateTextureStagingBufferAndInitialize(stagingCreateInfo, initialData, initialDataSize, extent, srcRowStride, bytesPerPixel)
+        );
 
-PipelineCache* VKRenderSystem::CreatePipelineCache(const Blob& initialBlob)
-{
-    return pipelineCaches_.emplace<VKPipelineCache>(device_, initialBlob);
-}
+        /* Copy staging buffer into hardware texture, then transfer image into sampling-ready state; batched commands are submitted by SubmitUploadBatch() */
+        std::unique_lock<std::recursive_mutex> queueLock = device_.LockQueue();
+        VkCommandBuffer cmdBuffer = (batch != nullptr ? batch->commandBuffer : AllocCommandBuffer());
+        {
+            const TextureSubresource subresource{ 0, textureVK->GetNumArrayLayers(), 0, textureVK->GetNumMipLevels() };
 
-void VKRenderSystem::Release(PipelineCache& pipelineCache)
-{
-    pipelineCaches_.erase(&pipelineCache);
-}
+            textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, true);
 
-/* ----- Pipeline States ----- */
+            /* Determine row length (in pixels) for image upload with padding */
+            const std::uint32_t rowLength = (bytesPerPixel > 0 ? srcRowStride / bytesPerPixel : 0);
 
-PipelineState* VKRenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
-{
-    return pipelineStates_.emplace<VKGraphicsPSO>(
-        device_,
-        (!swapChains_.empty() ? (*swapChains_.begin())->GetRenderPass() : nullptr),
-        pipelineStateDesc,
-        graphicsPipelineLimits_,
-        pipelineCache
-    );
-}
+            context_.CopyBufferToImage(
+                stagingBuffer.GetVkBuffer(),
+                textureVK->GetVkImage(),
+                textureVK->GetVkFormat(),
+                VkOffset3D{ 0, 0, 0 },
+                textureVK->GetVkExtent(),
+                subresource,
+                rowLength
+            );
 
-PipelineState* VKRenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* pipelineCache)
-{
-    return pipelineStates_.emplace<VKComputePSO>(device_, pipelineStateDesc, pipelineCache);
-}
+            textureVK->TransitionImageLayout(context_, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, true);
 
-void VKRenderSystem::Release(PipelineState& pipelineState)
-{
-    pipelineStates_.erase(&pipelineState);
-}
+            /* Generate MIP-maps if enabled */
+            if (initialImage != nullptr && MustGenerateMipsOnCreate(textureDesc))
+            {
+                context_.GenerateMips(
+                    textureVK->GetVkImage(),
+                    textureVK->GetVkFormat(),
+                    textureVK->GetVkExtent(),
+                    subresource
+                );
+            }
+        }
 
-/* ----- Queries ----- */
+        if (batch != nullptr)
+        {
+            /* Release staging buffer once the batch has been submitted */
+            batch->stagingBuffers.push_back(std::move(stagingBuffer));
+        }
+        else
+        {
+            FlushCommandBuffer(cmdBuffer);
 
-QueryHeap* VKRenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
-{
-    if (queryHeapDesc.renderCondition)
-        return queryHeaps_.emplace<VKPredicateQueryHeap>(device_, *deviceMemoryMngr_, queryHeapDesc);
+            /* Release staging buffer */
+            stagingBuffer.ReleaseMemoryRegion(*deviceMemoryMngr_);
+        }
+    }
     else
-        return queryHeaps_.emplace<VKQueryHeap>(device_, queryHeapDesc);
-}
-
-void VKRenderSystem::Release(QueryHeap& queryHeap)
-{
-    queryHeaps_.erase(&queryHeap);
-}
+    {
+        /* Initialize image layout */
+        const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
+        if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+        {
+            if (batch != nullptr)
+                textureVK->TransitionImageLayout(context_, initialLayout, true);
+            else
+            {
+                std::unique_lock<std::recursive_mutex> queueLock = device_.LockQueue();
+                VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+                {
+                    textureVK->TransitionImageLayout(context_, initialLayout, true);
+                }
+                FlushCommandBuffer(cmdBuffer);
+            }
+        }
+    }
 
-/* ----- Fences ----- */
+    /* Create primary image view for texture */
+    textureVK->CreateInternalImageView(device_);
 
-Fence* VKRenderSystem::CreateFence()
-{
-    return fences_.emplace<VKFence>(device_);
+    return textureVK;
 }
 
-void VKRenderSystem::Release(Fence& fence)
+VKTexture* VKRenderSystem::CreateSparseTexture(const TextureDescriptor& textureDesc)
 {
-    fences_.erase(&fence);
-}
+    VKTexture*              textureVK       = textures_.emplace<VKTexture>(device_, *deviceMemoryMngr_, textureDesc);
+    VKSparseImageMemory*    sparseMemory    = textureVK->GetSparseMemory();
 
-/* ----- Extensions ----- */
+    /* Bind MIP tail immediately, since it is always resident */
+    std::vector<VkSparseMemoryBind> mipTailBinds;
+    sparseMemory->BindMipTail(textureVK->GetNumMipLevels(), textureVK->GetNumArrayLayers(), mipTailBinds);
 
-bool VKRenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
-{
-    if (nativeHandle != nullptr && nativeHandleSize == sizeof(Vulkan::RenderSystemNativeHandle))
+    if (!mipTailBinds.empty())
     {
-        auto* nativeHandleVK = static_cast<Vulkan::RenderSystemNativeHandle*>(nativeHandle);
-        nativeHandleVK->instance        = instance_.Get();
-        nativeHandleVK->physicalDevice  = physicalDevice_.GetVkPhysicalDevice();
-        nativeHandleVK->device          = device_.GetVkDevice();
-        nativeHandleVK->queue           = device_.GetVkQueue();
-        nativeHandleVK->queueFamily     = device_.GetQueueFamilyIndices().graphicsFamily;
-        return true;
+        VkSparseImageOpaqueMemoryBindInfo opaqueBindInfo;
+        {
+            opaqueBindInfo.image        = textureVK->GetVkImage();
+            opaqueBindInfo.bindCount    = static_cast<std::uint32_t>(mipTailBinds.size());
+            opaqueBindInfo.pBinds       = mipTailBinds.data();
+        }
+        commandQueue_->BindSparseMemory(1, &opaqueBindInfo, 0, nullptr);
     }
-    return false;
-}
 
+    /* Initialize image layout; this submission waits for the sparse binding above */
+    const VkImageLayout initialLayout = FindOptimalInitialVkImageLayout(textureDesc.format, textureDesc.bindFlags);
+    if (initialLayout != VK_IMAGE_LAYOUT_UNDEFINED)
+    {
+        std::unique_lock<std::recursive_mutex> queueLock = device_.LockQueue();
+        VkCommandBuffer cmdBuffer = AllocCommandBuffer();
+        {
+            textureVK->TransitionImageLayout(context_, initialLayout, true);
+        }
+        FlushCommandBuffer(cmdBuffer);
+    }
 
-/*
- * ======= Private: =======
- */
+    /* Create primary image view for texture */
+    textureVK->CreateInternalImageView(device_);
+
+    return textureVK;
+}
 
 #ifndef VK_LAYER_KHRONOS_VALIDATION_NAME
 #define VK_LAYER_KHRONOS_VALIDATION_NAME "VK_LAYER_KHRONOS_validation"
@@ -798,11 +1424,12 @@ void VKRenderSystem::CreateInstance(const RendererConfigurationVulkan* config)
     const std::vector<VkExtensionProperties> extensionProperties = VKQueryInstanceExtensionProperties();
     std::vector<const char*> extensionNames;
 
+    /* Required instance extensions are only needed for presentation surfaces, which are not available in headless mode */
     auto IsVKExtSupportIncluded = [this](VKExtSupport extSupport)
     {
         return
         (
-            extSupport == VKExtSupport::Required ||
+            (!this->isHeadless_ && extSupport == VKExtSupport::Required) ||
             extSupport == VKExtSupport::Optional ||
             (this->isDebugLayerEnabled_ && extSupport == VKExtSupport::DebugOnly)
         );
@@ -946,7 +1573,7 @@ void VKRenderSystem::CreateDebugReportCallback()
     VKThrowIfFailed(result, "failed to create Vulkan debug report callback");
 }
 
-bool VKRenderSystem::PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDevice customPhysicalDevice)
+bool VKRenderSystem::PickPhysicalDevice(long preferredDeviceFlags, int adapterIndex, VkPhysicalDevice customPhysicalDevice)
 {
     /* Pick physical device with Vulkan support */
     if (customPhysicalDevice != VK_NULL_HANDLE)
@@ -954,15 +1581,12 @@ bool VKRenderSystem::PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDev
         /* Load weak reference to custom native physical device */
         physicalDevice_.LoadPhysicalDeviceWeakRef(customPhysicalDevice);
     }
-    else if (!physicalDevice_.PickPhysicalDevice(instance_, preferredDeviceFlags))
+    else if (!physicalDevice_.PickPhysicalDevice(instance_, preferredDeviceFlags, adapterIndex, isHeadless_))
     {
         GetMutableReport().Errorf("failed to find suitable Vulkan device");
         return false;
     }
 
-    /* Store graphics pipeline limits for this physical device */
-    physicalDevice_.QueryPipelineLimits(graphicsPipelineLimits_);
-
     return true;
 }
 
@@ -971,11 +1595,11 @@ void VKRenderSystem::CreateLogicalDevice(VkDevice customLogicalDevice)
     /* Create logical device with all supported physical device feature */
     device_ = physicalDevice_.CreateLogicalDevice(customLogicalDevice);
 
-    /* Create command queue interface */
-    commandQueue_ = MakeUnique<VKCommandQueue>(device_, device_.GetVkQueue());
-
     /* Load Vulkan device extensions */
     VKLoadDeviceExtensions(device_, physicalDevice_.GetExtensionNames());
+
+    /* Store graphics pipeline limits for this physical device; this depends on the loaded extensions */
+    physicalDevice_.QueryPipelineLimits(graphicsPipelineLimits_);
 }
 
 bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const
@@ -998,6 +1622,69 @@ bool VKRenderSystem::IsLayerRequired(const char* name, const RendererConfigurati
     return false;
 }
 
+void VKRenderSystem::InitializePersistentBuffer(VKBuffer& bufferVK, const void* initialData, VkMemoryPropertyFlags memoryProperties)
+{
+    /* Allocate host-visible device memory without staging buffer */
+    VKDeviceMemoryRegion* memoryRegion = deviceMemoryMngr_->Allocate(
+        bufferVK.GetDeviceBuffer().GetRequirements(),
+        memoryProperties
+    );
+    bufferVK.BindMemoryRegion(device_, memoryRegion);
+
+    /* Mapped ranges of non-coherent memory must be flushed explicitly */
+    const VkPhysicalDeviceMemoryProperties& memoryProperties = physicalDevice_.GetMemoryProperties();
+    const std::uint32_t memoryTypeIndex = memoryRegion->GetParentChunk()->GetMemoryTypeIndex();
+    const bool isCoherent = ((memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0);
+
+    bufferVK.MapPersistent(device_, (isCoherent ? 0 : physicalDevice_.GetProperties().limits.nonCoherentAtomSize));
+
+    /* Write initial data directly into mapped memory */
+    if (initialData != nullptr)
+    {
+        if (void* data = bufferVK.Map(device_, CPUAccess::WriteOnly, 0, bufferVK.GetSize()))
+        {
+            ::memcpy(data, initialData, static_cast<std::size_t>(bufferVK.GetSize()));
+            bufferVK.Unmap(device_);
+        }
+    }
+}
+
+// Share of a memory heap that dynamic buffers may occupy in device-local host-visible memory, so other allocations from that heap still fit.
+static constexpr VkDeviceSize g_directWriteHeapBudgetPercent = 75;
+
+bool VKRenderSystem::HasDirectWriteMemoryBudget(const VkMemoryRequirements& requirements) const
+{
+    const VkPhysicalDeviceMemoryProperties& memoryProperties = physicalDevice_.GetMemoryProperties();
+
+    /* Find the same memory type the device memory manager would pick for device-local host-visible memory */
+    const VkMemoryPropertyFlags properties = (VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+    for_range(i, memoryProperties.memoryTypeCount)
+    {
+        if ((requirements.memoryTypeBits & (1u << i)) == 0 || (memoryProperties.memoryTypes[i].propertyFlags & properties) != properties)
+            continue;
+
+        /* Query usage and budget from the driver, or fall back to the heap size and what our own memory manager has allocated */
+        const std::uint32_t heapIndex = memoryProperties.memoryTypes[i].heapIndex;
+        VkDeviceSize heapUsage[VK_MAX_MEMORY_HEAPS], heapBudget[VK_MAX_MEMORY_HEAPS];
+        VkDeviceSize usage = 0, budget = 0;
+        if (physicalDevice_.QueryMemoryBudget(heapUsage, heapBudget))
+        {
+            usage   = heapUsage[heapIndex];
+            budget  = heapBudget[heapIndex];
+        }
+        else
+        {
+            usage   = deviceMemoryMngr_->GetHeapAllocatedSize(heapIndex);
+            budget  = memoryProperties.memoryHeaps[heapIndex].size;
+        }
+
+        return (usage + requirements.size <= budget / 100 * g_directWriteHeapBudgetPercent);
+    }
+
+    /* No device-local host-visible memory available, e.g. without Resizable BAR on older drivers */
+    return false;
+}
+
 VKDeviceBuffer VKRenderSystem::CreateStagingBuffer(const VkBufferCreateInfo& createInfo)
 {
     return VKDeviceBuffer
@@ -1072,7 +1759,164 @@ VkCommandBuffer VKRenderSystem::AllocCommandBuffer(bool begin)
 
 void VKRenderSystem::FlushCommandBuffer(VkCommandBuffer commandBuffer)
 {
-    device_.FlushCommandBuffer(commandBuffer);
+    /* Flush staging transfers first; if there were none, this submission must wait for pending sparse bindings instead */
+    stagingBufferPool_->Flush();
+    device_.FlushCommandBuffer(commandBuffer, true, stagingBufferPool_->ConsumeWaitSemaphore());
+}
+
+// Releases the device memory regions of a buffer before the buffer object itself is destroyed.
+class VKDeferredBufferRelease final : public DeferredRelease
+{
+
+    public:
+
+        VKDeferredBufferRelease(VkDevice device, VKDeviceMemoryManager& deviceMemoryMngr, HWObjectContainer<VKBuffer>::object_ptr<VKBuffer>&& buffer) :
+            device_           { device            },
+            deviceMemoryMngr_ { deviceMemoryMngr  },
+            buffer_           { std::move(buffer) }
+        {
+        }
+
+        ~VKDeferredBufferRelease()
+        {
+            /* Release device memory regions for primary buffer and internal staging buffer, then release buffer object */
+            if (buffer_)
+            {
+                buffer_->UnmapPersistent(device_);
+                buffer_->GetDeviceBuffer().ReleaseMemoryRegion(deviceMemoryMngr_);
+                buffer_->GetStagingDeviceBuffer().ReleaseMemoryRegion(deviceMemoryMngr_);
+            }
+        }
+
+    private:
+
+        VkDevice                                            device_;
+        VKDeviceMemoryManager&                              deviceMemoryMngr_;
+        HWObjectContainer<VKBuffer>::object_ptr<VKBuffer>   buffer_;
+
+};
+
+// Releases the device memory region of a texture before the texture object itself is destroyed.
+class VKDeferredTextureRelease final : public DeferredRelease
+{
+
+    public:
+
+        VKDeferredTextureRelease(VKDeviceMemoryManager& deviceMemoryMngr, HWObjectContainer<VKTexture>::object_ptr<VKTexture>&& texture) :
+            deviceMemoryMngr_ { deviceMemoryMngr   },
+            texture_          { std::move(texture) }
+        {
+        }
+
+        ~VKDeferredTextureRelease()
+        {
+            if (texture_)
+                deviceMemoryMngr_.Release(texture_->GetMemoryRegion());
+        }
+
+    private:
+
+        VKDeviceMemoryManager&                              deviceMemoryMngr_;
+        HWObjectContainer<VKTexture>::object_ptr<VKTexture> texture_;
+
+};
+
+void VKRenderSystem::DeferReleaseBuffer(std::uint64_t releaseSerial, VKBuffer& bufferVK)
+{
+    deferredReleases_.Enqueue(releaseSerial, MakeUnique<VKDeferredBufferRelease>(device_, *deviceMemoryMngr_, buffers_.extract(&bufferVK)));
+}
+
+void VKRenderSystem::DeferReleaseTexture(std::uint64_t releaseSerial, VKTexture& textureVK)
+{
+    deferredReleases_.Enqueue(releaseSerial, MakeUnique<VKDeferredTextureRelease>(*deviceMemoryMngr_, textures_.extract(&textureVK)));
+}
+
+/*
+Released objects might still be referenced by command buffers or staging transfers the GPU has not finished yet, so instead of waiting for the device to become idle,
+a fence is submitted to each command queue and the objects are destroyed once all of these fences have been signaled.
+If no queue has been submitted to since the last release, the objects share the release serial of that release.
+*/
+std::uint64_t VKRenderSystem::SignalReleaseSerial()
+{
+    /* Submit batched uploads, since they might still refer to the released objects */
+    stagingBufferPool_->Flush();
+
+    if (GetQueueSubmitCount() != releaseSubmitCount_)
+    {
+        std::vector<VKPtr<VkFence>> fences;
+        for (VKCommandQueue* queue : { commandQueue_.get(), computeQueue_.get(), copyQueue_.get() })
+        {
+            if (queue != nullptr)
+            {
+                fences.push_back(GetOrCreateReleaseFence());
+                queue->SubmitReleaseFence(fences.back().Get());
+            }
+        }
+        releaseFences_.push_back(std::move(fences));
+        releaseSubmitCount_ = GetQueueSubmitCount();
+    }
+
+    return (completedReleaseSerial_ + releaseFences_.size());
+}
+
+void VKRenderSystem::CollectDeferredReleases()
+{
+    std::lock_guard<std::mutex> guard{ releaseMutex_ };
+
+    while (!releaseFences_.empty())
+    {
+        std::vector<VKPtr<VkFence>>& fences = releaseFences_.front();
+        for (const VKPtr<VkFence>& fence : fences)
+        {
+            if (vkGetFenceStatus(device_, fence.Get()) != VK_SUCCESS)
+            {
+                deferredReleases_.Collect(completedReleaseSerial_);
+                return;
+            }
+        }
+
+        /* Recycle fences of completed release serial */
+        for (VKPtr<VkFence>& fence : fences)
+        {
+            vkResetFences(device_, 1, fence.GetAddressOf());
+            freeReleaseFences_.push_back(std::move(fence));
+        }
+        releaseFences_.pop_front();
+        ++completedReleaseSerial_;
+    }
+    deferredReleases_.Collect(completedReleaseSerial_);
+}
+
+std::uint64_t VKRenderSystem::GetQueueSubmitCount() const
+{
+    std::uint64_t submitCount = stagingBufferPool_->GetSubmitCount();
+    for (const VKCommandQueue* queue : { commandQueue_.get(), computeQueue_.get(), copyQueue_.get() })
+    {
+        if (queue != nullptr)
+            submitCount += queue->GetSubmitCount();
+    }
+    return submitCount;
+}
+
+VKPtr<VkFence> VKRenderSystem::GetOrCreateReleaseFence()
+{
+    if (!freeReleaseFences_.empty())
+    {
+        VKPtr<VkFence> fence = std::move(freeReleaseFences_.back());
+        freeReleaseFences_.pop_back();
+        return fence;
+    }
+
+    VKPtr<VkFence> fence{ device_, vkDestroyFence };
+    VkFenceCreateInfo createInfo;
+    {
+        createInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+    }
+    VkResult result = vkCreateFence(device_, &createInfo, nullptr, fence.ReleaseAndGetAddressOf());
+    VKThrowIfFailed(result, "failed to create Vulkan fence for deferred release");
+    return fence;
 }
 
 bool VKRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabilities* outCaps)
@@ -1092,6 +1936,66 @@ bool VKRenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabi
     return true;
 }
 
+std::uint32_t VKRenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* outHeapInfos, std::uint32_t maxHeapInfos)
+{
+    const VkPhysicalDeviceMemoryProperties& memoryProperties = physicalDevice_.GetMemoryProperties();
+    const std::uint32_t numHeaps = memoryProperties.memoryHeapCount;
+
+    if (outHeapInfos != nullptr && maxHeapInfos > 0)
+    {
+        /* Query usage and budget from the driver, or fall back to the heap sizes and what our own memory manager has allocated */
+        VkDeviceSize heapUsage[VK_MAX_MEMORY_HEAPS], heapBudget[VK_MAX_MEMORY_HEAPS];
+        const bool hasMemoryBudget = physicalDevice_.QueryMemoryBudget(heapUsage, heapBudget);
+
+        for_range(i, std::min(numHeaps, maxHeapInfos))
+        {
+            const VkMemoryHeap& heap = memoryProperties.memoryHeaps[i];
+            MemoryHeapInfo& heapInfo = outHeapInfos[i];
+            heapInfo.flags  = ((heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0 ? MemoryHeapFlags::DeviceLocal : 0);
+            heapInfo.size   = heap.size;
+            heapInfo.usage  = (hasMemoryBudget ? heapUsage[i] : deviceMemoryMngr_->GetHeapAllocatedSize(i));
+            heapInfo.budget = (hasMemoryBudget ? heapBudget[i] : heap.size);
+        }
+    }
+
+    return numHeaps;
+}
+
+std::uint32_t VKRenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    return CopyAdapterInfos(GetVKAdapterInfos(instance_, physicalDevice_.GetVkPhysicalDevice()), outAdapters, maxAdapters);
+}
+
+PipelineCache* VKRenderSystem::GetPipelineCacheOrPersistent(PipelineCache* pipelineCache)
+{
+    if (pipelineCache != nullptr || !pipelineCacheStore_.IsOpen())
+        return pipelineCache;
+
+    std::lock_guard<std::mutex> guard{ persistentPipelineCacheMutex_ };
+
+    /* Load persistent pipeline cache lazily with the first pipeline that is created without an explicit cache */
+    if (!persistentPipelineCache_)
+        persistentPipelineCache_ = MakeUnique<VKPipelineCache>(device_, pipelineCacheStore_.Read(g_pipelineCacheStoreKey));
+
+    ++numUnflushedPipelines_;
+    return persistentPipelineCache_.get();
+}
+
+void VKRenderSystem::FlushPersistentPipelineCache(bool force)
+{
+    std::lock_guard<std::mutex> guard{ persistentPipelineCacheMutex_ };
+
+    if (!persistentPipelineCache_ || numUnflushedPipelines_ == 0)
+        return;
+
+    /* Write the entire device-wide cache; the driver merges all previously loaded and newly compiled pipelines into it */
+    if (force || numUnflushedPipelines_ >= g_pipelineCacheFlushInterval)
+    {
+        pipelineCacheStore_.Write(g_pipelineCacheStoreKey, persistentPipelineCache_->GetBlob());
+        numUnflushedPipelines_ = 0;
+    }
+}
+
 
 } // /namespace LLGL
 
@@ -13,7 +13,11 @@
 #include "VKPhysicalDevice.h"
 #include "VKDevice.h"
 #include "../ContainerTypes.h"
+#include "../PipelineCacheStore.h"
+#include "../DeferredReleaseQueue.h"
+#include "../SubmissionThread.h"
 #include "Memory/VKDeviceMemoryManager.h"
+#include "Memory/VKPlacementHeap.h"
 
 #include "Command/VKCommandQueue.h"
 #include "Command/VKCommandBuffer.h"
@@ -22,6 +26,7 @@
 
 #include "Buffer/VKBuffer.h"
 #include "Buffer/VKBufferArray.h"
+#include "Buffer/VKStagingBufferPool.h"
 
 #include "Shader/VKShader.h"
 
@@ -42,6 +47,8 @@
 #include <vector>
 #include <set>
 #include <tuple>
+#include <deque>
+#include <mutex>
 
 
 namespace LLGL
@@ -55,6 +62,30 @@ class VKRenderSystem final : public RenderSystem
 
         #include <LLGL/Backend/RenderSystem.inl>
 
+    public:
+
+        CommandQueue* GetCommandQueue(const CommandQueueType type) override;
+
+        void WriteTextureAsync(std::uint32_t numUploads, const TextureUploadDescriptor* uploads, Fence* fence = nullptr) override;
+
+        void FlushMappedRange(Buffer& buffer, std::uint64_t offset, std::uint64_t length) override;
+
+        PlacementHeap* CreatePlacementHeap(const PlacementHeapDescriptor& placementHeapDesc) override;
+
+        void Release(PlacementHeap& placementHeap) override;
+
+        MemoryRequirements GetTextureMemoryRequirements(const TextureDescriptor& textureDesc) override;
+
+        Texture* CreatePlacedTexture(PlacementHeap& placementHeap, std::uint64_t offset, const TextureDescriptor& textureDesc) override;
+
+        bool ExportSharedHandle(Resource& resource, SharedResourceHandle& outHandle) override;
+
+        Texture* ImportTexture(const TextureDescriptor& textureDesc, const SharedResourceHandle& sharedHandle) override;
+
+        Buffer* ImportBuffer(const BufferDescriptor& bufferDesc, const SharedResourceHandle& sharedHandle) override;
+
+        bool ExportSharedFence(Fence& fence, SharedResourceHandle& outHandle) override;
+
     public:
 
         VKRenderSystem(const RenderSystemDescriptor& renderSystemDesc);
@@ -75,13 +106,38 @@ class VKRenderSystem final : public RenderSystem
 
         void CreateInstance(const RendererConfigurationVulkan* config);
         void CreateDebugReportCallback();
-        bool PickPhysicalDevice(long preferredDeviceFlags, VkPhysicalDevice customPhysicalDevice = VK_NULL_HANDLE);
+        bool PickPhysicalDevice(long preferredDeviceFlags, int adapterIndex, VkPhysicalDevice customPhysicalDevice = VK_NULL_HANDLE);
         void CreateLogicalDevice(VkDevice customLogicalDevice = VK_NULL_HANDLE);
 
         bool IsLayerRequired(const char* name, const RendererConfigurationVulkan* config) const;
 
         VKDeviceBuffer CreateStagingBuffer(const VkBufferCreateInfo& createInfo);
 
+        // Binds host-visible memory with the specified properties to the buffer, maps it persistently, and writes the initial data into it.
+        void InitializePersistentBuffer(VKBuffer& bufferVK, const void* initialData, VkMemoryPropertyFlags memoryProperties);
+
+        // Returns true if a buffer with the specified requirements fits into the budget of device-local host-visible memory (Resizable BAR).
+        bool HasDirectWriteMemoryBudget(const VkMemoryRequirements& requirements) const;
+
+        // Command buffer and staging buffers for the initial data of a batch of resources, see CreateBuffers() and CreateTextures().
+        struct UploadBatch
+        {
+            std::unique_lock<std::recursive_mutex>  queueLock;      // Graphics queue lock, held from BeginUploadBatch() until SubmitUploadBatch()
+            VkCommandBuffer                         commandBuffer   = VK_NULL_HANDLE;
+            std::vector<VKDeviceBuffer>             stagingBuffers;
+        };
+
+        // Creates a buffer and records its staging copy into the specified batch. If the batch is null, the copy is submitted immediately.
+        VKBuffer* CreateBufferInternal(const BufferDescriptor& bufferDesc, const void* initialData, UploadBatch* batch);
+
+        // Creates a texture and records its initial upload into the specified batch. If the batch is null, the upload is submitted immediately.
+        VKTexture* CreateTextureInternal(const TextureDescriptor& textureDesc, const ImageView* initialImage, UploadBatch* batch);
+        VKTexture* CreateSparseTexture(const TextureDescriptor& textureDesc);
+
+        // Allocates the command buffer for an upload batch, and submits it and releases its staging buffers after the GPU has completed it.
+        void BeginUploadBatch(UploadBatch& batch);
+        void SubmitUploadBatch(UploadBatch& batch);
+
         VKDeviceBuffer CreateStagingBufferAndInitialize(
             const VkBufferCreateInfo&   createInfo,
             const void*                 data,
@@ -97,9 +153,32 @@ class VKRenderSystem final : public RenderSystem
             std::uint32_t               bpp
         );
 
+        // Allocates a command buffer from the device. The graphics queue must be locked with VKDevice::LockQueue() until FlushCommandBuffer().
         VkCommandBuffer AllocCommandBuffer(bool begin = true);
         void FlushCommandBuffer(VkCommandBuffer commandBuffer);
 
+        // Returns the specified pipeline cache or the persistent pipeline cache if the input is null. See RenderSystemDescriptor::pipelineCacheDirectory.
+        PipelineCache* GetPipelineCacheOrPersistent(PipelineCache* pipelineCache);
+
+        // Writes the persistent pipeline cache to disk once enough new pipelines have been added to it since the last flush.
+        void FlushPersistentPipelineCache(bool force = false);
+
+        // Defers the release of the specified buffer or texture and its device memory until the GPU has completed all work submitted so far.
+        void DeferReleaseBuffer(std::uint64_t releaseSerial, VKBuffer& bufferVK);
+        void DeferReleaseTexture(std::uint64_t releaseSerial, VKTexture& textureVK);
+
+        // Submits a release fence to all command queues that have been submitted to since the last release and returns its release serial. 'releaseMutex_' must be locked.
+        std::uint64_t SignalReleaseSerial();
+
+        // Destroys all released objects whose release fences have been signaled.
+        void CollectDeferredReleases();
+
+        // Returns the accumulated number of submissions to all command queues.
+        std::uint64_t GetQueueSubmitCount() const;
+
+        // Returns a release fence from the pool or creates a new one.
+        VKPtr<VkFence> GetOrCreateReleaseFence();
+
     private:
 
         /* ----- Common objects ----- */
@@ -112,30 +191,53 @@ class VKRenderSystem final : public RenderSystem
 
         bool                                    isDebugLayerEnabled_    = false;
         bool                                    isBreakOnErrorEnabled_  = false;
+        bool                                    isHeadless_             = false;
         VKPtr<VkDebugReportCallbackEXT>         debugReportCallback_;
 
         std::unique_ptr<VKDeviceMemoryManager>  deviceMemoryMngr_;
+        std::unique_ptr<VKStagingBufferPool>    stagingBufferPool_;
 
         VKGraphicsPipelineLimits                graphicsPipelineLimits_;
 
+        PipelineCacheStore                      pipelineCacheStore_;
+        std::mutex                              persistentPipelineCacheMutex_;
+        std::unique_ptr<VKPipelineCache>        persistentPipelineCache_;
+        std::uint32_t                           numUnflushedPipelines_  = 0;
+
+        std::unique_ptr<SubmissionThread>       submissionThread_;              // Outlives all swap-chains; See RenderSystemFlags::SubmissionThread
+
         /* ----- Hardware object containers ----- */
 
-        HWObjectContainer<VKSwapChain>          swapChains_;
-        HWObjectInstance<VKCommandQueue>        commandQueue_;
-        HWObjectContainer<VKCommandBuffer>      commandBuffers_;
-        HWObjectContainer<VKBuffer>             buffers_;
-        HWObjectContainer<VKBufferArray>        bufferArrays_;
-        HWObjectContainer<VKTexture>            textures_;
-        HWObjectContainer<VKSampler>            samplers_;
-        HWObjectContainer<VKRenderPass>         renderPasses_;
-        HWObjectContainer<VKRenderTarget>       renderTargets_;
-        HWObjectContainer<VKShader>             shaders_;
-        HWObjectContainer<VKPipelineLayout>     pipelineLayouts_;
-        HWObjectContainer<VKPipelineCache>      pipelineCaches_;
-        HWObjectContainer<VKPipelineState>      pipelineStates_;
-        HWObjectContainer<VKResourceHeap>       resourceHeaps_;
-        HWObjectContainer<VKQueryHeap>          queryHeaps_;
-        HWObjectContainer<VKFence>              fences_;
+        HWObjectContainer<VKSwapChain>                swapChains_;
+        HWObjectInstance<VKCommandQueue>              commandQueue_;
+        HWObjectInstance<VKCommandQueue>              computeQueue_;
+        HWObjectInstance<VKCommandQueue>              copyQueue_;
+        HWObjectContainer<VKCommandBuffer>            commandBuffers_;
+        ConcurrentHWObjectContainer<VKBuffer>         buffers_;
+        HWObjectContainer<VKBufferArray>              bufferArrays_;
+        ConcurrentHWObjectContainer<VKTexture>        textures_;
+        HWObjectContainer<VKPlacementHeap>            placementHeaps_;
+        ConcurrentHWObjectContainer<VKSampler>        samplers_;
+        HWObjectContainer<VKRenderPass>               renderPasses_;
+        HWObjectContainer<VKRenderTarget>             renderTargets_;
+        ConcurrentHWObjectContainer<VKShader>         shaders_;
+        ConcurrentHWObjectContainer<VKPipelineLayout> pipelineLayouts_;
+        HWObjectContainer<VKPipelineCache>            pipelineCaches_;
+        ConcurrentHWObjectContainer<VKPipelineState>  pipelineStates_;
+        HWObjectContainer<VKResourceHeap>             resourceHeaps_;
+        HWObjectContainer<VKQueryHeap>                queryHeaps_;
+        HWObjectContainer<VKFence>                    fences_;
+
+        std::deque<HWObjectContainer<VKFence>::object_ptr<VKFence>> fencePool_;   // Released timeline fences in release order; see CreateFence()
+
+        /* ----- Deferred releases ----- */
+
+        std::mutex                              releaseMutex_;                  // Guards all deferred release members below
+        std::deque<std::vector<VKPtr<VkFence>>> releaseFences_;                 // Fences of pending release serials, starting after 'completedReleaseSerial_'
+        std::vector<VKPtr<VkFence>>             freeReleaseFences_;
+        std::uint64_t                           completedReleaseSerial_ = 0;
+        std::uint64_t                           releaseSubmitCount_     = 0;    // Accumulated queue submit count when the last release fences were submitted
+        DeferredReleaseQueue                    deferredReleases_;
 
 };
 
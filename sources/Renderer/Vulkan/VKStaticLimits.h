@@ -12,6 +12,9 @@
 // Maximum number of Vulkan shader stages per pipeline state object (PSO).
 #define LLGL_VK_MAX_NUM_PSO_SHADER_STAGES (5u)
 
+// Maximum number of dynamic uniform buffers per descriptor set. This is the minimum guaranteed value of 'VkPhysicalDeviceLimits::maxDescriptorSetUniformBuffersDynamic'.
+#define LLGL_VK_MAX_NUM_DYNAMIC_UNIFORM_BUFFERS (8u)
+
 
 #endif
 
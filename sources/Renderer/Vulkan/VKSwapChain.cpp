@@ -7,19 +7,29 @@
 
 #include "VKSwapChain.h"
 #include "VKCore.h"
+#include "VKDevice.h"
 #include "VKTypes.h"
 #include "Command/VKCommandContext.h"
 #include "Memory/VKDeviceMemoryManager.h"
+#include "Ext/VKExtensions.h"
+#include "Ext/VKExtensionRegistry.h"
 #include "Texture/VKImageUtils.h"
 #include "../TextureUtils.h"
+#include "../SubmissionThread.h"
 #include "../../Core/CoreUtils.h"
 #include "../../Core/Exception.h"
 #include "Platform/Apple/CAMetalLayerBridge.h"
 #include <LLGL/Platform/NativeHandle.h>
+#include <LLGL/Backend/Vulkan/NativeHandle.h>
 #include <LLGL/Utils/ForRange.h>
+#include <LLGL/Container/SmallVector.h>
 #include <limits.h>
 #include <set>
 
+#ifdef LLGL_OS_ANDROID
+#   include "../../Platform/Android/AndroidChoreographer.h"
+#endif
+
 
 namespace LLGL
 {
@@ -52,23 +62,27 @@ static VKPtr<VkFence> NullVkFence(VkDevice device)
 VKSwapChain::VKSwapChain(
     VkInstance                      instance,
     VkPhysicalDevice                physicalDevice,
-    VkDevice                        device,
+    VKDevice&                       device,
     VKDeviceMemoryManager&          deviceMemoryMngr,
     const SwapChainDescriptor&      desc,
     const std::shared_ptr<Surface>& surface,
-    const RendererInfo&             rendererInfo)
+    const RendererInfo&             rendererInfo,
+    SubmissionThread*               submissionThread)
 :
     SwapChain                { desc                            },
     instance_                { instance                        },
     physicalDevice_          { physicalDevice                  },
     device_                  { device                          },
     deviceMemoryMngr_        { deviceMemoryMngr                },
+    queueMutex_              { device.GetQueueMutex(device.GetVkQueue()) },
+    submissionThread_        { submissionThread                },
     surface_                 { instance, vkDestroySurfaceKHR   },
-    swapChain_               { device, vkDestroySwapchainKHR   },
-    swapChainRenderPass_     { device                          },
+    swapChain_               { device_, vkDestroySwapchainKHR  },
+    swapChainRenderPass_     { device_                         },
     swapChainSamples_        { GetClampedSamples(desc.samples) },
-    secondaryRenderPass_     { device                          },
-    depthStencilBuffer_      { device                          },
+    secondaryRenderPass_     { device_                         },
+    clearRenderPass_         { device_                         },
+    depthStencilBuffer_      { device_                         },
     imageAvailableSemaphore_ { NullVkSemaphore(device_),
                                NullVkSemaphore(device_),
                                NullVkSemaphore(device_)        },
@@ -76,11 +90,42 @@ VKSwapChain::VKSwapChain(
                                NullVkSemaphore(device_),
                                NullVkSemaphore(device_)        },
     inFlightFences_          { NullVkFence(device_),
+                               NullVkFence(device_),
+                               NullVkFence(device_)            },
+    presentFences_           { NullVkFence(device_),
                                NullVkFence(device_),
                                NullVkFence(device_)            }
 {
     SetOrCreateSurface(surface, SwapChain::BuildDefaultSurfaceTitle(rendererInfo), desc);
 
+    /* Determine number of frames in flight and whether presentation can be waited on via present IDs */
+    if (desc.maxFramesInFlight > 0)
+        numFramesInFlight_ = Clamp(desc.maxFramesInFlight, 1u, VKSwapChain::maxNumFramesInFlight);
+
+    /* Select presentation mode explicitly and whether the next image is acquired on first use instead of at the end of Present() */
+    presentMode_        = desc.presentMode;
+    colorSpace_         = desc.colorSpace;
+    lateImageAcquire_   = desc.lateImageAcquire;
+    preTransform_       = desc.preTransform;
+
+    /* Present fences tell when the semaphore a presentation waits on can be signaled again */
+    #if VK_EXT_swapchain_maintenance1
+    presentFenceSupported_ = HasExtension(VKExt::EXT_swapchain_maintenance1);
+    #endif
+
+    #if VK_KHR_present_id && VK_KHR_present_wait
+    presentWaitSupported_ = (HasExtension(VKExt::KHR_present_id) && HasExtension(VKExt::KHR_present_wait));
+    #endif
+
+    /* Only use display timings if they are recorded in the frame statistics or presentations are scheduled for frame pacing */
+    #if VK_GOOGLE_display_timing
+    const bool hasDisplayTiming = HasExtension(VKExt::GOOGLE_display_timing);
+    #ifdef LLGL_OS_ANDROID
+    framePacing_ = (desc.framePacing && hasDisplayTiming && AndroidChoreographer::Get().Start());
+    #endif
+    displayTimingSupported_ = (hasDisplayTiming && (HasFrameStatistics() || framePacing_));
+    #endif
+
     CreatePresentSemaphoresAndFences();
     CreateGpuSurface();
 
@@ -97,6 +142,11 @@ VKSwapChain::VKSwapChain(
         ShowSurface();
 }
 
+VKSwapChain::~VKSwapChain()
+{
+    WaitForPendingPresent();
+}
+
 bool VKSwapChain::IsPresentable() const
 {
     /* Use implicit boolean conversion here, since this type can either be a pointer or an integer type depending on the platform */
@@ -105,48 +155,90 @@ bool VKSwapChain::IsPresentable() const
 
 void VKSwapChain::Present()
 {
-    /* Initialize semaphores */
-    VkSemaphore waitSemaphores[] = { imageAvailableSemaphore_[currentFrameInFlight_] };
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    VkSemaphore signalSemaphores[] = { renderFinishedSemaphore_[currentFrameInFlight_] };
+    if (submissionThread_ != nullptr)
+    {
+        /* Present on the submission thread; The next access to the swap-chain images waits for this ticket (see AcquireColorBufferOnce) */
+        presentTicket_ = submissionThread_->Enqueue([this]() { PresentAndAcquireNextColorBuffer(); });
+    }
+    else
+        PresentAndAcquireNextColorBuffer();
+}
 
-    /* Submit signal semaphore to graphics queue */
-    VkSubmitInfo submitInfo;
+bool VKSwapChain::WaitForNextFrame(std::uint64_t timeout)
+{
+    WaitForPendingPresent();
+
+    #if VK_KHR_present_wait
+    if (presentWaitSupported_ && presentId_ >= numFramesInFlight_)
     {
-        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.pNext                = nullptr;
-        submitInfo.waitSemaphoreCount   = 1;
-        submitInfo.pWaitSemaphores      = waitSemaphores;
-        submitInfo.pWaitDstStageMask    = waitStages;
-        submitInfo.commandBufferCount   = 0;
-        submitInfo.pCommandBuffers      = nullptr;
-        submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores    = signalSemaphores;
+        /* Wait until no more than (numFramesInFlight_ - 1) presentations are still queued up */
+        const std::uint64_t waitPresentId = presentId_ + 1 - numFramesInFlight_;
+        BeginFrameStatisticsStall();
+        VkResult result = vkWaitForPresentKHR(device_, swapChain_, waitPresentId, timeout);
+        EndFrameStatisticsStall(false);
+
+        /* Out-of-date or lost surfaces can't be waited on, so only a timeout reports failure */
+        return (result != VK_TIMEOUT);
     }
-    VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
-    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+    #endif
 
-    /* Present result on screen */
-    VkPresentInfoKHR presentInfo;
+    /* Without present IDs, the in-flight fences already throttle the CPU in Present() */
+    return true;
+}
+
+bool VKSwapChain::GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (auto* nativeHandleVK = GetTypedNativeHandle<Vulkan::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
     {
-        presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
-        presentInfo.pNext               = nullptr;
-        presentInfo.waitSemaphoreCount  = 1;
-        presentInfo.pWaitSemaphores     = signalSemaphores;
-        presentInfo.swapchainCount      = 1;
-        presentInfo.pSwapchains         = swapChain_.GetAddressOf();
-        presentInfo.pImageIndices       = &currentColorBuffer_;
-        presentInfo.pResults            = nullptr;
+        /* Multi-sampled color buffers are resolved into the swap-chain images within the render pass */
+        AcquireColorBufferOnce();
+        nativeHandleVK->type                    = Vulkan::ResourceNativeType::Image;
+        nativeHandleVK->image.image             = swapChainImages_[currentColorBuffer_];
+        nativeHandleVK->image.imageLayout       = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        nativeHandleVK->image.format            = swapChainFormat_.format;
+        nativeHandleVK->image.extent            = VkExtent3D{ swapChainExtent_.width, swapChainExtent_.height, 1u };
+        nativeHandleVK->image.numMipLevels      = 1;
+        nativeHandleVK->image.numArrayLayers    = 1;
+        nativeHandleVK->image.sampleCountBits   = VK_SAMPLE_COUNT_1_BIT;
+        nativeHandleVK->image.imageUsageFlags   = (VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT);
+        return true;
     }
-    result = vkQueuePresentKHR(presentQueue_, &presentInfo);
-    VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
+    return false;
+}
 
-    /* Move to next frame */
-    AcquireNextColorBuffer();
+SurfaceTransform VKSwapChain::GetSurfaceTransform() const
+{
+    switch (swapChainTransform_)
+    {
+        case VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR:    return SurfaceTransform::Rotate90;
+        case VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR:   return SurfaceTransform::Rotate180;
+        case VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR:   return SurfaceTransform::Rotate270;
+        default:                                        return SurfaceTransform::Identity;
+    }
+}
+
+ColorSpace VKSwapChain::GetColorSpace() const
+{
+    switch (swapChainFormat_.colorSpace)
+    {
+        #if VK_EXT_swapchain_colorspace
+        case VK_COLOR_SPACE_HDR10_ST2084_EXT:           return ColorSpace::HDR10;
+        case VK_COLOR_SPACE_EXTENDED_SRGB_LINEAR_EXT:   return ColorSpace::ScRGB;
+        #endif
+        default:                                        return ColorSpace::SRGB;
+    }
+}
+
+bool VKSwapChain::GetFrameStatistics(FrameStatistics& outStatistics) const
+{
+    /* Frame statistics are recorded by the presentation */
+    WaitForPendingPresent();
+    return SwapChain::GetFrameStatistics(outStatistics);
 }
 
 std::uint32_t VKSwapChain::GetCurrentSwapIndex() const
 {
+    AcquireColorBufferOnce();
     return currentColorBuffer_;
 }
 
@@ -180,9 +272,8 @@ bool VKSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
     /* Recreate swap-chain with new vsnyc settings */
     if (vsyncInterval_ != vsyncInterval)
     {
-        CreatePresentSemaphoresAndFences();
-        CreateSwapChain(GetResolution(), vsyncInterval);
-        CreateSwapChainFramebuffers();
+        FlushSubmissionThread();
+        RecreateSwapChain(GetResolution(), vsyncInterval);
         vsyncInterval_ = vsyncInterval;
     }
     return true;
@@ -193,11 +284,57 @@ bool VKSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
 std::uint32_t VKSwapChain::TranslateSwapIndex(std::uint32_t swapBufferIndex) const
 {
     if (swapBufferIndex == LLGL_CURRENT_SWAP_INDEX)
+    {
+        AcquireColorBufferOnce();
         return currentColorBuffer_;
+    }
     else
         return std::min(swapBufferIndex, numColorBuffers_ - 1);
 }
 
+VKRenderingAttachmentSet VKSwapChain::GetRenderingAttachments(std::uint32_t swapBufferIndex) const
+{
+    VKRenderingAttachmentSet attachmentSet;
+
+    /* Swap-chain images rest in presentation layout, just like the final layout of the swap-chain render pass */
+    VKRenderingAttachment swapChainAttachment;
+    {
+        swapChainAttachment.image           = swapChainImages_[swapBufferIndex];
+        swapChainAttachment.imageView       = swapChainImageViews_[swapBufferIndex].Get();
+        swapChainAttachment.format          = swapChainFormat_.format;
+        swapChainAttachment.restingLayout   = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+    }
+
+    attachmentSet.numColorAttachments = 1;
+    if (HasMultiSampling())
+    {
+        /* Render into multi-sampled color buffer and resolve into swap-chain image */
+        VKRenderingAttachment& colorAttachment = attachmentSet.colorAttachments[0];
+        {
+            colorAttachment.image           = colorBuffers_[swapBufferIndex].GetVkImage();
+            colorAttachment.imageView       = colorBuffers_[swapBufferIndex].GetVkImageView();
+            colorAttachment.format          = colorBuffers_[swapBufferIndex].GetVkFormat();
+            colorAttachment.restingLayout   = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+        }
+        attachmentSet.resolveAttachments[0] = swapChainAttachment;
+    }
+    else
+        attachmentSet.colorAttachments[0] = swapChainAttachment;
+
+    if (HasDepthStencilBuffer())
+    {
+        VKRenderingAttachment& depthStencilAttachment = attachmentSet.depthStencilAttachment;
+        {
+            depthStencilAttachment.image            = depthStencilBuffer_.GetVkImage();
+            depthStencilAttachment.imageView        = depthStencilBuffer_.GetVkImageView();
+            depthStencilAttachment.format           = depthStencilBuffer_.GetVkFormat();
+            depthStencilAttachment.restingLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        }
+    }
+
+    return attachmentSet;
+}
+
 bool VKSwapChain::HasDepthStencilBuffer() const
 {
     return (depthStencilFormat_ != VK_FORMAT_UNDEFINED);
@@ -291,24 +428,26 @@ void VKSwapChain::CopyImage(
 
 bool VKSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
 {
-    /* Check if new resolution would actually change the swap-chain extent */
-    if (swapChainExtent_.width  != resolution.width ||
+    /*
+    Check if new resolution would actually change the swap-chain extent.
+    Pre-rotated swap-chains are always recreated, since the display rotation can change without changing the resolution.
+    */
+    if (preTransform_ ||
+        swapChainExtent_.width  != resolution.width ||
         swapChainExtent_.height != resolution.height)
     {
-        /* Wait until graphics queue is idle before resources are destroyed and recreated */
-        vkQueueWaitIdle(graphicsQueue_);
-
-        /* Recreate presenting semaphores and Vulkan surface */
-        CreatePresentSemaphoresAndFences();
-        CreateGpuSurface();
-
-        /* Recreate color and depth-stencil buffers */
-        ReleaseRenderBuffers();
-        CreateResolutionDependentResources(resolution);
+        FlushSubmissionThread();
+        RecreateSwapChain(resolution, vsyncInterval_);
     }
     return true;
 }
 
+VKSwapChain::RetiredSwapChain::RetiredSwapChain(VkDevice device) :
+    swapChain          { device, vkDestroySwapchainKHR },
+    depthStencilBuffer { device                        }
+{
+}
+
 void VKSwapChain::CreateGpuSemaphore(VKPtr<VkSemaphore>& semaphore)
 {
     /* Create semaphore (no flags) */
@@ -337,11 +476,13 @@ void VKSwapChain::CreateGpuFence(VKPtr<VkFence>& fence)
 void VKSwapChain::CreatePresentSemaphoresAndFences()
 {
     /* Create presentation semaphorse */
-    for_range(i, maxNumFramesInFlight)
+    for_range(i, numFramesInFlight_)
     {
         CreateGpuSemaphore(imageAvailableSemaphore_[i]);
         CreateGpuSemaphore(renderFinishedSemaphore_[i]);
         CreateGpuFence(inFlightFences_[i]);
+        if (presentFenceSupported_)
+            CreateGpuFence(presentFences_[i]);
     }
 }
 
@@ -393,6 +534,7 @@ void VKSwapChain::CreateGpuSurface()
     }
     VkResult result = vkCreateAndroidSurfaceKHR(instance_, &createInfo, nullptr, surface_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Android surface for Vulkan swap-chain");
+    surfaceWindow_ = nativeHandle.window;
 
     #elif defined LLGL_OS_MACOS || defined LLGL_OS_IOS
 
@@ -441,13 +583,30 @@ void VKSwapChain::CreateRenderPass(VKRenderPass& renderPass, AttachmentLoadOp lo
 void VKSwapChain::CreateDefaultAndSecondaryRenderPass()
 {
     CreateRenderPass(swapChainRenderPass_, AttachmentLoadOp::Undefined, AttachmentStoreOp::Store);
-    CreateRenderPass(secondaryRenderPass_, AttachmentLoadOp::Load, AttachmentStoreOp::Store);
+
+    /* Secondary and clear render passes are only required to resume a render pass or fold clears into it, dynamic rendering only needs the attachments */
+    if (!HasExtension(VKExt::KHR_dynamic_rendering))
+    {
+        CreateRenderPass(secondaryRenderPass_, AttachmentLoadOp::Load, AttachmentStoreOp::Store);
+        CreateRenderPass(clearRenderPass_, AttachmentLoadOp::Clear, AttachmentStoreOp::Store);
+    }
 }
 
-void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval)
+static bool IsSwappedSurfaceTransform(VkSurfaceTransformFlagBitsKHR transform)
 {
+    return (transform == VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR || transform == VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR);
+}
+
+void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval, VkSwapchainKHR oldSwapChain)
+{
+    /* Pick swap-chain transformation; pre-rotated images keep the natural orientation of the display, so width and height are swapped for 90 and 270 degrees */
+    swapChainTransform_ = PickSwapSurfaceTransform(surfaceSupportDetails_.caps);
+
     /* Pick swap-chain extent by resolution */
-    swapChainExtent_ = PickSwapExtent(surfaceSupportDetails_.caps, resolution);
+    if (IsSwappedSurfaceTransform(swapChainTransform_))
+        swapChainExtent_ = PickSwapExtent(surfaceSupportDetails_.caps, Extent2D{ resolution.height, resolution.width });
+    else
+        swapChainExtent_ = PickSwapExtent(surfaceSupportDetails_.caps, resolution);
 
     /* Get device queues for graphics and presentation */
     VkSurfaceKHR surface = surface_.Get();
@@ -487,20 +646,18 @@ void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyn
             createInfo.pQueueFamilyIndices      = nullptr;
         }
 
-        /* Prefer identity transformation */
-        if ((surfaceSupportDetails_.caps.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR) != 0)
-            createInfo.preTransform             = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
-        else
-            createInfo.preTransform             = surfaceSupportDetails_.caps.currentTransform;
-
-        createInfo.compositeAlpha               = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+        createInfo.preTransform                 = swapChainTransform_;
+        createInfo.compositeAlpha               = PickSwapCompositeAlpha(surfaceSupportDetails_.caps);
         createInfo.presentMode                  = presentMode;
         createInfo.clipped                      = VK_TRUE;
-        createInfo.oldSwapchain                 = VK_NULL_HANDLE;
+        createInfo.oldSwapchain                 = oldSwapChain;
     }
     VkResult result = vkCreateSwapchainKHR(device_, &createInfo, nullptr, swapChain_.ReleaseAndGetAddressOf());
     VKThrowIfFailed(result, "failed to create Vulkan swap-chain");
 
+    /* Present IDs are specific to each VkSwapchainKHR object */
+    presentId_ = 0;
+
     /* Query swap-chain images */
     numColorBuffers_ = numPreferredColorBuffers_;
     result = vkGetSwapchainImagesKHR(device_, swapChain_, &numColorBuffers_, nullptr);
@@ -512,9 +669,6 @@ void VKSwapChain::CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyn
 
     /* Create swap-chain image views */
     CreateSwapChainImageViews();
-
-    /* Get initial color buffer index for new Vulkan swap-chain */
-    AcquireNextColorBuffer();
 }
 
 void VKSwapChain::CreateSwapChainImageViews()
@@ -556,6 +710,10 @@ void VKSwapChain::CreateSwapChainImageViews()
 
 void VKSwapChain::CreateSwapChainFramebuffers()
 {
+    /* Dynamic rendering binds the swap-chain image views directly, so no framebuffer objects are required */
+    if (HasExtension(VKExt::KHR_dynamic_rendering))
+        return;
+
     /* Initialize image view attachments */
     VkImageView attachments[3] = {};
     std::uint32_t numAttachments = 0;
@@ -608,13 +766,13 @@ void VKSwapChain::CreateSwapChainFramebuffers()
     }
 }
 
-void VKSwapChain::CreateDepthStencilBuffer(const Extent2D& resolution)
+void VKSwapChain::CreateDepthStencilBuffer(const Extent2D& extent)
 {
     const VkSampleCountFlagBits sampleCountBits = VKTypes::ToVkSampleCountBits(swapChainSamples_);
-    depthStencilBuffer_.Create(deviceMemoryMngr_, resolution, depthStencilFormat_, sampleCountBits);
+    depthStencilBuffer_.Create(deviceMemoryMngr_, extent, depthStencilFormat_, sampleCountBits);
 }
 
-void VKSwapChain::CreateColorBuffers(const Extent2D& resolution)
+void VKSwapChain::CreateColorBuffers(const Extent2D& extent)
 {
     /* Create VkImage objects for each swap-chain buffer */
     const VkSampleCountFlagBits sampleCountBits = VKTypes::ToVkSampleCountBits(swapChainSamples_);
@@ -622,32 +780,170 @@ void VKSwapChain::CreateColorBuffers(const Extent2D& resolution)
     for_range(i, numColorBuffers_)
     {
         VKColorBuffer colorBuffer{ device_ };
-        colorBuffer.Create(deviceMemoryMngr_, resolution, swapChainFormat_.format, sampleCountBits);
+        colorBuffer.Create(deviceMemoryMngr_, extent, swapChainFormat_.format, sampleCountBits);
         colorBuffers_[i] = std::move(colorBuffer);
     }
 }
 
-void VKSwapChain::ReleaseRenderBuffers()
+void VKSwapChain::CreateRenderBuffers(const Extent2D& extent)
 {
-    depthStencilBuffer_.Release();
     if (HasMultiSampling())
-    {
-        for_range(i, numColorBuffers_)
-            colorBuffers_[i].Release();
-    }
+        CreateColorBuffers(extent);
+
+    if (HasDepthStencilBuffer())
+        CreateDepthStencilBuffer(extent);
+
+    renderBufferExtent_ = VkExtent2D{ extent.width, extent.height };
+}
+
+bool VKSwapChain::CanReuseRenderBuffers() const
+{
+    /* Multi-sampled color buffers are allocated per swap-chain image */
+    if (HasMultiSampling() && colorBuffers_.size() != numColorBuffers_)
+        return false;
+
+    /* Render buffers can be larger than the framebuffer, but don't keep allocations that are more than twice as large as needed */
+    const std::uint64_t requiredArea    = static_cast<std::uint64_t>(swapChainExtent_.width) * swapChainExtent_.height;
+    const std::uint64_t allocatedArea   = static_cast<std::uint64_t>(renderBufferExtent_.width) * renderBufferExtent_.height;
+    return
+    (
+        swapChainExtent_.width  <= renderBufferExtent_.width    &&
+        swapChainExtent_.height <= renderBufferExtent_.height   &&
+        requiredArea * 2 >= allocatedArea
+    );
 }
 
 void VKSwapChain::CreateResolutionDependentResources(const Extent2D& resolution)
 {
     CreateSwapChain(resolution, vsyncInterval_);
 
-    if (HasMultiSampling())
-        CreateColorBuffers(resolution);
+    /* Render buffers must match the swap-chain extent, which has swapped dimensions for pre-rotated surfaces */
+    CreateRenderBuffers(Extent2D{ swapChainExtent_.width, swapChainExtent_.height });
+    CreateSwapChainFramebuffers();
+
+    /* Get initial color buffer index for new Vulkan swap-chain */
+    AcquireNextColorBuffer();
+}
+
+/*
+Allocations are rounded up when the swap-chain grows, so that continuous window resizing (e.g. dragging a window border)
+doesn't reallocate the depth-stencil and multi-sampled color buffers on every step.
+*/
+static constexpr std::uint32_t renderBufferGranularity = 128;
+
+static std::uint32_t GetGrownRenderBufferSize(std::uint32_t size, std::uint32_t maxSize)
+{
+    return std::max(size, std::min(GetAlignedSize(size, renderBufferGranularity), maxSize));
+}
 
-    if (depthStencilFormat_ != VK_FORMAT_UNDEFINED)
-        CreateDepthStencilBuffer(resolution);
+void VKSwapChain::RecreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval)
+{
+    /* Don't wait for the GPU to be idle; The previous swap-chain is retired and its resources are kept alive until all frames in flight have completed */
+    RetiredSwapChain& retired = RetireSwapChain();
+
+    #ifdef LLGL_OS_ANDROID
+    /* Android replaces the native window when an app is resumed, in which case the surface must be retired and recreated as well */
+    NativeHandle nativeHandle = {};
+    GetSurface().GetNativeHandle(&nativeHandle, sizeof(nativeHandle));
+    const bool isSurfaceReplaced = (nativeHandle.window != surfaceWindow_);
+    #else
+    const bool isSurfaceReplaced = false;
+    #endif
+
+    if (isSurfaceReplaced)
+    {
+        retired.surface = std::move(surface_);
+        surface_ = VKPtr<VkSurfaceKHR>{ instance_, vkDestroySurfaceKHR };
+        CreateGpuSurface();
+    }
+    else
+    {
+        /* Re-query surface capabilities for the new extent and transformation; The surface itself remains valid across resizes */
+        surfaceSupportDetails_ = VKQuerySurfaceSupport(physicalDevice_, surface_);
+    }
+
+    /* Create new swap-chain from the retired one, so the presentation engine can re-use its resources; This requires the same surface */
+    CreateSwapChain(resolution, vsyncInterval, (isSurfaceReplaced ? VK_NULL_HANDLE : retired.swapChain.Get()));
 
+    /* Re-use depth-stencil and multi-sampled color buffers if the new extent still fits into their allocation */
+    if (!CanReuseRenderBuffers())
+    {
+        std::swap(retired.depthStencilBuffer, depthStencilBuffer_);
+        std::swap(retired.colorBuffers, colorBuffers_);
+
+        const bool isGrowing = (swapChainExtent_.width > renderBufferExtent_.width || swapChainExtent_.height > renderBufferExtent_.height);
+        if (isGrowing && renderBufferExtent_.width > 0 && renderBufferExtent_.height > 0)
+        {
+            const VkExtent2D& maxExtent = surfaceSupportDetails_.caps.maxImageExtent;
+            CreateRenderBuffers(
+                Extent2D
+                {
+                    GetGrownRenderBufferSize(swapChainExtent_.width, maxExtent.width),
+                    GetGrownRenderBufferSize(swapChainExtent_.height, maxExtent.height)
+                }
+            );
+        }
+        else
+            CreateRenderBuffers(Extent2D{ swapChainExtent_.width, swapChainExtent_.height });
+    }
+
+    /* Framebuffers always match the swap-chain extent */
     CreateSwapChainFramebuffers();
+
+    /* Acquire the image of the current frame from the new swap-chain; The frame in flight and its fences remain unchanged */
+    isColorBufferAcquired_ = false;
+    if (!lateImageAcquire_)
+        AcquireColorBufferOnce();
+}
+
+VKSwapChain::RetiredSwapChain& VKSwapChain::RetireSwapChain()
+{
+    RetiredSwapChain retired{ device_ };
+    {
+        retired.frameCounter = frameCounter_;
+        retired.swapChain = std::move(swapChain_);
+        swapChain_ = VKPtr<VkSwapchainKHR>{ device_, vkDestroySwapchainKHR };
+        std::swap(retired.imageViews, swapChainImageViews_);
+        std::swap(retired.framebuffers, swapChainFramebuffers_);
+    }
+
+    /*
+    Semaphores of a retired swap-chain might still be waited on by the presentation engine and the image-available semaphore
+    of the current frame might already be signaled by an acquisition, so all of them are replaced.
+    The in-flight fences are kept, since the fence of the current frame has been reset and is still submitted with the next presentation.
+    */
+    for_range(i, numFramesInFlight_)
+    {
+        retired.semaphores.push_back(std::move(imageAvailableSemaphore_[i]));
+        retired.semaphores.push_back(std::move(renderFinishedSemaphore_[i]));
+        imageAvailableSemaphore_[i] = NullVkSemaphore(device_);
+        renderFinishedSemaphore_[i] = NullVkSemaphore(device_);
+        CreateGpuSemaphore(imageAvailableSemaphore_[i]);
+        CreateGpuSemaphore(renderFinishedSemaphore_[i]);
+
+        /* The present fence of the current frame has been reset for its next presentation and is not pending, so it can be kept as well */
+        if (presentFenceSupported_ && i != currentFrameInFlight_)
+        {
+            retired.presentFences.push_back(std::move(presentFences_[i]));
+            presentFences_[i] = NullVkFence(device_);
+            CreateGpuFence(presentFences_[i]);
+        }
+    }
+
+    retiredSwapChains_.push_back(std::move(retired));
+    return retiredSwapChains_.back();
+}
+
+void VKSwapChain::ReleaseRetiredSwapChains()
+{
+    /* Every frame in flight has waited on its fence once since a swap-chain was retired, so the GPU no longer uses its resources */
+    while (!retiredSwapChains_.empty() && frameCounter_ >= retiredSwapChains_.front().frameCounter + numFramesInFlight_)
+    {
+        /* Semaphores must not be destroyed before the presentations that wait on them have released them */
+        for (const VKPtr<VkFence>& presentFence : retiredSwapChains_.front().presentFences)
+            vkWaitForFences(device_, 1, presentFence.GetAddressOf(), VK_TRUE, UINT64_MAX);
+        retiredSwapChains_.pop_front();
+    }
 }
 
 VkSurfaceFormatKHR VKSwapChain::PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const
@@ -658,17 +954,64 @@ VkSurfaceFormatKHR VKSwapChain::PickSwapSurfaceFormat(const std::vector<VkSurfac
     if (surfaceFormats.size() == 1 && surfaceFormats.front().format == VK_FORMAT_UNDEFINED)
         return { VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
 
+    #if VK_EXT_swapchain_colorspace
+    /* Surfaces only report HDR color spaces if VK_EXT_swapchain_colorspace is enabled; Fall back to sRGB otherwise */
+    if (colorSpace_ != ColorSpace::SRGB)
+    {
+        const VkSurfaceFormatKHR preferredFormat =
+        (
+            colorSpace_ == ColorSpace::HDR10
+                ? VkSurfaceFormatKHR{ VK_FORMAT_A2B10G10R10_UNORM_PACK32, VK_COLOR_SPACE_HDR10_ST2084_EXT }
+                : VkSurfaceFormatKHR{ VK_FORMAT_R16G16B16A16_SFLOAT, VK_COLOR_SPACE_EXTENDED_SRGB_LINEAR_EXT }
+        );
+        for (const VkSurfaceFormatKHR& format : surfaceFormats)
+        {
+            if (format.format == preferredFormat.format && format.colorSpace == preferredFormat.colorSpace)
+                return format;
+        }
+    }
+    #endif
+
     for (const VkSurfaceFormatKHR& format : surfaceFormats)
     {
         if (format.format == VK_FORMAT_B8G8R8A8_UNORM && format.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR)
             return format;
     }
 
+    /* Prefer any format in sRGB color space over other color spaces */
+    for (const VkSurfaceFormatKHR& format : surfaceFormats)
+    {
+        if (format.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR)
+            return format;
+    }
+
     return surfaceFormats.front();
 }
 
+static VkPresentModeKHR ToVkPresentMode(PresentMode mode)
+{
+    switch (mode)
+    {
+        case PresentMode::FifoRelaxed:  return VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+        case PresentMode::Mailbox:      return VK_PRESENT_MODE_MAILBOX_KHR;
+        case PresentMode::Immediate:    return VK_PRESENT_MODE_IMMEDIATE_KHR;
+        default:                        return VK_PRESENT_MODE_FIFO_KHR;
+    }
+}
+
 VkPresentModeKHR VKSwapChain::PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, std::uint32_t vsyncInterval) const
 {
+    /* Use explicitly selected presentation mode if it is supported */
+    if (presentMode_ != PresentMode::Default)
+    {
+        const VkPresentModeKHR preferredMode = ToVkPresentMode(presentMode_);
+        for (const VkPresentModeKHR& mode : presentModes)
+        {
+            if (mode == preferredMode)
+                return mode;
+        }
+    }
+
     if (vsyncInterval == 0)
     {
         /* Check if MAILBOX or IMMEDIATE presentation mode is available, to avoid vertical synchronization */
@@ -690,6 +1033,37 @@ VkExtent2D VKSwapChain::PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCa
     };
 }
 
+VkSurfaceTransformFlagBitsKHR VKSwapChain::PickSwapSurfaceTransform(const VkSurfaceCapabilitiesKHR& surfaceCaps) const
+{
+    /* Pre-rotate images to the current display orientation, so the presentation engine doesn't need an extra rotation pass */
+    if (preTransform_ && (surfaceCaps.supportedTransforms & surfaceCaps.currentTransform) != 0)
+        return surfaceCaps.currentTransform;
+
+    /* Prefer identity transformation */
+    if ((surfaceCaps.supportedTransforms & VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR) != 0)
+        return VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+
+    return surfaceCaps.currentTransform;
+}
+
+VkCompositeAlphaFlagBitsKHR VKSwapChain::PickSwapCompositeAlpha(const VkSurfaceCapabilitiesKHR& surfaceCaps) const
+{
+    /* Prefer opaque composition, but Android surfaces often only support the inherited mode of the native window */
+    const VkCompositeAlphaFlagBitsKHR preferredModes[] =
+    {
+        VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+        VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR,
+        VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR,
+        VK_COMPOSITE_ALPHA_POST_MULTIPLIED_BIT_KHR,
+    };
+    for (VkCompositeAlphaFlagBitsKHR mode : preferredModes)
+    {
+        if ((surfaceCaps.supportedCompositeAlpha & mode) != 0)
+            return mode;
+    }
+    return VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+}
+
 static std::vector<VkFormat> GetDepthStencilFormatPreference(int depthBits, int stencilBits)
 {
     if (stencilBits == 0)
@@ -726,10 +1100,303 @@ std::uint32_t VKSwapChain::PickSwapChainSize(std::uint32_t swapBuffers) const
     );
 }
 
+void VKSwapChain::PresentAndAcquireNextColorBuffer()
+{
+    BeginPresentation();
+
+    /* Submit signal semaphore to graphics queue; the present queue is locked with it, since it is usually the same queue */
+    std::lock_guard<std::recursive_mutex> guard{ queueMutex_ };
+    VkSemaphore signalSemaphores[] = { SubmitRenderFinishedSemaphore() };
+
+    /* Present result on screen */
+    VkPresentInfoKHR presentInfo;
+    {
+        presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.pNext               = nullptr;
+        presentInfo.waitSemaphoreCount  = 1;
+        presentInfo.pWaitSemaphores     = signalSemaphores;
+        presentInfo.swapchainCount      = 1;
+        presentInfo.pSwapchains         = swapChain_.GetAddressOf();
+        presentInfo.pImageIndices       = &currentColorBuffer_;
+        presentInfo.pResults            = nullptr;
+    }
+
+    #if VK_KHR_present_id
+    /* Tag presentation with an ID so WaitForNextFrame() can wait for it to be completed */
+    VkPresentIdKHR presentIdInfo;
+    if (presentWaitSupported_)
+    {
+        ++presentId_;
+        presentIdInfo.sType             = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentIdInfo.pNext             = nullptr;
+        presentIdInfo.swapchainCount    = 1;
+        presentIdInfo.pPresentIds       = &presentId_;
+        presentInfo.pNext               = &presentIdInfo;
+    }
+    #endif
+
+    #if VK_EXT_swapchain_maintenance1
+    /* Signal present fence once the presentation engine no longer waits on the render-finished semaphore */
+    VkSwapchainPresentFenceInfoEXT presentFenceInfo;
+    if (presentFenceSupported_)
+    {
+        presentFenceInfo.sType              = VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT;
+        presentFenceInfo.pNext              = presentInfo.pNext;
+        presentFenceInfo.swapchainCount     = 1;
+        presentFenceInfo.pFences            = presentFences_[currentFrameInFlight_].GetAddressOf();
+        presentInfo.pNext                   = &presentFenceInfo;
+    }
+    #endif
+
+    #if VK_GOOGLE_display_timing
+    /* Tag presentation with an ID so its display time can be queried with vkGetPastPresentationTimingGOOGLE() */
+    VkPresentTimeGOOGLE presentTime;
+    VkPresentTimesInfoGOOGLE presentTimesInfo;
+    if (displayTimingSupported_)
+    {
+        presentTime.presentID               = ++displayTimingPresentId_;
+        presentTime.desiredPresentTime      = (framePacing_ ? ScheduleDesiredPresentTime() : 0);
+        presentTimesInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE;
+        presentTimesInfo.pNext              = presentInfo.pNext;
+        presentTimesInfo.swapchainCount     = 1;
+        presentTimesInfo.pTimes             = &presentTime;
+        presentInfo.pNext                   = &presentTimesInfo;
+    }
+    #endif
+
+    VkResult result = vkQueuePresentKHR(presentQueue_, &presentInfo);
+    VKThrowIfFailed(result, "failed to present Vulkan graphics queue");
+
+    FinishPresentation();
+}
+
+void VKSwapChain::PresentBatch(std::uint32_t numSwapChains, VKSwapChain* const * swapChains)
+{
+    if (numSwapChains == 0)
+        return;
+
+    if (SubmissionThread* submissionThread = swapChains[0]->submissionThread_)
+    {
+        /* Present the entire batch with a single job; each swap-chain waits for the same ticket (see AcquireColorBufferOnce) */
+        std::vector<VKSwapChain*> batch{ swapChains, swapChains + numSwapChains };
+        const std::uint64_t ticket = submissionThread->Enqueue(
+            [batch]() -> void
+            {
+                PresentBatchAndAcquireNextColorBuffers(static_cast<std::uint32_t>(batch.size()), batch.data());
+            }
+        );
+        for_range(i, numSwapChains)
+            swapChains[i]->presentTicket_ = ticket;
+    }
+    else
+        PresentBatchAndAcquireNextColorBuffers(numSwapChains, swapChains);
+}
+
+bool VKSwapChain::IsPresentBatchCompatible(const VKSwapChain& other) const
+{
+    return
+    (
+        presentQueue_           == other.presentQueue_          &&
+        &queueMutex_            == &other.queueMutex_           &&
+        submissionThread_       == other.submissionThread_      &&
+        presentWaitSupported_   == other.presentWaitSupported_  &&
+        presentFenceSupported_  == other.presentFenceSupported_ &&
+        displayTimingSupported_ == other.displayTimingSupported_
+    );
+}
+
+void VKSwapChain::BeginPresentation()
+{
+    BeginFrameStatisticsStall();
+
+    /* An image must have been acquired before it can be presented, even if nothing was rendered into it */
+    AcquireColorBufferOnce();
+}
+
+VkSemaphore VKSwapChain::SubmitRenderFinishedSemaphore()
+{
+    /* Initialize semaphores */
+    VkSemaphore waitSemaphores[] = { imageAvailableSemaphore_[currentFrameInFlight_] };
+    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+    VkSemaphore signalSemaphores[] = { renderFinishedSemaphore_[currentFrameInFlight_] };
+
+    VkSubmitInfo submitInfo;
+    {
+        submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.pNext                = nullptr;
+        submitInfo.waitSemaphoreCount   = 1;
+        submitInfo.pWaitSemaphores      = waitSemaphores;
+        submitInfo.pWaitDstStageMask    = waitStages;
+        submitInfo.commandBufferCount   = 0;
+        submitInfo.pCommandBuffers      = nullptr;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores    = signalSemaphores;
+    }
+    VkResult result = vkQueueSubmit(graphicsQueue_, 1, &submitInfo, inFlightFences_[currentFrameInFlight_]);
+    VKThrowIfFailed(result, "failed to submit semaphore to Vulkan graphics queue");
+
+    return signalSemaphores[0];
+}
+
+void VKSwapChain::FinishPresentation()
+{
+    /* Move to next frame */
+    AcquireNextColorBuffer();
+
+    EndFrameStatisticsStall(true);
+
+    if (displayTimingSupported_ && HasFrameStatistics())
+        RecordPastPresentationTimings();
+}
+
+void VKSwapChain::PresentBatchAndAcquireNextColorBuffers(std::uint32_t numSwapChains, VKSwapChain* const * swapChains)
+{
+    if (numSwapChains == 1)
+    {
+        swapChains[0]->PresentAndAcquireNextColorBuffer();
+        return;
+    }
+
+    /* All swap-chains in the batch share the same queues and extensions, so the first one determines the present info */
+    VKSwapChain& primary = *swapChains[0];
+
+    SmallVector<VkSemaphore, 4>     waitSemaphores;
+    SmallVector<VkSwapchainKHR, 4>  swapChainsVK;
+    SmallVector<std::uint32_t, 4>   imageIndices;
+
+    waitSemaphores.reserve(numSwapChains);
+    swapChainsVK.reserve(numSwapChains);
+    imageIndices.reserve(numSwapChains);
+
+    for_range(i, numSwapChains)
+        swapChains[i]->BeginPresentation();
+
+    /* Submit signal semaphores of all swap-chains to the graphics queue; the present queue is locked with it, since it is usually the same queue */
+    std::lock_guard<std::recursive_mutex> guard{ primary.queueMutex_ };
+    for_range(i, numSwapChains)
+    {
+        VKSwapChain* swapChain = swapChains[i];
+        waitSemaphores.push_back(swapChain->SubmitRenderFinishedSemaphore());
+        swapChainsVK.push_back(swapChain->swapChain_.Get());
+        imageIndices.push_back(swapChain->currentColorBuffer_);
+    }
+
+    /* Present results of all swap-chains on screen at once */
+    VkPresentInfoKHR presentInfo;
+    {
+        presentInfo.sType               = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.pNext               = nullptr;
+        presentInfo.waitSemaphoreCount  = numSwapChains;
+        presentInfo.pWaitSemaphores     = waitSemaphores.data();
+        presentInfo.swapchainCount      = numSwapChains;
+        presentInfo.pSwapchains         = swapChainsVK.data();
+        presentInfo.pImageIndices       = imageIndices.data();
+        presentInfo.pResults            = nullptr;
+    }
+
+    #if VK_KHR_present_id
+    /* Tag each presentation with an ID of its own swap-chain, see PresentAndAcquireNextColorBuffer() */
+    SmallVector<std::uint64_t, 4> presentIds;
+    VkPresentIdKHR presentIdInfo;
+    if (primary.presentWaitSupported_)
+    {
+        presentIds.reserve(numSwapChains);
+        for_range(i, numSwapChains)
+            presentIds.push_back(++swapChains[i]->presentId_);
+        presentIdInfo.sType             = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentIdInfo.pNext             = nullptr;
+        presentIdInfo.swapchainCount    = numSwapChains;
+        presentIdInfo.pPresentIds       = presentIds.data();
+        presentInfo.pNext               = &presentIdInfo;
+    }
+    #endif
+
+    #if VK_EXT_swapchain_maintenance1
+    SmallVector<VkFence, 4> presentFences;
+    VkSwapchainPresentFenceInfoEXT presentFenceInfo;
+    if (primary.presentFenceSupported_)
+    {
+        presentFences.reserve(numSwapChains);
+        for_range(i, numSwapChains)
+            presentFences.push_back(swapChains[i]->presentFences_[swapChains[i]->currentFrameInFlight_].Get());
+        presentFenceInfo.sType              = VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT;
+        presentFenceInfo.pNext              = presentInfo.pNext;
+        presentFenceInfo.swapchainCount     = numSwapChains;
+        presentFenceInfo.pFences            = presentFences.data();
+        presentInfo.pNext                   = &presentFenceInfo;
+    }
+    #endif
+
+    #if VK_GOOGLE_display_timing
+    SmallVector<VkPresentTimeGOOGLE, 4> presentTimes;
+    VkPresentTimesInfoGOOGLE presentTimesInfo;
+    if (primary.displayTimingSupported_)
+    {
+        presentTimes.resize(numSwapChains);
+        for_range(i, numSwapChains)
+        {
+            VKSwapChain* swapChain = swapChains[i];
+            presentTimes[i].presentID           = ++swapChain->displayTimingPresentId_;
+            presentTimes[i].desiredPresentTime  = (swapChain->framePacing_ ? swapChain->ScheduleDesiredPresentTime() : 0);
+        }
+        presentTimesInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE;
+        presentTimesInfo.pNext              = presentInfo.pNext;
+        presentTimesInfo.swapchainCount     = numSwapChains;
+        presentTimesInfo.pTimes             = presentTimes.data();
+        presentInfo.pNext                   = &presentTimesInfo;
+    }
+    #endif
+
+    VkResult result = vkQueuePresentKHR(primary.presentQueue_, &presentInfo);
+    VKThrowIfFailed(result, "failed to present batch of Vulkan swap-chains");
+
+    for_range(i, numSwapChains)
+        swapChains[i]->FinishPresentation();
+}
+
+void VKSwapChain::WaitForPendingPresent() const
+{
+    if (submissionThread_ != nullptr)
+        submissionThread_->Wait(presentTicket_);
+}
+
+void VKSwapChain::FlushSubmissionThread()
+{
+    if (submissionThread_ != nullptr)
+        submissionThread_->Flush();
+}
+
 void VKSwapChain::AcquireNextColorBuffer()
 {
-    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % maxNumFramesInFlight;
+    currentFrameInFlight_ = (currentFrameInFlight_ + 1) % numFramesInFlight_;
     vkWaitForFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf(), VK_TRUE, UINT64_MAX);
+    vkResetFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf());
+
+    /* Wait until the previous presentation of this frame no longer uses its semaphore */
+    if (presentFenceSupported_)
+    {
+        vkWaitForFences(device_, 1, presentFences_[currentFrameInFlight_].GetAddressOf(), VK_TRUE, UINT64_MAX);
+        vkResetFences(device_, 1, presentFences_[currentFrameInFlight_].GetAddressOf());
+    }
+
+    /* Release swap-chains that have been replaced during a resize once no frame in flight uses them anymore */
+    ++frameCounter_;
+    if (!retiredSwapChains_.empty())
+        ReleaseRetiredSwapChains();
+
+    /* Defer image acquisition until the image is needed, so the render thread can encode commands in the meantime */
+    isColorBufferAcquired_ = false;
+    if (!lateImageAcquire_)
+        AcquireColorBufferOnce();
+}
+
+void VKSwapChain::AcquireColorBufferOnce() const
+{
+    /* The next image is acquired when the pending presentation has moved to the next frame, unless late image acquisition is enabled */
+    WaitForPendingPresent();
+
+    if (isColorBufferAcquired_)
+        return;
 
     vkAcquireNextImageKHR(
         device_,
@@ -746,7 +1413,51 @@ void VKSwapChain::AcquireNextColorBuffer()
         currentColorBuffer_, numColorBuffers_
     );
 
-    vkResetFences(device_, 1, inFlightFences_[currentFrameInFlight_].GetAddressOf());
+    isColorBufferAcquired_ = true;
+}
+
+void VKSwapChain::RecordPastPresentationTimings()
+{
+    #if VK_GOOGLE_display_timing
+    /* Query all presentation timings that became available since the last call */
+    std::uint32_t numTimings = 0;
+    if (vkGetPastPresentationTimingGOOGLE(device_, swapChain_, &numTimings, nullptr) != VK_SUCCESS || numTimings == 0)
+        return;
+
+    constexpr std::uint32_t maxNumTimings = 16;
+    VkPastPresentationTimingGOOGLE timings[maxNumTimings];
+    numTimings = std::min(numTimings, maxNumTimings);
+
+    /* VK_INCOMPLETE only means that older timings are still pending for the next call */
+    const VkResult result = vkGetPastPresentationTimingGOOGLE(device_, swapChain_, &numTimings, timings);
+    if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+        return;
+
+    for_range(i, numTimings)
+        RecordFrameDisplayTime(timings[i].presentID, timings[i].actualPresentTime);
+    #endif
+}
+
+std::uint64_t VKSwapChain::ScheduleDesiredPresentTime()
+{
+    #ifdef LLGL_OS_ANDROID
+    /* Without v-sync, frames are shown as soon as possible */
+    if (vsyncInterval_ == 0)
+        return 0;
+
+    /*
+    The FIFO presentation mode always presents on the next vertical blank, so v-sync intervals greater than 1 rely on the desired presentation time.
+    Aim half a refresh period ahead of the target, so jitter does not postpone the frame by another vertical blank.
+    */
+    AndroidChoreographer& choreographer = AndroidChoreographer::Get();
+    const std::int64_t targetVsync = choreographer.ScheduleNextVsync(lastPresentVsync_, vsyncInterval_);
+    if (targetVsync > 0)
+    {
+        lastPresentVsync_ = targetVsync;
+        return static_cast<std::uint64_t>(targetVsync - choreographer.GetRefreshPeriod()/2);
+    }
+    #endif
+    return 0;
 }
 
 
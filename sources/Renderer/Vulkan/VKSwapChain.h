@@ -19,6 +19,8 @@
 #include "Texture/VKColorBuffer.h"
 #include <memory>
 #include <vector>
+#include <deque>
+#include <mutex>
 
 
 namespace LLGL
@@ -26,8 +28,10 @@ namespace LLGL
 
 
 class VKCommandContext;
+class VKDevice;
 class VKDeviceMemoryManager;
 class VKDeviceMemoryRegion;
+class SubmissionThread;
 
 class VKSwapChain final : public SwapChain
 {
@@ -36,18 +40,34 @@ class VKSwapChain final : public SwapChain
 
         #include <LLGL/Backend/SwapChain.inl>
 
+    public:
+
+        bool WaitForNextFrame(std::uint64_t timeout) override;
+
+        bool GetCurrentBackBufferNativeHandle(void* nativeHandle, std::size_t nativeHandleSize) override;
+
+        SurfaceTransform GetSurfaceTransform() const override;
+
+        ColorSpace GetColorSpace() const override;
+
+        bool GetFrameStatistics(FrameStatistics& outStatistics) const override;
+
     public:
 
         VKSwapChain(
             VkInstance                      instance,
             VkPhysicalDevice                physicalDevice,
-            VkDevice                        device,
+            VKDevice&                       device,
             VKDeviceMemoryManager&          deviceMemoryMngr,
             const SwapChainDescriptor&      desc,
             const std::shared_ptr<Surface>& surface,
-            const RendererInfo&             rendererInfo
+            const RendererInfo&             rendererInfo,
+            SubmissionThread*               submissionThread    = nullptr
         );
 
+        // Waits for the pending presentation on the submission thread, since it references this swap-chain.
+        ~VKSwapChain();
+
         // Returns the swap-chain render pass object.
         inline const VKRenderPass& GetSwapChainRenderPass() const
         {
@@ -60,7 +80,13 @@ class VKSwapChain final : public SwapChain
             return secondaryRenderPass_.GetVkRenderPass();
         }
 
-        // Returns the actual swap buffer index.
+        // Returns the Vulkan render pass object that clears all attachments. Only used without VK_KHR_dynamic_rendering.
+        inline VkRenderPass GetClearVkRenderPass() const
+        {
+            return clearRenderPass_.GetVkRenderPass();
+        }
+
+        // Returns the actual swap buffer index. This acquires the next swap-chain image if it has been deferred until first use.
         std::uint32_t TranslateSwapIndex(std::uint32_t swapBufferIndex) const;
 
         // Returns the native VkFramebuffer object that is currently used from swap-chain.
@@ -69,6 +95,9 @@ class VKSwapChain final : public SwapChain
             return swapChainFramebuffers_[swapBufferIndex].Get();
         }
 
+        // Returns the attachments of the specified swap buffer for dynamic rendering. Only used with VK_KHR_dynamic_rendering.
+        VKRenderingAttachmentSet GetRenderingAttachments(std::uint32_t swapBufferIndex) const;
+
         // Returns the swap-chain resolution as VkExtent2D.
         inline const VkExtent2D& GetVkExtent() const
         {
@@ -92,6 +121,24 @@ class VKSwapChain final : public SwapChain
             VkFormat                format
         );
 
+    private:
+
+        // Resources of a replaced swap-chain, which may still be used by frames in flight.
+        struct RetiredSwapChain
+        {
+            RetiredSwapChain(VkDevice device);
+
+            VKPtr<VkSurfaceKHR>                 surface;        // Only used if the native window has been replaced; Declared first, so it's destroyed after the swap-chain
+            VKPtr<VkSwapchainKHR>               swapChain;
+            std::vector<VKPtr<VkImageView>>     imageViews;
+            std::vector<VKPtr<VkFramebuffer>>   framebuffers;
+            VKDepthStencilBuffer                depthStencilBuffer;
+            std::vector<VKColorBuffer>          colorBuffers;
+            std::vector<VKPtr<VkSemaphore>>     semaphores;
+            std::vector<VKPtr<VkFence>>         presentFences;  // Only used with VK_EXT_swapchain_maintenance1
+            std::uint64_t                       frameCounter    = 0;
+        };
+
     private:
 
         bool ResizeBuffersPrimary(const Extent2D& resolution) override;
@@ -104,24 +151,78 @@ class VKSwapChain final : public SwapChain
         void CreateRenderPass(VKRenderPass& renderPass, AttachmentLoadOp loadOp, AttachmentStoreOp storeOp);
         void CreateDefaultAndSecondaryRenderPass();
 
-        void CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval);
+        void CreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval, VkSwapchainKHR oldSwapChain = VK_NULL_HANDLE);
         void CreateSwapChainImageViews();
         void CreateSwapChainFramebuffers();
 
-        void CreateDepthStencilBuffer(const Extent2D& resolution);
-        void CreateColorBuffers(const Extent2D& resolution);
-        void ReleaseRenderBuffers();
+        void CreateDepthStencilBuffer(const Extent2D& extent);
+        void CreateColorBuffers(const Extent2D& extent);
+        void CreateRenderBuffers(const Extent2D& extent);
+
+        // Returns true if the depth-stencil and multi-sampled color buffers can be re-used for the current swap-chain extent.
+        bool CanReuseRenderBuffers() const;
 
         void CreateResolutionDependentResources(const Extent2D& resolution);
 
+        // Replaces the swap-chain without waiting for the GPU to be idle. The previous resources are released once all frames in flight have completed.
+        void RecreateSwapChain(const Extent2D& resolution, std::uint32_t vsyncInterval);
+
+        // Moves the swap-chain objects and presentation semaphores into a new entry of retired swap-chains.
+        RetiredSwapChain& RetireSwapChain();
+
+        // Releases all retired swap-chains that are no longer used by any frame in flight.
+        void ReleaseRetiredSwapChains();
+
         VkSurfaceFormatKHR PickSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& surfaceFormats) const;
         VkPresentModeKHR PickSwapPresentMode(const std::vector<VkPresentModeKHR>& presentModes, std::uint32_t vsyncInterval) const;
         VkExtent2D PickSwapExtent(const VkSurfaceCapabilitiesKHR& surfaceCaps, const Extent2D& resolution) const;
+        VkSurfaceTransformFlagBitsKHR PickSwapSurfaceTransform(const VkSurfaceCapabilitiesKHR& surfaceCaps) const;
+        VkCompositeAlphaFlagBitsKHR PickSwapCompositeAlpha(const VkSurfaceCapabilitiesKHR& surfaceCaps) const;
         VkFormat PickDepthStencilFormat(int depthBits, int stencilBits) const;
         std::uint32_t PickSwapChainSize(std::uint32_t swapBuffers) const;
 
+        // Submits the present semaphore and presents the current swap-chain image. This is executed on the submission thread if there is one.
+        void PresentAndAcquireNextColorBuffer();
+
+        /*
+        Presents all specified swap-chains with a single call to vkQueuePresentKHR. This is executed on the submission thread if there is one.
+        All swap-chains must be compatible with the first one (see IsPresentBatchCompatible) and each swap-chain must only appear once.
+        */
+        static void PresentBatch(std::uint32_t numSwapChains, VKSwapChain* const * swapChains);
+
+        // Returns true if this swap-chain can be presented in the same batch as the specified swap-chain, i.e. they share the same present queue and extensions.
+        bool IsPresentBatchCompatible(const VKSwapChain& other) const;
+
+        // Waits until the pending presentation of this swap-chain has been executed by the submission thread.
+        void WaitForPendingPresent() const;
+
+        // Waits until all pending jobs of the submission thread have been executed, e.g. before the swap-chain is recreated.
+        void FlushSubmissionThread();
+
+        // Moves to the next frame in flight and acquires the next swap-chain image, unless late image acquisition is enabled.
         void AcquireNextColorBuffer();
 
+        // Acquires the next swap-chain image if it has not been acquired for the current frame yet.
+        void AcquireColorBufferOnce() const;
+
+        // Begins a presentation and acquires the current swap-chain image if it has not been acquired yet.
+        void BeginPresentation();
+
+        // Submits the semaphore that is signaled once the current swap-chain image can be presented. The queue mutex must be locked.
+        VkSemaphore SubmitRenderFinishedSemaphore();
+
+        // Ends a presentation after the current swap-chain image has been presented and moves to the next frame.
+        void FinishPresentation();
+
+        // Presents all specified swap-chains on the calling thread. See PresentBatch().
+        static void PresentBatchAndAcquireNextColorBuffers(std::uint32_t numSwapChains, VKSwapChain* const * swapChains);
+
+        // Records the past presentation timings reported by VK_GOOGLE_display_timing into the frame statistics.
+        void RecordPastPresentationTimings();
+
+        // Returns the desired presentation time of the next frame for frame pacing, or 0 if the frame can be shown on the next vertical blank.
+        std::uint64_t ScheduleDesiredPresentTime();
+
     private:
 
         static constexpr std::uint32_t maxNumFramesInFlight = 3;
@@ -131,8 +232,14 @@ class VKSwapChain final : public SwapChain
         VkDevice                            device_;
 
         VKDeviceMemoryManager&              deviceMemoryMngr_;
+        std::recursive_mutex&               queueMutex_;                                // Mutex of the graphics queue, see VKDevice::GetQueueMutex()
+        SubmissionThread*                   submissionThread_                           = nullptr;
+        std::uint64_t                       presentTicket_                              = 0; // Ticket of the most recent presentation on the submission thread
 
         VKPtr<VkSurfaceKHR>                 surface_;
+        #ifdef LLGL_OS_ANDROID
+        ANativeWindow*                      surfaceWindow_                              = nullptr; // Native window the surface was created for
+        #endif
         VKSurfaceSupportDetails             surfaceSupportDetails_;
 
         VKPtr<VkSwapchainKHR>               swapChain_;
@@ -140,27 +247,49 @@ class VKSwapChain final : public SwapChain
         VkSurfaceFormatKHR                  swapChainFormat_                            = {};
         std::uint32_t                       swapChainSamples_                           = 1;
         VkExtent2D                          swapChainExtent_                            = { 0, 0 };
+        VkSurfaceTransformFlagBitsKHR       swapChainTransform_                         = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+        bool                                preTransform_                               = false;
         std::vector<VkImage>                swapChainImages_;
         std::vector<VKPtr<VkImageView>>     swapChainImageViews_;
         std::vector<VKPtr<VkFramebuffer>>   swapChainFramebuffers_;
 
         std::uint32_t                       numPreferredColorBuffers_                   = 2;
         std::uint32_t                       numColorBuffers_                            = 0;
-        std::uint32_t                       currentColorBuffer_                         = 0; // determined by vkAcquireNextImageKHR
+        mutable std::uint32_t               currentColorBuffer_                         = 0; // determined by vkAcquireNextImageKHR
+        mutable bool                        isColorBufferAcquired_                      = false;
+        bool                                lateImageAcquire_                           = false;
         std::uint32_t                       currentFrameInFlight_                       = 0; // current index for maximum frames in flight
+        std::uint32_t                       numFramesInFlight_                          = maxNumFramesInFlight;
         std::uint32_t                       vsyncInterval_                              = 0;
+        PresentMode                         presentMode_                                = PresentMode::Default;
+        ColorSpace                          colorSpace_                                 = ColorSpace::SRGB; // Requested color space
 
         VKRenderPass                        secondaryRenderPass_;
+        VKRenderPass                        clearRenderPass_;                           // Compatible render pass to fold clear commands into the load operations
         VkFormat                            depthStencilFormat_                         = VK_FORMAT_UNDEFINED;
         VKDepthStencilBuffer                depthStencilBuffer_;
         std::vector<VKColorBuffer>          colorBuffers_;
+        VkExtent2D                          renderBufferExtent_                         = { 0, 0 }; // Allocated extent of depth-stencil and multi-sampled color buffers
 
         VkQueue                             graphicsQueue_                              = VK_NULL_HANDLE;
         VkQueue                             presentQueue_                               = VK_NULL_HANDLE;
 
+        std::uint64_t                       presentId_                                  = 0; // ID of the last presentation, only used with VK_KHR_present_wait
+        bool                                presentWaitSupported_                       = false;
+
+        std::uint32_t                       displayTimingPresentId_                     = 0; // ID of the last presentation, only used with VK_GOOGLE_display_timing
+        bool                                displayTimingSupported_                     = false;
+        bool                                framePacing_                                = false; // Only used with VK_GOOGLE_display_timing on Android
+        std::int64_t                        lastPresentVsync_                           = 0;
+
         VKPtr<VkSemaphore>                  imageAvailableSemaphore_[maxNumFramesInFlight];
         VKPtr<VkSemaphore>                  renderFinishedSemaphore_[maxNumFramesInFlight];
         VKPtr<VkFence>                      inFlightFences_[maxNumFramesInFlight];
+        VKPtr<VkFence>                      presentFences_[maxNumFramesInFlight];       // Only used with VK_EXT_swapchain_maintenance1
+        bool                                presentFenceSupported_                      = false;
+
+        std::uint64_t                       frameCounter_                               = 0; // Number of frames that have been started, used to release retired swap-chains
+        std::deque<RetiredSwapChain>        retiredSwapChains_;                         // Declared last, so retired swap-chains are destroyed before the surface
 
 };
 
@@ -37,6 +37,18 @@ VkShaderStageFlagBits Map(const ShaderType shaderType)
         case ShaderType::Geometry:          return VK_SHADER_STAGE_GEOMETRY_BIT;
         case ShaderType::Fragment:          return VK_SHADER_STAGE_FRAGMENT_BIT;
         case ShaderType::Compute:           return VK_SHADER_STAGE_COMPUTE_BIT;
+        #if VK_EXT_mesh_shader
+        case ShaderType::Task:              return VK_SHADER_STAGE_TASK_BIT_EXT;
+        case ShaderType::Mesh:              return VK_SHADER_STAGE_MESH_BIT_EXT;
+        #else
+        case ShaderType::Task:              break;
+        case ShaderType::Mesh:              break;
+        #endif
+        case ShaderType::Tile:              break;
+        case ShaderType::RayGeneration:     break;
+        case ShaderType::Miss:              break;
+        case ShaderType::ClosestHit:        break;
+        case ShaderType::AnyHit:            break;
     }
     MapFailed("ShaderType", "VkShaderStageFlagBits");
 }
@@ -154,6 +166,10 @@ VkFormat Map(const Format format)
         case Format::BC4SNorm:          return VK_FORMAT_BC4_SNORM_BLOCK;
         case Format::BC5UNorm:          return VK_FORMAT_BC5_UNORM_BLOCK;
         case Format::BC5SNorm:          return VK_FORMAT_BC5_SNORM_BLOCK;
+        case Format::BC6HUFloat:        return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        case Format::BC6HSFloat:        return VK_FORMAT_BC6H_SFLOAT_BLOCK;
+        case Format::BC7UNorm:          return VK_FORMAT_BC7_UNORM_BLOCK;
+        case Format::BC7UNorm_sRGB:     return VK_FORMAT_BC7_SRGB_BLOCK;
 
         /* --- Advanced scalable texture compression (ASTC) formats --- */
         case Format::ASTC4x4:           return VK_FORMAT_ASTC_4x4_UNORM_BLOCK;
@@ -189,6 +205,47 @@ VkFormat Map(const Format format)
         case Format::ETC1UNorm:         break; // unsupported
         case Format::ETC2UNorm:         return VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK;
         case Format::ETC2UNorm_sRGB:    return VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK;
+        case Format::ETC2A1UNorm:       return VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK;
+        case Format::ETC2A1UNorm_sRGB:  return VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK;
+        case Format::ETC2A8UNorm:       return VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK;
+        case Format::ETC2A8UNorm_sRGB:  return VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK;
+        case Format::EACR11UNorm:       return VK_FORMAT_EAC_R11_UNORM_BLOCK;
+        case Format::EACR11SNorm:       return VK_FORMAT_EAC_R11_SNORM_BLOCK;
+        case Format::EACRG11UNorm:      return VK_FORMAT_EAC_R11G11_UNORM_BLOCK;
+        case Format::EACRG11SNorm:      return VK_FORMAT_EAC_R11G11_SNORM_BLOCK;
+
+        /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+        #if VK_EXT_texture_compression_astc_hdr
+        case Format::ASTC4x4Float:      return VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK_EXT;
+        case Format::ASTC5x4Float:      return VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK_EXT;
+        case Format::ASTC5x5Float:      return VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK_EXT;
+        case Format::ASTC6x5Float:      return VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK_EXT;
+        case Format::ASTC6x6Float:      return VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK_EXT;
+        case Format::ASTC8x5Float:      return VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK_EXT;
+        case Format::ASTC8x6Float:      return VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK_EXT;
+        case Format::ASTC8x8Float:      return VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK_EXT;
+        case Format::ASTC10x5Float:     return VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK_EXT;
+        case Format::ASTC10x6Float:     return VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK_EXT;
+        case Format::ASTC10x8Float:     return VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK_EXT;
+        case Format::ASTC10x10Float:    return VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK_EXT;
+        case Format::ASTC12x10Float:    return VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK_EXT;
+        case Format::ASTC12x12Float:    return VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK_EXT;
+        #else
+        case Format::ASTC4x4Float:      break;
+        case Format::ASTC5x4Float:      break;
+        case Format::ASTC5x5Float:      break;
+        case Format::ASTC6x5Float:      break;
+        case Format::ASTC6x6Float:      break;
+        case Format::ASTC8x5Float:      break;
+        case Format::ASTC8x6Float:      break;
+        case Format::ASTC8x8Float:      break;
+        case Format::ASTC10x5Float:     break;
+        case Format::ASTC10x6Float:     break;
+        case Format::ASTC10x8Float:     break;
+        case Format::ASTC10x10Float:    break;
+        case Format::ASTC12x10Float:    break;
+        case Format::ASTC12x12Float:    break;
+        #endif
     }
     MapFailed("Format", "VkFormat");
 }
@@ -372,6 +429,7 @@ VkQueryType Map(const QueryType queryType)
         case QueryType::StreamOutPrimitivesWritten:     return VK_QUERY_TYPE_TRANSFORM_FEEDBACK_STREAM_EXT;
         case QueryType::StreamOutOverflow:              return VK_QUERY_TYPE_TRANSFORM_FEEDBACK_STREAM_EXT;
         case QueryType::PipelineStatistics:             return VK_QUERY_TYPE_PIPELINE_STATISTICS;
+        case QueryType::Timestamp:                      return VK_QUERY_TYPE_TIMESTAMP;
     }
     MapFailed("QueryType", "VkQueryType");
 }
@@ -578,6 +636,10 @@ Format Unmap(const VkFormat format)
         case VK_FORMAT_BC4_SNORM_BLOCK:             return Format::BC4SNorm;
         case VK_FORMAT_BC5_UNORM_BLOCK:             return Format::BC5UNorm;
         case VK_FORMAT_BC5_SNORM_BLOCK:             return Format::BC5SNorm;
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:           return Format::BC6HUFloat;
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK:           return Format::BC6HSFloat;
+        case VK_FORMAT_BC7_UNORM_BLOCK:             return Format::BC7UNorm;
+        case VK_FORMAT_BC7_SRGB_BLOCK:              return Format::BC7UNorm_sRGB;
 
         /* --- Advanced scalable texture compression (ASTC) formats --- */
         case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:        return Format::ASTC4x4;
@@ -612,6 +674,32 @@ Format Unmap(const VkFormat format)
         /* --- Ericsson texture compression (ETC) formats --- */
         case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:     return Format::ETC2UNorm;
         case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:      return Format::ETC2UNorm_sRGB;
+        case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK:   return Format::ETC2A1UNorm;
+        case VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK:    return Format::ETC2A1UNorm_sRGB;
+        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:   return Format::ETC2A8UNorm;
+        case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:    return Format::ETC2A8UNorm_sRGB;
+        case VK_FORMAT_EAC_R11_UNORM_BLOCK:         return Format::EACR11UNorm;
+        case VK_FORMAT_EAC_R11_SNORM_BLOCK:         return Format::EACR11SNorm;
+        case VK_FORMAT_EAC_R11G11_UNORM_BLOCK:      return Format::EACRG11UNorm;
+        case VK_FORMAT_EAC_R11G11_SNORM_BLOCK:      return Format::EACRG11SNorm;
+
+        /* --- Advanced scalable texture compression (ASTC) HDR formats --- */
+        #if VK_EXT_texture_compression_astc_hdr
+        case VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK_EXT:   return Format::ASTC4x4Float;
+        case VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK_EXT:   return Format::ASTC5x4Float;
+        case VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK_EXT:   return Format::ASTC5x5Float;
+        case VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK_EXT:   return Format::ASTC6x5Float;
+        case VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK_EXT:   return Format::ASTC6x6Float;
+        case VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK_EXT:   return Format::ASTC8x5Float;
+        case VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK_EXT:   return Format::ASTC8x6Float;
+        case VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK_EXT:   return Format::ASTC8x8Float;
+        case VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK_EXT:  return Format::ASTC10x5Float;
+        case VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK_EXT:  return Format::ASTC10x6Float;
+        case VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK_EXT:  return Format::ASTC10x8Float;
+        case VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK_EXT: return Format::ASTC10x10Float;
+        case VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK_EXT: return Format::ASTC12x10Float;
+        case VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK_EXT: return Format::ASTC12x12Float;
+        #endif
 
         default:                                    return Format::Undefined;
     }
@@ -0,0 +1,140 @@
+/*
+ * WebGPUBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUBuffer.h"
+#include "../WebGPUTypes.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Exception.h"
+#include <LLGL/Backend/WebGPU/NativeHandle.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+static WGPUBufferUsageFlags GetWGPUBufferUsage(long bindFlags)
+{
+    /* Buffers are always updated via queue writes or copy commands, so CopyDst is implied */
+    WGPUBufferUsageFlags usage = (WGPUBufferUsage_CopyDst | WGPUBufferUsage_CopySrc);
+
+    if ((bindFlags & BindFlags::VertexBuffer) != 0)
+        usage |= WGPUBufferUsage_Vertex;
+    if ((bindFlags & BindFlags::IndexBuffer) != 0)
+        usage |= WGPUBufferUsage_Index;
+    if ((bindFlags & BindFlags::ConstantBuffer) != 0)
+        usage |= WGPUBufferUsage_Uniform;
+    if ((bindFlags & (BindFlags::Sampled | BindFlags::Storage)) != 0)
+        usage |= WGPUBufferUsage_Storage;
+    if ((bindFlags & BindFlags::IndirectBuffer) != 0)
+        usage |= WGPUBufferUsage_Indirect;
+    if ((bindFlags & BindFlags::CopyDst) != 0)
+        usage |= WGPUBufferUsage_QueryResolve;
+
+    return usage;
+}
+
+WebGPUBuffer::WebGPUBuffer(WGPUDevice device, const BufferDescriptor& desc, const void* initialData) :
+    Buffer          { desc.bindFlags                                },
+    size_           { desc.size                                     },
+    cpuAccessFlags_ { desc.cpuAccessFlags                           },
+    miscFlags_      { desc.miscFlags                                },
+    indexFormat_    { WebGPUTypes::ToWGPUIndexFormat(desc.format)   }
+{
+    /* WebGPU requires buffer sizes and write ranges to be a multiple of 4 bytes */
+    WGPUBufferDescriptor bufferDesc = {};
+    {
+        bufferDesc.label            = desc.debugName;
+        bufferDesc.usage            = GetWGPUBufferUsage(desc.bindFlags);
+        bufferDesc.size             = GetAlignedSize<std::uint64_t>(desc.size, 4);
+        bufferDesc.mappedAtCreation = (initialData != nullptr);
+    }
+    buffer_ = wgpuDeviceCreateBuffer(device, &bufferDesc);
+
+    if (initialData != nullptr)
+    {
+        void* mappedRange = wgpuBufferGetMappedRange(buffer_, 0, static_cast<std::size_t>(bufferDesc.size));
+        ::memcpy(mappedRange, initialData, static_cast<std::size_t>(desc.size));
+        wgpuBufferUnmap(buffer_);
+    }
+}
+
+WebGPUBuffer::~WebGPUBuffer()
+{
+    wgpuBufferDestroy(buffer_);
+    wgpuBufferRelease(buffer_);
+}
+
+void WebGPUBuffer::SetDebugName(const char* name)
+{
+    wgpuBufferSetLabel(buffer_, name);
+}
+
+bool WebGPUBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (auto* nativeHandleWGPU = GetTypedNativeHandle<WebGPU::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        nativeHandleWGPU->type      = WebGPU::ResourceNativeType::Buffer;
+        nativeHandleWGPU->buffer    = buffer_;
+        return true;
+    }
+    return false;
+}
+
+BufferDescriptor WebGPUBuffer::GetDesc() const
+{
+    BufferDescriptor bufferDesc;
+
+    bufferDesc.size             = GetSize();
+    bufferDesc.bindFlags        = GetBindFlags();
+    bufferDesc.cpuAccessFlags   = cpuAccessFlags_;
+    bufferDesc.miscFlags        = miscFlags_;
+
+    return bufferDesc;
+}
+
+void WebGPUBuffer::Write(WGPUQueue queue, std::uint64_t offset, const void* data, std::uint64_t dataSize)
+{
+    if (dataSize % 4 == 0)
+        wgpuQueueWriteBuffer(queue, buffer_, offset, data, static_cast<std::size_t>(dataSize));
+    else
+    {
+        /* Pad data to a multiple of 4 bytes; trailing bytes are undefined just like the padding of the buffer itself */
+        std::vector<char> paddedData(GetAlignedSize<std::size_t>(static_cast<std::size_t>(dataSize), 4), 0);
+        ::memcpy(paddedData.data(), data, static_cast<std::size_t>(dataSize));
+        wgpuQueueWriteBuffer(queue, buffer_, offset, paddedData.data(), paddedData.size());
+    }
+}
+
+void* WebGPUBuffer::Map(CPUAccess access, std::uint64_t offset, std::uint64_t length)
+{
+    /* Buffers can only be mapped asynchronously in WebGPU, which cannot be awaited in a browser's main thread */
+    if (access == CPUAccess::ReadOnly || access == CPUAccess::ReadWrite)
+        LLGL_TRAP_FEATURE_NOT_SUPPORTED("synchronous buffer read access in WebGPU");
+
+    /* Write into a CPU shadow copy that is uploaded when the buffer is unmapped */
+    mappedData_.resize(static_cast<std::size_t>(length));
+    mappedOffset_ = offset;
+
+    return mappedData_.data();
+}
+
+void WebGPUBuffer::Unmap(WGPUQueue queue)
+{
+    if (!mappedData_.empty())
+    {
+        Write(queue, mappedOffset_, mappedData_.data(), mappedData_.size());
+        mappedData_.clear();
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,90 @@
+/*
+ * WebGPUBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_BUFFER_H
+#define LLGL_WEBGPU_BUFFER_H
+
+
+#include <LLGL/Buffer.h>
+#include <LLGL/BufferFlags.h>
+#include <LLGL/RenderSystemFlags.h>
+#include "../WebGPU.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class WebGPUBuffer final : public Buffer
+{
+
+    public:
+
+        #include <LLGL/Backend/Buffer.inl>
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        WebGPUBuffer(WGPUDevice device, const BufferDescriptor& desc, const void* initialData = nullptr);
+        ~WebGPUBuffer();
+
+        WebGPUBuffer(const WebGPUBuffer&) = delete;
+        WebGPUBuffer& operator = (const WebGPUBuffer&) = delete;
+
+        // Writes the specified data into this buffer via the command queue. The size is padded to a multiple of 4 bytes.
+        void Write(WGPUQueue queue, std::uint64_t offset, const void* data, std::uint64_t dataSize);
+
+        // Maps the specified range into CPU memory. Only write access is supported, since WebGPU cannot map buffers synchronously.
+        void* Map(CPUAccess access, std::uint64_t offset, std::uint64_t length);
+
+        // Uploads the mapped range to the GPU.
+        void Unmap(WGPUQueue queue);
+
+        // Returns the native WGPUBuffer object.
+        inline WGPUBuffer GetNative() const
+        {
+            return buffer_;
+        }
+
+        // Returns the buffer size as specified at creation time (without padding).
+        inline std::uint64_t GetSize() const
+        {
+            return size_;
+        }
+
+        // Returns the index format if this buffer was created with an index format.
+        inline WGPUIndexFormat GetIndexFormat() const
+        {
+            return indexFormat_;
+        }
+
+    private:
+
+        WGPUBuffer          buffer_         = nullptr;
+        std::uint64_t       size_           = 0;
+        long                cpuAccessFlags_ = 0;
+        long                miscFlags_      = 0;
+        WGPUIndexFormat     indexFormat_    = WGPUIndexFormat_Undefined;
+
+        std::vector<char>   mappedData_;
+        std::uint64_t       mappedOffset_   = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,39 @@
+/*
+ * WebGPUBufferArray.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUBufferArray.h"
+#include "WebGPUBuffer.h"
+#include "../../CheckedCast.h"
+#include "../../BufferUtils.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+static std::vector<WebGPUBuffer*> GetWebGPUBuffers(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    std::vector<WebGPUBuffer*> buffers;
+    buffers.reserve(numBuffers);
+    for_range(i, numBuffers)
+        buffers.push_back(LLGL_CAST(WebGPUBuffer*, bufferArray[i]));
+    return buffers;
+}
+
+WebGPUBufferArray::WebGPUBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray) :
+    BufferArray { GetCombinedBindFlags(numBuffers, bufferArray) },
+    buffers     { GetWebGPUBuffers(numBuffers, bufferArray)       }
+{
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,44 @@
+/*
+ * WebGPUBufferArray.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_BUFFER_ARRAY_H
+#define LLGL_WEBGPU_BUFFER_ARRAY_H
+
+
+#include <LLGL/BufferArray.h>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class Buffer;
+class WebGPUBuffer;
+
+class WebGPUBufferArray final : public BufferArray
+{
+
+    public:
+
+        WebGPUBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray);
+
+    public:
+
+        const std::vector<WebGPUBuffer*> buffers;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
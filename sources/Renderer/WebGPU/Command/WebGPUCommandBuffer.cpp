@@ -0,0 +1,1210 @@
+/*
+ * WebGPUCommandBuffer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUCommandBuffer.h"
+#include "../WebGPUSwapChain.h"
+#include "../WebGPUTypes.h"
+#include "../Buffer/WebGPUBuffer.h"
+#include "../Buffer/WebGPUBufferArray.h"
+#include "../RenderState/WebGPUPipelineState.h"
+#include "../RenderState/WebGPUResourceHeap.h"
+#include "../RenderState/WebGPURenderPass.h"
+#include "../RenderState/WebGPUQueryHeap.h"
+#include "../Texture/WebGPUTexture.h"
+#include "../Texture/WebGPURenderTarget.h"
+#include "../../BufferUtils.h"
+#include "../../TextureUtils.h"
+#include "../../CheckedCast.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Exception.h"
+#include "../../FormatTable.h"
+#include <LLGL/Backend/WebGPU/NativeHandle.h>
+#include <LLGL/TypeInfo.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+namespace LLGL
+{
+
+
+// WebGPU requires the row pitch of buffer/texture copies to be a multiple of 256 bytes
+static constexpr std::uint32_t g_copyBytesPerRowAlignment = 256;
+
+WebGPUCommandBuffer::WebGPUCommandBuffer(WGPUDevice device, WGPUQueue queue, const CommandBufferDescriptor& desc) :
+    device_          { device                                                   },
+    queue_           { queue                                                    },
+    immediateSubmit_ { ((desc.flags & CommandBufferFlags::ImmediateSubmit) != 0) }
+{
+    for (WGPUBindGroup& bindGroup : bindGroups_)
+        bindGroup = nullptr;
+}
+
+WebGPUCommandBuffer::~WebGPUCommandBuffer()
+{
+    EndActivePasses();
+    if (commandEncoder_ != nullptr)
+        wgpuCommandEncoderRelease(commandEncoder_);
+    if (commandBuffer_ != nullptr)
+        wgpuCommandBufferRelease(commandBuffer_);
+    ReleaseTransientObjects();
+}
+
+void WebGPUCommandBuffer::Submit(WGPUQueue queue)
+{
+    if (commandBuffer_ != nullptr)
+    {
+        wgpuQueueSubmit(queue, 1, &commandBuffer_);
+        wgpuCommandBufferRelease(commandBuffer_);
+        commandBuffer_ = nullptr;
+    }
+}
+
+/* ----- Encoding ----- */
+
+void WebGPUCommandBuffer::Begin()
+{
+    /* Release command buffer that was never submitted and all transient objects of the previous encoding */
+    if (commandBuffer_ != nullptr)
+    {
+        wgpuCommandBufferRelease(commandBuffer_);
+        commandBuffer_ = nullptr;
+    }
+    ReleaseTransientObjects();
+
+    /* Reset all cached states */
+    boundPipelineState_     = nullptr;
+    boundPipelineLayout_    = nullptr;
+    pipelineDirty_          = false;
+    bindGroupDirtyBits_     = 0;
+    dynamicEntriesDirty_    = false;
+    occlusionQuerySet_      = nullptr;
+    renderState_            = RenderState{};
+    dynamicEntries_.clear();
+    for (WGPUBindGroup& bindGroup : bindGroups_)
+        bindGroup = nullptr;
+
+    commandEncoder_ = wgpuDeviceCreateCommandEncoder(device_, nullptr);
+}
+
+void WebGPUCommandBuffer::End()
+{
+    EndActivePasses();
+
+    commandBuffer_ = wgpuCommandEncoderFinish(commandEncoder_, nullptr);
+    wgpuCommandEncoderRelease(commandEncoder_);
+    commandEncoder_ = nullptr;
+
+    if (IsImmediateCmdBuffer())
+        Submit(queue_);
+}
+
+void WebGPUCommandBuffer::Execute(CommandBuffer& /*secondaryCommandBuffer*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+/* ----- Blitting ----- */
+
+void WebGPUCommandBuffer::UpdateBuffer(
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    const void*     data,
+    std::uint16_t   dataSize)
+{
+    auto& dstBufferWGPU = LLGL_CAST(WebGPUBuffer&, dstBuffer);
+
+    /* Copy commands must be encoded outside of any pass and copy sizes must be a multiple of 4 */
+    const std::uint64_t alignedSize = GetAlignedSize<std::uint64_t>(dataSize, 4);
+    WGPUBuffer stagingBuffer = CreateStagingBuffer(alignedSize, data);
+
+    PauseRenderPass();
+    EndComputePass();
+    wgpuCommandEncoderCopyBufferToBuffer(commandEncoder_, stagingBuffer, 0, dstBufferWGPU.GetNative(), dstOffset, alignedSize);
+}
+
+void WebGPUCommandBuffer::CopyBuffer(
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    Buffer&         srcBuffer,
+    std::uint64_t   srcOffset,
+    std::uint64_t   size)
+{
+    auto& dstBufferWGPU = LLGL_CAST(WebGPUBuffer&, dstBuffer);
+    auto& srcBufferWGPU = LLGL_CAST(WebGPUBuffer&, srcBuffer);
+    PauseRenderPass();
+    EndComputePass();
+    wgpuCommandEncoderCopyBufferToBuffer(commandEncoder_, srcBufferWGPU.GetNative(), srcOffset, dstBufferWGPU.GetNative(), dstOffset, size);
+}
+
+static void FillImageCopyTexture(WGPUImageCopyTexture& dst, const WebGPUTexture& texture, std::uint32_t mipLevel, const Offset3D& offset, std::uint32_t arrayLayer)
+{
+    dst = WGPUImageCopyTexture{};
+    dst.texture     = texture.GetNative();
+    dst.mipLevel    = mipLevel;
+    dst.origin      = WebGPUTypes::ToWGPUOrigin(texture.GetType(), offset, arrayLayer);
+    dst.aspect      = WGPUTextureAspect_All;
+}
+
+static void FillImageCopyBuffer(
+    WGPUImageCopyBuffer&    dst,
+    const WebGPUBuffer&     buffer,
+    std::uint64_t           offset,
+    const Format            format,
+    const Extent3D&         extent,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    const SubresourceLayout     layout          = CalcSubresourceLayout(format, Extent3D{ extent.width, extent.height, 1 });
+    const FormatAttributes&     formatAttribs   = FormatTable::GetAttribs(format);
+    const std::uint32_t         blockHeight     = std::max(1u, static_cast<std::uint32_t>(formatAttribs.blockHeight));
+
+    dst = WGPUImageCopyBuffer{};
+    dst.buffer              = buffer.GetNative();
+    dst.layout.offset       = offset;
+    dst.layout.bytesPerRow  = (rowStride > 0 ? rowStride : GetAlignedSize(layout.rowStride, g_copyBytesPerRowAlignment));
+    dst.layout.rowsPerImage = (layerStride > 0 ? layerStride / dst.layout.bytesPerRow : DivideRoundUp(extent.height, blockHeight));
+
+    if (dst.layout.bytesPerRow % g_copyBytesPerRowAlignment != 0)
+        LLGL_TRAP("row stride for copy command must be a multiple of %u, but %u was specified", g_copyBytesPerRowAlignment, dst.layout.bytesPerRow);
+}
+
+void WebGPUCommandBuffer::CopyBufferFromTexture(
+    Buffer&                 dstBuffer,
+    std::uint64_t           dstOffset,
+    Texture&                srcTexture,
+    const TextureRegion&    srcRegion,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    auto& dstBufferWGPU = LLGL_CAST(WebGPUBuffer&, dstBuffer);
+    auto& srcTextureWGPU = LLGL_CAST(WebGPUTexture&, srcTexture);
+
+    const Extent3D extent = CalcTextureExtent(srcTextureWGPU.GetType(), srcRegion.extent, srcRegion.subresource.numArrayLayers);
+
+    WGPUImageCopyTexture src;
+    FillImageCopyTexture(src, srcTextureWGPU, srcRegion.subresource.baseMipLevel, srcRegion.offset, srcRegion.subresource.baseArrayLayer);
+
+    WGPUImageCopyBuffer dst;
+    FillImageCopyBuffer(dst, dstBufferWGPU, dstOffset, srcTextureWGPU.GetFormat(), extent, rowStride, layerStride);
+
+    const WGPUExtent3D copySize = WebGPUTypes::ToWGPUExtent(srcTextureWGPU.GetType(), srcRegion.extent, srcRegion.subresource.numArrayLayers);
+
+    PauseRenderPass();
+    EndComputePass();
+    wgpuCommandEncoderCopyTextureToBuffer(commandEncoder_, &src, &dst, &copySize);
+}
+
+void WebGPUCommandBuffer::FillBuffer(
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset,
+    std::uint32_t   value,
+    std::uint64_t   fillSize)
+{
+    auto& dstBufferWGPU = LLGL_CAST(WebGPUBuffer&, dstBuffer);
+
+    const std::uint64_t size = (fillSize == LLGL_WHOLE_SIZE ? dstBufferWGPU.GetSize() - dstOffset : fillSize);
+
+    PauseRenderPass();
+    EndComputePass();
+
+    /* WebGPU can only clear buffers to zero; other values are copied from a staging buffer */
+    if (value == 0)
+        wgpuCommandEncoderClearBuffer(commandEncoder_, dstBufferWGPU.GetNative(), dstOffset, size);
+    else
+    {
+        WGPUBuffer stagingBuffer = CreateStagingBuffer(size, nullptr, value);
+        wgpuCommandEncoderCopyBufferToBuffer(commandEncoder_, stagingBuffer, 0, dstBufferWGPU.GetNative(), dstOffset, size);
+    }
+}
+
+void WebGPUCommandBuffer::CopyTexture(
+    Texture&                dstTexture,
+    const TextureLocation&  dstLocation,
+    Texture&                srcTexture,
+    const TextureLocation&  srcLocation,
+    const Extent3D&         extent)
+{
+    auto& dstTextureWGPU = LLGL_CAST(WebGPUTexture&, dstTexture);
+    auto& srcTextureWGPU = LLGL_CAST(WebGPUTexture&, srcTexture);
+
+    WGPUImageCopyTexture dst, src;
+    FillImageCopyTexture(dst, dstTextureWGPU, dstLocation.mipLevel, dstLocation.offset, dstLocation.arrayLayer);
+    FillImageCopyTexture(src, srcTextureWGPU, srcLocation.mipLevel, srcLocation.offset, srcLocation.arrayLayer);
+
+    const WGPUExtent3D copySize = WebGPUTypes::ToWGPUExtent(srcTextureWGPU.GetType(), extent, extent.depth);
+
+    PauseRenderPass();
+    EndComputePass();
+    wgpuCommandEncoderCopyTextureToTexture(commandEncoder_, &src, &dst, &copySize);
+}
+
+void WebGPUCommandBuffer::CopyTextureFromBuffer(
+    Texture&                dstTexture,
+    const TextureRegion&    dstRegion,
+    Buffer&                 srcBuffer,
+    std::uint64_t           srcOffset,
+    std::uint32_t           rowStride,
+    std::uint32_t           layerStride)
+{
+    auto& dstTextureWGPU = LLGL_CAST(WebGPUTexture&, dstTexture);
+    auto& srcBufferWGPU = LLGL_CAST(WebGPUBuffer&, srcBuffer);
+
+    const Extent3D extent = CalcTextureExtent(dstTextureWGPU.GetType(), dstRegion.extent, dstRegion.subresource.numArrayLayers);
+
+    WGPUImageCopyBuffer src;
+    FillImageCopyBuffer(src, srcBufferWGPU, srcOffset, dstTextureWGPU.GetFormat(), extent, rowStride, layerStride);
+
+    WGPUImageCopyTexture dst;
+    FillImageCopyTexture(dst, dstTextureWGPU, dstRegion.subresource.baseMipLevel, dstRegion.offset, dstRegion.subresource.baseArrayLayer);
+
+    const WGPUExtent3D copySize = WebGPUTypes::ToWGPUExtent(dstTextureWGPU.GetType(), dstRegion.extent, dstRegion.subresource.numArrayLayers);
+
+    PauseRenderPass();
+    EndComputePass();
+    wgpuCommandEncoderCopyBufferToTexture(commandEncoder_, &src, &dst, &copySize);
+}
+
+void WebGPUCommandBuffer::CopyTextureFromFramebuffer(
+    Texture&                /*dstTexture*/,
+    const TextureRegion&    /*dstRegion*/,
+    const Offset2D&         /*srcOffset*/)
+{
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("copying from the canvas framebuffer in WebGPU");
+}
+
+void WebGPUCommandBuffer::GenerateMips(Texture& /*texture*/)
+{
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("MIP-map generation in WebGPU");
+}
+
+void WebGPUCommandBuffer::GenerateMips(Texture& /*texture*/, const TextureSubresource& /*subresource*/)
+{
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("MIP-map generation in WebGPU");
+}
+
+/* ----- Viewport and Scissor ----- */
+
+void WebGPUCommandBuffer::SetViewport(const Viewport& viewport)
+{
+    renderState_.hasViewport    = true;
+    renderState_.viewport       = viewport;
+    if (renderPassEncoder_ != nullptr)
+        wgpuRenderPassEncoderSetViewport(renderPassEncoder_, viewport.x, viewport.y, viewport.width, viewport.height, viewport.minDepth, viewport.maxDepth);
+}
+
+void WebGPUCommandBuffer::SetViewports(std::uint32_t numViewports, const Viewport* viewports)
+{
+    /* WebGPU only supports a single viewport */
+    if (numViewports > 0)
+        SetViewport(viewports[0]);
+}
+
+void WebGPUCommandBuffer::SetScissor(const Scissor& scissor)
+{
+    renderState_.hasScissor = true;
+    renderState_.scissor    = scissor;
+    if (renderPassEncoder_ != nullptr)
+    {
+        wgpuRenderPassEncoderSetScissorRect(
+            renderPassEncoder_,
+            static_cast<std::uint32_t>(scissor.x),
+            static_cast<std::uint32_t>(scissor.y),
+            static_cast<std::uint32_t>(scissor.width),
+            static_cast<std::uint32_t>(scissor.height)
+        );
+    }
+}
+
+void WebGPUCommandBuffer::SetScissors(std::uint32_t numScissors, const Scissor* scissors)
+{
+    /* WebGPU only supports a single scissor rectangle */
+    if (numScissors > 0)
+        SetScissor(scissors[0]);
+}
+
+/* ----- Input Assembly ------ */
+
+void WebGPUCommandBuffer::SetVertexBuffer(Buffer& buffer)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    renderState_.vertexBuffers.clear();
+    renderState_.vertexBuffers.push_back(VertexBufferBinding{ bufferWGPU.GetNative(), bufferWGPU.GetSize() });
+    renderState_.computeSOBuffer = ((bufferWGPU.GetBindFlags() & BindFlags::ComputeStreamOutput) != 0 ? &bufferWGPU : nullptr);
+    if (renderPassEncoder_ != nullptr)
+        wgpuRenderPassEncoderSetVertexBuffer(renderPassEncoder_, 0, bufferWGPU.GetNative(), 0, bufferWGPU.GetSize());
+}
+
+void WebGPUCommandBuffer::SetVertexBufferArray(BufferArray& bufferArray)
+{
+    auto& bufferArrayWGPU = LLGL_CAST(WebGPUBufferArray&, bufferArray);
+    renderState_.vertexBuffers.clear();
+    renderState_.computeSOBuffer = nullptr;
+    for (WebGPUBuffer* bufferWGPU : bufferArrayWGPU.buffers)
+        renderState_.vertexBuffers.push_back(VertexBufferBinding{ bufferWGPU->GetNative(), bufferWGPU->GetSize() });
+    if (renderPassEncoder_ != nullptr)
+    {
+        for_range(slot, renderState_.vertexBuffers.size())
+        {
+            const VertexBufferBinding& binding = renderState_.vertexBuffers[slot];
+            wgpuRenderPassEncoderSetVertexBuffer(renderPassEncoder_, static_cast<std::uint32_t>(slot), binding.buffer, 0, binding.size);
+        }
+    }
+}
+
+void WebGPUCommandBuffer::SetIndexBuffer(Buffer& buffer)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    renderState_.indexBuffer        = bufferWGPU.GetNative();
+    renderState_.indexFormat        = bufferWGPU.GetIndexFormat();
+    renderState_.indexBufferOffset  = 0;
+    renderState_.indexBufferSize    = bufferWGPU.GetSize();
+    if (renderPassEncoder_ != nullptr)
+        wgpuRenderPassEncoderSetIndexBuffer(renderPassEncoder_, renderState_.indexBuffer, renderState_.indexFormat, 0, renderState_.indexBufferSize);
+}
+
+void WebGPUCommandBuffer::SetIndexBuffer(Buffer& buffer, const Format format, std::uint64_t offset)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    renderState_.indexBuffer        = bufferWGPU.GetNative();
+    renderState_.indexFormat        = WebGPUTypes::ToWGPUIndexFormat(format);
+    renderState_.indexBufferOffset  = offset;
+    renderState_.indexBufferSize    = bufferWGPU.GetSize() - offset;
+    if (renderPassEncoder_ != nullptr)
+        wgpuRenderPassEncoderSetIndexBuffer(renderPassEncoder_, renderState_.indexBuffer, renderState_.indexFormat, offset, renderState_.indexBufferSize);
+}
+
+/* ----- Resources ----- */
+
+void WebGPUCommandBuffer::SetResourceHeap(ResourceHeap& resourceHeap, std::uint32_t descriptorSet)
+{
+    auto& resourceHeapWGPU = LLGL_CAST(WebGPUResourceHeap&, resourceHeap);
+    const std::uint32_t bindGroupIndex = resourceHeapWGPU.GetBindGroupIndex();
+    if (bindGroupIndex < WebGPUPipelineLayout::BindGroupType_Num && descriptorSet < resourceHeapWGPU.GetNumDescriptorSets())
+    {
+        bindGroups_[bindGroupIndex] = resourceHeapWGPU.GetBindGroup(descriptorSet);
+        bindGroupDirtyBits_ |= (1u << bindGroupIndex);
+    }
+}
+
+void WebGPUCommandBuffer::SetResource(std::uint32_t descriptor, Resource& resource)
+{
+    if (boundPipelineLayout_ == nullptr || descriptor >= dynamicEntries_.size())
+        return;
+
+    /* Bind groups are immutable, so dynamic bindings are collected and a new bind group is created with the next draw or dispatch command */
+    WebGPUResourceHeap::FillBindGroupEntry(dynamicEntries_[descriptor], boundPipelineLayout_->GetBindings()[descriptor], resource);
+    dynamicEntriesDirty_ = true;
+}
+
+void WebGPUCommandBuffer::SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size)
+{
+    if (boundPipelineLayout_ == nullptr || descriptor >= dynamicEntries_.size())
+        return;
+
+    /* Restrict the dynamic binding to the specified range; the bind group is created with the next draw or dispatch command */
+    WGPUBindGroupEntry& entry = dynamicEntries_[descriptor];
+    WebGPUResourceHeap::FillBindGroupEntry(entry, boundPipelineLayout_->GetBindings()[descriptor], buffer);
+    entry.offset    = offset;
+    entry.size      = size;
+    dynamicEntriesDirty_ = true;
+}
+
+void WebGPUCommandBuffer::ResourceBarrier(
+    std::uint32_t       /*numBuffers*/,
+    Buffer* const *     /*buffers*/,
+    std::uint32_t       /*numTextures*/,
+    Texture* const *    /*textures*/)
+{
+    // dummy - resource transitions are tracked implicitly by WebGPU
+}
+
+/* ----- Render Passes ----- */
+
+void WebGPUCommandBuffer::BeginRenderPass(
+    RenderTarget&       renderTarget,
+    const RenderPass*   renderPass,
+    std::uint32_t       numClearValues,
+    const ClearValue*   clearValues,
+    std::uint32_t       /*swapBufferIndex*/)
+{
+    EndActivePasses();
+
+    const WebGPURenderPass* renderPassWGPU = nullptr;
+
+    if (LLGL::IsInstanceOf<SwapChain>(renderTarget))
+    {
+        auto& swapChainWGPU = LLGL_CAST(WebGPUSwapChain&, renderTarget);
+        renderPassWGPU = &(swapChainWGPU.GetDefaultRenderPass());
+
+        /* Render into multi-sampled color buffer and resolve it into the canvas texture if the swap chain is multi-sampled */
+        numColorAttachments_ = 1;
+        colorAttachments_[0] = WGPURenderPassColorAttachment{};
+        if (WGPUTextureView colorViewMS = swapChainWGPU.GetMultiSampledColorView())
+        {
+            colorAttachments_[0].view           = colorViewMS;
+            colorAttachments_[0].resolveTarget  = swapChainWGPU.GetCurrentColorView();
+        }
+        else
+            colorAttachments_[0].view           = swapChainWGPU.GetCurrentColorView();
+
+        depthStencilAttachment_ = WGPURenderPassDepthStencilAttachment{};
+        depthStencilAttachment_.view = swapChainWGPU.GetDepthStencilView();
+    }
+    else
+    {
+        auto& renderTargetWGPU = LLGL_CAST(WebGPURenderTarget&, renderTarget);
+        renderPassWGPU = &(renderTargetWGPU.GetDefaultRenderPass());
+
+        numColorAttachments_ = renderTargetWGPU.GetNumColorAttachments();
+        for_range(i, numColorAttachments_)
+        {
+            colorAttachments_[i] = WGPURenderPassColorAttachment{};
+            colorAttachments_[i].view           = renderTargetWGPU.GetColorView(i);
+            colorAttachments_[i].resolveTarget  = renderTargetWGPU.GetResolveView(i);
+        }
+
+        depthStencilAttachment_ = WGPURenderPassDepthStencilAttachment{};
+        depthStencilAttachment_.view = renderTargetWGPU.GetDepthStencilView();
+    }
+
+    #if LLGL_WGPU_HAS_DEPTH_SLICE
+    for_range(i, numColorAttachments_)
+        colorAttachments_[i].depthSlice = WGPU_DEPTH_SLICE_UNDEFINED;
+    #endif
+
+    hasDepthStencil_ = (depthStencilAttachment_.view != nullptr);
+
+    /* Determine load and store operations by the specified render pass or the default render pass of the render target */
+    if (renderPass != nullptr)
+        renderPassWGPU = LLGL_CAST(const WebGPURenderPass*, renderPass);
+
+    renderPassWGPU->FillAttachmentOps(numColorAttachments_, colorAttachments_, (hasDepthStencil_ ? &depthStencilAttachment_ : nullptr), numClearValues, clearValues);
+
+    /* Native render pass is started with the first command that requires a render pass encoder */
+    renderPassActive_ = true;
+}
+
+void WebGPUCommandBuffer::EndRenderPass()
+{
+    /* Begin render pass encoder if it has not been started yet, so that all load and store operations are executed */
+    GetRenderPassEncoder();
+    if (renderPassEncoder_ != nullptr)
+    {
+        wgpuRenderPassEncoderEnd(renderPassEncoder_);
+        wgpuRenderPassEncoderRelease(renderPassEncoder_);
+        renderPassEncoder_ = nullptr;
+    }
+    renderPassActive_ = false;
+}
+
+static void SetColorAttachmentClear(WGPURenderPassColorAttachment& dst, const ClearValue& clearValue)
+{
+    dst.loadOp      = WGPULoadOp_Clear;
+    dst.clearValue  = WGPUColor{ clearValue.color[0], clearValue.color[1], clearValue.color[2], clearValue.color[3] };
+}
+
+static void SetDepthStencilAttachmentClear(WGPURenderPassDepthStencilAttachment& dst, long flags, const ClearValue& clearValue)
+{
+    /* Load operations must only be modified for the aspects the depth-stencil format actually has */
+    if ((flags & ClearFlags::Depth) != 0 && dst.depthLoadOp != WGPULoadOp_Undefined)
+    {
+        dst.depthLoadOp     = WGPULoadOp_Clear;
+        dst.depthClearValue = clearValue.depth;
+    }
+    if ((flags & ClearFlags::Stencil) != 0 && dst.stencilLoadOp != WGPULoadOp_Undefined)
+    {
+        dst.stencilLoadOp       = WGPULoadOp_Clear;
+        dst.stencilClearValue   = clearValue.stencil;
+    }
+}
+
+void WebGPUCommandBuffer::Clear(long flags, const ClearValue& clearValue)
+{
+    if (!renderPassActive_)
+        return;
+
+    /* WebGPU can only clear attachments with their load operations, so the render pass is resumed with clear operations */
+    PauseRenderPass();
+
+    if ((flags & ClearFlags::Color) != 0)
+    {
+        for_range(i, numColorAttachments_)
+            SetColorAttachmentClear(colorAttachments_[i], clearValue);
+    }
+    if (hasDepthStencil_)
+        SetDepthStencilAttachmentClear(depthStencilAttachment_, flags, clearValue);
+}
+
+void WebGPUCommandBuffer::ClearAttachments(std::uint32_t numAttachments, const AttachmentClear* attachments)
+{
+    if (!renderPassActive_)
+        return;
+
+    PauseRenderPass();
+
+    for_range(i, numAttachments)
+    {
+        const AttachmentClear& attachment = attachments[i];
+        if ((attachment.flags & ClearFlags::Color) != 0)
+        {
+            if (attachment.colorAttachment < numColorAttachments_)
+                SetColorAttachmentClear(colorAttachments_[attachment.colorAttachment], attachment.clearValue);
+        }
+        else if (hasDepthStencil_)
+            SetDepthStencilAttachmentClear(depthStencilAttachment_, attachment.flags, attachment.clearValue);
+    }
+}
+
+/* ----- Pipeline States ----- */
+
+void WebGPUCommandBuffer::SetPipelineState(PipelineState& pipelineState)
+{
+    auto& pipelineStateWGPU = LLGL_CAST(WebGPUPipelineState&, pipelineState);
+    boundPipelineState_ = &pipelineStateWGPU;
+
+    /* Reset binding tables if the pipeline layout has changed */
+    if (boundPipelineLayout_ != pipelineStateWGPU.GetPipelineLayout())
+    {
+        boundPipelineLayout_ = pipelineStateWGPU.GetPipelineLayout();
+        ResetBindingTables();
+    }
+
+    /* Graphics pipelines are bound immediately, so dynamic states that are set after the PSO are not overridden by its static states */
+    if (pipelineStateWGPU.IsGraphicsPSO() && renderPassEncoder_ != nullptr)
+    {
+        pipelineStateWGPU.Bind(renderPassEncoder_);
+        pipelineDirty_ = false;
+    }
+    else
+        pipelineDirty_ = true;
+
+    /* Bind groups must be re-bound whenever the pipeline layout may have changed */
+    bindGroupDirtyBits_ = ~0u;
+}
+
+void WebGPUCommandBuffer::SetBlendFactor(const float color[4])
+{
+    renderState_.hasBlendFactor = true;
+    renderState_.blendFactor    = WGPUColor{ color[0], color[1], color[2], color[3] };
+    if (renderPassEncoder_ != nullptr)
+        wgpuRenderPassEncoderSetBlendConstant(renderPassEncoder_, &(renderState_.blendFactor));
+}
+
+void WebGPUCommandBuffer::SetStencilReference(std::uint32_t reference, const StencilFace /*stencilFace*/)
+{
+    /* WebGPU only supports a single stencil reference value for both faces */
+    renderState_.hasStencilRef  = true;
+    renderState_.stencilRef     = reference;
+    if (renderPassEncoder_ != nullptr)
+        wgpuRenderPassEncoderSetStencilReference(renderPassEncoder_, reference);
+}
+
+void WebGPUCommandBuffer::SetShadingRate(const ShadingRate /*rate*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::SetUniforms(std::uint32_t /*first*/, const void* /*data*/, std::uint16_t /*dataSize*/)
+{
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("uniforms in WebGPU; use constant buffers instead");
+}
+
+/* ----- Queries ----- */
+
+static bool IsOcclusionQuery(const QueryType type)
+{
+    return (type == QueryType::SamplesPassed || type == QueryType::AnySamplesPassed || type == QueryType::AnySamplesPassedConservative);
+}
+
+void WebGPUCommandBuffer::BeginQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    auto& queryHeapWGPU = LLGL_CAST(WebGPUQueryHeap&, queryHeap);
+    if (IsOcclusionQuery(queryHeapWGPU.GetType()))
+    {
+        /* Occlusion query set must be specified when the render pass begins, so the render pass is resumed if it's not the active one */
+        if (occlusionQuerySet_ != queryHeapWGPU.GetNative())
+        {
+            PauseRenderPass();
+            occlusionQuerySet_ = queryHeapWGPU.GetNative();
+        }
+        if (WGPURenderPassEncoder renderPassEncoder = GetRenderPassEncoder())
+            wgpuRenderPassEncoderBeginOcclusionQuery(renderPassEncoder, query);
+    }
+    else if (queryHeapWGPU.GetType() == QueryType::TimeElapsed)
+        WriteTimestamp(queryHeapWGPU.GetNative(), query * queryHeapWGPU.GetQueryStride());
+}
+
+void WebGPUCommandBuffer::EndQuery(QueryHeap& queryHeap, std::uint32_t query)
+{
+    auto& queryHeapWGPU = LLGL_CAST(WebGPUQueryHeap&, queryHeap);
+    if (IsOcclusionQuery(queryHeapWGPU.GetType()))
+    {
+        if (renderPassEncoder_ != nullptr)
+            wgpuRenderPassEncoderEndOcclusionQuery(renderPassEncoder_);
+    }
+    else if (queryHeapWGPU.GetType() == QueryType::TimeElapsed)
+        WriteTimestamp(queryHeapWGPU.GetNative(), query * queryHeapWGPU.GetQueryStride() + 1);
+}
+
+void WebGPUCommandBuffer::ResolveQueryData(
+    QueryHeap&      srcQueryHeap,
+    std::uint32_t   firstQuery,
+    std::uint32_t   numQueries,
+    Buffer&         dstBuffer,
+    std::uint64_t   dstOffset)
+{
+    auto& srcQueryHeapWGPU = LLGL_CAST(WebGPUQueryHeap&, srcQueryHeap);
+    auto& dstBufferWGPU = LLGL_CAST(WebGPUBuffer&, dstBuffer);
+
+    /* TimeElapsed queries are resolved as pairs of begin and end timestamps */
+    const std::uint32_t stride = srcQueryHeapWGPU.GetQueryStride();
+
+    PauseRenderPass();
+    EndComputePass();
+    wgpuCommandEncoderResolveQuerySet(commandEncoder_, srcQueryHeapWGPU.GetNative(), firstQuery * stride, numQueries * stride, dstBufferWGPU.GetNative(), dstOffset);
+}
+
+void WebGPUCommandBuffer::BeginRenderCondition(QueryHeap& /*queryHeap*/, std::uint32_t /*query*/, const RenderConditionMode /*mode*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::EndRenderCondition()
+{
+    // dummy - not supported in WebGPU
+}
+
+/* ----- Stream Output ------ */
+
+void WebGPUCommandBuffer::BeginStreamOutput(std::uint32_t /*numBuffers*/, Buffer* const * /*buffers*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::EndStreamOutput()
+{
+    // dummy - not supported in WebGPU
+}
+
+/* ----- Drawing ----- */
+
+void WebGPUCommandBuffer::Draw(std::uint32_t numVertices, std::uint32_t firstVertex)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDraw(renderPassEncoder, numVertices, 1, firstVertex, 0);
+}
+
+void WebGPUCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDrawIndexed(renderPassEncoder, numIndices, 1, firstIndex, 0, 0);
+}
+
+void WebGPUCommandBuffer::DrawIndexed(std::uint32_t numIndices, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDrawIndexed(renderPassEncoder, numIndices, 1, firstIndex, vertexOffset, 0);
+}
+
+void WebGPUCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDraw(renderPassEncoder, numVertices, numInstances, firstVertex, 0);
+}
+
+void WebGPUCommandBuffer::DrawInstanced(std::uint32_t numVertices, std::uint32_t firstVertex, std::uint32_t numInstances, std::uint32_t firstInstance)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDraw(renderPassEncoder, numVertices, numInstances, firstVertex, firstInstance);
+}
+
+void WebGPUCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDrawIndexed(renderPassEncoder, numIndices, numInstances, firstIndex, 0, 0);
+}
+
+void WebGPUCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDrawIndexed(renderPassEncoder, numIndices, numInstances, firstIndex, vertexOffset, 0);
+}
+
+void WebGPUCommandBuffer::DrawIndexedInstanced(std::uint32_t numIndices, std::uint32_t numInstances, std::uint32_t firstIndex, std::int32_t vertexOffset, std::uint32_t firstInstance)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDrawIndexed(renderPassEncoder, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+}
+
+void WebGPUCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDrawIndirect(renderPassEncoder, bufferWGPU.GetNative(), offset);
+}
+
+void WebGPUCommandBuffer::DrawIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    /* WebGPU has no multi-draw-indirect, so each command is encoded separately */
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+    {
+        for_range(i, numCommands)
+            wgpuRenderPassEncoderDrawIndirect(renderPassEncoder, bufferWGPU.GetNative(), offset + static_cast<std::uint64_t>(i) * stride);
+    }
+}
+
+void WebGPUCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+        wgpuRenderPassEncoderDrawIndexedIndirect(renderPassEncoder, bufferWGPU.GetNative(), offset);
+}
+
+void WebGPUCommandBuffer::DrawIndexedIndirect(Buffer& buffer, std::uint64_t offset, std::uint32_t numCommands, std::uint32_t stride)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    if (WGPURenderPassEncoder renderPassEncoder = PrepareDraw())
+    {
+        for_range(i, numCommands)
+            wgpuRenderPassEncoderDrawIndexedIndirect(renderPassEncoder, bufferWGPU.GetNative(), offset + static_cast<std::uint64_t>(i) * stride);
+    }
+}
+
+void WebGPUCommandBuffer::DrawIndirectCount(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::DrawIndexedIndirectCount(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    Buffer&         /*countBuffer*/,
+    std::uint64_t   /*countOffset*/,
+    std::uint32_t   /*maxNumCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::DrawStreamOutput()
+{
+    /* Only compute stream-outputs are supported in WebGPU */
+    if (WebGPUBuffer* computeSOBufferWGPU = renderState_.computeSOBuffer)
+        DrawIndirect(*computeSOBufferWGPU, GetComputeStreamOutputArgsOffset(computeSOBufferWGPU->GetSize()));
+}
+
+void WebGPUCommandBuffer::DrawMeshTasks(
+    std::uint32_t   /*numWorkGroupsX*/,
+    std::uint32_t   /*numWorkGroupsY*/,
+    std::uint32_t   /*numWorkGroupsZ*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::DrawMeshTasksIndirect(
+    Buffer&         /*buffer*/,
+    std::uint64_t   /*offset*/,
+    std::uint32_t   /*numCommands*/,
+    std::uint32_t   /*stride*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::DispatchTiles()
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::ExecuteIndirect(
+    const IndirectCommandDescriptor&    /*commandDesc*/,
+    Buffer&                             /*buffer*/,
+    std::uint64_t                       /*offset*/,
+    Buffer*                             /*countBuffer*/,
+    std::uint64_t                       /*countOffset*/,
+    std::uint32_t                       /*maxNumCommands*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+/* ----- Compute ----- */
+
+void WebGPUCommandBuffer::Dispatch(std::uint32_t numWorkGroupsX, std::uint32_t numWorkGroupsY, std::uint32_t numWorkGroupsZ)
+{
+    WGPUComputePassEncoder computePassEncoder = PrepareDispatch();
+    wgpuComputePassEncoderDispatchWorkgroups(computePassEncoder, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+}
+
+void WebGPUCommandBuffer::DispatchIndirect(Buffer& buffer, std::uint64_t offset)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    WGPUComputePassEncoder computePassEncoder = PrepareDispatch();
+    wgpuComputePassEncoderDispatchWorkgroupsIndirect(computePassEncoder, bufferWGPU.GetNative(), offset);
+}
+
+/* ----- Ray Tracing ----- */
+
+void WebGPUCommandBuffer::BuildAccelerationStructure(
+    Buffer&                                 /*dstBuffer*/,
+    Buffer&                                 /*scratchBuffer*/,
+    const AccelerationStructureDescriptor&  /*desc*/,
+    Buffer*                                 /*srcBuffer*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+void WebGPUCommandBuffer::DispatchRays(std::uint32_t /*width*/, std::uint32_t /*height*/, std::uint32_t /*depth*/)
+{
+    // dummy - not supported in WebGPU
+}
+
+/* ----- Debugging ----- */
+
+void WebGPUCommandBuffer::PushDebugGroup(const char* name)
+{
+    /* Debug groups must be pushed and popped on the same encoder, so compute passes are ended and render passes are started here */
+    if (renderPassActive_)
+        wgpuRenderPassEncoderPushDebugGroup(GetRenderPassEncoder(), name);
+    else
+    {
+        EndComputePass();
+        wgpuCommandEncoderPushDebugGroup(commandEncoder_, name);
+    }
+}
+
+void WebGPUCommandBuffer::PopDebugGroup()
+{
+    if (renderPassActive_)
+        wgpuRenderPassEncoderPopDebugGroup(GetRenderPassEncoder());
+    else
+    {
+        EndComputePass();
+        wgpuCommandEncoderPopDebugGroup(commandEncoder_);
+    }
+}
+
+/* ----- Extensions ----- */
+
+void WebGPUCommandBuffer::DoNativeCommand(const void* /*nativeCommand*/, std::size_t /*nativeCommandSize*/)
+{
+    // dummy
+}
+
+bool WebGPUCommandBuffer::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(WebGPU::CommandBufferNativeHandle))
+    {
+        auto* nativeHandleWGPU = static_cast<WebGPU::CommandBufferNativeHandle*>(nativeHandle);
+        nativeHandleWGPU->commandEncoder        = commandEncoder_;
+        nativeHandleWGPU->renderPassEncoder     = (renderPassActive_ ? GetRenderPassEncoder() : nullptr);
+        nativeHandleWGPU->computePassEncoder    = computePassEncoder_;
+        return true;
+    }
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+WGPURenderPassEncoder WebGPUCommandBuffer::GetRenderPassEncoder()
+{
+    if (renderPassEncoder_ == nullptr && renderPassActive_)
+        BeginRenderPassEncoder();
+    return renderPassEncoder_;
+}
+
+WGPUComputePassEncoder WebGPUCommandBuffer::GetComputePassEncoder()
+{
+    if (computePassEncoder_ == nullptr)
+    {
+        PauseRenderPass();
+        computePassEncoder_ = wgpuCommandEncoderBeginComputePass(commandEncoder_, nullptr);
+
+        /* Passes don't inherit any state, so pipeline and bind groups must be bound again */
+        pipelineDirty_      = true;
+        bindGroupDirtyBits_ = ~0u;
+    }
+    return computePassEncoder_;
+}
+
+void WebGPUCommandBuffer::BeginRenderPassEncoder()
+{
+    EndComputePass();
+
+    WGPURenderPassDescriptor renderPassDesc = {};
+    {
+        renderPassDesc.colorAttachmentCount     = numColorAttachments_;
+        renderPassDesc.colorAttachments         = colorAttachments_;
+        renderPassDesc.depthStencilAttachment   = (hasDepthStencil_ ? &depthStencilAttachment_ : nullptr);
+        renderPassDesc.occlusionQuerySet        = occlusionQuerySet_;
+    }
+    renderPassEncoder_ = wgpuCommandEncoderBeginRenderPass(commandEncoder_, &renderPassDesc);
+
+    /* Attachments must not be cleared again when this render pass is resumed */
+    for_range(i, numColorAttachments_)
+    {
+        if (colorAttachments_[i].loadOp != WGPULoadOp_Undefined)
+            colorAttachments_[i].loadOp = WGPULoadOp_Load;
+    }
+    if (depthStencilAttachment_.depthLoadOp != WGPULoadOp_Undefined)
+        depthStencilAttachment_.depthLoadOp = WGPULoadOp_Load;
+    if (depthStencilAttachment_.stencilLoadOp != WGPULoadOp_Undefined)
+        depthStencilAttachment_.stencilLoadOp = WGPULoadOp_Load;
+
+    ApplyRenderState(renderPassEncoder_);
+}
+
+void WebGPUCommandBuffer::EndComputePass()
+{
+    if (computePassEncoder_ != nullptr)
+    {
+        wgpuComputePassEncoderEnd(computePassEncoder_);
+        wgpuComputePassEncoderRelease(computePassEncoder_);
+        computePassEncoder_ = nullptr;
+    }
+}
+
+void WebGPUCommandBuffer::PauseRenderPass()
+{
+    /*
+    The render pass remains active and is resumed with the next command that needs a render pass encoder.
+    Note that store operations are applied to each part of a render pass that has been paused.
+    */
+    if (renderPassEncoder_ != nullptr)
+    {
+        wgpuRenderPassEncoderEnd(renderPassEncoder_);
+        wgpuRenderPassEncoderRelease(renderPassEncoder_);
+        renderPassEncoder_ = nullptr;
+    }
+}
+
+void WebGPUCommandBuffer::EndActivePasses()
+{
+    EndComputePass();
+    if (renderPassActive_)
+        EndRenderPass();
+}
+
+void WebGPUCommandBuffer::ApplyRenderState(WGPURenderPassEncoder renderPassEncoder)
+{
+    for_range(slot, renderState_.vertexBuffers.size())
+    {
+        const VertexBufferBinding& binding = renderState_.vertexBuffers[slot];
+        wgpuRenderPassEncoderSetVertexBuffer(renderPassEncoder, static_cast<std::uint32_t>(slot), binding.buffer, 0, binding.size);
+    }
+
+    if (renderState_.indexBuffer != nullptr)
+        wgpuRenderPassEncoderSetIndexBuffer(renderPassEncoder, renderState_.indexBuffer, renderState_.indexFormat, renderState_.indexBufferOffset, renderState_.indexBufferSize);
+
+    if (renderState_.hasViewport)
+    {
+        const Viewport& viewport = renderState_.viewport;
+        wgpuRenderPassEncoderSetViewport(renderPassEncoder, viewport.x, viewport.y, viewport.width, viewport.height, viewport.minDepth, viewport.maxDepth);
+    }
+
+    if (renderState_.hasScissor)
+    {
+        const Scissor& scissor = renderState_.scissor;
+        wgpuRenderPassEncoderSetScissorRect(
+            renderPassEncoder,
+            static_cast<std::uint32_t>(scissor.x),
+            static_cast<std::uint32_t>(scissor.y),
+            static_cast<std::uint32_t>(scissor.width),
+            static_cast<std::uint32_t>(scissor.height)
+        );
+    }
+
+    if (renderState_.hasStencilRef)
+        wgpuRenderPassEncoderSetStencilReference(renderPassEncoder, renderState_.stencilRef);
+    if (renderState_.hasBlendFactor)
+        wgpuRenderPassEncoderSetBlendConstant(renderPassEncoder, &(renderState_.blendFactor));
+
+    /* Bind pipeline last, so its static states take precedence */
+    if (boundPipelineState_ != nullptr && boundPipelineState_->IsGraphicsPSO())
+    {
+        boundPipelineState_->Bind(renderPassEncoder);
+        pipelineDirty_ = false;
+    }
+    else
+        pipelineDirty_ = true;
+
+    bindGroupDirtyBits_ = ~0u;
+}
+
+void WebGPUCommandBuffer::FlushRenderBindGroups(WGPURenderPassEncoder renderPassEncoder)
+{
+    UpdateDynamicBindGroup();
+    for_range(i, WebGPUPipelineLayout::BindGroupType_Num)
+    {
+        if (((bindGroupDirtyBits_ >> i) & 0x1u) != 0 && bindGroups_[i] != nullptr)
+            wgpuRenderPassEncoderSetBindGroup(renderPassEncoder, static_cast<std::uint32_t>(i), bindGroups_[i], 0, nullptr);
+    }
+    bindGroupDirtyBits_ = 0;
+}
+
+void WebGPUCommandBuffer::FlushComputeBindGroups(WGPUComputePassEncoder computePassEncoder)
+{
+    UpdateDynamicBindGroup();
+    for_range(i, WebGPUPipelineLayout::BindGroupType_Num)
+    {
+        if (((bindGroupDirtyBits_ >> i) & 0x1u) != 0 && bindGroups_[i] != nullptr)
+            wgpuComputePassEncoderSetBindGroup(computePassEncoder, static_cast<std::uint32_t>(i), bindGroups_[i], 0, nullptr);
+    }
+    bindGroupDirtyBits_ = 0;
+}
+
+void WebGPUCommandBuffer::UpdateDynamicBindGroup()
+{
+    if (!dynamicEntriesDirty_ || boundPipelineLayout_ == nullptr)
+        return;
+
+    const std::uint32_t bindGroupIndex = boundPipelineLayout_->GetBindGroupIndex(WebGPUPipelineLayout::BindGroupType_DynamicBindings);
+    if (bindGroupIndex >= WebGPUPipelineLayout::BindGroupType_Num)
+        return;
+
+    /* Bind groups can only be created once all of their entries have been written */
+    for (const WGPUBindGroupEntry& entry : dynamicEntries_)
+    {
+        if (entry.buffer == nullptr && entry.sampler == nullptr && entry.textureView == nullptr)
+            return;
+    }
+
+    WGPUBindGroupDescriptor groupDesc = {};
+    {
+        groupDesc.layout        = boundPipelineLayout_->GetBindGroupLayout(WebGPUPipelineLayout::BindGroupType_DynamicBindings);
+        groupDesc.entryCount    = dynamicEntries_.size();
+        groupDesc.entries       = dynamicEntries_.data();
+    }
+    WGPUBindGroup bindGroup = wgpuDeviceCreateBindGroup(device_, &groupDesc);
+    transientBindGroups_.push_back(bindGroup);
+
+    bindGroups_[bindGroupIndex] = bindGroup;
+    bindGroupDirtyBits_ |= (1u << bindGroupIndex);
+    dynamicEntriesDirty_ = false;
+}
+
+void WebGPUCommandBuffer::ResetBindingTables()
+{
+    dynamicEntries_.clear();
+    dynamicEntriesDirty_ = false;
+
+    if (boundPipelineLayout_ == nullptr)
+        return;
+
+    /* Initialize entries for dynamic bindings with their binding indices */
+    const std::vector<WebGPULayoutBinding>& bindings = boundPipelineLayout_->GetBindings();
+    dynamicEntries_.resize(bindings.size());
+    for_range(i, bindings.size())
+    {
+        dynamicEntries_[i] = WGPUBindGroupEntry{};
+        dynamicEntries_[i].binding = bindings[i].binding;
+    }
+
+    const std::uint32_t dynamicGroupIndex = boundPipelineLayout_->GetBindGroupIndex(WebGPUPipelineLayout::BindGroupType_DynamicBindings);
+    if (dynamicGroupIndex < WebGPUPipelineLayout::BindGroupType_Num)
+        bindGroups_[dynamicGroupIndex] = nullptr;
+
+    /* Static samplers are bound with the pipeline layout */
+    const std::uint32_t samplerGroupIndex = boundPipelineLayout_->GetBindGroupIndex(WebGPUPipelineLayout::BindGroupType_StaticSamplers);
+    if (samplerGroupIndex < WebGPUPipelineLayout::BindGroupType_Num)
+        bindGroups_[samplerGroupIndex] = boundPipelineLayout_->GetStaticSamplerBindGroup();
+}
+
+void WebGPUCommandBuffer::ReleaseTransientObjects()
+{
+    for (WGPUBuffer buffer : stagingBuffers_)
+        wgpuBufferRelease(buffer);
+    stagingBuffers_.clear();
+
+    for (WGPUBindGroup bindGroup : transientBindGroups_)
+        wgpuBindGroupRelease(bindGroup);
+    transientBindGroups_.clear();
+}
+
+WGPURenderPassEncoder WebGPUCommandBuffer::PrepareDraw()
+{
+    WGPURenderPassEncoder renderPassEncoder = GetRenderPassEncoder();
+    if (renderPassEncoder != nullptr)
+    {
+        if (pipelineDirty_ && boundPipelineState_ != nullptr && boundPipelineState_->IsGraphicsPSO())
+        {
+            boundPipelineState_->Bind(renderPassEncoder);
+            pipelineDirty_ = false;
+        }
+        FlushRenderBindGroups(renderPassEncoder);
+    }
+    return renderPassEncoder;
+}
+
+WGPUComputePassEncoder WebGPUCommandBuffer::PrepareDispatch()
+{
+    WGPUComputePassEncoder computePassEncoder = GetComputePassEncoder();
+    if (pipelineDirty_ && boundPipelineState_ != nullptr && !boundPipelineState_->IsGraphicsPSO())
+    {
+        boundPipelineState_->Bind(computePassEncoder);
+        pipelineDirty_ = false;
+    }
+    FlushComputeBindGroups(computePassEncoder);
+    return computePassEncoder;
+}
+
+WGPUBuffer WebGPUCommandBuffer::CreateStagingBuffer(std::uint64_t size, const void* data, std::uint32_t fillValue)
+{
+    WGPUBufferDescriptor bufferDesc = {};
+    {
+        bufferDesc.usage            = WGPUBufferUsage_CopySrc;
+        bufferDesc.size             = GetAlignedSize<std::uint64_t>(size, 4);
+        bufferDesc.mappedAtCreation = true;
+    }
+    WGPUBuffer buffer = wgpuDeviceCreateBuffer(device_, &bufferDesc);
+
+    /* Initialize staging buffer with the specified data or fill it with 32-bit values */
+    void* dst = wgpuBufferGetMappedRange(buffer, 0, static_cast<std::size_t>(bufferDesc.size));
+    if (data != nullptr)
+    {
+        ::memcpy(dst, data, static_cast<std::size_t>(size));
+        if (bufferDesc.size > size)
+            ::memset(static_cast<char*>(dst) + size, 0, static_cast<std::size_t>(bufferDesc.size - size));
+    }
+    else
+    {
+        auto* dstWords = static_cast<std::uint32_t*>(dst);
+        for_range(i, bufferDesc.size / 4)
+            dstWords[i] = fillValue;
+    }
+    wgpuBufferUnmap(buffer);
+
+    /* Staging buffers must be kept alive until the command buffer has been encoded again */
+    stagingBuffers_.push_back(buffer);
+    return buffer;
+}
+
+void WebGPUCommandBuffer::WriteTimestamp(WGPUQuerySet querySet, std::uint32_t queryIndex)
+{
+    if (WGPURenderPassEncoder renderPassEncoder = (renderPassActive_ ? GetRenderPassEncoder() : nullptr))
+        wgpuRenderPassEncoderWriteTimestamp(renderPassEncoder, querySet, queryIndex);
+    else if (computePassEncoder_ != nullptr)
+        wgpuComputePassEncoderWriteTimestamp(computePassEncoder_, querySet, queryIndex);
+    else
+        wgpuCommandEncoderWriteTimestamp(commandEncoder_, querySet, queryIndex);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
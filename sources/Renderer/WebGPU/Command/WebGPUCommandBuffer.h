@@ -0,0 +1,170 @@
+/*
+ * WebGPUCommandBuffer.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_COMMAND_BUFFER_H
+#define LLGL_WEBGPU_COMMAND_BUFFER_H
+
+
+#include <LLGL/CommandBuffer.h>
+#include <LLGL/Constants.h>
+#include "../RenderState/WebGPUPipelineLayout.h"
+#include "../WebGPU.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class WebGPUBuffer;
+class WebGPURenderPass;
+class WebGPUPipelineState;
+
+/*
+Command buffer that encodes commands directly into a WGPUCommandEncoder.
+WebGPU passes do not inherit any state, so all bound states are cached and re-applied whenever a new pass begins.
+Render passes are started lazily on the first command that needs a pass encoder, which allows Clear() and
+occlusion queries right after BeginRenderPass() to be folded into the load operations and the descriptor of the native pass.
+Compute passes are started lazily on the first dispatch and ended before any copy command or render pass.
+*/
+class WebGPUCommandBuffer final : public CommandBuffer
+{
+
+    public:
+
+        #include <LLGL/Backend/CommandBuffer.inl>
+
+    public:
+
+        void SetConstantBufferRange(std::uint32_t descriptor, Buffer& buffer, std::uint64_t offset, std::uint64_t size) override;
+
+    public:
+
+        WebGPUCommandBuffer(WGPUDevice device, WGPUQueue queue, const CommandBufferDescriptor& desc);
+        ~WebGPUCommandBuffer();
+
+        WebGPUCommandBuffer(const WebGPUCommandBuffer&) = delete;
+        WebGPUCommandBuffer& operator = (const WebGPUCommandBuffer&) = delete;
+
+        // Submits the encoded command buffer to the specified queue. WebGPU command buffers can only be submitted once.
+        void Submit(WGPUQueue queue);
+
+        // Returns true if this command buffer is submitted automatically in End().
+        inline bool IsImmediateCmdBuffer() const
+        {
+            return immediateSubmit_;
+        }
+
+    private:
+
+        struct VertexBufferBinding
+        {
+            WGPUBuffer      buffer;
+            std::uint64_t   size;
+        };
+
+        struct RenderState
+        {
+            std::vector<VertexBufferBinding>    vertexBuffers;
+            WGPUBuffer                          indexBuffer         = nullptr;
+            WGPUIndexFormat                     indexFormat         = WGPUIndexFormat_Undefined;
+            std::uint64_t                       indexBufferOffset   = 0;
+            std::uint64_t                       indexBufferSize     = 0;
+            bool                                hasViewport         = false;
+            Viewport                            viewport;
+            bool                                hasScissor          = false;
+            Scissor                             scissor;
+            bool                                hasStencilRef       = false;
+            std::uint32_t                       stencilRef          = 0;
+            bool                                hasBlendFactor      = false;
+            WGPUColor                           blendFactor         = {};
+            WebGPUBuffer*                       computeSOBuffer     = nullptr; // Vertex buffer with BindFlags::ComputeStreamOutput
+        };
+
+    private:
+
+        // Returns the render pass encoder and begins the pending render pass if necessary.
+        WGPURenderPassEncoder GetRenderPassEncoder();
+
+        // Returns the compute pass encoder and begins a new compute pass if necessary.
+        WGPUComputePassEncoder GetComputePassEncoder();
+
+        void BeginRenderPassEncoder();
+        void EndComputePass();
+
+        // Ends the active render pass encoder so that copy commands can be encoded; the render pass continues with the next command.
+        void PauseRenderPass();
+
+        // Ends all active passes.
+        void EndActivePasses();
+
+        // Re-applies all cached states on the new render pass encoder.
+        void ApplyRenderState(WGPURenderPassEncoder renderPassEncoder);
+
+        // Creates the bind group for dynamic resource bindings if necessary and binds all invalidated bind groups.
+        void FlushRenderBindGroups(WGPURenderPassEncoder renderPassEncoder);
+        void FlushComputeBindGroups(WGPUComputePassEncoder computePassEncoder);
+        void UpdateDynamicBindGroup();
+
+        void ResetBindingTables();
+        void ReleaseTransientObjects();
+
+        // Prepares the render pass encoder for a draw command and returns null if there is no render pass.
+        WGPURenderPassEncoder PrepareDraw();
+
+        // Prepares the compute pass encoder for a dispatch command.
+        WGPUComputePassEncoder PrepareDispatch();
+
+        // Creates a transient staging buffer with the specified data for copy commands.
+        WGPUBuffer CreateStagingBuffer(std::uint64_t size, const void* data, std::uint32_t fillValue = 0);
+
+        void WriteTimestamp(WGPUQuerySet querySet, std::uint32_t queryIndex);
+
+    private:
+
+        WGPUDevice                              device_                 = nullptr;
+        WGPUQueue                               queue_                  = nullptr;
+        bool                                    immediateSubmit_        = false;
+
+        WGPUCommandEncoder                      commandEncoder_         = nullptr;
+        WGPUCommandBuffer                       commandBuffer_          = nullptr;
+        WGPURenderPassEncoder                   renderPassEncoder_      = nullptr;
+        WGPUComputePassEncoder                  computePassEncoder_     = nullptr;
+
+        /* Descriptor of the current render pass; this is re-used with load operations when the pass is resumed */
+        bool                                    renderPassActive_       = false;
+        std::uint32_t                           numColorAttachments_    = 0;
+        WGPURenderPassColorAttachment           colorAttachments_[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+        bool                                    hasDepthStencil_        = false;
+        WGPURenderPassDepthStencilAttachment    depthStencilAttachment_;
+        WGPUQuerySet                            occlusionQuerySet_      = nullptr;
+
+        /* Bound pipeline and resources */
+        const WebGPUPipelineState*              boundPipelineState_     = nullptr;
+        const WebGPUPipelineLayout*             boundPipelineLayout_    = nullptr;
+        bool                                    pipelineDirty_          = false;
+        WGPUBindGroup                           bindGroups_[WebGPUPipelineLayout::BindGroupType_Num];
+        std::uint32_t                           bindGroupDirtyBits_     = 0;
+        std::vector<WGPUBindGroupEntry>         dynamicEntries_;
+        bool                                    dynamicEntriesDirty_    = false;
+        RenderState                             renderState_;
+
+        /* Objects that must be kept alive until this command buffer has been submitted */
+        std::vector<WGPUBuffer>                 stagingBuffers_;
+        std::vector<WGPUBindGroup>              transientBindGroups_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,65 @@
+/*
+ * WebGPUCommandQueue.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUCommandQueue.h"
+#include "WebGPUCommandBuffer.h"
+#include "../RenderState/WebGPUFence.h"
+#include "../../CheckedCast.h"
+
+
+namespace LLGL
+{
+
+
+WebGPUCommandQueue::WebGPUCommandQueue(WGPUQueue queue) :
+    queue_ { queue }
+{
+}
+
+/* ----- Command Buffers ----- */
+
+void WebGPUCommandQueue::Submit(CommandBuffer& commandBuffer)
+{
+    auto& commandBufferWGPU = LLGL_CAST(WebGPUCommandBuffer&, commandBuffer);
+    if (!commandBufferWGPU.IsImmediateCmdBuffer())
+        commandBufferWGPU.Submit(queue_);
+}
+
+/* ----- Queries ----- */
+
+bool WebGPUCommandQueue::QueryResult(QueryHeap& /*queryHeap*/, std::uint32_t /*firstQuery*/, std::uint32_t /*numQueries*/, void* /*data*/, std::size_t /*dataSize*/)
+{
+    /* Query results can only be read back asynchronously via CommandBuffer::ResolveQueryData */
+    return false;
+}
+
+/* ----- Fences ----- */
+
+void WebGPUCommandQueue::Submit(Fence& fence)
+{
+    auto& fenceWGPU = LLGL_CAST(WebGPUFence&, fence);
+    fenceWGPU.Submit(queue_);
+}
+
+bool WebGPUCommandQueue::WaitFence(Fence& fence, std::uint64_t /*timeout*/)
+{
+    /* Fences are signaled by the browser's event loop, so this cannot block and only returns the current state */
+    auto& fenceWGPU = LLGL_CAST(WebGPUFence&, fence);
+    return fenceWGPU.IsSignaled();
+}
+
+void WebGPUCommandQueue::WaitIdle()
+{
+    /* The GPU timeline can only be observed asynchronously in the browser; see WebGPUFence */
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,50 @@
+/*
+ * WebGPUCommandQueue.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_COMMAND_QUEUE_H
+#define LLGL_WEBGPU_COMMAND_QUEUE_H
+
+
+#include <LLGL/CommandQueue.h>
+#include "../WebGPU.h"
+
+
+namespace LLGL
+{
+
+
+class WebGPUCommandQueue final : public CommandQueue
+{
+
+    public:
+
+        #include <LLGL/Backend/CommandQueue.inl>
+
+    public:
+
+        WebGPUCommandQueue(WGPUQueue queue);
+
+        inline WGPUQueue GetNative() const
+        {
+            return queue_;
+        }
+
+    private:
+
+        WGPUQueue queue_ = nullptr;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,45 @@
+/*
+ * WebGPUFence.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUFence.h"
+
+
+namespace LLGL
+{
+
+
+using SharedSignalState = std::shared_ptr<std::atomic_bool>;
+
+static void WebGPUFenceWorkDoneCallback(WGPUQueueWorkDoneStatus /*status*/, void* userdata)
+{
+    auto* signalState = static_cast<SharedSignalState*>(userdata);
+    (*signalState)->store(true);
+    delete signalState;
+}
+
+WebGPUFence::WebGPUFence() :
+    signaled_ { std::make_shared<std::atomic_bool>(true) }
+{
+}
+
+void WebGPUFence::Submit(WGPUQueue queue)
+{
+    signaled_->store(false);
+    wgpuQueueOnSubmittedWorkDone(queue, WebGPUFenceWorkDoneCallback, new SharedSignalState{ signaled_ });
+}
+
+bool WebGPUFence::IsSignaled()
+{
+    return signaled_->load();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
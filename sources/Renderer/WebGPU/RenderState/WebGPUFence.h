@@ -0,0 +1,55 @@
+/*
+ * WebGPUFence.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_FENCE_H
+#define LLGL_WEBGPU_FENCE_H
+
+
+#include <LLGL/Fence.h>
+#include "../WebGPU.h"
+#include <atomic>
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/*
+Fence that is signaled by the queue's "submitted work done" callback.
+Browsers invoke this callback only after control returns to the event loop, so waiting on a fence cannot block.
+*/
+class WebGPUFence final : public Fence
+{
+
+    public:
+
+        bool IsSignaled() override;
+
+    public:
+
+        WebGPUFence();
+
+        // Resets the signal state and schedules the fence to be signaled once all previously submitted work has completed.
+        void Submit(WGPUQueue queue);
+
+    private:
+
+        // The signal state is shared with pending callbacks, so the fence can be released before its callback is invoked.
+        std::shared_ptr<std::atomic_bool> signaled_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
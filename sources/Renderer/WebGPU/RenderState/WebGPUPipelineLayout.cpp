@@ -0,0 +1,219 @@
+/*
+ * WebGPUPipelineLayout.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUPipelineLayout.h"
+#include "../Texture/WebGPUSampler.h"
+#include "../WebGPUTypes.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+/*
+The binding descriptors do not specify a texture dimension or storage format,
+so textures are declared as 2D float textures and storage textures as write-only RGBA8 textures.
+*/
+static void ConvertBindGroupLayoutEntry(WGPUBindGroupLayoutEntry& dst, const BindingDescriptor& src, std::uint32_t binding)
+{
+    dst = WGPUBindGroupLayoutEntry{};
+    dst.binding     = binding;
+    dst.visibility  = WebGPUTypes::ToWGPUShaderStageFlags(src.stageFlags);
+
+    switch (src.type)
+    {
+        case ResourceType::Buffer:
+        {
+            if ((src.bindFlags & BindFlags::ConstantBuffer) != 0)
+                dst.buffer.type = WGPUBufferBindingType_Uniform;
+            else if ((src.bindFlags & BindFlags::Storage) != 0)
+                dst.buffer.type = WGPUBufferBindingType_Storage;
+            else
+                dst.buffer.type = WGPUBufferBindingType_ReadOnlyStorage;
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            if ((src.bindFlags & BindFlags::Storage) != 0)
+            {
+                dst.storageTexture.access           = WGPUStorageTextureAccess_WriteOnly;
+                dst.storageTexture.format           = WGPUTextureFormat_RGBA8Unorm;
+                dst.storageTexture.viewDimension    = WGPUTextureViewDimension_2D;
+            }
+            else
+            {
+                dst.texture.sampleType              = WGPUTextureSampleType_Float;
+                dst.texture.viewDimension           = WGPUTextureViewDimension_2D;
+            }
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            dst.sampler.type = WGPUSamplerBindingType_Filtering;
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+WebGPUPipelineLayout::WebGPUPipelineLayout(WGPUDevice device, const PipelineLayoutDescriptor& desc) :
+    numUniforms_ { static_cast<std::uint32_t>(desc.uniforms.size()) }
+{
+    /* Create bind group layouts in the same order as the descriptor sets of the Vulkan backend */
+    CreateBindGroupLayout(device, BindGroupType_HeapBindings, desc.heapBindings, heapBindings_);
+    CreateBindGroupLayout(device, BindGroupType_DynamicBindings, desc.bindings, bindings_);
+    CreateStaticSamplers(device, desc.staticSamplers);
+
+    /* Create native pipeline layout with all bind groups in consecutive order */
+    WGPUBindGroupLayout bindGroupLayouts[BindGroupType_Num];
+    std::uint32_t numBindGroupLayouts = 0;
+    for (WGPUBindGroupLayout bindGroupLayout : bindGroupLayouts_)
+    {
+        if (bindGroupLayout != nullptr)
+            bindGroupLayouts[numBindGroupLayouts++] = bindGroupLayout;
+    }
+
+    WGPUPipelineLayoutDescriptor layoutDesc = {};
+    {
+        layoutDesc.label                = desc.debugName;
+        layoutDesc.bindGroupLayoutCount = numBindGroupLayouts;
+        layoutDesc.bindGroupLayouts     = bindGroupLayouts;
+    }
+    pipelineLayout_ = wgpuDeviceCreatePipelineLayout(device, &layoutDesc);
+}
+
+WebGPUPipelineLayout::~WebGPUPipelineLayout()
+{
+    if (staticSamplerBindGroup_ != nullptr)
+        wgpuBindGroupRelease(staticSamplerBindGroup_);
+    for (WGPUSampler sampler : staticSamplers_)
+        wgpuSamplerRelease(sampler);
+    for (WGPUBindGroupLayout bindGroupLayout : bindGroupLayouts_)
+    {
+        if (bindGroupLayout != nullptr)
+            wgpuBindGroupLayoutRelease(bindGroupLayout);
+    }
+    wgpuPipelineLayoutRelease(pipelineLayout_);
+}
+
+std::uint32_t WebGPUPipelineLayout::GetNumHeapBindings() const
+{
+    return static_cast<std::uint32_t>(heapBindings_.size());
+}
+
+std::uint32_t WebGPUPipelineLayout::GetNumBindings() const
+{
+    return static_cast<std::uint32_t>(bindings_.size());
+}
+
+std::uint32_t WebGPUPipelineLayout::GetNumStaticSamplers() const
+{
+    return static_cast<std::uint32_t>(staticSamplers_.size());
+}
+
+std::uint32_t WebGPUPipelineLayout::GetNumUniforms() const
+{
+    return numUniforms_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void WebGPUPipelineLayout::CreateBindGroupLayout(
+    WGPUDevice                              device,
+    BindGroupType                           type,
+    const std::vector<BindingDescriptor>&   inBindings,
+    std::vector<WebGPULayoutBinding>&       outBindings)
+{
+    if (inBindings.empty())
+        return;
+
+    /* Convert binding descriptors; WebGPU has no descriptor arrays, so each array element gets its own binding index */
+    std::vector<WGPUBindGroupLayoutEntry> entries;
+    entries.reserve(inBindings.size());
+
+    for (const BindingDescriptor& bindingDesc : inBindings)
+    {
+        for_range(arrayElement, std::max(1u, bindingDesc.arraySize))
+        {
+            const std::uint32_t binding = bindingDesc.slot.index + arrayElement;
+            entries.emplace_back();
+            ConvertBindGroupLayoutEntry(entries.back(), bindingDesc, binding);
+            outBindings.push_back(WebGPULayoutBinding{ binding, bindingDesc.type, bindingDesc.bindFlags });
+        }
+    }
+
+    WGPUBindGroupLayoutDescriptor layoutDesc = {};
+    {
+        layoutDesc.entryCount   = entries.size();
+        layoutDesc.entries      = entries.data();
+    }
+    bindGroupLayouts_[type] = wgpuDeviceCreateBindGroupLayout(device, &layoutDesc);
+    bindGroupIndices_[type] = numBindGroups_++;
+}
+
+void WebGPUPipelineLayout::CreateStaticSamplers(WGPUDevice device, const std::vector<StaticSamplerDescriptor>& staticSamplers)
+{
+    if (staticSamplers.empty())
+        return;
+
+    /* Create bind group layout and a single bind group for all static samplers, since they never change */
+    std::vector<WGPUBindGroupLayoutEntry> layoutEntries(staticSamplers.size());
+    std::vector<WGPUBindGroupEntry> groupEntries(staticSamplers.size());
+    staticSamplers_.reserve(staticSamplers.size());
+
+    for_range(i, staticSamplers.size())
+    {
+        const StaticSamplerDescriptor& staticSamplerDesc = staticSamplers[i];
+        staticSamplers_.push_back(WebGPUSampler::CreateWGPUSampler(device, staticSamplerDesc.sampler));
+
+        WGPUBindGroupLayoutEntry& layoutEntry = layoutEntries[i];
+        {
+            layoutEntry = WGPUBindGroupLayoutEntry{};
+            layoutEntry.binding         = staticSamplerDesc.slot.index;
+            layoutEntry.visibility      = WebGPUTypes::ToWGPUShaderStageFlags(staticSamplerDesc.stageFlags);
+            layoutEntry.sampler.type    = WebGPUSampler::GetWGPUSamplerBindingType(staticSamplerDesc.sampler);
+        }
+        WGPUBindGroupEntry& groupEntry = groupEntries[i];
+        {
+            groupEntry = WGPUBindGroupEntry{};
+            groupEntry.binding          = staticSamplerDesc.slot.index;
+            groupEntry.sampler          = staticSamplers_.back();
+        }
+    }
+
+    WGPUBindGroupLayoutDescriptor layoutDesc = {};
+    {
+        layoutDesc.entryCount   = layoutEntries.size();
+        layoutDesc.entries      = layoutEntries.data();
+    }
+    bindGroupLayouts_[BindGroupType_StaticSamplers] = wgpuDeviceCreateBindGroupLayout(device, &layoutDesc);
+    bindGroupIndices_[BindGroupType_StaticSamplers] = numBindGroups_++;
+
+    WGPUBindGroupDescriptor groupDesc = {};
+    {
+        groupDesc.layout        = bindGroupLayouts_[BindGroupType_StaticSamplers];
+        groupDesc.entryCount    = groupEntries.size();
+        groupDesc.entries       = groupEntries.data();
+    }
+    staticSamplerBindGroup_ = wgpuDeviceCreateBindGroup(device, &groupDesc);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,134 @@
+/*
+ * WebGPUPipelineLayout.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_PIPELINE_LAYOUT_H
+#define LLGL_WEBGPU_PIPELINE_LAYOUT_H
+
+
+#include <LLGL/PipelineLayout.h>
+#include <LLGL/PipelineLayoutFlags.h>
+#include "../WebGPU.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+// Binding point of a single resource within a bind group.
+struct WebGPULayoutBinding
+{
+    std::uint32_t   binding;    // Binding index within the bind group, i.e. @binding(N) in WGSL.
+    ResourceType    type;
+    long            bindFlags;
+};
+
+/*
+WebGPU pipeline layout with up to three bind groups, mirroring the descriptor set layouts of the Vulkan backend.
+Since WGSL shaders cannot be patched at runtime, the bind group indices are assigned in ascending order to the non-empty groups
+in the following order: heap bindings, dynamic bindings, static samplers. For instance, a layout with only dynamic bindings
+and static samplers must use @group(0) for the dynamic bindings and @group(1) for the static samplers.
+The @binding(N) attribute is taken from BindingSlot::index; array elements occupy consecutive binding indices.
+*/
+class WebGPUPipelineLayout final : public PipelineLayout
+{
+
+    public:
+
+        #include <LLGL/Backend/PipelineLayout.inl>
+
+    public:
+
+        // Enumeration of bind group types.
+        enum BindGroupType
+        {
+            BindGroupType_HeapBindings = 0,
+            BindGroupType_DynamicBindings,
+            BindGroupType_StaticSamplers,
+
+            BindGroupType_Num,
+        };
+
+    public:
+
+        WebGPUPipelineLayout(WGPUDevice device, const PipelineLayoutDescriptor& desc);
+        ~WebGPUPipelineLayout();
+
+        WebGPUPipelineLayout(const WebGPUPipelineLayout&) = delete;
+        WebGPUPipelineLayout& operator = (const WebGPUPipelineLayout&) = delete;
+
+        // Returns the native WGPUPipelineLayout object.
+        inline WGPUPipelineLayout GetNative() const
+        {
+            return pipelineLayout_;
+        }
+
+        // Returns the bind group layout of the specified type. May also be null.
+        inline WGPUBindGroupLayout GetBindGroupLayout(BindGroupType type) const
+        {
+            return bindGroupLayouts_[type];
+        }
+
+        // Returns the bind group index for the specified type or ~0u if the pipeline layout has no such bind group.
+        inline std::uint32_t GetBindGroupIndex(BindGroupType type) const
+        {
+            return bindGroupIndices_[type];
+        }
+
+        // Returns the bind group that holds all static samplers. May also be null.
+        inline WGPUBindGroup GetStaticSamplerBindGroup() const
+        {
+            return staticSamplerBindGroup_;
+        }
+
+        // Returns the list of heap binding points, where each array element has its own entry.
+        inline const std::vector<WebGPULayoutBinding>& GetHeapBindings() const
+        {
+            return heapBindings_;
+        }
+
+        // Returns the list of dynamic binding points, where each array element has its own entry.
+        inline const std::vector<WebGPULayoutBinding>& GetBindings() const
+        {
+            return bindings_;
+        }
+
+    private:
+
+        void CreateBindGroupLayout(
+            WGPUDevice                              device,
+            BindGroupType                           type,
+            const std::vector<BindingDescriptor>&   inBindings,
+            std::vector<WebGPULayoutBinding>&       outBindings
+        );
+
+        void CreateStaticSamplers(WGPUDevice device, const std::vector<StaticSamplerDescriptor>& staticSamplers);
+
+    private:
+
+        WGPUPipelineLayout                  pipelineLayout_                         = nullptr;
+        WGPUBindGroupLayout                 bindGroupLayouts_[BindGroupType_Num]    = {};
+        std::uint32_t                       bindGroupIndices_[BindGroupType_Num]    = { ~0u, ~0u, ~0u };
+        std::uint32_t                       numBindGroups_                          = 0;
+
+        std::vector<WebGPULayoutBinding>    heapBindings_;
+        std::vector<WebGPULayoutBinding>    bindings_;
+        std::vector<WGPUSampler>            staticSamplers_;
+        WGPUBindGroup                       staticSamplerBindGroup_                 = nullptr;
+        std::uint32_t                       numUniforms_                            = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,259 @@
+/*
+ * WebGPUPipelineState.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUPipelineState.h"
+#include "WebGPUPipelineLayout.h"
+#include "WebGPURenderPass.h"
+#include "../Shader/WebGPUShader.h"
+#include "../WebGPUTypes.h"
+#include "../../CheckedCast.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <LLGL/RenderPassFlags.h>
+
+
+namespace LLGL
+{
+
+
+static void ConvertStencilFaceState(WGPUStencilFaceState& dst, const StencilFaceDescriptor& src)
+{
+    dst.compare     = WebGPUTypes::Map(src.compareOp);
+    dst.failOp      = WebGPUTypes::Map(src.stencilFailOp);
+    dst.depthFailOp = WebGPUTypes::Map(src.depthFailOp);
+    dst.passOp      = WebGPUTypes::Map(src.depthPassOp);
+}
+
+static void ConvertDepthStencilState(WGPUDepthStencilState& dst, const GraphicsPipelineDescriptor& src, WGPUTextureFormat format)
+{
+    dst = WGPUDepthStencilState{};
+    dst.format              = format;
+    dst.depthWriteEnabled   = (src.depth.testEnabled && src.depth.writeEnabled);
+    dst.depthCompare        = (src.depth.testEnabled ? WebGPUTypes::Map(src.depth.compareOp) : WGPUCompareFunction_Always);
+
+    if (src.stencil.testEnabled)
+    {
+        ConvertStencilFaceState(dst.stencilFront, src.stencil.front);
+        ConvertStencilFaceState(dst.stencilBack, src.stencil.back);
+        dst.stencilReadMask     = src.stencil.front.readMask;
+        dst.stencilWriteMask    = src.stencil.front.writeMask;
+    }
+    else
+    {
+        const WGPUStencilFaceState disabledFace{ WGPUCompareFunction_Always, WGPUStencilOperation_Keep, WGPUStencilOperation_Keep, WGPUStencilOperation_Keep };
+        dst.stencilFront        = disabledFace;
+        dst.stencilBack         = disabledFace;
+        dst.stencilReadMask     = 0;
+        dst.stencilWriteMask    = 0;
+    }
+
+    dst.depthBias           = static_cast<std::int32_t>(src.rasterizer.depthBias.constantFactor);
+    dst.depthBiasSlopeScale = src.rasterizer.depthBias.slopeFactor;
+    dst.depthBiasClamp      = src.rasterizer.depthBias.clamp;
+}
+
+static void ConvertBlendTargetState(WGPUBlendState& dst, const BlendTargetDescriptor& src)
+{
+    dst.color.operation = WebGPUTypes::Map(src.colorArithmetic);
+    dst.color.srcFactor = WebGPUTypes::Map(src.srcColor);
+    dst.color.dstFactor = WebGPUTypes::Map(src.dstColor);
+    dst.alpha.operation = WebGPUTypes::Map(src.alphaArithmetic);
+    dst.alpha.srcFactor = WebGPUTypes::Map(src.srcAlpha);
+    dst.alpha.dstFactor = WebGPUTypes::Map(src.dstAlpha);
+}
+
+static bool IsStripTopology(const PrimitiveTopology topology)
+{
+    return (topology == PrimitiveTopology::LineStrip || topology == PrimitiveTopology::TriangleStrip);
+}
+
+WebGPUPipelineState::WebGPUPipelineState(WGPUDevice device, const GraphicsPipelineDescriptor& desc, const WebGPURenderPass* defaultRenderPass) :
+    pipelineLayout_ { LLGL_CAST(const WebGPUPipelineLayout*, desc.pipelineLayout) }
+{
+    /* Validate shader stages that are not supported by WebGPU */
+    if (desc.tessControlShader != nullptr || desc.tessEvaluationShader != nullptr || desc.geometryShader != nullptr ||
+        desc.meshShader != nullptr || desc.taskShader != nullptr || desc.tileShader != nullptr)
+    {
+        report_.Errorf("WebGPU only supports vertex, fragment, and compute shaders\n");
+        return;
+    }
+    if (desc.vertexShader == nullptr)
+    {
+        report_.Errorf("cannot create graphics PSO without vertex shader\n");
+        return;
+    }
+
+    /* Get render pass to determine attachment formats */
+    const WebGPURenderPass* renderPass = (desc.renderPass != nullptr ? LLGL_CAST(const WebGPURenderPass*, desc.renderPass) : defaultRenderPass);
+    if (renderPass == nullptr)
+    {
+        report_.Errorf("cannot create graphics PSO without render pass before any swap-chain has been created\n");
+        return;
+    }
+
+    /* Convert vertex stage */
+    auto* vertexShaderWGPU = LLGL_CAST(const WebGPUShader*, desc.vertexShader);
+
+    std::vector<WGPUVertexBufferLayout> vertexBufferLayouts;
+    std::vector<WGPUVertexAttribute> vertexAttributes;
+    vertexShaderWGPU->FillVertexBufferLayouts(vertexBufferLayouts, vertexAttributes);
+
+    WGPURenderPipelineDescriptor pipelineDesc = {};
+    pipelineDesc.label                      = desc.debugName;
+    pipelineDesc.layout                     = (pipelineLayout_ != nullptr ? pipelineLayout_->GetNative() : nullptr);
+    pipelineDesc.vertex.module              = vertexShaderWGPU->GetNative();
+    pipelineDesc.vertex.entryPoint          = vertexShaderWGPU->GetEntryPoint();
+    pipelineDesc.vertex.bufferCount         = vertexBufferLayouts.size();
+    pipelineDesc.vertex.buffers             = vertexBufferLayouts.data();
+
+    /* Convert primitive state; WebGPU has neither wireframe rasterization nor depth clamping */
+    stripIndexFormat_ = (IsStripTopology(desc.primitiveTopology) ? WebGPUTypes::ToWGPUIndexFormat(desc.indexFormat) : WGPUIndexFormat_Undefined);
+    pipelineDesc.primitive.topology         = WebGPUTypes::Map(desc.primitiveTopology);
+    pipelineDesc.primitive.stripIndexFormat = stripIndexFormat_;
+    pipelineDesc.primitive.frontFace        = (desc.rasterizer.frontCCW ? WGPUFrontFace_CCW : WGPUFrontFace_CW);
+    pipelineDesc.primitive.cullMode         = WebGPUTypes::Map(desc.rasterizer.cullMode);
+
+    /* Convert depth-stencil state */
+    WGPUDepthStencilState depthStencilState;
+    if (renderPass->GetDepthStencilFormat() != WGPUTextureFormat_Undefined)
+    {
+        ConvertDepthStencilState(depthStencilState, desc, renderPass->GetDepthStencilFormat());
+        pipelineDesc.depthStencil = &depthStencilState;
+    }
+
+    /* Convert multi-sample state */
+    pipelineDesc.multisample.count                  = renderPass->GetSamples();
+    pipelineDesc.multisample.mask                   = desc.blend.sampleMask;
+    pipelineDesc.multisample.alphaToCoverageEnabled = desc.blend.alphaToCoverageEnabled;
+
+    /* Convert fragment stage */
+    WGPUColorTargetState colorTargets[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    WGPUBlendState blendStates[LLGL_MAX_NUM_COLOR_ATTACHMENTS];
+    WGPUFragmentState fragmentState = {};
+
+    const std::uint32_t numColorTargets = renderPass->GetNumColorAttachments();
+    for_range(i, numColorTargets)
+    {
+        const BlendTargetDescriptor& targetDesc = desc.blend.targets[desc.blend.independentBlendEnabled ? i : 0];
+        ConvertBlendTargetState(blendStates[i], targetDesc);
+
+        colorTargets[i]             = WGPUColorTargetState{};
+        colorTargets[i].format      = renderPass->GetColorFormat(i);
+        colorTargets[i].blend       = (targetDesc.blendEnabled ? &blendStates[i] : nullptr);
+        colorTargets[i].writeMask   = (desc.rasterizer.discardEnabled ? static_cast<WGPUColorWriteMaskFlags>(WGPUColorWriteMask_None) : WebGPUTypes::ToWGPUColorWriteMask(targetDesc.colorMask));
+    }
+
+    if (desc.fragmentShader != nullptr)
+    {
+        auto* fragmentShaderWGPU = LLGL_CAST(const WebGPUShader*, desc.fragmentShader);
+        fragmentState.module        = fragmentShaderWGPU->GetNative();
+        fragmentState.entryPoint    = fragmentShaderWGPU->GetEntryPoint();
+        fragmentState.targetCount   = numColorTargets;
+        fragmentState.targets       = colorTargets;
+        pipelineDesc.fragment       = &fragmentState;
+    }
+
+    renderPipeline_ = wgpuDeviceCreateRenderPipeline(device, &pipelineDesc);
+
+    /* Store static states that must be set on the render pass encoder */
+    staticViewports_    = desc.viewports;
+    staticScissors_     = desc.scissors;
+
+    if (desc.stencil.testEnabled && !desc.stencil.referenceDynamic)
+    {
+        hasStaticStencilRef_    = true;
+        stencilRef_             = desc.stencil.front.reference;
+    }
+
+    if (!desc.blend.blendFactorDynamic)
+    {
+        hasStaticBlendFactor_   = true;
+        blendFactor_            = WGPUColor{ desc.blend.blendFactor[0], desc.blend.blendFactor[1], desc.blend.blendFactor[2], desc.blend.blendFactor[3] };
+    }
+}
+
+WebGPUPipelineState::WebGPUPipelineState(WGPUDevice device, const ComputePipelineDescriptor& desc) :
+    pipelineLayout_ { LLGL_CAST(const WebGPUPipelineLayout*, desc.pipelineLayout) }
+{
+    if (desc.computeShader == nullptr)
+    {
+        report_.Errorf("cannot create compute PSO without compute shader\n");
+        return;
+    }
+
+    auto* computeShaderWGPU = LLGL_CAST(const WebGPUShader*, desc.computeShader);
+
+    WGPUComputePipelineDescriptor pipelineDesc = {};
+    {
+        pipelineDesc.label              = desc.debugName;
+        pipelineDesc.layout             = (pipelineLayout_ != nullptr ? pipelineLayout_->GetNative() : nullptr);
+        pipelineDesc.compute.module     = computeShaderWGPU->GetNative();
+        pipelineDesc.compute.entryPoint = computeShaderWGPU->GetEntryPoint();
+    }
+    computePipeline_ = wgpuDeviceCreateComputePipeline(device, &pipelineDesc);
+}
+
+WebGPUPipelineState::~WebGPUPipelineState()
+{
+    if (renderPipeline_ != nullptr)
+        wgpuRenderPipelineRelease(renderPipeline_);
+    if (computePipeline_ != nullptr)
+        wgpuComputePipelineRelease(computePipeline_);
+}
+
+void WebGPUPipelineState::SetDebugName(const char* name)
+{
+    if (renderPipeline_ != nullptr)
+        wgpuRenderPipelineSetLabel(renderPipeline_, name);
+    if (computePipeline_ != nullptr)
+        wgpuComputePipelineSetLabel(computePipeline_, name);
+}
+
+const Report* WebGPUPipelineState::GetReport() const
+{
+    return (report_ ? &report_ : nullptr);
+}
+
+void WebGPUPipelineState::Bind(WGPURenderPassEncoder renderPassEncoder) const
+{
+    wgpuRenderPassEncoderSetPipeline(renderPassEncoder, renderPipeline_);
+
+    /* WebGPU only supports a single viewport and scissor rectangle */
+    if (!staticViewports_.empty())
+    {
+        const Viewport& viewport = staticViewports_.front();
+        wgpuRenderPassEncoderSetViewport(renderPassEncoder, viewport.x, viewport.y, viewport.width, viewport.height, viewport.minDepth, viewport.maxDepth);
+    }
+    if (!staticScissors_.empty())
+    {
+        const Scissor& scissor = staticScissors_.front();
+        wgpuRenderPassEncoderSetScissorRect(
+            renderPassEncoder,
+            static_cast<std::uint32_t>(scissor.x),
+            static_cast<std::uint32_t>(scissor.y),
+            static_cast<std::uint32_t>(scissor.width),
+            static_cast<std::uint32_t>(scissor.height)
+        );
+    }
+
+    if (hasStaticStencilRef_)
+        wgpuRenderPassEncoderSetStencilReference(renderPassEncoder, stencilRef_);
+    if (hasStaticBlendFactor_)
+        wgpuRenderPassEncoderSetBlendConstant(renderPassEncoder, &blendFactor_);
+}
+
+void WebGPUPipelineState::Bind(WGPUComputePassEncoder computePassEncoder) const
+{
+    wgpuComputePassEncoderSetPipeline(computePassEncoder, computePipeline_);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,97 @@
+/*
+ * WebGPUPipelineState.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_PIPELINE_STATE_H
+#define LLGL_WEBGPU_PIPELINE_STATE_H
+
+
+#include <LLGL/PipelineState.h>
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/Report.h>
+#include "../WebGPU.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class WebGPUPipelineLayout;
+class WebGPURenderPass;
+
+class WebGPUPipelineState final : public PipelineState
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+        const Report* GetReport() const override;
+
+    public:
+
+        // Creates a render pipeline. If the descriptor has no render pass, the specified default render pass is used instead.
+        WebGPUPipelineState(WGPUDevice device, const GraphicsPipelineDescriptor& desc, const WebGPURenderPass* defaultRenderPass);
+
+        // Creates a compute pipeline.
+        WebGPUPipelineState(WGPUDevice device, const ComputePipelineDescriptor& desc);
+
+        ~WebGPUPipelineState();
+
+        WebGPUPipelineState(const WebGPUPipelineState&) = delete;
+        WebGPUPipelineState& operator = (const WebGPUPipelineState&) = delete;
+
+        // Binds the render pipeline and its static states to the specified render pass encoder.
+        void Bind(WGPURenderPassEncoder renderPassEncoder) const;
+
+        // Binds the compute pipeline to the specified compute pass encoder.
+        void Bind(WGPUComputePassEncoder computePassEncoder) const;
+
+        // Returns true if this is a graphics pipeline.
+        inline bool IsGraphicsPSO() const
+        {
+            return (renderPipeline_ != nullptr);
+        }
+
+        // Returns the pipeline layout this PSO was created with. May also be null.
+        inline const WebGPUPipelineLayout* GetPipelineLayout() const
+        {
+            return pipelineLayout_;
+        }
+
+        // Returns the index format for strip topologies or WGPUIndexFormat_Undefined.
+        inline WGPUIndexFormat GetStripIndexFormat() const
+        {
+            return stripIndexFormat_;
+        }
+
+    private:
+
+        WGPURenderPipeline          renderPipeline_     = nullptr;
+        WGPUComputePipeline         computePipeline_    = nullptr;
+        const WebGPUPipelineLayout* pipelineLayout_     = nullptr;
+        Report                      report_;
+
+        /* Static states that are not part of a WebGPU pipeline */
+        std::vector<Viewport>       staticViewports_;
+        std::vector<Scissor>        staticScissors_;
+        bool                        hasStaticStencilRef_    = false;
+        std::uint32_t               stencilRef_             = 0;
+        bool                        hasStaticBlendFactor_   = false;
+        WGPUColor                   blendFactor_            = {};
+        WGPUIndexFormat             stripIndexFormat_       = WGPUIndexFormat_Undefined;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
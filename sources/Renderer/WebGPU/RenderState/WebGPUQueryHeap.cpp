@@ -0,0 +1,45 @@
+/*
+ * WebGPUQueryHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUQueryHeap.h"
+#include "../WebGPUTypes.h"
+
+
+namespace LLGL
+{
+
+
+WebGPUQueryHeap::WebGPUQueryHeap(WGPUDevice device, const QueryHeapDescriptor& desc) :
+    QueryHeap    { desc.type                                       },
+    queryStride_ { (desc.type == QueryType::TimeElapsed ? 2u : 1u) }
+{
+    WGPUQuerySetDescriptor querySetDesc = {};
+    {
+        querySetDesc.label  = desc.debugName;
+        querySetDesc.type   = WebGPUTypes::Map(desc.type);
+        querySetDesc.count  = desc.numQueries * queryStride_;
+    }
+    querySet_ = wgpuDeviceCreateQuerySet(device, &querySetDesc);
+}
+
+WebGPUQueryHeap::~WebGPUQueryHeap()
+{
+    wgpuQuerySetDestroy(querySet_);
+    wgpuQuerySetRelease(querySet_);
+}
+
+void WebGPUQueryHeap::SetDebugName(const char* name)
+{
+    wgpuQuerySetSetLabel(querySet_, name);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
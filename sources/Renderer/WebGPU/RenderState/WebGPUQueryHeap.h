@@ -0,0 +1,67 @@
+/*
+ * WebGPUQueryHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_QUERY_HEAP_H
+#define LLGL_WEBGPU_QUERY_HEAP_H
+
+
+#include <LLGL/QueryHeap.h>
+#include <LLGL/QueryHeapFlags.h>
+#include "../WebGPU.h"
+
+
+namespace LLGL
+{
+
+
+/*
+Query heap for occlusion and timestamp queries. Time-elapsed queries occupy two consecutive timestamps per query.
+Query results can only be read by resolving them into a buffer via CommandBuffer::ResolveQueryData.
+*/
+class WebGPUQueryHeap final : public QueryHeap
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        WebGPUQueryHeap(WGPUDevice device, const QueryHeapDescriptor& desc);
+        ~WebGPUQueryHeap();
+
+        WebGPUQueryHeap(const WebGPUQueryHeap&) = delete;
+        WebGPUQueryHeap& operator = (const WebGPUQueryHeap&) = delete;
+
+        // Returns the native WGPUQuerySet object.
+        inline WGPUQuerySet GetNative() const
+        {
+            return querySet_;
+        }
+
+        // Returns the number of native queries per LLGL query, i.e. 2 for time-elapsed queries and 1 otherwise.
+        inline std::uint32_t GetQueryStride() const
+        {
+            return queryStride_;
+        }
+
+    private:
+
+        WGPUQuerySet    querySet_       = nullptr;
+        std::uint32_t   queryStride_    = 1;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
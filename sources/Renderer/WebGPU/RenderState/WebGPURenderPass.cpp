@@ -0,0 +1,108 @@
+/*
+ * WebGPURenderPass.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPURenderPass.h"
+#include "../WebGPUTypes.h"
+#include "../../RenderPassUtils.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+WebGPURenderPass::WebGPURenderPass(const RenderPassDescriptor& desc) :
+    numColorAttachments_ { NumEnabledColorAttachments(desc) },
+    samples_             { std::max(1u, desc.samples)       }
+{
+    for_range(i, numColorAttachments_)
+    {
+        colorFormats_[i]    = WebGPUTypes::Map(desc.colorAttachments[i].format);
+        colorLoadOps_[i]    = WebGPUTypes::Map(desc.colorAttachments[i].loadOp);
+        colorStoreOps_[i]   = WebGPUTypes::Map(desc.colorAttachments[i].storeOp);
+        if (desc.colorAttachments[i].loadOp == AttachmentLoadOp::Clear)
+            clearColorMask_ |= (1u << i);
+    }
+
+    /* WebGPU has a single depth-stencil attachment; the depth format takes precedence */
+    const Format depthStencilFormat = (desc.depthAttachment.format != Format::Undefined ? desc.depthAttachment.format : desc.stencilAttachment.format);
+    if (depthStencilFormat != Format::Undefined)
+    {
+        depthStencilFormat_ = WebGPUTypes::Map(depthStencilFormat);
+
+        /* Load/store operations must only be specified for the aspects the format actually has */
+        if (IsDepthFormat(depthStencilFormat))
+        {
+            depthLoadOp_    = WebGPUTypes::Map(desc.depthAttachment.loadOp);
+            depthStoreOp_   = WebGPUTypes::Map(desc.depthAttachment.storeOp);
+        }
+        if (IsStencilFormat(depthStencilFormat))
+        {
+            stencilLoadOp_  = WebGPUTypes::Map(desc.stencilAttachment.loadOp);
+            stencilStoreOp_ = WebGPUTypes::Map(desc.stencilAttachment.storeOp);
+        }
+        clearDepthStencil_ = (desc.depthAttachment.loadOp == AttachmentLoadOp::Clear || desc.stencilAttachment.loadOp == AttachmentLoadOp::Clear);
+    }
+}
+
+void WebGPURenderPass::FillAttachmentOps(
+    std::uint32_t                           numColorAttachments,
+    WGPURenderPassColorAttachment*          colorAttachments,
+    WGPURenderPassDepthStencilAttachment*   depthStencilAttachment,
+    std::uint32_t                           numClearValues,
+    const ClearValue*                       clearValues) const
+{
+    /* Only attachments with an explicit clear operation consume a clear value; undefined load operations clear to the default value */
+    std::uint32_t clearIndex = 0;
+
+    for_range(i, std::min(numColorAttachments, numColorAttachments_))
+    {
+        WGPURenderPassColorAttachment& dst = colorAttachments[i];
+        dst.loadOp  = colorLoadOps_[i];
+        dst.storeOp = colorStoreOps_[i];
+        if (dst.loadOp == WGPULoadOp_Clear)
+        {
+            if (((clearColorMask_ >> i) & 0x1u) != 0 && clearIndex < numClearValues)
+            {
+                const ClearValue& src = clearValues[clearIndex++];
+                dst.clearValue = WGPUColor{ src.color[0], src.color[1], src.color[2], src.color[3] };
+            }
+            else
+                dst.clearValue = WGPUColor{ 0.0, 0.0, 0.0, 0.0 };
+        }
+    }
+
+    if (depthStencilAttachment != nullptr)
+    {
+        depthStencilAttachment->depthLoadOp     = depthLoadOp_;
+        depthStencilAttachment->depthStoreOp    = depthStoreOp_;
+        depthStencilAttachment->stencilLoadOp   = stencilLoadOp_;
+        depthStencilAttachment->stencilStoreOp  = stencilStoreOp_;
+        if (depthLoadOp_ == WGPULoadOp_Clear || stencilLoadOp_ == WGPULoadOp_Clear)
+        {
+            if (clearDepthStencil_ && clearIndex < numClearValues)
+            {
+                const ClearValue& src = clearValues[clearIndex];
+                depthStencilAttachment->depthClearValue     = src.depth;
+                depthStencilAttachment->stencilClearValue   = src.stencil;
+            }
+            else
+            {
+                depthStencilAttachment->depthClearValue     = 1.0f;
+                depthStencilAttachment->stencilClearValue   = 0;
+            }
+        }
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
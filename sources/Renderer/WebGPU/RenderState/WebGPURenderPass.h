@@ -0,0 +1,95 @@
+/*
+ * WebGPURenderPass.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_RENDER_PASS_H
+#define LLGL_WEBGPU_RENDER_PASS_H
+
+
+#include <LLGL/RenderPass.h>
+#include <LLGL/RenderPassFlags.h>
+#include <LLGL/CommandBufferFlags.h>
+#include <LLGL/Constants.h>
+#include "../WebGPU.h"
+
+
+namespace LLGL
+{
+
+
+/*
+WebGPU has no render pass objects; this class only stores the attachment formats and load/store operations
+that are required to create render pipelines and to begin a render pass on a command encoder.
+*/
+class WebGPURenderPass final : public RenderPass
+{
+
+    public:
+
+        WebGPURenderPass(const RenderPassDescriptor& desc);
+
+        /*
+        Fills the load/store operations and clear values of the specified render pass attachments.
+        Clear values are consumed in order of all attachments that are cleared; the depth-stencil attachment comes last.
+        */
+        void FillAttachmentOps(
+            std::uint32_t                           numColorAttachments,
+            WGPURenderPassColorAttachment*          colorAttachments,
+            WGPURenderPassDepthStencilAttachment*   depthStencilAttachment,
+            std::uint32_t                           numClearValues,
+            const ClearValue*                       clearValues
+        ) const;
+
+        // Returns the number of color attachments.
+        inline std::uint32_t GetNumColorAttachments() const
+        {
+            return numColorAttachments_;
+        }
+
+        // Returns the native format of the specified color attachment.
+        inline WGPUTextureFormat GetColorFormat(std::uint32_t index) const
+        {
+            return colorFormats_[index];
+        }
+
+        // Returns the native format of the depth-stencil attachment or WGPUTextureFormat_Undefined if there is none.
+        inline WGPUTextureFormat GetDepthStencilFormat() const
+        {
+            return depthStencilFormat_;
+        }
+
+        // Returns the number of samples for all attachments.
+        inline std::uint32_t GetSamples() const
+        {
+            return samples_;
+        }
+
+    private:
+
+        std::uint32_t       numColorAttachments_                            = 0;
+        WGPUTextureFormat   colorFormats_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]   = {};
+        WGPULoadOp          colorLoadOps_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]   = {};
+        WGPUStoreOp         colorStoreOps_[LLGL_MAX_NUM_COLOR_ATTACHMENTS]  = {};
+        WGPUTextureFormat   depthStencilFormat_                             = WGPUTextureFormat_Undefined;
+        WGPULoadOp          depthLoadOp_                                    = WGPULoadOp_Undefined;
+        WGPUStoreOp         depthStoreOp_                                   = WGPUStoreOp_Undefined;
+        WGPULoadOp          stencilLoadOp_                                  = WGPULoadOp_Undefined;
+        WGPUStoreOp         stencilStoreOp_                                 = WGPUStoreOp_Undefined;
+        std::uint32_t       samples_                                        = 1;
+        std::uint32_t       clearColorMask_                                 = 0;
+        bool                clearDepthStencil_                              = false;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
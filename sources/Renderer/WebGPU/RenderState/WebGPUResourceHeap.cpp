@@ -0,0 +1,235 @@
+/*
+ * WebGPUResourceHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUResourceHeap.h"
+#include "../Buffer/WebGPUBuffer.h"
+#include "../Texture/WebGPUTexture.h"
+#include "../Texture/WebGPUSampler.h"
+#include "../../CheckedCast.h"
+#include "../../ResourceUtils.h"
+#include "../../BufferUtils.h"
+#include "../../TextureUtils.h"
+#include "../../../Core/Exception.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+WebGPUResourceHeap::WebGPUResourceHeap(WGPUDevice device, const ResourceHeapDescriptor& desc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
+{
+    /* Get pipeline layout object */
+    auto* pipelineLayoutWGPU = LLGL_CAST(const WebGPUPipelineLayout*, desc.pipelineLayout);
+    if (!pipelineLayoutWGPU)
+        LLGL_TRAP("failed to create resource heap with null pointer for pipeline layout");
+
+    bindGroupLayout_    = pipelineLayoutWGPU->GetBindGroupLayout(WebGPUPipelineLayout::BindGroupType_HeapBindings);
+    bindGroupIndex_     = pipelineLayoutWGPU->GetBindGroupIndex(WebGPUPipelineLayout::BindGroupType_HeapBindings);
+    bindings_           = pipelineLayoutWGPU->GetHeapBindings();
+
+    /* Allocate bind group entries for all descriptor sets */
+    const std::uint32_t numBindings         = std::max(1u, static_cast<std::uint32_t>(bindings_.size()));
+    const std::uint32_t numResourceViews    = GetNumResourceViewsOrThrow(numBindings, desc, initialResourceViews);
+    const std::uint32_t numDescriptorSets   = numResourceViews / numBindings;
+
+    entries_.resize(numResourceViews, WGPUBindGroupEntry{});
+    ownedViews_.resize(numResourceViews, nullptr);
+    bindGroups_.resize(numDescriptorSets, nullptr);
+
+    for_range(i, numResourceViews)
+        entries_[i].binding = bindings_[i % bindings_.size()].binding;
+
+    if (!initialResourceViews.empty())
+        WriteResourceViews(device, 0, initialResourceViews);
+
+    if (desc.debugName != nullptr)
+        SetDebugName(desc.debugName);
+}
+
+WebGPUResourceHeap::~WebGPUResourceHeap()
+{
+    for (WGPUBindGroup bindGroup : bindGroups_)
+    {
+        if (bindGroup != nullptr)
+            wgpuBindGroupRelease(bindGroup);
+    }
+    for (WGPUTextureView view : ownedViews_)
+    {
+        if (view != nullptr)
+            wgpuTextureViewRelease(view);
+    }
+}
+
+void WebGPUResourceHeap::SetDebugName(const char* name)
+{
+    for (WGPUBindGroup bindGroup : bindGroups_)
+    {
+        if (bindGroup != nullptr)
+            wgpuBindGroupSetLabel(bindGroup, name);
+    }
+}
+
+std::uint32_t WebGPUResourceHeap::GetNumDescriptorSets() const
+{
+    return static_cast<std::uint32_t>(bindGroups_.size());
+}
+
+std::uint32_t WebGPUResourceHeap::WriteResourceViews(WGPUDevice device, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    /* Quit if there's nothing to do */
+    if (resourceViews.empty() || bindings_.empty())
+        return 0;
+
+    const std::uint32_t numBindings     = static_cast<std::uint32_t>(bindings_.size());
+    const std::uint32_t numDescriptors  = static_cast<std::uint32_t>(entries_.size());
+
+    if (firstDescriptor >= numDescriptors)
+        LLGL_TRAP("first descriptor (%u) in resource heap is out of bounds (%u)", firstDescriptor, numDescriptors);
+
+    /* Update bind group entries */
+    std::uint32_t numWritten = 0;
+    const std::uint32_t numViews = std::min(static_cast<std::uint32_t>(resourceViews.size()), numDescriptors - firstDescriptor);
+
+    for_range(i, numViews)
+    {
+        const ResourceViewDescriptor& resourceViewDesc = resourceViews[i];
+        if (resourceViewDesc.resource == nullptr)
+            continue;
+
+        const std::uint32_t descriptor = firstDescriptor + i;
+        if (ownedViews_[descriptor] != nullptr)
+        {
+            wgpuTextureViewRelease(ownedViews_[descriptor]);
+            ownedViews_[descriptor] = nullptr;
+        }
+        ownedViews_[descriptor] = FillBindGroupEntry(entries_[descriptor], bindings_[descriptor % numBindings], resourceViewDesc);
+        ++numWritten;
+    }
+
+    /* Re-create all bind groups that are affected by this update */
+    const std::uint32_t firstSet    = firstDescriptor / numBindings;
+    const std::uint32_t lastSet     = (firstDescriptor + numViews - 1) / numBindings;
+
+    for (std::uint32_t descriptorSet = firstSet; descriptorSet <= lastSet; ++descriptorSet)
+        UpdateBindGroup(device, descriptorSet);
+
+    return numWritten;
+}
+
+WGPUTextureView WebGPUResourceHeap::FillBindGroupEntry(
+    WGPUBindGroupEntry&             dst,
+    const WebGPULayoutBinding&      binding,
+    const ResourceViewDescriptor&   resourceViewDesc)
+{
+    Resource& resource = *resourceViewDesc.resource;
+    FillBindGroupEntry(dst, binding, resource);
+
+    if (resource.GetResourceType() == ResourceType::Texture && IsTextureViewEnabled(resourceViewDesc.textureView))
+    {
+        /* Replace default view with a subresource view */
+        auto& textureWGPU = LLGL_CAST(WebGPUTexture&, resource);
+        dst.textureView = textureWGPU.CreateView(resourceViewDesc.textureView);
+        return dst.textureView;
+    }
+
+    if (resource.GetResourceType() == ResourceType::Buffer && IsBufferViewEnabled(resourceViewDesc.bufferView))
+    {
+        /* Restrict buffer binding to the specified range */
+        auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, resource);
+        dst.offset  = resourceViewDesc.bufferView.offset;
+        dst.size    =
+        (
+            resourceViewDesc.bufferView.size == LLGL_WHOLE_SIZE
+                ? bufferWGPU.GetSize() - resourceViewDesc.bufferView.offset
+                : resourceViewDesc.bufferView.size
+        );
+    }
+
+    return nullptr;
+}
+
+void WebGPUResourceHeap::FillBindGroupEntry(
+    WGPUBindGroupEntry&             dst,
+    const WebGPULayoutBinding&      binding,
+    Resource&                       resource)
+{
+    const std::uint32_t bindingIndex = dst.binding;
+    dst = WGPUBindGroupEntry{};
+    dst.binding = bindingIndex;
+
+    switch (binding.type)
+    {
+        case ResourceType::Buffer:
+        {
+            auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, resource);
+            dst.buffer  = bufferWGPU.GetNative();
+            dst.offset  = 0;
+            dst.size    = bufferWGPU.GetSize();
+        }
+        break;
+
+        case ResourceType::Texture:
+        {
+            auto& textureWGPU = LLGL_CAST(WebGPUTexture&, resource);
+            dst.textureView = textureWGPU.GetDefaultView();
+        }
+        break;
+
+        case ResourceType::Sampler:
+        {
+            auto& samplerWGPU = LLGL_CAST(WebGPUSampler&, resource);
+            dst.sampler = samplerWGPU.GetNative();
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+static bool IsBindGroupEntryComplete(const WGPUBindGroupEntry& entry)
+{
+    return (entry.buffer != nullptr || entry.sampler != nullptr || entry.textureView != nullptr);
+}
+
+void WebGPUResourceHeap::UpdateBindGroup(WGPUDevice device, std::uint32_t descriptorSet)
+{
+    const std::size_t numBindings = bindings_.size();
+    const WGPUBindGroupEntry* entries = &entries_[descriptorSet * numBindings];
+
+    /* Bind groups can only be created once all of their entries have been written */
+    for_range(i, numBindings)
+    {
+        if (!IsBindGroupEntryComplete(entries[i]))
+            return;
+    }
+
+    WGPUBindGroupDescriptor groupDesc = {};
+    {
+        groupDesc.layout        = bindGroupLayout_;
+        groupDesc.entryCount    = numBindings;
+        groupDesc.entries       = entries;
+    }
+    WGPUBindGroup& bindGroup = bindGroups_[descriptorSet];
+    if (bindGroup != nullptr)
+        wgpuBindGroupRelease(bindGroup);
+    bindGroup = wgpuDeviceCreateBindGroup(device, &groupDesc);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,100 @@
+/*
+ * WebGPUResourceHeap.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_RESOURCE_HEAP_H
+#define LLGL_WEBGPU_RESOURCE_HEAP_H
+
+
+#include <LLGL/ResourceHeap.h>
+#include <LLGL/ResourceHeapFlags.h>
+#include <LLGL/Container/ArrayView.h>
+#include "WebGPUPipelineLayout.h"
+#include "../WebGPU.h"
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class Resource;
+
+// Resource heap with one WGPUBindGroup per descriptor set.
+class WebGPUResourceHeap final : public ResourceHeap
+{
+
+    public:
+
+        void SetDebugName(const char* name) override;
+        std::uint32_t GetNumDescriptorSets() const override;
+
+    public:
+
+        WebGPUResourceHeap(WGPUDevice device, const ResourceHeapDescriptor& desc, const ArrayView<ResourceViewDescriptor>& initialResourceViews = {});
+        ~WebGPUResourceHeap();
+
+        WebGPUResourceHeap(const WebGPUResourceHeap&) = delete;
+        WebGPUResourceHeap& operator = (const WebGPUResourceHeap&) = delete;
+
+        // Writes the specified resource views and re-creates all bind groups that have been modified.
+        std::uint32_t WriteResourceViews(WGPUDevice device, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews);
+
+        // Returns the bind group for the specified descriptor set. This is null if not all descriptors of that set have been written yet.
+        inline WGPUBindGroup GetBindGroup(std::uint32_t descriptorSet) const
+        {
+            return bindGroups_[descriptorSet];
+        }
+
+        // Returns the bind group index the heap bindings are assigned to.
+        inline std::uint32_t GetBindGroupIndex() const
+        {
+            return bindGroupIndex_;
+        }
+
+    public:
+
+        /*
+        Fills the resource of a bind group entry for the specified resource view.
+        Returns a new texture view if a subresource view was specified or null otherwise. The caller takes ownership of the returned view.
+        */
+        static WGPUTextureView FillBindGroupEntry(
+            WGPUBindGroupEntry&             dst,
+            const WebGPULayoutBinding&      binding,
+            const ResourceViewDescriptor&   resourceViewDesc
+        );
+
+        // Fills the resource of a bind group entry for the entire specified resource.
+        static void FillBindGroupEntry(
+            WGPUBindGroupEntry&             dst,
+            const WebGPULayoutBinding&      binding,
+            Resource&                       resource
+        );
+
+    private:
+
+        void UpdateBindGroup(WGPUDevice device, std::uint32_t descriptorSet);
+
+    private:
+
+        WGPUBindGroupLayout                 bindGroupLayout_    = nullptr;
+        std::uint32_t                       bindGroupIndex_     = 0;
+        std::vector<WebGPULayoutBinding>    bindings_;
+        std::vector<WGPUBindGroupEntry>     entries_;           // Bind group entries for all descriptor sets
+        std::vector<WGPUTextureView>        ownedViews_;        // Subresource texture views with the same layout as 'entries_'
+        std::vector<WGPUBindGroup>          bindGroups_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
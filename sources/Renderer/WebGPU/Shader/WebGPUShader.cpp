@@ -0,0 +1,194 @@
+/*
+ * WebGPUShader.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUShader.h"
+#include "../WebGPUTypes.h"
+#include "../../../Core/StringUtils.h"
+#include <LLGL/Utils/TypeNames.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+WebGPUShader::WebGPUShader(WGPUDevice device, const ShaderDescriptor& desc) :
+    Shader          { desc                                                      },
+    entryPoint_     { (desc.entryPoint != nullptr ? desc.entryPoint : "main")   },
+    vertexAttribs_  { desc.vertex.inputAttribs                                  },
+    fragmentAttribs_{ desc.fragment                                             },
+    computeAttribs_ { desc.compute                                              }
+{
+    CreateShaderModule(device, desc);
+}
+
+WebGPUShader::~WebGPUShader()
+{
+    if (shaderModule_ != nullptr)
+        wgpuShaderModuleRelease(shaderModule_);
+}
+
+void WebGPUShader::SetDebugName(const char* name)
+{
+    if (shaderModule_ != nullptr)
+        wgpuShaderModuleSetLabel(shaderModule_, name);
+}
+
+const Report* WebGPUShader::GetReport() const
+{
+    return (report_ ? &report_ : nullptr);
+}
+
+bool WebGPUShader::Reflect(ShaderReflection& reflection) const
+{
+    /* WGSL and SPIR-V are not reflected; only report the attributes from the shader descriptor */
+    if (GetSerializedReflection(reflection))
+        return true;
+
+    switch (GetType())
+    {
+        case ShaderType::Vertex:
+            reflection.vertex.inputAttribs = vertexAttribs_;
+            break;
+        case ShaderType::Fragment:
+            reflection.fragment = fragmentAttribs_;
+            break;
+        case ShaderType::Compute:
+            reflection.compute = computeAttribs_;
+            break;
+        default:
+            break;
+    }
+    return true;
+}
+
+void WebGPUShader::FillVertexBufferLayouts(
+    std::vector<WGPUVertexBufferLayout>&    outBufferLayouts,
+    std::vector<WGPUVertexAttribute>&       outAttributes) const
+{
+    /* Determine number of vertex buffer slots */
+    std::uint32_t numSlots = 0;
+    for (const VertexAttribute& attrib : vertexAttribs_)
+    {
+        if (attrib.systemValue == SystemValue::Undefined)
+            numSlots = std::max(numSlots, attrib.slot + 1);
+    }
+
+    outBufferLayouts.clear();
+    outBufferLayouts.resize(numSlots, WGPUVertexBufferLayout{ 0, WGPUVertexStepMode_VertexBufferNotUsed, 0, nullptr });
+
+    /* Sort attributes by slot, so each buffer layout refers to a contiguous range */
+    outAttributes.clear();
+    outAttributes.reserve(vertexAttribs_.size());
+
+    for_range(slot, numSlots)
+    {
+        WGPUVertexBufferLayout& bufferLayout = outBufferLayouts[slot];
+        const std::size_t firstAttrib = outAttributes.size();
+
+        for (const VertexAttribute& attrib : vertexAttribs_)
+        {
+            if (attrib.systemValue != SystemValue::Undefined || attrib.slot != slot)
+                continue;
+
+            outAttributes.push_back(
+                WGPUVertexAttribute
+                {
+                    WebGPUTypes::ToWGPUVertexFormat(attrib.format),
+                    attrib.offset,
+                    attrib.location
+                }
+            );
+
+            /* WebGPU only supports per-vertex and per-instance stepping, i.e. any instance divisor greater than 0 steps once per instance */
+            bufferLayout.arrayStride    = attrib.stride;
+            bufferLayout.stepMode       = (attrib.instanceDivisor > 0 ? WGPUVertexStepMode_Instance : WGPUVertexStepMode_Vertex);
+        }
+
+        bufferLayout.attributeCount = outAttributes.size() - firstAttrib;
+    }
+
+    /* Assign attribute pointers after the attribute list is complete, since the container might have been reallocated */
+    std::size_t attribOffset = 0;
+    for (WGPUVertexBufferLayout& bufferLayout : outBufferLayouts)
+    {
+        bufferLayout.attributes = (bufferLayout.attributeCount > 0 ? &outAttributes[attribOffset] : nullptr);
+        attribOffset += bufferLayout.attributeCount;
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool WebGPUShader::CreateShaderModule(WGPUDevice device, const ShaderDescriptor& desc)
+{
+    WGPUShaderModuleDescriptor moduleDesc = {};
+    moduleDesc.label = desc.debugName;
+
+    if (IsShaderSourceCode(desc.sourceType))
+    {
+        /* Load WGSL source code */
+        std::string sourceCode;
+        if (desc.sourceType == ShaderSourceType::CodeFile)
+            sourceCode = ReadFileString(desc.source);
+        else if (desc.sourceSize > 0)
+            sourceCode = std::string(desc.source, desc.sourceSize);
+        else
+            sourceCode = desc.source;
+
+        if (sourceCode.empty())
+        {
+            report_.Errorf("%s shader: WGSL source code is empty\n", ToString(GetType()));
+            return false;
+        }
+
+        WGPUShaderModuleWGSLDescriptor wgslDesc = {};
+        {
+            wgslDesc.chain.sType    = WGPUSType_ShaderModuleWGSLDescriptor;
+            wgslDesc.code           = sourceCode.c_str();
+        }
+        moduleDesc.nextInChain = &wgslDesc.chain;
+        shaderModule_ = wgpuDeviceCreateShaderModule(device, &moduleDesc);
+    }
+    else
+    {
+        /* Load SPIR-V binary code */
+        std::vector<char> byteCode;
+        if (desc.sourceType == ShaderSourceType::BinaryFile)
+            byteCode = ReadFileBuffer(desc.source);
+        else
+            byteCode.assign(desc.source, desc.source + desc.sourceSize);
+
+        if (byteCode.empty() || byteCode.size() % 4 != 0)
+        {
+            report_.Errorf("%s shader: SPIR-V code size is not a multiple of four bytes\n", ToString(GetType()));
+            return false;
+        }
+
+        WGPUShaderModuleSPIRVDescriptor spirvDesc = {};
+        {
+            spirvDesc.chain.sType   = WGPUSType_ShaderModuleSPIRVDescriptor;
+            spirvDesc.codeSize      = static_cast<std::uint32_t>(byteCode.size() / 4);
+            spirvDesc.code          = reinterpret_cast<const std::uint32_t*>(byteCode.data());
+        }
+        moduleDesc.nextInChain = &spirvDesc.chain;
+        shaderModule_ = wgpuDeviceCreateShaderModule(device, &moduleDesc);
+    }
+
+    /* Shader compilation errors are reported asynchronously by the device's uncaptured error callback */
+    return (shaderModule_ != nullptr);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
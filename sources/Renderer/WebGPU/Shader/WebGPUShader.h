@@ -0,0 +1,88 @@
+/*
+ * WebGPUShader.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_SHADER_H
+#define LLGL_WEBGPU_SHADER_H
+
+
+#include <LLGL/Shader.h>
+#include <LLGL/ShaderFlags.h>
+#include <LLGL/Report.h>
+#include "../WebGPU.h"
+#include <string>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+/*
+Shader module for either WGSL source code (ShaderSourceType::CodeString/CodeFile) or SPIR-V binaries (ShaderSourceType::BinaryBuffer/BinaryFile).
+SPIR-V is only accepted by native WebGPU implementations such as Dawn; browsers only accept WGSL.
+*/
+class WebGPUShader final : public Shader
+{
+
+    public:
+
+        #include <LLGL/Backend/Shader.inl>
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        WebGPUShader(WGPUDevice device, const ShaderDescriptor& desc);
+        ~WebGPUShader();
+
+        WebGPUShader(const WebGPUShader&) = delete;
+        WebGPUShader& operator = (const WebGPUShader&) = delete;
+
+        // Fills the vertex buffer layouts for this vertex shader. Attributes are grouped by their buffer slot.
+        void FillVertexBufferLayouts(
+            std::vector<WGPUVertexBufferLayout>&    outBufferLayouts,
+            std::vector<WGPUVertexAttribute>&       outAttributes
+        ) const;
+
+        // Returns the native WGPUShaderModule object.
+        inline WGPUShaderModule GetNative() const
+        {
+            return shaderModule_;
+        }
+
+        // Returns the entry point name of this shader. By default "main".
+        inline const char* GetEntryPoint() const
+        {
+            return entryPoint_.c_str();
+        }
+
+    private:
+
+        bool CreateShaderModule(WGPUDevice device, const ShaderDescriptor& desc);
+
+    private:
+
+        WGPUShaderModule                shaderModule_   = nullptr;
+        std::string                     entryPoint_;
+        Report                          report_;
+        std::vector<VertexAttribute>    vertexAttribs_;
+        FragmentShaderAttributes        fragmentAttribs_;
+        ComputeShaderAttributes         computeAttribs_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
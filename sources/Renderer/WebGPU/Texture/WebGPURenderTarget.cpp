@@ -0,0 +1,185 @@
+/*
+ * WebGPURenderTarget.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPURenderTarget.h"
+#include "WebGPUTexture.h"
+#include "../../RenderTargetUtils.h"
+#include "../../CheckedCast.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+namespace LLGL
+{
+
+
+// WebGPU only supports 1 or 4 samples per pixel
+static std::uint32_t GetWebGPURenderTargetSamples(std::uint32_t samples)
+{
+    return (samples > 1 ? 4u : 1u);
+}
+
+static RenderPassDescriptor GetWebGPUDefaultRenderPassDesc(const RenderTargetDescriptor& desc)
+{
+    RenderPassDescriptor renderPassDesc;
+    {
+        const std::uint32_t numColorAttachments = NumActiveColorAttachments(desc);
+        for_range(i, numColorAttachments)
+        {
+            renderPassDesc.colorAttachments[i].format   = GetAttachmentFormat(desc.colorAttachments[i]);
+            renderPassDesc.colorAttachments[i].loadOp   = AttachmentLoadOp::Load;
+            renderPassDesc.colorAttachments[i].storeOp  = AttachmentStoreOp::Store;
+        }
+        if (IsAttachmentEnabled(desc.depthStencilAttachment))
+        {
+            const Format format = GetAttachmentFormat(desc.depthStencilAttachment);
+            if (IsDepthFormat(format))
+            {
+                renderPassDesc.depthAttachment.format   = format;
+                renderPassDesc.depthAttachment.loadOp   = AttachmentLoadOp::Load;
+                renderPassDesc.depthAttachment.storeOp  = AttachmentStoreOp::Store;
+            }
+            if (IsStencilFormat(format))
+            {
+                renderPassDesc.stencilAttachment.format     = format;
+                renderPassDesc.stencilAttachment.loadOp     = AttachmentLoadOp::Load;
+                renderPassDesc.stencilAttachment.storeOp    = AttachmentStoreOp::Store;
+            }
+        }
+        renderPassDesc.samples = GetWebGPURenderTargetSamples(desc.samples);
+    }
+    return renderPassDesc;
+}
+
+WebGPURenderTarget::WebGPURenderTarget(WGPUDevice device, const RenderTargetDescriptor& desc) :
+    resolution_ { desc.resolution                                   },
+    samples_    { GetWebGPURenderTargetSamples(desc.samples)        },
+    renderPass_ { GetWebGPUDefaultRenderPassDesc(desc)              }
+{
+    /* Create views for color attachments */
+    const std::uint32_t numColorAttachments = NumActiveColorAttachments(desc);
+    colorViews_.resize(numColorAttachments, nullptr);
+    resolveViews_.resize(numColorAttachments, nullptr);
+
+    for_range(i, numColorAttachments)
+    {
+        const AttachmentDescriptor& colorAttachment = desc.colorAttachments[i];
+        const AttachmentDescriptor& resolveAttachment = desc.resolveAttachments[i];
+
+        if (samples_ > 1 && colorAttachment.texture != nullptr && !IsMultiSampleTexture(colorAttachment.texture->GetType()))
+        {
+            /* Render into intermediate multi-sampled attachment and resolve into the specified texture */
+            colorViews_[i]      = MakeIntermediateAttachment(device, GetAttachmentFormat(colorAttachment), BindFlags::ColorAttachment, samples_)->CreateAttachmentView(0, 0);
+            resolveViews_[i]    = CreateColorView(device, colorAttachment, 1);
+        }
+        else
+        {
+            colorViews_[i] = CreateColorView(device, colorAttachment, samples_);
+            if (IsAttachmentEnabled(resolveAttachment))
+                resolveViews_[i] = CreateColorView(device, resolveAttachment, 1);
+        }
+    }
+
+    /* Create view for depth-stencil attachment */
+    if (IsAttachmentEnabled(desc.depthStencilAttachment))
+    {
+        depthStencilFormat_ = GetAttachmentFormat(desc.depthStencilAttachment);
+        depthStencilView_   = CreateDepthStencilView(device, desc.depthStencilAttachment, samples_);
+    }
+}
+
+WebGPURenderTarget::~WebGPURenderTarget()
+{
+    for (WGPUTextureView view : colorViews_)
+        wgpuTextureViewRelease(view);
+    for (WGPUTextureView view : resolveViews_)
+    {
+        if (view != nullptr)
+            wgpuTextureViewRelease(view);
+    }
+    if (depthStencilView_ != nullptr)
+        wgpuTextureViewRelease(depthStencilView_);
+}
+
+Extent2D WebGPURenderTarget::GetResolution() const
+{
+    return resolution_;
+}
+
+std::uint32_t WebGPURenderTarget::GetSamples() const
+{
+    return samples_;
+}
+
+std::uint32_t WebGPURenderTarget::GetNumColorAttachments() const
+{
+    return static_cast<std::uint32_t>(colorViews_.size());
+}
+
+bool WebGPURenderTarget::HasDepthAttachment() const
+{
+    return IsDepthFormat(depthStencilFormat_);
+}
+
+bool WebGPURenderTarget::HasStencilAttachment() const
+{
+    return IsStencilFormat(depthStencilFormat_);
+}
+
+const RenderPass* WebGPURenderTarget::GetRenderPass() const
+{
+    return &renderPass_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+WGPUTextureView WebGPURenderTarget::CreateColorView(WGPUDevice device, const AttachmentDescriptor& attachmentDesc, std::uint32_t samples)
+{
+    if (Texture* texture = attachmentDesc.texture)
+    {
+        auto* textureWGPU = LLGL_CAST(WebGPUTexture*, texture);
+        return textureWGPU->CreateAttachmentView(attachmentDesc.mipLevel, attachmentDesc.arrayLayer);
+    }
+    return MakeIntermediateAttachment(device, attachmentDesc.format, BindFlags::ColorAttachment, samples)->CreateAttachmentView(0, 0);
+}
+
+WGPUTextureView WebGPURenderTarget::CreateDepthStencilView(WGPUDevice device, const AttachmentDescriptor& attachmentDesc, std::uint32_t samples)
+{
+    if (Texture* texture = attachmentDesc.texture)
+    {
+        auto* textureWGPU = LLGL_CAST(WebGPUTexture*, texture);
+        return textureWGPU->CreateAttachmentView(attachmentDesc.mipLevel, attachmentDesc.arrayLayer);
+    }
+    return MakeIntermediateAttachment(device, attachmentDesc.format, BindFlags::DepthStencilAttachment, samples)->CreateAttachmentView(0, 0);
+}
+
+WebGPUTexture* WebGPURenderTarget::MakeIntermediateAttachment(WGPUDevice device, const Format format, long bindFlags, std::uint32_t samples)
+{
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.type            = (samples > 1 ? TextureType::Texture2DMS : TextureType::Texture2D);
+        textureDesc.bindFlags       = bindFlags;
+        textureDesc.miscFlags       = MiscFlags::FixedSamples;
+        textureDesc.format          = format;
+        textureDesc.extent.width    = resolution_.width;
+        textureDesc.extent.height   = resolution_.height;
+        textureDesc.mipLevels       = 1;
+        textureDesc.samples         = samples;
+    }
+    intermediateAttachments_.push_back(MakeUnique<WebGPUTexture>(device, nullptr, textureDesc));
+    return intermediateAttachments_.back().get();
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
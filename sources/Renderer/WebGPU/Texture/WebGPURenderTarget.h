@@ -0,0 +1,93 @@
+/*
+ * WebGPURenderTarget.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_RENDER_TARGET_H
+#define LLGL_WEBGPU_RENDER_TARGET_H
+
+
+#include <LLGL/RenderTarget.h>
+#include <LLGL/RenderTargetFlags.h>
+#include "../RenderState/WebGPURenderPass.h"
+#include "../WebGPU.h"
+#include <memory>
+#include <vector>
+
+
+namespace LLGL
+{
+
+
+class WebGPUTexture;
+
+class WebGPURenderTarget final : public RenderTarget
+{
+
+    public:
+
+        #include <LLGL/Backend/RenderTarget.inl>
+
+    public:
+
+        WebGPURenderTarget(WGPUDevice device, const RenderTargetDescriptor& desc);
+        ~WebGPURenderTarget();
+
+        WebGPURenderTarget(const WebGPURenderTarget&) = delete;
+        WebGPURenderTarget& operator = (const WebGPURenderTarget&) = delete;
+
+        // Returns the texture view of the specified color attachment.
+        inline WGPUTextureView GetColorView(std::uint32_t index) const
+        {
+            return colorViews_[index];
+        }
+
+        // Returns the texture view the specified color attachment is resolved into or null if there is none.
+        inline WGPUTextureView GetResolveView(std::uint32_t index) const
+        {
+            return resolveViews_[index];
+        }
+
+        // Returns the texture view of the depth-stencil attachment or null if there is none.
+        inline WGPUTextureView GetDepthStencilView() const
+        {
+            return depthStencilView_;
+        }
+
+        // Returns the default render pass of this render target.
+        inline const WebGPURenderPass& GetDefaultRenderPass() const
+        {
+            return renderPass_;
+        }
+
+    private:
+
+        WGPUTextureView CreateColorView(WGPUDevice device, const AttachmentDescriptor& attachmentDesc, std::uint32_t samples);
+        WGPUTextureView CreateDepthStencilView(WGPUDevice device, const AttachmentDescriptor& attachmentDesc, std::uint32_t samples);
+
+        WebGPUTexture* MakeIntermediateAttachment(WGPUDevice device, const Format format, long bindFlags, std::uint32_t samples);
+
+    private:
+
+        Extent2D                                    resolution_;
+        std::uint32_t                               samples_            = 1;
+        Format                                      depthStencilFormat_ = Format::Undefined;
+        std::vector<WGPUTextureView>                colorViews_;
+        std::vector<WGPUTextureView>                resolveViews_;
+        WGPUTextureView                             depthStencilView_   = nullptr;
+        std::vector<std::unique_ptr<WebGPUTexture>> intermediateAttachments_;
+        WebGPURenderPass                            renderPass_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,92 @@
+/*
+ * WebGPUSampler.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUSampler.h"
+#include "../WebGPUTypes.h"
+#include "../../../Core/CoreUtils.h"
+#include <LLGL/Backend/WebGPU/NativeHandle.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+WebGPUSampler::WebGPUSampler(WGPUDevice device, const SamplerDescriptor& desc) :
+    sampler_     { WebGPUSampler::CreateWGPUSampler(device, desc)   },
+    bindingType_ { WebGPUSampler::GetWGPUSamplerBindingType(desc)   }
+{
+}
+
+WebGPUSampler::~WebGPUSampler()
+{
+    wgpuSamplerRelease(sampler_);
+}
+
+void WebGPUSampler::SetDebugName(const char* name)
+{
+    wgpuSamplerSetLabel(sampler_, name);
+}
+
+bool WebGPUSampler::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (auto* nativeHandleWGPU = GetTypedNativeHandle<WebGPU::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        nativeHandleWGPU->type      = WebGPU::ResourceNativeType::Sampler;
+        nativeHandleWGPU->sampler   = sampler_;
+        return true;
+    }
+    return false;
+}
+
+WGPUSampler WebGPUSampler::CreateWGPUSampler(WGPUDevice device, const SamplerDescriptor& desc)
+{
+    /* WebGPU has neither border colors nor a LOD bias; border addressing falls back to clamp-to-edge */
+    WGPUSamplerDescriptor samplerDesc = {};
+    {
+        samplerDesc.label           = desc.debugName;
+        samplerDesc.addressModeU    = WebGPUTypes::Map(desc.addressModeU);
+        samplerDesc.addressModeV    = WebGPUTypes::Map(desc.addressModeV);
+        samplerDesc.addressModeW    = WebGPUTypes::Map(desc.addressModeW);
+        samplerDesc.magFilter       = WebGPUTypes::Map(desc.magFilter);
+        samplerDesc.minFilter       = WebGPUTypes::Map(desc.minFilter);
+        samplerDesc.mipmapFilter    = WebGPUTypes::ToWGPUMipmapFilterMode(desc.mipMapFilter);
+        samplerDesc.lodMinClamp     = desc.minLOD;
+        samplerDesc.lodMaxClamp     = (desc.mipMapEnabled ? desc.maxLOD : desc.minLOD);
+        samplerDesc.compare         = (desc.compareEnabled ? WebGPUTypes::Map(desc.compareOp) : WGPUCompareFunction_Undefined);
+        samplerDesc.maxAnisotropy   = static_cast<std::uint16_t>(std::max(1u, std::min(16u, desc.maxAnisotropy)));
+    }
+
+    /* Anisotropic filtering requires all filters to be linear */
+    if (samplerDesc.maxAnisotropy > 1)
+    {
+        if (samplerDesc.magFilter != WGPUFilterMode_Linear ||
+            samplerDesc.minFilter != WGPUFilterMode_Linear ||
+            samplerDesc.mipmapFilter != WGPUMipmapFilterMode_Linear)
+        {
+            samplerDesc.maxAnisotropy = 1;
+        }
+    }
+
+    return wgpuDeviceCreateSampler(device, &samplerDesc);
+}
+
+WGPUSamplerBindingType WebGPUSampler::GetWGPUSamplerBindingType(const SamplerDescriptor& desc)
+{
+    if (desc.compareEnabled)
+        return WGPUSamplerBindingType_Comparison;
+    if (desc.minFilter == SamplerFilter::Nearest && desc.magFilter == SamplerFilter::Nearest && (!desc.mipMapEnabled || desc.mipMapFilter == SamplerFilter::Nearest))
+        return WGPUSamplerBindingType_NonFiltering;
+    return WGPUSamplerBindingType_Filtering;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,75 @@
+/*
+ * WebGPUSampler.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_SAMPLER_H
+#define LLGL_WEBGPU_SAMPLER_H
+
+
+#include <LLGL/Sampler.h>
+#include <LLGL/SamplerFlags.h>
+#include "../WebGPU.h"
+
+
+namespace LLGL
+{
+
+
+class WebGPUSampler final : public Sampler
+{
+
+    public:
+
+        #include <LLGL/Backend/Sampler.inl>
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        WebGPUSampler(WGPUDevice device, const SamplerDescriptor& desc);
+        ~WebGPUSampler();
+
+        WebGPUSampler(const WebGPUSampler&) = delete;
+        WebGPUSampler& operator = (const WebGPUSampler&) = delete;
+
+        // Returns the native WGPUSampler object.
+        inline WGPUSampler GetNative() const
+        {
+            return sampler_;
+        }
+
+        // Returns the binding type this sampler must be declared with in a bind group layout.
+        inline WGPUSamplerBindingType GetBindingType() const
+        {
+            return bindingType_;
+        }
+
+    public:
+
+        // Creates a native WGPUSampler object for the specified descriptor.
+        static WGPUSampler CreateWGPUSampler(WGPUDevice device, const SamplerDescriptor& desc);
+
+        // Returns the binding type for samplers with the specified descriptor.
+        static WGPUSamplerBindingType GetWGPUSamplerBindingType(const SamplerDescriptor& desc);
+
+    private:
+
+        WGPUSampler             sampler_        = nullptr;
+        WGPUSamplerBindingType  bindingType_    = WGPUSamplerBindingType_Filtering;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,224 @@
+/*
+ * WebGPUTexture.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUTexture.h"
+#include "../WebGPUTypes.h"
+#include "../../TextureUtils.h"
+#include "../../../Core/CoreUtils.h"
+#include "../../../Core/Assertion.h"
+#include "../../FormatTable.h"
+#include <LLGL/Backend/WebGPU/NativeHandle.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+namespace LLGL
+{
+
+
+static WGPUTextureUsageFlags GetWGPUTextureUsage(long bindFlags)
+{
+    /* Textures are always updated via queue writes or copy commands, so CopyDst is implied */
+    WGPUTextureUsageFlags usage = (WGPUTextureUsage_CopyDst | WGPUTextureUsage_CopySrc);
+
+    if ((bindFlags & (BindFlags::Sampled | BindFlags::CombinedSampler)) != 0)
+        usage |= WGPUTextureUsage_TextureBinding;
+    if ((bindFlags & BindFlags::Storage) != 0)
+        usage |= WGPUTextureUsage_StorageBinding;
+    if ((bindFlags & (BindFlags::ColorAttachment | BindFlags::DepthStencilAttachment)) != 0)
+        usage |= WGPUTextureUsage_RenderAttachment;
+
+    return usage;
+}
+
+WebGPUTexture::WebGPUTexture(WGPUDevice device, WGPUQueue queue, const TextureDescriptor& desc, const ImageView* initialImage) :
+    Texture     { desc.type, desc.bindFlags                                              },
+    format_     { WebGPUTypes::Map(desc.format)                                          },
+    llglFormat_ { desc.format                                                            },
+    extent_     { desc.extent                                                            },
+    arrayLayers_{ std::max(1u, desc.arrayLayers)                                         },
+    mipLevels_  { NumMipLevels(desc)                                                     },
+    samples_    { (IsMultiSampleTexture(desc.type) ? std::max(1u, desc.samples) : 1u)    },
+    miscFlags_  { desc.miscFlags                                                         }
+{
+    /* Create native texture */
+    WGPUTextureDescriptor textureDesc = {};
+    {
+        textureDesc.label           = desc.debugName;
+        textureDesc.usage           = GetWGPUTextureUsage(desc.bindFlags);
+        textureDesc.dimension       = WebGPUTypes::ToWGPUTextureDimension(desc.type);
+        textureDesc.size            = WebGPUTypes::ToWGPUExtent(desc.type, desc.extent, arrayLayers_);
+        textureDesc.format          = format_;
+        textureDesc.mipLevelCount   = mipLevels_;
+        textureDesc.sampleCount     = samples_;
+    }
+    texture_ = wgpuDeviceCreateTexture(device, &textureDesc);
+
+    /* Create default view that spans the entire resource */
+    WGPUTextureViewDescriptor viewDesc = {};
+    {
+        viewDesc.format             = format_;
+        viewDesc.dimension          = WebGPUTypes::Map(desc.type);
+        viewDesc.baseMipLevel       = 0;
+        viewDesc.mipLevelCount      = mipLevels_;
+        viewDesc.baseArrayLayer     = 0;
+        viewDesc.arrayLayerCount    = (desc.type == TextureType::Texture3D ? 1 : arrayLayers_);
+        viewDesc.aspect             = WGPUTextureAspect_All;
+    }
+    defaultView_ = wgpuTextureCreateView(texture_, &viewDesc);
+
+    /* Upload initial image to first MIP-map */
+    if (initialImage != nullptr && initialImage->data != nullptr)
+    {
+        TextureRegion region;
+        {
+            region.subresource.numArrayLayers   = arrayLayers_;
+            region.extent                       = desc.extent;
+        }
+        Write(queue, region, *initialImage);
+    }
+}
+
+WebGPUTexture::~WebGPUTexture()
+{
+    wgpuTextureViewRelease(defaultView_);
+    wgpuTextureDestroy(texture_);
+    wgpuTextureRelease(texture_);
+}
+
+void WebGPUTexture::SetDebugName(const char* name)
+{
+    wgpuTextureSetLabel(texture_, name);
+}
+
+bool WebGPUTexture::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (auto* nativeHandleWGPU = GetTypedNativeHandle<WebGPU::ResourceNativeHandle>(nativeHandle, nativeHandleSize))
+    {
+        nativeHandleWGPU->type      = WebGPU::ResourceNativeType::Texture;
+        nativeHandleWGPU->texture   = texture_;
+        return true;
+    }
+    return false;
+}
+
+TextureDescriptor WebGPUTexture::GetDesc() const
+{
+    TextureDescriptor texDesc;
+
+    texDesc.type        = GetType();
+    texDesc.bindFlags   = GetBindFlags();
+    texDesc.miscFlags   = miscFlags_;
+    texDesc.format      = GetFormat();
+    texDesc.extent      = extent_;
+    texDesc.arrayLayers = arrayLayers_;
+    texDesc.mipLevels   = mipLevels_;
+    texDesc.samples     = samples_;
+
+    return texDesc;
+}
+
+Format WebGPUTexture::GetFormat() const
+{
+    return llglFormat_;
+}
+
+Extent3D WebGPUTexture::GetMipExtent(std::uint32_t mipLevel) const
+{
+    return LLGL::GetMipExtent(GetType(), extent_, std::min(mipLevel, mipLevels_ - 1));
+}
+
+SubresourceFootprint WebGPUTexture::GetSubresourceFootprint(std::uint32_t mipLevel) const
+{
+    return CalcPackedSubresourceFootprint(GetType(), GetFormat(), extent_, mipLevel, arrayLayers_);
+}
+
+void WebGPUTexture::Write(WGPUQueue queue, const TextureRegion& textureRegion, const ImageView& srcImageView)
+{
+    const TextureSubresource&   subresource     = textureRegion.subresource;
+    const Format                format          = GetFormat();
+    const Extent3D              extent          = CalcTextureExtent(GetType(), textureRegion.extent, subresource.numArrayLayers);
+    const Offset3D              offset          = CalcTextureOffset(GetType(), textureRegion.offset, subresource.baseArrayLayer);
+    const FormatAttributes&     formatAttribs   = FormatTable::GetAttribs(format);
+    const SubresourceLayout     layout          = CalcSubresourceLayout(format, Extent3D{ extent.width, extent.height, 1 });
+
+    /* Convert image data if the source format does not match the texture format */
+    const void*         data            = srcImageView.data;
+    std::size_t         dataSize        = srcImageView.dataSize;
+    std::uint32_t       bytesPerRow     = (srcImageView.rowStride > 0 ? srcImageView.rowStride : layout.rowStride);
+    DynamicByteArray    intermediateData;
+
+    if ((formatAttribs.flags & FormatFlags::IsCompressed) == 0 &&
+        (formatAttribs.format != srcImageView.format || formatAttribs.dataType != srcImageView.dataType))
+    {
+        intermediateData = ConvertImageBuffer(srcImageView, formatAttribs.format, formatAttribs.dataType, extent, LLGL_MAX_THREAD_COUNT);
+        if (intermediateData)
+        {
+            data        = intermediateData.get();
+            dataSize    = GetMemoryFootprint(format, extent.width * extent.height * extent.depth);
+            bytesPerRow = layout.rowStride;
+        }
+    }
+
+    /* Determine number of block rows per image; compressed formats are addressed in blocks of texels */
+    const std::uint32_t blockHeight     = std::max(1u, static_cast<std::uint32_t>(formatAttribs.blockHeight));
+    const std::uint32_t rowsPerImage    = DivideRoundUp(extent.height, blockHeight);
+
+    WGPUImageCopyTexture dst = {};
+    {
+        dst.texture     = texture_;
+        dst.mipLevel    = subresource.baseMipLevel;
+        dst.origin      = WGPUOrigin3D{ static_cast<std::uint32_t>(offset.x), static_cast<std::uint32_t>(offset.y), static_cast<std::uint32_t>(offset.z) };
+        dst.aspect      = WGPUTextureAspect_All;
+    }
+    WGPUTextureDataLayout dataLayout = {};
+    {
+        dataLayout.offset       = 0;
+        dataLayout.bytesPerRow  = bytesPerRow;
+        dataLayout.rowsPerImage = (srcImageView.layerStride > 0 && bytesPerRow > 0 ? srcImageView.layerStride / bytesPerRow : rowsPerImage);
+    }
+    const WGPUExtent3D writeSize{ extent.width, extent.height, extent.depth };
+    wgpuQueueWriteTexture(queue, &dst, data, dataSize, &dataLayout, &writeSize);
+}
+
+WGPUTextureView WebGPUTexture::CreateView(const TextureViewDescriptor& textureViewDesc) const
+{
+    const TextureSubresource& subresource = textureViewDesc.subresource;
+    WGPUTextureViewDescriptor viewDesc = {};
+    {
+        viewDesc.format             = WebGPUTypes::Map(textureViewDesc.format);
+        viewDesc.dimension          = WebGPUTypes::Map(textureViewDesc.type);
+        viewDesc.baseMipLevel       = subresource.baseMipLevel;
+        viewDesc.mipLevelCount      = subresource.numMipLevels;
+        viewDesc.baseArrayLayer     = subresource.baseArrayLayer;
+        viewDesc.arrayLayerCount    = (textureViewDesc.type == TextureType::Texture3D ? 1 : std::max(1u, subresource.numArrayLayers));
+        viewDesc.aspect             = WebGPUTypes::ToWGPUTextureAspect(textureViewDesc.format);
+    }
+    return wgpuTextureCreateView(texture_, &viewDesc);
+}
+
+WGPUTextureView WebGPUTexture::CreateAttachmentView(std::uint32_t mipLevel, std::uint32_t arrayLayer) const
+{
+    WGPUTextureViewDescriptor viewDesc = {};
+    {
+        viewDesc.format             = format_;
+        viewDesc.dimension          = (GetType() == TextureType::Texture3D ? WGPUTextureViewDimension_3D : WGPUTextureViewDimension_2D);
+        viewDesc.baseMipLevel       = mipLevel;
+        viewDesc.mipLevelCount      = 1;
+        viewDesc.baseArrayLayer     = (GetType() == TextureType::Texture3D ? 0 : arrayLayer);
+        viewDesc.arrayLayerCount    = 1;
+        viewDesc.aspect             = WGPUTextureAspect_All;
+    }
+    return wgpuTextureCreateView(texture_, &viewDesc);
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,95 @@
+/*
+ * WebGPUTexture.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_TEXTURE_H
+#define LLGL_WEBGPU_TEXTURE_H
+
+
+#include <LLGL/Texture.h>
+#include <LLGL/ImageFlags.h>
+#include "../WebGPU.h"
+
+
+namespace LLGL
+{
+
+
+class WebGPUTexture final : public Texture
+{
+
+    public:
+
+        #include <LLGL/Backend/Texture.inl>
+
+    public:
+
+        void SetDebugName(const char* name) override;
+
+    public:
+
+        WebGPUTexture(WGPUDevice device, WGPUQueue queue, const TextureDescriptor& desc, const ImageView* initialImage = nullptr);
+        ~WebGPUTexture();
+
+        WebGPUTexture(const WebGPUTexture&) = delete;
+        WebGPUTexture& operator = (const WebGPUTexture&) = delete;
+
+        // Writes the specified image data into the texture region via the command queue.
+        void Write(WGPUQueue queue, const TextureRegion& textureRegion, const ImageView& srcImageView);
+
+        // Creates a new texture view for the specified texture view descriptor. The caller takes ownership of the returned view.
+        WGPUTextureView CreateView(const TextureViewDescriptor& textureViewDesc) const;
+
+        // Creates a new texture view for a single MIP-map and array layer to be used as render pass attachment.
+        WGPUTextureView CreateAttachmentView(std::uint32_t mipLevel, std::uint32_t arrayLayer) const;
+
+        // Returns the native WGPUTexture object.
+        inline WGPUTexture GetNative() const
+        {
+            return texture_;
+        }
+
+        // Returns the default texture view that spans the entire resource.
+        inline WGPUTextureView GetDefaultView() const
+        {
+            return defaultView_;
+        }
+
+        // Returns the native WebGPU texture format.
+        inline WGPUTextureFormat GetWGPUFormat() const
+        {
+            return format_;
+        }
+
+        // Returns the number of samples of this texture.
+        inline std::uint32_t GetSamples() const
+        {
+            return samples_;
+        }
+
+    private:
+
+        WGPUTexture         texture_        = nullptr;
+        WGPUTextureView     defaultView_    = nullptr;
+        WGPUTextureFormat   format_         = WGPUTextureFormat_Undefined;
+        Format              llglFormat_     = Format::Undefined;
+        Extent3D            extent_;
+        std::uint32_t       arrayLayers_    = 1;
+        std::uint32_t       mipLevels_      = 1;
+        std::uint32_t       samples_        = 1;
+        long                miscFlags_      = 0;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
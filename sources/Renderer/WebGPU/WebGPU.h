@@ -0,0 +1,27 @@
+/*
+ * WebGPU.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_H
+#define LLGL_WEBGPU_H
+
+
+#include <webgpu/webgpu.h>
+
+
+// Render pass color attachments have a depth slice field since it was added to the WebGPU headers in 2024
+#ifdef WGPU_DEPTH_SLICE_UNDEFINED
+#   define LLGL_WGPU_HAS_DEPTH_SLICE 1
+#else
+#   define LLGL_WGPU_HAS_DEPTH_SLICE 0
+#endif
+
+
+#endif
+
+
+
+// ================================================================================
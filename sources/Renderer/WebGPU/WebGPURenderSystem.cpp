@@ -0,0 +1,532 @@
+/*
+ * WebGPURenderSystem.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPURenderSystem.h"
+#include "WebGPUTypes.h"
+#include "../RenderSystemUtils.h"
+#include "../CheckedCast.h"
+#include "../../Core/CoreUtils.h"
+#include "../../Core/Exception.h"
+#include <LLGL/Backend/WebGPU/NativeHandle.h>
+#include <LLGL/Utils/ForRange.h>
+#include <emscripten/html5_webgpu.h>
+
+
+namespace LLGL
+{
+
+
+static bool IsWebGPUFormatSupported(WGPUDevice device, const Format format)
+{
+    const WGPUTextureFormat formatWGPU = WebGPUTypes::ToWGPUTextureFormat(format);
+    if (formatWGPU == WGPUTextureFormat_Undefined)
+        return false;
+
+    /* Compressed formats and 32-bit depth-stencil are optional features of the device */
+    if (formatWGPU >= WGPUTextureFormat_BC1RGBAUnorm && formatWGPU <= WGPUTextureFormat_BC7RGBAUnormSrgb)
+        return wgpuDeviceHasFeature(device, WGPUFeatureName_TextureCompressionBC);
+    if (formatWGPU >= WGPUTextureFormat_ETC2RGB8Unorm && formatWGPU <= WGPUTextureFormat_EACRG11Snorm)
+        return wgpuDeviceHasFeature(device, WGPUFeatureName_TextureCompressionETC2);
+    if (formatWGPU >= WGPUTextureFormat_ASTC4x4Unorm && formatWGPU <= WGPUTextureFormat_ASTC12x12UnormSrgb)
+        return wgpuDeviceHasFeature(device, WGPUFeatureName_TextureCompressionASTC);
+    if (formatWGPU == WGPUTextureFormat_Depth32FloatStencil8)
+        return wgpuDeviceHasFeature(device, WGPUFeatureName_Depth32FloatStencil8);
+
+    return true;
+}
+
+static void InitWebGPUTextureFormats(WGPUDevice device, std::vector<Format>& textureFormats)
+{
+    constexpr int firstFormatIndex  = static_cast<int>(Format::A8UNorm);
+    constexpr int lastFormatIndex   = static_cast<int>(Format::ASTC12x12Float);
+    for (int i = firstFormatIndex; i <= lastFormatIndex; ++i)
+    {
+        const Format format = static_cast<Format>(i);
+        if (IsWebGPUFormatSupported(device, format))
+            textureFormats.push_back(format);
+    }
+}
+
+static void InitWebGPUFeatures(WGPUDevice device, RenderingFeatures& features)
+{
+    features.hasRenderTargets               = true;
+    features.has3DTextures                  = true;
+    features.hasCubeTextures                = true;
+    features.hasArrayTextures               = true;
+    features.hasCubeArrayTextures           = true;
+    features.hasMultiSampleTextures         = true;
+    features.hasMultiSampleArrayTextures    = false;
+    features.hasTextureViews                = true;
+    features.hasTextureViewSwizzle          = false;
+    features.hasTextureViewFormatSwizzle    = false;
+    features.hasBufferViews                 = true;
+    features.hasConstantBuffers             = true;
+    features.hasStorageBuffers              = true;
+    features.hasGeometryShaders             = false;
+    features.hasTessellationShaders         = false;
+    features.hasTessellatorStage            = false;
+    features.hasComputeShaders              = true;
+    features.hasInstancing                  = true;
+    features.hasOffsetInstancing            = wgpuDeviceHasFeature(device, WGPUFeatureName_IndirectFirstInstance);
+    features.hasIndirectDrawing             = true;
+    features.hasViewportArrays              = false;
+    features.hasConservativeRasterization   = false;
+    features.hasStreamOutputs               = false;
+    features.hasLogicOp                     = false;
+    features.hasPipelineCaching             = false;
+    features.hasPipelineStatistics          = false;
+    features.hasRenderCondition             = false;
+    features.hasTimestampQueries            = wgpuDeviceHasFeature(device, WGPUFeatureName_TimestampQuery);
+    features.hasQueryResolve                = true;
+}
+
+static void InitWebGPULimits(WGPUDevice device, RenderingLimits& limits)
+{
+    WGPUSupportedLimits supportedLimits = {};
+    wgpuDeviceGetLimits(device, &supportedLimits);
+    const WGPULimits& src = supportedLimits.limits;
+
+    limits.maxTextureArrayLayers            = src.maxTextureArrayLayers;
+    limits.maxColorAttachments              = std::min<std::uint32_t>(src.maxColorAttachments, LLGL_MAX_NUM_COLOR_ATTACHMENTS);
+    limits.maxPatchVertices                 = 0;
+    limits.max1DTextureSize                 = src.maxTextureDimension1D;
+    limits.max2DTextureSize                 = src.maxTextureDimension2D;
+    limits.max3DTextureSize                 = src.maxTextureDimension3D;
+    limits.maxCubeTextureSize               = src.maxTextureDimension2D;
+    limits.maxAnisotropy                    = 16;
+    limits.maxComputeShaderWorkGroups[0]    = src.maxComputeWorkgroupsPerDimension;
+    limits.maxComputeShaderWorkGroups[1]    = src.maxComputeWorkgroupsPerDimension;
+    limits.maxComputeShaderWorkGroups[2]    = src.maxComputeWorkgroupsPerDimension;
+    limits.maxComputeShaderWorkGroupSize[0] = src.maxComputeWorkgroupSizeX;
+    limits.maxComputeShaderWorkGroupSize[1] = src.maxComputeWorkgroupSizeY;
+    limits.maxComputeShaderWorkGroupSize[2] = src.maxComputeWorkgroupSizeZ;
+    limits.maxComputeShaderSharedMemorySize = src.maxComputeWorkgroupStorageSize;
+    limits.maxViewports                     = 1;
+    limits.maxViewportSize[0]               = src.maxTextureDimension2D;
+    limits.maxViewportSize[1]               = src.maxTextureDimension2D;
+    limits.maxBufferSize                    = src.maxBufferSize;
+    limits.maxConstantBufferSize            = src.maxUniformBufferBindingSize;
+    limits.maxStreamOutputs                 = 0;
+    limits.maxTessFactor                    = 0;
+    limits.minConstantBufferAlignment       = src.minUniformBufferOffsetAlignment;
+    limits.minSampledBufferAlignment        = src.minStorageBufferOffsetAlignment;
+    limits.minStorageBufferAlignment        = src.minStorageBufferOffsetAlignment;
+    limits.maxColorBufferSamples            = 4;
+    limits.maxDepthBufferSamples            = 4;
+    limits.maxStencilBufferSamples          = 4;
+    limits.maxNoAttachmentSamples           = 4;
+}
+
+static void GetWebGPURenderingCaps(WGPUDevice device, RenderingCapabilities& caps)
+{
+    caps.screenOrigin       = ScreenOrigin::UpperLeft;
+    caps.clippingRange      = ClippingRange::ZeroToOne;
+    caps.shadingLanguages   = { ShadingLanguage::WGSL };
+    InitWebGPUTextureFormats(device, caps.textureFormats);
+    InitWebGPUFeatures(device, caps.features);
+    InitWebGPULimits(device, caps.limits);
+}
+
+static void GetWebGPURendererInfo(RendererInfo& info)
+{
+    /* Adapter information is not exposed by the pre-initialized device of the JavaScript host */
+    info.rendererName           = "WebGPU";
+    info.deviceName             = "Browser";
+    info.vendorName             = "Unknown";
+    info.shadingLanguageName    = "WGSL";
+}
+
+WebGPURenderSystem::WebGPURenderSystem(const RenderSystemDescriptor& renderSystemDesc)
+{
+    /* Use custom device or the device that was pre-initialized by the JavaScript host */
+    if (auto* customNativeHandle = GetRendererNativeHandle<WebGPU::RenderSystemNativeHandle>(renderSystemDesc))
+    {
+        device_ = customNativeHandle->device;
+        wgpuDeviceReference(device_);
+    }
+    else
+        device_ = emscripten_webgpu_get_device();
+
+    if (device_ == nullptr)
+        LLGL_TRAP("failed to get WebGPU device; Module.preinitializedWebGPUDevice must be initialized before the Wasm module is started");
+
+    queue_          = wgpuDeviceGetQueue(device_);
+    commandQueue_   = MakeUnique<WebGPUCommandQueue>(queue_);
+}
+
+WebGPURenderSystem::~WebGPURenderSystem()
+{
+    /* Release all objects before the device */
+    fences_.clear();
+    queryHeaps_.clear();
+    samplers_.clear();
+    resourceHeaps_.clear();
+    pipelineStates_.clear();
+    pipelineLayouts_.clear();
+    shaders_.clear();
+    renderTargets_.clear();
+    renderPasses_.clear();
+    textures_.clear();
+    bufferArrays_.clear();
+    buffers_.clear();
+    commandBuffers_.clear();
+    swapChains_.clear();
+    commandQueue_.reset();
+
+    wgpuQueueRelease(queue_);
+    wgpuDeviceRelease(device_);
+}
+
+/* ----- Swap-chain ----- */
+
+SwapChain* WebGPURenderSystem::CreateSwapChain(const SwapChainDescriptor& swapChainDesc, const std::shared_ptr<Surface>& surface)
+{
+    return swapChains_.emplace<WebGPUSwapChain>(device_, swapChainDesc, surface, GetRendererInfo());
+}
+
+void WebGPURenderSystem::Release(SwapChain& swapChain)
+{
+    swapChains_.erase(&swapChain);
+}
+
+/* ----- Command queues ----- */
+
+CommandQueue* WebGPURenderSystem::GetCommandQueue()
+{
+    return commandQueue_.get();
+}
+
+/* ----- Command buffers ----- */
+
+CommandBuffer* WebGPURenderSystem::CreateCommandBuffer(const CommandBufferDescriptor& commandBufferDesc)
+{
+    return commandBuffers_.emplace<WebGPUCommandBuffer>(device_, queue_, commandBufferDesc);
+}
+
+void WebGPURenderSystem::Release(CommandBuffer& commandBuffer)
+{
+    commandBuffers_.erase(&commandBuffer);
+}
+
+/* ----- Buffers ------ */
+
+Buffer* WebGPURenderSystem::CreateBuffer(const BufferDescriptor& bufferDesc, const void* initialData)
+{
+    RenderSystem::AssertCreateBuffer(bufferDesc, GetRenderingCaps().limits.maxBufferSize);
+    return buffers_.emplace<WebGPUBuffer>(device_, bufferDesc, initialData);
+}
+
+void WebGPURenderSystem::CreateBuffers(const ArrayView<BufferDescriptor>& bufferDescs, const void* const* initialData, Buffer** outBuffers)
+{
+    for_range(i, bufferDescs.size())
+        outBuffers[i] = CreateBuffer(bufferDescs[i], (initialData != nullptr ? initialData[i] : nullptr));
+}
+
+BufferArray* WebGPURenderSystem::CreateBufferArray(std::uint32_t numBuffers, Buffer* const * bufferArray)
+{
+    RenderSystem::AssertCreateBufferArray(numBuffers, bufferArray);
+    return bufferArrays_.emplace<WebGPUBufferArray>(numBuffers, bufferArray);
+}
+
+void WebGPURenderSystem::Release(Buffer& buffer)
+{
+    buffers_.erase(&buffer);
+}
+
+void WebGPURenderSystem::Release(const ArrayView<Buffer*>& buffers)
+{
+    for (Buffer* buffer : buffers)
+        Release(*buffer);
+}
+
+void WebGPURenderSystem::Release(BufferArray& bufferArray)
+{
+    bufferArrays_.erase(&bufferArray);
+}
+
+void WebGPURenderSystem::WriteBuffer(Buffer& buffer, std::uint64_t offset, const void* data, std::uint64_t dataSize)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    bufferWGPU.Write(queue_, offset, data, dataSize);
+}
+
+void WebGPURenderSystem::ReadBuffer(Buffer& /*buffer*/, std::uint64_t /*offset*/, void* /*data*/, std::uint64_t /*dataSize*/)
+{
+    /* Buffers can only be mapped asynchronously in the browser, which cannot be awaited inside a frame */
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("synchronous buffer readback in WebGPU");
+}
+
+void* WebGPURenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    return bufferWGPU.Map(access, 0, bufferWGPU.GetSize());
+}
+
+void* WebGPURenderSystem::MapBuffer(Buffer& buffer, const CPUAccess access, std::uint64_t offset, std::uint64_t length)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    return bufferWGPU.Map(access, offset, length);
+}
+
+void WebGPURenderSystem::UnmapBuffer(Buffer& buffer)
+{
+    auto& bufferWGPU = LLGL_CAST(WebGPUBuffer&, buffer);
+    bufferWGPU.Unmap(queue_);
+}
+
+/* ----- Textures ----- */
+
+Texture* WebGPURenderSystem::CreateTexture(const TextureDescriptor& textureDesc, const ImageView* initialImage)
+{
+    return textures_.emplace<WebGPUTexture>(device_, queue_, textureDesc, initialImage);
+}
+
+void WebGPURenderSystem::CreateTextures(const ArrayView<TextureDescriptor>& textureDescs, const ImageView* initialImages, Texture** outTextures)
+{
+    for_range(i, textureDescs.size())
+        outTextures[i] = CreateTexture(textureDescs[i], (initialImages != nullptr && initialImages[i].data != nullptr ? &initialImages[i] : nullptr));
+}
+
+void WebGPURenderSystem::Release(Texture& texture)
+{
+    textures_.erase(&texture);
+}
+
+void WebGPURenderSystem::Release(const ArrayView<Texture*>& textures)
+{
+    for (Texture* texture : textures)
+        Release(*texture);
+}
+
+void WebGPURenderSystem::WriteTexture(Texture& texture, const TextureRegion& textureRegion, const ImageView& srcImageView)
+{
+    auto& textureWGPU = LLGL_CAST(WebGPUTexture&, texture);
+    textureWGPU.Write(queue_, textureRegion, srcImageView);
+}
+
+void WebGPURenderSystem::ReadTexture(Texture& /*texture*/, const TextureRegion& /*textureRegion*/, const MutableImageView& /*dstImageView*/)
+{
+    LLGL_TRAP_FEATURE_NOT_SUPPORTED("synchronous texture readback in WebGPU");
+}
+
+/* ----- Sampler States ---- */
+
+Sampler* WebGPURenderSystem::CreateSampler(const SamplerDescriptor& samplerDesc)
+{
+    return samplers_.emplace<WebGPUSampler>(device_, samplerDesc);
+}
+
+void WebGPURenderSystem::Release(Sampler& sampler)
+{
+    samplers_.erase(&sampler);
+}
+
+/* ----- Resource Views ----- */
+
+ResourceHeap* WebGPURenderSystem::CreateResourceHeap(const ResourceHeapDescriptor& resourceHeapDesc, const ArrayView<ResourceViewDescriptor>& initialResourceViews)
+{
+    return resourceHeaps_.emplace<WebGPUResourceHeap>(device_, resourceHeapDesc, initialResourceViews);
+}
+
+void WebGPURenderSystem::Release(ResourceHeap& resourceHeap)
+{
+    resourceHeaps_.erase(&resourceHeap);
+}
+
+std::uint32_t WebGPURenderSystem::WriteResourceHeap(ResourceHeap& resourceHeap, std::uint32_t firstDescriptor, const ArrayView<ResourceViewDescriptor>& resourceViews)
+{
+    auto& resourceHeapWGPU = LLGL_CAST(WebGPUResourceHeap&, resourceHeap);
+    return resourceHeapWGPU.WriteResourceViews(device_, firstDescriptor, resourceViews);
+}
+
+/* ----- Render Passes ----- */
+
+RenderPass* WebGPURenderSystem::CreateRenderPass(const RenderPassDescriptor& renderPassDesc)
+{
+    return renderPasses_.emplace<WebGPURenderPass>(renderPassDesc);
+}
+
+void WebGPURenderSystem::Release(RenderPass& renderPass)
+{
+    renderPasses_.erase(&renderPass);
+}
+
+/* ----- Render Targets ----- */
+
+RenderTarget* WebGPURenderSystem::CreateRenderTarget(const RenderTargetDescriptor& renderTargetDesc)
+{
+    return renderTargets_.emplace<WebGPURenderTarget>(device_, renderTargetDesc);
+}
+
+void WebGPURenderSystem::Release(RenderTarget& renderTarget)
+{
+    renderTargets_.erase(&renderTarget);
+}
+
+/* ----- Shader ----- */
+
+Shader* WebGPURenderSystem::CreateShader(const ShaderDescriptor& shaderDesc)
+{
+    RenderSystem::AssertCreateShader(shaderDesc);
+    return shaders_.emplace<WebGPUShader>(device_, shaderDesc);
+}
+
+void WebGPURenderSystem::CreateShaders(const ArrayView<ShaderDescriptor>& shaderDescs, Shader** outShaders)
+{
+    for_range(i, shaderDescs.size())
+        outShaders[i] = CreateShader(shaderDescs[i]);
+}
+
+void WebGPURenderSystem::Release(Shader& shader)
+{
+    shaders_.erase(&shader);
+}
+
+/* ----- Pipeline Layouts ----- */
+
+PipelineLayout* WebGPURenderSystem::CreatePipelineLayout(const PipelineLayoutDescriptor& pipelineLayoutDesc)
+{
+    return pipelineLayouts_.emplace<WebGPUPipelineLayout>(device_, pipelineLayoutDesc);
+}
+
+void WebGPURenderSystem::Release(PipelineLayout& pipelineLayout)
+{
+    pipelineLayouts_.erase(&pipelineLayout);
+}
+
+/* ----- Pipeline Caches ----- */
+
+PipelineCache* WebGPURenderSystem::CreatePipelineCache(const Blob& /*initialBlob*/)
+{
+    return ProxyPipelineCache::CreateInstance(pipelineCacheProxy_);
+}
+
+void WebGPURenderSystem::Release(PipelineCache& pipelineCache)
+{
+    ProxyPipelineCache::ReleaseInstance(pipelineCacheProxy_, pipelineCache);
+}
+
+/* ----- Pipeline States ----- */
+
+PipelineState* WebGPURenderSystem::CreatePipelineState(const GraphicsPipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+{
+    return pipelineStates_.emplace<WebGPUPipelineState>(device_, pipelineStateDesc, GetDefaultRenderPass());
+}
+
+PipelineState* WebGPURenderSystem::CreatePipelineState(const ComputePipelineDescriptor& pipelineStateDesc, PipelineCache* /*pipelineCache*/)
+{
+    return pipelineStates_.emplace<WebGPUPipelineState>(device_, pipelineStateDesc);
+}
+
+void WebGPURenderSystem::CreatePipelineStates(const ArrayView<GraphicsPipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+void WebGPURenderSystem::CreatePipelineStates(const ArrayView<ComputePipelineDescriptor>& pipelineStateDescs, PipelineState** outPipelineStates, PipelineCache* pipelineCache)
+{
+    for_range(i, pipelineStateDescs.size())
+        outPipelineStates[i] = CreatePipelineState(pipelineStateDescs[i], pipelineCache);
+}
+
+PipelineState* WebGPURenderSystem::CreatePipelineState(const RayTracingPipelineDescriptor& /*pipelineStateDesc*/, PipelineCache* /*pipelineCache*/)
+{
+    /* WebGPU has no ray tracing pipelines */
+    return nullptr;
+}
+
+void WebGPURenderSystem::Release(PipelineState& pipelineState)
+{
+    pipelineStates_.erase(&pipelineState);
+}
+
+/* ----- Queries ----- */
+
+QueryHeap* WebGPURenderSystem::CreateQueryHeap(const QueryHeapDescriptor& queryHeapDesc)
+{
+    return queryHeaps_.emplace<WebGPUQueryHeap>(device_, queryHeapDesc);
+}
+
+void WebGPURenderSystem::Release(QueryHeap& queryHeap)
+{
+    queryHeaps_.erase(&queryHeap);
+}
+
+/* ----- Fences ----- */
+
+Fence* WebGPURenderSystem::CreateFence()
+{
+    return fences_.emplace<WebGPUFence>();
+}
+
+void WebGPURenderSystem::Release(Fence& fence)
+{
+    fences_.erase(&fence);
+}
+
+/* ----- Extensions ----- */
+
+bool WebGPURenderSystem::GetNativeHandle(void* nativeHandle, std::size_t nativeHandleSize)
+{
+    if (nativeHandle != nullptr && nativeHandleSize == sizeof(WebGPU::RenderSystemNativeHandle))
+    {
+        auto* nativeHandleWGPU = static_cast<WebGPU::RenderSystemNativeHandle*>(nativeHandle);
+        nativeHandleWGPU->device = device_;
+        wgpuDeviceReference(device_);
+        return true;
+    }
+    return false;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool WebGPURenderSystem::QueryRendererDetails(RendererInfo* outInfo, RenderingCapabilities* outCaps)
+{
+    if (outInfo != nullptr)
+        GetWebGPURendererInfo(*outInfo);
+    if (outCaps != nullptr)
+        GetWebGPURenderingCaps(device_, *outCaps);
+    return true;
+}
+
+std::uint32_t WebGPURenderSystem::QueryMemoryHeapInfos(MemoryHeapInfo* /*outHeapInfos*/, std::uint32_t /*maxHeapInfos*/)
+{
+    return 0; // Memory heaps are not exposed by WebGPU
+}
+
+std::uint32_t WebGPURenderSystem::QueryAdapterInfos(AdapterInfo* outAdapters, std::uint32_t maxAdapters)
+{
+    /* Report the single adapter the browser has selected for the pre-initialized device */
+    if (outAdapters != nullptr && maxAdapters > 0)
+    {
+        outAdapters[0]          = AdapterInfo{};
+        outAdapters[0].name     = "Browser";
+        outAdapters[0].isActive = true;
+    }
+    return 1;
+}
+
+const WebGPURenderPass* WebGPURenderSystem::GetDefaultRenderPass() const
+{
+    if (!swapChains_.empty())
+    {
+        if (const RenderPass* renderPass = (*swapChains_.begin())->GetRenderPass())
+            return LLGL_CAST(const WebGPURenderPass*, renderPass);
+    }
+    return nullptr;
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
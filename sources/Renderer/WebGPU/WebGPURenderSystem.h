@@ -0,0 +1,102 @@
+/*
+ * WebGPURenderSystem.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_RENDER_SYSTEM_H
+#define LLGL_WEBGPU_RENDER_SYSTEM_H
+
+
+#include <LLGL/RenderSystem.h>
+#include "WebGPUSwapChain.h"
+#include "Command/WebGPUCommandBuffer.h"
+#include "Command/WebGPUCommandQueue.h"
+#include "Buffer/WebGPUBuffer.h"
+#include "Buffer/WebGPUBufferArray.h"
+#include "RenderState/WebGPUFence.h"
+#include "RenderState/WebGPUPipelineLayout.h"
+#include "RenderState/WebGPUPipelineState.h"
+#include "RenderState/WebGPUQueryHeap.h"
+#include "RenderState/WebGPUResourceHeap.h"
+#include "RenderState/WebGPURenderPass.h"
+#include "Shader/WebGPUShader.h"
+#include "Texture/WebGPUTexture.h"
+#include "Texture/WebGPURenderTarget.h"
+#include "Texture/WebGPUSampler.h"
+#include "../ProxyPipelineCache.h"
+#include "WebGPU.h"
+
+#include "../ContainerTypes.h"
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+/*
+Render system for WebGPU in the browser (Wasm platform only).
+The WebGPU device must be created asynchronously by the JavaScript host before the Wasm module is started
+(see Module.preinitializedWebGPUDevice in Emscripten), since there is no way to wait for the adapter and device
+request callbacks inside the constructor of a render system.
+*/
+class WebGPURenderSystem final : public RenderSystem
+{
+
+    public:
+
+        #include <LLGL/Backend/RenderSystem.inl>
+
+    public:
+
+        WebGPURenderSystem(const RenderSystemDescriptor& renderSystemDesc);
+        ~WebGPURenderSystem();
+
+    private:
+
+        #include <LLGL/Backend/RenderSystem.Internal.inl>
+
+    private:
+
+        // Returns the default render pass for PSOs that don't specify one, i.e. the render pass of the first swap chain.
+        const WebGPURenderPass* GetDefaultRenderPass() const;
+
+    private:
+
+        /* ----- Common objects ----- */
+
+        WGPUDevice                                  device_         = nullptr;
+        WGPUQueue                                   queue_          = nullptr;
+
+        /* ----- Hardware object containers ----- */
+
+        HWObjectContainer<WebGPUSwapChain>          swapChains_;
+        HWObjectInstance<WebGPUCommandQueue>        commandQueue_;
+        HWObjectContainer<WebGPUCommandBuffer>      commandBuffers_;
+        HWObjectContainer<WebGPUBuffer>             buffers_;
+        HWObjectContainer<WebGPUBufferArray>        bufferArrays_;
+        HWObjectContainer<WebGPUTexture>            textures_;
+        HWObjectContainer<WebGPURenderPass>         renderPasses_;
+        HWObjectContainer<WebGPURenderTarget>       renderTargets_;
+        HWObjectContainer<WebGPUShader>             shaders_;
+        HWObjectContainer<WebGPUPipelineLayout>     pipelineLayouts_;
+        HWObjectInstance<ProxyPipelineCache>        pipelineCacheProxy_;
+        HWObjectContainer<WebGPUPipelineState>      pipelineStates_;
+        HWObjectContainer<WebGPUResourceHeap>       resourceHeaps_;
+        HWObjectContainer<WebGPUSampler>            samplers_;
+        HWObjectContainer<WebGPUQueryHeap>          queryHeaps_;
+        HWObjectContainer<WebGPUFence>              fences_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
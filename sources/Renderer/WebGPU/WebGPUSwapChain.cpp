@@ -0,0 +1,264 @@
+/*
+ * WebGPUSwapChain.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUSwapChain.h"
+#include "Texture/WebGPUTexture.h"
+#include "../../Core/CoreUtils.h"
+#include "../../Core/Exception.h"
+#include <LLGL/Format.h>
+
+
+namespace LLGL
+{
+
+
+// HTML element selector of the canvas; this must match the canvas of the Emscripten module
+static const char* g_canvasSelector = "#canvas";
+
+// The canvas is always configured with the browser's preferred format for BGRA8
+static const Format g_swapChainColorFormat = Format::BGRA8UNorm;
+
+static Format ChooseDepthStencilFormat(int depthBits, int stencilBits)
+{
+    if (depthBits == 0 && stencilBits == 0)
+        return Format::Undefined;
+    if (stencilBits != 0)
+        return Format::D24UNormS8UInt;
+    if (depthBits == 16)
+        return Format::D16UNorm;
+    return Format::D32Float;
+}
+
+// WebGPU only supports 1 or 4 samples per pixel
+static std::uint32_t GetWebGPUSwapChainSamples(std::uint32_t samples)
+{
+    return (samples > 1 ? 4u : 1u);
+}
+
+static RenderPassDescriptor GetWebGPUSwapChainRenderPassDesc(std::uint32_t samples, const Format depthStencilFormat)
+{
+    RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.colorAttachments[0].format   = g_swapChainColorFormat;
+        renderPassDesc.colorAttachments[0].loadOp   = AttachmentLoadOp::Load;
+        renderPassDesc.colorAttachments[0].storeOp  = AttachmentStoreOp::Store;
+        if (IsDepthFormat(depthStencilFormat))
+        {
+            renderPassDesc.depthAttachment.format   = depthStencilFormat;
+            renderPassDesc.depthAttachment.loadOp   = AttachmentLoadOp::Load;
+            renderPassDesc.depthAttachment.storeOp  = AttachmentStoreOp::Store;
+        }
+        if (IsStencilFormat(depthStencilFormat))
+        {
+            renderPassDesc.stencilAttachment.format     = depthStencilFormat;
+            renderPassDesc.stencilAttachment.loadOp     = AttachmentLoadOp::Load;
+            renderPassDesc.stencilAttachment.storeOp    = AttachmentStoreOp::Store;
+        }
+        renderPassDesc.samples = samples;
+    }
+    return renderPassDesc;
+}
+
+WebGPUSwapChain::WebGPUSwapChain(
+    WGPUDevice                      device,
+    const SwapChainDescriptor&      desc,
+    const std::shared_ptr<Surface>& surface,
+    const RendererInfo&             rendererInfo)
+:
+    SwapChain           { desc                                                          },
+    device_             { device                                                        },
+    samples_            { GetWebGPUSwapChainSamples(desc.samples)                       },
+    depthStencilFormat_ { ChooseDepthStencilFormat(desc.depthBits, desc.stencilBits)    },
+    renderPass_         { GetWebGPUSwapChainRenderPassDesc(samples_, depthStencilFormat_) }
+{
+    SetOrCreateSurface(surface, SwapChain::BuildDefaultSurfaceTitle(rendererInfo), desc);
+
+    /* Create surface for the HTML canvas */
+    instance_ = wgpuCreateInstance(nullptr);
+
+    WGPUSurfaceDescriptorFromCanvasHTMLSelector canvasDesc = {};
+    {
+        canvasDesc.chain.sType  = WGPUSType_SurfaceDescriptorFromCanvasHTMLSelector;
+        canvasDesc.selector     = g_canvasSelector;
+    }
+    WGPUSurfaceDescriptor surfaceDesc = {};
+    {
+        surfaceDesc.nextInChain = &(canvasDesc.chain);
+        surfaceDesc.label       = desc.debugName;
+    }
+    surface_ = wgpuInstanceCreateSurface(instance_, &surfaceDesc);
+    if (surface_ == nullptr)
+        LLGL_TRAP("failed to create WebGPU surface for canvas '%s'", g_canvasSelector);
+
+    CreateSwapChain(desc.resolution);
+    CreateAttachments(desc.resolution);
+
+    /* Show default surface */
+    if (!surface)
+        ShowSurface();
+}
+
+WebGPUSwapChain::~WebGPUSwapChain()
+{
+    ReleaseCurrentColorView();
+    ReleaseAttachments();
+    if (swapChain_ != nullptr)
+        wgpuSwapChainRelease(swapChain_);
+    wgpuSurfaceRelease(surface_);
+    wgpuInstanceRelease(instance_);
+}
+
+bool WebGPUSwapChain::IsPresentable() const
+{
+    return true;
+}
+
+void WebGPUSwapChain::Present()
+{
+    /* The browser presents the canvas itself; only release the back buffer view so the next frame acquires a new one */
+    BeginFrameStatisticsStall();
+    ReleaseCurrentColorView();
+    EndFrameStatisticsStall(true);
+}
+
+std::uint32_t WebGPUSwapChain::GetCurrentSwapIndex() const
+{
+    return 0; // Back buffers are not exposed by the browser
+}
+
+std::uint32_t WebGPUSwapChain::GetNumSwapBuffers() const
+{
+    return 1;
+}
+
+std::uint32_t WebGPUSwapChain::GetSamples() const
+{
+    return samples_;
+}
+
+Format WebGPUSwapChain::GetColorFormat() const
+{
+    return g_swapChainColorFormat;
+}
+
+Format WebGPUSwapChain::GetDepthStencilFormat() const
+{
+    return depthStencilFormat_;
+}
+
+const RenderPass* WebGPUSwapChain::GetRenderPass() const
+{
+    return &renderPass_;
+}
+
+bool WebGPUSwapChain::SetVsyncInterval(std::uint32_t vsyncInterval)
+{
+    /* Browsers always synchronize with the display refresh rate, so only FIFO presentation is supported */
+    return (vsyncInterval > 0);
+}
+
+WGPUTextureView WebGPUSwapChain::GetCurrentColorView()
+{
+    if (currentColorView_ == nullptr)
+        currentColorView_ = wgpuSwapChainGetCurrentTextureView(swapChain_);
+    return currentColorView_;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+bool WebGPUSwapChain::ResizeBuffersPrimary(const Extent2D& resolution)
+{
+    ReleaseCurrentColorView();
+    ReleaseAttachments();
+    CreateSwapChain(resolution);
+    CreateAttachments(resolution);
+    return true;
+}
+
+void WebGPUSwapChain::CreateSwapChain(const Extent2D& resolution)
+{
+    if (swapChain_ != nullptr)
+        wgpuSwapChainRelease(swapChain_);
+
+    WGPUSwapChainDescriptor swapChainDesc = {};
+    {
+        swapChainDesc.usage         = WGPUTextureUsage_RenderAttachment;
+        swapChainDesc.format        = WGPUTextureFormat_BGRA8Unorm;
+        swapChainDesc.width         = resolution.width;
+        swapChainDesc.height        = resolution.height;
+        swapChainDesc.presentMode   = presentMode_;
+    }
+    swapChain_ = wgpuDeviceCreateSwapChain(device_, surface_, &swapChainDesc);
+    if (swapChain_ == nullptr)
+        LLGL_TRAP("failed to create WebGPU swap chain");
+}
+
+void WebGPUSwapChain::CreateAttachments(const Extent2D& resolution)
+{
+    TextureDescriptor textureDesc;
+    {
+        textureDesc.type            = (samples_ > 1 ? TextureType::Texture2DMS : TextureType::Texture2D);
+        textureDesc.miscFlags       = MiscFlags::FixedSamples;
+        textureDesc.extent.width    = resolution.width;
+        textureDesc.extent.height   = resolution.height;
+        textureDesc.mipLevels       = 1;
+        textureDesc.samples         = samples_;
+    }
+
+    /* Canvas textures cannot be multi-sampled, so render into an intermediate texture that is resolved into the back buffer */
+    if (samples_ > 1)
+    {
+        textureDesc.bindFlags   = BindFlags::ColorAttachment;
+        textureDesc.format      = g_swapChainColorFormat;
+        colorBufferMS_  = MakeUnique<WebGPUTexture>(device_, nullptr, textureDesc);
+        colorViewMS_    = colorBufferMS_->CreateAttachmentView(0, 0);
+    }
+
+    if (depthStencilFormat_ != Format::Undefined)
+    {
+        textureDesc.bindFlags   = BindFlags::DepthStencilAttachment;
+        textureDesc.format      = depthStencilFormat_;
+        depthStencilBuffer_ = MakeUnique<WebGPUTexture>(device_, nullptr, textureDesc);
+        depthStencilView_   = depthStencilBuffer_->CreateAttachmentView(0, 0);
+    }
+}
+
+void WebGPUSwapChain::ReleaseAttachments()
+{
+    if (colorViewMS_ != nullptr)
+    {
+        wgpuTextureViewRelease(colorViewMS_);
+        colorViewMS_ = nullptr;
+    }
+    colorBufferMS_.reset();
+
+    if (depthStencilView_ != nullptr)
+    {
+        wgpuTextureViewRelease(depthStencilView_);
+        depthStencilView_ = nullptr;
+    }
+    depthStencilBuffer_.reset();
+}
+
+void WebGPUSwapChain::ReleaseCurrentColorView()
+{
+    if (currentColorView_ != nullptr)
+    {
+        wgpuTextureViewRelease(currentColorView_);
+        currentColorView_ = nullptr;
+    }
+}
+
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,106 @@
+/*
+ * WebGPUSwapChain.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_SWAP_CHAIN_H
+#define LLGL_WEBGPU_SWAP_CHAIN_H
+
+
+#include <LLGL/SwapChain.h>
+#include "RenderState/WebGPURenderPass.h"
+#include "WebGPU.h"
+#include <memory>
+
+
+namespace LLGL
+{
+
+
+class WebGPUTexture;
+
+/*
+Swap chain for the HTML canvas of the Emscripten module.
+The browser presents the canvas implicitly once control returns to the event loop, so Present() only releases the current back buffer view.
+*/
+class WebGPUSwapChain final : public SwapChain
+{
+
+    public:
+
+        #include <LLGL/Backend/SwapChain.inl>
+
+    public:
+
+        WebGPUSwapChain(
+            WGPUDevice                      device,
+            const SwapChainDescriptor&      desc,
+            const std::shared_ptr<Surface>& surface,
+            const RendererInfo&             rendererInfo
+        );
+        ~WebGPUSwapChain();
+
+        WebGPUSwapChain(const WebGPUSwapChain&) = delete;
+        WebGPUSwapChain& operator = (const WebGPUSwapChain&) = delete;
+
+        // Returns the color attachment view for the current back buffer. This view is valid until the next call to Present().
+        WGPUTextureView GetCurrentColorView();
+
+        // Returns the multi-sampled color attachment view or null if the swap chain has only one sample.
+        inline WGPUTextureView GetMultiSampledColorView() const
+        {
+            return colorViewMS_;
+        }
+
+        // Returns the depth-stencil attachment view or null if the swap chain has no depth-stencil buffer.
+        inline WGPUTextureView GetDepthStencilView() const
+        {
+            return depthStencilView_;
+        }
+
+        // Returns the default render pass of this swap chain.
+        inline const WebGPURenderPass& GetDefaultRenderPass() const
+        {
+            return renderPass_;
+        }
+
+    private:
+
+        bool ResizeBuffersPrimary(const Extent2D& resolution) override;
+
+        void CreateSwapChain(const Extent2D& resolution);
+        void CreateAttachments(const Extent2D& resolution);
+        void ReleaseAttachments();
+        void ReleaseCurrentColorView();
+
+    private:
+
+        WGPUDevice                      device_             = nullptr;
+        WGPUInstance                    instance_           = nullptr;
+        WGPUSurface                     surface_            = nullptr;
+        WGPUSwapChain                   swapChain_          = nullptr;
+        WGPUTextureView                 currentColorView_   = nullptr;
+        std::uint32_t                   samples_            = 1;
+        Format                          depthStencilFormat_ = Format::Undefined;
+        WGPUPresentMode                 presentMode_        = WGPUPresentMode_Fifo;
+
+        std::unique_ptr<WebGPUTexture>  colorBufferMS_;
+        WGPUTextureView                 colorViewMS_        = nullptr;
+        std::unique_ptr<WebGPUTexture>  depthStencilBuffer_;
+        WGPUTextureView                 depthStencilView_   = nullptr;
+
+        WebGPURenderPass                renderPass_;
+
+};
+
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
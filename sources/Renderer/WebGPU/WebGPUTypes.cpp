@@ -0,0 +1,470 @@
+/*
+ * WebGPUTypes.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "WebGPUTypes.h"
+#include "../../Core/Assertion.h"
+
+
+namespace LLGL
+{
+
+namespace WebGPUTypes
+{
+
+
+/* ----- Map functions ----- */
+
+[[noreturn]]
+void MapFailed(const char* typeName, const char* wgpuTypeName)
+{
+    LLGL_TRAP("failed to map <LLGL::%s> to <%s> WebGPU parameter", typeName, wgpuTypeName);
+}
+
+WGPUTextureFormat Map(const Format format)
+{
+    const WGPUTextureFormat formatWGPU = ToWGPUTextureFormat(format);
+    if (formatWGPU == WGPUTextureFormat_Undefined && format != Format::Undefined)
+        MapFailed("Format", "WGPUTextureFormat");
+    return formatWGPU;
+}
+
+WGPUTextureViewDimension Map(const TextureType textureType)
+{
+    switch (textureType)
+    {
+        case TextureType::Texture1D:        return WGPUTextureViewDimension_1D;
+        case TextureType::Texture2D:        return WGPUTextureViewDimension_2D;
+        case TextureType::Texture3D:        return WGPUTextureViewDimension_3D;
+        case TextureType::TextureCube:      return WGPUTextureViewDimension_Cube;
+        case TextureType::Texture1DArray:   return WGPUTextureViewDimension_2DArray; // 1D arrays are emulated with 2D arrays of height 1
+        case TextureType::Texture2DArray:   return WGPUTextureViewDimension_2DArray;
+        case TextureType::TextureCubeArray: return WGPUTextureViewDimension_CubeArray;
+        case TextureType::Texture2DMS:      return WGPUTextureViewDimension_2D;
+        case TextureType::Texture2DMSArray: return WGPUTextureViewDimension_2DArray;
+    }
+    MapFailed("TextureType", "WGPUTextureViewDimension");
+}
+
+WGPUPrimitiveTopology Map(const PrimitiveTopology primitiveTopology)
+{
+    switch (primitiveTopology)
+    {
+        case PrimitiveTopology::PointList:      return WGPUPrimitiveTopology_PointList;
+        case PrimitiveTopology::LineList:       return WGPUPrimitiveTopology_LineList;
+        case PrimitiveTopology::LineStrip:      return WGPUPrimitiveTopology_LineStrip;
+        case PrimitiveTopology::TriangleList:   return WGPUPrimitiveTopology_TriangleList;
+        case PrimitiveTopology::TriangleStrip:  return WGPUPrimitiveTopology_TriangleStrip;
+        default:                                break;
+    }
+    MapFailed("PrimitiveTopology", "WGPUPrimitiveTopology");
+}
+
+WGPUCullMode Map(const CullMode cullMode)
+{
+    switch (cullMode)
+    {
+        case CullMode::Disabled:    return WGPUCullMode_None;
+        case CullMode::Front:       return WGPUCullMode_Front;
+        case CullMode::Back:        return WGPUCullMode_Back;
+    }
+    MapFailed("CullMode", "WGPUCullMode");
+}
+
+WGPUCompareFunction Map(const CompareOp compareOp)
+{
+    switch (compareOp)
+    {
+        case CompareOp::NeverPass:      return WGPUCompareFunction_Never;
+        case CompareOp::Less:           return WGPUCompareFunction_Less;
+        case CompareOp::Equal:          return WGPUCompareFunction_Equal;
+        case CompareOp::LessEqual:      return WGPUCompareFunction_LessEqual;
+        case CompareOp::Greater:        return WGPUCompareFunction_Greater;
+        case CompareOp::NotEqual:       return WGPUCompareFunction_NotEqual;
+        case CompareOp::GreaterEqual:   return WGPUCompareFunction_GreaterEqual;
+        case CompareOp::AlwaysPass:     return WGPUCompareFunction_Always;
+    }
+    MapFailed("CompareOp", "WGPUCompareFunction");
+}
+
+WGPUStencilOperation Map(const StencilOp stencilOp)
+{
+    switch (stencilOp)
+    {
+        case StencilOp::Keep:       return WGPUStencilOperation_Keep;
+        case StencilOp::Zero:       return WGPUStencilOperation_Zero;
+        case StencilOp::Replace:    return WGPUStencilOperation_Replace;
+        case StencilOp::IncClamp:   return WGPUStencilOperation_IncrementClamp;
+        case StencilOp::DecClamp:   return WGPUStencilOperation_DecrementClamp;
+        case StencilOp::Invert:     return WGPUStencilOperation_Invert;
+        case StencilOp::IncWrap:    return WGPUStencilOperation_IncrementWrap;
+        case StencilOp::DecWrap:    return WGPUStencilOperation_DecrementWrap;
+    }
+    MapFailed("StencilOp", "WGPUStencilOperation");
+}
+
+WGPUBlendFactor Map(const BlendOp blendOp)
+{
+    switch (blendOp)
+    {
+        case BlendOp::Zero:             return WGPUBlendFactor_Zero;
+        case BlendOp::One:              return WGPUBlendFactor_One;
+        case BlendOp::SrcColor:         return WGPUBlendFactor_Src;
+        case BlendOp::InvSrcColor:      return WGPUBlendFactor_OneMinusSrc;
+        case BlendOp::SrcAlpha:         return WGPUBlendFactor_SrcAlpha;
+        case BlendOp::InvSrcAlpha:      return WGPUBlendFactor_OneMinusSrcAlpha;
+        case BlendOp::DstColor:         return WGPUBlendFactor_Dst;
+        case BlendOp::InvDstColor:      return WGPUBlendFactor_OneMinusDst;
+        case BlendOp::DstAlpha:         return WGPUBlendFactor_DstAlpha;
+        case BlendOp::InvDstAlpha:      return WGPUBlendFactor_OneMinusDstAlpha;
+        case BlendOp::SrcAlphaSaturate: return WGPUBlendFactor_SrcAlphaSaturated;
+        case BlendOp::BlendFactor:      return WGPUBlendFactor_Constant;
+        case BlendOp::InvBlendFactor:   return WGPUBlendFactor_OneMinusConstant;
+        default:                        break; // Dual-source blending is not supported in WebGPU core
+    }
+    MapFailed("BlendOp", "WGPUBlendFactor");
+}
+
+WGPUBlendOperation Map(const BlendArithmetic blendArithmetic)
+{
+    switch (blendArithmetic)
+    {
+        case BlendArithmetic::Add:          return WGPUBlendOperation_Add;
+        case BlendArithmetic::Subtract:     return WGPUBlendOperation_Subtract;
+        case BlendArithmetic::RevSubtract:  return WGPUBlendOperation_ReverseSubtract;
+        case BlendArithmetic::Min:          return WGPUBlendOperation_Min;
+        case BlendArithmetic::Max:          return WGPUBlendOperation_Max;
+    }
+    MapFailed("BlendArithmetic", "WGPUBlendOperation");
+}
+
+WGPUAddressMode Map(const SamplerAddressMode addressMode)
+{
+    switch (addressMode)
+    {
+        case SamplerAddressMode::Repeat:    return WGPUAddressMode_Repeat;
+        case SamplerAddressMode::Mirror:    return WGPUAddressMode_MirrorRepeat;
+        case SamplerAddressMode::Clamp:     return WGPUAddressMode_ClampToEdge;
+        case SamplerAddressMode::Border:    return WGPUAddressMode_ClampToEdge; // Border colors are not supported in WebGPU
+        default:                            break;
+    }
+    MapFailed("SamplerAddressMode", "WGPUAddressMode");
+}
+
+WGPUFilterMode Map(const SamplerFilter filter)
+{
+    switch (filter)
+    {
+        case SamplerFilter::Nearest:    return WGPUFilterMode_Nearest;
+        case SamplerFilter::Linear:     return WGPUFilterMode_Linear;
+    }
+    MapFailed("SamplerFilter", "WGPUFilterMode");
+}
+
+WGPUQueryType Map(const QueryType queryType)
+{
+    switch (queryType)
+    {
+        case QueryType::SamplesPassed:                  return WGPUQueryType_Occlusion;
+        case QueryType::AnySamplesPassed:               return WGPUQueryType_Occlusion;
+        case QueryType::AnySamplesPassedConservative:   return WGPUQueryType_Occlusion;
+        case QueryType::TimeElapsed:                    return WGPUQueryType_Timestamp;
+        default:                                        break;
+    }
+    MapFailed("QueryType", "WGPUQueryType");
+}
+
+WGPULoadOp Map(const AttachmentLoadOp loadOp)
+{
+    switch (loadOp)
+    {
+        case AttachmentLoadOp::Undefined:   return WGPULoadOp_Clear; // WebGPU has no "don't care" load operation; clearing is cheapest on tile-based GPUs
+        case AttachmentLoadOp::Load:        return WGPULoadOp_Load;
+        case AttachmentLoadOp::Clear:       return WGPULoadOp_Clear;
+    }
+    MapFailed("AttachmentLoadOp", "WGPULoadOp");
+}
+
+WGPUStoreOp Map(const AttachmentStoreOp storeOp)
+{
+    switch (storeOp)
+    {
+        case AttachmentStoreOp::Undefined:  return WGPUStoreOp_Discard;
+        case AttachmentStoreOp::Store:      return WGPUStoreOp_Store;
+    }
+    MapFailed("AttachmentStoreOp", "WGPUStoreOp");
+}
+
+Format Unmap(const WGPUTextureFormat format)
+{
+    switch (format)
+    {
+        case WGPUTextureFormat_RGBA8Unorm:              return Format::RGBA8UNorm;
+        case WGPUTextureFormat_RGBA8UnormSrgb:          return Format::RGBA8UNorm_sRGB;
+        case WGPUTextureFormat_BGRA8Unorm:              return Format::BGRA8UNorm;
+        case WGPUTextureFormat_BGRA8UnormSrgb:          return Format::BGRA8UNorm_sRGB;
+        case WGPUTextureFormat_RGBA16Float:             return Format::RGBA16Float;
+        case WGPUTextureFormat_RGB10A2Unorm:            return Format::RGB10A2UNorm;
+        case WGPUTextureFormat_Depth16Unorm:            return Format::D16UNorm;
+        case WGPUTextureFormat_Depth24PlusStencil8:     return Format::D24UNormS8UInt;
+        case WGPUTextureFormat_Depth32Float:            return Format::D32Float;
+        case WGPUTextureFormat_Depth32FloatStencil8:    return Format::D32FloatS8X24UInt;
+        default:                                        return Format::Undefined;
+    }
+}
+
+WGPUTextureFormat ToWGPUTextureFormat(const Format format)
+{
+    switch (format)
+    {
+        /* --- Red channel color formats --- */
+        case Format::R8UNorm:           return WGPUTextureFormat_R8Unorm;
+        case Format::R8SNorm:           return WGPUTextureFormat_R8Snorm;
+        case Format::R8UInt:            return WGPUTextureFormat_R8Uint;
+        case Format::R8SInt:            return WGPUTextureFormat_R8Sint;
+        case Format::R16UInt:           return WGPUTextureFormat_R16Uint;
+        case Format::R16SInt:           return WGPUTextureFormat_R16Sint;
+        case Format::R16Float:          return WGPUTextureFormat_R16Float;
+        case Format::R32UInt:           return WGPUTextureFormat_R32Uint;
+        case Format::R32SInt:           return WGPUTextureFormat_R32Sint;
+        case Format::R32Float:          return WGPUTextureFormat_R32Float;
+
+        /* --- RG color formats --- */
+        case Format::RG8UNorm:          return WGPUTextureFormat_RG8Unorm;
+        case Format::RG8SNorm:          return WGPUTextureFormat_RG8Snorm;
+        case Format::RG8UInt:           return WGPUTextureFormat_RG8Uint;
+        case Format::RG8SInt:           return WGPUTextureFormat_RG8Sint;
+        case Format::RG16UInt:          return WGPUTextureFormat_RG16Uint;
+        case Format::RG16SInt:          return WGPUTextureFormat_RG16Sint;
+        case Format::RG16Float:         return WGPUTextureFormat_RG16Float;
+        case Format::RG32UInt:          return WGPUTextureFormat_RG32Uint;
+        case Format::RG32SInt:          return WGPUTextureFormat_RG32Sint;
+        case Format::RG32Float:         return WGPUTextureFormat_RG32Float;
+
+        /* --- RGBA color formats --- */
+        case Format::RGBA8UNorm:        return WGPUTextureFormat_RGBA8Unorm;
+        case Format::RGBA8UNorm_sRGB:   return WGPUTextureFormat_RGBA8UnormSrgb;
+        case Format::RGBA8SNorm:        return WGPUTextureFormat_RGBA8Snorm;
+        case Format::RGBA8UInt:         return WGPUTextureFormat_RGBA8Uint;
+        case Format::RGBA8SInt:         return WGPUTextureFormat_RGBA8Sint;
+        case Format::RGBA16UInt:        return WGPUTextureFormat_RGBA16Uint;
+        case Format::RGBA16SInt:        return WGPUTextureFormat_RGBA16Sint;
+        case Format::RGBA16Float:       return WGPUTextureFormat_RGBA16Float;
+        case Format::RGBA32UInt:        return WGPUTextureFormat_RGBA32Uint;
+        case Format::RGBA32SInt:        return WGPUTextureFormat_RGBA32Sint;
+        case Format::RGBA32Float:       return WGPUTextureFormat_RGBA32Float;
+
+        /* --- BGRA color formats --- */
+        case Format::BGRA8UNorm:        return WGPUTextureFormat_BGRA8Unorm;
+        case Format::BGRA8UNorm_sRGB:   return WGPUTextureFormat_BGRA8UnormSrgb;
+
+        /* --- Packed formats --- */
+        case Format::RGB10A2UNorm:      return WGPUTextureFormat_RGB10A2Unorm;
+        case Format::RGB10A2UInt:       return WGPUTextureFormat_RGB10A2Uint;
+        case Format::RG11B10Float:      return WGPUTextureFormat_RG11B10Ufloat;
+        case Format::RGB9E5Float:       return WGPUTextureFormat_RGB9E5Ufloat;
+
+        /* --- Depth-stencil formats --- */
+        case Format::D16UNorm:          return WGPUTextureFormat_Depth16Unorm;
+        case Format::D24UNormS8UInt:    return WGPUTextureFormat_Depth24PlusStencil8;
+        case Format::D32Float:          return WGPUTextureFormat_Depth32Float;
+        case Format::D32FloatS8X24UInt: return WGPUTextureFormat_Depth32FloatStencil8;
+
+        /* --- Block compression (BC) formats --- */
+        case Format::BC1UNorm:          return WGPUTextureFormat_BC1RGBAUnorm;
+        case Format::BC1UNorm_sRGB:     return WGPUTextureFormat_BC1RGBAUnormSrgb;
+        case Format::BC2UNorm:          return WGPUTextureFormat_BC2RGBAUnorm;
+        case Format::BC2UNorm_sRGB:     return WGPUTextureFormat_BC2RGBAUnormSrgb;
+        case Format::BC3UNorm:          return WGPUTextureFormat_BC3RGBAUnorm;
+        case Format::BC3UNorm_sRGB:     return WGPUTextureFormat_BC3RGBAUnormSrgb;
+        case Format::BC4UNorm:          return WGPUTextureFormat_BC4RUnorm;
+        case Format::BC4SNorm:          return WGPUTextureFormat_BC4RSnorm;
+        case Format::BC5UNorm:          return WGPUTextureFormat_BC5RGUnorm;
+        case Format::BC5SNorm:          return WGPUTextureFormat_BC5RGSnorm;
+        case Format::BC6HUFloat:        return WGPUTextureFormat_BC6HRGBUfloat;
+        case Format::BC6HSFloat:        return WGPUTextureFormat_BC6HRGBFloat;
+        case Format::BC7UNorm:          return WGPUTextureFormat_BC7RGBAUnorm;
+        case Format::BC7UNorm_sRGB:     return WGPUTextureFormat_BC7RGBAUnormSrgb;
+
+        /* --- Adaptive scalable texture compression (ASTC) formats --- */
+        case Format::ASTC4x4:           return WGPUTextureFormat_ASTC4x4Unorm;
+        case Format::ASTC4x4_sRGB:      return WGPUTextureFormat_ASTC4x4UnormSrgb;
+        case Format::ASTC5x4:           return WGPUTextureFormat_ASTC5x4Unorm;
+        case Format::ASTC5x4_sRGB:      return WGPUTextureFormat_ASTC5x4UnormSrgb;
+        case Format::ASTC5x5:           return WGPUTextureFormat_ASTC5x5Unorm;
+        case Format::ASTC5x5_sRGB:      return WGPUTextureFormat_ASTC5x5UnormSrgb;
+        case Format::ASTC6x5:           return WGPUTextureFormat_ASTC6x5Unorm;
+        case Format::ASTC6x5_sRGB:      return WGPUTextureFormat_ASTC6x5UnormSrgb;
+        case Format::ASTC6x6:           return WGPUTextureFormat_ASTC6x6Unorm;
+        case Format::ASTC6x6_sRGB:      return WGPUTextureFormat_ASTC6x6UnormSrgb;
+        case Format::ASTC8x5:           return WGPUTextureFormat_ASTC8x5Unorm;
+        case Format::ASTC8x5_sRGB:      return WGPUTextureFormat_ASTC8x5UnormSrgb;
+        case Format::ASTC8x6:           return WGPUTextureFormat_ASTC8x6Unorm;
+        case Format::ASTC8x6_sRGB:      return WGPUTextureFormat_ASTC8x6UnormSrgb;
+        case Format::ASTC8x8:           return WGPUTextureFormat_ASTC8x8Unorm;
+        case Format::ASTC8x8_sRGB:      return WGPUTextureFormat_ASTC8x8UnormSrgb;
+        case Format::ASTC10x5:          return WGPUTextureFormat_ASTC10x5Unorm;
+        case Format::ASTC10x5_sRGB:     return WGPUTextureFormat_ASTC10x5UnormSrgb;
+        case Format::ASTC10x6:          return WGPUTextureFormat_ASTC10x6Unorm;
+        case Format::ASTC10x6_sRGB:     return WGPUTextureFormat_ASTC10x6UnormSrgb;
+        case Format::ASTC10x8:          return WGPUTextureFormat_ASTC10x8Unorm;
+        case Format::ASTC10x8_sRGB:     return WGPUTextureFormat_ASTC10x8UnormSrgb;
+        case Format::ASTC10x10:         return WGPUTextureFormat_ASTC10x10Unorm;
+        case Format::ASTC10x10_sRGB:    return WGPUTextureFormat_ASTC10x10UnormSrgb;
+        case Format::ASTC12x10:         return WGPUTextureFormat_ASTC12x10Unorm;
+        case Format::ASTC12x10_sRGB:    return WGPUTextureFormat_ASTC12x10UnormSrgb;
+        case Format::ASTC12x12:         return WGPUTextureFormat_ASTC12x12Unorm;
+        case Format::ASTC12x12_sRGB:    return WGPUTextureFormat_ASTC12x12UnormSrgb;
+
+        /* --- Ericsson texture compression (ETC) formats --- */
+        case Format::ETC2UNorm:         return WGPUTextureFormat_ETC2RGB8Unorm;
+        case Format::ETC2UNorm_sRGB:    return WGPUTextureFormat_ETC2RGB8UnormSrgb;
+        case Format::ETC2A1UNorm:       return WGPUTextureFormat_ETC2RGB8A1Unorm;
+        case Format::ETC2A1UNorm_sRGB:  return WGPUTextureFormat_ETC2RGB8A1UnormSrgb;
+        case Format::ETC2A8UNorm:       return WGPUTextureFormat_ETC2RGBA8Unorm;
+        case Format::ETC2A8UNorm_sRGB:  return WGPUTextureFormat_ETC2RGBA8UnormSrgb;
+        case Format::EACR11UNorm:       return WGPUTextureFormat_EACR11Unorm;
+        case Format::EACR11SNorm:       return WGPUTextureFormat_EACR11Snorm;
+        case Format::EACRG11UNorm:      return WGPUTextureFormat_EACRG11Unorm;
+        case Format::EACRG11SNorm:      return WGPUTextureFormat_EACRG11Snorm;
+
+        default:                        return WGPUTextureFormat_Undefined;
+    }
+}
+
+WGPUVertexFormat ToWGPUVertexFormat(const Format format)
+{
+    switch (format)
+    {
+        case Format::RG8UInt:       return WGPUVertexFormat_Uint8x2;
+        case Format::RGBA8UInt:     return WGPUVertexFormat_Uint8x4;
+        case Format::RG8SInt:       return WGPUVertexFormat_Sint8x2;
+        case Format::RGBA8SInt:     return WGPUVertexFormat_Sint8x4;
+        case Format::RG8UNorm:      return WGPUVertexFormat_Unorm8x2;
+        case Format::RGBA8UNorm:    return WGPUVertexFormat_Unorm8x4;
+        case Format::RG8SNorm:      return WGPUVertexFormat_Snorm8x2;
+        case Format::RGBA8SNorm:    return WGPUVertexFormat_Snorm8x4;
+        case Format::RG16UInt:      return WGPUVertexFormat_Uint16x2;
+        case Format::RGBA16UInt:    return WGPUVertexFormat_Uint16x4;
+        case Format::RG16SInt:      return WGPUVertexFormat_Sint16x2;
+        case Format::RGBA16SInt:    return WGPUVertexFormat_Sint16x4;
+        case Format::RG16UNorm:     return WGPUVertexFormat_Unorm16x2;
+        case Format::RGBA16UNorm:   return WGPUVertexFormat_Unorm16x4;
+        case Format::RG16SNorm:     return WGPUVertexFormat_Snorm16x2;
+        case Format::RGBA16SNorm:   return WGPUVertexFormat_Snorm16x4;
+        case Format::RG16Float:     return WGPUVertexFormat_Float16x2;
+        case Format::RGBA16Float:   return WGPUVertexFormat_Float16x4;
+        case Format::R32Float:      return WGPUVertexFormat_Float32;
+        case Format::RG32Float:     return WGPUVertexFormat_Float32x2;
+        case Format::RGB32Float:    return WGPUVertexFormat_Float32x3;
+        case Format::RGBA32Float:   return WGPUVertexFormat_Float32x4;
+        case Format::R32UInt:       return WGPUVertexFormat_Uint32;
+        case Format::RG32UInt:      return WGPUVertexFormat_Uint32x2;
+        case Format::RGB32UInt:     return WGPUVertexFormat_Uint32x3;
+        case Format::RGBA32UInt:    return WGPUVertexFormat_Uint32x4;
+        case Format::R32SInt:       return WGPUVertexFormat_Sint32;
+        case Format::RG32SInt:      return WGPUVertexFormat_Sint32x2;
+        case Format::RGB32SInt:     return WGPUVertexFormat_Sint32x3;
+        case Format::RGBA32SInt:    return WGPUVertexFormat_Sint32x4;
+        default:                    return WGPUVertexFormat_Undefined;
+    }
+}
+
+WGPUTextureDimension ToWGPUTextureDimension(const TextureType textureType)
+{
+    switch (textureType)
+    {
+        case TextureType::Texture1D:    return WGPUTextureDimension_1D;
+        case TextureType::Texture3D:    return WGPUTextureDimension_3D;
+        default:                        return WGPUTextureDimension_2D; // Also used for 1D arrays since WebGPU has no 1D array textures
+    }
+}
+
+WGPUIndexFormat ToWGPUIndexFormat(const Format format)
+{
+    switch (format)
+    {
+        case Format::R16UInt:   return WGPUIndexFormat_Uint16;
+        case Format::R32UInt:   return WGPUIndexFormat_Uint32;
+        default:                return WGPUIndexFormat_Undefined;
+    }
+}
+
+WGPUMipmapFilterMode ToWGPUMipmapFilterMode(const SamplerFilter filter)
+{
+    return (filter == SamplerFilter::Linear ? WGPUMipmapFilterMode_Linear : WGPUMipmapFilterMode_Nearest);
+}
+
+WGPUShaderStageFlags ToWGPUShaderStageFlags(long stageFlags)
+{
+    WGPUShaderStageFlags bitmask = WGPUShaderStage_None;
+    if ((stageFlags & StageFlags::VertexStage) != 0)
+        bitmask |= WGPUShaderStage_Vertex;
+    if ((stageFlags & StageFlags::FragmentStage) != 0)
+        bitmask |= WGPUShaderStage_Fragment;
+    if ((stageFlags & StageFlags::ComputeStage) != 0)
+        bitmask |= WGPUShaderStage_Compute;
+    return bitmask;
+}
+
+WGPUColorWriteMaskFlags ToWGPUColorWriteMask(std::uint8_t colorMask)
+{
+    WGPUColorWriteMaskFlags bitmask = WGPUColorWriteMask_None;
+    if ((colorMask & ColorMaskFlags::R) != 0)
+        bitmask |= WGPUColorWriteMask_Red;
+    if ((colorMask & ColorMaskFlags::G) != 0)
+        bitmask |= WGPUColorWriteMask_Green;
+    if ((colorMask & ColorMaskFlags::B) != 0)
+        bitmask |= WGPUColorWriteMask_Blue;
+    if ((colorMask & ColorMaskFlags::A) != 0)
+        bitmask |= WGPUColorWriteMask_Alpha;
+    return bitmask;
+}
+
+WGPUTextureAspect ToWGPUTextureAspect(const Format format)
+{
+    /* Texture copies of depth-stencil formats must select a single aspect */
+    if (IsDepthFormat(format))
+        return WGPUTextureAspect_DepthOnly;
+    if (IsStencilFormat(format))
+        return WGPUTextureAspect_StencilOnly;
+    return WGPUTextureAspect_All;
+}
+
+WGPUExtent3D ToWGPUExtent(const TextureType textureType, const Extent3D& extent, std::uint32_t arrayLayers)
+{
+    switch (textureType)
+    {
+        case TextureType::Texture1D:        return WGPUExtent3D{ extent.width, 1u, 1u };
+        case TextureType::Texture1DArray:   return WGPUExtent3D{ extent.width, 1u, arrayLayers };
+        case TextureType::Texture2D:        /*pass*/
+        case TextureType::Texture2DMS:      return WGPUExtent3D{ extent.width, extent.height, 1u };
+        case TextureType::Texture3D:        return WGPUExtent3D{ extent.width, extent.height, extent.depth };
+        default:                            return WGPUExtent3D{ extent.width, extent.height, arrayLayers };
+    }
+}
+
+WGPUOrigin3D ToWGPUOrigin(const TextureType textureType, const Offset3D& offset, std::uint32_t baseArrayLayer)
+{
+    switch (textureType)
+    {
+        case TextureType::Texture1D:        return WGPUOrigin3D{ static_cast<std::uint32_t>(offset.x), 0u, 0u };
+        case TextureType::Texture1DArray:   return WGPUOrigin3D{ static_cast<std::uint32_t>(offset.x), 0u, baseArrayLayer };
+        case TextureType::Texture2D:        /*pass*/
+        case TextureType::Texture2DMS:      return WGPUOrigin3D{ static_cast<std::uint32_t>(offset.x), static_cast<std::uint32_t>(offset.y), 0u };
+        case TextureType::Texture3D:        return WGPUOrigin3D{ static_cast<std::uint32_t>(offset.x), static_cast<std::uint32_t>(offset.y), static_cast<std::uint32_t>(offset.z) };
+        default:                            return WGPUOrigin3D{ static_cast<std::uint32_t>(offset.x), static_cast<std::uint32_t>(offset.y), baseArrayLayer };
+    }
+}
+
+
+} // /namespace WebGPUTypes
+
+} // /namespace LLGL
+
+
+
+// ================================================================================
@@ -0,0 +1,75 @@
+/*
+ * WebGPUTypes.h
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#ifndef LLGL_WEBGPU_TYPES_H
+#define LLGL_WEBGPU_TYPES_H
+
+
+#include "WebGPU.h"
+#include <LLGL/PipelineStateFlags.h>
+#include <LLGL/RenderPassFlags.h>
+#include <LLGL/TextureFlags.h>
+#include <LLGL/Format.h>
+#include <LLGL/SamplerFlags.h>
+#include <LLGL/QueryHeapFlags.h>
+#include <LLGL/ShaderFlags.h>
+
+
+namespace LLGL
+{
+
+namespace WebGPUTypes
+{
+
+
+/* ----- Map functions ----- */
+
+[[noreturn]]
+void MapFailed(const char* typeName, const char* wgpuTypeName);
+
+WGPUTextureFormat        Map( const Format               format            );
+WGPUTextureViewDimension Map( const TextureType          textureType       );
+WGPUPrimitiveTopology    Map( const PrimitiveTopology    primitiveTopology );
+WGPUCullMode             Map( const CullMode             cullMode          );
+WGPUCompareFunction      Map( const CompareOp            compareOp         );
+WGPUStencilOperation     Map( const StencilOp            stencilOp         );
+WGPUBlendFactor          Map( const BlendOp              blendOp           );
+WGPUBlendOperation       Map( const BlendArithmetic      blendArithmetic   );
+WGPUAddressMode          Map( const SamplerAddressMode   addressMode       );
+WGPUFilterMode           Map( const SamplerFilter        filter            );
+WGPUQueryType            Map( const QueryType            queryType         );
+WGPULoadOp               Map( const AttachmentLoadOp     loadOp            );
+WGPUStoreOp              Map( const AttachmentStoreOp    storeOp           );
+
+Format Unmap( const WGPUTextureFormat format );
+
+// Returns the WebGPU texture format for the specified LLGL format or WGPUTextureFormat_Undefined if there is no equivalent.
+WGPUTextureFormat        ToWGPUTextureFormat(const Format format);
+
+// Returns the WebGPU vertex format for the specified LLGL format or WGPUVertexFormat_Undefined if there is no equivalent.
+WGPUVertexFormat         ToWGPUVertexFormat(const Format format);
+
+WGPUTextureDimension     ToWGPUTextureDimension(const TextureType textureType);
+WGPUIndexFormat          ToWGPUIndexFormat(const Format format);
+WGPUMipmapFilterMode     ToWGPUMipmapFilterMode(const SamplerFilter filter);
+WGPUShaderStageFlags     ToWGPUShaderStageFlags(long stageFlags);
+WGPUColorWriteMaskFlags  ToWGPUColorWriteMask(std::uint8_t colorMask);
+WGPUTextureAspect        ToWGPUTextureAspect(const Format format);
+WGPUExtent3D             ToWGPUExtent(const TextureType textureType, const Extent3D& extent, std::uint32_t arrayLayers = 1);
+WGPUOrigin3D             ToWGPUOrigin(const TextureType textureType, const Offset3D& offset, std::uint32_t baseArrayLayer = 0);
+
+
+} // /namespace WebGPUTypes
+
+} // /namespace LLGL
+
+
+#endif
+
+
+
+// ================================================================================
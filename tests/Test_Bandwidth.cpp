@@ -0,0 +1,478 @@
+/*
+ * Test_Bandwidth.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Timer.h>
+#include <vector>
+#include <string>
+#include <functional>
+#include <algorithm>
+#include <fstream>
+#include <string.h>
+#include <stdlib.h>
+
+
+/*
+Measures the bandwidth and latency of all upload and readback paths for buffers and textures across payload sizes from 64 B to 256 MB.
+Each operation is followed by CommandQueue::WaitIdle, so the results include staging, copy, and synchronization costs of the backend.
+
+Usage:
+  Test_Bandwidth [MODULE*] [--max-size=MB] [--json=FILE]
+
+If no module is specified, all available modules are measured. The results are printed as table and written to a JSON file (Bandwidth.json by default).
+*/
+
+struct BandwidthResult
+{
+    std::string     module;
+    std::string     device;
+    std::string     path;
+    std::string     variant;
+    std::uint64_t   payloadSize = 0;
+    double          latency     = 0.0; // Average duration of a single operation (in milliseconds)
+    double          bandwidth   = 0.0; // Payload per second (in GB/s)
+};
+
+enum BufferPaths
+{
+    PathWriteBuffer     = (1 << 0),
+    PathUpdateBuffer    = (1 << 1),
+    PathMapBufferWrite  = (1 << 2),
+    PathReadBuffer      = (1 << 3),
+    PathMapBufferRead   = (1 << 4),
+};
+
+struct BufferVariant
+{
+    const char* name;
+    long        cpuAccessFlags;
+    long        miscFlags;
+    int         paths;
+};
+
+static const BufferVariant g_bufferVariants[] =
+{
+    { "Default",          0,                           0,                             PathWriteBuffer | PathUpdateBuffer | PathReadBuffer },
+    { "DynamicUsage",     0,                           LLGL::MiscFlags::DynamicUsage, PathWriteBuffer | PathUpdateBuffer                  },
+    { "CPUWrite",         LLGL::CPUAccessFlags::Write, 0,                             PathWriteBuffer | PathMapBufferWrite                },
+    { "CPUWrite+Dynamic", LLGL::CPUAccessFlags::Write, LLGL::MiscFlags::DynamicUsage, PathWriteBuffer | PathMapBufferWrite                },
+    { "CPURead",          LLGL::CPUAccessFlags::Read,  0,                             PathReadBuffer  | PathMapBufferRead                 },
+};
+
+// Maximum data size for CommandBuffer::UpdateBuffer.
+static const std::uint64_t g_maxUpdateBufferSize = 65536;
+
+// Width of textures (in pixels); Payloads larger than one row are measured with multiple rows of this width.
+static const std::uint32_t g_maxTextureWidth = 4096;
+
+static std::string FormatSize(std::uint64_t size)
+{
+    if (size >= 1024*1024)
+        return std::to_string(size / (1024*1024)) + " MB";
+    if (size >= 1024)
+        return std::to_string(size / 1024) + " KB";
+    return std::to_string(size) + " B";
+}
+
+class BandwidthTest
+{
+
+    private:
+
+        LLGL::RenderSystemPtr           renderer;
+        LLGL::SwapChain*                swapChain       = nullptr;
+        LLGL::CommandQueue*             commandQueue    = nullptr;
+        LLGL::CommandBuffer*            commands        = nullptr;
+
+        std::string                     moduleName;
+        std::string                     deviceName;
+        std::vector<char>               srcData;
+        std::vector<char>               dstData;
+        std::vector<BandwidthResult>    results;
+
+    private:
+
+        void Measure(const char* path, const char* variant, std::uint64_t payloadSize, const std::function<void()>& callback)
+        {
+            // Repeat small payloads more often to get stable latencies, but limit the total amount of data per measurement
+            const std::uint64_t maxTotalSize    = 256ull * 1024ull * 1024ull;
+            const unsigned      numIterations   = static_cast<unsigned>(std::max<std::uint64_t>(3, std::min<std::uint64_t>(1000, maxTotalSize / payloadSize)));
+
+            // Run once without measuring to exclude lazy allocations of staging memory
+            callback();
+            commandQueue->WaitIdle();
+
+            const std::uint64_t startTick = LLGL::Timer::Tick();
+            for (unsigned i = 0; i < numIterations; ++i)
+            {
+                callback();
+                commandQueue->WaitIdle();
+            }
+            const std::uint64_t endTick = LLGL::Timer::Tick();
+
+            const double seconds = static_cast<double>(endTick - startTick) / static_cast<double>(LLGL::Timer::Frequency());
+
+            BandwidthResult result;
+            {
+                result.module       = moduleName;
+                result.device       = deviceName;
+                result.path         = path;
+                result.variant      = variant;
+                result.payloadSize  = payloadSize;
+                result.latency      = (seconds * 1000.0) / static_cast<double>(numIterations);
+                result.bandwidth    = (seconds > 0.0 ? static_cast<double>(payloadSize * numIterations) / seconds / 1.0e9 : 0.0);
+            }
+            results.push_back(result);
+
+            LLGL::Log::Printf(
+                "%-36s %-18s %8s %12.4f ms %10.3f GB/s\n",
+                path, variant, FormatSize(payloadSize).c_str(), result.latency, result.bandwidth
+            );
+        }
+
+        void MeasureBufferPaths(std::uint64_t payloadSize)
+        {
+            if (payloadSize > renderer->GetRenderingCaps().limits.maxBufferSize)
+                return;
+
+            for (const BufferVariant& variant : g_bufferVariants)
+            {
+                LLGL::BufferDescriptor bufferDesc;
+                {
+                    bufferDesc.size             = payloadSize;
+                    bufferDesc.bindFlags        = LLGL::BindFlags::CopySrc | LLGL::BindFlags::CopyDst;
+                    bufferDesc.cpuAccessFlags   = variant.cpuAccessFlags;
+                    bufferDesc.miscFlags        = variant.miscFlags | LLGL::MiscFlags::NoInitialData;
+                }
+                LLGL::Buffer* buffer = renderer->CreateBuffer(bufferDesc);
+                if (buffer == nullptr)
+                    continue;
+
+                if ((variant.paths & PathWriteBuffer) != 0)
+                {
+                    Measure(
+                        "WriteBuffer", variant.name, payloadSize,
+                        [this, buffer, payloadSize]()
+                        {
+                            renderer->WriteBuffer(*buffer, 0, srcData.data(), payloadSize);
+                        }
+                    );
+                }
+
+                if ((variant.paths & PathUpdateBuffer) != 0)
+                {
+                    Measure(
+                        "UpdateBuffer", variant.name, payloadSize,
+                        [this, buffer, payloadSize]()
+                        {
+                            commands->Begin();
+                            {
+                                for (std::uint64_t offset = 0; offset < payloadSize; offset += g_maxUpdateBufferSize)
+                                {
+                                    const std::uint64_t chunkSize = std::min(g_maxUpdateBufferSize, payloadSize - offset);
+                                    commands->UpdateBuffer(*buffer, offset, srcData.data() + offset, chunkSize);
+                                }
+                            }
+                            commands->End();
+                            commandQueue->Submit(*commands);
+                        }
+                    );
+                }
+
+                if ((variant.paths & PathMapBufferWrite) != 0)
+                {
+                    const LLGL::CPUAccess access = ((variant.miscFlags & LLGL::MiscFlags::DynamicUsage) != 0 ? LLGL::CPUAccess::WriteDiscard : LLGL::CPUAccess::WriteOnly);
+                    Measure(
+                        "MapBuffer(Write)", variant.name, payloadSize,
+                        [this, buffer, payloadSize, access]()
+                        {
+                            if (void* data = renderer->MapBuffer(*buffer, access))
+                            {
+                                ::memcpy(data, srcData.data(), static_cast<std::size_t>(payloadSize));
+                                renderer->UnmapBuffer(*buffer);
+                            }
+                        }
+                    );
+                }
+
+                if ((variant.paths & PathReadBuffer) != 0)
+                {
+                    Measure(
+                        "ReadBuffer", variant.name, payloadSize,
+                        [this, buffer, payloadSize]()
+                        {
+                            renderer->ReadBuffer(*buffer, 0, dstData.data(), payloadSize);
+                        }
+                    );
+                }
+
+                if ((variant.paths & PathMapBufferRead) != 0)
+                {
+                    Measure(
+                        "MapBuffer(Read)", variant.name, payloadSize,
+                        [this, buffer, payloadSize]()
+                        {
+                            if (const void* data = renderer->MapBuffer(*buffer, LLGL::CPUAccess::ReadOnly))
+                            {
+                                ::memcpy(dstData.data(), data, static_cast<std::size_t>(payloadSize));
+                                renderer->UnmapBuffer(*buffer);
+                            }
+                        }
+                    );
+                }
+
+                renderer->Release(*buffer);
+            }
+        }
+
+        void MeasureTexturePaths(std::uint64_t payloadSize)
+        {
+            // Determine extent of an RGBA8 texture with the size of the payload
+            const std::uint64_t numPixels = payloadSize / 4;
+            const LLGL::RenderingLimits& limits = renderer->GetRenderingCaps().limits;
+
+            LLGL::Extent3D extent;
+            extent.width    = static_cast<std::uint32_t>(std::min<std::uint64_t>(numPixels, g_maxTextureWidth));
+            extent.height   = static_cast<std::uint32_t>(numPixels / extent.width);
+            extent.depth    = 1;
+
+            if (extent.width > limits.max2DTextureSize || extent.height > limits.max2DTextureSize || payloadSize > limits.maxBufferSize)
+                return;
+
+            LLGL::TextureDescriptor textureDesc;
+            {
+                textureDesc.type        = LLGL::TextureType::Texture2D;
+                textureDesc.bindFlags   = LLGL::BindFlags::Sampled | LLGL::BindFlags::CopySrc | LLGL::BindFlags::CopyDst;
+                textureDesc.miscFlags   = LLGL::MiscFlags::NoInitialData;
+                textureDesc.format      = LLGL::Format::RGBA8UNorm;
+                textureDesc.extent      = extent;
+                textureDesc.mipLevels   = 1;
+            }
+            LLGL::Texture* texture = renderer->CreateTexture(textureDesc);
+            if (texture == nullptr)
+                return;
+
+            // Create staging buffers for copies between textures and buffers
+            LLGL::BufferDescriptor uploadBufferDesc;
+            {
+                uploadBufferDesc.size       = payloadSize;
+                uploadBufferDesc.bindFlags  = LLGL::BindFlags::CopySrc | LLGL::BindFlags::CopyDst;
+                uploadBufferDesc.miscFlags  = LLGL::MiscFlags::NoInitialData;
+            }
+            LLGL::Buffer* uploadBuffer = renderer->CreateBuffer(uploadBufferDesc);
+
+            LLGL::BufferDescriptor readbackBufferDesc;
+            {
+                readbackBufferDesc.size             = payloadSize;
+                readbackBufferDesc.bindFlags        = LLGL::BindFlags::CopyDst;
+                readbackBufferDesc.cpuAccessFlags   = LLGL::CPUAccessFlags::Read;
+                readbackBufferDesc.miscFlags        = LLGL::MiscFlags::NoInitialData;
+            }
+            LLGL::Buffer* readbackBuffer = renderer->CreateBuffer(readbackBufferDesc);
+
+            const LLGL::TextureRegion region{ LLGL::Offset3D{}, extent };
+
+            Measure(
+                "WriteTexture", "Default", payloadSize,
+                [this, texture, &region, payloadSize]()
+                {
+                    const LLGL::ImageView srcImageView{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, srcData.data(), static_cast<std::size_t>(payloadSize) };
+                    renderer->WriteTexture(*texture, region, srcImageView);
+                }
+            );
+
+            if (uploadBuffer != nullptr)
+            {
+                Measure(
+                    "WriteBuffer+CopyTextureFromBuffer", "Default", payloadSize,
+                    [this, texture, uploadBuffer, &region, payloadSize]()
+                    {
+                        renderer->WriteBuffer(*uploadBuffer, 0, srcData.data(), payloadSize);
+                        commands->Begin();
+                        {
+                            commands->CopyTextureFromBuffer(*texture, region, *uploadBuffer, 0);
+                        }
+                        commands->End();
+                        commandQueue->Submit(*commands);
+                    }
+                );
+            }
+
+            Measure(
+                "ReadTexture", "Default", payloadSize,
+                [this, texture, &region, payloadSize]()
+                {
+                    const LLGL::MutableImageView dstImageView{ LLGL::ImageFormat::RGBA, LLGL::DataType::UInt8, dstData.data(), static_cast<std::size_t>(payloadSize) };
+                    renderer->ReadTexture(*texture, region, dstImageView);
+                }
+            );
+
+            if (readbackBuffer != nullptr)
+            {
+                Measure(
+                    "CopyBufferFromTexture+MapBuffer", "CPURead", payloadSize,
+                    [this, texture, readbackBuffer, &region, payloadSize]()
+                    {
+                        commands->Begin();
+                        {
+                            commands->CopyBufferFromTexture(*readbackBuffer, 0, *texture, region);
+                        }
+                        commands->End();
+                        commandQueue->Submit(*commands);
+                        commandQueue->WaitIdle();
+                        if (const void* data = renderer->MapBuffer(*readbackBuffer, LLGL::CPUAccess::ReadOnly))
+                        {
+                            ::memcpy(dstData.data(), data, static_cast<std::size_t>(payloadSize));
+                            renderer->UnmapBuffer(*readbackBuffer);
+                        }
+                    }
+                );
+            }
+
+            // Release resources
+            if (uploadBuffer != nullptr)
+                renderer->Release(*uploadBuffer);
+            if (readbackBuffer != nullptr)
+                renderer->Release(*readbackBuffer);
+            renderer->Release(*texture);
+        }
+
+    public:
+
+        bool Load(const std::string& rendererModule)
+        {
+            moduleName = rendererModule;
+
+            // Load renderer
+            LLGL::Report report;
+            renderer = LLGL::RenderSystem::Load(rendererModule, &report);
+            if (!renderer)
+            {
+                LLGL::Log::Errorf("%s", report.GetText());
+                return false;
+            }
+
+            deviceName = renderer->GetRendererInfo().deviceName.c_str();
+
+            // Create swap-chain; This is only required for backends that need a context to execute commands
+            LLGL::SwapChainDescriptor swapChainDesc;
+            {
+                swapChainDesc.resolution = { 320, 240 };
+            }
+            swapChain = renderer->CreateSwapChain(swapChainDesc);
+
+            // Create command buffer that is not submitted immediately, so all paths share the same submission costs
+            commands = renderer->CreateCommandBuffer();
+            commandQueue = renderer->GetCommandQueue();
+
+            return true;
+        }
+
+        void Run(std::uint64_t maxPayloadSize)
+        {
+            LLGL::Log::Printf("\nrun bandwidth tests: %s (%s) ...\n", moduleName.c_str(), deviceName.c_str());
+            LLGL::Log::Printf("%-36s %-18s %8s %15s %15s\n", "PATH", "VARIANT", "SIZE", "LATENCY", "BANDWIDTH");
+
+            // Initialize source data with a pattern that cannot be compressed by the driver
+            srcData.resize(static_cast<std::size_t>(maxPayloadSize));
+            dstData.resize(static_cast<std::size_t>(maxPayloadSize));
+            std::uint32_t seed = 1;
+            for (char& byte : srcData)
+            {
+                seed = (214013 * seed + 2531011);
+                byte = static_cast<char>(seed >> 16);
+            }
+
+            for (std::uint64_t payloadSize = 64; payloadSize <= maxPayloadSize; payloadSize *= 4)
+            {
+                MeasureBufferPaths(payloadSize);
+                MeasureTexturePaths(payloadSize);
+            }
+
+            // Release memory of the source and destination data before the next module is loaded
+            srcData.clear();
+            srcData.shrink_to_fit();
+            dstData.clear();
+            dstData.shrink_to_fit();
+        }
+
+        const std::vector<BandwidthResult>& GetResults() const
+        {
+            return results;
+        }
+
+};
+
+static bool SaveResults(const std::string& filename, const std::vector<BandwidthResult>& results)
+{
+    std::ofstream file{ filename };
+    if (!file.good())
+        return false;
+
+    // Write one result per line, so the file can be diffed against previous runs
+    file << "{\n";
+    file << "  \"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const BandwidthResult& result = results[i];
+        file << "    { \"module\": \"" << result.module << "\", \"device\": \"" << result.device
+             << "\", \"path\": \"" << result.path << "\", \"variant\": \"" << result.variant
+             << "\", \"size\": " << result.payloadSize << ", \"latencyMs\": " << result.latency
+             << ", \"bandwidthGBs\": " << result.bandwidth << " }"
+             << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    file << "  ]\n";
+    file << "}\n";
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    std::vector<std::string> rendererModules;
+    std::uint64_t maxPayloadSize = 256ull * 1024ull * 1024ull;
+    std::string jsonFilename = "Bandwidth.json";
+
+    // Parse program arguments
+    for (int i = 1; i < argc; ++i)
+    {
+        if (::strncmp(argv[i], "--max-size=", 11) == 0)
+            maxPayloadSize = std::max<std::uint64_t>(1, ::strtoull(argv[i] + 11, nullptr, 10)) * 1024ull * 1024ull;
+        else if (::strncmp(argv[i], "--json=", 7) == 0)
+            jsonFilename = argv[i] + 7;
+        else if (argv[i][0] != '-')
+            rendererModules.push_back(argv[i]);
+    }
+
+    if (rendererModules.empty())
+        rendererModules = LLGL::RenderSystem::FindModules();
+
+    // Measure all modules one after another, since only one render system can be loaded at a time
+    std::vector<BandwidthResult> results;
+    for (const std::string& module : rendererModules)
+    {
+        BandwidthTest test;
+        if (test.Load(module))
+        {
+            test.Run(maxPayloadSize);
+            results.insert(results.end(), test.GetResults().begin(), test.GetResults().end());
+        }
+    }
+
+    if (SaveResults(jsonFilename, results))
+        LLGL::Log::Printf("\nresults written to: %s\n", jsonFilename.c_str());
+    else
+        LLGL::Log::Errorf("failed to write results: %s\n", jsonFilename.c_str());
+
+    return 0;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,122 @@
+/*
+ * Test_Replay.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/Utils/CaptureReplayer.h>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <cstring>
+
+
+// Replays a frame capture that has been recorded with LLGL::RenderingDebugger::BeginCapture and prints the average CPU and GPU time of each frame.
+// Usage: Test_Replay CAPTURE_FILE [RENDERER_MODULE] [NUM_LOOPS]
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    if (argc < 2)
+    {
+        LLGL::Log::Printf("usage: Test_Replay CAPTURE_FILE [RENDERER_MODULE] [NUM_LOOPS]\n");
+        return 1;
+    }
+
+    const char*         captureFile     = argv[1];
+    const std::string   rendererModule  = (argc > 2 ? argv[2] : "OpenGL");
+    const int           numLoops        = (argc > 3 ? std::max(1, std::atoi(argv[3])) : 100);
+
+    // Load renderer with debugger to measure the GPU time of each frame; validation is disabled to keep the CPU overhead low
+    LLGL::RenderingDebugger debugger;
+    debugger.SetValidation(false);
+    debugger.SetScopeRecording(true);
+
+    LLGL::RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName = rendererModule.c_str();
+        rendererDesc.debugger   = &debugger;
+    }
+    LLGL::Report report;
+    LLGL::RenderSystemPtr renderer = LLGL::RenderSystem::Load(rendererDesc, &report);
+    if (!renderer)
+    {
+        LLGL::Log::Errorf("%s", report.GetText());
+        return 1;
+    }
+
+    // Load capture
+    LLGL::CaptureReplayer replayer{ *renderer };
+    if (!replayer.Load(captureFile, &report))
+    {
+        LLGL::Log::Errorf("%s", report.GetText());
+        return 1;
+    }
+
+    const std::uint32_t numFrames = replayer.GetNumFrames();
+    LLGL::Log::Printf("replay %u frame(s) of capture \"%s\" %d times with renderer \"%s\" ...\n", numFrames, captureFile, numLoops, rendererModule.c_str());
+
+    std::vector<double>         cpuTime(numFrames, 0.0);
+    std::vector<double>         gpuTime(numFrames, 0.0);
+    std::vector<std::uint32_t>  gpuSamples(numFrames, 0u);
+
+    const double ticksToMillisecs = 1000.0 / static_cast<double>(LLGL::Timer::Frequency());
+
+    auto AccumulateScopes = [&](const LLGL::FrameProfile& profile)
+    {
+        // Root scopes are the "Frame N" debug groups of the replayer; they are resolved a few frames after they have been recorded
+        for (const LLGL::ProfileScopeRecord& scope : profile.scopeRecords)
+        {
+            if (scope.depth != 0 || std::strncmp(scope.annotation.c_str(), "Frame ", 6) != 0)
+                continue;
+            const std::uint32_t frame = static_cast<std::uint32_t>(std::atoi(scope.annotation.c_str() + 6));
+            if (frame < numFrames)
+            {
+                gpuTime[frame] += static_cast<double>(scope.gpuTicksEnd - scope.gpuTicksStart) * ticksToMillisecs;
+                ++gpuSamples[frame];
+            }
+        }
+    };
+
+    LLGL::FrameProfile profile;
+    for (int loop = 0; loop < numLoops; ++loop)
+    {
+        for (std::uint32_t frame = 0; frame < numFrames; ++frame)
+        {
+            const std::uint64_t startTime = LLGL::Timer::Tick();
+            if (!replayer.ReplayFrame(frame))
+            {
+                LLGL::Log::Errorf("failed to replay frame %u\n", frame);
+                return 1;
+            }
+            cpuTime[frame] += static_cast<double>(LLGL::Timer::Tick() - startTime) * ticksToMillisecs;
+
+            debugger.FlushProfile(&profile);
+            AccumulateScopes(profile);
+        }
+    }
+
+    // Wait for outstanding scopes of the last frames
+    renderer->GetCommandQueue()->WaitIdle();
+    for (int i = 0; i < 4; ++i)
+    {
+        debugger.FlushProfile(&profile);
+        AccumulateScopes(profile);
+    }
+
+    // Print average time per frame
+    for (std::uint32_t frame = 0; frame < numFrames; ++frame)
+    {
+        LLGL::Log::Printf("frame %u:\n", frame);
+        LLGL::Log::Printf("\tCPU: %f ms\n", cpuTime[frame] / numLoops);
+        if (gpuSamples[frame] > 0)
+            LLGL::Log::Printf("\tGPU: %f ms\n", gpuTime[frame] / gpuSamples[frame]);
+        else
+            LLGL::Log::Printf("\tGPU: n/a\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+ * BenchmarkBufferUpload.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+/*
+Measures the upload bandwidth of RenderSystem::WriteBuffer for different chunk sizes into a large GPU buffer.
+Each run uploads the entire buffer and waits for the GPU to finish, so staging and copy costs of the backend are included.
+*/
+DEF_BENCHMARK( BufferUpload )
+{
+    struct UploadScenario
+    {
+        const char*     name;
+        std::uint64_t   chunkSize;
+    };
+
+    const std::uint64_t bufferSize  = (opt.fastTest ? 16 : 64) * 1024 * 1024;
+    const unsigned      numRuns     = (opt.fastTest ? 1 : 3);
+
+    const UploadScenario scenarios[] =
+    {
+        { "4KB",  4096       },
+        { "64KB", 65536      },
+        { "1MB",  1048576    },
+        { "Full", bufferSize },
+    };
+
+    // Create destination buffer and source data
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = bufferSize;
+        bufferDesc.bindFlags    = BindFlags::VertexBuffer | BindFlags::CopyDst;
+        bufferDesc.miscFlags    = MiscFlags::NoInitialData;
+    }
+    CREATE_BUFFER(dstBuffer, bufferDesc, "BenchmarkUploadBuffer", nullptr);
+
+    std::vector<std::uint32_t> srcData(static_cast<std::size_t>(bufferSize / sizeof(std::uint32_t)));
+    for_range(i, srcData.size())
+        srcData[i] = static_cast<std::uint32_t>(i);
+
+    const char* srcBytes = reinterpret_cast<const char*>(srcData.data());
+
+    for (const UploadScenario& scenario : scenarios)
+    {
+        double minUploadTime = 0.0;
+
+        for_range(run, numRuns)
+        {
+            const std::uint64_t t0 = Timer::Tick();
+            for (std::uint64_t offset = 0; offset < bufferSize; offset += scenario.chunkSize)
+            {
+                const std::uint64_t chunkSize = std::min(scenario.chunkSize, bufferSize - offset);
+                renderer->WriteBuffer(*dstBuffer, offset, srcBytes + offset, chunkSize);
+            }
+            cmdQueue->WaitIdle();
+            const std::uint64_t t1 = Timer::Tick();
+
+            const double uploadTime = ToMillisecs(t0, t1);
+            minUploadTime = (run == 0 ? uploadTime : std::min(minUploadTime, uploadTime));
+        }
+
+        const double bandwidth = (static_cast<double>(bufferSize) / (1024.0 * 1024.0)) / (minUploadTime / 1000.0);
+        RecordBenchmarkResult(std::string("BufferUpload.") + scenario.name, bandwidth, "MB/s", true);
+    }
+
+    // Release resources
+    renderer->Release(*dstBuffer);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
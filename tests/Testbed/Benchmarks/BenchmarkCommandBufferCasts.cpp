@@ -0,0 +1,113 @@
+/*
+ * BenchmarkCommandBufferCasts.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+/*
+Measures the CPU cost per draw call when every draw call rebinds its vertex buffer, index buffer, PSO, and constant buffer.
+Each of these commands casts its argument to the backend type, so this benchmark is dominated by the cost of these casts in builds with checked casts.
+The result name includes the cast configuration the testbed was built with (see LLGL_ENABLE_CHECKED_CAST_HOT_PATHS),
+so the results of a Debug build with "Checked" casts can be compared against the same build with "Static" casts.
+*/
+DEF_BENCHMARK( CommandBufferCasts )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    #if LLGL_ENABLE_CHECKED_CAST && LLGL_ENABLE_CHECKED_CAST_HOT_PATHS
+    const char* castConfig = "Checked";
+    #else
+    const char* castConfig = "Static";
+    #endif
+
+    const std::uint32_t numDraws    = (opt.fastTest ? 10000 : 100000);
+    const unsigned      numRuns     = (opt.fastTest ? 1 : 3);
+
+    // Create two PSOs to alternate between
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(psoCullBack, psoDesc, "psoBenchmarkCommandBufferCasts.CullBack");
+
+    psoDesc.rasterizer.cullMode = CullMode::Front;
+    CREATE_GRAPHICS_PSO(psoCullFront, psoDesc, "psoBenchmarkCommandBufferCasts.CullFront");
+
+    // Create second constant buffer to alternate with the scene constant buffer
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = sizeof(SceneConstants);
+        bufferDesc.bindFlags    = BindFlags::ConstantBuffer;
+    }
+    CREATE_BUFFER(altSceneCbuffer, bufferDesc, "BenchmarkCommandBufferCasts.Cbuffer", &sceneConstants);
+
+    PipelineState*  psos[2]             = { psoCullBack, psoCullFront };
+    Buffer*         sceneCbuffers[2]    = { sceneCbuffer, altSceneCbuffer };
+
+    CommandBuffer* benchmarkCmdBuffer = renderer->CreateCommandBuffer();
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    double minEncodeTime = 0.0;
+
+    for_range(run, numRuns)
+    {
+        const std::uint64_t t0 = Timer::Tick();
+
+        benchmarkCmdBuffer->Begin();
+        {
+            benchmarkCmdBuffer->BeginRenderPass(*swapChain);
+            {
+                benchmarkCmdBuffer->SetViewport(swapChain->GetResolution());
+                for_range(draw, numDraws)
+                {
+                    benchmarkCmdBuffer->SetVertexBuffer(*meshBuffer);
+                    benchmarkCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+                    benchmarkCmdBuffer->SetPipelineState(*psos[draw % 2]);
+                    benchmarkCmdBuffer->SetResource(0, *sceneCbuffers[draw % 2]);
+                    benchmarkCmdBuffer->DrawIndexed(3, 0);
+                }
+            }
+            benchmarkCmdBuffer->EndRenderPass();
+        }
+        benchmarkCmdBuffer->End();
+
+        const std::uint64_t t1 = Timer::Tick();
+
+        // Submit command buffer to not accumulate pending work, but don't include it in the measurement
+        cmdQueue->Submit(*benchmarkCmdBuffer);
+        cmdQueue->WaitIdle();
+
+        const double encodeTime = ToMillisecs(t0, t1);
+        minEncodeTime = (run == 0 ? encodeTime : std::min(minEncodeTime, encodeTime));
+    }
+
+    const double nanosecsPerDraw = minEncodeTime * 1000000.0 / static_cast<double>(numDraws);
+    RecordBenchmarkResult(std::string("CommandBufferCasts.") + castConfig, nanosecsPerDraw, "ns/draw");
+
+    // Release resources
+    renderer->Release(*benchmarkCmdBuffer);
+    renderer->Release(*altSceneCbuffer);
+    renderer->Release(*psoCullFront);
+    renderer->Release(*psoCullBack);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
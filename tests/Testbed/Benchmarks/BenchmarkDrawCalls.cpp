@@ -0,0 +1,119 @@
+/*
+ * BenchmarkDrawCalls.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+/*
+Measures the draw-call throughput of the command buffer: N indexed draw calls of a single triangle with the same PSO and resources.
+The encoding time only includes the CPU time to record the commands and the submission time includes waiting for the GPU to finish.
+*/
+DEF_BENCHMARK( DrawCalls )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    struct DrawCallScenario
+    {
+        const char*     name;
+        std::uint32_t   numDraws;
+    };
+
+    const DrawCallScenario scenarios[] =
+    {
+        { "10k",  10000   },
+        { "100k", 100000  },
+        { "1M",   1000000 },
+    };
+
+    const unsigned numScenarios = (opt.fastTest ? 2 : 3);
+    const unsigned numRuns      = (opt.fastTest ? 1 : 3);
+
+    // Create graphics PSO
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoBenchmarkDrawCalls");
+
+    // Create command buffer that is submitted explicitly, so encoding and submission can be measured separately
+    CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.debugName = "BenchmarkDrawCalls";
+    }
+    CommandBuffer* benchmarkCmdBuffer = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    for_range(i, numScenarios)
+    {
+        const DrawCallScenario& scenario = scenarios[i];
+
+        double minEncodeTime = 0.0;
+        double minSubmitTime = 0.0;
+
+        for_range(run, numRuns)
+        {
+            // Encode N draw calls
+            const std::uint64_t t0 = Timer::Tick();
+            benchmarkCmdBuffer->Begin();
+            {
+                benchmarkCmdBuffer->SetVertexBuffer(*meshBuffer);
+                benchmarkCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+                benchmarkCmdBuffer->BeginRenderPass(*swapChain);
+                {
+                    benchmarkCmdBuffer->Clear(ClearFlags::ColorDepth, bgColorDarkBlue);
+                    benchmarkCmdBuffer->SetViewport(swapChain->GetResolution());
+                    benchmarkCmdBuffer->SetPipelineState(*pso);
+                    benchmarkCmdBuffer->SetResource(0, *sceneCbuffer);
+                    for_range(draw, scenario.numDraws)
+                        benchmarkCmdBuffer->DrawIndexed(3, 0);
+                }
+                benchmarkCmdBuffer->EndRenderPass();
+            }
+            benchmarkCmdBuffer->End();
+            const std::uint64_t t1 = Timer::Tick();
+
+            // Submit and wait for the GPU
+            cmdQueue->Submit(*benchmarkCmdBuffer);
+            cmdQueue->WaitIdle();
+            const std::uint64_t t2 = Timer::Tick();
+
+            const double encodeTime = ToMillisecs(t0, t1);
+            const double submitTime = ToMillisecs(t1, t2);
+
+            minEncodeTime = (run == 0 ? encodeTime : std::min(minEncodeTime, encodeTime));
+            minSubmitTime = (run == 0 ? submitTime : std::min(minSubmitTime, submitTime));
+        }
+
+        const std::string prefix = std::string("DrawCalls.") + scenario.name;
+        const double drawsPerSec = static_cast<double>(scenario.numDraws) / ((minEncodeTime + minSubmitTime) / 1000.0);
+
+        RecordBenchmarkResult(prefix + ".Encode", minEncodeTime, "ms");
+        RecordBenchmarkResult(prefix + ".Submit", minSubmitTime, "ms");
+        RecordBenchmarkResult(prefix + ".Throughput", drawsPerSec / 1000000.0, "Mdraws/s", true);
+    }
+
+    // Release resources
+    renderer->Release(*benchmarkCmdBuffer);
+    renderer->Release(*pso);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
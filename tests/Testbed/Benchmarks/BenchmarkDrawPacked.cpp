@@ -0,0 +1,124 @@
+/*
+ * BenchmarkDrawPacked.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <vector>
+
+
+/*
+Measures the CPU cost per draw call of encoding the same draw stream once with individual commands and once with CommandBuffer::DrawPacked().
+Each draw rebinds its vertex and index buffer in the individual stream, while the packed stream leaves it to the backend to skip the redundant bindings.
+*/
+DEF_BENCHMARK( DrawPacked )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    const std::uint32_t numDraws    = (opt.fastTest ? 10000 : 100000);
+    const unsigned      numRuns     = (opt.fastTest ? 1 : 3);
+
+    // Create graphics PSO
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoBenchmarkDrawPacked");
+
+    CommandBuffer* benchmarkCmdBuffer = renderer->CreateCommandBuffer();
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    // Packed draws bind the index buffer at offset 0, so the index offset of the mesh is encoded in each record
+    const std::uint32_t firstIndex = static_cast<std::uint32_t>(mesh.indexBufferOffset / sizeof(std::uint32_t));
+
+    std::vector<DrawRecord> records(numDraws);
+    for (DrawRecord& record : records)
+    {
+        record.vertexBuffer = 0;
+        record.indexBuffer  = 0;
+        record.numVertices  = 3;
+        record.firstVertex  = firstIndex;
+    }
+
+    Buffer* meshBuffers[] = { meshBuffer };
+
+    DrawPackedDescriptor drawDesc;
+    {
+        drawDesc.vertexBuffers  = meshBuffers;
+        drawDesc.indexBuffers   = meshBuffers;
+        drawDesc.indexFormat    = Format::R32UInt;
+        drawDesc.indexed        = true;
+        drawDesc.records        = records;
+    }
+
+    auto MeasureEncoding = [&](const char* name, bool packed)
+    {
+        double minEncodeTime = 0.0;
+
+        for_range(run, numRuns)
+        {
+            const std::uint64_t t0 = Timer::Tick();
+
+            benchmarkCmdBuffer->Begin();
+            {
+                benchmarkCmdBuffer->BeginRenderPass(*swapChain);
+                {
+                    benchmarkCmdBuffer->SetViewport(swapChain->GetResolution());
+                    benchmarkCmdBuffer->SetPipelineState(*pso);
+                    benchmarkCmdBuffer->SetResource(0, *sceneCbuffer);
+                    if (packed)
+                        benchmarkCmdBuffer->DrawPacked(drawDesc);
+                    else
+                    {
+                        for_range(draw, numDraws)
+                        {
+                            benchmarkCmdBuffer->SetVertexBuffer(*meshBuffer);
+                            benchmarkCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+                            benchmarkCmdBuffer->DrawIndexed(3, 0);
+                        }
+                    }
+                }
+                benchmarkCmdBuffer->EndRenderPass();
+            }
+            benchmarkCmdBuffer->End();
+
+            const std::uint64_t t1 = Timer::Tick();
+
+            // Submit command buffer to not accumulate pending work, but don't include it in the measurement
+            cmdQueue->Submit(*benchmarkCmdBuffer);
+            cmdQueue->WaitIdle();
+
+            const double encodeTime = ToMillisecs(t0, t1);
+            minEncodeTime = (run == 0 ? encodeTime : std::min(minEncodeTime, encodeTime));
+        }
+
+        const double nanosecsPerDraw = minEncodeTime * 1000000.0 / static_cast<double>(numDraws);
+        RecordBenchmarkResult(std::string("DrawPacked.") + name, nanosecsPerDraw, "ns/draw");
+    };
+
+    MeasureEncoding("Individual", false);
+    MeasureEncoding("Packed", true);
+
+    // Release resources
+    renderer->Release(*benchmarkCmdBuffer);
+    renderer->Release(*pso);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,96 @@
+/*
+ * BenchmarkImageConversion.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+
+
+/*
+Measures the throughput of ConvertImageBuffer for common conversions with a single thread and with the maximum number of threads.
+This does not depend on the renderer, but it is measured for each module, so all results of a module can be compared in one file.
+*/
+DEF_BENCHMARK( ImageConversion )
+{
+    struct ConversionScenario
+    {
+        const char* name;
+        ImageFormat srcFormat;
+        DataType    srcDataType;
+        ImageFormat dstFormat;
+        DataType    dstDataType;
+    };
+
+    const ConversionScenario scenarios[] =
+    {
+        { "RGBA8ToBGRA8",   ImageFormat::RGBA, DataType::UInt8,   ImageFormat::BGRA, DataType::UInt8   },
+        { "RGBA8ToRGB8",    ImageFormat::RGBA, DataType::UInt8,   ImageFormat::RGB,  DataType::UInt8   },
+        { "RGBA8ToRGBA32F", ImageFormat::RGBA, DataType::UInt8,   ImageFormat::RGBA, DataType::Float32 },
+        { "RGBA32FToRGBA8", ImageFormat::RGBA, DataType::Float32, ImageFormat::RGBA, DataType::UInt8   },
+        { "RGBA8ToRGBA16F", ImageFormat::RGBA, DataType::UInt8,   ImageFormat::RGBA, DataType::Float16 },
+    };
+
+    const std::uint32_t imageSize   = (opt.fastTest ? 1024 : 2048);
+    const unsigned      numRuns     = (opt.fastTest ? 1 : 3);
+    const Extent3D      extent      = { imageSize, imageSize, 1 };
+    const std::size_t   numPixels   = static_cast<std::size_t>(imageSize) * imageSize;
+
+    // Generate source image with 32-bit float components, which is large enough for all source formats
+    std::vector<float> srcImage(numPixels * 4);
+    for_range(i, srcImage.size())
+        srcImage[i] = static_cast<float>(i % 255) / 255.0f;
+
+    std::vector<char> dstImage;
+
+    const struct
+    {
+        const char* name;
+        unsigned    threadCount;
+    }
+    threadConfigs[] =
+    {
+        { "1T",  1                     },
+        { "MaxT", LLGL_MAX_THREAD_COUNT },
+    };
+
+    for (const ConversionScenario& scenario : scenarios)
+    {
+        const std::size_t srcSize = GetMemoryFootprint(scenario.srcFormat, scenario.srcDataType, numPixels);
+        const std::size_t dstSize = GetMemoryFootprint(scenario.dstFormat, scenario.dstDataType, numPixels);
+
+        dstImage.resize(dstSize);
+
+        const ImageView         srcView{ scenario.srcFormat, scenario.srcDataType, srcImage.data(), srcSize };
+        const MutableImageView  dstView{ scenario.dstFormat, scenario.dstDataType, dstImage.data(), dstSize };
+
+        for (const auto& threadConfig : threadConfigs)
+        {
+            double minConvertTime = 0.0;
+
+            for_range(run, numRuns)
+            {
+                const std::uint64_t t0 = Timer::Tick();
+                ConvertImageBuffer(srcView, dstView, extent, threadConfig.threadCount);
+                const std::uint64_t t1 = Timer::Tick();
+
+                const double convertTime = ToMillisecs(t0, t1);
+                minConvertTime = (run == 0 ? convertTime : std::min(minConvertTime, convertTime));
+            }
+
+            // Throughput in megapixels per second
+            const double throughput = (static_cast<double>(numPixels) / 1000000.0) / (std::max(minConvertTime, 0.001) / 1000.0);
+            RecordBenchmarkResult(std::string("ImageConversion.") + scenario.name + "." + threadConfig.name, throughput, "MP/s", true);
+        }
+    }
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
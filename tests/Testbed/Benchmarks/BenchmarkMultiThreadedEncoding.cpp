@@ -0,0 +1,246 @@
+/*
+ * BenchmarkMultiThreadedEncoding.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <thread>
+
+
+/*
+Measures how command buffer encoding scales with the number of threads, based on the MultiThreading example.
+The same total number of draw calls is distributed across 1, 2, 4, ... up to the number of available cores.
+Each thread encodes several primary or secondary command buffers with typical state changes, i.e. pipeline switches, resource bindings, and index buffer changes.
+Primary command buffers are submitted one after another from the main thread.
+Secondary command buffers are executed by a single primary command buffer that is encoded and submitted from the main thread.
+Encode throughput (draws per millisecond) and the submit cost on the main thread are recorded for each thread count.
+*/
+DEF_BENCHMARK( MultiThreadedEncoding )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned  maxNumThreads           = 16;
+    constexpr unsigned  numCmdBuffersPerThread  = 4;
+    constexpr unsigned  maxNumCmdBuffers        = maxNumThreads * numCmdBuffersPerThread;
+    constexpr unsigned  drawsPerPipeline        = 8;  // Number of draws until the pipeline state changes
+    constexpr unsigned  drawsPerIndexBuffer     = 32; // Number of draws until the index buffer is bound again
+    const std::uint32_t numTotalDraws           = (opt.fastTest ? 40000 : 200000);
+    const unsigned      numRuns                 = (opt.fastTest ? 1 : 3);
+    const unsigned      numCores                = std::max(1u, std::min(std::thread::hardware_concurrency(), maxNumThreads));
+    const Extent2D      texSize                 = { 64, 64 };
+
+    // Create render pass for the render target and secondary command buffers
+    RenderPassDescriptor rpDesc;
+    {
+        rpDesc.colorAttachments[0].format   = Format::RGBA8UNorm;
+        rpDesc.colorAttachments[0].loadOp   = AttachmentLoadOp::Clear;
+        rpDesc.colorAttachments[0].storeOp  = AttachmentStoreOp::Store;
+    }
+    RenderPass* renderPass = renderer->CreateRenderPass(rpDesc);
+
+    // Create opaque and blended graphics PSOs to switch between
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = renderPass;
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(psoOpaque, psoDesc, "psoBenchmarkMultiThreading.Opaque");
+
+    {
+        BlendTargetDescriptor& targetDesc = psoDesc.blend.targets[0];
+        targetDesc.blendEnabled     = true;
+        targetDesc.srcColor         = BlendOp::One;
+        targetDesc.dstColor         = BlendOp::One;
+        targetDesc.colorArithmetic  = BlendArithmetic::Subtract;
+    }
+    CREATE_GRAPHICS_PSO(psoBlended, psoDesc, "psoBenchmarkMultiThreading.Blended");
+
+    // Create render target
+    TextureDescriptor texDesc;
+    {
+        texDesc.bindFlags       = BindFlags::ColorAttachment;
+        texDesc.extent.width    = texSize.width;
+        texDesc.extent.height   = texSize.height;
+        texDesc.mipLevels       = 1;
+    }
+    Texture* outputTexture = renderer->CreateTexture(texDesc);
+
+    RenderTargetDescriptor rtDesc;
+    {
+        rtDesc.renderPass           = renderPass;
+        rtDesc.resolution           = texSize;
+        rtDesc.colorAttachments[0]  = outputTexture;
+    }
+    RenderTarget* renderTarget = renderer->CreateRenderTarget(rtDesc);
+
+    // Create primary and secondary command buffers for all threads and the primary command buffer that executes the secondary ones
+    CommandBuffer* primaryCmdBuffers    [maxNumCmdBuffers] = {};
+    CommandBuffer* secondaryCmdBuffers  [maxNumCmdBuffers] = {};
+
+    for_range(i, maxNumCmdBuffers)
+    {
+        primaryCmdBuffers[i] = renderer->CreateCommandBuffer();
+
+        CommandBufferDescriptor secondaryCmdBufferDesc;
+        {
+            secondaryCmdBufferDesc.flags        = CommandBufferFlags::Secondary;
+            secondaryCmdBufferDesc.renderPass   = renderPass;
+        }
+        secondaryCmdBuffers[i] = renderer->CreateCommandBuffer(secondaryCmdBufferDesc);
+    }
+
+    CommandBuffer* executeCmdBuffer = renderer->CreateCommandBuffer();
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    auto EncodeDraws = [this, &mesh, psoOpaque, psoBlended](CommandBuffer* cmdBuffer, std::uint32_t numDraws)
+    {
+        for_range(draw, numDraws)
+        {
+            if (draw % drawsPerIndexBuffer == 0)
+                cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            if (draw % drawsPerPipeline == 0)
+                cmdBuffer->SetPipelineState((draw / drawsPerPipeline) % 2 == 0 ? *psoOpaque : *psoBlended);
+            cmdBuffer->SetResource(0, *sceneCbuffer);
+            cmdBuffer->DrawIndexed(3, 0);
+        }
+    };
+
+    auto EncodePrimaryWorker = [this, &EncodeDraws, renderTarget, texSize](CommandBuffer** cmdBuffers, std::uint32_t numDraws)
+    {
+        for_range(i, numCmdBuffersPerThread)
+        {
+            CommandBuffer* cmdBuffer = cmdBuffers[i];
+            cmdBuffer->Begin();
+            {
+                cmdBuffer->SetVertexBuffer(*meshBuffer);
+                cmdBuffer->BeginRenderPass(*renderTarget);
+                {
+                    cmdBuffer->SetViewport(texSize);
+                    EncodeDraws(cmdBuffer, numDraws);
+                }
+                cmdBuffer->EndRenderPass();
+            }
+            cmdBuffer->End();
+        }
+    };
+
+    auto EncodeSecondaryWorker = [this, &EncodeDraws](CommandBuffer** cmdBuffers, std::uint32_t numDraws)
+    {
+        for_range(i, numCmdBuffersPerThread)
+        {
+            CommandBuffer* cmdBuffer = cmdBuffers[i];
+            cmdBuffer->Begin();
+            {
+                cmdBuffer->SetVertexBuffer(*meshBuffer);
+                EncodeDraws(cmdBuffer, numDraws);
+            }
+            cmdBuffer->End();
+        }
+    };
+
+    for (bool secondary : { false, true })
+    {
+        double singleThreadTime = 0.0;
+
+        for (unsigned numThreads = 1; numThreads <= numCores; numThreads *= 2)
+        {
+            const unsigned      numCmdBuffers           = numThreads * numCmdBuffersPerThread;
+            const std::uint32_t numDrawsPerCmdBuffer    = numTotalDraws / numCmdBuffers;
+
+            double minEncodeTime = 0.0;
+            double minSubmitTime = 0.0;
+
+            for_range(run, numRuns)
+            {
+                // Encode all command buffers in parallel
+                std::vector<std::thread> workers;
+                workers.reserve(numThreads);
+
+                const std::uint64_t t0 = Timer::Tick();
+                for_range(i, numThreads)
+                {
+                    if (secondary)
+                        workers.emplace_back(EncodeSecondaryWorker, &secondaryCmdBuffers[i * numCmdBuffersPerThread], numDrawsPerCmdBuffer);
+                    else
+                        workers.emplace_back(EncodePrimaryWorker, &primaryCmdBuffers[i * numCmdBuffersPerThread], numDrawsPerCmdBuffer);
+                }
+                for (std::thread& worker : workers)
+                    worker.join();
+                const std::uint64_t t1 = Timer::Tick();
+
+                // Submit all command buffers from the main thread; Secondary command buffers are executed by a single primary command buffer
+                if (secondary)
+                {
+                    executeCmdBuffer->Begin();
+                    {
+                        executeCmdBuffer->BeginRenderPass(*renderTarget);
+                        {
+                            executeCmdBuffer->SetViewport(texSize);
+                            for_range(i, numCmdBuffers)
+                                executeCmdBuffer->Execute(*secondaryCmdBuffers[i]);
+                        }
+                        executeCmdBuffer->EndRenderPass();
+                    }
+                    executeCmdBuffer->End();
+                    cmdQueue->Submit(*executeCmdBuffer);
+                }
+                else
+                {
+                    for_range(i, numCmdBuffers)
+                        cmdQueue->Submit(*primaryCmdBuffers[i]);
+                }
+                const std::uint64_t t2 = Timer::Tick();
+
+                cmdQueue->WaitIdle();
+
+                const double encodeTime = ToMillisecs(t0, t1);
+                const double submitTime = ToMillisecs(t1, t2);
+                minEncodeTime = (run == 0 ? encodeTime : std::min(minEncodeTime, encodeTime));
+                minSubmitTime = (run == 0 ? submitTime : std::min(minSubmitTime, submitTime));
+            }
+
+            const std::string prefix = std::string("MultiThreadedEncoding.") + (secondary ? "Secondary." : "Primary.") + std::to_string(numThreads) + "T";
+            RecordBenchmarkResult(prefix + ".Encode", minEncodeTime, "ms");
+            RecordBenchmarkResult(prefix + ".Submit", minSubmitTime, "ms");
+
+            if (minEncodeTime > 0.0)
+                RecordBenchmarkResult(prefix + ".Throughput", static_cast<double>(numDrawsPerCmdBuffer * numCmdBuffers) / minEncodeTime, "draws/ms", true);
+
+            if (numThreads == 1)
+                singleThreadTime = minEncodeTime;
+            else if (minEncodeTime > 0.0)
+                RecordBenchmarkResult(prefix + ".Speedup", singleThreadTime / minEncodeTime, "x", true);
+        }
+    }
+
+    // Release resources
+    for_range(i, maxNumCmdBuffers)
+    {
+        renderer->Release(*primaryCmdBuffers[i]);
+        renderer->Release(*secondaryCmdBuffers[i]);
+    }
+    renderer->Release(*executeCmdBuffer);
+    renderer->Release(*renderTarget);
+    renderer->Release(*outputTexture);
+    renderer->Release(*psoOpaque);
+    renderer->Release(*psoBlended);
+    renderer->Release(*renderPass);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,90 @@
+/*
+ * BenchmarkPipelineCreation.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Measures the latency of graphics PSO creation for several state variants:
+- Cold: without a pipeline cache. Note that drivers may still cache compiled shaders internally.
+- Warm: with a pipeline cache that already contains all variants.
+- WarmFromBlob: with a new pipeline cache that is initialized from the blob of the warm cache, as it would be loaded from disk.
+*/
+DEF_BENCHMARK( PipelineCreation )
+{
+    if (shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numVariants = 8;
+
+    // Initialize PSO descriptor for the specified variant
+    auto GetVariantDesc = [this](unsigned variant) -> GraphicsPipelineDescriptor
+    {
+        GraphicsPipelineDescriptor psoDesc;
+        {
+            psoDesc.pipelineLayout                  = layouts[PipelineTextured];
+            psoDesc.renderPass                      = swapChain->GetRenderPass();
+            psoDesc.vertexShader                    = shaders[VSTextured];
+            psoDesc.fragmentShader                  = shaders[PSTextured];
+            psoDesc.depth.testEnabled               = ((variant & 0x1) != 0);
+            psoDesc.depth.writeEnabled              = ((variant & 0x1) != 0);
+            psoDesc.rasterizer.cullMode             = ((variant & 0x2) != 0 ? CullMode::Back : CullMode::Disabled);
+            psoDesc.blend.targets[0].blendEnabled   = ((variant & 0x4) != 0);
+        }
+        return psoDesc;
+    };
+
+    // Returns the average creation time of all variants in milliseconds
+    auto CreateVariants = [this, &GetVariantDesc](PipelineCache* cache) -> double
+    {
+        double totalTime = 0.0;
+        for_range(variant, numVariants)
+        {
+            const GraphicsPipelineDescriptor psoDesc = GetVariantDesc(variant);
+
+            cmdQueue->WaitIdle();
+            const std::uint64_t t0 = Timer::Tick();
+            PipelineState* pso = renderer->CreatePipelineState(psoDesc, cache);
+            const std::uint64_t t1 = Timer::Tick();
+
+            totalTime += ToMillisecs(t0, t1);
+            renderer->Release(*pso);
+        }
+        return totalTime / numVariants;
+    };
+
+    // Create all variants without cache
+    const double coldTime = CreateVariants(nullptr);
+
+    // Create all variants with a cache that has been primed with the same variants
+    PipelineCache* pipelineCache = renderer->CreatePipelineCache();
+    CreateVariants(pipelineCache);
+    const double warmTime = CreateVariants(pipelineCache);
+
+    // Create all variants with a cache that is restored from the blob of the primed cache
+    const Blob cacheBlob = pipelineCache->GetBlob();
+    PipelineCache* restoredPipelineCache = renderer->CreatePipelineCache(cacheBlob);
+    const double warmFromBlobTime = CreateVariants(restoredPipelineCache);
+
+    RecordBenchmarkResult("PipelineCreation.Cold", coldTime, "ms");
+    RecordBenchmarkResult("PipelineCreation.Warm", warmTime, "ms");
+    RecordBenchmarkResult("PipelineCreation.WarmFromBlob", warmFromBlobTime, "ms");
+
+    // Release resources
+    renderer->Release(*restoredPipelineCache);
+    renderer->Release(*pipelineCache);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
@@ -0,0 +1,136 @@
+/*
+ * BenchmarkResourceHeapChurn.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/Parse.h>
+#include <algorithm>
+
+
+/*
+Measures the cost of resource heap churn: creating a heap with many descriptor sets, rewriting each descriptor set individually,
+and switching the descriptor set before each draw call. Each descriptor set references one of several constant buffers.
+*/
+DEF_BENCHMARK( ResourceHeapChurn )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned  numBuffers  = 16;
+    const std::uint32_t numSets     = (opt.fastTest ? 256 : 4096);
+    const unsigned      numRuns     = (opt.fastTest ? 1 : 3);
+
+    // Create pipeline layout with heap binding and graphics PSO
+    PipelineLayout* psoLayout = renderer->CreatePipelineLayout(Parse("heap{cbuffer(Scene@1):vert:frag}"));
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = psoLayout;
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoBenchmarkResourceHeap");
+
+    // Create constant buffers that are referenced by the descriptor sets in alternating order
+    Buffer* buffers[numBuffers] = {};
+
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = sizeof(SceneConstants);
+        bufferDesc.bindFlags    = BindFlags::ConstantBuffer;
+    }
+    for_range(i, numBuffers)
+        buffers[i] = renderer->CreateBuffer(bufferDesc, &sceneConstants);
+
+    std::vector<ResourceViewDescriptor> resourceViews(numSets);
+    for_range(i, numSets)
+        resourceViews[i] = buffers[i % numBuffers];
+
+    auto MinTime = [](double& minTime, double time, unsigned run)
+    {
+        minTime = (run == 0 ? time : std::min(minTime, time));
+    };
+
+    double minCreateTime = 0.0, minWriteTime = 0.0, minEncodeTime = 0.0, minSubmitTime = 0.0;
+
+    CommandBuffer* benchmarkCmdBuffer = renderer->CreateCommandBuffer();
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    for_range(run, numRuns)
+    {
+        // Create resource heap with all descriptor sets
+        const std::uint64_t t0 = Timer::Tick();
+        ResourceHeap* resourceHeap = renderer->CreateResourceHeap(psoLayout, resourceViews);
+        const std::uint64_t t1 = Timer::Tick();
+
+        // Rewrite each descriptor set individually with the next buffer
+        for_range(i, numSets)
+        {
+            const ResourceViewDescriptor resourceView = buffers[(i + 1) % numBuffers];
+            renderer->WriteResourceHeap(*resourceHeap, i, { resourceView });
+        }
+        const std::uint64_t t2 = Timer::Tick();
+
+        // Switch descriptor set before each draw call
+        benchmarkCmdBuffer->Begin();
+        {
+            benchmarkCmdBuffer->SetVertexBuffer(*meshBuffer);
+            benchmarkCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            benchmarkCmdBuffer->BeginRenderPass(*swapChain);
+            {
+                benchmarkCmdBuffer->Clear(ClearFlags::ColorDepth, bgColorDarkBlue);
+                benchmarkCmdBuffer->SetViewport(swapChain->GetResolution());
+                benchmarkCmdBuffer->SetPipelineState(*pso);
+                for_range(i, numSets)
+                {
+                    benchmarkCmdBuffer->SetResourceHeap(*resourceHeap, i);
+                    benchmarkCmdBuffer->DrawIndexed(3, 0);
+                }
+            }
+            benchmarkCmdBuffer->EndRenderPass();
+        }
+        benchmarkCmdBuffer->End();
+        const std::uint64_t t3 = Timer::Tick();
+
+        cmdQueue->Submit(*benchmarkCmdBuffer);
+        cmdQueue->WaitIdle();
+        const std::uint64_t t4 = Timer::Tick();
+
+        renderer->Release(*resourceHeap);
+
+        MinTime(minCreateTime, ToMillisecs(t0, t1), run);
+        MinTime(minWriteTime,  ToMillisecs(t1, t2), run);
+        MinTime(minEncodeTime, ToMillisecs(t2, t3), run);
+        MinTime(minSubmitTime, ToMillisecs(t3, t4), run);
+    }
+
+    const double setsToMicrosecs = 1000.0 / static_cast<double>(numSets);
+
+    RecordBenchmarkResult("ResourceHeapChurn.Create", minCreateTime, "ms");
+    RecordBenchmarkResult("ResourceHeapChurn.WritePerSet", minWriteTime * setsToMicrosecs, "us");
+    RecordBenchmarkResult("ResourceHeapChurn.BindPerDraw", minEncodeTime * setsToMicrosecs, "us");
+    RecordBenchmarkResult("ResourceHeapChurn.Submit", minSubmitTime, "ms");
+
+    // Release resources
+    renderer->Release(*benchmarkCmdBuffer);
+    for (Buffer* buf : buffers)
+        renderer->Release(*buf);
+    renderer->Release(*pso);
+    renderer->Release(*psoLayout);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
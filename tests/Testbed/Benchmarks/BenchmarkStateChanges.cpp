@@ -0,0 +1,238 @@
+/*
+ * BenchmarkStateChanges.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/Parse.h>
+#include <algorithm>
+
+
+/*
+Measures the CPU cost per draw call for different state change patterns between draw calls:
+- DrawOnly: No state changes between draw calls.
+- Uniforms: CommandBuffer::SetUniforms before each draw call.
+- Resource: CommandBuffer::SetResource with alternating constant buffers before each draw call.
+- ResourceHeap: CommandBuffer::SetResourceHeap with alternating descriptor sets before each draw call.
+- PipelineState: CommandBuffer::SetPipelineState with alternating PSOs before each draw call.
+Only the encoding is measured and reported in nanoseconds per draw call.
+When run with the Null backend, this isolates the encoding overhead of LLGL itself and serves as baseline for the other backends.
+*/
+DEF_BENCHMARK( StateChanges )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr || shaders[VSDynamic] == nullptr || shaders[PSDynamic] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    const std::uint32_t numDraws    = (opt.fastTest ? 10000 : 100000);
+    const unsigned      numRuns     = (opt.fastTest ? 1 : 3);
+
+    // Create two PSOs with the same layout but different rasterizer state
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(psoCullBack, psoDesc, "psoBenchmarkStateChanges.CullBack");
+
+    psoDesc.rasterizer.cullMode = CullMode::Front;
+    CREATE_GRAPHICS_PSO(psoCullFront, psoDesc, "psoBenchmarkStateChanges.CullFront");
+
+    // Create PSO with uniforms for the same shaders that are used in the Uniforms test
+    PipelineLayoutDescriptor uniformsLayoutDesc;
+    {
+        uniformsLayoutDesc.bindings =
+        {
+            BindingDescriptor{ "Scene",    ResourceType::Buffer,  BindFlags::ConstantBuffer, StageFlags::VertexStage,   1u },
+            BindingDescriptor{ "colorMap", ResourceType::Texture, BindFlags::Sampled,        StageFlags::FragmentStage, 3u },
+        };
+        uniformsLayoutDesc.staticSamplers =
+        {
+            StaticSamplerDescriptor{ "linearSampler", StageFlags::FragmentStage, (HasCombinedSamplers() ? 3u : 4u), Parse("filter.min=nearest,filter.mag=nearest") }
+        };
+        uniformsLayoutDesc.uniforms =
+        {
+            UniformDescriptor{ "wMatrix",    UniformType::Float4x4 },
+            UniformDescriptor{ "solidColor", UniformType::Float4   },
+            UniformDescriptor{ "lightVec",   UniformType::Float3   },
+        };
+    }
+    PipelineLayout* uniformsLayout = renderer->CreatePipelineLayout(uniformsLayoutDesc);
+
+    GraphicsPipelineDescriptor uniformsPsoDesc;
+    {
+        uniformsPsoDesc.pipelineLayout      = uniformsLayout;
+        uniformsPsoDesc.renderPass          = swapChain->GetRenderPass();
+        uniformsPsoDesc.vertexShader        = shaders[VSDynamic];
+        uniformsPsoDesc.fragmentShader      = shaders[PSDynamic];
+        uniformsPsoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(psoUniforms, uniformsPsoDesc, "psoBenchmarkStateChanges.Uniforms");
+
+    // Create PSO with a resource heap of two descriptor sets
+    PipelineLayout* heapLayout = renderer->CreatePipelineLayout(Parse("heap{cbuffer(Scene@1):vert:frag}"));
+
+    psoDesc.pipelineLayout      = heapLayout;
+    psoDesc.rasterizer.cullMode = CullMode::Back;
+    CREATE_GRAPHICS_PSO(psoHeap, psoDesc, "psoBenchmarkStateChanges.ResourceHeap");
+
+    // Create second constant buffer to alternate with the scene constant buffer
+    BufferDescriptor bufferDesc;
+    {
+        bufferDesc.size         = sizeof(SceneConstants);
+        bufferDesc.bindFlags    = BindFlags::ConstantBuffer;
+    }
+    CREATE_BUFFER(altSceneCbuffer, bufferDesc, "BenchmarkStateChanges.Cbuffer", &sceneConstants);
+
+    Buffer* sceneCbuffers[2] = { sceneCbuffer, altSceneCbuffer };
+
+    const ResourceViewDescriptor heapResourceViews[] = { sceneCbuffer, altSceneCbuffer };
+    ResourceHeap* resourceHeap = renderer->CreateResourceHeap(heapLayout, heapResourceViews);
+
+    enum class StateChangePattern
+    {
+        DrawOnly,
+        Uniforms,
+        Resource,
+        ResourceHeap,
+        PipelineState,
+    };
+
+    const struct
+    {
+        const char*         name;
+        StateChangePattern  pattern;
+    }
+    scenarios[] =
+    {
+        { "DrawOnly",      StateChangePattern::DrawOnly      },
+        { "Uniforms",      StateChangePattern::Uniforms      },
+        { "Resource",      StateChangePattern::Resource      },
+        { "ResourceHeap",  StateChangePattern::ResourceHeap  },
+        { "PipelineState", StateChangePattern::PipelineState },
+    };
+
+    const ColorRGBAf solidColors[2] = { ColorRGBAf{ 1.0f, 1.0f, 1.0f, 1.0f }, ColorRGBAf{ 1.0f, 0.0f, 0.0f, 1.0f } };
+
+    CommandBuffer* benchmarkCmdBuffer = renderer->CreateCommandBuffer();
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    for (const auto& scenario : scenarios)
+    {
+        double minEncodeTime = 0.0;
+
+        for_range(run, numRuns)
+        {
+            const std::uint64_t t0 = Timer::Tick();
+
+            benchmarkCmdBuffer->Begin();
+            {
+                benchmarkCmdBuffer->SetVertexBuffer(*meshBuffer);
+                benchmarkCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+                benchmarkCmdBuffer->BeginRenderPass(*swapChain);
+                {
+                    benchmarkCmdBuffer->SetViewport(swapChain->GetResolution());
+
+                    switch (scenario.pattern)
+                    {
+                        case StateChangePattern::DrawOnly:
+                        {
+                            benchmarkCmdBuffer->SetPipelineState(*psoCullBack);
+                            benchmarkCmdBuffer->SetResource(0, *sceneCbuffer);
+                            for_range(draw, numDraws)
+                                benchmarkCmdBuffer->DrawIndexed(3, 0);
+                        }
+                        break;
+
+                        case StateChangePattern::Uniforms:
+                        {
+                            benchmarkCmdBuffer->SetPipelineState(*psoUniforms);
+                            benchmarkCmdBuffer->SetResource(0, *sceneCbuffer);
+                            benchmarkCmdBuffer->SetResource(1, *textures[TextureGrid10x10]);
+                            for_range(draw, numDraws)
+                            {
+                                benchmarkCmdBuffer->SetUniforms(1, &(solidColors[draw % 2]), sizeof(ColorRGBAf));
+                                benchmarkCmdBuffer->DrawIndexed(3, 0);
+                            }
+                        }
+                        break;
+
+                        case StateChangePattern::Resource:
+                        {
+                            benchmarkCmdBuffer->SetPipelineState(*psoCullBack);
+                            for_range(draw, numDraws)
+                            {
+                                benchmarkCmdBuffer->SetResource(0, *sceneCbuffers[draw % 2]);
+                                benchmarkCmdBuffer->DrawIndexed(3, 0);
+                            }
+                        }
+                        break;
+
+                        case StateChangePattern::ResourceHeap:
+                        {
+                            benchmarkCmdBuffer->SetPipelineState(*psoHeap);
+                            for_range(draw, numDraws)
+                            {
+                                benchmarkCmdBuffer->SetResourceHeap(*resourceHeap, draw % 2);
+                                benchmarkCmdBuffer->DrawIndexed(3, 0);
+                            }
+                        }
+                        break;
+
+                        case StateChangePattern::PipelineState:
+                        {
+                            for_range(draw, numDraws)
+                            {
+                                benchmarkCmdBuffer->SetPipelineState(draw % 2 == 0 ? *psoCullBack : *psoCullFront);
+                                benchmarkCmdBuffer->SetResource(0, *sceneCbuffer);
+                                benchmarkCmdBuffer->DrawIndexed(3, 0);
+                            }
+                        }
+                        break;
+                    }
+                }
+                benchmarkCmdBuffer->EndRenderPass();
+            }
+            benchmarkCmdBuffer->End();
+
+            const std::uint64_t t1 = Timer::Tick();
+
+            // Submit command buffer to not accumulate pending work, but don't include it in the measurement
+            cmdQueue->Submit(*benchmarkCmdBuffer);
+            cmdQueue->WaitIdle();
+
+            const double encodeTime = ToMillisecs(t0, t1);
+            minEncodeTime = (run == 0 ? encodeTime : std::min(minEncodeTime, encodeTime));
+        }
+
+        const double nanosecsPerDraw = minEncodeTime * 1000000.0 / static_cast<double>(numDraws);
+        RecordBenchmarkResult(std::string("StateChanges.") + scenario.name, nanosecsPerDraw, "ns/draw");
+    }
+
+    // Release resources
+    renderer->Release(*benchmarkCmdBuffer);
+    renderer->Release(*resourceHeap);
+    renderer->Release(*altSceneCbuffer);
+    renderer->Release(*psoHeap);
+    renderer->Release(*heapLayout);
+    renderer->Release(*psoUniforms);
+    renderer->Release(*uniformsLayout);
+    renderer->Release(*psoCullFront);
+    renderer->Release(*psoCullBack);
+
+    return TestResult::Passed;
+}
+
+
+
+// ================================================================================
+
@@ -0,0 +1,35 @@
+/*
+ * DeclBenchmarks.inl
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+
+/* --- Benchmarks --- */
+
+#ifndef DECL_BENCHMARK
+#   ifdef GATHER_KNOWN_TESTS
+#       define DECL_BENCHMARK(NAME) \
+            knownTests.push_back(#NAME)
+#   else
+#       define DECL_BENCHMARK(NAME) \
+            TestResult Benchmark##NAME()
+#   endif
+#endif
+
+DECL_BENCHMARK( DrawCalls );
+DECL_BENCHMARK( ResourceHeapChurn );
+DECL_BENCHMARK( BufferUpload );
+DECL_BENCHMARK( PipelineCreation );
+DECL_BENCHMARK( MultiThreadedEncoding );
+DECL_BENCHMARK( ImageConversion );
+DECL_BENCHMARK( StateChanges );
+DECL_BENCHMARK( CommandBufferCasts );
+DECL_BENCHMARK( DrawPacked );
+
+#undef DECL_BENCHMARK
+
+
+
+// ================================================================================
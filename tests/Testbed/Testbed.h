@@ -34,6 +34,9 @@ using namespace LLGL;
 #define DEF_RITEST(NAME) \
     TestResult TestbedContext::Test##NAME(const Options& opt)
 
+#define DEF_BENCHMARK(NAME) \
+    TestResult TestbedContext::Benchmark##NAME()
+
 #define CREATE_BUFFER_COND(COND, OBJ, DESC, NAME, INITIAL)              \
     LLGL_MAYBE_UNUSED Buffer* OBJ = nullptr;                            \
     LLGL_MAYBE_UNUSED const char* OBJ##_Name = NAME;                    \
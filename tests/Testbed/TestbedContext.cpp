@@ -308,13 +308,12 @@ unsigned TestbedContext::RunAllTests()
         return failures;
     }
 
-    #define RUN_TEST(TEST)                                                          \
-        if (opt.ContainsTest(#TEST))                                                \
-        {                                                                           \
-            const TestResult result = RunTest(                                      \
-                std::bind(&TestbedContext::Test##TEST, this, std::placeholders::_1) \
-            );                                                                      \
-            RecordTestResult(result, #TEST);                                        \
+    #define RUN_TEST(TEST)                                                                                         \
+        if (opt.ContainsTest(#TEST))                                                                               \
+        {                                                                                                          \
+            auto callback = std::bind(&TestbedContext::Test##TEST, this, std::placeholders::_1);                   \
+            const TestResult result = (opt.perfIterations > 0 ? RunPerfTest(callback, #TEST) : RunTest(callback)); \
+            RecordTestResult(result, #TEST);                                                                       \
         }
 
     #define RUN_C99_TEST(TEST)                          \
@@ -330,24 +329,47 @@ unsigned TestbedContext::RunAllTests()
 
     // Run all resource tests
     RUN_TEST( NativeHandle                );
+    RUN_TEST( AdapterQuery                );
     RUN_TEST( BufferWriteAndRead          );
     RUN_TEST( BufferMap                   );
+    RUN_TEST( BufferMapPersistent         );
+    RUN_TEST( ReadbackRing                );
     RUN_TEST( BufferFill                  );
     RUN_TEST( BufferUpdate                );
     RUN_TEST( BufferCopy                  );
     RUN_TEST( TextureTypes                );
     RUN_TEST( TextureWriteAndRead         );
+    RUN_TEST( TextureWriteAsync           );
+    RUN_TEST( TextureReadAsync            );
+    RUN_TEST( TextureSparse               );
+    RUN_TEST( TextureAliasing             );
     RUN_TEST( TextureCopy                 );
     RUN_TEST( TextureToBufferCopy         );
     RUN_TEST( BufferToTextureCopy         );
+    RUN_TEST( RenderGraph                 );
     RUN_TEST( RenderTargetNoAttachments   );
     RUN_TEST( RenderTarget1Attachment     );
     RUN_TEST( RenderTargetNAttachments    );
+    RUN_TEST( RenderPassClearFolding      );
+    RUN_TEST( SwapChainPresentBatch       );
+    RUN_TEST( MipMapsBatch                );
     RUN_TEST( MipMaps                     );
     RUN_TEST( PipelineCaching             );
+    RUN_TEST( PipelineAsync               );
+    RUN_TEST( PipelineBatch               );
+    RUN_TEST( ShaderBatch                 );
+    RUN_TEST( ResourceBatch               );
+    RUN_TEST( ReleaseInFlight             );
+    RUN_TEST( ConcurrentResourceCreation  );
+    RUN_TEST( DrawSorter                  );
+    RUN_TEST( MeshUtils                   );
+    RUN_TEST( CommandBufferGroup          );
+    RUN_TEST( ShaderReflectionBlob        );
     RUN_TEST( ShaderErrors                );
     RUN_TEST( SamplerBuffer               );
     RUN_TEST( BarrierReadAfterWrite       );
+    RUN_TEST( CommandQueueAsync           );
+    RUN_TEST( FencePolling                );
 
     // Run all rendering tests
     RUN_TEST( DepthBuffer                 );
@@ -357,6 +379,9 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( DualSourceBlending          );
     //RUN_TEST( CommandBufferMultiThreading ); //TODO: this must be rewritten as CommandBuffer constraints are violated in this test
     RUN_TEST( CommandBufferSecondary      );
+    RUN_TEST( CommandBufferRedundancy     );
+    RUN_TEST( ConstantBufferRange         );
+    RUN_TEST( TransientBuffers            );
     RUN_TEST( TriangleStripCutOff         );
     RUN_TEST( TextureViews                );
     RUN_TEST( TextureStrides              );
@@ -369,6 +394,13 @@ unsigned TestbedContext::RunAllTests()
     RUN_TEST( ResourceCopy                );
     RUN_TEST( CombinedTexSamplers         );
 
+    // Release timer queries of performance mode before the renderer is reset
+    if (perfTimerHeap_ != nullptr)
+    {
+        renderer->Release(*perfTimerHeap_);
+        perfTimerHeap_ = nullptr;
+    }
+
     // Reset main renderer and run C99 tests
     // LLGL can't run the same render system in multiple instances (confuses the context management in GL backend)
     renderer.reset();
@@ -376,6 +408,70 @@ unsigned TestbedContext::RunAllTests()
 
     #undef RUN_TEST
 
+    // Write timing results of performance mode and compare them against the baseline of this renderer
+    if (opt.perfIterations > 0)
+    {
+        const std::string resultsFilename = opt.outputDir + moduleName + "/Performance.json";
+        if (!SaveBenchmarkResults(resultsFilename))
+            Log::Errorf("Failed to write performance results: %s\n", resultsFilename.c_str());
+
+        if (!opt.baselineDir.empty())
+            failures += CompareBenchmarkResults(opt.baselineDir + moduleName + "/Performance.json");
+    }
+
+    // Print summary
+    PrintTestSummary(failures);
+
+    return failures;
+}
+
+unsigned TestbedContext::RunAllBenchmarks()
+{
+    // Loading failed if there are already failures
+    if (failures > 0)
+    {
+        Log::Errorf(Log::ColorFlags::StdError, " ==> LOADING FAILED\n", failures);
+        return failures;
+    }
+
+    // Check if there were any unknown benchmarks selected
+    if (!opt.selectedTests.empty())
+    {
+        std::vector<const char*> knownTests;
+        #define GATHER_KNOWN_TESTS
+        #include "Benchmarks/DeclBenchmarks.inl"
+        #undef GATHER_KNOWN_TESTS
+        PrintUnknownTests(opt.selectedTests, knownTests);
+    }
+
+    #define RUN_BENCHMARK(NAME)                                 \
+        if (opt.ContainsTest(#NAME))                            \
+        {                                                       \
+            cmdQueue->WaitIdle();                               \
+            const TestResult result = Benchmark##NAME();        \
+            RecordTestResult(result, #NAME);                    \
+        }
+
+    RUN_BENCHMARK( DrawCalls             );
+    RUN_BENCHMARK( ResourceHeapChurn     );
+    RUN_BENCHMARK( BufferUpload          );
+    RUN_BENCHMARK( PipelineCreation      );
+    RUN_BENCHMARK( MultiThreadedEncoding );
+    RUN_BENCHMARK( ImageConversion       );
+    RUN_BENCHMARK( StateChanges          );
+    RUN_BENCHMARK( CommandBufferCasts    );
+    RUN_BENCHMARK( DrawPacked            );
+
+    #undef RUN_BENCHMARK
+
+    // Write results and compare them against the baseline
+    const std::string resultsFilename = opt.outputDir + moduleName + "/Benchmarks.json";
+    if (!SaveBenchmarkResults(resultsFilename))
+        Log::Errorf("Failed to write benchmark results: %s\n", resultsFilename.c_str());
+
+    if (!opt.baselineDir.empty())
+        failures += CompareBenchmarkResults(opt.baselineDir + moduleName + "/Benchmarks.json");
+
     // Print summary
     PrintTestSummary(failures);
 
@@ -417,6 +513,12 @@ unsigned TestbedContext::RunRendererIndependentTests(int argc, char* argv[])
     RUN_TEST( ParseUtil );
     RUN_TEST( ImageConversions );
     RUN_TEST( ImageStrides );
+    RUN_TEST( ImageBlockCompression );
+    RUN_TEST( ImageMipChain );
+    RUN_TEST( ImageResample );
+    RUN_TEST( TextureContainer );
+    RUN_TEST( ThreadPool );
+    RUN_TEST( DbgTransientBufferFlags );
 
     #undef RUN_TEST
 
@@ -445,6 +547,71 @@ TestResult TestbedContext::RunTest(const std::function<TestResult(unsigned)>& ca
     return result;
 }
 
+TestResult TestbedContext::RunPerfTest(const std::function<TestResult(unsigned)>& callback, const std::string& name)
+{
+    // Run test once to validate its results and to warm up all caches before any measurements are taken
+    TestResult result = RunTest(callback);
+    if (result != TestResult::Passed)
+        return result;
+
+    // Create timestamp queries to measure the GPU time span of each iteration
+    if (perfTimerHeap_ == nullptr && caps.features.hasTimestampQueries)
+    {
+        QueryHeapDescriptor queryHeapDesc;
+        {
+            queryHeapDesc.debugName     = "PerfTimer";
+            queryHeapDesc.type          = QueryType::Timestamp;
+            queryHeapDesc.numQueries    = 2;
+        }
+        perfTimerHeap_ = renderer->CreateQueryHeap(queryHeapDesc);
+    }
+
+    auto WriteTimestamp = [this](std::uint32_t query)
+    {
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->EndQuery(*perfTimerHeap_, query);
+        }
+        cmdBuffer->End();
+    };
+
+    std::vector<double> cpuTimes, gpuTimes;
+    cpuTimes.reserve(opt.perfIterations);
+    gpuTimes.reserve(opt.perfIterations);
+
+    for_range(iteration, opt.perfIterations)
+    {
+        // Start each iteration with an idle GPU, so the timestamps only enclose the work of this iteration
+        cmdQueue->WaitIdle();
+
+        if (perfTimerHeap_ != nullptr)
+            WriteTimestamp(0);
+
+        const std::uint64_t startTick = Timer::Tick();
+        result = RunTest(callback);
+        const std::uint64_t endTick = Timer::Tick();
+
+        if (perfTimerHeap_ != nullptr)
+            WriteTimestamp(1);
+
+        if (result != TestResult::Passed)
+            return result;
+
+        cpuTimes.push_back(ToMillisecs(startTick, endTick));
+
+        // Timestamps are specified in nanoseconds
+        std::uint64_t timestamps[2] = {};
+        if (perfTimerHeap_ != nullptr && QueryResultsWithTimeout(*perfTimerHeap_, 0, 2, timestamps, sizeof(timestamps)) && timestamps[1] >= timestamps[0])
+            gpuTimes.push_back(static_cast<double>(timestamps[1] - timestamps[0]) / 1000000.0);
+    }
+
+    RecordPerfResult(name + ".CPU", cpuTimes);
+    if (!gpuTimes.empty())
+        RecordPerfResult(name + ".GPU", gpuTimes);
+
+    return result;
+}
+
 TestResult TestbedContext::CreateBuffer(
     const BufferDescriptor& desc,
     const char*             name,
@@ -858,6 +1025,23 @@ TestbedContext::Options TestbedContext::ParseOptions(int argc, char* argv[])
     opt.sanityCheck     = (HasProgramArgument(argc, argv, "-s") || HasProgramArgument(argc, argv, "--sanity-check"));
     opt.showTiming      = (HasProgramArgument(argc, argv, "-t") || HasProgramArgument(argc, argv, "--timing"));
     opt.fastTest        = (HasProgramArgument(argc, argv, "-f") || HasProgramArgument(argc, argv, "--fast"));
+
+    const char* benchmarkLabel = "";
+    opt.benchmark       = HasProgramArgument(argc, argv, "--benchmark", &benchmarkLabel);
+    opt.benchmarkLabel  = benchmarkLabel;
+
+    const char* baselineDir = nullptr;
+    if (HasProgramArgument(argc, argv, "--baseline", &baselineDir) && *baselineDir != '\0')
+        opt.baselineDir = SanitizePath(baselineDir);
+
+    const char* regressionThreshold = nullptr;
+    if (HasProgramArgument(argc, argv, "--regression", &regressionThreshold) && *regressionThreshold != '\0')
+        opt.regressionThreshold = std::atof(regressionThreshold) / 100.0;
+
+    const char* perfIterations = nullptr;
+    if (HasProgramArgument(argc, argv, "--perf", &perfIterations))
+        opt.perfIterations = (*perfIterations != '\0' ? static_cast<unsigned>(std::max(1, std::atoi(perfIterations))) : 10u);
+
     opt.resolution      = { g_testbedWinSize[0], g_testbedWinSize[1] };
     opt.selectedTests   = FindSelectedTests(argc, argv);
     return opt;
@@ -1757,6 +1941,149 @@ void TestbedContext::RecordTestResult(TestResult result, const char* name)
         ++failures;
 }
 
+void TestbedContext::RecordBenchmarkResult(const std::string& name, double value, const char* unit, bool higherIsBetter)
+{
+    Log::Printf("  %-40s %12.3f %s\n", name.c_str(), value, unit);
+    BenchmarkResult result;
+    {
+        result.name             = name;
+        result.value            = value;
+        result.unit             = unit;
+        result.higherIsBetter   = higherIsBetter;
+    }
+    benchmarkResults_.push_back(result);
+}
+
+void TestbedContext::RecordPerfResult(const std::string& name, std::vector<double>& samples)
+{
+    if (samples.empty())
+        return;
+
+    // Record median instead of mean, so single outliers such as a late swap-chain present don't dominate the result
+    std::sort(samples.begin(), samples.end());
+    RecordBenchmarkResult(name, samples[samples.size()/2], "ms");
+
+    if (opt.verbose && samples.size() > 1)
+    {
+        // Print distribution of samples between the fastest and slowest iteration
+        const double minTime    = samples.front();
+        const double timeRange  = std::max(samples.back() - minTime, 0.000001);
+
+        Histogram histogram;
+        for (double sample : samples)
+            histogram.Add(static_cast<int>((sample - minTime) / timeRange * 255.0));
+
+        char minLabel[32], maxLabel[32];
+        ::snprintf(minLabel, sizeof(minLabel), "%.3f", samples.front());
+        ::snprintf(maxLabel, sizeof(maxLabel), "%.3fms", samples.back());
+        histogram.Print(5, minLabel, maxLabel);
+    }
+}
+
+bool TestbedContext::SaveBenchmarkResults(const std::string& filename) const
+{
+    std::ofstream file{ filename };
+    if (!file.good())
+        return false;
+
+    // Write one result per line, so the file can be diffed and parsed line by line by CompareBenchmarkResults
+    file << "{\n";
+    file << "  \"module\": \"" << moduleName << "\",\n";
+    file << "  \"renderer\": \"" << rendererInfo.rendererName.c_str() << "\",\n";
+    file << "  \"device\": \"" << rendererInfo.deviceName.c_str() << "\",\n";
+    file << "  \"label\": \"" << opt.benchmarkLabel << "\",\n";
+    file << "  \"fast\": " << (opt.fastTest ? "true" : "false") << ",\n";
+    file << "  \"results\": [\n";
+    for (std::size_t i = 0; i < benchmarkResults_.size(); ++i)
+    {
+        const BenchmarkResult& result = benchmarkResults_[i];
+        file << "    { \"name\": \"" << result.name << "\", \"value\": " << result.value
+             << ", \"unit\": \"" << result.unit << "\", \"higherIsBetter\": " << (result.higherIsBetter ? "true" : "false") << " }"
+             << (i + 1 < benchmarkResults_.size() ? ",\n" : "\n");
+    }
+    file << "  ]\n";
+    file << "}\n";
+
+    return true;
+}
+
+unsigned TestbedContext::CompareBenchmarkResults(const std::string& filename) const
+{
+    std::ifstream file{ filename };
+    if (!file.good())
+    {
+        Log::Errorf("Failed to read benchmark baseline: %s\n", filename.c_str());
+        return 0;
+    }
+
+    // Parse baseline results line by line as they are written by SaveBenchmarkResults
+    auto ParseStringField = [](const std::string& line, const char* field, std::string& outValue) -> bool
+    {
+        const std::string key = std::string("\"") + field + "\": \"";
+        const std::size_t start = line.find(key);
+        if (start == std::string::npos)
+            return false;
+        const std::size_t end = line.find('\"', start + key.size());
+        if (end == std::string::npos)
+            return false;
+        outValue = line.substr(start + key.size(), end - start - key.size());
+        return true;
+    };
+
+    auto ParseNumberField = [](const std::string& line, const char* field, double& outValue) -> bool
+    {
+        const std::string key = std::string("\"") + field + "\": ";
+        const std::size_t start = line.find(key);
+        if (start == std::string::npos)
+            return false;
+        outValue = std::atof(line.c_str() + start + key.size());
+        return true;
+    };
+
+    unsigned regressions = 0;
+
+    Log::Printf("Compare against baseline: %s\n", filename.c_str());
+
+    for (std::string line; std::getline(file, line);)
+    {
+        std::string name;
+        double baselineValue = 0.0;
+        if (!ParseStringField(line, "name", name) || !ParseNumberField(line, "value", baselineValue))
+            continue;
+
+        auto it = std::find_if(
+            benchmarkResults_.begin(), benchmarkResults_.end(),
+            [&name](const BenchmarkResult& result) -> bool
+            {
+                return (result.name == name);
+            }
+        );
+        if (it == benchmarkResults_.end() || baselineValue <= 0.0)
+            continue;
+
+        // Relative change where positive values denote an improvement
+        const double change = (it->higherIsBetter ? (it->value - baselineValue) : (baselineValue - it->value)) / baselineValue;
+        if (change < -opt.regressionThreshold)
+        {
+            Log::Errorf(
+                Log::ColorFlags::StdError,
+                "  REGRESSION %-29s %12.3f %s (baseline %.3f %s, %+.1f%%)\n",
+                name.c_str(), it->value, it->unit, baselineValue, it->unit, change * 100.0
+            );
+            ++regressions;
+        }
+        else if (opt.verbose || change > opt.regressionThreshold)
+        {
+            Log::Printf(
+                "  %-40s %12.3f %s (baseline %.3f %s, %+.1f%%)\n",
+                name.c_str(), it->value, it->unit, baselineValue, it->unit, change * 100.0
+            );
+        }
+    }
+
+    return regressions;
+}
+
 bool TestbedContext::QueryResultsWithTimeout(
     LLGL::QueryHeap&    queryHeap,
     std::uint32_t       firstQuery,
@@ -1838,7 +2165,7 @@ void TestbedContext::Histogram::Add(int val)
     diffRangeCounts[val]++;
 }
 
-void TestbedContext::Histogram::Print(unsigned rows) const
+void TestbedContext::Histogram::Print(unsigned rows, const char* minLabel, const char* maxLabel) const
 {
     if (rows < 2)
         return;
@@ -1893,7 +2220,9 @@ void TestbedContext::Histogram::Print(unsigned rows) const
     // Print diff ranges
     static_assert(rangeSize > 3, "Histogram::rangeSize must be greater than 3");
     Log::Printf("%s%s --%s\n", indent, blankCountStr.c_str(), std::string(rangeSize, '-').c_str());
-    Log::Printf("%s%s   1%sFF\n", indent, blankCountStr.c_str(), std::string(rangeSize - 3, ' ').c_str());
+    const std::size_t labelsLen = ::strlen(minLabel) + ::strlen(maxLabel);
+    const std::size_t labelsGap = (labelsLen < rangeSize ? rangeSize - labelsLen : 1);
+    Log::Printf("%s%s   %s%s%s\n", indent, blankCountStr.c_str(), minLabel, std::string(labelsGap, ' ').c_str(), maxLabel);
 }
 
 
@@ -45,6 +45,9 @@ class TestbedContext
         // Runs all tests and returns the number of failed ones. If all succeeded, the return value is 0.
         unsigned RunAllTests();
 
+        // Runs all benchmarks, writes their results to the output directory, and returns the number of failed benchmarks and regressions against the baseline.
+        unsigned RunAllBenchmarks();
+
         // Returns true if this context has a valid renderer.
         inline bool IsValid() const
         {
@@ -61,6 +64,9 @@ class TestbedContext
 
         TestResult RunTest(const std::function<TestResult(unsigned)>& callback);
 
+        // Runs the test once for validation and then for the number of iterations in performance mode and records the median CPU and GPU times.
+        TestResult RunPerfTest(const std::function<TestResult(unsigned)>& callback, const std::string& name);
+
         TestResult CreateBuffer(
             const LLGL::BufferDescriptor&   desc,
             const char*                     name,
@@ -219,6 +225,11 @@ class TestbedContext
             bool                        sanityCheck = false; // This is 'very verbose' and dumps out all intermediate data on successful tests
             bool                        showTiming  = false;
             bool                        fastTest    = false; // Skip slow buffer/texture creations to speed up test run
+            bool                        benchmark   = false; // Run benchmarks instead of unit tests
+            std::string                 benchmarkLabel;      // Optional label that is written to the benchmark results, e.g. a commit hash
+            std::string                 baselineDir;         // Directory of previous benchmark results to compare against
+            double                      regressionThreshold = 0.1; // Relative difference to the baseline that is reported as regression
+            unsigned                    perfIterations = 0;  // Number of measured iterations per test in performance mode, or 0 if disabled
             LLGL::Extent2D              resolution;
             std::vector<std::string>    selectedTests;
 
@@ -270,7 +281,7 @@ class TestbedContext
 
             void Reset();
             void Add(int val);
-            void Print(unsigned rows = 10) const;
+            void Print(unsigned rows = 10, const char* minLabel = "1", const char* maxLabel = "FF") const;
 
             unsigned diffRangeCounts[rangeSize] = {};
         };
@@ -303,6 +314,14 @@ class TestbedContext
             unsigned    count       = 0; // Number of different pixels;
         };
 
+        struct BenchmarkResult
+        {
+            std::string name;
+            double      value           = 0.0;
+            const char* unit            = "";
+            bool        higherIsBetter  = false;
+        };
+
         struct SceneConstants
         {
             Gs::Matrix4f vpMatrix;
@@ -343,6 +362,7 @@ class TestbedContext
     private:
 
         #include "UnitTests/DeclTests.inl"
+        #include "Benchmarks/DeclBenchmarks.inl"
 
     private:
 
@@ -400,6 +420,18 @@ class TestbedContext
 
         void RecordTestResult(TestResult result, const char* name);
 
+        // Records the result of a benchmark scenario, e.g. RecordBenchmarkResult("DrawCalls.10k.Encode", 1.5, "ms").
+        void RecordBenchmarkResult(const std::string& name, double value, const char* unit, bool higherIsBetter = false);
+
+        // Records the median of the specified time samples (in milliseconds) and prints their distribution in verbose mode.
+        void RecordPerfResult(const std::string& name, std::vector<double>& samples);
+
+        // Writes all benchmark results as JSON file, one result per line.
+        bool SaveBenchmarkResults(const std::string& filename) const;
+
+        // Compares all benchmark results against the specified JSON file that was written by SaveBenchmarkResults. Returns the number of regressions.
+        unsigned CompareBenchmarkResults(const std::string& filename) const;
+
         bool QueryResultsWithTimeout(
             LLGL::QueryHeap&    queryHeap,
             std::uint32_t       firstQuery,
@@ -410,10 +442,12 @@ class TestbedContext
 
     private:
 
-        bool                    loadingShadersFailed_ = false;
-        Histogram               histogram_;
-        LLGL::Report            report_;
-        LLGL::Log::LogHandle    reportHandle_;
+        bool                            loadingShadersFailed_ = false;
+        Histogram                       histogram_;
+        std::vector<BenchmarkResult>    benchmarkResults_;
+        LLGL::QueryHeap*                perfTimerHeap_        = nullptr;
+        LLGL::Report                    report_;
+        LLGL::Log::LogHandle            reportHandle_;
 
 };
 
@@ -20,6 +20,8 @@ using namespace LLGL;
 
 static const char* k_knownSingleCharArgs = "bcdfghpstv";
 
+bool HasProgramArgument(int argc, char* argv[], const char* search, const char** outValue = nullptr);
+
 static unsigned RunRendererIndependentTests(int argc, char* argv[])
 {
     Log::Printf("Run renderer independent tests\n");
@@ -41,7 +43,9 @@ static unsigned RunTestbedForRenderer(const char* moduleName, int version, int a
     if (!context.IsValid())
         return 1;
 
-    unsigned failures = context.RunAllTests();
+    const char* benchmarkLabel = nullptr;
+    const bool isBenchmark = HasProgramArgument(argc, argv, "--benchmark", &benchmarkLabel);
+    unsigned failures = (isBenchmark ? context.RunAllBenchmarks() : context.RunAllTests());
     TestbedContext::PrintSeparator();
     Log::Printf("\n");
     return failures;
@@ -87,7 +91,7 @@ static ModuleAndVersion GetRendererModule(const std::string& name)
 }
 
 // Returns true of the specified list of program arguments contains the search string
-bool HasProgramArgument(int argc, char* argv[], const char* search, const char** outValue = nullptr)
+bool HasProgramArgument(int argc, char* argv[], const char* search, const char** outValue)
 {
     const std::size_t searchLen = ::strlen(search);
 
@@ -185,6 +189,10 @@ static void PrintHelpDocs()
         "  -s, --santiy-check ................. Print some test results even on success\n"
         "  -t, --timing ....................... Print timing results\n"
         "  -v, --verbose ...................... Print more information\n"
+        "  --benchmark [=LABEL] ............... Run benchmarks instead of tests and write results to Output/MODULE/Benchmarks.json\n"
+        "  --perf [=N] ........................ Run each test N times (default is 10) and write median CPU/GPU times to Output/MODULE/Performance.json\n"
+        "  --baseline=DIR ..................... Compare benchmark or performance results against DIR/MODULE/Benchmarks.json or DIR/MODULE/Performance.json\n"
+        "  --regression=PERCENT ............... Threshold for benchmark and performance regressions against the baseline (default is 10)\n"
         "  --amd .............................. Prefer AMD device\n"
         "  --intel ............................ Prefer Intel device\n"
         "  --nvidia ........................... Prefer NVIDIA device\n"
@@ -239,9 +247,14 @@ static int GuardedMain(int argc, char* argv[])
 
     unsigned modulesWithFailedTests = 0;
 
-    // Run renderer independent tests
-    if (RunRendererIndependentTests(argc, argv) != 0)
-        ++modulesWithFailedTests;
+    // Run renderer independent tests; benchmarks are only run per renderer
+    const char* benchmarkLabel = nullptr;
+    const bool isBenchmark = HasProgramArgument(argc, argv, "--benchmark", &benchmarkLabel);
+    if (!isBenchmark)
+    {
+        if (RunRendererIndependentTests(argc, argv) != 0)
+            ++modulesWithFailedTests;
+    }
 
     // Run renderer specific tests
     for (const ModuleAndVersion& module : enabledModules)
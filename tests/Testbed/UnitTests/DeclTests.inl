@@ -26,6 +26,12 @@ DECL_RITEST( ContainerStringOperators );
 DECL_RITEST( ParseUtil );
 DECL_RITEST( ImageConversions );
 DECL_RITEST( ImageStrides );
+DECL_RITEST( ImageBlockCompression );
+DECL_RITEST( ImageMipChain );
+DECL_RITEST( ImageResample );
+DECL_RITEST( TextureContainer );
+DECL_RITEST( ThreadPool );
+DECL_RITEST( DbgTransientBufferFlags );
 
 #undef DECL_RITEST
 
@@ -46,10 +52,15 @@ DECL_TEST( CommandBufferSubmit );
 DECL_TEST( CommandBufferEncode );
 DECL_TEST( CommandBufferSecondary );
 DECL_TEST( CommandBufferMultiThreading );
+DECL_TEST( CommandBufferRedundancy );
+DECL_TEST( ConstantBufferRange );
+DECL_TEST( TransientBuffers );
 
 // Resource tests
 DECL_TEST( BufferWriteAndRead );
 DECL_TEST( BufferMap );
+DECL_TEST( BufferMapPersistent );
+DECL_TEST( ReadbackRing );
 DECL_TEST( BufferFill );
 DECL_TEST( BufferUpdate );
 DECL_TEST( BufferCopy );
@@ -57,16 +68,37 @@ DECL_TEST( BufferToTextureCopy );
 DECL_TEST( TextureCopy );
 DECL_TEST( TextureToBufferCopy );
 DECL_TEST( TextureWriteAndRead );
+DECL_TEST( TextureWriteAsync );
+DECL_TEST( TextureReadAsync );
+DECL_TEST( TextureSparse );
+DECL_TEST( TextureAliasing );
+DECL_TEST( RenderGraph );
 DECL_TEST( TextureTypes );
 DECL_TEST( RenderTargetNoAttachments );
 DECL_TEST( RenderTarget1Attachment );
 DECL_TEST( RenderTargetNAttachments );
+DECL_TEST( RenderPassClearFolding );
+DECL_TEST( SwapChainPresentBatch );
+DECL_TEST( MipMapsBatch );
 DECL_TEST( MipMaps );
 DECL_TEST( PipelineCaching );
+DECL_TEST( PipelineAsync );
+DECL_TEST( PipelineBatch );
+DECL_TEST( ShaderBatch );
+DECL_TEST( ResourceBatch );
+DECL_TEST( ReleaseInFlight );
+DECL_TEST( ConcurrentResourceCreation );
+DECL_TEST( DrawSorter );
+DECL_TEST( MeshUtils );
+DECL_TEST( CommandBufferGroup );
+DECL_TEST( ShaderReflectionBlob );
 DECL_TEST( ShaderErrors );
 DECL_TEST( SamplerBuffer );
 DECL_TEST( NativeHandle );
+DECL_TEST( AdapterQuery );
 DECL_TEST( BarrierReadAfterWrite );
+DECL_TEST( CommandQueueAsync );
+DECL_TEST( FencePolling );
 
 // Rendering tests
 DECL_TEST( DepthBuffer );
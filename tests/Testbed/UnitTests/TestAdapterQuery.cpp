@@ -0,0 +1,59 @@
+/*
+ * TestAdapterQuery.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <vector>
+#include <inttypes.h>
+
+
+/*
+Queries all video adapters of the backend and validates that exactly one of them is the active adapter.
+Also validates that the number of adapters is independent of the size of the output array.
+*/
+DEF_TEST( AdapterQuery )
+{
+    const std::uint32_t numAdapters = renderer->QueryAdapters(nullptr, 0);
+    if (numAdapters == 0)
+    {
+        Log::Errorf("Backend reported no video adapters\n");
+        return TestResult::FailedErrors;
+    }
+
+    std::vector<AdapterInfo> adapters;
+    adapters.resize(numAdapters);
+    if (renderer->QueryAdapters(adapters.data(), numAdapters) != numAdapters)
+    {
+        Log::Errorf("Mismatch between number of video adapters in consecutive queries\n");
+        return TestResult::FailedMismatch;
+    }
+
+    std::uint32_t numActiveAdapters = 0;
+    for_range(i, numAdapters)
+    {
+        const AdapterInfo& adapter = adapters[i];
+        if (opt.verbose)
+        {
+            Log::Printf(
+                "Adapter[%u]: \"%s\" (vendor 0x%04X, device 0x%04X, video memory %" PRIu64 " MB, LUID 0x%016" PRIX64 ")%s\n",
+                i, adapter.name.c_str(), adapter.vendorID, adapter.deviceID, (adapter.videoMemory / (1024*1024)), adapter.luid,
+                (adapter.isActive ? " [active]" : "")
+            );
+        }
+        if (adapter.isActive)
+            ++numActiveAdapters;
+    }
+
+    if (numActiveAdapters != 1)
+    {
+        Log::Errorf("Expected exactly one active video adapter, but %u were reported\n", numActiveAdapters);
+        return TestResult::FailedMismatch;
+    }
+
+    return TestResult::Passed;
+}
+
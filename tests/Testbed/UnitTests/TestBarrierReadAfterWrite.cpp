@@ -13,6 +13,7 @@
 This test initializes only the first element of one or two buffers and then propagates this value to each next element.
 The propagation is done via a compute shader that reads the value from a previous Dispatch() invocation and writes it to the new location.
 The test must validate that the correct memory barriers are inserted between these invocations (e.g. UAV barriers in D3D12).
+The first frame uses implicit barriers, the second frame explicit barriers, and the third frame split barriers.
 */
 DEF_TEST( BarrierReadAfterWrite )
 {
@@ -37,7 +38,7 @@ DEF_TEST( BarrierReadAfterWrite )
         }
     }
 
-    constexpr unsigned      numFrames       = 2;
+    constexpr unsigned      numFrames       = 3;
     constexpr std::uint32_t numIterations   = 64;
     constexpr std::uint32_t propagateValue  = 123456789;
 
@@ -109,7 +110,7 @@ DEF_TEST( BarrierReadAfterWrite )
 
     ComputePipelineDescriptor psoDesc;
     {
-        psoDesc.debugName       = (frame == 0 ? "ReadAfterWrite.PSO[ImplicitBarriers]" : "ReadAfterWrite.PSO[ExplicitBarriers]");
+        psoDesc.debugName       = (frame == 0 ? "ReadAfterWrite.PSO[ImplicitBarriers]" : frame == 1 ? "ReadAfterWrite.PSO[ExplicitBarriers]" : "ReadAfterWrite.PSO[SplitBarriers]");
         psoDesc.pipelineLayout  = psoLayout;
         psoDesc.computeShader   = shaders[CSReadAfterWrite];
     }
@@ -157,21 +158,31 @@ DEF_TEST( BarrierReadAfterWrite )
         cmdBuffer->SetResource(2, *tex1);
         cmdBuffer->SetResource(3, *tex2);
 
+        Buffer* buffers[] = { buf1, buf2 };
+        Texture* textures[] = { tex1, tex2 };
+
         for_range(iter, numIterations)
         {
             uniforms.readPos = iter;
             uniforms.writePos = iter + 1;
             cmdBuffer->SetUniforms(0, &uniforms, sizeof(uniforms));
 
+            // End split barrier from previous invocation right before the results are read
+            if (frame == 2 && iter > 0)
+                cmdBuffer->EndResourceBarrier(2, buffers, 2, textures);
+
             cmdBuffer->Dispatch(1, 1, 1);
 
-            if (frame > 0)
+            if (frame == 1)
             {
                 // Use explicit barriers
-                Buffer* buffers[] = { buf1, buf2 };
-                Texture* textures[] = { tex1, tex2 };
                 cmdBuffer->ResourceBarrier(2, buffers, 2, textures);
             }
+            else if (frame == 2 && iter + 1 < numIterations)
+            {
+                // Use split barriers and begin the transition right after the results are written
+                cmdBuffer->BeginResourceBarrier(2, buffers, 2, textures);
+            }
         }
     }
     cmdBuffer->End();
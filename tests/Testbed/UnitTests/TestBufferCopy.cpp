@@ -87,6 +87,36 @@ DEF_TEST( BufferCopy )
         }
     }
 
+    // Copy buf1 into buf3 with multiple regions that reverse the order of all 32-bit words
+    const BufferCopyRegion buf3Regions[4] =
+    {
+        BufferCopyRegion{  0, 12, 4 },
+        BufferCopyRegion{  4,  8, 4 },
+        BufferCopyRegion{  8,  4, 4 },
+        BufferCopyRegion{ 12,  0, 4 },
+    };
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->CopyBufferRegions(*buf3, *buf1, 4, buf3Regions);
+    }
+    cmdBuffer->End();
+
+    // Read buf3 feedback data of multi-region copy
+    const std::uint32_t buf3Expected[4] = { buf1Initial[3], buf1Initial[2], buf1Initial[1], buf1Initial[0] };
+
+    ::memset(buf3DataFeedback, 0, sizeof(buf3DataFeedback));
+    renderer->ReadBuffer(*buf3, 0, buf3DataFeedback, sizeof(buf3DataFeedback));
+    if (::memcmp(buf3DataFeedback, buf3Expected, sizeof(buf3Expected)) != 0)
+    {
+        Log::Errorf(
+            "Mismatch between data of buffer 3 feedback data after multi-region copy [0x%08X, 0x%08X, 0x%08X, 0x%08X] and expected data [0x%08X, 0x%08X, 0x%08X, 0x%08X]\n",
+            buf3DataFeedback[0], buf3DataFeedback[1], buf3DataFeedback[2], buf3DataFeedback[3],
+            buf3Expected[0], buf3Expected[1], buf3Expected[2], buf3Expected[3]
+        );
+        return TestResult::FailedMismatch;
+    }
+
     // Delete old buffers
     renderer->Release(*buf1);
     renderer->Release(*buf2);
@@ -0,0 +1,110 @@
+/*
+ * TestBufferMapPersistent.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+/*
+Writes into a persistently mapped buffer, flushes the written range, and copies the buffer on the GPU while it is still mapped.
+The copy must observe all flushed writes, and MapBuffer must return the same memory for subsequent mappings.
+*/
+DEF_TEST( BufferMapPersistent )
+{
+    if (!caps.features.hasPersistentMapping)
+        return TestResult::Skipped;
+
+    constexpr std::uint64_t bufferSize  = 256;
+    constexpr std::size_t   numValues   = static_cast<std::size_t>(bufferSize / sizeof(std::uint32_t));
+
+    BufferDescriptor srcBufDesc;
+    {
+        srcBufDesc.size             = bufferSize;
+        srcBufDesc.bindFlags        = BindFlags::CopySrc;
+        srcBufDesc.cpuAccessFlags   = CPUAccessFlags::ReadWrite;
+        srcBufDesc.miscFlags        = MiscFlags::PersistentMapping;
+    }
+    CREATE_BUFFER(srcBuf, srcBufDesc, "srcBuf{size=256,rw,persistent}", nullptr);
+
+    BufferDescriptor dstBufDesc;
+    {
+        dstBufDesc.size             = bufferSize;
+        dstBufDesc.bindFlags        = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(dstBuf, dstBufDesc, "dstBuf{size=256}", nullptr);
+
+    TestResult result = TestResult::Passed;
+
+    // Map source buffer and keep it mapped while the GPU copies from it
+    auto* srcBufData = reinterpret_cast<std::uint32_t*>(renderer->MapBuffer(*srcBuf, CPUAccess::ReadWrite));
+    if (srcBufData == nullptr)
+    {
+        Log::Errorf("Failed to map persistent buffer into CPU memory space\n");
+        return TestResult::FailedErrors;
+    }
+
+    for_range(frame, 2u)
+    {
+        // Write new values into mapped memory and flush the written range
+        std::uint32_t expectedData[numValues];
+        for_range(i, numValues)
+            expectedData[i] = (0xA0000000u | (frame << 16) | static_cast<std::uint32_t>(i));
+
+        ::memcpy(srcBufData, expectedData, sizeof(expectedData));
+        renderer->FlushMappedRange(*srcBuf, 0, bufferSize);
+
+        // Copy mapped buffer on the GPU
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->CopyBuffer(*dstBuf, 0, *srcBuf, 0, bufferSize);
+        }
+        cmdBuffer->End();
+
+        // Read result from destination buffer
+        std::uint32_t dstBufData[numValues] = {};
+        renderer->ReadBuffer(*dstBuf, 0, dstBufData, sizeof(dstBufData));
+
+        for_range(i, numValues)
+        {
+            if (dstBufData[i] != expectedData[i])
+            {
+                Log::Errorf(
+                    "Mismatch between destination buffer data [%zu] = 0x%08X and persistently mapped data 0x%08X in frame %u\n",
+                    i, dstBufData[i], expectedData[i], frame
+                );
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+    }
+
+    renderer->UnmapBuffer(*srcBuf);
+
+    // Persistently mapped memory must not move between mappings
+    if (void* srcBufDataRemapped = renderer->MapBuffer(*srcBuf, CPUAccess::ReadOnly))
+    {
+        if (srcBufDataRemapped != srcBufData)
+        {
+            Log::Errorf("Mismatch between persistently mapped memory addresses after re-mapping buffer\n");
+            result = TestResult::FailedMismatch;
+        }
+        renderer->UnmapBuffer(*srcBuf);
+    }
+    else
+    {
+        Log::Errorf("Failed to re-map persistent buffer into CPU memory space\n");
+        result = TestResult::FailedErrors;
+    }
+
+    // Release resources
+    renderer->Release(*srcBuf);
+    renderer->Release(*dstBuf);
+
+    return result;
+}
+
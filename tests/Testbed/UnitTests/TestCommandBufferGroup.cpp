@@ -0,0 +1,99 @@
+/*
+ * TestCommandBufferGroup.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/CommandBufferGroup.h>
+#include <LLGL/Utils/ForRange.h>
+#include <thread>
+#include <vector>
+
+
+/*
+Records command buffers of a group on multiple threads, where each command buffer overwrites the same buffer range with a different value.
+The sort keys are assigned in reverse order of the threads, so the value of the first thread must be the last one written after the group is submitted.
+*/
+DEF_TEST( CommandBufferGroup )
+{
+    constexpr unsigned numThreads           = 4;
+    constexpr unsigned numBuffersPerThread  = 4;
+    constexpr unsigned numCommandBuffers    = numThreads * numBuffersPerThread;
+
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.size        = sizeof(std::uint32_t);
+        bufDesc.bindFlags   = BindFlags::CopySrc | BindFlags::CopyDst;
+    }
+    const std::uint32_t initialValue = 0;
+    CREATE_BUFFER(dstBuf, bufDesc, "dstBuf{size=4,src,dst}", &initialValue);
+
+    CommandBufferGroupDescriptor groupDesc;
+    {
+        groupDesc.capacity = numCommandBuffers;
+    }
+    CommandBufferGroup group{ *renderer, groupDesc };
+
+    // Record command buffers on worker threads; the command buffer with the highest sort key writes the value of (thread 0, buffer 0)
+    auto RecordCommandBuffers = [&](unsigned threadIndex)
+    {
+        for_range(i, numBuffersPerThread)
+        {
+            const std::uint32_t index = threadIndex * numBuffersPerThread + i;
+            if (CommandBuffer* groupCmdBuffer = group.Begin(numCommandBuffers - index))
+            {
+                const std::uint32_t value = 0xC0DE0000u | index;
+                groupCmdBuffer->UpdateBuffer(*dstBuf, 0, &value, sizeof(value));
+                groupCmdBuffer->End();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads);
+    for_range(threadIndex, numThreads)
+        workers.emplace_back(RecordCommandBuffers, threadIndex);
+    for (std::thread& worker : workers)
+        worker.join();
+
+    TestResult result = TestResult::Passed;
+
+    if (group.GetNumClaimed() != numCommandBuffers)
+    {
+        Log::Errorf("Mismatch between number of claimed command buffers (%u) and expected number (%u)\n", group.GetNumClaimed(), numCommandBuffers);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Exhausted group must not hand out further command buffers
+    if (group.Begin(0) != nullptr)
+    {
+        Log::Errorf("Command buffer group returned a command buffer beyond its capacity of %u\n", group.GetCapacity());
+        result = TestResult::FailedErrors;
+    }
+
+    group.Submit();
+    cmdQueue->WaitIdle();
+
+    std::uint32_t dstValue = 0;
+    renderer->ReadBuffer(*dstBuf, 0, &dstValue, sizeof(dstValue));
+
+    const std::uint32_t expectedValue = 0xC0DE0000u;
+    if (dstValue != expectedValue)
+    {
+        Log::Errorf("Mismatch between buffer value after submitting command buffer group: Expected 0x%08X, but got 0x%08X\n", expectedValue, dstValue);
+        result = TestResult::FailedMismatch;
+    }
+
+    if (group.GetNumClaimed() != 0)
+    {
+        Log::Errorf("Command buffer group still has %u claimed command buffers after submission\n", group.GetNumClaimed());
+        result = TestResult::FailedErrors;
+    }
+
+    renderer->Release(*dstBuf);
+
+    return result;
+}
+
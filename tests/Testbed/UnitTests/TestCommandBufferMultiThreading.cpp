@@ -221,11 +221,16 @@ DEF_TEST( CommandBufferMultiThreading )
 
     const std::uint64_t endEncodingTime = Timer::Tick();
 
-    // Submit all encoded command buffers
+    // Submit all encoded command buffers; alternate between individual and batched submission
     const std::uint64_t startSubmissionTime = Timer::Tick();
 
-    for_range(i, numCmdBuffers)
-        cmdQueue->Submit(*cmdBuffers[i]);
+    if (frame % 2 == 0)
+    {
+        for_range(i, numCmdBuffers)
+            cmdQueue->Submit(*cmdBuffers[i]);
+    }
+    else
+        cmdQueue->Submit(numCmdBuffers, cmdBuffers);
 
     // Wait until GPU is idle or we can't get a representative timing
     cmdQueue->WaitIdle();
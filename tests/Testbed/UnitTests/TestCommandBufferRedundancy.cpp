@@ -0,0 +1,193 @@
+/*
+ * TestCommandBufferRedundancy.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <Gauss/Translate.h>
+#include <Gauss/Scale.h>
+
+
+/*
+Renders the same scene twice: once with only the necessary state changes and once with a multi-submit command buffer
+that repeats all state changes before each draw call and splits each mesh into two adjacent indexed draw calls.
+Backends may eliminate redundant state changes, merge draw calls, or bake draw calls into native GPU command lists in multi-submit command buffers,
+so both frames must be identical.
+*/
+DEF_TEST( CommandBufferRedundancy )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numMeshes = 3;
+
+    // Create graphics PSO
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoCmdBufRedundancy");
+
+    // Create one scene buffer per mesh
+    Buffer* sceneBuffers[numMeshes] = {};
+
+    for_range(i, numMeshes)
+    {
+        sceneConstants              = {};
+        sceneConstants.vpMatrix     = projection;
+        sceneConstants.solidColor   = Gs::Vector4f{ 0.3f*i, 1.0f - 0.3f*i, 0.5f, 1.0f };
+
+        sceneConstants.wMatrix.LoadIdentity();
+        Gs::Translate(sceneConstants.wMatrix, Gs::Vector3f{ -1.5f + 1.5f*i, 0.0f, 5.0f });
+        Gs::Scale(sceneConstants.wMatrix, Gs::Vector3f{ 0.5f, 0.5f, 0.5f });
+
+        BufferDescriptor sceneBufferDesc;
+        {
+            sceneBufferDesc.size        = sizeof(SceneConstants);
+            sceneBufferDesc.bindFlags   = BindFlags::ConstantBuffer;
+        }
+        sceneBuffers[i] = renderer->CreateBuffer(sceneBufferDesc, &sceneConstants);
+    }
+
+    // Create readback texture
+    const Extent2D resolution = swapChain->GetResolution();
+
+    TextureDescriptor readbackTexDesc;
+    {
+        readbackTexDesc.bindFlags       = BindFlags::CopyDst;
+        readbackTexDesc.format          = swapChain->GetColorFormat();
+        readbackTexDesc.extent.width    = resolution.width;
+        readbackTexDesc.extent.height   = resolution.height;
+        readbackTexDesc.miscFlags       = MiscFlags::NoInitialData;
+        readbackTexDesc.mipLevels       = 1;
+    }
+    Texture* readbackTex = renderer->CreateTexture(readbackTexDesc);
+
+    const TextureRegion texRegion{ Offset3D{}, readbackTexDesc.extent };
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+    const std::uint32_t numFirstIndices = (mesh.numIndices / 6) * 3;
+
+    auto ReadbackFramebuffer = [this, readbackTex, &texRegion, &resolution](std::vector<ColorRGBub>& image) -> void
+    {
+        image.resize(resolution.width * resolution.height);
+        MutableImageView dstImageView;
+        {
+            dstImageView.format     = ImageFormat::RGB;
+            dstImageView.dataType   = DataType::UInt8;
+            dstImageView.data       = image.data();
+            dstImageView.dataSize   = image.size() * sizeof(ColorRGBub);
+        }
+        renderer->ReadTexture(*readbackTex, texRegion, dstImageView);
+    };
+
+    // Render reference frame with only the necessary state changes
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->SetVertexBuffer(*meshBuffer);
+        cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+        cmdBuffer->BeginRenderPass(*swapChain);
+        {
+            cmdBuffer->Clear(ClearFlags::ColorDepth);
+            cmdBuffer->SetViewport(resolution);
+            cmdBuffer->SetPipelineState(*pso);
+            for_range(i, numMeshes)
+            {
+                cmdBuffer->SetResource(0, *sceneBuffers[i]);
+                cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+            }
+            cmdBuffer->CopyTextureFromFramebuffer(*readbackTex, texRegion, Offset2D{});
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+
+    std::vector<ColorRGBub> referenceImage;
+    ReadbackFramebuffer(referenceImage);
+
+    // Render the same frame with a multi-submit command buffer that contains redundant state changes
+    CommandBufferDescriptor cmdBufferDesc;
+    {
+        cmdBufferDesc.debugName = "RedundantCmdBuffer";
+        cmdBufferDesc.flags     = CommandBufferFlags::MultiSubmit | CommandBufferFlags::BakeDrawCommands;
+    }
+    CommandBuffer* redundantCmdBuffer = renderer->CreateCommandBuffer(cmdBufferDesc);
+
+    redundantCmdBuffer->Begin();
+    {
+        redundantCmdBuffer->BeginRenderPass(*swapChain);
+        {
+            redundantCmdBuffer->Clear(ClearFlags::ColorDepth);
+            for_range(i, numMeshes)
+            {
+                for_range(j, 2)
+                {
+                    redundantCmdBuffer->SetViewport(resolution);
+                    redundantCmdBuffer->SetVertexBuffer(*meshBuffer);
+                    redundantCmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+                    redundantCmdBuffer->SetPipelineState(*pso);
+                    redundantCmdBuffer->SetResource(0, *sceneBuffers[i]);
+                    if (j == 0)
+                        redundantCmdBuffer->DrawIndexed(numFirstIndices, 0);
+                    else
+                        redundantCmdBuffer->DrawIndexed(mesh.numIndices - numFirstIndices, numFirstIndices);
+                }
+            }
+            redundantCmdBuffer->CopyTextureFromFramebuffer(*readbackTex, texRegion, Offset2D{});
+        }
+        redundantCmdBuffer->EndRenderPass();
+    }
+    redundantCmdBuffer->End();
+
+    TestResult result = TestResult::Passed;
+
+    // Submit multi-submit command buffer several times, since each submission must produce the same result
+    constexpr unsigned numSubmissions = 2;
+
+    for_range(submission, numSubmissions)
+    {
+        cmdQueue->Submit(*redundantCmdBuffer);
+
+        std::vector<ColorRGBub> resultImage;
+        ReadbackFramebuffer(resultImage);
+
+        if (resultImage != referenceImage)
+        {
+            std::size_t numMismatches = 0;
+            for_range(i, resultImage.size())
+            {
+                if (resultImage[i] != referenceImage[i])
+                    ++numMismatches;
+            }
+            Log::Errorf(
+                "Mismatch between frame with redundant state changes (submission %u) and reference frame in %zu of %zu pixels\n",
+                submission, numMismatches, resultImage.size()
+            );
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Release resources
+    for (Buffer* buf : sceneBuffers)
+        renderer->Release(*buf);
+
+    renderer->Release(*redundantCmdBuffer);
+    renderer->Release(*readbackTex);
+    renderer->Release(*pso);
+
+    return result;
+}
+
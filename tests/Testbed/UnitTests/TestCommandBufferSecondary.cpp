@@ -104,19 +104,32 @@ DEF_TEST( CommandBufferSecondary )
 
     CommandBuffer* secondaryCmdBuffers[numCmdBuffers] = {};
 
+    // Create a separate render pass with the same formats as the swap-chain, which is released before the secondary command buffers are executed
+    RenderPassDescriptor compatibleRenderPassDesc;
+    {
+        compatibleRenderPassDesc.colorAttachments[0].format = swapChain->GetColorFormat();
+        compatibleRenderPassDesc.depthAttachment.format     = swapChain->GetDepthStencilFormat();
+        compatibleRenderPassDesc.stencilAttachment.format   = swapChain->GetDepthStencilFormat();
+        compatibleRenderPassDesc.samples                    = swapChain->GetSamples();
+    }
+    RenderPass* compatibleRenderPass = renderer->CreateRenderPass(compatibleRenderPassDesc);
+
     for_range(i, numCmdBuffers)
     {
         CommandBufferDescriptor cmdBufferDesc;
         {
             cmdBufferDesc.flags             = CommandBufferFlags::Secondary;
             cmdBufferDesc.numNativeBuffers  = 1;
-            cmdBufferDesc.renderPass        = swapChain->GetRenderPass(); // Continue rendering into render pass of primary command buffer
+            cmdBufferDesc.renderPass        = (i == 2 ? compatibleRenderPass : swapChain->GetRenderPass()); // Continue rendering into render pass of primary command buffer
         }
         secondaryCmdBuffers[i] = renderer->CreateCommandBuffer(cmdBufferDesc);
 
         RecordSecondaryCommandBuffer(secondaryCmdBuffers[i], models[ModelCube], sceneBuffers[i]);
     }
 
+    // Secondary command buffers only depend on the formats of their render pass, so the render pass object can be released at this point
+    renderer->Release(*compatibleRenderPass);
+
     // Create readback texture
     const Extent2D resolution = swapChain->GetResolution();
 
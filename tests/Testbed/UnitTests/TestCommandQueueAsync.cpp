@@ -0,0 +1,116 @@
+/*
+ * TestCommandQueueAsync.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Fills a buffer on the compute queue, copies it into another buffer on the copy queue, and reads the result back after the graphics queue has waited for both.
+Each queue waits for the previous one with a GPU-side fence wait. Backends without dedicated queues return the primary queue for all types,
+in which case the same sequence must still produce the same result.
+*/
+DEF_TEST( CommandQueueAsync )
+{
+    constexpr std::uint32_t fillValue   = 0xA1B2C3D4;
+    constexpr std::uint64_t bufferSize  = 256;
+
+    BufferDescriptor srcBufDesc;
+    {
+        srcBufDesc.size         = bufferSize;
+        srcBufDesc.bindFlags    = BindFlags::CopySrc | BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(srcBuf, srcBufDesc, "srcBuf{size=256}", nullptr);
+
+    BufferDescriptor dstBufDesc;
+    {
+        dstBufDesc.size         = bufferSize;
+        dstBufDesc.bindFlags    = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(dstBuf, dstBufDesc, "dstBuf{size=256}", nullptr);
+
+    CommandQueue* computeQueue  = renderer->GetCommandQueue(CommandQueueType::Compute);
+    CommandQueue* copyQueue     = renderer->GetCommandQueue(CommandQueueType::Copy);
+
+    if (computeQueue == nullptr || copyQueue == nullptr)
+    {
+        Log::Errorf("Failed to get compute and copy command queues\n");
+        return TestResult::FailedErrors;
+    }
+
+    // Create command buffers for the dedicated queues
+    CommandBufferDescriptor computeCmdBufferDesc;
+    {
+        computeCmdBufferDesc.debugName  = "ComputeCmdBuffer";
+        computeCmdBufferDesc.queueType  = CommandQueueType::Compute;
+    }
+    CommandBuffer* computeCmdBuffer = renderer->CreateCommandBuffer(computeCmdBufferDesc);
+
+    CommandBufferDescriptor copyCmdBufferDesc;
+    {
+        copyCmdBufferDesc.debugName     = "CopyCmdBuffer";
+        copyCmdBufferDesc.queueType     = CommandQueueType::Copy;
+    }
+    CommandBuffer* copyCmdBuffer = renderer->CreateCommandBuffer(copyCmdBufferDesc);
+
+    Fence* computeFence = renderer->CreateFence();
+    Fence* copyFence    = renderer->CreateFence();
+
+    // Encode fill and copy commands
+    computeCmdBuffer->Begin();
+    {
+        computeCmdBuffer->FillBuffer(*srcBuf, 0, fillValue, bufferSize);
+    }
+    computeCmdBuffer->End();
+
+    copyCmdBuffer->Begin();
+    {
+        copyCmdBuffer->CopyBuffer(*dstBuf, 0, *srcBuf, 0, bufferSize);
+    }
+    copyCmdBuffer->End();
+
+    // Submit work to each queue and chain them with GPU-side fence waits
+    computeQueue->Submit(*computeCmdBuffer);
+    computeQueue->Submit(*computeFence);
+
+    copyQueue->SubmitWait(*computeFence);
+    copyQueue->Submit(*copyCmdBuffer);
+    copyQueue->Submit(*copyFence);
+
+    cmdQueue->SubmitWait(*copyFence);
+    cmdQueue->WaitFence(*copyFence, ~0ull);
+
+    // Read result from destination buffer
+    std::uint32_t dstBufData[bufferSize / sizeof(std::uint32_t)] = {};
+    renderer->ReadBuffer(*dstBuf, 0, dstBufData, sizeof(dstBufData));
+
+    TestResult result = TestResult::Passed;
+
+    for_range(i, sizeof(dstBufData) / sizeof(dstBufData[0]))
+    {
+        if (dstBufData[i] != fillValue)
+        {
+            Log::Errorf(
+                "Mismatch between destination buffer data [%zu] = 0x%08X and fill value 0x%08X after compute and copy queue submission\n",
+                i, dstBufData[i], fillValue
+            );
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Release resources
+    renderer->Release(*computeFence);
+    renderer->Release(*copyFence);
+    renderer->Release(*computeCmdBuffer);
+    renderer->Release(*copyCmdBuffer);
+    renderer->Release(*srcBuf);
+    renderer->Release(*dstBuf);
+
+    return result;
+}
+
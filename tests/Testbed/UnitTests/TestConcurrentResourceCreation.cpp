@@ -0,0 +1,128 @@
+/*
+ * TestConcurrentResourceCreation.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <thread>
+#include <vector>
+
+
+/*
+Creates buffers and textures with initial data from multiple worker threads at the same time, then reads them back and releases them on the main thread.
+Only runs on backends that report RenderingFeatures::hasConcurrentResourceCreation.
+*/
+DEF_TEST( ConcurrentResourceCreation )
+{
+    if (!caps.features.hasConcurrentResourceCreation)
+        return TestResult::Skipped;
+
+    constexpr unsigned      numThreads              = 4;
+    constexpr unsigned      numResourcesPerThread   = 8;
+    constexpr unsigned      numResources            = numThreads * numResourcesPerThread;
+    constexpr std::uint32_t texSize                 = 4;
+
+    std::uint32_t   initialData [numResources][texSize*texSize];
+    Buffer*         buffers     [numResources] = {};
+    Texture*        textures    [numResources] = {};
+
+    for_range(i, numResources)
+    {
+        for_range(j, texSize*texSize)
+            initialData[i][j] = 0xFF000000u | (i << 8) | j;
+    }
+
+    // Create resources from worker threads; each thread writes to its own range of the output arrays
+    auto CreateResourceRange = [&](unsigned threadIndex)
+    {
+        for_subrange(i, threadIndex * numResourcesPerThread, (threadIndex + 1) * numResourcesPerThread)
+        {
+            BufferDescriptor bufDesc;
+            {
+                bufDesc.size        = sizeof(initialData[i]);
+                bufDesc.bindFlags   = BindFlags::VertexBuffer | BindFlags::CopySrc;
+            }
+            buffers[i] = renderer->CreateBuffer(bufDesc, initialData[i]);
+
+            TextureDescriptor texDesc;
+            {
+                texDesc.type        = TextureType::Texture2D;
+                texDesc.bindFlags   = BindFlags::Sampled | BindFlags::CopySrc;
+                texDesc.format      = Format::RGBA8UNorm;
+                texDesc.extent      = Extent3D{ texSize, texSize, 1 };
+                texDesc.mipLevels   = 1;
+            }
+            ImageView initialImage;
+            {
+                initialImage.format     = ImageFormat::RGBA;
+                initialImage.dataType   = DataType::UInt8;
+                initialImage.data       = initialData[i];
+                initialImage.dataSize   = sizeof(initialData[i]);
+            }
+            textures[i] = renderer->CreateTexture(texDesc, &initialImage);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(numThreads);
+    for_range(threadIndex, numThreads)
+        workers.emplace_back(CreateResourceRange, threadIndex);
+    for (std::thread& worker : workers)
+        worker.join();
+
+    // Read back all resources on the main thread
+    TestResult result = TestResult::Passed;
+
+    for_range(i, numResources)
+    {
+        if (buffers[i] == nullptr || textures[i] == nullptr)
+        {
+            Log::Errorf("Concurrently created resource [%u] is missing\n", i);
+            result = TestResult::FailedErrors;
+            continue;
+        }
+
+        std::uint32_t bufferData[texSize*texSize] = {};
+        renderer->ReadBuffer(*buffers[i], 0, bufferData, sizeof(bufferData));
+        if (::memcmp(bufferData, initialData[i], sizeof(bufferData)) != 0)
+        {
+            Log::Errorf("Mismatch between data of concurrently created buffer [%u] and its initial data\n", i);
+            result = TestResult::FailedMismatch;
+        }
+
+        std::uint32_t texData[texSize*texSize] = {};
+        MutableImageView dstImage;
+        {
+            dstImage.format     = ImageFormat::RGBA;
+            dstImage.dataType   = DataType::UInt8;
+            dstImage.data       = texData;
+            dstImage.dataSize   = sizeof(texData);
+        }
+        renderer->ReadTexture(*textures[i], TextureRegion{ Offset3D{}, Extent3D{ texSize, texSize, 1 } }, dstImage);
+        if (::memcmp(texData, initialData[i], sizeof(texData)) != 0)
+        {
+            const std::string texDataStr = TestbedContext::FormatByteArray(texData, sizeof(texData), 4);
+            const std::string initialDataStr = TestbedContext::FormatByteArray(initialData[i], sizeof(initialData[i]), 4);
+            Log::Errorf(
+                "Mismatch between data of concurrently created texture [%u]:\n -> Expected: [%s]\n -> Actual:   [%s]\n",
+                i, initialDataStr.c_str(), texDataStr.c_str()
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Release all resources
+    for_range(i, numResources)
+    {
+        if (buffers[i] != nullptr)
+            renderer->Release(*buffers[i]);
+        if (textures[i] != nullptr)
+            renderer->Release(*textures[i]);
+    }
+
+    return result;
+}
+
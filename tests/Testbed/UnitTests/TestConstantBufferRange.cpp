@@ -0,0 +1,164 @@
+/*
+ * TestConstantBufferRange.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <Gauss/Translate.h>
+#include <Gauss/Scale.h>
+#include <algorithm>
+#include <string.h>
+
+
+/*
+Renders the same scene twice: once with a separate constant buffer for each mesh and once with a single constant buffer
+that contains the constants of all meshes, each bound with SetConstantBufferRange at an aligned offset.
+Both frames must be identical.
+*/
+DEF_TEST( ConstantBufferRange )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numMeshes = 3;
+
+    // Create graphics PSO
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoConstantBufferRange");
+
+    // Create one scene buffer per mesh and one shared scene buffer with a stride that satisfies the constant buffer alignment
+    const std::uint64_t alignment   = std::max<std::uint64_t>(1, caps.limits.minConstantBufferAlignment);
+    const std::uint64_t stride      = ((sizeof(SceneConstants) + alignment - 1) / alignment) * alignment;
+
+    Buffer* sceneBuffers[numMeshes] = {};
+    std::vector<char> sharedSceneData(static_cast<std::size_t>(stride * numMeshes), 0);
+
+    for_range(i, numMeshes)
+    {
+        sceneConstants              = {};
+        sceneConstants.vpMatrix     = projection;
+        sceneConstants.solidColor   = Gs::Vector4f{ 0.3f*i, 1.0f - 0.3f*i, 0.5f, 1.0f };
+
+        sceneConstants.wMatrix.LoadIdentity();
+        Gs::Translate(sceneConstants.wMatrix, Gs::Vector3f{ -1.5f + 1.5f*i, 0.0f, 5.0f });
+        Gs::Scale(sceneConstants.wMatrix, Gs::Vector3f{ 0.5f, 0.5f, 0.5f });
+
+        BufferDescriptor sceneBufferDesc;
+        {
+            sceneBufferDesc.size        = sizeof(SceneConstants);
+            sceneBufferDesc.bindFlags   = BindFlags::ConstantBuffer;
+        }
+        sceneBuffers[i] = renderer->CreateBuffer(sceneBufferDesc, &sceneConstants);
+
+        ::memcpy(&sharedSceneData[static_cast<std::size_t>(stride * i)], &sceneConstants, sizeof(SceneConstants));
+    }
+
+    BufferDescriptor sharedSceneBufferDesc;
+    {
+        sharedSceneBufferDesc.size      = sharedSceneData.size();
+        sharedSceneBufferDesc.bindFlags = BindFlags::ConstantBuffer;
+    }
+    CREATE_BUFFER(sharedSceneBuffer, sharedSceneBufferDesc, "sharedSceneBuffer", sharedSceneData.data());
+
+    // Create readback texture
+    const Extent2D resolution = swapChain->GetResolution();
+
+    TextureDescriptor readbackTexDesc;
+    {
+        readbackTexDesc.bindFlags       = BindFlags::CopyDst;
+        readbackTexDesc.format          = swapChain->GetColorFormat();
+        readbackTexDesc.extent.width    = resolution.width;
+        readbackTexDesc.extent.height   = resolution.height;
+        readbackTexDesc.miscFlags       = MiscFlags::NoInitialData;
+        readbackTexDesc.mipLevels       = 1;
+    }
+    Texture* readbackTex = renderer->CreateTexture(readbackTexDesc);
+
+    const TextureRegion texRegion{ Offset3D{}, readbackTexDesc.extent };
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    auto RenderAndReadbackFrame = [&](bool useRanges, std::vector<ColorRGBub>& image) -> void
+    {
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->SetVertexBuffer(*meshBuffer);
+            cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            cmdBuffer->BeginRenderPass(*swapChain);
+            {
+                cmdBuffer->Clear(ClearFlags::ColorDepth);
+                cmdBuffer->SetViewport(resolution);
+                cmdBuffer->SetPipelineState(*pso);
+                for_range(i, numMeshes)
+                {
+                    if (useRanges)
+                        cmdBuffer->SetConstantBufferRange(0, *sharedSceneBuffer, stride * i, sizeof(SceneConstants));
+                    else
+                        cmdBuffer->SetResource(0, *sceneBuffers[i]);
+                    cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+                }
+                cmdBuffer->CopyTextureFromFramebuffer(*readbackTex, texRegion, Offset2D{});
+            }
+            cmdBuffer->EndRenderPass();
+        }
+        cmdBuffer->End();
+
+        image.resize(resolution.width * resolution.height);
+        MutableImageView dstImageView;
+        {
+            dstImageView.format     = ImageFormat::RGB;
+            dstImageView.dataType   = DataType::UInt8;
+            dstImageView.data       = image.data();
+            dstImageView.dataSize   = image.size() * sizeof(ColorRGBub);
+        }
+        renderer->ReadTexture(*readbackTex, texRegion, dstImageView);
+    };
+
+    // Render reference frame with separate constant buffers and frame with constant buffer ranges
+    std::vector<ColorRGBub> referenceImage, resultImage;
+    RenderAndReadbackFrame(false, referenceImage);
+    RenderAndReadbackFrame(true, resultImage);
+
+    TestResult result = TestResult::Passed;
+
+    if (resultImage != referenceImage)
+    {
+        std::size_t numMismatches = 0;
+        for_range(i, resultImage.size())
+        {
+            if (resultImage[i] != referenceImage[i])
+                ++numMismatches;
+        }
+        Log::Errorf(
+            "Mismatch between frame with constant buffer ranges (stride = %" PRIu64 ") and reference frame in %zu of %zu pixels\n",
+            stride, numMismatches, resultImage.size()
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Release resources
+    for (Buffer* buf : sceneBuffers)
+        renderer->Release(*buf);
+
+    renderer->Release(*sharedSceneBuffer);
+    renderer->Release(*readbackTex);
+    renderer->Release(*pso);
+
+    return result;
+}
+
@@ -0,0 +1,117 @@
+/*
+ * TestDbgTransientBufferFlags.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/RenderingDebugger.h>
+#include <string>
+#include <vector>
+
+
+#if LLGL_ENABLE_DEBUG_LAYER
+
+// Rendering debugger that records all error messages instead of printing them.
+class ErrorRecordingDebugger final : public RenderingDebugger
+{
+
+    public:
+
+        std::vector<std::string> errors;
+
+    protected:
+
+        void OnError(ErrorType /*type*/, Message& message) override
+        {
+            errors.push_back(message.GetText().c_str());
+        }
+
+};
+
+// Returns true if any of the specified messages contains the specified substring.
+static bool ContainsMessage(const std::vector<std::string>& messages, const char* substring)
+{
+    for (const std::string& msg : messages)
+    {
+        if (msg.find(substring) != std::string::npos)
+            return true;
+    }
+    return false;
+}
+
+#endif // /LLGL_ENABLE_DEBUG_LAYER
+
+/*
+Validates the bind flags of CommandBuffer::AllocTransientBuffer() with the debug layer on top of the Null backend.
+A vertex buffer allocation must not report any errors, while a storage buffer allocation must report that this bind flag is invalid.
+*/
+DEF_RITEST( DbgTransientBufferFlags )
+{
+    #if LLGL_ENABLE_DEBUG_LAYER
+
+    ErrorRecordingDebugger debugger;
+
+    RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName = "Null";
+        rendererDesc.debugger   = &debugger;
+    }
+    RenderSystemPtr renderer = RenderSystem::Load(rendererDesc);
+    if (!renderer)
+    {
+        if (opt.verbose)
+            Log::Printf("Null render system is not available\n");
+        return TestResult::Skipped;
+    }
+
+    if (!renderer->GetRenderingCaps().features.hasTransientBuffers)
+    {
+        RenderSystem::Unload(std::move(renderer));
+        return TestResult::Skipped;
+    }
+
+    CommandBuffer* cmdBuffer = renderer->CreateCommandBuffer();
+
+    TestResult result = TestResult::Passed;
+
+    cmdBuffer->Begin();
+    {
+        // Valid vertex buffer allocation must not report any errors
+        cmdBuffer->AllocTransientBuffer(64, BindFlags::VertexBuffer);
+        if (!debugger.errors.empty())
+        {
+            Log::Errorf("Transient vertex buffer allocation reported unexpected error: %s\n", debugger.errors.front().c_str());
+            result = TestResult::FailedErrors;
+        }
+        debugger.errors.clear();
+
+        // Storage buffers cannot be allocated from transient memory
+        cmdBuffer->AllocTransientBuffer(64, BindFlags::Storage);
+        if (!ContainsMessage(debugger.errors, "cannot bind transient buffer"))
+        {
+            Log::Errorf("Transient storage buffer allocation did not report invalid bind flags\n");
+            result = TestResult::FailedErrors;
+        }
+        if (ContainsMessage(debugger.errors, "was not created with"))
+        {
+            Log::Errorf("Transient storage buffer allocation reported missing bind flags instead of invalid ones\n");
+            result = TestResult::FailedErrors;
+        }
+        debugger.errors.clear();
+    }
+    cmdBuffer->End();
+
+    renderer->Release(*cmdBuffer);
+    RenderSystem::Unload(std::move(renderer));
+
+    return result;
+
+    #else
+
+    return TestResult::Skipped;
+
+    #endif // /LLGL_ENABLE_DEBUG_LAYER
+}
+
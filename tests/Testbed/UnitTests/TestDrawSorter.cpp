@@ -0,0 +1,130 @@
+/*
+ * TestDrawSorter.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/DrawSorter.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Sorts enough draw packets for the radix sort to be distributed to multiple jobs and validates that they are in ascending and stable order.
+Then encodes a small set of sorted draw calls with two alternating PSOs into a command buffer.
+*/
+DEF_TEST( DrawSorter )
+{
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(psoCullBack, psoDesc, "psoDrawSorter.CullBack");
+
+    psoDesc.rasterizer.cullMode = CullMode::Front;
+    CREATE_GRAPHICS_PSO(psoCullFront, psoDesc, "psoDrawSorter.CullFront");
+
+    PipelineState* psos[2] = { psoCullBack, psoCullFront };
+
+    TestResult result = TestResult::Passed;
+
+    // Sort packets with few distinct keys, so many of them are equal; the insertion index is stored in the vertex offset to validate stability
+    constexpr std::uint32_t numPackets = 50000;
+
+    DrawSorter sorter;
+    sorter.Reserve(numPackets);
+
+    std::uint32_t seed = 0x12345678u;
+    for_range(i, numPackets)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        DrawPacket packet;
+        {
+            packet.sortKey          = DrawSorter::MakeSortKey(seed >> 30, (seed >> 20) & 0xFu, (seed >> 8) & 0xFFu);
+            packet.pipelineState    = psos[seed >> 31];
+            packet.vertexOffset     = static_cast<std::int32_t>(i);
+        }
+        sorter.Add(packet);
+    }
+
+    sorter.Sort();
+
+    const std::vector<DrawPacket>& packets = sorter.GetPackets();
+    if (packets.size() != numPackets)
+    {
+        Log::Errorf("Mismatch between number of sorted draw packets (%zu) and added packets (%u)\n", packets.size(), numPackets);
+        result = TestResult::FailedMismatch;
+    }
+    else
+    {
+        for_subrange(i, 1, numPackets)
+        {
+            const DrawPacket& prev = packets[i - 1];
+            const DrawPacket& curr = packets[i];
+            if (prev.sortKey > curr.sortKey || (prev.sortKey == curr.sortKey && prev.vertexOffset >= curr.vertexOffset))
+            {
+                Log::Errorf(
+                    "Mismatch between order of sorted draw packets [%u] and [%u]:\n -> Keys:    [0x%016" PRIX64 ", 0x%016" PRIX64 "]\n -> Indices: [%d, %d]\n",
+                    static_cast<unsigned>(i - 1), static_cast<unsigned>(i), prev.sortKey, curr.sortKey, prev.vertexOffset, curr.vertexOffset
+                );
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+    }
+
+    // Encode a small set of sorted draw calls
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    sorter.Clear();
+    for_range(i, 16)
+    {
+        DrawPacket packet;
+        {
+            packet.sortKey          = DrawSorter::MakeSortKey(i % 2, 0, 0);
+            packet.pipelineState    = psos[i % 2];
+            packet.vertexBuffer     = meshBuffer;
+            packet.indexBuffer      = meshBuffer;
+            packet.numVertices      = 3;
+            packet.firstVertex      = static_cast<std::uint32_t>(mesh.indexBufferOffset / sizeof(std::uint32_t));
+        }
+        sorter.Add(packet);
+    }
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->BeginRenderPass(*swapChain);
+        {
+            cmdBuffer->SetViewport(swapChain->GetResolution());
+            cmdBuffer->SetPipelineState(*psoCullBack);
+            cmdBuffer->SetResource(0, *sceneCbuffer);
+            sorter.Submit(*cmdBuffer);
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+
+    if (sorter.GetPackets().front().pipelineState != psoCullBack || sorter.GetPackets().back().pipelineState != psoCullFront)
+    {
+        Log::Errorf("Mismatch between pipeline states of sorted draw packets\n");
+        result = TestResult::FailedMismatch;
+    }
+
+    // Release resources
+    renderer->Release(*psoCullFront);
+    renderer->Release(*psoCullBack);
+
+    return result;
+}
+
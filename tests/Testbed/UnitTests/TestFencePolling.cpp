@@ -0,0 +1,80 @@
+/*
+ * TestFencePolling.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <vector>
+
+
+/*
+Polls fences with Fence::IsSignaled() and releases them while they might still be in flight.
+Fences that have never been submitted must report to be signaled, and so must recycled fences that are handed out again by RenderSystem::CreateFence().
+*/
+DEF_TEST( FencePolling )
+{
+    constexpr std::uint32_t numFences = 16;
+
+    TestResult result = TestResult::Passed;
+
+    std::vector<Fence*> fences;
+    fences.reserve(numFences);
+
+    for_range(i, numFences)
+    {
+        Fence* fence = renderer->CreateFence();
+        if (!fence->IsSignaled())
+        {
+            Log::Errorf("Fence [%u] is not signaled before its first submission\n", i);
+            result = TestResult::FailedMismatch;
+        }
+        fences.push_back(fence);
+    }
+
+    // Submit all fences and release every other one without waiting for it
+    for (Fence* fence : fences)
+        cmdQueue->Submit(*fence);
+
+    for_range(i, numFences)
+    {
+        if (i % 2 == 0)
+            renderer->Release(*fences[i]);
+    }
+
+    // Wait for the remaining fences and poll them afterwards, which must not block
+    for_range(i, numFences)
+    {
+        if (i % 2 == 1)
+        {
+            cmdQueue->WaitFence(*fences[i], ~0ull);
+            if (!fences[i]->IsSignaled())
+            {
+                Log::Errorf("Fence [%u] is not signaled after CommandQueue::WaitFence()\n", i);
+                result = TestResult::FailedMismatch;
+            }
+            renderer->Release(*fences[i]);
+        }
+    }
+
+    // Create fences again, which may recycle the previously released ones
+    cmdQueue->WaitIdle();
+
+    for_range(i, numFences)
+    {
+        fences[i] = renderer->CreateFence();
+        if (!fences[i]->IsSignaled())
+        {
+            Log::Errorf("Recreated fence [%u] is not signaled before its first submission\n", i);
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    for (Fence* fence : fences)
+        renderer->Release(*fence);
+
+    return result;
+}
+
@@ -0,0 +1,169 @@
+/*
+ * TestImageBlockCompression.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <string.h>
+#include <stdlib.h>
+
+
+/*
+Compresses a gradient image into each supported block compression format, decompresses it again, and compares it to the input image.
+The image extent is not a multiple of 4 to also cover the border blocks. Multi-threaded compression must produce the same blocks as single-threaded compression.
+BC7 is only decompressed from a fixed block since there is no BC7 compressor.
+*/
+DEF_RITEST( ImageBlockCompression )
+{
+    struct FormatTest
+    {
+        Format  format;
+        int     numComponents;
+        int     maxError;
+    };
+
+    const FormatTest formatTests[] =
+    {
+        { Format::BC1UNorm,  3, 24 },
+        { Format::BC3UNorm,  4, 24 },
+        { Format::BC4UNorm,  1,  2 },
+        { Format::BC5UNorm,  2,  2 },
+        { Format::ETC2UNorm, 3, 24 },
+    };
+
+    const ImageCompressionQuality qualities[] =
+    {
+        ImageCompressionQuality::Fast,
+        ImageCompressionQuality::Default,
+        ImageCompressionQuality::High,
+    };
+
+    // Initialize source image with gradients; red and green vary in different directions, which limits the precision of BC1 and ETC
+    const Extent2D extent{ 30, 18 };
+    std::vector<ColorRGBAub> srcData(extent.width * extent.height);
+    for_range(y, extent.height)
+    {
+        for_range(x, extent.width)
+        {
+            srcData[y * extent.width + x] = ColorRGBAub
+            {
+                static_cast<std::uint8_t>(x * 8),
+                static_cast<std::uint8_t>(255 - y * 8),
+                static_cast<std::uint8_t>(64 + x * 2 + y * 2),
+                static_cast<std::uint8_t>(128 + y * 4),
+            };
+        }
+    }
+
+    const ImageView srcImage{ ImageFormat::RGBA, DataType::UInt8, srcData.data(), srcData.size() * sizeof(ColorRGBAub) };
+
+    TestResult result = TestResult::Passed;
+
+    for (const FormatTest& test : formatTests)
+    {
+        const char* formatName = ToString(test.format);
+
+        for (ImageCompressionQuality quality : qualities)
+        {
+            DynamicByteArray blocks = CompressImageBufferFromRGBA8UNorm(test.format, srcImage, extent, quality);
+            DynamicByteArray blocksMT = CompressImageBufferFromRGBA8UNorm(test.format, srcImage, extent, quality, LLGL_MAX_THREAD_COUNT);
+            if (!blocks || !blocksMT)
+            {
+                Log::Errorf("Failed to compress image to %s format\n", formatName);
+                result = TestResult::FailedErrors;
+                continue;
+            }
+
+            if (blocks.size() != blocksMT.size() || ::memcmp(blocks.data(), blocksMT.data(), blocks.size()) != 0)
+            {
+                Log::Errorf("Mismatch between single- and multi-threaded image compression to %s format\n", formatName);
+                result = TestResult::FailedMismatch;
+            }
+
+            // Decompress image and compare with input
+            const ImageView compressedImage{ ImageFormat::RGBA, DataType::UInt8, blocks.data(), blocks.size() };
+            DynamicByteArray dstData = DecompressImageBufferToRGBA8UNorm(test.format, compressedImage, extent, LLGL_MAX_THREAD_COUNT);
+            if (!dstData || dstData.size() != srcImage.dataSize)
+            {
+                Log::Errorf("Failed to decompress image from %s format\n", formatName);
+                result = TestResult::FailedErrors;
+                continue;
+            }
+
+            const std::uint8_t* srcBytes = reinterpret_cast<const std::uint8_t*>(srcData.data());
+            const std::uint8_t* dstBytes = reinterpret_cast<const std::uint8_t*>(dstData.data());
+
+            int maxError = 0;
+            for_range(i, srcData.size())
+            {
+                for_range(c, test.numComponents)
+                    maxError = std::max(maxError, ::abs(static_cast<int>(srcBytes[i * 4 + c]) - static_cast<int>(dstBytes[i * 4 + c])));
+            }
+
+            if (maxError > test.maxError)
+            {
+                Log::Errorf(
+                    "Mismatch between image and its round trip through %s format (quality %d):\n"
+                    " -> Expected: error <= %d\n"
+                    " -> Actual:   error  = %d\n",
+                    formatName, static_cast<int>(quality), test.maxError, maxError
+                );
+                result = TestResult::FailedMismatch;
+            }
+            else if (opt.sanityCheck)
+            {
+                Log::Printf(
+                    Log::ColorFlags::StdAnnotation,
+                    "Sanity check for round trip through %s format (quality %d): error = %d\n",
+                    formatName, static_cast<int>(quality), maxError
+                );
+            }
+        }
+    }
+
+    // Decode a single BC7 block (mode 6) with a black to white gradient along the 4-bit indices; there is no BC7 compressor to round trip
+    const std::uint8_t bc7Block[16] =
+    {
+        0x40, 0xC0, 0x1F, 0xF0, 0x07, 0xFC, 0xFF, 0x7F, 0x11, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC, 0xFE
+    };
+    const std::uint8_t bc7ExpectedRed[16] =
+    {
+        0, 16, 36, 52, 68, 84, 104, 120, 135, 151, 171, 187, 203, 219, 239, 255
+    };
+
+    const ImageView bc7Image{ ImageFormat::RGBA, DataType::UInt8, bc7Block, sizeof(bc7Block) };
+    DynamicByteArray bc7Data = DecompressImageBufferToRGBA8UNorm(Format::BC7UNorm, bc7Image, Extent2D{ 4, 4 });
+    if (!bc7Data)
+    {
+        Log::Errorf("Failed to decompress image from BC7UNorm format\n");
+        result = TestResult::FailedErrors;
+    }
+    else
+    {
+        const std::uint8_t* bc7Texels = reinterpret_cast<const std::uint8_t*>(bc7Data.data());
+        for_range(i, 16u)
+        {
+            const std::uint8_t  expectedAlpha   = (i < 8 ? 254 : 255);
+            const std::uint8_t* texel           = bc7Texels + i * 4;
+            if (texel[0] != bc7ExpectedRed[i] || texel[1] != bc7ExpectedRed[i] || texel[2] != bc7ExpectedRed[i] || texel[3] != expectedAlpha)
+            {
+                Log::Errorf(
+                    "Mismatch between BC7 block and decompressed texel [%u]:\n"
+                    " -> Expected: (%u, %u, %u, %u)\n"
+                    " -> Actual:   (%u, %u, %u, %u)\n",
+                    i, bc7ExpectedRed[i], bc7ExpectedRed[i], bc7ExpectedRed[i], expectedAlpha,
+                    texel[0], texel[1], texel[2], texel[3]
+                );
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
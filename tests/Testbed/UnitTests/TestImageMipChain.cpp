@@ -0,0 +1,92 @@
+/*
+ * TestImageMipChain.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <string.h>
+
+
+/*
+Generates the MIP-map chain of a 4x4 black and white checkerboard with two array layers, where the second layer has a constant color.
+The box filter must average the checkerboard to 50% gray, which is 128 in linear color space and 188 in sRGB color space.
+The alpha channel must always be filtered linearly and the constant layer must remain unchanged.
+*/
+DEF_RITEST( ImageMipChain )
+{
+    constexpr std::uint32_t numLayers       = 2;
+    constexpr std::uint32_t numTexels       = 4*4;
+    constexpr std::uint8_t  constantValue   = 100;
+
+    std::vector<ColorRGBAub> srcData(numTexels * numLayers);
+    for_range(i, numTexels)
+    {
+        const std::uint8_t value = (((i % 4) + (i / 4)) % 2 == 0 ? 0x00 : 0xFF);
+        srcData[i]              = ColorRGBAub{ value, value, value, value };
+        srcData[numTexels + i]  = ColorRGBAub{ constantValue, constantValue, constantValue, constantValue };
+    }
+
+    const ImageView srcImage{ ImageFormat::RGBA, DataType::UInt8, srcData.data(), srcData.size() * sizeof(ColorRGBAub) };
+
+    TestResult result = TestResult::Passed;
+
+    for (bool isSRGB : { false, true })
+    {
+        DynamicByteArray mipChain = GenerateMipChainBuffer(srcImage, Extent3D{ 4, 4, 1 }, numLayers, 0, ImageMipMapFilter::Box, isSRGB, LLGL_MAX_THREAD_COUNT);
+
+        // MIP-maps 4x4, 2x2, and 1x1 with two layers each
+        const std::size_t expectedSize = (16 + 4 + 1) * numLayers * sizeof(ColorRGBAub);
+        if (!mipChain || mipChain.size() != expectedSize)
+        {
+            Log::Errorf("Mismatch between size of MIP-map chain (%zu) and expected size (%zu)\n", (mipChain ? mipChain.size() : 0), expectedSize);
+            result = TestResult::FailedMismatch;
+            continue;
+        }
+
+        const ColorRGBAub* mips = reinterpret_cast<const ColorRGBAub*>(mipChain.data());
+
+        if (::memcmp(mips, srcData.data(), srcImage.dataSize) != 0)
+        {
+            Log::Errorf("Mismatch between first MIP-map and source image (sRGB = %s)\n", (isSRGB ? "true" : "false"));
+            result = TestResult::FailedMismatch;
+        }
+
+        const std::uint8_t expectedColor = (isSRGB ? 188 : 128);
+        const ColorRGBAub expectedGray{ expectedColor, expectedColor, expectedColor, 128 };
+        const ColorRGBAub expectedConstant{ constantValue, constantValue, constantValue, constantValue };
+
+        // Check second MIP-map (after 2 layers with 16 texels) and third MIP-map (after 2 layers with 4 texels)
+        const ColorRGBAub* mipLevels[2] = { mips + numTexels * numLayers, mips + (numTexels + 4) * numLayers };
+        const std::uint32_t numMipTexels[2] = { 4, 1 };
+
+        for_range(mip, 2)
+        {
+            for_range(layer, numLayers)
+            {
+                for_range(i, numMipTexels[mip])
+                {
+                    const ColorRGBAub& actual   = mipLevels[mip][layer * numMipTexels[mip] + i];
+                    const ColorRGBAub& expected = (layer == 0 ? expectedGray : expectedConstant);
+                    if (actual != expected)
+                    {
+                        Log::Errorf(
+                            "Mismatch between MIP-map %u of layer %u at texel %u (sRGB = %s):\n"
+                            " -> Expected: (%u, %u, %u, %u)\n"
+                            " -> Actual:   (%u, %u, %u, %u)\n",
+                            static_cast<unsigned>(mip + 1), static_cast<unsigned>(layer), static_cast<unsigned>(i), (isSRGB ? "true" : "false"),
+                            expected.r, expected.g, expected.b, expected.a,
+                            actual.r, actual.g, actual.b, actual.a
+                        );
+                        result = TestResult::FailedMismatch;
+                    }
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
@@ -0,0 +1,88 @@
+/*
+ * TestImageResample.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ImageFlags.h>
+#include <cmath>
+
+
+/*
+Resamples a linear ramp of 8 floats to 16 texels with the bilinear filter, which must interpolate between the source texel centers,
+and a constant 300x200 RGBA8 image to 256x256 with every filter, which must remain constant despite the negative lobes of the sharper filters.
+*/
+DEF_RITEST( ImageResample )
+{
+    TestResult result = TestResult::Passed;
+
+    // Bilinear upsampling of a ramp: destination texel 5 has its center at 2.75 source texels, i.e. halfway between 2 and 3 after the half-texel shift
+    float rampData[8];
+    for_range(i, 8)
+        rampData[i] = static_cast<float>(i);
+
+    const ImageView rampImage{ ImageFormat::R, DataType::Float32, rampData, sizeof(rampData) };
+    DynamicByteArray rampBuffer = ResampleImageBuffer(rampImage, Extent3D{ 8, 1, 1 }, Extent3D{ 16, 1, 1 }, ImageResampleFilter::Bilinear);
+
+    const float* ramp = reinterpret_cast<const float*>(rampBuffer.get());
+    const float expectedRamp[3] = { 0.0f, 2.25f, 7.0f };
+    const float actualRamp[3]   = { ramp[0], ramp[5], ramp[15] };
+
+    for_range(i, 3)
+    {
+        if (std::abs(actualRamp[i] - expectedRamp[i]) > 1.0e-5f)
+        {
+            Log::Errorf(
+                "Mismatch between bilinear upsampled ramp:\n"
+                " -> Expected: [%f, %f, %f]\n"
+                " -> Actual:   [%f, %f, %f]\n",
+                expectedRamp[0], expectedRamp[1], expectedRamp[2],
+                actualRamp[0], actualRamp[1], actualRamp[2]
+            );
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Constant image must remain constant with all filters
+    const ColorRGBAub constantColor{ 200, 30, 90, 255 };
+    std::vector<ColorRGBAub> constantData(300 * 200, constantColor);
+    const ImageView constantImage{ ImageFormat::RGBA, DataType::UInt8, constantData.data(), constantData.size() * sizeof(ColorRGBAub) };
+
+    const ImageResampleFilter filters[] =
+    {
+        ImageResampleFilter::Box,
+        ImageResampleFilter::Bilinear,
+        ImageResampleFilter::Mitchell,
+        ImageResampleFilter::Lanczos3,
+        ImageResampleFilter::Kaiser,
+    };
+
+    for (ImageResampleFilter filter : filters)
+    {
+        DynamicByteArray dstBuffer = ResampleImageBuffer(constantImage, Extent3D{ 300, 200, 1 }, Extent3D{ 256, 256, 1 }, filter, true, LLGL_MAX_THREAD_COUNT);
+
+        const ColorRGBAub* dst = reinterpret_cast<const ColorRGBAub*>(dstBuffer.get());
+        for_range(i, 256 * 256)
+        {
+            if (dst[i] != constantColor)
+            {
+                Log::Errorf(
+                    "Mismatch between resampled constant image at texel %u (filter = %d):\n"
+                    " -> Expected: (%u, %u, %u, %u)\n"
+                    " -> Actual:   (%u, %u, %u, %u)\n",
+                    static_cast<unsigned>(i), static_cast<int>(filter),
+                    constantColor.r, constantColor.g, constantColor.b, constantColor.a,
+                    dst[i].r, dst[i].g, dst[i].b, dst[i].a
+                );
+                result = TestResult::FailedMismatch;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
@@ -0,0 +1,236 @@
+/*
+ * TestMeshUtils.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/MeshUtils.h>
+#include <LLGL/Utils/ForRange.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+
+static std::vector<std::array<std::uint32_t, 3>> GetSortedTriangles(const std::vector<std::uint32_t>& indices)
+{
+    std::vector<std::array<std::uint32_t, 3>> triangles(indices.size() / 3);
+    for_range(i, triangles.size())
+    {
+        /* Rotate each triangle so its smallest index comes first, which preserves the winding order */
+        std::array<std::uint32_t, 3> tri = { indices[i*3], indices[i*3 + 1], indices[i*3 + 2] };
+        std::rotate(tri.begin(), std::min_element(tri.begin(), tri.end()), tri.end());
+        triangles[i] = tri;
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+static float DecodeSNorm16(std::int16_t value)
+{
+    return std::max(-1.0f, static_cast<float>(value) / 32767.0f);
+}
+
+/*
+Optimizes a shuffled grid mesh for the vertex cache, overdraw, and vertex fetch, and validates that the triangles are preserved.
+Then quantizes the vertices with octahedral normals and 16-bit texture coordinates and validates the decoded values.
+This test does not require the render system.
+*/
+DEF_TEST( MeshUtils )
+{
+    TestResult result = TestResult::Passed;
+
+    // Generate grid of quads, each split into two triangles
+    constexpr std::uint32_t gridSize    = 64;
+    constexpr std::uint32_t numVertices = (gridSize + 1) * (gridSize + 1);
+
+    struct Vertex
+    {
+        float position[3];
+        float normal[3];
+        float texCoord[2];
+    };
+
+    std::vector<Vertex> vertices(numVertices);
+    for_range(y, gridSize + 1)
+    {
+        for_range(x, gridSize + 1)
+        {
+            const float u = static_cast<float>(x) / gridSize;
+            const float v = static_cast<float>(y) / gridSize;
+            Vertex& vert = vertices[y * (gridSize + 1) + x];
+            vert.position[0] = u * 2.0f - 1.0f;
+            vert.position[1] = v * 2.0f - 1.0f;
+            vert.position[2] = std::sin(u * 6.0f) * std::cos(v * 6.0f) * 0.25f;
+            const float nx = -std::cos(u * 6.0f) * std::cos(v * 6.0f) * 0.75f;
+            const float ny = std::sin(u * 6.0f) * std::sin(v * 6.0f) * 0.75f;
+            const float invLen = 1.0f / std::sqrt(nx*nx + ny*ny + 1.0f);
+            vert.normal[0] = nx * invLen;
+            vert.normal[1] = ny * invLen;
+            vert.normal[2] = -invLen;
+            vert.texCoord[0] = u;
+            vert.texCoord[1] = v;
+        }
+    }
+
+    std::vector<std::uint32_t> indices;
+    indices.reserve(gridSize * gridSize * 6);
+    for_range(y, gridSize)
+    {
+        for_range(x, gridSize)
+        {
+            const std::uint32_t i0 = y * (gridSize + 1) + x;
+            const std::uint32_t i1 = i0 + 1;
+            const std::uint32_t i2 = i0 + gridSize + 1;
+            const std::uint32_t i3 = i2 + 1;
+            indices.insert(indices.end(), { i0, i1, i2, i2, i1, i3 });
+        }
+    }
+
+    // Shuffle triangles with a deterministic LCG
+    const std::size_t numTriangles = indices.size() / 3;
+    std::uint32_t seed = 0x2468ACEu;
+    for (std::size_t i = numTriangles - 1; i > 0; --i)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        const std::size_t j = seed % (i + 1);
+        std::swap_ranges(&indices[i*3], &indices[i*3] + 3, &indices[j*3]);
+    }
+
+    const auto  originalTriangles   = GetSortedTriangles(indices);
+    const float shuffledACMR        = GetVertexCacheMissRatio(indices.data(), indices.size(), Format::R32UInt);
+
+    // Optimize for vertex cache and expect a substantially lower miss ratio
+    OptimizeVertexCache(indices.data(), indices.size(), Format::R32UInt);
+
+    const float optimizedACMR = GetVertexCacheMissRatio(indices.data(), indices.size(), Format::R32UInt);
+    if (!(optimizedACMR < 1.0f && optimizedACMR < shuffledACMR * 0.5f))
+    {
+        Log::Errorf("Mismatch between vertex cache miss ratio after optimization: %.3f (shuffled %.3f)\n", optimizedACMR, shuffledACMR);
+        result = TestResult::FailedMismatch;
+    }
+
+    if (GetSortedTriangles(indices) != originalTriangles)
+    {
+        Log::Errorf("Mismatch between triangles after vertex cache optimization\n");
+        result = TestResult::FailedMismatch;
+    }
+
+    // Optimize 16-bit indices and expect the same result as for 32-bit indices
+    {
+        std::vector<std::uint16_t> indices16(indices.begin(), indices.end());
+        std::vector<std::uint32_t> reoptimized = indices;
+        OptimizeVertexCache(indices16.data(), indices16.size(), Format::R16UInt);
+        OptimizeVertexCache(reoptimized.data(), reoptimized.size(), Format::R32UInt);
+        if (!std::equal(indices16.begin(), indices16.end(), reoptimized.begin()))
+        {
+            Log::Errorf("Mismatch between 16-bit and 32-bit index optimization\n");
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Optimize for overdraw and expect the triangles to be preserved
+    OptimizeOverdraw(indices.data(), indices.size(), Format::R32UInt, vertices.data(), vertices.size(), sizeof(Vertex));
+
+    if (GetSortedTriangles(indices) != originalTriangles)
+    {
+        Log::Errorf("Mismatch between triangles after overdraw optimization\n");
+        result = TestResult::FailedMismatch;
+    }
+
+    // Optimize for vertex fetch and expect vertices in order of first reference
+    const std::vector<Vertex>           verticesBeforeFetch = vertices;
+    const std::vector<std::uint32_t>    indicesBeforeFetch  = indices;
+
+    const std::size_t numReferencedVertices = OptimizeVertexFetch(vertices.data(), vertices.size(), sizeof(Vertex), indices.data(), indices.size(), Format::R32UInt);
+    if (numReferencedVertices != numVertices)
+    {
+        Log::Errorf("Mismatch between number of referenced vertices: %zu (expected %u)\n", numReferencedVertices, numVertices);
+        result = TestResult::FailedMismatch;
+    }
+
+    std::uint32_t maxIndex = 0;
+    for_range(i, indices.size())
+    {
+        if (indices[i] > maxIndex + 1)
+        {
+            Log::Errorf("Mismatch between vertex order and first reference at index [%zu]: %u\n", i, indices[i]);
+            result = TestResult::FailedMismatch;
+            break;
+        }
+        maxIndex = std::max(maxIndex, indices[i]);
+        if (std::memcmp(&vertices[indices[i]], &verticesBeforeFetch[indicesBeforeFetch[i]], sizeof(Vertex)) != 0)
+        {
+            Log::Errorf("Mismatch between remapped vertices at index [%zu]\n", i);
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    // Quantize vertices with octahedral normals and half-precision texture coordinates
+    VertexFormat vertexFormat;
+    {
+        vertexFormat.AppendAttribute({ "position", Format::RGB32Float });
+        vertexFormat.AppendAttribute({ "normal",   Format::RGB32Float });
+        vertexFormat.AppendAttribute({ "texCoord", Format::RG32Float  });
+    }
+
+    const VertexQuantization quantizations[] =
+    {
+        VertexQuantization::None,
+        VertexQuantization::OctahedralSNorm16,
+        VertexQuantization::Float16,
+    };
+
+    const VertexFormat packedFormat = GetQuantizedVertexFormat(vertexFormat, quantizations);
+    if (packedFormat.GetStride() != 20 ||
+        packedFormat.attributes[1].format != Format::RG16SNorm ||
+        packedFormat.attributes[2].format != Format::RG16Float)
+    {
+        Log::Errorf("Mismatch between quantized vertex format: stride = %u (expected 20)\n", packedFormat.GetStride());
+        return TestResult::FailedMismatch;
+    }
+
+    std::vector<char> packedVertices(packedFormat.GetStride() * vertices.size());
+    QuantizeVertices(vertexFormat, vertices.data(), vertices.size(), quantizations, packedVertices.data(), packedVertices.size());
+
+    for_range(i, vertices.size())
+    {
+        const char* packed = &packedVertices[i * packedFormat.GetStride()];
+
+        // Compare position
+        if (std::memcmp(packed, vertices[i].position, sizeof(vertices[i].position)) != 0)
+        {
+            Log::Errorf("Mismatch between quantized vertex position [%zu]\n", i);
+            result = TestResult::FailedMismatch;
+            break;
+        }
+
+        // Decode octahedral normal
+        std::int16_t encodedNormal[2];
+        std::memcpy(encodedNormal, packed + packedFormat.attributes[1].offset, sizeof(encodedNormal));
+
+        float n[3] = { DecodeSNorm16(encodedNormal[0]), DecodeSNorm16(encodedNormal[1]), 0.0f };
+        n[2] = 1.0f - std::abs(n[0]) - std::abs(n[1]);
+        if (n[2] < 0.0f)
+        {
+            const float x = n[0];
+            n[0] = (1.0f - std::abs(n[1])) * (x    >= 0.0f ? 1.0f : -1.0f);
+            n[1] = (1.0f - std::abs(x   )) * (n[1] >= 0.0f ? 1.0f : -1.0f);
+        }
+        const float invLen = 1.0f / std::sqrt(n[0]*n[0] + n[1]*n[1] + n[2]*n[2]);
+
+        const float dot = (n[0]*vertices[i].normal[0] + n[1]*vertices[i].normal[1] + n[2]*vertices[i].normal[2]) * invLen;
+        if (dot < 0.9999f)
+        {
+            Log::Errorf("Mismatch between quantized vertex normal [%zu]: cos(angle) = %f\n", i, dot);
+            result = TestResult::FailedMismatch;
+            break;
+        }
+    }
+
+    return result;
+}
+
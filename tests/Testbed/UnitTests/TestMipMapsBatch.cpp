@@ -0,0 +1,109 @@
+/*
+ * TestMipMapsBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Generates the MIP-maps of several textures with a single call to CommandBuffer::GenerateMips(std::uint32_t, Texture* const *).
+Each texture is filled with a solid color, so every MIP-map level must end up with the same color, including the smallest 1x1 level.
+The array contains textures of different sizes, a texture with only a single MIP-map, a duplicate entry, and null pointers, which must be ignored.
+*/
+DEF_TEST( MipMapsBatch )
+{
+    constexpr unsigned numTextures = 3;
+
+    const Extent3D texExtents[numTextures] =
+    {
+        Extent3D{ 64, 64, 1 },
+        Extent3D{ 48, 20, 1 },
+        Extent3D{ 16, 16, 1 },
+    };
+
+    const ColorRGBAub texColors[numTextures] =
+    {
+        ColorRGBAub{ 255,   0,   0, 255 },
+        ColorRGBAub{   0, 128, 255, 255 },
+        ColorRGBAub{  64, 192,  32, 255 },
+    };
+
+    // Create textures with solid colors and only initialize the first MIP-map level
+    Texture* textures[numTextures] = {};
+
+    for_range(i, numTextures)
+    {
+        const Extent3D& extent = texExtents[i];
+        std::vector<ColorRGBAub> imageData(extent.width * extent.height, texColors[i]);
+
+        ImageView srcImageView;
+        {
+            srcImageView.format     = ImageFormat::RGBA;
+            srcImageView.dataType   = DataType::UInt8;
+            srcImageView.data       = imageData.data();
+            srcImageView.dataSize   = sizeof(ColorRGBAub) * imageData.size();
+        }
+        TextureDescriptor texDesc;
+        {
+            texDesc.debugName   = "mipMapsBatchTex";
+            texDesc.bindFlags   = BindFlags::Sampled | BindFlags::ColorAttachment | BindFlags::CopySrc;
+            texDesc.format      = Format::RGBA8UNorm;
+            texDesc.extent      = extent;
+            texDesc.mipLevels   = (i + 1 == numTextures ? 1 : 0);
+        }
+        textures[i] = renderer->CreateTexture(texDesc, &srcImageView);
+    }
+
+    // Generate MIP-maps for all textures at once
+    Texture* batchTextures[] = { textures[0], nullptr, textures[1], textures[2], textures[0], nullptr };
+    constexpr std::uint32_t numBatchTextures = sizeof(batchTextures)/sizeof(batchTextures[0]);
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->GenerateMips(numBatchTextures, batchTextures);
+    }
+    cmdBuffer->End();
+
+    // Read the smallest MIP-map level of each texture and compare it with its solid color
+    TestResult result = TestResult::Passed;
+
+    for_range(i, numTextures)
+    {
+        const std::uint32_t lastMipLevel = textures[i]->GetDesc().mipLevels - 1;
+
+        ColorRGBAub pixel{ 0, 0, 0, 0 };
+        MutableImageView dstImageView;
+        {
+            dstImageView.format     = ImageFormat::RGBA;
+            dstImageView.dataType   = DataType::UInt8;
+            dstImageView.data       = &pixel;
+            dstImageView.dataSize   = sizeof(pixel);
+        }
+        const TextureRegion texRegion{ TextureSubresource{ 0, lastMipLevel }, Offset3D{}, Extent3D{ 1, 1, 1 } };
+        renderer->ReadTexture(*textures[i], texRegion, dstImageView);
+
+        if (!TestbedContext::IsRGBA8ubInThreshold(pixel.Ptr(), texColors[i].Ptr()))
+        {
+            Log::Errorf(
+                "Mismatch between texture [%u] MIP-map [%u] color (%u, %u, %u, %u) and expected value (%u, %u, %u, %u) after batched MIP-map generation\n",
+                i, lastMipLevel,
+                pixel.r, pixel.g, pixel.b, pixel.a,
+                texColors[i].r, texColors[i].g, texColors[i].b, texColors[i].a
+            );
+            result = TestResult::FailedMismatch;
+            if (!opt.greedy)
+                break;
+        }
+    }
+
+    // Clear resources
+    for (Texture* tex : textures)
+        renderer->Release(*tex);
+
+    return result;
+}
+
@@ -307,6 +307,20 @@ DEF_RITEST( ParseUtil )
         2, 3, 3
     );
 
+    PipelineLayoutDescriptor psoLayoutB;
+    {
+        psoLayoutB.bindings =
+        {
+            BindingDescriptor{ "scene",  ResourceType::Buffer,  BindFlags::AccelerationStructure, StageFlags::ComputeStage, 0 },
+            BindingDescriptor{ "output", ResourceType::Texture, BindFlags::Storage,               StageFlags::ComputeStage, 0 },
+        };
+    }
+    TEST_PARSE_PSO_LAYOUT(
+        psoLayoutB,
+        "accelstruct(scene@0):comp,"
+        "rwtexture(output@0):comp,"
+    );
+
     return TestResult::Passed;
 }
 
@@ -0,0 +1,86 @@
+/*
+ * TestPipelineAsync.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <thread>
+
+
+/*
+Creates several PSOs with asynchronous compilation and polls them until they are ready.
+Backends that don't support asynchronous compilation must report their PSOs as ready immediately.
+*/
+DEF_TEST( PipelineAsync )
+{
+    if (shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numPSOs = 8;
+
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.flags               = PipelineStateFlags::AsyncCompilation;
+        psoDesc.pipelineLayout      = layouts[PipelineTextured];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSTextured];
+        psoDesc.fragmentShader      = shaders[PSTextured];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+    }
+
+    PipelineState* pipelineStates[numPSOs] = {};
+    for_range(i, numPSOs)
+    {
+        psoDesc.rasterizer.cullMode = (i % 2 == 0 ? CullMode::Back : CullMode::Front);
+        pipelineStates[i] = renderer->CreatePipelineState(psoDesc);
+    }
+
+    // Poll PSOs until all of them are ready; IsReady() must never block
+    constexpr unsigned maxNumPolls = 10000;
+    unsigned numPolls = 0;
+
+    for (bool allReady = false; !allReady && numPolls < maxNumPolls; ++numPolls)
+    {
+        allReady = true;
+        for (PipelineState* pso : pipelineStates)
+            allReady = (allReady && pso->IsReady());
+        if (!allReady)
+            std::this_thread::yield();
+    }
+
+    TestResult result = TestResult::Passed;
+
+    // GetReport() must block until compilation has finished, so every PSO must be ready afterwards
+    for_range(i, numPSOs)
+    {
+        if (const Report* report = pipelineStates[i]->GetReport())
+        {
+            if (report->HasErrors())
+            {
+                Log::Errorf("Asynchronous PSO [%u] failed to compile:\n%s", i, report->GetText());
+                result = TestResult::FailedErrors;
+            }
+        }
+        if (!pipelineStates[i]->IsReady())
+        {
+            Log::Errorf("Asynchronous PSO [%u] is not ready after its report has been queried\n", i);
+            result = TestResult::FailedErrors;
+        }
+    }
+
+    if (opt.verbose)
+        Log::Printf("Asynchronous PSOs were ready after %u polls\n", numPolls);
+
+    for (PipelineState* pso : pipelineStates)
+        renderer->Release(*pso);
+
+    return result;
+}
+
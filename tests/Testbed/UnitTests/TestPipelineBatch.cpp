@@ -0,0 +1,79 @@
+/*
+ * TestPipelineBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Creates a batch of graphics PSOs with a single call to RenderSystem::CreatePipelineStates() and validates each individual report.
+The batch mixes synchronous and asynchronous PSOs, so backends that create a native batch must still preserve the order of the output array.
+*/
+DEF_TEST( PipelineBatch )
+{
+    if (shaders[VSTextured] == nullptr || shaders[PSTextured] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numPSOs = 8;
+
+    GraphicsPipelineDescriptor psoDescs[numPSOs];
+
+    for_range(i, numPSOs)
+    {
+        GraphicsPipelineDescriptor& psoDesc = psoDescs[i];
+        {
+            psoDesc.flags               = (i % 4 == 3 ? PipelineStateFlags::AsyncCompilation : 0);
+            psoDesc.pipelineLayout      = layouts[PipelineTextured];
+            psoDesc.renderPass          = swapChain->GetRenderPass();
+            psoDesc.vertexShader        = shaders[VSTextured];
+            psoDesc.fragmentShader      = shaders[PSTextured];
+            psoDesc.depth.testEnabled   = true;
+            psoDesc.depth.writeEnabled  = (i % 2 == 0);
+            psoDesc.rasterizer.cullMode = (i / 2 % 2 == 0 ? CullMode::Back : CullMode::Front);
+        }
+    }
+
+    PipelineState* pipelineStates[numPSOs] = {};
+    renderer->CreatePipelineStates(psoDescs, pipelineStates);
+
+    TestResult result = TestResult::Passed;
+
+    for_range(i, numPSOs)
+    {
+        if (pipelineStates[i] == nullptr)
+        {
+            Log::Errorf("Batch PSO [%u] was not created\n", i);
+            result = TestResult::FailedErrors;
+            continue;
+        }
+        if (const Report* report = pipelineStates[i]->GetReport())
+        {
+            if (report->HasErrors())
+            {
+                Log::Errorf("Batch PSO [%u] failed to compile:\n%s", i, report->GetText());
+                result = TestResult::FailedErrors;
+            }
+        }
+        if (!pipelineStates[i]->IsReady())
+        {
+            Log::Errorf("Batch PSO [%u] is not ready after its report has been queried\n", i);
+            result = TestResult::FailedErrors;
+        }
+    }
+
+    for (PipelineState* pso : pipelineStates)
+    {
+        if (pso != nullptr)
+            renderer->Release(*pso);
+    }
+
+    return result;
+}
+
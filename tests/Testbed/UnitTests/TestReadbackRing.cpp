@@ -0,0 +1,136 @@
+/*
+ * TestReadbackRing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ReadbackRing.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+/*
+Reads back a buffer range and a texture region through a ReadbackRing and maps the results once the GPU has finished the frame.
+The tickets must expire after the ring has advanced by its number of frames.
+*/
+DEF_TEST( ReadbackRing )
+{
+    constexpr std::uint32_t numFrames   = 2;
+    constexpr std::uint32_t numValues   = 16;
+    constexpr std::uint32_t texSize     = 4;
+
+    // Create source buffer and texture with initial data
+    std::uint32_t srcBufData[numValues];
+    for_range(i, numValues)
+        srcBufData[i] = (0xC0DE0000u | i);
+
+    BufferDescriptor srcBufDesc;
+    {
+        srcBufDesc.size         = sizeof(srcBufData);
+        srcBufDesc.bindFlags    = BindFlags::CopySrc;
+    }
+    CREATE_BUFFER(srcBuf, srcBufDesc, "srcBuf{size=64}", srcBufData);
+
+    ColorRGBAub srcTexData[texSize * texSize];
+    for_range(i, texSize * texSize)
+        srcTexData[i] = ColorRGBAub{ static_cast<std::uint8_t>(i * 16), 0x80, static_cast<std::uint8_t>(255 - i), 0xFF };
+
+    TextureDescriptor srcTexDesc;
+    {
+        srcTexDesc.type             = TextureType::Texture2D;
+        srcTexDesc.bindFlags        = BindFlags::Sampled | BindFlags::CopySrc;
+        srcTexDesc.format           = Format::RGBA8UNorm;
+        srcTexDesc.extent.width     = texSize;
+        srcTexDesc.extent.height    = texSize;
+        srcTexDesc.mipLevels        = 1;
+    }
+    ImageView srcTexImage;
+    {
+        srcTexImage.format      = ImageFormat::RGBA;
+        srcTexImage.dataType    = DataType::UInt8;
+        srcTexImage.data        = srcTexData;
+        srcTexImage.dataSize    = sizeof(srcTexData);
+    }
+    CREATE_TEXTURE(srcTex, srcTexDesc, "srcTex{2D,4wh}", &srcTexImage);
+
+    ReadbackRing readbackRing{ *renderer, 4096, numFrames };
+
+    // Record readbacks into the current frame of the ring
+    const TextureRegion texRegion{ Offset3D{}, srcTexDesc.extent };
+
+    ReadbackTicket bufTicket, texTicket;
+    cmdBuffer->Begin();
+    {
+        bufTicket = readbackRing.ReadBuffer(*cmdBuffer, *srcBuf, 0, sizeof(srcBufData));
+        texTicket = readbackRing.ReadTexture(*cmdBuffer, *srcTex, texRegion);
+    }
+    cmdBuffer->End();
+
+    readbackRing.Submit();
+
+    TestResult result = TestResult::Passed;
+
+    if (bufTicket.frame == 0 || texTicket.frame == 0)
+    {
+        Log::Errorf("Failed to allocate readbacks in readback ring\n");
+        result = TestResult::FailedErrors;
+    }
+    else
+    {
+        // Wait for the GPU explicitly, since the readbacks would otherwise only be polled in later frames
+        cmdQueue->WaitIdle();
+
+        if (!readbackRing.IsReady(bufTicket) || !readbackRing.IsReady(texTicket))
+        {
+            Log::Errorf("Readbacks are not ready after command queue has been idle\n");
+            result = TestResult::FailedErrors;
+        }
+
+        auto CompareReadback = [&readbackRing, &result](const char* name, const ReadbackTicket& ticket, const void* expectedData, std::size_t expectedSize) -> void
+        {
+            if (const void* mappedData = readbackRing.Map(ticket))
+            {
+                if (ticket.size != expectedSize || ::memcmp(mappedData, expectedData, expectedSize) != 0)
+                {
+                    const std::string expectedDataStr   = TestbedContext::FormatByteArray(expectedData, expectedSize, 4);
+                    const std::string actualDataStr     = TestbedContext::FormatByteArray(mappedData, static_cast<std::size_t>(ticket.size), 4);
+                    Log::Errorf(
+                        "Mismatch between %s readback and source data:\n"
+                        " -> Expected: [%s]\n"
+                        " -> Actual:   [%s]\n",
+                        name, expectedDataStr.c_str(), actualDataStr.c_str()
+                    );
+                    result = TestResult::FailedMismatch;
+                }
+                readbackRing.Unmap(ticket);
+            }
+            else
+            {
+                Log::Errorf("Failed to map %s readback\n", name);
+                result = TestResult::FailedErrors;
+            }
+        };
+
+        CompareReadback("buffer", bufTicket, srcBufData, sizeof(srcBufData));
+        CompareReadback("texture", texTicket, srcTexData, sizeof(srcTexData));
+
+        // Tickets must expire once their frame buffer has been recycled
+        for_range(i, numFrames)
+            readbackRing.Submit();
+
+        if (readbackRing.IsReady(bufTicket) || readbackRing.Map(bufTicket) != nullptr)
+        {
+            Log::Errorf("Readback ticket of frame %" PRIu64 " did not expire after %u frames\n", bufTicket.frame, numFrames);
+            result = TestResult::FailedErrors;
+        }
+    }
+
+    // Release resources
+    renderer->Release(*srcBuf);
+    renderer->Release(*srcTex);
+
+    return result;
+}
+
@@ -0,0 +1,101 @@
+/*
+ * TestReleaseInFlight.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Submits copies from a source buffer and texture into readback buffers and releases the sources right after submission, without waiting for the command queue.
+Backends that defer the destruction of released resources must keep the sources alive until the copies have completed on the GPU.
+*/
+DEF_TEST( ReleaseInFlight )
+{
+    constexpr std::uint32_t numValues = 64;
+    constexpr std::uint32_t texSize = 8;
+    static_assert(numValues == texSize*texSize, "numValues must match the number of texels");
+
+    std::uint32_t srcData[numValues];
+    for_range(i, numValues)
+        srcData[i] = 0xFF000000u | (i * 0x010203u);
+
+    // Create sources with initial data and destination buffers
+    BufferDescriptor srcBufDesc;
+    {
+        srcBufDesc.size         = sizeof(srcData);
+        srcBufDesc.bindFlags    = BindFlags::CopySrc;
+    }
+    CREATE_BUFFER(srcBuf, srcBufDesc, "srcBuf{size=256,src}", srcData);
+
+    TextureDescriptor srcTexDesc;
+    {
+        srcTexDesc.type         = TextureType::Texture2D;
+        srcTexDesc.bindFlags    = BindFlags::Sampled | BindFlags::CopySrc;
+        srcTexDesc.format       = Format::RGBA8UNorm;
+        srcTexDesc.extent       = Extent3D{ texSize, texSize, 1 };
+        srcTexDesc.mipLevels    = 1;
+    }
+    ImageView srcImage;
+    {
+        srcImage.format     = ImageFormat::RGBA;
+        srcImage.dataType   = DataType::UInt8;
+        srcImage.data       = srcData;
+        srcImage.dataSize   = sizeof(srcData);
+    }
+    CREATE_TEXTURE(srcTex, srcTexDesc, "srcTex{rgba8[8x8]}", &srcImage);
+
+    BufferDescriptor dstBufDesc;
+    {
+        dstBufDesc.size         = sizeof(srcData);
+        dstBufDesc.bindFlags    = BindFlags::CopyDst;
+    }
+    CREATE_BUFFER(dstBuf0, dstBufDesc, "dstBuf0{size=256,dst}", nullptr);
+    CREATE_BUFFER(dstBuf1, dstBufDesc, "dstBuf1{size=256,dst}", nullptr);
+
+    // Record copies into a deferred command buffer, so they are still in flight when the sources are released
+    CommandBuffer* copyCmdBuffer = renderer->CreateCommandBuffer();
+    copyCmdBuffer->Begin();
+    {
+        copyCmdBuffer->CopyBuffer(*dstBuf0, 0, *srcBuf, 0, sizeof(srcData));
+        copyCmdBuffer->CopyBufferFromTexture(*dstBuf1, 0, *srcTex, TextureRegion{ Offset3D{}, srcTexDesc.extent });
+    }
+    copyCmdBuffer->End();
+    cmdQueue->Submit(*copyCmdBuffer);
+
+    renderer->Release(*srcBuf);
+    renderer->Release(*srcTex);
+
+    cmdQueue->WaitIdle();
+
+    // Read back destination buffers
+    TestResult result = TestResult::Passed;
+
+    Buffer* dstBufs[2] = { dstBuf0, dstBuf1 };
+    for_range(i, 2)
+    {
+        std::uint32_t dstData[numValues] = {};
+        renderer->ReadBuffer(*dstBufs[i], 0, dstData, sizeof(dstData));
+        if (::memcmp(dstData, srcData, sizeof(srcData)) != 0)
+        {
+            const std::string dstDataStr = TestbedContext::FormatByteArray(dstData, sizeof(dstData), 4);
+            const std::string srcDataStr = TestbedContext::FormatByteArray(srcData, sizeof(srcData), 4);
+            Log::Errorf(
+                "Mismatch between data of destination buffer [%u] after its source was released in flight:\n -> Expected: [%s]\n -> Actual:   [%s]\n",
+                static_cast<unsigned>(i), srcDataStr.c_str(), dstDataStr.c_str()
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Release remaining resources
+    renderer->Release(*copyCmdBuffer);
+    renderer->Release(*dstBuf0);
+    renderer->Release(*dstBuf1);
+
+    return result;
+}
+
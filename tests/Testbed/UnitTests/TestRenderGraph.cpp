@@ -0,0 +1,146 @@
+/*
+ * TestRenderGraph.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/RenderGraph.h>
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+/*
+Copies a buffer into an imported output texture through a transient texture with two passes of a render graph.
+A third pass writes to another transient texture that is never read, so it must be culled and its callback must never be invoked.
+The graph is executed twice to also cover the reuse of transient textures, command buffers, and fences.
+*/
+DEF_TEST( RenderGraph )
+{
+    constexpr std::uint32_t texSize     = 32;
+    constexpr std::uint32_t numTexels   = texSize * texSize;
+
+    std::vector<ColorRGBAub> srcData(numTexels);
+    for_range(i, numTexels)
+        srcData[i] = ColorRGBAub{ static_cast<std::uint8_t>(i & 0xFF), static_cast<std::uint8_t>((i >> 8) & 0xFF), 0x3C, 0xFF };
+
+    BufferDescriptor bufDesc;
+    {
+        bufDesc.size        = srcData.size() * sizeof(ColorRGBAub);
+        bufDesc.bindFlags   = BindFlags::CopySrc;
+    }
+    CREATE_BUFFER(srcBuf, bufDesc, "srcBuf{RenderGraph}", srcData.data());
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type            = TextureType::Texture2D;
+        texDesc.bindFlags       = BindFlags::Sampled | BindFlags::ColorAttachment | BindFlags::CopySrc | BindFlags::CopyDst;
+        texDesc.miscFlags       = MiscFlags::NoInitialData;
+        texDesc.format          = Format::RGBA8UNorm;
+        texDesc.extent.width    = texSize;
+        texDesc.extent.height   = texSize;
+        texDesc.mipLevels       = 1;
+    }
+    CREATE_TEXTURE(outTex, texDesc, "outTex{RenderGraph}", nullptr);
+
+    const TextureRegion texRegion{ Offset3D{}, texDesc.extent };
+
+    RenderGraph graph{ *renderer };
+    unsigned numCulledCallbacks = 0;
+
+    TestResult result = TestResult::Passed;
+
+    for_range(iteration, 2)
+    {
+        const RenderGraphResource srcRes    = graph.ImportBuffer(*srcBuf);
+        const RenderGraphResource outRes    = graph.ImportTexture(*outTex);
+        const RenderGraphResource tempRes   = graph.CreateTransientTexture(texDesc);
+        const RenderGraphResource unusedRes = graph.CreateTransientTexture(texDesc);
+
+        const RenderGraphPass uploadPass = graph.AddPass(
+            "Upload",
+            [&](CommandBuffer& cmdBuffer)
+            {
+                cmdBuffer.CopyTextureFromBuffer(*graph.GetTexture(tempRes), texRegion, *srcBuf, 0);
+            }
+        );
+        graph.Read(uploadPass, srcRes, RenderGraphAccess::Copy);
+        graph.Write(uploadPass, tempRes, RenderGraphAccess::Copy);
+
+        const RenderGraphPass unusedPass = graph.AddPass(
+            "Unused",
+            [&](CommandBuffer& /*cmdBuffer*/)
+            {
+                ++numCulledCallbacks;
+            }
+        );
+        graph.Read(unusedPass, tempRes, RenderGraphAccess::Copy);
+        graph.Write(unusedPass, unusedRes, RenderGraphAccess::Copy);
+
+        const RenderGraphPass resolvePass = graph.AddPass(
+            "Resolve",
+            [&](CommandBuffer& cmdBuffer)
+            {
+                cmdBuffer.CopyTexture(*outTex, TextureLocation{}, *graph.GetTexture(tempRes), TextureLocation{}, texDesc.extent);
+            }
+        );
+        graph.Read(resolvePass, tempRes, RenderGraphAccess::Copy);
+        graph.Write(resolvePass, outRes, RenderGraphAccess::Copy);
+
+        graph.Execute();
+
+        if (!graph.IsPassCulled(unusedPass) || graph.IsPassCulled(uploadPass) || graph.IsPassCulled(resolvePass))
+        {
+            Log::Errorf(
+                "Mismatch between culled passes of render graph (iteration %u):\n"
+                " -> Expected: Upload = alive, Unused = culled, Resolve = alive\n"
+                " -> Actual:   Upload = %s, Unused = %s, Resolve = %s\n",
+                static_cast<unsigned>(iteration),
+                (graph.IsPassCulled(uploadPass) ? "culled" : "alive"),
+                (graph.IsPassCulled(unusedPass) ? "culled" : "alive"),
+                (graph.IsPassCulled(resolvePass) ? "culled" : "alive")
+            );
+            result = TestResult::FailedMismatch;
+        }
+
+        graph.Reset();
+
+        // Read back output texture and compare it to the source data
+        std::vector<ColorRGBAub> dstData(numTexels);
+        MutableImageView dstImage;
+        {
+            dstImage.format     = ImageFormat::RGBA;
+            dstImage.dataType   = DataType::UInt8;
+            dstImage.data       = dstData.data();
+            dstImage.dataSize   = dstData.size() * sizeof(ColorRGBAub);
+        }
+        renderer->ReadTexture(*outTex, texRegion, dstImage);
+
+        if (::memcmp(srcData.data(), dstData.data(), dstImage.dataSize) != 0)
+        {
+            const std::string expectedDataStr   = TestbedContext::FormatByteArray(srcData.data(), 16, 4);
+            const std::string actualDataStr     = TestbedContext::FormatByteArray(dstData.data(), 16, 4);
+            Log::Errorf(
+                "Mismatch between data of render graph output (iteration %u):\n"
+                " -> Expected: [%s ...]\n"
+                " -> Actual:   [%s ...]\n",
+                static_cast<unsigned>(iteration), expectedDataStr.c_str(), actualDataStr.c_str()
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    if (numCulledCallbacks != 0)
+    {
+        Log::Errorf("Callback of culled render graph pass was invoked %u time(s)\n", numCulledCallbacks);
+        result = TestResult::FailedMismatch;
+    }
+
+    // Release resources
+    renderer->Release(*srcBuf);
+    renderer->Release(*outTex);
+
+    return result;
+}
+
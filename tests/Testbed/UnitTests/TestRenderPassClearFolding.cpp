@@ -0,0 +1,126 @@
+/*
+ * TestRenderPassClearFolding.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Records clear commands immediately after BeginRenderPass(), which backends may fold into the load operations of the render pass.
+Each render pass ends without any draw commands, so the folded clears must still be applied, and the last clear of each attachment must win,
+even if the render pass itself clears the attachment with a different value on begin.
+*/
+DEF_TEST( RenderPassClearFolding )
+{
+    const Extent2D resolution{ 16, 16 };
+
+    // Create color attachment texture
+    TextureDescriptor texDesc;
+    {
+        texDesc.debugName   = "clearFoldingTex";
+        texDesc.format      = Format::RGBA8UNorm;
+        texDesc.extent      = Extent3D{ resolution.width, resolution.height, 1 };
+        texDesc.bindFlags   = BindFlags::ColorAttachment | BindFlags::CopySrc;
+        texDesc.miscFlags   = MiscFlags::NoInitialData;
+        texDesc.mipLevels   = 1;
+    }
+    Texture* colorTex = renderer->CreateTexture(texDesc);
+
+    RenderTargetDescriptor renderTargetDesc;
+    {
+        renderTargetDesc.debugName              = "clearFoldingTarget";
+        renderTargetDesc.resolution             = resolution;
+        renderTargetDesc.colorAttachments[0]    = colorTex;
+    }
+    RenderTarget* renderTarget = renderer->CreateRenderTarget(renderTargetDesc);
+
+    // Create render pass that clears its color attachment on begin
+    RenderPassDescriptor renderPassDesc;
+    {
+        renderPassDesc.debugName            = "clearFoldingPass";
+        renderPassDesc.colorAttachments[0]  = AttachmentFormatDescriptor{ Format::RGBA8UNorm, AttachmentLoadOp::Clear, AttachmentStoreOp::Store };
+    }
+    RenderPass* renderPass = renderer->CreateRenderPass(renderPassDesc);
+
+    auto ReadCenterPixel = [this, colorTex, &resolution]() -> ColorRGBAub
+    {
+        ColorRGBAub pixel{ 0, 0, 0, 0 };
+        MutableImageView dstImageView;
+        {
+            dstImageView.format     = ImageFormat::RGBA;
+            dstImageView.dataType   = DataType::UInt8;
+            dstImageView.data       = &pixel;
+            dstImageView.dataSize   = sizeof(pixel);
+        }
+        const Offset3D center{ static_cast<std::int32_t>(resolution.width/2), static_cast<std::int32_t>(resolution.height/2), 0 };
+        renderer->ReadTexture(*colorTex, TextureRegion{ center, Extent3D{ 1, 1, 1 } }, dstImageView);
+        return pixel;
+    };
+
+    TestResult result = TestResult::Passed;
+
+    auto ExpectCenterPixel = [&](const char* caseName, const ColorRGBAub& expected) -> void
+    {
+        const ColorRGBAub actual = ReadCenterPixel();
+        if (actual != expected)
+        {
+            Log::Errorf(
+                "Mismatch between clear folding case '%s' result (%u, %u, %u, %u) and expected value (%u, %u, %u, %u)\n",
+                caseName,
+                actual.r, actual.g, actual.b, actual.a,
+                expected.r, expected.g, expected.b, expected.a
+            );
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    // Case 1: Clear() followed by ClearAttachments() on the same attachment, the latter one must win
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->BeginRenderPass(*renderTarget);
+        {
+            cmdBuffer->Clear(ClearFlags::Color, ClearValue{ 1.0f, 0.0f, 0.0f, 1.0f });
+
+            const AttachmentClear attachmentClear{ ClearValue{ 0.0f, 1.0f, 0.0f, 1.0f }.color, 0 };
+            cmdBuffer->ClearAttachments(1, &attachmentClear);
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+    ExpectCenterPixel("ClearAttachmentsAfterClear", ColorRGBAub{ 0, 255, 0, 255 });
+
+    // Case 2: Render pass clears with one value on begin and Clear() overwrites it immediately afterwards
+    cmdBuffer->Begin();
+    {
+        const ClearValue renderPassClearValue{ 1.0f, 1.0f, 0.0f, 1.0f };
+        cmdBuffer->BeginRenderPass(*renderTarget, renderPass, 1, &renderPassClearValue);
+        {
+            cmdBuffer->Clear(ClearFlags::Color, ClearValue{ 0.0f, 0.0f, 1.0f, 1.0f });
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+    ExpectCenterPixel("ClearAfterRenderPassClear", ColorRGBAub{ 0, 0, 255, 255 });
+
+    // Case 3: Render pass clear without any subsequent clear command must not be dropped
+    cmdBuffer->Begin();
+    {
+        const ClearValue renderPassClearValue{ 1.0f, 0.0f, 1.0f, 1.0f };
+        cmdBuffer->BeginRenderPass(*renderTarget, renderPass, 1, &renderPassClearValue);
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+    ExpectCenterPixel("RenderPassClearOnly", ColorRGBAub{ 255, 0, 255, 255 });
+
+    // Clear resources
+    renderer->Release(*renderPass);
+    renderer->Release(*renderTarget);
+    renderer->Release(*colorTex);
+
+    return result;
+}
+
@@ -0,0 +1,152 @@
+/*
+ * TestResourceBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Creates batches of buffers and textures with RenderSystem::CreateBuffers() and RenderSystem::CreateTextures(),
+reads back their initial data, and releases them with the batch variants of RenderSystem::Release().
+Every other resource has no initial data, so backends must map each entry of the initial data arrays to its own resource.
+*/
+DEF_TEST( ResourceBatch )
+{
+    constexpr unsigned numResources = 8;
+
+    TestResult result = TestResult::Passed;
+
+    // Create batch of buffers with distinct initial data
+    std::uint32_t bufferData[numResources][4];
+    const void* bufferInitialData[numResources] = {};
+    BufferDescriptor bufferDescs[numResources];
+
+    for_range(i, numResources)
+    {
+        for_range(j, 4)
+            bufferData[i][j] = (i << 8) | j;
+        bufferInitialData[i] = (i % 2 == 0 ? bufferData[i] : nullptr);
+
+        bufferDescs[i].size         = sizeof(bufferData[i]);
+        bufferDescs[i].bindFlags    = BindFlags::VertexBuffer | BindFlags::CopySrc;
+    }
+
+    Buffer* buffers[numResources] = {};
+    renderer->CreateBuffers(bufferDescs, bufferInitialData, buffers);
+
+    for_range(i, numResources)
+    {
+        if (buffers[i] == nullptr)
+        {
+            Log::Errorf("Batch buffer [%u] was not created\n", i);
+            result = TestResult::FailedErrors;
+            continue;
+        }
+        if (bufferInitialData[i] == nullptr)
+            continue;
+
+        std::uint32_t outputData[4] = {};
+        renderer->ReadBuffer(*buffers[i], 0, outputData, sizeof(outputData));
+        if (::memcmp(outputData, bufferData[i], sizeof(outputData)) != 0)
+        {
+            Log::Errorf(
+                "Mismatch between data of batch buffer [%u] [0x%08X, 0x%08X, 0x%08X, 0x%08X] and initial data [0x%08X, 0x%08X, 0x%08X, 0x%08X]\n",
+                i,
+                outputData[0], outputData[1], outputData[2], outputData[3],
+                bufferData[i][0], bufferData[i][1], bufferData[i][2], bufferData[i][3]
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Create batch of textures with distinct initial images
+    constexpr std::uint32_t texSize = 4;
+    std::uint32_t texData[numResources][texSize*texSize];
+    ImageView texInitialImages[numResources];
+    TextureDescriptor texDescs[numResources];
+
+    for_range(i, numResources)
+    {
+        for_range(j, texSize*texSize)
+            texData[i][j] = 0xFF000000u | (i << 16) | j;
+
+        if (i % 2 == 0)
+        {
+            texInitialImages[i].format      = ImageFormat::RGBA;
+            texInitialImages[i].dataType    = DataType::UInt8;
+            texInitialImages[i].data        = texData[i];
+            texInitialImages[i].dataSize    = sizeof(texData[i]);
+        }
+
+        texDescs[i].type            = TextureType::Texture2D;
+        texDescs[i].bindFlags       = BindFlags::Sampled | BindFlags::CopySrc;
+        texDescs[i].format          = Format::RGBA8UNorm;
+        texDescs[i].extent.width    = texSize;
+        texDescs[i].extent.height   = texSize;
+        texDescs[i].mipLevels       = 1;
+    }
+
+    Texture* textures[numResources] = {};
+    renderer->CreateTextures(texDescs, texInitialImages, textures);
+
+    for_range(i, numResources)
+    {
+        if (textures[i] == nullptr)
+        {
+            Log::Errorf("Batch texture [%u] was not created\n", i);
+            result = TestResult::FailedErrors;
+            continue;
+        }
+        if (texInitialImages[i].data == nullptr)
+            continue;
+
+        std::uint32_t outputData[texSize*texSize] = {};
+        TextureRegion region;
+        {
+            region.extent = texDescs[i].extent;
+        }
+        MutableImageView dstImage;
+        {
+            dstImage.format     = ImageFormat::RGBA;
+            dstImage.dataType   = DataType::UInt8;
+            dstImage.data       = outputData;
+            dstImage.dataSize   = sizeof(outputData);
+        }
+        renderer->ReadTexture(*textures[i], region, dstImage);
+
+        if (::memcmp(outputData, texData[i], sizeof(outputData)) != 0)
+        {
+            const std::string outputDataStr = TestbedContext::FormatByteArray(outputData, sizeof(outputData), 4);
+            const std::string inputDataStr = TestbedContext::FormatByteArray(texData[i], sizeof(texData[i]), 4);
+            Log::Errorf(
+                "Mismatch between data of batch texture [%u]:\n -> Expected: [%s]\n -> Actual:   [%s]\n",
+                i, inputDataStr.c_str(), outputDataStr.c_str()
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Release all resources with a single call per resource type
+    std::vector<Buffer*> createdBuffers;
+    for (Buffer* buffer : buffers)
+    {
+        if (buffer != nullptr)
+            createdBuffers.push_back(buffer);
+    }
+    renderer->Release(createdBuffers);
+
+    std::vector<Texture*> createdTextures;
+    for (Texture* texture : textures)
+    {
+        if (texture != nullptr)
+            createdTextures.push_back(texture);
+    }
+    renderer->Release(createdTextures);
+
+    return result;
+}
+
@@ -0,0 +1,136 @@
+/*
+ * TestShaderBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <string>
+
+
+/*
+Creates a batch of shaders with a single call to RenderSystem::CreateShaders() and validates each individual report.
+The batch interleaves vertex and fragment shaders, so backends that compile concurrently must preserve the order of the output array.
+*/
+DEF_TEST( ShaderBatch )
+{
+    auto IsShadingLanguageSupported = [this](ShadingLanguage language) -> bool
+    {
+        return (std::find(caps.shadingLanguages.begin(), caps.shadingLanguages.end(), language) != caps.shadingLanguages.end());
+    };
+
+    const ShaderMacro definesEnableTexturing[] =
+    {
+        ShaderMacro{ "ENABLE_TEXTURING", "1" },
+        ShaderMacro{ nullptr, nullptr }
+    };
+
+    // Select shader files for the primary shading language of this backend
+    std::string vertPath, fragPath;
+    const char* vertEntry   = nullptr;
+    const char* fragEntry   = nullptr;
+    const char* vertProfile = nullptr;
+    const char* fragProfile = nullptr;
+    ShaderSourceType sourceType = ShaderSourceType::CodeFile;
+
+    if (IsShadingLanguageSupported(ShadingLanguage::HLSL))
+    {
+        vertPath    = fragPath = "Shaders/TriangleMesh/TriangleMesh.hlsl";
+        vertEntry   = "VSMain";
+        fragEntry   = "PSMain";
+        vertProfile = "vs_5_0";
+        fragProfile = "ps_5_0";
+    }
+    else if (IsShadingLanguageSupported(ShadingLanguage::GLSL))
+    {
+        vertPath    = "Shaders/TriangleMesh/TriangleMesh.330core.vert";
+        fragPath    = "Shaders/TriangleMesh/TriangleMesh.330core.frag";
+    }
+    else if (IsShadingLanguageSupported(ShadingLanguage::Metal))
+    {
+        vertPath    = fragPath = "Shaders/TriangleMesh/TriangleMesh.metal";
+        vertEntry   = "VSMain";
+        fragEntry   = "PSMain";
+        vertProfile = fragProfile = "1.1";
+    }
+    else if (IsShadingLanguageSupported(ShadingLanguage::SPIRV))
+    {
+        vertPath    = "Shaders/TriangleMesh/TriangleMesh.450core.vert.spv";
+        fragPath    = "Shaders/TriangleMesh/TriangleMesh.450core.frag.spv";
+        sourceType  = ShaderSourceType::BinaryFile;
+    }
+    else
+        return TestResult::Skipped;
+
+    constexpr unsigned numShaderPairs = 4;
+    constexpr unsigned numShaders = numShaderPairs * 2;
+
+    ShaderDescriptor shaderDescs[numShaders];
+
+    for_range(i, numShaderPairs)
+    {
+        // SPIR-V modules have no preprocessor, so only text based sources get the texturing variant
+        const ShaderMacro* defines = (i % 2 == 1 && sourceType != ShaderSourceType::BinaryFile ? definesEnableTexturing : nullptr);
+
+        ShaderDescriptor& vertDesc = shaderDescs[i*2];
+        {
+            vertDesc.type                   = ShaderType::Vertex;
+            vertDesc.source                 = vertPath.c_str();
+            vertDesc.sourceType             = sourceType;
+            vertDesc.entryPoint             = vertEntry;
+            vertDesc.profile                = vertProfile;
+            vertDesc.defines                = defines;
+            vertDesc.flags                  = ShaderCompileFlags::PatchClippingOrigin;
+            vertDesc.vertex.inputAttribs    = vertexFormats[VertFmtStd].attributes;
+        }
+        ShaderDescriptor& fragDesc = shaderDescs[i*2 + 1];
+        {
+            fragDesc.type                   = ShaderType::Fragment;
+            fragDesc.source                 = fragPath.c_str();
+            fragDesc.sourceType             = sourceType;
+            fragDesc.entryPoint             = fragEntry;
+            fragDesc.profile                = fragProfile;
+            fragDesc.defines                = defines;
+        }
+    }
+
+    Shader* batchShaders[numShaders] = {};
+    renderer->CreateShaders(shaderDescs, batchShaders);
+
+    TestResult result = TestResult::Passed;
+
+    for_range(i, numShaders)
+    {
+        if (batchShaders[i] == nullptr)
+        {
+            Log::Errorf("Batch shader [%u] was not created\n", i);
+            result = TestResult::FailedErrors;
+            continue;
+        }
+        if (const Report* report = batchShaders[i]->GetReport())
+        {
+            if (report->HasErrors())
+            {
+                Log::Errorf("Batch shader [%u] failed to compile:\n%s", i, report->GetText());
+                result = TestResult::FailedErrors;
+            }
+        }
+        if (batchShaders[i]->GetType() != shaderDescs[i].type)
+        {
+            Log::Errorf("Batch shader [%u] has type %s, but expected %s\n", i, ToString(batchShaders[i]->GetType()), ToString(shaderDescs[i].type));
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    for (Shader* shader : batchShaders)
+    {
+        if (shader != nullptr)
+            renderer->Release(*shader);
+    }
+
+    return result;
+}
+
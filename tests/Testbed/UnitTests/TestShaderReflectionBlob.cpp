@@ -0,0 +1,115 @@
+/*
+ * TestShaderReflectionBlob.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ShaderReflection.h>
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Reflects a shader of the backend, serializes its reflection into a blob and validates that deserializing the blob restores the same reflection.
+Then validates that truncated and corrupted blobs are rejected.
+*/
+DEF_TEST( ShaderReflectionBlob )
+{
+    if (shaders[VSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    ShaderReflection reflection;
+    if (!shaders[VSSolid]->Reflect(reflection))
+        return TestResult::Skipped;
+
+    const Blob blob = SerializeShaderReflection(reflection);
+    if (blob.GetSize() == 0)
+    {
+        Log::Errorf("Serialized shader reflection is empty\n");
+        return TestResult::FailedErrors;
+    }
+
+    ShaderReflection deserialized;
+    if (!DeserializeShaderReflection(blob.GetData(), blob.GetSize(), deserialized))
+    {
+        Log::Errorf("Failed to deserialize shader reflection (%zu bytes)\n", blob.GetSize());
+        return TestResult::FailedErrors;
+    }
+
+    TestResult result = TestResult::Passed;
+
+    auto ExpectEqualCount = [&result](const char* name, std::size_t expected, std::size_t actual)
+    {
+        if (expected != actual)
+        {
+            Log::Errorf("Mismatch between number of deserialized %s (%zu) and reflected %s (%zu)\n", name, actual, name, expected);
+            result = TestResult::FailedMismatch;
+        }
+    };
+
+    ExpectEqualCount("resources",           reflection.resources.size(),                deserialized.resources.size()               );
+    ExpectEqualCount("uniforms",            reflection.uniforms.size(),                 deserialized.uniforms.size()                );
+    ExpectEqualCount("vertex inputs",       reflection.vertex.inputAttribs.size(),      deserialized.vertex.inputAttribs.size()     );
+    ExpectEqualCount("vertex outputs",      reflection.vertex.outputAttribs.size(),     deserialized.vertex.outputAttribs.size()    );
+    ExpectEqualCount("fragment outputs",    reflection.fragment.outputAttribs.size(),   deserialized.fragment.outputAttribs.size()  );
+
+    if (result != TestResult::Passed)
+        return result;
+
+    for_range(i, reflection.resources.size())
+    {
+        const BindingDescriptor& expected   = reflection.resources[i].binding;
+        const BindingDescriptor& actual     = deserialized.resources[i].binding;
+        if (expected.name != actual.name ||
+            expected.type != actual.type ||
+            expected.bindFlags != actual.bindFlags ||
+            expected.stageFlags != actual.stageFlags ||
+            expected.slot != actual.slot ||
+            expected.arraySize != actual.arraySize ||
+            reflection.resources[i].constantBufferSize != deserialized.resources[i].constantBufferSize)
+        {
+            Log::Errorf("Mismatch between deserialized and reflected resource [%zu] \"%s\"\n", i, expected.name.c_str());
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    for_range(i, reflection.vertex.inputAttribs.size())
+    {
+        const VertexAttribute& expected = reflection.vertex.inputAttribs[i];
+        const VertexAttribute& actual   = deserialized.vertex.inputAttribs[i];
+        if (expected != actual || expected.name != actual.name)
+        {
+            Log::Errorf("Mismatch between deserialized and reflected vertex input [%zu] \"%s\"\n", i, expected.name.c_str());
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    /* Every truncated blob must be rejected */
+    for_range(size, blob.GetSize())
+    {
+        ShaderReflection truncated;
+        if (DeserializeShaderReflection(blob.GetData(), size, truncated))
+        {
+            Log::Errorf("Truncated shader reflection blob (%zu of %zu bytes) was not rejected\n", size, blob.GetSize());
+            result = TestResult::FailedErrors;
+            break;
+        }
+    }
+
+    /* A blob with a corrupted header must be rejected */
+    std::vector<char> corrupted(static_cast<const char*>(blob.GetData()), static_cast<const char*>(blob.GetData()) + blob.GetSize());
+    corrupted[0] ^= 0x7F;
+    ShaderReflection corruptedReflection;
+    if (DeserializeShaderReflection(corrupted.data(), corrupted.size(), corruptedReflection))
+    {
+        Log::Errorf("Shader reflection blob with corrupted header was not rejected\n");
+        result = TestResult::FailedErrors;
+    }
+
+    return result;
+}
+
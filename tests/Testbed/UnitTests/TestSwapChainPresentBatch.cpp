@@ -0,0 +1,97 @@
+/*
+ * TestSwapChainPresentBatch.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+
+
+/*
+Presents the swap-chain with CommandQueue::Present() instead of SwapChain::Present() for several frames.
+The array of swap-chains contains null pointers, which must be ignored, and each frame must render into the next back buffer after the batched presentation.
+*/
+DEF_TEST( SwapChainPresentBatch )
+{
+    constexpr unsigned numFrames = 4;
+
+    static Texture* framebufferResultTex;
+
+    if (frame == 0)
+    {
+        // Create 1x1 texture for framebuffer result (i.e. to read a single pixel)
+        TextureDescriptor texDesc;
+        {
+            texDesc.debugName   = "presentBatchResultTex";
+            texDesc.bindFlags   = BindFlags::CopyDst;
+            texDesc.format      = swapChain->GetColorFormat();
+            texDesc.miscFlags   = MiscFlags::NoInitialData;
+        }
+        framebufferResultTex = renderer->CreateTexture(texDesc);
+    }
+
+    // Clear back buffer with a different color each frame and capture a single pixel of it
+    const float colorValue = static_cast<float>(frame + 1) / static_cast<float>(numFrames);
+    const ClearValue clearValue{ colorValue, 1.0f - colorValue, 0.0f, 1.0f };
+    const TextureRegion texRegion{ Offset3D{ 0, 0, 0 }, Extent3D{ 1, 1, 1 } };
+
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->BeginRenderPass(*swapChain);
+        {
+            cmdBuffer->Clear(ClearFlags::Color, clearValue);
+            cmdBuffer->CopyTextureFromFramebuffer(*framebufferResultTex, texRegion, Offset2D{ 0, 0 });
+        }
+        cmdBuffer->EndRenderPass();
+    }
+    cmdBuffer->End();
+
+    // Present swap-chain as a batch of one, since null pointers in the array must be ignored
+    SwapChain* swapChains[] = { nullptr, swapChain, nullptr };
+    constexpr std::uint32_t numSwapChains = sizeof(swapChains)/sizeof(swapChains[0]);
+    cmdQueue->Present(numSwapChains, swapChains);
+
+    // Read framebuffer pixel value from intermediate texture
+    std::uint8_t framebufferResult[4] = {};
+    MutableImageView framebufferResultDesc;
+    {
+        framebufferResultDesc.data      = framebufferResult;
+        framebufferResultDesc.dataSize  = sizeof(framebufferResult);
+    }
+    renderer->ReadTexture(*framebufferResultTex, texRegion, framebufferResultDesc);
+
+    const std::uint8_t expectedResult[4] =
+    {
+        static_cast<std::uint8_t>(clearValue.color[0] * 255.0f),
+        static_cast<std::uint8_t>(clearValue.color[1] * 255.0f),
+        static_cast<std::uint8_t>(clearValue.color[2] * 255.0f),
+        static_cast<std::uint8_t>(clearValue.color[3] * 255.0f),
+    };
+
+    TestResult result = TestResult::ContinueSkipFrame;
+
+    if (!TestbedContext::IsRGBA8ubInThreshold(framebufferResult, expectedResult))
+    {
+        Log::Errorf(
+            "Mismatch between framebuffer color [%02X %02X %02X %02X] and clear value [%02X %02X %02X %02X] in frame [%u] after batched presentation\n",
+            framebufferResult[0], framebufferResult[1], framebufferResult[2], framebufferResult[3],
+            expectedResult[0], expectedResult[1], expectedResult[2], expectedResult[3],
+            frame
+        );
+        result = TestResult::FailedMismatch;
+    }
+    else if (frame + 1 == numFrames)
+        result = TestResult::Passed;
+
+    // Clear resources
+    if (result != TestResult::ContinueSkipFrame)
+    {
+        renderer->Release(*framebufferResultTex);
+        framebufferResultTex = nullptr;
+    }
+
+    return result;
+}
+
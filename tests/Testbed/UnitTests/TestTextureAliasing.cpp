@@ -0,0 +1,123 @@
+/*
+ * TestTextureAliasing.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+/*
+Places two textures at the same offset of a placement heap, writes into the first one,
+switches the memory over to the second one with an aliasing barrier, and writes and reads back the second one.
+The content of the second texture is undefined after the aliasing barrier, so only the data written afterwards is compared.
+*/
+DEF_TEST( TextureAliasing )
+{
+    if (!caps.features.hasPlacementHeaps)
+        return TestResult::Skipped;
+
+    // Both textures are color attachments, since Direct3D 12 with resource heap tier 1 can only place render targets
+    TextureDescriptor texDesc;
+    {
+        texDesc.type            = TextureType::Texture2D;
+        texDesc.bindFlags       = BindFlags::Sampled | BindFlags::ColorAttachment | BindFlags::CopySrc | BindFlags::CopyDst;
+        texDesc.miscFlags       = MiscFlags::NoInitialData;
+        texDesc.format          = Format::RGBA8UNorm;
+        texDesc.extent.width    = 64;
+        texDesc.extent.height   = 64;
+        texDesc.mipLevels       = 1;
+    }
+
+    const MemoryRequirements memReqs = renderer->GetTextureMemoryRequirements(texDesc);
+    if (memReqs.size == 0)
+    {
+        Log::Errorf("Failed to query memory requirements for placed texture\n");
+        return TestResult::FailedErrors;
+    }
+
+    PlacementHeapDescriptor heapDesc;
+    {
+        heapDesc.debugName  = "heap{aliasing}";
+        heapDesc.size       = memReqs.size;
+    }
+    PlacementHeap* heap = renderer->CreatePlacementHeap(heapDesc);
+    if (heap == nullptr)
+    {
+        Log::Errorf("Failed to create placement heap of %" PRIu64 " bytes\n", memReqs.size);
+        return TestResult::FailedErrors;
+    }
+
+    Texture* texA = renderer->CreatePlacedTexture(*heap, 0, texDesc);
+    Texture* texB = renderer->CreatePlacedTexture(*heap, 0, texDesc);
+    texA->SetDebugName("texA{2D,placed}");
+    texB->SetDebugName("texB{2D,placed}");
+
+    const std::uint32_t numTexels = texDesc.extent.width * texDesc.extent.height;
+    const TextureRegion texRegion{ Offset3D{}, texDesc.extent };
+
+    auto WriteTexels = [&](Texture& tex, std::vector<ColorRGBAub>& data)
+    {
+        ImageView srcImage;
+        {
+            srcImage.format     = ImageFormat::RGBA;
+            srcImage.dataType   = DataType::UInt8;
+            srcImage.data       = data.data();
+            srcImage.dataSize   = data.size() * sizeof(ColorRGBAub);
+        }
+        renderer->WriteTexture(tex, texRegion, srcImage);
+    };
+
+    // Write distinct image data into the first texture
+    std::vector<ColorRGBAub> srcDataA(numTexels, ColorRGBAub{ 0xFF, 0x00, 0x00, 0xFF });
+    WriteTexels(*texA, srcDataA);
+
+    // Switch memory over to the second texture
+    cmdBuffer->Begin();
+    {
+        cmdBuffer->AliasingBarrier(texA, texB);
+    }
+    cmdBuffer->End();
+
+    // Write and read back image data of the second texture
+    std::vector<ColorRGBAub> srcDataB(numTexels);
+    for_range(i, numTexels)
+        srcDataB[i] = ColorRGBAub{ static_cast<std::uint8_t>(i & 0xFF), static_cast<std::uint8_t>((i >> 8) & 0xFF), 0xA5, 0xFF };
+    WriteTexels(*texB, srcDataB);
+
+    std::vector<ColorRGBAub> dstData(numTexels);
+    MutableImageView dstImage;
+    {
+        dstImage.format     = ImageFormat::RGBA;
+        dstImage.dataType   = DataType::UInt8;
+        dstImage.data       = dstData.data();
+        dstImage.dataSize   = dstData.size() * sizeof(ColorRGBAub);
+    }
+    renderer->ReadTexture(*texB, texRegion, dstImage);
+
+    TestResult result = TestResult::Passed;
+
+    if (::memcmp(srcDataB.data(), dstData.data(), dstImage.dataSize) != 0)
+    {
+        const std::string expectedDataStr   = TestbedContext::FormatByteArray(srcDataB.data(), 16, 4);
+        const std::string actualDataStr     = TestbedContext::FormatByteArray(dstData.data(), 16, 4);
+        Log::Errorf(
+            "Mismatch between data of aliased placed texture:\n"
+            " -> Expected: [%s ...]\n"
+            " -> Actual:   [%s ...]\n",
+            expectedDataStr.c_str(), actualDataStr.c_str()
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Release placed textures before their heap
+    renderer->Release(*texA);
+    renderer->Release(*texB);
+    renderer->Release(*heap);
+
+    return result;
+}
+
@@ -0,0 +1,138 @@
+/*
+ * TestTextureContainer.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/TextureContainer.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <LLGL/Report.h>
+#include <string.h>
+
+
+template <typename T>
+static void WriteContainerValue(std::vector<char>& data, std::size_t offset, T value)
+{
+    if (data.size() < offset + sizeof(T))
+        data.resize(offset + sizeof(T));
+    ::memcpy(&data[offset], &value, sizeof(T));
+}
+
+/*
+Parses a BC7 KTX2 container with 2 MIP-maps and 2 array layers and a BC1 DDS container with 3 MIP-maps from memory.
+The KTX2 container must be uploaded with one subresource per MIP-map covering all layers, the DDS container with one subresource per MIP-map.
+The same KTX2 container with Zstandard supercompression must be rejected.
+*/
+DEF_RITEST( TextureContainer )
+{
+    TestResult result = TestResult::Passed;
+
+    // KTX2: 8x8 BC7 with 2 layers; MIP 0 has 2x2 blocks and MIP 1 has 1 block of 16 bytes per layer
+    static const std::uint8_t ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    std::vector<char> ktx2Data(ktx2Identifier, ktx2Identifier + sizeof(ktx2Identifier));
+    {
+        WriteContainerValue<std::uint32_t>(ktx2Data, 12, 145); // VK_FORMAT_BC7_UNORM_BLOCK
+        WriteContainerValue<std::uint32_t>(ktx2Data, 16, 1);   // typeSize
+        WriteContainerValue<std::uint32_t>(ktx2Data, 20, 8);   // pixelWidth
+        WriteContainerValue<std::uint32_t>(ktx2Data, 24, 8);   // pixelHeight
+        WriteContainerValue<std::uint32_t>(ktx2Data, 28, 0);   // pixelDepth
+        WriteContainerValue<std::uint32_t>(ktx2Data, 32, 2);   // layerCount
+        WriteContainerValue<std::uint32_t>(ktx2Data, 36, 1);   // faceCount
+        WriteContainerValue<std::uint32_t>(ktx2Data, 40, 2);   // levelCount
+        WriteContainerValue<std::uint32_t>(ktx2Data, 44, 0);   // supercompressionScheme
+        WriteContainerValue<std::uint64_t>(ktx2Data, 80, 160); // level[0].byteOffset
+        WriteContainerValue<std::uint64_t>(ktx2Data, 88, 128); // level[0].byteLength
+        WriteContainerValue<std::uint64_t>(ktx2Data, 96, 128); // level[0].uncompressedByteLength
+        WriteContainerValue<std::uint64_t>(ktx2Data, 104, 128); // level[1].byteOffset
+        WriteContainerValue<std::uint64_t>(ktx2Data, 112, 32);  // level[1].byteLength
+        WriteContainerValue<std::uint64_t>(ktx2Data, 120, 32);  // level[1].uncompressedByteLength
+        ktx2Data.resize(288);
+    }
+
+    TextureContainer container;
+    Report report;
+
+    if (!container.LoadFromBlob(Blob::CreateWeakRef(ktx2Data.data(), ktx2Data.size()), &report))
+    {
+        Log::Errorf("Failed to load KTX2 container: %s", report.GetText());
+        return TestResult::FailedErrors;
+    }
+
+    const TextureDescriptor& ktx2Desc = container.GetDesc();
+    const auto& ktx2Subresources = container.GetSubresources();
+
+    if (ktx2Desc.type != TextureType::Texture2DArray ||
+        ktx2Desc.format != Format::BC7UNorm ||
+        ktx2Desc.arrayLayers != 2 ||
+        ktx2Desc.mipLevels != 2 ||
+        ktx2Subresources.size() != 2 ||
+        ktx2Subresources[0].imageView.dataSize != 128 ||
+        ktx2Subresources[1].imageView.dataSize != 32 ||
+        ktx2Subresources[1].region.subresource.numArrayLayers != 2 ||
+        ktx2Subresources[1].region.extent.width != 4)
+    {
+        Log::Errorf(
+            "Mismatch between KTX2 container descriptor and expected layout:\n"
+            " -> Expected: type = Texture2DArray, format = BC7UNorm, layers = 2, MIPs = 2, subresources = 2\n"
+            " -> Actual:   type = %s, format = %s, layers = %u, MIPs = %u, subresources = %zu\n",
+            ToString(ktx2Desc.type), ToString(ktx2Desc.format), ktx2Desc.arrayLayers, ktx2Desc.mipLevels, ktx2Subresources.size()
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Supercompressed KTX2 containers must be rejected
+    WriteContainerValue<std::uint32_t>(ktx2Data, 44, 2);
+    if (container.LoadFromBlob(Blob::CreateWeakRef(ktx2Data.data(), ktx2Data.size())) ||
+        container.GetContainerFormat() != TextureContainerFormat::Undefined)
+    {
+        Log::Errorf("Supercompressed KTX2 container was not rejected\n");
+        result = TestResult::FailedMismatch;
+    }
+
+    // DDS: 6x6 BC1 with 3 MIP-maps; MIP 0 has 2x2 blocks and MIP 1 and 2 have 1 block of 8 bytes
+    std::vector<char> ddsData(128);
+    {
+        WriteContainerValue<std::uint32_t>(ddsData, 0, 0x20534444); // "DDS "
+        WriteContainerValue<std::uint32_t>(ddsData, 4, 124);        // header.size
+        WriteContainerValue<std::uint32_t>(ddsData, 12, 6);         // header.height
+        WriteContainerValue<std::uint32_t>(ddsData, 16, 6);         // header.width
+        WriteContainerValue<std::uint32_t>(ddsData, 28, 3);         // header.mipMapCount
+        WriteContainerValue<std::uint32_t>(ddsData, 76, 32);        // header.pixelFormat.size
+        WriteContainerValue<std::uint32_t>(ddsData, 80, 0x4);       // DDPF_FOURCC
+        ::memcpy(&ddsData[84], "DXT1", 4);
+        ddsData.resize(128 + 48);
+    }
+
+    if (!container.LoadFromBlob(Blob::CreateWeakRef(ddsData.data(), ddsData.size()), &report))
+    {
+        Log::Errorf("Failed to load DDS container: %s", report.GetText());
+        return TestResult::FailedErrors;
+    }
+
+    const TextureDescriptor& ddsDesc = container.GetDesc();
+    const auto& ddsSubresources = container.GetSubresources();
+
+    if (ddsDesc.type != TextureType::Texture2D ||
+        ddsDesc.format != Format::BC1UNorm ||
+        ddsDesc.mipLevels != 3 ||
+        ddsSubresources.size() != 3 ||
+        ddsSubresources[0].imageView.dataSize != 32 ||
+        ddsSubresources[2].imageView.dataSize != 8 ||
+        ddsSubresources[2].region.extent.width != 1 ||
+        ddsSubresources[2].imageView.data != ddsData.data() + 128 + 32 + 8)
+    {
+        Log::Errorf(
+            "Mismatch between DDS container descriptor and expected layout:\n"
+            " -> Expected: type = Texture2D, format = BC1UNorm, MIPs = 3, subresources = 3\n"
+            " -> Actual:   type = %s, format = %s, MIPs = %u, subresources = %zu\n",
+            ToString(ddsDesc.type), ToString(ddsDesc.format), ddsDesc.mipLevels, ddsSubresources.size()
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    return result;
+}
+
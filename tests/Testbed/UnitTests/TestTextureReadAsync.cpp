@@ -0,0 +1,126 @@
+/*
+ * TestTextureReadAsync.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+/*
+Reads back the full texture and a sub-region asynchronously with the same fence, waits for the fence, and compares both with the initial data.
+The second readback re-submits the fence before the first one has been waited on, so the backend must complete the pending readback first.
+*/
+DEF_TEST( TextureReadAsync )
+{
+    constexpr std::uint32_t texSize     = 16;
+    constexpr std::uint32_t regionSize  = 4;
+    constexpr std::uint32_t regionPos   = 8;
+
+    // Generate distinct image data for each texel
+    std::vector<ColorRGBAub> inputData(texSize * texSize);
+    for_range(i, inputData.size())
+    {
+        inputData[i] = ColorRGBAub
+        {
+            static_cast<std::uint8_t>(i & 0xFF),
+            static_cast<std::uint8_t>((i >> 8) & 0xFF),
+            0x80,
+            0xFF
+        };
+    }
+
+    ImageView srcImage;
+    {
+        srcImage.format     = ImageFormat::RGBA;
+        srcImage.dataType   = DataType::UInt8;
+        srcImage.data       = inputData.data();
+        srcImage.dataSize   = inputData.size() * sizeof(ColorRGBAub);
+    }
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type            = TextureType::Texture2D;
+        texDesc.bindFlags       = BindFlags::Sampled | BindFlags::CopySrc;
+        texDesc.format          = Format::RGBA8UNorm;
+        texDesc.extent.width    = texSize;
+        texDesc.extent.height   = texSize;
+        texDesc.mipLevels       = 1;
+    }
+    CREATE_TEXTURE(tex, texDesc, "tex{2D,16wh}", &srcImage);
+
+    // Queue readbacks of the entire texture and of a sub-region
+    std::vector<ColorRGBAub> outputData(inputData.size());
+    std::vector<ColorRGBAub> outputRegionData(regionSize * regionSize);
+
+    MutableImageView dstImage;
+    {
+        dstImage.format     = ImageFormat::RGBA;
+        dstImage.dataType   = DataType::UInt8;
+        dstImage.data       = outputData.data();
+        dstImage.dataSize   = outputData.size() * sizeof(ColorRGBAub);
+    }
+    MutableImageView dstRegionImage;
+    {
+        dstRegionImage.format   = ImageFormat::RGBA;
+        dstRegionImage.dataType = DataType::UInt8;
+        dstRegionImage.data     = outputRegionData.data();
+        dstRegionImage.dataSize = outputRegionData.size() * sizeof(ColorRGBAub);
+    }
+
+    const TextureRegion texRegion{ Offset3D{ 0, 0, 0 }, Extent3D{ texSize, texSize, 1 } };
+    const TextureRegion subRegion{ Offset3D{ regionPos, regionPos, 0 }, Extent3D{ regionSize, regionSize, 1 } };
+
+    Fence* fence = renderer->CreateFence();
+    renderer->ReadTextureAsync(*tex, texRegion, dstImage, *fence);
+    renderer->ReadTextureAsync(*tex, subRegion, dstRegionImage, *fence);
+    cmdQueue->WaitFence(*fence, ~0ull);
+
+    // Compare readback data with initial data
+    TestResult result = TestResult::Passed;
+
+    if (::memcmp(outputData.data(), inputData.data(), dstImage.dataSize) != 0)
+    {
+        const std::string inputDataStr  = TestbedContext::FormatByteArray(inputData.data(), dstImage.dataSize, 4);
+        const std::string outputDataStr = TestbedContext::FormatByteArray(outputData.data(), dstImage.dataSize, 4);
+        Log::Errorf(
+            "Mismatch between data of texture and asynchronously read back data:\n"
+            " -> Expected: [%s]\n"
+            " -> Actual:   [%s]\n",
+            inputDataStr.c_str(), outputDataStr.c_str()
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    for_range(y, regionSize)
+    {
+        if (result != TestResult::Passed && !opt.greedy)
+            break;
+
+        const ColorRGBAub* expectedRow  = &inputData[(regionPos + y) * texSize + regionPos];
+        const ColorRGBAub* actualRow    = &outputRegionData[y * regionSize];
+
+        if (::memcmp(actualRow, expectedRow, regionSize * sizeof(ColorRGBAub)) != 0)
+        {
+            const std::string inputDataStr  = TestbedContext::FormatByteArray(expectedRow, regionSize * sizeof(ColorRGBAub), 4);
+            const std::string outputDataStr = TestbedContext::FormatByteArray(actualRow, regionSize * sizeof(ColorRGBAub), 4);
+            Log::Errorf(
+                "Mismatch between row %u of texture region and asynchronously read back data:\n"
+                " -> Expected: [%s]\n"
+                " -> Actual:   [%s]\n",
+                y, inputDataStr.c_str(), outputDataStr.c_str()
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Release resources
+    renderer->Release(*fence);
+    renderer->Release(*tex);
+
+    return result;
+}
+
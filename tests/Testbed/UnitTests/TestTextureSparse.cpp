@@ -0,0 +1,105 @@
+/*
+ * TestTextureSparse.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+/*
+Maps a single tile of a sparse texture, writes and reads back the region of that tile, and unmaps it again.
+The content of unmapped tiles is undefined, so only the resident tile is compared.
+*/
+DEF_TEST( TextureSparse )
+{
+    if (!caps.features.hasSparseTextures)
+        return TestResult::Skipped;
+
+    // Determine tile extent for the standard tile shape; the texture covers 2x2 tiles
+    const Extent3D tileExtent = GetSparseTileExtent(TextureType::Texture2D, Format::RGBA8UNorm, caps.limits.sparseTileSize);
+    if (tileExtent.width == 0 || tileExtent.height == 0)
+    {
+        Log::Errorf("Failed to determine sparse tile extent for tile size of %u bytes\n", caps.limits.sparseTileSize);
+        return TestResult::FailedErrors;
+    }
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type            = TextureType::Texture2D;
+        texDesc.bindFlags       = BindFlags::Sampled | BindFlags::CopySrc | BindFlags::CopyDst;
+        texDesc.miscFlags       = MiscFlags::Sparse;
+        texDesc.format          = Format::RGBA8UNorm;
+        texDesc.extent.width    = tileExtent.width  * 2;
+        texDesc.extent.height   = tileExtent.height * 2;
+        texDesc.mipLevels       = 1;
+    }
+    CREATE_TEXTURE(tex, texDesc, "tex{2D,sparse,2x2tiles}", nullptr);
+
+    // Map the second tile of the first row
+    TileMappingDescriptor tileMapping;
+    {
+        tileMapping.texture         = tex;
+        tileMapping.tileOffset.x    = 1;
+        tileMapping.numTiles        = Extent3D{ 1, 1, 1 };
+        tileMapping.resident        = true;
+    }
+    cmdQueue->UpdateTileMappings(1, &tileMapping);
+
+    // Write distinct image data into the resident tile and read it back
+    const std::uint32_t numTexels = tileExtent.width * tileExtent.height;
+
+    std::vector<ColorRGBAub> srcData(numTexels);
+    for_range(i, numTexels)
+        srcData[i] = ColorRGBAub{ static_cast<std::uint8_t>(i & 0xFF), static_cast<std::uint8_t>((i >> 8) & 0xFF), 0x5A, 0xFF };
+
+    const TextureRegion tileRegion{ Offset3D{ static_cast<std::int32_t>(tileExtent.width), 0, 0 }, Extent3D{ tileExtent.width, tileExtent.height, 1 } };
+
+    ImageView srcImage;
+    {
+        srcImage.format     = ImageFormat::RGBA;
+        srcImage.dataType   = DataType::UInt8;
+        srcImage.data       = srcData.data();
+        srcImage.dataSize   = srcData.size() * sizeof(ColorRGBAub);
+    }
+    renderer->WriteTexture(*tex, tileRegion, srcImage);
+
+    std::vector<ColorRGBAub> dstData(numTexels);
+    MutableImageView dstImage;
+    {
+        dstImage.format     = ImageFormat::RGBA;
+        dstImage.dataType   = DataType::UInt8;
+        dstImage.data       = dstData.data();
+        dstImage.dataSize   = dstData.size() * sizeof(ColorRGBAub);
+    }
+    renderer->ReadTexture(*tex, tileRegion, dstImage);
+
+    TestResult result = TestResult::Passed;
+
+    if (::memcmp(srcData.data(), dstData.data(), srcImage.dataSize) != 0)
+    {
+        const std::string expectedDataStr   = TestbedContext::FormatByteArray(srcData.data(), 16, 4);
+        const std::string actualDataStr     = TestbedContext::FormatByteArray(dstData.data(), 16, 4);
+        Log::Errorf(
+            "Mismatch between data of resident sparse texture tile:\n"
+            " -> Expected: [%s ...]\n"
+            " -> Actual:   [%s ...]\n",
+            expectedDataStr.c_str(), actualDataStr.c_str()
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    // Unmap tile again before the texture is released
+    tileMapping.resident = false;
+    cmdQueue->UpdateTileMappings(1, &tileMapping);
+    cmdQueue->WaitIdle();
+
+    // Release resources
+    renderer->Release(*tex);
+
+    return result;
+}
+
@@ -0,0 +1,109 @@
+/*
+ * TestTextureWriteAsync.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <string.h>
+
+
+/*
+Uploads all MIP-maps of a texture in a single asynchronous batch, waits for the fence, and reads back each MIP-map.
+The uploads are passed from the finest to the coarsest MIP-map, so the backend must reorder them without losing any data.
+*/
+DEF_TEST( TextureWriteAsync )
+{
+    constexpr std::uint32_t texSize     = 16;
+    constexpr std::uint32_t numMips     = 5;
+
+    TextureDescriptor texDesc;
+    {
+        texDesc.type            = TextureType::Texture2D;
+        texDesc.bindFlags       = BindFlags::Sampled | BindFlags::CopySrc;
+        texDesc.format          = Format::RGBA8UNorm;
+        texDesc.extent.width    = texSize;
+        texDesc.extent.height   = texSize;
+        texDesc.mipLevels       = numMips;
+        texDesc.miscFlags       = MiscFlags::NoInitialData;
+    }
+    CREATE_TEXTURE(tex, texDesc, "tex{2D,16wh,5mips}", nullptr);
+
+    // Generate distinct image data for each MIP-map
+    std::vector<ColorRGBAub>    mipData[numMips];
+    TextureUploadDescriptor     uploads[numMips];
+
+    for_range(mip, numMips)
+    {
+        const std::uint32_t mipSize = (texSize >> mip);
+
+        mipData[mip].resize(mipSize * mipSize);
+        for_range(i, mipData[mip].size())
+        {
+            mipData[mip][i] = ColorRGBAub
+            {
+                static_cast<std::uint8_t>(0x10 * mip),
+                static_cast<std::uint8_t>(i & 0xFF),
+                static_cast<std::uint8_t>((i >> 8) & 0xFF),
+                0xFF
+            };
+        }
+
+        TextureUploadDescriptor& upload = uploads[mip];
+        {
+            upload.texture              = tex;
+            upload.region.subresource   = TextureSubresource{ 0, mip };
+            upload.region.extent        = Extent3D{ mipSize, mipSize, 1 };
+            upload.imageView.format     = ImageFormat::RGBA;
+            upload.imageView.dataType   = DataType::UInt8;
+            upload.imageView.data       = mipData[mip].data();
+            upload.imageView.dataSize   = mipData[mip].size() * sizeof(ColorRGBAub);
+        }
+    }
+
+    // Upload all MIP-maps at once and wait until the GPU has finished the batch
+    Fence* fence = renderer->CreateFence();
+    renderer->WriteTextureAsync(numMips, uploads, fence);
+    cmdQueue->WaitFence(*fence, ~0ull);
+
+    // Read back each MIP-map and compare it with the uploaded data
+    TestResult result = TestResult::Passed;
+
+    for_range(mip, numMips)
+    {
+        std::vector<ColorRGBAub> outputData(mipData[mip].size());
+
+        MutableImageView dstImage;
+        {
+            dstImage.format     = ImageFormat::RGBA;
+            dstImage.dataType   = DataType::UInt8;
+            dstImage.data       = outputData.data();
+            dstImage.dataSize   = outputData.size() * sizeof(ColorRGBAub);
+        }
+        renderer->ReadTexture(*tex, uploads[mip].region, dstImage);
+
+        if (::memcmp(outputData.data(), mipData[mip].data(), dstImage.dataSize) != 0)
+        {
+            const std::string inputDataStr  = TestbedContext::FormatByteArray(mipData[mip].data(), dstImage.dataSize, 4);
+            const std::string outputDataStr = TestbedContext::FormatByteArray(outputData.data(), dstImage.dataSize, 4);
+            Log::Errorf(
+                "Mismatch between data of texture MIP-map %u and asynchronously uploaded data:\n"
+                " -> Expected: [%s]\n"
+                " -> Actual:   [%s]\n",
+                mip, inputDataStr.c_str(), outputDataStr.c_str()
+            );
+            result = TestResult::FailedMismatch;
+            if (!opt.greedy)
+                break;
+        }
+    }
+
+    // Release resources
+    renderer->Release(*fence);
+    renderer->Release(*tex);
+
+    return result;
+}
+
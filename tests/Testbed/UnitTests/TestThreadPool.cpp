@@ -0,0 +1,110 @@
+/*
+ * TestThreadPool.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/ThreadPool.h>
+#include <LLGL/ImageFlags.h>
+#include <atomic>
+#include <string.h>
+
+
+// This test ensures that the worker thread pool and a custom dispatch callback produce the same results as single-threaded image conversions.
+DEF_RITEST( ThreadPool )
+{
+    TestResult result = TestResult::Passed;
+
+    // Initialize source image with a gradient pattern
+    const Extent3D imageExtent{ 512, 512, 1 };
+    const std::size_t numPixels = imageExtent.width * imageExtent.height;
+
+    std::vector<ColorRGBAub> srcData(numPixels);
+    for_range(i, numPixels)
+    {
+        srcData[i] = ColorRGBAub
+        {
+            static_cast<std::uint8_t>(i % 256),
+            static_cast<std::uint8_t>((i / 256) % 256),
+            static_cast<std::uint8_t>((i * 7) % 256),
+            static_cast<std::uint8_t>(255 - i % 256)
+        };
+    }
+
+    const ImageView srcImg{ ImageFormat::RGBA, DataType::UInt8, srcData.data(), srcData.size()*sizeof(srcData[0]) };
+
+    // Converts the source image with the specified number of threads
+    auto ConvertWithThreads = [&](unsigned threadCount) -> std::vector<ColorRGBf>
+    {
+        std::vector<ColorRGBf> dstData(numPixels);
+        const MutableImageView dstImg{ ImageFormat::RGB, DataType::Float32, dstData.data(), dstData.size()*sizeof(dstData[0]) };
+        ConvertImageBuffer(srcImg, dstImg, imageExtent, threadCount);
+        return dstData;
+    };
+
+    auto CompareResults = [&](const std::vector<ColorRGBf>& lhs, const std::vector<ColorRGBf>& rhs, const char* name) -> bool
+    {
+        if (::memcmp(lhs.data(), rhs.data(), lhs.size()*sizeof(lhs[0])) != 0)
+        {
+            Log::Errorf(Log::ColorFlags::StdError, "Mismatch between single-threaded and %s image conversion\n", name);
+            return false;
+        }
+        return true;
+    };
+
+    const std::vector<ColorRGBf> refData = ConvertWithThreads(1);
+
+    // Convert image with built-in worker thread pool
+    ThreadPoolDescriptor threadPoolDesc;
+    {
+        threadPoolDesc.numThreads = 3;
+    }
+    ThreadPool::Configure(threadPoolDesc);
+
+    if (ThreadPool::GetNumThreads() != threadPoolDesc.numThreads)
+    {
+        Log::Errorf(
+            Log::ColorFlags::StdError,
+            "Mismatch between number of worker threads (%u) and configuration (%u)\n",
+            ThreadPool::GetNumThreads(), threadPoolDesc.numThreads
+        );
+        result = TestResult::FailedMismatch;
+    }
+
+    for (unsigned threadCount : { 2u, 4u, 16u, LLGL_MAX_THREAD_COUNT })
+    {
+        if (!CompareResults(ConvertWithThreads(threadCount), refData, "pooled"))
+            result = TestResult::FailedMismatch;
+    }
+
+    // Convert image with custom dispatch callback that runs all jobs in reverse order
+    std::atomic<unsigned> numDispatches{ 0 };
+
+    ThreadPool::SetDispatchCallback(
+        [](std::size_t numJobs, const ThreadPool::JobFunction& job, void* userData)
+        {
+            static_cast<std::atomic<unsigned>*>(userData)->fetch_add(1);
+            for (std::size_t i = numJobs; i > 0; --i)
+                job(i - 1);
+        },
+        &numDispatches
+    );
+
+    if (!CompareResults(ConvertWithThreads(4), refData, "dispatched"))
+        result = TestResult::FailedMismatch;
+
+    if (numDispatches == 0)
+    {
+        Log::Errorf(Log::ColorFlags::StdError, "Custom dispatch callback was not invoked for multi-threaded image conversion\n");
+        result = TestResult::FailedErrors;
+    }
+
+    // Restore default configuration
+    ThreadPool::SetDispatchCallback(nullptr);
+    ThreadPool::Configure(ThreadPoolDescriptor{});
+
+    return result;
+}
+
@@ -0,0 +1,167 @@
+/*
+ * TestTransientBuffers.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include "Testbed.h"
+#include <LLGL/Utils/ForRange.h>
+#include <Gauss/Translate.h>
+#include <Gauss/Scale.h>
+#include <string.h>
+
+
+/*
+Renders the same scene twice: once with a separate constant buffer for each mesh and once with constants
+that are written into transient buffer memory and bound with SetConstantBufferRange.
+Both frames must be identical. The transient frame is encoded twice, so the second frame also re-uses recycled transient memory.
+*/
+DEF_TEST( TransientBuffers )
+{
+    if (!caps.features.hasTransientBuffers)
+        return TestResult::Skipped;
+
+    if (shaders[VSSolid] == nullptr || shaders[PSSolid] == nullptr)
+    {
+        Log::Errorf("Missing shaders for backend\n");
+        return TestResult::FailedErrors;
+    }
+
+    constexpr unsigned numMeshes = 3;
+
+    // Create graphics PSO
+    GraphicsPipelineDescriptor psoDesc;
+    {
+        psoDesc.pipelineLayout      = layouts[PipelineSolid];
+        psoDesc.renderPass          = swapChain->GetRenderPass();
+        psoDesc.vertexShader        = shaders[VSSolid];
+        psoDesc.fragmentShader      = shaders[PSSolid];
+        psoDesc.depth.testEnabled   = true;
+        psoDesc.depth.writeEnabled  = true;
+        psoDesc.rasterizer.cullMode = CullMode::Back;
+    }
+    CREATE_GRAPHICS_PSO(pso, psoDesc, "psoTransientBuffers");
+
+    // Create one scene buffer per mesh and keep a CPU copy of their constants
+    Buffer* sceneBuffers[numMeshes] = {};
+    SceneConstants meshConstants[numMeshes];
+
+    for_range(i, numMeshes)
+    {
+        meshConstants[i]            = {};
+        meshConstants[i].vpMatrix   = projection;
+        meshConstants[i].solidColor = Gs::Vector4f{ 1.0f - 0.3f*i, 0.5f, 0.3f*i, 1.0f };
+
+        meshConstants[i].wMatrix.LoadIdentity();
+        Gs::Translate(meshConstants[i].wMatrix, Gs::Vector3f{ -1.5f + 1.5f*i, 0.0f, 5.0f });
+        Gs::Scale(meshConstants[i].wMatrix, Gs::Vector3f{ 0.5f, 0.5f, 0.5f });
+
+        BufferDescriptor sceneBufferDesc;
+        {
+            sceneBufferDesc.size        = sizeof(SceneConstants);
+            sceneBufferDesc.bindFlags   = BindFlags::ConstantBuffer;
+        }
+        sceneBuffers[i] = renderer->CreateBuffer(sceneBufferDesc, &meshConstants[i]);
+    }
+
+    // Create readback texture
+    const Extent2D resolution = swapChain->GetResolution();
+
+    TextureDescriptor readbackTexDesc;
+    {
+        readbackTexDesc.bindFlags       = BindFlags::CopyDst;
+        readbackTexDesc.format          = swapChain->GetColorFormat();
+        readbackTexDesc.extent.width    = resolution.width;
+        readbackTexDesc.extent.height   = resolution.height;
+        readbackTexDesc.miscFlags       = MiscFlags::NoInitialData;
+        readbackTexDesc.mipLevels       = 1;
+    }
+    Texture* readbackTex = renderer->CreateTexture(readbackTexDesc);
+
+    const TextureRegion texRegion{ Offset3D{}, readbackTexDesc.extent };
+
+    const IndexedTriangleMesh& mesh = models[ModelCube];
+
+    TestResult result = TestResult::Passed;
+
+    auto RenderAndReadbackFrame = [&](bool useTransientBuffers, std::vector<ColorRGBub>& image) -> void
+    {
+        cmdBuffer->Begin();
+        {
+            cmdBuffer->SetVertexBuffer(*meshBuffer);
+            cmdBuffer->SetIndexBuffer(*meshBuffer, Format::R32UInt, mesh.indexBufferOffset);
+            cmdBuffer->BeginRenderPass(*swapChain);
+            {
+                cmdBuffer->Clear(ClearFlags::ColorDepth);
+                cmdBuffer->SetViewport(resolution);
+                cmdBuffer->SetPipelineState(*pso);
+                for_range(i, numMeshes)
+                {
+                    if (useTransientBuffers)
+                    {
+                        TransientBufferAllocation constants = cmdBuffer->AllocTransientBuffer(sizeof(SceneConstants), BindFlags::ConstantBuffer);
+                        if (constants.buffer == nullptr || constants.data == nullptr)
+                        {
+                            Log::Errorf("Failed to allocate transient buffer for mesh [%u]\n", i);
+                            result = TestResult::FailedErrors;
+                            continue;
+                        }
+                        ::memcpy(constants.data, &meshConstants[i], sizeof(SceneConstants));
+                        cmdBuffer->SetConstantBufferRange(0, *constants.buffer, constants.offset, constants.size);
+                    }
+                    else
+                        cmdBuffer->SetResource(0, *sceneBuffers[i]);
+                    cmdBuffer->DrawIndexed(mesh.numIndices, 0);
+                }
+                cmdBuffer->CopyTextureFromFramebuffer(*readbackTex, texRegion, Offset2D{});
+            }
+            cmdBuffer->EndRenderPass();
+        }
+        cmdBuffer->End();
+
+        image.resize(resolution.width * resolution.height);
+        MutableImageView dstImageView;
+        {
+            dstImageView.format     = ImageFormat::RGB;
+            dstImageView.dataType   = DataType::UInt8;
+            dstImageView.data       = image.data();
+            dstImageView.dataSize   = image.size() * sizeof(ColorRGBub);
+        }
+        renderer->ReadTexture(*readbackTex, texRegion, dstImageView);
+    };
+
+    // Render reference frame with separate constant buffers and two frames with transient constants
+    std::vector<ColorRGBub> referenceImage, resultImage;
+    RenderAndReadbackFrame(false, referenceImage);
+
+    for_range(frame, 2)
+    {
+        RenderAndReadbackFrame(true, resultImage);
+
+        if (result == TestResult::Passed && resultImage != referenceImage)
+        {
+            std::size_t numMismatches = 0;
+            for_range(i, resultImage.size())
+            {
+                if (resultImage[i] != referenceImage[i])
+                    ++numMismatches;
+            }
+            Log::Errorf(
+                "Mismatch between frame [%u] with transient constants and reference frame in %zu of %zu pixels\n",
+                frame, numMismatches, resultImage.size()
+            );
+            result = TestResult::FailedMismatch;
+        }
+    }
+
+    // Release resources
+    for (Buffer* buf : sceneBuffers)
+        renderer->Release(*buf);
+
+    renderer->Release(*readbackTex);
+    renderer->Release(*pso);
+
+    return result;
+}
+
@@ -0,0 +1,767 @@
+/*
+ * LLGLPrebuild.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/LLGL.h>
+#include <LLGL/ShaderReflection.h>
+#include <LLGL/Utils/Parse.h>
+#include <LLGL/Utils/TypeNames.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <map>
+#include <stdio.h>
+
+
+/*
+Offline prebuild tool for shaders and pipeline states.
+Usage: LLGLPrebuild MANIFEST_FILE RENDERER_MODULE OUTPUT_DIR
+
+The manifest lists shaders and pipelines in sections of key/value pairs; lines starting with '#' are comments:
+
+    [shader MeshVS]
+    type    = vert                              # vert, tesc, tese, geom, frag, comp, task, mesh, or tile
+    file    = Shaders/Mesh.hlsl                 # Files with the .spv or .dxbc extension are loaded as binaries
+    entry   = VS
+    profile = vs_5_0
+    define  = ENABLE_FOG=1                      # Can be specified multiple times
+    flags   = O3, separate                      # debug, O0, O1, O2, O3, werror, flipy, separate, metallib
+    modules = Direct3D11, Direct3D12            # Optional; section is ignored for all other renderer modules
+
+    [pipeline Mesh]
+    shaders = MeshVS, MeshPS
+    layout  = heap{ cbuffer(Scene@1):vert:frag }, texture(colorMap@2):frag, sampler(linearSampler@3):frag
+    depth   = test=on,write=on,compare=le       # See ParseContext::AsDepthDesc
+    stencil = test=off                          # See ParseContext::AsStencilDesc
+    color   = RGBA8UNorm                        # Color attachment formats, see LLGL::Format
+    depthStencil = D24UNormS8UInt
+
+Values of 'layout', 'depth', and 'stencil' use the syntax of LLGL::ParseContext. If a pipeline has no layout,
+one is generated from the reflection of its shaders, with all resources as dynamic bindings.
+
+The tool compiles all shaders and pipelines with the specified renderer and writes into OUTPUT_DIR:
+    RENDERER_MODULE.shadercache     Shader bytecode archive (RenderSystemDescriptor::shaderCacheFilename)
+    RENDERER_MODULE.pipelines/      Pipeline cache store, e.g. SPIR-V permutations and GL programs (RenderSystemDescriptor::pipelineCacheDirectory)
+    NAME.refl                       Serialized reflection of each shader (ShaderDescriptor::reflectionData)
+    NAME.layout                     Pipeline layout of each pipeline in LLGL::Parse syntax
+The client loads the renderer with the same archive and directory and creates its shaders with the same descriptors,
+so neither shader compilation nor reflection happens at runtime.
+*/
+
+struct ManifestShader
+{
+    std::string                 name;
+    LLGL::ShaderType            type            = LLGL::ShaderType::Undefined;
+    std::string                 filename;
+    std::string                 entryPoint;
+    std::string                 profile;
+    std::vector<std::string>    defines;        // Pairs of macro names and definitions
+    long                        flags           = 0;
+    LLGL::Shader*               shader          = nullptr;
+    LLGL::ShaderReflection      reflection;
+};
+
+struct ManifestPipeline
+{
+    std::string                 name;
+    std::vector<std::string>    shaders;
+    std::string                 layout;
+    std::string                 depth;
+    std::string                 stencil;
+    std::vector<LLGL::Format>   colorFormats;
+    LLGL::Format                depthStencilFormat = LLGL::Format::Undefined;
+};
+
+struct Manifest
+{
+    std::vector<ManifestShader>     shaders;
+    std::vector<ManifestPipeline>   pipelines;
+};
+
+static std::string Trim(const std::string& s)
+{
+    const std::size_t first = s.find_first_not_of(" \t\r\n");
+    if (first == std::string::npos)
+        return "";
+    const std::size_t last = s.find_last_not_of(" \t\r\n");
+    return s.substr(first, last - first + 1);
+}
+
+// Splits a comma separated list and trims each element.
+static std::vector<std::string> SplitList(const std::string& s)
+{
+    std::vector<std::string> list;
+    std::stringstream stream{ s };
+    std::string item;
+    while (std::getline(stream, item, ','))
+    {
+        item = Trim(item);
+        if (!item.empty())
+            list.push_back(item);
+    }
+    return list;
+}
+
+static bool ParseShaderType(const std::string& s, LLGL::ShaderType& outType)
+{
+    struct ShaderTypeIdent
+    {
+        const char*         ident;
+        LLGL::ShaderType    type;
+    };
+    const ShaderTypeIdent acceptedTypes[] =
+    {
+        { "vert", LLGL::ShaderType::Vertex         },
+        { "tesc", LLGL::ShaderType::TessControl    },
+        { "tese", LLGL::ShaderType::TessEvaluation },
+        { "geom", LLGL::ShaderType::Geometry       },
+        { "frag", LLGL::ShaderType::Fragment       },
+        { "comp", LLGL::ShaderType::Compute        },
+        { "task", LLGL::ShaderType::Task           },
+        { "mesh", LLGL::ShaderType::Mesh           },
+        { "tile", LLGL::ShaderType::Tile           },
+    };
+    for (const ShaderTypeIdent& ident : acceptedTypes)
+    {
+        if (s == ident.ident)
+        {
+            outType = ident.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ParseShaderFlag(const std::string& s, long& outFlags)
+{
+    struct ShaderFlagIdent
+    {
+        const char* ident;
+        long        flag;
+    };
+    const ShaderFlagIdent acceptedFlags[] =
+    {
+        { "debug",    LLGL::ShaderCompileFlags::Debug               },
+        { "O0",       LLGL::ShaderCompileFlags::NoOptimization      },
+        { "O1",       LLGL::ShaderCompileFlags::OptimizationLevel1  },
+        { "O2",       LLGL::ShaderCompileFlags::OptimizationLevel2  },
+        { "O3",       LLGL::ShaderCompileFlags::OptimizationLevel3  },
+        { "werror",   LLGL::ShaderCompileFlags::WarningsAreErrors   },
+        { "flipy",    LLGL::ShaderCompileFlags::PatchClippingOrigin },
+        { "separate", LLGL::ShaderCompileFlags::SeparateShader      },
+        { "metallib", LLGL::ShaderCompileFlags::DefaultLibrary      },
+    };
+    for (const ShaderFlagIdent& ident : acceptedFlags)
+    {
+        if (s == ident.ident)
+        {
+            outFlags |= ident.flag;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool ParseFormat(const std::string& s, LLGL::Format& outFormat)
+{
+    for (int i = 0; i <= static_cast<int>(LLGL::Format::ASTC12x12Float); ++i)
+    {
+        const LLGL::Format format = static_cast<LLGL::Format>(i);
+        if (const char* formatName = LLGL::ToString(format))
+        {
+            if (s == formatName)
+            {
+                outFormat = format;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Returns true if the specified section applies to the renderer module, i.e. if its module list is empty or contains the module.
+static bool IsModuleListed(const std::string& moduleList, const std::string& moduleName)
+{
+    if (moduleList.empty())
+        return true;
+    const std::vector<std::string> modules = SplitList(moduleList);
+    return (std::find(modules.begin(), modules.end(), moduleName) != modules.end());
+}
+
+static bool ParseShaderKey(ManifestShader& shader, const std::string& key, const std::string& value)
+{
+    if (key == "type")
+        return ParseShaderType(value, shader.type);
+    if (key == "file")
+        shader.filename = value;
+    else if (key == "entry")
+        shader.entryPoint = value;
+    else if (key == "profile")
+        shader.profile = value;
+    else if (key == "define")
+    {
+        const std::size_t assign = value.find('=');
+        shader.defines.push_back(Trim(value.substr(0, assign)));
+        shader.defines.push_back(assign != std::string::npos ? Trim(value.substr(assign + 1)) : "1");
+    }
+    else if (key == "flags")
+    {
+        for (const std::string& flag : SplitList(value))
+        {
+            if (!ParseShaderFlag(flag, shader.flags))
+                return false;
+        }
+    }
+    else
+        return false;
+    return true;
+}
+
+static bool ParsePipelineKey(ManifestPipeline& pipeline, const std::string& key, const std::string& value)
+{
+    if (key == "shaders")
+        pipeline.shaders = SplitList(value);
+    else if (key == "layout")
+        pipeline.layout = value;
+    else if (key == "depth")
+        pipeline.depth = value;
+    else if (key == "stencil")
+        pipeline.stencil = value;
+    else if (key == "color")
+    {
+        for (const std::string& formatName : SplitList(value))
+        {
+            LLGL::Format format = LLGL::Format::Undefined;
+            if (!ParseFormat(formatName, format))
+                return false;
+            pipeline.colorFormats.push_back(format);
+        }
+    }
+    else if (key == "depthStencil")
+        return ParseFormat(value, pipeline.depthStencilFormat);
+    else
+        return false;
+    return true;
+}
+
+static bool LoadManifest(const char* filename, const std::string& moduleName, Manifest& outManifest)
+{
+    std::ifstream file{ filename };
+    if (!file.good())
+    {
+        LLGL::Log::Errorf("failed to open manifest: %s\n", filename);
+        return false;
+    }
+
+    enum class SectionType { None, Shader, Pipeline };
+
+    SectionType section         = SectionType::None;
+    std::string sectionModules;
+    std::string line;
+
+    /* Drops the current section if it does not apply to the renderer module */
+    auto EndSection = [&]()
+    {
+        if (!IsModuleListed(sectionModules, moduleName))
+        {
+            if (section == SectionType::Shader)
+                outManifest.shaders.pop_back();
+            else if (section == SectionType::Pipeline)
+                outManifest.pipelines.pop_back();
+        }
+        sectionModules.clear();
+    };
+
+    for (int lineNo = 1; std::getline(file, line); ++lineNo)
+    {
+        /* Strip comments and whitespaces */
+        line = Trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+
+        if (line.front() == '[')
+        {
+            /* Parse section header, e.g. "[shader MeshVS]" */
+            EndSection();
+            if (line.back() != ']')
+            {
+                LLGL::Log::Errorf("%s(%d): missing ']' after section header\n", filename, lineNo);
+                return false;
+            }
+            const std::string header    = Trim(line.substr(1, line.size() - 2));
+            const std::size_t space     = header.find_first_of(" \t");
+            const std::string kind      = header.substr(0, space);
+            const std::string name      = (space != std::string::npos ? Trim(header.substr(space)) : "");
+            if (name.empty())
+            {
+                LLGL::Log::Errorf("%s(%d): missing name in section header\n", filename, lineNo);
+                return false;
+            }
+            if (kind == "shader")
+            {
+                section = SectionType::Shader;
+                outManifest.shaders.push_back({});
+                outManifest.shaders.back().name = name;
+            }
+            else if (kind == "pipeline")
+            {
+                section = SectionType::Pipeline;
+                outManifest.pipelines.push_back({});
+                outManifest.pipelines.back().name = name;
+            }
+            else
+            {
+                LLGL::Log::Errorf("%s(%d): unknown section type: %s\n", filename, lineNo, kind.c_str());
+                return false;
+            }
+            continue;
+        }
+
+        /* Parse key/value pair, e.g. "type = vert" */
+        const std::size_t assign = line.find('=');
+        if (assign == std::string::npos || section == SectionType::None)
+        {
+            LLGL::Log::Errorf("%s(%d): expected key/value pair inside a section\n", filename, lineNo);
+            return false;
+        }
+
+        const std::string key   = Trim(line.substr(0, assign));
+        const std::string value = Trim(line.substr(assign + 1));
+
+        bool accepted = true;
+        if (key == "modules")
+            sectionModules = value;
+        else if (section == SectionType::Shader)
+            accepted = ParseShaderKey(outManifest.shaders.back(), key, value);
+        else
+            accepted = ParsePipelineKey(outManifest.pipelines.back(), key, value);
+
+        if (!accepted)
+        {
+            LLGL::Log::Errorf("%s(%d): invalid key/value pair: %s = %s\n", filename, lineNo, key.c_str(), value.c_str());
+            return false;
+        }
+    }
+
+    EndSection();
+    return true;
+}
+
+static bool WriteFile(const std::string& filename, const void* data, std::size_t size)
+{
+    std::ofstream file{ filename, std::ios::binary };
+    file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    return file.good();
+}
+
+static void PrintReport(const std::string& name, const LLGL::Report* report)
+{
+    if (report != nullptr && *report->GetText() != '\0')
+        LLGL::Log::Printf("%s:\n%s", name.c_str(), report->GetText());
+}
+
+static bool IsBinaryShaderFile(const std::string& filename)
+{
+    const std::size_t dot = filename.rfind('.');
+    if (dot == std::string::npos)
+        return false;
+    const std::string ext = filename.substr(dot);
+    return (ext == ".spv" || ext == ".dxbc" || ext == ".dxil" || ext == ".metallib");
+}
+
+// Returns vertex attributes that are tightly packed into vertex buffer slot 0 in the order of their locations.
+static std::vector<LLGL::VertexAttribute> PackVertexAttributes(std::vector<LLGL::VertexAttribute> attribs)
+{
+    std::sort(
+        attribs.begin(), attribs.end(),
+        [](const LLGL::VertexAttribute& lhs, const LLGL::VertexAttribute& rhs)
+        {
+            return (lhs.location < rhs.location);
+        }
+    );
+
+    std::uint32_t offset = 0;
+    for (LLGL::VertexAttribute& attrib : attribs)
+    {
+        attrib.slot     = 0;
+        attrib.offset   = offset;
+        offset += LLGL::GetFormatAttribs(attrib.format).bitSize / 8;
+    }
+    for (LLGL::VertexAttribute& attrib : attribs)
+        attrib.stride = offset;
+
+    return attribs;
+}
+
+static bool BuildShader(LLGL::RenderSystem& renderer, ManifestShader& entry, const std::string& outputDir)
+{
+    std::vector<LLGL::ShaderMacro> macros;
+    for (std::size_t i = 0; i + 1 < entry.defines.size(); i += 2)
+        macros.push_back(LLGL::ShaderMacro{ entry.defines[i].c_str(), entry.defines[i + 1].c_str() });
+    macros.push_back(LLGL::ShaderMacro{ nullptr, nullptr });
+
+    LLGL::ShaderDescriptor shaderDesc;
+    {
+        shaderDesc.debugName    = entry.name.c_str();
+        shaderDesc.type         = entry.type;
+        shaderDesc.source       = entry.filename.c_str();
+        shaderDesc.sourceType   = (IsBinaryShaderFile(entry.filename) ? LLGL::ShaderSourceType::BinaryFile : LLGL::ShaderSourceType::CodeFile);
+        shaderDesc.entryPoint   = (entry.entryPoint.empty() ? nullptr : entry.entryPoint.c_str());
+        shaderDesc.profile      = (entry.profile.empty() ? nullptr : entry.profile.c_str());
+        shaderDesc.defines      = macros.data();
+        shaderDesc.flags        = entry.flags;
+    }
+    entry.shader = renderer.CreateShader(shaderDesc);
+
+    const LLGL::Report* report = entry.shader->GetReport();
+    PrintReport(entry.name, report);
+    if (report != nullptr && report->HasErrors())
+        return false;
+
+    if (!entry.shader->Reflect(entry.reflection))
+    {
+        LLGL::Log::Errorf("%s: reflection not supported by renderer\n", entry.name.c_str());
+        return false;
+    }
+
+    /* Re-create vertex shaders with their reflected input layout, so their pipelines can be built; the bytecode is taken from the archive this time */
+    if (entry.type == LLGL::ShaderType::Vertex && !entry.reflection.vertex.inputAttribs.empty())
+    {
+        shaderDesc.vertex.inputAttribs = PackVertexAttributes(entry.reflection.vertex.inputAttribs);
+        renderer.Release(*entry.shader);
+        entry.shader = renderer.CreateShader(shaderDesc);
+    }
+
+    const LLGL::Blob reflectionBlob = LLGL::SerializeShaderReflection(entry.reflection);
+    const std::string reflectionFilename = outputDir + "/" + entry.name + ".refl";
+    if (!WriteFile(reflectionFilename, reflectionBlob.GetData(), reflectionBlob.GetSize()))
+    {
+        LLGL::Log::Errorf("failed to write file: %s\n", reflectionFilename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+static const char* GetResourceTypeIdent(const LLGL::BindingDescriptor& binding)
+{
+    switch (binding.type)
+    {
+        case LLGL::ResourceType::Buffer:
+            if ((binding.bindFlags & LLGL::BindFlags::ConstantBuffer) != 0)
+                return "cbuffer";
+            return ((binding.bindFlags & LLGL::BindFlags::Storage) != 0 ? "rwbuffer" : "buffer");
+        case LLGL::ResourceType::Texture:
+            return ((binding.bindFlags & LLGL::BindFlags::Storage) != 0 ? "rwtexture" : "texture");
+        case LLGL::ResourceType::Sampler:
+            return "sampler";
+        default:
+            return nullptr;
+    }
+}
+
+static const char* GetUniformTypeIdent(LLGL::UniformType type)
+{
+    static const char* const g_uniformTypeIdents[] =
+    {
+        "float", "float2", "float3", "float4",
+        "double", "double2", "double3", "double4",
+        "int", "int2", "int3", "int4",
+        "uint", "uint2", "uint3", "uint4",
+        "bool", "bool2", "bool3", "bool4",
+        "float2x2", "float2x3", "float2x4", "float3x2", "float3x3", "float3x4", "float4x2", "float4x3", "float4x4",
+        "double2x2", "double2x3", "double2x4", "double3x2", "double3x3", "double3x4", "double4x2", "double4x3", "double4x4",
+    };
+    const int index = static_cast<int>(type) - static_cast<int>(LLGL::UniformType::Float1);
+    if (index >= 0 && index < static_cast<int>(sizeof(g_uniformTypeIdents)/sizeof(g_uniformTypeIdents[0])))
+        return g_uniformTypeIdents[index];
+    return nullptr; // Resource types are not declared as uniforms
+}
+
+static void AppendStageFlags(std::string& s, long stageFlags)
+{
+    struct StageFlagIdent
+    {
+        long        flag;
+        const char* ident;
+    };
+    const StageFlagIdent stageIdents[] =
+    {
+        { LLGL::StageFlags::VertexStage,          ":vert" },
+        { LLGL::StageFlags::TessControlStage,     ":tesc" },
+        { LLGL::StageFlags::TessEvaluationStage,  ":tese" },
+        { LLGL::StageFlags::GeometryStage,        ":geom" },
+        { LLGL::StageFlags::FragmentStage,        ":frag" },
+        { LLGL::StageFlags::ComputeStage,         ":comp" },
+        { LLGL::StageFlags::TaskStage,            ":task" },
+        { LLGL::StageFlags::MeshStage,            ":mesh" },
+        { LLGL::StageFlags::TileStage,            ":tile" },
+    };
+    for (const StageFlagIdent& ident : stageIdents)
+    {
+        if ((stageFlags & ident.flag) != 0)
+            s += ident.ident;
+    }
+}
+
+// Generates a pipeline layout in LLGL::Parse syntax from the merged reflections of the specified shaders.
+static std::string GeneratePipelineLayout(const std::vector<const ManifestShader*>& shaders)
+{
+    std::vector<LLGL::BindingDescriptor> bindings;
+    std::vector<LLGL::UniformDescriptor> uniforms;
+
+    for (const ManifestShader* shader : shaders)
+    {
+        const long stageFlags = LLGL::GetStageFlags(shader->type);
+
+        for (const LLGL::ShaderResourceReflection& resource : shader->reflection.resources)
+        {
+            /* Merge stage flags of resources that are shared between stages */
+            auto it = std::find_if(
+                bindings.begin(), bindings.end(),
+                [&resource](const LLGL::BindingDescriptor& binding)
+                {
+                    return (binding.type == resource.binding.type && binding.bindFlags == resource.binding.bindFlags && binding.slot.index == resource.binding.slot.index);
+                }
+            );
+            if (it != bindings.end())
+                it->stageFlags |= stageFlags;
+            else
+            {
+                bindings.push_back(resource.binding);
+                bindings.back().stageFlags = stageFlags;
+            }
+        }
+
+        for (const LLGL::UniformDescriptor& uniform : shader->reflection.uniforms)
+        {
+            auto it = std::find_if(
+                uniforms.begin(), uniforms.end(),
+                [&uniform](const LLGL::UniformDescriptor& entry)
+                {
+                    return (entry.name == uniform.name);
+                }
+            );
+            if (it == uniforms.end())
+                uniforms.push_back(uniform);
+        }
+    }
+
+    std::string layout;
+
+    for (const LLGL::BindingDescriptor& binding : bindings)
+    {
+        const char* typeIdent = GetResourceTypeIdent(binding);
+        if (typeIdent == nullptr)
+            continue;
+
+        if (!layout.empty())
+            layout += ",\n";
+        layout += typeIdent;
+        layout += '(';
+        if (!binding.name.empty())
+        {
+            layout += binding.name.c_str();
+            layout += '@';
+        }
+        layout += std::to_string(binding.slot.index);
+        if (binding.arraySize > 1)
+            layout += '[' + std::to_string(binding.arraySize) + ']';
+        layout += ')';
+        AppendStageFlags(layout, binding.stageFlags);
+    }
+
+    for (const LLGL::UniformDescriptor& uniform : uniforms)
+    {
+        const char* typeIdent = GetUniformTypeIdent(uniform.type);
+        if (typeIdent == nullptr)
+            continue;
+
+        if (!layout.empty())
+            layout += ",\n";
+        layout += typeIdent;
+        layout += '(';
+        layout += uniform.name.c_str();
+        if (uniform.arraySize > 1)
+            layout += '[' + std::to_string(uniform.arraySize) + ']';
+        layout += ')';
+    }
+
+    return layout;
+}
+
+static bool BuildPipeline(LLGL::RenderSystem& renderer, const ManifestPipeline& entry, const std::map<std::string, const ManifestShader*>& shaderMap, const std::string& outputDir)
+{
+    /* Resolve shader references */
+    std::vector<const ManifestShader*> shaders;
+    for (const std::string& shaderName : entry.shaders)
+    {
+        auto it = shaderMap.find(shaderName);
+        if (it == shaderMap.end())
+        {
+            LLGL::Log::Errorf("%s: unknown shader: %s\n", entry.name.c_str(), shaderName.c_str());
+            return false;
+        }
+        shaders.push_back(it->second);
+    }
+
+    /* Write pipeline layout that was either specified or generated, so the client always loads layouts the same way */
+    const std::string layoutSource = (entry.layout.empty() ? GeneratePipelineLayout(shaders) : entry.layout);
+    const std::string layoutFilename = outputDir + "/" + entry.name + ".layout";
+    if (!WriteFile(layoutFilename, layoutSource.data(), layoutSource.size()))
+    {
+        LLGL::Log::Errorf("failed to write file: %s\n", layoutFilename.c_str());
+        return false;
+    }
+
+    LLGL::PipelineLayout* pipelineLayout = renderer.CreatePipelineLayout(LLGL::Parse(LLGL::StringView{ layoutSource.data(), layoutSource.size() }));
+
+    const bool isCompute = (shaders.size() == 1 && shaders.front()->type == LLGL::ShaderType::Compute);
+
+    LLGL::PipelineState*    pipelineState   = nullptr;
+    LLGL::RenderPass*       renderPass      = nullptr;
+
+    if (isCompute)
+    {
+        LLGL::ComputePipelineDescriptor psoDesc;
+        {
+            psoDesc.debugName       = entry.name.c_str();
+            psoDesc.pipelineLayout  = pipelineLayout;
+            psoDesc.computeShader   = shaders.front()->shader;
+        }
+        pipelineState = renderer.CreatePipelineState(psoDesc);
+    }
+    else
+    {
+        LLGL::RenderPassDescriptor renderPassDesc;
+        {
+            for (std::size_t i = 0; i < entry.colorFormats.size() && i < LLGL_MAX_NUM_COLOR_ATTACHMENTS; ++i)
+                renderPassDesc.colorAttachments[i].format = entry.colorFormats[i];
+            if (LLGL::IsDepthFormat(entry.depthStencilFormat))
+                renderPassDesc.depthAttachment.format = entry.depthStencilFormat;
+            if (LLGL::IsStencilFormat(entry.depthStencilFormat))
+                renderPassDesc.stencilAttachment.format = entry.depthStencilFormat;
+        }
+        renderPass = renderer.CreateRenderPass(renderPassDesc);
+
+        LLGL::GraphicsPipelineDescriptor psoDesc;
+        {
+            psoDesc.debugName       = entry.name.c_str();
+            psoDesc.pipelineLayout  = pipelineLayout;
+            psoDesc.renderPass      = renderPass;
+            if (!entry.depth.empty())
+                psoDesc.depth = LLGL::Parse(LLGL::StringView{ entry.depth.data(), entry.depth.size() });
+            if (!entry.stencil.empty())
+                psoDesc.stencil = LLGL::Parse(LLGL::StringView{ entry.stencil.data(), entry.stencil.size() });
+        }
+        for (const ManifestShader* shader : shaders)
+        {
+            switch (shader->type)
+            {
+                case LLGL::ShaderType::Vertex:          psoDesc.vertexShader            = shader->shader; break;
+                case LLGL::ShaderType::TessControl:     psoDesc.tessControlShader       = shader->shader; break;
+                case LLGL::ShaderType::TessEvaluation:  psoDesc.tessEvaluationShader    = shader->shader; break;
+                case LLGL::ShaderType::Geometry:        psoDesc.geometryShader          = shader->shader; break;
+                case LLGL::ShaderType::Fragment:        psoDesc.fragmentShader          = shader->shader; break;
+                case LLGL::ShaderType::Task:            psoDesc.taskShader              = shader->shader; break;
+                case LLGL::ShaderType::Mesh:            psoDesc.meshShader              = shader->shader; break;
+                case LLGL::ShaderType::Tile:            psoDesc.tileShader              = shader->shader; break;
+                default:
+                    LLGL::Log::Errorf("%s: cannot use %s shader in graphics pipeline: %s\n", entry.name.c_str(), LLGL::ToString(shader->type), shader->name.c_str());
+                    return false;
+            }
+        }
+        pipelineState = renderer.CreatePipelineState(psoDesc);
+    }
+
+    const LLGL::Report* report = pipelineState->GetReport();
+    PrintReport(entry.name, report);
+    const bool succeeded = (report == nullptr || !report->HasErrors());
+
+    renderer.Release(*pipelineState);
+    if (renderPass != nullptr)
+        renderer.Release(*renderPass);
+    renderer.Release(*pipelineLayout);
+
+    return succeeded;
+}
+
+int main(int argc, char* argv[])
+{
+    LLGL::Log::RegisterCallbackStd();
+
+    if (argc < 4)
+    {
+        LLGL::Log::Printf("usage: LLGLPrebuild MANIFEST_FILE RENDERER_MODULE OUTPUT_DIR\n");
+        return 1;
+    }
+
+    const char*         manifestFile    = argv[1];
+    const std::string   rendererModule  = argv[2];
+    const std::string   outputDir       = argv[3];
+
+    Manifest manifest;
+    if (!LoadManifest(manifestFile, rendererModule, manifest))
+        return 1;
+
+    /* Load renderer with the output archive and pipeline cache store, so every compiled shader and pipeline is persisted when the renderer is unloaded */
+    const std::string shaderCacheFilename       = outputDir + "/" + rendererModule + ".shadercache";
+    const std::string pipelineCacheDirectory    = outputDir + "/" + rendererModule + ".pipelines";
+
+    LLGL::RenderSystemDescriptor rendererDesc;
+    {
+        rendererDesc.moduleName             = rendererModule.c_str();
+        rendererDesc.shaderCacheFilename    = shaderCacheFilename.c_str();
+        rendererDesc.pipelineCacheDirectory = pipelineCacheDirectory.c_str();
+    }
+    LLGL::Report report;
+    LLGL::RenderSystemPtr renderer = LLGL::RenderSystem::Load(rendererDesc, &report);
+    if (!renderer)
+    {
+        LLGL::Log::Errorf("%s", report.GetText());
+        return 1;
+    }
+
+    int numErrors = 0;
+
+    std::map<std::string, const ManifestShader*> shaderMap;
+    for (ManifestShader& shader : manifest.shaders)
+    {
+        LLGL::Log::Printf("build shader: %s\n", shader.name.c_str());
+        if (BuildShader(*renderer, shader, outputDir))
+            shaderMap[shader.name] = &shader;
+        else
+            ++numErrors;
+    }
+
+    for (const ManifestPipeline& pipeline : manifest.pipelines)
+    {
+        LLGL::Log::Printf("build pipeline: %s\n", pipeline.name.c_str());
+        if (!BuildPipeline(*renderer, pipeline, shaderMap, outputDir))
+            ++numErrors;
+    }
+
+    for (ManifestShader& shader : manifest.shaders)
+    {
+        if (shader.shader != nullptr)
+            renderer->Release(*shader.shader);
+    }
+
+    LLGL::RenderSystem::Unload(std::move(renderer));
+
+    LLGL::Log::Printf(
+        "prebuilt %zu shader(s) and %zu pipeline(s) for renderer \"%s\" with %d error(s)\n",
+        manifest.shaders.size(), manifest.pipelines.size(), rendererModule.c_str(), numErrors
+    );
+
+    return (numErrors == 0 ? 0 : 1);
+}
+
+
+
+// ================================================================================
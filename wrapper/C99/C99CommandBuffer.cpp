@@ -44,11 +44,26 @@ LLGL_C_EXPORT void llglUpdateBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, co
     g_CurrentCmdBuf->UpdateBuffer(LLGL_REF(Buffer, dstBuffer), dstOffset, data, dataSize);
 }
 
+LLGL_C_EXPORT void llglAllocTransientBuffer(uint64_t size, long bindFlags, uint64_t alignment, LLGLTransientBufferAllocation* outAllocation)
+{
+    LLGL_ASSERT_PTR(outAllocation);
+    const TransientBufferAllocation allocation = g_CurrentCmdBuf->AllocTransientBuffer(size, bindFlags, alignment);
+    outAllocation->buffer   = LLGLBuffer{ allocation.buffer };
+    outAllocation->offset   = allocation.offset;
+    outAllocation->size     = allocation.size;
+    outAllocation->data     = allocation.data;
+}
+
 LLGL_C_EXPORT void llglCopyBuffer(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLBuffer srcBuffer, uint64_t srcOffset, uint64_t size)
 {
     g_CurrentCmdBuf->CopyBuffer(LLGL_REF(Buffer, dstBuffer), dstOffset, LLGL_REF(Buffer, srcBuffer), srcOffset, size);
 }
 
+LLGL_C_EXPORT void llglCopyBufferRegions(LLGLBuffer dstBuffer, LLGLBuffer srcBuffer, uint32_t numRegions, const LLGLBufferCopyRegion* regions)
+{
+    g_CurrentCmdBuf->CopyBufferRegions(LLGL_REF(Buffer, dstBuffer), LLGL_REF(Buffer, srcBuffer), numRegions, (const BufferCopyRegion*)regions);
+}
+
 LLGL_C_EXPORT void llglCopyBufferFromTexture(LLGLBuffer dstBuffer, uint64_t dstOffset, LLGLTexture srcTexture, const LLGLTextureRegion* srcRegion, uint32_t rowStride, uint32_t layerStride)
 {
     g_CurrentCmdBuf->CopyBufferFromTexture(LLGL_REF(Buffer, dstBuffer), dstOffset, LLGL_REF(Texture, srcTexture), *(const TextureRegion*)srcRegion, rowStride, layerStride);
@@ -64,6 +79,11 @@ LLGL_C_EXPORT void llglCopyTexture(LLGLTexture dstTexture, const LLGLTextureLoca
     g_CurrentCmdBuf->CopyTexture(LLGL_REF(Texture, dstTexture), *(const TextureLocation*)dstLocation, LLGL_REF(Texture, srcTexture), *(const TextureLocation*)srcLocation, *(const Extent3D*)extent);
 }
 
+LLGL_C_EXPORT void llglCopyTextureRegions(LLGLTexture dstTexture, LLGLTexture srcTexture, uint32_t numRegions, const LLGLTextureCopyRegion* regions)
+{
+    g_CurrentCmdBuf->CopyTextureRegions(LLGL_REF(Texture, dstTexture), LLGL_REF(Texture, srcTexture), numRegions, (const TextureCopyRegion*)regions);
+}
+
 LLGL_C_EXPORT void llglCopyTextureFromBuffer(LLGLTexture dstTexture, const LLGLTextureRegion* dstRegion, LLGLBuffer srcBuffer, uint64_t srcOffset, uint32_t rowStride, uint32_t layerStride)
 {
     g_CurrentCmdBuf->CopyTextureFromBuffer(LLGL_REF(Texture, dstTexture), *(const TextureRegion*)dstRegion, LLGL_REF(Buffer, srcBuffer), srcOffset, rowStride, layerStride);
@@ -84,6 +104,22 @@ LLGL_C_EXPORT void llglGenerateMipsRange(LLGLTexture texture, const LLGLTextureS
     g_CurrentCmdBuf->GenerateMips(LLGL_REF(Texture, texture), *(const TextureSubresource*)subresource);
 }
 
+LLGL_C_EXPORT void llglGenerateMipsBatch(uint32_t numTextures, const LLGLTexture* textures)
+{
+    /* Wrapper handles have the same layout as their object pointers; see C99TypeAssertions.cpp */
+    g_CurrentCmdBuf->GenerateMips(numTextures, reinterpret_cast<Texture* const*>(textures));
+}
+
+LLGL_C_EXPORT void llglResolveSamplerFeedback(LLGLTexture feedbackTexture, uint32_t mipLevel, uint32_t arrayLayer, LLGLBuffer dstBuffer, uint64_t dstOffset)
+{
+    g_CurrentCmdBuf->ResolveSamplerFeedback(LLGL_REF(Texture, feedbackTexture), mipLevel, arrayLayer, LLGL_REF(Buffer, dstBuffer), dstOffset);
+}
+
+LLGL_C_EXPORT void llglClearSamplerFeedback(LLGLTexture feedbackTexture)
+{
+    g_CurrentCmdBuf->ClearSamplerFeedback(LLGL_REF(Texture, feedbackTexture));
+}
+
 LLGL_C_EXPORT void llglSetViewport(const LLGLViewport* viewport)
 {
     g_CurrentCmdBuf->SetViewport(*(const Viewport*)viewport);
@@ -134,38 +170,25 @@ LLGL_C_EXPORT void llglSetResource(uint32_t descriptor, LLGLResource resource)
     g_CurrentCmdBuf->SetResource(descriptor, LLGL_REF(Resource, resource));
 }
 
-LLGL_C_EXPORT void llglResourceBarrier(uint32_t numBuffers, const LLGLBuffer* buffers, uint32_t numTextures, const LLGLTexture* textures)
+LLGL_C_EXPORT void llglSetConstantBufferRange(uint32_t descriptor, LLGLBuffer buffer, uint64_t offset, uint64_t size)
 {
-    constexpr uint32_t maxStaticArray = 64;
-    Buffer* internalBuffers[maxStaticArray];
-    Texture* internalTextures[maxStaticArray];
-    if (numBuffers <= maxStaticArray && numTextures <= maxStaticArray)
-    {
-        for_range(i, numBuffers)
-            internalBuffers[i] = LLGL_PTR(Buffer, buffers[i]);
-        for_range(i, numTextures)
-            internalTextures[i] = LLGL_PTR(Texture, textures[i]);
-        g_CurrentCmdBuf->ResourceBarrier(numBuffers, internalBuffers, numTextures, internalTextures);
-    }
-    else
-    {
-        while (numBuffers > 0 || numTextures > 0)
-        {
-            const uint32_t numBuffersPerBatch = std::min<uint32_t>(numBuffers, maxStaticArray);
-            for_range(i, numBuffersPerBatch)
-                internalBuffers[i] = LLGL_PTR(Buffer, buffers[i]);
-
-            const uint32_t numTexturesPerBatch = std::min<uint32_t>(numTextures, maxStaticArray);
-            for_range(i, numTexturesPerBatch)
-                internalTextures[i] = LLGL_PTR(Texture, textures[i]);
+    g_CurrentCmdBuf->SetConstantBufferRange(descriptor, LLGL_REF(Buffer, buffer), offset, size);
+}
 
-            g_CurrentCmdBuf->ResourceBarrier(numBuffersPerBatch, internalBuffers, numTexturesPerBatch, internalTextures);
+LLGL_C_EXPORT void llglResourceBarrier(uint32_t numBuffers, const LLGLBuffer* buffers, uint32_t numTextures, const LLGLTexture* textures)
+{
+    /* Wrapper handles have the same layout as their object pointers; see C99TypeAssertions.cpp */
+    g_CurrentCmdBuf->ResourceBarrier(
+        numBuffers,
+        reinterpret_cast<Buffer* const*>(buffers),
+        numTextures,
+        reinterpret_cast<Texture* const*>(textures)
+    );
+}
 
-            numBuffers -= numBuffersPerBatch;
-            buffers += numBuffersPerBatch;
-            textures += numTexturesPerBatch;
-        }
-    }
+LLGL_C_EXPORT void llglAliasingBarrier(LLGLTexture textureBefore, LLGLTexture textureAfter)
+{
+    g_CurrentCmdBuf->AliasingBarrier(LLGL_PTR(Texture, textureBefore), LLGL_PTR(Texture, textureAfter));
 }
 
 LLGL_C_EXPORT void llglResetResourceSlots(LLGLResourceType resourceType, uint32_t firstSlot, uint32_t numSlots, long bindFlags, long stageFlags)
@@ -213,6 +236,11 @@ LLGL_C_EXPORT void llglSetStencilReference(uint32_t reference, LLGLStencilFace s
     g_CurrentCmdBuf->SetStencilReference(reference, (StencilFace)stencilFace);
 }
 
+LLGL_C_EXPORT void llglSetShadingRate(LLGLShadingRate rate)
+{
+    g_CurrentCmdBuf->SetShadingRate((ShadingRate)rate);
+}
+
 LLGL_C_EXPORT void llglSetUniforms(uint32_t first, const void* data, uint16_t dataSize)
 {
     g_CurrentCmdBuf->SetUniforms(first, data, dataSize);
@@ -228,6 +256,11 @@ LLGL_C_EXPORT void llglEndQuery(LLGLQueryHeap queryHeap, uint32_t query)
     g_CurrentCmdBuf->EndQuery(LLGL_REF(QueryHeap, queryHeap), query);
 }
 
+LLGL_C_EXPORT void llglResolveQueryData(LLGLQueryHeap srcQueryHeap, uint32_t firstQuery, uint32_t numQueries, LLGLBuffer dstBuffer, uint64_t dstOffset)
+{
+    g_CurrentCmdBuf->ResolveQueryData(LLGL_REF(QueryHeap, srcQueryHeap), firstQuery, numQueries, LLGL_REF(Buffer, dstBuffer), dstOffset);
+}
+
 LLGL_C_EXPORT void llglBeginRenderCondition(LLGLQueryHeap queryHeap, uint32_t query, LLGLRenderConditionMode mode)
 {
     g_CurrentCmdBuf->BeginRenderCondition(LLGL_REF(QueryHeap, queryHeap), query, (RenderConditionMode)mode);
@@ -240,10 +273,7 @@ LLGL_C_EXPORT void llglEndRenderCondition()
 
 LLGL_C_EXPORT void llglBeginStreamOutput(uint32_t numBuffers, LLGLBuffer const * buffers)
 {
-    Buffer* internalBuffers[LLGL_MAX_NUM_SO_BUFFERS];
-    for_range(i, numBuffers)
-        internalBuffers[i] = LLGL_PTR(Buffer, buffers[i]);
-    g_CurrentCmdBuf->BeginStreamOutput(numBuffers, internalBuffers);
+    g_CurrentCmdBuf->BeginStreamOutput(numBuffers, reinterpret_cast<Buffer* const*>(buffers));
 }
 
 LLGL_C_EXPORT void llglEndStreamOutput()
@@ -306,11 +336,129 @@ LLGL_C_EXPORT void llglDrawIndexedIndirectExt(LLGLBuffer buffer, uint64_t offset
     g_CurrentCmdBuf->DrawIndexedIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
 }
 
+LLGL_C_EXPORT void llglDrawIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndirectCount(LLGL_REF(Buffer, buffer), offset, LLGL_REF(Buffer, countBuffer), countOffset, maxNumCommands, stride);
+}
+
+LLGL_C_EXPORT void llglDrawIndexedIndirectCount(LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawIndexedIndirectCount(LLGL_REF(Buffer, buffer), offset, LLGL_REF(Buffer, countBuffer), countOffset, maxNumCommands, stride);
+}
+
 LLGL_C_EXPORT void llglDrawStreamOutput()
 {
     g_CurrentCmdBuf->DrawStreamOutput();
 }
 
+LLGL_C_EXPORT void llglDrawMeshTasks(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ)
+{
+    g_CurrentCmdBuf->DrawMeshTasks(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+}
+
+LLGL_C_EXPORT void llglDrawMeshTasksIndirect(LLGLBuffer buffer, uint64_t offset, uint32_t numCommands, uint32_t stride)
+{
+    g_CurrentCmdBuf->DrawMeshTasksIndirect(LLGL_REF(Buffer, buffer), offset, numCommands, stride);
+}
+
+LLGL_C_EXPORT void llglDispatchTiles()
+{
+    g_CurrentCmdBuf->DispatchTiles();
+}
+
+LLGL_C_EXPORT void llglExecuteIndirect(const LLGLIndirectCommandDescriptor* commandDesc, LLGLBuffer buffer, uint64_t offset, LLGLBuffer countBuffer, uint64_t countOffset, uint32_t maxNumCommands)
+{
+    LLGL_ASSERT_PTR(commandDesc);
+    IndirectCommandDescriptor internalCommandDesc;
+    {
+        internalCommandDesc.arguments   = ArrayView<IndirectArgumentDescriptor>{ reinterpret_cast<const IndirectArgumentDescriptor*>(commandDesc->arguments), commandDesc->numArguments };
+        internalCommandDesc.stride      = commandDesc->stride;
+    }
+    g_CurrentCmdBuf->ExecuteIndirect(internalCommandDesc, LLGL_REF(Buffer, buffer), offset, LLGL_PTR(Buffer, countBuffer), countOffset, maxNumCommands);
+}
+
+LLGL_C_EXPORT void llglDrawPacked(const LLGLDrawPackedDescriptor* drawDesc)
+{
+    LLGL_ASSERT_PTR(drawDesc);
+    DrawPackedDescriptor internalDrawDesc;
+    {
+        internalDrawDesc.vertexBuffers  = ArrayView<Buffer*>{ reinterpret_cast<Buffer* const*>(drawDesc->vertexBuffers), drawDesc->numVertexBuffers };
+        internalDrawDesc.indexBuffers   = ArrayView<Buffer*>{ reinterpret_cast<Buffer* const*>(drawDesc->indexBuffers), drawDesc->numIndexBuffers };
+        internalDrawDesc.indexFormat    = static_cast<Format>(drawDesc->indexFormat);
+        internalDrawDesc.resourceHeaps  = ArrayView<ResourceHeap*>{ reinterpret_cast<ResourceHeap* const*>(drawDesc->resourceHeaps), drawDesc->numResourceHeaps };
+        internalDrawDesc.uniformData    = drawDesc->uniformData;
+        internalDrawDesc.firstUniform   = drawDesc->firstUniform;
+        internalDrawDesc.uniformsSize   = drawDesc->uniformsSize;
+        internalDrawDesc.indexed        = drawDesc->indexed;
+        internalDrawDesc.records        = ArrayView<DrawRecord>{ reinterpret_cast<const DrawRecord*>(drawDesc->records), drawDesc->numRecords };
+    }
+    g_CurrentCmdBuf->DrawPacked(internalDrawDesc);
+}
+
+template <typename T>
+static T& GetCommandBatchObject(const LLGLCommandBatchDescriptor& batchDesc, const LLGLCommandRecord& record)
+{
+    LLGL_ASSERT(record.objectIndex < batchDesc.numObjects, "command record object index out of bounds");
+    return LLGL_REF(T, batchDesc.objects[record.objectIndex]);
+}
+
+LLGL_C_EXPORT void llglExecuteCommandBatch(const LLGLCommandBatchDescriptor* batchDesc)
+{
+    LLGL_ASSERT_PTR(batchDesc);
+
+    /* Decode all records in a single call, so language bindings only cross the native boundary once per batch */
+    CommandBuffer* cmdBuffer = g_CurrentCmdBuf;
+    const char* uniformData = static_cast<const char*>(batchDesc->uniformData);
+
+    for_range(i, batchDesc->numRecords)
+    {
+        const LLGLCommandRecord& record = batchDesc->records[i];
+        switch (record.opcode)
+        {
+            case LLGLCommandOpcodeSetPipelineState:
+                cmdBuffer->SetPipelineState(GetCommandBatchObject<PipelineState>(*batchDesc, record));
+                break;
+
+            case LLGLCommandOpcodeSetVertexBuffer:
+                cmdBuffer->SetVertexBuffer(GetCommandBatchObject<Buffer>(*batchDesc, record));
+                break;
+
+            case LLGLCommandOpcodeSetIndexBuffer:
+                cmdBuffer->SetIndexBuffer(GetCommandBatchObject<Buffer>(*batchDesc, record), static_cast<Format>(record.arg0), record.arg1);
+                break;
+
+            case LLGLCommandOpcodeSetResourceHeap:
+                cmdBuffer->SetResourceHeap(GetCommandBatchObject<ResourceHeap>(*batchDesc, record), record.arg0);
+                break;
+
+            case LLGLCommandOpcodeSetResource:
+                cmdBuffer->SetResource(record.arg0, GetCommandBatchObject<Resource>(*batchDesc, record));
+                break;
+
+            case LLGLCommandOpcodeSetUniforms:
+                LLGL_ASSERT_PTR(uniformData);
+                cmdBuffer->SetUniforms(record.arg0, uniformData + record.arg1, static_cast<std::uint16_t>(record.arg2));
+                break;
+
+            case LLGLCommandOpcodeDraw:
+                cmdBuffer->DrawInstanced(record.arg0, record.arg1, record.arg2, record.arg3);
+                break;
+
+            case LLGLCommandOpcodeDrawIndexed:
+                cmdBuffer->DrawIndexedInstanced(record.arg0, record.arg2, record.arg1, static_cast<std::int32_t>(record.arg3), record.arg4);
+                break;
+
+            case LLGLCommandOpcodeDispatch:
+                cmdBuffer->Dispatch(record.arg0, record.arg1, record.arg2);
+                break;
+
+            default:
+                LLGL_TRAP("invalid command record opcode: %d", static_cast<int>(record.opcode));
+                break;
+        }
+    }
+}
+
 LLGL_C_EXPORT void llglDispatch(uint32_t numWorkGroupsX, uint32_t numWorkGroupsY, uint32_t numWorkGroupsZ)
 {
     g_CurrentCmdBuf->Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
@@ -321,6 +469,27 @@ LLGL_C_EXPORT void llglDispatchIndirect(LLGLBuffer buffer, uint64_t offset)
     g_CurrentCmdBuf->DispatchIndirect(LLGL_REF(Buffer, buffer), offset);
 }
 
+static void ConvertAccelerationStructureDesc(AccelerationStructureDescriptor& dst, const LLGLAccelerationStructureDescriptor& src)
+{
+    dst.type        = static_cast<AccelerationStructureType>(src.type);
+    dst.flags       = src.flags;
+    dst.geometries  = ArrayView<AccelerationStructureGeometryDescriptor>{ reinterpret_cast<const AccelerationStructureGeometryDescriptor*>(src.geometries), src.numGeometries };
+    dst.instances   = ArrayView<AccelerationStructureInstance>{ reinterpret_cast<const AccelerationStructureInstance*>(src.instances), src.numInstances };
+}
+
+LLGL_C_EXPORT void llglBuildAccelerationStructure(LLGLBuffer dstBuffer, LLGLBuffer scratchBuffer, const LLGLAccelerationStructureDescriptor* desc, LLGLBuffer srcBuffer)
+{
+    LLGL_ASSERT_PTR(desc);
+    AccelerationStructureDescriptor internalDesc;
+    ConvertAccelerationStructureDesc(internalDesc, *desc);
+    g_CurrentCmdBuf->BuildAccelerationStructure(LLGL_REF(Buffer, dstBuffer), LLGL_REF(Buffer, scratchBuffer), internalDesc, LLGL_PTR(Buffer, srcBuffer));
+}
+
+LLGL_C_EXPORT void llglDispatchRays(uint32_t width, uint32_t height, uint32_t depth)
+{
+    g_CurrentCmdBuf->DispatchRays(width, height, depth);
+}
+
 LLGL_C_EXPORT void llglPushDebugGroup(const char* name)
 {
     g_CurrentCmdBuf->PushDebugGroup(name);
@@ -6,6 +6,7 @@
  */
 
 #include <LLGL/CommandQueue.h>
+#include <LLGL/TextureFlags.h>
 #include <LLGL-C/CommandQueue.h>
 #include "C99Internal.h"
 #include "../../sources/Core/Assertion.h"
@@ -44,6 +45,11 @@ LLGL_C_EXPORT void llglWaitIdle()
     g_CurrentCmdQueue->WaitIdle();
 }
 
+LLGL_C_EXPORT void llglUpdateTileMappings(uint32_t numMappings, const LLGLTileMappingDescriptor* mappings)
+{
+    g_CurrentCmdQueue->UpdateTileMappings(numMappings, reinterpret_cast<const TileMappingDescriptor*>(mappings));
+}
+
 
 // } /namespace LLGL
 
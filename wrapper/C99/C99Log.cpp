@@ -83,6 +83,26 @@ LLGL_C_EXPORT void llglUnregisterLogCallback(LLGLLogHandle handle)
     Log::UnregisterCallback(handle);
 }
 
+LLGL_C_EXPORT void llglSetLogReportLevel(LLGLReportType type)
+{
+    Log::SetReportLevel(static_cast<Log::ReportType>(type));
+}
+
+LLGL_C_EXPORT bool llglIsLogReportEnabled(LLGLReportType type)
+{
+    return Log::IsReportEnabled(static_cast<Log::ReportType>(type));
+}
+
+LLGL_C_EXPORT void llglSetLogDeferredReports(size_t capacity)
+{
+    Log::SetDeferredReports(capacity);
+}
+
+LLGL_C_EXPORT size_t llglFlushLogDeferredReports()
+{
+    return Log::FlushDeferredReports();
+}
+
 
 // } /namespace LLGL
 
@@ -0,0 +1,28 @@
+/*
+ * C99PlacementHeap.cpp
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+#include <LLGL/PlacementHeap.h>
+#include <LLGL-C/PlacementHeap.h>
+#include "C99Internal.h"
+
+
+// namespace LLGL {
+
+
+using namespace LLGL;
+
+LLGL_C_EXPORT uint64_t llglGetPlacementHeapSize(LLGLPlacementHeap placementHeap)
+{
+    return LLGL_PTR(PlacementHeap, placementHeap)->GetSize();
+}
+
+
+// } /namespace LLGL
+
+
+
+// ================================================================================
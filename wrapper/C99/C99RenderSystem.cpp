@@ -11,6 +11,7 @@
 #include "C99Internal.h"
 #include <string.h>
 #include <vector>
+#include <algorithm>
 #include <string>
 
 
@@ -48,9 +49,17 @@ static void ConvertRenderSystemDesc(RenderSystemDescriptor& dst, const LLGLRende
 {
     dst.moduleName          = src.moduleName;
     dst.flags               = src.flags;
+    dst.adapterIndex        = src.adapterIndex;
+    dst.adapterLUID         = src.adapterLUID;
+    ::memcpy(dst.adapterUUID, src.adapterUUID, sizeof(dst.adapterUUID));
     dst.debugger            = LLGL_PTR(RenderingDebugger, src.debugger);
     dst.rendererConfig      = src.rendererConfig;
     dst.rendererConfigSize  = src.rendererConfigSize;
+    dst.pipelineCacheDirectory = src.pipelineCacheDirectory;
+    dst.shaderCacheFilename = src.shaderCacheFilename;
+    dst.allocator.allocate  = src.allocator.allocate;
+    dst.allocator.free      = src.allocator.free;
+    dst.allocator.userData  = src.allocator.userData;
     #ifdef LLGL_OS_ANDROID
     dst.androidApp          = src.androidApp;
     #endif
@@ -184,6 +193,38 @@ LLGL_C_EXPORT LLGLReport llglGetRendererReport()
     return LLGLReport{ g_CurrentRenderSystem->GetReport() };
 }
 
+LLGL_C_EXPORT uint32_t llglQueryMemoryHeaps(LLGLMemoryHeapInfo* outHeapInfos, uint32_t maxHeapInfos)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    return g_CurrentRenderSystem->QueryMemoryHeaps(reinterpret_cast<MemoryHeapInfo*>(outHeapInfos), maxHeapInfos);
+}
+
+LLGL_C_EXPORT uint32_t llglQueryAdapters(LLGLAdapterInfo* outAdapters, uint32_t maxAdapters)
+{
+    static std::vector<AdapterInfo> adapters; // Keeps adapter names alive for the output array
+    LLGL_ASSERT_RENDER_SYSTEM();
+    const std::uint32_t numAdapters = g_CurrentRenderSystem->QueryAdapters(nullptr, 0);
+    if (outAdapters != nullptr)
+    {
+        adapters.resize(numAdapters);
+        g_CurrentRenderSystem->QueryAdapters(adapters.data(), numAdapters);
+        for_range(i, std::min(numAdapters, maxAdapters))
+        {
+            LLGLAdapterInfo& dst = outAdapters[i];
+            const AdapterInfo& src = adapters[i];
+            dst.name            = src.name.c_str();
+            dst.vendorID        = src.vendorID;
+            dst.deviceID        = src.deviceID;
+            dst.videoMemory     = src.videoMemory;
+            dst.sharedMemory    = src.sharedMemory;
+            dst.luid            = src.luid;
+            ::memcpy(dst.uuid, src.uuid, sizeof(dst.uuid));
+            dst.isActive        = src.isActive;
+        }
+    }
+    return numAdapters;
+}
+
 LLGL_C_EXPORT LLGLSwapChain llglCreateSwapChain(const LLGLSwapChainDescriptor* swapChainDesc)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
@@ -228,9 +269,9 @@ static void ConvertVertexAttrib(VertexAttribute& dst, const LLGLVertexAttribute&
     dst.instanceDivisor     = src.instanceDivisor;
 }
 
-static void ConvertBufferDesc(BufferDescriptor& dst, SmallVector<VertexAttribute>& dstVertexAttribs, const LLGLBufferDescriptor& src)
+// Converts the buffer descriptor and writes its vertex attributes into 'dstVertexAttribs', which must have space for 'src.numVertexAttribs' elements.
+static void ConvertBufferDesc(BufferDescriptor& dst, VertexAttribute* dstVertexAttribs, const LLGLBufferDescriptor& src)
 {
-    dstVertexAttribs.resize(src.numVertexAttribs);
     for_range(i, src.numVertexAttribs)
         ConvertVertexAttrib(dstVertexAttribs[i], src.vertexAttribs[i]);
 
@@ -241,7 +282,7 @@ static void ConvertBufferDesc(BufferDescriptor& dst, SmallVector<VertexAttribute
     dst.bindFlags       = src.bindFlags;
     dst.cpuAccessFlags  = src.cpuAccessFlags;
     dst.miscFlags       = src.miscFlags;
-    dst.vertexAttribs   = dstVertexAttribs;
+    dst.vertexAttribs   = ArrayView<VertexAttribute>{ dstVertexAttribs, src.numVertexAttribs };
 }
 
 LLGL_C_EXPORT LLGLBuffer llglCreateBuffer(const LLGLBufferDescriptor* bufferDesc, const void* initialData)
@@ -249,16 +290,49 @@ LLGL_C_EXPORT LLGLBuffer llglCreateBuffer(const LLGLBufferDescriptor* bufferDesc
     LLGL_ASSERT_RENDER_SYSTEM();
     LLGL_ASSERT_PTR(bufferDesc);
     BufferDescriptor internalBufferDesc;
-    SmallVector<VertexAttribute> internalVertexAttribs;
-    ConvertBufferDesc(internalBufferDesc, internalVertexAttribs, *bufferDesc);
+    SmallVector<VertexAttribute> internalVertexAttribs(bufferDesc->numVertexAttribs);
+    ConvertBufferDesc(internalBufferDesc, internalVertexAttribs.data(), *bufferDesc);
     return LLGLBuffer{ g_CurrentRenderSystem->CreateBuffer(internalBufferDesc, initialData) };
 }
 
+LLGL_C_EXPORT void llglCreateBuffers(uint32_t numBuffers, const LLGLBufferDescriptor* bufferDescs, const void** initialData, LLGLBuffer* outBuffers)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(bufferDescs);
+    LLGL_ASSERT_PTR(outBuffers);
+
+    /* Gather the vertex attributes of all buffers in a single scratch buffer, so small batches are converted without heap allocations */
+    std::size_t numVertexAttribs = 0;
+    for_range(i, numBuffers)
+        numVertexAttribs += bufferDescs[i].numVertexAttribs;
+
+    SmallVector<VertexAttribute> internalVertexAttribs(numVertexAttribs);
+    SmallVector<BufferDescriptor, 8> internalBufferDescs(numBuffers);
+
+    VertexAttribute* internalVertexAttribsPerBuffer = internalVertexAttribs.data();
+    for_range(i, numBuffers)
+    {
+        ConvertBufferDesc(internalBufferDescs[i], internalVertexAttribsPerBuffer, bufferDescs[i]);
+        internalVertexAttribsPerBuffer += bufferDescs[i].numVertexAttribs;
+    }
+
+    /* Wrapper handles have the same layout as their object pointers; see C99TypeAssertions.cpp */
+    g_CurrentRenderSystem->CreateBuffers(internalBufferDescs, initialData, reinterpret_cast<Buffer**>(outBuffers));
+}
+
 LLGL_C_EXPORT void llglReleaseBuffer(LLGLBuffer buffer)
 {
     LLGL_RELEASE(Buffer, buffer);
 }
 
+LLGL_C_EXPORT void llglReleaseBuffers(uint32_t numBuffers, const LLGLBuffer* buffers)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(buffers);
+
+    g_CurrentRenderSystem->Release(ArrayView<Buffer*>{ reinterpret_cast<Buffer* const*>(buffers), numBuffers });
+}
+
 LLGL_C_EXPORT void llglWriteBuffer(LLGLBuffer buffer, uint64_t offset, const void* data, uint64_t dataSize)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
@@ -289,6 +363,31 @@ LLGL_C_EXPORT void llglUnmapBuffer(LLGLBuffer buffer)
     g_CurrentRenderSystem->UnmapBuffer(LLGL_REF(Buffer, buffer));
 }
 
+LLGL_C_EXPORT void llglFlushMappedRange(LLGLBuffer buffer, uint64_t offset, uint64_t length)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    g_CurrentRenderSystem->FlushMappedRange(LLGL_REF(Buffer, buffer), offset, length);
+}
+
+static void ConvertAccelerationStructureDesc(AccelerationStructureDescriptor& dst, const LLGLAccelerationStructureDescriptor& src)
+{
+    dst.type        = static_cast<AccelerationStructureType>(src.type);
+    dst.flags       = src.flags;
+    dst.geometries  = ArrayView<AccelerationStructureGeometryDescriptor>{ reinterpret_cast<const AccelerationStructureGeometryDescriptor*>(src.geometries), src.numGeometries };
+    dst.instances   = ArrayView<AccelerationStructureInstance>{ reinterpret_cast<const AccelerationStructureInstance*>(src.instances), src.numInstances };
+}
+
+LLGL_C_EXPORT void llglGetAccelerationStructureSizes(const LLGLAccelerationStructureDescriptor* accelerationStructureDesc, LLGLAccelerationStructureSizes* outSizes)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(accelerationStructureDesc);
+    LLGL_ASSERT_PTR(outSizes);
+    AccelerationStructureDescriptor internalDesc;
+    ConvertAccelerationStructureDesc(internalDesc, *accelerationStructureDesc);
+    const AccelerationStructureSizes sizes = g_CurrentRenderSystem->GetAccelerationStructureSizes(internalDesc);
+    ::memcpy(outSizes, &sizes, sizeof(AccelerationStructureSizes));
+}
+
 LLGL_C_EXPORT LLGLBufferArray llglCreateBufferArray(uint32_t numBuffers, const LLGLBuffer* buffers)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
@@ -308,11 +407,32 @@ LLGL_C_EXPORT LLGLTexture llglCreateTexture(const LLGLTextureDescriptor* texture
     return LLGLTexture{ g_CurrentRenderSystem->CreateTexture(*reinterpret_cast<const TextureDescriptor*>(textureDesc), reinterpret_cast<const ImageView*>(initialImage)) };
 }
 
+LLGL_C_EXPORT void llglCreateTextures(uint32_t numTextures, const LLGLTextureDescriptor* textureDescs, const LLGLImageView* initialImages, LLGLTexture* outTextures)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textureDescs);
+    LLGL_ASSERT_PTR(outTextures);
+
+    g_CurrentRenderSystem->CreateTextures(
+        ArrayView<TextureDescriptor>{ reinterpret_cast<const TextureDescriptor*>(textureDescs), numTextures },
+        reinterpret_cast<const ImageView*>(initialImages),
+        reinterpret_cast<Texture**>(outTextures)
+    );
+}
+
 LLGL_C_EXPORT void llglReleaseTexture(LLGLTexture texture)
 {
     LLGL_RELEASE(Texture, texture);
 }
 
+LLGL_C_EXPORT void llglReleaseTextures(uint32_t numTextures, const LLGLTexture* textures)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textures);
+
+    g_CurrentRenderSystem->Release(ArrayView<Texture*>{ reinterpret_cast<Texture* const*>(textures), numTextures });
+}
+
 LLGL_C_EXPORT void llglWriteTexture(LLGLTexture texture, const LLGLTextureRegion* textureRegion, const LLGLImageView* srcImageView)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
@@ -321,6 +441,18 @@ LLGL_C_EXPORT void llglWriteTexture(LLGLTexture texture, const LLGLTextureRegion
     g_CurrentRenderSystem->WriteTexture(LLGL_REF(Texture, texture), *reinterpret_cast<const TextureRegion*>(textureRegion), *reinterpret_cast<const ImageView*>(srcImageView));
 }
 
+LLGL_C_EXPORT void llglWriteTextureAsync(uint32_t numUploads, const LLGLTextureUploadDescriptor* uploads, LLGLFence fence)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    g_CurrentRenderSystem->WriteTextureAsync(numUploads, reinterpret_cast<const TextureUploadDescriptor*>(uploads), LLGL_PTR(Fence, fence));
+}
+
+LLGL_C_EXPORT void llglWriteFromFileAsync(uint32_t numUploads, const LLGLFileUploadDescriptor* uploads, LLGLFence fence)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    g_CurrentRenderSystem->WriteFromFileAsync(numUploads, reinterpret_cast<const FileUploadDescriptor*>(uploads), LLGL_PTR(Fence, fence));
+}
+
 LLGL_C_EXPORT void llglReadTexture(LLGLTexture texture, const LLGLTextureRegion* textureRegion, const LLGLMutableImageView* dstImageView)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
@@ -329,6 +461,82 @@ LLGL_C_EXPORT void llglReadTexture(LLGLTexture texture, const LLGLTextureRegion*
     g_CurrentRenderSystem->ReadTexture(LLGL_REF(Texture, texture), *reinterpret_cast<const TextureRegion*>(textureRegion), *reinterpret_cast<const MutableImageView*>(dstImageView));
 }
 
+LLGL_C_EXPORT void llglReadTextureAsync(LLGLTexture texture, const LLGLTextureRegion* textureRegion, const LLGLMutableImageView* dstImageView, LLGLFence fence)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textureRegion);
+    LLGL_ASSERT_PTR(dstImageView);
+    g_CurrentRenderSystem->ReadTextureAsync(LLGL_REF(Texture, texture), *reinterpret_cast<const TextureRegion*>(textureRegion), *reinterpret_cast<const MutableImageView*>(dstImageView), LLGL_REF(Fence, fence));
+}
+
+LLGL_C_EXPORT LLGLPlacementHeap llglCreatePlacementHeap(const LLGLPlacementHeapDescriptor* placementHeapDesc)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(placementHeapDesc);
+    return LLGLPlacementHeap{ g_CurrentRenderSystem->CreatePlacementHeap(*reinterpret_cast<const PlacementHeapDescriptor*>(placementHeapDesc)) };
+}
+
+LLGL_C_EXPORT void llglReleasePlacementHeap(LLGLPlacementHeap placementHeap)
+{
+    LLGL_RELEASE(PlacementHeap, placementHeap);
+}
+
+LLGL_C_EXPORT void llglGetTextureMemoryRequirements(const LLGLTextureDescriptor* textureDesc, LLGLMemoryRequirements* outRequirements)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textureDesc);
+    LLGL_ASSERT_PTR(outRequirements);
+    const MemoryRequirements requirements = g_CurrentRenderSystem->GetTextureMemoryRequirements(*reinterpret_cast<const TextureDescriptor*>(textureDesc));
+    ::memcpy(outRequirements, &requirements, sizeof(MemoryRequirements));
+}
+
+LLGL_C_EXPORT LLGLTexture llglCreatePlacedTexture(LLGLPlacementHeap placementHeap, uint64_t offset, const LLGLTextureDescriptor* textureDesc)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textureDesc);
+    return LLGLTexture{ g_CurrentRenderSystem->CreatePlacedTexture(LLGL_REF(PlacementHeap, placementHeap), offset, *reinterpret_cast<const TextureDescriptor*>(textureDesc)) };
+}
+
+LLGL_C_EXPORT LLGLTexture llglCreateSamplerFeedbackTexture(const LLGLSamplerFeedbackDescriptor* samplerFeedbackDesc)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(samplerFeedbackDesc);
+    return LLGLTexture{ g_CurrentRenderSystem->CreateSamplerFeedbackTexture(*reinterpret_cast<const SamplerFeedbackDescriptor*>(samplerFeedbackDesc)) };
+}
+
+LLGL_C_EXPORT bool llglExportSharedHandle(LLGLResource resource, LLGLSharedResourceHandle* outHandle)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(outHandle);
+    return g_CurrentRenderSystem->ExportSharedHandle(LLGL_REF(Resource, resource), *reinterpret_cast<SharedResourceHandle*>(outHandle));
+}
+
+LLGL_C_EXPORT LLGLTexture llglImportTexture(const LLGLTextureDescriptor* textureDesc, const LLGLSharedResourceHandle* sharedHandle)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(textureDesc);
+    LLGL_ASSERT_PTR(sharedHandle);
+    return LLGLTexture{ g_CurrentRenderSystem->ImportTexture(*reinterpret_cast<const TextureDescriptor*>(textureDesc), *reinterpret_cast<const SharedResourceHandle*>(sharedHandle)) };
+}
+
+LLGL_C_EXPORT LLGLBuffer llglImportBuffer(const LLGLBufferDescriptor* bufferDesc, const LLGLSharedResourceHandle* sharedHandle)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(bufferDesc);
+    LLGL_ASSERT_PTR(sharedHandle);
+    BufferDescriptor internalBufferDesc;
+    SmallVector<VertexAttribute> internalVertexAttribs(bufferDesc->numVertexAttribs);
+    ConvertBufferDesc(internalBufferDesc, internalVertexAttribs.data(), *bufferDesc);
+    return LLGLBuffer{ g_CurrentRenderSystem->ImportBuffer(internalBufferDesc, *reinterpret_cast<const SharedResourceHandle*>(sharedHandle)) };
+}
+
+LLGL_C_EXPORT bool llglExportSharedFence(LLGLFence fence, LLGLSharedResourceHandle* outHandle)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(outHandle);
+    return g_CurrentRenderSystem->ExportSharedFence(LLGL_REF(Fence, fence), *reinterpret_cast<SharedResourceHandle*>(outHandle));
+}
+
 LLGL_C_EXPORT LLGLSampler llglCreateSampler(const LLGLSamplerDescriptor* samplerDesc)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
@@ -430,14 +638,16 @@ static void ConvertComputeShaderAttribs(ComputeShaderAttributes& dst, const LLGL
 
 static void ConvertShaderDesc(ShaderDescriptor& dst, const LLGLShaderDescriptor& src)
 {
-    dst.type        = static_cast<ShaderType>(src.type);
-    dst.source      = src.source;
-    dst.sourceSize  = src.sourceSize;
-    dst.sourceType  = static_cast<ShaderSourceType>(src.sourceType);
-    dst.entryPoint  = src.entryPoint;
-    dst.profile     = src.profile;
-    dst.defines     = reinterpret_cast<const ShaderMacro*>(src.defines);
-    dst.flags       = src.flags;
+    dst.type                = static_cast<ShaderType>(src.type);
+    dst.source              = src.source;
+    dst.sourceSize          = src.sourceSize;
+    dst.sourceType          = static_cast<ShaderSourceType>(src.sourceType);
+    dst.entryPoint          = src.entryPoint;
+    dst.profile             = src.profile;
+    dst.defines             = reinterpret_cast<const ShaderMacro*>(src.defines);
+    dst.flags               = src.flags;
+    dst.reflectionData      = src.reflectionData;
+    dst.reflectionDataSize  = src.reflectionDataSize;
 
     ConvertVertexShaderAttribs(dst.vertex, src.vertex);
     ConvertFragmentShaderAttribs(dst.fragment, src.fragment);
@@ -453,6 +663,19 @@ LLGL_C_EXPORT LLGLShader llglCreateShader(const LLGLShaderDescriptor* shaderDesc
     return LLGLShader{ g_CurrentRenderSystem->CreateShader(internalShaderDesc) };
 }
 
+LLGL_C_EXPORT void llglCreateShaders(uint32_t numShaders, const LLGLShaderDescriptor* shaderDescs, LLGLShader* outShaders)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(shaderDescs);
+    LLGL_ASSERT_PTR(outShaders);
+
+    SmallVector<ShaderDescriptor, 8> internalShaderDescs(numShaders);
+    for_range(i, numShaders)
+        ConvertShaderDesc(internalShaderDescs[i], shaderDescs[i]);
+
+    g_CurrentRenderSystem->CreateShaders(internalShaderDescs, reinterpret_cast<Shader**>(outShaders));
+}
+
 LLGL_C_EXPORT void llglReleaseShader(LLGLShader shader)
 {
     LLGL_RELEASE(Shader, shader);
@@ -515,7 +738,8 @@ static void ConvertPipelineLayoutDesc(PipelineLayoutDescriptor& dst, const LLGLP
     for_range(i, src.numCombinedTextureSamplers)
         ConvertCombinedTextureSamplerDesc(dst.combinedTextureSamplers[i], src.combinedTextureSamplers[i]);
 
-    dst.barrierFlags = src.barrierFlags;
+    dst.barrierFlags    = src.barrierFlags;
+    dst.flags           = src.flags;
 }
 
 LLGL_C_EXPORT LLGLPipelineLayout llglCreatePipelineLayout(const LLGLPipelineLayoutDescriptor* pipelineLayoutDesc)
@@ -546,6 +770,7 @@ LLGL_C_EXPORT void llglReleasePipelineCache(LLGLPipelineCache pipelineCache)
 static void ConvertGraphicsPipelineDesc(GraphicsPipelineDescriptor& dst, const LLGLGraphicsPipelineDescriptor& src)
 {
     dst.debugName               = src.debugName;
+    dst.flags                   = src.flags;
     dst.pipelineLayout          = LLGL_PTR(PipelineLayout, src.pipelineLayout);
     dst.renderPass              = LLGL_PTR(RenderPass, src.renderPass);
     dst.vertexShader            = LLGL_PTR(Shader, src.vertexShader);
@@ -567,6 +792,9 @@ static void ConvertGraphicsPipelineDesc(GraphicsPipelineDescriptor& dst, const L
     ::memcpy(&(dst.rasterizer), &(src.rasterizer), sizeof(LLGLRasterizerDescriptor));
     ::memcpy(&(dst.blend), &(src.blend), sizeof(LLGLBlendDescriptor));
     ::memcpy(&(dst.tessellation), &(src.tessellation), sizeof(LLGLTessellationDescriptor));
+
+    dst.specializationConstants.resize(src.numSpecializationConstants);
+    ::memcpy(dst.specializationConstants.data(), src.specializationConstants, src.numSpecializationConstants * sizeof(LLGLSpecializationConstant));
 }
 
 LLGL_C_EXPORT LLGLPipelineState llglCreateGraphicsPipelineState(const LLGLGraphicsPipelineDescriptor* pipelineStateDesc)
@@ -583,11 +811,28 @@ LLGL_C_EXPORT LLGLPipelineState llglCreateGraphicsPipelineStateExt(const LLGLGra
     return LLGLPipelineState{ g_CurrentRenderSystem->CreatePipelineState(internalPipelineStateDesc, LLGL_PTR(PipelineCache, pipelineCache)) };
 }
 
+LLGL_C_EXPORT void llglCreateGraphicsPipelineStates(uint32_t numPipelineStates, const LLGLGraphicsPipelineDescriptor* pipelineStateDescs, LLGLPipelineState* outPipelineStates, LLGLPipelineCache pipelineCache)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(pipelineStateDescs);
+    LLGL_ASSERT_PTR(outPipelineStates);
+
+    std::vector<GraphicsPipelineDescriptor> internalPipelineStateDescs(numPipelineStates);
+    for_range(i, numPipelineStates)
+        ConvertGraphicsPipelineDesc(internalPipelineStateDescs[i], pipelineStateDescs[i]);
+
+    g_CurrentRenderSystem->CreatePipelineStates(internalPipelineStateDescs, reinterpret_cast<PipelineState**>(outPipelineStates), LLGL_PTR(PipelineCache, pipelineCache));
+}
+
 static void ConvertComputePipelineDesc(ComputePipelineDescriptor& dst, const LLGLComputePipelineDescriptor& src)
 {
     dst.debugName       = src.debugName;
+    dst.flags           = src.flags;
     dst.pipelineLayout  = LLGL_PTR(PipelineLayout, src.pipelineLayout);
     dst.computeShader   = LLGL_PTR(Shader, src.computeShader);
+
+    dst.specializationConstants.resize(src.numSpecializationConstants);
+    ::memcpy(dst.specializationConstants.data(), src.specializationConstants, src.numSpecializationConstants * sizeof(LLGLSpecializationConstant));
 }
 
 LLGL_C_EXPORT LLGLPipelineState llglCreateComputePipelineState(const LLGLComputePipelineDescriptor* pipelineStateDesc)
@@ -604,6 +849,51 @@ LLGL_C_EXPORT LLGLPipelineState llglCreateComputePipelineStateExt(const LLGLComp
     return LLGLPipelineState{ g_CurrentRenderSystem->CreatePipelineState(internalPipelineStateDesc, LLGL_PTR(PipelineCache, pipelineCache)) };
 }
 
+LLGL_C_EXPORT void llglCreateComputePipelineStates(uint32_t numPipelineStates, const LLGLComputePipelineDescriptor* pipelineStateDescs, LLGLPipelineState* outPipelineStates, LLGLPipelineCache pipelineCache)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(pipelineStateDescs);
+    LLGL_ASSERT_PTR(outPipelineStates);
+
+    std::vector<ComputePipelineDescriptor> internalPipelineStateDescs(numPipelineStates);
+    for_range(i, numPipelineStates)
+        ConvertComputePipelineDesc(internalPipelineStateDescs[i], pipelineStateDescs[i]);
+
+    g_CurrentRenderSystem->CreatePipelineStates(internalPipelineStateDescs, reinterpret_cast<PipelineState**>(outPipelineStates), LLGL_PTR(PipelineCache, pipelineCache));
+}
+
+static void ConvertRayTracingPipelineDesc(RayTracingPipelineDescriptor& dst, const LLGLRayTracingPipelineDescriptor& src)
+{
+    dst.debugName           = src.debugName;
+    dst.flags               = src.flags;
+    dst.pipelineLayout      = LLGL_PTR(PipelineLayout, src.pipelineLayout);
+    dst.rayGenerationShader = LLGL_PTR(Shader, src.rayGenerationShader);
+
+    dst.missShaders.resize(src.numMissShaders);
+    for_range(i, src.numMissShaders)
+        dst.missShaders[i] = LLGL_PTR(Shader, src.missShaders[i]);
+
+    dst.hitGroups.resize(src.numHitGroups);
+    for_range(i, src.numHitGroups)
+    {
+        dst.hitGroups[i].closestHitShader   = LLGL_PTR(Shader, src.hitGroups[i].closestHitShader);
+        dst.hitGroups[i].anyHitShader       = LLGL_PTR(Shader, src.hitGroups[i].anyHitShader);
+    }
+
+    dst.maxRecursionDepth   = src.maxRecursionDepth;
+    dst.maxPayloadSize      = src.maxPayloadSize;
+    dst.maxAttributeSize    = src.maxAttributeSize;
+}
+
+LLGL_C_EXPORT LLGLPipelineState llglCreateRayTracingPipelineState(const LLGLRayTracingPipelineDescriptor* pipelineStateDesc)
+{
+    LLGL_ASSERT_RENDER_SYSTEM();
+    LLGL_ASSERT_PTR(pipelineStateDesc);
+    RayTracingPipelineDescriptor internalPipelineStateDesc;
+    ConvertRayTracingPipelineDesc(internalPipelineStateDesc, *pipelineStateDesc);
+    return LLGLPipelineState{ g_CurrentRenderSystem->CreatePipelineState(internalPipelineStateDesc) };
+}
+
 LLGL_C_EXPORT void llglReleasePipelineState(LLGLPipelineState pipelineState)
 {
     LLGL_RELEASE(PipelineState, pipelineState);
@@ -632,6 +922,16 @@ LLGL_C_EXPORT void llglReleaseFence(LLGLFence fence)
     LLGL_RELEASE(Fence, fence);
 }
 
+LLGL_C_EXPORT bool llglGetFenceNativeHandle(LLGLFence fence, void* nativeHandle, size_t nativeHandleSize)
+{
+    return LLGL_PTR(Fence, fence)->GetNativeHandle(nativeHandle, nativeHandleSize);
+}
+
+LLGL_C_EXPORT bool llglIsFenceSignaled(LLGLFence fence)
+{
+    return LLGL_PTR(Fence, fence)->IsSignaled();
+}
+
 LLGL_C_EXPORT bool llglGetRenderSystemNativeHandle(void* nativeHandle, size_t nativeHandleSize)
 {
     LLGL_ASSERT_RENDER_SYSTEM();
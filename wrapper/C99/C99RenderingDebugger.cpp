@@ -37,6 +37,76 @@ LLGL_C_EXPORT bool llglGetDebuggerTimeRecording(LLGLRenderingDebugger debugger)
     return LLGL_PTR(RenderingDebugger, debugger)->GetTimeRecording();
 }
 
+LLGL_C_EXPORT void llglSetDebuggerScopeRecording(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetScopeRecording(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerScopeRecording(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetScopeRecording();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerEventRecording(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetEventRecording(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerEventRecording(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetEventRecording();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerStatisticsRecording(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetStatisticsRecording(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerStatisticsRecording(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetStatisticsRecording();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerValidation(LLGLRenderingDebugger debugger, bool enabled)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetValidation(enabled);
+}
+
+LLGL_C_EXPORT bool llglGetDebuggerValidation(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetValidation();
+}
+
+LLGL_C_EXPORT void llglSetDebuggerValidationFlags(LLGLRenderingDebugger debugger, long flags)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->SetValidationFlags(flags);
+}
+
+LLGL_C_EXPORT long llglGetDebuggerValidationFlags(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetValidationFlags();
+}
+
+LLGL_C_EXPORT void llglBeginDebuggerCapture(LLGLRenderingDebugger debugger, const char* filename, uint32_t numFrames)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->BeginCapture(filename, numFrames);
+}
+
+LLGL_C_EXPORT void llglEndDebuggerCapture(LLGLRenderingDebugger debugger)
+{
+    LLGL_PTR(RenderingDebugger, debugger)->EndCapture();
+}
+
+LLGL_C_EXPORT const char* llglGetDebuggerCaptureFilename(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetCaptureFilename();
+}
+
+LLGL_C_EXPORT uint32_t llglGetDebuggerCaptureFrames(LLGLRenderingDebugger debugger)
+{
+    return LLGL_PTR(RenderingDebugger, debugger)->GetCaptureFrames();
+}
+
 static void ConvertC99ProfileTimeRecord(LLGLProfileTimeRecord& dst, const ProfileTimeRecord& src)
 {
     dst.annotation      = src.annotation.c_str();
@@ -45,12 +115,44 @@ static void ConvertC99ProfileTimeRecord(LLGLProfileTimeRecord& dst, const Profil
     dst.elapsedTime     = src.elapsedTime;
 }
 
+static void ConvertC99ProfileScopeRecord(LLGLProfileScopeRecord& dst, const ProfileScopeRecord& src)
+{
+    dst.annotation      = src.annotation.c_str();
+    dst.parent          = src.parent;
+    dst.depth           = src.depth;
+    dst.frame           = src.frame;
+    dst.cpuTicksStart   = src.cpuTicksStart;
+    dst.cpuTicksEnd     = src.cpuTicksEnd;
+    dst.gpuTicksStart   = src.gpuTicksStart;
+    dst.gpuTicksEnd     = src.gpuTicksEnd;
+    dst.elapsedTime     = src.elapsedTime;
+}
+
+static void ConvertC99ProfileEventRecord(LLGLProfileEventRecord& dst, const ProfileEventRecord& src)
+{
+    dst.type            = static_cast<LLGLProfileEventType>(src.type);
+    dst.annotation      = src.annotation.c_str();
+    dst.thread          = src.thread;
+    dst.cpuTicksStart   = src.cpuTicksStart;
+    dst.cpuTicksEnd     = src.cpuTicksEnd;
+}
+
+static void ConvertC99ProfileStatisticsRecord(LLGLProfileStatisticsRecord& dst, const ProfileStatisticsRecord& src)
+{
+    dst.annotation      = src.annotation.c_str();
+    dst.frame           = src.frame;
+    std::memcpy(&(dst.statistics), &(src.statistics), sizeof(LLGLQueryPipelineStatistics));
+}
+
 LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGLFrameProfile* outFrameProfile)
 {
     LLGL_ASSERT_PTR(outFrameProfile);
 
     static thread_local FrameProfile internalFrameProfile;
     static thread_local std::vector<LLGLProfileTimeRecord> internalProfileTimeRecords;
+    static thread_local std::vector<LLGLProfileScopeRecord> internalProfileScopeRecords;
+    static thread_local std::vector<LLGLProfileEventRecord> internalProfileEventRecords;
+    static thread_local std::vector<LLGLProfileStatisticsRecord> internalProfileStatisticsRecords;
     LLGL_PTR(RenderingDebugger, debugger)->FlushProfile(&internalFrameProfile);
 
     static_assert(
@@ -65,12 +167,44 @@ LLGL_C_EXPORT void llglFlushDebuggerProfile(LLGLRenderingDebugger debugger, LLGL
     );
     std::memcpy(&(outFrameProfile->commandBufferRecord), &(internalFrameProfile.commandBufferRecord), sizeof(LLGLProfileCommandBufferRecord));
 
+    static_assert(
+        sizeof(LLGLProfileBackendRecord) == sizeof(ProfileBackendRecord),
+        "LLGLProfileBackendRecord and LLGL::ProfileBackendRecord expected to be the same size"
+    );
+    std::memcpy(&(outFrameProfile->backendRecord), &(internalFrameProfile.backendRecord), sizeof(LLGLProfileBackendRecord));
+
     internalProfileTimeRecords.resize(internalFrameProfile.timeRecords.size());
     for_range(i, internalFrameProfile.timeRecords.size())
         ConvertC99ProfileTimeRecord(internalProfileTimeRecords[i], internalFrameProfile.timeRecords[i]);
 
     outFrameProfile->numTimeRecords = internalProfileTimeRecords.size();
     outFrameProfile->timeRecords = internalProfileTimeRecords.data();
+
+    internalProfileScopeRecords.resize(internalFrameProfile.scopeRecords.size());
+    for_range(i, internalFrameProfile.scopeRecords.size())
+        ConvertC99ProfileScopeRecord(internalProfileScopeRecords[i], internalFrameProfile.scopeRecords[i]);
+
+    outFrameProfile->numScopeRecords = internalProfileScopeRecords.size();
+    outFrameProfile->scopeRecords = internalProfileScopeRecords.data();
+
+    internalProfileEventRecords.resize(internalFrameProfile.eventRecords.size());
+    for_range(i, internalFrameProfile.eventRecords.size())
+        ConvertC99ProfileEventRecord(internalProfileEventRecords[i], internalFrameProfile.eventRecords[i]);
+
+    outFrameProfile->numEventRecords = internalProfileEventRecords.size();
+    outFrameProfile->eventRecords = internalProfileEventRecords.data();
+
+    static_assert(
+        sizeof(LLGLQueryPipelineStatistics) == sizeof(QueryPipelineStatistics),
+        "LLGLQueryPipelineStatistics and LLGL::QueryPipelineStatistics expected to be the same size"
+    );
+    internalProfileStatisticsRecords.resize(internalFrameProfile.statisticsRecords.size());
+    for_range(i, internalFrameProfile.statisticsRecords.size())
+        ConvertC99ProfileStatisticsRecord(internalProfileStatisticsRecords[i], internalFrameProfile.statisticsRecords[i]);
+
+    outFrameProfile->numStatisticsRecords = internalProfileStatisticsRecords.size();
+    outFrameProfile->statisticsRecords = internalProfileStatisticsRecords.data();
+    std::memcpy(&(outFrameProfile->pipelineStatistics), &(internalFrameProfile.pipelineStatistics), sizeof(LLGLQueryPipelineStatistics));
 }
 
 
@@ -55,6 +55,31 @@ LLGL_C_EXPORT bool llglSetVsyncInterval(LLGLSwapChain swapChain, uint32_t vsyncI
     return LLGL_PTR(SwapChain, swapChain)->SetVsyncInterval(vsyncInterval);
 }
 
+LLGL_C_EXPORT bool llglWaitForNextFrame(LLGLSwapChain swapChain, uint64_t timeout)
+{
+    return LLGL_PTR(SwapChain, swapChain)->WaitForNextFrame(timeout);
+}
+
+LLGL_C_EXPORT bool llglGetFrameStatistics(LLGLSwapChain swapChain, LLGLFrameStatistics* outStatistics)
+{
+    return LLGL_PTR(SwapChain, swapChain)->GetFrameStatistics(*(FrameStatistics*)outStatistics);
+}
+
+LLGL_C_EXPORT bool llglGetCurrentBackBufferNativeHandle(LLGLSwapChain swapChain, void* nativeHandle, size_t nativeHandleSize)
+{
+    return LLGL_PTR(SwapChain, swapChain)->GetCurrentBackBufferNativeHandle(nativeHandle, nativeHandleSize);
+}
+
+LLGL_C_EXPORT LLGLSurfaceTransform llglGetSurfaceTransform(LLGLSwapChain swapChain)
+{
+    return (LLGLSurfaceTransform)LLGL_PTR(SwapChain, swapChain)->GetSurfaceTransform();
+}
+
+LLGL_C_EXPORT LLGLColorSpace llglGetColorSpace(LLGLSwapChain swapChain)
+{
+    return (LLGLColorSpace)LLGL_PTR(SwapChain, swapChain)->GetColorSpace();
+}
+
 LLGL_C_EXPORT bool llglSwitchFullscreen(LLGLSwapChain swapChain, bool enable)
 {
     return LLGL_PTR(SwapChain, swapChain)->SwitchFullscreen(enable);
@@ -25,6 +25,11 @@ LLGL_C_EXPORT uint64_t llglTimerTick()
     return Timer::Tick();
 }
 
+LLGL_C_EXPORT void llglTimerSleepUntil(uint64_t tick)
+{
+    Timer::SleepUntil(tick);
+}
+
 
 // } /namespace LLGL
 
@@ -21,6 +21,9 @@
 #define LLGL_STATIC_ASSERT_OFFSET(TYPE, FIELD) \
     static_assert(offsetof(TYPE, FIELD) == offsetof(LLGL ## TYPE, FIELD), "LLGL" #TYPE "::" #FIELD " does not match offset of LLGL::" #TYPE "::" #FIELD)
 
+#define LLGL_STATIC_ASSERT_HANDLE(TYPE) \
+    static_assert(sizeof(LLGL ## TYPE) == sizeof(TYPE*) && offsetof(LLGL ## TYPE, internal) == 0, "LLGL" #TYPE " does not match layout of LLGL::" #TYPE " pointer")
+
 
 using namespace LLGL;
 using namespace Log;
@@ -71,6 +74,7 @@ LLGL_STATIC_ASSERT_ENUM(ShadingLanguage, Metal_2_0);
 LLGL_STATIC_ASSERT_ENUM(ShadingLanguage, Metal_2_1);
 LLGL_STATIC_ASSERT_ENUM(ShadingLanguage, SPIRV);
 LLGL_STATIC_ASSERT_ENUM(ShadingLanguage, SPIRV_100);
+LLGL_STATIC_ASSERT_ENUM(ShadingLanguage, WGSL);
 LLGL_STATIC_ASSERT_ENUM(ShadingLanguage, VersionBitmask);
 
 LLGL_STATIC_ASSERT_ENUM(ScreenOrigin, LowerLeft);
@@ -213,6 +217,16 @@ LLGL_STATIC_ASSERT_ENUM(StencilFace, FrontAndBack);
 LLGL_STATIC_ASSERT_ENUM(StencilFace, Front);
 LLGL_STATIC_ASSERT_ENUM(StencilFace, Back);
 
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, SetPipelineState);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, SetVertexBuffer);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, SetIndexBuffer);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, SetResourceHeap);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, SetResource);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, SetUniforms);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, Draw);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, DrawIndexed);
+LLGL_STATIC_ASSERT_ENUM(CommandOpcode, Dispatch);
+
 LLGL_STATIC_ASSERT_ENUM(Format, Undefined);
 LLGL_STATIC_ASSERT_ENUM(Format, A8UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, R8UNorm);
@@ -292,6 +306,10 @@ LLGL_STATIC_ASSERT_ENUM(Format, BC4UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, BC4SNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, BC5UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, BC5SNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, BC6HUFloat);
+LLGL_STATIC_ASSERT_ENUM(Format, BC6HSFloat);
+LLGL_STATIC_ASSERT_ENUM(Format, BC7UNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, BC7UNorm_sRGB);
 LLGL_STATIC_ASSERT_ENUM(Format, ASTC4x4);
 LLGL_STATIC_ASSERT_ENUM(Format, ASTC4x4_sRGB);
 LLGL_STATIC_ASSERT_ENUM(Format, ASTC5x4);
@@ -323,6 +341,28 @@ LLGL_STATIC_ASSERT_ENUM(Format, ASTC12x12_sRGB);
 LLGL_STATIC_ASSERT_ENUM(Format, ETC1UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, ETC2UNorm);
 LLGL_STATIC_ASSERT_ENUM(Format, ETC2UNorm_sRGB);
+LLGL_STATIC_ASSERT_ENUM(Format, ETC2A1UNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, ETC2A1UNorm_sRGB);
+LLGL_STATIC_ASSERT_ENUM(Format, ETC2A8UNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, ETC2A8UNorm_sRGB);
+LLGL_STATIC_ASSERT_ENUM(Format, EACR11UNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, EACR11SNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, EACRG11UNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, EACRG11SNorm);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC4x4Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC5x4Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC5x5Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC6x5Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC6x6Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC8x5Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC8x6Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC8x8Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC10x5Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC10x6Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC10x8Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC10x10Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC12x10Float);
+LLGL_STATIC_ASSERT_ENUM(Format, ASTC12x12Float);
 
 LLGL_STATIC_ASSERT_ENUM(ImageFormat, Alpha);
 LLGL_STATIC_ASSERT_ENUM(ImageFormat, R);
@@ -349,6 +389,19 @@ LLGL_STATIC_ASSERT_ENUM(DataType, Float16);
 LLGL_STATIC_ASSERT_ENUM(DataType, Float32);
 LLGL_STATIC_ASSERT_ENUM(DataType, Float64);
 
+LLGL_STATIC_ASSERT_ENUM(ImageCompressionQuality, Fast);
+LLGL_STATIC_ASSERT_ENUM(ImageCompressionQuality, Default);
+LLGL_STATIC_ASSERT_ENUM(ImageCompressionQuality, High);
+
+LLGL_STATIC_ASSERT_ENUM(ImageMipMapFilter, Box);
+LLGL_STATIC_ASSERT_ENUM(ImageMipMapFilter, Kaiser);
+
+LLGL_STATIC_ASSERT_ENUM(ImageResampleFilter, Box);
+LLGL_STATIC_ASSERT_ENUM(ImageResampleFilter, Bilinear);
+LLGL_STATIC_ASSERT_ENUM(ImageResampleFilter, Mitchell);
+LLGL_STATIC_ASSERT_ENUM(ImageResampleFilter, Lanczos3);
+LLGL_STATIC_ASSERT_ENUM(ImageResampleFilter, Kaiser);
+
 LLGL_STATIC_ASSERT_ENUM(SystemValue, Undefined);
 LLGL_STATIC_ASSERT_ENUM(SystemValue, ClipDistance);
 LLGL_STATIC_ASSERT_ENUM(SystemValue, Color);
@@ -400,6 +453,10 @@ LLGL_STATIC_ASSERT_ENUM(ShaderType, TessEvaluation);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Geometry);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Fragment);
 LLGL_STATIC_ASSERT_ENUM(ShaderType, Compute);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, RayGeneration);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, Miss);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, ClosestHit);
+LLGL_STATIC_ASSERT_ENUM(ShaderType, AnyHit);
 
 LLGL_STATIC_ASSERT_ENUM(ShaderSourceType, CodeString);
 LLGL_STATIC_ASSERT_ENUM(ShaderSourceType, CodeFile);
@@ -618,6 +675,9 @@ LLGL_STATIC_ASSERT_ENUM(StorageBufferType, RWByteAddressBuffer);
 LLGL_STATIC_ASSERT_ENUM(StorageBufferType, AppendStructuredBuffer);
 LLGL_STATIC_ASSERT_ENUM(StorageBufferType, ConsumeStructuredBuffer);
 
+LLGL_STATIC_ASSERT_ENUM(AccelerationStructureType, BottomLevel);
+LLGL_STATIC_ASSERT_ENUM(AccelerationStructureType, TopLevel);
+
 LLGL_STATIC_ASSERT_ENUM(QueryType, SamplesPassed);
 LLGL_STATIC_ASSERT_ENUM(QueryType, AnySamplesPassed);
 LLGL_STATIC_ASSERT_ENUM(QueryType, AnySamplesPassedConservative);
@@ -625,6 +685,7 @@ LLGL_STATIC_ASSERT_ENUM(QueryType, TimeElapsed);
 LLGL_STATIC_ASSERT_ENUM(QueryType, StreamOutPrimitivesWritten);
 LLGL_STATIC_ASSERT_ENUM(QueryType, StreamOutOverflow);
 LLGL_STATIC_ASSERT_ENUM(QueryType, PipelineStatistics);
+LLGL_STATIC_ASSERT_ENUM(QueryType, Timestamp);
 
 LLGL_STATIC_ASSERT_ENUM(AttachmentLoadOp, Undefined);
 LLGL_STATIC_ASSERT_ENUM(AttachmentLoadOp, Load);
@@ -643,6 +704,11 @@ LLGL_STATIC_ASSERT_ENUM(WarningType, ImproperState);
 LLGL_STATIC_ASSERT_ENUM(WarningType, PointlessOperation);
 LLGL_STATIC_ASSERT_ENUM(WarningType, VaryingBehavior);
 
+LLGL_STATIC_ASSERT_ENUM(ProfileEventType, Encoding);
+LLGL_STATIC_ASSERT_ENUM(ProfileEventType, Submission);
+LLGL_STATIC_ASSERT_ENUM(ProfileEventType, Wait);
+LLGL_STATIC_ASSERT_ENUM(ProfileEventType, Present);
+
 
 /* ----- Flags ----- */
 
@@ -680,6 +746,14 @@ LLGL_STATIC_ASSERT_FLAG(Barrier, StorageBuffer);
 LLGL_STATIC_ASSERT_FLAG(Barrier, StorageTexture);
 LLGL_STATIC_ASSERT_FLAG(Barrier, Storage);
 
+LLGL_STATIC_ASSERT_FLAG(PipelineLayout, BindlessHeap);
+
+LLGL_STATIC_ASSERT_FLAG(Validation, APIUsage);
+LLGL_STATIC_ASSERT_FLAG(Validation, ResourceBindings);
+LLGL_STATIC_ASSERT_FLAG(Validation, DrawRanges);
+LLGL_STATIC_ASSERT_FLAG(Validation, Barriers);
+LLGL_STATIC_ASSERT_FLAG(Validation, All);
+
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, Debug);
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, NoOptimization);
 LLGL_STATIC_ASSERT_FLAG(ShaderCompile, OptimizationLevel1);
@@ -698,6 +772,11 @@ LLGL_STATIC_ASSERT_FLAG(Stage, ComputeStage);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllTessStages);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllGraphicsStages);
 LLGL_STATIC_ASSERT_FLAG(Stage, AllStages);
+LLGL_STATIC_ASSERT_FLAG(Stage, RayGenerationStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, MissStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, ClosestHitStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, AnyHitStage);
+LLGL_STATIC_ASSERT_FLAG(Stage, AllRayTracingStages);
 
 LLGL_STATIC_ASSERT_FLAG(Bind, VertexBuffer);
 LLGL_STATIC_ASSERT_FLAG(Bind, IndexBuffer);
@@ -711,6 +790,8 @@ LLGL_STATIC_ASSERT_FLAG(Bind, DepthStencilAttachment);
 LLGL_STATIC_ASSERT_FLAG(Bind, CombinedSampler);
 LLGL_STATIC_ASSERT_FLAG(Bind, CopySrc);
 LLGL_STATIC_ASSERT_FLAG(Bind, CopyDst);
+LLGL_STATIC_ASSERT_FLAG(Bind, AccelerationStructure);
+LLGL_STATIC_ASSERT_FLAG(Bind, ComputeStreamOutput);
 
 LLGL_STATIC_ASSERT_FLAG(CPUAccess, Read);
 LLGL_STATIC_ASSERT_FLAG(CPUAccess, Write);
@@ -721,6 +802,12 @@ LLGL_STATIC_ASSERT_FLAG(Misc, GenerateMips);
 LLGL_STATIC_ASSERT_FLAG(Misc, NoInitialData);
 LLGL_STATIC_ASSERT_FLAG(Misc, Append);
 LLGL_STATIC_ASSERT_FLAG(Misc, Counter);
+LLGL_STATIC_ASSERT_FLAG(Misc, PersistentMapping);
+LLGL_STATIC_ASSERT_FLAG(Misc, Sparse);
+
+LLGL_STATIC_ASSERT_FLAG(AccelerationStructure, AllowUpdate);
+LLGL_STATIC_ASSERT_FLAG(AccelerationStructure, PreferFastTrace);
+LLGL_STATIC_ASSERT_FLAG(AccelerationStructure, PreferFastBuild);
 
 LLGL_STATIC_ASSERT_FLAG(StdOut, Colored);
 
@@ -841,6 +928,10 @@ LLGL_STATIC_ASSERT_OFFSET(TessellationDescriptor, partition);
 LLGL_STATIC_ASSERT_OFFSET(TessellationDescriptor, maxTessFactor);
 LLGL_STATIC_ASSERT_OFFSET(TessellationDescriptor, outputWindingCCW);
 
+LLGL_STATIC_ASSERT_SIZE(SpecializationConstant);
+LLGL_STATIC_ASSERT_OFFSET(SpecializationConstant, id);
+LLGL_STATIC_ASSERT_OFFSET(SpecializationConstant, value);
+
 LLGL_STATIC_ASSERT_SIZE(ClearValue);
 LLGL_STATIC_ASSERT_OFFSET(ClearValue, color);
 LLGL_STATIC_ASSERT_OFFSET(ClearValue, depth);
@@ -851,12 +942,24 @@ LLGL_STATIC_ASSERT_OFFSET(AttachmentClear, flags);
 LLGL_STATIC_ASSERT_OFFSET(AttachmentClear, colorAttachment);
 LLGL_STATIC_ASSERT_OFFSET(AttachmentClear, clearValue);
 
+LLGL_STATIC_ASSERT_SIZE(TransientBufferAllocation);
+LLGL_STATIC_ASSERT_OFFSET(TransientBufferAllocation, buffer);
+LLGL_STATIC_ASSERT_OFFSET(TransientBufferAllocation, offset);
+LLGL_STATIC_ASSERT_OFFSET(TransientBufferAllocation, size);
+LLGL_STATIC_ASSERT_OFFSET(TransientBufferAllocation, data);
+
 LLGL_STATIC_ASSERT_SIZE(CommandBufferDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, debugName);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, flags);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, numNativeBuffers);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, minStagingPoolSize);
 LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, renderPass);
+LLGL_STATIC_ASSERT_OFFSET(CommandBufferDescriptor, queueType);
+
+LLGL_STATIC_ASSERT_SIZE(IndirectArgumentDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(IndirectArgumentDescriptor, type);
+LLGL_STATIC_ASSERT_OFFSET(IndirectArgumentDescriptor, first);
+LLGL_STATIC_ASSERT_OFFSET(IndirectArgumentDescriptor, numUniforms);
 
 LLGL_STATIC_ASSERT_SIZE(FormatAttributes);
 LLGL_STATIC_ASSERT_OFFSET(FormatAttributes, bitSize);
@@ -916,6 +1019,14 @@ LLGL_STATIC_ASSERT_OFFSET(SubresourceFootprint, rowStride);
 LLGL_STATIC_ASSERT_OFFSET(SubresourceFootprint, layerSize);
 LLGL_STATIC_ASSERT_OFFSET(SubresourceFootprint, layerStride);
 
+LLGL_STATIC_ASSERT_SIZE(TileMappingDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(TileMappingDescriptor, texture);
+LLGL_STATIC_ASSERT_OFFSET(TileMappingDescriptor, mipLevel);
+LLGL_STATIC_ASSERT_OFFSET(TileMappingDescriptor, arrayLayer);
+LLGL_STATIC_ASSERT_OFFSET(TileMappingDescriptor, tileOffset);
+LLGL_STATIC_ASSERT_OFFSET(TileMappingDescriptor, numTiles);
+LLGL_STATIC_ASSERT_OFFSET(TileMappingDescriptor, resident);
+
 LLGL_STATIC_ASSERT_SIZE(SwapChainDescriptor);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, debugName);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, resolution);
@@ -924,8 +1035,27 @@ LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, depthBits);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, stencilBits);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, swapBuffers);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, maxFramesInFlight);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, frameStatisticsWindow);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, presentMode);
+LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, colorSpace);
 LLGL_STATIC_ASSERT_OFFSET(SwapChainDescriptor, fullscreen);
 
+LLGL_STATIC_ASSERT_SIZE(FrameTimeStatistics);
+LLGL_STATIC_ASSERT_OFFSET(FrameTimeStatistics, last);
+LLGL_STATIC_ASSERT_OFFSET(FrameTimeStatistics, average);
+LLGL_STATIC_ASSERT_OFFSET(FrameTimeStatistics, p50);
+LLGL_STATIC_ASSERT_OFFSET(FrameTimeStatistics, p95);
+LLGL_STATIC_ASSERT_OFFSET(FrameTimeStatistics, p99);
+
+LLGL_STATIC_ASSERT_SIZE(FrameStatistics);
+LLGL_STATIC_ASSERT_OFFSET(FrameStatistics, numFrames);
+LLGL_STATIC_ASSERT_OFFSET(FrameStatistics, numSamples);
+LLGL_STATIC_ASSERT_OFFSET(FrameStatistics, cpuFrameTime);
+LLGL_STATIC_ASSERT_OFFSET(FrameStatistics, displayFrameTime);
+LLGL_STATIC_ASSERT_OFFSET(FrameStatistics, presentInterval);
+LLGL_STATIC_ASSERT_OFFSET(FrameStatistics, queueStallTime);
+
 LLGL_STATIC_ASSERT_SIZE(RenderingFeatures);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderTargets);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, has3DTextures);
@@ -954,6 +1084,22 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasLogicOp);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineCaching);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPipelineStatistics);
 LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRenderCondition);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasTimestampQueries);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasQueryResolve);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasBindlessResourceHeaps);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasIndirectCountDrawing);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasMeshShaders);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasTileShaders);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasFramebufferFetch);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasVariableRateShading);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasIndirectStateChanges);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasTransientBuffers);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPersistentMapping);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasSparseTextures);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasPlacementHeaps);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasConcurrentResourceCreation);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRayTracing);
+LLGL_STATIC_ASSERT_OFFSET(RenderingFeatures, hasRayQuery);
 
 LLGL_STATIC_ASSERT_SIZE(RenderingLimits);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, lineWidthRange);
@@ -967,6 +1113,7 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxCubeTextureSize);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxAnisotropy);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxComputeShaderWorkGroups);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxComputeShaderWorkGroupSize);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxComputeShaderSharedMemorySize);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxViewports);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxViewportSize);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxBufferSize);
@@ -981,6 +1128,12 @@ LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxDepthBufferSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxStencilBufferSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxNoAttachmentSamples);
 LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, storageResourceStageFlags);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, maxBindlessResourceViews);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, sparseTileSize);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, shadingRateImageTileSize);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, subgroupSizeRange);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, subgroupStageFlags);
+LLGL_STATIC_ASSERT_OFFSET(RenderingLimits, subgroupOperationFlags);
 
 LLGL_STATIC_ASSERT_SIZE(ImageView);
 LLGL_STATIC_ASSERT_OFFSET(ImageView, format);
@@ -990,6 +1143,23 @@ LLGL_STATIC_ASSERT_OFFSET(ImageView, dataSize);
 LLGL_STATIC_ASSERT_OFFSET(ImageView, rowStride);
 LLGL_STATIC_ASSERT_OFFSET(ImageView, layerStride);
 
+LLGL_STATIC_ASSERT_SIZE(TextureUploadDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(TextureUploadDescriptor, texture);
+LLGL_STATIC_ASSERT_OFFSET(TextureUploadDescriptor, region);
+LLGL_STATIC_ASSERT_OFFSET(TextureUploadDescriptor, imageView);
+
+LLGL_STATIC_ASSERT_SIZE(FileUploadDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, filename);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, fileOffset);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, fileSize);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, compression);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, uncompressedSize);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, buffer);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, bufferOffset);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, texture);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, textureRegion);
+LLGL_STATIC_ASSERT_OFFSET(FileUploadDescriptor, rowStride);
+
 LLGL_STATIC_ASSERT_SIZE(MutableImageView);
 LLGL_STATIC_ASSERT_OFFSET(MutableImageView, format);
 LLGL_STATIC_ASSERT_OFFSET(MutableImageView, dataType);
@@ -1045,11 +1215,45 @@ LLGL_STATIC_ASSERT_OFFSET(RenderTargetDescriptor, samples);
 LLGL_STATIC_ASSERT_OFFSET(RenderTargetDescriptor, colorAttachments);
 LLGL_STATIC_ASSERT_OFFSET(RenderTargetDescriptor, resolveAttachments);
 LLGL_STATIC_ASSERT_OFFSET(RenderTargetDescriptor, depthStencilAttachment);
+LLGL_STATIC_ASSERT_OFFSET(RenderTargetDescriptor, shadingRateAttachment);
 
 LLGL_STATIC_ASSERT_SIZE(BindingSlot);
 LLGL_STATIC_ASSERT_OFFSET(BindingSlot, index);
 LLGL_STATIC_ASSERT_OFFSET(BindingSlot, set);
 
+LLGL_STATIC_ASSERT_SIZE(PlacementHeapDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(PlacementHeapDescriptor, debugName);
+LLGL_STATIC_ASSERT_OFFSET(PlacementHeapDescriptor, size);
+
+LLGL_STATIC_ASSERT_SIZE(MemoryRequirements);
+LLGL_STATIC_ASSERT_OFFSET(MemoryRequirements, size);
+LLGL_STATIC_ASSERT_OFFSET(MemoryRequirements, alignment);
+
+// Arrays of these structures are passed directly in LLGLAccelerationStructureDescriptor; see C99CommandBuffer.cpp.
+LLGL_STATIC_ASSERT_SIZE(AccelerationStructureGeometryDescriptor);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, vertexBuffer);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, vertexOffset);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, vertexStride);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, numVertices);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, vertexFormat);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, indexFormat);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, indexBuffer);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, indexOffset);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, numIndices);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureGeometryDescriptor, opaque);
+
+LLGL_STATIC_ASSERT_SIZE(AccelerationStructureInstance);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureInstance, accelerationStructure);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureInstance, transform);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureInstance, instanceID);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureInstance, mask);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureInstance, hitGroupOffset);
+
+LLGL_STATIC_ASSERT_SIZE(AccelerationStructureSizes);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureSizes, accelerationStructureSize);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureSizes, buildScratchSize);
+LLGL_STATIC_ASSERT_OFFSET(AccelerationStructureSizes, updateScratchSize);
+
 LLGL_STATIC_ASSERT_SIZE(QueryPipelineStatistics);
 LLGL_STATIC_ASSERT_OFFSET(QueryPipelineStatistics, inputAssemblyVertices);
 LLGL_STATIC_ASSERT_OFFSET(QueryPipelineStatistics, inputAssemblyPrimitives);
@@ -1085,6 +1289,28 @@ LLGL_STATIC_ASSERT_SIZE(DisplayMode);
 LLGL_STATIC_ASSERT_OFFSET(DisplayMode, resolution);
 LLGL_STATIC_ASSERT_OFFSET(DisplayMode, refreshRate);
 
+LLGL_STATIC_ASSERT_SIZE(DrawRecord);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, vertexBuffer);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, indexBuffer);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, resourceHeap);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, descriptorSet);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, uniformsOffset);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, numVertices);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, numInstances);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, firstVertex);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, vertexOffset);
+LLGL_STATIC_ASSERT_OFFSET(DrawRecord, firstInstance);
+
+LLGL_STATIC_ASSERT_SIZE(CommandRecord);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, opcode);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, objectIndex);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, arg0);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, arg1);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, arg2);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, arg3);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, arg4);
+LLGL_STATIC_ASSERT_OFFSET(CommandRecord, arg5);
+
 LLGL_STATIC_ASSERT_SIZE(DrawIndirectArguments);
 LLGL_STATIC_ASSERT_OFFSET(DrawIndirectArguments, numVertices);
 LLGL_STATIC_ASSERT_OFFSET(DrawIndirectArguments, numInstances);
@@ -1107,6 +1333,9 @@ LLGL_STATIC_ASSERT_OFFSET(DrawPatchIndirectArguments, firstInstance);
 LLGL_STATIC_ASSERT_SIZE(DispatchIndirectArguments);
 LLGL_STATIC_ASSERT_OFFSET(DispatchIndirectArguments, numThreadGroups);
 
+LLGL_STATIC_ASSERT_SIZE(DrawMeshTasksIndirectArguments);
+LLGL_STATIC_ASSERT_OFFSET(DrawMeshTasksIndirectArguments, numWorkGroups);
+
 LLGL_STATIC_ASSERT_SIZE(ProfileCommandQueueRecord);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, bufferWrites);
 LLGL_STATIC_ASSERT_OFFSET(ProfileCommandQueueRecord, bufferReads);
@@ -1147,6 +1376,16 @@ LLGL_STATIC_ASSERT_OFFSET(ColorCodes, textFlags);
 LLGL_STATIC_ASSERT_OFFSET(ColorCodes, backgroundFlags);
 
 
+/* ----- Handles ----- */
+
+// Arrays of wrapper handles are passed directly as arrays of object pointers; see C99RenderSystem.cpp and C99CommandBuffer.cpp.
+LLGL_STATIC_ASSERT_HANDLE(Buffer);
+LLGL_STATIC_ASSERT_HANDLE(Texture);
+LLGL_STATIC_ASSERT_HANDLE(Shader);
+LLGL_STATIC_ASSERT_HANDLE(ResourceHeap);
+LLGL_STATIC_ASSERT_HANDLE(RenderSystemChild);
+
+
 // } /namespace LLGL
 
 
@@ -0,0 +1,110 @@
+/*
+ * CommandBatch.cs
+ *
+ * Copyright (c) 2015 Lukas Hermanns. All rights reserved.
+ * Licensed under the terms of the BSD 3-Clause license (see LICENSE.txt).
+ */
+
+using System;
+
+namespace LLGL
+{
+    // Table of objects that command records refer to by index; see CommandRecord.ObjectIndex and CommandBuffer.ExecuteCommandBatch().
+    // The native handles are stored once when an object is added, so executing a batch does not convert any objects.
+    public sealed class CommandBatchObjects
+    {
+        private NativeLLGL.RenderSystemChild[] natives;
+        private int count = 0;
+
+        public CommandBatchObjects(int capacity = 16)
+        {
+            natives = new NativeLLGL.RenderSystemChild[Math.Max(1, capacity)];
+        }
+
+        public int Count
+        {
+            get
+            {
+                return count;
+            }
+        }
+
+        // Adds the specified object to the table and returns its index for CommandRecord.ObjectIndex.
+        public int Add(RenderSystemChild instance)
+        {
+            if (count == natives.Length)
+            {
+                Array.Resize(ref natives, natives.Length * 2);
+            }
+            natives[count] = instance.NativeChild;
+            return count++;
+        }
+
+        public void Clear()
+        {
+            count = 0;
+        }
+
+        internal ReadOnlySpan<NativeLLGL.RenderSystemChild> Natives
+        {
+            get
+            {
+                return new ReadOnlySpan<NativeLLGL.RenderSystemChild>(natives, 0, count);
+            }
+        }
+    }
+
+    // Helper functions to fill command records with the arguments in the order described by CommandOpcode.
+    public static class CommandRecords
+    {
+        public static CommandRecord SetPipelineState(int pipelineStateIndex)
+        {
+            return new CommandRecord(CommandOpcode.SetPipelineState, pipelineStateIndex);
+        }
+
+        public static CommandRecord SetVertexBuffer(int bufferIndex)
+        {
+            return new CommandRecord(CommandOpcode.SetVertexBuffer, bufferIndex);
+        }
+
+        public static CommandRecord SetIndexBuffer(int bufferIndex, Format format = Format.R32UInt, int offset = 0)
+        {
+            return new CommandRecord(CommandOpcode.SetIndexBuffer, bufferIndex, (int)format, offset);
+        }
+
+        public static CommandRecord SetResourceHeap(int resourceHeapIndex, int descriptorSet = 0)
+        {
+            return new CommandRecord(CommandOpcode.SetResourceHeap, resourceHeapIndex, descriptorSet);
+        }
+
+        public static CommandRecord SetResource(int descriptor, int resourceIndex)
+        {
+            return new CommandRecord(CommandOpcode.SetResource, resourceIndex, descriptor);
+        }
+
+        public static CommandRecord SetUniforms(int first, int uniformDataOffset, int uniformDataSize)
+        {
+            return new CommandRecord(CommandOpcode.SetUniforms, -1, first, uniformDataOffset, uniformDataSize);
+        }
+
+        public static CommandRecord Draw(int numVertices, int firstVertex, int numInstances = 1, int firstInstance = 0)
+        {
+            return new CommandRecord(CommandOpcode.Draw, -1, numVertices, firstVertex, numInstances, firstInstance);
+        }
+
+        public static CommandRecord DrawIndexed(int numIndices, int firstIndex, int numInstances = 1, int vertexOffset = 0, int firstInstance = 0)
+        {
+            return new CommandRecord(CommandOpcode.DrawIndexed, -1, numIndices, firstIndex, numInstances, vertexOffset, firstInstance);
+        }
+
+        public static CommandRecord Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
+        {
+            return new CommandRecord(CommandOpcode.Dispatch, -1, numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+        }
+    }
+}
+
+
+
+
+// ================================================================================
@@ -310,6 +310,11 @@ namespace LLGL
             NativeLLGL.SetStencilReference(reference, stencilFace);
         }
 
+        public void SetShadingRate(ShadingRate rate)
+        {
+            NativeLLGL.SetShadingRate(rate);
+        }
+
         public void SetUniforms(int first, byte[] data)
         {
             unsafe
@@ -336,6 +341,11 @@ namespace LLGL
             NativeLLGL.EndQuery(queryHeap.Native, query);
         }
 
+        public void ResolveQueryData(QueryHeap srcQueryHeap, int firstQuery, int numQueries, Buffer dstBuffer, long dstOffset)
+        {
+            NativeLLGL.ResolveQueryData(srcQueryHeap.Native, firstQuery, numQueries, dstBuffer.Native, dstOffset);
+        }
+
         public void BeginRenderCondition(QueryHeap queryHeap, int query, RenderConditionMode mode)
         {
             NativeLLGL.BeginRenderCondition(queryHeap.Native, query, mode);
@@ -419,11 +429,131 @@ namespace LLGL
             NativeLLGL.DrawIndexedIndirectExt(buffer.Native, offset, numCommands, stride);
         }
 
+        public void DrawIndirectCount(Buffer buffer, long offset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndirectCount(buffer.Native, offset, countBuffer.Native, countOffset, maxNumCommands, stride);
+        }
+
+        public void DrawIndexedIndirectCount(Buffer buffer, long offset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride)
+        {
+            NativeLLGL.DrawIndexedIndirectCount(buffer.Native, offset, countBuffer.Native, countOffset, maxNumCommands, stride);
+        }
+
         public void DrawStreamOutput()
         {
             NativeLLGL.DrawStreamOutput();
         }
 
+        public void DrawMeshTasks(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
+        {
+            NativeLLGL.DrawMeshTasks(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
+        }
+
+        public void DrawMeshTasksIndirect(Buffer buffer, long offset, int numCommands, int stride)
+        {
+            NativeLLGL.DrawMeshTasksIndirect(buffer.Native, offset, numCommands, stride);
+        }
+
+        public void DispatchTiles()
+        {
+            NativeLLGL.DispatchTiles();
+        }
+
+        public void ExecuteIndirect(IndirectArgumentDescriptor[] arguments, int stride, Buffer buffer, long offset, Buffer countBuffer, long countOffset, int maxNumCommands)
+        {
+            unsafe
+            {
+                fixed (IndirectArgumentDescriptor* argumentsPtr = arguments)
+                {
+                    var nativeCommandDesc = new NativeLLGL.IndirectCommandDescriptor();
+                    nativeCommandDesc.numArguments  = (IntPtr)arguments.Length;
+                    nativeCommandDesc.arguments     = argumentsPtr;
+                    nativeCommandDesc.stride        = stride;
+                    NativeLLGL.ExecuteIndirect(ref nativeCommandDesc, buffer.Native, offset, countBuffer != null ? countBuffer.Native : new NativeLLGL.Buffer(), countOffset, maxNumCommands);
+                }
+            }
+        }
+
+        public void DrawPacked(ReadOnlySpan<Buffer> vertexBuffers, ReadOnlySpan<Buffer> indexBuffers, ReadOnlySpan<ResourceHeap> resourceHeaps, ReadOnlySpan<DrawRecord> records, bool indexed = false, Format indexFormat = Format.R32UInt)
+        {
+            DrawPacked(vertexBuffers, indexBuffers, resourceHeaps, records, ReadOnlySpan<byte>.Empty, 0, 0, indexed, indexFormat);
+        }
+
+        public void DrawPacked(ReadOnlySpan<Buffer> vertexBuffers, ReadOnlySpan<Buffer> indexBuffers, ReadOnlySpan<ResourceHeap> resourceHeaps, ReadOnlySpan<DrawRecord> records, ReadOnlySpan<byte> uniformData, int firstUniform, int uniformsSize, bool indexed = false, Format indexFormat = Format.R32UInt)
+        {
+            unsafe
+            {
+                var nativeVertexBuffers = stackalloc NativeLLGL.Buffer[vertexBuffers.Length];
+                for (int i = 0; i < vertexBuffers.Length; ++i)
+                {
+                    nativeVertexBuffers[i] = vertexBuffers[i].Native;
+                }
+
+                var nativeIndexBuffers = stackalloc NativeLLGL.Buffer[indexBuffers.Length];
+                for (int i = 0; i < indexBuffers.Length; ++i)
+                {
+                    nativeIndexBuffers[i] = indexBuffers[i].Native;
+                }
+
+                var nativeResourceHeaps = stackalloc NativeLLGL.ResourceHeap[resourceHeaps.Length];
+                for (int i = 0; i < resourceHeaps.Length; ++i)
+                {
+                    nativeResourceHeaps[i] = resourceHeaps[i].Native;
+                }
+
+                fixed (DrawRecord* recordsPtr = records)
+                {
+                    fixed (byte* uniformDataPtr = uniformData)
+                    {
+                        var nativeDrawDesc = new NativeLLGL.DrawPackedDescriptor();
+                        nativeDrawDesc.numVertexBuffers = (IntPtr)vertexBuffers.Length;
+                        nativeDrawDesc.vertexBuffers    = nativeVertexBuffers;
+                        nativeDrawDesc.numIndexBuffers  = (IntPtr)indexBuffers.Length;
+                        nativeDrawDesc.indexBuffers     = nativeIndexBuffers;
+                        nativeDrawDesc.indexFormat      = indexFormat;
+                        nativeDrawDesc.numResourceHeaps = (IntPtr)resourceHeaps.Length;
+                        nativeDrawDesc.resourceHeaps    = nativeResourceHeaps;
+                        nativeDrawDesc.uniformData      = uniformDataPtr;
+                        nativeDrawDesc.firstUniform     = firstUniform;
+                        nativeDrawDesc.uniformsSize     = (short)uniformsSize;
+                        nativeDrawDesc.indexed          = indexed;
+                        nativeDrawDesc.numRecords       = (IntPtr)records.Length;
+                        nativeDrawDesc.records          = recordsPtr;
+                        NativeLLGL.DrawPacked(ref nativeDrawDesc);
+                    }
+                }
+            }
+        }
+
+        // Encodes all command records with a single native call. The records and uniform data are passed without copying.
+        public void ExecuteCommandBatch(CommandBatchObjects objects, ReadOnlySpan<CommandRecord> records)
+        {
+            ExecuteCommandBatch(objects, records, ReadOnlySpan<byte>.Empty);
+        }
+
+        public void ExecuteCommandBatch(CommandBatchObjects objects, ReadOnlySpan<CommandRecord> records, ReadOnlySpan<byte> uniformData)
+        {
+            unsafe
+            {
+                fixed (NativeLLGL.RenderSystemChild* objectsPtr = objects.Natives)
+                {
+                    fixed (CommandRecord* recordsPtr = records)
+                    {
+                        fixed (byte* uniformDataPtr = uniformData)
+                        {
+                            var nativeBatchDesc = new NativeLLGL.CommandBatchDescriptor();
+                            nativeBatchDesc.numObjects  = (IntPtr)objects.Count;
+                            nativeBatchDesc.objects     = objectsPtr;
+                            nativeBatchDesc.uniformData = uniformDataPtr;
+                            nativeBatchDesc.numRecords  = (IntPtr)records.Length;
+                            nativeBatchDesc.records     = recordsPtr;
+                            NativeLLGL.ExecuteCommandBatch(ref nativeBatchDesc);
+                        }
+                    }
+                }
+            }
+        }
+
         public void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ)
         {
             NativeLLGL.Dispatch(numWorkGroupsX, numWorkGroupsY, numWorkGroupsZ);
@@ -434,6 +564,11 @@ namespace LLGL
             NativeLLGL.DispatchIndirect(buffer.Native, offset);
         }
 
+        public void DispatchRays(int width, int height, int depth = 1)
+        {
+            NativeLLGL.DispatchRays(width, height, depth);
+        }
+
         public void PushDebugGroup(string name)
         {
             NativeLLGL.PushDebugGroup(name);
@@ -33,6 +33,11 @@ namespace LLGL
         {
             NativeLLGL.ReleaseFence(Native);
         }
+
+        public bool IsSignaled()
+        {
+            return NativeLLGL.IsFenceSignaled(Native);
+        }
     }
 }
 
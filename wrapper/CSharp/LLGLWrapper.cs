@@ -37,6 +37,12 @@ namespace LLGL
 
     /* ----- Enumerations ----- */
 
+    public enum AccelerationStructureType
+    {
+        BottomLevel,
+        TopLevel,
+    }
+
     public enum EventAction
     {
         Began,
@@ -63,6 +69,46 @@ namespace LLGL
         Back,
     }
 
+    public enum ShadingRate
+    {
+        Rate1x1,
+        Rate1x2,
+        Rate2x1,
+        Rate2x2,
+        Rate2x4,
+        Rate4x2,
+        Rate4x4,
+    }
+
+    public enum CommandQueueType
+    {
+        Graphics,
+        Compute,
+        Copy,
+    }
+
+    public enum IndirectArgumentType
+    {
+        Draw,
+        DrawIndexed,
+        DrawMeshTasks,
+        Dispatch,
+        Uniforms,
+    }
+
+    public enum CommandOpcode
+    {
+        SetPipelineState,
+        SetVertexBuffer,
+        SetIndexBuffer,
+        SetResourceHeap,
+        SetResource,
+        SetUniforms,
+        Draw,
+        DrawIndexed,
+        Dispatch,
+    }
+
     public enum Format
     {
         Undefined,
@@ -144,6 +190,10 @@ namespace LLGL
         BC4SNorm,
         BC5UNorm,
         BC5SNorm,
+        BC6HUFloat,
+        BC6HSFloat,
+        BC7UNorm,
+        BC7UNorm_sRGB,
         ASTC4x4,
         ASTC4x4_sRGB,
         ASTC5x4,
@@ -175,6 +225,28 @@ namespace LLGL
         ETC1UNorm,
         ETC2UNorm,
         ETC2UNorm_sRGB,
+        ETC2A1UNorm,
+        ETC2A1UNorm_sRGB,
+        ETC2A8UNorm,
+        ETC2A8UNorm_sRGB,
+        EACR11UNorm,
+        EACR11SNorm,
+        EACRG11UNorm,
+        EACRG11SNorm,
+        ASTC4x4Float,
+        ASTC5x4Float,
+        ASTC5x5Float,
+        ASTC6x5Float,
+        ASTC6x6Float,
+        ASTC8x5Float,
+        ASTC8x6Float,
+        ASTC8x8Float,
+        ASTC10x5Float,
+        ASTC10x6Float,
+        ASTC10x8Float,
+        ASTC10x10Float,
+        ASTC12x10Float,
+        ASTC12x12Float,
     }
 
     public enum ImageFormat
@@ -213,6 +285,28 @@ namespace LLGL
         Float64,
     }
 
+    public enum ImageCompressionQuality
+    {
+        Fast,
+        Default,
+        High,
+    }
+
+    public enum ImageMipMapFilter
+    {
+        Box,
+        Kaiser,
+    }
+
+    public enum ImageResampleFilter
+    {
+        Box,
+        Bilinear,
+        Mitchell,
+        Lanczos3,
+        Kaiser,
+    }
+
     public enum ReportType
     {
         Default = 0,
@@ -574,6 +668,7 @@ namespace LLGL
         StreamOutPrimitivesWritten,
         StreamOutOverflow,
         PipelineStatistics,
+        Timestamp,
     }
 
     public enum ErrorType
@@ -592,6 +687,14 @@ namespace LLGL
         VaryingBehavior,
     }
 
+    public enum ProfileEventType
+    {
+        Encoding,
+        Submission,
+        Wait,
+        Present,
+    }
+
     public enum AttachmentLoadOp
     {
         Undefined,
@@ -656,6 +759,7 @@ namespace LLGL
         Metal_3_0      = (0x40000|300),
         SPIRV          = (0x50000),
         SPIRV_100      = (0x50000|100),
+        WGSL           = (0x60000),
         VersionBitmask = 0x0000ffff,
     }
 
@@ -679,6 +783,12 @@ namespace LLGL
         ReadWrite,
     }
 
+    public enum FileCompression
+    {
+        Uncompressed,
+        GDeflate,
+    }
+
     public enum ResourceType
     {
         Undefined,
@@ -687,6 +797,14 @@ namespace LLGL
         Sampler,
     }
 
+    public enum SharedHandleType
+    {
+        Undefined,
+        OpaqueFD,
+        OpaqueWin32,
+        IOSurface,
+    }
+
     public enum SamplerAddressMode
     {
         Repeat,
@@ -711,6 +829,13 @@ namespace LLGL
         Geometry,
         Fragment,
         Compute,
+        Task,
+        Mesh,
+        Tile,
+        RayGeneration,
+        Miss,
+        ClosestHit,
+        AnyHit,
     }
 
     public enum ShaderSourceType
@@ -734,6 +859,30 @@ namespace LLGL
         ConsumeStructuredBuffer,
     }
 
+    public enum PresentMode
+    {
+        Default,
+        Fifo,
+        FifoRelaxed,
+        Mailbox,
+        Immediate,
+    }
+
+    public enum SurfaceTransform
+    {
+        Identity,
+        Rotate90,
+        Rotate180,
+        Rotate270,
+    }
+
+    public enum ColorSpace
+    {
+        SRGB,
+        HDR10,
+        ScRGB,
+    }
+
     public enum SystemValue
     {
         Undefined,
@@ -778,8 +927,22 @@ namespace LLGL
         Alpha,
     }
 
+    public enum SamplerFeedbackType
+    {
+        MinMip,
+        MipRegionUsed,
+    }
+
     /* ----- Flags ----- */
 
+    [Flags]
+    public enum AccelerationStructureFlags : int
+    {
+        AllowUpdate     = (1 << 0),
+        PreferFastTrace = (1 << 1),
+        PreferFastBuild = (1 << 2),
+    }
+
     [Flags]
     public enum CanvasFlags : int
     {
@@ -789,9 +952,10 @@ namespace LLGL
     [Flags]
     public enum CommandBufferFlags : int
     {
-        Secondary       = (1 << 0),
-        MultiSubmit     = (1 << 1),
-        ImmediateSubmit = (1 << 2),
+        Secondary        = (1 << 0),
+        MultiSubmit      = (1 << 1),
+        ImmediateSubmit  = (1 << 2),
+        BakeDrawCommands = (1 << 3),
     }
 
     [Flags]
@@ -869,6 +1033,13 @@ namespace LLGL
         Storage        = (StorageBuffer | StorageTexture),
     }
 
+    [Flags]
+    public enum PipelineLayoutFlags : int
+    {
+        BindlessHeap    = (1 << 0),
+        RootDescriptors = (1 << 1),
+    }
+
     [Flags]
     public enum ColorMaskFlags : int
     {
@@ -880,6 +1051,22 @@ namespace LLGL
         All  = (R | G | B | A),
     }
 
+    [Flags]
+    public enum PipelineStateFlags : int
+    {
+        AsyncCompilation = (1 << 0),
+    }
+
+    [Flags]
+    public enum ValidationFlags : int
+    {
+        APIUsage         = (1 << 0),
+        ResourceBindings = (1 << 1),
+        DrawRanges       = (1 << 2),
+        Barriers         = (1 << 3),
+        All              = (APIUsage | ResourceBindings | DrawRanges | Barriers),
+    }
+
     [Flags]
     public enum RenderSystemFlags : int
     {
@@ -889,6 +1076,27 @@ namespace LLGL
         PreferIntel       = (1 << 3),
         SoftwareDevice    = (1 << 4),
         DebugBreakOnError = (1 << 5),
+        Headless          = (1 << 6),
+        SubmissionThread  = (1 << 7),
+    }
+
+    [Flags]
+    public enum MemoryHeapFlags : int
+    {
+        DeviceLocal = (1 << 0),
+    }
+
+    [Flags]
+    public enum SubgroupOperationFlags : int
+    {
+        Basic           = (1 << 0),
+        Vote            = (1 << 1),
+        Arithmetic      = (1 << 2),
+        Ballot          = (1 << 3),
+        Shuffle         = (1 << 4),
+        ShuffleRelative = (1 << 5),
+        Clustered       = (1 << 6),
+        Quad            = (1 << 7),
     }
 
     [Flags]
@@ -906,6 +1114,9 @@ namespace LLGL
         CombinedSampler        = (1 << 9),
         CopySrc                = (1 << 10),
         CopyDst                = (1 << 11),
+        ShadingRateAttachment  = (1 << 12),
+        AccelerationStructure  = (1 << 13),
+        ComputeStreamOutput    = (1 << 14),
     }
 
     [Flags]
@@ -919,12 +1130,24 @@ namespace LLGL
     [Flags]
     public enum MiscFlags : int
     {
-        DynamicUsage  = (1 << 0),
-        FixedSamples  = (1 << 1),
-        GenerateMips  = (1 << 2),
-        NoInitialData = (1 << 3),
-        Append        = (1 << 4),
-        Counter       = (1 << 5),
+        DynamicUsage      = (1 << 0),
+        FixedSamples      = (1 << 1),
+        GenerateMips      = (1 << 2),
+        NoInitialData     = (1 << 3),
+        Append            = (1 << 4),
+        Counter           = (1 << 5),
+        PersistentMapping = (1 << 6),
+        Sparse            = (1 << 7),
+        Untracked         = (1 << 8),
+        Transient         = (1 << 9),
+        Shared            = (1 << 10),
+        GPUConversion     = (1 << 11),
+    }
+
+    [Flags]
+    public enum ResourceHeapFlags : int
+    {
+        Dynamic = (1 << 0),
     }
 
     [Flags]
@@ -950,7 +1173,16 @@ namespace LLGL
         GeometryStage       = (1 << 3),
         FragmentStage       = (1 << 4),
         ComputeStage        = (1 << 5),
+        TaskStage           = (1 << 6),
+        MeshStage           = (1 << 7),
+        TileStage           = (1 << 8),
+        RayGenerationStage  = (1 << 9),
+        MissStage           = (1 << 10),
+        ClosestHitStage     = (1 << 11),
+        AnyHitStage         = (1 << 12),
         AllTessStages       = (TessControlStage | TessEvaluationStage),
+        AllMeshStages       = (TaskStage | MeshStage),
+        AllRayTracingStages = (RayGenerationStage | MissStage | ClosestHitStage | AnyHitStage),
         AllGraphicsStages   = (VertexStage | AllTessStages | GeometryStage | FragmentStage),
         AllStages           = (AllGraphicsStages | ComputeStage),
     }
@@ -977,6 +1209,34 @@ namespace LLGL
 
     /* ----- Structures ----- */
 
+    public struct DrawRecord
+    {
+        public DrawRecord(int vertexBuffer = -1, int indexBuffer = -1, int resourceHeap = -1, int descriptorSet = 0, int uniformsOffset = -1, int numVertices = 0, int numInstances = 1, int firstVertex = 0, int vertexOffset = 0, int firstInstance = 0)
+        {
+            VertexBuffer   = vertexBuffer;
+            IndexBuffer    = indexBuffer;
+            ResourceHeap   = resourceHeap;
+            DescriptorSet  = descriptorSet;
+            UniformsOffset = uniformsOffset;
+            NumVertices    = numVertices;
+            NumInstances   = numInstances;
+            FirstVertex    = firstVertex;
+            VertexOffset   = vertexOffset;
+            FirstInstance  = firstInstance;
+        }
+
+        public int VertexBuffer { get; set; }   /* = -1 */
+        public int IndexBuffer { get; set; }    /* = -1 */
+        public int ResourceHeap { get; set; }   /* = -1 */
+        public int DescriptorSet { get; set; }  /* = 0 */
+        public int UniformsOffset { get; set; } /* = -1 */
+        public int NumVertices { get; set; }    /* = 0 */
+        public int NumInstances { get; set; }   /* = 1 */
+        public int FirstVertex { get; set; }    /* = 0 */
+        public int VertexOffset { get; set; }   /* = 0 */
+        public int FirstInstance { get; set; }  /* = 0 */
+    }
+
     public struct DrawIndirectArguments
     {
         public int NumVertices { get; set; }
@@ -1050,6 +1310,18 @@ namespace LLGL
         public int Height { get; set; } /* = 0 */
     }
 
+    public struct SpecializationConstant
+    {
+        public SpecializationConstant(int id = 0, int value = 0)
+        {
+            Id    = id;
+            Value = value;
+        }
+
+        public int Id { get; set; }    /* = 0 */
+        public int Value { get; set; } /* = 0 */
+    }
+
     public struct QueryPipelineStatistics
     {
         public long InputAssemblyVertices { get; set; }           /* = 0 */
@@ -1135,6 +1407,44 @@ namespace LLGL
         public int Z { get; set; } /* = 0 */
     }
 
+    public struct IndirectArgumentDescriptor
+    {
+        public IndirectArgumentDescriptor(IndirectArgumentType type = IndirectArgumentType.Draw, int first = 0, int numUniforms = 0)
+        {
+            Type        = type;
+            First       = first;
+            NumUniforms = numUniforms;
+        }
+
+        public IndirectArgumentType Type { get; set; }        /* = IndirectArgumentType.Draw */
+        public int                  First { get; set; }       /* = 0 */
+        public int                  NumUniforms { get; set; } /* = 0 */
+    }
+
+    public struct CommandRecord
+    {
+        public CommandRecord(CommandOpcode opcode = CommandOpcode.Draw, int objectIndex = -1, int arg0 = 0, int arg1 = 0, int arg2 = 0, int arg3 = 0, int arg4 = 0, int arg5 = 0)
+        {
+            Opcode      = opcode;
+            ObjectIndex = objectIndex;
+            Arg0        = arg0;
+            Arg1        = arg1;
+            Arg2        = arg2;
+            Arg3        = arg3;
+            Arg4        = arg4;
+            Arg5        = arg5;
+        }
+
+        public CommandOpcode Opcode { get; set; }      /* = CommandOpcode.Draw */
+        public int           ObjectIndex { get; set; } /* = -1 */
+        public int           Arg0 { get; set; }        /* = 0 */
+        public int           Arg1 { get; set; }        /* = 0 */
+        public int           Arg2 { get; set; }        /* = 0 */
+        public int           Arg3 { get; set; }        /* = 0 */
+        public int           Arg4 { get; set; }        /* = 0 */
+        public int           Arg5 { get; set; }        /* = 0 */
+    }
+
     public struct FormatAttributes
     {
         public short       BitSize { get; set; }
@@ -1170,38 +1480,6 @@ namespace LLGL
 
     /* ----- Classes ----- */
 
-    public class CommandBufferDescriptor
-    {
-        public AnsiString         DebugName { get; set; }          = null;
-        public CommandBufferFlags Flags { get; set; }              = 0;
-        public int                NumNativeBuffers { get; set; }   = 0;
-        public long               MinStagingPoolSize { get; set; } = (0xFFFF+1);
-        public RenderPass         RenderPass { get; set; }         = null;
-
-        internal NativeLLGL.CommandBufferDescriptor Native
-        {
-            get
-            {
-                var native = new NativeLLGL.CommandBufferDescriptor();
-                unsafe
-                {
-                    fixed (byte* debugNamePtr = DebugName.Ascii)
-                    {
-                        native.debugName = debugNamePtr;
-                    }
-                    native.flags              = (int)Flags;
-                    native.numNativeBuffers   = NumNativeBuffers;
-                    native.minStagingPoolSize = MinStagingPoolSize;
-                    if (RenderPass != null)
-                    {
-                        native.renderPass = RenderPass.Native;
-                    }
-                }
-                return native;
-            }
-        }
-    }
-
     public class ColorCodes
     {
         public ColorFlags TextFlags { get; set; }       = 0;
@@ -1250,64 +1528,87 @@ namespace LLGL
         }
     }
 
-    public class ComputePipelineDescriptor
+    public class ProfileTimeRecord
     {
-        public AnsiString     DebugName { get; set; }      = null;
-        public PipelineLayout PipelineLayout { get; set; } = null;
-        public Shader         ComputeShader { get; set; }  = null;
+        public AnsiString Annotation { get; set; }
+        public long       CPUTicksStart { get; set; } = 0;
+        public long       CPUTicksEnd { get; set; }   = 0;
+        public long       ElapsedTime { get; set; }   = 0;
 
-        internal NativeLLGL.ComputePipelineDescriptor Native
+        public ProfileTimeRecord() { }
+
+        internal ProfileTimeRecord(NativeLLGL.ProfileTimeRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileTimeRecord Native
         {
             get
             {
-                var native = new NativeLLGL.ComputePipelineDescriptor();
+                var native = new NativeLLGL.ProfileTimeRecord();
                 unsafe
                 {
-                    fixed (byte* debugNamePtr = DebugName.Ascii)
-                    {
-                        native.debugName = debugNamePtr;
-                    }
-                    if (PipelineLayout != null)
-                    {
-                        native.pipelineLayout = PipelineLayout.Native;
-                    }
-                    if (ComputeShader != null)
+                    fixed (byte* annotationPtr = Annotation.Ascii)
                     {
-                        native.computeShader = ComputeShader.Native;
+                        native.annotation = annotationPtr;
                     }
+                    native.cpuTicksStart = CPUTicksStart;
+                    native.cpuTicksEnd   = CPUTicksEnd;
+                    native.elapsedTime   = ElapsedTime;
                 }
                 return native;
             }
+            set
+            {
+                unsafe
+                {
+                    Annotation    = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    CPUTicksStart = value.cpuTicksStart;
+                    CPUTicksEnd   = value.cpuTicksEnd;
+                    ElapsedTime   = value.elapsedTime;
+                }
+            }
         }
     }
 
-    public class ProfileTimeRecord
+    public class ProfileScopeRecord
     {
         public AnsiString Annotation { get; set; }
+        public int        Parent { get; set; }        = -1;
+        public int        Depth { get; set; }         = 0;
+        public long       Frame { get; set; }         = 0;
         public long       CPUTicksStart { get; set; } = 0;
         public long       CPUTicksEnd { get; set; }   = 0;
+        public long       GpuTicksStart { get; set; } = 0;
+        public long       GpuTicksEnd { get; set; }   = 0;
         public long       ElapsedTime { get; set; }   = 0;
 
-        public ProfileTimeRecord() { }
+        public ProfileScopeRecord() { }
 
-        internal ProfileTimeRecord(NativeLLGL.ProfileTimeRecord native)
+        internal ProfileScopeRecord(NativeLLGL.ProfileScopeRecord native)
         {
             Native = native;
         }
 
-        internal NativeLLGL.ProfileTimeRecord Native
+        internal NativeLLGL.ProfileScopeRecord Native
         {
             get
             {
-                var native = new NativeLLGL.ProfileTimeRecord();
+                var native = new NativeLLGL.ProfileScopeRecord();
                 unsafe
                 {
                     fixed (byte* annotationPtr = Annotation.Ascii)
                     {
                         native.annotation = annotationPtr;
                     }
+                    native.parent        = Parent;
+                    native.depth         = Depth;
+                    native.frame         = Frame;
                     native.cpuTicksStart = CPUTicksStart;
                     native.cpuTicksEnd   = CPUTicksEnd;
+                    native.gpuTicksStart = GpuTicksStart;
+                    native.gpuTicksEnd   = GpuTicksEnd;
                     native.elapsedTime   = ElapsedTime;
                 }
                 return native;
@@ -1317,8 +1618,13 @@ namespace LLGL
                 unsafe
                 {
                     Annotation    = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    Parent        = value.parent;
+                    Depth         = value.depth;
+                    Frame         = value.frame;
                     CPUTicksStart = value.cpuTicksStart;
                     CPUTicksEnd   = value.cpuTicksEnd;
+                    GpuTicksStart = value.gpuTicksStart;
+                    GpuTicksEnd   = value.gpuTicksEnd;
                     ElapsedTime   = value.elapsedTime;
                 }
             }
@@ -1423,39 +1729,86 @@ namespace LLGL
         }
     }
 
+    public class ProfileBackendRecord
+    {
+        public int  RedundantStateChanges { get; set; }    = 0;
+        public int  DescriptorCopies { get; set; }         = 0;
+        public int  DescriptorSetAllocations { get; set; } = 0;
+        public int  Barriers { get; set; }                 = 0;
+        public long StagingUploadBytes { get; set; }       = 0;
+
+        public ProfileBackendRecord() { }
+
+        internal ProfileBackendRecord(NativeLLGL.ProfileBackendRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileBackendRecord Native
+        {
+            set
+            {
+                RedundantStateChanges    = value.redundantStateChanges;
+                DescriptorCopies         = value.descriptorCopies;
+                DescriptorSetAllocations = value.descriptorSetAllocations;
+                Barriers                 = value.barriers;
+                StagingUploadBytes       = value.stagingUploadBytes;
+            }
+        }
+    }
+
     public class RenderingFeatures
     {
-        public bool HasRenderTargets { get; set; }             = false;
-        public bool Has3DTextures { get; set; }                = false;
-        public bool HasCubeTextures { get; set; }              = false;
-        public bool HasArrayTextures { get; set; }             = false;
-        public bool HasCubeArrayTextures { get; set; }         = false;
-        public bool HasMultiSampleTextures { get; set; }       = false;
-        public bool HasMultiSampleArrayTextures { get; set; }  = false;
-        public bool HasTextureViews { get; set; }              = false;
-        public bool HasTextureViewSwizzle { get; set; }        = false;
-        public bool HasTextureViewFormatSwizzle { get; set; }  = false;
-        public bool HasBufferViews { get; set; }               = false;
+        public bool HasRenderTargets { get; set; }              = false;
+        public bool Has3DTextures { get; set; }                 = false;
+        public bool HasCubeTextures { get; set; }               = false;
+        public bool HasArrayTextures { get; set; }              = false;
+        public bool HasCubeArrayTextures { get; set; }          = false;
+        public bool HasMultiSampleTextures { get; set; }        = false;
+        public bool HasMultiSampleArrayTextures { get; set; }   = false;
+        public bool HasTextureViews { get; set; }               = false;
+        public bool HasTextureViewSwizzle { get; set; }         = false;
+        public bool HasTextureViewFormatSwizzle { get; set; }   = false;
+        public bool HasBufferViews { get; set; }                = false;
         [Obsolete("LLGL.RenderingFeatures.hasSamplers is deprecated since 0.04b; All backends must support sampler states either natively or emulated.")]
-        public bool HasSamplers { get; set; }                  = true;
-        public bool HasConstantBuffers { get; set; }           = false;
-        public bool HasStorageBuffers { get; set; }            = false;
+        public bool HasSamplers { get; set; }                   = true;
+        public bool HasConstantBuffers { get; set; }            = false;
+        public bool HasStorageBuffers { get; set; }             = false;
         [Obsolete("LLGL.RenderingFeatures.hasUniforms is deprecated since 0.04b; All backends must support uniforms either natively or emulated.")]
-        public bool HasUniforms { get; set; }                  = true;
-        public bool HasGeometryShaders { get; set; }           = false;
-        public bool HasTessellationShaders { get; set; }       = false;
-        public bool HasTessellatorStage { get; set; }          = false;
-        public bool HasComputeShaders { get; set; }            = false;
-        public bool HasInstancing { get; set; }                = false;
-        public bool HasOffsetInstancing { get; set; }          = false;
-        public bool HasIndirectDrawing { get; set; }           = false;
-        public bool HasViewportArrays { get; set; }            = false;
-        public bool HasConservativeRasterization { get; set; } = false;
-        public bool HasStreamOutputs { get; set; }             = false;
-        public bool HasLogicOp { get; set; }                   = false;
-        public bool HasPipelineCaching { get; set; }           = false;
-        public bool HasPipelineStatistics { get; set; }        = false;
-        public bool HasRenderCondition { get; set; }           = false;
+        public bool HasUniforms { get; set; }                   = true;
+        public bool HasGeometryShaders { get; set; }            = false;
+        public bool HasTessellationShaders { get; set; }        = false;
+        public bool HasTessellatorStage { get; set; }           = false;
+        public bool HasComputeShaders { get; set; }             = false;
+        public bool HasInstancing { get; set; }                 = false;
+        public bool HasOffsetInstancing { get; set; }           = false;
+        public bool HasIndirectDrawing { get; set; }            = false;
+        public bool HasViewportArrays { get; set; }             = false;
+        public bool HasConservativeRasterization { get; set; }  = false;
+        public bool HasStreamOutputs { get; set; }              = false;
+        public bool HasLogicOp { get; set; }                    = false;
+        public bool HasPipelineCaching { get; set; }            = false;
+        public bool HasPipelineStatistics { get; set; }         = false;
+        public bool HasRenderCondition { get; set; }            = false;
+        public bool HasTimestampQueries { get; set; }           = false;
+        public bool HasQueryResolve { get; set; }               = false;
+        public bool HasBindlessResourceHeaps { get; set; }      = false;
+        public bool HasIndirectCountDrawing { get; set; }       = false;
+        public bool HasMeshShaders { get; set; }                = false;
+        public bool HasTileShaders { get; set; }                = false;
+        public bool HasFramebufferFetch { get; set; }           = false;
+        public bool HasVariableRateShading { get; set; }        = false;
+        public bool HasIndirectStateChanges { get; set; }       = false;
+        public bool HasTransientBuffers { get; set; }           = false;
+        public bool HasPersistentMapping { get; set; }          = false;
+        public bool HasSparseTextures { get; set; }             = false;
+        public bool HasPlacementHeaps { get; set; }             = false;
+        public bool HasSharedResources { get; set; }            = false;
+        public bool HasConcurrentResourceCreation { get; set; } = false;
+        public bool HasRayTracing { get; set; }                 = false;
+        public bool HasRayQuery { get; set; }                   = false;
+        public bool HasMultiview { get; set; }                  = false;
+        public bool HasSamplerFeedback { get; set; }            = false;
 
         public RenderingFeatures() { }
 
@@ -1468,64 +1821,91 @@ namespace LLGL
         {
             set
             {
-                HasRenderTargets             = value.hasRenderTargets;
-                Has3DTextures                = value.has3DTextures;
-                HasCubeTextures              = value.hasCubeTextures;
-                HasArrayTextures             = value.hasArrayTextures;
-                HasCubeArrayTextures         = value.hasCubeArrayTextures;
-                HasMultiSampleTextures       = value.hasMultiSampleTextures;
-                HasMultiSampleArrayTextures  = value.hasMultiSampleArrayTextures;
-                HasTextureViews              = value.hasTextureViews;
-                HasTextureViewSwizzle        = value.hasTextureViewSwizzle;
-                HasTextureViewFormatSwizzle  = value.hasTextureViewFormatSwizzle;
-                HasBufferViews               = value.hasBufferViews;
-                HasConstantBuffers           = value.hasConstantBuffers;
-                HasStorageBuffers            = value.hasStorageBuffers;
-                HasGeometryShaders           = value.hasGeometryShaders;
-                HasTessellationShaders       = value.hasTessellationShaders;
-                HasTessellatorStage          = value.hasTessellatorStage;
-                HasComputeShaders            = value.hasComputeShaders;
-                HasInstancing                = value.hasInstancing;
-                HasOffsetInstancing          = value.hasOffsetInstancing;
-                HasIndirectDrawing           = value.hasIndirectDrawing;
-                HasViewportArrays            = value.hasViewportArrays;
-                HasConservativeRasterization = value.hasConservativeRasterization;
-                HasStreamOutputs             = value.hasStreamOutputs;
-                HasLogicOp                   = value.hasLogicOp;
-                HasPipelineCaching           = value.hasPipelineCaching;
-                HasPipelineStatistics        = value.hasPipelineStatistics;
-                HasRenderCondition           = value.hasRenderCondition;
+                HasRenderTargets              = value.hasRenderTargets;
+                Has3DTextures                 = value.has3DTextures;
+                HasCubeTextures               = value.hasCubeTextures;
+                HasArrayTextures              = value.hasArrayTextures;
+                HasCubeArrayTextures          = value.hasCubeArrayTextures;
+                HasMultiSampleTextures        = value.hasMultiSampleTextures;
+                HasMultiSampleArrayTextures   = value.hasMultiSampleArrayTextures;
+                HasTextureViews               = value.hasTextureViews;
+                HasTextureViewSwizzle         = value.hasTextureViewSwizzle;
+                HasTextureViewFormatSwizzle   = value.hasTextureViewFormatSwizzle;
+                HasBufferViews                = value.hasBufferViews;
+                HasConstantBuffers            = value.hasConstantBuffers;
+                HasStorageBuffers             = value.hasStorageBuffers;
+                HasGeometryShaders            = value.hasGeometryShaders;
+                HasTessellationShaders        = value.hasTessellationShaders;
+                HasTessellatorStage           = value.hasTessellatorStage;
+                HasComputeShaders             = value.hasComputeShaders;
+                HasInstancing                 = value.hasInstancing;
+                HasOffsetInstancing           = value.hasOffsetInstancing;
+                HasIndirectDrawing            = value.hasIndirectDrawing;
+                HasViewportArrays             = value.hasViewportArrays;
+                HasConservativeRasterization  = value.hasConservativeRasterization;
+                HasStreamOutputs              = value.hasStreamOutputs;
+                HasLogicOp                    = value.hasLogicOp;
+                HasPipelineCaching            = value.hasPipelineCaching;
+                HasPipelineStatistics         = value.hasPipelineStatistics;
+                HasRenderCondition            = value.hasRenderCondition;
+                HasTimestampQueries           = value.hasTimestampQueries;
+                HasQueryResolve               = value.hasQueryResolve;
+                HasBindlessResourceHeaps      = value.hasBindlessResourceHeaps;
+                HasIndirectCountDrawing       = value.hasIndirectCountDrawing;
+                HasMeshShaders                = value.hasMeshShaders;
+                HasTileShaders                = value.hasTileShaders;
+                HasFramebufferFetch           = value.hasFramebufferFetch;
+                HasVariableRateShading        = value.hasVariableRateShading;
+                HasIndirectStateChanges       = value.hasIndirectStateChanges;
+                HasTransientBuffers           = value.hasTransientBuffers;
+                HasPersistentMapping          = value.hasPersistentMapping;
+                HasSparseTextures             = value.hasSparseTextures;
+                HasPlacementHeaps             = value.hasPlacementHeaps;
+                HasSharedResources            = value.hasSharedResources;
+                HasConcurrentResourceCreation = value.hasConcurrentResourceCreation;
+                HasRayTracing                 = value.hasRayTracing;
+                HasRayQuery                   = value.hasRayQuery;
+                HasMultiview                  = value.hasMultiview;
+                HasSamplerFeedback            = value.hasSamplerFeedback;
             }
         }
     }
 
     public class RenderingLimits
     {
-        public float[] LineWidthRange { get; set; }                = new float[]{ 1.0f, 1.0f };
-        public int     MaxTextureArrayLayers { get; set; }         = 0;
-        public int     MaxColorAttachments { get; set; }           = 0;
-        public int     MaxPatchVertices { get; set; }              = 0;
-        public int     Max1DTextureSize { get; set; }              = 0;
-        public int     Max2DTextureSize { get; set; }              = 0;
-        public int     Max3DTextureSize { get; set; }              = 0;
-        public int     MaxCubeTextureSize { get; set; }            = 0;
-        public int     MaxAnisotropy { get; set; }                 = 0;
-        public int[]   MaxComputeShaderWorkGroups { get; set; }    = new int[]{ 0, 0, 0 };
-        public int[]   MaxComputeShaderWorkGroupSize { get; set; } = new int[]{ 0, 0, 0 };
-        public int     MaxViewports { get; set; }                  = 0;
-        public int[]   MaxViewportSize { get; set; }               = new int[]{ 0, 0 };
-        public long    MaxBufferSize { get; set; }                 = 0;
-        public long    MaxConstantBufferSize { get; set; }         = 0;
-        public int     MaxStreamOutputs { get; set; }              = 0;
-        public int     MaxTessFactor { get; set; }                 = 0;
-        public long    MinConstantBufferAlignment { get; set; }    = 0;
-        public long    MinSampledBufferAlignment { get; set; }     = 0;
-        public long    MinStorageBufferAlignment { get; set; }     = 0;
-        public int     MaxColorBufferSamples { get; set; }         = 0;
-        public int     MaxDepthBufferSamples { get; set; }         = 0;
-        public int     MaxStencilBufferSamples { get; set; }       = 0;
-        public int     MaxNoAttachmentSamples { get; set; }        = 0;
-        public int     StorageResourceStageFlags { get; set; }     = 0;
+        public float[]                LineWidthRange { get; set; }                   = new float[]{ 1.0f, 1.0f };
+        public int                    MaxTextureArrayLayers { get; set; }            = 0;
+        public int                    MaxColorAttachments { get; set; }              = 0;
+        public int                    MaxPatchVertices { get; set; }                 = 0;
+        public int                    Max1DTextureSize { get; set; }                 = 0;
+        public int                    Max2DTextureSize { get; set; }                 = 0;
+        public int                    Max3DTextureSize { get; set; }                 = 0;
+        public int                    MaxCubeTextureSize { get; set; }               = 0;
+        public int                    MaxAnisotropy { get; set; }                    = 0;
+        public int[]                  MaxComputeShaderWorkGroups { get; set; }       = new int[]{ 0, 0, 0 };
+        public int[]                  MaxComputeShaderWorkGroupSize { get; set; }    = new int[]{ 0, 0, 0 };
+        public int                    MaxComputeShaderSharedMemorySize { get; set; } = 0;
+        public int                    MaxViewports { get; set; }                     = 0;
+        public int[]                  MaxViewportSize { get; set; }                  = new int[]{ 0, 0 };
+        public long                   MaxBufferSize { get; set; }                    = 0;
+        public long                   MaxConstantBufferSize { get; set; }            = 0;
+        public int                    MaxStreamOutputs { get; set; }                 = 0;
+        public int                    MaxTessFactor { get; set; }                    = 0;
+        public long                   MinConstantBufferAlignment { get; set; }       = 0;
+        public long                   MinSampledBufferAlignment { get; set; }        = 0;
+        public long                   MinStorageBufferAlignment { get; set; }        = 0;
+        public int                    MaxColorBufferSamples { get; set; }            = 0;
+        public int                    MaxDepthBufferSamples { get; set; }            = 0;
+        public int                    MaxStencilBufferSamples { get; set; }          = 0;
+        public int                    MaxNoAttachmentSamples { get; set; }           = 0;
+        public int                    StorageResourceStageFlags { get; set; }        = 0;
+        public int                    MaxBindlessResourceViews { get; set; }         = 0;
+        public int                    SparseTileSize { get; set; }                   = 0;
+        public int                    ShadingRateImageTileSize { get; set; }         = 0;
+        public int[]                  SubgroupSizeRange { get; set; }                = new int[]{ 0, 0 };
+        public int                    SubgroupStageFlags { get; set; }               = 0;
+        public SubgroupOperationFlags SubgroupOperationFlags { get; set; }           = 0;
+        public int                    MaxMultiviewViewCount { get; set; }            = 0;
 
         public RenderingLimits() { }
 
@@ -1556,6 +1936,7 @@ namespace LLGL
                     MaxComputeShaderWorkGroupSize[0] = value.maxComputeShaderWorkGroupSize[0];
                     MaxComputeShaderWorkGroupSize[1] = value.maxComputeShaderWorkGroupSize[1];
                     MaxComputeShaderWorkGroupSize[2] = value.maxComputeShaderWorkGroupSize[2];
+                    MaxComputeShaderSharedMemorySize = value.maxComputeShaderSharedMemorySize;
                     MaxViewports                     = value.maxViewports;
                     MaxViewportSize[0]               = value.maxViewportSize[0];
                     MaxViewportSize[1]               = value.maxViewportSize[1];
@@ -1571,6 +1952,14 @@ namespace LLGL
                     MaxStencilBufferSamples          = value.maxStencilBufferSamples;
                     MaxNoAttachmentSamples           = value.maxNoAttachmentSamples;
                     StorageResourceStageFlags        = value.storageResourceStageFlags;
+                    MaxBindlessResourceViews         = value.maxBindlessResourceViews;
+                    SparseTileSize                   = value.sparseTileSize;
+                    ShadingRateImageTileSize         = value.shadingRateImageTileSize;
+                    SubgroupSizeRange[0]             = value.subgroupSizeRange[0];
+                    SubgroupSizeRange[1]             = value.subgroupSizeRange[1];
+                    SubgroupStageFlags               = value.subgroupStageFlags;
+                    SubgroupOperationFlags           = (SubgroupOperationFlags)value.subgroupOperationFlags;
+                    MaxMultiviewViewCount            = value.maxMultiviewViewCount;
                 }
             }
         }
@@ -1578,11 +1967,12 @@ namespace LLGL
 
     public class ResourceHeapDescriptor
     {
-        public AnsiString     DebugName { get; set; }        = null;
-        public PipelineLayout PipelineLayout { get; set; }   = null;
-        public int            NumResourceViews { get; set; } = 0;
+        public AnsiString        DebugName { get; set; }        = null;
+        public PipelineLayout    PipelineLayout { get; set; }   = null;
+        public int               NumResourceViews { get; set; } = 0;
+        public ResourceHeapFlags Flags { get; set; }            = 0;
         [Obsolete("ResourceHeapDescriptor.barrierFlags is deprecated since 0.04b; Use PipelineLayoutDescriptor.barrierFlags instead!")]
-        public BarrierFlags   BarrierFlags { get; set; }     = 0;
+        public BarrierFlags      BarrierFlags { get; set; }     = 0;
 
         internal NativeLLGL.ResourceHeapDescriptor Native
         {
@@ -1600,6 +1990,7 @@ namespace LLGL
                         native.pipelineLayout = PipelineLayout.Native;
                     }
                     native.numResourceViews = NumResourceViews;
+                    native.flags            = (int)Flags;
                 }
                 return native;
             }
@@ -1679,6 +2070,40 @@ namespace LLGL
         }
     }
 
+    public class CommandBufferDescriptor
+    {
+        public AnsiString         DebugName { get; set; }          = null;
+        public CommandBufferFlags Flags { get; set; }              = 0;
+        public int                NumNativeBuffers { get; set; }   = 0;
+        public long               MinStagingPoolSize { get; set; } = (0xFFFF+1);
+        public RenderPass         RenderPass { get; set; }         = null;
+        public CommandQueueType   QueueType { get; set; }          = CommandQueueType.Graphics;
+
+        internal NativeLLGL.CommandBufferDescriptor Native
+        {
+            get
+            {
+                var native = new NativeLLGL.CommandBufferDescriptor();
+                unsafe
+                {
+                    fixed (byte* debugNamePtr = DebugName.Ascii)
+                    {
+                        native.debugName = debugNamePtr;
+                    }
+                    native.flags              = (int)Flags;
+                    native.numNativeBuffers   = NumNativeBuffers;
+                    native.minStagingPoolSize = MinStagingPoolSize;
+                    if (RenderPass != null)
+                    {
+                        native.renderPass = RenderPass.Native;
+                    }
+                    native.queueType          = QueueType;
+                }
+                return native;
+            }
+        }
+    }
+
     public class DisplayMode
     {
         public Extent2D Resolution { get; set; }  = new Extent2D();
@@ -2043,6 +2468,48 @@ namespace LLGL
         }
     }
 
+    public class ComputePipelineDescriptor
+    {
+        public AnsiString               DebugName { get; set; }               = null;
+        public int                      Flags { get; set; }                   = 0;
+        public PipelineLayout           PipelineLayout { get; set; }          = null;
+        public Shader                   ComputeShader { get; set; }           = null;
+        public SpecializationConstant[] SpecializationConstants { get; set; }
+
+        internal NativeLLGL.ComputePipelineDescriptor Native
+        {
+            get
+            {
+                var native = new NativeLLGL.ComputePipelineDescriptor();
+                unsafe
+                {
+                    fixed (byte* debugNamePtr = DebugName.Ascii)
+                    {
+                        native.debugName = debugNamePtr;
+                    }
+                    native.flags                   = Flags;
+                    if (PipelineLayout != null)
+                    {
+                        native.pipelineLayout = PipelineLayout.Native;
+                    }
+                    if (ComputeShader != null)
+                    {
+                        native.computeShader = ComputeShader.Native;
+                    }
+                    if (SpecializationConstants != null)
+                    {
+                        native.numSpecializationConstants = (IntPtr)SpecializationConstants.Length;
+                        fixed (SpecializationConstant* specializationConstantsPtr = SpecializationConstants)
+                        {
+                            native.specializationConstants = specializationConstantsPtr;
+                        }
+                    }
+                }
+                return native;
+            }
+        }
+    }
+
     public class QueryHeapDescriptor
     {
         public AnsiString DebugName { get; set; }       = null;
@@ -2070,60 +2537,89 @@ namespace LLGL
         }
     }
 
-    public class FrameProfile
+    public class ProfileStatisticsRecord
     {
-        public ProfileCommandQueueRecord  CommandQueueRecord { get; set; }  = new ProfileCommandQueueRecord();
-        public ProfileCommandBufferRecord CommandBufferRecord { get; set; } = new ProfileCommandBufferRecord();
-        private ProfileTimeRecord[] timeRecords;
-        private NativeLLGL.ProfileTimeRecord[] timeRecordsNative;
-        public ProfileTimeRecord[] TimeRecords
+        public AnsiString              Annotation { get; set; }
+        public long                    Frame { get; set; }      = 0;
+        public QueryPipelineStatistics Statistics { get; set; } = new QueryPipelineStatistics();
+
+        public ProfileStatisticsRecord() { }
+
+        internal ProfileStatisticsRecord(NativeLLGL.ProfileStatisticsRecord native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.ProfileStatisticsRecord Native
         {
             get
             {
-                return timeRecords;
-            }
-            set
-            {
-                if (value != null)
+                var native = new NativeLLGL.ProfileStatisticsRecord();
+                unsafe
                 {
-                    timeRecords = value;
-                    timeRecordsNative = new NativeLLGL.ProfileTimeRecord[timeRecords.Length];
-                    for (int timeRecordsIndex = 0; timeRecordsIndex < timeRecords.Length; ++timeRecordsIndex)
+                    fixed (byte* annotationPtr = Annotation.Ascii)
                     {
-                        if (timeRecords[timeRecordsIndex] != null)
-                        {
-                            timeRecordsNative[timeRecordsIndex] = timeRecords[timeRecordsIndex].Native;
-                        }
+                        native.annotation = annotationPtr;
                     }
+                    native.frame      = Frame;
+                    native.statistics = Statistics;
                 }
-                else
+                return native;
+            }
+            set
+            {
+                unsafe
                 {
-                    timeRecords = null;
-                    timeRecordsNative = null;
+                    Annotation = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    Frame      = value.frame;
+                    Statistics = value.statistics;
                 }
             }
         }
+    }
 
-        public FrameProfile() { }
+    public class ProfileEventRecord
+    {
+        public ProfileEventType Type { get; set; }          = ProfileEventType.Encoding;
+        public AnsiString       Annotation { get; set; }
+        public int              Thread { get; set; }        = 0;
+        public long             CPUTicksStart { get; set; } = 0;
+        public long             CPUTicksEnd { get; set; }   = 0;
 
-        internal FrameProfile(NativeLLGL.FrameProfile native)
+        public ProfileEventRecord() { }
+
+        internal ProfileEventRecord(NativeLLGL.ProfileEventRecord native)
         {
             Native = native;
         }
 
-        internal NativeLLGL.FrameProfile Native
+        internal NativeLLGL.ProfileEventRecord Native
         {
-            set
+            get
             {
+                var native = new NativeLLGL.ProfileEventRecord();
                 unsafe
                 {
-                    CommandQueueRecord.Native= value.commandQueueRecord;
-                    CommandBufferRecord.Native= value.commandBufferRecord;
-                    TimeRecords         = new ProfileTimeRecord[(int)value.numTimeRecords];
-                    for (int i = 0; i < TimeRecords.Length; ++i)
+                    native.type          = Type;
+                    fixed (byte* annotationPtr = Annotation.Ascii)
                     {
-                        TimeRecords[i] = new ProfileTimeRecord(value.timeRecords[i]);
+                        native.annotation = annotationPtr;
                     }
+                    native.thread        = Thread;
+                    native.cpuTicksStart = CPUTicksStart;
+                    native.cpuTicksEnd   = CPUTicksEnd;
+                }
+                return native;
+            }
+            set
+            {
+                unsafe
+                {
+                    Type          = value.type;
+                    Annotation    = Marshal.PtrToStringAnsi((IntPtr)value.annotation);
+                    Thread        = value.thread;
+                    CPUTicksStart = value.cpuTicksStart;
+                    CPUTicksEnd   = value.cpuTicksEnd;
                 }
             }
         }
@@ -2331,28 +2827,42 @@ namespace LLGL
     {
         public SwapChainDescriptor() { }
 
-        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, bool fullscreen = false, bool resizable = false)
-        {
-            DebugName   = debugName;
-            Resolution  = resolution;
-            ColorBits   = colorBits;
-            DepthBits   = depthBits;
-            StencilBits = stencilBits;
-            Samples     = samples;
-            SwapBuffers = swapBuffers;
-            Fullscreen  = fullscreen;
-            Resizable   = resizable;
-        }
-
-        public AnsiString DebugName { get; set; }   = null;
-        public Extent2D   Resolution { get; set; }  = new Extent2D();
-        public int        ColorBits { get; set; }   = 32;
-        public int        DepthBits { get; set; }   = 24;
-        public int        StencilBits { get; set; } = 8;
-        public int        Samples { get; set; }     = 1;
-        public int        SwapBuffers { get; set; } = 2;
-        public bool       Fullscreen { get; set; }  = false;
-        public bool       Resizable { get; set; }   = false;
+        public SwapChainDescriptor(string debugName = null, Extent2D resolution = new Extent2D(), int colorBits = 32, int depthBits = 24, int stencilBits = 8, int samples = 1, int swapBuffers = 2, int maxFramesInFlight = 0, int frameStatisticsWindow = 0, PresentMode presentMode = PresentMode.Default, ColorSpace colorSpace = ColorSpace.SRGB, bool fullscreen = false, bool resizable = false, bool lateImageAcquire = false, bool preTransform = false, bool framePacing = false)
+        {
+            DebugName             = debugName;
+            Resolution            = resolution;
+            ColorBits             = colorBits;
+            DepthBits             = depthBits;
+            StencilBits           = stencilBits;
+            Samples               = samples;
+            SwapBuffers           = swapBuffers;
+            MaxFramesInFlight     = maxFramesInFlight;
+            FrameStatisticsWindow = frameStatisticsWindow;
+            PresentMode           = presentMode;
+            ColorSpace            = colorSpace;
+            Fullscreen            = fullscreen;
+            Resizable             = resizable;
+            LateImageAcquire      = lateImageAcquire;
+            PreTransform          = preTransform;
+            FramePacing           = framePacing;
+        }
+
+        public AnsiString  DebugName { get; set; }             = null;
+        public Extent2D    Resolution { get; set; }            = new Extent2D();
+        public int         ColorBits { get; set; }             = 32;
+        public int         DepthBits { get; set; }             = 24;
+        public int         StencilBits { get; set; }           = 8;
+        public int         Samples { get; set; }               = 1;
+        public int         SwapBuffers { get; set; }           = 2;
+        public int         MaxFramesInFlight { get; set; }     = 0;
+        public int         FrameStatisticsWindow { get; set; } = 0;
+        public PresentMode PresentMode { get; set; }           = PresentMode.Default;
+        public ColorSpace  ColorSpace { get; set; }            = ColorSpace.SRGB;
+        public bool        Fullscreen { get; set; }            = false;
+        public bool        Resizable { get; set; }             = false;
+        public bool        LateImageAcquire { get; set; }      = false;
+        public bool        PreTransform { get; set; }          = false;
+        public bool        FramePacing { get; set; }           = false;
 
         internal NativeLLGL.SwapChainDescriptor Native
         {
@@ -2365,14 +2875,21 @@ namespace LLGL
                     {
                         native.debugName = debugNamePtr;
                     }
-                    native.resolution  = Resolution;
-                    native.colorBits   = ColorBits;
-                    native.depthBits   = DepthBits;
-                    native.stencilBits = StencilBits;
-                    native.samples     = Samples;
-                    native.swapBuffers = SwapBuffers;
-                    native.fullscreen  = Fullscreen;
-                    native.resizable   = Resizable;
+                    native.resolution            = Resolution;
+                    native.colorBits             = ColorBits;
+                    native.depthBits             = DepthBits;
+                    native.stencilBits           = StencilBits;
+                    native.samples               = Samples;
+                    native.swapBuffers           = SwapBuffers;
+                    native.maxFramesInFlight     = MaxFramesInFlight;
+                    native.frameStatisticsWindow = FrameStatisticsWindow;
+                    native.presentMode           = PresentMode;
+                    native.colorSpace            = ColorSpace;
+                    native.fullscreen            = Fullscreen;
+                    native.resizable             = Resizable;
+                    native.lateImageAcquire      = LateImageAcquire;
+                    native.preTransform          = PreTransform;
+                    native.framePacing           = FramePacing;
                 }
                 return native;
             }
@@ -2681,9 +3198,174 @@ namespace LLGL
                 }
                 if (Back != null)
                 {
-                    native.back = Back.Native;
+                    native.back = Back.Native;
+                }
+                return native;
+            }
+        }
+    }
+
+    public class FrameProfile
+    {
+        public ProfileCommandQueueRecord  CommandQueueRecord { get; set; }  = new ProfileCommandQueueRecord();
+        public ProfileCommandBufferRecord CommandBufferRecord { get; set; } = new ProfileCommandBufferRecord();
+        public ProfileBackendRecord       BackendRecord { get; set; }       = new ProfileBackendRecord();
+        private ProfileTimeRecord[] timeRecords;
+        private NativeLLGL.ProfileTimeRecord[] timeRecordsNative;
+        public ProfileTimeRecord[] TimeRecords
+        {
+            get
+            {
+                return timeRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    timeRecords = value;
+                    timeRecordsNative = new NativeLLGL.ProfileTimeRecord[timeRecords.Length];
+                    for (int timeRecordsIndex = 0; timeRecordsIndex < timeRecords.Length; ++timeRecordsIndex)
+                    {
+                        if (timeRecords[timeRecordsIndex] != null)
+                        {
+                            timeRecordsNative[timeRecordsIndex] = timeRecords[timeRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    timeRecords = null;
+                    timeRecordsNative = null;
+                }
+            }
+        }
+        private ProfileScopeRecord[] scopeRecords;
+        private NativeLLGL.ProfileScopeRecord[] scopeRecordsNative;
+        public ProfileScopeRecord[] ScopeRecords
+        {
+            get
+            {
+                return scopeRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    scopeRecords = value;
+                    scopeRecordsNative = new NativeLLGL.ProfileScopeRecord[scopeRecords.Length];
+                    for (int scopeRecordsIndex = 0; scopeRecordsIndex < scopeRecords.Length; ++scopeRecordsIndex)
+                    {
+                        if (scopeRecords[scopeRecordsIndex] != null)
+                        {
+                            scopeRecordsNative[scopeRecordsIndex] = scopeRecords[scopeRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    scopeRecords = null;
+                    scopeRecordsNative = null;
+                }
+            }
+        }
+        private ProfileEventRecord[] eventRecords;
+        private NativeLLGL.ProfileEventRecord[] eventRecordsNative;
+        public ProfileEventRecord[] EventRecords
+        {
+            get
+            {
+                return eventRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    eventRecords = value;
+                    eventRecordsNative = new NativeLLGL.ProfileEventRecord[eventRecords.Length];
+                    for (int eventRecordsIndex = 0; eventRecordsIndex < eventRecords.Length; ++eventRecordsIndex)
+                    {
+                        if (eventRecords[eventRecordsIndex] != null)
+                        {
+                            eventRecordsNative[eventRecordsIndex] = eventRecords[eventRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    eventRecords = null;
+                    eventRecordsNative = null;
+                }
+            }
+        }
+        private ProfileStatisticsRecord[] statisticsRecords;
+        private NativeLLGL.ProfileStatisticsRecord[] statisticsRecordsNative;
+        public ProfileStatisticsRecord[] StatisticsRecords
+        {
+            get
+            {
+                return statisticsRecords;
+            }
+            set
+            {
+                if (value != null)
+                {
+                    statisticsRecords = value;
+                    statisticsRecordsNative = new NativeLLGL.ProfileStatisticsRecord[statisticsRecords.Length];
+                    for (int statisticsRecordsIndex = 0; statisticsRecordsIndex < statisticsRecords.Length; ++statisticsRecordsIndex)
+                    {
+                        if (statisticsRecords[statisticsRecordsIndex] != null)
+                        {
+                            statisticsRecordsNative[statisticsRecordsIndex] = statisticsRecords[statisticsRecordsIndex].Native;
+                        }
+                    }
+                }
+                else
+                {
+                    statisticsRecords = null;
+                    statisticsRecordsNative = null;
+                }
+            }
+        }
+        public QueryPipelineStatistics    PipelineStatistics { get; set; }  = new QueryPipelineStatistics();
+
+        public FrameProfile() { }
+
+        internal FrameProfile(NativeLLGL.FrameProfile native)
+        {
+            Native = native;
+        }
+
+        internal NativeLLGL.FrameProfile Native
+        {
+            set
+            {
+                unsafe
+                {
+                    CommandQueueRecord.Native= value.commandQueueRecord;
+                    CommandBufferRecord.Native= value.commandBufferRecord;
+                    BackendRecord.Native= value.backendRecord;
+                    TimeRecords         = new ProfileTimeRecord[(int)value.numTimeRecords];
+                    for (int i = 0; i < TimeRecords.Length; ++i)
+                    {
+                        TimeRecords[i] = new ProfileTimeRecord(value.timeRecords[i]);
+                    }
+                    ScopeRecords        = new ProfileScopeRecord[(int)value.numScopeRecords];
+                    for (int i = 0; i < ScopeRecords.Length; ++i)
+                    {
+                        ScopeRecords[i] = new ProfileScopeRecord(value.scopeRecords[i]);
+                    }
+                    EventRecords        = new ProfileEventRecord[(int)value.numEventRecords];
+                    for (int i = 0; i < EventRecords.Length; ++i)
+                    {
+                        EventRecords[i] = new ProfileEventRecord(value.eventRecords[i]);
+                    }
+                    StatisticsRecords   = new ProfileStatisticsRecord[(int)value.numStatisticsRecords];
+                    for (int i = 0; i < StatisticsRecords.Length; ++i)
+                    {
+                        StatisticsRecords[i] = new ProfileStatisticsRecord(value.statisticsRecords[i]);
+                    }
+                    PipelineStatistics  = value.pipelineStatistics;
                 }
-                return native;
             }
         }
     }
@@ -3088,6 +3770,7 @@ namespace LLGL
             }
         }
         public BarrierFlags                       BarrierFlags { get; set; }            = 0;
+        public PipelineLayoutFlags                Flags { get; set; }                   = 0;
 
         internal NativeLLGL.PipelineLayoutDescriptor Native
         {
@@ -3141,6 +3824,7 @@ namespace LLGL
                         }
                     }
                     native.barrierFlags            = (int)BarrierFlags;
+                    native.flags                   = (int)Flags;
                 }
                 return native;
             }
@@ -3149,23 +3833,29 @@ namespace LLGL
 
     public class GraphicsPipelineDescriptor
     {
-        public AnsiString             DebugName { get; set; }            = null;
-        public PipelineLayout         PipelineLayout { get; set; }       = null;
-        public RenderPass             RenderPass { get; set; }           = null;
-        public Shader                 VertexShader { get; set; }         = null;
-        public Shader                 TessControlShader { get; set; }    = null;
-        public Shader                 TessEvaluationShader { get; set; } = null;
-        public Shader                 GeometryShader { get; set; }       = null;
-        public Shader                 FragmentShader { get; set; }       = null;
-        public Format                 IndexFormat { get; set; }          = Format.Undefined;
-        public PrimitiveTopology      PrimitiveTopology { get; set; }    = PrimitiveTopology.TriangleList;
-        public Viewport[]             Viewports { get; set; }
-        public Scissor[]              Scissors { get; set; }
-        public DepthDescriptor        Depth { get; set; }                = new DepthDescriptor();
-        public StencilDescriptor      Stencil { get; set; }              = new StencilDescriptor();
-        public RasterizerDescriptor   Rasterizer { get; set; }           = new RasterizerDescriptor();
-        public BlendDescriptor        Blend { get; set; }                = new BlendDescriptor();
-        public TessellationDescriptor Tessellation { get; set; }         = new TessellationDescriptor();
+        public AnsiString               DebugName { get; set; }               = null;
+        public int                      Flags { get; set; }                   = 0;
+        public PipelineLayout           PipelineLayout { get; set; }          = null;
+        public RenderPass               RenderPass { get; set; }              = null;
+        public int                      ViewMask { get; set; }                = 0;
+        public Shader                   VertexShader { get; set; }            = null;
+        public Shader                   TessControlShader { get; set; }       = null;
+        public Shader                   TessEvaluationShader { get; set; }    = null;
+        public Shader                   GeometryShader { get; set; }          = null;
+        public Shader                   TaskShader { get; set; }              = null;
+        public Shader                   MeshShader { get; set; }              = null;
+        public Shader                   TileShader { get; set; }              = null;
+        public Shader                   FragmentShader { get; set; }          = null;
+        public Format                   IndexFormat { get; set; }             = Format.Undefined;
+        public PrimitiveTopology        PrimitiveTopology { get; set; }       = PrimitiveTopology.TriangleList;
+        public Viewport[]               Viewports { get; set; }
+        public Scissor[]                Scissors { get; set; }
+        public DepthDescriptor          Depth { get; set; }                   = new DepthDescriptor();
+        public StencilDescriptor        Stencil { get; set; }                 = new StencilDescriptor();
+        public RasterizerDescriptor     Rasterizer { get; set; }              = new RasterizerDescriptor();
+        public BlendDescriptor          Blend { get; set; }                   = new BlendDescriptor();
+        public TessellationDescriptor   Tessellation { get; set; }            = new TessellationDescriptor();
+        public SpecializationConstant[] SpecializationConstants { get; set; }
 
         internal NativeLLGL.GraphicsPipelineDescriptor Native
         {
@@ -3178,6 +3868,7 @@ namespace LLGL
                     {
                         native.debugName = debugNamePtr;
                     }
+                    native.flags                   = Flags;
                     if (PipelineLayout != null)
                     {
                         native.pipelineLayout = PipelineLayout.Native;
@@ -3186,6 +3877,7 @@ namespace LLGL
                     {
                         native.renderPass = RenderPass.Native;
                     }
+                    native.viewMask                = ViewMask;
                     if (VertexShader != null)
                     {
                         native.vertexShader = VertexShader.Native;
@@ -3202,12 +3894,24 @@ namespace LLGL
                     {
                         native.geometryShader = GeometryShader.Native;
                     }
+                    if (TaskShader != null)
+                    {
+                        native.taskShader = TaskShader.Native;
+                    }
+                    if (MeshShader != null)
+                    {
+                        native.meshShader = MeshShader.Native;
+                    }
+                    if (TileShader != null)
+                    {
+                        native.tileShader = TileShader.Native;
+                    }
                     if (FragmentShader != null)
                     {
                         native.fragmentShader = FragmentShader.Native;
                     }
-                    native.indexFormat          = IndexFormat;
-                    native.primitiveTopology    = PrimitiveTopology;
+                    native.indexFormat             = IndexFormat;
+                    native.primitiveTopology       = PrimitiveTopology;
                     if (Viewports != null)
                     {
                         native.numViewports = (IntPtr)Viewports.Length;
@@ -3244,6 +3948,14 @@ namespace LLGL
                     {
                         native.tessellation = Tessellation.Native;
                     }
+                    if (SpecializationConstants != null)
+                    {
+                        native.numSpecializationConstants = (IntPtr)SpecializationConstants.Length;
+                        fixed (SpecializationConstant* specializationConstantsPtr = SpecializationConstants)
+                        {
+                            native.specializationConstants = specializationConstantsPtr;
+                        }
+                    }
                 }
                 return native;
             }
@@ -3460,6 +4172,11 @@ namespace LLGL
             internal unsafe void* ptr;
         }
 
+        public unsafe struct PlacementHeap
+        {
+            internal unsafe void* ptr;
+        }
+
         public unsafe struct QueryHeap
         {
             internal unsafe void* ptr;
@@ -3617,6 +4334,29 @@ namespace LLGL
 
         /* ----- Native structures ----- */
 
+        public unsafe struct AccelerationStructureInstance
+        {
+            public Buffer      accelerationStructure; /* = null */
+            public fixed float transform[12];         /* = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f } */
+            public int         instanceID;            /* = 0 */
+            public int         mask;                  /* = 0xFF */
+            public int         hitGroupOffset;        /* = 0 */
+        }
+
+        public unsafe struct AccelerationStructureSizes
+        {
+            public long accelerationStructureSize; /* = 0 */
+            public long buildScratchSize;          /* = 0 */
+            public long updateScratchSize;         /* = 0 */
+        }
+
+        public unsafe struct BufferCopyRegion
+        {
+            public long dstOffset; /* = 0 */
+            public long srcOffset; /* = 0 */
+            public long size;      /* = 0 */
+        }
+
         public unsafe struct CanvasDescriptor
         {
             public byte* title;
@@ -3630,13 +4370,12 @@ namespace LLGL
             public int         stencil;  /* = 0 */
         }
 
-        public unsafe struct CommandBufferDescriptor
+        public unsafe struct TransientBufferAllocation
         {
-            public byte*      debugName;          /* = null */
-            public int        flags;              /* = 0 */
-            public int        numNativeBuffers;   /* = 0 */
-            public long       minStagingPoolSize; /* = (0xFFFF+1) */
-            public RenderPass renderPass;         /* = null */
+            public Buffer buffer; /* = null */
+            public long   offset; /* = 0 */
+            public long   size;   /* = 0 */
+            public void*  data;   /* = null */
         }
 
         public unsafe struct DispatchIndirectArguments
@@ -3644,6 +4383,11 @@ namespace LLGL
             public fixed int numThreadGroups[3];
         }
 
+        public unsafe struct DrawMeshTasksIndirectArguments
+        {
+            public fixed int numWorkGroups[3];
+        }
+
         public unsafe struct ColorCodes
         {
             public int textFlags;       /* = 0 */
@@ -3657,11 +4401,22 @@ namespace LLGL
             public float clamp;          /* = 0.0f */
         }
 
-        public unsafe struct ComputePipelineDescriptor
+        public unsafe struct RayTracingHitGroupDescriptor
+        {
+            public Shader closestHitShader; /* = null */
+            public Shader anyHitShader;     /* = null */
+        }
+
+        public unsafe struct PlacementHeapDescriptor
+        {
+            public byte* debugName; /* = null */
+            public long  size;      /* = 0 */
+        }
+
+        public unsafe struct MemoryRequirements
         {
-            public byte*          debugName;      /* = null */
-            public PipelineLayout pipelineLayout; /* = null */
-            public Shader         computeShader;  /* = null */
+            public long size;      /* = 0 */
+            public long alignment; /* = 0 */
         }
 
         public unsafe struct ProfileTimeRecord
@@ -3672,6 +4427,19 @@ namespace LLGL
             public long  elapsedTime;   /* = 0 */
         }
 
+        public unsafe struct ProfileScopeRecord
+        {
+            public byte* annotation;
+            public int   parent;        /* = -1 */
+            public int   depth;         /* = 0 */
+            public long  frame;         /* = 0 */
+            public long  cpuTicksStart; /* = 0 */
+            public long  cpuTicksEnd;   /* = 0 */
+            public long  gpuTicksStart; /* = 0 */
+            public long  gpuTicksEnd;   /* = 0 */
+            public long  elapsedTime;   /* = 0 */
+        }
+
         public unsafe struct ProfileCommandQueueRecord
         {
             public int bufferWrites;             /* = 0 */
@@ -3711,6 +4479,15 @@ namespace LLGL
             public int dispatchCommands;         /* = 0 */
         }
 
+        public unsafe struct ProfileBackendRecord
+        {
+            public int  redundantStateChanges;    /* = 0 */
+            public int  descriptorCopies;         /* = 0 */
+            public int  descriptorSetAllocations; /* = 0 */
+            public int  barriers;                 /* = 0 */
+            public long stagingUploadBytes;       /* = 0 */
+        }
+
         public unsafe struct RendererInfo
         {
             public byte*  rendererName;
@@ -3723,68 +4500,113 @@ namespace LLGL
             public byte*  pipelineCacheID;
         }
 
+        public unsafe struct AllocatorDescriptor
+        {
+            public IntPtr allocate; /* = null */
+            public IntPtr free;     /* = null */
+            public void*  userData; /* = null */
+        }
+
         public unsafe struct RenderingFeatures
         {
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasRenderTargets;             /* = false */
+            public bool hasRenderTargets;              /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool has3DTextures;                /* = false */
+            public bool has3DTextures;                 /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasCubeTextures;              /* = false */
+            public bool hasCubeTextures;               /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasArrayTextures;             /* = false */
+            public bool hasArrayTextures;              /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasCubeArrayTextures;         /* = false */
+            public bool hasCubeArrayTextures;          /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasMultiSampleTextures;       /* = false */
+            public bool hasMultiSampleTextures;        /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasMultiSampleArrayTextures;  /* = false */
+            public bool hasMultiSampleArrayTextures;   /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasTextureViews;              /* = false */
+            public bool hasTextureViews;               /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasTextureViewSwizzle;        /* = false */
+            public bool hasTextureViewSwizzle;         /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasTextureViewFormatSwizzle;  /* = false */
+            public bool hasTextureViewFormatSwizzle;   /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasBufferViews;               /* = false */
+            public bool hasBufferViews;                /* = false */
             [Obsolete("LLGL.RenderingFeatures.hasSamplers is deprecated since 0.04b; All backends must support sampler states either natively or emulated.")]
             [MarshalAs(UnmanagedType.I1)]
             public bool hasSamplers;
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasConstantBuffers;           /* = false */
+            public bool hasConstantBuffers;            /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasStorageBuffers;            /* = false */
+            public bool hasStorageBuffers;             /* = false */
             [Obsolete("LLGL.RenderingFeatures.hasUniforms is deprecated since 0.04b; All backends must support uniforms either natively or emulated.")]
             [MarshalAs(UnmanagedType.I1)]
             public bool hasUniforms;
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasGeometryShaders;           /* = false */
+            public bool hasGeometryShaders;            /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasTessellationShaders;        /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasTessellatorStage;           /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasComputeShaders;             /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasInstancing;                 /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasOffsetInstancing;           /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasIndirectDrawing;            /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasViewportArrays;             /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasConservativeRasterization;  /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasStreamOutputs;              /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasLogicOp;                    /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasPipelineCaching;            /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasTessellationShaders;       /* = false */
+            public bool hasPipelineStatistics;         /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasTessellatorStage;          /* = false */
+            public bool hasRenderCondition;            /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasComputeShaders;            /* = false */
+            public bool hasTimestampQueries;           /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasInstancing;                /* = false */
+            public bool hasQueryResolve;               /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasOffsetInstancing;          /* = false */
+            public bool hasBindlessResourceHeaps;      /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasIndirectDrawing;           /* = false */
+            public bool hasIndirectCountDrawing;       /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasViewportArrays;            /* = false */
+            public bool hasMeshShaders;                /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasConservativeRasterization; /* = false */
+            public bool hasTileShaders;                /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasStreamOutputs;             /* = false */
+            public bool hasFramebufferFetch;           /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasLogicOp;                   /* = false */
+            public bool hasVariableRateShading;        /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasPipelineCaching;           /* = false */
+            public bool hasIndirectStateChanges;       /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasPipelineStatistics;        /* = false */
+            public bool hasTransientBuffers;           /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool hasRenderCondition;           /* = false */
+            public bool hasPersistentMapping;          /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasSparseTextures;             /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasPlacementHeaps;             /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasSharedResources;            /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasConcurrentResourceCreation; /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasRayTracing;                 /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasRayQuery;                   /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasMultiview;                  /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool hasSamplerFeedback;            /* = false */
         }
 
         public unsafe struct RenderingLimits
@@ -3800,6 +4622,7 @@ namespace LLGL
             public int         maxAnisotropy;                    /* = 0 */
             public fixed int   maxComputeShaderWorkGroups[3];    /* = { 0, 0, 0 } */
             public fixed int   maxComputeShaderWorkGroupSize[3]; /* = { 0, 0, 0 } */
+            public int         maxComputeShaderSharedMemorySize; /* = 0 */
             public int         maxViewports;                     /* = 0 */
             public fixed int   maxViewportSize[2];               /* = { 0, 0 } */
             public long        maxBufferSize;                    /* = 0 */
@@ -3814,6 +4637,34 @@ namespace LLGL
             public int         maxStencilBufferSamples;          /* = 0 */
             public int         maxNoAttachmentSamples;           /* = 0 */
             public int         storageResourceStageFlags;        /* = 0 */
+            public int         maxBindlessResourceViews;         /* = 0 */
+            public int         sparseTileSize;                   /* = 0 */
+            public int         shadingRateImageTileSize;         /* = 0 */
+            public fixed int   subgroupSizeRange[2];             /* = { 0, 0 } */
+            public int         subgroupStageFlags;               /* = 0 */
+            public int         subgroupOperationFlags;           /* = 0 */
+            public int         maxMultiviewViewCount;            /* = 0 */
+        }
+
+        public unsafe struct MemoryHeapInfo
+        {
+            public int  flags;  /* = 0 */
+            public long size;   /* = 0 */
+            public long usage;  /* = 0 */
+            public long budget; /* = 0 */
+        }
+
+        public unsafe struct AdapterInfo
+        {
+            public byte*      name;
+            public int        vendorID;     /* = 0 */
+            public int        deviceID;     /* = 0 */
+            public long       videoMemory;  /* = 0 */
+            public long       sharedMemory; /* = 0 */
+            public long       luid;         /* = 0 */
+            public fixed byte uuid[16];     /* = {  } */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool       isActive;     /* = false */
         }
 
         public unsafe struct ResourceHeapDescriptor
@@ -3821,6 +4672,7 @@ namespace LLGL
             public byte*          debugName;        /* = null */
             public PipelineLayout pipelineLayout;   /* = null */
             public int            numResourceViews; /* = 0 */
+            public int            flags;            /* = 0 */
             [Obsolete("ResourceHeapDescriptor.barrierFlags is deprecated since 0.04b; Use PipelineLayoutDescriptor.barrierFlags instead!")]
             public int            barrierFlags;
         }
@@ -3831,6 +4683,15 @@ namespace LLGL
             public byte* definition; /* = null */
         }
 
+        public unsafe struct FrameTimeStatistics
+        {
+            public float last;    /* = 0.0f */
+            public float average; /* = 0.0f */
+            public float p50;     /* = 0.0f */
+            public float p95;     /* = 0.0f */
+            public float p99;     /* = 0.0f */
+        }
+
         public unsafe struct CanvasEventListener
         {
             public IntPtr onProcessEvents;
@@ -3868,6 +4729,21 @@ namespace LLGL
             public long   size;   /* = -1 */
         }
 
+        public unsafe struct AccelerationStructureGeometryDescriptor
+        {
+            public Buffer vertexBuffer; /* = null */
+            public long   vertexOffset; /* = 0 */
+            public int    vertexStride; /* = 12 */
+            public int    numVertices;  /* = 0 */
+            public Format vertexFormat; /* = Format.RGB32Float */
+            public Format indexFormat;  /* = Format.R32UInt */
+            public Buffer indexBuffer;  /* = null */
+            public long   indexOffset;  /* = 0 */
+            public int    numIndices;   /* = 0 */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool   opaque;       /* = true */
+        }
+
         public unsafe struct AttachmentClear
         {
             public int        flags;           /* = 0 */
@@ -3875,6 +4751,34 @@ namespace LLGL
             public ClearValue clearValue;
         }
 
+        public unsafe struct CommandBufferDescriptor
+        {
+            public byte*            debugName;          /* = null */
+            public int              flags;              /* = 0 */
+            public int              numNativeBuffers;   /* = 0 */
+            public long             minStagingPoolSize; /* = (0xFFFF+1) */
+            public RenderPass       renderPass;         /* = null */
+            public CommandQueueType queueType;          /* = CommandQueueType.Graphics */
+        }
+
+        public unsafe struct DrawPackedDescriptor
+        {
+            public IntPtr        numVertexBuffers;
+            public Buffer*       vertexBuffers;
+            public IntPtr        numIndexBuffers;
+            public Buffer*       indexBuffers;
+            public Format        indexFormat;      /* = Format.R32UInt */
+            public IntPtr        numResourceHeaps;
+            public ResourceHeap* resourceHeaps;
+            public void*         uniformData;      /* = null */
+            public int           firstUniform;     /* = 0 */
+            public short         uniformsSize;     /* = 0 */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool          indexed;          /* = false */
+            public IntPtr        numRecords;
+            public DrawRecord*   records;
+        }
+
         public unsafe struct DisplayMode
         {
             public Extent2D resolution;
@@ -3995,6 +4899,31 @@ namespace LLGL
             public bool                  outputWindingCCW; /* = false */
         }
 
+        public unsafe struct ComputePipelineDescriptor
+        {
+            public byte*                   debugName;                  /* = null */
+            public int                     flags;                      /* = 0 */
+            public PipelineLayout          pipelineLayout;             /* = null */
+            public Shader                  computeShader;              /* = null */
+            public IntPtr                  numSpecializationConstants;
+            public SpecializationConstant* specializationConstants;
+        }
+
+        public unsafe struct RayTracingPipelineDescriptor
+        {
+            public byte*                         debugName;           /* = null */
+            public int                           flags;               /* = 0 */
+            public PipelineLayout                pipelineLayout;      /* = null */
+            public Shader                        rayGenerationShader; /* = null */
+            public IntPtr                        numMissShaders;
+            public Shader*                       missShaders;
+            public IntPtr                        numHitGroups;
+            public RayTracingHitGroupDescriptor* hitGroups;
+            public int                           maxRecursionDepth;   /* = 1 */
+            public int                           maxPayloadSize;      /* = 16 */
+            public int                           maxAttributeSize;    /* = 8 */
+        }
+
         public unsafe struct QueryHeapDescriptor
         {
             public byte*     debugName;       /* = null */
@@ -4004,12 +4933,20 @@ namespace LLGL
             public bool      renderCondition; /* = false */
         }
 
-        public unsafe struct FrameProfile
+        public unsafe struct ProfileStatisticsRecord
         {
-            public ProfileCommandQueueRecord  commandQueueRecord;
-            public ProfileCommandBufferRecord commandBufferRecord;
-            public IntPtr                     numTimeRecords;
-            public ProfileTimeRecord*         timeRecords;
+            public byte*                   annotation;
+            public long                    frame;      /* = 0 */
+            public QueryPipelineStatistics statistics;
+        }
+
+        public unsafe struct ProfileEventRecord
+        {
+            public ProfileEventType type;          /* = ProfileEventType.Encoding */
+            public byte*            annotation;
+            public int              thread;        /* = 0 */
+            public long             cpuTicksStart; /* = 0 */
+            public long             cpuTicksEnd;   /* = 0 */
         }
 
         public unsafe struct AttachmentFormatDescriptor
@@ -4021,14 +4958,20 @@ namespace LLGL
 
         public unsafe struct RenderSystemDescriptor
         {
-            public byte*             moduleName;
-            public int               flags;              /* = 0 */
-            public void*             profiler;           /* = null */
-            public RenderingDebugger debugger;           /* = null */
-            public void*             rendererConfig;     /* = null */
-            public IntPtr            rendererConfigSize; /* = 0 */
-            public void*             nativeHandle;       /* = null */
-            public IntPtr            nativeHandleSize;   /* = 0 */
+            public byte*               moduleName;
+            public int                 flags;                  /* = 0 */
+            public int                 adapterIndex;           /* = -1 */
+            public long                adapterLUID;            /* = 0 */
+            public fixed byte          adapterUUID[16];        /* = {  } */
+            public void*               profiler;               /* = null */
+            public RenderingDebugger   debugger;               /* = null */
+            public void*               rendererConfig;         /* = null */
+            public IntPtr              rendererConfigSize;     /* = 0 */
+            public void*               nativeHandle;           /* = null */
+            public IntPtr              nativeHandleSize;       /* = 0 */
+            public byte*               pipelineCacheDirectory; /* = null */
+            public byte*               shaderCacheFilename;    /* = null */
+            public AllocatorDescriptor allocator;
         }
 
         public unsafe struct RenderingCapabilities
@@ -4051,6 +4994,14 @@ namespace LLGL
             public int     arrayLayer; /* = 0 */
         }
 
+        public unsafe struct SharedResourceHandle
+        {
+            public SharedHandleType type;   /* = SharedHandleType.Undefined */
+            public void*            handle; /* = null */
+            public int              fd;     /* = -1 */
+            public long             size;   /* = 0 */
+        }
+
         public unsafe struct SamplerDescriptor
         {
             public byte*              debugName;      /* = null */
@@ -4079,17 +5030,37 @@ namespace LLGL
 
         public unsafe struct SwapChainDescriptor
         {
-            public byte*    debugName;   /* = null */
-            public Extent2D resolution;
-            public int      colorBits;   /* = 32 */
-            public int      depthBits;   /* = 24 */
-            public int      stencilBits; /* = 8 */
-            public int      samples;     /* = 1 */
-            public int      swapBuffers; /* = 2 */
+            public byte*       debugName;             /* = null */
+            public Extent2D    resolution;
+            public int         colorBits;             /* = 32 */
+            public int         depthBits;             /* = 24 */
+            public int         stencilBits;           /* = 8 */
+            public int         samples;               /* = 1 */
+            public int         swapBuffers;           /* = 2 */
+            public int         maxFramesInFlight;     /* = 0 */
+            public int         frameStatisticsWindow; /* = 0 */
+            public PresentMode presentMode;           /* = PresentMode.Default */
+            public ColorSpace  colorSpace;            /* = ColorSpace.SRGB */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        fullscreen;            /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        resizable;             /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool     fullscreen;  /* = false */
+            public bool        lateImageAcquire;      /* = false */
             [MarshalAs(UnmanagedType.I1)]
-            public bool     resizable;   /* = false */
+            public bool        preTransform;          /* = false */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool        framePacing;           /* = false */
+        }
+
+        public unsafe struct FrameStatistics
+        {
+            public long                numFrames;        /* = 0 */
+            public int                 numSamples;       /* = 0 */
+            public FrameTimeStatistics cpuFrameTime;
+            public FrameTimeStatistics displayFrameTime;
+            public FrameTimeStatistics presentInterval;
+            public FrameTimeStatistics queueStallTime;
         }
 
         public unsafe struct TextureDescriptor
@@ -4107,6 +5078,25 @@ namespace LLGL
             public ClearValue  clearValue;
         }
 
+        public unsafe struct TileMappingDescriptor
+        {
+            public Texture  texture;    /* = null */
+            public int      mipLevel;   /* = 0 */
+            public int      arrayLayer; /* = 0 */
+            public Offset3D tileOffset;
+            public Extent3D numTiles;   /* = new Extent3D() { Width =  1, Height =  1, Depth =  1  } */
+            [MarshalAs(UnmanagedType.I1)]
+            public bool     resident;   /* = true */
+        }
+
+        public unsafe struct SamplerFeedbackDescriptor
+        {
+            public byte*               debugName;     /* = null */
+            public Texture             pairedTexture; /* = null */
+            public SamplerFeedbackType type;          /* = SamplerFeedbackType.MinMip */
+            public Extent3D            mipRegion;     /* = new Extent3D() { Width =  4, Height =  4, Depth =  1  } */
+        }
+
         public unsafe struct VertexAttribute
         {
             public byte*       name;
@@ -4143,6 +5133,39 @@ namespace LLGL
             public VertexAttribute* vertexAttribs;
         }
 
+        public unsafe struct AccelerationStructureDescriptor
+        {
+            public AccelerationStructureType                type;          /* = AccelerationStructureType.BottomLevel */
+            public int                                      flags;         /* = 0 */
+            public IntPtr                                   numGeometries;
+            public AccelerationStructureGeometryDescriptor* geometries;
+            public IntPtr                                   numInstances;
+            public AccelerationStructureInstance*           instances;
+        }
+
+        public unsafe struct IndirectCommandDescriptor
+        {
+            public IntPtr                      numArguments;
+            public IndirectArgumentDescriptor* arguments;
+            public int                         stride;       /* = 0 */
+        }
+
+        public unsafe struct CommandBatchDescriptor
+        {
+            public IntPtr             numObjects;
+            public RenderSystemChild* objects;
+            public void*              uniformData; /* = null */
+            public IntPtr             numRecords;
+            public CommandRecord*     records;
+        }
+
+        public unsafe struct TextureUploadDescriptor
+        {
+            public Texture       texture;   /* = null */
+            public TextureRegion region;
+            public ImageView     imageView;
+        }
+
         public unsafe struct StaticSamplerDescriptor
         {
             public byte*             name;
@@ -4182,6 +5205,22 @@ namespace LLGL
             public BlendTargetDescriptor targets7;
         }
 
+        public unsafe struct FrameProfile
+        {
+            public ProfileCommandQueueRecord  commandQueueRecord;
+            public ProfileCommandBufferRecord commandBufferRecord;
+            public ProfileBackendRecord       backendRecord;
+            public IntPtr                     numTimeRecords;
+            public ProfileTimeRecord*         timeRecords;
+            public IntPtr                     numScopeRecords;
+            public ProfileScopeRecord*        scopeRecords;
+            public IntPtr                     numEventRecords;
+            public ProfileEventRecord*        eventRecords;
+            public IntPtr                     numStatisticsRecords;
+            public ProfileStatisticsRecord*   statisticsRecords;
+            public QueryPipelineStatistics    pipelineStatistics;
+        }
+
         public unsafe struct RenderPassDescriptor
         {
             public byte*                      debugName;         /* = null */
@@ -4196,6 +5235,21 @@ namespace LLGL
             public AttachmentFormatDescriptor depthAttachment;
             public AttachmentFormatDescriptor stencilAttachment;
             public int                        samples;           /* = 1 */
+            public int                        viewMask;          /* = 0 */
+        }
+
+        public unsafe struct FileUploadDescriptor
+        {
+            public byte*           filename;         /* = null */
+            public long            fileOffset;       /* = 0 */
+            public long            fileSize;         /* = 0 */
+            public FileCompression compression;      /* = FileCompression.Uncompressed */
+            public long            uncompressedSize; /* = 0 */
+            public Buffer          buffer;           /* = null */
+            public long            bufferOffset;     /* = 0 */
+            public Texture         texture;          /* = null */
+            public TextureRegion   textureRegion;
+            public int             rowStride;        /* = 0 */
         }
 
         public unsafe struct RenderTargetDescriptor
@@ -4204,6 +5258,7 @@ namespace LLGL
             public RenderPass           renderPass;             /* = null */
             public Extent2D             resolution;
             public int                  samples;                /* = 1 */
+            public int                  viewMask;               /* = 0 */
             public AttachmentDescriptor colorAttachments0;
             public AttachmentDescriptor colorAttachments1;
             public AttachmentDescriptor colorAttachments2;
@@ -4221,6 +5276,7 @@ namespace LLGL
             public AttachmentDescriptor resolveAttachments6;
             public AttachmentDescriptor resolveAttachments7;
             public AttachmentDescriptor depthStencilAttachment;
+            public AttachmentDescriptor shadingRateAttachment;
         }
 
         public unsafe struct VertexShaderAttributes
@@ -4244,6 +5300,13 @@ namespace LLGL
             public StorageBufferType storageBufferType;  /* = StorageBufferType.Undefined */
         }
 
+        public unsafe struct TextureCopyRegion
+        {
+            public TextureLocation dstLocation;
+            public TextureLocation srcLocation;
+            public Extent3D        extent;
+        }
+
         public unsafe struct TextureViewDescriptor
         {
             public TextureType        type;        /* = TextureType.Texture2D */
@@ -4266,29 +5329,37 @@ namespace LLGL
             public IntPtr                            numCombinedTextureSamplers;
             public CombinedTextureSamplerDescriptor* combinedTextureSamplers;
             public int                               barrierFlags;               /* = 0 */
+            public int                               flags;                      /* = 0 */
         }
 
         public unsafe struct GraphicsPipelineDescriptor
         {
-            public byte*                  debugName;            /* = null */
-            public PipelineLayout         pipelineLayout;       /* = null */
-            public RenderPass             renderPass;           /* = null */
-            public Shader                 vertexShader;         /* = null */
-            public Shader                 tessControlShader;    /* = null */
-            public Shader                 tessEvaluationShader; /* = null */
-            public Shader                 geometryShader;       /* = null */
-            public Shader                 fragmentShader;       /* = null */
-            public Format                 indexFormat;          /* = Format.Undefined */
-            public PrimitiveTopology      primitiveTopology;    /* = PrimitiveTopology.TriangleList */
-            public IntPtr                 numViewports;
-            public Viewport*              viewports;
-            public IntPtr                 numScissors;
-            public Scissor*               scissors;
-            public DepthDescriptor        depth;
-            public StencilDescriptor      stencil;
-            public RasterizerDescriptor   rasterizer;
-            public BlendDescriptor        blend;
-            public TessellationDescriptor tessellation;
+            public byte*                   debugName;                  /* = null */
+            public int                     flags;                      /* = 0 */
+            public PipelineLayout          pipelineLayout;             /* = null */
+            public RenderPass              renderPass;                 /* = null */
+            public int                     viewMask;                   /* = 0 */
+            public Shader                  vertexShader;               /* = null */
+            public Shader                  tessControlShader;          /* = null */
+            public Shader                  tessEvaluationShader;       /* = null */
+            public Shader                  geometryShader;             /* = null */
+            public Shader                  taskShader;                 /* = null */
+            public Shader                  meshShader;                 /* = null */
+            public Shader                  tileShader;                 /* = null */
+            public Shader                  fragmentShader;             /* = null */
+            public Format                  indexFormat;                /* = Format.Undefined */
+            public PrimitiveTopology       primitiveTopology;          /* = PrimitiveTopology.TriangleList */
+            public IntPtr                  numViewports;
+            public Viewport*               viewports;
+            public IntPtr                  numScissors;
+            public Scissor*                scissors;
+            public DepthDescriptor         depth;
+            public StencilDescriptor       stencil;
+            public RasterizerDescriptor    rasterizer;
+            public BlendDescriptor         blend;
+            public TessellationDescriptor  tessellation;
+            public IntPtr                  numSpecializationConstants;
+            public SpecializationConstant* specializationConstants;
         }
 
         public unsafe struct ResourceViewDescriptor
@@ -4301,20 +5372,22 @@ namespace LLGL
 
         public unsafe struct ShaderDescriptor
         {
-            public byte*                    debugName;  /* = null */
-            public ShaderType               type;       /* = ShaderType.Undefined */
-            public byte*                    source;     /* = null */
-            public IntPtr                   sourceSize; /* = 0 */
-            public ShaderSourceType         sourceType; /* = ShaderSourceType.CodeFile */
-            public byte*                    entryPoint; /* = null */
-            public byte*                    profile;    /* = null */
-            public ShaderMacro*             defines;    /* = null */
-            public int                      flags;      /* = 0 */
+            public byte*                    debugName;          /* = null */
+            public ShaderType               type;               /* = ShaderType.Undefined */
+            public byte*                    source;             /* = null */
+            public IntPtr                   sourceSize;         /* = 0 */
+            public ShaderSourceType         sourceType;         /* = ShaderSourceType.CodeFile */
+            public byte*                    entryPoint;         /* = null */
+            public byte*                    profile;            /* = null */
+            public ShaderMacro*             defines;            /* = null */
+            public int                      flags;              /* = 0 */
             [Obsolete("ShaderDescriptor.name is deprecated since 0.04b; Use ShaderDescriptor.debugName instead!")]
             public byte*                    name;
             public VertexShaderAttributes   vertex;
             public FragmentShaderAttributes fragment;
             public ComputeShaderAttributes  compute;
+            public void*                    reflectionData;     /* = null */
+            public IntPtr                   reflectionDataSize; /* = 0 */
         }
 
         public unsafe struct ShaderReflection
@@ -4330,6 +5403,12 @@ namespace LLGL
 
         /* ----- Native delegates ----- */
 
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public unsafe delegate void* AllocateCallbackDelegate(IntPtr size, IntPtr alignment, void* userData);
+
+        [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+        public unsafe delegate void FreeCallbackDelegate(void* ptr, IntPtr size, IntPtr alignment, void* userData);
+
         [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
         public unsafe delegate void OnCanvasProcessEventsDelegate(Canvas sender);
 
@@ -4487,9 +5566,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglUpdateBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void UpdateBuffer(Buffer dstBuffer, long dstOffset, void* data, short dataSize);
 
+        [DllImport(DllName, EntryPoint="llglAllocTransientBuffer", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void AllocTransientBuffer(long size, int bindFlags, long alignment, ref TransientBufferAllocation outAllocation);
+
         [DllImport(DllName, EntryPoint="llglCopyBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyBuffer(Buffer dstBuffer, long dstOffset, Buffer srcBuffer, long srcOffset, long size);
 
+        [DllImport(DllName, EntryPoint="llglCopyBufferRegions", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CopyBufferRegions(Buffer dstBuffer, Buffer srcBuffer, int numRegions, BufferCopyRegion* regions);
+
         [DllImport(DllName, EntryPoint="llglCopyBufferFromTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyBufferFromTexture(Buffer dstBuffer, long dstOffset, Texture srcTexture, ref TextureRegion srcRegion, int rowStride, int layerStride);
 
@@ -4499,6 +5584,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCopyTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyTexture(Texture dstTexture, ref TextureLocation dstLocation, Texture srcTexture, ref TextureLocation srcLocation, ref Extent3D extent);
 
+        [DllImport(DllName, EntryPoint="llglCopyTextureRegions", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CopyTextureRegions(Texture dstTexture, Texture srcTexture, int numRegions, TextureCopyRegion* regions);
+
         [DllImport(DllName, EntryPoint="llglCopyTextureFromBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void CopyTextureFromBuffer(Texture dstTexture, ref TextureRegion dstRegion, Buffer srcBuffer, long srcOffset, int rowStride, int layerStride);
 
@@ -4511,6 +5599,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGenerateMipsRange", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void GenerateMipsRange(Texture texture, ref TextureSubresource subresource);
 
+        [DllImport(DllName, EntryPoint="llglGenerateMipsBatch", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void GenerateMipsBatch(int numTextures, Texture* textures);
+
+        [DllImport(DllName, EntryPoint="llglResolveSamplerFeedback", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ResolveSamplerFeedback(Texture feedbackTexture, int mipLevel, int arrayLayer, Buffer dstBuffer, long dstOffset);
+
+        [DllImport(DllName, EntryPoint="llglClearSamplerFeedback", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ClearSamplerFeedback(Texture feedbackTexture);
+
         [DllImport(DllName, EntryPoint="llglSetViewport", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetViewport(ref Viewport viewport);
 
@@ -4541,9 +5638,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSetResource", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetResource(int descriptor, Resource resource);
 
+        [DllImport(DllName, EntryPoint="llglSetConstantBufferRange", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetConstantBufferRange(int descriptor, Buffer buffer, long offset, long size);
+
         [DllImport(DllName, EntryPoint="llglResourceBarrier", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ResourceBarrier(int numBuffers, Buffer* buffers, int numTextures, Texture* textures);
 
+        [DllImport(DllName, EntryPoint="llglAliasingBarrier", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void AliasingBarrier(Texture textureBefore, Texture textureAfter);
+
         [DllImport(DllName, EntryPoint="llglResetResourceSlots", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ResetResourceSlots(ResourceType resourceType, int firstSlot, int numSlots, int bindFlags, int stageFlags);
 
@@ -4571,6 +5674,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglSetStencilReference", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetStencilReference(int reference, StencilFace stencilFace);
 
+        [DllImport(DllName, EntryPoint="llglSetShadingRate", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetShadingRate(ShadingRate rate);
+
         [DllImport(DllName, EntryPoint="llglSetUniforms", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void SetUniforms(int first, void* data, short dataSize);
 
@@ -4580,6 +5686,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglEndQuery", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void EndQuery(QueryHeap queryHeap, int query);
 
+        [DllImport(DllName, EntryPoint="llglResolveQueryData", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ResolveQueryData(QueryHeap srcQueryHeap, int firstQuery, int numQueries, Buffer dstBuffer, long dstOffset);
+
         [DllImport(DllName, EntryPoint="llglBeginRenderCondition", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void BeginRenderCondition(QueryHeap queryHeap, int query, RenderConditionMode mode);
 
@@ -4625,15 +5734,45 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectExt", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawIndexedIndirectExt(Buffer buffer, long offset, int numCommands, int stride);
 
+        [DllImport(DllName, EntryPoint="llglDrawIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndirectCount(Buffer buffer, long offset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride);
+
+        [DllImport(DllName, EntryPoint="llglDrawIndexedIndirectCount", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawIndexedIndirectCount(Buffer buffer, long offset, Buffer countBuffer, long countOffset, int maxNumCommands, int stride);
+
         [DllImport(DllName, EntryPoint="llglDrawStreamOutput", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DrawStreamOutput();
 
+        [DllImport(DllName, EntryPoint="llglDrawMeshTasks", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawMeshTasks(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
+
+        [DllImport(DllName, EntryPoint="llglDrawMeshTasksIndirect", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawMeshTasksIndirect(Buffer buffer, long offset, int numCommands, int stride);
+
+        [DllImport(DllName, EntryPoint="llglDispatchTiles", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DispatchTiles();
+
+        [DllImport(DllName, EntryPoint="llglExecuteIndirect", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ExecuteIndirect(ref IndirectCommandDescriptor commandDesc, Buffer buffer, long offset, Buffer countBuffer, long countOffset, int maxNumCommands);
+
+        [DllImport(DllName, EntryPoint="llglDrawPacked", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DrawPacked(ref DrawPackedDescriptor drawDesc);
+
+        [DllImport(DllName, EntryPoint="llglExecuteCommandBatch", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ExecuteCommandBatch(ref CommandBatchDescriptor batchDesc);
+
         [DllImport(DllName, EntryPoint="llglDispatch", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void Dispatch(int numWorkGroupsX, int numWorkGroupsY, int numWorkGroupsZ);
 
         [DllImport(DllName, EntryPoint="llglDispatchIndirect", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void DispatchIndirect(Buffer buffer, long offset);
 
+        [DllImport(DllName, EntryPoint="llglBuildAccelerationStructure", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void BuildAccelerationStructure(Buffer dstBuffer, Buffer scratchBuffer, ref AccelerationStructureDescriptor desc, Buffer srcBuffer);
+
+        [DllImport(DllName, EntryPoint="llglDispatchRays", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void DispatchRays(int width, int height, int depth);
+
         [DllImport(DllName, EntryPoint="llglPushDebugGroup", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void PushDebugGroup([MarshalAs(UnmanagedType.LPStr)] string name);
 
@@ -4664,6 +5803,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglWaitIdle", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void WaitIdle();
 
+        [DllImport(DllName, EntryPoint="llglUpdateTileMappings", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void UpdateTileMappings(int numMappings, TileMappingDescriptor* mappings);
+
         [DllImport(DllName, EntryPoint="llglDisplayCount", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe IntPtr DisplayCount();
 
@@ -4730,6 +5872,19 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglUnregisterLogCallback", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void UnregisterLogCallback(IntPtr handle);
 
+        [DllImport(DllName, EntryPoint="llglSetLogReportLevel", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetLogReportLevel(ReportType type);
+
+        [DllImport(DllName, EntryPoint="llglIsLogReportEnabled", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool IsLogReportEnabled(ReportType type);
+
+        [DllImport(DllName, EntryPoint="llglSetLogDeferredReports", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetLogDeferredReports(IntPtr capacity);
+
+        [DllImport(DllName, EntryPoint="llglFlushLogDeferredReports", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe IntPtr FlushLogDeferredReports();
+
         [DllImport(DllName, EntryPoint="llglGetPipelineCacheBlob", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe IntPtr GetPipelineCacheBlob(PipelineCache pipelineCache, void* data, IntPtr size);
 
@@ -4748,6 +5903,13 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetPipelineStateReport", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Report GetPipelineStateReport(PipelineState pipelineState);
 
+        [DllImport(DllName, EntryPoint="llglIsPipelineStateReady", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool IsPipelineStateReady(PipelineState pipelineState);
+
+        [DllImport(DllName, EntryPoint="llglGetPlacementHeapSize", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe long GetPlacementHeapSize(PlacementHeap placementHeap);
+
         [DllImport(DllName, EntryPoint="llglGetQueryHeapType", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe QueryType GetQueryHeapType(QueryHeap queryHeap);
 
@@ -4764,6 +5926,53 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetDebuggerTimeRecording(RenderingDebugger debugger);
 
+        [DllImport(DllName, EntryPoint="llglSetDebuggerScopeRecording", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerScopeRecording(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerScopeRecording", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerScopeRecording(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglSetDebuggerEventRecording", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerEventRecording(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerEventRecording", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerEventRecording(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglSetDebuggerStatisticsRecording", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerStatisticsRecording(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerStatisticsRecording", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerStatisticsRecording(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglSetDebuggerValidation", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerValidation(RenderingDebugger debugger, [MarshalAs(UnmanagedType.I1)] bool enabled);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerValidation", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetDebuggerValidation(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglSetDebuggerValidationFlags", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void SetDebuggerValidationFlags(RenderingDebugger debugger, int flags);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerValidationFlags", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int GetDebuggerValidationFlags(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglBeginDebuggerCapture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void BeginDebuggerCapture(RenderingDebugger debugger, [MarshalAs(UnmanagedType.LPStr)] string filename, int numFrames);
+
+        [DllImport(DllName, EntryPoint="llglEndDebuggerCapture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void EndDebuggerCapture(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerCaptureFilename", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.LPStr)]
+        public static extern unsafe string GetDebuggerCaptureFilename(RenderingDebugger debugger);
+
+        [DllImport(DllName, EntryPoint="llglGetDebuggerCaptureFrames", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int GetDebuggerCaptureFrames(RenderingDebugger debugger);
+
         [DllImport(DllName, EntryPoint="llglFlushDebuggerProfile", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void FlushDebuggerProfile(RenderingDebugger debugger, ref FrameProfile outFrameProfile);
 
@@ -4795,6 +6004,12 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglGetRendererReport", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Report GetRendererReport();
 
+        [DllImport(DllName, EntryPoint="llglQueryMemoryHeaps", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int QueryMemoryHeaps(ref MemoryHeapInfo outHeapInfos, int maxHeapInfos);
+
+        [DllImport(DllName, EntryPoint="llglQueryAdapters", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe int QueryAdapters(ref AdapterInfo outAdapters, int maxAdapters);
+
         [DllImport(DllName, EntryPoint="llglCreateSwapChain", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe SwapChain CreateSwapChain(ref SwapChainDescriptor swapChainDesc);
 
@@ -4813,9 +6028,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCreateBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Buffer CreateBuffer(ref BufferDescriptor bufferDesc, void* initialData);
 
+        [DllImport(DllName, EntryPoint="llglCreateBuffers", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CreateBuffers(int numBuffers, ref BufferDescriptor bufferDescs, void** initialData, Buffer* outBuffers);
+
         [DllImport(DllName, EntryPoint="llglReleaseBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReleaseBuffer(Buffer buffer);
 
+        [DllImport(DllName, EntryPoint="llglReleaseBuffers", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ReleaseBuffers(int numBuffers, Buffer* buffers);
+
         [DllImport(DllName, EntryPoint="llglWriteBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void WriteBuffer(Buffer buffer, long offset, void* data, long dataSize);
 
@@ -4831,6 +6052,12 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglUnmapBuffer", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void UnmapBuffer(Buffer buffer);
 
+        [DllImport(DllName, EntryPoint="llglFlushMappedRange", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void FlushMappedRange(Buffer buffer, long offset, long length);
+
+        [DllImport(DllName, EntryPoint="llglGetAccelerationStructureSizes", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void GetAccelerationStructureSizes(ref AccelerationStructureDescriptor accelerationStructureDesc, ref AccelerationStructureSizes outSizes);
+
         [DllImport(DllName, EntryPoint="llglCreateBufferArray", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe BufferArray CreateBufferArray(int numBuffers, Buffer* buffers);
 
@@ -4840,15 +6067,59 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCreateTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Texture CreateTexture(ref TextureDescriptor textureDesc, ImageView* initialImage);
 
+        [DllImport(DllName, EntryPoint="llglCreateTextures", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CreateTextures(int numTextures, ref TextureDescriptor textureDescs, ImageView* initialImages, Texture* outTextures);
+
         [DllImport(DllName, EntryPoint="llglReleaseTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReleaseTexture(Texture texture);
 
+        [DllImport(DllName, EntryPoint="llglReleaseTextures", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ReleaseTextures(int numTextures, Texture* textures);
+
         [DllImport(DllName, EntryPoint="llglWriteTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void WriteTexture(Texture texture, ref TextureRegion textureRegion, ref ImageView srcImageView);
 
+        [DllImport(DllName, EntryPoint="llglWriteTextureAsync", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void WriteTextureAsync(int numUploads, TextureUploadDescriptor* uploads, Fence fence);
+
+        [DllImport(DllName, EntryPoint="llglWriteFromFileAsync", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void WriteFromFileAsync(int numUploads, FileUploadDescriptor* uploads, Fence fence);
+
         [DllImport(DllName, EntryPoint="llglReadTexture", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReadTexture(Texture texture, ref TextureRegion textureRegion, ref MutableImageView dstImageView);
 
+        [DllImport(DllName, EntryPoint="llglReadTextureAsync", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ReadTextureAsync(Texture texture, ref TextureRegion textureRegion, ref MutableImageView dstImageView, Fence fence);
+
+        [DllImport(DllName, EntryPoint="llglCreatePlacementHeap", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe PlacementHeap CreatePlacementHeap(ref PlacementHeapDescriptor placementHeapDesc);
+
+        [DllImport(DllName, EntryPoint="llglReleasePlacementHeap", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void ReleasePlacementHeap(PlacementHeap placementHeap);
+
+        [DllImport(DllName, EntryPoint="llglGetTextureMemoryRequirements", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void GetTextureMemoryRequirements(ref TextureDescriptor textureDesc, ref MemoryRequirements outRequirements);
+
+        [DllImport(DllName, EntryPoint="llglCreatePlacedTexture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe Texture CreatePlacedTexture(PlacementHeap placementHeap, long offset, ref TextureDescriptor textureDesc);
+
+        [DllImport(DllName, EntryPoint="llglCreateSamplerFeedbackTexture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe Texture CreateSamplerFeedbackTexture(ref SamplerFeedbackDescriptor samplerFeedbackDesc);
+
+        [DllImport(DllName, EntryPoint="llglExportSharedHandle", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool ExportSharedHandle(Resource resource, ref SharedResourceHandle outHandle);
+
+        [DllImport(DllName, EntryPoint="llglImportTexture", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe Texture ImportTexture(ref TextureDescriptor textureDesc, ref SharedResourceHandle sharedHandle);
+
+        [DllImport(DllName, EntryPoint="llglImportBuffer", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe Buffer ImportBuffer(ref BufferDescriptor bufferDesc, ref SharedResourceHandle sharedHandle);
+
+        [DllImport(DllName, EntryPoint="llglExportSharedFence", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool ExportSharedFence(Fence fence, ref SharedResourceHandle outHandle);
+
         [DllImport(DllName, EntryPoint="llglCreateSampler", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Sampler CreateSampler(ref SamplerDescriptor samplerDesc);
 
@@ -4882,6 +6153,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCreateShader", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe Shader CreateShader(ref ShaderDescriptor shaderDesc);
 
+        [DllImport(DllName, EntryPoint="llglCreateShaders", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CreateShaders(int numShaders, ref ShaderDescriptor shaderDescs, Shader* outShaders);
+
         [DllImport(DllName, EntryPoint="llglReleaseShader", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReleaseShader(Shader shader);
 
@@ -4909,6 +6183,15 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglCreateComputePipelineStateExt", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe PipelineState CreateComputePipelineStateExt(ref ComputePipelineDescriptor pipelineStateDesc, PipelineCache pipelineCache);
 
+        [DllImport(DllName, EntryPoint="llglCreateGraphicsPipelineStates", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CreateGraphicsPipelineStates(int numPipelineStates, ref GraphicsPipelineDescriptor pipelineStateDescs, PipelineState* outPipelineStates, PipelineCache pipelineCache);
+
+        [DllImport(DllName, EntryPoint="llglCreateComputePipelineStates", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void CreateComputePipelineStates(int numPipelineStates, ref ComputePipelineDescriptor pipelineStateDescs, PipelineState* outPipelineStates, PipelineCache pipelineCache);
+
+        [DllImport(DllName, EntryPoint="llglCreateRayTracingPipelineState", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe PipelineState CreateRayTracingPipelineState(ref RayTracingPipelineDescriptor pipelineStateDesc);
+
         [DllImport(DllName, EntryPoint="llglReleasePipelineState", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReleasePipelineState(PipelineState pipelineState);
 
@@ -4924,6 +6207,14 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglReleaseFence", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe void ReleaseFence(Fence fence);
 
+        [DllImport(DllName, EntryPoint="llglGetFenceNativeHandle", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetFenceNativeHandle(Fence fence, void* nativeHandle, IntPtr nativeHandleSize);
+
+        [DllImport(DllName, EntryPoint="llglIsFenceSignaled", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool IsFenceSignaled(Fence fence);
+
         [DllImport(DllName, EntryPoint="llglGetRenderSystemNativeHandle", CallingConvention=CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool GetRenderSystemNativeHandle(void* nativeHandle, IntPtr nativeHandleSize);
@@ -5043,6 +6334,24 @@ namespace LLGL
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool SetVsyncInterval(SwapChain swapChain, int vsyncInterval);
 
+        [DllImport(DllName, EntryPoint="llglWaitForNextFrame", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool WaitForNextFrame(SwapChain swapChain, long timeout);
+
+        [DllImport(DllName, EntryPoint="llglGetFrameStatistics", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetFrameStatistics(SwapChain swapChain, ref FrameStatistics outStatistics);
+
+        [DllImport(DllName, EntryPoint="llglGetCurrentBackBufferNativeHandle", CallingConvention=CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern unsafe bool GetCurrentBackBufferNativeHandle(SwapChain swapChain, void* nativeHandle, IntPtr nativeHandleSize);
+
+        [DllImport(DllName, EntryPoint="llglGetSurfaceTransform", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe SurfaceTransform GetSurfaceTransform(SwapChain swapChain);
+
+        [DllImport(DllName, EntryPoint="llglGetColorSpace", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe ColorSpace GetColorSpace(SwapChain swapChain);
+
         [DllImport(DllName, EntryPoint="llglSwitchFullscreen", CallingConvention=CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern unsafe bool SwitchFullscreen(SwapChain swapChain, [MarshalAs(UnmanagedType.I1)] bool enable);
@@ -5074,6 +6383,9 @@ namespace LLGL
         [DllImport(DllName, EntryPoint="llglTimerTick", CallingConvention=CallingConvention.Cdecl)]
         public static extern unsafe long TimerTick();
 
+        [DllImport(DllName, EntryPoint="llglTimerSleepUntil", CallingConvention=CallingConvention.Cdecl)]
+        public static extern unsafe void TimerSleepUntil(long tick);
+
         [DllImport(DllName, EntryPoint="llglShaderTypeToString", CallingConvention=CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.LPStr)]
         public static extern unsafe string ShaderTypeToString(ShaderType val);
@@ -166,6 +166,59 @@ namespace LLGL
             return new Buffer(NativeLLGL.CreateBuffer(ref nativeDesc, initialData), bufferDesc.DebugName);
         }
 
+        public Buffer[] CreateBuffers(BufferDescriptor[] bufferDescs, byte[][] initialData = null)
+        {
+            var nativeBufferDescs = new NativeLLGL.BufferDescriptor[bufferDescs.Length];
+            for (int i = 0; i < bufferDescs.Length; ++i)
+            {
+                nativeBufferDescs[i] = bufferDescs[i].Native;
+            }
+            var nativeBuffers = new NativeLLGL.Buffer[bufferDescs.Length];
+            if (bufferDescs.Length > 0)
+            {
+                /* Pin all initial data arrays until the native buffers have been created */
+                var initialDataHandles = new GCHandle[initialData != null ? bufferDescs.Length : 0];
+                var initialDataPtrs = new IntPtr[initialDataHandles.Length];
+                try
+                {
+                    for (int i = 0; i < initialDataHandles.Length; ++i)
+                    {
+                        if (initialData[i] != null)
+                        {
+                            initialDataHandles[i] = GCHandle.Alloc(initialData[i], GCHandleType.Pinned);
+                            initialDataPtrs[i] = initialDataHandles[i].AddrOfPinnedObject();
+                        }
+                    }
+                    unsafe
+                    {
+                        fixed (NativeLLGL.Buffer* nativeBuffersPtr = nativeBuffers)
+                        {
+                            fixed (IntPtr* initialDataPtrsPtr = initialDataPtrs)
+                            {
+                                NativeLLGL.CreateBuffers(bufferDescs.Length, ref nativeBufferDescs[0], (initialData != null ? (void**)initialDataPtrsPtr : null), nativeBuffersPtr);
+                            }
+                        }
+                    }
+                }
+                finally
+                {
+                    foreach (var handle in initialDataHandles)
+                    {
+                        if (handle.IsAllocated)
+                        {
+                            handle.Free();
+                        }
+                    }
+                }
+            }
+            var buffers = new Buffer[bufferDescs.Length];
+            for (int i = 0; i < bufferDescs.Length; ++i)
+            {
+                buffers[i] = new Buffer(nativeBuffers[i], bufferDescs[i].DebugName);
+            }
+            return buffers;
+        }
+
         public void WriteBuffer(Buffer buffer, long offset, byte[] data)
         {
             unsafe
@@ -243,6 +296,43 @@ namespace LLGL
             }
         }
 
+        public Texture[] CreateTextures(TextureDescriptor[] textureDescs, ImageView[] imageViews = null)
+        {
+            var nativeTextureDescs = new NativeLLGL.TextureDescriptor[textureDescs.Length];
+            for (int i = 0; i < textureDescs.Length; ++i)
+            {
+                nativeTextureDescs[i] = textureDescs[i].Native;
+            }
+            var nativeImageViews = new NativeLLGL.ImageView[imageViews != null ? textureDescs.Length : 0];
+            for (int i = 0; i < nativeImageViews.Length; ++i)
+            {
+                if (imageViews[i] != null && imageViews[i].IsValid)
+                {
+                    nativeImageViews[i] = imageViews[i].Native;
+                }
+            }
+            var nativeTextures = new NativeLLGL.Texture[textureDescs.Length];
+            if (textureDescs.Length > 0)
+            {
+                unsafe
+                {
+                    fixed (NativeLLGL.Texture* nativeTexturesPtr = nativeTextures)
+                    {
+                        fixed (NativeLLGL.ImageView* nativeImageViewsPtr = nativeImageViews)
+                        {
+                            NativeLLGL.CreateTextures(textureDescs.Length, ref nativeTextureDescs[0], (nativeImageViews.Length > 0 ? nativeImageViewsPtr : null), nativeTexturesPtr);
+                        }
+                    }
+                }
+            }
+            var textures = new Texture[textureDescs.Length];
+            for (int i = 0; i < textureDescs.Length; ++i)
+            {
+                textures[i] = new Texture(nativeTextures[i], textureDescs[i].DebugName);
+            }
+            return textures;
+        }
+
         public void WriteTexture(Texture texture, TextureRegion textureRegion, ImageView srcImageView)
         {
             unsafe
@@ -367,6 +457,32 @@ namespace LLGL
             return new Shader(NativeLLGL.CreateShader(ref nativeShaderDesc), shaderDesc.DebugName);
         }
 
+        public Shader[] CreateShaders(ShaderDescriptor[] shaderDescs)
+        {
+            var nativeShaderDescs = new NativeLLGL.ShaderDescriptor[shaderDescs.Length];
+            for (int i = 0; i < shaderDescs.Length; ++i)
+            {
+                nativeShaderDescs[i] = shaderDescs[i].Native;
+            }
+            var nativeShaders = new NativeLLGL.Shader[shaderDescs.Length];
+            if (shaderDescs.Length > 0)
+            {
+                unsafe
+                {
+                    fixed (NativeLLGL.Shader* nativeShadersPtr = nativeShaders)
+                    {
+                        NativeLLGL.CreateShaders(shaderDescs.Length, ref nativeShaderDescs[0], nativeShadersPtr);
+                    }
+                }
+            }
+            var shaders = new Shader[shaderDescs.Length];
+            for (int i = 0; i < shaderDescs.Length; ++i)
+            {
+                shaders[i] = new Shader(nativeShaders[i], shaderDescs[i].DebugName);
+            }
+            return shaders;
+        }
+
         #endregion
 
         public RenderPass CreateRenderPass(RenderPassDescriptor renderPassDesc)
@@ -39,6 +39,38 @@ namespace LLGL
             }
         }
 
+        private string pipelineCacheDirectory;
+        private byte[] pipelineCacheDirectoryAscii;
+
+        public string PipelineCacheDirectory
+        {
+            get
+            {
+                return pipelineCacheDirectory;
+            }
+            set
+            {
+                pipelineCacheDirectory = value;
+                pipelineCacheDirectoryAscii = (value != null ? Encoding.ASCII.GetBytes(value + "\0") : null);
+            }
+        }
+
+        private string shaderCacheFilename;
+        private byte[] shaderCacheFilenameAscii;
+
+        public string ShaderCacheFilename
+        {
+            get
+            {
+                return shaderCacheFilename;
+            }
+            set
+            {
+                shaderCacheFilename = value;
+                shaderCacheFilenameAscii = (value != null ? Encoding.ASCII.GetBytes(value + "\0") : null);
+            }
+        }
+
         public RenderSystemFlags Flags { get; set; }
 
         public RenderingDebugger Debugger { get; set; }
@@ -54,6 +86,14 @@ namespace LLGL
                     {
                         native.moduleName = moduleNameAsciiPtr;
                     }
+                    fixed (byte* pipelineCacheDirectoryAsciiPtr = pipelineCacheDirectoryAscii)
+                    {
+                        native.pipelineCacheDirectory = pipelineCacheDirectoryAsciiPtr;
+                    }
+                    fixed (byte* shaderCacheFilenameAsciiPtr = shaderCacheFilenameAscii)
+                    {
+                        native.shaderCacheFilename = shaderCacheFilenameAsciiPtr;
+                    }
                     native.flags = (int)Flags;
                     native.debugger = Debugger != null ? Debugger.Native : new NativeLLGL.RenderingDebugger();
                     native.rendererConfig = null;
@@ -20,6 +20,7 @@ namespace LLGL
         public AttachmentDescriptorArray ColorAttachments { get; private set; } = new AttachmentDescriptorArray();
         public AttachmentDescriptorArray ResolveAttachments { get; private set; } = new AttachmentDescriptorArray();
         public AttachmentDescriptor DepthStencilAttachment { get; set; } = new AttachmentDescriptor();
+        public AttachmentDescriptor ShadingRateAttachment { get; set; } = new AttachmentDescriptor();
 
         internal NativeLLGL.RenderTargetDescriptor Native
         {
@@ -49,6 +50,7 @@ namespace LLGL
                         nativeColorAttachments[i] = ResolveAttachments[i].Native;
                     }
                     native.depthStencilAttachment = DepthStencilAttachment.Native;
+                    native.shadingRateAttachment = ShadingRateAttachment.Native;
                 }
                 return native;
             }
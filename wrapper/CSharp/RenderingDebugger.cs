@@ -36,6 +36,92 @@ namespace LLGL
             }
         }
 
+        public bool ScopeRecording
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerScopeRecording(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerScopeRecording(Native, value);
+            }
+        }
+
+        public bool EventRecording
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerEventRecording(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerEventRecording(Native, value);
+            }
+        }
+
+        public bool StatisticsRecording
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerStatisticsRecording(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerStatisticsRecording(Native, value);
+            }
+        }
+
+        public bool Validation
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerValidation(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerValidation(Native, value);
+            }
+        }
+
+        public ValidationFlags ValidationFlags
+        {
+            get
+            {
+                return (ValidationFlags)NativeLLGL.GetDebuggerValidationFlags(Native);
+            }
+            set
+            {
+                NativeLLGL.SetDebuggerValidationFlags(Native, (int)value);
+            }
+        }
+
+        public void BeginCapture(string filename, int numFrames = 1)
+        {
+            NativeLLGL.BeginDebuggerCapture(Native, filename, numFrames);
+        }
+
+        public void EndCapture()
+        {
+            NativeLLGL.EndDebuggerCapture(Native);
+        }
+
+        public string CaptureFilename
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerCaptureFilename(Native);
+            }
+        }
+
+        public int CaptureFrames
+        {
+            get
+            {
+                return NativeLLGL.GetDebuggerCaptureFrames(Native);
+            }
+        }
+
         public FrameProfile FlushProfile()
         {
             var nativeFrameProfile = new NativeLLGL.FrameProfile();
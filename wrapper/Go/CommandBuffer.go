@@ -46,9 +46,11 @@ type CommandBuffer interface {
 	SetPipelineState(pipelineState PipelineState)
 	SetBlendFactor(color [4]float32)
 	SetStencilReference(reference uint32, stencilFace StencilFace)
+	SetShadingRate(rate ShadingRate)
 	SetUniforms(first uint32, data unsafe.Pointer, dataSize uint16)
 	BeginQuery(queryHeap QueryHeap, query uint32)
 	EndQuery(queryHeap QueryHeap, query uint32)
+	ResolveQueryData(srcQueryHeap QueryHeap, firstQuery uint32, numQueries uint32, dstBuffer Buffer, dstOffset uint64)
 	BeginRenderCondition(queryHeap QueryHeap, query uint32, mode RenderConditionMode)
 	EndRenderCondition()
 	BeginStreamOutput(numBuffers uint32, buffers []Buffer)
@@ -64,9 +66,16 @@ type CommandBuffer interface {
 	DrawIndirectExt(buffer Buffer, offset uint64, numCommands uint32, stride uint32)
 	DrawIndexedIndirect(buffer Buffer, offset uint64)
 	DrawIndexedIndirectExt(buffer Buffer, offset uint64, numCommands uint32, stride uint32)
+	DrawIndirectCount(buffer Buffer, offset uint64, countBuffer Buffer, countOffset uint64, maxNumCommands uint32, stride uint32)
+	DrawIndexedIndirectCount(buffer Buffer, offset uint64, countBuffer Buffer, countOffset uint64, maxNumCommands uint32, stride uint32)
 	DrawStreamOutput()
+	DrawMeshTasks(numWorkGroupsX uint32, numWorkGroupsY uint32, numWorkGroupsZ uint32)
+	DrawMeshTasksIndirect(buffer Buffer, offset uint64, numCommands uint32, stride uint32)
+	DispatchTiles()
+	ExecuteIndirect(commandDesc IndirectCommandDescriptor, buffer Buffer, offset uint64, countBuffer Buffer, countOffset uint64, maxNumCommands uint32)
 	Dispatch(numWorkGroupsX uint32, numWorkGroupsY uint32, numWorkGroupsZ uint32)
 	DispatchIndirect(buffer Buffer, offset uint64)
+	DispatchRays(width uint32, height uint32, depth uint32)
 	PushDebugGroup(name string)
 	PopDebugGroup()
 	DoNativeCommand(nativeCommand unsafe.Pointer, nativeCommandSize uintptr)
@@ -216,6 +225,10 @@ func (self commandBufferImpl) SetStencilReference(reference uint32, stencilFace
 	C.llglSetStencilReference(C.uint32_t(reference), C.LLGLStencilFace(stencilFace))
 }
 
+func (self commandBufferImpl) SetShadingRate(rate ShadingRate) {
+	C.llglSetShadingRate(C.LLGLShadingRate(rate))
+}
+
 func (self commandBufferImpl) SetUniforms(first uint32, data unsafe.Pointer, dataSize uint16) {
 	C.llglSetUniforms(C.uint32_t(first), data, C.uint16_t(dataSize))
 }
@@ -228,6 +241,10 @@ func (self commandBufferImpl) EndQuery(queryHeap QueryHeap, query uint32) {
 	C.llglEndQuery(queryHeap.(queryHeapImpl).native, C.uint32_t(query))
 }
 
+func (self commandBufferImpl) ResolveQueryData(srcQueryHeap QueryHeap, firstQuery uint32, numQueries uint32, dstBuffer Buffer, dstOffset uint64) {
+	C.llglResolveQueryData(srcQueryHeap.(queryHeapImpl).native, C.uint32_t(firstQuery), C.uint32_t(numQueries), dstBuffer.(bufferImpl).native, C.uint64_t(dstOffset))
+}
+
 func (self commandBufferImpl) BeginRenderCondition(queryHeap QueryHeap, query uint32, mode RenderConditionMode) {
 	C.llglBeginRenderCondition(queryHeap.(queryHeapImpl).native, C.uint32_t(query), C.LLGLRenderConditionMode(mode))
 }
@@ -288,10 +305,41 @@ func (self commandBufferImpl) DrawIndexedIndirectExt(buffer Buffer, offset uint6
 	C.llglDrawIndexedIndirectExt(buffer.(bufferImpl).native, C.uint64_t(offset), C.uint32_t(numCommands), C.uint32_t(stride))
 }
 
+func (self commandBufferImpl) DrawIndirectCount(buffer Buffer, offset uint64, countBuffer Buffer, countOffset uint64, maxNumCommands uint32, stride uint32) {
+	C.llglDrawIndirectCount(buffer.(bufferImpl).native, C.uint64_t(offset), countBuffer.(bufferImpl).native, C.uint64_t(countOffset), C.uint32_t(maxNumCommands), C.uint32_t(stride))
+}
+
+func (self commandBufferImpl) DrawIndexedIndirectCount(buffer Buffer, offset uint64, countBuffer Buffer, countOffset uint64, maxNumCommands uint32, stride uint32) {
+	C.llglDrawIndexedIndirectCount(buffer.(bufferImpl).native, C.uint64_t(offset), countBuffer.(bufferImpl).native, C.uint64_t(countOffset), C.uint32_t(maxNumCommands), C.uint32_t(stride))
+}
+
 func (self commandBufferImpl) DrawStreamOutput() {
 	C.llglDrawStreamOutput()
 }
 
+func (self commandBufferImpl) DrawMeshTasks(numWorkGroupsX uint32, numWorkGroupsY uint32, numWorkGroupsZ uint32) {
+	C.llglDrawMeshTasks(C.uint32_t(numWorkGroupsX), C.uint32_t(numWorkGroupsY), C.uint32_t(numWorkGroupsZ))
+}
+
+func (self commandBufferImpl) DrawMeshTasksIndirect(buffer Buffer, offset uint64, numCommands uint32, stride uint32) {
+	C.llglDrawMeshTasksIndirect(buffer.(bufferImpl).native, C.uint64_t(offset), C.uint32_t(numCommands), C.uint32_t(stride))
+}
+
+func (self commandBufferImpl) DispatchTiles() {
+	C.llglDispatchTiles()
+}
+
+func (self commandBufferImpl) ExecuteIndirect(commandDesc IndirectCommandDescriptor, buffer Buffer, offset uint64, countBuffer Buffer, countOffset uint64, maxNumCommands uint32) {
+	var nativeCommandDesc C.LLGLIndirectCommandDescriptor
+	convertIndirectCommandDescriptor(&nativeCommandDesc, &commandDesc)
+	var nativeCountBuffer C.LLGLBuffer
+	if countBuffer != nil {
+		nativeCountBuffer = countBuffer.(bufferImpl).native
+	}
+	C.llglExecuteIndirect(&nativeCommandDesc, buffer.(bufferImpl).native, C.uint64_t(offset), nativeCountBuffer, C.uint64_t(countOffset), C.uint32_t(maxNumCommands))
+	freeIndirectCommandDescriptor(&nativeCommandDesc)
+}
+
 func (self commandBufferImpl) Dispatch(numWorkGroupsX uint32, numWorkGroupsY uint32, numWorkGroupsZ uint32) {
 	C.llglDispatch(C.uint32_t(numWorkGroupsX), C.uint32_t(numWorkGroupsY), C.uint32_t(numWorkGroupsZ))
 }
@@ -300,6 +348,10 @@ func (self commandBufferImpl) DispatchIndirect(buffer Buffer, offset uint64) {
 	C.llglDispatchIndirect(buffer.(bufferImpl).native, C.uint64_t(offset))
 }
 
+func (self commandBufferImpl) DispatchRays(width uint32, height uint32, depth uint32) {
+	C.llglDispatchRays(C.uint32_t(width), C.uint32_t(height), C.uint32_t(depth))
+}
+
 func (self commandBufferImpl) PushDebugGroup(name string) {
 	nameCstr := C.CString(name)
 	C.llglPushDebugGroup(nameCstr)
@@ -13,6 +13,7 @@ import "C"
 
 type Fence interface {
 	RenderSystemChild
+	IsSignaled() bool
 }
 
 type fenceImpl struct {
@@ -23,6 +24,10 @@ func (self fenceImpl) SetDebugName(name string) {
 	setRenderSystemChildDebugName(C.LLGLRenderSystemChild(self.native), name)
 }
 
+func (self fenceImpl) IsSignaled() bool {
+	return bool(C.llglIsFenceSignaled(self.native))
+}
+
 
 
 // ================================================================================
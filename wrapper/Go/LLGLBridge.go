@@ -86,6 +86,25 @@ func freeBufferDescriptor(dst *C.LLGLBufferDescriptor) {
 	C.free(unsafe.Pointer(dst.vertexAttribs))
 }
 
+func convertIndirectArgumentDescriptor(dst *C.LLGLIndirectArgumentDescriptor, src *IndirectArgumentDescriptor) {
+	dst._type		= C.LLGLIndirectArgumentType(src.Type)
+	dst.first		= C.uint32_t(src.First)
+	dst.numUniforms	= C.uint32_t(src.NumUniforms)
+}
+
+func convertIndirectCommandDescriptor(dst *C.LLGLIndirectCommandDescriptor, src *IndirectCommandDescriptor) {
+	dst.numArguments	= C.size_t(len(src.Arguments))
+	dst.arguments		= unsafeAllocArray[C.LLGLIndirectArgumentDescriptor](dst.numArguments)
+	for i := C.size_t(0); i < dst.numArguments; i++ {
+		convertIndirectArgumentDescriptor(unsafePointerSubscript(dst.arguments, i), &src.Arguments[i])
+	}
+	dst.stride			= C.uint32_t(src.Stride)
+}
+
+func freeIndirectCommandDescriptor(dst *C.LLGLIndirectCommandDescriptor) {
+	C.free(unsafe.Pointer(dst.arguments))
+}
+
 func convertClearValue(dst *C.LLGLClearValue, src *ClearValue) {
 	dst.color[0]	= C.float(src.Color[0])
 	dst.color[1]	= C.float(src.Color[1])
@@ -295,6 +314,7 @@ func convertShaderRef(shader *Shader) C.LLGLShader {
 
 func convertGraphicsPipelineDescriptor(dst *C.LLGLGraphicsPipelineDescriptor, src *GraphicsPipelineDescriptor) {
 	dst.debugName				= C.CString(src.DebugName)
+	dst.flags					= C.long(src.Flags)
 	dst.pipelineLayout			= convertPipelineLayoutRef(src.PipelineLayout)
 	dst.renderPass				= convertRenderPassRef(src.RenderPass)
 	dst.vertexShader			= convertShaderRef(src.VertexShader)
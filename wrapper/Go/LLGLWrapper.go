@@ -40,6 +40,12 @@ const (
 
 /* ----- Enumerations ----- */
 
+type AccelerationStructureType int
+const (
+    AccelerationStructureTypeBottomLevel AccelerationStructureType = iota
+    AccelerationStructureTypeTopLevel
+)
+
 type EventAction int
 const (
     EventActionBegan EventAction = iota
@@ -66,6 +72,46 @@ const (
     StencilFaceBack
 )
 
+type ShadingRate int
+const (
+    ShadingRateRate1x1 ShadingRate = iota
+    ShadingRateRate1x2
+    ShadingRateRate2x1
+    ShadingRateRate2x2
+    ShadingRateRate2x4
+    ShadingRateRate4x2
+    ShadingRateRate4x4
+)
+
+type CommandQueueType int
+const (
+    CommandQueueTypeGraphics CommandQueueType = iota
+    CommandQueueTypeCompute
+    CommandQueueTypeCopy
+)
+
+type IndirectArgumentType int
+const (
+    IndirectArgumentTypeDraw IndirectArgumentType = iota
+    IndirectArgumentTypeDrawIndexed
+    IndirectArgumentTypeDrawMeshTasks
+    IndirectArgumentTypeDispatch
+    IndirectArgumentTypeUniforms
+)
+
+type CommandOpcode int
+const (
+    CommandOpcodeSetPipelineState CommandOpcode = iota
+    CommandOpcodeSetVertexBuffer
+    CommandOpcodeSetIndexBuffer
+    CommandOpcodeSetResourceHeap
+    CommandOpcodeSetResource
+    CommandOpcodeSetUniforms
+    CommandOpcodeDraw
+    CommandOpcodeDrawIndexed
+    CommandOpcodeDispatch
+)
+
 type Format int
 const (
     FormatUndefined Format = iota
@@ -147,6 +193,10 @@ const (
     FormatBC4SNorm
     FormatBC5UNorm
     FormatBC5SNorm
+    FormatBC6HUFloat
+    FormatBC6HSFloat
+    FormatBC7UNorm
+    FormatBC7UNorm_sRGB
     FormatASTC4x4
     FormatASTC4x4_sRGB
     FormatASTC5x4
@@ -178,6 +228,28 @@ const (
     FormatETC1UNorm
     FormatETC2UNorm
     FormatETC2UNorm_sRGB
+    FormatETC2A1UNorm
+    FormatETC2A1UNorm_sRGB
+    FormatETC2A8UNorm
+    FormatETC2A8UNorm_sRGB
+    FormatEACR11UNorm
+    FormatEACR11SNorm
+    FormatEACRG11UNorm
+    FormatEACRG11SNorm
+    FormatASTC4x4Float
+    FormatASTC5x4Float
+    FormatASTC5x5Float
+    FormatASTC6x5Float
+    FormatASTC6x6Float
+    FormatASTC8x5Float
+    FormatASTC8x6Float
+    FormatASTC8x8Float
+    FormatASTC10x5Float
+    FormatASTC10x6Float
+    FormatASTC10x8Float
+    FormatASTC10x10Float
+    FormatASTC12x10Float
+    FormatASTC12x12Float
 )
 
 type ImageFormat int
@@ -216,6 +288,28 @@ const (
     DataTypeFloat64
 )
 
+type ImageCompressionQuality int
+const (
+    ImageCompressionQualityFast ImageCompressionQuality = iota
+    ImageCompressionQualityDefault
+    ImageCompressionQualityHigh
+)
+
+type ImageMipMapFilter int
+const (
+    ImageMipMapFilterBox ImageMipMapFilter = iota
+    ImageMipMapFilterKaiser
+)
+
+type ImageResampleFilter int
+const (
+    ImageResampleFilterBox ImageResampleFilter = iota
+    ImageResampleFilterBilinear
+    ImageResampleFilterMitchell
+    ImageResampleFilterLanczos3
+    ImageResampleFilterKaiser
+)
+
 type ReportType int
 const (
     ReportTypeDefault ReportType = iota
@@ -577,6 +671,7 @@ const (
     QueryTypeStreamOutPrimitivesWritten
     QueryTypeStreamOutOverflow
     QueryTypePipelineStatistics
+    QueryTypeTimestamp
 )
 
 type ErrorType int
@@ -595,6 +690,14 @@ const (
     WarningTypeVaryingBehavior
 )
 
+type ProfileEventType int
+const (
+    ProfileEventTypeEncoding ProfileEventType = iota
+    ProfileEventTypeSubmission
+    ProfileEventTypeWait
+    ProfileEventTypePresent
+)
+
 type AttachmentLoadOp int
 const (
     AttachmentLoadOpUndefined AttachmentLoadOp = iota
@@ -659,6 +762,7 @@ const (
     ShadingLanguageMetal_3_0
     ShadingLanguageSPIRV
     ShadingLanguageSPIRV_100
+    ShadingLanguageWGSL
     ShadingLanguageVersionBitmask
 )
 
@@ -682,6 +786,12 @@ const (
     CPUAccessReadWrite
 )
 
+type FileCompression int
+const (
+    FileCompressionUncompressed FileCompression = iota
+    FileCompressionGDeflate
+)
+
 type ResourceType int
 const (
     ResourceTypeUndefined ResourceType = iota
@@ -690,6 +800,14 @@ const (
     ResourceTypeSampler
 )
 
+type SharedHandleType int
+const (
+    SharedHandleTypeUndefined SharedHandleType = iota
+    SharedHandleTypeOpaqueFD
+    SharedHandleTypeOpaqueWin32
+    SharedHandleTypeIOSurface
+)
+
 type SamplerAddressMode int
 const (
     SamplerAddressModeRepeat SamplerAddressMode = iota
@@ -714,6 +832,13 @@ const (
     ShaderTypeGeometry
     ShaderTypeFragment
     ShaderTypeCompute
+    ShaderTypeTask
+    ShaderTypeMesh
+    ShaderTypeTile
+    ShaderTypeRayGeneration
+    ShaderTypeMiss
+    ShaderTypeClosestHit
+    ShaderTypeAnyHit
 )
 
 type ShaderSourceType int
@@ -737,6 +862,30 @@ const (
     StorageBufferTypeConsumeStructuredBuffer
 )
 
+type PresentMode int
+const (
+    PresentModeDefault PresentMode = iota
+    PresentModeFifo
+    PresentModeFifoRelaxed
+    PresentModeMailbox
+    PresentModeImmediate
+)
+
+type SurfaceTransform int
+const (
+    SurfaceTransformIdentity SurfaceTransform = iota
+    SurfaceTransformRotate90
+    SurfaceTransformRotate180
+    SurfaceTransformRotate270
+)
+
+type ColorSpace int
+const (
+    ColorSpaceSRGB ColorSpace = iota
+    ColorSpaceHDR10
+    ColorSpaceScRGB
+)
+
 type SystemValue int
 const (
     SystemValueUndefined SystemValue = iota
@@ -781,9 +930,22 @@ const (
     TextureSwizzleAlpha
 )
 
+type SamplerFeedbackType int
+const (
+    SamplerFeedbackTypeMinMip SamplerFeedbackType = iota
+    SamplerFeedbackTypeMipRegionUsed
+)
+
 
 /* ----- Flags ----- */
 
+type AccelerationStructureFlags int
+const (
+    AccelerationStructureAllowUpdate     = (1 << 0)
+    AccelerationStructurePreferFastTrace = (1 << 1)
+    AccelerationStructurePreferFastBuild = (1 << 2)
+)
+
 type CanvasFlags int
 const (
     CanvasBorderless = (1 << 0)
@@ -791,9 +953,10 @@ const (
 
 type CommandBufferFlags int
 const (
-    CommandBufferSecondary       = (1 << 0)
-    CommandBufferMultiSubmit     = (1 << 1)
-    CommandBufferImmediateSubmit = (1 << 2)
+    CommandBufferSecondary        = (1 << 0)
+    CommandBufferMultiSubmit      = (1 << 1)
+    CommandBufferImmediateSubmit  = (1 << 2)
+    CommandBufferBakeDrawCommands = (1 << 3)
 )
 
 type ClearFlags int
@@ -866,6 +1029,12 @@ const (
     BarrierStorage        = (BarrierStorageBuffer | BarrierStorageTexture)
 )
 
+type PipelineLayoutFlags int
+const (
+    PipelineLayoutBindlessHeap    = (1 << 0)
+    PipelineLayoutRootDescriptors = (1 << 1)
+)
+
 type ColorMaskFlags int
 const (
     ColorMaskZero = 0
@@ -876,6 +1045,20 @@ const (
     ColorMaskAll  = (ColorMaskR | ColorMaskG | ColorMaskB | ColorMaskA)
 )
 
+type PipelineStateFlags int
+const (
+    PipelineStateAsyncCompilation = (1 << 0)
+)
+
+type ValidationFlags int
+const (
+    ValidationAPIUsage         = (1 << 0)
+    ValidationResourceBindings = (1 << 1)
+    ValidationDrawRanges       = (1 << 2)
+    ValidationBarriers         = (1 << 3)
+    ValidationAll              = (ValidationAPIUsage | ValidationResourceBindings | ValidationDrawRanges | ValidationBarriers)
+)
+
 type RenderSystemFlags int
 const (
     RenderSystemDebugDevice       = (1 << 0)
@@ -884,6 +1067,25 @@ const (
     RenderSystemPreferIntel       = (1 << 3)
     RenderSystemSoftwareDevice    = (1 << 4)
     RenderSystemDebugBreakOnError = (1 << 5)
+    RenderSystemHeadless          = (1 << 6)
+    RenderSystemSubmissionThread  = (1 << 7)
+)
+
+type MemoryHeapFlags int
+const (
+    MemoryHeapDeviceLocal = (1 << 0)
+)
+
+type SubgroupOperationFlags int
+const (
+    SubgroupOperationBasic           = (1 << 0)
+    SubgroupOperationVote            = (1 << 1)
+    SubgroupOperationArithmetic      = (1 << 2)
+    SubgroupOperationBallot          = (1 << 3)
+    SubgroupOperationShuffle         = (1 << 4)
+    SubgroupOperationShuffleRelative = (1 << 5)
+    SubgroupOperationClustered       = (1 << 6)
+    SubgroupOperationQuad            = (1 << 7)
 )
 
 type BindFlags int
@@ -900,6 +1102,9 @@ const (
     BindCombinedSampler        = (1 << 9)
     BindCopySrc                = (1 << 10)
     BindCopyDst                = (1 << 11)
+    BindShadingRateAttachment  = (1 << 12)
+    BindAccelerationStructure  = (1 << 13)
+    BindComputeStreamOutput    = (1 << 14)
 )
 
 type CPUAccessFlags int
@@ -910,12 +1115,23 @@ const (
 
 type MiscFlags int
 const (
-    MiscDynamicUsage  = (1 << 0)
-    MiscFixedSamples  = (1 << 1)
-    MiscGenerateMips  = (1 << 2)
-    MiscNoInitialData = (1 << 3)
-    MiscAppend        = (1 << 4)
-    MiscCounter       = (1 << 5)
+    MiscDynamicUsage      = (1 << 0)
+    MiscFixedSamples      = (1 << 1)
+    MiscGenerateMips      = (1 << 2)
+    MiscNoInitialData     = (1 << 3)
+    MiscAppend            = (1 << 4)
+    MiscCounter           = (1 << 5)
+    MiscPersistentMapping = (1 << 6)
+    MiscSparse            = (1 << 7)
+    MiscUntracked         = (1 << 8)
+    MiscTransient         = (1 << 9)
+    MiscShared            = (1 << 10)
+    MiscGPUConversion     = (1 << 11)
+)
+
+type ResourceHeapFlags int
+const (
+    ResourceHeapDynamic = (1 << 0)
 )
 
 type ShaderCompileFlags int
@@ -939,7 +1155,16 @@ const (
     StageGeometryStage       = (1 << 3)
     StageFragmentStage       = (1 << 4)
     StageComputeStage        = (1 << 5)
+    StageTaskStage           = (1 << 6)
+    StageMeshStage           = (1 << 7)
+    StageTileStage           = (1 << 8)
+    StageRayGenerationStage  = (1 << 9)
+    StageMissStage           = (1 << 10)
+    StageClosestHitStage     = (1 << 11)
+    StageAnyHitStage         = (1 << 12)
     StageAllTessStages       = (StageTessControlStage | StageTessEvaluationStage)
+    StageAllMeshStages       = (StageTaskStage | StageMeshStage)
+    StageAllRayTracingStages = (StageRayGenerationStage | StageMissStage | StageClosestHitStage | StageAnyHitStage)
     StageAllGraphicsStages   = (StageVertexStage | StageAllTessStages | StageGeometryStage | StageFragmentStage)
     StageAllStages           = (StageAllGraphicsStages | StageComputeStage)
 )
@@ -965,6 +1190,26 @@ const (
 
 /* ----- Structures ----- */
 
+type AccelerationStructureInstance struct {
+    AccelerationStructure *Buffer     /* = nil */
+    Transform             [12]float32 /* = {1.0,0.0,0.0,0.0,0.0,1.0,0.0,0.0,0.0,0.0,1.0,0.0} */
+    InstanceID            uint32      /* = 0 */
+    Mask                  uint32      /* = 0xFF */
+    HitGroupOffset        uint32      /* = 0 */
+}
+
+type AccelerationStructureSizes struct {
+    AccelerationStructureSize uint64 /* = 0 */
+    BuildScratchSize          uint64 /* = 0 */
+    UpdateScratchSize         uint64 /* = 0 */
+}
+
+type BufferCopyRegion struct {
+    DstOffset uint64 /* = 0 */
+    SrcOffset uint64 /* = 0 */
+    Size      uint64 /* = 0 */
+}
+
 type CanvasDescriptor struct {
     Title string
     Flags uint   /* = 0 */
@@ -976,12 +1221,24 @@ type ClearValue struct {
     Stencil uint32     /* = 0 */
 }
 
-type CommandBufferDescriptor struct {
-    DebugName          string      /* = "" */
-    Flags              uint        /* = 0 */
-    NumNativeBuffers   uint32      /* = 0 */
-    MinStagingPoolSize uint64      /* = (0xFFFF+1) */
-    RenderPass         *RenderPass /* = nil */
+type TransientBufferAllocation struct {
+    Buffer *Buffer        /* = nil */
+    Offset uint64         /* = 0 */
+    Size   uint64         /* = 0 */
+    Data   unsafe.Pointer /* = nil */
+}
+
+type DrawRecord struct {
+    VertexBuffer   uint32 /* = LLGL_INVALID_SLOT */
+    IndexBuffer    uint32 /* = LLGL_INVALID_SLOT */
+    ResourceHeap   uint32 /* = LLGL_INVALID_SLOT */
+    DescriptorSet  uint32 /* = 0 */
+    UniformsOffset uint32 /* = LLGL_INVALID_SLOT */
+    NumVertices    uint32 /* = 0 */
+    NumInstances   uint32 /* = 1 */
+    FirstVertex    uint32 /* = 0 */
+    VertexOffset   int32  /* = 0 */
+    FirstInstance  uint32 /* = 0 */
 }
 
 type DrawIndirectArguments struct {
@@ -1010,6 +1267,10 @@ type DispatchIndirectArguments struct {
     NumThreadGroups [3]uint32
 }
 
+type DrawMeshTasksIndirectArguments struct {
+    NumWorkGroups [3]uint32
+}
+
 type ColorCodes struct {
     TextFlags       uint /* = 0 */
     BackgroundFlags uint /* = 0 */
@@ -1042,10 +1303,24 @@ type DepthBiasDescriptor struct {
     Clamp          float32 /* = 0.0 */
 }
 
-type ComputePipelineDescriptor struct {
-    DebugName      string          /* = "" */
-    PipelineLayout *PipelineLayout /* = nil */
-    ComputeShader  *Shader         /* = nil */
+type SpecializationConstant struct {
+    Id    uint32 /* = 0 */
+    Value uint32 /* = 0 */
+}
+
+type RayTracingHitGroupDescriptor struct {
+    ClosestHitShader *Shader /* = nil */
+    AnyHitShader     *Shader /* = nil */
+}
+
+type PlacementHeapDescriptor struct {
+    DebugName string /* = "" */
+    Size      uint64 /* = 0 */
+}
+
+type MemoryRequirements struct {
+    Size      uint64 /* = 0 */
+    Alignment uint64 /* = 0 */
 }
 
 type QueryPipelineStatistics struct {
@@ -1069,6 +1344,18 @@ type ProfileTimeRecord struct {
     ElapsedTime   uint64 /* = 0 */
 }
 
+type ProfileScopeRecord struct {
+    Annotation    string
+    Parent        uint32 /* = ~0u */
+    Depth         uint32 /* = 0 */
+    Frame         uint64 /* = 0 */
+    CPUTicksStart uint64 /* = 0 */
+    CPUTicksEnd   uint64 /* = 0 */
+    GpuTicksStart uint64 /* = 0 */
+    GpuTicksEnd   uint64 /* = 0 */
+    ElapsedTime   uint64 /* = 0 */
+}
+
 type ProfileCommandQueueRecord struct {
     BufferWrites             uint32 /* = 0 */
     BufferReads              uint32 /* = 0 */
@@ -1106,6 +1393,14 @@ type ProfileCommandBufferRecord struct {
     DispatchCommands         uint32 /* = 0 */
 }
 
+type ProfileBackendRecord struct {
+    RedundantStateChanges    uint32 /* = 0 */
+    DescriptorCopies         uint32 /* = 0 */
+    DescriptorSetAllocations uint32 /* = 0 */
+    Barriers                 uint32 /* = 0 */
+    StagingUploadBytes       uint64 /* = 0 */
+}
+
 type RendererInfo struct {
     RendererName        string
     DeviceName          string
@@ -1115,70 +1410,122 @@ type RendererInfo struct {
     PipelineCacheID     []byte /* = nil */
 }
 
+type AllocatorDescriptor struct {
+    Allocate unsafe.Pointer /* = nil */
+    Free     unsafe.Pointer /* = nil */
+    UserData unsafe.Pointer /* = nil */
+}
+
 type RenderingFeatures struct {
-    HasRenderTargets             bool /* = false */
-    Has3DTextures                bool /* = false */
-    HasCubeTextures              bool /* = false */
-    HasArrayTextures             bool /* = false */
-    HasCubeArrayTextures         bool /* = false */
-    HasMultiSampleTextures       bool /* = false */
-    HasMultiSampleArrayTextures  bool /* = false */
-    HasTextureViews              bool /* = false */
-    HasTextureViewSwizzle        bool /* = false */
-    HasTextureViewFormatSwizzle  bool /* = false */
-    HasBufferViews               bool /* = false */
-    HasSamplers                  bool /* LLGLRenderingFeatures.hasSamplers is deprecated since 0.04b; All backends must support sampler states either natively or emulated. */
-    HasConstantBuffers           bool /* = false */
-    HasStorageBuffers            bool /* = false */
-    HasUniforms                  bool /* LLGLRenderingFeatures.hasUniforms is deprecated since 0.04b; All backends must support uniforms either natively or emulated. */
-    HasGeometryShaders           bool /* = false */
-    HasTessellationShaders       bool /* = false */
-    HasTessellatorStage          bool /* = false */
-    HasComputeShaders            bool /* = false */
-    HasInstancing                bool /* = false */
-    HasOffsetInstancing          bool /* = false */
-    HasIndirectDrawing           bool /* = false */
-    HasViewportArrays            bool /* = false */
-    HasConservativeRasterization bool /* = false */
-    HasStreamOutputs             bool /* = false */
-    HasLogicOp                   bool /* = false */
-    HasPipelineCaching           bool /* = false */
-    HasPipelineStatistics        bool /* = false */
-    HasRenderCondition           bool /* = false */
+    HasRenderTargets              bool /* = false */
+    Has3DTextures                 bool /* = false */
+    HasCubeTextures               bool /* = false */
+    HasArrayTextures              bool /* = false */
+    HasCubeArrayTextures          bool /* = false */
+    HasMultiSampleTextures        bool /* = false */
+    HasMultiSampleArrayTextures   bool /* = false */
+    HasTextureViews               bool /* = false */
+    HasTextureViewSwizzle         bool /* = false */
+    HasTextureViewFormatSwizzle   bool /* = false */
+    HasBufferViews                bool /* = false */
+    HasSamplers                   bool /* LLGLRenderingFeatures.hasSamplers is deprecated since 0.04b; All backends must support sampler states either natively or emulated. */
+    HasConstantBuffers            bool /* = false */
+    HasStorageBuffers             bool /* = false */
+    HasUniforms                   bool /* LLGLRenderingFeatures.hasUniforms is deprecated since 0.04b; All backends must support uniforms either natively or emulated. */
+    HasGeometryShaders            bool /* = false */
+    HasTessellationShaders        bool /* = false */
+    HasTessellatorStage           bool /* = false */
+    HasComputeShaders             bool /* = false */
+    HasInstancing                 bool /* = false */
+    HasOffsetInstancing           bool /* = false */
+    HasIndirectDrawing            bool /* = false */
+    HasViewportArrays             bool /* = false */
+    HasConservativeRasterization  bool /* = false */
+    HasStreamOutputs              bool /* = false */
+    HasLogicOp                    bool /* = false */
+    HasPipelineCaching            bool /* = false */
+    HasPipelineStatistics         bool /* = false */
+    HasRenderCondition            bool /* = false */
+    HasTimestampQueries           bool /* = false */
+    HasQueryResolve               bool /* = false */
+    HasBindlessResourceHeaps      bool /* = false */
+    HasIndirectCountDrawing       bool /* = false */
+    HasMeshShaders                bool /* = false */
+    HasTileShaders                bool /* = false */
+    HasFramebufferFetch           bool /* = false */
+    HasVariableRateShading        bool /* = false */
+    HasIndirectStateChanges       bool /* = false */
+    HasTransientBuffers           bool /* = false */
+    HasPersistentMapping          bool /* = false */
+    HasSparseTextures             bool /* = false */
+    HasPlacementHeaps             bool /* = false */
+    HasSharedResources            bool /* = false */
+    HasConcurrentResourceCreation bool /* = false */
+    HasRayTracing                 bool /* = false */
+    HasRayQuery                   bool /* = false */
+    HasMultiview                  bool /* = false */
+    HasSamplerFeedback            bool /* = false */
 }
 
 type RenderingLimits struct {
-    LineWidthRange                [2]float32 /* = {1.0,1.0} */
-    MaxTextureArrayLayers         uint32     /* = 0 */
-    MaxColorAttachments           uint32     /* = 0 */
-    MaxPatchVertices              uint32     /* = 0 */
-    Max1DTextureSize              uint32     /* = 0 */
-    Max2DTextureSize              uint32     /* = 0 */
-    Max3DTextureSize              uint32     /* = 0 */
-    MaxCubeTextureSize            uint32     /* = 0 */
-    MaxAnisotropy                 uint32     /* = 0 */
-    MaxComputeShaderWorkGroups    [3]uint32  /* = {0,0,0} */
-    MaxComputeShaderWorkGroupSize [3]uint32  /* = {0,0,0} */
-    MaxViewports                  uint32     /* = 0 */
-    MaxViewportSize               [2]uint32  /* = {0,0} */
-    MaxBufferSize                 uint64     /* = 0 */
-    MaxConstantBufferSize         uint64     /* = 0 */
-    MaxStreamOutputs              uint32     /* = 0 */
-    MaxTessFactor                 uint32     /* = 0 */
-    MinConstantBufferAlignment    uint64     /* = 0 */
-    MinSampledBufferAlignment     uint64     /* = 0 */
-    MinStorageBufferAlignment     uint64     /* = 0 */
-    MaxColorBufferSamples         uint32     /* = 0 */
-    MaxDepthBufferSamples         uint32     /* = 0 */
-    MaxStencilBufferSamples       uint32     /* = 0 */
-    MaxNoAttachmentSamples        uint32     /* = 0 */
-    StorageResourceStageFlags     uint       /* = 0 */
+    LineWidthRange                   [2]float32 /* = {1.0,1.0} */
+    MaxTextureArrayLayers            uint32     /* = 0 */
+    MaxColorAttachments              uint32     /* = 0 */
+    MaxPatchVertices                 uint32     /* = 0 */
+    Max1DTextureSize                 uint32     /* = 0 */
+    Max2DTextureSize                 uint32     /* = 0 */
+    Max3DTextureSize                 uint32     /* = 0 */
+    MaxCubeTextureSize               uint32     /* = 0 */
+    MaxAnisotropy                    uint32     /* = 0 */
+    MaxComputeShaderWorkGroups       [3]uint32  /* = {0,0,0} */
+    MaxComputeShaderWorkGroupSize    [3]uint32  /* = {0,0,0} */
+    MaxComputeShaderSharedMemorySize uint32     /* = 0 */
+    MaxViewports                     uint32     /* = 0 */
+    MaxViewportSize                  [2]uint32  /* = {0,0} */
+    MaxBufferSize                    uint64     /* = 0 */
+    MaxConstantBufferSize            uint64     /* = 0 */
+    MaxStreamOutputs                 uint32     /* = 0 */
+    MaxTessFactor                    uint32     /* = 0 */
+    MinConstantBufferAlignment       uint64     /* = 0 */
+    MinSampledBufferAlignment        uint64     /* = 0 */
+    MinStorageBufferAlignment        uint64     /* = 0 */
+    MaxColorBufferSamples            uint32     /* = 0 */
+    MaxDepthBufferSamples            uint32     /* = 0 */
+    MaxStencilBufferSamples          uint32     /* = 0 */
+    MaxNoAttachmentSamples           uint32     /* = 0 */
+    StorageResourceStageFlags        uint       /* = 0 */
+    MaxBindlessResourceViews         uint32     /* = 0 */
+    SparseTileSize                   uint32     /* = 0 */
+    ShadingRateImageTileSize         uint32     /* = 0 */
+    SubgroupSizeRange                [2]uint32  /* = {0,0} */
+    SubgroupStageFlags               uint       /* = 0 */
+    SubgroupOperationFlags           uint       /* = 0 */
+    MaxMultiviewViewCount            uint32     /* = 0 */
+}
+
+type MemoryHeapInfo struct {
+    Flags  uint   /* = 0 */
+    Size   uint64 /* = 0 */
+    Usage  uint64 /* = 0 */
+    Budget uint64 /* = 0 */
+}
+
+type AdapterInfo struct {
+    Name         string
+    VendorID     uint32    /* = 0 */
+    DeviceID     uint32    /* = 0 */
+    VideoMemory  uint64    /* = 0 */
+    SharedMemory uint64    /* = 0 */
+    Luid         uint64    /* = 0 */
+    Uuid         [16]uint8 /* = {} */
+    IsActive     bool      /* = false */
 }
 
 type ResourceHeapDescriptor struct {
     DebugName        string          /* = "" */
     PipelineLayout   *PipelineLayout /* = nil */
     NumResourceViews uint32          /* = 0 */
+    Flags            uint            /* = 0 */
     BarrierFlags     uint            /* ResourceHeapDescriptor.barrierFlags is deprecated since 0.04b; Use PipelineLayoutDescriptor.barrierFlags instead! */
 }
 
@@ -1187,6 +1534,14 @@ type ShaderMacro struct {
     Definition string /* = "" */
 }
 
+type FrameTimeStatistics struct {
+    Last    float32 /* = 0.0 */
+    Average float32 /* = 0.0 */
+    P50     float32 /* = 0.0 */
+    P95     float32 /* = 0.0 */
+    P99     float32 /* = 0.0 */
+}
+
 type TextureSubresource struct {
     BaseArrayLayer uint32 /* = 0 */
     NumArrayLayers uint32 /* = 1 */
@@ -1231,12 +1586,63 @@ type BufferViewDescriptor struct {
     Size   uint64 /* = LLGL_WHOLE_SIZE */
 }
 
+type AccelerationStructureGeometryDescriptor struct {
+    VertexBuffer *Buffer /* = nil */
+    VertexOffset uint64  /* = 0 */
+    VertexStride uint32  /* = 12 */
+    NumVertices  uint32  /* = 0 */
+    VertexFormat Format  /* = FormatRGB32Float */
+    IndexFormat  Format  /* = FormatR32UInt */
+    IndexBuffer  *Buffer /* = nil */
+    IndexOffset  uint64  /* = 0 */
+    NumIndices   uint32  /* = 0 */
+    Opaque       bool    /* = true */
+}
+
 type AttachmentClear struct {
     Flags           uint       /* = 0 */
     ColorAttachment uint32     /* = 0 */
     ClearValue      ClearValue
 }
 
+type CommandBufferDescriptor struct {
+    DebugName          string           /* = "" */
+    Flags              uint             /* = 0 */
+    NumNativeBuffers   uint32           /* = 0 */
+    MinStagingPoolSize uint64           /* = (0xFFFF+1) */
+    RenderPass         *RenderPass      /* = nil */
+    QueueType          CommandQueueType /* = CommandQueueTypeGraphics */
+}
+
+type IndirectArgumentDescriptor struct {
+    Type        IndirectArgumentType /* = IndirectArgumentTypeDraw */
+    First       uint32               /* = 0 */
+    NumUniforms uint32               /* = 0 */
+}
+
+type DrawPackedDescriptor struct {
+    VertexBuffers []Buffer       /* = nil */
+    IndexBuffers  []Buffer       /* = nil */
+    IndexFormat   Format         /* = FormatR32UInt */
+    ResourceHeaps []ResourceHeap /* = nil */
+    UniformData   unsafe.Pointer /* = nil */
+    FirstUniform  uint32         /* = 0 */
+    UniformsSize  uint16         /* = 0 */
+    Indexed       bool           /* = false */
+    Records       []DrawRecord   /* = nil */
+}
+
+type CommandRecord struct {
+    Opcode      CommandOpcode /* = CommandOpcodeDraw */
+    ObjectIndex uint32        /* = LLGL_INVALID_SLOT */
+    Arg0        uint32        /* = 0 */
+    Arg1        uint32        /* = 0 */
+    Arg2        uint32        /* = 0 */
+    Arg3        uint32        /* = 0 */
+    Arg4        uint32        /* = 0 */
+    Arg5        uint32        /* = 0 */
+}
+
 type DisplayMode struct {
     Resolution  Extent2D
     RefreshRate uint32   /* = 0 */
@@ -1344,6 +1750,26 @@ type TessellationDescriptor struct {
     OutputWindingCCW bool                  /* = false */
 }
 
+type ComputePipelineDescriptor struct {
+    DebugName               string                   /* = "" */
+    Flags                   uint                     /* = 0 */
+    PipelineLayout          *PipelineLayout          /* = nil */
+    ComputeShader           *Shader                  /* = nil */
+    SpecializationConstants []SpecializationConstant /* = nil */
+}
+
+type RayTracingPipelineDescriptor struct {
+    DebugName           string                         /* = "" */
+    Flags               uint                           /* = 0 */
+    PipelineLayout      *PipelineLayout                /* = nil */
+    RayGenerationShader *Shader                        /* = nil */
+    MissShaders         []Shader                       /* = nil */
+    HitGroups           []RayTracingHitGroupDescriptor /* = nil */
+    MaxRecursionDepth   uint32                         /* = 1 */
+    MaxPayloadSize      uint32                         /* = 16 */
+    MaxAttributeSize    uint32                         /* = 8 */
+}
+
 type QueryHeapDescriptor struct {
     DebugName       string    /* = "" */
     Type            QueryType /* = QueryTypeSamplesPassed */
@@ -1351,10 +1777,18 @@ type QueryHeapDescriptor struct {
     RenderCondition bool      /* = false */
 }
 
-type FrameProfile struct {
-    CommandQueueRecord  ProfileCommandQueueRecord
-    CommandBufferRecord ProfileCommandBufferRecord
-    TimeRecords         []ProfileTimeRecord        /* = nil */
+type ProfileStatisticsRecord struct {
+    Annotation string
+    Frame      uint64                  /* = 0 */
+    Statistics QueryPipelineStatistics
+}
+
+type ProfileEventRecord struct {
+    Type          ProfileEventType /* = ProfileEventTypeEncoding */
+    Annotation    string
+    Thread        uint32           /* = 0 */
+    CPUTicksStart uint64           /* = 0 */
+    CPUTicksEnd   uint64           /* = 0 */
 }
 
 type AttachmentFormatDescriptor struct {
@@ -1364,14 +1798,20 @@ type AttachmentFormatDescriptor struct {
 }
 
 type RenderSystemDescriptor struct {
-    ModuleName         string
-    Flags              uint               /* = 0 */
-    Profiler           unsafe.Pointer     /* = nil */
-    Debugger           *RenderingDebugger /* = nil */
-    RendererConfig     unsafe.Pointer     /* = nil */
-    RendererConfigSize uintptr            /* = 0 */
-    NativeHandle       unsafe.Pointer     /* = nil */
-    NativeHandleSize   uintptr            /* = 0 */
+    ModuleName             string
+    Flags                  uint                /* = 0 */
+    AdapterIndex           int                 /* = -1 */
+    AdapterLUID            uint64              /* = 0 */
+    AdapterUUID            [16]uint8           /* = {} */
+    Profiler               unsafe.Pointer      /* = nil */
+    Debugger               *RenderingDebugger  /* = nil */
+    RendererConfig         unsafe.Pointer      /* = nil */
+    RendererConfigSize     uintptr             /* = 0 */
+    NativeHandle           unsafe.Pointer      /* = nil */
+    NativeHandleSize       uintptr             /* = 0 */
+    PipelineCacheDirectory string              /* = "" */
+    ShaderCacheFilename    string              /* = "" */
+    Allocator              AllocatorDescriptor
 }
 
 type RenderingCapabilities struct {
@@ -1390,6 +1830,13 @@ type AttachmentDescriptor struct {
     ArrayLayer uint32   /* = 0 */
 }
 
+type SharedResourceHandle struct {
+    Type   SharedHandleType /* = SharedHandleTypeUndefined */
+    Handle unsafe.Pointer   /* = nil */
+    Fd     int32            /* = -1 */
+    Size   uint64           /* = 0 */
+}
+
 type SamplerDescriptor struct {
     DebugName      string             /* = "" */
     AddressModeU   SamplerAddressMode /* = SamplerAddressModeRepeat */
@@ -1413,15 +1860,31 @@ type ComputeShaderAttributes struct {
 }
 
 type SwapChainDescriptor struct {
-    DebugName   string   /* = "" */
-    Resolution  Extent2D
-    ColorBits   int      /* = 32 */
-    DepthBits   int      /* = 24 */
-    StencilBits int      /* = 8 */
-    Samples     uint32   /* = 1 */
-    SwapBuffers uint32   /* = 2 */
-    Fullscreen  bool     /* = false */
-    Resizable   bool     /* = false */
+    DebugName             string      /* = "" */
+    Resolution            Extent2D
+    ColorBits             int         /* = 32 */
+    DepthBits             int         /* = 24 */
+    StencilBits           int         /* = 8 */
+    Samples               uint32      /* = 1 */
+    SwapBuffers           uint32      /* = 2 */
+    MaxFramesInFlight     uint32      /* = 0 */
+    FrameStatisticsWindow uint32      /* = 0 */
+    PresentMode           PresentMode /* = PresentModeDefault */
+    ColorSpace            ColorSpace  /* = ColorSpaceSRGB */
+    Fullscreen            bool        /* = false */
+    Resizable             bool        /* = false */
+    LateImageAcquire      bool        /* = false */
+    PreTransform          bool        /* = false */
+    FramePacing           bool        /* = false */
+}
+
+type FrameStatistics struct {
+    NumFrames        uint64              /* = 0 */
+    NumSamples       uint32              /* = 0 */
+    CPUFrameTime     FrameTimeStatistics
+    DisplayFrameTime FrameTimeStatistics
+    PresentInterval  FrameTimeStatistics
+    QueueStallTime   FrameTimeStatistics
 }
 
 type TextureSwizzleRGBA struct {
@@ -1457,6 +1920,22 @@ type TextureDescriptor struct {
     ClearValue     ClearValue
 }
 
+type TileMappingDescriptor struct {
+    Texture    *Texture /* = nil */
+    MipLevel   uint32   /* = 0 */
+    ArrayLayer uint32   /* = 0 */
+    TileOffset Offset3D
+    NumTiles   Extent3D /* = {1,1,1} */
+    Resident   bool     /* = true */
+}
+
+type SamplerFeedbackDescriptor struct {
+    DebugName     string              /* = "" */
+    PairedTexture *Texture            /* = nil */
+    Type          SamplerFeedbackType /* = SamplerFeedbackTypeMinMip */
+    MipRegion     Extent3D            /* = {4,4,1} */
+}
+
 type VertexAttribute struct {
     Name            string
     Format          Format      /* = FormatRGBA32Float */
@@ -1489,6 +1968,30 @@ type BufferDescriptor struct {
     VertexAttribs  []VertexAttribute /* = nil */
 }
 
+type AccelerationStructureDescriptor struct {
+    Type       AccelerationStructureType                 /* = AccelerationStructureTypeBottomLevel */
+    Flags      uint                                      /* = 0 */
+    Geometries []AccelerationStructureGeometryDescriptor /* = nil */
+    Instances  []AccelerationStructureInstance           /* = nil */
+}
+
+type IndirectCommandDescriptor struct {
+    Arguments []IndirectArgumentDescriptor /* = nil */
+    Stride    uint32                       /* = 0 */
+}
+
+type CommandBatchDescriptor struct {
+    Objects     []RenderSystemChild /* = nil */
+    UniformData unsafe.Pointer      /* = nil */
+    Records     []CommandRecord     /* = nil */
+}
+
+type TextureUploadDescriptor struct {
+    Texture   *Texture      /* = nil */
+    Region    TextureRegion
+    ImageView ImageView
+}
+
 type StaticSamplerDescriptor struct {
     Name       string
     StageFlags uint              /* = 0 */
@@ -1513,12 +2016,37 @@ type BlendDescriptor struct {
     Targets                 [8]BlendTargetDescriptor
 }
 
+type FrameProfile struct {
+    CommandQueueRecord  ProfileCommandQueueRecord
+    CommandBufferRecord ProfileCommandBufferRecord
+    BackendRecord       ProfileBackendRecord
+    TimeRecords         []ProfileTimeRecord        /* = nil */
+    ScopeRecords        []ProfileScopeRecord       /* = nil */
+    EventRecords        []ProfileEventRecord       /* = nil */
+    StatisticsRecords   []ProfileStatisticsRecord  /* = nil */
+    PipelineStatistics  QueryPipelineStatistics
+}
+
 type RenderPassDescriptor struct {
     DebugName         string                        /* = "" */
     ColorAttachments  [8]AttachmentFormatDescriptor
     DepthAttachment   AttachmentFormatDescriptor
     StencilAttachment AttachmentFormatDescriptor
     Samples           uint32                        /* = 1 */
+    ViewMask          uint32                        /* = 0 */
+}
+
+type FileUploadDescriptor struct {
+    Filename         string          /* = "" */
+    FileOffset       uint64          /* = 0 */
+    FileSize         uint64          /* = 0 */
+    Compression      FileCompression /* = FileCompressionUncompressed */
+    UncompressedSize uint64          /* = 0 */
+    Buffer           *Buffer         /* = nil */
+    BufferOffset     uint64          /* = 0 */
+    Texture          *Texture        /* = nil */
+    TextureRegion    TextureRegion
+    RowStride        uint32          /* = 0 */
 }
 
 type RenderTargetDescriptor struct {
@@ -1526,9 +2054,11 @@ type RenderTargetDescriptor struct {
     RenderPass             *RenderPass             /* = nil */
     Resolution             Extent2D
     Samples                uint32                  /* = 1 */
+    ViewMask               uint32                  /* = 0 */
     ColorAttachments       [8]AttachmentDescriptor
     ResolveAttachments     [8]AttachmentDescriptor
     DepthStencilAttachment AttachmentDescriptor
+    ShadingRateAttachment  AttachmentDescriptor
 }
 
 type VertexShaderAttributes struct {
@@ -1546,6 +2076,12 @@ type ShaderResourceReflection struct {
     StorageBufferType  StorageBufferType /* = StorageBufferTypeUndefined */
 }
 
+type TextureCopyRegion struct {
+    DstLocation TextureLocation
+    SrcLocation TextureLocation
+    Extent      Extent3D
+}
+
 type TextureViewDescriptor struct {
     Type        TextureType        /* = TextureTypeTexture2D */
     Format      Format             /* = FormatRGBA8UNorm */
@@ -1561,26 +2097,33 @@ type PipelineLayoutDescriptor struct {
     Uniforms                []UniformDescriptor                /* = nil */
     CombinedTextureSamplers []CombinedTextureSamplerDescriptor /* = nil */
     BarrierFlags            uint                               /* = 0 */
+    Flags                   uint                               /* = 0 */
 }
 
 type GraphicsPipelineDescriptor struct {
-    DebugName            string                 /* = "" */
-    PipelineLayout       *PipelineLayout        /* = nil */
-    RenderPass           *RenderPass            /* = nil */
-    VertexShader         *Shader                /* = nil */
-    TessControlShader    *Shader                /* = nil */
-    TessEvaluationShader *Shader                /* = nil */
-    GeometryShader       *Shader                /* = nil */
-    FragmentShader       *Shader                /* = nil */
-    IndexFormat          Format                 /* = FormatUndefined */
-    PrimitiveTopology    PrimitiveTopology      /* = PrimitiveTopologyTriangleList */
-    Viewports            []Viewport             /* = nil */
-    Scissors             []Scissor              /* = nil */
-    Depth                DepthDescriptor
-    Stencil              StencilDescriptor
-    Rasterizer           RasterizerDescriptor
-    Blend                BlendDescriptor
-    Tessellation         TessellationDescriptor
+    DebugName               string                   /* = "" */
+    Flags                   uint                     /* = 0 */
+    PipelineLayout          *PipelineLayout          /* = nil */
+    RenderPass              *RenderPass              /* = nil */
+    ViewMask                uint32                   /* = 0 */
+    VertexShader            *Shader                  /* = nil */
+    TessControlShader       *Shader                  /* = nil */
+    TessEvaluationShader    *Shader                  /* = nil */
+    GeometryShader          *Shader                  /* = nil */
+    TaskShader              *Shader                  /* = nil */
+    MeshShader              *Shader                  /* = nil */
+    TileShader              *Shader                  /* = nil */
+    FragmentShader          *Shader                  /* = nil */
+    IndexFormat             Format                   /* = FormatUndefined */
+    PrimitiveTopology       PrimitiveTopology        /* = PrimitiveTopologyTriangleList */
+    Viewports               []Viewport               /* = nil */
+    Scissors                []Scissor                /* = nil */
+    Depth                   DepthDescriptor
+    Stencil                 StencilDescriptor
+    Rasterizer              RasterizerDescriptor
+    Blend                   BlendDescriptor
+    Tessellation            TessellationDescriptor
+    SpecializationConstants []SpecializationConstant /* = nil */
 }
 
 type ResourceViewDescriptor struct {
@@ -1591,19 +2134,21 @@ type ResourceViewDescriptor struct {
 }
 
 type ShaderDescriptor struct {
-    DebugName  string                   /* = "" */
-    Type       ShaderType               /* = ShaderTypeUndefined */
-    Source     string                   /* = "" */
-    SourceSize uintptr                  /* = 0 */
-    SourceType ShaderSourceType         /* = ShaderSourceTypeCodeFile */
-    EntryPoint string                   /* = "" */
-    Profile    string                   /* = "" */
-    Defines    *ShaderMacro             /* = nil */
-    Flags      uint                     /* = 0 */
-    Name       string                   /* ShaderDescriptor.name is deprecated since 0.04b; Use ShaderDescriptor.debugName instead! */
-    Vertex     VertexShaderAttributes
-    Fragment   FragmentShaderAttributes
-    Compute    ComputeShaderAttributes
+    DebugName          string                   /* = "" */
+    Type               ShaderType               /* = ShaderTypeUndefined */
+    Source             string                   /* = "" */
+    SourceSize         uintptr                  /* = 0 */
+    SourceType         ShaderSourceType         /* = ShaderSourceTypeCodeFile */
+    EntryPoint         string                   /* = "" */
+    Profile            string                   /* = "" */
+    Defines            *ShaderMacro             /* = nil */
+    Flags              uint                     /* = 0 */
+    Name               string                   /* ShaderDescriptor.name is deprecated since 0.04b; Use ShaderDescriptor.debugName instead! */
+    Vertex             VertexShaderAttributes
+    Fragment           FragmentShaderAttributes
+    Compute            ComputeShaderAttributes
+    ReflectionData     unsafe.Pointer           /* = nil */
+    ReflectionDataSize uintptr                  /* = 0 */
 }
 
 type ShaderReflection struct {
@@ -14,6 +14,7 @@ import "C"
 type PipelineState interface {
 	RenderSystemChild
 	GetReport() Report
+	IsReady() bool
 }
 
 type pipelineStateImpl struct {
@@ -28,6 +29,10 @@ func (self pipelineStateImpl) GetReport() Report {
 	return reportImpl{ C.llglGetPipelineStateReport(self.native) }
 }
 
+func (self pipelineStateImpl) IsReady() bool {
+	return bool(C.llglIsPipelineStateReady(self.native))
+}
+
 
 
 // ================================================================================
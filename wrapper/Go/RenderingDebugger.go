@@ -8,12 +8,29 @@
 package llgl
 
 // #cgo CFLAGS: -I ../../include
+// #include <stdlib.h>
 // #include <LLGL-C/LLGL.h>
 import "C"
 
+import "unsafe"
+
 type RenderingDebugger interface {
 	SetTimeRecording(enabled bool)
 	GetTimeRecording() bool
+	SetScopeRecording(enabled bool)
+	GetScopeRecording() bool
+	SetEventRecording(enabled bool)
+	GetEventRecording() bool
+	SetStatisticsRecording(enabled bool)
+	GetStatisticsRecording() bool
+	SetValidation(enabled bool)
+	GetValidation() bool
+	SetValidationFlags(flags uint)
+	GetValidationFlags() uint
+	BeginCapture(filename string, numFrames uint32)
+	EndCapture()
+	GetCaptureFilename() string
+	GetCaptureFrames() uint32
 	FlushProfile(outFrameProfile *FrameProfile)
 }
 
@@ -29,6 +46,67 @@ func (self renderingDebuggerImpl) GetTimeRecording() bool {
 	return bool(C.llglGetDebuggerTimeRecording(self.native))
 }
 
+func (self renderingDebuggerImpl) SetScopeRecording(enabled bool) {
+	C.llglSetDebuggerScopeRecording(self.native, C.bool(enabled))
+}
+
+func (self renderingDebuggerImpl) GetScopeRecording() bool {
+	return bool(C.llglGetDebuggerScopeRecording(self.native))
+}
+
+func (self renderingDebuggerImpl) SetEventRecording(enabled bool) {
+	C.llglSetDebuggerEventRecording(self.native, C.bool(enabled))
+}
+
+func (self renderingDebuggerImpl) GetEventRecording() bool {
+	return bool(C.llglGetDebuggerEventRecording(self.native))
+}
+
+func (self renderingDebuggerImpl) SetStatisticsRecording(enabled bool) {
+	C.llglSetDebuggerStatisticsRecording(self.native, C.bool(enabled))
+}
+
+func (self renderingDebuggerImpl) GetStatisticsRecording() bool {
+	return bool(C.llglGetDebuggerStatisticsRecording(self.native))
+}
+
+func (self renderingDebuggerImpl) SetValidation(enabled bool) {
+	C.llglSetDebuggerValidation(self.native, C.bool(enabled))
+}
+
+func (self renderingDebuggerImpl) GetValidation() bool {
+	return bool(C.llglGetDebuggerValidation(self.native))
+}
+
+func (self renderingDebuggerImpl) SetValidationFlags(flags uint) {
+	C.llglSetDebuggerValidationFlags(self.native, C.long(flags))
+}
+
+func (self renderingDebuggerImpl) GetValidationFlags() uint {
+	return uint(C.llglGetDebuggerValidationFlags(self.native))
+}
+
+func (self renderingDebuggerImpl) BeginCapture(filename string, numFrames uint32) {
+	filenameCstr := C.CString(filename)
+	C.llglBeginDebuggerCapture(self.native, filenameCstr, C.uint32_t(numFrames))
+	C.free(unsafe.Pointer(filenameCstr))
+}
+
+func (self renderingDebuggerImpl) EndCapture() {
+	C.llglEndDebuggerCapture(self.native)
+}
+
+func (self renderingDebuggerImpl) GetCaptureFilename() string {
+	if filename := C.llglGetDebuggerCaptureFilename(self.native); filename != nil {
+		return C.GoString(filename)
+	}
+	return ""
+}
+
+func (self renderingDebuggerImpl) GetCaptureFrames() uint32 {
+	return uint32(C.llglGetDebuggerCaptureFrames(self.native))
+}
+
 func (self renderingDebuggerImpl) FlushProfile(outFrameProfile *FrameProfile) {
 	if outFrameProfile != nil {
 		var nativeProfile C.LLGLFrameProfile